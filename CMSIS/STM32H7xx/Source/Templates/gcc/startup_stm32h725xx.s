@@ -43,6 +43,24 @@ defined in linker script */
 .word  _sbss
 /* end address for the .bss section. defined in linker script */
 .word  _ebss
+/* optional tables of the sections to initialize, defined in linker script.
+   The copy table holds, for each initialized section (ITCM code, DTCM, AXI SRAM,
+   SRAM4 data...), three words: load address, start address and end address.
+   The zero table holds, for each zero-initialized section, two words: start
+   address and end address. When the linker script does not define them, the
+   single .data and .bss sections above are initialized. Example:
+     .copy.table : {
+       . = ALIGN(4);
+       __copy_table_start__ = .;
+       LONG(LOADADDR(.itcm_text)) LONG(ADDR(.itcm_text)) LONG(ADDR(.itcm_text) + SIZEOF(.itcm_text))
+       LONG(LOADADDR(.data))      LONG(ADDR(.data))      LONG(ADDR(.data) + SIZEOF(.data))
+       __copy_table_end__ = .;
+     } >FLASH
+   Sections must start and end on a word boundary. */
+.weak  __copy_table_start__
+.weak  __copy_table_end__
+.weak  __zero_table_start__
+.weak  __zero_table_end__
 /* stack used for SystemInit_ExtMemCtl; always internal RAM used */
 
 /**
@@ -63,41 +81,103 @@ Reset_Handler:
 /* Call the clock system initialization function.*/
   bl  SystemInit
 
-/* Copy the data segment initializers from flash to SRAM */
-  ldr r0, =_sdata
-  ldr r1, =_edata
-  ldr r2, =_sidata
-  movs r3, #0
-  b LoopCopyDataInit
-
-CopyDataInit:
-  ldr r4, [r2, r3]
-  str r4, [r0, r3]
-  adds r3, r3, #4
-
-LoopCopyDataInit:
-  adds r4, r0, r3
-  cmp r4, r1
-  bcc CopyDataInit
-/* Zero fill the bss segment. */
-  ldr r2, =_sbss
-  ldr r4, =_ebss
-  movs r3, #0
-  b LoopFillZerobss
-
-FillZerobss:
-  str  r3, [r2]
-  adds r2, r2, #4
-
-LoopFillZerobss:
-  cmp r2, r4
-  bcc FillZerobss
-
+/* Copy the initialized sections of the copy table, or the data segment
+   initializers, from flash to SRAM */
+  ldr r6, =__copy_table_start__
+  ldr r7, =__copy_table_end__
+  cmp r6, #0
+  bne LoopCopyTable
+  ldr r0, =_sidata
+  ldr r1, =_sdata
+  ldr r2, =_edata
+  bl  CopySection
+  b   ZeroSections
+
+CopyTable:
+  ldmia r6!, {r0, r1, r2}
+  bl  CopySection
+
+LoopCopyTable:
+  cmp r6, r7
+  bcc CopyTable
+
+/* Zero fill the sections of the zero table, or the bss segment. */
+ZeroSections:
+  ldr r6, =__zero_table_start__
+  ldr r7, =__zero_table_end__
+  cmp r6, #0
+  bne LoopZeroTable
+  ldr r0, =_sbss
+  ldr r1, =_ebss
+  bl  ZeroSection
+  b   SectionsDone
+
+ZeroTable:
+  ldmia r6!, {r0, r1}
+  bl  ZeroSection
+
+LoopZeroTable:
+  cmp r6, r7
+  bcc ZeroTable
+
+SectionsDone:
 /* Call static constructors */
     bl __libc_init_array
 /* Call the application's entry point.*/
   bl  main
   bx  lr
+
+/* Copy the words from r0 to [r1, r2): 16-byte LDM/STM bursts, then single words */
+CopySection:
+  subs r3, r2, r1
+  bic  r3, r3, #15
+  adds r3, r3, r1
+  b LoopCopyBurst
+
+CopyBurst:
+  ldmia r0!, {r4, r5, r8, r9}
+  stmia r1!, {r4, r5, r8, r9}
+
+LoopCopyBurst:
+  cmp r1, r3
+  bcc CopyBurst
+  b LoopCopyWord
+
+CopyWord:
+  ldr r4, [r0], #4
+  str r4, [r1], #4
+
+LoopCopyWord:
+  cmp r1, r2
+  bcc CopyWord
+  bx  lr
+
+/* Zero fill the words of [r0, r1): 16-byte STM bursts, then single words */
+ZeroSection:
+  subs r3, r1, r0
+  bic  r3, r3, #15
+  adds r3, r3, r0
+  movs r4, #0
+  movs r5, #0
+  mov  r8, r4
+  mov  r9, r4
+  b LoopZeroBurst
+
+ZeroBurst:
+  stmia r0!, {r4, r5, r8, r9}
+
+LoopZeroBurst:
+  cmp r0, r3
+  bcc ZeroBurst
+  b LoopZeroWord
+
+ZeroWord:
+  str  r4, [r0], #4
+
+LoopZeroWord:
+  cmp r0, r1
+  bcc ZeroWord
+  bx  lr
 .size  Reset_Handler, .-Reset_Handler
 
 /**
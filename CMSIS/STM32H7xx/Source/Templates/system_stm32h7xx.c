@@ -80,6 +80,11 @@
 /*!< Uncomment the following line if you need to use initialized data in D2 domain SRAM (AHB SRAM) */
 /* #define DATA_IN_D2_SRAM */
 
+/*!< Uncomment the following line to start the HSE oscillator in SystemInit(), so that its
+     startup overlaps the .data/.bss initialization; HAL_RCC_OscConfig() then only waits
+     for the remaining startup time. Define also BOOT_HSE_BYPASS for an external clock. */
+/* #define BOOT_START_HSE */
+
 /* Note: Following vector table addresses must be defined in line with linker
          configuration. */
 /*!< Uncomment the following line if you need to relocate the vector table
@@ -254,6 +259,14 @@ void SystemInit (void)
   /* Disable all interrupts */
   RCC->CIER = 0x00000000;
 
+#if defined(BOOT_START_HSE)
+  /* Start the HSE, HAL_RCC_OscConfig() waits for its ready flag */
+#if defined(BOOT_HSE_BYPASS)
+  RCC->CR |= RCC_CR_HSEBYP;
+#endif /* BOOT_HSE_BYPASS */
+  RCC->CR |= RCC_CR_HSEON;
+#endif /* BOOT_START_HSE */
+
 #if (STM32H7_DEV_ID == 0x450UL)
   /* dual core CM7 or single core line */
   if((DBGMCU->IDCODE & 0xFFFF0000U) < 0x20000000U)
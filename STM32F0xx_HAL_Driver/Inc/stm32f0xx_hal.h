@@ -85,6 +85,25 @@
   */
 
 /* Exported types ------------------------------------------------------------*/
+/** @defgroup HAL_Exported_Types HAL Exported Types
+  * @{
+  */
+
+/**
+  * @brief  HAL wait reason, passed to HAL_WaitHook() by the blocking HAL functions
+  */
+typedef enum
+{
+  HAL_WAIT_DELAY = 0x00U,  /*!< HAL_Delay()                                       */
+  HAL_WAIT_UART  = 0x01U,  /*!< UART flag polling, Handle is a UART_HandleTypeDef  */
+  HAL_WAIT_I2C   = 0x02U,  /*!< I2C flag polling, Handle is a I2C_HandleTypeDef    */
+  HAL_WAIT_SPI   = 0x03U,  /*!< SPI flag polling, Handle is a SPI_HandleTypeDef    */
+  HAL_WAIT_FLASH = 0x04U   /*!< FLASH operation, Handle is NULL                    */
+} HAL_WaitReasonTypeDef;
+/**
+  * @}
+  */
+
 /* Exported constants --------------------------------------------------------*/
 /** @defgroup HAL_Exported_Constants HAL Exported Constants
   * @{
@@ -525,6 +544,7 @@ HAL_StatusTypeDef HAL_InitTick (uint32_t TickPriority);
 void              HAL_IncTick(void);
 void              HAL_Delay(__IO uint32_t Delay);
 uint32_t          HAL_GetTick(void);
+void              HAL_WaitHook(HAL_WaitReasonTypeDef Reason, const void *Handle);
 void              HAL_SuspendTick(void);
 void              HAL_ResumeTick(void);
 uint32_t          HAL_GetHalVersion(void);
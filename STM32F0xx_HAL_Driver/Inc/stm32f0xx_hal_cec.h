@@ -184,6 +184,65 @@ typedef enum
   HAL_CEC_STATE_ERROR             = 0x60U     /*!< Error Value is allowed for gState only              */
 }HAL_CEC_StateTypeDef;
 
+#if !defined(CEC_TXQUEUE_SIZE)
+#define CEC_TXQUEUE_SIZE    4U    /*!< Frames held by the transmit queue, power of 2                 */
+#endif /* CEC_TXQUEUE_SIZE */
+
+#if !defined(CEC_RXRING_SIZE)
+#define CEC_RXRING_SIZE     4U    /*!< Frames held by the receive ring, power of 2, one being the
+                                       frame under reception                                          */
+#endif /* CEC_RXRING_SIZE */
+
+#if !defined(CEC_TX_MAX_RETRIES)
+#define CEC_TX_MAX_RETRIES  4U    /*!< Retransmissions of a frame not acknowledged, the CEC
+                                       specification allowing up to 5 attempts                       */
+#endif /* CEC_TX_MAX_RETRIES */
+
+#define CEC_FRAME_MAX_SIZE  16U   /*!< Header block, opcode and up to 14 operands                    */
+
+/**
+  * @brief  CEC frame structure definition
+  */
+typedef struct
+{
+  uint8_t  Size;                              /*!< Number of bytes of the frame, header included, from 1 to 16  */
+
+  uint8_t  Data[CEC_FRAME_MAX_SIZE];          /*!< Header block followed by the opcode and the operands         */
+}CEC_FrameTypeDef;
+
+/**
+  * @brief  CEC queue structure definition, transmit queue and receive ring
+  *         attached to the handle by HAL_CEC_Queue_Start()
+  */
+typedef struct
+{
+  CEC_FrameTypeDef  TxFrames[CEC_TXQUEUE_SIZE];  /*!< Frames waiting for transmission                            */
+
+  __IO uint32_t     TxHead;                      /*!< Free running index of the next frame queued               */
+
+  __IO uint32_t     TxTail;                      /*!< Free running index of the frame being sent                */
+
+  __IO uint32_t     TxActive;                    /*!< 1 while the frame at TxTail is on the bus                 */
+
+  uint32_t          TxRetries;                   /*!< Retransmissions already done for the frame at TxTail      */
+
+  CEC_FrameTypeDef  RxFrames[CEC_RXRING_SIZE];   /*!< Frames received, the one at RxHead being under reception  */
+
+  __IO uint32_t     RxHead;                      /*!< Free running index of the frame under reception           */
+
+  __IO uint32_t     RxTail;                      /*!< Free running index of the oldest frame received           */
+
+  uint8_t           *pRxBuffer;                  /*!< Init.RxBuffer of the handle, restored by the stop         */
+
+  __IO uint32_t     TxDoneCount;                 /*!< Frames acknowledged since the start                       */
+
+  __IO uint32_t     TxFailCount;                 /*!< Frames dropped after CEC_TX_MAX_RETRIES retransmissions   */
+
+  __IO uint32_t     ArbitrationLostCount;        /*!< Arbitrations lost, the hardware retrying the frame        */
+
+  __IO uint32_t     RxDropCount;                 /*!< Frames received while the ring was full, overwritten      */
+}CEC_QueueTypeDef;
+
 /**
   * @brief  CEC handle Structure definition
   */
@@ -210,6 +269,8 @@ typedef struct
 
   uint32_t                ErrorCode;      /*!< For errors handling purposes, copy of ISR register
                                                in case error is reported */
+
+  CEC_QueueTypeDef        *pQueue;        /*!< Transmit queue and receive ring, NULL when not used */
 }CEC_HandleTypeDef;
 /**
   * @}
@@ -419,6 +480,14 @@ typedef struct
   * @}
   */
 
+/** @defgroup CEC_WakeUp_EXTI_Line CEC WakeUp EXTI Line
+  * @{
+  */
+#define CEC_WAKEUP_EXTI_LINE            EXTI_IMR_MR27  /*!< External interrupt line 27 connected to the CEC wakeup */
+/**
+  * @}
+  */
+
 /**
   * @}
   */
@@ -592,6 +661,12 @@ typedef struct
   */
 #define __HAL_CEC_SET_OAR(__HANDLE__,__ADDRESS__)   SET_BIT((__HANDLE__)->Instance->CFGR, (__ADDRESS__)<< CEC_CFGR_OAR_LSB_POS)
 
+/** @brief  Enable or disable the CEC wakeup EXTI line interrupt.
+  * @retval none
+  */
+#define __HAL_CEC_WAKEUP_EXTI_ENABLE_IT()     SET_BIT(EXTI->IMR, CEC_WAKEUP_EXTI_LINE)
+#define __HAL_CEC_WAKEUP_EXTI_DISABLE_IT()    CLEAR_BIT(EXTI->IMR, CEC_WAKEUP_EXTI_LINE)
+
 /**
   * @}
   */
@@ -625,6 +700,12 @@ void HAL_CEC_IRQHandler(CEC_HandleTypeDef *hcec);
 void HAL_CEC_TxCpltCallback(CEC_HandleTypeDef *hcec);
 void HAL_CEC_RxCpltCallback(CEC_HandleTypeDef *hcec, uint32_t RxFrameSize);
 void HAL_CEC_ErrorCallback(CEC_HandleTypeDef *hcec);
+
+/* Transmit queue and receive ring ********************************************/
+HAL_StatusTypeDef HAL_CEC_Queue_Start(CEC_HandleTypeDef *hcec, CEC_QueueTypeDef *pQueue);
+HAL_StatusTypeDef HAL_CEC_Queue_Stop(CEC_HandleTypeDef *hcec);
+HAL_StatusTypeDef HAL_CEC_Queue_Transmit(CEC_HandleTypeDef *hcec, uint8_t InitiatorAddress, uint8_t DestinationAddress, const uint8_t *pData, uint32_t Size);
+HAL_StatusTypeDef HAL_CEC_Queue_Receive(CEC_HandleTypeDef *hcec, CEC_FrameTypeDef *pFrame);
 /**
   * @}
   */
@@ -635,6 +716,8 @@ void HAL_CEC_ErrorCallback(CEC_HandleTypeDef *hcec);
 /* Peripheral State functions  ************************************************/
 HAL_CEC_StateTypeDef HAL_CEC_GetState(CEC_HandleTypeDef *hcec);
 uint32_t HAL_CEC_GetError(CEC_HandleTypeDef *hcec);
+HAL_StatusTypeDef HAL_CEC_EnableWakeUpStop(CEC_HandleTypeDef *hcec);
+HAL_StatusTypeDef HAL_CEC_DisableWakeUpStop(CEC_HandleTypeDef *hcec);
 /**
   * @}
   */
@@ -164,10 +164,15 @@
                                                                               /*  Warning: Must be set to higher priority for HAL_Delay()  */
                                                                               /*  and HAL_GetTick() usage under interrupt context          */
 #define  USE_RTOS                     0U
+#define  USE_HAL_ATOMIC_LOCK          0U /*!< 1: handle lock safe between interrupt and thread */
+#define  USE_HAL_NO_LOCK              0U /*!< 1: handle lock compiled out, single context only */
 #define  PREFETCH_ENABLE              1U
 #define  INSTRUCTION_CACHE_ENABLE     0U
 #define  DATA_CACHE_ENABLE            0U
 #define  USE_SPI_CRC                  1U
+#define  USE_SPI_DMA                  1U
+#define  USE_UART_DMA                 1U
+#define  USE_I2C_DMA                  1U
 
 /* ########################## Assert Selection ############################## */
 /**
@@ -44,6 +44,10 @@
 /* Includes ------------------------------------------------------------------*/
 #include "stm32f0xx_hal_def.h"
 
+#if !defined(USE_UART_DMA)
+#define USE_UART_DMA 1U
+#endif /* USE_UART_DMA */
+
 /** @addtogroup STM32F0xx_HAL_Driver
   * @{
   */
@@ -237,9 +241,11 @@ typedef struct
 
   uint16_t                 Mask;             /*!< UART Rx RDR register mask          */
 
+#if (USE_UART_DMA != 0U)
   DMA_HandleTypeDef        *hdmatx;          /*!< UART Tx DMA Handle parameters      */
 
   DMA_HandleTypeDef        *hdmarx;          /*!< UART Rx DMA Handle parameters      */
+#endif /* USE_UART_DMA */
 
   HAL_LockTypeDef           Lock;            /*!< Locking object                     */
 
@@ -1299,11 +1305,13 @@ HAL_StatusTypeDef HAL_UART_Transmit(UART_HandleTypeDef *huart, uint8_t *pData, u
 HAL_StatusTypeDef HAL_UART_Receive(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size, uint32_t Timeout);
 HAL_StatusTypeDef HAL_UART_Transmit_IT(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size);
 HAL_StatusTypeDef HAL_UART_Receive_IT(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size);
+#if (USE_UART_DMA != 0U)
 HAL_StatusTypeDef HAL_UART_Transmit_DMA(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size);
 HAL_StatusTypeDef HAL_UART_Receive_DMA(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size);
 HAL_StatusTypeDef HAL_UART_DMAPause(UART_HandleTypeDef *huart);
 HAL_StatusTypeDef HAL_UART_DMAResume(UART_HandleTypeDef *huart);
 HAL_StatusTypeDef HAL_UART_DMAStop(UART_HandleTypeDef *huart);
+#endif /* USE_UART_DMA */
 /* Transfer Abort functions */
 HAL_StatusTypeDef HAL_UART_Abort(UART_HandleTypeDef *huart);
 HAL_StatusTypeDef HAL_UART_AbortTransmit(UART_HandleTypeDef *huart);
@@ -1364,6 +1372,7 @@ uint32_t              HAL_UART_GetError(UART_HandleTypeDef *huart);
 void UART_AdvFeatureConfig(UART_HandleTypeDef *huart);
 HAL_StatusTypeDef UART_CheckIdleState(UART_HandleTypeDef *huart);
 HAL_StatusTypeDef UART_SetConfig(UART_HandleTypeDef *huart);
+HAL_StatusTypeDef UART_ComputeBRR(const UART_HandleTypeDef *huart, uint32_t BaudRate, uint32_t *pBRR);
 HAL_StatusTypeDef UART_Transmit_IT(UART_HandleTypeDef *huart);
 HAL_StatusTypeDef UART_EndTransmit_IT(UART_HandleTypeDef *huart);
 HAL_StatusTypeDef UART_Receive_IT(UART_HandleTypeDef *huart);
@@ -297,6 +297,27 @@ typedef struct
     }  while(0)
 #endif /* !defined(STM32F030x6) && !defined(STM32F030x8) */
 
+/** @brief  BRR value of a UART in 16-bit oversampling mode.
+  * @note   With constant arguments the value is computed by the compiler, to be written
+  *         with HAL_UARTEx_SetBRR().
+  * @param  __CLOCK__ UART kernel clock frequency, in Hz.
+  * @param  __BAUD__ Baud rate.
+  * @retval BRR value
+  */
+#define __HAL_UART_BRR_SAMPLING16(__CLOCK__, __BAUD__)                                  \
+  ((uint32_t)(((__CLOCK__) + ((__BAUD__) / 2U)) / (__BAUD__)))
+
+/** @brief  BRR value of a UART in 8-bit oversampling mode, BRR[3] being cleared.
+  * @note   With constant arguments the value is computed by the compiler, to be written
+  *         with HAL_UARTEx_SetBRR().
+  * @param  __CLOCK__ UART kernel clock frequency, in Hz.
+  * @param  __BAUD__ Baud rate.
+  * @retval BRR value
+  */
+#define __HAL_UART_BRR_SAMPLING8(__CLOCK__, __BAUD__)                                   \
+  (((((__CLOCK__) * 2U) + ((__BAUD__) / 2U)) / (__BAUD__) & 0xFFF0U) |                 \
+   (((((__CLOCK__) * 2U) + ((__BAUD__) / 2U)) / (__BAUD__) & 0x000FU) >> 1U))
+
 /**
   * @}
   */
@@ -782,6 +803,13 @@ typedef struct
                                             ((__WAKE__) == UART_WAKEUP_ON_READDATA_NONEMPTY))
 #endif /* !defined(STM32F030x6) && !defined(STM32F030x8) && !defined(STM32F070x6) && !defined(STM32F070xB) && !defined(STM32F030xC) */
 
+/**
+  * @brief Ensure that the BRR value is allowed for the UART instance.
+  * @param __BRR__ BRR register value.
+  * @retval SET (__BRR__ is valid) or RESET (__BRR__ is invalid)
+  */
+#define IS_UART_BRR(__BRR__) (((__BRR__) >= 0x10U) && ((__BRR__) <= 0xFFFFU))
+
 /**
   * @}
   */
@@ -824,6 +852,8 @@ void HAL_UARTEx_WakeupCallback(UART_HandleTypeDef *huart);
 
 /* Peripheral Control functions  **********************************************/
 HAL_StatusTypeDef HAL_MultiProcessorEx_AddressLength_Set(UART_HandleTypeDef *huart, uint32_t AddressLength);
+HAL_StatusTypeDef HAL_UARTEx_SetBaudRate(UART_HandleTypeDef *huart, uint32_t BaudRate);
+HAL_StatusTypeDef HAL_UARTEx_SetBRR(UART_HandleTypeDef *huart, uint32_t BRR);
 #if !defined(STM32F030x6) && !defined(STM32F030x8)&& !defined(STM32F070xB)&& !defined(STM32F070x6) && !defined(STM32F030xC)
 HAL_StatusTypeDef HAL_UARTEx_StopModeWakeUpSourceConfig(UART_HandleTypeDef *huart, UART_WakeUpTypeDef WakeUpSelection);
 HAL_StatusTypeDef HAL_UARTEx_EnableStopMode(UART_HandleTypeDef *huart);
@@ -259,6 +259,7 @@ __weak HAL_StatusTypeDef HAL_InitTick(uint32_t TickPriority)
     [..]  This section provides functions allowing to:
       (+) Provide a tick value in millisecond
       (+) Provide a blocking delay in millisecond
+      (+) Provide a hook called by the blocking HAL functions while waiting
       (+) Suspend the time base source interrupt
       (+) Resume the time base source interrupt
       (+) Get the HAL API driver version
@@ -297,6 +298,29 @@ __weak uint32_t HAL_GetTick(void)
   return uwTick;
 }
 
+/**
+  * @brief Wait hook, called in the polling loops of the blocking HAL functions
+  *        (HAL_Delay, UART, I2C and SPI flag waits, FLASH operations).
+  * @note The default implementation does nothing, the wait is an active polling.
+  *       An application can override it to yield to an RTOS or a scheduler, or
+  *       to execute __WFE() when an interrupt is expected to end the wait.
+  * @note The hook must return quickly compared to the timeout of the caller and
+  *       must not call the HAL function it is called from for the same handle.
+  *       For HAL_WAIT_FLASH, it must not access the FLASH bank being programmed
+  *       or erased.
+  * @note This function is declared as __weak to be overwritten in case of other
+  *       implementations in user file.
+  * @param Reason: wait reason, a value of @ref HAL_WaitReasonTypeDef.
+  * @param Handle: handle of the peripheral waited for, NULL if none.
+  * @retval None
+  */
+__weak void HAL_WaitHook(HAL_WaitReasonTypeDef Reason, const void *Handle)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(Reason);
+  UNUSED(Handle);
+}
+
 /**
   * @brief This function provides accurate delay (in milliseconds) based
   *        on variable incremented.
@@ -321,6 +345,8 @@ __weak void HAL_Delay(__IO uint32_t Delay)
 
   while((HAL_GetTick() - tickstart) < wait)
   {
+    /* Let the application yield or sleep while waiting */
+    HAL_WaitHook(HAL_WAIT_DELAY, NULL);
   }
 }
 
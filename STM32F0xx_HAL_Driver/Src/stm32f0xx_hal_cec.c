@@ -42,6 +42,29 @@
     (@) This API (HAL_CEC_Init()) configures also the low level Hardware GPIO, CLOCK, CORTEX...etc)
         by calling the customed HAL_CEC_MspInit() API.
 
+    *** Transmit queue and receive ring ***
+    =======================================
+    [..]
+    (#) Attach a CEC_QueueTypeDef structure to the handle with HAL_CEC_Queue_Start().
+    (#) Queue frames with HAL_CEC_Queue_Transmit(): they are sent one after the other
+        from the CEC interrupt. A lost arbitration is retried by the hardware, a frame
+        not acknowledged is retransmitted up to CEC_TX_MAX_RETRIES times, the hardware
+        applying the signal free time of a retransmission when SignalFreeTime is 0.
+        HAL_CEC_TxCpltCallback() is executed for each frame acknowledged and
+        HAL_CEC_ErrorCallback() for each frame dropped.
+    (#) The frames received are stored in the ring. HAL_CEC_RxCpltCallback() is
+        executed for each of them, and HAL_CEC_Queue_Receive() reads them back.
+    (#) Detach the queue with HAL_CEC_Queue_Stop().
+
+    *** Wakeup from STOP mode ***
+    =============================
+    [..]
+    (#) Select the LSE as CEC clock, so that the CEC keeps receiving in STOP mode.
+    (#) Call HAL_CEC_EnableWakeUpStop() before entering STOP mode: the first byte
+        received wakes the device up through the EXTI line 27, the rest of the frame
+        being received normally. In CEC_REDUCED_LISTENING_MODE, only the messages
+        addressed to the device or broadcast wake it up.
+
   @endverbatim
   ******************************************************************************
   * @attention
@@ -107,6 +130,10 @@
 /** @defgroup CEC_Private_Functions CEC Private Functions
   * @{
   */
+static void CEC_Queue_StartTx(CEC_HandleTypeDef *hcec);
+static void CEC_Queue_TxEnd(CEC_HandleTypeDef *hcec);
+static uint32_t CEC_Queue_TxError(CEC_HandleTypeDef *hcec);
+static void CEC_Queue_RxEnd(CEC_HandleTypeDef *hcec);
 /**
   * @}
   */
@@ -171,6 +198,7 @@ HAL_StatusTypeDef HAL_CEC_Init(CEC_HandleTypeDef *hcec)
   {
     /* Allocate lock resource and initialize it */
     hcec->Lock = HAL_UNLOCKED;
+    hcec->pQueue = NULL;
     /* Init the low level hardware : GPIO, CLOCK */
     HAL_CEC_MspInit(hcec);
   }
@@ -369,6 +397,12 @@ HAL_StatusTypeDef HAL_CEC_SetDeviceAddress(CEC_HandleTypeDef *hcec, uint16_t CEC
          (+) HAL_CEC_Transmit_IT()
          (+) HAL_CEC_IRQHandler()
 
+    (#) API's of the transmit queue and the receive ring are :
+         (+) HAL_CEC_Queue_Start()
+         (+) HAL_CEC_Queue_Stop()
+         (+) HAL_CEC_Queue_Transmit()
+         (+) HAL_CEC_Queue_Receive()
+
     (#) A set of User Callbacks are provided:
          (+) HAL_CEC_TxCpltCallback()
          (+) HAL_CEC_RxCpltCallback()
@@ -460,6 +494,179 @@ void HAL_CEC_ChangeRxBuffer(CEC_HandleTypeDef *hcec, uint8_t* Rxbuffer)
   hcec->Init.RxBuffer = Rxbuffer;
 }
 
+/**
+  * @brief Attach a transmit queue and a receive ring to the CEC handle.
+  * @param hcec CEC handle
+  * @param pQueue pointer to the queue, owned by the application until
+  *        HAL_CEC_Queue_Stop() returns
+  * @note  The frames are received in the ring instead of Init.RxBuffer.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_CEC_Queue_Start(CEC_HandleTypeDef *hcec, CEC_QueueTypeDef *pQueue)
+{
+  uint32_t primask_bit;
+
+  if(pQueue == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  pQueue->TxHead = 0U;
+  pQueue->TxTail = 0U;
+  pQueue->TxActive = 0U;
+  pQueue->TxRetries = 0U;
+  pQueue->RxHead = 0U;
+  pQueue->RxTail = 0U;
+  pQueue->TxDoneCount = 0U;
+  pQueue->TxFailCount = 0U;
+  pQueue->ArbitrationLostCount = 0U;
+  pQueue->RxDropCount = 0U;
+
+  /* A reception may start at any time: switch the buffers atomically */
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  if((hcec->pQueue != NULL) || (hcec->gState != HAL_CEC_STATE_READY) || (hcec->RxState != HAL_CEC_STATE_READY))
+  {
+    __set_PRIMASK(primask_bit);
+    return HAL_BUSY;
+  }
+
+  pQueue->pRxBuffer = hcec->Init.RxBuffer;
+  hcec->Init.RxBuffer = pQueue->RxFrames[0].Data;
+  hcec->pQueue = pQueue;
+
+  __set_PRIMASK(primask_bit);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief Detach the transmit queue and the receive ring from the CEC handle.
+  * @param hcec CEC handle
+  * @note  The frames still queued are discarded. HAL_BUSY is returned while a
+  *        frame is being sent or received.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_CEC_Queue_Stop(CEC_HandleTypeDef *hcec)
+{
+  CEC_QueueTypeDef *pqueue = hcec->pQueue;
+  uint32_t primask_bit;
+
+  if(pqueue == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  if((pqueue->TxActive != 0U) || (hcec->RxState != HAL_CEC_STATE_READY))
+  {
+    __set_PRIMASK(primask_bit);
+    return HAL_BUSY;
+  }
+
+  hcec->Init.RxBuffer = pqueue->pRxBuffer;
+  hcec->pQueue = NULL;
+
+  __set_PRIMASK(primask_bit);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief Queue a frame for transmission.
+  * @param hcec CEC handle
+  * @param InitiatorAddress Initiator address
+  * @param DestinationAddress destination logical address
+  * @param pData pointer to the opcode and the operands, copied into the queue
+  * @param Size amount of data in bytes (without counting the header),
+  *             0 for a ping operation, 15 at most.
+  * @retval HAL status, HAL_BUSY when the queue is full
+  */
+HAL_StatusTypeDef HAL_CEC_Queue_Transmit(CEC_HandleTypeDef *hcec, uint8_t InitiatorAddress, uint8_t DestinationAddress, const uint8_t *pData, uint32_t Size)
+{
+  CEC_QueueTypeDef *pqueue = hcec->pQueue;
+  CEC_FrameTypeDef *pframe;
+  uint32_t primask_bit;
+  uint32_t head;
+  uint32_t index;
+
+  if((pqueue == NULL) || ((pData == NULL) && (Size > 0U)) || (Size >= CEC_FRAME_MAX_SIZE))
+  {
+    return HAL_ERROR;
+  }
+
+  assert_param(IS_CEC_ADDRESS(DestinationAddress));
+  assert_param(IS_CEC_ADDRESS(InitiatorAddress));
+
+  /* Only the application moves TxHead: the frame is written outside of the critical section */
+  head = pqueue->TxHead;
+  if((head - pqueue->TxTail) >= CEC_TXQUEUE_SIZE)
+  {
+    return HAL_BUSY;
+  }
+
+  pframe = &pqueue->TxFrames[head & (CEC_TXQUEUE_SIZE - 1U)];
+  pframe->Data[0] = (uint8_t)((uint8_t)(InitiatorAddress << CEC_INITIATOR_LSB_POS) | (uint8_t)DestinationAddress);
+  for(index = 0U; index < Size; index++)
+  {
+    pframe->Data[index + 1U] = pData[index];
+  }
+  pframe->Size = (uint8_t)(Size + 1U);
+
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  pqueue->TxHead = head + 1U;
+
+  /* Start the frame when the transmitter is idle, else the CEC interrupt will */
+  if((pqueue->TxActive == 0U) && (hcec->gState == HAL_CEC_STATE_READY))
+  {
+    CEC_Queue_StartTx(hcec);
+  }
+
+  __set_PRIMASK(primask_bit);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief Read the oldest frame of the receive ring.
+  * @param hcec CEC handle
+  * @param pFrame pointer to the frame filled with the header and the data received
+  * @retval HAL status, HAL_ERROR when no frame is available
+  */
+HAL_StatusTypeDef HAL_CEC_Queue_Receive(CEC_HandleTypeDef *hcec, CEC_FrameTypeDef *pFrame)
+{
+  CEC_QueueTypeDef *pqueue = hcec->pQueue;
+  const CEC_FrameTypeDef *psrc;
+  uint32_t tail;
+  uint32_t index;
+
+  if((pqueue == NULL) || (pFrame == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  tail = pqueue->RxTail;
+  if(tail == pqueue->RxHead)
+  {
+    return HAL_ERROR;
+  }
+
+  psrc = &pqueue->RxFrames[tail & (CEC_RXRING_SIZE - 1U)];
+  pFrame->Size = psrc->Size;
+  for(index = 0U; index < psrc->Size; index++)
+  {
+    pFrame->Data[index] = psrc->Data[index];
+  }
+  pqueue->RxTail = tail + 1U;
+
+  return HAL_OK;
+}
+
 /**
   * @brief This function handles CEC interrupt requests.
   * @param hcec CEC handle
@@ -469,6 +676,7 @@ void HAL_CEC_IRQHandler(CEC_HandleTypeDef *hcec)
 {
 
   /* save interrupts register for further error or interrupts handling purposes */
+  uint32_t retry = 0U;
   uint32_t reg = 0U;
   reg = hcec->Instance->ISR;
 
@@ -479,6 +687,12 @@ void HAL_CEC_IRQHandler(CEC_HandleTypeDef *hcec)
   {
     hcec->ErrorCode = HAL_CEC_ERROR_ARBLST;
     __HAL_CEC_CLEAR_FLAG(hcec, CEC_FLAG_ARBLST);
+
+    /* TXSOM stays set: the hardware retries the frame once the bus is free */
+    if(hcec->pQueue != NULL)
+    {
+      hcec->pQueue->ArbitrationLostCount++;
+    }
   }
 
   /* ----------------------------Rx Management----------------------------------*/
@@ -503,6 +717,10 @@ void HAL_CEC_IRQHandler(CEC_HandleTypeDef *hcec)
     hcec->RxState = HAL_CEC_STATE_READY;
     hcec->ErrorCode = HAL_CEC_ERROR_NONE;
     hcec->Init.RxBuffer -= hcec->RxXferSize;
+    if(hcec->pQueue != NULL)
+    {
+      CEC_Queue_RxEnd(hcec);
+    }
     HAL_CEC_RxCpltCallback(hcec, hcec->RxXferSize);
     hcec->RxXferSize = 0U;
   }
@@ -511,17 +729,14 @@ void HAL_CEC_IRQHandler(CEC_HandleTypeDef *hcec)
   /* CEC TX byte request interrupt ------------------------------------------------*/
   if((reg & CEC_FLAG_TXBR) != RESET)
   {
+    --hcec->TxXferCount;
     if (hcec->TxXferCount == 0U)
     {
       /* if this is the last byte transmission, set TX End of Message (TXEOM) bit */
       __HAL_CEC_LAST_BYTE_TX_SET(hcec);
-      hcec->Instance->TXDR = *hcec->pTxBuffPtr++;
-    }
-    else
-    {
-      hcec->Instance->TXDR = *hcec->pTxBuffPtr++;
-      hcec->TxXferCount--;
     }
+    /* In all cases transmit the byte */
+    hcec->Instance->TXDR = *hcec->pTxBuffPtr++;
     /* clear Tx-Byte request flag */
     __HAL_CEC_CLEAR_FLAG(hcec,CEC_FLAG_TXBR);
   }
@@ -537,6 +752,10 @@ void HAL_CEC_IRQHandler(CEC_HandleTypeDef *hcec)
     start again the Transmission under the Tx call back API */
     __HAL_UNLOCK(hcec);
     hcec->ErrorCode = HAL_CEC_ERROR_NONE;
+    if(hcec->pQueue != NULL)
+    {
+      CEC_Queue_TxEnd(hcec);
+    }
     HAL_CEC_TxCpltCallback(hcec);
   }
 
@@ -557,10 +776,19 @@ void HAL_CEC_IRQHandler(CEC_HandleTypeDef *hcec)
     {
       /* Set the CEC state ready to be able to start again the process */
       hcec->gState = HAL_CEC_STATE_READY;
+
+      /* Retransmit or drop the frame of the queue */
+      if(hcec->pQueue != NULL)
+      {
+        retry = CEC_Queue_TxError(hcec);
+      }
     }
 
-    /* Error  Call Back */
-    HAL_CEC_ErrorCallback(hcec);
+    /* Error  Call Back, not for a retransmission in progress */
+    if(retry == 0U)
+    {
+      HAL_CEC_ErrorCallback(hcec);
+    }
   }
 
 }
@@ -652,10 +880,166 @@ uint32_t HAL_CEC_GetError(CEC_HandleTypeDef *hcec)
   return hcec->ErrorCode;
 }
 
+/**
+  * @brief  Enable the wakeup from STOP mode on a CEC reception.
+  * @param  hcec pointer to a CEC_HandleTypeDef structure that contains
+  *              the configuration information for the specified CEC.
+  * @note   The CEC must be clocked by the LSE, which keeps running in STOP mode.
+  *         The reception of the first byte of a frame wakes the device up
+  *         through the EXTI line 27 and the frame is received normally.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_CEC_EnableWakeUpStop(CEC_HandleTypeDef *hcec)
+{
+  if((hcec->gState == HAL_CEC_STATE_RESET) || (__HAL_RCC_GET_CEC_SOURCE() != RCC_CECCLKSOURCE_LSE))
+  {
+    return HAL_ERROR;
+  }
+
+  __HAL_CEC_WAKEUP_EXTI_ENABLE_IT();
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Disable the wakeup from STOP mode on a CEC reception.
+  * @param  hcec pointer to a CEC_HandleTypeDef structure that contains
+  *              the configuration information for the specified CEC.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_CEC_DisableWakeUpStop(CEC_HandleTypeDef *hcec)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hcec);
+
+  __HAL_CEC_WAKEUP_EXTI_DISABLE_IT();
+
+  return HAL_OK;
+}
+
+/**
+  * @}
+  */
+
 /**
   * @}
   */
 
+/** @addtogroup CEC_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief Send the frame at the tail of the transmit queue.
+  * @param hcec CEC handle
+  * @retval None
+  */
+static void CEC_Queue_StartTx(CEC_HandleTypeDef *hcec)
+{
+  CEC_QueueTypeDef *pqueue = hcec->pQueue;
+  CEC_FrameTypeDef *pframe = &pqueue->TxFrames[pqueue->TxTail & (CEC_TXQUEUE_SIZE - 1U)];
+
+  pqueue->TxActive = 1U;
+  hcec->pTxBuffPtr = &pframe->Data[1];
+  hcec->TxXferCount = (uint16_t)pframe->Size - 1U;
+  hcec->gState = HAL_CEC_STATE_BUSY_TX;
+
+  /* Ping operation: the header is the last byte */
+  if(hcec->TxXferCount == 0U)
+  {
+    __HAL_CEC_LAST_BYTE_TX_SET(hcec);
+  }
+
+  /* send header block and set TX Start of Message (TXSOM) bit */
+  hcec->Instance->TXDR = pframe->Data[0];
+  __HAL_CEC_FIRST_BYTE_TX_SET(hcec);
+}
+
+/**
+  * @brief Release the frame acknowledged and send the next one of the queue.
+  * @param hcec CEC handle
+  * @retval None
+  */
+static void CEC_Queue_TxEnd(CEC_HandleTypeDef *hcec)
+{
+  CEC_QueueTypeDef *pqueue = hcec->pQueue;
+
+  if(pqueue->TxActive != 0U)
+  {
+    pqueue->TxActive = 0U;
+    pqueue->TxRetries = 0U;
+    pqueue->TxDoneCount++;
+    pqueue->TxTail++;
+  }
+
+  /* Frames queued while HAL_CEC_Transmit_IT() was in progress start here too */
+  if(pqueue->TxTail != pqueue->TxHead)
+  {
+    CEC_Queue_StartTx(hcec);
+  }
+}
+
+/**
+  * @brief Retransmit the frame of the queue after a transmission error, or drop it.
+  * @param hcec CEC handle
+  * @note  TXSOM being cleared by the error, setting it again retransmits the frame
+  *        after the signal free time of a retransmission.
+  * @retval 1 when the frame is retransmitted, 0 when it is dropped
+  */
+static uint32_t CEC_Queue_TxError(CEC_HandleTypeDef *hcec)
+{
+  CEC_QueueTypeDef *pqueue = hcec->pQueue;
+
+  if(pqueue->TxActive != 0U)
+  {
+    if(pqueue->TxRetries < CEC_TX_MAX_RETRIES)
+    {
+      pqueue->TxRetries++;
+      CEC_Queue_StartTx(hcec);
+      return 1U;
+    }
+
+    pqueue->TxActive = 0U;
+    pqueue->TxRetries = 0U;
+    pqueue->TxFailCount++;
+    pqueue->TxTail++;
+  }
+
+  if(pqueue->TxTail != pqueue->TxHead)
+  {
+    CEC_Queue_StartTx(hcec);
+  }
+
+  return 0U;
+}
+
+/**
+  * @brief Store the frame received in the ring and prepare the next reception.
+  * @param hcec CEC handle
+  * @note  The entry at RxHead always receives: when the ring is full, the
+  *        frame just received is overwritten by the next one.
+  * @retval None
+  */
+static void CEC_Queue_RxEnd(CEC_HandleTypeDef *hcec)
+{
+  CEC_QueueTypeDef *pqueue = hcec->pQueue;
+  uint32_t head = pqueue->RxHead;
+
+  pqueue->RxFrames[head & (CEC_RXRING_SIZE - 1U)].Size = (uint8_t)hcec->RxXferSize;
+
+  if(((head + 1U) - pqueue->RxTail) < CEC_RXRING_SIZE)
+  {
+    head++;
+    pqueue->RxHead = head;
+  }
+  else
+  {
+    pqueue->RxDropCount++;
+  }
+
+  hcec->Init.RxBuffer = pqueue->RxFrames[head & (CEC_RXRING_SIZE - 1U)].Data;
+}
+
 /**
   * @}
   */
@@ -639,6 +639,9 @@ HAL_StatusTypeDef FLASH_WaitForLastOperation(uint32_t Timeout)
 
   while(__HAL_FLASH_GET_FLAG(FLASH_FLAG_BSY))
   {
+    /* Let the application yield or sleep while waiting */
+    HAL_WaitHook(HAL_WAIT_FLASH, NULL);
+
     if (Timeout != HAL_MAX_DELAY)
     {
       if((Timeout == 0U) || ((HAL_GetTick()-tickstart) > Timeout))
@@ -191,6 +191,14 @@
            add his own code by customization of function pointer HAL_I2C_ErrorCallback()
 
 
+     *** DMA mode removal ***
+     ========================
+     [..]
+      (+) When USE_I2C_DMA is set to 0 in the HAL configuration file, the DMA handles are removed
+          from the I2C handle and the DMA transfer services are not compiled, saving RAM in each
+          I2C handle and flash. Polling and interrupt modes are not affected.
+          When USE_I2C_DMA is not defined, the DMA mode is available.
+
      *** I2C HAL driver macros list ***
      ==================================
      [..]
@@ -300,9 +308,11 @@
   */
 
 /* Private macro -------------------------------------------------------------*/
+#if (USE_I2C_DMA != 0U)
 #define I2C_GET_DMA_REMAIN_DATA(__HANDLE__) ((((__HANDLE__)->State) == HAL_I2C_STATE_BUSY_TX)   ? \
                                             ((uint32_t)((__HANDLE__)->hdmatx->Instance->CNDTR)) : \
                                             ((uint32_t)((__HANDLE__)->hdmarx->Instance->CNDTR)))
+#endif /* USE_I2C_DMA */
 
 /* Private variables ---------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
@@ -311,12 +321,14 @@
   * @{
   */
 /* Private functions to handle DMA transfer */
+#if (USE_I2C_DMA != 0U)
 static void I2C_DMAMasterTransmitCplt(DMA_HandleTypeDef *hdma);
 static void I2C_DMAMasterReceiveCplt(DMA_HandleTypeDef *hdma);
 static void I2C_DMASlaveTransmitCplt(DMA_HandleTypeDef *hdma);
 static void I2C_DMASlaveReceiveCplt(DMA_HandleTypeDef *hdma);
 static void I2C_DMAError(DMA_HandleTypeDef *hdma);
 static void I2C_DMAAbort(DMA_HandleTypeDef *hdma);
+#endif /* USE_I2C_DMA */
 
 /* Private functions to handle IT transfer */
 static void I2C_ITAddrCplt(I2C_HandleTypeDef *hi2c, uint32_t ITFlags);
@@ -334,8 +346,10 @@ static HAL_StatusTypeDef I2C_RequestMemoryRead(I2C_HandleTypeDef *hi2c, uint16_t
 /* Private functions for I2C transfer IRQ handler */
 static HAL_StatusTypeDef I2C_Master_ISR_IT(struct __I2C_HandleTypeDef *hi2c, uint32_t ITFlags, uint32_t ITSources);
 static HAL_StatusTypeDef I2C_Slave_ISR_IT(struct __I2C_HandleTypeDef *hi2c, uint32_t ITFlags, uint32_t ITSources);
+#if (USE_I2C_DMA != 0U)
 static HAL_StatusTypeDef I2C_Master_ISR_DMA(struct __I2C_HandleTypeDef *hi2c, uint32_t ITFlags, uint32_t ITSources);
 static HAL_StatusTypeDef I2C_Slave_ISR_DMA(struct __I2C_HandleTypeDef *hi2c, uint32_t ITFlags, uint32_t ITSources);
+#endif /* USE_I2C_DMA */
 
 /* Private functions to handle flags during polling transfer */
 static HAL_StatusTypeDef I2C_WaitOnFlagUntilTimeout(I2C_HandleTypeDef *hi2c, uint32_t Flag, FlagStatus Status, uint32_t Timeout, uint32_t Tickstart);
@@ -1369,6 +1383,7 @@ HAL_StatusTypeDef HAL_I2C_Slave_Receive_IT(I2C_HandleTypeDef *hi2c, uint8_t *pDa
   }
 }
 
+#if (USE_I2C_DMA != 0U)
 /**
   * @brief  Transmit in master mode an amount of data in non-blocking mode with DMA
   * @param  hi2c Pointer to a I2C_HandleTypeDef structure that contains
@@ -1715,6 +1730,8 @@ HAL_StatusTypeDef HAL_I2C_Slave_Receive_DMA(I2C_HandleTypeDef *hi2c, uint8_t *pD
     return HAL_BUSY;
   }
 }
+#endif /* USE_I2C_DMA */
+
 /**
   * @brief  Write an amount of data in blocking mode to a specific memory address
   * @param  hi2c Pointer to a I2C_HandleTypeDef structure that contains
@@ -2210,6 +2227,8 @@ HAL_StatusTypeDef HAL_I2C_Mem_Read_IT(I2C_HandleTypeDef *hi2c, uint16_t DevAddre
     return HAL_BUSY;
   }
 }
+
+#if (USE_I2C_DMA != 0U)
 /**
   * @brief  Write an amount of data in non-blocking mode with DMA to a specific memory address
   * @param  hi2c Pointer to a I2C_HandleTypeDef structure that contains
@@ -2440,6 +2459,7 @@ HAL_StatusTypeDef HAL_I2C_Mem_Read_DMA(I2C_HandleTypeDef *hi2c, uint16_t DevAddr
     return HAL_BUSY;
   }
 }
+#endif /* USE_I2C_DMA */
 
 /**
   * @brief  Checks if target device is ready for communication.
@@ -3487,6 +3507,7 @@ static HAL_StatusTypeDef I2C_Slave_ISR_IT(struct __I2C_HandleTypeDef *hi2c, uint
   return HAL_OK;
 }
 
+#if (USE_I2C_DMA != 0U)
 /**
   * @brief  Interrupt Sub-Routine which handle the Interrupt Flags Master Mode with DMA.
   * @param  hi2c Pointer to a I2C_HandleTypeDef structure that contains
@@ -3626,6 +3647,7 @@ static HAL_StatusTypeDef I2C_Slave_ISR_DMA(struct __I2C_HandleTypeDef *hi2c, uin
 
   return HAL_OK;
 }
+#endif /* USE_I2C_DMA */
 
 /**
   * @brief  Master sends target device address followed by internal memory address for write request.
@@ -4051,12 +4073,14 @@ static void I2C_ITSlaveCplt(I2C_HandleTypeDef *hi2c, uint32_t ITFlags)
   /* Flush TX register */
   I2C_Flush_TXDR(hi2c);
 
+#if (USE_I2C_DMA != 0U)
   /* If a DMA is ongoing, Update handle size context */
   if (((hi2c->Instance->CR1 & I2C_CR1_TXDMAEN) == I2C_CR1_TXDMAEN) ||
       ((hi2c->Instance->CR1 & I2C_CR1_RXDMAEN) == I2C_CR1_RXDMAEN))
   {
     hi2c->XferCount = I2C_GET_DMA_REMAIN_DATA(hi2c);
   }
+#endif /* USE_I2C_DMA */
 
   /* All data are not transferred, so set error code accordingly */
   if (hi2c->XferCount != 0U)
@@ -4220,6 +4244,7 @@ static void I2C_ITError(I2C_HandleTypeDef *hi2c, uint32_t ErrorCode)
     hi2c->XferISR       = NULL;
   }
 
+#if (USE_I2C_DMA != 0U)
   /* Abort DMA TX transfer if any */
   if ((hi2c->Instance->CR1 & I2C_CR1_TXDMAEN) == I2C_CR1_TXDMAEN)
   {
@@ -4258,7 +4283,9 @@ static void I2C_ITError(I2C_HandleTypeDef *hi2c, uint32_t ErrorCode)
       hi2c->hdmarx->XferAbortCallback(hi2c->hdmarx);
     }
   }
-  else if (hi2c->State == HAL_I2C_STATE_ABORT)
+  else
+#endif /* USE_I2C_DMA */
+  if (hi2c->State == HAL_I2C_STATE_ABORT)
   {
     hi2c->State = HAL_I2C_STATE_READY;
 
@@ -4299,6 +4326,7 @@ static void I2C_Flush_TXDR(I2C_HandleTypeDef *hi2c)
   }
 }
 
+#if (USE_I2C_DMA != 0U)
 /**
   * @brief  DMA I2C master transmit process complete callback.
   * @param  hdma DMA handle
@@ -4460,6 +4488,7 @@ static void I2C_DMAAbort(DMA_HandleTypeDef *hdma)
     HAL_I2C_ErrorCallback(hi2c);
   }
 }
+#endif /* USE_I2C_DMA */
 
 /**
   * @brief  This function handles I2C Communication Timeout.
@@ -4475,6 +4504,9 @@ static HAL_StatusTypeDef I2C_WaitOnFlagUntilTimeout(I2C_HandleTypeDef *hi2c, uin
 {
   while (__HAL_I2C_GET_FLAG(hi2c, Flag) == Status)
   {
+    /* Let the application yield or sleep while waiting */
+    HAL_WaitHook(HAL_WAIT_I2C, hi2c);
+
     /* Check for the Timeout */
     if (Timeout != HAL_MAX_DELAY)
     {
@@ -4504,6 +4536,9 @@ static HAL_StatusTypeDef I2C_WaitOnTXISFlagUntilTimeout(I2C_HandleTypeDef *hi2c,
 {
   while (__HAL_I2C_GET_FLAG(hi2c, I2C_FLAG_TXIS) == RESET)
   {
+    /* Let the application yield or sleep while waiting */
+    HAL_WaitHook(HAL_WAIT_I2C, hi2c);
+
     /* Check if a NACK is detected */
     if (I2C_IsAcknowledgeFailed(hi2c, Timeout, Tickstart) != HAL_OK)
     {
@@ -4541,6 +4576,9 @@ static HAL_StatusTypeDef I2C_WaitOnSTOPFlagUntilTimeout(I2C_HandleTypeDef *hi2c,
 {
   while (__HAL_I2C_GET_FLAG(hi2c, I2C_FLAG_STOPF) == RESET)
   {
+    /* Let the application yield or sleep while waiting */
+    HAL_WaitHook(HAL_WAIT_I2C, hi2c);
+
     /* Check if a NACK is detected */
     if (I2C_IsAcknowledgeFailed(hi2c, Timeout, Tickstart) != HAL_OK)
     {
@@ -4575,6 +4613,9 @@ static HAL_StatusTypeDef I2C_WaitOnRXNEFlagUntilTimeout(I2C_HandleTypeDef *hi2c,
 {
   while (__HAL_I2C_GET_FLAG(hi2c, I2C_FLAG_RXNE) == RESET)
   {
+    /* Let the application yield or sleep while waiting */
+    HAL_WaitHook(HAL_WAIT_I2C, hi2c);
+
     /* Check if a NACK is detected */
     if (I2C_IsAcknowledgeFailed(hi2c, Timeout, Tickstart) != HAL_OK)
     {
@@ -4723,6 +4764,7 @@ static HAL_StatusTypeDef I2C_Enable_IRQ(I2C_HandleTypeDef *hi2c, uint16_t Interr
 {
   uint32_t tmpisr = 0U;
 
+#if (USE_I2C_DMA != 0U)
   if ((hi2c->XferISR == I2C_Master_ISR_DMA) || \
       (hi2c->XferISR == I2C_Slave_ISR_DMA))
   {
@@ -4751,6 +4793,7 @@ static HAL_StatusTypeDef I2C_Enable_IRQ(I2C_HandleTypeDef *hi2c, uint16_t Interr
     }
   }
   else
+#endif /* USE_I2C_DMA */
   {
     if ((InterruptRequest & I2C_XFER_LISTEN_IT) == I2C_XFER_LISTEN_IT)
     {
@@ -73,6 +73,13 @@
       (#) There is no such restriction when going through DMA by using HAL_SPI_Transmit_DMA(), HAL_SPI_Receive_DMA()
           and HAL_SPI_TransmitReceive_DMA().
 
+     [..]
+       DMA mode removal:
+      (#) When USE_SPI_DMA is set to 0 in the HAL configuration file, the DMA handles are removed
+          from the SPI handle and the DMA transfer, pause, resume and stop services are not compiled,
+          saving RAM in each SPI handle and flash. Polling and interrupt modes are not affected.
+          When USE_SPI_DMA is not defined, the DMA mode is available.
+
   @endverbatim
 
   Additional table :
@@ -192,6 +199,7 @@
 /** @defgroup SPI_Private_Functions SPI Private Functions
   * @{
   */
+#if (USE_SPI_DMA != 0U)
 static void SPI_DMATransmitCplt(DMA_HandleTypeDef *hdma);
 static void SPI_DMAReceiveCplt(DMA_HandleTypeDef *hdma);
 static void SPI_DMATransmitReceiveCplt(DMA_HandleTypeDef *hdma);
@@ -202,6 +210,7 @@ static void SPI_DMAError(DMA_HandleTypeDef *hdma);
 static void SPI_DMAAbortOnError(DMA_HandleTypeDef *hdma);
 static void SPI_DMATxAbortCallback(DMA_HandleTypeDef *hdma);
 static void SPI_DMARxAbortCallback(DMA_HandleTypeDef *hdma);
+#endif /* USE_SPI_DMA */
 static HAL_StatusTypeDef SPI_WaitFlagStateUntilTimeout(SPI_HandleTypeDef *hspi, uint32_t Flag, uint32_t State,
                                                        uint32_t Timeout, uint32_t Tickstart);
 static HAL_StatusTypeDef SPI_WaitFifoStateUntilTimeout(SPI_HandleTypeDef *hspi, uint32_t Fifo, uint32_t State,
@@ -1540,6 +1549,7 @@ error :
   return errorcode;
 }
 
+#if (USE_SPI_DMA != 0U)
 /**
   * @brief  Transmit an amount of data in non-blocking mode with DMA.
   * @param  hspi pointer to a SPI_HandleTypeDef structure that contains
@@ -1973,6 +1983,7 @@ error :
   __HAL_UNLOCK(hspi);
   return errorcode;
 }
+#endif /* USE_SPI_DMA */
 
 /**
   * @brief  Abort ongoing transfer (blocking mode).
@@ -2035,6 +2046,7 @@ HAL_StatusTypeDef HAL_SPI_Abort(SPI_HandleTypeDef *hspi)
   /* Clear ERRIE interrupts in case of DMA Mode */
   CLEAR_BIT(hspi->Instance->CR2, SPI_CR2_ERRIE);
 
+#if (USE_SPI_DMA != 0U)
   /* Disable the SPI DMA Tx or SPI DMA Rx request if enabled */
   if ((HAL_IS_BIT_SET(hspi->Instance->CR2, SPI_CR2_TXDMAEN)) || (HAL_IS_BIT_SET(hspi->Instance->CR2, SPI_CR2_RXDMAEN)))
   {
@@ -2100,6 +2112,7 @@ HAL_StatusTypeDef HAL_SPI_Abort(SPI_HandleTypeDef *hspi)
       CLEAR_BIT(hspi->Instance->CR2, (SPI_CR2_RXDMAEN));
     }
   }
+#endif /* USE_SPI_DMA */
   /* Reset Tx and Rx transfer counters */
   hspi->RxXferCount = 0U;
   hspi->TxXferCount = 0U;
@@ -2191,6 +2204,7 @@ HAL_StatusTypeDef HAL_SPI_Abort_IT(SPI_HandleTypeDef *hspi)
   /* Clear ERRIE interrupts in case of DMA Mode */
   CLEAR_BIT(hspi->Instance->CR2, SPI_CR2_ERRIE);
 
+#if (USE_SPI_DMA != 0U)
   /* If DMA Tx and/or DMA Rx Handles are associated to SPI Handle, DMA Abort complete callbacks should be initialised
      before any call to DMA Abort functions */
   /* DMA Tx Handle is valid */
@@ -2292,6 +2306,7 @@ HAL_StatusTypeDef HAL_SPI_Abort_IT(SPI_HandleTypeDef *hspi)
       }
     }
   }
+#endif /* USE_SPI_DMA */
 
   if (abortcplt == 1U)
   {
@@ -2325,6 +2340,7 @@ HAL_StatusTypeDef HAL_SPI_Abort_IT(SPI_HandleTypeDef *hspi)
   return errorcode;
 }
 
+#if (USE_SPI_DMA != 0U)
 /**
   * @brief  Pause the DMA Transfer.
   * @param  hspi pointer to a SPI_HandleTypeDef structure that contains
@@ -2395,6 +2411,7 @@ HAL_StatusTypeDef HAL_SPI_DMAStop(SPI_HandleTypeDef *hspi)
   hspi->State = HAL_SPI_STATE_READY;
   return HAL_OK;
 }
+#endif /* USE_SPI_DMA */
 
 /**
   * @brief  Handle SPI interrupt request.
@@ -2460,6 +2477,7 @@ void HAL_SPI_IRQHandler(SPI_HandleTypeDef *hspi)
       __HAL_SPI_DISABLE_IT(hspi, SPI_IT_RXNE | SPI_IT_TXE | SPI_IT_ERR);
 
       hspi->State = HAL_SPI_STATE_READY;
+#if (USE_SPI_DMA != 0U)
       /* Disable the SPI DMA requests if enabled */
       if ((HAL_IS_BIT_SET(itsource, SPI_CR2_TXDMAEN)) || (HAL_IS_BIT_SET(itsource, SPI_CR2_RXDMAEN)))
       {
@@ -2483,6 +2501,7 @@ void HAL_SPI_IRQHandler(SPI_HandleTypeDef *hspi)
         }
       }
       else
+#endif /* USE_SPI_DMA */
       {
         /* Call user error callback */
         HAL_SPI_ErrorCallback(hspi);
@@ -2678,6 +2697,7 @@ uint32_t HAL_SPI_GetError(SPI_HandleTypeDef *hspi)
   * @{
   */
 
+#if (USE_SPI_DMA != 0U)
 /**
   * @brief DMA SPI transmit process complete callback.
   * @param  hdma pointer to a DMA_HandleTypeDef structure that contains
@@ -3097,6 +3117,7 @@ static void SPI_DMARxAbortCallback(DMA_HandleTypeDef *hdma)
   /* Call user Abort complete callback */
   HAL_SPI_AbortCpltCallback(hspi);
 }
+#endif /* USE_SPI_DMA */
 
 /**
   * @brief  Rx 8-bit handler for Transmit and Receive in Interrupt mode.
@@ -3501,6 +3522,9 @@ static HAL_StatusTypeDef SPI_WaitFlagStateUntilTimeout(SPI_HandleTypeDef *hspi,
 {
   while ((__HAL_SPI_GET_FLAG(hspi, Flag) ? SET : RESET) != State)
   {
+    /* Let the application yield or sleep while waiting */
+    HAL_WaitHook(HAL_WAIT_SPI, hspi);
+
     if (Timeout != HAL_MAX_DELAY)
     {
       if ((Timeout == 0U) || ((HAL_GetTick() - Tickstart) >= Timeout))
@@ -3555,6 +3579,9 @@ static HAL_StatusTypeDef SPI_WaitFifoStateUntilTimeout(SPI_HandleTypeDef *hspi,
 
   while ((hspi->Instance->SR & Fifo) != State)
   {
+    /* Let the application yield or sleep while waiting */
+    HAL_WaitHook(HAL_WAIT_SPI, hspi);
+
     if ((Fifo == SPI_SR_FRLVL) && (State == SPI_FRLVL_EMPTY))
     {
       tmpreg = *((__IO uint8_t *)&hspi->Instance->DR);
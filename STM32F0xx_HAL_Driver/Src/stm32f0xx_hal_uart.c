@@ -106,6 +106,10 @@
        (+) Pause the DMA Transfer using HAL_UART_DMAPause()
        (+) Resume the DMA Transfer using HAL_UART_DMAResume()
        (+) Stop the DMA Transfer using HAL_UART_DMAStop()
+     [..]
+       (@) When USE_UART_DMA is set to 0 in the HAL configuration file, the DMA handles are removed
+           from the UART handle and the DMA transfer, pause, resume and stop services are not compiled,
+           saving RAM in each UART handle and flash. Polling and interrupt modes are not affected.
 
      *** UART HAL driver macros list ***
      =============================================
@@ -168,24 +172,73 @@
 #ifdef HAL_UART_MODULE_ENABLED
 
 /* Private typedef -----------------------------------------------------------*/
+/** @defgroup UART_Private_Types UART Private Types
+  * @{
+  */
+/**
+  * @brief  Baud rate and reciprocal used by the fast BRR computation
+  */
+typedef struct
+{
+  uint32_t BaudRate;       /*!< Baud rate                          */
+  uint32_t Reciprocal;     /*!< 2^40 / BaudRate, rounded           */
+} UART_BaudRecipTypeDef;
+/**
+  * @}
+  */
+
 /* Private define ------------------------------------------------------------*/
 /** @defgroup UART_Private_Constants UART Private Constants
   * @{
   */
 #define UART_CR1_FIELDS  ((uint32_t)(USART_CR1_M | USART_CR1_PCE | USART_CR1_PS | \
                                      USART_CR1_TE | USART_CR1_RE | USART_CR1_OVER8)) /*!< UART or USART CR1 fields of parameters set by UART_SetConfig API */
-/**
+
+#define UART_BRR_MIN    0x10U        /* UART BRR minimum authorized value */
+#define UART_BRR_MAX    0x0000FFFFU  /* UART BRR maximum authorized value */
+
+#define UART_DIV_SCALE_SAMPLING16    0U     /* BRR units per bit clock, log2, 16-bit oversampling */
+#define UART_DIV_SCALE_SAMPLING8     1U     /* BRR units per bit clock, log2, 8-bit oversampling  */
+
+/* Reciprocal of the baud rate, 2^40/BaudRate, for baud rates above 256 */
+#define UART_BAUD_RECIP(__BAUD__)    ((uint32_t)((((uint64_t)1U << 40U) + ((__BAUD__) / 2U)) / (__BAUD__)))
+
+#define UART_BAUD_RECIP_TABLE_SIZE   18U    /* Number of baud rates of UARTBaudRecipTable *//**
   * @}
   */
 
 /* Private macros ------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
+/* Common baud rates, divided without division instruction */
+static const UART_BaudRecipTypeDef UARTBaudRecipTable[UART_BAUD_RECIP_TABLE_SIZE] =
+{
+  {1200U,    UART_BAUD_RECIP(1200U)},
+  {2400U,    UART_BAUD_RECIP(2400U)},
+  {4800U,    UART_BAUD_RECIP(4800U)},
+  {9600U,    UART_BAUD_RECIP(9600U)},
+  {14400U,   UART_BAUD_RECIP(14400U)},
+  {19200U,   UART_BAUD_RECIP(19200U)},
+  {28800U,   UART_BAUD_RECIP(28800U)},
+  {38400U,   UART_BAUD_RECIP(38400U)},
+  {57600U,   UART_BAUD_RECIP(57600U)},
+  {76800U,   UART_BAUD_RECIP(76800U)},
+  {115200U,  UART_BAUD_RECIP(115200U)},
+  {230400U,  UART_BAUD_RECIP(230400U)},
+  {250000U,  UART_BAUD_RECIP(250000U)},
+  {460800U,  UART_BAUD_RECIP(460800U)},
+  {500000U,  UART_BAUD_RECIP(500000U)},
+  {921600U,  UART_BAUD_RECIP(921600U)},
+  {1000000U, UART_BAUD_RECIP(1000000U)},
+  {2000000U, UART_BAUD_RECIP(2000000U)}
+};
+
 /* Private function prototypes -----------------------------------------------*/
 /** @addtogroup UART_Private_Functions
   * @{
   */
 static void UART_EndTxTransfer(UART_HandleTypeDef *huart);
 static void UART_EndRxTransfer(UART_HandleTypeDef *huart);
+#if (USE_UART_DMA != 0U)
 static void UART_DMATransmitCplt(DMA_HandleTypeDef *hdma);
 static void UART_DMATxHalfCplt(DMA_HandleTypeDef *hdma);
 static void UART_DMAReceiveCplt(DMA_HandleTypeDef *hdma);
@@ -196,9 +249,11 @@ static void UART_DMATxAbortCallback(DMA_HandleTypeDef *hdma);
 static void UART_DMARxAbortCallback(DMA_HandleTypeDef *hdma);
 static void UART_DMATxOnlyAbortCallback(DMA_HandleTypeDef *hdma);
 static void UART_DMARxOnlyAbortCallback(DMA_HandleTypeDef *hdma);
+#endif /* USE_UART_DMA */
 HAL_StatusTypeDef UART_Transmit_IT(UART_HandleTypeDef *huart);
 HAL_StatusTypeDef UART_EndTransmit_IT(UART_HandleTypeDef *huart);
 HAL_StatusTypeDef UART_Receive_IT(UART_HandleTypeDef *huart);
+static uint32_t UART_DivBaudRate(uint32_t Clock, uint32_t BaudRate, uint32_t Scale);
 /**
   * @}
   */
@@ -965,6 +1020,7 @@ HAL_StatusTypeDef HAL_UART_Receive_IT(UART_HandleTypeDef *huart, uint8_t *pData,
   }
 }
 
+#if (USE_UART_DMA != 0U)
 /**
   * @brief Send an amount of data in DMA mode.
   * @param huart UART handle.
@@ -1230,6 +1286,7 @@ HAL_StatusTypeDef HAL_UART_DMAStop(UART_HandleTypeDef *huart)
 
   return HAL_OK;
 }
+#endif /* USE_UART_DMA */
 
 /**
   * @brief  Abort ongoing transfers (blocking mode).
@@ -1249,6 +1306,7 @@ HAL_StatusTypeDef HAL_UART_Abort(UART_HandleTypeDef *huart)
   CLEAR_BIT(huart->Instance->CR1, (USART_CR1_RXNEIE | USART_CR1_PEIE | USART_CR1_TXEIE | USART_CR1_TCIE));
   CLEAR_BIT(huart->Instance->CR3, USART_CR3_EIE);
 
+#if (USE_UART_DMA != 0U)
   /* Disable the UART DMA Tx request if enabled */
   if (HAL_IS_BIT_SET(huart->Instance->CR3, USART_CR3_DMAT))
   {
@@ -1280,6 +1338,7 @@ HAL_StatusTypeDef HAL_UART_Abort(UART_HandleTypeDef *huart)
       HAL_DMA_Abort(huart->hdmarx);
     }
   }
+#endif /* USE_UART_DMA */
 
   /* Reset Tx and Rx transfer counters */
   huart->TxXferCount = 0U;
@@ -1315,6 +1374,7 @@ HAL_StatusTypeDef HAL_UART_AbortTransmit(UART_HandleTypeDef *huart)
   /* Disable TXEIE and TCIE interrupts */
   CLEAR_BIT(huart->Instance->CR1, (USART_CR1_TXEIE | USART_CR1_TCIE));
 
+#if (USE_UART_DMA != 0U)
   /* Disable the UART DMA Tx request if enabled */
   if (HAL_IS_BIT_SET(huart->Instance->CR3, USART_CR3_DMAT))
   {
@@ -1330,6 +1390,7 @@ HAL_StatusTypeDef HAL_UART_AbortTransmit(UART_HandleTypeDef *huart)
       HAL_DMA_Abort(huart->hdmatx);
     }
   }
+#endif /* USE_UART_DMA */
 
   /* Reset Tx transfer counter */
   huart->TxXferCount = 0U;
@@ -1358,6 +1419,7 @@ HAL_StatusTypeDef HAL_UART_AbortReceive(UART_HandleTypeDef *huart)
   CLEAR_BIT(huart->Instance->CR1, (USART_CR1_RXNEIE | USART_CR1_PEIE));
   CLEAR_BIT(huart->Instance->CR3, USART_CR3_EIE);
 
+#if (USE_UART_DMA != 0U)
   /* Disable the UART DMA Rx request if enabled */
   if (HAL_IS_BIT_SET(huart->Instance->CR3, USART_CR3_DMAR))
   {
@@ -1373,6 +1435,7 @@ HAL_StatusTypeDef HAL_UART_AbortReceive(UART_HandleTypeDef *huart)
       HAL_DMA_Abort(huart->hdmarx);
     }
   }
+#endif /* USE_UART_DMA */
 
   /* Reset Rx transfer counter */
   huart->RxXferCount = 0U;
@@ -1408,6 +1471,7 @@ HAL_StatusTypeDef HAL_UART_Abort_IT(UART_HandleTypeDef *huart)
   CLEAR_BIT(huart->Instance->CR1, (USART_CR1_RXNEIE | USART_CR1_PEIE | USART_CR1_TXEIE | USART_CR1_TCIE));
   CLEAR_BIT(huart->Instance->CR3, USART_CR3_EIE);
 
+#if (USE_UART_DMA != 0U)
   /* If DMA Tx and/or DMA Rx Handles are associated to UART Handle, DMA Abort complete callbacks should be initialised
      before any call to DMA Abort functions */
   /* DMA Tx Handle is valid */
@@ -1486,6 +1550,7 @@ HAL_StatusTypeDef HAL_UART_Abort_IT(UART_HandleTypeDef *huart)
       }
     }
   }
+#endif /* USE_UART_DMA */
 
   /* if no DMA abort complete callback execution is required => call user Abort Complete callback */
   if (abortcplt == 1U)
@@ -1530,6 +1595,7 @@ HAL_StatusTypeDef HAL_UART_AbortTransmit_IT(UART_HandleTypeDef *huart)
   /* Disable TXEIE and TCIE interrupts */
   CLEAR_BIT(huart->Instance->CR1, (USART_CR1_TXEIE | USART_CR1_TCIE));
 
+#if (USE_UART_DMA != 0U)
   /* Disable the UART DMA Tx request if enabled */
   if (HAL_IS_BIT_SET(huart->Instance->CR3, USART_CR3_DMAT))
   {
@@ -1562,6 +1628,7 @@ HAL_StatusTypeDef HAL_UART_AbortTransmit_IT(UART_HandleTypeDef *huart)
     }
   }
   else
+#endif /* USE_UART_DMA */
   {
     /* Reset Tx transfer counter */
     huart->TxXferCount = 0U;
@@ -1596,6 +1663,7 @@ HAL_StatusTypeDef HAL_UART_AbortReceive_IT(UART_HandleTypeDef *huart)
   CLEAR_BIT(huart->Instance->CR1, (USART_CR1_RXNEIE | USART_CR1_PEIE));
   CLEAR_BIT(huart->Instance->CR3, USART_CR3_EIE);
 
+#if (USE_UART_DMA != 0U)
   /* Disable the UART DMA Rx request if enabled */
   if (HAL_IS_BIT_SET(huart->Instance->CR3, USART_CR3_DMAR))
   {
@@ -1631,6 +1699,7 @@ HAL_StatusTypeDef HAL_UART_AbortReceive_IT(UART_HandleTypeDef *huart)
     }
   }
   else
+#endif /* USE_UART_DMA */
   {
     /* Reset Rx transfer counter */
     huart->RxXferCount = 0U;
@@ -1730,6 +1799,7 @@ void HAL_UART_IRQHandler(UART_HandleTypeDef *huart)
            Disable Rx Interrupts, and disable Rx DMA request, if ongoing */
         UART_EndRxTransfer(huart);
 
+#if (USE_UART_DMA != 0U)
         /* Disable the UART DMA Rx request if enabled */
         if (HAL_IS_BIT_SET(huart->Instance->CR3, USART_CR3_DMAR))
         {
@@ -1756,6 +1826,7 @@ void HAL_UART_IRQHandler(UART_HandleTypeDef *huart)
           }
         }
         else
+#endif /* USE_UART_DMA */
         {
           /* Call user error callback */
           HAL_UART_ErrorCallback(huart);
@@ -2109,10 +2180,8 @@ uint32_t HAL_UART_GetError(UART_HandleTypeDef *huart)
 HAL_StatusTypeDef UART_SetConfig(UART_HandleTypeDef *huart)
 {
   uint32_t tmpreg                     = 0x00000000U;
-  UART_ClockSourceTypeDef clocksource = UART_CLOCKSOURCE_UNDEFINED;
-  uint16_t brrtemp                    = 0x0000U;
-  uint16_t usartdiv                   = 0x0000U;
-  HAL_StatusTypeDef ret               = HAL_OK;
+  uint32_t usartdiv                   = 0x00000000U;
+  HAL_StatusTypeDef ret;
 
   /* Check the parameters */
   assert_param(IS_UART_BAUDRATE(huart->Init.BaudRate));
@@ -2150,60 +2219,149 @@ HAL_StatusTypeDef UART_SetConfig(UART_HandleTypeDef *huart)
   MODIFY_REG(huart->Instance->CR3, (USART_CR3_RTSE | USART_CR3_CTSE | USART_CR3_ONEBIT), tmpreg);
 
   /*-------------------------- USART BRR Configuration -----------------------*/
+  ret = UART_ComputeBRR(huart, huart->Init.BaudRate, &usartdiv);
+  if (ret == HAL_OK)
+  {
+    huart->Instance->BRR = usartdiv;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief Compute the BRR register value of the UART for a baud rate.
+  * @note  The baud rate division is replaced by a multiplication when the baud rate is in the
+  *        reciprocal table. The result is the same as with the division.
+  * @param huart    UART handle.
+  * @param BaudRate Baud rate.
+  * @param pBRR     Pointer to the BRR register value.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef UART_ComputeBRR(const UART_HandleTypeDef *huart, uint32_t BaudRate, uint32_t *pBRR)
+{
+  UART_ClockSourceTypeDef clocksource;
+  uint32_t usartdiv;
+  HAL_StatusTypeDef ret               = HAL_OK;
+  uint32_t pclk;
+
   UART_GETCLOCKSOURCE(huart, clocksource);
 
-  /* Check UART Over Sampling to set Baud Rate Register */
-  if (huart->Init.OverSampling == UART_OVERSAMPLING_8)
-  {
-    switch (clocksource)
+  /* Retrieve frequency clock */
+  switch (clocksource)
+  {
+    case UART_CLOCKSOURCE_PCLK1:
+      pclk = HAL_RCC_GetPCLK1Freq();
+      break;
+    case UART_CLOCKSOURCE_HSI:
+      pclk = (uint32_t) HSI_VALUE;
+      break;
+    case UART_CLOCKSOURCE_SYSCLK:
+      pclk = HAL_RCC_GetSysClockFreq();
+      break;
+    case UART_CLOCKSOURCE_LSE:
+      pclk = (uint32_t) LSE_VALUE;
+      break;
+    case UART_CLOCKSOURCE_UNDEFINED:
+    default:
+      pclk = 0U;
+      ret = HAL_ERROR;
+      break;
+  }
+
+  /* If proper clock source reported */
+  if (pclk != 0U)
+  {
+    /* Check UART Over Sampling to set Baud Rate Register */
+    if (huart->Init.OverSampling == UART_OVERSAMPLING_8)
+    {
+      /* USARTDIV must be greater than or equal to 0d16 */
+      usartdiv = UART_DivBaudRate(pclk, BaudRate, UART_DIV_SCALE_SAMPLING8);
+      if ((usartdiv >= UART_BRR_MIN) && (usartdiv <= UART_BRR_MAX))
+      {
+        *pBRR = (usartdiv & 0xFFF0U) | ((usartdiv & 0x000FU) >> 1U);
+      }
+      else
+      {
+        ret = HAL_ERROR;
+      }
+    }
+    else
     {
-      case UART_CLOCKSOURCE_PCLK1:
-        usartdiv = (uint16_t)(UART_DIV_SAMPLING8(HAL_RCC_GetPCLK1Freq(), huart->Init.BaudRate));
-        break;
-      case UART_CLOCKSOURCE_HSI:
-        usartdiv = (uint16_t)(UART_DIV_SAMPLING8(HSI_VALUE, huart->Init.BaudRate));
-        break;
-      case UART_CLOCKSOURCE_SYSCLK:
-        usartdiv = (uint16_t)(UART_DIV_SAMPLING8(HAL_RCC_GetSysClockFreq(), huart->Init.BaudRate));
-        break;
-      case UART_CLOCKSOURCE_LSE:
-        usartdiv = (uint16_t)(UART_DIV_SAMPLING8(LSE_VALUE, huart->Init.BaudRate));
-        break;
-      case UART_CLOCKSOURCE_UNDEFINED:
-      default:
+      /* USARTDIV must be greater than or equal to 0d16 */
+      usartdiv = UART_DivBaudRate(pclk, BaudRate, UART_DIV_SCALE_SAMPLING16);
+      if ((usartdiv >= UART_BRR_MIN) && (usartdiv <= UART_BRR_MAX))
+      {
+        *pBRR = usartdiv;
+      }
+      else
+      {
         ret = HAL_ERROR;
-        break;
+      }
     }
+  }
 
-    brrtemp = usartdiv & 0xFFF0U;
-    brrtemp |= (uint16_t)((usartdiv & (uint16_t)0x000FU) >> 1U);
-    huart->Instance->BRR = brrtemp;
+  return ret;
+}
+
+/**
+  * @brief Divide the UART clock by the baud rate, rounded to the nearest.
+  * @note  Cortex-M0 has no divide instruction: for the baud rates of UARTBaudRecipTable, the
+  *        quotient is estimated with a 64-bit multiplication by 2^40/BaudRate, then corrected
+  *        from the remainder so that the result is bit-exact with the rounded division.
+  * @param Clock    UART clock.
+  * @param BaudRate Baud rate.
+  * @param Scale    Log2 of the BRR units per bit clock: 0 in 16-bit oversampling mode,
+  *                 1 in 8-bit oversampling mode.
+  * @retval Clock * 2^Scale / BaudRate
+  */
+static uint32_t UART_DivBaudRate(uint32_t Clock, uint32_t BaudRate, uint32_t Scale)
+{
+  uint32_t index = 0U;
+  uint32_t usartdiv;
+  uint32_t remainder;
+  uint64_t dividend;
+  uint64_t product;
+
+  while ((index < UART_BAUD_RECIP_TABLE_SIZE) && (UARTBaudRecipTable[index].BaudRate != BaudRate))
+  {
+    index++;
   }
-  else
+
+  if (index < UART_BAUD_RECIP_TABLE_SIZE)
   {
-    switch (clocksource)
+    dividend = (uint64_t)Clock << Scale;
+
+    /* Truncated quotient, within one of the exact one */
+    usartdiv = (uint32_t)(((uint64_t)Clock * UARTBaudRecipTable[index].Reciprocal) >> (40U - Scale));
+    product = (uint64_t)usartdiv * BaudRate;
+
+    if (product > dividend)
     {
-      case UART_CLOCKSOURCE_PCLK1:
-        huart->Instance->BRR = (uint16_t)(UART_DIV_SAMPLING16(HAL_RCC_GetPCLK1Freq(), huart->Init.BaudRate));
-        break;
-      case UART_CLOCKSOURCE_HSI:
-        huart->Instance->BRR = (uint16_t)(UART_DIV_SAMPLING16(HSI_VALUE, huart->Init.BaudRate));
-        break;
-      case UART_CLOCKSOURCE_SYSCLK:
-        huart->Instance->BRR = (uint16_t)(UART_DIV_SAMPLING16(HAL_RCC_GetSysClockFreq(), huart->Init.BaudRate));
-        break;
-      case UART_CLOCKSOURCE_LSE:
-        huart->Instance->BRR = (uint16_t)(UART_DIV_SAMPLING16(LSE_VALUE, huart->Init.BaudRate));
-        break;
-      case UART_CLOCKSOURCE_UNDEFINED:
-      default:
-        ret = HAL_ERROR;
-        break;
+      usartdiv--;
+      product -= BaudRate;
     }
-  }
 
-  return ret;
+    remainder = (uint32_t)(dividend - product);
+
+    if (remainder >= BaudRate)
+    {
+      usartdiv++;
+      remainder -= BaudRate;
+    }
 
+    /* Round as (dividend + BaudRate / 2) / BaudRate */
+    if (remainder >= (BaudRate - (BaudRate / 2U)))
+    {
+      usartdiv++;
+    }
+  }
+  /* Baud rate out of the table: same division as the UART_DIV_xxx macros */
+  else
+  {
+    usartdiv = ((Clock << Scale) + (BaudRate / 2U)) / BaudRate;
+  }
+
+  return usartdiv;
 }
 
 /**
@@ -2351,6 +2509,9 @@ HAL_StatusTypeDef UART_WaitOnFlagUntilTimeout(UART_HandleTypeDef *huart, uint32_
   /* Wait until flag is set */
   while((__HAL_UART_GET_FLAG(huart, Flag) ? SET : RESET) == Status)
   {
+    /* Let the application yield or sleep while waiting */
+    HAL_WaitHook(HAL_WAIT_UART, huart);
+
     /* Check for the Timeout */
     if(Timeout != HAL_MAX_DELAY)
     {
@@ -2404,6 +2565,7 @@ static void UART_EndRxTransfer(UART_HandleTypeDef *huart)
 }
 
 
+#if (USE_UART_DMA != 0U)
 /**
   * @brief DMA UART transmit process complete callback.
   * @param hdma DMA handle.
@@ -2658,6 +2820,7 @@ static void UART_DMARxOnlyAbortCallback(DMA_HandleTypeDef *hdma)
   /* Call user Abort complete callback */
   HAL_UART_AbortReceiveCpltCallback(huart);
 }
+#endif /* USE_UART_DMA */
 
 /**
   * @brief  Send an amount of data in interrupt mode.
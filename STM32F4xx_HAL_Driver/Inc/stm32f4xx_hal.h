@@ -56,13 +56,99 @@
   */
 
 /* Exported types ------------------------------------------------------------*/
+/** @defgroup HAL_Exported_Types HAL Exported Types
+  * @{
+  */
+
+/**
+  * @brief  HAL wait reason, passed to HAL_WaitHook() by the blocking HAL functions
+  */
+typedef enum
+{
+  HAL_WAIT_DELAY = 0x00U,  /*!< HAL_Delay()                                       */
+  HAL_WAIT_UART  = 0x01U,  /*!< UART flag polling, Handle is a UART_HandleTypeDef  */
+  HAL_WAIT_I2C   = 0x02U,  /*!< I2C flag polling, Handle is a I2C_HandleTypeDef    */
+  HAL_WAIT_SPI   = 0x03U,  /*!< SPI flag polling, Handle is a SPI_HandleTypeDef    */
+  HAL_WAIT_FLASH = 0x04U   /*!< FLASH operation, Handle is NULL                    */
+} HAL_WaitReasonTypeDef;
+
+#if defined(USE_HAL_PROFILING) && (USE_HAL_PROFILING == 1U)
+/**
+  * @brief  HAL profiling counter of one instrumented function
+  */
+typedef struct
+{
+  uint32_t Calls;          /*!< Number of calls                               */
+  uint64_t TotalCycles;    /*!< Sum of the cycles spent in the function       */
+  uint32_t MinCycles;      /*!< Shortest call in cycles                       */
+  uint32_t MaxCycles;      /*!< Longest call in cycles                        */
+} HAL_ProfCounterTypeDef;
+#endif /* USE_HAL_PROFILING */
+/**
+  * @}
+  */
+
 /* Exported constants --------------------------------------------------------*/
+/** @defgroup HAL_Exported_Constants HAL Exported Constants
+  * @{
+  */
+
+/** @defgroup HAL_Profiling_Id HAL Profiling Identifiers
+  * @brief    Identifiers of the instrumented functions, also sent as event tag over ITM
+  * @{
+  */
+#define HAL_PROF_ID_DMA_IRQ         0x00U   /*!< HAL_DMA_IRQHandler    */
+#define HAL_PROF_ID_UART_IRQ        0x01U   /*!< HAL_UART_IRQHandler   */
+#define HAL_PROF_ID_SPI_IRQ         0x02U   /*!< HAL_SPI_IRQHandler    */
+#define HAL_PROF_ID_I2C_EV_IRQ      0x03U   /*!< HAL_I2C_EV_IRQHandler */
+#define HAL_PROF_ID_I2C_ER_IRQ      0x04U   /*!< HAL_I2C_ER_IRQHandler */
+#define HAL_PROF_ID_PCD_IRQ         0x05U   /*!< HAL_PCD_IRQHandler    */
+#define HAL_PROF_ID_ETH_IRQ         0x06U   /*!< HAL_ETH_IRQHandler    */
+#define HAL_PROF_ID_USER            0x07U   /*!< First application identifier */
+#ifndef HAL_PROF_USER_IDS
+#define HAL_PROF_USER_IDS           8U      /*!< Number of application identifiers */
+#endif /* HAL_PROF_USER_IDS */
+#define HAL_PROF_ID_COUNT           (HAL_PROF_ID_USER + HAL_PROF_USER_IDS)
+/**
+  * @}
+  */
+
+/** @defgroup HAL_Profiling_ITM HAL Profiling ITM stimulus port
+  * @brief    Each event is a 32-bit word: identifier on bits 31 to 24, call duration
+  *           in cycles on bits 23 to 0 (saturated)
+  * @{
+  */
+#ifndef HAL_PROF_ITM_PORT
+#define HAL_PROF_ITM_PORT           1U      /*!< ITM stimulus port of the profiling events */
+#endif /* HAL_PROF_ITM_PORT */
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
 
 /* Exported macro ------------------------------------------------------------*/
 /** @defgroup HAL_Exported_Macros HAL Exported Macros
   * @{
   */
 
+/** @brief  Profiling of a function, between __HAL_PROF_ENTER() placed after its local
+  *         variable declarations and __HAL_PROF_EXIT() placed before each return.
+  * @note   Compiled out unless USE_HAL_PROFILING is set to 1U in the HAL configuration file.
+  *         The application can use them with identifiers from HAL_PROF_ID_USER.
+  * @param  __ID__ identifier of the function, a value of @ref HAL_Profiling_Id.
+  */
+#if defined(USE_HAL_PROFILING) && (USE_HAL_PROFILING == 1U)
+#define __HAL_PROF_ENTER(__ID__)  uint32_t hal_prof_start_##__ID__ = DWT->CYCCNT
+#define __HAL_PROF_EXIT(__ID__)   HAL_PROF_Record((__ID__), hal_prof_start_##__ID__)
+#else
+#define __HAL_PROF_ENTER(__ID__)
+#define __HAL_PROF_EXIT(__ID__)
+#endif /* USE_HAL_PROFILING */
+
 /** @brief  Freeze/Unfreeze Peripherals in Debug mode
   */
 #define __HAL_DBGMCU_FREEZE_TIM2()           (DBGMCU->APB1FZ |= (DBGMCU_APB1_FZ_DBG_TIM2_STOP))
@@ -207,6 +293,10 @@ HAL_StatusTypeDef HAL_InitTick (uint32_t TickPriority);
 void HAL_IncTick(void);
 void HAL_Delay(__IO uint32_t Delay);
 uint32_t HAL_GetTick(void);
+void HAL_DelayUs(uint32_t DelayUs);
+uint32_t HAL_GetCycleCount(void);
+HAL_StatusTypeDef HAL_TimeoutUs(uint32_t StartCycle, uint32_t TimeoutUs);
+void HAL_WaitHook(HAL_WaitReasonTypeDef Reason, const void *Handle);
 void HAL_SuspendTick(void);
 void HAL_ResumeTick(void);
 uint32_t HAL_GetHalVersion(void);
@@ -230,6 +320,20 @@ void HAL_DisableMemorySwappingBank(void);
   * @}
   */
 
+#if defined(USE_HAL_PROFILING) && (USE_HAL_PROFILING == 1U)
+/** @addtogroup HAL_Exported_Functions_Group3
+  * @{
+  */
+/* Profiling functions  *********************************************************/
+void HAL_PROF_Init(void);
+void HAL_PROF_Reset(void);
+void HAL_PROF_Record(uint32_t Id, uint32_t StartCycle);
+const HAL_ProfCounterTypeDef *HAL_PROF_GetCounter(uint32_t Id);
+/**
+  * @}
+  */
+#endif /* USE_HAL_PROFILING */
+
 /**
   * @}
   */
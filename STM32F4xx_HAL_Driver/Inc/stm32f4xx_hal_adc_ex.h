@@ -140,6 +140,20 @@ typedef struct
                                    This parameter can be a value of @ref ADC_delay_between_2_sampling_phases */
 }ADC_MultiModeTypeDef;
 
+/**
+  * @brief ADC interleaved capture configuration structure definition
+  */
+typedef struct
+{
+  uint32_t Mode;              /*!< Number of ADCs interleaved on the channel.
+                                   This parameter can be ADC_DUALMODE_INTERL or ADC_TRIPLEMODE_INTERL */
+  uint32_t Resolution;        /*!< Configures the ADC resolution.
+                                   This parameter can be a value of @ref ADC_Resolution */
+  uint32_t Channel;           /*!< Channel sampled in turn by all the ADCs.
+                                   This parameter can be a value of @ref ADC_channels */
+  uint32_t SampleRate;        /*!< Minimum combined sample rate, in samples per second */
+}ADC_InterleavedConfTypeDef;
+
 /**
   * @}
   */
@@ -292,11 +306,14 @@ uint32_t HAL_ADCEx_InjectedGetValue(ADC_HandleTypeDef* hadc, uint32_t InjectedRa
 HAL_StatusTypeDef HAL_ADCEx_MultiModeStart_DMA(ADC_HandleTypeDef* hadc, uint32_t* pData, uint32_t Length);
 HAL_StatusTypeDef HAL_ADCEx_MultiModeStop_DMA(ADC_HandleTypeDef* hadc);
 uint32_t HAL_ADCEx_MultiModeGetValue(ADC_HandleTypeDef* hadc);
+HAL_StatusTypeDef HAL_ADCEx_InterleavedStart_DMA(ADC_HandleTypeDef* hadcMaster, ADC_HandleTypeDef* hadcSlave1, ADC_HandleTypeDef* hadcSlave2, uint32_t* pData, uint32_t Length);
+HAL_StatusTypeDef HAL_ADCEx_InterleavedStop_DMA(ADC_HandleTypeDef* hadcMaster, ADC_HandleTypeDef* hadcSlave1, ADC_HandleTypeDef* hadcSlave2);
 void HAL_ADCEx_InjectedConvCpltCallback(ADC_HandleTypeDef* hadc);
 
 /* Peripheral Control functions *************************************************/
 HAL_StatusTypeDef HAL_ADCEx_InjectedConfigChannel(ADC_HandleTypeDef* hadc,ADC_InjectionConfTypeDef* sConfigInjected);
 HAL_StatusTypeDef HAL_ADCEx_MultiModeConfigChannel(ADC_HandleTypeDef* hadc, ADC_MultiModeTypeDef* multimode);
+HAL_StatusTypeDef HAL_ADCEx_InterleavedConfig(ADC_HandleTypeDef* hadcMaster, ADC_HandleTypeDef* hadcSlave1, ADC_HandleTypeDef* hadcSlave2, ADC_InterleavedConfTypeDef* sConfig, uint32_t* pEffectiveRate);
 
 /**
   * @}
@@ -311,6 +328,9 @@ HAL_StatusTypeDef HAL_ADCEx_MultiModeConfigChannel(ADC_HandleTypeDef* hadc, ADC_
 /** @defgroup ADCEx_Private_Constants ADC Private Constants
   * @{
   */
+#define ADC_INTERLEAVED_CLOCK_MAX       36000000U   /*!< Maximum ADC clock frequency, VDDA from 2.4 V to 3.6 V */
+#define ADC_INTERLEAVED_DELAY_MIN       5U          /*!< Minimum delay between 2 sampling phases, in ADC clock cycles */
+#define ADC_INTERLEAVED_DELAY_MAX       20U         /*!< Maximum delay between 2 sampling phases, in ADC clock cycles */
 
 /**
   * @}
@@ -372,6 +392,8 @@ HAL_StatusTypeDef HAL_ADCEx_MultiModeConfigChannel(ADC_HandleTypeDef* hadc, ADC_
                                         ((INJTRIG) == ADC_EXTERNALTRIGINJECCONV_T8_CC4)  || \
                                         ((INJTRIG) == ADC_EXTERNALTRIGINJECCONV_EXT_IT15)|| \
                                         ((INJTRIG) == ADC_INJECTED_SOFTWARE_START))
+#define IS_ADC_INTERLEAVED_MODE(MODE) (((MODE) == ADC_DUALMODE_INTERL) || \
+                                       ((MODE) == ADC_TRIPLEMODE_INTERL))
 #define IS_ADC_INJECTED_LENGTH(LENGTH) (((LENGTH) >= 1U) && ((LENGTH) <= 4U))
 #define IS_ADC_INJECTED_RANK(RANK) (((RANK) >= 1U) && ((RANK) <= 4U))
 
@@ -224,6 +224,72 @@ typedef struct
 
 }CanRxMsgTypeDef;
 
+/**
+  * @brief  CAN identifier list structure definition, compiled into filter banks
+  *         by HAL_CAN_ConfigFilterList()
+  */
+typedef struct
+{
+  uint32_t *pStdId;               /*!< Standard identifiers to accept (data frames). The array is sorted
+                                       in place. Each one must be a number between Min_Data = 0 and
+                                       Max_Data = 0x7FF */
+
+  uint32_t NbStdId;               /*!< Number of standard identifiers, 0 if none */
+
+  uint32_t *pExtId;               /*!< Extended identifiers to accept (data frames). The array is sorted
+                                       in place. Each one must be a number between Min_Data = 0 and
+                                       Max_Data = 0x1FFFFFFF */
+
+  uint32_t NbExtId;               /*!< Number of extended identifiers, 0 if none */
+
+  uint32_t FilterFIFOAssignment;  /*!< Specifies the FIFO (0 or 1) which will be assigned to the filters.
+                                       This parameter can be a value of @ref CAN_filter_FIFO */
+
+  uint32_t FirstFilterNumber;     /*!< Specifies the first filter bank which can be used.
+                                       This parameter must be a number between Min_Data = 0 and Max_Data = 27 */
+
+  uint32_t NbFilters;             /*!< Specifies the number of filter banks which can be used,
+                                       from FirstFilterNumber */
+
+  uint32_t BankNumber;            /*!< Select the start slave bank filter.
+                                       This parameter must be a number between Min_Data = 0 and Max_Data = 28 */
+
+}CAN_FilterListTypeDef;
+
+/**
+  * @brief  CAN Rx frame structure definition, raw copy of a receive FIFO mailbox
+  */
+typedef struct
+{
+  uint32_t RIR;   /*!< Receive FIFO mailbox identifier register                */
+
+  uint32_t RDTR;  /*!< Receive FIFO mailbox data length control and time stamp register */
+
+  uint32_t RDLR;  /*!< Receive FIFO mailbox data low register                  */
+
+  uint32_t RDHR;  /*!< Receive FIFO mailbox data high register                 */
+
+}CanRxFrameTypeDef;
+
+/**
+  * @brief  CAN software receive ring structure definition
+  */
+typedef struct
+{
+  CanRxFrameTypeDef *pFrames;  /*!< Ring storage of NbFrames frames, owned by the application */
+
+  uint32_t NbFrames;           /*!< Number of frames of the ring, a power of 2 from 2 to 32768 */
+
+  __IO uint32_t Head;          /*!< Number of frames written, updated by the IRQ handler only */
+
+  __IO uint32_t Tail;          /*!< Number of frames read, updated by HAL_CAN_RxRingRead only */
+
+  __IO uint32_t Dropped;       /*!< Number of frames dropped because the ring was full        */
+
+  __IO uint32_t Overrun;       /*!< Number of hardware FIFO overruns                          */
+
+}CAN_RxRingTypeDef;
+
 /**
   * @brief  CAN handle Structure definition
   */
@@ -239,6 +305,10 @@ typedef struct
 
   CanRxMsgTypeDef*            pRx1Msg;    /*!< Pointer to reception structure for RX FIFO1 msg */
 
+  CAN_RxRingTypeDef*          pRxRing;    /*!< Pointer to software receive ring for RX FIFO0, NULL when not used */
+
+  CAN_RxRingTypeDef*          pRx1Ring;   /*!< Pointer to software receive ring for RX FIFO1, NULL when not used */
+
   __IO HAL_CAN_StateTypeDef   State;      /*!< CAN communication state        */
 
   HAL_LockTypeDef             Lock;       /*!< CAN locking object             */
@@ -653,6 +723,7 @@ typedef struct
 /* Initialization/de-initialization functions ***********************************/
 HAL_StatusTypeDef HAL_CAN_Init(CAN_HandleTypeDef* hcan);
 HAL_StatusTypeDef HAL_CAN_ConfigFilter(CAN_HandleTypeDef* hcan, CAN_FilterConfTypeDef* sFilterConfig);
+HAL_StatusTypeDef HAL_CAN_ConfigFilterList(CAN_HandleTypeDef* hcan, CAN_FilterListTypeDef* sFilterList, uint32_t* pNbFilters);
 HAL_StatusTypeDef HAL_CAN_DeInit(CAN_HandleTypeDef* hcan);
 void HAL_CAN_MspInit(CAN_HandleTypeDef* hcan);
 void HAL_CAN_MspDeInit(CAN_HandleTypeDef* hcan);
@@ -668,11 +739,16 @@ HAL_StatusTypeDef HAL_CAN_Transmit(CAN_HandleTypeDef *hcan, uint32_t Timeout);
 HAL_StatusTypeDef HAL_CAN_Transmit_IT(CAN_HandleTypeDef *hcan);
 HAL_StatusTypeDef HAL_CAN_Receive(CAN_HandleTypeDef *hcan, uint8_t FIFONumber, uint32_t Timeout);
 HAL_StatusTypeDef HAL_CAN_Receive_IT(CAN_HandleTypeDef *hcan, uint8_t FIFONumber);
+HAL_StatusTypeDef HAL_CAN_RxRingStart(CAN_HandleTypeDef *hcan, uint8_t FIFONumber, CAN_RxRingTypeDef *pRing);
+HAL_StatusTypeDef HAL_CAN_RxRingStop(CAN_HandleTypeDef *hcan, uint8_t FIFONumber);
+HAL_StatusTypeDef HAL_CAN_RxRingRead(CAN_HandleTypeDef *hcan, uint8_t FIFONumber, CanRxMsgTypeDef *pRxMsg);
+uint32_t HAL_CAN_RxRingGetLevel(CAN_HandleTypeDef *hcan, uint8_t FIFONumber);
 HAL_StatusTypeDef HAL_CAN_Sleep(CAN_HandleTypeDef *hcan);
 HAL_StatusTypeDef HAL_CAN_WakeUp(CAN_HandleTypeDef *hcan);
 void HAL_CAN_IRQHandler(CAN_HandleTypeDef* hcan);
 void HAL_CAN_TxCpltCallback(CAN_HandleTypeDef* hcan);
 void HAL_CAN_RxCpltCallback(CAN_HandleTypeDef* hcan);
+void HAL_CAN_RxRingCallback(CAN_HandleTypeDef* hcan, uint8_t FIFONumber);
 void HAL_CAN_ErrorCallback(CAN_HandleTypeDef *hcan);
 /**
   * @}
@@ -751,6 +827,8 @@ HAL_CAN_StateTypeDef HAL_CAN_GetState(CAN_HandleTypeDef* hcan);
                                 ((IDTYPE) == CAN_ID_EXT))
 #define IS_CAN_RTR(RTR) (((RTR) == CAN_RTR_DATA) || ((RTR) == CAN_RTR_REMOTE))
 #define IS_CAN_FIFO(FIFO) (((FIFO) == CAN_FIFO0) || ((FIFO) == CAN_FIFO1))
+#define IS_CAN_RXRING_SIZE(SIZE) (((SIZE) >= 2U) && ((SIZE) <= 32768U) && \
+                                  (((SIZE) & ((SIZE) - 1U)) == 0U))
 
 /**
   * @}
@@ -70,7 +70,9 @@
 #define HAL_SRAM_MODULE_ENABLED
 #define HAL_SDRAM_MODULE_ENABLED
 #define HAL_HASH_MODULE_ENABLED
+#define HAL_DIGEST_MODULE_ENABLED
 #define HAL_GPIO_MODULE_ENABLED
+#define HAL_GPIO_WAVE_MODULE_ENABLED
 #define HAL_I2C_MODULE_ENABLED
 #define HAL_I2S_MODULE_ENABLED
 #define HAL_IWDG_MODULE_ENABLED
@@ -160,9 +162,14 @@
 #define  VDD_VALUE                    3300U /*!< Value of VDD in mv */
 #define  TICK_INT_PRIORITY            0x0FU /*!< tick interrupt priority */
 #define  USE_RTOS                     0U
+#define  USE_HAL_ATOMIC_LOCK          0U /*!< 1: handle lock safe between interrupt and thread */
+#define  USE_HAL_NO_LOCK              0U /*!< 1: handle lock compiled out, single context only */
+#define  USE_HAL_PROFILING            0U /*!< 1: DWT cycle counters on the HAL entry points */
+#define  USE_HAL_PROFILING_ITM        0U /*!< 1: profiling events also sent over ITM/SWO */
 #define  PREFETCH_ENABLE              1U
 #define  INSTRUCTION_CACHE_ENABLE     1U
 #define  DATA_CACHE_ENABLE            1U
+#define  USE_HAL_HOT_RAM_FUNC         0U /*!< Interrupt hot paths executed from flash */
 
 /* ########################## Assert Selection ############################## */
 /**
@@ -246,6 +253,15 @@
 
 #define USE_SPI_CRC                     1U
 
+/* ################## DMA peripheral configuration ########################## */
+
+/* STATISTICS FEATURE: Use to activate transfer statistics inside HAL DMA Driver
+* Activated: each DMA handle records transfer counters and DWT cycle timestamps
+* Deactivated: statistics code cleaned from driver
+*/
+
+#define USE_HAL_DMA_STATISTICS          0U
+
 /* Includes ------------------------------------------------------------------*/
 /**
   * @brief Include module's header file
@@ -431,6 +447,14 @@
  #include "stm32f4xx_hal_mmc.h"
 #endif /* HAL_MMC_MODULE_ENABLED */
 
+#ifdef HAL_GPIO_WAVE_MODULE_ENABLED
+ #include "stm32f4xx_hal_gpio_wave.h"
+#endif /* HAL_GPIO_WAVE_MODULE_ENABLED */
+
+#ifdef HAL_DIGEST_MODULE_ENABLED
+ #include "stm32f4xx_hal_digest.h"
+#endif /* HAL_DIGEST_MODULE_ENABLED */
+
 /* Exported macro ------------------------------------------------------------*/
 #ifdef  USE_FULL_ASSERT
 /**
@@ -92,11 +92,98 @@ typedef struct
   * @}
   */
 
+/** @defgroup CRC_Exported_Types_Group3 CRC Algorithm Structure definition
+  * @{
+  */
+typedef struct
+{
+  uint32_t Width;                 /*!< Width of the CRC in bits, from 1 to 32                              */
+
+  uint32_t Polynomial;            /*!< Generator polynomial in normal form, without the x^Width term,
+                                       for instance 0x1021 for CRC-16/CCITT                                */
+
+  uint32_t InitValue;             /*!< Initial value of the CRC register, in normal form                   */
+
+  uint32_t InputReflection;       /*!< Bits of each input byte processed LSB first.
+                                       This parameter can be a value of @ref CRC_Reflection                */
+
+  uint32_t OutputReflection;      /*!< CRC reflected before the final XOR.
+                                       This parameter can be a value of @ref CRC_Reflection                */
+
+  uint32_t XorOut;                /*!< Value XORed to the CRC before it is returned                        */
+
+}CRC_AlgoTypeDef;
+/**
+  * @}
+  */
+
+/** @defgroup CRC_Exported_Types_Group4 CRC Engine Structure definition
+  * @{
+  */
+typedef struct
+{
+  CRC_HandleTypeDef           *hcrc;        /*!< CRC unit handle, NULL to always use the software path      */
+
+  CRC_AlgoTypeDef             Algo;         /*!< CRC algorithm                                              */
+
+  uint32_t                    *pTable;      /*!< Slicing-by-8 tables of CRC_ENGINE_TABLE_SIZE words, only
+                                                 used by the software path                                  */
+
+  uint32_t                    Path;         /*!< Path selected by HAL_CRC_EngineInit().
+                                                 This parameter can be a value of @ref CRC_Engine_Path      */
+
+  uint32_t                    Crc;          /*!< CRC register of the software path                          */
+
+  uint8_t                     Pending[4];   /*!< Bytes of the hardware path waiting for a full word         */
+
+  uint32_t                    PendingCount; /*!< Number of bytes in Pending                                 */
+
+}CRC_EngineTypeDef;
+/**
+  * @}
+  */
+
 /**
   * @}
   */
 
 /* Exported constants --------------------------------------------------------*/
+/** @defgroup CRC_Exported_Constants CRC Exported Constants
+  * @{
+  */
+
+/** @defgroup CRC_Reflection CRC Reflection
+  * @{
+  */
+#define CRC_REFLECTION_DISABLE        0x00000000U   /*!< Bits processed MSB first */
+#define CRC_REFLECTION_ENABLE         0x00000001U   /*!< Bits processed LSB first */
+/**
+  * @}
+  */
+
+/** @defgroup CRC_Engine_Path CRC Engine Path
+  * @{
+  */
+#define CRC_PATH_SOFTWARE             0x00000000U   /*!< Slicing-by-8 software tables                                */
+#define CRC_PATH_HARDWARE             0x00000001U   /*!< CRC unit                                                    */
+#define CRC_PATH_HARDWARE_REFLECTED   0x00000002U   /*!< CRC unit fed with bit reversed words, for the reflected
+                                                         CRC-32 algorithms (CRC-32/ISO-HDLC...)                      */
+/**
+  * @}
+  */
+
+/** @defgroup CRC_Engine_Table_Size CRC Engine Table Size
+  * @{
+  */
+#define CRC_ENGINE_TABLE_SIZE         (8U * 256U)   /*!< Number of 32-bit words of the software path tables          */
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
 /* Exported macro ------------------------------------------------------------*/
 /** @defgroup CRC_Exported_Macros CRC Exported Macros
   * @{
@@ -166,6 +253,18 @@ HAL_CRC_StateTypeDef HAL_CRC_GetState(CRC_HandleTypeDef *hcrc);
   * @}
   */
 
+/** @defgroup CRC_Exported_Functions_Group4 CRC Engine functions
+  * @{
+  */
+HAL_StatusTypeDef HAL_CRC_EngineInit(CRC_EngineTypeDef *hcrce, CRC_HandleTypeDef *hcrc, const CRC_AlgoTypeDef *pAlgo, uint32_t *pTable);
+HAL_StatusTypeDef HAL_CRC_EngineStart(CRC_EngineTypeDef *hcrce);
+void HAL_CRC_EngineUpdate(CRC_EngineTypeDef *hcrce, const uint8_t *pData, uint32_t Size);
+uint32_t HAL_CRC_EngineFinish(CRC_EngineTypeDef *hcrce);
+HAL_StatusTypeDef HAL_CRC_EngineCompute(CRC_EngineTypeDef *hcrce, const uint8_t *pData, uint32_t Size, uint32_t *pCrc);
+/**
+  * @}
+  */
+
 /**
   * @}
   */
@@ -200,6 +299,9 @@ HAL_CRC_StateTypeDef HAL_CRC_GetState(CRC_HandleTypeDef *hcrc);
 /** @defgroup CRC_Private_Constants CRC Private Constants
   * @{
   */
+#define CRC_HW_POLYNOMIAL             0x04C11DB7U   /*!< Polynomial of the CRC unit              */
+#define CRC_HW_POLYNOMIAL_REFLECTED   0xEDB88320U   /*!< Reflected polynomial of the CRC unit    */
+#define CRC_HW_INIT_VALUE             0xFFFFFFFFU   /*!< Value of the CRC unit after a reset     */
 
 /**
   * @}
@@ -209,6 +311,10 @@ HAL_CRC_StateTypeDef HAL_CRC_GetState(CRC_HandleTypeDef *hcrc);
 /** @defgroup CRC_Private_Macros CRC Private Macros
   * @{
   */
+#define IS_CRC_WIDTH(WIDTH)           (((WIDTH) >= 1U) && ((WIDTH) <= 32U))
+
+#define IS_CRC_REFLECTION(REFLECTION) (((REFLECTION) == CRC_REFLECTION_DISABLE) || \
+                                       ((REFLECTION) == CRC_REFLECTION_ENABLE))
 
 /**
   * @}
@@ -114,11 +114,18 @@ uint32_t HAL_DACEx_DualGetValue(DAC_HandleTypeDef* hdac);
 HAL_StatusTypeDef HAL_DACEx_TriangleWaveGenerate(DAC_HandleTypeDef* hdac, uint32_t Channel, uint32_t Amplitude);
 HAL_StatusTypeDef HAL_DACEx_NoiseWaveGenerate(DAC_HandleTypeDef* hdac, uint32_t Channel, uint32_t Amplitude);
 HAL_StatusTypeDef HAL_DACEx_DualSetValue(DAC_HandleTypeDef* hdac, uint32_t Alignment, uint32_t Data1, uint32_t Data2);
+HAL_StatusTypeDef HAL_DACEx_DualStart_DMA(DAC_HandleTypeDef* hdac, uint32_t Channel, uint32_t* pData, uint32_t Length, uint32_t Alignment);
+HAL_StatusTypeDef HAL_DACEx_DualStop_DMA(DAC_HandleTypeDef* hdac, uint32_t Channel);
+HAL_StatusTypeDef HAL_DACEx_DualTriangleWaveGenerate(DAC_HandleTypeDef* hdac, uint32_t Amplitude1, uint32_t Amplitude2);
+HAL_StatusTypeDef HAL_DACEx_DualNoiseWaveGenerate(DAC_HandleTypeDef* hdac, uint32_t Amplitude1, uint32_t Amplitude2);
 
 void HAL_DACEx_ConvCpltCallbackCh2(DAC_HandleTypeDef* hdac);
 void HAL_DACEx_ConvHalfCpltCallbackCh2(DAC_HandleTypeDef* hdac);
 void HAL_DACEx_ErrorCallbackCh2(DAC_HandleTypeDef* hdac);
 void HAL_DACEx_DMAUnderrunCallbackCh2(DAC_HandleTypeDef* hdac);
+void HAL_DACEx_DualConvCpltCallback(DAC_HandleTypeDef* hdac);
+void HAL_DACEx_DualConvHalfCpltCallback(DAC_HandleTypeDef* hdac);
+void HAL_DACEx_DualErrorCallback(DAC_HandleTypeDef* hdac);
 /**
   * @}
   */
@@ -176,6 +183,7 @@ void HAL_DACEx_DMAUnderrunCallbackCh2(DAC_HandleTypeDef* hdac);
 void DAC_DMAConvCpltCh2(DMA_HandleTypeDef *hdma);
 void DAC_DMAErrorCh2(DMA_HandleTypeDef *hdma);
 void DAC_DMAHalfConvCpltCh2(DMA_HandleTypeDef *hdma);
+HAL_StatusTypeDef DAC_DualWaveGenerate(DAC_HandleTypeDef* hdac, uint32_t Wave1, uint32_t Wave2);
 /**
   * @}
   */
@@ -105,6 +105,40 @@ typedef enum
 #if (USE_RTOS == 1U)
   /* Reserved for future use */
   #error "USE_RTOS should be 0 in the current HAL release"
+#elif defined (USE_HAL_NO_LOCK) && (USE_HAL_NO_LOCK == 1U)
+  /* Single execution context: the HAL handles are never accessed concurrently,
+     the locks are compiled out */
+  #define __HAL_LOCK(__HANDLE__)                                           \
+                                do{                                        \
+                                  }while (0U)
+
+  #define __HAL_UNLOCK(__HANDLE__)                                          \
+                                  do{                                       \
+                                    }while (0U)
+#elif defined (USE_HAL_ATOMIC_LOCK) && (USE_HAL_ATOMIC_LOCK == 1U)
+  /* Atomic test-and-set of the Lock field with exclusive accesses: an interrupt
+     taking the lock between the test and the set makes the store fail and the
+     test is done again. The exclusive access is on the first byte of the Lock
+     field, which holds the whole value whatever the enum size */
+  #define __HAL_LOCK(__HANDLE__)                                                              \
+                                do{                                                         \
+                                    do{                                                     \
+                                        if(__LDREXB((volatile uint8_t *)&(__HANDLE__)->Lock) \
+                                           == (uint8_t)HAL_LOCKED)                          \
+                                        {                                                   \
+                                           __CLREX();                                       \
+                                           return HAL_BUSY;                                 \
+                                        }                                                   \
+                                      }while(__STREXB((uint8_t)HAL_LOCKED,                  \
+                                             (volatile uint8_t *)&(__HANDLE__)->Lock) != 0U); \
+                                    __DMB();                                                \
+                                  }while (0U)
+
+  #define __HAL_UNLOCK(__HANDLE__)                                          \
+                                  do{                                       \
+                                      __DMB();                              \
+                                      (__HANDLE__)->Lock = HAL_UNLOCKED;    \
+                                    }while (0U)
 #else
   #define __HAL_LOCK(__HANDLE__)                                           \
                                 do{                                        \
@@ -205,6 +239,29 @@ typedef enum
 
 #endif
 
+/**
+  * @brief  __HOT_RAM_FUNC definition
+  */
+#if defined (USE_HAL_HOT_RAM_FUNC) && (USE_HAL_HOT_RAM_FUNC == 1U)
+/* Interrupt hot paths of the HAL (DMA, UART, SPI and PCD IRQ handlers with their
+   per-data routines, USB FIFO accesses and HAL_IncTick) are placed in RAM to avoid
+   the flash wait states. The section defaults to ".RamFunc", copied to SRAM by the
+   startup code; the CCM RAM cannot be used as it is not connected to the I-bus.
+*/
+#ifndef HOT_RAM_FUNC_SECTION
+#define HOT_RAM_FUNC_SECTION ".RamFunc"
+#endif /* HOT_RAM_FUNC_SECTION */
+
+#if defined ( __ICCARM__ )
+#define __HOT_RAM_FUNC __ramfunc
+#else
+#define __HOT_RAM_FUNC __attribute__((section(HOT_RAM_FUNC_SECTION)))
+#endif
+
+#else
+#define __HOT_RAM_FUNC
+#endif /* USE_HAL_HOT_RAM_FUNC */
+
 #ifdef __cplusplus
 }
 #endif
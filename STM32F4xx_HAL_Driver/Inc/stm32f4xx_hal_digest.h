@@ -0,0 +1,263 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_hal_digest.h
+  * @author  MCD Application Team
+  * @brief   Header file of message digest HAL module.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2017 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F4xx_HAL_DIGEST_H
+#define __STM32F4xx_HAL_DIGEST_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_hal_def.h"
+
+/** @addtogroup STM32F4xx_HAL_Driver
+  * @{
+  */
+
+/** @addtogroup DIGEST
+  * @{
+  */
+
+/** @defgroup DIGEST_Hardware_Support DIGEST Hardware Support
+  * @brief    Algorithms computed by the HASH processor of the device
+  * @{
+  */
+#if defined(HAL_HASH_MODULE_ENABLED) && (defined(STM32F415xx) || defined(STM32F417xx) || \
+    defined(STM32F437xx) || defined(STM32F439xx) || defined(STM32F479xx))
+#define DIGEST_HASH_SHA1                          /*!< SHA-1 computed by the HASH processor         */
+#endif /* HAL_HASH_MODULE_ENABLED && STM32F415xx || STM32F417xx || STM32F437xx || STM32F439xx || STM32F479xx */
+
+#if defined(HAL_HASH_MODULE_ENABLED) && (defined(STM32F437xx) || defined(STM32F439xx) || defined(STM32F479xx))
+#define DIGEST_HASH_SHA256                        /*!< SHA-224 and SHA-256 computed by the HASH processor */
+#endif /* HAL_HASH_MODULE_ENABLED && STM32F437xx || STM32F439xx || STM32F479xx */
+/**
+  * @}
+  */
+
+/** @defgroup DIGEST_DMA_Min_Size DIGEST DMA Minimum Size
+  * @brief    Size in bytes from which the HASH processor is fed by DMA, when the
+  *           HASH handle has a DMA handle. Can be redefined in stm32f4xx_hal_conf.h.
+  * @{
+  */
+#ifndef DIGEST_DMA_MIN_SIZE
+#define DIGEST_DMA_MIN_SIZE           512U
+#endif /* DIGEST_DMA_MIN_SIZE */
+/**
+  * @}
+  */
+
+/* Exported types ------------------------------------------------------------*/
+/** @defgroup DIGEST_Exported_Types DIGEST Exported Types
+  * @{
+  */
+
+/**
+  * @brief  HAL DIGEST State structure definition
+  */
+typedef enum
+{
+  HAL_DIGEST_STATE_RESET      = 0x00U,    /*!< DIGEST not yet initialized                   */
+  HAL_DIGEST_STATE_READY      = 0x01U,    /*!< DIGEST initialized, no message in progress   */
+  HAL_DIGEST_STATE_BUSY       = 0x02U,    /*!< Message in progress                          */
+  HAL_DIGEST_STATE_ERROR      = 0x03U     /*!< HASH processor timeout or DMA error          */
+}HAL_DIGEST_StateTypeDef;
+
+/**
+  * @brief  DIGEST Init structure definition
+  */
+typedef struct
+{
+  uint32_t            Algorithm;      /*!< Digest algorithm.
+                                           This parameter can be a value of @ref DIGEST_Algorithm          */
+
+#if defined(DIGEST_HASH_SHA1)
+  HASH_HandleTypeDef  *hhash;         /*!< HASH handle initialized with HAL_HASH_Init() for 8-bit data, or
+                                           NULL to use the software path. Its hdmain DMA handle, if any, is
+                                           used for the large buffers                                     */
+
+#endif /* DIGEST_HASH_SHA1 */
+}DIGEST_InitTypeDef;
+
+/**
+  * @brief  DIGEST handle Structure definition
+  */
+typedef struct
+{
+  DIGEST_InitTypeDef             Init;          /*!< DIGEST required parameters                           */
+
+  uint32_t                       Path;          /*!< Path selected by HAL_DIGEST_Init().
+                                                     This parameter can be a value of @ref DIGEST_Path   */
+
+  uint64_t                       Chain[8];      /*!< Chaining value of the software path                  */
+
+  uint64_t                       Length;        /*!< Number of message bytes processed                    */
+
+  uint32_t                       Block[32];     /*!< Pending partial block of the software path           */
+
+  uint32_t                       BlockSize;     /*!< Number of bytes in Block                             */
+
+  uint32_t                       Pad[32];       /*!< HMAC key XORed with the outer pad                    */
+
+  uint32_t                       Hmac;          /*!< HMAC in progress                                     */
+
+#if defined(DIGEST_HASH_SHA1)
+  HASH_StreamTypeDef             Stream;        /*!< HASH processor stream of the hardware path           */
+
+#endif /* DIGEST_HASH_SHA1 */
+  __IO HAL_DIGEST_StateTypeDef   State;         /*!< DIGEST state                                         */
+}DIGEST_HandleTypeDef;
+
+/**
+  * @}
+  */
+
+/* Exported constants --------------------------------------------------------*/
+/** @defgroup DIGEST_Exported_Constants DIGEST Exported Constants
+  * @{
+  */
+
+/** @defgroup DIGEST_Algorithm DIGEST Algorithm
+  * @{
+  */
+#define DIGEST_ALGO_SHA1              0x00000000U   /*!< SHA-1, 20-byte digest   */
+#define DIGEST_ALGO_SHA224            0x00000001U   /*!< SHA-224, 28-byte digest */
+#define DIGEST_ALGO_SHA256            0x00000002U   /*!< SHA-256, 32-byte digest */
+#define DIGEST_ALGO_SHA384            0x00000003U   /*!< SHA-384, 48-byte digest */
+#define DIGEST_ALGO_SHA512            0x00000004U   /*!< SHA-512, 64-byte digest */
+/**
+  * @}
+  */
+
+/** @defgroup DIGEST_Path DIGEST Path
+  * @{
+  */
+#define DIGEST_PATH_SOFTWARE          0x00000000U   /*!< Software implementation  */
+#define DIGEST_PATH_HASH              0x00000001U   /*!< HASH processor           */
+/**
+  * @}
+  */
+
+/** @defgroup DIGEST_Size DIGEST Size
+  * @{
+  */
+#define DIGEST_MAX_SIZE               64U           /*!< Largest digest size in bytes (SHA-512) */
+#define DIGEST_MAX_BLOCK_SIZE         128U          /*!< Largest block size in bytes (SHA-512)  */
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/* Exported functions --------------------------------------------------------*/
+/** @addtogroup DIGEST_Exported_Functions
+  * @{
+  */
+
+/** @addtogroup DIGEST_Exported_Functions_Group1
+  * @{
+  */
+/* Initialization/de-initialization functions  ********************************/
+HAL_StatusTypeDef HAL_DIGEST_Init(DIGEST_HandleTypeDef *hdigest);
+HAL_StatusTypeDef HAL_DIGEST_DeInit(DIGEST_HandleTypeDef *hdigest);
+/**
+  * @}
+  */
+
+/** @addtogroup DIGEST_Exported_Functions_Group2
+  * @{
+  */
+/* Digest functions ***********************************************************/
+HAL_StatusTypeDef HAL_DIGEST_Start(DIGEST_HandleTypeDef *hdigest);
+HAL_StatusTypeDef HAL_DIGEST_Update(DIGEST_HandleTypeDef *hdigest, const uint8_t *pData, uint32_t Size, uint32_t Timeout);
+HAL_StatusTypeDef HAL_DIGEST_Finish(DIGEST_HandleTypeDef *hdigest, uint8_t *pDigest, uint32_t Timeout);
+HAL_StatusTypeDef HAL_DIGEST_Compute(DIGEST_HandleTypeDef *hdigest, const uint8_t *pData, uint32_t Size, uint8_t *pDigest,
+                                     uint32_t Timeout);
+
+/* HMAC functions *************************************************************/
+HAL_StatusTypeDef HAL_DIGEST_HMAC_Start(DIGEST_HandleTypeDef *hdigest, const uint8_t *pKey, uint32_t KeySize, uint32_t Timeout);
+HAL_StatusTypeDef HAL_DIGEST_HMAC_Finish(DIGEST_HandleTypeDef *hdigest, uint8_t *pMac, uint32_t Timeout);
+HAL_StatusTypeDef HAL_DIGEST_HMAC_Compute(DIGEST_HandleTypeDef *hdigest, const uint8_t *pKey, uint32_t KeySize,
+                                          const uint8_t *pData, uint32_t Size, uint8_t *pMac, uint32_t Timeout);
+/**
+  * @}
+  */
+
+/** @addtogroup DIGEST_Exported_Functions_Group3
+  * @{
+  */
+/* Peripheral State functions  ************************************************/
+HAL_DIGEST_StateTypeDef HAL_DIGEST_GetState(DIGEST_HandleTypeDef *hdigest);
+uint32_t HAL_DIGEST_GetPath(DIGEST_HandleTypeDef *hdigest);
+uint32_t HAL_DIGEST_GetSize(DIGEST_HandleTypeDef *hdigest);
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/* Private macros ------------------------------------------------------------*/
+/** @defgroup DIGEST_Private_Macros DIGEST Private Macros
+  * @{
+  */
+#define IS_DIGEST_ALGORITHM(ALGORITHM) (((ALGORITHM) == DIGEST_ALGO_SHA1)   || \
+                                        ((ALGORITHM) == DIGEST_ALGO_SHA224) || \
+                                        ((ALGORITHM) == DIGEST_ALGO_SHA256) || \
+                                        ((ALGORITHM) == DIGEST_ALGO_SHA384) || \
+                                        ((ALGORITHM) == DIGEST_ALGO_SHA512))
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __STM32F4xx_HAL_DIGEST_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -622,6 +622,17 @@ typedef struct
 
 } ETH_DMARxFrameInfos;
 
+/**
+  * @brief  HAL ETH Rx Get Buffer Function definition
+  */
+typedef void (*pETH_rxAllocateCallbackTypeDef)(uint8_t **buffer);  /*!< pointer to an ETH Rx Get Buffer Function */
+
+/**
+  * @brief  HAL ETH Rx Set App Data Function definition
+  */
+typedef void (*pETH_rxLinkCallbackTypeDef)(void **pStart, void **pEnd, uint8_t *buff,
+                                           uint16_t Length); /*!< pointer to an ETH Rx Set App Data Function */
+
 /**
   * @brief  ETH Handle Structure definition
   */
@@ -640,6 +651,24 @@ typedef struct
 
   ETH_DMARxFrameInfos        RxFrameInfos;  /*!< last Rx frame infos         */
 
+  ETH_DMADescTypeDef         *RxBuildDesc;  /*!< Rx descriptor to give back to the DMA (application buffers) */
+
+  uint32_t                   RxBuildDescCnt; /*!< Number of Rx descriptors waiting for a buffer              */
+
+  uint32_t                   RxDescCnt;     /*!< Number of Rx descriptors in the list (application buffers) */
+
+  uint32_t                   RxDataLength;  /*!< Length of the received packet being linked                 */
+
+  uint32_t                   RxLastDescStatus; /*!< Status of the last descriptor of the last packet        */
+
+  void                       *pRxStart;     /*!< Pointer to the first element of the packet being linked    */
+
+  void                       *pRxEnd;       /*!< Pointer to the last element of the packet being linked     */
+
+  pETH_rxAllocateCallbackTypeDef  rxAllocateCallback; /*!< ETH Rx Get Buffer Function   */
+
+  pETH_rxLinkCallbackTypeDef      rxLinkCallback;     /*!< ETH Rx Set App Data Function */
+
   __IO HAL_ETH_StateTypeDef  State;         /*!< ETH communication state     */
 
   HAL_LockTypeDef            Lock;          /*!< ETH Lock                    */
@@ -844,6 +873,9 @@ typedef struct
 #define ETH_DMARXDESC_DBE         0x00000004U  /*!< Dribble bit error: frame contains non int multiple of 8 bits  */
 #define ETH_DMARXDESC_CE          0x00000002U  /*!< CRC error */
 #define ETH_DMARXDESC_MAMPCE      0x00000001U  /*!< Rx MAC Address/Payload Checksum Error: Rx MAC address matched/ Rx Payload Checksum Error */
+#define ETH_DMARXDESC_ERRORS_MASK (ETH_DMARXDESC_ES | ETH_DMARXDESC_DE | ETH_DMARXDESC_SAF | ETH_DMARXDESC_LE | \
+                                   ETH_DMARXDESC_OE | ETH_DMARXDESC_IPV4HCE | ETH_DMARXDESC_LC | \
+                                   ETH_DMARXDESC_RWT | ETH_DMARXDESC_RE | ETH_DMARXDESC_CE) /*!< Receive errors mask */
 
 /**
   * @brief  Bit definition of RDES1 register
@@ -2109,6 +2141,7 @@ void HAL_ETH_MspInit(ETH_HandleTypeDef *heth);
 void HAL_ETH_MspDeInit(ETH_HandleTypeDef *heth);
 HAL_StatusTypeDef HAL_ETH_DMATxDescListInit(ETH_HandleTypeDef *heth, ETH_DMADescTypeDef *DMATxDescTab, uint8_t* TxBuff, uint32_t TxBuffCount);
 HAL_StatusTypeDef HAL_ETH_DMARxDescListInit(ETH_HandleTypeDef *heth, ETH_DMADescTypeDef *DMARxDescTab, uint8_t *RxBuff, uint32_t RxBuffCount);
+HAL_StatusTypeDef HAL_ETH_DMARxDescListAllocInit(ETH_HandleTypeDef *heth, ETH_DMADescTypeDef *DMARxDescTab, uint32_t RxDescCount);
 
 /**
   * @}
@@ -2125,6 +2158,15 @@ HAL_StatusTypeDef HAL_ETH_ReadPHYRegister(ETH_HandleTypeDef *heth, uint16_t PHYR
 HAL_StatusTypeDef HAL_ETH_WritePHYRegister(ETH_HandleTypeDef *heth, uint16_t PHYReg, uint32_t RegValue);
 /* Non-Blocking mode: Interrupt */
 HAL_StatusTypeDef HAL_ETH_GetReceivedFrame_IT(ETH_HandleTypeDef *heth);
+/* Reception in application buffers */
+HAL_StatusTypeDef HAL_ETH_ReadData(ETH_HandleTypeDef *heth, void **pAppBuff);
+HAL_StatusTypeDef HAL_ETH_RegisterRxAllocateCallback(ETH_HandleTypeDef *heth, pETH_rxAllocateCallbackTypeDef rxAllocateCallback);
+HAL_StatusTypeDef HAL_ETH_UnRegisterRxAllocateCallback(ETH_HandleTypeDef *heth);
+HAL_StatusTypeDef HAL_ETH_RegisterRxLinkCallback(ETH_HandleTypeDef *heth, pETH_rxLinkCallbackTypeDef rxLinkCallback);
+HAL_StatusTypeDef HAL_ETH_UnRegisterRxLinkCallback(ETH_HandleTypeDef *heth);
+HAL_StatusTypeDef HAL_ETH_GetRxDataErrorCode(ETH_HandleTypeDef *heth, uint32_t *pErrorCode);
+void HAL_ETH_RxAllocateCallback(uint8_t **buff);
+void HAL_ETH_RxLinkCallback(void **pStart, void **pEnd, uint8_t *buff, uint16_t Length);
 void HAL_ETH_IRQHandler(ETH_HandleTypeDef *heth);
 /* Callback in non blocking modes (Interrupt) */
 void HAL_ETH_TxCpltCallback(ETH_HandleTypeDef *heth);
@@ -167,6 +167,16 @@ typedef struct
   * @}
   */
 
+/** @defgroup FLASHEx_Erase_Queue FLASH Erase Queue
+  * @{
+  */
+#ifndef FLASH_ERASE_QUEUE_DEPTH
+#define FLASH_ERASE_QUEUE_DEPTH         8U           /*!< Number of sector erase jobs which can be scheduled */
+#endif /* FLASH_ERASE_QUEUE_DEPTH */
+/**
+  * @}
+  */
+
 /** @defgroup FLASHEx_Voltage_Range FLASH Voltage Range
   * @{
   */
@@ -744,6 +754,9 @@ typedef struct
 /* Extension Program operation functions  *************************************/
 HAL_StatusTypeDef HAL_FLASHEx_Erase(FLASH_EraseInitTypeDef *pEraseInit, uint32_t *SectorError);
 HAL_StatusTypeDef HAL_FLASHEx_Erase_IT(FLASH_EraseInitTypeDef *pEraseInit);
+HAL_StatusTypeDef HAL_FLASHEx_Erase_Schedule(FLASH_EraseInitTypeDef *pEraseInit);
+uint32_t          HAL_FLASHEx_Erase_GetPending(void);
+uint32_t          HAL_FLASHEx_IsAddressReadable(uint32_t Address);
 HAL_StatusTypeDef HAL_FLASHEx_OBProgram(FLASH_OBProgramInitTypeDef *pOBInit);
 void              HAL_FLASHEx_OBGetConfig(FLASH_OBProgramInitTypeDef *pOBInit);
 
@@ -1063,6 +1076,8 @@ uint16_t          HAL_FLASHEx_OB_GetBank2WRP(void);
   */
 void FLASH_Erase_Sector(uint32_t Sector, uint8_t VoltageRange);
 void FLASH_FlushCaches(void);
+void FLASH_EraseQueue_Next(void);
+void FLASH_EraseQueue_Abort(void);
 /**
   * @}
   */
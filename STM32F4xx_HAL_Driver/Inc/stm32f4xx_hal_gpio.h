@@ -88,6 +88,12 @@ typedef enum
   GPIO_PIN_RESET = 0,
   GPIO_PIN_SET
 }GPIO_PinState;
+
+/**
+  * @brief  GPIO pin descriptor: port base address and pin number packed in one word,
+  *         built with __HAL_GPIO_PIN_DESC() from compile-time constants
+  */
+typedef uint32_t GPIO_PinDescTypeDef;
 /**
   * @}
   */
@@ -224,6 +230,31 @@ typedef enum
   * @retval None
   */
 #define __HAL_GPIO_EXTI_GENERATE_SWIT(__EXTI_LINE__) (EXTI->SWIER |= (__EXTI_LINE__))
+
+/**
+  * @brief  Builds a pin descriptor for the HAL_GPIO_Fast_xxx() functions.
+  * @note   The GPIO ports are aligned on 1 Kbyte, so the pin number is kept in the
+  *         low bits of the port address. With constant parameters, the descriptor
+  *         and the register accesses derived from it are resolved at compile time.
+  * @param  __PORT__: GPIO port, where x can be (A..K) to select the GPIO peripheral.
+  * @param  __PIN__: pin number, from 0 to 15 (not a GPIO_PIN_x mask).
+  * @retval GPIO_PinDescTypeDef
+  */
+#define __HAL_GPIO_PIN_DESC(__PORT__, __PIN__) ((GPIO_PinDescTypeDef)((uint32_t)(__PORT__) | ((__PIN__) & 0x0FU)))
+
+/**
+  * @brief  Gets the port of a pin descriptor.
+  * @param  __DESC__: pin descriptor built with __HAL_GPIO_PIN_DESC().
+  * @retval GPIO_TypeDef pointer
+  */
+#define __HAL_GPIO_DESC_PORT(__DESC__) ((GPIO_TypeDef *)((__DESC__) & ~0x0FU))
+
+/**
+  * @brief  Gets the pin number of a pin descriptor.
+  * @param  __DESC__: pin descriptor built with __HAL_GPIO_PIN_DESC().
+  * @retval Pin number, from 0 to 15
+  */
+#define __HAL_GPIO_DESC_PIN(__DESC__) ((uint32_t)(__DESC__) & 0x0FU)
 /**
   * @}
   */
@@ -257,6 +288,125 @@ HAL_StatusTypeDef HAL_GPIO_LockPin(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin);
 void HAL_GPIO_EXTI_IRQHandler(uint16_t GPIO_Pin);
 void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin);
 
+/**
+  * @}
+  */
+
+/** @defgroup GPIO_Exported_Functions_Group3 Fast pin access functions
+  * @brief    Inline pin functions working on compile-time pin descriptors, reduced
+  *           to one register access each
+  * @{
+  */
+
+/**
+  * @brief  Sets the pin of a descriptor with a single BSRR write.
+  * @param  Desc: pin descriptor built with __HAL_GPIO_PIN_DESC().
+  * @retval None
+  */
+__STATIC_INLINE void HAL_GPIO_Fast_Set(GPIO_PinDescTypeDef Desc)
+{
+  __HAL_GPIO_DESC_PORT(Desc)->BSRR = 1UL << __HAL_GPIO_DESC_PIN(Desc);
+}
+
+/**
+  * @brief  Resets the pin of a descriptor with a single BSRR write.
+  * @param  Desc: pin descriptor built with __HAL_GPIO_PIN_DESC().
+  * @retval None
+  */
+__STATIC_INLINE void HAL_GPIO_Fast_Reset(GPIO_PinDescTypeDef Desc)
+{
+  __HAL_GPIO_DESC_PORT(Desc)->BSRR = 1UL << (__HAL_GPIO_DESC_PIN(Desc) + 16U);
+}
+
+/**
+  * @brief  Reads the input level of the pin of a descriptor.
+  * @param  Desc: pin descriptor built with __HAL_GPIO_PIN_DESC().
+  * @retval 1 if the pin is high, 0 otherwise
+  */
+__STATIC_INLINE uint32_t HAL_GPIO_Fast_Read(GPIO_PinDescTypeDef Desc)
+{
+  return (__HAL_GPIO_DESC_PORT(Desc)->IDR >> __HAL_GPIO_DESC_PIN(Desc)) & 1U;
+}
+
+/**
+  * @brief  Switches the pin of a descriptor to output, without read-modify-write.
+  * @note   The low bit of the pin MODER field is written through its bit-band alias,
+  *         so an interrupt changing another pin of the port cannot be overwritten.
+  *         The pin must be in input or output mode: the output type, speed and pull
+  *         set by HAL_GPIO_Init() are kept, for instance open drain for 1-Wire.
+  * @param  Desc: pin descriptor built with __HAL_GPIO_PIN_DESC().
+  * @retval None
+  */
+__STATIC_INLINE void HAL_GPIO_Fast_SetOutput(GPIO_PinDescTypeDef Desc)
+{
+  ATOMIC_SET_BIT_BB(__HAL_GPIO_DESC_PORT(Desc)->MODER, __HAL_GPIO_DESC_PIN(Desc) * 2U);
+}
+
+/**
+  * @brief  Switches the pin of a descriptor to input, without read-modify-write.
+  * @note   Same conditions as HAL_GPIO_Fast_SetOutput().
+  * @param  Desc: pin descriptor built with __HAL_GPIO_PIN_DESC().
+  * @retval None
+  */
+__STATIC_INLINE void HAL_GPIO_Fast_SetInput(GPIO_PinDescTypeDef Desc)
+{
+  ATOMIC_CLEAR_BIT_BB(__HAL_GPIO_DESC_PORT(Desc)->MODER, __HAL_GPIO_DESC_PIN(Desc) * 2U);
+}
+
+/**
+  * @brief  Configures several pins of a port with one access to each register.
+  * @note   Unlike HAL_GPIO_Init(), the registers are not updated pin by pin: the
+  *         field masks of all the pins are computed first, which folds to constants
+  *         when the parameters are constant, then MODER, OTYPER, OSPEEDR, PUPDR and
+  *         AFR are each read and written once. No parameter check is done and the
+  *         EXTI configuration is left unchanged: the EXTI modes are not supported.
+  * @param  GPIOx: where x can be (A..K) to select the GPIO peripheral.
+  * @param  GPIO_Pin: any combination of GPIO_PIN_x where x can be (0..15).
+  * @param  Mode: GPIO_MODE_INPUT, GPIO_MODE_OUTPUT_PP, GPIO_MODE_OUTPUT_OD, GPIO_MODE_AF_PP,
+  *               GPIO_MODE_AF_OD or GPIO_MODE_ANALOG.
+  * @param  Pull: a value of @ref GPIO_pull_define.
+  * @param  Speed: a value of @ref GPIO_speed_define.
+  * @param  Alternate: a value of @ref GPIO_Alternate_function_selection, used in AF modes only.
+  * @retval None
+  */
+__STATIC_INLINE void HAL_GPIO_Fast_Apply(GPIO_TypeDef *GPIOx, uint32_t GPIO_Pin, uint32_t Mode, uint32_t Pull,
+                                         uint32_t Speed, uint32_t Alternate)
+{
+  uint32_t mask2 = GPIO_Pin & GPIO_PIN_MASK;
+  uint32_t mask4l = GPIO_Pin & 0xFFU;
+  uint32_t mask4h = (GPIO_Pin >> 8U) & 0xFFU;
+
+  /* Spread the pin mask to one bit every 2 bits: low bit of each 2-bit field */
+  mask2 = (mask2 | (mask2 << 8U)) & 0x00FF00FFU;
+  mask2 = (mask2 | (mask2 << 4U)) & 0x0F0F0F0FU;
+  mask2 = (mask2 | (mask2 << 2U)) & 0x33333333U;
+  mask2 = (mask2 | (mask2 << 1U)) & 0x55555555U;
+
+  GPIOx->MODER = (GPIOx->MODER & ~(mask2 * 3U)) | (mask2 * (Mode & GPIO_MODER_MODER0));
+  GPIOx->OTYPER = (GPIOx->OTYPER & ~GPIO_Pin) | (((Mode >> 4U) & 1U) * GPIO_Pin);
+  GPIOx->OSPEEDR = (GPIOx->OSPEEDR & ~(mask2 * 3U)) | (mask2 * Speed);
+  GPIOx->PUPDR = (GPIOx->PUPDR & ~(mask2 * 3U)) | (mask2 * Pull);
+
+  if((Mode & GPIO_MODER_MODER0) == GPIO_MODE_AF_PP)
+  {
+    /* Spread the pin masks to one bit every 4 bits: low bit of each AFR field */
+    mask4l = (mask4l | (mask4l << 12U)) & 0x000F000FU;
+    mask4l = (mask4l | (mask4l << 6U)) & 0x03030303U;
+    mask4l = (mask4l | (mask4l << 3U)) & 0x11111111U;
+    mask4h = (mask4h | (mask4h << 12U)) & 0x000F000FU;
+    mask4h = (mask4h | (mask4h << 6U)) & 0x03030303U;
+    mask4h = (mask4h | (mask4h << 3U)) & 0x11111111U;
+
+    if(mask4l != 0U)
+    {
+      GPIOx->AFR[0] = (GPIOx->AFR[0] & ~(mask4l * 0xFU)) | (mask4l * Alternate);
+    }
+    if(mask4h != 0U)
+    {
+      GPIOx->AFR[1] = (GPIOx->AFR[1] & ~(mask4h * 0xFU)) | (mask4h * Alternate);
+    }
+  }
+}
 /**
   * @}
   */
@@ -0,0 +1,214 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_hal_gpio_wave.h
+  * @author  MCD Application Team
+  * @brief   Header file of GPIO parallel wave HAL module.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2017 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F4xx_HAL_GPIO_WAVE_H
+#define __STM32F4xx_HAL_GPIO_WAVE_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_hal_def.h"
+
+/** @addtogroup STM32F4xx_HAL_Driver
+  * @{
+  */
+
+/** @addtogroup GPIO_WAVE
+  * @{
+  */
+
+/* Exported types ------------------------------------------------------------*/
+/** @defgroup GPIO_WAVE_Exported_Types GPIO Wave Exported Types
+  * @{
+  */
+
+/**
+  * @brief  HAL GPIO wave State structure definition
+  */
+typedef enum
+{
+  HAL_GPIO_WAVE_STATE_RESET   = 0x00U,    /*!< GPIO wave not yet initialized            */
+  HAL_GPIO_WAVE_STATE_READY   = 0x01U,    /*!< GPIO wave initialized and ready for use  */
+  HAL_GPIO_WAVE_STATE_BUSY_TX = 0x02U,    /*!< Output to BSRR ongoing                   */
+  HAL_GPIO_WAVE_STATE_BUSY_RX = 0x03U,    /*!< Capture from IDR ongoing                 */
+  HAL_GPIO_WAVE_STATE_ERROR   = 0x04U     /*!< DMA transfer error                       */
+}HAL_GPIO_WAVE_StateTypeDef;
+
+/**
+  * @brief  GPIO wave handle Structure definition
+  */
+typedef struct
+{
+  GPIO_TypeDef                      *Instance;   /*!< GPIO port of the parallel bus                        */
+
+  TIM_HandleTypeDef                 *htim;       /*!< Timer pacing the samples with its update DMA request,
+                                                      initialized with HAL_TIM_Base_Init(): one sample per
+                                                      update event                                        */
+
+  DMA_HandleTypeDef                 *hdma;       /*!< DMA2 stream and channel of the timer update request,
+                                                      initialized with HAL_DMA_Init()                     */
+
+  HAL_LockTypeDef                   Lock;        /*!< Locking object                                      */
+
+  __IO HAL_GPIO_WAVE_StateTypeDef   State;       /*!< GPIO wave state                                     */
+
+  __IO uint32_t                     ErrorCode;   /*!< GPIO wave error code                                */
+}GPIO_WAVE_HandleTypeDef;
+
+/**
+  * @}
+  */
+
+/* Exported constants --------------------------------------------------------*/
+/** @defgroup GPIO_WAVE_Exported_Constants GPIO Wave Exported Constants
+  * @{
+  */
+
+/** @defgroup GPIO_WAVE_Error_Code GPIO Wave Error Code
+  * @{
+  */
+#define HAL_GPIO_WAVE_ERROR_NONE      0x00000000U   /*!< No error              */
+#define HAL_GPIO_WAVE_ERROR_PARAM     0x00000001U   /*!< Invalid parameter     */
+#define HAL_GPIO_WAVE_ERROR_DMA       0x00000002U   /*!< DMA transfer error    */
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/* Exported macro ------------------------------------------------------------*/
+/** @defgroup GPIO_WAVE_Exported_Macros GPIO Wave Exported Macros
+  * @{
+  */
+
+/** @brief  Reset GPIO wave handle state.
+  * @param  __HANDLE__: GPIO wave handle.
+  * @retval None
+  */
+#define __HAL_GPIO_WAVE_RESET_HANDLE_STATE(__HANDLE__) ((__HANDLE__)->State = HAL_GPIO_WAVE_STATE_RESET)
+
+/**
+  * @brief  Builds the BSRR word driving the pins of BusMask to the bits of Value.
+  * @note   The pins of BusMask set in Value are set, the others are reset, and
+  *         the pins out of BusMask are left unchanged.
+  * @param  __VALUE__: bus value, already shifted to the position of the bus pins.
+  * @param  __BUSMASK__: any combination of GPIO_PIN_x where x can be (0..15).
+  * @retval BSRR word
+  */
+#define __HAL_GPIO_WAVE_BSRR(__VALUE__, __BUSMASK__) \
+  ((((uint32_t)(__VALUE__)) & (__BUSMASK__)) | (((~((uint32_t)(__VALUE__))) & (__BUSMASK__)) << 16U))
+
+/**
+  * @}
+  */
+
+/* Exported functions --------------------------------------------------------*/
+/** @addtogroup GPIO_WAVE_Exported_Functions
+  * @{
+  */
+
+/** @addtogroup GPIO_WAVE_Exported_Functions_Group1
+  * @{
+  */
+/* Initialization and de-initialization functions *****************************/
+HAL_StatusTypeDef HAL_GPIO_WAVE_Init(GPIO_WAVE_HandleTypeDef *hwave);
+HAL_StatusTypeDef HAL_GPIO_WAVE_DeInit(GPIO_WAVE_HandleTypeDef *hwave);
+/**
+  * @}
+  */
+
+/** @addtogroup GPIO_WAVE_Exported_Functions_Group2
+  * @{
+  */
+/* IO operation functions *****************************************************/
+void              HAL_GPIO_WAVE_PrepareBSRR(uint32_t *pBSRR, const uint16_t *pData, uint32_t Length,
+                                            uint32_t BusMask, uint32_t Shift, uint32_t StrobePin);
+HAL_StatusTypeDef HAL_GPIO_WAVE_Start_DMA(GPIO_WAVE_HandleTypeDef *hwave, const uint32_t *pBSRR, uint32_t Length);
+HAL_StatusTypeDef HAL_GPIO_WAVE_Capture_DMA(GPIO_WAVE_HandleTypeDef *hwave, uint16_t *pData, uint32_t Length);
+HAL_StatusTypeDef HAL_GPIO_WAVE_Stop(GPIO_WAVE_HandleTypeDef *hwave);
+void              HAL_GPIO_WAVE_CpltCallback(GPIO_WAVE_HandleTypeDef *hwave);
+void              HAL_GPIO_WAVE_HalfCpltCallback(GPIO_WAVE_HandleTypeDef *hwave);
+void              HAL_GPIO_WAVE_ErrorCallback(GPIO_WAVE_HandleTypeDef *hwave);
+/**
+  * @}
+  */
+
+/** @addtogroup GPIO_WAVE_Exported_Functions_Group3
+  * @{
+  */
+/* Peripheral State and Error functions  **************************************/
+HAL_GPIO_WAVE_StateTypeDef HAL_GPIO_WAVE_GetState(GPIO_WAVE_HandleTypeDef *hwave);
+uint32_t                   HAL_GPIO_WAVE_GetError(GPIO_WAVE_HandleTypeDef *hwave);
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/* Private macros ------------------------------------------------------------*/
+/** @defgroup GPIO_WAVE_Private_Macros GPIO Wave Private Macros
+  * @{
+  */
+#if defined(TIM8)
+#define IS_GPIO_WAVE_TIM_INSTANCE(INSTANCE) (((INSTANCE) == TIM1) || ((INSTANCE) == TIM8))
+#else
+#define IS_GPIO_WAVE_TIM_INSTANCE(INSTANCE) ((INSTANCE) == TIM1)
+#endif /* TIM8 */
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __STM32F4xx_HAL_GPIO_WAVE_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
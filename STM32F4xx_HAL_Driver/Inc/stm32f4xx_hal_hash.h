@@ -57,6 +57,9 @@
   *  @{
   */
 
+/* Number of HASH context swap registers */
+#define HASH_NUMBER_OF_CSR_REGISTERS       54U
+
 /* Exported types ------------------------------------------------------------*/
 /** @defgroup HASH_Exported_Types HASH Exported Types
   * @{
@@ -115,6 +118,24 @@ typedef enum
   * @{
   */
 
+/**
+  * @brief  HASH logical stream definition: one digest in progress, swapped in and out of the
+  *         HASH processor by the stream functions
+  */
+typedef struct
+{
+      uint32_t                   Algorithm;         /*!< Algorithm of the stream, a value of @ref HASH_Exported_Constants_Group1 */
+
+      HAL_HASH_PhaseTypeDef      Phase;             /*!< HAL_HASH_PHASE_READY until the processor is initialized for the stream */
+
+      uint32_t                   BlockSize;         /*!< Number of bytes pending in Block                         */
+
+      uint32_t                   Block[16];         /*!< Pending partial block, the processor is fed whole blocks */
+
+      uint32_t                   Context[HASH_NUMBER_OF_CSR_REGISTERS + 3U]; /*!< IMR, STR, CR and CSR registers saved
+                                                                                  when the stream is swapped out          */
+} HASH_StreamTypeDef;
+
 typedef struct
 {
       HASH_InitTypeDef           Init;              /*!< HASH required parameters       */
@@ -138,6 +159,8 @@ typedef struct
       HAL_LockTypeDef            Lock;              /*!< HASH locking object            */
 
      __IO HAL_HASH_StateTypeDef  State;             /*!< HASH peripheral state          */
+
+      HASH_StreamTypeDef         *pActiveStream;    /*!< Stream loaded in the processor */
 } HASH_HandleTypeDef;
 
 /**
@@ -359,6 +382,20 @@ void HAL_HASH_MspDeInit(HASH_HandleTypeDef *hhash);
 void HAL_HASH_InCpltCallback(HASH_HandleTypeDef *hhash);
 void HAL_HASH_DgstCpltCallback(HASH_HandleTypeDef *hhash);
 void HAL_HASH_ErrorCallback(HASH_HandleTypeDef *hhash);
+/**
+  * @}
+  */
+
+/** @addtogroup HASH_Exported_Functions_Group9
+  * @{
+  */
+void HAL_HASH_ContextSaving(HASH_HandleTypeDef *hhash, uint8_t* pMemBuffer);
+void HAL_HASH_ContextRestoring(HASH_HandleTypeDef *hhash, uint8_t* pMemBuffer);
+HAL_StatusTypeDef HAL_HASH_StreamInit(HASH_HandleTypeDef *hhash, HASH_StreamTypeDef *hstream, uint32_t Algorithm);
+HAL_StatusTypeDef HAL_HASH_StreamUpdate(HASH_HandleTypeDef *hhash, HASH_StreamTypeDef *hstream, uint8_t *pInBuffer, uint32_t Size, uint32_t Timeout);
+HAL_StatusTypeDef HAL_HASH_StreamFinish(HASH_HandleTypeDef *hhash, HASH_StreamTypeDef *hstream, uint8_t* pOutBuffer, uint32_t Timeout);
+HAL_StatusTypeDef HAL_HASH_StreamCopy(HASH_HandleTypeDef *hhash, HASH_StreamTypeDef *hdest, HASH_StreamTypeDef *hsrc, uint32_t Timeout);
+HAL_StatusTypeDef HAL_HASH_StreamSuspend(HASH_HandleTypeDef *hhash, uint32_t Timeout);
 /**
   * @}
   */
@@ -419,6 +456,13 @@ void HAL_HASH_ErrorCallback(HASH_HandleTypeDef *hhash);
 
 #define IS_HASH_SHA1_BUFFER_SIZE(__SIZE__) ((((__SIZE__)%4U) != 0U)? 0U: 1U)
 
+#if defined(STM32F437xx) || defined(STM32F439xx) || defined(STM32F479xx)
+#define IS_HASH_STREAM_ALGOSELECTION(__ALGOSELECTION__) IS_HASH_ALGOSELECTION(__ALGOSELECTION__)
+#else
+#define IS_HASH_STREAM_ALGOSELECTION(__ALGOSELECTION__) (((__ALGOSELECTION__) == HASH_ALGOSELECTION_SHA1) || \
+                                                         ((__ALGOSELECTION__) == HASH_ALGOSELECTION_MD5))
+#endif /* STM32F437xx || STM32F439xx || STM32F479xx */
+
 /**
   * @}
   */
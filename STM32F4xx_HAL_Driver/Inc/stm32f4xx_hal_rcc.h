@@ -111,6 +111,25 @@ typedef struct
 
 }RCC_ClkInitTypeDef;
 
+/**
+  * @brief  RCC clock state structure definition, saved before STOP mode with
+  *         HAL_RCC_SaveClockState() and restored on wake-up with HAL_RCC_RestoreClockState()
+  */
+typedef struct
+{
+  uint32_t CR;                /*!< RCC_CR: oscillators and PLLs enabled                */
+
+  uint32_t PLLCFGR;           /*!< RCC_PLLCFGR: main PLL configuration                 */
+
+  uint32_t CFGR;              /*!< RCC_CFGR: system clock source and bus prescalers    */
+
+  uint32_t FlashACR;          /*!< FLASH_ACR: latency, prefetch and caches enabled     */
+
+  uint32_t PwrCR;             /*!< PWR_CR: regulator over-drive enabled                */
+
+  uint32_t SystemCoreClock;   /*!< SystemCoreClock value to restore                    */
+}RCC_ClockStateTypeDef;
+
 /**
   * @}
   */
@@ -1247,6 +1266,7 @@ typedef struct
 void HAL_RCC_DeInit(void);
 HAL_StatusTypeDef HAL_RCC_OscConfig(RCC_OscInitTypeDef *RCC_OscInitStruct);
 HAL_StatusTypeDef HAL_RCC_ClockConfig(RCC_ClkInitTypeDef *RCC_ClkInitStruct, uint32_t FLatency);
+HAL_StatusTypeDef HAL_RCC_ClockConfigAuto(RCC_ClkInitTypeDef *RCC_ClkInitStruct);
 /**
   * @}
   */
@@ -1264,6 +1284,9 @@ uint32_t HAL_RCC_GetPCLK1Freq(void);
 uint32_t HAL_RCC_GetPCLK2Freq(void);
 void     HAL_RCC_GetOscConfig(RCC_OscInitTypeDef *RCC_OscInitStruct);
 void     HAL_RCC_GetClockConfig(RCC_ClkInitTypeDef *RCC_ClkInitStruct, uint32_t *pFLatency);
+uint32_t HAL_RCC_GetOptimalFlashLatency(uint32_t HCLKFreq, uint32_t VoltageScaling);
+void     HAL_RCC_SaveClockState(RCC_ClockStateTypeDef *pState);
+HAL_StatusTypeDef HAL_RCC_RestoreClockState(const RCC_ClockStateTypeDef *pState);
 
 /* CSS NMI IRQ handler */
 void HAL_RCC_NMI_IRQHandler(void);
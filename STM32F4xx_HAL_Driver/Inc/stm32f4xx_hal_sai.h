@@ -689,6 +689,7 @@ HAL_StatusTypeDef HAL_SAI_Receive_IT(SAI_HandleTypeDef *hsai, uint8_t *pData, ui
 /* Non-Blocking mode: DMA */
 HAL_StatusTypeDef HAL_SAI_Transmit_DMA(SAI_HandleTypeDef *hsai, uint8_t *pData, uint16_t Size);
 HAL_StatusTypeDef HAL_SAI_Receive_DMA(SAI_HandleTypeDef *hsai, uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_SAI_ReceiveDoubleBuffer_DMA(SAI_HandleTypeDef *hsai, uint8_t *pData0, uint8_t *pData1, uint16_t Size);
 HAL_StatusTypeDef HAL_SAI_DMAPause(SAI_HandleTypeDef *hsai);
 HAL_StatusTypeDef HAL_SAI_DMAResume(SAI_HandleTypeDef *hsai);
 HAL_StatusTypeDef HAL_SAI_DMAStop(SAI_HandleTypeDef *hsai);
@@ -707,6 +708,8 @@ void HAL_SAI_IRQHandler(SAI_HandleTypeDef *hsai);
 void HAL_SAI_TxHalfCpltCallback(SAI_HandleTypeDef *hsai);
 void HAL_SAI_TxCpltCallback(SAI_HandleTypeDef *hsai);
 void HAL_SAI_RxHalfCpltCallback(SAI_HandleTypeDef *hsai);
+void HAL_SAI_RxM0CpltCallback(SAI_HandleTypeDef *hsai);
+void HAL_SAI_RxM1CpltCallback(SAI_HandleTypeDef *hsai);
 void HAL_SAI_RxCpltCallback(SAI_HandleTypeDef *hsai);
 void HAL_SAI_ErrorCallback(SAI_HandleTypeDef *hsai);
 /**
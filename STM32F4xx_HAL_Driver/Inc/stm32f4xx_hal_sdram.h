@@ -92,6 +92,58 @@ typedef struct
   DMA_HandleTypeDef             *hdma;      /*!< Pointer DMA handler                   */
 
 }SDRAM_HandleTypeDef;
+
+/**
+  * @brief  SDRAM device datasheet parameters used by HAL_SDRAM_ComputeTiming()
+  */
+typedef struct
+{
+  uint32_t LoadToActiveDelay;           /*!< tMRD, delay between a Load Mode Register command and an
+                                             active or refresh command, in memory clock cycles      */
+
+  uint32_t ExitSelfRefreshNs;           /*!< tXSR, exit self-refresh to active delay, in ns          */
+
+  uint32_t SelfRefreshTimeNs;           /*!< tRAS(min), active to precharge delay, in ns             */
+
+  uint32_t RowCycleNs;                  /*!< tRC, refresh/active to refresh/active delay, in ns      */
+
+  uint32_t WriteRecoveryNs;             /*!< tWR (tDPL), write recovery time, in ns                  */
+
+  uint32_t RPDelayNs;                   /*!< tRP, precharge command period, in ns                    */
+
+  uint32_t RCDDelayNs;                  /*!< tRCD, active to read/write delay, in ns                 */
+
+  uint32_t RefreshPeriodMs;             /*!< tREF, refresh period of the whole array, in ms
+                                             (typically 64)                                          */
+
+  uint32_t RowCount;                    /*!< Number of rows to refresh within RefreshPeriodMs
+                                             (typically 4096 or 8192)                                */
+
+  uint32_t CASLatency;                  /*!< CAS latency supported at the target SDRAM clock,
+                                             in memory clock cycles (1, 2 or 3)                      */
+
+  uint32_t AccessTimePs;                /*!< tAC, access time from clock at CASLatency, in ps       */
+
+  uint32_t BoardDelayPs;                /*!< Round trip SDCLK/data PCB propagation delay, in ps     */
+}SDRAM_DeviceParamTypeDef;
+
+/**
+  * @brief  SDRAM benchmark results returned by HAL_SDRAM_Benchmark()
+  */
+typedef struct
+{
+  uint32_t WriteCycles;                 /*!< CPU cycles taken by the DMA write of the buffer        */
+
+  uint32_t WriteBandwidth;              /*!< DMA write throughput, in bytes per second              */
+
+  uint32_t ReadCycles;                  /*!< CPU cycles taken by the DMA read of the buffer         */
+
+  uint32_t ReadBandwidth;               /*!< DMA read throughput, in bytes per second               */
+
+  uint32_t ReadLatencyCycles;           /*!< Average CPU cycles of a random single word read        */
+
+  uint32_t ReadLatencyNs;               /*!< Average duration of a random single word read, in ns   */
+}SDRAM_BenchmarkTypeDef;
 /**
   * @}
   */
@@ -123,6 +175,8 @@ typedef struct
 /* Initialization/de-initialization functions *********************************/
 HAL_StatusTypeDef HAL_SDRAM_Init(SDRAM_HandleTypeDef *hsdram, FMC_SDRAM_TimingTypeDef *Timing);
 HAL_StatusTypeDef HAL_SDRAM_DeInit(SDRAM_HandleTypeDef *hsdram);
+HAL_StatusTypeDef HAL_SDRAM_ComputeTiming(SDRAM_HandleTypeDef *hsdram, SDRAM_DeviceParamTypeDef *pParam, uint32_t HclkFreq,
+                                          FMC_SDRAM_TimingTypeDef *Timing, uint32_t *pRefreshRate);
 void HAL_SDRAM_MspInit(SDRAM_HandleTypeDef *hsdram);
 void HAL_SDRAM_MspDeInit(SDRAM_HandleTypeDef *hsdram);
 
@@ -161,6 +215,9 @@ HAL_StatusTypeDef HAL_SDRAM_SendCommand(SDRAM_HandleTypeDef *hsdram, FMC_SDRAM_C
 HAL_StatusTypeDef HAL_SDRAM_ProgramRefreshRate(SDRAM_HandleTypeDef *hsdram, uint32_t RefreshRate);
 HAL_StatusTypeDef HAL_SDRAM_SetAutoRefreshNumber(SDRAM_HandleTypeDef *hsdram, uint32_t AutoRefreshNumber);
 uint32_t          HAL_SDRAM_GetModeStatus(SDRAM_HandleTypeDef *hsdram);
+uint32_t          HAL_SDRAM_GetInternalBankSize(SDRAM_HandleTypeDef *hsdram);
+HAL_StatusTypeDef HAL_SDRAM_Benchmark(SDRAM_HandleTypeDef *hsdram, uint32_t *pAddress, uint32_t *pBuffer, uint32_t BufferSize,
+                                      SDRAM_BenchmarkTypeDef *pResult, uint32_t Timeout);
 /**
   * @}
   */
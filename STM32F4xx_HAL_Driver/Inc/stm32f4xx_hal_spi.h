@@ -116,6 +116,44 @@ typedef enum
   HAL_SPI_STATE_ERROR      = 0x06U     /*!< SPI error state                                    */
 }HAL_SPI_StateTypeDef;
 
+/**
+  * @brief  SPI queued transaction structure definition
+  * @note   A transaction handed to HAL_SPI_QueueTransaction_DMA() belongs to the
+  *         driver until its State leaves HAL_SPI_TRANSACTION_STATE_PENDING: it must
+  *         not be modified nor released by the application in between.
+  */
+typedef struct __SPI_TransactionTypeDef
+{
+  uint32_t      CLKPolarity;        /*!< Device clock polarity, a value of @ref SPI_Clock_Polarity         */
+
+  uint32_t      CLKPhase;           /*!< Device clock phase, a value of @ref SPI_Clock_Phase               */
+
+  uint32_t      BaudRatePrescaler;  /*!< Device baud rate prescaler, a value of @ref SPI_BaudRate_Prescaler */
+
+  uint32_t      DataSize;           /*!< Device data size, a value of @ref SPI_Data_Size                   */
+
+  GPIO_TypeDef  *CSPort;            /*!< GPIO port of the device chip select line, NULL if not managed     */
+
+  uint16_t      CSPin;              /*!< GPIO pin of the device chip select line (active low)              */
+
+  uint16_t      Size;               /*!< Number of data to be exchanged                                    */
+
+  uint8_t       *pTxData;           /*!< Pointer to transmission data buffer                               */
+
+  uint8_t       *pRxData;           /*!< Pointer to reception data buffer                                  */
+
+  __IO uint32_t State;              /*!< Transaction state, a value of @ref SPI_Transaction_State          */
+
+  uint32_t      ErrorCode;          /*!< SPI error code of the transaction, a value of @ref SPI_Error_Code */
+
+  void          (* XferCpltCallback)(struct __SPI_TransactionTypeDef *pTrans); /*!< Completion callback (may be NULL),
+                                                                                     called once the transaction is
+                                                                                     done, in error or aborted      */
+
+  struct __SPI_TransactionTypeDef *pNext; /*!< Next pending transaction (internal)                           */
+
+}SPI_TransactionTypeDef;
+
 /**
   * @brief  SPI handle Structure definition
   */
@@ -141,6 +179,8 @@ typedef struct __SPI_HandleTypeDef
 
   void                       (*TxISR)(struct __SPI_HandleTypeDef * hspi); /* function pointer on Tx ISR */
 
+  void                       (*IRQHandler)(struct __SPI_HandleTypeDef * hspi); /* Lean interrupt entry of the running transfer, NULL for the generic one */
+
   DMA_HandleTypeDef          *hdmatx;      /* SPI Tx DMA Handle parameters   */
 
   DMA_HandleTypeDef          *hdmarx;      /* SPI Rx DMA Handle parameters   */
@@ -151,6 +191,10 @@ typedef struct __SPI_HandleTypeDef
 
   __IO uint32_t              ErrorCode;    /* SPI Error code */
 
+  SPI_TransactionTypeDef     *pTransHead;  /* Queued transaction being transferred */
+
+  SPI_TransactionTypeDef     *pTransTail;  /* Last pending queued transaction */
+
 }SPI_HandleTypeDef;
 
 /**
@@ -176,6 +220,18 @@ typedef struct __SPI_HandleTypeDef
   * @}
   */
 
+/** @defgroup SPI_Transaction_State SPI Queued Transaction State
+  * @{
+  */
+#define HAL_SPI_TRANSACTION_STATE_RESET    0x00000000U   /*!< Transaction not queued yet             */
+#define HAL_SPI_TRANSACTION_STATE_PENDING  0x00000001U   /*!< Transaction queued or being transferred */
+#define HAL_SPI_TRANSACTION_STATE_DONE     0x00000002U   /*!< Transaction completed                  */
+#define HAL_SPI_TRANSACTION_STATE_ERROR    0x00000003U   /*!< Transaction ended on a transfer error  */
+#define HAL_SPI_TRANSACTION_STATE_ABORTED  0x00000004U   /*!< Transaction removed by an abort/stop  */
+/**
+  * @}
+  */
+
 /** @defgroup SPI_Mode SPI Mode
   * @{
   */
@@ -298,6 +354,18 @@ typedef struct __SPI_HandleTypeDef
   * @}
   */
 
+/** @defgroup SPI_Fast_Timeout_Period SPI Polled Fast Path Timeout Period
+  * @brief    Number of polling loop iterations between two timeout checks of
+  *           the HAL_SPI_TransmitReceive_Fastx() functions
+  * @{
+  */
+#if !defined(SPI_FAST_TIMEOUT_PERIOD)
+#define SPI_FAST_TIMEOUT_PERIOD         64U
+#endif /* SPI_FAST_TIMEOUT_PERIOD */
+/**
+  * @}
+  */
+
 /**
   * @}
   */
@@ -446,7 +514,9 @@ HAL_StatusTypeDef HAL_SPI_Receive_IT(SPI_HandleTypeDef *hspi, uint8_t *pData, ui
 HAL_StatusTypeDef HAL_SPI_TransmitReceive_IT(SPI_HandleTypeDef *hspi, uint8_t *pTxData, uint8_t *pRxData, uint16_t Size);
 HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size);
 HAL_StatusTypeDef HAL_SPI_Receive_DMA(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_SPI_ReceiveDoubleBuffer_DMA(SPI_HandleTypeDef *hspi, uint8_t *pData0, uint8_t *pData1, uint16_t Size);
 HAL_StatusTypeDef HAL_SPI_TransmitReceive_DMA(SPI_HandleTypeDef *hspi, uint8_t *pTxData, uint8_t *pRxData, uint16_t Size);
+HAL_StatusTypeDef HAL_SPI_QueueTransaction_DMA(SPI_HandleTypeDef *hspi, SPI_TransactionTypeDef *pTrans);
 HAL_StatusTypeDef HAL_SPI_DMAPause(SPI_HandleTypeDef *hspi);
 HAL_StatusTypeDef HAL_SPI_DMAResume(SPI_HandleTypeDef *hspi);
 HAL_StatusTypeDef HAL_SPI_DMAStop(SPI_HandleTypeDef *hspi);
@@ -460,6 +530,8 @@ void HAL_SPI_RxCpltCallback(SPI_HandleTypeDef *hspi);
 void HAL_SPI_TxRxCpltCallback(SPI_HandleTypeDef *hspi);
 void HAL_SPI_TxHalfCpltCallback(SPI_HandleTypeDef *hspi);
 void HAL_SPI_RxHalfCpltCallback(SPI_HandleTypeDef *hspi);
+void HAL_SPI_RxM0CpltCallback(SPI_HandleTypeDef *hspi);
+void HAL_SPI_RxM1CpltCallback(SPI_HandleTypeDef *hspi);
 void HAL_SPI_TxRxHalfCpltCallback(SPI_HandleTypeDef *hspi);
 void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *hspi);
 void HAL_SPI_AbortCpltCallback(SPI_HandleTypeDef *hspi);
@@ -477,6 +549,286 @@ uint32_t             HAL_SPI_GetError(SPI_HandleTypeDef *hspi);
   * @}
   */
 
+/** @defgroup SPI_Exported_Functions_Group4 Polled fast path functions
+  * @brief    Inline blocking full-duplex transfer functions specialised at
+  *           compile time for the data size and the CRC calculation
+  * @{
+  */
+
+/* HAL_GetTick() is declared in stm32f4xx_hal.h which includes this file first */
+uint32_t HAL_GetTick(void);
+
+/**
+  * @brief  Common body of the HAL_SPI_TransmitReceive_Fastx() functions.
+  * @note   DataSize16 and Crc are expected to be constants so that the compiler
+  *         removes the unused branches from the polling loop.
+  * @note   Up to two data are kept in flight: one in the shift register and one
+  *         in the Tx buffer, so that the clock is not stopped between two data.
+  *         The overrun flag is checked on every status read, since the next
+  *         DR then SR reads of the loop would clear it. The timeout is only
+  *         checked once every SPI_FAST_TIMEOUT_PERIOD loop iterations.
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *               the configuration information for SPI module.
+  * @param  pTxData: pointer to transmission data buffer
+  * @param  pRxData: pointer to reception data buffer
+  * @param  Size: amount of data to be sent and received
+  * @param  Timeout: Timeout duration
+  * @param  DataSize16: 0U for 8-bit data, 1U for 16-bit data
+  * @param  Crc: 0U without CRC, 1U to send and check the CRC after the data
+  * @retval HAL status
+  */
+__STATIC_INLINE HAL_StatusTypeDef SPI_FastTransmitReceive(SPI_HandleTypeDef *hspi, const uint8_t *pTxData,
+                                                          uint8_t *pRxData, uint32_t Size, uint32_t Timeout,
+                                                          uint32_t DataSize16, uint32_t Crc)
+{
+  SPI_TypeDef *spix = hspi->Instance;
+  HAL_StatusTypeDef errorcode = HAL_OK;
+  uint32_t txcount = Size;
+  uint32_t rxcount = Size;
+  uint32_t period = SPI_FAST_TIMEOUT_PERIOD;
+  uint32_t tickstart;
+  uint32_t sr;
+
+  /* Process Locked */
+  __HAL_LOCK(hspi);
+
+  if(hspi->State != HAL_SPI_STATE_READY)
+  {
+    __HAL_UNLOCK(hspi);
+    return HAL_BUSY;
+  }
+
+  if((pTxData == NULL) || (pRxData == NULL) || (Size == 0U))
+  {
+    __HAL_UNLOCK(hspi);
+    return HAL_ERROR;
+  }
+
+  hspi->State     = HAL_SPI_STATE_BUSY_TX_RX;
+  hspi->ErrorCode = HAL_SPI_ERROR_NONE;
+
+  /* Init tickstart for timeout management*/
+  tickstart = HAL_GetTick();
+
+#if (USE_SPI_CRC != 0U)
+  if(Crc != 0U)
+  {
+    /* Reset CRC Calculation */
+    spix->CR1 &= (uint16_t)(~SPI_CR1_CRCEN);
+    spix->CR1 |= SPI_CR1_CRCEN;
+  }
+#else
+  UNUSED(Crc);
+#endif /* USE_SPI_CRC */
+
+  /* Check if the SPI is already enabled */
+  if((spix->CR1 & SPI_CR1_SPE) != SPI_CR1_SPE)
+  {
+    /* Enable SPI peripheral */
+    spix->CR1 |= SPI_CR1_SPE;
+  }
+
+  while(rxcount > 0U)
+  {
+    sr = spix->SR;
+
+    /* A lost data would keep rxcount above 0: stop before DR is read and clears OVR */
+    if((sr & SPI_FLAG_OVR) != 0U)
+    {
+      hspi->ErrorCode = HAL_SPI_ERROR_OVR;
+      errorcode = HAL_ERROR;
+      break;
+    }
+
+    /* Write a new data as soon as the Tx buffer is free and less than two data are in flight */
+    if(((sr & SPI_FLAG_TXE) != 0U) && (txcount > 0U) && ((rxcount - txcount) < 2U))
+    {
+      if(DataSize16 != 0U)
+      {
+        spix->DR = *((const uint16_t *)pTxData);
+        pTxData += sizeof(uint16_t);
+      }
+      else
+      {
+        *((__IO uint8_t *)&spix->DR) = *pTxData;
+        pTxData += sizeof(uint8_t);
+      }
+      txcount--;
+
+#if (USE_SPI_CRC != 0U)
+      /* Enable CRC Transmission right after the last data */
+      if((Crc != 0U) && (txcount == 0U))
+      {
+        spix->CR1 |= SPI_CR1_CRCNEXT;
+      }
+#endif /* USE_SPI_CRC */
+    }
+
+    /* Read the received data as soon as available */
+    if((sr & SPI_FLAG_RXNE) != 0U)
+    {
+      if(DataSize16 != 0U)
+      {
+        *((uint16_t *)pRxData) = (uint16_t)spix->DR;
+        pRxData += sizeof(uint16_t);
+      }
+      else
+      {
+        *pRxData = *((__IO uint8_t *)&spix->DR);
+        pRxData += sizeof(uint8_t);
+      }
+      rxcount--;
+    }
+
+    /* Timeout management once per period only */
+    if(--period == 0U)
+    {
+      period = SPI_FAST_TIMEOUT_PERIOD;
+
+      if((Timeout != HAL_MAX_DELAY) && ((HAL_GetTick() - tickstart) >= Timeout))
+      {
+        hspi->ErrorCode = HAL_SPI_ERROR_FLAG;
+        errorcode = HAL_TIMEOUT;
+        break;
+      }
+    }
+  }
+
+#if (USE_SPI_CRC != 0U)
+  if((Crc != 0U) && (errorcode == HAL_OK))
+  {
+    /* Wait for the CRC and read it from DR to close CRC calculation process */
+    while((spix->SR & SPI_FLAG_RXNE) == 0U)
+    {
+      if((Timeout != HAL_MAX_DELAY) && ((HAL_GetTick() - tickstart) >= Timeout))
+      {
+        hspi->ErrorCode = HAL_SPI_ERROR_CRC;
+        errorcode = HAL_TIMEOUT;
+        break;
+      }
+    }
+    if(errorcode == HAL_OK)
+    {
+      (void)spix->DR;
+
+      /* Check if CRC error occurred */
+      if((spix->SR & SPI_FLAG_CRCERR) != 0U)
+      {
+        hspi->ErrorCode = HAL_SPI_ERROR_CRC;
+        /* Clear CRC Flag */
+        spix->SR = (uint16_t)(~SPI_FLAG_CRCERR);
+        errorcode = HAL_ERROR;
+      }
+    }
+  }
+#endif /* USE_SPI_CRC */
+
+  /* Wait for the end of the last data before giving the bus back */
+  while((errorcode != HAL_TIMEOUT) && ((spix->SR & (SPI_FLAG_TXE | SPI_FLAG_BSY)) != SPI_FLAG_TXE))
+  {
+    if((Timeout != HAL_MAX_DELAY) && ((HAL_GetTick() - tickstart) >= Timeout))
+    {
+      SET_BIT(hspi->ErrorCode, HAL_SPI_ERROR_FLAG);
+      errorcode = HAL_TIMEOUT;
+    }
+  }
+
+  if(errorcode != HAL_OK)
+  {
+    /* Clear overrun flag, the data left in DR are not relevant anymore */
+    __HAL_SPI_CLEAR_OVRFLAG(hspi);
+  }
+
+  hspi->State = HAL_SPI_STATE_READY;
+  __HAL_UNLOCK(hspi);
+  return errorcode;
+}
+
+/**
+  * @brief  Transmit and Receive an amount of 8-bit data in blocking mode,
+  *         without CRC, through the polled fast path.
+  * @note   The SPI must have been configured with HAL_SPI_Init() in
+  *         SPI_DIRECTION_2LINES and SPI_DATASIZE_8BIT with the CRC disabled:
+  *         these settings are not checked.
+  * @note   Unlike HAL_SPI_TransmitReceive(), up to two data are in flight, so an
+  *         interrupt delaying the loop by more than one data duration ends the
+  *         transfer with HAL_SPI_ERROR_OVR.
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *               the configuration information for SPI module.
+  * @param  pTxData: pointer to transmission data buffer
+  * @param  pRxData: pointer to reception data buffer
+  * @param  Size: amount of data to be sent and received
+  * @param  Timeout: Timeout duration
+  * @retval HAL status
+  */
+__STATIC_INLINE HAL_StatusTypeDef HAL_SPI_TransmitReceive_Fast8(SPI_HandleTypeDef *hspi, const uint8_t *pTxData,
+                                                                uint8_t *pRxData, uint16_t Size, uint32_t Timeout)
+{
+  return SPI_FastTransmitReceive(hspi, pTxData, pRxData, Size, Timeout, 0U, 0U);
+}
+
+/**
+  * @brief  Transmit and Receive an amount of 16-bit data in blocking mode,
+  *         without CRC, through the polled fast path.
+  * @note   Same conditions as HAL_SPI_TransmitReceive_Fast8() with the SPI
+  *         configured in SPI_DATASIZE_16BIT. The buffers must be 16-bit aligned.
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *               the configuration information for SPI module.
+  * @param  pTxData: pointer to transmission data buffer
+  * @param  pRxData: pointer to reception data buffer
+  * @param  Size: amount of 16-bit data to be sent and received
+  * @param  Timeout: Timeout duration
+  * @retval HAL status
+  */
+__STATIC_INLINE HAL_StatusTypeDef HAL_SPI_TransmitReceive_Fast16(SPI_HandleTypeDef *hspi, const uint8_t *pTxData,
+                                                                 uint8_t *pRxData, uint16_t Size, uint32_t Timeout)
+{
+  return SPI_FastTransmitReceive(hspi, pTxData, pRxData, Size, Timeout, 1U, 0U);
+}
+
+#if (USE_SPI_CRC != 0U)
+/**
+  * @brief  Transmit and Receive an amount of 8-bit data in blocking mode,
+  *         followed by the CRC, through the polled fast path.
+  * @note   Same conditions as HAL_SPI_TransmitReceive_Fast8() with the SPI
+  *         configured with SPI_CRCCALCULATION_ENABLE.
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *               the configuration information for SPI module.
+  * @param  pTxData: pointer to transmission data buffer
+  * @param  pRxData: pointer to reception data buffer
+  * @param  Size: amount of data to be sent and received, CRC excluded
+  * @param  Timeout: Timeout duration
+  * @retval HAL status
+  */
+__STATIC_INLINE HAL_StatusTypeDef HAL_SPI_TransmitReceive_Fast8CRC(SPI_HandleTypeDef *hspi, const uint8_t *pTxData,
+                                                                   uint8_t *pRxData, uint16_t Size, uint32_t Timeout)
+{
+  return SPI_FastTransmitReceive(hspi, pTxData, pRxData, Size, Timeout, 0U, 1U);
+}
+
+/**
+  * @brief  Transmit and Receive an amount of 16-bit data in blocking mode,
+  *         followed by the CRC, through the polled fast path.
+  * @note   Same conditions as HAL_SPI_TransmitReceive_Fast16() with the SPI
+  *         configured with SPI_CRCCALCULATION_ENABLE.
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *               the configuration information for SPI module.
+  * @param  pTxData: pointer to transmission data buffer
+  * @param  pRxData: pointer to reception data buffer
+  * @param  Size: amount of 16-bit data to be sent and received, CRC excluded
+  * @param  Timeout: Timeout duration
+  * @retval HAL status
+  */
+__STATIC_INLINE HAL_StatusTypeDef HAL_SPI_TransmitReceive_Fast16CRC(SPI_HandleTypeDef *hspi, const uint8_t *pTxData,
+                                                                    uint8_t *pRxData, uint16_t Size, uint32_t Timeout)
+{
+  return SPI_FastTransmitReceive(hspi, pTxData, pRxData, Size, Timeout, 1U, 1U);
+}
+#endif /* USE_SPI_CRC */
+/**
+  * @}
+  */
+
 /**
   * @}
   */
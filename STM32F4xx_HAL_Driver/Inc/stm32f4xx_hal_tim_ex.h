@@ -161,6 +161,15 @@ typedef struct
   */
 #endif /* STM32F410Tx || STM32F410Cx || STM32F410Rx || STM32F413xx || STM32F423xx */
 
+/** @defgroup TIMEx_PWMStream_Part  TIM PWM Stream Buffer Part
+  * @{
+  */
+#define TIM_PWMSTREAM_PART_FIRST           0x00000000U /*!< First half of the circular buffer, or first buffer in double-buffer mode   */
+#define TIM_PWMSTREAM_PART_SECOND          0x00000001U /*!< Second half of the circular buffer, or second buffer in double-buffer mode */
+/**
+  * @}
+  */
+
 /**
   * @}
   */
@@ -279,6 +288,18 @@ HAL_TIM_StateTypeDef HAL_TIMEx_HallSensor_GetState(TIM_HandleTypeDef* htim);
   * @}
   */
 
+/** @addtogroup TIMEx_Exported_Functions_Group8
+  * @{
+  */
+/* Extension PWM Stream functions  ********************************************/
+HAL_StatusTypeDef HAL_TIMEx_PWMStream_Start_DMA(TIM_HandleTypeDef* htim, uint32_t BurstBaseAddress, uint32_t BurstLength,
+                                                uint32_t *pBuffer0, uint32_t *pBuffer1, uint16_t FrameCount);
+HAL_StatusTypeDef HAL_TIMEx_PWMStream_Stop_DMA(TIM_HandleTypeDef* htim);
+void HAL_TIMEx_PWMStreamRefillCallback(TIM_HandleTypeDef* htim, uint32_t Part);
+/**
+  * @}
+  */
+
 /**
   * @}
   */
@@ -340,6 +361,16 @@ HAL_TIM_StateTypeDef HAL_TIMEx_HallSensor_GetState(TIM_HandleTypeDef* htim);
 #endif /* STM32F410Tx || STM32F410Cx || STM32F410Rx || STM32F413xx || STM32F423xx */
 
 #define IS_TIM_DEADTIME(DEADTIME)      ((DEADTIME) <= 0xFFU)
+
+#define IS_TIM_PWMSTREAM_BASE(BASE)    (((BASE) == TIM_DMABASE_RCR)  || \
+                                        ((BASE) == TIM_DMABASE_CCR1) || \
+                                        ((BASE) == TIM_DMABASE_CCR2) || \
+                                        ((BASE) == TIM_DMABASE_CCR3) || \
+                                        ((BASE) == TIM_DMABASE_CCR4))
+
+/* The burst must not go beyond the CCR4 register */
+#define IS_TIM_PWMSTREAM_LENGTH(BASE, LENGTH) (IS_TIM_DMA_LENGTH(LENGTH) && \
+                                               (((BASE) + ((LENGTH) >> 8U)) <= TIM_DMABASE_CCR4))
 /**
   * @}
   */
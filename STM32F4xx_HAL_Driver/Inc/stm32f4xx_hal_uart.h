@@ -155,9 +155,42 @@ typedef enum
 }HAL_UART_StateTypeDef;
 
 /**
-  * @brief  UART handle Structure definition
+  * @brief  UART ring buffer structure definition
+  * @note   Head is only written by the producer and Tail only by the consumer, so the
+  *         ring can be accessed from thread context without disabling interrupts.
+  *         The driver is the producer of a reception ring and the consumer of a
+  *         transmission ring.
+  *         Both indexes are free running, the position in pBuffer is (index & Mask).
+  */
+typedef struct
+{
+  uint8_t                       *pBuffer;         /*!< Ring storage, owned by the application              */
+
+  uint32_t                      Mask;             /*!< Ring size minus one, the size is a power of two      */
+
+  __IO uint32_t                 Head;             /*!< Write index, updated by the producer                 */
+
+  __IO uint32_t                 Tail;             /*!< Read index, updated by the consumer                  */
+
+  __IO uint32_t                 Overrun;          /*!< Count of Rx updates that found the reader overtaken  */
+
+}UART_RingTypeDef;
+
+/**
+  * @brief  UART Tx fragment structure definition, one entry of a scatter-gather transmit list
   */
 typedef struct
+{
+  uint8_t                       *pData;           /*!< Pointer to the fragment data                        */
+
+  uint16_t                      Size;             /*!< Amount of data elements (uint8_t or uint16_t) to send */
+
+}UART_TxFragmentTypeDef;
+
+/**
+  * @brief  UART handle Structure definition
+  */
+typedef struct __UART_HandleTypeDef
 {
   USART_TypeDef                 *Instance;        /*!< UART registers base address        */
 
@@ -190,6 +223,17 @@ typedef struct
 
   __IO uint32_t                 ErrorCode;        /*!< UART Error code                    */
 
+  UART_RingTypeDef              *pRxRing;         /*!< Rx ring buffer, only set while a ring reception is ongoing */
+
+  const UART_TxFragmentTypeDef  *pTxFrag;         /*!< Next fragment of an ongoing scatter-gather transmission    */
+
+  __IO uint32_t                 TxFragCount;      /*!< Number of fragments left to chain after the current one    */
+
+  UART_RingTypeDef              *pTxRing;         /*!< Tx ring buffer, only set while a ring transmission is ongoing */
+
+  void (*IRQHandler)(struct __UART_HandleTypeDef *huart); /*!< Lean interrupt handler of the active ring services,
+                                                               NULL when HAL_UART_IRQHandler() serves all the flags */
+
 }UART_HandleTypeDef;
 /**
   * @}
@@ -670,6 +714,24 @@ void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart);
 void HAL_UART_AbortCpltCallback (UART_HandleTypeDef *huart);
 void HAL_UART_AbortTransmitCpltCallback (UART_HandleTypeDef *huart);
 void HAL_UART_AbortReceiveCpltCallback (UART_HandleTypeDef *huart);
+
+/* Scatter-gather transmission functions */
+HAL_StatusTypeDef HAL_UARTEx_TransmitV_DMA(UART_HandleTypeDef *huart, const UART_TxFragmentTypeDef *pFrags, uint32_t NbFrags);
+
+/* Ring buffer reception functions */
+HAL_StatusTypeDef HAL_UARTEx_RingReceive_DMA(UART_HandleTypeDef *huart, UART_RingTypeDef *pRing, uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_UARTEx_RingReceive_IT(UART_HandleTypeDef *huart, UART_RingTypeDef *pRing, uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_UARTEx_RingReceive_Stop(UART_HandleTypeDef *huart);
+void              HAL_UARTEx_RingReceive_Update(UART_HandleTypeDef *huart);
+uint32_t          HAL_UARTEx_Ring_GetCount(UART_RingTypeDef *pRing);
+uint32_t          HAL_UARTEx_Ring_GetData(UART_RingTypeDef *pRing, uint8_t **ppData);
+void              HAL_UARTEx_Ring_Release(UART_RingTypeDef *pRing, uint32_t Count);
+void              HAL_UARTEx_RingRxEventCallback(UART_HandleTypeDef *huart);
+
+/* Ring buffer transmission functions */
+HAL_StatusTypeDef HAL_UARTEx_RingTransmit_IT(UART_HandleTypeDef *huart, UART_RingTypeDef *pRing, uint8_t *pData, uint16_t Size);
+uint32_t          HAL_UARTEx_RingTransmit_Write(UART_HandleTypeDef *huart, const uint8_t *pData, uint32_t Size);
+HAL_StatusTypeDef HAL_UARTEx_RingTransmit_Stop(UART_HandleTypeDef *huart);
 /**
   * @}
   */
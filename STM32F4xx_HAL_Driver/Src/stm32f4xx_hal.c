@@ -110,6 +110,9 @@
   * @{
   */
 __IO uint32_t uwTick;
+#if defined(USE_HAL_PROFILING) && (USE_HAL_PROFILING == 1U)
+static HAL_ProfCounterTypeDef ProfCounters[HAL_PROF_ID_COUNT];
+#endif /* USE_HAL_PROFILING */
 /**
   * @}
   */
@@ -292,6 +295,9 @@ __weak HAL_StatusTypeDef HAL_InitTick(uint32_t TickPriority)
     [..]  This section provides functions allowing to:
       (+) Provide a tick value in millisecond
       (+) Provide a blocking delay in millisecond
+      (+) Provide a blocking delay and a timeout check in microsecond, based on the
+          DWT cycle counter and SystemCoreClock
+      (+) Provide a hook called by the blocking HAL functions while waiting
       (+) Suspend the time base source interrupt
       (+) Resume the time base source interrupt
       (+) Get the HAL API driver version
@@ -314,7 +320,7 @@ __weak HAL_StatusTypeDef HAL_InitTick(uint32_t TickPriority)
   *      implementations in user file.
   * @retval None
   */
-__weak void HAL_IncTick(void)
+__weak __HOT_RAM_FUNC void HAL_IncTick(void)
 {
   uwTick++;
 }
@@ -330,6 +336,29 @@ __weak uint32_t HAL_GetTick(void)
   return uwTick;
 }
 
+/**
+  * @brief Wait hook, called in the polling loops of the blocking HAL functions
+  *        (HAL_Delay, UART, I2C and SPI flag waits, FLASH operations).
+  * @note The default implementation does nothing, the wait is an active polling.
+  *       An application can override it to yield to an RTOS or a scheduler, or
+  *       to execute __WFE() when an interrupt is expected to end the wait.
+  * @note The hook must return quickly compared to the timeout of the caller and
+  *       must not call the HAL function it is called from for the same handle.
+  *       For HAL_WAIT_FLASH, it must not access the FLASH bank being programmed
+  *       or erased.
+  * @note This function is declared as __weak to be overwritten in case of other
+  *       implementations in user file.
+  * @param Reason: wait reason, a value of @ref HAL_WaitReasonTypeDef.
+  * @param Handle: handle of the peripheral waited for, NULL if none.
+  * @retval None
+  */
+__weak void HAL_WaitHook(HAL_WaitReasonTypeDef Reason, const void *Handle)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(Reason);
+  UNUSED(Handle);
+}
+
 /**
   * @brief This function provides minimum delay (in milliseconds) based
   *        on variable incremented.
@@ -354,7 +383,94 @@ __weak void HAL_Delay(__IO uint32_t Delay)
 
   while((HAL_GetTick() - tickstart) < wait)
   {
+    /* Let the application yield or sleep while waiting */
+    HAL_WaitHook(HAL_WAIT_DELAY, NULL);
+  }
+}
+
+/**
+  * @brief This function provides a delay (in microseconds) based on the DWT cycle
+  *        counter.
+  * @note Unlike HAL_Delay(), the wait does not depend on the time base: it can be used
+  *       with interrupts disabled and its length is exact to a few CPU cycles. It
+  *       relies on SystemCoreClock being up to date.
+  * @note The DWT cycle counter is started if not already done by a debugger.
+  * @param DelayUs: specifies the delay time length, in microseconds.
+  * @retval None
+  */
+void HAL_DelayUs(uint32_t DelayUs)
+{
+  uint64_t remaining = (uint64_t)DelayUs * (SystemCoreClock / 1000000U);
+  uint32_t start = HAL_GetCycleCount();
+  uint32_t now;
+  uint32_t elapsed;
+
+  /* Consume the elapsed cycles step by step, so that delays longer than the
+     cycle counter period are supported */
+  while(remaining != 0U)
+  {
+    now = DWT->CYCCNT;
+    elapsed = now - start;
+    start = now;
+    if(elapsed >= remaining)
+    {
+      remaining = 0U;
+    }
+    else
+    {
+      remaining -= elapsed;
+    }
+  }
+}
+
+/**
+  * @brief Returns the DWT cycle counter, to be passed to HAL_TimeoutUs().
+  * @note The DWT cycle counter is started if not already done by a debugger.
+  * @retval Cycle counter value
+  */
+uint32_t HAL_GetCycleCount(void)
+{
+  /* Enable the DWT cycle counter if not already done by a debugger */
+  if((DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk) == 0U)
+  {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0U;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
   }
+
+  return DWT->CYCCNT;
+}
+
+/**
+  * @brief Checks if a timeout (in microseconds) is elapsed.
+  * @note Typical use in a polling loop:
+  *       start = HAL_GetCycleCount();
+  *       while(flag not set) { if(HAL_TimeoutUs(start, Timeout) != HAL_OK) { ... } }
+  * @note The timeout is limited to the cycle counter period, i.e. 0xFFFFFFFF divided
+  *       by SystemCoreClock (23 seconds at 180 MHz). Longer timeouts are clamped.
+  * @param StartCycle: cycle counter returned by HAL_GetCycleCount() at the start of
+  *        the wait.
+  * @param TimeoutUs: specifies the timeout length, in microseconds.
+  * @retval HAL status
+  *          HAL_OK      timeout not elapsed
+  *          HAL_TIMEOUT timeout elapsed
+  */
+HAL_StatusTypeDef HAL_TimeoutUs(uint32_t StartCycle, uint32_t TimeoutUs)
+{
+  uint64_t timeout = (uint64_t)TimeoutUs * (SystemCoreClock / 1000000U);
+  HAL_StatusTypeDef status = HAL_OK;
+
+  if(timeout > 0xFFFFFFFFU)
+  {
+    timeout = 0xFFFFFFFFU;
+  }
+
+  if((DWT->CYCCNT - StartCycle) >= (uint32_t)timeout)
+  {
+    status = HAL_TIMEOUT;
+  }
+
+  return status;
 }
 
 /**
@@ -541,6 +657,131 @@ void HAL_DisableMemorySwappingBank(void)
   * @}
   */
 
+#if defined(USE_HAL_PROFILING) && (USE_HAL_PROFILING == 1U)
+/** @defgroup HAL_Exported_Functions_Group3 HAL Profiling functions
+ *  @brief    HAL Profiling functions
+ *
+@verbatim
+ ===============================================================================
+                      ##### HAL Profiling functions #####
+ ===============================================================================
+    [..]  When USE_HAL_PROFILING is set to 1U in the HAL configuration file, the main
+          HAL interrupt handlers measure their duration with the DWT cycle counter:
+      (+) Call HAL_PROF_Init() once to start the DWT cycle counter and clear the counters
+      (+) Read the calls count and the total, min and max durations of an instrumented
+          function with HAL_PROF_GetCounter()
+      (+) Instrument application functions with __HAL_PROF_ENTER()/__HAL_PROF_EXIT()
+          and identifiers from HAL_PROF_ID_USER
+      (+) When USE_HAL_PROFILING_ITM is also set to 1U, each call is sent as an event on
+          the HAL_PROF_ITM_PORT ITM stimulus port, if enabled by the debugger or the
+          application, for a trace of the interrupt activity over SWO
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Start the DWT cycle counter and clear the profiling counters.
+  * @retval None
+  */
+void HAL_PROF_Init(void)
+{
+  /* Enable the DWT cycle counter if not already done by a debugger */
+  (void)HAL_GetCycleCount();
+
+  HAL_PROF_Reset();
+}
+
+/**
+  * @brief  Clear the profiling counters.
+  * @retval None
+  */
+void HAL_PROF_Reset(void)
+{
+  uint32_t id;
+  uint32_t primask_bit = __get_PRIMASK();
+
+  __disable_irq();
+  for(id = 0U; id < HAL_PROF_ID_COUNT; id++)
+  {
+    ProfCounters[id].Calls = 0U;
+    ProfCounters[id].TotalCycles = 0U;
+    ProfCounters[id].MinCycles = 0xFFFFFFFFU;
+    ProfCounters[id].MaxCycles = 0U;
+  }
+  __set_PRIMASK(primask_bit);
+}
+
+/**
+  * @brief  Record the end of a call of a profiled function.
+  * @note   Called by __HAL_PROF_EXIT(), from thread or interrupt context.
+  * @param  Id: identifier of the function, a value of @ref HAL_Profiling_Id.
+  * @param  StartCycle: DWT cycle counter at the function entry.
+  * @retval None
+  */
+__HOT_RAM_FUNC void HAL_PROF_Record(uint32_t Id, uint32_t StartCycle)
+{
+  uint32_t primask_bit;
+  uint32_t cycles = DWT->CYCCNT - StartCycle;
+  HAL_ProfCounterTypeDef *counter;
+
+  if(Id >= HAL_PROF_ID_COUNT)
+  {
+    return;
+  }
+  counter = &ProfCounters[Id];
+
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  counter->Calls++;
+  counter->TotalCycles += cycles;
+  if(cycles < counter->MinCycles)
+  {
+    counter->MinCycles = cycles;
+  }
+  if(cycles > counter->MaxCycles)
+  {
+    counter->MaxCycles = cycles;
+  }
+
+#if defined(USE_HAL_PROFILING_ITM) && (USE_HAL_PROFILING_ITM == 1U)
+  /* Send the event only when the trace and the stimulus port are enabled */
+  if(((ITM->TCR & ITM_TCR_ITMENA_Msk) != 0U) && ((ITM->TER & (1UL << HAL_PROF_ITM_PORT)) != 0U))
+  {
+    if(cycles > 0x00FFFFFFU)
+    {
+      cycles = 0x00FFFFFFU;
+    }
+    while(ITM->PORT[HAL_PROF_ITM_PORT].u32 == 0U)
+    {
+    }
+    ITM->PORT[HAL_PROF_ITM_PORT].u32 = (Id << 24U) | cycles;
+  }
+#endif /* USE_HAL_PROFILING_ITM */
+
+  __set_PRIMASK(primask_bit);
+}
+
+/**
+  * @brief  Return the profiling counter of a function.
+  * @param  Id: identifier of the function, a value of @ref HAL_Profiling_Id.
+  * @retval Pointer to the counter, NULL if the identifier is invalid
+  */
+const HAL_ProfCounterTypeDef *HAL_PROF_GetCounter(uint32_t Id)
+{
+  if(Id >= HAL_PROF_ID_COUNT)
+  {
+    return NULL;
+  }
+  return &ProfCounters[Id];
+}
+
+/**
+  * @}
+  */
+#endif /* USE_HAL_PROFILING */
+
 /**
   * @}
   */
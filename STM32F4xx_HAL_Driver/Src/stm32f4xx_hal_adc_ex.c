@@ -81,6 +81,18 @@
            of data to be transferred at each end of conversion
        (+) Read the ADCs converted values using the HAL_ADCEx_MultiModeGetValue() function.
 
+     *** Interleaved capture ***
+     ===========================
+     [..]
+       (+) Configure ADC1 and ADC2, or ADC1, ADC2 and ADC3, to sample one channel in turn
+           with HAL_ADCEx_InterleavedConfig(): the ADC clock prescaler, the sampling time
+           and the delay between 2 sampling phases are chosen to reach the requested
+           combined sample rate, and the rate effectively achieved is returned.
+       (+) Start the capture with HAL_ADCEx_InterleavedStart_DMA(): the DMA of the master
+           ADC transfers the conversions of 2 ADCs in each 32-bit word, the buffer read
+           as half-words holds the samples in time order.
+       (+) Stop the capture with HAL_ADCEx_InterleavedStop_DMA().
+
 
     @endverbatim
   ******************************************************************************
@@ -161,8 +173,10 @@ static void ADC_MultiModeDMAHalfConvCplt(DMA_HandleTypeDef *hdma);
       (+) Stop multimode and disable DMA transfer.
       (+) Get result of injected channel conversion.
       (+) Get result of multimode conversion.
+      (+) Start and stop interleaved capture.
       (+) Configure injected channels.
       (+) Configure multimode.
+      (+) Configure interleaved capture.
 
 @endverbatim
   * @{
@@ -176,7 +190,6 @@ static void ADC_MultiModeDMAHalfConvCplt(DMA_HandleTypeDef *hdma);
   */
 HAL_StatusTypeDef HAL_ADCEx_InjectedStart(ADC_HandleTypeDef* hadc)
 {
-  __IO uint32_t counter = 0U;
   uint32_t tmp1 = 0U, tmp2 = 0U;
   ADC_Common_TypeDef *tmpADC_Common;
 
@@ -193,12 +206,7 @@ HAL_StatusTypeDef HAL_ADCEx_InjectedStart(ADC_HandleTypeDef* hadc)
     __HAL_ADC_ENABLE(hadc);
 
     /* Delay for ADC stabilization time */
-    /* Compute number of CPU cycles to wait for */
-    counter = (ADC_STAB_DELAY_US * (SystemCoreClock / 1000000U));
-    while(counter != 0U)
-    {
-      counter--;
-    }
+    HAL_DelayUs(ADC_STAB_DELAY_US);
   }
 
   /* Start conversion if ADC is effectively enabled */
@@ -271,7 +279,6 @@ HAL_StatusTypeDef HAL_ADCEx_InjectedStart(ADC_HandleTypeDef* hadc)
   */
 HAL_StatusTypeDef HAL_ADCEx_InjectedStart_IT(ADC_HandleTypeDef* hadc)
 {
-  __IO uint32_t counter = 0U;
   uint32_t tmp1 = 0U, tmp2 = 0U;
   ADC_Common_TypeDef *tmpADC_Common;
 
@@ -288,12 +295,7 @@ HAL_StatusTypeDef HAL_ADCEx_InjectedStart_IT(ADC_HandleTypeDef* hadc)
     __HAL_ADC_ENABLE(hadc);
 
     /* Delay for ADC stabilization time */
-    /* Compute number of CPU cycles to wait for */
-    counter = (ADC_STAB_DELAY_US * (SystemCoreClock / 1000000U));
-    while(counter != 0U)
-    {
-      counter--;
-    }
+    HAL_DelayUs(ADC_STAB_DELAY_US);
   }
 
   /* Start conversion if ADC is effectively enabled */
@@ -608,7 +610,6 @@ uint32_t HAL_ADCEx_InjectedGetValue(ADC_HandleTypeDef* hadc, uint32_t InjectedRa
   */
 HAL_StatusTypeDef HAL_ADCEx_MultiModeStart_DMA(ADC_HandleTypeDef* hadc, uint32_t* pData, uint32_t Length)
 {
-  __IO uint32_t counter = 0U;
   ADC_Common_TypeDef *tmpADC_Common;
 
   /* Check the parameters */
@@ -627,12 +628,7 @@ HAL_StatusTypeDef HAL_ADCEx_MultiModeStart_DMA(ADC_HandleTypeDef* hadc, uint32_t
     __HAL_ADC_ENABLE(hadc);
 
     /* Delay for temperature sensor stabilization time */
-    /* Compute number of CPU cycles to wait for */
-    counter = (ADC_STAB_DELAY_US * (SystemCoreClock / 1000000U));
-    while(counter != 0U)
-    {
-      counter--;
-    }
+    HAL_DelayUs(ADC_STAB_DELAY_US);
   }
 
   /* Start conversion if ADC is effectively enabled */
@@ -791,6 +787,66 @@ uint32_t HAL_ADCEx_MultiModeGetValue(ADC_HandleTypeDef* hadc)
   return tmpADC_Common->CDR;
 }
 
+/**
+  * @brief  Enables the slave ADCs and starts the interleaved capture configured with
+  *         HAL_ADCEx_InterleavedConfig().
+  * @note   The DMA of the master ADC must be configured with a word data alignment on
+  *         both peripheral and memory sides, each word holds 2 conversions.
+  * @param  hadcMaster: pointer to the ADC1 handle.
+  * @param  hadcSlave1: pointer to the ADC2 handle.
+  * @param  hadcSlave2: pointer to the ADC3 handle in triple mode, NULL in dual mode.
+  * @param  pData:      Pointer to the buffer receiving the conversions.
+  * @param  Length:     Number of 32-bit words to be transferred.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ADCEx_InterleavedStart_DMA(ADC_HandleTypeDef* hadcMaster, ADC_HandleTypeDef* hadcSlave1, ADC_HandleTypeDef* hadcSlave2, uint32_t* pData, uint32_t Length)
+{
+
+  if((hadcMaster == NULL) || (hadcSlave1 == NULL) || (pData == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  /* The slaves are started by the master, they only need to be enabled */
+  __HAL_ADC_ENABLE(hadcSlave1);
+  if(hadcSlave2 != NULL)
+  {
+    __HAL_ADC_ENABLE(hadcSlave2);
+  }
+
+  /* Delay for ADC stabilization time */
+  HAL_DelayUs(ADC_STAB_DELAY_US);
+
+  return HAL_ADCEx_MultiModeStart_DMA(hadcMaster, pData, Length);
+}
+
+/**
+  * @brief  Stops the interleaved capture and disables all the ADCs.
+  * @param  hadcMaster: pointer to the ADC1 handle.
+  * @param  hadcSlave1: pointer to the ADC2 handle.
+  * @param  hadcSlave2: pointer to the ADC3 handle in triple mode, NULL in dual mode.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ADCEx_InterleavedStop_DMA(ADC_HandleTypeDef* hadcMaster, ADC_HandleTypeDef* hadcSlave1, ADC_HandleTypeDef* hadcSlave2)
+{
+  HAL_StatusTypeDef tmp_hal_status;
+
+  if((hadcMaster == NULL) || (hadcSlave1 == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  tmp_hal_status = HAL_ADCEx_MultiModeStop_DMA(hadcMaster);
+
+  __HAL_ADC_DISABLE(hadcSlave1);
+  if(hadcSlave2 != NULL)
+  {
+    __HAL_ADC_DISABLE(hadcSlave2);
+  }
+
+  return tmp_hal_status;
+}
+
 /**
   * @brief  Injected conversion complete callback in non blocking mode
   * @param  hadc: pointer to a ADC_HandleTypeDef structure that contains
@@ -1015,6 +1071,170 @@ HAL_StatusTypeDef HAL_ADCEx_MultiModeConfigChannel(ADC_HandleTypeDef* hadc, ADC_
   return HAL_OK;
 }
 
+/**
+  * @brief  Configures 2 or 3 ADCs in interleaved mode on one channel, for a combined
+  *         sample rate of at least sConfig->SampleRate.
+  * @note   The ADCs convert continuously, each one restarting every N x DELAY ADC
+  *         clock cycles, N being the number of ADCs, or after its own conversion time if
+  *         longer. Among the ADC clock prescalers giving at most 36 MHz from PCLK2 and the
+  *         sampling times shorter than the delay (the ADCs must not sample the channel at
+  *         the same time), the setting giving the lowest rate above the requested one is
+  *         selected. The delay is rounded up so that the samples are evenly spaced.
+  * @note   The ADC clock prescaler is common to all the ADCs. The conversions are
+  *         transferred 2 by 2 in 32-bit words (DMA access mode 2). The F4 ADC needs no
+  *         calibration.
+  * @note   This function must be called while the ADCs are stopped.
+  * @param  hadcMaster: pointer to the ADC1 handle.
+  * @param  hadcSlave1: pointer to the ADC2 handle.
+  * @param  hadcSlave2: pointer to the ADC3 handle in triple mode, NULL in dual mode.
+  * @param  sConfig:    pointer to an ADC_InterleavedConfTypeDef structure.
+  * @param  pEffectiveRate: Filled with the combined sample rate achieved, or reachable
+  *                     at most when HAL_ERROR is returned. Can be NULL.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ADCEx_InterleavedConfig(ADC_HandleTypeDef* hadcMaster, ADC_HandleTypeDef* hadcSlave1, ADC_HandleTypeDef* hadcSlave2, ADC_InterleavedConfTypeDef* sConfig, uint32_t* pEffectiveRate)
+{
+  static const uint32_t prescalers[4] = {ADC_CLOCK_SYNC_PCLK_DIV2, ADC_CLOCK_SYNC_PCLK_DIV4,
+                                         ADC_CLOCK_SYNC_PCLK_DIV6, ADC_CLOCK_SYNC_PCLK_DIV8};
+  static const uint32_t samplingtimes[2] = {ADC_SAMPLETIME_15CYCLES, ADC_SAMPLETIME_3CYCLES};
+  static const uint32_t samplingcycles[2] = {15U, 3U};
+  ADC_HandleTypeDef* hadc[3];
+  ADC_ChannelConfTypeDef sChannel;
+  ADC_MultiModeTypeDef multimode;
+  HAL_StatusTypeDef tmp_hal_status = HAL_OK;
+  uint32_t nbadc, resbits, fadc, tconv, delay, period, rate;
+  uint32_t best_rate = 0U, best_presc = 0U, best_smp = 0U, best_delay = 0U;
+  uint32_t max_rate = 0U;
+  uint32_t i, j;
+
+  /* Check the parameters */
+  assert_param(IS_ADC_INTERLEAVED_MODE(sConfig->Mode));
+  assert_param(IS_ADC_RESOLUTION(sConfig->Resolution));
+  assert_param(IS_ADC_CHANNEL(sConfig->Channel));
+
+  nbadc = (sConfig->Mode == ADC_TRIPLEMODE_INTERL) ? 3U : 2U;
+  if((hadcMaster == NULL) || (hadcSlave1 == NULL) || ((nbadc == 3U) && (hadcSlave2 == NULL)))
+  {
+    return HAL_ERROR;
+  }
+  hadc[0] = hadcMaster;
+  hadc[1] = hadcSlave1;
+  hadc[2] = hadcSlave2;
+
+  /* Successive approximation time, in ADC clock cycles */
+  switch(sConfig->Resolution)
+  {
+    case ADC_RESOLUTION_10B:
+      resbits = 10U;
+      break;
+    case ADC_RESOLUTION_8B:
+      resbits = 8U;
+      break;
+    case ADC_RESOLUTION_6B:
+      resbits = 6U;
+      break;
+    default:
+      resbits = 12U;
+      break;
+  }
+
+  for(i = 0U; i < 4U; i++)
+  {
+    fadc = HAL_RCC_GetPCLK2Freq() / (2U * (i + 1U));
+    if(fadc > ADC_INTERLEAVED_CLOCK_MAX)
+    {
+      continue;
+    }
+
+    for(j = 0U; j < 2U; j++)
+    {
+      tconv = samplingcycles[j] + resbits;
+
+      /* Evenly spaced samples, without overlap of the sampling phases */
+      delay = (tconv + nbadc - 1U) / nbadc;
+      if(delay < ADC_INTERLEAVED_DELAY_MIN)
+      {
+        delay = ADC_INTERLEAVED_DELAY_MIN;
+      }
+      if(delay <= samplingcycles[j])
+      {
+        delay = samplingcycles[j] + 1U;
+      }
+      if(delay > ADC_INTERLEAVED_DELAY_MAX)
+      {
+        continue;
+      }
+
+      period = ((nbadc * delay) > tconv) ? (nbadc * delay) : tconv;
+      rate = (nbadc * fadc) / period;
+
+      if(rate > max_rate)
+      {
+        max_rate = rate;
+      }
+      if((rate >= sConfig->SampleRate) && ((best_rate == 0U) || (rate < best_rate)))
+      {
+        best_rate = rate;
+        best_presc = prescalers[i];
+        best_smp = samplingtimes[j];
+        best_delay = delay;
+      }
+    }
+  }
+
+  if(best_rate == 0U)
+  {
+    if(pEffectiveRate != NULL)
+    {
+      *pEffectiveRate = max_rate;
+    }
+    return HAL_ERROR;
+  }
+
+  sChannel.Channel = sConfig->Channel;
+  sChannel.Rank = 1U;
+  sChannel.SamplingTime = best_smp;
+  sChannel.Offset = 0U;
+
+  for(i = 0U; (i < nbadc) && (tmp_hal_status == HAL_OK); i++)
+  {
+    hadc[i]->Init.ClockPrescaler = best_presc;
+    hadc[i]->Init.Resolution = sConfig->Resolution;
+    hadc[i]->Init.DataAlign = ADC_DATAALIGN_RIGHT;
+    hadc[i]->Init.ScanConvMode = DISABLE;
+    hadc[i]->Init.EOCSelection = ADC_EOC_SINGLE_CONV;
+    hadc[i]->Init.ContinuousConvMode = ENABLE;
+    hadc[i]->Init.NbrOfConversion = 1U;
+    hadc[i]->Init.DiscontinuousConvMode = DISABLE;
+    hadc[i]->Init.NbrOfDiscConversion = 0U;
+    hadc[i]->Init.ExternalTrigConv = ADC_SOFTWARE_START;
+    hadc[i]->Init.ExternalTrigConvEdge = ADC_EXTERNALTRIGCONVEDGE_NONE;
+    hadc[i]->Init.DMAContinuousRequests = (i == 0U) ? ENABLE : DISABLE;
+
+    tmp_hal_status = HAL_ADC_Init(hadc[i]);
+    if(tmp_hal_status == HAL_OK)
+    {
+      tmp_hal_status = HAL_ADC_ConfigChannel(hadc[i], &sChannel);
+    }
+  }
+
+  if(tmp_hal_status == HAL_OK)
+  {
+    multimode.Mode = sConfig->Mode;
+    multimode.DMAAccessMode = ADC_DMAACCESSMODE_2;
+    multimode.TwoSamplingDelay = (best_delay - ADC_INTERLEAVED_DELAY_MIN) << ADC_CCR_DELAY_Pos;
+    tmp_hal_status = HAL_ADCEx_MultiModeConfigChannel(hadcMaster, &multimode);
+  }
+
+  if(pEffectiveRate != NULL)
+  {
+    *pEffectiveRate = best_rate;
+  }
+
+  /* Return function status */
+  return tmp_hal_status;
+}
+
 /**
   * @}
   */
@@ -0,0 +1,488 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_hal_benchmark_template.c
+  * @author  MCD Application Team
+  * @brief   HAL micro-benchmarks template.
+  *
+  *          This file measures the HAL hot paths on target:
+  *           + GPIO toggle rate
+  *           + UART, SPI and I2C transmission in polling, interrupt and DMA modes
+  *           + SD card block read and write
+  *           + FLASH sector erase and word programming
+  *           + CRC, HASH and CRYP throughput
+  *           + DMA memory to memory copy, compared with the CPU memcpy
+  *          Each result is reported as one machine-readable record.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2017 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+ @verbatim
+  ==============================================================================
+                        ##### How to use this driver #####
+  ==============================================================================
+    [..]
+    This file must be copied to the application folder and modified as follows:
+    (#) Rename it to 'stm32f4xx_hal_benchmark.c'
+    (#) Set the BENCH_xxx defines of the "Benchmark configuration" section to the
+        handles and resources of the application, initialized before BENCH_Run()
+        is called. Comment out a define to skip the corresponding benchmarks.
+        The benchmarks of a peripheral are also skipped when its HAL module is
+        not enabled in stm32f4xx_hal_conf.h.
+    (#) Call BENCH_Run() after the clock configuration. The interrupt and DMA
+        benchmarks need the IRQ handlers of the peripherals to be in place.
+    (#) Each result is passed to BENCH_Report(). Its default implementation prints
+        one record per line on the standard output:
+        BENCH,<name>,<iterations>,<bytes>,<cycles>,<bytes per second>,<HAL status>
+        It can be overridden to store or send the results differently.
+
+    [..]
+    (@) The FLASH benchmark erases BENCH_FLASH_SECTOR, which must not hold code or data.
+    (@) The SD benchmark overwrites block BENCH_SD_BLOCK of the card.
+    (@) The cycles are measured with the DWT cycle counter, enabled by BENCH_Run().
+
+  @endverbatim
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_hal.h"
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+/**
+  * @brief  Benchmark result record
+  */
+typedef struct
+{
+  const char        *Name;        /*!< Benchmark name                                 */
+  uint32_t          Iterations;   /*!< Number of operations measured                  */
+  uint32_t          Bytes;        /*!< Bytes processed by all the operations, or 0    */
+  uint32_t          Cycles;       /*!< CPU cycles spent by all the operations         */
+  uint32_t          BytesPerSec;  /*!< Throughput computed from SystemCoreClock, or 0 */
+  HAL_StatusTypeDef Status;       /*!< Status of the last HAL call                    */
+} BENCH_ResultTypeDef;
+
+/* Private define ------------------------------------------------------------*/
+/* Benchmark configuration ---------------------------------------------------*/
+#define BENCH_BUFFER_SIZE     512U                /* Bytes per transfer, one SD block   */
+#define BENCH_TIMEOUT         1000U               /* Timeout of each HAL call in ms     */
+#define BENCH_GPIO_TOGGLES    1000U               /* Number of GPIO toggles             */
+
+#define BENCH_GPIO_PORT       GPIOA               /* Output pin toggled                 */
+#define BENCH_GPIO_PIN        GPIO_PIN_5
+#define BENCH_UART            huart2              /* UART handle of the application     */
+#define BENCH_SPI             hspi1               /* SPI master handle                  */
+#define BENCH_I2C             hi2c1               /* I2C master handle                  */
+#define BENCH_I2C_ADDRESS     0xA0U               /* Address of a device ACKing writes  */
+#define BENCH_SD              hsd                 /* SD handle, card initialized        */
+#define BENCH_SD_BLOCK        1024U               /* SD block overwritten               */
+#define BENCH_FLASH_SECTOR    FLASH_SECTOR_11     /* FLASH sector erased and programmed */
+#define BENCH_FLASH_ADDRESS   0x080E0000U         /* Start address of BENCH_FLASH_SECTOR */
+#define BENCH_CRC             hcrc                /* CRC handle                         */
+#define BENCH_HASH            hhash               /* HASH handle                        */
+#define BENCH_CRYP            hcryp               /* CRYP handle, AES-128 key set       */
+#define BENCH_DMA_M2M         hdma_memtomem       /* DMA2 stream in memory to memory mode */
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+#if defined(HAL_UART_MODULE_ENABLED) && defined(BENCH_UART)
+extern UART_HandleTypeDef BENCH_UART;
+#endif
+#if defined(HAL_SPI_MODULE_ENABLED) && defined(BENCH_SPI)
+extern SPI_HandleTypeDef BENCH_SPI;
+#endif
+#if defined(HAL_I2C_MODULE_ENABLED) && defined(BENCH_I2C)
+extern I2C_HandleTypeDef BENCH_I2C;
+#endif
+#if defined(HAL_SD_MODULE_ENABLED) && defined(BENCH_SD)
+extern SD_HandleTypeDef BENCH_SD;
+#endif
+#if defined(HAL_CRC_MODULE_ENABLED) && defined(BENCH_CRC)
+extern CRC_HandleTypeDef BENCH_CRC;
+#endif
+#if defined(HAL_HASH_MODULE_ENABLED) && defined(HASH) && defined(BENCH_HASH)
+extern HASH_HandleTypeDef BENCH_HASH;
+#endif
+#if defined(HAL_CRYP_MODULE_ENABLED) && defined(CRYP) && defined(BENCH_CRYP)
+extern CRYP_HandleTypeDef BENCH_CRYP;
+#endif
+#if defined(HAL_DMA_MODULE_ENABLED) && defined(BENCH_DMA_M2M)
+extern DMA_HandleTypeDef BENCH_DMA_M2M;
+#endif
+
+static uint32_t BenchSrc[BENCH_BUFFER_SIZE / 4U];
+static uint32_t BenchDst[BENCH_BUFFER_SIZE / 4U];
+
+/* Private function prototypes -----------------------------------------------*/
+void BENCH_Run(void);
+void BENCH_Report(const BENCH_ResultTypeDef *pResult);
+static void BENCH_Record(const char *Name, uint32_t Iterations, uint32_t Bytes, uint32_t StartCycle,
+                         HAL_StatusTypeDef Status);
+#if defined(HAL_UART_MODULE_ENABLED) && defined(BENCH_UART)
+static void BENCH_Uart(void);
+#endif
+#if defined(HAL_SPI_MODULE_ENABLED) && defined(BENCH_SPI)
+static void BENCH_Spi(void);
+#endif
+#if defined(HAL_I2C_MODULE_ENABLED) && defined(BENCH_I2C)
+static void BENCH_I2c(void);
+#endif
+#if defined(HAL_SD_MODULE_ENABLED) && defined(BENCH_SD)
+static void BENCH_Sd(void);
+#endif
+#if defined(HAL_FLASH_MODULE_ENABLED) && defined(BENCH_FLASH_SECTOR)
+static void BENCH_Flash(void);
+#endif
+static void BENCH_Crypto(void);
+static void BENCH_Memcpy(void);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Run all the configured benchmarks.
+  * @retval None
+  */
+void BENCH_Run(void)
+{
+  uint32_t i;
+  uint32_t start;
+
+  /* Enable the DWT cycle counter if not already done by a debugger */
+  if((DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk) == 0U)
+  {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0U;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+  }
+
+  for(i = 0U; i < (BENCH_BUFFER_SIZE / 4U); i++)
+  {
+    BenchSrc[i] = 0x9E3779B9U * (i + 1U);
+  }
+
+#if defined(BENCH_GPIO_PORT)
+  /* GPIO toggle rate: one record of BENCH_GPIO_TOGGLES toggles through the HAL */
+  start = DWT->CYCCNT;
+  for(i = 0U; i < BENCH_GPIO_TOGGLES; i++)
+  {
+    HAL_GPIO_TogglePin(BENCH_GPIO_PORT, BENCH_GPIO_PIN);
+  }
+  BENCH_Record("gpio_toggle", BENCH_GPIO_TOGGLES, 0U, start, HAL_OK);
+#endif
+
+#if defined(HAL_UART_MODULE_ENABLED) && defined(BENCH_UART)
+  BENCH_Uart();
+#endif
+#if defined(HAL_SPI_MODULE_ENABLED) && defined(BENCH_SPI)
+  BENCH_Spi();
+#endif
+#if defined(HAL_I2C_MODULE_ENABLED) && defined(BENCH_I2C)
+  BENCH_I2c();
+#endif
+#if defined(HAL_SD_MODULE_ENABLED) && defined(BENCH_SD)
+  BENCH_Sd();
+#endif
+#if defined(HAL_FLASH_MODULE_ENABLED) && defined(BENCH_FLASH_SECTOR)
+  BENCH_Flash();
+#endif
+  BENCH_Crypto();
+  BENCH_Memcpy();
+
+  /* Avoid unused variable warning when no benchmark uses them */
+  UNUSED(start);
+}
+
+/**
+  * @brief  Report a benchmark result.
+  * @note   This function is declared as __weak to be overwritten in case of other
+  *         implementations in user file.
+  * @param  pResult Result record
+  * @retval None
+  */
+__weak void BENCH_Report(const BENCH_ResultTypeDef *pResult)
+{
+  printf("BENCH,%s,%lu,%lu,%lu,%lu,%u\n", pResult->Name, (unsigned long)pResult->Iterations,
+         (unsigned long)pResult->Bytes, (unsigned long)pResult->Cycles,
+         (unsigned long)pResult->BytesPerSec, (unsigned int)pResult->Status);
+}
+
+/**
+  * @brief  Build a result record from the cycles elapsed since StartCycle and report it.
+  * @param  Name Benchmark name
+  * @param  Iterations Number of operations measured
+  * @param  Bytes Bytes processed, 0 if not relevant
+  * @param  StartCycle DWT cycle counter before the first operation
+  * @param  Status Status of the last HAL call
+  * @retval None
+  */
+static void BENCH_Record(const char *Name, uint32_t Iterations, uint32_t Bytes, uint32_t StartCycle,
+                         HAL_StatusTypeDef Status)
+{
+  BENCH_ResultTypeDef result;
+
+  result.Cycles = DWT->CYCCNT - StartCycle;
+  result.Name = Name;
+  result.Iterations = Iterations;
+  result.Bytes = Bytes;
+  result.Status = Status;
+  result.BytesPerSec = 0U;
+  if((Bytes != 0U) && (result.Cycles != 0U))
+  {
+    result.BytesPerSec = (uint32_t)(((uint64_t)Bytes * SystemCoreClock) / result.Cycles);
+  }
+
+  BENCH_Report(&result);
+}
+
+#if defined(HAL_UART_MODULE_ENABLED) && defined(BENCH_UART)
+/**
+  * @brief  UART transmission in polling, interrupt and DMA modes.
+  * @retval None
+  */
+static void BENCH_Uart(void)
+{
+  HAL_StatusTypeDef status;
+  uint32_t start;
+
+  start = DWT->CYCCNT;
+  status = HAL_UART_Transmit(&BENCH_UART, (uint8_t *)BenchSrc, BENCH_BUFFER_SIZE, BENCH_TIMEOUT);
+  BENCH_Record("uart_tx_poll", 1U, BENCH_BUFFER_SIZE, start, status);
+
+  start = DWT->CYCCNT;
+  status = HAL_UART_Transmit_IT(&BENCH_UART, (uint8_t *)BenchSrc, BENCH_BUFFER_SIZE);
+  while((status == HAL_OK) && (BENCH_UART.gState != HAL_UART_STATE_READY))
+  {
+  }
+  BENCH_Record("uart_tx_it", 1U, BENCH_BUFFER_SIZE, start, status);
+
+  if(BENCH_UART.hdmatx != NULL)
+  {
+    start = DWT->CYCCNT;
+    status = HAL_UART_Transmit_DMA(&BENCH_UART, (uint8_t *)BenchSrc, BENCH_BUFFER_SIZE);
+    while((status == HAL_OK) && (BENCH_UART.gState != HAL_UART_STATE_READY))
+    {
+    }
+    BENCH_Record("uart_tx_dma", 1U, BENCH_BUFFER_SIZE, start, status);
+  }
+}
+#endif /* HAL_UART_MODULE_ENABLED && BENCH_UART */
+
+#if defined(HAL_SPI_MODULE_ENABLED) && defined(BENCH_SPI)
+/**
+  * @brief  SPI full duplex transfer in polling, interrupt and DMA modes.
+  * @retval None
+  */
+static void BENCH_Spi(void)
+{
+  HAL_StatusTypeDef status;
+  uint32_t start;
+
+  start = DWT->CYCCNT;
+  status = HAL_SPI_TransmitReceive(&BENCH_SPI, (uint8_t *)BenchSrc, (uint8_t *)BenchDst, BENCH_BUFFER_SIZE,
+                                   BENCH_TIMEOUT);
+  BENCH_Record("spi_txrx_poll", 1U, BENCH_BUFFER_SIZE, start, status);
+
+  start = DWT->CYCCNT;
+  status = HAL_SPI_TransmitReceive_IT(&BENCH_SPI, (uint8_t *)BenchSrc, (uint8_t *)BenchDst, BENCH_BUFFER_SIZE);
+  while((status == HAL_OK) && (BENCH_SPI.State != HAL_SPI_STATE_READY))
+  {
+  }
+  BENCH_Record("spi_txrx_it", 1U, BENCH_BUFFER_SIZE, start, status);
+
+  if((BENCH_SPI.hdmatx != NULL) && (BENCH_SPI.hdmarx != NULL))
+  {
+    start = DWT->CYCCNT;
+    status = HAL_SPI_TransmitReceive_DMA(&BENCH_SPI, (uint8_t *)BenchSrc, (uint8_t *)BenchDst, BENCH_BUFFER_SIZE);
+    while((status == HAL_OK) && (BENCH_SPI.State != HAL_SPI_STATE_READY))
+    {
+    }
+    BENCH_Record("spi_txrx_dma", 1U, BENCH_BUFFER_SIZE, start, status);
+  }
+}
+#endif /* HAL_SPI_MODULE_ENABLED && BENCH_SPI */
+
+#if defined(HAL_I2C_MODULE_ENABLED) && defined(BENCH_I2C)
+/**
+  * @brief  I2C master write in polling, interrupt and DMA modes.
+  * @note   32 bytes are written, the page size of most EEPROMs.
+  * @retval None
+  */
+static void BENCH_I2c(void)
+{
+  HAL_StatusTypeDef status;
+  uint32_t start;
+
+  start = DWT->CYCCNT;
+  status = HAL_I2C_Master_Transmit(&BENCH_I2C, BENCH_I2C_ADDRESS, (uint8_t *)BenchSrc, 32U, BENCH_TIMEOUT);
+  BENCH_Record("i2c_tx_poll", 1U, 32U, start, status);
+  HAL_Delay(10U);
+
+  start = DWT->CYCCNT;
+  status = HAL_I2C_Master_Transmit_IT(&BENCH_I2C, BENCH_I2C_ADDRESS, (uint8_t *)BenchSrc, 32U);
+  while((status == HAL_OK) && (BENCH_I2C.State != HAL_I2C_STATE_READY))
+  {
+  }
+  BENCH_Record("i2c_tx_it", 1U, 32U, start, status);
+  HAL_Delay(10U);
+
+  if(BENCH_I2C.hdmatx != NULL)
+  {
+    start = DWT->CYCCNT;
+    status = HAL_I2C_Master_Transmit_DMA(&BENCH_I2C, BENCH_I2C_ADDRESS, (uint8_t *)BenchSrc, 32U);
+    while((status == HAL_OK) && (BENCH_I2C.State != HAL_I2C_STATE_READY))
+    {
+    }
+    BENCH_Record("i2c_tx_dma", 1U, 32U, start, status);
+    HAL_Delay(10U);
+  }
+}
+#endif /* HAL_I2C_MODULE_ENABLED && BENCH_I2C */
+
+#if defined(HAL_SD_MODULE_ENABLED) && defined(BENCH_SD)
+/**
+  * @brief  SD card single block write and read in polling mode.
+  * @note   The write is measured until the card is back in transfer state.
+  * @retval None
+  */
+static void BENCH_Sd(void)
+{
+  HAL_StatusTypeDef status;
+  uint32_t start;
+
+  start = DWT->CYCCNT;
+  status = HAL_SD_WriteBlocks(&BENCH_SD, (uint8_t *)BenchSrc, BENCH_SD_BLOCK, 1U, BENCH_TIMEOUT);
+  while((status == HAL_OK) && (HAL_SD_GetCardState(&BENCH_SD) != HAL_SD_CARD_TRANSFER))
+  {
+  }
+  BENCH_Record("sd_write_block", 1U, BLOCKSIZE, start, status);
+
+  start = DWT->CYCCNT;
+  status = HAL_SD_ReadBlocks(&BENCH_SD, (uint8_t *)BenchDst, BENCH_SD_BLOCK, 1U, BENCH_TIMEOUT);
+  BENCH_Record("sd_read_block", 1U, BLOCKSIZE, start, status);
+}
+#endif /* HAL_SD_MODULE_ENABLED && BENCH_SD */
+
+#if defined(HAL_FLASH_MODULE_ENABLED) && defined(BENCH_FLASH_SECTOR)
+/**
+  * @brief  FLASH sector erase and word programming.
+  * @retval None
+  */
+static void BENCH_Flash(void)
+{
+  FLASH_EraseInitTypeDef erase;
+  HAL_StatusTypeDef status;
+  uint32_t sectorerror;
+  uint32_t start;
+  uint32_t i;
+
+  erase.TypeErase = FLASH_TYPEERASE_SECTORS;
+  erase.Banks = FLASH_BANK_1;
+  erase.Sector = BENCH_FLASH_SECTOR;
+  erase.NbSectors = 1U;
+  erase.VoltageRange = FLASH_VOLTAGE_RANGE_3;
+
+  (void)HAL_FLASH_Unlock();
+
+  start = DWT->CYCCNT;
+  status = HAL_FLASHEx_Erase(&erase, &sectorerror);
+  BENCH_Record("flash_erase_sector", 1U, 0U, start, status);
+
+  start = DWT->CYCCNT;
+  for(i = 0U; (i < (BENCH_BUFFER_SIZE / 4U)) && (status == HAL_OK); i++)
+  {
+    status = HAL_FLASH_Program(FLASH_TYPEPROGRAM_WORD, BENCH_FLASH_ADDRESS + (4U * i), BenchSrc[i]);
+  }
+  BENCH_Record("flash_program_word", i, 4U * i, start, status);
+
+  (void)HAL_FLASH_Lock();
+}
+#endif /* HAL_FLASH_MODULE_ENABLED && BENCH_FLASH_SECTOR */
+
+/**
+  * @brief  CRC, HASH and CRYP throughput.
+  * @retval None
+  */
+static void BENCH_Crypto(void)
+{
+  HAL_StatusTypeDef status;
+  uint32_t start;
+
+#if defined(HAL_CRC_MODULE_ENABLED) && defined(BENCH_CRC)
+  start = DWT->CYCCNT;
+  BenchDst[0] = HAL_CRC_Calculate(&BENCH_CRC, BenchSrc, BENCH_BUFFER_SIZE / 4U);
+  BENCH_Record("crc32", 1U, BENCH_BUFFER_SIZE, start, HAL_OK);
+#endif
+
+#if defined(HAL_HASH_MODULE_ENABLED) && defined(HASH) && defined(BENCH_HASH)
+  start = DWT->CYCCNT;
+  status = HAL_HASH_SHA1_Start(&BENCH_HASH, (uint8_t *)BenchSrc, BENCH_BUFFER_SIZE, (uint8_t *)BenchDst,
+                               BENCH_TIMEOUT);
+  BENCH_Record("hash_sha1", 1U, BENCH_BUFFER_SIZE, start, status);
+#endif
+
+#if defined(HAL_CRYP_MODULE_ENABLED) && defined(CRYP) && defined(BENCH_CRYP)
+  start = DWT->CYCCNT;
+  status = HAL_CRYP_AESECB_Encrypt(&BENCH_CRYP, (uint8_t *)BenchSrc, BENCH_BUFFER_SIZE, (uint8_t *)BenchDst,
+                                   BENCH_TIMEOUT);
+  BENCH_Record("cryp_aes_ecb", 1U, BENCH_BUFFER_SIZE, start, status);
+#endif
+
+  /* Avoid unused variable warning when no benchmark uses them */
+  UNUSED(status);
+  UNUSED(start);
+}
+
+/**
+  * @brief  Memory copy by DMA compared with the CPU memcpy.
+  * @retval None
+  */
+static void BENCH_Memcpy(void)
+{
+  HAL_StatusTypeDef status;
+  uint32_t start;
+
+  start = DWT->CYCCNT;
+  (void)memcpy(BenchDst, BenchSrc, BENCH_BUFFER_SIZE);
+  BENCH_Record("cpu_memcpy", 1U, BENCH_BUFFER_SIZE, start, HAL_OK);
+
+#if defined(HAL_DMA_MODULE_ENABLED) && defined(BENCH_DMA_M2M)
+  start = DWT->CYCCNT;
+  status = HAL_DMA_Start(&BENCH_DMA_M2M, (uint32_t)BenchSrc, (uint32_t)BenchDst,
+                         BENCH_BUFFER_SIZE >> (BENCH_DMA_M2M.Init.PeriphDataAlignment >> DMA_SxCR_PSIZE_Pos));
+  if(status == HAL_OK)
+  {
+    status = HAL_DMA_PollForTransfer(&BENCH_DMA_M2M, HAL_DMA_FULL_TRANSFER, BENCH_TIMEOUT);
+  }
+  BENCH_Record("dma_memcpy", 1U, BENCH_BUFFER_SIZE, start, status);
+#endif
+
+  /* Avoid unused variable warning when no benchmark uses it */
+  UNUSED(status);
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
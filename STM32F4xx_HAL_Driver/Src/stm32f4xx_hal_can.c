@@ -37,6 +37,17 @@
 
       (#) Or receive a CAN frame using HAL_CAN_Receive_IT() function.
 
+      (#) To accept a list of identifiers, HAL_CAN_ConfigFilterList() packs it
+          into the fewest filter banks: runs of consecutive identifiers aligned
+          on a power of 2 use identifier/mask filters, the other identifiers
+          use 16-bit (standard) or 32-bit (extended) identifier list filters.
+
+      (#) To absorb bursts of frames, start a software receive ring on a FIFO
+          with HAL_CAN_RxRingStart(). The IRQ handler then only copies the
+          mailbox registers of each pending frame into the ring, and calls
+          HAL_CAN_RxRingCallback(). The frames are decoded later, outside the
+          interrupt, with HAL_CAN_RxRingRead().
+
      *** Polling mode IO operation ***
      =================================
      [..]
@@ -141,6 +152,12 @@
   */
 static HAL_StatusTypeDef CAN_Receive_IT(CAN_HandleTypeDef* hcan, uint8_t FIFONumber);
 static HAL_StatusTypeDef CAN_Transmit_IT(CAN_HandleTypeDef* hcan);
+static void CAN_RxRing_IT(CAN_HandleTypeDef* hcan, uint8_t FIFONumber);
+static void CAN_SortIdList(uint32_t* pId, uint32_t* pNbId);
+static uint32_t CAN_GetIdBlockSize(const uint32_t* pId, uint32_t NbId, uint32_t Index);
+static uint32_t CAN_ProgramIdList(CAN_HandleTypeDef* hcan, CAN_FilterListTypeDef* sFilterList, const uint32_t* pId,
+                                  uint32_t NbId, uint32_t IdType, uint32_t FilterMode, uint32_t FilterNumber,
+                                  uint32_t Program);
 /**
   * @}
   */
@@ -159,6 +176,7 @@ static HAL_StatusTypeDef CAN_Transmit_IT(CAN_HandleTypeDef* hcan);
   ==============================================================================
     [..]  This section provides functions allowing to:
       (+) Initialize and configure the CAN.
+      (+) Configure the filters from a list of identifiers.
       (+) De-initialize the CAN.
 
 @endverbatim
@@ -327,6 +345,10 @@ HAL_StatusTypeDef HAL_CAN_Init(CAN_HandleTypeDef* hcan)
 
   if(InitStatus == CAN_INITSTATUS_SUCCESS)
   {
+    /* No software receive ring */
+    hcan->pRxRing = NULL;
+    hcan->pRx1Ring = NULL;
+
     /* Set CAN error code to none */
     hcan->ErrorCode = HAL_CAN_ERROR_NONE;
 
@@ -470,6 +492,78 @@ HAL_StatusTypeDef HAL_CAN_ConfigFilter(CAN_HandleTypeDef* hcan, CAN_FilterConfTy
   return HAL_OK;
 }
 
+/**
+  * @brief  Configures the CAN reception filters to accept a list of identifiers,
+  *         using the fewest filter banks.
+  * @param  hcan: pointer to a CAN_HandleTypeDef structure that contains
+  *         the configuration information for the specified CAN.
+  * @param  sFilterList: pointer to a CAN_FilterListTypeDef structure that
+  *         contains the identifiers and the filter banks available.
+  * @param  pNbFilters: pointer to the number of filter banks used, starting
+  *         from FirstFilterNumber. Can be NULL.
+  * @note   Each run of 2^n consecutive identifiers starting on a multiple of
+  *         2^n, with n >= 2, is matched by one identifier/mask filter. The other
+  *         identifiers are matched by identifier list filters: 4 per bank for
+  *         the standard ones, 2 per bank for the extended ones. No frame out of
+  *         the list is accepted.
+  * @note   The identifier arrays are sorted in place and duplicates are removed.
+  *         The banks out of the ones used are left unchanged.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_CAN_ConfigFilterList(CAN_HandleTypeDef* hcan, CAN_FilterListTypeDef* sFilterList, uint32_t* pNbFilters)
+{
+  uint32_t nbstdid = sFilterList->NbStdId;
+  uint32_t nbextid = sFilterList->NbExtId;
+  uint32_t filternumber = sFilterList->FirstFilterNumber;
+  uint32_t nbfilters = 0U;
+
+  /* Check the parameters */
+  assert_param(IS_CAN_FILTER_NUMBER(sFilterList->FirstFilterNumber));
+  assert_param(IS_CAN_FILTER_FIFO(sFilterList->FilterFIFOAssignment));
+  assert_param(IS_CAN_BANKNUMBER(sFilterList->BankNumber));
+
+  if(((sFilterList->FirstFilterNumber + sFilterList->NbFilters) > 28U) ||
+     ((nbstdid != 0U) && (sFilterList->pStdId == NULL)) ||
+     ((nbextid != 0U) && (sFilterList->pExtId == NULL)))
+  {
+    return HAL_ERROR;
+  }
+
+  if(nbstdid != 0U)
+  {
+    CAN_SortIdList(sFilterList->pStdId, &nbstdid);
+  }
+  if(nbextid != 0U)
+  {
+    CAN_SortIdList(sFilterList->pExtId, &nbextid);
+  }
+
+  /* First pass: count the banks needed */
+  nbfilters += CAN_ProgramIdList(hcan, sFilterList, sFilterList->pStdId, nbstdid, CAN_ID_STD, CAN_FILTERMODE_IDMASK, 0U, 0U);
+  nbfilters += CAN_ProgramIdList(hcan, sFilterList, sFilterList->pStdId, nbstdid, CAN_ID_STD, CAN_FILTERMODE_IDLIST, 0U, 0U);
+  nbfilters += CAN_ProgramIdList(hcan, sFilterList, sFilterList->pExtId, nbextid, CAN_ID_EXT, CAN_FILTERMODE_IDMASK, 0U, 0U);
+  nbfilters += CAN_ProgramIdList(hcan, sFilterList, sFilterList->pExtId, nbextid, CAN_ID_EXT, CAN_FILTERMODE_IDLIST, 0U, 0U);
+
+  if(pNbFilters != NULL)
+  {
+    *pNbFilters = nbfilters;
+  }
+
+  if(nbfilters > sFilterList->NbFilters)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Second pass: program the banks */
+  filternumber += CAN_ProgramIdList(hcan, sFilterList, sFilterList->pStdId, nbstdid, CAN_ID_STD, CAN_FILTERMODE_IDMASK, filternumber, 1U);
+  filternumber += CAN_ProgramIdList(hcan, sFilterList, sFilterList->pStdId, nbstdid, CAN_ID_STD, CAN_FILTERMODE_IDLIST, filternumber, 1U);
+  filternumber += CAN_ProgramIdList(hcan, sFilterList, sFilterList->pExtId, nbextid, CAN_ID_EXT, CAN_FILTERMODE_IDMASK, filternumber, 1U);
+  (void)CAN_ProgramIdList(hcan, sFilterList, sFilterList->pExtId, nbextid, CAN_ID_EXT, CAN_FILTERMODE_IDLIST, filternumber, 1U);
+
+  /* Return function status */
+  return HAL_OK;
+}
+
 /**
   * @brief  Deinitializes the CANx peripheral registers to their default reset values.
   * @param  hcan: pointer to a CAN_HandleTypeDef structure that contains
@@ -547,6 +641,7 @@ __weak void HAL_CAN_MspDeInit(CAN_HandleTypeDef* hcan)
     [..]  This section provides functions allowing to:
       (+) Transmit a CAN frame message.
       (+) Receive a CAN frame message.
+      (+) Receive CAN frames continuously into a software ring.
       (+) Enter CAN peripheral in sleep mode.
       (+) Wake up the CAN peripheral from sleep mode.
 
@@ -1105,6 +1200,184 @@ HAL_StatusTypeDef HAL_CAN_Receive_IT(CAN_HandleTypeDef* hcan, uint8_t FIFONumber
   return HAL_OK;
 }
 
+/**
+  * @brief  Starts continuous reception of a FIFO into a software ring.
+  * @param  hcan:       Pointer to a CAN_HandleTypeDef structure that contains
+  *         the configuration information for the specified CAN.
+  * @param  FIFONumber: Specify the FIFO number
+  * @param  pRing:      Pointer to a CAN_RxRingTypeDef structure whose storage
+  *         and number of frames are set.
+  * @note   HAL_CAN_Receive() and HAL_CAN_Receive_IT() must not be used on the
+  *         FIFO while the ring is running.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_CAN_RxRingStart(CAN_HandleTypeDef* hcan, uint8_t FIFONumber, CAN_RxRingTypeDef* pRing)
+{
+  /* Check the parameters */
+  assert_param(IS_CAN_FIFO(FIFONumber));
+  assert_param(IS_CAN_RXRING_SIZE(pRing->NbFrames));
+
+  if((hcan->State == HAL_CAN_STATE_RESET) || (pRing->pFrames == NULL) || (!IS_CAN_RXRING_SIZE(pRing->NbFrames)))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Process locked */
+  __HAL_LOCK(hcan);
+
+  pRing->Head = 0U;
+  pRing->Tail = 0U;
+  pRing->Dropped = 0U;
+  pRing->Overrun = 0U;
+
+  if(FIFONumber == CAN_FIFO0)
+  {
+    hcan->pRxRing = pRing;
+
+    /* Enable FIFO 0 overrun and message pending Interrupt */
+    __HAL_CAN_ENABLE_IT(hcan, CAN_IT_FOV0 | CAN_IT_FMP0);
+  }
+  else /* FIFONumber == CAN_FIFO1 */
+  {
+    hcan->pRx1Ring = pRing;
+
+    /* Enable FIFO 1 overrun and message pending Interrupt */
+    __HAL_CAN_ENABLE_IT(hcan, CAN_IT_FOV1 | CAN_IT_FMP1);
+  }
+
+  /* Process unlocked */
+  __HAL_UNLOCK(hcan);
+
+  /* Return function status */
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stops continuous reception of a FIFO into a software ring.
+  * @param  hcan:       Pointer to a CAN_HandleTypeDef structure that contains
+  *         the configuration information for the specified CAN.
+  * @param  FIFONumber: Specify the FIFO number
+  * @note   The frames still in the ring can be read until the next start.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_CAN_RxRingStop(CAN_HandleTypeDef* hcan, uint8_t FIFONumber)
+{
+  /* Check the parameters */
+  assert_param(IS_CAN_FIFO(FIFONumber));
+
+  /* Process locked */
+  __HAL_LOCK(hcan);
+
+  if(FIFONumber == CAN_FIFO0)
+  {
+    /* Disable FIFO 0 overrun and message pending Interrupt */
+    __HAL_CAN_DISABLE_IT(hcan, CAN_IT_FOV0 | CAN_IT_FMP0);
+    hcan->pRxRing = NULL;
+  }
+  else /* FIFONumber == CAN_FIFO1 */
+  {
+    /* Disable FIFO 1 overrun and message pending Interrupt */
+    __HAL_CAN_DISABLE_IT(hcan, CAN_IT_FOV1 | CAN_IT_FMP1);
+    hcan->pRx1Ring = NULL;
+  }
+
+  /* Process unlocked */
+  __HAL_UNLOCK(hcan);
+
+  /* Return function status */
+  return HAL_OK;
+}
+
+/**
+  * @brief  Reads the oldest frame of a software receive ring.
+  * @param  hcan:       Pointer to a CAN_HandleTypeDef structure that contains
+  *         the configuration information for the specified CAN.
+  * @param  FIFONumber: Specify the FIFO number
+  * @param  pRxMsg:     Pointer to the structure receiving the decoded frame
+  * @note   Only one context may read a given ring.
+  * @retval HAL status, HAL_BUSY when the ring is empty
+  */
+HAL_StatusTypeDef HAL_CAN_RxRingRead(CAN_HandleTypeDef* hcan, uint8_t FIFONumber, CanRxMsgTypeDef* pRxMsg)
+{
+  CAN_RxRingTypeDef* pRing;
+  const CanRxFrameTypeDef* pFrame;
+  uint32_t tail;
+
+  /* Check the parameters */
+  assert_param(IS_CAN_FIFO(FIFONumber));
+
+  pRing = (FIFONumber == CAN_FIFO0) ? hcan->pRxRing : hcan->pRx1Ring;
+  if(pRing == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  tail = pRing->Tail;
+  if(tail == pRing->Head)
+  {
+    return HAL_BUSY;
+  }
+
+  /* Read the frame only after having seen the head update */
+  __DMB();
+  pFrame = &pRing->pFrames[tail & (pRing->NbFrames - 1U)];
+
+  /* Get the Id */
+  pRxMsg->IDE = (uint8_t)0x04 & pFrame->RIR;
+  if (pRxMsg->IDE == CAN_ID_STD)
+  {
+    pRxMsg->StdId = 0x000007FFU & (pFrame->RIR >> 21U);
+  }
+  else
+  {
+    pRxMsg->ExtId = 0x1FFFFFFFU & (pFrame->RIR >> 3U);
+  }
+
+  pRxMsg->RTR = (uint8_t)0x02 & pFrame->RIR;
+  /* Get the DLC */
+  pRxMsg->DLC = (uint8_t)0x0F & pFrame->RDTR;
+  /* Get the FIFONumber */
+  pRxMsg->FIFONumber = FIFONumber;
+  /* Get the FMI */
+  pRxMsg->FMI = (uint8_t)0xFF & (pFrame->RDTR >> 8U);
+  /* Get the data field */
+  pRxMsg->Data[0] = (uint8_t)0xFF & pFrame->RDLR;
+  pRxMsg->Data[1] = (uint8_t)0xFF & (pFrame->RDLR >> 8U);
+  pRxMsg->Data[2] = (uint8_t)0xFF & (pFrame->RDLR >> 16U);
+  pRxMsg->Data[3] = (uint8_t)0xFF & (pFrame->RDLR >> 24U);
+  pRxMsg->Data[4] = (uint8_t)0xFF & pFrame->RDHR;
+  pRxMsg->Data[5] = (uint8_t)0xFF & (pFrame->RDHR >> 8U);
+  pRxMsg->Data[6] = (uint8_t)0xFF & (pFrame->RDHR >> 16U);
+  pRxMsg->Data[7] = (uint8_t)0xFF & (pFrame->RDHR >> 24U);
+
+  /* Free the slot for the IRQ handler */
+  __DMB();
+  pRing->Tail = tail + 1U;
+
+  /* Return function status */
+  return HAL_OK;
+}
+
+/**
+  * @brief  Returns the number of frames waiting in a software receive ring.
+  * @param  hcan:       Pointer to a CAN_HandleTypeDef structure that contains
+  *         the configuration information for the specified CAN.
+  * @param  FIFONumber: Specify the FIFO number
+  * @retval Number of frames
+  */
+uint32_t HAL_CAN_RxRingGetLevel(CAN_HandleTypeDef* hcan, uint8_t FIFONumber)
+{
+  CAN_RxRingTypeDef* pRing;
+
+  pRing = (FIFONumber == CAN_FIFO0) ? hcan->pRxRing : hcan->pRx1Ring;
+  if(pRing == NULL)
+  {
+    return 0U;
+  }
+
+  return (pRing->Head - pRing->Tail);
+}
+
 /**
   * @brief  Enters the Sleep (low power) mode.
   * @param  hcan: pointer to a CAN_HandleTypeDef structure that contains
@@ -1228,8 +1501,16 @@ void HAL_CAN_IRQHandler(CAN_HandleTypeDef* hcan)
   tmp2 = __HAL_CAN_GET_IT_SOURCE(hcan, CAN_IT_FOV0);
   if(tmp1 && tmp2)
   {
-    /* Set CAN error code to FOV0 error */
-    errorcode |= HAL_CAN_ERROR_FOV0;
+    /* A software receive ring counts the overrun, and keeps receiving */
+    if(hcan->pRxRing != NULL)
+    {
+      hcan->pRxRing->Overrun++;
+    }
+    else
+    {
+      /* Set CAN error code to FOV0 error */
+      errorcode |= HAL_CAN_ERROR_FOV0;
+    }
 
     /* Clear FIFO0 Overrun Flag */
     __HAL_CAN_CLEAR_FLAG(hcan, CAN_FLAG_FOV0);
@@ -1240,8 +1521,16 @@ void HAL_CAN_IRQHandler(CAN_HandleTypeDef* hcan)
 
   if(tmp1 && tmp2)
   {
-    /* Set CAN error code to FOV1 error */
-    errorcode |= HAL_CAN_ERROR_FOV1;
+    /* A software receive ring counts the overrun, and keeps receiving */
+    if(hcan->pRx1Ring != NULL)
+    {
+      hcan->pRx1Ring->Overrun++;
+    }
+    else
+    {
+      /* Set CAN error code to FOV1 error */
+      errorcode |= HAL_CAN_ERROR_FOV1;
+    }
 
     /* Clear FIFO1 Overrun Flag */
     __HAL_CAN_CLEAR_FLAG(hcan, CAN_FLAG_FOV1);
@@ -1281,8 +1570,16 @@ void HAL_CAN_IRQHandler(CAN_HandleTypeDef* hcan)
   /* Check End of reception flag for FIFO0 */
   if((tmp1 != 0U) && tmp2)
   {
-    /* Call receive function */
-    CAN_Receive_IT(hcan, CAN_FIFO0);
+    if(hcan->pRxRing != NULL)
+    {
+      /* Drain the FIFO into the software ring */
+      CAN_RxRing_IT(hcan, CAN_FIFO0);
+    }
+    else
+    {
+      /* Call receive function */
+      CAN_Receive_IT(hcan, CAN_FIFO0);
+    }
   }
 
   tmp1 = __HAL_CAN_MSG_PENDING(hcan, CAN_FIFO1);
@@ -1290,8 +1587,16 @@ void HAL_CAN_IRQHandler(CAN_HandleTypeDef* hcan)
   /* Check End of reception flag for FIFO1 */
   if((tmp1 != 0U) && tmp2)
   {
-    /* Call receive function */
-    CAN_Receive_IT(hcan, CAN_FIFO1);
+    if(hcan->pRx1Ring != NULL)
+    {
+      /* Drain the FIFO into the software ring */
+      CAN_RxRing_IT(hcan, CAN_FIFO1);
+    }
+    else
+    {
+      /* Call receive function */
+      CAN_Receive_IT(hcan, CAN_FIFO1);
+    }
   }
 
   /* Set error code in handle */
@@ -1398,6 +1703,16 @@ void HAL_CAN_IRQHandler(CAN_HandleTypeDef* hcan)
                                CAN_IT_FOV1|
                                CAN_IT_TME);
 
+    /* Keep the software receive rings running */
+    if(hcan->pRxRing != NULL)
+    {
+      __HAL_CAN_ENABLE_IT(hcan, CAN_IT_FOV0 | CAN_IT_FMP0);
+    }
+    if(hcan->pRx1Ring != NULL)
+    {
+      __HAL_CAN_ENABLE_IT(hcan, CAN_IT_FOV1 | CAN_IT_FMP1);
+    }
+
     /* Call Error callback function */
     HAL_CAN_ErrorCallback(hcan);
   }
@@ -1433,6 +1748,23 @@ __weak void HAL_CAN_RxCpltCallback(CAN_HandleTypeDef* hcan)
    */
 }
 
+/**
+  * @brief  Software receive ring callback, frames were added to the ring.
+  * @param  hcan: pointer to a CAN_HandleTypeDef structure that contains
+  *         the configuration information for the specified CAN.
+  * @param  FIFONumber: Specify the FIFO number
+  * @retval None
+  */
+__weak void HAL_CAN_RxRingCallback(CAN_HandleTypeDef* hcan, uint8_t FIFONumber)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hcan);
+  UNUSED(FIFONumber);
+  /* NOTE : This function Should not be modified, when the callback is needed,
+            the HAL_CAN_RxRingCallback could be implemented in the user file
+   */
+}
+
 /**
   * @brief  Error CAN callback.
   * @param  hcan: pointer to a CAN_HandleTypeDef structure that contains
@@ -1664,6 +1996,215 @@ static HAL_StatusTypeDef CAN_Receive_IT(CAN_HandleTypeDef* hcan, uint8_t FIFONum
   return HAL_OK;
 }
 
+/**
+  * @brief  Copies all the pending frames of a FIFO into its software ring.
+  * @param  hcan:       Pointer to a CAN_HandleTypeDef structure that contains
+  *         the configuration information for the specified CAN.
+  * @param  FIFONumber: Specify the FIFO number
+  * @retval None
+  */
+static void CAN_RxRing_IT(CAN_HandleTypeDef* hcan, uint8_t FIFONumber)
+{
+  CAN_RxRingTypeDef* pRing = (FIFONumber == CAN_FIFO0) ? hcan->pRxRing : hcan->pRx1Ring;
+  CAN_FIFOMailBox_TypeDef* pMailBox = &hcan->Instance->sFIFOMailBox[FIFONumber];
+  CanRxFrameTypeDef* pFrame;
+  uint32_t head = pRing->Head;
+
+  while(__HAL_CAN_MSG_PENDING(hcan, FIFONumber) != 0U)
+  {
+    if((head - pRing->Tail) < pRing->NbFrames)
+    {
+      /* Raw copy, the frame is decoded by HAL_CAN_RxRingRead */
+      pFrame = &pRing->pFrames[head & (pRing->NbFrames - 1U)];
+      pFrame->RIR  = pMailBox->RIR;
+      pFrame->RDTR = pMailBox->RDTR;
+      pFrame->RDLR = pMailBox->RDLR;
+      pFrame->RDHR = pMailBox->RDHR;
+      head++;
+    }
+    else
+    {
+      pRing->Dropped++;
+    }
+
+    /* Release the FIFO output mailbox */
+    __HAL_CAN_FIFO_RELEASE(hcan, FIFONumber);
+  }
+
+  /* Publish the frames once they are written */
+  __DMB();
+  pRing->Head = head;
+
+  /* Software receive ring callback */
+  HAL_CAN_RxRingCallback(hcan, FIFONumber);
+}
+
+/**
+  * @brief  Sorts an identifier list in increasing order and removes duplicates.
+  * @param  pId:   Pointer to the identifiers
+  * @param  pNbId: Pointer to the number of identifiers, updated
+  * @retval None
+  */
+static void CAN_SortIdList(uint32_t* pId, uint32_t* pNbId)
+{
+  uint32_t i, j, id, nbid;
+
+  /* Insertion sort, the lists are short */
+  for(i = 1U; i < *pNbId; i++)
+  {
+    id = pId[i];
+    for(j = i; (j > 0U) && (pId[j - 1U] > id); j--)
+    {
+      pId[j] = pId[j - 1U];
+    }
+    pId[j] = id;
+  }
+
+  nbid = (*pNbId != 0U) ? 1U : 0U;
+  for(i = 1U; i < *pNbId; i++)
+  {
+    if(pId[i] != pId[nbid - 1U])
+    {
+      pId[nbid] = pId[i];
+      nbid++;
+    }
+  }
+  *pNbId = nbid;
+}
+
+/**
+  * @brief  Returns the size of the largest aligned run of consecutive identifiers
+  *         starting at an index of a sorted identifier list.
+  * @param  pId:   Pointer to the sorted identifiers, without duplicates
+  * @param  NbId:  Number of identifiers
+  * @param  Index: Index of the first identifier of the run
+  * @retval Size of the run, a power of 2
+  */
+static uint32_t CAN_GetIdBlockSize(const uint32_t* pId, uint32_t NbId, uint32_t Index)
+{
+  uint32_t size = 1U;
+
+  /* Without duplicates, the run is complete when its last identifier is in place */
+  while(((pId[Index] & ((2U * size) - 1U)) == 0U) &&
+        ((Index + (2U * size)) <= NbId) &&
+        (pId[Index + (2U * size) - 1U] == (pId[Index] + (2U * size) - 1U)))
+  {
+    size *= 2U;
+  }
+
+  return size;
+}
+
+/**
+  * @brief  Programs the filter banks of one kind of an identifier list.
+  * @param  hcan:         Pointer to a CAN_HandleTypeDef structure that contains
+  *         the configuration information for the specified CAN.
+  * @param  sFilterList:  Pointer to the identifier list structure
+  * @param  pId:          Pointer to the sorted identifiers, without duplicates
+  * @param  NbId:         Number of identifiers
+  * @param  IdType:       CAN_ID_STD (16-bit banks) or CAN_ID_EXT (32-bit banks)
+  * @param  FilterMode:   CAN_FILTERMODE_IDMASK for the runs of 4 identifiers
+  *         or more, CAN_FILTERMODE_IDLIST for the other identifiers
+  * @param  FilterNumber: First filter bank to program
+  * @param  Program:      0 to only count the banks
+  * @retval Number of filter banks
+  */
+static uint32_t CAN_ProgramIdList(CAN_HandleTypeDef* hcan, CAN_FilterListTypeDef* sFilterList, const uint32_t* pId,
+                                  uint32_t NbId, uint32_t IdType, uint32_t FilterMode, uint32_t FilterNumber,
+                                  uint32_t Program)
+{
+  CAN_FilterConfTypeDef sFilterConfig;
+  uint32_t word[4];
+  uint32_t nbword = 0U;
+  uint32_t bankwords = (IdType == CAN_ID_STD) ? 4U : 2U;
+  uint32_t entrywords = (FilterMode == CAN_FILTERMODE_IDMASK) ? 2U : 1U;
+  uint32_t nbfilters = 0U;
+  uint32_t index = 0U;
+  uint32_t size, i;
+
+  while((index < NbId) || (nbword != 0U))
+  {
+    if(index < NbId)
+    {
+      size = CAN_GetIdBlockSize(pId, NbId, index);
+      if(FilterMode == CAN_FILTERMODE_IDMASK)
+      {
+        if(size >= 4U)
+        {
+          /* Identifier, then mask: all identifier bits but the run ones, IDE and RTR */
+          if(IdType == CAN_ID_STD)
+          {
+            word[nbword] = pId[index] << 5U;
+            word[nbword + 1U] = ((~(size - 1U) & 0x7FFU) << 5U) | 0x18U;
+          }
+          else
+          {
+            word[nbword] = (pId[index] << 3U) | CAN_ID_EXT;
+            word[nbword + 1U] = ((~(size - 1U) & 0x1FFFFFFFU) << 3U) | CAN_ID_EXT | CAN_RTR_REMOTE;
+          }
+          nbword += 2U;
+        }
+        index += size;
+      }
+      else
+      {
+        if(size < 4U)
+        {
+          /* List entry: data frame of this identifier */
+          word[nbword] = (IdType == CAN_ID_STD) ? (pId[index] << 5U) : ((pId[index] << 3U) | CAN_ID_EXT);
+          nbword++;
+          size = 1U;
+        }
+        index += size;
+      }
+    }
+    else
+    {
+      /* Complete the last bank with copies of its last entry */
+      for(i = nbword; i < bankwords; i++)
+      {
+        word[i] = word[i - entrywords];
+      }
+      nbword = bankwords;
+    }
+
+    if(nbword == bankwords)
+    {
+      if(Program != 0U)
+      {
+        sFilterConfig.FilterNumber = FilterNumber + nbfilters;
+        sFilterConfig.FilterMode = FilterMode;
+        sFilterConfig.FilterFIFOAssignment = sFilterList->FilterFIFOAssignment;
+        sFilterConfig.FilterActivation = ENABLE;
+        sFilterConfig.BankNumber = sFilterList->BankNumber;
+        if(IdType == CAN_ID_STD)
+        {
+          /* FR1 = word[1]:word[0], FR2 = word[3]:word[2] */
+          sFilterConfig.FilterScale = CAN_FILTERSCALE_16BIT;
+          sFilterConfig.FilterIdLow = word[0];
+          sFilterConfig.FilterMaskIdLow = word[1];
+          sFilterConfig.FilterIdHigh = word[2];
+          sFilterConfig.FilterMaskIdHigh = word[3];
+        }
+        else
+        {
+          /* FR1 = word[0], FR2 = word[1] */
+          sFilterConfig.FilterScale = CAN_FILTERSCALE_32BIT;
+          sFilterConfig.FilterIdHigh = word[0] >> 16U;
+          sFilterConfig.FilterIdLow = word[0] & 0xFFFFU;
+          sFilterConfig.FilterMaskIdHigh = word[1] >> 16U;
+          sFilterConfig.FilterMaskIdLow = word[1] & 0xFFFFU;
+        }
+        (void)HAL_CAN_ConfigFilter(hcan, &sFilterConfig);
+      }
+      nbfilters++;
+      nbword = 0U;
+    }
+  }
+
+  return nbfilters;
+}
+
 /**
   * @}
   */
@@ -10,6 +10,7 @@
   *           + Initialization and de-initialization functions
   *           + Peripheral Control functions
   *           + Peripheral State functions
+  *           + CRC Engine functions
   *
   @verbatim
   ==============================================================================
@@ -28,6 +29,32 @@
           a new 32-bit data buffer. This function resets the CRC computation
           unit before starting the computation to avoid getting wrong CRC values.
 
+    [..]
+      The CRC engine computes any CRC of 1 to 32 bits on a byte buffer:
+
+      (#) Fill a CRC_AlgoTypeDef with the parameters of the algorithm, for instance
+          Width 16, Polynomial 0x1021, InitValue 0xFFFF, no reflection and XorOut 0
+          for CRC-16/CCITT-FALSE, or Width 32, Polynomial 0x04C11DB7, InitValue
+          0xFFFFFFFF, both reflections and XorOut 0xFFFFFFFF for the CRC-32 of
+          Ethernet and zlib.
+
+      (#) Call HAL_CRC_EngineInit() with the CRC handle, or NULL, and a table of
+          CRC_ENGINE_TABLE_SIZE words. The CRC unit is selected when it computes
+          the algorithm: 32-bit CRC of polynomial 0x04C11DB7 and initial value
+          0xFFFFFFFF. The reflected variants are fed to the unit with bit reversed
+          words. The other algorithms use slicing-by-8 tables built in pTable,
+          which can be NULL when the CRC unit is selected. The tables depend on
+          Width, Polynomial and InputReflection only, so engines of the same
+          polynomial can share them.
+
+      (#) Compute the CRC of a buffer with HAL_CRC_EngineCompute(), or of several
+          buffers with HAL_CRC_EngineStart(), HAL_CRC_EngineUpdate() for each of
+          them, and HAL_CRC_EngineFinish().
+
+      (#) When the CRC unit is selected, it is reserved from HAL_CRC_EngineStart()
+          to HAL_CRC_EngineFinish(), HAL_CRC_EngineStart() returning HAL_BUSY
+          meanwhile.
+
   @endverbatim
   ******************************************************************************
   * @attention
@@ -77,6 +104,16 @@
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
+/** @addtogroup CRC_Private_Functions
+  * @{
+  */
+static uint32_t CRC_Reflect(uint32_t Value, uint32_t Width);
+static void CRC_BuildTable(CRC_EngineTypeDef *hcrce);
+static void CRC_SoftUpdate(CRC_EngineTypeDef *hcrce, const uint8_t *pData, uint32_t Size);
+static void CRC_HwWrite(CRC_EngineTypeDef *hcrce, const uint8_t *pData);
+/**
+  * @}
+  */
 /* Private functions ---------------------------------------------------------*/
 /* Exported functions --------------------------------------------------------*/
 
@@ -330,6 +367,436 @@ HAL_CRC_StateTypeDef HAL_CRC_GetState(CRC_HandleTypeDef *hcrc)
   * @}
   */
 
+/** @addtogroup CRC_Exported_Functions_Group4
+ *  @brief   CRC Engine functions
+ *
+@verbatim
+  ==============================================================================
+                      ##### CRC Engine functions #####
+  ==============================================================================
+    [..]  This section provides functions allowing to:
+      (+) Select the fastest path computing a CRC algorithm
+      (+) Compute the CRC of a byte buffer, or of a sequence of byte buffers
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Initializes a CRC engine and selects its path.
+  * @param  hcrce: pointer to the CRC engine
+  * @param  hcrc: pointer to an initialized CRC handle, or NULL to always
+  *         use the software path
+  * @param  pAlgo: pointer to the CRC algorithm
+  * @param  pTable: table of CRC_ENGINE_TABLE_SIZE words, or NULL when only
+  *         the CRC unit can be used
+  * @retval HAL status, HAL_ERROR when the software path is needed without table
+  */
+HAL_StatusTypeDef HAL_CRC_EngineInit(CRC_EngineTypeDef *hcrce, CRC_HandleTypeDef *hcrc, const CRC_AlgoTypeDef *pAlgo, uint32_t *pTable)
+{
+  /* Check the engine and algorithm allocation */
+  if((hcrce == NULL) || (pAlgo == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the parameters */
+  assert_param(IS_CRC_WIDTH(pAlgo->Width));
+  assert_param(IS_CRC_REFLECTION(pAlgo->InputReflection));
+  assert_param(IS_CRC_REFLECTION(pAlgo->OutputReflection));
+
+  hcrce->hcrc = hcrc;
+  hcrce->Algo = *pAlgo;
+  hcrce->pTable = pTable;
+  hcrce->Crc = 0U;
+  hcrce->PendingCount = 0U;
+
+  if((hcrc != NULL) && (pAlgo->Width == 32U) && (pAlgo->Polynomial == CRC_HW_POLYNOMIAL) &&
+     (pAlgo->InitValue == CRC_HW_INIT_VALUE))
+  {
+    /* The CRC unit computes the algorithm, the output reflection and XOR being
+       done in software */
+    if(pAlgo->InputReflection == CRC_REFLECTION_ENABLE)
+    {
+      hcrce->Path = CRC_PATH_HARDWARE_REFLECTED;
+    }
+    else
+    {
+      hcrce->Path = CRC_PATH_HARDWARE;
+    }
+  }
+  else
+  {
+    if(pTable == NULL)
+    {
+      return HAL_ERROR;
+    }
+
+    hcrce->Path = CRC_PATH_SOFTWARE;
+    CRC_BuildTable(hcrce);
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Starts the CRC computation of a sequence of buffers.
+  * @param  hcrce: pointer to the CRC engine
+  * @retval HAL status, HAL_BUSY when the CRC unit is in use
+  */
+HAL_StatusTypeDef HAL_CRC_EngineStart(CRC_EngineTypeDef *hcrce)
+{
+  uint32_t width = hcrce->Algo.Width;
+
+  if(hcrce->Path == CRC_PATH_SOFTWARE)
+  {
+    if(hcrce->Algo.InputReflection == CRC_REFLECTION_ENABLE)
+    {
+      hcrce->Crc = CRC_Reflect(hcrce->Algo.InitValue, width);
+    }
+    else
+    {
+      /* The register is kept left aligned whatever the width */
+      hcrce->Crc = hcrce->Algo.InitValue << (32U - width);
+    }
+    return HAL_OK;
+  }
+
+  /* Process Locked */
+  __HAL_LOCK(hcrce->hcrc);
+
+  if(hcrce->hcrc->State != HAL_CRC_STATE_READY)
+  {
+    /* Process Unlocked */
+    __HAL_UNLOCK(hcrce->hcrc);
+    return HAL_BUSY;
+  }
+
+  /* Reserve the CRC unit until HAL_CRC_EngineFinish() */
+  hcrce->hcrc->State = HAL_CRC_STATE_BUSY;
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(hcrce->hcrc);
+
+  /* Reset CRC Calculation Unit */
+  __HAL_CRC_DR_RESET(hcrce->hcrc);
+  hcrce->PendingCount = 0U;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Feeds a buffer to the CRC computation started by HAL_CRC_EngineStart().
+  * @param  hcrce: pointer to the CRC engine
+  * @param  pData: pointer to the data, without alignment constraint
+  * @param  Size: number of bytes
+  * @retval None
+  */
+void HAL_CRC_EngineUpdate(CRC_EngineTypeDef *hcrce, const uint8_t *pData, uint32_t Size)
+{
+  const uint8_t *pdata = pData;
+  uint32_t size = Size;
+
+  if(hcrce->Path == CRC_PATH_SOFTWARE)
+  {
+    CRC_SoftUpdate(hcrce, pdata, size);
+    return;
+  }
+
+  /* Complete the word started by the previous buffer */
+  if(hcrce->PendingCount != 0U)
+  {
+    while((hcrce->PendingCount < 4U) && (size > 0U))
+    {
+      hcrce->Pending[hcrce->PendingCount] = *pdata;
+      hcrce->PendingCount++;
+      pdata++;
+      size--;
+    }
+
+    if(hcrce->PendingCount == 4U)
+    {
+      CRC_HwWrite(hcrce, hcrce->Pending);
+      hcrce->PendingCount = 0U;
+    }
+  }
+
+  while(size >= 4U)
+  {
+    CRC_HwWrite(hcrce, pdata);
+    pdata += 4U;
+    size -= 4U;
+  }
+
+  /* Keep the last bytes for the next buffer or HAL_CRC_EngineFinish() */
+  while(size > 0U)
+  {
+    hcrce->Pending[hcrce->PendingCount] = *pdata;
+    hcrce->PendingCount++;
+    pdata++;
+    size--;
+  }
+}
+
+/**
+  * @brief  Ends the CRC computation and releases the CRC unit.
+  * @param  hcrce: pointer to the CRC engine
+  * @retval CRC of the sequence of buffers
+  */
+uint32_t HAL_CRC_EngineFinish(CRC_EngineTypeDef *hcrce)
+{
+  uint32_t width = hcrce->Algo.Width;
+  uint32_t crc;
+  uint32_t index;
+  uint32_t bit;
+
+  if(hcrce->Path == CRC_PATH_SOFTWARE)
+  {
+    if(hcrce->Algo.InputReflection == CRC_REFLECTION_ENABLE)
+    {
+      crc = hcrce->Crc;
+    }
+    else
+    {
+      crc = hcrce->Crc >> (32U - width);
+    }
+  }
+  else
+  {
+    crc = hcrce->hcrc->Instance->DR;
+
+    /* The CRC unit only takes words: the last bytes are processed bitwise */
+    if(hcrce->Path == CRC_PATH_HARDWARE_REFLECTED)
+    {
+      crc = __RBIT(crc);
+      for(index = 0U; index < hcrce->PendingCount; index++)
+      {
+        crc ^= (uint32_t)hcrce->Pending[index];
+        for(bit = 0U; bit < 8U; bit++)
+        {
+          crc = ((crc & 1U) != 0U) ? ((crc >> 1U) ^ CRC_HW_POLYNOMIAL_REFLECTED) : (crc >> 1U);
+        }
+      }
+    }
+    else
+    {
+      for(index = 0U; index < hcrce->PendingCount; index++)
+      {
+        crc ^= (uint32_t)hcrce->Pending[index] << 24U;
+        for(bit = 0U; bit < 8U; bit++)
+        {
+          crc = ((crc & 0x80000000U) != 0U) ? ((crc << 1U) ^ CRC_HW_POLYNOMIAL) : (crc << 1U);
+        }
+      }
+    }
+    hcrce->PendingCount = 0U;
+
+    /* Release the CRC unit */
+    hcrce->hcrc->State = HAL_CRC_STATE_READY;
+  }
+
+  /* The register is reflected when the input is: reflect it again when the
+     output is not, and conversely */
+  if(hcrce->Algo.OutputReflection != hcrce->Algo.InputReflection)
+  {
+    crc = CRC_Reflect(crc, width);
+  }
+
+  crc ^= hcrce->Algo.XorOut;
+
+  if(width < 32U)
+  {
+    crc &= (1UL << width) - 1U;
+  }
+
+  return crc;
+}
+
+/**
+  * @brief  Computes the CRC of a buffer.
+  * @param  hcrce: pointer to the CRC engine
+  * @param  pData: pointer to the data, without alignment constraint
+  * @param  Size: number of bytes
+  * @param  pCrc: pointer to the computed CRC
+  * @retval HAL status, HAL_BUSY when the CRC unit is in use
+  */
+HAL_StatusTypeDef HAL_CRC_EngineCompute(CRC_EngineTypeDef *hcrce, const uint8_t *pData, uint32_t Size, uint32_t *pCrc)
+{
+  HAL_StatusTypeDef status;
+
+  status = HAL_CRC_EngineStart(hcrce);
+  if(status == HAL_OK)
+  {
+    HAL_CRC_EngineUpdate(hcrce, pData, Size);
+    *pCrc = HAL_CRC_EngineFinish(hcrce);
+  }
+
+  return status;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/** @addtogroup CRC_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Reflects the Width least significant bits of a value.
+  * @param  Value: value to reflect
+  * @param  Width: number of bits, from 1 to 32
+  * @retval Reflected value
+  */
+static uint32_t CRC_Reflect(uint32_t Value, uint32_t Width)
+{
+  return __RBIT(Value) >> (32U - Width);
+}
+
+/**
+  * @brief  Builds the slicing-by-8 tables of the engine algorithm.
+  * @note   Table k gives the CRC register contribution of a byte followed by
+  *         k bytes, the register being right aligned when the input is
+  *         reflected and left aligned otherwise.
+  * @param  hcrce: pointer to the CRC engine
+  * @retval None
+  */
+static void CRC_BuildTable(CRC_EngineTypeDef *hcrce)
+{
+  uint32_t *table = hcrce->pTable;
+  uint32_t width = hcrce->Algo.Width;
+  uint32_t poly;
+  uint32_t crc;
+  uint32_t index;
+  uint32_t bit;
+  uint32_t slice;
+
+  if(hcrce->Algo.InputReflection == CRC_REFLECTION_ENABLE)
+  {
+    poly = CRC_Reflect(hcrce->Algo.Polynomial, width);
+    for(index = 0U; index < 256U; index++)
+    {
+      crc = index;
+      for(bit = 0U; bit < 8U; bit++)
+      {
+        crc = ((crc & 1U) != 0U) ? ((crc >> 1U) ^ poly) : (crc >> 1U);
+      }
+      table[index] = crc;
+    }
+    for(slice = 1U; slice < 8U; slice++)
+    {
+      for(index = 0U; index < 256U; index++)
+      {
+        crc = table[((slice - 1U) * 256U) + index];
+        table[(slice * 256U) + index] = (crc >> 8U) ^ table[crc & 0xFFU];
+      }
+    }
+  }
+  else
+  {
+    poly = hcrce->Algo.Polynomial << (32U - width);
+    for(index = 0U; index < 256U; index++)
+    {
+      crc = index << 24U;
+      for(bit = 0U; bit < 8U; bit++)
+      {
+        crc = ((crc & 0x80000000U) != 0U) ? ((crc << 1U) ^ poly) : (crc << 1U);
+      }
+      table[index] = crc;
+    }
+    for(slice = 1U; slice < 8U; slice++)
+    {
+      for(index = 0U; index < 256U; index++)
+      {
+        crc = table[((slice - 1U) * 256U) + index];
+        table[(slice * 256U) + index] = (crc << 8U) ^ table[crc >> 24U];
+      }
+    }
+  }
+}
+
+/**
+  * @brief  Feeds a buffer to the software path, 8 bytes per step.
+  * @param  hcrce: pointer to the CRC engine
+  * @param  pData: pointer to the data
+  * @param  Size: number of bytes
+  * @retval None
+  */
+static void CRC_SoftUpdate(CRC_EngineTypeDef *hcrce, const uint8_t *pData, uint32_t Size)
+{
+  const uint32_t *table = hcrce->pTable;
+  const uint8_t *pdata = pData;
+  uint32_t size = Size;
+  uint32_t crc = hcrce->Crc;
+
+  if(hcrce->Algo.InputReflection == CRC_REFLECTION_ENABLE)
+  {
+    while(size >= 8U)
+    {
+      crc ^= (uint32_t)pdata[0] | ((uint32_t)pdata[1] << 8U) | ((uint32_t)pdata[2] << 16U) | ((uint32_t)pdata[3] << 24U);
+      crc = table[(7U * 256U) + (crc & 0xFFU)] ^ table[(6U * 256U) + ((crc >> 8U) & 0xFFU)] ^
+            table[(5U * 256U) + ((crc >> 16U) & 0xFFU)] ^ table[(4U * 256U) + (crc >> 24U)] ^
+            table[(3U * 256U) + pdata[4]] ^ table[(2U * 256U) + pdata[5]] ^
+            table[256U + pdata[6]] ^ table[pdata[7]];
+      pdata += 8U;
+      size -= 8U;
+    }
+    while(size > 0U)
+    {
+      crc = (crc >> 8U) ^ table[(crc ^ *pdata) & 0xFFU];
+      pdata++;
+      size--;
+    }
+  }
+  else
+  {
+    while(size >= 8U)
+    {
+      crc ^= ((uint32_t)pdata[0] << 24U) | ((uint32_t)pdata[1] << 16U) | ((uint32_t)pdata[2] << 8U) | (uint32_t)pdata[3];
+      crc = table[(7U * 256U) + (crc >> 24U)] ^ table[(6U * 256U) + ((crc >> 16U) & 0xFFU)] ^
+            table[(5U * 256U) + ((crc >> 8U) & 0xFFU)] ^ table[(4U * 256U) + (crc & 0xFFU)] ^
+            table[(3U * 256U) + pdata[4]] ^ table[(2U * 256U) + pdata[5]] ^
+            table[256U + pdata[6]] ^ table[pdata[7]];
+      pdata += 8U;
+      size -= 8U;
+    }
+    while(size > 0U)
+    {
+      crc = (crc << 8U) ^ table[(crc >> 24U) ^ *pdata];
+      pdata++;
+      size--;
+    }
+  }
+
+  hcrce->Crc = crc;
+}
+
+/**
+  * @brief  Writes 4 bytes to the CRC unit.
+  * @note   The first byte goes to the most significant byte of the data register,
+  *         each byte being bit reversed for the reflected algorithms.
+  * @param  hcrce: pointer to the CRC engine
+  * @param  pData: pointer to the 4 bytes
+  * @retval None
+  */
+static void CRC_HwWrite(CRC_EngineTypeDef *hcrce, const uint8_t *pData)
+{
+  uint32_t data = (uint32_t)pData[0] | ((uint32_t)pData[1] << 8U) | ((uint32_t)pData[2] << 16U) | ((uint32_t)pData[3] << 24U);
+
+  if(hcrce->Path == CRC_PATH_HARDWARE_REFLECTED)
+  {
+    hcrce->hcrc->Instance->DR = __RBIT(data);
+  }
+  else
+  {
+    hcrce->hcrc->Instance->DR = __REV(data);
+  }
+}
+
 /**
   * @}
   */
@@ -20,6 +20,26 @@
           HAL_DACEx_DualSetValue() to set digital value to converted simultaneously in Channel 1 and Channel 2.
       (+) Use HAL_DACEx_TriangleWaveGenerate() to generate Triangle signal.
       (+) Use HAL_DACEx_NoiseWaveGenerate() to generate Noise signal.
+      (+) Use HAL_DACEx_DualTriangleWaveGenerate() or HAL_DACEx_DualNoiseWaveGenerate()
+          to start the wave generation of both channels with a single register write.
+          No DMA transfer is needed: use them instead of a wave table when the
+          target waveform is a triangle or noise added to a constant offset.
+
+    *** Dual channel DMA streaming ***
+    ==================================
+    [..]
+      (+) Configure both channels with the same trigger using HAL_DAC_ConfigChannel(),
+          so that both outputs are updated on the same trigger event.
+      (+) Configure the DMA stream of the requesting channel (DMA_Handle1 for
+          DAC_CHANNEL_1) in circular mode with word peripheral and memory data alignment.
+      (+) Start both channels using HAL_DACEx_DualStart_DMA(): each 32-bit item of the
+          buffer holds the Channel1 data in its lower half-word and the Channel2 data
+          in its upper half-word (lower and upper byte for DAC_ALIGN_8B_R).
+          A single DMA request per trigger loads both channels.
+      (+) Refill the first half of the buffer in HAL_DACEx_DualConvHalfCpltCallback()
+          and the second half in HAL_DACEx_DualConvCpltCallback(). Periodic waveforms
+          stored in the buffer are replayed by the circular DMA without any refill.
+      (+) Stop both channels using HAL_DACEx_DualStop_DMA().
 
  @endverbatim
   ******************************************************************************
@@ -75,7 +95,17 @@
 /* Private define ------------------------------------------------------------*/
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
+/** @addtogroup DACEx_Private_Functions
+  * @{
+  */
 /* Private function prototypes -----------------------------------------------*/
+static void DAC_DMADualConvCplt(DMA_HandleTypeDef *hdma);
+static void DAC_DMADualHalfConvCplt(DMA_HandleTypeDef *hdma);
+static void DAC_DMADualError(DMA_HandleTypeDef *hdma);
+/**
+  * @}
+  */
+
 /* Private functions ---------------------------------------------------------*/
 /* Exported functions --------------------------------------------------------*/
 /** @defgroup DACEx_Exported_Functions DAC Exported Functions
@@ -259,6 +289,216 @@ HAL_StatusTypeDef HAL_DACEx_DualSetValue(DAC_HandleTypeDef* hdac, uint32_t Align
   return HAL_OK;
 }
 
+/**
+  * @brief  Enables DAC and starts conversion of both channels with a single DMA stream.
+  * @param  hdac: pointer to a DAC_HandleTypeDef structure that contains
+  *         the configuration information for the specified DAC.
+  * @param  Channel: The DAC channel that will request data from DMA.
+  *          This parameter can be one of the following values:
+  *            @arg DAC_CHANNEL_1: DAC Channel1 selected
+  *            @arg DAC_CHANNEL_2: DAC Channel2 selected
+  * @param  pData: The source Buffer address of packed dual channel data.
+  * @param  Length: The number of 32-bit items to be transferred from memory to DAC peripheral
+  * @param  Alignment: Specifies the data alignment for dual channel DAC.
+  *          This parameter can be one of the following values:
+  *            @arg DAC_ALIGN_8B_R: 8bit right data alignment selected
+  *            @arg DAC_ALIGN_12B_L: 12bit left data alignment selected
+  *            @arg DAC_ALIGN_12B_R: 12bit right data alignment selected
+  * @note   Both channels must be configured with the same trigger, otherwise the
+  *         outputs are not updated together and HAL_ERROR is returned.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DACEx_DualStart_DMA(DAC_HandleTypeDef* hdac, uint32_t Channel, uint32_t* pData, uint32_t Length, uint32_t Alignment)
+{
+  DMA_HandleTypeDef *hdma;
+  uint32_t tmpreg = 0U;
+  HAL_StatusTypeDef status;
+
+  /* Check the parameters */
+  assert_param(IS_DAC_CHANNEL(Channel));
+  assert_param(IS_DAC_ALIGN(Alignment));
+
+  /* Both channels must be loaded by the same trigger event */
+  if((hdac->Instance->CR & (DAC_CR_TEN1 | DAC_CR_TSEL1)) !=
+     ((hdac->Instance->CR >> DAC_CHANNEL_2) & (DAC_CR_TEN1 | DAC_CR_TSEL1)))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Process locked */
+  __HAL_LOCK(hdac);
+
+  /* Change DAC state */
+  hdac->State = HAL_DAC_STATE_BUSY;
+
+  if(Channel == DAC_CHANNEL_1)
+  {
+    hdma = hdac->DMA_Handle1;
+  }
+  else
+  {
+    hdma = hdac->DMA_Handle2;
+  }
+
+  /* Set the DMA transfer complete, half transfer complete and error callbacks */
+  hdma->XferCpltCallback = DAC_DMADualConvCplt;
+  hdma->XferHalfCpltCallback = DAC_DMADualHalfConvCplt;
+  hdma->XferErrorCallback = DAC_DMADualError;
+
+  /* Get the dual DAC data holding register address */
+  switch(Alignment)
+  {
+    case DAC_ALIGN_12B_R:
+      /* Get DHR12RD address */
+      tmpreg = (uint32_t)&hdac->Instance->DHR12RD;
+      break;
+    case DAC_ALIGN_12B_L:
+      /* Get DHR12LD address */
+      tmpreg = (uint32_t)&hdac->Instance->DHR12LD;
+      break;
+    case DAC_ALIGN_8B_R:
+      /* Get DHR8RD address */
+      tmpreg = (uint32_t)&hdac->Instance->DHR8RD;
+      break;
+    default:
+      break;
+  }
+
+  /* Enable the DMA request and the DMA underrun interrupt of the requesting channel only */
+  if(Channel == DAC_CHANNEL_1)
+  {
+    hdac->Instance->CR |= DAC_CR_DMAEN1;
+    __HAL_DAC_ENABLE_IT(hdac, DAC_IT_DMAUDR1);
+  }
+  else
+  {
+    hdac->Instance->CR |= DAC_CR_DMAEN2;
+    __HAL_DAC_ENABLE_IT(hdac, DAC_IT_DMAUDR2);
+  }
+
+  /* Enable the DMA Stream */
+  status = HAL_DMA_Start_IT(hdma, (uint32_t)pData, tmpreg, Length);
+
+  if(status == HAL_OK)
+  {
+    /* Enable the Peripheral */
+    __HAL_DAC_ENABLE(hdac, DAC_CHANNEL_1);
+    __HAL_DAC_ENABLE(hdac, DAC_CHANNEL_2);
+  }
+  else
+  {
+    hdac->Instance->CR &= ~(DAC_CR_DMAEN1 | DAC_CR_DMAEN2);
+    hdac->ErrorCode |= HAL_DAC_ERROR_DMA;
+    hdac->State = HAL_DAC_STATE_READY;
+  }
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(hdac);
+
+  /* Return function status */
+  return status;
+}
+
+/**
+  * @brief  Disables DAC and stop conversion of both channels.
+  * @param  hdac: pointer to a DAC_HandleTypeDef structure that contains
+  *         the configuration information for the specified DAC.
+  * @param  Channel: The DAC channel that requests data from DMA.
+  *          This parameter can be one of the following values:
+  *            @arg DAC_CHANNEL_1: DAC Channel1 selected
+  *            @arg DAC_CHANNEL_2: DAC Channel2 selected
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DACEx_DualStop_DMA(DAC_HandleTypeDef* hdac, uint32_t Channel)
+{
+  HAL_StatusTypeDef status;
+
+  /* Check the parameters */
+  assert_param(IS_DAC_CHANNEL(Channel));
+
+  /* Disable the DMA requests of both channels */
+  hdac->Instance->CR &= ~(DAC_CR_DMAEN1 | DAC_CR_DMAEN2);
+
+  /* Disable the Peripheral */
+  __HAL_DAC_DISABLE(hdac, DAC_CHANNEL_1);
+  __HAL_DAC_DISABLE(hdac, DAC_CHANNEL_2);
+
+  /* Disable the DMA Stream and the DAC DMA underrun interrupt */
+  if(Channel == DAC_CHANNEL_1)
+  {
+    status = HAL_DMA_Abort(hdac->DMA_Handle1);
+    __HAL_DAC_DISABLE_IT(hdac, DAC_IT_DMAUDR1);
+  }
+  else
+  {
+    status = HAL_DMA_Abort(hdac->DMA_Handle2);
+    __HAL_DAC_DISABLE_IT(hdac, DAC_IT_DMAUDR2);
+  }
+
+  /* Check if DMA Stream effectively disabled */
+  if(status != HAL_OK)
+  {
+    /* Update DAC state machine to error */
+    hdac->State = HAL_DAC_STATE_ERROR;
+  }
+  else
+  {
+    /* Change DAC state */
+    hdac->State = HAL_DAC_STATE_READY;
+  }
+
+  /* Return function status */
+  return status;
+}
+
+/**
+  * @brief  Enables the triangle wave generation of both DAC channels at the same time.
+  * @param  hdac: pointer to a DAC_HandleTypeDef structure that contains
+  *         the configuration information for the specified DAC.
+  * @param  Amplitude1: Select max triangle amplitude of Channel1.
+  *          This parameter can be a value of @ref DACEx_lfsrunmask_triangleamplitude
+  *          (DAC_TRIANGLEAMPLITUDE_x)
+  * @param  Amplitude2: Select max triangle amplitude of Channel2.
+  *          This parameter can be a value of @ref DACEx_lfsrunmask_triangleamplitude
+  *          (DAC_TRIANGLEAMPLITUDE_x)
+  * @note   The triangle is added to the data holding register value of each channel,
+  *         set the offsets with HAL_DACEx_DualSetValue(). Both channels must be
+  *         configured with the same trigger, otherwise HAL_ERROR is returned.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DACEx_DualTriangleWaveGenerate(DAC_HandleTypeDef* hdac, uint32_t Amplitude1, uint32_t Amplitude2)
+{
+  /* Check the parameters */
+  assert_param(IS_DAC_LFSR_UNMASK_TRIANGLE_AMPLITUDE(Amplitude1));
+  assert_param(IS_DAC_LFSR_UNMASK_TRIANGLE_AMPLITUDE(Amplitude2));
+
+  return DAC_DualWaveGenerate(hdac, DAC_CR_WAVE1_1 | Amplitude1, DAC_CR_WAVE1_1 | Amplitude2);
+}
+
+/**
+  * @brief  Enables the noise wave generation of both DAC channels at the same time.
+  * @param  hdac: pointer to a DAC_HandleTypeDef structure that contains
+  *         the configuration information for the specified DAC.
+  * @param  Amplitude1: Unmask Channel1 LFSR for noise wave generation.
+  *          This parameter can be a value of @ref DACEx_lfsrunmask_triangleamplitude
+  *          (DAC_LFSRUNMASK_x)
+  * @param  Amplitude2: Unmask Channel2 LFSR for noise wave generation.
+  *          This parameter can be a value of @ref DACEx_lfsrunmask_triangleamplitude
+  *          (DAC_LFSRUNMASK_x)
+  * @note   The noise is added to the data holding register value of each channel,
+  *         set the offsets with HAL_DACEx_DualSetValue(). Both channels must be
+  *         configured with the same trigger, otherwise HAL_ERROR is returned.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DACEx_DualNoiseWaveGenerate(DAC_HandleTypeDef* hdac, uint32_t Amplitude1, uint32_t Amplitude2)
+{
+  /* Check the parameters */
+  assert_param(IS_DAC_LFSR_UNMASK_TRIANGLE_AMPLITUDE(Amplitude1));
+  assert_param(IS_DAC_LFSR_UNMASK_TRIANGLE_AMPLITUDE(Amplitude2));
+
+  return DAC_DualWaveGenerate(hdac, DAC_CR_WAVE1_0 | Amplitude1, DAC_CR_WAVE1_0 | Amplitude2);
+}
+
 /**
   * @}
   */
@@ -323,6 +563,53 @@ __weak void HAL_DACEx_DMAUnderrunCallbackCh2(DAC_HandleTypeDef *hdac)
    */
 }
 
+/**
+  * @brief  Dual channel conversion complete callback in non blocking mode.
+  * @note   In circular mode, the second half of the buffer can be refilled.
+  * @param  hdac: pointer to a DAC_HandleTypeDef structure that contains
+  *         the configuration information for the specified DAC.
+  * @retval None
+  */
+__weak void HAL_DACEx_DualConvCpltCallback(DAC_HandleTypeDef* hdac)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hdac);
+  /* NOTE : This function Should not be modified, when the callback is needed,
+            the HAL_DACEx_DualConvCpltCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Dual channel conversion half DMA transfer callback in non blocking mode.
+  * @note   In circular mode, the first half of the buffer can be refilled.
+  * @param  hdac: pointer to a DAC_HandleTypeDef structure that contains
+  *         the configuration information for the specified DAC.
+  * @retval None
+  */
+__weak void HAL_DACEx_DualConvHalfCpltCallback(DAC_HandleTypeDef* hdac)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hdac);
+  /* NOTE : This function Should not be modified, when the callback is needed,
+            the HAL_DACEx_DualConvHalfCpltCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Dual channel error DAC callback.
+  * @param  hdac: pointer to a DAC_HandleTypeDef structure that contains
+  *         the configuration information for the specified DAC.
+  * @retval None
+  */
+__weak void HAL_DACEx_DualErrorCallback(DAC_HandleTypeDef* hdac)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hdac);
+  /* NOTE : This function Should not be modified, when the callback is needed,
+            the HAL_DACEx_DualErrorCallback could be implemented in the user file
+   */
+}
+
 /**
   * @brief  DMA conversion complete callback.
   * @param  hdma: pointer to a DMA_HandleTypeDef structure that contains
@@ -369,6 +656,94 @@ void DAC_DMAErrorCh2(DMA_HandleTypeDef *hdma)
   hdac->State= HAL_DAC_STATE_READY;
 }
 
+/**
+  * @brief  Sets the wave generation of both DAC channels with a single register write.
+  * @param  hdac: pointer to a DAC_HandleTypeDef structure that contains
+  *         the configuration information for the specified DAC.
+  * @param  Wave1: WAVE1 and MAMP1 bits of Channel1.
+  * @param  Wave2: WAVE1 and MAMP1 bits of Channel2 (shifted by the function).
+  * @retval HAL status
+  */
+HAL_StatusTypeDef DAC_DualWaveGenerate(DAC_HandleTypeDef* hdac, uint32_t Wave1, uint32_t Wave2)
+{
+  /* Both channels must step on the same trigger event */
+  if((hdac->Instance->CR & (DAC_CR_TEN1 | DAC_CR_TSEL1)) !=
+     ((hdac->Instance->CR >> DAC_CHANNEL_2) & (DAC_CR_TEN1 | DAC_CR_TSEL1)))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Process locked */
+  __HAL_LOCK(hdac);
+
+  /* Change DAC state */
+  hdac->State = HAL_DAC_STATE_BUSY;
+
+  /* Enable the wave generation of both channels */
+  MODIFY_REG(hdac->Instance->CR,
+             (DAC_CR_WAVE1 | DAC_CR_MAMP1) | ((DAC_CR_WAVE1 | DAC_CR_MAMP1) << DAC_CHANNEL_2),
+             Wave1 | (Wave2 << DAC_CHANNEL_2));
+
+  /* Change DAC state */
+  hdac->State = HAL_DAC_STATE_READY;
+
+  /* Process unlocked */
+  __HAL_UNLOCK(hdac);
+
+  /* Return function status */
+  return HAL_OK;
+}
+
+/**
+  * @brief  DMA dual channel conversion complete callback.
+  * @param  hdma: pointer to a DMA_HandleTypeDef structure that contains
+  *                the configuration information for the specified DMA module.
+  * @retval None
+  */
+static void DAC_DMADualConvCplt(DMA_HandleTypeDef *hdma)
+{
+  DAC_HandleTypeDef* hdac = ( DAC_HandleTypeDef* )((DMA_HandleTypeDef* )hdma)->Parent;
+
+  HAL_DACEx_DualConvCpltCallback(hdac);
+
+  /* In circular mode the conversion is still ongoing */
+  if(hdma->Init.Mode != DMA_CIRCULAR)
+  {
+    hdac->State= HAL_DAC_STATE_READY;
+  }
+}
+
+/**
+  * @brief  DMA dual channel half transfer complete callback.
+  * @param  hdma: pointer to a DMA_HandleTypeDef structure that contains
+  *                the configuration information for the specified DMA module.
+  * @retval None
+  */
+static void DAC_DMADualHalfConvCplt(DMA_HandleTypeDef *hdma)
+{
+  DAC_HandleTypeDef* hdac = ( DAC_HandleTypeDef* )((DMA_HandleTypeDef* )hdma)->Parent;
+
+  HAL_DACEx_DualConvHalfCpltCallback(hdac);
+}
+
+/**
+  * @brief  DMA dual channel error callback
+  * @param  hdma: pointer to a DMA_HandleTypeDef structure that contains
+  *                the configuration information for the specified DMA module.
+  * @retval None
+  */
+static void DAC_DMADualError(DMA_HandleTypeDef *hdma)
+{
+  DAC_HandleTypeDef* hdac = ( DAC_HandleTypeDef* )((DMA_HandleTypeDef* )hdma)->Parent;
+
+  /* Set DAC error code to DMA error */
+  hdac->ErrorCode |= HAL_DAC_ERROR_DMA;
+
+  HAL_DACEx_DualErrorCallback(hdac);
+
+  hdac->State= HAL_DAC_STATE_READY;
+}
+
 /**
   * @}
   */
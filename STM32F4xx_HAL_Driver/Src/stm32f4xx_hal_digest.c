@@ -0,0 +1,1276 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_hal_digest.c
+  * @author  MCD Application Team
+  * @brief   Message digest HAL module driver.
+  *          This file provides firmware functions to compute SHA digests and
+  *          HMACs with the fastest implementation of the device:
+  *           + Initialization and de-initialization functions
+  *           + Digest and HMAC functions
+  *           + Peripheral State functions
+  *
+  @verbatim
+  ==============================================================================
+                  ##### DIGEST features #####
+  ==============================================================================
+  [..]
+    (+) SHA-1, SHA-224, SHA-256, SHA-384 and SHA-512 digests, and their HMAC, of
+        messages given in any number of buffers of any size and alignment.
+
+    (+) The HASH processor computes the algorithms it supports: SHA-1 on the
+        STM32F415xx/417xx, SHA-1, SHA-224 and SHA-256 on the STM32F437xx/439xx/479xx.
+        The large buffers are then fed by DMA in multiple DMA transfers mode.
+        The other algorithms, and all of them on the devices without HASH
+        processor, are computed in software.
+
+    (+) Each handle uses its own stream of the HASH processor, so that several
+        messages can be in progress at the same time.
+
+  ==============================================================================
+                        ##### How to use this driver #####
+  ==============================================================================
+  [..]
+    (#) To use the HASH processor, initialize a HASH handle with HAL_HASH_Init() for
+        8-bit data. Optionally, link to it a DMA handle initialized for memory to
+        peripheral word transfers in normal mode, as for HAL_HASH_SHA1_Start_DMA().
+
+    (#) Declare a DIGEST_HandleTypeDef handle structure, set the algorithm and, when
+        the device has a HASH processor, the HASH handle or NULL, then call
+        HAL_DIGEST_Init(). HAL_DIGEST_GetPath() returns the selected path.
+
+    (#) Compute a digest with HAL_DIGEST_Compute(), or with HAL_DIGEST_Start(),
+        HAL_DIGEST_Update() for each buffer of the message and HAL_DIGEST_Finish().
+
+    (#) Compute an HMAC with HAL_DIGEST_HMAC_Compute(), or with
+        HAL_DIGEST_HMAC_Start(), HAL_DIGEST_Update() for each buffer of the message
+        and HAL_DIGEST_HMAC_Finish().
+
+    [..]
+      (@) The digest size is given by HAL_DIGEST_GetSize(), at most DIGEST_MAX_SIZE.
+      (@) The word aligned buffers of at least DIGEST_DMA_MIN_SIZE bytes are fed by
+          DMA, the CPU waiting for the end of the transfer: HAL_DIGEST_Update() is
+          blocking on both paths.
+      (@) The digest and MAC buffers of the HASH processor path must be word aligned.
+
+  @endverbatim
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2017 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_hal.h"
+
+/** @addtogroup STM32F4xx_HAL_Driver
+  * @{
+  */
+
+/** @defgroup DIGEST DIGEST
+  * @brief Message digest HAL module driver
+  * @{
+  */
+
+#ifdef HAL_DIGEST_MODULE_ENABLED
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/** @defgroup DIGEST_Private_Constants DIGEST Private Constants
+  * @{
+  */
+#define DIGEST_HMAC_IPAD              0x36363636U   /*!< HMAC inner pad, 4 bytes                       */
+#define DIGEST_HMAC_OPAD              0x5C5C5C5CU   /*!< HMAC outer pad, 4 bytes                       */
+#define DIGEST_DMA_MAX_BLOCKS         4095U         /*!< Blocks of 16 words in a DMA transfer of at
+                                                         most 65535 words                              */
+/**
+  * @}
+  */
+
+/* Private macro -------------------------------------------------------------*/
+/** @addtogroup DIGEST_Private_Macros
+  * @{
+  */
+#define DIGEST_ROR32(X, N)            (((X) >> (N)) | ((X) << (32U - (N))))
+#define DIGEST_ROL32(X, N)            (((X) << (N)) | ((X) >> (32U - (N))))
+#define DIGEST_ROR64(X, N)            (((X) >> (N)) | ((X) << (64U - (N))))
+/**
+  * @}
+  */
+
+/* Private variables ---------------------------------------------------------*/
+/** @defgroup DIGEST_Private_Variables DIGEST Private Variables
+  * @{
+  */
+/* SHA-224 and SHA-256 round constants */
+static const uint32_t DIGEST_K256[64] =
+{
+  0x428A2F98U, 0x71374491U, 0xB5C0FBCFU, 0xE9B5DBA5U,
+  0x3956C25BU, 0x59F111F1U, 0x923F82A4U, 0xAB1C5ED5U,
+  0xD807AA98U, 0x12835B01U, 0x243185BEU, 0x550C7DC3U,
+  0x72BE5D74U, 0x80DEB1FEU, 0x9BDC06A7U, 0xC19BF174U,
+  0xE49B69C1U, 0xEFBE4786U, 0x0FC19DC6U, 0x240CA1CCU,
+  0x2DE92C6FU, 0x4A7484AAU, 0x5CB0A9DCU, 0x76F988DAU,
+  0x983E5152U, 0xA831C66DU, 0xB00327C8U, 0xBF597FC7U,
+  0xC6E00BF3U, 0xD5A79147U, 0x06CA6351U, 0x14292967U,
+  0x27B70A85U, 0x2E1B2138U, 0x4D2C6DFCU, 0x53380D13U,
+  0x650A7354U, 0x766A0ABBU, 0x81C2C92EU, 0x92722C85U,
+  0xA2BFE8A1U, 0xA81A664BU, 0xC24B8B70U, 0xC76C51A3U,
+  0xD192E819U, 0xD6990624U, 0xF40E3585U, 0x106AA070U,
+  0x19A4C116U, 0x1E376C08U, 0x2748774CU, 0x34B0BCB5U,
+  0x391C0CB3U, 0x4ED8AA4AU, 0x5B9CCA4FU, 0x682E6FF3U,
+  0x748F82EEU, 0x78A5636FU, 0x84C87814U, 0x8CC70208U,
+  0x90BEFFFAU, 0xA4506CEBU, 0xBEF9A3F7U, 0xC67178F2U
+};
+
+/* SHA-384 and SHA-512 round constants */
+static const uint64_t DIGEST_K512[80] =
+{
+  0x428A2F98D728AE22ULL, 0x7137449123EF65CDULL,
+  0xB5C0FBCFEC4D3B2FULL, 0xE9B5DBA58189DBBCULL,
+  0x3956C25BF348B538ULL, 0x59F111F1B605D019ULL,
+  0x923F82A4AF194F9BULL, 0xAB1C5ED5DA6D8118ULL,
+  0xD807AA98A3030242ULL, 0x12835B0145706FBEULL,
+  0x243185BE4EE4B28CULL, 0x550C7DC3D5FFB4E2ULL,
+  0x72BE5D74F27B896FULL, 0x80DEB1FE3B1696B1ULL,
+  0x9BDC06A725C71235ULL, 0xC19BF174CF692694ULL,
+  0xE49B69C19EF14AD2ULL, 0xEFBE4786384F25E3ULL,
+  0x0FC19DC68B8CD5B5ULL, 0x240CA1CC77AC9C65ULL,
+  0x2DE92C6F592B0275ULL, 0x4A7484AA6EA6E483ULL,
+  0x5CB0A9DCBD41FBD4ULL, 0x76F988DA831153B5ULL,
+  0x983E5152EE66DFABULL, 0xA831C66D2DB43210ULL,
+  0xB00327C898FB213FULL, 0xBF597FC7BEEF0EE4ULL,
+  0xC6E00BF33DA88FC2ULL, 0xD5A79147930AA725ULL,
+  0x06CA6351E003826FULL, 0x142929670A0E6E70ULL,
+  0x27B70A8546D22FFCULL, 0x2E1B21385C26C926ULL,
+  0x4D2C6DFC5AC42AEDULL, 0x53380D139D95B3DFULL,
+  0x650A73548BAF63DEULL, 0x766A0ABB3C77B2A8ULL,
+  0x81C2C92E47EDAEE6ULL, 0x92722C851482353BULL,
+  0xA2BFE8A14CF10364ULL, 0xA81A664BBC423001ULL,
+  0xC24B8B70D0F89791ULL, 0xC76C51A30654BE30ULL,
+  0xD192E819D6EF5218ULL, 0xD69906245565A910ULL,
+  0xF40E35855771202AULL, 0x106AA07032BBD1B8ULL,
+  0x19A4C116B8D2D0C8ULL, 0x1E376C085141AB53ULL,
+  0x2748774CDF8EEB99ULL, 0x34B0BCB5E19B48A8ULL,
+  0x391C0CB3C5C95A63ULL, 0x4ED8AA4AE3418ACBULL,
+  0x5B9CCA4F7763E373ULL, 0x682E6FF3D6B2B8A3ULL,
+  0x748F82EE5DEFB2FCULL, 0x78A5636F43172F60ULL,
+  0x84C87814A1F0AB72ULL, 0x8CC702081A6439ECULL,
+  0x90BEFFFA23631E28ULL, 0xA4506CEBDE82BDE9ULL,
+  0xBEF9A3F7B2C67915ULL, 0xC67178F2E372532BULL,
+  0xCA273ECEEA26619CULL, 0xD186B8C721C0C207ULL,
+  0xEADA7DD6CDE0EB1EULL, 0xF57D4F7FEE6ED178ULL,
+  0x06F067AA72176FBAULL, 0x0A637DC5A2C898A6ULL,
+  0x113F9804BEF90DAEULL, 0x1B710B35131C471BULL,
+  0x28DB77F523047D84ULL, 0x32CAAB7B40C72493ULL,
+  0x3C9EBE0A15C9BEBCULL, 0x431D67C49C100D4CULL,
+  0x4CC5D4BECB3E42B6ULL, 0x597F299CFC657E2AULL,
+  0x5FCB6FAB3AD6FAECULL, 0x6C44198C4A475817ULL
+};
+
+/* Initial chaining values */
+static const uint32_t DIGEST_H1[5] =
+{
+  0x67452301U, 0xEFCDAB89U, 0x98BADCFEU, 0x10325476U,
+  0xC3D2E1F0U
+};
+
+static const uint32_t DIGEST_H224[8] =
+{
+  0xC1059ED8U, 0x367CD507U, 0x3070DD17U, 0xF70E5939U,
+  0xFFC00B31U, 0x68581511U, 0x64F98FA7U, 0xBEFA4FA4U
+};
+
+static const uint32_t DIGEST_H256[8] =
+{
+  0x6A09E667U, 0xBB67AE85U, 0x3C6EF372U, 0xA54FF53AU,
+  0x510E527FU, 0x9B05688CU, 0x1F83D9ABU, 0x5BE0CD19U
+};
+
+static const uint64_t DIGEST_H384[8] =
+{
+  0xCBBB9D5DC1059ED8ULL, 0x629A292A367CD507ULL,
+  0x9159015A3070DD17ULL, 0x152FECD8F70E5939ULL,
+  0x67332667FFC00B31ULL, 0x8EB44A8768581511ULL,
+  0xDB0C2E0D64F98FA7ULL, 0x47B5481DBEFA4FA4ULL
+};
+
+static const uint64_t DIGEST_H512[8] =
+{
+  0x6A09E667F3BCC908ULL, 0xBB67AE8584CAA73BULL,
+  0x3C6EF372FE94F82BULL, 0xA54FF53A5F1D36F1ULL,
+  0x510E527FADE682D1ULL, 0x9B05688C2B3E6C1FULL,
+  0x1F83D9ABFB41BD6BULL, 0x5BE0CD19137E2179ULL
+};
+/**
+  * @}
+  */
+
+/* Private function prototypes -----------------------------------------------*/
+/** @defgroup DIGEST_Private_Functions DIGEST Private Functions
+  * @{
+  */
+static uint32_t DIGEST_BlockSize(uint32_t Algorithm);
+static uint32_t DIGEST_Size(uint32_t Algorithm);
+static HAL_StatusTypeDef DIGEST_Begin(DIGEST_HandleTypeDef *hdigest);
+static HAL_StatusTypeDef DIGEST_Feed(DIGEST_HandleTypeDef *hdigest, const uint8_t *pData, uint32_t Size, uint32_t Timeout);
+static HAL_StatusTypeDef DIGEST_End(DIGEST_HandleTypeDef *hdigest, uint8_t *pDigest, uint32_t Timeout);
+static void DIGEST_SoftUpdate(DIGEST_HandleTypeDef *hdigest, const uint8_t *pData, uint32_t Size);
+static void DIGEST_SoftFinish(DIGEST_HandleTypeDef *hdigest, uint8_t *pDigest);
+static void DIGEST_SoftBlocks(DIGEST_HandleTypeDef *hdigest, const uint8_t *pData, uint32_t NbBlocks);
+static void DIGEST_SHA1_Blocks(uint64_t *pChain, const uint8_t *pData, uint32_t NbBlocks);
+static void DIGEST_SHA256_Blocks(uint64_t *pChain, const uint8_t *pData, uint32_t NbBlocks);
+static void DIGEST_SHA512_Blocks(uint64_t *pChain, const uint8_t *pData, uint32_t NbBlocks);
+#if defined(DIGEST_HASH_SHA1)
+static HAL_StatusTypeDef DIGEST_HashUpdate(DIGEST_HandleTypeDef *hdigest, const uint8_t *pData, uint32_t Size, uint32_t Timeout);
+#endif /* DIGEST_HASH_SHA1 */
+static void DIGEST_Wipe(uint32_t *pBuffer, uint32_t NbWords);
+/**
+  * @}
+  */
+
+/* Exported functions --------------------------------------------------------*/
+/** @defgroup DIGEST_Exported_Functions DIGEST Exported Functions
+  * @{
+  */
+
+/** @defgroup DIGEST_Exported_Functions_Group1 Initialization and de-initialization functions
+ *  @brief    Initialization and de-initialization functions
+ *
+@verbatim
+  ==============================================================================
+            ##### Initialization and de-initialization functions #####
+  ==============================================================================
+    [..]  This section provides functions allowing to:
+      (+) Initialize a digest handle and select its path
+      (+) De-initialize a digest handle
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Initializes a digest handle, selects the HASH processor when it computes the
+  *         algorithm and starts a message.
+  * @param  hdigest: pointer to a DIGEST_HandleTypeDef structure
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DIGEST_Init(DIGEST_HandleTypeDef *hdigest)
+{
+  /* Check the DIGEST handle allocation */
+  if(hdigest == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the parameters */
+  assert_param(IS_DIGEST_ALGORITHM(hdigest->Init.Algorithm));
+
+  hdigest->Path = DIGEST_PATH_SOFTWARE;
+
+#if defined(DIGEST_HASH_SHA1)
+  if((hdigest->Init.hhash != NULL) && (hdigest->Init.hhash->Init.DataType == HASH_DATATYPE_8B))
+  {
+    if(hdigest->Init.Algorithm == DIGEST_ALGO_SHA1)
+    {
+      hdigest->Path = DIGEST_PATH_HASH;
+    }
+#if defined(DIGEST_HASH_SHA256)
+    if((hdigest->Init.Algorithm == DIGEST_ALGO_SHA224) || (hdigest->Init.Algorithm == DIGEST_ALGO_SHA256))
+    {
+      hdigest->Path = DIGEST_PATH_HASH;
+    }
+#endif /* DIGEST_HASH_SHA256 */
+  }
+#endif /* DIGEST_HASH_SHA1 */
+
+  hdigest->Hmac = 0U;
+  hdigest->State = HAL_DIGEST_STATE_READY;
+
+  return HAL_DIGEST_Start(hdigest);
+}
+
+/**
+  * @brief  De-initializes a digest handle, the HMAC key is erased.
+  * @param  hdigest: pointer to a DIGEST_HandleTypeDef structure
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DIGEST_DeInit(DIGEST_HandleTypeDef *hdigest)
+{
+  /* Check the DIGEST handle allocation */
+  if(hdigest == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  DIGEST_Wipe(hdigest->Pad, DIGEST_MAX_BLOCK_SIZE / 4U);
+  DIGEST_Wipe(hdigest->Block, DIGEST_MAX_BLOCK_SIZE / 4U);
+  hdigest->Hmac = 0U;
+  hdigest->State = HAL_DIGEST_STATE_RESET;
+
+  return HAL_OK;
+}
+
+/**
+  * @}
+  */
+
+/** @defgroup DIGEST_Exported_Functions_Group2 Digest functions
+ *  @brief    Digest and HMAC functions
+ *
+@verbatim
+  ==============================================================================
+                      ##### Digest functions #####
+  ==============================================================================
+    [..]  This section provides functions allowing to:
+      (+) Compute the digest of a message given in one or several buffers
+      (+) Compute the HMAC of a message given in one or several buffers
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Starts a new message, the message in progress is discarded.
+  * @param  hdigest: pointer to a DIGEST_HandleTypeDef structure
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DIGEST_Start(DIGEST_HandleTypeDef *hdigest)
+{
+  if(hdigest->State == HAL_DIGEST_STATE_RESET)
+  {
+    return HAL_ERROR;
+  }
+
+  hdigest->Hmac = 0U;
+
+  return DIGEST_Begin(hdigest);
+}
+
+/**
+  * @brief  Feeds a buffer of the message.
+  * @param  hdigest: pointer to a DIGEST_HandleTypeDef structure
+  * @param  pData: pointer to the buffer, without alignment constraint. Word aligned
+  *         buffers of at least DIGEST_DMA_MIN_SIZE bytes are fed by DMA when possible.
+  * @param  Size: number of bytes
+  * @param  Timeout: Timeout value of the HASH processor
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DIGEST_Update(DIGEST_HandleTypeDef *hdigest, const uint8_t *pData, uint32_t Size, uint32_t Timeout)
+{
+  if(hdigest->State != HAL_DIGEST_STATE_BUSY)
+  {
+    return HAL_ERROR;
+  }
+
+  return DIGEST_Feed(hdigest, pData, Size, Timeout);
+}
+
+/**
+  * @brief  Ends the message and returns its digest.
+  * @param  hdigest: pointer to a DIGEST_HandleTypeDef structure
+  * @param  pDigest: pointer to the digest, of HAL_DIGEST_GetSize() bytes
+  * @param  Timeout: Timeout value of the HASH processor
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DIGEST_Finish(DIGEST_HandleTypeDef *hdigest, uint8_t *pDigest, uint32_t Timeout)
+{
+  HAL_StatusTypeDef status;
+
+  if((hdigest->State != HAL_DIGEST_STATE_BUSY) || (hdigest->Hmac != 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  status = DIGEST_End(hdigest, pDigest, Timeout);
+  if(status == HAL_OK)
+  {
+    hdigest->State = HAL_DIGEST_STATE_READY;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Computes the digest of a message.
+  * @param  hdigest: pointer to a DIGEST_HandleTypeDef structure
+  * @param  pData: pointer to the message
+  * @param  Size: number of bytes
+  * @param  pDigest: pointer to the digest, of HAL_DIGEST_GetSize() bytes
+  * @param  Timeout: Timeout value of the HASH processor
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DIGEST_Compute(DIGEST_HandleTypeDef *hdigest, const uint8_t *pData, uint32_t Size, uint8_t *pDigest,
+                                     uint32_t Timeout)
+{
+  HAL_StatusTypeDef status;
+
+  status = HAL_DIGEST_Start(hdigest);
+  if(status == HAL_OK)
+  {
+    status = HAL_DIGEST_Update(hdigest, pData, Size, Timeout);
+  }
+  if(status == HAL_OK)
+  {
+    status = HAL_DIGEST_Finish(hdigest, pDigest, Timeout);
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Starts a new HMAC message, the message in progress is discarded.
+  * @note   The message is then fed with HAL_DIGEST_Update(). The key is kept in the
+  *         handle until HAL_DIGEST_HMAC_Finish() or HAL_DIGEST_DeInit().
+  * @param  hdigest: pointer to a DIGEST_HandleTypeDef structure
+  * @param  pKey: pointer to the key
+  * @param  KeySize: number of bytes of the key, keys longer than the block size
+  *         being replaced by their digest
+  * @param  Timeout: Timeout value of the HASH processor
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DIGEST_HMAC_Start(DIGEST_HandleTypeDef *hdigest, const uint8_t *pKey, uint32_t KeySize, uint32_t Timeout)
+{
+  uint32_t ipad[DIGEST_MAX_BLOCK_SIZE / 4U];
+  uint8_t *pkey = (uint8_t *)hdigest->Pad;
+  uint32_t blocksize;
+  uint32_t i;
+  HAL_StatusTypeDef status = HAL_OK;
+
+  if((hdigest->State == HAL_DIGEST_STATE_RESET) || ((pKey == NULL) && (KeySize != 0U)))
+  {
+    return HAL_ERROR;
+  }
+
+  blocksize = DIGEST_BlockSize(hdigest->Init.Algorithm);
+  DIGEST_Wipe(hdigest->Pad, DIGEST_MAX_BLOCK_SIZE / 4U);
+
+  /* Key padded with zeros to the block size */
+  if(KeySize > blocksize)
+  {
+    hdigest->Hmac = 0U;
+    status = DIGEST_Begin(hdigest);
+    if(status == HAL_OK)
+    {
+      status = DIGEST_Feed(hdigest, pKey, KeySize, Timeout);
+    }
+    if(status == HAL_OK)
+    {
+      status = DIGEST_End(hdigest, pkey, Timeout);
+    }
+  }
+  else
+  {
+    for(i = 0U; i < KeySize; i++)
+    {
+      pkey[i] = pKey[i];
+    }
+  }
+
+  /* Inner pad hashed first, outer pad kept for HAL_DIGEST_HMAC_Finish() */
+  for(i = 0U; i < (blocksize / 4U); i++)
+  {
+    ipad[i] = hdigest->Pad[i] ^ DIGEST_HMAC_IPAD;
+    hdigest->Pad[i] ^= DIGEST_HMAC_OPAD;
+  }
+
+  if(status == HAL_OK)
+  {
+    status = DIGEST_Begin(hdigest);
+  }
+  if(status == HAL_OK)
+  {
+    status = DIGEST_Feed(hdigest, (uint8_t *)ipad, blocksize, Timeout);
+  }
+  DIGEST_Wipe(ipad, DIGEST_MAX_BLOCK_SIZE / 4U);
+
+  if(status == HAL_OK)
+  {
+    hdigest->Hmac = 1U;
+  }
+  else
+  {
+    DIGEST_Wipe(hdigest->Pad, DIGEST_MAX_BLOCK_SIZE / 4U);
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Ends the HMAC message and returns its MAC.
+  * @param  hdigest: pointer to a DIGEST_HandleTypeDef structure
+  * @param  pMac: pointer to the MAC, of HAL_DIGEST_GetSize() bytes
+  * @param  Timeout: Timeout value of the HASH processor
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DIGEST_HMAC_Finish(DIGEST_HandleTypeDef *hdigest, uint8_t *pMac, uint32_t Timeout)
+{
+  uint32_t inner[DIGEST_MAX_SIZE / 4U];
+  HAL_StatusTypeDef status;
+
+  if((hdigest->State != HAL_DIGEST_STATE_BUSY) || (hdigest->Hmac == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  status = DIGEST_End(hdigest, (uint8_t *)inner, Timeout);
+  if(status == HAL_OK)
+  {
+    status = DIGEST_Begin(hdigest);
+  }
+  if(status == HAL_OK)
+  {
+    status = DIGEST_Feed(hdigest, (uint8_t *)hdigest->Pad, DIGEST_BlockSize(hdigest->Init.Algorithm), Timeout);
+  }
+  if(status == HAL_OK)
+  {
+    status = DIGEST_Feed(hdigest, (uint8_t *)inner, DIGEST_Size(hdigest->Init.Algorithm), Timeout);
+  }
+  if(status == HAL_OK)
+  {
+    status = DIGEST_End(hdigest, pMac, Timeout);
+  }
+
+  DIGEST_Wipe(inner, DIGEST_MAX_SIZE / 4U);
+  DIGEST_Wipe(hdigest->Pad, DIGEST_MAX_BLOCK_SIZE / 4U);
+  hdigest->Hmac = 0U;
+  if(status == HAL_OK)
+  {
+    hdigest->State = HAL_DIGEST_STATE_READY;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Computes the HMAC of a message.
+  * @param  hdigest: pointer to a DIGEST_HandleTypeDef structure
+  * @param  pKey: pointer to the key
+  * @param  KeySize: number of bytes of the key
+  * @param  pData: pointer to the message
+  * @param  Size: number of bytes
+  * @param  pMac: pointer to the MAC, of HAL_DIGEST_GetSize() bytes
+  * @param  Timeout: Timeout value of the HASH processor
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DIGEST_HMAC_Compute(DIGEST_HandleTypeDef *hdigest, const uint8_t *pKey, uint32_t KeySize,
+                                          const uint8_t *pData, uint32_t Size, uint8_t *pMac, uint32_t Timeout)
+{
+  HAL_StatusTypeDef status;
+
+  status = HAL_DIGEST_HMAC_Start(hdigest, pKey, KeySize, Timeout);
+  if(status == HAL_OK)
+  {
+    status = HAL_DIGEST_Update(hdigest, pData, Size, Timeout);
+  }
+  if(status == HAL_OK)
+  {
+    status = HAL_DIGEST_HMAC_Finish(hdigest, pMac, Timeout);
+  }
+
+  return status;
+}
+
+/**
+  * @}
+  */
+
+/** @defgroup DIGEST_Exported_Functions_Group3 Peripheral State functions
+ *  @brief    Peripheral State functions
+ *
+@verbatim
+  ==============================================================================
+                      ##### Peripheral State functions #####
+  ==============================================================================
+    [..]
+    This subsection permits to get in run-time the state and the path of a
+    digest handle.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Returns the DIGEST state.
+  * @param  hdigest: pointer to a DIGEST_HandleTypeDef structure
+  * @retval HAL state
+  */
+HAL_DIGEST_StateTypeDef HAL_DIGEST_GetState(DIGEST_HandleTypeDef *hdigest)
+{
+  return hdigest->State;
+}
+
+/**
+  * @brief  Returns the path selected by HAL_DIGEST_Init().
+  * @param  hdigest: pointer to a DIGEST_HandleTypeDef structure
+  * @retval Path, a value of @ref DIGEST_Path
+  */
+uint32_t HAL_DIGEST_GetPath(DIGEST_HandleTypeDef *hdigest)
+{
+  return hdigest->Path;
+}
+
+/**
+  * @brief  Returns the digest size of the algorithm.
+  * @param  hdigest: pointer to a DIGEST_HandleTypeDef structure
+  * @retval Digest size in bytes
+  */
+uint32_t HAL_DIGEST_GetSize(DIGEST_HandleTypeDef *hdigest)
+{
+  return DIGEST_Size(hdigest->Init.Algorithm);
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/** @addtogroup DIGEST_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Returns the block size of an algorithm.
+  * @param  Algorithm: a value of @ref DIGEST_Algorithm
+  * @retval Block size in bytes
+  */
+static uint32_t DIGEST_BlockSize(uint32_t Algorithm)
+{
+  return (Algorithm >= DIGEST_ALGO_SHA384) ? 128U : 64U;
+}
+
+/**
+  * @brief  Returns the digest size of an algorithm.
+  * @param  Algorithm: a value of @ref DIGEST_Algorithm
+  * @retval Digest size in bytes
+  */
+static uint32_t DIGEST_Size(uint32_t Algorithm)
+{
+  uint32_t size;
+
+  switch(Algorithm)
+  {
+  case DIGEST_ALGO_SHA224:
+    size = 28U;
+    break;
+  case DIGEST_ALGO_SHA256:
+    size = 32U;
+    break;
+  case DIGEST_ALGO_SHA384:
+    size = 48U;
+    break;
+  case DIGEST_ALGO_SHA512:
+    size = 64U;
+    break;
+  default:
+    size = 20U;
+    break;
+  }
+
+  return size;
+}
+
+/**
+  * @brief  Starts a message on the selected path.
+  * @param  hdigest: pointer to a DIGEST_HandleTypeDef structure
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef DIGEST_Begin(DIGEST_HandleTypeDef *hdigest)
+{
+  uint32_t i;
+
+  hdigest->Length = 0U;
+  hdigest->BlockSize = 0U;
+  hdigest->State = HAL_DIGEST_STATE_BUSY;
+
+#if defined(DIGEST_HASH_SHA1)
+  if(hdigest->Path == DIGEST_PATH_HASH)
+  {
+    uint32_t algorithm = HASH_ALGOSELECTION_SHA1;
+
+#if defined(DIGEST_HASH_SHA256)
+    if(hdigest->Init.Algorithm == DIGEST_ALGO_SHA224)
+    {
+      algorithm = HASH_ALGOSELECTION_SHA224;
+    }
+    else if(hdigest->Init.Algorithm == DIGEST_ALGO_SHA256)
+    {
+      algorithm = HASH_ALGOSELECTION_SHA256;
+    }
+    else
+    {
+      /* SHA-1 */
+    }
+#endif /* DIGEST_HASH_SHA256 */
+    return HAL_HASH_StreamInit(hdigest->Init.hhash, &hdigest->Stream, algorithm);
+  }
+#endif /* DIGEST_HASH_SHA1 */
+
+  for(i = 0U; i < 8U; i++)
+  {
+    switch(hdigest->Init.Algorithm)
+    {
+    case DIGEST_ALGO_SHA224:
+      hdigest->Chain[i] = DIGEST_H224[i];
+      break;
+    case DIGEST_ALGO_SHA256:
+      hdigest->Chain[i] = DIGEST_H256[i];
+      break;
+    case DIGEST_ALGO_SHA384:
+      hdigest->Chain[i] = DIGEST_H384[i];
+      break;
+    case DIGEST_ALGO_SHA512:
+      hdigest->Chain[i] = DIGEST_H512[i];
+      break;
+    default:
+      hdigest->Chain[i] = (i < 5U) ? DIGEST_H1[i] : 0U;
+      break;
+    }
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Feeds a buffer to the selected path.
+  * @param  hdigest: pointer to a DIGEST_HandleTypeDef structure
+  * @param  pData: pointer to the buffer
+  * @param  Size: number of bytes
+  * @param  Timeout: Timeout value of the HASH processor
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef DIGEST_Feed(DIGEST_HandleTypeDef *hdigest, const uint8_t *pData, uint32_t Size, uint32_t Timeout)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+
+#if defined(DIGEST_HASH_SHA1)
+  if(hdigest->Path == DIGEST_PATH_HASH)
+  {
+    status = DIGEST_HashUpdate(hdigest, pData, Size, Timeout);
+    if(status != HAL_OK)
+    {
+      hdigest->State = HAL_DIGEST_STATE_ERROR;
+    }
+    return status;
+  }
+#else
+  UNUSED(Timeout);
+#endif /* DIGEST_HASH_SHA1 */
+
+  DIGEST_SoftUpdate(hdigest, pData, Size);
+
+  return status;
+}
+
+/**
+  * @brief  Ends the message on the selected path.
+  * @param  hdigest: pointer to a DIGEST_HandleTypeDef structure
+  * @param  pDigest: pointer to the digest
+  * @param  Timeout: Timeout value of the HASH processor
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef DIGEST_End(DIGEST_HandleTypeDef *hdigest, uint8_t *pDigest, uint32_t Timeout)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+
+#if defined(DIGEST_HASH_SHA1)
+  if(hdigest->Path == DIGEST_PATH_HASH)
+  {
+    status = HAL_HASH_StreamFinish(hdigest->Init.hhash, &hdigest->Stream, pDigest, Timeout);
+    if(status != HAL_OK)
+    {
+      hdigest->State = HAL_DIGEST_STATE_ERROR;
+    }
+    return status;
+  }
+#else
+  UNUSED(Timeout);
+#endif /* DIGEST_HASH_SHA1 */
+
+  DIGEST_SoftFinish(hdigest, pDigest);
+
+  return status;
+}
+
+/**
+  * @brief  Feeds a buffer to the software path, the whole blocks being processed
+  *         directly from the buffer.
+  * @param  hdigest: pointer to a DIGEST_HandleTypeDef structure
+  * @param  pData: pointer to the buffer
+  * @param  Size: number of bytes
+  * @retval None
+  */
+static void DIGEST_SoftUpdate(DIGEST_HandleTypeDef *hdigest, const uint8_t *pData, uint32_t Size)
+{
+  uint8_t *pblock = (uint8_t *)hdigest->Block;
+  uint32_t blocksize = DIGEST_BlockSize(hdigest->Init.Algorithm);
+  const uint8_t *pdata = pData;
+  uint32_t size = Size;
+  uint32_t nbblocks;
+
+  hdigest->Length += size;
+
+  /* Complete the pending block */
+  if(hdigest->BlockSize != 0U)
+  {
+    while((hdigest->BlockSize < blocksize) && (size > 0U))
+    {
+      pblock[hdigest->BlockSize] = *pdata;
+      hdigest->BlockSize++;
+      pdata++;
+      size--;
+    }
+    if(hdigest->BlockSize == blocksize)
+    {
+      DIGEST_SoftBlocks(hdigest, pblock, 1U);
+      hdigest->BlockSize = 0U;
+    }
+  }
+
+  nbblocks = size / blocksize;
+  if(nbblocks != 0U)
+  {
+    DIGEST_SoftBlocks(hdigest, pdata, nbblocks);
+    pdata += nbblocks * blocksize;
+    size -= nbblocks * blocksize;
+  }
+
+  /* Keep the last bytes for the next buffer */
+  while(size > 0U)
+  {
+    pblock[hdigest->BlockSize] = *pdata;
+    hdigest->BlockSize++;
+    pdata++;
+    size--;
+  }
+}
+
+/**
+  * @brief  Pads the message of the software path and returns its digest.
+  * @param  hdigest: pointer to a DIGEST_HandleTypeDef structure
+  * @param  pDigest: pointer to the digest
+  * @retval None
+  */
+static void DIGEST_SoftFinish(DIGEST_HandleTypeDef *hdigest, uint8_t *pDigest)
+{
+  uint8_t *pblock = (uint8_t *)hdigest->Block;
+  uint32_t blocksize = DIGEST_BlockSize(hdigest->Init.Algorithm);
+  uint32_t size = DIGEST_Size(hdigest->Init.Algorithm);
+  uint64_t bitlength = hdigest->Length << 3U;
+  uint32_t i;
+
+  /* Padding: one bit, zeros, then the message length in bits, big endian, in the
+     last 8 bytes of the block (16 bytes for SHA-384/512, the 8 first being 0) */
+  pblock[hdigest->BlockSize] = 0x80U;
+  hdigest->BlockSize++;
+
+  if(hdigest->BlockSize > (blocksize - (blocksize / 8U)))
+  {
+    while(hdigest->BlockSize < blocksize)
+    {
+      pblock[hdigest->BlockSize] = 0U;
+      hdigest->BlockSize++;
+    }
+    DIGEST_SoftBlocks(hdigest, pblock, 1U);
+    hdigest->BlockSize = 0U;
+  }
+
+  while(hdigest->BlockSize < (blocksize - 8U))
+  {
+    pblock[hdigest->BlockSize] = 0U;
+    hdigest->BlockSize++;
+  }
+  if(blocksize == 128U)
+  {
+    pblock[blocksize - 9U] = (uint8_t)(hdigest->Length >> 61U);
+  }
+  for(i = 0U; i < 8U; i++)
+  {
+    pblock[blocksize - 1U - i] = (uint8_t)(bitlength >> (8U * i));
+  }
+  DIGEST_SoftBlocks(hdigest, pblock, 1U);
+  hdigest->BlockSize = 0U;
+
+  /* Chaining value, big endian, truncated to the digest size */
+  if(blocksize == 128U)
+  {
+    for(i = 0U; i < size; i++)
+    {
+      pDigest[i] = (uint8_t)(hdigest->Chain[i / 8U] >> (56U - (8U * (i % 8U))));
+    }
+  }
+  else
+  {
+    for(i = 0U; i < size; i++)
+    {
+      pDigest[i] = (uint8_t)(hdigest->Chain[i / 4U] >> (24U - (8U * (i % 4U))));
+    }
+  }
+}
+
+/**
+  * @brief  Processes whole blocks on the software path.
+  * @param  hdigest: pointer to a DIGEST_HandleTypeDef structure
+  * @param  pData: pointer to the blocks
+  * @param  NbBlocks: number of blocks
+  * @retval None
+  */
+static void DIGEST_SoftBlocks(DIGEST_HandleTypeDef *hdigest, const uint8_t *pData, uint32_t NbBlocks)
+{
+  switch(hdigest->Init.Algorithm)
+  {
+  case DIGEST_ALGO_SHA224:
+  case DIGEST_ALGO_SHA256:
+    DIGEST_SHA256_Blocks(hdigest->Chain, pData, NbBlocks);
+    break;
+  case DIGEST_ALGO_SHA384:
+  case DIGEST_ALGO_SHA512:
+    DIGEST_SHA512_Blocks(hdigest->Chain, pData, NbBlocks);
+    break;
+  default:
+    DIGEST_SHA1_Blocks(hdigest->Chain, pData, NbBlocks);
+    break;
+  }
+}
+
+/**
+  * @brief  SHA-1 compression of whole blocks.
+  * @note   The message schedule is computed in place, in a 16-word window.
+  * @param  pChain: chaining value, 5 words
+  * @param  pData: pointer to the blocks of 64 bytes
+  * @param  NbBlocks: number of blocks
+  * @retval None
+  */
+static void DIGEST_SHA1_Blocks(uint64_t *pChain, const uint8_t *pData, uint32_t NbBlocks)
+{
+  uint32_t w[16];
+  uint32_t a, b, c, d, e, f, k, temp;
+  uint32_t t;
+  uint32_t n;
+  const uint8_t *pblock = pData;
+
+  for(n = 0U; n < NbBlocks; n++)
+  {
+    a = (uint32_t)pChain[0];
+    b = (uint32_t)pChain[1];
+    c = (uint32_t)pChain[2];
+    d = (uint32_t)pChain[3];
+    e = (uint32_t)pChain[4];
+
+    for(t = 0U; t < 80U; t++)
+    {
+      if(t < 16U)
+      {
+        w[t] = ((uint32_t)pblock[4U * t] << 24U) | ((uint32_t)pblock[(4U * t) + 1U] << 16U) |
+               ((uint32_t)pblock[(4U * t) + 2U] << 8U) | (uint32_t)pblock[(4U * t) + 3U];
+      }
+      else
+      {
+        temp = w[(t - 3U) & 15U] ^ w[(t - 8U) & 15U] ^ w[(t - 14U) & 15U] ^ w[t & 15U];
+        w[t & 15U] = DIGEST_ROL32(temp, 1U);
+      }
+
+      if(t < 20U)
+      {
+        f = (b & c) | (~b & d);
+        k = 0x5A827999U;
+      }
+      else if(t < 40U)
+      {
+        f = b ^ c ^ d;
+        k = 0x6ED9EBA1U;
+      }
+      else if(t < 60U)
+      {
+        f = (b & c) | (b & d) | (c & d);
+        k = 0x8F1BBCDCU;
+      }
+      else
+      {
+        f = b ^ c ^ d;
+        k = 0xCA62C1D6U;
+      }
+
+      temp = DIGEST_ROL32(a, 5U) + f + e + k + w[t & 15U];
+      e = d;
+      d = c;
+      c = DIGEST_ROL32(b, 30U);
+      b = a;
+      a = temp;
+    }
+
+    pChain[0] = (uint32_t)(pChain[0] + a);
+    pChain[1] = (uint32_t)(pChain[1] + b);
+    pChain[2] = (uint32_t)(pChain[2] + c);
+    pChain[3] = (uint32_t)(pChain[3] + d);
+    pChain[4] = (uint32_t)(pChain[4] + e);
+    pblock += 64U;
+  }
+}
+
+/**
+  * @brief  SHA-224/256 compression of whole blocks.
+  * @note   The message schedule is computed in place, in a 16-word window.
+  * @param  pChain: chaining value, 8 words
+  * @param  pData: pointer to the blocks of 64 bytes
+  * @param  NbBlocks: number of blocks
+  * @retval None
+  */
+static void DIGEST_SHA256_Blocks(uint64_t *pChain, const uint8_t *pData, uint32_t NbBlocks)
+{
+  uint32_t w[16];
+  uint32_t s[8];
+  uint32_t s0, s1, t1, t2;
+  uint32_t t;
+  uint32_t i;
+  uint32_t n;
+  const uint8_t *pblock = pData;
+
+  for(n = 0U; n < NbBlocks; n++)
+  {
+    for(i = 0U; i < 8U; i++)
+    {
+      s[i] = (uint32_t)pChain[i];
+    }
+
+    for(t = 0U; t < 64U; t++)
+    {
+      if(t < 16U)
+      {
+        w[t] = ((uint32_t)pblock[4U * t] << 24U) | ((uint32_t)pblock[(4U * t) + 1U] << 16U) |
+               ((uint32_t)pblock[(4U * t) + 2U] << 8U) | (uint32_t)pblock[(4U * t) + 3U];
+      }
+      else
+      {
+        s0 = w[(t - 15U) & 15U];
+        s0 = DIGEST_ROR32(s0, 7U) ^ DIGEST_ROR32(s0, 18U) ^ (s0 >> 3U);
+        s1 = w[(t - 2U) & 15U];
+        s1 = DIGEST_ROR32(s1, 17U) ^ DIGEST_ROR32(s1, 19U) ^ (s1 >> 10U);
+        w[t & 15U] += s0 + s1 + w[(t - 7U) & 15U];
+      }
+
+      t1 = s[7] + (DIGEST_ROR32(s[4], 6U) ^ DIGEST_ROR32(s[4], 11U) ^ DIGEST_ROR32(s[4], 25U)) +
+           ((s[4] & s[5]) ^ (~s[4] & s[6])) + DIGEST_K256[t] + w[t & 15U];
+      t2 = (DIGEST_ROR32(s[0], 2U) ^ DIGEST_ROR32(s[0], 13U) ^ DIGEST_ROR32(s[0], 22U)) +
+           ((s[0] & s[1]) ^ (s[0] & s[2]) ^ (s[1] & s[2]));
+      s[7] = s[6];
+      s[6] = s[5];
+      s[5] = s[4];
+      s[4] = s[3] + t1;
+      s[3] = s[2];
+      s[2] = s[1];
+      s[1] = s[0];
+      s[0] = t1 + t2;
+    }
+
+    for(i = 0U; i < 8U; i++)
+    {
+      pChain[i] = (uint32_t)(pChain[i] + s[i]);
+    }
+    pblock += 64U;
+  }
+}
+
+/**
+  * @brief  SHA-384/512 compression of whole blocks.
+  * @note   The message schedule is computed in place, in a 16-word window.
+  * @param  pChain: chaining value, 8 double words
+  * @param  pData: pointer to the blocks of 128 bytes
+  * @param  NbBlocks: number of blocks
+  * @retval None
+  */
+static void DIGEST_SHA512_Blocks(uint64_t *pChain, const uint8_t *pData, uint32_t NbBlocks)
+{
+  uint64_t w[16];
+  uint64_t s[8];
+  uint64_t s0, s1, t1, t2;
+  uint32_t t;
+  uint32_t i;
+  uint32_t n;
+  const uint8_t *pblock = pData;
+
+  for(n = 0U; n < NbBlocks; n++)
+  {
+    for(i = 0U; i < 8U; i++)
+    {
+      s[i] = pChain[i];
+    }
+
+    for(t = 0U; t < 80U; t++)
+    {
+      if(t < 16U)
+      {
+        w[t] = 0U;
+        for(i = 0U; i < 8U; i++)
+        {
+          w[t] = (w[t] << 8U) | pblock[(8U * t) + i];
+        }
+      }
+      else
+      {
+        s0 = w[(t - 15U) & 15U];
+        s0 = DIGEST_ROR64(s0, 1U) ^ DIGEST_ROR64(s0, 8U) ^ (s0 >> 7U);
+        s1 = w[(t - 2U) & 15U];
+        s1 = DIGEST_ROR64(s1, 19U) ^ DIGEST_ROR64(s1, 61U) ^ (s1 >> 6U);
+        w[t & 15U] += s0 + s1 + w[(t - 7U) & 15U];
+      }
+
+      t1 = s[7] + (DIGEST_ROR64(s[4], 14U) ^ DIGEST_ROR64(s[4], 18U) ^ DIGEST_ROR64(s[4], 41U)) +
+           ((s[4] & s[5]) ^ (~s[4] & s[6])) + DIGEST_K512[t] + w[t & 15U];
+      t2 = (DIGEST_ROR64(s[0], 28U) ^ DIGEST_ROR64(s[0], 34U) ^ DIGEST_ROR64(s[0], 39U)) +
+           ((s[0] & s[1]) ^ (s[0] & s[2]) ^ (s[1] & s[2]));
+      s[7] = s[6];
+      s[6] = s[5];
+      s[5] = s[4];
+      s[4] = s[3] + t1;
+      s[3] = s[2];
+      s[2] = s[1];
+      s[1] = s[0];
+      s[0] = t1 + t2;
+    }
+
+    for(i = 0U; i < 8U; i++)
+    {
+      pChain[i] += s[i];
+    }
+    pblock += 128U;
+  }
+}
+
+#if defined(DIGEST_HASH_SHA1)
+/**
+  * @brief  Feeds a buffer to the HASH processor.
+  * @note   The whole blocks of a word aligned buffer of at least DIGEST_DMA_MIN_SIZE
+  *         bytes are transferred by DMA, in multiple DMA transfers mode so that the
+  *         digest is not calculated at the end of each transfer. The other bytes are
+  *         written by the CPU through the stream of the handle.
+  * @param  hdigest: pointer to a DIGEST_HandleTypeDef structure
+  * @param  pData: pointer to the buffer
+  * @param  Size: number of bytes
+  * @param  Timeout: Timeout value
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef DIGEST_HashUpdate(DIGEST_HandleTypeDef *hdigest, const uint8_t *pData, uint32_t Size, uint32_t Timeout)
+{
+  HASH_HandleTypeDef *hhash = hdigest->Init.hhash;
+  const uint8_t *pdata = pData;
+  uint32_t size = Size;
+  HAL_StatusTypeDef status = HAL_OK;
+#if defined(HAL_DMA_MODULE_ENABLED)
+  uint32_t nbblocks;
+  uint32_t chunk;
+
+  if((hhash->hdmain != NULL) && (hdigest->Stream.BlockSize == 0U) && (((uint32_t)pdata & 3U) == 0U) &&
+     (size >= DIGEST_DMA_MIN_SIZE))
+  {
+    /* Load the stream in the processor */
+    status = HAL_HASH_StreamUpdate(hhash, &hdigest->Stream, (uint8_t *)pdata, 0U, Timeout);
+    if(status != HAL_OK)
+    {
+      return status;
+    }
+
+    /* Process Locked */
+    __HAL_LOCK(hhash);
+    hhash->State = HAL_HASH_STATE_BUSY;
+
+    __HAL_HASH_SET_MDMAT();
+
+    nbblocks = size / 64U;
+    while((nbblocks != 0U) && (status == HAL_OK))
+    {
+      chunk = (nbblocks > DIGEST_DMA_MAX_BLOCKS) ? DIGEST_DMA_MAX_BLOCKS : nbblocks;
+
+      status = HAL_DMA_Start(hhash->hdmain, (uint32_t)pdata, (uint32_t)&HASH->DIN, chunk * 16U);
+      if(status == HAL_OK)
+      {
+        HASH->CR |= HASH_CR_DMAE;
+        status = HAL_DMA_PollForTransfer(hhash->hdmain, HAL_DMA_FULL_TRANSFER, Timeout);
+        HASH->CR &= (uint32_t)(~HASH_CR_DMAE);
+      }
+
+      pdata += chunk * 64U;
+      size -= chunk * 64U;
+      nbblocks -= chunk;
+    }
+
+    __HAL_HASH_RESET_MDMAT();
+
+    hhash->State = (status == HAL_OK) ? HAL_HASH_STATE_READY : HAL_HASH_STATE_ERROR;
+
+    /* Process Unlocked */
+    __HAL_UNLOCK(hhash);
+
+    if(status != HAL_OK)
+    {
+      return status;
+    }
+  }
+#endif /* HAL_DMA_MODULE_ENABLED */
+
+  if(size != 0U)
+  {
+    status = HAL_HASH_StreamUpdate(hhash, &hdigest->Stream, (uint8_t *)pdata, size, Timeout);
+  }
+
+  return status;
+}
+#endif /* DIGEST_HASH_SHA1 */
+
+/**
+  * @brief  Erases a buffer holding key material.
+  * @param  pBuffer: pointer to the buffer
+  * @param  NbWords: number of words
+  * @retval None
+  */
+static void DIGEST_Wipe(uint32_t *pBuffer, uint32_t NbWords)
+{
+  __IO uint32_t *pbuffer = pBuffer;
+  uint32_t i;
+
+  for(i = 0U; i < NbWords; i++)
+  {
+    pbuffer[i] = 0U;
+  }
+}
+
+/**
+  * @}
+  */
+
+#endif /* HAL_DIGEST_MODULE_ENABLED */
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -294,6 +294,9 @@ void HAL_FLASH_IRQHandler(void)
       /*return the faulty sector*/
       addresstmp = pFlash.Sector;
       pFlash.Sector = 0xFFFFFFFFU;
+
+      /*Discard the scheduled sector erase jobs*/
+      FLASH_EraseQueue_Abort();
     }
     else if(pFlash.ProcedureOnGoing == FLASH_PROC_MASSERASE)
     {
@@ -387,6 +390,9 @@ void HAL_FLASH_IRQHandler(void)
 
     /* Process Unlocked */
     __HAL_UNLOCK(&pFlash);
+
+    /* Start the next scheduled sector erase, if any */
+    FLASH_EraseQueue_Next();
   }
 }
 
@@ -578,6 +584,9 @@ HAL_StatusTypeDef FLASH_WaitForLastOperation(uint32_t Timeout)
 
   while(__HAL_FLASH_GET_FLAG(FLASH_FLAG_BSY) != RESET)
   {
+    /* Let the application yield or sleep while waiting */
+    HAL_WaitHook(HAL_WAIT_FLASH, NULL);
+
     if(Timeout != HAL_MAX_DELAY)
     {
       if((Timeout == 0U)||((HAL_GetTick() - tickstart ) > Timeout))
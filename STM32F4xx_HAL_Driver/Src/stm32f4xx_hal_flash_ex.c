@@ -34,6 +34,15 @@
            (++) There are two modes of erase :
              (+++) Polling Mode using HAL_FLASHEx_Erase()
              (+++) Interrupt Mode using HAL_FLASHEx_Erase_IT()
+           (++) Background sector erase using HAL_FLASHEx_Erase_Schedule(): the
+                sector erase jobs are queued and run one after the other from
+                HAL_FLASH_IRQHandler(). HAL_FLASH_EndOfOperationCallback() reports
+                each erased sector and the end of each job, and
+                HAL_FLASHEx_Erase_GetPending() returns the number of sectors left.
+           (++) HAL_FLASHEx_IsAddressReadable() tells whether an address can be
+                read without stalling on the ongoing operation. On dual bank
+                devices, the code can keep running from the bank which is not
+                being erased or programmed (read-while-write).
 
       (#) Option Bytes Programming functions: Use HAL_FLASHEx_OBProgram() to :
            (++) Set/Reset the write protection
@@ -108,6 +117,11 @@
   * @{
   */
 extern FLASH_ProcessTypeDef pFlash;
+
+/* Sector erase jobs scheduled by HAL_FLASHEx_Erase_Schedule() */
+static FLASH_EraseInitTypeDef EraseQueue[FLASH_ERASE_QUEUE_DEPTH];
+static __IO uint32_t EraseQueueHead = 0U;
+static __IO uint32_t EraseQueueCount = 0U;
 /**
   * @}
   */
@@ -127,6 +141,8 @@ static uint8_t            FLASH_OB_GetUser(void);
 static uint16_t           FLASH_OB_GetWRP(void);
 static uint8_t            FLASH_OB_GetRDP(void);
 static uint8_t            FLASH_OB_GetBOR(void);
+static uint32_t           FLASH_GetAddressBank(uint32_t Address);
+static uint32_t           FLASH_GetSectorBank(uint32_t Sector);
 
 #if defined(STM32F401xC) || defined(STM32F401xE) || defined(STM32F410Tx) || defined(STM32F410Cx) || defined(STM32F410Rx) || defined(STM32F411xE) ||\
     defined(STM32F446xx) || defined(STM32F412Zx) || defined(STM32F412Vx) || defined(STM32F412Rx) || defined(STM32F412Cx) || defined(STM32F413xx) ||\
@@ -294,6 +310,129 @@ HAL_StatusTypeDef HAL_FLASHEx_Erase_IT(FLASH_EraseInitTypeDef *pEraseInit)
   return status;
 }
 
+/**
+  * @brief  Schedule a sector erase to be run in background with interrupt enabled
+  * @note   The job is started immediately when the FLASH is idle, otherwise it is
+  *         started from HAL_FLASH_IRQHandler() at the end of the ongoing interrupt
+  *         driven operation. A job queued while a polling operation is ongoing is
+  *         started by the next call to this function or by the next FLASH interrupt.
+  * @note   HAL_FLASH_EndOfOperationCallback() is called with each erased sector and
+  *         with 0xFFFFFFFFU at the end of each job. On error,
+  *         HAL_FLASH_OperationErrorCallback() is called with the faulty sector and
+  *         the remaining scheduled jobs are discarded.
+  * @note   The FLASH control register must stay unlocked until all the scheduled
+  *         jobs are completed.
+  * @param  pEraseInit: pointer to an FLASH_EraseInitTypeDef structure that
+  *         contains the configuration information for the erasing. Only
+  *         FLASH_TYPEERASE_SECTORS is supported.
+  *
+  * @retval HAL Status: HAL_BUSY if FLASH_ERASE_QUEUE_DEPTH jobs are already scheduled
+  */
+HAL_StatusTypeDef HAL_FLASHEx_Erase_Schedule(FLASH_EraseInitTypeDef *pEraseInit)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+  uint32_t primask_bit;
+
+  /* Check the parameters */
+  assert_param(IS_FLASH_NBSECTORS(pEraseInit->NbSectors + pEraseInit->Sector));
+  assert_param(IS_VOLTAGERANGE(pEraseInit->VoltageRange));
+
+  if((pEraseInit->TypeErase != FLASH_TYPEERASE_SECTORS) || (pEraseInit->NbSectors == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Enter critical section: the queue is also updated from the FLASH interrupt */
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  if(EraseQueueCount >= FLASH_ERASE_QUEUE_DEPTH)
+  {
+    status = HAL_BUSY;
+  }
+  else
+  {
+    EraseQueue[(EraseQueueHead + EraseQueueCount) % FLASH_ERASE_QUEUE_DEPTH] = *pEraseInit;
+    EraseQueueCount++;
+  }
+
+  /* Exit critical section: restore previous priority mask */
+  __set_PRIMASK(primask_bit);
+
+  /* Start the job if the FLASH is idle */
+  FLASH_EraseQueue_Next();
+
+  return status;
+}
+
+/**
+  * @brief  Get the number of sectors still to be erased
+  * @note   The count includes the remaining sectors of the ongoing interrupt driven
+  *         sector erase and the sectors of the scheduled jobs.
+  * @retval Number of sectors
+  */
+uint32_t HAL_FLASHEx_Erase_GetPending(void)
+{
+  uint32_t pending = 0U;
+  uint32_t index = 0U;
+  uint32_t primask_bit;
+
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  if(pFlash.ProcedureOnGoing == FLASH_PROC_SECTERASE)
+  {
+    pending = pFlash.NbSectorsToErase;
+  }
+  for(index = 0U; index < EraseQueueCount; index++)
+  {
+    pending += EraseQueue[(EraseQueueHead + index) % FLASH_ERASE_QUEUE_DEPTH].NbSectors;
+  }
+
+  __set_PRIMASK(primask_bit);
+
+  return pending;
+}
+
+/**
+  * @brief  Check whether an address can be read without stalling on a FLASH operation
+  * @note   On dual bank devices, the bank which is not being erased or programmed
+  *         remains readable (read-while-write). On single bank devices, the whole
+  *         FLASH is unreadable while an operation is ongoing.
+  * @note   Addresses outside the FLASH main memory are always readable.
+  * @param  Address: address to be checked
+  * @retval 1 if the address is readable now, 0 otherwise
+  */
+uint32_t HAL_FLASHEx_IsAddressReadable(uint32_t Address)
+{
+  uint32_t busybanks = 0U;
+  uint32_t bank = FLASH_GetAddressBank(Address);
+
+  if(pFlash.ProcedureOnGoing == FLASH_PROC_SECTERASE)
+  {
+    busybanks = FLASH_GetSectorBank(pFlash.Sector);
+  }
+  else if(pFlash.ProcedureOnGoing == FLASH_PROC_MASSERASE)
+  {
+    busybanks = pFlash.Bank;
+  }
+  else if(pFlash.ProcedureOnGoing == FLASH_PROC_PROGRAM)
+  {
+    busybanks = FLASH_GetAddressBank(pFlash.Address);
+  }
+  else if(__HAL_FLASH_GET_FLAG(FLASH_FLAG_BSY) != RESET)
+  {
+    /* Polling operation: the bank is not known */
+    busybanks = 0xFFFFFFFFU;
+  }
+  else
+  {
+    /* No operation ongoing */
+  }
+
+  return ((bank & busybanks) == 0U) ? 1U : 0U;
+}
+
 /**
   * @brief   Program option bytes
   * @param  pOBInit: pointer to an FLASH_OBInitStruct structure that
@@ -1322,6 +1461,104 @@ static uint8_t FLASH_OB_GetBOR(void)
   return (uint8_t)(*(__IO uint8_t *)(OPTCR_BYTE0_ADDRESS) & (uint8_t)0x0C);
 }
 
+/**
+  * @brief  Start the next scheduled sector erase job if the FLASH is idle
+  * @note   This function is called by HAL_FLASHEx_Erase_Schedule() and at the end
+  *         of each interrupt driven operation by HAL_FLASH_IRQHandler().
+  * @retval None
+  */
+void FLASH_EraseQueue_Next(void)
+{
+  uint32_t primask_bit;
+
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  if((EraseQueueCount != 0U) && (pFlash.ProcedureOnGoing == FLASH_PROC_NONE) && \
+     (pFlash.Lock == HAL_UNLOCKED) && (__HAL_FLASH_GET_FLAG(FLASH_FLAG_BSY) == RESET))
+  {
+    if(HAL_FLASHEx_Erase_IT(&EraseQueue[EraseQueueHead]) == HAL_OK)
+    {
+      EraseQueueHead = (EraseQueueHead + 1U) % FLASH_ERASE_QUEUE_DEPTH;
+      EraseQueueCount--;
+    }
+  }
+
+  __set_PRIMASK(primask_bit);
+}
+
+/**
+  * @brief  Discard the scheduled sector erase jobs
+  * @note   This function is called by HAL_FLASH_IRQHandler() when a sector erase fails.
+  * @retval None
+  */
+void FLASH_EraseQueue_Abort(void)
+{
+  EraseQueueCount = 0U;
+}
+
+/**
+  * @brief  Get the bank of an address
+  * @param  Address: address to be checked
+  * @retval FLASH_BANK_1 or FLASH_BANK_2, 0 if the address is not in the FLASH main memory
+  */
+static uint32_t FLASH_GetAddressBank(uint32_t Address)
+{
+  uint32_t flashsize = ((uint32_t)(*(__IO uint16_t *)FLASHSIZE_BASE)) << 10U;
+  uint32_t bank = 0U;
+
+  if((Address >= FLASH_BASE) && (Address < (FLASH_BASE + flashsize)))
+  {
+    bank = FLASH_BANK_1;
+#if defined(STM32F427xx) || defined(STM32F437xx) || defined(STM32F429xx)|| defined(STM32F439xx) ||\
+    defined(STM32F469xx) || defined(STM32F479xx)
+    /* 2 Mbyte devices, or 1 Mbyte devices with the dual bank option (DB1M) */
+    if(flashsize == 0x200000U)
+    {
+      if(Address >= (FLASH_BASE + 0x100000U))
+      {
+        bank = FLASH_BANK_2;
+      }
+    }
+    else if(READ_BIT(FLASH->OPTCR, FLASH_OPTCR_DB1M) != RESET)
+    {
+      if(Address >= (FLASH_BASE + (flashsize >> 1U)))
+      {
+        bank = FLASH_BANK_2;
+      }
+    }
+    else
+    {
+      /* Single bank organization */
+    }
+#endif /* STM32F427xx || STM32F437xx || STM32F429xx|| STM32F439xx || STM32F469xx || STM32F479xx */
+  }
+
+  return bank;
+}
+
+/**
+  * @brief  Get the bank of a sector
+  * @param  Sector: FLASH sector number
+  * @retval FLASH_BANK_1 or FLASH_BANK_2
+  */
+static uint32_t FLASH_GetSectorBank(uint32_t Sector)
+{
+  uint32_t bank = FLASH_BANK_1;
+
+#if defined(STM32F427xx) || defined(STM32F437xx) || defined(STM32F429xx)|| defined(STM32F439xx) ||\
+    defined(STM32F469xx) || defined(STM32F479xx)
+  /* Sectors 12 to 23 are located in bank 2 */
+  if((Sector >= FLASH_SECTOR_12) && (Sector != 0xFFFFFFFFU))
+  {
+    bank = FLASH_BANK_2;
+  }
+#endif /* STM32F427xx || STM32F437xx || STM32F429xx|| STM32F439xx || STM32F469xx || STM32F479xx */
+  UNUSED(Sector);
+
+  return bank;
+}
+
 /**
   * @brief  Flush the instruction and data caches
   * @retval None
@@ -78,6 +78,13 @@
 
     (#) To lock pin configuration until next reset use HAL_GPIO_LockPin().
 
+    (#) For bit-banged protocols, build a pin descriptor with __HAL_GPIO_PIN_DESC()
+        from constant port and pin number, then use the inline functions
+        HAL_GPIO_Fast_Set()/HAL_GPIO_Fast_Reset()/HAL_GPIO_Fast_Read() and
+        HAL_GPIO_Fast_SetOutput()/HAL_GPIO_Fast_SetInput() to change the direction
+        of a pin initialized by HAL_GPIO_Init(), each with a single register access.
+        HAL_GPIO_Fast_Apply() reconfigures several pins of a port with one write
+        to each configuration register.
 
     (#) During and just after reset, the alternate functions are not
         active and the GPIO pins are configured in input floating mode (except JTAG
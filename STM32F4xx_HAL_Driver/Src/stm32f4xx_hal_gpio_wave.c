@@ -0,0 +1,601 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_hal_gpio_wave.c
+  * @author  MCD Application Team
+  * @brief   GPIO parallel wave HAL module driver.
+  *          This file provides firmware functions to stream words to and from
+  *          a GPIO port at a timer-defined rate, without CPU intervention:
+  *           + Initialization and de-initialization functions
+  *           + BSRR buffer preparation, output and capture functions
+  *           + State and error functions
+  *
+  @verbatim
+  ==============================================================================
+                  ##### GPIO wave features #####
+  ==============================================================================
+  [..]
+    (+) Each update event of a timer raises a DMA request, which moves one word
+        of a memory buffer to the BSRR register of the port: all the pins of a
+        parallel bus change in the same cycle, and the pins out of the bus are
+        left untouched.
+
+    (+) In capture mode, each update event moves the IDR register of the port
+        to a half-word of a memory buffer, sampling the 16 pins together.
+
+    (+) The bus rate is set by the timer period, up to several MHz, and is only
+        limited by the DMA2 bandwidth to the AHB1 GPIO ports. No FMC is needed.
+
+  ==============================================================================
+                        ##### How to use this driver #####
+  ==============================================================================
+  [..]
+    (#) Configure the bus pins with HAL_GPIO_Init(), in output mode for the
+        output and in input mode for the capture.
+
+    (#) Initialize TIM1 or TIM8 with HAL_TIM_Base_Init(), the period giving the
+        sample rate. Only these timers request the DMA2 controller, which is the
+        only one allowed to access the GPIO ports:
+        (++) TIM1_UP: DMA2 Stream5 Channel6
+        (++) TIM8_UP: DMA2 Stream1 Channel7
+
+    (#) Initialize the DMA stream of the timer update request with HAL_DMA_Init(),
+        in normal or circular mode, and enable its interrupt in the NVIC, its IRQ
+        handler calling HAL_DMA_IRQHandler(). The direction, data sizes and
+        increments are programmed by this driver at each start.
+
+    (#) Declare a GPIO_WAVE_HandleTypeDef handle structure, set the port, timer
+        and DMA handles, then call HAL_GPIO_WAVE_Init().
+
+    (#) Output: fill a buffer of BSRR words with HAL_GPIO_WAVE_PrepareBSRR(), or
+        with __HAL_GPIO_WAVE_BSRR(), then start it with HAL_GPIO_WAVE_Start_DMA().
+        A strobe pin can be toggled with each sample by HAL_GPIO_WAVE_PrepareBSRR()
+        for 8080 style display interfaces.
+
+    (#) Capture: start it with HAL_GPIO_WAVE_Capture_DMA(). The pins are read
+        with each update event into a buffer of half-words.
+
+    (#) HAL_GPIO_WAVE_HalfCpltCallback() and HAL_GPIO_WAVE_CpltCallback() are
+        called at half and end of the buffer, to refill it in circular mode.
+        In normal mode the timer request is disabled at the end of the buffer.
+        HAL_GPIO_WAVE_Stop() stops the transfer at any time.
+
+    [..]
+      (@) The DMA stream and timer are owned by this driver while a transfer is
+          ongoing: they must not be used by the TIM driver.
+      (@) The timer counter is stopped at the end of a transfer, so the first
+          sample of the next transfer comes one timer period after its start.
+
+  @endverbatim
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2017 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_hal.h"
+
+/** @addtogroup STM32F4xx_HAL_Driver
+  * @{
+  */
+
+/** @defgroup GPIO_WAVE GPIO_WAVE
+  * @brief GPIO parallel wave HAL module driver
+  * @{
+  */
+
+#ifdef HAL_GPIO_WAVE_MODULE_ENABLED
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+/** @defgroup GPIO_WAVE_Private_Functions GPIO Wave Private Functions
+  * @{
+  */
+static void GPIO_WAVE_ConfigDMA(GPIO_WAVE_HandleTypeDef *hwave, uint32_t Direction, uint32_t PeriphAlign,
+                                uint32_t MemAlign);
+static void GPIO_WAVE_StartTimer(GPIO_WAVE_HandleTypeDef *hwave);
+static void GPIO_WAVE_StopTimer(GPIO_WAVE_HandleTypeDef *hwave);
+static void GPIO_WAVE_DMACplt(DMA_HandleTypeDef *hdma);
+static void GPIO_WAVE_DMAHalfCplt(DMA_HandleTypeDef *hdma);
+static void GPIO_WAVE_DMAError(DMA_HandleTypeDef *hdma);
+/**
+  * @}
+  */
+
+/* Exported functions --------------------------------------------------------*/
+/** @defgroup GPIO_WAVE_Exported_Functions GPIO Wave Exported Functions
+  * @{
+  */
+
+/** @defgroup GPIO_WAVE_Exported_Functions_Group1 Initialization and de-initialization functions
+ *  @brief    Initialization and de-initialization functions
+ *
+@verbatim
+ ===============================================================================
+              ##### Initialization and de-initialization functions #####
+ ===============================================================================
+    [..]
+    This section provides functions allowing to:
+      (+) Initialize the GPIO wave handle from already initialized timer and DMA handles
+      (+) De-initialize the GPIO wave handle
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Initializes the GPIO wave handle.
+  * @note   The GPIO pins, the timer and the DMA stream must be initialized before.
+  * @param  hwave: pointer to a GPIO_WAVE_HandleTypeDef structure.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_GPIO_WAVE_Init(GPIO_WAVE_HandleTypeDef *hwave)
+{
+  /* Check the GPIO wave handle allocation */
+  if(hwave == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the parameters */
+  assert_param(IS_GPIO_ALL_INSTANCE(hwave->Instance));
+
+  if((hwave->htim == NULL) || (hwave->hdma == NULL))
+  {
+    hwave->ErrorCode = HAL_GPIO_WAVE_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  assert_param(IS_GPIO_WAVE_TIM_INSTANCE(hwave->htim->Instance));
+
+  /* Only the DMA2 controller can access the GPIO ports */
+  if((uint32_t)hwave->hdma->Instance < (uint32_t)DMA2_Stream0)
+  {
+    hwave->ErrorCode = HAL_GPIO_WAVE_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  hwave->Lock = HAL_UNLOCKED;
+  hwave->ErrorCode = HAL_GPIO_WAVE_ERROR_NONE;
+  hwave->State = HAL_GPIO_WAVE_STATE_READY;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  De-initializes the GPIO wave handle, stopping an ongoing transfer.
+  * @note   The GPIO pins, the timer and the DMA stream are left initialized.
+  * @param  hwave: pointer to a GPIO_WAVE_HandleTypeDef structure.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_GPIO_WAVE_DeInit(GPIO_WAVE_HandleTypeDef *hwave)
+{
+  /* Check the GPIO wave handle allocation */
+  if(hwave == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  if((hwave->State == HAL_GPIO_WAVE_STATE_BUSY_TX) || (hwave->State == HAL_GPIO_WAVE_STATE_BUSY_RX))
+  {
+    (void)HAL_GPIO_WAVE_Stop(hwave);
+  }
+
+  hwave->ErrorCode = HAL_GPIO_WAVE_ERROR_NONE;
+  hwave->State = HAL_GPIO_WAVE_STATE_RESET;
+
+  /* Release Lock */
+  __HAL_UNLOCK(hwave);
+
+  return HAL_OK;
+}
+
+/**
+  * @}
+  */
+
+/** @defgroup GPIO_WAVE_Exported_Functions_Group2 IO operation functions
+ *  @brief    BSRR buffer preparation, output and capture functions
+ *
+@verbatim
+ ===============================================================================
+                      ##### IO operation functions #####
+ ===============================================================================
+    [..]
+    This section provides functions allowing to:
+      (+) Convert bus values to BSRR words
+      (+) Stream a BSRR buffer to the port
+      (+) Capture the port input levels to a buffer
+      (+) Stop the ongoing transfer
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Converts bus values to the BSRR words driving the bus pins.
+  * @note   The unused bits of the values are masked, so the pins out of the bus
+  *         are never written.
+  * @note   With a strobe pin, two words are generated per value: the first one sets
+  *         the bus value and resets the strobe, the second one sets the strobe, which
+  *         latches the value on its rising edge. pBSRR must then hold 2 x Length words.
+  * @param  pBSRR: pointer to the buffer of BSRR words to fill.
+  * @param  pData: pointer to the bus values.
+  * @param  Length: number of values.
+  * @param  BusMask: pins of the bus, any combination of GPIO_PIN_x where x can be (0..15).
+  * @param  Shift: position of the bus value bit 0 in the port, from 0 to 15.
+  * @param  StrobePin: GPIO_PIN_x of the write strobe, out of BusMask, or 0 for no strobe.
+  * @retval None
+  */
+void HAL_GPIO_WAVE_PrepareBSRR(uint32_t *pBSRR, const uint16_t *pData, uint32_t Length,
+                               uint32_t BusMask, uint32_t Shift, uint32_t StrobePin)
+{
+  uint32_t i;
+  uint32_t word;
+
+  for(i = 0U; i < Length; i++)
+  {
+    word = __HAL_GPIO_WAVE_BSRR((uint32_t)pData[i] << Shift, BusMask);
+
+    if(StrobePin != 0U)
+    {
+      *pBSRR++ = word | (StrobePin << 16U);
+      *pBSRR++ = StrobePin;
+    }
+    else
+    {
+      *pBSRR++ = word;
+    }
+  }
+}
+
+/**
+  * @brief  Streams a buffer of BSRR words to the port, one word per timer update event.
+  * @param  hwave: pointer to a GPIO_WAVE_HandleTypeDef structure.
+  * @param  pBSRR: pointer to the BSRR words, kept unchanged until the end of the transfer.
+  * @param  Length: number of words, from 1 to 65535.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_GPIO_WAVE_Start_DMA(GPIO_WAVE_HandleTypeDef *hwave, const uint32_t *pBSRR, uint32_t Length)
+{
+  if((pBSRR == NULL) || (Length == 0U) || (Length > 0xFFFFU))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Process Locked */
+  __HAL_LOCK(hwave);
+
+  if(hwave->State != HAL_GPIO_WAVE_STATE_READY)
+  {
+    /* Process Unlocked */
+    __HAL_UNLOCK(hwave);
+    return HAL_BUSY;
+  }
+
+  hwave->State = HAL_GPIO_WAVE_STATE_BUSY_TX;
+  hwave->ErrorCode = HAL_GPIO_WAVE_ERROR_NONE;
+
+  GPIO_WAVE_ConfigDMA(hwave, DMA_MEMORY_TO_PERIPH, DMA_PDATAALIGN_WORD, DMA_MDATAALIGN_WORD);
+
+  if(HAL_DMA_Start_IT(hwave->hdma, (uint32_t)pBSRR, (uint32_t)&hwave->Instance->BSRR, Length) != HAL_OK)
+  {
+    hwave->ErrorCode = HAL_GPIO_WAVE_ERROR_DMA;
+    hwave->State = HAL_GPIO_WAVE_STATE_READY;
+
+    /* Process Unlocked */
+    __HAL_UNLOCK(hwave);
+    return HAL_ERROR;
+  }
+
+  GPIO_WAVE_StartTimer(hwave);
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(hwave);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Captures the port input levels to a buffer, one half-word per timer update event.
+  * @param  hwave: pointer to a GPIO_WAVE_HandleTypeDef structure.
+  * @param  pData: pointer to the buffer receiving the levels of the 16 pins.
+  * @param  Length: number of half-words, from 1 to 65535.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_GPIO_WAVE_Capture_DMA(GPIO_WAVE_HandleTypeDef *hwave, uint16_t *pData, uint32_t Length)
+{
+  if((pData == NULL) || (Length == 0U) || (Length > 0xFFFFU))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Process Locked */
+  __HAL_LOCK(hwave);
+
+  if(hwave->State != HAL_GPIO_WAVE_STATE_READY)
+  {
+    /* Process Unlocked */
+    __HAL_UNLOCK(hwave);
+    return HAL_BUSY;
+  }
+
+  hwave->State = HAL_GPIO_WAVE_STATE_BUSY_RX;
+  hwave->ErrorCode = HAL_GPIO_WAVE_ERROR_NONE;
+
+  GPIO_WAVE_ConfigDMA(hwave, DMA_PERIPH_TO_MEMORY, DMA_PDATAALIGN_HALFWORD, DMA_MDATAALIGN_HALFWORD);
+
+  if(HAL_DMA_Start_IT(hwave->hdma, (uint32_t)&hwave->Instance->IDR, (uint32_t)pData, Length) != HAL_OK)
+  {
+    hwave->ErrorCode = HAL_GPIO_WAVE_ERROR_DMA;
+    hwave->State = HAL_GPIO_WAVE_STATE_READY;
+
+    /* Process Unlocked */
+    __HAL_UNLOCK(hwave);
+    return HAL_ERROR;
+  }
+
+  GPIO_WAVE_StartTimer(hwave);
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(hwave);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stops the ongoing output or capture.
+  * @param  hwave: pointer to a GPIO_WAVE_HandleTypeDef structure.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_GPIO_WAVE_Stop(GPIO_WAVE_HandleTypeDef *hwave)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+
+  if((hwave->State == HAL_GPIO_WAVE_STATE_BUSY_TX) || (hwave->State == HAL_GPIO_WAVE_STATE_BUSY_RX))
+  {
+    GPIO_WAVE_StopTimer(hwave);
+    status = HAL_DMA_Abort(hwave->hdma);
+    hwave->State = HAL_GPIO_WAVE_STATE_READY;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Transfer completed callback, at the end of the buffer.
+  * @param  hwave: pointer to a GPIO_WAVE_HandleTypeDef structure.
+  * @retval None
+  */
+__weak void HAL_GPIO_WAVE_CpltCallback(GPIO_WAVE_HandleTypeDef *hwave)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hwave);
+  /* NOTE : This function Should not be modified, when the callback is needed,
+            the HAL_GPIO_WAVE_CpltCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Transfer half completed callback, at the middle of the buffer.
+  * @param  hwave: pointer to a GPIO_WAVE_HandleTypeDef structure.
+  * @retval None
+  */
+__weak void HAL_GPIO_WAVE_HalfCpltCallback(GPIO_WAVE_HandleTypeDef *hwave)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hwave);
+  /* NOTE : This function Should not be modified, when the callback is needed,
+            the HAL_GPIO_WAVE_HalfCpltCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Transfer error callback.
+  * @param  hwave: pointer to a GPIO_WAVE_HandleTypeDef structure.
+  * @retval None
+  */
+__weak void HAL_GPIO_WAVE_ErrorCallback(GPIO_WAVE_HandleTypeDef *hwave)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hwave);
+  /* NOTE : This function Should not be modified, when the callback is needed,
+            the HAL_GPIO_WAVE_ErrorCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @}
+  */
+
+/** @defgroup GPIO_WAVE_Exported_Functions_Group3 Peripheral State and Error functions
+ *  @brief    Peripheral State and Error functions
+ *
+@verbatim
+ ===============================================================================
+                ##### Peripheral State and Error functions #####
+ ===============================================================================
+    [..]
+    This subsection permits to get in run-time the status of the transfer.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Returns the GPIO wave state.
+  * @param  hwave: pointer to a GPIO_WAVE_HandleTypeDef structure.
+  * @retval HAL state
+  */
+HAL_GPIO_WAVE_StateTypeDef HAL_GPIO_WAVE_GetState(GPIO_WAVE_HandleTypeDef *hwave)
+{
+  return hwave->State;
+}
+
+/**
+  * @brief  Returns the GPIO wave error code.
+  * @param  hwave: pointer to a GPIO_WAVE_HandleTypeDef structure.
+  * @retval GPIO wave error code, a combination of @ref GPIO_WAVE_Error_Code
+  */
+uint32_t HAL_GPIO_WAVE_GetError(GPIO_WAVE_HandleTypeDef *hwave)
+{
+  return hwave->ErrorCode;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/** @addtogroup GPIO_WAVE_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Programs the DMA stream for the transfer direction and data size.
+  * @note   The stream is disabled: the handle is in READY state.
+  * @param  hwave: pointer to a GPIO_WAVE_HandleTypeDef structure.
+  * @param  Direction: DMA_MEMORY_TO_PERIPH or DMA_PERIPH_TO_MEMORY.
+  * @param  PeriphAlign: peripheral data size, a value of @ref DMA_Peripheral_data_size.
+  * @param  MemAlign: memory data size, a value of @ref DMA_Memory_data_size.
+  * @retval None
+  */
+static void GPIO_WAVE_ConfigDMA(GPIO_WAVE_HandleTypeDef *hwave, uint32_t Direction, uint32_t PeriphAlign,
+                                uint32_t MemAlign)
+{
+  DMA_HandleTypeDef *hdma = hwave->hdma;
+
+  hdma->Init.Direction = Direction;
+  hdma->Init.PeriphInc = DMA_PINC_DISABLE;
+  hdma->Init.MemInc = DMA_MINC_ENABLE;
+  hdma->Init.PeriphDataAlignment = PeriphAlign;
+  hdma->Init.MemDataAlignment = MemAlign;
+
+  MODIFY_REG(hdma->Instance->CR, (DMA_SxCR_DIR | DMA_SxCR_PINC | DMA_SxCR_MINC | DMA_SxCR_PSIZE | DMA_SxCR_MSIZE),
+             (Direction | DMA_PINC_DISABLE | DMA_MINC_ENABLE | PeriphAlign | MemAlign));
+
+  hdma->Parent = hwave;
+  hdma->XferCpltCallback = GPIO_WAVE_DMACplt;
+  hdma->XferHalfCpltCallback = GPIO_WAVE_DMAHalfCplt;
+  hdma->XferErrorCallback = GPIO_WAVE_DMAError;
+}
+
+/**
+  * @brief  Enables the timer update DMA request and starts the counter.
+  * @param  hwave: pointer to a GPIO_WAVE_HandleTypeDef structure.
+  * @retval None
+  */
+static void GPIO_WAVE_StartTimer(GPIO_WAVE_HandleTypeDef *hwave)
+{
+  __HAL_TIM_ENABLE_DMA(hwave->htim, TIM_DMA_UPDATE);
+  __HAL_TIM_ENABLE(hwave->htim);
+}
+
+/**
+  * @brief  Stops the counter and disables the timer update DMA request.
+  * @note   The counter is stopped directly: __HAL_TIM_DISABLE() leaves it running
+  *         when a capture compare channel is enabled.
+  * @param  hwave: pointer to a GPIO_WAVE_HandleTypeDef structure.
+  * @retval None
+  */
+static void GPIO_WAVE_StopTimer(GPIO_WAVE_HandleTypeDef *hwave)
+{
+  hwave->htim->Instance->CR1 &= ~TIM_CR1_CEN;
+  __HAL_TIM_DISABLE_DMA(hwave->htim, TIM_DMA_UPDATE);
+}
+
+/**
+  * @brief  DMA transfer complete callback.
+  * @param  hdma: pointer to a DMA_HandleTypeDef structure.
+  * @retval None
+  */
+static void GPIO_WAVE_DMACplt(DMA_HandleTypeDef *hdma)
+{
+  GPIO_WAVE_HandleTypeDef *hwave = (GPIO_WAVE_HandleTypeDef *)hdma->Parent;
+
+  if(hdma->Init.Mode != DMA_CIRCULAR)
+  {
+    GPIO_WAVE_StopTimer(hwave);
+    hwave->State = HAL_GPIO_WAVE_STATE_READY;
+  }
+
+  HAL_GPIO_WAVE_CpltCallback(hwave);
+}
+
+/**
+  * @brief  DMA half transfer complete callback.
+  * @param  hdma: pointer to a DMA_HandleTypeDef structure.
+  * @retval None
+  */
+static void GPIO_WAVE_DMAHalfCplt(DMA_HandleTypeDef *hdma)
+{
+  GPIO_WAVE_HandleTypeDef *hwave = (GPIO_WAVE_HandleTypeDef *)hdma->Parent;
+
+  HAL_GPIO_WAVE_HalfCpltCallback(hwave);
+}
+
+/**
+  * @brief  DMA error callback.
+  * @note   The FIFO and direct mode errors do not stop the stream and are ignored,
+  *         only a transfer error ends the transfer.
+  * @param  hdma: pointer to a DMA_HandleTypeDef structure.
+  * @retval None
+  */
+static void GPIO_WAVE_DMAError(DMA_HandleTypeDef *hdma)
+{
+  GPIO_WAVE_HandleTypeDef *hwave = (GPIO_WAVE_HandleTypeDef *)hdma->Parent;
+
+  if((HAL_DMA_GetError(hdma) & HAL_DMA_ERROR_TE) != 0U)
+  {
+    GPIO_WAVE_StopTimer(hwave);
+    hwave->ErrorCode |= HAL_GPIO_WAVE_ERROR_DMA;
+    hwave->State = HAL_GPIO_WAVE_STATE_READY;
+
+    HAL_GPIO_WAVE_ErrorCallback(hwave);
+  }
+}
+
+/**
+  * @}
+  */
+
+#endif /* HAL_GPIO_WAVE_MODULE_ENABLED */
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -12,6 +12,7 @@
   *           + HASH/HMAC functions by algorithm using interrupt mode
   *           + HASH/HMAC functions by algorithm using DMA mode
   *           + Peripheral State functions
+  *           + Context swap and stream functions
   *
   @verbatim
   ==============================================================================
@@ -62,6 +63,21 @@
     (#)In case of using DMA, call the DMA start processing e.g. HAL_HASH_SHA1_Start_DMA().
        After that, call the finish function in order to get the digest value
        e.g. HAL_HASH_SHA1_Finish()
+    (#)Several digests can be computed concurrently with the stream functions:
+       (##) Declare one HASH_StreamTypeDef per digest and start it with
+            HAL_HASH_StreamInit(), giving the algorithm (e.g. HASH_ALGOSELECTION_SHA256)
+       (##) Feed any number of bytes with HAL_HASH_StreamUpdate() and get the digest
+            with HAL_HASH_StreamFinish(), in any order between the streams
+       (##) The stream loaded in the processor is swapped out (HAL_HASH_ContextSaving())
+            and the requested one swapped in (HAL_HASH_ContextRestoring()) only when
+            another stream is used, so consecutive updates of the same stream are
+            processed at full speed
+       (##) HAL_HASH_StreamCopy() duplicates a stream, e.g. to get the intermediate
+            digest of a TLS handshake transcript while it is continued
+       (##) HMAC streams are built by the application from two hash streams, over the
+            inner and outer padded keys
+       (##) Call HAL_HASH_StreamSuspend() before using the other processing functions,
+            the stream loaded in the processor is saved and reloaded on its next use
     (#)Call HAL_HASH_DeInit() to deinitialize the HASH peripheral.
 
   @endverbatim
@@ -123,6 +139,8 @@ static void HASH_DMAXferCplt(DMA_HandleTypeDef *hdma);
 static void HASH_DMAError(DMA_HandleTypeDef *hdma);
 static void HASH_GetDigest(uint8_t *pMsgDigest, uint8_t Size);
 static void HASH_WriteData(uint8_t *pInBuffer, uint32_t Size);
+static HAL_StatusTypeDef HASH_WaitNotBusy(uint32_t Timeout);
+static HAL_StatusTypeDef HASH_StreamSelect(HASH_HandleTypeDef *hhash, HASH_StreamTypeDef *hstream, uint32_t Timeout);
 /**
   * @}
   */
@@ -307,6 +325,78 @@ static void HASH_GetDigest(uint8_t *pMsgDigest, uint8_t Size)
   }
 }
 
+/**
+  * @brief  Waits for the end of the current block processing.
+  * @param  Timeout: Timeout value
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef HASH_WaitNotBusy(uint32_t Timeout)
+{
+  uint32_t tickstart = HAL_GetTick();
+
+  while(HAL_IS_BIT_SET(HASH->SR, HASH_FLAG_BUSY))
+  {
+    /* Check for the Timeout */
+    if(Timeout != HAL_MAX_DELAY)
+    {
+      if((Timeout == 0U)||((HAL_GetTick() - tickstart ) > Timeout))
+      {
+        return HAL_TIMEOUT;
+      }
+    }
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Loads a stream in the HASH processor, the stream previously loaded is saved.
+  * @param  hhash: pointer to a HASH_HandleTypeDef structure that contains
+  *         the configuration information for HASH module
+  * @param  hstream: stream to load, or NULL to only save the loaded stream
+  * @param  Timeout: Timeout value
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef HASH_StreamSelect(HASH_HandleTypeDef *hhash, HASH_StreamTypeDef *hstream, uint32_t Timeout)
+{
+  if(hhash->pActiveStream == hstream)
+  {
+    return HAL_OK;
+  }
+
+  if(hhash->pActiveStream != NULL)
+  {
+    /* The context can only be saved between two blocks */
+    if(HASH_WaitNotBusy(Timeout) != HAL_OK)
+    {
+      return HAL_TIMEOUT;
+    }
+    HAL_HASH_ContextSaving(hhash, (uint8_t*)hhash->pActiveStream->Context);
+    hhash->pActiveStream = NULL;
+  }
+
+  if(hstream != NULL)
+  {
+    if(hstream->Phase == HAL_HASH_PHASE_READY)
+    {
+      /* Select the algorithm and reset the HASH processor core for a new message */
+      MODIFY_REG(HASH->CR, HASH_CR_ALGO | HASH_CR_MODE | HASH_CR_LKEY | HASH_CR_DMAE, hstream->Algorithm);
+      HASH->CR |= HASH_CR_INIT;
+      hstream->Phase = HAL_HASH_PHASE_PROCESS;
+    }
+    else
+    {
+      HAL_HASH_ContextRestoring(hhash, (uint8_t*)hstream->Context);
+    }
+    hhash->pActiveStream = hstream;
+  }
+
+  /* The processor no longer holds the message of the other processing functions */
+  hhash->Phase = HAL_HASH_PHASE_READY;
+
+  return HAL_OK;
+}
+
 /**
   * @}
   */
@@ -378,6 +468,9 @@ HAL_StatusTypeDef HAL_HASH_Init(HASH_HandleTypeDef *hhash)
   /* Set the default HASH phase */
   hhash->Phase = HAL_HASH_PHASE_READY;
 
+  /* No stream loaded in the processor */
+  hhash->pActiveStream = NULL;
+
   /* Return function status */
   return HAL_OK;
 }
@@ -408,6 +501,9 @@ HAL_StatusTypeDef HAL_HASH_DeInit(HASH_HandleTypeDef *hhash)
   hhash->HashBuffSize = 0U;
   hhash->HashITCounter = 0U;
 
+  /* The loaded stream, if any, is lost */
+  hhash->pActiveStream = NULL;
+
   /* DeInit the low level hardware */
   HAL_HASH_MspDeInit(hhash);
 
@@ -1847,6 +1943,338 @@ HAL_HASH_StateTypeDef HAL_HASH_GetState(HASH_HandleTypeDef *hhash)
   return hhash->State;
 }
 
+/**
+  * @}
+  */
+
+/** @defgroup HASH_Exported_Functions_Group9 Context swap and stream functions
+ *  @brief   Context swap and stream functions.
+ *
+@verbatim
+ ===============================================================================
+                ##### Context swap and stream functions #####
+ ===============================================================================
+    [..]  This section provides functions allowing to:
+      (+) Save and restore the HASH processor context.
+      (+) Time-share the HASH processor between several digests in progress.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Saves the HASH processor context.
+  * @note   The IMR, STR, CR then all the CSR registers are saved in that order,
+  *         pMemBuffer must be (HASH_NUMBER_OF_CSR_REGISTERS + 3) words long.
+  * @note   The processing must be interrupted between two blocks, i.e. when the
+  *         processor is not busy and no DMA transfer is ongoing.
+  * @param  hhash: pointer to a HASH_HandleTypeDef structure that contains
+  *         the configuration information for HASH module
+  * @param  pMemBuffer: pointer to the memory buffer, word aligned
+  * @retval None
+  */
+void HAL_HASH_ContextSaving(HASH_HandleTypeDef *hhash, uint8_t* pMemBuffer)
+{
+  uint32_t *pmem = (uint32_t*)pMemBuffer;
+  uint32_t i;
+
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hhash);
+
+  /* Save IMR register content */
+  *pmem++ = READ_BIT(HASH->IMR, HASH_IT_DINI | HASH_IT_DCI);
+  /* Save STR register content */
+  *pmem++ = READ_BIT(HASH->STR, HASH_STR_NBLW);
+  /* Save CR register content */
+  *pmem++ = READ_BIT(HASH->CR, HASH_CR_DMAE | HASH_CR_DATATYPE | HASH_CR_MODE | HASH_CR_ALGO |
+                               HASH_CR_LKEY | HASH_CR_MDMAT);
+  /* Save all CSR registers */
+  for(i = 0U; i < HASH_NUMBER_OF_CSR_REGISTERS; i++)
+  {
+    *pmem++ = HASH->CSR[i];
+  }
+}
+
+/**
+  * @brief  Restores a HASH processor context saved by HAL_HASH_ContextSaving().
+  * @note   The IMR, STR, CR registers are restored, the processor is reset
+  *         then the CSR registers are restored.
+  * @param  hhash: pointer to a HASH_HandleTypeDef structure that contains
+  *         the configuration information for HASH module
+  * @param  pMemBuffer: pointer to the memory buffer, word aligned
+  * @retval None
+  */
+void HAL_HASH_ContextRestoring(HASH_HandleTypeDef *hhash, uint8_t* pMemBuffer)
+{
+  uint32_t *pmem = (uint32_t*)pMemBuffer;
+  uint32_t i;
+
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hhash);
+
+  /* Restore IMR register content */
+  WRITE_REG(HASH->IMR, *pmem++);
+  /* Restore STR register content */
+  WRITE_REG(HASH->STR, *pmem++);
+  /* Restore CR register content */
+  WRITE_REG(HASH->CR, *pmem++);
+
+  /* Reset the HASH processor before restoring the Context Swap Registers */
+  HASH->CR |= HASH_CR_INIT;
+
+  /* Restore all CSR registers */
+  for(i = 0U; i < HASH_NUMBER_OF_CSR_REGISTERS; i++)
+  {
+    HASH->CSR[i] = *pmem++;
+  }
+}
+
+/**
+  * @brief  Starts a new digest on a stream.
+  * @note   The data type is the one configured by HAL_HASH_Init().
+  * @param  hhash: pointer to a HASH_HandleTypeDef structure that contains
+  *         the configuration information for HASH module
+  * @param  hstream: stream to start, a digest in progress on it is discarded
+  * @param  Algorithm: HASH_ALGOSELECTION_MD5, HASH_ALGOSELECTION_SHA1, HASH_ALGOSELECTION_SHA224
+  *         or HASH_ALGOSELECTION_SHA256 (the last two on STM32F437xx, STM32F439xx and STM32F479xx)
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_HASH_StreamInit(HASH_HandleTypeDef *hhash, HASH_StreamTypeDef *hstream, uint32_t Algorithm)
+{
+  /* Check the parameters */
+  assert_param(IS_HASH_STREAM_ALGOSELECTION(Algorithm));
+
+  if(hstream == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Process Locked */
+  __HAL_LOCK(hhash);
+
+  /* A stream restarted while loaded is no longer saved */
+  if(hhash->pActiveStream == hstream)
+  {
+    hhash->pActiveStream = NULL;
+  }
+
+  hstream->Algorithm = Algorithm;
+  hstream->Phase = HAL_HASH_PHASE_READY;
+  hstream->BlockSize = 0U;
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(hhash);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Feeds data to a stream.
+  * @note   Any number of bytes is accepted: the processor is fed whole 64-byte blocks,
+  *         the remaining bytes are kept in the stream until the next call.
+  * @param  hhash: pointer to a HASH_HandleTypeDef structure that contains
+  *         the configuration information for HASH module
+  * @param  hstream: stream started by HAL_HASH_StreamInit()
+  * @param  pInBuffer: Pointer to the input buffer
+  * @param  Size: Length of the input buffer in bytes
+  * @param  Timeout: Timeout value, used when another stream has to be swapped out
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_HASH_StreamUpdate(HASH_HandleTypeDef *hhash, HASH_StreamTypeDef *hstream, uint8_t *pInBuffer, uint32_t Size, uint32_t Timeout)
+{
+  uint8_t *pblock = (uint8_t*)hstream->Block;
+
+  /* Process Locked */
+  __HAL_LOCK(hhash);
+
+  /* Change the HASH state */
+  hhash->State = HAL_HASH_STATE_BUSY;
+
+  if(HASH_StreamSelect(hhash, hstream, Timeout) != HAL_OK)
+  {
+    hhash->State = HAL_HASH_STATE_TIMEOUT;
+    __HAL_UNLOCK(hhash);
+    return HAL_TIMEOUT;
+  }
+
+  while(Size != 0U)
+  {
+    if((hstream->BlockSize == 0U) && (Size >= 64U))
+    {
+      /* Whole blocks are written directly from the input buffer */
+      HASH_WriteData(pInBuffer, 64U);
+      pInBuffer += 64U;
+      Size -= 64U;
+    }
+    else
+    {
+      pblock[hstream->BlockSize] = *pInBuffer;
+      hstream->BlockSize++;
+      pInBuffer++;
+      Size--;
+
+      if(hstream->BlockSize == 64U)
+      {
+        HASH_WriteData(pblock, 64U);
+        hstream->BlockSize = 0U;
+      }
+    }
+  }
+
+  /* Change the HASH state */
+  hhash->State = HAL_HASH_STATE_READY;
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(hhash);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Computes the digest of a stream. The stream must be restarted with
+  *         HAL_HASH_StreamInit() to be used again.
+  * @param  hhash: pointer to a HASH_HandleTypeDef structure that contains
+  *         the configuration information for HASH module
+  * @param  hstream: stream started by HAL_HASH_StreamInit()
+  * @param  pOutBuffer: Pointer to the computed digest, 16, 20, 28 or 32 bytes for
+  *         MD5, SHA1, SHA224 or SHA256.
+  * @param  Timeout: Timeout value
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_HASH_StreamFinish(HASH_HandleTypeDef *hhash, HASH_StreamTypeDef *hstream, uint8_t* pOutBuffer, uint32_t Timeout)
+{
+  uint8_t digestsize;
+
+  switch(hstream->Algorithm)
+  {
+  case HASH_ALGOSELECTION_MD5:
+    digestsize = 16U;
+    break;
+  case HASH_ALGOSELECTION_SHA224:
+    digestsize = 28U;
+    break;
+  case HASH_ALGOSELECTION_SHA256:
+    digestsize = 32U;
+    break;
+  default:
+    digestsize = 20U;
+    break;
+  }
+
+  /* Process Locked */
+  __HAL_LOCK(hhash);
+
+  /* Change the HASH state */
+  hhash->State = HAL_HASH_STATE_BUSY;
+
+  if(HASH_StreamSelect(hhash, hstream, Timeout) != HAL_OK)
+  {
+    hhash->State = HAL_HASH_STATE_TIMEOUT;
+    __HAL_UNLOCK(hhash);
+    return HAL_TIMEOUT;
+  }
+
+  /* Configure the number of valid bits in last word of the message */
+  __HAL_HASH_SET_NBVALIDBITS(hstream->BlockSize);
+
+  /* Write the pending bytes in data register */
+  HASH_WriteData((uint8_t*)hstream->Block, hstream->BlockSize);
+
+  /* Start the digest calculation */
+  __HAL_HASH_START_DIGEST();
+
+  /* The stream is complete and no longer loaded */
+  hhash->pActiveStream = NULL;
+  hstream->Phase = HAL_HASH_PHASE_READY;
+  hstream->BlockSize = 0U;
+
+  if(HASH_WaitNotBusy(Timeout) != HAL_OK)
+  {
+    hhash->State = HAL_HASH_STATE_TIMEOUT;
+    __HAL_UNLOCK(hhash);
+    return HAL_TIMEOUT;
+  }
+
+  /* Read the message digest */
+  HASH_GetDigest(pOutBuffer, digestsize);
+
+  /* Change the HASH state */
+  hhash->State = HAL_HASH_STATE_READY;
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(hhash);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Duplicates a stream, both streams can then be continued independently.
+  * @param  hhash: pointer to a HASH_HandleTypeDef structure that contains
+  *         the configuration information for HASH module
+  * @param  hdest: destination stream
+  * @param  hsrc: stream to duplicate
+  * @param  Timeout: Timeout value, used when the source stream has to be saved
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_HASH_StreamCopy(HASH_HandleTypeDef *hhash, HASH_StreamTypeDef *hdest, HASH_StreamTypeDef *hsrc, uint32_t Timeout)
+{
+  if((hdest == NULL) || (hdest == hsrc))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Process Locked */
+  __HAL_LOCK(hhash);
+
+  /* The loaded stream context is only in the processor: save it, it stays loaded */
+  if(hhash->pActiveStream == hsrc)
+  {
+    if(HASH_WaitNotBusy(Timeout) != HAL_OK)
+    {
+      hhash->State = HAL_HASH_STATE_TIMEOUT;
+      __HAL_UNLOCK(hhash);
+      return HAL_TIMEOUT;
+    }
+    HAL_HASH_ContextSaving(hhash, (uint8_t*)hsrc->Context);
+  }
+
+  /* The destination copy is not loaded in the processor */
+  if(hhash->pActiveStream == hdest)
+  {
+    hhash->pActiveStream = NULL;
+  }
+
+  *hdest = *hsrc;
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(hhash);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Saves the stream loaded in the HASH processor, so that the processor can
+  *         be used by the other processing functions.
+  * @param  hhash: pointer to a HASH_HandleTypeDef structure that contains
+  *         the configuration information for HASH module
+  * @param  Timeout: Timeout value
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_HASH_StreamSuspend(HASH_HandleTypeDef *hhash, uint32_t Timeout)
+{
+  HAL_StatusTypeDef status;
+
+  /* Process Locked */
+  __HAL_LOCK(hhash);
+
+  status = HASH_StreamSelect(hhash, NULL, Timeout);
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(hhash);
+
+  return status;
+}
+
 /**
   * @}
   */
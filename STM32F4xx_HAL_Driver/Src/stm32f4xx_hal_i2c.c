@@ -3358,6 +3358,8 @@ void HAL_I2C_EV_IRQHandler(I2C_HandleTypeDef *hi2c)
 
   uint32_t CurrentMode  = hi2c->Mode;
 
+  __HAL_PROF_ENTER(HAL_PROF_ID_I2C_EV_IRQ);
+
   /* Master or Memory mode selected */
   if((CurrentMode == HAL_I2C_MODE_MASTER) || (CurrentMode == HAL_I2C_MODE_MEM))
   {
@@ -3448,6 +3450,8 @@ void HAL_I2C_EV_IRQHandler(I2C_HandleTypeDef *hi2c)
       }
     }
   }
+
+  __HAL_PROF_EXIT(HAL_PROF_ID_I2C_EV_IRQ);
 }
 
 /**
@@ -3462,6 +3466,8 @@ void HAL_I2C_ER_IRQHandler(I2C_HandleTypeDef *hi2c)
   uint32_t sr1itflags = READ_REG(hi2c->Instance->SR1);
   uint32_t itsources  = READ_REG(hi2c->Instance->CR2);
 
+  __HAL_PROF_ENTER(HAL_PROF_ID_I2C_ER_IRQ);
+
   /* I2C Bus error interrupt occurred ----------------------------------------*/
   if(((sr1itflags & I2C_FLAG_BERR) != RESET) && ((itsources & I2C_IT_ERR) != RESET))
   {
@@ -3522,6 +3528,8 @@ void HAL_I2C_ER_IRQHandler(I2C_HandleTypeDef *hi2c)
   {
     I2C_ITError(hi2c);
   }
+
+  __HAL_PROF_EXIT(HAL_PROF_ID_I2C_ER_IRQ);
 }
 
 /**
@@ -5235,6 +5243,9 @@ static HAL_StatusTypeDef I2C_WaitOnFlagUntilTimeout(I2C_HandleTypeDef *hi2c, uin
   /* Wait until flag is set */
   while((__HAL_I2C_GET_FLAG(hi2c, Flag) ? SET : RESET) == Status)
   {
+    /* Let the application yield or sleep while waiting */
+    HAL_WaitHook(HAL_WAIT_I2C, hi2c);
+
     /* Check for the Timeout */
     if(Timeout != HAL_MAX_DELAY)
     {
@@ -5268,6 +5279,9 @@ static HAL_StatusTypeDef I2C_WaitOnMasterAddressFlagUntilTimeout(I2C_HandleTypeD
 {
   while(__HAL_I2C_GET_FLAG(hi2c, Flag) == RESET)
   {
+    /* Let the application yield or sleep while waiting */
+    HAL_WaitHook(HAL_WAIT_I2C, hi2c);
+
     if(__HAL_I2C_GET_FLAG(hi2c, I2C_FLAG_AF) == SET)
     {
       /* Generate Stop */
@@ -5316,6 +5330,9 @@ static HAL_StatusTypeDef I2C_WaitOnTXEFlagUntilTimeout(I2C_HandleTypeDef *hi2c,
 {
   while(__HAL_I2C_GET_FLAG(hi2c, I2C_FLAG_TXE) == RESET)
   {
+    /* Let the application yield or sleep while waiting */
+    HAL_WaitHook(HAL_WAIT_I2C, hi2c);
+
     /* Check if a NACK is detected */
     if(I2C_IsAcknowledgeFailed(hi2c) != HAL_OK)
     {
@@ -5353,6 +5370,9 @@ static HAL_StatusTypeDef I2C_WaitOnBTFFlagUntilTimeout(I2C_HandleTypeDef *hi2c,
 {
   while(__HAL_I2C_GET_FLAG(hi2c, I2C_FLAG_BTF) == RESET)
   {
+    /* Let the application yield or sleep while waiting */
+    HAL_WaitHook(HAL_WAIT_I2C, hi2c);
+
     /* Check if a NACK is detected */
     if(I2C_IsAcknowledgeFailed(hi2c) != HAL_OK)
     {
@@ -5390,6 +5410,9 @@ static HAL_StatusTypeDef I2C_WaitOnSTOPFlagUntilTimeout(I2C_HandleTypeDef *hi2c,
 {
   while(__HAL_I2C_GET_FLAG(hi2c, I2C_FLAG_STOPF) == RESET)
   {
+    /* Let the application yield or sleep while waiting */
+    HAL_WaitHook(HAL_WAIT_I2C, hi2c);
+
     /* Check if a NACK is detected */
     if(I2C_IsAcknowledgeFailed(hi2c) != HAL_OK)
     {
@@ -5425,6 +5448,9 @@ static HAL_StatusTypeDef I2C_WaitOnRXNEFlagUntilTimeout(I2C_HandleTypeDef *hi2c,
 
   while(__HAL_I2C_GET_FLAG(hi2c, I2C_FLAG_RXNE) == RESET)
   {
+    /* Let the application yield or sleep while waiting */
+    HAL_WaitHook(HAL_WAIT_I2C, hi2c);
+
     /* Check if a STOPF is detected */
     if(__HAL_I2C_GET_FLAG(hi2c, I2C_FLAG_STOPF) == SET)
     {
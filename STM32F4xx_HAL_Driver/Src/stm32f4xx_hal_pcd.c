@@ -323,7 +323,7 @@ HAL_StatusTypeDef HAL_PCD_Stop(PCD_HandleTypeDef *hpcd)
   * @param  hpcd: PCD handle
   * @retval HAL status
   */
-void HAL_PCD_IRQHandler(PCD_HandleTypeDef *hpcd)
+__HOT_RAM_FUNC void HAL_PCD_IRQHandler(PCD_HandleTypeDef *hpcd)
 {
   USB_OTG_GlobalTypeDef *USBx = hpcd->Instance;
   uint32_t i = 0U, ep_intr = 0U, epint = 0U, epnum = 0U;
@@ -331,12 +331,15 @@ void HAL_PCD_IRQHandler(PCD_HandleTypeDef *hpcd)
   USB_OTG_EPTypeDef *ep;
   uint32_t hclk = 180000000U;
 
+  __HAL_PROF_ENTER(HAL_PROF_ID_PCD_IRQ);
+
   /* ensure that we are in device mode */
   if (USB_GetMode(hpcd->Instance) == USB_OTG_MODE_DEVICE)
   {
     /* avoid spurious interrupt */
     if(__HAL_PCD_IS_INVALID_INTERRUPT(hpcd))
     {
+      __HAL_PROF_EXIT(HAL_PROF_ID_PCD_IRQ);
       return;
     }
 
@@ -713,6 +716,8 @@ void HAL_PCD_IRQHandler(PCD_HandleTypeDef *hpcd)
       hpcd->Instance->GOTGINT |= temp;
     }
   }
+
+  __HAL_PROF_EXIT(HAL_PROF_ID_PCD_IRQ);
 }
 
 /**
@@ -1259,7 +1264,7 @@ PCD_StateTypeDef HAL_PCD_GetState(PCD_HandleTypeDef *hpcd)
   * @param  epnum : endpoint number
   * @retval HAL status
   */
-static HAL_StatusTypeDef PCD_WriteEmptyTxFifo(PCD_HandleTypeDef *hpcd, uint32_t epnum)
+static __HOT_RAM_FUNC HAL_StatusTypeDef PCD_WriteEmptyTxFifo(PCD_HandleTypeDef *hpcd, uint32_t epnum)
 {
   USB_OTG_GlobalTypeDef *USBx = hpcd->Instance;
   USB_OTG_EPTypeDef *ep;
@@ -103,6 +103,30 @@
   * @{
   */
 #define CLOCKSWITCH_TIMEOUT_VALUE  5000U /* 5 s */
+#define RCC_RESTORE_TIMEOUT_LOOPS  0x00100000U /* Polling loops, about 0.5 s at 16 MHz */
+
+/* Maximum HCLK per voltage scale (over-drive included) and per wait state at VDD 2.7 V to 3.6 V */
+#if defined(STM32F405xx) || defined(STM32F407xx) || defined(STM32F415xx) || defined(STM32F417xx)
+#define RCC_SCALE1_HCLK_MAX        168000000U
+#define RCC_SCALE2_HCLK_MAX        144000000U
+#define RCC_SCALE3_HCLK_MAX        144000000U
+#elif defined(STM32F401xC) || defined(STM32F401xE)
+#define RCC_SCALE1_HCLK_MAX         84000000U
+#define RCC_SCALE2_HCLK_MAX         84000000U
+#define RCC_SCALE3_HCLK_MAX         60000000U
+#elif defined(STM32F410Tx) || defined(STM32F410Cx) || defined(STM32F410Rx) || defined(STM32F411xE) || \
+      defined(STM32F412Zx) || defined(STM32F412Vx) || defined(STM32F412Rx) || defined(STM32F412Cx) || \
+      defined(STM32F413xx) || defined(STM32F423xx)
+#define RCC_SCALE1_HCLK_MAX        100000000U
+#define RCC_SCALE2_HCLK_MAX         84000000U
+#define RCC_SCALE3_HCLK_MAX         64000000U
+#define RCC_FLASH_WS1_FREQ_MAX      64000000U /* The first wait state goes up to 64 MHz  */
+#else
+#define RCC_SCALE1_HCLK_MAX        180000000U
+#define RCC_SCALE2_HCLK_MAX        168000000U
+#define RCC_SCALE3_HCLK_MAX        120000000U
+#endif
+#define RCC_FLASH_WS_FREQ           30000000U /* Max HCLK per wait state               */
 
 /* Private macro -------------------------------------------------------------*/
 #define __MCO1_CLK_ENABLE()   __HAL_RCC_GPIOA_CLK_ENABLE()
@@ -124,6 +148,14 @@
   * @}
   */
 /* Private function prototypes -----------------------------------------------*/
+/** @defgroup RCC_Private_Functions RCC Private Functions
+  * @{
+  */
+static HAL_StatusTypeDef RCC_WaitBitLoop(__IO uint32_t *Reg, uint32_t Mask, uint32_t Value);
+static uint32_t RCC_GetSysClockFreqFromPLLSource(uint32_t SYSCLKSource);
+/**
+  * @}
+  */
 /* Private functions ---------------------------------------------------------*/
 
 /** @defgroup RCC_Exported_Functions RCC Exported Functions
@@ -201,6 +233,13 @@
              Depending on the device voltage range, the maximum frequency should
              be adapted accordingly (refer to the product datasheets for more details).
 
+         (#) HAL_RCC_ClockConfigAuto() configures the busses clocks like HAL_RCC_ClockConfig()
+             but programs the minimum number of flash wait states allowed by the target HCLK
+             and the voltage scale in use, and enables the ART accelerator (instruction and
+             data caches) and the prefetch buffer when it is effective.
+             HAL_RCC_GetOptimalFlashLatency() returns this number of wait states, for a VDD
+             between 2.7 V and 3.6 V.
+
 @endverbatim
   * @{
   */
@@ -707,6 +746,135 @@ HAL_StatusTypeDef HAL_RCC_ClockConfig(RCC_ClkInitTypeDef  *RCC_ClkInitStruct, ui
   return HAL_OK;
 }
 
+/**
+  * @brief  Initializes the CPU, AHB and APB busses clocks according to the specified
+  *         parameters in the RCC_ClkInitStruct, with the minimum FLASH latency.
+  * @param  RCC_ClkInitStruct: pointer to an RCC_OscInitTypeDef structure that
+  *         contains the configuration information for the RCC peripheral.
+  * @note   The FLASH latency is computed by HAL_RCC_GetOptimalFlashLatency() from the
+  *         HCLK frequency and the voltage scale in use. The voltage scale must therefore
+  *         be configured before calling this function when the clock is increased, and
+  *         after it when the clock is decreased.
+  * @note   HAL_RCC_ClockConfig() applies the new HCLK prescaler before it selects the new
+  *         system clock source. The latency programmed during the transition also covers
+  *         the current SYSCLK divided by the new prescaler, then it is lowered to the value
+  *         needed by the final HCLK.
+  * @note   The instruction and data caches are enabled, after a reset if they were disabled
+  *         so that no line fetched before their deactivation is hit. The prefetch buffer is
+  *         enabled only with one wait state or more, it brings no gain at zero wait state
+  *         and increases the consumption.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_RCC_ClockConfigAuto(RCC_ClkInitTypeDef  *RCC_ClkInitStruct)
+{
+  uint32_t sysclk = 0U, cursysclk = 0U, hpre = 0U, vos = 0U;
+  uint32_t latency = 0U, transition_latency = 0U;
+  HAL_StatusTypeDef status = HAL_OK;
+
+  /* Check Null pointer */
+  if(RCC_ClkInitStruct == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Get the current and the target SYSCLK frequencies */
+  cursysclk = HAL_RCC_GetSysClockFreq();
+  if(((RCC_ClkInitStruct->ClockType) & RCC_CLOCKTYPE_SYSCLK) == RCC_CLOCKTYPE_SYSCLK)
+  {
+    switch(RCC_ClkInitStruct->SYSCLKSource)
+    {
+    case RCC_SYSCLKSOURCE_HSE:
+      sysclk = HSE_VALUE;
+      break;
+
+    case RCC_SYSCLKSOURCE_PLLCLK:
+    case RCC_SYSCLKSOURCE_PLLRCLK:
+      sysclk = RCC_GetSysClockFreqFromPLLSource(RCC_ClkInitStruct->SYSCLKSource);
+      break;
+
+    case RCC_SYSCLKSOURCE_HSI:
+    default:
+      sysclk = HSI_VALUE;
+      break;
+    }
+  }
+  else
+  {
+    sysclk = cursysclk;
+  }
+
+  /* Get the voltage scale, read from the register to keep the PWR driver optional */
+  if(__HAL_RCC_PWR_IS_CLK_ENABLED())
+  {
+    vos = READ_BIT(PWR->CR, PWR_CR_VOS);
+  }
+  else
+  {
+    __HAL_RCC_PWR_CLK_ENABLE();
+    vos = READ_BIT(PWR->CR, PWR_CR_VOS);
+    __HAL_RCC_PWR_CLK_DISABLE();
+  }
+
+  /* Get the final HCLK prescaler */
+  hpre = RCC->CFGR & RCC_CFGR_HPRE;
+  if(((RCC_ClkInitStruct->ClockType) & RCC_CLOCKTYPE_HCLK) == RCC_CLOCKTYPE_HCLK)
+  {
+    hpre = RCC_ClkInitStruct->AHBCLKDivider & RCC_CFGR_HPRE;
+  }
+  hpre = AHBPrescTable[hpre >> POSITION_VAL(RCC_CFGR_HPRE)];
+
+  /* Latency at the final HCLK, and at the current SYSCLK with the new HCLK prescaler */
+  latency = HAL_RCC_GetOptimalFlashLatency(sysclk >> hpre, vos);
+  transition_latency = HAL_RCC_GetOptimalFlashLatency(cursysclk >> hpre, vos);
+
+  if(transition_latency < latency)
+  {
+    transition_latency = latency;
+  }
+
+  status = HAL_RCC_ClockConfig(RCC_ClkInitStruct, transition_latency);
+
+  if(status == HAL_OK)
+  {
+    /* Decrease the number of wait states down to the one needed by the final HCLK */
+    if(latency < (FLASH->ACR & FLASH_ACR_LATENCY))
+    {
+      __HAL_FLASH_SET_LATENCY(latency);
+
+      /* Check that the new number of wait states is taken into account to access the Flash
+      memory by reading the FLASH_ACR register */
+      if((FLASH->ACR & FLASH_ACR_LATENCY) != latency)
+      {
+        return HAL_ERROR;
+      }
+    }
+
+    /* Enable the ART accelerator, resetting the caches which were disabled */
+    if((FLASH->ACR & FLASH_ACR_ICEN) == 0U)
+    {
+      __HAL_FLASH_INSTRUCTION_CACHE_RESET();
+      __HAL_FLASH_INSTRUCTION_CACHE_ENABLE();
+    }
+    if((FLASH->ACR & FLASH_ACR_DCEN) == 0U)
+    {
+      __HAL_FLASH_DATA_CACHE_RESET();
+      __HAL_FLASH_DATA_CACHE_ENABLE();
+    }
+
+    /* Prefetch buffer is only useful with wait states */
+    if(latency != FLASH_LATENCY_0)
+    {
+      __HAL_FLASH_PREFETCH_BUFFER_ENABLE();
+    }
+    else
+    {
+      __HAL_FLASH_PREFETCH_BUFFER_DISABLE();
+    }
+  }
+
+  return status;
+}
+
 /**
   * @}
   */
@@ -1057,6 +1225,179 @@ void HAL_RCC_GetClockConfig(RCC_ClkInitTypeDef  *RCC_ClkInitStruct, uint32_t *pF
   *pFLatency = (uint32_t)(FLASH->ACR & FLASH_ACR_LATENCY);
 }
 
+/**
+  * @brief  Returns the minimum FLASH latency allowed for an HCLK frequency and a voltage scale.
+  * @param  HCLKFreq: HCLK frequency in Hz.
+  * @param  VoltageScaling: voltage scale, as returned by HAL_PWREx_GetVoltageRange().
+  *          This parameter can be one of the following values:
+  *            @arg PWR_REGULATOR_VOLTAGE_SCALE1: Regulator voltage output Scale 1 mode
+  *            @arg PWR_REGULATOR_VOLTAGE_SCALE2: Regulator voltage output Scale 2 mode
+  *            @arg PWR_REGULATOR_VOLTAGE_SCALE3: Regulator voltage output Scale 3 mode
+  *                 (not available on STM32F405xx/07xx and STM32F415xx/17xx devices)
+  * @note   The wait states are those of a VDD between 2.7 V and 3.6 V.
+  * @note   The HCLK frequency is not checked against the maximum of the voltage scale:
+  *         above it the latency of this maximum is returned.
+  * @retval FLASH latency, a value of @ref FLASH_Latency
+  */
+uint32_t HAL_RCC_GetOptimalFlashLatency(uint32_t HCLKFreq, uint32_t VoltageScaling)
+{
+  uint32_t hclkmax = 0U;
+  uint32_t latency = 0U;
+
+  if(VoltageScaling == PWR_REGULATOR_VOLTAGE_SCALE1)
+  {
+    hclkmax = RCC_SCALE1_HCLK_MAX;
+  }
+  else if(VoltageScaling == PWR_REGULATOR_VOLTAGE_SCALE2)
+  {
+    hclkmax = RCC_SCALE2_HCLK_MAX;
+  }
+  else
+  {
+    hclkmax = RCC_SCALE3_HCLK_MAX;
+  }
+
+  if(HCLKFreq > hclkmax)
+  {
+    HCLKFreq = hclkmax;
+  }
+
+#if defined(RCC_FLASH_WS1_FREQ_MAX)
+  /* Wait states are not evenly spread */
+  if(HCLKFreq <= RCC_FLASH_WS_FREQ)
+  {
+    latency = FLASH_LATENCY_0;
+  }
+  else if(HCLKFreq <= RCC_FLASH_WS1_FREQ_MAX)
+  {
+    latency = FLASH_LATENCY_1;
+  }
+  else if(HCLKFreq <= (3U * RCC_FLASH_WS_FREQ))
+  {
+    latency = FLASH_LATENCY_2;
+  }
+  else
+  {
+    latency = FLASH_LATENCY_3;
+  }
+#else
+  /* One wait state per RCC_FLASH_WS_FREQ */
+  latency = (HCLKFreq == 0U) ? FLASH_LATENCY_0 : ((HCLKFreq - 1U) / RCC_FLASH_WS_FREQ);
+#endif /* RCC_FLASH_WS1_FREQ_MAX */
+
+  return latency;
+}
+
+/**
+  * @brief  Saves the oscillators, PLLs, bus prescalers, Flash and over-drive
+  *         configuration, to be restored after STOP mode by HAL_RCC_RestoreClockState().
+  * @note   The PLLI2S and PLLSAI configuration registers are kept in STOP mode,
+  *         only their enable bits are saved.
+  * @param  pState: pointer to an RCC_ClockStateTypeDef structure to fill.
+  * @retval None
+  */
+void HAL_RCC_SaveClockState(RCC_ClockStateTypeDef *pState)
+{
+  pState->CR = RCC->CR;
+  pState->PLLCFGR = RCC->PLLCFGR;
+  pState->CFGR = RCC->CFGR;
+  pState->FlashACR = FLASH->ACR & ~(FLASH_ACR_ICRST | FLASH_ACR_DCRST);
+  pState->PwrCR = PWR->CR;
+  pState->SystemCoreClock = SystemCoreClock;
+}
+
+/**
+  * @brief  Restores the clock configuration saved by HAL_RCC_SaveClockState(),
+  *         with the minimum register sequence.
+  * @note   To be called on wake-up from STOP mode, when the system runs on HSI
+  *         with the HSE and PLLs off, instead of HAL_RCC_OscConfig() and
+  *         HAL_RCC_ClockConfig(): the saved configuration is not checked again,
+  *         the PLL lock and the over-drive switch are waited in parallel and the
+  *         time base is not re-initialized, as HCLK gets back its saved value.
+  * @note   The ready flags are polled with bounded loops rather than HAL_GetTick(),
+  *         so this function can be called before the tick is resumed.
+  * @param  pState: pointer to an RCC_ClockStateTypeDef structure saved before STOP mode.
+  * @retval HAL status: HAL_TIMEOUT if an oscillator, PLL or over-drive does not get ready.
+  */
+HAL_StatusTypeDef HAL_RCC_RestoreClockState(const RCC_ClockStateTypeDef *pState)
+{
+  uint32_t sysclksource = pState->CFGR & RCC_CFGR_SW;
+
+  /* HSE: the bypass must be configured while the oscillator is off */
+  if(((pState->CR & RCC_CR_HSEON) != 0U) && ((RCC->CR & RCC_CR_HSERDY) == 0U))
+  {
+    MODIFY_REG(RCC->CR, RCC_CR_HSEBYP, pState->CR & RCC_CR_HSEBYP);
+    SET_BIT(RCC->CR, RCC_CR_HSEON);
+    if(RCC_WaitBitLoop(&RCC->CR, RCC_CR_HSERDY, RCC_CR_HSERDY) != HAL_OK)
+    {
+      return HAL_TIMEOUT;
+    }
+  }
+
+  /* Main PLL: its configuration can only be written while it is disabled */
+  if(((pState->CR & RCC_CR_PLLON) != 0U) && ((RCC->CR & RCC_CR_PLLON) == 0U))
+  {
+    RCC->PLLCFGR = pState->PLLCFGR;
+    SET_BIT(RCC->CR, RCC_CR_PLLON);
+  }
+
+#if defined(PWR_CR_ODEN)
+  /* Over-drive is disabled in STOP mode: enable it while the PLL locks */
+  if(((pState->PwrCR & PWR_CR_ODEN) != 0U) && ((PWR->CSR & PWR_CSR_ODSWRDY) == 0U))
+  {
+    __HAL_RCC_PWR_CLK_ENABLE();
+    SET_BIT(PWR->CR, PWR_CR_ODEN);
+    if(RCC_WaitBitLoop(&PWR->CSR, PWR_CSR_ODRDY, PWR_CSR_ODRDY) != HAL_OK)
+    {
+      return HAL_TIMEOUT;
+    }
+    SET_BIT(PWR->CR, PWR_CR_ODSWEN);
+    if(RCC_WaitBitLoop(&PWR->CSR, PWR_CSR_ODSWRDY, PWR_CSR_ODSWRDY) != HAL_OK)
+    {
+      return HAL_TIMEOUT;
+    }
+  }
+#endif /* PWR_CR_ODEN */
+
+  /* Flash latency before the frequency increase, then bus prescalers with the
+     current system clock source */
+  FLASH->ACR = pState->FlashACR;
+  RCC->CFGR = (pState->CFGR & ~(RCC_CFGR_SW | RCC_CFGR_SWS)) | (RCC->CFGR & RCC_CFGR_SW);
+
+  if((pState->CR & RCC_CR_PLLON) != 0U)
+  {
+    if(RCC_WaitBitLoop(&RCC->CR, RCC_CR_PLLRDY, RCC_CR_PLLRDY) != HAL_OK)
+    {
+      return HAL_TIMEOUT;
+    }
+  }
+
+  /* Audio and display PLLs: their configuration is kept in STOP mode */
+#if defined(RCC_CR_PLLI2SON)
+  SET_BIT(RCC->CR, pState->CR & RCC_CR_PLLI2SON);
+#endif /* RCC_CR_PLLI2SON */
+#if defined(RCC_CR_PLLSAION)
+  SET_BIT(RCC->CR, pState->CR & RCC_CR_PLLSAION);
+#endif /* RCC_CR_PLLSAION */
+
+  /* System clock switch */
+  MODIFY_REG(RCC->CFGR, RCC_CFGR_SW, sysclksource);
+  if(RCC_WaitBitLoop(&RCC->CFGR, RCC_CFGR_SWS, sysclksource << RCC_CFGR_SWS_Pos) != HAL_OK)
+  {
+    return HAL_TIMEOUT;
+  }
+
+  /* HSI was only kept for the wake-up */
+  if((pState->CR & RCC_CR_HSION) == 0U)
+  {
+    CLEAR_BIT(RCC->CR, RCC_CR_HSION);
+  }
+
+  SystemCoreClock = pState->SystemCoreClock;
+
+  return HAL_OK;
+}
+
 /**
   * @brief This function handles the RCC CSS interrupt request.
   * @note This API should be called under the NMI_Handler().
@@ -1090,6 +1431,74 @@ __weak void HAL_RCC_CSSCallback(void)
   * @}
   */
 
+/**
+  * @}
+  */
+
+/** @addtogroup RCC_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Waits for register bits to reach a value, with a bounded number of loops.
+  * @param  Reg: register to poll.
+  * @param  Mask: bits to check.
+  * @param  Value: expected value of the bits.
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef RCC_WaitBitLoop(__IO uint32_t *Reg, uint32_t Mask, uint32_t Value)
+{
+  uint32_t count = RCC_RESTORE_TIMEOUT_LOOPS;
+
+  while((*Reg & Mask) != Value)
+  {
+    if(count == 0U)
+    {
+      return HAL_TIMEOUT;
+    }
+    count--;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Computes the SYSCLK frequency delivered by the main PLL.
+  * @param  SYSCLKSource: PLL output used as system clock, RCC_SYSCLKSOURCE_PLLCLK
+  *         or RCC_SYSCLKSOURCE_PLLRCLK.
+  * @retval SYSCLK frequency
+  */
+static uint32_t RCC_GetSysClockFreqFromPLLSource(uint32_t SYSCLKSource)
+{
+  uint32_t pllm = 0U, pllvco = 0U, plldiv = 0U;
+
+  /* PLL_VCO = (HSE_VALUE or HSI_VALUE / PLLM) * PLLN
+     SYSCLK = PLL_VCO / PLLP or PLLR */
+  pllm = RCC->PLLCFGR & RCC_PLLCFGR_PLLM;
+  if(__HAL_RCC_GET_PLL_OSCSOURCE() != RCC_PLLSOURCE_HSI)
+  {
+    /* HSE used as PLL clock source */
+    pllvco = ((HSE_VALUE / pllm) * ((RCC->PLLCFGR & RCC_PLLCFGR_PLLN) >> POSITION_VAL(RCC_PLLCFGR_PLLN)));
+  }
+  else
+  {
+    /* HSI used as PLL clock source */
+    pllvco = ((HSI_VALUE / pllm) * ((RCC->PLLCFGR & RCC_PLLCFGR_PLLN) >> POSITION_VAL(RCC_PLLCFGR_PLLN)));
+  }
+
+  plldiv = ((((RCC->PLLCFGR & RCC_PLLCFGR_PLLP) >> POSITION_VAL(RCC_PLLCFGR_PLLP)) + 1U) * 2U);
+#if defined(RCC_PLLR_SYSCLK_SUPPORT)
+  if(SYSCLKSource == RCC_SYSCLKSOURCE_PLLRCLK)
+  {
+    plldiv = ((RCC->PLLCFGR & RCC_PLLCFGR_PLLR) >> POSITION_VAL(RCC_PLLCFGR_PLLR));
+  }
+#else
+  UNUSED(SYSCLKSource);
+#endif /* RCC_PLLR_SYSCLK_SUPPORT */
+
+  return pllvco / plldiv;
+}
+
 /**
   * @}
   */
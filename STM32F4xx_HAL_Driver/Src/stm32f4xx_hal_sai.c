@@ -115,6 +115,11 @@
       (+) Pause the DMA Transfer using HAL_SAI_DMAPause()
       (+) Resume the DMA Transfer using HAL_SAI_DMAResume()
       (+) Stop the DMA Transfer using HAL_SAI_DMAStop()
+      (+) Receive continuously in two buffers (DMA double buffer mode) using
+          HAL_SAI_ReceiveDoubleBuffer_DMA()
+      (+) At reception end of each buffer HAL_SAI_RxM0CpltCallback() or HAL_SAI_RxM1CpltCallback()
+          is executed and user can process the filled buffer, or replace the idle buffer
+          using HAL_DMAEx_ChangeMemory(); the reception is stopped using HAL_SAI_DMAStop()
 
     *** SAI HAL driver additional function list ***
     ===============================================
@@ -237,6 +242,8 @@ static void SAI_DMATxCplt(DMA_HandleTypeDef *hdma);
 static void SAI_DMATxHalfCplt(DMA_HandleTypeDef *hdma);
 static void SAI_DMARxCplt(DMA_HandleTypeDef *hdma);
 static void SAI_DMARxHalfCplt(DMA_HandleTypeDef *hdma);
+static void SAI_DMARxM0Cplt(DMA_HandleTypeDef *hdma);
+static void SAI_DMARxM1Cplt(DMA_HandleTypeDef *hdma);
 static void SAI_DMAError(DMA_HandleTypeDef *hdma);
 static void SAI_DMAAbort(DMA_HandleTypeDef *hdma);
 /**
@@ -1218,6 +1225,82 @@ HAL_StatusTypeDef HAL_SAI_Receive_DMA(SAI_HandleTypeDef *hsai, uint8_t *pData, u
   }
 }
 
+/**
+  * @brief  Receive data continuously in non-blocking mode with DMA double buffer mode.
+  * @param  hsai: pointer to a SAI_HandleTypeDef structure that contains
+  *               the configuration information for SAI module.
+  * @param  pData0: Pointer to the first data buffer (DMA memory 0).
+  * @param  pData1: Pointer to the second data buffer (DMA memory 1).
+  * @param  Size: Amount of data to be received in each buffer
+  * @note   The reception alternates between the two buffers until HAL_SAI_DMAStop()
+  *         is called. HAL_SAI_RxM0CpltCallback() and HAL_SAI_RxM1CpltCallback() are
+  *         executed each time the corresponding buffer has been filled.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SAI_ReceiveDoubleBuffer_DMA(SAI_HandleTypeDef *hsai, uint8_t *pData0, uint8_t *pData1, uint16_t Size)
+{
+  if((pData0 == NULL) || (pData1 == NULL) || (Size == 0))
+  {
+    return  HAL_ERROR;
+  }
+
+  if(hsai->State == HAL_SAI_STATE_READY)
+  {
+    /* Process Locked */
+    __HAL_LOCK(hsai);
+
+    hsai->pBuffPtr = pData0;
+    hsai->XferSize = Size;
+    hsai->XferCount = Size;
+    hsai->ErrorCode = HAL_SAI_ERROR_NONE;
+    hsai->State = HAL_SAI_STATE_BUSY_RX;
+
+    /* Half transfer callbacks are not used in double buffer mode */
+    hsai->hdmarx->XferHalfCpltCallback = NULL;
+    hsai->hdmarx->XferM1HalfCpltCallback = NULL;
+
+    /* Set the SAI Rx DMA memory 0 and memory 1 transfer complete callbacks */
+    hsai->hdmarx->XferCpltCallback = SAI_DMARxM0Cplt;
+    hsai->hdmarx->XferM1CpltCallback = SAI_DMARxM1Cplt;
+
+    /* Set the DMA error callback */
+    hsai->hdmarx->XferErrorCallback = SAI_DMAError;
+
+    /* Set the DMA Rx abort callback */
+    hsai->hdmarx->XferAbortCallback = NULL;
+
+    /* Enable the Rx DMA Stream in double buffer mode */
+    if(HAL_DMAEx_MultiBufferStart_IT(hsai->hdmarx, (uint32_t)&hsai->Instance->DR, (uint32_t)pData0, (uint32_t)pData1, hsai->XferSize) != HAL_OK)
+    {
+      hsai->State = HAL_SAI_STATE_READY;
+      __HAL_UNLOCK(hsai);
+      return  HAL_ERROR;
+    }
+
+    /* Check if the SAI is already enabled */
+    if((hsai->Instance->CR1 & SAI_xCR1_SAIEN) == RESET)
+    {
+      /* Enable SAI peripheral */
+      __HAL_SAI_ENABLE(hsai);
+    }
+
+    /* Enable the interrupts for error handling */
+    __HAL_SAI_ENABLE_IT(hsai, SAI_InterruptFlag(hsai, SAI_MODE_DMA));
+
+    /* Enable SAI Rx DMA Request */
+    hsai->Instance->CR1 |= SAI_xCR1_DMAEN;
+
+    /* Process Unlocked */
+    __HAL_UNLOCK(hsai);
+
+    return HAL_OK;
+  }
+  else
+  {
+    return HAL_BUSY;
+  }
+}
+
 /**
   * @brief  Enable the Tx mute mode.
   * @param  hsai: pointer to a SAI_HandleTypeDef structure that contains
@@ -1545,6 +1628,38 @@ __weak void HAL_SAI_RxHalfCpltCallback(SAI_HandleTypeDef *hsai)
    */
 }
 
+/**
+  * @brief Rx memory 0 buffer completed callback (double buffer reception).
+  * @param  hsai: pointer to a SAI_HandleTypeDef structure that contains
+  *               the configuration information for SAI module.
+  * @retval None
+  */
+__weak void HAL_SAI_RxM0CpltCallback(SAI_HandleTypeDef *hsai)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hsai);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_SAI_RxM0CpltCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief Rx memory 1 buffer completed callback (double buffer reception).
+  * @param  hsai: pointer to a SAI_HandleTypeDef structure that contains
+  *               the configuration information for SAI module.
+  * @retval None
+  */
+__weak void HAL_SAI_RxM1CpltCallback(SAI_HandleTypeDef *hsai)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hsai);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_SAI_RxM1CpltCallback could be implemented in the user file
+   */
+}
+
 /**
   * @brief SAI error callback.
   * @param  hsai: pointer to a SAI_HandleTypeDef structure that contains
@@ -2101,6 +2216,32 @@ static void SAI_DMARxHalfCplt(DMA_HandleTypeDef *hdma)
   HAL_SAI_RxHalfCpltCallback(hsai);
 }
 
+/**
+  * @brief DMA SAI memory 0 receive complete callback (double buffer mode).
+  * @param  hdma: pointer to a DMA_HandleTypeDef structure that contains
+  *               the configuration information for the specified DMA module.
+  * @retval None
+  */
+static void SAI_DMARxM0Cplt(DMA_HandleTypeDef *hdma)
+{
+  SAI_HandleTypeDef* hsai = (SAI_HandleTypeDef*)((DMA_HandleTypeDef*)hdma)->Parent;
+
+  HAL_SAI_RxM0CpltCallback(hsai);
+}
+
+/**
+  * @brief DMA SAI memory 1 receive complete callback (double buffer mode).
+  * @param  hdma: pointer to a DMA_HandleTypeDef structure that contains
+  *               the configuration information for the specified DMA module.
+  * @retval None
+  */
+static void SAI_DMARxM1Cplt(DMA_HandleTypeDef *hdma)
+{
+  SAI_HandleTypeDef* hsai = (SAI_HandleTypeDef*)((DMA_HandleTypeDef*)hdma)->Parent;
+
+  HAL_SAI_RxM1CpltCallback(hsai);
+}
+
 /**
   * @brief DMA SAI communication error callback.
   * @param  hdma: pointer to a DMA_HandleTypeDef structure that contains
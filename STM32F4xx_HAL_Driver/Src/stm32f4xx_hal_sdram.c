@@ -31,6 +31,10 @@
    (#) Declare a FMC_SDRAM_TimingTypeDef structure; for example:
           FMC_SDRAM_TimingTypeDef  Timing;
       and fill its fields with the allowed values of the structure member.
+      Alternatively, fill a SDRAM_DeviceParamTypeDef structure with the values of the
+      SDRAM datasheet and call HAL_SDRAM_ComputeTiming(), after the "Init" field
+      SDClockPeriod has been set, to derive the Timing structure, the refresh
+      counter and the CASLatency, ReadBurst and ReadPipeDelay "Init" fields from HCLK.
 
    (#) Initialize the SDRAM Controller by calling the function HAL_SDRAM_Init(). This function
        performs the following sequence:
@@ -42,7 +46,8 @@
             FMC_SDRAM_Timing_Init()
        (##) Program the SDRAM external device by applying its initialization sequence
             according to the device plugged in your hardware. This step is mandatory
-            for accessing the SDRAM device.
+            for accessing the SDRAM device. The refresh counter returned by
+            HAL_SDRAM_ComputeTiming() is then programmed with HAL_SDRAM_ProgramRefreshRate().
 
    (#) At this stage you can perform read/write accesses from/to the memory connected
        to the SDRAM Bank. You can perform either polling or DMA transfer using the
@@ -56,6 +61,17 @@
        device. The command to be sent must be configured with the FMC_SDRAM_CommandTypeDef
        structure.
 
+   (#) The FMC maps the SDRAM internal bank address bits above the row and column
+       bits, so a linear buffer stays in one internal bank. Buffers accessed
+       concurrently (for example a LTDC framebuffer and a heap) should be placed
+       HAL_SDRAM_GetInternalBankSize() bytes apart so that each internal bank keeps
+       its own row open instead of forcing a precharge/activate on every access.
+
+   (#) The throughput and latency obtained with a given configuration can be measured
+       with HAL_SDRAM_Benchmark(). The "hdma" field must then point to a DMA2 stream
+       configured in memory-to-memory mode with word data alignment, address
+       increment on both sides and FIFO enabled.
+
    (#) You can continuously monitor the SDRAM device HAL state by calling the function
        HAL_SDRAM_GetState()
 
@@ -107,9 +123,27 @@
 
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
+/** @addtogroup SDRAM_Private_Constants
+  * @{
+  */
+#define SDRAM_TIMING_MAX_CYCLES       16U     /* Maximum value of the SDTR fields        */
+#define SDRAM_REFRESH_MARGIN          20U     /* Refresh counter safety margin (RM)      */
+#define SDRAM_REFRESH_RATE_MIN        42U     /* Refresh counter must be greater than 41 */
+#define SDRAM_FMC_SETUP_TIME_PS       2500U   /* FMC data input setup time               */
+#define SDRAM_BENCHMARK_READS         256U    /* Number of random reads of the benchmark */
+/**
+  * @}
+  */
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
-/* Private functions ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+/** @addtogroup SDRAM_Private_Functions
+  * @{
+  */
+static uint32_t SDRAM_NsToCycles(uint32_t Ns, uint32_t SdramFreq);
+/**
+  * @}
+  */
 /* Exported functions --------------------------------------------------------*/
 /** @defgroup SDRAM_Exported_Functions SDRAM Exported Functions
   * @{
@@ -168,6 +202,123 @@ HAL_StatusTypeDef HAL_SDRAM_Init(SDRAM_HandleTypeDef *hsdram, FMC_SDRAM_TimingTy
   return HAL_OK;
 }
 
+/**
+  * @brief  Computes the SDRAM timings and read path configuration from the
+  *         device datasheet parameters.
+  * @note   The SDRAM clock is derived from HclkFreq and the SDClockPeriod field
+  *         of hsdram->Init, which must be set before calling this function.
+  * @note   The CASLatency, ReadBurst and ReadPipeDelay fields of hsdram->Init are
+  *         updated. ReadBurst is always enabled so that the FMC anticipates the
+  *         next reads of a burst, which benefits DMA and LTDC sequential accesses.
+  *         ReadPipeDelay is chosen so that the data returned tAC plus the board
+  *         delay after the SDCLK edge still meets the FMC setup time; the result
+  *         should be validated on the board with HAL_SDRAM_Benchmark().
+  * @note   When both SDRAM banks are used, RowCycleDelay and RPDelay are shared
+  *         and taken from bank 1: use the worst case of both devices.
+  * @param  hsdram: pointer to a SDRAM_HandleTypeDef structure that contains
+  *                the configuration information for SDRAM module.
+  * @param  pParam: pointer to the SDRAM device datasheet parameters
+  * @param  HclkFreq: HCLK frequency in Hz
+  * @param  Timing: pointer to the SDRAM timing structure to fill
+  * @param  pRefreshRate: pointer to the refresh counter value to pass to
+  *                HAL_SDRAM_ProgramRefreshRate()
+  * @retval HAL status: HAL_ERROR if a parameter is out of the FMC range at this
+  *                frequency
+  */
+HAL_StatusTypeDef HAL_SDRAM_ComputeTiming(SDRAM_HandleTypeDef *hsdram, SDRAM_DeviceParamTypeDef *pParam, uint32_t HclkFreq,
+                                          FMC_SDRAM_TimingTypeDef *Timing, uint32_t *pRefreshRate)
+{
+  uint32_t sdramfreq = 0U;
+  uint32_t sdclkperiodps = 0U;
+  uint32_t hclkperiodps = 0U;
+  uint32_t datavalidps = 0U;
+  uint32_t refreshrate = 0U;
+  uint32_t rpipe = 0U;
+
+  if((hsdram == NULL) || (pParam == NULL) || (Timing == NULL) || (pRefreshRate == NULL) || (HclkFreq == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  if((pParam->RowCount == 0U) || (pParam->CASLatency == 0U) || (pParam->CASLatency > 3U))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Derive the SDRAM clock frequency from HCLK */
+  if(hsdram->Init.SDClockPeriod == FMC_SDRAM_CLOCK_PERIOD_2)
+  {
+    sdramfreq = HclkFreq / 2U;
+  }
+  else if(hsdram->Init.SDClockPeriod == FMC_SDRAM_CLOCK_PERIOD_3)
+  {
+    sdramfreq = HclkFreq / 3U;
+  }
+  else
+  {
+    return HAL_ERROR;
+  }
+
+  /* Convert the datasheet delays to memory clock cycles */
+  Timing->LoadToActiveDelay    = (pParam->LoadToActiveDelay == 0U) ? 1U : pParam->LoadToActiveDelay;
+  Timing->ExitSelfRefreshDelay = SDRAM_NsToCycles(pParam->ExitSelfRefreshNs, sdramfreq);
+  Timing->SelfRefreshTime      = SDRAM_NsToCycles(pParam->SelfRefreshTimeNs, sdramfreq);
+  Timing->RowCycleDelay        = SDRAM_NsToCycles(pParam->RowCycleNs, sdramfreq);
+  Timing->WriteRecoveryTime    = SDRAM_NsToCycles(pParam->WriteRecoveryNs, sdramfreq);
+  Timing->RPDelay              = SDRAM_NsToCycles(pParam->RPDelayNs, sdramfreq);
+  Timing->RCDDelay             = SDRAM_NsToCycles(pParam->RCDDelayNs, sdramfreq);
+
+  /* The FMC requires TWR >= TRAS - TRCD and TWR >= TRC - TRCD - TRP */
+  if((Timing->WriteRecoveryTime + Timing->RCDDelay) < Timing->SelfRefreshTime)
+  {
+    Timing->WriteRecoveryTime = Timing->SelfRefreshTime - Timing->RCDDelay;
+  }
+  if((Timing->WriteRecoveryTime + Timing->RCDDelay + Timing->RPDelay) < Timing->RowCycleDelay)
+  {
+    Timing->WriteRecoveryTime = Timing->RowCycleDelay - Timing->RCDDelay - Timing->RPDelay;
+  }
+
+  if((Timing->LoadToActiveDelay > SDRAM_TIMING_MAX_CYCLES) || (Timing->ExitSelfRefreshDelay > SDRAM_TIMING_MAX_CYCLES) ||
+     (Timing->SelfRefreshTime > SDRAM_TIMING_MAX_CYCLES) || (Timing->RowCycleDelay > SDRAM_TIMING_MAX_CYCLES) ||
+     (Timing->WriteRecoveryTime > SDRAM_TIMING_MAX_CYCLES) || (Timing->RPDelay > SDRAM_TIMING_MAX_CYCLES) ||
+     (Timing->RCDDelay > SDRAM_TIMING_MAX_CYCLES))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Refresh counter: COUNT = (tREF / number of rows) x fSDCLK - 20 */
+  refreshrate = (uint32_t)(((uint64_t)pParam->RefreshPeriodMs * (uint64_t)sdramfreq) / (1000U * (uint64_t)pParam->RowCount));
+  if(refreshrate < (SDRAM_REFRESH_RATE_MIN + SDRAM_REFRESH_MARGIN))
+  {
+    return HAL_ERROR;
+  }
+  refreshrate -= SDRAM_REFRESH_MARGIN;
+  if(refreshrate > 8191U)
+  {
+    refreshrate = 8191U;
+  }
+  *pRefreshRate = refreshrate;
+
+  /* Read path: CAS latency, read burst and read pipe delay */
+  hsdram->Init.CASLatency = pParam->CASLatency << FMC_SDCR1_CAS_Pos;
+  hsdram->Init.ReadBurst  = FMC_SDRAM_RBURST_ENABLE;
+
+  sdclkperiodps = (uint32_t)(1000000000000ULL / sdramfreq);
+  hclkperiodps  = (uint32_t)(1000000000000ULL / HclkFreq);
+  datavalidps   = pParam->AccessTimePs + pParam->BoardDelayPs + SDRAM_FMC_SETUP_TIME_PS;
+  if(datavalidps > sdclkperiodps)
+  {
+    rpipe = ((datavalidps - sdclkperiodps) + hclkperiodps - 1U) / hclkperiodps;
+  }
+  if(rpipe > 2U)
+  {
+    return HAL_ERROR;
+  }
+  hsdram->Init.ReadPipeDelay = rpipe << FMC_SDCR1_RPIPE_Pos;
+
+  return HAL_OK;
+}
+
 /**
   * @brief  Perform the SDRAM device initialization sequence.
   * @param  hsdram: pointer to a SDRAM_HandleTypeDef structure that contains
@@ -803,6 +954,136 @@ uint32_t HAL_SDRAM_GetModeStatus(SDRAM_HandleTypeDef *hsdram)
   return(FMC_SDRAM_GetModeStatus(hsdram->Instance, hsdram->Init.SDBank));
 }
 
+/**
+  * @brief  Returns the size of one SDRAM internal bank in the FMC address space.
+  * @note   Buffers accessed concurrently should be placed this number of bytes
+  *         apart so that they are served by different internal banks.
+  * @param  hsdram: pointer to a SDRAM_HandleTypeDef structure that contains
+  *                the configuration information for SDRAM module.
+  * @retval Internal bank size in bytes
+  */
+uint32_t HAL_SDRAM_GetInternalBankSize(SDRAM_HandleTypeDef *hsdram)
+{
+  uint32_t colbits = 8U + hsdram->Init.ColumnBitsNumber;
+  uint32_t rowbits = 11U + (hsdram->Init.RowBitsNumber >> FMC_SDCR1_NR_Pos);
+  uint32_t widthshift = hsdram->Init.MemoryDataWidth >> FMC_SDCR1_MWID_Pos;
+
+  return (1UL << (colbits + rowbits + widthshift));
+}
+
+/**
+  * @brief  Measures the SDRAM DMA bandwidth and the CPU random read latency.
+  * @note   The content of the SDRAM area and of pBuffer is overwritten.
+  * @note   The DMA stream pointed by hsdram->hdma must be configured in
+  *         memory-to-memory mode with word data alignment. It is used in
+  *         polling mode, the SDRAM DMA callbacks are not called.
+  * @note   Durations are measured with the DWT cycle counter, which is enabled
+  *         by this function if it is not already running. Bandwidths are
+  *         computed from SystemCoreClock.
+  * @note   The random reads are spread over the whole area: use an area larger
+  *         than a few rows to measure the row miss latency.
+  * @param  hsdram: pointer to a SDRAM_HandleTypeDef structure that contains
+  *                the configuration information for SDRAM module.
+  * @param  pAddress: Pointer to the SDRAM area to test
+  * @param  pBuffer: Pointer to an internal SRAM buffer of BufferSize words
+  * @param  BufferSize: Number of words to transfer (1 to 65535)
+  * @param  pResult: Pointer to the benchmark results
+  * @param  Timeout: Timeout duration of each DMA transfer
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SDRAM_Benchmark(SDRAM_HandleTypeDef *hsdram, uint32_t *pAddress, uint32_t *pBuffer, uint32_t BufferSize,
+                                      SDRAM_BenchmarkTypeDef *pResult, uint32_t Timeout)
+{
+  __IO uint32_t *psdramaddress = (__IO uint32_t *)pAddress;
+  HAL_StatusTypeDef status = HAL_OK;
+  uint32_t tmp = 0U;
+  uint32_t start = 0U;
+  uint32_t cycles = 0U;
+  uint32_t seed = 0x12345678U;
+  uint32_t index = 0U;
+  uint32_t sum = 0U;
+
+  if((hsdram->hdma == NULL) || (pResult == NULL) || (BufferSize == 0U) || (BufferSize > 0xFFFFU))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Process Locked */
+  __HAL_LOCK(hsdram);
+
+  /* Check the SDRAM controller state */
+  tmp = hsdram->State;
+
+  if(tmp == HAL_SDRAM_STATE_BUSY)
+  {
+    __HAL_UNLOCK(hsdram);
+    return HAL_BUSY;
+  }
+  else if((tmp == HAL_SDRAM_STATE_PRECHARGED) || (tmp == HAL_SDRAM_STATE_WRITE_PROTECTED))
+  {
+    __HAL_UNLOCK(hsdram);
+    return HAL_ERROR;
+  }
+
+  hsdram->State = HAL_SDRAM_STATE_BUSY;
+
+  /* Enable the DWT cycle counter if it is not running */
+  if((DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk) == 0U)
+  {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0U;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+  }
+
+  /* DMA write: internal buffer to SDRAM */
+  start = DWT->CYCCNT;
+  status = HAL_DMA_Start(hsdram->hdma, (uint32_t)pBuffer, (uint32_t)pAddress, BufferSize);
+  if(status == HAL_OK)
+  {
+    status = HAL_DMA_PollForTransfer(hsdram->hdma, HAL_DMA_FULL_TRANSFER, Timeout);
+  }
+  cycles = DWT->CYCCNT - start;
+  pResult->WriteCycles = cycles;
+  pResult->WriteBandwidth = (cycles == 0U) ? 0U : (uint32_t)(((uint64_t)BufferSize * 4U * SystemCoreClock) / cycles);
+
+  /* DMA read: SDRAM to internal buffer */
+  if(status == HAL_OK)
+  {
+    start = DWT->CYCCNT;
+    status = HAL_DMA_Start(hsdram->hdma, (uint32_t)pAddress, (uint32_t)pBuffer, BufferSize);
+    if(status == HAL_OK)
+    {
+      status = HAL_DMA_PollForTransfer(hsdram->hdma, HAL_DMA_FULL_TRANSFER, Timeout);
+    }
+    cycles = DWT->CYCCNT - start;
+    pResult->ReadCycles = cycles;
+    pResult->ReadBandwidth = (cycles == 0U) ? 0U : (uint32_t)(((uint64_t)BufferSize * 4U * SystemCoreClock) / cycles);
+  }
+
+  /* CPU random single word reads */
+  if(status == HAL_OK)
+  {
+    start = DWT->CYCCNT;
+    for(tmp = 0U; tmp < SDRAM_BENCHMARK_READS; tmp++)
+    {
+      seed = (seed * 1664525U) + 1013904223U;
+      index = (seed >> 8U) % BufferSize;
+      sum += psdramaddress[index];
+    }
+    cycles = DWT->CYCCNT - start;
+    pResult->ReadLatencyCycles = cycles / SDRAM_BENCHMARK_READS;
+    pResult->ReadLatencyNs = (uint32_t)(((uint64_t)cycles * 1000000000U) / ((uint64_t)SystemCoreClock * SDRAM_BENCHMARK_READS));
+    UNUSED(sum);
+  }
+
+  hsdram->State = HAL_SDRAM_STATE_READY;
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(hsdram);
+
+  return status;
+}
+
 /**
   * @}
   */
@@ -837,6 +1118,28 @@ HAL_SDRAM_StateTypeDef HAL_SDRAM_GetState(SDRAM_HandleTypeDef *hsdram)
   * @}
   */
 
+/**
+  * @}
+  */
+
+/** @addtogroup SDRAM_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Converts a datasheet delay to a number of SDRAM clock cycles,
+  *         rounded up and at least 1.
+  * @param  Ns: delay in ns
+  * @param  SdramFreq: SDRAM clock frequency in Hz
+  * @retval Number of SDRAM clock cycles
+  */
+static uint32_t SDRAM_NsToCycles(uint32_t Ns, uint32_t SdramFreq)
+{
+  uint32_t cycles = (uint32_t)((((uint64_t)Ns * SdramFreq) + 999999999U) / 1000000000U);
+
+  return (cycles == 0U) ? 1U : cycles;
+}
+
 /**
   * @}
   */
@@ -52,6 +52,29 @@
       (#) The CRC feature is not managed when the DMA circular mode is enabled
       (#) When the SPI DMA Pause/Stop features are used, we must use the following APIs
           the HAL_SPI_DMAPause()/ HAL_SPI_DMAStop() only under the SPI callbacks
+     [..]
+       Double buffer reception:
+      (#) HAL_SPI_ReceiveDoubleBuffer_DMA() starts a continuous reception alternating
+          between two memory buffers (DMA double buffer mode). The end of reception in
+          each buffer is signalled by HAL_SPI_RxM0CpltCallback() and HAL_SPI_RxM1CpltCallback();
+          the buffer not currently targeted by the DMA can be processed, or replaced using
+          HAL_DMAEx_ChangeMemory(), from these callbacks.
+      (#) The reception runs until HAL_SPI_DMAStop() is called.
+      (#) Double buffer reception is not available in Master 2Lines full-duplex mode and
+          the CRC feature is not managed in this mode.
+     [..]
+       Queued transactions:
+      (#) HAL_SPI_QueueTransaction_DMA() appends a full-duplex DMA transaction to a queue
+          served back-to-back. Each SPI_TransactionTypeDef carries its device settings
+          (clock polarity and phase, baud rate prescaler, data size), its chip select line,
+          its Tx/Rx buffers and a completion callback. From the DMA complete interrupt the
+          driver releases the chip select, applies the next device settings, selects the
+          next device and starts its transfer before reporting the finished transaction.
+      (#) Queued transactions are available in Master 2Lines full-duplex mode only, with the
+          Tx and Rx DMA streams in normal mode.
+      (#) On a transfer error the pending transactions are completed with the error state
+          and HAL_SPI_ErrorCallback() is called. HAL_SPI_Abort() and HAL_SPI_DMAStop() complete
+          the pending transactions with the aborted state.
      [..]
        Master Receive mode restriction:
       (#) In Master unidirectional receive-only mode (MSTR =1, BIDIMODE=0, RXONLY=0) or
@@ -59,6 +82,14 @@
           does not initiate a new transfer the following procedure has to be respected:
           (##) HAL_SPI_DeInit()
           (##) HAL_SPI_Init()
+     [..]
+       Interrupt handler selection:
+      (#) HAL_SPI_Transmit_IT() and HAL_SPI_Receive_IT() (except in Master 2Lines mode)
+          install a lean interrupt entry in the handle, which HAL_SPI_IRQHandler() forwards
+          to. It only serves the data register event of the running direction and falls
+          back to the generic handler for errors and any other event. This is transparent
+          to the application: HAL_SPI_IRQHandler() remains the function to call from the
+          SPI interrupt.
 
   @endverbatim
 
@@ -186,10 +217,16 @@ static void SPI_DMATransmitReceiveCplt(DMA_HandleTypeDef *hdma);
 static void SPI_DMAHalfTransmitCplt(DMA_HandleTypeDef *hdma);
 static void SPI_DMAHalfReceiveCplt(DMA_HandleTypeDef *hdma);
 static void SPI_DMAHalfTransmitReceiveCplt(DMA_HandleTypeDef *hdma);
+static void SPI_DMAReceiveM0Cplt(DMA_HandleTypeDef *hdma);
+static void SPI_DMAReceiveM1Cplt(DMA_HandleTypeDef *hdma);
 static void SPI_DMAError(DMA_HandleTypeDef *hdma);
 static void SPI_DMAAbortOnError(DMA_HandleTypeDef *hdma);
 static void SPI_DMATxAbortCallback(DMA_HandleTypeDef *hdma);
 static void SPI_DMARxAbortCallback(DMA_HandleTypeDef *hdma);
+static HAL_StatusTypeDef SPI_TransactionStart(SPI_HandleTypeDef *hspi, SPI_TransactionTypeDef *pTrans);
+static void SPI_TransactionCplt(SPI_HandleTypeDef *hspi);
+static void SPI_DMATransactionTxCplt(DMA_HandleTypeDef *hdma);
+static void SPI_TransactionFlush(SPI_HandleTypeDef *hspi, uint32_t State);
 static HAL_StatusTypeDef SPI_WaitFlagStateUntilTimeout(SPI_HandleTypeDef *hspi, uint32_t Flag, uint32_t State, uint32_t Timeout, uint32_t Tickstart);
 static void SPI_TxISR_8BIT(struct __SPI_HandleTypeDef *hspi);
 static void SPI_TxISR_16BIT(struct __SPI_HandleTypeDef *hspi);
@@ -205,6 +242,9 @@ static void SPI_RxISR_16BITCRC(struct __SPI_HandleTypeDef *hspi);
 static void SPI_2linesRxISR_8BITCRC(struct __SPI_HandleTypeDef *hspi);
 static void SPI_2linesRxISR_16BITCRC(struct __SPI_HandleTypeDef *hspi);
 #endif /* USE_SPI_CRC */
+static void SPI_DefaultIRQHandler(SPI_HandleTypeDef *hspi);
+static void SPI_TxOnly_IRQHandler(SPI_HandleTypeDef *hspi);
+static void SPI_RxOnly_IRQHandler(SPI_HandleTypeDef *hspi);
 static void SPI_AbortRx_ISR(SPI_HandleTypeDef *hspi);
 static void SPI_AbortTx_ISR(SPI_HandleTypeDef *hspi);
 static void SPI_CloseRxTx_ISR(SPI_HandleTypeDef *hspi);
@@ -331,6 +371,9 @@ HAL_StatusTypeDef HAL_SPI_Init(SPI_HandleTypeDef *hspi)
 #endif /* USE_SPI_CRC */
 
   hspi->ErrorCode = HAL_SPI_ERROR_NONE;
+  hspi->pTransHead = NULL;
+  hspi->pTransTail = NULL;
+  hspi->IRQHandler = NULL;
   hspi->State     = HAL_SPI_STATE_READY;
 
   return HAL_OK;
@@ -362,6 +405,9 @@ HAL_StatusTypeDef HAL_SPI_DeInit(SPI_HandleTypeDef *hspi)
   HAL_SPI_MspDeInit(hspi);
 
   hspi->ErrorCode = HAL_SPI_ERROR_NONE;
+  hspi->pTransHead = NULL;
+  hspi->pTransTail = NULL;
+  hspi->IRQHandler = NULL;
   hspi->State = HAL_SPI_STATE_RESET;
 
   /* Release Lock */
@@ -1080,6 +1126,7 @@ HAL_StatusTypeDef HAL_SPI_Transmit_IT(SPI_HandleTypeDef *hspi, uint8_t *pData, u
   {
     hspi->TxISR = SPI_TxISR_8BIT;
   }
+  hspi->IRQHandler = SPI_TxOnly_IRQHandler;
 
   /* Configure communication direction : 1Line */
   if(hspi->Init.Direction == SPI_DIRECTION_1LINE)
@@ -1174,6 +1221,7 @@ HAL_StatusTypeDef HAL_SPI_Receive_IT(SPI_HandleTypeDef *hspi, uint8_t *pData, ui
   {
     hspi->RxISR = SPI_RxISR_8BIT;
   }
+  hspi->IRQHandler = SPI_RxOnly_IRQHandler;
 
   /* Configure communication direction : 1Line */
   if(hspi->Init.Direction == SPI_DIRECTION_1LINE)
@@ -1260,6 +1308,9 @@ HAL_StatusTypeDef HAL_SPI_TransmitReceive_IT(SPI_HandleTypeDef *hspi, uint8_t *p
   hspi->RxXferSize  = Size;
   hspi->RxXferCount = Size;
 
+  /* Both directions are served by the generic interrupt handler */
+  hspi->IRQHandler  = NULL;
+
   /* Set the function for IT treatment */
   if(hspi->Init.DataSize > SPI_DATASIZE_8BIT )
   {
@@ -1484,6 +1535,114 @@ error:
   return errorcode;
 }
 
+/**
+  * @brief  Receive data continuously in non-blocking mode with DMA double buffer mode.
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *               the configuration information for SPI module.
+  * @param  pData0: pointer to the first data buffer (DMA memory 0)
+  * @param  pData1: pointer to the second data buffer (DMA memory 1)
+  * @param  Size: amount of data to be received in each buffer
+  * @note   The reception alternates between the two buffers until HAL_SPI_DMAStop()
+  *         is called. HAL_SPI_RxM0CpltCallback() and HAL_SPI_RxM1CpltCallback() are
+  *         executed each time the corresponding buffer has been filled.
+  * @note   This mode is not available in Master 2Lines full-duplex mode and does not
+  *         manage the CRC feature.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SPI_ReceiveDoubleBuffer_DMA(SPI_HandleTypeDef *hspi, uint8_t *pData0, uint8_t *pData1, uint16_t Size)
+{
+  HAL_StatusTypeDef errorcode = HAL_OK;
+
+  if((hspi->Init.Direction == SPI_DIRECTION_2LINES)&&(hspi->Init.Mode == SPI_MODE_MASTER))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Process Locked */
+  __HAL_LOCK(hspi);
+
+  if(hspi->State != HAL_SPI_STATE_READY)
+  {
+    errorcode = HAL_BUSY;
+    goto error;
+  }
+
+  if((pData0 == NULL) || (pData1 == NULL) || (Size == 0))
+  {
+    errorcode = HAL_ERROR;
+    goto error;
+  }
+
+#if (USE_SPI_CRC != 0U)
+  /* CRC is not managed in double buffer mode */
+  if(hspi->Init.CRCCalculation == SPI_CRCCALCULATION_ENABLE)
+  {
+    errorcode = HAL_ERROR;
+    goto error;
+  }
+#endif /* USE_SPI_CRC */
+
+  /* Set the transaction information */
+  hspi->State       = HAL_SPI_STATE_BUSY_RX;
+  hspi->ErrorCode   = HAL_SPI_ERROR_NONE;
+  hspi->pRxBuffPtr  = (uint8_t *)pData0;
+  hspi->RxXferSize  = Size;
+  hspi->RxXferCount = Size;
+
+  /*Init field not used in handle to zero */
+  hspi->RxISR       = NULL;
+  hspi->TxISR       = NULL;
+  hspi->TxXferSize  = 0U;
+  hspi->TxXferCount = 0U;
+
+  /* Configure communication direction : 1Line */
+  if(hspi->Init.Direction == SPI_DIRECTION_1LINE)
+  {
+    SPI_1LINE_RX(hspi);
+  }
+
+  /* Half transfer callbacks are not used in double buffer mode */
+  hspi->hdmarx->XferHalfCpltCallback = NULL;
+  hspi->hdmarx->XferM1HalfCpltCallback = NULL;
+
+  /* Set the SPI Rx DMA memory 0 and memory 1 transfer complete callbacks */
+  hspi->hdmarx->XferCpltCallback = SPI_DMAReceiveM0Cplt;
+  hspi->hdmarx->XferM1CpltCallback = SPI_DMAReceiveM1Cplt;
+
+  /* Set the DMA error callback */
+  hspi->hdmarx->XferErrorCallback = SPI_DMAError;
+
+  /* Set the DMA AbortCpltCallback */
+  hspi->hdmarx->XferAbortCallback = NULL;
+
+  /* Enable the Rx DMA Stream in double buffer mode */
+  if(HAL_DMAEx_MultiBufferStart_IT(hspi->hdmarx, (uint32_t)&hspi->Instance->DR, (uint32_t)pData0, (uint32_t)pData1, Size) != HAL_OK)
+  {
+    SET_BIT(hspi->ErrorCode, HAL_SPI_ERROR_DMA);
+    hspi->State = HAL_SPI_STATE_READY;
+    errorcode = HAL_ERROR;
+    goto error;
+  }
+
+  /* Check if the SPI is already enabled */
+  if((hspi->Instance->CR1 &SPI_CR1_SPE) != SPI_CR1_SPE)
+  {
+    /* Enable SPI peripheral */
+    __HAL_SPI_ENABLE(hspi);
+  }
+
+  /* Enable the SPI Error Interrupt Bit */
+  SET_BIT(hspi->Instance->CR2, SPI_CR2_ERRIE);
+
+  /* Enable Rx DMA Request */
+  SET_BIT(hspi->Instance->CR2, SPI_CR2_RXDMAEN);
+
+error:
+  /* Process Unlocked */
+  __HAL_UNLOCK(hspi);
+  return errorcode;
+}
+
 /**
   * @brief  Transmit and Receive an amount of data in non-blocking mode with DMA.
   * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
@@ -1601,6 +1760,81 @@ error :
   return errorcode;
 }
 
+/**
+  * @brief  Queue a full-duplex transaction in non-blocking mode with DMA.
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *               the configuration information for SPI module.
+  * @param  pTrans: pointer to the transaction, with device settings, chip select
+  *                 line, buffers, size and completion callback already set.
+  * @note   The transaction is started at once when the bus is idle, otherwise it is
+  *         started from the DMA complete interrupt of the previous one. Its chip select
+  *         line is driven low for the whole transfer.
+  * @note   This function may be called from thread mode, from a transaction callback or
+  *         from an interrupt whose priority is not higher than the SPI DMA interrupts.
+  * @note   The DMA streams data widths are updated according to pTrans->DataSize.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SPI_QueueTransaction_DMA(SPI_HandleTypeDef *hspi, SPI_TransactionTypeDef *pTrans)
+{
+  uint32_t primask;
+  uint32_t idle;
+
+  if((pTrans == NULL) || (pTrans->pTxData == NULL) || (pTrans->pRxData == NULL) || (pTrans->Size == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  assert_param(IS_SPI_CPOL(pTrans->CLKPolarity));
+  assert_param(IS_SPI_CPHA(pTrans->CLKPhase));
+  assert_param(IS_SPI_BAUDRATE_PRESCALER(pTrans->BaudRatePrescaler));
+  assert_param(IS_SPI_DATASIZE(pTrans->DataSize));
+
+  /* Queued transactions are full-duplex master transfers in DMA normal mode */
+  if((hspi->Init.Mode != SPI_MODE_MASTER) || (hspi->Init.Direction != SPI_DIRECTION_2LINES) ||
+     (hspi->hdmatx == NULL) || (hspi->hdmarx == NULL) ||
+     (hspi->hdmatx->Init.Mode == DMA_CIRCULAR) || (hspi->hdmarx->Init.Mode == DMA_CIRCULAR) ||
+     (pTrans->State == HAL_SPI_TRANSACTION_STATE_PENDING))
+  {
+    return HAL_ERROR;
+  }
+
+  pTrans->pNext     = NULL;
+  pTrans->ErrorCode = HAL_SPI_ERROR_NONE;
+
+  /* The queue is also updated from the SPI DMA interrupts */
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  idle = (hspi->pTransHead == NULL) ? 1U : 0U;
+  if(idle != 0U)
+  {
+    if(hspi->State != HAL_SPI_STATE_READY)
+    {
+      __set_PRIMASK(primask);
+      return HAL_BUSY;
+    }
+    /* Take the bus on behalf of the queue */
+    hspi->State = HAL_SPI_STATE_BUSY_TX_RX;
+    hspi->pTransHead = pTrans;
+  }
+  else
+  {
+    hspi->pTransTail->pNext = pTrans;
+  }
+  hspi->pTransTail = pTrans;
+  pTrans->State = HAL_SPI_TRANSACTION_STATE_PENDING;
+
+  __set_PRIMASK(primask);
+
+  if(idle != 0U)
+  {
+    /* On error the transaction has already been reported by its callback */
+    return SPI_TransactionStart(hspi, pTrans);
+  }
+
+  return HAL_OK;
+}
+
 /**
   * @brief  Abort ongoing transfer (blocking mode).
   * @param  hspi SPI handle.
@@ -1693,6 +1927,9 @@ HAL_StatusTypeDef HAL_SPI_Abort(SPI_HandleTypeDef *hspi)
   /* Restore hspi->state to ready */
   hspi->State = HAL_SPI_STATE_READY;
 
+  /* Report the queued transactions as aborted */
+  SPI_TransactionFlush(hspi, HAL_SPI_TRANSACTION_STATE_ABORTED);
+
   return HAL_OK;
 }
 
@@ -1921,25 +2158,51 @@ HAL_StatusTypeDef HAL_SPI_DMAStop(SPI_HandleTypeDef *hspi)
   /* Disable the SPI DMA Tx & Rx requests */
   CLEAR_BIT(hspi->Instance->CR2, SPI_CR2_TXDMAEN | SPI_CR2_RXDMAEN);
   hspi->State = HAL_SPI_STATE_READY;
+
+  /* Report the queued transactions as aborted */
+  SPI_TransactionFlush(hspi, HAL_SPI_TRANSACTION_STATE_ABORTED);
   return HAL_OK;
 }
 
 /**
   * @brief  Handle SPI interrupt request.
+  * @note   When the running transfer installed a lean interrupt entry, the request
+  *         is forwarded to it, otherwise the generic handler is executed.
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *               the configuration information for the specified SPI module.
+  * @retval None
+  */
+__HOT_RAM_FUNC void HAL_SPI_IRQHandler(SPI_HandleTypeDef *hspi)
+{
+  if(hspi->IRQHandler != NULL)
+  {
+    hspi->IRQHandler(hspi);
+  }
+  else
+  {
+    SPI_DefaultIRQHandler(hspi);
+  }
+}
+
+/**
+  * @brief  Generic SPI interrupt handler serving every transfer mode and error.
   * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
   *               the configuration information for the specified SPI module.
   * @retval None
   */
-void HAL_SPI_IRQHandler(SPI_HandleTypeDef *hspi)
+static __HOT_RAM_FUNC void SPI_DefaultIRQHandler(SPI_HandleTypeDef *hspi)
 {
   uint32_t itsource = hspi->Instance->CR2;
   uint32_t itflag   = hspi->Instance->SR;
 
+  __HAL_PROF_ENTER(HAL_PROF_ID_SPI_IRQ);
+
   /* SPI in mode Receiver ----------------------------------------------------*/
   if(((itflag & SPI_FLAG_OVR) == RESET) &&
      ((itflag & SPI_FLAG_RXNE) != RESET) && ((itsource & SPI_IT_RXNE) != RESET))
   {
     hspi->RxISR(hspi);
+    __HAL_PROF_EXIT(HAL_PROF_ID_SPI_IRQ);
     return;
   }
 
@@ -1947,6 +2210,7 @@ void HAL_SPI_IRQHandler(SPI_HandleTypeDef *hspi)
   if(((itflag & SPI_FLAG_TXE) != RESET) && ((itsource & SPI_IT_TXE) != RESET))
   {
     hspi->TxISR(hspi);
+    __HAL_PROF_EXIT(HAL_PROF_ID_SPI_IRQ);
     return;
   }
 
@@ -1964,6 +2228,7 @@ void HAL_SPI_IRQHandler(SPI_HandleTypeDef *hspi)
       else
       {
         __HAL_SPI_CLEAR_OVRFLAG(hspi);
+        __HAL_PROF_EXIT(HAL_PROF_ID_SPI_IRQ);
         return;
       }
     }
@@ -2016,8 +2281,11 @@ void HAL_SPI_IRQHandler(SPI_HandleTypeDef *hspi)
         HAL_SPI_ErrorCallback(hspi);
       }
     }
+    __HAL_PROF_EXIT(HAL_PROF_ID_SPI_IRQ);
     return;
   }
+
+  __HAL_PROF_EXIT(HAL_PROF_ID_SPI_IRQ);
 }
 
 /**
@@ -2095,6 +2363,36 @@ __weak void HAL_SPI_RxHalfCpltCallback(SPI_HandleTypeDef *hspi)
   */
 }
 
+/**
+  * @brief Rx memory 0 buffer completed callback (double buffer reception).
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *               the configuration information for SPI module.
+  * @retval None
+  */
+__weak void HAL_SPI_RxM0CpltCallback(SPI_HandleTypeDef *hspi)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hspi);
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_SPI_RxM0CpltCallback() should be implemented in the user file
+  */
+}
+
+/**
+  * @brief Rx memory 1 buffer completed callback (double buffer reception).
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *               the configuration information for SPI module.
+  * @retval None
+  */
+__weak void HAL_SPI_RxM1CpltCallback(SPI_HandleTypeDef *hspi)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hspi);
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_SPI_RxM1CpltCallback() should be implemented in the user file
+  */
+}
+
 /**
   * @brief Tx and Rx Half Transfer callback.
   * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
@@ -2367,9 +2665,18 @@ static void SPI_DMATransmitReceiveCplt(DMA_HandleTypeDef *hdma)
 
     if(hspi->ErrorCode != HAL_SPI_ERROR_NONE)
     {
+      /* Report the queued transactions in error */
+      SPI_TransactionFlush(hspi, HAL_SPI_TRANSACTION_STATE_ERROR);
       HAL_SPI_ErrorCallback(hspi);
       return;
     }
+
+    if(hspi->pTransHead != NULL)
+    {
+      /* Chain the next queued transaction */
+      SPI_TransactionCplt(hspi);
+      return;
+    }
   }
   HAL_SPI_TxRxCpltCallback(hspi);
 }
@@ -2413,6 +2720,32 @@ static void SPI_DMAHalfTransmitReceiveCplt(DMA_HandleTypeDef *hdma)
   HAL_SPI_TxRxHalfCpltCallback(hspi);
 }
 
+/**
+  * @brief  DMA SPI memory 0 receive complete callback (double buffer mode).
+  * @param  hdma: pointer to a DMA_HandleTypeDef structure that contains
+  *               the configuration information for the specified DMA module.
+  * @retval None
+  */
+static void SPI_DMAReceiveM0Cplt(DMA_HandleTypeDef *hdma)
+{
+  SPI_HandleTypeDef* hspi = ( SPI_HandleTypeDef* )((DMA_HandleTypeDef* )hdma)->Parent;
+
+  HAL_SPI_RxM0CpltCallback(hspi);
+}
+
+/**
+  * @brief  DMA SPI memory 1 receive complete callback (double buffer mode).
+  * @param  hdma: pointer to a DMA_HandleTypeDef structure that contains
+  *               the configuration information for the specified DMA module.
+  * @retval None
+  */
+static void SPI_DMAReceiveM1Cplt(DMA_HandleTypeDef *hdma)
+{
+  SPI_HandleTypeDef* hspi = ( SPI_HandleTypeDef* )((DMA_HandleTypeDef* )hdma)->Parent;
+
+  HAL_SPI_RxM1CpltCallback(hspi);
+}
+
 /**
   * @brief  DMA SPI communication error callback.
   * @param  hdma: pointer to a DMA_HandleTypeDef structure that contains
@@ -2428,6 +2761,9 @@ static void SPI_DMAError(DMA_HandleTypeDef *hdma)
 
   SET_BIT(hspi->ErrorCode, HAL_SPI_ERROR_DMA);
   hspi->State = HAL_SPI_STATE_READY;
+
+  /* Report the queued transactions in error */
+  SPI_TransactionFlush(hspi, HAL_SPI_TRANSACTION_STATE_ERROR);
   HAL_SPI_ErrorCallback(hspi);
 }
 
@@ -2443,6 +2779,8 @@ static void SPI_DMAAbortOnError(DMA_HandleTypeDef *hdma)
   hspi->RxXferCount = 0U;
   hspi->TxXferCount = 0U;
 
+  /* Report the queued transactions in error */
+  SPI_TransactionFlush(hspi, HAL_SPI_TRANSACTION_STATE_ERROR);
   HAL_SPI_ErrorCallback(hspi);
 }
 
@@ -2548,13 +2886,249 @@ static void SPI_DMARxAbortCallback(DMA_HandleTypeDef *hdma)
   HAL_SPI_AbortCpltCallback(hspi);
 }
 
+/**
+  * @brief  Apply the device settings of a queued transaction and start its transfer.
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *               the configuration information for SPI module.
+  * @note   If a DMA stream cannot be started, the queue is flushed with HAL_SPI_ERROR_DMA
+  *         and HAL_SPI_ErrorCallback() is called.
+  * @param  pTrans: pointer to the transaction at the head of the queue.
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef SPI_TransactionStart(SPI_HandleTypeDef *hspi, SPI_TransactionTypeDef *pTrans)
+{
+  HAL_StatusTypeDef errorcode;
+  uint32_t dmasize;
+
+  /* The device settings can only be changed with the SPI disabled */
+  __HAL_SPI_DISABLE(hspi);
+  MODIFY_REG(hspi->Instance->CR1, (SPI_CR1_CPOL | SPI_CR1_CPHA | SPI_CR1_BR | SPI_CR1_DFF),
+             (pTrans->CLKPolarity | pTrans->CLKPhase | pTrans->BaudRatePrescaler | pTrans->DataSize));
+  hspi->Init.CLKPolarity       = pTrans->CLKPolarity;
+  hspi->Init.CLKPhase          = pTrans->CLKPhase;
+  hspi->Init.BaudRatePrescaler = pTrans->BaudRatePrescaler;
+  hspi->Init.DataSize          = pTrans->DataSize;
+
+  /* Match the DMA streams data widths with the device data size */
+  dmasize = (pTrans->DataSize == SPI_DATASIZE_16BIT) ? (DMA_SxCR_PSIZE_0 | DMA_SxCR_MSIZE_0) : 0U;
+  MODIFY_REG(hspi->hdmatx->Instance->CR, (DMA_SxCR_PSIZE | DMA_SxCR_MSIZE), dmasize);
+  MODIFY_REG(hspi->hdmarx->Instance->CR, (DMA_SxCR_PSIZE | DMA_SxCR_MSIZE), dmasize);
+  hspi->hdmatx->Init.PeriphDataAlignment = dmasize & DMA_SxCR_PSIZE;
+  hspi->hdmatx->Init.MemDataAlignment    = dmasize & DMA_SxCR_MSIZE;
+  hspi->hdmarx->Init.PeriphDataAlignment = dmasize & DMA_SxCR_PSIZE;
+  hspi->hdmarx->Init.MemDataAlignment    = dmasize & DMA_SxCR_MSIZE;
+
+  /* Select the device */
+  if(pTrans->CSPort != NULL)
+  {
+    pTrans->CSPort->BSRR = (uint32_t)pTrans->CSPin << 16U;
+  }
+
+  /* Set the transaction information */
+  hspi->State       = HAL_SPI_STATE_BUSY_TX_RX;
+  hspi->ErrorCode   = HAL_SPI_ERROR_NONE;
+  hspi->pTxBuffPtr  = pTrans->pTxData;
+  hspi->TxXferSize  = pTrans->Size;
+  hspi->TxXferCount = pTrans->Size;
+  hspi->pRxBuffPtr  = pTrans->pRxData;
+  hspi->RxXferSize  = pTrans->Size;
+  hspi->RxXferCount = pTrans->Size;
+  hspi->RxISR       = NULL;
+  hspi->TxISR       = NULL;
+
+#if (USE_SPI_CRC != 0U)
+  /* Reset CRC Calculation */
+  if(hspi->Init.CRCCalculation == SPI_CRCCALCULATION_ENABLE)
+  {
+    SPI_RESET_CRC(hspi);
+  }
+#endif /* USE_SPI_CRC */
+
+  /* The communication closing and the chaining are performed in the DMA reception complete callback */
+  hspi->hdmarx->XferHalfCpltCallback = NULL;
+  hspi->hdmarx->XferCpltCallback     = SPI_DMATransmitReceiveCplt;
+  hspi->hdmarx->XferErrorCallback    = SPI_DMAError;
+  hspi->hdmarx->XferAbortCallback    = NULL;
+
+  hspi->hdmatx->XferHalfCpltCallback = NULL;
+  hspi->hdmatx->XferCpltCallback     = NULL;
+  hspi->hdmatx->XferErrorCallback    = NULL;
+  hspi->hdmatx->XferAbortCallback    = NULL;
+
+  /* Enable the Rx DMA Stream and Rx DMA Request */
+  errorcode = HAL_DMA_Start_IT(hspi->hdmarx, (uint32_t)&hspi->Instance->DR, (uint32_t)hspi->pRxBuffPtr,
+                               hspi->RxXferCount);
+  if(errorcode == HAL_OK)
+  {
+    SET_BIT(hspi->Instance->CR2, SPI_CR2_RXDMAEN);
+
+    /* Enable the Tx DMA Stream */
+    errorcode = HAL_DMA_Start_IT(hspi->hdmatx, (uint32_t)hspi->pTxBuffPtr, (uint32_t)&hspi->Instance->DR,
+                                 hspi->TxXferCount);
+    if(errorcode != HAL_OK)
+    {
+      /* Stop the Rx DMA Stream already started */
+      CLEAR_BIT(hspi->Instance->CR2, SPI_CR2_RXDMAEN);
+      (void)HAL_DMA_Abort(hspi->hdmarx);
+    }
+  }
+
+  if(errorcode != HAL_OK)
+  {
+    SET_BIT(hspi->ErrorCode, HAL_SPI_ERROR_DMA);
+    hspi->State = HAL_SPI_STATE_READY;
+
+    /* Report the queued transactions in error */
+    SPI_TransactionFlush(hspi, HAL_SPI_TRANSACTION_STATE_ERROR);
+    HAL_SPI_ErrorCallback(hspi);
+    return HAL_ERROR;
+  }
+
+  /* Enable SPI peripheral and the SPI Error Interrupt Bit */
+  __HAL_SPI_ENABLE(hspi);
+  SET_BIT(hspi->Instance->CR2, SPI_CR2_ERRIE);
+
+  /* Enable Tx DMA Request */
+  SET_BIT(hspi->Instance->CR2, SPI_CR2_TXDMAEN);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Complete the queued transaction at the head of the queue and start the next one.
+  * @note   The next transaction is started before the completion callback is called so
+  *         that the bus stays busy while the finished transaction is processed.
+  * @note   The Tx DMA interrupt of the finished transaction may not be served yet: the
+  *         next transaction is then started from the Tx DMA transfer complete callback.
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *               the configuration information for SPI module.
+  * @retval None
+  */
+static void SPI_TransactionCplt(SPI_HandleTypeDef *hspi)
+{
+  SPI_TransactionTypeDef *pTrans = hspi->pTransHead;
+  SPI_TransactionTypeDef *pNext;
+  uint32_t primask;
+  uint32_t txbusy = 0U;
+
+  /* Deselect the device */
+  if(pTrans->CSPort != NULL)
+  {
+    pTrans->CSPort->BSRR = (uint32_t)pTrans->CSPin;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  pNext = pTrans->pNext;
+  hspi->pTransHead = pNext;
+  if(pNext == NULL)
+  {
+    hspi->pTransTail = NULL;
+  }
+  else
+  {
+    /* Keep the bus owned by the queue */
+    hspi->State = HAL_SPI_STATE_BUSY_TX_RX;
+
+    /* The Tx DMA interrupt cannot be served between this check and the callback setting */
+    if(hspi->hdmatx->State != HAL_DMA_STATE_READY)
+    {
+      hspi->hdmatx->XferCpltCallback = SPI_DMATransactionTxCplt;
+      txbusy = 1U;
+    }
+  }
+
+  __set_PRIMASK(primask);
+
+  if((pNext != NULL) && (txbusy == 0U))
+  {
+    (void)SPI_TransactionStart(hspi, pNext);
+  }
+
+  pTrans->pNext     = NULL;
+  pTrans->ErrorCode = HAL_SPI_ERROR_NONE;
+  pTrans->State     = HAL_SPI_TRANSACTION_STATE_DONE;
+
+  if(pTrans->XferCpltCallback != NULL)
+  {
+    pTrans->XferCpltCallback(pTrans);
+  }
+}
+
+/**
+  * @brief  DMA SPI transmit complete callback used to start a queued transaction
+  *         once the Tx DMA stream of the previous one is released.
+  * @param  hdma: pointer to a DMA_HandleTypeDef structure that contains
+  *               the configuration information for the specified DMA module.
+  * @retval None
+  */
+static void SPI_DMATransactionTxCplt(DMA_HandleTypeDef *hdma)
+{
+  SPI_HandleTypeDef* hspi = ( SPI_HandleTypeDef* )((DMA_HandleTypeDef* )hdma)->Parent;
+
+  hdma->XferCpltCallback = NULL;
+
+  /* The queue may have been aborted in the meantime */
+  if(hspi->pTransHead != NULL)
+  {
+    (void)SPI_TransactionStart(hspi, hspi->pTransHead);
+  }
+}
+
+/**
+  * @brief  Remove all the queued transactions and report them with the given state.
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *               the configuration information for SPI module.
+  * @param  State: final transactions state, HAL_SPI_TRANSACTION_STATE_ERROR or
+  *                HAL_SPI_TRANSACTION_STATE_ABORTED
+  * @retval None
+  */
+static void SPI_TransactionFlush(SPI_HandleTypeDef *hspi, uint32_t State)
+{
+  SPI_TransactionTypeDef *pTrans;
+  SPI_TransactionTypeDef *pNext;
+  uint32_t primask;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  pTrans = hspi->pTransHead;
+  hspi->pTransHead = NULL;
+  hspi->pTransTail = NULL;
+
+  __set_PRIMASK(primask);
+
+  /* Only the transaction at the head of the queue has its device selected */
+  if((pTrans != NULL) && (pTrans->CSPort != NULL))
+  {
+    pTrans->CSPort->BSRR = (uint32_t)pTrans->CSPin;
+  }
+
+  while(pTrans != NULL)
+  {
+    pNext = pTrans->pNext;
+
+    pTrans->pNext     = NULL;
+    pTrans->ErrorCode = hspi->ErrorCode;
+    pTrans->State     = State;
+
+    if(pTrans->XferCpltCallback != NULL)
+    {
+      pTrans->XferCpltCallback(pTrans);
+    }
+
+    pTrans = pNext;
+  }
+}
+
 /**
   * @brief  Rx 8-bit handler for Transmit and Receive in Interrupt mode.
   * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
   *               the configuration information for SPI module.
   * @retval None
   */
-static void SPI_2linesRxISR_8BIT(struct __SPI_HandleTypeDef *hspi)
+static __HOT_RAM_FUNC void SPI_2linesRxISR_8BIT(struct __SPI_HandleTypeDef *hspi)
 {
   /* Receive data in 8bit mode */
   *hspi->pRxBuffPtr++ = *((__IO uint8_t *)&hspi->Instance->DR);
@@ -2588,7 +3162,7 @@ static void SPI_2linesRxISR_8BIT(struct __SPI_HandleTypeDef *hspi)
   *               the configuration information for SPI module.
   * @retval None
   */
-static void SPI_2linesRxISR_8BITCRC(struct __SPI_HandleTypeDef *hspi)
+static __HOT_RAM_FUNC void SPI_2linesRxISR_8BITCRC(struct __SPI_HandleTypeDef *hspi)
 {
   __IO uint8_t tmpreg = 0U;
 
@@ -2615,7 +3189,7 @@ static void SPI_2linesRxISR_8BITCRC(struct __SPI_HandleTypeDef *hspi)
   *               the configuration information for SPI module.
   * @retval None
   */
-static void SPI_2linesTxISR_8BIT(struct __SPI_HandleTypeDef *hspi)
+static __HOT_RAM_FUNC void SPI_2linesTxISR_8BIT(struct __SPI_HandleTypeDef *hspi)
 {
   *(__IO uint8_t *)&hspi->Instance->DR = (*hspi->pTxBuffPtr++);
   hspi->TxXferCount--;
@@ -2648,7 +3222,7 @@ static void SPI_2linesTxISR_8BIT(struct __SPI_HandleTypeDef *hspi)
   *               the configuration information for SPI module.
   * @retval None
   */
-static void SPI_2linesRxISR_16BIT(struct __SPI_HandleTypeDef *hspi)
+static __HOT_RAM_FUNC void SPI_2linesRxISR_16BIT(struct __SPI_HandleTypeDef *hspi)
 {
   /* Receive data in 16 Bit mode */
   *((uint16_t*)hspi->pRxBuffPtr) = hspi->Instance->DR;
@@ -2682,7 +3256,7 @@ static void SPI_2linesRxISR_16BIT(struct __SPI_HandleTypeDef *hspi)
   *               the configuration information for SPI module.
   * @retval None
   */
-static void SPI_2linesRxISR_16BITCRC(struct __SPI_HandleTypeDef *hspi)
+static __HOT_RAM_FUNC void SPI_2linesRxISR_16BITCRC(struct __SPI_HandleTypeDef *hspi)
 {
   /* Receive data in 16 Bit mode */
   __IO uint16_t tmpreg = 0U;
@@ -2706,7 +3280,7 @@ static void SPI_2linesRxISR_16BITCRC(struct __SPI_HandleTypeDef *hspi)
   *               the configuration information for SPI module.
   * @retval None
   */
-static void SPI_2linesTxISR_16BIT(struct __SPI_HandleTypeDef *hspi)
+static __HOT_RAM_FUNC void SPI_2linesTxISR_16BIT(struct __SPI_HandleTypeDef *hspi)
 {
   /* Transmit data in 16 Bit mode */
   hspi->Instance->DR = *((uint16_t *)hspi->pTxBuffPtr);
@@ -2742,7 +3316,7 @@ static void SPI_2linesTxISR_16BIT(struct __SPI_HandleTypeDef *hspi)
   *               the configuration information for SPI module.
   * @retval None
   */
-static void SPI_RxISR_8BITCRC(struct __SPI_HandleTypeDef *hspi)
+static __HOT_RAM_FUNC void SPI_RxISR_8BITCRC(struct __SPI_HandleTypeDef *hspi)
 {
   __IO uint8_t tmpreg = 0U;
 
@@ -2762,7 +3336,7 @@ static void SPI_RxISR_8BITCRC(struct __SPI_HandleTypeDef *hspi)
   *               the configuration information for SPI module.
   * @retval None
   */
-static void SPI_RxISR_8BIT(struct __SPI_HandleTypeDef *hspi)
+static __HOT_RAM_FUNC void SPI_RxISR_8BIT(struct __SPI_HandleTypeDef *hspi)
 {
   *hspi->pRxBuffPtr++ = (*(__IO uint8_t *)&hspi->Instance->DR);
   hspi->RxXferCount--;
@@ -2795,7 +3369,7 @@ static void SPI_RxISR_8BIT(struct __SPI_HandleTypeDef *hspi)
   *               the configuration information for SPI module.
   * @retval None
   */
-static void SPI_RxISR_16BITCRC(struct __SPI_HandleTypeDef *hspi)
+static __HOT_RAM_FUNC void SPI_RxISR_16BITCRC(struct __SPI_HandleTypeDef *hspi)
 {
   __IO uint16_t tmpreg = 0U;
 
@@ -2818,7 +3392,7 @@ static void SPI_RxISR_16BITCRC(struct __SPI_HandleTypeDef *hspi)
   *               the configuration information for SPI module.
   * @retval None
   */
-static void SPI_RxISR_16BIT(struct __SPI_HandleTypeDef *hspi)
+static __HOT_RAM_FUNC void SPI_RxISR_16BIT(struct __SPI_HandleTypeDef *hspi)
 {
   *((uint16_t *)hspi->pRxBuffPtr) = hspi->Instance->DR;
   hspi->pRxBuffPtr += sizeof(uint16_t);
@@ -2851,7 +3425,7 @@ static void SPI_RxISR_16BIT(struct __SPI_HandleTypeDef *hspi)
   *               the configuration information for SPI module.
   * @retval None
   */
-static void SPI_TxISR_8BIT(struct __SPI_HandleTypeDef *hspi)
+static __HOT_RAM_FUNC void SPI_TxISR_8BIT(struct __SPI_HandleTypeDef *hspi)
 {
   *(__IO uint8_t *)&hspi->Instance->DR = (*hspi->pTxBuffPtr++);
   hspi->TxXferCount--;
@@ -2875,7 +3449,7 @@ static void SPI_TxISR_8BIT(struct __SPI_HandleTypeDef *hspi)
   *               the configuration information for SPI module.
   * @retval None
   */
-static void SPI_TxISR_16BIT(struct __SPI_HandleTypeDef *hspi)
+static __HOT_RAM_FUNC void SPI_TxISR_16BIT(struct __SPI_HandleTypeDef *hspi)
 {
   /* Transmit data in 16 Bit mode */
   hspi->Instance->DR = *((uint16_t *)hspi->pTxBuffPtr);
@@ -2909,6 +3483,9 @@ static HAL_StatusTypeDef SPI_WaitFlagStateUntilTimeout(SPI_HandleTypeDef *hspi,
 {
   while((((hspi->Instance->SR & Flag) == (Flag)) ? SET : RESET) != State)
   {
+    /* Let the application yield or sleep while waiting */
+    HAL_WaitHook(HAL_WAIT_SPI, hspi);
+
     if(Timeout != HAL_MAX_DELAY)
     {
       if((Timeout == 0U) || ((HAL_GetTick()-Tickstart) >= Timeout))
@@ -3141,6 +3718,47 @@ static void SPI_CloseTx_ISR(SPI_HandleTypeDef *hspi)
   * @}
   */
 
+/**
+  * @brief  Lean interrupt entry of HAL_SPI_Transmit_IT().
+  * @note   Serves the TXE event only, as the generic handler does first for a
+  *         transmit-only transfer. Any other event is left to the generic handler.
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *               the configuration information for SPI module.
+  * @retval None
+  */
+static __HOT_RAM_FUNC void SPI_TxOnly_IRQHandler(SPI_HandleTypeDef *hspi)
+{
+  if(((hspi->Instance->SR & SPI_FLAG_TXE) != RESET) && ((hspi->Instance->CR2 & SPI_IT_TXE) != RESET))
+  {
+    hspi->TxISR(hspi);
+  }
+  else
+  {
+    SPI_DefaultIRQHandler(hspi);
+  }
+}
+
+/**
+  * @brief  Lean interrupt entry of HAL_SPI_Receive_IT().
+  * @note   Serves the RXNE event without overrun only, as the generic handler does
+  *         first. Errors and any other event are left to the generic handler.
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *               the configuration information for SPI module.
+  * @retval None
+  */
+static __HOT_RAM_FUNC void SPI_RxOnly_IRQHandler(SPI_HandleTypeDef *hspi)
+{
+  if(((hspi->Instance->SR & (SPI_FLAG_RXNE | SPI_FLAG_OVR)) == SPI_FLAG_RXNE) &&
+     ((hspi->Instance->CR2 & SPI_IT_RXNE) != RESET))
+  {
+    hspi->RxISR(hspi);
+  }
+  else
+  {
+    SPI_DefaultIRQHandler(hspi);
+  }
+}
+
 /**
   * @brief  Handle abort a Tx or Rx transaction.
   * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
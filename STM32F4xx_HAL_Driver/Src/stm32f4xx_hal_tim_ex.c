@@ -64,6 +64,10 @@
            (++) Complementary One-pulse mode output : HAL_TIMEx_OnePulseN_Start(), HAL_TIMEx_OnePulseN_Start_IT()
            (++) Hall Sensor output : HAL_TIMEx_HallSensor_Start(), HAL_TIMEx_HallSensor_Start_DMA(), HAL_TIMEx_HallSensor_Start_IT().
 
+    (#) Stream multi-channel PWM waveforms (RCR and CCR1 to CCR4 updated at each
+        update event) with HAL_TIMEx_PWMStream_Start_DMA(), see the Extension PWM
+        Stream functions section.
+
 
   @endverbatim
   ******************************************************************************
@@ -119,6 +123,8 @@
   */
 /* Private function prototypes -----------------------------------------------*/
 static void TIM_CCxNChannelCmd(TIM_TypeDef* TIMx, uint32_t Channel, uint32_t ChannelNState);
+static void TIMEx_DMAPWMStreamFirstPartCplt(DMA_HandleTypeDef *hdma);
+static void TIMEx_DMAPWMStreamSecondPartCplt(DMA_HandleTypeDef *hdma);
 /**
   * @}
   */
@@ -1830,6 +1836,188 @@ HAL_TIM_StateTypeDef HAL_TIMEx_HallSensor_GetState(TIM_HandleTypeDef *htim)
   return htim->State;
 }
 
+/**
+  * @}
+  */
+
+/** @defgroup TIMEx_Exported_Functions_Group8 Extension PWM Stream functions
+ *  @brief   Extension PWM Stream functions
+ *
+@verbatim
+  ==============================================================================
+                ##### Extension PWM Stream functions #####
+  ==============================================================================
+  [..]
+    This section provides functions to stream PWM waveforms: at each update event
+    the update DMA request writes a frame of consecutive timer registers, among
+    RCR and CCR1 to CCR4, through the DMA burst (DCR/DMAR) interface. Typical uses
+    are WS2812 LED strips (one duty cycle per bit) and multi-phase motor PWM
+    (CCR1 to CCR3 updated together at each period).
+
+    (#) Configure the PWM channels with HAL_TIM_PWM_ConfigChannel(), which enables
+        the CCRx preload so that a frame is applied at the next update event.
+    (#) Initialize the DMA stream of the update request with HAL_DMA_Init() in
+        DMA_CIRCULAR mode, memory to peripheral, and link it to the
+        hdma[TIM_DMA_ID_UPDATE] of the TIM handle.
+    (#) Call HAL_TIMEx_PWMStream_Start_DMA() with the first register of the frame
+        (TIM_DMABASE_RCR or TIM_DMABASE_CCRx), the number of registers of the
+        frame and the number of frames of the buffers:
+        (++) Single buffer (pBuffer1 NULL): the buffer is played in a loop and
+             HAL_TIMEx_PWMStreamRefillCallback() is called when one half of the
+             frames has been transferred and can be refilled.
+        (++) Double buffer (pBuffer1 not NULL): the DMA alternates between the two
+             buffers and HAL_TIMEx_PWMStreamRefillCallback() is called each time a
+             buffer has been transferred and can be refilled.
+    (#) Start the channel outputs and the counter with HAL_TIM_PWM_Start() and
+        HAL_TIMEx_PWMN_Start(). The frame n is written on the update event n and
+        drives the period n+1, so the CCRx should be set to their idle value
+        before the start.
+    (#) Stop the stream with HAL_TIMEx_PWMStream_Stop_DMA(), the outputs keep the
+        last frame until they are stopped with HAL_TIM_PWM_Stop().
+
+    -@- The TIM handle stays in HAL_TIM_STATE_BUSY while the stream runs, so the
+        other DMA start functions of the same timer return HAL_BUSY instead of
+        reprogramming the update DMA stream.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Starts streaming PWM frames to the timer registers on each update event.
+  * @param  htim: pointer to a TIM_HandleTypeDef structure that contains
+  *                the configuration information for TIM module.
+  * @param  BurstBaseAddress: first register written by each frame.
+  *          This parameter can be one of the following values:
+  *            @arg TIM_DMABASE_RCR: repetition counter, for timers with a repetition counter
+  *            @arg TIM_DMABASE_CCR1
+  *            @arg TIM_DMABASE_CCR2
+  *            @arg TIM_DMABASE_CCR3
+  *            @arg TIM_DMABASE_CCR4
+  * @param  BurstLength: number of registers in a frame, from TIM_DMABURSTLENGTH_1TRANSFER
+  *         to TIM_DMABURSTLENGTH_5TRANSFERS. The frame must not go beyond CCR4.
+  * @param  pBuffer0: buffer of FrameCount frames, with the data size of the DMA stream configuration.
+  * @param  pBuffer1: second buffer of FrameCount frames for the double-buffer mode,
+  *         or NULL to loop on pBuffer0.
+  * @param  FrameCount: number of frames in each buffer, even when pBuffer1 is NULL.
+  *         FrameCount multiplied by the frame length must not exceed 0xFFFF.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_TIMEx_PWMStream_Start_DMA(TIM_HandleTypeDef *htim, uint32_t BurstBaseAddress, uint32_t BurstLength,
+                                                uint32_t *pBuffer0, uint32_t *pBuffer1, uint16_t FrameCount)
+{
+  DMA_HandleTypeDef *hdma = htim->hdma[TIM_DMA_ID_UPDATE];
+  uint32_t datalength;
+  HAL_StatusTypeDef status;
+
+  /* Check the parameters */
+  assert_param(IS_TIM_DMABURST_INSTANCE(htim->Instance));
+  assert_param(IS_TIM_PWMSTREAM_BASE(BurstBaseAddress));
+  assert_param(IS_TIM_PWMSTREAM_LENGTH(BurstBaseAddress, BurstLength));
+  assert_param((BurstBaseAddress != TIM_DMABASE_RCR) || IS_TIM_REPETITION_COUNTER_INSTANCE(htim->Instance));
+
+  if(htim->State == HAL_TIM_STATE_BUSY)
+  {
+    return HAL_BUSY;
+  }
+
+  datalength = (uint32_t)FrameCount * ((BurstLength >> 8U) + 1U);
+
+  if((htim->State != HAL_TIM_STATE_READY) || (hdma == NULL) || (hdma->Init.Mode != DMA_CIRCULAR) ||
+     (pBuffer0 == NULL) || (FrameCount == 0U) || (datalength > 0xFFFFU) ||
+     ((pBuffer1 == NULL) && ((FrameCount & 1U) != 0U)))
+  {
+    return HAL_ERROR;
+  }
+
+  htim->State = HAL_TIM_STATE_BUSY;
+
+  /* Set the DMA error callback */
+  hdma->XferErrorCallback = TIM_DMAError;
+
+  if(pBuffer1 == NULL)
+  {
+    /* Circular buffer: each half is released when it has been transferred */
+    hdma->XferHalfCpltCallback = TIMEx_DMAPWMStreamFirstPartCplt;
+    hdma->XferCpltCallback = TIMEx_DMAPWMStreamSecondPartCplt;
+
+    status = HAL_DMA_Start_IT(hdma, (uint32_t)pBuffer0, (uint32_t)&htim->Instance->DMAR, datalength);
+  }
+  else
+  {
+    /* Double buffer: each buffer is released when the DMA switches to the other one */
+    hdma->XferHalfCpltCallback = NULL;
+    hdma->XferM1HalfCpltCallback = NULL;
+    hdma->XferCpltCallback = TIMEx_DMAPWMStreamFirstPartCplt;
+    hdma->XferM1CpltCallback = TIMEx_DMAPWMStreamSecondPartCplt;
+
+    status = HAL_DMAEx_MultiBufferStart_IT(hdma, (uint32_t)pBuffer0, (uint32_t)&htim->Instance->DMAR,
+                                           (uint32_t)pBuffer1, datalength);
+  }
+
+  if(status != HAL_OK)
+  {
+    htim->State = HAL_TIM_STATE_READY;
+    return status;
+  }
+
+  /* Configure the DMA Burst Mode */
+  htim->Instance->DCR = BurstBaseAddress | BurstLength;
+
+  /* Enable the TIM Update DMA request */
+  __HAL_TIM_ENABLE_DMA(htim, TIM_DMA_UPDATE);
+
+  /* Return function status */
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stops the PWM stream started by HAL_TIMEx_PWMStream_Start_DMA().
+  * @note   The channel outputs and the counter are not stopped, the last frame
+  *         written stays in the CCRx registers.
+  * @param  htim: pointer to a TIM_HandleTypeDef structure that contains
+  *                the configuration information for TIM module.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_TIMEx_PWMStream_Stop_DMA(TIM_HandleTypeDef *htim)
+{
+  /* Check the parameters */
+  assert_param(IS_TIM_DMABURST_INSTANCE(htim->Instance));
+
+  /* Disable the TIM Update DMA request */
+  __HAL_TIM_DISABLE_DMA(htim, TIM_DMA_UPDATE);
+
+  /* Abort the DMA transfer (at least disable the DMA stream) */
+  HAL_DMA_Abort(htim->hdma[TIM_DMA_ID_UPDATE]);
+
+  /* Change the htim state */
+  htim->State = HAL_TIM_STATE_READY;
+
+  /* Return function status */
+  return HAL_OK;
+}
+
+/**
+  * @brief  PWM stream refill callback, a part of the frames has been transferred
+  *         and can be written with the next frames.
+  * @param  htim: pointer to a TIM_HandleTypeDef structure that contains
+  *                the configuration information for TIM module.
+  * @param  Part: part of the buffers released.
+  *          This parameter can be one of the following values:
+  *            @arg TIM_PWMSTREAM_PART_FIRST: first half of pBuffer0, or pBuffer0 in double-buffer mode
+  *            @arg TIM_PWMSTREAM_PART_SECOND: second half of pBuffer0, or pBuffer1 in double-buffer mode
+  * @retval None
+  */
+__weak void HAL_TIMEx_PWMStreamRefillCallback(TIM_HandleTypeDef *htim, uint32_t Part)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(htim);
+  UNUSED(Part);
+  /* NOTE : This function Should not be modified, when the callback is needed,
+            the HAL_TIMEx_PWMStreamRefillCallback could be implemented in the user file
+   */
+}
+
 /**
   * @}
   */
@@ -1848,6 +2036,32 @@ void TIMEx_DMACommutationCplt(DMA_HandleTypeDef *hdma)
 
   HAL_TIMEx_CommutationCallback(htim);
 }
+
+/**
+  * @brief  TIM DMA PWM stream first part released callback.
+  * @param  hdma: pointer to a DMA_HandleTypeDef structure that contains
+  *                the configuration information for the specified DMA module.
+  * @retval None
+  */
+static void TIMEx_DMAPWMStreamFirstPartCplt(DMA_HandleTypeDef *hdma)
+{
+  TIM_HandleTypeDef* htim = ( TIM_HandleTypeDef* )((DMA_HandleTypeDef* )hdma)->Parent;
+
+  HAL_TIMEx_PWMStreamRefillCallback(htim, TIM_PWMSTREAM_PART_FIRST);
+}
+
+/**
+  * @brief  TIM DMA PWM stream second part released callback.
+  * @param  hdma: pointer to a DMA_HandleTypeDef structure that contains
+  *                the configuration information for the specified DMA module.
+  * @retval None
+  */
+static void TIMEx_DMAPWMStreamSecondPartCplt(DMA_HandleTypeDef *hdma)
+{
+  TIM_HandleTypeDef* htim = ( TIM_HandleTypeDef* )((DMA_HandleTypeDef* )hdma)->Parent;
+
+  HAL_TIMEx_PWMStreamRefillCallback(htim, TIM_PWMSTREAM_PART_SECOND);
+}
 /**
   * @}
   */
@@ -91,6 +91,8 @@
      ==============================
      [..]
        (+) Send an amount of data in non blocking mode (DMA) using HAL_UART_Transmit_DMA()
+       (+) Send a list of fragments back-to-back in non blocking mode (DMA) using
+            HAL_UARTEx_TransmitV_DMA(), HAL_UART_TxCpltCallback is executed after the last one
        (+) At transmission end of half transfer HAL_UART_TxHalfCpltCallback is executed and user can
             add his own code by customization of function pointer HAL_UART_TxHalfCpltCallback
        (+) At transmission end of transfer HAL_UART_TxCpltCallback is executed and user can
@@ -105,6 +107,26 @@
        (+) Pause the DMA Transfer using HAL_UART_DMAPause()
        (+) Resume the DMA Transfer using HAL_UART_DMAResume()
        (+) Stop the DMA Transfer using HAL_UART_DMAStop()
+       (+) Receive continuously into an application owned power-of-two ring buffer using
+            HAL_UARTEx_RingReceive_DMA() (Rx DMA in circular mode). The write index follows the
+            DMA on line idle, half and full transfer events, HAL_UARTEx_RingRxEventCallback() is
+            executed on each of them and the data is read in place with HAL_UARTEx_Ring_GetData()
+            and HAL_UARTEx_Ring_Release()
+
+     *** Ring buffer interrupt mode IO operation ***
+     ===============================================
+     [..]
+       (+) Receive continuously into a power-of-two ring buffer, one byte per RXNE interrupt,
+            using HAL_UARTEx_RingReceive_IT(). HAL_UARTEx_RingRxEventCallback() is executed
+            when the line goes idle and the data is read as for the DMA ring.
+       (+) Transmit from a power-of-two ring buffer using HAL_UARTEx_RingTransmit_IT(), then
+            queue data at any time with HAL_UARTEx_RingTransmit_Write(). HAL_UARTEx_Ring_GetCount()
+            returns the number of bytes not yet sent. Stop with HAL_UARTEx_RingTransmit_Stop().
+       (+) The ring services (including HAL_UARTEx_RingReceive_DMA()) install a lean interrupt
+            handler in huart->IRQHandler, to which HAL_UART_IRQHandler() forwards. It only tests
+            the flags of its mode and takes the line errors and the flags of the other services
+            on a slow path. A reception ring (interrupt or DMA mode) and a transmission ring can
+            run together on a handle: a single handler then serves both of them.
 
      *** UART HAL driver macros list ***
      =============================================
@@ -192,6 +214,17 @@ static void UART_DMATxAbortCallback(DMA_HandleTypeDef *hdma);
 static void UART_DMARxAbortCallback(DMA_HandleTypeDef *hdma);
 static void UART_DMATxOnlyAbortCallback(DMA_HandleTypeDef *hdma);
 static void UART_DMARxOnlyAbortCallback(DMA_HandleTypeDef *hdma);
+static void UART_DMARingRxEvent(DMA_HandleTypeDef *hdma);
+static void UART_DMATransmitFragCplt(DMA_HandleTypeDef *hdma);
+static void UART_DefaultIRQHandler(UART_HandleTypeDef *huart);
+static void UART_RxRingDMA_IRQHandler(UART_HandleTypeDef *huart);
+static void UART_RxRing_IRQHandler(UART_HandleTypeDef *huart);
+static void UART_RxRingError(UART_HandleTypeDef *huart, uint32_t isrflags);
+static void UART_TxRing_IRQHandler(UART_HandleTypeDef *huart);
+static void UART_RxTxRing_IRQHandler(UART_HandleTypeDef *huart);
+static void UART_RxRing_Receive(UART_HandleTypeDef *huart, uint32_t isrflags);
+static void UART_TxRing_Transmit(UART_HandleTypeDef *huart);
+static void UART_RingSetIRQHandler(UART_HandleTypeDef *huart);
 static HAL_StatusTypeDef UART_Transmit_IT(UART_HandleTypeDef *huart);
 static HAL_StatusTypeDef UART_EndTransmit_IT(UART_HandleTypeDef *huart);
 static HAL_StatusTypeDef UART_Receive_IT(UART_HandleTypeDef *huart);
@@ -269,6 +302,10 @@ HAL_StatusTypeDef HAL_UART_Init(UART_HandleTypeDef *huart)
   {
     /* Allocate lock resource and initialize it */
     huart->Lock = HAL_UNLOCKED;
+    huart->pRxRing = NULL;
+    huart->pTxFrag = NULL;
+    huart->pTxRing = NULL;
+    huart->IRQHandler = NULL;
     /* Init the low level hardware */
     HAL_UART_MspInit(huart);
   }
@@ -322,6 +359,10 @@ HAL_StatusTypeDef HAL_HalfDuplex_Init(UART_HandleTypeDef *huart)
   {
     /* Allocate lock resource and initialize it */
     huart->Lock = HAL_UNLOCKED;
+    huart->pRxRing = NULL;
+    huart->pTxFrag = NULL;
+    huart->pTxRing = NULL;
+    huart->IRQHandler = NULL;
     /* Init the low level hardware */
     HAL_UART_MspInit(huart);
   }
@@ -383,6 +424,10 @@ HAL_StatusTypeDef HAL_LIN_Init(UART_HandleTypeDef *huart, uint32_t BreakDetectLe
   {
     /* Allocate lock resource and initialize it */
     huart->Lock = HAL_UNLOCKED;
+    huart->pRxRing = NULL;
+    huart->pTxFrag = NULL;
+    huart->pTxRing = NULL;
+    huart->IRQHandler = NULL;
     /* Init the low level hardware */
     HAL_UART_MspInit(huart);
   }
@@ -450,6 +495,10 @@ HAL_StatusTypeDef HAL_MultiProcessor_Init(UART_HandleTypeDef *huart, uint8_t Add
   {
     /* Allocate lock resource and initialize it */
     huart->Lock = HAL_UNLOCKED;
+    huart->pRxRing = NULL;
+    huart->pTxFrag = NULL;
+    huart->pTxRing = NULL;
+    huart->IRQHandler = NULL;
     /* Init the low level hardware */
     HAL_UART_MspInit(huart);
   }
@@ -809,7 +858,7 @@ HAL_StatusTypeDef HAL_UART_Transmit_IT(UART_HandleTypeDef *huart, uint8_t *pData
     __HAL_UNLOCK(huart);
 
     /* Enable the UART Transmit data register empty Interrupt */
-    SET_BIT(huart->Instance->CR1, USART_CR1_TXEIE);
+    ATOMIC_SET_BIT(huart->Instance->CR1, USART_CR1_TXEIE);
 
     return HAL_OK;
   }
@@ -851,10 +900,10 @@ HAL_StatusTypeDef HAL_UART_Receive_IT(UART_HandleTypeDef *huart, uint8_t *pData,
     __HAL_UNLOCK(huart);
 
     /* Enable the UART Error Interrupt: (Frame error, noise error, overrun error) */
-    SET_BIT(huart->Instance->CR3, USART_CR3_EIE);
+    ATOMIC_SET_BIT(huart->Instance->CR3, USART_CR3_EIE);
 
     /* Enable the UART Parity Error and Data Register not empty Interrupts */
-    SET_BIT(huart->Instance->CR1, USART_CR1_PEIE | USART_CR1_RXNEIE);
+    ATOMIC_SET_BIT(huart->Instance->CR1, USART_CR1_PEIE | USART_CR1_RXNEIE);
 
     return HAL_OK;
   }
@@ -918,7 +967,7 @@ HAL_StatusTypeDef HAL_UART_Transmit_DMA(UART_HandleTypeDef *huart, uint8_t *pDat
 
     /* Enable the DMA transfer for transmit request by setting the DMAT bit
        in the UART CR3 register */
-    SET_BIT(huart->Instance->CR3, USART_CR3_DMAT);
+    ATOMIC_SET_BIT(huart->Instance->CR3, USART_CR3_DMAT);
 
     return HAL_OK;
   }
@@ -981,14 +1030,93 @@ HAL_StatusTypeDef HAL_UART_Receive_DMA(UART_HandleTypeDef *huart, uint8_t *pData
     __HAL_UNLOCK(huart);
 
     /* Enable the UART Parity Error Interrupt */
-    SET_BIT(huart->Instance->CR1, USART_CR1_PEIE);
+    ATOMIC_SET_BIT(huart->Instance->CR1, USART_CR1_PEIE);
 
     /* Enable the UART Error Interrupt: (Frame error, noise error, overrun error) */
-    SET_BIT(huart->Instance->CR3, USART_CR3_EIE);
+    ATOMIC_SET_BIT(huart->Instance->CR3, USART_CR3_EIE);
 
     /* Enable the DMA transfer for the receiver request by setting the DMAR bit
     in the UART CR3 register */
-    SET_BIT(huart->Instance->CR3, USART_CR3_DMAR);
+    ATOMIC_SET_BIT(huart->Instance->CR3, USART_CR3_DMAR);
+
+    return HAL_OK;
+  }
+  else
+  {
+    return HAL_BUSY;
+  }
+}
+
+/**
+  * @brief  Sends a list of fragments back-to-back in non blocking mode (DMA).
+  * @note   The fragments are chained from the DMA transfer complete interrupt: the
+  *         next fragment is started while the last data of the previous one are
+  *         still being shifted out, so no copy into a staging buffer is needed
+  *         and no idle time is inserted between fragments.
+  * @note   HAL_UART_TxCpltCallback() is executed once, after the last fragment.
+  * @note   The fragment list and the data it points to must stay valid until then.
+  * @param  huart: pointer to a UART_HandleTypeDef structure that contains
+  *                the configuration information for the specified UART module.
+  * @param  pFrags: Pointer to the fragment list
+  * @param  NbFrags: Number of fragments in the list
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UARTEx_TransmitV_DMA(UART_HandleTypeDef *huart, const UART_TxFragmentTypeDef *pFrags, uint32_t NbFrags)
+{
+  uint32_t i;
+
+  /* Check that a Tx process is not already ongoing */
+  if(huart->gState == HAL_UART_STATE_READY)
+  {
+    if((pFrags == NULL) || (NbFrags == 0U))
+    {
+      return HAL_ERROR;
+    }
+
+    for(i = 0U; i < NbFrags; i++)
+    {
+      if((pFrags[i].pData == NULL) || (pFrags[i].Size == 0U))
+      {
+        return HAL_ERROR;
+      }
+    }
+
+    /* Process Locked */
+    __HAL_LOCK(huart);
+
+    huart->pTxBuffPtr = pFrags[0].pData;
+    huart->TxXferSize = pFrags[0].Size;
+    huart->TxXferCount = pFrags[0].Size;
+    huart->pTxFrag = &pFrags[1];
+    huart->TxFragCount = NbFrags - 1U;
+
+    huart->ErrorCode = HAL_UART_ERROR_NONE;
+    huart->gState = HAL_UART_STATE_BUSY_TX;
+
+    /* Set the UART DMA transfer complete callback, which chains the fragments */
+    huart->hdmatx->XferCpltCallback = UART_DMATransmitFragCplt;
+
+    /* No half transfer notification in this mode */
+    huart->hdmatx->XferHalfCpltCallback = NULL;
+
+    /* Set the DMA error callback */
+    huart->hdmatx->XferErrorCallback = UART_DMAError;
+
+    /* Set the DMA abort callback */
+    huart->hdmatx->XferAbortCallback = NULL;
+
+    /* Enable the UART transmit DMA Stream */
+    HAL_DMA_Start_IT(huart->hdmatx, (uint32_t)pFrags[0].pData, (uint32_t)&huart->Instance->DR, pFrags[0].Size);
+
+    /* Clear the TC flag in the SR register by writing 0 to it */
+    __HAL_UART_CLEAR_FLAG(huart, UART_FLAG_TC);
+
+    /* Process Unlocked */
+    __HAL_UNLOCK(huart);
+
+    /* Enable the DMA transfer for transmit request by setting the DMAT bit
+       in the UART CR3 register */
+    ATOMIC_SET_BIT(huart->Instance->CR3, USART_CR3_DMAT);
 
     return HAL_OK;
   }
@@ -1014,17 +1142,17 @@ HAL_StatusTypeDef HAL_UART_DMAPause(UART_HandleTypeDef *huart)
   if((huart->gState == HAL_UART_STATE_BUSY_TX) && dmarequest)
   {
     /* Disable the UART DMA Tx request */
-    CLEAR_BIT(huart->Instance->CR3, USART_CR3_DMAT);
+    ATOMIC_CLEAR_BIT(huart->Instance->CR3, USART_CR3_DMAT);
   }
   dmarequest = HAL_IS_BIT_SET(huart->Instance->CR3, USART_CR3_DMAR);
   if((huart->RxState == HAL_UART_STATE_BUSY_RX) && dmarequest)
   {
     /* Disable RXNE, PE and ERR (Frame error, noise error, overrun error) interrupts */
-    CLEAR_BIT(huart->Instance->CR1, USART_CR1_PEIE);
-    CLEAR_BIT(huart->Instance->CR3, USART_CR3_EIE);
+    ATOMIC_CLEAR_BIT(huart->Instance->CR1, USART_CR1_PEIE);
+    ATOMIC_CLEAR_BIT(huart->Instance->CR3, USART_CR3_EIE);
 
     /* Disable the UART DMA Rx request */
-    CLEAR_BIT(huart->Instance->CR3, USART_CR3_DMAR);
+    ATOMIC_CLEAR_BIT(huart->Instance->CR3, USART_CR3_DMAR);
   }
 
   /* Process Unlocked */
@@ -1047,7 +1175,7 @@ HAL_StatusTypeDef HAL_UART_DMAResume(UART_HandleTypeDef *huart)
   if(huart->gState == HAL_UART_STATE_BUSY_TX)
   {
     /* Enable the UART DMA Tx request */
-    SET_BIT(huart->Instance->CR3, USART_CR3_DMAT);
+    ATOMIC_SET_BIT(huart->Instance->CR3, USART_CR3_DMAT);
   }
   if(huart->RxState == HAL_UART_STATE_BUSY_RX)
   {
@@ -1055,11 +1183,11 @@ HAL_StatusTypeDef HAL_UART_DMAResume(UART_HandleTypeDef *huart)
     __HAL_UART_CLEAR_OREFLAG(huart);
 
     /* Reenable PE and ERR (Frame error, noise error, overrun error) interrupts */
-    SET_BIT(huart->Instance->CR1, USART_CR1_PEIE);
-    SET_BIT(huart->Instance->CR3, USART_CR3_EIE);
+    ATOMIC_SET_BIT(huart->Instance->CR1, USART_CR1_PEIE);
+    ATOMIC_SET_BIT(huart->Instance->CR3, USART_CR3_EIE);
 
     /* Enable the UART DMA Rx request */
-    SET_BIT(huart->Instance->CR3, USART_CR3_DMAR);
+    ATOMIC_SET_BIT(huart->Instance->CR3, USART_CR3_DMAR);
   }
 
   /* Process Unlocked */
@@ -1087,7 +1215,7 @@ HAL_StatusTypeDef HAL_UART_DMAStop(UART_HandleTypeDef *huart)
   dmarequest = HAL_IS_BIT_SET(huart->Instance->CR3, USART_CR3_DMAT);
   if((huart->gState == HAL_UART_STATE_BUSY_TX) && dmarequest)
   {
-    CLEAR_BIT(huart->Instance->CR3, USART_CR3_DMAT);
+    ATOMIC_CLEAR_BIT(huart->Instance->CR3, USART_CR3_DMAT);
 
     /* Abort the UART DMA Tx channel */
     if(huart->hdmatx != NULL)
@@ -1101,7 +1229,7 @@ HAL_StatusTypeDef HAL_UART_DMAStop(UART_HandleTypeDef *huart)
   dmarequest = HAL_IS_BIT_SET(huart->Instance->CR3, USART_CR3_DMAR);
   if((huart->RxState == HAL_UART_STATE_BUSY_RX) && dmarequest)
   {
-    CLEAR_BIT(huart->Instance->CR3, USART_CR3_DMAR);
+    ATOMIC_CLEAR_BIT(huart->Instance->CR3, USART_CR3_DMAR);
 
     /* Abort the UART DMA Rx channel */
     if(huart->hdmarx != NULL)
@@ -1129,13 +1257,13 @@ HAL_StatusTypeDef HAL_UART_DMAStop(UART_HandleTypeDef *huart)
 HAL_StatusTypeDef HAL_UART_Abort(UART_HandleTypeDef *huart)
 {
   /* Disable TXEIE, TCIE, RXNE, PE and ERR (Frame error, noise error, overrun error) interrupts */
-  CLEAR_BIT(huart->Instance->CR1, (USART_CR1_RXNEIE | USART_CR1_PEIE | USART_CR1_TXEIE | USART_CR1_TCIE));
-  CLEAR_BIT(huart->Instance->CR3, USART_CR3_EIE);
+  ATOMIC_CLEAR_BIT(huart->Instance->CR1, (USART_CR1_RXNEIE | USART_CR1_PEIE | USART_CR1_TXEIE | USART_CR1_TCIE));
+  ATOMIC_CLEAR_BIT(huart->Instance->CR3, USART_CR3_EIE);
 
   /* Disable the UART DMA Tx request if enabled */
   if(HAL_IS_BIT_SET(huart->Instance->CR3, USART_CR3_DMAT))
   {
-    CLEAR_BIT(huart->Instance->CR3, USART_CR3_DMAT);
+    ATOMIC_CLEAR_BIT(huart->Instance->CR3, USART_CR3_DMAT);
 
     /* Abort the UART DMA Tx channel: use blocking DMA Abort API (no callback) */
     if(huart->hdmatx != NULL)
@@ -1151,7 +1279,7 @@ HAL_StatusTypeDef HAL_UART_Abort(UART_HandleTypeDef *huart)
   /* Disable the UART DMA Rx request if enabled */
   if(HAL_IS_BIT_SET(huart->Instance->CR3, USART_CR3_DMAR))
   {
-    CLEAR_BIT(huart->Instance->CR3, USART_CR3_DMAR);
+    ATOMIC_CLEAR_BIT(huart->Instance->CR3, USART_CR3_DMAR);
 
     /* Abort the UART DMA Rx channel: use blocking DMA Abort API (no callback) */
     if(huart->hdmarx != NULL)
@@ -1193,12 +1321,12 @@ HAL_StatusTypeDef HAL_UART_Abort(UART_HandleTypeDef *huart)
 HAL_StatusTypeDef HAL_UART_AbortTransmit(UART_HandleTypeDef *huart)
 {
   /* Disable TXEIE and TCIE interrupts */
-  CLEAR_BIT(huart->Instance->CR1, (USART_CR1_TXEIE | USART_CR1_TCIE));
+  ATOMIC_CLEAR_BIT(huart->Instance->CR1, (USART_CR1_TXEIE | USART_CR1_TCIE));
 
   /* Disable the UART DMA Tx request if enabled */
   if(HAL_IS_BIT_SET(huart->Instance->CR3, USART_CR3_DMAT))
   {
-    CLEAR_BIT(huart->Instance->CR3, USART_CR3_DMAT);
+    ATOMIC_CLEAR_BIT(huart->Instance->CR3, USART_CR3_DMAT);
 
     /* Abort the UART DMA Tx channel : use blocking DMA Abort API (no callback) */
     if(huart->hdmatx != NULL)
@@ -1235,13 +1363,13 @@ HAL_StatusTypeDef HAL_UART_AbortTransmit(UART_HandleTypeDef *huart)
 HAL_StatusTypeDef HAL_UART_AbortReceive(UART_HandleTypeDef *huart)
 {
   /* Disable RXNE, PE and ERR (Frame error, noise error, overrun error) interrupts */
-  CLEAR_BIT(huart->Instance->CR1, (USART_CR1_RXNEIE | USART_CR1_PEIE));
-  CLEAR_BIT(huart->Instance->CR3, USART_CR3_EIE);
+  ATOMIC_CLEAR_BIT(huart->Instance->CR1, (USART_CR1_RXNEIE | USART_CR1_PEIE));
+  ATOMIC_CLEAR_BIT(huart->Instance->CR3, USART_CR3_EIE);
 
   /* Disable the UART DMA Rx request if enabled */
   if(HAL_IS_BIT_SET(huart->Instance->CR3, USART_CR3_DMAR))
   {
-    CLEAR_BIT(huart->Instance->CR3, USART_CR3_DMAR);
+    ATOMIC_CLEAR_BIT(huart->Instance->CR3, USART_CR3_DMAR);
 
     /* Abort the UART DMA Rx channel : use blocking DMA Abort API (no callback) */
     if(huart->hdmarx != NULL)
@@ -1282,8 +1410,8 @@ HAL_StatusTypeDef HAL_UART_Abort_IT(UART_HandleTypeDef *huart)
   uint32_t AbortCplt = 0x01U;
 
   /* Disable TXEIE, TCIE, RXNE, PE and ERR (Frame error, noise error, overrun error) interrupts */
-  CLEAR_BIT(huart->Instance->CR1, (USART_CR1_RXNEIE | USART_CR1_PEIE | USART_CR1_TXEIE | USART_CR1_TCIE));
-  CLEAR_BIT(huart->Instance->CR3, USART_CR3_EIE);
+  ATOMIC_CLEAR_BIT(huart->Instance->CR1, (USART_CR1_RXNEIE | USART_CR1_PEIE | USART_CR1_TXEIE | USART_CR1_TCIE));
+  ATOMIC_CLEAR_BIT(huart->Instance->CR3, USART_CR3_EIE);
 
   /* If DMA Tx and/or DMA Rx Handles are associated to UART Handle, DMA Abort complete callbacks should be initialised
      before any call to DMA Abort functions */
@@ -1320,7 +1448,7 @@ HAL_StatusTypeDef HAL_UART_Abort_IT(UART_HandleTypeDef *huart)
   if(HAL_IS_BIT_SET(huart->Instance->CR3, USART_CR3_DMAT))
   {
     /* Disable DMA Tx at UART level */
-    CLEAR_BIT(huart->Instance->CR3, USART_CR3_DMAT);
+    ATOMIC_CLEAR_BIT(huart->Instance->CR3, USART_CR3_DMAT);
 
     /* Abort the UART DMA Tx channel : use non blocking DMA Abort API (callback) */
     if(huart->hdmatx != NULL)
@@ -1343,7 +1471,7 @@ HAL_StatusTypeDef HAL_UART_Abort_IT(UART_HandleTypeDef *huart)
   /* Disable the UART DMA Rx request if enabled */
   if(HAL_IS_BIT_SET(huart->Instance->CR3, USART_CR3_DMAR))
   {
-    CLEAR_BIT(huart->Instance->CR3, USART_CR3_DMAR);
+    ATOMIC_CLEAR_BIT(huart->Instance->CR3, USART_CR3_DMAR);
 
     /* Abort the UART DMA Rx channel : use non blocking DMA Abort API (callback) */
     if(huart->hdmarx != NULL)
@@ -1402,12 +1530,12 @@ HAL_StatusTypeDef HAL_UART_Abort_IT(UART_HandleTypeDef *huart)
 HAL_StatusTypeDef HAL_UART_AbortTransmit_IT(UART_HandleTypeDef *huart)
 {
   /* Disable TXEIE and TCIE interrupts */
-  CLEAR_BIT(huart->Instance->CR1, (USART_CR1_TXEIE | USART_CR1_TCIE));
+  ATOMIC_CLEAR_BIT(huart->Instance->CR1, (USART_CR1_TXEIE | USART_CR1_TCIE));
 
   /* Disable the UART DMA Tx request if enabled */
   if(HAL_IS_BIT_SET(huart->Instance->CR3, USART_CR3_DMAT))
   {
-    CLEAR_BIT(huart->Instance->CR3, USART_CR3_DMAT);
+    ATOMIC_CLEAR_BIT(huart->Instance->CR3, USART_CR3_DMAT);
 
     /* Abort the UART DMA Tx channel : use blocking DMA Abort API (no callback) */
     if(huart->hdmatx != NULL)
@@ -1467,13 +1595,13 @@ HAL_StatusTypeDef HAL_UART_AbortTransmit_IT(UART_HandleTypeDef *huart)
 HAL_StatusTypeDef HAL_UART_AbortReceive_IT(UART_HandleTypeDef *huart)
 {
   /* Disable RXNE, PE and ERR (Frame error, noise error, overrun error) interrupts */
-  CLEAR_BIT(huart->Instance->CR1, (USART_CR1_RXNEIE | USART_CR1_PEIE));
-  CLEAR_BIT(huart->Instance->CR3, USART_CR3_EIE);
+  ATOMIC_CLEAR_BIT(huart->Instance->CR1, (USART_CR1_RXNEIE | USART_CR1_PEIE));
+  ATOMIC_CLEAR_BIT(huart->Instance->CR3, USART_CR3_EIE);
 
   /* Disable the UART DMA Rx request if enabled */
   if(HAL_IS_BIT_SET(huart->Instance->CR3, USART_CR3_DMAR))
   {
-    CLEAR_BIT(huart->Instance->CR3, USART_CR3_DMAR);
+    ATOMIC_CLEAR_BIT(huart->Instance->CR3, USART_CR3_DMAR);
 
     /* Abort the UART DMA Rx channel : use blocking DMA Abort API (no callback) */
     if(huart->hdmarx != NULL)
@@ -1517,187 +1645,693 @@ HAL_StatusTypeDef HAL_UART_AbortReceive_IT(UART_HandleTypeDef *huart)
 }
 
 /**
-  * @brief  This function handles UART interrupt request.
-  * @param  huart: pointer to a UART_HandleTypeDef structure that contains
-  *                the configuration information for the specified UART module.
-  * @retval None
+  * @brief  Start a ring buffer reception in DMA mode.
+  * @note   The Rx DMA handle must be configured in circular mode. The DMA then
+  *         fills pData continuously and the write index is resynchronised from
+  *         the DMA remaining data counter on line idle, half transfer and
+  *         transfer complete events, so a burst is made available to the reader
+  *         as soon as the line goes idle, without any per-byte interrupt.
+  * @note   The reader drains the ring with HAL_UARTEx_Ring_GetData() and
+  *         HAL_UARTEx_Ring_Release(), which hand out pointers into pData
+  *         (no copy is made).
+  * @note   Line errors (noise, framing, parity) are not reported in this mode,
+  *         the reception goes on. A reader that falls behind by more than Size
+  *         bytes loses the oldest data and Overrun is incremented.
+  * @param  huart Pointer to a UART_HandleTypeDef structure that contains
+  *               the configuration information for the specified UART module.
+  * @param  pRing Pointer to the ring descriptor, owned by the application.
+  * @param  pData Pointer to the ring storage.
+  * @param  Size  Size of the ring storage, must be a power of two.
+  * @retval HAL status
   */
-void HAL_UART_IRQHandler(UART_HandleTypeDef *huart)
+HAL_StatusTypeDef HAL_UARTEx_RingReceive_DMA(UART_HandleTypeDef *huart, UART_RingTypeDef *pRing, uint8_t *pData, uint16_t Size)
 {
-   uint32_t isrflags   = READ_REG(huart->Instance->SR);
-   uint32_t cr1its     = READ_REG(huart->Instance->CR1);
-   uint32_t cr3its     = READ_REG(huart->Instance->CR3);
-   uint32_t errorflags = 0x00U;
-   uint32_t dmarequest = 0x00U;
+  uint32_t *tmp;
 
-  /* If no error occurs */
-  errorflags = (isrflags & (uint32_t)(USART_SR_PE | USART_SR_FE | USART_SR_ORE | USART_SR_NE));
-  if(errorflags == RESET)
+  /* Check that a Rx process is not already ongoing */
+  if(huart->RxState == HAL_UART_STATE_READY)
   {
-    /* UART in mode Receiver -------------------------------------------------*/
-    if(((isrflags & USART_SR_RXNE) != RESET) && ((cr1its & USART_CR1_RXNEIE) != RESET))
+    if((pRing == NULL) || (pData == NULL) || (Size == 0U) || ((Size & (Size - 1U)) != 0U))
     {
-      UART_Receive_IT(huart);
-      return;
+      return HAL_ERROR;
     }
-  }
 
-  /* If some errors occur */
-  if((errorflags != RESET) && (((cr3its & USART_CR3_EIE) != RESET) || ((cr1its & (USART_CR1_RXNEIE | USART_CR1_PEIE)) != RESET)))
-  {
-    /* UART parity error interrupt occurred ----------------------------------*/
-    if(((isrflags & USART_SR_PE) != RESET) && ((cr1its & USART_CR1_PEIE) != RESET))
+    /* The ring relies on the DMA wrapping around by itself */
+    if((huart->hdmarx == NULL) || (huart->hdmarx->Init.Mode != DMA_CIRCULAR))
     {
-      huart->ErrorCode |= HAL_UART_ERROR_PE;
+      return HAL_ERROR;
     }
 
-    /* UART noise error interrupt occurred -----------------------------------*/
-    if(((isrflags & USART_SR_NE) != RESET) && ((cr3its & USART_CR3_EIE) != RESET))
-    {
-      huart->ErrorCode |= HAL_UART_ERROR_NE;
-    }
+    /* Process Locked */
+    __HAL_LOCK(huart);
 
-    /* UART frame error interrupt occurred -----------------------------------*/
-    if(((isrflags & USART_SR_FE) != RESET) && ((cr3its & USART_CR3_EIE) != RESET))
-    {
-      huart->ErrorCode |= HAL_UART_ERROR_FE;
-    }
+    pRing->pBuffer = pData;
+    pRing->Mask    = (uint32_t)Size - 1U;
+    pRing->Head    = 0U;
+    pRing->Tail    = 0U;
+    pRing->Overrun = 0U;
 
-    /* UART Over-Run interrupt occurred --------------------------------------*/
-    if(((isrflags & USART_SR_ORE) != RESET) && ((cr3its & USART_CR3_EIE) != RESET))
+    huart->pRxBuffPtr = pData;
+    huart->RxXferSize = Size;
+    huart->pRxRing    = pRing;
+
+    huart->ErrorCode = HAL_UART_ERROR_NONE;
+    huart->RxState = HAL_UART_STATE_BUSY_RX;
+
+    /* Half transfer and transfer complete both only resynchronise the write index */
+    huart->hdmarx->XferCpltCallback = UART_DMARingRxEvent;
+    huart->hdmarx->XferHalfCpltCallback = UART_DMARingRxEvent;
+
+    /* Set the DMA error callback */
+    huart->hdmarx->XferErrorCallback = UART_DMAError;
+
+    /* Set the DMA abort callback */
+    huart->hdmarx->XferAbortCallback = NULL;
+
+    /* Enable the DMA Stream */
+    tmp = (uint32_t *)&pData;
+    if(HAL_DMA_Start_IT(huart->hdmarx, (uint32_t)&huart->Instance->DR, *(uint32_t *)tmp, Size) != HAL_OK)
     {
-      huart->ErrorCode |= HAL_UART_ERROR_ORE;
+      huart->pRxRing = NULL;
+      huart->ErrorCode = HAL_UART_ERROR_DMA;
+      huart->RxState = HAL_UART_STATE_READY;
+
+      /* Process Unlocked */
+      __HAL_UNLOCK(huart);
+
+      return HAL_ERROR;
     }
 
-    /* Call UART Error Call back function if need be --------------------------*/
-    if(huart->ErrorCode != HAL_UART_ERROR_NONE)
-    {
-      /* UART in mode Receiver -----------------------------------------------*/
-      if(((isrflags & USART_SR_RXNE) != RESET) && ((cr1its & USART_CR1_RXNEIE) != RESET))
-      {
-        UART_Receive_IT(huart);
-      }
+    /* Clear the Overrun and Idle flags just before enabling the DMA Rx request */
+    __HAL_UART_CLEAR_OREFLAG(huart);
+    __HAL_UART_CLEAR_IDLEFLAG(huart);
 
-      /* If Overrun error occurs, or if any error occurs in DMA mode reception,
-         consider error as blocking */
-      dmarequest = HAL_IS_BIT_SET(huart->Instance->CR3, USART_CR3_DMAR);
-      if(((huart->ErrorCode & HAL_UART_ERROR_ORE) != RESET) || dmarequest)
-      {
-        /* Blocking error : transfer is aborted
-           Set the UART state ready to be able to start again the process,
-           Disable Rx Interrupts, and disable Rx DMA request, if ongoing */
-        UART_EndRxTransfer(huart);
+    /* Only the line idle event needs the CPU */
+    UART_RingSetIRQHandler(huart);
 
-        /* Disable the UART DMA Rx request if enabled */
-        if(HAL_IS_BIT_SET(huart->Instance->CR3, USART_CR3_DMAR))
-        {
-          CLEAR_BIT(huart->Instance->CR3, USART_CR3_DMAR);
+    /* Process Unlocked */
+    __HAL_UNLOCK(huart);
 
-          /* Abort the UART DMA Rx channel */
-          if(huart->hdmarx != NULL)
-          {
-            /* Set the UART DMA Abort callback :
-               will lead to call HAL_UART_ErrorCallback() at end of DMA abort procedure */
-            huart->hdmarx->XferAbortCallback = UART_DMAAbortOnError;
-            if(HAL_DMA_Abort_IT(huart->hdmarx) != HAL_OK)
-            {
-              /* Call Directly XferAbortCallback function in case of error */
-              huart->hdmarx->XferAbortCallback(huart->hdmarx);
-            }
-          }
-          else
-          {
-            /* Call user error callback */
-            HAL_UART_ErrorCallback(huart);
-          }
-        }
-        else
-        {
-          /* Call user error callback */
-          HAL_UART_ErrorCallback(huart);
-        }
-      }
-      else
-      {
-        /* Non Blocking error : transfer could go on.
-           Error is notified to user through user error callback */
-        HAL_UART_ErrorCallback(huart);
-        huart->ErrorCode = HAL_UART_ERROR_NONE;
-      }
-    }
-    return;
-  } /* End if some error occurs */
+    /* Enable the line idle interrupt used to flush bursts to the reader */
+    ATOMIC_SET_BIT(huart->Instance->CR1, USART_CR1_IDLEIE);
 
-  /* UART in mode Transmitter ------------------------------------------------*/
-  if(((isrflags & USART_SR_TXE) != RESET) && ((cr1its & USART_CR1_TXEIE) != RESET))
-  {
-    UART_Transmit_IT(huart);
-    return;
-  }
+    /* Enable the DMA transfer for the receiver request by setting the DMAR bit
+    in the UART CR3 register */
+    ATOMIC_SET_BIT(huart->Instance->CR3, USART_CR3_DMAR);
 
-  /* UART in mode Transmitter end --------------------------------------------*/
-  if(((isrflags & USART_SR_TC) != RESET) && ((cr1its & USART_CR1_TCIE) != RESET))
+    return HAL_OK;
+  }
+  else
   {
-    UART_EndTransmit_IT(huart);
-    return;
+    return HAL_BUSY;
   }
 }
 
 /**
-  * @brief  Tx Transfer completed callbacks.
-  * @param  huart: pointer to a UART_HandleTypeDef structure that contains
-  *                the configuration information for the specified UART module.
-  * @retval None
+  * @brief  Stop an ongoing ring buffer reception.
+  * @note   The write index is resynchronised one last time, so the data received
+  *         before the call stays available to the reader.
+  * @param  huart Pointer to a UART_HandleTypeDef structure that contains
+  *               the configuration information for the specified UART module.
+  * @retval HAL status
   */
- __weak void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart)
+HAL_StatusTypeDef HAL_UARTEx_RingReceive_Stop(UART_HandleTypeDef *huart)
 {
-  /* Prevent unused argument(s) compilation warning */
-  UNUSED(huart);
-  /* NOTE: This function Should not be modified, when the callback is needed,
-           the HAL_UART_TxCpltCallback could be implemented in the user file
-   */
-}
+  if(huart->pRxRing == NULL)
+  {
+    return HAL_ERROR;
+  }
 
-/**
-  * @brief  Tx Half Transfer completed callbacks.
-  * @param  huart: pointer to a UART_HandleTypeDef structure that contains
-  *                the configuration information for the specified UART module.
-  * @retval None
-  */
- __weak void HAL_UART_TxHalfCpltCallback(UART_HandleTypeDef *huart)
-{
-  /* Prevent unused argument(s) compilation warning */
-  UNUSED(huart);
-  /* NOTE: This function Should not be modified, when the callback is needed,
-           the HAL_UART_TxCpltCallback could be implemented in the user file
-   */
-}
+  /* Interrupt mode ring: the write index is always up to date */
+  if(huart->RxState == HAL_UART_STATE_BUSY)
+  {
+    UART_EndRxTransfer(huart);
 
-/**
-  * @brief  Rx Transfer completed callbacks.
-  * @param  huart: pointer to a UART_HandleTypeDef structure that contains
-  *                the configuration information for the specified UART module.
-  * @retval None
-  */
-__weak void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart)
-{
-  /* Prevent unused argument(s) compilation warning */
-  UNUSED(huart);
-  /* NOTE: This function Should not be modified, when the callback is needed,
-           the HAL_UART_TxCpltCallback could be implemented in the user file
-   */
+    return HAL_OK;
+  }
+
+  /* Stop new Rx DMA requests and line idle notifications */
+  ATOMIC_CLEAR_BIT(huart->Instance->CR1, USART_CR1_IDLEIE);
+  ATOMIC_CLEAR_BIT(huart->Instance->CR3, USART_CR3_DMAR);
+
+  /* Publish the data written so far before the DMA is disabled */
+  HAL_UARTEx_RingReceive_Update(huart);
+
+  /* Abort the UART DMA Rx stream : use blocking DMA Abort API (no callback) */
+  huart->hdmarx->XferAbortCallback = NULL;
+  if(HAL_DMA_Abort(huart->hdmarx) != HAL_OK)
+  {
+    if(HAL_DMA_GetError(huart->hdmarx) == HAL_DMA_ERROR_TIMEOUT)
+    {
+      /* Set error code to DMA */
+      huart->ErrorCode = HAL_UART_ERROR_DMA;
+
+      return HAL_TIMEOUT;
+    }
+  }
+
+  UART_EndRxTransfer(huart);
+
+  return HAL_OK;
 }
 
 /**
-  * @brief  Rx Half Transfer completed callbacks.
-  * @param  huart: pointer to a UART_HandleTypeDef structure that contains
-  *                the configuration information for the specified UART module.
-  * @retval None
+  * @brief  Start a ring buffer reception in interrupt mode.
+  * @note   Each received byte is stored at the write index by a lean interrupt
+  *         handler which only tests the RXNE and IDLE flags, the line errors
+  *         being taken on a slow path. HAL_UARTEx_RingRxEventCallback() is
+  *         executed when the line goes idle.
+  * @note   Line errors are reported through HAL_UART_ErrorCallback() and the
+  *         reception goes on. The byte received with a noise, framing or parity
+  *         error is dropped. A reader that falls behind by more than Size bytes
+  *         loses the oldest data and Overrun is incremented.
+  * @note   The ring holds bytes: 9-bit data without parity is not supported.
+  * @param  huart Pointer to a UART_HandleTypeDef structure that contains
+  *               the configuration information for the specified UART module.
+  * @param  pRing Pointer to the ring descriptor, owned by the application.
+  * @param  pData Pointer to the ring storage.
+  * @param  Size  Size of the ring storage, must be a power of two.
+  * @retval HAL status
   */
-__weak void HAL_UART_RxHalfCpltCallback(UART_HandleTypeDef *huart)
+HAL_StatusTypeDef HAL_UARTEx_RingReceive_IT(UART_HandleTypeDef *huart, UART_RingTypeDef *pRing, uint8_t *pData, uint16_t Size)
 {
-  /* Prevent unused argument(s) compilation warning */
-  UNUSED(huart);
+  /* Check that a Rx process is not already ongoing */
+  if(huart->RxState == HAL_UART_STATE_READY)
+  {
+    if((pRing == NULL) || (pData == NULL) || (Size == 0U) || ((Size & (Size - 1U)) != 0U))
+    {
+      return HAL_ERROR;
+    }
+
+    if((huart->Init.WordLength == UART_WORDLENGTH_9B) && (huart->Init.Parity == UART_PARITY_NONE))
+    {
+      return HAL_ERROR;
+    }
+
+    /* Process Locked */
+    __HAL_LOCK(huart);
+
+    pRing->pBuffer = pData;
+    pRing->Mask    = (uint32_t)Size - 1U;
+    pRing->Head    = 0U;
+    pRing->Tail    = 0U;
+    pRing->Overrun = 0U;
+
+    huart->pRxBuffPtr = pData;
+    huart->RxXferSize = Size;
+    huart->pRxRing    = pRing;
+
+    huart->ErrorCode = HAL_UART_ERROR_NONE;
+
+    /* The ring is served by its lean handler only: UART_Receive_IT() must not touch it */
+    huart->RxState = HAL_UART_STATE_BUSY;
+    UART_RingSetIRQHandler(huart);
+
+    /* Clear the Overrun and Idle flags just before enabling the interrupts */
+    __HAL_UART_CLEAR_OREFLAG(huart);
+
+    /* Process Unlocked */
+    __HAL_UNLOCK(huart);
+
+    /* Enable the UART Parity Error Interrupt */
+    if(huart->Init.Parity != UART_PARITY_NONE)
+    {
+      ATOMIC_SET_BIT(huart->Instance->CR1, USART_CR1_PEIE);
+    }
+
+    /* Enable the UART Error Interrupt: (Frame error, noise error, overrun error) */
+    ATOMIC_SET_BIT(huart->Instance->CR3, USART_CR3_EIE);
+
+    /* Enable the UART Data Register not empty and line idle Interrupts */
+    ATOMIC_SET_BIT(huart->Instance->CR1, USART_CR1_RXNEIE | USART_CR1_IDLEIE);
+
+    return HAL_OK;
+  }
+  else
+  {
+    return HAL_BUSY;
+  }
+}
+
+/**
+  * @brief  Resynchronise the ring write index with the DMA remaining data counter.
+  * @note   Called by the driver on line idle, half transfer and transfer complete
+  *         events. It can also be called by the reader to pick up bytes received
+  *         since the last event without waiting for the line to go idle.
+  * @param  huart Pointer to a UART_HandleTypeDef structure that contains
+  *               the configuration information for the specified UART module.
+  * @retval None
+  */
+void HAL_UARTEx_RingReceive_Update(UART_HandleTypeDef *huart)
+{
+  UART_RingTypeDef *pRing = huart->pRxRing;
+  uint32_t primask_bit;
+  uint32_t position;
+  uint32_t head;
+
+  /* In interrupt mode the write index is always up to date */
+  if((pRing != NULL) && (huart->RxState == HAL_UART_STATE_BUSY_RX))
+  {
+    /* The update can be entered concurrently from the UART IRQ, the DMA IRQ and
+       the reader: keep the read-modify-write of Head atomic */
+    primask_bit = __get_PRIMASK();
+    __disable_irq();
+
+    position = ((uint32_t)huart->RxXferSize - __HAL_DMA_GET_COUNTER(huart->hdmarx)) & pRing->Mask;
+    head = pRing->Head;
+    head += (position - head) & pRing->Mask;
+    if((head - pRing->Tail) > (pRing->Mask + 1U))
+    {
+      pRing->Overrun++;
+    }
+    pRing->Head = head;
+
+    __set_PRIMASK(primask_bit);
+  }
+}
+
+/**
+  * @brief  Return the number of bytes waiting in the ring.
+  * @param  pRing Pointer to the ring descriptor.
+  * @retval Number of bytes available to the reader
+  */
+uint32_t HAL_UARTEx_Ring_GetCount(UART_RingTypeDef *pRing)
+{
+  uint32_t count = pRing->Head - pRing->Tail;
+
+  /* Bytes overwritten by the DMA are not readable anymore */
+  if(count > (pRing->Mask + 1U))
+  {
+    count = pRing->Mask + 1U;
+  }
+
+  return count;
+}
+
+/**
+  * @brief  Get direct access to the oldest bytes waiting in the ring.
+  * @note   Only the contiguous part up to the end of the storage is returned: when
+  *         the waiting data wraps around, a second call after
+  *         HAL_UARTEx_Ring_Release() returns the remainder.
+  * @param  pRing  Pointer to the ring descriptor.
+  * @param  ppData Filled with a pointer to the oldest waiting byte.
+  * @retval Number of contiguous bytes readable at *ppData
+  */
+uint32_t HAL_UARTEx_Ring_GetData(UART_RingTypeDef *pRing, uint8_t **ppData)
+{
+  uint32_t head = pRing->Head;
+  uint32_t tail = pRing->Tail;
+  uint32_t size = pRing->Mask + 1U;
+  uint32_t count;
+
+  /* The writer overtook the reader: skip the overwritten bytes */
+  if((head - tail) > size)
+  {
+    tail = head - size;
+    pRing->Tail = tail;
+  }
+
+  count = head - tail;
+  if(count > (size - (tail & pRing->Mask)))
+  {
+    count = size - (tail & pRing->Mask);
+  }
+
+  *ppData = &pRing->pBuffer[tail & pRing->Mask];
+  return count;
+}
+
+/**
+  * @brief  Hand bytes obtained with HAL_UARTEx_Ring_GetData() back to the driver.
+  * @param  pRing Pointer to the ring descriptor.
+  * @param  Count Number of bytes consumed by the reader.
+  * @retval None
+  */
+void HAL_UARTEx_Ring_Release(UART_RingTypeDef *pRing, uint32_t Count)
+{
+  pRing->Tail += Count;
+}
+
+/**
+  * @brief  Start a ring buffer transmission in interrupt mode.
+  * @note   The ring is empty once started: the data is queued with
+  *         HAL_UARTEx_RingTransmit_Write(). A lean interrupt handler sends one
+  *         byte per TXE interrupt and disables the TXE interrupt when the ring
+  *         is drained.
+  * @note   It can run together with a ring reception started with
+  *         HAL_UARTEx_RingReceive_IT() or HAL_UARTEx_RingReceive_DMA().
+  * @note   The ring holds bytes: 9-bit data without parity is not supported.
+  * @param  huart Pointer to a UART_HandleTypeDef structure that contains
+  *               the configuration information for the specified UART module.
+  * @param  pRing Pointer to the ring descriptor, owned by the application.
+  * @param  pData Pointer to the ring storage.
+  * @param  Size  Size of the ring storage, must be a power of two.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UARTEx_RingTransmit_IT(UART_HandleTypeDef *huart, UART_RingTypeDef *pRing, uint8_t *pData, uint16_t Size)
+{
+  /* Check that a Tx process is not already ongoing */
+  if(huart->gState == HAL_UART_STATE_READY)
+  {
+    if((pRing == NULL) || (pData == NULL) || (Size == 0U) || ((Size & (Size - 1U)) != 0U))
+    {
+      return HAL_ERROR;
+    }
+
+    if((huart->Init.WordLength == UART_WORDLENGTH_9B) && (huart->Init.Parity == UART_PARITY_NONE))
+    {
+      return HAL_ERROR;
+    }
+
+    /* Process Locked */
+    __HAL_LOCK(huart);
+
+    pRing->pBuffer = pData;
+    pRing->Mask    = (uint32_t)Size - 1U;
+    pRing->Head    = 0U;
+    pRing->Tail    = 0U;
+    pRing->Overrun = 0U;
+
+    huart->pTxRing = pRing;
+    huart->ErrorCode = HAL_UART_ERROR_NONE;
+
+    /* The ring is served by its lean handler only: UART_Transmit_IT() must not touch it */
+    huart->gState = HAL_UART_STATE_BUSY;
+    UART_RingSetIRQHandler(huart);
+
+    /* Process Unlocked */
+    __HAL_UNLOCK(huart);
+
+    return HAL_OK;
+  }
+  else
+  {
+    return HAL_BUSY;
+  }
+}
+
+/**
+  * @brief  Queue data in the transmission ring.
+  * @note   The data that does not fit in the free space of the ring is not
+  *         queued. There must be a single writer context.
+  * @param  huart Pointer to a UART_HandleTypeDef structure that contains
+  *               the configuration information for the specified UART module.
+  * @param  pData Pointer to the data to send.
+  * @param  Size  Number of bytes to send.
+  * @retval Number of bytes queued
+  */
+uint32_t HAL_UARTEx_RingTransmit_Write(UART_HandleTypeDef *huart, const uint8_t *pData, uint32_t Size)
+{
+  UART_RingTypeDef *pRing = huart->pTxRing;
+  uint32_t head;
+  uint32_t count;
+  uint32_t index;
+
+  if((pRing == NULL) || (huart->gState != HAL_UART_STATE_BUSY))
+  {
+    return 0U;
+  }
+
+  head = pRing->Head;
+  count = (pRing->Mask + 1U) - (head - pRing->Tail);
+  if(count > Size)
+  {
+    count = Size;
+  }
+
+  for(index = 0U; index < count; index++)
+  {
+    pRing->pBuffer[(head + index) & pRing->Mask] = pData[index];
+  }
+
+  if(count != 0U)
+  {
+    /* Publish the data before the handler can see it */
+    pRing->Head = head + count;
+
+    /* Enable the UART Transmit data register empty Interrupt */
+    ATOMIC_SET_BIT(huart->Instance->CR1, USART_CR1_TXEIE);
+  }
+
+  return count;
+}
+
+/**
+  * @brief  Stop an ongoing ring buffer transmission.
+  * @note   The bytes not sent yet are discarded: wait for HAL_UARTEx_Ring_GetCount()
+  *         to return 0 and for the TC flag to stop after the last byte.
+  * @param  huart Pointer to a UART_HandleTypeDef structure that contains
+  *               the configuration information for the specified UART module.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UARTEx_RingTransmit_Stop(UART_HandleTypeDef *huart)
+{
+  if(huart->pTxRing == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Disable the UART Transmit data register empty Interrupt */
+  ATOMIC_CLEAR_BIT(huart->Instance->CR1, USART_CR1_TXEIE);
+
+  huart->pTxRing = NULL;
+
+  /* Restore huart->gState to Ready */
+  huart->gState = HAL_UART_STATE_READY;
+
+  /* A reception ring, if any, keeps its interrupt handler */
+  UART_RingSetIRQHandler(huart);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  This function handles UART interrupt request.
+  * @note   When a ring service is active, the request is forwarded to the lean
+  *         handler of its mode.
+  * @param  huart: pointer to a UART_HandleTypeDef structure that contains
+  *                the configuration information for the specified UART module.
+  * @retval None
+  */
+__HOT_RAM_FUNC void HAL_UART_IRQHandler(UART_HandleTypeDef *huart)
+{
+  if(huart->IRQHandler != NULL)
+  {
+    huart->IRQHandler(huart);
+  }
+  else
+  {
+    UART_DefaultIRQHandler(huart);
+  }
+}
+
+/**
+  * @brief  Serves all the UART interrupt flags.
+  * @param  huart: pointer to a UART_HandleTypeDef structure that contains
+  *                the configuration information for the specified UART module.
+  * @retval None
+  */
+static __HOT_RAM_FUNC void UART_DefaultIRQHandler(UART_HandleTypeDef *huart)
+{
+   uint32_t isrflags   = READ_REG(huart->Instance->SR);
+   uint32_t cr1its     = READ_REG(huart->Instance->CR1);
+   uint32_t cr3its     = READ_REG(huart->Instance->CR3);
+   uint32_t errorflags = 0x00U;
+   uint32_t dmarequest = 0x00U;
+
+  __HAL_PROF_ENTER(HAL_PROF_ID_UART_IRQ);
+
+  /* UART in ring buffer reception mode, line idle --------------------------*/
+  if(((isrflags & USART_SR_IDLE) != RESET) && ((cr1its & USART_CR1_IDLEIE) != RESET) && (huart->pRxRing != NULL))
+  {
+    __HAL_UART_CLEAR_IDLEFLAG(huart);
+    if(huart->RxState == HAL_UART_STATE_BUSY_RX)
+    {
+      HAL_UARTEx_RingReceive_Update(huart);
+      HAL_UARTEx_RingRxEventCallback(huart);
+    }
+    else
+    {
+      /* Reception was aborted through the generic abort services */
+      ATOMIC_CLEAR_BIT(huart->Instance->CR1, USART_CR1_IDLEIE);
+      huart->pRxRing = NULL;
+    }
+  }
+
+  /* If no error occurs */
+  errorflags = (isrflags & (uint32_t)(USART_SR_PE | USART_SR_FE | USART_SR_ORE | USART_SR_NE));
+  if(errorflags == RESET)
+  {
+    /* UART in mode Receiver -------------------------------------------------*/
+    if(((isrflags & USART_SR_RXNE) != RESET) && ((cr1its & USART_CR1_RXNEIE) != RESET))
+    {
+      UART_Receive_IT(huart);
+      __HAL_PROF_EXIT(HAL_PROF_ID_UART_IRQ);
+      return;
+    }
+  }
+
+  /* If some errors occur */
+  if((errorflags != RESET) && (((cr3its & USART_CR3_EIE) != RESET) || ((cr1its & (USART_CR1_RXNEIE | USART_CR1_PEIE)) != RESET)))
+  {
+    /* UART parity error interrupt occurred ----------------------------------*/
+    if(((isrflags & USART_SR_PE) != RESET) && ((cr1its & USART_CR1_PEIE) != RESET))
+    {
+      huart->ErrorCode |= HAL_UART_ERROR_PE;
+    }
+
+    /* UART noise error interrupt occurred -----------------------------------*/
+    if(((isrflags & USART_SR_NE) != RESET) && ((cr3its & USART_CR3_EIE) != RESET))
+    {
+      huart->ErrorCode |= HAL_UART_ERROR_NE;
+    }
+
+    /* UART frame error interrupt occurred -----------------------------------*/
+    if(((isrflags & USART_SR_FE) != RESET) && ((cr3its & USART_CR3_EIE) != RESET))
+    {
+      huart->ErrorCode |= HAL_UART_ERROR_FE;
+    }
+
+    /* UART Over-Run interrupt occurred --------------------------------------*/
+    if(((isrflags & USART_SR_ORE) != RESET) && ((cr3its & USART_CR3_EIE) != RESET))
+    {
+      huart->ErrorCode |= HAL_UART_ERROR_ORE;
+    }
+
+    /* Call UART Error Call back function if need be --------------------------*/
+    if(huart->ErrorCode != HAL_UART_ERROR_NONE)
+    {
+      /* UART in mode Receiver -----------------------------------------------*/
+      if(((isrflags & USART_SR_RXNE) != RESET) && ((cr1its & USART_CR1_RXNEIE) != RESET))
+      {
+        UART_Receive_IT(huart);
+      }
+
+      /* If Overrun error occurs, or if any error occurs in DMA mode reception,
+         consider error as blocking */
+      dmarequest = HAL_IS_BIT_SET(huart->Instance->CR3, USART_CR3_DMAR);
+      if(((huart->ErrorCode & HAL_UART_ERROR_ORE) != RESET) || dmarequest)
+      {
+        /* Blocking error : transfer is aborted
+           Set the UART state ready to be able to start again the process,
+           Disable Rx Interrupts, and disable Rx DMA request, if ongoing */
+        UART_EndRxTransfer(huart);
+
+        /* Disable the UART DMA Rx request if enabled */
+        if(HAL_IS_BIT_SET(huart->Instance->CR3, USART_CR3_DMAR))
+        {
+          ATOMIC_CLEAR_BIT(huart->Instance->CR3, USART_CR3_DMAR);
+
+          /* Abort the UART DMA Rx channel */
+          if(huart->hdmarx != NULL)
+          {
+            /* Set the UART DMA Abort callback :
+               will lead to call HAL_UART_ErrorCallback() at end of DMA abort procedure */
+            huart->hdmarx->XferAbortCallback = UART_DMAAbortOnError;
+            if(HAL_DMA_Abort_IT(huart->hdmarx) != HAL_OK)
+            {
+              /* Call Directly XferAbortCallback function in case of error */
+              huart->hdmarx->XferAbortCallback(huart->hdmarx);
+            }
+          }
+          else
+          {
+            /* Call user error callback */
+            HAL_UART_ErrorCallback(huart);
+          }
+        }
+        else
+        {
+          /* Call user error callback */
+          HAL_UART_ErrorCallback(huart);
+        }
+      }
+      else
+      {
+        /* Non Blocking error : transfer could go on.
+           Error is notified to user through user error callback */
+        HAL_UART_ErrorCallback(huart);
+        huart->ErrorCode = HAL_UART_ERROR_NONE;
+      }
+    }
+    __HAL_PROF_EXIT(HAL_PROF_ID_UART_IRQ);
+    return;
+  } /* End if some error occurs */
+
+  /* UART in mode Transmitter ------------------------------------------------*/
+  if(((isrflags & USART_SR_TXE) != RESET) && ((cr1its & USART_CR1_TXEIE) != RESET))
+  {
+    UART_Transmit_IT(huart);
+    __HAL_PROF_EXIT(HAL_PROF_ID_UART_IRQ);
+    return;
+  }
+
+  /* UART in mode Transmitter end --------------------------------------------*/
+  if(((isrflags & USART_SR_TC) != RESET) && ((cr1its & USART_CR1_TCIE) != RESET))
+  {
+    UART_EndTransmit_IT(huart);
+    __HAL_PROF_EXIT(HAL_PROF_ID_UART_IRQ);
+    return;
+  }
+
+  __HAL_PROF_EXIT(HAL_PROF_ID_UART_IRQ);
+}
+
+/**
+  * @brief  Tx Transfer completed callbacks.
+  * @param  huart: pointer to a UART_HandleTypeDef structure that contains
+  *                the configuration information for the specified UART module.
+  * @retval None
+  */
+ __weak void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(huart);
+  /* NOTE: This function Should not be modified, when the callback is needed,
+           the HAL_UART_TxCpltCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Tx Half Transfer completed callbacks.
+  * @param  huart: pointer to a UART_HandleTypeDef structure that contains
+  *                the configuration information for the specified UART module.
+  * @retval None
+  */
+ __weak void HAL_UART_TxHalfCpltCallback(UART_HandleTypeDef *huart)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(huart);
+  /* NOTE: This function Should not be modified, when the callback is needed,
+           the HAL_UART_TxCpltCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Rx Transfer completed callbacks.
+  * @param  huart: pointer to a UART_HandleTypeDef structure that contains
+  *                the configuration information for the specified UART module.
+  * @retval None
+  */
+__weak void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(huart);
+  /* NOTE: This function Should not be modified, when the callback is needed,
+           the HAL_UART_TxCpltCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Rx Half Transfer completed callbacks.
+  * @param  huart: pointer to a UART_HandleTypeDef structure that contains
+  *                the configuration information for the specified UART module.
+  * @retval None
+  */
+__weak void HAL_UART_RxHalfCpltCallback(UART_HandleTypeDef *huart)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(huart);
   /* NOTE: This function Should not be modified, when the callback is needed,
            the HAL_UART_TxCpltCallback could be implemented in the user file
    */
@@ -1762,6 +2396,23 @@ __weak void HAL_UART_AbortReceiveCpltCallback (UART_HandleTypeDef *huart)
    */
 }
 
+/**
+  * @brief  UART ring buffer reception event callback.
+  * @note   Called each time new data has been published in the ring, i.e. on line
+  *         idle, half transfer and transfer complete events.
+  * @param  huart UART handle.
+  * @retval None
+  */
+__weak void HAL_UARTEx_RingRxEventCallback(UART_HandleTypeDef *huart)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(huart);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_UARTEx_RingRxEventCallback can be implemented in the user file.
+   */
+}
+
 /**
   * @}
   */
@@ -1800,7 +2451,7 @@ HAL_StatusTypeDef HAL_LIN_SendBreak(UART_HandleTypeDef *huart)
   huart->gState = HAL_UART_STATE_BUSY;
 
   /* Send break characters */
-  SET_BIT(huart->Instance->CR1, USART_CR1_SBK);
+  ATOMIC_SET_BIT(huart->Instance->CR1, USART_CR1_SBK);
 
   huart->gState = HAL_UART_STATE_READY;
 
@@ -1827,7 +2478,7 @@ HAL_StatusTypeDef HAL_MultiProcessor_EnterMuteMode(UART_HandleTypeDef *huart)
   huart->gState = HAL_UART_STATE_BUSY;
 
   /* Enable the USART mute mode  by setting the RWU bit in the CR1 register */
-  SET_BIT(huart->Instance->CR1, USART_CR1_RWU);
+  ATOMIC_SET_BIT(huart->Instance->CR1, USART_CR1_RWU);
 
   huart->gState = HAL_UART_STATE_READY;
 
@@ -1854,7 +2505,7 @@ HAL_StatusTypeDef HAL_MultiProcessor_ExitMuteMode(UART_HandleTypeDef *huart)
   huart->gState = HAL_UART_STATE_BUSY;
 
   /* Disable the USART mute mode by clearing the RWU bit in the CR1 register */
-  CLEAR_BIT(huart->Instance->CR1, USART_CR1_RWU);
+  ATOMIC_CLEAR_BIT(huart->Instance->CR1, USART_CR1_RWU);
 
   huart->gState = HAL_UART_STATE_READY;
 
@@ -2001,10 +2652,10 @@ static void UART_DMATransmitCplt(DMA_HandleTypeDef *hdma)
 
     /* Disable the DMA transfer for transmit request by setting the DMAT bit
        in the UART CR3 register */
-    CLEAR_BIT(huart->Instance->CR3, USART_CR3_DMAT);
+    ATOMIC_CLEAR_BIT(huart->Instance->CR3, USART_CR3_DMAT);
 
     /* Enable the UART Transmit Complete Interrupt */
-    SET_BIT(huart->Instance->CR1, USART_CR1_TCIE);
+    ATOMIC_SET_BIT(huart->Instance->CR1, USART_CR1_TCIE);
 
   }
   /* DMA Circular mode */
@@ -2014,6 +2665,45 @@ static void UART_DMATransmitCplt(DMA_HandleTypeDef *hdma)
   }
 }
 
+/**
+  * @brief  DMA UART scatter-gather transmit fragment complete callback.
+  * @param  hdma: DMA handle
+  * @retval None
+  */
+static void UART_DMATransmitFragCplt(DMA_HandleTypeDef *hdma)
+{
+  UART_HandleTypeDef* huart = ( UART_HandleTypeDef* )((DMA_HandleTypeDef* )hdma)->Parent;
+  const UART_TxFragmentTypeDef *frag;
+
+  if(huart->TxFragCount != 0U)
+  {
+    frag = huart->pTxFrag;
+    huart->pTxFrag++;
+    huart->TxFragCount--;
+
+    huart->pTxBuffPtr = frag->pData;
+    huart->TxXferSize = frag->Size;
+    huart->TxXferCount = frag->Size;
+
+    /* DMAT is left set: the pending TXE request restarts the stream at once */
+    if(HAL_DMA_Start_IT(hdma, (uint32_t)frag->pData, (uint32_t)&huart->Instance->DR, frag->Size) != HAL_OK)
+    {
+      huart->pTxFrag = NULL;
+      huart->TxFragCount = 0U;
+      huart->TxXferCount = 0U;
+      huart->ErrorCode |= HAL_UART_ERROR_DMA;
+      ATOMIC_CLEAR_BIT(huart->Instance->CR3, USART_CR3_DMAT);
+      UART_EndTxTransfer(huart);
+      HAL_UART_ErrorCallback(huart);
+    }
+  }
+  else
+  {
+    huart->pTxFrag = NULL;
+    UART_DMATransmitCplt(hdma);
+  }
+}
+
 /**
   * @brief DMA UART transmit process half complete callback
   * @param  hdma: pointer to a DMA_HandleTypeDef structure that contains
@@ -2041,12 +2731,12 @@ static void UART_DMAReceiveCplt(DMA_HandleTypeDef *hdma)
     huart->RxXferCount = 0U;
 
     /* Disable RXNE, PE and ERR (Frame error, noise error, overrun error) interrupts */
-    CLEAR_BIT(huart->Instance->CR1, USART_CR1_PEIE);
-    CLEAR_BIT(huart->Instance->CR3, USART_CR3_EIE);
+    ATOMIC_CLEAR_BIT(huart->Instance->CR1, USART_CR1_PEIE);
+    ATOMIC_CLEAR_BIT(huart->Instance->CR3, USART_CR3_EIE);
 
     /* Disable the DMA transfer for the receiver request by setting the DMAR bit
        in the UART CR3 register */
-    CLEAR_BIT(huart->Instance->CR3, USART_CR3_DMAR);
+    ATOMIC_CLEAR_BIT(huart->Instance->CR3, USART_CR3_DMAR);
 
     /* At end of Rx process, restore huart->RxState to Ready */
     huart->RxState = HAL_UART_STATE_READY;
@@ -2067,6 +2757,19 @@ static void UART_DMARxHalfCplt(DMA_HandleTypeDef *hdma)
   HAL_UART_RxHalfCpltCallback(huart);
 }
 
+/**
+  * @brief  DMA UART ring buffer reception half/full transfer callback.
+  * @param  hdma DMA handle.
+  * @retval None
+  */
+static void UART_DMARingRxEvent(DMA_HandleTypeDef *hdma)
+{
+  UART_HandleTypeDef *huart = (UART_HandleTypeDef *)((DMA_HandleTypeDef *)hdma)->Parent;
+
+  HAL_UARTEx_RingReceive_Update(huart);
+  HAL_UARTEx_RingRxEventCallback(huart);
+}
+
 /**
   * @brief  DMA UART communication error callback.
   * @param  hdma: DMA handle
@@ -2112,14 +2815,17 @@ static HAL_StatusTypeDef UART_WaitOnFlagUntilTimeout(UART_HandleTypeDef *huart,
   /* Wait until flag is set */
   while((__HAL_UART_GET_FLAG(huart, Flag) ? SET : RESET) == Status)
   {
+    /* Let the application yield or sleep while waiting */
+    HAL_WaitHook(HAL_WAIT_UART, huart);
+
     /* Check for the Timeout */
     if(Timeout != HAL_MAX_DELAY)
     {
       if((Timeout == 0U)||((HAL_GetTick() - Tickstart ) > Timeout))
       {
         /* Disable TXE, RXNE, PE and ERR (Frame error, noise error, overrun error) interrupts for the interrupt process */
-        CLEAR_BIT(huart->Instance->CR1, (USART_CR1_RXNEIE | USART_CR1_PEIE | USART_CR1_TXEIE));
-        CLEAR_BIT(huart->Instance->CR3, USART_CR3_EIE);
+        ATOMIC_CLEAR_BIT(huart->Instance->CR1, (USART_CR1_RXNEIE | USART_CR1_PEIE | USART_CR1_TXEIE));
+        ATOMIC_CLEAR_BIT(huart->Instance->CR3, USART_CR3_EIE);
 
         huart->gState  = HAL_UART_STATE_READY;
         huart->RxState = HAL_UART_STATE_READY;
@@ -2143,7 +2849,7 @@ static HAL_StatusTypeDef UART_WaitOnFlagUntilTimeout(UART_HandleTypeDef *huart,
 static void UART_EndTxTransfer(UART_HandleTypeDef *huart)
 {
   /* Disable TXEIE and TCIE interrupts */
-  CLEAR_BIT(huart->Instance->CR1, (USART_CR1_TXEIE | USART_CR1_TCIE));
+  ATOMIC_CLEAR_BIT(huart->Instance->CR1, (USART_CR1_TXEIE | USART_CR1_TCIE));
 
   /* At end of Tx process, restore huart->gState to Ready */
   huart->gState = HAL_UART_STATE_READY;
@@ -2156,12 +2862,18 @@ static void UART_EndTxTransfer(UART_HandleTypeDef *huart)
   */
 static void UART_EndRxTransfer(UART_HandleTypeDef *huart)
 {
-  /* Disable RXNE, PE and ERR (Frame error, noise error, overrun error) interrupts */
-  CLEAR_BIT(huart->Instance->CR1, (USART_CR1_RXNEIE | USART_CR1_PEIE));
-  CLEAR_BIT(huart->Instance->CR3, USART_CR3_EIE);
+  /* Disable RXNE, PE, IDLE and ERR (Frame error, noise error, overrun error) interrupts */
+  ATOMIC_CLEAR_BIT(huart->Instance->CR1, (USART_CR1_RXNEIE | USART_CR1_PEIE | USART_CR1_IDLEIE));
+  ATOMIC_CLEAR_BIT(huart->Instance->CR3, USART_CR3_EIE);
+
+  /* Ring buffer reception, if any, is over */
+  huart->pRxRing = NULL;
 
   /* At end of Rx process, restore huart->RxState to Ready */
   huart->RxState = HAL_UART_STATE_READY;
+
+  /* A transmission ring, if any, keeps its interrupt handler */
+  UART_RingSetIRQHandler(huart);
 }
 
 /**
@@ -2303,7 +3015,7 @@ static void UART_DMARxOnlyAbortCallback(DMA_HandleTypeDef *hdma)
   *                the configuration information for the specified UART module.
   * @retval HAL status
   */
-static HAL_StatusTypeDef UART_Transmit_IT(UART_HandleTypeDef *huart)
+static __HOT_RAM_FUNC HAL_StatusTypeDef UART_Transmit_IT(UART_HandleTypeDef *huart)
 {
   uint16_t* tmp;
 
@@ -2331,10 +3043,10 @@ static HAL_StatusTypeDef UART_Transmit_IT(UART_HandleTypeDef *huart)
     if(--huart->TxXferCount == 0U)
     {
       /* Disable the UART Transmit Complete Interrupt */
-      CLEAR_BIT(huart->Instance->CR1, USART_CR1_TXEIE);
+      ATOMIC_CLEAR_BIT(huart->Instance->CR1, USART_CR1_TXEIE);
 
       /* Enable the UART Transmit Complete Interrupt */
-      SET_BIT(huart->Instance->CR1, USART_CR1_TCIE);
+      ATOMIC_SET_BIT(huart->Instance->CR1, USART_CR1_TCIE);
     }
     return HAL_OK;
   }
@@ -2350,10 +3062,10 @@ static HAL_StatusTypeDef UART_Transmit_IT(UART_HandleTypeDef *huart)
   *                the configuration information for the specified UART module.
   * @retval HAL status
   */
-static HAL_StatusTypeDef UART_EndTransmit_IT(UART_HandleTypeDef *huart)
+static __HOT_RAM_FUNC HAL_StatusTypeDef UART_EndTransmit_IT(UART_HandleTypeDef *huart)
 {
   /* Disable the UART Transmit Complete Interrupt */
-  CLEAR_BIT(huart->Instance->CR1, USART_CR1_TCIE);
+  ATOMIC_CLEAR_BIT(huart->Instance->CR1, USART_CR1_TCIE);
 
   /* Tx process is ended, restore huart->gState to Ready */
   huart->gState = HAL_UART_STATE_READY;
@@ -2369,7 +3081,7 @@ static HAL_StatusTypeDef UART_EndTransmit_IT(UART_HandleTypeDef *huart)
   *                the configuration information for the specified UART module.
   * @retval HAL status
   */
-static HAL_StatusTypeDef UART_Receive_IT(UART_HandleTypeDef *huart)
+static __HOT_RAM_FUNC HAL_StatusTypeDef UART_Receive_IT(UART_HandleTypeDef *huart)
 {
   uint16_t* tmp;
 
@@ -2405,10 +3117,10 @@ static HAL_StatusTypeDef UART_Receive_IT(UART_HandleTypeDef *huart)
     if(--huart->RxXferCount == 0U)
     {
       /* Disable the UART Parity Error Interrupt and RXNE interrupt*/
-      CLEAR_BIT(huart->Instance->CR1, (USART_CR1_RXNEIE | USART_CR1_PEIE));
+      ATOMIC_CLEAR_BIT(huart->Instance->CR1, (USART_CR1_RXNEIE | USART_CR1_PEIE));
 
       /* Disable the UART Error Interrupt: (Frame error, noise error, overrun error) */
-      CLEAR_BIT(huart->Instance->CR3, USART_CR3_EIE);
+      ATOMIC_CLEAR_BIT(huart->Instance->CR3, USART_CR3_EIE);
 
       /* Rx process is completed, restore huart->RxState to Ready */
       huart->RxState = HAL_UART_STATE_READY;
@@ -2425,6 +3137,322 @@ static HAL_StatusTypeDef UART_Receive_IT(UART_HandleTypeDef *huart)
   }
 }
 
+/**
+  * @brief  Lean interrupt handler of the ring reception in DMA mode.
+  * @note   Only the line idle event is tested, the other flags are served by
+  *         the default handler.
+  * @param  huart: pointer to a UART_HandleTypeDef structure that contains
+  *                the configuration information for the specified UART module.
+  * @retval None
+  */
+static __HOT_RAM_FUNC void UART_RxRingDMA_IRQHandler(UART_HandleTypeDef *huart)
+{
+  if(((READ_REG(huart->Instance->SR) & USART_SR_IDLE) != 0U) && (huart->RxState == HAL_UART_STATE_BUSY_RX))
+  {
+    __HAL_UART_CLEAR_IDLEFLAG(huart);
+    HAL_UARTEx_RingReceive_Update(huart);
+    HAL_UARTEx_RingRxEventCallback(huart);
+
+    /* Slow path : a transmission is ongoing */
+    if(huart->gState != HAL_UART_STATE_READY)
+    {
+      UART_DefaultIRQHandler(huart);
+    }
+  }
+  else
+  {
+    UART_DefaultIRQHandler(huart);
+  }
+}
+
+/**
+  * @brief  Lean interrupt handler of the ring reception in interrupt mode.
+  * @note   Only the RXNE and IDLE flags are tested on the fast path.
+  * @param  huart: pointer to a UART_HandleTypeDef structure that contains
+  *                the configuration information for the specified UART module.
+  * @retval None
+  */
+static __HOT_RAM_FUNC void UART_RxRing_IRQHandler(UART_HandleTypeDef *huart)
+{
+  if(huart->RxState == HAL_UART_STATE_BUSY)
+  {
+    UART_RxRing_Receive(huart, READ_REG(huart->Instance->SR));
+
+    /* Slow path : a transmission is ongoing */
+    if(huart->gState != HAL_UART_STATE_READY)
+    {
+      UART_DefaultIRQHandler(huart);
+    }
+  }
+  else
+  {
+    UART_DefaultIRQHandler(huart);
+  }
+}
+
+/**
+  * @brief  Serves the RXNE and IDLE flags of the ring reception in interrupt mode.
+  * @param  huart: pointer to a UART_HandleTypeDef structure that contains
+  *                the configuration information for the specified UART module.
+  * @param  isrflags: Status register read by the interrupt handler.
+  * @retval None
+  */
+static __HOT_RAM_FUNC void UART_RxRing_Receive(UART_HandleTypeDef *huart, uint32_t isrflags)
+{
+  UART_RingTypeDef *pRing = huart->pRxRing;
+  uint32_t head;
+  uint8_t data;
+
+  if((isrflags & (USART_SR_PE | USART_SR_FE | USART_SR_NE | USART_SR_ORE)) != 0U)
+  {
+    /* Slow path : line error */
+    UART_RxRingError(huart, isrflags);
+  }
+  else if((isrflags & USART_SR_RXNE) != 0U)
+  {
+    /* Reading DR also clears the IDLE flag */
+    data = (uint8_t)huart->Instance->DR;
+    if((huart->Init.WordLength == UART_WORDLENGTH_8B) && (huart->Init.Parity != UART_PARITY_NONE))
+    {
+      data &= 0x7FU;
+    }
+
+    head = pRing->Head;
+    pRing->pBuffer[head & pRing->Mask] = data;
+    head++;
+    if((head - pRing->Tail) > (pRing->Mask + 1U))
+    {
+      pRing->Overrun++;
+    }
+    pRing->Head = head;
+  }
+  else if((isrflags & USART_SR_IDLE) != 0U)
+  {
+    __HAL_UART_CLEAR_IDLEFLAG(huart);
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+
+  if((isrflags & USART_SR_IDLE) != 0U)
+  {
+    HAL_UARTEx_RingRxEventCallback(huart);
+  }
+}
+
+/**
+  * @brief  Line error of the ring reception in interrupt mode.
+  * @note   The error is not blocking : it is reported through HAL_UART_ErrorCallback()
+  *         and the reception goes on.
+  * @param  huart: pointer to a UART_HandleTypeDef structure that contains
+  *                the configuration information for the specified UART module.
+  * @param  isrflags: Status register read by the interrupt handler.
+  * @retval None
+  */
+static void UART_RxRingError(UART_HandleTypeDef *huart, uint32_t isrflags)
+{
+  UART_RingTypeDef *pRing = huart->pRxRing;
+  uint8_t data;
+
+  if((isrflags & USART_SR_PE) != 0U)
+  {
+    huart->ErrorCode |= HAL_UART_ERROR_PE;
+  }
+  if((isrflags & USART_SR_NE) != 0U)
+  {
+    huart->ErrorCode |= HAL_UART_ERROR_NE;
+  }
+  if((isrflags & USART_SR_FE) != 0U)
+  {
+    huart->ErrorCode |= HAL_UART_ERROR_FE;
+  }
+  if((isrflags & USART_SR_ORE) != 0U)
+  {
+    huart->ErrorCode |= HAL_UART_ERROR_ORE;
+  }
+
+  /* The status register read followed by the data register read clears the flags */
+  data = (uint8_t)huart->Instance->DR;
+
+  /* On overrun only, the byte held in DR is valid */
+  if((isrflags & (USART_SR_PE | USART_SR_FE | USART_SR_NE)) == 0U)
+  {
+    if((huart->Init.WordLength == UART_WORDLENGTH_8B) && (huart->Init.Parity != UART_PARITY_NONE))
+    {
+      data &= 0x7FU;
+    }
+    pRing->pBuffer[pRing->Head & pRing->Mask] = data;
+    if(((pRing->Head + 1U) - pRing->Tail) > (pRing->Mask + 1U))
+    {
+      pRing->Overrun++;
+    }
+    pRing->Head++;
+  }
+
+  HAL_UART_ErrorCallback(huart);
+  huart->ErrorCode = HAL_UART_ERROR_NONE;
+}
+
+/**
+  * @brief  Lean interrupt handler of the ring transmission in interrupt mode.
+  * @note   Only the TXE flag is tested on the fast path.
+  * @param  huart: pointer to a UART_HandleTypeDef structure that contains
+  *                the configuration information for the specified UART module.
+  * @retval None
+  */
+static __HOT_RAM_FUNC void UART_TxRing_IRQHandler(UART_HandleTypeDef *huart)
+{
+  if((huart->gState == HAL_UART_STATE_BUSY) && ((READ_REG(huart->Instance->SR) & USART_SR_TXE) != 0U))
+  {
+    UART_TxRing_Transmit(huart);
+
+    /* Slow path : a reception is ongoing */
+    if(huart->RxState != HAL_UART_STATE_READY)
+    {
+      UART_DefaultIRQHandler(huart);
+    }
+  }
+  else
+  {
+    UART_DefaultIRQHandler(huart);
+  }
+}
+
+/**
+  * @brief  Serves the TXE flag of the ring transmission.
+  * @param  huart: pointer to a UART_HandleTypeDef structure that contains
+  *                the configuration information for the specified UART module.
+  * @retval None
+  */
+static __HOT_RAM_FUNC void UART_TxRing_Transmit(UART_HandleTypeDef *huart)
+{
+  UART_RingTypeDef *pRing = huart->pTxRing;
+  uint32_t tail = pRing->Tail;
+
+  if(tail != pRing->Head)
+  {
+    huart->Instance->DR = (uint8_t)pRing->pBuffer[tail & pRing->Mask];
+    pRing->Tail = tail + 1U;
+  }
+  else
+  {
+    /* Ring drained : HAL_UARTEx_RingTransmit_Write() enables the interrupt again */
+    ATOMIC_CLEAR_BIT(huart->Instance->CR1, USART_CR1_TXEIE);
+  }
+}
+
+/**
+  * @brief  Lean interrupt handler of a ring reception and a ring transmission running together.
+  * @note   The status register is read once and both directions are served on the fast
+  *         path. The default handler is only called when one of the directions is no longer
+  *         served by its ring, after an abort.
+  * @param  huart: pointer to a UART_HandleTypeDef structure that contains
+  *                the configuration information for the specified UART module.
+  * @retval None
+  */
+static __HOT_RAM_FUNC void UART_RxTxRing_IRQHandler(UART_HandleTypeDef *huart)
+{
+  uint32_t isrflags = READ_REG(huart->Instance->SR);
+  uint32_t slowpath = 0U;
+
+  if(huart->RxState == HAL_UART_STATE_BUSY)
+  {
+    /* Reception ring in interrupt mode */
+    UART_RxRing_Receive(huart, isrflags);
+  }
+  else if((huart->RxState == HAL_UART_STATE_BUSY_RX) && (huart->pRxRing != NULL) &&
+          ((READ_REG(huart->Instance->CR3) & USART_CR3_EIE) == 0U))
+  {
+    /* Reception ring in DMA mode: only the line idle event needs the CPU. A generic
+       reception started after an abort of the ring enables the error interrupt. */
+    if((isrflags & USART_SR_IDLE) != 0U)
+    {
+      __HAL_UART_CLEAR_IDLEFLAG(huart);
+      HAL_UARTEx_RingReceive_Update(huart);
+      HAL_UARTEx_RingRxEventCallback(huart);
+    }
+  }
+  else
+  {
+    slowpath = 1U;
+  }
+
+  if(huart->gState == HAL_UART_STATE_BUSY)
+  {
+    if((isrflags & USART_SR_TXE) != 0U)
+    {
+      UART_TxRing_Transmit(huart);
+    }
+  }
+  else
+  {
+    slowpath = 1U;
+  }
+
+  /* Slow path : a direction was aborted or restarted out of its ring */
+  if(slowpath != 0U)
+  {
+    UART_DefaultIRQHandler(huart);
+  }
+}
+
+/**
+  * @brief  Select the interrupt handler entry matching the running ring services.
+  * @note   Called each time a ring service starts or stops, before the
+  *         corresponding interrupts are enabled or after they are disabled.
+  * @param  huart: pointer to a UART_HandleTypeDef structure that contains
+  *                the configuration information for the specified UART module.
+  * @retval None
+  */
+static void UART_RingSetIRQHandler(UART_HandleTypeDef *huart)
+{
+  uint32_t rxring = 0U;
+  uint32_t txring = 0U;
+
+  if(huart->pRxRing != NULL)
+  {
+    if(huart->RxState == HAL_UART_STATE_BUSY)
+    {
+      rxring = 1U;
+    }
+    else if(huart->RxState == HAL_UART_STATE_BUSY_RX)
+    {
+      rxring = 2U;
+    }
+    else
+    {
+      /* Reception ring aborted */
+    }
+  }
+
+  if((huart->pTxRing != NULL) && (huart->gState == HAL_UART_STATE_BUSY))
+  {
+    txring = 1U;
+  }
+
+  if((rxring != 0U) && (txring != 0U))
+  {
+    huart->IRQHandler = UART_RxTxRing_IRQHandler;
+  }
+  else if(rxring == 1U)
+  {
+    huart->IRQHandler = UART_RxRing_IRQHandler;
+  }
+  else if(rxring == 2U)
+  {
+    huart->IRQHandler = UART_RxRingDMA_IRQHandler;
+  }
+  else if(txring != 0U)
+  {
+    huart->IRQHandler = UART_TxRing_IRQHandler;
+  }
+  else
+  {
+    huart->IRQHandler = NULL;
+  }
+}
+
 /**
   * @brief  Configures the UART peripheral.
   * @param  huart: pointer to a UART_HandleTypeDef structure that contains
@@ -590,12 +590,15 @@ HAL_StatusTypeDef HAL_ADC_Stop_IT(ADC_HandleTypeDef* hadc);
 void              HAL_ADC_IRQHandler(ADC_HandleTypeDef* hadc);
 
 HAL_StatusTypeDef HAL_ADC_Start_DMA(ADC_HandleTypeDef* hadc, uint32_t* pData, uint32_t Length);
+HAL_StatusTypeDef HAL_ADC_StartDoubleBuffer_DMA(ADC_HandleTypeDef* hadc, uint32_t* pData0, uint32_t* pData1, uint32_t Length);
 HAL_StatusTypeDef HAL_ADC_Stop_DMA(ADC_HandleTypeDef* hadc);
 
 uint32_t          HAL_ADC_GetValue(ADC_HandleTypeDef* hadc);
 
 void       HAL_ADC_ConvCpltCallback(ADC_HandleTypeDef* hadc);
 void       HAL_ADC_ConvHalfCpltCallback(ADC_HandleTypeDef* hadc);
+void       HAL_ADC_ConvM0CpltCallback(ADC_HandleTypeDef* hadc);
+void       HAL_ADC_ConvM1CpltCallback(ADC_HandleTypeDef* hadc);
 void       HAL_ADC_LevelOutOfWindowCallback(ADC_HandleTypeDef* hadc);
 void       HAL_ADC_ErrorCallback(ADC_HandleTypeDef *hadc);
 /**
@@ -162,6 +162,8 @@
 #define  VDD_VALUE                    3300U /*!< Value of VDD in mv */
 #define  TICK_INT_PRIORITY            0x0FU /*!< tick interrupt priority */
 #define  USE_RTOS                     0U
+#define  USE_HAL_ATOMIC_LOCK          0U /*!< 1: handle lock safe between interrupt and thread */
+#define  USE_HAL_NO_LOCK              0U /*!< 1: handle lock compiled out, single context only */
 #define  PREFETCH_ENABLE              1U
 #define  ART_ACCLERATOR_ENABLE        1U /* To enable instruction cache and prefetch */
 
@@ -247,6 +249,15 @@
 
 #define USE_SPI_CRC                     1U
 
+/* ################## DMA peripheral configuration ########################## */
+
+/* STATISTICS FEATURE: Use to activate transfer statistics inside HAL DMA Driver
+* Activated: each DMA handle records transfer counters and DWT cycle timestamps
+* Deactivated: statistics code cleaned from driver
+*/
+
+#define USE_HAL_DMA_STATISTICS          0U
+
 /* Includes ------------------------------------------------------------------*/
 /**
   * @brief Include module's header file
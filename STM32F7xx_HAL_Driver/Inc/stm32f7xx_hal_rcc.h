@@ -1135,6 +1135,7 @@ typedef struct
 void HAL_RCC_DeInit(void);
 HAL_StatusTypeDef HAL_RCC_OscConfig(RCC_OscInitTypeDef *RCC_OscInitStruct);
 HAL_StatusTypeDef HAL_RCC_ClockConfig(RCC_ClkInitTypeDef *RCC_ClkInitStruct, uint32_t FLatency);
+HAL_StatusTypeDef HAL_RCC_ClockConfigAuto(RCC_ClkInitTypeDef *RCC_ClkInitStruct);
 /**
   * @}
   */
@@ -1152,6 +1153,7 @@ uint32_t HAL_RCC_GetPCLK1Freq(void);
 uint32_t HAL_RCC_GetPCLK2Freq(void);
 void     HAL_RCC_GetOscConfig(RCC_OscInitTypeDef *RCC_OscInitStruct);
 void     HAL_RCC_GetClockConfig(RCC_ClkInitTypeDef *RCC_ClkInitStruct, uint32_t *pFLatency);
+uint32_t HAL_RCC_GetOptimalFlashLatency(uint32_t HCLKFreq, uint32_t VoltageScaling);
 
 /* CSS NMI IRQ handler */
 void HAL_RCC_NMI_IRQHandler(void);
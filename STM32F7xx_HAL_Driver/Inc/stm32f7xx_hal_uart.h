@@ -215,6 +215,26 @@ typedef enum
   UART_CLOCKSOURCE_UNDEFINED  = 0x10U     /*!< Undefined clock source */
 }UART_ClockSourceTypeDef;
 
+/**
+  * @brief  UART Rx ring buffer structure definition
+  * @note   Head is only written by the driver and Tail only by the reader, so the
+  *         ring can be drained from thread context without disabling interrupts.
+  *         Both indexes are free running, the position in pBuffer is (index & Mask).
+  */
+typedef struct
+{
+  uint8_t                       *pBuffer;         /*!< Ring storage, owned by the application              */
+
+  uint32_t                      Mask;             /*!< Ring size minus one, the size is a power of two      */
+
+  __IO uint32_t                 Head;             /*!< Write index, updated by the driver from the DMA NDTR */
+
+  __IO uint32_t                 Tail;             /*!< Read index, updated by the reader                    */
+
+  __IO uint32_t                 Overrun;          /*!< Count of updates that found the reader overtaken     */
+
+}UART_RingTypeDef;
+
 /**
   * @brief  UART handle Structure definition
   */
@@ -255,6 +275,8 @@ typedef struct
 
   __IO uint32_t             ErrorCode;   /*!< UART Error code                    */
 
+  UART_RingTypeDef          *pRxRing;    /*!< Rx ring buffer, only set while a ring reception is ongoing */
+
 }UART_HandleTypeDef;
 
 /**
@@ -1153,6 +1175,15 @@ void HAL_UART_RxHalfCpltCallback(UART_HandleTypeDef *huart);
 void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart);
 void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart);
 
+/* Ring buffer reception functions */
+HAL_StatusTypeDef HAL_UARTEx_RingReceive_DMA(UART_HandleTypeDef *huart, UART_RingTypeDef *pRing, uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_UARTEx_RingReceive_Stop(UART_HandleTypeDef *huart);
+void              HAL_UARTEx_RingReceive_Update(UART_HandleTypeDef *huart);
+uint32_t          HAL_UARTEx_Ring_GetCount(UART_RingTypeDef *pRing);
+uint32_t          HAL_UARTEx_Ring_GetData(UART_RingTypeDef *pRing, uint8_t **ppData);
+void              HAL_UARTEx_Ring_Release(UART_RingTypeDef *pRing, uint32_t Count);
+void              HAL_UARTEx_RingRxEventCallback(UART_HandleTypeDef *huart);
+
 /**
   * @}
   */
@@ -47,6 +47,8 @@
           (+) Use HAL_DMA_Start_IT() to start DMA transfer after the configuration of
               Source address and destination address and the Length of data to be transferred. In this
               case the DMA interrupt is configured
+          (+) Use HAL_DMA_ReArm_IT() to restart a completed transfer with a new memory address and
+              Length of data, without the full reconfiguration done by HAL_DMA_Start_IT()
           (+) Use HAL_DMA_IRQHandler() called under DMA_IRQHandler() Interrupt subroutine
           (+) At the end of data transfer HAL_DMA_IRQHandler() function is executed and user can
               add his own function by customization of function pointer XferCpltCallback and
@@ -69,6 +71,15 @@
            and Destination. In this case the Peripheral Data Size will be applied to both Source
            and Destination.
 
+     *** DMA transfer statistics ***
+     ===============================
+     [..]
+       When USE_HAL_DMA_STATISTICS is set to 1U in the HAL configuration file, each handle
+       counts its transfers, moved bytes, errors and rejected start requests, and samples
+       DWT->CYCCNT at transfer start, interrupt entry and callback exit.
+      (+) HAL_DMA_GetStatistics(): get a pointer to the statistics of the handle
+      (+) HAL_DMA_ResetStatistics(): clear the counters and the maximum delays
+
      *** DMA HAL driver macros list ***
      =============================================
      [..]
@@ -144,6 +155,55 @@ typedef struct
   * @}
   */
 /* Private macros ------------------------------------------------------------*/
+#if defined(USE_HAL_DMA_STATISTICS) && (USE_HAL_DMA_STATISTICS == 1U)
+#define DMA_STATS_START(__HANDLE__, __LENGTH__)                                                               \
+  do{                                                                                                         \
+    (__HANDLE__)->Statistics.XferLength = (uint32_t)(__LENGTH__) <<                                           \
+                                          ((__HANDLE__)->Init.PeriphDataAlignment >> DMA_SxCR_PSIZE_Pos);    \
+    (__HANDLE__)->Statistics.StartCycle = DWT->CYCCNT;                                                        \
+  }while(0U)
+
+#define DMA_STATS_BUSY(__HANDLE__)      ((__HANDLE__)->Statistics.BusyCount++)
+
+#define DMA_STATS_IRQ_ENTRY(__HANDLE__) ((__HANDLE__)->Statistics.IrqEntryCycle = DWT->CYCCNT)
+
+/* In circular and double buffer modes the next lap starts with the interrupt */
+#define DMA_STATS_XFER_CPLT(__HANDLE__)                                                                       \
+  do{                                                                                                         \
+    uint32_t xfercycles = (__HANDLE__)->Statistics.IrqEntryCycle - (__HANDLE__)->Statistics.StartCycle;       \
+    (__HANDLE__)->Statistics.XferCount++;                                                                     \
+    (__HANDLE__)->Statistics.XferBytes += (__HANDLE__)->Statistics.XferLength;                                \
+    if(xfercycles > (__HANDLE__)->Statistics.MaxXferCycles)                                                   \
+    {                                                                                                         \
+      (__HANDLE__)->Statistics.MaxXferCycles = xfercycles;                                                    \
+    }                                                                                                         \
+    (__HANDLE__)->Statistics.StartCycle = (__HANDLE__)->Statistics.IrqEntryCycle;                             \
+  }while(0U)
+
+#define DMA_STATS_ERROR(__HANDLE__)                                                                           \
+  do{                                                                                                         \
+    (__HANDLE__)->Statistics.ErrorCount++;                                                                    \
+    (__HANDLE__)->Statistics.ErrorFlags |= (__HANDLE__)->ErrorCode;                                           \
+  }while(0U)
+
+#define DMA_STATS_IRQ_EXIT(__HANDLE__)                                                                        \
+  do{                                                                                                         \
+    uint32_t irqcycles;                                                                                       \
+    (__HANDLE__)->Statistics.CallbackExitCycle = DWT->CYCCNT;                                                 \
+    irqcycles = (__HANDLE__)->Statistics.CallbackExitCycle - (__HANDLE__)->Statistics.IrqEntryCycle;          \
+    if(irqcycles > (__HANDLE__)->Statistics.MaxIrqCycles)                                                     \
+    {                                                                                                         \
+      (__HANDLE__)->Statistics.MaxIrqCycles = irqcycles;                                                      \
+    }                                                                                                         \
+  }while(0U)
+#else
+#define DMA_STATS_START(__HANDLE__, __LENGTH__)
+#define DMA_STATS_BUSY(__HANDLE__)
+#define DMA_STATS_IRQ_ENTRY(__HANDLE__)
+#define DMA_STATS_XFER_CPLT(__HANDLE__)
+#define DMA_STATS_ERROR(__HANDLE__)
+#define DMA_STATS_IRQ_EXIT(__HANDLE__)
+#endif /* USE_HAL_DMA_STATISTICS */
 /* Private functions ---------------------------------------------------------*/
 /** @addtogroup DMA_Private_Functions
   * @{
@@ -436,6 +496,8 @@ HAL_StatusTypeDef HAL_DMA_Start(DMA_HandleTypeDef *hdma, uint32_t SrcAddress, ui
     /* Configure the source, destination address and the data length */
     DMA_SetConfig(hdma, SrcAddress, DstAddress, DataLength);
 
+    DMA_STATS_START(hdma, DataLength);
+
     /* Enable the Peripheral */
     __HAL_DMA_ENABLE(hdma);
   }
@@ -444,6 +506,9 @@ HAL_StatusTypeDef HAL_DMA_Start(DMA_HandleTypeDef *hdma, uint32_t SrcAddress, ui
     /* Process unlocked */
     __HAL_UNLOCK(hdma);
 
+    /* Account the rejected start request */
+    DMA_STATS_BUSY(hdma);
+
     /* Return error status */
     status = HAL_BUSY;
   }
@@ -483,6 +548,8 @@ HAL_StatusTypeDef HAL_DMA_Start_IT(DMA_HandleTypeDef *hdma, uint32_t SrcAddress,
     /* Configure the source, destination address and the data length */
     DMA_SetConfig(hdma, SrcAddress, DstAddress, DataLength);
 
+    DMA_STATS_START(hdma, DataLength);
+
     /* Clear all interrupt flags at correct offset within the register */
     regs->IFCR = 0x3FU << hdma->StreamIndex;
 
@@ -503,6 +570,9 @@ HAL_StatusTypeDef HAL_DMA_Start_IT(DMA_HandleTypeDef *hdma, uint32_t SrcAddress,
     /* Process unlocked */
     __HAL_UNLOCK(hdma);
 
+    /* Account the rejected start request */
+    DMA_STATS_BUSY(hdma);
+
     /* Return error status */
     status = HAL_BUSY;
   }
@@ -510,6 +580,76 @@ HAL_StatusTypeDef HAL_DMA_Start_IT(DMA_HandleTypeDef *hdma, uint32_t SrcAddress,
   return status;
 }
 
+/**
+  * @brief  Re-arms the DMA Transfer with interrupt enabled, keeping the
+  *         configuration of the previous HAL_DMA_Start_IT() call.
+  * @note   Only the memory address and the data length are written: the peripheral
+  *         address, the direction and all the other stream settings must still be
+  *         valid. The previous transfer must be completed (DMA state ready), so
+  *         circular mode is not supported, neither is double buffer mode.
+  * @note   Cycle budget: besides the handle lock and state updates, 3 register
+  *         writes (flag clear, M0AR, NDTR) and one read-modify-write of CR, plus
+  *         one of FCR in FIFO mode, that is about 25 to 30 CPU cycles with zero
+  *         wait state accesses.
+  * @param  hdma:       pointer to a DMA_HandleTypeDef structure that contains
+  *                     the configuration information for the specified DMA Stream.
+  * @param  MemAddress: The memory Buffer address
+  * @param  DataLength: The length of data to be transferred
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DMA_ReArm_IT(DMA_HandleTypeDef *hdma, uint32_t MemAddress, uint32_t DataLength)
+{
+  /* calculate DMA base and stream number */
+  DMA_Base_Registers *regs = (DMA_Base_Registers *)hdma->StreamBaseAddress;
+  uint32_t itflags = DMA_IT_TC | DMA_IT_TE | DMA_IT_DME;
+
+  /* Process locked */
+  __HAL_LOCK(hdma);
+
+  if(HAL_DMA_STATE_READY != hdma->State)
+  {
+    /* Process unlocked */
+    __HAL_UNLOCK(hdma);
+
+    /* Account the rejected start request */
+    DMA_STATS_BUSY(hdma);
+
+    /* Return error status */
+    return HAL_BUSY;
+  }
+
+  /* Change DMA peripheral state */
+  hdma->State = HAL_DMA_STATE_BUSY;
+
+  /* Initialize the error code */
+  hdma->ErrorCode = HAL_DMA_ERROR_NONE;
+
+  DMA_STATS_START(hdma, DataLength);
+
+  /* Clear all interrupt flags at correct offset within the register */
+  regs->IFCR = 0x3FU << hdma->StreamIndex;
+
+  /* Configure DMA Stream memory address and data length */
+  hdma->Instance->M0AR = MemAddress;
+  hdma->Instance->NDTR = DataLength;
+
+  if(hdma->XferHalfCpltCallback != NULL)
+  {
+    itflags |= DMA_IT_HT;
+  }
+
+  /* Enable the FIFO error interrupt, disabled if the previous transfer was aborted */
+  if(hdma->Init.FIFOMode != DMA_FIFOMODE_DISABLE)
+  {
+    hdma->Instance->FCR |= DMA_IT_FE;
+  }
+
+  /* Enable the interrupts disabled at the end of the previous transfer and the Peripheral */
+  MODIFY_REG(hdma->Instance->CR, DMA_IT_HT, itflags | DMA_SxCR_EN);
+
+  return HAL_OK;
+}
+
 /**
   * @brief  Aborts the DMA Transfer.
   * @param  hdma  : pointer to a DMA_HandleTypeDef structure that contains
@@ -608,6 +748,35 @@ HAL_StatusTypeDef HAL_DMA_Abort_IT(DMA_HandleTypeDef *hdma)
   return HAL_OK;
 }
 
+/**
+  * @brief  Aborts the DMA transfer started by HAL_DMA_Direct_Start().
+  * @note   The stream is disabled and the function waits until the ongoing data
+  *         transfer is completed, as required before the stream is programmed again.
+  *         No lock and no handle state update are done.
+  * @param  hdma  pointer to a DMA_HandleTypeDef structure that contains
+  *               the configuration information for the specified DMA Stream.
+  * @retval HAL status, HAL_TIMEOUT if the stream is still enabled after
+  *         HAL_TIMEOUT_DMA_ABORT
+  */
+HAL_StatusTypeDef HAL_DMA_Direct_Abort(DMA_HandleTypeDef *hdma)
+{
+  uint32_t tickstart = HAL_GetTick();
+
+  hdma->Instance->CR &= ~DMA_SxCR_EN;
+
+  /* Check if the DMA Stream is effectively disabled */
+  while((hdma->Instance->CR & DMA_SxCR_EN) != RESET)
+  {
+    /* Check for the Timeout */
+    if((HAL_GetTick() - tickstart) > HAL_TIMEOUT_DMA_ABORT)
+    {
+      return HAL_TIMEOUT;
+    }
+  }
+
+  return HAL_OK;
+}
+
 /**
   * @brief  Polling for transfer complete.
   * @param  hdma:          pointer to a DMA_HandleTypeDef structure that contains
@@ -766,6 +935,8 @@ void HAL_DMA_IRQHandler(DMA_HandleTypeDef *hdma)
 
   tmpisr = regs->ISR;
 
+  DMA_STATS_IRQ_ENTRY(hdma);
+
   /* Transfer Error Interrupt management ***************************************/
   if ((tmpisr & (DMA_FLAG_TEIF0_4 << hdma->StreamIndex)) != RESET)
   {
@@ -884,9 +1055,12 @@ void HAL_DMA_IRQHandler(DMA_HandleTypeDef *hdma)
         {
           hdma->XferAbortCallback(hdma);
         }
+        DMA_STATS_IRQ_EXIT(hdma);
         return;
       }
 
+      DMA_STATS_XFER_CPLT(hdma);
+
       if(((hdma->Instance->CR) & (uint32_t)(DMA_SxCR_DBM)) != RESET)
       {
         /* Current memory buffer used is Memory 0 */
@@ -935,6 +1109,8 @@ void HAL_DMA_IRQHandler(DMA_HandleTypeDef *hdma)
   /* manage error case */
   if(hdma->ErrorCode != HAL_DMA_ERROR_NONE)
   {
+    DMA_STATS_ERROR(hdma);
+
     if((hdma->ErrorCode & HAL_DMA_ERROR_TE) != RESET)
     {
       hdma->State = HAL_DMA_STATE_ABORT;
@@ -964,6 +1140,8 @@ void HAL_DMA_IRQHandler(DMA_HandleTypeDef *hdma)
       hdma->XferErrorCallback(hdma);
     }
   }
+
+  DMA_STATS_IRQ_EXIT(hdma);
 }
 
 /**
@@ -1137,6 +1315,42 @@ uint32_t HAL_DMA_GetError(DMA_HandleTypeDef *hdma)
   return hdma->ErrorCode;
 }
 
+#if defined(USE_HAL_DMA_STATISTICS) && (USE_HAL_DMA_STATISTICS == 1U)
+/**
+  * @brief  Return the transfer statistics of the DMA handle
+  * @param  hdma : pointer to a DMA_HandleTypeDef structure that contains
+  *              the configuration information for the specified DMA Stream.
+  * @note   The counters are updated by HAL_DMA_Start(), HAL_DMA_Start_IT(),
+  *         HAL_DMA_ReArm_IT() and HAL_DMA_IRQHandler(): they are read without
+  *         locking, a consistent snapshot requires the DMA interrupt to be masked.
+  * @retval Pointer to the statistics structure embedded in the handle
+  */
+const DMA_StatisticsTypeDef *HAL_DMA_GetStatistics(const DMA_HandleTypeDef *hdma)
+{
+  return &hdma->Statistics;
+}
+
+/**
+  * @brief  Reset the transfer statistics of the DMA handle
+  * @param  hdma : pointer to a DMA_HandleTypeDef structure that contains
+  *              the configuration information for the specified DMA Stream.
+  * @retval None
+  */
+void HAL_DMA_ResetStatistics(DMA_HandleTypeDef *hdma)
+{
+  /* XferLength and StartCycle describe the transfer in progress and are kept */
+  hdma->Statistics.XferCount         = 0U;
+  hdma->Statistics.XferBytes         = 0U;
+  hdma->Statistics.ErrorCount        = 0U;
+  hdma->Statistics.ErrorFlags        = HAL_DMA_ERROR_NONE;
+  hdma->Statistics.BusyCount         = 0U;
+  hdma->Statistics.IrqEntryCycle     = 0U;
+  hdma->Statistics.CallbackExitCycle = 0U;
+  hdma->Statistics.MaxXferCycles     = 0U;
+  hdma->Statistics.MaxIrqCycles      = 0U;
+}
+#endif /* USE_HAL_DMA_STATISTICS */
+
 /**
   * @}
   */
@@ -37,6 +37,8 @@
       (#)Initialize Ethernet DMA Descriptors in chain mode and point to allocated buffers:
           (##) HAL_ETH_DMATxDescListInit(); for Transmission process
           (##) HAL_ETH_DMARxDescListInit(); for Reception process
+          (##) or HAL_ETH_DMARxDescListAllocInit(); for Reception process directly
+               in application buffers (see below)
 
       (#)Enable MAC and DMA transmission and reception:
           (##) HAL_ETH_Start();
@@ -52,6 +54,19 @@
       (#) Get a received frame when an ETH RX interrupt occurs:
          (##) HAL_ETH_GetReceivedFrame_IT(); (called in IT mode only)
 
+      (#) Receive frames directly in application buffers (no copy):
+         (##) Register the buffer allocation function with HAL_ETH_RegisterRxAllocateCallback()
+              and the buffer linking function with HAL_ETH_RegisterRxLinkCallback(), or
+              implement the weak HAL_ETH_RxAllocateCallback() and HAL_ETH_RxLinkCallback().
+              Allocated buffers must hold ETH_RX_BUF_SIZE bytes.
+         (##) Initialize the Rx descriptors with HAL_ETH_DMARxDescListAllocInit(): each
+              descriptor gets a buffer from the allocation function.
+         (##) Call HAL_ETH_ReadData() (in polling or from HAL_ETH_RxCpltCallback()): each
+              received segment is given to the link function, which chains the buffers
+              (e.g. into pbufs) and the packet is returned. Used descriptors are given back
+              to the DMA with new buffers. HAL_ETH_GetRxDataErrorCode() returns the errors
+              of the last packet.
+
       (#) Communicate with external PHY device:
          (##) Read a specific register from the PHY
               HAL_ETH_ReadPHYRegister();
@@ -139,6 +154,7 @@ static void ETH_DMATransmissionDisable(ETH_HandleTypeDef *heth);
 static void ETH_DMAReceptionEnable(ETH_HandleTypeDef *heth);
 static void ETH_DMAReceptionDisable(ETH_HandleTypeDef *heth);
 static void ETH_FlushTransmitFIFO(ETH_HandleTypeDef *heth);
+static void ETH_UpdateDescriptor(ETH_HandleTypeDef *heth);
 
 /**
   * @}
@@ -599,6 +615,101 @@ HAL_StatusTypeDef HAL_ETH_DMARxDescListInit(ETH_HandleTypeDef *heth, ETH_DMADesc
   return HAL_OK;
 }
 
+/**
+  * @brief  Initializes the DMA Rx descriptors in chain mode with application buffers.
+  * @note   Each descriptor gets a buffer of ETH_RX_BUF_SIZE bytes from the Rx allocate
+  *         callback, the received frames are then read with HAL_ETH_ReadData().
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  DMARxDescTab: Pointer to the first Rx desc list
+  * @param  RxDescCount: Number of the used Rx desc in the list
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ETH_DMARxDescListAllocInit(ETH_HandleTypeDef *heth, ETH_DMADescTypeDef *DMARxDescTab, uint32_t RxDescCount)
+{
+  uint32_t i = 0U;
+  ETH_DMADescTypeDef *DMARxDesc;
+
+  if((DMARxDescTab == NULL) || (RxDescCount == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Process Locked */
+  __HAL_LOCK(heth);
+
+  /* Set the ETH peripheral state to BUSY */
+  heth->State = HAL_ETH_STATE_BUSY;
+
+  if(heth->rxAllocateCallback == NULL)
+  {
+    heth->rxAllocateCallback = HAL_ETH_RxAllocateCallback;
+  }
+  if(heth->rxLinkCallback == NULL)
+  {
+    heth->rxLinkCallback = HAL_ETH_RxLinkCallback;
+  }
+
+  /* Set the Ethernet RxDesc pointer with the first one of the DMARxDescTab list */
+  heth->RxDesc = DMARxDescTab;
+
+  /* Fill each DMARxDesc descriptor with the right values */
+  for(i=0U; i < RxDescCount; i++)
+  {
+    /* Get the pointer on the ith member of the Rx Desc list */
+    DMARxDesc = DMARxDescTab+i;
+
+    /* Descriptor owned by the CPU until a buffer is attached */
+    DMARxDesc->Status = 0U;
+
+    /* Set Buffer1 size and Second Address Chained bit */
+    DMARxDesc->ControlBufferSize = ETH_DMARXDESC_RCH | ETH_RX_BUF_SIZE;
+
+    /* No buffer attached */
+    DMARxDesc->Buffer1Addr = 0U;
+
+    if((heth->Init).RxMode == ETH_RXINTERRUPT_MODE)
+    {
+      /* Enable Ethernet DMA Rx Descriptor interrupt */
+      DMARxDesc->ControlBufferSize &= ~ETH_DMARXDESC_DIC;
+    }
+
+    /* Initialize the next descriptor with the Next Descriptor Polling Enable */
+    if(i < (RxDescCount-1U))
+    {
+      /* Set next descriptor address register with next descriptor base address */
+      DMARxDesc->Buffer2NextDescAddr = (uint32_t)(DMARxDescTab+i+1U);
+    }
+    else
+    {
+      /* For last descriptor, set next descriptor address register equal to the first descriptor base address */
+      DMARxDesc->Buffer2NextDescAddr = (uint32_t)(DMARxDescTab);
+    }
+  }
+
+  heth->RxBuildDesc = DMARxDescTab;
+  heth->RxBuildDescCnt = RxDescCount;
+  heth->RxDescCnt = RxDescCount;
+  heth->RxDataLength = 0U;
+  heth->pRxStart = NULL;
+  heth->pRxEnd = NULL;
+
+  /* Attach the application buffers and give the descriptors to the DMA */
+  ETH_UpdateDescriptor(heth);
+
+  /* Set Receive Descriptor List Address Register */
+  (heth->Instance)->DMARDLAR = (uint32_t) DMARxDescTab;
+
+  /* Set ETH HAL State to Ready */
+  heth->State= HAL_ETH_STATE_READY;
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(heth);
+
+  /* Return function status */
+  return HAL_OK;
+}
+
 /**
   * @brief  Initializes the ETH MSP.
   * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
@@ -648,6 +759,8 @@ __weak void HAL_ETH_MspDeInit(ETH_HandleTypeDef *heth)
         (+) Receive a frame
             HAL_ETH_GetReceivedFrame();
             HAL_ETH_GetReceivedFrame_IT();
+        (+) Receive a frame in application buffers
+            HAL_ETH_ReadData();
         (+) Read from an External PHY register
             HAL_ETH_ReadPHYRegister();
         (+) Write to an External PHY register
@@ -937,6 +1050,291 @@ HAL_StatusTypeDef HAL_ETH_GetReceivedFrame_IT(ETH_HandleTypeDef *heth)
   return HAL_ERROR;
 }
 
+/**
+  * @brief  Reads a received packet from the Rx descriptors initialized with
+  *         HAL_ETH_DMARxDescListAllocInit().
+  * @note   The buffers of the packet are chained by the Rx link callback and
+  *         the used descriptors are given back to the DMA with new buffers.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  pAppBuff: Pointer to an application buffer to receive the packet.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ETH_ReadData(ETH_HandleTypeDef *heth, void **pAppBuff)
+{
+  ETH_DMADescTypeDef *dmarxdesc;
+  uint32_t desccnt = 0U;
+  uint32_t desccntmax;
+  uint32_t bufflength;
+  uint32_t framelength;
+  uint8_t rxdataready = 0U;
+
+  if(pAppBuff == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Process Locked */
+  __HAL_LOCK(heth);
+
+  /* Set ETH HAL State to BUSY */
+  heth->State = HAL_ETH_STATE_BUSY;
+
+  dmarxdesc = heth->RxDesc;
+  desccntmax = heth->RxDescCnt - heth->RxBuildDescCnt;
+
+  /* Scan descriptors owned by CPU */
+  while(((dmarxdesc->Status & ETH_DMARXDESC_OWN) == (uint32_t)RESET) && (desccnt < desccntmax) && (rxdataready == 0U))
+  {
+    if(((dmarxdesc->Status & ETH_DMARXDESC_FS) != (uint32_t)RESET) || (heth->pRxStart != NULL))
+    {
+      /* Check if first segment */
+      if((dmarxdesc->Status & ETH_DMARXDESC_FS) != (uint32_t)RESET)
+      {
+        heth->RxDataLength = 0U;
+      }
+
+      /* Check if last segment */
+      bufflength = ETH_RX_BUF_SIZE;
+      if((dmarxdesc->Status & ETH_DMARXDESC_LS) != (uint32_t)RESET)
+      {
+        /* Get the Frame Length of the received packet: substruct 4 bytes of the CRC */
+        framelength = ((dmarxdesc->Status & ETH_DMARXDESC_FL) >> ETH_DMARXDESC_FRAMELENGTHSHIFT) - 4U;
+        bufflength = (framelength > heth->RxDataLength) ? (framelength - heth->RxDataLength) : 0U;
+
+        /* Save Last descriptor status */
+        heth->RxLastDescStatus = dmarxdesc->Status;
+
+        /* Packet ready */
+        rxdataready = 1U;
+      }
+
+      /* Link data */
+      heth->rxLinkCallback(&heth->pRxStart, &heth->pRxEnd, (uint8_t *)dmarxdesc->Buffer1Addr, (uint16_t)bufflength);
+      heth->RxDataLength += bufflength;
+
+      /* Clear buffer pointer */
+      dmarxdesc->Buffer1Addr = 0U;
+    }
+
+    /* Point to next descriptor */
+    dmarxdesc = (ETH_DMADescTypeDef*) (dmarxdesc->Buffer2NextDescAddr);
+    desccnt++;
+  }
+
+  heth->RxBuildDescCnt += desccnt;
+  if(heth->RxBuildDescCnt != 0U)
+  {
+    /* Update Descriptors */
+    ETH_UpdateDescriptor(heth);
+  }
+
+  heth->RxDesc = dmarxdesc;
+
+  /* Set HAL State to Ready */
+  heth->State = HAL_ETH_STATE_READY;
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(heth);
+
+  if(rxdataready == 1U)
+  {
+    /* Return received packet */
+    *pAppBuff = heth->pRxStart;
+    /* Reset first element */
+    heth->pRxStart = NULL;
+
+    return HAL_OK;
+  }
+
+  /* Packet not ready */
+  return HAL_ERROR;
+}
+
+/**
+  * @brief  This function gives back Rx Desc of the last received Packet
+  *         to the DMA with new application buffers, so ETH DMA will be able
+  *         to use these descriptors to receive next Packets.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @retval None
+  */
+static void ETH_UpdateDescriptor(ETH_HandleTypeDef *heth)
+{
+  uint32_t desccount;
+  ETH_DMADescTypeDef *dmarxdesc;
+  uint8_t *buff = NULL;
+  uint8_t allocStatus = 1U;
+
+  dmarxdesc = heth->RxBuildDesc;
+  desccount = heth->RxBuildDescCnt;
+
+  while((desccount > 0U) && (allocStatus != 0U))
+  {
+    /* Check if a buffer's attached the descriptor */
+    if(dmarxdesc->Buffer1Addr == 0U)
+    {
+      /* Get a new buffer. */
+      buff = NULL;
+      heth->rxAllocateCallback(&buff);
+      if(buff == NULL)
+      {
+        allocStatus = 0U;
+      }
+      else
+      {
+        dmarxdesc->Buffer1Addr = (uint32_t)buff;
+      }
+    }
+
+    if(allocStatus != 0U)
+    {
+      /* Ensure rest of descriptor is written to RAM before the OWN bit */
+      __DMB();
+
+      dmarxdesc->Status = ETH_DMARXDESC_OWN;
+
+      /* Point to next descriptor */
+      dmarxdesc = (ETH_DMADescTypeDef*) (dmarxdesc->Buffer2NextDescAddr);
+      desccount--;
+    }
+  }
+
+  if(heth->RxBuildDescCnt != desccount)
+  {
+    heth->RxBuildDesc = dmarxdesc;
+    heth->RxBuildDescCnt = desccount;
+
+    /* When Rx Buffer unavailable flag is set: clear it and resume reception */
+    if(((heth->Instance)->DMASR & ETH_DMASR_RBUS) != (uint32_t)RESET)
+    {
+      /* Clear RBUS ETHERNET DMA flag */
+      (heth->Instance)->DMASR = ETH_DMASR_RBUS;
+      /* Resume DMA reception */
+      (heth->Instance)->DMARPDR = 0U;
+    }
+  }
+}
+
+/**
+  * @brief  Register the Rx alloc callback.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  rxAllocateCallback: pointer to function to alloc buffer
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ETH_RegisterRxAllocateCallback(ETH_HandleTypeDef *heth, pETH_rxAllocateCallbackTypeDef rxAllocateCallback)
+{
+  if(rxAllocateCallback == NULL)
+  {
+    /* No buffer to save */
+    return HAL_ERROR;
+  }
+
+  /* Set function to allocate buffer */
+  heth->rxAllocateCallback = rxAllocateCallback;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Unregister the Rx alloc callback.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ETH_UnRegisterRxAllocateCallback(ETH_HandleTypeDef *heth)
+{
+  /* Set function to allocate buffer */
+  heth->rxAllocateCallback = HAL_ETH_RxAllocateCallback;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Register the Rx link callback.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  rxLinkCallback: pointer to function to link data
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ETH_RegisterRxLinkCallback(ETH_HandleTypeDef *heth, pETH_rxLinkCallbackTypeDef rxLinkCallback)
+{
+  if(rxLinkCallback == NULL)
+  {
+    /* No buffer to save */
+    return HAL_ERROR;
+  }
+
+  /* Set function to link data */
+  heth->rxLinkCallback = rxLinkCallback;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Unregister the Rx link callback.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ETH_UnRegisterRxLinkCallback(ETH_HandleTypeDef *heth)
+{
+  /* Set function to link data */
+  heth->rxLinkCallback = HAL_ETH_RxLinkCallback;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Get the error state of the last packet read with HAL_ETH_ReadData().
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  pErrorCode: pointer to uint32_t to hold the error bits (ETH_DMARXDESC_ERRORS_MASK)
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ETH_GetRxDataErrorCode(ETH_HandleTypeDef *heth, uint32_t *pErrorCode)
+{
+  /* Get error bits. */
+  *pErrorCode = heth->RxLastDescStatus & ETH_DMARXDESC_ERRORS_MASK;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Rx Allocate callback.
+  * @param  buff: pointer to allocated buffer
+  * @retval None
+  */
+__weak void HAL_ETH_RxAllocateCallback(uint8_t **buff)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(buff);
+  /* NOTE : This function Should not be modified, when the callback is needed,
+  the HAL_ETH_RxAllocateCallback could be implemented in the user file
+  */
+}
+
+/**
+  * @brief  Rx Link callback.
+  * @param  pStart: pointer to packet start
+  * @param  pEnd: pointer to packet end
+  * @param  buff: pointer to received data
+  * @param  Length: received data length
+  * @retval None
+  */
+__weak void HAL_ETH_RxLinkCallback(void **pStart, void **pEnd, uint8_t *buff, uint16_t Length)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(pStart);
+  UNUSED(pEnd);
+  UNUSED(buff);
+  UNUSED(Length);
+  /* NOTE : This function Should not be modified, when the callback is needed,
+  the HAL_ETH_RxLinkCallback could be implemented in the user file
+  */
+}
+
 /**
   * @brief  This function handles ETH interrupt request.
   * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
@@ -90,6 +90,11 @@
      (+) Pause the DMA Transfer using HAL_I2S_DMAPause()
      (+) Resume the DMA Transfer using HAL_I2S_DMAResume()
      (+) Stop the DMA Transfer using HAL_I2S_DMAStop()
+     (+) Receive continuously in two buffers (DMA double buffer mode) using
+         HAL_I2S_ReceiveDoubleBuffer_DMA()
+     (+) At reception end of each buffer HAL_I2S_RxM0CpltCallback or HAL_I2S_RxM1CpltCallback
+         is executed and user can process the filled buffer, or replace the idle buffer
+         using HAL_DMAEx_ChangeMemory(); the reception is stopped using HAL_I2S_DMAStop()
 
    *** I2S HAL driver macros list ***
    =============================================
@@ -162,6 +167,8 @@ static void I2S_DMATxCplt(DMA_HandleTypeDef *hdma);
 static void I2S_DMATxHalfCplt(DMA_HandleTypeDef *hdma);
 static void I2S_DMARxCplt(DMA_HandleTypeDef *hdma);
 static void I2S_DMARxHalfCplt(DMA_HandleTypeDef *hdma);
+static void I2S_DMARxM0Cplt(DMA_HandleTypeDef *hdma);
+static void I2S_DMARxM1Cplt(DMA_HandleTypeDef *hdma);
 static void I2S_DMAError(DMA_HandleTypeDef *hdma);
 static void I2S_Transmit_IT(I2S_HandleTypeDef *hi2s);
 static void I2S_Receive_IT(I2S_HandleTypeDef *hi2s);
@@ -947,6 +954,103 @@ HAL_StatusTypeDef HAL_I2S_Receive_DMA(I2S_HandleTypeDef *hi2s, uint16_t *pData,
   }
 }
 
+/**
+  * @brief Receive data continuously in non-blocking mode with DMA double buffer mode
+  * @param  hi2s: pointer to a I2S_HandleTypeDef structure that contains
+  *         the configuration information for I2S module
+  * @param  pData0: a 16-bit pointer to the first data buffer (DMA memory 0).
+  * @param  pData1: a 16-bit pointer to the second data buffer (DMA memory 1).
+  * @param  Size: number of data sample to be received in each buffer.
+  * @note   Size has the same meaning as for HAL_I2S_Receive_DMA().
+  * @note   The reception alternates between the two buffers until HAL_I2S_DMAStop()
+  *         is called. HAL_I2S_RxM0CpltCallback() and HAL_I2S_RxM1CpltCallback() are
+  *         executed each time the corresponding buffer has been filled.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_I2S_ReceiveDoubleBuffer_DMA(I2S_HandleTypeDef *hi2s, uint16_t *pData0, uint16_t *pData1, uint16_t Size)
+{
+  uint32_t tmp1 = 0U;
+
+  if((pData0 == NULL) || (pData1 == NULL) || (Size == 0U))
+  {
+    return  HAL_ERROR;
+  }
+
+  if(hi2s->State == HAL_I2S_STATE_READY)
+  {
+    hi2s->pRxBuffPtr = pData0;
+    tmp1 = hi2s->Instance->I2SCFGR & (SPI_I2SCFGR_DATLEN | SPI_I2SCFGR_CHLEN);
+    if((tmp1 == I2S_DATAFORMAT_24B) || (tmp1 == I2S_DATAFORMAT_32B))
+    {
+      hi2s->RxXferSize  = (Size << 1U);
+      hi2s->RxXferCount = (Size << 1U);
+    }
+    else
+    {
+      hi2s->RxXferSize  = Size;
+      hi2s->RxXferCount = Size;
+    }
+    /* Process Locked */
+    __HAL_LOCK(hi2s);
+
+    hi2s->State     = HAL_I2S_STATE_BUSY_RX;
+    hi2s->ErrorCode = HAL_I2S_ERROR_NONE;
+
+    /* Half transfer callbacks are not used in double buffer mode */
+    hi2s->hdmarx->XferHalfCpltCallback = NULL;
+    hi2s->hdmarx->XferM1HalfCpltCallback = NULL;
+
+    /* Set the I2S Rx DMA memory 0 and memory 1 transfer complete callbacks */
+    hi2s->hdmarx->XferCpltCallback = I2S_DMARxM0Cplt;
+    hi2s->hdmarx->XferM1CpltCallback = I2S_DMARxM1Cplt;
+
+    /* Set the DMA error callback */
+    hi2s->hdmarx->XferErrorCallback = I2S_DMAError;
+
+    /* Check if Master Receiver mode is selected */
+    if((hi2s->Instance->I2SCFGR & SPI_I2SCFGR_I2SCFG) == I2S_MODE_MASTER_RX)
+    {
+      /* Clear the Overrun Flag by a read operation to the SPI_DR register followed by a read
+      access to the SPI_SR register. */
+      __HAL_I2S_CLEAR_OVRFLAG(hi2s);
+    }
+
+    /* Enable the Rx DMA Stream in double buffer mode */
+    if(HAL_DMAEx_MultiBufferStart_IT(hi2s->hdmarx, (uint32_t)&hi2s->Instance->DR, (uint32_t)pData0, (uint32_t)pData1, hi2s->RxXferSize) != HAL_OK)
+    {
+      SET_BIT(hi2s->ErrorCode, HAL_I2S_ERROR_DMA);
+      hi2s->State = HAL_I2S_STATE_READY;
+
+      /* Process Unlocked */
+      __HAL_UNLOCK(hi2s);
+      return HAL_ERROR;
+    }
+
+    /* Check if the I2S is already enabled */
+    if((hi2s->Instance->I2SCFGR &SPI_I2SCFGR_I2SE) != SPI_I2SCFGR_I2SE)
+    {
+      /* Enable I2S peripheral */
+      __HAL_I2S_ENABLE(hi2s);
+    }
+
+     /* Check if the I2S Rx request is already enabled */
+    if((hi2s->Instance->CR2 &SPI_CR2_RXDMAEN) != SPI_CR2_RXDMAEN)
+    {
+      /* Enable Rx DMA Request */
+      SET_BIT(hi2s->Instance->CR2,SPI_CR2_RXDMAEN);
+    }
+
+    /* Process Unlocked */
+    __HAL_UNLOCK(hi2s);
+
+    return HAL_OK;
+  }
+  else
+  {
+    return HAL_BUSY;
+  }
+}
+
 /**
   * @brief Pauses the audio stream playing from the Media.
   * @param  hi2s: pointer to a I2S_HandleTypeDef structure that contains
@@ -1264,6 +1368,36 @@ __weak void HAL_I2S_RxCpltCallback(I2S_HandleTypeDef *hi2s)
    */
 }
 
+/**
+  * @brief Rx memory 0 buffer completed callback (double buffer reception)
+  * @param  hi2s: pointer to a I2S_HandleTypeDef structure that contains
+  *         the configuration information for I2S module
+  * @retval None
+  */
+__weak void HAL_I2S_RxM0CpltCallback(I2S_HandleTypeDef *hi2s)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hi2s);
+  /* NOTE : This function Should not be modified, when the callback is needed,
+            the HAL_I2S_RxM0CpltCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief Rx memory 1 buffer completed callback (double buffer reception)
+  * @param  hi2s: pointer to a I2S_HandleTypeDef structure that contains
+  *         the configuration information for I2S module
+  * @retval None
+  */
+__weak void HAL_I2S_RxM1CpltCallback(I2S_HandleTypeDef *hi2s)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hi2s);
+  /* NOTE : This function Should not be modified, when the callback is needed,
+            the HAL_I2S_RxM1CpltCallback could be implemented in the user file
+   */
+}
+
 /**
   * @brief I2S error callbacks
   * @param  hi2s: pointer to a I2S_HandleTypeDef structure that contains
@@ -1476,6 +1610,32 @@ static void I2S_DMARxHalfCplt(DMA_HandleTypeDef *hdma)
   HAL_I2S_RxHalfCpltCallback(hi2s);
 }
 
+/**
+  * @brief DMA I2S memory 0 receive complete callback (double buffer mode)
+  * @param  hdma: pointer to a DMA_HandleTypeDef structure that contains
+  *                the configuration information for the specified DMA module.
+  * @retval None
+  */
+static void I2S_DMARxM0Cplt(DMA_HandleTypeDef *hdma)
+{
+  I2S_HandleTypeDef* hi2s = (I2S_HandleTypeDef*)((DMA_HandleTypeDef*)hdma)->Parent;
+
+  HAL_I2S_RxM0CpltCallback(hi2s);
+}
+
+/**
+  * @brief DMA I2S memory 1 receive complete callback (double buffer mode)
+  * @param  hdma: pointer to a DMA_HandleTypeDef structure that contains
+  *                the configuration information for the specified DMA module.
+  * @retval None
+  */
+static void I2S_DMARxM1Cplt(DMA_HandleTypeDef *hdma)
+{
+  I2S_HandleTypeDef* hi2s = (I2S_HandleTypeDef*)((DMA_HandleTypeDef*)hdma)->Parent;
+
+  HAL_I2S_RxM1CpltCallback(hi2s);
+}
+
 /**
   * @brief DMA I2S communication error callback
   * @param  hdma: pointer to a DMA_HandleTypeDef structure that contains
@@ -99,6 +99,18 @@
 
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
+/** @defgroup RCC_Private_Constants RCC Private Constants
+  * @{
+  */
+/* Maximum HCLK per voltage scale (over-drive included) and per wait state at VDD 2.7 V to 3.6 V */
+#define RCC_SCALE1_HCLK_MAX        216000000U
+#define RCC_SCALE2_HCLK_MAX        180000000U
+#define RCC_SCALE3_HCLK_MAX        144000000U
+#define RCC_FLASH_WS_FREQ           30000000U
+/**
+  * @}
+  */
+
 /* Private macro -------------------------------------------------------------*/
 /** @defgroup RCC_Private_Macros RCC Private Macros
   * @{
@@ -196,6 +208,13 @@
               to work correctly, while the SDIO require a frequency equal or lower than
               to 48. This clock is derived of the main PLL through PLLQ divider.
           (+@) IWDG clock which is always the LSI clock.
+
+      (#) HAL_RCC_ClockConfigAuto() configures the busses clocks like HAL_RCC_ClockConfig()
+          but programs the minimum number of flash wait states allowed by the target HCLK
+          and the voltage scale in use, and enables the ART accelerator and the prefetch
+          buffer when it is effective.
+          HAL_RCC_GetOptimalFlashLatency() returns this number of wait states, for a VDD
+          between 2.7 V and 3.6 V.
 @endverbatim
   * @{
   */
@@ -748,6 +767,146 @@ HAL_StatusTypeDef HAL_RCC_ClockConfig(RCC_ClkInitTypeDef  *RCC_ClkInitStruct, ui
   return HAL_OK;
 }
 
+/**
+  * @brief  Initializes the CPU, AHB and APB buses clocks according to the specified
+  *         parameters in the RCC_ClkInitStruct, with the minimum FLASH latency.
+  * @param  RCC_ClkInitStruct: pointer to an RCC_OscInitTypeDef structure that
+  *         contains the configuration information for the RCC peripheral.
+  * @note   The FLASH latency is computed by HAL_RCC_GetOptimalFlashLatency() from the
+  *         HCLK frequency and the voltage scale in use. The voltage scale and the
+  *         over-drive must therefore be configured before calling this function when
+  *         the clock is increased, and after it when the clock is decreased.
+  * @note   HAL_RCC_ClockConfig() applies the new HCLK prescaler before it selects the new
+  *         system clock source. The latency programmed during the transition also covers
+  *         the current SYSCLK divided by the new prescaler, then it is lowered to the value
+  *         needed by the final HCLK.
+  * @note   The ART accelerator is enabled, after a reset if it was disabled so that no line
+  *         fetched before its deactivation is hit. The prefetch buffer is enabled only with
+  *         one wait state or more, it brings no gain at zero wait state and increases the
+  *         consumption. The ART accelerator and the prefetch buffer only serve the code
+  *         fetched through the ITCM interface.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_RCC_ClockConfigAuto(RCC_ClkInitTypeDef  *RCC_ClkInitStruct)
+{
+  uint32_t sysclk = 0, cursysclk = 0, hpre = 0, vos = 0;
+  uint32_t pllm = 0, pllvco = 0, pllp = 0;
+  uint32_t latency = 0, transition_latency = 0;
+  HAL_StatusTypeDef status = HAL_OK;
+
+  /* Check Null pointer */
+  if(RCC_ClkInitStruct == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Get the current and the target SYSCLK frequencies */
+  cursysclk = HAL_RCC_GetSysClockFreq();
+  if(((RCC_ClkInitStruct->ClockType) & RCC_CLOCKTYPE_SYSCLK) == RCC_CLOCKTYPE_SYSCLK)
+  {
+    switch(RCC_ClkInitStruct->SYSCLKSource)
+    {
+    case RCC_SYSCLKSOURCE_HSE:
+      sysclk = HSE_VALUE;
+      break;
+
+    case RCC_SYSCLKSOURCE_PLLCLK:
+      /* PLL_VCO = (HSE_VALUE or HSI_VALUE / PLLM) * PLLN
+      SYSCLK = PLL_VCO / PLLP */
+      pllm = RCC->PLLCFGR & RCC_PLLCFGR_PLLM;
+      if (__HAL_RCC_GET_PLL_OSCSOURCE() != RCC_PLLCFGR_PLLSRC_HSI)
+      {
+        /* HSE used as PLL clock source */
+        pllvco = ((HSE_VALUE / pllm) * ((RCC->PLLCFGR & RCC_PLLCFGR_PLLN) >> POSITION_VAL(RCC_PLLCFGR_PLLN)));
+      }
+      else
+      {
+        /* HSI used as PLL clock source */
+        pllvco = ((HSI_VALUE / pllm) * ((RCC->PLLCFGR & RCC_PLLCFGR_PLLN) >> POSITION_VAL(RCC_PLLCFGR_PLLN)));
+      }
+      pllp = ((((RCC->PLLCFGR & RCC_PLLCFGR_PLLP) >> POSITION_VAL(RCC_PLLCFGR_PLLP)) + 1 ) *2);
+      sysclk = pllvco/pllp;
+      break;
+
+    case RCC_SYSCLKSOURCE_HSI:
+    default:
+      sysclk = HSI_VALUE;
+      break;
+    }
+  }
+  else
+  {
+    sysclk = cursysclk;
+  }
+
+  /* Get the voltage scale, read from the register to keep the PWR driver optional */
+  if(__HAL_RCC_PWR_IS_CLK_ENABLED())
+  {
+    vos = READ_BIT(PWR->CR1, PWR_CR1_VOS);
+  }
+  else
+  {
+    __HAL_RCC_PWR_CLK_ENABLE();
+    vos = READ_BIT(PWR->CR1, PWR_CR1_VOS);
+    __HAL_RCC_PWR_CLK_DISABLE();
+  }
+
+  /* Get the final HCLK prescaler */
+  hpre = RCC->CFGR & RCC_CFGR_HPRE;
+  if(((RCC_ClkInitStruct->ClockType) & RCC_CLOCKTYPE_HCLK) == RCC_CLOCKTYPE_HCLK)
+  {
+    hpre = RCC_ClkInitStruct->AHBCLKDivider & RCC_CFGR_HPRE;
+  }
+  hpre = AHBPrescTable[hpre >> POSITION_VAL(RCC_CFGR_HPRE)];
+
+  /* Latency at the final HCLK, and at the current SYSCLK with the new HCLK prescaler */
+  latency = HAL_RCC_GetOptimalFlashLatency(sysclk >> hpre, vos);
+  transition_latency = HAL_RCC_GetOptimalFlashLatency(cursysclk >> hpre, vos);
+
+  if(transition_latency < latency)
+  {
+    transition_latency = latency;
+  }
+
+  status = HAL_RCC_ClockConfig(RCC_ClkInitStruct, transition_latency);
+
+  if(status == HAL_OK)
+  {
+    /* Decrease the number of wait states down to the one needed by the final HCLK */
+    if(latency < (FLASH->ACR & FLASH_ACR_LATENCY))
+    {
+      __HAL_FLASH_SET_LATENCY(latency);
+
+      /* Check that the new number of wait states is taken into account to access the Flash
+      memory by reading the FLASH_ACR register */
+      if((FLASH->ACR & FLASH_ACR_LATENCY) != latency)
+      {
+        return HAL_ERROR;
+      }
+    }
+
+    /* Enable the ART accelerator, resetting it if it was disabled */
+    if((FLASH->ACR & FLASH_ACR_ARTEN) == 0U)
+    {
+      __HAL_FLASH_ART_RESET();
+      CLEAR_BIT(FLASH->ACR, FLASH_ACR_ARTRST);
+      __HAL_FLASH_ART_ENABLE();
+    }
+
+    /* Prefetch buffer is only useful with wait states */
+    if(latency != FLASH_LATENCY_0)
+    {
+      __HAL_FLASH_PREFETCH_BUFFER_ENABLE();
+    }
+    else
+    {
+      __HAL_FLASH_PREFETCH_BUFFER_DISABLE();
+    }
+  }
+
+  return status;
+}
+
 /**
   * @}
   */
@@ -1081,6 +1240,45 @@ void HAL_RCC_GetClockConfig(RCC_ClkInitTypeDef  *RCC_ClkInitStruct, uint32_t *pF
   *pFLatency = (uint32_t)(FLASH->ACR & FLASH_ACR_LATENCY);
 }
 
+/**
+  * @brief  Returns the minimum FLASH latency allowed for an HCLK frequency and a voltage scale.
+  * @param  HCLKFreq: HCLK frequency in Hz.
+  * @param  VoltageScaling: voltage scale, as returned by HAL_PWREx_GetVoltageRange().
+  *          This parameter can be one of the following values:
+  *            @arg PWR_REGULATOR_VOLTAGE_SCALE1: Regulator voltage output Scale 1 mode
+  *            @arg PWR_REGULATOR_VOLTAGE_SCALE2: Regulator voltage output Scale 2 mode
+  *            @arg PWR_REGULATOR_VOLTAGE_SCALE3: Regulator voltage output Scale 3 mode
+  * @note   The wait states are those of a VDD between 2.7 V and 3.6 V.
+  * @note   The HCLK frequency is not checked against the maximum of the voltage scale:
+  *         above it the latency of this maximum is returned.
+  * @retval FLASH latency, a value of @ref FLASH_Latency
+  */
+uint32_t HAL_RCC_GetOptimalFlashLatency(uint32_t HCLKFreq, uint32_t VoltageScaling)
+{
+  uint32_t hclkmax = 0;
+
+  if(VoltageScaling == PWR_REGULATOR_VOLTAGE_SCALE1)
+  {
+    hclkmax = RCC_SCALE1_HCLK_MAX;
+  }
+  else if(VoltageScaling == PWR_REGULATOR_VOLTAGE_SCALE2)
+  {
+    hclkmax = RCC_SCALE2_HCLK_MAX;
+  }
+  else
+  {
+    hclkmax = RCC_SCALE3_HCLK_MAX;
+  }
+
+  if(HCLKFreq > hclkmax)
+  {
+    HCLKFreq = hclkmax;
+  }
+
+  /* One wait state per RCC_FLASH_WS_FREQ */
+  return (HCLKFreq == 0U) ? FLASH_LATENCY_0 : ((HCLKFreq - 1U) / RCC_FLASH_WS_FREQ);
+}
+
 /**
   * @brief This function handles the RCC CSS interrupt request.
   * @note This API should be called under the NMI_Handler().
@@ -52,6 +52,16 @@
       (#) The CRC feature is not managed when the DMA circular mode is enabled
       (#) When the SPI DMA Pause/Stop features are used, we must use the following APIs
           the HAL_SPI_DMAPause()/ HAL_SPI_DMAStop() only under the SPI callbacks
+     [..]
+       Double buffer reception:
+      (#) HAL_SPI_ReceiveDoubleBuffer_DMA() starts a continuous reception alternating
+          between two memory buffers (DMA double buffer mode). The end of reception in
+          each buffer is signalled by HAL_SPI_RxM0CpltCallback() and HAL_SPI_RxM1CpltCallback();
+          the buffer not currently targeted by the DMA can be processed, or replaced using
+          HAL_DMAEx_ChangeMemory(), from these callbacks.
+      (#) The reception runs until HAL_SPI_DMAStop() is called.
+      (#) Double buffer reception is not available in Master 2Lines full-duplex mode and
+          the CRC feature is not managed in this mode.
 
      [..]
        (@) The max SPI frequency depend on SPI data size (4bits, 5bits,..., 8bits,...15bits, 16bits),
@@ -182,6 +192,8 @@ static void SPI_DMATransmitReceiveCplt(DMA_HandleTypeDef *hdma);
 static void SPI_DMAHalfTransmitCplt(DMA_HandleTypeDef *hdma);
 static void SPI_DMAHalfReceiveCplt(DMA_HandleTypeDef *hdma);
 static void SPI_DMAHalfTransmitReceiveCplt(DMA_HandleTypeDef *hdma);
+static void SPI_DMAReceiveM0Cplt(DMA_HandleTypeDef *hdma);
+static void SPI_DMAReceiveM1Cplt(DMA_HandleTypeDef *hdma);
 static void SPI_DMAError(DMA_HandleTypeDef *hdma);
 static void SPI_DMAAbortOnError(DMA_HandleTypeDef *hdma);
 static void SPI_DMATxAbortCallback(DMA_HandleTypeDef *hdma);
@@ -1676,6 +1688,137 @@ error:
   return errorcode;
 }
 
+/**
+  * @brief  Receive data continuously in non-blocking mode with DMA double buffer mode.
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *               the configuration information for SPI module.
+  * @param  pData0: pointer to the first data buffer (DMA memory 0)
+  * @param  pData1: pointer to the second data buffer (DMA memory 1)
+  * @param  Size: amount of data to be received in each buffer
+  * @note   The reception alternates between the two buffers until HAL_SPI_DMAStop()
+  *         is called. HAL_SPI_RxM0CpltCallback() and HAL_SPI_RxM1CpltCallback() are
+  *         executed each time the corresponding buffer has been filled.
+  * @note   This mode is not available in Master 2Lines full-duplex mode and does not
+  *         manage the CRC feature.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SPI_ReceiveDoubleBuffer_DMA(SPI_HandleTypeDef *hspi, uint8_t *pData0, uint8_t *pData1,
+                                                  uint16_t Size)
+{
+  HAL_StatusTypeDef errorcode = HAL_OK;
+
+  if ((hspi->Init.Direction == SPI_DIRECTION_2LINES) && (hspi->Init.Mode == SPI_MODE_MASTER))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Process Locked */
+  __HAL_LOCK(hspi);
+
+  if (hspi->State != HAL_SPI_STATE_READY)
+  {
+    errorcode = HAL_BUSY;
+    goto error;
+  }
+
+  if ((pData0 == NULL) || (pData1 == NULL) || (Size == 0U))
+  {
+    errorcode = HAL_ERROR;
+    goto error;
+  }
+
+#if (USE_SPI_CRC != 0U)
+  /* CRC is not managed in double buffer mode */
+  if (hspi->Init.CRCCalculation == SPI_CRCCALCULATION_ENABLE)
+  {
+    errorcode = HAL_ERROR;
+    goto error;
+  }
+#endif /* USE_SPI_CRC */
+
+  /* Set the transaction information */
+  hspi->State       = HAL_SPI_STATE_BUSY_RX;
+  hspi->ErrorCode   = HAL_SPI_ERROR_NONE;
+  hspi->pRxBuffPtr  = (uint8_t *)pData0;
+  hspi->RxXferSize  = Size;
+  hspi->RxXferCount = Size;
+
+  /*Init field not used in handle to zero */
+  hspi->RxISR       = NULL;
+  hspi->TxISR       = NULL;
+  hspi->TxXferSize  = 0U;
+  hspi->TxXferCount = 0U;
+
+  /* Configure communication direction : 1Line */
+  if (hspi->Init.Direction == SPI_DIRECTION_1LINE)
+  {
+    SPI_1LINE_RX(hspi);
+  }
+
+  /* packing mode management is enabled by the DMA settings */
+  if ((hspi->Init.DataSize <= SPI_DATASIZE_8BIT) && (hspi->hdmarx->Init.MemDataAlignment == DMA_MDATAALIGN_HALFWORD))
+  {
+    /* Restriction the DMA data received is not allowed in this mode */
+    hspi->State = HAL_SPI_STATE_READY;
+    errorcode = HAL_ERROR;
+    goto error;
+  }
+
+  CLEAR_BIT(hspi->Instance->CR2, SPI_CR2_LDMARX);
+  if (hspi->Init.DataSize > SPI_DATASIZE_8BIT)
+  {
+    /* set fiforxthreshold according the reception data length: 16bit */
+    CLEAR_BIT(hspi->Instance->CR2, SPI_RXFIFO_THRESHOLD);
+  }
+  else
+  {
+    /* set fiforxthreshold according the reception data length: 8bit */
+    SET_BIT(hspi->Instance->CR2, SPI_RXFIFO_THRESHOLD);
+  }
+
+  /* Half transfer callbacks are not used in double buffer mode */
+  hspi->hdmarx->XferHalfCpltCallback = NULL;
+  hspi->hdmarx->XferM1HalfCpltCallback = NULL;
+
+  /* Set the SPI Rx DMA memory 0 and memory 1 transfer complete callbacks */
+  hspi->hdmarx->XferCpltCallback = SPI_DMAReceiveM0Cplt;
+  hspi->hdmarx->XferM1CpltCallback = SPI_DMAReceiveM1Cplt;
+
+  /* Set the DMA error callback */
+  hspi->hdmarx->XferErrorCallback = SPI_DMAError;
+
+  /* Set the DMA AbortCpltCallback */
+  hspi->hdmarx->XferAbortCallback = NULL;
+
+  /* Enable the Rx DMA Stream in double buffer mode */
+  if (HAL_DMAEx_MultiBufferStart_IT(hspi->hdmarx, (uint32_t)&hspi->Instance->DR, (uint32_t)pData0, (uint32_t)pData1,
+                                    Size) != HAL_OK)
+  {
+    SET_BIT(hspi->ErrorCode, HAL_SPI_ERROR_DMA);
+    hspi->State = HAL_SPI_STATE_READY;
+    errorcode = HAL_ERROR;
+    goto error;
+  }
+
+  /* Check if the SPI is already enabled */
+  if ((hspi->Instance->CR1 & SPI_CR1_SPE) != SPI_CR1_SPE)
+  {
+    /* Enable SPI peripheral */
+    __HAL_SPI_ENABLE(hspi);
+  }
+
+  /* Enable the SPI Error Interrupt Bit */
+  __HAL_SPI_ENABLE_IT(hspi, (SPI_IT_ERR));
+
+  /* Enable Rx DMA Request */
+  SET_BIT(hspi->Instance->CR2, SPI_CR2_RXDMAEN);
+
+error:
+  /* Process Unlocked */
+  __HAL_UNLOCK(hspi);
+  return errorcode;
+}
+
 /**
   * @brief  Transmit and Receive an amount of data in non-blocking mode with DMA.
   * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
@@ -2408,6 +2551,36 @@ __weak void HAL_SPI_RxHalfCpltCallback(SPI_HandleTypeDef *hspi)
    */
 }
 
+/**
+  * @brief Rx memory 0 buffer completed callback (double buffer reception).
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *               the configuration information for SPI module.
+  * @retval None
+  */
+__weak void HAL_SPI_RxM0CpltCallback(SPI_HandleTypeDef *hspi)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hspi);
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_SPI_RxM0CpltCallback() should be implemented in the user file
+  */
+}
+
+/**
+  * @brief Rx memory 1 buffer completed callback (double buffer reception).
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *               the configuration information for SPI module.
+  * @retval None
+  */
+__weak void HAL_SPI_RxM1CpltCallback(SPI_HandleTypeDef *hspi)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hspi);
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_SPI_RxM1CpltCallback() should be implemented in the user file
+  */
+}
+
 /**
   * @brief Tx and Rx Half Transfer callback.
   * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
@@ -2776,6 +2949,32 @@ static void SPI_DMAHalfTransmitReceiveCplt(DMA_HandleTypeDef *hdma)
   HAL_SPI_TxRxHalfCpltCallback(hspi);
 }
 
+/**
+  * @brief  DMA SPI memory 0 receive complete callback (double buffer mode).
+  * @param  hdma: pointer to a DMA_HandleTypeDef structure that contains
+  *               the configuration information for the specified DMA module.
+  * @retval None
+  */
+static void SPI_DMAReceiveM0Cplt(DMA_HandleTypeDef *hdma)
+{
+  SPI_HandleTypeDef* hspi = ( SPI_HandleTypeDef* )((DMA_HandleTypeDef* )hdma)->Parent;
+
+  HAL_SPI_RxM0CpltCallback(hspi);
+}
+
+/**
+  * @brief  DMA SPI memory 1 receive complete callback (double buffer mode).
+  * @param  hdma: pointer to a DMA_HandleTypeDef structure that contains
+  *               the configuration information for the specified DMA module.
+  * @retval None
+  */
+static void SPI_DMAReceiveM1Cplt(DMA_HandleTypeDef *hdma)
+{
+  SPI_HandleTypeDef* hspi = ( SPI_HandleTypeDef* )((DMA_HandleTypeDef* )hdma)->Parent;
+
+  HAL_SPI_RxM1CpltCallback(hspi);
+}
+
 /**
   * @brief  DMA SPI communication error callback.
   * @param  hdma: pointer to a DMA_HandleTypeDef structure that contains
@@ -3337,6 +3536,9 @@ static HAL_StatusTypeDef SPI_WaitFlagStateUntilTimeout(SPI_HandleTypeDef *hspi,
 {
   while ((hspi->Instance->SR & Flag) != State)
   {
+    /* Let the application yield or sleep while waiting */
+    HAL_WaitHook(HAL_WAIT_SPI, hspi);
+
     if (Timeout != HAL_MAX_DELAY)
     {
       if ((Timeout == 0U) || ((HAL_GetTick() - Tickstart) >= Timeout))
@@ -3391,6 +3593,9 @@ static HAL_StatusTypeDef SPI_WaitFifoStateUntilTimeout(SPI_HandleTypeDef *hspi,
 
   while ((hspi->Instance->SR & Fifo) != State)
   {
+    /* Let the application yield or sleep while waiting */
+    HAL_WaitHook(HAL_WAIT_SPI, hspi);
+
     if ((Fifo == SPI_SR_FRLVL) && (State == SPI_FRLVL_EMPTY))
     {
       tmpreg = *((__IO uint8_t *)&hspi->Instance->DR);
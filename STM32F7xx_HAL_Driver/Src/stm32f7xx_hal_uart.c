@@ -105,6 +105,11 @@
        (+) Pause the DMA Transfer using HAL_UART_DMAPause()
        (+) Resume the DMA Transfer using HAL_UART_DMAResume()
        (+) Stop the DMA Transfer using HAL_UART_DMAStop()
+       (+) Receive continuously into an application owned power-of-two ring buffer using
+            HAL_UARTEx_RingReceive_DMA() (Rx DMA in circular mode). The write index follows the
+            DMA on line idle, half and full transfer events, HAL_UARTEx_RingRxEventCallback() is
+            executed on each of them and the data is read in place with HAL_UARTEx_Ring_GetData()
+            and HAL_UARTEx_Ring_Release()
 
      *** UART HAL driver macros list ***
      =============================================
@@ -191,6 +196,7 @@ static void UART_DMARxHalfCplt(DMA_HandleTypeDef *hdma);
 static void UART_DMATxHalfCplt(DMA_HandleTypeDef *hdma);
 static void UART_DMAError(DMA_HandleTypeDef *hdma);
 static void UART_DMAAbortOnError(DMA_HandleTypeDef *hdma);
+static void UART_DMARingRxEvent(DMA_HandleTypeDef *hdma);
 static HAL_StatusTypeDef UART_Transmit_IT(UART_HandleTypeDef *huart);
 static HAL_StatusTypeDef UART_EndTransmit_IT(UART_HandleTypeDef *huart);
 static HAL_StatusTypeDef UART_Receive_IT(UART_HandleTypeDef *huart);
@@ -263,6 +269,7 @@ HAL_StatusTypeDef HAL_UART_Init(UART_HandleTypeDef *huart)
   {
     /* Allocate lock resource and initialize it */
     huart->Lock = HAL_UNLOCKED;
+    huart->pRxRing = NULL;
 
     /* Init the low level hardware : GPIO, CLOCK */
     HAL_UART_MspInit(huart);
@@ -315,6 +322,7 @@ HAL_StatusTypeDef HAL_HalfDuplex_Init(UART_HandleTypeDef *huart)
   {
     /* Allocate lock resource and initialize it */
     huart->Lock = HAL_UNLOCKED;
+    huart->pRxRing = NULL;
 
     /* Init the low level hardware : GPIO, CLOCK */
     HAL_UART_MspInit(huart);
@@ -380,6 +388,7 @@ HAL_StatusTypeDef HAL_LIN_Init(UART_HandleTypeDef *huart, uint32_t BreakDetectLe
   {
     /* Allocate lock resource and initialize it */
     huart->Lock = HAL_UNLOCKED;
+    huart->pRxRing = NULL;
 
     /* Init the low level hardware : GPIO, CLOCK */
     HAL_UART_MspInit(huart);
@@ -452,6 +461,7 @@ HAL_StatusTypeDef HAL_MultiProcessor_Init(UART_HandleTypeDef *huart, uint8_t Add
   {
     /* Allocate lock resource and initialize it */
     huart->Lock = HAL_UNLOCKED;
+    huart->pRxRing = NULL;
 
     /* Init the low level hardware : GPIO, CLOCK */
     HAL_UART_MspInit(huart);
@@ -540,6 +550,7 @@ HAL_StatusTypeDef HAL_RS485Ex_Init(UART_HandleTypeDef *huart, uint32_t Polarity,
   {
     /* Allocate lock resource and initialize it */
     huart->Lock = HAL_UNLOCKED;
+    huart->pRxRing = NULL;
 
     /* Init the low level hardware : GPIO, CLOCK, CORTEX */
     HAL_UART_MspInit(huart);
@@ -1184,6 +1195,266 @@ HAL_StatusTypeDef HAL_UART_DMAStop(UART_HandleTypeDef *huart)
   return HAL_OK;
 }
 
+/**
+  * @brief  Start a ring buffer reception in DMA mode.
+  * @note   The Rx DMA handle must be configured in circular mode. The DMA then
+  *         fills pData continuously and the write index is resynchronised from
+  *         the DMA remaining data counter on line idle, half transfer and
+  *         transfer complete events, so a burst is made available to the reader
+  *         as soon as the line goes idle, without any per-byte interrupt.
+  * @note   The reader drains the ring with HAL_UARTEx_Ring_GetData() and
+  *         HAL_UARTEx_Ring_Release(), which hand out pointers into pData
+  *         (no copy is made).
+  * @note   Line errors (noise, framing, parity) are not reported in this mode,
+  *         the reception goes on. A reader that falls behind by more than Size
+  *         bytes loses the oldest data and Overrun is incremented.
+  * @note   When the data cache is enabled, pData must be aligned on a 32-byte boundary
+  *         and Size must be at least 32: the cache lines handed out to the reader by
+  *         HAL_UARTEx_Ring_GetData() are invalidated there.
+  * @param  huart Pointer to a UART_HandleTypeDef structure that contains
+  *               the configuration information for the specified UART module.
+  * @param  pRing Pointer to the ring descriptor, owned by the application.
+  * @param  pData Pointer to the ring storage.
+  * @param  Size  Size of the ring storage, must be a power of two.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UARTEx_RingReceive_DMA(UART_HandleTypeDef *huart, UART_RingTypeDef *pRing, uint8_t *pData, uint16_t Size)
+{
+  uint32_t *tmp;
+
+  /* Check that a Rx process is not already ongoing */
+  if(huart->RxState == HAL_UART_STATE_READY)
+  {
+    if((pRing == NULL) || (pData == NULL) || (Size == 0U) || ((Size & (Size - 1U)) != 0U))
+    {
+      return HAL_ERROR;
+    }
+
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    /* Cache maintenance is done on whole lines of the ring storage */
+    if((((uint32_t)pData & 31U) != 0U) || (Size < 32U))
+    {
+      return HAL_ERROR;
+    }
+#endif /* __DCACHE_PRESENT */
+
+    /* The ring relies on the DMA wrapping around by itself */
+    if((huart->hdmarx == NULL) || (huart->hdmarx->Init.Mode != DMA_CIRCULAR))
+    {
+      return HAL_ERROR;
+    }
+
+    /* Process Locked */
+    __HAL_LOCK(huart);
+
+    pRing->pBuffer = pData;
+    pRing->Mask    = (uint32_t)Size - 1U;
+    pRing->Head    = 0U;
+    pRing->Tail    = 0U;
+    pRing->Overrun = 0U;
+
+    huart->pRxBuffPtr = pData;
+    huart->RxXferSize = Size;
+    huart->pRxRing    = pRing;
+
+    huart->ErrorCode = HAL_UART_ERROR_NONE;
+    huart->RxState = HAL_UART_STATE_BUSY_RX;
+
+    /* Half transfer and transfer complete both only resynchronise the write index */
+    huart->hdmarx->XferCpltCallback = UART_DMARingRxEvent;
+    huart->hdmarx->XferHalfCpltCallback = UART_DMARingRxEvent;
+
+    /* Set the DMA error callback */
+    huart->hdmarx->XferErrorCallback = UART_DMAError;
+
+    /* Set the DMA abort callback */
+    huart->hdmarx->XferAbortCallback = NULL;
+
+    /* Enable the DMA channel */
+    tmp = (uint32_t *)&pData;
+    if(HAL_DMA_Start_IT(huart->hdmarx, (uint32_t)&huart->Instance->RDR, *(uint32_t *)tmp, Size) != HAL_OK)
+    {
+      huart->pRxRing = NULL;
+      huart->ErrorCode = HAL_UART_ERROR_DMA;
+      huart->RxState = HAL_UART_STATE_READY;
+
+      /* Process Unlocked */
+      __HAL_UNLOCK(huart);
+
+      return HAL_ERROR;
+    }
+
+    /* Clear the Overrun and Idle flags just before enabling the DMA Rx request */
+    __HAL_UART_CLEAR_IT(huart, UART_CLEAR_OREF | UART_CLEAR_IDLEF);
+
+    /* Process Unlocked */
+    __HAL_UNLOCK(huart);
+
+    /* Enable the line idle interrupt used to flush bursts to the reader */
+    SET_BIT(huart->Instance->CR1, USART_CR1_IDLEIE);
+
+    /* Enable the DMA transfer for the receiver request by setting the DMAR bit
+    in the UART CR3 register */
+    SET_BIT(huart->Instance->CR3, USART_CR3_DMAR);
+
+    return HAL_OK;
+  }
+  else
+  {
+    return HAL_BUSY;
+  }
+}
+
+/**
+  * @brief  Stop an ongoing ring buffer reception.
+  * @note   The write index is resynchronised one last time, so the data received
+  *         before the call stays available to the reader.
+  * @param  huart Pointer to a UART_HandleTypeDef structure that contains
+  *               the configuration information for the specified UART module.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UARTEx_RingReceive_Stop(UART_HandleTypeDef *huart)
+{
+  if(huart->pRxRing == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Stop new Rx DMA requests and line idle notifications */
+  CLEAR_BIT(huart->Instance->CR1, USART_CR1_IDLEIE);
+  CLEAR_BIT(huart->Instance->CR3, USART_CR3_DMAR);
+
+  /* Publish the data written so far before the DMA is disabled */
+  HAL_UARTEx_RingReceive_Update(huart);
+
+  /* Abort the UART DMA Rx stream : use blocking DMA Abort API (no callback) */
+  huart->hdmarx->XferAbortCallback = NULL;
+  if(HAL_DMA_Abort(huart->hdmarx) != HAL_OK)
+  {
+    if(HAL_DMA_GetError(huart->hdmarx) == HAL_DMA_ERROR_TIMEOUT)
+    {
+      /* Set error code to DMA */
+      huart->ErrorCode = HAL_UART_ERROR_DMA;
+
+      return HAL_TIMEOUT;
+    }
+  }
+
+  UART_EndRxTransfer(huart);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Resynchronise the ring write index with the DMA remaining data counter.
+  * @note   Called by the driver on line idle, half transfer and transfer complete
+  *         events. It can also be called by the reader to pick up bytes received
+  *         since the last event without waiting for the line to go idle.
+  * @param  huart Pointer to a UART_HandleTypeDef structure that contains
+  *               the configuration information for the specified UART module.
+  * @retval None
+  */
+void HAL_UARTEx_RingReceive_Update(UART_HandleTypeDef *huart)
+{
+  UART_RingTypeDef *pRing = huart->pRxRing;
+  uint32_t primask_bit;
+  uint32_t position;
+  uint32_t head;
+
+  if(pRing != NULL)
+  {
+    /* The update can be entered concurrently from the UART IRQ, the DMA IRQ and
+       the reader: keep the read-modify-write of Head atomic */
+    primask_bit = __get_PRIMASK();
+    __disable_irq();
+
+    position = ((uint32_t)huart->RxXferSize - __HAL_DMA_GET_COUNTER(huart->hdmarx)) & pRing->Mask;
+    head = pRing->Head;
+    head += (position - head) & pRing->Mask;
+    if((head - pRing->Tail) > (pRing->Mask + 1U))
+    {
+      pRing->Overrun++;
+    }
+    pRing->Head = head;
+
+    __set_PRIMASK(primask_bit);
+  }
+}
+
+/**
+  * @brief  Return the number of bytes waiting in the ring.
+  * @param  pRing Pointer to the ring descriptor.
+  * @retval Number of bytes available to the reader
+  */
+uint32_t HAL_UARTEx_Ring_GetCount(UART_RingTypeDef *pRing)
+{
+  uint32_t count = pRing->Head - pRing->Tail;
+
+  /* Bytes overwritten by the DMA are not readable anymore */
+  if(count > (pRing->Mask + 1U))
+  {
+    count = pRing->Mask + 1U;
+  }
+
+  return count;
+}
+
+/**
+  * @brief  Get direct access to the oldest bytes waiting in the ring.
+  * @note   Only the contiguous part up to the end of the storage is returned: when
+  *         the waiting data wraps around, a second call after
+  *         HAL_UARTEx_Ring_Release() returns the remainder.
+  * @note   When the data cache is enabled the returned span is invalidated before
+  *         being handed out, as it has been written by the DMA behind the cache.
+  * @param  pRing  Pointer to the ring descriptor.
+  * @param  ppData Filled with a pointer to the oldest waiting byte.
+  * @retval Number of contiguous bytes readable at *ppData
+  */
+uint32_t HAL_UARTEx_Ring_GetData(UART_RingTypeDef *pRing, uint8_t **ppData)
+{
+  uint32_t head = pRing->Head;
+  uint32_t tail = pRing->Tail;
+  uint32_t size = pRing->Mask + 1U;
+  uint32_t count;
+
+  /* The writer overtook the reader: skip the overwritten bytes */
+  if((head - tail) > size)
+  {
+    tail = head - size;
+    pRing->Tail = tail;
+  }
+
+  count = head - tail;
+  if(count > (size - (tail & pRing->Mask)))
+  {
+    count = size - (tail & pRing->Mask);
+  }
+
+  *ppData = &pRing->pBuffer[tail & pRing->Mask];
+
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  if((count != 0U) && ((SCB->CCR & SCB_CCR_DC_Msk) != 0U))
+  {
+    /* The DMA wrote behind the cache: drop the stale lines covering the span */
+    SCB_InvalidateDCache_by_Addr((uint32_t *)((uint32_t)*ppData & ~31U),
+                                 (int32_t)(count + ((uint32_t)*ppData & 31U)));
+  }
+#endif /* __DCACHE_PRESENT */
+
+  return count;
+}
+
+/**
+  * @brief  Hand bytes obtained with HAL_UARTEx_Ring_GetData() back to the driver.
+  * @param  pRing Pointer to the ring descriptor.
+  * @param  Count Number of bytes consumed by the reader.
+  * @retval None
+  */
+void HAL_UARTEx_Ring_Release(UART_RingTypeDef *pRing, uint32_t Count)
+{
+  pRing->Tail += Count;
+}
+
 /**
   * @brief This function handles UART interrupt request.
   * @param huart: uart handle
@@ -1196,6 +1467,23 @@ void HAL_UART_IRQHandler(UART_HandleTypeDef *huart)
   uint32_t cr3its     = READ_REG(huart->Instance->CR3);
   uint32_t errorflags;
 
+  /* UART in ring buffer reception mode, line idle --------------------------*/
+  if(((isrflags & USART_ISR_IDLE) != RESET) && ((cr1its & USART_CR1_IDLEIE) != RESET) && (huart->pRxRing != NULL))
+  {
+    __HAL_UART_CLEAR_IT(huart, UART_CLEAR_IDLEF);
+    if(huart->RxState == HAL_UART_STATE_BUSY_RX)
+    {
+      HAL_UARTEx_RingReceive_Update(huart);
+      HAL_UARTEx_RingRxEventCallback(huart);
+    }
+    else
+    {
+      /* Reception was aborted through the generic abort services */
+      CLEAR_BIT(huart->Instance->CR1, USART_CR1_IDLEIE);
+      huart->pRxRing = NULL;
+    }
+  }
+
   /* If no error occurs */
   errorflags = (isrflags & (uint32_t)(USART_ISR_PE | USART_ISR_FE | USART_ISR_ORE | USART_ISR_NE));
   if (errorflags == RESET)
@@ -1339,6 +1627,9 @@ HAL_StatusTypeDef UART_WaitOnFlagUntilTimeout(UART_HandleTypeDef *huart, uint32_
   /* Wait until flag is set */
   while((__HAL_UART_GET_FLAG(huart, Flag) ? SET : RESET) == Status)
   {
+    /* Let the application yield or sleep while waiting */
+    HAL_WaitHook(HAL_WAIT_UART, huart);
+
     /* Check for the Timeout */
     if(Timeout != HAL_MAX_DELAY)
     {
@@ -1440,6 +1731,19 @@ static void UART_DMARxHalfCplt(DMA_HandleTypeDef *hdma)
   HAL_UART_RxHalfCpltCallback(huart);
 }
 
+/**
+  * @brief  DMA UART ring buffer reception half/full transfer callback.
+  * @param  hdma DMA handle.
+  * @retval None
+  */
+static void UART_DMARingRxEvent(DMA_HandleTypeDef *hdma)
+{
+  UART_HandleTypeDef *huart = (UART_HandleTypeDef *)((DMA_HandleTypeDef *)hdma)->Parent;
+
+  HAL_UARTEx_RingReceive_Update(huart);
+  HAL_UARTEx_RingRxEventCallback(huart);
+}
+
 /**
   * @brief DMA UART communication error callback
   * @param hdma: DMA handle
@@ -1557,6 +1861,23 @@ __weak void HAL_UART_RxHalfCpltCallback(UART_HandleTypeDef *huart)
    */
 }
 
+/**
+  * @brief  UART ring buffer reception event callback.
+  * @note   Called each time new data has been published in the ring, i.e. on line
+  *         idle, half transfer and transfer complete events.
+  * @param  huart UART handle.
+  * @retval None
+  */
+__weak void HAL_UARTEx_RingRxEventCallback(UART_HandleTypeDef *huart)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(huart);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_UARTEx_RingRxEventCallback can be implemented in the user file.
+   */
+}
+
 /**
   * @brief Send an amount of data in interrupt mode
   *         Function called under interruption only, once
@@ -1701,10 +2022,13 @@ static void UART_EndTxTransfer(UART_HandleTypeDef *huart)
   */
 static void UART_EndRxTransfer(UART_HandleTypeDef *huart)
 {
-  /* Disable RXNE, PE and ERR (Frame error, noise error, overrun error) interrupts */
-  CLEAR_BIT(huart->Instance->CR1, (USART_CR1_RXNEIE | USART_CR1_PEIE));
+  /* Disable RXNE, PE, IDLE and ERR (Frame error, noise error, overrun error) interrupts */
+  CLEAR_BIT(huart->Instance->CR1, (USART_CR1_RXNEIE | USART_CR1_PEIE | USART_CR1_IDLEIE));
   CLEAR_BIT(huart->Instance->CR3, USART_CR3_EIE);
 
+  /* Ring buffer reception, if any, is over */
+  huart->pRxRing = NULL;
+
   /* At end of Rx process, restore huart->RxState to Ready */
   huart->RxState = HAL_UART_STATE_READY;
 }
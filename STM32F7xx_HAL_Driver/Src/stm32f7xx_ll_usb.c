@@ -810,14 +810,38 @@ HAL_StatusTypeDef USB_EP0StartXfer(USB_OTG_GlobalTypeDef *USBx , USB_OTG_EPTypeD
   */
 HAL_StatusTypeDef USB_WritePacket(USB_OTG_GlobalTypeDef *USBx, uint8_t *src, uint8_t ch_ep_num, uint16_t len, uint8_t dma)
 {
-  uint32_t count32b= 0 , i= 0;
+  uint32_t count32b = 0U , i = 0U;
+  __IO uint32_t *pFifo;
+  uint32_t *pSrc32;
 
-  if (dma == 0)
+  if (dma == 0U)
   {
-    count32b =  (len + 3) / 4;
-    for (i = 0; i < count32b; i++, src += 4)
+    count32b =  (len + 3U) / 4U;
+    pFifo = &USBx_DFIFO(ch_ep_num);
+
+    if (((uint32_t)src & 3U) == 0U)
+    {
+      /* Word aligned source: blocks of four words, written at four addresses of
+         the FIFO window (any address of the window accesses the FIFO) */
+      pSrc32 = (uint32_t *)src;
+      for (i = count32b >> 2U; i != 0U; i--, pSrc32 += 4U)
+      {
+        pFifo[0] = pSrc32[0];
+        pFifo[1] = pSrc32[1];
+        pFifo[2] = pSrc32[2];
+        pFifo[3] = pSrc32[3];
+      }
+      for (i = count32b & 3U; i != 0U; i--, pSrc32++)
+      {
+        *pFifo = *pSrc32;
+      }
+    }
+    else
     {
-      USBx_DFIFO(ch_ep_num) = *((__packed uint32_t *)src);
+      for (i = 0U; i < count32b; i++, src += 4U)
+      {
+        *pFifo = *((__packed uint32_t *)src);
+      }
     }
   }
   return HAL_OK;
@@ -838,13 +862,47 @@ HAL_StatusTypeDef USB_WritePacket(USB_OTG_GlobalTypeDef *USBx, uint8_t *src, uin
   */
 void *USB_ReadPacket(USB_OTG_GlobalTypeDef *USBx, uint8_t *dest, uint16_t len)
 {
-  uint32_t i=0;
-  uint32_t count32b = (len + 3) / 4;
-
-  for ( i = 0; i < count32b; i++, dest += 4 )
+  __IO uint32_t *pFifo = &USBx_DFIFO(0U);
+  uint32_t *pDest32;
+  uint32_t i = 0U;
+  uint32_t count32b = (uint32_t)len >> 2U;
+  uint32_t remaining_bytes = (uint32_t)len & 3U;
+  uint32_t data;
+
+  if (((uint32_t)dest & 3U) == 0U)
+  {
+    /* Word aligned destination: blocks of four words, read at four addresses of
+       the FIFO window (any address of the window accesses the FIFO) */
+    pDest32 = (uint32_t *)dest;
+    for (i = count32b >> 2U; i != 0U; i--, pDest32 += 4U)
+    {
+      pDest32[0] = pFifo[0];
+      pDest32[1] = pFifo[1];
+      pDest32[2] = pFifo[2];
+      pDest32[3] = pFifo[3];
+    }
+    for (i = count32b & 3U; i != 0U; i--, pDest32++)
+    {
+      *pDest32 = *pFifo;
+    }
+    dest = (uint8_t *)pDest32;
+  }
+  else
   {
-    *(__packed uint32_t *)dest = USBx_DFIFO(0);
+    for (i = 0U; i < count32b; i++, dest += 4U)
+    {
+      *(__packed uint32_t *)dest = *pFifo;
+    }
+  }
 
+  /* When Number of data is not word aligned, read the remaining bytes */
+  if (remaining_bytes != 0U)
+  {
+    data = *pFifo;
+    for (i = 0U; i < remaining_bytes; i++, dest++)
+    {
+      *dest = (uint8_t)(data >> (8U * i));
+    }
   }
   return ((void *)dest);
 }
@@ -51,6 +51,22 @@ typedef enum
   * @}
   */
 
+/** @defgroup HAL_WAIT_REASON Wait Reason
+  * @brief    HAL wait reason, passed to HAL_WaitHook() by the blocking HAL functions
+  * @{
+  */
+typedef enum
+{
+  HAL_WAIT_DELAY = 0x00U,  /*!< HAL_Delay()                                       */
+  HAL_WAIT_UART  = 0x01U,  /*!< UART flag polling, Handle is a UART_HandleTypeDef  */
+  HAL_WAIT_I2C   = 0x02U,  /*!< I2C flag polling, Handle is a I2C_HandleTypeDef    */
+  HAL_WAIT_SPI   = 0x03U,  /*!< SPI flag polling, Handle is a SPI_HandleTypeDef    */
+  HAL_WAIT_FLASH = 0x04U   /*!< FLASH operation, Handle is NULL                    */
+} HAL_WaitReasonTypeDef;
+/**
+  * @}
+  */
+
 /* Exported constants --------------------------------------------------------*/
 /** @defgroup HAL_Exported_Constants HAL Exported Constants
   * @{
@@ -747,6 +763,10 @@ HAL_StatusTypeDef HAL_InitTick(uint32_t TickPriority);
 void HAL_IncTick(void);
 void HAL_Delay(uint32_t Delay);
 uint32_t HAL_GetTick(void);
+void HAL_WaitHook(HAL_WaitReasonTypeDef Reason, const void *Handle);
+void HAL_DelayUs(uint32_t DelayUs);
+uint32_t HAL_GetCycleCount(void);
+HAL_StatusTypeDef HAL_TimeoutUs(uint32_t StartCycle, uint32_t TimeoutUs);
 uint32_t HAL_GetTickPrio(void);
 HAL_StatusTypeDef HAL_SetTickFreq(HAL_TickFreqTypeDef Freq);
 HAL_TickFreqTypeDef HAL_GetTickFreq(void);
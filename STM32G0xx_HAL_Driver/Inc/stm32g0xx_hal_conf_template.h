@@ -178,6 +178,8 @@ in voltage and temperature.*/
 #define  VDD_VALUE                    (3300UL) /*!< Value of VDD in mv */
 #define  TICK_INT_PRIORITY            ((1UL<<__NVIC_PRIO_BITS) - 1UL) /*!< tick interrupt priority */
 #define  USE_RTOS                     0U
+#define  USE_HAL_ATOMIC_LOCK          0U /*!< 1: handle lock safe between interrupt and thread */
+#define  USE_HAL_NO_LOCK              0U /*!< 1: handle lock compiled out, single context only */
 #define  PREFETCH_ENABLE              1U
 #define  INSTRUCTION_CACHE_ENABLE     1U
 
@@ -190,6 +192,31 @@ in voltage and temperature.*/
 
 #define USE_SPI_CRC                     1U
 
+/* DMA FEATURE: Use to activate DMA mode inside HAL SPI Driver
+ * Activated: DMA code is present inside driver
+ * Deactivated: DMA code and DMA handles cleaned from driver
+ */
+
+#define USE_SPI_DMA                     1U
+
+/* ################## UART peripheral configuration ######################### */
+
+/* DMA FEATURE: Use to activate DMA mode inside HAL UART Driver
+ * Activated: DMA code is present inside driver
+ * Deactivated: DMA code and DMA handles cleaned from driver
+ */
+
+#define USE_UART_DMA                    1U
+
+/* ################## I2C peripheral configuration ########################## */
+
+/* DMA FEATURE: Use to activate DMA mode inside HAL I2C Driver
+ * Activated: DMA code is present inside driver
+ * Deactivated: DMA code and DMA handles cleaned from driver
+ */
+
+#define USE_I2C_DMA                     1U
+
 /* ################## CRYP peripheral configuration ########################## */
 
 #define USE_HAL_CRYP_SUSPEND_RESUME     1U
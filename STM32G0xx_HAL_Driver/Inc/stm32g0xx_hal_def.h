@@ -87,6 +87,37 @@ typedef enum
 #if (USE_RTOS == 1U)
 /* Reserved for future use */
 #error " USE_RTOS should be 0 in the current HAL release "
+#elif defined (USE_HAL_NO_LOCK) && (USE_HAL_NO_LOCK == 1U)
+/* Single execution context: the HAL handles are never accessed concurrently,
+   the locks are compiled out */
+#define __HAL_LOCK(__HANDLE__)                                           \
+                                do{                                        \
+                                  }while (0U)
+
+#define __HAL_UNLOCK(__HANDLE__)                                          \
+                                  do{                                       \
+                                    }while (0U)
+#elif defined (USE_HAL_ATOMIC_LOCK) && (USE_HAL_ATOMIC_LOCK == 1U)
+/* Cortex-M0+ has no exclusive access instructions: the test-and-set of the Lock
+   field is made atomic by masking the interrupts for these few instructions */
+#define __HAL_LOCK(__HANDLE__)                                                  \
+                                do{                                             \
+                                    uint32_t __lock_primask = __get_PRIMASK();  \
+                                    __disable_irq();                            \
+                                    if((__HANDLE__)->Lock == HAL_LOCKED)        \
+                                    {                                           \
+                                       __set_PRIMASK(__lock_primask);           \
+                                       return HAL_BUSY;                         \
+                                    }                                           \
+                                    (__HANDLE__)->Lock = HAL_LOCKED;            \
+                                    __set_PRIMASK(__lock_primask);              \
+                                  }while (0U)
+
+#define __HAL_UNLOCK(__HANDLE__)                                          \
+                                  do{                                       \
+                                      __DMB();                              \
+                                      (__HANDLE__)->Lock = HAL_UNLOCKED;    \
+                                    }while (0U)
 #else
 #define __HAL_LOCK(__HANDLE__)                                           \
                                 do{                                        \
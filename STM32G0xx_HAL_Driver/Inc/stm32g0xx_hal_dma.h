@@ -742,6 +742,78 @@ uint32_t             HAL_DMA_GetError(DMA_HandleTypeDef *hdma);
   * @}
   */
 
+/** @defgroup DMA_Exported_Functions_Group4 Direct transfer functions
+  * @brief    Start, abort and counter functions with the same prototypes on
+  *           every family, reduced to the register writes of the controller. The
+  *           start and counter functions are inline.
+  * @{
+  */
+
+/**
+  * @brief  Starts the DMA transfer with the minimum register writes.
+  * @note   No parameter check, no lock and no handle state update are done: the
+  *         channel must have been configured with HAL_DMA_Init() and its previous
+  *         transfer must be completed or aborted. The channel stays enabled at the
+  *         end of a normal mode transfer, so it is disabled here before CNDTR and
+  *         CMAR, read-only while enabled, are written. The interrupt enables are
+  *         left as already programmed.
+  * @param  hdma       pointer to a DMA_HandleTypeDef structure that contains
+  *                     the configuration information for the specified DMA Channel.
+  * @param  SrcAddress The source memory Buffer address
+  * @param  DstAddress The destination memory Buffer address
+  * @param  DataLength The length of data to be transferred from source to destination
+  * @retval None
+  */
+__STATIC_INLINE void HAL_DMA_Direct_Start(DMA_HandleTypeDef *hdma, uint32_t SrcAddress, uint32_t DstAddress,
+                                          uint32_t DataLength)
+{
+  /* Disable the channel, left enabled at the end of the previous transfer */
+  hdma->Instance->CCR &= ~DMA_CCR_EN;
+
+  /* Clear the DMAMUX synchro overrun flag */
+  hdma->DMAmuxChannelStatus->CFR = hdma->DMAmuxChannelStatusMask;
+
+  /* Clear all flags */
+#if defined(DMA2)
+  hdma->DmaBaseAddress->IFCR = (DMA_ISR_GIF1 << (hdma->ChannelIndex & 0x1CU));
+#else
+  DMA1->IFCR = (DMA_ISR_GIF1 << (hdma->ChannelIndex & 0x1CU));
+#endif /* DMA2 */
+
+  hdma->Instance->CNDTR = DataLength;
+
+  /* Memory to Peripheral */
+  if (hdma->Init.Direction == DMA_MEMORY_TO_PERIPH)
+  {
+    hdma->Instance->CPAR = DstAddress;
+    hdma->Instance->CMAR = SrcAddress;
+  }
+  /* Peripheral to Memory or Memory to Memory */
+  else
+  {
+    hdma->Instance->CPAR = SrcAddress;
+    hdma->Instance->CMAR = DstAddress;
+  }
+
+  hdma->Instance->CCR |= DMA_CCR_EN;
+}
+
+HAL_StatusTypeDef HAL_DMA_Direct_Abort(DMA_HandleTypeDef *hdma);
+
+/**
+  * @brief  Returns the number of data units remaining in the current transfer.
+  * @param  hdma       pointer to a DMA_HandleTypeDef structure that contains
+  *                     the configuration information for the specified DMA Channel.
+  * @retval Number of remaining data units
+  */
+__STATIC_INLINE uint32_t HAL_DMA_Direct_GetCounter(const DMA_HandleTypeDef *hdma)
+{
+  return hdma->Instance->CNDTR;
+}
+/**
+  * @}
+  */
+
 /**
   * @}
   */
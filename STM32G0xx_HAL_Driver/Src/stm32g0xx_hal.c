@@ -73,6 +73,16 @@
   */
 
 /* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/** @defgroup HAL_Private_Variables HAL Private Variables
+  * @{
+  */
+static uint32_t uwCycleCount;   /* SysTick based CPU cycle counter, see HAL_GetCycleCount() */
+static uint32_t uwSysTickLast;  /* SysTick value at the last cycle counter update */
+/**
+  * @}
+  */
+
 /* Exported variables ---------------------------------------------------------*/
 /** @defgroup HAL_Exported_Variables HAL Exported Variables
   * @{
@@ -286,6 +296,9 @@ __weak HAL_StatusTypeDef HAL_InitTick(uint32_t TickPriority)
     [..]  This section provides functions allowing to:
       (+) Provide a tick value in millisecond
       (+) Provide a blocking delay in millisecond
+      (+) Provide a hook called by the blocking HAL functions while waiting
+      (+) Provide a blocking delay and a timeout check in microsecond, based on the
+          SysTick counter and SystemCoreClock
       (+) Suspend the time base source interrupt
       (+) Resume the time base source interrupt
       (+) Get the HAL API driver version
@@ -321,6 +334,29 @@ __weak uint32_t HAL_GetTick(void)
   return uwTick;
 }
 
+/**
+  * @brief Wait hook, called in the polling loops of the blocking HAL functions
+  *        (HAL_Delay, UART, I2C and SPI flag waits, FLASH operations).
+  * @note The default implementation does nothing, the wait is an active polling.
+  *       An application can override it to yield to an RTOS or a scheduler, or
+  *       to execute __WFE() when an interrupt is expected to end the wait.
+  * @note The hook must return quickly compared to the timeout of the caller and
+  *       must not call the HAL function it is called from for the same handle.
+  *       For HAL_WAIT_FLASH, it must not access the FLASH bank being programmed
+  *       or erased.
+  * @note This function is declared as __weak to be overwritten in case of other
+  *       implementations in user file.
+  * @param Reason: wait reason, a value of @ref HAL_WaitReasonTypeDef.
+  * @param Handle: handle of the peripheral waited for, NULL if none.
+  * @retval None
+  */
+__weak void HAL_WaitHook(HAL_WaitReasonTypeDef Reason, const void *Handle)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(Reason);
+  UNUSED(Handle);
+}
+
 /**
   * @brief This function returns a tick priority.
   * @retval tick priority
@@ -393,9 +429,133 @@ __weak void HAL_Delay(uint32_t Delay)
 
   while ((HAL_GetTick() - tickstart) < wait)
   {
+    /* Let the application yield or sleep while waiting */
+    HAL_WaitHook(HAL_WAIT_DELAY, NULL);
+  }
+}
+
+/**
+  * @brief This function provides a delay (in microseconds) based on the SysTick
+  *        counter.
+  * @note Unlike HAL_Delay(), the wait does not depend on the tick interrupt: it can be
+  *       used with interrupts disabled and its length is exact to a few SysTick counts.
+  *       It relies on SystemCoreClock being up to date.
+  * @note Cortex-M0+ has no DWT cycle counter, see HAL_GetCycleCount().
+  * @param DelayUs specifies the delay time length, in microseconds.
+  * @retval None
+  */
+void HAL_DelayUs(uint32_t DelayUs)
+{
+  /* Rounded up, so that a delay is never shortened below 1 MHz */
+  uint64_t remaining = (((uint64_t)DelayUs * SystemCoreClock) + 999999U) / 1000000U;
+  uint32_t start = HAL_GetCycleCount();
+  uint32_t now;
+  uint32_t elapsed;
+
+  /* Consume the elapsed cycles step by step, so that delays longer than the
+     cycle counter period are supported */
+  while (remaining != 0U)
+  {
+    now = HAL_GetCycleCount();
+    elapsed = now - start;
+    start = now;
+    if (elapsed >= remaining)
+    {
+      remaining = 0U;
+    }
+    else
+    {
+      remaining -= elapsed;
+    }
   }
 }
 
+/**
+  * @brief Returns a CPU cycle counter, to be passed to HAL_TimeoutUs().
+  * @note Cortex-M0+ has no DWT cycle counter: the 24-bit SysTick down counter is
+  *       extended in software, each call adding the cycles elapsed since the previous
+  *       one. The counter must therefore be read at least once per SysTick period
+  *       (one tick with the default time base), which the polling loops of
+  *       HAL_DelayUs() and HAL_TimeoutUs() do.
+  * @note SysTick is started free running on the CPU clock if the time base does not
+  *       use it.
+  * @retval Cycle counter value
+  */
+uint32_t HAL_GetCycleCount(void)
+{
+  uint32_t primask = __get_PRIMASK();
+  uint32_t now;
+  uint32_t elapsed;
+  uint32_t count;
+
+  __disable_irq();
+
+  if ((SysTick->CTRL & SysTick_CTRL_ENABLE_Msk) == 0U)
+  {
+    SysTick->LOAD = SysTick_LOAD_RELOAD_Msk;
+    SysTick->VAL = 0U;
+    SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_ENABLE_Msk;
+    uwSysTickLast = SysTick->VAL;
+  }
+
+  /* SysTick counts down, from LOAD to 0 */
+  now = SysTick->VAL;
+  if (now <= uwSysTickLast)
+  {
+    elapsed = uwSysTickLast - now;
+  }
+  else
+  {
+    elapsed = uwSysTickLast + (SysTick->LOAD + 1U) - now;
+  }
+  uwSysTickLast = now;
+
+  /* SysTick clocked by HCLK/8 */
+  if ((SysTick->CTRL & SysTick_CTRL_CLKSOURCE_Msk) == 0U)
+  {
+    elapsed *= 8U;
+  }
+
+  uwCycleCount += elapsed;
+  count = uwCycleCount;
+
+  __set_PRIMASK(primask);
+
+  return count;
+}
+
+/**
+  * @brief Checks if a timeout (in microseconds) is elapsed.
+  * @note Typical use in a polling loop:
+  *       start = HAL_GetCycleCount();
+  *       while (flag not set) { if (HAL_TimeoutUs(start, Timeout) != HAL_OK) { ... } }
+  * @note The timeout is limited to the cycle counter period, i.e. 0xFFFFFFFF divided
+  *       by SystemCoreClock (67 seconds at 64 MHz). Longer timeouts are clamped.
+  * @param StartCycle cycle counter returned by HAL_GetCycleCount() at the start of
+  *        the wait.
+  * @param TimeoutUs specifies the timeout length, in microseconds.
+  * @retval HAL status
+  *          HAL_OK      timeout not elapsed
+  *          HAL_TIMEOUT timeout elapsed
+  */
+HAL_StatusTypeDef HAL_TimeoutUs(uint32_t StartCycle, uint32_t TimeoutUs)
+{
+  uint64_t timeout = (((uint64_t)TimeoutUs * SystemCoreClock) + 999999U) / 1000000U;
+  HAL_StatusTypeDef status = HAL_OK;
+
+  if (timeout > 0xFFFFFFFFU)
+  {
+    timeout = 0xFFFFFFFFU;
+  }
+
+  if ((HAL_GetCycleCount() - StartCycle) >= (uint32_t)timeout)
+  {
+    status = HAL_TIMEOUT;
+  }
+
+  return status;
+}
+
 /**
   * @brief Suspend Tick increment.
   * @note In the default implementation , SysTick timer is the source of time base. It is
@@ -626,6 +626,22 @@ HAL_StatusTypeDef HAL_DMA_Abort_IT(DMA_HandleTypeDef *hdma)
   return status;
 }
 
+/**
+  * @brief  Aborts the DMA transfer started by HAL_DMA_Direct_Start().
+  * @note   The channel is disabled at once. No lock and no handle state update are
+  *         done.
+  * @param  hdma  pointer to a DMA_HandleTypeDef structure that contains
+  *               the configuration information for the specified DMA Channel.
+  * @retval HAL status, always HAL_OK: the status is returned for the prototype to be
+  *         the same as on the families where the abort waits for the controller
+  */
+HAL_StatusTypeDef HAL_DMA_Direct_Abort(DMA_HandleTypeDef *hdma)
+{
+  hdma->Instance->CCR &= ~DMA_CCR_EN;
+
+  return HAL_OK;
+}
+
 /**
   * @brief Polling for transfer complete.
   * @param hdma Pointer to a DMA_HandleTypeDef structure that contains
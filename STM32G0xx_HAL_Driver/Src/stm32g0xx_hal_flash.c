@@ -604,6 +604,9 @@ HAL_StatusTypeDef FLASH_WaitForLastOperation(uint32_t Timeout)
 
   while ((FLASH->SR & error) != 0x00U)
   {
+    /* Let the application yield or sleep while waiting */
+    HAL_WaitHook(HAL_WAIT_FLASH, NULL);
+
     if (HAL_GetTick() >= timeout)
     {
       return HAL_TIMEOUT;
@@ -628,6 +631,9 @@ HAL_StatusTypeDef FLASH_WaitForLastOperation(uint32_t Timeout)
 
   while ((FLASH->SR & FLASH_SR_CFGBSY) != 0x00U)
   {
+    /* Let the application yield or sleep while waiting */
+    HAL_WaitHook(HAL_WAIT_FLASH, NULL);
+
     if (HAL_GetTick() >= timeout)
     {
       return HAL_TIMEOUT;
@@ -235,6 +235,14 @@
            add their own code by customization of function pointer HAL_I2C_ErrorCallback()
 
 
+     *** DMA mode removal ***
+     ========================
+     [..]
+      (+) When USE_I2C_DMA is set to 0 in the HAL configuration file, the DMA handles are removed
+          from the I2C handle and the DMA transfer services are not compiled, saving RAM in each
+          I2C handle and flash. Polling and interrupt modes are not affected.
+          When USE_I2C_DMA is not defined, the DMA mode is available.
+
      *** I2C HAL driver macros list ***
      ==================================
      [..]
@@ -402,7 +410,9 @@
 
 /* Private macro -------------------------------------------------------------*/
 /* Macro to get remaining data to transfer on DMA side */
+#if (USE_I2C_DMA != 0U)
 #define I2C_GET_DMA_REMAIN_DATA(__HANDLE__)     __HAL_DMA_GET_COUNTER(__HANDLE__)
+#endif /* USE_I2C_DMA */
 
 /* Private variables ---------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
@@ -411,12 +421,14 @@
   * @{
   */
 /* Private functions to handle DMA transfer */
+#if (USE_I2C_DMA != 0U)
 static void I2C_DMAMasterTransmitCplt(DMA_HandleTypeDef *hdma);
 static void I2C_DMAMasterReceiveCplt(DMA_HandleTypeDef *hdma);
 static void I2C_DMASlaveTransmitCplt(DMA_HandleTypeDef *hdma);
 static void I2C_DMASlaveReceiveCplt(DMA_HandleTypeDef *hdma);
 static void I2C_DMAError(DMA_HandleTypeDef *hdma);
 static void I2C_DMAAbort(DMA_HandleTypeDef *hdma);
+#endif /* USE_I2C_DMA */
 
 /* Private functions to handle IT transfer */
 static void I2C_ITAddrCplt(I2C_HandleTypeDef *hi2c, uint32_t ITFlags);
@@ -440,10 +452,12 @@ static HAL_StatusTypeDef I2C_Master_ISR_IT(struct __I2C_HandleTypeDef *hi2c, uin
                                            uint32_t ITSources);
 static HAL_StatusTypeDef I2C_Slave_ISR_IT(struct __I2C_HandleTypeDef *hi2c, uint32_t ITFlags,
                                           uint32_t ITSources);
+#if (USE_I2C_DMA != 0U)
 static HAL_StatusTypeDef I2C_Master_ISR_DMA(struct __I2C_HandleTypeDef *hi2c, uint32_t ITFlags,
                                             uint32_t ITSources);
 static HAL_StatusTypeDef I2C_Slave_ISR_DMA(struct __I2C_HandleTypeDef *hi2c, uint32_t ITFlags,
                                            uint32_t ITSources);
+#endif /* USE_I2C_DMA */
 
 /* Private functions to handle flags during polling transfer */
 static HAL_StatusTypeDef I2C_WaitOnFlagUntilTimeout(I2C_HandleTypeDef *hi2c, uint32_t Flag, FlagStatus Status,
@@ -1856,6 +1870,7 @@ HAL_StatusTypeDef HAL_I2C_Slave_Receive_IT(I2C_HandleTypeDef *hi2c, uint8_t *pDa
   }
 }
 
+#if (USE_I2C_DMA != 0U)
 /**
   * @brief  Transmit in master mode an amount of data in non-blocking mode with DMA
   * @param  hi2c Pointer to a I2C_HandleTypeDef structure that contains
@@ -1919,7 +1934,7 @@ HAL_StatusTypeDef HAL_I2C_Master_Transmit_DMA(I2C_HandleTypeDef *hi2c, uint16_t
 
         /* Enable the DMA channel */
         dmaxferstatus = HAL_DMA_Start_IT(hi2c->hdmatx, (uint32_t)pData, (uint32_t)&hi2c->Instance->TXDR,
-                                         hi2c->XferSize);
+                                         hi2c->XferCount);
       }
       else
       {
@@ -1954,6 +1969,13 @@ HAL_StatusTypeDef HAL_I2C_Master_Transmit_DMA(I2C_HandleTypeDef *hi2c, uint16_t
         /* Enable ERR and NACK interrupts */
         I2C_Enable_IRQ(hi2c, I2C_XFER_ERROR_IT);
 
+        /* The DMA covers the whole buffer, only the NBYTES reloads are done on TCR event */
+        if (hi2c->XferCount != 0U)
+        {
+          /* Enable TC interrupts */
+          I2C_Enable_IRQ(hi2c, I2C_XFER_RELOAD_IT);
+        }
+
         /* Enable DMA Request */
         hi2c->Instance->CR1 |= I2C_CR1_TXDMAEN;
       }
@@ -2066,7 +2088,7 @@ HAL_StatusTypeDef HAL_I2C_Master_Receive_DMA(I2C_HandleTypeDef *hi2c, uint16_t D
 
         /* Enable the DMA channel */
         dmaxferstatus = HAL_DMA_Start_IT(hi2c->hdmarx, (uint32_t)&hi2c->Instance->RXDR, (uint32_t)pData,
-                                         hi2c->XferSize);
+                                         hi2c->XferCount);
       }
       else
       {
@@ -2101,6 +2123,13 @@ HAL_StatusTypeDef HAL_I2C_Master_Receive_DMA(I2C_HandleTypeDef *hi2c, uint16_t D
         /* Enable ERR and NACK interrupts */
         I2C_Enable_IRQ(hi2c, I2C_XFER_ERROR_IT);
 
+        /* The DMA covers the whole buffer, only the NBYTES reloads are done on TCR event */
+        if (hi2c->XferCount != 0U)
+        {
+          /* Enable TC interrupts */
+          I2C_Enable_IRQ(hi2c, I2C_XFER_RELOAD_IT);
+        }
+
         /* Enable DMA Request */
         hi2c->Instance->CR1 |= I2C_CR1_RXDMAEN;
       }
@@ -2357,6 +2386,8 @@ HAL_StatusTypeDef HAL_I2C_Slave_Receive_DMA(I2C_HandleTypeDef *hi2c, uint8_t *pD
     return HAL_BUSY;
   }
 }
+#endif /* USE_I2C_DMA */
+
 /**
   * @brief  Write an amount of data in blocking mode to a specific memory address
   * @param  hi2c Pointer to a I2C_HandleTypeDef structure that contains
@@ -2818,6 +2849,8 @@ HAL_StatusTypeDef HAL_I2C_Mem_Read_IT(I2C_HandleTypeDef *hi2c, uint16_t DevAddre
     return HAL_BUSY;
   }
 }
+
+#if (USE_I2C_DMA != 0U)
 /**
   * @brief  Write an amount of data in non-blocking mode with DMA to a specific memory address
   * @param  hi2c Pointer to a I2C_HandleTypeDef structure that contains
@@ -2904,7 +2937,7 @@ HAL_StatusTypeDef HAL_I2C_Mem_Write_DMA(I2C_HandleTypeDef *hi2c, uint16_t DevAdd
 
       /* Enable the DMA channel */
       dmaxferstatus = HAL_DMA_Start_IT(hi2c->hdmatx, (uint32_t)pData, (uint32_t)&hi2c->Instance->TXDR,
-                                       hi2c->XferSize);
+                                       hi2c->XferCount);
     }
     else
     {
@@ -2939,6 +2972,13 @@ HAL_StatusTypeDef HAL_I2C_Mem_Write_DMA(I2C_HandleTypeDef *hi2c, uint16_t DevAdd
       /* Enable ERR and NACK interrupts */
       I2C_Enable_IRQ(hi2c, I2C_XFER_ERROR_IT);
 
+      /* The DMA covers the whole buffer, only the NBYTES reloads are done on TCR event */
+      if (hi2c->XferCount != 0U)
+      {
+        /* Enable TC interrupts */
+        I2C_Enable_IRQ(hi2c, I2C_XFER_RELOAD_IT);
+      }
+
       /* Enable DMA Request */
       hi2c->Instance->CR1 |= I2C_CR1_TXDMAEN;
     }
@@ -3049,7 +3089,7 @@ HAL_StatusTypeDef HAL_I2C_Mem_Read_DMA(I2C_HandleTypeDef *hi2c, uint16_t DevAddr
 
       /* Enable the DMA channel */
       dmaxferstatus = HAL_DMA_Start_IT(hi2c->hdmarx, (uint32_t)&hi2c->Instance->RXDR, (uint32_t)pData,
-                                       hi2c->XferSize);
+                                       hi2c->XferCount);
     }
     else
     {
@@ -3083,6 +3123,13 @@ HAL_StatusTypeDef HAL_I2C_Mem_Read_DMA(I2C_HandleTypeDef *hi2c, uint16_t DevAddr
       /* Enable ERR and NACK interrupts */
       I2C_Enable_IRQ(hi2c, I2C_XFER_ERROR_IT);
 
+      /* The DMA covers the whole buffer, only the NBYTES reloads are done on TCR event */
+      if (hi2c->XferCount != 0U)
+      {
+        /* Enable TC interrupts */
+        I2C_Enable_IRQ(hi2c, I2C_XFER_RELOAD_IT);
+      }
+
       /* Enable DMA Request */
       hi2c->Instance->CR1 |= I2C_CR1_RXDMAEN;
     }
@@ -3108,6 +3155,7 @@ HAL_StatusTypeDef HAL_I2C_Mem_Read_DMA(I2C_HandleTypeDef *hi2c, uint16_t DevAddr
     return HAL_BUSY;
   }
 }
+#endif /* USE_I2C_DMA */
 
 /**
   * @brief  Checks if target device is ready for communication.
@@ -3337,6 +3385,7 @@ HAL_StatusTypeDef HAL_I2C_Master_Seq_Transmit_IT(I2C_HandleTypeDef *hi2c, uint16
   }
 }
 
+#if (USE_I2C_DMA != 0U)
 /**
   * @brief  Sequential transmit in master I2C mode an amount of data in non-blocking mode with DMA.
   * @note   This interface allow to manage repeated start condition when a direction change during transfer
@@ -3422,7 +3471,7 @@ HAL_StatusTypeDef HAL_I2C_Master_Seq_Transmit_DMA(I2C_HandleTypeDef *hi2c, uint1
 
         /* Enable the DMA channel */
         dmaxferstatus = HAL_DMA_Start_IT(hi2c->hdmatx, (uint32_t)pData, (uint32_t)&hi2c->Instance->TXDR,
-                                         hi2c->XferSize);
+                                         hi2c->XferCount);
       }
       else
       {
@@ -3456,6 +3505,13 @@ HAL_StatusTypeDef HAL_I2C_Master_Seq_Transmit_DMA(I2C_HandleTypeDef *hi2c, uint1
         /* Enable ERR and NACK interrupts */
         I2C_Enable_IRQ(hi2c, I2C_XFER_ERROR_IT);
 
+        /* The DMA covers the whole buffer, only the NBYTES reloads are done on TCR event */
+        if (hi2c->XferCount != 0U)
+        {
+          /* Enable TC interrupts */
+          I2C_Enable_IRQ(hi2c, I2C_XFER_RELOAD_IT);
+        }
+
         /* Enable DMA Request */
         hi2c->Instance->CR1 |= I2C_CR1_TXDMAEN;
       }
@@ -3504,6 +3560,7 @@ HAL_StatusTypeDef HAL_I2C_Master_Seq_Transmit_DMA(I2C_HandleTypeDef *hi2c, uint1
     return HAL_BUSY;
   }
 }
+#endif /* USE_I2C_DMA */
 
 /**
   * @brief  Sequential receive in master I2C mode an amount of data in non-blocking mode with Interrupt
@@ -3592,6 +3649,7 @@ HAL_StatusTypeDef HAL_I2C_Master_Seq_Receive_IT(I2C_HandleTypeDef *hi2c, uint16_
   }
 }
 
+#if (USE_I2C_DMA != 0U)
 /**
   * @brief  Sequential receive in master I2C mode an amount of data in non-blocking mode with DMA
   * @note   This interface allow to manage repeated start condition when a direction change during transfer
@@ -3677,7 +3735,7 @@ HAL_StatusTypeDef HAL_I2C_Master_Seq_Receive_DMA(I2C_HandleTypeDef *hi2c, uint16
 
         /* Enable the DMA channel */
         dmaxferstatus = HAL_DMA_Start_IT(hi2c->hdmarx, (uint32_t)&hi2c->Instance->RXDR, (uint32_t)pData,
-                                         hi2c->XferSize);
+                                         hi2c->XferCount);
       }
       else
       {
@@ -3711,6 +3769,13 @@ HAL_StatusTypeDef HAL_I2C_Master_Seq_Receive_DMA(I2C_HandleTypeDef *hi2c, uint16
         /* Enable ERR and NACK interrupts */
         I2C_Enable_IRQ(hi2c, I2C_XFER_ERROR_IT);
 
+        /* The DMA covers the whole buffer, only the NBYTES reloads are done on TCR event */
+        if (hi2c->XferCount != 0U)
+        {
+          /* Enable TC interrupts */
+          I2C_Enable_IRQ(hi2c, I2C_XFER_RELOAD_IT);
+        }
+
         /* Enable DMA Request */
         hi2c->Instance->CR1 |= I2C_CR1_RXDMAEN;
       }
@@ -3759,6 +3824,7 @@ HAL_StatusTypeDef HAL_I2C_Master_Seq_Receive_DMA(I2C_HandleTypeDef *hi2c, uint16
     return HAL_BUSY;
   }
 }
+#endif /* USE_I2C_DMA */
 
 /**
   * @brief  Sequential transmit in slave/device I2C mode an amount of data in non-blocking mode with Interrupt
@@ -3797,6 +3863,7 @@ HAL_StatusTypeDef HAL_I2C_Slave_Seq_Transmit_IT(I2C_HandleTypeDef *hi2c, uint8_t
       /* Disable associated Interrupts */
       I2C_Disable_IRQ(hi2c, I2C_XFER_RX_IT);
 
+#if (USE_I2C_DMA != 0U)
       /* Abort DMA Xfer if any */
       if ((hi2c->Instance->CR1 & I2C_CR1_RXDMAEN) == I2C_CR1_RXDMAEN)
       {
@@ -3816,6 +3883,7 @@ HAL_StatusTypeDef HAL_I2C_Slave_Seq_Transmit_IT(I2C_HandleTypeDef *hi2c, uint8_t
           }
         }
       }
+#endif /* USE_I2C_DMA */
     }
 
     hi2c->State     = HAL_I2C_STATE_BUSY_TX_LISTEN;
@@ -3856,6 +3924,7 @@ HAL_StatusTypeDef HAL_I2C_Slave_Seq_Transmit_IT(I2C_HandleTypeDef *hi2c, uint8_t
   }
 }
 
+#if (USE_I2C_DMA != 0U)
 /**
   * @brief  Sequential transmit in slave/device I2C mode an amount of data in non-blocking mode with DMA
   * @note   This interface allow to manage repeated start condition when a direction change during transfer
@@ -4036,6 +4105,7 @@ HAL_StatusTypeDef HAL_I2C_Slave_Seq_Transmit_DMA(I2C_HandleTypeDef *hi2c, uint8_
     return HAL_ERROR;
   }
 }
+#endif /* USE_I2C_DMA */
 
 /**
   * @brief  Sequential receive in slave/device I2C mode an amount of data in non-blocking mode with Interrupt
@@ -4074,6 +4144,7 @@ HAL_StatusTypeDef HAL_I2C_Slave_Seq_Receive_IT(I2C_HandleTypeDef *hi2c, uint8_t
       /* Disable associated Interrupts */
       I2C_Disable_IRQ(hi2c, I2C_XFER_TX_IT);
 
+#if (USE_I2C_DMA != 0U)
       if ((hi2c->Instance->CR1 & I2C_CR1_TXDMAEN) == I2C_CR1_TXDMAEN)
       {
         hi2c->Instance->CR1 &= ~I2C_CR1_TXDMAEN;
@@ -4093,6 +4164,7 @@ HAL_StatusTypeDef HAL_I2C_Slave_Seq_Receive_IT(I2C_HandleTypeDef *hi2c, uint8_t
           }
         }
       }
+#endif /* USE_I2C_DMA */
     }
 
     hi2c->State     = HAL_I2C_STATE_BUSY_RX_LISTEN;
@@ -4133,6 +4205,7 @@ HAL_StatusTypeDef HAL_I2C_Slave_Seq_Receive_IT(I2C_HandleTypeDef *hi2c, uint8_t
   }
 }
 
+#if (USE_I2C_DMA != 0U)
 /**
   * @brief  Sequential receive in slave/device I2C mode an amount of data in non-blocking mode with DMA
   * @note   This interface allow to manage repeated start condition when a direction change during transfer
@@ -4313,6 +4386,7 @@ HAL_StatusTypeDef HAL_I2C_Slave_Seq_Receive_DMA(I2C_HandleTypeDef *hi2c, uint8_t
     return HAL_ERROR;
   }
 }
+#endif /* USE_I2C_DMA */
 
 /**
   * @brief  Enable the Address listen mode with Interrupt.
@@ -5019,6 +5093,7 @@ static HAL_StatusTypeDef I2C_Slave_ISR_IT(struct __I2C_HandleTypeDef *hi2c, uint
   return HAL_OK;
 }
 
+#if (USE_I2C_DMA != 0U)
 /**
   * @brief  Interrupt Sub-Routine which handle the Interrupt Flags Master Mode with DMA.
   * @param  hi2c Pointer to a I2C_HandleTypeDef structure that contains
@@ -5056,9 +5131,6 @@ static HAL_StatusTypeDef I2C_Master_ISR_DMA(struct __I2C_HandleTypeDef *hi2c, ui
   else if ((I2C_CHECK_FLAG(ITFlags, I2C_FLAG_TCR) != RESET) && \
            (I2C_CHECK_IT_SOURCE(ITSources, I2C_IT_TCI) != RESET))
   {
-    /* Disable TC interrupt */
-    __HAL_I2C_DISABLE_IT(hi2c, I2C_IT_TCI);
-
     if (hi2c->XferCount != 0U)
     {
       /* Recover Slave address */
@@ -5083,24 +5155,23 @@ static HAL_StatusTypeDef I2C_Master_ISR_DMA(struct __I2C_HandleTypeDef *hi2c, ui
         }
       }
 
-      /* Set the new XferSize in Nbytes register */
-      I2C_TransferConfig(hi2c, devaddress, (uint8_t)hi2c->XferSize, xfermode, I2C_NO_STARTSTOP);
-
-      /* Update XferCount value */
+      /* Update XferCount value before the reload, the DMA may end as soon as NBYTES is written */
       hi2c->XferCount -= hi2c->XferSize;
 
-      /* Enable DMA Request */
-      if (hi2c->State == HAL_I2C_STATE_BUSY_RX)
-      {
-        hi2c->Instance->CR1 |= I2C_CR1_RXDMAEN;
-      }
-      else
+      if (hi2c->XferCount == 0U)
       {
-        hi2c->Instance->CR1 |= I2C_CR1_TXDMAEN;
+        /* Last reload: TC interrupt is enabled again at end of DMA transfer */
+        __HAL_I2C_DISABLE_IT(hi2c, I2C_IT_TCI);
       }
+
+      /* Set the new XferSize in Nbytes register, the DMA request is kept enabled */
+      I2C_TransferConfig(hi2c, devaddress, (uint8_t)hi2c->XferSize, xfermode, I2C_NO_STARTSTOP);
     }
     else
     {
+      /* Disable TC interrupt */
+      __HAL_I2C_DISABLE_IT(hi2c, I2C_IT_TCI);
+
       /* Call TxCpltCallback() if no stop mode is set */
       if (I2C_GET_STOP_MODE(hi2c) != I2C_AUTOEND_MODE)
       {
@@ -5299,6 +5370,7 @@ static HAL_StatusTypeDef I2C_Slave_ISR_DMA(struct __I2C_HandleTypeDef *hi2c, uin
 
   return HAL_OK;
 }
+#endif /* USE_I2C_DMA */
 
 /**
   * @brief  Master sends target device address followed by internal memory address for write request.
@@ -5783,7 +5855,9 @@ static void I2C_ITMasterCplt(I2C_HandleTypeDef *hi2c, uint32_t ITFlags)
   */
 static void I2C_ITSlaveCplt(I2C_HandleTypeDef *hi2c, uint32_t ITFlags)
 {
+#if (USE_I2C_DMA != 0U)
   uint32_t tmpcr1value = READ_REG(hi2c->Instance->CR1);
+#endif /* USE_I2C_DMA */
   uint32_t tmpITFlags = ITFlags;
   HAL_I2C_StateTypeDef tmpstate = hi2c->State;
 
@@ -5815,6 +5889,7 @@ static void I2C_ITSlaveCplt(I2C_HandleTypeDef *hi2c, uint32_t ITFlags)
   /* Flush TX register */
   I2C_Flush_TXDR(hi2c);
 
+#if (USE_I2C_DMA != 0U)
   /* If a DMA is ongoing, Update handle size context */
   if (I2C_CHECK_IT_SOURCE(tmpcr1value, I2C_CR1_TXDMAEN) != RESET)
   {
@@ -5840,6 +5915,7 @@ static void I2C_ITSlaveCplt(I2C_HandleTypeDef *hi2c, uint32_t ITFlags)
   {
     /* Do nothing */
   }
+#endif /* USE_I2C_DMA */
 
   /* Store Last receive data if any */
   if (I2C_CHECK_FLAG(tmpITFlags, I2C_FLAG_RXNE) != RESET)
@@ -5994,7 +6070,9 @@ static void I2C_ITListenCplt(I2C_HandleTypeDef *hi2c, uint32_t ITFlags)
 static void I2C_ITError(I2C_HandleTypeDef *hi2c, uint32_t ErrorCode)
 {
   HAL_I2C_StateTypeDef tmpstate = hi2c->State;
+#if (USE_I2C_DMA != 0U)
   uint32_t tmppreviousstate;
+#endif /* USE_I2C_DMA */
 
   /* Reset handle parameters */
   hi2c->Mode          = HAL_I2C_MODE_NONE;
@@ -6031,6 +6109,7 @@ static void I2C_ITError(I2C_HandleTypeDef *hi2c, uint32_t ErrorCode)
     hi2c->XferISR       = NULL;
   }
 
+#if (USE_I2C_DMA != 0U)
   /* Abort DMA TX transfer if any */
   tmppreviousstate = hi2c->PreviousState;
   if ((hi2c->hdmatx != NULL) && ((tmppreviousstate == I2C_STATE_MASTER_BUSY_TX) || \
@@ -6093,6 +6172,7 @@ static void I2C_ITError(I2C_HandleTypeDef *hi2c, uint32_t ErrorCode)
     }
   }
   else
+#endif /* USE_I2C_DMA */
   {
     I2C_TreatErrorCallback(hi2c);
   }
@@ -6157,6 +6237,7 @@ static void I2C_Flush_TXDR(I2C_HandleTypeDef *hi2c)
   }
 }
 
+#if (USE_I2C_DMA != 0U)
 /**
   * @brief  DMA I2C master transmit process complete callback.
   * @param  hdma DMA handle
@@ -6170,41 +6251,8 @@ static void I2C_DMAMasterTransmitCplt(DMA_HandleTypeDef *hdma)
   /* Disable DMA Request */
   hi2c->Instance->CR1 &= ~I2C_CR1_TXDMAEN;
 
-  /* If last transfer, enable STOP interrupt */
-  if (hi2c->XferCount == 0U)
-  {
-    /* Enable STOP interrupt */
-    I2C_Enable_IRQ(hi2c, I2C_XFER_CPLT_IT);
-  }
-  /* else prepare a new DMA transfer and enable TCReload interrupt */
-  else
-  {
-    /* Update Buffer pointer */
-    hi2c->pBuffPtr += hi2c->XferSize;
-
-    /* Set the XferSize to transfer */
-    if (hi2c->XferCount > MAX_NBYTE_SIZE)
-    {
-      hi2c->XferSize = MAX_NBYTE_SIZE;
-    }
-    else
-    {
-      hi2c->XferSize = hi2c->XferCount;
-    }
-
-    /* Enable the DMA channel */
-    if (HAL_DMA_Start_IT(hi2c->hdmatx, (uint32_t)hi2c->pBuffPtr, (uint32_t)&hi2c->Instance->TXDR,
-                         hi2c->XferSize) != HAL_OK)
-    {
-      /* Call the corresponding callback to inform upper layer of End of Transfer */
-      I2C_ITError(hi2c, HAL_I2C_ERROR_DMA);
-    }
-    else
-    {
-      /* Enable TC interrupts */
-      I2C_Enable_IRQ(hi2c, I2C_XFER_RELOAD_IT);
-    }
-  }
+  /* The DMA transfer covers the whole buffer: all the NBYTES reloads are done, enable STOP interrupt */
+  I2C_Enable_IRQ(hi2c, I2C_XFER_CPLT_IT);
 }
 
 /**
@@ -6248,41 +6296,8 @@ static void I2C_DMAMasterReceiveCplt(DMA_HandleTypeDef *hdma)
   /* Disable DMA Request */
   hi2c->Instance->CR1 &= ~I2C_CR1_RXDMAEN;
 
-  /* If last transfer, enable STOP interrupt */
-  if (hi2c->XferCount == 0U)
-  {
-    /* Enable STOP interrupt */
-    I2C_Enable_IRQ(hi2c, I2C_XFER_CPLT_IT);
-  }
-  /* else prepare a new DMA transfer and enable TCReload interrupt */
-  else
-  {
-    /* Update Buffer pointer */
-    hi2c->pBuffPtr += hi2c->XferSize;
-
-    /* Set the XferSize to transfer */
-    if (hi2c->XferCount > MAX_NBYTE_SIZE)
-    {
-      hi2c->XferSize = MAX_NBYTE_SIZE;
-    }
-    else
-    {
-      hi2c->XferSize = hi2c->XferCount;
-    }
-
-    /* Enable the DMA channel */
-    if (HAL_DMA_Start_IT(hi2c->hdmarx, (uint32_t)&hi2c->Instance->RXDR, (uint32_t)hi2c->pBuffPtr,
-                         hi2c->XferSize) != HAL_OK)
-    {
-      /* Call the corresponding callback to inform upper layer of End of Transfer */
-      I2C_ITError(hi2c, HAL_I2C_ERROR_DMA);
-    }
-    else
-    {
-      /* Enable TC interrupts */
-      I2C_Enable_IRQ(hi2c, I2C_XFER_RELOAD_IT);
-    }
-  }
+  /* The DMA transfer covers the whole buffer: all the NBYTES reloads are done, enable STOP interrupt */
+  I2C_Enable_IRQ(hi2c, I2C_XFER_CPLT_IT);
 }
 
 /**
@@ -6353,6 +6368,7 @@ static void I2C_DMAAbort(DMA_HandleTypeDef *hdma)
 
   I2C_TreatErrorCallback(hi2c);
 }
+#endif /* USE_I2C_DMA */
 
 /**
   * @brief  This function handles I2C Communication Timeout. It waits
@@ -6370,6 +6386,9 @@ static HAL_StatusTypeDef I2C_WaitOnFlagUntilTimeout(I2C_HandleTypeDef *hi2c, uin
 {
   while (__HAL_I2C_GET_FLAG(hi2c, Flag) == Status)
   {
+    /* Let the application yield or sleep while waiting */
+    HAL_WaitHook(HAL_WAIT_I2C, hi2c);
+
     /* Check for the Timeout */
     if (Timeout != HAL_MAX_DELAY)
     {
@@ -6401,6 +6420,9 @@ static HAL_StatusTypeDef I2C_WaitOnTXISFlagUntilTimeout(I2C_HandleTypeDef *hi2c,
 {
   while (__HAL_I2C_GET_FLAG(hi2c, I2C_FLAG_TXIS) == RESET)
   {
+    /* Let the application yield or sleep while waiting */
+    HAL_WaitHook(HAL_WAIT_I2C, hi2c);
+
     /* Check if an error is detected */
     if (I2C_IsErrorOccurred(hi2c, Timeout, Tickstart) != HAL_OK)
     {
@@ -6439,6 +6461,9 @@ static HAL_StatusTypeDef I2C_WaitOnSTOPFlagUntilTimeout(I2C_HandleTypeDef *hi2c,
 {
   while (__HAL_I2C_GET_FLAG(hi2c, I2C_FLAG_STOPF) == RESET)
   {
+    /* Let the application yield or sleep while waiting */
+    HAL_WaitHook(HAL_WAIT_I2C, hi2c);
+
     /* Check if an error is detected */
     if (I2C_IsErrorOccurred(hi2c, Timeout, Tickstart) != HAL_OK)
     {
@@ -6474,6 +6499,9 @@ static HAL_StatusTypeDef I2C_WaitOnRXNEFlagUntilTimeout(I2C_HandleTypeDef *hi2c,
 {
   while (__HAL_I2C_GET_FLAG(hi2c, I2C_FLAG_RXNE) == RESET)
   {
+    /* Let the application yield or sleep while waiting */
+    HAL_WaitHook(HAL_WAIT_I2C, hi2c);
+
     /* Check if an error is detected */
     if (I2C_IsErrorOccurred(hi2c, Timeout, Tickstart) != HAL_OK)
     {
@@ -6717,6 +6745,7 @@ static void I2C_Enable_IRQ(I2C_HandleTypeDef *hi2c, uint16_t InterruptRequest)
 {
   uint32_t tmpisr = 0U;
 
+#if (USE_I2C_DMA != 0U)
   if ((hi2c->XferISR == I2C_Master_ISR_DMA) || \
       (hi2c->XferISR == I2C_Slave_ISR_DMA))
   {
@@ -6745,6 +6774,7 @@ static void I2C_Enable_IRQ(I2C_HandleTypeDef *hi2c, uint16_t InterruptRequest)
     }
   }
   else
+#endif /* USE_I2C_DMA */
   {
     if ((InterruptRequest & I2C_XFER_LISTEN_IT) == I2C_XFER_LISTEN_IT)
     {
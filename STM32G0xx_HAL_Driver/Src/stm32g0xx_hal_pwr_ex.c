@@ -761,7 +761,7 @@ uint32_t HAL_PWREx_GetVoltageRange(void)
   */
 HAL_StatusTypeDef HAL_PWREx_ControlVoltageScaling(uint32_t VoltageScaling)
 {
-  uint32_t wait_loop_index;
+  uint32_t startcycle;
 
   assert_param(IS_PWR_VOLTAGE_SCALING_RANGE(VoltageScaling));
 
@@ -771,17 +771,13 @@ HAL_StatusTypeDef HAL_PWREx_ControlVoltageScaling(uint32_t VoltageScaling)
   /* In case of Range 1 selected, we need to ensure that main regulator reaches new value */
   if (VoltageScaling == PWR_REGULATOR_VOLTAGE_SCALE1)
   {
-    /* Set timeout value */
-    wait_loop_index = ((PWR_VOSF_SETTING_DELAY_6_US * SystemCoreClock) / 1000000U) + 1U;
+    /* Get timeout start */
+    startcycle = HAL_GetCycleCount();
 
     /* Wait until VOSF is reset */
     while (HAL_IS_BIT_SET(PWR->SR2, PWR_SR2_VOSF))
     {
-      if (wait_loop_index != 0U)
-      {
-        wait_loop_index--;
-      }
-      else
+      if (HAL_TimeoutUs(startcycle, PWR_VOSF_SETTING_DELAY_6_US) != HAL_OK)
       {
         return HAL_TIMEOUT;
       }
@@ -817,19 +813,16 @@ void HAL_PWREx_EnableLowPowerRunMode(void)
   */
 HAL_StatusTypeDef HAL_PWREx_DisableLowPowerRunMode(void)
 {
-  uint32_t wait_loop_index = ((PWR_REGLPF_SETTING_DELAY_6_US * SystemCoreClock) / 1000000U) + 1U;
+  uint32_t startcycle;
 
   /* Clear LPR bit */
   CLEAR_BIT(PWR->CR1, PWR_CR1_LPR);
 
   /* Wait until REGLPF is reset */
+  startcycle = HAL_GetCycleCount();
   while (HAL_IS_BIT_SET(PWR->SR2, PWR_SR2_REGLPF))
   {
-    if (wait_loop_index != 0U)
-    {
-      wait_loop_index--;
-    }
-    else
+    if (HAL_TimeoutUs(startcycle, PWR_REGLPF_SETTING_DELAY_6_US) != HAL_OK)
     {
       return HAL_TIMEOUT;
     }
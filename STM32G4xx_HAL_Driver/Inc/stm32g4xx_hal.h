@@ -38,6 +38,43 @@ extern "C" {
   */
 
 /* Exported types ------------------------------------------------------------*/
+/** @defgroup HAL_WAIT_REASON Wait Reason
+  * @brief    HAL wait reason, passed to HAL_WaitHook() by the blocking HAL functions
+  * @{
+  */
+typedef enum
+{
+  HAL_WAIT_DELAY = 0x00U,  /*!< HAL_Delay()                                       */
+  HAL_WAIT_UART  = 0x01U,  /*!< UART flag polling, Handle is a UART_HandleTypeDef  */
+  HAL_WAIT_I2C   = 0x02U,  /*!< I2C flag polling, Handle is a I2C_HandleTypeDef    */
+  HAL_WAIT_SPI   = 0x03U,  /*!< SPI flag polling, Handle is a SPI_HandleTypeDef    */
+  HAL_WAIT_FLASH = 0x04U   /*!< FLASH operation, Handle is NULL                    */
+} HAL_WaitReasonTypeDef;
+/**
+  * @}
+  */
+
+#if (USE_HAL_TRACE == 1U)
+/** @defgroup HAL_Exported_Types HAL Exported Types
+  * @{
+  */
+
+/**
+  * @brief  HAL trace record structure definition
+  */
+typedef struct
+{
+  uint32_t Timestamp;   /*!< HAL tick at which the event occurred */
+  uint32_t Id;          /*!< Identifier of the source, address of the handle */
+  uint32_t Event;       /*!< Event, value of @ref HAL_TRACE_Event */
+  uint32_t Arg;         /*!< Event argument: new state, error code or timed out flag */
+} HAL_TraceRecordTypeDef;
+
+/**
+  * @}
+  */
+#endif /* USE_HAL_TRACE */
+
 /* Exported constants --------------------------------------------------------*/
 
 /** @defgroup HAL_Exported_Constants HAL Exported Constants
@@ -195,8 +232,40 @@ extern "C" {
   * @}
   */
 
+#if (USE_HAL_TRACE == 1U)
+/** @defgroup HAL_TRACE_Event HAL Trace Event
+  * @{
+  */
+#define HAL_TRACE_EVENT_STATE      0x00000001U  /*!< Handle state transition, Arg is the new state */
+#define HAL_TRACE_EVENT_ERROR      0x00000002U  /*!< Error reported, Arg is the error code */
+#define HAL_TRACE_EVENT_TIMEOUT    0x00000003U  /*!< Timeout elapsed, Arg is the awaited flag */
+#define HAL_TRACE_EVENT_ABORT      0x00000004U  /*!< Transfer aborted */
+/**
+  * @}
+  */
+#endif /* USE_HAL_TRACE */
+
 /* Exported macros -----------------------------------------------------------*/
 
+/** @defgroup HAL_Exported_Macros HAL Exported Macros
+  * @{
+  */
+/** @brief  Record a HAL event in the trace ring buffer.
+  * @param  __ID__ Source of the event, usually the handle.
+  * @param  __EVENT__ Event, value of @ref HAL_TRACE_Event.
+  * @param  __ARG__ Event argument.
+  * @retval None
+  */
+#if (USE_HAL_TRACE == 1U)
+#define HAL_TRACE(__ID__, __EVENT__, __ARG__) \
+  HAL_TraceRecord((uint32_t)(__ID__), (__EVENT__), (uint32_t)(__ARG__))
+#else
+#define HAL_TRACE(__ID__, __EVENT__, __ARG__) ((void)0U)
+#endif /* USE_HAL_TRACE */
+/**
+  * @}
+  */
+
 /** @defgroup DBGMCU_Exported_Macros DBGMCU Exported Macros
   * @{
   */
@@ -537,6 +606,7 @@ HAL_StatusTypeDef HAL_InitTick(uint32_t TickPriority);
 void HAL_IncTick(void);
 void HAL_Delay(uint32_t Delay);
 uint32_t HAL_GetTick(void);
+void HAL_WaitHook(HAL_WaitReasonTypeDef Reason, const void *Handle);
 uint32_t HAL_GetTickPrio(void);
 HAL_StatusTypeDef HAL_SetTickFreq(uint32_t Freq);
 uint32_t HAL_GetTickFreq(void);
@@ -605,6 +675,21 @@ void HAL_SYSCFG_CCMSRAM_WriteProtectionEnable(uint32_t Page);
   * @}
   */
 
+#if (USE_HAL_TRACE == 1U)
+/** @addtogroup HAL_Exported_Functions_Group5
+  * @{
+  */
+
+/* Trace functions  *************************************************************/
+void HAL_TraceRecord(uint32_t Id, uint32_t Event, uint32_t Arg);
+void HAL_TraceReset(void);
+uint32_t HAL_TraceGetRecords(HAL_TraceRecordTypeDef *pRecords, uint32_t MaxRecords);
+
+/**
+  * @}
+  */
+#endif /* USE_HAL_TRACE */
+
 /**
   * @}
   */
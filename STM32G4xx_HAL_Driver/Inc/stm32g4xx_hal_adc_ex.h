@@ -201,6 +201,61 @@ typedef struct
 } ADC_MultiModeTypeDef;
 #endif /* ADC_MULTIMODE_SUPPORT */
 
+/**
+  * @brief  Structure definition of ADC scope capture
+  * @note   The ADC converts Channel alone, in the resolution of the watchdog thresholds, right aligned, without
+  *         offset nor oversampling, to a circular halfword DMA buffer.
+  */
+typedef struct
+{
+  ADC_HandleTypeDef *hadc;           /*!< ADC handle initialized with DMAContinuousRequests enabled and a circular DMA */
+
+  uint32_t Channel;                  /*!< ADC channel watched by the analog watchdog 1.
+                                          This parameter can be a value of @ref ADC_HAL_EC_CHANNEL */
+
+  uint16_t *pBuffer;                 /*!< Circular DMA buffer of BufferLength samples */
+
+  uint32_t BufferLength;             /*!< Number of samples of pBuffer, even */
+
+  uint32_t HighThreshold;            /*!< Trigger when a sample is above this value */
+
+  uint32_t LowThreshold;             /*!< Trigger when a sample is below this value */
+
+  uint32_t PreTrigger;               /*!< Number of samples kept before the trigger sample */
+
+  uint32_t PostTrigger;              /*!< Number of samples kept from the trigger sample included, at least 1.
+                                          PreTrigger + PostTrigger must not exceed BufferLength / 2 */
+
+  __IO uint32_t State;               /*!< Capture state.
+                                          This parameter can be a value of @ref ADCEx_Scope_State */
+
+  uint32_t TriggerPosition;          /*!< Index in pBuffer of the trigger sample */
+
+  uint32_t Elapsed;                  /*!< Number of samples converted from the trigger sample included */
+
+  uint32_t LastPosition;             /*!< DMA buffer position at the last update of Elapsed */
+
+} ADCEx_ScopeTypeDef;
+
+/**
+  * @brief  Structure definition of ADC scope capture window
+  * @note   The window is read in place: pFirst holds the oldest samples up to the end of the DMA buffer, pSecond
+  *         the remaining samples from the start of the DMA buffer. SecondLength is 0 when the window does not wrap.
+  */
+typedef struct
+{
+  uint16_t *pFirst;                  /*!< Oldest samples of the window */
+
+  uint32_t FirstLength;              /*!< Number of samples at pFirst */
+
+  uint16_t *pSecond;                 /*!< Newest samples of the window, at the start of the DMA buffer */
+
+  uint32_t SecondLength;             /*!< Number of samples at pSecond */
+
+  uint32_t TriggerOffset;            /*!< Index of the trigger sample in the window (equal to PreTrigger) */
+
+} ADCEx_ScopeWindowTypeDef;
+
 /**
   * @}
   */
@@ -269,6 +324,18 @@ typedef struct
   * @}
   */
 
+/** @defgroup ADCEx_Scope_State ADC Extended scope capture state
+  * @{
+  */
+#define ADC_SCOPE_STATE_RESET      (0x00000000UL) /*!< Capture not started                                      */
+#define ADC_SCOPE_STATE_ARMED      (0x00000001UL) /*!< Conversions running, waiting for the trigger             */
+#define ADC_SCOPE_STATE_TRIGGERED  (0x00000002UL) /*!< Trigger detected, converting the post-trigger samples    */
+#define ADC_SCOPE_STATE_DONE       (0x00000003UL) /*!< Conversions stopped, window available                    */
+#define ADC_SCOPE_STATE_ERROR      (0x00000004UL) /*!< Conversions stopped too late, pre-trigger samples lost   */
+/**
+  * @}
+  */
+
 /** @defgroup ADC_HAL_EC_CHANNEL_SINGLE_DIFF_ENDING  Channel - Single or differential ending
   * @{
   */
@@ -1369,6 +1436,21 @@ HAL_StatusTypeDef       HAL_ADCEx_DisableInjectedQueue(ADC_HandleTypeDef *hadc);
 HAL_StatusTypeDef       HAL_ADCEx_DisableVoltageRegulator(ADC_HandleTypeDef *hadc);
 HAL_StatusTypeDef       HAL_ADCEx_EnterADCDeepPowerDownMode(ADC_HandleTypeDef *hadc);
 
+/**
+  * @}
+  */
+
+/** @addtogroup ADCEx_Exported_Functions_Group3
+  * @{
+  */
+/* Scope capture functions ****************************************************/
+HAL_StatusTypeDef       HAL_ADCEx_Scope_Start(ADCEx_ScopeTypeDef *pScope);
+HAL_StatusTypeDef       HAL_ADCEx_Scope_Stop(ADCEx_ScopeTypeDef *pScope);
+HAL_StatusTypeDef       HAL_ADCEx_Scope_GetWindow(const ADCEx_ScopeTypeDef *pScope, ADCEx_ScopeWindowTypeDef *pWindow);
+void                    HAL_ADCEx_Scope_TriggerHandler(ADCEx_ScopeTypeDef *pScope);
+void                    HAL_ADCEx_Scope_ConvHandler(ADCEx_ScopeTypeDef *pScope);
+void                    HAL_ADCEx_ScopeCpltCallback(ADCEx_ScopeTypeDef *pScope);
+
 /**
   * @}
   */
@@ -43,14 +43,18 @@ extern "C" {
 #define HAL_CRYP_MODULE_ENABLED
 #define HAL_DAC_MODULE_ENABLED
 #define HAL_DMA_MODULE_ENABLED
+/*#define HAL_DSP_MODULE_ENABLED */  /* CMSIS-DSP compatible functions, needs CMSIS-DSP (arm_math.h) */
+#define HAL_EEPROM_EMUL_MODULE_ENABLED
 #define HAL_EXTI_MODULE_ENABLED
 #define HAL_FDCAN_MODULE_ENABLED
 #define HAL_FLASH_MODULE_ENABLED
 #define HAL_FMAC_MODULE_ENABLED
+#define HAL_FOC_MODULE_ENABLED
 #define HAL_GPIO_MODULE_ENABLED
 #define HAL_HRTIM_MODULE_ENABLED
 #define HAL_IRDA_MODULE_ENABLED
 #define HAL_IWDG_MODULE_ENABLED
+#define HAL_LINM_MODULE_ENABLED
 #define HAL_I2C_MODULE_ENABLED
 #define HAL_I2S_MODULE_ENABLED
 #define HAL_LPTIM_MODULE_ENABLED
@@ -69,6 +73,7 @@ extern "C" {
 #define HAL_SPI_MODULE_ENABLED
 #define HAL_SRAM_MODULE_ENABLED
 #define HAL_TIM_MODULE_ENABLED
+#define HAL_UCPD_MODULE_ENABLED
 #define HAL_UART_MODULE_ENABLED
 #define HAL_USART_MODULE_ENABLED
 #define HAL_WWDG_MODULE_ENABLED
@@ -105,6 +110,7 @@ extern "C" {
 #define USE_HAL_SRAM_REGISTER_CALLBACKS       0U
 #define USE_HAL_TIM_REGISTER_CALLBACKS        0U
 #define USE_HAL_UART_REGISTER_CALLBACKS       0U
+#define USE_HAL_UART_CONST_CALLBACKS          0U
 #define USE_HAL_USART_REGISTER_CALLBACKS      0U
 #define USE_HAL_WWDG_REGISTER_CALLBACKS       0U
 
@@ -182,10 +188,21 @@ The real value may vary depending on the variations in voltage and temperature.*
 #define  VDD_VALUE                    (3300UL) /*!< Value of VDD in mv */
 #define  TICK_INT_PRIORITY            (0x0FUL) /*!< tick interrupt priority */
 #define  USE_RTOS                     0U
+#define  USE_HAL_ATOMIC_LOCK          0U /*!< 1: handle lock safe between interrupt and thread */
+#define  USE_HAL_NO_LOCK              0U /*!< 1: handle lock compiled out, single context only */
 #define  PREFETCH_ENABLE              0U
 #define  INSTRUCTION_CACHE_ENABLE     1U
 #define  DATA_CACHE_ENABLE            1U
 
+/* TRACE FEATURE: Use to activate the HAL event trace ring buffer
+ * Activated: HAL drivers record state transitions, errors, timeouts and aborts
+ *            in a ring buffer located in a no-init RAM section (".noinit"),
+ *            which survives a reset and can be dumped after it
+ * Deactivated: trace code cleaned from drivers
+ */
+#define  USE_HAL_TRACE                0U
+#define  HAL_TRACE_BUFFER_SIZE        64U  /*!< Number of records, must be a power of 2 */
+
 /* ########################## Assert Selection ############################## */
 /**
   * @brief Uncomment the line below to expanse the "assert_param" macro in the
@@ -202,6 +219,15 @@ The real value may vary depending on the variations in voltage and temperature.*
 
 #define USE_SPI_CRC                   1U
 
+/* ################## DMA peripheral configuration ########################## */
+
+/* STATISTICS FEATURE: Use to activate transfer statistics inside HAL DMA Driver
+ * Activated: each DMA handle records transfer counters and DWT cycle timestamps
+ * Deactivated: statistics code cleaned from driver
+ */
+
+#define USE_HAL_DMA_STATISTICS        0U
+
 /* Includes ------------------------------------------------------------------*/
 /**
   * @brief Include module's header file
@@ -259,6 +285,10 @@ The real value may vary depending on the variations in voltage and temperature.*
 #include "stm32g4xx_hal_flash.h"
 #endif /* HAL_FLASH_MODULE_ENABLED */
 
+#ifdef HAL_EEPROM_EMUL_MODULE_ENABLED
+#include "stm32g4xx_hal_eeprom_emul.h"
+#endif /* HAL_EEPROM_EMUL_MODULE_ENABLED */
+
 #ifdef HAL_FMAC_MODULE_ENABLED
 #include "stm32g4xx_hal_fmac.h"
 #endif /* HAL_FMAC_MODULE_ENABLED */
@@ -343,6 +373,15 @@ The real value may vary depending on the variations in voltage and temperature.*
 #include "stm32g4xx_hal_tim.h"
 #endif /* HAL_TIM_MODULE_ENABLED */
 
+/* FOC uses the ADC and TIM handles, it is included after them */
+#ifdef HAL_FOC_MODULE_ENABLED
+#include "stm32g4xx_hal_foc.h"
+#endif /* HAL_FOC_MODULE_ENABLED */
+
+#ifdef HAL_UCPD_MODULE_ENABLED
+#include "stm32g4xx_hal_ucpd.h"
+#endif /* HAL_UCPD_MODULE_ENABLED */
+
 #ifdef HAL_UART_MODULE_ENABLED
 #include "stm32g4xx_hal_uart.h"
 #endif /* HAL_UART_MODULE_ENABLED */
@@ -351,6 +390,11 @@ The real value may vary depending on the variations in voltage and temperature.*
 #include "stm32g4xx_hal_usart.h"
 #endif /* HAL_USART_MODULE_ENABLED */
 
+/* LINM uses the UART and TIM handles, it is included after them */
+#ifdef HAL_LINM_MODULE_ENABLED
+#include "stm32g4xx_hal_linm.h"
+#endif /* HAL_LINM_MODULE_ENABLED */
+
 #ifdef HAL_WWDG_MODULE_ENABLED
 #include "stm32g4xx_hal_wwdg.h"
 #endif /* HAL_WWDG_MODULE_ENABLED */
@@ -75,6 +75,10 @@ typedef struct
 
   uint32_t                      DMADirection; /*!< Direction of CORDIC DMA transfers */
 
+  const struct __CORDIC_StepTypeDef *pStep;  /*!< Pointer to the CORDIC program step in progress */
+
+  uint32_t                      NbStepsLeft; /*!< Remaining number of CORDIC program steps after the current one */
+
   DMA_HandleTypeDef             *hdmaIn;     /*!< CORDIC peripheral input data DMA handle parameters */
 
   DMA_HandleTypeDef             *hdmaOut;    /*!< CORDIC peripheral output data DMA handle parameters */
@@ -125,6 +129,22 @@ typedef struct
 
 } CORDIC_ConfigTypeDef;
 
+/**
+  * @brief  CORDIC program step Structure definition
+  */
+typedef struct __CORDIC_StepTypeDef
+{
+  uint32_t   CSR;          /*!< CORDIC control register value of the step, function and data format,
+                                built by HAL_CORDIC_StepInit() or __HAL_CORDIC_CONFIG_CSR() */
+
+  const int32_t *pInBuff;  /*!< Pointer to the input data of the step */
+
+  int32_t   *pOutBuff;     /*!< Pointer to the output data of the step */
+
+  uint32_t   NbCalc;       /*!< Number of calculations of the step */
+
+} CORDIC_StepTypeDef;
+
 #if USE_HAL_CORDIC_REGISTER_CALLBACKS == 1
 /**
   * @brief  HAL CORDIC Callback ID enumeration definition
@@ -405,6 +425,22 @@ typedef  void (*pCORDIC_CallbackTypeDef)(CORDIC_HandleTypeDef *hcordic);  /*!< p
 #define __HAL_CORDIC_GET_IT_SOURCE(__HANDLE__, __INTERRUPT__)                 \
         (((__HANDLE__)->Instance->CSR) & (__INTERRUPT__))
 
+/** @brief  Build the CORDIC control register value of a configuration, for the program
+  *         steps and the inline calculation functions.
+  * @param  __FUNCTION__ Function, a value of @ref CORDIC_Function
+  * @param  __PRECISION__ Precision, a value of @ref CORDIC_Precision_In_Cycles_Number
+  * @param  __SCALE__ Scaling factor, a value of @ref CORDIC_Scale
+  * @param  __NBWRITE__ Number of 32-bit write, a value of @ref CORDIC_Nb_Write
+  * @param  __NBREAD__ Number of 32-bit read, a value of @ref CORDIC_Nb_Read
+  * @param  __INSIZE__ Width of input data, a value of @ref CORDIC_In_Size
+  * @param  __OUTSIZE__ Width of output data, a value of @ref CORDIC_Out_Size
+  * @retval CORDIC control register value
+  */
+#define __HAL_CORDIC_CONFIG_CSR(__FUNCTION__, __PRECISION__, __SCALE__, __NBWRITE__, __NBREAD__, \
+                                __INSIZE__, __OUTSIZE__)                                         \
+        ((__FUNCTION__) | (__PRECISION__) | (__SCALE__) | (__NBWRITE__) | (__NBREAD__) |         \
+         (__INSIZE__) | (__OUTSIZE__))
+
 /**
   * @}
   */
@@ -507,6 +543,13 @@ typedef  void (*pCORDIC_CallbackTypeDef)(CORDIC_HandleTypeDef *hcordic);  /*!< p
                                              ((__DMADIR__) == CORDIC_DMA_DIR_OUT) || \
                                              ((__DMADIR__) == CORDIC_DMA_DIR_IN_OUT))
 
+/**
+  * @brief  CORDIC control register configuration fields.
+  */
+#define CORDIC_CSR_CONFIG_MASK              (CORDIC_CSR_FUNC | CORDIC_CSR_PRECISION | CORDIC_CSR_SCALE | \
+                                             CORDIC_CSR_NARGS | CORDIC_CSR_NRES | CORDIC_CSR_ARGSIZE |   \
+                                             CORDIC_CSR_RESSIZE)
+
 /**
   * @}
   */
@@ -543,6 +586,11 @@ HAL_StatusTypeDef HAL_CORDIC_Calculate(CORDIC_HandleTypeDef *hcordic, int32_t *p
 HAL_StatusTypeDef HAL_CORDIC_CalculateZO(CORDIC_HandleTypeDef *hcordic, int32_t *pInBuff, int32_t *pOutBuff, uint32_t NbCalc, uint32_t Timeout);
 HAL_StatusTypeDef HAL_CORDIC_Calculate_IT(CORDIC_HandleTypeDef *hcordic, int32_t *pInBuff, int32_t *pOutBuff, uint32_t NbCalc);
 HAL_StatusTypeDef HAL_CORDIC_Calculate_DMA(CORDIC_HandleTypeDef *hcordic, int32_t *pInBuff, int32_t *pOutBuff, uint32_t NbCalc, uint32_t DMADirection);
+
+/* Program functions **********************************************************/
+void HAL_CORDIC_StepInit(CORDIC_StepTypeDef *pStep, const CORDIC_ConfigTypeDef *sConfig, const int32_t *pInBuff, int32_t *pOutBuff, uint32_t NbCalc);
+HAL_StatusTypeDef HAL_CORDIC_CalculateProgramZO(CORDIC_HandleTypeDef *hcordic, const CORDIC_StepTypeDef *pSteps, uint32_t NbSteps);
+HAL_StatusTypeDef HAL_CORDIC_CalculateProgram_DMA(CORDIC_HandleTypeDef *hcordic, const CORDIC_StepTypeDef *pSteps, uint32_t NbSteps);
 /**
   * @}
   */
@@ -576,6 +624,73 @@ uint32_t HAL_CORDIC_GetError(CORDIC_HandleTypeDef *hcordic);
   * @}
   */
 
+/** @defgroup CORDIC_Exported_Functions_Group6 Inline Zero-Overhead calculation functions
+  * @{
+  */
+/* Inline Zero-Overhead calculation functions *********************************/
+
+/**
+  * @brief  Carry out one calculation with one input and one output data in Zero-Overhead mode.
+  * @note   The CORDIC control register is written only when CSR differs from the current
+  *         configuration. With a constant CSR, the call is reduced to a few instructions.
+  * @note   The handle state is not checked: no IT or DMA calculation must be in progress.
+  * @param  hcordic pointer to a CORDIC_HandleTypeDef structure.
+  * @param  CSR CORDIC control register value, built by __HAL_CORDIC_CONFIG_CSR()
+  *         with CORDIC_NBWRITE_1 and CORDIC_NBREAD_1.
+  * @param  InData Input data
+  * @retval Output data
+  */
+__STATIC_INLINE int32_t HAL_CORDIC_CalculateOneZO(CORDIC_HandleTypeDef *hcordic, uint32_t CSR, int32_t InData)
+{
+  if ((READ_REG(hcordic->Instance->CSR) & CORDIC_CSR_CONFIG_MASK) != CSR)
+  {
+    WRITE_REG(hcordic->Instance->CSR, CSR);
+  }
+
+  WRITE_REG(hcordic->Instance->WDATA, (uint32_t)InData);
+
+  /* The read is stalled until the result is ready */
+  return (int32_t)READ_REG(hcordic->Instance->RDATA);
+}
+
+/**
+  * @brief  Carry out one calculation with up to two input and two output data in Zero-Overhead mode.
+  * @note   The second data are written and read according to CORDIC_CSR_NARGS and
+  *         CORDIC_CSR_NRES in CSR, pOutData2 can be NULL with CORDIC_NBREAD_1.
+  * @note   The handle state is not checked: no IT or DMA calculation must be in progress.
+  * @param  hcordic pointer to a CORDIC_HandleTypeDef structure.
+  * @param  CSR CORDIC control register value, built by __HAL_CORDIC_CONFIG_CSR().
+  * @param  InData1 First input data
+  * @param  InData2 Second input data
+  * @param  pOutData1 Pointer to the first output data
+  * @param  pOutData2 Pointer to the second output data
+  * @retval None
+  */
+__STATIC_INLINE void HAL_CORDIC_CalculateTwoZO(CORDIC_HandleTypeDef *hcordic, uint32_t CSR, int32_t InData1, int32_t InData2,
+                                               int32_t *pOutData1, int32_t *pOutData2)
+{
+  if ((READ_REG(hcordic->Instance->CSR) & CORDIC_CSR_CONFIG_MASK) != CSR)
+  {
+    WRITE_REG(hcordic->Instance->CSR, CSR);
+  }
+
+  WRITE_REG(hcordic->Instance->WDATA, (uint32_t)InData1);
+  if ((CSR & CORDIC_CSR_NARGS) != 0U)
+  {
+    WRITE_REG(hcordic->Instance->WDATA, (uint32_t)InData2);
+  }
+
+  /* The read is stalled until the result is ready */
+  *pOutData1 = (int32_t)READ_REG(hcordic->Instance->RDATA);
+  if ((CSR & CORDIC_CSR_NRES) != 0U)
+  {
+    *pOutData2 = (int32_t)READ_REG(hcordic->Instance->RDATA);
+  }
+}
+/**
+  * @}
+  */
+
 /**
   * @}
   */
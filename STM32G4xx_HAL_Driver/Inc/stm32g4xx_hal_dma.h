@@ -108,6 +108,40 @@ typedef enum
 
 } HAL_DMA_CallbackIDTypeDef;
 
+#if defined(USE_HAL_DMA_STATISTICS) && (USE_HAL_DMA_STATISTICS == 1U)
+/**
+  * @brief  DMA transfer statistics structure definition
+  * @note   Cycle values are DWT->CYCCNT samples: the application must enable the
+  *         cycle counter (TRCENA bit of CoreDebug->DEMCR, then CYCCNTENA bit of
+  *         DWT->CTRL) for the timing fields to be meaningful.
+  */
+typedef struct
+{
+  uint32_t XferCount;          /*!< Number of transfer complete events                        */
+
+  uint32_t XferBytes;          /*!< Number of bytes moved by the completed transfers          */
+
+  uint32_t XferLength;         /*!< Size in bytes of the transfer in progress                 */
+
+  uint32_t ErrorCount;         /*!< Number of transfer error events                           */
+
+  uint32_t ErrorFlags;         /*!< Accumulated @ref DMA_Error_Code values                     */
+
+  uint32_t BusyCount;          /*!< Number of start requests rejected while busy              */
+
+  uint32_t StartCycle;         /*!< Cycle counter at the start of the current transfer        */
+
+  uint32_t IrqEntryCycle;      /*!< Cycle counter at the entry of the last DMA interrupt      */
+
+  uint32_t CallbackExitCycle;  /*!< Cycle counter when the last DMA interrupt returned         */
+
+  uint32_t MaxXferCycles;      /*!< Longest start to transfer complete interrupt delay        */
+
+  uint32_t MaxIrqCycles;       /*!< Longest interrupt entry to callback exit delay            */
+
+} DMA_StatisticsTypeDef;
+#endif /* USE_HAL_DMA_STATISTICS */
+
 /**
   * @brief  DMA handle Structure definition
   */
@@ -149,6 +183,10 @@ typedef struct __DMA_HandleTypeDef
 
   uint32_t                         DMAmuxRequestGenStatusMask;                       /*!< DMAMUX request generator Status mask */
 
+#if defined(USE_HAL_DMA_STATISTICS) && (USE_HAL_DMA_STATISTICS == 1U)
+  DMA_StatisticsTypeDef            Statistics;                                       /*!< DMA transfer statistics */
+#endif /* USE_HAL_DMA_STATISTICS */
+
 } DMA_HandleTypeDef;
 /**
   * @}
@@ -770,6 +808,7 @@ HAL_StatusTypeDef HAL_DMA_DeInit(DMA_HandleTypeDef *hdma);
 HAL_StatusTypeDef HAL_DMA_Start(DMA_HandleTypeDef *hdma, uint32_t SrcAddress, uint32_t DstAddress, uint32_t DataLength);
 HAL_StatusTypeDef HAL_DMA_Start_IT(DMA_HandleTypeDef *hdma, uint32_t SrcAddress, uint32_t DstAddress,
                                    uint32_t DataLength);
+HAL_StatusTypeDef HAL_DMA_ReArm_IT(DMA_HandleTypeDef *hdma, uint32_t MemAddress, uint32_t DataLength);
 HAL_StatusTypeDef HAL_DMA_Abort(DMA_HandleTypeDef *hdma);
 HAL_StatusTypeDef HAL_DMA_Abort_IT(DMA_HandleTypeDef *hdma);
 HAL_StatusTypeDef HAL_DMA_PollForTransfer(DMA_HandleTypeDef *hdma, HAL_DMA_LevelCompleteTypeDef CompleteLevel,
@@ -788,6 +827,78 @@ HAL_StatusTypeDef HAL_DMA_UnRegisterCallback(DMA_HandleTypeDef *hdma, HAL_DMA_Ca
 /* Peripheral State and Error functions ***************************************/
 HAL_DMA_StateTypeDef HAL_DMA_GetState(DMA_HandleTypeDef *hdma);
 uint32_t             HAL_DMA_GetError(DMA_HandleTypeDef *hdma);
+#if defined(USE_HAL_DMA_STATISTICS) && (USE_HAL_DMA_STATISTICS == 1U)
+const DMA_StatisticsTypeDef *HAL_DMA_GetStatistics(const DMA_HandleTypeDef *hdma);
+void                        HAL_DMA_ResetStatistics(DMA_HandleTypeDef *hdma);
+#endif /* USE_HAL_DMA_STATISTICS */
+/**
+  * @}
+  */
+
+/** @defgroup DMA_Exported_Functions_Group4 Direct transfer functions
+  * @brief    Start, abort and counter functions with the same prototypes on
+  *           every family, reduced to the register writes of the controller. The
+  *           start and counter functions are inline.
+  * @{
+  */
+
+/**
+  * @brief  Starts the DMA transfer with the minimum register writes.
+  * @note   No parameter check, no lock and no handle state update are done: the
+  *         channel must have been configured with HAL_DMA_Init() and its previous
+  *         transfer must be completed or aborted. The channel stays enabled at the
+  *         end of a normal mode transfer, so it is disabled here before CNDTR and
+  *         CMAR, read-only while enabled, are written. The interrupt enables are
+  *         left as already programmed.
+  * @param  hdma       pointer to a DMA_HandleTypeDef structure that contains
+  *                     the configuration information for the specified DMA Channel.
+  * @param  SrcAddress The source memory Buffer address
+  * @param  DstAddress The destination memory Buffer address
+  * @param  DataLength The length of data to be transferred from source to destination
+  * @retval None
+  */
+__STATIC_INLINE void HAL_DMA_Direct_Start(DMA_HandleTypeDef *hdma, uint32_t SrcAddress, uint32_t DstAddress,
+                                          uint32_t DataLength)
+{
+  /* Disable the channel, left enabled at the end of the previous transfer */
+  hdma->Instance->CCR &= ~DMA_CCR_EN;
+
+  /* Clear the DMAMUX synchro overrun flag */
+  hdma->DMAmuxChannelStatus->CFR = hdma->DMAmuxChannelStatusMask;
+
+  /* Clear all flags */
+  hdma->DmaBaseAddress->IFCR = (DMA_ISR_GIF1 << (hdma->ChannelIndex & 0x1FU));
+
+  hdma->Instance->CNDTR = DataLength;
+
+  /* Memory to Peripheral */
+  if (hdma->Init.Direction == DMA_MEMORY_TO_PERIPH)
+  {
+    hdma->Instance->CPAR = DstAddress;
+    hdma->Instance->CMAR = SrcAddress;
+  }
+  /* Peripheral to Memory or Memory to Memory */
+  else
+  {
+    hdma->Instance->CPAR = SrcAddress;
+    hdma->Instance->CMAR = DstAddress;
+  }
+
+  hdma->Instance->CCR |= DMA_CCR_EN;
+}
+
+HAL_StatusTypeDef HAL_DMA_Direct_Abort(DMA_HandleTypeDef *hdma);
+
+/**
+  * @brief  Returns the number of data units remaining in the current transfer.
+  * @param  hdma       pointer to a DMA_HandleTypeDef structure that contains
+  *                     the configuration information for the specified DMA Channel.
+  * @retval Number of remaining data units
+  */
+__STATIC_INLINE uint32_t HAL_DMA_Direct_GetCounter(const DMA_HandleTypeDef *hdma)
+{
+  return hdma->Instance->CNDTR;
+}
 /**
   * @}
   */
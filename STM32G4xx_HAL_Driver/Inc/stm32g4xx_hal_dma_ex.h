@@ -87,6 +87,45 @@ typedef struct
 
 } HAL_DMA_MuxRequestGeneratorConfigTypeDef;
 
+/**
+  * @brief  HAL DMAMUX trigger chain stage structure definition
+  */
+typedef struct
+{
+  DMA_HandleTypeDef *hdma;  /*!< Handle of the DMA channel executing the stage, initialized with HAL_DMA_Init().
+                                 Init.Request is either a peripheral request or DMA_REQUEST_GENERATOR0..3 */
+
+  uint32_t SrcAddress;      /*!< Source address of the stage transfer */
+
+  uint32_t DstAddress;      /*!< Destination address of the stage transfer */
+
+  uint32_t DataLength;      /*!< Length of the stage transfer, from 1 to 65535 data */
+
+  uint32_t BurstLength;     /*!< Specifies the number of DMA requests served each time the stage is triggered.
+                                 This parameter must be a number between Min_Data = 1 and Max_Data = 32 */
+
+} HAL_DMA_MuxChainStageTypeDef;
+
+/**
+  * @brief  HAL DMAMUX trigger chain structure definition
+  */
+typedef struct
+{
+  uint32_t TriggerSignalID;   /*!< Specifies the signal triggering the first stage of the chain.
+                                   This parameter can be a value of @ref DMAEx_DMAMUX_SignalGeneratorID_selection */
+
+  uint32_t TriggerPolarity;   /*!< Specifies the edge of the trigger signal starting a burst of the first stage.
+                                   This parameter can be a value of @ref DMAEx_DMAMUX_RequestGeneneratorPolarity_selection.
+                                   HAL_DMAMUX_REQ_GEN_NO_EVENT lets a first stage using a peripheral request
+                                   (e.g. a timer update request) run freely on that request */
+
+  uint32_t NbStages;          /*!< Number of stages of the chain, each stage but the first one is triggered by
+                                   the DMAMUX event of the previous stage */
+
+  HAL_DMA_MuxChainStageTypeDef *pStages;  /*!< Array of NbStages stages */
+
+} HAL_DMA_MuxChainTypeDef;
+
 /**
   * @}
   */
@@ -205,6 +244,12 @@ HAL_StatusTypeDef HAL_DMAEx_DisableMuxRequestGenerator(DMA_HandleTypeDef *hdma);
 HAL_StatusTypeDef HAL_DMAEx_ConfigMuxSync(DMA_HandleTypeDef *hdma, HAL_DMA_MuxSyncConfigTypeDef *pSyncConfig);
 /* -------------------------------------------------------------------------- */
 
+/* ------------------------- TRIGGER CHAIN -----------------------------------*/
+HAL_StatusTypeDef HAL_DMAEx_ConfigMuxChain(HAL_DMA_MuxChainTypeDef *pChain);
+HAL_StatusTypeDef HAL_DMAEx_StartMuxChain(HAL_DMA_MuxChainTypeDef *pChain);
+HAL_StatusTypeDef HAL_DMAEx_StopMuxChain(HAL_DMA_MuxChainTypeDef *pChain);
+/* -------------------------------------------------------------------------- */
+
 void HAL_DMAEx_MUX_IRQHandler(DMA_HandleTypeDef *hdma);
 
 /**
@@ -239,6 +284,8 @@ void HAL_DMAEx_MUX_IRQHandler(DMA_HandleTypeDef *hdma);
 
 #define IS_DMAMUX_REQUEST_GEN_REQUEST_NUMBER(REQUEST_NUMBER) (((REQUEST_NUMBER) > 0U) && ((REQUEST_NUMBER) <= 32U))
 
+#define IS_DMAMUX_CHAIN_BURST_LENGTH(LENGTH) (((LENGTH) > 0U) && ((LENGTH) <= 32U))
+
 #define IS_DMAMUX_REQUEST_GEN_POLARITY(POLARITY) (((POLARITY) == HAL_DMAMUX_REQ_GEN_NO_EVENT)   || \
                                                   ((POLARITY) == HAL_DMAMUX_REQ_GEN_RISING)  || \
                                                   ((POLARITY) == HAL_DMAMUX_REQ_GEN_FALLING) || \
@@ -0,0 +1,140 @@
+/**
+  ******************************************************************************
+  * @file    stm32g4xx_hal_dsp.h
+  * @author  MCD Application Team
+  * @brief   Header for stm32g4xx_hal_dsp.c module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef STM32G4xx_HAL_DSP_H
+#define STM32G4xx_HAL_DSP_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32g4xx_hal.h"
+#include "arm_math.h"
+
+#if defined(FMAC) && defined(CORDIC)
+
+/** @addtogroup STM32G4xx_HAL_Driver
+  * @{
+  */
+
+/** @addtogroup DSP
+  * @{
+  */
+
+/* Exported constants --------------------------------------------------------*/
+/** @defgroup DSP_Exported_Constants DSP Exported Constants
+  * @{
+  */
+
+/** @defgroup DSP_Hardware_Thresholds DSP Hardware Thresholds
+  * @brief    Smallest blocks processed by the FMAC, smaller blocks are processed by
+  *           CMSIS-DSP. They can be overridden in stm32g4xx_hal_conf.h.
+  * @{
+  */
+#if !defined(HAL_DSP_FIR_MIN_BLOCK_SIZE)
+#define HAL_DSP_FIR_MIN_BLOCK_SIZE         32U                        /*!< Smallest FIR block run on FMAC    */
+#endif /* HAL_DSP_FIR_MIN_BLOCK_SIZE */
+
+#if !defined(HAL_DSP_BIQUAD_MIN_BLOCK_SIZE)
+#define HAL_DSP_BIQUAD_MIN_BLOCK_SIZE      8U                         /*!< Smallest biquad block run on FMAC */
+#endif /* HAL_DSP_BIQUAD_MIN_BLOCK_SIZE */
+
+#if !defined(HAL_DSP_CORDIC_PRECISION)
+#define HAL_DSP_CORDIC_PRECISION           CORDIC_PRECISION_6CYCLES   /*!< CORDIC precision of the q31 functions,
+                                                                           a value of @ref CORDIC_Precision_In_Cycles_Number */
+#endif /* HAL_DSP_CORDIC_PRECISION */
+
+#if !defined(HAL_DSP_FMAC_TIMEOUT)
+#define HAL_DSP_FMAC_TIMEOUT               10U                        /*!< FMAC polling time-out in ms       */
+#endif /* HAL_DSP_FMAC_TIMEOUT */
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/* Exported functions --------------------------------------------------------*/
+/** @addtogroup DSP_Exported_Functions
+  * @{
+  */
+
+/** @addtogroup DSP_Exported_Functions_Group1
+  * @{
+  */
+/* Initialization and de-initialization functions *****************************/
+HAL_StatusTypeDef HAL_DSP_Init(FMAC_HandleTypeDef *hfmac, CORDIC_HandleTypeDef *hcordic);
+void HAL_DSP_DeInit(void);
+/**
+  * @}
+  */
+
+/** @addtogroup DSP_Exported_Functions_Group2
+  * @{
+  */
+/* CMSIS-DSP compatible functions *********************************************/
+void HAL_DSP_FIR_q15(const arm_fir_instance_q15 *S, const q15_t *pSrc, q15_t *pDst, uint32_t blockSize);
+void HAL_DSP_BiquadCascadeDF1_q15(const arm_biquad_casd_df1_inst_q15 *S, const q15_t *pSrc, q15_t *pDst,
+                                  uint32_t blockSize);
+void HAL_DSP_SinCos_q31(q31_t theta, q31_t *pSinVal, q31_t *pCosVal);
+void HAL_DSP_CmplxMag_q31(const q31_t *pSrc, q31_t *pDst, uint32_t numSamples);
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/* Exported macros -----------------------------------------------------------*/
+/** @defgroup DSP_Exported_Macros DSP Exported Macros
+  * @brief    The CMSIS-DSP calls of the application are redirected to this module,
+  *           unless HAL_DSP_NO_CMSIS_REMAP is defined before including this file.
+  * @{
+  */
+#if !defined(HAL_DSP_NO_CMSIS_REMAP)
+#define arm_fir_q15                        HAL_DSP_FIR_q15
+#define arm_biquad_cascade_df1_q15         HAL_DSP_BiquadCascadeDF1_q15
+#define arm_sin_cos_q31                    HAL_DSP_SinCos_q31
+#define arm_cmplx_mag_q31                  HAL_DSP_CmplxMag_q31
+#endif /* HAL_DSP_NO_CMSIS_REMAP */
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#endif /* FMAC && CORDIC */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STM32G4xx_HAL_DSP_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
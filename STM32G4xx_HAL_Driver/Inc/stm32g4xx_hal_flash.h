@@ -115,7 +115,8 @@ typedef enum
   FLASH_PROC_PAGE_ERASE,
   FLASH_PROC_MASS_ERASE,
   FLASH_PROC_PROGRAM,
-  FLASH_PROC_PROGRAM_LAST
+  FLASH_PROC_PROGRAM_LAST,
+  FLASH_PROC_PROGRAM_BUFFER
 } FLASH_ProcedureTypeDef;
 
 /**
@@ -142,6 +143,9 @@ typedef struct
   __IO uint32_t               Page;              /* Internal variable to define the current page which is erasing in IT context */
   __IO uint32_t               NbPagesToErase;    /* Internal variable to save the remaining pages to erase in IT context */
   __IO FLASH_CacheTypeDef     CacheToReactivate; /* Internal variable to indicate which caches should be reactivated */
+  __IO uint32_t               BufferAddress;     /* Internal variable to save the start address of a buffer program in IT context */
+  __IO uint32_t               DataAddress;       /* Internal variable to save the source address of a buffer program */
+  __IO uint32_t               BufferSize;        /* Internal variable to save the size of a buffer program */
 } FLASH_ProcessTypeDef;
 
 /**
@@ -806,6 +810,8 @@ extern FLASH_ProcessTypeDef pFlash;
   */
 HAL_StatusTypeDef  HAL_FLASH_Program(uint32_t TypeProgram, uint32_t Address, uint64_t Data);
 HAL_StatusTypeDef  HAL_FLASH_Program_IT(uint32_t TypeProgram, uint32_t Address, uint64_t Data);
+HAL_StatusTypeDef  HAL_FLASH_ProgramBuffer(uint32_t Address, const uint8_t *pData, uint32_t Size);
+HAL_StatusTypeDef  HAL_FLASH_ProgramBuffer_IT(uint32_t Address, const uint8_t *pData, uint32_t Size);
 /* FLASH IRQ handler method */
 void               HAL_FLASH_IRQHandler(void);
 /* Callbacks in non blocking modes */
@@ -36,6 +36,36 @@ extern "C" {
   */
 
 /* Exported types ------------------------------------------------------------*/
+/** @defgroup FLASHEx_Exported_Types FLASHEx Exported Types
+  * @{
+  */
+
+/**
+  * @brief  FLASH ECC monitor structure definition
+  */
+typedef struct
+{
+  uint16_t *pPageCount;               /*!< Per page single error correction counters, NbPages entries,
+                                           indexed from FLASH_BASE (can be NULL) */
+
+  uint32_t NbPages;                   /*!< Number of entries of pPageCount */
+
+  uint32_t RelocateThreshold;         /*!< Number of corrections on a page triggering
+                                           HAL_FLASHEx_EccRelocateCallback(), 0 to disable */
+
+  __IO uint32_t CorrectionCount;      /*!< Total number of single ECC errors corrected */
+
+  __IO uint32_t DetectionCount;       /*!< Total number of double ECC errors detected */
+
+  __IO uint32_t LastCorrectionAddress; /*!< Address of the last single ECC error corrected */
+
+  __IO uint32_t LastDetectionAddress; /*!< Address of the last double ECC error detected */
+
+} FLASH_EccMonitorTypeDef;
+
+/**
+  * @}
+  */
 
 /* Exported constants --------------------------------------------------------*/
 
@@ -61,6 +91,19 @@ void              HAL_FLASHEx_DisableDebugger(void);
   * @}
   */
 
+/* Extended ECC monitoring functions  ****************************************/
+/** @addtogroup FLASHEx_Exported_Functions_Group2
+  * @{
+  */
+HAL_StatusTypeDef HAL_FLASHEx_EccMonitor_Start(FLASH_EccMonitorTypeDef *pMonitor);
+void              HAL_FLASHEx_EccMonitor_Stop(void);
+void              HAL_FLASHEx_ECC_NMI_IRQHandler(void);
+void              HAL_FLASHEx_EccRelocateCallback(uint32_t PageAddress);
+void              HAL_FLASHEx_EccDetectionCallback(uint32_t Address);
+/**
+  * @}
+  */
+
 /**
   * @}
   */
@@ -70,6 +113,7 @@ void              HAL_FLASHEx_DisableDebugger(void);
   */
 void              FLASH_PageErase(uint32_t Page, uint32_t Banks);
 void              FLASH_FlushCaches(void);
+void              FLASH_ECC_CorrectionHandler(void);
 /**
   * @}
   */
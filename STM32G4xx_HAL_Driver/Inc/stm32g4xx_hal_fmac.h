@@ -55,6 +55,50 @@ typedef enum
   HAL_FMAC_STATE_ERROR       = 0xE0U             /*!< FMAC in Error state                                            */
 } HAL_FMAC_StateTypeDef;
 
+/**
+  * @brief  FMAC Coefficient Bank Structure definition
+  * @note   A bank is a coefficient area (X2) kept resident within the internal memory,
+  *         together with the filter which uses it. Several banks can be loaded once with
+  *         @ref HAL_FMAC_BankLoad() and switched with @ref HAL_FMAC_BankSelect().
+  */
+typedef struct
+{
+  uint8_t                    CoeffBaseAddress;  /*!< Base address of the coefficient area (X2) within the internal memory (0x00 to 0xFF).
+                                                     The area must not overlap the input (X1) and output (Y) buffers
+                                                     nor the other banks. */
+
+  uint8_t                    CoeffBufferSize;   /*!< Number of 16-bit words allocated to the coefficient area. */
+
+  uint32_t                   Filter;            /*!< Filter type.
+                                                     This parameter can be a value of @ref FMAC_Functions (filter related values). */
+
+  uint8_t                    P;                 /*!< Parameter P (vector length, number of filter taps, etc.). */
+
+  uint8_t                    Q;                 /*!< Parameter Q (vector length, etc.). Ignored if not needed. */
+
+  uint8_t                    R;                 /*!< Parameter R (gain, etc.). Ignored if not needed. */
+
+} FMAC_CoeffBankTypeDef;
+
+/**
+  * @brief  FMAC Pipeline Stage Structure definition
+  */
+typedef struct
+{
+  const FMAC_CoeffBankTypeDef *pBank;           /*!< Coefficient bank (filter) of the stage, already loaded. */
+
+  int16_t                    *pInput;           /*!< Input vector of the stage. It can be the output vector of the
+                                                     previous stage. */
+
+  uint16_t                   InputSize;         /*!< Number of input samples written to FMAC by the input DMA. */
+
+  int16_t                    *pOutput;          /*!< Output vector of the stage. */
+
+  uint16_t                   OutputSize;        /*!< Number of output samples read from FMAC by the output DMA.
+                                                     The stage is complete when this number of samples has been read. */
+
+} FMAC_PipelineStageTypeDef;
+
 /**
   * @brief  FMAC Handle Structure definition
   */
@@ -95,6 +139,10 @@ typedef struct
 
   DMA_HandleTypeDef          *hdmaPreload;       /*!< FMAC peripheral preloaded data (X1, X2 and Y) DMA handle parameters */
 
+  FMAC_PipelineStageTypeDef  *pStage;            /*!< Pipeline stage in progress, NULL if no pipeline is running */
+
+  uint32_t                   NbStagesLeft;       /*!< Number of pipeline stages not yet completed (including the current one) */
+
 #if (USE_HAL_FMAC_REGISTER_CALLBACKS == 1)
   void (* ErrorCallback)(struct __FMAC_HandleTypeDef *hfmac);               /*!< FMAC error callback                  */
 
@@ -110,6 +158,8 @@ typedef struct
 
   void (* FilterPreloadCallback)(struct __FMAC_HandleTypeDef *hfmac);       /*!< FMAC filter preload callback         */
 
+  void (* PipelineCpltCallback)(struct __FMAC_HandleTypeDef *hfmac);        /*!< FMAC pipeline complete callback      */
+
   void (* MspInitCallback)(struct __FMAC_HandleTypeDef *hfmac);             /*!< FMAC Msp Init callback               */
 
   void (* MspDeInitCallback)(struct __FMAC_HandleTypeDef *hfmac);           /*!< FMAC Msp DeInit callback             */
@@ -148,6 +198,8 @@ typedef enum
 
   HAL_FMAC_MSPINIT_CB_ID                = 0x07U, /*!< FMAC MspInit callback ID                */
   HAL_FMAC_MSPDEINIT_CB_ID              = 0x08U, /*!< FMAC MspDeInit callback ID              */
+
+  HAL_FMAC_PIPELINE_CPLT_CB_ID          = 0x09U, /*!< FMAC pipeline complete callback ID      */
 } HAL_FMAC_CallbackIDTypeDef;
 
 /**
@@ -565,6 +617,26 @@ typedef struct
                                                                     ((((__ACCESS__) == FMAC_BUFFER_ACCESS_DMA)&&((__WM__) == FMAC_THRESHOLD_1))|| \
                                                                      ((__ACCESS__ )!= FMAC_BUFFER_ACCESS_DMA)))
 
+/**
+  * @brief  Check whether a coefficient bank fits within the internal memory.
+  * @param  __BASE__ Base address of the bank.
+  * @param  __SIZE__ Size of the bank.
+  * @retval SET (the bank is valid) or RESET (the bank is invalid)
+  */
+#define IS_FMAC_COEFF_BANK(__BASE__, __SIZE__) (((__SIZE__) != 0U)                                     && \
+                                                (((uint32_t)(__BASE__) + (uint32_t)(__SIZE__)) <= 256U))
+
+/**
+  * @brief  Check whether a coefficient bank is big enough for its filter.
+  * @param  __BANK__ Pointer to the coefficient bank.
+  * @retval SET (the bank is big enough) or RESET (the bank is too small)
+  */
+#define IS_FMAC_COEFF_BANK_SIZE(__BANK__) ((((__BANK__)->Filter == FMAC_FUNC_CONVO_FIR)                && \
+                                            ((__BANK__)->CoeffBufferSize >= (__BANK__)->P))            || \
+                                           (((__BANK__)->Filter == FMAC_FUNC_IIR_DIRECT_FORM_1)        && \
+                                            ((__BANK__)->CoeffBufferSize >= ((uint32_t)(__BANK__)->P + \
+                                                                             (uint32_t)(__BANK__)->Q))))
+
 /**
   * @}
   */
@@ -608,6 +680,12 @@ HAL_StatusTypeDef HAL_FMAC_AppendFilterData(FMAC_HandleTypeDef *hfmac, int16_t *
 HAL_StatusTypeDef HAL_FMAC_ConfigFilterOutputBuffer(FMAC_HandleTypeDef *hfmac, int16_t *pOutput, uint16_t *pOutputSize);
 HAL_StatusTypeDef HAL_FMAC_PollFilterData(FMAC_HandleTypeDef *hfmac, uint32_t Timeout);
 HAL_StatusTypeDef HAL_FMAC_FilterStop(FMAC_HandleTypeDef  *hfmac);
+HAL_StatusTypeDef HAL_FMAC_BankLoad(FMAC_HandleTypeDef *hfmac, const FMAC_CoeffBankTypeDef *pBank,
+                                    int16_t *pCoeffB, uint8_t CoeffBSize, int16_t *pCoeffA, uint8_t CoeffASize);
+HAL_StatusTypeDef HAL_FMAC_BankSelect(FMAC_HandleTypeDef *hfmac, const FMAC_CoeffBankTypeDef *pBank);
+HAL_StatusTypeDef HAL_FMAC_PipelineStart_DMA(FMAC_HandleTypeDef *hfmac, FMAC_PipelineStageTypeDef *pStages,
+                                             uint32_t NbStages);
+HAL_StatusTypeDef HAL_FMAC_PipelineStop(FMAC_HandleTypeDef *hfmac);
 /**
   * @}
   */
@@ -623,6 +701,7 @@ void HAL_FMAC_HalfOutputDataReadyCallback(FMAC_HandleTypeDef *hfmac);
 void HAL_FMAC_OutputDataReadyCallback(FMAC_HandleTypeDef *hfmac);
 void HAL_FMAC_FilterConfigCallback(FMAC_HandleTypeDef *hfmac);
 void HAL_FMAC_FilterPreloadCallback(FMAC_HandleTypeDef *hfmac);
+void HAL_FMAC_PipelineCpltCallback(FMAC_HandleTypeDef *hfmac);
 /**
   * @}
   */
@@ -0,0 +1,248 @@
+/**
+  ******************************************************************************
+  * @file    stm32g4xx_hal_foc.h
+  * @author  MCD Application Team
+  * @brief   Header file of FOC current loop HAL module.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                       opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef STM32G4xx_HAL_FOC_H
+#define STM32G4xx_HAL_FOC_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32g4xx_hal_def.h"
+
+#if defined(CORDIC) && defined(HAL_ADC_MODULE_ENABLED) && defined(HAL_TIM_MODULE_ENABLED)
+
+/** @addtogroup STM32G4xx_HAL_Driver
+  * @{
+  */
+
+/** @addtogroup FOC
+  * @{
+  */
+
+/* Exported types ------------------------------------------------------------*/
+/** @defgroup FOC_Exported_Types FOC Exported Types
+  * @{
+  */
+
+/**
+  * @brief  HAL FOC State structure definition
+  */
+typedef enum
+{
+  HAL_FOC_STATE_RESET = 0x00U,    /*!< Current loop not yet initialized                  */
+  HAL_FOC_STATE_READY = 0x01U,    /*!< Current loop initialized and stopped              */
+  HAL_FOC_STATE_BUSY  = 0x02U     /*!< Current loop running on each injected sequence    */
+} HAL_FOC_StateTypeDef;
+
+/**
+  * @brief  FOC Init structure definition
+  */
+typedef struct
+{
+  ADC_HandleTypeDef *hadc;            /*!< ADC handle, initialized by the application with the phase A and phase B
+                                           currents on injected ranks 1 and 2, converted on the PWM timer trigger
+                                           (TIM1 TRGO2 for instance), 12-bit right aligned */
+
+  TIM_HandleTypeDef *htim;            /*!< PWM timer handle, initialized and started by the application in
+                                           center-aligned mode, channels 1, 2 and 3 driving phases A, B and C
+                                           with the compare preload enabled */
+
+  uint32_t          CurrentOffsetA;   /*!< ADC code of phase A at zero current                            */
+
+  uint32_t          CurrentOffsetB;   /*!< ADC code of phase B at zero current                            */
+
+  int32_t           Kp;               /*!< Proportional gain of the d and q current controllers, in Q15,
+                                           from 0 to 32767                                                 */
+
+  int32_t           Ki;               /*!< Integral gain of the d and q current controllers, per loop
+                                           period, in Q15, from 0 to 32767                                 */
+
+  int32_t           VoltageLimit;     /*!< Output limit of the controllers, in Q15 of the half DC bus
+                                           voltage, from 1 to 32767                                        */
+
+  uint32_t          CallbackDivider;  /*!< HAL_FOC_LoopCallback() is called every CallbackDivider loops,
+                                           0 to never call it                                              */
+} FOC_InitTypeDef;
+
+/**
+  * @brief  FOC handle Structure definition
+  * @note   The currents and voltages are in Q15: 1.0 is the full scale current of the ADC and the half
+  *         DC bus voltage. The electrical angle is an unsigned 32-bit value, 2^32 being one turn.
+  */
+typedef struct
+{
+  FOC_InitTypeDef            Init;            /*!< Current loop configuration parameters                 */
+
+  ADC_TypeDef                *pAdc;           /*!< ADC registers, cached by HAL_FOC_Init()               */
+
+  TIM_TypeDef                *pTim;           /*!< PWM timer registers, cached by HAL_FOC_Init()         */
+
+  uint32_t                   HalfPeriod;      /*!< Compare value of a 50% duty cycle                     */
+
+  __IO uint32_t              Theta;           /*!< Electrical angle used by the next loop                */
+
+  __IO uint32_t              ThetaIncrement;  /*!< Angle added to Theta after each loop                  */
+
+  __IO int32_t               IdRef;           /*!< Direct current reference                              */
+
+  __IO int32_t               IqRef;           /*!< Quadrature current reference                          */
+
+  __IO int32_t               Id;              /*!< Direct current measured by the last loop              */
+
+  __IO int32_t               Iq;              /*!< Quadrature current measured by the last loop          */
+
+  __IO int32_t               Vd;              /*!< Direct voltage applied by the last loop               */
+
+  __IO int32_t               Vq;              /*!< Quadrature voltage applied by the last loop           */
+
+  int32_t                    IntegralD;       /*!< Integral term of the d controller, in Q30             */
+
+  int32_t                    IntegralQ;       /*!< Integral term of the q controller, in Q30             */
+
+  __IO uint32_t              LoopCount;       /*!< Number of loops executed since the start              */
+
+  uint32_t                   CallbackCount;   /*!< Loops left before the next HAL_FOC_LoopCallback()     */
+
+  __IO uint32_t              LastCycles;      /*!< CPU cycles of the last loop, from the IRQ handler call */
+
+  __IO uint32_t              MaxCycles;       /*!< Highest LastCycles since the start                    */
+
+  __IO uint32_t              OverrunCount;    /*!< Injected sequences ended before their loop completed  */
+
+  HAL_LockTypeDef            Lock;            /*!< Locking object                                        */
+
+  __IO HAL_FOC_StateTypeDef  State;           /*!< Current loop state                                    */
+
+  __IO uint32_t              ErrorCode;       /*!< Current loop error code                               */
+} FOC_HandleTypeDef;
+
+/**
+  * @}
+  */
+
+/* Exported constants --------------------------------------------------------*/
+/** @defgroup FOC_Exported_Constants FOC Exported Constants
+  * @{
+  */
+
+/** @defgroup FOC_Error_Code FOC Error Code
+  * @{
+  */
+#define HAL_FOC_ERROR_NONE      0x00000000U   /*!< No error                                             */
+#define HAL_FOC_ERROR_PARAM     0x00000001U   /*!< Invalid parameter or configuration                   */
+#define HAL_FOC_ERROR_ADC       0x00000002U   /*!< Injected conversions could not be started or stopped */
+#define HAL_FOC_ERROR_OVERRUN   0x00000004U   /*!< A loop lasted longer than the PWM period             */
+/**
+  * @}
+  */
+
+/** @defgroup FOC_Cycle_Budget FOC Cycle Budget
+  * @brief    CPU cycles allowed to HAL_FOC_IRQHandler(), from its call to its return. At 170 MHz it is 20%
+  *           of the 1700 cycles of a 100 kHz PWM period, the remaining time being left to the outer loops.
+  * @{
+  */
+#define FOC_CYCLE_BUDGET        340U
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/* Exported macro ------------------------------------------------------------*/
+/** @defgroup FOC_Exported_Macros FOC Exported Macros
+  * @{
+  */
+
+/** @brief  Reset FOC handle state.
+  * @param  __HANDLE__ FOC handle.
+  * @retval None
+  */
+#define __HAL_FOC_RESET_HANDLE_STATE(__HANDLE__) ((__HANDLE__)->State = HAL_FOC_STATE_RESET)
+
+/**
+  * @}
+  */
+
+/* Exported functions --------------------------------------------------------*/
+/** @addtogroup FOC_Exported_Functions
+  * @{
+  */
+
+/** @addtogroup FOC_Exported_Functions_Group1
+  * @{
+  */
+/* Initialization and de-initialization functions  ****************************/
+HAL_StatusTypeDef HAL_FOC_Init(FOC_HandleTypeDef *hfoc);
+HAL_StatusTypeDef HAL_FOC_DeInit(FOC_HandleTypeDef *hfoc);
+/**
+  * @}
+  */
+
+/** @addtogroup FOC_Exported_Functions_Group2
+  * @{
+  */
+/* IO operation functions  ****************************************************/
+HAL_StatusTypeDef HAL_FOC_Start(FOC_HandleTypeDef *hfoc);
+HAL_StatusTypeDef HAL_FOC_Stop(FOC_HandleTypeDef *hfoc);
+void              HAL_FOC_SetCurrentReference(FOC_HandleTypeDef *hfoc, int32_t IdRef, int32_t IqRef);
+void              HAL_FOC_SetAngle(FOC_HandleTypeDef *hfoc, uint32_t Theta, uint32_t ThetaIncrement);
+void              HAL_FOC_IRQHandler(FOC_HandleTypeDef *hfoc);
+
+/* Callback functions *********************************************************/
+void              HAL_FOC_LoopCallback(FOC_HandleTypeDef *hfoc);
+void              HAL_FOC_ErrorCallback(FOC_HandleTypeDef *hfoc);
+/**
+  * @}
+  */
+
+/** @addtogroup FOC_Exported_Functions_Group3
+  * @{
+  */
+/* Peripheral State and Error functions  **************************************/
+HAL_FOC_StateTypeDef HAL_FOC_GetState(FOC_HandleTypeDef *hfoc);
+uint32_t             HAL_FOC_GetError(FOC_HandleTypeDef *hfoc);
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#endif /* CORDIC && HAL_ADC_MODULE_ENABLED && HAL_TIM_MODULE_ENABLED */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STM32G4xx_HAL_FOC_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
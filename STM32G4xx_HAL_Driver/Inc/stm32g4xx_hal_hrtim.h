@@ -130,6 +130,8 @@ typedef struct
 
   __IO HAL_HRTIM_StateTypeDef  State;                        /*!< HRTIM communication state */
 
+  uint32_t                     ConverterPhaseCount;          /*!< Number of phases set by HAL_HRTIM_ConverterConfig() */
+
   DMA_HandleTypeDef *          hdmaMaster;                   /*!< Master timer DMA handle parameters */
   DMA_HandleTypeDef *          hdmaTimerA;                   /*!< Timer A DMA handle parameters */
   DMA_HandleTypeDef *          hdmaTimerB;                   /*!< Timer B DMA handle parameters */
@@ -538,6 +540,36 @@ typedef struct
                                This parameter can be a combination of @ref HRTIM_ADC_Trigger_Event  */
 } HRTIM_ADCTriggerCfgTypeDef;
 
+/**
+  * @brief  Multi-phase converter configuration definition
+  */
+typedef struct
+{
+  uint32_t PhaseCount;          /*!< Specifies the number of interleaved phases, phase n being driven by the
+                                     outputs 1 (high side) and 2 (low side) of the timer A + n.
+                                     This parameter can be a number between 1 and HRTIM_CONVERTER_MAX_PHASES */
+  uint32_t PrescalerRatio;      /*!< Specifies the counter clock prescaler of the master timer and of the phases.
+                                     This parameter can be a value of @ref HRTIM_Prescaler_Ratio */
+  uint32_t Period;              /*!< Specifies the switching period, the phases are shifted by Period / PhaseCount.
+                                     This parameter can be a number between 0x3 and 0xFFDF */
+  uint32_t RepetitionCounter;   /*!< Specifies the number of switching periods, minus one, between two
+                                     updates of the compare values.
+                                     This parameter can be a number between 0x00 and 0xFF */
+  uint32_t Compare;             /*!< Specifies the initial compare value of all phases, the high side output
+                                     is active from the phase start to this compare value.
+                                     This parameter can be a number between 0x0 and Period */
+  uint32_t DeadTimePrescaler;   /*!< Specifies the dead-time prescaler.
+                                     This parameter can be a value of @ref HRTIM_Timer_Deadtime_Prescaler_Ratio */
+  uint32_t RisingDeadTime;      /*!< Specifies the dead-time following a rising edge of the high side output.
+                                     This parameter can be a number between 0x0 and 0x1FF */
+  uint32_t FallingDeadTime;     /*!< Specifies the dead-time following a falling edge of the high side output.
+                                     This parameter can be a number between 0x0 and 0x1FF */
+  uint32_t ADCTrigger;          /*!< Specifies the ADC trigger placed on the phase 0 (timer A compare 4).
+                                     This parameter can be a value of @ref HRTIM_Converter_ADC_Trigger */
+  uint32_t ADCTriggerPosition;  /*!< Specifies the ADC trigger position from the start of the phase 0.
+                                     This parameter can be a number between 0x3 and Period */
+} HRTIM_ConverterCfgTypeDef;
+
 /**
   * @brief  External Event Counter A or B configuration definition
   */
@@ -2642,6 +2674,29 @@ typedef void (* pHRTIM_TIMxCallbackTypeDef)(HRTIM_HandleTypeDef *hhrtim,    /*!<
   * @}
   */
 
+/** @defgroup HRTIM_Converter_Max_Phases HRTIM Converter Max Phases
+  * @{
+  * @brief Phase 0 starts on the master period event, phases 1 to 4 on the
+  *        master compare 1 to 4 events
+  */
+#define HRTIM_CONVERTER_MAX_PHASES  5U
+/**
+  * @}
+  */
+
+/** @defgroup HRTIM_Converter_ADC_Trigger HRTIM Converter ADC Trigger
+  * @{
+  * @brief ADC trigger generated by the multi-phase converter
+  */
+#define HRTIM_CONVERTER_ADCTRIGGER_NONE  0x00000000U         /*!< No ADC trigger    */
+#define HRTIM_CONVERTER_ADCTRIGGER_1     HRTIM_ADCTRIGGER_1  /*!< HRTIM ADC trigger 1 */
+#define HRTIM_CONVERTER_ADCTRIGGER_2     HRTIM_ADCTRIGGER_2  /*!< HRTIM ADC trigger 2 */
+#define HRTIM_CONVERTER_ADCTRIGGER_3     HRTIM_ADCTRIGGER_3  /*!< HRTIM ADC trigger 3 */
+#define HRTIM_CONVERTER_ADCTRIGGER_4     HRTIM_ADCTRIGGER_4  /*!< HRTIM ADC trigger 4 */
+/**
+  * @}
+  */
+
 /**
   * @}
   */
@@ -3232,6 +3287,23 @@ typedef void (* pHRTIM_TIMxCallbackTypeDef)(HRTIM_HandleTypeDef *hhrtim,    /*!<
                  ((PRESCALERRATIO) == HRTIM_TIMDEADTIME_PRESCALERRATIO_DIV8) || \
                  ((PRESCALERRATIO) == HRTIM_TIMDEADTIME_PRESCALERRATIO_DIV16))
 
+#define IS_HRTIM_CONVERTER_PHASECOUNT(PHASECOUNT)\
+                (((PHASECOUNT) >= 1U) && ((PHASECOUNT) <= HRTIM_CONVERTER_MAX_PHASES))
+
+#define IS_HRTIM_CONVERTER_PERIOD(PERIOD)\
+                (((PERIOD) >= 0x3U) && ((PERIOD) <= 0xFFDFU))
+
+#define IS_HRTIM_CONVERTER_REPETITION(REPETITION)   ((REPETITION) <= 0xFFU)
+
+#define IS_HRTIM_CONVERTER_DEADTIME(DEADTIME)       ((DEADTIME) <= 0x1FFU)
+
+#define IS_HRTIM_CONVERTER_ADCTRIGGER(ADCTRIGGER)\
+                (((ADCTRIGGER) == HRTIM_CONVERTER_ADCTRIGGER_NONE) || \
+                 ((ADCTRIGGER) == HRTIM_CONVERTER_ADCTRIGGER_1)    || \
+                 ((ADCTRIGGER) == HRTIM_CONVERTER_ADCTRIGGER_2)    || \
+                 ((ADCTRIGGER) == HRTIM_CONVERTER_ADCTRIGGER_3)    || \
+                 ((ADCTRIGGER) == HRTIM_CONVERTER_ADCTRIGGER_4))
+
 #define IS_HRTIM_TIMDEADTIME_RISINGSIGN(RISINGSIGN)\
                 (((RISINGSIGN) == HRTIM_TIMDEADTIME_RISINGSIGN_POSITIVE)    || \
                  ((RISINGSIGN) == HRTIM_TIMDEADTIME_RISINGSIGN_NEGATIVE))
@@ -5117,6 +5189,30 @@ HAL_StatusTypeDef HAL_HRTIM_TIMxUnRegisterCallback(HRTIM_HandleTypeDef *       h
                                                    HAL_HRTIM_CallbackIDTypeDef CallbackID);
 #endif /* USE_HAL_HRTIM_REGISTER_CALLBACKS */
 
+/**
+  * @}
+  */
+
+/** @addtogroup HRTIM_Exported_Functions_Group11
+* @{
+*/
+/* Multi-phase converter functions ********************************************/
+HAL_StatusTypeDef HAL_HRTIM_ConverterConfig(HRTIM_HandleTypeDef *hhrtim,
+                                            HRTIM_ConverterCfgTypeDef *pConverterCfg);
+
+HAL_StatusTypeDef HAL_HRTIM_ConverterStart(HRTIM_HandleTypeDef *hhrtim);
+
+HAL_StatusTypeDef HAL_HRTIM_ConverterStop(HRTIM_HandleTypeDef *hhrtim);
+
+HAL_StatusTypeDef HAL_HRTIM_ConverterStart_DMA(HRTIM_HandleTypeDef *hhrtim,
+                                               uint32_t *pCompareBuffer,
+                                               uint32_t UpdateCount);
+
+HAL_StatusTypeDef HAL_HRTIM_ConverterStop_DMA(HRTIM_HandleTypeDef *hhrtim);
+
+HAL_StatusTypeDef HAL_HRTIM_ConverterSetCompare(HRTIM_HandleTypeDef *hhrtim,
+                                                const uint32_t *pCompare);
+
 /**
   * @}
   */
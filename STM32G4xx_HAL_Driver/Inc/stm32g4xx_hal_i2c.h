@@ -74,6 +74,65 @@ typedef struct
 
 } I2C_InitTypeDef;
 
+/**
+  * @}
+  */
+
+/** @defgroup I2C_Batch_Operation_Structure_definition I2C Batch Operation Structure definition
+  * @brief  I2C memory read operation executed by HAL_I2C_Mem_ReadBatch_IT()
+  * @{
+  */
+typedef struct
+{
+  uint16_t DevAddress;          /*!< Target device address: The device 7 bits address value
+                                  in datasheet must be shifted to the left */
+
+  uint16_t MemAddress;          /*!< Internal memory address */
+
+  uint16_t MemAddSize;          /*!< Size of internal memory address.
+                                  This parameter can be a value of @ref I2C_MEMORY_ADDRESS_SIZE */
+
+  uint16_t Size;                /*!< Amount of data to be read, from 1 to 255 */
+
+  uint8_t *pData;               /*!< Pointer to data buffer */
+
+} I2C_BatchOpTypeDef;
+
+/**
+  * @}
+  */
+
+/** @defgroup I2C_RegMap_Structure_definition I2C Register Map Structure definition
+  * @brief  I2C slave register map served by HAL_I2C_RegMap_Start()
+  * @{
+  */
+typedef struct
+{
+  uint8_t *pRegion;             /*!< Registers read and written by the master, owned by the application */
+
+  const uint8_t *pWriteMask;    /*!< Writable bits of each register, Size bytes: a bit at 0 is read-only.
+                                  NULL when all the bits are writable */
+
+  uint8_t *pScratch;            /*!< Reception buffer of Size bytes, the received bytes are merged into
+                                  pRegion at the STOP condition */
+
+  uint16_t Size;                /*!< Number of registers, from 1 to 256 with 8-bit register addresses */
+
+  uint16_t AddressSize;         /*!< Size of the register address sent by the master.
+                                  This parameter can be a value of @ref I2C_MEMORY_ADDRESS_SIZE */
+
+  __IO uint16_t Pointer;        /*!< Register pointer, set by the master and incremented by the transfers */
+
+  uint16_t AddressLeft;         /*!< Register address bytes left to receive */
+
+  uint16_t NewPointer;          /*!< Register address being received */
+
+  uint16_t DmaSize;             /*!< Bytes given to the DMA for the current transfer */
+
+  __IO uint32_t Phase;          /*!< Transfer in progress: idle, register address, write or read */
+
+} I2C_RegMapTypeDef;
+
 /**
   * @}
   */
@@ -216,6 +275,12 @@ typedef struct __I2C_HandleTypeDef
 
   __IO uint32_t              AddrEventCount; /*!< I2C Address Event counter                 */
 
+  const I2C_BatchOpTypeDef   *pBatchOp;      /*!< I2C batch operation being executed        */
+
+  __IO uint32_t              BatchCount;     /*!< I2C batch operations left, current included */
+
+  I2C_RegMapTypeDef          *pRegMap;       /*!< I2C slave register map being served      */
+
 #if (USE_HAL_I2C_REGISTER_CALLBACKS == 1)
   void (* MasterTxCpltCallback)(struct __I2C_HandleTypeDef *hi2c);           /*!< I2C Master Tx Transfer completed callback */
   void (* MasterRxCpltCallback)(struct __I2C_HandleTypeDef *hi2c);           /*!< I2C Master Rx Transfer completed callback */
@@ -625,6 +690,8 @@ HAL_StatusTypeDef HAL_I2C_Mem_Write_IT(I2C_HandleTypeDef *hi2c, uint16_t DevAddr
                                        uint16_t MemAddSize, uint8_t *pData, uint16_t Size);
 HAL_StatusTypeDef HAL_I2C_Mem_Read_IT(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress,
                                       uint16_t MemAddSize, uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_I2C_Mem_ReadBatch_IT(I2C_HandleTypeDef *hi2c, const I2C_BatchOpTypeDef *pOps,
+                                           uint32_t NbOps);
 
 HAL_StatusTypeDef HAL_I2C_Master_Seq_Transmit_IT(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData,
                                                  uint16_t Size, uint32_t XferOptions);
@@ -637,6 +704,8 @@ HAL_StatusTypeDef HAL_I2C_Slave_Seq_Receive_IT(I2C_HandleTypeDef *hi2c, uint8_t
 HAL_StatusTypeDef HAL_I2C_EnableListen_IT(I2C_HandleTypeDef *hi2c);
 HAL_StatusTypeDef HAL_I2C_DisableListen_IT(I2C_HandleTypeDef *hi2c);
 HAL_StatusTypeDef HAL_I2C_Master_Abort_IT(I2C_HandleTypeDef *hi2c, uint16_t DevAddress);
+HAL_StatusTypeDef HAL_I2C_RegMap_Start(I2C_HandleTypeDef *hi2c, I2C_RegMapTypeDef *pRegMap);
+HAL_StatusTypeDef HAL_I2C_RegMap_Stop(I2C_HandleTypeDef *hi2c);
 
 /******* Non-Blocking mode: DMA */
 HAL_StatusTypeDef HAL_I2C_Master_Transmit_DMA(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData,
@@ -676,6 +745,8 @@ void HAL_I2C_AddrCallback(I2C_HandleTypeDef *hi2c, uint8_t TransferDirection, ui
 void HAL_I2C_ListenCpltCallback(I2C_HandleTypeDef *hi2c);
 void HAL_I2C_MemTxCpltCallback(I2C_HandleTypeDef *hi2c);
 void HAL_I2C_MemRxCpltCallback(I2C_HandleTypeDef *hi2c);
+void HAL_I2C_MemBatchCpltCallback(I2C_HandleTypeDef *hi2c);
+void HAL_I2C_RegMapWriteCallback(I2C_HandleTypeDef *hi2c, uint16_t Offset, uint16_t Size);
 void HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c);
 void HAL_I2C_AbortCpltCallback(I2C_HandleTypeDef *hi2c);
 /**
@@ -80,6 +80,28 @@ extern "C" {
   * @{
   */
 
+/** @brief  Compute the I2C_TIMINGR register value from the bus characteristics.
+  * @note   All the parameters being constants, the result is a constant expression
+  *         usable to initialize a static I2C_InitTypeDef. The smallest prescaler
+  *         fitting all the counters is used, the SCL frequency does not exceed
+  *         __SPEED__. HAL_I2CEx_ComputeTiming() refines the choice at runtime.
+  * @param  __CLK__ I2C kernel clock frequency in Hz.
+  * @param  __SPEED__ SCL frequency in Hz, up to 1000000 (Fast-mode Plus).
+  * @param  __RISE__ SCL and SDA rise time in ns.
+  * @param  __FALL__ SCL and SDA fall time in ns.
+  * @param  __ANF__ Analog filter setting, a value of @ref I2CEx_Analog_Filter.
+  * @param  __DNF__ Digital filter setting, between 0x00 and 0x0F.
+  * @retval I2C_TIMINGR value, 0 when no setting meets the I2C-bus specification.
+  */
+#define __HAL_I2C_CALC_TIMING(__CLK__, __SPEED__, __RISE__, __FALL__, __ANF__, __DNF__)                   \
+  (((I2C_TIMING_PRESC1((__CLK__), (__SPEED__), (__RISE__), (__FALL__), (__ANF__), (__DNF__)) > 16U) ||     \
+     ((int32_t)(I2C_TIMING_SDADEL((__CLK__), (__SPEED__), (__RISE__), (__FALL__), (__ANF__), (__DNF__)) *  \
+                I2C_TIMING_PRESC1((__CLK__), (__SPEED__), (__RISE__), (__FALL__), (__ANF__), (__DNF__)) *  \
+                I2C_TIMING_CLK_PS(__CLK__)) >                                                               \
+      I2C_TIMING_SDADEL_MAX((__CLK__), (__SPEED__), (__RISE__), (__ANF__), (__DNF__)))) ? 0U :             \
+   I2C_TIMING_REG(I2C_TIMING_PRESC1((__CLK__), (__SPEED__), (__RISE__), (__FALL__), (__ANF__), (__DNF__)), \
+                  (__CLK__), (__SPEED__), (__RISE__), (__FALL__), (__ANF__), (__DNF__)))
+
 /**
   * @}
   */
@@ -117,6 +139,17 @@ void HAL_I2CEx_DisableFastModePlus(uint32_t ConfigFastModePlus);
   * @}
   */
 
+/** @addtogroup I2CEx_Exported_Functions_Group4 I2C Extended Timing Functions
+  * @{
+  */
+uint32_t HAL_I2CEx_ComputeTiming(uint32_t I2cClock, uint32_t Speed, uint32_t RiseTime, uint32_t FallTime,
+                                 uint32_t AnalogFilter, uint32_t DigitalFilter);
+uint32_t HAL_I2CEx_GetTiming(uint32_t I2cClock, uint32_t Speed, uint32_t RiseTime, uint32_t FallTime,
+                             uint32_t AnalogFilter, uint32_t DigitalFilter);
+/**
+  * @}
+  */
+
 
 /**
   * @}
@@ -126,6 +159,25 @@ void HAL_I2CEx_DisableFastModePlus(uint32_t ConfigFastModePlus);
 /** @defgroup I2CEx_Private_Constants I2C Extended Private Constants
   * @{
   */
+/* I2C-bus specification limits in ps, for Standard-mode, Fast-mode and Fast-mode Plus */
+#define I2C_TIMING_SPEED_STANDARD       100000U
+#define I2C_TIMING_SPEED_FAST           400000U
+
+#define I2C_TIMING_LOW_MIN_SM           4700000U  /*!< tLOW min                               */
+#define I2C_TIMING_LOW_MIN_FM           1300000U
+#define I2C_TIMING_LOW_MIN_FMP           500000U
+#define I2C_TIMING_HIGH_MIN_SM          4000000U  /*!< tHIGH min                              */
+#define I2C_TIMING_HIGH_MIN_FM           600000U
+#define I2C_TIMING_HIGH_MIN_FMP          260000U
+#define I2C_TIMING_VDDAT_MAX_SM         3450000U  /*!< tVD;DAT max                            */
+#define I2C_TIMING_VDDAT_MAX_FM          900000U
+#define I2C_TIMING_VDDAT_MAX_FMP         450000U
+#define I2C_TIMING_SUDAT_MIN_SM          250000U  /*!< tSU;DAT min                            */
+#define I2C_TIMING_SUDAT_MIN_FM          100000U
+#define I2C_TIMING_SUDAT_MIN_FMP          50000U
+
+#define I2C_TIMING_AF_MIN                 50000U  /*!< Analog filter delay min                */
+#define I2C_TIMING_AF_MAX                260000U  /*!< Analog filter delay max                */
 
 /**
   * @}
@@ -140,6 +192,95 @@ void HAL_I2CEx_DisableFastModePlus(uint32_t ConfigFastModePlus);
 
 #define IS_I2C_DIGITAL_FILTER(FILTER)   ((FILTER) <= 0x0000000FU)
 
+/* Helpers of __HAL_I2C_CALC_TIMING() and HAL_I2CEx_ComputeTiming(), durations in ps */
+#define I2C_TIMING_SPEC(__SPEED__, __SM__, __FM__, __FMP__) \
+  (((__SPEED__) <= I2C_TIMING_SPEED_STANDARD) ? (__SM__) : (((__SPEED__) <= I2C_TIMING_SPEED_FAST) ? (__FM__) : (__FMP__)))
+
+#define I2C_TIMING_MAX(__A__, __B__)    (((__A__) > (__B__)) ? (__A__) : (__B__))
+
+#define I2C_TIMING_CEIL(__A__, __B__)   (((__A__) + (__B__) - 1U) / (__B__))
+
+#define I2C_TIMING_CLK_PS(__CLK__)      ((uint32_t)(1000000000000ULL / (uint32_t)(__CLK__)))
+
+#define I2C_TIMING_AF(__ANF__, __AF__)  (((__ANF__) == I2C_ANALOGFILTER_ENABLE) ? (__AF__) : 0U)
+
+/* tSDADEL min = tf + tHD;DAT min - tAF min - (DNF + 3) x tI2CCLK, tHD;DAT min being 0 */
+#define I2C_TIMING_SDADEL_MIN(__CLK__, __FALL__, __ANF__, __DNF__)                                    \
+  ((((uint32_t)(__FALL__) * 1000U) > (I2C_TIMING_AF((__ANF__), I2C_TIMING_AF_MIN) +                 \
+                                      (((__DNF__) + 3U) * I2C_TIMING_CLK_PS(__CLK__)))) ?           \
+   (((uint32_t)(__FALL__) * 1000U) - I2C_TIMING_AF((__ANF__), I2C_TIMING_AF_MIN) -                  \
+    (((__DNF__) + 3U) * I2C_TIMING_CLK_PS(__CLK__))) : 0U)
+
+/* tSDADEL max = tVD;DAT max - tr - tAF max - (DNF + 4) x tI2CCLK */
+#define I2C_TIMING_SDADEL_MAX(__CLK__, __SPEED__, __RISE__, __ANF__, __DNF__)                         \
+  ((int32_t)I2C_TIMING_SPEC((__SPEED__), I2C_TIMING_VDDAT_MAX_SM, I2C_TIMING_VDDAT_MAX_FM,           \
+                            I2C_TIMING_VDDAT_MAX_FMP) - (int32_t)((uint32_t)(__RISE__) * 1000U) -    \
+   (int32_t)I2C_TIMING_AF((__ANF__), I2C_TIMING_AF_MAX) -                                            \
+   (int32_t)(((__DNF__) + 4U) * I2C_TIMING_CLK_PS(__CLK__)))
+
+/* tSCLDEL min = tr + tSU;DAT min */
+#define I2C_TIMING_SCLDEL_MIN(__SPEED__, __RISE__)                                                    \
+  (((uint32_t)(__RISE__) * 1000U) +                                                                  \
+   I2C_TIMING_SPEC((__SPEED__), I2C_TIMING_SUDAT_MIN_SM, I2C_TIMING_SUDAT_MIN_FM, I2C_TIMING_SUDAT_MIN_FMP))
+
+/* SCL synchronization delays tSYNC1 + tSYNC2 = tf + tr + 2 x (tAF + (DNF + 2) x tI2CCLK) */
+#define I2C_TIMING_SYNC(__CLK__, __RISE__, __FALL__, __ANF__, __DNF__)                                \
+  ((((uint32_t)(__RISE__) + (uint32_t)(__FALL__)) * 1000U) +                                         \
+   (2U * (I2C_TIMING_AF((__ANF__), I2C_TIMING_AF_MIN) + (((__DNF__) + 2U) * I2C_TIMING_CLK_PS(__CLK__)))))
+
+/* SCL low plus high time left once the synchronization delays are removed from the period */
+#define I2C_TIMING_LH(__CLK__, __SPEED__, __RISE__, __FALL__, __ANF__, __DNF__)                       \
+  (((1000000000000ULL / (uint32_t)(__SPEED__)) >                                                     \
+    I2C_TIMING_SYNC((__CLK__), (__RISE__), (__FALL__), (__ANF__), (__DNF__))) ?                      \
+   ((uint32_t)(1000000000000ULL / (uint32_t)(__SPEED__)) -                                           \
+    I2C_TIMING_SYNC((__CLK__), (__RISE__), (__FALL__), (__ANF__), (__DNF__))) : 0U)
+
+/* tLOW and tHIGH share the period in the ratio of their minimum values */
+#define I2C_TIMING_LOW(__CLK__, __SPEED__, __RISE__, __FALL__, __ANF__, __DNF__)                      \
+  I2C_TIMING_MAX(I2C_TIMING_SPEC((__SPEED__), I2C_TIMING_LOW_MIN_SM, I2C_TIMING_LOW_MIN_FM,          \
+                                 I2C_TIMING_LOW_MIN_FMP),                                            \
+                 ((I2C_TIMING_LH((__CLK__), (__SPEED__), (__RISE__), (__FALL__), (__ANF__), (__DNF__)) / 1000U) * \
+                  I2C_TIMING_SPEC((__SPEED__), 540U, 684U, 658U)))
+
+#define I2C_TIMING_HIGH(__CLK__, __SPEED__, __RISE__, __FALL__, __ANF__, __DNF__)                     \
+  ((I2C_TIMING_LH((__CLK__), (__SPEED__), (__RISE__), (__FALL__), (__ANF__), (__DNF__)) >            \
+    (I2C_TIMING_LOW((__CLK__), (__SPEED__), (__RISE__), (__FALL__), (__ANF__), (__DNF__)) +          \
+     I2C_TIMING_SPEC((__SPEED__), I2C_TIMING_HIGH_MIN_SM, I2C_TIMING_HIGH_MIN_FM, I2C_TIMING_HIGH_MIN_FMP))) ? \
+   (I2C_TIMING_LH((__CLK__), (__SPEED__), (__RISE__), (__FALL__), (__ANF__), (__DNF__)) -            \
+    I2C_TIMING_LOW((__CLK__), (__SPEED__), (__RISE__), (__FALL__), (__ANF__), (__DNF__))) :          \
+   I2C_TIMING_SPEC((__SPEED__), I2C_TIMING_HIGH_MIN_SM, I2C_TIMING_HIGH_MIN_FM, I2C_TIMING_HIGH_MIN_FMP))
+
+/* Smallest PRESC + 1 for which SCLL, SCLH, SCLDEL and SDADEL fit their fields */
+#define I2C_TIMING_PRESC1(__CLK__, __SPEED__, __RISE__, __FALL__, __ANF__, __DNF__)                   \
+  I2C_TIMING_MAX(I2C_TIMING_MAX(I2C_TIMING_CEIL(I2C_TIMING_LOW((__CLK__), (__SPEED__), (__RISE__),   \
+                                                               (__FALL__), (__ANF__), (__DNF__)),    \
+                                                256U * I2C_TIMING_CLK_PS(__CLK__)),                  \
+                                I2C_TIMING_CEIL(I2C_TIMING_HIGH((__CLK__), (__SPEED__), (__RISE__),  \
+                                                                (__FALL__), (__ANF__), (__DNF__)),   \
+                                                256U * I2C_TIMING_CLK_PS(__CLK__))),                 \
+                 I2C_TIMING_MAX(I2C_TIMING_CEIL(I2C_TIMING_SCLDEL_MIN((__SPEED__), (__RISE__)),      \
+                                                16U * I2C_TIMING_CLK_PS(__CLK__)),                   \
+                                I2C_TIMING_MAX(I2C_TIMING_CEIL(I2C_TIMING_SDADEL_MIN((__CLK__), (__FALL__), \
+                                                                                     (__ANF__), (__DNF__)), \
+                                                               15U * I2C_TIMING_CLK_PS(__CLK__)), 1U)))
+
+#define I2C_TIMING_SDADEL(__CLK__, __SPEED__, __RISE__, __FALL__, __ANF__, __DNF__)                   \
+  I2C_TIMING_CEIL(I2C_TIMING_SDADEL_MIN((__CLK__), (__FALL__), (__ANF__), (__DNF__)),                \
+                  I2C_TIMING_PRESC1((__CLK__), (__SPEED__), (__RISE__), (__FALL__), (__ANF__), (__DNF__)) * \
+                  I2C_TIMING_CLK_PS(__CLK__))
+
+/* I2C_TIMINGR value for a given PRESC + 1, the counters being rounded up */
+#define I2C_TIMING_REG(__PRESC1__, __CLK__, __SPEED__, __RISE__, __FALL__, __ANF__, __DNF__)          \
+  ((((uint32_t)(__PRESC1__) - 1U) << I2C_TIMINGR_PRESC_Pos) |                                        \
+   ((I2C_TIMING_CEIL(I2C_TIMING_SCLDEL_MIN((__SPEED__), (__RISE__)),                                 \
+                     (__PRESC1__) * I2C_TIMING_CLK_PS(__CLK__)) - 1U) << I2C_TIMINGR_SCLDEL_Pos) |   \
+   (I2C_TIMING_CEIL(I2C_TIMING_SDADEL_MIN((__CLK__), (__FALL__), (__ANF__), (__DNF__)),              \
+                    (__PRESC1__) * I2C_TIMING_CLK_PS(__CLK__)) << I2C_TIMINGR_SDADEL_Pos) |          \
+   ((I2C_TIMING_CEIL(I2C_TIMING_HIGH((__CLK__), (__SPEED__), (__RISE__), (__FALL__), (__ANF__), (__DNF__)), \
+                     (__PRESC1__) * I2C_TIMING_CLK_PS(__CLK__)) - 1U) << I2C_TIMINGR_SCLH_Pos) |     \
+   ((I2C_TIMING_CEIL(I2C_TIMING_LOW((__CLK__), (__SPEED__), (__RISE__), (__FALL__), (__ANF__), (__DNF__)), \
+                     (__PRESC1__) * I2C_TIMING_CLK_PS(__CLK__)) - 1U) << I2C_TIMINGR_SCLL_Pos))
+
 #define IS_I2C_FASTMODEPLUS(__CONFIG__) ((((__CONFIG__) & I2C_FMP_NOT_SUPPORTED) != I2C_FMP_NOT_SUPPORTED) && \
                                          ((((__CONFIG__) & (I2C_FASTMODEPLUS_PB6))  == I2C_FASTMODEPLUS_PB6)     || \
                                           (((__CONFIG__) & (I2C_FASTMODEPLUS_PB7))  == I2C_FASTMODEPLUS_PB7)     || \
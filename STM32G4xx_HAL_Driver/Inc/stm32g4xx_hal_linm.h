@@ -0,0 +1,265 @@
+/**
+  ******************************************************************************
+  * @file    stm32g4xx_hal_linm.h
+  * @author  MCD Application Team
+  * @brief   Header file of LIN master schedule HAL module.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                       opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef STM32G4xx_HAL_LINM_H
+#define STM32G4xx_HAL_LINM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32g4xx_hal_def.h"
+
+#if defined(HAL_UART_MODULE_ENABLED) && defined(HAL_DMA_MODULE_ENABLED) && defined(HAL_TIM_MODULE_ENABLED)
+
+/** @addtogroup STM32G4xx_HAL_Driver
+  * @{
+  */
+
+/** @addtogroup LINM
+  * @{
+  */
+
+/* Exported types ------------------------------------------------------------*/
+/** @defgroup LINM_Exported_Types LINM Exported Types
+  * @{
+  */
+
+/**
+  * @brief  HAL LINM State structure definition
+  */
+typedef enum
+{
+  HAL_LINM_STATE_RESET = 0x00U,    /*!< Schedule not yet initialized                      */
+  HAL_LINM_STATE_READY = 0x01U,    /*!< Schedule initialized and stopped                  */
+  HAL_LINM_STATE_BUSY  = 0x02U     /*!< Schedule table executed on each timer update      */
+} HAL_LINM_StateTypeDef;
+
+/**
+  * @brief  LIN schedule table entry structure definition
+  * @note   A table is usually declared const. The response data of all the frames of
+  *         the table is kept in RAM, at pData.
+  */
+typedef struct
+{
+  uint32_t Id;                   /*!< Frame identifier, from 0x00 to 0x3F, the parity bits are added by the driver */
+
+  uint32_t Direction;            /*!< Response sent by the master or by a slave.
+                                      This parameter can be a value of @ref LINM_Frame_Direction                   */
+
+  uint32_t Length;               /*!< Response length in bytes, from 1 to 8                                        */
+
+  uint32_t ChecksumType;         /*!< Checksum model of the frame.
+                                      This parameter can be a value of @ref LINM_Checksum_Type                     */
+
+  uint32_t SlotTime;             /*!< Slot duration, in ticks of the schedule timer, from the start of this
+                                      header to the start of the next one                                          */
+
+  uint8_t  *pData;               /*!< Response data, Length bytes: sent for a master frame, written with the
+                                      response of the slave for a slave frame                                      */
+} LINM_ScheduleEntryTypeDef;
+
+/**
+  * @brief  LINM Init structure definition
+  */
+typedef struct
+{
+  UART_HandleTypeDef *huart;     /*!< UART handle, initialized by the application with HAL_LIN_Init(), with a
+                                      normal mode, byte wide DMA linked to hdmatx and hdmarx                   */
+
+  TIM_HandleTypeDef  *htim;      /*!< Schedule timer handle, initialized by the application with
+                                      HAL_TIM_Base_Init() in up-counting mode, the period being overwritten   */
+} LINM_InitTypeDef;
+
+/**
+  * @brief  LINM handle Structure definition
+  */
+typedef struct
+{
+  LINM_InitTypeDef                 Init;            /*!< Schedule configuration parameters                     */
+
+  const LINM_ScheduleEntryTypeDef  *pTable;         /*!< Schedule table being executed                         */
+
+  uint32_t                         TableSize;       /*!< Number of entries of pTable                           */
+
+  const LINM_ScheduleEntryTypeDef  *pNextTable;     /*!< Table executed from the next slot, NULL if none       */
+
+  uint32_t                         NextTableSize;   /*!< Number of entries of pNextTable                       */
+
+  uint32_t                         Index;           /*!< Entry of pTable of the current slot                   */
+
+  uint32_t                         RxSize;          /*!< Bytes expected by the reception DMA of the slot       */
+
+  uint8_t                          TxBuffer[11];    /*!< Sync, protected identifier, response and checksum     */
+
+  uint8_t                          RxBuffer[12];    /*!< Bytes read back from the bus during the slot          */
+
+  const LINM_ScheduleEntryTypeDef  *pLastEntry;     /*!< Entry of the last completed slot                      */
+
+  __IO uint32_t                    FrameStatus;     /*!< Status of the last completed slot.
+                                                         This parameter can be a value of @ref LINM_Frame_Status */
+
+  __IO uint32_t                    FrameCount;      /*!< Slots completed since the start                       */
+
+  __IO uint32_t                    FrameErrorCount; /*!< Slots completed with an error since the start         */
+
+  HAL_LockTypeDef                  Lock;            /*!< Locking object                                        */
+
+  __IO HAL_LINM_StateTypeDef       State;           /*!< Schedule state                                        */
+
+  __IO uint32_t                    ErrorCode;       /*!< Schedule error code                                   */
+} LINM_HandleTypeDef;
+
+/**
+  * @}
+  */
+
+/* Exported constants --------------------------------------------------------*/
+/** @defgroup LINM_Exported_Constants LINM Exported Constants
+  * @{
+  */
+
+/** @defgroup LINM_Error_Code LINM Error Code
+  * @{
+  */
+#define HAL_LINM_ERROR_NONE      0x00000000U   /*!< No error                                        */
+#define HAL_LINM_ERROR_PARAM     0x00000001U   /*!< Invalid parameter or schedule table             */
+#define HAL_LINM_ERROR_DMA       0x00000002U   /*!< The DMA of a slot could not be started          */
+/**
+  * @}
+  */
+
+/** @defgroup LINM_Frame_Direction LINM Frame Direction
+  * @{
+  */
+#define LINM_FRAME_MASTER        0x00000000U   /*!< Response sent by the master                     */
+#define LINM_FRAME_SLAVE         0x00000001U   /*!< Response sent by a slave                        */
+/**
+  * @}
+  */
+
+/** @defgroup LINM_Checksum_Type LINM Checksum Type
+  * @{
+  */
+#define LINM_CHECKSUM_CLASSIC    0x00000000U   /*!< Sum of the response bytes (LIN 1.x, diagnostic frames) */
+#define LINM_CHECKSUM_ENHANCED   0x00000001U   /*!< Sum of the protected identifier and the response (LIN 2.x) */
+/**
+  * @}
+  */
+
+/** @defgroup LINM_Frame_Status LINM Frame Status
+  * @{
+  */
+#define LINM_FRAME_OK            0x00000000U   /*!< Response sent or received, checksum correct     */
+#define LINM_FRAME_NO_RESPONSE   0x00000001U   /*!< No response byte received from the slave        */
+#define LINM_FRAME_INCOMPLETE    0x00000002U   /*!< Response shorter than the frame length          */
+#define LINM_FRAME_CHECKSUM      0x00000003U   /*!< Wrong checksum of the slave response            */
+#define LINM_FRAME_BIT           0x00000004U   /*!< Byte read back different from the byte sent     */
+#define LINM_FRAME_HEADER        0x00000005U   /*!< Header not read back from the bus               */
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/* Exported macro ------------------------------------------------------------*/
+/** @defgroup LINM_Exported_Macros LINM Exported Macros
+  * @{
+  */
+
+/** @brief  Reset LINM handle state.
+  * @param  __HANDLE__ LINM handle.
+  * @retval None
+  */
+#define __HAL_LINM_RESET_HANDLE_STATE(__HANDLE__) ((__HANDLE__)->State = HAL_LINM_STATE_RESET)
+
+/**
+  * @}
+  */
+
+/* Exported functions --------------------------------------------------------*/
+/** @addtogroup LINM_Exported_Functions
+  * @{
+  */
+
+/** @addtogroup LINM_Exported_Functions_Group1
+  * @{
+  */
+/* Initialization and de-initialization functions  ****************************/
+HAL_StatusTypeDef HAL_LINM_Init(LINM_HandleTypeDef *hlinm);
+HAL_StatusTypeDef HAL_LINM_DeInit(LINM_HandleTypeDef *hlinm);
+/**
+  * @}
+  */
+
+/** @addtogroup LINM_Exported_Functions_Group2
+  * @{
+  */
+/* IO operation functions  ****************************************************/
+HAL_StatusTypeDef HAL_LINM_Start(LINM_HandleTypeDef *hlinm, const LINM_ScheduleEntryTypeDef *pTable,
+                                 uint32_t TableSize);
+HAL_StatusTypeDef HAL_LINM_Stop(LINM_HandleTypeDef *hlinm);
+HAL_StatusTypeDef HAL_LINM_SetTable(LINM_HandleTypeDef *hlinm, const LINM_ScheduleEntryTypeDef *pTable,
+                                    uint32_t TableSize);
+void              HAL_LINM_IRQHandler(LINM_HandleTypeDef *hlinm);
+uint8_t           HAL_LINM_ComputePID(uint32_t Id);
+uint8_t           HAL_LINM_ComputeChecksum(uint8_t Pid, const uint8_t *pData, uint32_t Size, uint32_t ChecksumType);
+
+/* Callback functions *********************************************************/
+void              HAL_LINM_FrameCpltCallback(LINM_HandleTypeDef *hlinm);
+void              HAL_LINM_FrameErrorCallback(LINM_HandleTypeDef *hlinm);
+void              HAL_LINM_ErrorCallback(LINM_HandleTypeDef *hlinm);
+/**
+  * @}
+  */
+
+/** @addtogroup LINM_Exported_Functions_Group3
+  * @{
+  */
+/* Peripheral State and Error functions  **************************************/
+HAL_LINM_StateTypeDef HAL_LINM_GetState(LINM_HandleTypeDef *hlinm);
+uint32_t              HAL_LINM_GetError(LINM_HandleTypeDef *hlinm);
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#endif /* HAL_UART_MODULE_ENABLED && HAL_DMA_MODULE_ENABLED && HAL_TIM_MODULE_ENABLED */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STM32G4xx_HAL_LINM_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
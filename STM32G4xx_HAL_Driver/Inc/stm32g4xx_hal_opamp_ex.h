@@ -28,6 +28,16 @@ extern "C" {
 /* Includes ------------------------------------------------------------------*/
 #include "stm32g4xx_hal_def.h"
 
+/* Private constants ---------------------------------------------------------*/
+/** @defgroup OPAMPEx_Private_Constants OPAMP Extended Private Constants
+  * @{
+  */
+#define OPAMPEX_AUTORANGE_TAGS         8UL   /*!< Depth of the auto-ranging gain change ring */
+#define OPAMPEX_AUTORANGE_GAIN_NB      6UL   /*!< Number of PGA gains (2 to 64) */
+/**
+  * @}
+  */
+
 /** @addtogroup STM32G4xx_HAL_Driver
   * @{
   */
@@ -36,6 +46,60 @@ extern "C" {
   * @{
   */
 /* Exported types ------------------------------------------------------------*/
+#if defined(HAL_ADC_MODULE_ENABLED)
+/** @defgroup OPAMPEx_Exported_Types OPAMP Extended Exported Types
+  * @{
+  */
+
+/**
+  * @brief  OPAMP PGA auto-ranging gain change tag
+  */
+typedef struct
+{
+  uint32_t Position;      /*!< Index in the ADC DMA buffer of the first sample converted with Gain */
+
+  uint32_t Gain;          /*!< PGA gain index applied from Position onwards (gain = 2^(Gain + 1)) */
+
+} OPAMPEx_GainTagTypeDef;
+
+/**
+  * @brief  OPAMP PGA auto-ranging structure definition
+  */
+typedef struct
+{
+  OPAMP_HandleTypeDef    *hopamp;         /*!< OPAMP handle configured in PGA mode */
+
+  ADC_HandleTypeDef      *hadc;           /*!< ADC handle converting the OPAMP output in circular DMA mode */
+
+  uint32_t               Channel;         /*!< ADC channel connected to the OPAMP output.
+                                               This parameter can be a value of @ref ADC_HAL_EC_CHANNEL */
+
+  uint16_t               *pBuffer;        /*!< ADC circular DMA buffer (12-bit right aligned samples) */
+
+  uint32_t               BufferLength;    /*!< Number of samples in pBuffer */
+
+  uint32_t               MinGain;         /*!< Lowest PGA gain index allowed (0 for gain 2) */
+
+  uint32_t               MaxGain;         /*!< Highest PGA gain index allowed (5 for gain 64) */
+
+  uint32_t               HighThreshold;   /*!< ADC code above which the gain is decreased */
+
+  uint32_t               LowThreshold;    /*!< ADC code below which the gain is increased.
+                                               Must be lower than HighThreshold / 2 to avoid gain toggling */
+
+  __IO uint32_t          Gain;            /*!< Current PGA gain index, managed by the driver */
+
+  OPAMPEx_GainTagTypeDef Tags[OPAMPEX_AUTORANGE_TAGS]; /*!< Ring of the last gain changes, managed by the driver */
+
+  __IO uint32_t          TagCount;        /*!< Number of gain changes since start, managed by the driver */
+
+} OPAMPEx_AutoRangeTypeDef;
+
+/**
+  * @}
+  */
+#endif /* HAL_ADC_MODULE_ENABLED */
+
 /* Exported constants --------------------------------------------------------*/
 /* Exported macro ------------------------------------------------------------*/
 /* Exported functions --------------------------------------------------------*/
@@ -64,6 +128,18 @@ HAL_StatusTypeDef HAL_OPAMPEx_SelfCalibrateAll(OPAMP_HandleTypeDef *hopamp1, OPA
   * @}
   */
 
+#if defined(HAL_ADC_MODULE_ENABLED)
+/** @addtogroup OPAMPEx_Exported_Functions_Group2 Extended PGA auto-ranging functions
+  * @{
+  */
+HAL_StatusTypeDef HAL_OPAMPEx_AutoRange_Start(OPAMPEx_AutoRangeTypeDef *pRange);
+HAL_StatusTypeDef HAL_OPAMPEx_AutoRange_Stop(OPAMPEx_AutoRangeTypeDef *pRange);
+void              HAL_OPAMPEx_AutoRange_IRQHandler(OPAMPEx_AutoRangeTypeDef *pRange);
+/**
+  * @}
+  */
+#endif /* HAL_ADC_MODULE_ENABLED */
+
 /**
   * @}
   */
@@ -54,6 +54,11 @@ HAL_StatusTypeDef  HAL_PCDEx_PMAConfig(PCD_HandleTypeDef *hpcd,
                                        uint16_t ep_kind,
                                        uint32_t pmaadress);
 
+HAL_StatusTypeDef HAL_PCDEx_EP_QueueTransmit(PCD_HandleTypeDef *hpcd, uint8_t ep_addr,
+                                             uint8_t *pBuf, uint32_t len);
+HAL_StatusTypeDef HAL_PCDEx_EP_QueueReceive(PCD_HandleTypeDef *hpcd, uint8_t ep_addr,
+                                            uint8_t *pBuf, uint32_t len);
+uint32_t HAL_PCDEx_EP_GetQueuedRxCount(PCD_HandleTypeDef *hpcd, uint8_t ep_addr);
 
 HAL_StatusTypeDef HAL_PCDEx_ActivateLPM(PCD_HandleTypeDef *hpcd);
 HAL_StatusTypeDef HAL_PCDEx_DeActivateLPM(PCD_HandleTypeDef *hpcd);
@@ -127,6 +127,23 @@ typedef struct
                                         This parameter can be a value of @ref RCC_RTC_Clock_Source */
 }RCC_PeriphCLKInitTypeDef;
 
+/**
+  * @brief  RCC HSI calibration against LSE structure definition
+  */
+typedef struct
+{
+  uint32_t MeasureCycles;         /*!< Number of 8 LSE periods captures averaged per measurement.
+                                       This parameter must be a number between 1 and 256 */
+
+  uint32_t HSICalibrationValue;   /*!< HSI trimming value applied at the end of the calibration (output).
+                                       This parameter is a number between 0 and 0x7F */
+
+  uint32_t HSIFrequency;          /*!< HSI frequency measured with the trimming value applied, in Hz (output) */
+
+  int32_t  HSIErrorPpm;           /*!< Remaining HSI frequency error versus HSI_VALUE, in ppm (output) */
+
+}RCC_HSICalibrationTypeDef;
+
 /**
   * @brief RCC_CRS Init structure definition
   */
@@ -175,6 +192,86 @@ typedef struct
 
 }RCC_CRSSynchroInfoTypeDef;
 
+/**
+  * @brief RCC_CRS USB auto-trim history record definition
+  */
+typedef struct
+{
+  uint32_t Tick;                  /*!< HAL tick at which the record was taken */
+
+  uint32_t HSI48CalibrationValue; /*!< HSI48 trimming value after the event was handled.
+                                       This parameter is a number between 0 and 0x7F */
+
+  uint32_t FreqErrorCapture;      /*!< Frequency error counter value latched at the last SYNC event.
+                                       This parameter is a number between 0 and 0xFFFF */
+
+  uint32_t FreqErrorDirection;    /*!< Counting direction latched at the last SYNC event.
+                                       This parameter is a value of @ref RCCEx_CRS_FreqErrorDirection */
+
+  uint32_t Event;                 /*!< Event which produced the record.
+                                       This parameter is a combination of @ref RCCEx_CRS_Status */
+
+}RCC_CRSTrimRecordTypeDef;
+
+/**
+  * @brief RCC_CRS USB auto-trim service context definition
+  */
+typedef struct
+{
+  RCC_CRSTrimRecordTypeDef *pHistory; /*!< Trim history ring buffer provided by the user */
+
+  uint32_t HistorySize;           /*!< Number of records of pHistory, must be a power of 2 */
+
+  __IO uint32_t HistoryCount;     /*!< Free running count of records written in pHistory, the most
+                                       recent record is pHistory[(HistoryCount - 1) & (HistorySize - 1)] */
+
+  __IO uint32_t SyncWarnCount;    /*!< Number of SYNC warnings (trimming at its limit of accuracy) */
+
+  __IO uint32_t SyncErrCount;     /*!< Number of SYNC errors (frequency error above 128 x FELIM) */
+
+  __IO uint32_t SyncMissCount;    /*!< Number of missed SYNC events (no USB SOF received) */
+
+  __IO uint32_t TrimOvfCount;     /*!< Number of automatic trimming overflows or underflows */
+
+  __IO uint32_t CoarseTrimCount;  /*!< Number of software TRIM corrections applied on SYNC errors */
+
+  __IO uint32_t TrimMin;          /*!< Lowest HSI48 trimming value observed since start */
+
+  __IO uint32_t TrimMax;          /*!< Highest HSI48 trimming value observed since start */
+
+}RCC_CRSAutoTrimTypeDef;
+
+/**
+  * @brief  RCC operating point structure definition: regulator voltage range and
+  *         system clock applied together by HAL_RCCEx_SetOperatingPoint()
+  */
+typedef struct
+{
+  uint32_t VoltageScaling;    /*!< The regulator voltage range.
+                                   This parameter must be a value of @ref PWREx_Regulator_Voltage_Scale */
+
+  uint32_t SYSCLKSource;      /*!< The system clock source: RCC_SYSCLKSOURCE_HSI, or RCC_SYSCLKSOURCE_PLLCLK
+                                   with the main PLL clocked by HSI */
+
+  uint32_t PLLM;              /*!< PLLM: division factor for the PLL input clock, used with RCC_SYSCLKSOURCE_PLLCLK.
+                                   This parameter must be a value of @ref RCC_PLLM_Clock_Divider */
+
+  uint32_t PLLN;              /*!< PLLN: multiplication factor for the PLL VCO, used with RCC_SYSCLKSOURCE_PLLCLK.
+                                   This parameter must be a number between Min_Data = 8 and Max_Data = 127 */
+
+  uint32_t PLLR;              /*!< PLLR: division factor for the main system clock, used with RCC_SYSCLKSOURCE_PLLCLK.
+                                   This parameter must be a value of @ref RCC_PLLR_Clock_Divider */
+
+  uint32_t AHBCLKDivider;     /*!< The AHB clock (HCLK) divider.
+                                   This parameter can be a value of @ref RCC_AHB_Clock_Source */
+
+  uint32_t APB1CLKDivider;    /*!< The APB1 clock (PCLK1) divider.
+                                   This parameter can be a value of @ref RCC_APB1_APB2_Clock_Source */
+
+  uint32_t APB2CLKDivider;    /*!< The APB2 clock (PCLK2) divider.
+                                   This parameter can be a value of @ref RCC_APB1_APB2_Clock_Source */
+}RCC_OperatingPointTypeDef;
+
 /**
   * @}
   */
@@ -184,6 +281,33 @@ typedef struct
   * @{
   */
 
+/** @defgroup RCCEx_Performance_Level Performance Level
+  * @brief    Predefined operating points, all clocked from HSI16
+  * @{
+  */
+#define RCC_PERF_LEVEL_0               0U   /*!< HSI 16 MHz, voltage range 2                        */
+#define RCC_PERF_LEVEL_1               1U   /*!< PLL 26 MHz, voltage range 2                        */
+#define RCC_PERF_LEVEL_2               2U   /*!< PLL 150 MHz, voltage range 1                       */
+#if defined(PWR_CR5_R1MODE)
+#define RCC_PERF_LEVEL_3               3U   /*!< PLL 170 MHz, voltage range 1 boost                 */
+#define RCC_PERF_LEVEL_MAX             RCC_PERF_LEVEL_3
+#else
+#define RCC_PERF_LEVEL_MAX             RCC_PERF_LEVEL_2
+#endif /* PWR_CR5_R1MODE */
+/**
+  * @}
+  */
+
+/** @defgroup RCCEx_Performance_Governor_Thresholds Performance Governor Thresholds
+  * @brief    CPU load thresholds, in percent, of HAL_RCCEx_PerformanceGovernor()
+  * @{
+  */
+#define RCC_PERF_LOAD_HIGH             80U  /*!< Above this load, the next level up is selected     */
+#define RCC_PERF_LOAD_LOW              30U  /*!< Below this load, the next level down is selected   */
+/**
+  * @}
+  */
+
 /** @defgroup RCCEx_LSCO_Clock_Source Low Speed Clock Source
   * @{
   */
@@ -1280,6 +1404,7 @@ void              HAL_RCCEx_LSECSS_IRQHandler(void);
 void              HAL_RCCEx_LSECSS_Callback(void);
 void              HAL_RCCEx_EnableLSCO(uint32_t LSCOSource);
 void              HAL_RCCEx_DisableLSCO(void);
+HAL_StatusTypeDef HAL_RCCEx_HSICalibrate(RCC_HSICalibrationTypeDef *pCalib);
 
 /**
   * @}
@@ -1293,12 +1418,29 @@ void              HAL_RCCEx_CRSConfig(RCC_CRSInitTypeDef *pInit);
 void              HAL_RCCEx_CRSSoftwareSynchronizationGenerate(void);
 void              HAL_RCCEx_CRSGetSynchronizationInfo(RCC_CRSSynchroInfoTypeDef *pSynchroInfo);
 uint32_t          HAL_RCCEx_CRSWaitSynchronization(uint32_t Timeout);
+HAL_StatusTypeDef HAL_RCCEx_CRSStartUSBAutoTrim(RCC_CRSAutoTrimTypeDef *pAutoTrim,
+                                                RCC_CRSTrimRecordTypeDef *pHistory, uint32_t HistorySize);
+void              HAL_RCCEx_CRSStopUSBAutoTrim(void);
 void              HAL_RCCEx_CRS_IRQHandler(void);
 void              HAL_RCCEx_CRS_SyncOkCallback(void);
 void              HAL_RCCEx_CRS_SyncWarnCallback(void);
 void              HAL_RCCEx_CRS_ExpectedSyncCallback(void);
 void              HAL_RCCEx_CRS_ErrorCallback(uint32_t Error);
 
+/**
+  * @}
+  */
+
+/** @addtogroup RCCEx_Exported_Functions_Group4
+  * @{
+  */
+
+HAL_StatusTypeDef HAL_RCCEx_SetOperatingPoint(const RCC_OperatingPointTypeDef *pOperatingPoint);
+HAL_StatusTypeDef HAL_RCCEx_SetPerformanceLevel(uint32_t Level);
+uint32_t          HAL_RCCEx_GetPerformanceLevel(void);
+HAL_StatusTypeDef HAL_RCCEx_PerformanceGovernor(uint32_t LoadPercent);
+void              HAL_RCCEx_PerformanceLevelCallback(uint32_t Level);
+
 /**
   * @}
   */
@@ -1588,6 +1730,8 @@ void              HAL_RCCEx_CRS_ErrorCallback(uint32_t Error);
 #define IS_RCC_CRS_FREQERRORDIR(__DIR__)   (((__DIR__) == RCC_CRS_FREQERRORDIR_UP) || \
                                             ((__DIR__) == RCC_CRS_FREQERRORDIR_DOWN))
 
+#define IS_RCC_PERF_LEVEL(__LEVEL__)       ((__LEVEL__) <= RCC_PERF_LEVEL_MAX)
+
 /**
   * @}
   */
@@ -191,6 +191,32 @@ typedef struct
   */
 typedef uint32_t HAL_SMARTCARD_StateTypeDef;
 
+/**
+  * @brief  SMARTCARD T=1 block engine structure definition
+  * @note   Allocated by the application and handed to HAL_SMARTCARD_T1_Start(), it is used by the
+  *         driver until HAL_SMARTCARD_T1_Stop(). The wait times follow ISO/IEC 7816-3, CWI and BWI
+  *         being read from the ATR: CWT = 11 + 2^CWI etu and BWT = 11 + 2^BWI x 960 x Di etu.
+  */
+typedef struct
+{
+  uint32_t      CharWaitTime;        /*!< Character waiting time CWT, in etu, from 12 to 0x0100000A       */
+
+  uint32_t      BlockWaitTime;       /*!< Block waiting time BWT, in etu, from 12 to 0x0100000A           */
+
+  uint32_t      EpilogueSize;        /*!< Size of the epilogue field of the blocks.
+                                          This parameter can be a value of @ref SMARTCARD_T1_Epilogue      */
+
+  uint32_t      WaitTimeExtension;   /*!< BWT multiplier of the next exchange only, set by the application
+                                          when it answers an S(WTX request), 0 for none                    */
+
+  __IO uint32_t RxCount;             /*!< Size of the last block received, prologue and epilogue included */
+
+  uint32_t      GuardPending;        /*!< Block guard time running since the last block received          */
+
+  __IO uint32_t Phase;               /*!< Step of the exchange.
+                                          This parameter can be a value of @ref SMARTCARD_T1_Phase         */
+} SMARTCARD_T1TypeDef;
+
 /**
   * @brief  SMARTCARD handle Structure definition
   */
@@ -243,6 +269,8 @@ typedef struct __SMARTCARD_HandleTypeDef
 
   __IO uint32_t                     ErrorCode;             /*!< SmartCard Error code                                  */
 
+  SMARTCARD_T1TypeDef               *pT1;                  /*!< T=1 block engine context, NULL if not started         */
+
 #if (USE_HAL_SMARTCARD_REGISTER_CALLBACKS == 1)
   void (* TxCpltCallback)(struct __SMARTCARD_HandleTypeDef *hsmartcard);            /*!< SMARTCARD Tx Complete Callback             */
 
@@ -356,6 +384,53 @@ typedef enum
 #if (USE_HAL_SMARTCARD_REGISTER_CALLBACKS == 1)
 #define HAL_SMARTCARD_ERROR_INVALID_CALLBACK ((uint32_t)0x00000040U)         /*!< Invalid Callback error  */
 #endif /* USE_HAL_SMARTCARD_REGISTER_CALLBACKS */
+#define HAL_SMARTCARD_ERROR_BLOCK            ((uint32_t)0x00000080U)         /*!< T=1 block length or LRC error */
+/**
+  * @}
+  */
+
+/** @defgroup SMARTCARD_T1_Epilogue SMARTCARD T=1 Epilogue Field
+  * @{
+  */
+#define SMARTCARD_T1_EPILOGUE_LRC           0x00000001U                     /*!< Longitudinal redundancy check, checked by the driver */
+#define SMARTCARD_T1_EPILOGUE_CRC           0x00000002U                     /*!< Cyclic redundancy check, checked by the application  */
+/**
+  * @}
+  */
+
+/** @defgroup SMARTCARD_T1_Phase SMARTCARD T=1 Exchange Phase
+  * @{
+  */
+#define SMARTCARD_T1_PHASE_IDLE             0x00000000U                     /*!< No exchange ongoing                          */
+#define SMARTCARD_T1_PHASE_GUARD            0x00000001U                     /*!< Waiting for the end of the block guard time  */
+#define SMARTCARD_T1_PHASE_TX               0x00000002U                     /*!< Block being sent                             */
+#define SMARTCARD_T1_PHASE_NAD              0x00000003U                     /*!< Waiting for the first character, within BWT  */
+#define SMARTCARD_T1_PHASE_HEADER           0x00000004U                     /*!< PCB and LEN being received                   */
+#define SMARTCARD_T1_PHASE_BODY             0x00000005U                     /*!< Information and epilogue being received      */
+/**
+  * @}
+  */
+
+/** @defgroup SMARTCARD_T1_PCB SMARTCARD T=1 S-Block Protocol Control Bytes
+  * @{
+  */
+#define SMARTCARD_T1_PCB_RESYNCH_REQUEST    0xC0U                           /*!< S(RESYNCH request) */
+#define SMARTCARD_T1_PCB_RESYNCH_RESPONSE   0xE0U                           /*!< S(RESYNCH response) */
+#define SMARTCARD_T1_PCB_IFS_REQUEST        0xC1U                           /*!< S(IFS request)     */
+#define SMARTCARD_T1_PCB_IFS_RESPONSE       0xE1U                           /*!< S(IFS response)    */
+#define SMARTCARD_T1_PCB_ABORT_REQUEST      0xC2U                           /*!< S(ABORT request)   */
+#define SMARTCARD_T1_PCB_ABORT_RESPONSE     0xE2U                           /*!< S(ABORT response)  */
+#define SMARTCARD_T1_PCB_WTX_REQUEST        0xC3U                           /*!< S(WTX request)     */
+#define SMARTCARD_T1_PCB_WTX_RESPONSE       0xE3U                           /*!< S(WTX response)    */
+/**
+  * @}
+  */
+
+/** @defgroup SMARTCARD_T1_Timings SMARTCARD T=1 Timings
+  * @{
+  */
+#define SMARTCARD_T1_BGT                    22U                             /*!< Block guard time, in etu              */
+#define SMARTCARD_T1_INF_SIZE_MAX           254U                            /*!< Largest information field of a block  */
 /**
   * @}
   */
@@ -1176,6 +1251,15 @@ void HAL_SMARTCARD_AbortCpltCallback(SMARTCARD_HandleTypeDef *hsmartcard);
 void HAL_SMARTCARD_AbortTransmitCpltCallback(SMARTCARD_HandleTypeDef *hsmartcard);
 void HAL_SMARTCARD_AbortReceiveCpltCallback(SMARTCARD_HandleTypeDef *hsmartcard);
 
+/* T=1 block protocol functions */
+HAL_StatusTypeDef HAL_SMARTCARD_T1_Start(SMARTCARD_HandleTypeDef *hsmartcard, SMARTCARD_T1TypeDef *pT1);
+HAL_StatusTypeDef HAL_SMARTCARD_T1_Stop(SMARTCARD_HandleTypeDef *hsmartcard);
+HAL_StatusTypeDef HAL_SMARTCARD_T1_Transceive_DMA(SMARTCARD_HandleTypeDef *hsmartcard, uint8_t *pTxBlock,
+                                                  uint16_t TxSize, uint8_t *pRxBlock, uint16_t RxSize);
+uint32_t HAL_SMARTCARD_T1_BuildBlock(uint8_t *pBlock, uint8_t Nad, uint8_t Pcb, const uint8_t *pInf,
+                                     uint32_t Length);
+void HAL_SMARTCARD_T1_BlockCpltCallback(SMARTCARD_HandleTypeDef *hsmartcard);
+
 /**
   * @}
   */
@@ -100,6 +100,7 @@ typedef struct
 #define HAL_SMBUS_STATE_MASTER_BUSY_RX  (0x00000022U)  /*!< Master Data Reception process is ongoing      */
 #define HAL_SMBUS_STATE_SLAVE_BUSY_TX   (0x00000032U)  /*!< Slave Data Transmission process is ongoing    */
 #define HAL_SMBUS_STATE_SLAVE_BUSY_RX   (0x00000042U)  /*!< Slave Data Reception process is ongoing       */
+#define HAL_SMBUS_STATE_MASTER_BUSY_CMD (0x00000082U)  /*!< Master command list process is ongoing        */
 #define HAL_SMBUS_STATE_TIMEOUT         (0x00000003U)  /*!< Timeout state                                 */
 #define HAL_SMBUS_STATE_ERROR           (0x00000004U)  /*!< Reception process is ongoing                  */
 #define HAL_SMBUS_STATE_LISTEN          (0x00000008U)   /*!< Address Listen Mode is ongoing                */
@@ -128,6 +129,33 @@ typedef struct
   * @}
   */
 
+/** @defgroup SMBUS_Command_Structure_definition SMBUS Command Structure definition
+  * @brief  SMBUS command list entry structure definition
+  * @{
+  */
+typedef struct
+{
+  uint16_t DevAddress;             /*!< Specifies the target device address.
+                                     The device 7 bits address value in datasheet must be shifted to the left */
+
+  uint8_t Command;                 /*!< Specifies the command code sent before the repeated START */
+
+  uint8_t Protocol;                /*!< Specifies the read protocol.
+                                     This parameter can be a value of @ref SMBUS_Command_Protocol_definition */
+
+  uint8_t *pData;                  /*!< Pointer to the receive buffer.
+                                     For a block read, the byte count is stored first, followed by the data */
+
+  uint8_t Size;                    /*!< Specifies the receive buffer size in bytes.
+                                     It must be at least 1 for a byte read or a block read, 2 for a word read */
+
+  __IO uint8_t Status;             /*!< Command result, updated by the driver.
+                                     This parameter is a combination of @ref SMBUS_Command_Status_definition */
+} SMBUS_CmdTypeDef;
+/**
+  * @}
+  */
+
 /** @defgroup SMBUS_handle_Structure_definition SMBUS handle Structure definition
   * @brief  SMBUS handle Structure definition
   * @{
@@ -158,6 +186,18 @@ typedef struct
 
   __IO uint32_t                ErrorCode;       /*!< SMBUS Error code                   */
 
+  SMBUS_CmdTypeDef             *pCmdList;       /*!< SMBUS command list pointer         */
+
+  uint32_t                     CmdListSize;     /*!< SMBUS command list size            */
+
+  __IO uint32_t                CmdIndex;        /*!< SMBUS command list current index   */
+
+  SMBUS_CmdTypeDef             *pAlertCmdList;  /*!< SMBUS ALERT refresh list pointer   */
+
+  uint32_t                     AlertCmdListSize; /*!< SMBUS ALERT refresh list size     */
+
+  __IO uint32_t                AlertPending;    /*!< SMBUS ALERT refresh request        */
+
 #if (USE_HAL_SMBUS_REGISTER_CALLBACKS == 1)
   void (* MasterTxCpltCallback)(struct __SMBUS_HandleTypeDef *hsmbus);           /*!< SMBUS Master Tx Transfer completed callback */
   void (* MasterRxCpltCallback)(struct __SMBUS_HandleTypeDef *hsmbus);           /*!< SMBUS Master Rx Transfer completed callback */
@@ -345,6 +385,28 @@ typedef  void (*pSMBUS_AddrCallbackTypeDef)(SMBUS_HandleTypeDef *hsmbus, uint8_t
   * @}
   */
 
+/** @defgroup SMBUS_Command_Protocol_definition SMBUS Command Protocol definition
+  * @{
+  */
+#define  SMBUS_CMD_BLOCK_READ                   (0x00U)  /*!< Block read : byte count followed by data */
+#define  SMBUS_CMD_READ_BYTE                    (0x01U)  /*!< Read byte                                 */
+#define  SMBUS_CMD_READ_WORD                    (0x02U)  /*!< Read word                                 */
+/**
+  * @}
+  */
+
+/** @defgroup SMBUS_Command_Status_definition SMBUS Command Status definition
+  * @{
+  */
+#define  SMBUS_CMD_STATUS_OK                    (0x00U)  /*!< Command done without error                */
+#define  SMBUS_CMD_STATUS_NACK                  (0x01U)  /*!< Target NACKed its address                 */
+#define  SMBUS_CMD_STATUS_PECERR                (0x02U)  /*!< PEC mismatch detected by hardware         */
+#define  SMBUS_CMD_STATUS_SIZE                  (0x04U)  /*!< Block byte count null or above buffer size */
+#define  SMBUS_CMD_STATUS_NOT_DONE              (0x80U)  /*!< Command not executed                      */
+/**
+  * @}
+  */
+
 /** @defgroup SMBUS_Interrupt_configuration_definition SMBUS Interrupt configuration definition
   * @brief SMBUS Interrupt definition
   *        Elements values convention: 0xXXXXXXXX
@@ -590,6 +652,10 @@ typedef  void (*pSMBUS_AddrCallbackTypeDef)(SMBUS_HandleTypeDef *hsmbus, uint8_t
                                                          ((REQUEST) == SMBUS_NO_STARTSTOP))
 
 
+#define IS_SMBUS_CMD_PROTOCOL(PROTOCOL)                 (((PROTOCOL) == SMBUS_CMD_BLOCK_READ)                   || \
+                                                         ((PROTOCOL) == SMBUS_CMD_READ_BYTE)                    || \
+                                                         ((PROTOCOL) == SMBUS_CMD_READ_WORD))
+
 #define IS_SMBUS_TRANSFER_OPTIONS_REQUEST(REQUEST)      (IS_SMBUS_TRANSFER_OTHER_OPTIONS_REQUEST(REQUEST)       || \
                                                          ((REQUEST) == SMBUS_FIRST_FRAME)                       || \
                                                          ((REQUEST) == SMBUS_NEXT_FRAME)                        || \
@@ -683,6 +749,10 @@ HAL_StatusTypeDef HAL_SMBUS_Master_Transmit_IT(SMBUS_HandleTypeDef *hsmbus, uint
 HAL_StatusTypeDef HAL_SMBUS_Master_Receive_IT(SMBUS_HandleTypeDef *hsmbus, uint16_t DevAddress, uint8_t *pData,
                                               uint16_t Size, uint32_t XferOptions);
 HAL_StatusTypeDef HAL_SMBUS_Master_Abort_IT(SMBUS_HandleTypeDef *hsmbus, uint16_t DevAddress);
+HAL_StatusTypeDef HAL_SMBUS_Master_CmdList_IT(SMBUS_HandleTypeDef *hsmbus, SMBUS_CmdTypeDef *pCmdList,
+                                              uint32_t NbCmd);
+HAL_StatusTypeDef HAL_SMBUS_ConfigAlertCmdList(SMBUS_HandleTypeDef *hsmbus, SMBUS_CmdTypeDef *pCmdList,
+                                               uint32_t NbCmd);
 HAL_StatusTypeDef HAL_SMBUS_Slave_Transmit_IT(SMBUS_HandleTypeDef *hsmbus, uint8_t *pData, uint16_t Size,
                                               uint32_t XferOptions);
 HAL_StatusTypeDef HAL_SMBUS_Slave_Receive_IT(SMBUS_HandleTypeDef *hsmbus, uint8_t *pData, uint16_t Size,
@@ -704,6 +774,7 @@ void HAL_SMBUS_EV_IRQHandler(SMBUS_HandleTypeDef *hsmbus);
 void HAL_SMBUS_ER_IRQHandler(SMBUS_HandleTypeDef *hsmbus);
 void HAL_SMBUS_MasterTxCpltCallback(SMBUS_HandleTypeDef *hsmbus);
 void HAL_SMBUS_MasterRxCpltCallback(SMBUS_HandleTypeDef *hsmbus);
+void HAL_SMBUS_MasterCmdListCpltCallback(SMBUS_HandleTypeDef *hsmbus);
 void HAL_SMBUS_SlaveTxCpltCallback(SMBUS_HandleTypeDef *hsmbus);
 void HAL_SMBUS_SlaveRxCpltCallback(SMBUS_HandleTypeDef *hsmbus);
 void HAL_SMBUS_AddrCallback(SMBUS_HandleTypeDef *hsmbus, uint8_t TransferDirection, uint16_t AddrMatchCode);
@@ -349,6 +349,121 @@ typedef enum
   HAL_TIM_ACTIVE_CHANNEL_CLEARED  = 0x00U     /*!< All active channels cleared */
 } HAL_TIM_ActiveChannel;
 
+/**
+  * @brief  TIM input capture ring structure definition
+  * @note   The DMA writes the raw captures to pBuffer and the driver extends them
+  *         to 64-bit timestamps in pTimestamp, at the same index. Head is only
+  *         written by the driver and Tail only by the reader. Both indexes are
+  *         free running, the position in the arrays is (index & Mask).
+  */
+typedef struct
+{
+  uint32_t                      *pBuffer;         /*!< Raw captures written by the DMA, owned by the application */
+
+  uint64_t                      *pTimestamp;      /*!< Extended timestamps in counter ticks, owned by the application */
+
+  uint32_t                      Mask;             /*!< Ring size minus one, the size is a power of two            */
+
+  __IO uint32_t                 Head;             /*!< Write index, number of captures extended by the driver     */
+
+  __IO uint32_t                 Tail;             /*!< Read index, updated by the reader                          */
+
+  __IO uint32_t                 Overrun;          /*!< Count of updates that found the reader overtaken           */
+
+  uint32_t                      Filled;           /*!< Number of valid timestamps, saturated to the ring size     */
+
+  uint32_t                      Channel;          /*!< Capture channel, set by the driver                         */
+
+  uint32_t                      AutoReload;       /*!< Counter period, the counter runs from 0 to AutoReload      */
+
+  uint64_t                      Epoch;            /*!< Counter overflows since the start                          */
+
+  uint64_t                      LastEpoch;        /*!< Overflow count of the last extended capture                */
+
+  uint32_t                      LastCapture;      /*!< Raw value of the last extended capture                     */
+
+} TIM_CaptureRingTypeDef;
+
+/**
+  * @brief  TIM encoder service structure definition
+  * @note   The configuration fields are set by the application before
+  *         HAL_TIMEx_EncoderService_Start(), the other fields are managed by the driver.
+  *         The interrupt only counts the overflows and the index, the position and
+  *         the velocity are computed by HAL_TIMEx_EncoderService_GetSnapshot().
+  */
+typedef struct
+{
+  TIM_TypeDef                   *PeriodTimer;     /*!< Free-running timer capturing the encoder edges for the period
+                                                       measurement (M/T method), NULL to measure the time with the DWT
+                                                       cycle counter between snapshots (M method)                          */
+
+  uint32_t                      PeriodChannel;    /*!< Capture channel of PeriodTimer, TIM_CHANNEL_1 to TIM_CHANNEL_4       */
+
+  uint32_t                      PeriodClock;      /*!< Counter clock of PeriodTimer in Hz, unused without PeriodTimer      */
+
+  uint32_t                      CountsPerEdge;    /*!< Encoder counts between two captured edges, 2 when both edges of the
+                                                       A signal are captured in x4 mode                                    */
+
+  uint32_t                      StandstillTime;   /*!< Time without a new edge after which the velocity is zero, in ticks
+                                                       of PeriodClock (or CPU cycles without PeriodTimer)                  */
+
+  uint32_t                      HomeOnIndex;      /*!< When not 0, the position is reset to the counter value on the first
+                                                       index event                                                         */
+
+  uint32_t                      AutoReload;       /*!< Counter period, the counter runs from 0 to AutoReload               */
+
+  __IO uint32_t                 Sequence;         /*!< Incremented on each update of Epoch, Homed or IndexCount            */
+
+  int64_t                       Epoch;            /*!< Counter overflows minus underflows since the start or the homing    */
+
+  __IO uint32_t                 IndexCount;       /*!< Index events since the start                                        */
+
+  __IO uint32_t                 Homed;            /*!< Set on the first index event when HomeOnIndex is not 0              */
+
+  uint32_t                      LastHomed;        /*!< Homed at the last snapshot                                          */
+
+  int64_t                       LastPosition;     /*!< Position at the start of the velocity window                        */
+
+  uint32_t                      LastEdgeTime;     /*!< Edge capture at the start of the velocity window                    */
+
+  int64_t                       LastVelocity;     /*!< Velocity returned by the last snapshot                              */
+
+} TIM_EncoderServiceTypeDef;
+
+/**
+  * @brief  TIM pulse protocol encoder structure definition
+  * @note   Each payload bit is sent as one PWM period, with the compare value
+  *         ZeroCompare or OneCompare, most significant bit first. The bits are
+  *         expanded into the two halves of pBuffer while the DMA sends the other
+  *         half, then ResetSlots periods with a compare value of 0 end the frame.
+  */
+typedef struct
+{
+  uint32_t                      *pBuffer;         /*!< Ping-pong compare buffer read by the circular DMA, owned by the
+                                                       application                                                   */
+
+  uint32_t                      BufferSize;       /*!< Number of periods in pBuffer, even and at least 4             */
+
+  uint32_t                      ZeroCompare;      /*!< Compare value of a 0 bit                                      */
+
+  uint32_t                      OneCompare;       /*!< Compare value of a 1 bit                                      */
+
+  uint32_t                      ResetSlots;       /*!< Periods at a compare value of 0 after the payload, at least 2 */
+
+  uint32_t                      Channel;          /*!< Output channel, set by the driver                             */
+
+  const uint8_t                 *pData;           /*!< Payload being sent                                            */
+
+  uint32_t                      BitCount;         /*!< Payload size in bits                                          */
+
+  uint32_t                      BitIndex;         /*!< Next payload bit to expand                                    */
+
+  uint32_t                      ResetLeft;        /*!< Reset periods left to expand                                  */
+
+  __IO uint32_t                 Pending;          /*!< Buffer halves holding a part of the frame not yet sent        */
+
+} TIM_PulseEncoderTypeDef;
+
 /**
   * @brief  TIM Time Base Handle Structure definition
   */
@@ -368,6 +483,9 @@ typedef struct
   __IO HAL_TIM_ChannelStateTypeDef   ChannelState[6];   /*!< TIM channel operation state                       */
   __IO HAL_TIM_ChannelStateTypeDef   ChannelNState[4];  /*!< TIM complementary channel operation state         */
   __IO HAL_TIM_DMABurstStateTypeDef  DMABurstState;     /*!< DMA burst operation state                         */
+  TIM_CaptureRingTypeDef             *pCaptureRing;     /*!< Capture ring, only set while a ring capture is ongoing */
+  TIM_EncoderServiceTypeDef          *pEncoder;         /*!< Encoder service, only set while it is running     */
+  TIM_PulseEncoderTypeDef            *pPulseEncoder;    /*!< Pulse encoder, only set while a frame is sent      */
 
 #if (USE_HAL_TIM_REGISTER_CALLBACKS == 1)
   void (* Base_MspInitCallback)(struct __TIM_HandleTypeDef *htim);              /*!< TIM Base Msp Init Callback                              */
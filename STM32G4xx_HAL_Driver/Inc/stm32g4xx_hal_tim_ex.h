@@ -74,6 +74,84 @@ typedef struct
 }
 TIMEx_BreakInputConfigTypeDef;
 
+#if defined(HAL_COMP_MODULE_ENABLED) && defined(HAL_DAC_MODULE_ENABLED)
+/**
+  * @brief  TIM peak current control loop configuration
+  */
+typedef struct
+{
+  COMP_HandleTypeDef *hcomp;         /*!< Comparator sensing the current. Instance and Init are set by the caller,
+                                          except Init.InputMinus which is set to CompInputMinus */
+
+  uint32_t CompInputMinus;           /*!< Comparator input minus connected to the DAC channel.
+                                          This parameter can be a COMP_INPUT_MINUS_DACx_CHy value of @ref COMP_InputMinus */
+
+  DAC_HandleTypeDef *hdac;           /*!< DAC generating the peak current reference, initialized by HAL_DAC_Init() */
+
+  uint32_t DacChannel;               /*!< DAC channel generating the reference.
+                                          This parameter can be DAC_CHANNEL_1 or DAC_CHANNEL_2 */
+
+  uint32_t PeakValue;                /*!< Peak current reference at the start of each PWM period.
+                                          This parameter must be a number between Min_Data = 0 and Max_Data = 4095 */
+
+  uint32_t SlopeStep;                /*!< Slope compensation decrement of the reference on each step trigger,
+                                          12.4 bit format. 0 disables the slope compensation */
+
+  uint32_t SlopeResetTrigger;        /*!< DAC trigger restarting the slope at PeakValue, usually the timer TRGO.
+                                          This parameter can be a value of @ref DAC_trigger_selection */
+
+  uint32_t SlopeStepTrigger;         /*!< DAC trigger decrementing the reference by SlopeStep.
+                                          This parameter can be a value of @ref DAC_trigger_selection */
+
+  uint32_t Channel;                  /*!< Timer channel whose OCREF is cleared when the peak current is reached.
+                                          This parameter can be a value of @ref TIM_Channel */
+
+  uint32_t ClearInputSource;         /*!< Comparator output connected to the OCREF clear input.
+                                          This parameter can be a TIM_CLEARINPUTSOURCE_COMPx value of @ref TIM_ClearInput_Source */
+
+  uint32_t BreakInput;               /*!< Timer break input used for the over-current protection: TIM_BREAKINPUT_BRK,
+                                          TIM_BREAKINPUT_BRK2 or 0 for no protection */
+
+  uint32_t BreakInputSource;         /*!< Comparator output connected to the break input.
+                                          This parameter can be a TIM_BREAKINPUTSOURCE_COMPx value of @ref TIMEx_Break_Input_Source */
+} TIMEx_PeakCurrentConfigTypeDef;
+#endif /* HAL_COMP_MODULE_ENABLED && HAL_DAC_MODULE_ENABLED */
+
+/**
+  * @brief  TIM capture ring statistics structure definition
+  */
+typedef struct
+{
+  uint32_t Count;               /*!< Number of periods in the window */
+
+  uint64_t MinPeriod;           /*!< Shortest period of the window, in counter ticks */
+
+  uint64_t MaxPeriod;           /*!< Longest period of the window, in counter ticks */
+
+  uint64_t MeanPeriod;          /*!< Mean period of the window, in counter ticks */
+
+  uint64_t Frequency;           /*!< Mean frequency of the window, in millihertz */
+
+  uint32_t Duty;                /*!< High time over the window, in 1/10000 of the period.
+                                     Only computed when the channel captures both edges, 0 otherwise */
+} TIM_CaptureStatsTypeDef;
+
+/**
+  * @brief  TIM encoder snapshot structure definition
+  */
+typedef struct
+{
+  int64_t  Position;            /*!< Position in encoder counts, since the start or the homing */
+
+  int64_t  Velocity;            /*!< Velocity in 1/1000 of encoder count per second */
+
+  uint32_t IndexCount;          /*!< Index events since the start */
+
+  uint32_t Homed;               /*!< 1 once the position has been reset by the first index event */
+
+  uint32_t Direction;           /*!< 0 when the counter counts up, 1 when it counts down */
+} TIM_EncoderSnapshotTypeDef;
+
 /**
   * @brief  TIM Encoder index configuration
   */
@@ -2102,6 +2180,64 @@ HAL_TIM_ChannelStateTypeDef HAL_TIMEx_GetChannelNState(TIM_HandleTypeDef *htim,
   * @}
   */
 
+/** @addtogroup TIMEx_Exported_Functions_Group8 Extended Capture Ring functions
+  * @brief    Extended Capture Ring functions
+  * @{
+  */
+/* Extended Capture Ring functions  *******************************************/
+HAL_StatusTypeDef HAL_TIMEx_CaptureRing_Start_DMA(TIM_HandleTypeDef *htim, uint32_t Channel,
+                                                  TIM_CaptureRingTypeDef *pRing, uint32_t *pData,
+                                                  uint64_t *pTimestamp, uint16_t Size);
+HAL_StatusTypeDef HAL_TIMEx_CaptureRing_Stop_DMA(TIM_HandleTypeDef *htim);
+void HAL_TIMEx_CaptureRing_Update(TIM_HandleTypeDef *htim);
+uint32_t HAL_TIMEx_CaptureRing_GetData(TIM_CaptureRingTypeDef *pRing, uint64_t **ppTimestamp);
+void HAL_TIMEx_CaptureRing_Release(TIM_CaptureRingTypeDef *pRing, uint32_t Count);
+HAL_StatusTypeDef HAL_TIMEx_CaptureRing_GetStatistics(TIM_HandleTypeDef *htim, uint32_t WindowCount,
+                                                      uint32_t CounterClock, TIM_CaptureStatsTypeDef *pStats);
+/**
+  * @}
+  */
+
+#if defined(HAL_COMP_MODULE_ENABLED) && defined(HAL_DAC_MODULE_ENABLED)
+/** @addtogroup TIMEx_Exported_Functions_Group9 Extended Peak Current Control functions
+  * @brief    Extended Peak Current Control functions
+  * @{
+  */
+/* Extended Peak Current Control functions  ***********************************/
+HAL_StatusTypeDef HAL_TIMEx_PeakCurrent_Config(TIM_HandleTypeDef *htim, const TIMEx_PeakCurrentConfigTypeDef *sConfig);
+HAL_StatusTypeDef HAL_TIMEx_PeakCurrent_SetPeak(const TIMEx_PeakCurrentConfigTypeDef *sConfig, uint32_t PeakValue);
+/**
+  * @}
+  */
+#endif /* HAL_COMP_MODULE_ENABLED && HAL_DAC_MODULE_ENABLED */
+
+/** @addtogroup TIMEx_Exported_Functions_Group10 Extended Encoder Service functions
+  * @brief    Extended Encoder Service functions
+  * @{
+  */
+/* Extended Encoder Service functions  ****************************************/
+HAL_StatusTypeDef HAL_TIMEx_EncoderService_Start(TIM_HandleTypeDef *htim, TIM_EncoderServiceTypeDef *pService);
+HAL_StatusTypeDef HAL_TIMEx_EncoderService_Stop(TIM_HandleTypeDef *htim);
+HAL_StatusTypeDef HAL_TIMEx_EncoderService_GetSnapshot(TIM_HandleTypeDef *htim,
+                                                       TIM_EncoderSnapshotTypeDef *pSnapshot);
+/**
+  * @}
+  */
+
+/** @addtogroup TIMEx_Exported_Functions_Group11 Extended Pulse Encoder functions
+  * @brief    Extended Pulse Encoder functions
+  * @{
+  */
+/* Extended Pulse Encoder functions  ******************************************/
+HAL_StatusTypeDef HAL_TIMEx_PulseEncoder_Transmit_DMA(TIM_HandleTypeDef *htim, uint32_t Channel,
+                                                      TIM_PulseEncoderTypeDef *pEncoder,
+                                                      const uint8_t *pData, uint32_t Size);
+HAL_StatusTypeDef HAL_TIMEx_PulseEncoder_Abort(TIM_HandleTypeDef *htim);
+void HAL_TIMEx_PulseEncoder_TxCpltCallback(TIM_HandleTypeDef *htim);
+/**
+  * @}
+  */
+
 /**
   * @}
   */
@@ -2113,6 +2249,9 @@ HAL_TIM_ChannelStateTypeDef HAL_TIMEx_GetChannelNState(TIM_HandleTypeDef *htim,
   */
 void TIMEx_DMACommutationCplt(DMA_HandleTypeDef *hdma);
 void TIMEx_DMACommutationHalfCplt(DMA_HandleTypeDef *hdma);
+void TIMEx_CaptureRingPeriodElapsed(TIM_HandleTypeDef *htim);
+void TIMEx_EncoderPeriodElapsed(TIM_HandleTypeDef *htim);
+void TIMEx_EncoderIndexEvent(TIM_HandleTypeDef *htim);
 /**
   * @}
   */
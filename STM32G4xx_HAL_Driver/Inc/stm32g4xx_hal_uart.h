@@ -192,6 +192,63 @@ typedef enum
   UART_CLOCKSOURCE_UNDEFINED  = 0x10U     /*!< Undefined clock source */
 } UART_ClockSourceTypeDef;
 
+#if !defined(USE_HAL_UART_CONST_CALLBACKS)
+#define USE_HAL_UART_CONST_CALLBACKS 0U
+#endif /* USE_HAL_UART_CONST_CALLBACKS */
+
+#if (USE_HAL_UART_REGISTER_CALLBACKS == 1) && (USE_HAL_UART_CONST_CALLBACKS == 1)
+#error "USE_HAL_UART_REGISTER_CALLBACKS and USE_HAL_UART_CONST_CALLBACKS cannot be both enabled"
+#endif /* USE_HAL_UART_REGISTER_CALLBACKS && USE_HAL_UART_CONST_CALLBACKS */
+
+#if (USE_HAL_UART_CONST_CALLBACKS == 1)
+struct __UART_HandleTypeDef;
+
+/**
+  * @brief  UART constant callback set definition
+  * @note   Intended to be declared const so that it is placed in flash and shared by
+  *         reference. Every entry must be set: point the unused ones to the default
+  *         (weak) HAL callbacks.
+  */
+typedef struct
+{
+  void (* TxHalfCpltCallback)(struct __UART_HandleTypeDef *huart);        /*!< UART Tx Half Complete Callback        */
+  void (* TxCpltCallback)(struct __UART_HandleTypeDef *huart);            /*!< UART Tx Complete Callback             */
+  void (* RxHalfCpltCallback)(struct __UART_HandleTypeDef *huart);        /*!< UART Rx Half Complete Callback        */
+  void (* RxCpltCallback)(struct __UART_HandleTypeDef *huart);            /*!< UART Rx Complete Callback             */
+  void (* ErrorCallback)(struct __UART_HandleTypeDef *huart);             /*!< UART Error Callback                   */
+  void (* AbortCpltCallback)(struct __UART_HandleTypeDef *huart);         /*!< UART Abort Complete Callback          */
+  void (* AbortTransmitCpltCallback)(struct __UART_HandleTypeDef *huart); /*!< UART Abort Transmit Complete Callback */
+  void (* AbortReceiveCpltCallback)(struct __UART_HandleTypeDef *huart);  /*!< UART Abort Receive Complete Callback  */
+  void (* WakeupCallback)(struct __UART_HandleTypeDef *huart);            /*!< UART Wakeup Callback                  */
+  void (* RxFifoFullCallback)(struct __UART_HandleTypeDef *huart);        /*!< UART Rx Fifo Full Callback            */
+  void (* TxFifoEmptyCallback)(struct __UART_HandleTypeDef *huart);       /*!< UART Tx Fifo Empty Callback           */
+  void (* RingRxEventCallback)(struct __UART_HandleTypeDef *huart);       /*!< UART Rx Ring Event Callback           */
+
+  void (* MspInitCallback)(struct __UART_HandleTypeDef *huart);           /*!< UART Msp Init callback                */
+  void (* MspDeInitCallback)(struct __UART_HandleTypeDef *huart);         /*!< UART Msp DeInit callback              */
+} UART_CallbacksTypeDef;
+#endif /* USE_HAL_UART_CONST_CALLBACKS */
+
+/**
+  * @brief  UART Rx ring buffer structure definition
+  * @note   Head is only written by the driver and Tail only by the reader, so the
+  *         ring can be drained from thread context without disabling interrupts.
+  *         Both indexes are free running, the position in pBuffer is (index & Mask).
+  */
+typedef struct
+{
+  uint8_t                       *pBuffer;         /*!< Ring storage, owned by the application              */
+
+  uint32_t                      Mask;             /*!< Ring size minus one, the size is a power of two      */
+
+  __IO uint32_t                 Head;             /*!< Write index, updated by the driver from the DMA NDTR */
+
+  __IO uint32_t                 Tail;             /*!< Read index, updated by the reader                    */
+
+  __IO uint32_t                 Overrun;          /*!< Count of updates that found the reader overtaken     */
+
+} UART_RingTypeDef;
+
 /**
   * @brief  UART handle Structure definition
   */
@@ -243,6 +300,8 @@ typedef struct __UART_HandleTypeDef
 
   __IO uint32_t                 ErrorCode;           /*!< UART Error code                    */
 
+  UART_RingTypeDef              *pRxRing;            /*!< Rx ring buffer, only set while a ring reception is ongoing */
+
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
   void (* TxHalfCpltCallback)(struct __UART_HandleTypeDef *huart);        /*!< UART Tx Half Complete Callback        */
   void (* TxCpltCallback)(struct __UART_HandleTypeDef *huart);            /*!< UART Tx Complete Callback             */
@@ -260,6 +319,10 @@ typedef struct __UART_HandleTypeDef
   void (* MspDeInitCallback)(struct __UART_HandleTypeDef *huart);         /*!< UART Msp DeInit callback              */
 #endif  /* USE_HAL_UART_REGISTER_CALLBACKS */
 
+#if (USE_HAL_UART_CONST_CALLBACKS == 1)
+  const UART_CallbacksTypeDef   *pCallbacks;         /*!< Callback set bound to the instance, default one when NULL */
+#endif /* USE_HAL_UART_CONST_CALLBACKS */
+
 } UART_HandleTypeDef;
 
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
@@ -1563,6 +1626,9 @@ extern const uint16_t UARTPrescTable[12];
   */
 
 /* Initialization and de-initialization functions  ****************************/
+#if (USE_HAL_UART_CONST_CALLBACKS == 1)
+extern const UART_CallbacksTypeDef HAL_UART_DefaultCallbacks;
+#endif /* USE_HAL_UART_CONST_CALLBACKS */
 HAL_StatusTypeDef HAL_UART_Init(UART_HandleTypeDef *huart);
 HAL_StatusTypeDef HAL_HalfDuplex_Init(UART_HandleTypeDef *huart);
 HAL_StatusTypeDef HAL_LIN_Init(UART_HandleTypeDef *huart, uint32_t BreakDetectLength);
@@ -1577,6 +1643,9 @@ HAL_StatusTypeDef HAL_UART_RegisterCallback(UART_HandleTypeDef *huart, HAL_UART_
                                             pUART_CallbackTypeDef pCallback);
 HAL_StatusTypeDef HAL_UART_UnRegisterCallback(UART_HandleTypeDef *huart, HAL_UART_CallbackIDTypeDef CallbackID);
 #endif /* USE_HAL_UART_REGISTER_CALLBACKS */
+#if (USE_HAL_UART_CONST_CALLBACKS == 1)
+HAL_StatusTypeDef HAL_UART_BindCallbacks(UART_HandleTypeDef *huart, const UART_CallbacksTypeDef *pCallbacks);
+#endif /* USE_HAL_UART_CONST_CALLBACKS */
 
 /**
   * @}
@@ -123,6 +123,17 @@ typedef struct
   * @}
   */
 
+/** @defgroup UARTEx_Ring_WakeUp_Source UARTEx Ring reception wake-up source
+  * @brief    Events waking the MCU up from Stop mode during a FIFO ring reception
+  * @{
+  */
+#define UART_RING_WAKEUP_RXFIFO_THRESHOLD  USART_CR3_RXFTIE  /*!< RXFIFO threshold reached                    */
+#define UART_RING_WAKEUP_WUF               USART_CR3_WUFIE   /*!< Address match or Start bit, as selected with
+                                                                  HAL_UARTEx_StopModeWakeUpSourceConfig()     */
+/**
+  * @}
+  */
+
 /**
   * @}
   */
@@ -154,6 +165,8 @@ void HAL_UARTEx_WakeupCallback(UART_HandleTypeDef *huart);
 void HAL_UARTEx_RxFifoFullCallback(UART_HandleTypeDef *huart);
 void HAL_UARTEx_TxFifoEmptyCallback(UART_HandleTypeDef *huart);
 
+void HAL_UARTEx_RingRxEventCallback(UART_HandleTypeDef *huart);
+
 /**
   * @}
   */
@@ -174,6 +187,15 @@ HAL_StatusTypeDef HAL_UARTEx_DisableFifoMode(UART_HandleTypeDef *huart);
 HAL_StatusTypeDef HAL_UARTEx_SetTxFifoThreshold(UART_HandleTypeDef *huart, uint32_t Threshold);
 HAL_StatusTypeDef HAL_UARTEx_SetRxFifoThreshold(UART_HandleTypeDef *huart, uint32_t Threshold);
 
+HAL_StatusTypeDef HAL_UARTEx_RingReceive_DMA(UART_HandleTypeDef *huart, UART_RingTypeDef *pRing, uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_UARTEx_RingReceiveStopMode_IT(UART_HandleTypeDef *huart, UART_RingTypeDef *pRing, uint8_t *pData,
+                                                    uint16_t Size, uint32_t WakeUpSource);
+HAL_StatusTypeDef HAL_UARTEx_RingReceive_Stop(UART_HandleTypeDef *huart);
+void              HAL_UARTEx_RingReceive_Update(UART_HandleTypeDef *huart);
+uint32_t          HAL_UARTEx_Ring_GetCount(UART_RingTypeDef *pRing);
+uint32_t          HAL_UARTEx_Ring_GetData(UART_RingTypeDef *pRing, uint8_t **ppData);
+void              HAL_UARTEx_Ring_Release(UART_RingTypeDef *pRing, uint32_t Count);
+
 /**
   * @}
   */
@@ -624,6 +646,15 @@ HAL_StatusTypeDef HAL_UARTEx_SetRxFifoThreshold(UART_HandleTypeDef *huart, uint3
                                                  ((__THRESHOLD__) == UART_RXFIFO_THRESHOLD_7_8) || \
                                                  ((__THRESHOLD__) == UART_RXFIFO_THRESHOLD_8_8))
 
+/**
+  * @brief Ensure that the UART ring reception wake-up source is valid.
+  * @param __SOURCE__ UART ring reception wake-up source.
+  * @retval SET (__SOURCE__ is valid) or RESET (__SOURCE__ is invalid)
+  */
+#define IS_UART_RING_WAKEUP_SOURCE(__SOURCE__) ((((__SOURCE__) & ~(UART_RING_WAKEUP_RXFIFO_THRESHOLD | \
+                                                                  UART_RING_WAKEUP_WUF)) == 0U) && \
+                                                ((__SOURCE__) != 0U))
+
 /**
   * @}
   */
@@ -0,0 +1,320 @@
+/**
+  ******************************************************************************
+  * @file    stm32g4xx_hal_ucpd.h
+  * @author  MCD Application Team
+  * @brief   Header file of UCPD HAL module.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef STM32G4xx_HAL_UCPD_H
+#define STM32G4xx_HAL_UCPD_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32g4xx_hal_def.h"
+#include "stm32g4xx_ll_ucpd.h"
+
+#if defined(UCPD1)
+/** @addtogroup STM32G4xx_HAL_Driver
+  * @{
+  */
+
+/** @addtogroup UCPD
+  * @{
+  */
+
+/* Exported constants --------------------------------------------------------*/
+/** @defgroup UCPD_Exported_Constants UCPD Exported Constants
+  * @{
+  */
+
+/** @defgroup UCPD_Rx_Buffer_Size UCPD Rx Buffer Size
+  * @{
+  */
+#define UCPD_RX_BUFFER_SIZE                 132U  /*!< Size of each Rx message buffer (payload and CRC) */
+/**
+  * @}
+  */
+
+/** @defgroup UCPD_Role UCPD Role
+  * @{
+  */
+#define UCPD_ROLE_SINK                      LL_UCPD_ROLE_SNK  /*!< Sink, Rd presented on CC lines   */
+#define UCPD_ROLE_SOURCE                    LL_UCPD_ROLE_SRC  /*!< Source, Rp presented on CC lines */
+/**
+  * @}
+  */
+
+/** @defgroup UCPD_Data_Role UCPD Data Role
+  * @{
+  */
+#define UCPD_DATA_ROLE_UFP                  0x00U  /*!< Upstream facing port   */
+#define UCPD_DATA_ROLE_DFP                  0x01U  /*!< Downstream facing port */
+/**
+  * @}
+  */
+
+/** @defgroup UCPD_Spec_Revision UCPD Specification Revision
+  * @{
+  */
+#define UCPD_SPEC_REVISION_2_0              0x01U  /*!< USB PD revision 2.0 */
+#define UCPD_SPEC_REVISION_3_0              0x02U  /*!< USB PD revision 3.0 */
+/**
+  * @}
+  */
+
+/** @defgroup UCPD_Error_Code UCPD Error Code
+  * @{
+  */
+#define HAL_UCPD_ERROR_NONE                 0x00000000U  /*!< No error                                   */
+#define HAL_UCPD_ERROR_TX_DISCARDED         0x00000001U  /*!< Tx message discarded or aborted by the PHY */
+#define HAL_UCPD_ERROR_TX_UNDERRUN          0x00000002U  /*!< Tx data underrun                           */
+#define HAL_UCPD_ERROR_TX_NO_GOODCRC        0x00000004U  /*!< No GoodCRC received after all the retries  */
+#define HAL_UCPD_ERROR_RX_OVERRUN           0x00000008U  /*!< Rx data overrun                            */
+#define HAL_UCPD_ERROR_RX                   0x00000010U  /*!< Rx message received with an error          */
+#define HAL_UCPD_ERROR_DMA                  0x00000020U  /*!< DMA transfer error                         */
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/* Exported types ------------------------------------------------------------*/
+/** @defgroup UCPD_Exported_Types UCPD Exported Types
+  * @{
+  */
+
+/**
+  * @brief  UCPD HAL State Structure definition
+  */
+typedef enum
+{
+  HAL_UCPD_STATE_RESET     = 0x00U,  /*!< UCPD not yet initialized or disabled */
+  HAL_UCPD_STATE_READY     = 0x01U,  /*!< UCPD initialized, PD receiver off   */
+  HAL_UCPD_STATE_BUSY      = 0x02U,  /*!< UCPD PD receiver running            */
+  HAL_UCPD_STATE_ERROR     = 0x03U   /*!< UCPD error state                     */
+} HAL_UCPD_StateTypeDef;
+
+/**
+  * @brief  UCPD Init Structure definition
+  */
+typedef struct
+{
+  uint32_t Role;            /*!< Power role of the port presented on the CC lines.
+                                 This parameter can be a value of @ref UCPD_Role */
+
+  uint32_t RpValue;         /*!< Rp current advertised in source role.
+                                 This parameter can be a value of @ref UCPD_LL_EC_RESISTOR */
+
+  uint32_t DataRole;        /*!< Data role reported in the GoodCRC messages.
+                                 This parameter can be a value of @ref UCPD_Data_Role */
+
+  uint32_t SpecRevision;    /*!< Specification revision reported in the GoodCRC messages.
+                                 This parameter can be a value of @ref UCPD_Spec_Revision */
+
+  uint32_t Prescaler;       /*!< Prescaler of the UCPD clock.
+                                 This parameter can be a value of @ref UCPD_LL_EC_PSC */
+
+  uint32_t TransWin;        /*!< Number of half bit clock cycles (minus 1) of the transition window.
+                                 This parameter can be a value between Min_Data=0x1 and Max_Data=0x1F */
+
+  uint32_t IfrGap;          /*!< Number of UCPD clock cycles (minus 1) of the interframe gap.
+                                 This parameter can be a value between Min_Data=0x1 and Max_Data=0x1F */
+
+  uint32_t HbitClockDiv;    /*!< Division (minus 1) of the UCPD clock producing the half bit clock.
+                                 This parameter can be a value between Min_Data=0x0 and Max_Data=0x3F */
+
+  uint32_t RxOrderSet;      /*!< Ordered sets accepted by the receiver.
+                                 This parameter can be a combination of @ref UCPD_LL_EC_ORDERSET */
+
+  uint32_t TxRetryCount;    /*!< Number of retries of a message not acknowledged by a GoodCRC
+                                 (nRetryCount: 3 in revision 2.0, 2 in revision 3.0) */
+} UCPD_InitTypeDef;
+
+/**
+  * @brief  UCPD Handle Structure definition
+  */
+typedef struct
+{
+  UCPD_TypeDef                  *Instance;      /*!< Register base address */
+
+  UCPD_InitTypeDef              Init;           /*!< UCPD required parameters */
+
+  DMA_HandleTypeDef             *hdmatx;        /*!< UCPD Tx DMA handle parameters */
+
+  DMA_HandleTypeDef             *hdmarx;        /*!< UCPD Rx DMA handle parameters */
+
+  uint8_t                       *pTxBuffPtr;    /*!< Pointer to the message being transmitted */
+
+  uint16_t                      TxXferSize;     /*!< Size of the message being transmitted */
+
+  uint32_t                      TxOrderSet;     /*!< Ordered set of the message being transmitted */
+
+  uint8_t                       TxMessageId;    /*!< MessageID expected in the GoodCRC of the message */
+
+  uint8_t                       TxRetry;        /*!< Retries done for the message being transmitted */
+
+  uint32_t                      TxTickstart;    /*!< Tick at which the message has been sent */
+
+  __IO uint32_t                 TxState;        /*!< Transmitter state */
+
+  __IO uint32_t                 GoodCRCPending; /*!< A GoodCRC answer is being transmitted */
+
+  uint8_t                       GoodCRCBuff[2]; /*!< Header of the GoodCRC answer */
+
+  uint8_t                       RxBuff[2][UCPD_RX_BUFFER_SIZE]; /*!< Rx message buffers, used alternately */
+
+  uint8_t                       RxBuffIdx;      /*!< Rx buffer the DMA is filling */
+
+  uint8_t                       RxMessageId[3]; /*!< Last MessageID received on SOP, SOP' and SOP'' */
+
+  uint32_t                      CCPin;          /*!< CC line used for PD communication */
+
+  HAL_LockTypeDef               Lock;           /*!< UCPD locking object */
+
+  __IO HAL_UCPD_StateTypeDef    State;          /*!< UCPD state */
+
+  __IO uint32_t                 ErrorCode;      /*!< UCPD error code
+                                                     This parameter can be a value of @ref UCPD_Error_Code */
+} UCPD_HandleTypeDef;
+
+/**
+  * @}
+  */
+
+/* Exported macros -----------------------------------------------------------*/
+/** @defgroup UCPD_Exported_Macros UCPD Exported Macros
+  * @{
+  */
+
+/** @brief  Reset UCPD handle state.
+  * @param  __HANDLE__ UCPD handle.
+  * @retval None
+  */
+#define __HAL_UCPD_RESET_HANDLE_STATE(__HANDLE__) ((__HANDLE__)->State = HAL_UCPD_STATE_RESET)
+
+/** @brief  Get the MessageID field of a message header.
+  * @param  __HEADER__ 16-bit message header.
+  * @retval MessageID (0 to 7)
+  */
+#define __HAL_UCPD_GET_MESSAGE_ID(__HEADER__) (((uint32_t)(__HEADER__) >> 9U) & 0x7U)
+
+/**
+  * @}
+  */
+
+/* Exported functions --------------------------------------------------------*/
+/** @addtogroup UCPD_Exported_Functions
+  * @{
+  */
+
+/** @addtogroup UCPD_Exported_Functions_Group1
+  * @{
+  */
+/* Initialization and de-initialization functions *****************************/
+HAL_StatusTypeDef HAL_UCPD_Init(UCPD_HandleTypeDef *hucpd);
+HAL_StatusTypeDef HAL_UCPD_DeInit(UCPD_HandleTypeDef *hucpd);
+void              HAL_UCPD_MspInit(UCPD_HandleTypeDef *hucpd);
+void              HAL_UCPD_MspDeInit(UCPD_HandleTypeDef *hucpd);
+/**
+  * @}
+  */
+
+/** @addtogroup UCPD_Exported_Functions_Group2
+  * @{
+  */
+/* IO operation functions *****************************************************/
+HAL_StatusTypeDef HAL_UCPD_Start(UCPD_HandleTypeDef *hucpd, uint32_t CCPin);
+HAL_StatusTypeDef HAL_UCPD_Stop(UCPD_HandleTypeDef *hucpd);
+HAL_StatusTypeDef HAL_UCPD_Transmit_DMA(UCPD_HandleTypeDef *hucpd, uint32_t TxOrderSet,
+                                        uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_UCPD_SendHardReset(UCPD_HandleTypeDef *hucpd);
+void              HAL_UCPD_ResetMessageId(UCPD_HandleTypeDef *hucpd);
+void              HAL_UCPD_CheckTxTimeout(UCPD_HandleTypeDef *hucpd);
+void              HAL_UCPD_IRQHandler(UCPD_HandleTypeDef *hucpd);
+/**
+  * @}
+  */
+
+/** @addtogroup UCPD_Exported_Functions_Group3
+  * @{
+  */
+/* Callback functions *********************************************************/
+void HAL_UCPD_RxMsgCallback(UCPD_HandleTypeDef *hucpd, uint32_t RxOrderSet, uint8_t *pData, uint16_t Size);
+void HAL_UCPD_TxMsgCpltCallback(UCPD_HandleTypeDef *hucpd);
+void HAL_UCPD_TxMsgErrorCallback(UCPD_HandleTypeDef *hucpd);
+void HAL_UCPD_HardResetRxCallback(UCPD_HandleTypeDef *hucpd);
+void HAL_UCPD_HardResetTxCpltCallback(UCPD_HandleTypeDef *hucpd);
+void HAL_UCPD_TypeCEventCallback(UCPD_HandleTypeDef *hucpd, uint32_t CCPin);
+void HAL_UCPD_ErrorCallback(UCPD_HandleTypeDef *hucpd);
+/**
+  * @}
+  */
+
+/** @addtogroup UCPD_Exported_Functions_Group4
+  * @{
+  */
+/* Peripheral State functions *************************************************/
+HAL_UCPD_StateTypeDef HAL_UCPD_GetState(UCPD_HandleTypeDef *hucpd);
+uint32_t              HAL_UCPD_GetError(UCPD_HandleTypeDef *hucpd);
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/* Private macros ------------------------------------------------------------*/
+/** @defgroup UCPD_Private_Macros UCPD Private Macros
+  * @{
+  */
+#define IS_UCPD_ROLE(__ROLE__) (((__ROLE__) == UCPD_ROLE_SINK) || \
+                                ((__ROLE__) == UCPD_ROLE_SOURCE))
+
+#define IS_UCPD_DATA_ROLE(__ROLE__) (((__ROLE__) == UCPD_DATA_ROLE_UFP) || \
+                                     ((__ROLE__) == UCPD_DATA_ROLE_DFP))
+
+#define IS_UCPD_SPEC_REVISION(__REV__) (((__REV__) == UCPD_SPEC_REVISION_2_0) || \
+                                        ((__REV__) == UCPD_SPEC_REVISION_3_0))
+
+#define IS_UCPD_CCPIN(__PIN__) (((__PIN__) == LL_UCPD_CCPIN_CC1) || \
+                                ((__PIN__) == LL_UCPD_CCPIN_CC2))
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#endif /* UCPD1 */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STM32G4xx_HAL_UCPD_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
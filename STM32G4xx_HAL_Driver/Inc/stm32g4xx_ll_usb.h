@@ -122,6 +122,14 @@ typedef struct
 
   uint8_t   xfer_fill_db;     /*!< double buffer Need to Fill new buffer  used with bulk_in                */
 
+  uint8_t   xfer_queued;      /*!< Number of transfers queued with HAL_PCDEx_EP_QueueTransmit/Receive (0 to 2) */
+
+  uint8_t   *xfer_next_buff;  /*!< Buffer of the queued transfer started at the end of the current one      */
+
+  uint32_t  xfer_next_len;    /*!< Length of the queued transfer started at the end of the current one      */
+
+  uint32_t  xfer_last_count;  /*!< Length received by the last completed queued OUT transfer                */
+
 } USB_EPTypeDef;
 
 
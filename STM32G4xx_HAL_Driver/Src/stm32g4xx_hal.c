@@ -47,6 +47,15 @@
 #ifdef HAL_MODULE_ENABLED
 
 /* Private typedef -----------------------------------------------------------*/
+#if (USE_HAL_TRACE == 1U)
+typedef struct
+{
+  uint32_t               Magic;                           /* HAL_TRACE_MAGIC when the ring is valid */
+  __IO uint32_t          Index;                           /* Free running write index */
+  HAL_TraceRecordTypeDef Records[HAL_TRACE_BUFFER_SIZE];  /* Ring of records */
+} HAL_TraceBufferTypeDef;
+#endif /* USE_HAL_TRACE */
+
 /* Private define ------------------------------------------------------------*/
 /**
   * @brief STM32G4xx HAL Driver version number V1.2.0
@@ -78,7 +87,23 @@
 #define CCMER_BitNumber         ((uint8_t)0x0)
 #define SCSR_CCMER_BB           (PERIPH_BB_BASE + (SCSR_OFFSET * 32) + (CCMER_BitNumber * 4))
 
+#if (USE_HAL_TRACE == 1U)
+#define HAL_TRACE_MAGIC           0x54524143U   /* "TRAC" */
+#endif /* USE_HAL_TRACE */
+
 /* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+#if (USE_HAL_TRACE == 1U)
+/* The ring is not initialized at startup so that it survives a reset */
+#if defined ( __ICCARM__ )
+__no_init static HAL_TraceBufferTypeDef HAL_TraceBuffer;
+#elif defined ( __ARMCC_VERSION ) && ( __ARMCC_VERSION >= 6010050 )
+static HAL_TraceBufferTypeDef HAL_TraceBuffer __attribute__((section(".bss.noinit")));
+#else
+static HAL_TraceBufferTypeDef HAL_TraceBuffer __attribute__((section(".noinit")));
+#endif /* __ICCARM__ */
+#endif /* USE_HAL_TRACE */
+
 /* Exported variables ---------------------------------------------------------*/
 /** @defgroup HAL_Exported_Variables HAL Exported Variables
   * @{
@@ -166,6 +191,14 @@ HAL_StatusTypeDef HAL_Init(void)
   __HAL_FLASH_PREFETCH_BUFFER_ENABLE();
 #endif /* PREFETCH_ENABLE */
 
+#if (USE_HAL_TRACE == 1U)
+  /* Keep the records of the previous run, initialize the ring after power-on only */
+  if (HAL_TraceBuffer.Magic != HAL_TRACE_MAGIC)
+  {
+    HAL_TraceReset();
+  }
+#endif /* USE_HAL_TRACE */
+
   /* Set Interrupt Group Priority */
   HAL_NVIC_SetPriorityGrouping(NVIC_PRIORITYGROUP_4);
 
@@ -301,6 +334,7 @@ __weak HAL_StatusTypeDef HAL_InitTick(uint32_t TickPriority)
     [..]  This section provides functions allowing to:
       (+) Provide a tick value in millisecond
       (+) Provide a blocking delay in millisecond
+      (+) Provide a hook called by the blocking HAL functions while waiting
       (+) Suspend the time base source interrupt
       (+) Resume the time base source interrupt
       (+) Get the HAL API driver version
@@ -336,6 +370,29 @@ __weak uint32_t HAL_GetTick(void)
   return uwTick;
 }
 
+/**
+  * @brief Wait hook, called in the polling loops of the blocking HAL functions
+  *        (HAL_Delay, UART, I2C and SPI flag waits, FLASH operations).
+  * @note The default implementation does nothing, the wait is an active polling.
+  *       An application can override it to yield to an RTOS or a scheduler, or
+  *       to execute __WFE() when an interrupt is expected to end the wait.
+  * @note The hook must return quickly compared to the timeout of the caller and
+  *       must not call the HAL function it is called from for the same handle.
+  *       For HAL_WAIT_FLASH, it must not access the FLASH bank being programmed
+  *       or erased.
+  * @note This function is declared as __weak to be overwritten in case of other
+  *       implementations in user file.
+  * @param Reason: wait reason, a value of @ref HAL_WaitReasonTypeDef.
+  * @param Handle: handle of the peripheral waited for, NULL if none.
+  * @retval None
+  */
+__weak void HAL_WaitHook(HAL_WaitReasonTypeDef Reason, const void *Handle)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(Reason);
+  UNUSED(Handle);
+}
+
 /**
   * @brief This function returns a tick priority.
   * @retval tick priority
@@ -410,6 +467,8 @@ __weak void HAL_Delay(uint32_t Delay)
 
   while ((HAL_GetTick() - tickstart) < wait)
   {
+    /* Let the application yield or sleep while waiting */
+    HAL_WaitHook(HAL_WAIT_DELAY, NULL);
   }
 }
 
@@ -758,6 +817,111 @@ void HAL_SYSCFG_CCMSRAM_WriteProtectionEnable(uint32_t Page)
   * @}
   */
 
+#if (USE_HAL_TRACE == 1U)
+/** @defgroup HAL_Exported_Functions_Group5 HAL trace functions
+  *  @brief    HAL trace functions
+  *
+@verbatim
+ ===============================================================================
+                      ##### HAL trace functions #####
+ ===============================================================================
+    [..]  This section provides functions allowing to:
+      (+) Record HAL events (state transitions, errors, timeouts and aborts)
+          in a ring buffer, through the HAL_TRACE() macro used by the drivers
+      (+) Retrieve the records after a reset, the ring buffer being located in
+          a no-init RAM section (".noinit" must be a NOLOAD section of the
+          linker script)
+      (+) Reset the ring buffer once it has been dumped
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Record an event in the trace ring buffer.
+  * @note   The oldest record is overwritten when the ring is full.
+  * @param  Id Identifier of the source, usually the address of the handle
+  * @param  Event Event, value of @ref HAL_TRACE_Event
+  * @param  Arg Event argument
+  * @retval None
+  */
+void HAL_TraceRecord(uint32_t Id, uint32_t Event, uint32_t Arg)
+{
+  HAL_TraceRecordTypeDef *precord;
+  uint32_t primask;
+
+  /* Reserve the slot, the record itself is written outside the critical section */
+  primask = __get_PRIMASK();
+  __disable_irq();
+  precord = &HAL_TraceBuffer.Records[HAL_TraceBuffer.Index & (HAL_TRACE_BUFFER_SIZE - 1U)];
+  HAL_TraceBuffer.Index++;
+  __set_PRIMASK(primask);
+
+  precord->Timestamp = uwTick;
+  precord->Id        = Id;
+  precord->Event     = Event;
+  precord->Arg       = Arg;
+}
+
+/**
+  * @brief  Clear the trace ring buffer.
+  * @retval None
+  */
+void HAL_TraceReset(void)
+{
+  uint32_t index;
+
+  HAL_TraceBuffer.Index = 0U;
+  for (index = 0U; index < HAL_TRACE_BUFFER_SIZE; index++)
+  {
+    HAL_TraceBuffer.Records[index].Timestamp = 0U;
+    HAL_TraceBuffer.Records[index].Id        = 0U;
+    HAL_TraceBuffer.Records[index].Event     = 0U;
+    HAL_TraceBuffer.Records[index].Arg       = 0U;
+  }
+  HAL_TraceBuffer.Magic = HAL_TRACE_MAGIC;
+}
+
+/**
+  * @brief  Copy the trace records, from the oldest to the most recent.
+  * @note   Can be called after a reset, before HAL_TraceReset(), to dump the
+  *         events which led to it.
+  * @param  pRecords Destination buffer
+  * @param  MaxRecords Number of records of pRecords
+  * @retval Number of records copied
+  */
+uint32_t HAL_TraceGetRecords(HAL_TraceRecordTypeDef *pRecords, uint32_t MaxRecords)
+{
+  uint32_t index = HAL_TraceBuffer.Index;
+  uint32_t count;
+  uint32_t first;
+  uint32_t i;
+
+  if ((pRecords == NULL) || (HAL_TraceBuffer.Magic != HAL_TRACE_MAGIC))
+  {
+    return 0U;
+  }
+
+  count = (index < HAL_TRACE_BUFFER_SIZE) ? index : HAL_TRACE_BUFFER_SIZE;
+  if (count > MaxRecords)
+  {
+    count = MaxRecords;
+  }
+  first = index - count;
+
+  for (i = 0U; i < count; i++)
+  {
+    pRecords[i] = HAL_TraceBuffer.Records[(first + i) & (HAL_TRACE_BUFFER_SIZE - 1U)];
+  }
+
+  return count;
+}
+
+/**
+  * @}
+  */
+#endif /* USE_HAL_TRACE */
+
 /**
   * @}
   */
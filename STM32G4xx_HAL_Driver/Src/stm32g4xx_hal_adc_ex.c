@@ -16,6 +16,8 @@
   *             ++ Channels configuration on ADC group injected
   *           + State functions
   *             ++ ADC group injected contexts queue management
+  *           + Scope capture functions
+  *             ++ Analog watchdog triggered capture with pre-trigger samples
   *          Other functions (generic functions) are available in file
   *          "stm32g4xx_hal_adc.c".
   *
@@ -81,6 +83,9 @@
 /*                      = 81 / (f_CPU/3938) = 318978 CPU cycles               */
 #define ADC_CALIBRATION_TIMEOUT         (318978UL)   /*!< ADC calibration time-out value (unit: CPU cycles) */
 
+/* Number of samples searched back for the trigger sample, converted during the analog watchdog interrupt latency */
+#define ADC_SCOPE_TRIGGER_SEARCH        (16UL)
+
 /**
   * @}
   */
@@ -88,6 +93,15 @@
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
+/** @defgroup ADCEx_Private_Functions ADC Extended Private Functions
+  * @{
+  */
+static uint32_t ADC_Scope_GetPosition(const ADCEx_ScopeTypeDef *pScope);
+static void ADC_Scope_Update(ADCEx_ScopeTypeDef *pScope);
+/**
+  * @}
+  */
+
 /* Exported functions --------------------------------------------------------*/
 
 /** @defgroup ADCEx_Exported_Functions ADC Extended Exported Functions
@@ -2329,6 +2343,333 @@ HAL_StatusTypeDef HAL_ADCEx_EnterADCDeepPowerDownMode(ADC_HandleTypeDef *hadc)
   * @}
   */
 
+/** @defgroup ADCEx_Exported_Functions_Group3 ADC Extended scope capture functions
+  * @brief    ADC Extended scope capture functions
+  *
+@verbatim
+ ===============================================================================
+                 ##### Scope capture functions #####
+ ===============================================================================
+    [..]  This section provides functions allowing to:
+      (+) Run the conversions continuously to a circular DMA buffer and stop
+          them a given number of samples after an analog watchdog 1 event.
+      (+) Get the pre-trigger and post-trigger samples in place.
+
+  [..] How to use the scope capture
+    (#) Initialize the ADC so that it converts one channel with
+        DMAContinuousRequests enabled, to a circular halfword DMA buffer.
+    (#) Fill an ADCEx_ScopeTypeDef structure and call HAL_ADCEx_Scope_Start():
+        the analog watchdog 1 is configured on the channel with the high and
+        low thresholds of the structure, then the conversions are started with
+        HAL_ADC_Start_DMA().
+    (#) Call HAL_ADCEx_Scope_TriggerHandler() from
+        HAL_ADC_LevelOutOfWindowCallback(), and HAL_ADCEx_Scope_ConvHandler()
+        from HAL_ADC_ConvHalfCpltCallback() and HAL_ADC_ConvCpltCallback().
+    (#) On the first sample out of the window, the trigger position is taken
+        from the DMA counter and the analog watchdog interrupt is disabled.
+        The conversions are stopped on the first half or full buffer event
+        after PostTrigger samples, then HAL_ADCEx_ScopeCpltCallback() is
+        called.
+    (#) Call HAL_ADCEx_Scope_GetWindow() to get the PreTrigger + PostTrigger
+        samples of the window, read in place in the DMA buffer as at most
+        two contiguous parts.
+    (#) Call HAL_ADCEx_Scope_Stop() to abort a capture.
+
+    [..]
+      The conversions stop up to half a buffer after the end of the window,
+      so PreTrigger + PostTrigger must not exceed BufferLength / 2. The state
+      is ADC_SCOPE_STATE_ERROR when the pre-trigger samples were overwritten
+      anyway, for instance because of a long interrupt latency.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Start the conversions of a scope capture, armed on the analog
+  *         watchdog 1.
+  * @note   The ADC conversions must not be ongoing.
+  * @param  pScope scope capture structure
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ADCEx_Scope_Start(ADCEx_ScopeTypeDef *pScope)
+{
+  ADC_AnalogWDGConfTypeDef awdconfig = {0};
+
+  /* Check the structure allocation */
+  if ((pScope == NULL) || (pScope->hadc == NULL) || (pScope->pBuffer == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the parameters */
+  assert_param(IS_ADC_ALL_INSTANCE(pScope->hadc->Instance));
+
+  if ((pScope->State == ADC_SCOPE_STATE_ARMED)
+      || (pScope->State == ADC_SCOPE_STATE_TRIGGERED)
+      || (pScope->hadc->DMA_Handle == NULL)
+      || (pScope->hadc->DMA_Handle->Init.Mode != DMA_CIRCULAR)
+      || (pScope->BufferLength < 2UL)
+      || ((pScope->BufferLength & 1UL) != 0UL)
+      || (pScope->PostTrigger == 0UL)
+      || ((pScope->PreTrigger + pScope->PostTrigger) > (pScope->BufferLength / 2UL))
+      || (pScope->LowThreshold > pScope->HighThreshold))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Analog watchdog 1 monitoring the captured channel */
+  awdconfig.WatchdogNumber = ADC_ANALOGWATCHDOG_1;
+  awdconfig.WatchdogMode = ADC_ANALOGWATCHDOG_SINGLE_REG;
+  awdconfig.Channel = pScope->Channel;
+  awdconfig.ITMode = ENABLE;
+  awdconfig.HighThreshold = pScope->HighThreshold;
+  awdconfig.LowThreshold = pScope->LowThreshold;
+  awdconfig.FilteringConfig = ADC_AWD_FILTERING_NONE;
+
+  if (HAL_ADC_AnalogWDGConfig(pScope->hadc, &awdconfig) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  pScope->TriggerPosition = 0UL;
+  pScope->Elapsed = 0UL;
+  pScope->LastPosition = 0UL;
+  pScope->State = ADC_SCOPE_STATE_ARMED;
+
+  if (HAL_ADC_Start_DMA(pScope->hadc, (uint32_t *)pScope->pBuffer, pScope->BufferLength) != HAL_OK)
+  {
+    __HAL_ADC_DISABLE_IT(pScope->hadc, ADC_IT_AWD1);
+    pScope->State = ADC_SCOPE_STATE_RESET;
+    return HAL_ERROR;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Abort a scope capture.
+  * @param  pScope scope capture structure
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ADCEx_Scope_Stop(ADCEx_ScopeTypeDef *pScope)
+{
+  /* Check the structure allocation */
+  if ((pScope == NULL) || (pScope->hadc == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  __HAL_ADC_DISABLE_IT(pScope->hadc, ADC_IT_AWD1);
+  __HAL_ADC_CLEAR_FLAG(pScope->hadc, ADC_FLAG_AWD1);
+
+  if ((pScope->State == ADC_SCOPE_STATE_ARMED) || (pScope->State == ADC_SCOPE_STATE_TRIGGERED))
+  {
+    pScope->State = ADC_SCOPE_STATE_RESET;
+    return HAL_ADC_Stop_DMA(pScope->hadc);
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Get the samples of a completed scope capture.
+  * @note   The samples are left in the DMA buffer, they are valid until the
+  *         next call to HAL_ADCEx_Scope_Start().
+  * @param  pScope scope capture structure
+  * @param  pWindow window of PreTrigger + PostTrigger samples
+  * @retval HAL status, HAL_BUSY while the capture is running
+  */
+HAL_StatusTypeDef HAL_ADCEx_Scope_GetWindow(const ADCEx_ScopeTypeDef *pScope, ADCEx_ScopeWindowTypeDef *pWindow)
+{
+  uint32_t start;
+  uint32_t length;
+
+  /* Check the structure allocation */
+  if ((pScope == NULL) || (pWindow == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  if ((pScope->State == ADC_SCOPE_STATE_ARMED) || (pScope->State == ADC_SCOPE_STATE_TRIGGERED))
+  {
+    return HAL_BUSY;
+  }
+
+  if (pScope->State != ADC_SCOPE_STATE_DONE)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Oldest sample of the window, split at the end of the DMA buffer */
+  start = (pScope->TriggerPosition + pScope->BufferLength - pScope->PreTrigger) % pScope->BufferLength;
+  length = pScope->PreTrigger + pScope->PostTrigger;
+
+  pWindow->pFirst = &pScope->pBuffer[start];
+  pWindow->FirstLength = ((start + length) > pScope->BufferLength) ? (pScope->BufferLength - start) : length;
+  pWindow->pSecond = pScope->pBuffer;
+  pWindow->SecondLength = length - pWindow->FirstLength;
+  pWindow->TriggerOffset = pScope->PreTrigger;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Mark the trigger position of a scope capture after an analog
+  *         watchdog 1 event.
+  * @note   To be called from HAL_ADC_LevelOutOfWindowCallback(). The trigger
+  *         sample is searched back in the DMA buffer from the last converted
+  *         sample, so that the interrupt latency does not shift it.
+  * @param  pScope scope capture structure
+  * @retval None
+  */
+void HAL_ADCEx_Scope_TriggerHandler(ADCEx_ScopeTypeDef *pScope)
+{
+  uint32_t position;
+  uint32_t index;
+  uint32_t trigger;
+  uint32_t count;
+  uint32_t sample;
+  uint32_t found = 0UL;
+
+  if (pScope->State != ADC_SCOPE_STATE_ARMED)
+  {
+    return;
+  }
+
+  /* One trigger per capture */
+  __HAL_ADC_DISABLE_IT(pScope->hadc, ADC_IT_AWD1);
+
+  /* Index of the next sample written by the DMA */
+  position = ADC_Scope_GetPosition(pScope);
+  trigger = (position + pScope->BufferLength - 1UL) % pScope->BufferLength;
+
+  /* Oldest sample out of the window among the last ones, stopping at the samples before the crossing */
+  for (count = 0UL; count < ADC_SCOPE_TRIGGER_SEARCH; count++)
+  {
+    index = (position + pScope->BufferLength - 1UL - count) % pScope->BufferLength;
+    sample = pScope->pBuffer[index];
+
+    if ((sample > pScope->HighThreshold) || (sample < pScope->LowThreshold))
+    {
+      trigger = index;
+      found = 1UL;
+    }
+    else if (found != 0UL)
+    {
+      break;
+    }
+    else
+    {
+      /* Sample back in the window after the trigger */
+    }
+  }
+
+  pScope->TriggerPosition = trigger;
+  pScope->Elapsed = (position + pScope->BufferLength - trigger) % pScope->BufferLength;
+  pScope->LastPosition = position;
+  pScope->State = ADC_SCOPE_STATE_TRIGGERED;
+
+  ADC_Scope_Update(pScope);
+}
+
+/**
+  * @brief  Count the post-trigger samples of a scope capture and stop the
+  *         conversions once they are all converted.
+  * @note   To be called from HAL_ADC_ConvHalfCpltCallback() and
+  *         HAL_ADC_ConvCpltCallback().
+  * @param  pScope scope capture structure
+  * @retval None
+  */
+void HAL_ADCEx_Scope_ConvHandler(ADCEx_ScopeTypeDef *pScope)
+{
+  if (pScope->State == ADC_SCOPE_STATE_TRIGGERED)
+  {
+    ADC_Scope_Update(pScope);
+  }
+}
+
+/**
+  * @brief  Scope capture complete callback.
+  * @note   Called when the conversions are stopped after the post-trigger
+  *         samples, the state being ADC_SCOPE_STATE_DONE or
+  *         ADC_SCOPE_STATE_ERROR.
+  * @param  pScope scope capture structure
+  * @retval None
+  */
+__weak void HAL_ADCEx_ScopeCpltCallback(ADCEx_ScopeTypeDef *pScope)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(pScope);
+
+  /* NOTE : This function should not be modified. When the callback is needed,
+            function HAL_ADCEx_ScopeCpltCallback must be implemented in the user file.
+  */
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/** @addtogroup ADCEx_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Get the index in the DMA buffer of the next sample of a scope
+  *         capture.
+  * @param  pScope scope capture structure
+  * @retval Index in pBuffer
+  */
+static uint32_t ADC_Scope_GetPosition(const ADCEx_ScopeTypeDef *pScope)
+{
+  return (pScope->BufferLength - __HAL_DMA_GET_COUNTER(pScope->hadc->DMA_Handle)) % pScope->BufferLength;
+}
+
+/**
+  * @brief  Update the post-trigger sample count of a scope capture, and stop
+  *         the conversions when it is reached.
+  * @note   Called at least twice per buffer, so that less than one buffer is
+  *         converted between two updates.
+  * @param  pScope scope capture structure
+  * @retval None
+  */
+static void ADC_Scope_Update(ADCEx_ScopeTypeDef *pScope)
+{
+  uint32_t position = ADC_Scope_GetPosition(pScope);
+
+  pScope->Elapsed += (position + pScope->BufferLength - pScope->LastPosition) % pScope->BufferLength;
+  pScope->LastPosition = position;
+
+  if (pScope->Elapsed < pScope->PostTrigger)
+  {
+    return;
+  }
+
+  (void)HAL_ADC_Stop_DMA(pScope->hadc);
+
+  /* Samples converted while stopping */
+  position = ADC_Scope_GetPosition(pScope);
+  pScope->Elapsed += (position + pScope->BufferLength - pScope->LastPosition) % pScope->BufferLength;
+  pScope->LastPosition = position;
+
+  /* The oldest samples of the window are overwritten when more than a buffer was converted */
+  if ((pScope->PreTrigger + pScope->Elapsed) > pScope->BufferLength)
+  {
+    pScope->State = ADC_SCOPE_STATE_ERROR;
+  }
+  else
+  {
+    pScope->State = ADC_SCOPE_STATE_DONE;
+  }
+
+  HAL_ADCEx_ScopeCpltCallback(pScope);
+}
+
 /**
   * @}
   */
@@ -71,6 +71,18 @@
               i.e. the data transfer is ensured by DMA
               API is HAL_CORDIC_Calculate_DMA
 
+      (#) Programs chain calculations with different functions, for instance sine/cosine
+          then phase/modulus then square root:
+         (++) Describe each step with HAL_CORDIC_StepInit(): configuration, input and output
+              buffers and number of calculations. Steps are prepared once, the CORDIC control
+              register value is precomputed.
+         (++) Run the steps back-to-back in Zero-Overhead mode with HAL_CORDIC_CalculateProgramZO(),
+              or in DMA mode with HAL_CORDIC_CalculateProgram_DMA(). The control register is
+              written only when the configuration of a step differs from the previous one.
+         (++) For one or two calculations, the inline functions HAL_CORDIC_CalculateOneZO() and
+              HAL_CORDIC_CalculateTwoZO() take a control register value built at compile time
+              with __HAL_CORDIC_CONFIG_CSR().
+
       (#) Call HAL_CORDIC_DeInit() to de-initialize the CORDIC peripheral. This function
          (++) resorts to HAL_CORDIC_MspDeInit() for low-level de-initialization,
 
@@ -165,6 +177,8 @@ static void CORDIC_ReadOutDataIncrementPtr(CORDIC_HandleTypeDef *hcordic, int32_
 static void CORDIC_DMAInCplt(DMA_HandleTypeDef *hdma);
 static void CORDIC_DMAOutCplt(DMA_HandleTypeDef *hdma);
 static void CORDIC_DMAError(DMA_HandleTypeDef *hdma);
+static HAL_StatusTypeDef CORDIC_ProgramStepStart_DMA(CORDIC_HandleTypeDef *hcordic);
+static void CORDIC_DMAProgramOutCplt(DMA_HandleTypeDef *hdma);
 /**
   * @}
   */
@@ -254,6 +268,10 @@ HAL_StatusTypeDef HAL_CORDIC_Init(CORDIC_HandleTypeDef *hcordic)
   /* Reset DMADirection */
   hcordic->DMADirection = CORDIC_DMA_DIR_NONE;
 
+  /* Reset program */
+  hcordic->pStep = NULL;
+  hcordic->NbStepsLeft = 0U;
+
   /* Change CORDIC peripheral state */
   hcordic->State = HAL_CORDIC_STATE_READY;
 
@@ -1021,6 +1039,234 @@ HAL_StatusTypeDef HAL_CORDIC_Calculate_DMA(CORDIC_HandleTypeDef *hcordic, int32_
   }
 }
 
+/**
+  * @brief  Initialize a CORDIC program step.
+  * @param  pStep pointer to the CORDIC_StepTypeDef structure to initialize.
+  * @param  sConfig pointer to a CORDIC_ConfigTypeDef structure that
+  *         contains the CORDIC configuration of the step.
+  * @param  pInBuff Pointer to buffer containing input data of the step.
+  * @param  pOutBuff Pointer to buffer where output data of the step will be stored.
+  * @param  NbCalc Number of CORDIC calculation of the step.
+  * @retval None
+  */
+void HAL_CORDIC_StepInit(CORDIC_StepTypeDef *pStep, const CORDIC_ConfigTypeDef *sConfig, const int32_t *pInBuff, int32_t *pOutBuff, uint32_t NbCalc)
+{
+  /* Check the parameters */
+  assert_param(IS_CORDIC_FUNCTION(sConfig->Function));
+  assert_param(IS_CORDIC_PRECISION(sConfig->Precision));
+  assert_param(IS_CORDIC_SCALE(sConfig->Scale));
+  assert_param(IS_CORDIC_NBWRITE(sConfig->NbWrite));
+  assert_param(IS_CORDIC_NBREAD(sConfig->NbRead));
+  assert_param(IS_CORDIC_INSIZE(sConfig->InSize));
+  assert_param(IS_CORDIC_OUTSIZE(sConfig->OutSize));
+
+  pStep->CSR = __HAL_CORDIC_CONFIG_CSR(sConfig->Function, sConfig->Precision, sConfig->Scale, sConfig->NbWrite,
+                                       sConfig->NbRead, sConfig->InSize, sConfig->OutSize);
+  pStep->pInBuff = pInBuff;
+  pStep->pOutBuff = pOutBuff;
+  pStep->NbCalc = NbCalc;
+}
+
+/**
+  * @brief  Carry out a CORDIC program in Zero-Overhead mode: the steps are processed
+  *         back-to-back, each one with its own configuration.
+  * @note   The CORDIC control register is written only when the configuration of a
+  *         step differs from the current one.
+  * @note   In Zero-Overhead mode the result read is stalled until the calculation is
+  *         done, the processing time is bounded and no timeout is used.
+  * @param  hcordic pointer to a CORDIC_HandleTypeDef structure that contains
+  *         the configuration information for CORDIC module.
+  * @param  pSteps Pointer to the program steps.
+  * @param  NbSteps Number of program steps.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_CORDIC_CalculateProgramZO(CORDIC_HandleTypeDef *hcordic, const CORDIC_StepTypeDef *pSteps, uint32_t NbSteps)
+{
+  const CORDIC_StepTypeDef *p_step;
+  const int32_t *p_tmp_in_buff;
+  int32_t *p_tmp_out_buff;
+  uint32_t csr;
+  uint32_t step;
+  uint32_t index;
+
+  /* Check parameters setting */
+  if ((pSteps == NULL) || (NbSteps == 0U))
+  {
+    /* Update the error code */
+    hcordic->ErrorCode |= HAL_CORDIC_ERROR_PARAM;
+
+    /* Return error status */
+    return HAL_ERROR;
+  }
+
+  for (step = 0U; step < NbSteps; step++)
+  {
+    if ((pSteps[step].NbCalc == 0U) || (pSteps[step].pInBuff == NULL) || (pSteps[step].pOutBuff == NULL))
+    {
+      /* Update the error code */
+      hcordic->ErrorCode |= HAL_CORDIC_ERROR_PARAM;
+
+      /* Return error status */
+      return HAL_ERROR;
+    }
+  }
+
+  /* Check handle state is ready */
+  if (hcordic->State == HAL_CORDIC_STATE_READY)
+  {
+    /* Reset CORDIC error code */
+    hcordic->ErrorCode = HAL_CORDIC_ERROR_NONE;
+
+    /* Change the CORDIC state */
+    hcordic->State = HAL_CORDIC_STATE_BUSY;
+
+    csr = READ_REG(hcordic->Instance->CSR) & CORDIC_CSR_CONFIG_MASK;
+
+    for (step = 0U; step < NbSteps; step++)
+    {
+      p_step = &pSteps[step];
+
+      /* Mode switching only when the configuration changes */
+      if (p_step->CSR != csr)
+      {
+        csr = p_step->CSR;
+        WRITE_REG(hcordic->Instance->CSR, csr);
+      }
+
+      p_tmp_in_buff = p_step->pInBuff;
+      p_tmp_out_buff = p_step->pOutBuff;
+
+      /* Write of the first input data, the calculation is started */
+      WRITE_REG(hcordic->Instance->WDATA, (uint32_t)*p_tmp_in_buff);
+      p_tmp_in_buff++;
+      if ((csr & CORDIC_CSR_NARGS) != 0U)
+      {
+        WRITE_REG(hcordic->Instance->WDATA, (uint32_t)*p_tmp_in_buff);
+        p_tmp_in_buff++;
+      }
+
+      for (index = (p_step->NbCalc - 1U); index > 0U; index--)
+      {
+        /* Provide the next input data while the current calculation is in progress */
+        WRITE_REG(hcordic->Instance->WDATA, (uint32_t)*p_tmp_in_buff);
+        p_tmp_in_buff++;
+        if ((csr & CORDIC_CSR_NARGS) != 0U)
+        {
+          WRITE_REG(hcordic->Instance->WDATA, (uint32_t)*p_tmp_in_buff);
+          p_tmp_in_buff++;
+        }
+
+        /* Zero-Overhead read of the current result */
+        *p_tmp_out_buff = (int32_t)READ_REG(hcordic->Instance->RDATA);
+        p_tmp_out_buff++;
+        if ((csr & CORDIC_CSR_NRES) != 0U)
+        {
+          *p_tmp_out_buff = (int32_t)READ_REG(hcordic->Instance->RDATA);
+          p_tmp_out_buff++;
+        }
+      }
+
+      /* Read of the last result, before any configuration change */
+      *p_tmp_out_buff = (int32_t)READ_REG(hcordic->Instance->RDATA);
+      p_tmp_out_buff++;
+      if ((csr & CORDIC_CSR_NRES) != 0U)
+      {
+        *p_tmp_out_buff = (int32_t)READ_REG(hcordic->Instance->RDATA);
+      }
+    }
+
+    /* Change the CORDIC state */
+    hcordic->State = HAL_CORDIC_STATE_READY;
+
+    /* Return function status */
+    return HAL_OK;
+  }
+  else
+  {
+    /* Set CORDIC error code */
+    hcordic->ErrorCode |= HAL_CORDIC_ERROR_NOT_READY;
+
+    /* Return function status */
+    return HAL_ERROR;
+  }
+}
+
+/**
+  * @brief  Carry out a CORDIC program in DMA mode: the steps are processed back-to-back,
+  *         each one with its own configuration, the input and output data of each step
+  *         being transferred by DMA.
+  * @note   The next step is started from the output DMA transfer complete interrupt.
+  *         The CORDIC control register is written only when the configuration of a
+  *         step differs from the previous one.
+  * @note   HAL_CORDIC_CalculateCpltCallback() is called at the end of the last step.
+  * @note   The steps, input and output buffers must be kept until the end of the program.
+  *         The buffers must be 32-bit aligned.
+  * @param  hcordic pointer to a CORDIC_HandleTypeDef structure that contains
+  *         the configuration information for CORDIC module.
+  * @param  pSteps Pointer to the program steps.
+  * @param  NbSteps Number of program steps.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_CORDIC_CalculateProgram_DMA(CORDIC_HandleTypeDef *hcordic, const CORDIC_StepTypeDef *pSteps, uint32_t NbSteps)
+{
+  uint32_t step;
+
+  /* Check parameters setting */
+  if ((pSteps == NULL) || (NbSteps == 0U) || (hcordic->hdmaIn == NULL) || (hcordic->hdmaOut == NULL))
+  {
+    /* Update the error code */
+    hcordic->ErrorCode |= HAL_CORDIC_ERROR_PARAM;
+
+    /* Return error status */
+    return HAL_ERROR;
+  }
+
+  for (step = 0U; step < NbSteps; step++)
+  {
+    if ((pSteps[step].NbCalc == 0U) || (pSteps[step].pInBuff == NULL) || (pSteps[step].pOutBuff == NULL))
+    {
+      /* Update the error code */
+      hcordic->ErrorCode |= HAL_CORDIC_ERROR_PARAM;
+
+      /* Return error status */
+      return HAL_ERROR;
+    }
+  }
+
+  if (hcordic->State == HAL_CORDIC_STATE_READY)
+  {
+    /* Reset CORDIC error code */
+    hcordic->ErrorCode = HAL_CORDIC_ERROR_NONE;
+
+    /* Change the CORDIC state */
+    hcordic->State = HAL_CORDIC_STATE_BUSY;
+
+    /* Both directions are transferred by DMA */
+    hcordic->DMADirection = CORDIC_DMA_DIR_IN_OUT;
+
+    /* Set the CORDIC DMA transfer complete callbacks */
+    hcordic->hdmaIn->XferCpltCallback = CORDIC_DMAInCplt;
+    hcordic->hdmaOut->XferCpltCallback = CORDIC_DMAProgramOutCplt;
+    /* Set the DMA error callbacks */
+    hcordic->hdmaIn->XferErrorCallback = CORDIC_DMAError;
+    hcordic->hdmaOut->XferErrorCallback = CORDIC_DMAError;
+
+    hcordic->pStep = pSteps;
+    hcordic->NbStepsLeft = NbSteps - 1U;
+
+    /* Start the first step */
+    return CORDIC_ProgramStepStart_DMA(hcordic);
+  }
+  else
+  {
+    /* Set CORDIC error code */
+    hcordic->ErrorCode |= HAL_CORDIC_ERROR_NOT_READY;
+
+    /* Return function status */
+    return HAL_ERROR;
+  }
+}
+
 /**
   * @}
   */
@@ -1309,6 +1555,121 @@ static void CORDIC_DMAOutCplt(DMA_HandleTypeDef *hdma)
 #endif /* USE_HAL_CORDIC_REGISTER_CALLBACKS */
 }
 
+/**
+  * @brief  Start the DMA transfers of the current CORDIC program step.
+  * @param  hcordic pointer to a CORDIC_HandleTypeDef structure that contains
+  *         the configuration information for CORDIC module.
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef CORDIC_ProgramStepStart_DMA(CORDIC_HandleTypeDef *hcordic)
+{
+  const CORDIC_StepTypeDef *p_step = hcordic->pStep;
+  uint32_t sizeinbuff = p_step->NbCalc;
+  uint32_t sizeoutbuff = p_step->NbCalc;
+
+  /* Mode switching only when the configuration changes, DMA requests are disabled */
+  if ((READ_REG(hcordic->Instance->CSR) & CORDIC_CSR_CONFIG_MASK) != p_step->CSR)
+  {
+    WRITE_REG(hcordic->Instance->CSR, p_step->CSR);
+  }
+
+  /* Retrieve the size of the data buffers */
+  if ((p_step->CSR & CORDIC_CSR_NARGS) != 0U)
+  {
+    sizeinbuff = 2U * p_step->NbCalc;
+  }
+  if ((p_step->CSR & CORDIC_CSR_NRES) != 0U)
+  {
+    sizeoutbuff = 2U * p_step->NbCalc;
+  }
+
+  /* Enable the DMA stream managing CORDIC output data read */
+  if (HAL_DMA_Start_IT(hcordic->hdmaOut, (uint32_t)&hcordic->Instance->RDATA, (uint32_t)p_step->pOutBuff,
+                       sizeoutbuff) != HAL_OK)
+  {
+    /* Update the error code */
+    hcordic->ErrorCode |= HAL_CORDIC_ERROR_DMA;
+
+    /* Change the CORDIC state */
+    hcordic->State = HAL_CORDIC_STATE_READY;
+
+    /* Return error status */
+    return HAL_ERROR;
+  }
+
+  /* Enable the DMA stream managing CORDIC input data write */
+  if (HAL_DMA_Start_IT(hcordic->hdmaIn, (uint32_t)p_step->pInBuff, (uint32_t)&hcordic->Instance->WDATA,
+                       sizeinbuff) != HAL_OK)
+  {
+    (void)HAL_DMA_Abort(hcordic->hdmaOut);
+
+    /* Update the error code */
+    hcordic->ErrorCode |= HAL_CORDIC_ERROR_DMA;
+
+    /* Change the CORDIC state */
+    hcordic->State = HAL_CORDIC_STATE_READY;
+
+    /* Return error status */
+    return HAL_ERROR;
+  }
+
+  /* Enable output data Read and input data Write DMA requests */
+  SET_BIT(hcordic->Instance->CSR, CORDIC_DMA_REN | CORDIC_DMA_WEN);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  DMA CORDIC Output Data process complete callback of a program step.
+  * @param  hdma DMA handle.
+  * @retval None
+  */
+static void CORDIC_DMAProgramOutCplt(DMA_HandleTypeDef *hdma)
+{
+  CORDIC_HandleTypeDef *hcordic = (CORDIC_HandleTypeDef *)((DMA_HandleTypeDef *)hdma)->Parent;
+
+  /* Disable the DMA transfer for output request */
+  CLEAR_BIT(hcordic->Instance->CSR, CORDIC_DMA_REN);
+
+  /* Start the next step */
+  if (hcordic->NbStepsLeft > 0U)
+  {
+    hcordic->NbStepsLeft--;
+    hcordic->pStep++;
+
+    if (CORDIC_ProgramStepStart_DMA(hcordic) != HAL_OK)
+    {
+      /* Call user callback */
+#if USE_HAL_CORDIC_REGISTER_CALLBACKS == 1
+      /*Call registered callback*/
+      hcordic->ErrorCallback(hcordic);
+#else
+      /*Call legacy weak (surcharged) callback*/
+      HAL_CORDIC_ErrorCallback(hcordic);
+#endif /* USE_HAL_CORDIC_REGISTER_CALLBACKS */
+    }
+    return;
+  }
+
+  /* End of the program */
+  hcordic->pStep = NULL;
+
+  /* Change the CORDIC DMA direction to none */
+  hcordic->DMADirection = CORDIC_DMA_DIR_NONE;
+
+  /* Change the CORDIC state to ready */
+  hcordic->State = HAL_CORDIC_STATE_READY;
+
+  /* Call calculation complete callback */
+#if USE_HAL_CORDIC_REGISTER_CALLBACKS == 1
+  /*Call registered callback*/
+  hcordic->CalculateCpltCallback(hcordic);
+#else
+  /*Call legacy weak (surcharged) callback*/
+  HAL_CORDIC_CalculateCpltCallback(hcordic);
+#endif /* USE_HAL_CORDIC_REGISTER_CALLBACKS */
+}
+
 /**
   * @brief  DMA CORDIC communication error callback.
   * @param  hdma DMA handle.
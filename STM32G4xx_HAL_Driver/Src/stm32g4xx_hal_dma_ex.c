@@ -18,6 +18,11 @@
    (+) Configure the DMA_MUX Request Generator Block using HAL_DMAEx_ConfigMuxRequestGenerator function.
        Functions HAL_DMAEx_EnableMuxRequestGenerator and HAL_DMAEx_DisableMuxRequestGenerator can then be used
        to respectively enable/disable the request generator.
+   (+) Chain several DMA channels in a hardware trigger sequence using HAL_DMAEx_ConfigMuxChain function:
+       the first stage is paced by an EXTI line, a LPTIM output or its own peripheral request (e.g. a
+       timer update request), each following stage is triggered by the DMAMUX event of the previous one.
+       Functions HAL_DMAEx_StartMuxChain and HAL_DMAEx_StopMuxChain can then be used to respectively
+       start/stop the whole chain.
 
    (+) To handle the DMAMUX Interrupts, the function  HAL_DMAEx_MUX_IRQHandler should be called from
        the DMAMUX IRQ handler i.e DMAMUX1_OVR_IRQHandler.
@@ -56,10 +61,26 @@
 
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
+/** @defgroup DMAEx_Private_Constants DMAEx Private Constants
+  * @{
+  */
+#define DMAMUX_EVT_CHANNEL_NB   4U   /* DMAMUX channels having their event output routed as trigger signal */
+/**
+  * @}
+  */
+
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 /* Private Constants ---------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
+/** @defgroup DMAEx_Private_Functions DMAEx Private Functions
+  * @{
+  */
+static uint32_t DMAEx_GetMuxChannelIndex(DMA_HandleTypeDef *hdma);
+/**
+  * @}
+  */
+
 /* Private functions ---------------------------------------------------------*/
 
 
@@ -80,6 +101,8 @@
     (+) Configure the DMAMUX Request Generator Block using HAL_DMAEx_ConfigMuxRequestGenerator function.
        Functions HAL_DMAEx_EnableMuxRequestGenerator and HAL_DMAEx_DisableMuxRequestGenerator can then be used
        to respectively enable/disable the request generator.
+    (+) Configure, start and stop a DMAMUX trigger chain using HAL_DMAEx_ConfigMuxChain,
+        HAL_DMAEx_StartMuxChain and HAL_DMAEx_StopMuxChain functions.
 
 @endverbatim
   * @{
@@ -229,6 +252,195 @@ HAL_StatusTypeDef HAL_DMAEx_DisableMuxRequestGenerator(DMA_HandleTypeDef *hdma)
   }
 }
 
+/**
+  * @brief  Configure a DMAMUX trigger chain.
+  * @note   The first stage is triggered by pChain->TriggerSignalID, through its request generator when
+  *         its channel uses one (Init.Request = DMA_REQUEST_GENERATOR0..3), or by synchronizing its
+  *         peripheral request otherwise. Each following stage is triggered in the same way by the DMAMUX
+  *         event generated by the previous stage once its BurstLength requests have been served.
+  * @note   Only DMAMUX channels 0 to 3 provide an event usable as trigger: every stage but the last one
+  *         must run on a DMA channel connected to one of them.
+  * @note   All the stage handles must be in ready state.
+  * @param  pChain : pointer to HAL_DMA_MuxChainTypeDef : contains the chain parameters
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DMAEx_ConfigMuxChain(HAL_DMA_MuxChainTypeDef *pChain)
+{
+  DMA_HandleTypeDef *hdma;
+  uint32_t stage;
+  uint32_t signal_id;
+  uint32_t polarity;
+  uint32_t ccr;
+
+  /* Check the chain parameters */
+  if ((pChain == NULL) || (pChain->pStages == NULL) || (pChain->NbStages == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  assert_param(IS_DMAMUX_REQUEST_GEN_SIGNAL_ID(pChain->TriggerSignalID));
+  assert_param(IS_DMAMUX_REQUEST_GEN_POLARITY(pChain->TriggerPolarity));
+
+  /* Check the stages before changing any configuration */
+  for (stage = 0U; stage < pChain->NbStages; stage++)
+  {
+    hdma = pChain->pStages[stage].hdma;
+
+    assert_param(IS_DMAMUX_CHAIN_BURST_LENGTH(pChain->pStages[stage].BurstLength));
+
+    if ((hdma == NULL) || (hdma->State != HAL_DMA_STATE_READY))
+    {
+      return HAL_ERROR;
+    }
+
+    /* A stage triggering the next one must own a DMAMUX event output */
+    if ((stage < (pChain->NbStages - 1U)) && (DMAEx_GetMuxChannelIndex(hdma) >= DMAMUX_EVT_CHANNEL_NB))
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  for (stage = 0U; stage < pChain->NbStages; stage++)
+  {
+    hdma = pChain->pStages[stage].hdma;
+
+    if (stage == 0U)
+    {
+      signal_id = pChain->TriggerSignalID;
+      polarity  = pChain->TriggerPolarity;
+    }
+    else
+    {
+      signal_id = HAL_DMAMUX1_REQ_GEN_DMAMUX1_CH0_EVT + DMAEx_GetMuxChannelIndex(pChain->pStages[stage - 1U].hdma);
+      polarity  = HAL_DMAMUX_REQ_GEN_RISING;
+    }
+
+    /* Burst length, and event generation when the stage triggers the next one */
+    ccr = (pChain->pStages[stage].BurstLength - 1U) << DMAMUX_CxCR_NBREQ_Pos;
+    if (stage < (pChain->NbStages - 1U))
+    {
+      ccr |= DMAMUX_CxCR_EGE;
+    }
+
+    /* Process Locked */
+    __HAL_LOCK(hdma);
+
+    if (hdma->DMAmuxRequestGen != 0U)
+    {
+      /* The request generator produces BurstLength requests on each trigger edge */
+      hdma->DMAmuxRequestGen->RGCR = signal_id | ((pChain->pStages[stage].BurstLength - 1U) << DMAMUX_RGxCR_GNBREQ_Pos) | \
+                                     polarity;
+    }
+    else if (polarity != HAL_DMAMUX_REQ_GEN_NO_EVENT)
+    {
+      /* The peripheral request is gated by the trigger signal.
+         Synchronization and request generator polarities share the same encoding */
+      ccr |= (signal_id << DMAMUX_CxCR_SYNC_ID_Pos) | polarity | DMAMUX_CxCR_SE;
+    }
+    else
+    {
+      /* Free running peripheral request */
+    }
+
+    /* Set the new chain parameters (and keep the request ID filled during the Init) */
+    MODIFY_REG(hdma->DMAmuxChannel->CCR, (~DMAMUX_CxCR_DMAREQ_ID), ccr);
+
+    /* Process UnLocked */
+    __HAL_UNLOCK(hdma);
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Start a DMAMUX trigger chain configured with HAL_DMAEx_ConfigMuxChain.
+  * @note   The stages are started from the last one to the first one, with interrupts enabled, so that
+  *         every stage is armed before it can be triggered. The transfer callbacks of each stage handle
+  *         are called as for HAL_DMA_Start_IT.
+  * @param  pChain : pointer to HAL_DMA_MuxChainTypeDef : contains the chain parameters
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DMAEx_StartMuxChain(HAL_DMA_MuxChainTypeDef *pChain)
+{
+  HAL_DMA_MuxChainStageTypeDef *pstage;
+  uint32_t stage;
+
+  if ((pChain == NULL) || (pChain->pStages == NULL) || (pChain->NbStages == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  for (stage = pChain->NbStages; stage > 0U; stage--)
+  {
+    pstage = &pChain->pStages[stage - 1U];
+
+    if (HAL_DMA_Start_IT(pstage->hdma, pstage->SrcAddress, pstage->DstAddress, pstage->DataLength) != HAL_OK)
+    {
+      /* Abort the stages already started */
+      for (; stage < pChain->NbStages; stage++)
+      {
+        (void)HAL_DMA_Abort(pChain->pStages[stage].hdma);
+      }
+      return HAL_ERROR;
+    }
+  }
+
+  /* Enable the request generators, the first stage one last */
+  for (stage = pChain->NbStages; stage > 0U; stage--)
+  {
+    if (pChain->pStages[stage - 1U].hdma->DMAmuxRequestGen != 0U)
+    {
+      (void)HAL_DMAEx_EnableMuxRequestGenerator(pChain->pStages[stage - 1U].hdma);
+    }
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop a DMAMUX trigger chain started with HAL_DMAEx_StartMuxChain.
+  * @note   The first stage request generator is disabled first so that no new trigger enters the chain,
+  *         then the transfer of every stage still in progress is aborted.
+  * @param  pChain : pointer to HAL_DMA_MuxChainTypeDef : contains the chain parameters
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DMAEx_StopMuxChain(HAL_DMA_MuxChainTypeDef *pChain)
+{
+  DMA_HandleTypeDef *hdma;
+  HAL_StatusTypeDef status = HAL_OK;
+  uint32_t stage;
+
+  if ((pChain == NULL) || (pChain->pStages == NULL) || (pChain->NbStages == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  for (stage = 0U; stage < pChain->NbStages; stage++)
+  {
+    hdma = pChain->pStages[stage].hdma;
+
+    if (hdma->DMAmuxRequestGen != 0U)
+    {
+      (void)HAL_DMAEx_DisableMuxRequestGenerator(hdma);
+    }
+  }
+
+  for (stage = 0U; stage < pChain->NbStages; stage++)
+  {
+    hdma = pChain->pStages[stage].hdma;
+
+    if (hdma->State == HAL_DMA_STATE_BUSY)
+    {
+      if (HAL_DMA_Abort(hdma) != HAL_OK)
+      {
+        status = HAL_ERROR;
+      }
+    }
+  }
+
+  return status;
+}
+
 /**
   * @brief  Handles DMAMUX interrupt request.
   * @param  hdma: pointer to a DMA_HandleTypeDef structure that contains
@@ -283,6 +495,26 @@ void HAL_DMAEx_MUX_IRQHandler(DMA_HandleTypeDef *hdma)
   * @}
   */
 
+/**
+  * @}
+  */
+
+/** @addtogroup DMAEx_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Return the index of the DMAMUX channel connected to the given DMA channel.
+  * @param  hdma: pointer to a DMA_HandleTypeDef structure that contains
+  *               the configuration information for the specified DMA channel.
+  * @retval DMAMUX channel index
+  */
+static uint32_t DMAEx_GetMuxChannelIndex(DMA_HandleTypeDef *hdma)
+{
+  return ((uint32_t)hdma->DMAmuxChannel - (uint32_t)DMAMUX1_Channel0) / \
+         ((uint32_t)DMAMUX1_Channel1 - (uint32_t)DMAMUX1_Channel0);
+}
+
 /**
   * @}
   */
@@ -0,0 +1,632 @@
+/**
+  ******************************************************************************
+  * @file    stm32g4xx_hal_dsp.c
+  * @author  MCD Application Team
+  * @brief   DSP HAL module driver.
+  *          This file provides CMSIS-DSP compatible functions computed by the
+  *          FMAC and CORDIC peripherals:
+  *           + Initialization and de-initialization functions
+  *           + CMSIS-DSP compatible functions
+  *
+  *  @verbatim
+  ================================================================================
+            ##### How to use this driver #####
+  ================================================================================
+    [..]
+      The DSP HAL driver offers the signatures of CMSIS-DSP functions, so that an
+      application written for CMSIS-DSP uses the FMAC and CORDIC without changes:
+      (+) arm_fir_q15() computed by the FMAC (FIR filter).
+      (+) arm_biquad_cascade_df1_q15() computed by the FMAC (IIR filter), one stage
+          after the other.
+      (+) arm_sin_cos_q31() computed by the CORDIC (cosine function).
+      (+) arm_cmplx_mag_q31() computed by the CORDIC (modulus function).
+      When the peripheral is busy, or when the block is too small or the parameters
+      are not supported by the peripheral, the CMSIS-DSP function itself is called.
+
+    [..]
+      (#) Add CMSIS-DSP to the project and define HAL_DSP_MODULE_ENABLED in
+          stm32g4xx_hal_conf.h, with HAL_FMAC_MODULE_ENABLED and HAL_CORDIC_MODULE_ENABLED.
+
+      (#) Initialize the FMAC and the CORDIC with @ref HAL_FMAC_Init() and
+          @ref HAL_CORDIC_Init(), then give their handles to @ref HAL_DSP_Init().
+          One of them can be NULL: the matching functions are then computed by CMSIS-DSP.
+
+      (#) Include stm32g4xx_hal_dsp.h in the files calling CMSIS-DSP: the calls to
+          the functions above are redirected to HAL_DSP_FIR_q15(), HAL_DSP_BiquadCascadeDF1_q15(),
+          HAL_DSP_SinCos_q31() and HAL_DSP_CmplxMag_q31(). Define HAL_DSP_NO_CMSIS_REMAP
+          before the include to call the HAL_DSP functions explicitly instead.
+
+      (#) The FMAC is used in polling mode and the CORDIC in Zero-Overhead mode.
+          These functions must not be called while an application transfer is in
+          progress on the same peripheral, nor from concurrent contexts.
+
+      (#) The FIR coefficients loaded into the FMAC are kept between two calls with
+          the same instance coefficients. Call @ref HAL_DSP_Init() again when the
+          coefficient values are modified in place, or after a direct use of the FMAC.
+
+    [..]
+      The results are close to the CMSIS-DSP ones but not bit-exact:
+      (+) The FMAC accumulator is 26-bit wide, the output is saturated (clip enabled).
+      (+) The CORDIC precision is set by HAL_DSP_CORDIC_PRECISION.
+
+  @endverbatim
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* The CMSIS-DSP functions are called as fall-back: do not redirect them here */
+#define HAL_DSP_NO_CMSIS_REMAP
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32g4xx_hal.h"
+
+#if defined(HAL_DSP_MODULE_ENABLED) && defined(HAL_FMAC_MODULE_ENABLED) && defined(HAL_CORDIC_MODULE_ENABLED)
+
+#include "stm32g4xx_hal_dsp.h"
+
+#if defined(FMAC) && defined(CORDIC)
+
+/** @addtogroup STM32G4xx_HAL_Driver
+  * @{
+  */
+
+/** @defgroup DSP DSP
+  * @brief    CMSIS-DSP compatible functions computed by FMAC and CORDIC
+  * @{
+  */
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private defines -----------------------------------------------------------*/
+/** @defgroup DSP_Private_Constants DSP Private Constants
+  * @{
+  */
+/* Free room added to the FMAC input and output buffers */
+#define DSP_FMAC_HEADROOM              4U
+/* Biggest FIR filter: X2, X1 and Y buffers must fit within the 256 words of FMAC memory */
+#define DSP_FMAC_FIR_MAX_TAPS          ((256U - (2U * DSP_FMAC_HEADROOM)) / 2U)
+/* Biggest block size handled by FMAC in one call */
+#define DSP_FMAC_MAX_BLOCK_SIZE        0xFFFFU
+/* Biquad filter: 3 feed-forward and 2 feedback coefficients */
+#define DSP_BIQUAD_P                   3U
+#define DSP_BIQUAD_Q                   2U
+/* Biquad coefficients and state per stage in CMSIS-DSP */
+#define DSP_BIQUAD_COEFFS_PER_STAGE    6U
+#define DSP_BIQUAD_STATE_PER_STAGE     4U
+/* Biggest biquad post shift, applied by the FMAC gain R */
+#define DSP_BIQUAD_MAX_POSTSHIFT       7
+/* CORDIC modulus argument of the cosine function, close to 1 */
+#define DSP_CORDIC_MODULUS_ONE         0x7FFFFFFF
+/* CORDIC configuration of arm_sin_cos_q31(): angle and modulus in, cosine and sine out */
+#define DSP_CORDIC_CSR_SINCOS          __HAL_CORDIC_CONFIG_CSR(CORDIC_FUNCTION_COSINE, HAL_DSP_CORDIC_PRECISION, \
+                                                               CORDIC_SCALE_0, CORDIC_NBWRITE_2, CORDIC_NBREAD_2, \
+                                                               CORDIC_INSIZE_32BITS, CORDIC_OUTSIZE_32BITS)
+/* CORDIC configuration of arm_cmplx_mag_q31(): real and imaginary parts in, modulus out */
+#define DSP_CORDIC_CSR_MODULUS         __HAL_CORDIC_CONFIG_CSR(CORDIC_FUNCTION_MODULUS, HAL_DSP_CORDIC_PRECISION, \
+                                                               CORDIC_SCALE_0, CORDIC_NBWRITE_2, CORDIC_NBREAD_1, \
+                                                               CORDIC_INSIZE_32BITS, CORDIC_OUTSIZE_32BITS)
+/**
+  * @}
+  */
+
+/* Private macros ------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/** @defgroup DSP_Private_Variables DSP Private Variables
+  * @{
+  */
+static FMAC_HandleTypeDef   *DspFmac = NULL;          /* FMAC handle, NULL if not used          */
+static CORDIC_HandleTypeDef *DspCordic = NULL;        /* CORDIC handle, NULL if not used        */
+static const q15_t          *DspFmacCoeffs = NULL;    /* FIR coefficients loaded into the FMAC  */
+static uint32_t              DspFmacNbTaps = 0U;      /* Number of loaded FIR coefficients      */
+/**
+  * @}
+  */
+
+/* Private function prototypes -----------------------------------------------*/
+/** @defgroup DSP_Private_Functions DSP Private Functions
+  * @{
+  */
+static uint32_t DSP_FMAC_IsAvailable(uint32_t BlockSize, uint32_t MinBlockSize);
+static uint32_t DSP_CORDIC_IsAvailable(void);
+static void DSP_FMAC_SetLayout(FMAC_FilterConfigTypeDef *pConfig, uint32_t CoeffSize, uint32_t P, uint32_t Q);
+static HAL_StatusTypeDef DSP_FMAC_Stream(const q15_t *pSrc, q15_t *pDst, uint32_t Size);
+static HAL_StatusTypeDef DSP_FMAC_FIR(const arm_fir_instance_q15 *S, const q15_t *pSrc, q15_t *pDst,
+                                      uint32_t blockSize);
+static HAL_StatusTypeDef DSP_FMAC_Biquad(const q15_t *pCoeffs, q15_t *pState, int8_t postShift,
+                                         const q15_t *pSrc, q15_t *pDst, uint32_t blockSize);
+/**
+  * @}
+  */
+
+/* Exported functions --------------------------------------------------------*/
+/** @defgroup DSP_Exported_Functions DSP Exported Functions
+  * @{
+  */
+
+/** @defgroup DSP_Exported_Functions_Group1 Initialization and de-initialization functions
+  * @brief    Initialization and de-initialization functions.
+  *
+@verbatim
+  ==============================================================================
+              ##### Initialization and de-initialization functions #####
+  ==============================================================================
+    [..]  This section provides functions allowing to:
+      (+) Give the FMAC and CORDIC handles used by the CMSIS-DSP compatible functions.
+      (+) Stop using the peripherals.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Select the peripherals used by the CMSIS-DSP compatible functions.
+  * @note   The FMAC and CORDIC must have been initialized by @ref HAL_FMAC_Init()
+  *         and @ref HAL_CORDIC_Init(). The FIR coefficient cache is flushed.
+  * @param  hfmac pointer to a FMAC_HandleTypeDef structure, NULL if the FMAC is not used.
+  * @param  hcordic pointer to a CORDIC_HandleTypeDef structure, NULL if the CORDIC is not used.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DSP_Init(FMAC_HandleTypeDef *hfmac, CORDIC_HandleTypeDef *hcordic)
+{
+  /* Check the peripherals state */
+  if ((hfmac != NULL) && (hfmac->State == HAL_FMAC_STATE_RESET))
+  {
+    return HAL_ERROR;
+  }
+  if ((hcordic != NULL) && (hcordic->State == HAL_CORDIC_STATE_RESET))
+  {
+    return HAL_ERROR;
+  }
+
+  DspFmac = hfmac;
+  DspCordic = hcordic;
+
+  /* No coefficient is known to be loaded into the FMAC */
+  DspFmacCoeffs = NULL;
+  DspFmacNbTaps = 0U;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop using the FMAC and CORDIC, all the functions are computed by CMSIS-DSP.
+  * @retval None
+  */
+void HAL_DSP_DeInit(void)
+{
+  DspFmac = NULL;
+  DspCordic = NULL;
+  DspFmacCoeffs = NULL;
+  DspFmacNbTaps = 0U;
+}
+
+/**
+  * @}
+  */
+
+/** @defgroup DSP_Exported_Functions_Group2 CMSIS-DSP compatible functions
+  * @brief    CMSIS-DSP compatible functions.
+  *
+@verbatim
+  ==============================================================================
+                  ##### CMSIS-DSP compatible functions #####
+  ==============================================================================
+    [..]  This section provides the CMSIS-DSP compatible functions. The parameters
+          and the instance structures are the CMSIS-DSP ones.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Processing function for the Q15 FIR filter, see arm_fir_q15().
+  * @note   The FMAC is used for blocks of HAL_DSP_FIR_MIN_BLOCK_SIZE samples or more
+  *         and up to DSP_FMAC_FIR_MAX_TAPS taps. The state buffer is updated as by CMSIS-DSP.
+  * @param  S points to an instance of the Q15 FIR filter structure.
+  * @param  pSrc points to the block of input data.
+  * @param  pDst points to the block of output data, it can be equal to pSrc.
+  * @param  blockSize number of samples to process.
+  * @retval None
+  */
+void HAL_DSP_FIR_q15(const arm_fir_instance_q15 *S, const q15_t *pSrc, q15_t *pDst, uint32_t blockSize)
+{
+  HAL_StatusTypeDef status = HAL_ERROR;
+
+  if ((DSP_FMAC_IsAvailable(blockSize, HAL_DSP_FIR_MIN_BLOCK_SIZE) != 0U) &&
+      (S->numTaps >= 2U) && (S->numTaps <= DSP_FMAC_FIR_MAX_TAPS))
+  {
+    status = DSP_FMAC_FIR(S, pSrc, pDst, blockSize);
+  }
+
+  if (status != HAL_OK)
+  {
+    arm_fir_q15(S, pSrc, pDst, blockSize);
+  }
+}
+
+/**
+  * @brief  Processing function for the Q15 biquad cascade DF1 filter, see arm_biquad_cascade_df1_q15().
+  * @note   The FMAC is used for blocks of HAL_DSP_BIQUAD_MIN_BLOCK_SIZE samples or more,
+  *         one stage after the other, the output of a stage being filtered in place
+  *         by the next stage. The state buffer is updated as by CMSIS-DSP.
+  * @param  S points to an instance of the Q15 biquad cascade structure.
+  * @param  pSrc points to the block of input data.
+  * @param  pDst points to the block of output data, it can be equal to pSrc.
+  * @param  blockSize number of samples to process.
+  * @retval None
+  */
+void HAL_DSP_BiquadCascadeDF1_q15(const arm_biquad_casd_df1_inst_q15 *S, const q15_t *pSrc, q15_t *pDst,
+                                  uint32_t blockSize)
+{
+  arm_biquad_casd_df1_inst_q15 remaining;
+  const q15_t *pin = pSrc;
+  uint32_t stage = 0U;
+  uint32_t nbstages = (uint32_t)S->numStages;
+
+  /* The stage state is made of the last two input and output samples of the block */
+  if ((DSP_FMAC_IsAvailable(blockSize, HAL_DSP_BIQUAD_MIN_BLOCK_SIZE) != 0U) && (blockSize >= 2U) &&
+      (S->postShift >= 0) && (S->postShift <= DSP_BIQUAD_MAX_POSTSHIFT))
+  {
+    while ((stage < nbstages) &&
+           (DSP_FMAC_Biquad(&S->pCoeffs[stage * DSP_BIQUAD_COEFFS_PER_STAGE],
+                            &S->pState[stage * DSP_BIQUAD_STATE_PER_STAGE],
+                            S->postShift, pin, pDst, blockSize) == HAL_OK))
+    {
+      pin = pDst;
+      stage++;
+    }
+  }
+
+  /* Compute the stages not handled by FMAC */
+  if (stage < nbstages)
+  {
+    remaining.numStages = (int8_t)(nbstages - stage);
+    remaining.pState = &S->pState[stage * DSP_BIQUAD_STATE_PER_STAGE];
+    remaining.pCoeffs = &S->pCoeffs[stage * DSP_BIQUAD_COEFFS_PER_STAGE];
+    remaining.postShift = S->postShift;
+
+    arm_biquad_cascade_df1_q15(&remaining, pin, pDst, blockSize);
+  }
+}
+
+/**
+  * @brief  Q31 sin_cos function, see arm_sin_cos_q31().
+  * @param  theta scaled input value in the range [-1, 0.9999] mapping to [-180, +180) degrees.
+  * @param  pSinVal points to the processed sine output.
+  * @param  pCosVal points to the processed cosine output.
+  * @retval None
+  */
+void HAL_DSP_SinCos_q31(q31_t theta, q31_t *pSinVal, q31_t *pCosVal)
+{
+  if (DSP_CORDIC_IsAvailable() != 0U)
+  {
+    /* The CORDIC angle is also scaled by pi, the cosine is the first result */
+    HAL_CORDIC_CalculateTwoZO(DspCordic, DSP_CORDIC_CSR_SINCOS, theta, DSP_CORDIC_MODULUS_ONE, pCosVal, pSinVal);
+  }
+  else
+  {
+    arm_sin_cos_q31(theta, pSinVal, pCosVal);
+  }
+}
+
+/**
+  * @brief  Q31 complex magnitude, see arm_cmplx_mag_q31().
+  * @note   The output is in 2.30 format, as with CMSIS-DSP.
+  * @param  pSrc points to the complex input vector.
+  * @param  pDst points to the real output vector.
+  * @param  numSamples number of complex samples in the input vector.
+  * @retval None
+  */
+void HAL_DSP_CmplxMag_q31(const q31_t *pSrc, q31_t *pDst, uint32_t numSamples)
+{
+  uint32_t index;
+
+  if (DSP_CORDIC_IsAvailable() != 0U)
+  {
+    for (index = 0U; index < numSamples; index++)
+    {
+      /* Halving the inputs gives a 1.31 modulus equal to the 2.30 magnitude, without overflow */
+      HAL_CORDIC_CalculateTwoZO(DspCordic, DSP_CORDIC_CSR_MODULUS, pSrc[2U * index] >> 1,
+                                pSrc[(2U * index) + 1U] >> 1, &pDst[index], NULL);
+    }
+  }
+  else
+  {
+    arm_cmplx_mag_q31(pSrc, pDst, numSamples);
+  }
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/** @addtogroup DSP_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Check whether the FMAC can process a block.
+  * @param  BlockSize Number of samples of the block.
+  * @param  MinBlockSize Smallest block worth the FMAC configuration.
+  * @retval 1 if the FMAC is used, 0 otherwise
+  */
+static uint32_t DSP_FMAC_IsAvailable(uint32_t BlockSize, uint32_t MinBlockSize)
+{
+  if ((DspFmac == NULL) || (BlockSize < MinBlockSize) || (BlockSize > DSP_FMAC_MAX_BLOCK_SIZE))
+  {
+    return 0U;
+  }
+
+  /* No filter or pipeline of the application must be in progress */
+  if ((DspFmac->State != HAL_FMAC_STATE_READY) || (DspFmac->pStage != NULL) ||
+      (READ_BIT(DspFmac->Instance->PARAM, FMAC_PARAM_START) != 0U))
+  {
+    return 0U;
+  }
+
+  return 1U;
+}
+
+/**
+  * @brief  Check whether the CORDIC can be used.
+  * @retval 1 if the CORDIC is used, 0 otherwise
+  */
+static uint32_t DSP_CORDIC_IsAvailable(void)
+{
+  if ((DspCordic == NULL) || (DspCordic->State != HAL_CORDIC_STATE_READY))
+  {
+    return 0U;
+  }
+
+  return 1U;
+}
+
+/**
+  * @brief  Fill the FMAC configuration: X2 at the memory start, followed by X1 and Y.
+  * @param  pConfig FMAC configuration.
+  * @param  CoeffSize Number of coefficients.
+  * @param  P Number of input samples used by the filter.
+  * @param  Q Number of output samples used by the filter (IIR), 0 for a FIR filter.
+  * @retval None
+  */
+static void DSP_FMAC_SetLayout(FMAC_FilterConfigTypeDef *pConfig, uint32_t CoeffSize, uint32_t P, uint32_t Q)
+{
+  pConfig->CoeffBaseAddress  = 0U;
+  pConfig->CoeffBufferSize   = (uint8_t)CoeffSize;
+  pConfig->InputBaseAddress  = (uint8_t)CoeffSize;
+  pConfig->InputBufferSize   = (uint8_t)(P + DSP_FMAC_HEADROOM);
+  pConfig->OutputBaseAddress = (uint8_t)(CoeffSize + P + DSP_FMAC_HEADROOM);
+  pConfig->OutputBufferSize  = (uint8_t)(Q + DSP_FMAC_HEADROOM);
+  pConfig->InputThreshold    = FMAC_THRESHOLD_1;
+  pConfig->OutputThreshold   = FMAC_THRESHOLD_1;
+  pConfig->InputAccess       = FMAC_BUFFER_ACCESS_POLLING;
+  pConfig->OutputAccess      = FMAC_BUFFER_ACCESS_POLLING;
+  pConfig->Clip              = FMAC_CLIP_ENABLED;
+}
+
+/**
+  * @brief  Filter a block with the configured and preloaded FMAC, in polling mode.
+  * @param  pSrc Input samples.
+  * @param  pDst Output samples, it can be equal to pSrc.
+  * @param  Size Number of samples.
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef DSP_FMAC_Stream(const q15_t *pSrc, q15_t *pDst, uint32_t Size)
+{
+  uint16_t insize = (uint16_t)Size;
+  uint16_t outsize = (uint16_t)Size;
+  uint16_t remaining;
+  HAL_StatusTypeDef status;
+
+  /* The input is only read by FMAC, an output sample is written after its input sample is read */
+  status = HAL_FMAC_FilterStart(DspFmac, pDst, &outsize);
+  if (status == HAL_OK)
+  {
+    status = HAL_FMAC_AppendFilterData(DspFmac, (int16_t *)pSrc, &insize);
+  }
+  if (status == HAL_OK)
+  {
+    status = HAL_FMAC_PollFilterData(DspFmac, HAL_DSP_FMAC_TIMEOUT);
+  }
+
+  /* Read the last output samples, computed after the end of the input */
+  if ((status == HAL_OK) && (outsize < (uint16_t)Size))
+  {
+    remaining = (uint16_t)Size - outsize;
+    status = HAL_FMAC_ConfigFilterOutputBuffer(DspFmac, &pDst[outsize], &remaining);
+    if (status == HAL_OK)
+    {
+      status = HAL_FMAC_PollFilterData(DspFmac, HAL_DSP_FMAC_TIMEOUT);
+    }
+  }
+
+  if (HAL_FMAC_FilterStop(DspFmac) != HAL_OK)
+  {
+    status = HAL_ERROR;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Compute a Q15 FIR filter with FMAC.
+  * @param  S points to an instance of the Q15 FIR filter structure.
+  * @param  pSrc points to the block of input data.
+  * @param  pDst points to the block of output data.
+  * @param  blockSize number of samples to process.
+  * @retval HAL status, the CMSIS-DSP state is updated only if HAL_OK
+  */
+static HAL_StatusTypeDef DSP_FMAC_FIR(const arm_fir_instance_q15 *S, const q15_t *pSrc, q15_t *pDst,
+                                      uint32_t blockSize)
+{
+  FMAC_FilterConfigTypeDef config;
+  q15_t coeffs[DSP_FMAC_FIR_MAX_TAPS];
+  q15_t *pstate = S->pState;
+  uint32_t nbtaps = S->numTaps;
+  uint32_t nbhistory = nbtaps - 1U;
+  uint32_t nbnew;
+  uint32_t index;
+  HAL_StatusTypeDef status;
+
+  DSP_FMAC_SetLayout(&config, nbtaps, nbtaps, 0U);
+  config.Filter = FMAC_FUNC_CONVO_FIR;
+  config.P = (uint8_t)nbtaps;
+  config.Q = 0U;
+  config.R = 0U;
+  config.pCoeffA = NULL;
+  config.CoeffASize = 0U;
+
+  /* Load the coefficients only if they are not already in the FMAC memory */
+  if ((DspFmacCoeffs == S->pCoeffs) && (DspFmacNbTaps == nbtaps))
+  {
+    config.pCoeffB = NULL;
+    config.CoeffBSize = 0U;
+  }
+  else
+  {
+    /* CMSIS-DSP coefficients are stored in time reversed order */
+    for (index = 0U; index < nbtaps; index++)
+    {
+      coeffs[index] = S->pCoeffs[nbtaps - 1U - index];
+    }
+    config.pCoeffB = coeffs;
+    config.CoeffBSize = (uint8_t)nbtaps;
+    DspFmacCoeffs = NULL;
+  }
+
+  status = HAL_FMAC_FilterConfig(DspFmac, &config);
+  if (status == HAL_OK)
+  {
+    DspFmacCoeffs = S->pCoeffs;
+    DspFmacNbTaps = nbtaps;
+
+    /* Preload the previous input samples kept at the start of the state buffer */
+    status = HAL_FMAC_FilterPreload(DspFmac, pstate, (uint8_t)nbhistory, NULL, 0U);
+  }
+
+  if (status == HAL_OK)
+  {
+    /* Keep the last input samples after the history, before an in-place filtering overwrites them */
+    nbnew = (blockSize < nbhistory) ? blockSize : nbhistory;
+    for (index = 0U; index < nbnew; index++)
+    {
+      pstate[nbhistory + index] = pSrc[blockSize - nbnew + index];
+    }
+
+    status = DSP_FMAC_Stream(pSrc, pDst, blockSize);
+  }
+
+  if (status == HAL_OK)
+  {
+    /* Keep the last (numTaps - 1) input samples at the start of the state buffer */
+    for (index = 0U; index < nbhistory; index++)
+    {
+      pstate[index] = pstate[nbnew + index];
+    }
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Compute one Q15 biquad DF1 stage with FMAC.
+  * @param  pCoeffs Coefficients of the stage {b0, 0, b1, b2, a1, a2}.
+  * @param  pState State of the stage {x[n-1], x[n-2], y[n-1], y[n-2]}.
+  * @param  postShift Shift applied to the output, FMAC gain.
+  * @param  pSrc points to the block of input data.
+  * @param  pDst points to the block of output data.
+  * @param  blockSize number of samples to process.
+  * @retval HAL status, the stage state is updated only if HAL_OK
+  */
+static HAL_StatusTypeDef DSP_FMAC_Biquad(const q15_t *pCoeffs, q15_t *pState, int8_t postShift,
+                                         const q15_t *pSrc, q15_t *pDst, uint32_t blockSize)
+{
+  FMAC_FilterConfigTypeDef config;
+  q15_t coeffb[DSP_BIQUAD_P];
+  q15_t coeffa[DSP_BIQUAD_Q];
+  q15_t xhistory[DSP_BIQUAD_P - 1U];
+  q15_t yhistory[DSP_BIQUAD_Q];
+  q15_t xlast[DSP_BIQUAD_P - 1U];
+  HAL_StatusTypeDef status;
+
+  /* FMAC uses the same sign convention as CMSIS-DSP, without the padding coefficient */
+  coeffb[0] = pCoeffs[0];
+  coeffb[1] = pCoeffs[2];
+  coeffb[2] = pCoeffs[3];
+  coeffa[0] = pCoeffs[4];
+  coeffa[1] = pCoeffs[5];
+
+  /* FMAC preloads the oldest sample first */
+  xhistory[0] = pState[1];
+  xhistory[1] = pState[0];
+  yhistory[0] = pState[3];
+  yhistory[1] = pState[2];
+
+  /* Keep the last input samples before an in-place filtering overwrites them */
+  xlast[0] = pSrc[blockSize - 1U];
+  xlast[1] = pSrc[blockSize - 2U];
+
+  DSP_FMAC_SetLayout(&config, DSP_BIQUAD_P + DSP_BIQUAD_Q, DSP_BIQUAD_P, DSP_BIQUAD_Q);
+  config.Filter = FMAC_FUNC_IIR_DIRECT_FORM_1;
+  config.P = (uint8_t)DSP_BIQUAD_P;
+  config.Q = (uint8_t)DSP_BIQUAD_Q;
+  config.R = (uint8_t)postShift;
+  config.pCoeffB = coeffb;
+  config.CoeffBSize = (uint8_t)DSP_BIQUAD_P;
+  config.pCoeffA = coeffa;
+  config.CoeffASize = (uint8_t)DSP_BIQUAD_Q;
+
+  /* The FIR coefficients in the FMAC memory are overwritten */
+  DspFmacCoeffs = NULL;
+
+  status = HAL_FMAC_FilterConfig(DspFmac, &config);
+  if (status == HAL_OK)
+  {
+    status = HAL_FMAC_FilterPreload(DspFmac, xhistory, (uint8_t)(DSP_BIQUAD_P - 1U), yhistory, (uint8_t)DSP_BIQUAD_Q);
+  }
+  if (status == HAL_OK)
+  {
+    status = DSP_FMAC_Stream(pSrc, pDst, blockSize);
+  }
+
+  if (status == HAL_OK)
+  {
+    pState[0] = xlast[0];
+    pState[1] = xlast[1];
+    pState[2] = pDst[blockSize - 1U];
+    pState[3] = pDst[blockSize - 2U];
+  }
+
+  return status;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#endif /* FMAC && CORDIC */
+
+#endif /* HAL_DSP_MODULE_ENABLED && HAL_FMAC_MODULE_ENABLED && HAL_CORDIC_MODULE_ENABLED */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,993 @@
+/**
+  ******************************************************************************
+  * @file    stm32g4xx_hal_eeprom_emul.c
+  * @author  MCD Application Team
+  * @brief   EEPROM emulation HAL module driver.
+  *          This file provides firmware functions to emulate an EEPROM of 32-bit
+  *          variables in the FLASH main memory:
+  *           + Initialization, recovery and format functions
+  *           + Read and write functions
+  *           + State and error functions
+  *
+  @verbatim
+  ==============================================================================
+                  ##### EEPROM emulation features #####
+  ==============================================================================
+  [..]
+    (+) Each write appends one element (one FLASH double word) holding the
+        32-bit data, the 16-bit virtual address and a CRC-16 to the active page.
+        The last element of each variable is located through a RAM index, so
+        that reads do not scan the FLASH.
+
+    (+) When the active page is full, the next page of the rotation is prepared,
+        the new element is written first into it (write-ahead), then the last
+        element of every other variable is copied. The old page is erased once
+        the new one is marked active. The pages are used in a ring so that the
+        erase cycles are spread over all the pages of the emulation area.
+
+    (+) Each page starts with a header of four double words, programmed one
+        after the other to mark the page RECEIVE (with a generation number),
+        ACTIVE and OBSOLETE. As each marker is a separate double word, the
+        page state can be changed without programming a double word twice.
+        HAL_EEPROM_EMUL_Init() uses these states to complete or discard an
+        operation interrupted by a power failure.
+
+  ==============================================================================
+                        ##### How to use this driver #####
+  ==============================================================================
+  [..]
+    (#) Declare an EEPROM_EMUL_HandleTypeDef handle structure and a RAM array of
+        NbVariables words for the index, for example:
+          EEPROM_EMUL_HandleTypeDef  heeprom;
+          uint32_t                   eeprom_index[NB_VARIABLES];
+
+    (#) Fill the "Init" field with the FLASH bank, the first page and the number
+        of pages of the emulation area, the page size, the number of variables
+        and the index array. A page must be able to hold the header and one
+        more element than the number of variables.
+
+    (#) Call HAL_EEPROM_EMUL_Init(). The pages are scanned to build the index and
+        an interrupted page transfer is completed. An area without any valid page
+        is formatted. HAL_EEPROM_EMUL_Format() erases all the variables.
+
+    (#) Read and write the variables with HAL_EEPROM_EMUL_Read() and
+        HAL_EEPROM_EMUL_Write(). Writing the value already stored does not
+        program the FLASH.
+
+    [..]
+      (@) The FLASH control register is unlocked when needed and locked again
+          if it was locked before the call.
+      (@) A double word interrupted by a power failure while being programmed may
+          raise an ECC double error when it is read back. The application should
+          handle the ECCD non maskable interrupt during HAL_EEPROM_EMUL_Init(), by
+          erasing the page or formatting the emulation area.
+      (@) A page transfer lasts a page erase, and the CPU is stalled while the
+          FLASH is erased when it executes from the same bank.
+
+  @endverbatim
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                       opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32g4xx_hal.h"
+
+/** @addtogroup STM32G4xx_HAL_Driver
+  * @{
+  */
+
+/** @defgroup EEPROM_EMUL EEPROM_EMUL
+  * @brief EEPROM emulation HAL module driver
+  * @{
+  */
+
+#ifdef HAL_EEPROM_EMUL_MODULE_ENABLED
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/** @defgroup EEPROM_EMUL_Private_Constants EEPROM Emulation Private Constants
+  * @{
+  */
+#define EEPROM_EMUL_MARKER            0x5AA5A55AU   /* Value of the programmed header markers  */
+#define EEPROM_EMUL_HEADER_RECEIVE    0U            /* Header element: RECEIVE and generation  */
+#define EEPROM_EMUL_HEADER_ACTIVE     1U            /* Header element: ACTIVE                  */
+#define EEPROM_EMUL_HEADER_OBSOLETE   2U            /* Header element: OBSOLETE                */
+
+#define EEPROM_EMUL_PAGE_ERASED       0U            /* No header marker programmed             */
+#define EEPROM_EMUL_PAGE_RECEIVE      1U            /* Page receiving a transfer               */
+#define EEPROM_EMUL_PAGE_ACTIVE       2U            /* Page holding the valid variables        */
+#define EEPROM_EMUL_PAGE_OBSOLETE     3U            /* Page waiting to be erased               */
+
+#define EEPROM_EMUL_NO_PAGE           0xFFFFFFFFU
+/**
+  * @}
+  */
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+/** @defgroup EEPROM_EMUL_Private_Functions EEPROM Emulation Private Functions
+  * @{
+  */
+static uint32_t          EEPROM_EMUL_PageAddress(EEPROM_EMUL_HandleTypeDef *heeprom, uint32_t Page);
+static uint64_t          EEPROM_EMUL_ReadElement(uint32_t Address);
+static uint64_t          EEPROM_EMUL_BuildElement(uint32_t VirtAddress, uint32_t Data);
+static uint32_t          EEPROM_EMUL_IsElementValid(uint64_t Element);
+static uint16_t          EEPROM_EMUL_Crc16(uint64_t Element);
+static uint32_t          EEPROM_EMUL_GetPageState(EEPROM_EMUL_HandleTypeDef *heeprom, uint32_t Page);
+static HAL_StatusTypeDef EEPROM_EMUL_SetPageState(EEPROM_EMUL_HandleTypeDef *heeprom, uint32_t Page, uint32_t State,
+                                                  uint32_t Generation);
+static HAL_StatusTypeDef EEPROM_EMUL_Program(EEPROM_EMUL_HandleTypeDef *heeprom, uint32_t Address, uint64_t Element);
+static HAL_StatusTypeDef EEPROM_EMUL_ErasePages(EEPROM_EMUL_HandleTypeDef *heeprom, uint32_t Page, uint32_t NbPages);
+static HAL_StatusTypeDef EEPROM_EMUL_PreparePage(EEPROM_EMUL_HandleTypeDef *heeprom, uint32_t Page);
+static uint32_t          EEPROM_EMUL_ScanPage(EEPROM_EMUL_HandleTypeDef *heeprom, uint32_t Page);
+static HAL_StatusTypeDef EEPROM_EMUL_Transfer(EEPROM_EMUL_HandleTypeDef *heeprom, uint32_t SrcPage, uint32_t DstPage);
+static HAL_StatusTypeDef EEPROM_EMUL_Recover(EEPROM_EMUL_HandleTypeDef *heeprom);
+static HAL_StatusTypeDef EEPROM_EMUL_FormatPages(EEPROM_EMUL_HandleTypeDef *heeprom);
+static uint32_t          EEPROM_EMUL_FlashUnlock(void);
+static void              EEPROM_EMUL_FlashRestore(uint32_t Locked);
+/**
+  * @}
+  */
+
+/* Exported functions --------------------------------------------------------*/
+/** @defgroup EEPROM_EMUL_Exported_Functions EEPROM Emulation Exported Functions
+  * @{
+  */
+
+/** @defgroup EEPROM_EMUL_Exported_Functions_Group1 Initialization and de-initialization functions
+  *  @brief    Initialization, recovery and format functions
+  *
+@verbatim
+ ===============================================================================
+         ##### Initialization and de-initialization functions #####
+ ===============================================================================
+    [..]
+    This subsection provides functions allowing to initialize the EEPROM
+    emulation from the content of the FLASH, and to format the emulation area.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Initialize the EEPROM emulation from the content of the FLASH.
+  * @note   The RAM index is built by scanning the RECEIVE and ACTIVE pages, an
+  *         interrupted transfer is completed and the OBSOLETE pages are erased.
+  *         The emulation area is formatted when no valid page is found.
+  * @param  heeprom EEPROM emulation handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_EEPROM_EMUL_Init(EEPROM_EMUL_HandleTypeDef *heeprom)
+{
+  HAL_StatusTypeDef status;
+  uint32_t locked;
+  uint32_t index;
+
+  /* Check the EEPROM emulation handle allocation */
+  if (heeprom == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the parameters */
+  assert_param(IS_FLASH_BANK_EXCLUSIVE(heeprom->Init.Bank));
+
+  if ((heeprom->Init.pIndex == NULL) || (heeprom->Init.NbPages < 2U) ||
+      (heeprom->Init.NbVariables == 0U) || (heeprom->Init.NbVariables >= 0xFFFFU) ||
+      (heeprom->Init.PageSize < (EEPROM_EMUL_HEADER_SIZE + ((heeprom->Init.NbVariables + 1U) * EEPROM_EMUL_ELEMENT_SIZE))))
+  {
+    heeprom->ErrorCode = HAL_EEPROM_EMUL_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  if (heeprom->State == HAL_EEPROM_EMUL_STATE_RESET)
+  {
+    /* Allocate lock resource and initialize it */
+    heeprom->Lock = HAL_UNLOCKED;
+  }
+
+  heeprom->State = HAL_EEPROM_EMUL_STATE_BUSY;
+  heeprom->ErrorCode = HAL_EEPROM_EMUL_ERROR_NONE;
+  heeprom->Generation = 0U;
+
+  /* Clear the RAM index */
+  for (index = 0U; index < heeprom->Init.NbVariables; index++)
+  {
+    heeprom->Init.pIndex[index] = 0U;
+  }
+
+  locked = EEPROM_EMUL_FlashUnlock();
+  status = EEPROM_EMUL_Recover(heeprom);
+  EEPROM_EMUL_FlashRestore(locked);
+
+  if (status == HAL_OK)
+  {
+    heeprom->State = HAL_EEPROM_EMUL_STATE_READY;
+  }
+  else
+  {
+    heeprom->ErrorCode |= HAL_EEPROM_EMUL_ERROR_FLASH;
+    heeprom->State = HAL_EEPROM_EMUL_STATE_ERROR;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  DeInitialize the EEPROM emulation.
+  * @note   The content of the FLASH is kept.
+  * @param  heeprom EEPROM emulation handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_EEPROM_EMUL_DeInit(EEPROM_EMUL_HandleTypeDef *heeprom)
+{
+  /* Check the EEPROM emulation handle allocation */
+  if (heeprom == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  heeprom->ErrorCode = HAL_EEPROM_EMUL_ERROR_NONE;
+  heeprom->State = HAL_EEPROM_EMUL_STATE_RESET;
+
+  /* Release Lock */
+  __HAL_UNLOCK(heeprom);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Erase all the variables of the EEPROM emulation.
+  * @note   All the pages of the emulation area are erased and the first one is
+  *         marked active.
+  * @param  heeprom EEPROM emulation handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_EEPROM_EMUL_Format(EEPROM_EMUL_HandleTypeDef *heeprom)
+{
+  HAL_StatusTypeDef status;
+  uint32_t locked;
+
+  /* Process locked */
+  __HAL_LOCK(heeprom);
+
+  if (heeprom->State != HAL_EEPROM_EMUL_STATE_READY)
+  {
+    __HAL_UNLOCK(heeprom);
+    return HAL_BUSY;
+  }
+
+  heeprom->State = HAL_EEPROM_EMUL_STATE_BUSY;
+
+  locked = EEPROM_EMUL_FlashUnlock();
+  status = EEPROM_EMUL_FormatPages(heeprom);
+  EEPROM_EMUL_FlashRestore(locked);
+
+  if (status == HAL_OK)
+  {
+    heeprom->State = HAL_EEPROM_EMUL_STATE_READY;
+  }
+  else
+  {
+    heeprom->ErrorCode |= HAL_EEPROM_EMUL_ERROR_FLASH;
+    heeprom->State = HAL_EEPROM_EMUL_STATE_ERROR;
+  }
+
+  /* Process unlocked */
+  __HAL_UNLOCK(heeprom);
+
+  return status;
+}
+
+/**
+  * @}
+  */
+
+/** @defgroup EEPROM_EMUL_Exported_Functions_Group2 IO operation functions
+  *  @brief    Read and write functions
+  *
+@verbatim
+ ===============================================================================
+                      ##### IO operation functions #####
+ ===============================================================================
+    [..]
+    This subsection provides functions allowing to read and write the variables
+    of the EEPROM emulation.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Read a variable.
+  * @note   The FLASH address of the last element of the variable is taken from
+  *         the RAM index, the read does not depend on the number of writes.
+  * @param  heeprom EEPROM emulation handle
+  * @param  VirtAddress virtual address of the variable, from 0 to NbVariables - 1
+  * @param  pData pointer to the read value
+  * @retval HAL status: HAL_ERROR with HAL_EEPROM_EMUL_ERROR_NO_DATA if the
+  *         variable has never been written
+  */
+HAL_StatusTypeDef HAL_EEPROM_EMUL_Read(EEPROM_EMUL_HandleTypeDef *heeprom, uint32_t VirtAddress, uint32_t *pData)
+{
+  uint32_t address;
+
+  if ((pData == NULL) || (VirtAddress >= heeprom->Init.NbVariables))
+  {
+    heeprom->ErrorCode |= HAL_EEPROM_EMUL_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  if ((heeprom->State != HAL_EEPROM_EMUL_STATE_READY) && (heeprom->State != HAL_EEPROM_EMUL_STATE_BUSY))
+  {
+    return HAL_ERROR;
+  }
+
+  address = heeprom->Init.pIndex[VirtAddress];
+  if (address == 0U)
+  {
+    heeprom->ErrorCode |= HAL_EEPROM_EMUL_ERROR_NO_DATA;
+    return HAL_ERROR;
+  }
+
+  *pData = *(__IO uint32_t *)address;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Write a variable.
+  * @note   The element is appended to the active page. When the page is full,
+  *         the element is written first into the next page, then the other
+  *         variables are transferred and the full page is erased.
+  * @param  heeprom EEPROM emulation handle
+  * @param  VirtAddress virtual address of the variable, from 0 to NbVariables - 1
+  * @param  Data value to write
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_EEPROM_EMUL_Write(EEPROM_EMUL_HandleTypeDef *heeprom, uint32_t VirtAddress, uint32_t Data)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+  uint64_t element;
+  uint32_t address;
+  uint32_t locked;
+  uint32_t srcpage;
+  uint32_t dstpage;
+
+  if (VirtAddress >= heeprom->Init.NbVariables)
+  {
+    heeprom->ErrorCode |= HAL_EEPROM_EMUL_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  /* Process locked */
+  __HAL_LOCK(heeprom);
+
+  if (heeprom->State != HAL_EEPROM_EMUL_STATE_READY)
+  {
+    __HAL_UNLOCK(heeprom);
+    return HAL_BUSY;
+  }
+
+  /* Nothing to program if the value is already stored */
+  address = heeprom->Init.pIndex[VirtAddress];
+  if ((address != 0U) && (*(__IO uint32_t *)address == Data))
+  {
+    __HAL_UNLOCK(heeprom);
+    return HAL_OK;
+  }
+
+  heeprom->State = HAL_EEPROM_EMUL_STATE_BUSY;
+  element = EEPROM_EMUL_BuildElement(VirtAddress, Data);
+
+  locked = EEPROM_EMUL_FlashUnlock();
+
+  if (heeprom->FreeAddress >= (EEPROM_EMUL_PageAddress(heeprom, heeprom->ActivePage) + heeprom->Init.PageSize))
+  {
+    /* Active page full: prepare the next page of the rotation */
+    srcpage = heeprom->ActivePage;
+    dstpage = (srcpage + 1U) % heeprom->Init.NbPages;
+
+    status = EEPROM_EMUL_PreparePage(heeprom, dstpage);
+    if (status == HAL_OK)
+    {
+      status = EEPROM_EMUL_SetPageState(heeprom, dstpage, EEPROM_EMUL_PAGE_RECEIVE, heeprom->Generation + 1U);
+    }
+
+    /* Write-ahead: the new element is the first one of the new page */
+    if (status == HAL_OK)
+    {
+      heeprom->FreeAddress = EEPROM_EMUL_PageAddress(heeprom, dstpage) + EEPROM_EMUL_HEADER_SIZE;
+      status = EEPROM_EMUL_Program(heeprom, heeprom->FreeAddress, element);
+    }
+    if (status == HAL_OK)
+    {
+      heeprom->Init.pIndex[VirtAddress] = heeprom->FreeAddress;
+      heeprom->FreeAddress += EEPROM_EMUL_ELEMENT_SIZE;
+
+      /* Copy the other variables and switch to the new page */
+      status = EEPROM_EMUL_Transfer(heeprom, srcpage, dstpage);
+    }
+  }
+  else
+  {
+    status = EEPROM_EMUL_Program(heeprom, heeprom->FreeAddress, element);
+    if (status == HAL_OK)
+    {
+      heeprom->Init.pIndex[VirtAddress] = heeprom->FreeAddress;
+      heeprom->FreeAddress += EEPROM_EMUL_ELEMENT_SIZE;
+    }
+  }
+
+  EEPROM_EMUL_FlashRestore(locked);
+
+  if (status == HAL_OK)
+  {
+    heeprom->State = HAL_EEPROM_EMUL_STATE_READY;
+  }
+  else
+  {
+    /* HAL_EEPROM_EMUL_Init() must be called to recover */
+    heeprom->ErrorCode |= HAL_EEPROM_EMUL_ERROR_FLASH;
+    heeprom->State = HAL_EEPROM_EMUL_STATE_ERROR;
+  }
+
+  /* Process unlocked */
+  __HAL_UNLOCK(heeprom);
+
+  return status;
+}
+
+/**
+  * @}
+  */
+
+/** @defgroup EEPROM_EMUL_Exported_Functions_Group3 Peripheral State and Error functions
+  *  @brief    State and error functions
+  *
+@verbatim
+ ===============================================================================
+                ##### Peripheral State and Error functions #####
+ ===============================================================================
+    [..]
+    This subsection provides functions allowing to get the state and the error
+    code of the EEPROM emulation.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Return the EEPROM emulation state.
+  * @param  heeprom EEPROM emulation handle
+  * @retval HAL state
+  */
+HAL_EEPROM_EMUL_StateTypeDef HAL_EEPROM_EMUL_GetState(EEPROM_EMUL_HandleTypeDef *heeprom)
+{
+  return heeprom->State;
+}
+
+/**
+  * @brief  Return the EEPROM emulation error code.
+  * @param  heeprom EEPROM emulation handle
+  * @retval EEPROM emulation error code, a value of @ref EEPROM_EMUL_Error_Code
+  */
+uint32_t HAL_EEPROM_EMUL_GetError(EEPROM_EMUL_HandleTypeDef *heeprom)
+{
+  return heeprom->ErrorCode;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/* Private functions ---------------------------------------------------------*/
+/** @addtogroup EEPROM_EMUL_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Get the FLASH address of a page of the rotation.
+  * @param  heeprom EEPROM emulation handle
+  * @param  Page index of the page in the rotation
+  * @retval Address of the page
+  */
+static uint32_t EEPROM_EMUL_PageAddress(EEPROM_EMUL_HandleTypeDef *heeprom, uint32_t Page)
+{
+  uint32_t address = FLASH_BASE + ((heeprom->Init.StartPage + Page) * heeprom->Init.PageSize);
+
+#if defined (FLASH_OPTR_DBANK)
+  if (heeprom->Init.Bank == FLASH_BANK_2)
+  {
+    address += FLASH_BANK_SIZE;
+  }
+#endif
+
+  return address;
+}
+
+/**
+  * @brief  Read an element from the FLASH.
+  * @param  Address address of the element
+  * @retval Element
+  */
+static uint64_t EEPROM_EMUL_ReadElement(uint32_t Address)
+{
+  uint32_t low = *(__IO uint32_t *)Address;
+  uint32_t high = *(__IO uint32_t *)(Address + 4U);
+
+  return (((uint64_t)high) << 32U) | low;
+}
+
+/**
+  * @brief  Build the element of a variable.
+  * @param  VirtAddress virtual address of the variable
+  * @param  Data value of the variable
+  * @retval Element
+  */
+static uint64_t EEPROM_EMUL_BuildElement(uint32_t VirtAddress, uint32_t Data)
+{
+  uint64_t element = (((uint64_t)(VirtAddress & 0xFFFFU)) << 32U) | Data;
+
+  return element | (((uint64_t)EEPROM_EMUL_Crc16(element)) << 48U);
+}
+
+/**
+  * @brief  Check the CRC of an element.
+  * @param  Element element read from the FLASH
+  * @retval 1 if the element is valid, 0 otherwise
+  */
+static uint32_t EEPROM_EMUL_IsElementValid(uint64_t Element)
+{
+  return ((uint16_t)(Element >> 48U) == EEPROM_EMUL_Crc16(Element)) ? 1U : 0U;
+}
+
+/**
+  * @brief  Compute the CRC-16/CCITT of the data and virtual address of an element.
+  * @param  Element element (bits 48 to 63 are ignored)
+  * @retval CRC
+  */
+static uint16_t EEPROM_EMUL_Crc16(uint64_t Element)
+{
+  uint32_t crc = 0xFFFFU;
+  uint32_t byte_index;
+  uint32_t bit_index;
+
+  for (byte_index = 0U; byte_index < 6U; byte_index++)
+  {
+    crc ^= ((uint32_t)(Element >> (8U * byte_index)) & 0xFFU) << 8U;
+    for (bit_index = 0U; bit_index < 8U; bit_index++)
+    {
+      crc = ((crc & 0x8000U) != 0U) ? ((crc << 1U) ^ 0x1021U) : (crc << 1U);
+    }
+  }
+
+  return (uint16_t)crc;
+}
+
+/**
+  * @brief  Get the state of a page from its header.
+  * @param  heeprom EEPROM emulation handle
+  * @param  Page index of the page in the rotation
+  * @retval Page state
+  */
+static uint32_t EEPROM_EMUL_GetPageState(EEPROM_EMUL_HandleTypeDef *heeprom, uint32_t Page)
+{
+  uint32_t address = EEPROM_EMUL_PageAddress(heeprom, Page);
+  uint32_t state = EEPROM_EMUL_PAGE_ERASED;
+
+  if (EEPROM_EMUL_ReadElement(address + (EEPROM_EMUL_HEADER_OBSOLETE * EEPROM_EMUL_ELEMENT_SIZE)) != 0xFFFFFFFFFFFFFFFFULL)
+  {
+    state = EEPROM_EMUL_PAGE_OBSOLETE;
+  }
+  else if (EEPROM_EMUL_ReadElement(address + (EEPROM_EMUL_HEADER_ACTIVE * EEPROM_EMUL_ELEMENT_SIZE)) != 0xFFFFFFFFFFFFFFFFULL)
+  {
+    state = EEPROM_EMUL_PAGE_ACTIVE;
+  }
+  else if (EEPROM_EMUL_ReadElement(address + (EEPROM_EMUL_HEADER_RECEIVE * EEPROM_EMUL_ELEMENT_SIZE)) != 0xFFFFFFFFFFFFFFFFULL)
+  {
+    state = EEPROM_EMUL_PAGE_RECEIVE;
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+
+  return state;
+}
+
+/**
+  * @brief  Program the header marker of a page state.
+  * @param  heeprom EEPROM emulation handle
+  * @param  Page index of the page in the rotation
+  * @param  State EEPROM_EMUL_PAGE_RECEIVE, EEPROM_EMUL_PAGE_ACTIVE or EEPROM_EMUL_PAGE_OBSOLETE
+  * @param  Generation generation number saved with the RECEIVE marker
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef EEPROM_EMUL_SetPageState(EEPROM_EMUL_HandleTypeDef *heeprom, uint32_t Page, uint32_t State,
+                                                  uint32_t Generation)
+{
+  uint32_t address = EEPROM_EMUL_PageAddress(heeprom, Page);
+  uint64_t marker = (((uint64_t)EEPROM_EMUL_MARKER) << 32U) | EEPROM_EMUL_MARKER;
+
+  if (State == EEPROM_EMUL_PAGE_RECEIVE)
+  {
+    marker = (((uint64_t)EEPROM_EMUL_MARKER) << 32U) | Generation;
+    address += EEPROM_EMUL_HEADER_RECEIVE * EEPROM_EMUL_ELEMENT_SIZE;
+  }
+  else if (State == EEPROM_EMUL_PAGE_ACTIVE)
+  {
+    address += EEPROM_EMUL_HEADER_ACTIVE * EEPROM_EMUL_ELEMENT_SIZE;
+  }
+  else
+  {
+    address += EEPROM_EMUL_HEADER_OBSOLETE * EEPROM_EMUL_ELEMENT_SIZE;
+  }
+
+  return EEPROM_EMUL_Program(heeprom, address, marker);
+}
+
+/**
+  * @brief  Program an element and invalidate the FLASH data cache.
+  * @note   The data cache is reset so that a line read before the programming
+  *         does not hide the new element.
+  * @param  heeprom EEPROM emulation handle
+  * @param  Address address of the element
+  * @param  Element element to program
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef EEPROM_EMUL_Program(EEPROM_EMUL_HandleTypeDef *heeprom, uint32_t Address, uint64_t Element)
+{
+  HAL_StatusTypeDef status;
+
+  UNUSED(heeprom);
+
+  status = HAL_FLASH_Program(FLASH_TYPEPROGRAM_DOUBLEWORD, Address, Element);
+
+  if (READ_BIT(FLASH->ACR, FLASH_ACR_DCEN) != 0U)
+  {
+    __HAL_FLASH_DATA_CACHE_DISABLE();
+    __HAL_FLASH_DATA_CACHE_RESET();
+    __HAL_FLASH_DATA_CACHE_ENABLE();
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Erase pages of the rotation.
+  * @param  heeprom EEPROM emulation handle
+  * @param  Page index of the first page in the rotation
+  * @param  NbPages number of pages to erase
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef EEPROM_EMUL_ErasePages(EEPROM_EMUL_HandleTypeDef *heeprom, uint32_t Page, uint32_t NbPages)
+{
+  FLASH_EraseInitTypeDef erase;
+  uint32_t page_error;
+
+  erase.TypeErase = FLASH_TYPEERASE_PAGES;
+  erase.Banks     = heeprom->Init.Bank;
+  erase.Page      = heeprom->Init.StartPage + Page;
+  erase.NbPages   = NbPages;
+
+  return HAL_FLASHEx_Erase(&erase, &page_error);
+}
+
+/**
+  * @brief  Make sure that a page is fully erased before it receives a transfer.
+  * @param  heeprom EEPROM emulation handle
+  * @param  Page index of the page in the rotation
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef EEPROM_EMUL_PreparePage(EEPROM_EMUL_HandleTypeDef *heeprom, uint32_t Page)
+{
+  uint32_t address = EEPROM_EMUL_PageAddress(heeprom, Page);
+  uint32_t end = address + heeprom->Init.PageSize;
+
+  while (address < end)
+  {
+    if (*(__IO uint32_t *)address != 0xFFFFFFFFU)
+    {
+      return EEPROM_EMUL_ErasePages(heeprom, Page, 1U);
+    }
+    address += 4U;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Update the RAM index with the valid elements of a page.
+  * @note   The elements are scanned in programming order, so the last valid
+  *         element of each variable is kept. Elements with a wrong CRC, left by
+  *         an interrupted programming, are skipped.
+  * @param  heeprom EEPROM emulation handle
+  * @param  Page index of the page in the rotation
+  * @retval Address of the first free element of the page
+  */
+static uint32_t EEPROM_EMUL_ScanPage(EEPROM_EMUL_HandleTypeDef *heeprom, uint32_t Page)
+{
+  uint32_t address = EEPROM_EMUL_PageAddress(heeprom, Page) + EEPROM_EMUL_HEADER_SIZE;
+  uint32_t end = EEPROM_EMUL_PageAddress(heeprom, Page) + heeprom->Init.PageSize;
+  uint32_t virtaddress;
+  uint64_t element;
+
+  while (address < end)
+  {
+    element = EEPROM_EMUL_ReadElement(address);
+    if (element == 0xFFFFFFFFFFFFFFFFULL)
+    {
+      break;
+    }
+
+    virtaddress = (uint32_t)(element >> 32U) & 0xFFFFU;
+    if ((EEPROM_EMUL_IsElementValid(element) != 0U) && (virtaddress < heeprom->Init.NbVariables))
+    {
+      heeprom->Init.pIndex[virtaddress] = address;
+    }
+    address += EEPROM_EMUL_ELEMENT_SIZE;
+  }
+
+  return address;
+}
+
+/**
+  * @brief  Copy the variables of a page into the RECEIVE page and switch to it.
+  * @note   Only the variables whose last element is in the source page are copied,
+  *         so that an interrupted transfer can be resumed. The destination page is
+  *         then marked active, and the source page obsolete then erased.
+  * @param  heeprom EEPROM emulation handle, FreeAddress pointing in the destination page
+  * @param  SrcPage index of the full page in the rotation
+  * @param  DstPage index of the RECEIVE page in the rotation
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef EEPROM_EMUL_Transfer(EEPROM_EMUL_HandleTypeDef *heeprom, uint32_t SrcPage, uint32_t DstPage)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+  uint32_t srcstart = EEPROM_EMUL_PageAddress(heeprom, SrcPage);
+  uint32_t srcend = srcstart + heeprom->Init.PageSize;
+  uint32_t dstend = EEPROM_EMUL_PageAddress(heeprom, DstPage) + heeprom->Init.PageSize;
+  uint32_t address;
+  uint32_t index;
+
+  for (index = 0U; (index < heeprom->Init.NbVariables) && (status == HAL_OK); index++)
+  {
+    address = heeprom->Init.pIndex[index];
+    if ((address >= srcstart) && (address < srcend))
+    {
+      if (heeprom->FreeAddress >= dstend)
+      {
+        status = HAL_ERROR;
+      }
+      else
+      {
+        status = EEPROM_EMUL_Program(heeprom, heeprom->FreeAddress, EEPROM_EMUL_ReadElement(address));
+        if (status == HAL_OK)
+        {
+          heeprom->Init.pIndex[index] = heeprom->FreeAddress;
+          heeprom->FreeAddress += EEPROM_EMUL_ELEMENT_SIZE;
+        }
+      }
+    }
+  }
+
+  if (status == HAL_OK)
+  {
+    status = EEPROM_EMUL_SetPageState(heeprom, DstPage, EEPROM_EMUL_PAGE_ACTIVE, 0U);
+  }
+  if (status == HAL_OK)
+  {
+    heeprom->ActivePage = DstPage;
+    heeprom->Generation = (uint32_t)EEPROM_EMUL_ReadElement(EEPROM_EMUL_PageAddress(heeprom, DstPage));
+
+    status = EEPROM_EMUL_SetPageState(heeprom, SrcPage, EEPROM_EMUL_PAGE_OBSOLETE, 0U);
+  }
+  if (status == HAL_OK)
+  {
+    status = EEPROM_EMUL_ErasePages(heeprom, SrcPage, 1U);
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Restore the EEPROM emulation from the page states.
+  * @note   Two ACTIVE pages mean that the older one was not yet marked obsolete:
+  *         the page with the highest generation is kept. An ACTIVE and a RECEIVE
+  *         page mean that a transfer was interrupted: it is resumed.
+  * @param  heeprom EEPROM emulation handle
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef EEPROM_EMUL_Recover(EEPROM_EMUL_HandleTypeDef *heeprom)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+  uint32_t active = EEPROM_EMUL_NO_PAGE;
+  uint32_t older = EEPROM_EMUL_NO_PAGE;
+  uint32_t receive = EEPROM_EMUL_NO_PAGE;
+  uint32_t nbactive = 0U;
+  uint32_t nbreceive = 0U;
+  uint32_t generation;
+  uint32_t page;
+  uint32_t state;
+
+  for (page = 0U; (page < heeprom->Init.NbPages) && (status == HAL_OK); page++)
+  {
+    state = EEPROM_EMUL_GetPageState(heeprom, page);
+    if (state == EEPROM_EMUL_PAGE_OBSOLETE)
+    {
+      status = EEPROM_EMUL_ErasePages(heeprom, page, 1U);
+    }
+    else if (state == EEPROM_EMUL_PAGE_ACTIVE)
+    {
+      nbactive++;
+      if (active == EEPROM_EMUL_NO_PAGE)
+      {
+        active = page;
+      }
+      else
+      {
+        older = page;
+      }
+    }
+    else if (state == EEPROM_EMUL_PAGE_RECEIVE)
+    {
+      nbreceive++;
+      receive = page;
+    }
+    else
+    {
+      /* Erased page, prepared before use */
+    }
+  }
+
+  if (status != HAL_OK)
+  {
+    return status;
+  }
+
+  /* No valid layout: start from an empty emulation area */
+  if ((nbactive > 2U) || (nbreceive > 1U) || ((nbactive == 2U) && (nbreceive != 0U)) ||
+      ((nbactive == 0U) && (nbreceive == 0U)))
+  {
+    return EEPROM_EMUL_FormatPages(heeprom);
+  }
+
+  if (nbactive == 2U)
+  {
+    /* Keep the page with the highest generation, the other one was transferred */
+    if ((uint32_t)EEPROM_EMUL_ReadElement(EEPROM_EMUL_PageAddress(heeprom, older)) >
+        (uint32_t)EEPROM_EMUL_ReadElement(EEPROM_EMUL_PageAddress(heeprom, active)))
+    {
+      page = active;
+      active = older;
+      older = page;
+    }
+    status = EEPROM_EMUL_SetPageState(heeprom, older, EEPROM_EMUL_PAGE_OBSOLETE, 0U);
+    if (status == HAL_OK)
+    {
+      status = EEPROM_EMUL_ErasePages(heeprom, older, 1U);
+    }
+  }
+  else if (nbactive == 0U)
+  {
+    /* Format interrupted before the first page was marked active */
+    status = EEPROM_EMUL_SetPageState(heeprom, receive, EEPROM_EMUL_PAGE_ACTIVE, 0U);
+    active = receive;
+    receive = EEPROM_EMUL_NO_PAGE;
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+
+  if (status == HAL_OK)
+  {
+    generation = (uint32_t)EEPROM_EMUL_ReadElement(EEPROM_EMUL_PageAddress(heeprom, active));
+    heeprom->ActivePage = active;
+    heeprom->Generation = generation;
+    heeprom->FreeAddress = EEPROM_EMUL_ScanPage(heeprom, active);
+
+    if (receive != EEPROM_EMUL_NO_PAGE)
+    {
+      /* Interrupted transfer: the RECEIVE page holds the most recent elements */
+      heeprom->FreeAddress = EEPROM_EMUL_ScanPage(heeprom, receive);
+      status = EEPROM_EMUL_Transfer(heeprom, active, receive);
+    }
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Erase the emulation area and mark its first page active.
+  * @param  heeprom EEPROM emulation handle
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef EEPROM_EMUL_FormatPages(EEPROM_EMUL_HandleTypeDef *heeprom)
+{
+  HAL_StatusTypeDef status;
+  uint32_t index;
+
+  for (index = 0U; index < heeprom->Init.NbVariables; index++)
+  {
+    heeprom->Init.pIndex[index] = 0U;
+  }
+
+  status = EEPROM_EMUL_ErasePages(heeprom, 0U, heeprom->Init.NbPages);
+  if (status == HAL_OK)
+  {
+    status = EEPROM_EMUL_SetPageState(heeprom, 0U, EEPROM_EMUL_PAGE_RECEIVE, heeprom->Generation + 1U);
+  }
+  if (status == HAL_OK)
+  {
+    status = EEPROM_EMUL_SetPageState(heeprom, 0U, EEPROM_EMUL_PAGE_ACTIVE, 0U);
+  }
+  if (status == HAL_OK)
+  {
+    heeprom->ActivePage = 0U;
+    heeprom->Generation += 1U;
+    heeprom->FreeAddress = EEPROM_EMUL_PageAddress(heeprom, 0U) + EEPROM_EMUL_HEADER_SIZE;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Unlock the FLASH control register.
+  * @retval 1 if the FLASH control register was locked, 0 otherwise
+  */
+static uint32_t EEPROM_EMUL_FlashUnlock(void)
+{
+  uint32_t locked = (READ_BIT(FLASH->CR, FLASH_CR_LOCK) != 0U) ? 1U : 0U;
+
+  if (locked != 0U)
+  {
+    (void)HAL_FLASH_Unlock();
+  }
+
+  return locked;
+}
+
+/**
+  * @brief  Lock the FLASH control register again if it was locked.
+  * @param  Locked value returned by EEPROM_EMUL_FlashUnlock()
+  * @retval None
+  */
+static void EEPROM_EMUL_FlashRestore(uint32_t Locked)
+{
+  if (Locked != 0U)
+  {
+    (void)HAL_FLASH_Lock();
+  }
+}
+
+/**
+  * @}
+  */
+
+#endif /* HAL_EEPROM_EMUL_MODULE_ENABLED */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -46,6 +46,11 @@
            (++) There are two modes of programming :
             (+++) Polling mode using HAL_FLASH_Program() function
             (+++) Interrupt mode using HAL_FLASH_Program_IT() function
+           (++) Buffer program functions: HAL_FLASH_ProgramBuffer() and
+                HAL_FLASH_ProgramBuffer_IT() program a buffer of any length,
+                using fast programming for the erased rows it fully covers and
+                double word programming elsewhere. In interrupt mode a single
+                HAL_FLASH_EndOfOperationCallback() is called for the whole buffer
 
       (#) Interrupts and flags management functions:
            (++) Handle FLASH interrupts by calling HAL_FLASH_IRQHandler()
@@ -125,7 +130,10 @@ FLASH_ProcessTypeDef pFlash  = {.Lock = HAL_UNLOCKED,
                                 .Bank = FLASH_BANK_1,
                                 .Page = 0U,
                                 .NbPagesToErase = 0U,
-                                .CacheToReactivate = FLASH_CACHE_DISABLED};
+                                .CacheToReactivate = FLASH_CACHE_DISABLED,
+                                .BufferAddress = 0U,
+                                .DataAddress = 0U,
+                                .BufferSize = 0U};
 /**
   * @}
   */
@@ -136,6 +144,9 @@ FLASH_ProcessTypeDef pFlash  = {.Lock = HAL_UNLOCKED,
   */
 static void          FLASH_Program_DoubleWord(uint32_t Address, uint64_t Data);
 static void          FLASH_Program_Fast(uint32_t Address, uint32_t DataAddress);
+static uint32_t      FLASH_Program_BufferChunk(void);
+static uint32_t      FLASH_Program_BufferNext(void);
+static uint32_t      FLASH_Buffer_ChunkSize(uint32_t Address, uint32_t Remaining);
 /**
   * @}
   */
@@ -295,6 +306,135 @@ HAL_StatusTypeDef HAL_FLASH_Program_IT(uint32_t TypeProgram, uint32_t Address, u
   return status;
 }
 
+/**
+  * @brief  Program a buffer of any length at a specified address.
+  * @note   The buffer is programmed by fast programming for each 256-byte row it
+  *         fully covers in main memory, and by double word programming for the
+  *         unaligned head and tail. Only the programming of the whole buffer is
+  *         waited for by the caller.
+  * @note   The destination must be erased. A last incomplete double word is padded
+  *         with 0xFF and can not be programmed again before the next erase.
+  * @note   Fast programming requires the rows to be fully erased and the source
+  *         data to be available without wait (preferably in SRAM).
+  * @param  Address specifies the start address to be programmed.
+  *         This parameter must be aligned on a double word.
+  * @param  pData pointer to the data to be programmed, aligned on a word.
+  * @param  Size number of bytes to be programmed.
+  *
+  * @retval HAL_Status
+  */
+HAL_StatusTypeDef HAL_FLASH_ProgramBuffer(uint32_t Address, const uint8_t *pData, uint32_t Size)
+{
+  HAL_StatusTypeDef status;
+  uint32_t prog_bit;
+
+  /* Check the parameters */
+  assert_param(IS_FLASH_PROGRAM_ADDRESS(Address));
+  assert_param((Address & 0x7U) == 0U);
+  assert_param(((uint32_t)pData & 0x3U) == 0U);
+
+  if (Size == 0U)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Process Locked */
+  __HAL_LOCK(&pFlash);
+
+  /* Wait for last operation to be completed */
+  status = FLASH_WaitForLastOperation((uint32_t)FLASH_TIMEOUT_VALUE);
+
+  if (status == HAL_OK)
+  {
+    pFlash.ErrorCode = HAL_FLASH_ERROR_NONE;
+    pFlash.BufferAddress = Address;
+    pFlash.Address = Address;
+    pFlash.DataAddress = (uint32_t)pData;
+    pFlash.BufferSize = Size;
+
+    do
+    {
+      /* Program the next row or double word */
+      prog_bit = FLASH_Program_BufferChunk();
+
+      /* Wait for last operation to be completed */
+      status = FLASH_WaitForLastOperation((uint32_t)FLASH_TIMEOUT_VALUE);
+
+      /* If the program operation is completed, disable the PG or FSTPG Bit */
+      CLEAR_BIT(FLASH->CR, prog_bit);
+    }
+    while ((status == HAL_OK) && (FLASH_Program_BufferNext() != 0U));
+  }
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(&pFlash);
+
+  /* return status */
+  return status;
+}
+
+/**
+  * @brief  Program a buffer of any length at a specified address with interrupt enabled.
+  * @note   The programming sequence is the one of HAL_FLASH_ProgramBuffer(). Each row
+  *         or double word is started from HAL_FLASH_IRQHandler() and
+  *         HAL_FLASH_EndOfOperationCallback() is called once with the start address
+  *         when the whole buffer is programmed. On error,
+  *         HAL_FLASH_OperationErrorCallback() is called with the failing address.
+  * @note   The buffer must remain valid until the end of the operation.
+  * @param  Address specifies the start address to be programmed.
+  *         This parameter must be aligned on a double word.
+  * @param  pData pointer to the data to be programmed, aligned on a word.
+  * @param  Size number of bytes to be programmed.
+  *
+  * @retval HAL_Status
+  */
+HAL_StatusTypeDef HAL_FLASH_ProgramBuffer_IT(uint32_t Address, const uint8_t *pData, uint32_t Size)
+{
+  HAL_StatusTypeDef status;
+
+  /* Check the parameters */
+  assert_param(IS_FLASH_PROGRAM_ADDRESS(Address));
+  assert_param((Address & 0x7U) == 0U);
+  assert_param(((uint32_t)pData & 0x3U) == 0U);
+
+  if (Size == 0U)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Process Locked */
+  __HAL_LOCK(&pFlash);
+
+  /* Reset error code */
+  pFlash.ErrorCode = HAL_FLASH_ERROR_NONE;
+
+  /* Wait for last operation to be completed */
+  status = FLASH_WaitForLastOperation(FLASH_TIMEOUT_VALUE);
+
+  if (status != HAL_OK)
+  {
+    /* Process Unlocked */
+    __HAL_UNLOCK(&pFlash);
+  }
+  else
+  {
+    /* Set internal variables used by the IRQ handler */
+    pFlash.ProcedureOnGoing = FLASH_PROC_PROGRAM_BUFFER;
+    pFlash.BufferAddress = Address;
+    pFlash.Address = Address;
+    pFlash.DataAddress = (uint32_t)pData;
+    pFlash.BufferSize = Size;
+
+    /* Enable End of Operation and Error interrupts */
+    __HAL_FLASH_ENABLE_IT(FLASH_IT_EOP | FLASH_IT_OPERR);
+
+    /* Program the first row or double word */
+    (void)FLASH_Program_BufferChunk();
+  }
+
+  return status;
+}
+
 /**
   * @brief  Handle FLASH interrupt request.
   * @retval None
@@ -312,11 +452,24 @@ void HAL_FLASH_IRQHandler(void)
 #endif
 
   /* Disable the FSTPG Bit only if it is the last row programmed */
-  if (pFlash.ProcedureOnGoing == FLASH_PROC_PROGRAM_LAST)
+  if ((pFlash.ProcedureOnGoing == FLASH_PROC_PROGRAM_LAST) ||
+      (pFlash.ProcedureOnGoing == FLASH_PROC_PROGRAM_BUFFER))
   {
     CLEAR_BIT(FLASH->CR, FLASH_CR_FSTPG);
   }
 
+  /* Check FLASH ECC correction flags */
+#if defined (FLASH_OPTR_DBANK)
+  if ((READ_BIT(FLASH->ECCR, FLASH_ECCR_ECCIE) != 0U) &&
+      (READ_BIT(FLASH->ECCR, (FLASH_FLAG_ECCC | FLASH_FLAG_ECCC2)) != 0U))
+#else
+  if ((READ_BIT(FLASH->ECCR, FLASH_ECCR_ECCIE) != 0U) &&
+      (READ_BIT(FLASH->ECCR, FLASH_FLAG_ECCC) != 0U))
+#endif
+  {
+    FLASH_ECC_CorrectionHandler();
+  }
+
   /* Check FLASH operation error flags */
   error = (FLASH->SR & FLASH_FLAG_SR_ERRORS);
 
@@ -342,7 +495,8 @@ void HAL_FLASH_IRQHandler(void)
       HAL_FLASH_OperationErrorCallback(pFlash.Bank);
     }
     else if ((procedure == FLASH_PROC_PROGRAM) ||
-             (procedure == FLASH_PROC_PROGRAM_LAST))
+             (procedure == FLASH_PROC_PROGRAM_LAST) ||
+             (procedure == FLASH_PROC_PROGRAM_BUFFER))
     {
       HAL_FLASH_OperationErrorCallback(pFlash.Address);
     }
@@ -391,6 +545,27 @@ void HAL_FLASH_IRQHandler(void)
         HAL_FLASH_EndOfOperationCallback(pFlash.Page);
       }
     }
+    else if (pFlash.ProcedureOnGoing == FLASH_PROC_PROGRAM_BUFFER)
+    {
+      /* Check if there are still data to program */
+      if (FLASH_Program_BufferNext() != 0U)
+      {
+        /* Program the next row or double word */
+        (void)FLASH_Program_BufferChunk();
+      }
+      else
+      {
+        /* Stop the buffer program procedure */
+        pFlash.ProcedureOnGoing = FLASH_PROC_NONE;
+
+        /* Flush the caches to be sure of the data consistency */
+        FLASH_FlushCaches() ;
+
+        /* Buffer program ended. Return the start address of the buffer */
+        /* FLASH EOP interrupt user callback */
+        HAL_FLASH_EndOfOperationCallback(pFlash.BufferAddress);
+      }
+    }
     else
     {
       /* Flush the caches to be sure of the data consistency */
@@ -437,6 +612,7 @@ void HAL_FLASH_IRQHandler(void)
   *           @arg Page Erase: Page which has been erased
   *                            (if 0xFFFFFFFF, it means that all the selected pages have been erased)
   *           @arg Program: Address which was selected for data program
+  *           @arg Buffer program: Start address of the programmed buffer
   * @retval None
   */
 __weak void HAL_FLASH_EndOfOperationCallback(uint32_t ReturnValue)
@@ -455,6 +631,7 @@ __weak void HAL_FLASH_EndOfOperationCallback(uint32_t ReturnValue)
   *           @arg Mass Erase: Bank number which has been requested to erase
   *           @arg Page Erase: Page number which returned an error
   *           @arg Program: Address which was selected for data program
+  *           @arg Buffer program: Address of the row or double word which failed
   * @retval None
   */
 __weak void HAL_FLASH_OperationErrorCallback(uint32_t ReturnValue)
@@ -661,6 +838,9 @@ HAL_StatusTypeDef FLASH_WaitForLastOperation(uint32_t Timeout)
 
   while (__HAL_FLASH_GET_FLAG(FLASH_FLAG_BSY))
   {
+    /* Let the application yield or sleep while waiting */
+    HAL_WaitHook(HAL_WAIT_FLASH, NULL);
+
     if ((HAL_GetTick() - tickstart) > Timeout)
     {
       return HAL_TIMEOUT;
@@ -753,6 +933,98 @@ static void FLASH_Program_Fast(uint32_t Address, uint32_t DataAddress)
   __set_PRIMASK(primask_bit);
 }
 
+/**
+  * @brief  Start the programming of the current part of a buffer program.
+  * @note   The part starts at pFlash.Address, its size is given by
+  *         FLASH_Buffer_ChunkSize(). The started operation must then be completed.
+  * @retval Program bit to clear at the end of the operation (FLASH_CR_PG or FLASH_CR_FSTPG)
+  */
+static uint32_t FLASH_Program_BufferChunk(void)
+{
+  uint32_t address = pFlash.Address;
+  uint32_t offset = address - pFlash.BufferAddress;
+  uint32_t data_address = pFlash.DataAddress + offset;
+  uint32_t chunk = FLASH_Buffer_ChunkSize(address, pFlash.BufferSize - offset);
+  uint64_t data;
+  uint32_t index;
+  uint32_t prog_bit;
+
+  if (chunk > 8U)
+  {
+    /* Fast program a 32 row double-word (64-bit) */
+    FLASH_Program_Fast(address, data_address);
+    prog_bit = FLASH_CR_FSTPG;
+  }
+  else
+  {
+    if (chunk == 8U)
+    {
+      data = ((uint64_t)(*(uint32_t *)(data_address + 4U)) << 32U) | (*(uint32_t *)data_address);
+    }
+    else
+    {
+      /* Pad the last double word with the erased value */
+      data = 0xFFFFFFFFFFFFFFFFULL;
+      for (index = 0U; index < chunk; index++)
+      {
+        data &= ~((uint64_t)0xFFU << (8U * index));
+        data |= (uint64_t)(*(uint8_t *)(data_address + index)) << (8U * index);
+      }
+    }
+
+    /* Program double-word (64-bit) at a specified address */
+    FLASH_Program_DoubleWord(address, data);
+    prog_bit = FLASH_CR_PG;
+  }
+
+  return prog_bit;
+}
+
+/**
+  * @brief  Move a buffer program to its next part once the current one is completed.
+  * @retval Number of bytes remaining to be programmed
+  */
+static uint32_t FLASH_Program_BufferNext(void)
+{
+  uint32_t offset = pFlash.Address - pFlash.BufferAddress;
+  uint32_t remaining = pFlash.BufferSize - offset;
+
+  remaining -= FLASH_Buffer_ChunkSize(pFlash.Address, remaining);
+  pFlash.Address = pFlash.BufferAddress + (pFlash.BufferSize - remaining);
+
+  return remaining;
+}
+
+/**
+  * @brief  Get the size of the part of a buffer program starting at a specified address.
+  * @note   A full row is fast programmed when the address is row aligned in main
+  *         memory and at least a row remains, otherwise a double word is
+  *         programmed (padded with 0xFF when less than 8 bytes remain).
+  * @param  Address specifies the address of the part.
+  * @param  Remaining number of bytes remaining to be programmed from Address.
+  * @retval Number of bytes of the part
+  */
+static uint32_t FLASH_Buffer_ChunkSize(uint32_t Address, uint32_t Remaining)
+{
+  uint32_t row_size = FLASH_NB_DOUBLE_WORDS_IN_ROW * 8U;
+  uint32_t chunk;
+
+  if (((Address & (row_size - 1U)) == 0U) && (Remaining >= row_size) && IS_FLASH_MAIN_MEM_ADDRESS(Address))
+  {
+    chunk = row_size;
+  }
+  else if (Remaining >= 8U)
+  {
+    chunk = 8U;
+  }
+  else
+  {
+    chunk = Remaining;
+  }
+
+  return chunk;
+}
+
 /**
   * @}
   */
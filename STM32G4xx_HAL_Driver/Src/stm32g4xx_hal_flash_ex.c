@@ -54,6 +54,16 @@
       (#) Enable or disable debugger: Use HAL_FLASHEx_EnableDebugger() or
           HAL_FLASHEx_DisableDebugger()
 
+      (#) ECC monitoring: Use HAL_FLASHEx_EccMonitor_Start() to:
+        (++) Count the single ECC errors corrected per page, through the FLASH
+             interrupt (FLASH_IRQn must be enabled, HAL_FLASH_IRQHandler() handles it)
+        (++) Be notified with HAL_FLASHEx_EccRelocateCallback() when a page reaches
+             the relocation threshold, so that the filesystem or EEPROM emulation layer
+             moves its data before corrections turn into detections
+        (++) Log the double ECC errors: call HAL_FLASHEx_ECC_NMI_IRQHandler() from
+             NMI_Handler(), the address is logged, HAL_FLASHEx_EccDetectionCallback()
+             is called and the execution resumes
+
   @endverbatim
   ******************************************************************************
   * @attention
@@ -84,13 +94,18 @@
 
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
+#define FLASH_ECC_SYSTEM_FLASH_BASE  0x1FFF0000UL  /* System flash base address */
+
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
+static FLASH_EccMonitorTypeDef *pFlashEccMonitor = NULL;
+
 /* Private function prototypes -----------------------------------------------*/
 /** @defgroup FLASHEx_Private_Functions FLASHEx Private Functions
   * @{
   */
 static void              FLASH_MassErase(uint32_t Banks);
+static uint32_t          FLASH_ECC_GetAddress(uint32_t EccReg);
 static HAL_StatusTypeDef FLASH_OB_WRPConfig(uint32_t WRPArea, uint32_t WRPStartOffset, uint32_t WRDPEndOffset);
 static HAL_StatusTypeDef FLASH_OB_RDPConfig(uint32_t RDPLevel);
 static HAL_StatusTypeDef FLASH_OB_UserConfig(uint32_t UserType, uint32_t UserConfig);
@@ -514,6 +529,147 @@ void HAL_FLASHEx_DisableDebugger(void)
   FLASH->ACR &= ~FLASH_ACR_DBG_SWEN;
 }
 
+/**
+  * @}
+  */
+
+/** @defgroup FLASHEx_Exported_Functions_Group2 Extended ECC monitoring functions
+  * @brief   Extended ECC monitoring functions
+  *
+@verbatim
+ ===============================================================================
+                ##### Extended ECC monitoring functions #####
+ ===============================================================================
+    [..]
+    This subsection provides a set of functions allowing to monitor the FLASH
+    ECC single error corrections and double error detections.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Start the FLASH ECC monitoring.
+  * @note   The ECC correction interrupt is enabled, FLASH_IRQn must be enabled in the NVIC.
+  * @note   The counters of pMonitor are reset, pPageCount is cleared when provided.
+  * @param  pMonitor pointer to a FLASH_EccMonitorTypeDef structure, updated from
+  *         HAL_FLASH_IRQHandler() and HAL_FLASHEx_ECC_NMI_IRQHandler().
+  * @retval HAL Status
+  */
+HAL_StatusTypeDef HAL_FLASHEx_EccMonitor_Start(FLASH_EccMonitorTypeDef *pMonitor)
+{
+  uint32_t index;
+
+  if (pMonitor == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Detach the previous monitor while resetting the counters */
+  CLEAR_BIT(FLASH->ECCR, FLASH_ECCR_ECCIE);
+  pFlashEccMonitor = NULL;
+
+  pMonitor->CorrectionCount = 0U;
+  pMonitor->DetectionCount = 0U;
+  pMonitor->LastCorrectionAddress = 0xFFFFFFFFU;
+  pMonitor->LastDetectionAddress = 0xFFFFFFFFU;
+
+  if (pMonitor->pPageCount != NULL)
+  {
+    for (index = 0U; index < pMonitor->NbPages; index++)
+    {
+      pMonitor->pPageCount[index] = 0U;
+    }
+  }
+
+  pFlashEccMonitor = pMonitor;
+
+  /* Clear pending ECC flags and enable the correction interrupt */
+  WRITE_REG(FLASH->ECCR, (FLASH_FLAG_ECCR_ERRORS | FLASH_ECCR_ECCIE));
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop the FLASH ECC monitoring.
+  * @retval None
+  */
+void HAL_FLASHEx_EccMonitor_Stop(void)
+{
+  CLEAR_BIT(FLASH->ECCR, FLASH_ECCR_ECCIE);
+  pFlashEccMonitor = NULL;
+}
+
+/**
+  * @brief  Handle the FLASH ECC double error detection NMI.
+  * @note   This function must be called from NMI_Handler(). It logs the failing
+  *         address, clears the detection flag and returns, so that the execution resumes.
+  *         The data read at the failing address is not valid.
+  * @retval None
+  */
+void HAL_FLASHEx_ECC_NMI_IRQHandler(void)
+{
+  uint32_t eccr = FLASH->ECCR;
+  uint32_t address;
+
+#if defined (FLASH_OPTR_DBANK)
+  if ((eccr & (FLASH_FLAG_ECCD | FLASH_FLAG_ECCD2)) != 0U)
+#else
+  if ((eccr & FLASH_FLAG_ECCD) != 0U)
+#endif
+  {
+    address = FLASH_ECC_GetAddress(eccr);
+
+    if (pFlashEccMonitor != NULL)
+    {
+      pFlashEccMonitor->DetectionCount++;
+      pFlashEccMonitor->LastDetectionAddress = address;
+    }
+
+    /* Clear only the detection flags, ECCR flags are cleared by writing 1 */
+#if defined (FLASH_OPTR_DBANK)
+    WRITE_REG(FLASH->ECCR, ((eccr & FLASH_ECCR_ECCIE) | (eccr & (FLASH_FLAG_ECCD | FLASH_FLAG_ECCD2))));
+#else
+    WRITE_REG(FLASH->ECCR, ((eccr & FLASH_ECCR_ECCIE) | FLASH_FLAG_ECCD));
+#endif
+
+    HAL_FLASHEx_EccDetectionCallback(address);
+  }
+}
+
+/**
+  * @brief  FLASH ECC page relocation callback.
+  * @note   Called from HAL_FLASH_IRQHandler() when the number of corrections on a page
+  *         reaches the RelocateThreshold of the monitor.
+  * @param  PageAddress Start address of the page to relocate
+  * @retval None
+  */
+__weak void HAL_FLASHEx_EccRelocateCallback(uint32_t PageAddress)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(PageAddress);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_FLASHEx_EccRelocateCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  FLASH ECC double error detection callback.
+  * @note   Called from HAL_FLASHEx_ECC_NMI_IRQHandler(), i.e. in NMI context.
+  * @param  Address Address of the double ECC error
+  * @retval None
+  */
+__weak void HAL_FLASHEx_EccDetectionCallback(uint32_t Address)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(Address);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_FLASHEx_EccDetectionCallback could be implemented in the user file
+   */
+}
+
 /**
   * @}
   */
@@ -645,6 +801,86 @@ void FLASH_FlushCaches(void)
   pFlash.CacheToReactivate = FLASH_CACHE_DISABLED;
 }
 
+/**
+  * @brief  Handle the FLASH ECC single error correction interrupt.
+  * @note   Called from HAL_FLASH_IRQHandler(), updates the ECC monitor and clears
+  *         the correction flags.
+  * @retval None
+  */
+void FLASH_ECC_CorrectionHandler(void)
+{
+  uint32_t eccr = FLASH->ECCR;
+  uint32_t address;
+  uint32_t page_size;
+  uint32_t page;
+  FLASH_EccMonitorTypeDef *pmonitor = pFlashEccMonitor;
+
+  address = FLASH_ECC_GetAddress(eccr);
+
+  /* Clear only the correction flags, ECCR flags are cleared by writing 1 */
+#if defined (FLASH_OPTR_DBANK)
+  WRITE_REG(FLASH->ECCR, ((eccr & FLASH_ECCR_ECCIE) | (eccr & (FLASH_FLAG_ECCC | FLASH_FLAG_ECCC2))));
+#else
+  WRITE_REG(FLASH->ECCR, ((eccr & FLASH_ECCR_ECCIE) | FLASH_FLAG_ECCC));
+#endif
+
+  if (pmonitor != NULL)
+  {
+    pmonitor->CorrectionCount++;
+    pmonitor->LastCorrectionAddress = address;
+
+    /* System flash errors are only counted */
+    if ((pmonitor->pPageCount != NULL) && ((eccr & FLASH_ECCR_SYSF_ECC) == 0U))
+    {
+#if defined (FLASH_OPTR_DBANK)
+      page_size = (READ_BIT(FLASH->OPTR, FLASH_OPTR_DBANK) != 0U) ? FLASH_PAGE_SIZE : FLASH_PAGE_SIZE_128_BITS;
+#else
+      page_size = FLASH_PAGE_SIZE;
+#endif
+      page = (address - FLASH_BASE) / page_size;
+
+      if ((page < pmonitor->NbPages) && (pmonitor->pPageCount[page] != 0xFFFFU))
+      {
+        pmonitor->pPageCount[page]++;
+
+        if ((pmonitor->RelocateThreshold != 0U) && (pmonitor->pPageCount[page] == pmonitor->RelocateThreshold))
+        {
+          HAL_FLASHEx_EccRelocateCallback(FLASH_BASE + (page * page_size));
+        }
+      }
+    }
+  }
+}
+
+/**
+  * @brief  Get the address of the last ECC error.
+  * @param  EccReg Value of the ECCR register
+  * @retval Address of the ECC error
+  */
+static uint32_t FLASH_ECC_GetAddress(uint32_t EccReg)
+{
+  uint32_t address = EccReg & FLASH_ECCR_ADDR_ECC;
+
+  if ((EccReg & FLASH_ECCR_SYSF_ECC) != 0U)
+  {
+    /* Error in system flash */
+    address += FLASH_ECC_SYSTEM_FLASH_BASE;
+  }
+  else
+  {
+    address += FLASH_BASE;
+#if defined (FLASH_OPTR_DBANK)
+    /* ADDR_ECC is given by bank in dual bank mode */
+    if ((READ_BIT(FLASH->OPTR, FLASH_OPTR_DBANK) != 0U) && ((EccReg & FLASH_ECCR_BK_ECC) != 0U))
+    {
+      address += FLASH_BANK_SIZE;
+    }
+#endif
+  }
+
+  return address;
+}
+
 /**
   * @brief  Configure the write protection area into Option Bytes.
   * @note   When the memory read protection level is selected (RDP level = 1),
@@ -143,6 +143,41 @@
        (#) Call @ref HAL_FMAC_DeInit() to de-initialize the FMAC peripheral. This function
            resorts to @ref HAL_FMAC_MspDeInit() for low-level de-initialization.
 
+  ##### Coefficient banks and pipeline #####
+  ==================================
+
+    [..]
+      Several filters can share the internal memory (256 16-bit words): the input (X1)
+      and output (Y) buffers are configured once with @ref HAL_FMAC_FilterConfig(), and
+      each filter uses its own coefficient area (bank) described by a FMAC_CoeffBankTypeDef
+      structure. The X1 buffer must be big enough for the largest filter.
+
+      (#) Load the coefficients of each bank once using @ref HAL_FMAC_BankLoad(). The
+          coefficients stay in the internal memory until the next reset of the device
+          or a new load overwriting them.
+
+      (#) While the filter is stopped, switch to another bank using @ref HAL_FMAC_BankSelect().
+          Only the coefficient area and the filter parameters are updated: nothing is
+          reloaded and the next @ref HAL_FMAC_FilterStart() uses the selected filter.
+
+      (#) Run several filters in chain on a block of samples using @ref HAL_FMAC_PipelineStart_DMA().
+          The input and output accesses must be configured as FMAC_BUFFER_ACCESS_DMA.
+          Each FMAC_PipelineStageTypeDef stage selects its bank, streams its input vector into
+          FMAC and its output vector out of FMAC by DMA. When the output vector of a stage is
+          filled, the filter is stopped and the next stage is started from the DMA interrupt.
+          The input vector of a stage can be the output vector of the previous stage, so
+          that no copy is done by the CPU between the stages.
+          @ref HAL_FMAC_PipelineCpltCallback() is called when the last stage is complete,
+          the output vector of the last stage can then be converted by the DAC with its own
+          DMA (e.g. @ref HAL_DAC_Start_DMA()). @ref HAL_FMAC_GetDataCallback() and
+          @ref HAL_FMAC_HalfOutputDataReadyCallback() are still called for each stage.
+
+      (#) The X1 and Y pointers are reset between two stages: the filter history is not kept
+          from one stage or one block to the next one. OutputSize must be the number of
+          samples produced by the stage, e.g. (InputSize - P + 1) for a FIR filter.
+
+      (#) Stop a running pipeline using @ref HAL_FMAC_PipelineStop().
+
   ##### Callback registration #####
   ==================================
 
@@ -160,6 +195,7 @@
       (+) OutputDataReadyCallback     : Output Data Ready Callback.
       (+) FilterConfigCallback        : Filter Configuration Callback.
       (+) FilterPreloadCallback       : Filter Preload Callback.
+      (+) PipelineCpltCallback        : Pipeline Complete Callback.
       (+) MspInitCallback             : FMAC MspInit.
       (+) MspDeInitCallback           : FMAC MspDeInit.
       This function takes as parameters the HAL peripheral handle, the Callback ID
@@ -178,6 +214,7 @@
       (+) OutputDataReadyCallback     : Output Data Ready Callback.
       (+) FilterConfigCallback        : Filter Configuration Callback.
       (+) FilterPreloadCallback       : Filter Preload Callback.
+      (+) PipelineCpltCallback        : Pipeline Complete Callback.
       (+) MspInitCallback             : FMAC MspInit.
       (+) MspDeInitCallback           : FMAC MspDeInit.
 
@@ -338,6 +375,9 @@ static HAL_StatusTypeDef FMAC_FilterPreload(FMAC_HandleTypeDef *hfmac, int16_t *
                                             int16_t *pOutput, uint8_t OutputSize, uint8_t PreloadAccess);
 static void FMAC_WritePreloadDataIncrementPtr(FMAC_HandleTypeDef *hfmac, int16_t **ppData, uint8_t Size);
 static HAL_StatusTypeDef FMAC_WaitOnStartUntilTimeout(FMAC_HandleTypeDef *hfmac, uint32_t Tickstart, uint32_t Timeout);
+static void FMAC_BankSelect(FMAC_HandleTypeDef *hfmac, const FMAC_CoeffBankTypeDef *pBank);
+static HAL_StatusTypeDef FMAC_PipelineStageStart(FMAC_HandleTypeDef *hfmac);
+static void FMAC_PipelineStageCplt(FMAC_HandleTypeDef *hfmac);
 static HAL_StatusTypeDef FMAC_AppendFilterDataUpdateState(FMAC_HandleTypeDef *hfmac, int16_t *pInput,
                                                           uint16_t *pInputSize);
 static HAL_StatusTypeDef FMAC_ConfigFilterOutputBufferUpdateState(FMAC_HandleTypeDef *hfmac, int16_t *pOutput,
@@ -411,6 +451,7 @@ HAL_StatusTypeDef HAL_FMAC_Init(FMAC_HandleTypeDef *hfmac)
     hfmac->OutputDataReadyCallback = HAL_FMAC_OutputDataReadyCallback;
     hfmac->FilterConfigCallback = HAL_FMAC_FilterConfigCallback;
     hfmac->FilterPreloadCallback = HAL_FMAC_FilterPreloadCallback;
+    hfmac->PipelineCpltCallback = HAL_FMAC_PipelineCpltCallback;
 
     if (hfmac->MspInitCallback == NULL)
     {
@@ -429,6 +470,10 @@ HAL_StatusTypeDef HAL_FMAC_Init(FMAC_HandleTypeDef *hfmac)
   hfmac->FilterParam = 0U;
   FMAC_ResetDataPointers(hfmac);
 
+  /* Reset the pipeline */
+  hfmac->pStage = NULL;
+  hfmac->NbStagesLeft = 0U;
+
   /* Reset FMAC unit (internal pointers) */
   if (FMAC_Reset(hfmac) == HAL_TIMEOUT)
   {
@@ -544,6 +589,7 @@ __weak void HAL_FMAC_MspDeInit(FMAC_HandleTypeDef *hfmac)
   *           @arg @ref HAL_FMAC_OUTPUT_DATA_READY_CB_ID Output Data Ready Callback ID
   *           @arg @ref HAL_FMAC_FILTER_CONFIG_CB_ID Filter Configuration Callback ID
   *           @arg @ref HAL_FMAC_FILTER_PRELOAD_CB_ID Filter Preload Callback ID
+  *           @arg @ref HAL_FMAC_PIPELINE_CPLT_CB_ID Pipeline Complete Callback ID
   *           @arg @ref HAL_FMAC_MSPINIT_CB_ID FMAC MspInit ID
   *           @arg @ref HAL_FMAC_MSPDEINIT_CB_ID FMAC MspDeInit ID
   * @param  pCallback pointer to the Callback function.
@@ -601,6 +647,10 @@ HAL_StatusTypeDef HAL_FMAC_RegisterCallback(FMAC_HandleTypeDef *hfmac, HAL_FMAC_
         hfmac->FilterPreloadCallback = pCallback;
         break;
 
+      case HAL_FMAC_PIPELINE_CPLT_CB_ID :
+        hfmac->PipelineCpltCallback = pCallback;
+        break;
+
       case HAL_FMAC_MSPINIT_CB_ID :
         hfmac->MspInitCallback = pCallback;
         break;
@@ -715,6 +765,10 @@ HAL_StatusTypeDef HAL_FMAC_UnRegisterCallback(FMAC_HandleTypeDef *hfmac, HAL_FMA
         hfmac->FilterPreloadCallback = HAL_FMAC_FilterPreloadCallback;             /* Legacy weak FilterPreloadCallback       */
         break;
 
+      case HAL_FMAC_PIPELINE_CPLT_CB_ID :
+        hfmac->PipelineCpltCallback = HAL_FMAC_PipelineCpltCallback;               /* Legacy weak PipelineCpltCallback        */
+        break;
+
       case HAL_FMAC_MSPINIT_CB_ID :
         hfmac->MspInitCallback = HAL_FMAC_MspInit;                                 /* Legacy weak MspInitCallback             */
         break;
@@ -786,6 +840,8 @@ HAL_StatusTypeDef HAL_FMAC_UnRegisterCallback(FMAC_HandleTypeDef *hfmac, HAL_FMA
       (+) Handle the input data that will be provided into FMAC.
       (+) Handle the output data provided by FMAC.
       (+) Stop the FMAC processing (filter).
+      (+) Load coefficient banks kept in the internal memory and switch between them.
+      (+) Run several filters in chain by DMA (pipeline).
 
 @endverbatim
   * @{
@@ -1259,6 +1315,230 @@ HAL_StatusTypeDef HAL_FMAC_FilterStop(FMAC_HandleTypeDef *hfmac)
   return status;
 }
 
+/**
+  * @brief  Load the coefficients of a bank into the FMAC internal memory.
+  * @note   The coefficients are written in polling mode at the bank location and stay
+  *         in the internal memory: the filter of the bank can then be selected with
+  *         @ref HAL_FMAC_BankSelect() without reloading them.
+  * @note   The current coefficient area (X2) configuration is kept.
+  * @param  hfmac pointer to a FMAC_HandleTypeDef structure that contains
+  *         the configuration information for FMAC module.
+  * @param  pBank pointer to a FMAC_CoeffBankTypeDef structure describing the bank.
+  * @param  pCoeffB Coefficient vector B.
+  * @param  CoeffBSize Size of the coefficient vector B.
+  * @param  pCoeffA [IIR only] Coefficient vector A, NULL for a FIR filter.
+  * @param  CoeffASize Size of the coefficient vector A, 0 for a FIR filter.
+  * @retval HAL_StatusTypeDef HAL status
+  */
+HAL_StatusTypeDef HAL_FMAC_BankLoad(FMAC_HandleTypeDef *hfmac, const FMAC_CoeffBankTypeDef *pBank,
+                                    int16_t *pCoeffB, uint8_t CoeffBSize, int16_t *pCoeffA, uint8_t CoeffASize)
+{
+  uint32_t tickstart;
+  uint32_t x2bufcfg;
+  int16_t *pcoeff;
+
+  /* Check the function parameters */
+  if ((pBank == NULL) || (pCoeffB == NULL) || (CoeffBSize == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the parameters */
+  assert_param(IS_FMAC_COEFF_BANK(pBank->CoeffBaseAddress, pBank->CoeffBufferSize));
+  assert_param(IS_FMAC_FILTER_FUNCTION(pBank->Filter));
+  assert_param(IS_FMAC_COEFF_BANK_SIZE(pBank));
+  /* The provided coefficients should match the bank size and the filter parameters */
+  assert_param(((uint32_t)CoeffASize + (uint32_t)CoeffBSize) <= pBank->CoeffBufferSize);
+  assert_param(CoeffBSize >= pBank->P);
+  assert_param(((pBank->Filter == FMAC_FUNC_CONVO_FIR) && (pCoeffA == NULL) && (CoeffASize == 0U)) ||
+               ((pBank->Filter == FMAC_FUNC_IIR_DIRECT_FORM_1) &&
+                (pCoeffA != NULL) && (CoeffASize >= pBank->Q)));
+
+  /* Check the START bit state */
+  if (FMAC_GET_START_BIT(hfmac) != 0U)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check handle state is ready */
+  if (hfmac->State != HAL_FMAC_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  /* Change the FMAC state */
+  hfmac->State = HAL_FMAC_STATE_BUSY;
+
+  /* Get tick */
+  tickstart = HAL_GetTick();
+
+  /* FMAC_X2BUFCFG: Move the coefficient area to the bank during the load */
+  x2bufcfg = READ_REG(hfmac->Instance->X2BUFCFG);
+  MODIFY_REG(hfmac->Instance->X2BUFCFG,                                                                   \
+             (FMAC_X2BUFCFG_X2_BASE | FMAC_X2BUFCFG_X2_BUF_SIZE),                                         \
+             (((((uint32_t)(pBank->CoeffBaseAddress)) << FMAC_X2BUFCFG_X2_BASE_Pos)     & FMAC_X2BUFCFG_X2_BASE) | \
+              ((((uint32_t)(pBank->CoeffBufferSize))  << FMAC_X2BUFCFG_X2_BUF_SIZE_Pos) & FMAC_X2BUFCFG_X2_BUF_SIZE)));
+
+  /* Write number of values to be loaded, the data load function and start the operation */
+  WRITE_REG(hfmac->Instance->PARAM,                      \
+            (((uint32_t)(CoeffBSize) << FMAC_PARAM_P_Pos) | \
+             ((uint32_t)(CoeffASize) << FMAC_PARAM_Q_Pos) | \
+             FMAC_FUNC_LOAD_X2 | FMAC_PARAM_START));
+
+  /* Load the buffers into the internal memory */
+  pcoeff = pCoeffB;
+  FMAC_WritePreloadDataIncrementPtr(hfmac, &pcoeff, CoeffBSize);
+  if ((pCoeffA != NULL) && (CoeffASize != 0U))
+  {
+    pcoeff = pCoeffA;
+    FMAC_WritePreloadDataIncrementPtr(hfmac, &pcoeff, CoeffASize);
+  }
+
+  /* Wait for the end of the writing */
+  if (FMAC_WaitOnStartUntilTimeout(hfmac, tickstart, HAL_FMAC_TIMEOUT_VALUE) != HAL_OK)
+  {
+    hfmac->ErrorCode |= HAL_FMAC_ERROR_TIMEOUT;
+    hfmac->State = HAL_FMAC_STATE_TIMEOUT;
+    return HAL_TIMEOUT;
+  }
+
+  /* FMAC_X2BUFCFG: Restore the coefficient area of the current filter */
+  WRITE_REG(hfmac->Instance->X2BUFCFG, x2bufcfg);
+
+  /* Change the FMAC state */
+  hfmac->State = HAL_FMAC_STATE_READY;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Select the coefficient bank used by the next filter start.
+  * @note   The coefficients of the bank must have been loaded with @ref HAL_FMAC_BankLoad().
+  *         Only the coefficient area (X2) and the filter parameters are updated; the input
+  *         and output buffers, thresholds, clip and accesses of the last
+  *         @ref HAL_FMAC_FilterConfig() are kept.
+  * @param  hfmac pointer to a FMAC_HandleTypeDef structure that contains
+  *         the configuration information for FMAC module.
+  * @param  pBank pointer to a FMAC_CoeffBankTypeDef structure describing the bank.
+  * @retval HAL_StatusTypeDef HAL status
+  */
+HAL_StatusTypeDef HAL_FMAC_BankSelect(FMAC_HandleTypeDef *hfmac, const FMAC_CoeffBankTypeDef *pBank)
+{
+  /* Check the function parameters */
+  if (pBank == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the START bit state */
+  if (FMAC_GET_START_BIT(hfmac) != 0U)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check handle state is ready */
+  if (hfmac->State != HAL_FMAC_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  FMAC_BankSelect(hfmac, pBank);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Start a pipeline of filters on blocks of samples, with DMA.
+  * @note   The stages are run one after the other: each stage selects its coefficient
+  *         bank, then its input and output vectors are streamed by the input and output
+  *         DMA channels. The next stage is started from the output DMA interrupt and
+  *         @ref HAL_FMAC_PipelineCpltCallback() is called at the end of the last stage.
+  * @note   The input and output accesses must have been configured as
+  *         FMAC_BUFFER_ACCESS_DMA with @ref HAL_FMAC_FilterConfig().
+  * @param  hfmac pointer to a FMAC_HandleTypeDef structure that contains
+  *         the configuration information for FMAC module.
+  * @param  pStages Array of stages. It must be kept by the application until the end
+  *         of the pipeline.
+  * @param  NbStages Number of stages.
+  * @retval HAL_StatusTypeDef HAL status
+  */
+HAL_StatusTypeDef HAL_FMAC_PipelineStart_DMA(FMAC_HandleTypeDef *hfmac, FMAC_PipelineStageTypeDef *pStages,
+                                             uint32_t NbStages)
+{
+  HAL_StatusTypeDef status;
+  uint32_t index;
+
+  /* Check the function parameters */
+  if ((pStages == NULL) || (NbStages == 0U))
+  {
+    return HAL_ERROR;
+  }
+  for (index = 0U; index < NbStages; index++)
+  {
+    if ((pStages[index].pBank == NULL) || (pStages[index].pInput == NULL) || (pStages[index].InputSize == 0U) ||
+        (pStages[index].pOutput == NULL) || (pStages[index].OutputSize == 0U))
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  /* Check the FMAC configuration */
+  if ((hfmac->InputAccess != FMAC_BUFFER_ACCESS_DMA) || (hfmac->OutputAccess != FMAC_BUFFER_ACCESS_DMA))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the START bit state */
+  if (FMAC_GET_START_BIT(hfmac) != 0U)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check handle state is ready and that no pipeline is running */
+  if ((hfmac->State != HAL_FMAC_STATE_READY) || (hfmac->pStage != NULL))
+  {
+    return HAL_BUSY;
+  }
+
+  /* Start the first stage */
+  hfmac->pStage = pStages;
+  hfmac->NbStagesLeft = NbStages;
+
+  status = FMAC_PipelineStageStart(hfmac);
+  if (status != HAL_OK)
+  {
+    hfmac->pStage = NULL;
+    hfmac->NbStagesLeft = 0U;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Stop a running pipeline of filters.
+  * @param  hfmac pointer to a FMAC_HandleTypeDef structure that contains
+  *         the configuration information for FMAC module.
+  * @retval HAL_StatusTypeDef HAL status
+  */
+HAL_StatusTypeDef HAL_FMAC_PipelineStop(FMAC_HandleTypeDef *hfmac)
+{
+  /* Stop chaining the stages */
+  hfmac->pStage = NULL;
+  hfmac->NbStagesLeft = 0U;
+
+  /* Abort the DMA transfers of the current stage */
+  if (hfmac->hdmaIn->State == HAL_DMA_STATE_BUSY)
+  {
+    (void)HAL_DMA_Abort(hfmac->hdmaIn);
+  }
+  if (hfmac->hdmaOut->State == HAL_DMA_STATE_BUSY)
+  {
+    (void)HAL_DMA_Abort(hfmac->hdmaOut);
+  }
+
+  return HAL_FMAC_FilterStop(hfmac);
+}
+
 /**
   * @}
   */
@@ -1393,6 +1673,22 @@ __weak void HAL_FMAC_FilterPreloadCallback(FMAC_HandleTypeDef *hfmac)
    */
 }
 
+/**
+  * @brief  FMAC pipeline complete callback.
+  * @param  hfmac pointer to a FMAC_HandleTypeDef structure that contains
+  *         the configuration information for FMAC module.
+  * @retval None
+  */
+__weak void HAL_FMAC_PipelineCpltCallback(FMAC_HandleTypeDef *hfmac)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hfmac);
+
+  /* NOTE : This function should not be modified; when the callback is needed,
+            the HAL_FMAC_PipelineCpltCallback can be implemented in the user file.
+   */
+}
+
 /**
   * @}
   */
@@ -2041,6 +2337,116 @@ static HAL_StatusTypeDef FMAC_WaitOnStartUntilTimeout(FMAC_HandleTypeDef *hfmac,
   return HAL_OK;
 }
 
+/**
+  * @brief  Select a coefficient bank and build the matching filter parameters.
+  * @param  hfmac FMAC handle.
+  * @param  pBank Coefficient bank.
+  * @retval None
+  */
+static void FMAC_BankSelect(FMAC_HandleTypeDef *hfmac, const FMAC_CoeffBankTypeDef *pBank)
+{
+  /* Check the parameters */
+  assert_param(IS_FMAC_COEFF_BANK(pBank->CoeffBaseAddress, pBank->CoeffBufferSize));
+  assert_param(IS_FMAC_FILTER_FUNCTION(pBank->Filter));
+  assert_param(IS_FMAC_PARAM_P(pBank->Filter, pBank->P));
+  assert_param(IS_FMAC_PARAM_Q(pBank->Filter, pBank->Q));
+  assert_param(IS_FMAC_PARAM_R(pBank->Filter, pBank->R));
+  assert_param(IS_FMAC_COEFF_BANK_SIZE(pBank));
+
+  /* FMAC_X2BUFCFG: Point the coefficient buffer to the bank */
+  MODIFY_REG(hfmac->Instance->X2BUFCFG,                                                                   \
+             (FMAC_X2BUFCFG_X2_BASE | FMAC_X2BUFCFG_X2_BUF_SIZE),                                         \
+             (((((uint32_t)(pBank->CoeffBaseAddress)) << FMAC_X2BUFCFG_X2_BASE_Pos)     & FMAC_X2BUFCFG_X2_BASE) | \
+              ((((uint32_t)(pBank->CoeffBufferSize))  << FMAC_X2BUFCFG_X2_BUF_SIZE_Pos) & FMAC_X2BUFCFG_X2_BUF_SIZE)));
+
+  /* Build the PARAM value that will be used when starting the filter */
+  hfmac->FilterParam = (FMAC_PARAM_START | pBank->Filter |                   \
+                        ((((uint32_t)(pBank->P)) << FMAC_PARAM_P_Pos) & FMAC_PARAM_P) | \
+                        ((((uint32_t)(pBank->Q)) << FMAC_PARAM_Q_Pos) & FMAC_PARAM_Q) | \
+                        ((((uint32_t)(pBank->R)) << FMAC_PARAM_R_Pos) & FMAC_PARAM_R));
+}
+
+/**
+  * @brief  Start the current pipeline stage.
+  * @param  hfmac FMAC handle.
+  * @retval HAL_StatusTypeDef HAL status
+  */
+static HAL_StatusTypeDef FMAC_PipelineStageStart(FMAC_HandleTypeDef *hfmac)
+{
+  FMAC_PipelineStageTypeDef *pstage = hfmac->pStage;
+  HAL_StatusTypeDef status;
+
+  /* Select the filter of the stage, its coefficients are already in the internal memory */
+  FMAC_BankSelect(hfmac, pstage->pBank);
+
+  /* Start the filter with the output DMA, then feed it with the input DMA */
+  status = HAL_FMAC_FilterStart(hfmac, pstage->pOutput, &(pstage->OutputSize));
+  if (status == HAL_OK)
+  {
+    status = HAL_FMAC_AppendFilterData(hfmac, pstage->pInput, &(pstage->InputSize));
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Complete the current pipeline stage and start the next one.
+  * @param  hfmac FMAC handle.
+  * @retval None
+  */
+static void FMAC_PipelineStageCplt(FMAC_HandleTypeDef *hfmac)
+{
+  HAL_StatusTypeDef status;
+
+  /* Abort the input DMA if some input samples were not needed */
+  if (hfmac->hdmaIn->State == HAL_DMA_STATE_BUSY)
+  {
+    (void)HAL_DMA_Abort(hfmac->hdmaIn);
+  }
+
+  /* Stop the filter of the stage */
+  status = HAL_FMAC_FilterStop(hfmac);
+
+  if (status == HAL_OK)
+  {
+    hfmac->NbStagesLeft--;
+
+    if (hfmac->NbStagesLeft == 0U)
+    {
+      hfmac->pStage = NULL;
+
+      /* Call pipeline complete callback */
+#if (USE_HAL_FMAC_REGISTER_CALLBACKS == 1)
+      hfmac->PipelineCpltCallback(hfmac);
+#else
+      HAL_FMAC_PipelineCpltCallback(hfmac);
+#endif /* USE_HAL_FMAC_REGISTER_CALLBACKS */
+      return;
+    }
+
+    /* Start the next stage */
+    hfmac->pStage++;
+    status = FMAC_PipelineStageStart(hfmac);
+  }
+
+  if (status != HAL_OK)
+  {
+    hfmac->pStage = NULL;
+    hfmac->NbStagesLeft = 0U;
+
+    /* Set FMAC handle state and error code */
+    hfmac->State = HAL_FMAC_STATE_ERROR;
+    hfmac->ErrorCode |= HAL_FMAC_ERROR_DMA;
+
+    /* Call user callback */
+#if (USE_HAL_FMAC_REGISTER_CALLBACKS == 1)
+    hfmac->ErrorCallback(hfmac);
+#else
+    HAL_FMAC_ErrorCallback(hfmac);
+#endif /* USE_HAL_FMAC_REGISTER_CALLBACKS */
+  }
+}
+
 /**
   * @brief  Register the new input buffer, update DMA configuration if needed and change the FMAC state.
   * @param  hfmac pointer to a FMAC_HandleTypeDef structure that contains
@@ -2332,12 +2738,20 @@ static void FMAC_DMAOutputDataReady(DMA_HandleTypeDef *hdma)
   /* Reset the pointers to indicate new data will be needed */
   FMAC_ResetOutputStateAndDataPointers(hfmac);
 
-  /* Call output data ready callback */
+  if (hfmac->pStage != NULL)
+  {
+    /* The output vector of the pipeline stage is filled: go to the next stage */
+    FMAC_PipelineStageCplt(hfmac);
+  }
+  else
+  {
+    /* Call output data ready callback */
 #if (USE_HAL_FMAC_REGISTER_CALLBACKS == 1)
-  hfmac->OutputDataReadyCallback(hfmac);
+    hfmac->OutputDataReadyCallback(hfmac);
 #else
-  HAL_FMAC_OutputDataReadyCallback(hfmac);
+    HAL_FMAC_OutputDataReadyCallback(hfmac);
 #endif /* USE_HAL_FMAC_REGISTER_CALLBACKS */
+  }
 }
 
 /**
@@ -0,0 +1,644 @@
+/**
+  ******************************************************************************
+  * @file    stm32g4xx_hal_foc.c
+  * @author  MCD Application Team
+  * @brief   FOC current loop HAL module driver.
+  *          This file provides firmware functions to run the current loop of a
+  *          field-oriented motor control in a single interrupt:
+  *           + Initialization and de-initialization functions
+  *           + Start, stop, references and IRQ handler functions
+  *           + State and error functions
+  *
+  @verbatim
+  ==============================================================================
+                  ##### FOC current loop features #####
+  ==============================================================================
+  [..]
+    (+) The loop is chained to the end of the injected sequence of the ADC,
+        itself triggered by the PWM timer. HAL_FOC_IRQHandler() accesses the
+        ADC, CORDIC and timer registers directly, without going through the
+        HAL ADC, CORDIC and TIM functions and their state checks:
+        (++) the sine and cosine of the electrical angle are requested to the
+             CORDIC first, so that they are computed while the phase currents
+             are read and the Clarke transform is done;
+        (++) the Park transform, the d and q PI controllers (with anti-windup)
+             and the inverse Park and Clarke transforms are done in Q15 fixed
+             point;
+        (++) a min-max zero sequence is added to the phase voltages, giving the
+             same linear range as a space vector modulation, and the duty cycles
+             are written to the compare registers of channels 1, 2 and 3.
+
+    (+) The cost of each loop is measured with the DWT cycle counter and kept in
+        the LastCycles and MaxCycles fields of the handle. FOC_CYCLE_BUDGET is
+        the budget targeted to run the loop at 100 kHz on a 170 MHz device.
+
+  ==============================================================================
+                        ##### How to use this driver #####
+  ==============================================================================
+  [..]
+    (#) Initialize the ADC with the phase A and phase B currents on injected
+        ranks 1 and 2, triggered by the PWM timer (TIM1 TRGO2 on the update
+        event for instance). Enable the ADC interrupt in the NVIC with the
+        highest priority of the application.
+
+    (#) Initialize the CORDIC with HAL_CORDIC_Init(), which enables its clock.
+        Its configuration is overwritten by HAL_FOC_Start().
+
+    (#) Initialize the PWM timer in center-aligned mode and start channels 1,
+        2 and 3 (and their complementary outputs) with a 50% duty cycle.
+
+    (#) Fill the "Init" field of a FOC_HandleTypeDef handle with the ADC and
+        timer handles, the current offsets measured with the PWM at 50%, the
+        controller gains and the voltage limit, then call HAL_FOC_Init().
+
+    (#) Call HAL_FOC_IRQHandler() from the ADC IRQ handler instead of
+        HAL_ADC_IRQHandler(), as the first statement.
+
+    (#) Call HAL_FOC_Start(). Set the current references with
+        HAL_FOC_SetCurrentReference() and the electrical angle with
+        HAL_FOC_SetAngle() from the speed or position loop, called from
+        HAL_FOC_LoopCallback() every CallbackDivider loops or from a slower
+        interrupt.
+
+    (#) Call HAL_FOC_Stop() to stop the loop. The duty cycles are set back to
+        50%, the PWM timer is left running.
+
+    [..]
+      (@) The ADC may not raise other interrupts while the loop runs: the regular
+          group has to be used in polling or DMA mode.
+      (@) For a deterministic duration, the ART accelerator must be enabled or
+          this driver must be executed from the CCM SRAM.
+      (@) A loop still running when the next injected sequence ends is counted in
+          OverrunCount: HAL_FOC_ErrorCallback() is called with the
+          HAL_FOC_ERROR_OVERRUN error code.
+
+  @endverbatim
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                       opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32g4xx_hal.h"
+
+/** @addtogroup STM32G4xx_HAL_Driver
+  * @{
+  */
+
+/** @defgroup FOC FOC
+  * @brief FOC current loop HAL module driver
+  * @{
+  */
+
+#ifdef HAL_FOC_MODULE_ENABLED
+
+#if defined(CORDIC) && defined(HAL_ADC_MODULE_ENABLED) && defined(HAL_TIM_MODULE_ENABLED)
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/** @defgroup FOC_Private_Constants FOC Private Constants
+  * @{
+  */
+#define FOC_ONE_OVER_SQRT3      18919         /* 1/sqrt(3) in Q15                         */
+#define FOC_SQRT3_BY_2          28378         /* sqrt(3)/2 in Q15                         */
+#define FOC_ADC_TO_Q15_SHIFT    4U            /* 12-bit ADC codes to Q15                  */
+
+/* CORDIC sine and cosine, 32-bit arguments and results, two results read */
+#define FOC_CORDIC_CONFIG       (CORDIC_FUNCTION_COSINE | CORDIC_PRECISION_6CYCLES | CORDIC_SCALE_0 | \
+                                 CORDIC_NBWRITE_1 | CORDIC_NBREAD_2 | CORDIC_INSIZE_32BITS |         \
+                                 CORDIC_OUTSIZE_32BITS)
+/**
+  * @}
+  */
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+/** @defgroup FOC_Private_Functions FOC Private Functions
+  * @{
+  */
+__STATIC_INLINE int32_t FOC_PIController(int32_t *pIntegral, int32_t Error, int32_t Kp, int32_t Ki, int32_t Limit);
+/**
+  * @}
+  */
+
+/* Exported functions --------------------------------------------------------*/
+/** @defgroup FOC_Exported_Functions FOC Exported Functions
+  * @{
+  */
+
+/** @defgroup FOC_Exported_Functions_Group1 Initialization and de-initialization functions
+  *  @brief    Initialization and de-initialization functions
+  *
+@verbatim
+ ===============================================================================
+         ##### Initialization and de-initialization functions #####
+ ===============================================================================
+    [..]
+    This subsection provides functions allowing to initialize and de-initialize
+    the current loop. The ADC, CORDIC and timer are initialized by the
+    application.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Initialize the current loop.
+  * @param  hfoc FOC handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_FOC_Init(FOC_HandleTypeDef *hfoc)
+{
+  /* Check the FOC handle allocation */
+  if (hfoc == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  if ((hfoc->Init.hadc == NULL) || (hfoc->Init.htim == NULL) ||
+      (hfoc->Init.Kp < 0) || (hfoc->Init.Kp > 32767) || (hfoc->Init.Ki < 0) || (hfoc->Init.Ki > 32767) ||
+      (hfoc->Init.VoltageLimit <= 0) || (hfoc->Init.VoltageLimit > 32767))
+  {
+    hfoc->ErrorCode = HAL_FOC_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  if (hfoc->State == HAL_FOC_STATE_RESET)
+  {
+    /* Allocate lock resource and initialize it */
+    hfoc->Lock = HAL_UNLOCKED;
+  }
+  else if (hfoc->State == HAL_FOC_STATE_BUSY)
+  {
+    return HAL_BUSY;
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+
+  hfoc->pAdc = hfoc->Init.hadc->Instance;
+  hfoc->pTim = hfoc->Init.htim->Instance;
+  hfoc->Theta = 0U;
+  hfoc->ThetaIncrement = 0U;
+  hfoc->IdRef = 0;
+  hfoc->IqRef = 0;
+
+  hfoc->ErrorCode = HAL_FOC_ERROR_NONE;
+  hfoc->State = HAL_FOC_STATE_READY;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  DeInitialize the current loop.
+  * @note   The loop is stopped if running. The ADC, CORDIC and timer are left
+  *         initialized.
+  * @param  hfoc FOC handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_FOC_DeInit(FOC_HandleTypeDef *hfoc)
+{
+  /* Check the FOC handle allocation */
+  if (hfoc == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  if (hfoc->State == HAL_FOC_STATE_BUSY)
+  {
+    (void)HAL_FOC_Stop(hfoc);
+  }
+
+  hfoc->ErrorCode = HAL_FOC_ERROR_NONE;
+  hfoc->State = HAL_FOC_STATE_RESET;
+
+  /* Release Lock */
+  __HAL_UNLOCK(hfoc);
+
+  return HAL_OK;
+}
+
+/**
+  * @}
+  */
+
+/** @defgroup FOC_Exported_Functions_Group2 IO operation functions
+  *  @brief    Start, stop, references and IRQ handler functions
+  *
+@verbatim
+ ===============================================================================
+                      ##### IO operation functions #####
+ ===============================================================================
+    [..]
+    This subsection provides functions allowing to:
+      (+) Start and stop the current loop
+      (+) Set the current references and the electrical angle
+      (+) Run one loop, from the ADC IRQ handler
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Start the current loop.
+  * @note   The CORDIC is configured for the sine and cosine computation, the
+  *         controllers are cleared and the injected conversions are started
+  *         with only the end of sequence interrupt enabled.
+  * @param  hfoc FOC handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_FOC_Start(FOC_HandleTypeDef *hfoc)
+{
+  HAL_StatusTypeDef status;
+
+  /* Process locked */
+  __HAL_LOCK(hfoc);
+
+  if (hfoc->State != HAL_FOC_STATE_READY)
+  {
+    __HAL_UNLOCK(hfoc);
+    return HAL_BUSY;
+  }
+
+  /* Enable the DWT cycle counter if not already done by a debugger */
+  if ((DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk) == 0U)
+  {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0U;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+  }
+
+  /* Sine and cosine of one argument, the modulus keeps its default value 1 */
+  WRITE_REG(CORDIC->CSR, FOC_CORDIC_CONFIG);
+
+  hfoc->HalfPeriod = hfoc->pTim->ARR / 2U;
+  hfoc->IntegralD = 0;
+  hfoc->IntegralQ = 0;
+  hfoc->Id = 0;
+  hfoc->Iq = 0;
+  hfoc->Vd = 0;
+  hfoc->Vq = 0;
+  hfoc->LoopCount = 0U;
+  hfoc->CallbackCount = hfoc->Init.CallbackDivider;
+  hfoc->LastCycles = 0U;
+  hfoc->MaxCycles = 0U;
+  hfoc->OverrunCount = 0U;
+  hfoc->ErrorCode = HAL_FOC_ERROR_NONE;
+  hfoc->State = HAL_FOC_STATE_BUSY;
+
+  /* Only the end of the injected sequence interrupts the CPU */
+  WRITE_REG(hfoc->pAdc->ISR, ADC_ISR_JEOC | ADC_ISR_JEOS);
+  CLEAR_BIT(hfoc->pAdc->IER, ADC_IER_JEOCIE);
+  SET_BIT(hfoc->pAdc->IER, ADC_IER_JEOSIE);
+
+  status = HAL_ADCEx_InjectedStart(hfoc->Init.hadc);
+  if (status != HAL_OK)
+  {
+    CLEAR_BIT(hfoc->pAdc->IER, ADC_IER_JEOSIE);
+    hfoc->ErrorCode = HAL_FOC_ERROR_ADC;
+    hfoc->State = HAL_FOC_STATE_READY;
+  }
+
+  /* Process unlocked */
+  __HAL_UNLOCK(hfoc);
+
+  return status;
+}
+
+/**
+  * @brief  Stop the current loop.
+  * @note   The duty cycles are set back to 50%, the PWM timer is left running.
+  * @param  hfoc FOC handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_FOC_Stop(FOC_HandleTypeDef *hfoc)
+{
+  HAL_StatusTypeDef status;
+
+  /* Process locked */
+  __HAL_LOCK(hfoc);
+
+  CLEAR_BIT(hfoc->pAdc->IER, ADC_IER_JEOSIE);
+  status = HAL_ADCEx_InjectedStop(hfoc->Init.hadc);
+  if (status != HAL_OK)
+  {
+    hfoc->ErrorCode |= HAL_FOC_ERROR_ADC;
+  }
+
+  hfoc->pTim->CCR1 = hfoc->HalfPeriod;
+  hfoc->pTim->CCR2 = hfoc->HalfPeriod;
+  hfoc->pTim->CCR3 = hfoc->HalfPeriod;
+
+  hfoc->State = HAL_FOC_STATE_READY;
+
+  /* Process unlocked */
+  __HAL_UNLOCK(hfoc);
+
+  return status;
+}
+
+/**
+  * @brief  Set the d and q current references of the next loops.
+  * @param  hfoc FOC handle
+  * @param  IdRef Direct current reference, in Q15
+  * @param  IqRef Quadrature current reference, in Q15
+  * @retval None
+  */
+void HAL_FOC_SetCurrentReference(FOC_HandleTypeDef *hfoc, int32_t IdRef, int32_t IqRef)
+{
+  uint32_t primask_bit = __get_PRIMASK();
+
+  __disable_irq();
+  hfoc->IdRef = IdRef;
+  hfoc->IqRef = IqRef;
+  __set_PRIMASK(primask_bit);
+}
+
+/**
+  * @brief  Set the electrical angle of the next loop.
+  * @param  hfoc FOC handle
+  * @param  Theta Electrical angle, 2^32 being one turn
+  * @param  ThetaIncrement Angle added after each loop, to extrapolate the angle between two
+  *         calls, 0 to keep it constant
+  * @retval None
+  */
+void HAL_FOC_SetAngle(FOC_HandleTypeDef *hfoc, uint32_t Theta, uint32_t ThetaIncrement)
+{
+  uint32_t primask_bit = __get_PRIMASK();
+
+  __disable_irq();
+  hfoc->Theta = Theta;
+  hfoc->ThetaIncrement = ThetaIncrement;
+  __set_PRIMASK(primask_bit);
+}
+
+/**
+  * @brief  Run one current loop, on the end of the injected sequence.
+  * @note   To be called first in the ADC IRQ handler. The registers are accessed
+  *         directly, the read of the CORDIC results stalls the CPU until they are
+  *         available, which saves the polling of the RRDY flag.
+  * @param  hfoc FOC handle
+  * @retval None
+  */
+void HAL_FOC_IRQHandler(FOC_HandleTypeDef *hfoc)
+{
+  uint32_t start = DWT->CYCCNT;
+  ADC_TypeDef *adc = hfoc->pAdc;
+  TIM_TypeDef *tim = hfoc->pTim;
+  int32_t half = (int32_t)hfoc->HalfPeriod;
+  int32_t ia;
+  int32_t ib;
+  int32_t ibeta;
+  int32_t cosine;
+  int32_t sine;
+  int32_t id;
+  int32_t iq;
+  int32_t vd;
+  int32_t vq;
+  int32_t valpha;
+  int32_t vbeta;
+  int32_t va;
+  int32_t vb;
+  int32_t vc;
+  int32_t vmax;
+  int32_t vmin;
+  int32_t voffset;
+  uint32_t cycles;
+
+  if ((adc->ISR & ADC_ISR_JEOS) == 0U)
+  {
+    return;
+  }
+
+  /* Start the sine and cosine computation of the electrical angle */
+  CORDIC->WDATA = hfoc->Theta;
+  adc->ISR = ADC_ISR_JEOC | ADC_ISR_JEOS;
+
+  /* Phase currents and Clarke transform, ialpha being ia */
+  ia = ((int32_t)adc->JDR1 - (int32_t)hfoc->Init.CurrentOffsetA) << FOC_ADC_TO_Q15_SHIFT;
+  ib = ((int32_t)adc->JDR2 - (int32_t)hfoc->Init.CurrentOffsetB) << FOC_ADC_TO_Q15_SHIFT;
+  ibeta = ((ia + (2 * ib)) * FOC_ONE_OVER_SQRT3) >> 15;
+
+  /* Cosine then sine, Q1.31 to Q15 */
+  cosine = (int32_t)CORDIC->RDATA >> 16;
+  sine = (int32_t)CORDIC->RDATA >> 16;
+
+  /* Park transform */
+  id = (int32_t)((((int64_t)ia * cosine) + ((int64_t)ibeta * sine)) >> 15);
+  iq = (int32_t)((((int64_t)ibeta * cosine) - ((int64_t)ia * sine)) >> 15);
+
+  /* d and q current controllers */
+  vd = FOC_PIController(&hfoc->IntegralD, hfoc->IdRef - id, hfoc->Init.Kp, hfoc->Init.Ki, hfoc->Init.VoltageLimit);
+  vq = FOC_PIController(&hfoc->IntegralQ, hfoc->IqRef - iq, hfoc->Init.Kp, hfoc->Init.Ki, hfoc->Init.VoltageLimit);
+
+  /* Inverse Park and Clarke transforms */
+  valpha = ((vd * cosine) - (vq * sine)) >> 15;
+  vbeta = ((vd * sine) + (vq * cosine)) >> 15;
+  va = valpha;
+  vb = ((vbeta * FOC_SQRT3_BY_2) >> 15) - (valpha >> 1);
+  vc = -va - vb;
+
+  /* Min-max zero sequence, centering the three phase voltages */
+  vmax = (va > vb) ? va : vb;
+  vmax = (vmax > vc) ? vmax : vc;
+  vmin = (va < vb) ? va : vb;
+  vmin = (vmin < vc) ? vmin : vc;
+  voffset = (vmax + vmin) >> 1;
+
+  /* Duty cycles, taken into account on the next update event */
+  tim->CCR1 = (uint32_t)(half + ((__SSAT(va - voffset, 16) * half) >> 15));
+  tim->CCR2 = (uint32_t)(half + ((__SSAT(vb - voffset, 16) * half) >> 15));
+  tim->CCR3 = (uint32_t)(half + ((__SSAT(vc - voffset, 16) * half) >> 15));
+
+  hfoc->Theta += hfoc->ThetaIncrement;
+  hfoc->Id = id;
+  hfoc->Iq = iq;
+  hfoc->Vd = vd;
+  hfoc->Vq = vq;
+  hfoc->LoopCount++;
+
+  cycles = DWT->CYCCNT - start;
+  hfoc->LastCycles = cycles;
+  if (cycles > hfoc->MaxCycles)
+  {
+    hfoc->MaxCycles = cycles;
+  }
+
+  /* The next injected sequence already ended: the loop is too long for the PWM period */
+  if ((adc->ISR & ADC_ISR_JEOS) != 0U)
+  {
+    hfoc->OverrunCount++;
+    hfoc->ErrorCode |= HAL_FOC_ERROR_OVERRUN;
+    HAL_FOC_ErrorCallback(hfoc);
+  }
+
+  if (hfoc->CallbackCount != 0U)
+  {
+    hfoc->CallbackCount--;
+    if (hfoc->CallbackCount == 0U)
+    {
+      hfoc->CallbackCount = hfoc->Init.CallbackDivider;
+      HAL_FOC_LoopCallback(hfoc);
+    }
+  }
+}
+
+/**
+  * @brief  Current loop callback, called every CallbackDivider loops.
+  * @note   Called from the ADC interrupt, after the duty cycles are written. It can
+  *         run the speed or position loop and update the references and the angle.
+  * @param  hfoc FOC handle
+  * @retval None
+  */
+__weak void HAL_FOC_LoopCallback(FOC_HandleTypeDef *hfoc)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hfoc);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_FOC_LoopCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Current loop error callback.
+  * @param  hfoc FOC handle
+  * @retval None
+  */
+__weak void HAL_FOC_ErrorCallback(FOC_HandleTypeDef *hfoc)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hfoc);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_FOC_ErrorCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @}
+  */
+
+/** @defgroup FOC_Exported_Functions_Group3 Peripheral State and Error functions
+  *  @brief    State and error functions
+  *
+@verbatim
+ ===============================================================================
+                ##### Peripheral State and Error functions #####
+ ===============================================================================
+    [..]
+    This subsection provides functions allowing to get the state and the error
+    code of the current loop.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Return the current loop state.
+  * @param  hfoc FOC handle
+  * @retval HAL state
+  */
+HAL_FOC_StateTypeDef HAL_FOC_GetState(FOC_HandleTypeDef *hfoc)
+{
+  return hfoc->State;
+}
+
+/**
+  * @brief  Return the current loop error code.
+  * @param  hfoc FOC handle
+  * @retval FOC error code, a value of @ref FOC_Error_Code
+  */
+uint32_t HAL_FOC_GetError(FOC_HandleTypeDef *hfoc)
+{
+  return hfoc->ErrorCode;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/* Private functions ---------------------------------------------------------*/
+/** @addtogroup FOC_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  PI controller with a clamped integral term.
+  * @param  pIntegral Integral term, in Q30
+  * @param  Error Reference minus measure, in Q15
+  * @param  Kp Proportional gain, in Q15
+  * @param  Ki Integral gain, in Q15
+  * @param  Limit Output limit, in Q15
+  * @retval Controller output, in Q15
+  */
+__STATIC_INLINE int32_t FOC_PIController(int32_t *pIntegral, int32_t Error, int32_t Kp, int32_t Ki, int32_t Limit)
+{
+  int32_t error = __SSAT(Error, 16);
+  int32_t limit = Limit << 15;
+  int32_t integral = *pIntegral + (Ki * error);
+  int32_t output;
+
+  /* Anti-windup: the integral term alone cannot exceed the output limit */
+  if (integral > limit)
+  {
+    integral = limit;
+  }
+  else if (integral < -limit)
+  {
+    integral = -limit;
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+  *pIntegral = integral;
+
+  output = (int32_t)((((int64_t)Kp * error) + integral) >> 15);
+  if (output > Limit)
+  {
+    output = Limit;
+  }
+  else if (output < -Limit)
+  {
+    output = -Limit;
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+
+  return output;
+}
+
+/**
+  * @}
+  */
+
+#endif /* CORDIC && HAL_ADC_MODULE_ENABLED && HAL_TIM_MODULE_ENABLED */
+
+#endif /* HAL_FOC_MODULE_ENABLED */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
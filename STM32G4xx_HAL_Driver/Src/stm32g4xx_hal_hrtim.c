@@ -282,6 +282,19 @@
      (#) Some functions can be used any time to retrieve actual HRTIM status
              (++)HAL_HRTIM_GetState(): returns actual HRTIM instance HAL state.
 
+     *** Multi-phase converter ***
+     =============================
+     [..]
+     The multi-phase converter functions configure the master timer and the
+     timers A to E as an interleaved converter, see HAL_HRTIM_ConverterConfig().
+          (+)HAL_HRTIM_ConverterStart_DMA() streams the compare values
+             computed by the control law through the burst DMA controller, on
+             the master repetition DMA request (hdmaMaster). The values written
+             during the repetition period n are applied together to all the
+             phases at the repetition event n+1, without interrupt.
+          (+)HAL_HRTIM_ConverterSetCompare() updates the compare values by
+             software, with the same synchronization.
+
      *** Callback registration ***
      =============================
      [..]
@@ -514,6 +527,10 @@ static void HRTIM_DMATimerxCplt(DMA_HandleTypeDef *hdma);
 static void HRTIM_DMAError(DMA_HandleTypeDef *hdma);
 
 static void HRTIM_BurstDMACplt(DMA_HandleTypeDef *hdma);
+
+static uint32_t HRTIM_ConverterPhaseShift(uint32_t Period,
+                                          uint32_t PhaseCount,
+                                          uint32_t Phase);
 /**
   * @}
   */
@@ -665,6 +682,9 @@ HAL_StatusTypeDef HAL_HRTIM_Init(HRTIM_HandleTypeDef * hhrtim)
     hhrtim->Instance->sMasterRegs.MCR = hrtim_mcr;
   }
 
+  /* No multi-phase converter configured */
+  hhrtim->ConverterPhaseCount = 0U;
+
   /* Initialize the HRTIM state*/
   hhrtim->State = HAL_HRTIM_STATE_READY;
 
@@ -9073,6 +9093,365 @@ HAL_StatusTypeDef HAL_HRTIM_TIMxUnRegisterCallback(HRTIM_HandleTypeDef * hhrtim,
   return status;
 }
 #endif /* USE_HAL_HRTIM_REGISTER_CALLBACKS */
+/**
+  * @}
+  */
+
+/** @defgroup HRTIM_Exported_Functions_Group11 Multi-phase converter functions
+ *  @brief    Multi-phase converter functions
+@verbatim
+ ===============================================================================
+                ##### Multi-phase converter functions #####
+ ===============================================================================
+    [..]  This section provides functions to drive an interleaved buck or boost
+          converter of 1 to 5 phases in one configuration call:
+      (+) The master timer sets the switching period and the repetition rate of
+          the compare value updates. The phase n timer (timer A + n) is reset on
+          the master period (phase 0) or on the master compare n event, placed
+          at n * Period / PhaseCount.
+      (+) The output 1 of a phase timer (high side) is set at the phase start and
+          reset on the timer compare 1. The output 2 (low side) is its complement
+          generated by the dead-time inserter.
+      (+) An ADC trigger can be placed in the period of the phase 0 (timer A
+          compare 4), for example at the middle of the high side pulse.
+      (+) All the compare units are preloaded and updated together on the master
+          repetition event.
+
+    [..]  How to use the multi-phase converter:
+      (#) Initialize the HRTIM with HAL_HRTIM_Init() and calibrate the DLL with
+          HAL_HRTIM_DLLCalibrationStart(). Configure the ADC to be triggered by
+          the selected HRTIM ADC trigger.
+      (#) Configure the converter with HAL_HRTIM_ConverterConfig(), timers
+          A to E must not be used for another purpose.
+      (#) Software update: start the converter with HAL_HRTIM_ConverterStart()
+          and update the compare values with HAL_HRTIM_ConverterSetCompare().
+      (#) DMA update: link a DMA channel on the HRTIM master request to
+          hdmaMaster (memory to peripheral, word, normal or circular mode), then
+          call HAL_HRTIM_ConverterStart_DMA(). The buffer holds UpdateCount
+          updates of PhaseCount words each, one compare value per phase.
+          In circular mode, the control law writes the buffer while the DMA
+          reads it and HAL_HRTIM_BurstDMATransferCallback() is called
+          (HRTIM_TIMERINDEX_MASTER) each time the whole buffer has been used.
+      (#) Stop the converter with HAL_HRTIM_ConverterStop() or
+          HAL_HRTIM_ConverterStop_DMA().
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Configure the master timer and the timers A to E as a multi-phase
+  *         interleaved converter
+  * @param  hhrtim pointer to HAL HRTIM handle
+  * @param  pConverterCfg pointer to the converter configuration structure
+  * @note The timers are not started, the outputs 1 and 2 of the phases are
+  *       complementary with the dead-time inserter enabled.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_HRTIM_ConverterConfig(HRTIM_HandleTypeDef *hhrtim,
+                                            HRTIM_ConverterCfgTypeDef *pConverterCfg)
+{
+  HRTIM_ADCTriggerCfgTypeDef adc_trigger_cfg;
+  uint32_t phase;
+  uint32_t hrtim_mcr;
+  uint32_t hrtim_timcr;
+
+  /* Check parameters */
+  assert_param(IS_HRTIM_CONVERTER_PHASECOUNT(pConverterCfg->PhaseCount));
+  assert_param(IS_HRTIM_PRESCALERRATIO(pConverterCfg->PrescalerRatio));
+  assert_param(IS_HRTIM_CONVERTER_PERIOD(pConverterCfg->Period));
+  assert_param(IS_HRTIM_CONVERTER_REPETITION(pConverterCfg->RepetitionCounter));
+  assert_param(pConverterCfg->Compare <= pConverterCfg->Period);
+  assert_param(IS_HRTIM_TIMDEADTIME_PRESCALERRATIO(pConverterCfg->DeadTimePrescaler));
+  assert_param(IS_HRTIM_CONVERTER_DEADTIME(pConverterCfg->RisingDeadTime));
+  assert_param(IS_HRTIM_CONVERTER_DEADTIME(pConverterCfg->FallingDeadTime));
+  assert_param(IS_HRTIM_CONVERTER_ADCTRIGGER(pConverterCfg->ADCTrigger));
+
+  if(hhrtim->State == HAL_HRTIM_STATE_BUSY)
+  {
+     return HAL_BUSY;
+  }
+
+  /* ADC trigger on the timer A compare 4, updated with the timer A */
+  if(pConverterCfg->ADCTrigger != HRTIM_CONVERTER_ADCTRIGGER_NONE)
+  {
+    assert_param(pConverterCfg->ADCTriggerPosition <= pConverterCfg->Period);
+
+    adc_trigger_cfg.UpdateSource = HRTIM_ADCTRIGGERUPDATE_TIMER_A;
+    if((pConverterCfg->ADCTrigger & (HRTIM_ADCTRIGGER_1 | HRTIM_ADCTRIGGER_3)) != 0U)
+    {
+      adc_trigger_cfg.Trigger = HRTIM_ADCTRIGGEREVENT13_TIMERA_CMP4;
+    }
+    else
+    {
+      adc_trigger_cfg.Trigger = HRTIM_ADCTRIGGEREVENT24_TIMERA_CMP4;
+    }
+
+    if(HAL_HRTIM_ADCTriggerConfig(hhrtim, pConverterCfg->ADCTrigger, &adc_trigger_cfg) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  /* Process Locked */
+  __HAL_LOCK(hhrtim);
+
+  hhrtim->State = HAL_HRTIM_STATE_BUSY;
+
+  /* Master timer: continuous mode, preload enabled, update on repetition */
+  hrtim_mcr = hhrtim->Instance->sMasterRegs.MCR;
+  hrtim_mcr &= ~(HRTIM_MCR_CK_PSC | HRTIM_MCR_CONT | HRTIM_MCR_RETRIG | HRTIM_MCR_HALF |
+                 HRTIM_MCR_INTLVD | HRTIM_MCR_PREEN | HRTIM_MCR_MREPU);
+  hrtim_mcr |= (pConverterCfg->PrescalerRatio & HRTIM_MCR_CK_PSC);
+  hrtim_mcr |= (HRTIM_MCR_CONT | HRTIM_MCR_PREEN | HRTIM_MCR_MREPU);
+  hhrtim->Instance->sMasterRegs.MCR = hrtim_mcr;
+
+  hhrtim->Instance->sMasterRegs.MPER = pConverterCfg->Period;
+  hhrtim->Instance->sMasterRegs.MREP = pConverterCfg->RepetitionCounter;
+
+  /* Phase shifts of the phases 1 to 4 */
+  hhrtim->Instance->sMasterRegs.MCMP1R = HRTIM_ConverterPhaseShift(pConverterCfg->Period, pConverterCfg->PhaseCount, 1U);
+  hhrtim->Instance->sMasterRegs.MCMP2R = HRTIM_ConverterPhaseShift(pConverterCfg->Period, pConverterCfg->PhaseCount, 2U);
+  hhrtim->Instance->sMasterRegs.MCMP3R = HRTIM_ConverterPhaseShift(pConverterCfg->Period, pConverterCfg->PhaseCount, 3U);
+  hhrtim->Instance->sMasterRegs.MCMP4R = HRTIM_ConverterPhaseShift(pConverterCfg->Period, pConverterCfg->PhaseCount, 4U);
+
+  for (phase = 0U; phase < pConverterCfg->PhaseCount; phase++)
+  {
+    /* Phase timer: continuous mode, preload enabled, update with the master timer */
+    hrtim_timcr = hhrtim->Instance->sTimerxRegs[phase].TIMxCR;
+    hrtim_timcr &= ~(HRTIM_TIMCR_CK_PSC | HRTIM_TIMCR_CONT | HRTIM_TIMCR_RETRIG | HRTIM_TIMCR_HALF |
+                     HRTIM_TIMCR_INTLVD | HRTIM_TIMCR_PSHPLL | HRTIM_TIMCR_PREEN | HRTIM_TIMCR_UPDGAT |
+                     HRTIM_TIMCR_TREPU | HRTIM_TIMCR_RSYNCU);
+    hrtim_timcr |= (pConverterCfg->PrescalerRatio & HRTIM_TIMCR_CK_PSC);
+    hrtim_timcr |= (HRTIM_TIMCR_CONT | HRTIM_TIMCR_PREEN | HRTIM_TIMCR_MSTU);
+    hhrtim->Instance->sTimerxRegs[phase].TIMxCR = hrtim_timcr;
+
+    hhrtim->Instance->sTimerxRegs[phase].PERxR = pConverterCfg->Period;
+    hhrtim->Instance->sTimerxRegs[phase].CMP1xR = pConverterCfg->Compare;
+
+    /* The phase starts on the master period (phase 0) or on the master compare n */
+    if(phase == 0U)
+    {
+      hhrtim->Instance->sTimerxRegs[phase].RSTxR = HRTIM_RSTR_MSTPER;
+      hhrtim->Instance->sTimerxRegs[phase].SETx1R = HRTIM_SET1R_MSTPER;
+    }
+    else
+    {
+      hhrtim->Instance->sTimerxRegs[phase].RSTxR = (HRTIM_RSTR_MSTCMP1 << (phase - 1U));
+      hhrtim->Instance->sTimerxRegs[phase].SETx1R = (HRTIM_SET1R_MSTCMP1 << (phase - 1U));
+    }
+    hhrtim->Instance->sTimerxRegs[phase].RSTx1R = HRTIM_RST1R_CMP1;
+
+    /* Complementary low side output with dead-time insertion */
+    hhrtim->Instance->sTimerxRegs[phase].DTxR = (pConverterCfg->RisingDeadTime & HRTIM_DTR_DTR) |
+                                                (pConverterCfg->DeadTimePrescaler & HRTIM_DTR_DTPRSC) |
+                                                ((pConverterCfg->FallingDeadTime << HRTIM_DTR_DTF_Pos) & HRTIM_DTR_DTF);
+    hhrtim->Instance->sTimerxRegs[phase].OUTxR = HRTIM_OUTR_DTEN;
+  }
+
+  if(pConverterCfg->ADCTrigger != HRTIM_CONVERTER_ADCTRIGGER_NONE)
+  {
+    hhrtim->Instance->sTimerxRegs[HRTIM_TIMERINDEX_TIMER_A].CMP4xR = pConverterCfg->ADCTriggerPosition;
+  }
+
+  hhrtim->ConverterPhaseCount = pConverterCfg->PhaseCount;
+
+  /* Load the configuration in the active registers */
+  hhrtim->Instance->sCommonRegs.CR2 |= (HRTIM_CR2_MSWU | HRTIM_CR2_TASWU | HRTIM_CR2_TBSWU |
+                                        HRTIM_CR2_TCSWU | HRTIM_CR2_TDSWU | HRTIM_CR2_TESWU);
+
+  hhrtim->State = HAL_HRTIM_STATE_READY;
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(hhrtim);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Start the multi-phase converter, compare values updated by software
+  * @param  hhrtim pointer to HAL HRTIM handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_HRTIM_ConverterStart(HRTIM_HandleTypeDef *hhrtim)
+{
+  uint32_t phase;
+  uint32_t timers = HRTIM_TIMERID_MASTER;
+
+  if(hhrtim->State == HAL_HRTIM_STATE_BUSY)
+  {
+     return HAL_BUSY;
+  }
+
+  if(hhrtim->ConverterPhaseCount == 0U)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Process Locked */
+  __HAL_LOCK(hhrtim);
+
+  hhrtim->State = HAL_HRTIM_STATE_BUSY;
+
+  for (phase = 0U; phase < hhrtim->ConverterPhaseCount; phase++)
+  {
+    timers |= TimerIdxToTimerId[phase];
+  }
+
+  /* Enable the outputs 1 and 2 of the phases */
+  hhrtim->Instance->sCommonRegs.OENR = ((1UL << (2U * hhrtim->ConverterPhaseCount)) - 1U);
+
+  /* Enable the master and phases counters */
+  hhrtim->Instance->sMasterRegs.MCR |= timers;
+
+  hhrtim->State = HAL_HRTIM_STATE_READY;
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(hhrtim);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop the multi-phase converter
+  * @param  hhrtim pointer to HAL HRTIM handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_HRTIM_ConverterStop(HRTIM_HandleTypeDef *hhrtim)
+{
+  uint32_t phase;
+  uint32_t timers = HRTIM_TIMERID_MASTER;
+
+  /* Process Locked */
+  __HAL_LOCK(hhrtim);
+
+  hhrtim->State = HAL_HRTIM_STATE_BUSY;
+
+  for (phase = 0U; phase < hhrtim->ConverterPhaseCount; phase++)
+  {
+    timers |= TimerIdxToTimerId[phase];
+  }
+
+  /* Disable the outputs 1 and 2 of the phases */
+  hhrtim->Instance->sCommonRegs.ODISR = ((1UL << (2U * hhrtim->ConverterPhaseCount)) - 1U);
+
+  /* Disable the master and phases counters */
+  hhrtim->Instance->sMasterRegs.MCR &= ~timers;
+
+  hhrtim->State = HAL_HRTIM_STATE_READY;
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(hhrtim);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Start the multi-phase converter, compare values updated by the
+  *         burst DMA controller on each master repetition event
+  * @param  hhrtim pointer to HAL HRTIM handle
+  * @param  pCompareBuffer buffer of UpdateCount updates, each update being made
+  *         of one compare value per phase, from phase 0 to phase PhaseCount - 1
+  * @param  UpdateCount number of updates in the buffer
+  * @note The burst DMA controller is used by the converter only: the burst DMA
+  *       update registers of the other timers are cleared.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_HRTIM_ConverterStart_DMA(HRTIM_HandleTypeDef *hhrtim,
+                                               uint32_t *pCompareBuffer,
+                                               uint32_t UpdateCount)
+{
+  uint32_t phase;
+
+  if(hhrtim->State == HAL_HRTIM_STATE_BUSY)
+  {
+     return HAL_BUSY;
+  }
+
+  if((hhrtim->ConverterPhaseCount == 0U) || (pCompareBuffer == NULL) || (UpdateCount == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Each burst writes the compare 1 of every phase, BDTAUPR to BDTEUPR are contiguous */
+  hhrtim->Instance->sCommonRegs.BDMUPR = 0U;
+  for (phase = 0U; phase < HRTIM_CONVERTER_MAX_PHASES; phase++)
+  {
+    if(phase < hhrtim->ConverterPhaseCount)
+    {
+      (&hhrtim->Instance->sCommonRegs.BDTAUPR)[phase] = HRTIM_BURSTDMA_CMP1;
+    }
+    else
+    {
+      (&hhrtim->Instance->sCommonRegs.BDTAUPR)[phase] = 0U;
+    }
+  }
+  hhrtim->Instance->sCommonRegs.BDTFUPR = 0U;
+
+  if(HAL_HRTIM_BurstDMATransfer(hhrtim,
+                                HRTIM_TIMERINDEX_MASTER,
+                                (uint32_t)pCompareBuffer,
+                                UpdateCount * hhrtim->ConverterPhaseCount) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  /* A burst is requested on each master repetition event */
+  __HAL_HRTIM_MASTER_ENABLE_DMA(hhrtim, HRTIM_MASTER_DMA_MREP);
+
+  return HAL_HRTIM_ConverterStart(hhrtim);
+}
+
+/**
+  * @brief  Stop the multi-phase converter started with HAL_HRTIM_ConverterStart_DMA()
+  * @param  hhrtim pointer to HAL HRTIM handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_HRTIM_ConverterStop_DMA(HRTIM_HandleTypeDef *hhrtim)
+{
+  /* Disable the master repetition DMA request */
+  __HAL_HRTIM_MASTER_DISABLE_DMA(hhrtim, HRTIM_MASTER_DMA_MREP);
+
+  if(hhrtim->hdmaMaster != NULL)
+  {
+    /* Disable the DMA */
+    if(HAL_DMA_Abort(hhrtim->hdmaMaster) != HAL_OK)
+    {
+      hhrtim->State = HAL_HRTIM_STATE_ERROR;
+
+      return HAL_ERROR;
+    }
+  }
+
+  return HAL_HRTIM_ConverterStop(hhrtim);
+}
+
+/**
+  * @brief  Set the compare values of the multi-phase converter by software
+  * @param  hhrtim pointer to HAL HRTIM handle
+  * @param  pCompare one compare value per phase, from phase 0 to phase PhaseCount - 1
+  * @note The values are written in the preload registers and applied together
+  *       on the next master repetition event.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_HRTIM_ConverterSetCompare(HRTIM_HandleTypeDef *hhrtim,
+                                                const uint32_t *pCompare)
+{
+  uint32_t phase;
+
+  if(hhrtim->ConverterPhaseCount == 0U)
+  {
+    return HAL_ERROR;
+  }
+
+  for (phase = 0U; phase < hhrtim->ConverterPhaseCount; phase++)
+  {
+    hhrtim->Instance->sTimerxRegs[phase].CMP1xR = pCompare[phase];
+  }
+
+  return HAL_OK;
+}
+
 /**
   * @}
   */
@@ -11067,6 +11446,25 @@ static void HRTIM_BurstDMACplt(DMA_HandleTypeDef *hdma)
 #endif /* USE_HAL_HRTIM_REGISTER_CALLBACKS */
 }
 
+/**
+  * @brief  Compute the master compare value starting a converter phase
+  * @param  Period switching period
+  * @param  PhaseCount number of phases of the converter
+  * @param  Phase phase index, from 1 to 4
+  * @retval Master compare value, 0 when the phase is not used
+  */
+static uint32_t HRTIM_ConverterPhaseShift(uint32_t Period,
+                                          uint32_t PhaseCount,
+                                          uint32_t Phase)
+{
+  if(Phase >= PhaseCount)
+  {
+    return 0U;
+  }
+
+  return ((Period * Phase) / PhaseCount);
+}
+
 /**
   * @}
   */
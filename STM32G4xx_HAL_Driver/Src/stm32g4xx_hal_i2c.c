@@ -163,6 +163,12 @@
           @ref HAL_I2C_Mem_Read_IT()
       (+) At Memory end of read transfer, @ref HAL_I2C_MemRxCpltCallback() is executed and user can
            add his own code by customization of function pointer @ref HAL_I2C_MemRxCpltCallback()
+      (+) Read a batch of memory areas, possibly from different devices, in non-blocking mode with
+          Interrupt using @ref HAL_I2C_Mem_ReadBatch_IT() and an array of @ref I2C_BatchOpTypeDef.
+          The operations are chained with repeated START conditions, a single STOP condition
+          ends the batch.
+      (+) At end of the batch, @ref HAL_I2C_MemBatchCpltCallback() is executed and user can
+           add his own code by customization of function pointer @ref HAL_I2C_MemBatchCpltCallback()
       (+) In case of transfer Error, @ref HAL_I2C_ErrorCallback() function is executed and user can
            add his own code by customization of function pointer @ref HAL_I2C_ErrorCallback()
 
@@ -192,6 +198,13 @@
            add his own code by customization of function pointer @ref HAL_I2C_AbortCpltCallback()
       (+) Discard a slave I2C process communication using @ref __HAL_I2C_GENERATE_NACK() macro.
            This action will inform Master to generate a Stop condition to discard the communication.
+      (+) Emulate a register-based slave device (EEPROM, sensor) with DMA using
+          @ref HAL_I2C_RegMap_Start() and an @ref I2C_RegMapTypeDef: the register pointer
+          written by the master, the auto-incremented reads and writes and the write mask
+          are handled by the driver from the address match, without user code in the ISR.
+      (+) At the STOP condition of a write, @ref HAL_I2C_RegMapWriteCallback() is executed and
+           user can add his own code by customization of function pointer
+           @ref HAL_I2C_RegMapWriteCallback()
 
     *** DMA mode IO MEM operation ***
     =================================
@@ -361,6 +374,12 @@
 
 /* Private define Sequential Transfer Options default/reset value */
 #define I2C_NO_OPTION_FRAME     (0xFFFF0000U)
+
+/* Private define for @ref I2C_RegMapTypeDef Phase usage */
+#define I2C_REGMAP_IDLE         (0x00000000U)   /* No transfer in progress                    */
+#define I2C_REGMAP_ADDRESS      (0x00000001U)   /* Register address being received            */
+#define I2C_REGMAP_WRITE        (0x00000002U)   /* Register data being received by the DMA    */
+#define I2C_REGMAP_READ         (0x00000003U)   /* Register data being sent by the DMA        */
 /**
   * @}
   */
@@ -379,6 +398,9 @@ static void I2C_DMASlaveTransmitCplt(DMA_HandleTypeDef *hdma);
 static void I2C_DMASlaveReceiveCplt(DMA_HandleTypeDef *hdma);
 static void I2C_DMAError(DMA_HandleTypeDef *hdma);
 static void I2C_DMAAbort(DMA_HandleTypeDef *hdma);
+static void I2C_DMARegMapTransmitCplt(DMA_HandleTypeDef *hdma);
+static void I2C_DMARegMapReceiveCplt(DMA_HandleTypeDef *hdma);
+static void I2C_DMARegMapError(DMA_HandleTypeDef *hdma);
 
 /* Private functions to handle IT transfer */
 static void I2C_ITAddrCplt(I2C_HandleTypeDef *hi2c, uint32_t ITFlags);
@@ -387,6 +409,11 @@ static void I2C_ITSlaveSeqCplt(I2C_HandleTypeDef *hi2c);
 static void I2C_ITMasterCplt(I2C_HandleTypeDef *hi2c, uint32_t ITFlags);
 static void I2C_ITSlaveCplt(I2C_HandleTypeDef *hi2c, uint32_t ITFlags);
 static void I2C_ITListenCplt(I2C_HandleTypeDef *hi2c, uint32_t ITFlags);
+static void I2C_ITBatchCplt(I2C_HandleTypeDef *hi2c, uint32_t ITFlags);
+static void I2C_BatchStartOp(I2C_HandleTypeDef *hi2c);
+static uint32_t I2C_RegMapEndTransfer(I2C_HandleTypeDef *hi2c, uint16_t *pOffset);
+static void I2C_RegMapAbort(I2C_HandleTypeDef *hi2c);
+static void I2C_RegMapError(I2C_HandleTypeDef *hi2c);
 static void I2C_ITError(I2C_HandleTypeDef *hi2c, uint32_t ErrorCode);
 
 /* Private functions to handle IT transfer */
@@ -397,9 +424,11 @@ static HAL_StatusTypeDef I2C_RequestMemoryRead(I2C_HandleTypeDef *hi2c, uint16_t
 
 /* Private functions for I2C transfer IRQ handler */
 static HAL_StatusTypeDef I2C_Master_ISR_IT(struct __I2C_HandleTypeDef *hi2c, uint32_t ITFlags, uint32_t ITSources);
+static HAL_StatusTypeDef I2C_Batch_ISR_IT(struct __I2C_HandleTypeDef *hi2c, uint32_t ITFlags, uint32_t ITSources);
 static HAL_StatusTypeDef I2C_Slave_ISR_IT(struct __I2C_HandleTypeDef *hi2c, uint32_t ITFlags, uint32_t ITSources);
 static HAL_StatusTypeDef I2C_Master_ISR_DMA(struct __I2C_HandleTypeDef *hi2c, uint32_t ITFlags, uint32_t ITSources);
 static HAL_StatusTypeDef I2C_Slave_ISR_DMA(struct __I2C_HandleTypeDef *hi2c, uint32_t ITFlags, uint32_t ITSources);
+static HAL_StatusTypeDef I2C_RegMap_ISR(struct __I2C_HandleTypeDef *hi2c, uint32_t ITFlags, uint32_t ITSources);
 
 /* Private functions to handle flags during polling transfer */
 static HAL_StatusTypeDef I2C_WaitOnFlagUntilTimeout(I2C_HandleTypeDef *hi2c, uint32_t Flag, FlagStatus Status,
@@ -1846,7 +1875,8 @@ HAL_StatusTypeDef HAL_I2C_Master_Transmit_DMA(I2C_HandleTypeDef *hi2c, uint16_t
         hi2c->hdmatx->XferAbortCallback = NULL;
 
         /* Enable the DMA channel */
-        dmaxferstatus = HAL_DMA_Start_IT(hi2c->hdmatx, (uint32_t)pData, (uint32_t)&hi2c->Instance->TXDR, hi2c->XferSize);
+        dmaxferstatus = HAL_DMA_Start_IT(hi2c->hdmatx, (uint32_t)pData, (uint32_t)&hi2c->Instance->TXDR,
+                                         hi2c->XferCount);
       }
       else
       {
@@ -1881,6 +1911,13 @@ HAL_StatusTypeDef HAL_I2C_Master_Transmit_DMA(I2C_HandleTypeDef *hi2c, uint16_t
         /* Enable ERR and NACK interrupts */
         I2C_Enable_IRQ(hi2c, I2C_XFER_ERROR_IT);
 
+        /* The DMA covers the whole buffer, only the NBYTES reloads are done on TCR event */
+        if (hi2c->XferCount != 0U)
+        {
+          /* Enable TC interrupts */
+          I2C_Enable_IRQ(hi2c, I2C_XFER_RELOAD_IT);
+        }
+
         /* Enable DMA Request */
         hi2c->Instance->CR1 |= I2C_CR1_TXDMAEN;
       }
@@ -1990,7 +2027,8 @@ HAL_StatusTypeDef HAL_I2C_Master_Receive_DMA(I2C_HandleTypeDef *hi2c, uint16_t D
         hi2c->hdmarx->XferAbortCallback = NULL;
 
         /* Enable the DMA channel */
-        dmaxferstatus = HAL_DMA_Start_IT(hi2c->hdmarx, (uint32_t)&hi2c->Instance->RXDR, (uint32_t)pData, hi2c->XferSize);
+        dmaxferstatus = HAL_DMA_Start_IT(hi2c->hdmarx, (uint32_t)&hi2c->Instance->RXDR, (uint32_t)pData,
+                                         hi2c->XferCount);
       }
       else
       {
@@ -2025,6 +2063,13 @@ HAL_StatusTypeDef HAL_I2C_Master_Receive_DMA(I2C_HandleTypeDef *hi2c, uint16_t D
         /* Enable ERR and NACK interrupts */
         I2C_Enable_IRQ(hi2c, I2C_XFER_ERROR_IT);
 
+        /* The DMA covers the whole buffer, only the NBYTES reloads are done on TCR event */
+        if (hi2c->XferCount != 0U)
+        {
+          /* Enable TC interrupts */
+          I2C_Enable_IRQ(hi2c, I2C_XFER_RELOAD_IT);
+        }
+
         /* Enable DMA Request */
         hi2c->Instance->CR1 |= I2C_CR1_RXDMAEN;
       }
@@ -2729,6 +2774,87 @@ HAL_StatusTypeDef HAL_I2C_Mem_Read_IT(I2C_HandleTypeDef *hi2c, uint16_t DevAddre
     return HAL_BUSY;
   }
 }
+
+/**
+  * @brief  Read a batch of memory areas in non-blocking mode with Interrupt.
+  * @note   The operations are executed back-to-back from the I2C interrupts:
+  *         memory address write, repeated START and data read for each operation,
+  *         the next operation being started with a repeated START. A single STOP
+  *         condition is generated at end of the last operation, then
+  *         HAL_I2C_MemBatchCpltCallback() is executed.
+  * @note   The array of operations and the data buffers must remain valid until
+  *         the end of the batch. On a NACK or bus error, the batch is stopped and
+  *         HAL_I2C_ErrorCallback() is executed; hi2c->pBatchOp then points to the
+  *         operation on which the error occurred.
+  * @param  hi2c Pointer to a I2C_HandleTypeDef structure that contains
+  *                the configuration information for the specified I2C.
+  * @param  pOps Pointer to an array of I2C_BatchOpTypeDef operations
+  * @param  NbOps Number of operations in the array
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_I2C_Mem_ReadBatch_IT(I2C_HandleTypeDef *hi2c, const I2C_BatchOpTypeDef *pOps,
+                                           uint32_t NbOps)
+{
+  uint32_t index;
+
+  if (hi2c->State == HAL_I2C_STATE_READY)
+  {
+    if ((pOps == NULL) || (NbOps == 0U))
+    {
+      hi2c->ErrorCode = HAL_I2C_ERROR_INVALID_PARAM;
+      return  HAL_ERROR;
+    }
+
+    for (index = 0U; index < NbOps; index++)
+    {
+      /* Check the parameters */
+      assert_param(IS_I2C_MEMADD_SIZE(pOps[index].MemAddSize));
+
+      if ((pOps[index].pData == NULL) || (pOps[index].Size == 0U) || (pOps[index].Size > MAX_NBYTE_SIZE))
+      {
+        hi2c->ErrorCode = HAL_I2C_ERROR_INVALID_PARAM;
+        return  HAL_ERROR;
+      }
+    }
+
+    if (__HAL_I2C_GET_FLAG(hi2c, I2C_FLAG_BUSY) == SET)
+    {
+      return HAL_BUSY;
+    }
+
+    /* Process Locked */
+    __HAL_LOCK(hi2c);
+
+    hi2c->State       = HAL_I2C_STATE_BUSY_RX;
+    hi2c->Mode        = HAL_I2C_MODE_MEM;
+    hi2c->ErrorCode   = HAL_I2C_ERROR_NONE;
+
+    /* Prepare transfer parameters */
+    hi2c->pBatchOp    = pOps;
+    hi2c->BatchCount  = NbOps;
+    hi2c->XferOptions = I2C_NO_OPTION_FRAME;
+    hi2c->XferISR     = I2C_Batch_ISR_IT;
+
+    /* Send Slave Address and generate START condition for the first operation */
+    I2C_BatchStartOp(hi2c);
+
+    /* Process Unlocked */
+    __HAL_UNLOCK(hi2c);
+
+    /* Note : The I2C interrupts must be enabled after unlocking current process
+              to avoid the risk of I2C interrupt handle execution before current
+              process unlock */
+
+    /* Enable ERR, TC, STOP, NACK, TXI and RXI interrupts */
+    I2C_Enable_IRQ(hi2c, I2C_XFER_TX_IT | I2C_XFER_RX_IT);
+
+    return HAL_OK;
+  }
+  else
+  {
+    return HAL_BUSY;
+  }
+}
 /**
   * @brief  Write an amount of data in non-blocking mode with DMA to a specific memory address
   * @param  hi2c Pointer to a I2C_HandleTypeDef structure that contains
@@ -2813,7 +2939,8 @@ HAL_StatusTypeDef HAL_I2C_Mem_Write_DMA(I2C_HandleTypeDef *hi2c, uint16_t DevAdd
       hi2c->hdmatx->XferAbortCallback = NULL;
 
       /* Enable the DMA channel */
-      dmaxferstatus = HAL_DMA_Start_IT(hi2c->hdmatx, (uint32_t)pData, (uint32_t)&hi2c->Instance->TXDR, hi2c->XferSize);
+      dmaxferstatus = HAL_DMA_Start_IT(hi2c->hdmatx, (uint32_t)pData, (uint32_t)&hi2c->Instance->TXDR,
+                                       hi2c->XferCount);
     }
     else
     {
@@ -2848,6 +2975,13 @@ HAL_StatusTypeDef HAL_I2C_Mem_Write_DMA(I2C_HandleTypeDef *hi2c, uint16_t DevAdd
       /* Enable ERR and NACK interrupts */
       I2C_Enable_IRQ(hi2c, I2C_XFER_ERROR_IT);
 
+      /* The DMA covers the whole buffer, only the NBYTES reloads are done on TCR event */
+      if (hi2c->XferCount != 0U)
+      {
+        /* Enable TC interrupts */
+        I2C_Enable_IRQ(hi2c, I2C_XFER_RELOAD_IT);
+      }
+
       /* Enable DMA Request */
       hi2c->Instance->CR1 |= I2C_CR1_TXDMAEN;
     }
@@ -2957,7 +3091,8 @@ HAL_StatusTypeDef HAL_I2C_Mem_Read_DMA(I2C_HandleTypeDef *hi2c, uint16_t DevAddr
       hi2c->hdmarx->XferAbortCallback = NULL;
 
       /* Enable the DMA channel */
-      dmaxferstatus = HAL_DMA_Start_IT(hi2c->hdmarx, (uint32_t)&hi2c->Instance->RXDR, (uint32_t)pData, hi2c->XferSize);
+      dmaxferstatus = HAL_DMA_Start_IT(hi2c->hdmarx, (uint32_t)&hi2c->Instance->RXDR, (uint32_t)pData,
+                                       hi2c->XferCount);
     }
     else
     {
@@ -2991,6 +3126,13 @@ HAL_StatusTypeDef HAL_I2C_Mem_Read_DMA(I2C_HandleTypeDef *hi2c, uint16_t DevAddr
       /* Enable ERR and NACK interrupts */
       I2C_Enable_IRQ(hi2c, I2C_XFER_ERROR_IT);
 
+      /* The DMA covers the whole buffer, only the NBYTES reloads are done on TCR event */
+      if (hi2c->XferCount != 0U)
+      {
+        /* Enable TC interrupts */
+        I2C_Enable_IRQ(hi2c, I2C_XFER_RELOAD_IT);
+      }
+
       /* Enable DMA Request */
       hi2c->Instance->CR1 |= I2C_CR1_RXDMAEN;
     }
@@ -3324,7 +3466,8 @@ HAL_StatusTypeDef HAL_I2C_Master_Seq_Transmit_DMA(I2C_HandleTypeDef *hi2c, uint1
         hi2c->hdmatx->XferAbortCallback = NULL;
 
         /* Enable the DMA channel */
-        dmaxferstatus = HAL_DMA_Start_IT(hi2c->hdmatx, (uint32_t)pData, (uint32_t)&hi2c->Instance->TXDR, hi2c->XferSize);
+        dmaxferstatus = HAL_DMA_Start_IT(hi2c->hdmatx, (uint32_t)pData, (uint32_t)&hi2c->Instance->TXDR,
+                                         hi2c->XferCount);
       }
       else
       {
@@ -3358,6 +3501,13 @@ HAL_StatusTypeDef HAL_I2C_Master_Seq_Transmit_DMA(I2C_HandleTypeDef *hi2c, uint1
         /* Enable ERR and NACK interrupts */
         I2C_Enable_IRQ(hi2c, I2C_XFER_ERROR_IT);
 
+        /* The DMA covers the whole buffer, only the NBYTES reloads are done on TCR event */
+        if (hi2c->XferCount != 0U)
+        {
+          /* Enable TC interrupts */
+          I2C_Enable_IRQ(hi2c, I2C_XFER_RELOAD_IT);
+        }
+
         /* Enable DMA Request */
         hi2c->Instance->CR1 |= I2C_CR1_TXDMAEN;
       }
@@ -3572,7 +3722,8 @@ HAL_StatusTypeDef HAL_I2C_Master_Seq_Receive_DMA(I2C_HandleTypeDef *hi2c, uint16
         hi2c->hdmarx->XferAbortCallback = NULL;
 
         /* Enable the DMA channel */
-        dmaxferstatus = HAL_DMA_Start_IT(hi2c->hdmarx, (uint32_t)&hi2c->Instance->RXDR, (uint32_t)pData, hi2c->XferSize);
+        dmaxferstatus = HAL_DMA_Start_IT(hi2c->hdmarx, (uint32_t)&hi2c->Instance->RXDR, (uint32_t)pData,
+                                         hi2c->XferCount);
       }
       else
       {
@@ -3606,6 +3757,13 @@ HAL_StatusTypeDef HAL_I2C_Master_Seq_Receive_DMA(I2C_HandleTypeDef *hi2c, uint16
         /* Enable ERR and NACK interrupts */
         I2C_Enable_IRQ(hi2c, I2C_XFER_ERROR_IT);
 
+        /* The DMA covers the whole buffer, only the NBYTES reloads are done on TCR event */
+        if (hi2c->XferCount != 0U)
+        {
+          /* Enable TC interrupts */
+          I2C_Enable_IRQ(hi2c, I2C_XFER_RELOAD_IT);
+        }
+
         /* Enable DMA Request */
         hi2c->Instance->CR1 |= I2C_CR1_RXDMAEN;
       }
@@ -4260,6 +4418,101 @@ HAL_StatusTypeDef HAL_I2C_DisableListen_IT(I2C_HandleTypeDef *hi2c)
   }
 }
 
+/**
+  * @brief  Serve a register map in slave mode, with DMA.
+  * @note   The master writes the register address first, then the data to write
+  *         from this address, or reads the registers from the current pointer
+  *         after a repeated START. The driver answers the address match by itself,
+  *         starting the DMA from the ISR, and increments the pointer with the
+  *         bytes transferred.
+  * @note   The received bytes are merged into pRegion at the STOP condition, the
+  *         read-only bits being kept, then HAL_I2C_RegMapWriteCallback() is
+  *         executed with the range written. The bytes written or read past the
+  *         end of the region are discarded or read as 0xFF.
+  * @note   The hdmatx and hdmarx DMA handles must be linked, in normal mode.
+  * @param  hi2c Pointer to a I2C_HandleTypeDef structure that contains
+  *                the configuration information for the specified I2C.
+  * @param  pRegMap Pointer to the register map, owned by the application.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_I2C_RegMap_Start(I2C_HandleTypeDef *hi2c, I2C_RegMapTypeDef *pRegMap)
+{
+  if (hi2c->State == HAL_I2C_STATE_READY)
+  {
+    if ((pRegMap == NULL) || (pRegMap->pRegion == NULL) || (pRegMap->pScratch == NULL) || (pRegMap->Size == 0U) ||
+        ((pRegMap->AddressSize == I2C_MEMADD_SIZE_8BIT) && (pRegMap->Size > 256U)) ||
+        (hi2c->hdmatx == NULL) || (hi2c->hdmarx == NULL))
+    {
+      hi2c->ErrorCode = HAL_I2C_ERROR_INVALID_PARAM;
+      return  HAL_ERROR;
+    }
+
+    /* Check the parameters */
+    assert_param(IS_I2C_MEMADD_SIZE(pRegMap->AddressSize));
+
+    /* Process Locked */
+    __HAL_LOCK(hi2c);
+
+    hi2c->State     = HAL_I2C_STATE_LISTEN;
+    hi2c->Mode      = HAL_I2C_MODE_SLAVE;
+    hi2c->ErrorCode = HAL_I2C_ERROR_NONE;
+
+    pRegMap->Pointer = 0U;
+    pRegMap->Phase   = I2C_REGMAP_IDLE;
+    hi2c->pRegMap    = pRegMap;
+    hi2c->XferISR    = I2C_RegMap_ISR;
+
+    /* The end of a DMA transfer only means that the end of the region has been reached */
+    hi2c->hdmatx->XferCpltCallback = I2C_DMARegMapTransmitCplt;
+    hi2c->hdmatx->XferHalfCpltCallback = NULL;
+    hi2c->hdmatx->XferErrorCallback = I2C_DMARegMapError;
+    hi2c->hdmatx->XferAbortCallback = NULL;
+    hi2c->hdmarx->XferCpltCallback = I2C_DMARegMapReceiveCplt;
+    hi2c->hdmarx->XferHalfCpltCallback = NULL;
+    hi2c->hdmarx->XferErrorCallback = I2C_DMARegMapError;
+    hi2c->hdmarx->XferAbortCallback = NULL;
+
+    /* Process Unlocked */
+    __HAL_UNLOCK(hi2c);
+
+    /* Enable ERR, STOP, NACK and ADDR interrupts */
+    I2C_Enable_IRQ(hi2c, I2C_XFER_LISTEN_IT);
+
+    return HAL_OK;
+  }
+  else
+  {
+    return HAL_BUSY;
+  }
+}
+
+/**
+  * @brief  Stop serving the register map started with HAL_I2C_RegMap_Start().
+  * @note   A write not yet ended by a STOP condition is discarded.
+  * @param  hi2c Pointer to a I2C_HandleTypeDef structure that contains
+  *                the configuration information for the specified I2C.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_I2C_RegMap_Stop(I2C_HandleTypeDef *hi2c)
+{
+  if ((hi2c->State != HAL_I2C_STATE_LISTEN) || (hi2c->XferISR != I2C_RegMap_ISR))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Disable the Address Match, data and DMA requests */
+  I2C_Disable_IRQ(hi2c, I2C_XFER_LISTEN_IT | I2C_XFER_TX_IT | I2C_XFER_RX_IT);
+  I2C_RegMapAbort(hi2c);
+
+  hi2c->PreviousState = I2C_STATE_NONE;
+  hi2c->State         = HAL_I2C_STATE_READY;
+  hi2c->Mode          = HAL_I2C_MODE_NONE;
+  hi2c->XferISR       = NULL;
+  hi2c->pRegMap       = NULL;
+
+  return HAL_OK;
+}
+
 /**
   * @brief  Abort a master I2C IT or DMA process communication with Interrupt.
   * @param  hi2c Pointer to a I2C_HandleTypeDef structure that contains
@@ -4388,7 +4641,15 @@ void HAL_I2C_ER_IRQHandler(I2C_HandleTypeDef *hi2c)
   /* Call the Error Callback in case of Error detected */
   if ((tmperror & (HAL_I2C_ERROR_BERR | HAL_I2C_ERROR_OVR | HAL_I2C_ERROR_ARLO)) !=  HAL_I2C_ERROR_NONE)
   {
-    I2C_ITError(hi2c, tmperror);
+    if (hi2c->XferISR == I2C_RegMap_ISR)
+    {
+      /* The register map keeps listening */
+      I2C_RegMapError(hi2c);
+    }
+    else
+    {
+      I2C_ITError(hi2c, tmperror);
+    }
   }
 }
 
@@ -4523,6 +4784,42 @@ __weak void HAL_I2C_MemRxCpltCallback(I2C_HandleTypeDef *hi2c)
    */
 }
 
+/**
+  * @brief  Memory batch read completed callback.
+  * @param  hi2c Pointer to a I2C_HandleTypeDef structure that contains
+  *                the configuration information for the specified I2C.
+  * @retval None
+  */
+__weak void HAL_I2C_MemBatchCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hi2c);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_I2C_MemBatchCpltCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Register map write callback, executed at the STOP condition of a write.
+  * @param  hi2c Pointer to a I2C_HandleTypeDef structure that contains
+  *                the configuration information for the specified I2C.
+  * @param  Offset First register written.
+  * @param  Size Number of registers written.
+  * @retval None
+  */
+__weak void HAL_I2C_RegMapWriteCallback(I2C_HandleTypeDef *hi2c, uint16_t Offset, uint16_t Size)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hi2c);
+  UNUSED(Offset);
+  UNUSED(Size);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_I2C_RegMapWriteCallback could be implemented in the user file
+   */
+}
+
 /**
   * @brief  I2C error callback.
   * @param  hi2c Pointer to a I2C_HandleTypeDef structure that contains
@@ -4758,88 +5055,314 @@ static HAL_StatusTypeDef I2C_Master_ISR_IT(struct __I2C_HandleTypeDef *hi2c, uin
 }
 
 /**
-  * @brief  Interrupt Sub-Routine which handle the Interrupt Flags Slave Mode with Interrupt.
+  * @brief  Interrupt Sub-Routine which handle the Interrupt Flags of a memory
+  *         batch read with Interrupt.
   * @param  hi2c Pointer to a I2C_HandleTypeDef structure that contains
   *                the configuration information for the specified I2C.
   * @param  ITFlags Interrupt flags to handle.
   * @param  ITSources Interrupt sources enabled.
   * @retval HAL status
   */
-static HAL_StatusTypeDef I2C_Slave_ISR_IT(struct __I2C_HandleTypeDef *hi2c, uint32_t ITFlags, uint32_t ITSources)
+static HAL_StatusTypeDef I2C_Batch_ISR_IT(struct __I2C_HandleTypeDef *hi2c, uint32_t ITFlags, uint32_t ITSources)
 {
-  uint32_t tmpoptions = hi2c->XferOptions;
+  const I2C_BatchOpTypeDef *pop = hi2c->pBatchOp;
   uint32_t tmpITFlags = ITFlags;
+  uint32_t xfermode;
 
-  /* Process locked */
+  /* Process Locked */
   __HAL_LOCK(hi2c);
 
-  /* Check if STOPF is set */
-  if ((I2C_CHECK_FLAG(tmpITFlags, I2C_FLAG_STOPF) != RESET) && (I2C_CHECK_IT_SOURCE(ITSources, I2C_IT_STOPI) != RESET))
+  if ((I2C_CHECK_FLAG(tmpITFlags, I2C_FLAG_AF) != RESET) && (I2C_CHECK_IT_SOURCE(ITSources, I2C_IT_NACKI) != RESET))
   {
-    /* Call I2C Slave complete process */
-    I2C_ITSlaveCplt(hi2c, tmpITFlags);
-  }
+    /* Clear NACK Flag */
+    __HAL_I2C_CLEAR_FLAG(hi2c, I2C_FLAG_AF);
 
-  if ((I2C_CHECK_FLAG(tmpITFlags, I2C_FLAG_AF) != RESET) && (I2C_CHECK_IT_SOURCE(ITSources, I2C_IT_NACKI) != RESET))
+    /* Set corresponding Error Code */
+    /* No need to generate STOP, it is automatically done */
+    /* Error callback will be send during stop flag treatment */
+    hi2c->ErrorCode |= HAL_I2C_ERROR_AF;
+
+    /* Flush TX register */
+    I2C_Flush_TXDR(hi2c);
+  }
+  else if ((I2C_CHECK_FLAG(tmpITFlags, I2C_FLAG_RXNE) != RESET) && (I2C_CHECK_IT_SOURCE(ITSources, I2C_IT_RXI) != RESET))
   {
-    /* Check that I2C transfer finished */
-    /* if yes, normal use case, a NACK is sent by the MASTER when Transfer is finished */
-    /* Mean XferCount == 0*/
-    /* So clear Flag NACKF only */
-    if (hi2c->XferCount == 0U)
-    {
-      /* Same action must be done for (tmpoptions == I2C_LAST_FRAME) which removed for Warning[Pa134]: left and right operands are identical */
-      if ((hi2c->State == HAL_I2C_STATE_LISTEN) && (tmpoptions == I2C_FIRST_AND_LAST_FRAME))
-      {
-        /* Call I2C Listen complete process */
-        I2C_ITListenCplt(hi2c, tmpITFlags);
-      }
-      else if ((hi2c->State == HAL_I2C_STATE_BUSY_TX_LISTEN) && (tmpoptions != I2C_NO_OPTION_FRAME))
-      {
-        /* Clear NACK Flag */
-        __HAL_I2C_CLEAR_FLAG(hi2c, I2C_FLAG_AF);
+    /* Remove RXNE flag on temporary variable as read done */
+    tmpITFlags &= ~I2C_FLAG_RXNE;
 
-        /* Flush TX register */
-        I2C_Flush_TXDR(hi2c);
+    /* Read data from RXDR */
+    *hi2c->pBuffPtr = (uint8_t)hi2c->Instance->RXDR;
 
-        /* Last Byte is Transmitted */
-        /* Call I2C Slave Sequential complete process */
-        I2C_ITSlaveSeqCplt(hi2c);
-      }
-      else
-      {
-        /* Clear NACK Flag */
-        __HAL_I2C_CLEAR_FLAG(hi2c, I2C_FLAG_AF);
-      }
+    /* Increment Buffer pointer */
+    hi2c->pBuffPtr++;
+
+    hi2c->XferCount--;
+  }
+  else if ((I2C_CHECK_FLAG(tmpITFlags, I2C_FLAG_TXIS) != RESET) && (I2C_CHECK_IT_SOURCE(ITSources, I2C_IT_TXI) != RESET))
+  {
+    /* Write the memory address, MSB first, XferSize holds the number of address bytes left */
+    if (hi2c->XferSize == I2C_MEMADD_SIZE_16BIT)
+    {
+      hi2c->Instance->TXDR = I2C_MEM_ADD_MSB(pop->MemAddress);
     }
     else
     {
-      /* if no, error use case, a Non-Acknowledge of last Data is generated by the MASTER*/
-      /* Clear NACK Flag */
-      __HAL_I2C_CLEAR_FLAG(hi2c, I2C_FLAG_AF);
+      hi2c->Instance->TXDR = I2C_MEM_ADD_LSB(pop->MemAddress);
+    }
 
-      /* Set ErrorCode corresponding to a Non-Acknowledge */
-      hi2c->ErrorCode |= HAL_I2C_ERROR_AF;
+    hi2c->XferSize--;
+  }
+  else if ((I2C_CHECK_FLAG(tmpITFlags, I2C_FLAG_TC) != RESET) && (I2C_CHECK_IT_SOURCE(ITSources, I2C_IT_TCI) != RESET))
+  {
+    if ((hi2c->Instance->CR2 & I2C_CR2_RD_WRN) == 0U)
+    {
+      if (hi2c->XferSize == 0U)
+      {
+        /* Memory address sent: read the data with a repeated START, the last operation ends with a STOP */
+        if (hi2c->BatchCount == 1U)
+        {
+          xfermode = I2C_AUTOEND_MODE;
+        }
+        else
+        {
+          xfermode = I2C_SOFTEND_MODE;
+        }
 
-      if ((tmpoptions == I2C_FIRST_FRAME) || (tmpoptions == I2C_NEXT_FRAME))
+        I2C_TransferConfig(hi2c, pop->DevAddress, (uint8_t)pop->Size, xfermode, I2C_GENERATE_START_READ);
+      }
+      else
       {
+        /* Wrong size Status regarding TC flag event */
         /* Call the corresponding callback to inform upper layer of End of Transfer */
-        I2C_ITError(hi2c, hi2c->ErrorCode);
+        I2C_ITError(hi2c, HAL_I2C_ERROR_SIZE);
       }
     }
-  }
-  else if ((I2C_CHECK_FLAG(tmpITFlags, I2C_FLAG_RXNE) != RESET) && (I2C_CHECK_IT_SOURCE(ITSources, I2C_IT_RXI) != RESET))
-  {
-    if (hi2c->XferCount > 0U)
+    else if (hi2c->XferCount == 0U)
     {
-      /* Read data from RXDR */
-      *hi2c->pBuffPtr = (uint8_t)hi2c->Instance->RXDR;
-
-      /* Increment Buffer pointer */
-      hi2c->pBuffPtr++;
+      /* Operation completed: start the next one with a repeated START */
+      hi2c->pBatchOp++;
+      hi2c->BatchCount--;
 
-      hi2c->XferSize--;
-      hi2c->XferCount--;
+      I2C_BatchStartOp(hi2c);
+    }
+    else
+    {
+      /* Wrong size Status regarding TC flag event */
+      /* Call the corresponding callback to inform upper layer of End of Transfer */
+      I2C_ITError(hi2c, HAL_I2C_ERROR_SIZE);
+    }
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+
+  if ((I2C_CHECK_FLAG(tmpITFlags, I2C_FLAG_STOPF) != RESET) && (I2C_CHECK_IT_SOURCE(ITSources, I2C_IT_STOPI) != RESET))
+  {
+    /* Call I2C batch complete process */
+    I2C_ITBatchCplt(hi2c, tmpITFlags);
+  }
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(hi2c);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Interrupt Sub-Routine which handle the Interrupt Flags of a slave
+  *         register map with DMA.
+  * @param  hi2c Pointer to a I2C_HandleTypeDef structure that contains
+  *                the configuration information for the specified I2C.
+  * @param  ITFlags Interrupt flags to handle.
+  * @param  ITSources Interrupt sources enabled.
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef I2C_RegMap_ISR(struct __I2C_HandleTypeDef *hi2c, uint32_t ITFlags, uint32_t ITSources)
+{
+  I2C_RegMapTypeDef *pmap = hi2c->pRegMap;
+  uint32_t written = 0U;
+  uint16_t offset = 0U;
+
+  if ((I2C_CHECK_FLAG(ITFlags, I2C_FLAG_ADDR) != RESET) && (I2C_CHECK_IT_SOURCE(ITSources, I2C_IT_ADDRI) != RESET))
+  {
+    /* A repeated START ends the previous transfer */
+    written = I2C_RegMapEndTransfer(hi2c, &offset);
+
+    if (I2C_GET_DIR(hi2c) == I2C_DIRECTION_RECEIVE)
+    {
+      /* Master read: stream the registers from the pointer */
+      pmap->Phase = I2C_REGMAP_READ;
+      I2C_Flush_TXDR(hi2c);
+      pmap->DmaSize = pmap->Size - pmap->Pointer;
+      if (HAL_DMA_Start_IT(hi2c->hdmatx, (uint32_t)&pmap->pRegion[pmap->Pointer], (uint32_t)&hi2c->Instance->TXDR,
+                           pmap->DmaSize) == HAL_OK)
+      {
+        hi2c->Instance->CR1 |= I2C_CR1_TXDMAEN;
+      }
+      else
+      {
+        pmap->DmaSize = 0U;
+        I2C_Enable_IRQ(hi2c, I2C_XFER_TX_IT);
+      }
+    }
+    else
+    {
+      /* Master write: the register address comes first */
+      pmap->Phase = I2C_REGMAP_ADDRESS;
+      pmap->AddressLeft = pmap->AddressSize;
+      pmap->NewPointer = 0U;
+      pmap->DmaSize = 0U;
+      I2C_Enable_IRQ(hi2c, I2C_XFER_RX_IT);
+    }
+
+    /* Release the clock stretching */
+    __HAL_I2C_CLEAR_FLAG(hi2c, I2C_FLAG_ADDR);
+  }
+  else if ((I2C_CHECK_FLAG(ITFlags, I2C_FLAG_RXNE) != RESET) && (I2C_CHECK_IT_SOURCE(ITSources, I2C_IT_RXI) != RESET))
+  {
+    if (pmap->Phase == I2C_REGMAP_ADDRESS)
+    {
+      pmap->NewPointer = (uint16_t)((pmap->NewPointer << 8U) | (uint8_t)hi2c->Instance->RXDR);
+      pmap->AddressLeft--;
+
+      if (pmap->AddressLeft == 0U)
+      {
+        /* Receive the data from the register address with the DMA */
+        pmap->Pointer = pmap->NewPointer % pmap->Size;
+        pmap->Phase = I2C_REGMAP_WRITE;
+        pmap->DmaSize = pmap->Size - pmap->Pointer;
+        if (HAL_DMA_Start_IT(hi2c->hdmarx, (uint32_t)&hi2c->Instance->RXDR, (uint32_t)&pmap->pScratch[pmap->Pointer],
+                             pmap->DmaSize) == HAL_OK)
+        {
+          I2C_Disable_IRQ(hi2c, I2C_XFER_RX_IT);
+          hi2c->Instance->CR1 |= I2C_CR1_RXDMAEN;
+        }
+        else
+        {
+          pmap->DmaSize = 0U;
+        }
+      }
+    }
+    else
+    {
+      /* Past the end of the region */
+      (void)hi2c->Instance->RXDR;
+    }
+  }
+  else if ((I2C_CHECK_FLAG(ITFlags, I2C_FLAG_TXIS) != RESET) && (I2C_CHECK_IT_SOURCE(ITSources, I2C_IT_TXI) != RESET))
+  {
+    /* Past the end of the region */
+    hi2c->Instance->TXDR = 0xFFU;
+  }
+  else if ((I2C_CHECK_FLAG(ITFlags, I2C_FLAG_AF) != RESET) && (I2C_CHECK_IT_SOURCE(ITSources, I2C_IT_NACKI) != RESET))
+  {
+    /* The master ends its read with a NACK */
+    __HAL_I2C_CLEAR_FLAG(hi2c, I2C_FLAG_AF);
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+
+  if ((I2C_CHECK_FLAG(ITFlags, I2C_FLAG_STOPF) != RESET) && (I2C_CHECK_IT_SOURCE(ITSources, I2C_IT_STOPI) != RESET))
+  {
+    __HAL_I2C_CLEAR_FLAG(hi2c, I2C_FLAG_STOPF);
+    written = I2C_RegMapEndTransfer(hi2c, &offset);
+  }
+
+  /* Report the registers written once the clock stretching is released */
+  if (written != 0U)
+  {
+    HAL_I2C_RegMapWriteCallback(hi2c, offset, (uint16_t)written);
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Interrupt Sub-Routine which handle the Interrupt Flags Slave Mode with Interrupt.
+  * @param  hi2c Pointer to a I2C_HandleTypeDef structure that contains
+  *                the configuration information for the specified I2C.
+  * @param  ITFlags Interrupt flags to handle.
+  * @param  ITSources Interrupt sources enabled.
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef I2C_Slave_ISR_IT(struct __I2C_HandleTypeDef *hi2c, uint32_t ITFlags, uint32_t ITSources)
+{
+  uint32_t tmpoptions = hi2c->XferOptions;
+  uint32_t tmpITFlags = ITFlags;
+
+  /* Process locked */
+  __HAL_LOCK(hi2c);
+
+  /* Check if STOPF is set */
+  if ((I2C_CHECK_FLAG(tmpITFlags, I2C_FLAG_STOPF) != RESET) && (I2C_CHECK_IT_SOURCE(ITSources, I2C_IT_STOPI) != RESET))
+  {
+    /* Call I2C Slave complete process */
+    I2C_ITSlaveCplt(hi2c, tmpITFlags);
+  }
+
+  if ((I2C_CHECK_FLAG(tmpITFlags, I2C_FLAG_AF) != RESET) && (I2C_CHECK_IT_SOURCE(ITSources, I2C_IT_NACKI) != RESET))
+  {
+    /* Check that I2C transfer finished */
+    /* if yes, normal use case, a NACK is sent by the MASTER when Transfer is finished */
+    /* Mean XferCount == 0*/
+    /* So clear Flag NACKF only */
+    if (hi2c->XferCount == 0U)
+    {
+      /* Same action must be done for (tmpoptions == I2C_LAST_FRAME) which removed for Warning[Pa134]: left and right operands are identical */
+      if ((hi2c->State == HAL_I2C_STATE_LISTEN) && (tmpoptions == I2C_FIRST_AND_LAST_FRAME))
+      {
+        /* Call I2C Listen complete process */
+        I2C_ITListenCplt(hi2c, tmpITFlags);
+      }
+      else if ((hi2c->State == HAL_I2C_STATE_BUSY_TX_LISTEN) && (tmpoptions != I2C_NO_OPTION_FRAME))
+      {
+        /* Clear NACK Flag */
+        __HAL_I2C_CLEAR_FLAG(hi2c, I2C_FLAG_AF);
+
+        /* Flush TX register */
+        I2C_Flush_TXDR(hi2c);
+
+        /* Last Byte is Transmitted */
+        /* Call I2C Slave Sequential complete process */
+        I2C_ITSlaveSeqCplt(hi2c);
+      }
+      else
+      {
+        /* Clear NACK Flag */
+        __HAL_I2C_CLEAR_FLAG(hi2c, I2C_FLAG_AF);
+      }
+    }
+    else
+    {
+      /* if no, error use case, a Non-Acknowledge of last Data is generated by the MASTER*/
+      /* Clear NACK Flag */
+      __HAL_I2C_CLEAR_FLAG(hi2c, I2C_FLAG_AF);
+
+      /* Set ErrorCode corresponding to a Non-Acknowledge */
+      hi2c->ErrorCode |= HAL_I2C_ERROR_AF;
+
+      if ((tmpoptions == I2C_FIRST_FRAME) || (tmpoptions == I2C_NEXT_FRAME))
+      {
+        /* Call the corresponding callback to inform upper layer of End of Transfer */
+        I2C_ITError(hi2c, hi2c->ErrorCode);
+      }
+    }
+  }
+  else if ((I2C_CHECK_FLAG(tmpITFlags, I2C_FLAG_RXNE) != RESET) && (I2C_CHECK_IT_SOURCE(ITSources, I2C_IT_RXI) != RESET))
+  {
+    if (hi2c->XferCount > 0U)
+    {
+      /* Read data from RXDR */
+      *hi2c->pBuffPtr = (uint8_t)hi2c->Instance->RXDR;
+
+      /* Increment Buffer pointer */
+      hi2c->pBuffPtr++;
+
+      hi2c->XferSize--;
+      hi2c->XferCount--;
     }
 
     if ((hi2c->XferCount == 0U) && \
@@ -4926,9 +5449,6 @@ static HAL_StatusTypeDef I2C_Master_ISR_DMA(struct __I2C_HandleTypeDef *hi2c, ui
   }
   else if ((I2C_CHECK_FLAG(ITFlags, I2C_FLAG_TCR) != RESET) && (I2C_CHECK_IT_SOURCE(ITSources, I2C_IT_TCI) != RESET))
   {
-    /* Disable TC interrupt */
-    __HAL_I2C_DISABLE_IT(hi2c, I2C_IT_TCI);
-
     if (hi2c->XferCount != 0U)
     {
       /* Recover Slave address */
@@ -4953,24 +5473,23 @@ static HAL_StatusTypeDef I2C_Master_ISR_DMA(struct __I2C_HandleTypeDef *hi2c, ui
         }
       }
 
-      /* Set the new XferSize in Nbytes register */
-      I2C_TransferConfig(hi2c, devaddress, (uint8_t)hi2c->XferSize, xfermode, I2C_NO_STARTSTOP);
-
-      /* Update XferCount value */
+      /* Update XferCount value before the reload, the DMA may end as soon as NBYTES is written */
       hi2c->XferCount -= hi2c->XferSize;
 
-      /* Enable DMA Request */
-      if (hi2c->State == HAL_I2C_STATE_BUSY_RX)
+      if (hi2c->XferCount == 0U)
       {
-        hi2c->Instance->CR1 |= I2C_CR1_RXDMAEN;
-      }
-      else
-      {
-        hi2c->Instance->CR1 |= I2C_CR1_TXDMAEN;
+        /* Last reload: TC interrupt is enabled again at end of DMA transfer */
+        __HAL_I2C_DISABLE_IT(hi2c, I2C_IT_TCI);
       }
+
+      /* Set the new XferSize in Nbytes register, the DMA request is kept enabled */
+      I2C_TransferConfig(hi2c, devaddress, (uint8_t)hi2c->XferSize, xfermode, I2C_NO_STARTSTOP);
     }
     else
     {
+      /* Disable TC interrupt */
+      __HAL_I2C_DISABLE_IT(hi2c, I2C_IT_TCI);
+
       /* Call TxCpltCallback() if no stop mode is set */
       if (I2C_GET_STOP_MODE(hi2c) != I2C_AUTOEND_MODE)
       {
@@ -5271,6 +5790,119 @@ static HAL_StatusTypeDef I2C_RequestMemoryRead(I2C_HandleTypeDef *hi2c, uint16_t
   return HAL_OK;
 }
 
+/**
+  * @brief  Start the current operation of a memory batch read: program the
+  *         memory address write and generate a START or repeated START condition.
+  * @param  hi2c Pointer to a I2C_HandleTypeDef structure that contains
+  *                the configuration information for the specified I2C.
+  * @retval None
+  */
+static void I2C_BatchStartOp(I2C_HandleTypeDef *hi2c)
+{
+  const I2C_BatchOpTypeDef *pop = hi2c->pBatchOp;
+
+  /* Prepare transfer parameters, XferSize counts the memory address bytes */
+  hi2c->pBuffPtr  = pop->pData;
+  hi2c->XferCount = pop->Size;
+  hi2c->XferSize  = pop->MemAddSize;
+
+  I2C_TransferConfig(hi2c, pop->DevAddress, (uint8_t)pop->MemAddSize, I2C_SOFTEND_MODE, I2C_GENERATE_START_WRITE);
+}
+
+/**
+  * @brief  End the register map transfer in progress, on a STOP or repeated START.
+  * @note   For a write, the bytes received are merged into the region with the
+  *         write mask. For a read, the pointer is advanced by the bytes sent,
+  *         the byte left in TXDR excluded.
+  * @param  hi2c I2C handle.
+  * @param  pOffset First register written, set for a write.
+  * @retval Number of registers written
+  */
+static uint32_t I2C_RegMapEndTransfer(I2C_HandleTypeDef *hi2c, uint16_t *pOffset)
+{
+  I2C_RegMapTypeDef *pmap = hi2c->pRegMap;
+  uint32_t count = 0U;
+  uint32_t index;
+  uint32_t offset;
+  uint32_t phase = pmap->Phase;
+
+  if (phase == I2C_REGMAP_WRITE)
+  {
+    hi2c->Instance->CR1 &= ~I2C_CR1_RXDMAEN;
+    if (pmap->DmaSize != 0U)
+    {
+      count = pmap->DmaSize - __HAL_DMA_GET_COUNTER(hi2c->hdmarx);
+      (void)HAL_DMA_Abort(hi2c->hdmarx);
+    }
+
+    offset = pmap->Pointer;
+    for (index = offset; index < (offset + count); index++)
+    {
+      if (pmap->pWriteMask == NULL)
+      {
+        pmap->pRegion[index] = pmap->pScratch[index];
+      }
+      else
+      {
+        pmap->pRegion[index] = (uint8_t)((pmap->pRegion[index] & ~pmap->pWriteMask[index]) |
+                                         (pmap->pScratch[index] & pmap->pWriteMask[index]));
+      }
+    }
+    pmap->Pointer = (uint16_t)((offset + count) % pmap->Size);
+    *pOffset = (uint16_t)offset;
+  }
+  else if (phase == I2C_REGMAP_READ)
+  {
+    hi2c->Instance->CR1 &= ~I2C_CR1_TXDMAEN;
+    if (pmap->DmaSize != 0U)
+    {
+      count = pmap->DmaSize - __HAL_DMA_GET_COUNTER(hi2c->hdmatx);
+      (void)HAL_DMA_Abort(hi2c->hdmatx);
+
+      /* A byte still in TXDR has not been read by the master */
+      if ((count != 0U) && (__HAL_I2C_GET_FLAG(hi2c, I2C_FLAG_TXE) == RESET))
+      {
+        count--;
+      }
+    }
+    I2C_Flush_TXDR(hi2c);
+    pmap->Pointer = (uint16_t)((pmap->Pointer + count) % pmap->Size);
+    count = 0U;
+  }
+  else
+  {
+    /* Idle, or register address only */
+  }
+
+  I2C_Disable_IRQ(hi2c, I2C_XFER_TX_IT | I2C_XFER_RX_IT);
+
+  /* Keep listening */
+  I2C_Enable_IRQ(hi2c, I2C_XFER_LISTEN_IT);
+  pmap->Phase = I2C_REGMAP_IDLE;
+  pmap->DmaSize = 0U;
+
+  return count;
+}
+
+/**
+  * @brief  Abort the register map transfer in progress, without merging.
+  * @param  hi2c I2C handle.
+  * @retval None
+  */
+static void I2C_RegMapAbort(I2C_HandleTypeDef *hi2c)
+{
+  hi2c->Instance->CR1 &= ~(I2C_CR1_TXDMAEN | I2C_CR1_RXDMAEN);
+  if (hi2c->pRegMap->DmaSize != 0U)
+  {
+    (void)HAL_DMA_Abort(hi2c->hdmatx);
+    (void)HAL_DMA_Abort(hi2c->hdmarx);
+  }
+  I2C_Flush_TXDR(hi2c);
+
+  hi2c->pRegMap->Phase = I2C_REGMAP_IDLE;
+  hi2c->pRegMap->DmaSize = 0U;
+}
+
 /**
   * @brief  I2C Address complete process callback.
   * @param  hi2c I2C handle.
@@ -5795,6 +6427,65 @@ static void I2C_ITSlaveCplt(I2C_HandleTypeDef *hi2c, uint32_t ITFlags)
   }
 }
 
+/**
+  * @brief  I2C memory batch read complete process.
+  * @param  hi2c I2C handle.
+  * @param  ITFlags Interrupt flags to handle.
+  * @retval None
+  */
+static void I2C_ITBatchCplt(I2C_HandleTypeDef *hi2c, uint32_t ITFlags)
+{
+  uint32_t tmperror;
+
+  /* Clear STOP Flag */
+  __HAL_I2C_CLEAR_FLAG(hi2c, I2C_FLAG_STOPF);
+
+  /* Disable Interrupts and Store Previous state */
+  I2C_Disable_IRQ(hi2c, I2C_XFER_TX_IT | I2C_XFER_RX_IT);
+  hi2c->PreviousState = I2C_STATE_MASTER_BUSY_RX;
+
+  /* Clear Configuration Register 2 */
+  I2C_RESET_CR2(hi2c);
+
+  /* Reset handle parameters */
+  hi2c->XferISR       = NULL;
+  hi2c->XferOptions   = I2C_NO_OPTION_FRAME;
+
+  if (I2C_CHECK_FLAG(ITFlags, I2C_FLAG_AF) != RESET)
+  {
+    /* Clear NACK Flag */
+    __HAL_I2C_CLEAR_FLAG(hi2c, I2C_FLAG_AF);
+
+    /* Set acknowledge error code */
+    hi2c->ErrorCode |= HAL_I2C_ERROR_AF;
+  }
+
+  /* Flush TX register */
+  I2C_Flush_TXDR(hi2c);
+
+  /* Store current volatile hi2c->ErrorCode, misra rule */
+  tmperror = hi2c->ErrorCode;
+
+  if ((hi2c->State == HAL_I2C_STATE_ABORT) || (tmperror != HAL_I2C_ERROR_NONE))
+  {
+    /* Call the corresponding callback to inform upper layer of End of Transfer */
+    I2C_ITError(hi2c, hi2c->ErrorCode);
+  }
+  else
+  {
+    hi2c->State = HAL_I2C_STATE_READY;
+    hi2c->PreviousState = I2C_STATE_NONE;
+    hi2c->Mode = HAL_I2C_MODE_NONE;
+    hi2c->BatchCount = 0U;
+
+    /* Process Unlocked */
+    __HAL_UNLOCK(hi2c);
+
+    /* Call the corresponding callback to inform upper layer of End of Transfer */
+    HAL_I2C_MemBatchCpltCallback(hi2c);
+  }
+}
+
 /**
   * @brief  I2C Listen complete process.
   * @param  hi2c I2C handle.
@@ -6030,40 +6721,8 @@ static void I2C_DMAMasterTransmitCplt(DMA_HandleTypeDef *hdma)
   /* Disable DMA Request */
   hi2c->Instance->CR1 &= ~I2C_CR1_TXDMAEN;
 
-  /* If last transfer, enable STOP interrupt */
-  if (hi2c->XferCount == 0U)
-  {
-    /* Enable STOP interrupt */
-    I2C_Enable_IRQ(hi2c, I2C_XFER_CPLT_IT);
-  }
-  /* else prepare a new DMA transfer and enable TCReload interrupt */
-  else
-  {
-    /* Update Buffer pointer */
-    hi2c->pBuffPtr += hi2c->XferSize;
-
-    /* Set the XferSize to transfer */
-    if (hi2c->XferCount > MAX_NBYTE_SIZE)
-    {
-      hi2c->XferSize = MAX_NBYTE_SIZE;
-    }
-    else
-    {
-      hi2c->XferSize = hi2c->XferCount;
-    }
-
-    /* Enable the DMA channel */
-    if (HAL_DMA_Start_IT(hi2c->hdmatx, (uint32_t)hi2c->pBuffPtr, (uint32_t)&hi2c->Instance->TXDR, hi2c->XferSize) != HAL_OK)
-    {
-      /* Call the corresponding callback to inform upper layer of End of Transfer */
-      I2C_ITError(hi2c, HAL_I2C_ERROR_DMA);
-    }
-    else
-    {
-      /* Enable TC interrupts */
-      I2C_Enable_IRQ(hi2c, I2C_XFER_RELOAD_IT);
-    }
-  }
+  /* The DMA transfer covers the whole buffer: all the NBYTES reloads are done, enable STOP interrupt */
+  I2C_Enable_IRQ(hi2c, I2C_XFER_CPLT_IT);
 }
 
 /**
@@ -6105,40 +6764,8 @@ static void I2C_DMAMasterReceiveCplt(DMA_HandleTypeDef *hdma)
   /* Disable DMA Request */
   hi2c->Instance->CR1 &= ~I2C_CR1_RXDMAEN;
 
-  /* If last transfer, enable STOP interrupt */
-  if (hi2c->XferCount == 0U)
-  {
-    /* Enable STOP interrupt */
-    I2C_Enable_IRQ(hi2c, I2C_XFER_CPLT_IT);
-  }
-  /* else prepare a new DMA transfer and enable TCReload interrupt */
-  else
-  {
-    /* Update Buffer pointer */
-    hi2c->pBuffPtr += hi2c->XferSize;
-
-    /* Set the XferSize to transfer */
-    if (hi2c->XferCount > MAX_NBYTE_SIZE)
-    {
-      hi2c->XferSize = MAX_NBYTE_SIZE;
-    }
-    else
-    {
-      hi2c->XferSize = hi2c->XferCount;
-    }
-
-    /* Enable the DMA channel */
-    if (HAL_DMA_Start_IT(hi2c->hdmarx, (uint32_t)&hi2c->Instance->RXDR, (uint32_t)hi2c->pBuffPtr, hi2c->XferSize) != HAL_OK)
-    {
-      /* Call the corresponding callback to inform upper layer of End of Transfer */
-      I2C_ITError(hi2c, HAL_I2C_ERROR_DMA);
-    }
-    else
-    {
-      /* Enable TC interrupts */
-      I2C_Enable_IRQ(hi2c, I2C_XFER_RELOAD_IT);
-    }
-  }
+  /* The DMA transfer covers the whole buffer: all the NBYTES reloads are done, enable STOP interrupt */
+  I2C_Enable_IRQ(hi2c, I2C_XFER_CPLT_IT);
 }
 
 /**
@@ -6207,6 +6834,69 @@ static void I2C_DMAAbort(DMA_HandleTypeDef *hdma)
   I2C_TreatErrorCallback(hi2c);
 }
 
+/**
+  * @brief  DMA I2C register map transmit complete callback: the end of the
+  *         region has been sent, the next bytes are sent by interrupt.
+  * @param  hdma DMA handle
+  * @retval None
+  */
+static void I2C_DMARegMapTransmitCplt(DMA_HandleTypeDef *hdma)
+{
+  I2C_HandleTypeDef *hi2c = (I2C_HandleTypeDef *)(((DMA_HandleTypeDef *)hdma)->Parent); /* Derogation MISRAC2012-Rule-11.5 */
+
+  hi2c->Instance->CR1 &= ~I2C_CR1_TXDMAEN;
+  I2C_Enable_IRQ(hi2c, I2C_XFER_TX_IT);
+}
+
+/**
+  * @brief  DMA I2C register map receive complete callback: the end of the
+  *         region has been written, the next bytes are discarded by interrupt.
+  * @param  hdma DMA handle
+  * @retval None
+  */
+static void I2C_DMARegMapReceiveCplt(DMA_HandleTypeDef *hdma)
+{
+  I2C_HandleTypeDef *hi2c = (I2C_HandleTypeDef *)(((DMA_HandleTypeDef *)hdma)->Parent); /* Derogation MISRAC2012-Rule-11.5 */
+
+  hi2c->Instance->CR1 &= ~I2C_CR1_RXDMAEN;
+  I2C_Enable_IRQ(hi2c, I2C_XFER_RX_IT);
+}
+
+/**
+  * @brief  DMA I2C register map error callback: the transfer is discarded and
+  *         the register map keeps listening.
+  * @param  hdma DMA handle
+  * @retval None
+  */
+static void I2C_DMARegMapError(DMA_HandleTypeDef *hdma)
+{
+  I2C_HandleTypeDef *hi2c = (I2C_HandleTypeDef *)(((DMA_HandleTypeDef *)hdma)->Parent); /* Derogation MISRAC2012-Rule-11.5 */
+
+  hi2c->ErrorCode |= HAL_I2C_ERROR_DMA;
+  I2C_RegMapError(hi2c);
+}
+
+/**
+  * @brief  I2C register map error process: the transfer in progress is
+  *         discarded, the register map keeps listening.
+  * @param  hi2c I2C handle.
+  * @retval None
+  */
+static void I2C_RegMapError(I2C_HandleTypeDef *hi2c)
+{
+  /* Discard the end of the transfer, the master gets NACKs until the STOP */
+  I2C_RegMapAbort(hi2c);
+  I2C_Disable_IRQ(hi2c, I2C_XFER_TX_IT | I2C_XFER_RX_IT);
+  I2C_Enable_IRQ(hi2c, I2C_XFER_LISTEN_IT);
+
+  /* Call the corresponding callback to inform upper layer of the error */
+#if (USE_HAL_I2C_REGISTER_CALLBACKS == 1)
+  hi2c->ErrorCallback(hi2c);
+#else
+  HAL_I2C_ErrorCallback(hi2c);
+#endif /* USE_HAL_I2C_REGISTER_CALLBACKS */
+}
+
 /**
   * @brief  This function handles I2C Communication Timeout.
   * @param  hi2c Pointer to a I2C_HandleTypeDef structure that contains
@@ -6222,6 +6912,9 @@ static HAL_StatusTypeDef I2C_WaitOnFlagUntilTimeout(I2C_HandleTypeDef *hi2c, uin
 {
   while (__HAL_I2C_GET_FLAG(hi2c, Flag) == Status)
   {
+    /* Let the application yield or sleep while waiting */
+    HAL_WaitHook(HAL_WAIT_I2C, hi2c);
+
     /* Check for the Timeout */
     if (Timeout != HAL_MAX_DELAY)
     {
@@ -6252,6 +6945,9 @@ static HAL_StatusTypeDef I2C_WaitOnTXISFlagUntilTimeout(I2C_HandleTypeDef *hi2c,
 {
   while (__HAL_I2C_GET_FLAG(hi2c, I2C_FLAG_TXIS) == RESET)
   {
+    /* Let the application yield or sleep while waiting */
+    HAL_WaitHook(HAL_WAIT_I2C, hi2c);
+
     /* Check if a NACK is detected */
     if (I2C_IsAcknowledgeFailed(hi2c, Timeout, Tickstart) != HAL_OK)
     {
@@ -6289,6 +6985,9 @@ static HAL_StatusTypeDef I2C_WaitOnSTOPFlagUntilTimeout(I2C_HandleTypeDef *hi2c,
 {
   while (__HAL_I2C_GET_FLAG(hi2c, I2C_FLAG_STOPF) == RESET)
   {
+    /* Let the application yield or sleep while waiting */
+    HAL_WaitHook(HAL_WAIT_I2C, hi2c);
+
     /* Check if a NACK is detected */
     if (I2C_IsAcknowledgeFailed(hi2c, Timeout, Tickstart) != HAL_OK)
     {
@@ -6323,6 +7022,9 @@ static HAL_StatusTypeDef I2C_WaitOnRXNEFlagUntilTimeout(I2C_HandleTypeDef *hi2c,
 {
   while (__HAL_I2C_GET_FLAG(hi2c, I2C_FLAG_RXNE) == RESET)
   {
+    /* Let the application yield or sleep while waiting */
+    HAL_WaitHook(HAL_WAIT_I2C, hi2c);
+
     /* Check if a NACK is detected */
     if (I2C_IsAcknowledgeFailed(hi2c, Timeout, Tickstart) != HAL_OK)
     {
@@ -19,6 +19,7 @@
        (+) Use of a configured Digital Noise Filter
        (+) Disable or enable wakeup from Stop mode(s)
        (+) Disable or enable Fast Mode Plus
+       (+) Computation of the I2C_TIMINGR value from the bus characteristics
 
                      ##### How to use this driver #####
   ==============================================================================
@@ -31,6 +32,10 @@
     (#) Configure the enable or disable of fast mode plus driving capability using the functions :
           (++) HAL_I2CEx_EnableFastModePlus()
           (++) HAL_I2CEx_DisableFastModePlus()
+    (#) Compute the Init.Timing value to give to HAL_I2C_Init() :
+          (++) At compile time with the __HAL_I2C_CALC_TIMING() macro
+          (++) At runtime with HAL_I2CEx_ComputeTiming(), or HAL_I2CEx_GetTiming() which
+               keeps the last I2C_TIMING_CACHE_SIZE results in a lookup table
   @endverbatim
   ******************************************************************************
   * @attention
@@ -61,9 +66,44 @@
 #ifdef HAL_I2C_MODULE_ENABLED
 
 /* Private typedef -----------------------------------------------------------*/
+/** @defgroup I2CEx_Private_Types I2C Extended Private Types
+  * @{
+  */
+typedef struct
+{
+  uint32_t I2cClock;            /*!< I2C kernel clock frequency in Hz, 0 for a free entry */
+  uint32_t Speed;               /*!< SCL frequency in Hz                                  */
+  uint32_t RiseTime;            /*!< Rise time in ns                                      */
+  uint32_t FallTime;            /*!< Fall time in ns                                      */
+  uint32_t Filters;             /*!< Analog filter setting ORed with digital filter value */
+  uint32_t Timing;              /*!< Computed I2C_TIMINGR value                           */
+} I2C_TimingCacheTypeDef;
+/**
+  * @}
+  */
+
 /* Private define ------------------------------------------------------------*/
+/** @defgroup I2CEx_Private_Define I2C Extended Private Define
+  * @{
+  */
+#if !defined(I2C_TIMING_CACHE_SIZE)
+#define I2C_TIMING_CACHE_SIZE           4U    /*!< Number of timings kept by HAL_I2CEx_GetTiming() */
+#endif /* I2C_TIMING_CACHE_SIZE */
+/**
+  * @}
+  */
+
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
+/** @defgroup I2CEx_Private_Variables I2C Extended Private Variables
+  * @{
+  */
+static I2C_TimingCacheTypeDef I2C_TimingCache[I2C_TIMING_CACHE_SIZE];
+static uint32_t I2C_TimingCacheNext = 0U;
+/**
+  * @}
+  */
+
 /* Private function prototypes -----------------------------------------------*/
 /* Private functions ---------------------------------------------------------*/
 
@@ -319,6 +359,154 @@ void HAL_I2CEx_DisableFastModePlus(uint32_t ConfigFastModePlus)
   CLEAR_BIT(SYSCFG->CFGR1, (uint32_t)ConfigFastModePlus);
 }
 
+/**
+  * @}
+  */
+
+/** @defgroup I2CEx_Exported_Functions_Group4 Timing computation functions
+  * @brief    Timing computation functions
+  *
+@verbatim
+ ===============================================================================
+                      ##### Timing computation functions #####
+ ===============================================================================
+    [..] This section provides functions allowing to:
+      (+) Compute the I2C_TIMINGR value from the I2C kernel clock, the SCL frequency,
+          the rise and fall times and the noise filters settings
+      (+) Get a computed value from a lookup table of the last results
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Compute the I2C_TIMINGR register value from the bus characteristics.
+  * @note   Every prescaler value for which the SCLL, SCLH, SCLDEL and SDADEL counters
+  *         meet the I2C-bus specification is evaluated, the one giving the SCL
+  *         period nearest to the requested one is kept. The SCL frequency does
+  *         not exceed the requested one.
+  * @param  I2cClock I2C kernel clock frequency in Hz.
+  * @param  Speed SCL frequency in Hz, up to 1000000 (Fast-mode Plus).
+  * @param  RiseTime SCL and SDA rise time in ns.
+  * @param  FallTime SCL and SDA fall time in ns.
+  * @param  AnalogFilter Analog filter setting.
+  *         This parameter can be one of the @ref I2CEx_Analog_Filter values
+  * @param  DigitalFilter Digital filter setting, between Min_Data=0x00 and Max_Data=0x0F.
+  * @retval I2C_TIMINGR value, 0 when no setting meets the I2C-bus specification.
+  */
+uint32_t HAL_I2CEx_ComputeTiming(uint32_t I2cClock, uint32_t Speed, uint32_t RiseTime, uint32_t FallTime,
+                                 uint32_t AnalogFilter, uint32_t DigitalFilter)
+{
+  uint32_t tclk;
+  uint32_t tscl;
+  uint32_t tsync;
+  uint32_t tlow;
+  uint32_t thigh;
+  uint32_t tscldel;
+  uint32_t tsdadel;
+  int32_t  tsdadelmax;
+  uint32_t presc1;
+  uint32_t tpresc;
+  uint32_t scll;
+  uint32_t sclh;
+  uint32_t period;
+  uint32_t error;
+  uint32_t besterror = 0xFFFFFFFFU;
+  uint32_t timing = 0U;
+
+  /* Check the parameters */
+  assert_param(IS_I2C_ANALOG_FILTER(AnalogFilter));
+  assert_param(IS_I2C_DIGITAL_FILTER(DigitalFilter));
+
+  if ((I2cClock == 0U) || (Speed == 0U) || (Speed > 1000000U))
+  {
+    return 0U;
+  }
+
+  tclk       = I2C_TIMING_CLK_PS(I2cClock);
+  tscl       = (uint32_t)(1000000000000ULL / Speed);
+  tsync      = I2C_TIMING_SYNC(I2cClock, RiseTime, FallTime, AnalogFilter, DigitalFilter);
+  tlow       = I2C_TIMING_LOW(I2cClock, Speed, RiseTime, FallTime, AnalogFilter, DigitalFilter);
+  thigh      = I2C_TIMING_HIGH(I2cClock, Speed, RiseTime, FallTime, AnalogFilter, DigitalFilter);
+  tscldel    = I2C_TIMING_SCLDEL_MIN(Speed, RiseTime);
+  tsdadel    = I2C_TIMING_SDADEL_MIN(I2cClock, FallTime, AnalogFilter, DigitalFilter);
+  tsdadelmax = I2C_TIMING_SDADEL_MAX(I2cClock, Speed, RiseTime, AnalogFilter, DigitalFilter);
+
+  /* Larger prescalers still fit the counters, with a coarser resolution */
+  for (presc1 = I2C_TIMING_PRESC1(I2cClock, Speed, RiseTime, FallTime, AnalogFilter, DigitalFilter);
+       presc1 <= 16U; presc1++)
+  {
+    tpresc = presc1 * tclk;
+
+    if ((int32_t)(I2C_TIMING_CEIL(tsdadel, tpresc) * tpresc) <= tsdadelmax)
+    {
+      scll   = I2C_TIMING_CEIL(tlow, tpresc);
+      sclh   = I2C_TIMING_CEIL(thigh, tpresc);
+      period = ((scll + sclh) * tpresc) + tsync;
+      error  = (period > tscl) ? (period - tscl) : (tscl - period);
+
+      if (error < besterror)
+      {
+        besterror = error;
+        timing = ((presc1 - 1U) << I2C_TIMINGR_PRESC_Pos)                              |
+                 ((I2C_TIMING_CEIL(tscldel, tpresc) - 1U) << I2C_TIMINGR_SCLDEL_Pos) |
+                 (I2C_TIMING_CEIL(tsdadel, tpresc) << I2C_TIMINGR_SDADEL_Pos)         |
+                 ((sclh - 1U) << I2C_TIMINGR_SCLH_Pos)                                |
+                 ((scll - 1U) << I2C_TIMINGR_SCLL_Pos);
+      }
+    }
+  }
+
+  return timing;
+}
+
+/**
+  * @brief  Get the I2C_TIMINGR register value from the bus characteristics.
+  * @note   The result of HAL_I2CEx_ComputeTiming() is kept in a lookup table of
+  *         I2C_TIMING_CACHE_SIZE entries, the oldest entry being replaced. Calling
+  *         again with the same parameters, e.g. at each I2C re-initialization,
+  *         costs a table search only.
+  * @note   The lookup table is not protected against concurrent accesses.
+  * @param  I2cClock I2C kernel clock frequency in Hz.
+  * @param  Speed SCL frequency in Hz, up to 1000000 (Fast-mode Plus).
+  * @param  RiseTime SCL and SDA rise time in ns.
+  * @param  FallTime SCL and SDA fall time in ns.
+  * @param  AnalogFilter Analog filter setting.
+  *         This parameter can be one of the @ref I2CEx_Analog_Filter values
+  * @param  DigitalFilter Digital filter setting, between Min_Data=0x00 and Max_Data=0x0F.
+  * @retval I2C_TIMINGR value, 0 when no setting meets the I2C-bus specification.
+  */
+uint32_t HAL_I2CEx_GetTiming(uint32_t I2cClock, uint32_t Speed, uint32_t RiseTime, uint32_t FallTime,
+                             uint32_t AnalogFilter, uint32_t DigitalFilter)
+{
+  I2C_TimingCacheTypeDef *pentry;
+  uint32_t filters = AnalogFilter | DigitalFilter;
+  uint32_t index;
+
+  for (index = 0U; index < I2C_TIMING_CACHE_SIZE; index++)
+  {
+    pentry = &I2C_TimingCache[index];
+
+    if ((pentry->I2cClock == I2cClock) && (pentry->Speed == Speed) && (pentry->RiseTime == RiseTime) &&
+        (pentry->FallTime == FallTime) && (pentry->Filters == filters))
+    {
+      return pentry->Timing;
+    }
+  }
+
+  pentry = &I2C_TimingCache[I2C_TimingCacheNext];
+  I2C_TimingCacheNext = (I2C_TimingCacheNext + 1U) % I2C_TIMING_CACHE_SIZE;
+
+  pentry->Timing   = HAL_I2CEx_ComputeTiming(I2cClock, Speed, RiseTime, FallTime, AnalogFilter, DigitalFilter);
+  pentry->I2cClock = I2cClock;
+  pentry->Speed    = Speed;
+  pentry->RiseTime = RiseTime;
+  pentry->FallTime = FallTime;
+  pentry->Filters  = filters;
+
+  return pentry->Timing;
+}
+
 /**
   * @}
   */
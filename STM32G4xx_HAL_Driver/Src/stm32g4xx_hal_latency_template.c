@@ -0,0 +1,598 @@
+/**
+  ******************************************************************************
+  * @file    stm32g4xx_hal_latency_template.c
+  * @author  MCD Application Team
+  * @brief   HAL interrupt latency measurement template.
+  *
+  *          This file measures the interrupt latency of the HAL ISR paths on target:
+  *           + Delay from a timer compare event to the ISR entry
+  *           + Delay from the same event to the HAL callback
+  *           + External cross-check of the ISR entry through a GPIO loopback
+  *             captured by a second timer channel
+  *           + ISR entry and callback delays of any other IRQ (SysTick, EXTI,
+  *             DMA, UART, USB...) pended by software
+  *          Each path is reported as one machine-readable record with its
+  *          minimum, maximum, average and histogram.
+  *
+ @verbatim
+  ==============================================================================
+                        ##### How to use this driver #####
+  ==============================================================================
+    [..]
+    This file must be copied to the application folder and modified as follows:
+    (#) Rename it to 'stm32g4xx_hal_latency.c'
+    (#) Add this file and the TIM and GPIO HAL driver files to your project and make
+        sure HAL_TIM_MODULE_ENABLED and HAL_GPIO_MODULE_ENABLED are defined in
+        stm32g4xx_hal_conf.h
+    (#) Set the LAT_xxx defines of the "Latency configuration" section. The timer
+        must be a 32-bit one (TIM2 or TIM5). Wire LAT_OUT_PIN to LAT_IN_PIN, the
+        input capture pin of channel 2 of the timer.
+    (#) This file implements the IRQ handler of the timer: remove it from the
+        application. Unless USE_HAL_TIM_REGISTER_CALLBACKS is set to 1U, it also
+        implements HAL_TIM_OC_DelayElapsedCallback() and HAL_TIM_IC_CaptureCallback().
+
+    *** Timer paths ***
+    ===================
+    [..]
+    (#) Call LAT_Run() after the clock configuration. Each sample programs a compare
+        event on channel 1 and timestamps it:
+        (++) "tim_entry": compare event to the first instruction of the IRQ handler,
+             read from the timer counter
+        (++) "tim_callback": compare event to HAL_TIM_OC_DelayElapsedCallback(),
+             read from the DWT cycle counter
+        (++) "tim_loopback": compare event to the edge that the IRQ handler drives
+             on LAT_OUT_PIN, captured by channel 2. It includes the GPIO write and
+             the input synchronization, a few timer clocks above "tim_entry".
+    (#) LAT_Run() returns HAL_ERROR when a maximum exceeds its LAT_xxx_BUDGET, so it
+        can be used to detect latency regressions when the HAL is updated.
+
+    *** Other ISR paths ***
+    =======================
+    [..]
+    (#) Call LAT_IRQ_Start() with the name of the path.
+    (#) Add LAT_EntryMark() at the beginning of the IRQ handler and LAT_CallbackMark()
+        in the HAL callback of the path.
+    (#) Call LAT_IRQ_Trigger() with the IRQ number, or LAT_EXTI_Trigger() with the
+        EXTI line for the HAL EXTI callback to be called, and wait for the callback.
+        Repeat as many times as needed.
+    (#) Call LAT_IRQ_Stop() to report "<name>_entry" and "<name>_callback".
+
+    [..]
+    (#) Each result is passed to LAT_Report(). Its default implementation prints one
+        record per line on the standard output:
+        LAT,<name>,<samples>,<min>,<max>,<average>,<histogram bin 0>;...;<bin N-1>
+        All the values are in CPU cycles. It can be overridden to store or send the
+        results differently.
+
+    [..]
+    (@) The cycles are measured with the DWT cycle counter, enabled by LAT_Init().
+    (@) A software pended IRQ does not set the flag of the peripheral: the HAL IRQ
+        handler of a DMA, UART or USB path returns without calling its callback and
+        only the entry latency is relevant for these paths.
+    (@) The timer paths have the resolution of the timer clock, i.e. one CPU cycle
+        when the APB1 prescaler is 1 or 2.
+
+  @endverbatim
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32g4xx_hal.h"
+#include <stdio.h>
+
+/* Private define ------------------------------------------------------------*/
+/* Latency configuration -----------------------------------------------------*/
+#define LAT_TIM                 TIM2                /* 32-bit timer                         */
+#define LAT_TIM_IRQn            TIM2_IRQn
+#define LAT_TIM_IRQHandler      TIM2_IRQHandler
+#define LAT_TIM_CLK_ENABLE()    __HAL_RCC_TIM2_CLK_ENABLE()
+#define LAT_TIM_IRQ_PRIORITY    0U                  /* Preemption priority of the timer IRQ */
+
+#define LAT_OUT_PORT            GPIOA               /* Loopback output, driven by the ISR   */
+#define LAT_OUT_PIN             GPIO_PIN_4
+#define LAT_IN_PORT             GPIOA               /* Loopback input, TIM2_CH2             */
+#define LAT_IN_PIN              GPIO_PIN_1
+#define LAT_IN_AF               GPIO_AF1_TIM2
+#define LAT_GPIO_CLK_ENABLE()   __HAL_RCC_GPIOA_CLK_ENABLE()
+
+#define LAT_SAMPLES             1000U               /* Samples taken by LAT_Run()           */
+#define LAT_DELAY_TICKS         2000U               /* Timer ticks from arming to the event */
+#define LAT_TIMEOUT             10U                 /* Timeout of one sample in ms          */
+#define LAT_HISTO_BINS          16U                 /* Histogram bins, last one is overflow */
+#define LAT_HISTO_WIDTH         8U                  /* Cycles per histogram bin             */
+
+#define LAT_ENTRY_BUDGET        100U                /* Maximum "tim_entry" cycles, 0 to skip    */
+#define LAT_CALLBACK_BUDGET     300U                /* Maximum "tim_callback" cycles, 0 to skip */
+
+/* Private typedef -----------------------------------------------------------*/
+/**
+  * @brief  Latency statistics of one path
+  */
+typedef struct
+{
+  const char *Name;                       /*!< Path name                                   */
+  uint32_t   Samples;                     /*!< Number of samples                           */
+  uint32_t   Min;                         /*!< Minimum latency in CPU cycles               */
+  uint32_t   Max;                         /*!< Maximum latency in CPU cycles               */
+  uint64_t   Sum;                         /*!< Sum of the latencies in CPU cycles          */
+  uint32_t   Histogram[LAT_HISTO_BINS];   /*!< Samples per bin of LAT_HISTO_WIDTH cycles   */
+} LAT_StatsTypeDef;
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static TIM_HandleTypeDef LatTimHandle;
+static uint32_t LatCyclesPerTick;
+
+static LAT_StatsTypeDef LatTimEntry;
+static LAT_StatsTypeDef LatTimCallback;
+static LAT_StatsTypeDef LatTimLoopback;
+static LAT_StatsTypeDef LatIrqEntry;
+static LAT_StatsTypeDef LatIrqCallback;
+
+static volatile uint32_t LatEntryCycle;
+static volatile uint32_t LatEntryCount;
+static volatile uint32_t LatEventCount;
+static volatile uint32_t LatTimArmed;
+static volatile uint32_t LatTimDone;
+
+static const char *LatIrqName;
+static volatile uint32_t LatIrqStartCycle;
+static volatile uint32_t LatIrqArmed;
+
+/* Private function prototypes -----------------------------------------------*/
+HAL_StatusTypeDef LAT_Init(void);
+HAL_StatusTypeDef LAT_Run(void);
+void LAT_IRQ_Start(const char *Name);
+void LAT_IRQ_Trigger(IRQn_Type IRQn);
+void LAT_EXTI_Trigger(uint32_t GPIO_Pin);
+void LAT_EntryMark(void);
+void LAT_CallbackMark(void);
+void LAT_IRQ_Stop(void);
+void LAT_Report(const LAT_StatsTypeDef *pStats);
+void LAT_TIM_IRQHandler(void);
+static void LAT_StatsReset(LAT_StatsTypeDef *pStats, const char *Name);
+static void LAT_StatsAdd(LAT_StatsTypeDef *pStats, uint32_t Cycles);
+static void LAT_TimCompareCallback(TIM_HandleTypeDef *htim);
+static void LAT_TimCaptureCallback(TIM_HandleTypeDef *htim);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Enable the DWT cycle counter and configure the timer and the loopback pins.
+  * @note   Called by LAT_Run(), it can also be called alone before the LAT_IRQ_xxx
+  *         functions.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef LAT_Init(void)
+{
+  GPIO_InitTypeDef  gpio;
+  TIM_OC_InitTypeDef oc;
+  TIM_IC_InitTypeDef ic;
+  RCC_ClkInitTypeDef clkconfig;
+  uint32_t          flatency;
+  uint32_t          timclock;
+  HAL_StatusTypeDef status;
+
+  /* Enable the DWT cycle counter if not already done by a debugger */
+  if ((DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk) == 0U)
+  {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0U;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+  }
+
+  /* Loopback output low, loopback input on channel 2 */
+  LAT_GPIO_CLK_ENABLE();
+  LAT_OUT_PORT->BRR = LAT_OUT_PIN;
+  gpio.Pin = LAT_OUT_PIN;
+  gpio.Mode = GPIO_MODE_OUTPUT_PP;
+  gpio.Pull = GPIO_NOPULL;
+  gpio.Speed = GPIO_SPEED_FREQ_VERY_HIGH;
+  gpio.Alternate = 0U;
+  HAL_GPIO_Init(LAT_OUT_PORT, &gpio);
+
+  gpio.Pin = LAT_IN_PIN;
+  gpio.Mode = GPIO_MODE_AF_PP;
+  gpio.Alternate = LAT_IN_AF;
+  HAL_GPIO_Init(LAT_IN_PORT, &gpio);
+
+  /* Compute the timer clock, the counter runs at full speed */
+  HAL_RCC_GetClockConfig(&clkconfig, &flatency);
+  if (clkconfig.APB1CLKDivider == RCC_HCLK_DIV1)
+  {
+    timclock = HAL_RCC_GetPCLK1Freq();
+  }
+  else
+  {
+    timclock = 2U * HAL_RCC_GetPCLK1Freq();
+  }
+  LatCyclesPerTick = HAL_RCC_GetHCLKFreq() / timclock;
+
+  LAT_TIM_CLK_ENABLE();
+  LatTimHandle.Instance = LAT_TIM;
+  LatTimHandle.Init.Prescaler = 0U;
+  LatTimHandle.Init.CounterMode = TIM_COUNTERMODE_UP;
+  LatTimHandle.Init.Period = 0xFFFFFFFFU;
+  LatTimHandle.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
+  LatTimHandle.Init.RepetitionCounter = 0U;
+  LatTimHandle.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_DISABLE;
+  status = HAL_TIM_OC_Init(&LatTimHandle);
+
+  /* Channel 1: frozen output compare, the event source */
+  if (status == HAL_OK)
+  {
+    oc.OCMode = TIM_OCMODE_TIMING;
+    oc.Pulse = 0U;
+    oc.OCPolarity = TIM_OCPOLARITY_HIGH;
+    oc.OCNPolarity = TIM_OCNPOLARITY_HIGH;
+    oc.OCFastMode = TIM_OCFAST_DISABLE;
+    oc.OCIdleState = TIM_OCIDLESTATE_RESET;
+    oc.OCNIdleState = TIM_OCNIDLESTATE_RESET;
+    status = HAL_TIM_OC_ConfigChannel(&LatTimHandle, &oc, TIM_CHANNEL_1);
+  }
+
+  /* Channel 2: rising edge capture of the loopback */
+  if (status == HAL_OK)
+  {
+    ic.ICPolarity = TIM_ICPOLARITY_RISING;
+    ic.ICSelection = TIM_ICSELECTION_DIRECTTI;
+    ic.ICPrescaler = TIM_ICPSC_DIV1;
+    ic.ICFilter = 0U;
+    status = HAL_TIM_IC_ConfigChannel(&LatTimHandle, &ic, TIM_CHANNEL_2);
+  }
+
+#if (USE_HAL_TIM_REGISTER_CALLBACKS == 1)
+  if (status == HAL_OK)
+  {
+    status = HAL_TIM_RegisterCallback(&LatTimHandle, HAL_TIM_OC_DELAY_ELAPSED_CB_ID, LAT_TimCompareCallback);
+  }
+  if (status == HAL_OK)
+  {
+    status = HAL_TIM_RegisterCallback(&LatTimHandle, HAL_TIM_IC_CAPTURE_CB_ID, LAT_TimCaptureCallback);
+  }
+#endif /* USE_HAL_TIM_REGISTER_CALLBACKS */
+
+  if (status == HAL_OK)
+  {
+    HAL_NVIC_SetPriority(LAT_TIM_IRQn, LAT_TIM_IRQ_PRIORITY, 0U);
+    HAL_NVIC_EnableIRQ(LAT_TIM_IRQn);
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Measure and report the timer paths.
+  * @retval HAL status
+  *          HAL_OK      all the samples are within the budgets
+  *          HAL_ERROR   a maximum exceeds its budget, or the initialization failed
+  *          HAL_TIMEOUT an event or its loopback capture did not occur
+  */
+HAL_StatusTypeDef LAT_Run(void)
+{
+  HAL_StatusTypeDef status;
+  uint32_t tickstart;
+  uint32_t i;
+
+  status = LAT_Init();
+
+  LAT_StatsReset(&LatTimEntry, "tim_entry");
+  LAT_StatsReset(&LatTimCallback, "tim_callback");
+  LAT_StatsReset(&LatTimLoopback, "tim_loopback");
+
+  if (status == HAL_OK)
+  {
+    __HAL_TIM_SET_COMPARE(&LatTimHandle, TIM_CHANNEL_1, LAT_TIM->CNT - 1U);
+    status = HAL_TIM_OC_Start_IT(&LatTimHandle, TIM_CHANNEL_1);
+  }
+  if (status == HAL_OK)
+  {
+    status = HAL_TIM_IC_Start_IT(&LatTimHandle, TIM_CHANNEL_2);
+  }
+
+  for (i = 0U; (i < LAT_SAMPLES) && (status == HAL_OK); i++)
+  {
+    /* Release the loopback and drop the captures of the previous sample */
+    LAT_OUT_PORT->BRR = LAT_OUT_PIN;
+    __HAL_TIM_CLEAR_FLAG(&LatTimHandle, TIM_FLAG_CC1 | TIM_FLAG_CC2 | TIM_FLAG_CC2OF);
+
+    /* Program the next compare event */
+    LatTimDone = 0U;
+    LatTimArmed = 1U;
+    LatEventCount = LAT_TIM->CNT + LAT_DELAY_TICKS;
+    __HAL_TIM_SET_COMPARE(&LatTimHandle, TIM_CHANNEL_1, LatEventCount);
+
+    tickstart = HAL_GetTick();
+    while (LatTimDone != 3U)
+    {
+      if ((HAL_GetTick() - tickstart) > LAT_TIMEOUT)
+      {
+        status = HAL_TIMEOUT;
+        break;
+      }
+    }
+    LatTimArmed = 0U;
+  }
+
+  (void)HAL_TIM_IC_Stop_IT(&LatTimHandle, TIM_CHANNEL_2);
+  (void)HAL_TIM_OC_Stop_IT(&LatTimHandle, TIM_CHANNEL_1);
+  LAT_OUT_PORT->BRR = LAT_OUT_PIN;
+
+  LAT_Report(&LatTimEntry);
+  LAT_Report(&LatTimCallback);
+  LAT_Report(&LatTimLoopback);
+
+  if (status == HAL_OK)
+  {
+    if (((LAT_ENTRY_BUDGET != 0U) && (LatTimEntry.Max > LAT_ENTRY_BUDGET)) ||
+        ((LAT_CALLBACK_BUDGET != 0U) && (LatTimCallback.Max > LAT_CALLBACK_BUDGET)))
+    {
+      status = HAL_ERROR;
+    }
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Start the measurement of an ISR path triggered by software.
+  * @param  Name Path name, the records are reported as "<Name>_entry" and
+  *         "<Name>_callback"
+  * @retval None
+  */
+void LAT_IRQ_Start(const char *Name)
+{
+  LatIrqName = Name;
+  LatIrqArmed = 0U;
+  LAT_StatsReset(&LatIrqEntry, "entry");
+  LAT_StatsReset(&LatIrqCallback, "callback");
+}
+
+/**
+  * @brief  Timestamp and pend an IRQ.
+  * @param  IRQn IRQ number, SysTick_IRQn or a peripheral IRQ enabled in the NVIC
+  * @retval None
+  */
+void LAT_IRQ_Trigger(IRQn_Type IRQn)
+{
+  LatIrqArmed = 1U;
+  LatIrqStartCycle = DWT->CYCCNT;
+  if (IRQn == SysTick_IRQn)
+  {
+    SCB->ICSR = SCB_ICSR_PENDSTSET_Msk;
+  }
+  else
+  {
+    HAL_NVIC_SetPendingIRQ(IRQn);
+  }
+}
+
+/**
+  * @brief  Timestamp and raise an EXTI software interrupt.
+  * @note   The pending bit of the line is set, so that HAL_GPIO_EXTI_IRQHandler()
+  *         calls HAL_GPIO_EXTI_Callback().
+  * @param  GPIO_Pin EXTI line 0 to 15, given as GPIO_PIN_x
+  * @retval None
+  */
+void LAT_EXTI_Trigger(uint32_t GPIO_Pin)
+{
+  LatIrqArmed = 1U;
+  LatIrqStartCycle = DWT->CYCCNT;
+  EXTI->SWIER1 = GPIO_Pin;
+}
+
+/**
+  * @brief  Record the ISR entry latency of the pending software trigger.
+  * @note   To be placed at the very beginning of the IRQ handler under test.
+  * @retval None
+  */
+void LAT_EntryMark(void)
+{
+  uint32_t cycle = DWT->CYCCNT;
+
+  if (LatIrqArmed == 1U)
+  {
+    LatIrqArmed = 2U;
+    LAT_StatsAdd(&LatIrqEntry, cycle - LatIrqStartCycle);
+  }
+}
+
+/**
+  * @brief  Record the callback latency of the pending software trigger.
+  * @note   To be placed at the beginning of the HAL callback under test.
+  * @retval None
+  */
+void LAT_CallbackMark(void)
+{
+  uint32_t cycle = DWT->CYCCNT;
+
+  if (LatIrqArmed != 0U)
+  {
+    LatIrqArmed = 0U;
+    LAT_StatsAdd(&LatIrqCallback, cycle - LatIrqStartCycle);
+  }
+}
+
+/**
+  * @brief  Stop the measurement of the software triggered path and report it.
+  * @retval None
+  */
+void LAT_IRQ_Stop(void)
+{
+  char entryname[32];
+  char callbackname[32];
+
+  LatIrqArmed = 0U;
+
+  (void)snprintf(entryname, sizeof(entryname), "%s_entry", LatIrqName);
+  (void)snprintf(callbackname, sizeof(callbackname), "%s_callback", LatIrqName);
+  LatIrqEntry.Name = entryname;
+  LatIrqCallback.Name = callbackname;
+
+  LAT_Report(&LatIrqEntry);
+  LAT_Report(&LatIrqCallback);
+}
+
+/**
+  * @brief  Report the statistics of a path.
+  * @note   This function is declared as __weak to be overwritten in case of other
+  *         implementations in user file.
+  * @param  pStats Path statistics, the name is only valid during the call
+  * @retval None
+  */
+__weak void LAT_Report(const LAT_StatsTypeDef *pStats)
+{
+  uint32_t i;
+  uint32_t average = 0U;
+
+  if (pStats->Samples != 0U)
+  {
+    average = (uint32_t)(pStats->Sum / pStats->Samples);
+  }
+
+  printf("LAT,%s,%lu,%lu,%lu,%lu,", pStats->Name, (unsigned long)pStats->Samples,
+         (unsigned long)((pStats->Samples != 0U) ? pStats->Min : 0U), (unsigned long)pStats->Max,
+         (unsigned long)average);
+  for (i = 0U; i < LAT_HISTO_BINS; i++)
+  {
+    printf((i == 0U) ? "%lu" : ";%lu", (unsigned long)pStats->Histogram[i]);
+  }
+  printf("\n");
+}
+
+/**
+  * @brief  IRQ handler of the latency timer.
+  * @note   The counter and the cycle counter are sampled first, then the loopback
+  *         output is driven before the HAL IRQ handler runs.
+  * @retval None
+  */
+void LAT_TIM_IRQHandler(void)
+{
+  LatEntryCycle = DWT->CYCCNT;
+  LatEntryCount = LAT_TIM->CNT;
+  LAT_OUT_PORT->BSRR = LAT_OUT_PIN;
+
+  HAL_TIM_IRQHandler(&LatTimHandle);
+}
+
+#if (USE_HAL_TIM_REGISTER_CALLBACKS == 0)
+/**
+  * @brief  Output Compare callback in non-blocking mode
+  * @param  htim TIM OC handle
+  * @retval None
+  */
+void HAL_TIM_OC_DelayElapsedCallback(TIM_HandleTypeDef *htim)
+{
+  LAT_TimCompareCallback(htim);
+}
+
+/**
+  * @brief  Input Capture callback in non-blocking mode
+  * @param  htim TIM IC handle
+  * @retval None
+  */
+void HAL_TIM_IC_CaptureCallback(TIM_HandleTypeDef *htim)
+{
+  LAT_TimCaptureCallback(htim);
+}
+#endif /* USE_HAL_TIM_REGISTER_CALLBACKS */
+
+/**
+  * @brief  Compare event of channel 1: record the entry and callback latencies.
+  * @note   The event cycle is rebuilt from the counter and cycle counter values
+  *         sampled together at the ISR entry.
+  * @param  htim TIM handle
+  * @retval None
+  */
+static void LAT_TimCompareCallback(TIM_HandleTypeDef *htim)
+{
+  uint32_t cycle = DWT->CYCCNT;
+  uint32_t entry;
+
+  if ((htim->Instance == LAT_TIM) && (htim->Channel == HAL_TIM_ACTIVE_CHANNEL_1) && (LatTimArmed != 0U))
+  {
+    entry = (LatEntryCount - LatEventCount) * LatCyclesPerTick;
+    LAT_StatsAdd(&LatTimEntry, entry);
+    LAT_StatsAdd(&LatTimCallback, entry + (cycle - LatEntryCycle));
+    LatTimDone |= 1U;
+  }
+}
+
+/**
+  * @brief  Capture of the loopback on channel 2: record the external entry latency.
+  * @param  htim TIM handle
+  * @retval None
+  */
+static void LAT_TimCaptureCallback(TIM_HandleTypeDef *htim)
+{
+  uint32_t capture;
+
+  if ((htim->Instance == LAT_TIM) && (htim->Channel == HAL_TIM_ACTIVE_CHANNEL_2) && (LatTimArmed != 0U))
+  {
+    capture = HAL_TIM_ReadCapturedValue(htim, TIM_CHANNEL_2);
+    LAT_StatsAdd(&LatTimLoopback, (capture - LatEventCount) * LatCyclesPerTick);
+    LatTimDone |= 2U;
+  }
+}
+
+/**
+  * @brief  Clear path statistics.
+  * @param  pStats Path statistics
+  * @param  Name Path name
+  * @retval None
+  */
+static void LAT_StatsReset(LAT_StatsTypeDef *pStats, const char *Name)
+{
+  uint32_t i;
+
+  pStats->Name = Name;
+  pStats->Samples = 0U;
+  pStats->Min = 0xFFFFFFFFU;
+  pStats->Max = 0U;
+  pStats->Sum = 0U;
+  for (i = 0U; i < LAT_HISTO_BINS; i++)
+  {
+    pStats->Histogram[i] = 0U;
+  }
+}
+
+/**
+  * @brief  Add one sample to path statistics.
+  * @param  pStats Path statistics
+  * @param  Cycles Latency in CPU cycles
+  * @retval None
+  */
+static void LAT_StatsAdd(LAT_StatsTypeDef *pStats, uint32_t Cycles)
+{
+  uint32_t bin = Cycles / LAT_HISTO_WIDTH;
+
+  if (bin >= LAT_HISTO_BINS)
+  {
+    bin = LAT_HISTO_BINS - 1U;
+  }
+
+  pStats->Samples++;
+  pStats->Sum += Cycles;
+  pStats->Histogram[bin]++;
+  if (Cycles < pStats->Min)
+  {
+    pStats->Min = Cycles;
+  }
+  if (Cycles > pStats->Max)
+  {
+    pStats->Max = Cycles;
+  }
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
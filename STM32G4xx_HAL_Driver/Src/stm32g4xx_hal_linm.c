@@ -0,0 +1,771 @@
+/**
+  ******************************************************************************
+  * @file    stm32g4xx_hal_linm.c
+  * @author  MCD Application Team
+  * @brief   LIN master schedule HAL module driver.
+  *          This file provides firmware functions to execute a LIN schedule
+  *          table as a bus master, with a hardware timed slot for each frame:
+  *           + Initialization and de-initialization functions
+  *           + Start, stop, table switching and IRQ handler functions
+  *           + State and error functions
+  *
+  @verbatim
+  ==============================================================================
+                  ##### LIN master schedule features #####
+  ==============================================================================
+  [..]
+    (+) The start of each slot is the update event of a dedicated timer, whose
+        period is reloaded through the auto-reload preload register: the slot
+        durations do not depend on the software latency, and the headers only
+        have the jitter of the timer interrupt latency.
+    (+) On each slot, HAL_LINM_IRQHandler():
+        (++) requests the break first, then checks the frame of the slot just
+             ended from the bytes read back from the bus;
+        (++) sends the sync byte, the protected identifier and, for a master
+             frame, the response and its checksum with the transmission DMA;
+        (++) reads back the whole slot with the reception DMA, so that the
+             response of a slave is received without any interrupt.
+    (+) The classic (LIN 1.x) and enhanced (LIN 2.x) checksums are computed and
+        checked by the driver, the parity bits of the identifier are added by
+        the driver.
+    (+) Each bus has its own handle, UART and timer: several buses are run at
+        once by as many handles, without interfering with each other.
+
+  ==============================================================================
+                        ##### How to use this driver #####
+  ==============================================================================
+  [..]
+    (#) Initialize the UART with HAL_LIN_Init(), link a DMA channel in normal mode
+        and byte data width to hdmatx and another one to hdmarx. The DMA interrupts
+        are not used. The LIN transceiver echoes the bus on the RX pin.
+
+    (#) Initialize a timer with HAL_TIM_Base_Init(), its counter clock being the
+        time unit of the slots (1 MHz for a microsecond unit for instance).
+        Enable its update interrupt in the NVIC with a high priority.
+
+    (#) Fill the "Init" field of a LINM_HandleTypeDef handle with the UART and
+        timer handles, then call HAL_LINM_Init().
+
+    (#) Call HAL_LINM_IRQHandler() from the timer IRQ handler instead of
+        HAL_TIM_IRQHandler().
+
+    (#) Call HAL_LINM_Start() with a schedule table. The frames of the table are
+        executed in loop until HAL_LINM_Stop(). HAL_LINM_FrameCpltCallback() or
+        HAL_LINM_FrameErrorCallback() is called at the end of each slot, pLastEntry
+        and FrameStatus giving the frame and its status.
+
+    (#) Call HAL_LINM_SetTable() to switch to another table: it is executed from
+        the start of the next slot.
+
+    [..]
+      (@) The slot time must cover the frame: the break and the header (34 bits)
+          and the response (10 bits per byte, checksum included), plus 40% of
+          response space as required by the LIN specification.
+      (@) The data of a master frame is copied at the start of its slot. The data
+          of a slave frame is only written when the response is complete and its
+          checksum correct.
+
+  @endverbatim
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                       opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32g4xx_hal.h"
+
+/** @addtogroup STM32G4xx_HAL_Driver
+  * @{
+  */
+
+/** @defgroup LINM LINM
+  * @brief LIN master schedule HAL module driver
+  * @{
+  */
+
+#ifdef HAL_LINM_MODULE_ENABLED
+
+#if defined(HAL_UART_MODULE_ENABLED) && defined(HAL_DMA_MODULE_ENABLED) && defined(HAL_TIM_MODULE_ENABLED)
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/** @defgroup LINM_Private_Constants LINM Private Constants
+  * @{
+  */
+#define LINM_SYNC_BYTE          0x55U         /* Sync field of the header                      */
+#define LINM_ID_MAX             0x3FU         /* Highest frame identifier                      */
+#define LINM_LENGTH_MAX         8U            /* Longest response, checksum excluded           */
+
+/* Reception errors cleared at the start of each slot */
+#define LINM_UART_CLEAR_FLAGS   (USART_ICR_PECF | USART_ICR_FECF | USART_ICR_NECF | USART_ICR_ORECF | \
+                                 USART_ICR_LBDCF)
+/**
+  * @}
+  */
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+/** @defgroup LINM_Private_Functions LINM Private Functions
+  * @{
+  */
+static HAL_StatusTypeDef LINM_CheckTable(const LINM_HandleTypeDef *hlinm, const LINM_ScheduleEntryTypeDef *pTable,
+                                         uint32_t TableSize);
+static uint32_t LINM_EndSlot(LINM_HandleTypeDef *hlinm, uint32_t Received);
+static HAL_StatusTypeDef LINM_StartSlot(LINM_HandleTypeDef *hlinm);
+/**
+  * @}
+  */
+
+/* Exported functions --------------------------------------------------------*/
+/** @defgroup LINM_Exported_Functions LINM Exported Functions
+  * @{
+  */
+
+/** @defgroup LINM_Exported_Functions_Group1 Initialization and de-initialization functions
+  *  @brief    Initialization and de-initialization functions
+  *
+@verbatim
+ ===============================================================================
+         ##### Initialization and de-initialization functions #####
+ ===============================================================================
+    [..]
+    This subsection provides functions allowing to initialize and de-initialize
+    the schedule. The UART, DMA and timer are initialized by the application.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Initialize the schedule.
+  * @param  hlinm LINM handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_LINM_Init(LINM_HandleTypeDef *hlinm)
+{
+  /* Check the LINM handle allocation */
+  if (hlinm == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  if ((hlinm->Init.huart == NULL) || (hlinm->Init.htim == NULL) ||
+      (hlinm->Init.huart->hdmatx == NULL) || (hlinm->Init.huart->hdmarx == NULL) ||
+      (hlinm->Init.huart->hdmatx->Init.Mode != DMA_NORMAL) || (hlinm->Init.huart->hdmarx->Init.Mode != DMA_NORMAL))
+  {
+    hlinm->ErrorCode = HAL_LINM_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  if (hlinm->State == HAL_LINM_STATE_RESET)
+  {
+    /* Allocate lock resource and initialize it */
+    hlinm->Lock = HAL_UNLOCKED;
+  }
+  else if (hlinm->State == HAL_LINM_STATE_BUSY)
+  {
+    return HAL_BUSY;
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+
+  hlinm->pTable = NULL;
+  hlinm->TableSize = 0U;
+  hlinm->pNextTable = NULL;
+  hlinm->NextTableSize = 0U;
+  hlinm->pLastEntry = NULL;
+  hlinm->FrameStatus = LINM_FRAME_OK;
+
+  hlinm->ErrorCode = HAL_LINM_ERROR_NONE;
+  hlinm->State = HAL_LINM_STATE_READY;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  DeInitialize the schedule.
+  * @note   The schedule is stopped if running. The UART, DMA and timer are left
+  *         initialized.
+  * @param  hlinm LINM handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_LINM_DeInit(LINM_HandleTypeDef *hlinm)
+{
+  /* Check the LINM handle allocation */
+  if (hlinm == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  if (hlinm->State == HAL_LINM_STATE_BUSY)
+  {
+    (void)HAL_LINM_Stop(hlinm);
+  }
+
+  hlinm->ErrorCode = HAL_LINM_ERROR_NONE;
+  hlinm->State = HAL_LINM_STATE_RESET;
+
+  /* Release Lock */
+  __HAL_UNLOCK(hlinm);
+
+  return HAL_OK;
+}
+
+/**
+  * @}
+  */
+
+/** @defgroup LINM_Exported_Functions_Group2 IO operation functions
+  *  @brief    Start, stop, table switching and IRQ handler functions
+  *
+@verbatim
+ ===============================================================================
+                      ##### IO operation functions #####
+ ===============================================================================
+    [..]
+    This subsection provides functions allowing to:
+      (+) Start and stop the execution of a schedule table
+      (+) Switch to another schedule table
+      (+) Run one slot, from the timer IRQ handler
+      (+) Compute the protected identifier and the checksum of a frame
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Start the execution of a schedule table.
+  * @note   The header of the first entry is sent immediately. The timer period
+  *         is preloaded, the update flag is only set by the counter overflow.
+  * @param  hlinm LINM handle
+  * @param  pTable Pointer to the schedule table, kept by the driver until it is stopped
+  *         or the table is switched.
+  * @param  TableSize Number of entries of pTable.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_LINM_Start(LINM_HandleTypeDef *hlinm, const LINM_ScheduleEntryTypeDef *pTable,
+                                 uint32_t TableSize)
+{
+  TIM_TypeDef *tim;
+  HAL_StatusTypeDef status;
+
+  /* Process locked */
+  __HAL_LOCK(hlinm);
+
+  if (hlinm->State != HAL_LINM_STATE_READY)
+  {
+    __HAL_UNLOCK(hlinm);
+    return HAL_BUSY;
+  }
+
+  if (LINM_CheckTable(hlinm, pTable, TableSize) != HAL_OK)
+  {
+    hlinm->ErrorCode = HAL_LINM_ERROR_PARAM;
+    __HAL_UNLOCK(hlinm);
+    return HAL_ERROR;
+  }
+
+  hlinm->pTable = pTable;
+  hlinm->TableSize = TableSize;
+  hlinm->pNextTable = NULL;
+  hlinm->NextTableSize = 0U;
+  hlinm->Index = 0U;
+  hlinm->pLastEntry = NULL;
+  hlinm->FrameStatus = LINM_FRAME_OK;
+  hlinm->FrameCount = 0U;
+  hlinm->FrameErrorCount = 0U;
+  hlinm->ErrorCode = HAL_LINM_ERROR_NONE;
+
+  /* Load the first slot duration, then preload the second one */
+  tim = hlinm->Init.htim->Instance;
+  CLEAR_BIT(tim->CR1, TIM_CR1_CEN);
+  SET_BIT(tim->CR1, TIM_CR1_ARPE | TIM_CR1_URS);
+  tim->ARR = pTable[0].SlotTime - 1U;
+  tim->EGR = TIM_EGR_UG;
+  tim->SR = ~TIM_SR_UIF;
+  tim->ARR = pTable[(TableSize > 1U) ? 1U : 0U].SlotTime - 1U;
+
+  /* The DMA requests stay enabled, the channels are started on each slot */
+  SET_BIT(hlinm->Init.huart->Instance->CR3, USART_CR3_DMAT | USART_CR3_DMAR);
+
+  hlinm->State = HAL_LINM_STATE_BUSY;
+
+  __HAL_UART_SEND_REQ(hlinm->Init.huart, UART_SENDBREAK_REQUEST);
+  status = LINM_StartSlot(hlinm);
+  if (status != HAL_OK)
+  {
+    CLEAR_BIT(hlinm->Init.huart->Instance->CR3, USART_CR3_DMAT | USART_CR3_DMAR);
+    hlinm->ErrorCode = HAL_LINM_ERROR_DMA;
+    hlinm->State = HAL_LINM_STATE_READY;
+  }
+  else
+  {
+    SET_BIT(tim->DIER, TIM_DIER_UIE);
+    SET_BIT(tim->CR1, TIM_CR1_CEN);
+  }
+
+  /* Process unlocked */
+  __HAL_UNLOCK(hlinm);
+
+  return status;
+}
+
+/**
+  * @brief  Stop the execution of the schedule table.
+  * @note   The frame of the current slot is aborted and not reported.
+  * @param  hlinm LINM handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_LINM_Stop(LINM_HandleTypeDef *hlinm)
+{
+  TIM_TypeDef *tim;
+
+  /* Process locked */
+  __HAL_LOCK(hlinm);
+
+  if (hlinm->State != HAL_LINM_STATE_BUSY)
+  {
+    __HAL_UNLOCK(hlinm);
+    return HAL_ERROR;
+  }
+
+  tim = hlinm->Init.htim->Instance;
+  CLEAR_BIT(tim->DIER, TIM_DIER_UIE);
+  CLEAR_BIT(tim->CR1, TIM_CR1_CEN);
+  tim->SR = ~TIM_SR_UIF;
+
+  CLEAR_BIT(hlinm->Init.huart->Instance->CR3, USART_CR3_DMAT | USART_CR3_DMAR);
+  (void)HAL_DMA_Abort(hlinm->Init.huart->hdmatx);
+  (void)HAL_DMA_Abort(hlinm->Init.huart->hdmarx);
+
+  hlinm->pNextTable = NULL;
+  hlinm->State = HAL_LINM_STATE_READY;
+
+  /* Process unlocked */
+  __HAL_UNLOCK(hlinm);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Switch to another schedule table, from the next slot.
+  * @note   The current slot keeps its duration, the new table starts at its
+  *         first entry.
+  * @param  hlinm LINM handle
+  * @param  pTable Pointer to the schedule table.
+  * @param  TableSize Number of entries of pTable.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_LINM_SetTable(LINM_HandleTypeDef *hlinm, const LINM_ScheduleEntryTypeDef *pTable,
+                                    uint32_t TableSize)
+{
+  uint32_t primask_bit;
+
+  if (hlinm->State != HAL_LINM_STATE_BUSY)
+  {
+    return HAL_ERROR;
+  }
+
+  if (LINM_CheckTable(hlinm, pTable, TableSize) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  hlinm->pNextTable = pTable;
+  hlinm->NextTableSize = TableSize;
+
+  /* Preload the duration of the first slot of the new table */
+  hlinm->Init.htim->Instance->ARR = pTable[0].SlotTime - 1U;
+
+  __set_PRIMASK(primask_bit);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Run one slot, on the update event of the schedule timer.
+  * @note   To be called from the timer IRQ handler. The break is requested
+  *         first, the frame of the previous slot is checked during the break,
+  *         then the header and the response of the new slot are given to the
+  *         DMA and the duration of the following slot is preloaded.
+  * @param  hlinm LINM handle
+  * @retval None
+  */
+void HAL_LINM_IRQHandler(LINM_HandleTypeDef *hlinm)
+{
+  TIM_TypeDef *tim = hlinm->Init.htim->Instance;
+  UART_HandleTypeDef *huart = hlinm->Init.huart;
+  uint32_t received;
+  uint32_t status;
+  uint32_t next;
+
+  if (((tim->SR & TIM_SR_UIF) == 0U) || ((tim->DIER & TIM_DIER_UIE) == 0U))
+  {
+    return;
+  }
+  tim->SR = ~TIM_SR_UIF;
+
+  /* Freeze the read back of the slot just ended and start the break */
+  (void)HAL_DMA_Abort(huart->hdmatx);
+  (void)HAL_DMA_Abort(huart->hdmarx);
+  received = hlinm->RxSize - __HAL_DMA_GET_COUNTER(huart->hdmarx);
+  __HAL_UART_SEND_REQ(huart, UART_SENDBREAK_REQUEST);
+
+  hlinm->pLastEntry = &hlinm->pTable[hlinm->Index];
+  status = LINM_EndSlot(hlinm, received);
+  hlinm->FrameStatus = status;
+  hlinm->FrameCount++;
+  if (status != LINM_FRAME_OK)
+  {
+    hlinm->FrameErrorCount++;
+  }
+
+  /* Move to the entry of the new slot */
+  if (hlinm->pNextTable != NULL)
+  {
+    hlinm->pTable = hlinm->pNextTable;
+    hlinm->TableSize = hlinm->NextTableSize;
+    hlinm->pNextTable = NULL;
+    hlinm->Index = 0U;
+  }
+  else
+  {
+    hlinm->Index = (hlinm->Index + 1U < hlinm->TableSize) ? (hlinm->Index + 1U) : 0U;
+  }
+
+  if (LINM_StartSlot(hlinm) != HAL_OK)
+  {
+    hlinm->ErrorCode |= HAL_LINM_ERROR_DMA;
+    HAL_LINM_ErrorCallback(hlinm);
+  }
+
+  /* Preload the duration of the following slot */
+  next = (hlinm->Index + 1U < hlinm->TableSize) ? (hlinm->Index + 1U) : 0U;
+  tim->ARR = hlinm->pTable[next].SlotTime - 1U;
+
+  if (status == LINM_FRAME_OK)
+  {
+    HAL_LINM_FrameCpltCallback(hlinm);
+  }
+  else
+  {
+    HAL_LINM_FrameErrorCallback(hlinm);
+  }
+}
+
+/**
+  * @brief  Compute the protected identifier of a frame.
+  * @param  Id Frame identifier, from 0x00 to 0x3F
+  * @retval Identifier with the parity bits P0 (bit 6) and P1 (bit 7)
+  */
+uint8_t HAL_LINM_ComputePID(uint32_t Id)
+{
+  uint32_t id = Id & LINM_ID_MAX;
+  uint32_t p0;
+  uint32_t p1;
+
+  p0 = (id ^ (id >> 1U) ^ (id >> 2U) ^ (id >> 4U)) & 1U;
+  p1 = ~((id >> 1U) ^ (id >> 3U) ^ (id >> 4U) ^ (id >> 5U)) & 1U;
+
+  return (uint8_t)(id | (p0 << 6U) | (p1 << 7U));
+}
+
+/**
+  * @brief  Compute the checksum of a frame response.
+  * @param  Pid Protected identifier of the frame, only used by the enhanced checksum
+  * @param  pData Pointer to the response data
+  * @param  Size Number of data bytes
+  * @param  ChecksumType Checksum model, a value of @ref LINM_Checksum_Type
+  * @retval Inverted eight bit sum with carry
+  */
+uint8_t HAL_LINM_ComputeChecksum(uint8_t Pid, const uint8_t *pData, uint32_t Size, uint32_t ChecksumType)
+{
+  uint32_t sum = (ChecksumType == LINM_CHECKSUM_ENHANCED) ? (uint32_t)Pid : 0U;
+  uint32_t index;
+
+  for (index = 0U; index < Size; index++)
+  {
+    sum += pData[index];
+    if (sum > 0xFFU)
+    {
+      sum -= 0xFFU;
+    }
+  }
+
+  return (uint8_t)(~sum);
+}
+
+/**
+  * @brief  Frame completed callback.
+  * @param  hlinm LINM handle
+  * @retval None
+  */
+__weak void HAL_LINM_FrameCpltCallback(LINM_HandleTypeDef *hlinm)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hlinm);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_LINM_FrameCpltCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Frame error callback, FrameStatus giving the error.
+  * @param  hlinm LINM handle
+  * @retval None
+  */
+__weak void HAL_LINM_FrameErrorCallback(LINM_HandleTypeDef *hlinm)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hlinm);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_LINM_FrameErrorCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Schedule error callback.
+  * @param  hlinm LINM handle
+  * @retval None
+  */
+__weak void HAL_LINM_ErrorCallback(LINM_HandleTypeDef *hlinm)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hlinm);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_LINM_ErrorCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @}
+  */
+
+/** @defgroup LINM_Exported_Functions_Group3 Peripheral State and Error functions
+  *  @brief    State and error functions
+  *
+@verbatim
+ ===============================================================================
+                ##### Peripheral State and Error functions #####
+ ===============================================================================
+    [..]
+    This subsection provides functions allowing to get the state and the error
+    code of the schedule.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Return the schedule state.
+  * @param  hlinm LINM handle
+  * @retval HAL state
+  */
+HAL_LINM_StateTypeDef HAL_LINM_GetState(LINM_HandleTypeDef *hlinm)
+{
+  return hlinm->State;
+}
+
+/**
+  * @brief  Return the schedule error code.
+  * @param  hlinm LINM handle
+  * @retval LINM error code, a value of @ref LINM_Error_Code
+  */
+uint32_t HAL_LINM_GetError(LINM_HandleTypeDef *hlinm)
+{
+  return hlinm->ErrorCode;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/* Private functions ---------------------------------------------------------*/
+/** @addtogroup LINM_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Check the entries of a schedule table.
+  * @param  hlinm LINM handle
+  * @param  pTable Pointer to the schedule table
+  * @param  TableSize Number of entries of pTable
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef LINM_CheckTable(const LINM_HandleTypeDef *hlinm, const LINM_ScheduleEntryTypeDef *pTable,
+                                         uint32_t TableSize)
+{
+  uint32_t slotmax = IS_TIM_32B_COUNTER_INSTANCE(hlinm->Init.htim->Instance) ? 0xFFFFFFFFU : 0x10000U;
+  uint32_t index;
+
+  if ((pTable == NULL) || (TableSize == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  for (index = 0U; index < TableSize; index++)
+  {
+    if ((pTable[index].Id > LINM_ID_MAX) || (pTable[index].Length == 0U) ||
+        (pTable[index].Length > LINM_LENGTH_MAX) || (pTable[index].pData == NULL) ||
+        ((pTable[index].Direction != LINM_FRAME_MASTER) && (pTable[index].Direction != LINM_FRAME_SLAVE)) ||
+        ((pTable[index].ChecksumType != LINM_CHECKSUM_CLASSIC) &&
+         (pTable[index].ChecksumType != LINM_CHECKSUM_ENHANCED)) ||
+        (pTable[index].SlotTime < 2U) || (pTable[index].SlotTime > slotmax))
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Check the frame of the slot just ended from the bytes read back.
+  * @note   The break may be read back as a null byte with a framing error: it
+  *         is skipped when present. The response of a slave frame is copied to
+  *         the data of the entry when it is complete and its checksum correct.
+  * @param  hlinm LINM handle
+  * @param  Received Number of bytes written by the reception DMA
+  * @retval Frame status, a value of @ref LINM_Frame_Status
+  */
+static uint32_t LINM_EndSlot(LINM_HandleTypeDef *hlinm, uint32_t Received)
+{
+  const LINM_ScheduleEntryTypeDef *entry = hlinm->pLastEntry;
+  const uint8_t *response;
+  uint32_t offset = 0U;
+  uint32_t count;
+  uint32_t index;
+
+  if ((Received != 0U) && (hlinm->RxBuffer[0] == 0U))
+  {
+    offset = 1U;
+  }
+
+  if ((Received < (offset + 2U)) || (hlinm->RxBuffer[offset] != LINM_SYNC_BYTE) ||
+      (hlinm->RxBuffer[offset + 1U] != hlinm->TxBuffer[1]))
+  {
+    return LINM_FRAME_HEADER;
+  }
+
+  count = Received - offset - 2U;
+  response = &hlinm->RxBuffer[offset + 2U];
+
+  if (count == 0U)
+  {
+    return (entry->Direction == LINM_FRAME_SLAVE) ? LINM_FRAME_NO_RESPONSE : LINM_FRAME_INCOMPLETE;
+  }
+  if (count < (entry->Length + 1U))
+  {
+    return LINM_FRAME_INCOMPLETE;
+  }
+
+  if (entry->Direction == LINM_FRAME_MASTER)
+  {
+    /* The response read back must be the one sent */
+    for (index = 0U; index <= entry->Length; index++)
+    {
+      if (response[index] != hlinm->TxBuffer[index + 2U])
+      {
+        return LINM_FRAME_BIT;
+      }
+    }
+    return LINM_FRAME_OK;
+  }
+
+  if (HAL_LINM_ComputeChecksum(hlinm->TxBuffer[1], response, entry->Length, entry->ChecksumType)
+      != response[entry->Length])
+  {
+    return LINM_FRAME_CHECKSUM;
+  }
+
+  for (index = 0U; index < entry->Length; index++)
+  {
+    entry->pData[index] = response[index];
+  }
+
+  return LINM_FRAME_OK;
+}
+
+/**
+  * @brief  Give the frame of the current entry to the DMA.
+  * @note   To be called after the break request. The reception reads back the
+  *         break, the header, the response and the checksum.
+  * @param  hlinm LINM handle
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef LINM_StartSlot(LINM_HandleTypeDef *hlinm)
+{
+  const LINM_ScheduleEntryTypeDef *entry = &hlinm->pTable[hlinm->Index];
+  UART_HandleTypeDef *huart = hlinm->Init.huart;
+  uint32_t txsize = 2U;
+  uint32_t index;
+
+  hlinm->TxBuffer[0] = (uint8_t)LINM_SYNC_BYTE;
+  hlinm->TxBuffer[1] = HAL_LINM_ComputePID(entry->Id);
+
+  if (entry->Direction == LINM_FRAME_MASTER)
+  {
+    for (index = 0U; index < entry->Length; index++)
+    {
+      hlinm->TxBuffer[index + 2U] = entry->pData[index];
+    }
+    hlinm->TxBuffer[entry->Length + 2U] = HAL_LINM_ComputeChecksum(hlinm->TxBuffer[1], &hlinm->TxBuffer[2],
+                                                                   entry->Length, entry->ChecksumType);
+    txsize += entry->Length + 1U;
+  }
+
+  /* Break, header, response and checksum */
+  hlinm->RxSize = entry->Length + 4U;
+
+  /* Discard the bytes of the previous slot not read by the DMA */
+  WRITE_REG(huart->Instance->ICR, LINM_UART_CLEAR_FLAGS);
+  __HAL_UART_SEND_REQ(huart, UART_RXDATA_FLUSH_REQUEST);
+
+  if (HAL_DMA_Start(huart->hdmarx, (uint32_t)&huart->Instance->RDR, (uint32_t)hlinm->RxBuffer,
+                    hlinm->RxSize) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  /* The sync byte is sent at the end of the break */
+  return HAL_DMA_Start(huart->hdmatx, (uint32_t)hlinm->TxBuffer, (uint32_t)&huart->Instance->TDR, txsize);
+}
+
+/**
+  * @}
+  */
+
+#endif /* HAL_UART_MODULE_ENABLED && HAL_DMA_MODULE_ENABLED && HAL_TIM_MODULE_ENABLED */
+
+#endif /* HAL_LINM_MODULE_ENABLED */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -9,6 +9,7 @@
   *          peripheral:
   *           + Extended Initialization and de-initialization functions
   *           + Extended Peripheral Control functions
+  *           + Extended PGA auto-ranging functions
   *
   @verbatim
   ******************************************************************************
@@ -44,7 +45,28 @@
 /* Private define ------------------------------------------------------------*/
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
+#if defined(HAL_ADC_MODULE_ENABLED)
+/** @defgroup OPAMPEx_Private_Variables OPAMP Extended Private Variables
+  * @{
+  */
+static const uint32_t OPAMPEx_PgaGain[OPAMPEX_AUTORANGE_GAIN_NB] =
+{
+  OPAMP_PGA_GAIN_2_OR_MINUS_1,
+  OPAMP_PGA_GAIN_4_OR_MINUS_3,
+  OPAMP_PGA_GAIN_8_OR_MINUS_7,
+  OPAMP_PGA_GAIN_16_OR_MINUS_15,
+  OPAMP_PGA_GAIN_32_OR_MINUS_31,
+  OPAMP_PGA_GAIN_64_OR_MINUS_63
+};
+/**
+  * @}
+  */
+#endif /* HAL_ADC_MODULE_ENABLED */
+
 /* Private function prototypes -----------------------------------------------*/
+#if defined(HAL_ADC_MODULE_ENABLED)
+static void OPAMPEx_AutoRangeSetThresholds(const OPAMPEx_AutoRangeTypeDef *pRange);
+#endif /* HAL_ADC_MODULE_ENABLED */
 /* Exported functions --------------------------------------------------------*/
 
 /** @defgroup OPAMPEx_Exported_Functions OPAMP Extended Exported Functions
@@ -733,6 +755,209 @@ HAL_StatusTypeDef HAL_OPAMPEx_SelfCalibrateAll(OPAMP_HandleTypeDef *hopamp1, OPA
   * @}
   */
 
+#if defined(HAL_ADC_MODULE_ENABLED)
+/** @defgroup OPAMPEx_Exported_Functions_Group2 Extended PGA auto-ranging functions
+  * @brief    Extended PGA auto-ranging functions
+  *
+@verbatim
+ ===============================================================================
+              ##### Extended PGA auto-ranging functions #####
+ ===============================================================================
+  [..]
+      (+) Automatic selection of the PGA gain from the ADC analog watchdog 1.
+
+  [..] How to use the PGA auto-ranging
+    (#) Initialize the OPAMP in PGA mode and the ADC so that it converts the
+        OPAMP output channel in 12-bit resolution, without oversampling, to a
+        circular halfword DMA buffer on a hardware trigger.
+    (#) Fill an OPAMPEx_AutoRangeTypeDef structure and call
+        HAL_OPAMPEx_AutoRange_Start() before starting the ADC conversions:
+        the analog watchdog 1 is configured on the OPAMP channel with the
+        high and low thresholds of the structure.
+    (#) Start the OPAMP with HAL_OPAMP_Start() and the ADC with
+        HAL_ADC_Start_DMA().
+    (#) Call HAL_OPAMPEx_AutoRange_IRQHandler() from
+        HAL_ADC_LevelOutOfWindowCallback(): the gain is decreased when the last
+        sample is above HighThreshold and increased when it is below
+        LowThreshold, without stopping the conversions.
+    (#) Each gain change is recorded in the Tags ring with the DMA buffer
+        position from which the new gain applies, so that the samples can be
+        rescaled by the application. The sample converted while the gain is
+        switching may be inaccurate.
+    (#) Call HAL_OPAMPEx_AutoRange_Stop() to disable the watchdog interrupt.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Start the PGA auto-ranging of an OPAMP from the ADC analog watchdog 1.
+  * @note   The ADC regular conversions must not be ongoing.
+  * @param  pRange auto-ranging structure
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_OPAMPEx_AutoRange_Start(OPAMPEx_AutoRangeTypeDef *pRange)
+{
+  ADC_AnalogWDGConfTypeDef awdconfig = {0};
+  uint32_t index;
+
+  /* Check the structure allocation */
+  if ((pRange == NULL) || (pRange->hopamp == NULL) || (pRange->hadc == NULL) || (pRange->pBuffer == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the parameters */
+  assert_param(IS_OPAMP_ALL_INSTANCE(pRange->hopamp->Instance));
+  assert_param(IS_ADC_ALL_INSTANCE(pRange->hadc->Instance));
+
+  if ((pRange->hopamp->State == HAL_OPAMP_STATE_BUSYLOCKED)
+      || (pRange->hopamp->State == HAL_OPAMP_STATE_RESET)
+      || (pRange->hopamp->Init.Mode != OPAMP_PGA_MODE)
+      || (pRange->hadc->DMA_Handle == NULL)
+      || (pRange->BufferLength == 0UL)
+      || (pRange->MinGain > pRange->MaxGain)
+      || (pRange->MaxGain >= OPAMPEX_AUTORANGE_GAIN_NB)
+      || (pRange->HighThreshold > 0xFFFUL)
+      || ((pRange->LowThreshold * 2UL) >= pRange->HighThreshold))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Start from the gain programmed at OPAMP initialization, clamped to the range */
+  index = 0UL;
+  while ((index < (OPAMPEX_AUTORANGE_GAIN_NB - 1UL)) && (OPAMPEx_PgaGain[index] != pRange->hopamp->Init.PgaGain))
+  {
+    index++;
+  }
+  if (index < pRange->MinGain)
+  {
+    index = pRange->MinGain;
+  }
+  else if (index > pRange->MaxGain)
+  {
+    index = pRange->MaxGain;
+  }
+  else
+  {
+    /* Gain within range */
+  }
+  pRange->Gain = index;
+  pRange->TagCount = 0UL;
+
+  MODIFY_REG(pRange->hopamp->Instance->CSR, (OPAMP_CSR_PGGAIN_2 | OPAMP_CSR_PGGAIN_1 | OPAMP_CSR_PGGAIN_0),
+             OPAMPEx_PgaGain[index]);
+
+  /* Analog watchdog 1 monitoring the OPAMP channel, thresholds refined below */
+  awdconfig.WatchdogNumber = ADC_ANALOGWATCHDOG_1;
+  awdconfig.WatchdogMode = ADC_ANALOGWATCHDOG_SINGLE_REG;
+  awdconfig.Channel = pRange->Channel;
+  awdconfig.ITMode = ENABLE;
+  awdconfig.HighThreshold = pRange->HighThreshold;
+  awdconfig.LowThreshold = pRange->LowThreshold;
+  awdconfig.FilteringConfig = ADC_AWD_FILTERING_NONE;
+
+  if (HAL_ADC_AnalogWDGConfig(pRange->hadc, &awdconfig) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  OPAMPEx_AutoRangeSetThresholds(pRange);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop the PGA auto-ranging of an OPAMP.
+  * @note   The OPAMP keeps the last selected gain.
+  * @param  pRange auto-ranging structure
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_OPAMPEx_AutoRange_Stop(OPAMPEx_AutoRangeTypeDef *pRange)
+{
+  /* Check the structure allocation */
+  if ((pRange == NULL) || (pRange->hadc == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  __HAL_ADC_DISABLE_IT(pRange->hadc, ADC_IT_AWD1);
+  __HAL_ADC_CLEAR_FLAG(pRange->hadc, ADC_FLAG_AWD1);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Adjust the PGA gain after an analog watchdog 1 event.
+  * @note   To be called from HAL_ADC_LevelOutOfWindowCallback(). The last
+  *         sample is read from the DMA buffer so that the ADC data register
+  *         is left to the DMA.
+  * @param  pRange auto-ranging structure
+  * @retval None
+  */
+void HAL_OPAMPEx_AutoRange_IRQHandler(OPAMPEx_AutoRangeTypeDef *pRange)
+{
+  uint32_t position;
+  uint32_t sample;
+  uint32_t gain = pRange->Gain;
+
+  /* Index of the next sample written by the DMA */
+  position = (pRange->BufferLength - __HAL_DMA_GET_COUNTER(pRange->hadc->DMA_Handle)) % pRange->BufferLength;
+  sample = pRange->pBuffer[(position + pRange->BufferLength - 1UL) % pRange->BufferLength];
+
+  if ((sample > pRange->HighThreshold) && (gain > pRange->MinGain))
+  {
+    gain--;
+  }
+  else if ((sample < pRange->LowThreshold) && (gain < pRange->MaxGain))
+  {
+    gain++;
+  }
+  else
+  {
+    /* Spurious event or gain limit reached */
+    return;
+  }
+
+  MODIFY_REG(pRange->hopamp->Instance->CSR, (OPAMP_CSR_PGGAIN_2 | OPAMP_CSR_PGGAIN_1 | OPAMP_CSR_PGGAIN_0),
+             OPAMPEx_PgaGain[gain]);
+  pRange->Gain = gain;
+
+  OPAMPEx_AutoRangeSetThresholds(pRange);
+
+  pRange->Tags[pRange->TagCount % OPAMPEX_AUTORANGE_TAGS].Position = position;
+  pRange->Tags[pRange->TagCount % OPAMPEX_AUTORANGE_TAGS].Gain = gain;
+  pRange->TagCount++;
+}
+
+/**
+  * @}
+  */
+#endif /* HAL_ADC_MODULE_ENABLED */
+
+/**
+  * @}
+  */
+
+/** @defgroup OPAMPEx_Private_Functions OPAMP Extended Private Functions
+  * @{
+  */
+#if defined(HAL_ADC_MODULE_ENABLED)
+/**
+  * @brief  Program the analog watchdog 1 thresholds for the current gain.
+  * @note   At the gain limits the threshold that can no longer be acted
+  *         upon is disabled to avoid an interrupt storm.
+  * @param  pRange auto-ranging structure
+  * @retval None
+  */
+static void OPAMPEx_AutoRangeSetThresholds(const OPAMPEx_AutoRangeTypeDef *pRange)
+{
+  uint32_t high = (pRange->Gain == pRange->MinGain) ? 0xFFFUL : pRange->HighThreshold;
+  uint32_t low = (pRange->Gain == pRange->MaxGain) ? 0UL : pRange->LowThreshold;
+
+  LL_ADC_ConfigAnalogWDThresholds(pRange->hadc->Instance, LL_ADC_AWD1, high, low);
+}
+#endif /* HAL_ADC_MODULE_ENABLED */
 /**
   * @}
   */
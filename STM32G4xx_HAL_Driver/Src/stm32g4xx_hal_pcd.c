@@ -90,6 +90,7 @@
 static HAL_StatusTypeDef PCD_EP_ISR_Handler(PCD_HandleTypeDef *hpcd);
 static HAL_StatusTypeDef HAL_PCD_EP_DB_Transmit(PCD_HandleTypeDef *hpcd, PCD_EPTypeDef *ep, uint16_t wEPVal);
 static uint16_t HAL_PCD_EP_DB_Receive(PCD_HandleTypeDef *hpcd, PCD_EPTypeDef *ep, uint16_t wEPVal);
+static void PCD_EP_StartQueuedXfer(PCD_HandleTypeDef *hpcd, PCD_EPTypeDef *ep);
 
 /**
   * @}
@@ -1417,6 +1418,9 @@ HAL_StatusTypeDef HAL_PCD_EP_Close(PCD_HandleTypeDef *hpcd, uint8_t ep_addr)
   }
   ep->num   = ep_addr & EP_ADDR_MSK;
 
+  /* Drop the queued transfers */
+  ep->xfer_queued = 0U;
+
   __HAL_LOCK(hpcd);
   (void)USB_DeactivateEndpoint(hpcd->Instance, ep);
   __HAL_UNLOCK(hpcd);
@@ -1821,6 +1825,9 @@ static HAL_StatusTypeDef PCD_EP_ISR_Handler(PCD_HandleTypeDef *hpcd)
 
         if ((ep->xfer_len == 0U) || (count < ep->maxpacket))
         {
+          /* Start the queued transfer before the upper layer is informed */
+          PCD_EP_StartQueuedXfer(hpcd, ep);
+
           /* RX COMPLETE */
 #if (USE_HAL_PCD_REGISTER_CALLBACKS == 1U)
           hpcd->DataOutStageCallback(hpcd, ep->num);
@@ -1861,6 +1868,9 @@ static HAL_StatusTypeDef PCD_EP_ISR_Handler(PCD_HandleTypeDef *hpcd)
           /* Zero Length Packet? */
           if (ep->xfer_len == 0U)
           {
+            /* Start the queued transfer before the upper layer is informed */
+            PCD_EP_StartQueuedXfer(hpcd, ep);
+
             /* TX COMPLETE */
 #if (USE_HAL_PCD_REGISTER_CALLBACKS == 1U)
             hpcd->DataInStageCallback(hpcd, ep->num);
@@ -2000,6 +2010,9 @@ static HAL_StatusTypeDef HAL_PCD_EP_DB_Transmit(PCD_HandleTypeDef *hpcd,
     /* Transfer is completed */
     if (ep->xfer_len == 0U)
     {
+      /* Start the queued transfer before the upper layer is informed */
+      PCD_EP_StartQueuedXfer(hpcd, ep);
+
       /* TX COMPLETE */
 #if (USE_HAL_PCD_REGISTER_CALLBACKS == 1U)
       hpcd->DataInStageCallback(hpcd, ep->num);
@@ -2070,6 +2083,9 @@ static HAL_StatusTypeDef HAL_PCD_EP_DB_Transmit(PCD_HandleTypeDef *hpcd,
     /* Transfer is completed */
     if (ep->xfer_len == 0U)
     {
+      /* Start the queued transfer before the upper layer is informed */
+      PCD_EP_StartQueuedXfer(hpcd, ep);
+
       /* TX COMPLETE */
 #if (USE_HAL_PCD_REGISTER_CALLBACKS == 1U)
       hpcd->DataInStageCallback(hpcd, ep->num);
@@ -2130,6 +2146,50 @@ static HAL_StatusTypeDef HAL_PCD_EP_DB_Transmit(PCD_HandleTypeDef *hpcd,
   return HAL_OK;
 }
 
+/**
+  * @brief  Start the transfer queued with HAL_PCDEx_EP_QueueTransmit() or
+  *         HAL_PCDEx_EP_QueueReceive() when the current one is completed
+  * @param  hpcd PCD handle
+  * @param  ep current endpoint handle
+  * @retval None
+  */
+static void PCD_EP_StartQueuedXfer(PCD_HandleTypeDef *hpcd, PCD_EPTypeDef *ep)
+{
+  if (ep->xfer_queued == 0U)
+  {
+    /* Transfer not started by the queued transfer API */
+    return;
+  }
+
+  if (ep->is_in == 0U)
+  {
+    /* Keep the received length, xfer_count is reset by the next transfer */
+    ep->xfer_last_count = ep->xfer_count;
+  }
+
+  if (ep->xfer_queued == 2U)
+  {
+    ep->xfer_queued = 1U;
+
+    /*setup and start the Xfer */
+    ep->xfer_buff = ep->xfer_next_buff;
+    ep->xfer_len = ep->xfer_next_len;
+    ep->xfer_count = 0U;
+
+    if (ep->is_in != 0U)
+    {
+      ep->xfer_fill_db = 1U;
+      ep->xfer_len_db = ep->xfer_next_len;
+    }
+
+    (void)USB_EPStartXfer(hpcd->Instance, ep);
+  }
+  else
+  {
+    ep->xfer_queued = 0U;
+  }
+}
+
 
 
 /**
@@ -56,6 +56,15 @@
  ===============================================================================
     [..]  This section provides functions allowing to:
       (+) Update FIFO configuration
+      (+) Queue endpoint transfers: with HAL_PCDEx_EP_QueueTransmit() and
+          HAL_PCDEx_EP_QueueReceive() a second transfer can be queued while the
+          current one is ongoing. It is started by the driver as soon as the current
+          one completes, before HAL_PCD_DataInStageCallback() or
+          HAL_PCD_DataOutStageCallback() is called, so that the host is not NAKed
+          while the upper layer prepares the next buffer. With a double buffered
+          bulk endpoint (HAL_PCDEx_PMAConfig() with PCD_DBL_BUF) the packets then
+          stream without gap. The length of a completed OUT transfer is given by
+          HAL_PCDEx_EP_GetQueuedRxCount()
 
 @endverbatim
   * @{
@@ -115,6 +124,104 @@ HAL_StatusTypeDef  HAL_PCDEx_PMAConfig(PCD_HandleTypeDef *hpcd,
   return HAL_OK;
 }
 
+/**
+  * @brief  Queue a transfer on a non control endpoint
+  * @param  hpcd PCD handle
+  * @param  ep endpoint handle
+  * @param  ep_addr endpoint address
+  * @param  pBuf pointer to the transfer buffer
+  * @param  len amount of data to transfer
+  * @retval HAL status, HAL_BUSY when a transfer is already queued
+  */
+static HAL_StatusTypeDef PCDEx_EP_QueueXfer(PCD_HandleTypeDef *hpcd, PCD_EPTypeDef *ep,
+                                            uint8_t ep_addr, uint8_t *pBuf, uint32_t len)
+{
+  uint32_t primask_bit;
+
+  if ((ep_addr & EP_ADDR_MSK) == 0U)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Enter critical section: the queue is also updated by the USB interrupt */
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  if (ep->xfer_queued == 0U)
+  {
+    /* Endpoint idle: start the transfer now */
+    ep->xfer_queued = 1U;
+    __set_PRIMASK(primask_bit);
+
+    if ((ep_addr & 0x80U) == 0x80U)
+    {
+      return HAL_PCD_EP_Transmit(hpcd, ep_addr, pBuf, len);
+    }
+    return HAL_PCD_EP_Receive(hpcd, ep_addr, pBuf, len);
+  }
+
+  if (ep->xfer_queued != 1U)
+  {
+    __set_PRIMASK(primask_bit);
+    return HAL_BUSY;
+  }
+
+  /* Started at the end of the current transfer */
+  ep->xfer_next_buff = pBuf;
+  ep->xfer_next_len = len;
+  ep->xfer_queued = 2U;
+
+  /* Exit critical section */
+  __set_PRIMASK(primask_bit);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Queue a transmit transfer on a non control IN endpoint
+  * @note   The transfer is started now when the endpoint is idle, else at the end
+  *         of the current queued transfer. Only one transfer can be waiting.
+  * @param  hpcd PCD handle
+  * @param  ep_addr endpoint address
+  * @param  pBuf pointer to the transmission buffer
+  * @param  len amount of data to be sent
+  * @retval HAL status, HAL_BUSY when a transfer is already waiting
+  */
+HAL_StatusTypeDef HAL_PCDEx_EP_QueueTransmit(PCD_HandleTypeDef *hpcd, uint8_t ep_addr,
+                                             uint8_t *pBuf, uint32_t len)
+{
+  return PCDEx_EP_QueueXfer(hpcd, &hpcd->IN_ep[ep_addr & EP_ADDR_MSK], ep_addr | 0x80U, pBuf, len);
+}
+
+/**
+  * @brief  Queue a receive transfer on a non control OUT endpoint
+  * @note   The transfer is started now when the endpoint is idle, else at the end
+  *         of the current queued transfer. Only one transfer can be waiting.
+  * @param  hpcd PCD handle
+  * @param  ep_addr endpoint address
+  * @param  pBuf pointer to the reception buffer
+  * @param  len amount of data to be received
+  * @retval HAL status, HAL_BUSY when a transfer is already waiting
+  */
+HAL_StatusTypeDef HAL_PCDEx_EP_QueueReceive(PCD_HandleTypeDef *hpcd, uint8_t ep_addr,
+                                            uint8_t *pBuf, uint32_t len)
+{
+  return PCDEx_EP_QueueXfer(hpcd, &hpcd->OUT_ep[ep_addr & EP_ADDR_MSK], ep_addr & EP_ADDR_MSK, pBuf, len);
+}
+
+/**
+  * @brief  Get the length received by the last completed queued OUT transfer
+  * @note   To be used in HAL_PCD_DataOutStageCallback() instead of
+  *         HAL_PCD_EP_GetRxCount(), the next queued transfer being already started.
+  * @param  hpcd PCD handle
+  * @param  ep_addr endpoint address
+  * @retval Data Size
+  */
+uint32_t HAL_PCDEx_EP_GetQueuedRxCount(PCD_HandleTypeDef *hpcd, uint8_t ep_addr)
+{
+  return hpcd->OUT_ep[ep_addr & EP_ADDR_MSK].xfer_last_count;
+}
+
 /**
   * @brief  Activate BatteryCharging feature.
   * @param  hpcd PCD handle
@@ -8,6 +8,7 @@
   *           + Extended Peripheral Control functions
   *           + Extended Clock management functions
   *           + Extended Clock Recovery System Control functions
+  *           + Extended Performance Level functions
   *
   ******************************************************************************
   * @attention
@@ -43,6 +44,7 @@
  * @{
  */
 #define PLL_TIMEOUT_VALUE        2U                /* 2 ms (minimum Tick + 1) */
+#define HSI_TIMEOUT_VALUE        2U                /* 2 ms (minimum Tick + 1) */
 
 #define DIVIDER_P_UPDATE          0U
 #define DIVIDER_Q_UPDATE          1U
@@ -51,16 +53,81 @@
 #define __LSCO_CLK_ENABLE()       __HAL_RCC_GPIOA_CLK_ENABLE()
 #define LSCO_GPIO_PORT            GPIOA
 #define LSCO_PIN                  GPIO_PIN_2
+
+#define RCC_RANGE2_SYSCLK_MAX     26000000U   /* Voltage range 2                  */
+#define RCC_RANGE1_SYSCLK_MAX     150000000U  /* Voltage range 1 normal mode      */
+#define RCC_BOOST_SYSCLK_MAX      170000000U  /* Voltage range 1 boost mode       */
+
+#define RCC_RANGE2_WS_FREQ        12000000U   /* Max HCLK per wait state in range 2    */
+#define RCC_RANGE1_WS_FREQ        30000000U   /* Max HCLK per wait state in range 1    */
+#define RCC_BOOST_WS_FREQ         34000000U   /* Max HCLK per wait state in boost mode */
 /**
   * @}
   */
 
 /* Private macros ------------------------------------------------------------*/
+/* HSI calibration: TIM16 input capture prescaler (LSE periods per capture) */
+#define RCCEx_HSI_CALIB_CAPTURE_PERIODS  8U
+
+/* HSI calibration: maximum number of trimming steps tried per call */
+#define RCCEx_HSI_CALIB_MAX_STEPS        8U
+
+/* HSI calibration: timeout of one measurement, in ms */
+#define RCCEx_HSI_CALIB_TIMEOUT_VALUE    100U
+
+#if defined(CRS)
+/* USB full speed SOF frequency (Hz) */
+#define RCCEx_CRS_USB_SOF_FREQ       1000U
+
+/* HSI48 typical trimming step, in hundredths of percent (0.14 %) */
+#define RCCEx_CRS_TRIM_STEP          14U
+
+/* Frequency error counts corresponding to one trimming step */
+#define RCCEx_CRS_COUNTS_PER_STEP(__RELOAD__) \
+  ((((__RELOAD__) + 1U) * RCCEx_CRS_TRIM_STEP) / 10000U)
+
+/* Optimal FELIM: half a trimming step, rounded up */
+#define RCCEx_CRS_ERRORLIMIT_OPTIMAL(__RELOAD__) \
+  (((((__RELOAD__) + 1U) * RCCEx_CRS_TRIM_STEP) + 19999U) / 20000U)
+#endif /* CRS */
+
 /* Private variables ---------------------------------------------------------*/
+#if defined(CRS)
+static RCC_CRSAutoTrimTypeDef *pCrsAutoTrim = NULL;
+#endif /* CRS */
+
+/* Predefined operating points, indexed by RCC_PERF_LEVEL_x */
+static const RCC_OperatingPointTypeDef RCCEx_PerfLevelTable[RCC_PERF_LEVEL_MAX + 1U] =
+{
+  /* Level 0: HSI 16 MHz, range 2 */
+  { PWR_REGULATOR_VOLTAGE_SCALE2, RCC_SYSCLKSOURCE_HSI, RCC_PLLM_DIV4, 52U, RCC_PLLR_DIV8,
+    RCC_SYSCLK_DIV1, RCC_HCLK_DIV1, RCC_HCLK_DIV1 },
+  /* Level 1: PLL 16 MHz / 4 x 52 / 8 = 26 MHz, range 2 */
+  { PWR_REGULATOR_VOLTAGE_SCALE2, RCC_SYSCLKSOURCE_PLLCLK, RCC_PLLM_DIV4, 52U, RCC_PLLR_DIV8,
+    RCC_SYSCLK_DIV1, RCC_HCLK_DIV1, RCC_HCLK_DIV1 },
+  /* Level 2: PLL 16 MHz / 4 x 75 / 2 = 150 MHz, range 1 */
+  { PWR_REGULATOR_VOLTAGE_SCALE1, RCC_SYSCLKSOURCE_PLLCLK, RCC_PLLM_DIV4, 75U, RCC_PLLR_DIV2,
+    RCC_SYSCLK_DIV1, RCC_HCLK_DIV1, RCC_HCLK_DIV1 },
+#if defined(PWR_CR5_R1MODE)
+  /* Level 3: PLL 16 MHz / 4 x 85 / 2 = 170 MHz, range 1 boost */
+  { PWR_REGULATOR_VOLTAGE_SCALE1_BOOST, RCC_SYSCLKSOURCE_PLLCLK, RCC_PLLM_DIV4, 85U, RCC_PLLR_DIV2,
+    RCC_SYSCLK_DIV1, RCC_HCLK_DIV1, RCC_HCLK_DIV1 },
+#endif /* PWR_CR5_R1MODE */
+};
+
+/* Current performance level, above RCC_PERF_LEVEL_MAX until a level is selected */
+static uint32_t RCCEx_PerfLevel = 0xFFFFFFFFU;
+
 /* Private function prototypes -----------------------------------------------*/
 /** @defgroup RCCEx_Private_Functions RCCEx Private Functions
  * @{
  */
+static HAL_StatusTypeDef RCCEx_HSIMeasure(RCC_HSICalibrationTypeDef *pCalib, uint32_t TimClock);
+#if defined(CRS)
+static void RCCEx_CRSAutoTrimUpdate(uint32_t Event);
+#endif /* CRS */
+static uint32_t RCCEx_VoltageRank(uint32_t VoltageScaling);
+static uint32_t RCCEx_GetFlashLatency(uint32_t HCLKFreq, uint32_t VoltageScaling);
 
 /**
   * @}
@@ -1274,6 +1341,11 @@ uint32_t HAL_RCCEx_GetPeriphCLKFreq(uint32_t PeriphClk)
     This subsection provides a set of functions allowing to control the
     activation or deactivation of LSE CSS,
     Low speed clock output and clock after wake-up from STOP mode.
+    [..]
+    On boards without HSE, HAL_RCCEx_HSICalibrate() measures the HSI against
+    the LSE with a TIM16 input capture and trims it toward HSI_VALUE. It can be
+    called periodically (for instance every few seconds or on temperature change)
+    to keep UART baud rates accurate at high speeds.
 @endverbatim
   * @{
   */
@@ -1436,6 +1508,143 @@ void HAL_RCCEx_DisableLSCO(void)
   }
 }
 
+/**
+  * @brief  Calibrate the HSI against the LSE.
+  * @note   The HSI frequency is measured with TIM16 channel 1 capturing the LSE
+  *         (TISEL routing), then the HSI trimming value is stepped toward HSI_VALUE
+  *         until the error changes sign, keeping the value giving the lowest error.
+  * @note   The LSE must be ready and the system clock must be the HSI or the PLL
+  *         clocked by the HSI, so that the TIM16 kernel clock derives from the HSI.
+  * @note   TIM16 is used during the calibration and is reset afterwards, it must
+  *         not be used by the application meanwhile.
+  * @note   HSI_VALUE and LSE_VALUE are used as the nominal frequencies, SystemCoreClock
+  *         is not updated as the nominal system clock frequency does not change.
+  * @param  pCalib Pointer on RCC_HSICalibrationTypeDef structure, MeasureCycles is an
+  *         input and the remaining fields are updated with the calibration result.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_RCCEx_HSICalibrate(RCC_HSICalibrationTypeDef *pCalib)
+{
+  HAL_StatusTypeDef status;
+  FlagStatus        timclkchanged = RESET;
+  uint32_t          timclock;
+  uint32_t          trim;
+  uint32_t          besttrim;
+  uint32_t          bestfreq;
+  int32_t           besterror;
+  int32_t           error;
+  uint32_t          step;
+
+  if((pCalib == NULL) || (pCalib->MeasureCycles == 0U) || (pCalib->MeasureCycles > 256U))
+  {
+    return HAL_ERROR;
+  }
+
+  /* The LSE is the reference clock */
+  if(__HAL_RCC_GET_FLAG(RCC_FLAG_LSERDY) == 0U)
+  {
+    return HAL_ERROR;
+  }
+
+  /* The TIM16 kernel clock must be derived from the HSI */
+  if(!((__HAL_RCC_GET_SYSCLK_SOURCE() == RCC_SYSCLKSOURCE_STATUS_HSI) ||
+       ((__HAL_RCC_GET_SYSCLK_SOURCE() == RCC_SYSCLKSOURCE_STATUS_PLLCLK) &&
+        (__HAL_RCC_GET_PLL_OSCSOURCE() == RCC_PLLSOURCE_HSI))))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Nominal TIM16 kernel clock: PCLK2, doubled when APB2 is divided */
+  timclock = HAL_RCC_GetPCLK2Freq();
+  if(READ_BIT(RCC->CFGR, RCC_CFGR_PPRE2_2) != 0U)
+  {
+    timclock *= 2U;
+  }
+
+  if(!__HAL_RCC_TIM16_IS_CLK_ENABLED())
+  {
+    __HAL_RCC_TIM16_CLK_ENABLE();
+    timclkchanged = SET;
+  }
+
+  /* TIM16 channel 1 captures every RCCEx_HSI_CALIB_CAPTURE_PERIODS LSE rising edges */
+  TIM16->CR1   = 0U;
+  TIM16->TISEL = (TIM_TISEL_TI1SEL_2 | TIM_TISEL_TI1SEL_0);
+  TIM16->PSC   = 0U;
+  TIM16->ARR   = 0xFFFFU;
+  TIM16->CCMR1 = (TIM_CCMR1_CC1S_0 | TIM_CCMR1_IC1PSC);
+  TIM16->CCER  = TIM_CCER_CC1E;
+  TIM16->EGR   = TIM_EGR_UG;
+  TIM16->SR    = 0U;
+  TIM16->CR1   = TIM_CR1_CEN;
+
+  trim = READ_BIT(RCC->ICSCR, RCC_ICSCR_HSITRIM) >> RCC_ICSCR_HSITRIM_Pos;
+
+  status = RCCEx_HSIMeasure(pCalib, timclock);
+  besttrim  = trim;
+  bestfreq  = pCalib->HSIFrequency;
+  besterror = pCalib->HSIErrorPpm;
+  error     = pCalib->HSIErrorPpm;
+
+  for(step = 0U; (status == HAL_OK) && (step < RCCEx_HSI_CALIB_MAX_STEPS) && (error != 0); step++)
+  {
+    /* Step the trimming value toward the target frequency */
+    if(error > 0)
+    {
+      if(trim == 0U)
+      {
+        break;
+      }
+      trim--;
+    }
+    else
+    {
+      if(trim == (RCC_ICSCR_HSITRIM >> RCC_ICSCR_HSITRIM_Pos))
+      {
+        break;
+      }
+      trim++;
+    }
+    __HAL_RCC_HSI_CALIBRATIONVALUE_ADJUST(trim);
+
+    status = RCCEx_HSIMeasure(pCalib, timclock);
+    if(status == HAL_OK)
+    {
+      if(((pCalib->HSIErrorPpm < 0) ? -pCalib->HSIErrorPpm : pCalib->HSIErrorPpm) <
+         ((besterror < 0) ? -besterror : besterror))
+      {
+        besttrim  = trim;
+        bestfreq  = pCalib->HSIFrequency;
+        besterror = pCalib->HSIErrorPpm;
+      }
+
+      /* Stop once the target frequency has been crossed */
+      if((error > 0) != (pCalib->HSIErrorPpm > 0))
+      {
+        break;
+      }
+      error = pCalib->HSIErrorPpm;
+    }
+  }
+
+  /* Keep the trimming value giving the lowest error */
+  __HAL_RCC_HSI_CALIBRATIONVALUE_ADJUST(besttrim);
+  pCalib->HSICalibrationValue = besttrim;
+  pCalib->HSIFrequency        = bestfreq;
+  pCalib->HSIErrorPpm         = besterror;
+
+  /* Release TIM16 */
+  TIM16->CR1 = 0U;
+  __HAL_RCC_TIM16_FORCE_RESET();
+  __HAL_RCC_TIM16_RELEASE_RESET();
+  if(timclkchanged == SET)
+  {
+    __HAL_RCC_TIM16_CLK_DISABLE();
+  }
+
+  return status;
+}
+
 
 /**
   * @}
@@ -1503,6 +1712,19 @@ void HAL_RCCEx_DisableLSCO(void)
       (#) To force a SYNC EVENT, user can use the function HAL_RCCEx_CRSSoftwareSynchronizationGenerate().
           This function can be called before calling HAL_RCCEx_CRSConfig (for instance in Systick handler)
 
+      (#) For crystal-less USB, the USB auto-trim service can be used instead of a manual configuration:
+              (++) Enable CRS_IRQn (thanks to NVIC functions)
+              (++) Call function HAL_RCCEx_CRSStartUSBAutoTrim() with a RCC_CRSAutoTrimTypeDef context
+                   and an optional trim history buffer: the CRS is configured on USB SOF with the reload
+                   and frequency error limit values matching the HSI48 trimming step, and the
+                   SYNCWARN and error interrupts are enabled.
+              (++) Each SYNC warning or error handled by HAL_RCCEx_CRS_IRQHandler() updates the context
+                   statistics and appends a record to the trim history. On SYNC error the TRIM value is
+                   corrected by software from the captured frequency error so that the automatic trimming
+                   recovers within a few frames (e.g. after a large temperature change).
+              (++) Call function HAL_RCCEx_CRSStopUSBAutoTrim() to stop the statistics collection. The
+                   automatic trimming itself remains active.
+
 @endverbatim
  * @{
  */
@@ -1676,6 +1898,78 @@ uint32_t HAL_RCCEx_CRSWaitSynchronization(uint32_t Timeout)
   return crsstatus;
 }
 
+/**
+  * @brief  Start the CRS USB auto-trim service.
+  * @note   The CRS is configured to trim the HSI48 on the USB SOF with the optimal reload
+  *         and frequency error limit values, and the SYNCWARN and error interrupts are
+  *         enabled. The CRS clock must be enabled and CRS_IRQn must be enabled in the NVIC.
+  * @note   SYNC OK and expected SYNC interrupts are left disabled as they would fire at
+  *         every USB frame.
+  * @param  pAutoTrim Pointer on the auto-trim context, updated from HAL_RCCEx_CRS_IRQHandler()
+  * @param  pHistory Pointer on the trim history buffer, can be NULL
+  * @param  HistorySize Number of records of pHistory, must be a power of 2 (ignored when pHistory is NULL)
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_RCCEx_CRSStartUSBAutoTrim(RCC_CRSAutoTrimTypeDef *pAutoTrim,
+                                                RCC_CRSTrimRecordTypeDef *pHistory, uint32_t HistorySize)
+{
+  RCC_CRSInitTypeDef crsinit;
+
+  if(pAutoTrim == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  if((pHistory != NULL) && ((HistorySize == 0U) || ((HistorySize & (HistorySize - 1U)) != 0U)))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Detach the previous context before reconfiguring the CRS */
+  __HAL_RCC_CRS_DISABLE_IT(RCC_CRS_IT_SYNCWARN | RCC_CRS_IT_ERR);
+  pCrsAutoTrim = NULL;
+
+  pAutoTrim->pHistory        = pHistory;
+  pAutoTrim->HistorySize     = (pHistory != NULL) ? HistorySize : 0U;
+  pAutoTrim->HistoryCount    = 0U;
+  pAutoTrim->SyncWarnCount   = 0U;
+  pAutoTrim->SyncErrCount    = 0U;
+  pAutoTrim->SyncMissCount   = 0U;
+  pAutoTrim->TrimOvfCount    = 0U;
+  pAutoTrim->CoarseTrimCount = 0U;
+  pAutoTrim->TrimMin         = RCC_CRS_HSI48CALIBRATION_DEFAULT;
+  pAutoTrim->TrimMax         = RCC_CRS_HSI48CALIBRATION_DEFAULT;
+
+  /* SOF based trimming: one SYNC every 1 ms, FELIM matching half a trimming step */
+  crsinit.Prescaler             = RCC_CRS_SYNC_DIV1;
+  crsinit.Source                = RCC_CRS_SYNC_SOURCE_USB;
+  crsinit.Polarity              = RCC_CRS_SYNC_POLARITY_RISING;
+  crsinit.ReloadValue           = __HAL_RCC_CRS_RELOADVALUE_CALCULATE(HSI48_VALUE, RCCEx_CRS_USB_SOF_FREQ);
+  crsinit.ErrorLimitValue       = RCCEx_CRS_ERRORLIMIT_OPTIMAL(crsinit.ReloadValue);
+  crsinit.HSI48CalibrationValue = RCC_CRS_HSI48CALIBRATION_DEFAULT;
+  HAL_RCCEx_CRSConfig(&crsinit);
+
+  pCrsAutoTrim = pAutoTrim;
+
+  /* Clear pending flags and enable the monitored interrupts */
+  WRITE_REG(CRS->ICR, CRS_ICR_SYNCOKC | CRS_ICR_SYNCWARNC | CRS_ICR_ERRC | CRS_ICR_ESYNCC);
+  __HAL_RCC_CRS_ENABLE_IT(RCC_CRS_IT_SYNCWARN | RCC_CRS_IT_ERR);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop the CRS USB auto-trim service.
+  * @note   The SYNCWARN and error interrupts are disabled and the context is released.
+  *         The CRS automatic trimming is kept running.
+  * @retval None
+  */
+void HAL_RCCEx_CRSStopUSBAutoTrim(void)
+{
+  __HAL_RCC_CRS_DISABLE_IT(RCC_CRS_IT_SYNCWARN | RCC_CRS_IT_ERR);
+  pCrsAutoTrim = NULL;
+}
+
 /**
   * @brief Handle the Clock Recovery System interrupt request.
   * @retval None
@@ -1702,6 +1996,12 @@ void HAL_RCCEx_CRS_IRQHandler(void)
     /* Clear CRS SYNCWARN flag */
     WRITE_REG(CRS->ICR, CRS_ICR_SYNCWARNC);
 
+    /* auto-trim service */
+    if(pCrsAutoTrim != NULL)
+    {
+      RCCEx_CRSAutoTrimUpdate(RCC_CRS_SYNCWARN);
+    }
+
     /* user callback */
     HAL_RCCEx_CRS_SyncWarnCallback();
   }
@@ -1735,6 +2035,12 @@ void HAL_RCCEx_CRS_IRQHandler(void)
       /* Clear CRS Error flags */
       WRITE_REG(CRS->ICR, CRS_ICR_ERRC);
 
+      /* auto-trim service */
+      if(pCrsAutoTrim != NULL)
+      {
+        RCCEx_CRSAutoTrimUpdate(crserror);
+      }
+
       /* user error callback */
       HAL_RCCEx_CRS_ErrorCallback(crserror);
     }
@@ -1799,6 +2105,309 @@ __weak void HAL_RCCEx_CRS_ErrorCallback(uint32_t Error)
 
 #endif /* CRS */
 
+/** @defgroup RCCEx_Exported_Functions_Group4 Extended Performance Level functions
+ *  @brief  Extended Performance Level functions
+ *
+@verbatim
+ ===============================================================================
+                ##### Extended Performance Level functions #####
+ ===============================================================================
+    [..]
+      The regulator voltage range, the FLASH latency and the system clock must be
+      changed in a given order: the voltage is raised before the frequency and
+      lowered after it, the latency is increased before the frequency and decreased
+      after it, and the PLL can only be reconfigured while it is not the system clock.
+      These functions apply this order to switch between operating points.
+
+    [..]
+      (+) HAL_RCCEx_SetOperatingPoint() switches to any operating point described by
+          an RCC_OperatingPointTypeDef structure, with the system clock on HSI16 or
+          on the main PLL clocked by HSI16.
+
+      (+) HAL_RCCEx_SetPerformanceLevel() switches to one of the predefined operating
+          points of @ref RCCEx_Performance_Level, from HSI 16 MHz in voltage range 2
+          up to 150 MHz in range 1, or 170 MHz in range 1 boost mode.
+
+      (+) HAL_RCCEx_PerformanceGovernor() is to be called periodically with the CPU
+          load, for instance measured from the idle time. It selects the next level
+          up above RCC_PERF_LOAD_HIGH and the next level down below RCC_PERF_LOAD_LOW.
+
+      (+) HAL_RCCEx_PerformanceLevelCallback() is called after each level change, so
+          that the application can update the peripherals depending on the bus clocks.
+
+    [..]
+      (@) When the system clock is on the PLL, the P and Q outputs of the main PLL
+          also change with an operating point change: check the clocks derived from
+          them (ADC, USB, FDCAN, SAI, I2S, QUADSPI) before using these functions.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Switch the regulator voltage range, the FLASH latency and the system
+  *         clock to an operating point, in the order required by the device.
+  * @note   The voltage range is raised first when the target one is higher: the
+  *         system clock is then switched with HAL_RCC_ClockConfig(), which sets
+  *         the FLASH latency before a frequency increase and after a decrease, and
+  *         goes through an HCLK divided by 2 above 80 MHz. The voltage range is
+  *         lowered last when the target one is lower.
+  * @note   When the PLL is the system clock before the change, the system clock is
+  *         moved to HSI16 while the PLL is reconfigured. The PLL is kept running when
+  *         the target clock is HSI16 only if its P or Q outputs are enabled.
+  * @param  pOperatingPoint  pointer to an RCC_OperatingPointTypeDef structure.
+  * @retval HAL status: HAL_ERROR if the system clock exceeds the maximum of the
+  *         voltage range.
+  */
+HAL_StatusTypeDef HAL_RCCEx_SetOperatingPoint(const RCC_OperatingPointTypeDef *pOperatingPoint)
+{
+  RCC_ClkInitTypeDef clkinit;
+  uint32_t sysclk, maxclk, vos, tickstart;
+  uint32_t pwrclkchanged = 0U;
+  HAL_StatusTypeDef status;
+
+  if(pOperatingPoint == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  assert_param(IS_PWR_VOLTAGE_SCALING_RANGE(pOperatingPoint->VoltageScaling));
+  assert_param(IS_RCC_HCLK(pOperatingPoint->AHBCLKDivider));
+
+  /* Check the system clock against the maximum of the voltage range */
+  sysclk = HSI_VALUE;
+  if(pOperatingPoint->SYSCLKSource == RCC_SYSCLKSOURCE_PLLCLK)
+  {
+    assert_param(IS_RCC_PLLM_VALUE(pOperatingPoint->PLLM));
+    assert_param(IS_RCC_PLLN_VALUE(pOperatingPoint->PLLN));
+    assert_param(IS_RCC_PLLR_VALUE(pOperatingPoint->PLLR));
+    sysclk = ((sysclk / pOperatingPoint->PLLM) * pOperatingPoint->PLLN) / pOperatingPoint->PLLR;
+  }
+  else if(pOperatingPoint->SYSCLKSource != RCC_SYSCLKSOURCE_HSI)
+  {
+    return HAL_ERROR;
+  }
+  else
+  {
+    /* Nothing to check on HSI16 */
+  }
+
+  switch(RCCEx_VoltageRank(pOperatingPoint->VoltageScaling))
+  {
+  case 0U:
+    maxclk = RCC_RANGE2_SYSCLK_MAX;
+    break;
+  case 1U:
+    maxclk = RCC_RANGE1_SYSCLK_MAX;
+    break;
+  default:
+    maxclk = RCC_BOOST_SYSCLK_MAX;
+    break;
+  }
+  if(sysclk > maxclk)
+  {
+    return HAL_ERROR;
+  }
+
+  if(__HAL_RCC_PWR_IS_CLK_DISABLED())
+  {
+    __HAL_RCC_PWR_CLK_ENABLE();
+    pwrclkchanged = 1U;
+  }
+  vos = HAL_PWREx_GetVoltageRange();
+
+  /* 1. Raise the voltage range before the frequency */
+  status = HAL_OK;
+  if(RCCEx_VoltageRank(pOperatingPoint->VoltageScaling) > RCCEx_VoltageRank(vos))
+  {
+    status = HAL_PWREx_ControlVoltageScaling(pOperatingPoint->VoltageScaling);
+    vos = pOperatingPoint->VoltageScaling;
+  }
+
+  /* 2. HSI16 must be running: it clocks the system during the PLL reconfiguration */
+  if((status == HAL_OK) && (READ_BIT(RCC->CR, RCC_CR_HSIRDY) == 0U))
+  {
+    __HAL_RCC_HSI_ENABLE();
+    tickstart = HAL_GetTick();
+    while(READ_BIT(RCC->CR, RCC_CR_HSIRDY) == 0U)
+    {
+      if((HAL_GetTick() - tickstart) > HSI_TIMEOUT_VALUE)
+      {
+        status = HAL_TIMEOUT;
+        break;
+      }
+    }
+  }
+
+  /* 3. Move the system clock off the PLL, the current FLASH latency covers HSI16 */
+  if((status == HAL_OK) && (__HAL_RCC_GET_SYSCLK_SOURCE() == RCC_SYSCLKSOURCE_STATUS_PLLCLK))
+  {
+    clkinit.ClockType = RCC_CLOCKTYPE_SYSCLK;
+    clkinit.SYSCLKSource = RCC_SYSCLKSOURCE_HSI;
+    status = HAL_RCC_ClockConfig(&clkinit, __HAL_FLASH_GET_LATENCY());
+  }
+
+  /* 4. Main PLL from HSI16, reconfigured while it is stopped */
+  if((status == HAL_OK) &&
+     ((pOperatingPoint->SYSCLKSource == RCC_SYSCLKSOURCE_PLLCLK) ||
+      (READ_BIT(RCC->PLLCFGR, RCC_PLLCFGR_PLLPEN | RCC_PLLCFGR_PLLQEN) == 0U)))
+  {
+    __HAL_RCC_PLL_DISABLE();
+    tickstart = HAL_GetTick();
+    while(READ_BIT(RCC->CR, RCC_CR_PLLRDY) != 0U)
+    {
+      if((HAL_GetTick() - tickstart) > PLL_TIMEOUT_VALUE)
+      {
+        status = HAL_TIMEOUT;
+        break;
+      }
+    }
+
+    if((status == HAL_OK) && (pOperatingPoint->SYSCLKSource == RCC_SYSCLKSOURCE_PLLCLK))
+    {
+      MODIFY_REG(RCC->PLLCFGR, (RCC_PLLCFGR_PLLSRC | RCC_PLLCFGR_PLLM | RCC_PLLCFGR_PLLN | RCC_PLLCFGR_PLLR),
+                 (RCC_PLLSOURCE_HSI |
+                  ((pOperatingPoint->PLLM - 1U) << RCC_PLLCFGR_PLLM_Pos) |
+                  (pOperatingPoint->PLLN << RCC_PLLCFGR_PLLN_Pos) |
+                  (((pOperatingPoint->PLLR >> 1U) - 1U) << RCC_PLLCFGR_PLLR_Pos)));
+      __HAL_RCC_PLL_ENABLE();
+      __HAL_RCC_PLLCLKOUT_ENABLE(RCC_PLL_SYSCLK);
+
+      tickstart = HAL_GetTick();
+      while(READ_BIT(RCC->CR, RCC_CR_PLLRDY) == 0U)
+      {
+        if((HAL_GetTick() - tickstart) > PLL_TIMEOUT_VALUE)
+        {
+          status = HAL_TIMEOUT;
+          break;
+        }
+      }
+    }
+  }
+
+  /* 5. System clock and bus prescalers, with the FLASH latency of the target HCLK */
+  if(status == HAL_OK)
+  {
+    clkinit.ClockType = RCC_CLOCKTYPE_SYSCLK | RCC_CLOCKTYPE_HCLK | RCC_CLOCKTYPE_PCLK1 | RCC_CLOCKTYPE_PCLK2;
+    clkinit.SYSCLKSource = pOperatingPoint->SYSCLKSource;
+    clkinit.AHBCLKDivider = pOperatingPoint->AHBCLKDivider;
+    clkinit.APB1CLKDivider = pOperatingPoint->APB1CLKDivider;
+    clkinit.APB2CLKDivider = pOperatingPoint->APB2CLKDivider;
+    status = HAL_RCC_ClockConfig(&clkinit,
+                                 RCCEx_GetFlashLatency(sysclk >> (AHBPrescTable[(pOperatingPoint->AHBCLKDivider & RCC_CFGR_HPRE) >> RCC_CFGR_HPRE_Pos] & 0x1FU),
+                                                       vos));
+  }
+
+  /* 6. Lower the voltage range after the frequency */
+  if((status == HAL_OK) && (RCCEx_VoltageRank(pOperatingPoint->VoltageScaling) < RCCEx_VoltageRank(vos)))
+  {
+    status = HAL_PWREx_ControlVoltageScaling(pOperatingPoint->VoltageScaling);
+  }
+
+  if(pwrclkchanged == 1U)
+  {
+    __HAL_RCC_PWR_CLK_DISABLE();
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Switch to a predefined performance level.
+  * @param  Level  performance level.
+  *         This parameter can be a value of @ref RCCEx_Performance_Level.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_RCCEx_SetPerformanceLevel(uint32_t Level)
+{
+  HAL_StatusTypeDef status;
+
+  if(Level > RCC_PERF_LEVEL_MAX)
+  {
+    return HAL_ERROR;
+  }
+
+  if(Level == RCCEx_PerfLevel)
+  {
+    return HAL_OK;
+  }
+
+  status = HAL_RCCEx_SetOperatingPoint(&RCCEx_PerfLevelTable[Level]);
+  if(status == HAL_OK)
+  {
+    RCCEx_PerfLevel = Level;
+    HAL_RCCEx_PerformanceLevelCallback(Level);
+  }
+  else
+  {
+    /* The clock tree may be in an intermediate state */
+    RCCEx_PerfLevel = 0xFFFFFFFFU;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Return the performance level selected by HAL_RCCEx_SetPerformanceLevel().
+  * @retval Performance level, a value of @ref RCCEx_Performance_Level, or 0xFFFFFFFF
+  *         if no level has been selected or the last change failed.
+  */
+uint32_t HAL_RCCEx_GetPerformanceLevel(void)
+{
+  return RCCEx_PerfLevel;
+}
+
+/**
+  * @brief  Select the performance level from the CPU load.
+  * @note   One level is changed per call, to the next level up above RCC_PERF_LOAD_HIGH
+  *         and to the next level down below RCC_PERF_LOAD_LOW. When no level has been
+  *         selected yet, the highest level is selected.
+  * @param  LoadPercent  CPU load over the last period, from 0 to 100.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_RCCEx_PerformanceGovernor(uint32_t LoadPercent)
+{
+  uint32_t level = RCCEx_PerfLevel;
+
+  if(level > RCC_PERF_LEVEL_MAX)
+  {
+    level = RCC_PERF_LEVEL_MAX;
+  }
+  else if((LoadPercent > RCC_PERF_LOAD_HIGH) && (level < RCC_PERF_LEVEL_MAX))
+  {
+    level++;
+  }
+  else if((LoadPercent < RCC_PERF_LOAD_LOW) && (level > RCC_PERF_LEVEL_0))
+  {
+    level--;
+  }
+  else
+  {
+    /* Keep the current level */
+  }
+
+  return HAL_RCCEx_SetPerformanceLevel(level);
+}
+
+/**
+  * @brief  Performance level changed callback.
+  * @param  Level  new performance level, a value of @ref RCCEx_Performance_Level.
+  * @retval None
+  */
+__weak void HAL_RCCEx_PerformanceLevelCallback(uint32_t Level)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(Level);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the @ref HAL_RCCEx_PerformanceLevelCallback should be implemented in the user file
+   */
+}
+
+/**
+  * @}
+  */
+
 /**
   * @}
   */
@@ -1807,6 +2416,219 @@ __weak void HAL_RCCEx_CRS_ErrorCallback(uint32_t Error)
  * @{
  */
 
+/**
+  * @brief  Rank a voltage range by performance.
+  * @param  VoltageScaling  a value of @ref PWREx_Regulator_Voltage_Scale.
+  * @retval 0 for range 2, 1 for range 1 and 2 for range 1 boost mode
+  */
+static uint32_t RCCEx_VoltageRank(uint32_t VoltageScaling)
+{
+  uint32_t rank;
+
+  if(VoltageScaling == PWR_REGULATOR_VOLTAGE_SCALE2)
+  {
+    rank = 0U;
+  }
+#if defined(PWR_CR5_R1MODE)
+  else if(VoltageScaling == PWR_REGULATOR_VOLTAGE_SCALE1_BOOST)
+  {
+    rank = 2U;
+  }
+#endif /* PWR_CR5_R1MODE */
+  else
+  {
+    rank = 1U;
+  }
+
+  return rank;
+}
+
+/**
+  * @brief  Compute the FLASH latency for an HCLK frequency and a voltage range.
+  * @param  HCLKFreq  HCLK frequency, in Hz.
+  * @param  VoltageScaling  a value of @ref PWREx_Regulator_Voltage_Scale.
+  * @retval FLASH latency, a value of @ref FLASH_Latency.
+  */
+static uint32_t RCCEx_GetFlashLatency(uint32_t HCLKFreq, uint32_t VoltageScaling)
+{
+  uint32_t wsfreq;
+
+  switch(RCCEx_VoltageRank(VoltageScaling))
+  {
+  case 0U:
+    wsfreq = RCC_RANGE2_WS_FREQ;
+    break;
+  case 1U:
+    wsfreq = RCC_RANGE1_WS_FREQ;
+    break;
+  default:
+    wsfreq = RCC_BOOST_WS_FREQ;
+    break;
+  }
+
+  /* FLASH_LATENCY_n is n wait states */
+  return (HCLKFreq == 0U) ? FLASH_LATENCY_0 : ((HCLKFreq - 1U) / wsfreq);
+}
+
+/**
+  * @brief  Measure the HSI frequency against the LSE with TIM16 channel 1 captures.
+  * @note   A capture overrun (e.g. measurement preempted for more than one capture
+  *         period) restarts the accumulation.
+  * @param  pCalib Pointer on RCC_HSICalibrationTypeDef structure, HSIFrequency and
+  *         HSIErrorPpm are updated.
+  * @param  TimClock Nominal TIM16 kernel clock frequency, in Hz
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef RCCEx_HSIMeasure(RCC_HSICalibrationTypeDef *pCalib, uint32_t TimClock)
+{
+  uint32_t tickstart;
+  uint32_t capture;
+  uint32_t lastcapture = 0U;
+  uint32_t captures = 0U;
+  uint32_t counts = 0U;
+  uint64_t timfreq;
+  uint32_t hsifreq;
+
+  /* Discard any capture taken before this measurement */
+  (void)TIM16->CCR1;
+  TIM16->SR = 0U;
+
+  tickstart = HAL_GetTick();
+
+  while(captures <= pCalib->MeasureCycles)
+  {
+    while(READ_BIT(TIM16->SR, TIM_SR_CC1IF) == 0U)
+    {
+      if((HAL_GetTick() - tickstart) > RCCEx_HSI_CALIB_TIMEOUT_VALUE)
+      {
+        return HAL_TIMEOUT;
+      }
+    }
+
+    /* Reading CCR1 clears CC1IF */
+    capture = TIM16->CCR1;
+
+    if(READ_BIT(TIM16->SR, TIM_SR_CC1OF) != 0U)
+    {
+      /* Capture lost, restart from this one */
+      CLEAR_BIT(TIM16->SR, TIM_SR_CC1OF);
+      captures = 0U;
+      counts = 0U;
+    }
+    else if(captures != 0U)
+    {
+      counts += (capture - lastcapture) & 0xFFFFU;
+    }
+    else
+    {
+      /* first capture is the reference */
+    }
+
+    lastcapture = capture;
+    captures++;
+  }
+
+  /* Actual TIM16 kernel clock, then HSI frequency scaled from its nominal value */
+  timfreq = ((uint64_t)counts * LSE_VALUE) /
+            ((uint64_t)pCalib->MeasureCycles * RCCEx_HSI_CALIB_CAPTURE_PERIODS);
+  hsifreq = (uint32_t)((timfreq * HSI_VALUE) / TimClock);
+
+  pCalib->HSIFrequency = hsifreq;
+  pCalib->HSIErrorPpm  = (int32_t)((((int64_t)hsifreq - (int64_t)HSI_VALUE) * 1000000) / (int64_t)HSI_VALUE);
+
+  return HAL_OK;
+}
+
+#if defined(CRS)
+/**
+  * @brief  Update the CRS USB auto-trim statistics and history on a SYNC warning or error.
+  * @note   On SYNC error (frequency error above 128 x FELIM) the hardware stops trimming,
+  *         the TRIM value is then corrected by software from the captured frequency error.
+  * @param  Event Combination of @ref RCCEx_CRS_Status values reported by the interrupt
+  * @retval None
+  */
+static void RCCEx_CRSAutoTrimUpdate(uint32_t Event)
+{
+  RCC_CRSAutoTrimTypeDef *ptrim = pCrsAutoTrim;
+  RCC_CRSTrimRecordTypeDef *precord;
+  uint32_t isr = READ_REG(CRS->ISR);
+  uint32_t fecap = (isr & CRS_ISR_FECAP) >> CRS_ISR_FECAP_Pos;
+  uint32_t fedir = isr & CRS_ISR_FEDIR;
+  uint32_t trim = READ_BIT(CRS->CR, CRS_CR_TRIM) >> CRS_CR_TRIM_Pos;
+  uint32_t steps;
+
+  if((Event & RCC_CRS_SYNCWARN) != 0U)
+  {
+    ptrim->SyncWarnCount++;
+  }
+  if((Event & RCC_CRS_SYNCMISS) != 0U)
+  {
+    ptrim->SyncMissCount++;
+  }
+  if((Event & RCC_CRS_TRIMOVF) != 0U)
+  {
+    ptrim->TrimOvfCount++;
+  }
+
+  /* Coarse correction only when the SOF is present, FECAP is meaningless otherwise */
+  if(((Event & RCC_CRS_SYNCERR) != 0U) && ((Event & RCC_CRS_SYNCMISS) == 0U))
+  {
+    ptrim->SyncErrCount++;
+
+    steps = fecap / RCCEx_CRS_COUNTS_PER_STEP(READ_BIT(CRS->CFGR, CRS_CFGR_RELOAD));
+    if(steps != 0U)
+    {
+      if(fedir == RCC_CRS_FREQERRORDIR_UP)
+      {
+        /* Actual frequency above the target */
+        trim = (trim > steps) ? (trim - steps) : 0U;
+      }
+      else
+      {
+        /* Actual frequency below the target */
+        trim = ((trim + steps) < (CRS_CR_TRIM_Msk >> CRS_CR_TRIM_Pos)) ?
+               (trim + steps) : (CRS_CR_TRIM_Msk >> CRS_CR_TRIM_Pos);
+      }
+
+      /* TRIM can only be written while the automatic trimming is disabled */
+      CLEAR_BIT(CRS->CR, CRS_CR_AUTOTRIMEN);
+      MODIFY_REG(CRS->CR, CRS_CR_TRIM, (trim << CRS_CR_TRIM_Pos));
+      SET_BIT(CRS->CR, CRS_CR_AUTOTRIMEN);
+
+      ptrim->CoarseTrimCount++;
+    }
+  }
+  else if((Event & RCC_CRS_SYNCERR) != 0U)
+  {
+    ptrim->SyncErrCount++;
+  }
+  else
+  {
+    /* nothing to do */
+  }
+
+  if(trim < ptrim->TrimMin)
+  {
+    ptrim->TrimMin = trim;
+  }
+  if(trim > ptrim->TrimMax)
+  {
+    ptrim->TrimMax = trim;
+  }
+
+  if(ptrim->pHistory != NULL)
+  {
+    precord = &ptrim->pHistory[ptrim->HistoryCount & (ptrim->HistorySize - 1U)];
+    precord->Tick                  = HAL_GetTick();
+    precord->HSI48CalibrationValue = trim;
+    precord->FreqErrorCapture      = fecap;
+    precord->FreqErrorDirection    = fedir;
+    precord->Event                 = Event;
+    ptrim->HistoryCount++;
+  }
+}
+#endif /* CRS */
+
 /**
   * @}
   */
@@ -216,6 +216,10 @@
 #define USART_BRR_MIN    0x10U        /*!< USART BRR minimum authorized value */
 
 #define USART_BRR_MAX    0x0000FFFFU  /*!< USART BRR maximum authorized value */
+
+#define SMARTCARD_T1_CHAR_ETU    11U   /*!< etu of a character included in the ISO/IEC 7816-3 wait times */
+
+#define SMARTCARD_T1_DMA_WAIT    16U   /*!< Loops waiting for the DMA to read the last character of a block */
 /**
   * @}
   */
@@ -249,6 +253,15 @@ static void SMARTCARD_TxISR_FIFOEN(SMARTCARD_HandleTypeDef *hsmartcard);
 static void SMARTCARD_EndTransmit_IT(SMARTCARD_HandleTypeDef *hsmartcard);
 static void SMARTCARD_RxISR(SMARTCARD_HandleTypeDef *hsmartcard);
 static void SMARTCARD_RxISR_FIFOEN(SMARTCARD_HandleTypeDef *hsmartcard);
+static void SMARTCARD_T1_IRQHandler(SMARTCARD_HandleTypeDef *hsmartcard);
+static HAL_StatusTypeDef SMARTCARD_T1_StartTransmit(SMARTCARD_HandleTypeDef *hsmartcard);
+static HAL_StatusTypeDef SMARTCARD_T1_StartReceive(SMARTCARD_HandleTypeDef *hsmartcard, uint32_t Offset,
+                                                   uint32_t Size);
+static void SMARTCARD_T1_Halt(SMARTCARD_HandleTypeDef *hsmartcard);
+static void SMARTCARD_T1_End(SMARTCARD_HandleTypeDef *hsmartcard);
+static void SMARTCARD_DMAT1TransmitCplt(DMA_HandleTypeDef *hdma);
+static void SMARTCARD_DMAT1ReceiveCplt(DMA_HandleTypeDef *hdma);
+static void SMARTCARD_DMAT1Error(DMA_HandleTypeDef *hdma);
 /**
   * @}
   */
@@ -330,6 +343,9 @@ HAL_StatusTypeDef HAL_SMARTCARD_Init(SMARTCARD_HandleTypeDef *hsmartcard)
     /* Allocate lock resource and initialize it */
     hsmartcard->Lock = HAL_UNLOCKED;
 
+    /* T=1 block engine not started */
+    hsmartcard->pT1 = NULL;
+
 #if USE_HAL_SMARTCARD_REGISTER_CALLBACKS == 1
     SMARTCARD_InitCallbacksToDefault(hsmartcard);
 
@@ -770,6 +786,15 @@ HAL_StatusTypeDef HAL_SMARTCARD_UnRegisterCallback(SMARTCARD_HandleTypeDef *hsma
         (##) HAL_SMARTCARD_AbortTransmit_IT()
         (##) HAL_SMARTCARD_AbortReceive_IT()
 
+    (#) T=1 block exchanges, timed by the USART receiver timeout and block length:
+        (##) HAL_SMARTCARD_T1_Start() and HAL_SMARTCARD_T1_Stop() hand the SMARTCARD over to
+             the block engine and back
+        (##) HAL_SMARTCARD_T1_Transceive_DMA() sends a block and receives the answer of the card,
+             the BGT, BWT and CWT being enforced without CPU timing
+        (##) HAL_SMARTCARD_T1_BuildBlock() builds an I-, R- or S-block with its LRC, an S(IFS request)
+             negotiating the IFSD and an S(WTX response) extending the next BWT
+        (##) HAL_SMARTCARD_T1_BlockCpltCallback() is called once the answer is received
+
     (#) For Abort services based on interrupts (HAL_SMARTCARD_Abortxxx_IT),
         a set of Abort Complete Callbacks are provided:
         (##) HAL_SMARTCARD_AbortCpltCallback()
@@ -1865,6 +1890,215 @@ HAL_StatusTypeDef HAL_SMARTCARD_AbortReceive_IT(SMARTCARD_HandleTypeDef *hsmartc
   return HAL_OK;
 }
 
+/**
+  * @brief  Start the T=1 block engine.
+  * @param  hsmartcard Pointer to a SMARTCARD_HandleTypeDef structure that contains
+  *                    the configuration information for the specified SMARTCARD module.
+  * @param  pT1 Pointer to the block engine context, its wait times and epilogue size being set.
+  * @note   The SMARTCARD is initialized in SMARTCARD_MODE_TX_RX mode with the NACK disabled, T=1
+  *         having no character repetition, and linked to a Tx and an Rx DMA channel.
+  * @note   Until HAL_SMARTCARD_T1_Stop(), the receiver timeout and the block length of the USART are
+  *         used by the engine, and the other transfer functions return HAL_BUSY.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SMARTCARD_T1_Start(SMARTCARD_HandleTypeDef *hsmartcard, SMARTCARD_T1TypeDef *pT1)
+{
+  if ((hsmartcard->gState != HAL_SMARTCARD_STATE_READY) || (hsmartcard->RxState != HAL_SMARTCARD_STATE_READY))
+  {
+    return HAL_BUSY;
+  }
+
+  if ((pT1 == NULL) || (hsmartcard->hdmatx == NULL) || (hsmartcard->hdmarx == NULL)
+      || (hsmartcard->Init.Mode != SMARTCARD_MODE_TX_RX)
+      || (hsmartcard->Init.NACKEnable != SMARTCARD_NACK_DISABLE)
+      || (pT1->CharWaitTime <= SMARTCARD_T1_CHAR_ETU) || (pT1->BlockWaitTime <= SMARTCARD_T1_CHAR_ETU)
+      || ((pT1->CharWaitTime - SMARTCARD_T1_CHAR_ETU) > USART_RTOR_RTO)
+      || ((pT1->BlockWaitTime - SMARTCARD_T1_CHAR_ETU) > USART_RTOR_RTO)
+      || ((pT1->EpilogueSize != SMARTCARD_T1_EPILOGUE_LRC) && (pT1->EpilogueSize != SMARTCARD_T1_EPILOGUE_CRC)))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Process Locked */
+  __HAL_LOCK(hsmartcard);
+
+  /* The handle is used by the engine until it is stopped */
+  hsmartcard->gState = HAL_SMARTCARD_STATE_BUSY;
+  hsmartcard->ErrorCode = HAL_SMARTCARD_ERROR_NONE;
+
+  pT1->RxCount      = 0U;
+  pT1->GuardPending = 0U;
+  pT1->Phase        = SMARTCARD_T1_PHASE_IDLE;
+  hsmartcard->pT1   = pT1;
+
+  /* The receiver timeout times the BGT, CWT and BWT */
+  __HAL_SMARTCARD_CLEAR_FLAG(hsmartcard, SMARTCARD_CLEAR_RTOF | SMARTCARD_CLEAR_EOBF);
+  SET_BIT(hsmartcard->Instance->CR2, USART_CR2_RTOEN);
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(hsmartcard);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop the T=1 block engine, aborting the ongoing exchange if any.
+  * @param  hsmartcard Pointer to a SMARTCARD_HandleTypeDef structure that contains
+  *                    the configuration information for the specified SMARTCARD module.
+  * @note   The receiver timeout and the block length configured at initialization are restored.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SMARTCARD_T1_Stop(SMARTCARD_HandleTypeDef *hsmartcard)
+{
+  uint32_t tmpreg;
+
+  if (hsmartcard->pT1 == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Process Locked */
+  __HAL_LOCK(hsmartcard);
+
+  SMARTCARD_T1_Halt(hsmartcard);
+  hsmartcard->pT1 = NULL;
+
+  /* Restore the RTOR configuration of SMARTCARD_SetConfig() */
+  tmpreg = ((uint32_t)hsmartcard->Init.BlockLength << USART_RTOR_BLEN_Pos);
+  if (hsmartcard->Init.TimeOutEnable == SMARTCARD_TIMEOUT_ENABLE)
+  {
+    tmpreg |= (uint32_t) hsmartcard->Init.TimeOutValue;
+  }
+  else
+  {
+    CLEAR_BIT(hsmartcard->Instance->CR2, USART_CR2_RTOEN);
+  }
+  MODIFY_REG(hsmartcard->Instance->RTOR, (USART_RTOR_RTO | USART_RTOR_BLEN), tmpreg);
+  __HAL_SMARTCARD_CLEAR_FLAG(hsmartcard, SMARTCARD_CLEAR_RTOF | SMARTCARD_CLEAR_EOBF);
+
+  hsmartcard->RxState = HAL_SMARTCARD_STATE_READY;
+  hsmartcard->gState  = HAL_SMARTCARD_STATE_READY;
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(hsmartcard);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Send a T=1 block and receive the block answered by the card, in DMA mode.
+  * @param  hsmartcard Pointer to a SMARTCARD_HandleTypeDef structure that contains
+  *                    the configuration information for the specified SMARTCARD module.
+  * @param  pTxBlock Pointer to the block sent, prologue and epilogue included.
+  * @param  TxSize Size of the block sent.
+  * @param  pRxBlock Pointer to the buffer of the block received.
+  * @param  RxSize Size of pRxBlock, 3 + IFSD + epilogue size for the largest block of the card.
+  * @note   The exchange is timed by the USART only:
+  *           - the block is sent after the BGT following the last block received
+  *           - the first character of the answer is expected within BWT, extended once by
+  *             WaitTimeExtension, and the following ones within CWT
+  *           - the LEN byte gives the block length, the end of block being flagged by the USART.
+  * @note   HAL_SMARTCARD_T1_BlockCpltCallback() is called once the block is received, the LRC being
+  *         checked, and HAL_SMARTCARD_ErrorCallback() on a timeout, a character or a block error.
+  *         The size of the block received is then in pT1->RxCount.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SMARTCARD_T1_Transceive_DMA(SMARTCARD_HandleTypeDef *hsmartcard, uint8_t *pTxBlock,
+                                                  uint16_t TxSize, uint8_t *pRxBlock, uint16_t RxSize)
+{
+  SMARTCARD_T1TypeDef *pt1 = hsmartcard->pT1;
+  HAL_StatusTypeDef status = HAL_OK;
+
+  if (pt1 == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  if (pt1->Phase != SMARTCARD_T1_PHASE_IDLE)
+  {
+    return HAL_BUSY;
+  }
+
+  if ((pTxBlock == NULL) || (TxSize < (3U + pt1->EpilogueSize))
+      || (pRxBlock == NULL) || (RxSize < (3U + pt1->EpilogueSize)))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Process Locked */
+  __HAL_LOCK(hsmartcard);
+
+  hsmartcard->ErrorCode   = HAL_SMARTCARD_ERROR_NONE;
+  hsmartcard->RxState     = HAL_SMARTCARD_STATE_BUSY_RX;
+  hsmartcard->pTxBuffPtr  = pTxBlock;
+  hsmartcard->TxXferSize  = TxSize;
+  hsmartcard->TxXferCount = TxSize;
+  hsmartcard->pRxBuffPtr  = pRxBlock;
+  hsmartcard->RxXferSize  = RxSize;
+  hsmartcard->RxXferCount = RxSize;
+  pt1->RxCount            = 0U;
+
+  if ((pt1->GuardPending != 0U) && (__HAL_SMARTCARD_GET_FLAG(hsmartcard, SMARTCARD_FLAG_RTOF) == 0U))
+  {
+    /* The block guard time is not elapsed: the block is sent on the receiver timeout */
+    pt1->Phase = SMARTCARD_T1_PHASE_GUARD;
+    SET_BIT(hsmartcard->Instance->CR1, USART_CR1_RTOIE);
+  }
+  else if (SMARTCARD_T1_StartTransmit(hsmartcard) != HAL_OK)
+  {
+    /* Set error code to DMA */
+    hsmartcard->ErrorCode = HAL_SMARTCARD_ERROR_DMA;
+    pt1->Phase = SMARTCARD_T1_PHASE_IDLE;
+    hsmartcard->RxState = HAL_SMARTCARD_STATE_READY;
+    status = HAL_ERROR;
+  }
+  else
+  {
+    /* Block being sent */
+  }
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(hsmartcard);
+
+  return status;
+}
+
+/**
+  * @brief  Build a T=1 block with an LRC epilogue.
+  * @param  pBlock Pointer to the block, Length + 4 bytes long.
+  * @param  Nad Node address byte.
+  * @param  Pcb Protocol control byte, a value of @ref SMARTCARD_T1_PCB for an S-block.
+  * @param  pInf Pointer to the information field, NULL when Length is 0.
+  * @param  Length Size of the information field, up to SMARTCARD_T1_INF_SIZE_MAX.
+  * @note   The IFS is negotiated by exchanging a block built with SMARTCARD_T1_PCB_IFS_REQUEST and
+  *         the IFSD as single information byte, the card answering SMARTCARD_T1_PCB_IFS_RESPONSE.
+  * @retval Size of the block, 0 on a parameter error
+  */
+uint32_t HAL_SMARTCARD_T1_BuildBlock(uint8_t *pBlock, uint8_t Nad, uint8_t Pcb, const uint8_t *pInf,
+                                     uint32_t Length)
+{
+  uint32_t index;
+  uint8_t lrc;
+
+  if ((pBlock == NULL) || (Length > SMARTCARD_T1_INF_SIZE_MAX) || ((pInf == NULL) && (Length != 0U)))
+  {
+    return 0U;
+  }
+
+  pBlock[0] = Nad;
+  pBlock[1] = Pcb;
+  pBlock[2] = (uint8_t)Length;
+  lrc = (uint8_t)(Nad ^ Pcb ^ (uint8_t)Length);
+  for (index = 0U; index < Length; index++)
+  {
+    pBlock[3U + index] = pInf[index];
+    lrc ^= pInf[index];
+  }
+  pBlock[3U + Length] = lrc;
+
+  return Length + 4U;
+}
+
 /**
   * @brief  Handle SMARTCARD interrupt requests.
   * @param  hsmartcard Pointer to a SMARTCARD_HandleTypeDef structure that contains
@@ -1879,6 +2113,13 @@ void HAL_SMARTCARD_IRQHandler(SMARTCARD_HandleTypeDef *hsmartcard)
   uint32_t errorflags;
   uint32_t errorcode;
 
+  /* T=1 block engine started */
+  if (hsmartcard->pT1 != NULL)
+  {
+    SMARTCARD_T1_IRQHandler(hsmartcard);
+    return;
+  }
+
   /* If no error occurs */
   errorflags = (isrflags & (uint32_t)(USART_ISR_PE | USART_ISR_FE | USART_ISR_ORE | USART_ISR_NE | USART_ISR_RTOF));
   if (errorflags == 0U)
@@ -2246,6 +2487,22 @@ __weak void HAL_SMARTCARD_AbortReceiveCpltCallback(SMARTCARD_HandleTypeDef *hsma
    */
 }
 
+/**
+  * @brief  T=1 block received callback.
+  * @param  hsmartcard Pointer to a SMARTCARD_HandleTypeDef structure that contains
+  *                    the configuration information for the specified SMARTCARD module.
+  * @retval None
+  */
+__weak void HAL_SMARTCARD_T1_BlockCpltCallback(SMARTCARD_HandleTypeDef *hsmartcard)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hsmartcard);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_SMARTCARD_T1_BlockCpltCallback can be implemented in the user file.
+   */
+}
+
 /**
   * @}
   */
@@ -3170,6 +3427,342 @@ static void SMARTCARD_RxISR_FIFOEN(SMARTCARD_HandleTypeDef *hsmartcard)
   }
 }
 
+/**
+  * @brief  Handle the SMARTCARD interrupts of the T=1 block engine.
+  * @param  hsmartcard Pointer to a SMARTCARD_HandleTypeDef structure that contains
+  *                    the configuration information for the specified SMARTCARD module.
+  * @retval None
+  */
+static void SMARTCARD_T1_IRQHandler(SMARTCARD_HandleTypeDef *hsmartcard)
+{
+  SMARTCARD_T1TypeDef *pt1 = hsmartcard->pT1;
+  uint32_t isrflags = READ_REG(hsmartcard->Instance->ISR);
+  uint32_t cr1its   = READ_REG(hsmartcard->Instance->CR1);
+  uint32_t cr3its   = READ_REG(hsmartcard->Instance->CR3);
+  uint32_t count    = 0U;
+  uint32_t index;
+  uint8_t lrc;
+
+  /* Character errors ----------------------------------------------------------*/
+  if (((isrflags & USART_ISR_PE) != 0U) && ((cr1its & USART_CR1_PEIE) != 0U))
+  {
+    __HAL_SMARTCARD_CLEAR_IT(hsmartcard, SMARTCARD_CLEAR_PEF);
+    hsmartcard->ErrorCode |= HAL_SMARTCARD_ERROR_PE;
+  }
+  if ((cr3its & USART_CR3_EIE) != 0U)
+  {
+    if ((isrflags & USART_ISR_FE) != 0U)
+    {
+      __HAL_SMARTCARD_CLEAR_IT(hsmartcard, SMARTCARD_CLEAR_FEF);
+      hsmartcard->ErrorCode |= HAL_SMARTCARD_ERROR_FE;
+    }
+    if ((isrflags & USART_ISR_NE) != 0U)
+    {
+      __HAL_SMARTCARD_CLEAR_IT(hsmartcard, SMARTCARD_CLEAR_NEF);
+      hsmartcard->ErrorCode |= HAL_SMARTCARD_ERROR_NE;
+    }
+    if ((isrflags & USART_ISR_ORE) != 0U)
+    {
+      __HAL_SMARTCARD_CLEAR_IT(hsmartcard, SMARTCARD_CLEAR_OREF);
+      hsmartcard->ErrorCode |= HAL_SMARTCARD_ERROR_ORE;
+    }
+  }
+
+  /* Receiver timeout: end of the BGT, or CWT/BWT elapsed ----------------------*/
+  if (((isrflags & USART_ISR_RTOF) != 0U) && ((cr1its & USART_CR1_RTOIE) != 0U))
+  {
+    __HAL_SMARTCARD_CLEAR_IT(hsmartcard, SMARTCARD_CLEAR_RTOF);
+    CLEAR_BIT(hsmartcard->Instance->CR1, USART_CR1_RTOIE);
+
+    if (pt1->Phase == SMARTCARD_T1_PHASE_GUARD)
+    {
+      if (SMARTCARD_T1_StartTransmit(hsmartcard) != HAL_OK)
+      {
+        hsmartcard->ErrorCode |= HAL_SMARTCARD_ERROR_DMA;
+      }
+    }
+    else
+    {
+      hsmartcard->ErrorCode |= HAL_SMARTCARD_ERROR_RTO;
+    }
+  }
+
+  if (hsmartcard->ErrorCode != HAL_SMARTCARD_ERROR_NONE)
+  {
+    SMARTCARD_T1_End(hsmartcard);
+    return;
+  }
+
+  /* Block sent, guard time of its last character included ---------------------*/
+  if (((isrflags & USART_ISR_TC) != 0U) && ((cr1its & USART_CR1_TCIE) != 0U))
+  {
+    CLEAR_BIT(hsmartcard->Instance->CR1, USART_CR1_TCIE);
+
+    /* Start the reception of the answer from a clean receiver */
+    __HAL_SMARTCARD_SEND_REQ(hsmartcard, SMARTCARD_RXDATA_FLUSH_REQUEST);
+    __HAL_SMARTCARD_CLEAR_FLAG(hsmartcard, SMARTCARD_CLEAR_TCF | SMARTCARD_CLEAR_PEF | SMARTCARD_CLEAR_FEF |
+                               SMARTCARD_CLEAR_NEF | SMARTCARD_CLEAR_OREF | SMARTCARD_CLEAR_RTOF |
+                               SMARTCARD_CLEAR_EOBF);
+
+    pt1->Phase = SMARTCARD_T1_PHASE_NAD;
+    if (SMARTCARD_T1_StartReceive(hsmartcard, 0U, 1U) != HAL_OK)
+    {
+      hsmartcard->ErrorCode |= HAL_SMARTCARD_ERROR_DMA;
+      SMARTCARD_T1_End(hsmartcard);
+      return;
+    }
+
+    /* Parity, frame, noise and overrun errors, then BWT */
+    SET_BIT(hsmartcard->Instance->CR1, USART_CR1_PEIE | USART_CR1_RTOIE);
+    SET_BIT(hsmartcard->Instance->CR3, USART_CR3_EIE);
+    return;
+  }
+
+  /* End of block --------------------------------------------------------------*/
+  if (((isrflags & USART_ISR_EOBF) != 0U) && ((cr1its & USART_CR1_EOBIE) != 0U))
+  {
+    __HAL_SMARTCARD_CLEAR_IT(hsmartcard, SMARTCARD_CLEAR_EOBF);
+
+    /* Let the DMA store the last character, read from RDR when EOBF was set */
+    while ((__HAL_DMA_GET_COUNTER(hsmartcard->hdmarx) != 0U) && (count < SMARTCARD_T1_DMA_WAIT))
+    {
+      count++;
+    }
+
+    pt1->RxCount = 3U + (uint32_t)hsmartcard->pRxBuffPtr[2] + pt1->EpilogueSize;
+    if (pt1->EpilogueSize == SMARTCARD_T1_EPILOGUE_LRC)
+    {
+      lrc = 0U;
+      for (index = 0U; index < pt1->RxCount; index++)
+      {
+        lrc ^= hsmartcard->pRxBuffPtr[index];
+      }
+      if (lrc != 0U)
+      {
+        hsmartcard->ErrorCode |= HAL_SMARTCARD_ERROR_BLOCK;
+      }
+    }
+
+    SMARTCARD_T1_End(hsmartcard);
+  }
+}
+
+/**
+  * @brief  Send the block of the T=1 exchange.
+  * @param  hsmartcard Pointer to a SMARTCARD_HandleTypeDef structure that contains
+  *                    the configuration information for the specified SMARTCARD module.
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef SMARTCARD_T1_StartTransmit(SMARTCARD_HandleTypeDef *hsmartcard)
+{
+  SMARTCARD_T1TypeDef *pt1 = hsmartcard->pT1;
+  uint32_t timeout = pt1->BlockWaitTime;
+
+  pt1->Phase = SMARTCARD_T1_PHASE_TX;
+  pt1->GuardPending = 0U;
+
+  /* BWT of the answer, extended once after an S(WTX response) */
+  if (pt1->WaitTimeExtension > 1U)
+  {
+    timeout *= pt1->WaitTimeExtension;
+  }
+  pt1->WaitTimeExtension = 0U;
+  timeout -= SMARTCARD_T1_CHAR_ETU;
+  if (timeout > USART_RTOR_RTO)
+  {
+    timeout = USART_RTOR_RTO;
+  }
+  MODIFY_REG(hsmartcard->Instance->RTOR, USART_RTOR_RTO, timeout);
+
+  hsmartcard->hdmatx->XferHalfCpltCallback = NULL;
+  hsmartcard->hdmatx->XferCpltCallback     = SMARTCARD_DMAT1TransmitCplt;
+  hsmartcard->hdmatx->XferErrorCallback    = SMARTCARD_DMAT1Error;
+  hsmartcard->hdmatx->XferAbortCallback    = NULL;
+
+  if (HAL_DMA_Start_IT(hsmartcard->hdmatx, (uint32_t)hsmartcard->pTxBuffPtr, (uint32_t)&hsmartcard->Instance->TDR,
+                       hsmartcard->TxXferSize) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Clear the TC flag in the ICR register */
+  CLEAR_BIT(hsmartcard->Instance->ICR, USART_ICR_TCCF);
+
+  /* Enable the DMA transfer for transmit request */
+  SET_BIT(hsmartcard->Instance->CR3, USART_CR3_DMAT);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Receive a part of the block of the T=1 exchange.
+  * @param  hsmartcard Pointer to a SMARTCARD_HandleTypeDef structure that contains
+  *                    the configuration information for the specified SMARTCARD module.
+  * @param  Offset Index of the first character received in the reception buffer.
+  * @param  Size Number of characters received.
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef SMARTCARD_T1_StartReceive(SMARTCARD_HandleTypeDef *hsmartcard, uint32_t Offset,
+                                                   uint32_t Size)
+{
+  hsmartcard->hdmarx->XferHalfCpltCallback = NULL;
+  hsmartcard->hdmarx->XferCpltCallback     = SMARTCARD_DMAT1ReceiveCplt;
+  hsmartcard->hdmarx->XferErrorCallback    = SMARTCARD_DMAT1Error;
+  hsmartcard->hdmarx->XferAbortCallback    = NULL;
+
+  if (HAL_DMA_Start_IT(hsmartcard->hdmarx, (uint32_t)&hsmartcard->Instance->RDR,
+                       (uint32_t)&hsmartcard->pRxBuffPtr[Offset], Size) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Enable the DMA transfer for the receiver request */
+  SET_BIT(hsmartcard->Instance->CR3, USART_CR3_DMAR);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop the DMA requests and the interrupts of the T=1 exchange.
+  * @param  hsmartcard Pointer to a SMARTCARD_HandleTypeDef structure that contains
+  *                    the configuration information for the specified SMARTCARD module.
+  * @retval None
+  */
+static void SMARTCARD_T1_Halt(SMARTCARD_HandleTypeDef *hsmartcard)
+{
+  CLEAR_BIT(hsmartcard->Instance->CR1, (USART_CR1_PEIE | USART_CR1_TCIE | USART_CR1_RTOIE | USART_CR1_EOBIE));
+  CLEAR_BIT(hsmartcard->Instance->CR3, (USART_CR3_DMAT | USART_CR3_DMAR | USART_CR3_EIE));
+
+  if (HAL_DMA_GetState(hsmartcard->hdmatx) == HAL_DMA_STATE_BUSY)
+  {
+    (void)HAL_DMA_Abort(hsmartcard->hdmatx);
+  }
+  if (HAL_DMA_GetState(hsmartcard->hdmarx) == HAL_DMA_STATE_BUSY)
+  {
+    (void)HAL_DMA_Abort(hsmartcard->hdmarx);
+  }
+
+  hsmartcard->pT1->Phase = SMARTCARD_T1_PHASE_IDLE;
+}
+
+/**
+  * @brief  End the T=1 exchange and call the user callback.
+  * @param  hsmartcard Pointer to a SMARTCARD_HandleTypeDef structure that contains
+  *                    the configuration information for the specified SMARTCARD module.
+  * @retval None
+  */
+static void SMARTCARD_T1_End(SMARTCARD_HandleTypeDef *hsmartcard)
+{
+  SMARTCARD_T1TypeDef *pt1 = hsmartcard->pT1;
+
+  SMARTCARD_T1_Halt(hsmartcard);
+
+  /* The next block is sent at least BGT after the last character received, the
+     receiver timeout being still running except when it already elapsed */
+  if ((hsmartcard->ErrorCode & HAL_SMARTCARD_ERROR_RTO) == 0U)
+  {
+    MODIFY_REG(hsmartcard->Instance->RTOR, USART_RTOR_RTO, SMARTCARD_T1_BGT - SMARTCARD_T1_CHAR_ETU);
+    pt1->GuardPending = 1U;
+  }
+
+  hsmartcard->RxState = HAL_SMARTCARD_STATE_READY;
+
+  if (hsmartcard->ErrorCode == HAL_SMARTCARD_ERROR_NONE)
+  {
+    HAL_SMARTCARD_T1_BlockCpltCallback(hsmartcard);
+  }
+  else
+  {
+#if (USE_HAL_SMARTCARD_REGISTER_CALLBACKS == 1)
+    /* Call registered user error callback */
+    hsmartcard->ErrorCallback(hsmartcard);
+#else
+    /* Call legacy weak user error callback */
+    HAL_SMARTCARD_ErrorCallback(hsmartcard);
+#endif /* USE_HAL_SMARTCARD_REGISTER_CALLBACK */
+  }
+}
+
+/**
+  * @brief  DMA SMARTCARD T=1 block sent callback.
+  * @param  hdma Pointer to a DMA_HandleTypeDef structure that contains
+  *              the configuration information for the specified DMA module.
+  * @retval None
+  */
+static void SMARTCARD_DMAT1TransmitCplt(DMA_HandleTypeDef *hdma)
+{
+  SMARTCARD_HandleTypeDef *hsmartcard = (SMARTCARD_HandleTypeDef *)(hdma->Parent);
+
+  /* Wait for the end of the last character, guard time included */
+  CLEAR_BIT(hsmartcard->Instance->CR3, USART_CR3_DMAT);
+  SET_BIT(hsmartcard->Instance->CR1, USART_CR1_TCIE);
+}
+
+/**
+  * @brief  DMA SMARTCARD T=1 block part received callback.
+  * @param  hdma Pointer to a DMA_HandleTypeDef structure that contains
+  *              the configuration information for the specified DMA module.
+  * @retval None
+  */
+static void SMARTCARD_DMAT1ReceiveCplt(DMA_HandleTypeDef *hdma)
+{
+  SMARTCARD_HandleTypeDef *hsmartcard = (SMARTCARD_HandleTypeDef *)(hdma->Parent);
+  SMARTCARD_T1TypeDef *pt1 = hsmartcard->pT1;
+  HAL_StatusTypeDef status = HAL_OK;
+  uint32_t length;
+
+  if (pt1->Phase == SMARTCARD_T1_PHASE_NAD)
+  {
+    /* From the first character on, the characters are spaced by at most CWT */
+    MODIFY_REG(hsmartcard->Instance->RTOR, USART_RTOR_RTO, pt1->CharWaitTime - SMARTCARD_T1_CHAR_ETU);
+    pt1->Phase = SMARTCARD_T1_PHASE_HEADER;
+    status = SMARTCARD_T1_StartReceive(hsmartcard, 1U, 2U);
+  }
+  else if (pt1->Phase == SMARTCARD_T1_PHASE_HEADER)
+  {
+    /* Information field and epilogue */
+    length = (uint32_t)hsmartcard->pRxBuffPtr[2] + pt1->EpilogueSize;
+    if (((length + 3U) > hsmartcard->RxXferSize) || ((length - 1U) > (USART_RTOR_BLEN >> USART_RTOR_BLEN_Pos)))
+    {
+      hsmartcard->ErrorCode |= HAL_SMARTCARD_ERROR_BLOCK;
+      SMARTCARD_T1_End(hsmartcard);
+      return;
+    }
+
+    /* The USART flags the end of block once BLEN + 4 characters are received */
+    MODIFY_REG(hsmartcard->Instance->RTOR, USART_RTOR_BLEN, ((length - 1U) << USART_RTOR_BLEN_Pos));
+    __HAL_SMARTCARD_CLEAR_IT(hsmartcard, SMARTCARD_CLEAR_EOBF);
+    SET_BIT(hsmartcard->Instance->CR1, USART_CR1_EOBIE);
+
+    pt1->Phase = SMARTCARD_T1_PHASE_BODY;
+    status = SMARTCARD_T1_StartReceive(hsmartcard, 3U, length);
+  }
+  else
+  {
+    /* The exchange ends on the end of block interrupt */
+  }
+
+  if (status != HAL_OK)
+  {
+    hsmartcard->ErrorCode |= HAL_SMARTCARD_ERROR_DMA;
+    SMARTCARD_T1_End(hsmartcard);
+  }
+}
+
+/**
+  * @brief  DMA SMARTCARD T=1 communication error callback.
+  * @param  hdma Pointer to a DMA_HandleTypeDef structure that contains
+  *              the configuration information for the specified DMA module.
+  * @retval None
+  */
+static void SMARTCARD_DMAT1Error(DMA_HandleTypeDef *hdma)
+{
+  SMARTCARD_HandleTypeDef *hsmartcard = (SMARTCARD_HandleTypeDef *)(hdma->Parent);
+
+  hsmartcard->ErrorCode |= HAL_SMARTCARD_ERROR_DMA;
+  SMARTCARD_T1_End(hsmartcard);
+}
+
 /**
   * @}
   */
@@ -50,6 +50,16 @@
       (+) Receive in master/host SMBUS mode an amount of data in non-blocking mode using @ref HAL_SMBUS_Master_Receive_IT()
       (++) At reception end of transfer @ref HAL_SMBUS_MasterRxCpltCallback() is executed and user can
            add his own code by customization of function pointer @ref HAL_SMBUS_MasterRxCpltCallback()
+      (+) Run in master/host SMBUS mode a list of read byte, read word or block read commands, possibly addressed
+          to several devices, in non-blocking mode using @ref HAL_SMBUS_Master_CmdList_IT()
+      (++) Each command is a write of the command code followed by a repeated START in read direction. When Packet
+           Error Check mode is enabled, the PEC byte is checked by hardware and a mismatch is reported in the
+           command Status field, the command list goes on with the next command.
+      (++) At the end of the last command @ref HAL_SMBUS_MasterCmdListCpltCallback() is executed and user can
+           add his own code by customization of function pointer @ref HAL_SMBUS_MasterCmdListCpltCallback()
+      (++) A command list can be registered with @ref HAL_SMBUS_ConfigAlertCmdList() to be run automatically
+           when an SMBus Alert is received while alert mode is enabled, instead of calling
+           @ref HAL_SMBUS_ErrorCallback(). An alert received during a command list is served at its end.
       (+) Abort a master/host SMBUS process communication with Interrupt using @ref HAL_SMBUS_Master_Abort_IT()
       (++) The associated previous transfer callback is called at the end of abort process
       (++) mean @ref HAL_SMBUS_MasterTxCpltCallback() in case of previous state was master transmit
@@ -210,6 +220,10 @@ static void SMBUS_Enable_IRQ(SMBUS_HandleTypeDef *hsmbus, uint32_t InterruptRequ
 static void SMBUS_Disable_IRQ(SMBUS_HandleTypeDef *hsmbus, uint32_t InterruptRequest);
 static HAL_StatusTypeDef SMBUS_Master_ISR(SMBUS_HandleTypeDef *hsmbus, uint32_t StatusFlags);
 static HAL_StatusTypeDef SMBUS_Slave_ISR(SMBUS_HandleTypeDef *hsmbus, uint32_t StatusFlags);
+static HAL_StatusTypeDef SMBUS_Master_CmdList_ISR(SMBUS_HandleTypeDef *hsmbus, uint32_t StatusFlags);
+static HAL_StatusTypeDef SMBUS_CmdListCheck(const SMBUS_CmdTypeDef *pCmdList, uint32_t NbCmd);
+static void SMBUS_CmdListStart(SMBUS_HandleTypeDef *hsmbus);
+static void SMBUS_CmdListCplt(SMBUS_HandleTypeDef *hsmbus);
 
 static void SMBUS_ConvertOtherXferOptions(SMBUS_HandleTypeDef *hsmbus);
 
@@ -1098,6 +1112,106 @@ HAL_StatusTypeDef HAL_SMBUS_Master_Receive_IT(SMBUS_HandleTypeDef *hsmbus, uint1
   }
 }
 
+/**
+  * @brief  Run a list of SMBUS read commands in master/host mode in non-blocking mode with Interrupt.
+  * @note   Each command writes its command code then reads, after a repeated START, one byte, one word or
+  *         a block (byte count then data) from its device. A NACK of the device address or a PEC error is
+  *         reported in the command Status field and the list goes on with the next command.
+  *         @ref HAL_SMBUS_MasterCmdListCpltCallback() is called at the end of the last command.
+  * @note   The PEC byte is requested and checked by hardware when Packet Error Check mode is enabled.
+  * @param  hsmbus Pointer to a SMBUS_HandleTypeDef structure that contains
+  *                the configuration information for the specified SMBUS.
+  * @param  pCmdList Pointer to the command list, it must remain valid until the end of the process
+  * @param  NbCmd Number of commands in the list
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SMBUS_Master_CmdList_IT(SMBUS_HandleTypeDef *hsmbus, SMBUS_CmdTypeDef *pCmdList,
+                                              uint32_t NbCmd)
+{
+  if (hsmbus->State == HAL_SMBUS_STATE_READY)
+  {
+    if (SMBUS_CmdListCheck(pCmdList, NbCmd) != HAL_OK)
+    {
+      hsmbus->ErrorCode = HAL_SMBUS_ERROR_INVALID_PARAM;
+      return HAL_ERROR;
+    }
+
+    /* Process Locked */
+    __HAL_LOCK(hsmbus);
+
+    hsmbus->State = HAL_SMBUS_STATE_MASTER_BUSY_CMD;
+    hsmbus->ErrorCode = HAL_SMBUS_ERROR_NONE;
+
+    /* Prepare command list parameters */
+    hsmbus->pCmdList = pCmdList;
+    hsmbus->CmdListSize = NbCmd;
+    hsmbus->CmdIndex = 0U;
+
+    for (uint32_t index = 0U; index < NbCmd; index++)
+    {
+      pCmdList[index].Status = SMBUS_CMD_STATUS_NOT_DONE;
+    }
+
+    /* Send first command */
+    SMBUS_CmdListStart(hsmbus);
+
+    /* Process Unlocked */
+    __HAL_UNLOCK(hsmbus);
+
+    /* Note : The SMBUS interrupts must be enabled after unlocking current process
+              to avoid the risk of SMBUS interrupt handle execution before current
+              process unlock */
+    SMBUS_Enable_IRQ(hsmbus, (SMBUS_IT_TX | SMBUS_IT_RX));
+
+    return HAL_OK;
+  }
+  else
+  {
+    return HAL_BUSY;
+  }
+}
+
+/**
+  * @brief  Register the command list run when an SMBus Alert is received.
+  * @note   Alert mode must be enabled with @ref HAL_SMBUS_EnableAlert_IT(). When an alert is received while
+  *         the driver is ready, the list is started from the error interrupt as with
+  *         @ref HAL_SMBUS_Master_CmdList_IT(). When an alert is received during a command list, the list is
+  *         started at its end. In other states, the alert is reported through @ref HAL_SMBUS_ErrorCallback().
+  * @param  hsmbus Pointer to a SMBUS_HandleTypeDef structure that contains
+  *                the configuration information for the specified SMBUS.
+  * @param  pCmdList Pointer to the command list, NULL to unregister it
+  * @param  NbCmd Number of commands in the list
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SMBUS_ConfigAlertCmdList(SMBUS_HandleTypeDef *hsmbus, SMBUS_CmdTypeDef *pCmdList,
+                                               uint32_t NbCmd)
+{
+  if (hsmbus->State == HAL_SMBUS_STATE_READY)
+  {
+    if ((pCmdList != NULL) && (SMBUS_CmdListCheck(pCmdList, NbCmd) != HAL_OK))
+    {
+      hsmbus->ErrorCode = HAL_SMBUS_ERROR_INVALID_PARAM;
+      return HAL_ERROR;
+    }
+
+    /* Process Locked */
+    __HAL_LOCK(hsmbus);
+
+    hsmbus->pAlertCmdList = pCmdList;
+    hsmbus->AlertCmdListSize = (pCmdList != NULL) ? NbCmd : 0U;
+    hsmbus->AlertPending = 0U;
+
+    /* Process Unlocked */
+    __HAL_UNLOCK(hsmbus);
+
+    return HAL_OK;
+  }
+  else
+  {
+    return HAL_BUSY;
+  }
+}
+
 /**
   * @brief  Abort a master/host SMBUS process communication with Interrupt.
   * @note   This abort can be called only if state is ready
@@ -1636,6 +1750,12 @@ void HAL_SMBUS_EV_IRQHandler(SMBUS_HandleTypeDef *hsmbus)
       (void)SMBUS_Slave_ISR(hsmbus, tmpisrvalue);
     }
   }
+
+  /* SMBUS in mode Master command list --------------------------------------------*/
+  if (hsmbus->State == HAL_SMBUS_STATE_MASTER_BUSY_CMD)
+  {
+    (void)SMBUS_Master_CmdList_ISR(hsmbus, tmpisrvalue);
+  }
 }
 
 /**
@@ -1681,6 +1801,22 @@ __weak void HAL_SMBUS_MasterRxCpltCallback(SMBUS_HandleTypeDef *hsmbus)
    */
 }
 
+/**
+  * @brief  Master command list completed callback.
+  * @param  hsmbus Pointer to a SMBUS_HandleTypeDef structure that contains
+  *                the configuration information for the specified SMBUS.
+  * @retval None
+  */
+__weak void HAL_SMBUS_MasterCmdListCpltCallback(SMBUS_HandleTypeDef *hsmbus)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hsmbus);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_SMBUS_MasterCmdListCpltCallback() could be implemented in the user file
+   */
+}
+
 /** @brief  Slave Tx Transfer completed callback.
   * @param  hsmbus Pointer to a SMBUS_HandleTypeDef structure that contains
   *                the configuration information for the specified SMBUS.
@@ -2104,6 +2240,241 @@ static HAL_StatusTypeDef SMBUS_Master_ISR(SMBUS_HandleTypeDef *hsmbus, uint32_t
 
   return HAL_OK;
 }
+/**
+  * @brief  Interrupt Sub-Routine which handle the Interrupt Flags Master command list Mode.
+  * @param  hsmbus Pointer to a SMBUS_HandleTypeDef structure that contains
+  *                the configuration information for the specified SMBUS.
+  * @param  StatusFlags Value of Interrupt Flags.
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef SMBUS_Master_CmdList_ISR(SMBUS_HandleTypeDef *hsmbus, uint32_t StatusFlags)
+{
+  SMBUS_CmdTypeDef *pcmd;
+  uint32_t nbbytes;
+  uint32_t pecmode;
+  uint8_t tmpdata;
+
+  /* Process Locked */
+  __HAL_LOCK(hsmbus);
+
+  pcmd = &hsmbus->pCmdList[hsmbus->CmdIndex];
+  pecmode = (hsmbus->Init.PacketErrorCheckMode == SMBUS_PEC_ENABLE) ? SMBUS_SENDPEC_MODE : 0UL;
+
+  if (SMBUS_CHECK_FLAG(StatusFlags, SMBUS_FLAG_AF) != RESET)
+  {
+    /* Clear NACK Flag */
+    __HAL_SMBUS_CLEAR_FLAG(hsmbus, SMBUS_FLAG_AF);
+
+    /* No need to generate STOP, it is automatically done */
+    /* Next command is sent at STOP detection */
+    pcmd->Status |= SMBUS_CMD_STATUS_NACK;
+  }
+  else if (SMBUS_CHECK_FLAG(StatusFlags, SMBUS_FLAG_RXNE) != RESET)
+  {
+    /* Read data from RXDR */
+    tmpdata = (uint8_t)(hsmbus->Instance->RXDR);
+
+    /* PEC byte is checked by hardware, it is not stored */
+    if ((SMBUS_GET_PEC_MODE(hsmbus) == 0UL) || (hsmbus->XferCount != 1U))
+    {
+      if (hsmbus->XferSize > 0U)
+      {
+        *hsmbus->pBuffPtr = tmpdata;
+
+        /* Increment Buffer pointer */
+        hsmbus->pBuffPtr++;
+        hsmbus->XferSize--;
+      }
+      else
+      {
+        /* Block larger than the buffer, remaining data are discarded */
+        pcmd->Status |= SMBUS_CMD_STATUS_SIZE;
+      }
+    }
+
+    if (hsmbus->XferCount > 0U)
+    {
+      hsmbus->XferCount--;
+    }
+  }
+  else if (SMBUS_CHECK_FLAG(StatusFlags, SMBUS_FLAG_TXIS) != RESET)
+  {
+    /* Write command code to TXDR */
+    hsmbus->Instance->TXDR = pcmd->Command;
+    hsmbus->XferCount = 0U;
+  }
+  else if (SMBUS_CHECK_FLAG(StatusFlags, SMBUS_FLAG_TCR) != RESET)
+  {
+    /* Block read byte count received, read the data and the PEC byte if any */
+    nbbytes = pcmd->pData[0];
+
+    if (nbbytes == 0U)
+    {
+      pcmd->Status |= SMBUS_CMD_STATUS_SIZE;
+    }
+
+    if (pecmode != 0UL)
+    {
+      nbbytes++;
+    }
+
+    /* A dummy byte ends a null block without PEC */
+    if (nbbytes == 0U)
+    {
+      nbbytes = 1U;
+    }
+    else if (nbbytes > MAX_NBYTE_SIZE)
+    {
+      nbbytes = MAX_NBYTE_SIZE;
+      pcmd->Status |= SMBUS_CMD_STATUS_SIZE;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+
+    hsmbus->XferCount = (uint16_t)nbbytes;
+    SMBUS_TransferConfig(hsmbus, pcmd->DevAddress, (uint8_t)nbbytes, (SMBUS_AUTOEND_MODE | pecmode),
+                         SMBUS_NO_STARTSTOP);
+  }
+  else if (SMBUS_CHECK_FLAG(StatusFlags, SMBUS_FLAG_TC) != RESET)
+  {
+    /* Command code sent, generate Restart in read direction */
+    if (pcmd->Protocol == SMBUS_CMD_BLOCK_READ)
+    {
+      /* Read the byte count first, the data size is programmed at TCR */
+      hsmbus->XferCount = 1U;
+      SMBUS_TransferConfig(hsmbus, pcmd->DevAddress, 1U, SMBUS_RELOAD_MODE, SMBUS_GENERATE_START_READ);
+    }
+    else
+    {
+      nbbytes = (uint32_t)pcmd->Protocol + ((pecmode != 0UL) ? 1UL : 0UL);
+      hsmbus->XferCount = (uint16_t)nbbytes;
+      SMBUS_TransferConfig(hsmbus, pcmd->DevAddress, (uint8_t)nbbytes, (SMBUS_AUTOEND_MODE | pecmode),
+                           SMBUS_GENERATE_START_READ);
+    }
+  }
+  else if (SMBUS_CHECK_FLAG(StatusFlags, SMBUS_FLAG_STOPF) != RESET)
+  {
+    /* PEC error may be not yet served by the error interrupt */
+    if (SMBUS_CHECK_FLAG(StatusFlags, SMBUS_FLAG_PECERR) != RESET)
+    {
+      pcmd->Status |= SMBUS_CMD_STATUS_PECERR;
+
+      /* Clear PEC error flag */
+      __HAL_SMBUS_CLEAR_FLAG(hsmbus, SMBUS_FLAG_PECERR);
+    }
+
+    /* Clear STOP Flag */
+    __HAL_SMBUS_CLEAR_FLAG(hsmbus, SMBUS_FLAG_STOPF);
+
+    /* Clear Configuration Register 2 */
+    SMBUS_RESET_CR2(hsmbus);
+
+    hsmbus->CmdIndex++;
+
+    if (hsmbus->CmdIndex < hsmbus->CmdListSize)
+    {
+      /* Send next command */
+      SMBUS_CmdListStart(hsmbus);
+    }
+    else
+    {
+      /* Process Unlocked inside */
+      SMBUS_CmdListCplt(hsmbus);
+
+      return HAL_OK;
+    }
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(hsmbus);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Check the parameters of a command list.
+  * @param  pCmdList Pointer to the command list
+  * @param  NbCmd Number of commands in the list
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef SMBUS_CmdListCheck(const SMBUS_CmdTypeDef *pCmdList, uint32_t NbCmd)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+
+  if ((pCmdList == NULL) || (NbCmd == 0U))
+  {
+    status = HAL_ERROR;
+  }
+  else
+  {
+    for (uint32_t index = 0U; index < NbCmd; index++)
+    {
+      if ((pCmdList[index].pData == NULL) || (IS_SMBUS_CMD_PROTOCOL(pCmdList[index].Protocol) == 0U) ||
+          (pCmdList[index].Size == 0U) || (pCmdList[index].Size < pCmdList[index].Protocol))
+      {
+        status = HAL_ERROR;
+      }
+    }
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Send the command code of the current command of the command list.
+  * @param  hsmbus Pointer to a SMBUS_HandleTypeDef structure that contains
+  *                the configuration information for the specified SMBUS.
+  * @retval None
+  */
+static void SMBUS_CmdListStart(SMBUS_HandleTypeDef *hsmbus)
+{
+  SMBUS_CmdTypeDef *pcmd = &hsmbus->pCmdList[hsmbus->CmdIndex];
+
+  pcmd->Status = SMBUS_CMD_STATUS_OK;
+
+  /* Prepare transfer parameters */
+  hsmbus->pBuffPtr = pcmd->pData;
+  hsmbus->XferSize = pcmd->Size;
+  hsmbus->XferCount = 1U;
+
+  /* Send Slave Address and command code, TC is set at the end for the Restart */
+  SMBUS_TransferConfig(hsmbus, pcmd->DevAddress, 1U, SMBUS_SOFTEND_MODE, SMBUS_GENERATE_START_WRITE);
+}
+
+/**
+  * @brief  End the command list and start the ALERT refresh list if requested.
+  * @note   The handle must be locked, it is unlocked by this function.
+  * @param  hsmbus Pointer to a SMBUS_HandleTypeDef structure that contains
+  *                the configuration information for the specified SMBUS.
+  * @retval None
+  */
+static void SMBUS_CmdListCplt(SMBUS_HandleTypeDef *hsmbus)
+{
+  /* Disable Interrupt */
+  SMBUS_Disable_IRQ(hsmbus, (SMBUS_IT_TX | SMBUS_IT_RX));
+
+  hsmbus->PreviousState = HAL_SMBUS_STATE_READY;
+  hsmbus->State = HAL_SMBUS_STATE_READY;
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(hsmbus);
+
+  /* Call the corresponding callback to inform upper layer of End of command list */
+  HAL_SMBUS_MasterCmdListCpltCallback(hsmbus);
+
+  /* Serve an ALERT received during the command list */
+  if ((hsmbus->AlertPending != 0U) && (hsmbus->State == HAL_SMBUS_STATE_READY))
+  {
+    hsmbus->AlertPending = 0U;
+    (void)HAL_SMBUS_Master_CmdList_IT(hsmbus, hsmbus->pAlertCmdList, hsmbus->AlertCmdListSize);
+  }
+}
 /**
   * @brief  Interrupt Sub-Routine which handle the Interrupt Flags Slave Mode.
   * @param  hsmbus Pointer to a SMBUS_HandleTypeDef structure that contains
@@ -2527,7 +2898,19 @@ static void SMBUS_ITErrorHandler(SMBUS_HandleTypeDef *hsmbus)
   /* SMBUS Alert error interrupt occurred -----------------------------------------------*/
   if (((itflags & SMBUS_FLAG_ALERT) == SMBUS_FLAG_ALERT) && ((itsources & SMBUS_IT_ERRI) == SMBUS_IT_ERRI))
   {
-    hsmbus->ErrorCode |= HAL_SMBUS_ERROR_ALERT;
+    /* Store current volatile hsmbus->State, misra rule */
+    tmpstate = hsmbus->State;
+
+    /* Request the ALERT refresh command list when registered */
+    if ((hsmbus->pAlertCmdList != NULL) &&
+        ((tmpstate == HAL_SMBUS_STATE_READY) || (tmpstate == HAL_SMBUS_STATE_MASTER_BUSY_CMD)))
+    {
+      hsmbus->AlertPending = 1U;
+    }
+    else
+    {
+      hsmbus->ErrorCode |= HAL_SMBUS_ERROR_ALERT;
+    }
 
     /* Clear ALERT flag */
     __HAL_SMBUS_CLEAR_FLAG(hsmbus, SMBUS_FLAG_ALERT);
@@ -2536,7 +2919,15 @@ static void SMBUS_ITErrorHandler(SMBUS_HandleTypeDef *hsmbus)
   /* SMBUS Packet Error Check error interrupt occurred ----------------------------------*/
   if (((itflags & SMBUS_FLAG_PECERR) == SMBUS_FLAG_PECERR) && ((itsources & SMBUS_IT_ERRI) == SMBUS_IT_ERRI))
   {
-    hsmbus->ErrorCode |= HAL_SMBUS_ERROR_PECERR;
+    /* During a command list, PEC error is reported on the current command */
+    if (hsmbus->State == HAL_SMBUS_STATE_MASTER_BUSY_CMD)
+    {
+      hsmbus->pCmdList[hsmbus->CmdIndex].Status |= SMBUS_CMD_STATUS_PECERR;
+    }
+    else
+    {
+      hsmbus->ErrorCode |= HAL_SMBUS_ERROR_PECERR;
+    }
 
     /* Clear PEC error flag */
     __HAL_SMBUS_CLEAR_FLAG(hsmbus, SMBUS_FLAG_PECERR);
@@ -2562,6 +2953,21 @@ static void SMBUS_ITErrorHandler(SMBUS_HandleTypeDef *hsmbus)
         hsmbus->PreviousState = HAL_SMBUS_STATE_READY;
         hsmbus->State = HAL_SMBUS_STATE_LISTEN;
       }
+      else if (tmpstate == HAL_SMBUS_STATE_MASTER_BUSY_CMD)
+      {
+        /* Abort the command list, remaining commands keep SMBUS_CMD_STATUS_NOT_DONE */
+        SMBUS_Disable_IRQ(hsmbus, (SMBUS_IT_TX | SMBUS_IT_RX));
+
+        /* Clear Configuration Register 2 */
+        SMBUS_RESET_CR2(hsmbus);
+
+        hsmbus->PreviousState = HAL_SMBUS_STATE_READY;
+        hsmbus->State = HAL_SMBUS_STATE_READY;
+      }
+      else
+      {
+        /* Nothing to do */
+      }
     }
 
     /* Call the Error callback to inform upper layer */
@@ -2571,6 +2977,13 @@ static void SMBUS_ITErrorHandler(SMBUS_HandleTypeDef *hsmbus)
     HAL_SMBUS_ErrorCallback(hsmbus);
 #endif /* USE_HAL_SMBUS_REGISTER_CALLBACKS */
   }
+
+  /* Start the ALERT refresh command list, if the driver is busy it is started at the end of the command list */
+  if ((hsmbus->AlertPending != 0U) && (hsmbus->State == HAL_SMBUS_STATE_READY))
+  {
+    hsmbus->AlertPending = 0U;
+    (void)HAL_SMBUS_Master_CmdList_IT(hsmbus, hsmbus->pAlertCmdList, hsmbus->AlertCmdListSize);
+  }
 }
 
 /**
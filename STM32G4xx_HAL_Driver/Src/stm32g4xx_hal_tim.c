@@ -315,6 +315,9 @@ HAL_StatusTypeDef HAL_TIM_Base_Init(TIM_HandleTypeDef *htim)
 
   /* Initialize the DMA burst operation state */
   htim->DMABurstState = HAL_DMA_BURST_STATE_READY;
+  htim->pCaptureRing = NULL;
+  htim->pEncoder = NULL;
+  htim->pPulseEncoder = NULL;
 
   /* Initialize the TIM channels state */
   TIM_CHANNEL_STATE_SET_ALL(htim, HAL_TIM_CHANNEL_STATE_READY);
@@ -696,6 +699,9 @@ HAL_StatusTypeDef HAL_TIM_OC_Init(TIM_HandleTypeDef *htim)
 
   /* Initialize the DMA burst operation state */
   htim->DMABurstState = HAL_DMA_BURST_STATE_READY;
+  htim->pCaptureRing = NULL;
+  htim->pEncoder = NULL;
+  htim->pPulseEncoder = NULL;
 
   /* Initialize the TIM channels state */
   TIM_CHANNEL_STATE_SET_ALL(htim, HAL_TIM_CHANNEL_STATE_READY);
@@ -1333,6 +1339,9 @@ HAL_StatusTypeDef HAL_TIM_PWM_Init(TIM_HandleTypeDef *htim)
 
   /* Initialize the DMA burst operation state */
   htim->DMABurstState = HAL_DMA_BURST_STATE_READY;
+  htim->pCaptureRing = NULL;
+  htim->pEncoder = NULL;
+  htim->pPulseEncoder = NULL;
 
   /* Initialize the TIM channels state */
   TIM_CHANNEL_STATE_SET_ALL(htim, HAL_TIM_CHANNEL_STATE_READY);
@@ -1968,6 +1977,9 @@ HAL_StatusTypeDef HAL_TIM_IC_Init(TIM_HandleTypeDef *htim)
 
   /* Initialize the DMA burst operation state */
   htim->DMABurstState = HAL_DMA_BURST_STATE_READY;
+  htim->pCaptureRing = NULL;
+  htim->pEncoder = NULL;
+  htim->pPulseEncoder = NULL;
 
   /* Initialize the TIM channels state */
   TIM_CHANNEL_STATE_SET_ALL(htim, HAL_TIM_CHANNEL_STATE_READY);
@@ -2593,6 +2605,9 @@ HAL_StatusTypeDef HAL_TIM_OnePulse_Init(TIM_HandleTypeDef *htim, uint32_t OnePul
 
   /* Initialize the DMA burst operation state */
   htim->DMABurstState = HAL_DMA_BURST_STATE_READY;
+  htim->pCaptureRing = NULL;
+  htim->pEncoder = NULL;
+  htim->pPulseEncoder = NULL;
 
   /* Initialize the TIM channels state */
   TIM_CHANNEL_STATE_SET(htim, TIM_CHANNEL_1, HAL_TIM_CHANNEL_STATE_READY);
@@ -3024,6 +3039,9 @@ HAL_StatusTypeDef HAL_TIM_Encoder_Init(TIM_HandleTypeDef *htim,  TIM_Encoder_Ini
 
   /* Initialize the DMA burst operation state */
   htim->DMABurstState = HAL_DMA_BURST_STATE_READY;
+  htim->pCaptureRing = NULL;
+  htim->pEncoder = NULL;
+  htim->pPulseEncoder = NULL;
 
   /* Set the TIM channels state */
   TIM_CHANNEL_STATE_SET(htim, TIM_CHANNEL_1, HAL_TIM_CHANNEL_STATE_READY);
@@ -3853,7 +3871,20 @@ void HAL_TIM_IRQHandler(TIM_HandleTypeDef *htim)
   {
     if (__HAL_TIM_GET_IT_SOURCE(htim, TIM_IT_UPDATE) != RESET)
     {
-      __HAL_TIM_CLEAR_IT(htim, TIM_IT_UPDATE);
+      if (htim->pCaptureRing != NULL)
+      {
+        /* The overflow count of the capture ring is updated with the flag clear */
+        TIMEx_CaptureRingPeriodElapsed(htim);
+      }
+      else if (htim->pEncoder != NULL)
+      {
+        /* The overflow count of the encoder service is updated with the flag clear */
+        TIMEx_EncoderPeriodElapsed(htim);
+      }
+      else
+      {
+        __HAL_TIM_CLEAR_IT(htim, TIM_IT_UPDATE);
+      }
 #if (USE_HAL_TIM_REGISTER_CALLBACKS == 1)
       htim->PeriodElapsedCallback(htim);
 #else
@@ -3919,6 +3950,10 @@ void HAL_TIM_IRQHandler(TIM_HandleTypeDef *htim)
     if (__HAL_TIM_GET_IT_SOURCE(htim, TIM_IT_IDX) != RESET)
     {
       __HAL_TIM_CLEAR_IT(htim, TIM_FLAG_IDX);
+      if (htim->pEncoder != NULL)
+      {
+        TIMEx_EncoderIndexEvent(htim);
+      }
 #if (USE_HAL_TIM_REGISTER_CALLBACKS == 1)
       htim->EncoderIndexCallback(htim);
 #else
@@ -66,6 +66,8 @@
            (++) Complementary PWM generation : HAL_TIMEx_PWMN_Start(), HAL_TIMEx_PWMN_Start_DMA(), HAL_TIMEx_PWMN_Start_IT()
            (++) Complementary One-pulse mode output : HAL_TIMEx_OnePulseN_Start(), HAL_TIMEx_OnePulseN_Start_IT()
            (++) Hall Sensor output : HAL_TIMEx_HallSensor_Start(), HAL_TIMEx_HallSensor_Start_DMA(), HAL_TIMEx_HallSensor_Start_IT().
+           (++) Input capture timestamping : HAL_TIMEx_CaptureRing_Start_DMA().
+           (++) Pulse protocol output : HAL_TIMEx_PulseEncoder_Transmit_DMA().
 
   @endverbatim
   ******************************************************************************
@@ -115,6 +117,13 @@
 static void TIM_DMADelayPulseNCplt(DMA_HandleTypeDef *hdma);
 static void TIM_DMAErrorCCxN(DMA_HandleTypeDef *hdma);
 static void TIM_CCxNChannelCmd(TIM_TypeDef *TIMx, uint32_t Channel, uint32_t ChannelNState);
+static void TIMEx_DMACaptureRingEvent(DMA_HandleTypeDef *hdma);
+static void TIMEx_CaptureRingExtend(TIM_HandleTypeDef *htim);
+static void TIMEx_DMAPulseEncoderHalfCplt(DMA_HandleTypeDef *hdma);
+static void TIMEx_DMAPulseEncoderCplt(DMA_HandleTypeDef *hdma);
+static void TIMEx_PulseEncoderEvent(TIM_HandleTypeDef *htim, uint32_t Offset);
+static uint32_t TIMEx_PulseEncoderFill(TIM_PulseEncoderTypeDef *pEncoder, uint32_t *pHalf);
+static void TIMEx_PulseEncoderStop(TIM_HandleTypeDef *htim);
 
 /* Exported functions --------------------------------------------------------*/
 /** @defgroup TIMEx_Exported_Functions TIM Extended Exported Functions
@@ -234,6 +243,9 @@ HAL_StatusTypeDef HAL_TIMEx_HallSensor_Init(TIM_HandleTypeDef *htim, TIM_HallSen
 
   /* Initialize the DMA burst operation state */
   htim->DMABurstState = HAL_DMA_BURST_STATE_READY;
+  htim->pCaptureRing = NULL;
+  htim->pEncoder = NULL;
+  htim->pPulseEncoder = NULL;
 
   /* Initialize the TIM channels state */
   TIM_CHANNEL_STATE_SET(htim, TIM_CHANNEL_1, HAL_TIM_CHANNEL_STATE_READY);
@@ -3409,6 +3421,1009 @@ HAL_TIM_ChannelStateTypeDef HAL_TIMEx_GetChannelNState(TIM_HandleTypeDef *htim,
 
   return channel_state;
 }
+/**
+  * @}
+  */
+
+/** @defgroup TIMEx_Exported_Functions_Group8 Extended Capture Ring functions
+  * @brief    Extended Capture Ring functions
+  *
+@verbatim
+  ==============================================================================
+                ##### Extended Capture Ring functions #####
+  ==============================================================================
+  [..]
+    This section provides functions allowing to timestamp the edges of an input
+    capture channel over an unlimited time:
+    (+) HAL_TIMEx_CaptureRing_Start_DMA() streams the captures of a channel to a
+        ring buffer in circular DMA mode. The 16-bit or 32-bit captures are extended
+        to 64-bit timestamps with the count of the counter overflows.
+    (+) HAL_TIMEx_CaptureRing_GetData() and HAL_TIMEx_CaptureRing_Release() give
+        access to the timestamps, oldest first, without copy.
+    (+) HAL_TIMEx_CaptureRing_GetStatistics() computes the period, frequency and
+        duty cycle over the last edges of the ring, only when called.
+    (+) HAL_TIMEx_CaptureRing_Stop_DMA() stops the capture.
+
+  [..] How to use the capture ring:
+    (#) Initialize the timer in up-counting mode with HAL_TIM_IC_Init() and
+        configure the channel with HAL_TIM_IC_ConfigChannel(). Select the
+        TIM_INPUTCHANNELPOLARITY_BOTHEDGE polarity to measure the duty cycle.
+    (#) Link a DMA channel in circular mode to the capture compare DMA request
+        of the channel.
+    (#) Enable the timer update interrupt in the NVIC and call HAL_TIM_IRQHandler()
+        from it: the overflows are counted in this interrupt, which must be served
+        within one counter period. HAL_TIM_PeriodElapsedCallback() is still
+        called on each overflow.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Start the timestamping of an input capture channel in a ring buffer.
+  * @note   The DMA handle of the channel must be configured in circular mode. The
+  *         DMA fills pData continuously and the captures are extended to 64-bit
+  *         timestamps on each counter overflow, on the DMA half transfer and transfer
+  *         complete events, and on HAL_TIMEx_CaptureRing_Update(). A timestamp is
+  *         the number of counter ticks since the timer was started.
+  * @note   Only overflows may set the update flag during the capture: the update
+  *         request source is restricted to the counter overflow by this function,
+  *         and neither the auto-reload value nor the counter may be modified, nor a
+  *         slave reset mode used.
+  * @note   When the channel captures both edges, the first captured edge is taken
+  *         as a rising edge for the duty cycle computation: start the capture while
+  *         the input is low.
+  * @note   A reader that falls behind by more than Size captures loses the oldest
+  *         timestamps and Overrun is incremented.
+  * @param  htim TIM Input Capture handle
+  * @param  Channel TIM Channel to be enabled
+  *          This parameter can be one of the following values:
+  *            @arg TIM_CHANNEL_1: TIM Channel 1 selected
+  *            @arg TIM_CHANNEL_2: TIM Channel 2 selected
+  *            @arg TIM_CHANNEL_3: TIM Channel 3 selected
+  *            @arg TIM_CHANNEL_4: TIM Channel 4 selected
+  * @param  pRing Pointer to the ring descriptor, owned by the application.
+  * @param  pData Pointer to the raw capture storage, written by the DMA.
+  * @param  pTimestamp Pointer to the timestamp storage, Size elements.
+  * @param  Size Size of the ring storage, must be a power of two.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_TIMEx_CaptureRing_Start_DMA(TIM_HandleTypeDef *htim, uint32_t Channel,
+                                                  TIM_CaptureRingTypeDef *pRing, uint32_t *pData,
+                                                  uint64_t *pTimestamp, uint16_t Size)
+{
+  uint32_t tmpsmcr;
+  uint32_t dmaid;
+  HAL_TIM_ChannelStateTypeDef channel_state = TIM_CHANNEL_STATE_GET(htim, Channel);
+  HAL_TIM_ChannelStateTypeDef complementary_channel_state = TIM_CHANNEL_N_STATE_GET(htim, Channel);
+
+  /* Check the parameters */
+  assert_param(IS_TIM_CCX_INSTANCE(htim->Instance, Channel));
+  assert_param(IS_TIM_DMA_CC_INSTANCE(htim->Instance));
+
+  if ((channel_state == HAL_TIM_CHANNEL_STATE_BUSY)
+      || (complementary_channel_state == HAL_TIM_CHANNEL_STATE_BUSY))
+  {
+    return HAL_BUSY;
+  }
+  else if ((channel_state != HAL_TIM_CHANNEL_STATE_READY)
+           || (complementary_channel_state != HAL_TIM_CHANNEL_STATE_READY)
+           || (htim->pCaptureRing != NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  if ((pRing == NULL) || (pData == NULL) || (pTimestamp == NULL) || (Size == 0U) || ((Size & (Size - 1U)) != 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Capture channels 1 to 4 use the DMA handles CC1 to CC4 */
+  dmaid = TIM_DMA_ID_CC1 + (Channel >> 2U);
+
+  /* The ring relies on the DMA wrapping around by itself */
+  if ((htim->hdma[dmaid] == NULL) || (htim->hdma[dmaid]->Init.Mode != DMA_CIRCULAR))
+  {
+    return HAL_ERROR;
+  }
+
+  /* The overflow count only extends an up-counting counter */
+  if ((htim->Instance->CR1 & (TIM_CR1_DIR | TIM_CR1_CMS)) != 0U)
+  {
+    return HAL_ERROR;
+  }
+
+  pRing->pBuffer     = pData;
+  pRing->pTimestamp  = pTimestamp;
+  pRing->Mask        = (uint32_t)Size - 1U;
+  pRing->Head        = 0U;
+  pRing->Tail        = 0U;
+  pRing->Overrun     = 0U;
+  pRing->Filled      = 0U;
+  pRing->Channel     = Channel;
+  pRing->AutoReload  = __HAL_TIM_GET_AUTORELOAD(htim);
+  pRing->Epoch       = 0U;
+  pRing->LastEpoch   = 0U;
+  pRing->LastCapture = 0U;
+
+  TIM_CHANNEL_STATE_SET(htim, Channel, HAL_TIM_CHANNEL_STATE_BUSY);
+  TIM_CHANNEL_N_STATE_SET(htim, Channel, HAL_TIM_CHANNEL_STATE_BUSY);
+
+  /* Half transfer and transfer complete both only extend the new captures */
+  htim->hdma[dmaid]->XferCpltCallback = TIMEx_DMACaptureRingEvent;
+  htim->hdma[dmaid]->XferHalfCpltCallback = TIMEx_DMACaptureRingEvent;
+
+  /* Set the DMA error callback */
+  htim->hdma[dmaid]->XferErrorCallback = TIM_DMAError ;
+
+  /* Enable the DMA channel, CCR1 to CCR4 are contiguous */
+  if (HAL_DMA_Start_IT(htim->hdma[dmaid], (uint32_t)&htim->Instance->CCR1 + Channel, (uint32_t)pData, Size) != HAL_OK)
+  {
+    TIM_CHANNEL_STATE_SET(htim, Channel, HAL_TIM_CHANNEL_STATE_READY);
+    TIM_CHANNEL_N_STATE_SET(htim, Channel, HAL_TIM_CHANNEL_STATE_READY);
+    return HAL_ERROR;
+  }
+
+  htim->pCaptureRing = pRing;
+
+  /* Only counter overflows set the update flag, an overflow before the start is not counted */
+  __HAL_TIM_URS_ENABLE(htim);
+  __HAL_TIM_CLEAR_FLAG(htim, TIM_FLAG_UPDATE);
+  __HAL_TIM_ENABLE_IT(htim, TIM_IT_UPDATE);
+
+  /* Enable the TIM Capture/Compare DMA request of the channel */
+  __HAL_TIM_ENABLE_DMA(htim, (TIM_DMA_CC1 << (Channel >> 2U)));
+
+  /* Enable the Input Capture channel */
+  TIM_CCxChannelCmd(htim->Instance, Channel, TIM_CCx_ENABLE);
+
+  /* Enable the Peripheral, except in trigger mode where enable is automatically done with trigger */
+  if (IS_TIM_SLAVE_INSTANCE(htim->Instance))
+  {
+    tmpsmcr = htim->Instance->SMCR & TIM_SMCR_SMS;
+    if (!IS_TIM_SLAVEMODE_TRIGGER_ENABLED(tmpsmcr))
+    {
+      __HAL_TIM_ENABLE(htim);
+    }
+  }
+  else
+  {
+    __HAL_TIM_ENABLE(htim);
+  }
+
+  /* Return function status */
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop the timestamping started with HAL_TIMEx_CaptureRing_Start_DMA().
+  * @note   The captures received before the stop are extended, the timestamps
+  *         remain readable from the ring.
+  * @param  htim TIM Input Capture handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_TIMEx_CaptureRing_Stop_DMA(TIM_HandleTypeDef *htim)
+{
+  TIM_CaptureRingTypeDef *pRing = htim->pCaptureRing;
+  uint32_t primask_bit;
+  uint32_t channel;
+
+  if (pRing == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  channel = pRing->Channel;
+
+  /* Disable the capture and the TIM Capture/Compare DMA request of the channel */
+  TIM_CCxChannelCmd(htim->Instance, channel, TIM_CCx_DISABLE);
+  __HAL_TIM_DISABLE_DMA(htim, (TIM_DMA_CC1 << (channel >> 2U)));
+
+  /* Extend the last captures while the DMA counter is still valid */
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  TIMEx_CaptureRingExtend(htim);
+  __HAL_TIM_DISABLE_IT(htim, TIM_IT_UPDATE);
+  htim->pCaptureRing = NULL;
+
+  __set_PRIMASK(primask_bit);
+
+  (void)HAL_DMA_Abort_IT(htim->hdma[TIM_DMA_ID_CC1 + (channel >> 2U)]);
+
+  /* Disable the Peripheral */
+  __HAL_TIM_DISABLE(htim);
+
+  /* Set the TIM channel state */
+  TIM_CHANNEL_STATE_SET(htim, channel, HAL_TIM_CHANNEL_STATE_READY);
+  TIM_CHANNEL_N_STATE_SET(htim, channel, HAL_TIM_CHANNEL_STATE_READY);
+
+  /* Return function status */
+  return HAL_OK;
+}
+
+/**
+  * @brief  Extend the captures received since the last update to timestamps.
+  * @note   To be called by a reader polling the ring between the DMA half transfer
+  *         events, before HAL_TIMEx_CaptureRing_GetData().
+  * @param  htim TIM Input Capture handle
+  * @retval None
+  */
+void HAL_TIMEx_CaptureRing_Update(TIM_HandleTypeDef *htim)
+{
+  uint32_t primask_bit;
+
+  /* The update can be entered concurrently from the TIM IRQ, the DMA IRQ and
+     the reader: keep the overflow count and the captures consistent */
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  if (htim->pCaptureRing != NULL)
+  {
+    TIMEx_CaptureRingExtend(htim);
+  }
+
+  __set_PRIMASK(primask_bit);
+}
+
+/**
+  * @brief  Get direct access to the oldest timestamps waiting in the ring.
+  * @note   Only the contiguous part up to the end of the storage is returned: when
+  *         the waiting timestamps wrap around, a second call after
+  *         HAL_TIMEx_CaptureRing_Release() returns the remainder.
+  * @param  pRing  Pointer to the ring descriptor.
+  * @param  ppTimestamp Filled with a pointer to the oldest waiting timestamp.
+  * @retval Number of contiguous timestamps readable at *ppTimestamp
+  */
+uint32_t HAL_TIMEx_CaptureRing_GetData(TIM_CaptureRingTypeDef *pRing, uint64_t **ppTimestamp)
+{
+  uint32_t head = pRing->Head;
+  uint32_t tail = pRing->Tail;
+  uint32_t size = pRing->Mask + 1U;
+  uint32_t count;
+
+  /* The writer overtook the reader: skip the overwritten timestamps */
+  if ((head - tail) > size)
+  {
+    tail = head - size;
+    pRing->Tail = tail;
+  }
+
+  count = head - tail;
+  if (count > (size - (tail & pRing->Mask)))
+  {
+    count = size - (tail & pRing->Mask);
+  }
+
+  *ppTimestamp = &pRing->pTimestamp[tail & pRing->Mask];
+  return count;
+}
+
+/**
+  * @brief  Hand timestamps obtained with HAL_TIMEx_CaptureRing_GetData() back to the driver.
+  * @param  pRing Pointer to the ring descriptor.
+  * @param  Count Number of timestamps consumed by the reader.
+  * @retval None
+  */
+void HAL_TIMEx_CaptureRing_Release(TIM_CaptureRingTypeDef *pRing, uint32_t Count)
+{
+  pRing->Tail += Count;
+}
+
+/**
+  * @brief  Compute the period statistics over the last edges of the ring.
+  * @note   Nothing is computed in the background: the new captures are extended
+  *         and the window is walked on each call. The timestamps are not consumed.
+  * @note   When the channel captures both edges, a period is measured between two
+  *         rising edges and the duty cycle is computed too, the window then spans
+  *         2 x WindowCount + 1 edges.
+  * @param  htim TIM Input Capture handle
+  * @param  WindowCount Number of periods of the window, the edges of the window must
+  *         fit in half of the ring.
+  * @param  CounterClock Counter clock frequency in Hz, used for the frequency only.
+  * @param  pStats Filled with the statistics of the window.
+  * @retval HAL status, HAL_ERROR while fewer edges than the window were captured
+  */
+HAL_StatusTypeDef HAL_TIMEx_CaptureRing_GetStatistics(TIM_HandleTypeDef *htim, uint32_t WindowCount,
+                                                      uint32_t CounterClock, TIM_CaptureStatsTypeDef *pStats)
+{
+  TIM_CaptureRingTypeDef *pRing = htim->pCaptureRing;
+  const uint32_t bothedges = TIM_CCER_CC1P | TIM_CCER_CC1NP;
+  uint32_t step;
+  uint32_t index;
+  uint32_t count;
+  uint64_t start;
+  uint64_t period;
+  uint64_t total;
+  uint64_t high = 0U;
+
+  if ((pRing == NULL) || (pStats == NULL) || (WindowCount == 0U) || (WindowCount > ((pRing->Mask + 1U) / 2U)))
+  {
+    return HAL_ERROR;
+  }
+
+  step = (((htim->Instance->CCER >> pRing->Channel) & bothedges) == bothedges) ? 2U : 1U;
+
+  HAL_TIMEx_CaptureRing_Update(htim);
+
+  /* The window must fit in half of the ring so that it is not overwritten while walked */
+  if ((((WindowCount * step) + 1U) > ((pRing->Mask + 1U) / 2U)) || (pRing->Filled < ((WindowCount * step) + 1U)))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Index of the last edge of the window, a rising edge in both edges mode */
+  index = pRing->Head - 1U;
+  if (step == 2U)
+  {
+    index &= ~1U;
+  }
+  index -= WindowCount * step;
+
+  pStats->MinPeriod = 0xFFFFFFFFFFFFFFFFU;
+  pStats->MaxPeriod = 0U;
+  start = pRing->pTimestamp[index & pRing->Mask];
+
+  for (count = 0U; count < WindowCount; count++)
+  {
+    period = pRing->pTimestamp[(index + step) & pRing->Mask] - pRing->pTimestamp[index & pRing->Mask];
+    if (period < pStats->MinPeriod)
+    {
+      pStats->MinPeriod = period;
+    }
+    if (period > pStats->MaxPeriod)
+    {
+      pStats->MaxPeriod = period;
+    }
+    if (step == 2U)
+    {
+      high += pRing->pTimestamp[(index + 1U) & pRing->Mask] - pRing->pTimestamp[index & pRing->Mask];
+    }
+    index += step;
+  }
+
+  total = pRing->pTimestamp[index & pRing->Mask] - start;
+  if (total == 0U)
+  {
+    return HAL_ERROR;
+  }
+
+  pStats->Count      = WindowCount;
+  pStats->MeanPeriod = total / WindowCount;
+  pStats->Frequency  = ((uint64_t)CounterClock * 1000U * WindowCount) / total;
+  pStats->Duty       = (uint32_t)((high * 10000U) / total);
+
+  return HAL_OK;
+}
+
+/**
+  * @}
+  */
+
+#if defined(HAL_COMP_MODULE_ENABLED) && defined(HAL_DAC_MODULE_ENABLED)
+/** @defgroup TIMEx_Exported_Functions_Group9 Extended Peak Current Control functions
+  * @brief    Extended Peak Current Control functions
+  *
+@verbatim
+  ==============================================================================
+                ##### Extended Peak Current Control functions #####
+  ==============================================================================
+  [..]
+    This section provides functions allowing to build a peak current mode control
+    loop running in hardware only, once configured:
+    (+) The DAC generates the peak current reference on an internal output. With
+        slope compensation, the sawtooth generator restarts at the peak value on
+        each PWM period and decrements at each step trigger.
+    (+) The comparator compares the current sense input to the DAC reference.
+    (+) The comparator output clears the OCREF of the PWM channel when the peak
+        current is reached, cycle by cycle.
+    (+) Optionally, a comparator output (the same or another one with a higher
+        threshold) disables the timer outputs through a break input.
+    (+) HAL_TIMEx_PeakCurrent_SetPeak() updates the reference from the outer loop.
+
+  [..] How to use the peak current control:
+    (#) Initialize the timer with HAL_TIM_PWM_Init(), configure the PWM channel with
+        OCREF clear enabled by HAL_TIM_PWM_ConfigChannel(), and the break with
+        HAL_TIMEx_ConfigBreakDeadTime() when the protection is used.
+    (#) Initialize the DAC with HAL_DAC_Init(), and set the comparator instance and
+        its Init parameters except InputMinus.
+    (#) Call HAL_TIMEx_PeakCurrent_Config(), then start the PWM with HAL_TIM_PWM_Start().
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Configure a hardware peak current mode control loop.
+  * @note   The DAC channel is configured and started, the comparator initialized
+  *         and started, then the timer OCREF clear and break inputs are connected
+  *         to the comparator outputs. No interrupt is used by the control loop.
+  * @param  htim TIM handle, initialized in PWM mode
+  * @param  sConfig pointer to a TIMEx_PeakCurrentConfigTypeDef structure that
+  *         contains the comparator, DAC and timer connections.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_TIMEx_PeakCurrent_Config(TIM_HandleTypeDef *htim, const TIMEx_PeakCurrentConfigTypeDef *sConfig)
+{
+  DAC_ChannelConfTypeDef sDacConfig = {0};
+  TIM_ClearInputConfigTypeDef sClearInputConfig = {0};
+  TIMEx_BreakInputConfigTypeDef sBreakInputConfig = {0};
+
+  /* Check the parameters */
+  assert_param(IS_TIM_OCXREF_CLEAR_INSTANCE(htim->Instance));
+  assert_param(IS_DAC_RESET_DATA(sConfig->PeakValue));
+  assert_param(IS_DAC_STEP_DATA(sConfig->SlopeStep));
+
+  if ((sConfig->hcomp == NULL) || (sConfig->hdac == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  /* DAC reference connected internally to the comparator, without output buffer */
+  sDacConfig.DAC_HighFrequency = DAC_HIGH_FREQUENCY_INTERFACE_MODE_AUTOMATIC;
+  sDacConfig.DAC_DMADoubleDataMode = DISABLE;
+  sDacConfig.DAC_SignedFormat = DISABLE;
+  sDacConfig.DAC_SampleAndHold = DAC_SAMPLEANDHOLD_DISABLE;
+  sDacConfig.DAC_OutputBuffer = DAC_OUTPUTBUFFER_DISABLE;
+  sDacConfig.DAC_ConnectOnChipPeripheral = DAC_CHIPCONNECT_INTERNAL;
+  sDacConfig.DAC_UserTrimming = DAC_TRIMMING_FACTORY;
+  if (sConfig->SlopeStep != 0U)
+  {
+    /* Sawtooth reset on the PWM period start, decrement on the step trigger */
+    sDacConfig.DAC_Trigger = sConfig->SlopeResetTrigger;
+    sDacConfig.DAC_Trigger2 = sConfig->SlopeStepTrigger;
+  }
+  else
+  {
+    sDacConfig.DAC_Trigger = DAC_TRIGGER_NONE;
+    sDacConfig.DAC_Trigger2 = DAC_TRIGGER_NONE;
+  }
+  if (HAL_DAC_ConfigChannel(sConfig->hdac, &sDacConfig, sConfig->DacChannel) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  if (HAL_TIMEx_PeakCurrent_SetPeak(sConfig, sConfig->PeakValue) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  if (HAL_DAC_Start(sConfig->hdac, sConfig->DacChannel) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Comparator between the current sense input and the DAC reference */
+  sConfig->hcomp->Init.InputMinus = sConfig->CompInputMinus;
+  if (HAL_COMP_Init(sConfig->hcomp) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  if (HAL_COMP_Start(sConfig->hcomp) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Cycle by cycle current limitation: the comparator output clears the OCREF */
+  sClearInputConfig.ClearInputState = (uint32_t)ENABLE;
+  sClearInputConfig.ClearInputSource = sConfig->ClearInputSource;
+  sClearInputConfig.ClearInputPolarity = TIM_CLEARINPUTPOLARITY_NONINVERTED;
+  sClearInputConfig.ClearInputPrescaler = TIM_CLEARINPUTPRESCALER_DIV1;
+  sClearInputConfig.ClearInputFilter = 0U;
+  if (HAL_TIM_ConfigOCrefClear(htim, &sClearInputConfig, sConfig->Channel) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Over-current protection: the comparator output disables the timer outputs */
+  if (sConfig->BreakInput != 0U)
+  {
+    sBreakInputConfig.Source = sConfig->BreakInputSource;
+    sBreakInputConfig.Enable = TIM_BREAKINPUTSOURCE_ENABLE;
+    sBreakInputConfig.Polarity = TIM_BREAKINPUTSOURCE_POLARITY_HIGH;
+    if (HAL_TIMEx_ConfigBreakInput(htim, sConfig->BreakInput, &sBreakInputConfig) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Update the peak current reference of a peak current control loop.
+  * @note   With slope compensation, the new value is taken into account by the
+  *         DAC at the next slope reset trigger.
+  * @param  sConfig pointer to the TIMEx_PeakCurrentConfigTypeDef structure given
+  *         to HAL_TIMEx_PeakCurrent_Config().
+  * @param  PeakValue Peak current reference, from 0 to 4095.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_TIMEx_PeakCurrent_SetPeak(const TIMEx_PeakCurrentConfigTypeDef *sConfig, uint32_t PeakValue)
+{
+  if (sConfig->SlopeStep != 0U)
+  {
+    return HAL_DACEx_SawtoothWaveGenerate(sConfig->hdac, sConfig->DacChannel, DAC_SAWTOOTH_POLARITY_DECREMENT,
+                                          PeakValue, sConfig->SlopeStep);
+  }
+  else
+  {
+    return HAL_DAC_SetValue(sConfig->hdac, sConfig->DacChannel, DAC_ALIGN_12B_R, PeakValue);
+  }
+}
+
+/**
+  * @}
+  */
+#endif /* HAL_COMP_MODULE_ENABLED && HAL_DAC_MODULE_ENABLED */
+
+/** @defgroup TIMEx_Exported_Functions_Group10 Extended Encoder Service functions
+  * @brief    Extended Encoder Service functions
+  *
+@verbatim
+  ==============================================================================
+                ##### Extended Encoder Service functions #####
+  ==============================================================================
+  [..]
+    This section provides functions allowing to read a quadrature encoder as a
+    64-bit position and a velocity:
+    (+) The counter overflows and underflows are counted in the update interrupt,
+        the index events in the index interrupt. Nothing else is done in interrupt.
+    (+) HAL_TIMEx_EncoderService_GetSnapshot() computes the position and the
+        velocity when it is called. It does not mask the interrupts: the values
+        are read again when an interrupt updated the service meanwhile.
+    (+) The velocity combines the M and T methods: the counts moved since the
+        previous window are divided by the time between the last captured encoder
+        edges, measured by a second, free-running timer. Without a new edge, the
+        velocity decays with the time elapsed since the last edge, and is zero
+        after StandstillTime.
+
+  [..] How to use the encoder service:
+    (#) Initialize the encoder with HAL_TIM_Encoder_Init(). When it counts one
+        revolution, the auto-reload value + 1 must be the count per revolution.
+    (#) Optionally configure the index with HAL_TIMEx_ConfigEncoderIndex() and
+        enable the index interrupt with __HAL_TIM_ENABLE_IT(htim, TIM_IT_IDX).
+        With FirstIndexEnable, the counter is only reset on the first index.
+    (#) For the T method, start an input capture channel of a 32-bit timer (TIM2 or
+        TIM5) running at PeriodClock, fed with the edges of the A signal (or the
+        XOR of A and B for the best resolution), with HAL_TIM_IC_Start().
+    (#) Enable the timer update and index interrupts in the NVIC and call
+        HAL_TIM_IRQHandler() from them. The update interrupt must be served
+        within half a counter period.
+    (#) Fill the configuration fields of a TIM_EncoderServiceTypeDef and call
+        HAL_TIMEx_EncoderService_Start(), then HAL_TIMEx_EncoderService_GetSnapshot()
+        from a single context, at least once per PeriodTimer period.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Start the encoder and its position and velocity service.
+  * @note   The update request source is restricted to the counter overflow and
+  *         underflow, and the update interrupt flag is remapped on bit 31 of the
+  *         counter, so that both are read atomically: the auto-reload value must
+  *         be lower than 0x80000000.
+  * @param  htim TIM Encoder Interface handle
+  * @param  pService Pointer to the service structure, owned by the application.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_TIMEx_EncoderService_Start(TIM_HandleTypeDef *htim, TIM_EncoderServiceTypeDef *pService)
+{
+  uint32_t autoreload = __HAL_TIM_GET_AUTORELOAD(htim);
+
+  /* Check the parameters */
+  assert_param(IS_TIM_ENCODER_INTERFACE_INSTANCE(htim->Instance));
+
+  if ((pService == NULL) || (htim->pEncoder != NULL) || (htim->pCaptureRing != NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  if ((autoreload == 0U) || (autoreload >= TIM_CNT_UIFCPY) ||
+      (((htim->Instance->SMCR & TIM_SMCR_SMS) == 0U) || ((htim->Instance->SMCR & TIM_SMCR_SMS) == TIM_SMCR_SMS_2)))
+  {
+    return HAL_ERROR;
+  }
+
+  if ((pService->PeriodTimer != NULL) &&
+      ((pService->PeriodClock == 0U) || (pService->PeriodChannel > TIM_CHANNEL_4) ||
+       (!IS_TIM_CCX_INSTANCE(pService->PeriodTimer, pService->PeriodChannel))))
+  {
+    return HAL_ERROR;
+  }
+
+  if (pService->PeriodTimer == NULL)
+  {
+    /* Enable the DWT cycle counter if not already done by a debugger */
+    if ((DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk) == 0U)
+    {
+      CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+      DWT->CYCCNT = 0U;
+      DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    }
+    pService->LastEdgeTime = DWT->CYCCNT;
+  }
+  else
+  {
+    pService->LastEdgeTime = (&pService->PeriodTimer->CCR1)[pService->PeriodChannel >> 2U];
+  }
+
+  pService->AutoReload   = autoreload;
+  pService->Sequence     = 0U;
+  pService->Epoch        = 0;
+  pService->IndexCount   = 0U;
+  pService->Homed        = 0U;
+  pService->LastHomed    = 0U;
+  pService->LastPosition = (int64_t)(uint32_t)(htim->Instance->CNT & ~TIM_CNT_UIFCPY);
+  pService->LastVelocity = 0;
+
+  /* Only overflows and underflows set the update flag, which is copied to the counter bit 31 */
+  __HAL_TIM_URS_ENABLE(htim);
+  __HAL_TIM_UIFREMAP_ENABLE(htim);
+  __HAL_TIM_CLEAR_FLAG(htim, TIM_FLAG_UPDATE);
+
+  htim->pEncoder = pService;
+  __HAL_TIM_ENABLE_IT(htim, TIM_IT_UPDATE);
+
+  if (HAL_TIM_Encoder_Start(htim, TIM_CHANNEL_ALL) != HAL_OK)
+  {
+    __HAL_TIM_DISABLE_IT(htim, TIM_IT_UPDATE);
+    htim->pEncoder = NULL;
+    return HAL_ERROR;
+  }
+
+  /* Return function status */
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop the encoder service started with HAL_TIMEx_EncoderService_Start().
+  * @note   The period timer is left running.
+  * @param  htim TIM Encoder Interface handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_TIMEx_EncoderService_Stop(TIM_HandleTypeDef *htim)
+{
+  if (htim->pEncoder == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  __HAL_TIM_DISABLE_IT(htim, TIM_IT_UPDATE);
+  __HAL_TIM_UIFREMAP_DISABLE(htim);
+  htim->pEncoder = NULL;
+
+  return HAL_TIM_Encoder_Stop(htim, TIM_CHANNEL_ALL);
+}
+
+/**
+  * @brief  Compute the position and the velocity of the encoder.
+  * @note   The counter, the overflow count and the last edge capture are read
+  *         until no interrupt updated the service and no edge was captured during
+  *         the read. A pending overflow, not yet counted by the interrupt, is
+  *         taken into account from the counter bit 31.
+  * @note   The velocity window is only moved when a new edge was captured and the
+  *         position changed. The velocity is limited to CountsPerEdge over the
+  *         time since the last edge, and is zero after StandstillTime. It is
+  *         computed with 64-bit integers: the counts moved in one window must stay
+  *         below 50 millions.
+  * @note   This function updates the velocity window of the service: it must be
+  *         called from a single context.
+  * @param  htim TIM Encoder Interface handle
+  * @param  pSnapshot Pointer to the snapshot filled by the function.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_TIMEx_EncoderService_GetSnapshot(TIM_HandleTypeDef *htim,
+                                                       TIM_EncoderSnapshotTypeDef *pSnapshot)
+{
+  TIM_EncoderServiceTypeDef *pService = htim->pEncoder;
+  const __IO uint32_t *pcapture;
+  uint32_t sequence;
+  uint32_t counter;
+  uint32_t value;
+  uint32_t edge;
+  uint32_t now;
+  uint32_t clock;
+  uint32_t since;
+  int64_t epoch;
+  int64_t position;
+  int64_t moved;
+  int64_t bound;
+  int64_t velocity;
+
+  if ((pService == NULL) || (pSnapshot == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  if (pService->PeriodTimer != NULL)
+  {
+    pcapture = &(&pService->PeriodTimer->CCR1)[pService->PeriodChannel >> 2U];
+    clock = pService->PeriodClock;
+  }
+  else
+  {
+    pcapture = &DWT->CYCCNT;
+    clock = SystemCoreClock;
+  }
+
+  /* Lock-free read: retry when an interrupt updated the service or an edge was captured */
+  do
+  {
+    sequence = pService->Sequence;
+    edge = *pcapture;
+    counter = htim->Instance->CNT;
+    epoch = pService->Epoch;
+    pSnapshot->IndexCount = pService->IndexCount;
+    pSnapshot->Homed = pService->Homed;
+    now = (pService->PeriodTimer != NULL) ? pService->PeriodTimer->CNT : *pcapture;
+  } while ((sequence != pService->Sequence) || ((pService->PeriodTimer != NULL) && (edge != *pcapture)));
+
+  /* Overflow or underflow pending, the counter is near 0 after an overflow */
+  value = counter & ~TIM_CNT_UIFCPY;
+  if ((counter & TIM_CNT_UIFCPY) != 0U)
+  {
+    epoch += (value <= (pService->AutoReload / 2U)) ? 1 : -1;
+  }
+
+  position = (epoch * ((int64_t)pService->AutoReload + 1)) + (int64_t)value;
+
+  if (pSnapshot->Homed != pService->LastHomed)
+  {
+    /* The position was reset by the index: restart the velocity window */
+    pService->LastHomed = pSnapshot->Homed;
+    pService->LastPosition = position;
+    pService->LastEdgeTime = edge;
+    velocity = pService->LastVelocity;
+  }
+  else
+  {
+    moved = position - pService->LastPosition;
+    if ((moved != 0) && (edge != pService->LastEdgeTime))
+    {
+      /* M/T method: counts moved over the time between the window edges */
+      velocity = (moved * (int64_t)clock * 1000) / (int64_t)(uint32_t)(edge - pService->LastEdgeTime);
+      pService->LastPosition = position;
+      pService->LastEdgeTime = edge;
+    }
+    else
+    {
+      since = now - pService->LastEdgeTime;
+      if (since >= pService->StandstillTime)
+      {
+        velocity = 0;
+      }
+      else
+      {
+        /* No new edge: the velocity cannot exceed one edge over the time since the last one */
+        bound = ((int64_t)pService->CountsPerEdge * (int64_t)clock * 1000) / (int64_t)((since != 0U) ? since : 1U);
+        velocity = pService->LastVelocity;
+        if (velocity > bound)
+        {
+          velocity = bound;
+        }
+        else if (velocity < -bound)
+        {
+          velocity = -bound;
+        }
+        else
+        {
+          /* Nothing to do */
+        }
+      }
+    }
+  }
+  pService->LastVelocity = velocity;
+
+  pSnapshot->Position = position;
+  pSnapshot->Velocity = velocity;
+  pSnapshot->Direction = __HAL_TIM_IS_TIM_COUNTING_DOWN(htim) ? 1U : 0U;
+
+  return HAL_OK;
+}
+
+/** @defgroup TIMEx_Exported_Functions_Group11 Extended Pulse Encoder functions
+  * @brief    Extended Pulse Encoder functions
+  *
+@verbatim
+  ==============================================================================
+                ##### Extended Pulse Encoder functions #####
+  ==============================================================================
+  [..]
+    This section provides functions allowing to send a pulse width protocol
+    (WS2812 LED strips, DShot ESC frames) on a PWM channel, one PWM period per bit:
+    (+) The payload bytes are expanded to compare values in a small ping-pong
+        buffer, from the DMA half transfer and transfer complete callbacks, instead
+        of a compare value per bit for the whole frame.
+    (+) A buffer of 2 x 24 periods (one RGB LED per half) is enough for a WS2812 strip
+        of any length, when the DMA interrupts are served within 24 bit periods (30 us).
+
+  [..] How to use the pulse encoder:
+    (#) Initialize the timer with HAL_TIM_PWM_Init(), the period being the bit
+        period (1.25 us for WS2812), and configure the channel with
+        HAL_TIM_PWM_ConfigChannel() with the compare preload enabled.
+    (#) Link a DMA channel in circular mode, memory to peripheral, with word memory
+        data alignment, to the CC DMA handle of the channel.
+    (#) Fill pBuffer, BufferSize, ZeroCompare, OneCompare and ResetSlots (the
+        latch time of the protocol, in bit periods) of a TIM_PulseEncoderTypeDef.
+    (#) Call HAL_TIMEx_PulseEncoder_Transmit_DMA(). The payload must remain valid
+        until HAL_TIMEx_PulseEncoder_TxCpltCallback() is called. The output is then
+        left low, the channel ready for the next frame.
+    (#) HAL_TIMEx_PulseEncoder_Abort() stops a frame, the channel and the counter.
+
+    -@- Protocols changing the period of each pulse (servo PPM) need the period
+        reloaded with the compare value, with a DMA burst: they are not supported.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Send a frame of payload bits on a PWM channel.
+  * @param  htim TIM PWM handle
+  * @param  Channel TIM Channel to be used.
+  *          This parameter can be one of the following values:
+  *            @arg TIM_CHANNEL_1: TIM Channel 1 selected
+  *            @arg TIM_CHANNEL_2: TIM Channel 2 selected
+  *            @arg TIM_CHANNEL_3: TIM Channel 3 selected
+  *            @arg TIM_CHANNEL_4: TIM Channel 4 selected
+  * @param  pEncoder Pointer to the pulse encoder, owned by the application.
+  * @param  pData Pointer to the payload, sent most significant bit first.
+  * @param  Size Payload size in bytes.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_TIMEx_PulseEncoder_Transmit_DMA(TIM_HandleTypeDef *htim, uint32_t Channel,
+                                                      TIM_PulseEncoderTypeDef *pEncoder,
+                                                      const uint8_t *pData, uint32_t Size)
+{
+  uint32_t tmpsmcr;
+  uint32_t dmaid;
+  uint32_t half;
+
+  /* Check the parameters */
+  assert_param(IS_TIM_CCX_INSTANCE(htim->Instance, Channel));
+  assert_param(IS_TIM_DMA_CC_INSTANCE(htim->Instance));
+
+  if (TIM_CHANNEL_STATE_GET(htim, Channel) == HAL_TIM_CHANNEL_STATE_BUSY)
+  {
+    return HAL_BUSY;
+  }
+  else if ((TIM_CHANNEL_STATE_GET(htim, Channel) != HAL_TIM_CHANNEL_STATE_READY) || (htim->pPulseEncoder != NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  if ((pEncoder == NULL) || (pEncoder->pBuffer == NULL) || (pEncoder->BufferSize < 4U) ||
+      ((pEncoder->BufferSize & 1U) != 0U) || (pEncoder->ResetSlots < 2U) ||
+      (pData == NULL) || (Size == 0U) || (Size > (0xFFFFFFFFU / 8U)) || (Channel > TIM_CHANNEL_4))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Compare channels 1 to 4 use the DMA handles CC1 to CC4 */
+  dmaid = TIM_DMA_ID_CC1 + (Channel >> 2U);
+
+  /* The buffer halves are refilled while the DMA wraps around by itself */
+  if ((htim->hdma[dmaid] == NULL) || (htim->hdma[dmaid]->Init.Mode != DMA_CIRCULAR))
+  {
+    return HAL_ERROR;
+  }
+
+  pEncoder->Channel   = Channel;
+  pEncoder->pData     = pData;
+  pEncoder->BitCount  = Size * 8U;
+  pEncoder->BitIndex  = 0U;
+  pEncoder->ResetLeft = pEncoder->ResetSlots;
+  pEncoder->Pending   = 0U;
+
+  /* Expand the start of the frame in both halves */
+  half = pEncoder->BufferSize / 2U;
+  pEncoder->Pending += TIMEx_PulseEncoderFill(pEncoder, &pEncoder->pBuffer[0]);
+  pEncoder->Pending += TIMEx_PulseEncoderFill(pEncoder, &pEncoder->pBuffer[half]);
+
+  TIM_CHANNEL_STATE_SET(htim, Channel, HAL_TIM_CHANNEL_STATE_BUSY);
+
+  htim->hdma[dmaid]->XferCpltCallback = TIMEx_DMAPulseEncoderCplt;
+  htim->hdma[dmaid]->XferHalfCpltCallback = TIMEx_DMAPulseEncoderHalfCplt;
+
+  /* Set the DMA error callback */
+  htim->hdma[dmaid]->XferErrorCallback = TIM_DMAError ;
+
+  htim->pPulseEncoder = pEncoder;
+
+  /* The first period, before the first DMA request, is a reset period */
+  *(__IO uint32_t *)((uint32_t)&htim->Instance->CCR1 + Channel) = 0U;
+
+  /* Enable the DMA channel, CCR1 to CCR4 are contiguous */
+  if (HAL_DMA_Start_IT(htim->hdma[dmaid], (uint32_t)pEncoder->pBuffer, (uint32_t)&htim->Instance->CCR1 + Channel,
+                       (uint16_t)pEncoder->BufferSize) != HAL_OK)
+  {
+    htim->pPulseEncoder = NULL;
+    TIM_CHANNEL_STATE_SET(htim, Channel, HAL_TIM_CHANNEL_STATE_READY);
+    return HAL_ERROR;
+  }
+
+  /* Enable the TIM Capture/Compare DMA request of the channel */
+  __HAL_TIM_ENABLE_DMA(htim, (TIM_DMA_CC1 << (Channel >> 2U)));
+
+  /* Enable the Capture compare channel */
+  TIM_CCxChannelCmd(htim->Instance, Channel, TIM_CCx_ENABLE);
+
+  if (IS_TIM_BREAK_INSTANCE(htim->Instance) != RESET)
+  {
+    /* Enable the main output */
+    __HAL_TIM_MOE_ENABLE(htim);
+  }
+
+  /* Enable the Peripheral, except in trigger mode where enable is automatically done with trigger */
+  if (IS_TIM_SLAVE_INSTANCE(htim->Instance))
+  {
+    tmpsmcr = htim->Instance->SMCR & TIM_SMCR_SMS;
+    if (!IS_TIM_SLAVEMODE_TRIGGER_ENABLED(tmpsmcr))
+    {
+      __HAL_TIM_ENABLE(htim);
+    }
+  }
+  else
+  {
+    __HAL_TIM_ENABLE(htim);
+  }
+
+  /* Return function status */
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop the frame sent by HAL_TIMEx_PulseEncoder_Transmit_DMA().
+  * @note   The channel output and the counter are disabled, the completion
+  *         callback is not called. To be called after a DMA error as well.
+  * @param  htim TIM PWM handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_TIMEx_PulseEncoder_Abort(TIM_HandleTypeDef *htim)
+{
+  TIM_PulseEncoderTypeDef *pEncoder = htim->pPulseEncoder;
+
+  if (pEncoder == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  TIMEx_PulseEncoderStop(htim);
+
+  /* Disable the Capture compare channel */
+  TIM_CCxChannelCmd(htim->Instance, pEncoder->Channel, TIM_CCx_DISABLE);
+
+  if (IS_TIM_BREAK_INSTANCE(htim->Instance) != RESET)
+  {
+    /* Disable the Main Output */
+    __HAL_TIM_MOE_DISABLE(htim);
+  }
+
+  /* Disable the Peripheral */
+  __HAL_TIM_DISABLE(htim);
+
+  /* Return function status */
+  return HAL_OK;
+}
+
+/**
+  * @brief  Pulse encoder frame sent callback.
+  * @param  htim TIM PWM handle
+  * @retval None
+  */
+__weak void HAL_TIMEx_PulseEncoder_TxCpltCallback(TIM_HandleTypeDef *htim)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(htim);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_TIMEx_PulseEncoder_TxCpltCallback could be implemented in the user file
+   */
+}
+
 /**
   * @}
   */
@@ -3461,6 +4476,174 @@ void TIMEx_DMACommutationHalfCplt(DMA_HandleTypeDef *hdma)
 }
 
 
+/**
+  * @brief  Count a counter overflow of the capture ring time base.
+  * @note   Called from HAL_TIM_IRQHandler() instead of clearing the update flag.
+  *         The captures received before the overflow are first extended with the
+  *         previous overflow count.
+  * @param  htim TIM handle.
+  * @retval None
+  */
+void TIMEx_CaptureRingPeriodElapsed(TIM_HandleTypeDef *htim)
+{
+  uint32_t primask_bit;
+
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  TIMEx_CaptureRingExtend(htim);
+  htim->pCaptureRing->Epoch++;
+  __HAL_TIM_CLEAR_FLAG(htim, TIM_FLAG_UPDATE);
+
+  __set_PRIMASK(primask_bit);
+}
+
+/**
+  * @brief  Count a counter overflow or underflow of the encoder service.
+  * @note   Called from HAL_TIM_IRQHandler() instead of clearing the update flag.
+  *         The counter is near 0 after an overflow and near the auto-reload value
+  *         after an underflow.
+  * @param  htim TIM handle.
+  * @retval None
+  */
+void TIMEx_EncoderPeriodElapsed(TIM_HandleTypeDef *htim)
+{
+  TIM_EncoderServiceTypeDef *pService = htim->pEncoder;
+  uint32_t value;
+  uint32_t primask_bit;
+
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  value = htim->Instance->CNT & ~TIM_CNT_UIFCPY;
+  if (value <= (pService->AutoReload / 2U))
+  {
+    pService->Epoch++;
+  }
+  else
+  {
+    pService->Epoch--;
+  }
+  __HAL_TIM_CLEAR_FLAG(htim, TIM_FLAG_UPDATE);
+  pService->Sequence++;
+
+  __set_PRIMASK(primask_bit);
+}
+
+/**
+  * @brief  Count an index event of the encoder service.
+  * @note   On the first index with HomeOnIndex, the counter was just reset by the
+  *         index: the overflow count and a pending overflow are cleared, so that
+  *         the position restarts from the counter value.
+  * @param  htim TIM handle.
+  * @retval None
+  */
+void TIMEx_EncoderIndexEvent(TIM_HandleTypeDef *htim)
+{
+  TIM_EncoderServiceTypeDef *pService = htim->pEncoder;
+  uint32_t primask_bit;
+
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  pService->IndexCount++;
+  if ((pService->HomeOnIndex != 0U) && (pService->Homed == 0U))
+  {
+    pService->Epoch = 0;
+    __HAL_TIM_CLEAR_FLAG(htim, TIM_FLAG_UPDATE);
+    pService->Homed = 1U;
+  }
+  pService->Sequence++;
+
+  __set_PRIMASK(primask_bit);
+}
+
+/**
+  * @brief  TIM DMA capture ring half complete and complete callback.
+  * @param  hdma pointer to DMA handle.
+  * @retval None
+  */
+static void TIMEx_DMACaptureRingEvent(DMA_HandleTypeDef *hdma)
+{
+  TIM_HandleTypeDef *htim = (TIM_HandleTypeDef *)((DMA_HandleTypeDef *)hdma)->Parent;
+
+  HAL_TIMEx_CaptureRing_Update(htim);
+}
+
+/**
+  * @brief  Extend the captures written by the DMA since the last call to timestamps.
+  * @note   To be called with the interrupts disabled. While an overflow is pending,
+  *         a capture belongs to the new counter period when it is not above the
+  *         current counter value and it is either below the last capture or the
+  *         first capture since the previous overflow. An edge captured in the
+  *         latency of the previous overflow interrupt, above its counter value,
+  *         with no other edge during a whole counter period, can be counted one
+  *         period late: this needs the update interrupt latency to grow between
+  *         two overflows.
+  * @param  htim TIM handle.
+  * @retval None
+  */
+static void TIMEx_CaptureRingExtend(TIM_HandleTypeDef *htim)
+{
+  TIM_CaptureRingTypeDef *pRing = htim->pCaptureRing;
+  DMA_HandleTypeDef *hdma = htim->hdma[TIM_DMA_ID_CC1 + (pRing->Channel >> 2U)];
+  uint64_t range = (uint64_t)pRing->AutoReload + 1U;
+  uint64_t epoch;
+  uint32_t position;
+  uint32_t pending;
+  uint32_t counter;
+  uint32_t capture;
+  uint32_t head;
+  uint32_t end;
+
+  /* The DMA position is read first: the captures it covers are older than the flag */
+  position = ((pRing->Mask + 1U) - __HAL_DMA_GET_COUNTER(hdma)) & pRing->Mask;
+  pending = (__HAL_TIM_GET_FLAG(htim, TIM_FLAG_UPDATE) != RESET) ? 1U : 0U;
+  counter = htim->Instance->CNT;
+
+  head = pRing->Head;
+  end = head + ((position - head) & pRing->Mask);
+
+  while (head != end)
+  {
+    capture = pRing->pBuffer[head & pRing->Mask];
+    epoch = pRing->Epoch;
+
+    if (pending != 0U)
+    {
+      if (pRing->LastEpoch > epoch)
+      {
+        /* A previous capture is already in the new counter period */
+        epoch++;
+      }
+      else if ((capture <= counter) && ((pRing->LastEpoch != epoch) || (capture < pRing->LastCapture)))
+      {
+        epoch++;
+      }
+      else
+      {
+        /* Captured before the overflow */
+      }
+    }
+
+    pRing->pTimestamp[head & pRing->Mask] = (epoch * range) + capture;
+    pRing->LastEpoch = epoch;
+    pRing->LastCapture = capture;
+    head++;
+
+    if (pRing->Filled <= pRing->Mask)
+    {
+      pRing->Filled++;
+    }
+  }
+
+  if ((head - pRing->Tail) > (pRing->Mask + 1U))
+  {
+    pRing->Overrun++;
+  }
+  pRing->Head = head;
+}
+
 /**
   * @brief  TIM DMA Delay Pulse complete callback (complementary channel).
   * @param  hdma pointer to DMA handle.
@@ -3583,6 +4766,134 @@ static void TIM_CCxNChannelCmd(TIM_TypeDef *TIMx, uint32_t Channel, uint32_t Cha
   /* Set or reset the CCxNE Bit */
   TIMx->CCER |= (uint32_t)(ChannelNState << (Channel & 0x1FU)); /* 0x1FU = 31 bits max shift */
 }
+
+/**
+  * @brief  TIM DMA pulse encoder half complete callback.
+  * @param  hdma pointer to DMA handle.
+  * @retval None
+  */
+static void TIMEx_DMAPulseEncoderHalfCplt(DMA_HandleTypeDef *hdma)
+{
+  TIM_HandleTypeDef *htim = (TIM_HandleTypeDef *)((DMA_HandleTypeDef *)hdma)->Parent;
+
+  TIMEx_PulseEncoderEvent(htim, 0U);
+}
+
+/**
+  * @brief  TIM DMA pulse encoder complete callback.
+  * @param  hdma pointer to DMA handle.
+  * @retval None
+  */
+static void TIMEx_DMAPulseEncoderCplt(DMA_HandleTypeDef *hdma)
+{
+  TIM_HandleTypeDef *htim = (TIM_HandleTypeDef *)((DMA_HandleTypeDef *)hdma)->Parent;
+
+  if (htim->pPulseEncoder != NULL)
+  {
+    TIMEx_PulseEncoderEvent(htim, htim->pPulseEncoder->BufferSize / 2U);
+  }
+}
+
+/**
+  * @brief  Refill the buffer half just sent by the DMA.
+  * @note   Once the last half holding a part of the frame has been sent, the DMA
+  *         is stopped and the compare value set to 0: the reset periods already
+  *         sent guarantee that the last bit period is complete.
+  * @param  htim TIM handle.
+  * @param  Offset Index of the half in the buffer.
+  * @retval None
+  */
+static void TIMEx_PulseEncoderEvent(TIM_HandleTypeDef *htim, uint32_t Offset)
+{
+  TIM_PulseEncoderTypeDef *pEncoder = htim->pPulseEncoder;
+
+  if (pEncoder == NULL)
+  {
+    return;
+  }
+
+  pEncoder->Pending--;
+  if (pEncoder->Pending == 0U)
+  {
+    TIMEx_PulseEncoderStop(htim);
+    HAL_TIMEx_PulseEncoder_TxCpltCallback(htim);
+  }
+  else
+  {
+    pEncoder->Pending += TIMEx_PulseEncoderFill(pEncoder, &pEncoder->pBuffer[Offset]);
+  }
+}
+
+/**
+  * @brief  Expand the next payload bits and reset periods into a buffer half.
+  * @param  pEncoder pointer to the pulse encoder.
+  * @param  pHalf pointer to the buffer half to fill.
+  * @retval 1 when the half holds a part of the frame, 0 when it is only padding
+  */
+static uint32_t TIMEx_PulseEncoderFill(TIM_PulseEncoderTypeDef *pEncoder, uint32_t *pHalf)
+{
+  uint32_t count = pEncoder->BufferSize / 2U;
+  uint32_t index = 0U;
+  uint32_t bit = pEncoder->BitIndex;
+  uint32_t value;
+
+  if ((bit >= pEncoder->BitCount) && (pEncoder->ResetLeft == 0U))
+  {
+    for (index = 0U; index < count; index++)
+    {
+      pHalf[index] = 0U;
+    }
+    return 0U;
+  }
+
+  /* Payload bits, the byte is only read again when it changes */
+  while ((index < count) && (bit < pEncoder->BitCount))
+  {
+    value = ((uint32_t)pEncoder->pData[bit >> 3U]) << (bit & 7U);
+    do
+    {
+      pHalf[index] = ((value & 0x80U) != 0U) ? pEncoder->OneCompare : pEncoder->ZeroCompare;
+      value <<= 1U;
+      index++;
+      bit++;
+    } while ((index < count) && ((bit & 7U) != 0U) && (bit < pEncoder->BitCount));
+  }
+  pEncoder->BitIndex = bit;
+
+  /* Reset periods, then padding until the DMA is stopped */
+  while (index < count)
+  {
+    if (pEncoder->ResetLeft != 0U)
+    {
+      pEncoder->ResetLeft--;
+    }
+    pHalf[index] = 0U;
+    index++;
+  }
+
+  return 1U;
+}
+
+/**
+  * @brief  Stop the DMA of the pulse encoder and leave the output low.
+  * @param  htim TIM handle.
+  * @retval None
+  */
+static void TIMEx_PulseEncoderStop(TIM_HandleTypeDef *htim)
+{
+  TIM_PulseEncoderTypeDef *pEncoder = htim->pPulseEncoder;
+  uint32_t channel = pEncoder->Channel;
+
+  /* Disable the TIM Capture/Compare DMA request of the channel */
+  __HAL_TIM_DISABLE_DMA(htim, (TIM_DMA_CC1 << (channel >> 2U)));
+  (void)HAL_DMA_Abort_IT(htim->hdma[TIM_DMA_ID_CC1 + (channel >> 2U)]);
+
+  /* CCR1 to CCR4 are contiguous */
+  *(__IO uint32_t *)((uint32_t)&htim->Instance->CCR1 + channel) = 0U;
+
+  htim->pPulseEncoder = NULL;
+  TIM_CHANNEL_STATE_SET(htim, channel, HAL_TIM_CHANNEL_STATE_READY);
+}
 /**
   * @}
   */
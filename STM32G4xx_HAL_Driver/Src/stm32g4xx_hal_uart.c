@@ -138,6 +138,28 @@
     not defined, the callback registration feature is not available
     and weak (surcharged) callbacks are used.
 
+    ##### Constant callback binding #####
+    ======================================
+    [..]
+    The compilation define USE_HAL_UART_CONST_CALLBACKS when set to 1 allows
+    the user to bind a set of callbacks to each UART instance at build time,
+    instead of storing one pointer per callback in each handle.
+    It cannot be used together with USE_HAL_UART_REGISTER_CALLBACKS.
+
+    [..]
+    The callbacks are grouped in a UART_CallbacksTypeDef structure, declared const
+    so that it is placed in flash. Every entry must be set; the entries that are
+    not used by the application point to the default HAL callbacks
+    (e.g. HAL_UART_TxHalfCpltCallback()).
+    HAL_UART_DefaultCallbacks is the set made of the default HAL callbacks.
+
+    [..]
+    The set is bound to a handle by setting its pCallbacks field, or by calling
+    @ref HAL_UART_BindCallbacks(), before @ref HAL_UART_Init() so that its MspInit
+    callback is used. When pCallbacks is NULL at initialization,
+    HAL_UART_DefaultCallbacks is bound. The handle then only holds one pointer,
+    and each event is dispatched to the bound set.
+
 
   @endverbatim
   ******************************************************************************
@@ -194,6 +216,27 @@
 /* Private variables ---------------------------------------------------------*/
 const uint16_t UARTPrescTable[12] = {1U, 2U, 4U, 6U, 8U, 10U, 12U, 16U, 32U, 64U, 128U, 256U};
 
+#if (USE_HAL_UART_CONST_CALLBACKS == 1)
+/* Callback set made of the legacy weak callbacks */
+const UART_CallbacksTypeDef HAL_UART_DefaultCallbacks =
+{
+  HAL_UART_TxHalfCpltCallback,
+  HAL_UART_TxCpltCallback,
+  HAL_UART_RxHalfCpltCallback,
+  HAL_UART_RxCpltCallback,
+  HAL_UART_ErrorCallback,
+  HAL_UART_AbortCpltCallback,
+  HAL_UART_AbortTransmitCpltCallback,
+  HAL_UART_AbortReceiveCpltCallback,
+  HAL_UARTEx_WakeupCallback,
+  HAL_UARTEx_RxFifoFullCallback,
+  HAL_UARTEx_TxFifoEmptyCallback,
+  HAL_UARTEx_RingRxEventCallback,
+  HAL_UART_MspInit,
+  HAL_UART_MspDeInit
+};
+#endif /* USE_HAL_UART_CONST_CALLBACKS */
+
 /* Private function prototypes -----------------------------------------------*/
 /** @addtogroup UART_Private_Functions
   * @{
@@ -318,6 +361,7 @@ HAL_StatusTypeDef HAL_UART_Init(UART_HandleTypeDef *huart)
   {
     /* Allocate lock resource and initialize it */
     huart->Lock = HAL_UNLOCKED;
+    huart->pRxRing = NULL;
 
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
     UART_InitCallbacksToDefault(huart);
@@ -329,6 +373,14 @@ HAL_StatusTypeDef HAL_UART_Init(UART_HandleTypeDef *huart)
 
     /* Init the low level hardware */
     huart->MspInitCallback(huart);
+#elif (USE_HAL_UART_CONST_CALLBACKS == 1)
+    if (huart->pCallbacks == NULL)
+    {
+      huart->pCallbacks = &HAL_UART_DefaultCallbacks;
+    }
+
+    /* Init the low level hardware */
+    huart->pCallbacks->MspInitCallback(huart);
 #else
     /* Init the low level hardware : GPIO, CLOCK */
     HAL_UART_MspInit(huart);
@@ -383,6 +435,7 @@ HAL_StatusTypeDef HAL_HalfDuplex_Init(UART_HandleTypeDef *huart)
   {
     /* Allocate lock resource and initialize it */
     huart->Lock = HAL_UNLOCKED;
+    huart->pRxRing = NULL;
 
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
     UART_InitCallbacksToDefault(huart);
@@ -394,6 +447,14 @@ HAL_StatusTypeDef HAL_HalfDuplex_Init(UART_HandleTypeDef *huart)
 
     /* Init the low level hardware */
     huart->MspInitCallback(huart);
+#elif (USE_HAL_UART_CONST_CALLBACKS == 1)
+    if (huart->pCallbacks == NULL)
+    {
+      huart->pCallbacks = &HAL_UART_DefaultCallbacks;
+    }
+
+    /* Init the low level hardware */
+    huart->pCallbacks->MspInitCallback(huart);
 #else
     /* Init the low level hardware : GPIO, CLOCK */
     HAL_UART_MspInit(huart);
@@ -469,6 +530,7 @@ HAL_StatusTypeDef HAL_LIN_Init(UART_HandleTypeDef *huart, uint32_t BreakDetectLe
   {
     /* Allocate lock resource and initialize it */
     huart->Lock = HAL_UNLOCKED;
+    huart->pRxRing = NULL;
 
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
     UART_InitCallbacksToDefault(huart);
@@ -480,6 +542,14 @@ HAL_StatusTypeDef HAL_LIN_Init(UART_HandleTypeDef *huart, uint32_t BreakDetectLe
 
     /* Init the low level hardware */
     huart->MspInitCallback(huart);
+#elif (USE_HAL_UART_CONST_CALLBACKS == 1)
+    if (huart->pCallbacks == NULL)
+    {
+      huart->pCallbacks = &HAL_UART_DefaultCallbacks;
+    }
+
+    /* Init the low level hardware */
+    huart->pCallbacks->MspInitCallback(huart);
 #else
     /* Init the low level hardware : GPIO, CLOCK */
     HAL_UART_MspInit(huart);
@@ -553,6 +623,7 @@ HAL_StatusTypeDef HAL_MultiProcessor_Init(UART_HandleTypeDef *huart, uint8_t Add
   {
     /* Allocate lock resource and initialize it */
     huart->Lock = HAL_UNLOCKED;
+    huart->pRxRing = NULL;
 
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
     UART_InitCallbacksToDefault(huart);
@@ -564,6 +635,14 @@ HAL_StatusTypeDef HAL_MultiProcessor_Init(UART_HandleTypeDef *huart, uint8_t Add
 
     /* Init the low level hardware */
     huart->MspInitCallback(huart);
+#elif (USE_HAL_UART_CONST_CALLBACKS == 1)
+    if (huart->pCallbacks == NULL)
+    {
+      huart->pCallbacks = &HAL_UART_DefaultCallbacks;
+    }
+
+    /* Init the low level hardware */
+    huart->pCallbacks->MspInitCallback(huart);
 #else
     /* Init the low level hardware : GPIO, CLOCK */
     HAL_UART_MspInit(huart);
@@ -638,6 +717,13 @@ HAL_StatusTypeDef HAL_UART_DeInit(UART_HandleTypeDef *huart)
   }
   /* DeInit the low level hardware */
   huart->MspDeInitCallback(huart);
+#elif (USE_HAL_UART_CONST_CALLBACKS == 1)
+  if (huart->pCallbacks == NULL)
+  {
+    huart->pCallbacks = &HAL_UART_DefaultCallbacks;
+  }
+  /* DeInit the low level hardware */
+  huart->pCallbacks->MspDeInitCallback(huart);
 #else
   /* DeInit the low level hardware */
   HAL_UART_MspDeInit(huart);
@@ -937,6 +1023,42 @@ HAL_StatusTypeDef HAL_UART_UnRegisterCallback(UART_HandleTypeDef *huart, HAL_UAR
 }
 #endif /* USE_HAL_UART_REGISTER_CALLBACKS */
 
+#if (USE_HAL_UART_CONST_CALLBACKS == 1)
+/**
+  * @brief  Bind a constant callback set to an UART instance
+  * @note   The HAL_UART_BindCallbacks() may be called before HAL_UART_Init() in
+  *         HAL_UART_STATE_RESET to use its MspInit/MspDeInit callbacks, or in
+  *         HAL_UART_STATE_READY to replace the bound set.
+  * @param  huart uart handle
+  * @param  pCallbacks pointer to the callback set, every entry of which must be set
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UART_BindCallbacks(UART_HandleTypeDef *huart, const UART_CallbacksTypeDef *pCallbacks)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+
+  if (pCallbacks == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  __HAL_LOCK(huart);
+
+  if ((huart->gState == HAL_UART_STATE_READY) || (huart->gState == HAL_UART_STATE_RESET))
+  {
+    huart->pCallbacks = pCallbacks;
+  }
+  else
+  {
+    status =  HAL_ERROR;
+  }
+
+  __HAL_UNLOCK(huart);
+
+  return status;
+}
+#endif /* USE_HAL_UART_CONST_CALLBACKS */
+
 /**
   * @}
   */
@@ -1054,6 +1176,7 @@ HAL_StatusTypeDef HAL_UART_Transmit(UART_HandleTypeDef *huart, uint8_t *pData, u
 
     huart->ErrorCode = HAL_UART_ERROR_NONE;
     huart->gState = HAL_UART_STATE_BUSY_TX;
+    HAL_TRACE(huart, HAL_TRACE_EVENT_STATE, HAL_UART_STATE_BUSY_TX);
 
     /* Init tickstart for timeout management */
     tickstart = HAL_GetTick();
@@ -1144,6 +1267,7 @@ HAL_StatusTypeDef HAL_UART_Receive(UART_HandleTypeDef *huart, uint8_t *pData, ui
 
     huart->ErrorCode = HAL_UART_ERROR_NONE;
     huart->RxState = HAL_UART_STATE_BUSY_RX;
+    HAL_TRACE(huart, HAL_TRACE_EVENT_STATE, HAL_UART_STATE_BUSY_RX);
 
     /* Init tickstart for timeout management */
     tickstart = HAL_GetTick();
@@ -1229,6 +1353,7 @@ HAL_StatusTypeDef HAL_UART_Transmit_IT(UART_HandleTypeDef *huart, uint8_t *pData
 
     huart->ErrorCode = HAL_UART_ERROR_NONE;
     huart->gState = HAL_UART_STATE_BUSY_TX;
+    HAL_TRACE(huart, HAL_TRACE_EVENT_STATE, HAL_UART_STATE_BUSY_TX);
 
     /* Configure Tx interrupt processing */
     if (huart->FifoMode == UART_FIFOMODE_ENABLE)
@@ -1306,6 +1431,7 @@ HAL_StatusTypeDef HAL_UART_Receive_IT(UART_HandleTypeDef *huart, uint8_t *pData,
 
     huart->ErrorCode = HAL_UART_ERROR_NONE;
     huart->RxState = HAL_UART_STATE_BUSY_RX;
+    HAL_TRACE(huart, HAL_TRACE_EVENT_STATE, HAL_UART_STATE_BUSY_RX);
 
     /* Enable the UART Error Interrupt: (Frame error, noise error, overrun error) */
     SET_BIT(huart->Instance->CR3, USART_CR3_EIE);
@@ -1383,6 +1509,7 @@ HAL_StatusTypeDef HAL_UART_Transmit_DMA(UART_HandleTypeDef *huart, uint8_t *pDat
 
     huart->ErrorCode = HAL_UART_ERROR_NONE;
     huart->gState = HAL_UART_STATE_BUSY_TX;
+    HAL_TRACE(huart, HAL_TRACE_EVENT_STATE, HAL_UART_STATE_BUSY_TX);
 
     if (huart->hdmatx != NULL)
     {
@@ -1458,6 +1585,7 @@ HAL_StatusTypeDef HAL_UART_Receive_DMA(UART_HandleTypeDef *huart, uint8_t *pData
 
     huart->ErrorCode = HAL_UART_ERROR_NONE;
     huart->RxState = HAL_UART_STATE_BUSY_RX;
+    HAL_TRACE(huart, HAL_TRACE_EVENT_STATE, HAL_UART_STATE_BUSY_RX);
 
     if (huart->hdmarx != NULL)
     {
@@ -1655,6 +1783,8 @@ HAL_StatusTypeDef HAL_UART_DMAStop(UART_HandleTypeDef *huart)
   */
 HAL_StatusTypeDef HAL_UART_Abort(UART_HandleTypeDef *huart)
 {
+  HAL_TRACE(huart, HAL_TRACE_EVENT_ABORT, 0U);
+
   /* Disable TXE, TC, RXNE, PE, RXFT, TXFT and ERR (Frame error, noise error, overrun error) interrupts */
   CLEAR_BIT(huart->Instance->CR1, (USART_CR1_RXNEIE_RXFNEIE | USART_CR1_PEIE | USART_CR1_TXEIE_TXFNFIE |
                                    USART_CR1_TCIE));
@@ -1749,6 +1879,8 @@ HAL_StatusTypeDef HAL_UART_Abort(UART_HandleTypeDef *huart)
   */
 HAL_StatusTypeDef HAL_UART_AbortTransmit(UART_HandleTypeDef *huart)
 {
+  HAL_TRACE(huart, HAL_TRACE_EVENT_ABORT, 0U);
+
   /* Disable TCIE, TXEIE and TXFTIE interrupts */
   CLEAR_BIT(huart->Instance->CR1, (USART_CR1_TCIE | USART_CR1_TXEIE_TXFNFIE));
   CLEAR_BIT(huart->Instance->CR3, USART_CR3_TXFTIE);
@@ -1807,6 +1939,8 @@ HAL_StatusTypeDef HAL_UART_AbortTransmit(UART_HandleTypeDef *huart)
   */
 HAL_StatusTypeDef HAL_UART_AbortReceive(UART_HandleTypeDef *huart)
 {
+  HAL_TRACE(huart, HAL_TRACE_EVENT_ABORT, 0U);
+
   /* Disable PEIE, EIE, RXNEIE and RXFTIE interrupts */
   CLEAR_BIT(huart->Instance->CR1, (USART_CR1_PEIE | USART_CR1_RXNEIE_RXFNEIE));
   CLEAR_BIT(huart->Instance->CR3, USART_CR3_EIE | USART_CR3_RXFTIE);
@@ -1869,6 +2003,8 @@ HAL_StatusTypeDef HAL_UART_Abort_IT(UART_HandleTypeDef *huart)
 {
   uint32_t abortcplt = 1U;
 
+  HAL_TRACE(huart, HAL_TRACE_EVENT_ABORT, 0U);
+
   /* Disable interrupts */
   CLEAR_BIT(huart->Instance->CR1, (USART_CR1_PEIE | USART_CR1_TCIE | USART_CR1_RXNEIE_RXFNEIE |
                                    USART_CR1_TXEIE_TXFNFIE));
@@ -1987,6 +2123,9 @@ HAL_StatusTypeDef HAL_UART_Abort_IT(UART_HandleTypeDef *huart)
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
     /* Call registered Abort complete callback */
     huart->AbortCpltCallback(huart);
+#elif (USE_HAL_UART_CONST_CALLBACKS == 1)
+    /* Call bound Abort complete callback */
+    huart->pCallbacks->AbortCpltCallback(huart);
 #else
     /* Call legacy weak Abort complete callback */
     HAL_UART_AbortCpltCallback(huart);
@@ -2012,6 +2151,8 @@ HAL_StatusTypeDef HAL_UART_Abort_IT(UART_HandleTypeDef *huart)
   */
 HAL_StatusTypeDef HAL_UART_AbortTransmit_IT(UART_HandleTypeDef *huart)
 {
+  HAL_TRACE(huart, HAL_TRACE_EVENT_ABORT, 0U);
+
   /* Disable interrupts */
   CLEAR_BIT(huart->Instance->CR1, (USART_CR1_TCIE | USART_CR1_TXEIE_TXFNFIE));
   CLEAR_BIT(huart->Instance->CR3, USART_CR3_TXFTIE);
@@ -2050,6 +2191,9 @@ HAL_StatusTypeDef HAL_UART_AbortTransmit_IT(UART_HandleTypeDef *huart)
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
       /* Call registered Abort Transmit Complete Callback */
       huart->AbortTransmitCpltCallback(huart);
+#elif (USE_HAL_UART_CONST_CALLBACKS == 1)
+      /* Call bound Abort Transmit Complete Callback */
+      huart->pCallbacks->AbortTransmitCpltCallback(huart);
 #else
       /* Call legacy weak Abort Transmit Complete Callback */
       HAL_UART_AbortTransmitCpltCallback(huart);
@@ -2077,6 +2221,9 @@ HAL_StatusTypeDef HAL_UART_AbortTransmit_IT(UART_HandleTypeDef *huart)
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
     /* Call registered Abort Transmit Complete Callback */
     huart->AbortTransmitCpltCallback(huart);
+#elif (USE_HAL_UART_CONST_CALLBACKS == 1)
+    /* Call bound Abort Transmit Complete Callback */
+    huart->pCallbacks->AbortTransmitCpltCallback(huart);
 #else
     /* Call legacy weak Abort Transmit Complete Callback */
     HAL_UART_AbortTransmitCpltCallback(huart);
@@ -2102,6 +2249,8 @@ HAL_StatusTypeDef HAL_UART_AbortTransmit_IT(UART_HandleTypeDef *huart)
   */
 HAL_StatusTypeDef HAL_UART_AbortReceive_IT(UART_HandleTypeDef *huart)
 {
+  HAL_TRACE(huart, HAL_TRACE_EVENT_ABORT, 0U);
+
   /* Disable RXNE, PE and ERR (Frame error, noise error, overrun error) interrupts */
   CLEAR_BIT(huart->Instance->CR1, (USART_CR1_PEIE | USART_CR1_RXNEIE_RXFNEIE));
   CLEAR_BIT(huart->Instance->CR3, (USART_CR3_EIE | USART_CR3_RXFTIE));
@@ -2146,6 +2295,9 @@ HAL_StatusTypeDef HAL_UART_AbortReceive_IT(UART_HandleTypeDef *huart)
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
       /* Call registered Abort Receive Complete Callback */
       huart->AbortReceiveCpltCallback(huart);
+#elif (USE_HAL_UART_CONST_CALLBACKS == 1)
+      /* Call bound Abort Receive Complete Callback */
+      huart->pCallbacks->AbortReceiveCpltCallback(huart);
 #else
       /* Call legacy weak Abort Receive Complete Callback */
       HAL_UART_AbortReceiveCpltCallback(huart);
@@ -2170,6 +2322,9 @@ HAL_StatusTypeDef HAL_UART_AbortReceive_IT(UART_HandleTypeDef *huart)
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
     /* Call registered Abort Receive Complete Callback */
     huart->AbortReceiveCpltCallback(huart);
+#elif (USE_HAL_UART_CONST_CALLBACKS == 1)
+    /* Call bound Abort Receive Complete Callback */
+    huart->pCallbacks->AbortReceiveCpltCallback(huart);
 #else
     /* Call legacy weak Abort Receive Complete Callback */
     HAL_UART_AbortReceiveCpltCallback(huart);
@@ -2193,6 +2348,27 @@ void HAL_UART_IRQHandler(UART_HandleTypeDef *huart)
   uint32_t errorflags;
   uint32_t errorcode;
 
+  /* UART in ring buffer reception mode, line idle --------------------------*/
+  if (((isrflags & USART_ISR_IDLE) != 0U) && ((cr1its & USART_CR1_IDLEIE) != 0U) && (huart->pRxRing != NULL))
+  {
+    __HAL_UART_CLEAR_FLAG(huart, UART_CLEAR_IDLEF);
+    if (huart->RxState == HAL_UART_STATE_BUSY_RX)
+    {
+      HAL_UARTEx_RingReceive_Update(huart);
+#if (USE_HAL_UART_CONST_CALLBACKS == 1)
+      huart->pCallbacks->RingRxEventCallback(huart);
+#else
+      HAL_UARTEx_RingRxEventCallback(huart);
+#endif /* USE_HAL_UART_CONST_CALLBACKS */
+    }
+    else
+    {
+      /* Reception was aborted through the generic abort services */
+      CLEAR_BIT(huart->Instance->CR1, USART_CR1_IDLEIE);
+      huart->pRxRing = NULL;
+    }
+  }
+
   /* If no error occurs */
   errorflags = (isrflags & (uint32_t)(USART_ISR_PE | USART_ISR_FE | USART_ISR_ORE | USART_ISR_NE | USART_ISR_RTOF));
   if (errorflags == 0U)
@@ -2285,6 +2461,13 @@ void HAL_UART_IRQHandler(UART_HandleTypeDef *huart)
            Disable Rx Interrupts, and disable Rx DMA request, if ongoing */
         UART_EndRxTransfer(huart);
 
+        /* Ring reception in Stop mode: the UART must not wake the MCU up anymore */
+        if ((huart->pRxRing != NULL) && (HAL_IS_BIT_CLR(huart->Instance->CR3, USART_CR3_DMAR)))
+        {
+          CLEAR_BIT(huart->Instance->CR1, USART_CR1_UESM);
+          CLEAR_BIT(huart->Instance->CR3, USART_CR3_WUFIE);
+        }
+
         /* Disable the UART DMA Rx request if enabled */
         if (HAL_IS_BIT_SET(huart->Instance->CR3, USART_CR3_DMAR))
         {
@@ -2307,9 +2490,13 @@ void HAL_UART_IRQHandler(UART_HandleTypeDef *huart)
           else
           {
             /* Call user error callback */
+            HAL_TRACE(huart, HAL_TRACE_EVENT_ERROR, huart->ErrorCode);
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
             /*Call registered error callback*/
             huart->ErrorCallback(huart);
+#elif (USE_HAL_UART_CONST_CALLBACKS == 1)
+            /*Call bound error callback*/
+            huart->pCallbacks->ErrorCallback(huart);
 #else
             /*Call legacy weak error callback*/
             HAL_UART_ErrorCallback(huart);
@@ -2320,9 +2507,13 @@ void HAL_UART_IRQHandler(UART_HandleTypeDef *huart)
         else
         {
           /* Call user error callback */
+          HAL_TRACE(huart, HAL_TRACE_EVENT_ERROR, huart->ErrorCode);
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
           /*Call registered error callback*/
           huart->ErrorCallback(huart);
+#elif (USE_HAL_UART_CONST_CALLBACKS == 1)
+          /*Call bound error callback*/
+          huart->pCallbacks->ErrorCallback(huart);
 #else
           /*Call legacy weak error callback*/
           HAL_UART_ErrorCallback(huart);
@@ -2333,9 +2524,13 @@ void HAL_UART_IRQHandler(UART_HandleTypeDef *huart)
       {
         /* Non Blocking error : transfer could go on.
            Error is notified to user through user error callback */
+        HAL_TRACE(huart, HAL_TRACE_EVENT_ERROR, huart->ErrorCode);
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
         /*Call registered error callback*/
         huart->ErrorCallback(huart);
+#elif (USE_HAL_UART_CONST_CALLBACKS == 1)
+        /*Call bound error callback*/
+        huart->pCallbacks->ErrorCallback(huart);
 #else
         /*Call legacy weak error callback*/
         HAL_UART_ErrorCallback(huart);
@@ -2358,6 +2553,9 @@ void HAL_UART_IRQHandler(UART_HandleTypeDef *huart)
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
     /* Call registered Wakeup Callback */
     huart->WakeupCallback(huart);
+#elif (USE_HAL_UART_CONST_CALLBACKS == 1)
+    /* Call bound Wakeup Callback */
+    huart->pCallbacks->WakeupCallback(huart);
 #else
     /* Call legacy weak Wakeup Callback */
     HAL_UARTEx_WakeupCallback(huart);
@@ -2390,6 +2588,9 @@ void HAL_UART_IRQHandler(UART_HandleTypeDef *huart)
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
     /* Call registered Tx Fifo Empty Callback */
     huart->TxFifoEmptyCallback(huart);
+#elif (USE_HAL_UART_CONST_CALLBACKS == 1)
+    /* Call bound Tx Fifo Empty Callback */
+    huart->pCallbacks->TxFifoEmptyCallback(huart);
 #else
     /* Call legacy weak Tx Fifo Empty Callback */
     HAL_UARTEx_TxFifoEmptyCallback(huart);
@@ -2403,6 +2604,9 @@ void HAL_UART_IRQHandler(UART_HandleTypeDef *huart)
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
     /* Call registered Rx Fifo Full Callback */
     huart->RxFifoFullCallback(huart);
+#elif (USE_HAL_UART_CONST_CALLBACKS == 1)
+    /* Call bound Rx Fifo Full Callback */
+    huart->pCallbacks->RxFifoFullCallback(huart);
 #else
     /* Call legacy weak Rx Fifo Full Callback */
     HAL_UARTEx_RxFifoFullCallback(huart);
@@ -3210,6 +3414,9 @@ HAL_StatusTypeDef UART_WaitOnFlagUntilTimeout(UART_HandleTypeDef *huart, uint32_
   /* Wait until flag is set */
   while ((__HAL_UART_GET_FLAG(huart, Flag) ? SET : RESET) == Status)
   {
+    /* Let the application yield or sleep while waiting */
+    HAL_WaitHook(HAL_WAIT_UART, huart);
+
     /* Check for the Timeout */
     if (Timeout != HAL_MAX_DELAY)
     {
@@ -3222,6 +3429,7 @@ HAL_StatusTypeDef UART_WaitOnFlagUntilTimeout(UART_HandleTypeDef *huart, uint32_
 
         huart->gState = HAL_UART_STATE_READY;
         huart->RxState = HAL_UART_STATE_READY;
+        HAL_TRACE(huart, HAL_TRACE_EVENT_TIMEOUT, Flag);
 
         __HAL_UNLOCK(huart);
 
@@ -3242,6 +3450,7 @@ HAL_StatusTypeDef UART_WaitOnFlagUntilTimeout(UART_HandleTypeDef *huart, uint32_
 
           huart->gState = HAL_UART_STATE_READY;
           huart->RxState = HAL_UART_STATE_READY;
+          HAL_TRACE(huart, HAL_TRACE_EVENT_TIMEOUT, Flag);
           huart->ErrorCode = HAL_UART_ERROR_RTO;
 
           /* Process Unlocked */
@@ -3318,6 +3527,9 @@ static void UART_DMATransmitCplt(DMA_HandleTypeDef *hdma)
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
     /*Call registered Tx complete callback*/
     huart->TxCpltCallback(huart);
+#elif (USE_HAL_UART_CONST_CALLBACKS == 1)
+    /*Call bound Tx complete callback*/
+    huart->pCallbacks->TxCpltCallback(huart);
 #else
     /*Call legacy weak Tx complete callback*/
     HAL_UART_TxCpltCallback(huart);
@@ -3337,6 +3549,9 @@ static void UART_DMATxHalfCplt(DMA_HandleTypeDef *hdma)
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
   /*Call registered Tx Half complete callback*/
   huart->TxHalfCpltCallback(huart);
+#elif (USE_HAL_UART_CONST_CALLBACKS == 1)
+  /*Call bound Tx Half complete callback*/
+  huart->pCallbacks->TxHalfCpltCallback(huart);
 #else
   /*Call legacy weak Tx Half complete callback*/
   HAL_UART_TxHalfCpltCallback(huart);
@@ -3372,6 +3587,9 @@ static void UART_DMAReceiveCplt(DMA_HandleTypeDef *hdma)
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
   /*Call registered Rx complete callback*/
   huart->RxCpltCallback(huart);
+#elif (USE_HAL_UART_CONST_CALLBACKS == 1)
+  /*Call bound Rx complete callback*/
+  huart->pCallbacks->RxCpltCallback(huart);
 #else
   /*Call legacy weak Rx complete callback*/
   HAL_UART_RxCpltCallback(huart);
@@ -3390,6 +3608,9 @@ static void UART_DMARxHalfCplt(DMA_HandleTypeDef *hdma)
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
   /*Call registered Rx Half complete callback*/
   huart->RxHalfCpltCallback(huart);
+#elif (USE_HAL_UART_CONST_CALLBACKS == 1)
+  /*Call bound Rx Half complete callback*/
+  huart->pCallbacks->RxHalfCpltCallback(huart);
 #else
   /*Call legacy weak Rx Half complete callback*/
   HAL_UART_RxHalfCpltCallback(huart);
@@ -3426,9 +3647,13 @@ static void UART_DMAError(DMA_HandleTypeDef *hdma)
 
   huart->ErrorCode |= HAL_UART_ERROR_DMA;
 
+  HAL_TRACE(huart, HAL_TRACE_EVENT_ERROR, huart->ErrorCode);
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
   /*Call registered error callback*/
   huart->ErrorCallback(huart);
+#elif (USE_HAL_UART_CONST_CALLBACKS == 1)
+  /*Call bound error callback*/
+  huart->pCallbacks->ErrorCallback(huart);
 #else
   /*Call legacy weak error callback*/
   HAL_UART_ErrorCallback(huart);
@@ -3447,9 +3672,13 @@ static void UART_DMAAbortOnError(DMA_HandleTypeDef *hdma)
   huart->RxXferCount = 0U;
   huart->TxXferCount = 0U;
 
+  HAL_TRACE(huart, HAL_TRACE_EVENT_ERROR, huart->ErrorCode);
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
   /*Call registered error callback*/
   huart->ErrorCallback(huart);
+#elif (USE_HAL_UART_CONST_CALLBACKS == 1)
+  /*Call bound error callback*/
+  huart->pCallbacks->ErrorCallback(huart);
 #else
   /*Call legacy weak error callback*/
   HAL_UART_ErrorCallback(huart);
@@ -3503,6 +3732,9 @@ static void UART_DMATxAbortCallback(DMA_HandleTypeDef *hdma)
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
   /* Call registered Abort complete callback */
   huart->AbortCpltCallback(huart);
+#elif (USE_HAL_UART_CONST_CALLBACKS == 1)
+  /* Call bound Abort complete callback */
+  huart->pCallbacks->AbortCpltCallback(huart);
 #else
   /* Call legacy weak Abort complete callback */
   HAL_UART_AbortCpltCallback(huart);
@@ -3554,6 +3786,9 @@ static void UART_DMARxAbortCallback(DMA_HandleTypeDef *hdma)
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
   /* Call registered Abort complete callback */
   huart->AbortCpltCallback(huart);
+#elif (USE_HAL_UART_CONST_CALLBACKS == 1)
+  /* Call bound Abort complete callback */
+  huart->pCallbacks->AbortCpltCallback(huart);
 #else
   /* Call legacy weak Abort complete callback */
   HAL_UART_AbortCpltCallback(huart);
@@ -3588,6 +3823,9 @@ static void UART_DMATxOnlyAbortCallback(DMA_HandleTypeDef *hdma)
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
   /* Call registered Abort Transmit Complete Callback */
   huart->AbortTransmitCpltCallback(huart);
+#elif (USE_HAL_UART_CONST_CALLBACKS == 1)
+  /* Call bound Abort Transmit Complete Callback */
+  huart->pCallbacks->AbortTransmitCpltCallback(huart);
 #else
   /* Call legacy weak Abort Transmit Complete Callback */
   HAL_UART_AbortTransmitCpltCallback(huart);
@@ -3621,6 +3859,9 @@ static void UART_DMARxOnlyAbortCallback(DMA_HandleTypeDef *hdma)
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
   /* Call registered Abort Receive Complete Callback */
   huart->AbortReceiveCpltCallback(huart);
+#elif (USE_HAL_UART_CONST_CALLBACKS == 1)
+  /* Call bound Abort Receive Complete Callback */
+  huart->pCallbacks->AbortReceiveCpltCallback(huart);
 #else
   /* Call legacy weak Abort Receive Complete Callback */
   HAL_UART_AbortReceiveCpltCallback(huart);
@@ -3790,6 +4031,9 @@ static void UART_EndTransmit_IT(UART_HandleTypeDef *huart)
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
   /*Call registered Tx complete callback*/
   huart->TxCpltCallback(huart);
+#elif (USE_HAL_UART_CONST_CALLBACKS == 1)
+  /*Call bound Tx complete callback*/
+  huart->pCallbacks->TxCpltCallback(huart);
 #else
   /*Call legacy weak Tx complete callback*/
   HAL_UART_TxCpltCallback(huart);
@@ -3831,6 +4075,9 @@ static void UART_RxISR_8BIT(UART_HandleTypeDef *huart)
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
       /*Call registered Rx complete callback*/
       huart->RxCpltCallback(huart);
+#elif (USE_HAL_UART_CONST_CALLBACKS == 1)
+      /*Call bound Rx complete callback*/
+      huart->pCallbacks->RxCpltCallback(huart);
 #else
       /*Call legacy weak Rx complete callback*/
       HAL_UART_RxCpltCallback(huart);
@@ -3883,6 +4130,9 @@ static void UART_RxISR_16BIT(UART_HandleTypeDef *huart)
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
       /*Call registered Rx complete callback*/
       huart->RxCpltCallback(huart);
+#elif (USE_HAL_UART_CONST_CALLBACKS == 1)
+      /*Call bound Rx complete callback*/
+      huart->pCallbacks->RxCpltCallback(huart);
 #else
       /*Call legacy weak Rx complete callback*/
       HAL_UART_RxCpltCallback(huart);
@@ -3938,6 +4188,9 @@ static void UART_RxISR_8BIT_FIFOEN(UART_HandleTypeDef *huart)
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
         /*Call registered Rx complete callback*/
         huart->RxCpltCallback(huart);
+#elif (USE_HAL_UART_CONST_CALLBACKS == 1)
+        /*Call bound Rx complete callback*/
+        huart->pCallbacks->RxCpltCallback(huart);
 #else
         /*Call legacy weak Rx complete callback*/
         HAL_UART_RxCpltCallback(huart);
@@ -4013,6 +4266,9 @@ static void UART_RxISR_16BIT_FIFOEN(UART_HandleTypeDef *huart)
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
         /*Call registered Rx complete callback*/
         huart->RxCpltCallback(huart);
+#elif (USE_HAL_UART_CONST_CALLBACKS == 1)
+        /*Call bound Rx complete callback*/
+        huart->pCallbacks->RxCpltCallback(huart);
 #else
         /*Call legacy weak Rx complete callback*/
         HAL_UART_RxCpltCallback(huart);
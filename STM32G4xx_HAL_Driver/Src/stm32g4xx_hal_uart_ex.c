@@ -75,6 +75,12 @@
   * @{
   */
 static void UARTEx_Wakeup_AddressConfig(UART_HandleTypeDef *huart, UART_WakeUpTypeDef WakeUpSelection);
+static void UARTEx_DMARingRxEvent(DMA_HandleTypeDef *hdma);
+static void UARTEx_DMARingRxError(DMA_HandleTypeDef *hdma);
+static void UARTEx_EndRingRxTransfer(UART_HandleTypeDef *huart);
+static void UARTEx_RingRxUpdateFromDMA(UART_HandleTypeDef *huart);
+static void UARTEx_RingRxUpdateFromFifo(UART_HandleTypeDef *huart);
+static void UARTEx_RxISR_RingFifo(UART_HandleTypeDef *huart);
 static void UARTEx_SetNbDataToProcess(UART_HandleTypeDef *huart);
 /**
   * @}
@@ -200,6 +206,14 @@ HAL_StatusTypeDef HAL_RS485Ex_Init(UART_HandleTypeDef *huart, uint32_t Polarity,
 
     /* Init the low level hardware */
     huart->MspInitCallback(huart);
+#elif (USE_HAL_UART_CONST_CALLBACKS == 1)
+    if (huart->pCallbacks == NULL)
+    {
+      huart->pCallbacks = &HAL_UART_DefaultCallbacks;
+    }
+
+    /* Init the low level hardware */
+    huart->pCallbacks->MspInitCallback(huart);
 #else
     /* Init the low level hardware : GPIO, CLOCK, CORTEX */
     HAL_UART_MspInit(huart);
@@ -260,6 +274,9 @@ HAL_StatusTypeDef HAL_RS485Ex_Init(UART_HandleTypeDef *huart, uint32_t Polarity,
         (+) HAL_UARTEx_RxFifoFullCallback()
         (+) HAL_UARTEx_TxFifoEmptyCallback()
 
+    (#) Ring buffer reception Callback:
+        (+) HAL_UARTEx_RingRxEventCallback()
+
 @endverbatim
   * @{
   */
@@ -309,6 +326,23 @@ __weak void HAL_UARTEx_TxFifoEmptyCallback(UART_HandleTypeDef *huart)
    */
 }
 
+/**
+  * @brief  UART ring buffer reception event callback.
+  * @note   Called each time new data has been published in the ring, i.e. on line
+  *         idle, half transfer and transfer complete events.
+  * @param  huart UART handle.
+  * @retval None
+  */
+__weak void HAL_UARTEx_RingRxEventCallback(UART_HandleTypeDef *huart)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(huart);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_UARTEx_RingRxEventCallback can be implemented in the user file.
+   */
+}
+
 /**
   * @}
   */
@@ -331,6 +365,23 @@ __weak void HAL_UARTEx_TxFifoEmptyCallback(UART_HandleTypeDef *huart)
      (+) HAL_UARTEx_DisableFifoMode() API disables the FIFO mode
      (+) HAL_UARTEx_SetTxFifoThreshold() API sets the TX FIFO threshold
      (+) HAL_UARTEx_SetRxFifoThreshold() API sets the RX FIFO threshold
+     (+) HAL_UARTEx_RingReceive_DMA() API starts a ring buffer reception in circular DMA mode
+     (+) HAL_UARTEx_RingReceiveStopMode_IT() API starts a ring buffer reception filled from
+         the RX FIFO, able to go on while the MCU is in Stop mode
+     (+) HAL_UARTEx_RingReceive_Stop() API stops either ring buffer reception
+
+    [..] Ring buffer reception in Stop mode:
+     (+) The DMA is not functional in Stop mode, so the RX FIFO accumulates the data
+         while the core is stopped, the UART kernel clock being HSI or LSE.
+     (+) Enable the FIFO mode with HAL_UARTEx_EnableFifoMode() and select the wake-up
+         level with HAL_UARTEx_SetRxFifoThreshold(). When the wake-up on address match
+         or Start bit is used as well, configure it with HAL_UARTEx_StopModeWakeUpSourceConfig().
+     (+) Call HAL_UARTEx_RingReceiveStopMode_IT() then enter Stop mode. The MCU is woken
+         up once per RX FIFO threshold, not per byte. Once awake, the line idle event
+         flushes the end of the burst and HAL_UARTEx_RingRxEventCallback() is called.
+     (+) A burst shorter than the threshold received in Stop mode stays in the RX FIFO
+         until the next wake-up: use UART_RING_WAKEUP_WUF with a Start bit wake-up to
+         be woken up once per burst instead.
 
 @endverbatim
   * @{
@@ -652,6 +703,334 @@ HAL_StatusTypeDef HAL_UARTEx_SetRxFifoThreshold(UART_HandleTypeDef *huart, uint3
   return HAL_OK;
 }
 
+/**
+  * @brief  Start a ring buffer reception in DMA mode.
+  * @note   The Rx DMA handle must be configured in circular mode. The DMA then
+  *         fills pData continuously and the write index is resynchronised from
+  *         the DMA remaining data counter on line idle, half transfer and
+  *         transfer complete events, so a burst is made available to the reader
+  *         as soon as the line goes idle, without any per-byte interrupt.
+  * @note   The reader drains the ring with HAL_UARTEx_Ring_GetData() and
+  *         HAL_UARTEx_Ring_Release(), which hand out pointers into pData
+  *         (no copy is made).
+  * @note   Line errors (noise, framing, parity) are not reported in this mode,
+  *         the reception goes on. A reader that falls behind by more than Size
+  *         bytes loses the oldest data and Overrun is incremented.
+  * @param  huart Pointer to a UART_HandleTypeDef structure that contains
+  *               the configuration information for the specified UART module.
+  * @param  pRing Pointer to the ring descriptor, owned by the application.
+  * @param  pData Pointer to the ring storage.
+  * @param  Size  Size of the ring storage, must be a power of two.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UARTEx_RingReceive_DMA(UART_HandleTypeDef *huart, UART_RingTypeDef *pRing, uint8_t *pData, uint16_t Size)
+{
+  uint32_t *tmp;
+
+  /* Check that a Rx process is not already ongoing */
+  if (huart->RxState == HAL_UART_STATE_READY)
+  {
+    if ((pRing == NULL) || (pData == NULL) || (Size == 0U) || ((Size & (Size - 1U)) != 0U))
+    {
+      return HAL_ERROR;
+    }
+
+    /* The ring relies on the DMA wrapping around by itself */
+    if ((huart->hdmarx == NULL) || (huart->hdmarx->Init.Mode != DMA_CIRCULAR))
+    {
+      return HAL_ERROR;
+    }
+
+    /* Process Locked */
+    __HAL_LOCK(huart);
+
+    pRing->pBuffer = pData;
+    pRing->Mask    = (uint32_t)Size - 1U;
+    pRing->Head    = 0U;
+    pRing->Tail    = 0U;
+    pRing->Overrun = 0U;
+
+    huart->pRxBuffPtr = pData;
+    huart->RxXferSize = Size;
+    huart->pRxRing    = pRing;
+
+    huart->ErrorCode = HAL_UART_ERROR_NONE;
+    huart->RxState = HAL_UART_STATE_BUSY_RX;
+    HAL_TRACE(huart, HAL_TRACE_EVENT_STATE, HAL_UART_STATE_BUSY_RX);
+
+    /* Half transfer and transfer complete both only resynchronise the write index */
+    huart->hdmarx->XferCpltCallback = UARTEx_DMARingRxEvent;
+    huart->hdmarx->XferHalfCpltCallback = UARTEx_DMARingRxEvent;
+
+    /* Set the DMA error callback */
+    huart->hdmarx->XferErrorCallback = UARTEx_DMARingRxError;
+
+    /* Set the DMA abort callback */
+    huart->hdmarx->XferAbortCallback = NULL;
+
+    /* Enable the DMA channel */
+    tmp = (uint32_t *)&pData;
+    if (HAL_DMA_Start_IT(huart->hdmarx, (uint32_t)&huart->Instance->RDR, *(uint32_t *)tmp, Size) != HAL_OK)
+    {
+      huart->pRxRing = NULL;
+      huart->ErrorCode = HAL_UART_ERROR_DMA;
+      huart->RxState = HAL_UART_STATE_READY;
+
+      /* Process Unlocked */
+      __HAL_UNLOCK(huart);
+
+      return HAL_ERROR;
+    }
+
+    /* Clear the Overrun and Idle flags just before enabling the DMA Rx request */
+    __HAL_UART_CLEAR_FLAG(huart, UART_CLEAR_OREF | UART_CLEAR_IDLEF);
+
+    /* Process Unlocked */
+    __HAL_UNLOCK(huart);
+
+    /* Enable the line idle interrupt used to flush bursts to the reader */
+    SET_BIT(huart->Instance->CR1, USART_CR1_IDLEIE);
+
+    /* Enable the DMA transfer for the receiver request by setting the DMAR bit
+    in the UART CR3 register */
+    SET_BIT(huart->Instance->CR3, USART_CR3_DMAR);
+
+    return HAL_OK;
+  }
+  else
+  {
+    return HAL_BUSY;
+  }
+}
+
+/**
+  * @brief  Start a ring buffer reception filled from the RX FIFO, going on in Stop mode.
+  * @note   The FIFO mode must be enabled and the RX FIFO threshold set beforehand. The
+  *         UART Stop mode (UESM) is enabled by this function and disabled by
+  *         HAL_UARTEx_RingReceive_Stop().
+  * @note   The RX FIFO is drained into pData on the RX FIFO threshold and line idle
+  *         interrupts, then HAL_UARTEx_RingRxEventCallback() is called. The line idle
+  *         event is only detected once the MCU is awake.
+  * @note   The reader drains the ring with HAL_UARTEx_Ring_GetData() and
+  *         HAL_UARTEx_Ring_Release(), as for HAL_UARTEx_RingReceive_DMA(). Line errors
+  *         are not reported, an overrun ends the reception with HAL_UART_ERROR_ORE.
+  * @param  huart Pointer to a UART_HandleTypeDef structure that contains
+  *               the configuration information for the specified UART module.
+  * @param  pRing Pointer to the ring descriptor, owned by the application.
+  * @param  pData Pointer to the ring storage.
+  * @param  Size  Size of the ring storage, must be a power of two.
+  * @param  WakeUpSource Events waking the MCU up from Stop mode.
+  *          This parameter can be any combination of @ref UARTEx_Ring_WakeUp_Source.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UARTEx_RingReceiveStopMode_IT(UART_HandleTypeDef *huart, UART_RingTypeDef *pRing, uint8_t *pData,
+                                                    uint16_t Size, uint32_t WakeUpSource)
+{
+  /* Check the parameters */
+  assert_param(IS_UART_WAKEUP_FROMSTOP_INSTANCE(huart->Instance));
+  assert_param(IS_UART_FIFO_INSTANCE(huart->Instance));
+  assert_param(IS_UART_RING_WAKEUP_SOURCE(WakeUpSource));
+
+  /* Check that a Rx process is not already ongoing */
+  if (huart->RxState == HAL_UART_STATE_READY)
+  {
+    if ((pRing == NULL) || (pData == NULL) || (Size == 0U) || ((Size & (Size - 1U)) != 0U))
+    {
+      return HAL_ERROR;
+    }
+
+    /* The data are taken from the RX FIFO, filled by the UART in Stop mode */
+    if (huart->FifoMode != UART_FIFOMODE_ENABLE)
+    {
+      return HAL_ERROR;
+    }
+
+    /* Process Locked */
+    __HAL_LOCK(huart);
+
+    pRing->pBuffer = pData;
+    pRing->Mask    = (uint32_t)Size - 1U;
+    pRing->Head    = 0U;
+    pRing->Tail    = 0U;
+    pRing->Overrun = 0U;
+
+    huart->pRxBuffPtr = pData;
+    huart->RxXferSize = Size;
+    huart->pRxRing    = pRing;
+
+    /* Computation of UART mask to apply to RDR register */
+    UART_MASK_COMPUTATION(huart);
+
+    huart->ErrorCode = HAL_UART_ERROR_NONE;
+    huart->RxState = HAL_UART_STATE_BUSY_RX;
+    HAL_TRACE(huart, HAL_TRACE_EVENT_STATE, HAL_UART_STATE_BUSY_RX);
+
+    huart->RxISR = UARTEx_RxISR_RingFifo;
+
+    /* Clear the Overrun, Idle and Wake-up flags before enabling the interrupts */
+    __HAL_UART_CLEAR_FLAG(huart, UART_CLEAR_OREF | UART_CLEAR_IDLEF | UART_CLEAR_WUF);
+
+    /* Process Unlocked */
+    __HAL_UNLOCK(huart);
+
+    /* Keep the UART receiving while the MCU is in Stop mode */
+    SET_BIT(huart->Instance->CR1, USART_CR1_UESM);
+
+    /* Enable the line idle interrupt used to flush bursts to the reader */
+    SET_BIT(huart->Instance->CR1, USART_CR1_IDLEIE);
+
+    /* Enable the RX FIFO threshold and the selected wake-up interrupts */
+    SET_BIT(huart->Instance->CR3, (USART_CR3_RXFTIE | WakeUpSource));
+
+    return HAL_OK;
+  }
+  else
+  {
+    return HAL_BUSY;
+  }
+}
+
+/**
+  * @brief  Stop an ongoing ring buffer reception.
+  * @note   The write index is resynchronised one last time, so the data received
+  *         before the call stays available to the reader.
+  * @param  huart Pointer to a UART_HandleTypeDef structure that contains
+  *               the configuration information for the specified UART module.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UARTEx_RingReceive_Stop(UART_HandleTypeDef *huart)
+{
+  if (huart->pRxRing == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* RX FIFO ring reception: no DMA to stop */
+  if (HAL_IS_BIT_CLR(huart->Instance->CR3, USART_CR3_DMAR))
+  {
+    CLEAR_BIT(huart->Instance->CR1, (USART_CR1_IDLEIE | USART_CR1_UESM));
+    CLEAR_BIT(huart->Instance->CR3, (USART_CR3_RXFTIE | USART_CR3_WUFIE));
+
+    /* Publish the data still in the RX FIFO */
+    UARTEx_RingRxUpdateFromFifo(huart);
+
+    huart->RxISR = NULL;
+    UARTEx_EndRingRxTransfer(huart);
+
+    return HAL_OK;
+  }
+
+  /* Stop new Rx DMA requests and line idle notifications */
+  CLEAR_BIT(huart->Instance->CR1, USART_CR1_IDLEIE);
+  CLEAR_BIT(huart->Instance->CR3, USART_CR3_DMAR);
+
+  /* Publish the data written so far before the DMA is disabled */
+  UARTEx_RingRxUpdateFromDMA(huart);
+
+  /* Abort the UART DMA Rx stream : use blocking DMA Abort API (no callback) */
+  huart->hdmarx->XferAbortCallback = NULL;
+  if (HAL_DMA_Abort(huart->hdmarx) != HAL_OK)
+  {
+    if (HAL_DMA_GetError(huart->hdmarx) == HAL_DMA_ERROR_TIMEOUT)
+    {
+      /* Set error code to DMA */
+      huart->ErrorCode = HAL_UART_ERROR_DMA;
+
+      return HAL_TIMEOUT;
+    }
+  }
+
+  UARTEx_EndRingRxTransfer(huart);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Resynchronise the ring write index with the received data.
+  * @note   Called by the driver on line idle, half transfer, transfer complete and
+  *         RX FIFO threshold events. It can also be called by the reader to pick up
+  *         bytes received since the last event without waiting for the line to go idle.
+  * @param  huart Pointer to a UART_HandleTypeDef structure that contains
+  *               the configuration information for the specified UART module.
+  * @retval None
+  */
+void HAL_UARTEx_RingReceive_Update(UART_HandleTypeDef *huart)
+{
+  if (huart->pRxRing != NULL)
+  {
+    if (HAL_IS_BIT_SET(huart->Instance->CR3, USART_CR3_DMAR))
+    {
+      UARTEx_RingRxUpdateFromDMA(huart);
+    }
+    else
+    {
+      UARTEx_RingRxUpdateFromFifo(huart);
+    }
+  }
+}
+
+/**
+  * @brief  Return the number of bytes waiting in the ring.
+  * @param  pRing Pointer to the ring descriptor.
+  * @retval Number of bytes available to the reader
+  */
+uint32_t HAL_UARTEx_Ring_GetCount(UART_RingTypeDef *pRing)
+{
+  uint32_t count = pRing->Head - pRing->Tail;
+
+  /* Bytes overwritten by the DMA are not readable anymore */
+  if (count > (pRing->Mask + 1U))
+  {
+    count = pRing->Mask + 1U;
+  }
+
+  return count;
+}
+
+/**
+  * @brief  Get direct access to the oldest bytes waiting in the ring.
+  * @note   Only the contiguous part up to the end of the storage is returned: when
+  *         the waiting data wraps around, a second call after
+  *         HAL_UARTEx_Ring_Release() returns the remainder.
+  * @param  pRing  Pointer to the ring descriptor.
+  * @param  ppData Filled with a pointer to the oldest waiting byte.
+  * @retval Number of contiguous bytes readable at *ppData
+  */
+uint32_t HAL_UARTEx_Ring_GetData(UART_RingTypeDef *pRing, uint8_t **ppData)
+{
+  uint32_t head = pRing->Head;
+  uint32_t tail = pRing->Tail;
+  uint32_t size = pRing->Mask + 1U;
+  uint32_t count;
+
+  /* The writer overtook the reader: skip the overwritten bytes */
+  if ((head - tail) > size)
+  {
+    tail = head - size;
+    pRing->Tail = tail;
+  }
+
+  count = head - tail;
+  if (count > (size - (tail & pRing->Mask)))
+  {
+    count = size - (tail & pRing->Mask);
+  }
+
+  *ppData = &pRing->pBuffer[tail & pRing->Mask];
+  return count;
+}
+
+/**
+  * @brief  Hand bytes obtained with HAL_UARTEx_Ring_GetData() back to the driver.
+  * @param  pRing Pointer to the ring descriptor.
+  * @param  Count Number of bytes consumed by the reader.
+  * @retval None
+  */
+void HAL_UARTEx_Ring_Release(UART_RingTypeDef *pRing, uint32_t Count)
+{
+  pRing->Tail += Count;
+}
+
 /**
   * @}
   */
@@ -681,6 +1060,143 @@ static void UARTEx_Wakeup_AddressConfig(UART_HandleTypeDef *huart, UART_WakeUpTy
   MODIFY_REG(huart->Instance->CR2, USART_CR2_ADD, ((uint32_t)WakeUpSelection.Address << UART_CR2_ADDRESS_LSB_POS));
 }
 
+/**
+  * @brief  DMA UART ring buffer reception half/full transfer callback.
+  * @param  hdma DMA handle.
+  * @retval None
+  */
+static void UARTEx_DMARingRxEvent(DMA_HandleTypeDef *hdma)
+{
+  UART_HandleTypeDef *huart = (UART_HandleTypeDef *)((DMA_HandleTypeDef *)hdma)->Parent;
+
+  HAL_UARTEx_RingReceive_Update(huart);
+#if (USE_HAL_UART_CONST_CALLBACKS == 1)
+  huart->pCallbacks->RingRxEventCallback(huart);
+#else
+  HAL_UARTEx_RingRxEventCallback(huart);
+#endif /* USE_HAL_UART_CONST_CALLBACKS */
+}
+
+/**
+  * @brief  DMA UART ring buffer reception error callback.
+  * @param  hdma DMA handle.
+  * @retval None
+  */
+static void UARTEx_DMARingRxError(DMA_HandleTypeDef *hdma)
+{
+  UART_HandleTypeDef *huart = (UART_HandleTypeDef *)(hdma->Parent);
+
+  UARTEx_EndRingRxTransfer(huart);
+  huart->ErrorCode |= HAL_UART_ERROR_DMA;
+
+  HAL_TRACE(huart, HAL_TRACE_EVENT_ERROR, huart->ErrorCode);
+#if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
+  /*Call registered error callback*/
+  huart->ErrorCallback(huart);
+#elif (USE_HAL_UART_CONST_CALLBACKS == 1)
+  /*Call bound error callback*/
+  huart->pCallbacks->ErrorCallback(huart);
+#else
+  /*Call legacy weak error callback*/
+  HAL_UART_ErrorCallback(huart);
+#endif /* USE_HAL_UART_REGISTER_CALLBACKS */
+}
+
+/**
+  * @brief  End an ongoing ring buffer reception.
+  * @param  huart UART handle.
+  * @retval None
+  */
+static void UARTEx_EndRingRxTransfer(UART_HandleTypeDef *huart)
+{
+  /* Disable the line idle interrupt and the DMA Rx request */
+  CLEAR_BIT(huart->Instance->CR1, USART_CR1_IDLEIE);
+  CLEAR_BIT(huart->Instance->CR3, USART_CR3_DMAR);
+
+  huart->pRxRing = NULL;
+
+  /* At end of Rx process, restore huart->RxState to Ready */
+  huart->RxState = HAL_UART_STATE_READY;
+}
+
+/**
+  * @brief  Resynchronise the ring write index with the DMA remaining data counter.
+  * @param  huart UART handle.
+  * @retval None
+  */
+static void UARTEx_RingRxUpdateFromDMA(UART_HandleTypeDef *huart)
+{
+  UART_RingTypeDef *pRing = huart->pRxRing;
+  uint32_t primask_bit;
+  uint32_t position;
+  uint32_t head;
+
+  /* The update can be entered concurrently from the UART IRQ, the DMA IRQ and
+     the reader: keep the read-modify-write of Head atomic */
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  position = ((uint32_t)huart->RxXferSize - __HAL_DMA_GET_COUNTER(huart->hdmarx)) & pRing->Mask;
+  head = pRing->Head;
+  head += (position - head) & pRing->Mask;
+  if ((head - pRing->Tail) > (pRing->Mask + 1U))
+  {
+    pRing->Overrun++;
+  }
+  pRing->Head = head;
+
+  __set_PRIMASK(primask_bit);
+}
+
+/**
+  * @brief  Move the content of the RX FIFO to the ring.
+  * @note   As in DMA mode, a reader that falls behind loses the oldest data.
+  * @param  huart UART handle.
+  * @retval None
+  */
+static void UARTEx_RingRxUpdateFromFifo(UART_HandleTypeDef *huart)
+{
+  UART_RingTypeDef *pRing = huart->pRxRing;
+  uint16_t uhMask = huart->Mask;
+  uint32_t primask_bit;
+  uint32_t head;
+  uint32_t overrun = 0U;
+
+  /* The update can be entered concurrently from the UART IRQ and the reader */
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  head = pRing->Head;
+  while (__HAL_UART_GET_FLAG(huart, UART_FLAG_RXFNE) != RESET)
+  {
+    pRing->pBuffer[head & pRing->Mask] = (uint8_t)(huart->Instance->RDR & (uint8_t)uhMask);
+    head++;
+    if ((head - pRing->Tail) > (pRing->Mask + 1U))
+    {
+      overrun = 1U;
+    }
+  }
+  pRing->Overrun += overrun;
+  pRing->Head = head;
+
+  __set_PRIMASK(primask_bit);
+}
+
+/**
+  * @brief  RX FIFO threshold interrupt handler of the FIFO ring buffer reception.
+  * @param  huart UART handle.
+  * @retval None
+  */
+static void UARTEx_RxISR_RingFifo(UART_HandleTypeDef *huart)
+{
+  UARTEx_RingRxUpdateFromFifo(huart);
+#if (USE_HAL_UART_CONST_CALLBACKS == 1)
+  huart->pCallbacks->RingRxEventCallback(huart);
+#else
+  HAL_UARTEx_RingRxEventCallback(huart);
+#endif /* USE_HAL_UART_CONST_CALLBACKS */
+}
+
 /**
   * @brief Calculate the number of data to process in RX/TX ISR.
   * @note The RX FIFO depth and the TX FIFO depth is extracted from
@@ -0,0 +1,1086 @@
+/**
+  ******************************************************************************
+  * @file    stm32g4xx_hal_ucpd.c
+  * @author  MCD Application Team
+  * @brief   UCPD HAL module driver.
+  *          This file provides firmware functions to manage the USB Power
+  *          Delivery message layer of the UCPD peripheral:
+  *           + Initialization and de-initialization functions
+  *           + IO operation functions
+  *           + Callback functions
+  *           + Peripheral State functions
+  *
+  *  @verbatim
+  ================================================================================
+            ##### How to use this driver #####
+  ================================================================================
+    [..]
+      The UCPD HAL driver moves USB PD messages with DMA and handles the
+      GoodCRC handshake and the retries, the policy is left to the callbacks.
+
+      (#) Initialize the UCPD low level resources by implementing the HAL_UCPD_MspInit():
+         (++) Enable the UCPD interface clock using __HAL_RCC_UCPD1_CLK_ENABLE()
+         (++) Release the dead battery pull-downs using HAL_PWREx_DisableUCPDDeadBattery()
+         (++) Configure the CC1/CC2 pins in analog mode
+         (++) Configure two DMA channels with byte data width in normal mode, one
+              memory to peripheral on DMA_REQUEST_UCPD1_TX and one peripheral to
+              memory on DMA_REQUEST_UCPD1_RX. Link them to the UCPD handle with
+              __HAL_LINKDMA(hucpd, hdmatx, hdma_tx) and __HAL_LINKDMA(hucpd, hdmarx, hdma_rx).
+              The DMA interrupts are not needed by this driver.
+         (++) Configure the UCPD1 interrupt priority with HAL_NVIC_SetPriority()
+              and enable it with HAL_NVIC_EnableIRQ(). The GoodCRC answer is started
+              from HAL_UCPD_IRQHandler(), the priority must let it meet the
+              tTransmit window of the specification.
+
+      (#) Fill the Init structure and call HAL_UCPD_Init(). The Type-C detection
+          is enabled on both CC lines, attach/detach is reported through
+          HAL_UCPD_TypeCEventCallback().
+
+      (#) Once the orientation is known, call HAL_UCPD_Start() with the CC line
+          carrying the PD communication. HAL_UCPD_Stop() stops the receiver on detach.
+
+      (#) Received messages are acknowledged by a GoodCRC built from the Init
+          parameters and are passed to HAL_UCPD_RxMsgCallback() with their ordered
+          set, the payload and its size without the CRC. Retransmitted messages
+          (same MessageID) are acknowledged but not reported. The Rx buffers are
+          used alternately, the data stays valid until the next message is received.
+
+      (#) HAL_UCPD_Transmit_DMA() sends a message (header and data objects) on an
+          ordered set. The message is resent up to Init.TxRetryCount times when it
+          is discarded by the PHY or not acknowledged. HAL_UCPD_CheckTxTimeout() must
+          be called every millisecond (e.g. from HAL_SYSTICK_Callback()) to detect the
+          missing GoodCRC. The end of the exchange is reported by
+          HAL_UCPD_TxMsgCpltCallback() or HAL_UCPD_TxMsgErrorCallback().
+          HAL_UCPD_Transmit_DMA() can be called from HAL_UCPD_RxMsgCallback(), the
+          message is then sent once the GoodCRC answer is out.
+
+      (#) HAL_UCPD_SendHardReset() signals a Hard Reset, HAL_UCPD_HardResetTxCpltCallback()
+          is called once sent. A Hard Reset received from the port partner is reported
+          by HAL_UCPD_HardResetRxCallback(). HAL_UCPD_ResetMessageId() clears the
+          MessageID history after a Soft Reset or a Hard Reset.
+
+      (#) Call HAL_UCPD_DeInit() to de-initialize the UCPD peripheral.
+
+  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32g4xx_hal.h"
+
+#if defined(UCPD1)
+#ifdef HAL_UCPD_MODULE_ENABLED
+
+/** @addtogroup STM32G4xx_HAL_Driver
+  * @{
+  */
+
+/** @defgroup UCPD UCPD
+  * @brief UCPD HAL driver modules.
+  * @{
+  */
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/** @defgroup UCPD_Private_Constants UCPD Private Constants
+  * @{
+  */
+#define UCPD_TX_IDLE                0x00U   /* No message transmission ongoing               */
+#define UCPD_TX_QUEUED              0x01U   /* Message waiting for the GoodCRC answer to end */
+#define UCPD_TX_SENDING             0x02U   /* Message handed to the PHY                     */
+#define UCPD_TX_WAIT_GOODCRC        0x03U   /* Message sent, waiting for the GoodCRC         */
+#define UCPD_TX_HARDRESET           0x04U   /* Hard Reset signalling ongoing                 */
+
+#define UCPD_CRC_SIZE               4U      /* CRC bytes received after the payload          */
+#define UCPD_GOODCRC_TIMEOUT        1U      /* tReceive (1.1 ms max), in ms                  */
+#define UCPD_MSG_ID_NONE            0xFFU   /* No MessageID received yet                     */
+
+#define UCPD_HEADER_MSG_TYPE        0x001FU /* Message Type field of the header              */
+#define UCPD_HEADER_DATA_ROLE_Pos   5U      /* Port Data Role field position                 */
+#define UCPD_HEADER_SPEC_REV_Pos    6U      /* Specification Revision field position         */
+#define UCPD_HEADER_POWER_ROLE_Pos  8U      /* Port Power Role field position                */
+#define UCPD_HEADER_MSG_ID_Pos      9U      /* MessageID field position                      */
+#define UCPD_HEADER_NB_DATA_OBJ     0x7000U /* Number of Data Objects field                  */
+#define UCPD_HEADER_EXTENDED        0x8000U /* Extended field                                */
+
+#define UCPD_CTRL_MSG_GOODCRC       0x01U   /* GoodCRC control message                       */
+#define UCPD_CTRL_MSG_SOFT_RESET    0x0DU   /* Soft_Reset control message                    */
+
+#define UCPD_IT_ALL                 (UCPD_IMR_TXMSGDISCIE | UCPD_IMR_TXMSGSENTIE | UCPD_IMR_TXMSGABTIE | \
+                                     UCPD_IMR_HRSTDISCIE | UCPD_IMR_HRSTSENTIE | UCPD_IMR_TXUNDIE | \
+                                     UCPD_IMR_RXHRSTDETIE | UCPD_IMR_RXOVRIE | UCPD_IMR_RXMSGENDIE | \
+                                     UCPD_IMR_TYPECEVT1IE | UCPD_IMR_TYPECEVT2IE)
+/**
+  * @}
+  */
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/** @defgroup UCPD_Private_Variables UCPD Private Variables
+  * @{
+  */
+/* Tx ordered set answering a message received on SOP, SOP' and SOP'' */
+static const uint32_t UCPD_GoodCRCOrderSet[3] =
+{
+  LL_UCPD_ORDERED_SET_SOP,
+  LL_UCPD_ORDERED_SET_SOP1,
+  LL_UCPD_ORDERED_SET_SOP2
+};
+/**
+  * @}
+  */
+
+/* Private function prototypes -----------------------------------------------*/
+/** @defgroup UCPD_Private_Functions UCPD Private Functions
+  * @{
+  */
+static HAL_StatusTypeDef UCPD_StartTransmit(UCPD_HandleTypeDef *hucpd, uint32_t TxOrderSet,
+                                            uint8_t *pData, uint16_t Size);
+static void UCPD_StartReceive(UCPD_HandleTypeDef *hucpd);
+static void UCPD_SendGoodCRC(UCPD_HandleTypeDef *hucpd, uint32_t RxOrderSet, uint32_t MessageId);
+static void UCPD_RetryTransmit(UCPD_HandleTypeDef *hucpd, uint32_t Error);
+static void UCPD_TxLineFree(UCPD_HandleTypeDef *hucpd);
+static void UCPD_RxMsgEnd(UCPD_HandleTypeDef *hucpd);
+/**
+  * @}
+  */
+
+/* Exported functions --------------------------------------------------------*/
+/** @defgroup UCPD_Exported_Functions UCPD Exported Functions
+  * @{
+  */
+
+/** @defgroup UCPD_Exported_Functions_Group1 Initialization and de-initialization functions
+  *  @brief    Initialization and Configuration functions
+  *
+@verbatim
+  ==============================================================================
+              ##### Initialization and de-initialization functions #####
+  ==============================================================================
+    [..]  This section provides functions allowing to:
+      (+) Initialize the UCPD peripheral and the message engine
+      (+) DeInitialize the UCPD peripheral
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Initialize the UCPD peripheral according to the specified parameters
+  *         in the UCPD_InitTypeDef.
+  * @param  hucpd pointer to a UCPD_HandleTypeDef structure.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UCPD_Init(UCPD_HandleTypeDef *hucpd)
+{
+  /* Check the UCPD handle allocation */
+  if (hucpd == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the parameters */
+  assert_param(IS_UCPD_ALL_INSTANCE(hucpd->Instance));
+  assert_param(IS_UCPD_ROLE(hucpd->Init.Role));
+  assert_param(IS_UCPD_DATA_ROLE(hucpd->Init.DataRole));
+  assert_param(IS_UCPD_SPEC_REVISION(hucpd->Init.SpecRevision));
+
+  if (hucpd->State == HAL_UCPD_STATE_RESET)
+  {
+    /* Allocate lock resource and initialize it */
+    hucpd->Lock = HAL_UNLOCKED;
+
+    /* Init the low level hardware */
+    HAL_UCPD_MspInit(hucpd);
+  }
+
+  /* The message engine moves the data with DMA */
+  if ((hucpd->hdmatx == NULL) || (hucpd->hdmarx == NULL))
+  {
+    hucpd->State = HAL_UCPD_STATE_ERROR;
+    return HAL_ERROR;
+  }
+
+  /* CFG1 can only be written while the peripheral is disabled */
+  LL_UCPD_Disable(hucpd->Instance);
+
+  MODIFY_REG(hucpd->Instance->CFG1,
+             UCPD_CFG1_PSC_UCPDCLK | UCPD_CFG1_TRANSWIN | UCPD_CFG1_IFRGAP |
+             UCPD_CFG1_HBITCLKDIV | UCPD_CFG1_RXORDSETEN,
+             hucpd->Init.Prescaler | (hucpd->Init.TransWin << UCPD_CFG1_TRANSWIN_Pos) |
+             (hucpd->Init.IfrGap << UCPD_CFG1_IFRGAP_Pos) | hucpd->Init.HbitClockDiv |
+             hucpd->Init.RxOrderSet);
+
+  LL_UCPD_Enable(hucpd->Instance);
+
+  /* Present Rd or Rp on both CC lines for the Type-C detection */
+  if (hucpd->Init.Role == UCPD_ROLE_SINK)
+  {
+    LL_UCPD_SetSNKRole(hucpd->Instance);
+  }
+  else
+  {
+    LL_UCPD_SetSRCRole(hucpd->Instance);
+    LL_UCPD_SetRpResistor(hucpd->Instance, hucpd->Init.RpValue);
+  }
+  LL_UCPD_SetccEnable(hucpd->Instance, LL_UCPD_CCENABLE_CC1CC2);
+
+  LL_UCPD_TxDMAEnable(hucpd->Instance);
+  LL_UCPD_RxDMAEnable(hucpd->Instance);
+
+  hucpd->TxState = UCPD_TX_IDLE;
+  hucpd->GoodCRCPending = 0U;
+  hucpd->RxBuffIdx = 0U;
+  hucpd->CCPin = LL_UCPD_CCPIN_CC1;
+  HAL_UCPD_ResetMessageId(hucpd);
+
+  /* Clear the pending flags and enable the message engine interrupts */
+  WRITE_REG(hucpd->Instance->ICR, UCPD_IT_ALL);
+  WRITE_REG(hucpd->Instance->IMR, UCPD_IT_ALL);
+
+  hucpd->ErrorCode = HAL_UCPD_ERROR_NONE;
+  hucpd->State = HAL_UCPD_STATE_READY;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  DeInitialize the UCPD peripheral.
+  * @param  hucpd pointer to a UCPD_HandleTypeDef structure.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UCPD_DeInit(UCPD_HandleTypeDef *hucpd)
+{
+  /* Check the UCPD handle allocation */
+  if (hucpd == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the parameters */
+  assert_param(IS_UCPD_ALL_INSTANCE(hucpd->Instance));
+
+  (void)HAL_UCPD_Stop(hucpd);
+
+  WRITE_REG(hucpd->Instance->IMR, 0U);
+  LL_UCPD_TxDMADisable(hucpd->Instance);
+  LL_UCPD_RxDMADisable(hucpd->Instance);
+  LL_UCPD_SetccEnable(hucpd->Instance, LL_UCPD_CCENABLE_NONE);
+  LL_UCPD_Disable(hucpd->Instance);
+
+  /* DeInit the low level hardware */
+  HAL_UCPD_MspDeInit(hucpd);
+
+  hucpd->ErrorCode = HAL_UCPD_ERROR_NONE;
+  hucpd->State = HAL_UCPD_STATE_RESET;
+
+  /* Release Lock */
+  __HAL_UNLOCK(hucpd);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Initialize the UCPD MSP.
+  * @param  hucpd pointer to a UCPD_HandleTypeDef structure.
+  * @retval None
+  */
+__weak void HAL_UCPD_MspInit(UCPD_HandleTypeDef *hucpd)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hucpd);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_UCPD_MspInit can be implemented in the user file
+   */
+}
+
+/**
+  * @brief  DeInitialize the UCPD MSP.
+  * @param  hucpd pointer to a UCPD_HandleTypeDef structure.
+  * @retval None
+  */
+__weak void HAL_UCPD_MspDeInit(UCPD_HandleTypeDef *hucpd)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hucpd);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_UCPD_MspDeInit can be implemented in the user file
+   */
+}
+
+/**
+  * @}
+  */
+
+/** @defgroup UCPD_Exported_Functions_Group2 IO operation functions
+  *  @brief   UCPD message transfer functions
+  *
+@verbatim
+  ==============================================================================
+                      ##### IO operation functions #####
+  ==============================================================================
+    [..]  This section provides functions allowing to:
+      (+) Start and stop the PD receiver on a CC line
+      (+) Transmit a message with DMA, GoodCRC check and retries
+      (+) Signal a Hard Reset
+      (+) Handle the UCPD interrupt
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Start the PD communication on a CC line.
+  * @param  hucpd pointer to a UCPD_HandleTypeDef structure.
+  * @param  CCPin CC line carrying the PD communication.
+  *         This parameter can be one of the following values:
+  *         @arg @ref LL_UCPD_CCPIN_CC1
+  *         @arg @ref LL_UCPD_CCPIN_CC2
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UCPD_Start(UCPD_HandleTypeDef *hucpd, uint32_t CCPin)
+{
+  assert_param(IS_UCPD_CCPIN(CCPin));
+
+  if (hucpd->State != HAL_UCPD_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  /* Process Locked */
+  __HAL_LOCK(hucpd);
+
+  hucpd->CCPin = CCPin;
+  hucpd->TxState = UCPD_TX_IDLE;
+  hucpd->GoodCRCPending = 0U;
+  HAL_UCPD_ResetMessageId(hucpd);
+
+  LL_UCPD_SetCCPin(hucpd->Instance, CCPin);
+  UCPD_StartReceive(hucpd);
+  LL_UCPD_RxEnable(hucpd->Instance);
+
+  hucpd->State = HAL_UCPD_STATE_BUSY;
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(hucpd);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop the PD communication, typically on detach.
+  * @note   A transmission in progress is abandoned without callback.
+  * @param  hucpd pointer to a UCPD_HandleTypeDef structure.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UCPD_Stop(UCPD_HandleTypeDef *hucpd)
+{
+  /* Process Locked */
+  __HAL_LOCK(hucpd);
+
+  LL_UCPD_RxDisable(hucpd->Instance);
+
+  if (hucpd->hdmarx->State == HAL_DMA_STATE_BUSY)
+  {
+    (void)HAL_DMA_Abort(hucpd->hdmarx);
+  }
+  if (hucpd->hdmatx->State == HAL_DMA_STATE_BUSY)
+  {
+    (void)HAL_DMA_Abort(hucpd->hdmatx);
+  }
+
+  hucpd->TxState = UCPD_TX_IDLE;
+  hucpd->GoodCRCPending = 0U;
+
+  if (hucpd->State == HAL_UCPD_STATE_BUSY)
+  {
+    hucpd->State = HAL_UCPD_STATE_READY;
+  }
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(hucpd);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Transmit a message with DMA.
+  * @note   The message is acknowledged when a GoodCRC with the MessageID of its
+  *         header is received, HAL_UCPD_TxMsgCpltCallback() is then called.
+  *         It is resent up to Init.TxRetryCount times, HAL_UCPD_TxMsgErrorCallback()
+  *         is called when all the retries failed.
+  * @note   The buffer must stay valid until the end of the exchange.
+  * @param  hucpd pointer to a UCPD_HandleTypeDef structure.
+  * @param  TxOrderSet Ordered set of the message.
+  *         This parameter can be one of the following values:
+  *         @arg @ref LL_UCPD_ORDERED_SET_SOP
+  *         @arg @ref LL_UCPD_ORDERED_SET_SOP1
+  *         @arg @ref LL_UCPD_ORDERED_SET_SOP2
+  *         @arg @ref LL_UCPD_ORDERED_SET_SOP1_DEBUG
+  *         @arg @ref LL_UCPD_ORDERED_SET_SOP2_DEBUG
+  * @param  pData Message header followed by its data objects, without CRC
+  * @param  Size Size of the message in bytes
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UCPD_Transmit_DMA(UCPD_HandleTypeDef *hucpd, uint32_t TxOrderSet,
+                                        uint8_t *pData, uint16_t Size)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+  uint32_t primask_bit;
+
+  if ((pData == NULL) || (Size < 2U))
+  {
+    return HAL_ERROR;
+  }
+
+  if (hucpd->State != HAL_UCPD_STATE_BUSY)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Process Locked */
+  __HAL_LOCK(hucpd);
+
+  if (hucpd->TxState != UCPD_TX_IDLE)
+  {
+    /* Process Unlocked */
+    __HAL_UNLOCK(hucpd);
+    return HAL_BUSY;
+  }
+
+  hucpd->pTxBuffPtr = pData;
+  hucpd->TxXferSize = Size;
+  hucpd->TxOrderSet = TxOrderSet;
+  hucpd->TxMessageId = (uint8_t)__HAL_UCPD_GET_MESSAGE_ID((uint32_t)pData[0] | ((uint32_t)pData[1] << 8U));
+  hucpd->TxRetry = 0U;
+  hucpd->ErrorCode = HAL_UCPD_ERROR_NONE;
+
+  /* Enter critical section: the GoodCRC answer is ended under interrupt */
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  if (hucpd->GoodCRCPending != 0U)
+  {
+    /* Sent as soon as the GoodCRC answer is out */
+    hucpd->TxState = UCPD_TX_QUEUED;
+  }
+  else
+  {
+    hucpd->TxState = UCPD_TX_SENDING;
+    status = UCPD_StartTransmit(hucpd, TxOrderSet, pData, Size);
+    if (status != HAL_OK)
+    {
+      hucpd->TxState = UCPD_TX_IDLE;
+      hucpd->ErrorCode |= HAL_UCPD_ERROR_DMA;
+    }
+  }
+
+  /* Exit critical section: restore previous priority mask */
+  __set_PRIMASK(primask_bit);
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(hucpd);
+
+  return status;
+}
+
+/**
+  * @brief  Signal a Hard Reset.
+  * @note   A message transmission in progress is abandoned without callback,
+  *         HAL_UCPD_HardResetTxCpltCallback() is called once the Hard Reset is sent.
+  * @param  hucpd pointer to a UCPD_HandleTypeDef structure.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UCPD_SendHardReset(UCPD_HandleTypeDef *hucpd)
+{
+  if (hucpd->State != HAL_UCPD_STATE_BUSY)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Process Locked */
+  __HAL_LOCK(hucpd);
+
+  if (hucpd->hdmatx->State == HAL_DMA_STATE_BUSY)
+  {
+    (void)HAL_DMA_Abort(hucpd->hdmatx);
+  }
+
+  hucpd->TxState = UCPD_TX_HARDRESET;
+  hucpd->GoodCRCPending = 0U;
+  LL_UCPD_SendHardReset(hucpd->Instance);
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(hucpd);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Clear the MessageID history used to drop retransmitted messages.
+  * @note   To be called after a Soft Reset or a Hard Reset.
+  * @param  hucpd pointer to a UCPD_HandleTypeDef structure.
+  * @retval None
+  */
+void HAL_UCPD_ResetMessageId(UCPD_HandleTypeDef *hucpd)
+{
+  hucpd->RxMessageId[0] = UCPD_MSG_ID_NONE;
+  hucpd->RxMessageId[1] = UCPD_MSG_ID_NONE;
+  hucpd->RxMessageId[2] = UCPD_MSG_ID_NONE;
+}
+
+/**
+  * @brief  Check the GoodCRC timeout of the message being transmitted.
+  * @note   To be called every millisecond, the message is resent or reported
+  *         in error when no GoodCRC is received within tReceive.
+  * @param  hucpd pointer to a UCPD_HandleTypeDef structure.
+  * @retval None
+  */
+void HAL_UCPD_CheckTxTimeout(UCPD_HandleTypeDef *hucpd)
+{
+  uint32_t primask_bit;
+
+  /* Enter critical section: the GoodCRC is received under interrupt */
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  if ((hucpd->TxState == UCPD_TX_WAIT_GOODCRC) &&
+      ((HAL_GetTick() - hucpd->TxTickstart) > UCPD_GOODCRC_TIMEOUT))
+  {
+    UCPD_RetryTransmit(hucpd, HAL_UCPD_ERROR_TX_NO_GOODCRC);
+  }
+
+  /* Exit critical section: restore previous priority mask */
+  __set_PRIMASK(primask_bit);
+}
+
+/**
+  * @brief  Handle UCPD interrupt request.
+  * @param  hucpd pointer to a UCPD_HandleTypeDef structure.
+  * @retval None
+  */
+void HAL_UCPD_IRQHandler(UCPD_HandleTypeDef *hucpd)
+{
+  uint32_t itflags = READ_REG(hucpd->Instance->SR) & READ_REG(hucpd->Instance->IMR);
+
+  /* Message sent: a GoodCRC answer, or a message now waiting for its GoodCRC */
+  if ((itflags & UCPD_SR_TXMSGSENT) != 0U)
+  {
+    WRITE_REG(hucpd->Instance->ICR, UCPD_ICR_TXMSGSENTCF);
+
+    if (hucpd->GoodCRCPending != 0U)
+    {
+      UCPD_TxLineFree(hucpd);
+    }
+    else if (hucpd->TxState == UCPD_TX_SENDING)
+    {
+      hucpd->TxState = UCPD_TX_WAIT_GOODCRC;
+      hucpd->TxTickstart = HAL_GetTick();
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+  }
+
+  /* Message received: answered first to meet the GoodCRC window */
+  if ((itflags & UCPD_SR_RXMSGEND) != 0U)
+  {
+    WRITE_REG(hucpd->Instance->ICR, UCPD_ICR_RXMSGENDCF);
+    UCPD_RxMsgEnd(hucpd);
+  }
+
+  /* Message not sent by the PHY */
+  if ((itflags & (UCPD_SR_TXMSGDISC | UCPD_SR_TXMSGABT | UCPD_SR_TXUND)) != 0U)
+  {
+    WRITE_REG(hucpd->Instance->ICR, UCPD_ICR_TXMSGDISCCF | UCPD_ICR_TXMSGABTCF | UCPD_ICR_TXUNDCF);
+
+    if (hucpd->GoodCRCPending != 0U)
+    {
+      /* The port partner retries the message */
+      UCPD_TxLineFree(hucpd);
+    }
+    else if (hucpd->TxState == UCPD_TX_SENDING)
+    {
+      UCPD_RetryTransmit(hucpd, ((itflags & UCPD_SR_TXUND) != 0U) ? HAL_UCPD_ERROR_TX_UNDERRUN :
+                         HAL_UCPD_ERROR_TX_DISCARDED);
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+  }
+
+  /* Hard Reset signalling */
+  if ((itflags & UCPD_SR_HRSTSENT) != 0U)
+  {
+    WRITE_REG(hucpd->Instance->ICR, UCPD_ICR_HRSTSENTCF);
+    hucpd->TxState = UCPD_TX_IDLE;
+    HAL_UCPD_HardResetTxCpltCallback(hucpd);
+  }
+
+  if ((itflags & UCPD_SR_HRSTDISC) != 0U)
+  {
+    /* A Hard Reset is sent whatever the line activity */
+    WRITE_REG(hucpd->Instance->ICR, UCPD_ICR_HRSTDISCCF);
+    LL_UCPD_SendHardReset(hucpd->Instance);
+  }
+
+  if ((itflags & UCPD_SR_RXHRSTDET) != 0U)
+  {
+    WRITE_REG(hucpd->Instance->ICR, UCPD_ICR_RXHRSTDETCF);
+
+    if (hucpd->hdmatx->State == HAL_DMA_STATE_BUSY)
+    {
+      (void)HAL_DMA_Abort(hucpd->hdmatx);
+    }
+    hucpd->TxState = UCPD_TX_IDLE;
+    hucpd->GoodCRCPending = 0U;
+    HAL_UCPD_ResetMessageId(hucpd);
+    UCPD_StartReceive(hucpd);
+
+    HAL_UCPD_HardResetRxCallback(hucpd);
+  }
+
+  if ((itflags & UCPD_SR_RXOVR) != 0U)
+  {
+    WRITE_REG(hucpd->Instance->ICR, UCPD_ICR_RXOVRCF);
+    hucpd->ErrorCode |= HAL_UCPD_ERROR_RX_OVERRUN;
+    HAL_UCPD_ErrorCallback(hucpd);
+  }
+
+  /* Type-C attach/detach */
+  if ((itflags & UCPD_SR_TYPECEVT1) != 0U)
+  {
+    WRITE_REG(hucpd->Instance->ICR, UCPD_ICR_TYPECEVT1CF);
+    HAL_UCPD_TypeCEventCallback(hucpd, LL_UCPD_CCPIN_CC1);
+  }
+
+  if ((itflags & UCPD_SR_TYPECEVT2) != 0U)
+  {
+    WRITE_REG(hucpd->Instance->ICR, UCPD_ICR_TYPECEVT2CF);
+    HAL_UCPD_TypeCEventCallback(hucpd, LL_UCPD_CCPIN_CC2);
+  }
+}
+
+/**
+  * @}
+  */
+
+/** @defgroup UCPD_Exported_Functions_Group3 Callback functions
+  *  @brief   UCPD policy callbacks
+  *
+@verbatim
+  ==============================================================================
+                        ##### Callback functions #####
+  ==============================================================================
+    [..]  This section provides the callbacks called from HAL_UCPD_IRQHandler()
+          and HAL_UCPD_CheckTxTimeout().
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Message received callback.
+  * @note   The GoodCRC answer is already started when this callback is called.
+  * @param  hucpd pointer to a UCPD_HandleTypeDef structure.
+  * @param  RxOrderSet Ordered set of the message, a value of @ref UCPD_LL_EC_RxOrderSet
+  * @param  pData Message header followed by its data objects
+  * @param  Size Size of the message in bytes, CRC excluded
+  * @retval None
+  */
+__weak void HAL_UCPD_RxMsgCallback(UCPD_HandleTypeDef *hucpd, uint32_t RxOrderSet, uint8_t *pData, uint16_t Size)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hucpd);
+  UNUSED(RxOrderSet);
+  UNUSED(pData);
+  UNUSED(Size);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_UCPD_RxMsgCallback can be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Message acknowledged by a GoodCRC callback.
+  * @param  hucpd pointer to a UCPD_HandleTypeDef structure.
+  * @retval None
+  */
+__weak void HAL_UCPD_TxMsgCpltCallback(UCPD_HandleTypeDef *hucpd)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hucpd);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_UCPD_TxMsgCpltCallback can be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Message not acknowledged after all the retries callback.
+  * @note   The cause is given by HAL_UCPD_GetError().
+  * @param  hucpd pointer to a UCPD_HandleTypeDef structure.
+  * @retval None
+  */
+__weak void HAL_UCPD_TxMsgErrorCallback(UCPD_HandleTypeDef *hucpd)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hucpd);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_UCPD_TxMsgErrorCallback can be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Hard Reset received callback.
+  * @param  hucpd pointer to a UCPD_HandleTypeDef structure.
+  * @retval None
+  */
+__weak void HAL_UCPD_HardResetRxCallback(UCPD_HandleTypeDef *hucpd)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hucpd);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_UCPD_HardResetRxCallback can be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Hard Reset sent callback.
+  * @param  hucpd pointer to a UCPD_HandleTypeDef structure.
+  * @retval None
+  */
+__weak void HAL_UCPD_HardResetTxCpltCallback(UCPD_HandleTypeDef *hucpd)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hucpd);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_UCPD_HardResetTxCpltCallback can be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Type-C voltage level change callback.
+  * @note   The new level is given by LL_UCPD_GetTypeCVstateCC1()/LL_UCPD_GetTypeCVstateCC2().
+  * @param  hucpd pointer to a UCPD_HandleTypeDef structure.
+  * @param  CCPin CC line of the event, LL_UCPD_CCPIN_CC1 or LL_UCPD_CCPIN_CC2
+  * @retval None
+  */
+__weak void HAL_UCPD_TypeCEventCallback(UCPD_HandleTypeDef *hucpd, uint32_t CCPin)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hucpd);
+  UNUSED(CCPin);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_UCPD_TypeCEventCallback can be implemented in the user file
+   */
+}
+
+/**
+  * @brief  UCPD error callback.
+  * @param  hucpd pointer to a UCPD_HandleTypeDef structure.
+  * @retval None
+  */
+__weak void HAL_UCPD_ErrorCallback(UCPD_HandleTypeDef *hucpd)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hucpd);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_UCPD_ErrorCallback can be implemented in the user file
+   */
+}
+
+/**
+  * @}
+  */
+
+/** @defgroup UCPD_Exported_Functions_Group4 Peripheral State functions
+  *  @brief   Peripheral State functions
+  *
+@verbatim
+  ==============================================================================
+                      ##### Peripheral State functions #####
+  ==============================================================================
+    [..]
+    This subsection permits to get in run-time the status of the peripheral.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Return the UCPD handle state.
+  * @param  hucpd pointer to a UCPD_HandleTypeDef structure.
+  * @retval HAL state
+  */
+HAL_UCPD_StateTypeDef HAL_UCPD_GetState(UCPD_HandleTypeDef *hucpd)
+{
+  return hucpd->State;
+}
+
+/**
+  * @brief  Return the UCPD error code.
+  * @param  hucpd pointer to a UCPD_HandleTypeDef structure.
+  * @retval UCPD Error Code
+  */
+uint32_t HAL_UCPD_GetError(UCPD_HandleTypeDef *hucpd)
+{
+  return hucpd->ErrorCode;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/** @addtogroup UCPD_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Hand a message to the PHY, the payload being fed by DMA.
+  * @param  hucpd pointer to a UCPD_HandleTypeDef structure.
+  * @param  TxOrderSet Ordered set of the message
+  * @param  pData Message to transmit
+  * @param  Size Size of the message in bytes
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef UCPD_StartTransmit(UCPD_HandleTypeDef *hucpd, uint32_t TxOrderSet,
+                                            uint8_t *pData, uint16_t Size)
+{
+  /* The previous transfer is complete but the channel is still enabled */
+  if (hucpd->hdmatx->State == HAL_DMA_STATE_BUSY)
+  {
+    (void)HAL_DMA_Abort(hucpd->hdmatx);
+  }
+
+  if (HAL_DMA_Start(hucpd->hdmatx, (uint32_t)pData, (uint32_t)&hucpd->Instance->TXDR, Size) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  LL_UCPD_WriteTxOrderSet(hucpd->Instance, TxOrderSet);
+  LL_UCPD_WriteTxPaySize(hucpd->Instance, Size);
+  LL_UCPD_SetTxMode(hucpd->Instance, LL_UCPD_TXMODE_NORMAL);
+  LL_UCPD_SendMessage(hucpd->Instance);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Arm the Rx DMA on the next Rx buffer.
+  * @param  hucpd pointer to a UCPD_HandleTypeDef structure.
+  * @retval None
+  */
+static void UCPD_StartReceive(UCPD_HandleTypeDef *hucpd)
+{
+  if (hucpd->hdmarx->State == HAL_DMA_STATE_BUSY)
+  {
+    (void)HAL_DMA_Abort(hucpd->hdmarx);
+  }
+
+  if (HAL_DMA_Start(hucpd->hdmarx, (uint32_t)&hucpd->Instance->RXDR,
+                    (uint32_t)hucpd->RxBuff[hucpd->RxBuffIdx], UCPD_RX_BUFFER_SIZE) != HAL_OK)
+  {
+    hucpd->ErrorCode |= HAL_UCPD_ERROR_DMA;
+  }
+}
+
+/**
+  * @brief  Answer a received message with a GoodCRC.
+  * @param  hucpd pointer to a UCPD_HandleTypeDef structure.
+  * @param  RxOrderSet Ordered set of the received message (SOP, SOP' or SOP'')
+  * @param  MessageId MessageID of the received message
+  * @retval None
+  */
+static void UCPD_SendGoodCRC(UCPD_HandleTypeDef *hucpd, uint32_t RxOrderSet, uint32_t MessageId)
+{
+  uint32_t header;
+
+  header = UCPD_CTRL_MSG_GOODCRC | (hucpd->Init.SpecRevision << UCPD_HEADER_SPEC_REV_Pos) |
+           (MessageId << UCPD_HEADER_MSG_ID_Pos);
+
+  /* Port roles are only reported on SOP, the cable plug field is 0 for a port */
+  if (RxOrderSet == LL_UCPD_RXORDSET_SOP)
+  {
+    header |= (hucpd->Init.DataRole << UCPD_HEADER_DATA_ROLE_Pos);
+    if (hucpd->Init.Role == UCPD_ROLE_SOURCE)
+    {
+      header |= (1UL << UCPD_HEADER_POWER_ROLE_Pos);
+    }
+  }
+
+  hucpd->GoodCRCBuff[0] = (uint8_t)(header & 0xFFU);
+  hucpd->GoodCRCBuff[1] = (uint8_t)(header >> 8U);
+
+  /* A message not yet on the line is sent after the answer */
+  if (hucpd->TxState == UCPD_TX_SENDING)
+  {
+    hucpd->TxState = UCPD_TX_QUEUED;
+  }
+
+  hucpd->GoodCRCPending = 1U;
+  if (UCPD_StartTransmit(hucpd, UCPD_GoodCRCOrderSet[RxOrderSet], hucpd->GoodCRCBuff, 2U) != HAL_OK)
+  {
+    hucpd->GoodCRCPending = 0U;
+    hucpd->ErrorCode |= HAL_UCPD_ERROR_DMA;
+  }
+}
+
+/**
+  * @brief  Resend the message being transmitted or report it in error.
+  * @param  hucpd pointer to a UCPD_HandleTypeDef structure.
+  * @param  Error Error code recorded for the failed attempt
+  * @retval None
+  */
+static void UCPD_RetryTransmit(UCPD_HandleTypeDef *hucpd, uint32_t Error)
+{
+  hucpd->ErrorCode |= Error;
+
+  if (hucpd->TxRetry < hucpd->Init.TxRetryCount)
+  {
+    hucpd->TxRetry++;
+    hucpd->TxState = UCPD_TX_SENDING;
+    if (UCPD_StartTransmit(hucpd, hucpd->TxOrderSet, hucpd->pTxBuffPtr, hucpd->TxXferSize) == HAL_OK)
+    {
+      return;
+    }
+    hucpd->ErrorCode |= HAL_UCPD_ERROR_DMA;
+  }
+
+  hucpd->TxState = UCPD_TX_IDLE;
+  HAL_UCPD_TxMsgErrorCallback(hucpd);
+}
+
+/**
+  * @brief  End of the GoodCRC answer, start the message queued meanwhile.
+  * @param  hucpd pointer to a UCPD_HandleTypeDef structure.
+  * @retval None
+  */
+static void UCPD_TxLineFree(UCPD_HandleTypeDef *hucpd)
+{
+  hucpd->GoodCRCPending = 0U;
+
+  if (hucpd->TxState == UCPD_TX_QUEUED)
+  {
+    hucpd->TxState = UCPD_TX_SENDING;
+    if (UCPD_StartTransmit(hucpd, hucpd->TxOrderSet, hucpd->pTxBuffPtr, hucpd->TxXferSize) != HAL_OK)
+    {
+      hucpd->TxState = UCPD_TX_IDLE;
+      hucpd->ErrorCode |= HAL_UCPD_ERROR_DMA;
+      HAL_UCPD_TxMsgErrorCallback(hucpd);
+    }
+  }
+}
+
+/**
+  * @brief  Process a received message: GoodCRC check or answer, then report.
+  * @param  hucpd pointer to a UCPD_HandleTypeDef structure.
+  * @retval None
+  */
+static void UCPD_RxMsgEnd(UCPD_HandleTypeDef *hucpd)
+{
+  uint8_t *prxbuff = hucpd->RxBuff[hucpd->RxBuffIdx];
+  uint32_t rxordset = LL_UCPD_ReadRxOrderSet(hucpd->Instance);
+  uint32_t rxsize = LL_UCPD_ReadRxPaySize(hucpd->Instance);
+  uint32_t header;
+  uint32_t msgid;
+
+  /* Messages in error are not acknowledged, the port partner retries them */
+  if ((READ_BIT(hucpd->Instance->SR, UCPD_SR_RXERR) != 0U) || (rxsize < (2U + UCPD_CRC_SIZE)))
+  {
+    hucpd->ErrorCode |= HAL_UCPD_ERROR_RX;
+    UCPD_StartReceive(hucpd);
+    return;
+  }
+
+  header = (uint32_t)prxbuff[0] | ((uint32_t)prxbuff[1] << 8U);
+  msgid = __HAL_UCPD_GET_MESSAGE_ID(header);
+  rxsize -= UCPD_CRC_SIZE;
+
+  /* Next message goes to the other buffer, this one is left to the callback */
+  hucpd->RxBuffIdx ^= 1U;
+  UCPD_StartReceive(hucpd);
+
+  if (((header & (UCPD_HEADER_EXTENDED | UCPD_HEADER_NB_DATA_OBJ)) == 0U) &&
+      ((header & UCPD_HEADER_MSG_TYPE) == UCPD_CTRL_MSG_GOODCRC))
+  {
+    /* GoodCRC of the message being transmitted */
+    if (((hucpd->TxState == UCPD_TX_WAIT_GOODCRC) || (hucpd->TxState == UCPD_TX_SENDING)) &&
+        (msgid == hucpd->TxMessageId))
+    {
+      hucpd->TxState = UCPD_TX_IDLE;
+      HAL_UCPD_TxMsgCpltCallback(hucpd);
+    }
+    return;
+  }
+
+  if (rxordset > LL_UCPD_RXORDSET_SOP2)
+  {
+    /* Debug ordered sets are reported without answer */
+    HAL_UCPD_RxMsgCallback(hucpd, rxordset, prxbuff, (uint16_t)rxsize);
+    return;
+  }
+
+  UCPD_SendGoodCRC(hucpd, rxordset, msgid);
+
+  /* A Soft_Reset resets the MessageID counters */
+  if (((header & (UCPD_HEADER_EXTENDED | UCPD_HEADER_NB_DATA_OBJ)) == 0U) &&
+      ((header & UCPD_HEADER_MSG_TYPE) == UCPD_CTRL_MSG_SOFT_RESET))
+  {
+    HAL_UCPD_ResetMessageId(hucpd);
+  }
+  else if (hucpd->RxMessageId[rxordset] == msgid)
+  {
+    /* Retransmission of a message already received */
+    return;
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+
+  hucpd->RxMessageId[rxordset] = (uint8_t)msgid;
+  HAL_UCPD_RxMsgCallback(hucpd, rxordset, prxbuff, (uint16_t)rxsize);
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#endif /* HAL_UCPD_MODULE_ENABLED */
+#endif /* UCPD1 */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
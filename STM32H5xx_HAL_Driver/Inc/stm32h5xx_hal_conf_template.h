@@ -177,6 +177,8 @@ in voltage and temperature.*/
 #define  VDD_VALUE                  3300UL /*!< Value of VDD in mv */
 #define  TICK_INT_PRIORITY          ((1UL<<__NVIC_PRIO_BITS) - 1UL)  /*!< tick interrupt priority (lowest by default) */
 #define  USE_RTOS                   0U
+#define  USE_HAL_ATOMIC_LOCK        0U /*!< 1: handle lock safe between interrupt and thread */
+#define  USE_HAL_NO_LOCK            0U /*!< 1: handle lock compiled out, single context only */
 #define  PREFETCH_ENABLE            0U               /*!< Enable prefetch */
 
 /* ############################################ Assert Selection #################################################### */
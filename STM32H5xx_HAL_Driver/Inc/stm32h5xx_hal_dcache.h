@@ -85,6 +85,29 @@ typedef struct __DCACHE_HandleTypeDef
   __IO uint32_t               ErrorCode;
 } DCACHE_HandleTypeDef;
 
+/**
+  * @brief  HAL DCACHE monitor counts of a code region, extended to 64 bits
+  */
+typedef struct
+{
+  uint64_t ReadHit;           /*!< Read hits counted while the region was selected   */
+  uint64_t ReadMiss;          /*!< Read misses counted while the region was selected */
+  uint64_t WriteHit;          /*!< Write hits counted while the region was selected  */
+  uint64_t WriteMiss;         /*!< Write misses counted while the region was selected */
+} DCACHE_MonitorCountTypeDef;
+
+/**
+  * @brief  HAL DCACHE monitor sampler structure definition
+  */
+typedef struct
+{
+  DCACHE_HandleTypeDef       *hdcache;    /*!< DCACHE handle of the sampled instance                    */
+  DCACHE_MonitorCountTypeDef *pCount;     /*!< Counts of each code region, array owned by the application */
+  uint32_t                    NbRegions;  /*!< Number of code regions in pCount                          */
+  __IO uint32_t               Region;     /*!< Code region the running counts are attributed to          */
+  __IO uint32_t               Saturated;  /*!< Number of samples where a hardware counter had saturated  */
+} DCACHE_MonitorSamplerTypeDef;
+
 /**
   * @brief  HAL DCACHE Callback pointer definition
   */
@@ -313,6 +336,13 @@ uint32_t HAL_DCACHE_Monitor_GetWriteMissValue(const DCACHE_HandleTypeDef *hdcach
 HAL_StatusTypeDef HAL_DCACHE_Monitor_Reset(DCACHE_HandleTypeDef *hdcache, uint32_t MonitorType);
 HAL_StatusTypeDef HAL_DCACHE_Monitor_Start(DCACHE_HandleTypeDef *hdcache, uint32_t MonitorType);
 HAL_StatusTypeDef HAL_DCACHE_Monitor_Stop(DCACHE_HandleTypeDef *hdcache, uint32_t MonitorType);
+
+/*** Performance sampling functions ***/
+HAL_StatusTypeDef HAL_DCACHE_Sampler_Start(DCACHE_HandleTypeDef *hdcache, DCACHE_MonitorSamplerTypeDef *pSampler,
+                                           DCACHE_MonitorCountTypeDef *pCount, uint32_t NbRegions);
+HAL_StatusTypeDef HAL_DCACHE_Sampler_Stop(DCACHE_MonitorSamplerTypeDef *pSampler);
+void              HAL_DCACHE_Sampler_Sample(DCACHE_MonitorSamplerTypeDef *pSampler);
+HAL_StatusTypeDef HAL_DCACHE_Sampler_SelectRegion(DCACHE_MonitorSamplerTypeDef *pSampler, uint32_t Region);
 /**
   * @}
   */
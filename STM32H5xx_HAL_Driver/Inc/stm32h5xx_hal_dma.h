@@ -1023,6 +1023,59 @@ HAL_StatusTypeDef HAL_DMA_GetLockChannelAttributes(DMA_HandleTypeDef const *cons
 
 #endif /* defined (DMA_RCFGLOCKR_LOCK0) */
 
+/**
+  * @}
+  */
+
+/** @defgroup DMA_Exported_Functions_Group5 Direct transfer functions
+  * @brief    Start, abort and counter functions with the same prototypes on
+  *           every family, reduced to the register writes of the controller. The
+  *           start and counter functions are inline.
+  * @{
+  */
+
+/**
+  * @brief  Starts the DMA transfer with the minimum register writes.
+  * @note   No parameter check, no lock and no handle state update are done: the
+  *         channel must have been configured with HAL_DMA_Init() and must be
+  *         disabled. The interrupt enables are left as already programmed.
+  * @note   Only normal (not linked-list) channel transfers are handled. DataLength
+  *         is given in bytes as for HAL_DMA_Start().
+  * @param  hdma       pointer to a DMA_HandleTypeDef structure that contains
+  *                     the configuration information for the specified DMA Channel.
+  * @param  SrcAddress The source memory Buffer address
+  * @param  DstAddress The destination memory Buffer address
+  * @param  DataLength The length of data to be transferred from source to destination
+  * @retval None
+  */
+__STATIC_INLINE void HAL_DMA_Direct_Start(DMA_HandleTypeDef *hdma, uint32_t SrcAddress, uint32_t DstAddress,
+                                          uint32_t DataLength)
+{
+  /* Configure the DMA channel data size */
+  MODIFY_REG(hdma->Instance->CBR1, DMA_CBR1_BNDT, (DataLength & DMA_CBR1_BNDT));
+
+  /* Clear all interrupt flags */
+  hdma->Instance->CFCR = DMA_FLAG_TC | DMA_FLAG_HT | DMA_FLAG_DTE | DMA_FLAG_ULE | DMA_FLAG_USE | DMA_FLAG_SUSP |
+                         DMA_FLAG_TO;
+
+  hdma->Instance->CSAR = SrcAddress;
+  hdma->Instance->CDAR = DstAddress;
+
+  hdma->Instance->CCR |= DMA_CCR_EN;
+}
+
+HAL_StatusTypeDef HAL_DMA_Direct_Abort(DMA_HandleTypeDef *hdma);
+
+/**
+  * @brief  Returns the number of data units remaining in the current transfer.
+  * @param  hdma       pointer to a DMA_HandleTypeDef structure that contains
+  *                     the configuration information for the specified DMA Channel.
+  * @retval Number of remaining data units
+  */
+__STATIC_INLINE uint32_t HAL_DMA_Direct_GetCounter(const DMA_HandleTypeDef *hdma)
+{
+  return (hdma->Instance->CBR1 & DMA_CBR1_BNDT);
+}
 /**
   * @}
   */
@@ -182,6 +182,21 @@ typedef struct __DMA_QListTypeDef
   __IO uint32_t                  Type;               /*!< Specifies whether the queue is static or dynamic */
 
 } DMA_QListTypeDef;
+
+/**
+  * @brief DMAEx Linked-List Node Pool Structure Definition.
+  */
+typedef struct
+{
+  DMA_NodeTypeDef                *pNodes;            /*!< Specifies the node pool storage array            */
+
+  uint32_t                       NodeNumber;         /*!< Specifies the node pool storage node number      */
+
+  DMA_NodeTypeDef                *pFreeNode;         /*!< Specifies the first free node                    */
+
+  __IO uint32_t                  FreeNumber;         /*!< Specifies the free node number                   */
+
+} DMA_NodePoolTypeDef;
 /**
   * @}
   */
@@ -565,6 +580,66 @@ uint32_t HAL_DMAEx_GetFifoLevel(DMA_HandleTypeDef const *const hdma);
   * @}
   */
 
+/** @defgroup DMAEx_Exported_Functions_Group7 Linked-List Node Pool Functions
+  * @brief    Linked-List Node Pool Functions
+  * @{
+  */
+HAL_StatusTypeDef HAL_DMAEx_NodePool_Init(DMA_NodePoolTypeDef *const pPool,
+                                          DMA_NodeTypeDef *const pNodes,
+                                          uint32_t NodeNumber);
+DMA_NodeTypeDef *HAL_DMAEx_NodePool_Alloc(DMA_NodePoolTypeDef *const pPool);
+HAL_StatusTypeDef HAL_DMAEx_NodePool_Free(DMA_NodePoolTypeDef *const pPool,
+                                          DMA_NodeTypeDef *const pNode);
+uint32_t HAL_DMAEx_NodePool_GetFreeNumber(DMA_NodePoolTypeDef const *const pPool);
+
+HAL_StatusTypeDef HAL_DMAEx_List_BuildQ_PingPong(DMA_NodePoolTypeDef *const pPool,
+                                                 DMA_QListTypeDef *const pQList,
+                                                 DMA_NodeConfTypeDef const *const pNodeConfig,
+                                                 uint32_t Buffer0,
+                                                 uint32_t Buffer1,
+                                                 uint32_t Size);
+HAL_StatusTypeDef HAL_DMAEx_List_BuildQ_Scatter(DMA_NodePoolTypeDef *const pPool,
+                                                DMA_QListTypeDef *const pQList,
+                                                DMA_NodeConfTypeDef const *const pNodeConfig,
+                                                uint32_t const *const pAddress,
+                                                uint32_t const *const pSize,
+                                                uint32_t Number);
+HAL_StatusTypeDef HAL_DMAEx_List_BuildQ_Ring(DMA_NodePoolTypeDef *const pPool,
+                                             DMA_QListTypeDef *const pQList,
+                                             DMA_NodeConfTypeDef const *const pNodeConfig,
+                                             uint32_t Buffer,
+                                             uint32_t Size);
+HAL_StatusTypeDef HAL_DMAEx_List_ReleaseQ(DMA_NodePoolTypeDef *const pPool,
+                                          DMA_QListTypeDef *const pQList);
+/**
+  * @}
+  */
+
+/** @defgroup DMAEx_Exported_Functions_Group8 2D Addressing Transfer Functions
+  * @brief    2D Addressing Transfer Functions
+  * @{
+  */
+HAL_StatusTypeDef HAL_DMAEx_Copy2D_IT(DMA_HandleTypeDef *const hdma,
+                                      uint32_t SrcAddress,
+                                      uint32_t SrcPitch,
+                                      uint32_t DstAddress,
+                                      uint32_t DstPitch,
+                                      uint32_t Width,
+                                      uint32_t Height);
+HAL_StatusTypeDef HAL_DMAEx_Transpose_IT(DMA_HandleTypeDef *const hdma,
+                                         uint32_t SrcAddress,
+                                         uint32_t DstAddress,
+                                         uint32_t Rows,
+                                         uint32_t Cols);
+HAL_StatusTypeDef HAL_DMAEx_Deinterleave_IT(DMA_HandleTypeDef *const hdma,
+                                            uint32_t SrcAddress,
+                                            uint32_t DstAddress,
+                                            uint32_t Channels,
+                                            uint32_t Samples);
+/**
+  * @}
+  */
+
 /**
   * @}
   */
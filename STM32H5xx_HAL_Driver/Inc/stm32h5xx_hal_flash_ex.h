@@ -171,6 +171,23 @@ typedef struct
                              This parameter can be a value between 1 and max number of sectors in the bank */
 } FLASH_HDPExtensionTypeDef;
 
+/**
+  * @brief  FLASH dual-bank update structure definition
+  */
+typedef struct
+{
+  uint32_t ImageAddress;  /*!< Address of the image staged in the inactive bank (output).
+                               The staged image can be hashed and authenticated from this address before the swap */
+  uint32_t ImageSize;     /*!< Size of the image, in bytes */
+  uint32_t Bank;          /*!< Inactive bank being updated (output).
+                               This parameter is a value of @ref FLASH_Banks */
+  uint32_t Offset;        /*!< Number of bytes already programmed in the inactive bank */
+  uint32_t State;         /*!< Update state.
+                               This parameter is a value of @ref FLASHEx_BankUpdate_State */
+  uint32_t BufferLevel;   /*!< Number of bytes waiting in QuadWord */
+  uint32_t QuadWord[4];   /*!< Programming buffer, flash is programmed by quad-word */
+} FLASH_BankUpdateTypeDef;
+
 /**
   * @}
   */
@@ -745,6 +762,18 @@ byte configuration */
   * @}
   */
 #endif /* __ARM_FEATURE_CMSE */
+
+/** @defgroup FLASHEx_BankUpdate_State FLASH Dual-Bank Update State
+  * @{
+  */
+#define FLASH_BANKUPDATE_STATE_RESET    0x00000000U   /*!< No update on-going */
+#define FLASH_BANKUPDATE_STATE_ERASE    0x00000001U   /*!< Inactive bank erase on-going */
+#define FLASH_BANKUPDATE_STATE_PROGRAM  0x00000002U   /*!< Image being programmed */
+#define FLASH_BANKUPDATE_STATE_READY    0x00000003U   /*!< Image programmed, banks can be swapped */
+#define FLASH_BANKUPDATE_STATE_ERROR    0x00000004U   /*!< Update aborted on error */
+/**
+  * @}
+  */
 /**
   * @}
   */
@@ -835,6 +864,19 @@ HAL_StatusTypeDef HAL_FLASHEx_ConfigHDPExtension(const FLASH_HDPExtensionTypeDef
   * @}
   */
 
+/** @addtogroup FLASHEx_Exported_Functions_Group3
+  * @{
+  */
+/* Extension dual-bank update functions  *********************************************/
+HAL_StatusTypeDef HAL_FLASHEx_BankUpdate_Start(FLASH_BankUpdateTypeDef *pUpdate, uint32_t ImageSize);
+HAL_StatusTypeDef HAL_FLASHEx_BankUpdate_Write(FLASH_BankUpdateTypeDef *pUpdate, const uint8_t *pData,
+                                               uint32_t Size);
+HAL_StatusTypeDef HAL_FLASHEx_BankUpdate_Finish(FLASH_BankUpdateTypeDef *pUpdate);
+HAL_StatusTypeDef HAL_FLASHEx_BankUpdate_Swap(const FLASH_BankUpdateTypeDef *pUpdate);
+/**
+  * @}
+  */
+
 /**
   * @}
   */
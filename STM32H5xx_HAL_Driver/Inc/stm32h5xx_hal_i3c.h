@@ -369,6 +369,37 @@ typedef struct
   * @}
   */
 
+/** @defgroup I3C_IBIEntryTypeDef_Structure_definition I3C IBIEntryTypeDef Structure definition
+  * @brief    I3C In Band Interrupt queue entry structure definition
+  * @{
+  */
+typedef struct
+{
+  uint8_t            TargetAddr;   /*!< Dynamic address of the target which requested the IBI           */
+  uint8_t            PayloadSize;  /*!< Number of IBI additional data bytes received (0 to 4)            */
+  uint32_t           Payload;      /*!< IBI additional data bytes (little endian)                        */
+
+} I3C_IBIEntryTypeDef;
+/**
+  * @}
+  */
+
+/** @defgroup I3C_BusDeviceTypeDef_Structure_definition I3C BusDeviceTypeDef Structure definition
+  * @brief    I3C bus device table entry structure definition
+  * @{
+  */
+typedef struct
+{
+  uint64_t           PID;          /*!< 48-bit Provisioned ID returned during ENTDAA (first byte received in LSB) */
+  uint8_t            BCR;          /*!< Bus Characteristics Register value returned during ENTDAA                 */
+  uint8_t            DCR;          /*!< Device Characteristics Register value returned during ENTDAA              */
+  uint8_t            DynamicAddr;  /*!< Dynamic address assigned to the target                                    */
+
+} I3C_BusDeviceTypeDef;
+/**
+  * @}
+  */
+
 /** @defgroup I3C_handle_Structure_definition I3C handle Structure definition
   * @brief    I3C handle Structure definition
   * @{
@@ -425,6 +456,17 @@ typedef struct __I3C_HandleTypeDef
 
   void(*ptrRxFunc)(struct __I3C_HandleTypeDef *hi3c);             /*!< I3C receive function pointer              */
 
+  I3C_IBIEntryTypeDef        *pIBIQueue;                          /*!< I3C IBI queue buffer pointer              */
+
+  uint32_t                   IBIQueueSize;                        /*!< I3C IBI queue number of entries           */
+
+  __IO uint32_t              IBIQueueHead;                        /*!< I3C IBI queue write index                 */
+
+  __IO uint32_t              IBIQueueTail;                        /*!< I3C IBI queue read index                  */
+
+  __IO uint32_t              IBIQueueLost;                        /*!< I3C number of IBI dropped because the
+                                                                       IBI queue was full                       */
+
 #if (USE_HAL_I3C_REGISTER_CALLBACKS == 1U)
 
   void (* CtrlTxCpltCallback)(struct __I3C_HandleTypeDef *hi3c);
@@ -1055,6 +1097,9 @@ HAL_StatusTypeDef HAL_I3C_Tgt_Config(I3C_HandleTypeDef *hi3c, const I3C_TgtConfT
 HAL_StatusTypeDef HAL_I3C_Ctrl_ConfigBusDevices(I3C_HandleTypeDef           *hi3c,
                                                 const I3C_DeviceConfTypeDef *pDesc,
                                                 uint8_t                      nbDevice);
+HAL_StatusTypeDef HAL_I3C_Ctrl_ConfigIBIQueue(I3C_HandleTypeDef   *hi3c,
+                                              I3C_IBIEntryTypeDef *pQueue,
+                                              uint32_t             size);
 HAL_StatusTypeDef HAL_I3C_AddDescToFrame(I3C_HandleTypeDef         *hi3c,
                                          const I3C_CCCTypeDef      *pCCCDesc,
                                          const I3C_PrivateTypeDef  *pPrivateDesc,
@@ -1125,6 +1170,15 @@ HAL_StatusTypeDef HAL_I3C_Ctrl_DynAddrAssign(I3C_HandleTypeDef *hi3c,
                                              uint64_t          *target_payload,
                                              uint32_t           dynOption,
                                              uint32_t           timeout);
+HAL_StatusTypeDef HAL_I3C_Ctrl_BusEnumerate(I3C_HandleTypeDef    *hi3c,
+                                            I3C_BusDeviceTypeDef *pDevices,
+                                            uint8_t               maxDevices,
+                                            uint8_t               firstAddr,
+                                            uint8_t              *pNbDevices,
+                                            uint32_t              timeout);
+
+/* Controller In Band Interrupt queue APIs */
+HAL_StatusTypeDef HAL_I3C_Ctrl_GetIBI(I3C_HandleTypeDef *hi3c, I3C_IBIEntryTypeDef *pEntry);
 /**
   * @}
   */
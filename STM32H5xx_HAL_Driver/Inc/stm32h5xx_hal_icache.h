@@ -37,10 +37,10 @@ extern "C" {
   */
 
 /* Exported types -----------------------------------------------------------*/
-#if defined(ICACHE_CRRx_REN)
 /** @defgroup ICACHE_Exported_Types ICACHE Exported Types
   * @{
   */
+#if defined(ICACHE_CRRx_REN)
 
 /**
   * @brief  HAL ICACHE region configuration structure definition
@@ -60,10 +60,35 @@ typedef struct
   uint32_t OutputBurstType;          /*!< Selects the output burst type.
                                           This parameter can be a value of @ref ICACHE_Output_Burst_Type */
 } ICACHE_RegionConfigTypeDef;
+#endif /*  ICACHE_CRRx_REN */
+
+/**
+  * @brief  HAL ICACHE monitor counts of a code region, extended to 64 bits
+  */
+typedef struct
+{
+  uint64_t Hit;                      /*!< Hits counted while the region was selected */
+
+  uint64_t Miss;                     /*!< Misses counted while the region was selected */
+} ICACHE_MonitorCountTypeDef;
+
+/**
+  * @brief  HAL ICACHE monitor sampler structure definition
+  */
+typedef struct
+{
+  ICACHE_MonitorCountTypeDef *pCount;   /*!< Counts of each code region, array owned by the application */
+
+  uint32_t NbRegions;                   /*!< Number of code regions in pCount */
+
+  __IO uint32_t Region;                 /*!< Code region the running counts are attributed to */
+
+  __IO uint32_t Saturated;              /*!< Number of samples where a hardware counter had saturated, the counts
+                                             are then too low: sample more often */
+} ICACHE_MonitorSamplerTypeDef;
 /**
   * @}
   */
-#endif /*  ICACHE_CRRx_REN */
 
 /* Exported constants -------------------------------------------------------*/
 /** @defgroup ICACHE_Exported_Constants ICACHE Exported Constants
@@ -280,6 +305,22 @@ HAL_StatusTypeDef HAL_ICACHE_DisableRemapRegion(uint32_t Region);
   */
 #endif /*  ICACHE_CRRx_REN */
 
+/** @addtogroup ICACHE_Exported_Functions_Group4
+  * @brief    Performance sampling functions
+  * @{
+  */
+/******* Performance sampling functions */
+HAL_StatusTypeDef HAL_ICACHE_Sampler_Start(ICACHE_MonitorSamplerTypeDef *pSampler,
+                                           ICACHE_MonitorCountTypeDef *pCount, uint32_t NbRegions);
+HAL_StatusTypeDef HAL_ICACHE_Sampler_Stop(ICACHE_MonitorSamplerTypeDef *pSampler);
+void HAL_ICACHE_Sampler_Sample(ICACHE_MonitorSamplerTypeDef *pSampler);
+HAL_StatusTypeDef HAL_ICACHE_Sampler_SelectRegion(ICACHE_MonitorSamplerTypeDef *pSampler, uint32_t Region);
+uint32_t HAL_ICACHE_Sampler_GetHitRate(const ICACHE_MonitorCountTypeDef *pCount);
+
+/**
+  * @}
+  */
+
 /**
   * @}
   */
@@ -220,6 +220,11 @@ typedef struct
   __IO  HAL_LPTIM_StateTypeDef   State;            /*!< LPTIM peripheral state    */
 
   __IO  HAL_LPTIM_ChannelStateTypeDef   ChannelState[2];  /*!< LPTIM channel operation state                       */
+
+  uint32_t                       PulseWakeUp;      /*!< Pulses between two wake-ups of the pulse counter,
+                                                        0 when the pulse counter is not running */
+
+  __IO  uint32_t                 PulseWakeUpCount; /*!< Wake-ups of the pulse counter since its start */
 #if (USE_HAL_LPTIM_REGISTER_CALLBACKS == 1)
   void (* MspInitCallback)(struct __LPTIM_HandleTypeDef *hlptim);            /*!< LPTIM Base Msp Init Callback                 */
   void (* MspDeInitCallback)(struct __LPTIM_HandleTypeDef *hlptim);          /*!< LPTIM Base Msp DeInit Callback               */
@@ -1002,6 +1007,24 @@ HAL_LPTIM_StateTypeDef HAL_LPTIM_GetState(const LPTIM_HandleTypeDef *hlptim);
   * @}
   */
 
+/** @addtogroup LPTIM_Exported_Functions_Group6
+  *  @brief   Low power service functions.
+  * @{
+  */
+/* Pulse counter  *************************************************************/
+HAL_StatusTypeDef HAL_LPTIM_PulseCounter_Start_IT(LPTIM_HandleTypeDef *hlptim, uint32_t WakeUpPulses);
+HAL_StatusTypeDef HAL_LPTIM_PulseCounter_Stop_IT(LPTIM_HandleTypeDef *hlptim);
+uint64_t HAL_LPTIM_PulseCounter_GetCount(const LPTIM_HandleTypeDef *hlptim);
+
+/* Sampling trigger  **********************************************************/
+HAL_StatusTypeDef HAL_LPTIM_SamplingTrigger_Start(LPTIM_HandleTypeDef *hlptim, uint32_t Period, uint32_t Pulse);
+HAL_StatusTypeDef HAL_LPTIM_SamplingTrigger_Start_DMA(LPTIM_HandleTypeDef *hlptim, uint32_t Period, uint32_t Pulse,
+                                                      uint32_t SrcAddress, uint32_t DstAddress, uint32_t Length);
+HAL_StatusTypeDef HAL_LPTIM_SamplingTrigger_Stop(LPTIM_HandleTypeDef *hlptim);
+/**
+  * @}
+  */
+
 /**
   * @}
   */
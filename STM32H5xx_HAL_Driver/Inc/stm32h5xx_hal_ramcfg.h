@@ -88,6 +88,21 @@ typedef struct
 #endif  /* USE_HAL_RAMCFG_REGISTER_CALLBACKS */
 } RAMCFG_HandleTypeDef;
 
+/**
+  * @brief  RAMCFG Configuration Structure Definition
+  */
+typedef struct
+{
+  uint32_t ECC;            /*!< Specifies the ECC setting of the SRAM.
+                                This parameter can be a value of @ref RAMCFG_ECC_Setting */
+
+  uint32_t Erase;          /*!< Specifies whether the SRAM is erased by hardware after the ECC setting.
+                                This parameter can be a value of @ref RAMCFG_Erase_Setting */
+
+  uint32_t Notifications;  /*!< Specifies the ECC interrupts enabled after the erase, 0 for none.
+                                This parameter can be a combination of @ref RAMCFG_Interrupt */
+} RAMCFG_ConfigTypeDef;
+
 /**
   * @}
   */
@@ -110,6 +125,28 @@ typedef struct
 #if (USE_HAL_RAMCFG_REGISTER_CALLBACKS == 1)
 #define HAL_RAMCFG_ERROR_INVALID_CALLBACK 0x00000003U  /*!< Invalid Callback error  */
 #endif  /* USE_HAL_RAMCFG_REGISTER_CALLBACKS */
+#define HAL_RAMCFG_ERROR_PARAM            0x00000004U  /*!< RAMCFG Parameter Error  */
+/**
+  * @}
+  */
+
+/** @defgroup RAMCFG_ECC_Setting RAMCFG ECC Setting
+  * @brief    RAMCFG ECC Setting
+  * @{
+  */
+#define RAMCFG_ECC_NO_CHANGE  (0x00U) /*!< ECC mechanism left as configured (option bytes or previous setting) */
+#define RAMCFG_ECC_ENABLE     (0x01U) /*!< ECC mechanism and address latching enabled                          */
+#define RAMCFG_ECC_DISABLE    (0x02U) /*!< ECC mechanism and address latching disabled                         */
+/**
+  * @}
+  */
+
+/** @defgroup RAMCFG_Erase_Setting RAMCFG Erase Setting
+  * @brief    RAMCFG Erase Setting
+  * @{
+  */
+#define RAMCFG_ERASE_DISABLE  (0x00U) /*!< SRAM content kept         */
+#define RAMCFG_ERASE_ENABLE   (0x01U) /*!< SRAM erased by hardware   */
 /**
   * @}
   */
@@ -290,6 +327,15 @@ uint32_t HAL_RAMCFG_GetDoubleErrorAddress(const RAMCFG_HandleTypeDef *hramcfg);
   * @}
   */
 
+/** @defgroup RAMCFG_Exported_Functions_Group3 Configuration Functions
+  * @brief    Configuration Functions
+  * @{
+  */
+HAL_StatusTypeDef HAL_RAMCFG_Config(RAMCFG_HandleTypeDef *hramcfg, const RAMCFG_ConfigTypeDef *pConfig);
+/**
+  * @}
+  */
+
 /** @defgroup RAMCFG_Exported_Functions_Group4 Write Protection Functions
   * @brief    Write Protection Functions
   * @{
@@ -363,6 +409,14 @@ HAL_RAMCFG_StateTypeDef HAL_RAMCFG_GetState(const RAMCFG_HandleTypeDef *hramcfg)
 
 #define IS_RAMCFG_WRITEPROTECTION_PAGE(PAGE)   ((PAGE) <= 64U)
 
+#define IS_RAMCFG_ECC_SETTING(ECC)  \
+  (((ECC) == RAMCFG_ECC_NO_CHANGE) || ((ECC) == RAMCFG_ECC_ENABLE) || ((ECC) == RAMCFG_ECC_DISABLE))
+
+#define IS_RAMCFG_ERASE_SETTING(ERASE)  (((ERASE) == RAMCFG_ERASE_DISABLE) || ((ERASE) == RAMCFG_ERASE_ENABLE))
+
+#define IS_RAMCFG_NOTIFICATIONS(NOTIFICATIONS) \
+  (((NOTIFICATIONS) & ~(RAMCFG_IT_SINGLEERR | RAMCFG_IT_DOUBLEERR | RAMCFG_IT_NMIERR)) == 0U)
+
 
 /**
   * @}
@@ -778,6 +778,8 @@ HAL_StatusTypeDef HAL_RTC_SetTime(RTC_HandleTypeDef *hrtc, RTC_TimeTypeDef *sTim
 HAL_StatusTypeDef HAL_RTC_GetTime(const RTC_HandleTypeDef *hrtc, RTC_TimeTypeDef *sTime, uint32_t Format);
 HAL_StatusTypeDef HAL_RTC_SetDate(RTC_HandleTypeDef *hrtc, RTC_DateTypeDef *sDate, uint32_t Format);
 HAL_StatusTypeDef HAL_RTC_GetDate(const RTC_HandleTypeDef *hrtc, RTC_DateTypeDef *sDate, uint32_t Format);
+uint64_t          HAL_RTC_GetTimestamp(const RTC_HandleTypeDef *hrtc);
+uint32_t          HAL_RTC_GetTimestampFrequency(const RTC_HandleTypeDef *hrtc);
 void              HAL_RTC_DST_Add1Hour(const RTC_HandleTypeDef *hrtc);
 void              HAL_RTC_DST_Sub1Hour(const RTC_HandleTypeDef *hrtc);
 void              HAL_RTC_DST_SetStoreOperation(const RTC_HandleTypeDef *hrtc);
@@ -216,6 +216,22 @@ typedef uint32_t HAL_UART_RxTypeTypeDef;
   */
 typedef uint32_t HAL_UART_RxEventTypeTypeDef;
 
+/**
+  * @brief  UART Tx fragment structure definition, one entry of a scatter-gather transmit list
+  */
+typedef struct
+{
+  const uint8_t            *pData;                   /*!< Pointer to the fragment data                          */
+
+  uint16_t                 Size;                     /*!< Amount of data elements (u8 or u16) to be sent        */
+
+#if defined(HAL_DMA_MODULE_ENABLED)
+  DMA_NodeTypeDef          Node;                     /*!< Linked-list node storage, filled by the driver when
+                                                          the Tx DMA channel is in linked-list mode             */
+
+#endif /* HAL_DMA_MODULE_ENABLED */
+} UART_TxFragmentTypeDef;
+
 /**
   * @brief  UART handle Structure definition
   */
@@ -273,6 +289,17 @@ typedef struct __UART_HandleTypeDef
 
   __IO uint32_t                 ErrorCode;           /*!< UART Error code                    */
 
+  UART_TxFragmentTypeDef        *pTxFrag;            /*!< Next fragment of an ongoing scatter-gather transmission */
+
+  __IO uint32_t                 TxFragCount;         /*!< Number of fragments left to chain after the current one */
+
+#if defined(HAL_DMA_MODULE_ENABLED)
+  DMA_QListTypeDef              TxFragQueue;         /*!< Linked-list queue built from the fragment list     */
+
+  DMA_QListTypeDef              *pTxSavedQueue;      /*!< Tx DMA queue to restore once the fragment list is sent */
+
+#endif /* HAL_DMA_MODULE_ENABLED */
+
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
   void (* TxHalfCpltCallback)(struct __UART_HandleTypeDef *huart);        /*!< UART Tx Half Complete Callback        */
   void (* TxCpltCallback)(struct __UART_HandleTypeDef *huart);            /*!< UART Tx Complete Callback             */
@@ -1665,6 +1692,7 @@ HAL_StatusTypeDef HAL_UART_Transmit_IT(UART_HandleTypeDef *huart, const uint8_t
 HAL_StatusTypeDef HAL_UART_Receive_IT(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size);
 #if defined(HAL_DMA_MODULE_ENABLED)
 HAL_StatusTypeDef HAL_UART_Transmit_DMA(UART_HandleTypeDef *huart, const uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_UARTEx_TransmitV_DMA(UART_HandleTypeDef *huart, UART_TxFragmentTypeDef *pFrags, uint32_t NbFrags);
 HAL_StatusTypeDef HAL_UART_Receive_DMA(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size);
 HAL_StatusTypeDef HAL_UART_DMAPause(UART_HandleTypeDef *huart);
 HAL_StatusTypeDef HAL_UART_DMAResume(UART_HandleTypeDef *huart);
@@ -243,6 +243,52 @@ typedef struct
                                            This parameter can be any value between 0 and 0xFFFFU */
 } XSPI_MemoryMappedTypeDef;
 
+/**
+  * @brief  HAL XSPI RAM memory-mapped profile structure definition
+  */
+typedef struct
+{
+  uint32_t KernelClockFreq;           /*!< XSPI kernel clock frequency in Hz */
+  uint32_t MaxClockFreq;              /*!< Maximum clock frequency of the memory in Hz, for the configured latency */
+  uint32_t MaxChipSelectLowTime;      /*!< Maximum chip select low time of the memory in ns (tCSM/tCEM), so that it
+                                           can refresh. 0 if the memory has no such limit */
+  uint32_t PageSize;                  /*!< Page (row) size of the memory in bytes, a bursts never crosses it.
+                                           This parameter can be 0 (no boundary) or a power of 2 */
+  uint32_t WrapSize;                  /*!< Wrap size configured in the memory for the wrapped reads.
+                                           This parameter can be a value of @ref XSPI_WrapSize */
+  uint32_t ReadLatencyCycle;          /*!< AP Memory : dummy cycles of the read command.
+                                           Hyperbus : access time cycles (initial latency).
+                                           This parameter can be a value between 0 and 31U (255U for Hyperbus) */
+  uint32_t WriteLatencyCycle;         /*!< AP Memory : dummy cycles of the write command. Unused for Hyperbus, the
+                                           write latency being the access time.
+                                           This parameter can be a value between 0 and 31U */
+  uint32_t RWRecoveryTimeCycle;       /*!< Hyperbus : read write recovery time cycles. Unused for AP Memory.
+                                           This parameter can be a value between 0 and 255U */
+  uint32_t LatencyMode;               /*!< Hyperbus : latency mode. Unused for AP Memory.
+                                           This parameter can be a value of @ref XSPI_LatencyMode */
+  uint32_t ReadInstruction;           /*!< AP Memory : read instruction, e.g. HAL_XSPI_APMEM_READ_LINEAR_BURST */
+  uint32_t WriteInstruction;          /*!< AP Memory : write instruction, e.g. HAL_XSPI_APMEM_WRITE_LINEAR_BURST */
+  uint32_t WrapInstruction;           /*!< AP Memory : instruction of the wrapped reads, used when WrapSize is not
+                                           HAL_XSPI_WRAP_NOT_SUPPORTED, e.g. HAL_XSPI_APMEM_READ */
+  uint32_t TimeoutPeriodClock;        /*!< Number of clock cycles the chip select remains low once the prefetch
+                                           FIFO is full. 0 keeps the chip select low until the next refresh.
+                                           This parameter can be any value between 0 and 0xFFFFU */
+} XSPI_RamProfileTypeDef;
+
+/**
+  * @brief  HAL XSPI RAM benchmark results returned by HAL_XSPI_RAM_Benchmark()
+  */
+typedef struct
+{
+  uint32_t WriteCycles;               /*!< CPU cycles of the sequential write of the area            */
+  uint32_t WriteBandwidth;            /*!< Sequential write bandwidth in bytes per second            */
+  uint32_t ReadCycles;                /*!< CPU cycles of the sequential read of the area             */
+  uint32_t ReadBandwidth;             /*!< Sequential read bandwidth in bytes per second             */
+  uint32_t ReadLatencyCycles;         /*!< Average CPU cycles of a random single word read           */
+  uint32_t ReadLatencyNs;             /*!< Average duration of a random single word read in ns       */
+  uint32_t Errors;                    /*!< Number of words read back different from the written ones */
+} XSPI_RamBenchmarkTypeDef;
+
 #if defined(USE_HAL_XSPI_REGISTER_CALLBACKS) && (USE_HAL_XSPI_REGISTER_CALLBACKS == 1U)
 /**
   * @brief  HAL XSPI Callback ID enumeration definition
@@ -717,6 +763,25 @@ typedef void (*pXSPI_CallbackTypeDef)(XSPI_HandleTypeDef *hxspi);
   * @}
   */
 
+/** @defgroup XSPI_APMemory_Instructions XSPI AP Memory Instructions
+  * @{
+  */
+#define HAL_XSPI_APMEM_READ                  (0x00U)  /*!< Synchronous read, wrapped on the burst length        */
+#define HAL_XSPI_APMEM_WRITE                 (0x80U)  /*!< Synchronous write, wrapped on the burst length       */
+#define HAL_XSPI_APMEM_READ_LINEAR_BURST     (0x20U)  /*!< Linear burst read, wraps on the whole device         */
+#define HAL_XSPI_APMEM_WRITE_LINEAR_BURST    (0xA0U)  /*!< Linear burst write, wraps on the whole device        */
+/**
+  * @}
+  */
+
+/** @defgroup XSPI_RAM_Benchmark XSPI RAM Benchmark
+  * @{
+  */
+#define HAL_XSPI_RAM_BENCHMARK_READS         (256U)   /*!< Number of random reads of the latency measurement */
+/**
+  * @}
+  */
+
 /**
   * @}
   */
@@ -935,6 +1000,20 @@ HAL_StatusTypeDef      HAL_XSPI_DLYB_GetClockPeriod(XSPI_HandleTypeDef *hxspi,
   * @}
   */
 
+/* XSPI RAM memory-mapped functions  ******************************************/
+/** @addtogroup XSPI_Exported_Functions_Group5
+  * @{
+  */
+
+HAL_StatusTypeDef      HAL_XSPI_RAM_MemoryMapped(XSPI_HandleTypeDef *hxspi, const XSPI_RamProfileTypeDef *pProfile,
+                                                 uint32_t Timeout);
+HAL_StatusTypeDef      HAL_XSPI_RAM_Benchmark(XSPI_HandleTypeDef *hxspi, uint32_t Offset, uint32_t Size,
+                                              XSPI_RamBenchmarkTypeDef *pResult);
+
+/**
+  * @}
+  */
+
 /**
   * @}
   */
@@ -63,6 +63,17 @@
     [..]  Use HAL_DCACHE_GetState() function to return the DCACHE state and HAL_DCACHE_GetError()
           in case of error detection.
 
+     *** Performance sampling ***
+     ============================
+    [..]
+        (+) Use HAL_DCACHE_Sampler_Start() with an array of DCACHE_MonitorCountTypeDef,
+            one per code region, to reset and start the four monitors.
+        (+) Use HAL_DCACHE_Sampler_SelectRegion() when the execution enters another code
+            region: the counts are attributed to the region selected when they occur.
+        (+) Call HAL_DCACHE_Sampler_Sample() periodically, well before 2^32 accesses, to
+            accumulate the saturating hardware counters on 64 bits.
+        (+) Use HAL_DCACHE_Sampler_Stop() to accumulate the last counts and stop the monitors.
+
      *** DCACHE HAL driver macros list ***
      =============================================
      [..]
@@ -943,6 +954,135 @@ uint32_t HAL_DCACHE_Monitor_GetWriteMissValue(const DCACHE_HandleTypeDef *hdcach
   return hdcache->Instance->WMMONR;
 }
 
+/**
+  * @brief  Start sampling the Data Cache read and write Hit and Miss monitors.
+  * @param  hdcache   Pointer to a DCACHE_HandleTypeDef structure that contains
+  *                   the configuration information for the specified DCACHEx peripheral.
+  * @param  pSampler  Pointer to the sampler structure, owned by the application
+  * @param  pCount    Pointer to an array of counts, one per code region
+  * @param  NbRegions Number of code regions, at least 1
+  * @note   The counts are cleared, the monitors are reset and started,
+  *         and the region 0 is selected.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DCACHE_Sampler_Start(DCACHE_HandleTypeDef *hdcache, DCACHE_MonitorSamplerTypeDef *pSampler,
+                                           DCACHE_MonitorCountTypeDef *pCount, uint32_t NbRegions)
+{
+  uint32_t region;
+
+  if ((hdcache == NULL) || (pSampler == NULL) || (pCount == NULL) || (NbRegions == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  for (region = 0U; region < NbRegions; region++)
+  {
+    pCount[region].ReadHit   = 0U;
+    pCount[region].ReadMiss  = 0U;
+    pCount[region].WriteHit  = 0U;
+    pCount[region].WriteMiss = 0U;
+  }
+
+  pSampler->hdcache   = hdcache;
+  pSampler->pCount    = pCount;
+  pSampler->NbRegions = NbRegions;
+  pSampler->Region    = 0U;
+  pSampler->Saturated = 0U;
+
+  (void)HAL_DCACHE_Monitor_Reset(hdcache, DCACHE_MONITOR_ALL);
+
+  return HAL_DCACHE_Monitor_Start(hdcache, DCACHE_MONITOR_ALL);
+}
+
+/**
+  * @brief  Stop sampling the Data Cache monitors.
+  * @param  pSampler  Pointer to the sampler structure
+  * @note   The last counts are accumulated before the monitors are stopped.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DCACHE_Sampler_Stop(DCACHE_MonitorSamplerTypeDef *pSampler)
+{
+  if (pSampler == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  HAL_DCACHE_Sampler_Sample(pSampler);
+
+  return HAL_DCACHE_Monitor_Stop(pSampler->hdcache, DCACHE_MONITOR_ALL);
+}
+
+/**
+  * @brief  Accumulate the Data Cache monitors to the selected code region.
+  * @param  pSampler  Pointer to the sampler structure
+  * @note   The monitors are read and reset with interrupts masked, so that this
+  *         function may be called from both thread and interrupt contexts.
+  * @retval None
+  */
+void HAL_DCACHE_Sampler_Sample(DCACHE_MonitorSamplerTypeDef *pSampler)
+{
+  DCACHE_TypeDef *instance = pSampler->hdcache->Instance;
+  DCACHE_MonitorCountTypeDef *pcount;
+  uint32_t primask;
+  uint32_t readhit;
+  uint32_t readmiss;
+  uint32_t writehit;
+  uint32_t writemiss;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  readhit   = instance->RHMONR;
+  readmiss  = instance->RMMONR;
+  writehit  = instance->WHMONR;
+  writemiss = instance->WMMONR;
+
+  /* Force/Release reset */
+  SET_BIT(instance->CR, (DCACHE_MONITOR_ALL << 2U));
+  CLEAR_BIT(instance->CR, (DCACHE_MONITOR_ALL << 2U));
+
+  pcount = &pSampler->pCount[pSampler->Region];
+  pcount->ReadHit   += readhit;
+  pcount->ReadMiss  += readmiss;
+  pcount->WriteHit  += writehit;
+  pcount->WriteMiss += writemiss;
+
+  if ((readhit == 0xFFFFFFFFU) || (readmiss == 0xFFFFFFFFU) ||
+      (writehit == 0xFFFFFFFFU) || (writemiss == 0xFFFFFFFFU))
+  {
+    pSampler->Saturated++;
+  }
+
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Select the code region the next Data Cache counts are attributed to.
+  * @param  pSampler  Pointer to the sampler structure
+  * @param  Region    Code region index, lower than the number of regions
+  * @note   The counts of the previous region are accumulated first.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DCACHE_Sampler_SelectRegion(DCACHE_MonitorSamplerTypeDef *pSampler, uint32_t Region)
+{
+  uint32_t primask;
+
+  if ((pSampler == NULL) || (Region >= pSampler->NbRegions))
+  {
+    return HAL_ERROR;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  HAL_DCACHE_Sampler_Sample(pSampler);
+  pSampler->Region = Region;
+
+  __set_PRIMASK(primask);
+
+  return HAL_OK;
+}
+
 /**
   * @brief Handle the Data Cache interrupt request.
   * @param  hdcache Pointer to a DCACHE_HandleTypeDef structure that contains
@@ -705,6 +705,43 @@ HAL_StatusTypeDef HAL_DMA_Abort_IT(DMA_HandleTypeDef *const hdma)
   return HAL_OK;
 }
 
+/**
+  * @brief  Aborts the DMA transfer started by HAL_DMA_Direct_Start().
+  * @note   An enabled channel is suspended, the function waits for the suspension
+  *         then resets the channel, which also disables it. A channel already
+  *         disabled is only reset. No lock and no handle state update are done.
+  * @param  hdma  pointer to a DMA_HandleTypeDef structure that contains
+  *               the configuration information for the specified DMA Channel.
+  * @retval HAL status, HAL_TIMEOUT if the channel is not suspended after
+  *         HAL_TIMEOUT_DMA_ABORT, the channel is then left as is
+  */
+HAL_StatusTypeDef HAL_DMA_Direct_Abort(DMA_HandleTypeDef *hdma)
+{
+  uint32_t tickstart;
+
+  /* SUSPF is never set on a channel which is not enabled */
+  if ((hdma->Instance->CCR & DMA_CCR_EN) != 0U)
+  {
+    tickstart = HAL_GetTick();
+
+    hdma->Instance->CCR |= DMA_CCR_SUSP;
+
+    /* Check for the suspension */
+    while ((hdma->Instance->CSR & DMA_CSR_SUSPF) == 0U)
+    {
+      /* Check for the Timeout */
+      if ((HAL_GetTick() - tickstart) > HAL_TIMEOUT_DMA_ABORT)
+      {
+        return HAL_TIMEOUT;
+      }
+    }
+  }
+
+  hdma->Instance->CCR |= DMA_CCR_RESET;
+
+  return HAL_OK;
+}
+
 /**
   * @brief  Polling for transfer status (Blocking mode).
   * @param  hdma          : Pointer to a DMA_HandleTypeDef structure that contains the configuration information for the
@@ -501,6 +501,40 @@
 
           (+) Use HAL_DMAEx_Resume() to resume a suspended DMA channel transfer execution.
 
+    *** Linked-list node pool ***
+    ==============================
+    [..]
+      The linked-list queue functions leave the node memory to the application. A node pool provides fixed-size node
+      allocation without heap, so that drivers can build and recycle queues at runtime.
+
+          (+) Use HAL_DMAEx_NodePool_Init() to initialize a node pool over an application array of nodes.
+
+          (+) Use HAL_DMAEx_NodePool_Alloc() and HAL_DMAEx_NodePool_Free() to allocate and free single nodes.
+
+          (+) Use HAL_DMAEx_List_BuildQ_PingPong(), HAL_DMAEx_List_BuildQ_Scatter() or HAL_DMAEx_List_BuildQ_Ring() to
+              build a ready to link queue from a node template.
+
+          (+) Use HAL_DMAEx_List_ReleaseQ() to give all queue nodes back to the node pool once the queue is unlinked.
+
+    *** 2D addressing transfers ***
+    ===============================
+    [..]
+      The channels supporting 2 dimensions addressing can perform memory layout transformations without CPU. The
+      following functions compute and apply the repeated block configuration, then start the transfer in interrupt
+      mode. The channel must be initialized in memory to memory direction, with source and destination incremented,
+      normal mode and DMA_TCEM_REPEATED_BLOCK_TRANSFER event mode, so that one transfer complete callback is issued
+      at the end of the whole 2D transfer.
+
+          (+) Use HAL_DMAEx_Copy2D_IT() to copy a rectangle of Width bytes by Height lines between two buffers of
+              different pitches (image sub-rectangle copy, memcpy2d).
+
+          (+) Use HAL_DMAEx_Transpose_IT() to transpose a row-major matrix of elements of the channel data width. The
+              source and destination burst lengths must be 1.
+
+          (+) Use HAL_DMAEx_Deinterleave_IT() to convert an interleaved multi-channel sample buffer (for example an
+              ADC scan sequence) into one contiguous buffer per channel. The source and destination burst lengths
+              must be 1.
+
     *** FIFO status ***
     ===================
     [..]
@@ -570,6 +604,18 @@ static void DMA_List_FormatNode(DMA_NodeTypeDef *const pNode,
 static void DMA_List_ClearUnusedFields(DMA_NodeTypeDef *const pNode,
                                        uint32_t FirstUnusedField);
 static void DMA_List_CleanQueue(DMA_QListTypeDef *const pQList);
+static HAL_StatusTypeDef DMA_List_BuildPoolQ(DMA_NodePoolTypeDef *const pPool,
+                                             DMA_QListTypeDef *const pQList,
+                                             DMA_NodeConfTypeDef const *const pNodeConfig,
+                                             uint32_t const *const pAddress,
+                                             uint32_t const *const pSize,
+                                             uint32_t Number,
+                                             uint32_t Circular);
+static HAL_StatusTypeDef DMA_Start2D(DMA_HandleTypeDef *const hdma,
+                                     uint32_t SrcAddress,
+                                     uint32_t DstAddress,
+                                     uint32_t BlockSize,
+                                     DMA_RepeatBlockConfTypeDef const *const pConfigRepeatBlock);
 
 /* Exported functions ------------------------------------------------------------------------------------------------*/
 
@@ -3640,6 +3686,470 @@ uint32_t HAL_DMAEx_GetFifoLevel(DMA_HandleTypeDef const *const hdma)
   * @}
   */
 
+/** @addtogroup DMAEx_Exported_Functions_Group7
+  *
+@verbatim
+  ======================================================================================================================
+                          ############### Linked-List Node Pool Functions ###############
+  ======================================================================================================================
+    [..]
+      This section provides functions allowing to :
+      (+) Initialize a linked-list node pool.
+      (+) Allocate and free linked-list nodes from a node pool.
+      (+) Build common linked-list queue patterns from a node pool.
+      (+) Release all linked-list queue nodes to a node pool.
+
+    [..]
+      (+) The HAL_DMAEx_NodePool_Init() function allows to initialize a node pool over an application array of
+          DMA_NodeTypeDef. The array can be placed in any SRAM region addressable by the DMA channel (for example with
+          a linker section attribute) and must not cross a 64 KByte boundary.
+
+      (+) The HAL_DMAEx_NodePool_Alloc() and HAL_DMAEx_NodePool_Free() functions allow to allocate (respectively
+          free) one node in constant time. Both can be called from thread and interrupt context.
+
+      (+) The HAL_DMAEx_NodePool_GetFreeNumber() function allows to get the number of free nodes of a node pool.
+
+      (+) The HAL_DMAEx_List_BuildQ_PingPong() function allows to build a circular two nodes queue alternating
+          between two memory buffers. The TC event is generated at the end of each buffer.
+
+      (+) The HAL_DMAEx_List_BuildQ_Scatter() function allows to build a linear queue of N nodes, one per memory
+          buffer.
+
+      (+) The HAL_DMAEx_List_BuildQ_Ring() function allows to build a circular one node queue over a memory ring
+          buffer. The HT and TC events are generated at the half and at the end of the buffer.
+
+      (+) The HAL_DMAEx_List_ReleaseQ() function allows to remove all nodes of a queue and free them to the node pool.
+
+    [..]
+      The queue patterns use the node configuration given as template for all the queue nodes, only the memory
+      address and the data size are set per node. The memory side is the destination for peripheral to memory
+      transfers and the source otherwise. Circular queues must be linked to a DMA channel initialized in
+      DMA_LINKEDLIST_CIRCULAR mode.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Initialize a linked-list node pool over the given node array.
+  * @param  pPool      : Pointer to a DMA_NodePoolTypeDef structure that contains node pool information.
+  * @param  pNodes     : Pointer to the DMA_NodeTypeDef array used as node storage.
+  * @param  NodeNumber : Number of nodes of the array.
+  * @note   The node array address should be 32bit aligned and the whole array should not exceed the 64 KByte
+  *         addressable space.
+  * @retval HAL status.
+  */
+HAL_StatusTypeDef HAL_DMAEx_NodePool_Init(DMA_NodePoolTypeDef *const pPool,
+                                          DMA_NodeTypeDef *const pNodes,
+                                          uint32_t NodeNumber)
+{
+  uint32_t idx;
+
+  /* Check the node pool and node array parameters */
+  if ((pPool == NULL) || (pNodes == NULL) || (NodeNumber == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check node array alignment and addressable space */
+  if ((((uint32_t)pNodes & 0x3U) != 0U) ||
+      (((uint32_t)pNodes & DMA_CLBAR_LBA) != (((uint32_t)&pNodes[NodeNumber] - 1U) & DMA_CLBAR_LBA)))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Chain all nodes in the free list, the link is kept in the first node register */
+  for (idx = 0U; idx < (NodeNumber - 1U); idx++)
+  {
+    pNodes[idx].LinkRegisters[0U] = (uint32_t)&pNodes[idx + 1U];
+  }
+  pNodes[NodeNumber - 1U].LinkRegisters[0U] = 0U;
+
+  /* Update the node pool information */
+  pPool->pNodes     = pNodes;
+  pPool->NodeNumber = NodeNumber;
+  pPool->pFreeNode  = pNodes;
+  pPool->FreeNumber = NodeNumber;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Allocate one node from a linked-list node pool.
+  * @param  pPool : Pointer to a DMA_NodePoolTypeDef structure that contains node pool information.
+  * @note   This function can be called from interrupt context.
+  * @retval Pointer to the allocated node, NULL when the node pool is empty.
+  */
+DMA_NodeTypeDef *HAL_DMAEx_NodePool_Alloc(DMA_NodePoolTypeDef *const pPool)
+{
+  DMA_NodeTypeDef *pNode;
+  uint32_t primask;
+
+  /* Check the node pool parameter */
+  if (pPool == NULL)
+  {
+    return NULL;
+  }
+
+  /* Enter critical section */
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  pNode = pPool->pFreeNode;
+  if (pNode != NULL)
+  {
+    pPool->pFreeNode = (DMA_NodeTypeDef *)pNode->LinkRegisters[0U];
+    pPool->FreeNumber--;
+  }
+
+  /* Exit critical section */
+  __set_PRIMASK(primask);
+
+  if (pNode != NULL)
+  {
+    /* Clear the free list link and the node information */
+    pNode->LinkRegisters[0U] = 0U;
+    pNode->NodeInfo = 0U;
+  }
+
+  return pNode;
+}
+
+/**
+  * @brief  Free one node to a linked-list node pool.
+  * @param  pPool : Pointer to a DMA_NodePoolTypeDef structure that contains node pool information.
+  * @param  pNode : Pointer to a DMA_NodeTypeDef structure previously allocated from the same node pool.
+  * @note   This function can be called from interrupt context.
+  * @note   The node must not be part of a queue anymore.
+  * @retval HAL status.
+  */
+HAL_StatusTypeDef HAL_DMAEx_NodePool_Free(DMA_NodePoolTypeDef *const pPool,
+                                          DMA_NodeTypeDef *const pNode)
+{
+  uint32_t offset;
+  uint32_t primask;
+
+  /* Check the node pool and node parameters */
+  if ((pPool == NULL) || (pNode == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the node belongs to the node pool */
+  offset = (uint32_t)pNode - (uint32_t)pPool->pNodes;
+  if (((uint32_t)pNode < (uint32_t)pPool->pNodes) || (offset >= (pPool->NodeNumber * sizeof(DMA_NodeTypeDef))) ||
+      ((offset % sizeof(DMA_NodeTypeDef)) != 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Enter critical section */
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  pNode->LinkRegisters[0U] = (uint32_t)pPool->pFreeNode;
+  pPool->pFreeNode = pNode;
+  pPool->FreeNumber++;
+
+  /* Exit critical section */
+  __set_PRIMASK(primask);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Get the number of free nodes of a linked-list node pool.
+  * @param  pPool : Pointer to a DMA_NodePoolTypeDef structure that contains node pool information.
+  * @retval Number of free nodes.
+  */
+uint32_t HAL_DMAEx_NodePool_GetFreeNumber(DMA_NodePoolTypeDef const *const pPool)
+{
+  return pPool->FreeNumber;
+}
+
+/**
+  * @brief  Build a circular ping-pong linked-list queue from a node pool.
+  * @param  pPool       : Pointer to a DMA_NodePoolTypeDef structure that contains node pool information.
+  * @param  pQList      : Pointer to an empty DMA_QListTypeDef structure.
+  * @param  pNodeConfig : Pointer to a DMA_NodeConfTypeDef structure used as template for the queue nodes.
+  * @param  Buffer0     : First memory buffer address.
+  * @param  Buffer1     : Second memory buffer address.
+  * @param  Size        : Size of each memory buffer in bytes.
+  * @retval HAL status.
+  */
+HAL_StatusTypeDef HAL_DMAEx_List_BuildQ_PingPong(DMA_NodePoolTypeDef *const pPool,
+                                                 DMA_QListTypeDef *const pQList,
+                                                 DMA_NodeConfTypeDef const *const pNodeConfig,
+                                                 uint32_t Buffer0,
+                                                 uint32_t Buffer1,
+                                                 uint32_t Size)
+{
+  uint32_t address[2U];
+  uint32_t size[2U];
+
+  address[0U] = Buffer0;
+  address[1U] = Buffer1;
+  size[0U] = Size;
+  size[1U] = Size;
+
+  return DMA_List_BuildPoolQ(pPool, pQList, pNodeConfig, address, size, 2U, 1U);
+}
+
+/**
+  * @brief  Build a linear N-way scatter linked-list queue from a node pool.
+  * @param  pPool       : Pointer to a DMA_NodePoolTypeDef structure that contains node pool information.
+  * @param  pQList      : Pointer to an empty DMA_QListTypeDef structure.
+  * @param  pNodeConfig : Pointer to a DMA_NodeConfTypeDef structure used as template for the queue nodes.
+  * @param  pAddress    : Pointer to the memory buffer address array.
+  * @param  pSize       : Pointer to the memory buffer size array, sizes in bytes.
+  * @param  Number      : Number of memory buffers.
+  * @retval HAL status.
+  */
+HAL_StatusTypeDef HAL_DMAEx_List_BuildQ_Scatter(DMA_NodePoolTypeDef *const pPool,
+                                                DMA_QListTypeDef *const pQList,
+                                                DMA_NodeConfTypeDef const *const pNodeConfig,
+                                                uint32_t const *const pAddress,
+                                                uint32_t const *const pSize,
+                                                uint32_t Number)
+{
+  /* Check the memory buffer parameters */
+  if ((pAddress == NULL) || (pSize == NULL) || (Number == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  return DMA_List_BuildPoolQ(pPool, pQList, pNodeConfig, pAddress, pSize, Number, 0U);
+}
+
+/**
+  * @brief  Build a circular peripheral to ring buffer linked-list queue from a node pool.
+  * @param  pPool       : Pointer to a DMA_NodePoolTypeDef structure that contains node pool information.
+  * @param  pQList      : Pointer to an empty DMA_QListTypeDef structure.
+  * @param  pNodeConfig : Pointer to a DMA_NodeConfTypeDef structure used as template for the queue node.
+  * @param  Buffer      : Ring buffer address.
+  * @param  Size        : Ring buffer size in bytes.
+  * @retval HAL status.
+  */
+HAL_StatusTypeDef HAL_DMAEx_List_BuildQ_Ring(DMA_NodePoolTypeDef *const pPool,
+                                             DMA_QListTypeDef *const pQList,
+                                             DMA_NodeConfTypeDef const *const pNodeConfig,
+                                             uint32_t Buffer,
+                                             uint32_t Size)
+{
+  return DMA_List_BuildPoolQ(pPool, pQList, pNodeConfig, &Buffer, &Size, 1U, 1U);
+}
+
+/**
+  * @brief  Remove all nodes of a linked-list queue and free them to a node pool.
+  * @param  pPool  : Pointer to a DMA_NodePoolTypeDef structure that contains node pool information.
+  * @param  pQList : Pointer to a DMA_QListTypeDef structure that contains queue information.
+  * @note   The queue must not be executed by a DMA channel.
+  * @retval HAL status.
+  */
+HAL_StatusTypeDef HAL_DMAEx_List_ReleaseQ(DMA_NodePoolTypeDef *const pPool,
+                                          DMA_QListTypeDef *const pQList)
+{
+  DMA_NodeTypeDef *pNode;
+
+  /* Check the node pool and queue parameters */
+  if ((pPool == NULL) || (pQList == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Nodes can be removed only from static queue */
+  if (pQList->Type == QUEUE_TYPE_DYNAMIC)
+  {
+    if (HAL_DMAEx_List_ConvertQToStatic(pQList) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  /* Remove and free queue nodes from the head */
+  while (pQList->Head != NULL)
+  {
+    pNode = pQList->Head;
+
+    if (HAL_DMAEx_List_RemoveNode_Head(pQList) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+
+    if (HAL_DMAEx_NodePool_Free(pPool, pNode) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  return HAL_OK;
+}
+/**
+  * @}
+  */
+
+/** @addtogroup DMAEx_Exported_Functions_Group8
+  *
+@verbatim
+  ======================================================================================================================
+                            ############### 2D Addressing Transfer Functions ###############
+  ======================================================================================================================
+    [..]
+      This section provides functions allowing to :
+      (+) Copy a rectangle between two buffers of different pitches.
+      (+) Transpose a matrix.
+      (+) De-interleave a multi-channel sample buffer.
+
+    [..]
+      (+) The HAL_DMAEx_Copy2D_IT() function allows to copy Height lines of Width bytes. One block is transferred
+          per line, the block address offsets skipping the end of the source and destination lines.
+
+      (+) The HAL_DMAEx_Transpose_IT() function allows to transpose a matrix of Rows x Cols elements into a matrix of
+          Cols x Rows elements. One block is transferred per destination line, the source being read by column with
+          the single address offset and rewound to the next column with the block address offset.
+
+      (+) The HAL_DMAEx_Deinterleave_IT() function allows to convert a buffer of Samples frames of Channels
+          interleaved elements into Channels planar buffers of Samples elements, placed one after the other at the
+          destination address. It is a transposition of the frames.
+
+    [..]
+      The element size is the channel data width. The transfer sizes are limited by the repeated block registers :
+      at most 2048 blocks of at most 65535 bytes, single address offsets below 8192 bytes and block address offsets
+      below 65536 bytes. The functions return HAL_ERROR with HAL_DMA_ERROR_NOT_SUPPORTED error code when the channel
+      or its initialization does not allow the requested transfer.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Copy a rectangle of Width bytes by Height lines between two buffers of different pitches in interrupt
+  *         mode.
+  * @param  hdma       : Pointer to a DMA_HandleTypeDef structure that contains the configuration information for the
+  *                      specified DMA Channel.
+  * @param  SrcAddress : Address of the first byte of the rectangle in the source buffer.
+  * @param  SrcPitch   : Distance in bytes between two lines of the source buffer.
+  * @param  DstAddress : Address of the first byte of the rectangle in the destination buffer.
+  * @param  DstPitch   : Distance in bytes between two lines of the destination buffer.
+  * @param  Width      : Line length in bytes, multiple of the channel data width.
+  * @param  Height     : Number of lines, from 1 to 2048.
+  * @retval HAL status.
+  */
+HAL_StatusTypeDef HAL_DMAEx_Copy2D_IT(DMA_HandleTypeDef *const hdma,
+                                      uint32_t SrcAddress,
+                                      uint32_t SrcPitch,
+                                      uint32_t DstAddress,
+                                      uint32_t DstPitch,
+                                      uint32_t Width,
+                                      uint32_t Height)
+{
+  DMA_RepeatBlockConfTypeDef repeatblock;
+
+  /* Check the DMA peripheral handle */
+  if (hdma == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the rectangle geometry */
+  if ((!IS_DMA_BLOCK_SIZE(Width)) || (!IS_DMA_REPEAT_COUNT(Height)) || (SrcPitch < Width) || (DstPitch < Width) ||
+      ((SrcPitch - Width) >= (uint32_t)DMA_BLOCK_ADDR_OFFSET_MAX) ||
+      ((DstPitch - Width) >= (uint32_t)DMA_BLOCK_ADDR_OFFSET_MAX))
+  {
+    /* Update the DMA channel error code */
+    hdma->ErrorCode = HAL_DMA_ERROR_NOT_SUPPORTED;
+
+    return HAL_ERROR;
+  }
+
+  /* One block per line, skip the end of the lines after each block */
+  repeatblock.RepeatCount       = Height;
+  repeatblock.SrcAddrOffset     = 0;
+  repeatblock.DestAddrOffset    = 0;
+  repeatblock.BlkSrcAddrOffset  = (int32_t)(SrcPitch - Width);
+  repeatblock.BlkDestAddrOffset = (int32_t)(DstPitch - Width);
+
+  return DMA_Start2D(hdma, SrcAddress, DstAddress, Width, &repeatblock);
+}
+
+/**
+  * @brief  Transpose a row-major matrix of Rows x Cols elements into a row-major matrix of Cols x Rows elements in
+  *         interrupt mode.
+  * @param  hdma       : Pointer to a DMA_HandleTypeDef structure that contains the configuration information for the
+  *                      specified DMA Channel.
+  * @param  SrcAddress : Source matrix address.
+  * @param  DstAddress : Destination matrix address.
+  * @param  Rows       : Number of lines of the source matrix.
+  * @param  Cols       : Number of columns of the source matrix, from 1 to 2048.
+  * @note   The element size is the channel data width. The source and destination burst lengths must be 1.
+  * @note   The source and destination matrices must not overlap.
+  * @retval HAL status.
+  */
+HAL_StatusTypeDef HAL_DMAEx_Transpose_IT(DMA_HandleTypeDef *const hdma,
+                                         uint32_t SrcAddress,
+                                         uint32_t DstAddress,
+                                         uint32_t Rows,
+                                         uint32_t Cols)
+{
+  DMA_RepeatBlockConfTypeDef repeatblock;
+  uint32_t elementsize;
+
+  /* Check the DMA peripheral handle */
+  if (hdma == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Get the element size in bytes */
+  elementsize = 1UL << (hdma->Init.SrcDataWidth >> DMA_CTR1_SDW_LOG2_Pos);
+
+  /* Check the matrix geometry, the column stride and the rewind offset must fit the offset fields */
+  if ((Rows == 0U) || (!IS_DMA_REPEAT_COUNT(Cols)) || (hdma->Init.SrcBurstLength != 1U) ||
+      (hdma->Init.DestBurstLength != 1U) || (Rows > (DMA_CBR1_BNDT / elementsize)) ||
+      (((Cols - 1U) * elementsize) >= (uint32_t)DMA_BURST_ADDR_OFFSET_MAX) ||
+      ((((Rows - 1U) * Cols) * elementsize) >= (uint32_t)DMA_BLOCK_ADDR_OFFSET_MAX))
+  {
+    /* Update the DMA channel error code */
+    hdma->ErrorCode = HAL_DMA_ERROR_NOT_SUPPORTED;
+
+    return HAL_ERROR;
+  }
+
+  /* One block per source column : read by column, then rewind to the top of the next column */
+  repeatblock.RepeatCount       = Cols;
+  repeatblock.SrcAddrOffset     = (int32_t)((Cols - 1U) * elementsize);
+  repeatblock.DestAddrOffset    = 0;
+  repeatblock.BlkSrcAddrOffset  = -(int32_t)(((Rows - 1U) * Cols) * elementsize);
+  repeatblock.BlkDestAddrOffset = 0;
+
+  return DMA_Start2D(hdma, SrcAddress, DstAddress, (Rows * elementsize), &repeatblock);
+}
+
+/**
+  * @brief  De-interleave a buffer of Samples frames of Channels elements into Channels planar buffers of Samples
+  *         elements in interrupt mode.
+  * @param  hdma       : Pointer to a DMA_HandleTypeDef structure that contains the configuration information for the
+  *                      specified DMA Channel.
+  * @param  SrcAddress : Interleaved buffer address.
+  * @param  DstAddress : Planar buffers address, the buffer of channel n starting at DstAddress + n x Samples elements.
+  * @param  Channels   : Number of elements of each frame, from 1 to 2048.
+  * @param  Samples    : Number of frames.
+  * @note   The element size is the channel data width. The source and destination burst lengths must be 1.
+  * @retval HAL status.
+  */
+HAL_StatusTypeDef HAL_DMAEx_Deinterleave_IT(DMA_HandleTypeDef *const hdma,
+                                            uint32_t SrcAddress,
+                                            uint32_t DstAddress,
+                                            uint32_t Channels,
+                                            uint32_t Samples)
+{
+  /* The interleaved buffer is a Samples x Channels matrix */
+  return HAL_DMAEx_Transpose_IT(hdma, SrcAddress, DstAddress, Samples, Channels);
+}
+/**
+  * @}
+  */
+
 /**
   * @}
   */
@@ -4701,6 +5211,161 @@ static void DMA_List_CleanQueue(DMA_QListTypeDef *const pQList)
   /* Reset queue type */
   pQList->Type = QUEUE_TYPE_STATIC;
 }
+
+/**
+  * @brief  Build a linked-list queue from a node pool, one node per memory buffer.
+  * @param  pPool       : Pointer to a DMA_NodePoolTypeDef structure that contains node pool information.
+  * @param  pQList      : Pointer to an empty DMA_QListTypeDef structure.
+  * @param  pNodeConfig : Pointer to a DMA_NodeConfTypeDef structure used as template for the queue nodes.
+  * @param  pAddress    : Pointer to the memory buffer address array.
+  * @param  pSize       : Pointer to the memory buffer size array.
+  * @param  Number      : Number of memory buffers.
+  * @param  Circular    : When not zero, the queue is built for circular execution.
+  * @retval HAL status.
+  */
+static HAL_StatusTypeDef DMA_List_BuildPoolQ(DMA_NodePoolTypeDef *const pPool,
+                                             DMA_QListTypeDef *const pQList,
+                                             DMA_NodeConfTypeDef const *const pNodeConfig,
+                                             uint32_t const *const pAddress,
+                                             uint32_t const *const pSize,
+                                             uint32_t Number,
+                                             uint32_t Circular)
+{
+  DMA_NodeConfTypeDef node_config;
+  DMA_NodeTypeDef *pNode;
+  HAL_StatusTypeDef status = HAL_OK;
+  uint32_t idx;
+
+  /* Check the node pool, queue and node configuration parameters */
+  if ((pPool == NULL) || (pQList == NULL) || (pNodeConfig == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the queue is empty */
+  if (pQList->Head != NULL)
+  {
+    /* Update the queue error code */
+    pQList->ErrorCode = HAL_DMA_QUEUE_ERROR_BUSY;
+
+    return HAL_ERROR;
+  }
+
+  /* Check the node pool has enough free nodes */
+  if (pPool->FreeNumber < Number)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Clean empty queue parameter */
+  DMA_List_CleanQueue(pQList);
+
+  /* Get the node template */
+  node_config = *pNodeConfig;
+
+  /* Generate the TC event at the end of each memory buffer for circular queues */
+  if (Circular != 0U)
+  {
+    node_config.Init.TransferEventMode = DMA_TCEM_BLOCK_TRANSFER;
+  }
+
+  for (idx = 0U; (idx < Number) && (status == HAL_OK); idx++)
+  {
+    /* Set memory side address */
+    if (node_config.Init.Direction == DMA_PERIPH_TO_MEMORY)
+    {
+      node_config.DstAddress = pAddress[idx];
+    }
+    else
+    {
+      node_config.SrcAddress = pAddress[idx];
+    }
+    node_config.DataSize = pSize[idx];
+
+    pNode = HAL_DMAEx_NodePool_Alloc(pPool);
+    if (pNode == NULL)
+    {
+      status = HAL_ERROR;
+    }
+    else
+    {
+      status = HAL_DMAEx_List_BuildNode(&node_config, pNode);
+
+      if (status == HAL_OK)
+      {
+        status = HAL_DMAEx_List_InsertNode_Tail(pQList, pNode);
+      }
+
+      if (status != HAL_OK)
+      {
+        (void)HAL_DMAEx_NodePool_Free(pPool, pNode);
+      }
+    }
+  }
+
+  /* Link the last queue node to the first one */
+  if ((status == HAL_OK) && (Circular != 0U))
+  {
+    status = HAL_DMAEx_List_SetCircularMode(pQList);
+  }
+
+  /* Give back already allocated nodes on failure */
+  if (status != HAL_OK)
+  {
+    (void)HAL_DMAEx_List_ReleaseQ(pPool, pQList);
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Check the DMA channel supports a 2D memory transfer, then configure the repeated block and start the
+  *         transfer in interrupt mode.
+  * @param  hdma               : Pointer to a DMA_HandleTypeDef structure that contains the configuration information
+  *                              for the specified DMA Channel.
+  * @param  SrcAddress         : The source memory buffer address.
+  * @param  DstAddress         : The destination memory buffer address.
+  * @param  BlockSize          : The block size in bytes.
+  * @param  pConfigRepeatBlock : Pointer to a DMA_RepeatBlockConfTypeDef structure that contains the repeated block
+  *                              configuration.
+  * @note   The single address offset is applied between the singles of a block. At the end of a block only the block
+  *         address offset is applied.
+  * @retval HAL status.
+  */
+static HAL_StatusTypeDef DMA_Start2D(DMA_HandleTypeDef *const hdma,
+                                     uint32_t SrcAddress,
+                                     uint32_t DstAddress,
+                                     uint32_t BlockSize,
+                                     DMA_RepeatBlockConfTypeDef const *const pConfigRepeatBlock)
+{
+  uint32_t elementsize = 1UL << (hdma->Init.SrcDataWidth >> DMA_CTR1_SDW_LOG2_Pos);
+
+  /* Check the channel capability and initialization */
+  if ((!IS_DMA_2D_ADDRESSING_INSTANCE(hdma->Instance))                            ||
+      (hdma->Init.Direction != DMA_MEMORY_TO_MEMORY)                              ||
+      (hdma->Init.SrcInc != DMA_SINC_INCREMENTED)                                 ||
+      (hdma->Init.DestInc != DMA_DINC_INCREMENTED)                                ||
+      (hdma->Init.Mode != DMA_NORMAL)                                             ||
+      (hdma->Init.TransferEventMode != DMA_TCEM_REPEATED_BLOCK_TRANSFER)          ||
+      ((hdma->Init.DestDataWidth >> DMA_CTR1_DDW_LOG2_Pos) !=
+       (hdma->Init.SrcDataWidth >> DMA_CTR1_SDW_LOG2_Pos))                        ||
+      ((BlockSize & (elementsize - 1U)) != 0U))
+  {
+    /* Update the DMA channel error code */
+    hdma->ErrorCode = HAL_DMA_ERROR_NOT_SUPPORTED;
+
+    return HAL_ERROR;
+  }
+
+  /* Configure the repeated block */
+  if (HAL_DMAEx_ConfigRepeatBlock(hdma, pConfigRepeatBlock) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Start the transfer, the block size is written without changing the repeated block count */
+  return HAL_DMA_Start_IT(hdma, SrcAddress, DstAddress, BlockSize);
+}
 /**
   * @}
   */
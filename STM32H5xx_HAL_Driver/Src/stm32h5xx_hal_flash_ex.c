@@ -79,6 +79,19 @@
       (#) Get the privilege mode configuration function: Use HAL_FLASHEx_GetPrivMode()
         (++) Return if the FLASH registers are protected against non-privilege accesses
 
+      (#) Dual-bank update functions, to stream a new image into the inactive bank
+          while running from the active one:
+        (++) Enable the FLASH_IRQn interrupt and call HAL_FLASHEx_BankUpdate_Start()
+             to start the background erase of the sectors covering the image
+        (++) Feed the incoming image chunks of any size to HAL_FLASHEx_BankUpdate_Write(),
+             which returns HAL_BUSY as long as the erase is on-going
+        (++) Call HAL_FLASHEx_BankUpdate_Finish() once the whole image has been written
+        (++) Authenticate the staged image at ImageAddress (for instance digest computed
+             with HAL_HASH_Start_DMA() and signature checked with the PKA)
+        (++) Call HAL_FLASHEx_BankUpdate_Swap() to toggle the SWAP_BANK option byte and
+             reset: the new image runs after a single reset, the previous one is kept in
+             the other bank for rollback
+
 
  @endverbatim
   */
@@ -106,6 +119,7 @@
   * @{
   */
 static void FLASH_MassErase(uint32_t Banks);
+static HAL_StatusTypeDef FLASH_BankUpdate_Flush(FLASH_BankUpdateTypeDef *pUpdate);
 #if defined (FLASH_SR_OBKERR)
 static void FLASH_OBKErase(void);
 #endif /* FLASH_SR_OBKERR */
@@ -891,6 +905,221 @@ HAL_StatusTypeDef HAL_FLASHEx_ConfigHDPExtension(const FLASH_HDPExtensionTypeDef
   return HAL_OK;
 }
 
+/**
+  * @}
+  */
+
+/** @defgroup FLASHEx_Exported_Functions_Group3 FLASHEx Extension dual-bank update functions
+  *  @brief   Extension dual-bank update functions
+  *
+@verbatim
+ ===============================================================================
+                ##### Extension dual-bank update functions #####
+ ===============================================================================
+    [..]
+    This subsection provides a set of functions allowing to stream a new firmware
+    image into the inactive bank and to swap the banks once it has been authenticated.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Start a dual-bank update: erase in background the inactive bank sectors
+  *         covering the image.
+  * @note   The inactive bank is always mapped at FLASH_BASE + FLASH_BANK_SIZE, whatever
+  *         the SWAP_BANK option byte value.
+  * @note   The erase is performed in interrupt mode, FLASH_IRQn must be enabled.
+  * @note   The FLASH control registers are unlocked until HAL_FLASHEx_BankUpdate_Finish().
+  * @param  pUpdate pointer to a FLASH_BankUpdateTypeDef structure holding the update context.
+  * @param  ImageSize Size of the image, in bytes, up to FLASH_BANK_SIZE.
+  * @retval HAL Status
+  */
+HAL_StatusTypeDef HAL_FLASHEx_BankUpdate_Start(FLASH_BankUpdateTypeDef *pUpdate, uint32_t ImageSize)
+{
+  FLASH_EraseInitTypeDef erase_init;
+  HAL_StatusTypeDef status;
+
+  if ((pUpdate == NULL) || (ImageSize == 0U) || (ImageSize > FLASH_BANK_SIZE))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Physical bank currently mapped as second bank */
+  pUpdate->Bank = ((FLASH->OPTSR_CUR & FLASH_OPTSR_SWAP_BANK) != 0U) ? FLASH_BANK_1 : FLASH_BANK_2;
+  pUpdate->ImageAddress = FLASH_BASE + FLASH_BANK_SIZE;
+  pUpdate->ImageSize = ImageSize;
+  pUpdate->Offset = 0U;
+  pUpdate->BufferLevel = 0U;
+  pUpdate->State = FLASH_BANKUPDATE_STATE_ERROR;
+
+  status = HAL_FLASH_Unlock();
+
+  if (status == HAL_OK)
+  {
+    erase_init.TypeErase = FLASH_TYPEERASE_SECTORS;
+    erase_init.Banks     = pUpdate->Bank;
+    erase_init.Sector    = 0U;
+    erase_init.NbSectors = (ImageSize + FLASH_SECTOR_SIZE - 1U) / FLASH_SECTOR_SIZE;
+
+    status = HAL_FLASHEx_Erase_IT(&erase_init);
+  }
+
+  if (status == HAL_OK)
+  {
+    pUpdate->State = FLASH_BANKUPDATE_STATE_ERASE;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Program the next chunk of the image in the inactive bank.
+  * @note   The chunk is buffered and programmed by quad-word, chunks can have any size.
+  * @note   HAL_BUSY is returned, without consuming the chunk, as long as the background
+  *         erase is on-going: the chunk must be provided again.
+  * @param  pUpdate pointer to a FLASH_BankUpdateTypeDef structure holding the update context.
+  * @param  pData pointer to the chunk.
+  * @param  Size Size of the chunk, in bytes.
+  * @retval HAL Status
+  */
+HAL_StatusTypeDef HAL_FLASHEx_BankUpdate_Write(FLASH_BankUpdateTypeDef *pUpdate, const uint8_t *pData,
+                                               uint32_t Size)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+  uint8_t *p_buffer = (uint8_t *)pUpdate->QuadWord;
+  uint32_t index;
+
+  if (pUpdate->State == FLASH_BANKUPDATE_STATE_ERASE)
+  {
+    if (pFlash.ProcedureOnGoing != 0U)
+    {
+      return HAL_BUSY;
+    }
+
+    if (pFlash.ErrorCode != HAL_FLASH_ERROR_NONE)
+    {
+      pUpdate->State = FLASH_BANKUPDATE_STATE_ERROR;
+      return HAL_ERROR;
+    }
+
+    pUpdate->State = FLASH_BANKUPDATE_STATE_PROGRAM;
+  }
+
+  if ((pUpdate->State != FLASH_BANKUPDATE_STATE_PROGRAM) ||
+      (Size > (pUpdate->ImageSize - pUpdate->Offset - pUpdate->BufferLevel)))
+  {
+    return HAL_ERROR;
+  }
+
+  for (index = 0U; (index < Size) && (status == HAL_OK); index++)
+  {
+    p_buffer[pUpdate->BufferLevel] = pData[index];
+    pUpdate->BufferLevel++;
+
+    if (pUpdate->BufferLevel == sizeof(pUpdate->QuadWord))
+    {
+      status = FLASH_BankUpdate_Flush(pUpdate);
+    }
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Complete the programming of the image and lock the FLASH control registers.
+  * @note   The last quad-word is padded with the erased value.
+  * @param  pUpdate pointer to a FLASH_BankUpdateTypeDef structure holding the update context.
+  * @retval HAL Status
+  */
+HAL_StatusTypeDef HAL_FLASHEx_BankUpdate_Finish(FLASH_BankUpdateTypeDef *pUpdate)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+  uint8_t *p_buffer = (uint8_t *)pUpdate->QuadWord;
+
+  if ((pUpdate->State != FLASH_BANKUPDATE_STATE_PROGRAM) ||
+      ((pUpdate->Offset + pUpdate->BufferLevel) != pUpdate->ImageSize))
+  {
+    return HAL_ERROR;
+  }
+
+  if (pUpdate->BufferLevel != 0U)
+  {
+    while (pUpdate->BufferLevel < sizeof(pUpdate->QuadWord))
+    {
+      p_buffer[pUpdate->BufferLevel] = 0xFFU;
+      pUpdate->BufferLevel++;
+    }
+
+    status = FLASH_BankUpdate_Flush(pUpdate);
+  }
+
+  if (status == HAL_OK)
+  {
+    status = HAL_FLASH_Lock();
+  }
+
+  if (status == HAL_OK)
+  {
+    pUpdate->State = FLASH_BANKUPDATE_STATE_READY;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Swap the banks to run the staged image and reset the system.
+  * @note   The staged image must have been authenticated before calling this function.
+  * @note   The SWAP_BANK option byte change is atomic: until it completes, the device
+  *         keeps booting the previous image.
+  * @param  pUpdate pointer to a FLASH_BankUpdateTypeDef structure holding the update context.
+  * @retval HAL Status, this function does not return when the swap succeeds.
+  */
+HAL_StatusTypeDef HAL_FLASHEx_BankUpdate_Swap(const FLASH_BankUpdateTypeDef *pUpdate)
+{
+  FLASH_OBProgramInitTypeDef ob_init;
+  HAL_StatusTypeDef status;
+
+  if (pUpdate->State != FLASH_BANKUPDATE_STATE_READY)
+  {
+    return HAL_ERROR;
+  }
+
+  ob_init.OptionType = OPTIONBYTE_USER;
+  ob_init.USERType   = OB_USER_SWAP_BANK;
+  ob_init.USERConfig = ((FLASH->OPTSR_CUR & FLASH_OPTSR_SWAP_BANK) != 0U) ? OB_SWAP_BANK_DISABLE : \
+                       OB_SWAP_BANK_ENABLE;
+
+  status = HAL_FLASH_Unlock();
+
+  if (status == HAL_OK)
+  {
+    status = HAL_FLASH_OB_Unlock();
+
+    if (status == HAL_OK)
+    {
+      status = HAL_FLASHEx_OBProgram(&ob_init);
+
+      if (status == HAL_OK)
+      {
+        status = HAL_FLASH_OB_Launch();
+      }
+
+      (void)HAL_FLASH_OB_Lock();
+    }
+
+    (void)HAL_FLASH_Lock();
+  }
+
+  if (status == HAL_OK)
+  {
+    /* The bank swap is effective after reset */
+    NVIC_SystemReset();
+  }
+
+  return status;
+}
+
 /**
   * @}
   */
@@ -905,6 +1134,31 @@ HAL_StatusTypeDef HAL_FLASHEx_ConfigHDPExtension(const FLASH_HDPExtensionTypeDef
   * @{
   */
 
+/**
+  * @brief  Program the buffered quad-word of a dual-bank update
+  * @param  pUpdate pointer to a FLASH_BankUpdateTypeDef structure holding the update context.
+  * @retval HAL Status
+  */
+static HAL_StatusTypeDef FLASH_BankUpdate_Flush(FLASH_BankUpdateTypeDef *pUpdate)
+{
+  HAL_StatusTypeDef status;
+
+  status = HAL_FLASH_Program(FLASH_TYPEPROGRAM_QUADWORD, pUpdate->ImageAddress + pUpdate->Offset,
+                             (uint32_t)pUpdate->QuadWord);
+
+  if (status == HAL_OK)
+  {
+    pUpdate->Offset += pUpdate->BufferLevel;
+    pUpdate->BufferLevel = 0U;
+  }
+  else
+  {
+    pUpdate->State = FLASH_BANKUPDATE_STATE_ERROR;
+  }
+
+  return status;
+}
+
 /**
   * @brief  Mass erase of FLASH memory
   * @param  Banks Banks to be erased
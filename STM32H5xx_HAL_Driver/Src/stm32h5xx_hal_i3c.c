@@ -115,6 +115,15 @@
         At the end of procedure, the function HAL_I3C_Ctrl_ConfigBusDevices() must be called to store in hardware
         register part the target capabilities as Dynamic address, IBI support with or without additional data byte,
         Controller role request support, Controller stop transfer after IBI through I3C_DeviceConfTypeDef structure.
+        Alternatively, HAL_I3C_Ctrl_BusEnumerate() runs the whole ENTDAA procedure once in polling mode, fills an
+        application device table (I3C_BusDeviceTypeDef) and configures the DEVRx registers of the first four
+        IBI capable targets.
+
+    (#) To avoid losing In Band Interrupts received while a transfer is ongoing, the controller application can
+        provide a queue of I3C_IBIEntryTypeDef entries through HAL_I3C_Ctrl_ConfigIBIQueue().
+        Each IBI acknowledged by the controller is then stored in this queue from interrupt context (also while a
+        controller transfer is ongoing), before HAL_I3C_NotifyCallback() is called with EVENT_ID_IBI.
+        The application retrieves the queued IBI through HAL_I3C_Ctrl_GetIBI(), from thread or interrupt context.
 
     (#) Other action to be done, before initiate any IO operation, the application must prepare the different frame
         descriptor with its associated buffer allocation in their side.
@@ -341,11 +350,30 @@
 #define I3C_BROADCAST_RSTDAA          (0x00000006U)
 #define I3C_BROADCAST_ENTDAA          (0x00000007U)
 
+/* Private defines for bus enumeration */
+#define I3C_DEVICE_NB                 (4U)
+#define I3C_DCR_IN_PAYLOAD_SHIFT      (56U)
+#define I3C_PID_IN_PAYLOAD_MASK       (0x0000FFFFFFFFFFFFULL)
+#define I3C_DYNADDR_MIN               (0x08U)
+#define I3C_DYNADDR_MAX               (0x7DU)
+#define I3C_BROADCAST_ADDR            (0x7EU)
+
 /**
   * @}
   */
 
 /* Private macro -----------------------------------------------------------------------------------------------------*/
+/** @defgroup I3C_Private_Macro I3C Private Macros
+  * @{
+  */
+/* A dynamic address is reserved when outside the allowed range or one bit away from the broadcast address */
+#define I3C_IS_RESERVED_DYNADDR(__ADDR__) (((__ADDR__) < I3C_DYNADDR_MIN) || ((__ADDR__) > I3C_DYNADDR_MAX) || \
+                                           (((((uint32_t)(__ADDR__)) ^ I3C_BROADCAST_ADDR) &                    \
+                                             ((((uint32_t)(__ADDR__)) ^ I3C_BROADCAST_ADDR) - 1U)) == 0U))
+/**
+  * @}
+  */
+
 /* Private variables -------------------------------------------------------------------------------------------------*/
 
 /* Private function prototypes ---------------------------------------------------------------------------------------*/
@@ -396,6 +424,7 @@ static HAL_StatusTypeDef I3C_ControlBuffer_PriorPreparation(I3C_HandleTypeDef *h
                                                             uint8_t            counter,
                                                             uint32_t           option);
 static void I3C_TreatErrorCallback(I3C_HandleTypeDef *hi3c);
+static void I3C_Ctrl_IBITreatment(I3C_HandleTypeDef *hi3c);
 /**
   * @}
   */
@@ -1431,6 +1460,10 @@ void HAL_I3C_EV_IRQHandler(I3C_HandleTypeDef *hi3c) /* Derogation MISRAC2012-Rul
              All different characteristics must be fill through structure I3C_DeviceConfTypeDef.
              This function is called only when mode is Controller.
 
+         (+) Call the function HAL_I3C_Ctrl_ConfigIBIQueue() to provide the queue in which the received
+             In Band Interrupts are stored from interrupt context.
+             This function is called only when mode is Controller.
+
          (+) Call the function HAL_I3C_AddDescToFrame() to prepare the full transfer usecase in a transfer descriptor
              which contained different buffer pointers and their associated size through I3C_XferTypeDef.
              This function must be called before initiate any communication transfer.
@@ -1906,6 +1939,63 @@ HAL_StatusTypeDef HAL_I3C_Ctrl_ConfigBusDevices(I3C_HandleTypeDef           *hi3
   return status;
 }
 
+/**
+  * @brief  Set the queue used to store the In Band Interrupts received by the controller.
+  * @note   This function is called only when the I3C instance is initialized as controller.
+  *         Once configured, each acknowledged IBI is stored in the queue from interrupt context, including while a
+  *         controller transfer is ongoing, then HAL_I3C_NotifyCallback() is called with EVENT_ID_IBI.
+  *         The queue is a single producer (interrupt) / single consumer (@ref HAL_I3C_Ctrl_GetIBI()) ring buffer,
+  *         one entry is kept free to distinguish a full queue from an empty one.
+  *         When the queue is full, the new IBI is dropped and IBIQueueLost is incremented.
+  * @param  hi3c       : [IN]  Pointer to an I3C_HandleTypeDef structure that contains the configuration information
+  *                            for the specified I3C.
+  * @param  pQueue     : [IN]  Pointer to an array of I3C_IBIEntryTypeDef entries, NULL to disable the queue.
+  * @param  size       : [IN]  Number of entries of the array. This parameter must be greater than 1 when pQueue is
+  *                            not NULL.
+  * @retval HAL Status :       Value from HAL_StatusTypeDef enumeration.
+  */
+HAL_StatusTypeDef HAL_I3C_Ctrl_ConfigIBIQueue(I3C_HandleTypeDef   *hi3c,
+                                              I3C_IBIEntryTypeDef *pQueue,
+                                              uint32_t             size)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+
+  /* Check the I3C handle */
+  if (hi3c == NULL)
+  {
+    status = HAL_ERROR;
+  }
+  else
+  {
+    /* Check on user parameters */
+    if ((pQueue != NULL) && (size < 2U))
+    {
+      hi3c->ErrorCode = HAL_I3C_ERROR_INVALID_PARAM;
+      status = HAL_ERROR;
+    }
+    /* Check the I3C state and mode */
+    else if ((hi3c->State != HAL_I3C_STATE_READY) || (hi3c->Mode != HAL_I3C_MODE_CONTROLLER))
+    {
+      hi3c->ErrorCode = HAL_I3C_ERROR_NOT_ALLOWED;
+      status = HAL_ERROR;
+    }
+    else
+    {
+      /* Check the instance parameter */
+      assert_param(IS_I3C_ALL_INSTANCE(hi3c->Instance));
+
+      /* Update the queue parameters */
+      hi3c->pIBIQueue    = pQueue;
+      hi3c->IBIQueueSize = (pQueue != NULL) ? size : 0U;
+      hi3c->IBIQueueHead = 0U;
+      hi3c->IBIQueueTail = 0U;
+      hi3c->IBIQueueLost = 0U;
+    }
+  }
+
+  return status;
+}
+
 /**
   * @brief  Add Private or CCC descriptor in the user data transfer descriptor.
   * @note   This function must be called before initiate any communication transfer. This function help the preparation
@@ -2381,6 +2471,10 @@ HAL_StatusTypeDef HAL_I3C_GetConfigFifo(I3C_HandleTypeDef *hi3c, I3C_FifoConfTyp
              command in interrupt mode.
          (+) Call the function HAL_I3C_Ctrl_SetDynAddr() to set, asscociate the target dynamic address
              during the Dynamic Address Assignment processus.
+         (+) Call the function HAL_I3C_Ctrl_BusEnumerate() to run the full Dynamic Address Assignment processus
+             in polling mode, fill a device table and configure the DEVRx registers.
+         (+) Call the function HAL_I3C_Ctrl_GetIBI() to retrieve the oldest In Band Interrupt stored in the queue
+             provided through HAL_I3C_Ctrl_ConfigIBIQueue().
 
          (+) Those functions are called only when mode is Controller.
 
@@ -4511,6 +4605,187 @@ HAL_StatusTypeDef HAL_I3C_Ctrl_SetDynAddr(I3C_HandleTypeDef *hi3c, uint8_t devAd
 
   return status;
 }
+/**
+  * @brief  Controller enumerate the bus (send a RSTDAA then a broadcast ENTDAA CCC command) in polling mode.
+  * @note   This function runs the whole Dynamic Address Assignment processus once : each target answering the
+  *         ENTDAA sequence is assigned the next free dynamic address starting from firstAddr (reserved addresses
+  *         are skipped) and is stored in the pDevices table.
+  *         At the end of the processus, the DEVRx registers are configured with the first four IBI capable targets
+  *         (IBI acknowledged, with additional data if the target BCR announces it). IBI from other targets are NACKed
+  *         by the hardware.
+  *         When more than maxDevices targets answer, the other targets still receive a dynamic address but are not
+  *         stored, *pNbDevices is equal to maxDevices and HAL_ERROR is returned with HAL_I3C_ERROR_INVALID_PARAM.
+  * @param  hi3c       : [IN]  Pointer to an I3C_HandleTypeDef structure that contains the configuration information
+  *                            for the specified I3C.
+  * @param  pDevices   : [OUT] Pointer to the application device table.
+  * @param  maxDevices : [IN]  Number of entries of the device table.
+  * @param  firstAddr  : [IN]  First dynamic address to assign.
+  *                            This parameter must be a non reserved address between Min_Data=0x08 and
+  *                            Max_Data=0x7D.
+  * @param  pNbDevices : [OUT] Pointer to the number of targets stored in the device table.
+  * @param  timeout    : [IN]  Timeout duration in millisecond applied to each ENTDAA step.
+  * @retval HAL Status :       Value from HAL_StatusTypeDef enumeration.
+  */
+HAL_StatusTypeDef HAL_I3C_Ctrl_BusEnumerate(I3C_HandleTypeDef    *hi3c,
+                                            I3C_BusDeviceTypeDef *pDevices,
+                                            uint8_t               maxDevices,
+                                            uint8_t               firstAddr,
+                                            uint8_t              *pNbDevices,
+                                            uint32_t              timeout)
+{
+  HAL_StatusTypeDef status;
+  I3C_DeviceConfTypeDef device_conf[I3C_DEVICE_NB];
+  uint64_t target_payload;
+  uint32_t dyn_option = I3C_RSTDAA_THEN_ENTDAA;
+  uint32_t bcr_value;
+  uint8_t dyn_addr = firstAddr;
+  uint8_t nb_device = 0U;
+  uint8_t nb_conf = 0U;
+  uint8_t overflow = 0U;
+
+  /* Check the I3C handle */
+  if (hi3c == NULL)
+  {
+    status = HAL_ERROR;
+  }
+  /* Check on user parameters */
+  else if ((pDevices == NULL) || (pNbDevices == NULL) || (maxDevices == 0U) || I3C_IS_RESERVED_DYNADDR(firstAddr))
+  {
+    hi3c->ErrorCode = HAL_I3C_ERROR_INVALID_PARAM;
+    status = HAL_ERROR;
+  }
+  else
+  {
+    do
+    {
+      /* The payload is accumulated by HAL_I3C_Ctrl_DynAddrAssign() */
+      target_payload = 0U;
+
+      status = HAL_I3C_Ctrl_DynAddrAssign(hi3c, &target_payload, dyn_option, timeout);
+
+      /* RSTDAA is sent only at the first step */
+      dyn_option = I3C_ONLY_ENTDAA;
+
+      /* A target is waiting for its dynamic address */
+      if (status == HAL_BUSY)
+      {
+        if (I3C_IS_RESERVED_DYNADDR(dyn_addr))
+        {
+          /* No more free dynamic address, the ENTDAA processus must be aborted by the application */
+          hi3c->ErrorCode = HAL_I3C_ERROR_INVALID_PARAM;
+          status = HAL_ERROR;
+        }
+        else
+        {
+          if (nb_device < maxDevices)
+          {
+            /* Store the target characteristics in the device table */
+            pDevices[nb_device].PID         = target_payload & I3C_PID_IN_PAYLOAD_MASK;
+            pDevices[nb_device].BCR         = (uint8_t)__HAL_I3C_GET_BCR(target_payload);
+            pDevices[nb_device].DCR         = (uint8_t)(target_payload >> I3C_DCR_IN_PAYLOAD_SHIFT);
+            pDevices[nb_device].DynamicAddr = dyn_addr;
+            nb_device++;
+          }
+          else
+          {
+            overflow = 1U;
+          }
+
+          /* Associate the dynamic address to the target */
+          if (HAL_I3C_Ctrl_SetDynAddr(hi3c, dyn_addr) != HAL_OK)
+          {
+            status = HAL_ERROR;
+          }
+          else
+          {
+            /* Compute the next free dynamic address */
+            do
+            {
+              dyn_addr++;
+            } while ((dyn_addr <= I3C_DYNADDR_MAX) && I3C_IS_RESERVED_DYNADDR(dyn_addr));
+          }
+        }
+      }
+    } while (status == HAL_BUSY);
+
+    *pNbDevices = nb_device;
+
+    if (status == HAL_OK)
+    {
+      /* Configure the DEVRx registers with the first IBI capable targets */
+      for (uint32_t index = 0U; (index < nb_device) && (nb_conf < I3C_DEVICE_NB); index++)
+      {
+        bcr_value = pDevices[index].BCR;
+
+        if (__HAL_I3C_GET_IBI_CAPABLE(bcr_value) == ENABLE)
+        {
+          device_conf[nb_conf].DeviceIndex       = (uint8_t)(nb_conf + 1U);
+          device_conf[nb_conf].TargetDynamicAddr = pDevices[index].DynamicAddr;
+          device_conf[nb_conf].IBIAck            = ENABLE;
+          device_conf[nb_conf].IBIPayload        = __HAL_I3C_GET_IBI_PAYLOAD(bcr_value);
+          device_conf[nb_conf].CtrlRoleReqAck    = DISABLE;
+          device_conf[nb_conf].CtrlStopTransfer  = DISABLE;
+          nb_conf++;
+        }
+      }
+
+      if (nb_conf != 0U)
+      {
+        status = HAL_I3C_Ctrl_ConfigBusDevices(hi3c, device_conf, nb_conf);
+      }
+
+      if ((status == HAL_OK) && (overflow != 0U))
+      {
+        hi3c->ErrorCode = HAL_I3C_ERROR_INVALID_PARAM;
+        status = HAL_ERROR;
+      }
+    }
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Controller retrieve the oldest In Band Interrupt stored in the IBI queue.
+  * @note   The queue must be configured through @ref HAL_I3C_Ctrl_ConfigIBIQueue().
+  *         This function can be called from thread context while the queue is fed from interrupt context, it must
+  *         not be called concurrently from several contexts.
+  * @param  hi3c       : [IN]  Pointer to an I3C_HandleTypeDef structure that contains the configuration information
+  *                            for the specified I3C.
+  * @param  pEntry     : [OUT] Pointer to an I3C_IBIEntryTypeDef structure filled with the IBI information.
+  * @retval HAL Status :       HAL_OK when an IBI is returned, HAL_ERROR when the queue is empty or not configured.
+  */
+HAL_StatusTypeDef HAL_I3C_Ctrl_GetIBI(I3C_HandleTypeDef *hi3c, I3C_IBIEntryTypeDef *pEntry)
+{
+  HAL_StatusTypeDef status = HAL_ERROR;
+  uint32_t tail;
+
+  /* Check the I3C handle and user parameters */
+  if ((hi3c != NULL) && (pEntry != NULL) && (hi3c->pIBIQueue != NULL))
+  {
+    tail = hi3c->IBIQueueTail;
+
+    /* Check that the queue is not empty */
+    if (tail != hi3c->IBIQueueHead)
+    {
+      /* Ensure the entry is read after the write index */
+      __DMB();
+
+      *pEntry = hi3c->pIBIQueue[tail];
+
+      /* Ensure the entry is read before releasing it */
+      __DMB();
+
+      tail++;
+      hi3c->IBIQueueTail = (tail == hi3c->IBIQueueSize) ? 0U : tail;
+
+      status = HAL_OK;
+    }
+  }
+
+  return status;
+}
+
 /**
   * @}
   */
@@ -6278,16 +6553,8 @@ static HAL_StatusTypeDef I3C_Ctrl_Event_ISR(struct __I3C_HandleTypeDef *hi3c, ui
   /* I3C controller receive IBI event management ---------------------------------------------------------------------*/
   if ((I3C_CHECK_FLAG(itFlags, I3C_EVR_IBIF) != RESET) && (I3C_CHECK_IT_SOURCE(itSources, I3C_IER_IBIIE) != RESET))
   {
-    /* Clear IBI request flag */
-    LL_I3C_ClearFlag_IBI(hi3c->Instance);
-
-#if (USE_HAL_I3C_REGISTER_CALLBACKS == 1U)
-    /* Call registered callback */
-    hi3c->NotifyCallback(hi3c, EVENT_ID_IBI);
-#else
-    /* Asynchronous IBI event Callback */
-    HAL_I3C_NotifyCallback(hi3c, EVENT_ID_IBI);
-#endif /* USE_HAL_I3C_REGISTER_CALLBACKS == 1U */
+    /* Call IBI treatment function */
+    I3C_Ctrl_IBITreatment(hi3c);
   }
 
   /* I3C controller controller-role request event management ---------------------------------------------------------*/
@@ -6743,6 +7010,13 @@ static HAL_StatusTypeDef I3C_Tgt_Rx_DMA_ISR(struct __I3C_HandleTypeDef *hi3c, ui
   */
 static HAL_StatusTypeDef I3C_Ctrl_Tx_ISR(struct __I3C_HandleTypeDef *hi3c, uint32_t itFlags, uint32_t itSources)
 {
+  /* I3C controller receive IBI event management during the transfer */
+  if ((I3C_CHECK_FLAG(itFlags, I3C_EVR_IBIF) != RESET) && (I3C_CHECK_IT_SOURCE(itSources, I3C_IER_IBIIE) != RESET))
+  {
+    /* Call IBI treatment function */
+    I3C_Ctrl_IBITreatment(hi3c);
+  }
+
   /* Check that a Tx process is ongoing */
   if (hi3c->State == HAL_I3C_STATE_BUSY_TX)
   {
@@ -6821,6 +7095,13 @@ static HAL_StatusTypeDef I3C_Ctrl_Tx_ISR(struct __I3C_HandleTypeDef *hi3c, uint3
   */
 static HAL_StatusTypeDef I3C_Ctrl_Rx_ISR(struct __I3C_HandleTypeDef *hi3c, uint32_t itFlags, uint32_t itSources)
 {
+  /* I3C controller receive IBI event management during the transfer */
+  if ((I3C_CHECK_FLAG(itFlags, I3C_EVR_IBIF) != RESET) && (I3C_CHECK_IT_SOURCE(itSources, I3C_IER_IBIIE) != RESET))
+  {
+    /* Call IBI treatment function */
+    I3C_Ctrl_IBITreatment(hi3c);
+  }
+
   /* Check that an Rx process is ongoing */
   if (hi3c->State == HAL_I3C_STATE_BUSY_RX)
   {
@@ -6989,6 +7270,13 @@ static HAL_StatusTypeDef I3C_Ctrl_DAA_ISR(struct __I3C_HandleTypeDef *hi3c, uint
   */
 static HAL_StatusTypeDef I3C_Ctrl_Tx_DMA_ISR(struct __I3C_HandleTypeDef *hi3c, uint32_t itFlags, uint32_t itSources)
 {
+  /* I3C controller receive IBI event management during the transfer */
+  if ((I3C_CHECK_FLAG(itFlags, I3C_EVR_IBIF) != RESET) && (I3C_CHECK_IT_SOURCE(itSources, I3C_IER_IBIIE) != RESET))
+  {
+    /* Call IBI treatment function */
+    I3C_Ctrl_IBITreatment(hi3c);
+  }
+
   /* Check that a Tx process is ongoing */
   if (hi3c->State == HAL_I3C_STATE_BUSY_TX)
   {
@@ -7058,6 +7346,13 @@ static HAL_StatusTypeDef I3C_Ctrl_Tx_DMA_ISR(struct __I3C_HandleTypeDef *hi3c, u
   */
 static HAL_StatusTypeDef I3C_Ctrl_Rx_DMA_ISR(struct __I3C_HandleTypeDef *hi3c, uint32_t itFlags, uint32_t itSources)
 {
+  /* I3C controller receive IBI event management during the transfer */
+  if ((I3C_CHECK_FLAG(itFlags, I3C_EVR_IBIF) != RESET) && (I3C_CHECK_IT_SOURCE(itSources, I3C_IER_IBIIE) != RESET))
+  {
+    /* Call IBI treatment function */
+    I3C_Ctrl_IBITreatment(hi3c);
+  }
+
   /* Check that an Rx process is ongoing */
   if (hi3c->State == HAL_I3C_STATE_BUSY_RX)
   {
@@ -8181,6 +8476,54 @@ static void I3C_TreatErrorCallback(I3C_HandleTypeDef *hi3c)
   }
 }
 
+/**
+  * @brief  I3C controller In Band Interrupt treatment.
+  * @note   The IBI information is stored in the IBI queue, if any, before the notification.
+  * @param  hi3c : [IN] Pointer to an I3C_HandleTypeDef structure that contains the configuration information
+  *                     for the specified I3C.
+  * @retval None
+  */
+static void I3C_Ctrl_IBITreatment(I3C_HandleTypeDef *hi3c)
+{
+  uint32_t head;
+  uint32_t next;
+
+  if (hi3c->pIBIQueue != NULL)
+  {
+    head = hi3c->IBIQueueHead;
+    next = ((head + 1U) == hi3c->IBIQueueSize) ? 0U : (head + 1U);
+
+    /* Check that the queue is not full */
+    if (next != hi3c->IBIQueueTail)
+    {
+      /* Store IBI information before the flag clearing allows a new IBI */
+      hi3c->pIBIQueue[head].TargetAddr  = (uint8_t)LL_I3C_GetIBITargetAddr(hi3c->Instance);
+      hi3c->pIBIQueue[head].PayloadSize = (uint8_t)LL_I3C_GetNbIBIAddData(hi3c->Instance);
+      hi3c->pIBIQueue[head].Payload     = LL_I3C_GetIBIPayload(hi3c->Instance);
+
+      /* Ensure the entry is written before the write index */
+      __DMB();
+
+      hi3c->IBIQueueHead = next;
+    }
+    else
+    {
+      hi3c->IBIQueueLost++;
+    }
+  }
+
+  /* Clear IBI request flag */
+  LL_I3C_ClearFlag_IBI(hi3c->Instance);
+
+#if (USE_HAL_I3C_REGISTER_CALLBACKS == 1U)
+  /* Call registered callback */
+  hi3c->NotifyCallback(hi3c, EVENT_ID_IBI);
+#else
+  /* Asynchronous IBI event Callback */
+  HAL_I3C_NotifyCallback(hi3c, EVENT_ID_IBI);
+#endif /* USE_HAL_I3C_REGISTER_CALLBACKS == 1U */
+}
+
 /**
   * @}
   */
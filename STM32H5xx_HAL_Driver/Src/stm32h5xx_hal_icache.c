@@ -70,6 +70,23 @@
         memories to the internal Code region for execution with
         HAL_ICACHE_EnableRemapRegion() and HAL_ICACHE_DisableRemapRegion()
 
+    (#) Measure the cache efficiency of the application, per code region, with the
+        sampling service:
+        (++) Start it with HAL_ICACHE_Sampler_Start() and an array of
+             ICACHE_MonitorCountTypeDef, one per code region (task, function set,
+             code executed from an external memory...).
+        (++) Call HAL_ICACHE_Sampler_SelectRegion() when the execution enters another
+             code region: the counts are attributed to the region selected when they occur.
+        (++) Call HAL_ICACHE_Sampler_Sample() periodically, e.g. from a timer interrupt,
+             well before 2^32 cache accesses: the hardware counters are then read, reset
+             and accumulated on 64 bits, as they saturate instead of wrapping.
+        (++) Stop it with HAL_ICACHE_Sampler_Stop() and compare the regions hit rate
+             returned by HAL_ICACHE_Sampler_GetHitRate().
+        (++) Run the same measurement with each associativity mode (the cache must be
+             disabled to call HAL_ICACHE_ConfigAssociativityMode()), and with or without
+             the remap regions and burst type of the external memories, to select the
+             configuration by measurement.
+
   @endverbatim
   */
 
@@ -644,6 +661,163 @@ HAL_StatusTypeDef  HAL_ICACHE_DisableRemapRegion(uint32_t Region)
   */
 #endif /*  ICACHE_CRRx_REN */
 
+/** @defgroup ICACHE_Exported_Functions_Group4 Performance sampling functions
+  * @brief    Performance sampling functions
+  *
+  @verbatim
+  ==============================================================================
+                  ##### Performance sampling functions #####
+  ==============================================================================
+  [..]
+    This section provides functions allowing to accumulate the Hit and Miss
+    monitors on 64 bits and to attribute them to code regions.
+  @endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Start sampling the Instruction Cache Hit and Miss monitors.
+  * @param  pSampler  Pointer to the sampler structure, owned by the application
+  * @param  pCount    Pointer to an array of counts, one per code region
+  * @param  NbRegions Number of code regions, at least 1
+  * @note   The counts are cleared, the monitors are reset and started,
+  *         and the region 0 is selected.
+  * @retval HAL status (HAL_OK/HAL_ERROR)
+  */
+HAL_StatusTypeDef HAL_ICACHE_Sampler_Start(ICACHE_MonitorSamplerTypeDef *pSampler,
+                                           ICACHE_MonitorCountTypeDef *pCount, uint32_t NbRegions)
+{
+  uint32_t region;
+
+  if ((pSampler == NULL) || (pCount == NULL) || (NbRegions == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  for (region = 0U; region < NbRegions; region++)
+  {
+    pCount[region].Hit  = 0U;
+    pCount[region].Miss = 0U;
+  }
+
+  pSampler->pCount    = pCount;
+  pSampler->NbRegions = NbRegions;
+  pSampler->Region    = 0U;
+  pSampler->Saturated = 0U;
+
+  (void)HAL_ICACHE_Monitor_Reset(ICACHE_MONITOR_HIT_MISS);
+
+  return HAL_ICACHE_Monitor_Start(ICACHE_MONITOR_HIT_MISS);
+}
+
+/**
+  * @brief  Stop sampling the Instruction Cache monitors.
+  * @param  pSampler  Pointer to the sampler structure
+  * @note   The last counts are accumulated before the monitors are stopped.
+  * @retval HAL status (HAL_OK/HAL_ERROR)
+  */
+HAL_StatusTypeDef HAL_ICACHE_Sampler_Stop(ICACHE_MonitorSamplerTypeDef *pSampler)
+{
+  if (pSampler == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  HAL_ICACHE_Sampler_Sample(pSampler);
+
+  return HAL_ICACHE_Monitor_Stop(ICACHE_MONITOR_HIT_MISS);
+}
+
+/**
+  * @brief  Accumulate the Instruction Cache monitors to the selected code region.
+  * @param  pSampler  Pointer to the sampler structure
+  * @note   The monitors are read and reset with interrupts masked, so that this
+  *         function may be called from both thread and interrupt contexts.
+  * @retval None
+  */
+void HAL_ICACHE_Sampler_Sample(ICACHE_MonitorSamplerTypeDef *pSampler)
+{
+  uint32_t primask;
+  uint32_t hit;
+  uint32_t miss;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  hit  = ICACHE->HMONR;
+  miss = ICACHE->MMONR;
+
+  /* Force/Release reset */
+  SET_BIT(ICACHE->CR, (ICACHE_MONITOR_HIT_MISS << 2U));
+  CLEAR_BIT(ICACHE->CR, (ICACHE_MONITOR_HIT_MISS << 2U));
+
+  pSampler->pCount[pSampler->Region].Hit  += hit;
+  pSampler->pCount[pSampler->Region].Miss += miss;
+
+  if ((hit == 0xFFFFFFFFU) || (miss == 0xFFFFFFFFU))
+  {
+    pSampler->Saturated++;
+  }
+
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Select the code region the next Instruction Cache counts are attributed to.
+  * @param  pSampler  Pointer to the sampler structure
+  * @param  Region    Code region index, lower than the number of regions
+  * @note   The counts of the previous region are accumulated first.
+  * @retval HAL status (HAL_OK/HAL_ERROR)
+  */
+HAL_StatusTypeDef HAL_ICACHE_Sampler_SelectRegion(ICACHE_MonitorSamplerTypeDef *pSampler, uint32_t Region)
+{
+  uint32_t primask;
+
+  if ((pSampler == NULL) || (Region >= pSampler->NbRegions))
+  {
+    return HAL_ERROR;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  HAL_ICACHE_Sampler_Sample(pSampler);
+  pSampler->Region = Region;
+
+  __set_PRIMASK(primask);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Return the hit rate of a code region.
+  * @param  pCount  Pointer to the counts of the region
+  * @retval Hit rate in hundredths of percent (0 to 10000), 0 when no access was counted
+  */
+uint32_t HAL_ICACHE_Sampler_GetHitRate(const ICACHE_MonitorCountTypeDef *pCount)
+{
+  uint64_t hit = pCount->Hit;
+  uint64_t total = pCount->Hit + pCount->Miss;
+
+  if (total == 0U)
+  {
+    return 0U;
+  }
+
+  /* Scale down to keep the product on 64 bits */
+  while (total > (0xFFFFFFFFFFFFFFFFULL / 10000U))
+  {
+    hit   >>= 1U;
+    total >>= 1U;
+  }
+
+  return (uint32_t)((hit * 10000U) / total);
+}
+
+/**
+  * @}
+  */
+
 /**
   * @}
   */
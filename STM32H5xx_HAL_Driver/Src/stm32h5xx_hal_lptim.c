@@ -10,6 +10,7 @@
   *           + Start/Stop operation functions in interrupt mode.
   *           + Reading operation functions.
   *           + Peripheral State functions.
+  *           + Low power service functions.
   *
   ******************************************************************************
   * @attention
@@ -94,6 +95,19 @@
          To start this mode, call HAL_LPTIM_Counter_Start() or
          HAL_LPTIM_Counter_Start_IT() for interruption mode.
 
+      (#)Two low power services are built on these modes:
+
+         (++) Pulse counter: HAL_LPTIM_PulseCounter_Start_IT() counts the pulses
+         of the LPTIM Input1 and wakes the core up every given number of pulses
+         with the auto-reload match interrupt, so the counting goes on in Stop
+         mode. HAL_LPTIM_PulseCounter_GetCount() returns the total count.
+
+         (++) Sampling trigger: HAL_LPTIM_SamplingTrigger_Start() generates on
+         channel 1 the periodic event selected by ADC_EXTERNALTRIG_LPTIMx_CH1 or
+         DAC_TRIGGER_LPTIMx_CH1, clocked by LSE or LSI independently of the core.
+         HAL_LPTIM_SamplingTrigger_Start_DMA() moves in addition one data item
+         per period with the update event DMA request.
+
 
       (#) User can stop any process by calling the corresponding API:
           HAL_LPTIM_Xxx_Stop() or HAL_LPTIM_Xxx_Stop_IT() if the process is
@@ -195,6 +209,7 @@ static void LPTIM_IC2_SetConfig(LPTIM_HandleTypeDef *hlptim, const LPTIM_IC_Conf
 static void LPTIM_ResetCallback(LPTIM_HandleTypeDef *lptim);
 #endif /* USE_HAL_LPTIM_REGISTER_CALLBACKS */
 static HAL_StatusTypeDef LPTIM_WaitForFlag(const LPTIM_HandleTypeDef *hlptim, uint32_t flag);
+static HAL_StatusTypeDef LPTIM_SamplingTrigger_SetConfig(LPTIM_HandleTypeDef *hlptim, uint32_t Period, uint32_t Pulse);
 void LPTIM_DMAError(DMA_HandleTypeDef *hdma);
 void LPTIM_DMACaptureCplt(DMA_HandleTypeDef *hdma);
 void LPTIM_DMACaptureHalfCplt(DMA_HandleTypeDef *hdma);
@@ -290,6 +305,10 @@ HAL_StatusTypeDef HAL_LPTIM_Init(LPTIM_HandleTypeDef *hlptim)
   /* Change the LPTIM state */
   hlptim->State = HAL_LPTIM_STATE_BUSY;
 
+  /* The pulse counter is not running */
+  hlptim->PulseWakeUp = 0U;
+  hlptim->PulseWakeUpCount = 0U;
+
   /* Enable the Peripheral */
   __HAL_LPTIM_ENABLE(hlptim);
 
@@ -2652,6 +2671,12 @@ void HAL_LPTIM_IRQHandler(LPTIM_HandleTypeDef *hlptim)
       /* Clear Autoreload match flag */
       __HAL_LPTIM_CLEAR_FLAG(hlptim, LPTIM_FLAG_ARRM);
 
+      /* Count the wake-ups of the pulse counter */
+      if (hlptim->PulseWakeUp != 0U)
+      {
+        hlptim->PulseWakeUpCount++;
+      }
+
       /* Autoreload match Callback */
 #if (USE_HAL_LPTIM_REGISTER_CALLBACKS == 1)
       hlptim->AutoReloadMatchCallback(hlptim);
@@ -3325,6 +3350,374 @@ HAL_LPTIM_StateTypeDef HAL_LPTIM_GetState(const LPTIM_HandleTypeDef *hlptim)
   return hlptim->State;
 }
 
+/**
+  * @}
+  */
+
+/** @defgroup LPTIM_Exported_Functions_Group6 LPTIM Low power service functions
+  *  @brief   Low power service functions.
+  *
+@verbatim
+  ==============================================================================
+                  ##### Low power service functions #####
+  ==============================================================================
+    [..]
+    This section provides functions allowing to:
+      (+) Count external pulses in Stop mode, with a wake-up every given number
+          of pulses.
+      (+) Generate a periodic trigger for the ADC or the DAC, with an optional
+          DMA transfer on each period, without any timer clocked by the core.
+
+    [..]
+    The LPTIM must be clocked by LSE or LSI (or by the external pulses with
+    LPTIM_CLOCKSOURCE_ULPTIM) to keep running in Stop mode. The GPDMA does not
+    run in Stop mode: the sampling trigger is intended for Sleep mode, where the
+    period does not depend on the core activity.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Start counting the pulses of the LPTIM Input1 with periodic wake-ups.
+  * @note   The LPTIM must be initialized with LPTIM_COUNTERSOURCE_EXTERNAL. The
+  *         auto-reload value is set to WakeUpPulses - 1: the auto-reload match
+  *         interrupt, which wakes the core up from Stop mode, is raised on the
+  *         WakeUpPulses - 1 pulse, then every WakeUpPulses pulses.
+  *         HAL_LPTIM_AutoReloadMatchCallback() is called on each wake-up.
+  * @param  hlptim LPTIM handle
+  * @param  WakeUpPulses Number of pulses between two wake-ups, from 2 to 0x10000.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_LPTIM_PulseCounter_Start_IT(LPTIM_HandleTypeDef *hlptim, uint32_t WakeUpPulses)
+{
+  /* Check the parameters */
+  assert_param(IS_LPTIM_INSTANCE(hlptim->Instance));
+
+  if ((WakeUpPulses < 2U) || (WakeUpPulses > 0x10000U)
+      || (hlptim->Init.CounterSource != LPTIM_COUNTERSOURCE_EXTERNAL))
+  {
+    return HAL_ERROR;
+  }
+
+  if (hlptim->PulseWakeUp != 0U)
+  {
+    return HAL_BUSY;
+  }
+
+  /* Set the LPTIM state */
+  hlptim->State = HAL_LPTIM_STATE_BUSY;
+
+  /* If clock source is not ULPTIM clock and counter source is external, then it must not be prescaled */
+  if (hlptim->Init.Clock.Source != LPTIM_CLOCKSOURCE_ULPTIM)
+  {
+    /* Check if clock is prescaled */
+    assert_param(IS_LPTIM_CLOCK_PRESCALERDIV1(hlptim->Init.Clock.Prescaler));
+    /* Set clock prescaler to 0 */
+    hlptim->Instance->CFGR &= ~LPTIM_CFGR_PRESC;
+  }
+
+  /* Enable the Peripheral */
+  __HAL_LPTIM_ENABLE(hlptim);
+
+  /* Clear flag */
+  __HAL_LPTIM_CLEAR_FLAG(hlptim, LPTIM_FLAG_ARROK);
+
+  /* Set the wake-up period */
+  __HAL_LPTIM_AUTORELOAD_SET(hlptim, WakeUpPulses - 1U);
+
+  /* Wait for the completion of the write operation to the LPTIM_ARR register */
+  if (LPTIM_WaitForFlag(hlptim, LPTIM_FLAG_ARROK) == HAL_TIMEOUT)
+  {
+    return HAL_TIMEOUT;
+  }
+
+  hlptim->PulseWakeUpCount = 0U;
+  hlptim->PulseWakeUp = WakeUpPulses;
+
+  /* Clear flags */
+  __HAL_LPTIM_CLEAR_FLAG(hlptim, LPTIM_FLAG_ARRM | LPTIM_FLAG_DIEROK);
+
+  /* Enable the auto-reload match interrupt only, one interrupt per wake-up */
+  __HAL_LPTIM_ENABLE_IT(hlptim, LPTIM_IT_ARRM);
+
+  /* Wait for the completion of the write operation to the LPTIM_DIER register */
+  if (LPTIM_WaitForFlag(hlptim, LPTIM_FLAG_DIEROK) == HAL_TIMEOUT)
+  {
+    hlptim->PulseWakeUp = 0U;
+    return HAL_TIMEOUT;
+  }
+
+  /* Start timer in continuous mode */
+  __HAL_LPTIM_START_CONTINUOUS(hlptim);
+
+  /* Change the LPTIM state */
+  hlptim->State = HAL_LPTIM_STATE_READY;
+
+  /* Return function status */
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop the pulse counter.
+  * @note   The auto-reload value is restored to Init.Period.
+  * @param  hlptim LPTIM handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_LPTIM_PulseCounter_Stop_IT(LPTIM_HandleTypeDef *hlptim)
+{
+  /* Check the parameters */
+  assert_param(IS_LPTIM_INSTANCE(hlptim->Instance));
+
+  /* Set the LPTIM state */
+  hlptim->State = HAL_LPTIM_STATE_BUSY;
+
+  /* Disable the Peripheral, the registers are written with the peripheral enabled */
+  __HAL_LPTIM_DISABLE(hlptim);
+  __HAL_LPTIM_ENABLE(hlptim);
+
+  /* Clear flags */
+  __HAL_LPTIM_CLEAR_FLAG(hlptim, LPTIM_FLAG_DIEROK | LPTIM_FLAG_ARROK);
+
+  /* Disable interrupt */
+  __HAL_LPTIM_DISABLE_IT(hlptim, LPTIM_IT_ARRM);
+
+  /* Wait for the completion of the write operation to the LPTIM_DIER register */
+  if (LPTIM_WaitForFlag(hlptim, LPTIM_FLAG_DIEROK) == HAL_TIMEOUT)
+  {
+    return HAL_TIMEOUT;
+  }
+
+  /* Restore LPTIM Period */
+  __HAL_LPTIM_AUTORELOAD_SET(hlptim, hlptim->Init.Period);
+
+  /* Wait for the completion of the write operation to the LPTIM_ARR register */
+  if (LPTIM_WaitForFlag(hlptim, LPTIM_FLAG_ARROK) == HAL_TIMEOUT)
+  {
+    return HAL_TIMEOUT;
+  }
+
+  /* Disable the Peripheral */
+  __HAL_LPTIM_DISABLE(hlptim);
+
+  hlptim->PulseWakeUp = 0U;
+
+  /* Change the LPTIM state */
+  hlptim->State = HAL_LPTIM_STATE_READY;
+
+  /* Return function status */
+  return HAL_OK;
+}
+
+/**
+  * @brief  Return the number of pulses counted since HAL_LPTIM_PulseCounter_Start_IT().
+  * @note   The counter runs asynchronously to the APB clock: it is read until two
+  *         consecutive reads match. A wake-up not yet handled by HAL_LPTIM_IRQHandler(),
+  *         because the interrupts are masked, is taken into account.
+  * @param  hlptim LPTIM handle
+  * @retval Number of pulses, 0 when the pulse counter is not running
+  */
+uint64_t HAL_LPTIM_PulseCounter_GetCount(const LPTIM_HandleTypeDef *hlptim)
+{
+  uint32_t primask_bit;
+  uint32_t counter;
+  uint32_t check;
+  uint32_t wakeups;
+  uint64_t count;
+
+  if (hlptim->PulseWakeUp == 0U)
+  {
+    return 0U;
+  }
+
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  do
+  {
+    counter = hlptim->Instance->CNT;
+    wakeups = hlptim->PulseWakeUpCount;
+    if (__HAL_LPTIM_GET_FLAG(hlptim, LPTIM_FLAG_ARRM) != RESET)
+    {
+      wakeups++;
+    }
+    check = hlptim->Instance->CNT;
+  } while (counter != check);
+
+  __set_PRIMASK(primask_bit);
+
+  /* The wake-up is raised on the match, one pulse before the counter wraps to 0 */
+  count = ((uint64_t)wakeups * hlptim->PulseWakeUp) + counter;
+  if ((wakeups != 0U) && (counter == (hlptim->PulseWakeUp - 1U)))
+  {
+    count -= hlptim->PulseWakeUp;
+  }
+
+  return count;
+}
+
+/**
+  * @brief  Start the generation of a periodic ADC or DAC trigger on channel 1.
+  * @note   Channel 1 is set in PWM mode and its output is the trigger selected by
+  *         ADC_EXTERNALTRIG_LPTIMx_CH1 or DAC_TRIGGER_LPTIMx_CH1: one trigger edge
+  *         per period, on the compare match. The channel 1 output pin needs not
+  *         be configured.
+  * @param  hlptim LPTIM handle
+  * @param  Period Trigger period in LPTIM counter clock cycles, from 2 to 0x10000.
+  * @param  Pulse Compare value of the trigger edge, lower than Period.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_LPTIM_SamplingTrigger_Start(LPTIM_HandleTypeDef *hlptim, uint32_t Period, uint32_t Pulse)
+{
+  HAL_StatusTypeDef status;
+
+  /* Check the parameters */
+  assert_param(IS_LPTIM_CC1_INSTANCE(hlptim->Instance));
+
+  /* Check LPTIM channel state */
+  if (LPTIM_CHANNEL_STATE_GET(hlptim, LPTIM_CHANNEL_1) != HAL_LPTIM_CHANNEL_STATE_READY)
+  {
+    return HAL_ERROR;
+  }
+
+  status = LPTIM_SamplingTrigger_SetConfig(hlptim, Period, Pulse);
+  if (status != HAL_OK)
+  {
+    return status;
+  }
+
+  /* Enable LPTIM signal on channel 1 */
+  __HAL_LPTIM_CAPTURE_COMPARE_ENABLE(hlptim, LPTIM_CHANNEL_1);
+
+  /* Start timer in continuous mode */
+  __HAL_LPTIM_START_CONTINUOUS(hlptim);
+
+  /* Change the LPTIM state */
+  hlptim->State = HAL_LPTIM_STATE_READY;
+
+  /* Return function status */
+  return HAL_OK;
+}
+
+/**
+  * @brief  Start the periodic trigger on channel 1 with a DMA transfer on each period.
+  * @note   The DMA handle hdma[LPTIM_DMA_ID_UPDATE] must be linked to the update
+  *         event DMA request of the LPTIM, usually in circular mode. One data item
+  *         is moved from SrcAddress to DstAddress on each update event, for instance
+  *         to a DAC data holding register or to a GPIO BSRR register.
+  *         HAL_LPTIM_UpdateEventHalfCpltCallback() and HAL_LPTIM_UpdateEventCallback()
+  *         are called on the DMA half transfer and transfer complete events.
+  * @param  hlptim LPTIM handle
+  * @param  Period Trigger period in LPTIM counter clock cycles, from 2 to 0x10000.
+  * @param  Pulse Compare value of the trigger edge, lower than Period.
+  * @param  SrcAddress Source address of the DMA transfer.
+  * @param  DstAddress Destination address of the DMA transfer.
+  * @param  Length Length of the DMA transfer in bytes.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_LPTIM_SamplingTrigger_Start_DMA(LPTIM_HandleTypeDef *hlptim, uint32_t Period, uint32_t Pulse,
+                                                      uint32_t SrcAddress, uint32_t DstAddress, uint32_t Length)
+{
+  HAL_StatusTypeDef status;
+
+  /* Check the parameters */
+  assert_param(IS_LPTIM_DMA_INSTANCE(hlptim->Instance));
+  assert_param(IS_LPTIM_CC1_INSTANCE(hlptim->Instance));
+
+  if ((Length == 0U) || (hlptim->hdma[LPTIM_DMA_ID_UPDATE] == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check LPTIM channel state */
+  if (LPTIM_CHANNEL_STATE_GET(hlptim, LPTIM_CHANNEL_1) != HAL_LPTIM_CHANNEL_STATE_READY)
+  {
+    return HAL_ERROR;
+  }
+
+  status = LPTIM_SamplingTrigger_SetConfig(hlptim, Period, Pulse);
+  if (status != HAL_OK)
+  {
+    return status;
+  }
+
+  /* Clear flag */
+  __HAL_LPTIM_CLEAR_FLAG(hlptim, LPTIM_FLAG_DIEROK);
+
+  /* Enable update event DMA request */
+  __HAL_LPTIM_ENABLE_DMA(hlptim, LPTIM_DMA_UPDATE);
+
+  /* Wait for the completion of the write operation to the LPTIM_DIER register */
+  if (LPTIM_WaitForFlag(hlptim, LPTIM_FLAG_DIEROK) == HAL_TIMEOUT)
+  {
+    return HAL_TIMEOUT;
+  }
+
+  /* Set the DMA update event callbacks */
+  hlptim->hdma[LPTIM_DMA_ID_UPDATE]->XferCpltCallback = LPTIM_DMAUpdateEventCplt;
+  hlptim->hdma[LPTIM_DMA_ID_UPDATE]->XferHalfCpltCallback = LPTIM_DMAUpdateEventHalfCplt;
+
+  /* Set the DMA error callback */
+  hlptim->hdma[LPTIM_DMA_ID_UPDATE]->XferErrorCallback = LPTIM_DMAError;
+
+  /* Enable the DMA Channel */
+  if (LPTIM_DMA_Start_IT(hlptim->hdma[LPTIM_DMA_ID_UPDATE], SrcAddress, DstAddress, Length) != HAL_OK)
+  {
+    /* Return error status */
+    return HAL_ERROR;
+  }
+
+  /* Enable LPTIM signal on channel 1 */
+  __HAL_LPTIM_CAPTURE_COMPARE_ENABLE(hlptim, LPTIM_CHANNEL_1);
+
+  /* Start timer in continuous mode */
+  __HAL_LPTIM_START_CONTINUOUS(hlptim);
+
+  /* Change the LPTIM state */
+  hlptim->State = HAL_LPTIM_STATE_READY;
+
+  /* Return function status */
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop the periodic trigger and its DMA transfer if any.
+  * @note   The auto-reload and compare 1 values are left as programmed by the
+  *         start function: call HAL_LPTIM_Init() before starting another mode.
+  * @param  hlptim LPTIM handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_LPTIM_SamplingTrigger_Stop(LPTIM_HandleTypeDef *hlptim)
+{
+  /* Check the parameters */
+  assert_param(IS_LPTIM_CC1_INSTANCE(hlptim->Instance));
+
+  /* Change the LPTIM state */
+  hlptim->State = HAL_LPTIM_STATE_BUSY;
+
+  if ((hlptim->Instance->DIER & LPTIM_DMA_UPDATE) != 0U)
+  {
+    /* Disable update event DMA request */
+    __HAL_LPTIM_DISABLE_DMA(hlptim, LPTIM_DMA_UPDATE);
+    (void)HAL_DMA_Abort_IT(hlptim->hdma[LPTIM_DMA_ID_UPDATE]);
+  }
+
+  /* Disable LPTIM signal on channel 1 */
+  __HAL_LPTIM_CAPTURE_COMPARE_DISABLE(hlptim, LPTIM_CHANNEL_1);
+
+  /* Disable the Peripheral */
+  __HAL_LPTIM_DISABLE(hlptim);
+
+  /* Set the LPTIM channel state */
+  LPTIM_CHANNEL_STATE_SET(hlptim, LPTIM_CHANNEL_1, HAL_LPTIM_CHANNEL_STATE_READY);
+
+  /* Set the LPTIM state */
+  hlptim->State = HAL_LPTIM_STATE_READY;
+
+  /* Return function status */
+  return HAL_OK;
+}
+
 /**
   * @}
   */
@@ -3695,6 +4088,58 @@ static void LPTIM_IC2_SetConfig(LPTIM_HandleTypeDef *hlptim, const LPTIM_IC_Conf
   hlptim->Instance->CFGR2 = tmpcfgr2;
 }
 
+/**
+  * @brief  Program the period and the compare value of the sampling trigger.
+  * @note   The LPTIM is left enabled and busy, channel 1 in PWM mode.
+  * @param  hlptim LPTIM handle
+  * @param  Period Trigger period in LPTIM counter clock cycles, from 2 to 0x10000.
+  * @param  Pulse Compare value of the trigger edge, lower than Period.
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef LPTIM_SamplingTrigger_SetConfig(LPTIM_HandleTypeDef *hlptim, uint32_t Period, uint32_t Pulse)
+{
+  if ((Period < 2U) || (Period > 0x10000U) || (Pulse >= Period))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Set the LPTIM state */
+  hlptim->State = HAL_LPTIM_STATE_BUSY;
+
+  /* Set the LPTIM channel state */
+  LPTIM_CHANNEL_STATE_SET(hlptim, LPTIM_CHANNEL_1, HAL_LPTIM_CHANNEL_STATE_BUSY);
+
+  /* Reset WAVE bit to set PWM mode, and select the output compare on channel 1 */
+  hlptim->Instance->CFGR &= ~LPTIM_CFGR_WAVE;
+  hlptim->Instance->CCMR1 &= ~LPTIM_CCMR1_CC1SEL;
+
+  /* Enable the Peripheral */
+  __HAL_LPTIM_ENABLE(hlptim);
+
+  /* Clear flags */
+  __HAL_LPTIM_CLEAR_FLAG(hlptim, LPTIM_FLAG_ARROK | LPTIM_FLAG_CMP1OK);
+
+  /* Set the trigger period */
+  __HAL_LPTIM_AUTORELOAD_SET(hlptim, Period - 1U);
+
+  /* Wait for the completion of the write operation to the LPTIM_ARR register */
+  if (LPTIM_WaitForFlag(hlptim, LPTIM_FLAG_ARROK) == HAL_TIMEOUT)
+  {
+    return HAL_TIMEOUT;
+  }
+
+  /* Set the trigger edge position */
+  __HAL_LPTIM_COMPARE_SET(hlptim, LPTIM_CHANNEL_1, Pulse);
+
+  /* Wait for the completion of the write operation to the LPTIM_CCR1 register */
+  if (LPTIM_WaitForFlag(hlptim, LPTIM_FLAG_CMP1OK) == HAL_TIMEOUT)
+  {
+    return HAL_TIMEOUT;
+  }
+
+  return HAL_OK;
+}
+
 /**
   * @brief  Start the DMA data transfer.
   * @param  hdma DMA handle
@@ -7,7 +7,7 @@
   *          functionalities of the RAMs configuration controller peripheral:
   *           + RAMCFG Initialization and De-initialization Functions.
   *           + RAMCFG ECC Operation Functions.
-  *           + RAMCFG Configure Wait State Functions.
+  *           + RAMCFG Configuration Functions.
   *           + RAMCFG Write Protection Functions.
   *           + RAMCFG Erase Operation Functions.
   *           + RAMCFG Handle Interrupt and Callbacks Functions.
@@ -32,9 +32,6 @@
 
     (+) Each SRAM can be erased independently through its RAMCFG instance.
 
-    (+) The wait state value for each SRAM can be configured independently
-        through its RAMCFG instance.
-
     (+) SRAM2 is divided to 64 pages with 1 kB granularity. Each page can be
         write protected independently through its RAMCFG instance.
 
@@ -80,6 +77,18 @@
               error was detected. This API is used in silent mode (No ECC interrupt
               is enabled).
 
+     *** Configuration feature ***
+     =============================
+    [..]
+          (+) Call HAL_RAMCFG_Config() at boot, for each SRAM, to set up the
+              ECC mechanism, erase the SRAM by hardware and enable the ECC
+              interrupts in one step and in the right order.
+                    (++) ECC is enabled only where requested: SRAMs holding
+                         buffers that do not need it keep it disabled.
+                    (++) The erase writes the whole SRAM with valid ECC, much
+                         faster than a CPU loop. It is refused for the SRAM
+                         holding the stack of the caller.
+
      *** Write protection feature ***
      ================================
     [..]
@@ -146,6 +155,7 @@
 
 /* Private macros ------------------------------------------------------------*/
 /* Private functions ---------------------------------------------------------*/
+static uint32_t RAMCFG_IsStackInSRAM(const RAMCFG_TypeDef *Instance);
 /* Exported functions --------------------------------------------------------*/
 
 /** @addtogroup RAMCFG_Exported_Functions
@@ -567,6 +577,142 @@ uint32_t HAL_RAMCFG_GetDoubleErrorAddress(const RAMCFG_HandleTypeDef *hramcfg)
   * @}
   */
 
+/** @addtogroup RAMCFG_Exported_Functions_Group3
+  *
+@verbatim
+ ===============================================================================
+                      ##### Configuration Functions  #####
+ ===============================================================================
+    [..]
+      This section provides functions allowing to configure an SRAM at boot.
+    [..]
+      The HAL_RAMCFG_Config() function enables or disables the ECC mechanism,
+      then erases the SRAM by hardware and then enables the ECC interrupts.
+      The ECC being computed on write, an SRAM on which ECC is enabled must be
+      erased or fully written before being read. There is no wait state to
+      configure, the SRAMs being accessed at HCLK frequency without wait state
+      in all voltage scaling ranges.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Configure the ECC, the erase and the ECC interrupts of the given SRAM.
+  * @param  hramcfg : Pointer to a RAMCFG_HandleTypeDef structure that contains
+  *                   the configuration information for the specified RAMCFG
+  *                   instance.
+  * @param  pConfig : Pointer to a RAMCFG_ConfigTypeDef structure that contains
+  *                   the configuration of the SRAM.
+  * @note   The erase is refused with HAL_RAMCFG_ERROR_PARAM when the stack of
+  *         the caller is located in the SRAM: the variables of the startup
+  *         code located in this SRAM must be initialized after the call.
+  * @retval HAL status.
+  */
+HAL_StatusTypeDef HAL_RAMCFG_Config(RAMCFG_HandleTypeDef *hramcfg, const RAMCFG_ConfigTypeDef *pConfig)
+{
+  uint32_t tickstart;
+
+  /* Check the RAMCFG peripheral handle and the configuration */
+  if ((hramcfg == NULL) || (pConfig == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the parameters */
+  assert_param(IS_RAMCFG_ALL_INSTANCE(hramcfg->Instance));
+  assert_param(IS_RAMCFG_ECC_SETTING(pConfig->ECC));
+  assert_param(IS_RAMCFG_ERASE_SETTING(pConfig->Erase));
+  assert_param(IS_RAMCFG_NOTIFICATIONS(pConfig->Notifications));
+
+  /* Check RAMCFG state */
+  if (hramcfg->State != HAL_RAMCFG_STATE_READY)
+  {
+    /* Update the error code and return error status */
+    hramcfg->ErrorCode = HAL_RAMCFG_ERROR_BUSY;
+    return HAL_ERROR;
+  }
+
+  /* Do not erase the stack of the caller */
+  if ((pConfig->Erase == RAMCFG_ERASE_ENABLE) && (RAMCFG_IsStackInSRAM(hramcfg->Instance) != 0U))
+  {
+    hramcfg->ErrorCode = HAL_RAMCFG_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  /* Update RAMCFG peripheral state */
+  hramcfg->State = HAL_RAMCFG_STATE_BUSY;
+
+  /* ECC setting, before the erase so that the erased SRAM holds valid ECC */
+  if (pConfig->ECC == RAMCFG_ECC_ENABLE)
+  {
+    assert_param(IS_RAMCFG_ECC_INSTANCE(hramcfg->Instance));
+
+    /* Start the SRAM ECC mechanism and latching the error address */
+    hramcfg->Instance->CR |= (RAMCFG_CR_ECCE | RAMCFG_CR_ALE);
+  }
+  else if (pConfig->ECC == RAMCFG_ECC_DISABLE)
+  {
+    assert_param(IS_RAMCFG_ECC_INSTANCE(hramcfg->Instance));
+
+    if ((hramcfg->Instance->CR & RAMCFG_CR_ECCE) == RAMCFG_CR_ECCE)
+    {
+      /* Unlock the SRAM ECC bit */
+      WRITE_REG(hramcfg->Instance->ECCKEY, RAMCFG_ECC_KEY1);
+      WRITE_REG(hramcfg->Instance->ECCKEY, RAMCFG_ECC_KEY2);
+
+      /* Stop the SRAM ECC mechanism and latching the error address */
+      hramcfg->Instance->CR &= ~(RAMCFG_CR_ECCE | RAMCFG_CR_ALE);
+    }
+  }
+  else
+  {
+    /* ECC mechanism left unchanged */
+  }
+
+  if (pConfig->Erase == RAMCFG_ERASE_ENABLE)
+  {
+    tickstart = HAL_GetTick();
+
+    /* Unlock the RAMCFG erase bit */
+    WRITE_REG(hramcfg->Instance->ERKEYR, RAMCFG_ERASE_KEY1);
+    WRITE_REG(hramcfg->Instance->ERKEYR, RAMCFG_ERASE_KEY2);
+
+    /* Start the SRAM erase operation */
+    hramcfg->Instance->CR |= RAMCFG_CR_SRAMER;
+
+    /* Wait for the SRAM hardware erase operation to complete */
+    while (__HAL_RAMCFG_GET_FLAG(hramcfg, RAMCFG_FLAG_SRAMBUSY) != 0U)
+    {
+      if ((HAL_GetTick() - tickstart) > RAMCFG_TIMEOUT_VALUE)
+      {
+        /* Update the RAMCFG error code */
+        hramcfg->ErrorCode = HAL_RAMCFG_ERROR_TIMEOUT;
+
+        /* Update the RAMCFG state and return error status */
+        hramcfg->State = HAL_RAMCFG_STATE_ERROR;
+        return HAL_ERROR;
+      }
+    }
+  }
+
+  if (pConfig->Notifications != 0U)
+  {
+    /* Clear the flags of errors detected before the configuration */
+    __HAL_RAMCFG_CLEAR_FLAG(hramcfg, RAMCFG_FLAG_SINGLEERR | RAMCFG_FLAG_DOUBLEERR);
+
+    __HAL_RAMCFG_ENABLE_IT(hramcfg, pConfig->Notifications);
+  }
+
+  /* Update the RAMCFG state */
+  hramcfg->State = HAL_RAMCFG_STATE_READY;
+
+  return HAL_OK;
+}
+/**
+  * @}
+  */
+
 /** @addtogroup RAMCFG_Exported_Functions_Group4
   *
 @verbatim
@@ -1068,12 +1214,58 @@ uint32_t HAL_RAMCFG_GetError(const RAMCFG_HandleTypeDef *hramcfg)
   * @}
   */
 
+/**
+  * @}
+  */
+
+/** @addtogroup RAMCFG_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Check whether the stack of the caller is located in the given SRAM.
+  * @param  Instance : RAMCFG instance.
+  * @retval 1 if the stack is in the SRAM, 0 otherwise.
+  */
+static uint32_t RAMCFG_IsStackInSRAM(const RAMCFG_TypeDef *Instance)
+{
+  __IO uint32_t marker = 0U;
+  uint32_t stack = (uint32_t)&marker;
+  uint32_t base;
+  uint32_t size;
+
+  if (Instance == RAMCFG_SRAM1)
+  {
+    base = SRAM1_BASE;
+    size = SRAM1_SIZE;
+  }
+  else if (Instance == RAMCFG_SRAM2)
+  {
+    base = SRAM2_BASE;
+    size = SRAM2_SIZE;
+  }
+#if defined (RAMCFG_SRAM3)
+  else if (Instance == RAMCFG_SRAM3)
+  {
+    base = SRAM3_BASE;
+    size = SRAM3_SIZE;
+  }
+#endif /* RAMCFG_SRAM3 */
+  else
+  {
+    /* Backup SRAM, not used for the stack */
+    return 0U;
+  }
+
+  return (((stack - base) < size) ? 1U : 0U);
+}
 
-#endif /* HAL_RAMCFG_MODULE_ENABLED */
 /**
   * @}
   */
 
+#endif /* HAL_RAMCFG_MODULE_ENABLED */
+
 /**
   * @}
   */
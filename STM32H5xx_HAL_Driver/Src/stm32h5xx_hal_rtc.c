@@ -212,8 +212,17 @@
 
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
+/* Seconds from 1970-01-01 (Unix epoch) to 2000-01-01, origin of the RTC calendar */
+#define RTC_EPOCH_2000_SECONDS    946684800U
+
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
+/* Days of a non leap year before the first day of each month */
+static const uint16_t RTC_DaysBeforeMonth[12] =
+{
+  0U, 31U, 59U, 90U, 120U, 151U, 181U, 212U, 243U, 273U, 304U, 334U
+};
+
 /* Private function prototypes -----------------------------------------------*/
 /* Exported functions --------------------------------------------------------*/
 
@@ -989,6 +998,10 @@ __weak void HAL_RTC_MspDeInit(RTC_HandleTypeDef *hrtc)
  ===============================================================================
 
  [..] This section provides functions allowing to configure Time and Date features
+ [..] HAL_RTC_GetTimestamp() returns the current time as a single 64-bit count of
+      sub-second ticks, read consistently from the RTC_SSR, RTC_TR and RTC_DR
+      registers, for cheap timestamping. HAL_RTC_GetTimestampFrequency() gives
+      the number of ticks per second
 
 @endverbatim
   * @{
@@ -1296,6 +1309,136 @@ HAL_StatusTypeDef HAL_RTC_GetDate(const RTC_HandleTypeDef *hrtc, RTC_DateTypeDef
   return HAL_OK;
 }
 
+/**
+  * @brief  Get the current RTC time as a sub-second timestamp.
+  * @note   The RTC_SSR, RTC_TR and RTC_DR registers are read once each, in the order
+  *         locking the calendar shadow registers, so that HAL_RTC_GetDate() does not
+  *         need to be called afterwards. When the shadow registers are bypassed, the
+  *         calendar registers are read again until they are stable.
+  * @note   The timestamp counts ticks of HAL_RTC_GetTimestampFrequency() Hz :
+  *          if Binary mode is RTC_BINARY_NONE or RTC_BINARY_MIX, ticks since 1970-01-01
+  *            00:00:00 (Unix epoch), the RTC calendar year being taken as 20YY. The
+  *            12-hour format is taken into account
+  *          if Binary mode is RTC_BINARY_ONLY, ticks of the binary counter since it was
+  *            last reset to 0xFFFFFFFF by HAL_RTC_SetTime(), on 32 bits
+  * @note   In BCD mode, the sub-second value is only valid if no shift operation makes
+  *         RTC_SSR greater than PREDIV_S (see HAL_RTCEx_SetSynchroShift()).
+  * @param  hrtc RTC handle
+  * @retval Timestamp in sub-second ticks
+  */
+uint64_t HAL_RTC_GetTimestamp(const RTC_HandleTypeDef *hrtc)
+{
+  uint32_t binmode;
+  uint32_t ssr;
+  uint32_t tr;
+  uint32_t dr;
+  uint32_t hours;
+  uint32_t year;
+  uint32_t month;
+  uint32_t days;
+  uint32_t seconds;
+  uint32_t fraction;
+  uint32_t frequency;
+
+  binmode = READ_BIT(RTC->ICSR, RTC_ICSR_BIN);
+
+  if (binmode == RTC_BINARY_ONLY)
+  {
+    /* Binary down counter reloaded with 0xFFFFFFFF */
+    return (uint64_t)(0xFFFFFFFFU - READ_REG(RTC->SSR));
+  }
+
+  if (READ_BIT(RTC->CR, RTC_CR_BYPSHAD) == 0U)
+  {
+    /* Reading RTC_SSR locks RTC_TR and RTC_DR until RTC_DR is read */
+    ssr = READ_REG(RTC->SSR);
+    tr  = READ_REG(RTC->TR);
+    dr  = READ_REG(RTC->DR);
+  }
+  else
+  {
+    /* Direct reads of the counters : retry if the second changed meanwhile */
+    do
+    {
+      tr  = READ_REG(RTC->TR);
+      dr  = READ_REG(RTC->DR);
+      ssr = READ_REG(RTC->SSR);
+    } while ((tr != READ_REG(RTC->TR)) || (dr != READ_REG(RTC->DR)));
+  }
+
+  if (binmode == RTC_BINARY_MIX)
+  {
+    /* The BCD second is incremented each time SS[7+BCDU:0] reaches 0 */
+    frequency = 1UL << (8U + (READ_BIT(RTC->ICSR, RTC_ICSR_BCDU) >> RTC_ICSR_BCDU_Pos));
+    fraction  = (~ssr) & (frequency - 1U);
+  }
+  else
+  {
+    frequency = (READ_REG(RTC->PRER) & RTC_PRER_PREDIV_S) + 1U;
+    fraction  = (frequency - 1U) - (ssr & RTC_SSR_SS);
+  }
+
+  /* Time of the day */
+  hours = RTC_Bcd2ToByte((uint8_t)((tr & (RTC_TR_HT | RTC_TR_HU)) >> RTC_TR_HU_Pos));
+  if (READ_BIT(RTC->CR, RTC_CR_FMT) != 0U)
+  {
+    hours = (hours % 12U) + (((tr & RTC_TR_PM) != 0U) ? 12U : 0U);
+  }
+  seconds = (hours * 3600U) +
+            ((uint32_t)RTC_Bcd2ToByte((uint8_t)((tr & (RTC_TR_MNT | RTC_TR_MNU)) >> RTC_TR_MNU_Pos)) * 60U) +
+            (uint32_t)RTC_Bcd2ToByte((uint8_t)((tr & (RTC_TR_ST | RTC_TR_SU)) >> RTC_TR_SU_Pos));
+
+  /* Days since 2000-01-01 */
+  year  = RTC_Bcd2ToByte((uint8_t)((dr & (RTC_DR_YT | RTC_DR_YU)) >> RTC_DR_YU_Pos));
+  month = RTC_Bcd2ToByte((uint8_t)((dr & (RTC_DR_MT | RTC_DR_MU)) >> RTC_DR_MU_Pos));
+  days  = (year * 365U) + ((year + 3U) / 4U) + RTC_DaysBeforeMonth[(month - 1U) % 12U] +
+          RTC_Bcd2ToByte((uint8_t)((dr & (RTC_DR_DT | RTC_DR_DU)) >> RTC_DR_DU_Pos)) - 1U;
+  if (((year & 3U) == 0U) && (month > 2U))
+  {
+    days++;
+  }
+
+  seconds += (days * 86400U) + RTC_EPOCH_2000_SECONDS;
+
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hrtc);
+
+  return ((uint64_t)seconds * frequency) + fraction;
+}
+
+/**
+  * @brief  Get the number of HAL_RTC_GetTimestamp() ticks per second.
+  * @param  hrtc RTC handle
+  * @retval Ticks per second
+  *          if Binary mode is RTC_BINARY_NONE, PREDIV_S + 1
+  *          if Binary mode is RTC_BINARY_MIX, 2^(8 + BCDU)
+  *          if Binary mode is RTC_BINARY_ONLY, 0 : the binary counter is clocked by
+  *            ck_apre, RTCCLK / (PREDIV_A + 1), whose frequency is not known by the driver
+  */
+uint32_t HAL_RTC_GetTimestampFrequency(const RTC_HandleTypeDef *hrtc)
+{
+  uint32_t binmode = READ_BIT(RTC->ICSR, RTC_ICSR_BIN);
+  uint32_t frequency;
+
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hrtc);
+
+  if (binmode == RTC_BINARY_ONLY)
+  {
+    frequency = 0U;
+  }
+  else if (binmode == RTC_BINARY_MIX)
+  {
+    frequency = 1UL << (8U + (READ_BIT(RTC->ICSR, RTC_ICSR_BCDU) >> RTC_ICSR_BCDU_Pos));
+  }
+  else
+  {
+    frequency = (READ_REG(RTC->PRER) & RTC_PRER_PREDIV_S) + 1U;
+  }
+
+  return frequency;
+}
+
 /**
   * @brief  Daylight Saving Time, Add one hour to the calendar in one single operation
   *         without going through the initialization procedure.
@@ -54,6 +54,13 @@
       (#) Initialize the SPI registers by calling the HAL_SPI_Init() API:
           (++) This API configures also the low level Hardware GPIO, CLOCK, CORTEX...etc)
               by calling the customized HAL_SPI_MspInit() API.
+     [..]
+       Interrupt mode FIFO usage:
+
+      (#) When the FifoThreshold is above SPI_FIFO_THRESHOLD_01DATA, the interrupt mode
+          transfers move a whole FIFO packet per TXP/RXP interrupt, with 32-bit accesses
+          packing the 8-bit and 16-bit data. A last packet shorter than the threshold is
+          completed data per data or on end of transfer.
      [..]
        Callback registration:
 
@@ -183,6 +190,12 @@ static void SPI_TxISR_32BIT(SPI_HandleTypeDef *hspi);
 static void SPI_RxISR_8BIT(SPI_HandleTypeDef *hspi);
 static void SPI_RxISR_16BIT(SPI_HandleTypeDef *hspi);
 static void SPI_RxISR_32BIT(SPI_HandleTypeDef *hspi);
+static void SPI_TxISR_8BIT_FIFO(SPI_HandleTypeDef *hspi);
+static void SPI_TxISR_16BIT_FIFO(SPI_HandleTypeDef *hspi);
+static void SPI_TxISR_32BIT_FIFO(SPI_HandleTypeDef *hspi);
+static void SPI_RxISR_8BIT_FIFO(SPI_HandleTypeDef *hspi);
+static void SPI_RxISR_16BIT_FIFO(SPI_HandleTypeDef *hspi);
+static void SPI_RxISR_32BIT_FIFO(SPI_HandleTypeDef *hspi);
 static void SPI_AbortTransfer(SPI_HandleTypeDef *hspi);
 static void SPI_CloseTransfer(SPI_HandleTypeDef *hspi);
 static uint32_t SPI_GetPacketSize(const SPI_HandleTypeDef *hspi);
@@ -1515,15 +1528,15 @@ HAL_StatusTypeDef HAL_SPI_Transmit_IT(SPI_HandleTypeDef *hspi, const uint8_t *pD
   /* Set the function for IT treatment */
   if ((hspi->Init.DataSize > SPI_DATASIZE_16BIT) && (IS_SPI_FULL_INSTANCE(hspi->Instance)))
   {
-    hspi->TxISR = SPI_TxISR_32BIT;
+    hspi->TxISR = (hspi->Init.FifoThreshold > SPI_FIFO_THRESHOLD_01DATA) ? SPI_TxISR_32BIT_FIFO : SPI_TxISR_32BIT;
   }
   else if (hspi->Init.DataSize > SPI_DATASIZE_8BIT)
   {
-    hspi->TxISR = SPI_TxISR_16BIT;
+    hspi->TxISR = (hspi->Init.FifoThreshold > SPI_FIFO_THRESHOLD_01DATA) ? SPI_TxISR_16BIT_FIFO : SPI_TxISR_16BIT;
   }
   else
   {
-    hspi->TxISR = SPI_TxISR_8BIT;
+    hspi->TxISR = (hspi->Init.FifoThreshold > SPI_FIFO_THRESHOLD_01DATA) ? SPI_TxISR_8BIT_FIFO : SPI_TxISR_8BIT;
   }
 
   /* Configure communication direction : 1Line */
@@ -1603,15 +1616,15 @@ HAL_StatusTypeDef HAL_SPI_Receive_IT(SPI_HandleTypeDef *hspi, uint8_t *pData, ui
   /* Set the function for IT treatment */
   if ((hspi->Init.DataSize > SPI_DATASIZE_16BIT) && (IS_SPI_FULL_INSTANCE(hspi->Instance)))
   {
-    hspi->RxISR = SPI_RxISR_32BIT;
+    hspi->RxISR = (hspi->Init.FifoThreshold > SPI_FIFO_THRESHOLD_01DATA) ? SPI_RxISR_32BIT_FIFO : SPI_RxISR_32BIT;
   }
   else if (hspi->Init.DataSize > SPI_DATASIZE_8BIT)
   {
-    hspi->RxISR = SPI_RxISR_16BIT;
+    hspi->RxISR = (hspi->Init.FifoThreshold > SPI_FIFO_THRESHOLD_01DATA) ? SPI_RxISR_16BIT_FIFO : SPI_RxISR_16BIT;
   }
   else
   {
-    hspi->RxISR = SPI_RxISR_8BIT;
+    hspi->RxISR = (hspi->Init.FifoThreshold > SPI_FIFO_THRESHOLD_01DATA) ? SPI_RxISR_8BIT_FIFO : SPI_RxISR_8BIT;
   }
 
   /* Configure communication direction : 1Line */
@@ -1701,18 +1714,18 @@ HAL_StatusTypeDef HAL_SPI_TransmitReceive_IT(SPI_HandleTypeDef *hspi, const uint
   /* Set the function for IT treatment */
   if ((hspi->Init.DataSize > SPI_DATASIZE_16BIT) && (IS_SPI_FULL_INSTANCE(hspi->Instance)))
   {
-    hspi->TxISR     = SPI_TxISR_32BIT;
-    hspi->RxISR     = SPI_RxISR_32BIT;
+    hspi->TxISR     = (hspi->Init.FifoThreshold > SPI_FIFO_THRESHOLD_01DATA) ? SPI_TxISR_32BIT_FIFO : SPI_TxISR_32BIT;
+    hspi->RxISR     = (hspi->Init.FifoThreshold > SPI_FIFO_THRESHOLD_01DATA) ? SPI_RxISR_32BIT_FIFO : SPI_RxISR_32BIT;
   }
   else if (hspi->Init.DataSize > SPI_DATASIZE_8BIT)
   {
-    hspi->RxISR     = SPI_RxISR_16BIT;
-    hspi->TxISR     = SPI_TxISR_16BIT;
+    hspi->RxISR     = (hspi->Init.FifoThreshold > SPI_FIFO_THRESHOLD_01DATA) ? SPI_RxISR_16BIT_FIFO : SPI_RxISR_16BIT;
+    hspi->TxISR     = (hspi->Init.FifoThreshold > SPI_FIFO_THRESHOLD_01DATA) ? SPI_TxISR_16BIT_FIFO : SPI_TxISR_16BIT;
   }
   else
   {
-    hspi->RxISR     = SPI_RxISR_8BIT;
-    hspi->TxISR     = SPI_TxISR_8BIT;
+    hspi->RxISR     = (hspi->Init.FifoThreshold > SPI_FIFO_THRESHOLD_01DATA) ? SPI_RxISR_8BIT_FIFO : SPI_RxISR_8BIT;
+    hspi->TxISR     = (hspi->Init.FifoThreshold > SPI_FIFO_THRESHOLD_01DATA) ? SPI_TxISR_8BIT_FIFO : SPI_TxISR_8BIT;
   }
 
   /* Set Full-Duplex mode */
@@ -3641,6 +3654,285 @@ static void SPI_TxISR_32BIT(SPI_HandleTypeDef *hspi)
   }
 }
 
+/**
+  * @brief  Manage the 8-bit receive of a whole FIFO packet in Interrupt context.
+  * @note   The packet data are read by 32-bit and 16-bit accesses. A last packet
+  *         shorter than the FIFO threshold is read one data per interrupt, or
+  *         drained on end of transfer.
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *               the configuration information for SPI module.
+  * @retval None
+  */
+static void SPI_RxISR_8BIT_FIFO(SPI_HandleTypeDef *hspi)
+{
+#if defined (__GNUC__)
+  __IO uint16_t *prxdr_16bits = (__IO uint16_t *)(&(hspi->Instance->RXDR));
+#endif /* __GNUC__ */
+  uint32_t count = (hspi->Init.FifoThreshold >> SPI_CFG1_FTHLV_Pos) + 1UL;
+
+  /* RXP only reports complete packets */
+  if (hspi->RxXferCount < count)
+  {
+    count = 1UL;
+  }
+  hspi->RxXferCount -= (uint16_t)count;
+
+  /* Receive data in packed 32 Bit mode */
+  while (count > 3UL)
+  {
+    *((uint32_t *)hspi->pRxBuffPtr) = (*(__IO uint32_t *)&hspi->Instance->RXDR);
+    hspi->pRxBuffPtr += sizeof(uint32_t);
+    count -= 4UL;
+  }
+
+  /* Receive the packet tail in 16 Bit and 8 Bit mode */
+  if (count > 1UL)
+  {
+#if defined (__GNUC__)
+    *((uint16_t *)hspi->pRxBuffPtr) = *prxdr_16bits;
+#else
+    *((uint16_t *)hspi->pRxBuffPtr) = (*(__IO uint16_t *)&hspi->Instance->RXDR);
+#endif /* __GNUC__ */
+    hspi->pRxBuffPtr += sizeof(uint16_t);
+    count -= 2UL;
+  }
+  if (count != 0UL)
+  {
+    *((uint8_t *)hspi->pRxBuffPtr) = (*(__IO uint8_t *)&hspi->Instance->RXDR);
+    hspi->pRxBuffPtr += sizeof(uint8_t);
+  }
+
+  /* Disable IT if no more data excepted */
+  if (hspi->RxXferCount == 0UL)
+  {
+    /* Disable RXP interrupts */
+    __HAL_SPI_DISABLE_IT(hspi, SPI_IT_RXP);
+  }
+}
+
+/**
+  * @brief  Manage the 16-bit receive of a whole FIFO packet in Interrupt context.
+  * @note   The packet data are read by pairs with 32-bit accesses. A last packet
+  *         shorter than the FIFO threshold is read one data per interrupt, or
+  *         drained on end of transfer.
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *               the configuration information for SPI module.
+  * @retval None
+  */
+static void SPI_RxISR_16BIT_FIFO(SPI_HandleTypeDef *hspi)
+{
+#if defined (__GNUC__)
+  __IO uint16_t *prxdr_16bits = (__IO uint16_t *)(&(hspi->Instance->RXDR));
+#endif /* __GNUC__ */
+  uint32_t count = (hspi->Init.FifoThreshold >> SPI_CFG1_FTHLV_Pos) + 1UL;
+
+  /* RXP only reports complete packets */
+  if (hspi->RxXferCount < count)
+  {
+    count = 1UL;
+  }
+  hspi->RxXferCount -= (uint16_t)count;
+
+  /* Receive data in packed 32 Bit mode */
+  while (count > 1UL)
+  {
+    *((uint32_t *)hspi->pRxBuffPtr) = (*(__IO uint32_t *)&hspi->Instance->RXDR);
+    hspi->pRxBuffPtr += sizeof(uint32_t);
+    count -= 2UL;
+  }
+
+  /* Receive the packet tail in 16 Bit mode */
+  if (count != 0UL)
+  {
+#if defined (__GNUC__)
+    *((uint16_t *)hspi->pRxBuffPtr) = *prxdr_16bits;
+#else
+    *((uint16_t *)hspi->pRxBuffPtr) = (*(__IO uint16_t *)&hspi->Instance->RXDR);
+#endif /* __GNUC__ */
+    hspi->pRxBuffPtr += sizeof(uint16_t);
+  }
+
+  /* Disable IT if no more data excepted */
+  if (hspi->RxXferCount == 0UL)
+  {
+    /* Disable RXP interrupts */
+    __HAL_SPI_DISABLE_IT(hspi, SPI_IT_RXP);
+  }
+}
+
+/**
+  * @brief  Manage the 32-bit receive of a whole FIFO packet in Interrupt context.
+  * @note   A last packet shorter than the FIFO threshold is read one data per
+  *         interrupt, or drained on end of transfer.
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *               the configuration information for SPI module.
+  * @retval None
+  */
+static void SPI_RxISR_32BIT_FIFO(SPI_HandleTypeDef *hspi)
+{
+  uint32_t count = (hspi->Init.FifoThreshold >> SPI_CFG1_FTHLV_Pos) + 1UL;
+
+  /* RXP only reports complete packets */
+  if (hspi->RxXferCount < count)
+  {
+    count = 1UL;
+  }
+  hspi->RxXferCount -= (uint16_t)count;
+
+  /* Receive data in 32 Bit mode */
+  while (count != 0UL)
+  {
+    *((uint32_t *)hspi->pRxBuffPtr) = (*(__IO uint32_t *)&hspi->Instance->RXDR);
+    hspi->pRxBuffPtr += sizeof(uint32_t);
+    count--;
+  }
+
+  /* Disable IT if no more data excepted */
+  if (hspi->RxXferCount == 0UL)
+  {
+    /* Disable RXP interrupts */
+    __HAL_SPI_DISABLE_IT(hspi, SPI_IT_RXP);
+  }
+}
+
+/**
+  * @brief  Handle the 8-bit transmit of a whole FIFO packet in Interrupt mode.
+  * @note   The packet data are written by 32-bit and 16-bit accesses, the last
+  *         packet may be shorter than the FIFO threshold.
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *               the configuration information for SPI module.
+  * @retval None
+  */
+static void SPI_TxISR_8BIT_FIFO(SPI_HandleTypeDef *hspi)
+{
+#if defined (__GNUC__)
+  __IO uint16_t *ptxdr_16bits = (__IO uint16_t *)(&(hspi->Instance->TXDR));
+#endif /* __GNUC__ */
+  uint32_t count = (hspi->Init.FifoThreshold >> SPI_CFG1_FTHLV_Pos) + 1UL;
+
+  /* TXP reports room for a complete packet */
+  if (hspi->TxXferCount < count)
+  {
+    count = hspi->TxXferCount;
+  }
+  hspi->TxXferCount -= (uint16_t)count;
+
+  /* Transmit data in packed 32 Bit mode */
+  while (count > 3UL)
+  {
+    *((__IO uint32_t *)&hspi->Instance->TXDR) = *((const uint32_t *)hspi->pTxBuffPtr);
+    hspi->pTxBuffPtr += sizeof(uint32_t);
+    count -= 4UL;
+  }
+
+  /* Transmit the packet tail in 16 Bit and 8 Bit mode */
+  if (count > 1UL)
+  {
+#if defined (__GNUC__)
+    *ptxdr_16bits = *((const uint16_t *)hspi->pTxBuffPtr);
+#else
+    *((__IO uint16_t *)&hspi->Instance->TXDR) = *((const uint16_t *)hspi->pTxBuffPtr);
+#endif /* __GNUC__ */
+    hspi->pTxBuffPtr += sizeof(uint16_t);
+    count -= 2UL;
+  }
+  if (count != 0UL)
+  {
+    *(__IO uint8_t *)&hspi->Instance->TXDR = *((const uint8_t *)hspi->pTxBuffPtr);
+    hspi->pTxBuffPtr += sizeof(uint8_t);
+  }
+
+  /* Disable IT if no more data excepted */
+  if (hspi->TxXferCount == 0UL)
+  {
+    /* Disable TXP interrupts */
+    __HAL_SPI_DISABLE_IT(hspi, SPI_IT_TXP);
+  }
+}
+
+/**
+  * @brief  Handle the 16-bit transmit of a whole FIFO packet in Interrupt mode.
+  * @note   The packet data are written by pairs with 32-bit accesses, the last
+  *         packet may be shorter than the FIFO threshold.
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *               the configuration information for SPI module.
+  * @retval None
+  */
+static void SPI_TxISR_16BIT_FIFO(SPI_HandleTypeDef *hspi)
+{
+#if defined (__GNUC__)
+  __IO uint16_t *ptxdr_16bits = (__IO uint16_t *)(&(hspi->Instance->TXDR));
+#endif /* __GNUC__ */
+  uint32_t count = (hspi->Init.FifoThreshold >> SPI_CFG1_FTHLV_Pos) + 1UL;
+
+  /* TXP reports room for a complete packet */
+  if (hspi->TxXferCount < count)
+  {
+    count = hspi->TxXferCount;
+  }
+  hspi->TxXferCount -= (uint16_t)count;
+
+  /* Transmit data in packed 32 Bit mode */
+  while (count > 1UL)
+  {
+    *((__IO uint32_t *)&hspi->Instance->TXDR) = *((const uint32_t *)hspi->pTxBuffPtr);
+    hspi->pTxBuffPtr += sizeof(uint32_t);
+    count -= 2UL;
+  }
+
+  /* Transmit the packet tail in 16 Bit mode */
+  if (count != 0UL)
+  {
+#if defined (__GNUC__)
+    *ptxdr_16bits = *((const uint16_t *)hspi->pTxBuffPtr);
+#else
+    *((__IO uint16_t *)&hspi->Instance->TXDR) = *((const uint16_t *)hspi->pTxBuffPtr);
+#endif /* __GNUC__ */
+    hspi->pTxBuffPtr += sizeof(uint16_t);
+  }
+
+  /* Disable IT if no more data excepted */
+  if (hspi->TxXferCount == 0UL)
+  {
+    /* Disable TXP interrupts */
+    __HAL_SPI_DISABLE_IT(hspi, SPI_IT_TXP);
+  }
+}
+
+/**
+  * @brief  Handle the 32-bit transmit of a whole FIFO packet in Interrupt mode.
+  * @note   The last packet may be shorter than the FIFO threshold.
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *               the configuration information for SPI module.
+  * @retval None
+  */
+static void SPI_TxISR_32BIT_FIFO(SPI_HandleTypeDef *hspi)
+{
+  uint32_t count = (hspi->Init.FifoThreshold >> SPI_CFG1_FTHLV_Pos) + 1UL;
+
+  /* TXP reports room for a complete packet */
+  if (hspi->TxXferCount < count)
+  {
+    count = hspi->TxXferCount;
+  }
+  hspi->TxXferCount -= (uint16_t)count;
+
+  /* Transmit data in 32 Bit mode */
+  while (count != 0UL)
+  {
+    *((__IO uint32_t *)&hspi->Instance->TXDR) = *((const uint32_t *)hspi->pTxBuffPtr);
+    hspi->pTxBuffPtr += sizeof(uint32_t);
+    count--;
+  }
+
+  /* Disable IT if no more data excepted */
+  if (hspi->TxXferCount == 0UL)
+  {
+    /* Disable TXP interrupts */
+    __HAL_SPI_DISABLE_IT(hspi, SPI_IT_TXP);
+  }
+}
+
 /**
   * @brief  Abort Transfer and clear flags.
   * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
@@ -3769,6 +4061,9 @@ static HAL_StatusTypeDef SPI_WaitOnFlagUntilTimeout(const SPI_HandleTypeDef *hsp
   /* Wait until flag is set */
   while ((__HAL_SPI_GET_FLAG(hspi, Flag) ? SET : RESET) == Status)
   {
+    /* Let the application yield or sleep while waiting */
+    HAL_WaitHook(HAL_WAIT_SPI, hspi);
+
     /* Check for the Timeout */
     if ((((HAL_GetTick() - Tickstart) >=  Timeout) && (Timeout != HAL_MAX_DELAY)) || (Timeout == 0U))
     {
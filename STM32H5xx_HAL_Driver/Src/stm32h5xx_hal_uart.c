@@ -201,6 +201,7 @@ static void UART_EndRxTransfer(UART_HandleTypeDef *huart);
 #if defined(HAL_DMA_MODULE_ENABLED)
 static void UART_EndTxTransfer(UART_HandleTypeDef *huart);
 static void UART_DMATransmitCplt(DMA_HandleTypeDef *hdma);
+static void UART_DMATransmitFragCplt(DMA_HandleTypeDef *hdma);
 static void UART_DMAReceiveCplt(DMA_HandleTypeDef *hdma);
 static void UART_DMARxHalfCplt(DMA_HandleTypeDef *hdma);
 static void UART_DMATxHalfCplt(DMA_HandleTypeDef *hdma);
@@ -329,6 +330,10 @@ HAL_StatusTypeDef HAL_UART_Init(UART_HandleTypeDef *huart)
   {
     /* Allocate lock resource and initialize it */
     huart->Lock = HAL_UNLOCKED;
+    huart->pTxFrag = NULL;
+#if defined(HAL_DMA_MODULE_ENABLED)
+    huart->pTxSavedQueue = NULL;
+#endif /* HAL_DMA_MODULE_ENABLED */
 
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
     UART_InitCallbacksToDefault(huart);
@@ -394,6 +399,10 @@ HAL_StatusTypeDef HAL_HalfDuplex_Init(UART_HandleTypeDef *huart)
   {
     /* Allocate lock resource and initialize it */
     huart->Lock = HAL_UNLOCKED;
+    huart->pTxFrag = NULL;
+#if defined(HAL_DMA_MODULE_ENABLED)
+    huart->pTxSavedQueue = NULL;
+#endif /* HAL_DMA_MODULE_ENABLED */
 
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
     UART_InitCallbacksToDefault(huart);
@@ -480,6 +489,10 @@ HAL_StatusTypeDef HAL_LIN_Init(UART_HandleTypeDef *huart, uint32_t BreakDetectLe
   {
     /* Allocate lock resource and initialize it */
     huart->Lock = HAL_UNLOCKED;
+    huart->pTxFrag = NULL;
+#if defined(HAL_DMA_MODULE_ENABLED)
+    huart->pTxSavedQueue = NULL;
+#endif /* HAL_DMA_MODULE_ENABLED */
 
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
     UART_InitCallbacksToDefault(huart);
@@ -564,6 +577,10 @@ HAL_StatusTypeDef HAL_MultiProcessor_Init(UART_HandleTypeDef *huart, uint8_t Add
   {
     /* Allocate lock resource and initialize it */
     huart->Lock = HAL_UNLOCKED;
+    huart->pTxFrag = NULL;
+#if defined(HAL_DMA_MODULE_ENABLED)
+    huart->pTxSavedQueue = NULL;
+#endif /* HAL_DMA_MODULE_ENABLED */
 
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
     UART_InitCallbacksToDefault(huart);
@@ -1054,6 +1071,7 @@ HAL_StatusTypeDef HAL_UART_UnRegisterRxEventCallback(UART_HandleTypeDef *huart)
 
     (#) Non-Blocking mode API's with DMA are :
         (+) HAL_UART_Transmit_DMA()
+        (+) HAL_UARTEx_TransmitV_DMA()
         (+) HAL_UART_Receive_DMA()
         (+) HAL_UART_DMAPause()
         (+) HAL_UART_DMAResume()
@@ -1524,6 +1542,172 @@ HAL_StatusTypeDef HAL_UART_Transmit_DMA(UART_HandleTypeDef *huart, const uint8_t
   }
 }
 
+/**
+  * @brief Send a list of fragments back-to-back in DMA mode.
+  * @note   When the Tx DMA channel is in normal mode, the fragments are chained from the DMA transfer
+  *         complete interrupt. When it is in linked-list mode, one node per fragment is built in the
+  *         Node field of each list entry, using the head node of the queue linked to the channel as
+  *         template, and the whole list is sent with a single DMA start and a single transfer complete.
+  *         The queue linked to the channel is restored once the last fragment is sent.
+  * @note   HAL_UART_TxCpltCallback() is executed once, after the last fragment.
+  * @note   The fragment list and the data it points to must stay valid until then. In linked-list mode the
+  *         list must be placed in a memory area addressable by the DMA and must not cross a 64 Kbytes
+  *         boundary (nodes share the DMA channel CLBAR base address).
+  * @note   If the transmission is aborted, the queue previously linked to the channel is not restored and
+  *         must be linked again by the application with HAL_DMAEx_List_LinkQ().
+  * @note   When UART parity is not enabled (PCE = 0), and Word Length is configured to 9 bits (M1-M0 = 01),
+  *         the sent data is handled as a set of u16. In this case, Size of each fragment must indicate
+  *         the number of u16 provided through pData.
+  * @param huart   UART handle.
+  * @param pFrags  Pointer to the fragment list.
+  * @param NbFrags Number of fragments in the list.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UARTEx_TransmitV_DMA(UART_HandleTypeDef *huart, UART_TxFragmentTypeDef *pFrags, uint32_t NbFrags)
+{
+  HAL_StatusTypeDef status;
+  DMA_NodeConfTypeDef node_config;
+  uint32_t shift = 0U;
+  uint32_t i;
+
+  /* Check that a Tx process is not already ongoing */
+  if (huart->gState == HAL_UART_STATE_READY)
+  {
+    if ((pFrags == NULL) || (NbFrags == 0U) || (huart->hdmatx == NULL))
+    {
+      return HAL_ERROR;
+    }
+
+    for (i = 0U; i < NbFrags; i++)
+    {
+      if ((pFrags[i].pData == NULL) || (pFrags[i].Size == 0U))
+      {
+        return HAL_ERROR;
+      }
+    }
+
+    /* In case of 9bits/No Parity transfer, pData buffers provided as input parameter
+       should be aligned on a u16 frontier, so byte counts are twice the fragment sizes */
+    if ((huart->Init.WordLength == UART_WORDLENGTH_9B) && (huart->Init.Parity == UART_PARITY_NONE))
+    {
+      shift = 1U;
+    }
+
+    huart->pTxBuffPtr  = pFrags[0].pData;
+    huart->TxXferSize  = pFrags[0].Size;
+    huart->TxXferCount = pFrags[0].Size;
+    huart->pTxFrag     = &pFrags[1];
+    huart->TxFragCount = NbFrags - 1U;
+
+    huart->ErrorCode = HAL_UART_ERROR_NONE;
+    huart->gState = HAL_UART_STATE_BUSY_TX;
+
+    /* Set the UART DMA transfer complete callback, which chains the fragments */
+    huart->hdmatx->XferCpltCallback = UART_DMATransmitFragCplt;
+
+    /* No half transfer notification in this mode */
+    huart->hdmatx->XferHalfCpltCallback = NULL;
+
+    /* Set the DMA error callback */
+    huart->hdmatx->XferErrorCallback = UART_DMAError;
+
+    /* Set the DMA abort callback */
+    huart->hdmatx->XferAbortCallback = NULL;
+
+    /* Check linked list mode */
+    if ((huart->hdmatx->Mode & DMA_LINKEDLIST) == DMA_LINKEDLIST)
+    {
+      status = HAL_ERROR;
+
+      if ((huart->hdmatx->Mode == DMA_LINKEDLIST_NORMAL) && (huart->hdmatx->LinkedListQueue != NULL)
+          && (huart->hdmatx->LinkedListQueue->Head != NULL))
+      {
+        /* Use the head node of the current queue as template for the fragment nodes */
+        status = HAL_DMAEx_List_GetNodeConfig(&node_config, huart->hdmatx->LinkedListQueue->Head);
+        node_config.Init.TransferEventMode = DMA_TCEM_LAST_LL_ITEM_TRANSFER;
+        node_config.DstAddress = (uint32_t)&huart->Instance->TDR;
+
+        huart->TxFragQueue.Head              = NULL;
+        huart->TxFragQueue.FirstCircularNode = NULL;
+        huart->TxFragQueue.NodeNumber        = 0U;
+        huart->TxFragQueue.State             = HAL_DMA_QUEUE_STATE_RESET;
+        huart->TxFragQueue.ErrorCode         = HAL_DMA_QUEUE_ERROR_NONE;
+        huart->TxFragQueue.Type              = QUEUE_TYPE_STATIC;
+
+        for (i = 0U; (i < NbFrags) && (status == HAL_OK); i++)
+        {
+          node_config.SrcAddress = (uint32_t)pFrags[i].pData;
+          node_config.DataSize   = (uint32_t)pFrags[i].Size << shift;
+
+          status = HAL_DMAEx_List_BuildNode(&node_config, &pFrags[i].Node);
+          if (status == HAL_OK)
+          {
+            status = HAL_DMAEx_List_InsertNode_Tail(&huart->TxFragQueue, &pFrags[i].Node);
+          }
+        }
+
+        if (status == HAL_OK)
+        {
+          huart->pTxSavedQueue = huart->hdmatx->LinkedListQueue;
+          (void)HAL_DMAEx_List_UnLinkQ(huart->hdmatx);
+          status = HAL_DMAEx_List_LinkQ(huart->hdmatx, &huart->TxFragQueue);
+        }
+
+        if (status == HAL_OK)
+        {
+          /* The whole list is sent at once */
+          huart->pTxFrag     = NULL;
+          huart->TxFragCount = 0U;
+
+          /* Enable the UART transmit DMA channel */
+          status = HAL_DMAEx_List_Start_IT(huart->hdmatx);
+        }
+
+        if ((status != HAL_OK) && (huart->pTxSavedQueue != NULL))
+        {
+          /* Give the channel its own queue back */
+          (void)HAL_DMAEx_List_UnLinkQ(huart->hdmatx);
+          (void)HAL_DMAEx_List_LinkQ(huart->hdmatx, huart->pTxSavedQueue);
+          huart->pTxSavedQueue = NULL;
+        }
+      }
+    }
+    else
+    {
+      /* Enable the UART transmit DMA channel */
+      status = HAL_DMA_Start_IT(huart->hdmatx, (uint32_t)pFrags[0].pData, (uint32_t)&huart->Instance->TDR,
+                                (uint32_t)pFrags[0].Size << shift);
+    }
+
+    if (status != HAL_OK)
+    {
+      huart->pTxFrag     = NULL;
+      huart->TxFragCount = 0U;
+
+      /* Set error code to DMA */
+      huart->ErrorCode = HAL_UART_ERROR_DMA;
+
+      /* Restore huart->gState to ready */
+      huart->gState = HAL_UART_STATE_READY;
+
+      return HAL_ERROR;
+    }
+
+    /* Clear the TC flag in the ICR register */
+    __HAL_UART_CLEAR_FLAG(huart, UART_CLEAR_TCF);
+
+    /* Enable the DMA transfer for transmit request by setting the DMAT bit
+    in the UART CR3 register */
+    ATOMIC_SET_BIT(huart->Instance->CR3, USART_CR3_DMAT);
+
+    return HAL_OK;
+  }
+  else
+  {
+    return HAL_BUSY;
+  }
+}
+
 /**
   * @brief Receive an amount of data in DMA mode.
   * @note   When the UART parity is enabled (PCE = 1), the received data contain
@@ -3416,6 +3600,9 @@ HAL_StatusTypeDef UART_WaitOnFlagUntilTimeout(UART_HandleTypeDef *huart, uint32_
   /* Wait until flag is set */
   while ((__HAL_UART_GET_FLAG(huart, Flag) ? SET : RESET) == Status)
   {
+    /* Let the application yield or sleep while waiting */
+    HAL_WaitHook(HAL_WAIT_UART, huart);
+
     /* Check for the Timeout */
     if (Timeout != HAL_MAX_DELAY)
     {
@@ -3716,6 +3903,67 @@ static void UART_DMATransmitCplt(DMA_HandleTypeDef *hdma)
   }
 }
 
+/**
+  * @brief DMA UART scatter-gather transmit fragment complete callback.
+  * @param hdma DMA handle.
+  * @retval None
+  */
+static void UART_DMATransmitFragCplt(DMA_HandleTypeDef *hdma)
+{
+  UART_HandleTypeDef *huart = (UART_HandleTypeDef *)(hdma->Parent);
+  const UART_TxFragmentTypeDef *frag;
+  uint32_t nbbyte;
+
+  if (huart->TxFragCount != 0U)
+  {
+    frag = huart->pTxFrag;
+    huart->pTxFrag++;
+    huart->TxFragCount--;
+
+    huart->pTxBuffPtr  = frag->pData;
+    huart->TxXferSize  = frag->Size;
+    huart->TxXferCount = frag->Size;
+
+    nbbyte = frag->Size;
+    if ((huart->Init.WordLength == UART_WORDLENGTH_9B) && (huart->Init.Parity == UART_PARITY_NONE))
+    {
+      nbbyte = (uint32_t)frag->Size * 2U;
+    }
+
+    /* DMAT is left set: the pending TXE request restarts the channel at once */
+    if (HAL_DMA_Start_IT(hdma, (uint32_t)frag->pData, (uint32_t)&huart->Instance->TDR, nbbyte) != HAL_OK)
+    {
+      huart->pTxFrag     = NULL;
+      huart->TxFragCount = 0U;
+      huart->TxXferCount = 0U;
+      huart->ErrorCode |= HAL_UART_ERROR_DMA;
+      ATOMIC_CLEAR_BIT(huart->Instance->CR3, USART_CR3_DMAT);
+      UART_EndTxTransfer(huart);
+
+#if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
+      /*Call registered error callback*/
+      huart->ErrorCallback(huart);
+#else
+      /*Call legacy weak error callback*/
+      HAL_UART_ErrorCallback(huart);
+#endif /* USE_HAL_UART_REGISTER_CALLBACKS */
+    }
+  }
+  else
+  {
+    if (huart->pTxSavedQueue != NULL)
+    {
+      /* Give the channel its own queue back */
+      (void)HAL_DMAEx_List_UnLinkQ(hdma);
+      (void)HAL_DMAEx_List_LinkQ(hdma, huart->pTxSavedQueue);
+      huart->pTxSavedQueue = NULL;
+    }
+
+    huart->pTxFrag = NULL;
+    UART_DMATransmitCplt(hdma);
+  }
+}
+
 /**
   * @brief DMA UART transmit process half complete callback.
   * @param hdma DMA handle.
@@ -14,6 +14,7 @@
               + DMA channel configuration for indirect functional mode
               + Errors management and abort functionality
               + Delay block configuration
+              + RAM memory-mapped profile
   ******************************************************************************
   * @attention
   *
@@ -134,6 +135,23 @@
      After the configuration, the OctoSPI will be used as soon as an access on the AHB is done on
      the address range. HAL_XSPI_TimeOutCallback() will be called when the timeout expires.
 
+    *** RAM memory-mapped profile ***
+    =================================
+    [..]
+     To use an AP Memory PSRAM or a HyperRAM as system memory (heap, frame buffer),
+     initialize the XSPI with HAL_XSPI_Init() and configure the memory itself (latency,
+     burst length, drive strength) in indirect mode. Then fill in a XSPI_RamProfileTypeDef
+     from the memory datasheet and call HAL_XSPI_RAM_MemoryMapped() :
+     (+) The clock prescaler is the smallest one meeting the memory maximum frequency,
+         with an even division ratio for a 50% duty cycle in DTR mode.
+     (+) The refresh counter releases the chip select before the maximum chip select
+         low time, and the chip select boundary splits the bursts on the memory pages.
+     (+) The read, write and, if wrapped reads are used, wrap commands are configured
+         in octal DTR with DQS, and the memory-mapped mode is started.
+    [..]
+     HAL_XSPI_RAM_Benchmark() then measures the write and read bandwidths and the random
+     read latency of the memory-mapped area, and checks the data read back.
+
     *** Errors management and abort functionality ***
     =================================================
     [..]
@@ -264,6 +282,8 @@
 /* Private typedef -----------------------------------------------------------*/
 
 /* Private define ------------------------------------------------------------*/
+#define XSPI_RAM_REFRESH_MARGIN_CYCLE      (4U)    /*!< Cycles to end the current access after a refresh request */
+
 #define XSPI_FUNCTIONAL_MODE_INDIRECT_WRITE ((uint32_t)0x00000000)         /*!< Indirect write mode    */
 #define XSPI_FUNCTIONAL_MODE_INDIRECT_READ  ((uint32_t)XSPI_CR_FMODE_0)    /*!< Indirect read mode     */
 #define XSPI_FUNCTIONAL_MODE_AUTO_POLLING   ((uint32_t)XSPI_CR_FMODE_1)    /*!< Automatic polling mode */
@@ -2830,6 +2850,309 @@ HAL_StatusTypeDef HAL_XSPI_DLYB_GetClockPeriod(XSPI_HandleTypeDef *hxspi, HAL_XS
   return status;
 }
 
+/**
+  * @}
+  */
+
+/** @defgroup XSPI_Exported_Functions_Group5 RAM memory-mapped functions
+  *  @brief   RAM memory-mapped functions
+  *
+@verbatim
+ ===============================================================================
+                  ##### RAM memory-mapped functions #####
+ ===============================================================================
+    [..]
+    This subsection provides a set of functions allowing to :
+      (+) Configure the memory-mapped read and write accesses to a PSRAM or a HyperRAM.
+      (+) Measure the bandwidth and the latency of the memory-mapped RAM.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Configure the memory-mapped read and write accesses to an external RAM.
+  * @param  hxspi    : XSPI handle
+  * @param  pProfile : Pointer to the RAM profile, filled in from the memory datasheet
+  * @param  Timeout  : Timeout duration
+  * @note   Only AP Memory (octal DTR) and Hyperbus memory types are supported. The memory
+  *         itself must already be configured for the latencies and the wrap size given
+  *         in the profile.
+  * @note   The clock prescaler, wrap size, chip select boundary, refresh, sample shifting
+  *         and delay hold quarter cycle settings of hxspi->Init are updated.
+  * @note   With a maximum chip select low time, the timeout counter should also be used,
+  *         otherwise the chip select stays low while the prefetch FIFO is full.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_XSPI_RAM_MemoryMapped(XSPI_HandleTypeDef *hxspi, const XSPI_RamProfileTypeDef *pProfile,
+                                            uint32_t Timeout)
+{
+  HAL_StatusTypeDef status;
+  XSPI_RegularCmdTypeDef cmd = {0};
+  XSPI_HyperbusCfgTypeDef hcfg;
+  XSPI_HyperbusCmdTypeDef hcmd;
+  XSPI_MemoryMappedTypeDef mmcfg;
+  uint32_t state;
+  uint32_t divider;
+  uint32_t clockfreq;
+  uint32_t refresh;
+  uint32_t boundary;
+  uint32_t tickstart = HAL_GetTick();
+
+  if ((pProfile == NULL) || (pProfile->KernelClockFreq == 0U) || (pProfile->MaxClockFreq == 0U) ||
+      ((pProfile->PageSize & (pProfile->PageSize - 1U)) != 0U) || (pProfile->PageSize == 1U))
+  {
+    hxspi->ErrorCode = HAL_XSPI_ERROR_INVALID_PARAM;
+    return HAL_ERROR;
+  }
+
+  /* Check the parameters of the RAM profile */
+  assert_param(IS_XSPI_WRAP_SIZE(pProfile->WrapSize));
+  assert_param(IS_XSPI_TIMEOUT_PERIOD(pProfile->TimeoutPeriodClock));
+  if (hxspi->Init.MemoryType == HAL_XSPI_MEMTYPE_HYPERBUS)
+  {
+    assert_param(IS_XSPI_ACCESS_TIME_CYCLE(pProfile->ReadLatencyCycle));
+    assert_param(IS_XSPI_RW_RECOVERY_TIME_CYCLE(pProfile->RWRecoveryTimeCycle));
+    assert_param(IS_XSPI_LATENCY_MODE(pProfile->LatencyMode));
+  }
+  else
+  {
+    assert_param(IS_XSPI_DUMMY_CYCLES(pProfile->ReadLatencyCycle));
+    assert_param(IS_XSPI_DUMMY_CYCLES(pProfile->WriteLatencyCycle));
+  }
+
+  /* Check the state of the driver and the memory type */
+  state = hxspi->State;
+  if (!(((state == HAL_XSPI_STATE_READY) && (hxspi->Init.MemoryType == HAL_XSPI_MEMTYPE_APMEM)) ||
+        (((state == HAL_XSPI_STATE_READY) || (state == HAL_XSPI_STATE_HYPERBUS_INIT)) &&
+         (hxspi->Init.MemoryType == HAL_XSPI_MEMTYPE_HYPERBUS))))
+  {
+    hxspi->ErrorCode = HAL_XSPI_ERROR_INVALID_SEQUENCE;
+    return HAL_ERROR;
+  }
+
+  /* Smallest division ratio meeting the memory frequency, even (or 1) for a 50% duty cycle in DTR */
+  divider = (pProfile->KernelClockFreq + pProfile->MaxClockFreq - 1U) / pProfile->MaxClockFreq;
+  if ((divider > 1U) && ((divider & 1U) != 0U))
+  {
+    divider++;
+  }
+  if (divider > 256U)
+  {
+    hxspi->ErrorCode = HAL_XSPI_ERROR_INVALID_PARAM;
+    return HAL_ERROR;
+  }
+  clockfreq = pProfile->KernelClockFreq / divider;
+
+  /* Release the chip select before the maximum chip select low time */
+  refresh = 0U;
+  if (pProfile->MaxChipSelectLowTime != 0U)
+  {
+    refresh = (uint32_t)(((uint64_t)pProfile->MaxChipSelectLowTime * clockfreq) / 1000000000U);
+    refresh = (refresh > (XSPI_RAM_REFRESH_MARGIN_CYCLE + 1U)) ? (refresh - XSPI_RAM_REFRESH_MARGIN_CYCLE - 1U) : 1U;
+  }
+
+  /* Split the bursts on the memory pages */
+  boundary = HAL_XSPI_BONDARYOF_NONE;
+  if (pProfile->PageSize != 0U)
+  {
+    boundary = 31U - __CLZ(pProfile->PageSize);
+  }
+
+  /* Wait till busy flag is reset */
+  status = XSPI_WaitFlagStateUntilTimeout(hxspi, HAL_XSPI_FLAG_BUSY, RESET, tickstart, Timeout);
+  if (status != HAL_OK)
+  {
+    return HAL_BUSY;
+  }
+
+  /* Synchronize initialization structure with the new values */
+  hxspi->Init.ClockPrescaler        = divider - 1U;
+  hxspi->Init.WrapSize              = pProfile->WrapSize;
+  hxspi->Init.ChipSelectBoundary    = boundary;
+  hxspi->Init.Refresh               = refresh;
+  hxspi->Init.SampleShifting        = HAL_XSPI_SAMPLE_SHIFT_NONE;
+  hxspi->Init.DelayHoldQuarterCycle = HAL_XSPI_DHQC_ENABLE;
+
+  MODIFY_REG(hxspi->Instance->DCR2, (XSPI_DCR2_PRESCALER | XSPI_DCR2_WRAPSIZE),
+             ((hxspi->Init.ClockPrescaler << XSPI_DCR2_PRESCALER_Pos) | hxspi->Init.WrapSize));
+  MODIFY_REG(hxspi->Instance->DCR3, XSPI_DCR3_CSBOUND, (hxspi->Init.ChipSelectBoundary << XSPI_DCR3_CSBOUND_Pos));
+  hxspi->Instance->DCR4 = hxspi->Init.Refresh;
+  /* In DTR mode the sampling must not be shifted, and the outputs are held a quarter cycle */
+  MODIFY_REG(hxspi->Instance->TCR, (XSPI_TCR_SSHIFT | XSPI_TCR_DHQC),
+             (hxspi->Init.SampleShifting | hxspi->Init.DelayHoldQuarterCycle));
+
+  if (hxspi->Init.MemoryType == HAL_XSPI_MEMTYPE_HYPERBUS)
+  {
+    hcfg.RWRecoveryTimeCycle = pProfile->RWRecoveryTimeCycle;
+    hcfg.AccessTimeCycle     = pProfile->ReadLatencyCycle;
+    hcfg.WriteZeroLatency    = HAL_XSPI_LATENCY_ON_WRITE;
+    hcfg.LatencyMode         = pProfile->LatencyMode;
+    status = HAL_XSPI_HyperbusCfg(hxspi, &hcfg, Timeout);
+
+    if (status == HAL_OK)
+    {
+      hcmd.AddressSpace = HAL_XSPI_MEMORY_ADDRESS_SPACE;
+      hcmd.Address      = 0U;
+      hcmd.AddressWidth = HAL_XSPI_ADDRESS_32_BITS;
+      hcmd.DataLength   = 1U;
+      hcmd.DQSMode      = HAL_XSPI_DQS_ENABLE;
+      status = HAL_XSPI_HyperbusCmd(hxspi, &hcmd, Timeout);
+    }
+  }
+  else
+  {
+    /* Octal DTR accesses, DQS used as read strobe and as write data mask */
+    cmd.IOSelect           = HAL_XSPI_SELECT_IO_7_0;
+    cmd.InstructionMode    = HAL_XSPI_INSTRUCTION_8_LINES;
+    cmd.InstructionWidth   = HAL_XSPI_INSTRUCTION_8_BITS;
+    cmd.InstructionDTRMode = HAL_XSPI_INSTRUCTION_DTR_DISABLE;
+    cmd.AddressMode        = HAL_XSPI_ADDRESS_8_LINES;
+    cmd.AddressWidth       = HAL_XSPI_ADDRESS_32_BITS;
+    cmd.AddressDTRMode     = HAL_XSPI_ADDRESS_DTR_ENABLE;
+    cmd.AlternateBytesMode = HAL_XSPI_ALT_BYTES_NONE;
+    cmd.DataMode           = HAL_XSPI_DATA_8_LINES;
+    cmd.DataDTRMode        = HAL_XSPI_DATA_DTR_ENABLE;
+    cmd.DQSMode            = HAL_XSPI_DQS_ENABLE;
+    cmd.SIOOMode           = HAL_XSPI_SIOO_INST_EVERY_CMD;
+
+    cmd.OperationType      = HAL_XSPI_OPTYPE_READ_CFG;
+    cmd.Instruction        = pProfile->ReadInstruction;
+    cmd.DummyCycles        = pProfile->ReadLatencyCycle;
+    status = HAL_XSPI_Command(hxspi, &cmd, Timeout);
+
+    /* The wrap configuration is accepted only before the write configuration */
+    if ((status == HAL_OK) && (pProfile->WrapSize != HAL_XSPI_WRAP_NOT_SUPPORTED))
+    {
+      cmd.OperationType    = HAL_XSPI_OPTYPE_WRAP_CFG;
+      cmd.Instruction      = pProfile->WrapInstruction;
+      status = HAL_XSPI_Command(hxspi, &cmd, Timeout);
+    }
+
+    if (status == HAL_OK)
+    {
+      cmd.OperationType    = HAL_XSPI_OPTYPE_WRITE_CFG;
+      cmd.Instruction      = pProfile->WriteInstruction;
+      cmd.DummyCycles      = pProfile->WriteLatencyCycle;
+      status = HAL_XSPI_Command(hxspi, &cmd, Timeout);
+    }
+  }
+
+  if (status == HAL_OK)
+  {
+    mmcfg.TimeOutActivation  = (pProfile->TimeoutPeriodClock != 0U) ? HAL_XSPI_TIMEOUT_COUNTER_ENABLE :
+                               HAL_XSPI_TIMEOUT_COUNTER_DISABLE;
+    mmcfg.TimeoutPeriodClock = pProfile->TimeoutPeriodClock;
+    status = HAL_XSPI_MemoryMapped(hxspi, &mmcfg);
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Measure the bandwidth and the latency of the memory-mapped RAM.
+  * @param  hxspi   : XSPI handle
+  * @param  Offset  : Offset of the tested area in the memory, multiple of 4
+  * @param  Size    : Size of the tested area in bytes, multiple of 4
+  * @param  pResult : Pointer to the benchmark results
+  * @note   The content of the tested area is overwritten.
+  * @note   Durations are measured with the DWT cycle counter, which is enabled by this
+  *         function if it is not already running. Bandwidths are computed from
+  *         SystemCoreClock.
+  * @note   The accesses are done by the CPU and go through DCACHE1 when it is enabled :
+  *         use an area larger than the cache, or disable it, to measure the memory itself.
+  *         The write measurement ends with a read of the area, to drain the write FIFO.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_XSPI_RAM_Benchmark(XSPI_HandleTypeDef *hxspi, uint32_t Offset, uint32_t Size,
+                                         XSPI_RamBenchmarkTypeDef *pResult)
+{
+  __IO uint32_t *p_area;
+  uint32_t nbwords;
+  uint32_t index;
+  uint32_t start;
+  uint32_t cycles;
+  uint32_t seed;
+  uint32_t sum = 0U;
+  uint32_t errors = 0U;
+
+  if ((pResult == NULL) || (Size < 4U) || (((Offset | Size) & 3U) != 0U) ||
+      (Size > ((1UL << (hxspi->Init.MemorySize + 1U)) - Offset)))
+  {
+    hxspi->ErrorCode = HAL_XSPI_ERROR_INVALID_PARAM;
+    return HAL_ERROR;
+  }
+
+  if ((hxspi->State != HAL_XSPI_STATE_BUSY_MEM_MAPPED) || (hxspi->Instance != OCTOSPI1))
+  {
+    hxspi->ErrorCode = HAL_XSPI_ERROR_INVALID_SEQUENCE;
+    return HAL_ERROR;
+  }
+
+  p_area = (__IO uint32_t *)(OCTOSPI1_BASE + Offset);
+  nbwords = Size / 4U;
+
+  /* Enable the DWT cycle counter if it is not running */
+  if ((DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk) == 0U)
+  {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0U;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+  }
+
+  /* Sequential write of an address dependent pattern */
+  start = DWT->CYCCNT;
+  for (index = 0U; index < nbwords; index++)
+  {
+    p_area[index] = (index * 0x9E3779B9U) ^ Offset;
+  }
+  __DSB();
+  sum += p_area[nbwords - 1U];
+  cycles = DWT->CYCCNT - start;
+  pResult->WriteCycles = cycles;
+  pResult->WriteBandwidth = (cycles == 0U) ? 0U : (uint32_t)(((uint64_t)Size * SystemCoreClock) / cycles);
+
+  /* Sequential read */
+  start = DWT->CYCCNT;
+  for (index = 0U; index < nbwords; index++)
+  {
+    sum += p_area[index];
+  }
+  cycles = DWT->CYCCNT - start;
+  pResult->ReadCycles = cycles;
+  pResult->ReadBandwidth = (cycles == 0U) ? 0U : (uint32_t)(((uint64_t)Size * SystemCoreClock) / cycles);
+
+  /* Check the data, outside of the measurements */
+  for (index = 0U; index < nbwords; index++)
+  {
+    if (p_area[index] != ((index * 0x9E3779B9U) ^ Offset))
+    {
+      errors++;
+    }
+  }
+  pResult->Errors = errors;
+
+  /* CPU random single word reads */
+  seed = 0x12345678U;
+  start = DWT->CYCCNT;
+  for (index = 0U; index < HAL_XSPI_RAM_BENCHMARK_READS; index++)
+  {
+    seed = (seed * 1664525U) + 1013904223U;
+    sum += p_area[(seed >> 8U) % nbwords];
+  }
+  cycles = DWT->CYCCNT - start;
+  pResult->ReadLatencyCycles = cycles / HAL_XSPI_RAM_BENCHMARK_READS;
+  pResult->ReadLatencyNs = (uint32_t)(((uint64_t)cycles * 1000000000U) /
+                                      ((uint64_t)SystemCoreClock * HAL_XSPI_RAM_BENCHMARK_READS));
+  UNUSED(sum);
+
+  return HAL_OK;
+}
+
+/**
+  * @}
+  */
+
 /**
   @cond 0
   */
@@ -399,6 +399,31 @@ typedef struct
   * @}
   */
 
+/**
+  * @brief  ADC streaming descriptor, filled by HAL_ADCEx_Stream_Start().
+  * @note   The DMA writes frames of ChannelCount conversion data, one per rank of the
+  *         regular sequence, into a circular buffer of (Mask + 1) frames.
+  *         Head and Tail are free-running frame counts, the position of a frame in
+  *         pBuffer is (index & Mask).
+  */
+typedef struct
+{
+  uint8_t                       *pBuffer;               /*!< Interleaved circular DMA buffer, owned by the application */
+  uint32_t                      ChannelCount;           /*!< Number of conversion data of a frame (regular sequence length) */
+  uint32_t                      ItemSize;               /*!< Size of a conversion data in bytes, 2 or 4, from the DMA memory data alignment */
+  uint32_t                      Mask;                   /*!< Number of frames of the buffer minus one, the number of frames is a power of two */
+  __IO uint32_t                 Head;                   /*!< Write frame index, updated by the driver from the DMA counter */
+  __IO uint32_t                 Tail;                   /*!< Read frame index, updated by the reader */
+  __IO uint32_t                 Overrun;                /*!< Count of updates that found the reader overtaken */
+#if defined(HAL_MDMA_MODULE_ENABLED)
+  MDMA_HandleTypeDef            *hmdma;                 /*!< MDMA channel de-interleaving each half buffer, NULL when not used */
+  uint8_t                       *pChannelBuffer[16];    /*!< Per-channel buffers of (Mask + 1) data, one per rank */
+  __IO uint32_t                 DemuxChannel;           /*!< Rank being de-interleaved, ChannelCount when the MDMA is idle */
+  uint32_t                      DemuxHalf;              /*!< Half buffer being de-interleaved, 0 or 1 */
+  __IO uint32_t                 DemuxOverrun;           /*!< Count of half buffers not de-interleaved because the MDMA was still busy */
+#endif /* HAL_MDMA_MODULE_ENABLED */
+} ADC_StreamTypeDef;
+
 /**
   * @brief  ADC handle Structure definition
   */
@@ -415,6 +440,7 @@ typedef struct
   __IO uint32_t                 State;                  /*!< ADC communication state (bitmap of ADC states) */
   __IO uint32_t                 ErrorCode;              /*!< ADC Error code */
   ADC_InjectionConfigTypeDef    InjectionConfig ;       /*!< ADC injected channel configuration build-up structure */
+  ADC_StreamTypeDef             *pStream;               /*!< ADC streaming descriptor, only set while a streaming acquisition is ongoing */
 #if (USE_HAL_ADC_REGISTER_CALLBACKS == 1)
   void (* ConvCpltCallback)(struct __ADC_HandleTypeDef *hadc);              /*!< ADC conversion complete callback */
   void (* ConvHalfCpltCallback)(struct __ADC_HandleTypeDef *hadc);          /*!< ADC conversion DMA half-transfer callback */
@@ -425,6 +451,8 @@ typedef struct
   void (* LevelOutOfWindow2Callback)(struct __ADC_HandleTypeDef *hadc);     /*!< ADC analog watchdog 2 callback */
   void (* LevelOutOfWindow3Callback)(struct __ADC_HandleTypeDef *hadc);     /*!< ADC analog watchdog 3 callback */
   void (* EndOfSamplingCallback)(struct __ADC_HandleTypeDef *hadc);         /*!< ADC end of sampling callback */
+  void (* ConvM0CpltCallback)(struct __ADC_HandleTypeDef *hadc);            /*!< ADC conversion DMA memory 0 complete callback */
+  void (* ConvM1CpltCallback)(struct __ADC_HandleTypeDef *hadc);            /*!< ADC conversion DMA memory 1 complete callback */
   void (* MspInitCallback)(struct __ADC_HandleTypeDef *hadc);               /*!< ADC Msp Init callback */
   void (* MspDeInitCallback)(struct __ADC_HandleTypeDef *hadc);             /*!< ADC Msp DeInit callback */
 #endif /* USE_HAL_ADC_REGISTER_CALLBACKS */
@@ -446,7 +474,9 @@ typedef enum
   HAL_ADC_LEVEL_OUT_OF_WINDOW_3_CB_ID   = 0x07U,  /*!< ADC analog watchdog 3 callback ID */
   HAL_ADC_END_OF_SAMPLING_CB_ID         = 0x08U,  /*!< ADC end of sampling callback ID */
   HAL_ADC_MSPINIT_CB_ID                 = 0x09U,  /*!< ADC Msp Init callback ID          */
-  HAL_ADC_MSPDEINIT_CB_ID               = 0x0AU   /*!< ADC Msp DeInit callback ID        */
+  HAL_ADC_MSPDEINIT_CB_ID               = 0x0AU,  /*!< ADC Msp DeInit callback ID        */
+  HAL_ADC_CONVERSION_M0_CB_ID           = 0x0BU,  /*!< ADC conversion DMA memory 0 complete callback ID */
+  HAL_ADC_CONVERSION_M1_CB_ID           = 0x0CU   /*!< ADC conversion DMA memory 1 complete callback ID */
 } HAL_ADC_CallbackIDTypeDef;
 
 /**
@@ -1959,6 +1989,8 @@ HAL_StatusTypeDef       HAL_ADC_Stop_IT(ADC_HandleTypeDef *hadc);
 
 /* Non-blocking mode: DMA */
 HAL_StatusTypeDef       HAL_ADC_Start_DMA(ADC_HandleTypeDef *hadc, uint32_t *pData, uint32_t Length);
+HAL_StatusTypeDef       HAL_ADC_StartDoubleBuffer_DMA(ADC_HandleTypeDef *hadc, uint32_t *pData0, uint32_t *pData1,
+                                                      uint32_t Length);
 HAL_StatusTypeDef       HAL_ADC_Stop_DMA(ADC_HandleTypeDef *hadc);
 
 /* ADC retrieve conversion value intended to be used with polling or interruption */
@@ -1968,6 +2000,8 @@ uint32_t                HAL_ADC_GetValue(ADC_HandleTypeDef *hadc);
 void                    HAL_ADC_IRQHandler(ADC_HandleTypeDef *hadc);
 void                    HAL_ADC_ConvCpltCallback(ADC_HandleTypeDef *hadc);
 void                    HAL_ADC_ConvHalfCpltCallback(ADC_HandleTypeDef *hadc);
+void                    HAL_ADC_ConvM0CpltCallback(ADC_HandleTypeDef *hadc);
+void                    HAL_ADC_ConvM1CpltCallback(ADC_HandleTypeDef *hadc);
 void                    HAL_ADC_LevelOutOfWindowCallback(ADC_HandleTypeDef *hadc);
 void                    HAL_ADC_ErrorCallback(ADC_HandleTypeDef *hadc);
 /**
@@ -2012,6 +2046,7 @@ void ADC_DMAConvCplt(DMA_HandleTypeDef *hdma);
 void ADC_DMAHalfConvCplt(DMA_HandleTypeDef *hdma);
 void ADC_DMAError(DMA_HandleTypeDef *hdma);
 void ADC_ConfigureBoostMode(ADC_HandleTypeDef *hadc);
+void ADCEx_StreamHalfBufferEvent(ADC_HandleTypeDef *hadc, uint32_t HalfIndex);
 
 /**
   * @}
@@ -218,6 +218,66 @@ typedef struct
                                    from 1 to 6 clock cycles for 8 bits     */
 } ADC_MultiModeTypeDef;
 
+/**
+  * @brief  Structure definition of ADC calibration cache
+  * @note   Filled by HAL_ADCEx_CalibrationCache_Save() and kept by the application, for
+  *         instance in a RAM retained across re-initializations, to restore the
+  *         calibration factors without running the calibration again.
+  */
+typedef struct
+{
+  uint32_t Valid;                                  /*!< Set to ADC_CALIBRATION_CACHE_VALID when the cache is filled */
+
+  uint32_t CalibrationMode;                        /*!< Calibration run to fill the cache, ADC_CALIB_OFFSET or
+                                                        ADC_CALIB_OFFSET_LINEARITY */
+
+  uint32_t SingleEndedFactor;                      /*!< Offset calibration factor in single-ended mode */
+
+  uint32_t DifferentialFactor;                     /*!< Offset calibration factor in differential mode */
+
+  uint32_t LinearFactor[ADC_LINEAR_CALIB_REG_COUNT]; /*!< Linearity calibration factors, used only with
+                                                        ADC_CALIB_OFFSET_LINEARITY */
+
+  int32_t  Temperature;                            /*!< Device temperature at calibration, in degree Celsius */
+
+  uint32_t Vdda;                                   /*!< VDDA at calibration, in mV */
+} ADC_CalibrationCacheTypeDef;
+
+/**
+  * @brief  Structure definition of ADC streaming acquisition configuration
+  * @note   The parameters of the ADC instance not listed here (resolution, clock, trigger,
+  *         continuous mode, ...) are taken from the Init structure of the ADC handle.
+  */
+typedef struct
+{
+  uint32_t ChannelCount;                  /*!< Number of channels of a frame, from 1 to 16. */
+
+  uint32_t Channel[16];                   /*!< Channels converted in the regular sequence, Channel[i] on rank i + 1.
+                                               Each element can be a value of @ref ADC_HAL_EC_CHANNEL */
+
+  uint32_t SamplingTime;                  /*!< Sampling time of all the channels.
+                                               This parameter can be a value of @ref ADC_HAL_EC_CHANNEL_SAMPLINGTIME */
+
+  FunctionalState OversamplingMode;       /*!< Specify whether the oversampling feature is enabled or disabled.
+                                               This parameter can be set to ENABLE or DISABLE. */
+
+  ADC_OversamplingTypeDef Oversampling;   /*!< Oversampling parameters, used only when OversamplingMode is ENABLE.
+                                               Use ADC_REGOVERSAMPLING_CONTINUED_MODE to keep the oversampling
+                                               accumulation across concurrent injected conversions. */
+} ADC_StreamConfTypeDef;
+
+/**
+  * @brief  Structure definition of a per-channel view of the ADC streaming buffer
+  */
+typedef struct
+{
+  uint8_t  *pData;                        /*!< Oldest conversion data of the channel waiting in the buffer */
+
+  uint32_t Stride;                        /*!< Distance in bytes between two consecutive data of the channel */
+
+  uint32_t Count;                         /*!< Number of data of the channel readable from pData with Stride */
+} ADC_StreamViewTypeDef;
+
 /**
   * @}
   */
@@ -228,6 +288,24 @@ typedef struct
   * @{
   */
 
+/** @defgroup ADCEx_Calibration_Cache ADC Extended calibration cache
+  * @{
+  */
+#define ADC_CALIBRATION_CACHE_VALID          (0x43414C42UL)   /*!< Marker of a filled calibration cache */
+
+#if !defined(ADC_CALIBRATION_CACHE_TEMPERATURE_TOLERANCE)
+#define ADC_CALIBRATION_CACHE_TEMPERATURE_TOLERANCE (10L)     /*!< Temperature drift, in degree Celsius, above
+                                                                   which a cached calibration is run again */
+#endif /* ADC_CALIBRATION_CACHE_TEMPERATURE_TOLERANCE */
+
+#if !defined(ADC_CALIBRATION_CACHE_VDDA_TOLERANCE)
+#define ADC_CALIBRATION_CACHE_VDDA_TOLERANCE (100UL)          /*!< VDDA drift, in mV, above which a cached
+                                                                   calibration is run again */
+#endif /* ADC_CALIBRATION_CACHE_VDDA_TOLERANCE */
+/**
+  * @}
+  */
+
 /** @defgroup ADC_injected_external_trigger_source ADC group injected trigger source
   * @{
   */
@@ -1309,6 +1387,15 @@ HAL_StatusTypeDef       HAL_ADCEx_Calibration_SetValue(ADC_HandleTypeDef *hadc,
 HAL_StatusTypeDef       HAL_ADCEx_LinearCalibration_SetValue(ADC_HandleTypeDef *hadc, uint32_t *LinearCalib_Buffer);
 HAL_StatusTypeDef       HAL_ADCEx_LinearCalibration_FactorLoad(ADC_HandleTypeDef *hadc);
 
+/* ADC calibration cache */
+HAL_StatusTypeDef       HAL_ADCEx_CalibrationCache_Save(ADC_HandleTypeDef *hadc, ADC_CalibrationCacheTypeDef *pCache,
+                                                        uint32_t CalibrationMode, int32_t Temperature, uint32_t Vdda);
+HAL_StatusTypeDef       HAL_ADCEx_CalibrationCache_Restore(ADC_HandleTypeDef *hadc, const ADC_CalibrationCacheTypeDef *pCache);
+uint32_t                HAL_ADCEx_CalibrationCache_IsValid(const ADC_CalibrationCacheTypeDef *pCache, uint32_t CalibrationMode,
+                                                           int32_t Temperature, uint32_t Vdda);
+HAL_StatusTypeDef       HAL_ADCEx_Calibration_StartCached(ADC_HandleTypeDef *hadc, uint32_t CalibrationMode,
+                                                          ADC_CalibrationCacheTypeDef *pCache, int32_t Temperature, uint32_t Vdda);
+
 
 /* Blocking mode: Polling */
 HAL_StatusTypeDef       HAL_ADCEx_InjectedStart(ADC_HandleTypeDef *hadc);
@@ -1340,6 +1427,19 @@ HAL_StatusTypeDef HAL_ADCEx_RegularStop_IT(ADC_HandleTypeDef *hadc);
 HAL_StatusTypeDef HAL_ADCEx_RegularStop_DMA(ADC_HandleTypeDef *hadc);
 HAL_StatusTypeDef HAL_ADCEx_RegularMultiModeStop_DMA(ADC_HandleTypeDef *hadc);
 
+/* ADC streaming acquisition */
+HAL_StatusTypeDef HAL_ADCEx_Stream_Start(ADC_HandleTypeDef *hadc, ADC_StreamTypeDef *pStream, uint8_t *pBuffer,
+                                         uint32_t FrameCount);
+HAL_StatusTypeDef HAL_ADCEx_Stream_Stop(ADC_HandleTypeDef *hadc);
+#if defined(HAL_MDMA_MODULE_ENABLED)
+HAL_StatusTypeDef HAL_ADCEx_Stream_StartDemux(ADC_HandleTypeDef *hadc, MDMA_HandleTypeDef *hmdma,
+                                              uint8_t *const pChannelBuffer[]);
+#endif /* HAL_MDMA_MODULE_ENABLED */
+void              HAL_ADCEx_Stream_Update(ADC_HandleTypeDef *hadc);
+uint32_t          HAL_ADCEx_Stream_GetView(ADC_StreamTypeDef *pStream, uint32_t ChannelIndex, ADC_StreamViewTypeDef *pView);
+void              HAL_ADCEx_Stream_Release(ADC_StreamTypeDef *pStream, uint32_t Count);
+void              HAL_ADCEx_Stream_DemuxCpltCallback(ADC_HandleTypeDef *hadc, uint32_t HalfIndex);
+
 /**
   * @}
   */
@@ -1354,6 +1454,7 @@ HAL_StatusTypeDef       HAL_ADCEx_EnableInjectedQueue(ADC_HandleTypeDef *hadc);
 HAL_StatusTypeDef       HAL_ADCEx_DisableInjectedQueue(ADC_HandleTypeDef *hadc);
 HAL_StatusTypeDef       HAL_ADCEx_DisableVoltageRegulator(ADC_HandleTypeDef *hadc);
 HAL_StatusTypeDef       HAL_ADCEx_EnterADCDeepPowerDownMode(ADC_HandleTypeDef *hadc);
+HAL_StatusTypeDef       HAL_ADCEx_Stream_Config(ADC_HandleTypeDef *hadc, const ADC_StreamConfTypeDef *sConfig);
 
 /**
   * @}
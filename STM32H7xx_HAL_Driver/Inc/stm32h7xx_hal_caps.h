@@ -0,0 +1,232 @@
+/**
+  ******************************************************************************
+  * @file    stm32h7xx_hal_caps.h
+  * @author  MCD Application Team
+  * @brief   Peripheral capabilities of the device, derived from the CMSIS
+  *          device header.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  @verbatim
+  ==============================================================================
+                        ##### How to use this file #####
+  ==============================================================================
+  [..]
+    The capabilities are constant expressions computed from the features of the
+    CMSIS device header (stm32h7xxxx.h), so they stay correct for every part
+    header. They are usable in #if directives, except the per-instance ones, to
+    select the best code path at compile time:
+      (+) HAL_CAPS_xxx_FIFO_DEPTH give the FIFO depths in data frames of 8 bits.
+      (+) HAL_CAPS_xxx_REQUEST_MAX give the highest DMA request ID of each
+          DMAMUX.
+      (+) HAL_CAPS_CPU_FREQ_MAX and HAL_CAPS_HCLK_FREQ_MAX give the highest
+          clocks of the line, in Voltage Scale 0.
+      (+) HAL_CAPS_ADC_VERSION gives the ADC IP version.
+      (+) The other HAL_CAPS_xxx are 1 when the feature is available and 0
+          otherwise.
+  @endverbatim
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef STM32H7xx_HAL_CAPS_H
+#define STM32H7xx_HAL_CAPS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32h7xx.h"
+
+/** @addtogroup STM32H7xx_HAL_Driver
+  * @{
+  */
+
+/** @defgroup HAL_CAPS HAL Capabilities
+  * @brief Peripheral capabilities of the device
+  * @{
+  */
+
+/* Exported constants --------------------------------------------------------*/
+/** @defgroup HAL_CAPS_Exported_Constants HAL Capabilities Exported Constants
+  * @{
+  */
+
+/** @defgroup HAL_CAPS_Core Core and power capabilities
+  * @{
+  */
+#if defined(DUAL_CORE)
+#define HAL_CAPS_DUAL_CORE              1U          /*!< Cortex-M7 and Cortex-M4 cores                  */
+#else
+#define HAL_CAPS_DUAL_CORE              0U          /*!< Cortex-M7 core only                            */
+#endif /* DUAL_CORE */
+
+#if defined(SMPS)
+#define HAL_CAPS_SMPS                   1U          /*!< Step-down converter (SMPS) available           */
+#else
+#define HAL_CAPS_SMPS                   0U          /*!< LDO regulator only                             */
+#endif /* SMPS */
+
+#if defined(SYSCFG_PWRCR_ODEN)
+#define HAL_CAPS_OVERDRIVE              1U          /*!< Voltage Scale 0 reached with the overdrive     */
+#else
+#define HAL_CAPS_OVERDRIVE              0U          /*!< Voltage Scale 0 set directly                   */
+#endif /* SYSCFG_PWRCR_ODEN */
+
+#if defined(PWR_SRDCR_VOS)          /* STM32H7Axxx and STM32H7Bxxx lines */
+#define HAL_CAPS_CPU_FREQ_MAX           280000000UL /*!< Highest CPU (rcc_c_ck) frequency in Hz         */
+#define HAL_CAPS_HCLK_FREQ_MAX          280000000UL /*!< Highest AHB (rcc_hclk3) frequency in Hz        */
+#elif defined(SYSCFG_PWRCR_ODEN)    /* STM32H74xxx and STM32H75xxx lines */
+#define HAL_CAPS_CPU_FREQ_MAX           480000000UL /*!< Highest CPU (rcc_c_ck) frequency in Hz         */
+#define HAL_CAPS_HCLK_FREQ_MAX          240000000UL /*!< Highest AHB (rcc_hclk3) frequency in Hz        */
+#else                               /* STM32H72xxx and STM32H73xxx lines */
+#define HAL_CAPS_CPU_FREQ_MAX           550000000UL /*!< Highest CPU (rcc_c_ck) frequency in Hz, with
+                                                         the CPUFREQ_BOOST option bit set              */
+#define HAL_CAPS_HCLK_FREQ_MAX          275000000UL /*!< Highest AHB (rcc_hclk3) frequency in Hz        */
+#endif /* PWR_SRDCR_VOS */
+/**
+  * @}
+  */
+
+/** @defgroup HAL_CAPS_DMA DMA capabilities
+  * @{
+  */
+#define HAL_CAPS_DMA_FIFO_DEPTH         16U         /*!< DMA1/DMA2 stream FIFO depth                    */
+
+#if defined(TIM24)
+#define HAL_CAPS_DMAMUX1_REQUEST_MAX    137U        /*!< Highest DMAMUX1 request ID (TIM24 TRIG)        */
+#elif defined(ADC3)
+#define HAL_CAPS_DMAMUX1_REQUEST_MAX    115U        /*!< Highest DMAMUX1 request ID (ADC3)              */
+#else
+#define HAL_CAPS_DMAMUX1_REQUEST_MAX    119U        /*!< Highest DMAMUX1 request ID (USART10 TX)        */
+#endif /* TIM24 */
+
+#if defined(ADC3)
+#define HAL_CAPS_DMAMUX2_REQUEST_MAX    17U         /*!< Highest DMAMUX2 request ID (ADC3)              */
+#else
+#define HAL_CAPS_DMAMUX2_REQUEST_MAX    18U         /*!< Highest DMAMUX2 request ID (DFSDM2 FLT0)       */
+#endif /* ADC3 */
+
+#if defined(BDMA2)
+#define HAL_CAPS_BDMA_INSTANCES         2U          /*!< BDMA1 and BDMA2                                */
+#else
+#define HAL_CAPS_BDMA_INSTANCES         1U          /*!< BDMA only                                      */
+#endif /* BDMA2 */
+
+#if defined(DMA2D)
+#define HAL_CAPS_DMA2D                  1U          /*!< Chrom-ART accelerator available                */
+#else
+#define HAL_CAPS_DMA2D                  0U          /*!< No Chrom-ART accelerator                       */
+#endif /* DMA2D */
+/**
+  * @}
+  */
+
+/** @defgroup HAL_CAPS_Communication Communication peripherals capabilities
+  * @{
+  */
+#if defined(USART_CR1_FIFOEN)
+#define HAL_CAPS_USART_FIFO_DEPTH       16U         /*!< USART/UART/LPUART transmit and receive FIFO depth */
+#else
+#define HAL_CAPS_USART_FIFO_DEPTH       0U          /*!< No USART FIFO                                  */
+#endif /* USART_CR1_FIFOEN */
+
+#if defined(USART10)
+#define HAL_CAPS_USART_INSTANCES        10U         /*!< USART1 to USART10, LPUART1 excluded            */
+#else
+#define HAL_CAPS_USART_INSTANCES        8U          /*!< USART1 to UART8, LPUART1 excluded              */
+#endif /* USART10 */
+
+/** @brief  SPI/I2S FIFO depth of an instance.
+  * @param  __INSTANCE__ SPI instance.
+  * @retval FIFO depth
+  */
+#define HAL_CAPS_SPI_FIFO_DEPTH(__INSTANCE__)   (IS_SPI_HIGHEND_INSTANCE(__INSTANCE__) ? 16UL : 8UL)
+
+#if defined(FDCAN3)
+#define HAL_CAPS_FDCAN_INSTANCES        3U          /*!< FDCAN1 to FDCAN3                               */
+#else
+#define HAL_CAPS_FDCAN_INSTANCES        2U          /*!< FDCAN1 and FDCAN2                              */
+#endif /* FDCAN3 */
+
+#if defined(OCTOSPI1)
+#define HAL_CAPS_OCTOSPI                1U          /*!< OCTOSPI interfaces, no QUADSPI                 */
+#else
+#define HAL_CAPS_OCTOSPI                0U          /*!< QUADSPI interface                              */
+#endif /* OCTOSPI1 */
+
+#if defined(ETH)
+#define HAL_CAPS_ETH                    1U          /*!< Ethernet MAC available                         */
+#else
+#define HAL_CAPS_ETH                    0U          /*!< No Ethernet MAC                                */
+#endif /* ETH */
+/**
+  * @}
+  */
+
+/** @defgroup HAL_CAPS_Analog Analog peripherals capabilities
+  * @{
+  */
+#define HAL_CAPS_ADC_VERSION_V5_X       0x50U       /*!< ADC of the STM32H74xxx and STM32H75xxx lines   */
+#define HAL_CAPS_ADC_VERSION_V5_3       0x53U       /*!< ADC of the STM32H7Axxx and STM32H7Bxxx lines   */
+#define HAL_CAPS_ADC_VERSION_V5_V90     0x59U       /*!< ADC1/ADC2 V5 and 12-bit ADC3 of the STM32H72xxx
+                                                         and STM32H73xxx lines                         */
+#if defined(ADC_VER_V5_V90)
+#define HAL_CAPS_ADC_VERSION            HAL_CAPS_ADC_VERSION_V5_V90
+#define HAL_CAPS_ADC3_RESOLUTION_MAX    12U         /*!< ADC3 highest resolution in bits                */
+#elif defined(ADC_VER_V5_3)
+#define HAL_CAPS_ADC_VERSION            HAL_CAPS_ADC_VERSION_V5_3
+#define HAL_CAPS_ADC3_RESOLUTION_MAX    0U          /*!< No ADC3                                        */
+#else
+#define HAL_CAPS_ADC_VERSION            HAL_CAPS_ADC_VERSION_V5_X
+#define HAL_CAPS_ADC3_RESOLUTION_MAX    16U         /*!< ADC3 highest resolution in bits                */
+#endif /* ADC_VER_V5_V90 */
+
+#define HAL_CAPS_ADC_RESOLUTION_MAX     16U         /*!< ADC1/ADC2 highest resolution in bits           */
+/**
+  * @}
+  */
+
+/** @defgroup HAL_CAPS_Math Math accelerators capabilities
+  * @{
+  */
+#if defined(CORDIC)
+#define HAL_CAPS_CORDIC                 1U          /*!< CORDIC co-processor available                  */
+#else
+#define HAL_CAPS_CORDIC                 0U          /*!< No CORDIC co-processor                         */
+#endif /* CORDIC */
+
+#if defined(FMAC)
+#define HAL_CAPS_FMAC                   1U          /*!< Filter math accelerator available              */
+#else
+#define HAL_CAPS_FMAC                   0U          /*!< No filter math accelerator                     */
+#endif /* FMAC */
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STM32H7xx_HAL_CAPS_H */
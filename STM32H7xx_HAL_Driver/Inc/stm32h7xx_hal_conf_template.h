@@ -41,6 +41,7 @@
 #define HAL_CORTEX_MODULE_ENABLED
 #define HAL_CRC_MODULE_ENABLED
 #define HAL_CRYP_MODULE_ENABLED
+#define HAL_D3AUTO_MODULE_ENABLED
 #define HAL_DAC_MODULE_ENABLED
 #define HAL_DCMI_MODULE_ENABLED
 #define HAL_DFSDM_MODULE_ENABLED
@@ -48,6 +49,7 @@
 #define HAL_DMA2D_MODULE_ENABLED
 #define HAL_DTS_MODULE_ENABLED
 #define HAL_DSI_MODULE_ENABLED
+#define HAL_EEPROM_EMUL_MODULE_ENABLED
 #define HAL_ETH_MODULE_ENABLED
 #define HAL_EXTI_MODULE_ENABLED
 #define HAL_FDCAN_MODULE_ENABLED
@@ -61,6 +63,7 @@
 #define HAL_HSEM_MODULE_ENABLED
 #define HAL_I2C_MODULE_ENABLED
 #define HAL_I2S_MODULE_ENABLED
+#define HAL_IPC_MODULE_ENABLED
 #define HAL_IRDA_MODULE_ENABLED
 #define HAL_IWDG_MODULE_ENABLED
 #define HAL_JPEG_MODULE_ENABLED
@@ -68,15 +71,19 @@
 #define HAL_LTDC_MODULE_ENABLED
 #define HAL_MDIOS_MODULE_ENABLED
 #define HAL_MDMA_MODULE_ENABLED
+#define HAL_MEMBENCH_MODULE_ENABLED
 #define HAL_MMC_MODULE_ENABLED
+#define HAL_MSCSD_MODULE_ENABLED
 #define HAL_NAND_MODULE_ENABLED
 #define HAL_NOR_MODULE_ENABLED
 #define HAL_OPAMP_MODULE_ENABLED
 #define HAL_OSPI_MODULE_ENABLED
+#define HAL_OSPI_NOR_MODULE_ENABLED
 #define HAL_OTFDEC_MODULE_ENABLED
 #define HAL_PCD_MODULE_ENABLED
 #define HAL_PWR_MODULE_ENABLED
 #define HAL_PSSI_MODULE_ENABLED
+#define HAL_QOS_MODULE_ENABLED
 #define HAL_QSPI_MODULE_ENABLED
 #define HAL_RAMECC_MODULE_ENABLED
 #define HAL_RCC_MODULE_ENABLED
@@ -84,6 +91,7 @@
 #define HAL_RTC_MODULE_ENABLED
 #define HAL_SAI_MODULE_ENABLED
 #define HAL_SD_MODULE_ENABLED
+#define HAL_SDIO_MODULE_ENABLED
 #define HAL_SDRAM_MODULE_ENABLED
 #define HAL_SMARTCARD_MODULE_ENABLED
 #define HAL_SMBUS_MODULE_ENABLED
@@ -165,8 +173,14 @@
 #define  VDD_VALUE                    (3300UL) /*!< Value of VDD in mv */
 #define  TICK_INT_PRIORITY            (0x0FUL) /*!< tick interrupt priority */
 #define  USE_RTOS                     0
+#define  USE_HAL_ATOMIC_LOCK          0U /*!< 1: handle lock safe between interrupt and thread */
+#define  USE_HAL_NO_LOCK              0U /*!< 1: handle lock compiled out, single context only */
 #define  USE_SD_TRANSCEIVER           0U               /*!< use uSD Transceiver */
 #define  USE_SPI_CRC                  1U               /*!< use CRC in SPI */
+#define  USE_HAL_DMA_STATISTICS       0U               /*!< no DMA transfer statistics */
+#define  USE_HAL_HOT_RAM_FUNC         0U               /*!< interrupt hot paths executed from flash */
+#define  USE_HAL_RCC_CLOCK_CACHE      0U               /*!< RCC frequencies decoded at each call */
+#define  USE_HAL_DMA_CACHE_MAINTENANCE 0U              /*!< D-cache maintenance of DMA buffers left to the application */
 
 #define  USE_HAL_ADC_REGISTER_CALLBACKS     0U /* ADC register callback disabled     */
 #define  USE_HAL_CEC_REGISTER_CALLBACKS     0U /* CEC register callback disabled     */
@@ -207,6 +221,7 @@
 #define  USE_HAL_RTC_REGISTER_CALLBACKS     0U /* RTC register callback disabled     */
 #define  USE_HAL_SAI_REGISTER_CALLBACKS     0U /* SAI register callback disabled     */
 #define  USE_HAL_SD_REGISTER_CALLBACKS      0U /* SD register callback disabled      */
+#define  USE_HAL_SDIO_REGISTER_CALLBACKS    0U /* SDIO register callback disabled    */
 #define  USE_HAL_SMARTCARD_REGISTER_CALLBACKS  0U /* SMARTCARD register callback disabled */
 #define  USE_HAL_SPDIFRX_REGISTER_CALLBACKS 0U /* SPDIFRX register callback disabled */
 #define  USE_HAL_SMBUS_REGISTER_CALLBACKS   0U /* SMBUS register callback disabled   */
@@ -269,6 +284,10 @@
   #include "stm32h7xx_hal_dma2d.h"
 #endif /* HAL_DMA2D_MODULE_ENABLED */
 
+#ifdef HAL_D3AUTO_MODULE_ENABLED
+  #include "stm32h7xx_hal_d3auto.h"
+#endif /* HAL_D3AUTO_MODULE_ENABLED */
+
 #ifdef HAL_DSI_MODULE_ENABLED
   #include "stm32h7xx_hal_dsi.h"
 #endif /* HAL_DSI_MODULE_ENABLED */
@@ -329,6 +348,10 @@
   #include "stm32h7xx_hal_flash.h"
 #endif /* HAL_FLASH_MODULE_ENABLED */
 
+#ifdef HAL_EEPROM_EMUL_MODULE_ENABLED
+  #include "stm32h7xx_hal_eeprom_emul.h"
+#endif /* HAL_EEPROM_EMUL_MODULE_ENABLED */
+
 #ifdef HAL_GFXMMU_MODULE_ENABLED
   #include "stm32h7xx_hal_gfxmmu.h"
 #endif /* HAL_GFXMMU_MODULE_ENABLED */
@@ -345,6 +368,10 @@
   #include "stm32h7xx_hal_hsem.h"
 #endif /* HAL_HSEM_MODULE_ENABLED */
 
+#ifdef HAL_IPC_MODULE_ENABLED
+  #include "stm32h7xx_hal_ipc.h"
+#endif /* HAL_IPC_MODULE_ENABLED */
+
 #ifdef HAL_SRAM_MODULE_ENABLED
   #include "stm32h7xx_hal_sram.h"
 #endif /* HAL_SRAM_MODULE_ENABLED */
@@ -397,6 +424,10 @@
  #include "stm32h7xx_hal_ospi.h"
 #endif /* HAL_OSPI_MODULE_ENABLED */
 
+#ifdef HAL_OSPI_NOR_MODULE_ENABLED
+ #include "stm32h7xx_hal_ospi_nor.h"
+#endif /* HAL_OSPI_NOR_MODULE_ENABLED */
+
 #ifdef HAL_OTFDEC_MODULE_ENABLED
 #include "stm32h7xx_hal_otfdec.h"
 #endif /* HAL_OTFDEC_MODULE_ENABLED */
@@ -433,6 +464,10 @@
  #include "stm32h7xx_hal_sd.h"
 #endif /* HAL_SD_MODULE_ENABLED */
 
+#ifdef HAL_SDIO_MODULE_ENABLED
+ #include "stm32h7xx_hal_sdio.h"
+#endif /* HAL_SDIO_MODULE_ENABLED */
+
 #ifdef HAL_SDRAM_MODULE_ENABLED
  #include "stm32h7xx_hal_sdram.h"
 #endif /* HAL_SDRAM_MODULE_ENABLED */
@@ -485,6 +520,18 @@
  #include "stm32h7xx_hal_hcd.h"
 #endif /* HAL_HCD_MODULE_ENABLED */
 
+#ifdef HAL_MSCSD_MODULE_ENABLED
+ #include "stm32h7xx_hal_mscsd.h"
+#endif /* HAL_MSCSD_MODULE_ENABLED */
+
+#ifdef HAL_MEMBENCH_MODULE_ENABLED
+ #include "stm32h7xx_hal_membench.h"
+#endif /* HAL_MEMBENCH_MODULE_ENABLED */
+
+#ifdef HAL_QOS_MODULE_ENABLED
+ #include "stm32h7xx_hal_qos.h"
+#endif /* HAL_QOS_MODULE_ENABLED */
+
 /* Exported macro ------------------------------------------------------------*/
 #ifdef  USE_FULL_ASSERT
 /**
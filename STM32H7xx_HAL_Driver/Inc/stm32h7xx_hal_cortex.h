@@ -39,6 +39,16 @@
   * @{
   */
 
+#if (__MPU_PRESENT == 1)
+#if !defined(CORE_CM4)
+#define MPU_PLAN_MAX_REGIONS   16U              /*!< Number of MPU regions of the Cortex-M7 */
+#else
+#define MPU_PLAN_MAX_REGIONS   8U               /*!< Number of MPU regions of the Cortex-M4 */
+#endif /* !defined(CORE_CM4) */
+#endif /* __MPU_PRESENT */
+
+#define NVIC_PLAN_MAX_ENTRIES  32U              /*!< Number of interrupts of an NVIC priority plan */
+
 #if (__MPU_PRESENT == 1)
 /** @defgroup CORTEX_MPU_Region_Initialization_Structure_definition MPU Region Initialization Structure Definition
   * @brief  MPU Region initialization structure
@@ -68,11 +78,65 @@ typedef struct
   uint8_t                IsBufferable;          /*!< Specifies the bufferable status of the protected region.
                                                      This parameter can be a value of @ref CORTEX_MPU_Access_Bufferable             */
 }MPU_Region_InitTypeDef;
+/**
+  * @}
+  */
+
+/** @defgroup CORTEX_MPU_Area_structure_definition MPU Area Structure Definition
+  * @brief  Memory area described to the MPU planner
+  * @{
+  */
+typedef struct
+{
+  uint32_t               BaseAddress;           /*!< Area start address, a multiple of 32 bytes                                     */
+  uint32_t               Size;                  /*!< Area size in bytes, a non-zero multiple of 32 bytes                            */
+  uint32_t               Usage;                 /*!< Intended use of the area.
+                                                     This parameter can be a value of @ref CORTEX_MPU_Area_Usage                    */
+}MPU_AreaTypeDef;
+/**
+  * @}
+  */
+
+/** @defgroup CORTEX_MPU_Plan_structure_definition MPU Plan Structure Definition
+  * @brief  MPU configuration computed by HAL_MPU_BuildPlan()
+  * @{
+  */
+typedef struct
+{
+  MPU_Region_InitTypeDef Region[MPU_PLAN_MAX_REGIONS]; /*!< Regions to program, numbered from 0                             */
+  uint32_t               NbRegions;             /*!< Number of regions used in Region[]                                       */
+}MPU_PlanTypeDef;
 /**
   * @}
   */
 #endif /* __MPU_PRESENT */
 
+/** @defgroup CORTEX_NVIC_Plan_structure_definition NVIC Plan Structure Definition
+  * @brief  Interrupt priorities computed by HAL_NVIC_BuildPlan()
+  * @{
+  */
+typedef struct
+{
+  IRQn_Type              IRQn;                  /*!< Interrupt registered in the plan                                         */
+  uint32_t               LatencyClass;          /*!< Latency class of the interrupt.
+                                                     This parameter can be a value of @ref CORTEX_NVIC_Latency_Class          */
+  uint32_t               PreemptPriority;       /*!< Preemption priority assigned by HAL_NVIC_BuildPlan()                     */
+  uint32_t               SubPriority;           /*!< Subpriority assigned by HAL_NVIC_BuildPlan()                             */
+}NVIC_PlanEntryTypeDef;
+
+typedef struct
+{
+  uint32_t               PriorityGroup;         /*!< Priority grouping of the plan.
+                                                     This parameter can be a value of @ref CORTEX_Preemption_Priority_Group   */
+  NVIC_PlanEntryTypeDef  Entry[NVIC_PLAN_MAX_ENTRIES]; /*!< Registered interrupts, by registration order                      */
+  uint32_t               NbEntries;             /*!< Number of interrupts used in Entry[]                                     */
+  uint32_t               TickLatencyClass;      /*!< Latency class of the HAL time base, NVIC_LATENCY_NONE if not planned     */
+  uint32_t               TickPriority;          /*!< Time base priority assigned by HAL_NVIC_BuildPlan()                      */
+}NVIC_PlanTypeDef;
+/**
+  * @}
+  */
+
 /**
   * @}
   */
@@ -100,6 +164,23 @@ typedef struct
   * @}
   */
 
+/** @defgroup CORTEX_NVIC_Latency_Class CORTEX NVIC Latency Class
+  * @brief    Latency classes of the interrupts of an NVIC priority plan, from the
+  *           most to the least urgent
+  * @{
+  */
+#define NVIC_LATENCY_ZERO            0x00000000U   /*!< Never masked by HAL_NVIC_EnterCriticalSection(): the handler must not
+                                                        call HAL services nor share data with masked handlers          */
+#define NVIC_LATENCY_CRITICAL        0x00000001U   /*!< Hard real-time paths: motor control PWM, audio DMA             */
+#define NVIC_LATENCY_HIGH            0x00000002U   /*!< Short deadline: communication FIFOs, capture timers            */
+#define NVIC_LATENCY_NORMAL          0x00000003U   /*!< Default class of the peripherals and of the HAL time base      */
+#define NVIC_LATENCY_LOW             0x00000004U   /*!< Bulk transfers: USB, Ethernet, SDMMC                           */
+#define NVIC_LATENCY_BACKGROUND      0x00000005U   /*!< Deferred processing, lowest priority                           */
+#define NVIC_LATENCY_NONE            0xFFFFFFFFU   /*!< Not planned (HAL time base only)                               */
+/**
+  * @}
+  */
+
 /** @defgroup CORTEX_SysTick_clock_source CORTEX _SysTick clock source
   * @{
   */
@@ -247,6 +328,24 @@ typedef struct
 #define  MPU_REGION_NUMBER15   ((uint8_t)0x0F)
 #endif /* !defined(CORE_CM4) */
 
+/**
+  * @}
+  */
+
+/** @defgroup CORTEX_MPU_Area_Usage CORTEX MPU Area Usage
+  * @brief    Intended use of a memory area, from which HAL_MPU_BuildPlan() derives
+  *           the region attributes
+  * @{
+  */
+#define  MPU_USAGE_CODE            0x00000000U   /*!< Read-only executable memory (Flash, XIP): write-back, read and write allocate */
+#define  MPU_USAGE_DATA            0x00000001U   /*!< Data accessed by the CPU only: write-back, read and write allocate, not executable */
+#define  MPU_USAGE_STACK           0x00000002U   /*!< Stack or heap: same attributes as MPU_USAGE_DATA                   */
+#define  MPU_USAGE_DMA_BUFFER      0x00000003U   /*!< Buffers shared with DMA masters: normal non-cacheable, shareable   */
+#define  MPU_USAGE_FRAMEBUFFER     0x00000004U   /*!< Display memory: write-through, no write allocate, so that the CPU
+                                                      writes reach the memory without cache maintenance                 */
+#define  MPU_USAGE_DEVICE          0x00000005U   /*!< Peripheral registers or external device: device memory, shareable   */
+#define  MPU_USAGE_NO_ACCESS       0x00000006U   /*!< No access: stack guard, or unmapped external memory that must not be
+                                                      read speculatively                                               */
 /**
   * @}
   */
@@ -308,6 +407,8 @@ uint32_t HAL_SYSTICK_Config(uint32_t TicksNumb);
 void HAL_MPU_Enable(uint32_t MPU_Control);
 void HAL_MPU_Disable(void);
 void HAL_MPU_ConfigRegion(MPU_Region_InitTypeDef *MPU_Init);
+HAL_StatusTypeDef HAL_MPU_BuildPlan(const MPU_AreaTypeDef *pAreas, uint32_t NbAreas, MPU_PlanTypeDef *pPlan);
+void HAL_MPU_ApplyPlan(const MPU_PlanTypeDef *pPlan, uint32_t MPU_Control);
 #endif /* __MPU_PRESENT */
 uint32_t HAL_NVIC_GetPriorityGrouping(void);
 void HAL_NVIC_GetPriority(IRQn_Type IRQn, uint32_t PriorityGroup, uint32_t* pPreemptPriority, uint32_t* pSubPriority);
@@ -321,6 +422,21 @@ void HAL_SYSTICK_Callback(void);
 uint32_t HAL_GetCurrentCPUID(void);
 
 
+/**
+  * @}
+  */
+
+/** @addtogroup CORTEX_Exported_Functions_Group3
+ * @{
+ */
+/* Interrupt priority planning functions **************************************/
+void HAL_NVIC_InitPlan(NVIC_PlanTypeDef *pPlan, uint32_t PriorityGroup);
+HAL_StatusTypeDef HAL_NVIC_RegisterIRQ(NVIC_PlanTypeDef *pPlan, IRQn_Type IRQn, uint32_t LatencyClass);
+void HAL_NVIC_RegisterTick(NVIC_PlanTypeDef *pPlan, uint32_t LatencyClass);
+HAL_StatusTypeDef HAL_NVIC_BuildPlan(NVIC_PlanTypeDef *pPlan);
+HAL_StatusTypeDef HAL_NVIC_ApplyPlan(const NVIC_PlanTypeDef *pPlan);
+uint32_t HAL_NVIC_EnterCriticalSection(void);
+void HAL_NVIC_ExitCriticalSection(uint32_t BasePri);
 /**
   * @}
   */
@@ -348,6 +464,10 @@ uint32_t HAL_GetCurrentCPUID(void);
 
 #define IS_NVIC_DEVICE_IRQ(IRQ)                (((int32_t)IRQ) >= 0x00)
 
+#define IS_NVIC_PLAN_IRQ(IRQ)                  (((int32_t)IRQ) >= ((int32_t)MemoryManagement_IRQn))
+
+#define IS_NVIC_LATENCY_CLASS(CLASS)           ((CLASS) <= NVIC_LATENCY_BACKGROUND)
+
 #define IS_SYSTICK_CLK_SOURCE(SOURCE) (((SOURCE) == SYSTICK_CLKSOURCE_HCLK) || \
                                        ((SOURCE) == SYSTICK_CLKSOURCE_HCLK_DIV8))
 
@@ -436,6 +556,8 @@ uint32_t HAL_GetCurrentCPUID(void);
                                      ((SIZE) == MPU_REGION_SIZE_4GB))
 
 #define IS_MPU_SUB_REGION_DISABLE(SUBREGION)  ((SUBREGION) < (uint16_t)0x00FF)
+
+#define IS_MPU_AREA_USAGE(USAGE)    ((USAGE) <= MPU_USAGE_NO_ACCESS)
 #endif /* __MPU_PRESENT */
 
 /**
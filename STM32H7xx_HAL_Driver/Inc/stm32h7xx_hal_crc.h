@@ -128,7 +128,31 @@ typedef struct
                                           Note that constant CRC_INPUT_FORMAT_UNDEFINED is defined but an initialization
                                           error must occur if InputBufferFormat is not one of the three values listed
                                           above  */
+
+#if defined(HAL_DMA_MODULE_ENABLED)
+  DMA_HandleTypeDef           *hdmain;     /*!< CRC In DMA handle parameters, used by HAL_CRC_Update_DMA() */
+
+  uint8_t                     *pTailBuffer; /*!< Trailing bytes fed by the CPU at the end of the DMA transfer */
+
+  uint32_t                    TailSize;    /*!< Number of trailing bytes, less than 4                  */
+#endif /* HAL_DMA_MODULE_ENABLED */
 } CRC_HandleTypeDef;
+/**
+  * @brief  CRC context structure definition, used to share the CRC unit between several streams
+  */
+typedef struct
+{
+  uint32_t Crc;              /*!< Intermediate CRC, read without output inversion */
+
+  uint32_t InitValue;        /*!< INIT register content                           */
+
+  uint32_t Polynomial;       /*!< POL register content                            */
+
+  uint32_t Control;          /*!< CR register content (POLYSIZE, REV_IN, REV_OUT) */
+
+  uint32_t InputDataFormat;  /*!< Input data format of the stream, a value of @ref CRC_Input_Buffer_Format */
+} CRC_ContextTypeDef;
+
 /**
   * @}
   */
@@ -280,6 +304,13 @@ typedef struct
                                                    ((FORMAT) == CRC_INPUTDATA_FORMAT_HALFWORDS) || \
                                                    ((FORMAT) == CRC_INPUTDATA_FORMAT_WORDS))
 
+/* Size in bytes of one input data element: 1, 2 or 4 */
+#define CRC_INPUTDATA_ELEMENT_SIZE(FORMAT)        (1UL << ((FORMAT) - 1U))
+
+#define IS_CRC_STREAM_BUFFER(FORMAT, ADDRESS, SIZE) \
+  ((((ADDRESS) % CRC_INPUTDATA_ELEMENT_SIZE(FORMAT)) == 0U) && \
+   (((SIZE) % CRC_INPUTDATA_ELEMENT_SIZE(FORMAT)) == 0U))
+
 /**
   * @}
   */
@@ -323,6 +354,24 @@ HAL_CRC_StateTypeDef HAL_CRC_GetState(CRC_HandleTypeDef *hcrc);
   * @}
   */
 
+/* Streaming functions ********************************************************/
+/** @defgroup CRC_Exported_Functions_Group4 Streaming functions
+  * @{
+  */
+HAL_StatusTypeDef HAL_CRC_Begin(CRC_HandleTypeDef *hcrc);
+HAL_StatusTypeDef HAL_CRC_Update(CRC_HandleTypeDef *hcrc, uint8_t *pData, uint32_t Size);
+#if defined(HAL_DMA_MODULE_ENABLED)
+HAL_StatusTypeDef HAL_CRC_Update_DMA(CRC_HandleTypeDef *hcrc, uint8_t *pData, uint32_t Size);
+#endif /* HAL_DMA_MODULE_ENABLED */
+uint32_t HAL_CRC_Finish(CRC_HandleTypeDef *hcrc);
+HAL_StatusTypeDef HAL_CRC_SaveContext(CRC_HandleTypeDef *hcrc, CRC_ContextTypeDef *pContext);
+HAL_StatusTypeDef HAL_CRC_RestoreContext(CRC_HandleTypeDef *hcrc, const CRC_ContextTypeDef *pContext);
+void HAL_CRC_UpdateCpltCallback(CRC_HandleTypeDef *hcrc);
+void HAL_CRC_ErrorCallback(CRC_HandleTypeDef *hcrc);
+/**
+  * @}
+  */
+
 /**
   * @}
   */
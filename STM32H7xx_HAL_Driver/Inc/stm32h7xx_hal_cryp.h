@@ -70,6 +70,24 @@ typedef struct
 
 } CRYP_ConfigTypeDef;
 
+/**
+  * @brief  CRYP AES-GCM/CCM stream structure definition: one message in progress,
+  *         swapped in and out of the peripheral by the CRYPEx AEAD stream functions
+  */
+typedef struct
+{
+  CRYP_ConfigTypeDef Init;             /*!< Stream configuration, the key, IV, B0 and header buffers must be kept
+                                            until the first payload update */
+  uint32_t KeyIVConfig;                /*!< Set once the init and header phases are done for the stream */
+  uint32_t SizesSum;                   /*!< Payload length processed so far, in bytes */
+  uint32_t Phase;                      /*!< CRYP handle phase of the stream */
+  uint32_t PayloadClosed;              /*!< Set once a payload piece not multiple of 16 bytes is processed */
+  uint32_t CR;                         /*!< Saved CR register */
+  uint32_t IV[4];                      /*!< Saved IV0LR, IV0RR, IV1LR and IV1RR registers */
+  uint32_t CSGCMCCM[8];                /*!< Saved CSGCMCCMxR context swap registers */
+  uint32_t CSGCM[8];                   /*!< Saved CSGCMxR context swap registers (GCM only) */
+} CRYP_AEADStreamTypeDef;
+
 
 /**
   * @brief  CRYP State Structure definition
@@ -131,6 +149,8 @@ typedef struct
                                                            for a single signature computation after several
                                                            messages processing */
 
+  CRYP_AEADStreamTypeDef            *pActiveStream;   /*!< AEAD stream loaded in the peripheral */
+
 #if (USE_HAL_CRYP_REGISTER_CALLBACKS == 1)
   void (*InCpltCallback)(struct __CRYP_HandleTypeDef *hcryp);      /*!< CRYP Input FIFO transfer completed callback  */
   void (*OutCpltCallback)(struct __CRYP_HandleTypeDef *hcryp);     /*!< CRYP Output FIFO transfer completed callback */
@@ -95,6 +95,22 @@ HAL_StatusTypeDef HAL_CRYPEx_AESGCM_GenerateAuthTAG(CRYP_HandleTypeDef *hcryp, u
 HAL_StatusTypeDef HAL_CRYPEx_AESCCM_GenerateAuthTAG(CRYP_HandleTypeDef *hcryp, uint32_t *AuthTag, uint32_t Timeout);
 
 
+/**
+  * @}
+  */
+
+/** @addtogroup CRYPEx_Exported_Functions_Group2
+  * @{
+  */
+HAL_StatusTypeDef HAL_CRYPEx_AEADStreamInit(CRYP_HandleTypeDef *hcryp, CRYP_AEADStreamTypeDef *hstream,
+                                            const CRYP_ConfigTypeDef *pConf);
+HAL_StatusTypeDef HAL_CRYPEx_AEADStreamEncrypt_DMA(CRYP_HandleTypeDef *hcryp, CRYP_AEADStreamTypeDef *hstream,
+                                                   uint32_t *Input, uint16_t Size, uint32_t *Output);
+HAL_StatusTypeDef HAL_CRYPEx_AEADStreamDecrypt_DMA(CRYP_HandleTypeDef *hcryp, CRYP_AEADStreamTypeDef *hstream,
+                                                   uint32_t *Input, uint16_t Size, uint32_t *Output);
+HAL_StatusTypeDef HAL_CRYPEx_AEADStreamFinish(CRYP_HandleTypeDef *hcryp, CRYP_AEADStreamTypeDef *hstream,
+                                              uint32_t *AuthTag, uint32_t Timeout);
+HAL_StatusTypeDef HAL_CRYPEx_AEADStreamSuspend(CRYP_HandleTypeDef *hcryp);
 /**
   * @}
   */
@@ -0,0 +1,217 @@
+/**
+  ******************************************************************************
+  * @file    stm32h7xx_hal_d3auto.h
+  * @author  MCD Application Team
+  * @brief   Header file of D3 domain autonomous acquisition HAL module.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef STM32H7xx_HAL_D3AUTO_H
+#define STM32H7xx_HAL_D3AUTO_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32h7xx_hal_def.h"
+
+#if defined(RCC_D3AMR_BDMAAMEN)
+
+/** @addtogroup STM32H7xx_HAL_Driver
+  * @{
+  */
+
+/** @addtogroup D3AUTO
+  * @{
+  */
+
+/* Exported types ------------------------------------------------------------*/
+/** @defgroup D3AUTO_Exported_Types D3AUTO Exported Types
+  * @{
+  */
+
+/**
+  * @brief  HAL D3AUTO State structure definition
+  */
+typedef enum
+{
+  HAL_D3AUTO_STATE_RESET      = 0x00U,    /*!< Acquisition not yet initialized                  */
+  HAL_D3AUTO_STATE_READY      = 0x01U,    /*!< Acquisition initialized and ready for use        */
+  HAL_D3AUTO_STATE_BUSY       = 0x02U,    /*!< BDMA running, D3 domain kept in Run mode         */
+  HAL_D3AUTO_STATE_ERROR      = 0x03U     /*!< BDMA transfer error, acquisition stopped         */
+}HAL_D3AUTO_StateTypeDef;
+
+/**
+  * @brief  D3AUTO Init structure definition
+  */
+typedef struct
+{
+  uint32_t AutonomousClocks;          /*!< D3 peripherals kept clocked while the CPU is in CStop, the BDMA and
+                                           SRAM4 clocks are always kept.
+                                           This parameter can be a combination of @ref D3AUTO_Clocks */
+
+  uint32_t TriggerSignal;             /*!< DMAMUX2 request generator trigger, used when the BDMA request is a
+                                           BDMA_REQUEST_GENERATORx. This parameter can be a value of
+                                           @ref DMAEx_MUX_SignalGeneratorID_selection (HAL_DMAMUX2_REQ_GEN_xxx) */
+
+  uint32_t TriggerPolarity;           /*!< DMAMUX2 request generator trigger polarity. This parameter can be a
+                                           value of @ref DMAEx_MUX_RequestGeneneratorPolarity_selection */
+
+  uint32_t RequestNumber;             /*!< Number of BDMA requests generated on each trigger, from 1 to 32 */
+}D3AUTO_InitTypeDef;
+
+/**
+  * @brief  D3AUTO handle Structure definition
+  */
+typedef struct
+{
+  DMA_HandleTypeDef             *hdma;        /*!< BDMA channel handle, initialized by the application in
+                                                   circular mode with the request of the D3 peripheral    */
+  D3AUTO_InitTypeDef             Init;        /*!< Acquisition initialization parameters                */
+  uint8_t                       *pBuffer;     /*!< Acquisition buffer, located in SRAM4                  */
+  uint32_t                       Length;      /*!< Number of BDMA data items of the buffer               */
+  __IO uint32_t                  WakeUpCount; /*!< Number of half buffers filled since the start         */
+  HAL_LockTypeDef                Lock;        /*!< Locking object                                        */
+  __IO HAL_D3AUTO_StateTypeDef   State;       /*!< Acquisition state                                     */
+  __IO uint32_t                  ErrorCode;   /*!< Acquisition error code                                */
+}D3AUTO_HandleTypeDef;
+
+/**
+  * @}
+  */
+
+/* Exported constants --------------------------------------------------------*/
+/** @defgroup D3AUTO_Exported_Constants D3AUTO Exported Constants
+  * @{
+  */
+
+/** @defgroup D3AUTO_ErrorCode D3AUTO Error Code
+  * @{
+  */
+#define HAL_D3AUTO_ERROR_NONE               ((uint32_t)0x00000000U)   /*!< No error                                    */
+#define HAL_D3AUTO_ERROR_PARAM              ((uint32_t)0x00000001U)   /*!< Invalid parameter, or buffer not in SRAM4   */
+#define HAL_D3AUTO_ERROR_DMA                ((uint32_t)0x00000002U)   /*!< BDMA error, see the ErrorCode of the handle */
+/**
+  * @}
+  */
+
+/** @defgroup D3AUTO_Clocks D3AUTO Autonomous Clocks
+  * @{
+  */
+#define D3AUTO_CLOCK_NONE                   0x00000000U               /*!< Only the BDMA and SRAM4 are kept clocked */
+#define D3AUTO_CLOCK_LPUART1                RCC_D3AMR_LPUART1AMEN     /*!< LPUART1 autonomous clock */
+#define D3AUTO_CLOCK_SPI6                   RCC_D3AMR_SPI6AMEN        /*!< SPI6 autonomous clock    */
+#define D3AUTO_CLOCK_I2C4                   RCC_D3AMR_I2C4AMEN        /*!< I2C4 autonomous clock    */
+#define D3AUTO_CLOCK_LPTIM2                 RCC_D3AMR_LPTIM2AMEN      /*!< LPTIM2 autonomous clock  */
+#define D3AUTO_CLOCK_LPTIM3                 RCC_D3AMR_LPTIM3AMEN      /*!< LPTIM3 autonomous clock  */
+#define D3AUTO_CLOCK_LPTIM4                 RCC_D3AMR_LPTIM4AMEN      /*!< LPTIM4 autonomous clock  */
+#define D3AUTO_CLOCK_LPTIM5                 RCC_D3AMR_LPTIM5AMEN      /*!< LPTIM5 autonomous clock  */
+#define D3AUTO_CLOCK_ADC3                   RCC_D3AMR_ADC3AMEN        /*!< ADC3 autonomous clock    */
+#define D3AUTO_CLOCK_SAI4                   RCC_D3AMR_SAI4AMEN        /*!< SAI4 autonomous clock    */
+#define D3AUTO_CLOCK_COMP12                 RCC_D3AMR_COMP12AMEN      /*!< COMP1/2 autonomous clock */
+#define D3AUTO_CLOCK_RTC                    RCC_D3AMR_RTCAMEN         /*!< RTC autonomous clock     */
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/* Exported functions --------------------------------------------------------*/
+/** @addtogroup D3AUTO_Exported_Functions
+  * @{
+  */
+
+/** @addtogroup D3AUTO_Exported_Functions_Group1
+  * @{
+  */
+/* Initialization/de-initialization functions  ********************************/
+HAL_StatusTypeDef     HAL_D3AUTO_Init               (D3AUTO_HandleTypeDef *hd3auto);
+HAL_StatusTypeDef     HAL_D3AUTO_DeInit             (D3AUTO_HandleTypeDef *hd3auto);
+/**
+  * @}
+  */
+
+/** @addtogroup D3AUTO_Exported_Functions_Group2
+  * @{
+  */
+/* IO operation functions *****************************************************/
+HAL_StatusTypeDef     HAL_D3AUTO_Start              (D3AUTO_HandleTypeDef *hd3auto, uint32_t SrcAddress, uint8_t *pBuffer, uint32_t Length);
+HAL_StatusTypeDef     HAL_D3AUTO_Stop               (D3AUTO_HandleTypeDef *hd3auto);
+void                  HAL_D3AUTO_EnterSTOPMode      (D3AUTO_HandleTypeDef *hd3auto, uint32_t Regulator);
+
+/* Callback functions *********************************************************/
+void                  HAL_D3AUTO_HalfBufferCallback (D3AUTO_HandleTypeDef *hd3auto);
+void                  HAL_D3AUTO_FullBufferCallback (D3AUTO_HandleTypeDef *hd3auto);
+void                  HAL_D3AUTO_ErrorCallback      (D3AUTO_HandleTypeDef *hd3auto);
+/**
+  * @}
+  */
+
+/** @addtogroup D3AUTO_Exported_Functions_Group3
+  * @{
+  */
+/* Peripheral State and Error functions ***************************************/
+HAL_D3AUTO_StateTypeDef HAL_D3AUTO_GetState         (D3AUTO_HandleTypeDef *hd3auto);
+uint32_t              HAL_D3AUTO_GetError           (D3AUTO_HandleTypeDef *hd3auto);
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/* Private macros ------------------------------------------------------------*/
+/** @defgroup D3AUTO_Private_Macros D3AUTO Private Macros
+  * @{
+  */
+#define D3AUTO_CLOCK_ALL                    (D3AUTO_CLOCK_LPUART1 | D3AUTO_CLOCK_SPI6 | D3AUTO_CLOCK_I2C4 |    \
+                                             D3AUTO_CLOCK_LPTIM2 | D3AUTO_CLOCK_LPTIM3 | D3AUTO_CLOCK_LPTIM4 | \
+                                             D3AUTO_CLOCK_LPTIM5 | D3AUTO_CLOCK_ADC3 | D3AUTO_CLOCK_SAI4 |     \
+                                             D3AUTO_CLOCK_COMP12 | D3AUTO_CLOCK_RTC)
+
+#define IS_D3AUTO_CLOCKS(__CLOCKS__)        (((__CLOCKS__) & ~D3AUTO_CLOCK_ALL) == 0U)
+
+#if defined(STM32H723xx) || defined(STM32H725xx) || defined(STM32H730xx) || defined(STM32H730xxQ) || \
+    defined(STM32H733xx) || defined(STM32H735xx)
+#define D3AUTO_SRAM4_SIZE                   0x4000U                   /* 16 Kbytes */
+#else
+#define D3AUTO_SRAM4_SIZE                   0x10000U                  /* 64 Kbytes */
+#endif /* STM32H723xx || STM32H725xx || STM32H730xx || STM32H730xxQ || STM32H733xx || STM32H735xx */
+
+#define IS_D3AUTO_SRAM4_BUFFER(__ADDRESS__, __SIZE__) (((__ADDRESS__) >= D3_SRAM_BASE) &&          \
+                                                       ((__SIZE__) <= D3AUTO_SRAM4_SIZE) &&           \
+                                                       (((__ADDRESS__) - D3_SRAM_BASE) <= (D3AUTO_SRAM4_SIZE - (__SIZE__))))
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#endif /* RCC_D3AMR_BDMAAMEN */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STM32H7xx_HAL_D3AUTO_H */
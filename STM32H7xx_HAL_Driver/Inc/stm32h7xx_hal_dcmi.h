@@ -117,6 +117,42 @@ typedef struct
                                             This parameter can be a value of @ref DCMI_Line_Select_Start     */
 } DCMI_InitTypeDef;
 
+/**
+  * @brief  DCMI line streaming structure definition
+  */
+typedef struct
+{
+  uint32_t                      pBuffer;             /*!< Address of the ring of line buffers, word aligned       */
+
+  uint32_t                      LineSize;            /*!< Size in bytes of one captured line, after crop and
+                                                          decimation. It must be a multiple of 4                */
+
+  uint32_t                      LinesPerBuffer;      /*!< Number of lines of one buffer of the ring, each buffer
+                                                          being at most 0xFFFF words                            */
+
+  uint32_t                      NbBuffers;           /*!< Number of buffers of the ring, at least 2              */
+
+  uint32_t                      FrameLines;          /*!< Number of lines of one captured frame, a multiple of
+                                                          LinesPerBuffer                                        */
+
+#if defined(HAL_MDMA_MODULE_ENABLED)
+  MDMA_HandleTypeDef            *hmdma;              /*!< MDMA handle moving each completed buffer to DstAddress,
+                                                          or NULL. Each buffer is then at most 65536 bytes      */
+
+  uint32_t                      DstAddress;          /*!< Address of the frame moved by the MDMA                 */
+#endif /* HAL_MDMA_MODULE_ENABLED */
+
+  __IO uint32_t                 CompletedBuffer;     /*!< Index in the ring of the last completed buffer         */
+
+  __IO uint32_t                 CompletedLine;       /*!< First frame line of the last completed buffer          */
+
+  __IO uint32_t                 FrameCount;          /*!< Number of frames captured since the start              */
+
+  __IO uint32_t                 NextBuffer;          /*!< Index in the ring of the buffer being filled          */
+
+  __IO uint32_t                 NextLine;            /*!< First frame line of the buffer being filled           */
+} DCMI_LineStreamTypeDef;
+
 /**
   * @brief  DCMI handle Structure definition
   */
@@ -146,11 +182,14 @@ typedef struct
 
   __IO uint32_t                 ErrorCode;           /*!< DCMI Error code              */
 
+  DCMI_LineStreamTypeDef        *pLineStream;        /*!< Line streaming in progress, or NULL */
+
 #if (USE_HAL_DCMI_REGISTER_CALLBACKS == 1)
   void (* FrameEventCallback)(struct __DCMI_HandleTypeDef *hdcmi);       /*!< DCMI Frame Event Callback */
   void (* VsyncEventCallback)(struct __DCMI_HandleTypeDef *hdcmi);       /*!< DCMI Vsync Event Callback */
   void (* LineEventCallback)(struct __DCMI_HandleTypeDef *hdcmi);        /*!< DCMI Line Event Callback  */
   void (* ErrorCallback)(struct __DCMI_HandleTypeDef *hdcmi);            /*!< DCMI Error Callback       */
+  void (* LineBufferCpltCallback)(struct __DCMI_HandleTypeDef *hdcmi);   /*!< DCMI Line Buffer Complete Callback */
   void (* MspInitCallback)(struct __DCMI_HandleTypeDef *hdcmi);          /*!< DCMI Msp Init callback    */
   void (* MspDeInitCallback)(struct __DCMI_HandleTypeDef *hdcmi);        /*!< DCMI Msp DeInit callback  */
 #endif  /* USE_HAL_DCMI_REGISTER_CALLBACKS */
@@ -167,7 +206,8 @@ typedef enum
   HAL_DCMI_LINE_EVENT_CB_ID     = 0x02U,    /*!< DCMI Line Event Callback ID  */
   HAL_DCMI_ERROR_CB_ID          = 0x03U,    /*!< DCMI Error Callback ID       */
   HAL_DCMI_MSPINIT_CB_ID        = 0x04U,    /*!< DCMI MspInit callback ID     */
-  HAL_DCMI_MSPDEINIT_CB_ID      = 0x05U     /*!< DCMI MspDeInit callback ID   */
+  HAL_DCMI_MSPDEINIT_CB_ID      = 0x05U,    /*!< DCMI MspDeInit callback ID   */
+  HAL_DCMI_LINE_BUFFER_CPLT_CB_ID = 0x06U   /*!< DCMI Line Buffer Complete Callback ID */
 
 } HAL_DCMI_CallbackIDTypeDef;
 
@@ -540,6 +580,8 @@ HAL_StatusTypeDef HAL_DCMI_UnRegisterCallback(DCMI_HandleTypeDef *hdcmi, HAL_DCM
  */
 /* IO operation functions *****************************************************/
 HAL_StatusTypeDef HAL_DCMI_Start_DMA(DCMI_HandleTypeDef* hdcmi, uint32_t DCMI_Mode, uint32_t pData, uint32_t Length);
+HAL_StatusTypeDef HAL_DCMI_StartLineStream_DMA(DCMI_HandleTypeDef *hdcmi, uint32_t DCMI_Mode,
+                                               DCMI_LineStreamTypeDef *pStream);
 HAL_StatusTypeDef HAL_DCMI_Stop(DCMI_HandleTypeDef* hdcmi);
 HAL_StatusTypeDef HAL_DCMI_Suspend(DCMI_HandleTypeDef* hdcmi);
 HAL_StatusTypeDef HAL_DCMI_Resume(DCMI_HandleTypeDef* hdcmi);
@@ -547,6 +589,7 @@ void       HAL_DCMI_ErrorCallback(DCMI_HandleTypeDef *hdcmi);
 void       HAL_DCMI_LineEventCallback(DCMI_HandleTypeDef *hdcmi);
 void       HAL_DCMI_FrameEventCallback(DCMI_HandleTypeDef *hdcmi);
 void       HAL_DCMI_VsyncEventCallback(DCMI_HandleTypeDef *hdcmi);
+void       HAL_DCMI_LineBufferCpltCallback(DCMI_HandleTypeDef *hdcmi);
 void       HAL_DCMI_IRQHandler(DCMI_HandleTypeDef *hdcmi);
 /**
   * @}
@@ -560,6 +603,8 @@ HAL_StatusTypeDef     HAL_DCMI_ConfigCrop(DCMI_HandleTypeDef *hdcmi, uint32_t X0
 HAL_StatusTypeDef     HAL_DCMI_EnableCrop(DCMI_HandleTypeDef *hdcmi);
 HAL_StatusTypeDef     HAL_DCMI_DisableCrop(DCMI_HandleTypeDef *hdcmi);
 HAL_StatusTypeDef     HAL_DCMI_ConfigSyncUnmask(DCMI_HandleTypeDef *hdcmi, DCMI_SyncUnmaskTypeDef *SyncUnmask);
+HAL_StatusTypeDef     HAL_DCMI_ConfigDecimation(DCMI_HandleTypeDef *hdcmi, uint32_t ByteSelectMode, uint32_t ByteSelectStart,
+                                                uint32_t LineSelectMode, uint32_t LineSelectStart);
 
 /**
   * @}
@@ -27,6 +27,7 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "stm32h7xx.h"
+#include "stm32h7xx_hal_caps.h"
 #include "Legacy/stm32_hal_legacy.h"
 #include <stddef.h>
 #include <math.h>
@@ -87,6 +88,40 @@ typedef enum
 
 #if (USE_RTOS == 1)
   #error " USE_RTOS should be 0 in the current HAL release "
+#elif defined (USE_HAL_NO_LOCK) && (USE_HAL_NO_LOCK == 1U)
+  /* Single execution context: the HAL handles are never accessed concurrently,
+     the locks are compiled out */
+  #define __HAL_LOCK(__HANDLE__)                                           \
+                                do{                                        \
+                                  }while (0)
+
+  #define __HAL_UNLOCK(__HANDLE__)                                          \
+                                  do{                                       \
+                                    }while (0)
+#elif defined (USE_HAL_ATOMIC_LOCK) && (USE_HAL_ATOMIC_LOCK == 1U)
+  /* Atomic test-and-set of the Lock field with exclusive accesses: an interrupt
+     taking the lock between the test and the set makes the store fail and the
+     test is done again. The exclusive access is on the first byte of the Lock
+     field, which holds the whole value whatever the enum size */
+  #define __HAL_LOCK(__HANDLE__)                                                              \
+                                do{                                                         \
+                                    do{                                                     \
+                                        if(__LDREXB((volatile uint8_t *)&(__HANDLE__)->Lock) \
+                                           == (uint8_t)HAL_LOCKED)                          \
+                                        {                                                   \
+                                           __CLREX();                                       \
+                                           return HAL_BUSY;                                 \
+                                        }                                                   \
+                                      }while(__STREXB((uint8_t)HAL_LOCKED,                  \
+                                             (volatile uint8_t *)&(__HANDLE__)->Lock) != 0U); \
+                                    __DMB();                                                \
+                                  }while (0)
+
+  #define __HAL_UNLOCK(__HANDLE__)                                          \
+                                  do{                                       \
+                                      __DMB();                              \
+                                      (__HANDLE__)->Lock = HAL_UNLOCKED;    \
+                                    }while (0)
 #else
   #define __HAL_LOCK(__HANDLE__)                                           \
                                 do{                                        \
@@ -210,6 +245,75 @@ typedef enum
 
 #endif
 
+/**
+  * @brief  __HOT_RAM_FUNC definition
+  */
+#if defined (USE_HAL_HOT_RAM_FUNC) && (USE_HAL_HOT_RAM_FUNC == 1U)
+/* Interrupt hot paths of the HAL (DMA, UART, SPI and PCD IRQ handlers with their
+   per-data routines, USB FIFO accesses and HAL_IncTick) are placed in RAM to avoid
+   the flash wait states and the I-cache misses. The section defaults to ".RamFunc";
+   define HOT_RAM_FUNC_SECTION to an ITCM output section of the linker script to get
+   zero wait state execution.
+*/
+#ifndef HOT_RAM_FUNC_SECTION
+#define HOT_RAM_FUNC_SECTION ".RamFunc"
+#endif /* HOT_RAM_FUNC_SECTION */
+
+#if defined ( __ICCARM__ )
+#define __HOT_RAM_FUNC __ramfunc
+#else
+#define __HOT_RAM_FUNC __attribute__((section(HOT_RAM_FUNC_SECTION)))
+#endif
+
+#else
+#define __HOT_RAM_FUNC
+#endif /* USE_HAL_HOT_RAM_FUNC */
+
+/**
+  * @brief  Memory placement definitions
+  */
+/* Code and data placed in the tightly coupled and domain memories. The section
+   names extend the default ones (.text, .data, .bss): a linker script without
+   these memories keeps them in flash and in the main RAM, a linker script with
+   them collects "*(.text.itcm*)", "*(.data.dtcm*)", "*(.bss.dtcm*)"... into the
+   matching output sections, listed in the startup copy and zero tables. With
+   IAR the sections are named ".itcm", ".dtcm_data"... and placed by the .icf
+   file ("initialize by copy" for the code and initialized data).
+   __SRAM4_DATA/__SRAM4_BSS data lie in the D3 domain but are initialized by the
+   startup code at each reset. Data that must survive a reset (D1/D2 standby
+   wake-up, software reset) use __SRAM4_NOINIT: its ".noinit.sram4" section
+   must go to a NOLOAD output section that is not part of the zero table (IAR:
+   __no_init, Keil: UNINIT execution region).
+*/
+#if defined ( __ICCARM__ )
+#define __ITCM_FUNC      _Pragma("location=\".itcm\"")
+#define __DTCM_DATA      _Pragma("location=\".dtcm_data\"")
+#define __DTCM_BSS       _Pragma("location=\".dtcm_bss\"")
+#define __AXISRAM_DATA   _Pragma("location=\".axisram_data\"")
+#define __AXISRAM_BSS    _Pragma("location=\".axisram_bss\"")
+#define __SRAM4_DATA     _Pragma("location=\".sram4_data\"")
+#define __SRAM4_BSS      _Pragma("location=\".sram4_bss\"")
+#define __SRAM4_NOINIT   _Pragma("location=\".sram4_noinit\"") __no_init
+#elif defined ( __CC_ARM )
+#define __ITCM_FUNC      __attribute__((section(".text.itcm")))
+#define __DTCM_DATA      __attribute__((section(".data.dtcm")))
+#define __DTCM_BSS       __attribute__((section(".bss.dtcm"), zero_init))
+#define __AXISRAM_DATA   __attribute__((section(".data.axisram")))
+#define __AXISRAM_BSS    __attribute__((section(".bss.axisram"), zero_init))
+#define __SRAM4_DATA     __attribute__((section(".data.sram4")))
+#define __SRAM4_BSS      __attribute__((section(".bss.sram4"), zero_init))
+#define __SRAM4_NOINIT   __attribute__((section(".noinit.sram4"), zero_init))
+#else
+#define __ITCM_FUNC      __attribute__((section(".text.itcm")))
+#define __DTCM_DATA      __attribute__((section(".data.dtcm")))
+#define __DTCM_BSS       __attribute__((section(".bss.dtcm")))
+#define __AXISRAM_DATA   __attribute__((section(".data.axisram")))
+#define __AXISRAM_BSS    __attribute__((section(".bss.axisram")))
+#define __SRAM4_DATA     __attribute__((section(".data.sram4")))
+#define __SRAM4_BSS      __attribute__((section(".bss.sram4")))
+#define __SRAM4_NOINIT   __attribute__((section(".noinit.sram4")))
+#endif
+
 
 #ifdef __cplusplus
 }
@@ -288,6 +288,54 @@ typedef void (*pDFSDM_Filter_CallbackTypeDef)(DFSDM_Filter_HandleTypeDef *hdfsdm
 typedef void (*pDFSDM_Filter_AwdCallbackTypeDef)(DFSDM_Filter_HandleTypeDef *hdfsdm_filter, uint32_t Channel, uint32_t Threshold);
 #endif
 
+/* Maximum number of microphones of an array: one filter per microphone */
+#if defined(DFSDM1_Filter7)
+#define DFSDM_MICARRAY_MAX_MIC               8U
+#else
+#define DFSDM_MICARRAY_MAX_MIC               4U
+#endif /* DFSDM1_Filter7 */
+
+/**
+  * @brief  DFSDM microphone array init structure definition
+  */
+typedef struct
+{
+  uint32_t MicNumber;                              /*!< Number of PDM microphones.
+                                                        This parameter must be a number between Min_Data = 1 and
+                                                        Max_Data = DFSDM_MICARRAY_MAX_MIC */
+  uint32_t ClockSelection;                         /*!< Source of the output clock provided to the microphones.
+                                                        This parameter can be a value of @ref DFSDM_Channel_OuputClock */
+  uint32_t ClockFrequency;                         /*!< Frequency in Hz of the selected output clock source */
+  uint32_t SampleRate;                             /*!< Target PCM sample rate in Hz. The output clock frequency must
+                                                        be a multiple of the sample rate */
+  uint32_t Gain;                                   /*!< Digital gain in 6 dB steps, 0 maps the PDM full scale to
+                                                        the 24-bit full scale */
+  uint32_t DataSize;                               /*!< Size of the samples written by DMA.
+                                                        This parameter can be a value of @ref DFSDM_MicArray_DataSize */
+  uint32_t Pins[DFSDM_MICARRAY_MAX_MIC];           /*!< Input pins of each microphone channel.
+                                                        This parameter can be a value of @ref DFSDM_Channel_InputPins */
+  uint32_t SerialInterface[DFSDM_MICARRAY_MAX_MIC]; /*!< Sampling edge of each microphone channel.
+                                                        This parameter can be DFSDM_CHANNEL_SPI_RISING or
+                                                        DFSDM_CHANNEL_SPI_FALLING */
+} DFSDM_MicArray_InitTypeDef;
+
+/**
+  * @brief  DFSDM microphone array handle structure definition
+  */
+typedef struct
+{
+  DFSDM_Channel_HandleTypeDef *hchannel[DFSDM_MICARRAY_MAX_MIC]; /*!< Channel handle of each microphone, with
+                                                                      the channel instance set */
+  DFSDM_Filter_HandleTypeDef  *hfilter[DFSDM_MICARRAY_MAX_MIC];  /*!< Filter handle of each microphone, with the
+                                                                      filter instance set and hdmaReg linked.
+                                                                      hfilter[0] must be the DFSDM_FLT0 instance */
+  DFSDM_MicArray_InitTypeDef   Init;                             /*!< Microphone array init parameters */
+  uint8_t                     *pBuffer;                          /*!< Capture buffer, one block per microphone */
+  uint32_t                     FrameCount;                       /*!< Number of samples per microphone in the buffer */
+  uint32_t                     PdmClock;                         /*!< Resulting microphone clock frequency in Hz */
+  uint32_t                     Oversampling;                     /*!< Resulting filter oversampling ratio */
+} DFSDM_MicArray_HandleTypeDef;
+
 /**
   * @}
   */
@@ -511,6 +559,15 @@ typedef void (*pDFSDM_Filter_AwdCallbackTypeDef)(DFSDM_Filter_HandleTypeDef *hdf
   * @}
   */
 
+/** @defgroup DFSDM_MicArray_DataSize DFSDM microphone array data size
+  * @{
+  */
+#define DFSDM_MICARRAY_DATA_24BIT           0x00000000U /*!< 32-bit items, signed data on the 24 most significant bits */
+#define DFSDM_MICARRAY_DATA_16BIT           0x00000001U /*!< 16-bit items, signed 16 most significant bits of data */
+/**
+  * @}
+  */
+
 /**
   * @}
   */
@@ -712,6 +769,24 @@ uint32_t                      HAL_DFSDM_FilterGetError(const DFSDM_Filter_Handle
   * @}
   */
 
+/** @addtogroup DFSDM_Exported_Functions_Group1_MicArray Microphone array functions
+  * @{
+  */
+/* Microphone array functions *************************************************/
+HAL_StatusTypeDef HAL_DFSDM_MicArrayInit(DFSDM_MicArray_HandleTypeDef *hdfsdm_micarray);
+HAL_StatusTypeDef HAL_DFSDM_MicArrayDeInit(DFSDM_MicArray_HandleTypeDef *hdfsdm_micarray);
+HAL_StatusTypeDef HAL_DFSDM_MicArrayStart_DMA(DFSDM_MicArray_HandleTypeDef *hdfsdm_micarray, void *pBuffer,
+                                              uint32_t FrameCount);
+HAL_StatusTypeDef HAL_DFSDM_MicArrayStop_DMA(DFSDM_MicArray_HandleTypeDef *hdfsdm_micarray);
+HAL_StatusTypeDef HAL_DFSDM_MicArrayGetFrames(const DFSDM_MicArray_HandleTypeDef *hdfsdm_micarray,
+                                              uint32_t HalfIndex, void *pFrames);
+
+void HAL_DFSDM_MicArrayHalfCpltCallback(DFSDM_MicArray_HandleTypeDef *hdfsdm_micarray);
+void HAL_DFSDM_MicArrayCpltCallback(DFSDM_MicArray_HandleTypeDef *hdfsdm_micarray);
+/**
+  * @}
+  */
+
 /**
   * @}
   */
@@ -832,6 +907,11 @@ uint32_t                      HAL_DFSDM_FilterGetError(const DFSDM_Filter_Handle
 #define IS_DFSDM_INJECTED_CHANNEL(CHANNEL)            (((CHANNEL) != 0U) && ((CHANNEL) <= 0x000F00FFU))
 #define IS_DFSDM_CONTINUOUS_MODE(MODE)                (((MODE) == DFSDM_CONTINUOUS_CONV_OFF)  || \
                                                        ((MODE) == DFSDM_CONTINUOUS_CONV_ON))
+#define IS_DFSDM_MICARRAY_MIC_NUMBER(NUMBER)          ((1U <= (NUMBER)) && ((NUMBER) <= DFSDM_MICARRAY_MAX_MIC))
+#define IS_DFSDM_MICARRAY_DATA_SIZE(SIZE)             (((SIZE) == DFSDM_MICARRAY_DATA_24BIT) || \
+                                                       ((SIZE) == DFSDM_MICARRAY_DATA_16BIT))
+#define IS_DFSDM_MICARRAY_SERIAL_INTERFACE(MODE)      (((MODE) == DFSDM_CHANNEL_SPI_RISING) || \
+                                                       ((MODE) == DFSDM_CHANNEL_SPI_FALLING))
 #if defined(DFSDM2_Channel0)
 #define IS_DFSDM1_CHANNEL_INSTANCE(INSTANCE)          (((INSTANCE) == DFSDM1_Channel0) || \
                                                        ((INSTANCE) == DFSDM1_Channel1) || \
@@ -130,6 +130,40 @@ typedef enum
   HAL_DMA_XFER_ALL_CB_ID           = 0x06U     /*!< All               */
 }HAL_DMA_CallbackIDTypeDef;
 
+#if defined(USE_HAL_DMA_STATISTICS) && (USE_HAL_DMA_STATISTICS == 1U)
+/**
+  * @brief  DMA transfer statistics structure definition
+  * @note   Cycle values are DWT->CYCCNT samples: the application must enable the
+  *         cycle counter (TRCENA bit of CoreDebug->DEMCR, then CYCCNTENA bit of
+  *         DWT->CTRL) for the timing fields to be meaningful.
+  */
+typedef struct
+{
+  uint32_t XferCount;          /*!< Number of transfer complete events                        */
+
+  uint32_t XferBytes;          /*!< Number of bytes moved by the completed transfers          */
+
+  uint32_t XferLength;         /*!< Size in bytes of the transfer in progress                 */
+
+  uint32_t ErrorCount;         /*!< Number of transfer error events                           */
+
+  uint32_t ErrorFlags;         /*!< Accumulated @ref DMA_Error_Code values                     */
+
+  uint32_t BusyCount;          /*!< Number of start requests rejected while busy              */
+
+  uint32_t StartCycle;         /*!< Cycle counter at the start of the current transfer        */
+
+  uint32_t IrqEntryCycle;      /*!< Cycle counter at the entry of the last DMA interrupt      */
+
+  uint32_t CallbackExitCycle;  /*!< Cycle counter when the last DMA interrupt returned         */
+
+  uint32_t MaxXferCycles;      /*!< Longest start to transfer complete interrupt delay        */
+
+  uint32_t MaxIrqCycles;       /*!< Longest interrupt entry to callback exit delay            */
+
+} DMA_StatisticsTypeDef;
+#endif /* USE_HAL_DMA_STATISTICS */
+
 /**
   * @brief  DMA handle Structure definition
   */
@@ -176,6 +210,17 @@ typedef struct __DMA_HandleTypeDef
 
  uint32_t                         DMAmuxRequestGenStatusMask;                                       /*!< DMAMUX request generator Status mask          */
 
+#if defined(USE_HAL_DMA_STATISTICS) && (USE_HAL_DMA_STATISTICS == 1U)
+ DMA_StatisticsTypeDef            Statistics;                                                       /*!< DMA transfer statistics */
+#endif /* USE_HAL_DMA_STATISTICS */
+
+#if defined(USE_HAL_DMA_CACHE_MAINTENANCE) && (USE_HAL_DMA_CACHE_MAINTENANCE == 1U)
+ uint32_t                         CacheAddress;                                                     /*!< Memory written by the transfer in progress    */
+
+ uint32_t                         CacheSize;                                                        /*!< Size in bytes to invalidate at the end of the
+                                                                                                         transfer, 0 when nothing to invalidate       */
+#endif /* USE_HAL_DMA_CACHE_MAINTENANCE */
+
 }DMA_HandleTypeDef;
 
 /**
@@ -1196,6 +1241,7 @@ HAL_StatusTypeDef HAL_DMA_DeInit(DMA_HandleTypeDef *hdma);
   */
 HAL_StatusTypeDef HAL_DMA_Start (DMA_HandleTypeDef *hdma, uint32_t SrcAddress, uint32_t DstAddress, uint32_t DataLength);
 HAL_StatusTypeDef HAL_DMA_Start_IT(DMA_HandleTypeDef *hdma, uint32_t SrcAddress, uint32_t DstAddress, uint32_t DataLength);
+HAL_StatusTypeDef HAL_DMA_ReArm_IT(DMA_HandleTypeDef *hdma, uint32_t MemAddress, uint32_t DataLength);
 HAL_StatusTypeDef HAL_DMA_Abort(DMA_HandleTypeDef *hdma);
 HAL_StatusTypeDef HAL_DMA_Abort_IT(DMA_HandleTypeDef *hdma);
 HAL_StatusTypeDef HAL_DMA_PollForTransfer(DMA_HandleTypeDef *hdma, HAL_DMA_LevelCompleteTypeDef CompleteLevel, uint32_t Timeout);
@@ -1213,6 +1259,126 @@ HAL_StatusTypeDef HAL_DMA_UnRegisterCallback(DMA_HandleTypeDef *hdma, HAL_DMA_Ca
   */
 HAL_DMA_StateTypeDef HAL_DMA_GetState(DMA_HandleTypeDef *hdma);
 uint32_t             HAL_DMA_GetError(DMA_HandleTypeDef *hdma);
+#if defined(USE_HAL_DMA_STATISTICS) && (USE_HAL_DMA_STATISTICS == 1U)
+const DMA_StatisticsTypeDef *HAL_DMA_GetStatistics(const DMA_HandleTypeDef *hdma);
+void                        HAL_DMA_ResetStatistics(DMA_HandleTypeDef *hdma);
+#endif /* USE_HAL_DMA_STATISTICS */
+/**
+  * @}
+  */
+
+/** @defgroup DMA_Exported_Functions_Group4 Direct transfer functions
+  * @brief    Start, abort and counter functions with the same prototypes on
+  *           every family, reduced to the register writes of the controller. The
+  *           start and counter functions are inline.
+  * @{
+  */
+
+/**
+  * @brief  Starts the DMA transfer with the minimum register writes.
+  * @note   No parameter check, no lock and no handle state update are done: the
+  *         stream or channel must have been configured with HAL_DMA_Init() and its
+  *         previous transfer must be completed or aborted. A DMA stream disables
+  *         itself at the end of the transfer, a BDMA channel stays enabled and is
+  *         disabled here before CNDTR and CM0AR, read-only while enabled, are
+  *         written. The interrupt enables are left as already programmed.
+  * @note   The controller type (DMA stream or BDMA channel) is resolved with a
+  *         single compare of the instance address against the DMA1/DMA2 stream
+  *         address range.
+  * @param  hdma       pointer to a DMA_HandleTypeDef structure that contains
+  *                     the configuration information for the specified DMA Stream.
+  * @param  SrcAddress The source memory Buffer address
+  * @param  DstAddress The destination memory Buffer address
+  * @param  DataLength The length of data to be transferred from source to destination
+  * @retval None
+  */
+/* DMA1 and DMA2 streams share one contiguous address range, BDMA channels lie
+   outside of it. BDMA1 is the only controller without DMAMUX. */
+#define DMA_DIRECT_IS_STREAM(__INSTANCE__) \
+  ((((uint32_t)(__INSTANCE__)) >= DMA1_Stream0_BASE) && (((uint32_t)(__INSTANCE__)) <= DMA2_Stream7_BASE))
+#if defined(BDMA1)
+#define DMA_DIRECT_HAS_DMAMUX(__INSTANCE__) ((((uint32_t)(__INSTANCE__)) & 0xFFFFFC00UL) != BDMA1_BASE)
+#else
+#define DMA_DIRECT_HAS_DMAMUX(__INSTANCE__) (1U)
+#endif /* BDMA1 */
+
+__STATIC_INLINE void HAL_DMA_Direct_Start(DMA_HandleTypeDef *hdma, uint32_t SrcAddress, uint32_t DstAddress,
+                                          uint32_t DataLength)
+{
+  if (DMA_DIRECT_HAS_DMAMUX(hdma->Instance) != 0U)
+  {
+    /* Clear the DMAMUX synchro overrun flag */
+    hdma->DMAmuxChannelStatus->CFR = hdma->DMAmuxChannelStatusMask;
+  }
+
+  if (DMA_DIRECT_IS_STREAM(hdma->Instance) != 0U)
+  {
+    /* Clear all interrupt flags at correct offset within the LIFCR or HIFCR register */
+    ((__IO uint32_t *)hdma->StreamBaseAddress)[2U] = 0x3FUL << (hdma->StreamIndex & 0x1FU);
+
+    ((DMA_Stream_TypeDef *)hdma->Instance)->NDTR = DataLength;
+
+    /* Memory to Peripheral */
+    if (hdma->Init.Direction == DMA_MEMORY_TO_PERIPH)
+    {
+      ((DMA_Stream_TypeDef *)hdma->Instance)->PAR = DstAddress;
+      ((DMA_Stream_TypeDef *)hdma->Instance)->M0AR = SrcAddress;
+    }
+    /* Peripheral to Memory or Memory to Memory */
+    else
+    {
+      ((DMA_Stream_TypeDef *)hdma->Instance)->PAR = SrcAddress;
+      ((DMA_Stream_TypeDef *)hdma->Instance)->M0AR = DstAddress;
+    }
+
+    ((DMA_Stream_TypeDef *)hdma->Instance)->CR |= DMA_SxCR_EN;
+  }
+  else
+  {
+    /* Disable the channel, left enabled at the end of the previous transfer */
+    ((BDMA_Channel_TypeDef *)hdma->Instance)->CCR &= ~BDMA_CCR_EN;
+
+    /* Clear all flags within the BDMA IFCR register */
+    ((__IO uint32_t *)hdma->StreamBaseAddress)[1U] = BDMA_ISR_GIF0 << (hdma->StreamIndex & 0x1FU);
+
+    ((BDMA_Channel_TypeDef *)hdma->Instance)->CNDTR = DataLength;
+
+    /* Memory to Peripheral */
+    if (hdma->Init.Direction == DMA_MEMORY_TO_PERIPH)
+    {
+      ((BDMA_Channel_TypeDef *)hdma->Instance)->CPAR = DstAddress;
+      ((BDMA_Channel_TypeDef *)hdma->Instance)->CM0AR = SrcAddress;
+    }
+    /* Peripheral to Memory or Memory to Memory */
+    else
+    {
+      ((BDMA_Channel_TypeDef *)hdma->Instance)->CPAR = SrcAddress;
+      ((BDMA_Channel_TypeDef *)hdma->Instance)->CM0AR = DstAddress;
+    }
+
+    ((BDMA_Channel_TypeDef *)hdma->Instance)->CCR |= BDMA_CCR_EN;
+  }
+}
+
+HAL_StatusTypeDef HAL_DMA_Direct_Abort(DMA_HandleTypeDef *hdma);
+
+/**
+  * @brief  Returns the number of data units remaining in the current transfer.
+  * @param  hdma       pointer to a DMA_HandleTypeDef structure that contains
+  *                     the configuration information for the specified DMA Stream.
+  * @retval Number of remaining data units
+  */
+__STATIC_INLINE uint32_t HAL_DMA_Direct_GetCounter(const DMA_HandleTypeDef *hdma)
+{
+  if (DMA_DIRECT_IS_STREAM(hdma->Instance) != 0U)
+  {
+    return ((DMA_Stream_TypeDef *)hdma->Instance)->NDTR;
+  }
+  else
+  {
+    return ((BDMA_Channel_TypeDef *)hdma->Instance)->CNDTR;
+  }
+}
 /**
   * @}
   */
@@ -139,6 +139,91 @@ typedef enum
   HAL_DMA2D_STATE_SUSPEND           = 0x05U     /*!< DMA2D process is suspended                  */
 } HAL_DMA2D_StateTypeDef;
 
+/**
+  * @brief DMA2D queued command structure definition
+  */
+typedef struct
+{
+  uint32_t              Mode;              /*!< Transfer mode of the command.
+                                                This parameter can be one value of @ref DMA2D_Mode. */
+
+  uint32_t              OutputColorMode;   /*!< Color format of the output image.
+                                                This parameter can be one value of @ref DMA2D_Output_Color_Mode. */
+
+  uint32_t              OutputOffset;      /*!< Output line offset.
+                                                This parameter must be a number between
+                                                Min_Data = 0x0000 and Max_Data = 0x3FFF. */
+
+  uint32_t              DstAddress;        /*!< Destination memory buffer address. */
+
+  uint32_t              Width;             /*!< Width of the area in pixels per line. */
+
+  uint32_t              Height;            /*!< Height of the area in lines. */
+
+  uint32_t              Color;             /*!< Fill color in ARGB8888 format in DMA2D_R2M mode, or fixed
+                                                foreground (DMA2D_M2M_BLEND_FG) or background (DMA2D_M2M_BLEND_BG)
+                                                color. Unused by the other modes. */
+
+  uint32_t              FgAddress;         /*!< Foreground source memory buffer address. */
+
+  uint32_t              BgAddress;         /*!< Background source memory buffer address, blending modes only. */
+
+  DMA2D_LayerCfgTypeDef Foreground;        /*!< Foreground layer parameters, unused in DMA2D_R2M mode. */
+
+  DMA2D_LayerCfgTypeDef Background;        /*!< Background layer parameters, blending modes only. */
+
+} DMA2D_CommandTypeDef;
+
+/**
+  * @brief DMA2D command queue entry structure definition
+  * @note  Register images computed when the command is queued, so that the
+  *        transfer complete interrupt only writes the registers that differ.
+  */
+typedef struct
+{
+  uint32_t CR;                             /*!< CR mode and line offset mode fields  */
+  uint32_t OPFCCR;                         /*!< Output PFC control                   */
+  uint32_t OOR;                            /*!< Output offset                        */
+  uint32_t OCOLR;                          /*!< Output color                         */
+  uint32_t NLR;                            /*!< Number of lines and pixels per line  */
+  uint32_t OMAR;                           /*!< Output memory address                */
+  uint32_t FGMAR;                          /*!< Foreground memory address            */
+  uint32_t FGOR;                           /*!< Foreground offset                    */
+  uint32_t FGPFCCR;                        /*!< Foreground PFC control               */
+  uint32_t FGCOLR;                         /*!< Foreground color                     */
+  uint32_t BGMAR;                          /*!< Background memory address            */
+  uint32_t BGOR;                           /*!< Background offset                    */
+  uint32_t BGPFCCR;                        /*!< Background PFC control               */
+  uint32_t BGCOLR;                         /*!< Background color                     */
+  uint32_t Flags;                          /*!< Registers used by the command        */
+  uint32_t Fence;                          /*!< Fence signaled when the command ends */
+} DMA2D_QueueEntryTypeDef;
+
+/**
+  * @brief DMA2D command queue structure definition
+  */
+typedef struct
+{
+  DMA2D_QueueEntryTypeDef  *pEntries;      /*!< Array of entries provided by the application  */
+  uint32_t                 Size;           /*!< Number of entries of the array                */
+  uint32_t                 Head;           /*!< Entry of the command being executed           */
+  uint32_t                 Tail;           /*!< Entry of the next queued command              */
+  __IO uint32_t            Count;          /*!< Number of queued commands                     */
+  __IO uint32_t            Running;        /*!< Queue executing commands                      */
+  __IO uint32_t            SubmittedFence; /*!< Fence of the last queued command              */
+  __IO uint32_t            CompletedFence; /*!< Fence of the last completed command           */
+  uint32_t                 OPFCCR;         /*!< Last written register values ...              */
+  uint32_t                 OOR;
+  uint32_t                 OCOLR;
+  uint32_t                 NLR;
+  uint32_t                 FGOR;
+  uint32_t                 FGPFCCR;
+  uint32_t                 FGCOLR;
+  uint32_t                 BGOR;
+  uint32_t                 BGPFCCR;
+  uint32_t                 BGCOLR;         /*!< ... to skip the unchanged ones                */
+} DMA2D_QueueTypeDef;
+
 /**
   * @brief  DMA2D handle Structure definition
   */
@@ -161,8 +246,12 @@ typedef struct __DMA2D_HandleTypeDef
 
   void (* MspDeInitCallback)(struct __DMA2D_HandleTypeDef *hdma2d);       /*!< DMA2D Msp DeInit callback.             */
 
+  void (* QueueEmptyCallback)(struct __DMA2D_HandleTypeDef *hdma2d);      /*!< DMA2D command queue empty callback.    */
+
 #endif /* (USE_HAL_DMA2D_REGISTER_CALLBACKS) */
 
+  DMA2D_QueueTypeDef          *pQueue;                                    /*!< DMA2D command queue, NULL if none      */
+
   DMA2D_LayerCfgTypeDef       LayerCfg[MAX_DMA2D_LAYER];                  /*!< DMA2D Layers parameters                */
 
   HAL_LockTypeDef             Lock;                                       /*!< DMA2D lock.                            */
@@ -353,6 +442,7 @@ typedef enum
   HAL_DMA2D_TRANSFERERROR_CB_ID     = 0x03U,    /*!< DMA2D transfer error callback ID          */
   HAL_DMA2D_LINEEVENT_CB_ID         = 0x04U,    /*!< DMA2D line event callback ID              */
   HAL_DMA2D_CLUTLOADINGCPLT_CB_ID   = 0x05U,    /*!< DMA2D CLUT loading completion callback ID */
+  HAL_DMA2D_QUEUEEMPTY_CB_ID        = 0x06U,    /*!< DMA2D command queue empty callback ID     */
 } HAL_DMA2D_CallbackIDTypeDef;
 #endif /* USE_HAL_DMA2D_REGISTER_CALLBACKS */
 
@@ -468,6 +558,9 @@ typedef enum
   * @}
   */
 
+/* Include DMA2D HAL Extension module */
+#include "stm32h7xx_hal_dma2d_ex.h"
+
 /* Exported functions --------------------------------------------------------*/
 /** @addtogroup DMA2D_Exported_Functions DMA2D Exported Functions
   * @{
@@ -553,6 +646,26 @@ HAL_StatusTypeDef HAL_DMA2D_ConfigDeadTime(DMA2D_HandleTypeDef *hdma2d, uint8_t
 HAL_DMA2D_StateTypeDef HAL_DMA2D_GetState(DMA2D_HandleTypeDef *hdma2d);
 uint32_t               HAL_DMA2D_GetError(DMA2D_HandleTypeDef *hdma2d);
 
+/**
+  * @}
+  */
+
+/** @addtogroup DMA2D_Exported_Functions_Group5 Command queue functions
+  * @{
+  */
+
+/* Command queue functions ******************************************************/
+HAL_StatusTypeDef HAL_DMA2D_QueueInit(DMA2D_HandleTypeDef *hdma2d, DMA2D_QueueTypeDef *pQueue,
+                                      DMA2D_QueueEntryTypeDef *pEntries, uint32_t Size);
+HAL_StatusTypeDef HAL_DMA2D_QueueDeInit(DMA2D_HandleTypeDef *hdma2d);
+HAL_StatusTypeDef HAL_DMA2D_QueueCommand(DMA2D_HandleTypeDef *hdma2d, const DMA2D_CommandTypeDef *pCommand,
+                                         uint32_t *pFence);
+HAL_StatusTypeDef HAL_DMA2D_QueueFlush(DMA2D_HandleTypeDef *hdma2d);
+uint32_t          HAL_DMA2D_QueueGetFence(DMA2D_HandleTypeDef *hdma2d);
+uint32_t          HAL_DMA2D_QueueIsFenceDone(DMA2D_HandleTypeDef *hdma2d, uint32_t Fence);
+HAL_StatusTypeDef HAL_DMA2D_QueueWaitFence(DMA2D_HandleTypeDef *hdma2d, uint32_t Fence, uint32_t Timeout);
+void              HAL_DMA2D_QueueEmptyCallback(DMA2D_HandleTypeDef *hdma2d);
+
 /**
   * @}
   */
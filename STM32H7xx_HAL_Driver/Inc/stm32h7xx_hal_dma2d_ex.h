@@ -0,0 +1,127 @@
+/**
+  ******************************************************************************
+  * @file    stm32h7xx_hal_dma2d_ex.h
+  * @author  MCD Application Team
+  * @brief   Header file of DMA2D HAL extended module.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef STM32H7xx_HAL_DMA2D_EX_H
+#define STM32H7xx_HAL_DMA2D_EX_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32h7xx_hal_def.h"
+
+#if defined (DMA2D)
+
+/** @addtogroup STM32H7xx_HAL_Driver
+  * @{
+  */
+
+/** @addtogroup DMA2DEx
+  * @{
+  */
+
+/** @defgroup DMA2DEx_Min_Size DMA2DEx Minimum Size
+  * @brief    Size in bytes below which the memory helpers use the CPU, the DMA2D setup costing more than the
+  *           transfer itself. Can be redefined in stm32h7xx_hal_conf.h.
+  * @{
+  */
+#ifndef DMA2D_EX_MIN_SIZE
+#define DMA2D_EX_MIN_SIZE           256U
+#endif /* DMA2D_EX_MIN_SIZE */
+/**
+  * @}
+  */
+
+/* Exported types ------------------------------------------------------------*/
+/** @defgroup DMA2DEx_Exported_Types DMA2DEx Exported Types
+  * @{
+  */
+
+/**
+  * @brief  DMA2DEx memory benchmark structure definition
+  * @note   The cycles are measured with the DWT cycle counter, 0 for a skipped copy.
+  */
+typedef struct
+{
+  void                *pDst;            /*!< Destination buffer of Size bytes                          */
+
+  const void          *pSrc;            /*!< Source buffer of Size bytes                               */
+
+  uint32_t            Size;             /*!< Number of bytes copied and filled, at least
+                                             DMA2D_EX_MIN_SIZE                                         */
+
+#if defined(HAL_MDMA_MODULE_ENABLED)
+  MDMA_HandleTypeDef  *hmdma;           /*!< MDMA channel initialized for software triggered memory to
+                                             memory block transfers, NULL to skip the MDMA copy       */
+
+#endif /* HAL_MDMA_MODULE_ENABLED */
+  uint32_t            CpuCopyCycles;    /*!< Cycles of the CPU memcpy                                  */
+
+  uint32_t            Dma2dCopyCycles;  /*!< Cycles of HAL_DMA2DEx_Memcpy()                            */
+
+  uint32_t            MdmaCopyCycles;   /*!< Cycles of the MDMA block transfer, Size up to 65536 bytes */
+
+  uint32_t            CpuSetCycles;     /*!< Cycles of the CPU memset                                  */
+
+  uint32_t            Dma2dSetCycles;   /*!< Cycles of HAL_DMA2DEx_Memset()                            */
+} DMA2DEx_BenchmarkTypeDef;
+
+/**
+  * @}
+  */
+
+/* Exported functions --------------------------------------------------------*/
+/** @addtogroup DMA2DEx_Exported_Functions
+  * @{
+  */
+
+/** @addtogroup DMA2DEx_Exported_Functions_Group1
+  * @{
+  */
+/* Memory operation functions  ************************************************/
+HAL_StatusTypeDef HAL_DMA2DEx_Memset(DMA2D_HandleTypeDef *hdma2d, void *pDst, uint8_t Value, uint32_t Size,
+                                     uint32_t Timeout);
+HAL_StatusTypeDef HAL_DMA2DEx_Memcpy(DMA2D_HandleTypeDef *hdma2d, void *pDst, const void *pSrc, uint32_t Size,
+                                     uint32_t Timeout);
+HAL_StatusTypeDef HAL_DMA2DEx_Benchmark(DMA2D_HandleTypeDef *hdma2d, DMA2DEx_BenchmarkTypeDef *pBench,
+                                        uint32_t Timeout);
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#endif /* defined (DMA2D) */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STM32H7xx_HAL_DMA2D_EX_H */
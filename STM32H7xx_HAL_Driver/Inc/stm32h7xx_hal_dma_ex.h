@@ -91,6 +91,26 @@ typedef struct
 
 }HAL_DMA_MuxRequestGeneratorConfigTypeDef;
 
+/**
+  * @brief  DMA buffer region structure definition
+  * @note   The structure is owned by the application and linked in the driver
+  *         list of regions until HAL_DMAEx_BufferRegionDeInit().
+  */
+typedef struct __DMA_BufferRegionTypeDef
+{
+  uint32_t BaseAddress;                        /*!< Region start address, aligned on a D-cache line            */
+
+  uint32_t Size;                               /*!< Region size in bytes, a multiple of the D-cache line size  */
+
+  uint32_t Attribute;                          /*!< Cache attribute of the region.
+                                                    This parameter can be a value of @ref DMAEx_Buffer_Attribute */
+
+  uint32_t Used;                               /*!< Number of bytes already allocated                          */
+
+  struct __DMA_BufferRegionTypeDef *pNext;     /*!< Next region of the driver list                             */
+
+}DMA_BufferRegionTypeDef;
+
 /**
   * @}
   */
@@ -102,6 +122,24 @@ typedef struct
   * @{
   */
 
+/** @defgroup DMAEx_Buffer_Attribute DMAEx Buffer Attribute
+  * @brief    Cache attribute of a DMA buffer region
+  * @{
+  */
+#define DMA_BUFFER_CACHED             0x00000000U   /*!< Cacheable memory: the D-cache is maintained around each transfer */
+#define DMA_BUFFER_NONCACHEABLE       0x00000001U   /*!< Memory made non-cacheable by the MPU: no cache maintenance       */
+/**
+  * @}
+  */
+
+/** @defgroup DMAEx_Cache_Line DMAEx Cache Line
+  * @{
+  */
+#define DMA_CACHE_LINE_SIZE           32U           /*!< Cortex-M7 D-cache line size (in bytes) */
+/**
+  * @}
+  */
+
 /** @defgroup DMAEx_MUX_SyncSignalID_selection DMAEx MUX SyncSignalID selection
   * @brief    DMAEx MUX SyncSignalID selection
   * @{
@@ -243,6 +281,26 @@ HAL_StatusTypeDef HAL_DMAEx_EnableMuxRequestGenerator (DMA_HandleTypeDef *hdma);
 HAL_StatusTypeDef HAL_DMAEx_DisableMuxRequestGenerator (DMA_HandleTypeDef *hdma);
 
 void HAL_DMAEx_MUX_IRQHandler(DMA_HandleTypeDef *hdma);
+/**
+  * @}
+  */
+
+/** @defgroup DMAEx_Exported_Functions_Group2 DMA buffer and D-cache functions
+  * @brief   DMA buffer and D-cache functions
+  * @{
+  */
+HAL_StatusTypeDef HAL_DMAEx_BufferRegionInit(DMA_BufferRegionTypeDef *pRegion, uint32_t BaseAddress, uint32_t Size,
+                                             uint32_t Attribute);
+HAL_StatusTypeDef HAL_DMAEx_BufferRegionDeInit(DMA_BufferRegionTypeDef *pRegion);
+void              *HAL_DMAEx_BufferAlloc(DMA_BufferRegionTypeDef *pRegion, uint32_t Size);
+void              HAL_DMAEx_BufferRegionReset(DMA_BufferRegionTypeDef *pRegion);
+#if (__MPU_PRESENT == 1)
+void              HAL_DMAEx_ConfigNonCacheableRegion(uint32_t BaseAddress, uint8_t Size, uint8_t Number);
+#endif /* __MPU_PRESENT */
+uint32_t          HAL_DMAEx_IsBufferCached(uint32_t Address, uint32_t Size);
+void              HAL_DMAEx_CleanBuffer(uint32_t Address, uint32_t Size);
+void              HAL_DMAEx_InvalidateBuffer(uint32_t Address, uint32_t Size);
+void              HAL_DMAEx_CleanInvalidateBuffer(uint32_t Address, uint32_t Size);
 /**
   * @}
   */
@@ -259,6 +317,9 @@ void HAL_DMAEx_MUX_IRQHandler(DMA_HandleTypeDef *hdma);
 #define IS_DMA_DMAMUX_SYNC_SIGNAL_ID(SIGNAL_ID) ((SIGNAL_ID) <= HAL_DMAMUX1_SYNC_TIM12_TRGO)
 #define IS_BDMA_DMAMUX_SYNC_SIGNAL_ID(SIGNAL_ID) ((SIGNAL_ID) <= HAL_DMAMUX2_SYNC_EXTI2)
 
+#define IS_DMA_BUFFER_ATTRIBUTE(ATTRIBUTE) (((ATTRIBUTE) == DMA_BUFFER_CACHED) || \
+                                            ((ATTRIBUTE) == DMA_BUFFER_NONCACHEABLE))
+
 #define IS_DMAMUX_SYNC_REQUEST_NUMBER(REQUEST_NUMBER) (((REQUEST_NUMBER) > 0U) && ((REQUEST_NUMBER) <= 32U))
 
 #define IS_DMAMUX_SYNC_POLARITY(POLARITY) (((POLARITY) == HAL_DMAMUX_SYNC_NO_EVENT)    || \
@@ -287,6 +287,26 @@ typedef struct
 
 } DSI_HOST_TimeoutTypeDef;
 
+/**
+  * @brief  DSI command mode refresh region definition
+  */
+typedef struct
+{
+  uint32_t X;                            /*!< First column of the region, in pixels.
+                                              This parameter can be any value between 0x0000 and 0xFFFFU    */
+
+  uint32_t Y;                            /*!< First page (line) of the region, in pixels.
+                                              This parameter can be any value between 0x0000 and 0xFFFFU    */
+
+  uint32_t Width;                        /*!< Width of the region, in pixels. It is also used as the
+                                              maximum size of the LTDC write memory commands.
+                                              This parameter can be any value between 0x0001 and 0xFFFFU    */
+
+  uint32_t Height;                       /*!< Height of the region, in pixels.
+                                              This parameter can be any value between 0x0001 and 0xFFFFU    */
+
+} DSI_RegionTypeDef;
+
 /**
   * @brief  DSI States Structure definition
   */
@@ -314,6 +334,7 @@ typedef struct
   __IO HAL_DSI_StateTypeDef State;        /*!< DSI communication state    */
   __IO uint32_t             ErrorCode;    /*!< DSI Error code             */
   uint32_t                  ErrorMsk;     /*!< DSI Error monitoring mask  */
+  __IO uint32_t             RefreshRequest; /*!< Refresh started on the next Tearing Effect */
 
 #if (USE_HAL_DSI_REGISTER_CALLBACKS == 1)
   void (* TearingEffectCallback)(struct __DSI_HandleTypeDef *hdsi);   /*!< DSI Tearing Effect Callback */
@@ -1172,6 +1193,11 @@ HAL_StatusTypeDef HAL_DSI_ConfigHostTimeouts(DSI_HandleTypeDef *hdsi, DSI_HOST_T
 HAL_StatusTypeDef HAL_DSI_Start(DSI_HandleTypeDef *hdsi);
 HAL_StatusTypeDef HAL_DSI_Stop(DSI_HandleTypeDef *hdsi);
 HAL_StatusTypeDef HAL_DSI_Refresh(DSI_HandleTypeDef *hdsi);
+HAL_StatusTypeDef HAL_DSI_SetRefreshRegion(DSI_HandleTypeDef *hdsi, uint32_t ChannelID,
+                                           const DSI_RegionTypeDef *Region);
+HAL_StatusTypeDef HAL_DSI_RefreshRegion(DSI_HandleTypeDef *hdsi, uint32_t ChannelID,
+                                        const DSI_RegionTypeDef *Region);
+HAL_StatusTypeDef HAL_DSI_AbortRefreshRegion(DSI_HandleTypeDef *hdsi);
 HAL_StatusTypeDef HAL_DSI_ColorMode(DSI_HandleTypeDef *hdsi, uint32_t ColorMode);
 HAL_StatusTypeDef HAL_DSI_Shutdown(DSI_HandleTypeDef *hdsi, uint32_t Shutdown);
 HAL_StatusTypeDef HAL_DSI_ShortWrite(DSI_HandleTypeDef *hdsi,
@@ -1293,6 +1319,8 @@ HAL_DSI_StateTypeDef HAL_DSI_GetState(DSI_HandleTypeDef *hdsi);
                                                      || ((LPVSYNC) == DSI_LP_VSYNC_ENABLE))
 #define IS_DSI_FBTAA(FrameBTAAcknowledge)           (((FrameBTAAcknowledge) == DSI_FBTAA_DISABLE)\
                                                      || ((FrameBTAAcknowledge) == DSI_FBTAA_ENABLE))
+#define IS_DSI_REGION(X, SIZE)                      (((SIZE) != 0U) && ((SIZE) <= 0x10000U) && \
+                                                     ((X) <= (0x10000U - (SIZE))))
 #define IS_DSI_TE_SOURCE(TESource)                  (((TESource) == DSI_TE_DSILINK) || ((TESource) == DSI_TE_EXTERNAL))
 #define IS_DSI_TE_POLARITY(TEPolarity)              (((TEPolarity) == DSI_TE_RISING_EDGE)\
                                                      || ((TEPolarity) == DSI_TE_FALLING_EDGE))
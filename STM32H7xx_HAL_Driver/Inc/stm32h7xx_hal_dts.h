@@ -127,6 +127,49 @@ typedef enum
 typedef void (*pDTS_CallbackTypeDef)(DTS_HandleTypeDef *hdts);
 #endif /* USE_HAL_DTS_REGISTER_CALLBACKS */
 
+#if defined(HAL_PWR_MODULE_ENABLED)
+/**
+  * @brief  DTS governor operating point structure definition
+  */
+typedef struct
+{
+  RCC_ClkInitTypeDef ClkInit;       /*!< Clock configuration of the operating point, applied with
+                                         HAL_PWREx_SwitchOperatingPoint()                              */
+
+  uint32_t          FLatency;       /*!< FLASH latency of the operating point                          */
+
+  uint32_t          CpuFrequency;   /*!< CPU clock (rcc_c_ck) frequency in Hz of ClkInit               */
+
+  uint32_t          AhbFrequency;   /*!< AHB clock (rcc_hclk3) frequency in Hz of ClkInit              */
+
+  int32_t           MaxTemperature; /*!< Temperature in deg C from which the next, slower, operating
+                                         point is used                                                 */
+} DTS_OperatingPointTypeDef;
+
+/**
+  * @brief  DTS governor structure definition
+  */
+typedef struct
+{
+  DTS_HandleTypeDef               *hdts;        /*!< DTS handle, initialized and started with HAL_DTS_Start_IT() */
+
+  const DTS_OperatingPointTypeDef *pPoints;     /*!< Operating points, from the fastest to the slowest         */
+
+  uint32_t                        NbPoints;     /*!< Number of operating points of pPoints                      */
+
+  int32_t                         Hysteresis;   /*!< Temperature drop in deg C below the MaxTemperature of the
+                                                     faster operating point before it is used again            */
+
+  __IO uint32_t                   Point;        /*!< Index in pPoints of the applied operating point, to be set
+                                                     to the operating point in use before
+                                                     HAL_DTS_Governor_Start()                                 */
+
+  __IO uint32_t                   Pending;      /*!< Threshold crossed, operating point to be updated          */
+
+  int32_t                         Temperature;  /*!< Temperature in deg C of the last update                   */
+} DTS_GovernorTypeDef;
+#endif /* HAL_PWR_MODULE_ENABLED */
+
 /**
   * @}
   */
@@ -420,6 +463,7 @@ HAL_StatusTypeDef HAL_DTS_UnRegisterCallback(DTS_HandleTypeDef        *hdts,
 HAL_StatusTypeDef HAL_DTS_Start(DTS_HandleTypeDef *hdts);
 HAL_StatusTypeDef HAL_DTS_Stop(DTS_HandleTypeDef *hdts);
 HAL_StatusTypeDef HAL_DTS_GetTemperature(DTS_HandleTypeDef *hdts, int32_t *Temperature);
+HAL_StatusTypeDef HAL_DTS_ConfigThresholds(DTS_HandleTypeDef *hdts, int32_t LowTemperature, int32_t HighTemperature);
 HAL_StatusTypeDef HAL_DTS_Start_IT(DTS_HandleTypeDef *hdts);
 HAL_StatusTypeDef HAL_DTS_Stop_IT(DTS_HandleTypeDef *hdts);
 void              HAL_DTS_IRQHandler(DTS_HandleTypeDef *hdts);
@@ -434,6 +478,20 @@ void              HAL_DTS_AsyncHighCallback(DTS_HandleTypeDef *hdts);
 /**
   * @}
   */
+
+#if defined(HAL_PWR_MODULE_ENABLED)
+/* Thermal governor functions  *************************************************/
+/** @addtogroup DTS_Exported_Functions_Group4
+  * @{
+  */
+HAL_StatusTypeDef HAL_DTS_Governor_Start(DTS_GovernorTypeDef *hgov);
+void              HAL_DTS_Governor_ThresholdHandler(DTS_GovernorTypeDef *hgov);
+HAL_StatusTypeDef HAL_DTS_Governor_Process(DTS_GovernorTypeDef *hgov);
+void              HAL_DTS_GovernorCallback(DTS_GovernorTypeDef *hgov);
+/**
+  * @}
+  */
+#endif /* HAL_PWR_MODULE_ENABLED */
 /**
   * @}
   */
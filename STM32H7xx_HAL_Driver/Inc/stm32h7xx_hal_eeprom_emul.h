@@ -0,0 +1,202 @@
+/**
+  ******************************************************************************
+  * @file    stm32h7xx_hal_eeprom_emul.h
+  * @author  MCD Application Team
+  * @brief   Header file of EEPROM emulation HAL module.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file in
+  * the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef STM32H7xx_HAL_EEPROM_EMUL_H
+#define STM32H7xx_HAL_EEPROM_EMUL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32h7xx_hal_def.h"
+
+/** @addtogroup STM32H7xx_HAL_Driver
+  * @{
+  */
+
+/** @addtogroup EEPROM_EMUL
+  * @{
+  */
+
+/* Exported types ------------------------------------------------------------*/
+/** @defgroup EEPROM_EMUL_Exported_Types EEPROM Emulation Exported Types
+  * @{
+  */
+
+/**
+  * @brief  HAL EEPROM emulation State structure definition
+  */
+typedef enum
+{
+  HAL_EEPROM_EMUL_STATE_RESET = 0x00U,    /*!< EEPROM emulation not yet initialized          */
+  HAL_EEPROM_EMUL_STATE_READY = 0x01U,    /*!< EEPROM emulation initialized and ready for use */
+  HAL_EEPROM_EMUL_STATE_BUSY  = 0x02U,    /*!< EEPROM emulation write or transfer ongoing     */
+  HAL_EEPROM_EMUL_STATE_ERROR = 0x03U     /*!< EEPROM emulation unusable, a FLASH operation failed */
+} HAL_EEPROM_EMUL_StateTypeDef;
+
+/**
+  * @brief  EEPROM emulation Init structure definition
+  */
+typedef struct
+{
+  uint32_t Bank;          /*!< FLASH bank holding the emulation pages.
+                               This parameter can be a value of @ref FLASH_Banks */
+
+  uint32_t StartPage;     /*!< First FLASH sector of the emulation area, within the bank. An emulation
+                               page is one FLASH sector */
+
+  uint32_t NbPages;       /*!< Number of FLASH sectors used in rotation, at least 2. Two sectors are in
+                               use at a time, the others spread the wear */
+
+  uint32_t PageSize;      /*!< FLASH sector size in bytes: FLASH_SECTOR_SIZE */
+
+  uint32_t NbVariables;   /*!< Number of variables, identified by virtual addresses 0 to NbVariables - 1.
+                               A page must be able to hold one element per variable */
+
+  uint32_t *pIndex;       /*!< RAM index of NbVariables words provided by the application, holding the
+                               FLASH address of the last element of each variable */
+} EEPROM_EMUL_InitTypeDef;
+
+/**
+  * @brief  EEPROM emulation handle Structure definition
+  */
+typedef struct
+{
+  EEPROM_EMUL_InitTypeDef             Init;         /*!< EEPROM emulation configuration parameters        */
+
+  uint32_t                            ActivePage;   /*!< Index of the active page in the rotation         */
+
+  uint32_t                            Generation;   /*!< Generation number of the active page             */
+
+  uint32_t                            FreeAddress;  /*!< Address of the next free element of the active page */
+
+  HAL_LockTypeDef                     Lock;         /*!< Locking object                                   */
+
+  __IO HAL_EEPROM_EMUL_StateTypeDef   State;        /*!< EEPROM emulation state                           */
+
+  __IO uint32_t                       ErrorCode;    /*!< EEPROM emulation error code                      */
+} EEPROM_EMUL_HandleTypeDef;
+
+/**
+  * @}
+  */
+
+/* Exported constants --------------------------------------------------------*/
+/** @defgroup EEPROM_EMUL_Exported_Constants EEPROM Emulation Exported Constants
+  * @{
+  */
+
+/** @defgroup EEPROM_EMUL_Error_Code EEPROM Emulation Error Code
+  * @{
+  */
+#define HAL_EEPROM_EMUL_ERROR_NONE      0x00000000U   /*!< No error                                    */
+#define HAL_EEPROM_EMUL_ERROR_PARAM     0x00000001U   /*!< Invalid parameter or configuration          */
+#define HAL_EEPROM_EMUL_ERROR_FLASH     0x00000002U   /*!< FLASH program or erase operation failed     */
+#define HAL_EEPROM_EMUL_ERROR_NO_DATA   0x00000004U   /*!< The variable has never been written         */
+/**
+  * @}
+  */
+
+/** @defgroup EEPROM_EMUL_Element EEPROM Emulation Element
+  * @brief    An element is one FLASH word, 256 bits or 128 bits on STM32H7A3xx/B3xx/B0xx:
+  *           data on bits 0 to 31, virtual address on bits 32 to 47, CRC-16 of both on
+  *           bits 48 to 63 and the remaining bits programmed to 0.
+  * @{
+  */
+#define EEPROM_EMUL_ELEMENT_SIZE        (FLASH_NB_32BITWORD_IN_FLASHWORD * 4U) /*!< Size of an element: the
+                                                                                 FLASH programming width */
+#define EEPROM_EMUL_HEADER_SIZE         (4U * EEPROM_EMUL_ELEMENT_SIZE) /*!< Size of the page header */
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/* Exported macro ------------------------------------------------------------*/
+/** @defgroup EEPROM_EMUL_Exported_Macros EEPROM Emulation Exported Macros
+  * @{
+  */
+
+/** @brief  Reset EEPROM emulation handle state.
+  * @param  __HANDLE__ EEPROM emulation handle.
+  * @retval None
+  */
+#define __HAL_EEPROM_EMUL_RESET_HANDLE_STATE(__HANDLE__) ((__HANDLE__)->State = HAL_EEPROM_EMUL_STATE_RESET)
+
+/**
+  * @}
+  */
+
+/* Exported functions --------------------------------------------------------*/
+/** @addtogroup EEPROM_EMUL_Exported_Functions
+  * @{
+  */
+
+/** @addtogroup EEPROM_EMUL_Exported_Functions_Group1
+  * @{
+  */
+/* Initialization and de-initialization functions  ****************************/
+HAL_StatusTypeDef HAL_EEPROM_EMUL_Init(EEPROM_EMUL_HandleTypeDef *heeprom);
+HAL_StatusTypeDef HAL_EEPROM_EMUL_DeInit(EEPROM_EMUL_HandleTypeDef *heeprom);
+HAL_StatusTypeDef HAL_EEPROM_EMUL_Format(EEPROM_EMUL_HandleTypeDef *heeprom);
+/**
+  * @}
+  */
+
+/** @addtogroup EEPROM_EMUL_Exported_Functions_Group2
+  * @{
+  */
+/* IO operation functions  ****************************************************/
+HAL_StatusTypeDef HAL_EEPROM_EMUL_Read(EEPROM_EMUL_HandleTypeDef *heeprom, uint32_t VirtAddress, uint32_t *pData);
+HAL_StatusTypeDef HAL_EEPROM_EMUL_Write(EEPROM_EMUL_HandleTypeDef *heeprom, uint32_t VirtAddress, uint32_t Data);
+/**
+  * @}
+  */
+
+/** @addtogroup EEPROM_EMUL_Exported_Functions_Group3
+  * @{
+  */
+/* Peripheral State and Error functions  **************************************/
+HAL_EEPROM_EMUL_StateTypeDef HAL_EEPROM_EMUL_GetState(EEPROM_EMUL_HandleTypeDef *heeprom);
+uint32_t                     HAL_EEPROM_EMUL_GetError(EEPROM_EMUL_HandleTypeDef *heeprom);
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STM32H7xx_HAL_EEPROM_EMUL_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
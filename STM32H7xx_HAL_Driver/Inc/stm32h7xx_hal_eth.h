@@ -165,6 +165,52 @@ typedef struct
   *
   */
 
+/**
+  * @brief  ETH Tx priority queue structure definition
+  */
+typedef struct
+{
+  ETH_TxPacketConfig **pPackets;   /*!< Array of Size pending packets configuration, provided by the application */
+
+  uint32_t Size;                   /*!< Size of the pPackets array, Size - 1 packets can be pending */
+
+  uint32_t Weight;                 /*!< Number of packets sent per round in weighted round-robin mode */
+
+  uint32_t Head;                   /*!< Index of the next packet to queue (internal) */
+
+  uint32_t Tail;                   /*!< Index of the next packet to send (internal) */
+
+  uint32_t Credit;                 /*!< Packets left to send in the current round (internal) */
+
+} ETH_TxPrioQueueTypeDef;
+/**
+  *
+  */
+
+/**
+  * @brief  ETH MDIO command structure definition
+  */
+typedef struct __ETH_MDIOCmdTypeDef
+{
+  uint32_t PHYAddr;                /*!< PHY port address, must be a value from 0 to 31 */
+
+  uint32_t PHYReg;                 /*!< PHY register address, must be a value from 0 to 31 */
+
+  uint32_t Operation;              /*!< Specifies the MDIO operation.
+                                        This parameter can be a value of @ref ETH_MDIO_Operation */
+
+  uint32_t Value;                  /*!< Value to write, or value read once the command is done */
+
+  __IO uint32_t Status;            /*!< Command status.
+                                        This parameter can be a value of @ref ETH_MDIO_Command_Status */
+
+  struct __ETH_MDIOCmdTypeDef *pNext; /*!< Next queued command (internal) */
+
+} ETH_MDIOCmdTypeDef;
+/**
+  *
+  */
+
 /**
   * @brief  ETH Timestamp structure definition
   */
@@ -187,6 +233,53 @@ typedef struct
   uint32_t Seconds;
   uint32_t NanoSeconds;
 } ETH_TimeTypeDef;
+/**
+  *
+  */
+
+/**
+  * @brief  ETH PTP timestamp ring entry structure definition
+  */
+typedef struct
+{
+  uint32_t                    *pCookie;      /*!< Packet cookie: Tx packet address (ETH_TxPacketConfig pData)
+                                                  or Rx packet returned by HAL_ETH_ReadData() */
+  uint32_t                    Direction;     /*!< Timestamped packet direction.
+                                                  This parameter can be a value of @ref ETH_PTP_Timestamp_Direction */
+  ETH_TimeStampTypeDef        TimeStamp;     /*!< Packet timestamp */
+} ETH_PtpTimestampEntryTypeDef;
+/**
+  *
+  */
+
+/**
+  * @brief  ETH PTP timestamp ring structure definition
+  */
+typedef struct
+{
+  ETH_PtpTimestampEntryTypeDef *pEntries;    /*!< Application array of Size entries */
+  uint32_t                    Size;          /*!< Number of entries, must be a power of 2 */
+  __IO uint32_t               Head;          /*!< Free running write index, only updated by the driver */
+  __IO uint32_t               Tail;          /*!< Free running read index, only updated by the application */
+  __IO uint32_t               Overflow;      /*!< Number of timestamps dropped because the ring was full */
+} ETH_PtpTimestampRingTypeDef;
+/**
+  *
+  */
+
+/**
+  * @brief  ETH PTP clock servo structure definition
+  */
+typedef struct
+{
+  uint32_t                    Addend;        /*!< Timestamp addend of the nominal frequency (ETH_PTP_ConfigTypeDef) */
+  int32_t                     Kp;            /*!< Proportional gain, in 1/65536 ppb per ns of offset */
+  int32_t                     Ki;            /*!< Integral gain, in 1/65536 ppb per ns of offset */
+  int32_t                     MaxFreqPpb;    /*!< Frequency correction limit in ppb */
+  uint32_t                    StepThreshold; /*!< Offset in ns from which the time is stepped instead of slewed */
+  int64_t                     Integral;      /*!< Integral term, in 1/65536 ppb (internal, reset to 0 to start) */
+  int32_t                     FreqPpb;       /*!< Frequency correction applied by the last update, in ppb */
+} ETH_PtpServoTypeDef;
 /**
   *
   */
@@ -202,6 +295,11 @@ typedef struct
   uint32_t ItMode;                      /*<! If 1, DMA will generate the Rx complete interrupt.
                                              If 0, DMA will not generate the Rx complete interrupt. */
 
+  uint32_t RxIntWatchdog;               /*<! Rx interrupt watchdog count. If not 0, the Rx complete interrupt
+                                             is generated by the watchdog instead of each descriptor. */
+
+  uint32_t RxLastVlanTag;               /*<! Outer VLAN tag stripped from the last received packet. */
+
   uint32_t RxDescIdx;                 /*<! Current Rx descriptor. */
 
   uint32_t RxDescCnt;                 /*<! Number of descriptors . */
@@ -536,6 +634,10 @@ typedef struct
 
 #ifdef HAL_ETH_USE_PTP
   ETH_TimeStampTypeDef       TxTimestamp;               /*!< Tx Timestamp */
+
+  ETH_PtpTimestampRingTypeDef *pPtpTsRing;             /*!< Tx and Rx timestamps ring, NULL when not used */
+
+  uint32_t                   *pPtpRxCookie;             /*!< Rx packet waiting for its timestamp context descriptor */
 #endif /* HAL_ETH_USE_PTP */
 
   __IO HAL_ETH_StateTypeDef  gState;                   /*!< ETH state information related to global Handle management
@@ -566,6 +668,37 @@ typedef struct
                                                              This parameter can be a value of
                                                              @ref ETH_PTP_Config_Status */
 
+  __IO uint32_t              RxPollMode;                /*!< If 1, the Rx interrupt is masked in HAL_ETH_IRQHandler()
+                                                             until HAL_ETH_RxPollComplete() is called. */
+
+  ETH_TxPrioQueueTypeDef     *pTxPrioQueues;            /*!< Tx priority queues, queue 0 is the highest priority.
+                                                             NULL when not used */
+
+  uint32_t                   TxPrioQueueCnt;            /*!< Number of Tx priority queues */
+
+  uint32_t                   TxSchedMode;               /*!< Tx priority queues scheduling mode.
+                                                             This parameter can be a value of
+                                                             @ref ETH_Tx_Scheduling_Mode */
+
+  uint32_t                   TxSchedQueueIdx;           /*!< Tx priority queue served in weighted round-robin mode */
+
+  ETH_MDIOCmdTypeDef         *pMDIOHead;                /*!< MDIO command in progress, NULL when no command is queued */
+
+  ETH_MDIOCmdTypeDef         *pMDIOTail;                /*!< Last queued MDIO command */
+
+  uint32_t                   MDIOStarted;               /*!< If 1, the command in progress has been issued on the bus */
+
+  uint32_t                   MDIOTickstart;             /*!< Tick at which the command in progress was issued */
+
+  ETH_MDIOCmdTypeDef         LinkPollCmd;               /*!< PHY basic status register read of the link poller */
+
+  uint32_t                   LinkPollInterval;          /*!< Link poll interval in ms, 0 when the poller is stopped */
+
+  uint32_t                   LinkPollTick;              /*!< Tick of the last link poll */
+
+  uint32_t                   LinkState;                 /*!< Last reported link state.
+                                                             This parameter can be a value of @ref ETH_Link_State */
+
 #if (USE_HAL_ETH_REGISTER_CALLBACKS == 1)
 
   void (* TxCpltCallback)(struct __ETH_HandleTypeDef *heth);             /*!< ETH Tx Complete Callback */
@@ -1492,6 +1625,53 @@ typedef struct
   */
 #define HAL_ETH_PTP_NOT_CONFIGURATED       0x00000000U    /*!< ETH PTP Configuration not done */
 #define HAL_ETH_PTP_CONFIGURATED           0x00000001U    /*!< ETH PTP Configuration done     */
+/**
+  * @}
+  */
+
+/** @defgroup ETH_PTP_Timestamp_Direction ETH PTP Timestamp Direction
+  * @{
+  */
+#define ETH_PTP_TIMESTAMP_TX               0x00000000U    /*!< Timestamp of a transmitted packet */
+#define ETH_PTP_TIMESTAMP_RX               0x00000001U    /*!< Timestamp of a received packet    */
+/**
+  * @}
+  */
+
+/** @defgroup ETH_Tx_Scheduling_Mode ETH Tx Scheduling Mode
+  * @{
+  */
+#define ETH_TX_SCHED_STRICT_PRIORITY       0x00000000U    /*!< Highest priority non empty queue first  */
+#define ETH_TX_SCHED_WEIGHTED_RR           0x00000001U    /*!< Weighted round-robin between the queues */
+/**
+  * @}
+  */
+
+/** @defgroup ETH_MDIO_Operation ETH MDIO Operation
+  * @{
+  */
+#define ETH_MDIO_OP_READ                   0x00000000U    /*!< Read the PHY register  */
+#define ETH_MDIO_OP_WRITE                  0x00000001U    /*!< Write the PHY register */
+/**
+  * @}
+  */
+
+/** @defgroup ETH_MDIO_Command_Status ETH MDIO Command Status
+  * @{
+  */
+#define ETH_MDIO_CMD_DONE                  0x00000000U    /*!< Command completed              */
+#define ETH_MDIO_CMD_PENDING               0x00000001U    /*!< Command queued or in progress  */
+#define ETH_MDIO_CMD_ERROR                 0x00000002U    /*!< Command timed out on the bus   */
+/**
+  * @}
+  */
+
+/** @defgroup ETH_Link_State ETH Link State
+  * @{
+  */
+#define ETH_LINK_STATE_DOWN                0x00000000U    /*!< PHY link is down          */
+#define ETH_LINK_STATE_UP                  0x00000001U    /*!< PHY link is up            */
+#define ETH_LINK_STATE_UNKNOWN             0x00000002U    /*!< PHY link not polled yet   */
 /**
   * @}
   */
@@ -1742,12 +1922,16 @@ HAL_StatusTypeDef HAL_ETH_Stop(ETH_HandleTypeDef *heth);
 HAL_StatusTypeDef HAL_ETH_Stop_IT(ETH_HandleTypeDef *heth);
 
 HAL_StatusTypeDef HAL_ETH_ReadData(ETH_HandleTypeDef *heth, void **pAppBuff);
+HAL_StatusTypeDef HAL_ETH_EnableRxPolling(ETH_HandleTypeDef *heth);
+HAL_StatusTypeDef HAL_ETH_DisableRxPolling(ETH_HandleTypeDef *heth);
+HAL_StatusTypeDef HAL_ETH_RxPollComplete(ETH_HandleTypeDef *heth);
 HAL_StatusTypeDef HAL_ETH_RegisterRxAllocateCallback(ETH_HandleTypeDef *heth,
                                                      pETH_rxAllocateCallbackTypeDef rxAllocateCallback);
 HAL_StatusTypeDef HAL_ETH_UnRegisterRxAllocateCallback(ETH_HandleTypeDef *heth);
 HAL_StatusTypeDef HAL_ETH_RegisterRxLinkCallback(ETH_HandleTypeDef *heth, pETH_rxLinkCallbackTypeDef rxLinkCallback);
 HAL_StatusTypeDef HAL_ETH_UnRegisterRxLinkCallback(ETH_HandleTypeDef *heth);
 HAL_StatusTypeDef HAL_ETH_GetRxDataErrorCode(ETH_HandleTypeDef *heth, uint32_t *pErrorCode);
+HAL_StatusTypeDef HAL_ETH_GetRxDataVLANTag(ETH_HandleTypeDef *heth, uint32_t *pVlanTag);
 HAL_StatusTypeDef HAL_ETH_RegisterTxFreeCallback(ETH_HandleTypeDef *heth, pETH_txFreeCallbackTypeDef txFreeCallback);
 HAL_StatusTypeDef HAL_ETH_UnRegisterTxFreeCallback(ETH_HandleTypeDef *heth);
 HAL_StatusTypeDef HAL_ETH_ReleaseTxPacket(ETH_HandleTypeDef *heth);
@@ -1764,15 +1948,33 @@ HAL_StatusTypeDef HAL_ETH_PTP_GetTxTimestamp(ETH_HandleTypeDef *heth, ETH_TimeSt
 HAL_StatusTypeDef HAL_ETH_PTP_GetRxTimestamp(ETH_HandleTypeDef *heth, ETH_TimeStampTypeDef *timestamp);
 HAL_StatusTypeDef HAL_ETH_RegisterTxPtpCallback(ETH_HandleTypeDef *heth, pETH_txPtpCallbackTypeDef txPtpCallback);
 HAL_StatusTypeDef HAL_ETH_UnRegisterTxPtpCallback(ETH_HandleTypeDef *heth);
+HAL_StatusTypeDef HAL_ETH_PTP_SetTimestampRing(ETH_HandleTypeDef *heth, ETH_PtpTimestampRingTypeDef *pRing,
+                                               ETH_PtpTimestampEntryTypeDef *pEntries, uint32_t Size);
+HAL_StatusTypeDef HAL_ETH_PTP_GetRingTimestamp(ETH_PtpTimestampRingTypeDef *pRing,
+                                               ETH_PtpTimestampEntryTypeDef *pEntry);
+HAL_StatusTypeDef HAL_ETH_PTP_ServoUpdate(ETH_HandleTypeDef *heth, ETH_PtpServoTypeDef *pServo, int32_t OffsetNs);
 #endif /* HAL_ETH_USE_PTP */
 
 HAL_StatusTypeDef HAL_ETH_Transmit(ETH_HandleTypeDef *heth, ETH_TxPacketConfig *pTxConfig, uint32_t Timeout);
 HAL_StatusTypeDef HAL_ETH_Transmit_IT(ETH_HandleTypeDef *heth, ETH_TxPacketConfig *pTxConfig);
+HAL_StatusTypeDef HAL_ETH_TransmitBatch_IT(ETH_HandleTypeDef *heth, ETH_TxPacketConfig *pTxConfig,
+                                           uint32_t NbPackets, uint32_t *pNbQueued);
+HAL_StatusTypeDef HAL_ETH_TxQueueConfig(ETH_HandleTypeDef *heth, ETH_TxPrioQueueTypeDef *pQueues,
+                                        uint32_t NbQueues, uint32_t SchedMode);
+HAL_StatusTypeDef HAL_ETH_TxQueuePacket(ETH_HandleTypeDef *heth, uint32_t Queue, ETH_TxPacketConfig *pTxConfig);
+HAL_StatusTypeDef HAL_ETH_TxQueueSchedule(ETH_HandleTypeDef *heth);
 
 HAL_StatusTypeDef HAL_ETH_WritePHYRegister(ETH_HandleTypeDef *heth, uint32_t PHYAddr, uint32_t PHYReg,
                                            uint32_t RegValue);
 HAL_StatusTypeDef HAL_ETH_ReadPHYRegister(ETH_HandleTypeDef *heth, uint32_t PHYAddr, uint32_t PHYReg,
                                           uint32_t *pRegValue);
+HAL_StatusTypeDef HAL_ETH_MDIO_Submit(ETH_HandleTypeDef *heth, ETH_MDIOCmdTypeDef *pCmd);
+void              HAL_ETH_MDIO_Process(ETH_HandleTypeDef *heth);
+HAL_StatusTypeDef HAL_ETH_MDIO_StartLinkPoll(ETH_HandleTypeDef *heth, uint32_t PHYAddr, uint32_t Interval);
+HAL_StatusTypeDef HAL_ETH_MDIO_StopLinkPoll(ETH_HandleTypeDef *heth);
+uint32_t          HAL_ETH_MDIO_GetLinkState(ETH_HandleTypeDef *heth);
+void              HAL_ETH_MDIOCpltCallback(ETH_HandleTypeDef *heth, ETH_MDIOCmdTypeDef *pCmd);
+void              HAL_ETH_LinkStateChangeCallback(ETH_HandleTypeDef *heth, uint32_t LinkState);
 
 void              HAL_ETH_IRQHandler(ETH_HandleTypeDef *heth);
 void              HAL_ETH_TxCpltCallback(ETH_HandleTypeDef *heth);
@@ -1815,6 +2017,9 @@ void              HAL_ETH_EnterPowerDownMode(ETH_HandleTypeDef *heth, ETH_PowerD
 void              HAL_ETH_ExitPowerDownMode(ETH_HandleTypeDef *heth);
 HAL_StatusTypeDef HAL_ETH_SetWakeUpFilter(ETH_HandleTypeDef *heth, uint32_t *pFilter, uint32_t Count);
 
+/* Interrupt Coalescing APIs    ***********************************************/
+HAL_StatusTypeDef HAL_ETH_SetRxInterruptWatchdog(ETH_HandleTypeDef *heth, uint32_t WatchdogCount);
+
 /**
   * @}
   */
@@ -146,6 +146,43 @@ typedef struct
   *
   */
 
+/**
+  * @brief  ETH loopback throughput test structure definition
+  * @note   The first fields are set by the application, the others are the results of
+  *         HAL_ETHEx_LoopbackTest().
+  */
+typedef struct
+{
+  uint8_t  *pFrame;                /*!< Frame sent in loopback, FrameLength bytes without the FCS, in memory reachable
+                                        by the Ethernet DMA. The destination address must pass the MAC filter (MAC
+                                        address of the interface or broadcast) */
+
+  uint32_t FrameLength;            /*!< Frame length, from ETH_LOOPBACK_MIN_LENGTH to ETH_LOOPBACK_MAX_LENGTH */
+
+  uint32_t FrameCount;             /*!< Number of frames of the test, from 1 */
+
+  uint32_t InFlight;               /*!< Frames queued to the Tx DMA at most, from 1 to ETH_TX_DESC_CNT. A value
+                                        lower than ETH_TX_DESC_CNT measures the throughput of a smaller Tx ring */
+
+  uint32_t Placement;              /*!< Placement of the descriptors and of pFrame.
+                                        This parameter is a combination of @ref ETHEx_Placement_Flags */
+
+  uint32_t TxFrames;               /*!< Frames handed to the Tx DMA */
+
+  uint32_t RxFrames;               /*!< Frames received back */
+
+  uint32_t RxErrors;               /*!< Frames found corrupted by HAL_ETHEx_LoopbackRxCallback() */
+
+  uint32_t ElapsedTime;            /*!< Test duration in ms, from the first transmission to the last reception */
+
+  uint32_t FramesPerSecond;        /*!< Received frames per second */
+
+  uint32_t KbitPerSecond;          /*!< Received frame bits per ms, FCS, preamble and inter-frame gap excluded */
+} ETH_LoopbackTestTypeDef;
+/**
+  *
+  */
+
 /**
   * @}
   */
@@ -294,6 +331,30 @@ typedef struct
   * @}
   */
 
+/** @defgroup ETHEx_Placement_Flags ETHEx Placement Flags
+  * @{
+  */
+#define ETH_PLACEMENT_OK              0x00000000U  /*!< Memory reachable by the DMA and coherent with the CPU     */
+#define ETH_PLACEMENT_NO_DMA_ACCESS   0x00000001U  /*!< Memory in ITCM or DTCM, not reachable by the Ethernet DMA */
+#define ETH_PLACEMENT_NOT_D2_SRAM     0x00000002U  /*!< Memory out of the D2 AHB SRAM, the DMA accesses cross the
+                                                        D1/D2 bus matrix bridge                                   */
+#define ETH_PLACEMENT_CACHEABLE       0x00000004U  /*!< D-cache enabled and memory cacheable for the MPU: the
+                                                        descriptors need a non-cacheable region, the buffers need
+                                                        cache maintenance                                         */
+#define ETH_PLACEMENT_UNALIGNED       0x00000008U  /*!< Descriptor list not aligned on a 32-bit word              */
+/**
+  * @}
+  */
+
+/** @defgroup ETHEx_Loopback_Frame_Length ETHEx Loopback Frame Length
+  * @{
+  */
+#define ETH_LOOPBACK_MIN_LENGTH       60U          /*!< Shortest frame, the MAC pads shorter ones                 */
+#define ETH_LOOPBACK_MAX_LENGTH       1514U        /*!< Longest untagged frame                                    */
+/**
+  * @}
+  */
+
 /**
   * @}
   */
@@ -341,6 +402,20 @@ void              HAL_ETHEx_EnterLPIMode(ETH_HandleTypeDef *heth, FunctionalStat
 void              HAL_ETHEx_ExitLPIMode(ETH_HandleTypeDef *heth);
 uint32_t          HAL_ETHEx_GetMACLPIEvent(ETH_HandleTypeDef *heth);
 
+/**
+  * @}
+  */
+
+/** @addtogroup ETHEx_Exported_Functions_Group2
+  * @{
+  */
+/* Descriptor placement and loopback test APIs  *******************************/
+uint32_t          HAL_ETHEx_CheckBufferPlacement(const void *pBuffer, uint32_t Size);
+uint32_t          HAL_ETHEx_CheckDescriptorPlacement(ETH_HandleTypeDef *heth);
+HAL_StatusTypeDef HAL_ETHEx_LoopbackTest(ETH_HandleTypeDef *heth, ETH_LoopbackTestTypeDef *pTest, uint32_t Timeout);
+void              HAL_ETHEx_LoopbackRxCallback(ETH_HandleTypeDef *heth, ETH_LoopbackTestTypeDef *pTest,
+                                               void *pAppBuff);
+
 /**
   * @}
   */
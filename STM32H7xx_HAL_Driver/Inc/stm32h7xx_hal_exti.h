@@ -77,6 +77,42 @@ typedef struct
 
 } EXTI_ConfigTypeDef;
 
+/**
+  * @brief  EXTI capture event structure definition
+  */
+typedef struct
+{
+  uint32_t Timestamp;      /*!< Timestamp counter value sampled on entry of the interrupt */
+  uint32_t Edge;           /*!< Edge deduced from the pin level, EXTI_TRIGGER_RISING or
+                                EXTI_TRIGGER_FALLING */
+} EXTI_CaptureEventTypeDef;
+
+/**
+  * @brief  EXTI capture handle structure definition, one per GPIO line
+  */
+typedef struct __EXTI_CaptureTypeDef
+{
+  uint32_t Line;                        /*!< Captured GPIO line, EXTI_LINE_0 to EXTI_LINE_15 */
+  uint32_t GPIOSel;                     /*!< GPIO port of the line. This parameter can be a
+                                             value of @ref EXTI_GPIOSel */
+  EXTI_CaptureEventTypeDef *pBuffer;    /*!< Event ring, owned by the application */
+  uint32_t BufferSize;                  /*!< Number of events of the ring, a power of 2 */
+  __IO uint32_t *pCounter;              /*!< Free running timestamp counter, e.g. TIMx->CNT.
+                                             NULL selects the DWT cycle counter */
+  uint32_t CounterMask;                 /*!< Counter range mask, e.g. 0xFFFF for a 16-bit
+                                             timer. 0 stands for a 32-bit counter */
+  uint32_t DebounceTime;                /*!< Debounce time in counter ticks, 0 to disable */
+  void (* EventCallback)(struct __EXTI_CaptureTypeDef *hcapture,
+                         const EXTI_CaptureEventTypeDef *pEvent); /*!< Event callback called by
+                                             HAL_EXTI_Capture_Dispatch() */
+  __IO uint32_t Head;                   /*!< Number of events written (internal) */
+  __IO uint32_t Tail;                   /*!< Number of events read (internal) */
+  __IO uint32_t Overruns;               /*!< Number of events lost on a full ring */
+  __IO uint32_t Debouncing;             /*!< Line masked during a debounce time (internal) */
+  uint32_t DebounceStart;               /*!< Timestamp of the debounced edge (internal) */
+  uint32_t LastLevel;                   /*!< Last recorded pin level (internal) */
+} EXTI_CaptureTypeDef;
+
 /**
   * @}
   */
@@ -464,6 +500,9 @@ typedef struct
 #endif /*GPIOI*/
 
 #define IS_EXTI_GPIO_PIN(__PIN__)       ((__PIN__) < 16UL)
+
+#define IS_EXTI_GPIO_LINE(__EXTI_LINE__)     (IS_EXTI_LINE(__EXTI_LINE__) && \
+                                             (((__EXTI_LINE__) & EXTI_PROPERTY_MASK) == EXTI_GPIO))
 #if defined (LPTIM4) && defined (LPTIM5)
 #define IS_EXTI_D3_PENDCLR_SRC(__SRC__) (((__SRC__) == EXTI_D3_PENDCLR_SRC_NONE) || \
                                          ((__SRC__) == EXTI_D3_PENDCLR_SRC_DMACH6) || \
@@ -513,6 +552,20 @@ uint32_t          HAL_EXTI_GetPending(EXTI_HandleTypeDef *hexti, uint32_t Edge);
 void              HAL_EXTI_ClearPending(EXTI_HandleTypeDef *hexti, uint32_t Edge);
 void              HAL_EXTI_GenerateSWI(EXTI_HandleTypeDef *hexti);
 
+/**
+  * @}
+  */
+
+/** @defgroup EXTI_Exported_Functions_Group3 Capture functions
+  * @brief    Capture functions
+  * @{
+  */
+/* Capture functions **********************************************************/
+HAL_StatusTypeDef HAL_EXTI_Capture_Init(EXTI_CaptureTypeDef *hcapture);
+void              HAL_EXTI_Capture_IRQHandler(EXTI_CaptureTypeDef *hcapture);
+void              HAL_EXTI_Capture_DebounceHandler(EXTI_CaptureTypeDef *hcapture);
+HAL_StatusTypeDef HAL_EXTI_Capture_Read(EXTI_CaptureTypeDef *hcapture, EXTI_CaptureEventTypeDef *pEvent);
+uint32_t          HAL_EXTI_Capture_Dispatch(EXTI_CaptureTypeDef *hcapture);
 /**
   * @}
   */
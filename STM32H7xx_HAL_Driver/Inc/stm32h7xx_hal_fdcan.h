@@ -702,6 +702,145 @@ typedef struct
 
 } FDCAN_MsgRamAddressTypeDef;
 
+/**
+  * @brief  FDCAN message RAM requirements of an instance, input of HAL_FDCAN_PlanMessageRAM
+  * @note   The Rx FIFOs and the Tx FIFO/Queue get at least their Min number of elements,
+  *         then grow up to their Max number of elements with the RAM left by all the
+  *         planned instances. Min equal to Max gives a fixed depth.
+  */
+typedef struct
+{
+  uint32_t StdFiltersNbr;        /*!< Number of standard Message ID filters.
+                                      This parameter must be a number between 0 and 128            */
+
+  uint32_t ExtFiltersNbr;        /*!< Number of extended Message ID filters.
+                                      This parameter must be a number between 0 and 64             */
+
+  uint32_t RxFifo0MinNbr;        /*!< Minimum number of Rx FIFO 0 elements.
+                                      This parameter must be a number between 0 and RxFifo0MaxNbr  */
+
+  uint32_t RxFifo0MaxNbr;        /*!< Maximum number of Rx FIFO 0 elements.
+                                      This parameter must be a number between 0 and 64             */
+
+  uint32_t RxFifo0ElmtSize;      /*!< Data Field Size in an Rx FIFO 0 element.
+                                      This parameter can be a value of @ref FDCAN_data_field_size  */
+
+  uint32_t RxFifo1MinNbr;        /*!< Minimum number of Rx FIFO 1 elements.
+                                      This parameter must be a number between 0 and RxFifo1MaxNbr  */
+
+  uint32_t RxFifo1MaxNbr;        /*!< Maximum number of Rx FIFO 1 elements.
+                                      This parameter must be a number between 0 and 64             */
+
+  uint32_t RxFifo1ElmtSize;      /*!< Data Field Size in an Rx FIFO 1 element.
+                                      This parameter can be a value of @ref FDCAN_data_field_size  */
+
+  uint32_t RxBuffersNbr;         /*!< Number of Dedicated Rx Buffer elements.
+                                      This parameter must be a number between 0 and 64             */
+
+  uint32_t RxBufferSize;         /*!< Data Field Size in an Rx Buffer element.
+                                      This parameter can be a value of @ref FDCAN_data_field_size  */
+
+  uint32_t TxEventsNbr;          /*!< Number of Tx Event FIFO elements.
+                                      This parameter must be a number between 0 and 32             */
+
+  uint32_t TxBuffersNbr;         /*!< Number of Dedicated Tx Buffers.
+                                      This parameter must be a number between 0 and 32             */
+
+  uint32_t TxFifoQueueMinNbr;    /*!< Minimum number of Tx FIFO/Queue elements.
+                                      This parameter must be a number between 0 and
+                                      TxFifoQueueMaxNbr                                            */
+
+  uint32_t TxFifoQueueMaxNbr;    /*!< Maximum number of Tx FIFO/Queue elements.
+                                      This parameter must be a number between 0 and
+                                      32 - TxBuffersNbr                                            */
+
+  uint32_t TxElmtSize;           /*!< Data Field Size in a Tx Element.
+                                      This parameter can be a value of @ref FDCAN_data_field_size  */
+
+  uint32_t TriggerMemoryNbr;     /*!< Number of trigger memory elements reserved after the blocks
+                                      of the instance for HAL_FDCAN_TT_ConfigOperation, 0 when the
+                                      instance is not time-triggered.
+                                      This parameter must be a number between 0 and 64             */
+
+} FDCAN_RamPlanTypeDef;
+
+/**
+  * @brief  FDCAN Rx FIFO span structure definition, elements read in place in the message RAM
+  */
+typedef struct
+{
+  uint32_t RxFifo;           /*!< Specifies the Rx FIFO of the span.
+                                  This parameter can be a value of @ref FDCAN_Rx_location  */
+
+  uint32_t Count;            /*!< Number of elements in the span, 0 when the FIFO is empty */
+
+  uint32_t GetIndex;         /*!< Index of the first element of the span in the FIFO       */
+
+  uint32_t FifoStartAddress; /*!< Address of the first element of the FIFO                 */
+
+  uint32_t ElementsNbr;      /*!< Number of elements of the FIFO                           */
+
+  uint32_t ElementSize;      /*!< Size of an element of the FIFO (in 32-bit words)         */
+
+} FDCAN_RxFifoSpanTypeDef;
+
+/**
+  * @brief  FDCAN Tx scheduler entry structure definition, one frame of the software Tx queue
+  */
+typedef struct
+{
+  FDCAN_TxHeaderTypeDef Header;  /*!< Tx header of the frame                                  */
+
+  uint8_t Data[64];              /*!< Payload of the frame                                    */
+
+  uint32_t Key;                  /*!< Arbitration key of the frame, used internally           */
+
+  uint32_t Seq;                  /*!< Enqueue order of the frame, used internally             */
+
+} FDCAN_TxSchedEntryTypeDef;
+
+/**
+  * @brief  FDCAN Tx scheduler structure definition
+  * @note   The fields up to NbBuffers are set by the application before calling
+  *         HAL_FDCAN_TxSchedInit, the other ones are managed by the driver.
+  */
+typedef struct
+{
+  FDCAN_TxSchedEntryTypeDef *pEntries;      /*!< Pool of NbEntries entries, owned by the application      */
+
+  FDCAN_TxSchedEntryTypeDef **pQueue;       /*!< Array of NbEntries pointers, owned by the application.
+                                                 It holds the priority heap then the free entries       */
+
+  uint32_t NbEntries;                       /*!< Number of entries of the pool                            */
+
+  uint32_t FirstBuffer;                     /*!< Index of the first dedicated Tx buffer fed by the
+                                                 scheduler. This parameter must be a number between
+                                                 Min_Data = 0 and Max_Data = 31                         */
+
+  uint32_t NbBuffers;                       /*!< Number of consecutive dedicated Tx buffers fed by the
+                                                 scheduler. This parameter must be a number between
+                                                 Min_Data = 1 and Max_Data = 32 - FirstBuffer           */
+
+  uint32_t BufferMask;                      /*!< Dedicated Tx buffers fed by the scheduler                */
+
+  uint32_t PendingMask;                     /*!< Managed buffers holding a frame                          */
+
+  uint32_t CancelMask;                      /*!< Managed buffers cancelled to make room for a frame of
+                                                 higher priority                                        */
+
+  uint32_t QueueCount;                      /*!< Number of frames waiting in the software queue           */
+
+  uint32_t FreeCount;                       /*!< Number of free entries                                   */
+
+  uint32_t NextSeq;                         /*!< Enqueue order of the next frame                          */
+
+  uint32_t PreemptCount;                    /*!< Number of frames put back in the software queue to let
+                                                 a frame of higher priority reach the hardware          */
+
+  FDCAN_TxSchedEntryTypeDef *pInFlight[32]; /*!< Frame held by each managed buffer                        */
+
+} FDCAN_TxSchedTypeDef;
+
 /**
   * @brief  FDCAN handle structure definition
   */
@@ -728,6 +867,9 @@ typedef struct
 
   __IO uint32_t               ErrorCode;        /*!< FDCAN Error code          */
 
+  FDCAN_TxSchedTypeDef        *pTxSched;        /*!< Software Tx scheduler,
+                                                     NULL when not used       */
+
 #if USE_HAL_FDCAN_REGISTER_CALLBACKS == 1
   void (* ClockCalibrationCallback)(struct __FDCAN_HandleTypeDef *hfdcan, uint32_t ClkCalibrationITs);         /*!< FDCAN Clock Calibration callback          */
   void (* TxEventFifoCallback)(struct __FDCAN_HandleTypeDef *hfdcan, uint32_t TxEventFifoITs);                 /*!< FDCAN Tx Event Fifo callback              */
@@ -1930,6 +2072,48 @@ do{                                                              \
   */
 #define __HAL_FDCAN_TT_GET_IT_SOURCE(__HANDLE__, __INTERRUPT__) (((__HANDLE__)->ttcan->TTIE) & (__INTERRUPT__))
 
+/** @brief  Get the address of an element of an Rx FIFO span in the message RAM.
+  * @param  __SPAN__ pointer to a FDCAN_RxFifoSpanTypeDef structure.
+  * @param  __INDEX__ index of the element in the span, from 0 to Count - 1.
+  * @retval Element address (const uint32_t *)
+  */
+#define __HAL_FDCAN_GET_SPAN_ELEMENT(__SPAN__, __INDEX__)                                     \
+  ((const uint32_t *)((__SPAN__)->FifoStartAddress +                                          \
+                      ((((__SPAN__)->GetIndex + (__INDEX__)) % (__SPAN__)->ElementsNbr) *    \
+                       (__SPAN__)->ElementSize * 4U)))
+
+/** @brief  Get the identifier type of an Rx element in the message RAM.
+  * @param  __ELEMENT__ element address.
+  * @retval FDCAN_STANDARD_ID or FDCAN_EXTENDED_ID
+  */
+#define __HAL_FDCAN_GET_ELEMENT_IDTYPE(__ELEMENT__) ((__ELEMENT__)[0] & FDCAN_EXTENDED_ID)
+
+/** @brief  Get the identifier of an Rx element in the message RAM.
+  * @param  __ELEMENT__ element address.
+  * @retval Standard or extended identifier
+  */
+#define __HAL_FDCAN_GET_ELEMENT_ID(__ELEMENT__)                                        \
+  ((((__ELEMENT__)[0] & FDCAN_EXTENDED_ID) == FDCAN_STANDARD_ID) ?                     \
+   (((__ELEMENT__)[0] & 0x1FFC0000U) >> 18U) : ((__ELEMENT__)[0] & 0x1FFFFFFFU))
+
+/** @brief  Get the data length code of an Rx element in the message RAM.
+  * @param  __ELEMENT__ element address.
+  * @retval Data length code, a value of @ref FDCAN_data_length_code
+  */
+#define __HAL_FDCAN_GET_ELEMENT_DLC(__ELEMENT__) ((__ELEMENT__)[1] & FDCAN_DLC_BYTES_64)
+
+/** @brief  Get the payload size of an Rx element in the message RAM.
+  * @param  __ELEMENT__ element address.
+  * @retval Payload size (in bytes)
+  */
+#define __HAL_FDCAN_GET_ELEMENT_LENGTH(__ELEMENT__) FDCAN_DLC_TO_BYTES(__HAL_FDCAN_GET_ELEMENT_DLC(__ELEMENT__) >> 16U)
+
+/** @brief  Get the payload of an Rx element in the message RAM.
+  * @param  __ELEMENT__ element address.
+  * @retval Payload address (const uint8_t *)
+  */
+#define __HAL_FDCAN_GET_ELEMENT_DATA(__ELEMENT__) ((const uint8_t *)&(__ELEMENT__)[2])
+
 /**
   * @}
   */
@@ -1949,6 +2133,7 @@ void              HAL_FDCAN_MspInit(FDCAN_HandleTypeDef *hfdcan);
 void              HAL_FDCAN_MspDeInit(FDCAN_HandleTypeDef *hfdcan);
 HAL_StatusTypeDef HAL_FDCAN_EnterPowerDownMode(FDCAN_HandleTypeDef *hfdcan);
 HAL_StatusTypeDef HAL_FDCAN_ExitPowerDownMode(FDCAN_HandleTypeDef *hfdcan);
+HAL_StatusTypeDef HAL_FDCAN_PlanMessageRAM(FDCAN_HandleTypeDef *hfdcan[], const FDCAN_RamPlanTypeDef *pPlan, uint32_t NbInstances);
 
 #if USE_HAL_FDCAN_REGISTER_CALLBACKS == 1
 /* Callbacks Register/UnRegister functions  ***********************************/
@@ -2028,6 +2213,13 @@ HAL_StatusTypeDef HAL_FDCAN_EnableTxBufferRequest(FDCAN_HandleTypeDef *hfdcan, u
 uint32_t HAL_FDCAN_GetLatestTxFifoQRequestBuffer(FDCAN_HandleTypeDef *hfdcan);
 HAL_StatusTypeDef HAL_FDCAN_AbortTxRequest(FDCAN_HandleTypeDef *hfdcan, uint32_t BufferIndex);
 HAL_StatusTypeDef HAL_FDCAN_GetRxMessage(FDCAN_HandleTypeDef *hfdcan, uint32_t RxLocation, FDCAN_RxHeaderTypeDef *pRxHeader, uint8_t *pRxData);
+HAL_StatusTypeDef HAL_FDCAN_GetRxFifoSpan(FDCAN_HandleTypeDef *hfdcan, uint32_t RxFifo, FDCAN_RxFifoSpanTypeDef *pSpan);
+void HAL_FDCAN_DecodeRxElement(const uint32_t *pElement, FDCAN_RxHeaderTypeDef *pRxHeader);
+HAL_StatusTypeDef HAL_FDCAN_ReleaseRxFifoSpan(FDCAN_HandleTypeDef *hfdcan, const FDCAN_RxFifoSpanTypeDef *pSpan, uint32_t Count);
+HAL_StatusTypeDef HAL_FDCAN_TxSchedInit(FDCAN_HandleTypeDef *hfdcan, FDCAN_TxSchedTypeDef *pTxSched);
+HAL_StatusTypeDef HAL_FDCAN_TxSchedDeInit(FDCAN_HandleTypeDef *hfdcan);
+HAL_StatusTypeDef HAL_FDCAN_TxSchedEnqueue(FDCAN_HandleTypeDef *hfdcan, const FDCAN_TxHeaderTypeDef *pTxHeader, const uint8_t *pTxData);
+uint32_t HAL_FDCAN_TxSchedGetPending(FDCAN_HandleTypeDef *hfdcan);
 HAL_StatusTypeDef HAL_FDCAN_GetTxEvent(FDCAN_HandleTypeDef *hfdcan, FDCAN_TxEventFifoTypeDef *pTxEvent);
 HAL_StatusTypeDef HAL_FDCAN_GetHighPriorityMessageStatus(FDCAN_HandleTypeDef *hfdcan, FDCAN_HpMsgStatusTypeDef *HpMsgStatus);
 HAL_StatusTypeDef HAL_FDCAN_GetProtocolStatus(FDCAN_HandleTypeDef *hfdcan, FDCAN_ProtocolStatusTypeDef *ProtocolStatus);
@@ -2049,6 +2241,7 @@ HAL_StatusTypeDef HAL_FDCAN_ExitRestrictedOperationMode(FDCAN_HandleTypeDef *hfd
 HAL_StatusTypeDef HAL_FDCAN_TT_ConfigOperation(FDCAN_HandleTypeDef *hfdcan, FDCAN_TT_ConfigTypeDef *pTTParams);
 HAL_StatusTypeDef HAL_FDCAN_TT_ConfigReferenceMessage(FDCAN_HandleTypeDef *hfdcan, uint32_t IdType, uint32_t Identifier, uint32_t Payload);
 HAL_StatusTypeDef HAL_FDCAN_TT_ConfigTrigger(FDCAN_HandleTypeDef *hfdcan, FDCAN_TriggerTypeDef *sTriggerConfig);
+HAL_StatusTypeDef HAL_FDCAN_TT_ConfigTxSchedWindow(FDCAN_HandleTypeDef *hfdcan, FDCAN_TriggerTypeDef *sTriggerConfig);
 HAL_StatusTypeDef HAL_FDCAN_TT_SetGlobalTime(FDCAN_HandleTypeDef *hfdcan, uint32_t TimePreset);
 HAL_StatusTypeDef HAL_FDCAN_TT_SetClockSynchronization(FDCAN_HandleTypeDef *hfdcan, uint32_t NewTURNumerator);
 HAL_StatusTypeDef HAL_FDCAN_TT_ConfigStopWatch(FDCAN_HandleTypeDef *hfdcan, uint32_t Source, uint32_t Polarity);
@@ -2156,6 +2349,9 @@ HAL_FDCAN_StateTypeDef HAL_FDCAN_GetState(FDCAN_HandleTypeDef *hfdcan);
 /** @defgroup FDCAN_Private_Macros FDCAN Private Macros
   * @{
   */
+#define FDCAN_DLC_TO_BYTES(__DLC__) (((__DLC__) <= 8U) ? (__DLC__) :                               \
+                                     (((__DLC__) <= 12U) ? (((__DLC__) - 6U) * 4U) : (((__DLC__) - 11U) * 16U)))
+
 #define IS_FDCAN_FRAME_FORMAT(FORMAT) (((FORMAT) == FDCAN_FRAME_CLASSIC  ) || \
                                        ((FORMAT) == FDCAN_FRAME_FD_NO_BRS) || \
                                        ((FORMAT) == FDCAN_FRAME_FD_BRS   ))
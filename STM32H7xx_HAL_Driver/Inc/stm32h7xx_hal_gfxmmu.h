@@ -148,6 +148,26 @@ typedef struct
                                           LineOffset = [(Blocks already used) - (1st visible block)]*BlockSize. */
 }GFXMMU_LutLineTypeDef;
 
+/**
+  * @brief  GFXMMU display shape structure definition
+  */
+typedef struct
+{
+  uint32_t       Shape;     /*!< Shape of the visible area of the display.
+                                 This parameter can be a value of @ref GFXMMU_Shape. */
+  uint32_t       Width;     /*!< Width of the display in pixels.
+                                 @note: Width * PixelSize must not exceed the virtual buffer line size. */
+  uint32_t       Height;    /*!< Height of the display in pixels.
+                                 This parameter must be a number between Min_Data = 1 and Max_Data = 1024. */
+  uint32_t       PixelSize; /*!< Size of one pixel in bytes.
+                                 This parameter must be a number between Min_Data = 1 and Max_Data = 4. */
+  uint32_t       Radius;    /*!< Corner radius in pixels, at most half of the width and of the height.
+                                 @note: Useful only for GFXMMU_SHAPE_ROUNDED_RECT. */
+  const uint8_t *pMask;     /*!< Visibility bitmap of the display, one bit per pixel (MSB first), each line
+                                 starting on a new byte. A pixel is visible when its bit is set.
+                                 @note: Useful only for GFXMMU_SHAPE_MASK. */
+}GFXMMU_ShapeTypeDef;
+
 #if (USE_HAL_GFXMMU_REGISTER_CALLBACKS == 1)
 /**
   * @brief  GFXMMU callback ID enumeration definition
@@ -277,6 +297,16 @@ typedef void (*pGFXMMU_CallbackTypeDef)(GFXMMU_HandleTypeDef *hgfxmmu);
   * @}
   */
 
+/** @defgroup GFXMMU_Shape GFXMMU shape
+  * @{
+  */
+#define GFXMMU_SHAPE_CIRCLE       0x00000000U /*!< Circle inscribed in a square display */
+#define GFXMMU_SHAPE_ROUNDED_RECT 0x00000001U /*!< Rectangle with rounded corners */
+#define GFXMMU_SHAPE_MASK         0x00000002U /*!< Arbitrary shape given by a visibility bitmap */
+/**
+  * @}
+  */
+
 /** @defgroup GFXMMU_CacheForceParam GFXMMU cache force parameter
   * @{
   */
@@ -310,6 +340,15 @@ typedef void (*pGFXMMU_CallbackTypeDef)(GFXMMU_HandleTypeDef *hgfxmmu);
 #define __HAL_GFXMMU_RESET_HANDLE_STATE(__HANDLE__) ((__HANDLE__)->State = HAL_GFXMMU_STATE_RESET)
 #endif
 
+/** @brief  Get the size in bytes of one line of the GFXMMU virtual buffers.
+  * @param  __HANDLE__ GFXMMU handle.
+  * @note   This value is the pitch to use for the LTDC layers and the DMA2D
+  *         transfers working on the virtual buffers.
+  * @retval Virtual buffer line size in bytes (4096 or 3072).
+  */
+#define __HAL_GFXMMU_GET_VIRTUAL_PITCH(__HANDLE__) \
+  (((__HANDLE__)->Init.BlocksPerLine == GFXMMU_192BLOCKS) ? 3072U : 4096U)
+
 /**
   * @}
   */
@@ -355,6 +394,15 @@ HAL_StatusTypeDef HAL_GFXMMU_DisableLutLines(GFXMMU_HandleTypeDef *hgfxmmu,
 
 HAL_StatusTypeDef HAL_GFXMMU_ConfigLutLine(GFXMMU_HandleTypeDef *hgfxmmu, GFXMMU_LutLineTypeDef *lutLine);
 
+HAL_StatusTypeDef HAL_GFXMMU_ComputeLut(GFXMMU_HandleTypeDef *hgfxmmu,
+                                        const GFXMMU_ShapeTypeDef *Shape,
+                                        uint32_t *pLut,
+                                        uint32_t *pBufferSize);
+
+HAL_StatusTypeDef HAL_GFXMMU_ConfigLutShape(GFXMMU_HandleTypeDef *hgfxmmu,
+                                            const GFXMMU_ShapeTypeDef *Shape,
+                                            uint32_t *pBufferSize);
+
 HAL_StatusTypeDef HAL_GFXMMU_ConfigForceCache(GFXMMU_HandleTypeDef *hgfxmmu, uint32_t ForceParam);
 
 HAL_StatusTypeDef HAL_GFXMMU_ModifyBuffers(GFXMMU_HandleTypeDef *hgfxmmu, GFXMMU_BuffersTypeDef *Buffers);
@@ -427,6 +475,12 @@ uint32_t HAL_GFXMMU_GetError(GFXMMU_HandleTypeDef *hgfxmmu);
 
 #define IS_GFXMMU_LUT_LINE_OFFSET(VALUE) (((VALUE) >= -4080) && ((VALUE) <= 4190208))
 
+#define IS_GFXMMU_SHAPE(VALUE) (((VALUE) == GFXMMU_SHAPE_CIRCLE)       || \
+                                ((VALUE) == GFXMMU_SHAPE_ROUNDED_RECT) || \
+                                ((VALUE) == GFXMMU_SHAPE_MASK))
+
+#define IS_GFXMMU_PIXEL_SIZE(VALUE) (((VALUE) > 0U) && ((VALUE) <= 4U))
+
 #define IS_GFXMMU_CACHE_FORCE_ACTION(VALUE) (((VALUE) == GFXMMU_CACHE_FORCE_FLUSH) || \
                                              ((VALUE) == GFXMMU_CACHE_FORCE_INVALIDATE) || \
                                              ((VALUE) == (GFXMMU_CACHE_FORCE_FLUSH | GFXMMU_CACHE_FORCE_INVALIDATE)))
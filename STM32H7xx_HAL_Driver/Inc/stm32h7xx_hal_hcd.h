@@ -58,6 +58,40 @@ typedef USB_OTG_CfgTypeDef      HCD_InitTypeDef;
 typedef USB_OTG_HCTypeDef       HCD_HCTypeDef;
 typedef USB_OTG_URBStateTypeDef HCD_URBStateTypeDef;
 typedef USB_OTG_HCStateTypeDef  HCD_HCStateTypeDef;
+
+/**
+  * @brief  HCD periodic transfer structure definition
+  */
+typedef struct
+{
+  uint8_t   *pBuff;      /*!< Buffer of the periodic transfer                                  */
+  uint16_t  Length;      /*!< Length of the periodic transfer                                  */
+  uint16_t  Interval;    /*!< Polling interval in (micro)frames of the root port, 0 if unused */
+  uint16_t  Phase;       /*!< (Micro)frame of the interval in which the transfer is started   */
+  uint32_t  Missed;      /*!< Polls skipped because the previous transfer was not completed   */
+} HCD_PeriodicTypeDef;
+
+/**
+  * @brief  HCD pipelined bulk transfer structure definition
+  */
+typedef struct
+{
+  uint8_t   *pBuff;      /*!< Buffer of the transfer, 32-bit aligned                           */
+  uint32_t  Length;      /*!< Length of the transfer, a multiple of the max packet size for IN */
+  uint32_t  XferCount;   /*!< Bytes transferred, set when the transfer is completed            */
+} HCD_BulkXferTypeDef;
+
+/**
+  * @brief  HCD bulk pipeline structure definition
+  */
+typedef struct
+{
+  HCD_BulkXferTypeDef *pQueue; /*!< Ring of Depth transfers of the application, NULL if unused */
+  uint8_t   Depth;       /*!< Number of transfers of pQueue                                    */
+  uint8_t   Head;        /*!< Transfer in progress                                             */
+  __IO uint8_t Count;    /*!< Transfers queued and not yet completed                           */
+  uint32_t  Offset;      /*!< Bytes of the transfer in progress already transferred            */
+} HCD_PipelineTypeDef;
 /**
   * @}
   */
@@ -74,6 +108,10 @@ typedef struct
   HCD_TypeDef               *Instance;  /*!< Register base address    */
   HCD_InitTypeDef           Init;       /*!< HCD required parameters  */
   HCD_HCTypeDef             hc[16];     /*!< Host channels parameters */
+  HCD_PeriodicTypeDef       periodic[16]; /*!< Periodic transfers started by the driver */
+  uint8_t                   PeriodicLoad[8]; /*!< Periodic transfers per (micro)frame modulo 8 */
+  HCD_PipelineTypeDef       pipeline[16]; /*!< Bulk transfers queued by HAL_HCD_HC_QueueRequest() */
+  uint32_t                  ChannelsInUse; /*!< Host channels allocated by HAL_HCD_HC_Alloc() */
   HAL_LockTypeDef           Lock;       /*!< HCD peripheral status    */
   __IO HCD_StateTypeDef     State;      /*!< HCD communication state  */
   __IO  uint32_t            ErrorCode;  /*!< HCD Error code           */
@@ -190,6 +228,16 @@ HAL_StatusTypeDef HAL_HCD_HC_Init(HCD_HandleTypeDef *hhcd, uint8_t ch_num,
                                   uint8_t speed, uint8_t ep_type, uint16_t mps);
 
 HAL_StatusTypeDef HAL_HCD_HC_Halt(HCD_HandleTypeDef *hhcd, uint8_t ch_num);
+HAL_StatusTypeDef HAL_HCD_HC_Alloc(HCD_HandleTypeDef *hhcd, uint8_t *pChNum);
+HAL_StatusTypeDef HAL_HCD_HC_Free(HCD_HandleTypeDef *hhcd, uint8_t ch_num);
+HAL_StatusTypeDef HAL_HCD_HC_SetHubInfo(HCD_HandleTypeDef *hhcd, uint8_t ch_num,
+                                        uint8_t addr, uint8_t PortNbr);
+HAL_StatusTypeDef HAL_HCD_HC_SetPeriodic(HCD_HandleTypeDef *hhcd, uint8_t ch_num,
+                                         uint16_t Interval, uint8_t *pbuff, uint16_t length);
+HAL_StatusTypeDef HAL_HCD_HC_ClearPeriodic(HCD_HandleTypeDef *hhcd, uint8_t ch_num);
+HAL_StatusTypeDef HAL_HCD_HC_SetPipeline(HCD_HandleTypeDef *hhcd, uint8_t ch_num,
+                                         HCD_BulkXferTypeDef *pQueue, uint8_t Depth);
+HAL_StatusTypeDef HAL_HCD_HC_ClearPipeline(HCD_HandleTypeDef *hhcd, uint8_t ch_num);
 void              HAL_HCD_MspInit(HCD_HandleTypeDef *hhcd);
 void              HAL_HCD_MspDeInit(HCD_HandleTypeDef *hhcd);
 
@@ -251,6 +299,8 @@ HAL_StatusTypeDef HAL_HCD_HC_SubmitRequest(HCD_HandleTypeDef *hhcd, uint8_t ch_n
                                            uint8_t direction, uint8_t ep_type,
                                            uint8_t token, uint8_t *pbuff,
                                            uint16_t length, uint8_t do_ping);
+HAL_StatusTypeDef HAL_HCD_HC_QueueRequest(HCD_HandleTypeDef *hhcd, uint8_t ch_num,
+                                          uint8_t *pbuff, uint32_t length);
 
 /* Non-Blocking mode: Interrupt */
 void HAL_HCD_IRQHandler(HCD_HandleTypeDef *hhcd);
@@ -284,6 +334,8 @@ HCD_StateTypeDef        HAL_HCD_GetState(HCD_HandleTypeDef *hhcd);
 HCD_URBStateTypeDef     HAL_HCD_HC_GetURBState(HCD_HandleTypeDef *hhcd, uint8_t chnum);
 HCD_HCStateTypeDef      HAL_HCD_HC_GetState(HCD_HandleTypeDef *hhcd, uint8_t chnum);
 uint32_t                HAL_HCD_HC_GetXferCount(HCD_HandleTypeDef *hhcd, uint8_t chnum);
+uint32_t                HAL_HCD_HC_GetPeriodicMissed(HCD_HandleTypeDef *hhcd, uint8_t chnum);
+uint32_t                HAL_HCD_HC_GetPipelineCount(HCD_HandleTypeDef *hhcd, uint8_t chnum);
 uint32_t                HAL_HCD_GetCurrentFrame(HCD_HandleTypeDef *hhcd);
 uint32_t                HAL_HCD_GetCurrentSpeed(HCD_HandleTypeDef *hhcd);
 
@@ -35,6 +35,70 @@ extern "C" {
    * @{
    */
 
+#if defined(DUAL_CORE)
+/* Exported types ------------------------------------------------------------*/
+/** @defgroup HSEM_Exported_Types HSEM Exported Types
+  * @{
+  */
+
+/**
+  * @brief  HSEM arbiter structure definition, one per core and per shared resource
+  */
+typedef struct
+{
+  uint32_t      SemID;                /*!< Semaphore protecting the shared resource, from 0 to 31          */
+  uint32_t      RequestSemID;         /*!< Semaphore released by the other core to request the resource,
+                                           notified on this core, from 0 to 31                               */
+  uint32_t      PeerRequestSemID;     /*!< Semaphore released by this core to request the resource from
+                                           the other core, from 0 to 31                                      */
+  __IO uint32_t Owned;                /*!< The semaphore is kept taken by this core                        */
+  __IO uint32_t InUse;                /*!< The resource is accessed, between Acquire and Release           */
+  __IO uint32_t YieldPending;         /*!< The other core requested the resource while it was in use      */
+  __IO uint32_t FastCount;            /*!< Number of acquisitions served without taking the semaphore      */
+  __IO uint32_t TakeCount;            /*!< Number of acquisitions which took the semaphore                 */
+} HSEM_ArbiterTypeDef;
+
+/**
+  * @}
+  */
+
+/* Exported constants --------------------------------------------------------*/
+/** @defgroup HSEM_Exported_Constants HSEM Exported Constants
+  * @{
+  */
+
+/** @defgroup HSEM_Boot_Event HSEM Boot Event
+  * @brief    Boot events published by a core to the other one
+  * @{
+  */
+#define HSEM_BOOT_EVENT_CLOCK_READY   0x00000001U   /*!< System clock tree configured               */
+#define HSEM_BOOT_EVENT_SHMEM_READY   0x00000002U   /*!< Shared memory initialized                  */
+#define HSEM_BOOT_EVENT_ALL           (HSEM_BOOT_EVENT_CLOCK_READY | HSEM_BOOT_EVENT_SHMEM_READY)
+/**
+  * @}
+  */
+
+/** @defgroup HSEM_Boot_SemID HSEM Boot Semaphores
+  * @brief    Semaphores released to notify the boot events. Can be redefined in
+  *           stm32h7xx_hal_conf.h, they must not be used for anything else.
+  * @{
+  */
+#ifndef HSEM_BOOT_CLOCK_SEMID
+#define HSEM_BOOT_CLOCK_SEMID         0U            /*!< Semaphore of HSEM_BOOT_EVENT_CLOCK_READY   */
+#endif /* HSEM_BOOT_CLOCK_SEMID */
+
+#ifndef HSEM_BOOT_SHMEM_SEMID
+#define HSEM_BOOT_SHMEM_SEMID         1U            /*!< Semaphore of HSEM_BOOT_EVENT_SHMEM_READY   */
+#endif /* HSEM_BOOT_SHMEM_SEMID */
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+#endif /* DUAL_CORE */
+
 /* Exported macro ------------------------------------------------------------*/
 /** @defgroup HSEM_Exported_Macros HSEM Exported Macros
   * @{
@@ -169,6 +233,34 @@ void HAL_HSEM_IRQHandler(void);
   * @}
   */
 
+#if defined(DUAL_CORE)
+/** @addtogroup HSEM_Exported_Functions_Group4
+  * @brief   HSEM shared resource arbiter functions
+  * @{
+  */
+HAL_StatusTypeDef HAL_HSEM_ArbiterInit(HSEM_ArbiterTypeDef *harb);
+HAL_StatusTypeDef HAL_HSEM_ArbiterDeInit(HSEM_ArbiterTypeDef *harb);
+HAL_StatusTypeDef HAL_HSEM_ArbiterAcquire(HSEM_ArbiterTypeDef *harb, uint32_t Timeout);
+void HAL_HSEM_ArbiterRelease(HSEM_ArbiterTypeDef *harb);
+void HAL_HSEM_ArbiterIRQHandler(HSEM_ArbiterTypeDef *harb, uint32_t SemMask);
+
+/**
+  * @}
+  */
+
+/** @addtogroup HSEM_Exported_Functions_Group5
+  * @brief   HSEM boot coordination functions
+  * @{
+  */
+void HAL_HSEM_BootPublish(uint32_t Events);
+HAL_StatusTypeDef HAL_HSEM_BootWait(uint32_t Events, uint32_t Timeout);
+uint32_t HAL_HSEM_BootGetEvents(void);
+
+/**
+  * @}
+  */
+#endif /* DUAL_CORE */
+
 /**
   * @}
   */
@@ -191,6 +283,10 @@ void HAL_HSEM_IRQHandler(void);
 #define IS_HSEM_COREID(__COREID__) ((__COREID__) == HSEM_CPU1_COREID)
 #endif
 
+#if defined(DUAL_CORE)
+#define IS_HSEM_BOOT_EVENT(__EVENT__) ((((__EVENT__) & ~HSEM_BOOT_EVENT_ALL) == 0U) && ((__EVENT__) != 0U))
+#endif /* DUAL_CORE */
+
 
 /**
   * @}
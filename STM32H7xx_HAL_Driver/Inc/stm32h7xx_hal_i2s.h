@@ -92,6 +92,51 @@ typedef enum
   HAL_I2S_STATE_ERROR      = 0x07UL   /*!< I2S error state                                    */
 } HAL_I2S_StateTypeDef;
 
+/**
+  * @brief I2S period stream Structure definition
+  */
+typedef struct
+{
+  const uint16_t             *pTxRing;             /*!< Transmit ring of NbPeriods periods */
+
+  uint16_t                   *pRxRing;             /*!< Receive ring of NbPeriods periods */
+
+  uint32_t                   PeriodSize;           /*!< Number of DMA data per period, from 1 to 65535 */
+
+  uint32_t                   NbPeriods;            /*!< Number of periods of each ring, at least 2 */
+
+  uint32_t                   ClockTrim;            /*!< PLL trimmed by HAL_I2SEx_StreamTrimClock().
+                                                        This parameter can be a value of @ref I2S_Stream_Clock_Trim */
+
+  uint32_t                   FracNominal;          /*!< PLL FRACN value at zero drift, from 0 to 8191 */
+
+  uint32_t                   FracRange;            /*!< Maximum deviation of FRACN from FracNominal */
+
+  uint32_t                   KpShift;              /*!< Proportional gain: one FRACN step per 2^KpShift data of drift,
+                                                        from 0 to 16 */
+
+  uint32_t                   KiShift;              /*!< Integral gain: one FRACN step per 2^KiShift accumulated data
+                                                        of drift, from 0 to 16 */
+
+  uint32_t                   PeriodBytes;          /*!< Size of a period (in bytes), internal */
+
+  uint32_t                   TxNext;               /*!< Next period programmed on the Tx DMA, internal */
+
+  uint32_t                   RxNext;               /*!< Next period programmed on the Rx DMA, internal */
+
+  uint32_t                   RxPeriod;             /*!< Period being received, internal */
+
+  __IO uint32_t              PeriodCount;          /*!< Number of periods received since the start */
+
+  int32_t                    DriftOffset;          /*!< Position offset at the first trim, internal */
+
+  int32_t                    DriftIntegral;        /*!< Accumulated drift, internal */
+
+  uint32_t                   DriftStarted;         /*!< Set once the offset is captured, internal */
+
+  uint32_t                   FracN;                /*!< Last FRACN value written in the PLL */
+} I2S_StreamTypeDef;
+
 /**
   * @brief I2S handle Structure definition
   */
@@ -126,6 +171,8 @@ typedef struct __I2S_HandleTypeDef
 
   DMA_HandleTypeDef          *hdmarx;              /*!< I2S Rx DMA handle parameters */
 
+  I2S_StreamTypeDef          *pStream;             /*!< Period stream, NULL when not streaming */
+
   __IO HAL_LockTypeDef       Lock;                 /*!< I2S locking object */
 
   __IO HAL_I2S_StateTypeDef  State;                /*!< I2S communication state */
@@ -140,6 +187,8 @@ typedef struct __I2S_HandleTypeDef
   void (* TxHalfCpltCallback)(struct __I2S_HandleTypeDef *hi2s);         /*!< I2S Tx Half Completed callback     */
   void (* RxHalfCpltCallback)(struct __I2S_HandleTypeDef *hi2s);         /*!< I2S Rx Half Completed callback     */
   void (* TxRxHalfCpltCallback)(struct __I2S_HandleTypeDef *hi2s);       /*!< I2S TxRx Half Completed callback   */
+  void (* RxM0CpltCallback)(struct __I2S_HandleTypeDef *hi2s);           /*!< I2S Rx Memory 0 Completed callback */
+  void (* RxM1CpltCallback)(struct __I2S_HandleTypeDef *hi2s);           /*!< I2S Rx Memory 1 Completed callback */
   void (* ErrorCallback)(struct __I2S_HandleTypeDef *hi2s);              /*!< I2S Error callback                 */
   void (* MspInitCallback)(struct __I2S_HandleTypeDef *hi2s);            /*!< I2S Msp Init callback              */
   void (* MspDeInitCallback)(struct __I2S_HandleTypeDef *hi2s);          /*!< I2S Msp DeInit callback            */
@@ -162,7 +211,9 @@ typedef enum
   HAL_I2S_TX_RX_HALF_COMPLETE_CB_ID     = 0x05UL,    /*!< I2S TxRx Half Completed callback ID  */
   HAL_I2S_ERROR_CB_ID                   = 0x06UL,    /*!< I2S Error callback ID                */
   HAL_I2S_MSPINIT_CB_ID                 = 0x07UL,    /*!< I2S Msp Init callback ID             */
-  HAL_I2S_MSPDEINIT_CB_ID               = 0x08UL     /*!< I2S Msp DeInit callback ID           */
+  HAL_I2S_MSPDEINIT_CB_ID               = 0x08UL,    /*!< I2S Msp DeInit callback ID           */
+  HAL_I2S_RX_M0_COMPLETE_CB_ID          = 0x09UL,    /*!< I2S Rx Memory 0 Completed callback ID */
+  HAL_I2S_RX_M1_COMPLETE_CB_ID          = 0x0AUL     /*!< I2S Rx Memory 1 Completed callback ID */
 
 } HAL_I2S_CallbackIDTypeDef;
 
@@ -199,6 +250,16 @@ typedef  void (*pI2S_CallbackTypeDef)(I2S_HandleTypeDef *hi2s); /*!< pointer to
   * @}
   */
 
+/** @defgroup I2S_Stream_Clock_Trim I2S Stream Clock Trim
+  * @{
+  */
+#define I2S_STREAM_TRIM_NONE             (0x00000000UL)  /*!< No clock trimming                 */
+#define I2S_STREAM_TRIM_PLL2             (0x00000001UL)  /*!< Trim the FRACN of PLL2 (PLL2P)    */
+#define I2S_STREAM_TRIM_PLL3             (0x00000002UL)  /*!< Trim the FRACN of PLL3 (PLL3P)    */
+/**
+  * @}
+  */
+
 /** @defgroup I2S_Mode I2S Mode
   * @{
   */
@@ -498,6 +559,8 @@ void HAL_I2S_IRQHandler(I2S_HandleTypeDef *hi2s);
 /* Non-Blocking mode: DMA */
 HAL_StatusTypeDef HAL_I2S_Transmit_DMA(I2S_HandleTypeDef *hi2s, const uint16_t *pData, uint16_t Size);
 HAL_StatusTypeDef HAL_I2S_Receive_DMA(I2S_HandleTypeDef *hi2s, uint16_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_I2S_ReceiveDoubleBuffer_DMA(I2S_HandleTypeDef *hi2s, uint16_t *pData0, uint16_t *pData1,
+                                                  uint16_t Size);
 HAL_StatusTypeDef HAL_I2SEx_TransmitReceive_DMA(I2S_HandleTypeDef *hi2s, const uint16_t *pTxData, uint16_t *pRxData,
                                                 uint16_t Size);
 
@@ -505,14 +568,23 @@ HAL_StatusTypeDef HAL_I2S_DMAPause(I2S_HandleTypeDef *hi2s);
 HAL_StatusTypeDef HAL_I2S_DMAResume(I2S_HandleTypeDef *hi2s);
 HAL_StatusTypeDef HAL_I2S_DMAStop(I2S_HandleTypeDef *hi2s);
 
+/* Period stream: full-duplex DMA in double buffer mode */
+HAL_StatusTypeDef HAL_I2SEx_StreamStart(I2S_HandleTypeDef *hi2s, I2S_StreamTypeDef *pStream);
+HAL_StatusTypeDef HAL_I2SEx_StreamStop(I2S_HandleTypeDef *hi2s);
+uint32_t HAL_I2SEx_StreamGetPosition(const I2S_HandleTypeDef *hi2s);
+HAL_StatusTypeDef HAL_I2SEx_StreamTrimClock(I2S_HandleTypeDef *hi2s, uint32_t RefPosition);
+
 /* Callbacks used in non blocking modes (Interrupt and DMA) *******************/
 void HAL_I2S_TxHalfCpltCallback(I2S_HandleTypeDef *hi2s);
 void HAL_I2S_TxCpltCallback(I2S_HandleTypeDef *hi2s);
 void HAL_I2S_RxHalfCpltCallback(I2S_HandleTypeDef *hi2s);
 void HAL_I2S_RxCpltCallback(I2S_HandleTypeDef *hi2s);
+void HAL_I2S_RxM0CpltCallback(I2S_HandleTypeDef *hi2s);
+void HAL_I2S_RxM1CpltCallback(I2S_HandleTypeDef *hi2s);
 void HAL_I2SEx_TxRxHalfCpltCallback(I2S_HandleTypeDef *hi2s);
 void HAL_I2SEx_TxRxCpltCallback(I2S_HandleTypeDef *hi2s);
 void HAL_I2S_ErrorCallback(I2S_HandleTypeDef *hi2s);
+void HAL_I2SEx_StreamPeriodCallback(I2S_HandleTypeDef *hi2s, uint32_t Period);
 /**
   * @}
   */
@@ -630,6 +702,12 @@ uint32_t HAL_I2S_GetError(const I2S_HandleTypeDef *hi2s);
 #define IS_I2S_CPOL(__CPOL__)                       (((__CPOL__) == I2S_CPOL_LOW)                        || \
                                                      ((__CPOL__) == I2S_CPOL_HIGH))
 
+#define IS_I2S_STREAM_CLOCK_TRIM(__TRIM__)          (((__TRIM__) == I2S_STREAM_TRIM_NONE)                || \
+                                                     ((__TRIM__) == I2S_STREAM_TRIM_PLL2)                || \
+                                                     ((__TRIM__) == I2S_STREAM_TRIM_PLL3))
+
+#define IS_I2S_STREAM_SHIFT(__SHIFT__)              ((__SHIFT__) <= 16UL)
+
 #define IS_I2S_FIRST_BIT(__BIT__)                   (((__BIT__) == I2S_FIRSTBIT_MSB)                     || \
                                                      ((__BIT__) == I2S_FIRSTBIT_LSB))
 
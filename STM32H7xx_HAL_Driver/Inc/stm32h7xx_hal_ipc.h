@@ -0,0 +1,253 @@
+/**
+  ******************************************************************************
+  * @file    stm32h7xx_hal_ipc.h
+  * @author  MCD Application Team
+  * @brief   Header file of inter-core message ring HAL module.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef STM32H7xx_HAL_IPC_H
+#define STM32H7xx_HAL_IPC_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32h7xx_hal_def.h"
+
+#if defined(DUAL_CORE)
+
+/** @addtogroup STM32H7xx_HAL_Driver
+  * @{
+  */
+
+/** @addtogroup IPC
+  * @{
+  */
+
+/* Exported constants --------------------------------------------------------*/
+/** @defgroup IPC_Exported_Constants IPC Exported Constants
+  * @{
+  */
+
+/** @defgroup IPC_Cache_Line IPC Cache Line
+  * @{
+  */
+#define IPC_CACHE_LINE_SIZE                 32U                       /*!< Cortex-M7 data cache line size (in bytes) */
+#define IPC_CACHE_LINE_WORDS                (IPC_CACHE_LINE_SIZE / 4U)
+/**
+  * @}
+  */
+
+/** @defgroup IPC_Role IPC Role
+  * @{
+  */
+#define IPC_ROLE_PRODUCER                   0x00000000U               /*!< The core writes the messages of the ring */
+#define IPC_ROLE_CONSUMER                   0x00000001U               /*!< The core reads the messages of the ring  */
+/**
+  * @}
+  */
+
+/** @defgroup IPC_ErrorCode IPC Error Code
+  * @{
+  */
+#define HAL_IPC_ERROR_NONE                  ((uint32_t)0x00000000U)   /*!< No error                                   */
+#define HAL_IPC_ERROR_PARAM                 ((uint32_t)0x00000001U)   /*!< Invalid parameter                          */
+#define HAL_IPC_ERROR_RING                  ((uint32_t)0x00000002U)   /*!< Ring not initialized by the producer core,
+                                                                           or initialized with other parameters       */
+#define HAL_IPC_ERROR_SIZE                  ((uint32_t)0x00000004U)   /*!< Message larger than the slot size          */
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/* Exported types ------------------------------------------------------------*/
+/** @defgroup IPC_Exported_Types IPC Exported Types
+  * @{
+  */
+
+/**
+  * @brief  HAL IPC State structure definition
+  */
+typedef enum
+{
+  HAL_IPC_STATE_RESET      = 0x00U,    /*!< Ring not yet initialized on this core            */
+  HAL_IPC_STATE_READY      = 0x01U     /*!< Ring initialized and ready for use on this core  */
+}HAL_IPC_StateTypeDef;
+
+/**
+  * @brief  IPC ring control block, shared by both cores
+  * @note   The producer and consumer indices lie in separate cache lines, so that
+  *         each core only writes its own line. The slots follow the control block.
+  */
+typedef struct
+{
+  __IO uint32_t Head;                              /*!< Number of messages written, updated by the producer only */
+  uint32_t      Reserved0[IPC_CACHE_LINE_WORDS - 1U];
+  __IO uint32_t Tail;                              /*!< Number of messages read, updated by the consumer only    */
+  uint32_t      Reserved1[IPC_CACHE_LINE_WORDS - 1U];
+  __IO uint32_t Magic;                             /*!< Set by the producer once the ring is initialized         */
+  __IO uint32_t SlotSize;                          /*!< Maximum message size (in bytes)                          */
+  __IO uint32_t NbSlots;                           /*!< Number of message slots                                  */
+  uint32_t      Reserved2[IPC_CACHE_LINE_WORDS - 3U];
+}IPC_RingTypeDef;
+
+/**
+  * @brief  IPC Init structure definition
+  */
+typedef struct
+{
+  uint32_t Role;                      /*!< Side of the ring handled by this core.
+                                           This parameter can be a value of @ref IPC_Role */
+
+  uint32_t SlotSize;                  /*!< Maximum message size (in bytes), a multiple of 4 */
+
+  uint32_t NbSlots;                   /*!< Number of message slots, a power of 2 from 2 to 65536 */
+
+  uint32_t DoorbellSemID;             /*!< Hardware semaphore released by the producer after each message,
+                                           its release notification interrupts the consumer core.
+                                           This parameter can be a value from 0 to HSEM_SEMID_MAX */
+}IPC_InitTypeDef;
+
+/**
+  * @brief  IPC handle Structure definition, one per core and per ring
+  */
+typedef struct
+{
+  IPC_RingTypeDef              *pRing;       /*!< Ring control block and slots, in the shared SRAM, of
+                                                  IPC_RING_SIZE() bytes and aligned on 32 bytes          */
+  IPC_InitTypeDef               Init;        /*!< Ring initialization parameters, identical on both cores */
+  uint8_t                      *pSlots;      /*!< First message slot                                     */
+  __IO HAL_IPC_StateTypeDef     State;       /*!< Ring state on this core                                */
+  __IO uint32_t                 ErrorCode;   /*!< Ring error code                                        */
+}IPC_HandleTypeDef;
+
+/**
+  * @}
+  */
+
+/* Exported macros -----------------------------------------------------------*/
+/** @defgroup IPC_Exported_Macros IPC Exported Macros
+  * @{
+  */
+
+/**
+  * @brief  Size of a message slot, length word included, rounded up to a cache line.
+  * @param  __SLOTSIZE__ Maximum message size (in bytes)
+  * @retval Slot size (in bytes)
+  */
+#define IPC_SLOT_STRIDE(__SLOTSIZE__)       ((((__SLOTSIZE__) + 4U) + (IPC_CACHE_LINE_SIZE - 1U)) & \
+                                             ~(IPC_CACHE_LINE_SIZE - 1U))
+
+/**
+  * @brief  Size of the shared memory of a ring.
+  * @param  __SLOTSIZE__ Maximum message size (in bytes)
+  * @param  __NBSLOTS__ Number of message slots
+  * @retval Ring size (in bytes)
+  */
+#define IPC_RING_SIZE(__SLOTSIZE__, __NBSLOTS__) ((uint32_t)sizeof(IPC_RingTypeDef) + \
+                                                  ((__NBSLOTS__) * IPC_SLOT_STRIDE(__SLOTSIZE__)))
+/**
+  * @}
+  */
+
+/* Exported functions --------------------------------------------------------*/
+/** @addtogroup IPC_Exported_Functions
+  * @{
+  */
+
+/** @addtogroup IPC_Exported_Functions_Group1
+  * @{
+  */
+/* Initialization/de-initialization functions  ********************************/
+HAL_StatusTypeDef     HAL_IPC_Init                  (IPC_HandleTypeDef *hipc);
+HAL_StatusTypeDef     HAL_IPC_DeInit                (IPC_HandleTypeDef *hipc);
+#if (__MPU_PRESENT == 1)
+void                  HAL_IPC_ConfigSharedMemory    (uint32_t BaseAddress, uint8_t Size, uint8_t Number);
+#endif /* __MPU_PRESENT */
+/**
+  * @}
+  */
+
+/** @addtogroup IPC_Exported_Functions_Group2
+  * @{
+  */
+/* IO operation functions *****************************************************/
+HAL_StatusTypeDef     HAL_IPC_Send                  (IPC_HandleTypeDef *hipc, const uint8_t *pData, uint32_t Size);
+HAL_StatusTypeDef     HAL_IPC_Receive               (IPC_HandleTypeDef *hipc, uint8_t *pData, uint32_t *pSize);
+uint32_t              HAL_IPC_GetPending            (IPC_HandleTypeDef *hipc);
+void                  HAL_IPC_IRQHandler            (IPC_HandleTypeDef *hipc, uint32_t SemMask);
+
+/* Callback functions *********************************************************/
+void                  HAL_IPC_RxNotifyCallback      (IPC_HandleTypeDef *hipc);
+/**
+  * @}
+  */
+
+/** @addtogroup IPC_Exported_Functions_Group3
+  * @{
+  */
+/* Peripheral State and Error functions ***************************************/
+HAL_IPC_StateTypeDef  HAL_IPC_GetState              (IPC_HandleTypeDef *hipc);
+uint32_t              HAL_IPC_GetError              (IPC_HandleTypeDef *hipc);
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/* Private constants ---------------------------------------------------------*/
+/** @defgroup IPC_Private_Constants IPC Private Constants
+  * @{
+  */
+#define IPC_RING_MAGIC                      0x49504352U               /* "IPCR" */
+/**
+  * @}
+  */
+
+/* Private macros ------------------------------------------------------------*/
+/** @defgroup IPC_Private_Macros IPC Private Macros
+  * @{
+  */
+#define IS_IPC_ROLE(__ROLE__)               (((__ROLE__) == IPC_ROLE_PRODUCER) || ((__ROLE__) == IPC_ROLE_CONSUMER))
+
+#define IS_IPC_SLOT_SIZE(__SIZE__)          (((__SIZE__) != 0U) && (((__SIZE__) & 3U) == 0U))
+
+#define IS_IPC_NB_SLOTS(__NB__)             (((__NB__) >= 2U) && ((__NB__) <= 65536U) && \
+                                             (((__NB__) & ((__NB__) - 1U)) == 0U))
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#endif /* DUAL_CORE */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STM32H7xx_HAL_IPC_H */
@@ -133,6 +133,8 @@ typedef struct
 
   __IO uint32_t Context;                     /*!< JPEG Internal context */
 
+  struct __JPEG_PipelineTypeDef *pPipeline;  /*!< Colour conversion pipeline of the ongoing decoding, NULL if none */
+
 #if (USE_HAL_JPEG_REGISTER_CALLBACKS == 1)
   void (*InfoReadyCallback)(struct __JPEG_HandleTypeDef *hjpeg,
                             JPEG_ConfTypeDef *pInfo);  /*!< JPEG Info ready callback      */
@@ -146,6 +148,8 @@ typedef struct
                           uint32_t NbDecodedData);     /*!< JPEG Get Data callback        */
   void (*DataReadyCallback)(struct __JPEG_HandleTypeDef *hjpeg, uint8_t *pDataOut,
                             uint32_t OutDataLength);   /*!< JPEG Data ready callback */
+  void (*PipelineCpltCallback)(struct __JPEG_HandleTypeDef
+                               *hjpeg);                        /*!< JPEG Pipeline complete callback */
 
   void (* MspInitCallback)(struct __JPEG_HandleTypeDef *hjpeg);                            /*!< JPEG Msp Init callback  */
   void (* MspDeInitCallback)(struct __JPEG_HandleTypeDef
@@ -173,7 +177,9 @@ typedef enum
   HAL_JPEG_ERROR_CB_ID          = 0x03U,    /*!< JPEG Error callback ID           */
 
   HAL_JPEG_MSPINIT_CB_ID        = 0x04U,    /*!< JPEG MspInit callback ID         */
-  HAL_JPEG_MSPDEINIT_CB_ID      = 0x05U     /*!< JPEG MspDeInit callback ID       */
+  HAL_JPEG_MSPDEINIT_CB_ID      = 0x05U,    /*!< JPEG MspDeInit callback ID       */
+
+  HAL_JPEG_PIPELINE_CPLT_CB_ID  = 0x06U     /*!< JPEG Pipeline Complete callback ID */
 
 } HAL_JPEG_CallbackIDTypeDef;
 /**
@@ -197,6 +203,60 @@ typedef  void (*pJPEG_DataReadyCallbackTypeDef)(JPEG_HandleTypeDef *hjpeg, uint8
 
 #endif /* USE_HAL_JPEG_REGISTER_CALLBACKS */
 
+#if defined(HAL_DMA2D_MODULE_ENABLED)
+/** @defgroup JPEG_Pipeline_Structure_definition JPEG decoding pipeline Structure definition
+  * @brief  JPEG to framebuffer decoding pipeline Structure definition
+  * @{
+  */
+typedef struct __JPEG_PipelineTypeDef
+{
+  DMA2D_HandleTypeDef      hdma2d;             /*!< DMA2D handle of the colour conversion, only its Instance is set
+                                                    by the application. It must stay the first member */
+
+  uint8_t                  *pChunkBuffer;      /*!< MCU buffer split in two chunks: the JPEG Out MDMA fills one chunk
+                                                    while the DMA2D converts the other one */
+
+  uint32_t                 ChunkBufferSize;    /*!< MCU buffer size in bytes, each half must hold a row of MCUs */
+
+  uint32_t                 FrameBufferAddress; /*!< Address of the top-left pixel of the image in the framebuffer */
+
+  uint32_t                 FrameBufferWidth;   /*!< Framebuffer line length in pixels */
+
+  uint32_t                 FrameBufferHeight;  /*!< Framebuffer number of lines */
+
+  uint32_t                 OutputColorMode;    /*!< Framebuffer pixel format.
+                                                    This parameter can be a value of @ref DMA2D_Output_Color_Mode */
+
+  JPEG_HandleTypeDef       *hjpeg;             /*!< Internal: JPEG handle of the ongoing decoding */
+
+  uint8_t                  *pInput;            /*!< Internal: next JPEG data sent to the JPEG In MDMA */
+
+  uint32_t                 InputLeft;          /*!< Internal: JPEG data left to send in bytes */
+
+  uint32_t                 ChunkSize;          /*!< Internal: chunk size in bytes, a whole number of rows of MCUs */
+
+  uint32_t                 StripeSize;         /*!< Internal: size of a row of MCUs in bytes */
+
+  uint32_t                 StripeLines;        /*!< Internal: number of lines of a row of MCUs */
+
+  uint32_t                 PixelSize;          /*!< Internal: framebuffer pixel size in bytes */
+
+  uint32_t                 CurrentLine;        /*!< Internal: next image line written by the DMA2D */
+
+  uint32_t                 ChunkLength[2];     /*!< Internal: number of bytes stored in each chunk */
+
+  uint32_t                 FillChunk;          /*!< Internal: chunk filled by the JPEG Out MDMA */
+
+  uint32_t                 PendingChunk;       /*!< Internal: filled chunk waiting for the DMA2D */
+
+  __IO uint32_t            ConvBusy;           /*!< Internal: DMA2D conversion ongoing */
+
+} JPEG_PipelineTypeDef;
+/**
+  * @}
+  */
+#endif /* HAL_DMA2D_MODULE_ENABLED */
+
 /**
   * @}
   */
@@ -220,6 +280,7 @@ typedef  void (*pJPEG_DataReadyCallbackTypeDef)(JPEG_HandleTypeDef *hjpeg, uint8
 #if (USE_HAL_JPEG_REGISTER_CALLBACKS == 1)
 #define  HAL_JPEG_ERROR_INVALID_CALLBACK ((uint32_t)0x00000010U)    /*!< Invalid Callback error  */
 #endif /* USE_HAL_JPEG_REGISTER_CALLBACKS */
+#define  HAL_JPEG_ERROR_PIPELINE    ((uint32_t)0x00000020U)    /*!< Colour conversion pipeline error */
 /**
   * @}
   */
@@ -508,6 +569,10 @@ HAL_StatusTypeDef  HAL_JPEG_Encode_DMA(JPEG_HandleTypeDef *hjpeg, uint8_t *pData
                                        uint8_t *pDataOut, uint32_t OutDataLength);
 HAL_StatusTypeDef  HAL_JPEG_Decode_DMA(JPEG_HandleTypeDef *hjpeg, uint8_t *pDataIn, uint32_t InDataLength,
                                        uint8_t *pDataOutMCU, uint32_t OutDataLength);
+#if defined(HAL_DMA2D_MODULE_ENABLED)
+HAL_StatusTypeDef  HAL_JPEG_PipelineDecode_DMA(JPEG_HandleTypeDef *hjpeg, JPEG_PipelineTypeDef *pPipeline,
+                                               uint8_t *pDataIn, uint32_t InDataLength);
+#endif /* HAL_DMA2D_MODULE_ENABLED */
 HAL_StatusTypeDef  HAL_JPEG_Pause(JPEG_HandleTypeDef *hjpeg, uint32_t XferSelection);
 HAL_StatusTypeDef  HAL_JPEG_Resume(JPEG_HandleTypeDef *hjpeg, uint32_t XferSelection);
 void HAL_JPEG_ConfigInputBuffer(JPEG_HandleTypeDef *hjpeg, uint8_t *pNewInputBuffer, uint32_t InDataLength);
@@ -528,6 +593,7 @@ void HAL_JPEG_DecodeCpltCallback(JPEG_HandleTypeDef *hjpeg);
 void HAL_JPEG_ErrorCallback(JPEG_HandleTypeDef *hjpeg);
 void HAL_JPEG_GetDataCallback(JPEG_HandleTypeDef *hjpeg, uint32_t NbDecodedData);
 void HAL_JPEG_DataReadyCallback(JPEG_HandleTypeDef *hjpeg, uint8_t *pDataOut, uint32_t OutDataLength);
+void HAL_JPEG_PipelineCpltCallback(JPEG_HandleTypeDef *hjpeg);
 
 /**
   * @}
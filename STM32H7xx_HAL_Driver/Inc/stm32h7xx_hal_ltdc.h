@@ -43,6 +43,7 @@ extern "C" {
   * @{
   */
 #define MAX_LAYER  2U
+#define LTDC_SWAPCHAIN_MAX_BUFFERS  3U  /*!< Maximum number of framebuffers of a swap chain */
 
 /**
   * @brief  LTDC color structure definition
@@ -176,6 +177,30 @@ typedef enum
   HAL_LTDC_STATE_ERROR             = 0x04U     /*!< LTDC state error                     */
 } HAL_LTDC_StateTypeDef;
 
+/**
+  * @brief  LTDC swap chain structure definition
+  */
+typedef struct
+{
+  uint32_t BufferAddress[LTDC_SWAPCHAIN_MAX_BUFFERS]; /*!< Framebuffers start addresses, with the layout configured
+                                                           by HAL_LTDC_ConfigLayer() */
+
+  uint32_t NbBuffers;                  /*!< Number of framebuffers, 2 (double buffering) or 3 (triple buffering) */
+
+  uint32_t LayerIdx;                   /*!< Layer displaying the framebuffers.
+                                            This parameter can be LTDC_LAYER_1 (0) or LTDC_LAYER_2 (1) */
+
+  __IO uint32_t Displayed;             /*!< Internal: framebuffer on screen                                  */
+
+  __IO uint32_t Queued;                /*!< Internal: framebuffer reloaded at the next vertical blanking     */
+
+  __IO uint32_t Pending;               /*!< Internal: framebuffer presented behind the queued one            */
+
+  __IO uint32_t FreeMask;              /*!< Internal: framebuffers free for rendering, one bit per buffer    */
+
+  __IO uint32_t FrameCount;            /*!< Number of framebuffers put on screen                             */
+} LTDC_SwapChainTypeDef;
+
 /**
   * @brief  LTDC handle Structure definition
   */
@@ -197,10 +222,13 @@ typedef struct
 
   __IO uint32_t               ErrorCode;                /*!< LTDC Error code                           */
 
+  LTDC_SwapChainTypeDef       *pSwapChain;              /*!< LTDC swap chain, NULL if none             */
+
 #if (USE_HAL_LTDC_REGISTER_CALLBACKS == 1)
   void (* LineEventCallback)(struct __LTDC_HandleTypeDef *hltdc);     /*!< LTDC Line Event Callback    */
   void (* ReloadEventCallback)(struct __LTDC_HandleTypeDef *hltdc);   /*!< LTDC Reload Event Callback  */
   void (* ErrorCallback)(struct __LTDC_HandleTypeDef *hltdc);         /*!< LTDC Error Callback         */
+  void (* SwapChainFreeCallback)(struct __LTDC_HandleTypeDef *hltdc); /*!< LTDC Swap Chain Free Callback */
 
   void (* MspInitCallback)(struct __LTDC_HandleTypeDef *hltdc);       /*!< LTDC Msp Init callback      */
   void (* MspDeInitCallback)(struct __LTDC_HandleTypeDef *hltdc);     /*!< LTDC Msp DeInit callback    */
@@ -221,7 +249,8 @@ typedef enum
 
   HAL_LTDC_LINE_EVENT_CB_ID         = 0x02U,    /*!< LTDC Line Event Callback ID    */
   HAL_LTDC_RELOAD_EVENT_CB_ID       = 0x03U,    /*!< LTDC Reload Callback ID        */
-  HAL_LTDC_ERROR_CB_ID              = 0x04U     /*!< LTDC Error Callback ID         */
+  HAL_LTDC_ERROR_CB_ID              = 0x04U,    /*!< LTDC Error Callback ID         */
+  HAL_LTDC_SWAPCHAIN_FREE_CB_ID     = 0x05U     /*!< LTDC Swap Chain Free Callback ID */
 
 } HAL_LTDC_CallbackIDTypeDef;
 
@@ -248,6 +277,7 @@ typedef  void (*pLTDC_CallbackTypeDef)(LTDC_HandleTypeDef *hltdc);  /*!< pointer
 #define HAL_LTDC_ERROR_TE                 0x00000001U   /*!< LTDC Transfer error       */
 #define HAL_LTDC_ERROR_FU                 0x00000002U   /*!< LTDC FIFO Underrun        */
 #define HAL_LTDC_ERROR_TIMEOUT            0x00000020U   /*!< LTDC Timeout error        */
+#define HAL_LTDC_ERROR_SWAPCHAIN          0x00000080U   /*!< LTDC Swap chain misuse    */
 #if (USE_HAL_LTDC_REGISTER_CALLBACKS == 1)
 #define  HAL_LTDC_ERROR_INVALID_CALLBACK  0x00000040U   /*!< LTDC Invalid Callback error  */
 #endif /* USE_HAL_LTDC_REGISTER_CALLBACKS */
@@ -631,6 +661,19 @@ uint32_t              HAL_LTDC_GetError(LTDC_HandleTypeDef *hltdc);
   * @}
   */
 
+/** @addtogroup LTDC_Exported_Functions_Group5
+  * @{
+  */
+/* Swap chain functions *******************************************************/
+HAL_StatusTypeDef HAL_LTDC_SwapChainInit(LTDC_HandleTypeDef *hltdc, LTDC_SwapChainTypeDef *pSwapChain);
+HAL_StatusTypeDef HAL_LTDC_SwapChainDeInit(LTDC_HandleTypeDef *hltdc);
+HAL_StatusTypeDef HAL_LTDC_SwapChainAcquire(LTDC_HandleTypeDef *hltdc, uint32_t *pIndex, uint32_t *pAddress);
+HAL_StatusTypeDef HAL_LTDC_SwapChainPresent(LTDC_HandleTypeDef *hltdc, uint32_t Index);
+void              HAL_LTDC_SwapChainFreeCallback(LTDC_HandleTypeDef *hltdc);
+/**
+  * @}
+  */
+
 /**
   * @}
   */
@@ -688,6 +731,7 @@ uint32_t              HAL_LTDC_GetError(LTDC_HandleTypeDef *hltdc);
 #define IS_LTDC_LIPOS(__LIPOS__)                       ((__LIPOS__) <= 0x7FFU)
 #define IS_LTDC_RELOAD(__RELOADTYPE__)                 (((__RELOADTYPE__) == LTDC_RELOAD_IMMEDIATE) || \
                                                         ((__RELOADTYPE__) == LTDC_RELOAD_VERTICAL_BLANKING))
+#define IS_LTDC_SWAPCHAIN_BUFFERS(__NB__)              (((__NB__) >= 2U) && ((__NB__) <= LTDC_SWAPCHAIN_MAX_BUFFERS))
 /**
   * @}
   */
@@ -71,6 +71,30 @@ typedef struct
                                        This parameter can be a value of @ref MDIOS_Preamble_Check */
 }MDIOS_InitTypeDef;
 
+/**
+  * @}
+  */
+
+/** @defgroup MDIOS_Exported_Types_Group3 MDIOS Register Mirror Structure definition
+  * @{
+  */
+
+typedef struct
+{
+  uint16_t       In[32];         /*!< Shadow of the DINn registers, updated from the interrupt each time
+                                      the master writes them                                            */
+
+  uint16_t       Out[32];        /*!< Shadow of the DOUTn registers, answered by the hardware to the
+                                      master reads once committed                                       */
+
+  __IO uint32_t  InChanged;      /*!< Bit map of the In registers written since the last
+                                      HAL_MDIOS_Mirror_GetChanged()                                     */
+
+  uint32_t       OutPending;     /*!< Bit map of the Out registers modified and not yet committed       */
+
+  __IO uint32_t  WriteCount;     /*!< Register writes of the master since the start                    */
+}MDIOS_MirrorTypeDef;
+
 /**
   * @}
   */
@@ -97,6 +121,8 @@ typedef struct
 
   HAL_LockTypeDef              Lock;          /*!< MDIOS Lock                  */
 
+  MDIOS_MirrorTypeDef          *pMirror;      /*!< Register mirror, NULL when not used */
+
 #if (USE_HAL_MDIOS_REGISTER_CALLBACKS == 1)
 
   void    (* WriteCpltCallback)  ( struct __MDIOS_HandleTypeDef * hmdios);   /*!< MDIOS Write Complete Callback */
@@ -520,6 +546,13 @@ void HAL_MDIOS_WriteCpltCallback(MDIOS_HandleTypeDef *hmdios);
 void HAL_MDIOS_ReadCpltCallback(MDIOS_HandleTypeDef *hmdios);
 void HAL_MDIOS_ErrorCallback(MDIOS_HandleTypeDef *hmdios);
 void HAL_MDIOS_WakeUpCallback(MDIOS_HandleTypeDef *hmdios);
+
+HAL_StatusTypeDef HAL_MDIOS_Mirror_Start(MDIOS_HandleTypeDef *hmdios, MDIOS_MirrorTypeDef *pMirror);
+HAL_StatusTypeDef HAL_MDIOS_Mirror_Stop(MDIOS_HandleTypeDef *hmdios);
+HAL_StatusTypeDef HAL_MDIOS_Mirror_SetReg(MDIOS_HandleTypeDef *hmdios, uint32_t RegNum, uint16_t Data);
+HAL_StatusTypeDef HAL_MDIOS_Mirror_Commit(MDIOS_HandleTypeDef *hmdios);
+uint32_t HAL_MDIOS_Mirror_GetChanged(MDIOS_HandleTypeDef *hmdios);
+void HAL_MDIOS_MirrorChangedCallback(MDIOS_HandleTypeDef *hmdios);
 /**
   * @}
   */
@@ -196,6 +196,37 @@ typedef enum
 }HAL_MDMA_CallbackIDTypeDef;
 
 
+/**
+  * @brief  MDMA memory copy request structure definition
+  * @note   A request is owned by the MDMA copy service from its submission with
+  *         HAL_MDMAEx_Memcpy_Async()/HAL_MDMAEx_Memset_Async() until its State
+  *         leaves HAL_MDMA_COPY_STATE_PENDING: it must not be modified nor
+  *         released by the application in between.
+  */
+typedef struct __MDMA_CopyRequestTypeDef
+{
+  uint32_t      Pattern[2];                                                   /*!< Fill pattern used as fixed source for memset,
+                                                                                   first member so that an 8-byte aligned
+                                                                                   request allows double word fills         */
+
+  uint32_t      SrcAddress;                                                   /*!< Source address (unused for memset)              */
+
+  uint32_t      DstAddress;                                                   /*!< Destination address                             */
+
+  uint32_t      Size;                                                         /*!< Number of bytes to be written at DstAddress     */
+
+  uint32_t      Offset;                                                       /*!< Number of bytes already transferred (internal)  */
+
+  __IO uint32_t State;                                                        /*!< Request state, a value of @ref MDMA_Copy_State  */
+
+  void          (* XferCpltCallback)(struct __MDMA_CopyRequestTypeDef *pReq); /*!< Request completion callback (may be NULL),
+                                                                                   called from the MDMA interrupt once the
+                                                                                   request is done or in error              */
+
+  struct __MDMA_CopyRequestTypeDef *pNext;                                    /*!< Next pending request (internal)                 */
+
+} MDMA_CopyRequestTypeDef;
+
 /**
   * @brief  MDMA handle Structure definition
   */
@@ -236,6 +267,10 @@ typedef struct __MDMA_HandleTypeDef
                                                                                                 */
   uint32_t LinkedListNodeCounter;                                                               /*!< Number of nodes in the MDMA linked list */
 
+  MDMA_CopyRequestTypeDef *pCopyHead;                                                          /*!< Copy service request being transferred   */
+
+  MDMA_CopyRequestTypeDef *pCopyTail;                                                          /*!< Last pending copy service request        */
+
   __IO uint32_t          ErrorCode;                                                            /*!< MDMA Error code                        */
 
 } MDMA_HandleTypeDef;
@@ -266,6 +301,19 @@ typedef struct __MDMA_HandleTypeDef
 #define HAL_MDMA_ERROR_NO_XFER     ((uint32_t)0x00000080U)   /*!< Abort or SW trigger requested with no Xfer ongoing   */
 #define HAL_MDMA_ERROR_BUSY        ((uint32_t)0x00000100U)   /*!< DeInit or SW trigger requested with Xfer ongoing   */
 
+/**
+  * @}
+  */
+
+/** @defgroup MDMA_Copy_State MDMA Copy Request State
+  * @brief    MDMA memory copy service request states
+  * @{
+  */
+#define HAL_MDMA_COPY_STATE_RESET    ((uint32_t)0x00000000U)   /*!< Request not submitted yet                */
+#define HAL_MDMA_COPY_STATE_PENDING  ((uint32_t)0x00000001U)   /*!< Request queued or being transferred      */
+#define HAL_MDMA_COPY_STATE_DONE     ((uint32_t)0x00000002U)   /*!< Request completed, destination coherent  */
+#define HAL_MDMA_COPY_STATE_ERROR    ((uint32_t)0x00000003U)   /*!< Request aborted on a transfer error      */
+
 /**
   * @}
   */
@@ -672,6 +720,7 @@ HAL_StatusTypeDef HAL_MDMA_LinkedList_DisableCircularMode(MDMA_HandleTypeDef *hm
   */
 HAL_StatusTypeDef HAL_MDMA_Start (MDMA_HandleTypeDef *hmdma, uint32_t SrcAddress, uint32_t DstAddress, uint32_t BlockDataLength, uint32_t BlockCount);
 HAL_StatusTypeDef HAL_MDMA_Start_IT(MDMA_HandleTypeDef *hmdma, uint32_t SrcAddress, uint32_t DstAddress, uint32_t BlockDataLength, uint32_t BlockCount);
+HAL_StatusTypeDef HAL_MDMA_ReArm_IT(MDMA_HandleTypeDef *hmdma, uint32_t SrcAddress, uint32_t DstAddress, uint32_t BlockDataLength);
 HAL_StatusTypeDef HAL_MDMA_Abort(MDMA_HandleTypeDef *hmdma);
 HAL_StatusTypeDef HAL_MDMA_Abort_IT(MDMA_HandleTypeDef *hmdma);
 HAL_StatusTypeDef HAL_MDMA_PollForTransfer(MDMA_HandleTypeDef *hmdma, HAL_MDMA_LevelCompleteTypeDef CompleteLevel, uint32_t Timeout);
@@ -690,6 +739,19 @@ void HAL_MDMA_IRQHandler(MDMA_HandleTypeDef *hmdma);
 HAL_MDMA_StateTypeDef HAL_MDMA_GetState(MDMA_HandleTypeDef *hmdma);
 uint32_t              HAL_MDMA_GetError(MDMA_HandleTypeDef *hmdma);
 
+/**
+  * @}
+  */
+
+/* Memory copy service functions **********************************************/
+/** @defgroup MDMA_Exported_Functions_Group5 Memory copy service functions
+  * @brief    Memory copy service functions
+  * @{
+  */
+HAL_StatusTypeDef HAL_MDMAEx_Memcpy_Async(MDMA_HandleTypeDef *hmdma, MDMA_CopyRequestTypeDef *pReq, uint32_t DstAddress, uint32_t SrcAddress, uint32_t Size);
+HAL_StatusTypeDef HAL_MDMAEx_Memset_Async(MDMA_HandleTypeDef *hmdma, MDMA_CopyRequestTypeDef *pReq, uint32_t DstAddress, uint8_t Value, uint32_t Size);
+HAL_StatusTypeDef HAL_MDMAEx_Copy_PollForCompletion(MDMA_CopyRequestTypeDef *pReq, uint32_t Timeout);
+
 /**
   * @}
   */
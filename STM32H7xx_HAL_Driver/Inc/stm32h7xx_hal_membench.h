@@ -0,0 +1,262 @@
+/**
+  ******************************************************************************
+  * @file    stm32h7xx_hal_membench.h
+  * @author  MCD Application Team
+  * @brief   Header file of memory benchmark HAL module.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef STM32H7xx_HAL_MEMBENCH_H
+#define STM32H7xx_HAL_MEMBENCH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32h7xx_hal_def.h"
+
+/** @addtogroup STM32H7xx_HAL_Driver
+  * @{
+  */
+
+/** @addtogroup MEMBENCH
+  * @{
+  */
+
+#ifndef MEMBENCH_MAX_TRANSFERS
+#define MEMBENCH_MAX_TRANSFERS              4U
+#endif /* MEMBENCH_MAX_TRANSFERS */
+
+/* Exported types ------------------------------------------------------------*/
+/** @defgroup MEMBENCH_Exported_Types MEMBENCH Exported Types
+  * @{
+  */
+
+/**
+  * @brief  MEMBENCH memory region structure definition
+  */
+typedef struct
+{
+  uint32_t            BaseAddress;        /*!< First address of the region, from the CMSIS device header     */
+
+  uint32_t            Size;               /*!< Size of the region in bytes, 0 for an external memory whose
+                                               size depends on the device connected                         */
+
+  uint32_t            Attributes;         /*!< Attributes of the region, combination of
+                                               @ref MEMBENCH_Region_Attributes                              */
+} MEMBENCH_RegionTypeDef;
+
+/**
+  * @brief  MEMBENCH CPU benchmark structure definition
+  * @note   The fields up to Tests are set by the application, the cycles are
+  *         measured with the DWT cycle counter, 0 for a test not run.
+  */
+typedef struct
+{
+  uint32_t            Address;            /*!< First address of the tested area, aligned on 32 bytes        */
+
+  uint32_t            Size;               /*!< Size of the tested area in bytes, multiple of 32 bytes and at
+                                               least MEMBENCH_MIN_SIZE                                      */
+
+  uint32_t            Tests;              /*!< Tests to run, combination of @ref MEMBENCH_Cpu_Tests         */
+
+  uint32_t            SeqReadCycles;      /*!< Cycles of the sequential read of Size bytes                  */
+
+  uint32_t            SeqWriteCycles;     /*!< Cycles of the sequential write of Size bytes                 */
+
+  uint32_t            RandReadCycles;     /*!< Cycles of RandAccesses dependent reads at random addresses,
+                                               RandReadCycles / RandAccesses being the load latency         */
+
+  uint32_t            RandWriteCycles;    /*!< Cycles of RandAccesses writes at random addresses            */
+
+  uint32_t            RandAccesses;       /*!< Number of random accesses, one per 32-byte line of the
+                                               largest power of 2 size within Size                          */
+} MEMBENCH_CpuTypeDef;
+
+/**
+  * @brief  MEMBENCH DMA transfer structure definition
+  * @note   Exactly one of hdma and hmdma is set. The channel is initialized by
+  *         the application in memory to memory mode, normal (not circular) mode.
+  */
+typedef struct
+{
+#if defined(HAL_DMA_MODULE_ENABLED)
+  DMA_HandleTypeDef   *hdma;              /*!< DMA1, DMA2 or BDMA channel, NULL when hmdma is used          */
+
+#endif /* HAL_DMA_MODULE_ENABLED */
+#if defined(HAL_MDMA_MODULE_ENABLED)
+  MDMA_HandleTypeDef  *hmdma;             /*!< MDMA channel initialized for software triggered block
+                                               transfers, NULL when hdma is used                            */
+
+#endif /* HAL_MDMA_MODULE_ENABLED */
+  const void          *pSrc;              /*!< Source buffer of Size bytes                                  */
+
+  void                *pDst;              /*!< Destination buffer of Size bytes                             */
+
+  uint32_t            Size;               /*!< Number of bytes of a transfer, multiple of the data width and
+                                               up to MEMBENCH_MAX_TRANSFER_SIZE                             */
+
+  uint32_t            Cycles;             /*!< Cycles of one transfer, set by HAL_MEMBENCH_MeasureDma()     */
+
+  __IO uint32_t       Transfers;          /*!< Transfers completed during the CPU tests, set by
+                                               HAL_MEMBENCH_MeasureContention()                             */
+} MEMBENCH_TransferTypeDef;
+
+/**
+  * @brief  MEMBENCH contention benchmark structure definition
+  * @note   The transfers are restarted from their transfer complete interrupt
+  *         as long as the CPU tests run, each DMA or MDMA channel interrupt
+  *         calling HAL_DMA_IRQHandler() or HAL_MDMA_IRQHandler().
+  */
+typedef struct
+{
+  MEMBENCH_CpuTypeDef       Cpu;                                /*!< CPU tests run under load            */
+
+  MEMBENCH_TransferTypeDef  Transfer[MEMBENCH_MAX_TRANSFERS];   /*!< Transfers loading the buses         */
+
+  uint32_t                  NbTransfers;                        /*!< Number of transfers, from 0 to
+                                                                     MEMBENCH_MAX_TRANSFERS              */
+
+  uint32_t                  Cycles;                             /*!< Cycles of the loaded CPU tests,
+                                                                     giving the transfers throughput     */
+} MEMBENCH_ContentionTypeDef;
+
+/**
+  * @}
+  */
+
+/* Exported constants --------------------------------------------------------*/
+/** @defgroup MEMBENCH_Exported_Constants MEMBENCH Exported Constants
+  * @{
+  */
+
+/** @defgroup MEMBENCH_Regions MEMBENCH Regions
+  * @{
+  */
+#define MEMBENCH_REGION_ITCM                0U    /*!< Instruction TCM, CPU and MDMA only                    */
+#define MEMBENCH_REGION_DTCM                1U    /*!< Data TCM, CPU and MDMA only                           */
+#define MEMBENCH_REGION_AXISRAM1            2U    /*!< AXI SRAM (AXI SRAM1 when split)                       */
+#define MEMBENCH_REGION_AXISRAM2            3U    /*!< AXI SRAM2, STM32H72xxx/H73xxx/H7Axxx/H7Bxxx lines     */
+#define MEMBENCH_REGION_AXISRAM3            4U    /*!< AXI SRAM3, STM32H7Axxx/H7Bxxx lines                   */
+#define MEMBENCH_REGION_SRAM1               5U    /*!< AHB SRAM1 (D2 or CD domain)                           */
+#define MEMBENCH_REGION_SRAM2               6U    /*!< AHB SRAM2 (D2 or CD domain)                           */
+#define MEMBENCH_REGION_SRAM3               7U    /*!< AHB SRAM3, STM32H74xxx/H75xxx lines                   */
+#define MEMBENCH_REGION_SRAM4               8U    /*!< SRAM4 (D3 or SRD domain)                              */
+#define MEMBENCH_REGION_BKPSRAM             9U    /*!< Backup SRAM                                           */
+#define MEMBENCH_REGION_FLASH               10U   /*!< Embedded flash memory                                 */
+#define MEMBENCH_REGION_XSPI1               11U   /*!< QUADSPI or OCTOSPI1 memory-mapped area                */
+#define MEMBENCH_REGION_XSPI2               12U   /*!< OCTOSPI2 memory-mapped area                           */
+#define MEMBENCH_REGION_FMC_NOR_SRAM        13U   /*!< FMC NOR/PSRAM/SRAM bank 1                             */
+#define MEMBENCH_REGION_FMC_SDRAM           14U   /*!< FMC SDRAM bank 1                                      */
+#define MEMBENCH_REGIONS_NBR                15U   /*!< Number of regions                                     */
+/**
+  * @}
+  */
+
+/** @defgroup MEMBENCH_Region_Attributes MEMBENCH Region Attributes
+  * @{
+  */
+#define MEMBENCH_REGION_ATTR_NONE           0x00000000U   /*!< None of the attributes below                  */
+#define MEMBENCH_REGION_ATTR_READONLY       0x00000001U   /*!< Not written by the CPU tests                  */
+#define MEMBENCH_REGION_ATTR_EXTERNAL       0x00000002U   /*!< External memory, to be set up first           */
+#define MEMBENCH_REGION_ATTR_NO_DMA         0x00000004U   /*!< Not reachable by DMA1, DMA2 and BDMA          */
+#define MEMBENCH_REGION_ATTR_NO_BDMA        0x00000008U   /*!< Not reachable by BDMA                         */
+/**
+  * @}
+  */
+
+/** @defgroup MEMBENCH_Cpu_Tests MEMBENCH CPU Tests
+  * @{
+  */
+#define MEMBENCH_TEST_SEQ_READ              0x00000001U   /*!< Sequential read                               */
+#define MEMBENCH_TEST_SEQ_WRITE             0x00000002U   /*!< Sequential write                              */
+#define MEMBENCH_TEST_RAND_READ             0x00000004U   /*!< Dependent reads at random addresses           */
+#define MEMBENCH_TEST_RAND_WRITE            0x00000008U   /*!< Writes at random addresses                    */
+#define MEMBENCH_TEST_READ                  (MEMBENCH_TEST_SEQ_READ | MEMBENCH_TEST_RAND_READ)
+#define MEMBENCH_TEST_ALL                   (MEMBENCH_TEST_SEQ_READ | MEMBENCH_TEST_SEQ_WRITE | \
+                                             MEMBENCH_TEST_RAND_READ | MEMBENCH_TEST_RAND_WRITE)
+/**
+  * @}
+  */
+
+/** @defgroup MEMBENCH_Sizes MEMBENCH Sizes
+  * @{
+  */
+#define MEMBENCH_LINE_SIZE                  32U           /*!< Cache line size, granularity of the tests     */
+#define MEMBENCH_MIN_SIZE                   (2U * MEMBENCH_LINE_SIZE) /*!< Smallest tested area              */
+#define MEMBENCH_MAX_TRANSFER_SIZE          65536U        /*!< Largest transfer: one MDMA block, or 65535
+                                                               DMA data items                              */
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/* Exported functions --------------------------------------------------------*/
+/** @addtogroup MEMBENCH_Exported_Functions
+  * @{
+  */
+
+/** @addtogroup MEMBENCH_Exported_Functions_Group1
+  * @{
+  */
+/* Memory region functions  ***************************************************/
+HAL_StatusTypeDef HAL_MEMBENCH_GetRegion(uint32_t Region, MEMBENCH_RegionTypeDef *pRegion);
+uint32_t          HAL_MEMBENCH_GetBandwidth(uint32_t Bytes, uint32_t Cycles);
+/**
+  * @}
+  */
+
+/** @addtogroup MEMBENCH_Exported_Functions_Group2
+  * @{
+  */
+/* Benchmark functions  *******************************************************/
+HAL_StatusTypeDef HAL_MEMBENCH_MeasureCpu(MEMBENCH_CpuTypeDef *pCpu);
+HAL_StatusTypeDef HAL_MEMBENCH_MeasureDma(MEMBENCH_TransferTypeDef *pTransfer, uint32_t Timeout);
+HAL_StatusTypeDef HAL_MEMBENCH_MeasureContention(MEMBENCH_ContentionTypeDef *pContention, uint32_t Timeout);
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/* Private macros ------------------------------------------------------------*/
+/** @defgroup MEMBENCH_Private_Macros MEMBENCH Private Macros
+  * @{
+  */
+#define IS_MEMBENCH_REGION(__REGION__)      ((__REGION__) < MEMBENCH_REGIONS_NBR)
+
+#define IS_MEMBENCH_TESTS(__TESTS__)        ((((__TESTS__) & ~MEMBENCH_TEST_ALL) == 0U) && ((__TESTS__) != 0U))
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STM32H7xx_HAL_MEMBENCH_H */
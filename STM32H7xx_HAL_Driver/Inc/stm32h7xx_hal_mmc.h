@@ -106,6 +106,17 @@ typedef struct
 
 } HAL_MMC_CardInfoTypeDef;
 
+/**
+  * @brief  MMC packed write entry Structure definition
+  */
+typedef struct
+{
+  uint32_t BlockAdd;                     /*!< Specifies the block address of the write        */
+
+  uint32_t NumberOfBlocks;               /*!< Specifies the number of blocks of the write     */
+
+} HAL_MMC_PackedEntryTypeDef;
+
 /**
   * @brief  MMC handle Structure definition
   */
@@ -143,6 +154,12 @@ typedef struct
 
   uint32_t                     Ext_CSD[128];
 
+  __IO uint32_t                DblBufRemainingBlocks; /*!< MMC double buffer blocks left to transfer */
+
+  uint32_t                     DblBufBlockAdd;        /*!< MMC double buffer next block address      */
+
+  uint32_t                     DblBufSegmentBlocks;   /*!< MMC double buffer blocks per command      */
+
 #if defined (USE_HAL_MMC_REGISTER_CALLBACKS) && (USE_HAL_MMC_REGISTER_CALLBACKS == 1U)
   void (* TxCpltCallback)(struct __MMC_HandleTypeDef *hmmc);
   void (* RxCpltCallback)(struct __MMC_HandleTypeDef *hmmc);
@@ -328,8 +345,10 @@ typedef void (*pMMC_CallbackTypeDef)(MMC_HandleTypeDef *hmmc);
 #define   MMC_CONTEXT_READ_MULTIPLE_BLOCK  ((uint32_t)0x00000002U)  /*!< Read multiple blocks operation   */
 #define   MMC_CONTEXT_WRITE_SINGLE_BLOCK   ((uint32_t)0x00000010U)  /*!< Write single block operation     */
 #define   MMC_CONTEXT_WRITE_MULTIPLE_BLOCK ((uint32_t)0x00000020U)  /*!< Write multiple blocks operation  */
+#define   MMC_CONTEXT_DOUBLE_BUFFER        ((uint32_t)0x00000004U)  /*!< Double buffer DMA operation      */
 #define   MMC_CONTEXT_IT                   ((uint32_t)0x00000008U)  /*!< Process in Interrupt mode        */
 #define   MMC_CONTEXT_DMA                  ((uint32_t)0x00000080U)  /*!< Process in DMA mode              */
+#define   MMC_CONTEXT_BLOCK_COUNT          ((uint32_t)0x00000040U)  /*!< Block count set by CMD23, no CMD12 */
 
 /**
   * @}
@@ -662,6 +681,11 @@ HAL_StatusTypeDef HAL_MMC_ReadBlocks_DMA(MMC_HandleTypeDef *hmmc, uint8_t *pData
                                          uint32_t NumberOfBlocks);
 HAL_StatusTypeDef HAL_MMC_WriteBlocks_DMA(MMC_HandleTypeDef *hmmc, const uint8_t *pData, uint32_t BlockAdd,
                                           uint32_t NumberOfBlocks);
+HAL_StatusTypeDef HAL_MMC_ReadBlocks_DMADoubleBuffer(MMC_HandleTypeDef *hmmc, uint8_t *pData0, uint8_t *pData1,
+                                                     uint32_t BufferSize, uint32_t BlockAdd, uint32_t NumberOfBlocks);
+HAL_StatusTypeDef HAL_MMC_WriteBlocks_DMADoubleBuffer(MMC_HandleTypeDef *hmmc, const uint8_t *pData0,
+                                                      const uint8_t *pData1, uint32_t BufferSize, uint32_t BlockAdd,
+                                                      uint32_t NumberOfBlocks);
 
 void HAL_MMC_IRQHandler(MMC_HandleTypeDef *hmmc);
 
@@ -740,6 +764,17 @@ HAL_StatusTypeDef HAL_MMC_AwakeDevice(MMC_HandleTypeDef *hmmc);
 /**
   * @}
   */
+
+/** @defgroup MMC_Exported_Functions_Group9 Cache and packed commands management
+  * @{
+  */
+HAL_StatusTypeDef HAL_MMC_ConfigCache(MMC_HandleTypeDef *hmmc, FunctionalState State);
+HAL_StatusTypeDef HAL_MMC_FlushCache(MMC_HandleTypeDef *hmmc);
+HAL_StatusTypeDef HAL_MMC_WritePacked_DMA(MMC_HandleTypeDef *hmmc, uint8_t *pData,
+                                          const HAL_MMC_PackedEntryTypeDef *pEntries, uint32_t NbEntries);
+/**
+  * @}
+  */
 /* Private types -------------------------------------------------------------*/
 /** @defgroup MMC_Private_Types MMC Private Types
   * @{
@@ -755,6 +790,11 @@ HAL_StatusTypeDef HAL_MMC_AwakeDevice(MMC_HandleTypeDef *hmmc);
   */
 #define MMC_EXT_CSD_DATA_SEC_SIZE_INDEX 61
 #define MMC_EXT_CSD_DATA_SEC_SIZE_POS   8
+#define MMC_EXT_CSD_CACHE_CTRL_INDEX    33
+#define MMC_EXT_CSD_CACHE_CTRL_POS      8
+#define MMC_EXT_CSD_CACHE_SIZE_INDEX    249
+#define MMC_EXT_CSD_MAX_PACKED_WR_INDEX 501
+#define MMC_EXT_CSD_MAX_PACKED_WR_POS   8
 /**
   * @}
   */
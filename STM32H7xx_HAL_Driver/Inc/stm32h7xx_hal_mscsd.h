@@ -0,0 +1,235 @@
+/**
+  ******************************************************************************
+  * @file    stm32h7xx_hal_mscsd.h
+  * @author  MCD Application Team
+  * @brief   Header file of USB mass storage to SD card bridge HAL module.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef STM32H7xx_HAL_MSCSD_H
+#define STM32H7xx_HAL_MSCSD_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32h7xx_hal_def.h"
+
+#if defined(HAL_SD_MODULE_ENABLED) && defined(HAL_PCD_MODULE_ENABLED)
+
+/** @addtogroup STM32H7xx_HAL_Driver
+  * @{
+  */
+
+/** @addtogroup MSCSD
+  * @{
+  */
+
+#ifndef MSCSD_MAX_BUFFERS
+#define MSCSD_MAX_BUFFERS                   8U
+#endif /* MSCSD_MAX_BUFFERS */
+
+/* Exported types ------------------------------------------------------------*/
+/** @defgroup MSCSD_Exported_Types MSCSD Exported Types
+  * @{
+  */
+
+/**
+  * @brief  HAL MSCSD State structure definition
+  */
+typedef enum
+{
+  HAL_MSCSD_STATE_RESET      = 0x00U,    /*!< Bridge not yet initialized                       */
+  HAL_MSCSD_STATE_READY      = 0x01U,    /*!< Bridge initialized, no read command on going     */
+  HAL_MSCSD_STATE_BUSY       = 0x02U,    /*!< Data of a read command being sent to the host    */
+  HAL_MSCSD_STATE_ERROR      = 0x03U     /*!< SD or USB error, bridge stopped                  */
+}HAL_MSCSD_StateTypeDef;
+
+/**
+  * @brief  MSCSD Init structure definition
+  */
+typedef struct
+{
+  SD_HandleTypeDef  *hsd;             /*!< SD handle, initialized by the application with HAL_SD_Init(), the card
+                                           being in transfer state                                               */
+
+  PCD_HandleTypeDef *hpcd;            /*!< PCD handle of the USB device, the bulk IN endpoint being opened by the
+                                           mass storage class                                                    */
+
+  uint8_t           EpIn;             /*!< Address of the bulk IN endpoint of the mass storage interface (0x81) */
+
+  uint8_t           *pPool;           /*!< Ring of NbBuffers buffers of BufferBlocks blocks, shared by the SDMMC
+                                           internal DMA and the USB endpoint                                     */
+
+  uint32_t          NbBuffers;        /*!< Number of buffers of the ring, power of 2 from 2 to MSCSD_MAX_BUFFERS */
+
+  uint32_t          BufferBlocks;     /*!< Number of 512-byte blocks of each buffer, from 1 to
+                                           MSCSD_MAX_BUFFER_BLOCKS                                               */
+
+  uint32_t          ReadAhead;        /*!< Number of blocks read after the last block of a read command, served
+                                           to the next command when it follows, 0 to disable the read-ahead     */
+}MSCSD_InitTypeDef;
+
+/**
+  * @brief  MSCSD handle Structure definition
+  * @note   The buffers are used in sequence: from Tail to Fill they are filled and sent to the host, from
+  *         Fill to Head they are given to the SDMMC internal DMA, from Head to Tail + NbBuffers they are free.
+  */
+typedef struct
+{
+  MSCSD_InitTypeDef              Init;                           /*!< Bridge configuration parameters            */
+
+  uint32_t                       BufBlocks[MSCSD_MAX_BUFFERS];   /*!< Blocks read into each filled buffer        */
+
+  __IO uint32_t                  Tail;                           /*!< Buffer being sent to the host              */
+
+  __IO uint32_t                  Fill;                           /*!< Buffer being filled by the SD card         */
+
+  __IO uint32_t                  Head;                           /*!< Next free buffer                           */
+
+  uint32_t                       TailOffset;                     /*!< Blocks of the Tail buffer already sent     */
+
+  uint32_t                       NextLba;                        /*!< Block sent at the start of the Tail offset */
+
+  uint32_t                       SdLba;                          /*!< First block of the Fill buffer             */
+
+  __IO uint32_t                  SdBlocks;                       /*!< Blocks left in the running card transfer   */
+
+  uint32_t                       SdBuffer;                       /*!< Internal DMA buffer completing next        */
+
+  __IO uint32_t                  Pending;                        /*!< Blocks to read after the running transfer  */
+
+  __IO uint32_t                  CmdBlocks;                      /*!< Blocks of the read command left to send    */
+
+  __IO uint32_t                  UsbBlocks;                      /*!< Blocks of the on going endpoint transfer   */
+
+  __IO uint32_t                  HitCount;                       /*!< Read commands served from the read-ahead   */
+
+  __IO uint32_t                  RestartCount;                   /*!< Card transfers restarted by a stall or a
+                                                                      non sequential read command              */
+
+  __IO HAL_MSCSD_StateTypeDef    State;                          /*!< Bridge state                               */
+
+  __IO uint32_t                  ErrorCode;                      /*!< Bridge error code                          */
+}MSCSD_HandleTypeDef;
+
+/**
+  * @}
+  */
+
+/* Exported constants --------------------------------------------------------*/
+/** @defgroup MSCSD_Exported_Constants MSCSD Exported Constants
+  * @{
+  */
+
+/** @defgroup MSCSD_ErrorCode MSCSD Error Code
+  * @{
+  */
+#define HAL_MSCSD_ERROR_NONE                ((uint32_t)0x00000000U)   /*!< No error                                    */
+#define HAL_MSCSD_ERROR_PARAM               ((uint32_t)0x00000001U)   /*!< Invalid parameter or block out of the card  */
+#define HAL_MSCSD_ERROR_SD                  ((uint32_t)0x00000002U)   /*!< SD error, see the ErrorCode of the SD handle */
+#define HAL_MSCSD_ERROR_USB                 ((uint32_t)0x00000004U)   /*!< Endpoint transfer could not be started      */
+/**
+  * @}
+  */
+
+/** @defgroup MSCSD_Ring_Size MSCSD Ring Size
+  * @{
+  */
+#define MSCSD_BLOCK_SIZE                    512U                      /*!< SD card and mass storage block size      */
+#define MSCSD_MAX_BUFFER_BLOCKS             (SDMMC_IDMABSIZE_IDMABNDT / MSCSD_BLOCK_SIZE) /*!< Internal DMA buffer
+                                                                                               size limit        */
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/* Exported functions --------------------------------------------------------*/
+/** @addtogroup MSCSD_Exported_Functions
+  * @{
+  */
+
+/** @addtogroup MSCSD_Exported_Functions_Group1
+  * @{
+  */
+/* Initialization/de-initialization functions  ********************************/
+HAL_StatusTypeDef     HAL_MSCSD_Init                (MSCSD_HandleTypeDef *hmscsd);
+HAL_StatusTypeDef     HAL_MSCSD_DeInit              (MSCSD_HandleTypeDef *hmscsd);
+/**
+  * @}
+  */
+
+/** @addtogroup MSCSD_Exported_Functions_Group2
+  * @{
+  */
+/* IO operation functions *****************************************************/
+HAL_StatusTypeDef     HAL_MSCSD_Read                (MSCSD_HandleTypeDef *hmscsd, uint32_t Lba, uint32_t Blocks);
+HAL_StatusTypeDef     HAL_MSCSD_Flush               (MSCSD_HandleTypeDef *hmscsd);
+void                  HAL_MSCSD_SD_BufferCpltHandler(MSCSD_HandleTypeDef *hmscsd);
+void                  HAL_MSCSD_SD_CpltHandler      (MSCSD_HandleTypeDef *hmscsd);
+void                  HAL_MSCSD_SD_ErrorHandler     (MSCSD_HandleTypeDef *hmscsd);
+void                  HAL_MSCSD_PCD_DataInHandler   (MSCSD_HandleTypeDef *hmscsd, uint8_t epnum);
+
+/* Callback functions *********************************************************/
+void                  HAL_MSCSD_ReadCpltCallback    (MSCSD_HandleTypeDef *hmscsd);
+void                  HAL_MSCSD_ErrorCallback       (MSCSD_HandleTypeDef *hmscsd);
+/**
+  * @}
+  */
+
+/** @addtogroup MSCSD_Exported_Functions_Group3
+  * @{
+  */
+/* Peripheral State and Error functions ***************************************/
+HAL_MSCSD_StateTypeDef HAL_MSCSD_GetState           (MSCSD_HandleTypeDef *hmscsd);
+uint32_t              HAL_MSCSD_GetError            (MSCSD_HandleTypeDef *hmscsd);
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/* Private macros ------------------------------------------------------------*/
+/** @defgroup MSCSD_Private_Macros MSCSD Private Macros
+  * @{
+  */
+#define IS_MSCSD_NB_BUFFERS(__NB__)         (((__NB__) >= 2U) && ((__NB__) <= MSCSD_MAX_BUFFERS) && \
+                                             (((__NB__) & ((__NB__) - 1U)) == 0U))
+
+#define IS_MSCSD_BUFFER_BLOCKS(__BLOCKS__)  (((__BLOCKS__) >= 1U) && ((__BLOCKS__) <= MSCSD_MAX_BUFFER_BLOCKS))
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#endif /* HAL_SD_MODULE_ENABLED && HAL_PCD_MODULE_ENABLED */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STM32H7xx_HAL_MSCSD_H */
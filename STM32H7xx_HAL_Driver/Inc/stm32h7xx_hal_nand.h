@@ -128,10 +128,30 @@ typedef struct
 
   NAND_DeviceConfigTypeDef       Config;     /*!< NAND phusical characteristic information structure    */
 
+#if defined(HAL_MDMA_MODULE_ENABLED)
+  MDMA_HandleTypeDef             *hmdma;     /*!< MDMA handle used by the DMA page transfers            */
+
+  uint8_t                        *pXferBuffPtr; /*!< Buffer of the page being transferred               */
+
+  uint32_t                       *pXferECC;  /*!< Destination of the page ECC values, or NULL           */
+
+  uint32_t                       XferAddress; /*!< NAND raw address of the page being transferred      */
+
+  uint32_t                       XferAddressStep; /*!< Raw address increment between two pages          */
+
+  __IO uint32_t                  XferCount;  /*!< Number of pages left to transfer                      */
+
+  uint32_t                       XferNbPages; /*!< Number of pages of the transfer                      */
+
+  uint32_t                       XferOperation; /*!< Ongoing DMA operation (internal)                   */
+#endif /* HAL_MDMA_MODULE_ENABLED */
+
 #if (USE_HAL_NAND_REGISTER_CALLBACKS == 1)
   void (* MspInitCallback)(struct __NAND_HandleTypeDef *hnand);               /*!< NAND Msp Init callback              */
   void (* MspDeInitCallback)(struct __NAND_HandleTypeDef *hnand);             /*!< NAND Msp DeInit callback            */
   void (* ItCallback)(struct __NAND_HandleTypeDef *hnand);                    /*!< NAND IT callback                    */
+  void (* XferCpltCallback)(struct __NAND_HandleTypeDef *hnand);              /*!< NAND DMA transfer complete callback */
+  void (* XferErrorCallback)(struct __NAND_HandleTypeDef *hnand);             /*!< NAND DMA transfer error callback    */
 #endif /* USE_HAL_NAND_REGISTER_CALLBACKS */
 } NAND_HandleTypeDef;
 
@@ -143,7 +163,9 @@ typedef enum
 {
   HAL_NAND_MSP_INIT_CB_ID       = 0x00U,  /*!< NAND MspInit Callback ID          */
   HAL_NAND_MSP_DEINIT_CB_ID     = 0x01U,  /*!< NAND MspDeInit Callback ID        */
-  HAL_NAND_IT_CB_ID             = 0x02U   /*!< NAND IT Callback ID               */
+  HAL_NAND_IT_CB_ID             = 0x02U,  /*!< NAND IT Callback ID               */
+  HAL_NAND_XFER_CPLT_CB_ID      = 0x03U,  /*!< NAND DMA Transfer Complete Callback ID */
+  HAL_NAND_XFER_ERROR_CB_ID     = 0x04U   /*!< NAND DMA Transfer Error Callback ID    */
 } HAL_NAND_CallbackIDTypeDef;
 
 /**
@@ -236,6 +258,18 @@ HAL_StatusTypeDef  HAL_NAND_Erase_Block(NAND_HandleTypeDef *hnand, NAND_AddressT
 
 uint32_t           HAL_NAND_Address_Inc(NAND_HandleTypeDef *hnand, NAND_AddressTypeDef *pAddress);
 
+#if defined(HAL_MDMA_MODULE_ENABLED)
+HAL_StatusTypeDef  HAL_NAND_Read_Page_8b_DMA(NAND_HandleTypeDef *hnand, const NAND_AddressTypeDef *pAddress,
+                                             uint8_t *pBuffer, uint32_t NumPageToRead, uint32_t *pECC);
+HAL_StatusTypeDef  HAL_NAND_Write_Page_8b_DMA(NAND_HandleTypeDef *hnand, const NAND_AddressTypeDef *pAddress,
+                                              const uint8_t *pBuffer, uint32_t NumPageToWrite, uint32_t *pECC);
+HAL_StatusTypeDef  HAL_NAND_Write_MultiPlane_8b_DMA(NAND_HandleTypeDef *hnand, const NAND_AddressTypeDef *pAddress,
+                                                    const uint8_t *pBuffer, uint32_t *pECC);
+#endif /* HAL_MDMA_MODULE_ENABLED */
+
+void               HAL_NAND_XferCpltCallback(NAND_HandleTypeDef *hnand);
+void               HAL_NAND_XferErrorCallback(NAND_HandleTypeDef *hnand);
+
 #if (USE_HAL_NAND_REGISTER_CALLBACKS == 1)
 /* NAND callback registering/unregistering */
 HAL_StatusTypeDef  HAL_NAND_RegisterCallback(NAND_HandleTypeDef *hnand, HAL_NAND_CallbackIDTypeDef CallbackId,
@@ -290,9 +324,12 @@ uint32_t              HAL_NAND_Read_Status(NAND_HandleTypeDef *hnand);
 #define NAND_CMD_AREA_B            ((uint8_t)0x01)
 #define NAND_CMD_AREA_C            ((uint8_t)0x50)
 #define NAND_CMD_AREA_TRUE1        ((uint8_t)0x30)
+#define NAND_CMD_READ_CACHE_SEQ    ((uint8_t)0x31)
+#define NAND_CMD_READ_CACHE_END    ((uint8_t)0x3F)
 
 #define NAND_CMD_WRITE0            ((uint8_t)0x80)
 #define NAND_CMD_WRITE_TRUE1       ((uint8_t)0x10)
+#define NAND_CMD_WRITE_PLANE       ((uint8_t)0x11)
 #define NAND_CMD_ERASE0            ((uint8_t)0x60)
 #define NAND_CMD_ERASE1            ((uint8_t)0xD0)
 #define NAND_CMD_READID            ((uint8_t)0x90)
@@ -307,6 +344,11 @@ uint32_t              HAL_NAND_Read_Status(NAND_HandleTypeDef *hnand);
 #define NAND_BUSY                  0x00000000UL
 #define NAND_ERROR                 0x00000001UL
 #define NAND_READY                 0x00000040UL
+
+/* NAND DMA operations */
+#define NAND_XFER_READ             0x00000000UL
+#define NAND_XFER_WRITE            0x00000001UL
+#define NAND_XFER_WRITE_PLANES     0x00000002UL
 /**
   * @}
   */
@@ -121,9 +121,22 @@ typedef struct
 
   uint32_t                      CommandSet;   /*!< NOR algorithm command set and control        */
 
+  const uint16_t                *pStreamData; /*!< Next data of the streamed program            */
+
+  uint32_t                      StreamAddress; /*!< NOR internal address of the buffer being programmed */
+
+  uint32_t                      StreamChunk;  /*!< Size of the buffer being programmed (in half-words) */
+
+  __IO uint32_t                 StreamCount;  /*!< Half-words left to program, buffer being
+                                                   programmed included                          */
+
+  uint32_t                      StreamBufferSize; /*!< Device write buffer size (in half-words)  */
+
 #if (USE_HAL_NOR_REGISTER_CALLBACKS == 1)
   void (* MspInitCallback)(struct __NOR_HandleTypeDef *hnor);               /*!< NOR Msp Init callback              */
   void (* MspDeInitCallback)(struct __NOR_HandleTypeDef *hnor);             /*!< NOR Msp DeInit callback            */
+  void (* ProgramCpltCallback)(struct __NOR_HandleTypeDef *hnor);           /*!< NOR streamed program complete callback */
+  void (* ProgramErrorCallback)(struct __NOR_HandleTypeDef *hnor);          /*!< NOR streamed program error callback    */
 #endif /* USE_HAL_NOR_REGISTER_CALLBACKS */
 } NOR_HandleTypeDef;
 
@@ -134,7 +147,9 @@ typedef struct
 typedef enum
 {
   HAL_NOR_MSP_INIT_CB_ID       = 0x00U,  /*!< NOR MspInit Callback ID          */
-  HAL_NOR_MSP_DEINIT_CB_ID     = 0x01U   /*!< NOR MspDeInit Callback ID        */
+  HAL_NOR_MSP_DEINIT_CB_ID     = 0x01U,  /*!< NOR MspDeInit Callback ID        */
+  HAL_NOR_PROGRAM_CPLT_CB_ID   = 0x02U,  /*!< NOR Streamed Program Complete Callback ID */
+  HAL_NOR_PROGRAM_ERROR_CB_ID  = 0x03U   /*!< NOR Streamed Program Error Callback ID    */
 } HAL_NOR_CallbackIDTypeDef;
 
 /**
@@ -147,6 +162,22 @@ typedef void (*pNOR_CallbackTypeDef)(NOR_HandleTypeDef *hnor);
   */
 
 /* Exported constants --------------------------------------------------------*/
+/** @defgroup NOR_Exported_Constants NOR Exported Constants
+  * @{
+  */
+
+/** @defgroup NOR_Burst_Device_Config NOR Burst Device Configuration
+  * @{
+  */
+#define NOR_BURST_CONFIG_NONE    0xFFFFFFFFU  /*!< The device is already configured for synchronous burst reads */
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
 /* Exported macro ------------------------------------------------------------*/
 /** @defgroup NOR_Exported_Macros NOR Exported Macros
   * @{
@@ -203,6 +234,13 @@ HAL_StatusTypeDef HAL_NOR_ReadBuffer(NOR_HandleTypeDef *hnor, uint32_t uwAddress
 HAL_StatusTypeDef HAL_NOR_ProgramBuffer(NOR_HandleTypeDef *hnor, uint32_t uwAddress, uint16_t *pData,
                                         uint32_t uwBufferSize);
 
+HAL_StatusTypeDef HAL_NOR_ProgramStream_IT(NOR_HandleTypeDef *hnor, uint32_t uwAddress, const uint16_t *pData,
+                                           uint32_t uwSize, uint32_t uwBufferSize);
+HAL_StatusTypeDef HAL_NOR_ProgramStream_Abort(NOR_HandleTypeDef *hnor);
+void              HAL_NOR_ProgramStream_IRQHandler(NOR_HandleTypeDef *hnor);
+void              HAL_NOR_ProgramCpltCallback(NOR_HandleTypeDef *hnor);
+void              HAL_NOR_ProgramErrorCallback(NOR_HandleTypeDef *hnor);
+
 HAL_StatusTypeDef HAL_NOR_Erase_Block(NOR_HandleTypeDef *hnor, uint32_t BlockAddress, uint32_t Address);
 HAL_StatusTypeDef HAL_NOR_Erase_Chip(NOR_HandleTypeDef *hnor, uint32_t Address);
 HAL_StatusTypeDef HAL_NOR_Read_CFI(NOR_HandleTypeDef *hnor, NOR_CFITypeDef *pNOR_CFI);
@@ -224,6 +262,8 @@ HAL_StatusTypeDef HAL_NOR_UnRegisterCallback(NOR_HandleTypeDef *hnor, HAL_NOR_Ca
 /* NOR Control functions  *****************************************************/
 HAL_StatusTypeDef HAL_NOR_WriteOperation_Enable(NOR_HandleTypeDef *hnor);
 HAL_StatusTypeDef HAL_NOR_WriteOperation_Disable(NOR_HandleTypeDef *hnor);
+HAL_StatusTypeDef HAL_NOR_ConfigBurstRead(NOR_HandleTypeDef *hnor, FMC_NORSRAM_TimingTypeDef *Timing,
+                                          uint32_t DeviceConfig);
 /**
   * @}
   */
@@ -240,6 +240,42 @@ typedef struct
                                     This parameter can be any value between 0 and 0xFFFF */
 }OSPI_MemoryMappedTypeDef;
 
+/**
+  * @brief  HAL OSPI XIP (execute-in-place) profile structure definition
+  */
+typedef struct
+{
+  uint32_t TimeOutActivation;     /*!< Specifies if the timeout counter is enabled to release the chip select.
+                                       This parameter can be a value of @ref OSPI_TimeOutActivation */
+  uint32_t TimeOutPeriod;         /*!< Specifies the number of clock to wait when the FIFO is full before to release the chip select.
+                                       This parameter can be any value between 0 and 0xFFFF */
+  uint32_t SampleShifting;        /*!< It allows to delay to 1/2 cycle the data sampling in order
+                                       to take in account external signal delays.
+                                       This parameter can be a value of @ref OSPI_SampleShifting */
+  uint32_t DelayHoldQuarterCycle; /*!< It allows to hold to 1/4 cycle the data.
+                                       This parameter can be a value of @ref OSPI_DelayHoldQuarterCycle */
+  uint32_t DummyCycles;           /*!< It indicates the number of dummy cycles inserted before data phase of the read command.
+                                       This parameter can be a value between 0 and 31U */
+  uint32_t DtrMode;               /*!< It enables or not the DTR mode for the address, alternate bytes and data phases
+                                       of the read command.
+                                       This parameter can be a value of @ref OSPI_DataDtrMode */
+  uint32_t SIOOMode;              /*!< It enables or not the SIOO mode for the read command.
+                                       This parameter can be a value of @ref OSPI_SIOOMode */
+}OSPI_XipProfileTypeDef;
+
+/**
+  * @brief  HAL OSPI XIP read benchmark result structure definition
+  */
+typedef struct
+{
+  uint32_t Size;                  /*!< Number of bytes read by each pass of the benchmark                      */
+  uint32_t SequentialCycles;      /*!< CPU cycles spent for the sequential pass                                */
+  uint32_t SequentialBandwidth;   /*!< Sequential read bandwidth in bytes per second                           */
+  uint32_t RandomCycles;          /*!< CPU cycles spent for the random pass                                    */
+  uint32_t RandomLatencyCycles;   /*!< Average latency of one random 32-bit read in CPU cycles                 */
+  uint32_t RandomLatencyNs;       /*!< Average latency of one random 32-bit read in nanoseconds                */
+}OSPI_XipBenchmarkTypeDef;
+
 /**
   * @brief HAL OSPI IO Manager Configuration structure definition
   */
@@ -618,6 +654,16 @@ typedef void (*pOSPI_CallbackTypeDef)(OSPI_HandleTypeDef *hospi);
   * @}
   */
 
+/** @defgroup OSPI_XipProfile OSPI XIP Profile
+  * @{
+  */
+#define HAL_OSPI_XIP_PROFILE_CODE            ((uint32_t)0x00000000U)                                         /*!< Code execution: short bursts, nCS released after a moderate idle time */
+#define HAL_OSPI_XIP_PROFILE_SEQUENTIAL      ((uint32_t)0x00000001U)                                         /*!< Sequential streaming: nCS kept active, prefetch never interrupted    */
+#define HAL_OSPI_XIP_PROFILE_RANDOM          ((uint32_t)0x00000002U)                                         /*!< Random lookup: nCS released quickly to cut useless prefetch          */
+/**
+  * @}
+  */
+
 /** @defgroup OSPI_Flags OSPI Flags
   * @{
   */
@@ -826,6 +872,12 @@ HAL_StatusTypeDef     HAL_OSPI_AutoPolling_IT(OSPI_HandleTypeDef *hospi, OSPI_Au
 
 /* OSPI memory-mapped mode functions */
 HAL_StatusTypeDef     HAL_OSPI_MemoryMapped         (OSPI_HandleTypeDef *hospi, OSPI_MemoryMappedTypeDef *cfg);
+HAL_StatusTypeDef     HAL_OSPI_XipGetProfile        (uint32_t Profile, uint32_t DummyCycles, uint32_t DtrMode,
+                                                     OSPI_XipProfileTypeDef *pProfile);
+HAL_StatusTypeDef     HAL_OSPI_XipStart             (OSPI_HandleTypeDef *hospi, const OSPI_RegularCmdTypeDef *pReadCmd,
+                                                     const OSPI_XipProfileTypeDef *pProfile);
+HAL_StatusTypeDef     HAL_OSPI_XipBenchmark         (OSPI_HandleTypeDef *hospi, uint32_t Offset, uint32_t Size,
+                                                     OSPI_XipBenchmarkTypeDef *pResult);
 
 /* Callback functions in non-blocking modes ***********************************/
 void                  HAL_OSPI_ErrorCallback        (OSPI_HandleTypeDef *hospi);
@@ -1022,6 +1074,10 @@ HAL_StatusTypeDef     HAL_OSPIM_Config(OSPI_HandleTypeDef *hospi, OSPIM_CfgTypeD
 
 #define IS_OSPI_TIMEOUT_PERIOD(PERIOD)     ((PERIOD) <= 0xFFFFU)
 
+#define IS_OSPI_XIP_PROFILE(PROFILE)       (((PROFILE) == HAL_OSPI_XIP_PROFILE_CODE)       || \
+                                            ((PROFILE) == HAL_OSPI_XIP_PROFILE_SEQUENTIAL) || \
+                                            ((PROFILE) == HAL_OSPI_XIP_PROFILE_RANDOM))
+
 #define IS_OSPI_CS_BOUNDARY(BOUNDARY)      ((BOUNDARY) <= 31U)
 
 #define IS_OSPI_DLYBYP(MODE)               (((MODE) == HAL_OSPI_DELAY_BLOCK_USED) || \
@@ -0,0 +1,272 @@
+/**
+  ******************************************************************************
+  * @file    stm32h7xx_hal_ospi_nor.h
+  * @author  MCD Application Team
+  * @brief   Header file of OSPI NOR flash HAL module.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef STM32H7xx_HAL_OSPI_NOR_H
+#define STM32H7xx_HAL_OSPI_NOR_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32h7xx_hal_def.h"
+
+#if defined(OCTOSPI) || defined(OCTOSPI1) || defined(OCTOSPI2)
+
+/** @addtogroup STM32H7xx_HAL_Driver
+  * @{
+  */
+
+/** @addtogroup OSPI_NOR
+  * @{
+  */
+
+/* Exported types ------------------------------------------------------------*/
+#if !defined(HAL_OSPI_NOR_QUEUE_DEPTH)
+#define HAL_OSPI_NOR_QUEUE_DEPTH             8U        /*!< Number of operations in the queue of the RAM executor */
+#endif /* HAL_OSPI_NOR_QUEUE_DEPTH */
+
+/** @defgroup OSPI_NOR_Exported_Types OSPI NOR Exported Types
+  * @{
+  */
+
+/**
+  * @brief  HAL OSPI NOR State structure definition
+  */
+typedef enum
+{
+  HAL_OSPI_NOR_STATE_RESET         = 0x00U,    /*!< NOR not yet initialized                 */
+  HAL_OSPI_NOR_STATE_READY         = 0x01U,    /*!< NOR initialized and ready for use       */
+  HAL_OSPI_NOR_STATE_BUSY_PROGRAM  = 0x02U,    /*!< NOR page program ongoing                */
+  HAL_OSPI_NOR_STATE_BUSY_ERASE    = 0x03U,    /*!< NOR erase ongoing                       */
+  HAL_OSPI_NOR_STATE_MEM_MAPPED    = 0x04U,    /*!< NOR accessed in memory-mapped mode      */
+  HAL_OSPI_NOR_STATE_ERROR         = 0x05U     /*!< NOR unusable, initialization failed     */
+}HAL_OSPI_NOR_StateTypeDef;
+
+/**
+  * @brief  OSPI NOR Init structure definition
+  */
+typedef struct
+{
+  uint32_t MaxMode;                   /*!< Fastest protocol allowed by the board wiring and the OSPI clock.
+                                           This parameter can be a value of @ref OSPI_NOR_Mode */
+}OSPI_NOR_InitTypeDef;
+
+/**
+  * @brief  OSPI NOR erase type structure definition
+  */
+typedef struct
+{
+  uint32_t Size;                      /*!< Size of the erased block in bytes, 0 if the erase type is not supported */
+  uint32_t Instruction;               /*!< Erase instruction                                                      */
+}OSPI_NOR_EraseTypeDef;
+
+/**
+  * @brief  OSPI NOR register image of a command, used by the RAM executor
+  */
+typedef struct
+{
+  uint32_t CCR;                       /*!< Value of the CCR register                  */
+  uint32_t DCYC;                      /*!< Dummy cycles field of the TCR register     */
+  uint32_t IR;                        /*!< Value of the IR register                   */
+}OSPI_NOR_RegCmdTypeDef;
+
+/**
+  * @brief  OSPI NOR queued operation structure definition
+  */
+typedef struct
+{
+  uint32_t Type;                      /*!< Operation type, value of @ref OSPI_NOR_Operation          */
+  uint32_t Address;                   /*!< Address of the next chunk in the memory                   */
+  uint8_t  *pData;                    /*!< Data of the next chunk, program operations only           */
+  uint32_t Size;                      /*!< Remaining bytes                                           */
+  uint32_t EraseIndex;                /*!< Index of the erase type in the Erase field of the handle  */
+}OSPI_NOR_OperationTypeDef;
+
+/**
+  * @brief  OSPI NOR handle Structure definition
+  */
+typedef struct
+{
+  OSPI_HandleTypeDef            *hospi;               /*!< OSPI handle, initialized by the application        */
+  OSPI_NOR_InitTypeDef           Init;                /*!< NOR initialization parameters                      */
+  uint32_t                       Mode;                /*!< Protocol selected from the SFDP tables,
+                                                           value of @ref OSPI_NOR_Mode                        */
+  uint32_t                       MemorySize;          /*!< Memory size in bytes                               */
+  uint32_t                       PageSize;            /*!< Page program size in bytes                         */
+  uint32_t                       AddressBytes;        /*!< Number of address bytes, 3 or 4                    */
+  uint32_t                       ReadInstruction;     /*!< Fast read instruction of the selected protocol     */
+  uint32_t                       ReadDummyCycles;     /*!< Dummy cycles of the fast read instruction          */
+  uint32_t                       ReadModeBytes;       /*!< Mode bits of the fast read sent as alternate bytes */
+  uint32_t                       ProgramInstruction;  /*!< Page program instruction                           */
+  uint32_t                       StatusDummyCycles;   /*!< Dummy cycles of the read status instruction        */
+  uint32_t                       StatusAddressBytes;  /*!< Number of address bytes of the read status
+                                                           instruction, 0 or 4                                */
+  uint32_t                       CmdExtInverted;      /*!< The 8D-8D-8D command extension is the inverted
+                                                           instruction (1) or the instruction (0)             */
+  OSPI_NOR_EraseTypeDef          Erase[4];            /*!< Erase types of the memory                          */
+  uint32_t                       SuspendSupported;    /*!< The memory can suspend an erase (1) or not (0)     */
+  OSPI_NOR_RegCmdTypeDef         RegWriteEnable;      /*!< Write enable command of the RAM executor           */
+  OSPI_NOR_RegCmdTypeDef         RegProgram;          /*!< Page program command of the RAM executor           */
+  OSPI_NOR_RegCmdTypeDef         RegErase[4];         /*!< Erase commands of the RAM executor                 */
+  OSPI_NOR_RegCmdTypeDef         RegReadStatus;       /*!< Read status command of the RAM executor            */
+  OSPI_NOR_RegCmdTypeDef         RegSuspend;          /*!< Erase suspend command of the RAM executor          */
+  OSPI_NOR_RegCmdTypeDef         RegResume;           /*!< Erase resume command of the RAM executor           */
+  OSPI_NOR_OperationTypeDef      Queue[HAL_OSPI_NOR_QUEUE_DEPTH]; /*!< Operations run by HAL_OSPI_NOR_ServiceQueue() */
+  uint32_t                       QueueHead;           /*!< Index of the oldest queued operation               */
+  __IO uint32_t                  QueueCount;          /*!< Number of queued operations                        */
+  __IO uint32_t                  QueueState;          /*!< State of the operation at the head of the queue    */
+  uint32_t                       ChunkSize;           /*!< Size of the chunk being programmed or erased       */
+  __IO HAL_OSPI_NOR_StateTypeDef State;               /*!< NOR state                                          */
+  __IO uint32_t                  ErrorCode;           /*!< NOR error code                                     */
+}OSPI_NOR_HandleTypeDef;
+
+/**
+  * @}
+  */
+
+/* Exported constants --------------------------------------------------------*/
+/** @defgroup OSPI_NOR_Exported_Constants OSPI NOR Exported Constants
+  * @{
+  */
+
+/** @defgroup OSPI_NOR_ErrorCode OSPI NOR Error Code
+  * @{
+  */
+#define HAL_OSPI_NOR_ERROR_NONE              ((uint32_t)0x00000000U)   /*!< No error                                       */
+#define HAL_OSPI_NOR_ERROR_SFDP              ((uint32_t)0x00000001U)   /*!< SFDP tables missing or not usable              */
+#define HAL_OSPI_NOR_ERROR_OSPI              ((uint32_t)0x00000002U)   /*!< OSPI error, see the ErrorCode of the OSPI handle */
+#define HAL_OSPI_NOR_ERROR_INVALID_PARAM     ((uint32_t)0x00000004U)   /*!< Invalid parameters error                       */
+#define HAL_OSPI_NOR_ERROR_INVALID_SEQUENCE  ((uint32_t)0x00000008U)   /*!< Sequence of the state machine is incorrect     */
+#define HAL_OSPI_NOR_ERROR_MODE              ((uint32_t)0x00000010U)   /*!< Memory did not answer in the selected protocol */
+/**
+  * @}
+  */
+
+/** @defgroup OSPI_NOR_Mode OSPI NOR Mode
+  * @{
+  */
+#define HAL_OSPI_NOR_MODE_1S1S1S             ((uint32_t)0x00000000U)   /*!< Instruction, address and data on 1 line          */
+#define HAL_OSPI_NOR_MODE_1S4S4S             ((uint32_t)0x00000001U)   /*!< Instruction on 1 line, address and data on 4 lines */
+#define HAL_OSPI_NOR_MODE_4S4S4S             ((uint32_t)0x00000002U)   /*!< Instruction, address and data on 4 lines         */
+#define HAL_OSPI_NOR_MODE_8D8D8D             ((uint32_t)0x00000003U)   /*!< Instruction, address and data on 8 lines in DTR  */
+/**
+  * @}
+  */
+
+/** @defgroup OSPI_NOR_Operation OSPI NOR Operation
+  * @{
+  */
+#define HAL_OSPI_NOR_OPERATION_PROGRAM       ((uint32_t)0x00000000U)   /*!< Program, split in pages by the executor      */
+#define HAL_OSPI_NOR_OPERATION_ERASE         ((uint32_t)0x00000001U)   /*!< Erase, split in blocks by the executor       */
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/* Exported functions --------------------------------------------------------*/
+/** @addtogroup OSPI_NOR_Exported_Functions
+  * @{
+  */
+
+/** @addtogroup OSPI_NOR_Exported_Functions_Group1
+  * @{
+  */
+/* Initialization/de-initialization functions  ********************************/
+HAL_StatusTypeDef     HAL_OSPI_NOR_Init             (OSPI_NOR_HandleTypeDef *hnor);
+HAL_StatusTypeDef     HAL_OSPI_NOR_DeInit           (OSPI_NOR_HandleTypeDef *hnor);
+/**
+  * @}
+  */
+
+/** @addtogroup OSPI_NOR_Exported_Functions_Group2
+  * @{
+  */
+/* IO operation functions *****************************************************/
+HAL_StatusTypeDef     HAL_OSPI_NOR_ReadSFDP         (OSPI_NOR_HandleTypeDef *hnor, uint32_t Address, uint8_t *pData, uint32_t Size);
+HAL_StatusTypeDef     HAL_OSPI_NOR_Read             (OSPI_NOR_HandleTypeDef *hnor, uint32_t Address, uint8_t *pData, uint32_t Size);
+HAL_StatusTypeDef     HAL_OSPI_NOR_Program_IT       (OSPI_NOR_HandleTypeDef *hnor, uint32_t Address, uint8_t *pData, uint32_t Size);
+HAL_StatusTypeDef     HAL_OSPI_NOR_Erase_IT         (OSPI_NOR_HandleTypeDef *hnor, uint32_t Address, uint32_t Size);
+HAL_StatusTypeDef     HAL_OSPI_NOR_MemoryMapped     (OSPI_NOR_HandleTypeDef *hnor, uint32_t XipProfile);
+HAL_StatusTypeDef     HAL_OSPI_NOR_StopMemoryMapped (OSPI_NOR_HandleTypeDef *hnor);
+
+/* OSPI events to be forwarded from the OSPI callbacks ************************/
+void                  HAL_OSPI_NOR_TxCpltHandler     (OSPI_NOR_HandleTypeDef *hnor);
+void                  HAL_OSPI_NOR_StatusMatchHandler(OSPI_NOR_HandleTypeDef *hnor);
+void                  HAL_OSPI_NOR_ErrorHandler      (OSPI_NOR_HandleTypeDef *hnor);
+
+/* Callback functions in non-blocking modes ***********************************/
+void                  HAL_OSPI_NOR_ProgramCpltCallback(OSPI_NOR_HandleTypeDef *hnor);
+void                  HAL_OSPI_NOR_EraseCpltCallback  (OSPI_NOR_HandleTypeDef *hnor);
+void                  HAL_OSPI_NOR_ErrorCallback      (OSPI_NOR_HandleTypeDef *hnor);
+
+/* Operations run while executing in place ************************************/
+HAL_StatusTypeDef     HAL_OSPI_NOR_QueueProgram     (OSPI_NOR_HandleTypeDef *hnor, uint32_t Address, uint8_t *pData, uint32_t Size);
+HAL_StatusTypeDef     HAL_OSPI_NOR_QueueErase       (OSPI_NOR_HandleTypeDef *hnor, uint32_t Address, uint32_t Size);
+HAL_StatusTypeDef     HAL_OSPI_NOR_ServiceQueue     (OSPI_NOR_HandleTypeDef *hnor, uint32_t Budget);
+/**
+  * @}
+  */
+
+/** @addtogroup OSPI_NOR_Exported_Functions_Group3
+  * @{
+  */
+/* Peripheral State and Error functions ***************************************/
+uint32_t              HAL_OSPI_NOR_GetError         (OSPI_NOR_HandleTypeDef *hnor);
+HAL_OSPI_NOR_StateTypeDef HAL_OSPI_NOR_GetState     (OSPI_NOR_HandleTypeDef *hnor);
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/* Private macros ------------------------------------------------------------*/
+/**
+  @cond 0
+  */
+#define IS_OSPI_NOR_MODE(MODE)             (((MODE) == HAL_OSPI_NOR_MODE_1S1S1S) || \
+                                            ((MODE) == HAL_OSPI_NOR_MODE_1S4S4S) || \
+                                            ((MODE) == HAL_OSPI_NOR_MODE_4S4S4S) || \
+                                            ((MODE) == HAL_OSPI_NOR_MODE_8D8D8D))
+/**
+  @endcond
+  */
+
+/* End of private macros -----------------------------------------------------*/
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#endif /* OCTOSPI || OCTOSPI1 || OCTOSPI2 */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STM32H7xx_HAL_OSPI_NOR_H */
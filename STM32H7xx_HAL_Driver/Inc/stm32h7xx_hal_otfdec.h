@@ -62,6 +62,55 @@ typedef struct
 
 } OTFDEC_RegionConfigTypeDef;
 
+/**
+  * @}
+  */
+
+/** @defgroup OTFDEC_Exported_Types_Group3 OTFDEC region manager definitions
+  * @{
+  */
+
+/**
+  * @brief OTFDEC region layout structure definition, one encrypted area of the external memory
+  */
+typedef struct
+{
+  uint32_t          StartAddress;    /*!< Memory-mapped start address of the area, multiple of
+                                          @ref OTFDEC_REGION_GRANULARITY */
+
+  uint32_t          Size;            /*!< Size of the area in bytes, multiple of @ref OTFDEC_REGION_GRANULARITY */
+
+  uint32_t          AccessPattern;   /*!< Accesses made to the area, the deciphering mode is derived from it.
+                                          This parameter can be a value of @ref OTFDEC_Access_Pattern */
+
+  uint32_t          *pKey;           /*!< Area key, four 32-bit words */
+
+  uint32_t          Nonce[2];        /*!< Area nonce */
+
+  uint16_t          Version;         /*!< Area firmware version */
+
+  uint32_t          Lock;            /*!< Region configuration lock once programmed.
+                                          This parameter can be a value of @ref OTFDEC_Region_Configuration_Lock */
+
+} OTFDEC_RegionLayoutTypeDef;
+
+/**
+  * @brief OTFDEC region read benchmark result structure definition
+  */
+typedef struct
+{
+  uint32_t          Size;              /*!< Number of bytes read by each throughput pass */
+
+  uint32_t          PlainLatency;      /*!< CPU cycles of a first 32-bit read, deciphering disabled */
+
+  uint32_t          DecryptedLatency;  /*!< CPU cycles of a first 32-bit read, deciphering enabled */
+
+  uint32_t          PlainCycles;       /*!< CPU cycles to read Size bytes, deciphering disabled */
+
+  uint32_t          DecryptedCycles;   /*!< CPU cycles to read Size bytes, deciphering enabled */
+
+} OTFDEC_BenchmarkTypeDef;
+
 /**
   * @}
   */
@@ -206,6 +255,30 @@ typedef  void (*pOTFDEC_CallbackTypeDef)(OTFDEC_HandleTypeDef *hotfdec); /*!< po
   * @}
   */
 
+/** @defgroup OTFDEC_Regions_Layout   OTFDEC Regions Layout
+  * @{
+  */
+#define  OTFDEC_REGION_NUMBER      4U                         /*!< Number of OTFDEC regions                   */
+#define  OTFDEC_REGION_GRANULARITY 0x00001000U                /*!< Region start address and size granularity  */
+/**
+  * @}
+  */
+
+/** @defgroup OTFDEC_Access_Pattern    OTFDEC Access Pattern
+  * @{
+  */
+#define  OTFDEC_ACCESS_INSTRUCTION            0x00000001U  /*!< Code fetched only, data reads return the ciphered
+                                                                content (OTFDEC_REG_MODE_INSTRUCTION_ACCESSES_ONLY)      */
+#define  OTFDEC_ACCESS_DATA                   0x00000002U  /*!< Assets read as data only
+                                                                (OTFDEC_REG_MODE_DATA_ACCESSES_ONLY)                     */
+#define  OTFDEC_ACCESS_INSTRUCTION_DATA       0x00000003U  /*!< Code with literal pools or constants read as data
+                                                                (OTFDEC_REG_MODE_INSTRUCTION_OR_DATA_ACCESSES)           */
+#define  OTFDEC_ACCESS_INSTRUCTION_CIPHER     0x00000005U  /*!< Code fetched only, enciphered with the proprietary cipher
+                                                                (OTFDEC_REG_MODE_INSTRUCTION_ACCESSES_ONLY_WITH_CIPHER) */
+/**
+  * @}
+  */
+
 /**
   * @}
   */
@@ -361,6 +434,18 @@ HAL_StatusTypeDef HAL_OTFDEC_RegionGetConfig(OTFDEC_HandleTypeDef *hotfdec, uint
   * @}
   */
 
+/** @addtogroup OTFDEC_Exported_Functions_Group5 Region manager functions
+  * @{
+  */
+HAL_StatusTypeDef HAL_OTFDEC_RegionLayoutConfig(OTFDEC_HandleTypeDef *hotfdec, const OTFDEC_RegionLayoutTypeDef *pLayout,
+                                                uint32_t NbRegions);
+uint32_t HAL_OTFDEC_AccessPatternToMode(uint32_t AccessPattern);
+HAL_StatusTypeDef HAL_OTFDEC_RegionBenchmark(OTFDEC_HandleTypeDef *hotfdec, uint32_t RegionIndex, uint32_t Size,
+                                             OTFDEC_BenchmarkTypeDef *pResult);
+/**
+  * @}
+  */
+
 /**
   * @}
   */
@@ -438,6 +523,16 @@ HAL_StatusTypeDef HAL_OTFDEC_RegionGetConfig(OTFDEC_HandleTypeDef *hotfdec, uint
                                           ((__INDEX__) == OTFDEC_REGION3)     || \
                                           ((__INDEX__) == OTFDEC_REGION4)  )
 
+/**
+  * @brief Verify the OTFDEC region access pattern.
+  * @param __PATTERN__ OTFDEC region access pattern parameter.
+  * @retval SET (__PATTERN__ is valid) or RESET (__PATTERN__ is invalid)
+  */
+#define IS_OTFDEC_ACCESS_PATTERN(__PATTERN__) (((__PATTERN__) == OTFDEC_ACCESS_INSTRUCTION)      || \
+                                               ((__PATTERN__) == OTFDEC_ACCESS_DATA)             || \
+                                               ((__PATTERN__) == OTFDEC_ACCESS_INSTRUCTION_DATA) || \
+                                               ((__PATTERN__) == OTFDEC_ACCESS_INSTRUCTION_CIPHER))
+
 /**
   * @brief Verify the OTFDEC configuration attributes.
   * @param __ATTRIBUTE__ OTFDEC region index
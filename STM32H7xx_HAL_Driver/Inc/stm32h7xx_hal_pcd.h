@@ -103,7 +103,8 @@ typedef struct
   HAL_LockTypeDef         Lock;        /*!< PCD peripheral status             */
   __IO PCD_StateTypeDef   State;       /*!< PCD communication state           */
   __IO  uint32_t          ErrorCode;   /*!< PCD Error code                    */
-  uint32_t                Setup[12];   /*!< Setup packet buffer               */
+  uint32_t                Setup[12] __ALIGNED(32); /*!< Setup packet buffer, cache line aligned for the
+                                                     DMA mode                        */
   PCD_LPM_StateTypeDef    LPM_State;   /*!< LPM State                         */
   uint32_t                BESL;
   uint32_t                FrameNumber; /*!< Store Current Frame number        */
@@ -115,6 +116,7 @@ typedef struct
   uint32_t battery_charging_active;    /*!< Enable or disable Battery charging.
                                        This parameter can be set to ENABLE or DISABLE        */
   void                    *pData;      /*!< Pointer to upper stack Handler */
+  struct __PCD_ISOStreamTypeDef *pISOStream; /*!< Isochronous streams served by the driver */
 
 #if (USE_HAL_PCD_REGISTER_CALLBACKS == 1U)
   void (* SOFCallback)(struct __PCD_HandleTypeDef *hpcd);                              /*!< USB OTG PCD SOF callback                */
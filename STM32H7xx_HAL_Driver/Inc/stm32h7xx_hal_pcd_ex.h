@@ -27,6 +27,15 @@ extern "C" {
 /* Includes ------------------------------------------------------------------*/
 #include "stm32h7xx_hal_def.h"
 
+/* Private constants ---------------------------------------------------------*/
+/** @defgroup PCDEx_Private_Constants PCDEx Private Constants
+  * @{
+  */
+#define PCD_ISOSTREAM_MAX_PACKETS          8U   /*!< Maximum depth of an isochronous stream ring */
+/**
+  * @}
+  */
+
 #if defined (USB_OTG_FS) || defined (USB_OTG_HS)
 /** @addtogroup STM32H7xx_HAL_Driver
   * @{
@@ -36,6 +45,59 @@ extern "C" {
   * @{
   */
 /* Exported types ------------------------------------------------------------*/
+/** @defgroup PCDEx_Exported_Types PCDEx Exported Types
+  * @{
+  */
+
+/**
+  * @brief  PCD isochronous stream structure definition
+  */
+typedef struct __PCD_ISOStreamTypeDef
+{
+  uint8_t       EpAddr;          /*!< Isochronous data endpoint address, IN or OUT */
+
+  uint8_t       FeedbackEpAddr;  /*!< Isochronous IN explicit feedback endpoint address of an OUT
+                                      stream, 0 when no feedback is served */
+
+  uint8_t       *pBuffer;        /*!< Ring of NbPackets packet buffers of PacketSize bytes each.
+                                      In DMA mode it must be word aligned, and cache line aligned
+                                      with PacketSize a multiple of 32 for OUT when the D-cache is on */
+
+  uint32_t      PacketSize;      /*!< Size of one packet buffer, at least the endpoint max packet size */
+
+  uint32_t      NbPackets;       /*!< Number of packet buffers, up to PCD_ISOSTREAM_MAX_PACKETS */
+
+  uint32_t      FeedbackShift;   /*!< Feedback measured over 2^FeedbackShift (micro)frames */
+
+  uint32_t      ClockFracBits;   /*!< Number of fractional bits of the sample clock count given to
+                                      HAL_PCDEx_ISOStream_FeedbackUpdate(), e.g. 8 for MCLK = 256 Fs */
+
+  uint16_t      Length[PCD_ISOSTREAM_MAX_PACKETS]; /*!< Number of bytes of each packet */
+
+  __IO uint32_t Head;            /*!< Number of packets written in the ring */
+
+  __IO uint32_t Tail;            /*!< Number of packets read from the ring */
+
+  __IO uint32_t Armed;           /*!< A transfer is ongoing on the data endpoint */
+
+  __IO uint32_t Underrun;        /*!< IN frames without packet or OUT packets lost on a full ring */
+
+  __IO uint32_t Dropped;         /*!< Packets aborted on an incomplete isochronous transfer */
+
+  uint32_t      Feedback;        /*!< Last feedback value, 10.14 at full speed, 16.16 at high speed */
+
+  uint32_t      ClockRef;        /*!< Sample clock count at the start of the measurement */
+
+  uint32_t      FrameCount;      /*!< (Micro)frames elapsed in the measurement */
+
+  struct __PCD_ISOStreamTypeDef *pNext; /*!< Next stream served by the driver */
+
+} PCD_ISOStreamTypeDef;
+
+/**
+  * @}
+  */
+
 /* Exported constants --------------------------------------------------------*/
 /* Exported macros -----------------------------------------------------------*/
 /* Exported functions --------------------------------------------------------*/
@@ -63,6 +125,21 @@ void HAL_PCDEx_BCD_VBUSDetect(PCD_HandleTypeDef *hpcd);
 void HAL_PCDEx_LPM_Callback(PCD_HandleTypeDef *hpcd, PCD_LPM_MsgTypeDef msg);
 void HAL_PCDEx_BCD_Callback(PCD_HandleTypeDef *hpcd, PCD_BCD_MsgTypeDef msg);
 
+/**
+  * @}
+  */
+
+/** @addtogroup PCDEx_Exported_Functions_Group2 Isochronous streaming functions
+  * @{
+  */
+HAL_StatusTypeDef HAL_PCDEx_ISOStream_Start(PCD_HandleTypeDef *hpcd, PCD_ISOStreamTypeDef *pStream);
+HAL_StatusTypeDef HAL_PCDEx_ISOStream_Stop(PCD_HandleTypeDef *hpcd, PCD_ISOStreamTypeDef *pStream);
+HAL_StatusTypeDef HAL_PCDEx_ISOStream_Write(PCD_ISOStreamTypeDef *pStream, const uint8_t *pData, uint32_t len);
+uint32_t HAL_PCDEx_ISOStream_Read(PCD_ISOStreamTypeDef *pStream, uint8_t *pData, uint32_t len);
+void HAL_PCDEx_ISOStream_FeedbackUpdate(PCD_HandleTypeDef *hpcd, PCD_ISOStreamTypeDef *pStream,
+                                        uint32_t ClockCount);
+void HAL_PCDEx_ISOStream_SOF(PCD_HandleTypeDef *hpcd);
+void HAL_PCDEx_ISOStream_XferCplt(PCD_HandleTypeDef *hpcd, uint8_t ep_addr);
 /**
   * @}
   */
@@ -85,9 +85,14 @@ typedef struct __PSSI_HandleTypeDef
   uint32_t              XferSize;    /*!< PSSI  transfer size            */
   DMA_HandleTypeDef    *hdmatx;      /*!< PSSI Tx DMA Handle parameters  */
   DMA_HandleTypeDef    *hdmarx;      /*!< PSSI Rx DMA Handle parameters  */
+  __IO uint32_t         StreamCount; /*!< PSSI streaming completed blocks */
+  uint32_t              StreamBlockSize; /*!< PSSI streaming block size (in bytes) */
+  uint32_t              StreamStartTick; /*!< PSSI streaming start tick   */
 
   void (* TxCpltCallback)(struct __PSSI_HandleTypeDef *hpssi);    /*!< PSSI transfer complete callback. */
   void (* RxCpltCallback)(struct __PSSI_HandleTypeDef *hpssi);    /*!< PSSI transfer complete callback. */
+  void (* TxHalfCpltCallback)(struct __PSSI_HandleTypeDef *hpssi); /*!< PSSI half transfer complete callback. */
+  void (* RxHalfCpltCallback)(struct __PSSI_HandleTypeDef *hpssi); /*!< PSSI half transfer complete callback. */
   void (* ErrorCallback)(struct __PSSI_HandleTypeDef *hpssi);     /*!< PSSI transfer complete callback. */
   void (* AbortCpltCallback)(struct __PSSI_HandleTypeDef *hpssi); /*!< PSSI transfer error callback.    */
 
@@ -117,7 +122,9 @@ typedef enum
   HAL_PSSI_ABORT_CB_ID       = 0x04U, /*!< PSSI Abort callback ID                  */
 
   HAL_PSSI_MSPINIT_CB_ID     = 0x05U, /*!< PSSI Msp Init callback ID               */
-  HAL_PSSI_MSPDEINIT_CB_ID   = 0x06U  /*!< PSSI Msp DeInit callback ID             */
+  HAL_PSSI_MSPDEINIT_CB_ID   = 0x06U, /*!< PSSI Msp DeInit callback ID             */
+  HAL_PSSI_TX_HALFCOMPLETE_CB_ID = 0x07U, /*!< PSSI Tx Half Transfer completed callback ID */
+  HAL_PSSI_RX_HALFCOMPLETE_CB_ID = 0x08U  /*!< PSSI Rx Half Transfer completed callback ID */
 
 } HAL_PSSI_CallbackIDTypeDef;
 
@@ -455,6 +462,13 @@ HAL_StatusTypeDef HAL_PSSI_Receive(PSSI_HandleTypeDef *hpssi, uint8_t *pData, ui
 HAL_StatusTypeDef HAL_PSSI_Transmit_DMA(PSSI_HandleTypeDef *hpssi, uint32_t *pData, uint32_t Size);
 HAL_StatusTypeDef HAL_PSSI_Receive_DMA(PSSI_HandleTypeDef *hpssi, uint32_t *pData, uint32_t Size);
 HAL_StatusTypeDef HAL_PSSI_Abort_DMA(PSSI_HandleTypeDef *hpssi);
+HAL_StatusTypeDef HAL_PSSI_TransmitCircular_DMA(PSSI_HandleTypeDef *hpssi, uint32_t *pData, uint32_t Size);
+HAL_StatusTypeDef HAL_PSSI_ReceiveCircular_DMA(PSSI_HandleTypeDef *hpssi, uint32_t *pData, uint32_t Size);
+HAL_StatusTypeDef HAL_PSSI_TransmitDoubleBuffer_DMA(PSSI_HandleTypeDef *hpssi, uint32_t *pData0, uint32_t *pData1,
+                                                    uint32_t Size);
+HAL_StatusTypeDef HAL_PSSI_ReceiveDoubleBuffer_DMA(PSSI_HandleTypeDef *hpssi, uint32_t *pData0, uint32_t *pData1,
+                                                   uint32_t Size);
+HAL_StatusTypeDef HAL_PSSI_StopStream_DMA(PSSI_HandleTypeDef *hpssi);
 
 /**
   * @}
@@ -467,6 +481,8 @@ HAL_StatusTypeDef HAL_PSSI_Abort_DMA(PSSI_HandleTypeDef *hpssi);
 /* Peripheral State functions ***************************************************/
 HAL_PSSI_StateTypeDef HAL_PSSI_GetState(PSSI_HandleTypeDef *hpssi);
 uint32_t               HAL_PSSI_GetError(PSSI_HandleTypeDef *hpssi);
+uint64_t               HAL_PSSI_GetStreamBytes(PSSI_HandleTypeDef *hpssi);
+uint32_t               HAL_PSSI_GetStreamThroughput(PSSI_HandleTypeDef *hpssi);
 
 /**
   * @}
@@ -479,6 +495,8 @@ uint32_t               HAL_PSSI_GetError(PSSI_HandleTypeDef *hpssi);
 void HAL_PSSI_IRQHandler(PSSI_HandleTypeDef *hpssi);
 void HAL_PSSI_TxCpltCallback(PSSI_HandleTypeDef *hpssi);
 void HAL_PSSI_RxCpltCallback(PSSI_HandleTypeDef *hpssi);
+void HAL_PSSI_TxHalfCpltCallback(PSSI_HandleTypeDef *hpssi);
+void HAL_PSSI_RxHalfCpltCallback(PSSI_HandleTypeDef *hpssi);
 void HAL_PSSI_ErrorCallback(PSSI_HandleTypeDef *hpssi);
 void HAL_PSSI_AbortCpltCallback(PSSI_HandleTypeDef *hpssi);
 
@@ -512,6 +512,12 @@ HAL_StatusTypeDef HAL_PWREx_ControlVoltageScaling         (uint32_t VoltageScali
 uint32_t          HAL_PWREx_GetVoltageRange               (void);
 HAL_StatusTypeDef HAL_PWREx_ControlStopModeVoltageScaling (uint32_t VoltageScaling);
 uint32_t          HAL_PWREx_GetStopModeVoltageRange       (void);
+HAL_StatusTypeDef HAL_PWREx_SelectVoltageScaling          (uint32_t CpuFrequency, uint32_t AhbFrequency,
+                                                           uint32_t SupplySource, uint32_t *pVoltageScaling);
+HAL_StatusTypeDef HAL_PWREx_ConfigOperatingPoint          (uint32_t SupplySource, uint32_t CpuFrequency,
+                                                           uint32_t AhbFrequency);
+HAL_StatusTypeDef HAL_PWREx_SwitchOperatingPoint          (RCC_ClkInitTypeDef *pClkInit, uint32_t FLatency,
+                                                           uint32_t CpuFrequency, uint32_t AhbFrequency);
 /**
   * @}
   */
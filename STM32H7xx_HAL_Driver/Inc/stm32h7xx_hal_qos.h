@@ -0,0 +1,186 @@
+/**
+  ******************************************************************************
+  * @file    stm32h7xx_hal_qos.h
+  * @author  MCD Application Team
+  * @brief   Header file of bus master QoS HAL module.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef STM32H7xx_HAL_QOS_H
+#define STM32H7xx_HAL_QOS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32h7xx_hal_def.h"
+
+/** @addtogroup STM32H7xx_HAL_Driver
+  * @{
+  */
+
+/** @addtogroup QOS
+  * @{
+  */
+
+/* Exported constants --------------------------------------------------------*/
+/** @defgroup QOS_Exported_Constants QOS Exported Constants
+  * @{
+  */
+
+/** @defgroup QOS_Class QOS Traffic Class
+  * @brief    Traffic classes, from the lowest to the highest priority
+  * @{
+  */
+#define QOS_CLASS_BULK                0U    /*!< Throughput only: memory copies, storage       */
+#define QOS_CLASS_NETWORK             1U    /*!< Bandwidth with bounded latency: Ethernet, USB */
+#define QOS_CLASS_AUDIO               2U    /*!< Low bandwidth, short FIFOs: SAI, I2S, SPDIF   */
+#define QOS_CLASS_DISPLAY             3U    /*!< High bandwidth, no underrun allowed: LTDC     */
+#define QOS_CLASSES_NBR               4U    /*!< Number of traffic classes                     */
+/**
+  * @}
+  */
+
+/** @defgroup QOS_AXI_Port QOS AXI Port
+  * @brief    AXI interconnect initiator ports (ASIB) of the D1 domain
+  * @{
+  */
+#define QOS_AXI_PORT_AHB              0U    /*!< INI1: D2 domain masters through the D2-to-D1 AHB bus */
+#define QOS_AXI_PORT_CPU              1U    /*!< INI2: Cortex-M7 AXI master                           */
+#define QOS_AXI_PORT_SDMMC1           2U    /*!< INI3: SDMMC1                                         */
+#define QOS_AXI_PORT_MDMA             3U    /*!< INI4: MDMA                                           */
+#define QOS_AXI_PORT_DMA2D            4U    /*!< INI5: DMA2D                                          */
+#define QOS_AXI_PORT_LTDC             5U    /*!< INI6: LTDC                                           */
+#define QOS_AXI_PORTS_NBR             6U    /*!< Number of AXI initiator ports                        */
+/**
+  * @}
+  */
+
+/** @defgroup QOS_Master QOS Bus Master
+  * @brief    Bus masters, each one reaching the AXI interconnect through a port
+  *           of @ref QOS_AXI_Port. The D2 domain masters share the AHB port.
+  * @{
+  */
+#define QOS_MASTER_CPU                (0x0000U | QOS_AXI_PORT_CPU)     /*!< Cortex-M7             */
+#define QOS_MASTER_SDMMC1             (0x0000U | QOS_AXI_PORT_SDMMC1)  /*!< SDMMC1 internal DMA   */
+#define QOS_MASTER_MDMA               (0x0000U | QOS_AXI_PORT_MDMA)    /*!< MDMA, all channels    */
+#define QOS_MASTER_DMA2D              (0x0000U | QOS_AXI_PORT_DMA2D)   /*!< DMA2D                 */
+#define QOS_MASTER_LTDC               (0x0000U | QOS_AXI_PORT_LTDC)    /*!< LTDC layers           */
+#define QOS_MASTER_DMA                (0x0100U | QOS_AXI_PORT_AHB)     /*!< DMA1 and DMA2 streams */
+#define QOS_MASTER_ETH                (0x0200U | QOS_AXI_PORT_AHB)     /*!< Ethernet MAC DMA      */
+#define QOS_MASTER_SDMMC2             (0x0300U | QOS_AXI_PORT_AHB)     /*!< SDMMC2 internal DMA   */
+#define QOS_MASTER_USB                (0x0400U | QOS_AXI_PORT_AHB)     /*!< USB OTG DMA           */
+/**
+  * @}
+  */
+
+/** @defgroup QOS_AXI_Level QOS AXI Level
+  * @brief    AXI read and write QoS of each traffic class, from 0 (lowest, reset
+  *           value) to 15. Can be redefined in stm32h7xx_hal_conf.h.
+  * @{
+  */
+#ifndef QOS_AXI_LEVEL_BULK
+#define QOS_AXI_LEVEL_BULK            0U
+#endif /* QOS_AXI_LEVEL_BULK */
+#ifndef QOS_AXI_LEVEL_NETWORK
+#define QOS_AXI_LEVEL_NETWORK         5U
+#endif /* QOS_AXI_LEVEL_NETWORK */
+#ifndef QOS_AXI_LEVEL_AUDIO
+#define QOS_AXI_LEVEL_AUDIO           10U
+#endif /* QOS_AXI_LEVEL_AUDIO */
+#ifndef QOS_AXI_LEVEL_DISPLAY
+#define QOS_AXI_LEVEL_DISPLAY         15U
+#endif /* QOS_AXI_LEVEL_DISPLAY */
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/* Exported functions --------------------------------------------------------*/
+/** @addtogroup QOS_Exported_Functions
+  * @{
+  */
+
+/** @addtogroup QOS_Exported_Functions_Group1
+  * @{
+  */
+/* Initialization and de-initialization functions  ****************************/
+void              HAL_QOS_Init(void);
+void              HAL_QOS_DeInit(void);
+/**
+  * @}
+  */
+
+/** @addtogroup QOS_Exported_Functions_Group2
+  * @{
+  */
+/* Registration functions  ****************************************************/
+HAL_StatusTypeDef HAL_QOS_RegisterMaster(uint32_t Master, uint32_t Class);
+#if defined(HAL_DMA_MODULE_ENABLED)
+HAL_StatusTypeDef HAL_QOS_RegisterDma(DMA_HandleTypeDef *hdma, uint32_t Class);
+#endif /* HAL_DMA_MODULE_ENABLED */
+#if defined(HAL_MDMA_MODULE_ENABLED)
+HAL_StatusTypeDef HAL_QOS_RegisterMdma(MDMA_HandleTypeDef *hmdma, uint32_t Class);
+#endif /* HAL_MDMA_MODULE_ENABLED */
+uint32_t          HAL_QOS_GetPortClass(uint32_t Port);
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/* Private macros ------------------------------------------------------------*/
+/** @defgroup QOS_Private_Macros QOS Private Macros
+  * @{
+  */
+#define QOS_GET_PORT(__MASTER__)      ((__MASTER__) & 0xFFU)
+
+#define IS_QOS_CLASS(__CLASS__)       ((__CLASS__) < QOS_CLASSES_NBR)
+
+#define IS_QOS_AXI_PORT(__PORT__)     ((__PORT__) < QOS_AXI_PORTS_NBR)
+
+#define IS_QOS_MASTER(__MASTER__)     (((__MASTER__) == QOS_MASTER_CPU)    || \
+                                       ((__MASTER__) == QOS_MASTER_SDMMC1) || \
+                                       ((__MASTER__) == QOS_MASTER_MDMA)   || \
+                                       ((__MASTER__) == QOS_MASTER_DMA2D)  || \
+                                       ((__MASTER__) == QOS_MASTER_LTDC)   || \
+                                       ((__MASTER__) == QOS_MASTER_DMA)    || \
+                                       ((__MASTER__) == QOS_MASTER_ETH)    || \
+                                       ((__MASTER__) == QOS_MASTER_SDMMC2) || \
+                                       ((__MASTER__) == QOS_MASTER_USB))
+
+#define IS_QOS_AXI_LEVEL(__LEVEL__)   ((__LEVEL__) <= 15U)
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STM32H7xx_HAL_QOS_H */
@@ -53,6 +53,19 @@ typedef enum
   HAL_RAMECC_STATE_ERROR             = 0x03U,  /*!< RAMECC error state                     */
 }HAL_RAMECC_StateTypeDef;
 
+/**
+  * @brief  RAMECC error telemetry structure definition
+  * @note   Counters are updated from HAL_RAMECC_IRQHandler() and
+  *         HAL_RAMECC_PollTelemetry(), one set per monitor (memory bank).
+  */
+typedef struct
+{
+  uint32_t SingleErrorCount;         /*!< Number of ECC single errors detected and corrected on read */
+  uint32_t DoubleErrorCount;         /*!< Number of ECC double errors detected on read               */
+  uint32_t DoubleErrorWriteCount;    /*!< Number of ECC double errors detected on byte write         */
+  uint32_t LastSingleErrorAddress;   /*!< Failing address offset of the last single error            */
+  uint32_t LastDoubleErrorAddress;   /*!< Failing address offset of the last double error            */
+}RAMECC_TelemetryTypeDef;
 
 /**
   * @brief  RAMECC handle Structure definition
@@ -64,8 +77,35 @@ typedef struct __RAMECC_HandleTypeDef
   __IO HAL_RAMECC_StateTypeDef    State;                                                                /*!< RAMECC state                 */
   __IO uint32_t                   ErrorCode;                                                            /*!< RAMECC Error Code            */
   void                            (* DetectErrorCallback)( struct __RAMECC_HandleTypeDef *hramecc);     /*!< RAMECC error detect callback */
+  RAMECC_TelemetryTypeDef         Telemetry;                                                            /*!< RAMECC error counters        */
 }RAMECC_HandleTypeDef;
 
+#if defined (HAL_MDMA_MODULE_ENABLED)
+/**
+  * @brief  RAMECC scrubber structure definition
+  * @note   The structure is owned by the scrubber between HAL_RAMECC_Scrubber_Start()
+  *         and the end of the scrubbing: it must not be modified nor released
+  *         by the application in between.
+  */
+typedef struct
+{
+  MDMA_HandleTypeDef              *hmdma;             /*!< MDMA channel used for scrubbing, Instance set by the
+                                                           application, Init configured by the scrubber           */
+  RAMECC_HandleTypeDef            **pMonitors;        /*!< Started monitors of the scrubbed banks, whose telemetry
+                                                           is updated after each block (may be NULL)              */
+  uint32_t                        NbMonitors;         /*!< Number of entries of pMonitors                         */
+  uint32_t                        StartAddress;       /*!< First address of the scrubbed area, word aligned       */
+  uint32_t                        Size;               /*!< Size of the scrubbed area (in bytes), multiple of 4    */
+  uint32_t                        BlockSize;          /*!< Bytes read per MDMA block, multiple of 4 up to 65536   */
+  uint32_t                        Mode;               /*!< Scrubbing mode, a value of @ref RAMECC_Scrub_Mode      */
+  uint32_t                        Continuous;         /*!< 1 to restart a new pass at the end of each pass        */
+  uint32_t                        Offset;             /*!< Bytes of the current pass submitted (internal)         */
+  uint32_t                        Sink;               /*!< Destination of the read-only transfers (internal)      */
+  __IO uint32_t                   PassCount;          /*!< Number of completed passes                             */
+  __IO uint32_t                   State;              /*!< Scrubber state, a value of @ref RAMECC_Scrub_State     */
+}RAMECC_ScrubberTypeDef;
+#endif /* HAL_MDMA_MODULE_ENABLED */
+
 /**
   * @}
   */
@@ -115,6 +155,27 @@ typedef struct __RAMECC_HandleTypeDef
 #define RAMECC_FLAG_DOUBLEERR_W            RAMECC_SR_DEBWDF
 #define RAMECC_FLAGS_ALL                   (RAMECC_SR_SEDCF | RAMECC_SR_DEDF | RAMECC_SR_DEBWDF)
 
+/**
+  * @}
+  */
+
+/** @defgroup RAMECC_Scrub_Mode RAMECC Scrubbing Mode
+  * @{
+  */
+#define RAMECC_SCRUB_READ                  0x00000000U  /*!< Memory only read: errors are detected and latched           */
+#define RAMECC_SCRUB_REWRITE               0x00000001U  /*!< Memory read and written back in place: single errors are
+                                                             repaired in memory. Only for areas not written concurrently
+                                                             by another master                                            */
+/**
+  * @}
+  */
+
+/** @defgroup RAMECC_Scrub_State RAMECC Scrubbing State
+  * @{
+  */
+#define RAMECC_SCRUB_STATE_READY           0x00000000U  /*!< Scrubber stopped or pass completed  */
+#define RAMECC_SCRUB_STATE_BUSY            0x00000001U  /*!< Scrubbing ongoing                   */
+#define RAMECC_SCRUB_STATE_ERROR           0x00000002U  /*!< Scrubbing stopped on an MDMA error  */
 /**
   * @}
   */
@@ -292,6 +353,22 @@ uint32_t                HAL_RAMECC_GetError (RAMECC_HandleTypeDef *hramecc);
   * @}
   */
 
+/** @defgroup RAMECC_Exported_Functions_Group5 Telemetry and scrubbing functions
+  * @brief    Telemetry and scrubbing functions
+  * @{
+  */
+void              HAL_RAMECC_PollTelemetry        (RAMECC_HandleTypeDef *hramecc);
+void              HAL_RAMECC_GetTelemetry         (RAMECC_HandleTypeDef *hramecc, RAMECC_TelemetryTypeDef *pTelemetry);
+void              HAL_RAMECC_ResetTelemetry       (RAMECC_HandleTypeDef *hramecc);
+#if defined (HAL_MDMA_MODULE_ENABLED)
+HAL_StatusTypeDef HAL_RAMECC_Scrubber_Start       (RAMECC_ScrubberTypeDef *pScrubber);
+HAL_StatusTypeDef HAL_RAMECC_Scrubber_Stop        (RAMECC_ScrubberTypeDef *pScrubber);
+void              HAL_RAMECC_ScrubPassCpltCallback(RAMECC_ScrubberTypeDef *pScrubber);
+#endif /* HAL_MDMA_MODULE_ENABLED */
+/**
+  * @}
+  */
+
 /**
   * @}
   */
@@ -317,6 +394,12 @@ uint32_t                HAL_RAMECC_GetError (RAMECC_HandleTypeDef *hramecc);
                                                ((INTERRUPT) == RAMECC_IT_GLOBAL_ALL))
 
 
+#define IS_RAMECC_SCRUB_MODE(MODE)            (((MODE) == RAMECC_SCRUB_READ) || \
+                                               ((MODE) == RAMECC_SCRUB_REWRITE))
+
+#define IS_RAMECC_SCRUB_BLOCK_SIZE(SIZE)      (((SIZE) != 0U) && ((SIZE) <= 65536U) && (((SIZE) & 3U) == 0U))
+
+
 #define IS_RAMECC_MONITOR_INTERRUPT(INTERRUPT) (((INTERRUPT) == RAMECC_IT_MONITOR_SINGLEERR_R) || \
                                                 ((INTERRUPT) == RAMECC_IT_MONITOR_DOUBLEERR_R) || \
                                                 ((INTERRUPT) == RAMECC_IT_MONITOR_DOUBLEERR_W) || \
@@ -144,6 +144,25 @@ typedef struct
                                        This parameter can be a value of @ref RCC_APB4_Clock_Source                        */
 } RCC_ClkInitTypeDef;
 
+/**
+  * @brief  RCC clock state structure definition, saved before STOP mode with
+  *         HAL_RCC_SaveClockState() and restored on wake-up with HAL_RCC_RestoreClockState()
+  */
+typedef struct
+{
+  uint32_t CR;                /*!< RCC_CR: oscillators and PLLs enabled                          */
+
+  uint32_t CFGR;              /*!< RCC_CFGR: system clock source                                 */
+
+  uint32_t FlashACR;          /*!< FLASH_ACR: latency and programming delay                      */
+
+  uint32_t PwrODEN;           /*!< SYSCFG_PWRCR: over-drive enabled, 0 when there is no over-drive */
+
+  uint32_t SystemCoreClock;   /*!< SystemCoreClock value to restore                              */
+
+  uint32_t SystemD2Clock;     /*!< SystemD2Clock value to restore                                */
+} RCC_ClockStateTypeDef;
+
 /**
   * @}
   */
@@ -7987,6 +8006,9 @@ uint32_t HAL_RCC_GetPCLK1Freq(void);
 uint32_t HAL_RCC_GetPCLK2Freq(void);
 void     HAL_RCC_GetOscConfig(RCC_OscInitTypeDef *RCC_OscInitStruct);
 void     HAL_RCC_GetClockConfig(RCC_ClkInitTypeDef *RCC_ClkInitStruct, uint32_t *pFLatency);
+void     HAL_RCC_InvalidateClockCache(void);
+void     HAL_RCC_SaveClockState(RCC_ClockStateTypeDef *pState);
+HAL_StatusTypeDef HAL_RCC_RestoreClockState(const RCC_ClockStateTypeDef *pState);
 /* CSS NMI IRQ handler */
 void     HAL_RCC_NMI_IRQHandler(void);
 /* User Callbacks in non blocking mode (IT mode) */
@@ -8002,6 +8024,16 @@ void     HAL_RCC_CSSCallback(void);
 
 /* Private types -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
+#if defined(USE_HAL_RCC_CLOCK_CACHE) && (USE_HAL_RCC_CLOCK_CACHE == 1U)
+/** @defgroup RCC_Private_Variables RCC Private Variables
+  * @{
+  */
+extern uint32_t uwRCCClockCacheValid;
+/**
+  * @}
+  */
+#endif /* USE_HAL_RCC_CLOCK_CACHE */
+
 /* Private constants ---------------------------------------------------------*/
 /** @defgroup RCC_Private_Constants RCC Private Constants
   * @{
@@ -8018,6 +8050,14 @@ void     HAL_RCC_CSSCallback(void);
 #define RCC_DBP_TIMEOUT_VALUE      (100U)
 #define RCC_LSE_TIMEOUT_VALUE      LSE_STARTUP_TIMEOUT
 
+#if defined(USE_HAL_RCC_CLOCK_CACHE) && (USE_HAL_RCC_CLOCK_CACHE == 1U)
+/* Valid entries of the clock frequency cache */
+#define RCC_CLOCK_CACHE_SYSCLK     (0x01U) /* HAL_RCC_GetSysClockFreq()     */
+#define RCC_CLOCK_CACHE_PLL1       (0x02U) /* HAL_RCCEx_GetPLL1ClockFreq()  */
+#define RCC_CLOCK_CACHE_PLL2       (0x04U) /* HAL_RCCEx_GetPLL2ClockFreq()  */
+#define RCC_CLOCK_CACHE_PLL3       (0x08U) /* HAL_RCCEx_GetPLL3ClockFreq()  */
+#endif /* USE_HAL_RCC_CLOCK_CACHE */
+
 /**
   * @}
   */
@@ -8027,6 +8067,13 @@ void     HAL_RCC_CSSCallback(void);
   * @{
   */
 
+/* Clear the clock frequency cache, to be done by each function changing the clock tree */
+#if defined(USE_HAL_RCC_CLOCK_CACHE) && (USE_HAL_RCC_CLOCK_CACHE == 1U)
+#define RCC_CLOCK_CACHE_INVALIDATE()  (uwRCCClockCacheValid = 0U)
+#else
+#define RCC_CLOCK_CACHE_INVALIDATE()  do { } while(0)
+#endif /* USE_HAL_RCC_CLOCK_CACHE */
+
 /** @defgroup RCC_IS_RCC_Definitions RCC Private macros to check input parameters
   * @{
   */
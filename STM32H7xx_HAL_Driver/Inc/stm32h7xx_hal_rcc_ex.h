@@ -335,6 +335,51 @@ typedef struct
 
 } RCC_CRSSynchroInfoTypeDef;
 
+/**
+  * @brief  RCC operating point structure definition: regulator voltage scale, FLASH
+  *         latency and system clock applied together by HAL_RCCEx_SetOperatingPoint()
+  */
+typedef struct
+{
+  uint32_t VoltageScaling;    /*!< The regulator voltage scale.
+                                   This parameter must be a value of @ref PWR_Regulator_Voltage_Scale */
+
+  uint32_t SYSCLKSource;      /*!< The system clock source: RCC_SYSCLKSOURCE_HSI, or RCC_SYSCLKSOURCE_PLLCLK
+                                   with PLL1 clocked by HSI */
+
+  uint32_t PLLM;              /*!< PLLM: division factor for PLL1 input clock, used with RCC_SYSCLKSOURCE_PLLCLK.
+                                   This parameter must be a number between Min_Data = 1 and Max_Data = 63 */
+
+  uint32_t PLLN;              /*!< PLLN: multiplication factor for PLL1 VCO, used with RCC_SYSCLKSOURCE_PLLCLK.
+                                   This parameter must be a number between Min_Data = 4 and Max_Data = 512 */
+
+  uint32_t PLLP;              /*!< PLLP: division factor for the system clock, used with RCC_SYSCLKSOURCE_PLLCLK.
+                                   This parameter must be a number between Min_Data = 2 and Max_Data = 128
+                                   (odd values are not allowed on some devices) */
+
+  uint32_t SYSCLKDivider;     /*!< The system clock divider.
+                                   This parameter can be a value of @ref RCC_SYS_Clock_Source */
+
+  uint32_t AHBCLKDivider;     /*!< The AHB clock (HCLK) divider.
+                                   This parameter can be a value of @ref RCC_HCLK_Clock_Source */
+
+  uint32_t APB3CLKDivider;    /*!< The APB3 clock (D1PCLK1) divider.
+                                   This parameter can be a value of @ref RCC_APB3_Clock_Source */
+
+  uint32_t APB1CLKDivider;    /*!< The APB1 clock (PCLK1) divider.
+                                   This parameter can be a value of @ref RCC_APB1_Clock_Source */
+
+  uint32_t APB2CLKDivider;    /*!< The APB2 clock (PCLK2) divider.
+                                   This parameter can be a value of @ref RCC_APB2_Clock_Source */
+
+  uint32_t APB4CLKDivider;    /*!< The APB4 clock (D3PCLK1) divider.
+                                   This parameter can be a value of @ref RCC_APB4_Clock_Source */
+
+  uint32_t FLatency;          /*!< The FLASH latency for the HCLK frequency in the voltage scale,
+                                   from the device reference manual.
+                                   This parameter can be a value of @ref FLASH_Latency */
+} RCC_OperatingPointTypeDef;
+
 /**
   * @}
   */
@@ -345,6 +390,34 @@ typedef struct
   * @{
   */
 
+/** @defgroup RCCEx_Performance_Level Performance Level
+  * @brief    Predefined operating points, all clocked from HSI 64 MHz
+  * @{
+  */
+#if defined(PWR_SRDCR_VOS)
+#define RCC_PERF_LEVEL_0               0U   /*!< HSI 64 MHz, voltage scale 3                        */
+#define RCC_PERF_LEVEL_1               1U   /*!< PLL1 160 MHz, voltage scale 2                      */
+#define RCC_PERF_LEVEL_2               2U   /*!< PLL1 280 MHz, voltage scale 0                      */
+#else
+#define RCC_PERF_LEVEL_0               0U   /*!< HSI 64 MHz, voltage scale 3                        */
+#define RCC_PERF_LEVEL_1               1U   /*!< PLL1 160 MHz, HCLK 80 MHz, voltage scale 3         */
+#define RCC_PERF_LEVEL_2               2U   /*!< PLL1 400 MHz, HCLK 200 MHz, voltage scale 1        */
+#endif /* PWR_SRDCR_VOS */
+#define RCC_PERF_LEVEL_MAX             RCC_PERF_LEVEL_2
+/**
+  * @}
+  */
+
+/** @defgroup RCCEx_Performance_Governor_Thresholds Performance Governor Thresholds
+  * @brief    CPU load thresholds, in percent, of HAL_RCCEx_PerformanceGovernor()
+  * @{
+  */
+#define RCC_PERF_LOAD_HIGH             80U  /*!< Above this load, the next level up is selected     */
+#define RCC_PERF_LOAD_LOW              30U  /*!< Below this load, the next level down is selected   */
+/**
+  * @}
+  */
+
 /** @defgroup RCCEx_Periph_Clock_Selection  RCCEx Periph Clock Selection
   * @{
   */
@@ -483,6 +556,22 @@ typedef struct
 #define RCC_PLL3_DIVQ                RCC_PLLCFGR_DIVQ3EN
 #define RCC_PLL3_DIVR                RCC_PLLCFGR_DIVR3EN
 
+/**
+  * @}
+  */
+
+/** @defgroup RCCEx_Clock_Ready  RCCEx Clock Ready
+  * @brief    Clocks whose ready flag is checked by HAL_RCCEx_GetClockReady() and
+  *           HAL_RCCEx_WaitClockReady()
+  * @{
+  */
+#define RCC_CLOCKREADY_HSE           RCC_OSCILLATORTYPE_HSE     /*!< HSE oscillator ready   */
+#define RCC_CLOCKREADY_LSE           RCC_OSCILLATORTYPE_LSE     /*!< LSE oscillator ready   */
+#define RCC_CLOCKREADY_CSI           RCC_OSCILLATORTYPE_CSI     /*!< CSI oscillator ready   */
+#define RCC_CLOCKREADY_HSI48         RCC_OSCILLATORTYPE_HSI48   /*!< HSI48 oscillator ready */
+#define RCC_CLOCKREADY_PLL1          0x00000100U                /*!< PLL1 locked            */
+#define RCC_CLOCKREADY_PLL2          0x00000200U                /*!< PLL2 locked            */
+#define RCC_CLOCKREADY_PLL3          0x00000400U                /*!< PLL3 locked            */
 /**
   * @}
   */
@@ -3946,6 +4035,34 @@ void     HAL_RCCEx_CRS_SyncWarnCallback(void);
 void     HAL_RCCEx_CRS_ExpectedSyncCallback(void);
 void     HAL_RCCEx_CRS_ErrorCallback(uint32_t Error);
 
+/**
+  * @}
+  */
+
+/** @addtogroup RCCEx_Exported_Functions_Group4
+  * @{
+  */
+
+HAL_StatusTypeDef HAL_RCCEx_StartOscillators(const RCC_OscInitTypeDef *RCC_OscInitStruct);
+HAL_StatusTypeDef HAL_RCCEx_StartPLL2(const RCC_PLL2InitTypeDef *pll2);
+HAL_StatusTypeDef HAL_RCCEx_StartPLL3(const RCC_PLL3InitTypeDef *pll3);
+uint32_t          HAL_RCCEx_GetClockReady(uint32_t Clocks);
+HAL_StatusTypeDef HAL_RCCEx_WaitClockReady(uint32_t Clocks, uint32_t Timeout);
+
+/**
+  * @}
+  */
+
+/** @addtogroup RCCEx_Exported_Functions_Group5
+  * @{
+  */
+
+HAL_StatusTypeDef HAL_RCCEx_SetOperatingPoint(const RCC_OperatingPointTypeDef *pOperatingPoint);
+HAL_StatusTypeDef HAL_RCCEx_SetPerformanceLevel(uint32_t Level);
+uint32_t          HAL_RCCEx_GetPerformanceLevel(void);
+HAL_StatusTypeDef HAL_RCCEx_PerformanceGovernor(uint32_t LoadPercent);
+void              HAL_RCCEx_PerformanceLevelCallback(uint32_t Level);
+
 /**
   * @}
   */
@@ -3962,6 +4079,8 @@ void     HAL_RCCEx_CRS_ErrorCallback(uint32_t Error);
   * @{
   */
 
+#define IS_RCC_PERF_LEVEL(__LEVEL__)       ((__LEVEL__) <= RCC_PERF_LEVEL_MAX)
+
 #define IS_RCC_PLL2CLOCKOUT_VALUE(VALUE) (((VALUE) == RCC_PLL2_DIVP) || \
                                          ((VALUE) == RCC_PLL2_DIVQ)  || \
                                          ((VALUE) == RCC_PLL2_DIVR))
@@ -69,6 +69,30 @@ typedef enum
 
 } HAL_RNG_StateTypeDef;
 
+/**
+  * @}
+  */
+
+/** @defgroup RNG_Exported_Types_Group4 RNG Entropy Pool Structure definition
+  * @{
+  */
+typedef struct
+{
+  uint32_t                    *pBuffer;         /*!< Pool storage, in 32-bit words                          */
+
+  uint32_t                    Size;             /*!< Pool size in 32-bit words, must be a power of 2        */
+
+  __IO uint32_t               Head;             /*!< Words written by the RNG interrupt (free running)      */
+
+  __IO uint32_t               Tail;             /*!< Words read by HAL_RNG_PoolRead() (free running)        */
+
+  uint32_t                    LastWord;         /*!< Last word read from DR, for the repetition count test  */
+
+  __IO uint32_t               RepetitionCount;  /*!< Words rejected by the repetition count test            */
+
+  __IO uint32_t               SeedErrorCount;   /*!< Seed errors recovered while refilling the pool         */
+} RNG_PoolTypeDef;
+
 /**
   * @}
   */
@@ -94,6 +118,8 @@ typedef struct
 
   uint32_t                    RandomNumber; /*!< Last Generated RNG Data */
 
+  RNG_PoolTypeDef             *pPool;       /*!< Entropy pool refilled under interrupt, NULL when not used */
+
 #if (USE_HAL_RNG_REGISTER_CALLBACKS == 1)
   void (* ReadyDataCallback)(struct __RNG_HandleTypeDef *hrng, uint32_t random32bit);  /*!< RNG Data Ready Callback    */
   void (* ErrorCallback)(struct __RNG_HandleTypeDef *hrng);                            /*!< RNG Error Callback         */
@@ -178,6 +204,7 @@ typedef  void (*pRNG_ReadyDataCallbackTypeDef)(RNG_HandleTypeDef *hrng, uint32_t
 #define  HAL_RNG_ERROR_BUSY             0x00000004U    /*!< Busy error        */
 #define  HAL_RNG_ERROR_SEED             0x00000008U    /*!< Seed error        */
 #define  HAL_RNG_ERROR_CLOCK            0x00000010U    /*!< Clock error       */
+#define  HAL_RNG_ERROR_REPETITION       0x00000020U    /*!< Repetition count test error */
 /**
   * @}
   */
@@ -338,6 +365,18 @@ uint32_t             HAL_RNG_GetError(RNG_HandleTypeDef *hrng);
   * @}
   */
 
+/** @defgroup RNG_Exported_Functions_Group4 Entropy pool functions
+  * @{
+  */
+HAL_StatusTypeDef HAL_RNG_PoolStart(RNG_HandleTypeDef *hrng, RNG_PoolTypeDef *pPool, uint32_t *pBuffer,
+                                    uint32_t Size);
+HAL_StatusTypeDef HAL_RNG_PoolStop(RNG_HandleTypeDef *hrng);
+HAL_StatusTypeDef HAL_RNG_PoolRead(RNG_HandleTypeDef *hrng, uint8_t *pData, uint32_t Size, uint32_t Timeout);
+uint32_t          HAL_RNG_PoolGetLevel(RNG_HandleTypeDef *hrng);
+/**
+  * @}
+  */
+
 /**
   * @}
   */
@@ -360,6 +399,13 @@ uint32_t             HAL_RNG_GetError(RNG_HandleTypeDef *hrng);
   */
 #define IS_RNG_CED(__MODE__)   (((__MODE__) == RNG_CED_ENABLE) || \
                                 ((__MODE__) == RNG_CED_DISABLE))
+
+/**
+  * @brief Verify the RNG entropy pool size.
+  * @param __SIZE__ pool size in 32-bit words
+  * @retval SET (__SIZE__ is a power of 2) or RESET (__SIZE__ is invalid)
+  */
+#define IS_RNG_POOL_SIZE(__SIZE__)  (((__SIZE__) != 0U) && (((__SIZE__) & ((__SIZE__) - 1U)) == 0U))
 /**
   * @}
   */
@@ -57,6 +57,10 @@ typedef enum
   */
 typedef void (*SAIcallback)(void);
 
+#if !defined(SAI_PDMCAPTURE_MAX_MICS)
+#define SAI_PDMCAPTURE_MAX_MICS  8U   /*!< Microphones handled by a PDM capture context */
+#endif /* SAI_PDMCAPTURE_MAX_MICS */
+
 /** @defgroup SAI_PDM_Structure_definition SAI PDM Structure definition
   * @brief  SAI PDM Init structure definition
   * @{
@@ -209,6 +213,56 @@ typedef struct
   * @}
   */
 
+/**
+  * @brief  SAI TDM slot view structure definition, samples of one slot
+  *         inside an interleaved audio buffer
+  */
+typedef struct
+{
+  uint8_t  *pBase;       /*!< Address of the first sample of the slot                  */
+
+  uint32_t Stride;       /*!< Distance between two samples of the slot (in bytes)      */
+
+  uint32_t SampleSize;   /*!< Size of a sample in memory (in bytes): 1, 2 or 4         */
+
+  uint32_t NbSamples;    /*!< Number of samples of the slot in the buffer              */
+} SAI_SlotViewTypeDef;
+
+/**
+  * @brief  SAI PDM capture structure definition, software CIC decimation of
+  *         the bit streams of the PDM interface into 16-bit PCM frames
+  * @note   The PDM buffer holds two frames of Decimation / 8 bytes per sample
+  *         and per microphone, in the order of the SAI slots. The PCM buffer
+  *         holds two frames of FrameSamples samples per microphone, the
+  *         samples of the microphones being interleaved.
+  */
+typedef struct
+{
+  uint32_t NbMics;                                  /*!< Number of microphones, twice Init.PdmInit.MicPairsNbr  */
+
+  uint32_t Decimation;                              /*!< PDM bits per PCM sample, a multiple of 8 from 16 to 128,
+                                                         64 for 16 kHz from 1.024 MHz or 48 kHz from 3.072 MHz  */
+
+  uint32_t FrameSamples;                            /*!< PCM samples per microphone in each frame               */
+
+  uint8_t  *pPdmBuffer;                             /*!< Circular reception buffer of the DMA,
+                                                         2 * FrameSamples * NbMics * Decimation / 8 bytes       */
+
+  int16_t  *pPcmBuffer;                             /*!< PCM output buffer, 2 * FrameSamples * NbMics samples   */
+
+  int16_t  *pFrame;                                 /*!< Last frame converted, inside pPcmBuffer                */
+
+  __IO uint32_t FrameCount;                         /*!< Frames converted since the start                       */
+
+  uint32_t Offset;                                  /*!< Mid scale of the CIC output, removed from each sample  */
+
+  uint32_t Shift;                                   /*!< Right shift scaling the CIC output to 16 bits          */
+
+  uint32_t Integrator[SAI_PDMCAPTURE_MAX_MICS][4];  /*!< Integrator stages of the filter of each microphone     */
+
+  uint32_t Comb[SAI_PDMCAPTURE_MAX_MICS][4];        /*!< Comb stage delays of the filter of each microphone     */
+} SAI_PDMCaptureTypeDef;
+
 /** @defgroup SAI_Handle_Structure_definition SAI Handle Structure definition
   * @brief  SAI handle Structure definition
   * @{
@@ -243,11 +297,15 @@ typedef struct __SAI_HandleTypeDef
 
   __IO uint32_t             ErrorCode;    /*!< SAI Error code */
 
+  SAI_PDMCaptureTypeDef     *pPdmCapture; /*!< PDM capture context, NULL when not capturing */
+
 #if (USE_HAL_SAI_REGISTER_CALLBACKS == 1)
   void (*RxCpltCallback)(struct __SAI_HandleTypeDef *hsai);      /*!< SAI receive complete callback */
   void (*RxHalfCpltCallback)(struct __SAI_HandleTypeDef *hsai);  /*!< SAI receive half complete callback */
   void (*TxCpltCallback)(struct __SAI_HandleTypeDef *hsai);      /*!< SAI transmit complete callback */
   void (*TxHalfCpltCallback)(struct __SAI_HandleTypeDef *hsai);  /*!< SAI transmit half complete callback */
+  void (*RxM0CpltCallback)(struct __SAI_HandleTypeDef *hsai);    /*!< SAI receive memory 0 complete callback */
+  void (*RxM1CpltCallback)(struct __SAI_HandleTypeDef *hsai);    /*!< SAI receive memory 1 complete callback */
   void (*ErrorCallback)(struct __SAI_HandleTypeDef *hsai);       /*!< SAI error callback */
   void (*MspInitCallback)(struct __SAI_HandleTypeDef *hsai);     /*!< SAI MSP init callback */
   void (*MspDeInitCallback)(struct __SAI_HandleTypeDef *hsai);   /*!< SAI MSP de-init callback */
@@ -269,7 +327,9 @@ typedef enum
   HAL_SAI_TX_HALFCOMPLETE_CB_ID   = 0x03U, /*!< SAI transmit half complete callback ID */
   HAL_SAI_ERROR_CB_ID             = 0x04U, /*!< SAI error callback ID */
   HAL_SAI_MSPINIT_CB_ID           = 0x05U, /*!< SAI MSP init callback ID */
-  HAL_SAI_MSPDEINIT_CB_ID         = 0x06U  /*!< SAI MSP de-init callback ID */
+  HAL_SAI_MSPDEINIT_CB_ID         = 0x06U, /*!< SAI MSP de-init callback ID */
+  HAL_SAI_RX_M0_COMPLETE_CB_ID    = 0x07U, /*!< SAI receive memory 0 complete callback ID */
+  HAL_SAI_RX_M1_COMPLETE_CB_ID    = 0x08U  /*!< SAI receive memory 1 complete callback ID */
 } HAL_SAI_CallbackIDTypeDef;
 
 /**
@@ -739,6 +799,14 @@ typedef void (*pSAI_CallbackTypeDef)(SAI_HandleTypeDef *hsai);
   */
 #define __HAL_SAI_DISABLE(__HANDLE__) ((__HANDLE__)->Instance->CR1 &=  ~SAI_xCR1_SAIEN)
 
+/** @brief  Get the address of a sample of a TDM slot view.
+  * @param  __VIEW__ pointer to a SAI_SlotViewTypeDef structure.
+  * @param  __INDEX__ index of the sample, from 0 to NbSamples - 1.
+  * @retval Sample address (void *)
+  */
+#define __HAL_SAI_GET_SLOT_SAMPLE(__VIEW__, __INDEX__) \
+  ((void *)&(__VIEW__)->pBase[(uint32_t)(__INDEX__) * (__VIEW__)->Stride])
+
 /**
   * @}
   */
@@ -756,6 +824,7 @@ typedef void (*pSAI_CallbackTypeDef)(SAI_HandleTypeDef *hsai);
   * @{
   */
 HAL_StatusTypeDef HAL_SAI_InitProtocol(SAI_HandleTypeDef *hsai, uint32_t protocol, uint32_t datasize, uint32_t nbslot);
+HAL_StatusTypeDef HAL_SAI_InitTDM(SAI_HandleTypeDef *hsai, uint32_t datasize, uint32_t nbslot, uint32_t slotactive);
 HAL_StatusTypeDef HAL_SAI_Init(SAI_HandleTypeDef *hsai);
 HAL_StatusTypeDef HAL_SAI_DeInit(SAI_HandleTypeDef *hsai);
 void HAL_SAI_MspInit(SAI_HandleTypeDef *hsai);
@@ -788,10 +857,29 @@ HAL_StatusTypeDef HAL_SAI_Receive_IT(SAI_HandleTypeDef *hsai, uint8_t *pData, ui
 /* Non-Blocking mode: DMA */
 HAL_StatusTypeDef HAL_SAI_Transmit_DMA(SAI_HandleTypeDef *hsai, uint8_t *pData, uint16_t Size);
 HAL_StatusTypeDef HAL_SAI_Receive_DMA(SAI_HandleTypeDef *hsai, uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_SAI_ReceiveDoubleBuffer_DMA(SAI_HandleTypeDef *hsai, uint8_t *pData0, uint8_t *pData1,
+                                                  uint16_t Size);
 HAL_StatusTypeDef HAL_SAI_DMAPause(SAI_HandleTypeDef *hsai);
 HAL_StatusTypeDef HAL_SAI_DMAResume(SAI_HandleTypeDef *hsai);
 HAL_StatusTypeDef HAL_SAI_DMAStop(SAI_HandleTypeDef *hsai);
 
+/* TDM streaming functions */
+HAL_StatusTypeDef HAL_SAI_TDM_Start_DMA(SAI_HandleTypeDef *hsaitx, uint8_t *pTxData,
+                                        SAI_HandleTypeDef *hsairx, uint8_t *pRxData, uint16_t NbFrames);
+HAL_StatusTypeDef HAL_SAI_TDM_Stop_DMA(SAI_HandleTypeDef *hsaitx, SAI_HandleTypeDef *hsairx);
+HAL_StatusTypeDef HAL_SAI_TDM_GetSlotView(const SAI_HandleTypeDef *hsai, uint8_t *pData, uint16_t NbFrames,
+                                          uint32_t Slot, SAI_SlotViewTypeDef *pView);
+#if defined(HAL_MDMA_MODULE_ENABLED)
+HAL_StatusTypeDef HAL_SAI_TDM_DeinterleaveSlot_MDMA(MDMA_HandleTypeDef *hmdma, const SAI_SlotViewTypeDef *pView,
+                                                    uint8_t *pDst);
+HAL_StatusTypeDef HAL_SAI_TDM_InterleaveSlot_MDMA(MDMA_HandleTypeDef *hmdma, const uint8_t *pSrc,
+                                                  const SAI_SlotViewTypeDef *pView);
+#endif /* HAL_MDMA_MODULE_ENABLED */
+
+/* PDM capture functions */
+HAL_StatusTypeDef HAL_SAI_PDMCapture_Start(SAI_HandleTypeDef *hsai, SAI_PDMCaptureTypeDef *pCapture);
+HAL_StatusTypeDef HAL_SAI_PDMCapture_Stop(SAI_HandleTypeDef *hsai);
+
 /* Abort function */
 HAL_StatusTypeDef HAL_SAI_Abort(SAI_HandleTypeDef *hsai);
 
@@ -807,7 +895,10 @@ void HAL_SAI_TxHalfCpltCallback(SAI_HandleTypeDef *hsai);
 void HAL_SAI_TxCpltCallback(SAI_HandleTypeDef *hsai);
 void HAL_SAI_RxHalfCpltCallback(SAI_HandleTypeDef *hsai);
 void HAL_SAI_RxCpltCallback(SAI_HandleTypeDef *hsai);
+void HAL_SAI_RxM0CpltCallback(SAI_HandleTypeDef *hsai);
+void HAL_SAI_RxM1CpltCallback(SAI_HandleTypeDef *hsai);
 void HAL_SAI_ErrorCallback(SAI_HandleTypeDef *hsai);
+void HAL_SAI_PDMCapture_FrameCallback(SAI_HandleTypeDef *hsai);
 /**
   * @}
   */
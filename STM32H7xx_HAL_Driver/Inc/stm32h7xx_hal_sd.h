@@ -111,6 +111,32 @@ typedef struct
 
 } HAL_SD_CardInfoTypeDef;
 
+/**
+  * @brief  SD command queue depth
+  */
+#if !defined (SD_CMDQUEUE_SIZE)
+#define SD_CMDQUEUE_SIZE             4U
+#endif /* SD_CMDQUEUE_SIZE */
+
+/**
+  * @brief  SD command queue entry Structure definition
+  */
+typedef struct
+{
+  uint32_t      Operation;               /*!< Operation, a value of @ref SD_Exported_Constansts_Group5 */
+
+  uint8_t       *pData;                  /*!< Pointer to the data buffer of a read or write operation  */
+
+  uint32_t      BlockAdd;                /*!< Block address of a read or write operation               */
+
+  uint32_t      NumberOfBlocks;          /*!< Number of blocks of a read or write operation            */
+
+  __IO uint32_t ErrorCode;               /*!< Result of the operation (HAL_SD_ERROR_xxx)               */
+
+  __IO uint32_t CardState;               /*!< Card state returned by the last CMD13 of the operation   */
+
+} SD_CmdQueueEntryTypeDef;
+
 /**
   * @brief  SD handle Structure definition
   */
@@ -146,6 +172,32 @@ typedef struct
 
   uint32_t                     CID[4];           /*!< SD card identification number table */
 
+  __IO uint32_t                StreamBufferNbr;    /*!< SD write stream total number of buffers    */
+
+  __IO uint32_t                StreamBufferQueued; /*!< SD write stream number of buffers queued   */
+
+  __IO uint32_t                StreamBufferDone;   /*!< SD write stream number of buffers sent     */
+
+  __IO uint32_t                StreamEndRequest;   /*!< SD write stream early end requested        */
+
+  __IO uint32_t                DblBufRemainingBlocks; /*!< SD double buffer blocks left to transfer */
+
+  uint32_t                     DblBufBlockAdd;        /*!< SD double buffer next block address      */
+
+  uint32_t                     DblBufSegmentBlocks;   /*!< SD double buffer blocks per command      */
+
+  SD_CmdQueueEntryTypeDef      *CmdQueue[SD_CMDQUEUE_SIZE]; /*!< SD command queue entries            */
+
+  __IO uint32_t                CmdQueueHead;          /*!< SD command queue index of the current entry */
+
+  __IO uint32_t                CmdQueueCount;         /*!< SD command queue number of entries          */
+
+  __IO uint32_t                CmdQueuePhase;         /*!< SD command queue phase of the current entry */
+
+  uint32_t                     TuningPhaseSel;        /*!< SD delay block phase selected by tuning     */
+
+  uint32_t                     TuningUnits;           /*!< SD delay block unit delays used by tuning   */
+
 #if defined (USE_HAL_SD_REGISTER_CALLBACKS) && (USE_HAL_SD_REGISTER_CALLBACKS == 1U)
   void (* TxCpltCallback)(struct __SD_HandleTypeDef *hsd);
   void (* RxCpltCallback)(struct __SD_HandleTypeDef *hsd);
@@ -358,6 +410,8 @@ typedef void (*pSD_TransceiverCallbackTypeDef)(FlagStatus status);
 #define   SD_CONTEXT_READ_MULTIPLE_BLOCK  ((uint32_t)0x00000002U)  /*!< Read multiple blocks operation   */
 #define   SD_CONTEXT_WRITE_SINGLE_BLOCK   ((uint32_t)0x00000010U)  /*!< Write single block operation     */
 #define   SD_CONTEXT_WRITE_MULTIPLE_BLOCK ((uint32_t)0x00000020U)  /*!< Write multiple blocks operation  */
+#define   SD_CONTEXT_WRITE_STREAM         ((uint32_t)0x00000040U)  /*!< Write stream operation           */
+#define   SD_CONTEXT_DOUBLE_BUFFER        ((uint32_t)0x00000004U)  /*!< Double buffer DMA operation      */
 #define   SD_CONTEXT_IT                   ((uint32_t)0x00000008U)  /*!< Process in Interrupt mode        */
 #define   SD_CONTEXT_DMA                  ((uint32_t)0x00000080U)  /*!< Process in DMA mode              */
 
@@ -390,6 +444,16 @@ typedef void (*pSD_TransceiverCallbackTypeDef)(FlagStatus status);
   * @}
   */
 
+/** @defgroup SD_Exported_Constansts_Group5 SD command queue operations
+  * @{
+  */
+#define SD_CMDQUEUE_OP_STATUS      ((uint32_t)0x00000000U)  /*!< Wait for the card to be in transfer state      */
+#define SD_CMDQUEUE_OP_READ        ((uint32_t)0x00000001U)  /*!< Read blocks in DMA mode once the card is ready */
+#define SD_CMDQUEUE_OP_WRITE       ((uint32_t)0x00000002U)  /*!< Write blocks in DMA mode once the card is ready*/
+/**
+  * @}
+  */
+
 /**
   * @}
   */
@@ -647,6 +711,13 @@ HAL_StatusTypeDef HAL_SD_ReadBlocks_DMA(SD_HandleTypeDef *hsd, uint8_t *pData, u
                                         uint32_t NumberOfBlocks);
 HAL_StatusTypeDef HAL_SD_WriteBlocks_DMA(SD_HandleTypeDef *hsd, const uint8_t *pData, uint32_t BlockAdd,
                                          uint32_t NumberOfBlocks);
+HAL_StatusTypeDef HAL_SD_ReadBlocks_DMADoubleBuffer(SD_HandleTypeDef *hsd, uint8_t *pData0, uint8_t *pData1,
+                                                    uint32_t BufferSize, uint32_t BlockAdd, uint32_t NumberOfBlocks);
+HAL_StatusTypeDef HAL_SD_WriteBlocks_DMADoubleBuffer(SD_HandleTypeDef *hsd, const uint8_t *pData0,
+                                                     const uint8_t *pData1, uint32_t BufferSize, uint32_t BlockAdd,
+                                                     uint32_t NumberOfBlocks);
+/* Non-Blocking mode: command queue */
+HAL_StatusTypeDef HAL_SD_CmdQueue_Submit(SD_HandleTypeDef *hsd, SD_CmdQueueEntryTypeDef *pEntry);
 
 void              HAL_SD_IRQHandler(SD_HandleTypeDef *hsd);
 
@@ -655,6 +726,7 @@ void              HAL_SD_TxCpltCallback(SD_HandleTypeDef *hsd);
 void              HAL_SD_RxCpltCallback(SD_HandleTypeDef *hsd);
 void              HAL_SD_ErrorCallback(SD_HandleTypeDef *hsd);
 void              HAL_SD_AbortCallback(SD_HandleTypeDef *hsd);
+void              HAL_SD_CmdQueueCpltCallback(SD_HandleTypeDef *hsd, SD_CmdQueueEntryTypeDef *pEntry);
 
 #if (USE_SD_TRANSCEIVER != 0U)
 /* Callback to switch in 1.8V mode */
@@ -682,6 +754,11 @@ HAL_StatusTypeDef HAL_SD_UnRegisterTransceiverCallback(SD_HandleTypeDef *hsd);
   */
 HAL_StatusTypeDef HAL_SD_ConfigWideBusOperation(SD_HandleTypeDef *hsd, uint32_t WideMode);
 HAL_StatusTypeDef HAL_SD_ConfigSpeedBusOperation(SD_HandleTypeDef *hsd, uint32_t SpeedMode);
+#if defined (DLYB_SDMMC1) || defined (DLYB_SDMMC2)
+HAL_StatusTypeDef HAL_SD_ExecuteTuning(SD_HandleTypeDef *hsd);
+HAL_StatusTypeDef HAL_SD_GetTuningConfig(SD_HandleTypeDef *hsd, uint32_t *pPhaseSel, uint32_t *pUnits);
+HAL_StatusTypeDef HAL_SD_SetTuningConfig(SD_HandleTypeDef *hsd, uint32_t PhaseSel, uint32_t Units);
+#endif /* (DLYB_SDMMC1) || (DLYB_SDMMC2) */
 /**
   * @}
   */
@@ -79,6 +79,21 @@ void HAL_SDEx_Read_DMADoubleBuf1CpltCallback(SD_HandleTypeDef *hsd);
 void HAL_SDEx_Write_DMADoubleBuf0CpltCallback(SD_HandleTypeDef *hsd);
 void HAL_SDEx_Write_DMADoubleBuf1CpltCallback(SD_HandleTypeDef *hsd);
 
+/**
+  * @}
+  */
+
+/** @defgroup SDEx_Exported_Functions_Group2 Write stream functions
+  * @{
+  */
+
+HAL_StatusTypeDef HAL_SDEx_WriteStream_Begin(SD_HandleTypeDef *hsd, uint32_t BlockAdd, uint32_t NumberOfBlocks,
+                                             uint32_t BlocksPerBuffer, const uint8_t *pData0, const uint8_t *pData1);
+HAL_StatusTypeDef HAL_SDEx_WriteStream_Append(SD_HandleTypeDef *hsd, const uint8_t *pData);
+HAL_StatusTypeDef HAL_SDEx_WriteStream_End(SD_HandleTypeDef *hsd);
+
+void HAL_SDEx_WriteStream_BufferCpltCallback(SD_HandleTypeDef *hsd);
+
 /**
   * @}
   */
@@ -0,0 +1,394 @@
+/**
+  ******************************************************************************
+  * @file    stm32h7xx_hal_sdio.h
+  * @author  MCD Application Team
+  * @brief   Header file of SDIO HAL module.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef STM32H7xx_HAL_SDIO_H
+#define STM32H7xx_HAL_SDIO_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32h7xx_ll_sdmmc.h"
+
+/** @addtogroup STM32H7xx_HAL_Driver
+  * @{
+  */
+
+/** @defgroup SDIO SDIO
+  * @brief SDIO HAL module driver
+  * @{
+  */
+
+/* Private constants ---------------------------------------------------------*/
+/** @defgroup SDIO_Private_Constants SDIO Private Constants
+  * @{
+  */
+#define SDIO_MAX_IO_NUMBER                  8U            /*!< CIA and up to 7 I/O functions         */
+#define SDIO_INIT_FREQ                      400000U       /*!< Initialization phase : 400 kHz max    */
+#define SDIO_OCR_TIMEOUT                    1000U         /*!< CMD5 power up timeout (in ms)         */
+
+#define SDIO_CONTEXT_NONE                   0x00000000U   /*!< None                                  */
+#define SDIO_CONTEXT_READ                   0x00000001U   /*!< CMD53 read ongoing                    */
+#define SDIO_CONTEXT_WRITE                  0x00000002U   /*!< CMD53 write ongoing                   */
+/**
+  * @}
+  */
+
+/* Exported types ------------------------------------------------------------*/
+/** @defgroup SDIO_Exported_Types SDIO Exported Types
+  * @{
+  */
+
+/** @defgroup SDIO_Exported_Types_Group1 SDIO State enumeration structure
+  * @{
+  */
+typedef enum
+{
+  HAL_SDIO_STATE_RESET                = ((uint32_t)0x00000000U),  /*!< SDIO not yet initialized or disabled */
+  HAL_SDIO_STATE_READY                = ((uint32_t)0x00000001U),  /*!< SDIO initialized and ready for use   */
+  HAL_SDIO_STATE_BUSY                 = ((uint32_t)0x00000002U),  /*!< SDIO process ongoing                 */
+  HAL_SDIO_STATE_ERROR                = ((uint32_t)0x0000000FU)   /*!< SDIO is in error state               */
+} HAL_SDIO_StateTypeDef;
+/**
+  * @}
+  */
+
+/** @defgroup SDIO_Exported_Types_Group2 SDIO Handle Structure definition
+  * @{
+  */
+#define SDIO_InitTypeDef      SDMMC_InitTypeDef
+#define SDIO_TypeDef          SDMMC_TypeDef
+
+/**
+  * @brief  SDIO handle Structure definition
+  */
+#if defined (USE_HAL_SDIO_REGISTER_CALLBACKS) && (USE_HAL_SDIO_REGISTER_CALLBACKS == 1U)
+typedef struct __SDIO_HandleTypeDef
+#else
+typedef struct
+#endif /* USE_HAL_SDIO_REGISTER_CALLBACKS */
+{
+  SDIO_TypeDef                 *Instance;        /*!< SDMMC registers base address         */
+
+  SDIO_InitTypeDef             Init;             /*!< SDIO required parameters             */
+
+  HAL_LockTypeDef              Lock;             /*!< SDIO locking object                  */
+
+  uint8_t                      *pXferBuff;       /*!< Pointer to the ongoing CMD53 buffer  */
+
+  uint32_t                     XferSize;         /*!< Size of the ongoing CMD53 transfer   */
+
+  uint32_t                     XferFunction;     /*!< I/O function of the ongoing CMD53    */
+
+  __IO uint32_t                Context;          /*!< SDIO transfer context                */
+
+  __IO HAL_SDIO_StateTypeDef   State;            /*!< SDIO card State                      */
+
+  __IO uint32_t                ErrorCode;        /*!< SDIO Card Error codes                */
+
+  uint16_t                     RCA;              /*!< SDIO card relative address           */
+
+  uint16_t                     BlockSize[SDIO_MAX_IO_NUMBER]; /*!< Block size of each I/O function */
+
+  uint32_t                     IOFunctionMask;   /*!< I/O functions interrupts enabled in the card */
+
+#if defined (USE_HAL_SDIO_REGISTER_CALLBACKS) && (USE_HAL_SDIO_REGISTER_CALLBACKS == 1U)
+  void (* TxCpltCallback)(struct __SDIO_HandleTypeDef *hsdio);
+  void (* RxCpltCallback)(struct __SDIO_HandleTypeDef *hsdio);
+  void (* ErrorCallback)(struct __SDIO_HandleTypeDef *hsdio);
+  void (* IOFunctionCallback)(struct __SDIO_HandleTypeDef *hsdio);
+
+  void (* MspInitCallback)(struct __SDIO_HandleTypeDef *hsdio);
+  void (* MspDeInitCallback)(struct __SDIO_HandleTypeDef *hsdio);
+#endif /* USE_HAL_SDIO_REGISTER_CALLBACKS */
+} SDIO_HandleTypeDef;
+/**
+  * @}
+  */
+
+/** @defgroup SDIO_Exported_Types_Group3 SDIO Extended command structure
+  * @{
+  */
+typedef struct
+{
+  uint32_t IOFunctionNbr;   /*!< I/O function number, from 0 (CIA) to 7           */
+
+  uint32_t RegAddr;         /*!< Register address in the function, 17 bits        */
+
+  uint32_t OpCode;          /*!< Address increment mode.
+                                 This parameter can be a value of @ref SDIO_Exported_Constants_Group2 */
+
+  uint32_t Block;           /*!< Transfer mode.
+                                 This parameter can be a value of @ref SDIO_Exported_Constants_Group3 */
+} SDIO_ExtendedCmdTypeDef;
+/**
+  * @}
+  */
+
+#if defined (USE_HAL_SDIO_REGISTER_CALLBACKS) && (USE_HAL_SDIO_REGISTER_CALLBACKS == 1U)
+/** @defgroup SDIO_Exported_Types_Group4 SDIO Callback ID enumeration definition
+  * @{
+  */
+typedef enum
+{
+  HAL_SDIO_TX_CPLT_CB_ID                 = 0x00U,  /*!< SDIO Tx Complete Callback ID      */
+  HAL_SDIO_RX_CPLT_CB_ID                 = 0x01U,  /*!< SDIO Rx Complete Callback ID      */
+  HAL_SDIO_ERROR_CB_ID                   = 0x02U,  /*!< SDIO Error Callback ID            */
+  HAL_SDIO_IO_FUNCTION_CB_ID             = 0x03U,  /*!< SDIO card interrupt Callback ID   */
+
+  HAL_SDIO_MSP_INIT_CB_ID                = 0x10U,  /*!< SDIO MspInit Callback ID          */
+  HAL_SDIO_MSP_DEINIT_CB_ID              = 0x11U   /*!< SDIO MspDeInit Callback ID        */
+} HAL_SDIO_CallbackIDTypeDef;
+
+/**
+  * @brief  SDIO Callback pointer definition
+  */
+typedef void (*pSDIO_CallbackTypeDef)(SDIO_HandleTypeDef *hsdio);
+/**
+  * @}
+  */
+#endif /* USE_HAL_SDIO_REGISTER_CALLBACKS */
+
+/**
+  * @}
+  */
+
+/* Exported constants --------------------------------------------------------*/
+/** @defgroup SDIO_Exported_Constants SDIO Exported Constants
+  * @{
+  */
+
+/** @defgroup SDIO_Exported_Constants_Group1 SDIO Error status enumeration Structure definition
+  * @{
+  */
+#define HAL_SDIO_ERROR_NONE                 SDMMC_ERROR_NONE                  /*!< No error                          */
+#define HAL_SDIO_ERROR_CMD_CRC_FAIL         SDMMC_ERROR_CMD_CRC_FAIL          /*!< Command response CRC check failed */
+#define HAL_SDIO_ERROR_DATA_CRC_FAIL        SDMMC_ERROR_DATA_CRC_FAIL         /*!< Data block CRC check failed       */
+#define HAL_SDIO_ERROR_CMD_RSP_TIMEOUT      SDMMC_ERROR_CMD_RSP_TIMEOUT       /*!< Command response timeout          */
+#define HAL_SDIO_ERROR_DATA_TIMEOUT         SDMMC_ERROR_DATA_TIMEOUT          /*!< Data timeout                      */
+#define HAL_SDIO_ERROR_TX_UNDERRUN          SDMMC_ERROR_TX_UNDERRUN           /*!< Transmit FIFO underrun            */
+#define HAL_SDIO_ERROR_RX_OVERRUN           SDMMC_ERROR_RX_OVERRUN            /*!< Receive FIFO overrun              */
+#define HAL_SDIO_ERROR_ADDR_OUT_OF_RANGE    SDMMC_ERROR_ADDR_OUT_OF_RANGE     /*!< Register address out of range     */
+#define HAL_SDIO_ERROR_ILLEGAL_CMD          SDMMC_ERROR_ILLEGAL_CMD           /*!< Command is not legal              */
+#define HAL_SDIO_ERROR_GENERAL_UNKNOWN_ERR  SDMMC_ERROR_GENERAL_UNKNOWN_ERR   /*!< General or unknown error          */
+#define HAL_SDIO_ERROR_PARAM                SDMMC_ERROR_INVALID_PARAMETER     /*!< Invalid parameter or function     */
+#define HAL_SDIO_ERROR_BUSY                 SDMMC_ERROR_BUSY                  /*!< A transfer is ongoing             */
+#define HAL_SDIO_ERROR_TIMEOUT              SDMMC_ERROR_TIMEOUT               /*!< Timeout error                     */
+#define HAL_SDIO_ERROR_DMA                  SDMMC_ERROR_DMA                   /*!< Error while IDMA transfer         */
+#if defined (USE_HAL_SDIO_REGISTER_CALLBACKS) && (USE_HAL_SDIO_REGISTER_CALLBACKS == 1U)
+#define HAL_SDIO_ERROR_INVALID_CALLBACK     SDMMC_ERROR_INVALID_PARAMETER     /*!< Invalid callback error            */
+#endif /* USE_HAL_SDIO_REGISTER_CALLBACKS */
+/**
+  * @}
+  */
+
+/** @defgroup SDIO_Exported_Constants_Group2 SDIO Extended command address mode
+  * @{
+  */
+#define HAL_SDIO_OP_CODE_NO_INC             0x00000000U  /*!< Multi byte R/W to a fixed address (FIFO)  */
+#define HAL_SDIO_OP_CODE_AUTO_INC           0x00000001U  /*!< Multi byte R/W to an incrementing address */
+/**
+  * @}
+  */
+
+/** @defgroup SDIO_Exported_Constants_Group3 SDIO Extended command transfer mode
+  * @{
+  */
+#define HAL_SDIO_MODE_BYTE                  0x00000000U  /*!< Byte mode, up to 512 bytes               */
+#define HAL_SDIO_MODE_BLOCK                 0x00000001U  /*!< Block mode, up to 511 blocks             */
+/**
+  * @}
+  */
+
+/** @defgroup SDIO_Exported_Constants_Group4 SDIO CCCR registers
+  * @{
+  */
+#define SDIO_CCCR_IO_ENABLE                 0x02U   /*!< I/O enable                          */
+#define SDIO_CCCR_IO_READY                  0x03U   /*!< I/O ready                           */
+#define SDIO_CCCR_INT_ENABLE                0x04U   /*!< Interrupt enable                    */
+#define SDIO_CCCR_INT_PENDING               0x05U   /*!< Interrupt pending                   */
+#define SDIO_CCCR_IO_ABORT                  0x06U   /*!< I/O abort                           */
+#define SDIO_CCCR_BUS_INTERFACE             0x07U   /*!< Bus interface control               */
+#define SDIO_CCCR_CAPABILITY                0x08U   /*!< Card capability                     */
+#define SDIO_CCCR_BLOCK_SIZE                0x10U   /*!< Function 0 block size (2 bytes)     */
+#define SDIO_CCCR_BUS_SPEED                 0x13U   /*!< Bus speed select                    */
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/* Exported macro ------------------------------------------------------------*/
+/** @defgroup SDIO_Exported_macros SDIO Exported Macros
+  * @{
+  */
+
+/** @brief Reset SDIO handle state.
+  * @param  __HANDLE__ SDIO Handle.
+  * @retval None
+  */
+#if defined (USE_HAL_SDIO_REGISTER_CALLBACKS) && (USE_HAL_SDIO_REGISTER_CALLBACKS == 1U)
+#define __HAL_SDIO_RESET_HANDLE_STATE(__HANDLE__)           do {                                              \
+                                                                 (__HANDLE__)->State = HAL_SDIO_STATE_RESET; \
+                                                                 (__HANDLE__)->MspInitCallback = NULL;       \
+                                                                 (__HANDLE__)->MspDeInitCallback = NULL;     \
+                                                               } while(0)
+#else
+#define __HAL_SDIO_RESET_HANDLE_STATE(__HANDLE__)           ((__HANDLE__)->State = HAL_SDIO_STATE_RESET)
+#endif /* USE_HAL_SDIO_REGISTER_CALLBACKS */
+
+/**
+  * @brief  Enable the SDIO device interrupt.
+  * @param  __HANDLE__ SDIO Handle.
+  * @param  __INTERRUPT__ specifies the SDMMC interrupt sources to be enabled.
+  * @retval None
+  */
+#define __HAL_SDIO_ENABLE_IT(__HANDLE__, __INTERRUPT__) __SDMMC_ENABLE_IT((__HANDLE__)->Instance, (__INTERRUPT__))
+
+/**
+  * @brief  Disable the SDIO device interrupt.
+  * @param  __HANDLE__ SDIO Handle.
+  * @param  __INTERRUPT__ specifies the SDMMC interrupt sources to be disabled.
+  * @retval None
+  */
+#define __HAL_SDIO_DISABLE_IT(__HANDLE__, __INTERRUPT__) __SDMMC_DISABLE_IT((__HANDLE__)->Instance, (__INTERRUPT__))
+
+/**
+  * @brief  Check whether the specified SDIO flag is set or not.
+  * @param  __HANDLE__ SDIO Handle.
+  * @param  __FLAG__ specifies the flag to check.
+  * @retval The new state of SDIO FLAG (SET or RESET).
+  */
+#define __HAL_SDIO_GET_FLAG(__HANDLE__, __FLAG__) __SDMMC_GET_FLAG((__HANDLE__)->Instance, (__FLAG__))
+
+/**
+  * @brief  Clear the SDIO's pending flags.
+  * @param  __HANDLE__ SDIO Handle.
+  * @param  __FLAG__ specifies the flag to clear.
+  * @retval None
+  */
+#define __HAL_SDIO_CLEAR_FLAG(__HANDLE__, __FLAG__) __SDMMC_CLEAR_FLAG((__HANDLE__)->Instance, (__FLAG__))
+
+/**
+  * @}
+  */
+
+/* Private macros ------------------------------------------------------------*/
+/** @defgroup SDIO_Private_Macros SDIO Private Macros
+  * @{
+  */
+#define IS_SDIO_FUNCTION(FUNCTION)          ((FUNCTION) < SDIO_MAX_IO_NUMBER)
+
+#define IS_SDIO_REG_ADDR(ADDR)              ((ADDR) <= 0x1FFFFU)
+
+#define IS_SDIO_OP_CODE(CODE)               (((CODE) == HAL_SDIO_OP_CODE_NO_INC) || \
+                                             ((CODE) == HAL_SDIO_OP_CODE_AUTO_INC))
+
+#define IS_SDIO_MODE(MODE)                  (((MODE) == HAL_SDIO_MODE_BYTE) || \
+                                             ((MODE) == HAL_SDIO_MODE_BLOCK))
+/**
+  * @}
+  */
+
+/* Exported functions --------------------------------------------------------*/
+/** @defgroup SDIO_Exported_Functions SDIO Exported Functions
+  * @{
+  */
+
+/** @defgroup SDIO_Exported_Functions_Group1 Initialization and de-initialization functions
+  * @{
+  */
+HAL_StatusTypeDef HAL_SDIO_Init(SDIO_HandleTypeDef *hsdio);
+HAL_StatusTypeDef HAL_SDIO_DeInit(SDIO_HandleTypeDef *hsdio);
+void HAL_SDIO_MspInit(SDIO_HandleTypeDef *hsdio);
+void HAL_SDIO_MspDeInit(SDIO_HandleTypeDef *hsdio);
+/**
+  * @}
+  */
+
+/** @defgroup SDIO_Exported_Functions_Group2 Input and Output operation functions
+  * @{
+  */
+HAL_StatusTypeDef HAL_SDIO_ReadDirect(SDIO_HandleTypeDef *hsdio, uint32_t IOFunctionNbr, uint32_t RegAddr,
+                                      uint8_t *pData);
+HAL_StatusTypeDef HAL_SDIO_WriteDirect(SDIO_HandleTypeDef *hsdio, uint32_t IOFunctionNbr, uint32_t RegAddr,
+                                       uint8_t Data);
+HAL_StatusTypeDef HAL_SDIO_ReadExtended_DMA(SDIO_HandleTypeDef *hsdio, const SDIO_ExtendedCmdTypeDef *pArgument,
+                                            uint8_t *pData, uint32_t Size);
+HAL_StatusTypeDef HAL_SDIO_WriteExtended_DMA(SDIO_HandleTypeDef *hsdio, const SDIO_ExtendedCmdTypeDef *pArgument,
+                                             const uint8_t *pData, uint32_t Size);
+
+void HAL_SDIO_IRQHandler(SDIO_HandleTypeDef *hsdio);
+
+void HAL_SDIO_TxCpltCallback(SDIO_HandleTypeDef *hsdio);
+void HAL_SDIO_RxCpltCallback(SDIO_HandleTypeDef *hsdio);
+void HAL_SDIO_ErrorCallback(SDIO_HandleTypeDef *hsdio);
+void HAL_SDIO_IOFunctionCallback(SDIO_HandleTypeDef *hsdio);
+
+#if defined (USE_HAL_SDIO_REGISTER_CALLBACKS) && (USE_HAL_SDIO_REGISTER_CALLBACKS == 1U)
+HAL_StatusTypeDef HAL_SDIO_RegisterCallback(SDIO_HandleTypeDef *hsdio, HAL_SDIO_CallbackIDTypeDef CallbackID,
+                                            pSDIO_CallbackTypeDef pCallback);
+HAL_StatusTypeDef HAL_SDIO_UnRegisterCallback(SDIO_HandleTypeDef *hsdio, HAL_SDIO_CallbackIDTypeDef CallbackID);
+#endif /* USE_HAL_SDIO_REGISTER_CALLBACKS */
+/**
+  * @}
+  */
+
+/** @defgroup SDIO_Exported_Functions_Group3 Peripheral Control functions
+  * @{
+  */
+HAL_StatusTypeDef HAL_SDIO_SetBlockSize(SDIO_HandleTypeDef *hsdio, uint32_t IOFunctionNbr, uint16_t BlockSize);
+HAL_StatusTypeDef HAL_SDIO_EnableIOFunction(SDIO_HandleTypeDef *hsdio, uint32_t IOFunctionNbr, uint32_t Timeout);
+HAL_StatusTypeDef HAL_SDIO_EnableIOFunctionInterrupt(SDIO_HandleTypeDef *hsdio, uint32_t IOFunctionNbr);
+HAL_StatusTypeDef HAL_SDIO_DisableIOFunctionInterrupt(SDIO_HandleTypeDef *hsdio, uint32_t IOFunctionNbr);
+void HAL_SDIO_AcknowledgeIOInterrupt(SDIO_HandleTypeDef *hsdio);
+/**
+  * @}
+  */
+
+/** @defgroup SDIO_Exported_Functions_Group4 Peripheral State functions
+  * @{
+  */
+HAL_SDIO_StateTypeDef HAL_SDIO_GetState(const SDIO_HandleTypeDef *hsdio);
+uint32_t HAL_SDIO_GetError(const SDIO_HandleTypeDef *hsdio);
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* STM32H7xx_HAL_SDIO_H */
@@ -108,6 +108,17 @@ typedef struct
 
 } SPDIFRX_SetDataFormatTypeDef;
 
+/**
+  * @brief SPDIFRX control flow block structure definition
+  */
+typedef struct
+{
+  uint8_t ChannelStatus[24];         /*!< 192 channel status bits of a block, bit 0 of byte 0 first */
+
+  uint8_t UserData[48];              /*!< 384 user data bits of a block (both sub-frames), bit 0 of byte 0 first */
+
+} SPDIFRX_CtrlBlockTypeDef;
+
 /**
   * @brief  HAL State structures definition
   */
@@ -166,6 +177,10 @@ typedef struct
 
   __IO uint32_t  ErrorCode;                /* SPDIFRX Error code */
 
+  __IO uint32_t  StreamMode;               /* Set while a stream started by HAL_SPDIFRX_StartStream_DMA() runs */
+
+  __IO uint32_t  SyncLossCount;            /* Number of synchronization losses recovered by the stream */
+
 #if (USE_HAL_SPDIFRX_REGISTER_CALLBACKS == 1)
   void (*RxHalfCpltCallback)(struct __SPDIFRX_HandleTypeDef *hspdif);   /*!< SPDIFRX Data flow half completed callback */
   void (*RxCpltCallback)(struct __SPDIFRX_HandleTypeDef *hspdif);       /*!< SPDIFRX Data flow completed callback */
@@ -358,6 +373,14 @@ typedef  void (*pSPDIFRX_CallbackTypeDef)(SPDIFRX_HandleTypeDef *hspdif);  /*!<
   * @}
   */
 
+/** @defgroup SPDIFRX_Ctrl_Block SPDIFRX Control Flow Block
+  * @{
+  */
+#define SPDIFRX_CTRL_BLOCK_WORDS  24U   /*!< Control flow words of a 192-frame block (8 frames per word) */
+/**
+  * @}
+  */
+
 /**
   * @}
   */
@@ -515,12 +538,20 @@ HAL_StatusTypeDef HAL_SPDIFRX_ReceiveCtrlFlow_DMA(SPDIFRX_HandleTypeDef *hspdif,
 HAL_StatusTypeDef HAL_SPDIFRX_ReceiveDataFlow_DMA(SPDIFRX_HandleTypeDef *hspdif, uint32_t *pData, uint16_t Size);
 HAL_StatusTypeDef HAL_SPDIFRX_DMAStop(SPDIFRX_HandleTypeDef *hspdif);
 
+/* Continuous stream */
+HAL_StatusTypeDef HAL_SPDIFRX_StartStream_DMA(SPDIFRX_HandleTypeDef *hspdif, uint32_t *pData, uint16_t Size,
+                                              uint32_t *pCtrl, uint16_t CtrlSize);
+HAL_StatusTypeDef HAL_SPDIFRX_StopStream_DMA(SPDIFRX_HandleTypeDef *hspdif);
+HAL_StatusTypeDef HAL_SPDIFRX_GetCtrlBlock(const uint32_t *pCtrl, uint32_t NbWords,
+                                           SPDIFRX_CtrlBlockTypeDef *pBlock);
+
 /* Callbacks used in non blocking modes (Interrupt and DMA) *******************/
 void HAL_SPDIFRX_RxHalfCpltCallback(SPDIFRX_HandleTypeDef *hspdif);
 void HAL_SPDIFRX_RxCpltCallback(SPDIFRX_HandleTypeDef *hspdif);
 void HAL_SPDIFRX_ErrorCallback(SPDIFRX_HandleTypeDef *hspdif);
 void HAL_SPDIFRX_CxHalfCpltCallback(SPDIFRX_HandleTypeDef *hspdif);
 void HAL_SPDIFRX_CxCpltCallback(SPDIFRX_HandleTypeDef *hspdif);
+void HAL_SPDIFRX_StreamSyncCallback(SPDIFRX_HandleTypeDef *hspdif, uint32_t Synchronized);
 /**
   * @}
   */
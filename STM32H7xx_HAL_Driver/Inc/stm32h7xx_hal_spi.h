@@ -163,6 +163,54 @@ typedef struct
 } SPI_ReloadTypeDef;
 #endif /* USE_SPI_RELOAD_TRANSFER */
 
+#if !defined(SPI_NSSFRAME_QUEUE_SIZE)
+#define SPI_NSSFRAME_QUEUE_SIZE    8UL   /*!< Frames held by the queue of an NSS framed slave, power of 2 */
+#endif /* SPI_NSSFRAME_QUEUE_SIZE */
+
+/**
+  * @brief  SPI NSS frame descriptor structure definition
+  */
+typedef struct
+{
+  uint16_t                   Offset;                       /*!< Index of the first data of the frame in the
+                                                                reception buffer                          */
+
+  uint16_t                   Length;                       /*!< Number of data of the frame               */
+
+} SPI_NSSFrameDescTypeDef;
+
+/**
+  * @brief  SPI NSS framed slave structure definition
+  * @note   Allocated by the application and handed to HAL_SPIEx_NSSFrame_Start(), it is used by
+  *         the driver until HAL_SPIEx_NSSFrame_Stop(). The queue indexes run freely, the queue
+  *         being empty when they are equal.
+  */
+typedef struct
+{
+  uint8_t                    *pRxBuffer;                   /*!< Circular reception buffer                 */
+
+  uint16_t                   RxSize;                       /*!< Data held by pRxBuffer                    */
+
+  uint16_t                   RxTail;                       /*!< Index of the first data of the next frame */
+
+  __IO uint32_t              NextTxAddress;                /*!< Response of the next frame, 0 if none     */
+
+  __IO uint32_t              NextTxSize;                   /*!< Data of the response of the next frame    */
+
+  uint32_t                   TxActive;                     /*!< Tx DMA started for the current frame      */
+
+  SPI_NSSFrameDescTypeDef    Queue[SPI_NSSFRAME_QUEUE_SIZE]; /*!< Frames received and not yet read        */
+
+  __IO uint32_t              QueueHead;                    /*!< Written by the NSS edge handler           */
+
+  __IO uint32_t              QueueTail;                    /*!< Written by HAL_SPIEx_NSSFrame_Get()       */
+
+  __IO uint32_t              FrameCount;                   /*!< Frames received since the start           */
+
+  __IO uint32_t              DropCount;                    /*!< Frames lost on a full queue               */
+
+} SPI_NSSFrameTypeDef;
+
 /**
   * @brief  SPI handle Structure definition
   */
@@ -200,6 +248,8 @@ typedef struct __SPI_HandleTypeDef
 
   __IO uint32_t              ErrorCode;                    /*!< SPI Error code                           */
 
+  SPI_NSSFrameTypeDef        *pNSSFrame;                   /*!< NSS framed slave context, NULL if none   */
+
 #if defined(USE_SPI_RELOAD_TRANSFER)
 
   SPI_ReloadTypeDef          Reload;                       /*!< SPI reload parameters                    */
@@ -213,6 +263,8 @@ typedef struct __SPI_HandleTypeDef
   void (* TxHalfCpltCallback)(struct __SPI_HandleTypeDef *hspi);   /*!< SPI Tx Half Completed callback     */
   void (* RxHalfCpltCallback)(struct __SPI_HandleTypeDef *hspi);   /*!< SPI Rx Half Completed callback     */
   void (* TxRxHalfCpltCallback)(struct __SPI_HandleTypeDef *hspi); /*!< SPI TxRx Half Completed callback   */
+  void (* RxM0CpltCallback)(struct __SPI_HandleTypeDef *hspi);     /*!< SPI Rx Memory 0 Completed callback */
+  void (* RxM1CpltCallback)(struct __SPI_HandleTypeDef *hspi);     /*!< SPI Rx Memory 1 Completed callback */
   void (* ErrorCallback)(struct __SPI_HandleTypeDef *hspi);        /*!< SPI Error callback                 */
   void (* AbortCpltCallback)(struct __SPI_HandleTypeDef *hspi);    /*!< SPI Abort callback                 */
   void (* SuspendCallback)(struct __SPI_HandleTypeDef *hspi);      /*!< SPI Suspend callback               */
@@ -238,7 +290,9 @@ typedef enum
   HAL_SPI_ABORT_CB_ID                   = 0x07UL,    /*!< SPI Abort callback ID                */
   HAL_SPI_SUSPEND_CB_ID                 = 0x08UL,    /*!< SPI Suspend callback ID              */
   HAL_SPI_MSPINIT_CB_ID                 = 0x09UL,    /*!< SPI Msp Init callback ID             */
-  HAL_SPI_MSPDEINIT_CB_ID               = 0x0AUL     /*!< SPI Msp DeInit callback ID           */
+  HAL_SPI_MSPDEINIT_CB_ID               = 0x0AUL,    /*!< SPI Msp DeInit callback ID           */
+  HAL_SPI_RX_M0_COMPLETE_CB_ID          = 0x0BUL,    /*!< SPI Rx Memory 0 Completed callback ID */
+  HAL_SPI_RX_M1_COMPLETE_CB_ID          = 0x0CUL     /*!< SPI Rx Memory 1 Completed callback ID */
 
 } HAL_SPI_CallbackIDTypeDef;
 
@@ -873,6 +927,8 @@ HAL_StatusTypeDef HAL_SPI_TransmitReceive_IT(SPI_HandleTypeDef *hspi, const uint
 
 HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef *hspi, const uint8_t *pData, uint16_t Size);
 HAL_StatusTypeDef HAL_SPI_Receive_DMA(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_SPI_ReceiveDoubleBuffer_DMA(SPI_HandleTypeDef *hspi, uint8_t *pData0, uint8_t *pData1,
+                                                  uint16_t Size);
 HAL_StatusTypeDef HAL_SPI_TransmitReceive_DMA(SPI_HandleTypeDef *hspi, const uint8_t *pTxData, uint8_t *pRxData,
                                               uint16_t Size);
 
@@ -898,6 +954,8 @@ void HAL_SPI_TxRxCpltCallback(SPI_HandleTypeDef *hspi);
 void HAL_SPI_TxHalfCpltCallback(SPI_HandleTypeDef *hspi);
 void HAL_SPI_RxHalfCpltCallback(SPI_HandleTypeDef *hspi);
 void HAL_SPI_TxRxHalfCpltCallback(SPI_HandleTypeDef *hspi);
+void HAL_SPI_RxM0CpltCallback(SPI_HandleTypeDef *hspi);
+void HAL_SPI_RxM1CpltCallback(SPI_HandleTypeDef *hspi);
 void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *hspi);
 void HAL_SPI_AbortCpltCallback(SPI_HandleTypeDef *hspi);
 void HAL_SPI_SuspendCallback(SPI_HandleTypeDef *hspi);
@@ -79,6 +79,20 @@ HAL_StatusTypeDef HAL_SPIEx_ConfigureUnderrun(SPI_HandleTypeDef *hspi, uint32_t
 /**
   * @}
   */
+
+/** @addtogroup SPIEx_Exported_Functions_Group2
+  * @{
+  */
+HAL_StatusTypeDef HAL_SPIEx_NSSFrame_Start(SPI_HandleTypeDef *hspi, SPI_NSSFrameTypeDef *pFrame, uint8_t *pRxBuffer,
+                                           uint16_t RxSize, const uint8_t *pTxData, uint16_t TxSize);
+HAL_StatusTypeDef HAL_SPIEx_NSSFrame_Stop(SPI_HandleTypeDef *hspi);
+HAL_StatusTypeDef HAL_SPIEx_NSSFrame_SetResponse(SPI_HandleTypeDef *hspi, const uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_SPIEx_NSSFrame_Get(SPI_HandleTypeDef *hspi, uint32_t *pOffset, uint32_t *pLength);
+void              HAL_SPIEx_NSSFrame_IRQHandler(SPI_HandleTypeDef *hspi);
+void              HAL_SPIEx_NSSFrameCallback(SPI_HandleTypeDef *hspi);
+/**
+  * @}
+  */
 /**
   * @}
   */
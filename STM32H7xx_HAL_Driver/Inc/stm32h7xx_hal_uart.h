@@ -213,9 +213,70 @@ typedef uint32_t HAL_UART_RxTypeTypeDef;
   *           HAL_UART_RXEVENT_TC                 = 0x00U,
   *           HAL_UART_RXEVENT_HT                 = 0x01U,
   *           HAL_UART_RXEVENT_IDLE               = 0x02U,
+  *           HAL_UART_RXEVENT_RTO                = 0x03U,
   */
 typedef uint32_t HAL_UART_RxEventTypeTypeDef;
 
+/**
+  * @brief  UART Rx ring buffer structure definition
+  * @note   Head is only written by the driver and Tail only by the reader, so the
+  *         ring can be drained from thread context without disabling interrupts.
+  *         Both indexes are free running, the position in pBuffer is (index & Mask).
+  */
+typedef struct
+{
+  uint8_t                       *pBuffer;         /*!< Ring storage, owned by the application              */
+
+  uint32_t                      Mask;             /*!< Ring size minus one, the size is a power of two      */
+
+  __IO uint32_t                 Head;             /*!< Write index, updated by the driver from the DMA NDTR */
+
+  __IO uint32_t                 Tail;             /*!< Read index, updated by the reader                    */
+
+  __IO uint32_t                 Overrun;          /*!< Count of updates that found the reader overtaken     */
+
+} UART_RingTypeDef;
+
+/**
+  * @brief  UART received frame descriptor structure definition
+  */
+typedef struct
+{
+  uint32_t                      Start;            /*!< Free running ring index of the first byte of the frame */
+
+  uint32_t                      Length;           /*!< Number of bytes of the frame                           */
+
+  uint32_t                      Errors;           /*!< Line errors seen during the frame, a combination of
+                                                       HAL_UART_ERROR_PE, _NE, _FE and _ORE                   */
+
+} UART_FrameTypeDef;
+
+/**
+  * @brief  UART Rx frame queue structure definition
+  * @note   The received bytes are stored in Ring by the DMA, and each receiver timeout
+  *         closes a frame whose descriptor is queued in pFrames. Head is only written
+  *         by the driver and Tail only by the reader.
+  */
+typedef struct
+{
+  UART_RingTypeDef              Ring;             /*!< Rx ring buffer holding the frame bytes              */
+
+  UART_FrameTypeDef             *pFrames;         /*!< Frame descriptors, owned by the application         */
+
+  uint32_t                      Mask;             /*!< Number of descriptors minus one, a power of two      */
+
+  __IO uint32_t                 Head;             /*!< Number of frames queued, updated by the driver       */
+
+  __IO uint32_t                 Tail;             /*!< Number of frames read, updated by the reader         */
+
+  __IO uint32_t                 Overrun;          /*!< Count of frames dropped on a full queue              */
+
+  uint32_t                      FrameStart;       /*!< Ring index of the frame being received (internal)    */
+
+  uint32_t                      FrameErrors;      /*!< Errors of the frame being received (internal)        */
+
+} UART_FrameQueueTypeDef;
+
 /**
   * @brief  UART handle Structure definition
   */
@@ -271,6 +332,10 @@ typedef struct __UART_HandleTypeDef
 
   __IO uint32_t                 ErrorCode;           /*!< UART Error code                    */
 
+  UART_RingTypeDef              *pRxRing;            /*!< Rx ring buffer, only set while a ring reception is ongoing */
+
+  UART_FrameQueueTypeDef        *pRxFrames;          /*!< Rx frame queue, only set while a framed reception is ongoing */
+
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
   void (* TxHalfCpltCallback)(struct __UART_HandleTypeDef *huart);        /*!< UART Tx Half Complete Callback        */
   void (* TxCpltCallback)(struct __UART_HandleTypeDef *huart);            /*!< UART Tx Complete Callback             */
@@ -838,6 +903,7 @@ typedef  void (*pUART_RxEventCallbackTypeDef)
 #define HAL_UART_RXEVENT_TC                  (0x00000000U)             /*!< RxEvent linked to Transfer Complete event */
 #define HAL_UART_RXEVENT_HT                  (0x00000001U)             /*!< RxEvent linked to Half Transfer event     */
 #define HAL_UART_RXEVENT_IDLE                (0x00000002U)             /*!< RxEvent linked to IDLE event              */
+#define HAL_UART_RXEVENT_RTO                 (0x00000003U)             /*!< RxEvent linked to Receiver Timeout event  */
 /**
   * @}
   */
@@ -153,6 +153,9 @@ void HAL_UARTEx_WakeupCallback(UART_HandleTypeDef *huart);
 void HAL_UARTEx_RxFifoFullCallback(UART_HandleTypeDef *huart);
 void HAL_UARTEx_TxFifoEmptyCallback(UART_HandleTypeDef *huart);
 
+void HAL_UARTEx_RingRxEventCallback(UART_HandleTypeDef *huart);
+void HAL_UARTEx_FrameRxEventCallback(UART_HandleTypeDef *huart);
+
 /**
   * @}
   */
@@ -178,6 +181,29 @@ HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle(UART_HandleTypeDef *huart, uint8_t *p
 HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_IT(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size);
 HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_DMA(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size);
 
+HAL_StatusTypeDef HAL_UARTEx_RingReceive_DMA(UART_HandleTypeDef *huart, UART_RingTypeDef *pRing, uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_UARTEx_RingReceive_Stop(UART_HandleTypeDef *huart);
+void              HAL_UARTEx_RingReceive_Update(UART_HandleTypeDef *huart);
+uint32_t          HAL_UARTEx_Ring_GetCount(UART_RingTypeDef *pRing);
+uint32_t          HAL_UARTEx_Ring_GetData(UART_RingTypeDef *pRing, uint8_t **ppData);
+void              HAL_UARTEx_Ring_Release(UART_RingTypeDef *pRing, uint32_t Count);
+
+HAL_StatusTypeDef HAL_UARTEx_FrameReceive_DMA(UART_HandleTypeDef *huart, UART_FrameQueueTypeDef *pQueue, uint8_t *pData,
+                                              uint16_t Size, UART_FrameTypeDef *pFrames, uint32_t NbFrames,
+                                              uint32_t TimeoutBits);
+HAL_StatusTypeDef HAL_UARTEx_FrameReceive_Stop(UART_HandleTypeDef *huart);
+void              HAL_UARTEx_FrameReceive_Delimit(UART_HandleTypeDef *huart);
+uint32_t          HAL_UARTEx_Frame_GetCount(UART_FrameQueueTypeDef *pQueue);
+HAL_StatusTypeDef HAL_UARTEx_Frame_Read(UART_FrameQueueTypeDef *pQueue, uint8_t *pData, uint32_t Size,
+                                        uint32_t *pLength, uint32_t *pErrors);
+
+HAL_StatusTypeDef HAL_RS485Ex_Transaction_DMA(UART_HandleTypeDef *huart, const uint8_t *pTxData, uint16_t TxSize,
+                                              uint8_t *pRxData, uint16_t RxSize, uint32_t TimeoutBits);
+
+HAL_StatusTypeDef HAL_UARTEx_EnableAutoBaudRate(UART_HandleTypeDef *huart, uint32_t Mode);
+HAL_StatusTypeDef HAL_UARTEx_DisableAutoBaudRate(UART_HandleTypeDef *huart);
+HAL_StatusTypeDef HAL_UARTEx_GetAutoBaudRateStatus(UART_HandleTypeDef *huart);
+
 HAL_UART_RxEventTypeTypeDef HAL_UARTEx_GetRxEventType(UART_HandleTypeDef *huart);
 
 
@@ -73,6 +73,12 @@ typedef struct
 
   WWDG_InitTypeDef  Init;       /*!< WWDG required parameters */
 
+  uint32_t          SupervisedTasks;  /*!< Bitmask of the tasks supervised before refreshing the WWDG */
+
+  __IO uint32_t     TaskCheckIn;      /*!< Bitmask of the tasks checked in since the last refresh */
+
+  __IO uint32_t     StalledTasks;     /*!< Bitmask of the tasks not checked in at the last early wakeup */
+
 #if (USE_HAL_WWDG_REGISTER_CALLBACKS == 1)
   void (* EwiCallback)(struct __WWDG_HandleTypeDef *hwwdg);                  /*!< WWDG Early WakeUp Interrupt callback */
 
@@ -171,6 +177,8 @@ typedef void (*pWWDG_CallbackTypeDef)(WWDG_HandleTypeDef *hppp);  /*!< pointer t
 
 #define IS_WWDG_EWI_MODE(__MODE__)          (((__MODE__) == WWDG_EWI_ENABLE) || \
                                              ((__MODE__) == WWDG_EWI_DISABLE))
+
+#define IS_WWDG_TASK_ID(__ID__)             ((__ID__) < 32U)
 /**
   * @}
   */
@@ -287,6 +295,18 @@ void                  HAL_WWDG_EarlyWakeupCallback(WWDG_HandleTypeDef *hwwdg);
   * @}
   */
 
+/** @addtogroup WWDG_Exported_Functions_Group3
+  * @{
+  */
+/* Task supervision functions ***************************************************/
+HAL_StatusTypeDef     HAL_WWDG_SupervisorStart(WWDG_HandleTypeDef *hwwdg, uint32_t TaskMask);
+void                  HAL_WWDG_TaskCheckIn(WWDG_HandleTypeDef *hwwdg, uint32_t TaskId);
+HAL_StatusTypeDef     HAL_WWDG_SupervisorRefresh(WWDG_HandleTypeDef *hwwdg);
+uint32_t              HAL_WWDG_GetStalledTasks(const WWDG_HandleTypeDef *hwwdg);
+/**
+  * @}
+  */
+
 /**
   * @}
   */
@@ -182,6 +182,16 @@ typedef struct
 
   uint8_t   process_ping;       /*!< Execute the PING protocol for HS mode.                                     */
 
+  uint8_t   do_ssplit;          /*!< Enable split transactions (FS/LS device behind a HS hub).                  */
+
+  uint8_t   do_csplit;          /*!< Complete split phase of the current split transaction.                     */
+
+  uint8_t   hub_addr;           /*!< Address of the HS hub of the device, used in split transactions.           */
+
+  uint8_t   hub_port_nbr;       /*!< Port of the HS hub the device is connected to, used in split transactions. */
+
+  uint8_t   NyetErrCnt;         /*!< Complete split NYET responses of the current split transaction.            */
+
   uint8_t   ep_type;            /*!< Endpoint Type.
                                      This parameter can be any value of @ref USB_LL_EP_Type                     */
 
@@ -172,6 +172,28 @@
                 destination variable address.
           (+++) Stop conversion and disable the ADC peripheral
                 using function HAL_ADC_Stop_DMA()
+          (+++) Alternatively, start the conversions with HAL_ADC_StartDoubleBuffer_DMA()
+                to store them alternately in two buffers (DMA double buffer mode,
+                requires the DMA circular conversion data management).
+                HAL_ADC_ConvM0CpltCallback() and HAL_ADC_ConvM1CpltCallback() are
+                called each time a buffer has been filled; the idle buffer can be
+                replaced from these callbacks using HAL_DMAEx_ChangeMemory().
+
+        (++) ADC streaming acquisition with circular DMA:
+          (+++) Configure the regular sequence, the oversampler and the DMA
+                circular mode in one call with HAL_ADCEx_Stream_Config().
+                Injected conversions can be performed concurrently.
+          (+++) Start the acquisition into an interleaved buffer of a power of
+                two number of frames with HAL_ADCEx_Stream_Start(). The DMA
+                must be initialized in circular mode.
+          (+++) Read each channel in place with HAL_ADCEx_Stream_GetView(), a
+                pointer and a stride into the interleaved buffer, then hand the
+                frames back with HAL_ADCEx_Stream_Release().
+          (+++) Optionally, give a MDMA channel to HAL_ADCEx_Stream_StartDemux()
+                to de-interleave each half buffer into per-channel buffers without
+                CPU load. HAL_ADCEx_Stream_DemuxCpltCallback() is called when a
+                half buffer is de-interleaved.
+          (+++) Stop the acquisition with HAL_ADCEx_Stream_Stop().
 
      [..]
 
@@ -237,6 +259,8 @@
        (+) LevelOutOfWindow2Callback      : ADC analog watchdog 2 callback
        (+) LevelOutOfWindow3Callback      : ADC analog watchdog 3 callback
        (+) EndOfSamplingCallback          : ADC end of sampling callback
+       (+) ConvM0CpltCallback             : ADC conversion DMA memory 0 complete callback
+       (+) ConvM1CpltCallback             : ADC conversion DMA memory 1 complete callback
        (+) MspInitCallback                : ADC Msp Init callback
        (+) MspDeInitCallback              : ADC Msp DeInit callback
      This function takes as parameters the HAL peripheral handle, the Callback ID
@@ -259,6 +283,8 @@
        (+) LevelOutOfWindow2Callback      : ADC analog watchdog 2 callback
        (+) LevelOutOfWindow3Callback      : ADC analog watchdog 3 callback
        (+) EndOfSamplingCallback          : ADC end of sampling callback
+       (+) ConvM0CpltCallback             : ADC conversion DMA memory 0 complete callback
+       (+) ConvM1CpltCallback             : ADC conversion DMA memory 1 complete callback
        (+) MspInitCallback                : ADC Msp Init callback
        (+) MspDeInitCallback              : ADC Msp DeInit callback
      [..]
@@ -356,6 +382,11 @@
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
+static HAL_StatusTypeDef ADC_Start_DMA(ADC_HandleTypeDef *hadc, uint32_t *pData, uint32_t *pSecondData,
+                                       uint32_t Length);
+static void ADC_DMAConvM0Cplt(DMA_HandleTypeDef *hdma);
+static void ADC_DMAConvM1Cplt(DMA_HandleTypeDef *hdma);
+
 /* Exported functions --------------------------------------------------------*/
 
 /** @defgroup ADC_Exported_Functions ADC Exported Functions
@@ -462,6 +493,8 @@ HAL_StatusTypeDef HAL_ADC_Init(ADC_HandleTypeDef *hadc)
     hadc->LevelOutOfWindow2Callback     = HAL_ADCEx_LevelOutOfWindow2Callback;      /* Legacy weak callback */
     hadc->LevelOutOfWindow3Callback     = HAL_ADCEx_LevelOutOfWindow3Callback;      /* Legacy weak callback */
     hadc->EndOfSamplingCallback         = HAL_ADCEx_EndOfSamplingCallback;          /* Legacy weak callback */
+    hadc->ConvM0CpltCallback            = HAL_ADC_ConvM0CpltCallback;               /* Legacy weak callback */
+    hadc->ConvM1CpltCallback            = HAL_ADC_ConvM1CpltCallback;               /* Legacy weak callback */
 
     if (hadc->MspInitCallback == NULL)
     {
@@ -482,6 +515,9 @@ HAL_StatusTypeDef HAL_ADC_Init(ADC_HandleTypeDef *hadc)
     hadc->Lock = HAL_UNLOCKED;
   }
 
+  /* No streaming acquisition ongoing */
+  hadc->pStream = NULL;
+
   /* - Exit from deep-power-down mode and ADC voltage regulator enable        */
   if (LL_ADC_IsDeepPowerDownEnabled(hadc->Instance) != 0UL)
   {
@@ -1136,6 +1172,8 @@ __weak void HAL_ADC_MspDeInit(ADC_HandleTypeDef *hadc)
   *          @arg @ref HAL_ADC_LEVEL_OUT_OF_WINDOW_2_CB_ID    ADC analog watchdog 2 callback ID
   *          @arg @ref HAL_ADC_LEVEL_OUT_OF_WINDOW_3_CB_ID    ADC analog watchdog 3 callback ID
   *          @arg @ref HAL_ADC_END_OF_SAMPLING_CB_ID          ADC end of sampling callback ID
+  *          @arg @ref HAL_ADC_CONVERSION_M0_CB_ID            ADC conversion DMA memory 0 complete callback ID
+  *          @arg @ref HAL_ADC_CONVERSION_M1_CB_ID            ADC conversion DMA memory 1 complete callback ID
   *          @arg @ref HAL_ADC_MSPINIT_CB_ID                  ADC Msp Init callback ID
   *          @arg @ref HAL_ADC_MSPDEINIT_CB_ID                ADC Msp DeInit callback ID
   * @param  pCallback pointer to the Callback function
@@ -1193,6 +1231,14 @@ HAL_StatusTypeDef HAL_ADC_RegisterCallback(ADC_HandleTypeDef *hadc, HAL_ADC_Call
         hadc->EndOfSamplingCallback = pCallback;
         break;
 
+      case HAL_ADC_CONVERSION_M0_CB_ID :
+        hadc->ConvM0CpltCallback = pCallback;
+        break;
+
+      case HAL_ADC_CONVERSION_M1_CB_ID :
+        hadc->ConvM1CpltCallback = pCallback;
+        break;
+
       case HAL_ADC_MSPINIT_CB_ID :
         hadc->MspInitCallback = pCallback;
         break;
@@ -1259,6 +1305,8 @@ HAL_StatusTypeDef HAL_ADC_RegisterCallback(ADC_HandleTypeDef *hadc, HAL_ADC_Call
   *          @arg @ref HAL_ADC_LEVEL_OUT_OF_WINDOW_2_CB_ID    ADC analog watchdog 2 callback ID
   *          @arg @ref HAL_ADC_LEVEL_OUT_OF_WINDOW_3_CB_ID    ADC analog watchdog 3 callback ID
   *          @arg @ref HAL_ADC_END_OF_SAMPLING_CB_ID          ADC end of sampling callback ID
+  *          @arg @ref HAL_ADC_CONVERSION_M0_CB_ID            ADC conversion DMA memory 0 complete callback ID
+  *          @arg @ref HAL_ADC_CONVERSION_M1_CB_ID            ADC conversion DMA memory 1 complete callback ID
   *          @arg @ref HAL_ADC_MSPINIT_CB_ID                  ADC Msp Init callback ID
   *          @arg @ref HAL_ADC_MSPDEINIT_CB_ID                ADC Msp DeInit callback ID
   * @retval HAL status
@@ -1307,6 +1355,14 @@ HAL_StatusTypeDef HAL_ADC_UnRegisterCallback(ADC_HandleTypeDef *hadc, HAL_ADC_Ca
         hadc->EndOfSamplingCallback = HAL_ADCEx_EndOfSamplingCallback;
         break;
 
+      case HAL_ADC_CONVERSION_M0_CB_ID :
+        hadc->ConvM0CpltCallback = HAL_ADC_ConvM0CpltCallback;
+        break;
+
+      case HAL_ADC_CONVERSION_M1_CB_ID :
+        hadc->ConvM1CpltCallback = HAL_ADC_ConvM1CpltCallback;
+        break;
+
       case HAL_ADC_MSPINIT_CB_ID :
         hadc->MspInitCallback = HAL_ADC_MspInit; /* Legacy weak MspInit              */
         break;
@@ -2111,136 +2167,50 @@ HAL_StatusTypeDef HAL_ADC_Stop_IT(ADC_HandleTypeDef *hadc)
   */
 HAL_StatusTypeDef HAL_ADC_Start_DMA(ADC_HandleTypeDef *hadc, uint32_t *pData, uint32_t Length)
 {
-  HAL_StatusTypeDef tmp_hal_status;
-  uint32_t tmp_multimode_config = LL_ADC_GetMultimode(__LL_ADC_COMMON_INSTANCE(hadc->Instance));
-
-  /* Check the parameters */
-  assert_param(IS_ADC_ALL_INSTANCE(hadc->Instance));
-
-  /* Perform ADC enable and conversion start if no conversion is on going */
-  if (LL_ADC_REG_IsConversionOngoing(hadc->Instance) == 0UL)
-  {
-    /* Process locked */
-    __HAL_LOCK(hadc);
-
-    /* Ensure that multimode regular conversions are not enabled.   */
-    /* Otherwise, dedicated API HAL_ADCEx_MultiModeStart_DMA() must be used.  */
-    if ((tmp_multimode_config == LL_ADC_MULTI_INDEPENDENT)
-        || (tmp_multimode_config == LL_ADC_MULTI_DUAL_INJ_SIMULT)
-        || (tmp_multimode_config == LL_ADC_MULTI_DUAL_INJ_ALTERN)
-       )
-    {
-      /* Enable the ADC peripheral */
-      tmp_hal_status = ADC_Enable(hadc);
-
-      /* Start conversion if ADC is effectively enabled */
-      if (tmp_hal_status == HAL_OK)
-      {
-        /* Set ADC state                                                        */
-        /* - Clear state bitfield related to regular group conversion results   */
-        /* - Set state bitfield related to regular operation                    */
-        ADC_STATE_CLR_SET(hadc->State,
-                          HAL_ADC_STATE_READY | HAL_ADC_STATE_REG_EOC | HAL_ADC_STATE_REG_OVR | HAL_ADC_STATE_REG_EOSMP,
-                          HAL_ADC_STATE_REG_BUSY);
-
-        /* Reset HAL_ADC_STATE_MULTIMODE_SLAVE bit
-          - if ADC instance is master or if multimode feature is not available
-          - if multimode setting is disabled (ADC instance slave in independent mode) */
-        if ((__LL_ADC_MULTI_INSTANCE_MASTER(hadc->Instance) == hadc->Instance)
-            || (tmp_multimode_config == LL_ADC_MULTI_INDEPENDENT)
-           )
-        {
-          CLEAR_BIT(hadc->State, HAL_ADC_STATE_MULTIMODE_SLAVE);
-        }
-
-        /* Check if a conversion is on going on ADC group injected */
-        if ((hadc->State & HAL_ADC_STATE_INJ_BUSY) != 0UL)
-        {
-          /* Reset ADC error code fields related to regular conversions only */
-          CLEAR_BIT(hadc->ErrorCode, (HAL_ADC_ERROR_OVR | HAL_ADC_ERROR_DMA));
-        }
-        else
-        {
-          /* Reset all ADC error code fields */
-          ADC_CLEAR_ERRORCODE(hadc);
-        }
-
-        /* Set the DMA transfer complete callback */
-        hadc->DMA_Handle->XferCpltCallback = ADC_DMAConvCplt;
-
-        /* Set the DMA half transfer complete callback */
-        hadc->DMA_Handle->XferHalfCpltCallback = ADC_DMAHalfConvCplt;
-
-        /* Set the DMA error callback */
-        hadc->DMA_Handle->XferErrorCallback = ADC_DMAError;
-
-
-        /* Manage ADC and DMA start: ADC overrun interruption, DMA start,     */
-        /* ADC start (in case of SW start):                                   */
-
-        /* Clear regular group conversion flag and overrun flag               */
-        /* (To ensure of no unknown state from potential previous ADC         */
-        /* operations)                                                        */
-        __HAL_ADC_CLEAR_FLAG(hadc, (ADC_FLAG_EOC | ADC_FLAG_EOS | ADC_FLAG_OVR));
-
-        /* Process unlocked */
-        /* Unlock before starting ADC conversions: in case of potential         */
-        /* interruption, to let the process to ADC IRQ Handler.                 */
-        __HAL_UNLOCK(hadc);
+  return ADC_Start_DMA(hadc, pData, NULL, Length);
+}
 
-        /* With DMA, overrun event is always considered as an error even if
-           hadc->Init.Overrun is set to ADC_OVR_DATA_OVERWRITTEN. Therefore,
-           ADC_IT_OVR is enabled. */
-        __HAL_ADC_ENABLE_IT(hadc, ADC_IT_OVR);
+/**
+  * @brief  Enable ADC, start conversion of regular group and transfer result through DMA
+  *         in double buffer mode.
+  * @note   Interruptions enabled in this function:
+  *         overrun (if applicable), DMA memory 0 and memory 1 transfer complete.
+  *         Each of these interruptions has its dedicated callback function.
+  * @note   The conversions are stored alternately in the two buffers until
+  *         HAL_ADC_Stop_DMA() is called. The ADC conversion data management must
+  *         be set to ADC_CONVERSIONDATA_DMA_CIRCULAR (DMAContinuousRequests enabled
+  *         for ADC3 on devices where ADC3 is a 12-bit ADC).
+  * @note   As HAL_ADC_Start_DMA(), this function is designed for single-ADC mode only.
+  * @param hadc ADC handle
+  * @param pData0 First destination buffer address (DMA memory 0).
+  * @param pData1 Second destination buffer address (DMA memory 1).
+  * @param Length Number of data to be transferred from ADC peripheral to each buffer
+  * @retval HAL status.
+  */
+HAL_StatusTypeDef HAL_ADC_StartDoubleBuffer_DMA(ADC_HandleTypeDef *hadc, uint32_t *pData0, uint32_t *pData1,
+                                                uint32_t Length)
+{
+  uint32_t tmp_continuous_requests;
 
-        /* Enable ADC DMA  mode*/
 #if defined(ADC_VER_V5_V90)
-        if (hadc->Instance == ADC3)
-        {
-          LL_ADC_REG_SetDMATransferMode(hadc->Instance, ADC3_CFGR_DMACONTREQ((uint32_t)hadc->Init.DMAContinuousRequests));
-          LL_ADC_EnableDMAReq(hadc->Instance);
-        }
-        else
-        {
-          LL_ADC_REG_SetDataTransferMode(hadc->Instance, ADC_CFGR_DMACONTREQ((uint32_t)hadc->Init.ConversionDataManagement));
-        }
-
-#else
-        LL_ADC_REG_SetDataTransferMode(hadc->Instance, (uint32_t)hadc->Init.ConversionDataManagement);
-#endif
-
-
-        /* Start the DMA channel */
-        tmp_hal_status = HAL_DMA_Start_IT(hadc->DMA_Handle, (uint32_t)&hadc->Instance->DR, (uint32_t)pData, Length);
-
-        /* Enable conversion of regular group.                                  */
-        /* If software start has been selected, conversion starts immediately.  */
-        /* If external trigger has been selected, conversion will start at next */
-        /* trigger event.                                                       */
-        /* Start ADC group regular conversion */
-        LL_ADC_REG_StartConversion(hadc->Instance);
-      }
-      else
-      {
-        /* Process unlocked */
-        __HAL_UNLOCK(hadc);
-      }
-
-    }
-    else
-    {
-      tmp_hal_status = HAL_ERROR;
-      /* Process unlocked */
-      __HAL_UNLOCK(hadc);
-    }
+  if (hadc->Instance == ADC3)
+  {
+    tmp_continuous_requests = (hadc->Init.DMAContinuousRequests == ENABLE) ? 1UL : 0UL;
   }
   else
   {
-    tmp_hal_status = HAL_BUSY;
+    tmp_continuous_requests = (hadc->Init.ConversionDataManagement == ADC_CONVERSIONDATA_DMA_CIRCULAR) ? 1UL : 0UL;
   }
+#else
+  tmp_continuous_requests = (hadc->Init.ConversionDataManagement == ADC_CONVERSIONDATA_DMA_CIRCULAR) ? 1UL : 0UL;
+#endif /* ADC_VER_V5_V90 */
 
-  /* Return function status */
-  return tmp_hal_status;
+  if ((pData0 == NULL) || (pData1 == NULL) || (tmp_continuous_requests == 0UL))
+  {
+    return HAL_ERROR;
+  }
+
+  return ADC_Start_DMA(hadc, pData0, pData1, Length);
 }
 
 /**
@@ -2743,6 +2713,36 @@ __weak void HAL_ADC_ConvHalfCpltCallback(ADC_HandleTypeDef *hadc)
   */
 }
 
+/**
+  * @brief  Conversion DMA memory 0 complete callback in double buffer mode.
+  * @param hadc ADC handle
+  * @retval None
+  */
+__weak void HAL_ADC_ConvM0CpltCallback(ADC_HandleTypeDef *hadc)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hadc);
+
+  /* NOTE : This function should not be modified. When the callback is needed,
+            function HAL_ADC_ConvM0CpltCallback must be implemented in the user file.
+  */
+}
+
+/**
+  * @brief  Conversion DMA memory 1 complete callback in double buffer mode.
+  * @param hadc ADC handle
+  * @retval None
+  */
+__weak void HAL_ADC_ConvM1CpltCallback(ADC_HandleTypeDef *hadc)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hadc);
+
+  /* NOTE : This function should not be modified. When the callback is needed,
+            function HAL_ADC_ConvM1CpltCallback must be implemented in the user file.
+  */
+}
+
 /**
   * @brief  Analog watchdog 1 callback in non-blocking mode.
   * @param hadc ADC handle
@@ -3816,6 +3816,12 @@ void ADC_DMAConvCplt(DMA_HandleTypeDef *hdma)
   /* Retrieve ADC handle corresponding to current DMA handle */
   ADC_HandleTypeDef *hadc = (ADC_HandleTypeDef *)((DMA_HandleTypeDef *)hdma)->Parent;
 
+  /* Second half of the streaming buffer filled */
+  if (hadc->pStream != NULL)
+  {
+    ADCEx_StreamHalfBufferEvent(hadc, 1UL);
+  }
+
   /* Update state machine on conversion status if not in error state */
   if ((hadc->State & (HAL_ADC_STATE_ERROR_INTERNAL | HAL_ADC_STATE_ERROR_DMA)) == 0UL)
   {
@@ -3894,6 +3900,12 @@ void ADC_DMAHalfConvCplt(DMA_HandleTypeDef *hdma)
   /* Retrieve ADC handle corresponding to current DMA handle */
   ADC_HandleTypeDef *hadc = (ADC_HandleTypeDef *)((DMA_HandleTypeDef *)hdma)->Parent;
 
+  /* First half of the streaming buffer filled */
+  if (hadc->pStream != NULL)
+  {
+    ADCEx_StreamHalfBufferEvent(hadc, 0UL);
+  }
+
   /* Half conversion callback */
 #if (USE_HAL_ADC_REGISTER_CALLBACKS == 1)
   hadc->ConvHalfCpltCallback(hadc);
@@ -3902,6 +3914,214 @@ void ADC_DMAHalfConvCplt(DMA_HandleTypeDef *hdma)
 #endif /* USE_HAL_ADC_REGISTER_CALLBACKS */
 }
 
+/**
+  * @brief  Enable ADC, start conversion of regular group and transfer result through DMA,
+  *         in normal or double buffer DMA mode.
+  * @param hadc ADC handle
+  * @param pData Destination buffer address (DMA memory 0).
+  * @param pSecondData Second destination buffer address (DMA memory 1),
+  *        NULL to use the DMA in normal mode.
+  * @param Length Number of data to be transferred from ADC peripheral to memory
+  * @retval HAL status.
+  */
+static HAL_StatusTypeDef ADC_Start_DMA(ADC_HandleTypeDef *hadc, uint32_t *pData, uint32_t *pSecondData,
+                                       uint32_t Length)
+{
+  HAL_StatusTypeDef tmp_hal_status;
+  uint32_t tmp_multimode_config = LL_ADC_GetMultimode(__LL_ADC_COMMON_INSTANCE(hadc->Instance));
+
+  /* Check the parameters */
+  assert_param(IS_ADC_ALL_INSTANCE(hadc->Instance));
+
+  /* Perform ADC enable and conversion start if no conversion is on going */
+  if (LL_ADC_REG_IsConversionOngoing(hadc->Instance) == 0UL)
+  {
+    /* Process locked */
+    __HAL_LOCK(hadc);
+
+    /* Ensure that multimode regular conversions are not enabled.   */
+    /* Otherwise, dedicated API HAL_ADCEx_MultiModeStart_DMA() must be used.  */
+    if ((tmp_multimode_config == LL_ADC_MULTI_INDEPENDENT)
+        || (tmp_multimode_config == LL_ADC_MULTI_DUAL_INJ_SIMULT)
+        || (tmp_multimode_config == LL_ADC_MULTI_DUAL_INJ_ALTERN)
+       )
+    {
+      /* Enable the ADC peripheral */
+      tmp_hal_status = ADC_Enable(hadc);
+
+      /* Start conversion if ADC is effectively enabled */
+      if (tmp_hal_status == HAL_OK)
+      {
+        /* Set ADC state                                                        */
+        /* - Clear state bitfield related to regular group conversion results   */
+        /* - Set state bitfield related to regular operation                    */
+        ADC_STATE_CLR_SET(hadc->State,
+                          HAL_ADC_STATE_READY | HAL_ADC_STATE_REG_EOC | HAL_ADC_STATE_REG_OVR | HAL_ADC_STATE_REG_EOSMP,
+                          HAL_ADC_STATE_REG_BUSY);
+
+        /* Reset HAL_ADC_STATE_MULTIMODE_SLAVE bit
+          - if ADC instance is master or if multimode feature is not available
+          - if multimode setting is disabled (ADC instance slave in independent mode) */
+        if ((__LL_ADC_MULTI_INSTANCE_MASTER(hadc->Instance) == hadc->Instance)
+            || (tmp_multimode_config == LL_ADC_MULTI_INDEPENDENT)
+           )
+        {
+          CLEAR_BIT(hadc->State, HAL_ADC_STATE_MULTIMODE_SLAVE);
+        }
+
+        /* Check if a conversion is on going on ADC group injected */
+        if ((hadc->State & HAL_ADC_STATE_INJ_BUSY) != 0UL)
+        {
+          /* Reset ADC error code fields related to regular conversions only */
+          CLEAR_BIT(hadc->ErrorCode, (HAL_ADC_ERROR_OVR | HAL_ADC_ERROR_DMA));
+        }
+        else
+        {
+          /* Reset all ADC error code fields */
+          ADC_CLEAR_ERRORCODE(hadc);
+        }
+
+        if (pSecondData == NULL)
+        {
+          /* Set the DMA transfer complete callback */
+          hadc->DMA_Handle->XferCpltCallback = ADC_DMAConvCplt;
+
+          /* Set the DMA half transfer complete callback */
+          hadc->DMA_Handle->XferHalfCpltCallback = ADC_DMAHalfConvCplt;
+        }
+        else
+        {
+          /* Set the DMA memory 0 and memory 1 transfer complete callbacks */
+          hadc->DMA_Handle->XferCpltCallback   = ADC_DMAConvM0Cplt;
+          hadc->DMA_Handle->XferM1CpltCallback = ADC_DMAConvM1Cplt;
+
+          /* Half transfer callbacks are not used in double buffer mode */
+          hadc->DMA_Handle->XferHalfCpltCallback   = NULL;
+          hadc->DMA_Handle->XferM1HalfCpltCallback = NULL;
+        }
+
+        /* Set the DMA error callback */
+        hadc->DMA_Handle->XferErrorCallback = ADC_DMAError;
+
+
+        /* Manage ADC and DMA start: ADC overrun interruption, DMA start,     */
+        /* ADC start (in case of SW start):                                   */
+
+        /* Clear regular group conversion flag and overrun flag               */
+        /* (To ensure of no unknown state from potential previous ADC         */
+        /* operations)                                                        */
+        __HAL_ADC_CLEAR_FLAG(hadc, (ADC_FLAG_EOC | ADC_FLAG_EOS | ADC_FLAG_OVR));
+
+        /* Process unlocked */
+        /* Unlock before starting ADC conversions: in case of potential         */
+        /* interruption, to let the process to ADC IRQ Handler.                 */
+        __HAL_UNLOCK(hadc);
+
+        /* With DMA, overrun event is always considered as an error even if
+           hadc->Init.Overrun is set to ADC_OVR_DATA_OVERWRITTEN. Therefore,
+           ADC_IT_OVR is enabled. */
+        __HAL_ADC_ENABLE_IT(hadc, ADC_IT_OVR);
+
+        /* Enable ADC DMA  mode*/
+#if defined(ADC_VER_V5_V90)
+        if (hadc->Instance == ADC3)
+        {
+          LL_ADC_REG_SetDMATransferMode(hadc->Instance, ADC3_CFGR_DMACONTREQ((uint32_t)hadc->Init.DMAContinuousRequests));
+          LL_ADC_EnableDMAReq(hadc->Instance);
+        }
+        else
+        {
+          LL_ADC_REG_SetDataTransferMode(hadc->Instance, ADC_CFGR_DMACONTREQ((uint32_t)hadc->Init.ConversionDataManagement));
+        }
+
+#else
+        LL_ADC_REG_SetDataTransferMode(hadc->Instance, (uint32_t)hadc->Init.ConversionDataManagement);
+#endif
+
+
+        /* Start the DMA channel */
+        if (pSecondData == NULL)
+        {
+          tmp_hal_status = HAL_DMA_Start_IT(hadc->DMA_Handle, (uint32_t)&hadc->Instance->DR, (uint32_t)pData, Length);
+        }
+        else
+        {
+          tmp_hal_status = HAL_DMAEx_MultiBufferStart_IT(hadc->DMA_Handle, (uint32_t)&hadc->Instance->DR,
+                                                         (uint32_t)pData, (uint32_t)pSecondData, Length);
+        }
+
+        /* Enable conversion of regular group.                                  */
+        /* If software start has been selected, conversion starts immediately.  */
+        /* If external trigger has been selected, conversion will start at next */
+        /* trigger event.                                                       */
+        /* Start ADC group regular conversion */
+        LL_ADC_REG_StartConversion(hadc->Instance);
+      }
+      else
+      {
+        /* Process unlocked */
+        __HAL_UNLOCK(hadc);
+      }
+
+    }
+    else
+    {
+      tmp_hal_status = HAL_ERROR;
+      /* Process unlocked */
+      __HAL_UNLOCK(hadc);
+    }
+  }
+  else
+  {
+    tmp_hal_status = HAL_BUSY;
+  }
+
+  /* Return function status */
+  return tmp_hal_status;
+}
+
+/**
+  * @brief  DMA memory 0 transfer complete callback (double buffer mode).
+  * @param hdma pointer to DMA handle.
+  * @retval None
+  */
+static void ADC_DMAConvM0Cplt(DMA_HandleTypeDef *hdma)
+{
+  /* Retrieve ADC handle corresponding to current DMA handle */
+  ADC_HandleTypeDef *hadc = (ADC_HandleTypeDef *)((DMA_HandleTypeDef *)hdma)->Parent;
+
+  /* Update ADC state machine */
+  SET_BIT(hadc->State, HAL_ADC_STATE_REG_EOC);
+
+  /* Memory 0 conversion callback */
+#if (USE_HAL_ADC_REGISTER_CALLBACKS == 1)
+  hadc->ConvM0CpltCallback(hadc);
+#else
+  HAL_ADC_ConvM0CpltCallback(hadc);
+#endif /* USE_HAL_ADC_REGISTER_CALLBACKS */
+}
+
+/**
+  * @brief  DMA memory 1 transfer complete callback (double buffer mode).
+  * @param hdma pointer to DMA handle.
+  * @retval None
+  */
+static void ADC_DMAConvM1Cplt(DMA_HandleTypeDef *hdma)
+{
+  /* Retrieve ADC handle corresponding to current DMA handle */
+  ADC_HandleTypeDef *hadc = (ADC_HandleTypeDef *)((DMA_HandleTypeDef *)hdma)->Parent;
+
+  /* Update ADC state machine */
+  SET_BIT(hadc->State, HAL_ADC_STATE_REG_EOC);
+
+  /* Memory 1 conversion callback */
+#if (USE_HAL_ADC_REGISTER_CALLBACKS == 1)
+  hadc->ConvM1CpltCallback(hadc);
+#else
+  HAL_ADC_ConvM1CpltCallback(hadc);
+#endif /* USE_HAL_ADC_REGISTER_CALLBACKS */
+}
+
 /**
   * @brief  DMA error callback.
   * @param hdma pointer to DMA handle.
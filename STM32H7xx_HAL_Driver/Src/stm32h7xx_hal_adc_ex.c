@@ -74,6 +74,19 @@
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
+/** @defgroup ADCEx_Private_Functions ADC Extended Private Functions
+  * @{
+  */
+static void ADCEx_StreamUpdateFromDMA(ADC_HandleTypeDef *hadc);
+#if defined(HAL_MDMA_MODULE_ENABLED)
+static void ADCEx_StreamDemuxStart(ADC_HandleTypeDef *hadc);
+static void ADCEx_StreamDemuxCplt(MDMA_HandleTypeDef *hmdma);
+static void ADCEx_StreamDemuxError(MDMA_HandleTypeDef *hmdma);
+#endif /* HAL_MDMA_MODULE_ENABLED */
+/**
+  * @}
+  */
+
 /* Exported functions --------------------------------------------------------*/
 
 /** @defgroup ADCEx_Exported_Functions ADC Extended Exported Functions
@@ -92,6 +105,8 @@
       (+) Perform the ADC self-calibration for single or differential ending.
       (+) Get calibration factors for single or differential ending.
       (+) Set calibration factors for single or differential ending.
+      (+) Save the calibration factors in a cache, and restore them on the next
+          initializations while the temperature and VDDA do not drift.
 
       (+) Start conversion of ADC group injected.
       (+) Stop conversion of ADC group injected.
@@ -104,6 +119,10 @@
       (+) Stop multimode and disable ADC DMA transfer.
       (+) Get result of multimode conversion.
 
+      (+) Start and stop a streaming acquisition into a circular DMA buffer.
+      (+) Read each channel of the streaming buffer in place, with a stride.
+      (+) De-interleave the streaming buffer into per-channel buffers with the MDMA.
+
 @endverbatim
   * @{
   */
@@ -435,6 +454,212 @@ HAL_StatusTypeDef HAL_ADCEx_LinearCalibration_FactorLoad(ADC_HandleTypeDef *hadc
   return tmp_hal_status;
 }
 
+/**
+  * @brief  Save the calibration factors of the ADC in a calibration cache.
+  * @note   To be called after HAL_ADCEx_Calibration_Start() in single-ended and
+  *         differential modes, with the calibration mode used.
+  * @note   With ADC_CALIB_OFFSET_LINEARITY, the ADC is enabled to read the linearity
+  *         factors.
+  * @param  hadc            ADC handle
+  * @param  pCache          Calibration cache to fill
+  * @param  CalibrationMode Calibration run, ADC_CALIB_OFFSET or ADC_CALIB_OFFSET_LINEARITY
+  * @param  Temperature     Device temperature at calibration, in degree Celsius
+  * @param  Vdda            VDDA at calibration, in mV
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ADCEx_CalibrationCache_Save(ADC_HandleTypeDef *hadc, ADC_CalibrationCacheTypeDef *pCache,
+                                                  uint32_t CalibrationMode, int32_t Temperature, uint32_t Vdda)
+{
+  HAL_StatusTypeDef tmp_hal_status = HAL_OK;
+  uint32_t cnt;
+
+  /* Check the parameters */
+  assert_param(IS_ADC_ALL_INSTANCE(hadc->Instance));
+
+  if (pCache == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  pCache->Valid = 0UL;
+  pCache->SingleEndedFactor = LL_ADC_GetCalibrationOffsetFactor(hadc->Instance, LL_ADC_SINGLE_ENDED);
+  pCache->DifferentialFactor = LL_ADC_GetCalibrationOffsetFactor(hadc->Instance, LL_ADC_DIFFERENTIAL_ENDED);
+
+  if (CalibrationMode == ADC_CALIB_OFFSET_LINEARITY)
+  {
+    tmp_hal_status = HAL_ADCEx_LinearCalibration_GetValue(hadc, pCache->LinearFactor);
+  }
+  else
+  {
+    for (cnt = 0UL; cnt < ADC_LINEAR_CALIB_REG_COUNT; cnt++)
+    {
+      pCache->LinearFactor[cnt] = 0UL;
+    }
+  }
+
+  if (tmp_hal_status == HAL_OK)
+  {
+    pCache->CalibrationMode = CalibrationMode;
+    pCache->Temperature = Temperature;
+    pCache->Vdda = Vdda;
+    pCache->Valid = ADC_CALIBRATION_CACHE_VALID;
+  }
+
+  return tmp_hal_status;
+}
+
+/**
+  * @brief  Restore the calibration factors of the ADC from a calibration cache.
+  * @note   No calibration is run: the ADC is ready for conversion as soon as it is
+  *         enabled. The ADC is left enabled by this function.
+  * @note   No conversion must be ongoing.
+  * @param  hadc   ADC handle
+  * @param  pCache Calibration cache filled by HAL_ADCEx_CalibrationCache_Save()
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ADCEx_CalibrationCache_Restore(ADC_HandleTypeDef *hadc, const ADC_CalibrationCacheTypeDef *pCache)
+{
+  uint32_t linear_factor[ADC_LINEAR_CALIB_REG_COUNT];
+  uint32_t cnt;
+
+  /* Check the parameters */
+  assert_param(IS_ADC_ALL_INSTANCE(hadc->Instance));
+
+  if ((pCache == NULL) || (pCache->Valid != ADC_CALIBRATION_CACHE_VALID))
+  {
+    return HAL_ERROR;
+  }
+
+  if (pCache->CalibrationMode == ADC_CALIB_OFFSET_LINEARITY)
+  {
+    for (cnt = 0UL; cnt < ADC_LINEAR_CALIB_REG_COUNT; cnt++)
+    {
+      linear_factor[cnt] = pCache->LinearFactor[cnt];
+    }
+    if (HAL_ADCEx_LinearCalibration_SetValue(hadc, linear_factor) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  /* The offset factors are written with the ADC enabled */
+  if (LL_ADC_IsEnabled(hadc->Instance) == 0UL)
+  {
+    if (ADC_Enable(hadc) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  if ((LL_ADC_REG_IsConversionOngoing(hadc->Instance) != 0UL)
+      || (LL_ADC_INJ_IsConversionOngoing(hadc->Instance) != 0UL))
+  {
+    /* Update ADC state machine */
+    SET_BIT(hadc->State, HAL_ADC_STATE_ERROR_CONFIG);
+    /* Update ADC error code */
+    SET_BIT(hadc->ErrorCode, HAL_ADC_ERROR_INTERNAL);
+
+    return HAL_ERROR;
+  }
+
+  LL_ADC_SetCalibrationOffsetFactor(hadc->Instance, LL_ADC_SINGLE_ENDED, pCache->SingleEndedFactor);
+  LL_ADC_SetCalibrationOffsetFactor(hadc->Instance, LL_ADC_DIFFERENTIAL_ENDED, pCache->DifferentialFactor);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Check whether a calibration cache can be restored in the current conditions.
+  * @note   The cache is valid when it has been filled with the same calibration mode, or
+  *         with ADC_CALIB_OFFSET_LINEARITY which includes the offset calibration, and
+  *         the temperature and VDDA drifts since the calibration are within
+  *         ADC_CALIBRATION_CACHE_TEMPERATURE_TOLERANCE and
+  *         ADC_CALIBRATION_CACHE_VDDA_TOLERANCE.
+  * @param  pCache          Calibration cache
+  * @param  CalibrationMode Calibration mode required, ADC_CALIB_OFFSET or ADC_CALIB_OFFSET_LINEARITY
+  * @param  Temperature     Current device temperature, in degree Celsius
+  * @param  Vdda            Current VDDA, in mV
+  * @retval 1 if the cache can be restored, 0 if the calibration must be run
+  */
+uint32_t HAL_ADCEx_CalibrationCache_IsValid(const ADC_CalibrationCacheTypeDef *pCache, uint32_t CalibrationMode,
+                                            int32_t Temperature, uint32_t Vdda)
+{
+  int32_t temperature_drift;
+  uint32_t vdda_drift;
+
+  if ((pCache == NULL) || (pCache->Valid != ADC_CALIBRATION_CACHE_VALID))
+  {
+    return 0UL;
+  }
+
+  if ((CalibrationMode == ADC_CALIB_OFFSET_LINEARITY) && (pCache->CalibrationMode != ADC_CALIB_OFFSET_LINEARITY))
+  {
+    return 0UL;
+  }
+
+  temperature_drift = (Temperature > pCache->Temperature) ? (Temperature - pCache->Temperature)
+                      : (pCache->Temperature - Temperature);
+  vdda_drift = (Vdda > pCache->Vdda) ? (Vdda - pCache->Vdda) : (pCache->Vdda - Vdda);
+
+  if ((temperature_drift > ADC_CALIBRATION_CACHE_TEMPERATURE_TOLERANCE)
+      || (vdda_drift > ADC_CALIBRATION_CACHE_VDDA_TOLERANCE))
+  {
+    return 0UL;
+  }
+
+  return 1UL;
+}
+
+/**
+  * @brief  Calibrate the ADC, using the calibration cache when it is valid.
+  * @note   On the first call, or when the temperature or VDDA has drifted, the
+  *         calibration is run in single-ended and differential modes and the cache is
+  *         filled. Otherwise the calibration factors are restored from the cache,
+  *         which takes a few ADC clock cycles instead of the calibration time.
+  * @note   Intended to replace HAL_ADCEx_Calibration_Start() after each HAL_ADC_Init().
+  *         The ADC can be left enabled, the conversion start functions accept it.
+  * @param  hadc            ADC handle
+  * @param  CalibrationMode ADC_CALIB_OFFSET or ADC_CALIB_OFFSET_LINEARITY
+  * @param  pCache          Calibration cache, kept by the application between calls
+  * @param  Temperature     Current device temperature, in degree Celsius
+  * @param  Vdda            Current VDDA, in mV
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ADCEx_Calibration_StartCached(ADC_HandleTypeDef *hadc, uint32_t CalibrationMode,
+                                                    ADC_CalibrationCacheTypeDef *pCache, int32_t Temperature, uint32_t Vdda)
+{
+  HAL_StatusTypeDef tmp_hal_status;
+
+  /* Check the parameters */
+  assert_param(IS_ADC_ALL_INSTANCE(hadc->Instance));
+
+  if (pCache == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  if (HAL_ADCEx_CalibrationCache_IsValid(pCache, CalibrationMode, Temperature, Vdda) != 0UL)
+  {
+    if (HAL_ADCEx_CalibrationCache_Restore(hadc, pCache) == HAL_OK)
+    {
+      return HAL_OK;
+    }
+  }
+
+  /* Calibration run in both modes, so that the cache serves any channel ending */
+  tmp_hal_status = HAL_ADCEx_Calibration_Start(hadc, CalibrationMode, ADC_SINGLE_ENDED);
+  if (tmp_hal_status == HAL_OK)
+  {
+    tmp_hal_status = HAL_ADCEx_Calibration_Start(hadc, ADC_CALIB_OFFSET, ADC_DIFFERENTIAL_ENDED);
+  }
+  if (tmp_hal_status == HAL_OK)
+  {
+    tmp_hal_status = HAL_ADCEx_CalibrationCache_Save(hadc, pCache, CalibrationMode, Temperature, Vdda);
+  }
+
+  return tmp_hal_status;
+}
+
 /**
   * @brief  Enable ADC, start conversion of injected group.
   * @note   Interruptions enabled in this function: None.
@@ -1734,6 +1959,316 @@ HAL_StatusTypeDef HAL_ADCEx_RegularMultiModeStop_DMA(ADC_HandleTypeDef *hadc)
   return tmp_hal_status;
 }
 
+/**
+  * @brief  Start a streaming acquisition of ADC group regular into a circular buffer.
+  * @note   The regular sequence is expected to be configured with
+  *         HAL_ADCEx_Stream_Config(), and the DMA to be initialized in circular
+  *         mode with a half word or word memory data alignment: this gives the
+  *         size of each conversion data in the buffer.
+  * @note   The buffer holds FrameCount frames, each frame is one conversion data
+  *         per rank of the regular sequence, in rank order.
+  * @note   The DMA writes directly to memory: when the buffer is in a cacheable
+  *         area, the D-cache lines must be invalidated before the data are read,
+  *         or the buffer must be placed in a non-cacheable MPU region.
+  * @param  hadc       ADC handle
+  * @param  pStream    Streaming descriptor, must remain valid until HAL_ADCEx_Stream_Stop()
+  * @param  pBuffer    Interleaved buffer of FrameCount frames
+  * @param  FrameCount Number of frames of the buffer, a power of two from 2, with
+  *                    FrameCount multiplied by the sequence length up to 65535.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ADCEx_Stream_Start(ADC_HandleTypeDef *hadc, ADC_StreamTypeDef *pStream, uint8_t *pBuffer,
+                                         uint32_t FrameCount)
+{
+  HAL_StatusTypeDef tmp_hal_status;
+  uint32_t channel_count;
+  uint32_t item_size;
+
+  /* Check the parameters */
+  assert_param(IS_ADC_ALL_INSTANCE(hadc->Instance));
+
+  if ((pStream == NULL) || (pBuffer == NULL) || (hadc->DMA_Handle == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  if (hadc->pStream != NULL)
+  {
+    return HAL_BUSY;
+  }
+
+  /* Frame size: one conversion data per rank of the regular sequence */
+  if (hadc->Init.ScanConvMode == ADC_SCAN_DISABLE)
+  {
+    channel_count = 1UL;
+  }
+  else
+  {
+    channel_count = hadc->Init.NbrOfConversion;
+  }
+
+  if (hadc->DMA_Handle->Init.MemDataAlignment == DMA_MDATAALIGN_WORD)
+  {
+    item_size = 4UL;
+  }
+  else if (hadc->DMA_Handle->Init.MemDataAlignment == DMA_MDATAALIGN_HALFWORD)
+  {
+    item_size = 2UL;
+  }
+  else
+  {
+    return HAL_ERROR;
+  }
+
+  /* The ring indexes require a circular DMA and a power of two number of frames */
+  if ((hadc->DMA_Handle->Init.Mode != DMA_CIRCULAR)
+      || (FrameCount < 2UL)
+      || ((FrameCount & (FrameCount - 1UL)) != 0UL)
+      || ((FrameCount * channel_count) > 0xFFFFUL))
+  {
+    return HAL_ERROR;
+  }
+
+  pStream->pBuffer = pBuffer;
+  pStream->ChannelCount = channel_count;
+  pStream->ItemSize = item_size;
+  pStream->Mask = FrameCount - 1UL;
+  pStream->Head = 0UL;
+  pStream->Tail = 0UL;
+  pStream->Overrun = 0UL;
+#if defined(HAL_MDMA_MODULE_ENABLED)
+  pStream->hmdma = NULL;
+  pStream->DemuxChannel = channel_count;
+  pStream->DemuxHalf = 0UL;
+  pStream->DemuxOverrun = 0UL;
+#endif /* HAL_MDMA_MODULE_ENABLED */
+
+  hadc->pStream = pStream;
+
+  tmp_hal_status = HAL_ADC_Start_DMA(hadc, (uint32_t *)pBuffer, FrameCount * channel_count);
+  if (tmp_hal_status != HAL_OK)
+  {
+    hadc->pStream = NULL;
+  }
+
+  /* Return function status */
+  return tmp_hal_status;
+}
+
+/**
+  * @brief  Stop a streaming acquisition started with HAL_ADCEx_Stream_Start().
+  * @note   The ongoing de-interleaving, if any, is aborted.
+  * @param  hadc ADC handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ADCEx_Stream_Stop(ADC_HandleTypeDef *hadc)
+{
+  HAL_StatusTypeDef tmp_hal_status;
+
+  /* Check the parameters */
+  assert_param(IS_ADC_ALL_INSTANCE(hadc->Instance));
+
+  tmp_hal_status = HAL_ADC_Stop_DMA(hadc);
+
+#if defined(HAL_MDMA_MODULE_ENABLED)
+  if ((hadc->pStream != NULL) && (hadc->pStream->hmdma != NULL))
+  {
+    if (hadc->pStream->hmdma->State == HAL_MDMA_STATE_BUSY)
+    {
+      (void)HAL_MDMA_Abort(hadc->pStream->hmdma);
+    }
+    hadc->pStream->DemuxChannel = hadc->pStream->ChannelCount;
+  }
+#endif /* HAL_MDMA_MODULE_ENABLED */
+
+  hadc->pStream = NULL;
+
+  /* Return function status */
+  return tmp_hal_status;
+}
+
+#if defined(HAL_MDMA_MODULE_ENABLED)
+/**
+  * @brief  De-interleave each half of the streaming buffer into per-channel buffers.
+  * @note   Each time a half buffer is filled by the DMA, the MDMA copies the data of
+  *         each rank into its channel buffer with a repeated block transfer, that
+  *         steps over the other ranks, so the CPU is not involved.
+  *         HAL_ADCEx_Stream_DemuxCpltCallback() is called when all the ranks of a
+  *         half buffer are copied. The data of half buffer n are at the offset
+  *         n * FrameCount / 2 of each channel buffer.
+  * @note   A half buffer filled while the previous one is still being copied is
+  *         skipped and counted in DemuxOverrun.
+  * @note   The MDMA Init structure is set up by this function, only the Priority
+  *         is taken from the handle. The MDMA interrupt must be enabled.
+  * @note   The MDMA writes directly to memory, the D-cache coherency of the channel
+  *         buffers is to be handled as for the streaming buffer.
+  * @param  hadc           ADC handle, with a streaming acquisition ongoing
+  * @param  hmdma          MDMA handle, dedicated to the streaming acquisition
+  * @param  pChannelBuffer Array of one buffer of FrameCount data per rank
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ADCEx_Stream_StartDemux(ADC_HandleTypeDef *hadc, MDMA_HandleTypeDef *hmdma,
+                                              uint8_t *const pChannelBuffer[])
+{
+  ADC_StreamTypeDef *pStream = hadc->pStream;
+  uint32_t channel;
+
+  if ((pStream == NULL) || (hmdma == NULL) || (pChannelBuffer == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  if (pStream->hmdma != NULL)
+  {
+    return HAL_BUSY;
+  }
+
+  /* Each data of a half buffer is a block of the repeated block transfer */
+  if (((pStream->Mask + 1UL) >> 1) > 4096UL)
+  {
+    return HAL_ERROR;
+  }
+
+  hmdma->Init.Request = MDMA_REQUEST_SW;
+  hmdma->Init.TransferTriggerMode = MDMA_REPEAT_BLOCK_TRANSFER;
+  hmdma->Init.Endianness = MDMA_LITTLE_ENDIANNESS_PRESERVE;
+  if (pStream->ItemSize == 4UL)
+  {
+    hmdma->Init.SourceInc = MDMA_SRC_INC_WORD;
+    hmdma->Init.DestinationInc = MDMA_DEST_INC_WORD;
+    hmdma->Init.SourceDataSize = MDMA_SRC_DATASIZE_WORD;
+    hmdma->Init.DestDataSize = MDMA_DEST_DATASIZE_WORD;
+  }
+  else
+  {
+    hmdma->Init.SourceInc = MDMA_SRC_INC_HALFWORD;
+    hmdma->Init.DestinationInc = MDMA_DEST_INC_HALFWORD;
+    hmdma->Init.SourceDataSize = MDMA_SRC_DATASIZE_HALFWORD;
+    hmdma->Init.DestDataSize = MDMA_DEST_DATASIZE_HALFWORD;
+  }
+  hmdma->Init.DataAlignment = MDMA_DATAALIGN_PACKENABLE;
+  hmdma->Init.BufferTransferLength = pStream->ItemSize;
+  hmdma->Init.SourceBurst = MDMA_SOURCE_BURST_SINGLE;
+  hmdma->Init.DestBurst = MDMA_DEST_BURST_SINGLE;
+  /* After each data, skip the data of the other ranks of the frame */
+  hmdma->Init.SourceBlockAddressOffset = (int32_t)((pStream->ChannelCount - 1UL) * pStream->ItemSize);
+  hmdma->Init.DestBlockAddressOffset = 0;
+
+  if (HAL_MDMA_Init(hmdma) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  hmdma->Parent = hadc;
+  hmdma->XferCpltCallback = ADCEx_StreamDemuxCplt;
+  hmdma->XferErrorCallback = ADCEx_StreamDemuxError;
+
+  for (channel = 0UL; channel < pStream->ChannelCount; channel++)
+  {
+    pStream->pChannelBuffer[channel] = pChannelBuffer[channel];
+  }
+  pStream->DemuxChannel = pStream->ChannelCount;
+  pStream->DemuxOverrun = 0UL;
+
+  /* Set last: the next half buffer event starts the de-interleaving */
+  pStream->hmdma = hmdma;
+
+  return HAL_OK;
+}
+#endif /* HAL_MDMA_MODULE_ENABLED */
+
+/**
+  * @brief  Resynchronise the streaming write index with the DMA remaining data counter.
+  * @note   Called by the driver on each half buffer event. Can also be called by the
+  *         reader to get the frames converted since the last event.
+  * @param  hadc ADC handle
+  * @retval None
+  */
+void HAL_ADCEx_Stream_Update(ADC_HandleTypeDef *hadc)
+{
+  if (hadc->pStream != NULL)
+  {
+    ADCEx_StreamUpdateFromDMA(hadc);
+  }
+}
+
+/**
+  * @brief  Get a view of one channel of the oldest frames waiting in the streaming buffer.
+  * @note   The data of the channel are read in place: data i of the view is at
+  *         (pView->pData + (i * pView->Stride)).
+  * @note   Only the frames up to the end of the buffer are returned: when the waiting
+  *         frames wrap around, a second call after HAL_ADCEx_Stream_Release()
+  *         returns the remainder. The same frames are returned for each channel
+  *         until they are released.
+  * @param  pStream      Streaming descriptor
+  * @param  ChannelIndex Index of the channel in the frame, rank minus one
+  * @param  pView        Filled with the view of the channel
+  * @retval Number of frames readable in the view
+  */
+uint32_t HAL_ADCEx_Stream_GetView(ADC_StreamTypeDef *pStream, uint32_t ChannelIndex, ADC_StreamViewTypeDef *pView)
+{
+  uint32_t head = pStream->Head;
+  uint32_t tail = pStream->Tail;
+  uint32_t size = pStream->Mask + 1UL;
+  uint32_t count;
+
+  if (ChannelIndex >= pStream->ChannelCount)
+  {
+    pView->pData = NULL;
+    pView->Stride = 0UL;
+    pView->Count = 0UL;
+    return 0UL;
+  }
+
+  /* The DMA overtook the reader: skip the overwritten frames */
+  if ((head - tail) > size)
+  {
+    tail = head - size;
+    pStream->Tail = tail;
+  }
+
+  count = head - tail;
+  if (count > (size - (tail & pStream->Mask)))
+  {
+    count = size - (tail & pStream->Mask);
+  }
+
+  pView->pData = &pStream->pBuffer[(((tail & pStream->Mask) * pStream->ChannelCount) + ChannelIndex)
+                                   * pStream->ItemSize];
+  pView->Stride = pStream->ChannelCount * pStream->ItemSize;
+  pView->Count = count;
+
+  return count;
+}
+
+/**
+  * @brief  Hand frames obtained with HAL_ADCEx_Stream_GetView() back to the driver.
+  * @param  pStream Streaming descriptor
+  * @param  Count   Number of frames consumed by the reader
+  * @retval None
+  */
+void HAL_ADCEx_Stream_Release(ADC_StreamTypeDef *pStream, uint32_t Count)
+{
+  pStream->Tail += Count;
+}
+
+/**
+  * @brief  Streaming half buffer de-interleaved callback.
+  * @param  hadc      ADC handle
+  * @param  HalfIndex Half buffer copied to the channel buffers, 0 or 1
+  * @retval None
+  */
+__weak void HAL_ADCEx_Stream_DemuxCpltCallback(ADC_HandleTypeDef *hadc, uint32_t HalfIndex)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hadc);
+  UNUSED(HalfIndex);
+
+  /* NOTE : This function should not be modified. When the callback is needed,
+            function HAL_ADCEx_Stream_DemuxCpltCallback must be implemented in the user file.
+  */
+}
+
 /**
   * @}
   */
@@ -1751,6 +2286,7 @@ HAL_StatusTypeDef HAL_ADCEx_RegularMultiModeStop_DMA(ADC_HandleTypeDef *hadc)
       (+) Enable or Disable Injected Queue
       (+) Disable ADC voltage regulator
       (+) Enter ADC deep-power-down mode
+      (+) Configure a streaming acquisition
 
 @endverbatim
   * @{
@@ -2599,10 +3135,230 @@ HAL_StatusTypeDef HAL_ADCEx_EnterADCDeepPowerDownMode(ADC_HandleTypeDef *hadc)
   return tmp_hal_status;
 }
 
+/**
+  * @brief  Configure the ADC group regular for a streaming acquisition.
+  * @note   The regular sequence is set to the channels of sConfig, in order, with the
+  *         conversion data transferred by DMA in circular mode, then HAL_ADC_Init()
+  *         is called. The other parameters of the Init structure of the handle,
+  *         as the trigger and the continuous mode, are kept.
+  * @note   The hardware oversampler can be enabled: the oversampled data of a rank
+  *         holds up to 26 bits, a word memory data alignment of the DMA is required
+  *         unless the right bit shift brings it back to 16 bits.
+  * @note   The injected group is not modified and can be used concurrently.
+  * @note   This function must be called while no conversion is ongoing on
+  *         group regular.
+  * @param  hadc    ADC handle
+  * @param  sConfig Structure of ADC streaming configuration
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ADCEx_Stream_Config(ADC_HandleTypeDef *hadc, const ADC_StreamConfTypeDef *sConfig)
+{
+  static const uint32_t stream_ranks[16] =
+  {
+    ADC_REGULAR_RANK_1,  ADC_REGULAR_RANK_2,  ADC_REGULAR_RANK_3,  ADC_REGULAR_RANK_4,
+    ADC_REGULAR_RANK_5,  ADC_REGULAR_RANK_6,  ADC_REGULAR_RANK_7,  ADC_REGULAR_RANK_8,
+    ADC_REGULAR_RANK_9,  ADC_REGULAR_RANK_10, ADC_REGULAR_RANK_11, ADC_REGULAR_RANK_12,
+    ADC_REGULAR_RANK_13, ADC_REGULAR_RANK_14, ADC_REGULAR_RANK_15, ADC_REGULAR_RANK_16
+  };
+  ADC_ChannelConfTypeDef sChannel = {0};
+  HAL_StatusTypeDef tmp_hal_status;
+  uint32_t rank;
+
+  /* Check the parameters */
+  assert_param(IS_ADC_ALL_INSTANCE(hadc->Instance));
+  assert_param(IS_ADC_REGULAR_NB_CONV(sConfig->ChannelCount));
+  assert_param(IS_FUNCTIONAL_STATE(sConfig->OversamplingMode));
+
+  if ((sConfig->ChannelCount == 0UL) || (sConfig->ChannelCount > 16UL))
+  {
+    return HAL_ERROR;
+  }
+
+  if (LL_ADC_REG_IsConversionOngoing(hadc->Instance) != 0UL)
+  {
+    return HAL_BUSY;
+  }
+
+  /* Regular sequence in circular DMA mode */
+  hadc->Init.ScanConvMode = (sConfig->ChannelCount > 1UL) ? ADC_SCAN_ENABLE : ADC_SCAN_DISABLE;
+  hadc->Init.NbrOfConversion = sConfig->ChannelCount;
+  hadc->Init.DiscontinuousConvMode = DISABLE;
+  hadc->Init.ConversionDataManagement = ADC_CONVERSIONDATA_DMA_CIRCULAR;
+#if defined(ADC_VER_V5_V90)
+  hadc->Init.DMAContinuousRequests = ENABLE;
+#endif /* ADC_VER_V5_V90 */
+
+  /* Oversampling of each rank */
+  hadc->Init.OversamplingMode = sConfig->OversamplingMode;
+  if (sConfig->OversamplingMode == ENABLE)
+  {
+    hadc->Init.Oversampling = sConfig->Oversampling;
+  }
+
+  tmp_hal_status = HAL_ADC_Init(hadc);
+
+  sChannel.SamplingTime = sConfig->SamplingTime;
+  sChannel.SingleDiff = ADC_SINGLE_ENDED;
+  sChannel.OffsetNumber = ADC_OFFSET_NONE;
+  for (rank = 0UL; (rank < sConfig->ChannelCount) && (tmp_hal_status == HAL_OK); rank++)
+  {
+    sChannel.Channel = sConfig->Channel[rank];
+    sChannel.Rank = stream_ranks[rank];
+    tmp_hal_status = HAL_ADC_ConfigChannel(hadc, &sChannel);
+  }
+
+  /* Return function status */
+  return tmp_hal_status;
+}
+
+/**
+  * @}
+  */
+
 /**
   * @}
   */
 
+/** @addtogroup ADCEx_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Streaming half buffer event, called from the DMA half and full transfer callbacks.
+  * @param  hadc      ADC handle
+  * @param  HalfIndex Half buffer filled by the DMA, 0 or 1
+  * @retval None
+  */
+void ADCEx_StreamHalfBufferEvent(ADC_HandleTypeDef *hadc, uint32_t HalfIndex)
+{
+#if defined(HAL_MDMA_MODULE_ENABLED)
+  ADC_StreamTypeDef *pStream = hadc->pStream;
+#endif /* HAL_MDMA_MODULE_ENABLED */
+
+  ADCEx_StreamUpdateFromDMA(hadc);
+
+#if defined(HAL_MDMA_MODULE_ENABLED)
+  if (pStream->hmdma != NULL)
+  {
+    if (pStream->DemuxChannel < pStream->ChannelCount)
+    {
+      /* The previous half buffer is still being copied: skip this one */
+      pStream->DemuxOverrun++;
+    }
+    else
+    {
+      pStream->DemuxHalf = HalfIndex;
+      pStream->DemuxChannel = 0UL;
+      ADCEx_StreamDemuxStart(hadc);
+    }
+  }
+#else
+  UNUSED(HalfIndex);
+#endif /* HAL_MDMA_MODULE_ENABLED */
+}
+
+/**
+  * @brief  Resynchronise the streaming write index with the DMA remaining data counter.
+  * @param  hadc ADC handle
+  * @retval None
+  */
+static void ADCEx_StreamUpdateFromDMA(ADC_HandleTypeDef *hadc)
+{
+  ADC_StreamTypeDef *pStream = hadc->pStream;
+  uint32_t primask_bit;
+  uint32_t position;
+  uint32_t head;
+
+  /* The update can be entered concurrently from the DMA IRQ and the reader:
+     keep the read-modify-write of Head atomic */
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  /* Only the frames completely written are counted */
+  position = ((((pStream->Mask + 1UL) * pStream->ChannelCount) - __HAL_DMA_GET_COUNTER(hadc->DMA_Handle))
+              / pStream->ChannelCount) & pStream->Mask;
+  head = pStream->Head;
+  head += (position - head) & pStream->Mask;
+  if ((head - pStream->Tail) > (pStream->Mask + 1UL))
+  {
+    pStream->Overrun++;
+  }
+  pStream->Head = head;
+
+  __set_PRIMASK(primask_bit);
+}
+
+#if defined(HAL_MDMA_MODULE_ENABLED)
+/**
+  * @brief  Start the MDMA copy of the current rank of the half buffer being de-interleaved.
+  * @param  hadc ADC handle
+  * @retval None
+  */
+static void ADCEx_StreamDemuxStart(ADC_HandleTypeDef *hadc)
+{
+  ADC_StreamTypeDef *pStream = hadc->pStream;
+  uint32_t half_frames = (pStream->Mask + 1UL) >> 1;
+  uint32_t channel = pStream->DemuxChannel;
+  uint32_t src_address;
+  uint32_t dst_address;
+
+  src_address = (uint32_t)pStream->pBuffer
+                + ((((pStream->DemuxHalf * half_frames) * pStream->ChannelCount) + channel) * pStream->ItemSize);
+  dst_address = (uint32_t)pStream->pChannelBuffer[channel] + ((pStream->DemuxHalf * half_frames) * pStream->ItemSize);
+
+  if (HAL_MDMA_Start_IT(pStream->hmdma, src_address, dst_address, pStream->ItemSize, half_frames) != HAL_OK)
+  {
+    /* Give up this half buffer */
+    pStream->DemuxChannel = pStream->ChannelCount;
+    pStream->DemuxOverrun++;
+  }
+}
+
+/**
+  * @brief  MDMA transfer complete callback of the de-interleaving.
+  * @param  hmdma MDMA handle
+  * @retval None
+  */
+static void ADCEx_StreamDemuxCplt(MDMA_HandleTypeDef *hmdma)
+{
+  /* Retrieve ADC handle corresponding to current MDMA handle */
+  ADC_HandleTypeDef *hadc = (ADC_HandleTypeDef *)hmdma->Parent;
+  ADC_StreamTypeDef *pStream = hadc->pStream;
+
+  if (pStream != NULL)
+  {
+    pStream->DemuxChannel++;
+    if (pStream->DemuxChannel < pStream->ChannelCount)
+    {
+      /* Next rank of the same half buffer */
+      ADCEx_StreamDemuxStart(hadc);
+    }
+    else
+    {
+      HAL_ADCEx_Stream_DemuxCpltCallback(hadc, pStream->DemuxHalf);
+    }
+  }
+}
+
+/**
+  * @brief  MDMA transfer error callback of the de-interleaving.
+  * @param  hmdma MDMA handle
+  * @retval None
+  */
+static void ADCEx_StreamDemuxError(MDMA_HandleTypeDef *hmdma)
+{
+  /* Retrieve ADC handle corresponding to current MDMA handle */
+  ADC_HandleTypeDef *hadc = (ADC_HandleTypeDef *)hmdma->Parent;
+
+  if (hadc->pStream != NULL)
+  {
+    /* Give up the half buffer, the next one is copied again */
+    hadc->pStream->DemuxChannel = hadc->pStream->ChannelCount;
+    hadc->pStream->DemuxOverrun++;
+  }
+}
+#endif /* HAL_MDMA_MODULE_ENABLED */
+
 /**
   * @}
   */
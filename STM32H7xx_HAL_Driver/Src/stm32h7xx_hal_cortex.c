@@ -7,6 +7,7 @@
   *          functionalities of the CORTEX:
   *           + Initialization and de-initialization functions
   *           + Peripheral Control functions
+  *           + Interrupt priority planning functions
   *
   @verbatim
   ==============================================================================
@@ -64,6 +65,54 @@
        (++) Reload Value is the parameter to be passed for HAL_SYSTICK_Config() function
        (++) Reload Value should not exceed 0xFFFFFF
 
+    [..]
+    *** How to plan the MPU configuration using CORTEX HAL driver ***
+    ==================================================================
+    [..]
+    The memory map can be described by areas of intended use rather than by MPU regions.
+
+   (+) Fill an array of MPU_AreaTypeDef with the base address, size and usage (code,
+       data, stack, DMA buffer, framebuffer, device or no access) of each memory area.
+       Areas are listed by increasing priority: where two areas overlap, the attributes
+       of the later one apply, e.g. a DMA buffer area inside an AXI SRAM data area.
+
+   (+) Call HAL_MPU_BuildPlan() to compute the regions. Contiguous consecutive areas of
+       the same usage are merged, and each area is covered by the fewest aligned regions,
+       using subregion disables for areas that are not a power of two in size.
+       HAL_ERROR is returned when more regions than the MPU provides would be needed.
+
+   (+) Call HAL_MPU_ApplyPlan() to program the regions, disable the remaining ones and
+       enable the MPU with the given control mode. MPU_PRIVILEGED_DEFAULT keeps the
+       default memory map for the memory not covered by the plan.
+
+    [..]
+    *** How to plan the interrupt priorities using CORTEX HAL driver ***
+    ====================================================================
+    [..]
+    The interrupts can be described by latency classes rather than by priorities,
+    so that the priorities chosen by each driver, the HAL time base included, do
+    not conflict.
+
+   (+) Call HAL_NVIC_InitPlan() with the priority grouping of the application, then
+       HAL_NVIC_RegisterIRQ() for each interrupt with its latency class, e.g.
+       NVIC_LATENCY_CRITICAL for a motor PWM timer and NVIC_LATENCY_LOW for USB or
+       Ethernet. Within a class, interrupts registered first get the lowest
+       subpriorities when the grouping provides subpriority bits.
+
+   (+) Call HAL_NVIC_RegisterTick() to place the HAL time base in the plan.
+
+   (+) Call HAL_NVIC_BuildPlan() to assign one preemption priority per used class.
+       Preemption priority 0 is reserved to the NVIC_LATENCY_ZERO class; HAL_ERROR
+       is returned when the grouping does not provide enough preemption levels.
+
+   (+) Call HAL_NVIC_ApplyPlan() to program the grouping, the priorities and the
+       time base priority (uwTickPrio), then enable the interrupts.
+
+   (+) HAL_NVIC_EnterCriticalSection() and HAL_NVIC_ExitCriticalSection() mask the
+       interrupts through BASEPRI: all of them but the NVIC_LATENCY_ZERO ones, which
+       keep their latency during the critical section. They need a grouping with
+       preemption bits (not NVIC_PRIORITYGROUP_0).
+
   @endverbatim
   ******************************************************************************
   * @attention
@@ -97,6 +146,16 @@
 /* Private constants ---------------------------------------------------------*/
 /* Private macros ------------------------------------------------------------*/
 /* Private functions ---------------------------------------------------------*/
+#if (__MPU_PRESENT == 1)
+/** @defgroup CORTEX_Private_Functions CORTEX Private Functions
+  * @{
+  */
+static void MPU_SetUsageAttributes(MPU_Region_InitTypeDef *pRegion, uint32_t Usage);
+static uint32_t MPU_PlanRegion(MPU_Region_InitTypeDef *pRegion, uint32_t Address, uint32_t Size);
+/**
+  * @}
+  */
+#endif /* __MPU_PRESENT */
 /* Exported functions --------------------------------------------------------*/
 
 /** @defgroup CORTEX_Exported_Functions CORTEX Exported Functions
@@ -332,6 +391,118 @@ void HAL_MPU_ConfigRegion(MPU_Region_InitTypeDef *MPU_Init)
     MPU->RASR = 0x00;
   }
 }
+
+/**
+  * @brief  Computes the MPU regions covering a description of the memory map.
+  * @param  pAreas Pointer to an array of MPU_AreaTypeDef, by increasing priority.
+  * @param  NbAreas Number of areas in the array.
+  * @param  pPlan Pointer to a MPU_PlanTypeDef structure receiving the regions.
+  * @note   Each area is covered by the fewest regions whose enabled subregions
+  *         exactly match it: no memory outside the area gets its attributes.
+  * @retval HAL status, HAL_ERROR when an area is not 32-byte aligned or the
+  *         plan needs more than MPU_PLAN_MAX_REGIONS regions
+  */
+HAL_StatusTypeDef HAL_MPU_BuildPlan(const MPU_AreaTypeDef *pAreas, uint32_t NbAreas, MPU_PlanTypeDef *pPlan)
+{
+  uint32_t index = 0U;
+  uint32_t address;
+  uint32_t size;
+  uint32_t usage;
+  uint32_t covered;
+
+  if ((pAreas == NULL) || (pPlan == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  pPlan->NbRegions = 0U;
+
+  while (index < NbAreas)
+  {
+    assert_param(IS_MPU_AREA_USAGE(pAreas[index].Usage));
+
+    address = pAreas[index].BaseAddress;
+    size    = pAreas[index].Size;
+    usage   = pAreas[index].Usage;
+
+    if ((size == 0U) || (((address | size) & 0x1FU) != 0U) || ((size - 1U) > (0xFFFFFFFFU - address)))
+    {
+      return HAL_ERROR;
+    }
+    index++;
+
+    /* Merge the following areas of the same usage which extend this one */
+    while ((index < NbAreas) && (pAreas[index].Usage == usage) &&
+           (pAreas[index].BaseAddress == (address + size)) && (pAreas[index].Size != 0U) &&
+           ((pAreas[index].Size & 0x1FU) == 0U) && (pAreas[index].Size <= (0U - (address + size))))
+    {
+      size += pAreas[index].Size;
+      index++;
+    }
+
+    /* Cover the area with the largest possible regions */
+    while (size != 0U)
+    {
+      if (pPlan->NbRegions >= MPU_PLAN_MAX_REGIONS)
+      {
+        return HAL_ERROR;
+      }
+
+      covered = MPU_PlanRegion(&pPlan->Region[pPlan->NbRegions], address, size);
+      pPlan->Region[pPlan->NbRegions].Number = (uint8_t)pPlan->NbRegions;
+      MPU_SetUsageAttributes(&pPlan->Region[pPlan->NbRegions], usage);
+      pPlan->NbRegions++;
+
+      address += covered;
+      size    -= covered;
+    }
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Programs the MPU regions of a plan and enables the MPU.
+  * @param  pPlan Pointer to a MPU_PlanTypeDef structure filled by HAL_MPU_BuildPlan().
+  * @param  MPU_Control Specifies the control mode of the MPU during hard fault,
+  *         NMI, FAULTMASK and privileged access to the default memory
+  *         This parameter can be one of the following values:
+  *            @arg MPU_HFNMI_PRIVDEF_NONE
+  *            @arg MPU_HARDFAULT_NMI
+  *            @arg MPU_PRIVILEGED_DEFAULT
+  *            @arg MPU_HFNMI_PRIVDEF
+  * @note   The regions not used by the plan are disabled.
+  * @retval None
+  */
+void HAL_MPU_ApplyPlan(const MPU_PlanTypeDef *pPlan, uint32_t MPU_Control)
+{
+  MPU_Region_InitTypeDef region;
+  uint32_t number;
+  uint32_t nbregions = (MPU->TYPE & MPU_TYPE_DREGION_Msk) >> MPU_TYPE_DREGION_Pos;
+
+  if (nbregions > MPU_PLAN_MAX_REGIONS)
+  {
+    nbregions = MPU_PLAN_MAX_REGIONS;
+  }
+
+  HAL_MPU_Disable();
+
+  for (number = 0U; number < nbregions; number++)
+  {
+    if (number < pPlan->NbRegions)
+    {
+      region = pPlan->Region[number];
+    }
+    else
+    {
+      region.Enable = MPU_REGION_DISABLE;
+      region.Number = (uint8_t)number;
+    }
+    HAL_MPU_ConfigRegion(&region);
+  }
+
+  HAL_MPU_Enable(MPU_Control);
+}
 #endif /* __MPU_PRESENT */
 
 /**
@@ -516,10 +687,391 @@ uint32_t HAL_GetCurrentCPUID(void)
   * @}
   */
 
+/** @defgroup CORTEX_Exported_Functions_Group3 Interrupt priority planning functions
+ *  @brief   Interrupt priority planning functions
+ *
+@verbatim
+  ==============================================================================
+                 ##### Interrupt priority planning functions #####
+  ==============================================================================
+    [..]
+      This subsection provides functions to assign the interrupt priorities from
+      latency classes, and to enter and exit critical sections that keep the
+      zero-latency interrupts enabled.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Initializes an empty NVIC priority plan.
+  * @param  pPlan Pointer to a NVIC_PlanTypeDef structure.
+  * @param  PriorityGroup The priority grouping of the plan.
+  *         This parameter can be a value of @ref CORTEX_Preemption_Priority_Group
+  * @retval None
+  */
+void HAL_NVIC_InitPlan(NVIC_PlanTypeDef *pPlan, uint32_t PriorityGroup)
+{
+  /* Check the parameters */
+  assert_param(IS_NVIC_PRIORITY_GROUP(PriorityGroup));
+
+  pPlan->PriorityGroup    = PriorityGroup;
+  pPlan->NbEntries        = 0U;
+  pPlan->TickLatencyClass = NVIC_LATENCY_NONE;
+  pPlan->TickPriority     = 0U;
+}
+
+/**
+  * @brief  Registers an interrupt in an NVIC priority plan.
+  * @param  pPlan Pointer to a NVIC_PlanTypeDef structure.
+  * @param  IRQn Interrupt number, a device interrupt or a configurable Cortex-M exception.
+  * @param  LatencyClass Latency class of the interrupt.
+  *         This parameter can be a value of @ref CORTEX_NVIC_Latency_Class
+  * @note   Registering an interrupt again only changes its latency class.
+  * @retval HAL status, HAL_ERROR when the plan already holds NVIC_PLAN_MAX_ENTRIES interrupts
+  */
+HAL_StatusTypeDef HAL_NVIC_RegisterIRQ(NVIC_PlanTypeDef *pPlan, IRQn_Type IRQn, uint32_t LatencyClass)
+{
+  uint32_t index;
+
+  /* Check the parameters */
+  assert_param(IS_NVIC_PLAN_IRQ(IRQn));
+  assert_param(IS_NVIC_LATENCY_CLASS(LatencyClass));
+
+  for (index = 0U; index < pPlan->NbEntries; index++)
+  {
+    if (pPlan->Entry[index].IRQn == IRQn)
+    {
+      pPlan->Entry[index].LatencyClass = LatencyClass;
+      return HAL_OK;
+    }
+  }
+
+  if (pPlan->NbEntries >= NVIC_PLAN_MAX_ENTRIES)
+  {
+    return HAL_ERROR;
+  }
+
+  pPlan->Entry[pPlan->NbEntries].IRQn            = IRQn;
+  pPlan->Entry[pPlan->NbEntries].LatencyClass    = LatencyClass;
+  pPlan->Entry[pPlan->NbEntries].PreemptPriority = 0U;
+  pPlan->Entry[pPlan->NbEntries].SubPriority     = 0U;
+  pPlan->NbEntries++;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Registers the HAL time base in an NVIC priority plan.
+  * @param  pPlan Pointer to a NVIC_PlanTypeDef structure.
+  * @param  LatencyClass Latency class of the time base interrupt.
+  *         This parameter can be a value of @ref CORTEX_NVIC_Latency_Class
+  * @note   The time base is programmed by HAL_InitTick(), whatever its source
+  *         (SysTick or a timer), so that later HAL_InitTick(uwTickPrio) calls,
+  *         e.g. from HAL_RCC_ClockConfig(), keep the planned priority.
+  *         NVIC_LATENCY_ZERO is not allowed: HAL_IncTick() shares uwTick with
+  *         the masked code.
+  * @retval None
+  */
+void HAL_NVIC_RegisterTick(NVIC_PlanTypeDef *pPlan, uint32_t LatencyClass)
+{
+  /* Check the parameters */
+  assert_param(IS_NVIC_LATENCY_CLASS(LatencyClass));
+  assert_param(LatencyClass != NVIC_LATENCY_ZERO);
+
+  pPlan->TickLatencyClass = LatencyClass;
+}
+
+/**
+  * @brief  Assigns the priorities of the interrupts of an NVIC priority plan.
+  * @param  pPlan Pointer to a NVIC_PlanTypeDef structure.
+  * @note   Each used latency class gets its own preemption priority, in class
+  *         order, preemption priority 0 being reserved to NVIC_LATENCY_ZERO. The
+  *         interrupts of a class get increasing subpriorities by registration
+  *         order, saturated to the highest subpriority of the grouping.
+  * @retval HAL status, HAL_ERROR when the classes need more preemption priorities
+  *         than the grouping provides
+  */
+HAL_StatusTypeDef HAL_NVIC_BuildPlan(NVIC_PlanTypeDef *pPlan)
+{
+  uint32_t level[NVIC_LATENCY_BACKGROUND + 1U];
+  uint32_t sub[NVIC_LATENCY_BACKGROUND + 1U];
+  uint32_t prioritygroup;
+  uint32_t preemptbits;
+  uint32_t subbits;
+  uint32_t latencyclass;
+  uint32_t index;
+  uint32_t next;
+
+  if (pPlan == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  prioritygroup = pPlan->PriorityGroup & 0x07U;
+
+  /* Split of the priority bits, as done by NVIC_EncodePriority() */
+  preemptbits = ((7U - prioritygroup) > (uint32_t)__NVIC_PRIO_BITS) ? (uint32_t)__NVIC_PRIO_BITS : (7U - prioritygroup);
+  subbits     = ((prioritygroup + (uint32_t)__NVIC_PRIO_BITS) < 7U) ? 0U : ((prioritygroup + (uint32_t)__NVIC_PRIO_BITS) - 7U);
+
+  /* List the used classes */
+  for (latencyclass = 0U; latencyclass <= NVIC_LATENCY_BACKGROUND; latencyclass++)
+  {
+    level[latencyclass] = NVIC_LATENCY_NONE;
+    sub[latencyclass]   = 0U;
+  }
+  for (index = 0U; index < pPlan->NbEntries; index++)
+  {
+    level[pPlan->Entry[index].LatencyClass] = 0U;
+  }
+  if (pPlan->TickLatencyClass != NVIC_LATENCY_NONE)
+  {
+    level[pPlan->TickLatencyClass] = 0U;
+  }
+
+  /* One preemption priority per used class, the first one kept for zero latency */
+  next = 1U;
+  for (latencyclass = NVIC_LATENCY_CRITICAL; latencyclass <= NVIC_LATENCY_BACKGROUND; latencyclass++)
+  {
+    if (level[latencyclass] != NVIC_LATENCY_NONE)
+    {
+      if (next >= (1UL << preemptbits))
+      {
+        return HAL_ERROR;
+      }
+      level[latencyclass] = next;
+      next++;
+    }
+  }
+
+  for (index = 0U; index < pPlan->NbEntries; index++)
+  {
+    latencyclass = pPlan->Entry[index].LatencyClass;
+
+    pPlan->Entry[index].PreemptPriority = level[latencyclass];
+    pPlan->Entry[index].SubPriority     = sub[latencyclass];
+
+    if (sub[latencyclass] < ((1UL << subbits) - 1U))
+    {
+      sub[latencyclass]++;
+    }
+  }
+
+  if (pPlan->TickLatencyClass != NVIC_LATENCY_NONE)
+  {
+    pPlan->TickPriority = level[pPlan->TickLatencyClass];
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Programs the priorities of an NVIC priority plan.
+  * @param  pPlan Pointer to a NVIC_PlanTypeDef structure filled by HAL_NVIC_BuildPlan().
+  * @note   The priority grouping is set first, then the priority of each registered
+  *         interrupt and of the time base. The interrupts are not enabled.
+  * @retval HAL status of the time base configuration
+  */
+HAL_StatusTypeDef HAL_NVIC_ApplyPlan(const NVIC_PlanTypeDef *pPlan)
+{
+  uint32_t index;
+
+  NVIC_SetPriorityGrouping(pPlan->PriorityGroup);
+
+  for (index = 0U; index < pPlan->NbEntries; index++)
+  {
+    NVIC_SetPriority(pPlan->Entry[index].IRQn,
+                     NVIC_EncodePriority(pPlan->PriorityGroup, pPlan->Entry[index].PreemptPriority,
+                                         pPlan->Entry[index].SubPriority));
+  }
+
+  if (pPlan->TickLatencyClass != NVIC_LATENCY_NONE)
+  {
+    /* Also updates uwTickPrio */
+    return HAL_InitTick(pPlan->TickPriority);
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Enters a critical section masking all the interrupts but the zero-latency ones.
+  * @note   The interrupts of preemption priority 0 (NVIC_LATENCY_ZERO class of a plan)
+  *         are not masked. Critical sections may be nested.
+  * @retval Previous BASEPRI value, to be passed to HAL_NVIC_ExitCriticalSection()
+  */
+uint32_t HAL_NVIC_EnterCriticalSection(void)
+{
+  uint32_t basepri = __get_BASEPRI();
+  uint32_t prioritygroup = NVIC_GetPriorityGrouping();
+
+  /* BASEPRI does not mask anything without preemption bits */
+  assert_param(prioritygroup != NVIC_PRIORITYGROUP_0);
+
+  /* Mask the preemption priorities from 1: never lowers an already raised mask */
+  __set_BASEPRI_MAX((NVIC_EncodePriority(prioritygroup, 1U, 0U) << (8U - __NVIC_PRIO_BITS)) & 0xFFU);
+
+  return basepri;
+}
+
+/**
+  * @brief  Exits a critical section entered with HAL_NVIC_EnterCriticalSection().
+  * @param  BasePri Value returned by the matching HAL_NVIC_EnterCriticalSection() call.
+  * @retval None
+  */
+void HAL_NVIC_ExitCriticalSection(uint32_t BasePri)
+{
+  __set_BASEPRI(BasePri);
+}
 /**
   * @}
   */
 
+/**
+  * @}
+  */
+
+#if (__MPU_PRESENT == 1)
+/** @addtogroup CORTEX_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Sets the attributes of a region from the usage of the memory it covers.
+  * @param  pRegion Pointer to the region.
+  * @param  Usage Area usage, a value of @ref CORTEX_MPU_Area_Usage.
+  * @note   Cacheable regions are not shareable: on the Cortex-M7 a shareable normal
+  *         region is not cached by default.
+  * @retval None
+  */
+static void MPU_SetUsageAttributes(MPU_Region_InitTypeDef *pRegion, uint32_t Usage)
+{
+  pRegion->Enable           = MPU_REGION_ENABLE;
+  pRegion->AccessPermission = MPU_REGION_FULL_ACCESS;
+  pRegion->DisableExec      = MPU_INSTRUCTION_ACCESS_DISABLE;
+  pRegion->IsShareable      = MPU_ACCESS_NOT_SHAREABLE;
+
+  switch (Usage)
+  {
+    case MPU_USAGE_CODE:
+      /* Normal memory, write-back, read and write allocate */
+      pRegion->TypeExtField     = MPU_TEX_LEVEL1;
+      pRegion->IsCacheable      = MPU_ACCESS_CACHEABLE;
+      pRegion->IsBufferable     = MPU_ACCESS_BUFFERABLE;
+      pRegion->AccessPermission = MPU_REGION_PRIV_RO_URO;
+      pRegion->DisableExec      = MPU_INSTRUCTION_ACCESS_ENABLE;
+      break;
+
+    case MPU_USAGE_DMA_BUFFER:
+      /* Normal memory, not cacheable */
+      pRegion->TypeExtField     = MPU_TEX_LEVEL1;
+      pRegion->IsCacheable      = MPU_ACCESS_NOT_CACHEABLE;
+      pRegion->IsBufferable     = MPU_ACCESS_NOT_BUFFERABLE;
+      pRegion->IsShareable      = MPU_ACCESS_SHAREABLE;
+      break;
+
+    case MPU_USAGE_FRAMEBUFFER:
+      /* Normal memory, write-through, no write allocate */
+      pRegion->TypeExtField     = MPU_TEX_LEVEL0;
+      pRegion->IsCacheable      = MPU_ACCESS_CACHEABLE;
+      pRegion->IsBufferable     = MPU_ACCESS_NOT_BUFFERABLE;
+      break;
+
+    case MPU_USAGE_DEVICE:
+      /* Shareable device memory */
+      pRegion->TypeExtField     = MPU_TEX_LEVEL0;
+      pRegion->IsCacheable      = MPU_ACCESS_NOT_CACHEABLE;
+      pRegion->IsBufferable     = MPU_ACCESS_BUFFERABLE;
+      pRegion->IsShareable      = MPU_ACCESS_SHAREABLE;
+      break;
+
+    case MPU_USAGE_NO_ACCESS:
+      /* Strongly-ordered memory, no access */
+      pRegion->TypeExtField     = MPU_TEX_LEVEL0;
+      pRegion->IsCacheable      = MPU_ACCESS_NOT_CACHEABLE;
+      pRegion->IsBufferable     = MPU_ACCESS_NOT_BUFFERABLE;
+      pRegion->AccessPermission = MPU_REGION_NO_ACCESS;
+      break;
+
+    default:
+      /* MPU_USAGE_DATA and MPU_USAGE_STACK: normal memory, write-back, read and write allocate */
+      pRegion->TypeExtField     = MPU_TEX_LEVEL1;
+      pRegion->IsCacheable      = MPU_ACCESS_CACHEABLE;
+      pRegion->IsBufferable     = MPU_ACCESS_BUFFERABLE;
+      break;
+  }
+}
+
+/**
+  * @brief  Computes the region covering the largest part of an area from its start.
+  * @param  pRegion Pointer to the region receiving base address, size and subregion disable.
+  * @param  Address Start address of the part of the area left to cover, 32-byte aligned.
+  * @param  Size Size of the part of the area left to cover, a multiple of 32 bytes.
+  * @note   A region of 2^k bytes is aligned on its size. From 256 bytes on, its eight
+  *         subregions can be disabled one by one, so that the region may start or end
+  *         inside its alignment block. On equal coverage the smallest region is kept.
+  * @retval Number of bytes covered by the region
+  */
+static uint32_t MPU_PlanRegion(MPU_Region_InitTypeDef *pRegion, uint32_t Address, uint32_t Size)
+{
+  uint32_t order;
+  uint32_t regionsize;
+  uint32_t regionbase;
+  uint32_t subsize;
+  uint32_t first;
+  uint32_t count;
+  uint32_t covered;
+  uint32_t best = 0U;
+
+  for (order = 5U; order < 32U; order++)
+  {
+    regionsize = 1UL << order;
+    regionbase = Address & ~(regionsize - 1U);
+
+    if (order < 8U)
+    {
+      /* No subregions below 256 bytes */
+      covered = ((regionbase == Address) && (regionsize <= Size)) ? regionsize : 0U;
+      first   = 0U;
+      count   = 8U;
+    }
+    else
+    {
+      subsize = regionsize >> 3U;
+      first   = (Address - regionbase) / subsize;
+      count   = Size / subsize;
+      if (((Address - regionbase) % subsize) != 0U)
+      {
+        count = 0U;
+      }
+      else if (count > (8U - first))
+      {
+        count = 8U - first;
+      }
+      else
+      {
+        /* Limited by the area end */
+      }
+      covered = count * subsize;
+    }
+
+    if (covered > best)
+    {
+      best = covered;
+      pRegion->BaseAddress      = regionbase;
+      pRegion->Size             = (uint8_t)(order - 1U);
+      pRegion->SubRegionDisable = (uint8_t)(~(((1UL << count) - 1U) << first) & 0xFFU);
+    }
+  }
+
+  return best;
+}
+
+/**
+  * @}
+  */
+#endif /* __MPU_PRESENT */
+
 #endif /* HAL_CORTEX_MODULE_ENABLED */
 /**
   * @}
@@ -8,6 +8,7 @@
   *           + Initialization and de-initialization functions
   *           + Peripheral Control functions
   *           + Peripheral State functions
+  *           + Streaming functions
   *
   ******************************************************************************
   * @attention
@@ -38,6 +39,30 @@
              input data buffer starting with the defined initialization value
              (default or non-default) to initiate CRC calculation
 
+    [..] Streaming
+         (+) Call HAL_CRC_Begin() to load the initialization value, then feed the
+             message in pieces of any length with HAL_CRC_Update() (CPU) or
+             HAL_CRC_Update_DMA() (DMA), and read the result with HAL_CRC_Finish().
+             Sizes are given in bytes and must be a multiple of the input data
+             element size.
+         (+) For the DMA feed, configure a DMA1/DMA2 stream and link it with
+             __HAL_LINKDMA(hcrc, hdmain, hdma):
+             (++) Direction DMA_MEMORY_TO_MEMORY, PeriphInc DMA_PINC_ENABLE and
+                  MemInc DMA_MINC_DISABLE: the peripheral side is the source buffer,
+                  read by words, the memory side is the CRC DR register
+             (++) PeriphDataAlignment DMA_PDATAALIGN_WORD and MemDataAlignment
+                  matching the input data format (DMA_MDATAALIGN_BYTE for bytes,
+                  DMA_MDATAALIGN_HALFWORD for half-words, DMA_MDATAALIGN_WORD for words)
+             (++) FIFOMode DMA_FIFOMODE_ENABLE when the two sizes are different
+             (++) Mode DMA_NORMAL
+         (+) The DMA moves the word-aligned part of the buffer, the leading and trailing
+             elements are written by the CPU so that any element-aligned buffer can be
+             used. HAL_CRC_UpdateCpltCallback() is called when the piece is processed.
+         (+) The source buffer must be cleaned from the D-Cache before HAL_CRC_Update_DMA().
+         (+) Several streams can share the CRC unit: HAL_CRC_SaveContext() stores the
+             configuration and the intermediate CRC of the current stream,
+             HAL_CRC_RestoreContext() reloads them before the stream is updated again.
+
   @endverbatim
   ******************************************************************************
   */
@@ -66,6 +91,11 @@
   */
 static uint32_t CRC_Handle_8(CRC_HandleTypeDef *hcrc, uint8_t pBuffer[], uint32_t BufferLength);
 static uint32_t CRC_Handle_16(CRC_HandleTypeDef *hcrc, uint16_t pBuffer[], uint32_t BufferLength);
+static void CRC_Feed(CRC_HandleTypeDef *hcrc, uint8_t *pData, uint32_t Size);
+#if defined(HAL_DMA_MODULE_ENABLED)
+static void CRC_DMAUpdateCplt(DMA_HandleTypeDef *hdma);
+static void CRC_DMAError(DMA_HandleTypeDef *hdma);
+#endif /* HAL_DMA_MODULE_ENABLED */
 /**
   * @}
   */
@@ -409,6 +439,273 @@ HAL_CRC_StateTypeDef HAL_CRC_GetState(CRC_HandleTypeDef *hcrc)
   return hcrc->State;
 }
 
+/**
+  * @}
+  */
+
+/** @defgroup CRC_Exported_Functions_Group4 Streaming functions
+  *  @brief    Streaming functions.
+  *
+@verbatim
+ ===============================================================================
+                      ##### Streaming functions #####
+ ===============================================================================
+    [..]  This section provides functions allowing to:
+      (+) compute the CRC of a message fed in several pieces, by the CPU or by DMA
+      (+) save and restore the CRC unit context to interleave several streams
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Start a new CRC stream: the initialization value is loaded in DR.
+  * @param  hcrc CRC handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_CRC_Begin(CRC_HandleTypeDef *hcrc)
+{
+  if (hcrc->State != HAL_CRC_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  /* Reset CRC Calculation Unit (hcrc->Instance->INIT is
+  *  written in hcrc->Instance->DR) */
+  __HAL_CRC_DR_RESET(hcrc);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Feed a piece of the current stream to the CRC calculator by CPU.
+  * @param  hcrc CRC handle
+  * @param  pData pointer to the piece, aligned on the input data element size
+  * @param  Size size of the piece in bytes, multiple of the input data element size
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_CRC_Update(CRC_HandleTypeDef *hcrc, uint8_t *pData, uint32_t Size)
+{
+  assert_param(IS_CRC_INPUTDATA_FORMAT(hcrc->InputDataFormat));
+  assert_param(IS_CRC_STREAM_BUFFER(hcrc->InputDataFormat, (uint32_t)pData, Size));
+
+  if (hcrc->State != HAL_CRC_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  hcrc->State = HAL_CRC_STATE_BUSY;
+
+  CRC_Feed(hcrc, pData, Size);
+
+  hcrc->State = HAL_CRC_STATE_READY;
+
+  return HAL_OK;
+}
+
+#if defined(HAL_DMA_MODULE_ENABLED)
+/**
+  * @brief  Feed a piece of the current stream to the CRC calculator by DMA.
+  * @note   The leading elements up to the first word boundary are written by the CPU
+  *         before the DMA is started, the trailing ones at the end of the DMA transfer.
+  *         HAL_CRC_UpdateCpltCallback() is called when the whole piece is processed.
+  * @note   The hdmain stream must be configured as described in the "How to use"
+  *         section, HAL_ERROR is returned otherwise.
+  * @param  hcrc CRC handle
+  * @param  pData pointer to the piece, aligned on the input data element size
+  * @param  Size size of the piece in bytes, multiple of the input data element size
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_CRC_Update_DMA(CRC_HandleTypeDef *hcrc, uint8_t *pData, uint32_t Size)
+{
+  uint32_t memalign;
+  uint32_t head;
+  uint32_t words;
+
+  assert_param(IS_CRC_INPUTDATA_FORMAT(hcrc->InputDataFormat));
+  assert_param(IS_CRC_STREAM_BUFFER(hcrc->InputDataFormat, (uint32_t)pData, Size));
+
+  if (hcrc->State != HAL_CRC_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  if (hcrc->hdmain == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* The DMA reads words from the buffer and writes elements to DR */
+  switch (hcrc->InputDataFormat)
+  {
+    case CRC_INPUTDATA_FORMAT_BYTES:
+      memalign = DMA_MDATAALIGN_BYTE;
+      break;
+    case CRC_INPUTDATA_FORMAT_HALFWORDS:
+      memalign = DMA_MDATAALIGN_HALFWORD;
+      break;
+    default:
+      memalign = DMA_MDATAALIGN_WORD;
+      break;
+  }
+
+  if ((IS_DMA_STREAM_INSTANCE(hcrc->hdmain->Instance) == 0U)              ||
+      (hcrc->hdmain->Init.Direction != DMA_MEMORY_TO_MEMORY)              ||
+      (hcrc->hdmain->Init.PeriphInc != DMA_PINC_ENABLE)                   ||
+      (hcrc->hdmain->Init.MemInc != DMA_MINC_DISABLE)                     ||
+      (hcrc->hdmain->Init.PeriphDataAlignment != DMA_PDATAALIGN_WORD)     ||
+      (hcrc->hdmain->Init.MemDataAlignment != memalign)                   ||
+      ((memalign != DMA_MDATAALIGN_WORD) && (hcrc->hdmain->Init.FIFOMode != DMA_FIFOMODE_ENABLE)))
+  {
+    return HAL_ERROR;
+  }
+
+  hcrc->State = HAL_CRC_STATE_BUSY;
+
+  /* Leading elements up to the first word boundary */
+  head = (4U - ((uint32_t)pData & 3U)) & 3U;
+  if (head > Size)
+  {
+    head = Size;
+  }
+  CRC_Feed(hcrc, pData, head);
+
+  words = (Size - head) / 4U;
+  hcrc->pTailBuffer = &pData[head + (4U * words)];
+  hcrc->TailSize = (Size - head) % 4U;
+
+  if (words == 0U)
+  {
+    /* Nothing left for the DMA */
+    CRC_Feed(hcrc, hcrc->pTailBuffer, hcrc->TailSize);
+    hcrc->State = HAL_CRC_STATE_READY;
+    HAL_CRC_UpdateCpltCallback(hcrc);
+    return HAL_OK;
+  }
+
+  hcrc->hdmain->XferCpltCallback = CRC_DMAUpdateCplt;
+  hcrc->hdmain->XferHalfCpltCallback = NULL;
+  hcrc->hdmain->XferErrorCallback = CRC_DMAError;
+  hcrc->hdmain->XferAbortCallback = NULL;
+
+  if (HAL_DMA_Start_IT(hcrc->hdmain, (uint32_t)&pData[head], (uint32_t)&hcrc->Instance->DR, words) != HAL_OK)
+  {
+    hcrc->State = HAL_CRC_STATE_ERROR;
+    return HAL_ERROR;
+  }
+
+  return HAL_OK;
+}
+#endif /* HAL_DMA_MODULE_ENABLED */
+
+/**
+  * @brief  Return the CRC of the current stream.
+  * @note   The stream can be continued with HAL_CRC_Update() after this call.
+  * @param  hcrc CRC handle
+  * @retval uint32_t CRC (returned value LSBs for CRC shorter than 32 bits)
+  */
+uint32_t HAL_CRC_Finish(CRC_HandleTypeDef *hcrc)
+{
+  return hcrc->Instance->DR;
+}
+
+/**
+  * @brief  Save the configuration and the intermediate CRC of the current stream.
+  * @param  hcrc CRC handle
+  * @param  pContext pointer to the context storage
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_CRC_SaveContext(CRC_HandleTypeDef *hcrc, CRC_ContextTypeDef *pContext)
+{
+  uint32_t control;
+
+  if (hcrc->State != HAL_CRC_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  control = READ_BIT(hcrc->Instance->CR, CRC_CR_POLYSIZE | CRC_CR_REV_IN | CRC_CR_REV_OUT);
+
+  /* The output inversion applies to DR reads only: read the intermediate CRC without it
+     so that it can be written back in INIT */
+  CLEAR_BIT(hcrc->Instance->CR, CRC_CR_REV_OUT);
+  pContext->Crc = hcrc->Instance->DR;
+  WRITE_REG(hcrc->Instance->CR, control);
+
+  pContext->InitValue = hcrc->Instance->INIT;
+  pContext->Polynomial = hcrc->Instance->POL;
+  pContext->Control = control;
+  pContext->InputDataFormat = hcrc->InputDataFormat;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Restore a stream saved by HAL_CRC_SaveContext() in the CRC unit.
+  * @note   The handle Init fields and InputDataFormat are updated with the context.
+  * @param  hcrc CRC handle
+  * @param  pContext pointer to the context storage
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_CRC_RestoreContext(CRC_HandleTypeDef *hcrc, const CRC_ContextTypeDef *pContext)
+{
+  assert_param(IS_CRC_INPUTDATA_FORMAT(pContext->InputDataFormat));
+
+  if (hcrc->State != HAL_CRC_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  WRITE_REG(hcrc->Instance->POL, pContext->Polynomial);
+  WRITE_REG(hcrc->Instance->CR, pContext->Control);
+
+  /* The intermediate CRC is loaded in DR through INIT */
+  WRITE_REG(hcrc->Instance->INIT, pContext->Crc);
+  __HAL_CRC_DR_RESET(hcrc);
+  WRITE_REG(hcrc->Instance->INIT, pContext->InitValue);
+
+  hcrc->Init.GeneratingPolynomial = pContext->Polynomial;
+  hcrc->Init.CRCLength = pContext->Control & CRC_CR_POLYSIZE;
+  hcrc->Init.InitValue = pContext->InitValue;
+  hcrc->Init.InputDataInversionMode = pContext->Control & CRC_CR_REV_IN;
+  hcrc->Init.OutputDataInversionMode = pContext->Control & CRC_CR_REV_OUT;
+  hcrc->Init.DefaultPolynomialUse = DEFAULT_POLYNOMIAL_DISABLE;
+  hcrc->Init.DefaultInitValueUse = DEFAULT_INIT_VALUE_DISABLE;
+  hcrc->InputDataFormat = pContext->InputDataFormat;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  CRC stream piece processed callback.
+  * @param  hcrc CRC handle
+  * @retval None
+  */
+__weak void HAL_CRC_UpdateCpltCallback(CRC_HandleTypeDef *hcrc)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hcrc);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_CRC_UpdateCpltCallback can be implemented in the user file
+   */
+}
+
+/**
+  * @brief  CRC DMA error callback.
+  * @param  hcrc CRC handle
+  * @retval None
+  */
+__weak void HAL_CRC_ErrorCallback(CRC_HandleTypeDef *hcrc)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hcrc);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_CRC_ErrorCallback can be implemented in the user file
+   */
+}
+
 /**
   * @}
   */
@@ -502,6 +799,76 @@ static uint32_t CRC_Handle_16(CRC_HandleTypeDef *hcrc, uint16_t pBuffer[], uint3
   return hcrc->Instance->DR;
 }
 
+/**
+  * @brief  Enter a stream piece to the CRC calculator according to the input data format.
+  * @param  hcrc CRC handle
+  * @param  pData pointer to the piece, aligned on the input data element size
+  * @param  Size size of the piece in bytes
+  * @retval None
+  */
+static void CRC_Feed(CRC_HandleTypeDef *hcrc, uint8_t *pData, uint32_t Size)
+{
+  uint32_t index;
+  const uint32_t *pWord;
+
+  switch (hcrc->InputDataFormat)
+  {
+    case CRC_INPUTDATA_FORMAT_WORDS:
+      pWord = (const uint32_t *)(void *)pData;                                  /* Derogation MisraC2012 R.11.5 */
+      for (index = 0U; index < (Size / 4U); index++)
+      {
+        hcrc->Instance->DR = pWord[index];
+      }
+      break;
+
+    case CRC_INPUTDATA_FORMAT_BYTES:
+      (void)CRC_Handle_8(hcrc, pData, Size);
+      break;
+
+    case CRC_INPUTDATA_FORMAT_HALFWORDS:
+      (void)CRC_Handle_16(hcrc, (uint16_t *)(void *)pData, Size / 2U);         /* Derogation MisraC2012 R.11.5 */
+      break;
+
+    default:
+      break;
+  }
+}
+
+#if defined(HAL_DMA_MODULE_ENABLED)
+/**
+  * @brief  DMA CRC stream piece transfer complete callback.
+  * @param  hdma DMA handle
+  * @retval None
+  */
+static void CRC_DMAUpdateCplt(DMA_HandleTypeDef *hdma)
+{
+  CRC_HandleTypeDef *hcrc = (CRC_HandleTypeDef *)((DMA_HandleTypeDef *)hdma)->Parent;
+
+  /* Trailing elements after the last word boundary */
+  CRC_Feed(hcrc, hcrc->pTailBuffer, hcrc->TailSize);
+  hcrc->TailSize = 0U;
+
+  hcrc->State = HAL_CRC_STATE_READY;
+
+  HAL_CRC_UpdateCpltCallback(hcrc);
+}
+
+/**
+  * @brief  DMA CRC stream piece transfer error callback.
+  * @param  hdma DMA handle
+  * @retval None
+  */
+static void CRC_DMAError(DMA_HandleTypeDef *hdma)
+{
+  CRC_HandleTypeDef *hcrc = (CRC_HandleTypeDef *)((DMA_HandleTypeDef *)hdma)->Parent;
+
+  hcrc->TailSize = 0U;
+  hcrc->State = HAL_CRC_STATE_ERROR;
+
+  HAL_CRC_ErrorCallback(hcrc);
+}
+#endif /* HAL_DMA_MODULE_ENABLED */
+
 /**
   * @}
   */
@@ -467,6 +467,9 @@ HAL_StatusTypeDef HAL_CRYP_Init(CRYP_HandleTypeDef *hcryp)
   /* Reset peripheral Key and IV configuration flag */
   hcryp->KeyIVConfig = 0U;
 
+  /* No AEAD stream loaded in the peripheral */
+  hcryp->pActiveStream = NULL;
+
   /* Change the CRYP state */
   hcryp->State = HAL_CRYP_STATE_READY;
 
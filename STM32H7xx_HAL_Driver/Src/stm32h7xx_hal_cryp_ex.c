@@ -6,6 +6,7 @@
   *          This file provides firmware functions to manage the following
   *          functionalities of CRYP extension peripheral:
   *           + Extended AES processing functions
+  *           + AES-GCM/CCM streaming functions
   *
   ******************************************************************************
   * @attention
@@ -26,6 +27,24 @@
     The CRYP extension HAL driver can be used after AES-GCM or AES-CCM
     Encryption/Decryption to get the authentication messages.
 
+    [..]
+    Several AES-GCM or AES-CCM messages (e.g. TLS records of interleaved connections)
+    can be processed incrementally by DMA on the same handle with the stream functions:
+    (#) Declare one CRYP_AEADStreamTypeDef per message and start it with
+        HAL_CRYPEx_AEADStreamInit(), giving the key, IV (GCM) or B0 (CCM) and header.
+    (#) Process the payload by pieces with HAL_CRYPEx_AEADStreamEncrypt_DMA() or
+        HAL_CRYPEx_AEADStreamDecrypt_DMA(). Every piece but the last one must be a
+        multiple of 16 bytes. Input and Output can be the same buffer (in-place).
+        Wait for HAL_CRYP_OutCpltCallback() before the next call on the handle.
+    (#) Get the authentication tag with HAL_CRYPEx_AEADStreamFinish().
+    (#) When another stream is used, the context of the stream loaded in the
+        peripheral (CR, IV and context swap registers) is saved in its structure and
+        the context of the requested stream is restored, so the streams can be
+        interleaved in any order. The key is written again from the stream
+        configuration.
+    (#) Call HAL_CRYPEx_AEADStreamSuspend() before using the other processing
+        functions on the handle, the loaded stream is saved and restored on its next use.
+
   @endverbatim
   */
 
@@ -64,6 +83,8 @@
 #define CRYP_CCM_CTR0_0            0x07FFFFFFU
 #define CRYP_CCM_CTR0_3            0xFFFFFF00U
 
+#define CRYPEx_TIMEOUT_CONTEXTSWAP 10U        /*!< Timeout in ms to wait for the end of the processing before a context swap */
+
 /**
   * @}
   */
@@ -71,7 +92,9 @@
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
-
+static HAL_StatusTypeDef CRYPEx_StreamSelect(CRYP_HandleTypeDef *hcryp, CRYP_AEADStreamTypeDef *hstream);
+static void CRYPEx_StreamSave(CRYP_HandleTypeDef *hcryp, CRYP_AEADStreamTypeDef *hstream);
+static void CRYPEx_StreamRestore(CRYP_HandleTypeDef *hcryp, const CRYP_AEADStreamTypeDef *hstream);
 
 
 /* Exported functions---------------------------------------------------------*/
@@ -440,12 +463,375 @@ HAL_StatusTypeDef HAL_CRYPEx_AESCCM_GenerateAuthTAG(CRYP_HandleTypeDef *hcryp, u
   * @}
   */
 
+/** @defgroup CRYPEx_Exported_Functions_Group2 AES-GCM/CCM streaming functions
+  *  @brief    CRYPEx AES-GCM/CCM streaming functions.
+  *
+@verbatim
+  ==============================================================================
+              ##### AES-GCM/CCM streaming functions #####
+  ==============================================================================
+    [..]  This section provides functions allowing to process several AES-GCM or
+          AES-CCM messages incrementally, by DMA, on the same peripheral
+      (+)HAL_CRYPEx_AEADStreamInit
+      (+)HAL_CRYPEx_AEADStreamEncrypt_DMA
+      (+)HAL_CRYPEx_AEADStreamDecrypt_DMA
+      (+)HAL_CRYPEx_AEADStreamFinish
+      (+)HAL_CRYPEx_AEADStreamSuspend
 
-#endif /* HAL_CRYP_MODULE_ENABLED */
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Start a new AES-GCM or AES-CCM message on a stream.
+  * @param  hcryp: pointer to a CRYP_HandleTypeDef structure that contains
+  *         the configuration information for CRYP module
+  * @param  hstream: stream to start, a message in progress on it is discarded
+  * @param  pConf: stream configuration, Algorithm must be CRYP_AES_GCM or CRYP_AES_CCM.
+  *         KeyIVConfigSkip is ignored.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_CRYPEx_AEADStreamInit(CRYP_HandleTypeDef *hcryp, CRYP_AEADStreamTypeDef *hstream,
+                                            const CRYP_ConfigTypeDef *pConf)
+{
+  if ((hstream == NULL) || (pConf == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check parameters */
+  assert_param(IS_CRYP_KEYSIZE(pConf->KeySize));
+  assert_param(IS_CRYP_DATATYPE(pConf->DataType));
+
+  if ((pConf->Algorithm != CRYP_AES_GCM) && (pConf->Algorithm != CRYP_AES_CCM))
+  {
+    hcryp->ErrorCode |= HAL_CRYP_ERROR_NOT_SUPPORTED;
+    return HAL_ERROR;
+  }
+
+  /* A stream restarted while loaded in the peripheral is no longer saved */
+  if (hcryp->pActiveStream == hstream)
+  {
+    hcryp->pActiveStream = NULL;
+  }
+
+  hstream->Init = *pConf;
+  /* The init and header phases are done by the first payload update only */
+  hstream->Init.KeyIVConfigSkip = CRYP_KEYIVCONFIG_ONCE;
+  hstream->KeyIVConfig = 0U;
+  hstream->SizesSum = 0U;
+  hstream->Phase = 0U;
+  hstream->PayloadClosed = 0U;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Encrypt a payload piece of a stream in DMA mode.
+  * @note   HAL_CRYP_OutCpltCallback() is called when the piece is processed.
+  * @param  hcryp: pointer to a CRYP_HandleTypeDef structure that contains
+  *         the configuration information for CRYP module
+  * @param  hstream: stream started by HAL_CRYPEx_AEADStreamInit()
+  * @param  Input: Pointer to the plain text buffer
+  * @param  Size: Length of the piece, in words or bytes according to DataWidthUnit.
+  *         Must be a multiple of 16 bytes, except for the last piece of the message.
+  * @param  Output: Pointer to the cipher text buffer, can be equal to Input
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_CRYPEx_AEADStreamEncrypt_DMA(CRYP_HandleTypeDef *hcryp, CRYP_AEADStreamTypeDef *hstream,
+                                                   uint32_t *Input, uint16_t Size, uint32_t *Output)
+{
+  uint32_t size_in_bytes = (hstream->Init.DataWidthUnit == CRYP_DATAWIDTHUNIT_WORD) ? ((uint32_t)Size * 4U) :
+                           (uint32_t)Size;
+
+  if (hstream->PayloadClosed != 0U)
+  {
+    hcryp->ErrorCode |= HAL_CRYP_ERROR_AUTH_TAG_SEQUENCE;
+    return HAL_ERROR;
+  }
+
+  if (CRYPEx_StreamSelect(hcryp, hstream) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  if ((size_in_bytes % 16U) != 0U)
+  {
+    hstream->PayloadClosed = 1U;
+  }
+
+  return HAL_CRYP_Encrypt_DMA(hcryp, Input, Size, Output);
+}
+
+/**
+  * @brief  Decrypt a payload piece of a stream in DMA mode.
+  * @note   HAL_CRYP_OutCpltCallback() is called when the piece is processed.
+  * @param  hcryp: pointer to a CRYP_HandleTypeDef structure that contains
+  *         the configuration information for CRYP module
+  * @param  hstream: stream started by HAL_CRYPEx_AEADStreamInit()
+  * @param  Input: Pointer to the cipher text buffer
+  * @param  Size: Length of the piece, in words or bytes according to DataWidthUnit.
+  *         Must be a multiple of 16 bytes, except for the last piece of the message.
+  * @param  Output: Pointer to the plain text buffer, can be equal to Input
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_CRYPEx_AEADStreamDecrypt_DMA(CRYP_HandleTypeDef *hcryp, CRYP_AEADStreamTypeDef *hstream,
+                                                   uint32_t *Input, uint16_t Size, uint32_t *Output)
+{
+  uint32_t size_in_bytes = (hstream->Init.DataWidthUnit == CRYP_DATAWIDTHUNIT_WORD) ? ((uint32_t)Size * 4U) :
+                           (uint32_t)Size;
+
+  if (hstream->PayloadClosed != 0U)
+  {
+    hcryp->ErrorCode |= HAL_CRYP_ERROR_AUTH_TAG_SEQUENCE;
+    return HAL_ERROR;
+  }
+
+  if (CRYPEx_StreamSelect(hcryp, hstream) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  if ((size_in_bytes % 16U) != 0U)
+  {
+    hstream->PayloadClosed = 1U;
+  }
+
+  return HAL_CRYP_Decrypt_DMA(hcryp, Input, Size, Output);
+}
+
+/**
+  * @brief  Generate the authentication tag of a stream. The stream must be started
+  *         again with HAL_CRYPEx_AEADStreamInit() to be used for a new message.
+  * @param  hcryp: pointer to a CRYP_HandleTypeDef structure that contains
+  *         the configuration information for CRYP module
+  * @param  hstream: stream started by HAL_CRYPEx_AEADStreamInit()
+  * @param  AuthTag: Pointer to the 128-bit authentication tag buffer
+  * @param  Timeout: Timeout duration
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_CRYPEx_AEADStreamFinish(CRYP_HandleTypeDef *hcryp, CRYP_AEADStreamTypeDef *hstream,
+                                              uint32_t *AuthTag, uint32_t Timeout)
+{
+  HAL_StatusTypeDef status;
+
+  if (CRYPEx_StreamSelect(hcryp, hstream) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  if (hstream->Init.Algorithm == CRYP_AES_GCM)
+  {
+    status = HAL_CRYPEx_AESGCM_GenerateAuthTAG(hcryp, AuthTag, Timeout);
+  }
+  else
+  {
+    status = HAL_CRYPEx_AESCCM_GenerateAuthTAG(hcryp, AuthTag, Timeout);
+  }
+
+  /* The message is complete, the stream is no longer loaded */
+  hcryp->pActiveStream = NULL;
+  hcryp->KeyIVConfig = 0U;
+  hstream->KeyIVConfig = 0U;
+  hstream->PayloadClosed = 1U;
+
+  return status;
+}
+
+/**
+  * @brief  Save the stream loaded in the peripheral, so that the handle can be used
+  *         by the other processing functions.
+  * @param  hcryp: pointer to a CRYP_HandleTypeDef structure that contains
+  *         the configuration information for CRYP module
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_CRYPEx_AEADStreamSuspend(CRYP_HandleTypeDef *hcryp)
+{
+  return CRYPEx_StreamSelect(hcryp, NULL);
+}
 
 /**
   * @}
   */
+
+/**
+  * @}
+  */
+
+/** @addtogroup CRYPEx_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Load a stream in the peripheral, the stream previously loaded is saved.
+  * @param  hcryp: pointer to a CRYP_HandleTypeDef structure that contains
+  *         the configuration information for CRYP module
+  * @param  hstream: stream to load, or NULL to only save the loaded stream
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef CRYPEx_StreamSelect(CRYP_HandleTypeDef *hcryp, CRYP_AEADStreamTypeDef *hstream)
+{
+  uint32_t tickstart;
+
+  if (hcryp->pActiveStream == hstream)
+  {
+    return HAL_OK;
+  }
+
+  /* The previous DMA processing must be complete */
+  if (hcryp->State != HAL_CRYP_STATE_READY)
+  {
+    hcryp->ErrorCode |= HAL_CRYP_ERROR_BUSY;
+    return HAL_ERROR;
+  }
+
+  if (hcryp->pActiveStream != NULL)
+  {
+    /* Wait for the end of the processing of the last block */
+    tickstart = HAL_GetTick();
+    while ((HAL_IS_BIT_CLR(hcryp->Instance->SR, CRYP_FLAG_IFEM)) ||
+           (HAL_IS_BIT_SET(hcryp->Instance->SR, CRYP_FLAG_BUSY)))
+    {
+      if ((HAL_GetTick() - tickstart) > CRYPEx_TIMEOUT_CONTEXTSWAP)
+      {
+        hcryp->ErrorCode |= HAL_CRYP_ERROR_TIMEOUT;
+        return HAL_ERROR;
+      }
+    }
+
+    CRYPEx_StreamSave(hcryp, hcryp->pActiveStream);
+    hcryp->pActiveStream = NULL;
+  }
+
+  if (hstream != NULL)
+  {
+    CRYPEx_StreamRestore(hcryp, hstream);
+    hcryp->pActiveStream = hstream;
+  }
+  else
+  {
+    /* The other processing functions start with a full configuration */
+    hcryp->KeyIVConfig = 0U;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Save the peripheral context and the handle processing state in a stream.
+  * @param  hcryp: pointer to a CRYP_HandleTypeDef structure that contains
+  *         the configuration information for CRYP module
+  * @param  hstream: stream loaded in the peripheral
+  * @retval None
+  */
+static void CRYPEx_StreamSave(CRYP_HandleTypeDef *hcryp, CRYP_AEADStreamTypeDef *hstream)
+{
+  const __IO uint32_t *csgcmccm = &hcryp->Instance->CSGCMCCM0R;
+  const __IO uint32_t *csgcm = &hcryp->Instance->CSGCM0R;
+  uint32_t index;
+
+  hstream->KeyIVConfig = hcryp->KeyIVConfig;
+  hstream->SizesSum = hcryp->SizesSum;
+  hstream->Phase = hcryp->Phase;
+
+  if (hstream->KeyIVConfig == 0U)
+  {
+    /* Nothing processed yet, the peripheral holds no context for the stream */
+    return;
+  }
+
+  /* The context swap registers are read with the peripheral disabled */
+  __HAL_CRYP_DISABLE(hcryp);
+
+  hstream->CR = hcryp->Instance->CR & ~(CRYP_CR_CRYPEN | CRYP_CR_FFLUSH);
+  hstream->IV[0] = hcryp->Instance->IV0LR;
+  hstream->IV[1] = hcryp->Instance->IV0RR;
+  hstream->IV[2] = hcryp->Instance->IV1LR;
+  hstream->IV[3] = hcryp->Instance->IV1RR;
+
+  for (index = 0U; index < 8U; index++)
+  {
+    hstream->CSGCMCCM[index] = csgcmccm[index];
+    if (hstream->Init.Algorithm == CRYP_AES_GCM)
+    {
+      hstream->CSGCM[index] = csgcm[index];
+    }
+  }
+}
+
+/**
+  * @brief  Restore the peripheral context and the handle processing state from a stream.
+  * @param  hcryp: pointer to a CRYP_HandleTypeDef structure that contains
+  *         the configuration information for CRYP module
+  * @param  hstream: stream to load
+  * @retval None
+  */
+static void CRYPEx_StreamRestore(CRYP_HandleTypeDef *hcryp, const CRYP_AEADStreamTypeDef *hstream)
+{
+  __IO uint32_t *csgcmccm = &hcryp->Instance->CSGCMCCM0R;
+  __IO uint32_t *csgcm = &hcryp->Instance->CSGCM0R;
+  __IO uint32_t *key = &hcryp->Instance->K0LR;
+  uint32_t keywords;
+  uint32_t index;
+
+  hcryp->Init = hstream->Init;
+  hcryp->KeyIVConfig = hstream->KeyIVConfig;
+  hcryp->SizesSum = hstream->SizesSum;
+  hcryp->Phase = hstream->Phase;
+
+  __HAL_CRYP_DISABLE(hcryp);
+
+  if (hstream->KeyIVConfig == 0U)
+  {
+    /* New message: only the algorithm is configured, the init and header phases
+       are done by the first payload update */
+    MODIFY_REG(hcryp->Instance->CR, CRYP_CR_DATATYPE | CRYP_CR_KEYSIZE | CRYP_CR_ALGOMODE,
+               hcryp->Init.DataType | hcryp->Init.KeySize | hcryp->Init.Algorithm);
+    return;
+  }
+
+  /* Key registers, the key is right-aligned in K0LR..K3RR */
+  if (hcryp->Init.KeySize == CRYP_KEYSIZE_256B)
+  {
+    keywords = 8U;
+  }
+  else if (hcryp->Init.KeySize == CRYP_KEYSIZE_192B)
+  {
+    keywords = 6U;
+  }
+  else
+  {
+    keywords = 4U;
+  }
+  for (index = 0U; index < keywords; index++)
+  {
+    key[(8U - keywords) + index] = hcryp->Init.pKey[index];
+  }
+
+  hcryp->Instance->IV0LR = hstream->IV[0];
+  hcryp->Instance->IV0RR = hstream->IV[1];
+  hcryp->Instance->IV1LR = hstream->IV[2];
+  hcryp->Instance->IV1RR = hstream->IV[3];
+
+  /* Algorithm, direction and GCM/CCM phase, the peripheral stays disabled */
+  hcryp->Instance->CR = hstream->CR;
+
+  for (index = 0U; index < 8U; index++)
+  {
+    csgcmccm[index] = hstream->CSGCMCCM[index];
+    if (hstream->Init.Algorithm == CRYP_AES_GCM)
+    {
+      csgcm[index] = hstream->CSGCM[index];
+    }
+  }
+}
+
+/**
+  * @}
+  */
+
+#endif /* HAL_CRYP_MODULE_ENABLED */
+
 #endif /* CRYP */
 /**
   * @}
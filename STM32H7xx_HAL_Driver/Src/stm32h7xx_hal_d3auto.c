@@ -0,0 +1,659 @@
+/**
+  ******************************************************************************
+  * @file    stm32h7xx_hal_d3auto.c
+  * @author  MCD Application Team
+  * @brief   D3 domain autonomous acquisition HAL module driver.
+             This file provides firmware functions to log the data of a D3 domain
+             peripheral (LPUART1, SPI6, I2C4, ADC3, SAI4...) into SRAM4 with the
+             BDMA while the CPU domains are in Stop mode.
+              + Initialization and de-initialization functions
+              + Acquisition and low-power mode functions
+              + Peripheral State and Error functions
+
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  @verbatim
+ ===============================================================================
+                        ##### How to use this driver #####
+ ===============================================================================
+  [..]
+    The D3 domain, with the BDMA, DMAMUX2, SRAM4 and the D3 peripherals, can stay
+    in Run mode while the D1 and D2 domains are in DStop. This driver keeps the
+    clocks of the D3 domain running in autonomous mode, fills a circular buffer in
+    SRAM4 with the BDMA and wakes the CPU up only when one half of the buffer is
+    filled, so that the CPU does not wake up for each sample.
+
+    *** Initialization ***
+    ======================
+    [..]
+     (#) Initialize the BDMA channel with HAL_DMA_Init() in circular mode, peripheral
+         to memory direction, with the request of the D3 peripheral (BDMA_REQUEST_xxx),
+         or a DMAMUX2 request generator (BDMA_REQUEST_GENERATORx) to pace the transfers
+         with a D3 trigger such as an LPTIM output.
+     (#) Enable the BDMA channel interrupt in the NVIC and call HAL_DMA_IRQHandler()
+         with the BDMA handle from the BDMA_Channelx_IRQHandler().
+     (#) Set the hdma field of the D3AUTO_HandleTypeDef to the BDMA handle, fill
+         the Init structure then call HAL_D3AUTO_Init(). Init.AutonomousClocks gives
+         the D3 peripherals used by the acquisition, for instance D3AUTO_CLOCK_ADC3
+         and D3AUTO_CLOCK_LPTIM2: their clocks are kept while the CPU is in CStop.
+         The request generator trigger fields are only used with BDMA_REQUEST_GENERATORx.
+
+    *** Acquisition ***
+    ===================
+    [..]
+     (#) Call HAL_D3AUTO_Start() with the peripheral data register address and a
+         buffer located in SRAM4 (D3_SRAM_BASE). The D3 domain is then kept in Run
+         mode whatever the CPU low-power mode, and the BDMA half transfer and
+         transfer complete interrupts become EXTI wake-up events of the CPU.
+     (#) Start the D3 peripheral with its DMA request enabled, without its own _DMA
+         function since the BDMA channel is already running: for instance with
+         ADC_CONVERSIONDATA_DMA_CIRCULAR and HAL_ADC_Start() for ADC3.
+     (#) Call HAL_D3AUTO_EnterSTOPMode() in the main loop. It enters Stop mode and
+         returns once a half buffer is filled. HAL_D3AUTO_HalfBufferCallback() and
+         HAL_D3AUTO_FullBufferCallback() give which half of the buffer can be read.
+         The half is invalidated in the data cache before the callback is called.
+     (#) HAL_D3AUTO_Stop() stops the BDMA, removes the wake-up events and lets the D3
+         domain follow the CPU low-power mode again.
+
+    *** Notes ***
+    =============
+    [..]
+     (#) The D3 domain stays in Run mode: the system clock is not stopped and the
+         kernel clock of the D3 peripherals must stay available. A low system clock
+         frequency, set before HAL_D3AUTO_Start(), lowers the D3 consumption.
+     (#) When the data cache is enabled, the buffer must be aligned on 32 bytes and
+         each half buffer must be a multiple of 32 bytes.
+     (#) Other wake-up events are served by their interrupt handlers, then the CPU
+         goes back to Stop mode until the end of the next half buffer.
+
+  @endverbatim
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32h7xx_hal.h"
+
+#if defined(RCC_D3AMR_BDMAAMEN)
+
+/** @addtogroup STM32H7xx_HAL_Driver
+  * @{
+  */
+
+/** @defgroup D3AUTO D3AUTO
+  * @brief D3 domain autonomous acquisition HAL module driver
+  * @{
+  */
+
+#if defined(HAL_DMA_MODULE_ENABLED) && defined(HAL_D3AUTO_MODULE_ENABLED)
+
+/**
+  @cond 0
+  */
+/* Private typedef -----------------------------------------------------------*/
+
+/* Private define ------------------------------------------------------------*/
+#define D3AUTO_EXTI_LINE_BDMA_CH0         EXTI_IMR3_IM66_Pos  /*!< BDMA channel 0 interrupt is EXTI line 66, the
+                                                                   following channels are on the following lines */
+
+/* CPU domain entering DStop and its EXTI wake-up mask registers */
+#if defined(DUAL_CORE) && defined(CORE_CM4)
+#define D3AUTO_CPU_DOMAIN                 PWR_D2_DOMAIN
+#define D3AUTO_EXTI_CPU                   EXTI_D2
+#else
+#define D3AUTO_CPU_DOMAIN                 PWR_D1_DOMAIN
+#define D3AUTO_EXTI_CPU                   EXTI_D1
+#endif /* DUAL_CORE && CORE_CM4 */
+
+/* Private macro -------------------------------------------------------------*/
+
+/* Private variables ---------------------------------------------------------*/
+
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t D3AUTO_GetChannelIndex(const DMA_HandleTypeDef *hdma);
+static uint32_t D3AUTO_GetItemSize(const DMA_HandleTypeDef *hdma);
+static uint32_t D3AUTO_IsRequestGenerator(const DMA_HandleTypeDef *hdma);
+static void     D3AUTO_InvalidateHalf(const D3AUTO_HandleTypeDef *hd3auto, uint32_t Half);
+static void     D3AUTO_DMAHalfCplt(DMA_HandleTypeDef *hdma);
+static void     D3AUTO_DMACplt(DMA_HandleTypeDef *hdma);
+static void     D3AUTO_DMAError(DMA_HandleTypeDef *hdma);
+/**
+  @endcond
+  */
+
+/* Exported functions --------------------------------------------------------*/
+
+/** @defgroup D3AUTO_Exported_Functions D3AUTO Exported Functions
+  * @{
+  */
+
+/** @defgroup D3AUTO_Exported_Functions_Group1 Initialization/de-initialization functions
+  *  @brief    Initialization and Configuration functions
+  *
+@verbatim
+ ===============================================================================
+            ##### Initialization and Configuration functions #####
+ ===============================================================================
+    [..]
+    This subsection provides a set of functions allowing to :
+      (+) Initialize the autonomous acquisition on a BDMA channel.
+      (+) De-initialize the autonomous acquisition.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Initialize the D3 domain autonomous acquisition.
+  * @note   The BDMA handle must be initialized by the application in circular
+  *         mode and peripheral to memory direction.
+  * @param  hd3auto D3AUTO handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_D3AUTO_Init(D3AUTO_HandleTypeDef *hd3auto)
+{
+  HAL_DMA_MuxRequestGeneratorConfigTypeDef generator;
+
+  /* Check the D3AUTO handle allocation */
+  if (hd3auto == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the parameters */
+  assert_param(IS_D3AUTO_CLOCKS(hd3auto->Init.AutonomousClocks));
+
+  hd3auto->ErrorCode = HAL_D3AUTO_ERROR_NONE;
+
+  /* Only the BDMA reaches SRAM4 and keeps running in autonomous mode */
+  if ((hd3auto->hdma == NULL) || (IS_BDMA_CHANNEL_INSTANCE(hd3auto->hdma->Instance) == 0U) ||
+      (hd3auto->hdma->Init.Mode != DMA_CIRCULAR) || (hd3auto->hdma->Init.Direction != DMA_PERIPH_TO_MEMORY))
+  {
+    hd3auto->ErrorCode = HAL_D3AUTO_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  /* Configure the DMAMUX2 request generator pacing the transfers */
+  if (D3AUTO_IsRequestGenerator(hd3auto->hdma) != 0U)
+  {
+    generator.SignalID      = hd3auto->Init.TriggerSignal;
+    generator.Polarity      = hd3auto->Init.TriggerPolarity;
+    generator.RequestNumber = hd3auto->Init.RequestNumber;
+
+    if (HAL_DMAEx_ConfigMuxRequestGenerator(hd3auto->hdma, &generator) != HAL_OK)
+    {
+      hd3auto->ErrorCode = HAL_D3AUTO_ERROR_DMA;
+      return HAL_ERROR;
+    }
+  }
+
+  hd3auto->hdma->Parent = hd3auto;
+  hd3auto->pBuffer = NULL;
+  hd3auto->Length = 0U;
+  hd3auto->WakeUpCount = 0U;
+  hd3auto->Lock = HAL_UNLOCKED;
+  hd3auto->State = HAL_D3AUTO_STATE_READY;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  De-initialize the D3 domain autonomous acquisition.
+  * @note   An ongoing acquisition is stopped. The BDMA handle is not de-initialized.
+  * @param  hd3auto D3AUTO handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_D3AUTO_DeInit(D3AUTO_HandleTypeDef *hd3auto)
+{
+  /* Check the D3AUTO handle allocation */
+  if (hd3auto == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  if (hd3auto->State == HAL_D3AUTO_STATE_BUSY)
+  {
+    (void)HAL_D3AUTO_Stop(hd3auto);
+  }
+
+  hd3auto->ErrorCode = HAL_D3AUTO_ERROR_NONE;
+  hd3auto->State = HAL_D3AUTO_STATE_RESET;
+
+  return HAL_OK;
+}
+
+/**
+  * @}
+  */
+
+/** @defgroup D3AUTO_Exported_Functions_Group2 Acquisition and low-power mode functions
+  *  @brief    Acquisition and low-power mode functions
+  *
+@verbatim
+ ===============================================================================
+                ##### Acquisition and low-power mode functions #####
+ ===============================================================================
+    [..]
+    This subsection provides a set of functions allowing to :
+      (+) Start and stop the acquisition into SRAM4.
+      (+) Enter Stop mode until the next half buffer is filled.
+      (+) Handle the half buffer callbacks.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Start the acquisition of a D3 peripheral into a circular buffer in SRAM4.
+  * @param  hd3auto    D3AUTO handle
+  * @param  SrcAddress Address of the data register of the D3 peripheral
+  * @param  pBuffer    Circular buffer, located in SRAM4
+  * @param  Length     Number of BDMA data items of the buffer, even, from 2 to 65534
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_D3AUTO_Start(D3AUTO_HandleTypeDef *hd3auto, uint32_t SrcAddress, uint8_t *pBuffer, uint32_t Length)
+{
+  uint32_t size;
+  uint32_t channel;
+
+  if (hd3auto->State != HAL_D3AUTO_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  size = Length * D3AUTO_GetItemSize(hd3auto->hdma);
+
+  if ((pBuffer == NULL) || (Length < 2U) || (Length > 0xFFFFU) || ((Length & 1U) != 0U) ||
+      (!IS_D3AUTO_SRAM4_BUFFER((uint32_t)pBuffer, size)))
+  {
+    hd3auto->ErrorCode = HAL_D3AUTO_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  if ((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+  {
+    /* Each half is invalidated when filled: it must own its cache lines */
+    if ((((uint32_t)pBuffer & 31U) != 0U) || (((size / 2U) & 31U) != 0U))
+    {
+      hd3auto->ErrorCode = HAL_D3AUTO_ERROR_PARAM;
+      return HAL_ERROR;
+    }
+
+    /* Write back and drop the buffer lines so that no eviction overwrites the logged data */
+    SCB_CleanInvalidateDCache_by_Addr((uint32_t *)(void *)pBuffer, (int32_t)size);
+  }
+#endif /* __DCACHE_PRESENT */
+
+  /* Process locked */
+  __HAL_LOCK(hd3auto);
+
+  hd3auto->pBuffer = pBuffer;
+  hd3auto->Length = Length;
+  hd3auto->WakeUpCount = 0U;
+  hd3auto->ErrorCode = HAL_D3AUTO_ERROR_NONE;
+
+  hd3auto->hdma->XferHalfCpltCallback = D3AUTO_DMAHalfCplt;
+  hd3auto->hdma->XferCpltCallback = D3AUTO_DMACplt;
+  hd3auto->hdma->XferErrorCallback = D3AUTO_DMAError;
+  hd3auto->hdma->XferAbortCallback = NULL;
+
+  /* Keep the BDMA, SRAM4 and peripheral clocks while the CPU is in CStop */
+  SET_BIT(RCC->D3AMR, (RCC_D3AMR_BDMAAMEN | RCC_D3AMR_SRAM4AMEN | hd3auto->Init.AutonomousClocks));
+
+  if (HAL_DMA_Start_IT(hd3auto->hdma, SrcAddress, (uint32_t)pBuffer, Length) != HAL_OK)
+  {
+    hd3auto->ErrorCode = HAL_D3AUTO_ERROR_DMA;
+
+    /* Process unlocked */
+    __HAL_UNLOCK(hd3auto);
+
+    return HAL_ERROR;
+  }
+
+  if (D3AUTO_IsRequestGenerator(hd3auto->hdma) != 0U)
+  {
+    (void)HAL_DMAEx_EnableMuxRequestGenerator(hd3auto->hdma);
+  }
+
+  /* The BDMA channel interrupt wakes the CPU up from CStop through its EXTI direct line */
+  channel = D3AUTO_GetChannelIndex(hd3auto->hdma);
+  SET_BIT(D3AUTO_EXTI_CPU->IMR3, 1UL << (D3AUTO_EXTI_LINE_BDMA_CH0 + channel));
+
+  /* Keep the D3 domain in Run mode whatever the CPU domains low-power mode */
+  HAL_PWREx_ConfigD3Domain(PWR_D3_DOMAIN_RUN);
+
+  hd3auto->State = HAL_D3AUTO_STATE_BUSY;
+
+  /* Process unlocked */
+  __HAL_UNLOCK(hd3auto);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop the acquisition.
+  * @note   The D3 peripheral is not stopped by this function.
+  * @param  hd3auto D3AUTO handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_D3AUTO_Stop(D3AUTO_HandleTypeDef *hd3auto)
+{
+  uint32_t channel;
+  HAL_StatusTypeDef status = HAL_OK;
+
+  if ((hd3auto->State != HAL_D3AUTO_STATE_BUSY) && (hd3auto->State != HAL_D3AUTO_STATE_ERROR))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Process locked */
+  __HAL_LOCK(hd3auto);
+
+  if (D3AUTO_IsRequestGenerator(hd3auto->hdma) != 0U)
+  {
+    (void)HAL_DMAEx_DisableMuxRequestGenerator(hd3auto->hdma);
+  }
+
+  if (hd3auto->State == HAL_D3AUTO_STATE_BUSY)
+  {
+    if (HAL_DMA_Abort(hd3auto->hdma) != HAL_OK)
+    {
+      hd3auto->ErrorCode = HAL_D3AUTO_ERROR_DMA;
+      status = HAL_ERROR;
+    }
+  }
+
+  channel = D3AUTO_GetChannelIndex(hd3auto->hdma);
+  CLEAR_BIT(D3AUTO_EXTI_CPU->IMR3, 1UL << (D3AUTO_EXTI_LINE_BDMA_CH0 + channel));
+
+  /* Let the D3 domain follow the CPU domains again */
+  HAL_PWREx_ConfigD3Domain(PWR_D3_DOMAIN_STOP);
+  CLEAR_BIT(RCC->D3AMR, (RCC_D3AMR_BDMAAMEN | RCC_D3AMR_SRAM4AMEN | hd3auto->Init.AutonomousClocks));
+
+  hd3auto->State = HAL_D3AUTO_STATE_READY;
+
+  /* Process unlocked */
+  __HAL_UNLOCK(hd3auto);
+
+  return status;
+}
+
+/**
+  * @brief  Enter the CPU domain in Stop mode until the next half buffer is filled.
+  * @note   The function returns after HAL_D3AUTO_HalfBufferCallback() or
+  *         HAL_D3AUTO_FullBufferCallback() is called, or on a BDMA error. The
+  *         other wake-up events are served by their interrupt handlers and the
+  *         CPU goes back to Stop mode.
+  * @note   The function must be called with the interrupts enabled. The HAL tick
+  *         is suspended while in Stop mode.
+  * @param  hd3auto   D3AUTO handle
+  * @param  Regulator Regulator state in Stop mode.
+  *          This parameter can be one of the following values:
+  *            @arg PWR_MAINREGULATOR_ON     : Stop mode with regulator ON.
+  *            @arg PWR_LOWPOWERREGULATOR_ON : Stop mode with low power regulator ON.
+  * @retval None
+  */
+void HAL_D3AUTO_EnterSTOPMode(D3AUTO_HandleTypeDef *hd3auto, uint32_t Regulator)
+{
+  uint32_t count = hd3auto->WakeUpCount;
+
+  if (hd3auto->State != HAL_D3AUTO_STATE_BUSY)
+  {
+    return;
+  }
+
+  HAL_SuspendTick();
+
+#if defined(PWR_CPUCR_PDDS_D2) && !defined(DUAL_CORE)
+  /* The D2 domain enters DStop with the D1 domain */
+  HAL_PWREx_EnterSTOPMode(Regulator, PWR_STOPENTRY_WFI, PWR_D2_DOMAIN);
+#endif /* PWR_CPUCR_PDDS_D2 && !DUAL_CORE */
+
+  /* The state is checked with the interrupts masked so that an end of half buffer
+     raised before the WFI is not missed: the pending interrupt ends the WFI */
+  __disable_irq();
+  while ((hd3auto->WakeUpCount == count) && (hd3auto->State == HAL_D3AUTO_STATE_BUSY))
+  {
+    HAL_PWREx_EnterSTOPMode(Regulator, PWR_STOPENTRY_WFI, D3AUTO_CPU_DOMAIN);
+
+    /* Serve the interrupt which woke the CPU up */
+    __enable_irq();
+    __ISB();
+    __disable_irq();
+  }
+  __enable_irq();
+
+  HAL_ResumeTick();
+}
+
+/**
+  * @brief  First half of the buffer filled callback.
+  * @param  hd3auto D3AUTO handle
+  * @retval None
+  */
+__weak void HAL_D3AUTO_HalfBufferCallback(D3AUTO_HandleTypeDef *hd3auto)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hd3auto);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_D3AUTO_HalfBufferCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Second half of the buffer filled callback.
+  * @param  hd3auto D3AUTO handle
+  * @retval None
+  */
+__weak void HAL_D3AUTO_FullBufferCallback(D3AUTO_HandleTypeDef *hd3auto)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hd3auto);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_D3AUTO_FullBufferCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Acquisition error callback.
+  * @param  hd3auto D3AUTO handle
+  * @retval None
+  */
+__weak void HAL_D3AUTO_ErrorCallback(D3AUTO_HandleTypeDef *hd3auto)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hd3auto);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_D3AUTO_ErrorCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @}
+  */
+
+/** @defgroup D3AUTO_Exported_Functions_Group3 Peripheral State and Error functions
+  *  @brief   Peripheral State and Error functions
+  *
+@verbatim
+ ===============================================================================
+            ##### Peripheral State and Errors functions #####
+ ===============================================================================
+    [..]
+    This subsection provides functions allowing to
+      (+) Check the acquisition state.
+      (+) Get the acquisition error code.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Return the acquisition state.
+  * @param  hd3auto D3AUTO handle
+  * @retval HAL state
+  */
+HAL_D3AUTO_StateTypeDef HAL_D3AUTO_GetState(D3AUTO_HandleTypeDef *hd3auto)
+{
+  return hd3auto->State;
+}
+
+/**
+  * @brief  Return the acquisition error code.
+  * @param  hd3auto D3AUTO handle
+  * @retval Error code, a value of @ref D3AUTO_ErrorCode
+  */
+uint32_t HAL_D3AUTO_GetError(D3AUTO_HandleTypeDef *hd3auto)
+{
+  return hd3auto->ErrorCode;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  @cond 0
+  */
+/**
+  * @brief  Return the index of the BDMA channel.
+  * @param  hdma BDMA handle
+  * @retval Channel index, from 0 to 7
+  */
+static uint32_t D3AUTO_GetChannelIndex(const DMA_HandleTypeDef *hdma)
+{
+  return ((uint32_t)hdma->Instance - (uint32_t)BDMA_Channel0) / ((uint32_t)BDMA_Channel1 - (uint32_t)BDMA_Channel0);
+}
+
+/**
+  * @brief  Return the size of a BDMA memory data item.
+  * @param  hdma BDMA handle
+  * @retval Size in bytes
+  */
+static uint32_t D3AUTO_GetItemSize(const DMA_HandleTypeDef *hdma)
+{
+  uint32_t size;
+
+  if (hdma->Init.MemDataAlignment == DMA_MDATAALIGN_WORD)
+  {
+    size = 4U;
+  }
+  else if (hdma->Init.MemDataAlignment == DMA_MDATAALIGN_HALFWORD)
+  {
+    size = 2U;
+  }
+  else
+  {
+    size = 1U;
+  }
+
+  return size;
+}
+
+/**
+  * @brief  Tell whether the BDMA request is a DMAMUX2 request generator.
+  * @param  hdma BDMA handle
+  * @retval 1 for a request generator, 0 otherwise
+  */
+static uint32_t D3AUTO_IsRequestGenerator(const DMA_HandleTypeDef *hdma)
+{
+  return ((hdma->Init.Request >= BDMA_REQUEST_GENERATOR0) && (hdma->Init.Request <= BDMA_REQUEST_GENERATOR7)) ? 1U : 0U;
+}
+
+/**
+  * @brief  Invalidate a half buffer in the data cache before it is read by the CPU.
+  * @param  hd3auto D3AUTO handle
+  * @param  Half    0 for the first half, 1 for the second half
+  * @retval None
+  */
+static void D3AUTO_InvalidateHalf(const D3AUTO_HandleTypeDef *hd3auto, uint32_t Half)
+{
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  uint32_t half_size = (hd3auto->Length / 2U) * D3AUTO_GetItemSize(hd3auto->hdma);
+
+  if ((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+  {
+    SCB_InvalidateDCache_by_Addr((uint32_t *)(void *)&hd3auto->pBuffer[Half * half_size], (int32_t)half_size);
+  }
+#else
+  UNUSED(hd3auto);
+  UNUSED(Half);
+#endif /* __DCACHE_PRESENT */
+}
+
+/**
+  * @brief  BDMA half transfer callback.
+  * @param  hdma BDMA handle
+  * @retval None
+  */
+static void D3AUTO_DMAHalfCplt(DMA_HandleTypeDef *hdma)
+{
+  D3AUTO_HandleTypeDef *hd3auto = (D3AUTO_HandleTypeDef *)(hdma->Parent);
+
+  D3AUTO_InvalidateHalf(hd3auto, 0U);
+  hd3auto->WakeUpCount++;
+
+  HAL_D3AUTO_HalfBufferCallback(hd3auto);
+}
+
+/**
+  * @brief  BDMA transfer complete callback.
+  * @param  hdma BDMA handle
+  * @retval None
+  */
+static void D3AUTO_DMACplt(DMA_HandleTypeDef *hdma)
+{
+  D3AUTO_HandleTypeDef *hd3auto = (D3AUTO_HandleTypeDef *)(hdma->Parent);
+
+  D3AUTO_InvalidateHalf(hd3auto, 1U);
+  hd3auto->WakeUpCount++;
+
+  HAL_D3AUTO_FullBufferCallback(hd3auto);
+}
+
+/**
+  * @brief  BDMA error callback.
+  * @note   The BDMA channel is already disabled by HAL_DMA_IRQHandler().
+  * @param  hdma BDMA handle
+  * @retval None
+  */
+static void D3AUTO_DMAError(DMA_HandleTypeDef *hdma)
+{
+  D3AUTO_HandleTypeDef *hd3auto = (D3AUTO_HandleTypeDef *)(hdma->Parent);
+
+  hd3auto->ErrorCode |= HAL_D3AUTO_ERROR_DMA;
+  hd3auto->State = HAL_D3AUTO_STATE_ERROR;
+
+  HAL_D3AUTO_ErrorCallback(hd3auto);
+}
+/**
+  @endcond
+  */
+
+#endif /* HAL_DMA_MODULE_ENABLED && HAL_D3AUTO_MODULE_ENABLED */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#endif /* RCC_D3AMR_BDMAAMEN */
@@ -48,6 +48,20 @@
         window from the received image using HAL_DCMI_ConfigCrop()
         and HAL_DCMI_EnableCrop() functions
 
+    (#) Optionally, drop pixels and lines of the received image using
+        HAL_DCMI_ConfigDecimation() function.
+
+    (#) Instead of a whole frame buffer, the image can be streamed into a ring of
+        line buffers described by a DCMI_LineStreamTypeDef structure, using
+        HAL_DCMI_StartLineStream_DMA() function. HAL_DCMI_LineBufferCpltCallback()
+        is called each time LinesPerBuffer lines are captured, the index of the
+        buffer and its first line in the frame being given by the CompletedBuffer
+        and CompletedLine fields of the structure. The buffer can be processed until
+        the DMA comes back to it, NbBuffers - 1 buffers later. When an MDMA handle
+        is given, each completed buffer is first moved by the MDMA to DstAddress at
+        the position of its lines in the frame, and the callback is called at the end
+        of the MDMA transfer.
+
     (#) The capture can be stopped using HAL_DCMI_Stop() function.
 
     (#) To control DCMI state you can use the function HAL_DCMI_GetState().
@@ -64,6 +78,7 @@
        (+) FrameEventCallback   : callback for DCMI Frame event.
        (+) VsyncEventCallback   : callback for DCMI Vsync event.
        (+) ErrorCallback        : callback for error detection.
+       (+) LineBufferCpltCallback : callback for line buffer complete.
        (+) MspInitCallback      : callback for Msp Init.
        (+) MspDeInitCallback    : callback for Msp DeInit.
      This function takes as parameters the HAL peripheral handle, the Callback ID
@@ -76,6 +91,7 @@
        (+) FrameEventCallback   : callback for DCMI Frame event.
        (+) VsyncEventCallback   : callback for DCMI Vsync event.
        (+) ErrorCallback        : callback for error detection.
+       (+) LineBufferCpltCallback : callback for line buffer complete.
        (+) MspInitCallback      : callback for Msp Init.
        (+) MspDeInitCallback    : callback for Msp DeInit.
 
@@ -146,6 +162,12 @@
 /* Private function prototypes -----------------------------------------------*/
 static void       DCMI_DMAXferCplt(DMA_HandleTypeDef *hdma);
 static void       DCMI_DMAError(DMA_HandleTypeDef *hdma);
+static void       DCMI_DMALineXferCplt(DMA_HandleTypeDef *hdma);
+static void       DCMI_LineBufferCplt(DCMI_HandleTypeDef *hdcmi);
+#if defined(HAL_MDMA_MODULE_ENABLED)
+static void       DCMI_MDMALineXferCplt(MDMA_HandleTypeDef *hmdma);
+static void       DCMI_MDMAError(MDMA_HandleTypeDef *hmdma);
+#endif /* HAL_MDMA_MODULE_ENABLED */
 
 /* Exported functions --------------------------------------------------------*/
 
@@ -207,6 +229,7 @@ HAL_StatusTypeDef HAL_DCMI_Init(DCMI_HandleTypeDef *hdcmi)
     hdcmi->VsyncEventCallback = HAL_DCMI_VsyncEventCallback; /* Legacy weak VsyncEventCallback  */
     hdcmi->LineEventCallback  = HAL_DCMI_LineEventCallback;  /* Legacy weak LineEventCallback   */
     hdcmi->ErrorCallback      = HAL_DCMI_ErrorCallback;      /* Legacy weak ErrorCallback       */
+    hdcmi->LineBufferCpltCallback = HAL_DCMI_LineBufferCpltCallback; /* Legacy weak LineBufferCpltCallback */
 
     if (hdcmi->MspInitCallback == NULL)
     {
@@ -255,6 +278,9 @@ HAL_StatusTypeDef HAL_DCMI_Init(DCMI_HandleTypeDef *hdcmi)
   /* Enable the Line, Vsync, Error and Overrun interrupts */
   __HAL_DCMI_ENABLE_IT(hdcmi, DCMI_IT_LINE | DCMI_IT_VSYNC | DCMI_IT_ERR | DCMI_IT_OVR);
 
+  /* No line streaming */
+  hdcmi->pLineStream = NULL;
+
   /* Update error code */
   hdcmi->ErrorCode = HAL_DCMI_ERROR_NONE;
 
@@ -343,6 +369,7 @@ __weak void HAL_DCMI_MspDeInit(DCMI_HandleTypeDef *hdcmi)
     [..]  This section provides functions allowing to:
       (+) Configure destination address and data length and
           Enables DCMI DMA request and enables DCMI capture
+      (+) Stream the capture into a ring of line buffers.
       (+) Stop the DCMI capture.
       (+) Handles DCMI interrupt request.
 
@@ -394,6 +421,7 @@ HAL_StatusTypeDef HAL_DCMI_Start_DMA(DCMI_HandleTypeDef *hdcmi, uint32_t DCMI_Mo
   hdcmi->XferTransferNumber = 0;
   hdcmi->XferSize = 0;
   hdcmi->pBuffPtr = 0;
+  hdcmi->pLineStream = NULL;
 
   if (Length <= 0xFFFFU)
   {
@@ -458,6 +486,112 @@ HAL_StatusTypeDef HAL_DCMI_Start_DMA(DCMI_HandleTypeDef *hdcmi, uint32_t DCMI_Mo
   return HAL_OK;
 }
 
+/**
+  * @brief  Enables DCMI DMA request and enables DCMI capture into a ring of line buffers
+  * @param  hdcmi     pointer to a DCMI_HandleTypeDef structure that contains
+  *                    the configuration information for DCMI.
+  * @param  DCMI_Mode DCMI capture mode snapshot or continuous grab.
+  * @param  pStream   pointer to a DCMI_LineStreamTypeDef structure that describes the
+  *                    ring of line buffers. It must remain valid until the capture is stopped.
+  * @note   The DMA stream must be configured in circular mode, the buffers going alternately
+  *         to its memory 0 and memory 1 in double buffer mode.
+  * @note   In snapshot mode, the DMA is stopped at the end of the frame.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DCMI_StartLineStream_DMA(DCMI_HandleTypeDef *hdcmi, uint32_t DCMI_Mode,
+                                               DCMI_LineStreamTypeDef *pStream)
+{
+  uint32_t buffer_size;
+
+  /* Check function parameters */
+  assert_param(IS_DCMI_CAPTURE_MODE(DCMI_Mode));
+
+  /* Check the line streaming parameters */
+  if ((pStream == NULL) || (pStream->NbBuffers < 2U) || (pStream->LinesPerBuffer == 0U) ||
+      (pStream->LineSize == 0U) || ((pStream->LineSize % 4U) != 0U) || ((pStream->pBuffer % 4U) != 0U) ||
+      (pStream->FrameLines == 0U) || ((pStream->FrameLines % pStream->LinesPerBuffer) != 0U))
+  {
+    return HAL_ERROR;
+  }
+  buffer_size = pStream->LineSize * pStream->LinesPerBuffer;
+  if ((buffer_size / 4U) > 0xFFFFU)
+  {
+    return HAL_ERROR;
+  }
+#if defined(HAL_MDMA_MODULE_ENABLED)
+  if ((pStream->hmdma != NULL) && (buffer_size > 0x10000U))
+  {
+    return HAL_ERROR;
+  }
+#endif /* HAL_MDMA_MODULE_ENABLED */
+
+  /* Process Locked */
+  __HAL_LOCK(hdcmi);
+
+  /* Lock the DCMI peripheral state */
+  hdcmi->State = HAL_DCMI_STATE_BUSY;
+
+  /* Enable DCMI by setting DCMIEN bit */
+  __HAL_DCMI_ENABLE(hdcmi);
+
+  /* Configure the DCMI Mode */
+  hdcmi->Instance->CR &= ~(DCMI_CR_CM);
+  hdcmi->Instance->CR |= (uint32_t)(DCMI_Mode);
+
+  /* Initialize the ring of line buffers, buffers 0 and 1 being filled first */
+  pStream->CompletedBuffer = 0U;
+  pStream->CompletedLine = 0U;
+  pStream->FrameCount = 0U;
+  pStream->NextBuffer = 0U;
+  pStream->NextLine = 0U;
+  hdcmi->pLineStream = pStream;
+
+#if defined(HAL_MDMA_MODULE_ENABLED)
+  if (pStream->hmdma != NULL)
+  {
+    /* Set the MDMA callbacks */
+    pStream->hmdma->Parent = hdcmi;
+    pStream->hmdma->XferCpltCallback = DCMI_MDMALineXferCplt;
+    pStream->hmdma->XferErrorCallback = DCMI_MDMAError;
+  }
+#endif /* HAL_MDMA_MODULE_ENABLED */
+
+  /* Set the DMA memory0 and memory1 conversion complete callbacks */
+  hdcmi->DMA_Handle->XferCpltCallback = DCMI_DMALineXferCplt;
+  hdcmi->DMA_Handle->XferM1CpltCallback = DCMI_DMALineXferCplt;
+
+  /* Set the DMA error callback */
+  hdcmi->DMA_Handle->XferErrorCallback = DCMI_DMAError;
+
+  /* Set the dma abort callback */
+  hdcmi->DMA_Handle->XferAbortCallback = NULL;
+
+  /* Start DMA multi buffer transfer on the two first buffers of the ring */
+  if (HAL_DMAEx_MultiBufferStart_IT(hdcmi->DMA_Handle, (uint32_t)&hdcmi->Instance->DR, pStream->pBuffer,
+                                    pStream->pBuffer + buffer_size, buffer_size / 4U) != HAL_OK)
+  {
+    /* Set Error Code */
+    hdcmi->ErrorCode = HAL_DCMI_ERROR_DMA;
+    /* Stop line streaming */
+    hdcmi->pLineStream = NULL;
+    /* Change DCMI state */
+    hdcmi->State = HAL_DCMI_STATE_READY;
+    /* Release Lock */
+    __HAL_UNLOCK(hdcmi);
+    /* Return function status */
+    return HAL_ERROR;
+  }
+
+  /* Enable Capture */
+  hdcmi->Instance->CR |= DCMI_CR_CAPTURE;
+
+  /* Release Lock */
+  __HAL_UNLOCK(hdcmi);
+
+  /* Return function status */
+  return HAL_OK;
+}
+
 /**
   * @brief  Disable DCMI DMA request and Disable DCMI capture
   * @param  hdcmi pointer to a DCMI_HandleTypeDef structure that contains
@@ -748,6 +882,24 @@ __weak void HAL_DCMI_FrameEventCallback(DCMI_HandleTypeDef *hdcmi)
    */
 }
 
+/**
+  * @brief  Line Buffer Complete callback.
+  * @param  hdcmi pointer to a DCMI_HandleTypeDef structure that contains
+  *                the configuration information for DCMI.
+  * @note   The completed buffer is given by the CompletedBuffer and CompletedLine
+  *         fields of the DCMI_LineStreamTypeDef structure.
+  * @retval None
+  */
+__weak void HAL_DCMI_LineBufferCpltCallback(DCMI_HandleTypeDef *hdcmi)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hdcmi);
+
+  /* NOTE : This function Should not be modified, when the callback is needed,
+            the HAL_DCMI_LineBufferCpltCallback could be implemented in the user file
+   */
+}
+
 /**
   * @}
   */
@@ -763,6 +915,7 @@ __weak void HAL_DCMI_FrameEventCallback(DCMI_HandleTypeDef *hdcmi)
       (+) Configure the CROP feature.
       (+) Enable/Disable the CROP feature.
       (+) Set embedded synchronization delimiters unmasks.
+      (+) Configure the pixel and line decimation.
 
 @endverbatim
   * @{
@@ -857,6 +1010,66 @@ HAL_StatusTypeDef HAL_DCMI_EnableCrop(DCMI_HandleTypeDef *hdcmi)
   return HAL_OK;
 }
 
+/**
+  * @brief  Configure the DCMI pixel and line decimation.
+  * @param  hdcmi pointer to a DCMI_HandleTypeDef structure that contains
+  *                the configuration information for DCMI.
+  * @param  ByteSelectMode  Data captured by the interface.
+  *                         This parameter can be a value of @ref DCMI_Byte_Select_Mode
+  * @param  ByteSelectStart First data captured, odd or even.
+  *                         This parameter can be a value of @ref DCMI_Byte_Select_Start
+  * @param  LineSelectMode  Lines captured by the interface.
+  *                         This parameter can be a value of @ref DCMI_Line_Select_Mode
+  * @param  LineSelectStart First line captured, odd or even.
+  *                         This parameter can be a value of @ref DCMI_Line_Select_Start
+  * @note   The byte select mode is only applied when the data width is 8 bits.
+  * @note   This function must be called while the capture is stopped.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DCMI_ConfigDecimation(DCMI_HandleTypeDef *hdcmi, uint32_t ByteSelectMode, uint32_t ByteSelectStart,
+                                            uint32_t LineSelectMode, uint32_t LineSelectStart)
+{
+  /* Check the parameters */
+  assert_param(IS_DCMI_BYTE_SELECT_MODE(ByteSelectMode));
+  assert_param(IS_DCMI_BYTE_SELECT_START(ByteSelectStart));
+  assert_param(IS_DCMI_LINE_SELECT_MODE(LineSelectMode));
+  assert_param(IS_DCMI_LINE_SELECT_START(LineSelectStart));
+
+  /* Process Locked */
+  __HAL_LOCK(hdcmi);
+
+  if ((hdcmi->Instance->CR & DCMI_CR_CAPTURE) != 0U)
+  {
+    /* Process Unlocked */
+    __HAL_UNLOCK(hdcmi);
+
+    return HAL_BUSY;
+  }
+
+  /* Lock the DCMI peripheral state */
+  hdcmi->State = HAL_DCMI_STATE_BUSY;
+
+  /* Byte select mode must be kept to its reset value if the extended mode
+  is not set to 8-bit data capture on every pixel clock */
+  hdcmi->Init.ByteSelectMode = (hdcmi->Init.ExtendedDataMode != DCMI_EXTEND_DATA_8B) ? DCMI_BSM_ALL : ByteSelectMode;
+  hdcmi->Init.ByteSelectStart = ByteSelectStart;
+  hdcmi->Init.LineSelectMode = LineSelectMode;
+  hdcmi->Init.LineSelectStart = LineSelectStart;
+
+  /* Configure the decimation */
+  hdcmi->Instance->CR &= ~(DCMI_CR_BSM_0 | DCMI_CR_BSM_1 | DCMI_CR_OEBS | DCMI_CR_LSM | DCMI_CR_OELS);
+  hdcmi->Instance->CR |= (hdcmi->Init.ByteSelectMode | hdcmi->Init.ByteSelectStart | \
+                          hdcmi->Init.LineSelectMode | hdcmi->Init.LineSelectStart);
+
+  /* Change the DCMI state*/
+  hdcmi->State = HAL_DCMI_STATE_READY;
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(hdcmi);
+
+  return HAL_OK;
+}
+
 /**
   * @brief  Set embedded synchronization delimiters unmasks.
   * @param  hdcmi pointer to a DCMI_HandleTypeDef structure that contains
@@ -941,6 +1154,7 @@ uint32_t HAL_DCMI_GetError(DCMI_HandleTypeDef *hdcmi)
   *          @arg @ref HAL_DCMI_FRAME_EVENT_CB_ID Frame Event callback ID
   *          @arg @ref HAL_DCMI_VSYNC_EVENT_CB_ID Vsync Event callback ID
   *          @arg @ref HAL_DCMI_ERROR_CB_ID Error callback ID
+  *          @arg @ref HAL_DCMI_LINE_BUFFER_CPLT_CB_ID Line Buffer Complete callback ID
   *          @arg @ref HAL_DCMI_MSPINIT_CB_ID MspInit callback ID
   *          @arg @ref HAL_DCMI_MSPDEINIT_CB_ID MspDeInit callback ID
   * @param  pCallback pointer to the Callback function
@@ -979,6 +1193,10 @@ HAL_StatusTypeDef HAL_DCMI_RegisterCallback(DCMI_HandleTypeDef *hdcmi, HAL_DCMI_
           hdcmi->ErrorCallback = pCallback;
           break;
 
+        case HAL_DCMI_LINE_BUFFER_CPLT_CB_ID :
+          hdcmi->LineBufferCpltCallback = pCallback;
+          break;
+
         case HAL_DCMI_MSPINIT_CB_ID :
           hdcmi->MspInitCallback = pCallback;
           break;
@@ -1035,6 +1253,7 @@ HAL_StatusTypeDef HAL_DCMI_RegisterCallback(DCMI_HandleTypeDef *hdcmi, HAL_DCMI_
   *          @arg @ref HAL_DCMI_FRAME_EVENT_CB_ID Frame Event callback ID
   *          @arg @ref HAL_DCMI_VSYNC_EVENT_CB_ID Vsync Event callback ID
   *          @arg @ref HAL_DCMI_ERROR_CB_ID Error callback ID
+  *          @arg @ref HAL_DCMI_LINE_BUFFER_CPLT_CB_ID Line Buffer Complete callback ID
   *          @arg @ref HAL_DCMI_MSPINIT_CB_ID MspInit callback ID
   *          @arg @ref HAL_DCMI_MSPDEINIT_CB_ID MspDeInit callback ID
   * @retval HAL status
@@ -1063,6 +1282,10 @@ HAL_StatusTypeDef HAL_DCMI_UnRegisterCallback(DCMI_HandleTypeDef *hdcmi, HAL_DCM
         hdcmi->ErrorCallback = HAL_DCMI_ErrorCallback;           /* Legacy weak ErrorCallback        */
         break;
 
+      case HAL_DCMI_LINE_BUFFER_CPLT_CB_ID :
+        hdcmi->LineBufferCpltCallback = HAL_DCMI_LineBufferCpltCallback; /* Legacy weak LineBufferCpltCallback */
+        break;
+
       case HAL_DCMI_MSPINIT_CB_ID :
         hdcmi->MspInitCallback = HAL_DCMI_MspInit;
         break;
@@ -1187,6 +1410,124 @@ static void DCMI_DMAXferCplt(DMA_HandleTypeDef *hdma)
   }
 }
 
+/**
+  * @brief  DMA line buffer complete callback.
+  * @param  hdma pointer to a DMA_HandleTypeDef structure that contains
+  *                the configuration information for the specified DMA module.
+  * @retval None
+  */
+static void DCMI_DMALineXferCplt(DMA_HandleTypeDef *hdma)
+{
+  DCMI_HandleTypeDef *hdcmi = (DCMI_HandleTypeDef *)((DMA_HandleTypeDef *)hdma)->Parent;
+  DCMI_LineStreamTypeDef *pstream = hdcmi->pLineStream;
+  uint32_t buffer_size = pstream->LineSize * pstream->LinesPerBuffer;
+  uint32_t reload_buffer;
+  uint32_t frame_end;
+
+  /* The completed buffer is reloaded with the buffer following the one being filled */
+  pstream->CompletedBuffer = pstream->NextBuffer;
+  pstream->CompletedLine = pstream->NextLine;
+  pstream->NextBuffer = (pstream->NextBuffer + 1U) % pstream->NbBuffers;
+  pstream->NextLine = pstream->NextLine + pstream->LinesPerBuffer;
+  reload_buffer = (pstream->NextBuffer + 1U) % pstream->NbBuffers;
+
+  /* Memory 0 is completed when the DMA is now filling memory 1 */
+  if ((((DMA_Stream_TypeDef *)(hdcmi->DMA_Handle->Instance))->CR & DMA_SxCR_CT) != 0U)
+  {
+    (void)HAL_DMAEx_ChangeMemory(hdcmi->DMA_Handle, pstream->pBuffer + (reload_buffer * buffer_size), MEMORY0);
+  }
+  else
+  {
+    (void)HAL_DMAEx_ChangeMemory(hdcmi->DMA_Handle, pstream->pBuffer + (reload_buffer * buffer_size), MEMORY1);
+  }
+
+  /* Check if the frame is transferred */
+  frame_end = (pstream->NextLine >= pstream->FrameLines) ? 1U : 0U;
+  if (frame_end != 0U)
+  {
+    pstream->NextLine = 0U;
+    pstream->FrameCount++;
+
+    /* Enable the Frame interrupt */
+    __HAL_DCMI_ENABLE_IT(hdcmi, DCMI_IT_FRAME);
+
+    /* When snapshot mode, stop the DMA and set dcmi state to ready */
+    if ((hdcmi->Instance->CR & DCMI_CR_CM) == DCMI_MODE_SNAPSHOT)
+    {
+      (void)HAL_DMA_Abort_IT(hdcmi->DMA_Handle);
+      hdcmi->State = HAL_DCMI_STATE_READY;
+    }
+  }
+
+#if defined(HAL_MDMA_MODULE_ENABLED)
+  if (pstream->hmdma != NULL)
+  {
+    /* Move the completed buffer to its lines in the destination frame */
+    if (HAL_MDMA_Start_IT(pstream->hmdma, pstream->pBuffer + (pstream->CompletedBuffer * buffer_size),
+                          pstream->DstAddress + (pstream->CompletedLine * pstream->LineSize), buffer_size, 1U) != HAL_OK)
+    {
+      DCMI_MDMAError(pstream->hmdma);
+    }
+    return;
+  }
+#endif /* HAL_MDMA_MODULE_ENABLED */
+
+  DCMI_LineBufferCplt(hdcmi);
+}
+
+/**
+  * @brief  Call the line buffer complete callback.
+  * @param  hdcmi pointer to a DCMI_HandleTypeDef structure that contains
+  *                the configuration information for DCMI.
+  * @retval None
+  */
+static void DCMI_LineBufferCplt(DCMI_HandleTypeDef *hdcmi)
+{
+#if (USE_HAL_DCMI_REGISTER_CALLBACKS == 1)
+  /*Call registered DCMI line buffer complete callback*/
+  hdcmi->LineBufferCpltCallback(hdcmi);
+#else
+  HAL_DCMI_LineBufferCpltCallback(hdcmi);
+#endif /* USE_HAL_DCMI_REGISTER_CALLBACKS */
+}
+
+#if defined(HAL_MDMA_MODULE_ENABLED)
+/**
+  * @brief  MDMA line buffer transfer complete callback.
+  * @param  hmdma pointer to a MDMA_HandleTypeDef structure that contains
+  *                the configuration information for the specified MDMA channel.
+  * @retval None
+  */
+static void DCMI_MDMALineXferCplt(MDMA_HandleTypeDef *hmdma)
+{
+  DCMI_HandleTypeDef *hdcmi = (DCMI_HandleTypeDef *)hmdma->Parent;
+
+  DCMI_LineBufferCplt(hdcmi);
+}
+
+/**
+  * @brief  MDMA line buffer transfer error callback.
+  * @param  hmdma pointer to a MDMA_HandleTypeDef structure that contains
+  *                the configuration information for the specified MDMA channel.
+  * @retval None
+  */
+static void DCMI_MDMAError(MDMA_HandleTypeDef *hmdma)
+{
+  DCMI_HandleTypeDef *hdcmi = (DCMI_HandleTypeDef *)hmdma->Parent;
+
+  /* Set DCMI Error Code */
+  hdcmi->ErrorCode |= HAL_DCMI_ERROR_DMA;
+
+  /* DCMI error Callback */
+#if (USE_HAL_DCMI_REGISTER_CALLBACKS == 1)
+  /*Call registered DCMI error callback*/
+  hdcmi->ErrorCallback(hdcmi);
+#else
+  HAL_DCMI_ErrorCallback(hdcmi);
+#endif /* USE_HAL_DCMI_REGISTER_CALLBACKS */
+}
+#endif /* HAL_MDMA_MODULE_ENABLED */
+
 /**
   * @brief  DMA error callback
   * @param  hdma pointer to a DMA_HandleTypeDef structure that contains
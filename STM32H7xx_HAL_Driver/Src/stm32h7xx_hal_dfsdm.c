@@ -15,6 +15,7 @@
   *           + Extremes detector feature
   *           + Clock absence detector feature
   *           + Break generation on analog watchdog or short-circuit event
+  *           + Synchronised PDM microphone array capture
   *
   ******************************************************************************
   * @attention
@@ -166,6 +167,35 @@
     [..]
       (#) Get conversion time value using HAL_DFSDM_FilterGetConvTimeValue().
 
+    *** Microphone array capture ***
+    ================================
+    [..]
+      (#) Declare one channel handle and one filter handle per microphone, with
+          the instance set, and link them to a DFSDM_MicArray_HandleTypeDef.
+          The first filter handle must be DFSDM_FLT0 and all the filters must belong
+          to the same DFSDM.
+      (#) Link a DMA handle to each filter handle (hdmaReg) in HAL_DFSDM_FilterMspInit().
+          The DMA must be in circular mode, with word memory data size for
+          DFSDM_MICARRAY_DATA_24BIT or half-word for DFSDM_MICARRAY_DATA_16BIT.
+          Give the DMA of the last filter the lowest priority: it reports the frames
+          of all the microphones.
+      (#) Fill the number of microphones, the clock source and frequency, the PCM
+          sample rate, the gain and the data size, then call HAL_DFSDM_MicArrayInit().
+          The microphone clock divider and the Sinc5 oversampling ratio are computed
+          and all the channels and filters are initialized: regular conversion in
+          fast continuous mode, filters 1 and above synchronous with DFSDM_FLT0.
+      (#) Start the capture using HAL_DFSDM_MicArrayStart_DMA(). The buffer holds one
+          block of FrameCount samples per microphone. As all the filters start on the
+          same DFSDM_FLT0 conversion start, the sample n of each block is taken at the
+          same time.
+      (#) HAL_DFSDM_MicArrayHalfCpltCallback() and HAL_DFSDM_MicArrayCpltCallback() are
+          called when the first and the second half of the blocks are filled.
+          HAL_DFSDM_FilterRegConvHalfCpltCallback() and HAL_DFSDM_FilterRegConvCpltCallback()
+          are not called for the filters of the array.
+      (#) Use HAL_DFSDM_MicArrayGetFrames() to copy a half of the blocks into interleaved
+          frames (one sample per microphone), with the channel bits removed.
+      (#) Stop the capture using HAL_DFSDM_MicArrayStop_DMA().
+
     *** Callback registration ***
     =============================
     [..]
@@ -290,6 +320,13 @@
 #if defined(DFSDM2_Channel0)
 #define DFSDM2_CHANNEL_NUMBER           2U
 #endif /* DFSDM2_Channel0 */
+#if !defined(DFSDM_MICARRAY_PDM_CLOCK_MAX)
+#define DFSDM_MICARRAY_PDM_CLOCK_MAX    3300000U  /* Maximum microphone clock frequency in Hz */
+#endif /* DFSDM_MICARRAY_PDM_CLOCK_MAX */
+#define DFSDM_MICARRAY_FOSR_MIN         16U       /* Minimum oversampling ratio of the Sinc5 filter  */
+#define DFSDM_MICARRAY_FOSR_MAX         73U       /* FOSR^5 must fit the 32-bit filter output        */
+#define DFSDM_MICARRAY_DATA_BITS        23U       /* Magnitude bits of the 24-bit signed data        */
+#define DFSDM_MICARRAY_CHANNEL_MASK     0x000000FFU
 /**
   * @}
   */
@@ -305,6 +342,7 @@ static DFSDM_Channel_HandleTypeDef *a_dfsdm1ChannelHandle[DFSDM1_CHANNEL_NUMBER]
 static __IO uint32_t                v_dfsdm2ChannelCounter = 0;
 static DFSDM_Channel_HandleTypeDef *a_dfsdm2ChannelHandle[DFSDM2_CHANNEL_NUMBER] = {NULL};
 #endif /* DFSDM2_Channel0 */
+static DFSDM_MicArray_HandleTypeDef *p_dfsdmMicArray = NULL;
 /**
   * @}
   */
@@ -324,6 +362,7 @@ static void     DFSDM_DMARegularConvCplt(DMA_HandleTypeDef *hdma);
 static void     DFSDM_DMAInjectedHalfConvCplt(DMA_HandleTypeDef *hdma);
 static void     DFSDM_DMAInjectedConvCplt(DMA_HandleTypeDef *hdma);
 static void     DFSDM_DMAError(DMA_HandleTypeDef *hdma);
+static uint32_t DFSDM_MicArrayIsLastFilter(const DFSDM_Filter_HandleTypeDef *hdfsdm_filter);
 /**
   * @}
   */
@@ -3429,6 +3468,370 @@ uint32_t HAL_DFSDM_FilterGetError(const DFSDM_Filter_HandleTypeDef *hdfsdm_filte
   return hdfsdm_filter->ErrorCode;
 }
 
+/**
+  * @}
+  */
+
+/** @defgroup DFSDM_Exported_Functions_Group1_MicArray Microphone array functions
+ *  @brief    Microphone array functions
+ *
+@verbatim
+  ==============================================================================
+                     ##### Microphone array functions #####
+  ==============================================================================
+    [..]  This section provides functions allowing to:
+      (+) Initialize the channels and filters of a PDM microphone array.
+      (+) Start and stop the synchronised capture of all the microphones in DMA mode.
+      (+) Get interleaved frames from the capture buffer.
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Initialize the channels and filters of a PDM microphone array.
+  * @note   The microphone clock is the highest divided output clock not above
+  *         DFSDM_MICARRAY_PDM_CLOCK_MAX which is an exact multiple of the sample
+  *         rate with an oversampling ratio from 16 to 73.
+  * @note   Only one microphone array can be initialized at a time.
+  * @param  hdfsdm_micarray DFSDM microphone array handle.
+  * @retval HAL status.
+  */
+HAL_StatusTypeDef HAL_DFSDM_MicArrayInit(DFSDM_MicArray_HandleTypeDef *hdfsdm_micarray)
+{
+  uint32_t divider;
+  uint32_t pdmclock = 0U;
+  uint32_t fosr = 0U;
+  uint32_t shift = 0U;
+  uint32_t channel;
+  uint32_t i;
+  uint64_t fullscale;
+
+  /* Check DFSDM microphone array handle */
+  if((hdfsdm_micarray == NULL) || (p_dfsdmMicArray != NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check parameters */
+  assert_param(IS_DFSDM_MICARRAY_MIC_NUMBER(hdfsdm_micarray->Init.MicNumber));
+  assert_param(IS_DFSDM_CHANNEL_OUTPUT_CLOCK(hdfsdm_micarray->Init.ClockSelection));
+  assert_param(IS_DFSDM_MICARRAY_DATA_SIZE(hdfsdm_micarray->Init.DataSize));
+
+  if((hdfsdm_micarray->Init.MicNumber == 0U) || (hdfsdm_micarray->Init.MicNumber > DFSDM_MICARRAY_MAX_MIC) ||
+     (hdfsdm_micarray->Init.SampleRate == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  /* The first filter starts the conversions of all the others */
+#if defined(DFSDM2_Channel0)
+  if((hdfsdm_micarray->hfilter[0]->Instance != DFSDM1_Filter0) &&
+     (hdfsdm_micarray->hfilter[0]->Instance != DFSDM2_Filter0))
+#else
+  if(hdfsdm_micarray->hfilter[0]->Instance != DFSDM1_Filter0)
+#endif /* DFSDM2_Channel0 */
+  {
+    return HAL_ERROR;
+  }
+
+  /* Search the lowest divider, thus the highest oversampling ratio */
+  for(divider = 2U; divider <= 256U; divider++)
+  {
+    pdmclock = hdfsdm_micarray->Init.ClockFrequency / divider;
+    if(((hdfsdm_micarray->Init.ClockFrequency % divider) == 0U) && (pdmclock <= DFSDM_MICARRAY_PDM_CLOCK_MAX) &&
+       ((pdmclock % hdfsdm_micarray->Init.SampleRate) == 0U))
+    {
+      fosr = pdmclock / hdfsdm_micarray->Init.SampleRate;
+      if(fosr <= DFSDM_MICARRAY_FOSR_MAX)
+      {
+        break;
+      }
+    }
+  }
+  if((divider > 256U) || (fosr < DFSDM_MICARRAY_FOSR_MIN))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Right bit shift bringing the Sinc5 full scale (FOSR^5) to the 24-bit full scale */
+  fullscale = (uint64_t)fosr * fosr * fosr * fosr * fosr;
+  while((fullscale >> shift) > (1ULL << DFSDM_MICARRAY_DATA_BITS))
+  {
+    shift++;
+  }
+  if(hdfsdm_micarray->Init.Gain > shift)
+  {
+    return HAL_ERROR;
+  }
+  shift -= hdfsdm_micarray->Init.Gain;
+
+  /* Initialize the channels, all sharing the same output clock */
+  for(i = 0U; i < hdfsdm_micarray->Init.MicNumber; i++)
+  {
+    assert_param(IS_DFSDM_CHANNEL_INPUT_PINS(hdfsdm_micarray->Init.Pins[i]));
+    assert_param(IS_DFSDM_MICARRAY_SERIAL_INTERFACE(hdfsdm_micarray->Init.SerialInterface[i]));
+
+    hdfsdm_micarray->hchannel[i]->Init.OutputClock.Activation   = ENABLE;
+    hdfsdm_micarray->hchannel[i]->Init.OutputClock.Selection    = hdfsdm_micarray->Init.ClockSelection;
+    hdfsdm_micarray->hchannel[i]->Init.OutputClock.Divider      = divider;
+    hdfsdm_micarray->hchannel[i]->Init.Input.Multiplexer        = DFSDM_CHANNEL_EXTERNAL_INPUTS;
+    hdfsdm_micarray->hchannel[i]->Init.Input.DataPacking        = DFSDM_CHANNEL_STANDARD_MODE;
+    hdfsdm_micarray->hchannel[i]->Init.Input.Pins               = hdfsdm_micarray->Init.Pins[i];
+    hdfsdm_micarray->hchannel[i]->Init.SerialInterface.Type     = hdfsdm_micarray->Init.SerialInterface[i];
+    hdfsdm_micarray->hchannel[i]->Init.SerialInterface.SpiClock = DFSDM_CHANNEL_SPI_CLOCK_INTERNAL;
+    hdfsdm_micarray->hchannel[i]->Init.Awd.FilterOrder          = DFSDM_CHANNEL_FASTSINC_ORDER;
+    hdfsdm_micarray->hchannel[i]->Init.Awd.Oversampling         = 1U;
+    hdfsdm_micarray->hchannel[i]->Init.Offset                   = 0;
+    hdfsdm_micarray->hchannel[i]->Init.RightBitShift            = shift;
+
+    if(HAL_DFSDM_ChannelInit(hdfsdm_micarray->hchannel[i]) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  /* Initialize the filters, one regular channel each */
+  for(i = 0U; i < hdfsdm_micarray->Init.MicNumber; i++)
+  {
+    hdfsdm_micarray->hfilter[i]->Init.RegularParam.Trigger         = (i == 0U) ? DFSDM_FILTER_SW_TRIGGER :
+                                                                                 DFSDM_FILTER_SYNC_TRIGGER;
+    hdfsdm_micarray->hfilter[i]->Init.RegularParam.FastMode        = ENABLE;
+    hdfsdm_micarray->hfilter[i]->Init.RegularParam.DmaMode         = ENABLE;
+    hdfsdm_micarray->hfilter[i]->Init.InjectedParam.Trigger        = DFSDM_FILTER_SW_TRIGGER;
+    hdfsdm_micarray->hfilter[i]->Init.InjectedParam.ScanMode       = DISABLE;
+    hdfsdm_micarray->hfilter[i]->Init.InjectedParam.DmaMode        = DISABLE;
+    hdfsdm_micarray->hfilter[i]->Init.InjectedParam.ExtTrigger     = DFSDM_FILTER_EXT_TRIG_TIM1_TRGO;
+    hdfsdm_micarray->hfilter[i]->Init.InjectedParam.ExtTriggerEdge = DFSDM_FILTER_EXT_TRIG_RISING_EDGE;
+    hdfsdm_micarray->hfilter[i]->Init.FilterParam.SincOrder        = DFSDM_FILTER_SINC5_ORDER;
+    hdfsdm_micarray->hfilter[i]->Init.FilterParam.Oversampling     = fosr;
+    hdfsdm_micarray->hfilter[i]->Init.FilterParam.IntOversampling  = 1U;
+
+    if(HAL_DFSDM_FilterInit(hdfsdm_micarray->hfilter[i]) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+
+    channel = DFSDM_GetChannelFromInstance(hdfsdm_micarray->hchannel[i]->Instance);
+    if(HAL_DFSDM_FilterConfigRegChannel(hdfsdm_micarray->hfilter[i], (channel << 16U) | (1UL << channel),
+                                        DFSDM_CONTINUOUS_CONV_ON) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  hdfsdm_micarray->PdmClock     = pdmclock;
+  hdfsdm_micarray->Oversampling = fosr;
+  hdfsdm_micarray->pBuffer      = NULL;
+  hdfsdm_micarray->FrameCount   = 0U;
+
+  p_dfsdmMicArray = hdfsdm_micarray;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  De-initialize the channels and filters of a PDM microphone array.
+  * @param  hdfsdm_micarray DFSDM microphone array handle.
+  * @retval HAL status.
+  */
+HAL_StatusTypeDef HAL_DFSDM_MicArrayDeInit(DFSDM_MicArray_HandleTypeDef *hdfsdm_micarray)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+  uint32_t i;
+
+  /* Check DFSDM microphone array handle */
+  if((hdfsdm_micarray == NULL) || (p_dfsdmMicArray != hdfsdm_micarray))
+  {
+    return HAL_ERROR;
+  }
+
+  for(i = 0U; i < hdfsdm_micarray->Init.MicNumber; i++)
+  {
+    if(HAL_DFSDM_FilterDeInit(hdfsdm_micarray->hfilter[i]) != HAL_OK)
+    {
+      status = HAL_ERROR;
+    }
+    if(HAL_DFSDM_ChannelDeInit(hdfsdm_micarray->hchannel[i]) != HAL_OK)
+    {
+      status = HAL_ERROR;
+    }
+  }
+
+  p_dfsdmMicArray = NULL;
+
+  return status;
+}
+
+/**
+  * @brief  Start the synchronised capture of all the microphones in DMA mode.
+  * @note   The sample n of microphone m is at item (m * FrameCount) + n of the buffer.
+  *         Items are int32_t for DFSDM_MICARRAY_DATA_24BIT, with the channel
+  *         number on the 8 least significant bits, or int16_t for DFSDM_MICARRAY_DATA_16BIT.
+  * @param  hdfsdm_micarray DFSDM microphone array handle.
+  * @param  pBuffer Capture buffer of MicNumber * FrameCount items.
+  * @param  FrameCount Number of samples per microphone, must be even.
+  * @retval HAL status.
+  */
+HAL_StatusTypeDef HAL_DFSDM_MicArrayStart_DMA(DFSDM_MicArray_HandleTypeDef *hdfsdm_micarray, void *pBuffer,
+                                              uint32_t FrameCount)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+  uint32_t itemsize;
+  uint32_t i;
+
+  /* Check parameters */
+  if((hdfsdm_micarray != p_dfsdmMicArray) || (pBuffer == NULL) || (FrameCount == 0U) || ((FrameCount & 1U) != 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  itemsize = (hdfsdm_micarray->Init.DataSize == DFSDM_MICARRAY_DATA_16BIT) ? 2U : 4U;
+  hdfsdm_micarray->pBuffer    = (uint8_t *)pBuffer;
+  hdfsdm_micarray->FrameCount = FrameCount;
+
+  /* Start DFSDM_FLT0 last: the other filters wait for its conversion start */
+  i = hdfsdm_micarray->Init.MicNumber;
+  while((i > 0U) && (status == HAL_OK))
+  {
+    i--;
+    if(hdfsdm_micarray->Init.DataSize == DFSDM_MICARRAY_DATA_16BIT)
+    {
+      status = HAL_DFSDM_FilterRegularMsbStart_DMA(hdfsdm_micarray->hfilter[i],
+                                                   (int16_t *)&hdfsdm_micarray->pBuffer[i * FrameCount * itemsize],
+                                                   FrameCount);
+    }
+    else
+    {
+      status = HAL_DFSDM_FilterRegularStart_DMA(hdfsdm_micarray->hfilter[i],
+                                                (int32_t *)&hdfsdm_micarray->pBuffer[i * FrameCount * itemsize],
+                                                FrameCount);
+    }
+  }
+
+  /* Stop the filters already started */
+  if(status != HAL_OK)
+  {
+    for(i++; i < hdfsdm_micarray->Init.MicNumber; i++)
+    {
+      (void)HAL_DFSDM_FilterRegularStop_DMA(hdfsdm_micarray->hfilter[i]);
+    }
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Stop the capture of all the microphones in DMA mode.
+  * @param  hdfsdm_micarray DFSDM microphone array handle.
+  * @retval HAL status.
+  */
+HAL_StatusTypeDef HAL_DFSDM_MicArrayStop_DMA(DFSDM_MicArray_HandleTypeDef *hdfsdm_micarray)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+  uint32_t i;
+
+  if(hdfsdm_micarray != p_dfsdmMicArray)
+  {
+    return HAL_ERROR;
+  }
+
+  for(i = 0U; i < hdfsdm_micarray->Init.MicNumber; i++)
+  {
+    if(HAL_DFSDM_FilterRegularStop_DMA(hdfsdm_micarray->hfilter[i]) != HAL_OK)
+    {
+      status = HAL_ERROR;
+    }
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Copy a half of the capture buffer into interleaved frames.
+  * @note   Frame n holds the sample n of each microphone, in the microphone order.
+  *         For DFSDM_MICARRAY_DATA_24BIT the channel number is removed from the
+  *         8 least significant bits.
+  * @param  hdfsdm_micarray DFSDM microphone array handle.
+  * @param  HalfIndex Half of the buffer to copy, 0 for the first half, 1 for the second.
+  * @param  pFrames Destination of FrameCount / 2 frames of MicNumber items.
+  * @retval HAL status.
+  */
+HAL_StatusTypeDef HAL_DFSDM_MicArrayGetFrames(const DFSDM_MicArray_HandleTypeDef *hdfsdm_micarray,
+                                              uint32_t HalfIndex, void *pFrames)
+{
+  uint32_t half = hdfsdm_micarray->FrameCount / 2U;
+  uint32_t mics = hdfsdm_micarray->Init.MicNumber;
+  uint32_t first = (HalfIndex != 0U) ? half : 0U;
+  uint32_t m;
+  uint32_t n;
+
+  if((hdfsdm_micarray->pBuffer == NULL) || (pFrames == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  if(hdfsdm_micarray->Init.DataSize == DFSDM_MICARRAY_DATA_16BIT)
+  {
+    const int16_t *psrc = (const int16_t *)(const void *)hdfsdm_micarray->pBuffer;
+    int16_t *pdst = (int16_t *)pFrames;
+
+    for(m = 0U; m < mics; m++)
+    {
+      for(n = 0U; n < half; n++)
+      {
+        pdst[(n * mics) + m] = psrc[(m * hdfsdm_micarray->FrameCount) + first + n];
+      }
+    }
+  }
+  else
+  {
+    const uint32_t *psrc = (const uint32_t *)(const void *)hdfsdm_micarray->pBuffer;
+    uint32_t *pdst = (uint32_t *)pFrames;
+
+    for(m = 0U; m < mics; m++)
+    {
+      for(n = 0U; n < half; n++)
+      {
+        pdst[(n * mics) + m] = psrc[(m * hdfsdm_micarray->FrameCount) + first + n] & ~DFSDM_MICARRAY_CHANNEL_MASK;
+      }
+    }
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Half capture complete callback.
+  * @note   The first half of the block of each microphone is filled.
+  * @param  hdfsdm_micarray DFSDM microphone array handle.
+  * @retval None
+  */
+__weak void HAL_DFSDM_MicArrayHalfCpltCallback(DFSDM_MicArray_HandleTypeDef *hdfsdm_micarray)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hdfsdm_micarray);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_DFSDM_MicArrayHalfCpltCallback could be implemented in the user file.
+   */
+}
+
+/**
+  * @brief  Capture complete callback.
+  * @note   The second half of the block of each microphone is filled.
+  * @param  hdfsdm_micarray DFSDM microphone array handle.
+  * @retval None
+  */
+__weak void HAL_DFSDM_MicArrayCpltCallback(DFSDM_MicArray_HandleTypeDef *hdfsdm_micarray)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hdfsdm_micarray);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_DFSDM_MicArrayCpltCallback could be implemented in the user file.
+   */
+}
+
 /**
   * @}
   */
@@ -3453,12 +3856,20 @@ static void DFSDM_DMARegularHalfConvCplt(DMA_HandleTypeDef *hdma)
   /* Get DFSDM filter handle */
   DFSDM_Filter_HandleTypeDef *hdfsdm_filter = (DFSDM_Filter_HandleTypeDef*) ((DMA_HandleTypeDef*)hdma)->Parent;
 
-  /* Call regular half conversion complete callback */
+  /* The last filter of a microphone array reports the half buffer of all the filters */
+  if(DFSDM_MicArrayIsLastFilter(hdfsdm_filter) != 0U)
+  {
+    HAL_DFSDM_MicArrayHalfCpltCallback(p_dfsdmMicArray);
+  }
+  else
+  {
+    /* Call regular half conversion complete callback */
 #if (USE_HAL_DFSDM_REGISTER_CALLBACKS == 1)
-  hdfsdm_filter->RegConvHalfCpltCallback(hdfsdm_filter);
+    hdfsdm_filter->RegConvHalfCpltCallback(hdfsdm_filter);
 #else
-  HAL_DFSDM_FilterRegConvHalfCpltCallback(hdfsdm_filter);
+    HAL_DFSDM_FilterRegConvHalfCpltCallback(hdfsdm_filter);
 #endif
+  }
 }
 
 /**
@@ -3471,12 +3882,20 @@ static void DFSDM_DMARegularConvCplt(DMA_HandleTypeDef *hdma)
   /* Get DFSDM filter handle */
   DFSDM_Filter_HandleTypeDef *hdfsdm_filter = (DFSDM_Filter_HandleTypeDef*) ((DMA_HandleTypeDef*)hdma)->Parent;
 
-  /* Call regular conversion complete callback */
+  /* The last filter of a microphone array reports the buffer of all the filters */
+  if(DFSDM_MicArrayIsLastFilter(hdfsdm_filter) != 0U)
+  {
+    HAL_DFSDM_MicArrayCpltCallback(p_dfsdmMicArray);
+  }
+  else
+  {
+    /* Call regular conversion complete callback */
 #if (USE_HAL_DFSDM_REGISTER_CALLBACKS == 1)
-  hdfsdm_filter->RegConvCpltCallback(hdfsdm_filter);
+    hdfsdm_filter->RegConvCpltCallback(hdfsdm_filter);
 #else
-  HAL_DFSDM_FilterRegConvCpltCallback(hdfsdm_filter);
+    HAL_DFSDM_FilterRegConvCpltCallback(hdfsdm_filter);
 #endif
+  }
 }
 
 /**
@@ -3536,6 +3955,24 @@ static void DFSDM_DMAError(DMA_HandleTypeDef *hdma)
 #endif
 }
 
+/**
+  * @brief  This function allows to know if a filter is the last one of the microphone array.
+  * @note   The DMA transfers of the other filters of the array are done at the same time.
+  * @param  hdfsdm_filter DFSDM filter handle.
+  * @retval 1 if the filter is the last one of the microphone array, 0 otherwise.
+  */
+static uint32_t DFSDM_MicArrayIsLastFilter(const DFSDM_Filter_HandleTypeDef *hdfsdm_filter)
+{
+  uint32_t last = 0U;
+
+  if((p_dfsdmMicArray != NULL) && (p_dfsdmMicArray->pBuffer != NULL) &&
+     (p_dfsdmMicArray->hfilter[p_dfsdmMicArray->Init.MicNumber - 1U] == hdfsdm_filter))
+  {
+    last = 1U;
+  }
+  return last;
+}
+
 /**
   * @brief  This function allows to get the number of injected channels.
   * @param  Channels bitfield of injected channels.
@@ -51,6 +51,8 @@
           (+) Use HAL_DMA_Start_IT() to start DMA transfer after the configuration of
               Source address and destination address and the Length of data to be transferred. In this
               case the DMA interrupt is configured
+          (+) Use HAL_DMA_ReArm_IT() to restart a completed transfer with a new memory address and
+              Length of data, without the full reconfiguration done by HAL_DMA_Start_IT()
           (+) Use HAL_DMA_IRQHandler() called under DMA_IRQHandler() Interrupt subroutine
           (+) At the end of data transfer HAL_DMA_IRQHandler() function is executed and user can
               add his own function by customization of function pointer XferCpltCallback and
@@ -73,6 +75,15 @@
            and Destination. In this case the Peripheral Data Size will be applied to both Source
            and Destination.
 
+     *** DMA transfer statistics ***
+     ===============================
+     [..]
+       When USE_HAL_DMA_STATISTICS is set to 1U in the HAL configuration file, each handle
+       counts its transfers, moved bytes, errors and rejected start requests, and samples
+       DWT->CYCCNT at transfer start, interrupt entry and callback exit.
+      (+) HAL_DMA_GetStatistics(): get a pointer to the statistics of the handle
+      (+) HAL_DMA_ResetStatistics(): clear the counters and the maximum delays
+
      *** DMA HAL driver macros list ***
      =============================================
      [..]
@@ -168,6 +179,88 @@ typedef struct
   * @}
   */
 /* Private macros ------------------------------------------------------------*/
+#if defined(USE_HAL_DMA_STATISTICS) && (USE_HAL_DMA_STATISTICS == 1U)
+#define DMA_STATS_START(__HANDLE__, __LENGTH__)                                                               \
+  do{                                                                                                         \
+    (__HANDLE__)->Statistics.XferLength = (uint32_t)(__LENGTH__) <<                                           \
+                                          ((__HANDLE__)->Init.PeriphDataAlignment >> DMA_SxCR_PSIZE_Pos);    \
+    (__HANDLE__)->Statistics.StartCycle = DWT->CYCCNT;                                                        \
+  }while(0U)
+
+#define DMA_STATS_BUSY(__HANDLE__)      ((__HANDLE__)->Statistics.BusyCount++)
+
+#define DMA_STATS_IRQ_ENTRY(__HANDLE__) ((__HANDLE__)->Statistics.IrqEntryCycle = DWT->CYCCNT)
+
+/* In circular and double buffer modes the next lap starts with the interrupt */
+#define DMA_STATS_XFER_CPLT(__HANDLE__)                                                                       \
+  do{                                                                                                         \
+    uint32_t xfercycles = (__HANDLE__)->Statistics.IrqEntryCycle - (__HANDLE__)->Statistics.StartCycle;       \
+    (__HANDLE__)->Statistics.XferCount++;                                                                     \
+    (__HANDLE__)->Statistics.XferBytes += (__HANDLE__)->Statistics.XferLength;                                \
+    if(xfercycles > (__HANDLE__)->Statistics.MaxXferCycles)                                                   \
+    {                                                                                                         \
+      (__HANDLE__)->Statistics.MaxXferCycles = xfercycles;                                                    \
+    }                                                                                                         \
+    (__HANDLE__)->Statistics.StartCycle = (__HANDLE__)->Statistics.IrqEntryCycle;                             \
+  }while(0U)
+
+#define DMA_STATS_ERROR(__HANDLE__)                                                                           \
+  do{                                                                                                         \
+    (__HANDLE__)->Statistics.ErrorCount++;                                                                    \
+    (__HANDLE__)->Statistics.ErrorFlags |= (__HANDLE__)->ErrorCode;                                           \
+  }while(0U)
+
+#define DMA_STATS_IRQ_EXIT(__HANDLE__)                                                                        \
+  do{                                                                                                         \
+    uint32_t irqcycles;                                                                                       \
+    (__HANDLE__)->Statistics.CallbackExitCycle = DWT->CYCCNT;                                                 \
+    irqcycles = (__HANDLE__)->Statistics.CallbackExitCycle - (__HANDLE__)->Statistics.IrqEntryCycle;          \
+    if(irqcycles > (__HANDLE__)->Statistics.MaxIrqCycles)                                                     \
+    {                                                                                                         \
+      (__HANDLE__)->Statistics.MaxIrqCycles = irqcycles;                                                      \
+    }                                                                                                         \
+  }while(0U)
+#else
+#define DMA_STATS_START(__HANDLE__, __LENGTH__)
+#define DMA_STATS_BUSY(__HANDLE__)
+#define DMA_STATS_IRQ_ENTRY(__HANDLE__)
+#define DMA_STATS_XFER_CPLT(__HANDLE__)
+#define DMA_STATS_ERROR(__HANDLE__)
+#define DMA_STATS_IRQ_EXIT(__HANDLE__)
+#endif /* USE_HAL_DMA_STATISTICS */
+
+#if defined(USE_HAL_DMA_CACHE_MAINTENANCE) && (USE_HAL_DMA_CACHE_MAINTENANCE == 1U)
+#define DMA_CACHE_START(__HANDLE__, __SRC__, __DST__, __LENGTH__)  DMA_CacheStart((__HANDLE__), (__SRC__), (__DST__), (__LENGTH__))
+
+/* With the half transfer interrupt, each half is invalidated before its callback */
+#define DMA_CACHE_HALF_CPLT(__HANDLE__)                                                                       \
+  do{                                                                                                         \
+    if((__HANDLE__)->CacheSize != 0U)                                                                         \
+    {                                                                                                         \
+      HAL_DMAEx_InvalidateBuffer((__HANDLE__)->CacheAddress, (__HANDLE__)->CacheSize / 2U);                   \
+    }                                                                                                         \
+  }while(0U)
+
+#define DMA_CACHE_XFER_CPLT(__HANDLE__)                                                                       \
+  do{                                                                                                         \
+    if((__HANDLE__)->CacheSize != 0U)                                                                         \
+    {                                                                                                         \
+      if((__HANDLE__)->XferHalfCpltCallback != NULL)                                                          \
+      {                                                                                                       \
+        HAL_DMAEx_InvalidateBuffer((__HANDLE__)->CacheAddress + ((__HANDLE__)->CacheSize / 2U),               \
+                                   (__HANDLE__)->CacheSize - ((__HANDLE__)->CacheSize / 2U));                 \
+      }                                                                                                       \
+      else                                                                                                    \
+      {                                                                                                       \
+        HAL_DMAEx_InvalidateBuffer((__HANDLE__)->CacheAddress, (__HANDLE__)->CacheSize);                      \
+      }                                                                                                       \
+    }                                                                                                         \
+  }while(0U)
+#else
+#define DMA_CACHE_START(__HANDLE__, __SRC__, __DST__, __LENGTH__)
+#define DMA_CACHE_HALF_CPLT(__HANDLE__)
+#define DMA_CACHE_XFER_CPLT(__HANDLE__)
+#endif /* USE_HAL_DMA_CACHE_MAINTENANCE */
 /* Private functions ---------------------------------------------------------*/
 /** @addtogroup DMA_Private_Functions
   * @{
@@ -177,6 +270,9 @@ static uint32_t DMA_CalcBaseAndBitshift(DMA_HandleTypeDef *hdma);
 static HAL_StatusTypeDef DMA_CheckFifoParam(DMA_HandleTypeDef *hdma);
 static void DMA_CalcDMAMUXChannelBaseAndMask(DMA_HandleTypeDef *hdma);
 static void DMA_CalcDMAMUXRequestGenBaseAndMask(DMA_HandleTypeDef *hdma);
+#if defined(USE_HAL_DMA_CACHE_MAINTENANCE) && (USE_HAL_DMA_CACHE_MAINTENANCE == 1U)
+static void DMA_CacheStart(DMA_HandleTypeDef *hdma, uint32_t SrcAddress, uint32_t DstAddress, uint32_t DataLength);
+#endif /* USE_HAL_DMA_CACHE_MAINTENANCE */
 
 /**
   * @}
@@ -649,9 +745,14 @@ HAL_StatusTypeDef HAL_DMA_Start(DMA_HandleTypeDef *hdma, uint32_t SrcAddress, ui
     /* Disable the peripheral */
     __HAL_DMA_DISABLE(hdma);
 
+    /* Maintain the D-cache on the memory buffers */
+    DMA_CACHE_START(hdma, SrcAddress, DstAddress, DataLength);
+
     /* Configure the source, destination address and the data length */
     DMA_SetConfig(hdma, SrcAddress, DstAddress, DataLength);
 
+    DMA_STATS_START(hdma, DataLength);
+
     /* Enable the Peripheral */
     __HAL_DMA_ENABLE(hdma);
   }
@@ -663,6 +764,9 @@ HAL_StatusTypeDef HAL_DMA_Start(DMA_HandleTypeDef *hdma, uint32_t SrcAddress, ui
     /* Process unlocked */
     __HAL_UNLOCK(hdma);
 
+    /* Account the rejected start request */
+    DMA_STATS_BUSY(hdma);
+
     /* Return error status */
     status = HAL_ERROR;
   }
@@ -705,9 +809,14 @@ HAL_StatusTypeDef HAL_DMA_Start_IT(DMA_HandleTypeDef *hdma, uint32_t SrcAddress,
     /* Disable the peripheral */
     __HAL_DMA_DISABLE(hdma);
 
+    /* Maintain the D-cache on the memory buffers */
+    DMA_CACHE_START(hdma, SrcAddress, DstAddress, DataLength);
+
     /* Configure the source, destination address and the data length */
     DMA_SetConfig(hdma, SrcAddress, DstAddress, DataLength);
 
+    DMA_STATS_START(hdma, DataLength);
+
     if(IS_DMA_STREAM_INSTANCE(hdma->Instance) != 0U) /* DMA1 or DMA2 instance */
     {
       /* Enable Common interrupts*/
@@ -759,6 +868,9 @@ HAL_StatusTypeDef HAL_DMA_Start_IT(DMA_HandleTypeDef *hdma, uint32_t SrcAddress,
     /* Process unlocked */
     __HAL_UNLOCK(hdma);
 
+    /* Account the rejected start request */
+    DMA_STATS_BUSY(hdma);
+
     /* Return error status */
     status = HAL_ERROR;
   }
@@ -766,6 +878,111 @@ HAL_StatusTypeDef HAL_DMA_Start_IT(DMA_HandleTypeDef *hdma, uint32_t SrcAddress,
   return status;
 }
 
+/**
+  * @brief  Re-arms the DMA Transfer with interrupt enabled, keeping the
+  *         configuration of the previous HAL_DMA_Start_IT() call.
+  * @note   Only the memory address and the data length are written: the peripheral
+  *         address, the direction and all the other stream settings must still be
+  *         valid. The previous transfer must be completed (DMA state ready), so
+  *         circular mode is not supported, neither is double buffer mode.
+  * @note   Cycle budget: besides the handle lock and state updates, 4 register
+  *         writes (DMAMUX and stream flag clear, M0AR, NDTR) and one
+  *         read-modify-write of CR for a DMA stream, plus one of FCR in FIFO mode,
+  *         one more read-modify-write of CCR for a BDMA channel, that is about 30
+  *         to 35 CPU cycles with zero wait state accesses.
+  * @param  hdma:       pointer to a DMA_HandleTypeDef structure that contains
+  *                     the configuration information for the specified DMA Stream.
+  * @param  MemAddress: The memory Buffer address
+  * @param  DataLength: The length of data to be transferred
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DMA_ReArm_IT(DMA_HandleTypeDef *hdma, uint32_t MemAddress, uint32_t DataLength)
+{
+  DMA_Base_Registers *regs_dma = (DMA_Base_Registers *)hdma->StreamBaseAddress;
+  BDMA_Base_Registers *regs_bdma = (BDMA_Base_Registers *)hdma->StreamBaseAddress;
+  uint32_t itflags;
+
+  /* Process locked */
+  __HAL_LOCK(hdma);
+
+  if(HAL_DMA_STATE_READY != hdma->State)
+  {
+    /* Set the error code to busy */
+    hdma->ErrorCode = HAL_DMA_ERROR_BUSY;
+
+    /* Process unlocked */
+    __HAL_UNLOCK(hdma);
+
+    /* Account the rejected start request */
+    DMA_STATS_BUSY(hdma);
+
+    /* Return error status */
+    return HAL_ERROR;
+  }
+
+  /* Change DMA peripheral state */
+  hdma->State = HAL_DMA_STATE_BUSY;
+
+  /* Initialize the error code */
+  hdma->ErrorCode = HAL_DMA_ERROR_NONE;
+
+  DMA_STATS_START(hdma, DataLength);
+
+  if(IS_DMA_DMAMUX_ALL_INSTANCE(hdma->Instance) != 0U) /* No DMAMUX available for BDMA1 */
+  {
+    /* Clear the DMAMUX synchro overrun flag */
+    hdma->DMAmuxChannelStatus->CFR = hdma->DMAmuxChannelStatusMask;
+  }
+
+  if(IS_DMA_STREAM_INSTANCE(hdma->Instance) != 0U) /* DMA1 or DMA2 instance */
+  {
+    /* Clear all interrupt flags at correct offset within the register */
+    regs_dma->IFCR = 0x3FUL << (hdma->StreamIndex & 0x1FU);
+
+    /* Configure DMA Stream memory address and data length */
+    ((DMA_Stream_TypeDef *)hdma->Instance)->M0AR = MemAddress;
+    ((DMA_Stream_TypeDef *)hdma->Instance)->NDTR = DataLength;
+
+    itflags = DMA_IT_TC | DMA_IT_TE | DMA_IT_DME;
+    if(hdma->XferHalfCpltCallback != NULL)
+    {
+      itflags |= DMA_IT_HT;
+    }
+
+    /* Enable the FIFO error interrupt, disabled if the previous transfer was aborted */
+    if(hdma->Init.FIFOMode != DMA_FIFOMODE_DISABLE)
+    {
+      ((DMA_Stream_TypeDef *)hdma->Instance)->FCR |= DMA_IT_FE;
+    }
+
+    /* Enable the interrupts disabled at the end of the previous transfer and the Peripheral */
+    MODIFY_REG(((DMA_Stream_TypeDef *)hdma->Instance)->CR, DMA_IT_HT, itflags | DMA_SxCR_EN);
+  }
+  else /* BDMA channel */
+  {
+    /* The channel stays enabled at the end of a transfer */
+    ((BDMA_Channel_TypeDef *)hdma->Instance)->CCR &= ~BDMA_CCR_EN;
+
+    /* Clear all flags */
+    regs_bdma->IFCR = (BDMA_ISR_GIF0) << (hdma->StreamIndex & 0x1FU);
+
+    /* Configure DMA Channel memory address and data length */
+    ((BDMA_Channel_TypeDef *)hdma->Instance)->CM0AR = MemAddress;
+    ((BDMA_Channel_TypeDef *)hdma->Instance)->CNDTR = DataLength;
+
+    itflags = BDMA_CCR_TCIE | BDMA_CCR_TEIE;
+    if(hdma->XferHalfCpltCallback != NULL)
+    {
+      itflags |= BDMA_CCR_HTIE;
+    }
+
+    /* Enable the interrupts disabled at the end of the previous transfer and the Peripheral */
+    MODIFY_REG(((BDMA_Channel_TypeDef *)hdma->Instance)->CCR, BDMA_CCR_HTIE, itflags | BDMA_CCR_EN);
+  }
+
+  return HAL_OK;
+}
+
 /**
   * @brief  Aborts the DMA Transfer.
   * @param  hdma  : pointer to a DMA_HandleTypeDef structure that contains
@@ -967,6 +1184,44 @@ HAL_StatusTypeDef HAL_DMA_Abort_IT(DMA_HandleTypeDef *hdma)
   return HAL_OK;
 }
 
+/**
+  * @brief  Aborts the DMA transfer started by HAL_DMA_Direct_Start().
+  * @note   A DMA stream is disabled and the function waits until the ongoing data
+  *         transfer is completed, a BDMA channel is disabled at once. No lock and no
+  *         handle state update are done.
+  * @param  hdma  pointer to a DMA_HandleTypeDef structure that contains
+  *               the configuration information for the specified DMA Stream.
+  * @retval HAL status, HAL_TIMEOUT if the stream is still enabled after
+  *         HAL_TIMEOUT_DMA_ABORT
+  */
+HAL_StatusTypeDef HAL_DMA_Direct_Abort(DMA_HandleTypeDef *hdma)
+{
+  uint32_t tickstart;
+
+  if(DMA_DIRECT_IS_STREAM(hdma->Instance) != 0U)
+  {
+    tickstart = HAL_GetTick();
+
+    ((DMA_Stream_TypeDef *)hdma->Instance)->CR &= ~DMA_SxCR_EN;
+
+    /* Check if the DMA Stream is effectively disabled */
+    while((((DMA_Stream_TypeDef *)hdma->Instance)->CR & DMA_SxCR_EN) != 0U)
+    {
+      /* Check for the Timeout */
+      if((HAL_GetTick() - tickstart) > HAL_TIMEOUT_DMA_ABORT)
+      {
+        return HAL_TIMEOUT;
+      }
+    }
+  }
+  else
+  {
+    ((BDMA_Channel_TypeDef *)hdma->Instance)->CCR &= ~BDMA_CCR_EN;
+  }
+
+  return HAL_OK;
+}
+
 /**
   * @brief  Polling for transfer complete.
   * @param  hdma:          pointer to a DMA_HandleTypeDef structure that contains
@@ -1205,7 +1460,7 @@ HAL_StatusTypeDef HAL_DMA_PollForTransfer(DMA_HandleTypeDef *hdma, HAL_DMA_Level
   *               the configuration information for the specified DMA Stream.
   * @retval None
   */
-void HAL_DMA_IRQHandler(DMA_HandleTypeDef *hdma)
+__HOT_RAM_FUNC void HAL_DMA_IRQHandler(DMA_HandleTypeDef *hdma)
 {
   uint32_t tmpisr_dma, tmpisr_bdma;
   uint32_t ccr_reg;
@@ -1219,6 +1474,8 @@ void HAL_DMA_IRQHandler(DMA_HandleTypeDef *hdma)
   tmpisr_dma  = regs_dma->ISR;
   tmpisr_bdma = regs_bdma->ISR;
 
+  DMA_STATS_IRQ_ENTRY(hdma);
+
   if(IS_DMA_STREAM_INSTANCE(hdma->Instance) != 0U)  /* DMA1 or DMA2 instance */
   {
     /* Transfer Error Interrupt management ***************************************/
@@ -1299,6 +1556,8 @@ void HAL_DMA_IRQHandler(DMA_HandleTypeDef *hdma)
             ((DMA_Stream_TypeDef   *)hdma->Instance)->CR  &= ~(DMA_IT_HT);
           }
 
+          DMA_CACHE_HALF_CPLT(hdma);
+
           if(hdma->XferHalfCpltCallback != NULL)
           {
             /* Half transfer callback */
@@ -1339,9 +1598,12 @@ void HAL_DMA_IRQHandler(DMA_HandleTypeDef *hdma)
           {
             hdma->XferAbortCallback(hdma);
           }
+          DMA_STATS_IRQ_EXIT(hdma);
           return;
         }
 
+        DMA_STATS_XFER_CPLT(hdma);
+
         if(((((DMA_Stream_TypeDef   *)hdma->Instance)->CR) & (uint32_t)(DMA_SxCR_DBM)) != 0U)
         {
           /* Current memory buffer used is Memory 0 */
@@ -1366,6 +1628,8 @@ void HAL_DMA_IRQHandler(DMA_HandleTypeDef *hdma)
         /* Disable the transfer complete interrupt if the DMA mode is not CIRCULAR */
         else
         {
+          DMA_CACHE_XFER_CPLT(hdma);
+
           if((((DMA_Stream_TypeDef   *)hdma->Instance)->CR & DMA_SxCR_CIRC) == 0U)
           {
             /* Disable the transfer complete interrupt */
@@ -1390,6 +1654,8 @@ void HAL_DMA_IRQHandler(DMA_HandleTypeDef *hdma)
     /* manage error case */
     if(hdma->ErrorCode != HAL_DMA_ERROR_NONE)
     {
+      DMA_STATS_ERROR(hdma);
+
       if((hdma->ErrorCode & HAL_DMA_ERROR_TE) != 0U)
       {
         hdma->State = HAL_DMA_STATE_ABORT;
@@ -1471,6 +1737,8 @@ void HAL_DMA_IRQHandler(DMA_HandleTypeDef *hdma)
         /* DMA peripheral state is not updated in Half Transfer */
         /* but in Transfer Complete case */
 
+        DMA_CACHE_HALF_CPLT(hdma);
+
        if(hdma->XferHalfCpltCallback != NULL)
         {
           /* Half transfer callback */
@@ -1485,6 +1753,8 @@ void HAL_DMA_IRQHandler(DMA_HandleTypeDef *hdma)
       /* Clear the transfer complete flag */
       regs_bdma->IFCR = (BDMA_ISR_TCIF0) << (hdma->StreamIndex & 0x1FU);
 
+      DMA_STATS_XFER_CPLT(hdma);
+
       /* Disable the transfer complete interrupt if the DMA mode is Double Buffering */
       if((ccr_reg & BDMA_CCR_DBM) != 0U)
       {
@@ -1509,6 +1779,8 @@ void HAL_DMA_IRQHandler(DMA_HandleTypeDef *hdma)
       }
       else
       {
+        DMA_CACHE_XFER_CPLT(hdma);
+
         if((ccr_reg & BDMA_CCR_CIRC) == 0U)
         {
           /* Disable the transfer complete and error interrupt, if the DMA mode is not CIRCULAR */
@@ -1542,6 +1814,8 @@ void HAL_DMA_IRQHandler(DMA_HandleTypeDef *hdma)
       /* Update error code */
       hdma->ErrorCode = HAL_DMA_ERROR_TE;
 
+      DMA_STATS_ERROR(hdma);
+
       /* Change the DMA state */
       hdma->State = HAL_DMA_STATE_READY;
 
@@ -1563,6 +1837,8 @@ void HAL_DMA_IRQHandler(DMA_HandleTypeDef *hdma)
   {
     /* Nothing To Do */
   }
+
+  DMA_STATS_IRQ_EXIT(hdma);
 }
 
 /**
@@ -1749,6 +2025,42 @@ uint32_t HAL_DMA_GetError(DMA_HandleTypeDef *hdma)
   return hdma->ErrorCode;
 }
 
+#if defined(USE_HAL_DMA_STATISTICS) && (USE_HAL_DMA_STATISTICS == 1U)
+/**
+  * @brief  Return the transfer statistics of the DMA handle
+  * @param  hdma : pointer to a DMA_HandleTypeDef structure that contains
+  *              the configuration information for the specified DMA Stream.
+  * @note   The counters are updated by HAL_DMA_Start(), HAL_DMA_Start_IT(),
+  *         HAL_DMA_ReArm_IT() and HAL_DMA_IRQHandler(): they are read without
+  *         locking, a consistent snapshot requires the DMA interrupt to be masked.
+  * @retval Pointer to the statistics structure embedded in the handle
+  */
+const DMA_StatisticsTypeDef *HAL_DMA_GetStatistics(const DMA_HandleTypeDef *hdma)
+{
+  return &hdma->Statistics;
+}
+
+/**
+  * @brief  Reset the transfer statistics of the DMA handle
+  * @param  hdma : pointer to a DMA_HandleTypeDef structure that contains
+  *              the configuration information for the specified DMA Stream.
+  * @retval None
+  */
+void HAL_DMA_ResetStatistics(DMA_HandleTypeDef *hdma)
+{
+  /* XferLength and StartCycle describe the transfer in progress and are kept */
+  hdma->Statistics.XferCount         = 0U;
+  hdma->Statistics.XferBytes         = 0U;
+  hdma->Statistics.ErrorCount        = 0U;
+  hdma->Statistics.ErrorFlags        = HAL_DMA_ERROR_NONE;
+  hdma->Statistics.BusyCount         = 0U;
+  hdma->Statistics.IrqEntryCycle     = 0U;
+  hdma->Statistics.CallbackExitCycle = 0U;
+  hdma->Statistics.MaxXferCycles     = 0U;
+  hdma->Statistics.MaxIrqCycles      = 0U;
+}
+#endif /* USE_HAL_DMA_STATISTICS */
+
 /**
   * @}
   */
@@ -1761,6 +2073,41 @@ uint32_t HAL_DMA_GetError(DMA_HandleTypeDef *hdma)
   * @{
   */
 
+#if defined(USE_HAL_DMA_CACHE_MAINTENANCE) && (USE_HAL_DMA_CACHE_MAINTENANCE == 1U)
+/**
+  * @brief  Maintain the D-cache on the memory buffers of a transfer before its start.
+  * @param  hdma:       pointer to a DMA_HandleTypeDef structure that contains
+  *                     the configuration information for the specified DMA Stream.
+  * @param  SrcAddress: The source memory Buffer address
+  * @param  DstAddress: The destination memory Buffer address
+  * @param  DataLength: The length of data to be transferred from source to destination
+  * @note   The memory read by the DMA is cleaned, the memory written by the DMA is
+  *         cleaned and invalidated, then recorded to be invalidated again when the
+  *         transfer completes (lines may be fetched speculatively meanwhile).
+  * @retval None
+  */
+static void DMA_CacheStart(DMA_HandleTypeDef *hdma, uint32_t SrcAddress, uint32_t DstAddress, uint32_t DataLength)
+{
+  uint32_t size = DataLength << (hdma->Init.PeriphDataAlignment >> DMA_SxCR_PSIZE_Pos);
+
+  hdma->CacheAddress = 0U;
+  hdma->CacheSize    = 0U;
+
+  if(hdma->Init.Direction != DMA_PERIPH_TO_MEMORY)
+  {
+    HAL_DMAEx_CleanBuffer(SrcAddress, size);
+  }
+
+  if((hdma->Init.Direction != DMA_MEMORY_TO_PERIPH) && (HAL_DMAEx_IsBufferCached(DstAddress, size) != 0U))
+  {
+    HAL_DMAEx_CleanInvalidateBuffer(DstAddress, size);
+
+    hdma->CacheAddress = DstAddress;
+    hdma->CacheSize    = size;
+  }
+}
+#endif /* USE_HAL_DMA_CACHE_MAINTENANCE */
+
 /**
   * @brief  Sets the DMA Transfer parameter.
   * @param  hdma:       pointer to a DMA_HandleTypeDef structure that contains
@@ -9,6 +9,7 @@
   *           + IO operation functions
   *           + Peripheral Control functions
   *           + Peripheral State and Errors functions
+  *           + Command queue functions
   *
   ******************************************************************************
   * @attention
@@ -84,6 +85,30 @@
           functions: HAL_DMA2D_CLUTLoading_Suspend(), HAL_DMA2D_CLUTLoading_Resume(),
           HAL_DMA2D_CLUTLoading_Abort().
 
+     *** Command queue ***
+     =====================
+     [..]
+       (#) A GUI frame made of many small fills, copies, conversions and blendings can be
+           queued instead of being started one by one. Attach a command queue to the
+           initialized DMA2D handle with HAL_DMA2D_QueueInit(), giving an array of
+           DMA2D_QueueEntryTypeDef entries allocated by the application.
+       (#) Fill a DMA2D_CommandTypeDef structure for each operation (mode, output format,
+           destination, size, layers parameters) and queue it with HAL_DMA2D_QueueCommand().
+           The command is started at once when the DMA2D is idle, otherwise it is started
+           from the transfer complete interrupt of the previous one. Only the registers that
+           differ from the previous command are written.
+       (#) HAL_DMA2D_QueueCommand() returns the fence of the command, see also
+           HAL_DMA2D_QueueGetFence(). Use HAL_DMA2D_QueueIsFenceDone() or
+           HAL_DMA2D_QueueWaitFence() before reusing the memory used by this command and
+           the previous ones, so that the CPU keeps working while the DMA2D renders.
+       (#) HAL_DMA2D_QueueEmptyCallback() is called when the last queued command ends.
+           XferCpltCallback is not called for the queued commands.
+       (#) On a transfer or configuration error the queue stops and XferErrorCallback is
+           called: call HAL_DMA2D_QueueFlush() to drop the remaining commands and signal
+           their fences, then check HAL_DMA2D_GetError().
+       (#) HAL_DMA2D_QueueDeInit() detaches the queue. The other DMA2D transfer and
+           configuration functions must not be used while a queue is attached.
+
       (#) To control the DMA2D state, use the following function: HAL_DMA2D_GetState().
 
       (#) To read the DMA2D error code, use the following function: HAL_DMA2D_GetError().
@@ -114,6 +139,7 @@
             (+) CLUTLoadingCpltCallback : callback for CLUT loading completion.
             (+) MspInitCallback    : DMA2D MspInit.
             (+) MspDeInitCallback  : DMA2D MspDeInit.
+            (+) QueueEmptyCallback : callback for command queue empty.
           This function takes as parameters the HAL peripheral handle, the Callback ID
           and a pointer to the user callback function.
 
@@ -128,6 +154,7 @@
             (+) CLUTLoadingCpltCallback : callback for CLUT loading completion.
             (+) MspInitCallback    : DMA2D MspInit.
             (+) MspDeInitCallback  : DMA2D MspDeInit.
+            (+) QueueEmptyCallback : callback for command queue empty.
 
       (#) By default, after the @ref HAL_DMA2D_Init and if the state is HAL_DMA2D_STATE_RESET
           all callbacks are reset to the corresponding legacy weak (surcharged) functions:
@@ -190,6 +217,32 @@
   * @}
   */
 
+/** @defgroup DMA2D_Queue_Flags DMA2D Command Queue Entry Flags
+  * @{
+  */
+#define DMA2D_QUEUE_OCOLR             (0x00000001U)  /*!< Output color register used      */
+#define DMA2D_QUEUE_FG                (0x00000002U)  /*!< Foreground layer used           */
+#define DMA2D_QUEUE_FGCOLR            (0x00000004U)  /*!< Foreground color register used  */
+#define DMA2D_QUEUE_FGMAR             (0x00000008U)  /*!< Foreground memory address used  */
+#define DMA2D_QUEUE_BG                (0x00000010U)  /*!< Background layer used           */
+#define DMA2D_QUEUE_BGCOLR            (0x00000020U)  /*!< Background color register used  */
+#define DMA2D_QUEUE_BGMAR             (0x00000040U)  /*!< Background memory address used  */
+/**
+  * @}
+  */
+
+/** @defgroup DMA2D_Queue_Masks DMA2D Command Queue Register Masks
+  * @{
+  */
+#define DMA2D_QUEUE_OPFCCR_MASK       (DMA2D_OPFCCR_CM | DMA2D_OPFCCR_SB | DMA2D_OPFCCR_AI | DMA2D_OPFCCR_RBS)
+#define DMA2D_QUEUE_FGPFCCR_MASK      (DMA2D_FGPFCCR_CM | DMA2D_FGPFCCR_AM | DMA2D_FGPFCCR_ALPHA | \
+                                       DMA2D_FGPFCCR_AI | DMA2D_FGPFCCR_RBS | DMA2D_FGPFCCR_CSS)
+#define DMA2D_QUEUE_BGPFCCR_MASK      (DMA2D_BGPFCCR_CM | DMA2D_BGPFCCR_AM | DMA2D_BGPFCCR_ALPHA | \
+                                       DMA2D_BGPFCCR_AI | DMA2D_BGPFCCR_RBS)
+/**
+  * @}
+  */
+
 /**
   * @}
   */
@@ -203,6 +256,12 @@
   */
 static void DMA2D_SetConfig(DMA2D_HandleTypeDef *hdma2d, uint32_t pdata, uint32_t DstAddress, uint32_t Width,
                             uint32_t Height);
+static uint32_t DMA2D_GetOutputColor(uint32_t ColorMode, uint32_t Color);
+static uint32_t DMA2D_GetLayerPFC(const DMA2D_LayerCfgTypeDef *pLayerCfg, uint32_t *pColor);
+static void DMA2D_QueueEncode(DMA2D_HandleTypeDef *hdma2d, const DMA2D_CommandTypeDef *pCommand,
+                              DMA2D_QueueEntryTypeDef *pEntry);
+static HAL_StatusTypeDef DMA2D_QueueStart(DMA2D_HandleTypeDef *hdma2d);
+static void DMA2D_QueueXferCplt(DMA2D_HandleTypeDef *hdma2d);
 /**
   * @}
   */
@@ -259,6 +318,7 @@ HAL_StatusTypeDef HAL_DMA2D_Init(DMA2D_HandleTypeDef *hdma2d)
     /* Reset Callback pointers in HAL_DMA2D_STATE_RESET only */
     hdma2d->LineEventCallback       = HAL_DMA2D_LineEventCallback;
     hdma2d->CLUTLoadingCpltCallback = HAL_DMA2D_CLUTLoadingCpltCallback;
+    hdma2d->QueueEmptyCallback      = HAL_DMA2D_QueueEmptyCallback;
     if (hdma2d->MspInitCallback == NULL)
     {
       hdma2d->MspInitCallback = HAL_DMA2D_MspInit;
@@ -295,6 +355,9 @@ HAL_StatusTypeDef HAL_DMA2D_Init(DMA2D_HandleTypeDef *hdma2d)
               (hdma2d->Init.RedBlueSwap << DMA2D_OPFCCR_RBS_Pos)));
 
 
+  /* No command queue attached */
+  hdma2d->pQueue = NULL;
+
   /* Update error code */
   hdma2d->ErrorCode = HAL_DMA2D_ERROR_NONE;
 
@@ -441,6 +504,7 @@ __weak void HAL_DMA2D_MspDeInit(DMA2D_HandleTypeDef *hdma2d)
   *          @arg @ref HAL_DMA2D_CLUTLOADINGCPLT_CB_ID DMA2D CLUT loading completion Callback ID
   *          @arg @ref HAL_DMA2D_MSPINIT_CB_ID DMA2D MspInit callback ID
   *          @arg @ref HAL_DMA2D_MSPDEINIT_CB_ID DMA2D MspDeInit callback ID
+  *          @arg @ref HAL_DMA2D_QUEUEEMPTY_CB_ID DMA2D command queue empty callback ID
   * @param pCallback pointer to the Callback function
   * @note No weak predefined callbacks are defined for HAL_DMA2D_TRANSFERCOMPLETE_CB_ID or HAL_DMA2D_TRANSFERERROR_CB_ID
   * @retval status
@@ -479,6 +543,10 @@ HAL_StatusTypeDef HAL_DMA2D_RegisterCallback(DMA2D_HandleTypeDef *hdma2d, HAL_DM
         hdma2d->CLUTLoadingCpltCallback = pCallback;
         break;
 
+      case HAL_DMA2D_QUEUEEMPTY_CB_ID :
+        hdma2d->QueueEmptyCallback = pCallback;
+        break;
+
       case HAL_DMA2D_MSPINIT_CB_ID :
         hdma2d->MspInitCallback = pCallback;
         break;
@@ -540,6 +608,7 @@ HAL_StatusTypeDef HAL_DMA2D_RegisterCallback(DMA2D_HandleTypeDef *hdma2d, HAL_DM
   *          @arg @ref HAL_DMA2D_CLUTLOADINGCPLT_CB_ID DMA2D CLUT loading completion Callback ID
   *          @arg @ref HAL_DMA2D_MSPINIT_CB_ID DMA2D MspInit callback ID
   *          @arg @ref HAL_DMA2D_MSPDEINIT_CB_ID DMA2D MspDeInit callback ID
+  *          @arg @ref HAL_DMA2D_QUEUEEMPTY_CB_ID DMA2D command queue empty callback ID
   * @note No weak predefined callbacks are defined for HAL_DMA2D_TRANSFERCOMPLETE_CB_ID or HAL_DMA2D_TRANSFERERROR_CB_ID
   * @retval status
   */
@@ -570,6 +639,10 @@ HAL_StatusTypeDef HAL_DMA2D_UnRegisterCallback(DMA2D_HandleTypeDef *hdma2d, HAL_
         hdma2d->CLUTLoadingCpltCallback = HAL_DMA2D_CLUTLoadingCpltCallback;
         break;
 
+      case HAL_DMA2D_QUEUEEMPTY_CB_ID :
+        hdma2d->QueueEmptyCallback = HAL_DMA2D_QueueEmptyCallback;
+        break;
+
       case HAL_DMA2D_MSPINIT_CB_ID :
         hdma2d->MspInitCallback = HAL_DMA2D_MspInit; /* Legacy weak (surcharged) Msp Init */
         break;
@@ -1564,6 +1637,12 @@ void HAL_DMA2D_IRQHandler(DMA2D_HandleTypeDef *hdma2d)
       /* Process Unlocked */
       __HAL_UNLOCK(hdma2d);
 
+      if (hdma2d->pQueue != NULL)
+      {
+        /* Stop the command queue until it is flushed */
+        hdma2d->pQueue->Running = 0U;
+      }
+
       if (hdma2d->XferErrorCallback != NULL)
       {
         /* Transfer error Callback */
@@ -1591,6 +1670,12 @@ void HAL_DMA2D_IRQHandler(DMA2D_HandleTypeDef *hdma2d)
       /* Process Unlocked */
       __HAL_UNLOCK(hdma2d);
 
+      if (hdma2d->pQueue != NULL)
+      {
+        /* Stop the command queue until it is flushed */
+        hdma2d->pQueue->Running = 0U;
+      }
+
       if (hdma2d->XferErrorCallback != NULL)
       {
         /* Transfer error Callback */
@@ -1665,11 +1750,20 @@ void HAL_DMA2D_IRQHandler(DMA2D_HandleTypeDef *hdma2d)
       /* Process Unlocked */
       __HAL_UNLOCK(hdma2d);
 
-      if (hdma2d->XferCpltCallback != NULL)
+      if ((hdma2d->pQueue != NULL) && (hdma2d->pQueue->Running != 0U))
+      {
+        /* Signal the command fence and start the next queued command */
+        DMA2D_QueueXferCplt(hdma2d);
+      }
+      else if (hdma2d->XferCpltCallback != NULL)
       {
         /* Transfer complete Callback */
         hdma2d->XferCpltCallback(hdma2d);
       }
+      else
+      {
+        /* Nothing to do */
+      }
     }
   }
   /* CLUT Transfer Complete Interrupt management ******************************/
@@ -2078,6 +2172,277 @@ uint32_t HAL_DMA2D_GetError(DMA2D_HandleTypeDef *hdma2d)
   return hdma2d->ErrorCode;
 }
 
+/**
+  * @}
+  */
+
+/** @defgroup DMA2D_Exported_Functions_Group5 Command queue functions
+  *  @brief    Command queue functions
+  *
+@verbatim
+ ===============================================================================
+                  ##### Command queue functions #####
+ ===============================================================================
+    [..]
+    This subsection provides functions allowing to:
+      (+) Attach and detach a command queue
+      (+) Queue fill, copy, pixel format conversion and blending commands
+      (+) Flush the queue after an error
+      (+) Check and wait for the command fences
+      (+) Command queue empty callback
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Attach a command queue to the DMA2D.
+  * @param  hdma2d   Pointer to a DMA2D_HandleTypeDef structure that contains
+  *                   the configuration information for the DMA2D.
+  * @param  pQueue   Pointer to a DMA2D_QueueTypeDef structure, kept by the driver
+  *                   until HAL_DMA2D_QueueDeInit() is called.
+  * @param  pEntries Array of Size queue entries.
+  * @param  Size     Number of queue entries, maximum number of pending commands.
+  * @note   The DMA2D must be initialized with HAL_DMA2D_Init() and the DMA2D
+  *         interrupt handler must call HAL_DMA2D_IRQHandler().
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DMA2D_QueueInit(DMA2D_HandleTypeDef *hdma2d, DMA2D_QueueTypeDef *pQueue,
+                                      DMA2D_QueueEntryTypeDef *pEntries, uint32_t Size)
+{
+  if ((pQueue == NULL) || (pEntries == NULL) || (Size == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  if (hdma2d->State != HAL_DMA2D_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  pQueue->pEntries       = pEntries;
+  pQueue->Size           = Size;
+  pQueue->Head           = 0U;
+  pQueue->Tail           = 0U;
+  pQueue->Count          = 0U;
+  pQueue->Running        = 0U;
+  pQueue->SubmittedFence = 0U;
+  pQueue->CompletedFence = 0U;
+
+  /* Start from the current register values */
+  pQueue->OPFCCR  = READ_REG(hdma2d->Instance->OPFCCR) & DMA2D_QUEUE_OPFCCR_MASK;
+  pQueue->OOR     = READ_REG(hdma2d->Instance->OOR);
+  pQueue->OCOLR   = READ_REG(hdma2d->Instance->OCOLR);
+  pQueue->NLR     = READ_REG(hdma2d->Instance->NLR);
+  pQueue->FGOR    = READ_REG(hdma2d->Instance->FGOR);
+  pQueue->FGPFCCR = READ_REG(hdma2d->Instance->FGPFCCR) & DMA2D_QUEUE_FGPFCCR_MASK;
+  pQueue->FGCOLR  = READ_REG(hdma2d->Instance->FGCOLR);
+  pQueue->BGOR    = READ_REG(hdma2d->Instance->BGOR);
+  pQueue->BGPFCCR = READ_REG(hdma2d->Instance->BGPFCCR) & DMA2D_QUEUE_BGPFCCR_MASK;
+  pQueue->BGCOLR  = READ_REG(hdma2d->Instance->BGCOLR);
+
+  hdma2d->pQueue = pQueue;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Detach the command queue, the pending commands are dropped.
+  * @param  hdma2d  Pointer to a DMA2D_HandleTypeDef structure that contains
+  *                  the configuration information for the DMA2D.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DMA2D_QueueDeInit(DMA2D_HandleTypeDef *hdma2d)
+{
+  HAL_StatusTypeDef status;
+
+  status = HAL_DMA2D_QueueFlush(hdma2d);
+
+  hdma2d->pQueue = NULL;
+
+  return status;
+}
+
+/**
+  * @brief  Queue a DMA2D command.
+  * @param  hdma2d   Pointer to a DMA2D_HandleTypeDef structure that contains
+  *                   the configuration information for the DMA2D.
+  * @param  pCommand Pointer to a DMA2D_CommandTypeDef structure describing the operation,
+  *                   copied by the driver.
+  * @param  pFence   Pointer to the fence of the command, may be NULL.
+  * @note   The command is started at once when the DMA2D is idle.
+  * @retval HAL status, HAL_BUSY when the queue is full.
+  */
+HAL_StatusTypeDef HAL_DMA2D_QueueCommand(DMA2D_HandleTypeDef *hdma2d, const DMA2D_CommandTypeDef *pCommand,
+                                         uint32_t *pFence)
+{
+  DMA2D_QueueTypeDef *queue = hdma2d->pQueue;
+  HAL_StatusTypeDef status = HAL_OK;
+  uint32_t primask;
+
+  if ((queue == NULL) || (pCommand == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the parameters */
+  assert_param(IS_DMA2D_MODE(pCommand->Mode));
+  assert_param(IS_DMA2D_CMODE(pCommand->OutputColorMode));
+  assert_param(IS_DMA2D_OFFSET(pCommand->OutputOffset));
+  assert_param(IS_DMA2D_LINE(pCommand->Height));
+  assert_param(IS_DMA2D_PIXEL(pCommand->Width));
+
+  /* Only the interrupt handler removes commands, a free entry stays free */
+  if (queue->Count >= queue->Size)
+  {
+    return HAL_BUSY;
+  }
+
+  DMA2D_QueueEncode(hdma2d, pCommand, &queue->pEntries[queue->Tail]);
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  queue->SubmittedFence++;
+  queue->pEntries[queue->Tail].Fence = queue->SubmittedFence;
+  queue->Tail = ((queue->Tail + 1U) == queue->Size) ? 0U : (queue->Tail + 1U);
+  queue->Count++;
+
+  if (pFence != NULL)
+  {
+    *pFence = queue->SubmittedFence;
+  }
+
+  /* Start the queue when the DMA2D is idle */
+  if (queue->Running == 0U)
+  {
+    queue->Running = 1U;
+    status = DMA2D_QueueStart(hdma2d);
+    if (status != HAL_OK)
+    {
+      queue->Running = 0U;
+    }
+  }
+
+  __set_PRIMASK(primask);
+
+  return status;
+}
+
+/**
+  * @brief  Stop the command queue and drop the pending commands.
+  * @param  hdma2d  Pointer to a DMA2D_HandleTypeDef structure that contains
+  *                  the configuration information for the DMA2D.
+  * @note   The ongoing transfer is aborted. The fences of the dropped commands
+  *         are signaled.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DMA2D_QueueFlush(DMA2D_HandleTypeDef *hdma2d)
+{
+  DMA2D_QueueTypeDef *queue = hdma2d->pQueue;
+  HAL_StatusTypeDef status = HAL_OK;
+  uint32_t primask;
+
+  if (queue == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  queue->Running = 0U;
+  __set_PRIMASK(primask);
+
+  if (hdma2d->State == HAL_DMA2D_STATE_BUSY)
+  {
+    status = HAL_DMA2D_Abort(hdma2d);
+  }
+
+  queue->Head = 0U;
+  queue->Tail = 0U;
+  queue->Count = 0U;
+  queue->CompletedFence = queue->SubmittedFence;
+
+  return status;
+}
+
+/**
+  * @brief  Return the fence of the last queued command.
+  * @param  hdma2d  Pointer to a DMA2D_HandleTypeDef structure that contains
+  *                  the configuration information for the DMA2D.
+  * @retval Fence, signaled when all the commands queued so far are done.
+  */
+uint32_t HAL_DMA2D_QueueGetFence(DMA2D_HandleTypeDef *hdma2d)
+{
+  return (hdma2d->pQueue != NULL) ? hdma2d->pQueue->SubmittedFence : 0U;
+}
+
+/**
+  * @brief  Check whether a fence is signaled.
+  * @param  hdma2d  Pointer to a DMA2D_HandleTypeDef structure that contains
+  *                  the configuration information for the DMA2D.
+  * @param  Fence   Fence returned by HAL_DMA2D_QueueCommand() or HAL_DMA2D_QueueGetFence().
+  * @retval 1 when the command of the fence and the previous ones are done, 0 otherwise.
+  */
+uint32_t HAL_DMA2D_QueueIsFenceDone(DMA2D_HandleTypeDef *hdma2d, uint32_t Fence)
+{
+  if (hdma2d->pQueue == NULL)
+  {
+    return 1U;
+  }
+
+  /* Fences are sequence numbers, compared with wrap around */
+  return (((int32_t)(hdma2d->pQueue->CompletedFence - Fence)) >= 0) ? 1U : 0U;
+}
+
+/**
+  * @brief  Wait for a fence to be signaled.
+  * @param  hdma2d  Pointer to a DMA2D_HandleTypeDef structure that contains
+  *                  the configuration information for the DMA2D.
+  * @param  Fence   Fence returned by HAL_DMA2D_QueueCommand() or HAL_DMA2D_QueueGetFence().
+  * @param  Timeout Timeout duration in ms.
+  * @retval HAL status, HAL_ERROR when the queue stopped on an error.
+  */
+HAL_StatusTypeDef HAL_DMA2D_QueueWaitFence(DMA2D_HandleTypeDef *hdma2d, uint32_t Fence, uint32_t Timeout)
+{
+  uint32_t tickstart = HAL_GetTick();
+
+  while (HAL_DMA2D_QueueIsFenceDone(hdma2d, Fence) == 0U)
+  {
+    if (hdma2d->pQueue->Running == 0U)
+    {
+      /* Stopped on error, the fence is signaled by HAL_DMA2D_QueueFlush() */
+      return HAL_ERROR;
+    }
+
+    if (Timeout != HAL_MAX_DELAY)
+    {
+      if (((HAL_GetTick() - tickstart) > Timeout) || (Timeout == 0U))
+      {
+        return HAL_TIMEOUT;
+      }
+    }
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Command queue empty callback, the last queued command is done.
+  * @param  hdma2d pointer to a DMA2D_HandleTypeDef structure that contains
+  *                 the configuration information for the DMA2D.
+  * @retval None
+  */
+__weak void HAL_DMA2D_QueueEmptyCallback(DMA2D_HandleTypeDef *hdma2d)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hdma2d);
+
+  /* NOTE : This function should not be modified; when the callback is needed,
+            the HAL_DMA2D_QueueEmptyCallback can be implemented in the user file.
+   */
+}
+
 /**
   * @}
   */
@@ -2104,12 +2469,6 @@ uint32_t HAL_DMA2D_GetError(DMA2D_HandleTypeDef *hdma2d)
 static void DMA2D_SetConfig(DMA2D_HandleTypeDef *hdma2d, uint32_t pdata, uint32_t DstAddress, uint32_t Width,
                             uint32_t Height)
 {
-  uint32_t tmp;
-  uint32_t tmp1;
-  uint32_t tmp2;
-  uint32_t tmp3;
-  uint32_t tmp4;
-
   /* Configure DMA2D data size */
   MODIFY_REG(hdma2d->Instance->NLR, (DMA2D_NLR_NL | DMA2D_NLR_PL), (Height | (Width << DMA2D_NLR_PL_Pos)));
 
@@ -2119,54 +2478,321 @@ static void DMA2D_SetConfig(DMA2D_HandleTypeDef *hdma2d, uint32_t pdata, uint32_
   /* Register to memory DMA2D mode selected */
   if (hdma2d->Init.Mode == DMA2D_R2M)
   {
-    tmp1 = pdata & DMA2D_OCOLR_ALPHA_1;
-    tmp2 = pdata & DMA2D_OCOLR_RED_1;
-    tmp3 = pdata & DMA2D_OCOLR_GREEN_1;
-    tmp4 = pdata & DMA2D_OCOLR_BLUE_1;
+    /* Write to DMA2D OCOLR register */
+    WRITE_REG(hdma2d->Instance->OCOLR, DMA2D_GetOutputColor(hdma2d->Init.ColorMode, pdata));
+  }
+  else if (hdma2d->Init.Mode == DMA2D_M2M_BLEND_FG) /*M2M_blending with fixed color FG DMA2D Mode selected*/
+  {
+    WRITE_REG(hdma2d->Instance->BGMAR, pdata);
+  }
+  else /* M2M, M2M_PFC,M2M_Blending or M2M_blending with fixed color BG DMA2D Mode */
+  {
+    /* Configure DMA2D source address */
+    WRITE_REG(hdma2d->Instance->FGMAR, pdata);
+  }
+}
+
+/**
+  * @brief  Convert an ARGB8888 color to the OCOLR register format.
+  * @param  ColorMode Output color mode, a value of @ref DMA2D_Output_Color_Mode
+  * @param  Color     Color in ARGB8888 format
+  * @retval OCOLR register value
+  */
+static uint32_t DMA2D_GetOutputColor(uint32_t ColorMode, uint32_t Color)
+{
+  uint32_t tmp;
+  uint32_t tmp1;
+  uint32_t tmp2;
+  uint32_t tmp3;
+  uint32_t tmp4;
+
+  tmp1 = Color & DMA2D_OCOLR_ALPHA_1;
+  tmp2 = Color & DMA2D_OCOLR_RED_1;
+  tmp3 = Color & DMA2D_OCOLR_GREEN_1;
+  tmp4 = Color & DMA2D_OCOLR_BLUE_1;
+
+  /* Prepare the value to be written to the OCOLR register according to the color mode */
+  if (ColorMode == DMA2D_OUTPUT_ARGB8888)
+  {
+    tmp = (tmp3 | tmp2 | tmp1 | tmp4);
+  }
+  else if (ColorMode == DMA2D_OUTPUT_RGB888)
+  {
+    tmp = (tmp3 | tmp2 | tmp4);
+  }
+  else if (ColorMode == DMA2D_OUTPUT_RGB565)
+  {
+    tmp2 = (tmp2 >> 19U);
+    tmp3 = (tmp3 >> 10U);
+    tmp4 = (tmp4 >> 3U);
+    tmp  = ((tmp3 << 5U) | (tmp2 << 11U) | tmp4);
+  }
+  else if (ColorMode == DMA2D_OUTPUT_ARGB1555)
+  {
+    tmp1 = (tmp1 >> 31U);
+    tmp2 = (tmp2 >> 19U);
+    tmp3 = (tmp3 >> 11U);
+    tmp4 = (tmp4 >> 3U);
+    tmp  = ((tmp3 << 5U) | (tmp2 << 10U) | (tmp1 << 15U) | tmp4);
+  }
+  else /* ColorMode = DMA2D_OUTPUT_ARGB4444 */
+  {
+    tmp1 = (tmp1 >> 28U);
+    tmp2 = (tmp2 >> 20U);
+    tmp3 = (tmp3 >> 12U);
+    tmp4 = (tmp4 >> 4U);
+    tmp  = ((tmp3 << 4U) | (tmp2 << 8U) | (tmp1 << 12U) | tmp4);
+  }
 
-    /* Prepare the value to be written to the OCOLR register according to the color mode */
-    if (hdma2d->Init.ColorMode == DMA2D_OUTPUT_ARGB8888)
+  return tmp;
+}
+
+/**
+  * @brief  Compute the PFC control register value of a layer, as HAL_DMA2D_ConfigLayer().
+  * @param  pLayerCfg Pointer to the layer parameters
+  * @param  pColor    Layer color register value, updated in A4 and A8 modes only
+  * @retval FGPFCCR or BGPFCCR register value
+  */
+static uint32_t DMA2D_GetLayerPFC(const DMA2D_LayerCfgTypeDef *pLayerCfg, uint32_t *pColor)
+{
+  uint32_t regValue;
+
+  assert_param(IS_DMA2D_OFFSET(pLayerCfg->InputOffset));
+  assert_param(IS_DMA2D_INPUT_COLOR_MODE(pLayerCfg->InputColorMode));
+  assert_param(IS_DMA2D_ALPHA_MODE(pLayerCfg->AlphaMode));
+  assert_param(IS_DMA2D_ALPHA_INVERTED(pLayerCfg->AlphaInverted));
+  assert_param(IS_DMA2D_RB_SWAP(pLayerCfg->RedBlueSwap));
+
+  regValue = pLayerCfg->InputColorMode | (pLayerCfg->AlphaMode << DMA2D_BGPFCCR_AM_Pos) | \
+             (pLayerCfg->AlphaInverted << DMA2D_BGPFCCR_AI_Pos) | (pLayerCfg->RedBlueSwap << DMA2D_BGPFCCR_RBS_Pos);
+
+  if ((pLayerCfg->InputColorMode == DMA2D_INPUT_A4) || (pLayerCfg->InputColorMode == DMA2D_INPUT_A8))
+  {
+    regValue |= (pLayerCfg->InputAlpha & DMA2D_BGPFCCR_ALPHA);
+    *pColor = pLayerCfg->InputAlpha & (DMA2D_BGCOLR_BLUE | DMA2D_BGCOLR_GREEN | DMA2D_BGCOLR_RED);
+  }
+  else
+  {
+    regValue |= (pLayerCfg->InputAlpha << DMA2D_BGPFCCR_ALPHA_Pos);
+  }
+
+  return regValue;
+}
+
+/**
+  * @brief  Compute the register values of a queued command.
+  * @param  hdma2d   Pointer to a DMA2D_HandleTypeDef structure that contains
+  *                   the configuration information for the DMA2D.
+  * @param  pCommand Pointer to the command
+  * @param  pEntry   Pointer to the queue entry
+  * @retval None
+  */
+static void DMA2D_QueueEncode(DMA2D_HandleTypeDef *hdma2d, const DMA2D_CommandTypeDef *pCommand,
+                              DMA2D_QueueEntryTypeDef *pEntry)
+{
+  uint32_t color = 0U;
+
+  pEntry->Flags  = 0U;
+  pEntry->CR     = pCommand->Mode | hdma2d->Init.LineOffsetMode;
+  pEntry->OPFCCR = pCommand->OutputColorMode | hdma2d->Init.BytesSwap |
+                   (hdma2d->Init.AlphaInverted << DMA2D_OPFCCR_AI_Pos) |
+                   (hdma2d->Init.RedBlueSwap << DMA2D_OPFCCR_RBS_Pos);
+  pEntry->OOR    = pCommand->OutputOffset;
+  pEntry->NLR    = pCommand->Height | (pCommand->Width << DMA2D_NLR_PL_Pos);
+  pEntry->OMAR   = pCommand->DstAddress;
+
+  if (pCommand->Mode == DMA2D_R2M)
+  {
+    pEntry->OCOLR = DMA2D_GetOutputColor(pCommand->OutputColorMode, pCommand->Color);
+    pEntry->Flags |= DMA2D_QUEUE_OCOLR;
+  }
+  else
+  {
+    /* Foreground layer, source or fixed color */
+    pEntry->FGMAR   = pCommand->FgAddress;
+    pEntry->FGOR    = pCommand->Foreground.InputOffset;
+    pEntry->FGPFCCR = DMA2D_GetLayerPFC(&pCommand->Foreground, &color);
+    if (pCommand->Foreground.InputColorMode == DMA2D_INPUT_YCBCR)
     {
-      tmp = (tmp3 | tmp2 | tmp1 | tmp4);
+      assert_param(IS_DMA2D_CHROMA_SUB_SAMPLING(pCommand->Foreground.ChromaSubSampling));
+      pEntry->FGPFCCR |= (pCommand->Foreground.ChromaSubSampling << DMA2D_FGPFCCR_CSS_Pos);
     }
-    else if (hdma2d->Init.ColorMode == DMA2D_OUTPUT_RGB888)
+    pEntry->Flags |= DMA2D_QUEUE_FG;
+
+    if (pCommand->Mode == DMA2D_M2M_BLEND_FG)
     {
-      tmp = (tmp3 | tmp2 | tmp4);
+      pEntry->FGCOLR = pCommand->Color & (DMA2D_FGCOLR_BLUE | DMA2D_FGCOLR_GREEN | DMA2D_FGCOLR_RED);
+      pEntry->Flags |= DMA2D_QUEUE_FGCOLR;
     }
-    else if (hdma2d->Init.ColorMode == DMA2D_OUTPUT_RGB565)
+    else
     {
-      tmp2 = (tmp2 >> 19U);
-      tmp3 = (tmp3 >> 10U);
-      tmp4 = (tmp4 >> 3U);
-      tmp  = ((tmp3 << 5U) | (tmp2 << 11U) | tmp4);
+      pEntry->Flags |= DMA2D_QUEUE_FGMAR;
+      if ((pCommand->Foreground.InputColorMode == DMA2D_INPUT_A4) ||
+          (pCommand->Foreground.InputColorMode == DMA2D_INPUT_A8))
+      {
+        pEntry->FGCOLR = color;
+        pEntry->Flags |= DMA2D_QUEUE_FGCOLR;
+      }
     }
-    else if (hdma2d->Init.ColorMode == DMA2D_OUTPUT_ARGB1555)
+
+    /* Background layer of the blending modes */
+    if ((pCommand->Mode == DMA2D_M2M_BLEND) || (pCommand->Mode == DMA2D_M2M_BLEND_FG) ||
+        (pCommand->Mode == DMA2D_M2M_BLEND_BG))
     {
-      tmp1 = (tmp1 >> 31U);
-      tmp2 = (tmp2 >> 19U);
-      tmp3 = (tmp3 >> 11U);
-      tmp4 = (tmp4 >> 3U);
-      tmp  = ((tmp3 << 5U) | (tmp2 << 10U) | (tmp1 << 15U) | tmp4);
+      pEntry->BGMAR   = pCommand->BgAddress;
+      pEntry->BGOR    = pCommand->Background.InputOffset;
+      pEntry->BGPFCCR = DMA2D_GetLayerPFC(&pCommand->Background, &color);
+      pEntry->Flags |= DMA2D_QUEUE_BG;
+
+      if (pCommand->Mode == DMA2D_M2M_BLEND_BG)
+      {
+        pEntry->BGCOLR = pCommand->Color & (DMA2D_BGCOLR_BLUE | DMA2D_BGCOLR_GREEN | DMA2D_BGCOLR_RED);
+        pEntry->Flags |= DMA2D_QUEUE_BGCOLR;
+      }
+      else
+      {
+        pEntry->Flags |= DMA2D_QUEUE_BGMAR;
+        if ((pCommand->Background.InputColorMode == DMA2D_INPUT_A4) ||
+            (pCommand->Background.InputColorMode == DMA2D_INPUT_A8))
+        {
+          pEntry->BGCOLR = color;
+          pEntry->Flags |= DMA2D_QUEUE_BGCOLR;
+        }
+      }
     }
-    else /* Dhdma2d->Init.ColorMode = DMA2D_OUTPUT_ARGB4444 */
+  }
+}
+
+/**
+  * @brief  Start the command at the head of the queue.
+  * @param  hdma2d   Pointer to a DMA2D_HandleTypeDef structure that contains
+  *                   the configuration information for the DMA2D.
+  * @note   Called with the DMA2D interrupt masked or from the DMA2D interrupt.
+  *         The registers holding the same value as for the previous command are
+  *         not written again.
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef DMA2D_QueueStart(DMA2D_HandleTypeDef *hdma2d)
+{
+  DMA2D_QueueTypeDef *queue = hdma2d->pQueue;
+  const DMA2D_QueueEntryTypeDef *entry = &queue->pEntries[queue->Head];
+
+  /* Process locked */
+  __HAL_LOCK(hdma2d);
+
+  /* Change DMA2D peripheral state */
+  hdma2d->State = HAL_DMA2D_STATE_BUSY;
+
+  /* Output */
+  if (entry->OPFCCR != queue->OPFCCR)
+  {
+    MODIFY_REG(hdma2d->Instance->OPFCCR, DMA2D_QUEUE_OPFCCR_MASK, entry->OPFCCR);
+    queue->OPFCCR = entry->OPFCCR;
+  }
+  if (entry->OOR != queue->OOR)
+  {
+    WRITE_REG(hdma2d->Instance->OOR, entry->OOR);
+    queue->OOR = entry->OOR;
+  }
+  if (entry->NLR != queue->NLR)
+  {
+    WRITE_REG(hdma2d->Instance->NLR, entry->NLR);
+    queue->NLR = entry->NLR;
+  }
+  WRITE_REG(hdma2d->Instance->OMAR, entry->OMAR);
+  if (((entry->Flags & DMA2D_QUEUE_OCOLR) != 0U) && (entry->OCOLR != queue->OCOLR))
+  {
+    WRITE_REG(hdma2d->Instance->OCOLR, entry->OCOLR);
+    queue->OCOLR = entry->OCOLR;
+  }
+
+  /* Foreground */
+  if ((entry->Flags & DMA2D_QUEUE_FG) != 0U)
+  {
+    if (entry->FGPFCCR != queue->FGPFCCR)
     {
-      tmp1 = (tmp1 >> 28U);
-      tmp2 = (tmp2 >> 20U);
-      tmp3 = (tmp3 >> 12U);
-      tmp4 = (tmp4 >> 4U);
-      tmp  = ((tmp3 << 4U) | (tmp2 << 8U) | (tmp1 << 12U) | tmp4);
+      MODIFY_REG(hdma2d->Instance->FGPFCCR, DMA2D_QUEUE_FGPFCCR_MASK, entry->FGPFCCR);
+      queue->FGPFCCR = entry->FGPFCCR;
+    }
+    if (entry->FGOR != queue->FGOR)
+    {
+      WRITE_REG(hdma2d->Instance->FGOR, entry->FGOR);
+      queue->FGOR = entry->FGOR;
+    }
+    if (((entry->Flags & DMA2D_QUEUE_FGCOLR) != 0U) && (entry->FGCOLR != queue->FGCOLR))
+    {
+      WRITE_REG(hdma2d->Instance->FGCOLR, entry->FGCOLR);
+      queue->FGCOLR = entry->FGCOLR;
+    }
+    if ((entry->Flags & DMA2D_QUEUE_FGMAR) != 0U)
+    {
+      WRITE_REG(hdma2d->Instance->FGMAR, entry->FGMAR);
     }
-    /* Write to DMA2D OCOLR register */
-    WRITE_REG(hdma2d->Instance->OCOLR, tmp);
   }
-  else if (hdma2d->Init.Mode == DMA2D_M2M_BLEND_FG) /*M2M_blending with fixed color FG DMA2D Mode selected*/
+
+  /* Background */
+  if ((entry->Flags & DMA2D_QUEUE_BG) != 0U)
   {
-    WRITE_REG(hdma2d->Instance->BGMAR, pdata);
+    if (entry->BGPFCCR != queue->BGPFCCR)
+    {
+      MODIFY_REG(hdma2d->Instance->BGPFCCR, DMA2D_QUEUE_BGPFCCR_MASK, entry->BGPFCCR);
+      queue->BGPFCCR = entry->BGPFCCR;
+    }
+    if (entry->BGOR != queue->BGOR)
+    {
+      WRITE_REG(hdma2d->Instance->BGOR, entry->BGOR);
+      queue->BGOR = entry->BGOR;
+    }
+    if (((entry->Flags & DMA2D_QUEUE_BGCOLR) != 0U) && (entry->BGCOLR != queue->BGCOLR))
+    {
+      WRITE_REG(hdma2d->Instance->BGCOLR, entry->BGCOLR);
+      queue->BGCOLR = entry->BGCOLR;
+    }
+    if ((entry->Flags & DMA2D_QUEUE_BGMAR) != 0U)
+    {
+      WRITE_REG(hdma2d->Instance->BGMAR, entry->BGMAR);
+    }
   }
-  else /* M2M, M2M_PFC,M2M_Blending or M2M_blending with fixed color BG DMA2D Mode */
+
+  /* Mode, interrupts and start in a single CR write */
+  MODIFY_REG(hdma2d->Instance->CR, DMA2D_CR_MODE | DMA2D_CR_LOM,
+             entry->CR | DMA2D_IT_TC | DMA2D_IT_TE | DMA2D_IT_CE | DMA2D_CR_START);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Transfer complete of a queued command.
+  * @param  hdma2d   Pointer to a DMA2D_HandleTypeDef structure that contains
+  *                   the configuration information for the DMA2D.
+  * @retval None
+  */
+static void DMA2D_QueueXferCplt(DMA2D_HandleTypeDef *hdma2d)
+{
+  DMA2D_QueueTypeDef *queue = hdma2d->pQueue;
+
+  /* Signal the fence of the completed command */
+  queue->CompletedFence = queue->pEntries[queue->Head].Fence;
+  queue->Head = ((queue->Head + 1U) == queue->Size) ? 0U : (queue->Head + 1U);
+  queue->Count--;
+
+  if (queue->Count != 0U)
   {
-    /* Configure DMA2D source address */
-    WRITE_REG(hdma2d->Instance->FGMAR, pdata);
+    /* Chain the next command */
+    if (DMA2D_QueueStart(hdma2d) != HAL_OK)
+    {
+      queue->Running = 0U;
+    }
+  }
+  else
+  {
+    queue->Running = 0U;
+
+#if (USE_HAL_DMA2D_REGISTER_CALLBACKS == 1)
+    hdma2d->QueueEmptyCallback(hdma2d);
+#else
+    HAL_DMA2D_QueueEmptyCallback(hdma2d);
+#endif /* USE_HAL_DMA2D_REGISTER_CALLBACKS */
   }
 }
 
@@ -0,0 +1,461 @@
+/**
+  ******************************************************************************
+  * @file    stm32h7xx_hal_dma2d_ex.c
+  * @author  MCD Application Team
+  * @brief   Extended DMA2D HAL module driver.
+  *          This file provides firmware functions to use the DMA2D as a
+  *          memory fill and copy engine for non graphics buffers:
+  *           + Linear memory fill and copy functions
+  *           + Comparison with the CPU and MDMA copies
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  @verbatim
+  ==============================================================================
+                        ##### How to use this driver #####
+  ==============================================================================
+    [..]
+      The register to memory mode of the DMA2D is a wide memory fill and its
+      memory to memory mode a bulk copy engine, useful to clear heaps or to
+      move buffers to and from the FMC SDRAM.
+
+      (#) Initialize the DMA2D handle once with HAL_DMA2D_Init(), the Init
+          parameters being overwritten by the helpers.
+
+      (#) Use HAL_DMA2DEx_Memset() to fill Size bytes with a byte value, and
+          HAL_DMA2DEx_Memcpy() to copy Size bytes between two buffers that do
+          not overlap.
+          (+) The linear byte range is split into a rectangle of up to 16383
+              pixels by 65535 lines, and a few rectangles more for very large
+              ranges. The pixels are 32-bit ARGB8888 words, or bytes when the
+              source and destination addresses have different word alignments.
+          (+) The unaligned head and the bytes not fitting a rectangle are
+              written by the CPU.
+          (+) The CPU standard memset() and memcpy() are used below
+              DMA2D_EX_MIN_SIZE bytes and while the DMA2D is busy, so that the
+              helpers can always be called in place of the standard functions.
+
+      (#) Use HAL_DMA2DEx_Benchmark() to measure the CPU, DMA2D and MDMA copy
+          and fill cycles for a given buffer placement.
+
+     -@- The helpers reprogram the output and foreground layer configuration.
+         HAL_DMA2D_Init() and HAL_DMA2D_ConfigLayer() must be called again
+         before the next graphics transfer.
+     -@- The DMA2D does not see the CPU data cache: the source must be cleaned
+         and the destination cleaned and invalidated by the application when
+         they are placed in a cacheable region. The ITCM and DTCM are not
+         reachable by the DMA2D.
+
+  @endverbatim
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32h7xx_hal.h"
+#include <string.h>
+
+#ifdef HAL_DMA2D_MODULE_ENABLED
+#if defined (DMA2D)
+
+/** @addtogroup STM32H7xx_HAL_Driver
+  * @{
+  */
+
+/** @defgroup DMA2DEx DMA2DEx
+  * @brief DMA2D Extended HAL module driver
+  * @{
+  */
+
+/* Private types -------------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/** @defgroup DMA2DEx_Private_Constants DMA2DEx Private Constants
+  * @{
+  */
+#define DMA2D_EX_MDMA_MAX_BLOCK     65536U   /*!< MDMA block data length limit */
+/**
+  * @}
+  */
+
+/* Private variables ---------------------------------------------------------*/
+/* Private constants ---------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+/** @addtogroup DMA2DEx_Private_Functions
+  * @{
+  */
+static HAL_StatusTypeDef DMA2DEx_Config(DMA2D_HandleTypeDef *hdma2d, uint32_t Mode, uint32_t PixelFormat);
+static HAL_StatusTypeDef DMA2DEx_Transfer(DMA2D_HandleTypeDef *hdma2d, uint32_t pdata, uint32_t DstAddress,
+                                          uint32_t PixelSize, uint32_t *pSize, uint32_t Timeout);
+static void DMA2DEx_EnableCycleCounter(void);
+/**
+  * @}
+  */
+
+/* Private functions ---------------------------------------------------------*/
+/* Exported functions --------------------------------------------------------*/
+/** @defgroup DMA2DEx_Exported_Functions DMA2DEx Exported Functions
+  * @{
+  */
+
+/** @defgroup DMA2DEx_Exported_Functions_Group1 Memory operation functions
+  *  @brief   Memory fill and copy functions
+  *
+@verbatim
+ ===============================================================================
+                      ##### Memory operation functions #####
+ ===============================================================================
+    [..]  This section provides functions allowing to:
+      (+) Fill a memory range with a byte value.
+      (+) Copy a memory range.
+      (+) Compare the CPU, DMA2D and MDMA copy and fill cycles.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Fill a memory range with a byte value, in polling mode.
+  * @param  hdma2d  pointer to a DMA2D_HandleTypeDef structure that contains
+  *                 the configuration information for the DMA2D.
+  * @param  pDst    Destination address.
+  * @param  Value   Byte value written.
+  * @param  Size    Number of bytes written.
+  * @param  Timeout Timeout duration of each DMA2D transfer.
+  * @note   The CPU memset() is used below DMA2D_EX_MIN_SIZE bytes and while
+  *         the DMA2D is busy.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DMA2DEx_Memset(DMA2D_HandleTypeDef *hdma2d, void *pDst, uint8_t Value, uint32_t Size,
+                                     uint32_t Timeout)
+{
+  uint8_t *pdst = (uint8_t *)pDst;
+  uint32_t head;
+  uint32_t left;
+  HAL_StatusTypeDef status = HAL_OK;
+
+  if ((hdma2d == NULL) || (pDst == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Small range or DMA2D in use: CPU fill */
+  if ((Size < DMA2D_EX_MIN_SIZE) || (hdma2d->State != HAL_DMA2D_STATE_READY))
+  {
+    (void)memset(pdst, (int)Value, Size);
+    return HAL_OK;
+  }
+
+  /* Head up to the first word boundary */
+  head = (4U - ((uint32_t)pdst & 3U)) & 3U;
+  (void)memset(pdst, (int)Value, head);
+  pdst = &pdst[head];
+  left = Size - head;
+
+  /* Words filled with the output color, the byte being replicated in the four color components */
+  status = DMA2DEx_Config(hdma2d, DMA2D_R2M, DMA2D_INPUT_ARGB8888);
+  if (status == HAL_OK)
+  {
+    status = DMA2DEx_Transfer(hdma2d, ((uint32_t)Value * 0x01010101U), (uint32_t)pdst, 4U, &left, Timeout);
+  }
+
+  /* Tail not fitting the rectangles */
+  if (status == HAL_OK)
+  {
+    (void)memset(&pdst[(Size - head) - left], (int)Value, left);
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Copy a memory range, in polling mode.
+  * @param  hdma2d  pointer to a DMA2D_HandleTypeDef structure that contains
+  *                 the configuration information for the DMA2D.
+  * @param  pDst    Destination address.
+  * @param  pSrc    Source address.
+  * @param  Size    Number of bytes copied.
+  * @param  Timeout Timeout duration of each DMA2D transfer.
+  * @note   The source and destination ranges must not overlap.
+  * @note   Word pixels are used when pDst and pSrc have the same alignment
+  *         in the word, byte pixels otherwise.
+  * @note   The CPU memcpy() is used below DMA2D_EX_MIN_SIZE bytes and while
+  *         the DMA2D is busy.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DMA2DEx_Memcpy(DMA2D_HandleTypeDef *hdma2d, void *pDst, const void *pSrc, uint32_t Size,
+                                     uint32_t Timeout)
+{
+  uint8_t *pdst = (uint8_t *)pDst;
+  const uint8_t *psrc = (const uint8_t *)pSrc;
+  uint32_t head = 0U;
+  uint32_t left;
+  uint32_t pixelsize = 1U;
+  uint32_t pixelformat = DMA2D_INPUT_A8;
+  HAL_StatusTypeDef status = HAL_OK;
+
+  if ((hdma2d == NULL) || (pDst == NULL) || (pSrc == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Small range or DMA2D in use: CPU copy */
+  if ((Size < DMA2D_EX_MIN_SIZE) || (hdma2d->State != HAL_DMA2D_STATE_READY))
+  {
+    (void)memcpy(pdst, psrc, Size);
+    return HAL_OK;
+  }
+
+  /* Same word alignment: head up to the first word boundary, then word pixels */
+  if ((((uint32_t)pdst ^ (uint32_t)psrc) & 3U) == 0U)
+  {
+    head = (4U - ((uint32_t)pdst & 3U)) & 3U;
+    (void)memcpy(pdst, psrc, head);
+    pdst = &pdst[head];
+    psrc = &psrc[head];
+    pixelsize = 4U;
+    pixelformat = DMA2D_INPUT_ARGB8888;
+  }
+  left = Size - head;
+
+  /* In memory to memory mode the foreground color mode gives the pixel size, without conversion */
+  status = DMA2DEx_Config(hdma2d, DMA2D_M2M, pixelformat);
+  if (status == HAL_OK)
+  {
+    status = DMA2DEx_Transfer(hdma2d, (uint32_t)psrc, (uint32_t)pdst, pixelsize, &left, Timeout);
+  }
+
+  /* Tail not fitting the rectangles */
+  if (status == HAL_OK)
+  {
+    (void)memcpy(&pdst[(Size - head) - left], &psrc[(Size - head) - left], left);
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Measure the CPU, DMA2D and MDMA copy and fill cycles of a buffer.
+  * @param  hdma2d  pointer to a DMA2D_HandleTypeDef structure that contains
+  *                 the configuration information for the DMA2D.
+  * @param  pBench  Benchmark buffers, filled with the measured cycles.
+  * @param  Timeout Timeout duration of each transfer.
+  * @note   The DWT cycle counter is enabled if not already done. The copies
+  *         and fills overwrite the destination buffer.
+  * @note   The MDMA copy is skipped when hmdma is NULL or Size is above 65536
+  *         bytes.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DMA2DEx_Benchmark(DMA2D_HandleTypeDef *hdma2d, DMA2DEx_BenchmarkTypeDef *pBench,
+                                        uint32_t Timeout)
+{
+  uint32_t start;
+  HAL_StatusTypeDef status;
+
+  if ((hdma2d == NULL) || (pBench == NULL) || (pBench->pDst == NULL) || (pBench->pSrc == NULL) ||
+      (pBench->Size < DMA2D_EX_MIN_SIZE))
+  {
+    return HAL_ERROR;
+  }
+
+  /* The DMA2D must be free so that the helpers do not fall back to the CPU */
+  if (hdma2d->State != HAL_DMA2D_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  DMA2DEx_EnableCycleCounter();
+
+  pBench->CpuCopyCycles   = 0U;
+  pBench->Dma2dCopyCycles = 0U;
+  pBench->MdmaCopyCycles  = 0U;
+  pBench->CpuSetCycles    = 0U;
+  pBench->Dma2dSetCycles  = 0U;
+
+  /* CPU copy and fill */
+  start = DWT->CYCCNT;
+  (void)memcpy(pBench->pDst, pBench->pSrc, pBench->Size);
+  pBench->CpuCopyCycles = DWT->CYCCNT - start;
+
+  start = DWT->CYCCNT;
+  (void)memset(pBench->pDst, 0, pBench->Size);
+  pBench->CpuSetCycles = DWT->CYCCNT - start;
+
+  /* DMA2D copy and fill */
+  start = DWT->CYCCNT;
+  status = HAL_DMA2DEx_Memcpy(hdma2d, pBench->pDst, pBench->pSrc, pBench->Size, Timeout);
+  pBench->Dma2dCopyCycles = DWT->CYCCNT - start;
+
+  if (status == HAL_OK)
+  {
+    start = DWT->CYCCNT;
+    status = HAL_DMA2DEx_Memset(hdma2d, pBench->pDst, 0U, pBench->Size, Timeout);
+    pBench->Dma2dSetCycles = DWT->CYCCNT - start;
+  }
+
+#if defined(HAL_MDMA_MODULE_ENABLED)
+  /* MDMA copy, as one block */
+  if ((status == HAL_OK) && (pBench->hmdma != NULL) && (pBench->Size <= DMA2D_EX_MDMA_MAX_BLOCK))
+  {
+    start = DWT->CYCCNT;
+    status = HAL_MDMA_Start(pBench->hmdma, (uint32_t)pBench->pSrc, (uint32_t)pBench->pDst, pBench->Size, 1U);
+    if (status == HAL_OK)
+    {
+      status = HAL_MDMA_PollForTransfer(pBench->hmdma, HAL_MDMA_FULL_TRANSFER, Timeout);
+    }
+    pBench->MdmaCopyCycles = DWT->CYCCNT - start;
+  }
+#endif /* HAL_MDMA_MODULE_ENABLED */
+
+  return status;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/** @defgroup DMA2DEx_Private_Functions DMA2DEx Private Functions
+  * @{
+  */
+
+/**
+  * @brief  Configure the DMA2D for linear memory transfers.
+  * @param  hdma2d      DMA2D handle.
+  * @param  Mode        DMA2D_R2M or DMA2D_M2M.
+  * @param  PixelFormat DMA2D_INPUT_ARGB8888 for word pixels, DMA2D_INPUT_A8
+  *                     for byte pixels (memory to memory mode only).
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef DMA2DEx_Config(DMA2D_HandleTypeDef *hdma2d, uint32_t Mode, uint32_t PixelFormat)
+{
+  HAL_StatusTypeDef status;
+
+  /* Contiguous lines of 32-bit output pixels */
+  hdma2d->Init.Mode           = Mode;
+  hdma2d->Init.ColorMode      = DMA2D_OUTPUT_ARGB8888;
+  hdma2d->Init.OutputOffset   = 0U;
+  hdma2d->Init.AlphaInverted  = DMA2D_REGULAR_ALPHA;
+  hdma2d->Init.RedBlueSwap    = DMA2D_RB_REGULAR;
+  hdma2d->Init.BytesSwap      = DMA2D_BYTES_REGULAR;
+  hdma2d->Init.LineOffsetMode = DMA2D_LOM_PIXELS;
+
+  status = HAL_DMA2D_Init(hdma2d);
+
+  /* Contiguous lines of source pixels, copied without modification */
+  if ((status == HAL_OK) && (Mode == DMA2D_M2M))
+  {
+    hdma2d->LayerCfg[DMA2D_FOREGROUND_LAYER].InputOffset       = 0U;
+    hdma2d->LayerCfg[DMA2D_FOREGROUND_LAYER].InputColorMode    = PixelFormat;
+    hdma2d->LayerCfg[DMA2D_FOREGROUND_LAYER].AlphaMode         = DMA2D_NO_MODIF_ALPHA;
+    hdma2d->LayerCfg[DMA2D_FOREGROUND_LAYER].InputAlpha        = 0xFFU;
+    hdma2d->LayerCfg[DMA2D_FOREGROUND_LAYER].AlphaInverted     = DMA2D_REGULAR_ALPHA;
+    hdma2d->LayerCfg[DMA2D_FOREGROUND_LAYER].RedBlueSwap       = DMA2D_RB_REGULAR;
+    hdma2d->LayerCfg[DMA2D_FOREGROUND_LAYER].ChromaSubSampling = DMA2D_NO_CSS;
+
+    status = HAL_DMA2D_ConfigLayer(hdma2d, DMA2D_FOREGROUND_LAYER);
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Transfer a linear byte range as rectangles of pixels.
+  * @param  hdma2d     DMA2D handle.
+  * @param  pdata      Output color in register to memory mode, source address
+  *                    in memory to memory mode.
+  * @param  DstAddress Destination address.
+  * @param  PixelSize  Pixel size in bytes, 1 or 4.
+  * @param  pSize      Number of bytes to transfer, updated with the number of
+  *                    bytes left to the CPU.
+  * @param  Timeout    Timeout duration of each rectangle.
+  * @note   Each rectangle uses the fewest lines able to hold the pixels left,
+  *         so that less pixels than lines remain: with 16383 pixels per line
+  *         at most, a rectangle leaves less than 0.01 % of the range.
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef DMA2DEx_Transfer(DMA2D_HandleTypeDef *hdma2d, uint32_t pdata, uint32_t DstAddress,
+                                          uint32_t PixelSize, uint32_t *pSize, uint32_t Timeout)
+{
+  uint32_t pixels = *pSize / PixelSize;
+  uint32_t lines;
+  uint32_t width;
+  uint32_t src = pdata;
+  uint32_t dst = DstAddress;
+  HAL_StatusTypeDef status = HAL_OK;
+
+  while (((pixels * PixelSize) >= DMA2D_EX_MIN_SIZE) && (status == HAL_OK))
+  {
+    /* Fewest lines holding the pixels, then the widest lines */
+    lines = ((pixels - 1U) / DMA2D_PIXEL) + 1U;
+    if (lines > DMA2D_LINE)
+    {
+      lines = DMA2D_LINE;
+    }
+    width = pixels / lines;
+    if (width > DMA2D_PIXEL)
+    {
+      width = DMA2D_PIXEL;
+    }
+
+    status = HAL_DMA2D_Start(hdma2d, src, dst, width, lines);
+    if (status == HAL_OK)
+    {
+      status = HAL_DMA2D_PollForTransfer(hdma2d, Timeout);
+    }
+
+    if (status == HAL_OK)
+    {
+      /* The source only moves in memory to memory mode */
+      if (hdma2d->Init.Mode == DMA2D_M2M)
+      {
+        src += width * lines * PixelSize;
+      }
+      dst += width * lines * PixelSize;
+      pixels -= width * lines;
+      *pSize -= width * lines * PixelSize;
+    }
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Enable the DWT cycle counter if not already done by a debugger.
+  * @retval None
+  */
+static void DMA2DEx_EnableCycleCounter(void)
+{
+  if ((DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk) == 0U)
+  {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0U;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+  }
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#endif /* DMA2D */
+#endif /* HAL_DMA2D_MODULE_ENABLED */
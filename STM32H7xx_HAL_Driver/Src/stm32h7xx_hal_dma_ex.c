@@ -33,6 +33,25 @@
           the AHB memory port on the fly (DMA_SxM0AR or DMA_SxM1AR) when the stream is enabled.
      -@-  Multi (Double) buffer mode is possible with DMA and BDMA instances.
 
+   (+) DMA buffers can be allocated from regions declared with HAL_DMAEx_BufferRegionInit():
+       HAL_DMAEx_BufferAlloc() returns blocks aligned on a D-cache line, whose size is
+       rounded up to a whole number of lines, so that no other data shares their lines.
+       A region is either non-cacheable (DMA_BUFFER_NONCACHEABLE, set up with
+       HAL_DMAEx_ConfigNonCacheableRegion() or by the application MPU setting), or
+       cacheable (DMA_BUFFER_CACHED). Blocks are released all at once with
+       HAL_DMAEx_BufferRegionReset().
+
+   (+) HAL_DMAEx_CleanBuffer(), HAL_DMAEx_InvalidateBuffer() and HAL_DMAEx_CleanInvalidateBuffer()
+       maintain the D-cache on a buffer, and do nothing when the D-cache is disabled or the
+       buffer lies in a non-cacheable region.
+
+   (+) With USE_HAL_DMA_CACHE_MAINTENANCE set to 1 in the HAL configuration file,
+       HAL_DMA_Start() and HAL_DMA_Start_IT() clean the memory read by the DMA and clean
+       and invalidate the memory written by the DMA; the DMA interrupt handler invalidates
+       the written memory again before the half and complete callbacks.
+       Drivers and applications using these functions have no cache maintenance left to do,
+       except in Multi (Double) Buffer mode.
+
   @endverbatim
   ******************************************************************************
   * @attention
@@ -63,6 +82,13 @@
 
 /* Private types -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
+/** @addtogroup DMAEx_Private_Variables
+  * @{
+  */
+static DMA_BufferRegionTypeDef *DMA_BufferRegionList = NULL;
+/**
+  * @}
+  */
 /* Private Constants ---------------------------------------------------------*/
 /* Private macros ------------------------------------------------------------*/
 /* Private functions ---------------------------------------------------------*/
@@ -624,6 +650,305 @@ void HAL_DMAEx_MUX_IRQHandler(DMA_HandleTypeDef *hdma)
 }
 
 
+/**
+  * @}
+  */
+
+/** @addtogroup DMAEx_Exported_Functions_Group2
+  *
+@verbatim
+ ===============================================================================
+                #####  DMA buffer and D-cache functions  #####
+ ===============================================================================
+    [..]  This section provides functions allowing to:
+      (+) Declare the memory regions holding DMA buffers and their cache attribute.
+      (+) Allocate D-cache line aligned DMA buffers from these regions.
+      (+) Make a region non-cacheable using the MPU.
+      (+) Maintain the D-cache on a DMA buffer, only when needed.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Declare a memory region for DMA buffers.
+  * @param  pRegion:     pointer to a DMA_BufferRegionTypeDef structure, owned by the application.
+  * @param  BaseAddress: region start address, aligned on DMA_CACHE_LINE_SIZE.
+  * @param  Size:        region size in bytes, a multiple of DMA_CACHE_LINE_SIZE.
+  * @param  Attribute:   cache attribute, a value of @ref DMAEx_Buffer_Attribute.
+  * @note   For a DMA_BUFFER_NONCACHEABLE region, the MPU must already make the
+  *         memory non-cacheable, see HAL_DMAEx_ConfigNonCacheableRegion().
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DMAEx_BufferRegionInit(DMA_BufferRegionTypeDef *pRegion, uint32_t BaseAddress, uint32_t Size,
+                                             uint32_t Attribute)
+{
+  DMA_BufferRegionTypeDef *pcurrent;
+  uint32_t primask;
+
+  /* Check the parameters */
+  assert_param(IS_DMA_BUFFER_ATTRIBUTE(Attribute));
+
+  if((pRegion == NULL) || (Size == 0U) || ((BaseAddress & (DMA_CACHE_LINE_SIZE - 1U)) != 0U) ||
+     ((Size & (DMA_CACHE_LINE_SIZE - 1U)) != 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  pRegion->BaseAddress = BaseAddress;
+  pRegion->Size        = Size;
+  pRegion->Attribute   = Attribute;
+  pRegion->Used        = 0U;
+  pRegion->pNext       = NULL;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  /* Append the region, unless already in the list */
+  pcurrent = DMA_BufferRegionList;
+  while((pcurrent != NULL) && (pcurrent != pRegion) && (pcurrent->pNext != NULL))
+  {
+    pcurrent = pcurrent->pNext;
+  }
+  if(pcurrent == NULL)
+  {
+    DMA_BufferRegionList = pRegion;
+  }
+  else if(pcurrent != pRegion)
+  {
+    pcurrent->pNext = pRegion;
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+
+  __set_PRIMASK(primask);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Remove a memory region from the driver list.
+  * @param  pRegion: pointer to a DMA_BufferRegionTypeDef structure.
+  * @note   The buffers of the region must not be in use by a DMA any more.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DMAEx_BufferRegionDeInit(DMA_BufferRegionTypeDef *pRegion)
+{
+  DMA_BufferRegionTypeDef **pplink;
+  HAL_StatusTypeDef status = HAL_ERROR;
+  uint32_t primask;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  pplink = &DMA_BufferRegionList;
+  while(*pplink != NULL)
+  {
+    if(*pplink == pRegion)
+    {
+      *pplink = pRegion->pNext;
+      pRegion->pNext = NULL;
+      status = HAL_OK;
+      break;
+    }
+    pplink = &(*pplink)->pNext;
+  }
+
+  __set_PRIMASK(primask);
+
+  return status;
+}
+
+/**
+  * @brief  Allocate a DMA buffer from a region.
+  * @param  pRegion: pointer to a DMA_BufferRegionTypeDef structure.
+  * @param  Size:    buffer size in bytes, rounded up to a multiple of DMA_CACHE_LINE_SIZE.
+  * @note   This function can be called from an interrupt. Buffers are never released
+  *         one by one, see HAL_DMAEx_BufferRegionReset().
+  * @retval Buffer address aligned on DMA_CACHE_LINE_SIZE, NULL when the region is full
+  */
+void *HAL_DMAEx_BufferAlloc(DMA_BufferRegionTypeDef *pRegion, uint32_t Size)
+{
+  void *pbuffer = NULL;
+  uint32_t linesize = (Size + (DMA_CACHE_LINE_SIZE - 1U)) & ~(DMA_CACHE_LINE_SIZE - 1U);
+  uint32_t primask;
+
+  if((Size == 0U) || (linesize < Size))
+  {
+    return NULL;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  if(linesize <= (pRegion->Size - pRegion->Used))
+  {
+    pbuffer = (void *)(pRegion->BaseAddress + pRegion->Used);
+    pRegion->Used += linesize;
+  }
+
+  __set_PRIMASK(primask);
+
+  return pbuffer;
+}
+
+/**
+  * @brief  Release all the buffers of a region.
+  * @param  pRegion: pointer to a DMA_BufferRegionTypeDef structure.
+  * @retval None
+  */
+void HAL_DMAEx_BufferRegionReset(DMA_BufferRegionTypeDef *pRegion)
+{
+  pRegion->Used = 0U;
+}
+
+#if (__MPU_PRESENT == 1)
+/**
+  * @brief  Make a memory region non-cacheable with the MPU.
+  * @param  BaseAddress: region start address, aligned on its size.
+  * @param  Size: region size, a value of @ref CORTEX_MPU_Region_Size.
+  * @param  Number: MPU region number, a value of @ref CORTEX_MPU_Region_Number.
+  *         The region must have a higher number than the regions it overlaps.
+  * @note   The region is normal memory, shareable, non-cacheable and not executable.
+  *         The MPU is left enabled if it was.
+  * @retval None
+  */
+void HAL_DMAEx_ConfigNonCacheableRegion(uint32_t BaseAddress, uint8_t Size, uint8_t Number)
+{
+  MPU_Region_InitTypeDef region;
+  uint32_t mpuctrl = MPU->CTRL;
+
+  HAL_MPU_Disable();
+
+  region.Enable           = MPU_REGION_ENABLE;
+  region.Number           = Number;
+  region.BaseAddress      = BaseAddress;
+  region.Size             = Size;
+  region.SubRegionDisable = 0x00U;
+  region.TypeExtField     = MPU_TEX_LEVEL1;
+  region.AccessPermission = MPU_REGION_FULL_ACCESS;
+  region.DisableExec      = MPU_INSTRUCTION_ACCESS_DISABLE;
+  region.IsShareable      = MPU_ACCESS_SHAREABLE;
+  region.IsCacheable      = MPU_ACCESS_NOT_CACHEABLE;
+  region.IsBufferable     = MPU_ACCESS_NOT_BUFFERABLE;
+  HAL_MPU_ConfigRegion(&region);
+
+  if((mpuctrl & MPU_CTRL_ENABLE_Msk) != 0U)
+  {
+    HAL_MPU_Enable(mpuctrl & (MPU_CTRL_HFNMIENA_Msk | MPU_CTRL_PRIVDEFENA_Msk));
+  }
+}
+#endif /* __MPU_PRESENT */
+
+/**
+  * @brief  Tell whether a buffer needs D-cache maintenance.
+  * @param  Address: buffer start address.
+  * @param  Size:    buffer size in bytes.
+  * @retval 1 when the D-cache is enabled and the buffer is not inside a
+  *         DMA_BUFFER_NONCACHEABLE region, 0 otherwise
+  */
+uint32_t HAL_DMAEx_IsBufferCached(uint32_t Address, uint32_t Size)
+{
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  const DMA_BufferRegionTypeDef *pregion = DMA_BufferRegionList;
+
+  if((Size == 0U) || ((SCB->CCR & SCB_CCR_DC_Msk) == 0U))
+  {
+    return 0U;
+  }
+
+  while(pregion != NULL)
+  {
+    if((pregion->Attribute == DMA_BUFFER_NONCACHEABLE) && (Address >= pregion->BaseAddress) &&
+       ((Address - pregion->BaseAddress) < pregion->Size) &&
+       (Size <= (pregion->Size - (Address - pregion->BaseAddress))))
+    {
+      return 0U;
+    }
+    pregion = pregion->pNext;
+  }
+
+  return 1U;
+#else
+  UNUSED(Address);
+  UNUSED(Size);
+
+  return 0U;
+#endif /* __DCACHE_PRESENT */
+}
+
+/**
+  * @brief  Clean a buffer from the D-cache, before the DMA reads it.
+  * @param  Address: buffer start address.
+  * @param  Size:    buffer size in bytes.
+  * @retval None
+  */
+void HAL_DMAEx_CleanBuffer(uint32_t Address, uint32_t Size)
+{
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  if(HAL_DMAEx_IsBufferCached(Address, Size) != 0U)
+  {
+    SCB_CleanDCache_by_Addr((uint32_t *)(Address & ~(DMA_CACHE_LINE_SIZE - 1U)),
+                            (int32_t)(Size + (Address & (DMA_CACHE_LINE_SIZE - 1U))));
+  }
+#else
+  UNUSED(Address);
+  UNUSED(Size);
+#endif /* __DCACHE_PRESENT */
+}
+
+/**
+  * @brief  Invalidate a buffer in the D-cache, after the DMA wrote it.
+  * @param  Address: buffer start address.
+  * @param  Size:    buffer size in bytes.
+  * @note   When the buffer does not start or end on a D-cache line boundary, the
+  *         buffer is cleaned and invalidated instead, to keep the data sharing its
+  *         first and last lines.
+  * @retval None
+  */
+void HAL_DMAEx_InvalidateBuffer(uint32_t Address, uint32_t Size)
+{
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  if(HAL_DMAEx_IsBufferCached(Address, Size) != 0U)
+  {
+    if(((Address | Size) & (DMA_CACHE_LINE_SIZE - 1U)) == 0U)
+    {
+      SCB_InvalidateDCache_by_Addr((uint32_t *)Address, (int32_t)Size);
+    }
+    else
+    {
+      SCB_CleanInvalidateDCache_by_Addr((uint32_t *)(Address & ~(DMA_CACHE_LINE_SIZE - 1U)),
+                                        (int32_t)(Size + (Address & (DMA_CACHE_LINE_SIZE - 1U))));
+    }
+  }
+#else
+  UNUSED(Address);
+  UNUSED(Size);
+#endif /* __DCACHE_PRESENT */
+}
+
+/**
+  * @brief  Clean and invalidate a buffer in the D-cache, before the DMA writes it.
+  * @param  Address: buffer start address.
+  * @param  Size:    buffer size in bytes.
+  * @retval None
+  */
+void HAL_DMAEx_CleanInvalidateBuffer(uint32_t Address, uint32_t Size)
+{
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  if(HAL_DMAEx_IsBufferCached(Address, Size) != 0U)
+  {
+    SCB_CleanInvalidateDCache_by_Addr((uint32_t *)(Address & ~(DMA_CACHE_LINE_SIZE - 1U)),
+                                      (int32_t)(Size + (Address & (DMA_CACHE_LINE_SIZE - 1U))));
+  }
+#else
+  UNUSED(Address);
+  UNUSED(Size);
+#endif /* __DCACHE_PRESENT */
+}
+
 /**
   * @}
   */
@@ -54,6 +54,12 @@
         Functions HAL_DSI_ShortWrite(), HAL_DSI_LongWrite() and HAL_DSI_Read() allows respectively
         to write DSI short packets, long packets and to read DSI packets.
 
+    (#) In adapted command mode without automatic refresh, HAL_DSI_RefreshRegion() updates only a
+        region of the display: the column and page address windows are sent to the display, and
+        the region is transferred from the LTDC on the next Tearing Effect. The LTDC layer window
+        and active area must be set to the region before the call. HAL_DSI_SetRefreshRegion() only
+        sets the region, for a refresh started by HAL_DSI_Refresh().
+
     (#) The DSI Host Offers two Low power modes :
         (++) Low Power Mode on data lanes only: Only DSI data lanes are shut down.
             It is possible to enter/exit from this mode using respectively functions HAL_DSI_EnterULPMData()
@@ -204,6 +210,12 @@ static HAL_StatusTypeDef DSI_ShortWrite(DSI_HandleTypeDef *hdsi,
                                         uint32_t Mode,
                                         uint32_t Param1,
                                         uint32_t Param2);
+
+static HAL_StatusTypeDef DSI_SetAddressWindow(DSI_HandleTypeDef *hdsi,
+                                              uint32_t ChannelID,
+                                              uint32_t Command,
+                                              uint32_t Start,
+                                              uint32_t End);
 /* Private functions ---------------------------------------------------------*/
 /** @defgroup DSI_Private_Functions DSI Private Functions
   * @{
@@ -273,6 +285,48 @@ static HAL_StatusTypeDef DSI_ShortWrite(DSI_HandleTypeDef *hdsi,
   return HAL_OK;
 }
 
+/**
+  * @brief  write a DCS column or page address window command
+  * @param  hdsi  pointer to a DSI_HandleTypeDef structure that contains
+  *               the configuration information for the DSI.
+  * @param  ChannelID  Virtual channel ID.
+  * @param  Command  DSI_SET_COLUMN_ADDRESS or DSI_SET_PAGE_ADDRESS.
+  * @param  Start  First column or page of the window.
+  * @param  End  Last column or page of the window.
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef DSI_SetAddressWindow(DSI_HandleTypeDef *hdsi,
+                                              uint32_t ChannelID,
+                                              uint32_t Command,
+                                              uint32_t Start,
+                                              uint32_t End)
+{
+  uint32_t tickstart;
+
+  /* Get tick */
+  tickstart = HAL_GetTick();
+
+  /* Wait for Command FIFO Empty */
+  while ((hdsi->Instance->GPSR & DSI_GPSR_CMDFE) == 0U)
+  {
+    /* Check for the Timeout */
+    if ((HAL_GetTick() - tickstart) > DSI_TIMEOUT_VALUE)
+    {
+      return HAL_TIMEOUT;
+    }
+  }
+
+  /* Set the DCS code and the four big-endian parameters on the write FIFO command */
+  hdsi->Instance->GPDR = (Command | (((Start >> 8U) & 0xFFU) << 8U) | ((Start & 0xFFU) << 16U) |
+                          (((End >> 8U) & 0xFFU) << 24U));
+  hdsi->Instance->GPDR = (End & 0xFFU);
+
+  /* Configure the packet to send a long DCS command of 5 bytes */
+  DSI_ConfigPacketHeader(hdsi->Instance, ChannelID, DSI_DCS_LONG_PKT_WRITE, 5U, 0U);
+
+  return HAL_OK;
+}
+
 /**
   * @}
   */
@@ -431,6 +485,9 @@ HAL_StatusTypeDef HAL_DSI_Init(DSI_HandleTypeDef *hdsi, DSI_PLLInitTypeDef *PLLI
   hdsi->Instance->IER[1U] = 0U;
   hdsi->ErrorMsk = 0U;
 
+  /* No region refresh requested */
+  hdsi->RefreshRequest = 0U;
+
   /* Initialize the error code */
   hdsi->ErrorCode = HAL_DSI_ERROR_NONE;
 
@@ -831,6 +888,13 @@ void HAL_DSI_IRQHandler(DSI_HandleTypeDef *hdsi)
       /* Clear the Tearing Effect Interrupt Flag */
       __HAL_DSI_CLEAR_FLAG(hdsi, DSI_FLAG_TE);
 
+      /* Start the region refresh requested by HAL_DSI_RefreshRegion() */
+      if (hdsi->RefreshRequest != 0U)
+      {
+        hdsi->RefreshRequest = 0U;
+        hdsi->Instance->WCR |= DSI_WCR_LTDCEN;
+      }
+
       /* Tearing Effect Callback */
 #if (USE_HAL_DSI_REGISTER_CALLBACKS == 1)
       /*Call registered Tearing Effect callback */
@@ -1000,6 +1064,7 @@ __weak void HAL_DSI_ErrorCallback(DSI_HandleTypeDef *hdsi)
       (+) Configure the DSI HOST timeout
       (+) Start/Stop the DSI module
       (+) Refresh the display in command mode
+      (+) Refresh only a region of the display in command mode, synchronized on the Tearing Effect
       (+) Controls the display color mode in Video mode
       (+) Control the display shutdown in Video mode
       (+) write short DCS or short Generic command
@@ -1523,6 +1588,125 @@ HAL_StatusTypeDef HAL_DSI_Refresh(DSI_HandleTypeDef *hdsi)
   return HAL_OK;
 }
 
+/**
+  * @brief  Set the display region updated by the next refreshes in command mode
+  * @param  hdsi  pointer to a DSI_HandleTypeDef structure that contains
+  *               the configuration information for the DSI.
+  * @param  ChannelID  Virtual channel ID of the display.
+  * @param  Region  pointer to a DSI_RegionTypeDef structure that contains the region.
+  * @note   The column and page address windows of the display are set with the DCS
+  *         commands DSI_SET_COLUMN_ADDRESS and DSI_SET_PAGE_ADDRESS, and the maximum size
+  *         of the LTDC write memory commands is set to the region width.
+  * @note   The LTDC layer window and the LTDC active area must be set by the application to
+  *         the region size, and the layer framebuffer address and pitch to the region origin.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DSI_SetRefreshRegion(DSI_HandleTypeDef *hdsi, uint32_t ChannelID,
+                                           const DSI_RegionTypeDef *Region)
+{
+  HAL_StatusTypeDef status;
+
+  /* Check the parameters */
+  assert_param(IS_DSI_REGION(Region->X, Region->Width));
+  assert_param(IS_DSI_REGION(Region->Y, Region->Height));
+
+  /* Process locked */
+  __HAL_LOCK(hdsi);
+
+  /* The region can not be changed while the LTDC transfers a frame */
+  if ((hdsi->Instance->WISR & DSI_WISR_BUSY) != 0U)
+  {
+    /* Process unlocked */
+    __HAL_UNLOCK(hdsi);
+
+    return HAL_BUSY;
+  }
+
+  /* Set the column and page address windows of the display */
+  status = DSI_SetAddressWindow(hdsi, ChannelID, DSI_SET_COLUMN_ADDRESS, Region->X,
+                                Region->X + Region->Width - 1U);
+  if (status == HAL_OK)
+  {
+    status = DSI_SetAddressWindow(hdsi, ChannelID, DSI_SET_PAGE_ADDRESS, Region->Y,
+                                  Region->Y + Region->Height - 1U);
+  }
+
+  if (status == HAL_OK)
+  {
+    /* Send one write memory command per line of the region */
+    hdsi->Instance->LCCR &= ~DSI_LCCR_CMDSIZE;
+    hdsi->Instance->LCCR |= Region->Width;
+  }
+
+  /* Process unlocked */
+  __HAL_UNLOCK(hdsi);
+
+  return status;
+}
+
+/**
+  * @brief  Refresh a region of the display in command mode on the next Tearing Effect
+  * @param  hdsi  pointer to a DSI_HandleTypeDef structure that contains
+  *               the configuration information for the DSI.
+  * @param  ChannelID  Virtual channel ID of the display.
+  * @param  Region  pointer to a DSI_RegionTypeDef structure that contains the region.
+  * @note   The region is set as with HAL_DSI_SetRefreshRegion(), then the refresh is started
+  *         by HAL_DSI_IRQHandler() on the next Tearing Effect interrupt, so the panel is
+  *         only updated out of its scan window, and HAL_DSI_EndOfRefreshCallback() is called
+  *         once the region is transferred.
+  * @note   The automatic refresh must be disabled: the display is only refreshed on request,
+  *         so the refresh rate follows the update rate of the application.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DSI_RefreshRegion(DSI_HandleTypeDef *hdsi, uint32_t ChannelID,
+                                        const DSI_RegionTypeDef *Region)
+{
+  HAL_StatusTypeDef status;
+
+  /* A region refresh is only possible in adapted command mode without automatic refresh */
+  if (((hdsi->Instance->WCFGR & DSI_WCFGR_DSIM) == 0U) || ((hdsi->Instance->WCFGR & DSI_WCFGR_AR) != 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  if (hdsi->RefreshRequest != 0U)
+  {
+    return HAL_BUSY;
+  }
+
+  status = HAL_DSI_SetRefreshRegion(hdsi, ChannelID, Region);
+
+  if (status == HAL_OK)
+  {
+    /* Request the refresh, started on the next Tearing Effect */
+    hdsi->RefreshRequest = 1U;
+    __HAL_DSI_ENABLE_IT(hdsi, DSI_IT_TE | DSI_IT_ER);
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Cancel a region refresh not yet started by the Tearing Effect
+  * @param  hdsi  pointer to a DSI_HandleTypeDef structure that contains
+  *               the configuration information for the DSI.
+  * @note   A refresh already started is not stopped and ends with the
+  *         HAL_DSI_EndOfRefreshCallback().
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DSI_AbortRefreshRegion(DSI_HandleTypeDef *hdsi)
+{
+  /* Process locked */
+  __HAL_LOCK(hdsi);
+
+  hdsi->RefreshRequest = 0U;
+
+  /* Process unlocked */
+  __HAL_UNLOCK(hdsi);
+
+  return HAL_OK;
+}
+
 /**
   * @brief  Controls the display color mode in Video mode
   * @param  hdsi  pointer to a DSI_HandleTypeDef structure that contains
@@ -35,6 +35,25 @@
 ================================================================================
   [..]
 
+  *** Thermal governor ***
+  ========================
+  [..]
+    The thermal governor steps the system between operating points of
+    decreasing frequency as the junction temperature rises, so that the
+    fastest operating point is used whenever it is thermally safe.
+      (#) Fill a table of DTS_OperatingPointTypeDef, from the fastest to the
+          slowest, with the temperature up to which each one can be used.
+      (#) Initialize the DTS with a periodic trigger (LPTIM) or continuous
+          measures and start it with HAL_DTS_Start_IT().
+      (#) Fill a DTS_GovernorTypeDef, Point being the operating point in use,
+          and call HAL_DTS_Governor_Start().
+      (#) Call HAL_DTS_Governor_ThresholdHandler() from the low and high
+          threshold callbacks (asynchronous ones with LSE reference clock).
+      (#) Call HAL_DTS_Governor_Process() from the main loop: the operating
+          point is switched there, out of the interrupt context, and the
+          thresholds are reprogrammed around the new operating point.
+      (#) HAL_DTS_GovernorCallback() is called after each change.
+
 
   @endverbatim
   ******************************************************************************
@@ -82,6 +101,10 @@
 #define DTS_FACTORY_TEMPERATURE1 (30UL)
 #define DTS_FACTORY_TEMPERATURE2 (130UL)
 
+/* @brief DTS threshold largest value
+ */
+#define DTS_THRESHOLD_MAX        (0xFFFFUL)
+
 /**
   * @}
   */
@@ -89,6 +112,7 @@
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
+static uint32_t DTS_TemperatureToThreshold(DTS_HandleTypeDef *hdts, int32_t Temperature);
 /* Exported functions --------------------------------------------------------*/
 
 /** @defgroup DTS_Exported_Functions DTS Exported Functions
@@ -755,6 +779,57 @@ HAL_StatusTypeDef HAL_DTS_GetTemperature(DTS_HandleTypeDef *hdts, int32_t *Tempe
   return HAL_OK;
 }
 
+/**
+  * @brief  Configure the low and high thresholds of the DTS from temperatures.
+  * @param  hdts             DTS handle
+  * @param  LowTemperature   Temperature in deg C below which the low threshold
+  *                          callback is called
+  * @param  HighTemperature  Temperature in deg C above which the high threshold
+  *                          callback is called
+  * @note   With PCLK reference clock the measure decreases when the temperature
+  *         rises: the low temperature is programmed in the high threshold and
+  *         the high temperature in the low threshold. The callbacks are swapped
+  *         the same way. The thresholds depend on the PCLK frequency and must
+  *         be configured again after a change of this frequency.
+  * @note   A temperature out of the measurable range disables its threshold.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DTS_ConfigThresholds(DTS_HandleTypeDef *hdts, int32_t LowTemperature, int32_t HighTemperature)
+{
+  uint32_t low_threshold;
+  uint32_t high_threshold;
+
+  /* Check the DTS handle allocation */
+  if (hdts == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  if ((LowTemperature > HighTemperature) || (hdts->Init.SamplingTime == 0UL) ||
+      ((hdts->Instance->RAMPVALR & DTS_RAMPVALR_TS1_RAMP_COEFF) == 0UL))
+  {
+    return HAL_ERROR;
+  }
+
+  if (hdts->Init.RefClock == DTS_REFCLKSEL_LSE)
+  {
+    low_threshold  = DTS_TemperatureToThreshold(hdts, LowTemperature);
+    high_threshold = DTS_TemperatureToThreshold(hdts, HighTemperature);
+  }
+  else
+  {
+    low_threshold  = DTS_TemperatureToThreshold(hdts, HighTemperature);
+    high_threshold = DTS_TemperatureToThreshold(hdts, LowTemperature);
+  }
+
+  hdts->Init.LowThreshold  = low_threshold;
+  hdts->Init.HighThreshold = high_threshold;
+
+  WRITE_REG(hdts->Instance->ITR1, (high_threshold << DTS_ITR1_TS1_HITTHD_Pos) | low_threshold);
+
+  return HAL_OK;
+}
+
 /**
   * @brief  DTS sensor IRQ Handler.
   * @param  hdts  DTS handle
@@ -963,6 +1038,203 @@ HAL_DTS_StateTypeDef HAL_DTS_GetState(DTS_HandleTypeDef *hdts)
   * @}
   */
 
+#if defined(HAL_PWR_MODULE_ENABLED)
+/** @defgroup DTS_Exported_Functions_Group4 Thermal governor functions
+ *  @brief   Thermal governor functions.
+ *
+@verbatim
+ ===============================================================================
+                      ##### Thermal governor functions #####
+ ===============================================================================
+    [..]
+    This subsection provides functions to switch between operating points
+    with HAL_PWREx_SwitchOperatingPoint() from the DTS threshold interrupts.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Start the thermal governor.
+  * @param  hgov  DTS governor
+  * @note   The operating point of the current temperature is applied and the
+  *         thresholds are configured around it.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DTS_Governor_Start(DTS_GovernorTypeDef *hgov)
+{
+  /* Check the governor allocation */
+  if ((hgov == NULL) || (hgov->hdts == NULL) || (hgov->pPoints == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  if ((hgov->NbPoints == 0UL) || (hgov->Point >= hgov->NbPoints) || (hgov->Hysteresis < 0))
+  {
+    return HAL_ERROR;
+  }
+
+  hgov->Pending = 1UL;
+
+  return HAL_DTS_Governor_Process(hgov);
+}
+
+/**
+  * @brief  Handle a DTS threshold interrupt for the thermal governor.
+  * @param  hgov  DTS governor
+  * @note   To be called from HAL_DTS_LowCallback() and HAL_DTS_HighCallback(),
+  *         or from their asynchronous versions with LSE reference clock.
+  * @retval None
+  */
+void HAL_DTS_Governor_ThresholdHandler(DTS_GovernorTypeDef *hgov)
+{
+  hgov->Pending = 1UL;
+}
+
+/**
+  * @brief  Update the operating point of the thermal governor.
+  * @param  hgov  DTS governor
+  * @note   To be called from the main loop, as switching the operating point
+  *         waits on HAL_GetTick(). Nothing is done if no threshold was crossed.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DTS_Governor_Process(DTS_GovernorTypeDef *hgov)
+{
+  const DTS_OperatingPointTypeDef *ppoint;
+  uint32_t point;
+  uint32_t previous = hgov->Point;
+  int32_t low_temperature;
+  int32_t high_temperature;
+
+  if (hgov->Pending == 0UL)
+  {
+    return HAL_OK;
+  }
+
+  hgov->Pending = 0UL;
+
+  if (HAL_DTS_GetTemperature(hgov->hdts, &hgov->Temperature) != HAL_OK)
+  {
+    /* Measure not available yet, try again on the next call */
+    hgov->Pending = 1UL;
+    return HAL_BUSY;
+  }
+
+  /* Slow down while the temperature is above the operating point limit */
+  point = hgov->Point;
+  while ((point < (hgov->NbPoints - 1UL)) && (hgov->Temperature >= hgov->pPoints[point].MaxTemperature))
+  {
+    point++;
+  }
+
+  /* Speed up while the temperature is low enough for the faster one */
+  while ((point > 0UL) && (hgov->Temperature < (hgov->pPoints[point - 1UL].MaxTemperature - hgov->Hysteresis)))
+  {
+    point--;
+  }
+
+  if (point != previous)
+  {
+    ppoint = &hgov->pPoints[point];
+
+    if (HAL_PWREx_SwitchOperatingPoint((RCC_ClkInitTypeDef *)&ppoint->ClkInit, ppoint->FLatency,
+                                       ppoint->CpuFrequency, ppoint->AhbFrequency) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+
+    hgov->Point = point;
+  }
+
+  /* Thresholds around the operating point, the PCLK frequency may have changed */
+  high_temperature = (point < (hgov->NbPoints - 1UL)) ? hgov->pPoints[point].MaxTemperature : INT16_MAX;
+  low_temperature  = (point > 0UL) ? (hgov->pPoints[point - 1UL].MaxTemperature - hgov->Hysteresis) : INT16_MIN;
+  if (low_temperature > high_temperature)
+  {
+    low_temperature = high_temperature;
+  }
+
+  if (HAL_DTS_ConfigThresholds(hgov->hdts, low_temperature, high_temperature) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  if (point != previous)
+  {
+    /* Operating point change callback */
+    HAL_DTS_GovernorCallback(hgov);
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  DTS governor operating point change callback.
+  * @param  hgov  DTS governor
+  * @retval None
+  */
+__weak void HAL_DTS_GovernorCallback(DTS_GovernorTypeDef *hgov)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hgov);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+  the HAL_DTS_GovernorCallback should be implemented in the user file
+  */
+}
+/**
+  * @}
+  */
+#endif /* HAL_PWR_MODULE_ENABLED */
+
+/**
+  * @}
+  */
+
+/** @defgroup DTS_Private_Functions DTS Private Functions
+  * @{
+  */
+
+/**
+  * @brief  Convert a temperature to a DTS threshold.
+  * @param  hdts         DTS handle
+  * @param  Temperature  Temperature in deg C
+  * @retval Threshold, saturated to the threshold range
+  */
+static uint32_t DTS_TemperatureToThreshold(DTS_HandleTypeDef *hdts, int32_t Temperature)
+{
+  int64_t freq;
+  uint64_t threshold;
+  uint32_t t0_temp;
+  uint32_t t0_freq;
+  uint32_t ramp_coeff;
+  uint32_t sampling = hdts->Init.SamplingTime >> DTS_CFGR1_TS1_SMP_TIME_Pos;
+
+  /* Read factory settings, as HAL_DTS_GetTemperature() */
+  t0_temp = ((hdts->Instance->T0VALR1 >> DTS_T0VALR1_TS1_T0_Pos) == 0UL) ? DTS_FACTORY_TEMPERATURE1 :
+            DTS_FACTORY_TEMPERATURE2;
+  t0_freq = (hdts->Instance->T0VALR1 & DTS_T0VALR1_TS1_FMT0) * 100UL; /* Hz */
+  ramp_coeff = hdts->Instance->RAMPVALR & DTS_RAMPVALR_TS1_RAMP_COEFF; /* Hz/deg C */
+
+  /* Sensor frequency at the temperature */
+  freq = (int64_t)t0_freq + (((int64_t)Temperature - (int64_t)t0_temp) * (int64_t)ramp_coeff);
+  if (freq < 1)
+  {
+    freq = 1;
+  }
+
+  if (hdts->Init.RefClock == DTS_REFCLKSEL_LSE)
+  {
+    threshold = ((uint64_t)freq * sampling) / LSE_VALUE;
+  }
+  else
+  {
+    threshold = ((uint64_t)HAL_RCCEx_GetD3PCLK1Freq() * sampling) / (uint64_t)freq;
+  }
+
+  return (threshold > DTS_THRESHOLD_MAX) ? DTS_THRESHOLD_MAX : (uint32_t)threshold;
+}
+
 /**
   * @}
   */
@@ -59,14 +59,44 @@
       (#) When data is received user can call the following API to get received data:
           (##) HAL_ETH_ReadData(): Read a received packet
 
+      (#) To reduce the number of Rx interrupts under load:
+          (##) HAL_ETH_SetRxInterruptWatchdog(): The Rx complete interrupt is generated by
+               the DMA Rx interrupt watchdog timer instead of each received packet
+          (##) HAL_ETH_EnableRxPolling(): HAL_ETH_IRQHandler() masks the Rx interrupt before
+               calling HAL_ETH_RxCpltCallback(). The stack then reads up to a budget of packets
+               with HAL_ETH_ReadData() and calls HAL_ETH_RxPollComplete() to unmask the Rx
+               interrupt when no packet is left, or polls again later otherwise
+
       (#) For transmission path, two APIs are available:
          (##) HAL_ETH_Transmit(): Transmit an ETH frame in blocking mode
          (##) HAL_ETH_Transmit_IT(): Transmit an ETH frame in interrupt mode,
               HAL_ETH_TxCpltCallback() will be executed when end of transfer occur
+         (##) HAL_ETH_TransmitBatch_IT(): Transmit several ETH frames in interrupt mode,
+              the descriptors of all the frames are prepared then the DMA is polled once and
+              HAL_ETH_TxCpltCallback() is executed when the last frame is sent
+         (##) HAL_ETH_TxQueueConfig(): Configure software Tx priority queues, served in
+              strict priority or weighted round-robin order. HAL_ETH_TxQueuePacket() adds a
+              frame to a queue and HAL_ETH_TxQueueSchedule(), called after
+              HAL_ETH_ReleaseTxPacket() in HAL_ETH_TxCpltCallback(), moves the pending frames
+              to the free Tx descriptors. The Tx descriptors ring being shared by all the
+              queues, a high priority frame only waits for the frames already in the ring
+         (##) HAL_ETH_GetRxDataVLANTag(): Get the VLAN tag stripped from the last received
+              frame, the priority (PCP) in its bits 15:13 can be used to steer the frames
+              in the application receive queues
 
       (#) Communication with an external PHY device:
          (##) HAL_ETH_ReadPHYRegister(): Read a register from an external PHY
          (##) HAL_ETH_WritePHYRegister(): Write data to an external RHY register
+         (##) HAL_ETH_MDIO_Submit(): Queue a non-blocking PHY register read or write.
+              The MAC has no MDIO completion interrupt: HAL_ETH_MDIO_Process(), called
+              periodically from a timer interrupt or from the main loop, completes the
+              command in progress without waiting, issues the next one and calls
+              HAL_ETH_MDIOCpltCallback() for each completed command
+         (##) HAL_ETH_MDIO_StartLinkPoll(): Read the PHY basic status register every
+              Interval ms through the same queue and call HAL_ETH_LinkStateChangeCallback()
+              when the link state changes. HAL_ETH_MDIO_StopLinkPoll() stops the poller
+         (##) The blocking HAL_ETH_ReadPHYRegister() and HAL_ETH_WritePHYRegister() return
+              HAL_ERROR while MDIO commands are queued
 
       (#) Configure the Ethernet MAC after ETH peripheral initialization
           (##) HAL_ETH_GetMACConfig(): Get MAC actual configuration into ETH_MACConfigTypeDef
@@ -86,6 +116,10 @@
           (##) HAL_ETH_PTP_InsertTxTimestamp(): Insert Timestamp in transmission
           (##) HAL_ETH_PTP_GetTxTimestamp(): Get transmission timestamp
           (##) HAL_ETH_PTP_GetRxTimestamp(): Get reception timestamp
+          (##) HAL_ETH_PTP_SetTimestampRing(): Deliver the Tx and Rx timestamps with their packet
+               cookie into an application ring, read with HAL_ETH_PTP_GetRingTimestamp()
+          (##) HAL_ETH_PTP_ServoUpdate(): Correct the PTP clock from a measured offset (PI servo
+               on the addend in fine update mode, time step above a threshold)
 
       -@- The ARP offload feature is not supported in this driver.
 
@@ -222,6 +256,11 @@
 #define ETH_MACSTSUR_VALUE            0xFFFFFFFFU
 #define ETH_MACSTNUR_VALUE            0xBB9ACA00U
 #define ETH_SEGMENT_SIZE_DEFAULT      0x218U
+#define ETH_PTP_UPDATE_TIMEOUT        10U
+
+/* IEEE 802.3 clause 22 basic status register, polled by the link poller */
+#define ETH_PHY_BSR                   0x01U
+#define ETH_PHY_BSR_LINK_STATUS       0x0004U
 /**
   * @}
   */
@@ -256,7 +295,13 @@ static void ETH_MACDMAConfig(ETH_HandleTypeDef *heth);
 static void ETH_DMATxDescListInit(ETH_HandleTypeDef *heth);
 static void ETH_DMARxDescListInit(ETH_HandleTypeDef *heth);
 static uint32_t ETH_Prepare_Tx_Descriptors(ETH_HandleTypeDef *heth, ETH_TxPacketConfig *pTxConfig, uint32_t ItMode);
+#ifdef HAL_ETH_USE_PTP
+static void ETH_PTP_PushTimestamp(ETH_HandleTypeDef *heth, uint32_t *pCookie, uint32_t Direction,
+                                  uint32_t TimeStampLow, uint32_t TimeStampHigh);
+#endif /* HAL_ETH_USE_PTP */
 static void ETH_UpdateDescriptor(ETH_HandleTypeDef *heth);
+static void ETH_MDIOIssue(ETH_HandleTypeDef *heth);
+static void ETH_MDIOLinkPollCplt(ETH_HandleTypeDef *heth);
 
 #if (USE_HAL_ETH_REGISTER_CALLBACKS == 1)
 static void ETH_InitCallbacksToDefault(ETH_HandleTypeDef *heth);
@@ -410,6 +455,14 @@ HAL_StatusTypeDef HAL_ETH_Init(ETH_HandleTypeDef *heth)
   heth->Instance->MACA0LR = (((uint32_t)(heth->Init.MACAddr[3]) << 24) | ((uint32_t)(heth->Init.MACAddr[2]) << 16) |
                              ((uint32_t)(heth->Init.MACAddr[1]) << 8) | (uint32_t)heth->Init.MACAddr[0]);
 
+  /* Init the MDIO engine and the link poller */
+  heth->pMDIOHead = NULL;
+  heth->pMDIOTail = NULL;
+  heth->MDIOStarted = 0U;
+  heth->LinkPollCmd.Status = ETH_MDIO_CMD_DONE;
+  heth->LinkPollInterval = 0U;
+  heth->LinkState = ETH_LINK_STATE_UNKNOWN;
+
   heth->ErrorCode = HAL_ETH_ERROR_NONE;
   heth->gState = HAL_ETH_STATE_READY;
 
@@ -1027,6 +1080,277 @@ HAL_StatusTypeDef HAL_ETH_Transmit_IT(ETH_HandleTypeDef *heth, ETH_TxPacketConfi
   }
 }
 
+/**
+  * @brief  Sends several Ethernet Packets in interrupt mode.
+  * @note   The descriptors of the packets are prepared in the array order (each packet
+  *         with its own checksum insertion, VLAN and TCP segmentation attributes) and
+  *         the Tx DMA tail pointer is written once. The interrupt on completion is only
+  *         requested on the last queued packet: the sent packets are released by
+  *         HAL_ETH_ReleaseTxPacket() as for HAL_ETH_Transmit_IT().
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  pTxConfig: Array of NbPackets packets configuration to be transmitted
+  * @param  NbPackets: Number of packets in the array
+  * @param  pNbQueued: Number of packets queued for transmission, when all the packets
+  *         cannot be queued (not enough free descriptors) the first ones are sent
+  *         and HAL_ERROR is returned. Can be NULL.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ETH_TransmitBatch_IT(ETH_HandleTypeDef *heth, ETH_TxPacketConfig *pTxConfig,
+                                           uint32_t NbPackets, uint32_t *pNbQueued)
+{
+  uint32_t pktidx;
+  uint32_t descidx;
+  ETH_DMADescTypeDef *dmatxdesc;
+  HAL_StatusTypeDef status = HAL_OK;
+
+  if ((pTxConfig == NULL) || (NbPackets == 0U))
+  {
+    heth->ErrorCode |= HAL_ETH_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  if (heth->gState != HAL_ETH_STATE_STARTED)
+  {
+    return HAL_ERROR;
+  }
+
+  for (pktidx = 0U; pktidx < NbPackets; pktidx++)
+  {
+    /* Save the packet pointer to release.  */
+    heth->TxDescList.CurrentPacketAddress = (uint32_t *)pTxConfig[pktidx].pData;
+
+    /* Config DMA Tx descriptor by Tx Packet info, interrupt on the last packet only */
+    if (ETH_Prepare_Tx_Descriptors(heth, &pTxConfig[pktidx], ((pktidx + 1U) == NbPackets) ? 1U : 0U)
+        != HAL_ETH_ERROR_NONE)
+    {
+      heth->ErrorCode |= HAL_ETH_ERROR_BUSY;
+      status = HAL_ERROR;
+      break;
+    }
+
+    /* Incr current tx desc index */
+    INCR_TX_DESC_INDEX(heth->TxDescList.CurTxDesc, 1U);
+  }
+
+  if (pktidx != 0U)
+  {
+    if (pktidx != NbPackets)
+    {
+      /* Last queued packet: request the interrupt on completion on its last descriptor */
+      descidx = heth->TxDescList.CurTxDesc;
+      INCR_TX_DESC_INDEX(descidx, (ETH_TX_DESC_CNT - 1U));
+      dmatxdesc = (ETH_DMADescTypeDef *)heth->TxDescList.TxDesc[descidx];
+      SET_BIT(dmatxdesc->DESC2, ETH_DMATXNDESCRF_IOC);
+    }
+
+    /* Ensure completion of descriptor preparation before transmission start */
+    __DSB();
+
+    /* Start transmission */
+    /* issue a poll command to Tx DMA by writing address of next immediate free descriptor */
+    WRITE_REG(heth->Instance->DMACTDTPR, (uint32_t)(heth->TxDescList.TxDesc[heth->TxDescList.CurTxDesc]));
+  }
+
+  if (pNbQueued != NULL)
+  {
+    *pNbQueued = pktidx;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Configure the Tx priority queues.
+  * @note   The queues are software queues in front of the Tx descriptors ring: the
+  *         ETH DMA has a single Tx channel. Queue 0 has the highest priority.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  pQueues: Array of NbQueues queues, their pPackets, Size and Weight fields
+  *         are set by the application. NULL to stop using the queues.
+  * @param  NbQueues: Number of queues
+  * @param  SchedMode: Scheduling mode, a value of @ref ETH_Tx_Scheduling_Mode
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ETH_TxQueueConfig(ETH_HandleTypeDef *heth, ETH_TxPrioQueueTypeDef *pQueues,
+                                        uint32_t NbQueues, uint32_t SchedMode)
+{
+  uint32_t qidx;
+
+  if (pQueues == NULL)
+  {
+    heth->pTxPrioQueues = NULL;
+    heth->TxPrioQueueCnt = 0U;
+    return HAL_OK;
+  }
+
+  if ((NbQueues == 0U) || ((SchedMode != ETH_TX_SCHED_STRICT_PRIORITY) && (SchedMode != ETH_TX_SCHED_WEIGHTED_RR)))
+  {
+    heth->ErrorCode |= HAL_ETH_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  for (qidx = 0U; qidx < NbQueues; qidx++)
+  {
+    if ((pQueues[qidx].pPackets == NULL) || (pQueues[qidx].Size < 2U)
+        || ((SchedMode == ETH_TX_SCHED_WEIGHTED_RR) && (pQueues[qidx].Weight == 0U)))
+    {
+      heth->ErrorCode |= HAL_ETH_ERROR_PARAM;
+      return HAL_ERROR;
+    }
+
+    pQueues[qidx].Head = 0U;
+    pQueues[qidx].Tail = 0U;
+    pQueues[qidx].Credit = pQueues[qidx].Weight;
+  }
+
+  heth->TxSchedMode = SchedMode;
+  heth->TxSchedQueueIdx = 0U;
+  heth->TxPrioQueueCnt = NbQueues;
+  heth->pTxPrioQueues = pQueues;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Queue an Ethernet packet in a Tx priority queue and schedule the transmission.
+  * @note   The packet configuration and buffers must remain valid until the packet is
+  *         released by HAL_ETH_ReleaseTxPacket().
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  Queue: Index of the queue, 0 is the highest priority
+  * @param  pTxConfig: Hold the configuration of packet to be transmitted
+  * @retval HAL status, HAL_ERROR when the queue is full
+  */
+HAL_StatusTypeDef HAL_ETH_TxQueuePacket(ETH_HandleTypeDef *heth, uint32_t Queue, ETH_TxPacketConfig *pTxConfig)
+{
+  ETH_TxPrioQueueTypeDef *queue;
+  uint32_t nexthead;
+  uint32_t primask_bit;
+
+  if ((pTxConfig == NULL) || (heth->pTxPrioQueues == NULL) || (Queue >= heth->TxPrioQueueCnt))
+  {
+    heth->ErrorCode |= HAL_ETH_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  queue = &heth->pTxPrioQueues[Queue];
+
+  /* Enter critical section: the queue is also read by HAL_ETH_TxQueueSchedule() */
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  nexthead = (queue->Head + 1U) % queue->Size;
+  if (nexthead == queue->Tail)
+  {
+    __set_PRIMASK(primask_bit);
+    heth->ErrorCode |= HAL_ETH_ERROR_BUSY;
+    return HAL_ERROR;
+  }
+
+  queue->pPackets[queue->Head] = pTxConfig;
+  queue->Head = nexthead;
+
+  /* Exit critical section */
+  __set_PRIMASK(primask_bit);
+
+  return HAL_ETH_TxQueueSchedule(heth);
+}
+
+/**
+  * @brief  Move the pending packets of the Tx priority queues to the free Tx descriptors.
+  * @note   The Tx DMA tail pointer is written once. To be called after
+  *         HAL_ETH_ReleaseTxPacket() in HAL_ETH_TxCpltCallback() to send the packets
+  *         left pending when the Tx descriptors ring was full.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ETH_TxQueueSchedule(ETH_HandleTypeDef *heth)
+{
+  ETH_TxPrioQueueTypeDef *queue;
+  ETH_TxPacketConfig *txconfig;
+  uint32_t qidx;
+  uint32_t scanned = 0U;
+  uint32_t nbqueued = 0U;
+  uint32_t primask_bit;
+
+  if ((heth->pTxPrioQueues == NULL) || (heth->gState != HAL_ETH_STATE_STARTED))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Enter critical section */
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  /* Stop when all the queues are empty or when the Tx descriptors ring is full */
+  while (scanned < heth->TxPrioQueueCnt)
+  {
+    if (heth->TxSchedMode == ETH_TX_SCHED_STRICT_PRIORITY)
+    {
+      /* Restart from the highest priority queue after each packet */
+      qidx = scanned;
+    }
+    else
+    {
+      qidx = heth->TxSchedQueueIdx;
+    }
+    queue = &heth->pTxPrioQueues[qidx];
+
+    if ((queue->Head == queue->Tail)
+        || ((heth->TxSchedMode == ETH_TX_SCHED_WEIGHTED_RR) && (queue->Credit == 0U)))
+    {
+      if (heth->TxSchedMode == ETH_TX_SCHED_WEIGHTED_RR)
+      {
+        /* End of the queue round */
+        queue->Credit = queue->Weight;
+        heth->TxSchedQueueIdx = (qidx + 1U) % heth->TxPrioQueueCnt;
+      }
+      scanned++;
+    }
+    else
+    {
+      txconfig = queue->pPackets[queue->Tail];
+
+      /* Save the packet pointer to release.  */
+      heth->TxDescList.CurrentPacketAddress = (uint32_t *)txconfig->pData;
+
+      if (ETH_Prepare_Tx_Descriptors(heth, txconfig, 1U) != HAL_ETH_ERROR_NONE)
+      {
+        /* Tx descriptors ring full: sent on the next call */
+        break;
+      }
+
+      /* Incr current tx desc index */
+      INCR_TX_DESC_INDEX(heth->TxDescList.CurTxDesc, 1U);
+
+      queue->Tail = (queue->Tail + 1U) % queue->Size;
+      if (heth->TxSchedMode == ETH_TX_SCHED_WEIGHTED_RR)
+      {
+        queue->Credit--;
+      }
+      nbqueued++;
+      scanned = 0U;
+    }
+  }
+
+  if (nbqueued != 0U)
+  {
+    /* Ensure completion of descriptor preparation before transmission start */
+    __DSB();
+
+    /* Start transmission */
+    /* issue a poll command to Tx DMA by writing address of next immediate free descriptor */
+    WRITE_REG(heth->Instance->DMACTDTPR, (uint32_t)(heth->TxDescList.TxDesc[heth->TxDescList.CurTxDesc]));
+  }
+
+  /* Exit critical section */
+  __set_PRIMASK(primask_bit);
+
+  return HAL_OK;
+}
+
 /**
   * @brief  Read a received packet.
   * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
@@ -1042,6 +1366,9 @@ HAL_StatusTypeDef HAL_ETH_ReadData(ETH_HandleTypeDef *heth, void **pAppBuff)
   uint32_t desccntmax;
   uint32_t bufflength;
   uint8_t rxdataready = 0U;
+#ifdef HAL_ETH_USE_PTP
+  uint8_t rxtsavailable = 0U;
+#endif /* HAL_ETH_USE_PTP */
 
 
   if (pAppBuff == NULL)
@@ -1069,6 +1396,14 @@ HAL_StatusTypeDef HAL_ETH_ReadData(ETH_HandleTypeDef *heth, void **pAppBuff)
       heth->RxDescList.TimeStamp.TimeStampHigh = dmarxdesc->DESC1;
       /* Get timestamp low */
       heth->RxDescList.TimeStamp.TimeStampLow  = dmarxdesc->DESC0;
+#ifdef HAL_ETH_USE_PTP
+      if (heth->pPtpRxCookie != NULL)
+      {
+        /* Deliver the timestamp of the previous packet */
+        ETH_PTP_PushTimestamp(heth, heth->pPtpRxCookie, ETH_PTP_TIMESTAMP_RX, dmarxdesc->DESC0, dmarxdesc->DESC1);
+        heth->pPtpRxCookie = NULL;
+      }
+#endif /* HAL_ETH_USE_PTP */
     }
     if ((READ_BIT(dmarxdesc->DESC3, ETH_DMARXNDESCWBF_FD) != (uint32_t)RESET) || (heth->RxDescList.pRxStart != NULL))
     {
@@ -1088,6 +1423,18 @@ HAL_StatusTypeDef HAL_ETH_ReadData(ETH_HandleTypeDef *heth, void **pAppBuff)
         /* Save Last descriptor index */
         heth->RxDescList.pRxLastRxDesc = dmarxdesc->DESC3;
 
+        /* Save the stripped outer VLAN tag, valid when RS0V is set */
+        heth->RxDescList.RxLastVlanTag = READ_BIT(dmarxdesc->DESC0, ETH_DMARXNDESCWBF_OVT);
+
+#ifdef HAL_ETH_USE_PTP
+        /* A context descriptor with the timestamp follows the last descriptor */
+        if ((READ_BIT(dmarxdesc->DESC3, ETH_DMARXNDESCWBF_RS1V) != (uint32_t)RESET)
+            && (READ_BIT(dmarxdesc->DESC1, ETH_DMARXNDESCWBF_TSA) != (uint32_t)RESET))
+        {
+          rxtsavailable = 1U;
+        }
+#endif /* HAL_ETH_USE_PTP */
+
         /* Packet ready */
         rxdataready = 1;
       }
@@ -1127,6 +1474,13 @@ HAL_StatusTypeDef HAL_ETH_ReadData(ETH_HandleTypeDef *heth, void **pAppBuff)
 
   if (rxdataready == 1U)
   {
+#ifdef HAL_ETH_USE_PTP
+    if ((heth->pPtpTsRing != NULL) && (rxtsavailable != 0U))
+    {
+      /* Timestamp delivered when its context descriptor is read */
+      heth->pPtpRxCookie = (uint32_t *)heth->RxDescList.pRxStart;
+    }
+#endif /* HAL_ETH_USE_PTP */
     /* Return received packet */
     *pAppBuff = heth->RxDescList.pRxStart;
     /* Reset first element */
@@ -1139,6 +1493,55 @@ HAL_StatusTypeDef HAL_ETH_ReadData(ETH_HandleTypeDef *heth, void **pAppBuff)
   return HAL_ERROR;
 }
 
+/**
+  * @brief  Enable the Rx polling mode.
+  * @note   In this mode the Rx interrupt is masked by HAL_ETH_IRQHandler() before
+  *         HAL_ETH_RxCpltCallback() is called: the packets are then read with
+  *         HAL_ETH_ReadData() until HAL_ETH_RxPollComplete() is called.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ETH_EnableRxPolling(ETH_HandleTypeDef *heth)
+{
+  heth->RxPollMode = 1U;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Disable the Rx polling mode and unmask the Rx interrupt.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ETH_DisableRxPolling(ETH_HandleTypeDef *heth)
+{
+  heth->RxPollMode = 0U;
+
+  return HAL_ETH_RxPollComplete(heth);
+}
+
+/**
+  * @brief  End a polling round: unmask the Rx interrupt.
+  * @note   A packet received while the interrupt was masked keeps the Rx status
+  *         flag set: the interrupt is then generated as soon as it is unmasked.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ETH_RxPollComplete(ETH_HandleTypeDef *heth)
+{
+  if ((heth->gState != HAL_ETH_STATE_STARTED) || (heth->RxDescList.ItMode == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  __HAL_ETH_DMA_ENABLE_IT(heth, ETH_DMACIER_RIE);
+
+  return HAL_OK;
+}
+
 /**
   * @brief  This function gives back Rx Desc of the last received Packet
   *         to the DMA, so ETH DMA will be able to use these descriptors
@@ -1188,7 +1591,7 @@ static void ETH_UpdateDescriptor(ETH_HandleTypeDef *heth)
       /* Ensure rest of descriptor is written to RAM before the OWN bit */
       __DMB();
 
-      if (heth->RxDescList.ItMode != 0U)
+      if ((heth->RxDescList.ItMode != 0U) && (heth->RxDescList.RxIntWatchdog == 0U))
       {
         WRITE_REG(dmarxdesc->DESC3, ETH_DMARXNDESCRF_OWN | ETH_DMARXNDESCRF_BUF1V | ETH_DMARXNDESCRF_IOC);
       }
@@ -1335,6 +1738,28 @@ HAL_StatusTypeDef HAL_ETH_GetRxDataErrorCode(ETH_HandleTypeDef *heth, uint32_t *
   return HAL_OK;
 }
 
+/**
+  * @brief  Get the VLAN tag of the last received packet.
+  * @note   The tag is available when the outer VLAN tag stripping is enabled
+  *         (EVLS field of the MACVTR register), the priority code point is in
+  *         bits 15:13 of the tag.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  pVlanTag: pointer to uint32_t to hold the outer VLAN tag
+  * @retval HAL status, HAL_ERROR when no VLAN tag was stripped from the packet
+  */
+HAL_StatusTypeDef HAL_ETH_GetRxDataVLANTag(ETH_HandleTypeDef *heth, uint32_t *pVlanTag)
+{
+  if (READ_BIT(heth->RxDescList.pRxLastRxDesc, ETH_DMARXNDESCWBF_RS0V) == 0U)
+  {
+    return HAL_ERROR;
+  }
+
+  *pVlanTag = heth->RxDescList.RxLastVlanTag;
+
+  return HAL_OK;
+}
+
 /**
   * @brief  Set the Tx free function.
   * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
@@ -1427,6 +1852,12 @@ HAL_StatusTypeDef HAL_ETH_ReleaseTxPacket(ETH_HandleTypeDef *heth)
         timestamp->TimeStampLow = heth->Init.TxDesc[idx].DESC0;
         /* Get timestamp high */
         timestamp->TimeStampHigh = heth->Init.TxDesc[idx].DESC1;
+
+        if (READ_BIT(heth->Init.TxDesc[idx].DESC3, ETH_DMATXNDESCWBF_TTSS) != (uint32_t)RESET)
+        {
+          ETH_PTP_PushTimestamp(heth, dmatxdesclist->PacketAddress[idx], ETH_PTP_TIMESTAMP_TX,
+                                timestamp->TimeStampLow, timestamp->TimeStampHigh);
+        }
 #endif /* HAL_ETH_USE_PTP */
 
 #if (USE_HAL_ETH_REGISTER_CALLBACKS == 1)
@@ -1809,51 +2240,245 @@ HAL_StatusTypeDef HAL_ETH_UnRegisterTxPtpCallback(ETH_HandleTypeDef *heth)
 }
 
 /**
-  * @brief  Tx Ptp callback.
-  * @param  buff: pointer to application buffer
-  * @retval None
-  */
-__weak void HAL_ETH_TxPtpCallback(uint32_t *buff, ETH_TimeStampTypeDef *timestamp)
-{
-  /* Prevent unused argument(s) compilation warning */
-  UNUSED(buff);
-  /* NOTE : This function Should not be modified, when the callback is needed,
-  the HAL_ETH_TxPtpCallback could be implemented in the user file
-  */
-}
-#endif  /* HAL_ETH_USE_PTP */
-
-/**
-  * @brief  This function handles ETH interrupt request.
+  * @brief  Set the ring receiving the Tx and Rx timestamps.
+  * @note   Each timestamp captured by the MAC is written in the ring with the
+  *         cookie of its packet when the packet is released (Tx, in
+  *         HAL_ETH_ReleaseTxPacket()) or read (Rx, in HAL_ETH_ReadData()).
+  *         The driver is the only writer of the Head index and the application
+  *         the only writer of the Tail index: no lock is needed as long as the
+  *         ring is read from a single context.
   * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
   *         the configuration information for ETHERNET module
+  * @param  pRing: pointer to the ring structure, NULL to stop the delivery
+  * @param  pEntries: application array of Size entries
+  * @param  Size: number of entries, must be a power of 2
   * @retval HAL status
   */
-void HAL_ETH_IRQHandler(ETH_HandleTypeDef *heth)
+HAL_StatusTypeDef HAL_ETH_PTP_SetTimestampRing(ETH_HandleTypeDef *heth, ETH_PtpTimestampRingTypeDef *pRing,
+                                               ETH_PtpTimestampEntryTypeDef *pEntries, uint32_t Size)
 {
-  uint32_t macirqenable;
-  /* Packet received */
-  if (__HAL_ETH_DMA_GET_IT(heth, ETH_DMACSR_RI))
+  if (pRing == NULL)
   {
-    if (__HAL_ETH_DMA_GET_IT_SOURCE(heth, ETH_DMACIER_RIE))
-    {
-      /* Clear the Eth DMA Rx IT pending bits */
-      __HAL_ETH_DMA_CLEAR_IT(heth, ETH_DMACSR_RI | ETH_DMACSR_NIS);
-
-#if (USE_HAL_ETH_REGISTER_CALLBACKS == 1)
-      /*Call registered Receive complete callback*/
-      heth->RxCpltCallback(heth);
-#else
-      /* Receive complete callback */
-      HAL_ETH_RxCpltCallback(heth);
-#endif  /* USE_HAL_ETH_REGISTER_CALLBACKS */
-    }
+    heth->pPtpTsRing = NULL;
+    heth->pPtpRxCookie = NULL;
+    return HAL_OK;
   }
 
-  /* Packet transmitted */
-  if (__HAL_ETH_DMA_GET_IT(heth, ETH_DMACSR_TI))
+  if ((pEntries == NULL) || (Size == 0U) || ((Size & (Size - 1U)) != 0U))
   {
-    if (__HAL_ETH_DMA_GET_IT_SOURCE(heth, ETH_DMACIER_TIE))
+    heth->ErrorCode |= HAL_ETH_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  pRing->pEntries = pEntries;
+  pRing->Size = Size;
+  pRing->Head = 0U;
+  pRing->Tail = 0U;
+  pRing->Overflow = 0U;
+
+  heth->pPtpRxCookie = NULL;
+  heth->pPtpTsRing = pRing;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Get the oldest timestamp of the ring.
+  * @param  pRing: pointer to the ring structure
+  * @param  pEntry: pointer to the entry receiving the timestamp and its packet cookie
+  * @retval HAL status: HAL_ERROR when the ring is empty
+  */
+HAL_StatusTypeDef HAL_ETH_PTP_GetRingTimestamp(ETH_PtpTimestampRingTypeDef *pRing,
+                                               ETH_PtpTimestampEntryTypeDef *pEntry)
+{
+  uint32_t tail;
+
+  if ((pRing == NULL) || (pEntry == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  tail = pRing->Tail;
+  if (tail == pRing->Head)
+  {
+    /* Ring empty */
+    return HAL_ERROR;
+  }
+
+  /* Read the entry before releasing it to the driver */
+  __DMB();
+  *pEntry = pRing->pEntries[tail & (pRing->Size - 1U)];
+  __DMB();
+  pRing->Tail = tail + 1U;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Correct the PTP clock from a measured offset.
+  * @note   When the offset is lower than the step threshold, the frequency is slewed
+  *         by a PI servo on the timestamp addend (fine update mode is required).
+  *         Otherwise the time is stepped with HAL_ETH_PTP_AddTimeOffset() and the
+  *         servo integral term is reset.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  pServo: pointer to the servo state and configuration
+  * @param  OffsetNs: local clock minus reference clock, in ns
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ETH_PTP_ServoUpdate(ETH_HandleTypeDef *heth, ETH_PtpServoTypeDef *pServo, int32_t OffsetNs)
+{
+  ETH_TimeTypeDef timeoffset;
+  uint32_t absoffset;
+  int64_t freq;
+  int64_t limit;
+  uint32_t tickstart;
+
+  if (pServo == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  if (heth->IsPtpConfigured != HAL_ETH_PTP_CONFIGURATED)
+  {
+    return HAL_ERROR;
+  }
+
+  absoffset = (OffsetNs < 0) ? (0U - (uint32_t)OffsetNs) : (uint32_t)OffsetNs;
+
+  if (absoffset >= pServo->StepThreshold)
+  {
+    /* Step the time by the opposite of the offset */
+    timeoffset.Seconds = absoffset / 1000000000U;
+    timeoffset.NanoSeconds = absoffset % 1000000000U;
+    if (HAL_ETH_PTP_AddTimeOffset(heth, (OffsetNs > 0) ? HAL_ETH_PTP_NEGATIVE_UPDATE : HAL_ETH_PTP_POSITIVE_UPDATE,
+                                  &timeoffset) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+
+    /* Apply the update */
+    SET_BIT(heth->Instance->MACTSCR, ETH_MACTSCR_TSUPDT);
+    tickstart = HAL_GetTick();
+    while (READ_BIT(heth->Instance->MACTSCR, ETH_MACTSCR_TSUPDT) != 0U)
+    {
+      if ((HAL_GetTick() - tickstart) > ETH_PTP_UPDATE_TIMEOUT)
+      {
+        heth->ErrorCode |= HAL_ETH_ERROR_TIMEOUT;
+        return HAL_ERROR;
+      }
+    }
+
+    pServo->Integral = 0;
+    return HAL_OK;
+  }
+
+  if (READ_BIT(heth->Instance->MACTSCR, ETH_MACTSCR_TSCFUPDT) == 0U)
+  {
+    /* Coarse update mode: the addend is not used */
+    return HAL_ERROR;
+  }
+
+  /* PI servo: frequency correction in 1/65536 ppb, opposite to the offset */
+  limit = (int64_t)pServo->MaxFreqPpb * 65536;
+  pServo->Integral += (int64_t)pServo->Ki * OffsetNs;
+  if (pServo->Integral > limit)
+  {
+    pServo->Integral = limit;
+  }
+  else if (pServo->Integral < -limit)
+  {
+    pServo->Integral = -limit;
+  }
+  else
+  {
+    /* Integral term within the limits */
+  }
+
+  freq = -(((int64_t)pServo->Kp * OffsetNs) + pServo->Integral);
+  if (freq > limit)
+  {
+    freq = limit;
+  }
+  else if (freq < -limit)
+  {
+    freq = -limit;
+  }
+  else
+  {
+    /* Correction within the limits */
+  }
+  pServo->FreqPpb = (int32_t)(freq / 65536);
+
+  /* Addend scaled by the frequency correction */
+  WRITE_REG(heth->Instance->MACTSAR,
+            (uint32_t)((int64_t)pServo->Addend + (((int64_t)pServo->Addend * pServo->FreqPpb) / 1000000000)));
+  SET_BIT(heth->Instance->MACTSCR, ETH_MACTSCR_TSADDREG);
+  tickstart = HAL_GetTick();
+  while (READ_BIT(heth->Instance->MACTSCR, ETH_MACTSCR_TSADDREG) != 0U)
+  {
+    if ((HAL_GetTick() - tickstart) > ETH_PTP_UPDATE_TIMEOUT)
+    {
+      heth->ErrorCode |= HAL_ETH_ERROR_TIMEOUT;
+      return HAL_ERROR;
+    }
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Tx Ptp callback.
+  * @param  buff: pointer to application buffer
+  * @retval None
+  */
+__weak void HAL_ETH_TxPtpCallback(uint32_t *buff, ETH_TimeStampTypeDef *timestamp)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(buff);
+  /* NOTE : This function Should not be modified, when the callback is needed,
+  the HAL_ETH_TxPtpCallback could be implemented in the user file
+  */
+}
+#endif  /* HAL_ETH_USE_PTP */
+
+/**
+  * @brief  This function handles ETH interrupt request.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @retval HAL status
+  */
+void HAL_ETH_IRQHandler(ETH_HandleTypeDef *heth)
+{
+  uint32_t macirqenable;
+  /* Packet received */
+  if (__HAL_ETH_DMA_GET_IT(heth, ETH_DMACSR_RI))
+  {
+    if (__HAL_ETH_DMA_GET_IT_SOURCE(heth, ETH_DMACIER_RIE))
+    {
+      /* Clear the Eth DMA Rx IT pending bits */
+      __HAL_ETH_DMA_CLEAR_IT(heth, ETH_DMACSR_RI | ETH_DMACSR_NIS);
+
+      if (heth->RxPollMode != 0U)
+      {
+        /* Polling mode: Rx interrupt masked until HAL_ETH_RxPollComplete() */
+        __HAL_ETH_DMA_DISABLE_IT(heth, ETH_DMACIER_RIE);
+      }
+
+#if (USE_HAL_ETH_REGISTER_CALLBACKS == 1)
+      /*Call registered Receive complete callback*/
+      heth->RxCpltCallback(heth);
+#else
+      /* Receive complete callback */
+      HAL_ETH_RxCpltCallback(heth);
+#endif  /* USE_HAL_ETH_REGISTER_CALLBACKS */
+    }
+  }
+
+  /* Packet transmitted */
+  if (__HAL_ETH_DMA_GET_IT(heth, ETH_DMACSR_TI))
+  {
+    if (__HAL_ETH_DMA_GET_IT_SOURCE(heth, ETH_DMACIER_TIE))
     {
       /* Clear the Eth DMA Tx IT pending bits */
       __HAL_ETH_DMA_CLEAR_IT(heth, ETH_DMACSR_TI | ETH_DMACSR_NIS);
@@ -2121,8 +2746,8 @@ HAL_StatusTypeDef HAL_ETH_ReadPHYRegister(ETH_HandleTypeDef *heth, uint32_t PHYA
   uint32_t tickstart;
   uint32_t tmpreg;
 
-  /* Check for the Busy flag */
-  if (READ_BIT(heth->Instance->MACMDIOAR, ETH_MACMDIOAR_MB) != (uint32_t)RESET)
+  /* Check for the Busy flag and for queued MDIO commands */
+  if ((READ_BIT(heth->Instance->MACMDIOAR, ETH_MACMDIOAR_MB) != (uint32_t)RESET) || (heth->pMDIOHead != NULL))
   {
     return HAL_ERROR;
   }
@@ -2177,8 +2802,8 @@ HAL_StatusTypeDef HAL_ETH_WritePHYRegister(ETH_HandleTypeDef *heth, uint32_t PHY
   uint32_t tickstart;
   uint32_t tmpreg;
 
-  /* Check for the Busy flag */
-  if (READ_BIT(heth->Instance->MACMDIOAR, ETH_MACMDIOAR_MB) != (uint32_t)RESET)
+  /* Check for the Busy flag and for queued MDIO commands */
+  if ((READ_BIT(heth->Instance->MACMDIOAR, ETH_MACMDIOAR_MB) != (uint32_t)RESET) || (heth->pMDIOHead != NULL))
   {
     return HAL_ERROR;
   }
@@ -2218,6 +2843,226 @@ HAL_StatusTypeDef HAL_ETH_WritePHYRegister(ETH_HandleTypeDef *heth, uint32_t PHY
   return HAL_OK;
 }
 
+/**
+  * @brief  Queue a non-blocking PHY register read or write.
+  * @note   The command is issued at once when the MDIO bus is idle, otherwise by
+  *         HAL_ETH_MDIO_Process() after the commands queued before it.
+  *         pCmd is owned by the driver until its Status leaves ETH_MDIO_CMD_PENDING;
+  *         for a read, Value then holds the register value.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  pCmd: pointer to an application ETH_MDIOCmdTypeDef structure
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ETH_MDIO_Submit(ETH_HandleTypeDef *heth, ETH_MDIOCmdTypeDef *pCmd)
+{
+  uint32_t primask;
+
+  if ((pCmd == NULL) || (pCmd->PHYAddr > 31U) || (pCmd->PHYReg > 31U) ||
+      ((pCmd->Operation != ETH_MDIO_OP_READ) && (pCmd->Operation != ETH_MDIO_OP_WRITE)))
+  {
+    heth->ErrorCode |= HAL_ETH_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  if (pCmd->Status == ETH_MDIO_CMD_PENDING)
+  {
+    return HAL_BUSY;
+  }
+
+  pCmd->Status = ETH_MDIO_CMD_PENDING;
+  pCmd->pNext = NULL;
+
+  /* The queue is also updated by HAL_ETH_MDIO_Process() from interrupt context */
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  if (heth->pMDIOHead == NULL)
+  {
+    heth->pMDIOHead = pCmd;
+    heth->pMDIOTail = pCmd;
+    heth->MDIOStarted = 0U;
+    ETH_MDIOIssue(heth);
+  }
+  else
+  {
+    heth->pMDIOTail->pNext = pCmd;
+    heth->pMDIOTail = pCmd;
+  }
+
+  __set_PRIMASK(primask);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Run the MDIO engine and the link poller.
+  * @note   Never waits on the MDIO bus. To be called periodically, e.g. from a timer
+  *         interrupt: the command in progress completes from the call following the
+  *         end of the bus transaction (about 30 us at 2.5 MHz MDC).
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @retval None
+  */
+void HAL_ETH_MDIO_Process(ETH_HandleTypeDef *heth)
+{
+  ETH_MDIOCmdTypeDef *pcmd = NULL;
+  uint32_t primask;
+
+  /* Queue the link status read when the poll interval elapsed */
+  if ((heth->LinkPollInterval != 0U) && (heth->LinkPollCmd.Status != ETH_MDIO_CMD_PENDING) &&
+      ((HAL_GetTick() - heth->LinkPollTick) >= heth->LinkPollInterval))
+  {
+    heth->LinkPollTick = HAL_GetTick();
+    (void)HAL_ETH_MDIO_Submit(heth, &heth->LinkPollCmd);
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  if ((heth->pMDIOHead != NULL) && (heth->MDIOStarted != 0U))
+  {
+    if (READ_BIT(heth->Instance->MACMDIOAR, ETH_MACMDIOAR_MB) == 0U)
+    {
+      pcmd = heth->pMDIOHead;
+      if (pcmd->Operation == ETH_MDIO_OP_READ)
+      {
+        pcmd->Value = (uint16_t)heth->Instance->MACMDIODR;
+      }
+      pcmd->Status = ETH_MDIO_CMD_DONE;
+    }
+    else if ((HAL_GetTick() - heth->MDIOTickstart) > ETH_MDIO_BUS_TIMEOUT)
+    {
+      pcmd = heth->pMDIOHead;
+      pcmd->Status = ETH_MDIO_CMD_ERROR;
+    }
+    else
+    {
+      /* Bus transaction still in progress */
+    }
+
+    if (pcmd != NULL)
+    {
+      heth->pMDIOHead = pcmd->pNext;
+      heth->MDIOStarted = 0U;
+    }
+  }
+
+  /* Issue the next command, or retry one which found the bus busy */
+  if ((heth->pMDIOHead != NULL) && (heth->MDIOStarted == 0U))
+  {
+    ETH_MDIOIssue(heth);
+  }
+
+  __set_PRIMASK(primask);
+
+  if (pcmd == &heth->LinkPollCmd)
+  {
+    ETH_MDIOLinkPollCplt(heth);
+  }
+  else if (pcmd != NULL)
+  {
+    HAL_ETH_MDIOCpltCallback(heth, pcmd);
+  }
+  else
+  {
+    /* No command completed */
+  }
+}
+
+/**
+  * @brief  Start polling the link state of a PHY.
+  * @note   The first poll is done by the next call to HAL_ETH_MDIO_Process().
+  *         HAL_ETH_LinkStateChangeCallback() is called with the first state read,
+  *         then on each change.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  PHYAddr: PHY port address, must be a value from 0 to 31
+  * @param  Interval: poll interval in ms, must be different from 0
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ETH_MDIO_StartLinkPoll(ETH_HandleTypeDef *heth, uint32_t PHYAddr, uint32_t Interval)
+{
+  if ((PHYAddr > 31U) || (Interval == 0U))
+  {
+    heth->ErrorCode |= HAL_ETH_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  if (heth->LinkPollCmd.Status == ETH_MDIO_CMD_PENDING)
+  {
+    return HAL_BUSY;
+  }
+
+  heth->LinkPollCmd.PHYAddr = PHYAddr;
+  heth->LinkPollCmd.PHYReg = ETH_PHY_BSR;
+  heth->LinkPollCmd.Operation = ETH_MDIO_OP_READ;
+  heth->LinkState = ETH_LINK_STATE_UNKNOWN;
+  heth->LinkPollTick = HAL_GetTick() - Interval;
+  heth->LinkPollInterval = Interval;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop the link poller.
+  * @note   A link status read already queued completes without being reported.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ETH_MDIO_StopLinkPoll(ETH_HandleTypeDef *heth)
+{
+  heth->LinkPollInterval = 0U;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Get the last link state read by the link poller.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @retval Link state, value of @ref ETH_Link_State
+  */
+uint32_t HAL_ETH_MDIO_GetLinkState(ETH_HandleTypeDef *heth)
+{
+  return heth->LinkState;
+}
+
+/**
+  * @brief  MDIO command completed callback.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  pCmd: completed command, its Status is ETH_MDIO_CMD_DONE or ETH_MDIO_CMD_ERROR
+  * @retval None
+  */
+__weak void HAL_ETH_MDIOCpltCallback(ETH_HandleTypeDef *heth, ETH_MDIOCmdTypeDef *pCmd)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(heth);
+  UNUSED(pCmd);
+  /* NOTE : This function Should not be modified, when the callback is needed,
+            the HAL_ETH_MDIOCpltCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Link state change callback.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  LinkState: new link state, ETH_LINK_STATE_UP or ETH_LINK_STATE_DOWN
+  * @retval None
+  */
+__weak void HAL_ETH_LinkStateChangeCallback(ETH_HandleTypeDef *heth, uint32_t LinkState)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(heth);
+  UNUSED(LinkState);
+  /* NOTE : This function Should not be modified, when the callback is needed,
+            the HAL_ETH_LinkStateChangeCallback could be implemented in the user file
+   */
+}
+
 /**
   * @}
   */
@@ -2675,6 +3520,33 @@ HAL_StatusTypeDef HAL_ETH_SetWakeUpFilter(ETH_HandleTypeDef *heth, uint32_t *pFi
   return HAL_OK;
 }
 
+/**
+  * @brief  Set the Rx interrupt watchdog timer.
+  * @note   When the count is not 0, the descriptors are given to the DMA without
+  *         interrupt on completion: the Rx complete interrupt is generated when the
+  *         watchdog expires after a packet reception, so that several packets are
+  *         signaled by one interrupt. The setting applies to the descriptors given
+  *         back to the DMA after this call.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  WatchdogCount: Watchdog timeout in units of 256 system clock cycles
+  *         (0 to 255), 0 to disable the coalescing.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ETH_SetRxInterruptWatchdog(ETH_HandleTypeDef *heth, uint32_t WatchdogCount)
+{
+  if (WatchdogCount > ETH_DMACRIWTR_RWT)
+  {
+    heth->ErrorCode |= HAL_ETH_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  WRITE_REG(heth->Instance->DMACRIWTR, WatchdogCount);
+  heth->RxDescList.RxIntWatchdog = WatchdogCount;
+
+  return HAL_OK;
+}
+
 /**
   * @}
   */
@@ -3324,6 +4196,113 @@ static uint32_t ETH_Prepare_Tx_Descriptors(ETH_HandleTypeDef *heth, ETH_TxPacket
   return HAL_ETH_ERROR_NONE;
 }
 
+/**
+  * @brief  Issue the MDIO command at the head of the queue when the bus is idle.
+  * @note   Called with the interrupts masked.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @retval None
+  */
+static void ETH_MDIOIssue(ETH_HandleTypeDef *heth)
+{
+  ETH_MDIOCmdTypeDef *pcmd = heth->pMDIOHead;
+  uint32_t tmpreg;
+
+  if (READ_BIT(heth->Instance->MACMDIOAR, ETH_MACMDIOAR_MB) != 0U)
+  {
+    /* Bus used by a blocking access, retried by HAL_ETH_MDIO_Process() */
+    return;
+  }
+
+  WRITE_REG(tmpreg, heth->Instance->MACMDIOAR);
+  MODIFY_REG(tmpreg, ETH_MACMDIOAR_PA, (pcmd->PHYAddr << 21));
+  MODIFY_REG(tmpreg, ETH_MACMDIOAR_RDA, (pcmd->PHYReg << 16));
+  if (pcmd->Operation == ETH_MDIO_OP_READ)
+  {
+    MODIFY_REG(tmpreg, ETH_MACMDIOAR_MOC, ETH_MACMDIOAR_MOC_RD);
+  }
+  else
+  {
+    MODIFY_REG(tmpreg, ETH_MACMDIOAR_MOC, ETH_MACMDIOAR_MOC_WR);
+    WRITE_REG(heth->Instance->MACMDIODR, (uint16_t)pcmd->Value);
+  }
+  SET_BIT(tmpreg, ETH_MACMDIOAR_MB);
+
+  WRITE_REG(heth->Instance->MACMDIOAR, tmpreg);
+
+  heth->MDIOTickstart = HAL_GetTick();
+  heth->MDIOStarted = 1U;
+}
+
+/**
+  * @brief  Report the link state read by the link poller.
+  * @note   The link status bit latches low: a link loss is reported by the first
+  *         read following it even if the link is up again.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @retval None
+  */
+static void ETH_MDIOLinkPollCplt(ETH_HandleTypeDef *heth)
+{
+  uint32_t linkstate;
+
+  if ((heth->LinkPollInterval == 0U) || (heth->LinkPollCmd.Status != ETH_MDIO_CMD_DONE))
+  {
+    return;
+  }
+
+  linkstate = ((heth->LinkPollCmd.Value & ETH_PHY_BSR_LINK_STATUS) != 0U) ? ETH_LINK_STATE_UP : ETH_LINK_STATE_DOWN;
+
+  if (linkstate != heth->LinkState)
+  {
+    heth->LinkState = linkstate;
+    HAL_ETH_LinkStateChangeCallback(heth, linkstate);
+  }
+}
+
+#ifdef HAL_ETH_USE_PTP
+/**
+  * @brief  Write a timestamp and its packet cookie in the application ring.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  pCookie: packet cookie
+  * @param  Direction: ETH_PTP_TIMESTAMP_TX or ETH_PTP_TIMESTAMP_RX
+  * @param  TimeStampLow: timestamp low (nanoseconds)
+  * @param  TimeStampHigh: timestamp high (seconds)
+  * @retval None
+  */
+static void ETH_PTP_PushTimestamp(ETH_HandleTypeDef *heth, uint32_t *pCookie, uint32_t Direction,
+                                  uint32_t TimeStampLow, uint32_t TimeStampHigh)
+{
+  ETH_PtpTimestampRingTypeDef *ring = heth->pPtpTsRing;
+  ETH_PtpTimestampEntryTypeDef *entry;
+  uint32_t head;
+
+  if (ring == NULL)
+  {
+    return;
+  }
+
+  head = ring->Head;
+  if ((head - ring->Tail) >= ring->Size)
+  {
+    /* Ring full: the timestamp is dropped */
+    ring->Overflow++;
+    return;
+  }
+
+  entry = &ring->pEntries[head & (ring->Size - 1U)];
+  entry->pCookie = pCookie;
+  entry->Direction = Direction;
+  entry->TimeStamp.TimeStampLow = TimeStampLow;
+  entry->TimeStamp.TimeStampHigh = TimeStampHigh;
+
+  /* Publish the entry once written */
+  __DMB();
+  ring->Head = head + 1U;
+}
+#endif /* HAL_ETH_USE_PTP */
+
 #if (USE_HAL_ETH_REGISTER_CALLBACKS == 1)
 static void ETH_InitCallbacksToDefault(ETH_HandleTypeDef *heth)
 {
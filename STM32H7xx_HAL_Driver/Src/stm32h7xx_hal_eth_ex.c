@@ -57,12 +57,28 @@
 
 #define ETH_MACTXVLAN_MASK (ETH_MACVIR_VLTI | ETH_MACVIR_CSVL | \
                             ETH_MACVIR_VLP | ETH_MACVIR_VLC)
+
+/* Memory map of the tightly coupled memories and of the D2 AHB SRAM, common to the H7 lines */
+#define ETH_ITCM_END         0x00040000UL
+#define ETH_DTCM_BASE        0x20000000UL
+#define ETH_DTCM_END         0x20020000UL
+#define ETH_D2SRAM_BASE      0x30000000UL
+#define ETH_D2SRAM_END       0x38000000UL
 /**
   * @}
   */
 
 /* Private macros ------------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
+/** @defgroup ETHEx_Private_Functions ETHEx Private Functions
+  * @{
+  */
+static uint32_t ETHEx_CheckAddress(uint32_t Address);
+static uint32_t ETHEx_IsCacheable(uint32_t Rasr);
+/**
+  * @}
+  */
+
 /* Exported functions ---------------------------------------------------------*/
 /** @defgroup ETHEx_Exported_Functions ETH Extended Exported Functions
   * @{
@@ -80,6 +96,8 @@
       (+) Configure L3 and L4 filters
       (+) Configure Extended VLAN features
       (+) Configure Energy Efficient Ethernet module
+      (+) Check the placement of the DMA descriptors and buffers
+      (+) Measure the DMA throughput in MAC loopback
 
 @endverbatim
   * @{
@@ -560,6 +578,348 @@ uint32_t HAL_ETHEx_GetMACLPIEvent(ETH_HandleTypeDef *heth)
   * @}
   */
 
+/** @defgroup ETHEx_Exported_Functions_Group2 Descriptor placement and loopback test functions
+  * @brief    Descriptor placement and loopback test functions
+  *
+@verbatim
+ ===============================================================================
+          ##### Descriptor placement and loopback test functions #####
+ ===============================================================================
+    [..] This section provides functions allowing to size and place the DMA
+         descriptor rings:
+      (+) HAL_ETHEx_CheckDescriptorPlacement() checks the Tx and Rx descriptor
+          lists given in the Init structure, HAL_ETHEx_CheckBufferPlacement() any
+          DMA buffer. They return a combination of @ref ETHEx_Placement_Flags:
+        (++) ETH_PLACEMENT_NO_DMA_ACCESS: the memory is in ITCM or DTCM, the
+             DMA reads and writes are lost.
+        (++) ETH_PLACEMENT_CACHEABLE: the D-cache is enabled and the MPU
+             attributes (or the default memory map when no region matches)
+             make the memory cacheable. Descriptors written back by the DMA
+             are then read stale from the cache: they must be placed in an MPU
+             region of normal non-cacheable (TEX=1, C=0, B=0), device or
+             shareable memory.
+        (++) ETH_PLACEMENT_NOT_D2_SRAM: advisory, the memory is reachable but
+             the DMA accesses cross the D1/D2 bridge, as for the AXI SRAM.
+        (++) ETH_PLACEMENT_UNALIGNED: the descriptor list is not 32-bit aligned.
+         The first and the last byte of the memory are checked.
+
+      (+) HAL_ETHEx_LoopbackTest() measures the frames per second and the bit
+          rate the DMA sustains with the descriptor rings in place:
+        (++) Call it after HAL_ETH_Init(), the interface being stopped, with
+             the RxAllocate and RxLink callbacks registered and the PHY
+             clocks running (the MAC loopback uses the MII/RMII clocks).
+        (++) pTest gives a frame, its length, the number of frames and the
+             number of frames queued to the Tx DMA at most. Running the test
+             with several InFlight values and frame lengths shows the smallest
+             ring reaching the throughput of the application, ETH_TX_DESC_CNT
+             and ETH_RX_DESC_CNT being then set to it.
+        (++) Each received frame is given to HAL_ETHEx_LoopbackRxCallback(),
+             which must release the application buffer and may compare it to
+             the frame sent, incrementing pTest->RxErrors when it differs.
+             The pData of the transmitted frames given to
+             HAL_ETH_TxFreeCallback() is pTest.
+        (++) The loopback mode of the MAC is restored and the interface is
+             stopped on return. HAL_TIMEOUT is returned when frames are lost,
+             the results covering the frames received.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Checks the placement of a DMA buffer.
+  * @param  pBuffer: buffer read or written by the Ethernet DMA
+  * @param  Size: buffer size in bytes
+  * @retval Combination of @ref ETHEx_Placement_Flags
+  */
+uint32_t HAL_ETHEx_CheckBufferPlacement(const void *pBuffer, uint32_t Size)
+{
+  uint32_t flags = ETH_PLACEMENT_OK;
+
+  if (Size != 0U)
+  {
+    flags = ETHEx_CheckAddress((uint32_t)pBuffer);
+    flags |= ETHEx_CheckAddress((uint32_t)pBuffer + Size - 1U);
+  }
+
+  return flags;
+}
+
+/**
+  * @brief  Checks the placement of the Tx and Rx DMA descriptor lists.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @retval Combination of @ref ETHEx_Placement_Flags
+  */
+uint32_t HAL_ETHEx_CheckDescriptorPlacement(ETH_HandleTypeDef *heth)
+{
+  uint32_t flags;
+
+  flags = HAL_ETHEx_CheckBufferPlacement(heth->Init.TxDesc, ETH_TX_DESC_CNT * sizeof(ETH_DMADescTypeDef));
+  flags |= HAL_ETHEx_CheckBufferPlacement(heth->Init.RxDesc, ETH_RX_DESC_CNT * sizeof(ETH_DMADescTypeDef));
+
+  if ((((uint32_t)heth->Init.TxDesc | (uint32_t)heth->Init.RxDesc) & 0x3U) != 0U)
+  {
+    flags |= ETH_PLACEMENT_UNALIGNED;
+  }
+
+  return flags;
+}
+
+/**
+  * @brief  Measures the DMA throughput by sending frames in MAC loopback.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  pTest: test parameters and results
+  * @param  Timeout: test duration limit in ms
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ETHEx_LoopbackTest(ETH_HandleTypeDef *heth, ETH_LoopbackTestTypeDef *pTest, uint32_t Timeout)
+{
+  ETH_TxPacketConfig txconfig;
+  ETH_BufferTypeDef txbuffer;
+  void *pappbuff = NULL;
+  uint32_t loopback;
+  uint32_t tickstart;
+  uint32_t elapsed;
+  HAL_StatusTypeDef status = HAL_OK;
+
+  if ((pTest == NULL) || (pTest->pFrame == NULL) || (pTest->FrameLength < ETH_LOOPBACK_MIN_LENGTH) ||
+      (pTest->FrameLength > ETH_LOOPBACK_MAX_LENGTH) || (pTest->FrameCount == 0U) ||
+      (pTest->InFlight == 0U) || (pTest->InFlight > ETH_TX_DESC_CNT))
+  {
+    heth->ErrorCode |= HAL_ETH_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  if (heth->gState != HAL_ETH_STATE_READY)
+  {
+    return HAL_ERROR;
+  }
+
+  pTest->Placement = HAL_ETHEx_CheckDescriptorPlacement(heth) |
+                     HAL_ETHEx_CheckBufferPlacement(pTest->pFrame, pTest->FrameLength);
+  pTest->TxFrames = 0U;
+  pTest->RxFrames = 0U;
+  pTest->RxErrors = 0U;
+  pTest->ElapsedTime = 0U;
+  pTest->FramesPerSecond = 0U;
+  pTest->KbitPerSecond = 0U;
+
+  /* The DMA would run on memory it cannot reach */
+  if ((pTest->Placement & (ETH_PLACEMENT_NO_DMA_ACCESS | ETH_PLACEMENT_UNALIGNED)) != 0U)
+  {
+    heth->ErrorCode |= HAL_ETH_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  txbuffer.buffer = pTest->pFrame;
+  txbuffer.len = pTest->FrameLength;
+  txbuffer.next = NULL;
+
+  txconfig.Attributes = ETH_TX_PACKETS_FEATURES_CRCPAD;
+  txconfig.Length = pTest->FrameLength;
+  txconfig.TxBuffer = &txbuffer;
+  txconfig.SrcAddrCtrl = ETH_SRC_ADDR_CONTROL_DISABLE;
+  txconfig.CRCPadCtrl = ETH_CRC_PAD_INSERT;
+  txconfig.ChecksumCtrl = ETH_CHECKSUM_DISABLE;
+  txconfig.pData = pTest;
+
+  /* Loop the transmitted frames back to the receiver inside the MAC */
+  loopback = READ_BIT(heth->Instance->MACCR, ETH_MACCR_LM);
+  SET_BIT(heth->Instance->MACCR, ETH_MACCR_LM);
+
+  if (HAL_ETH_Start(heth) != HAL_OK)
+  {
+    MODIFY_REG(heth->Instance->MACCR, ETH_MACCR_LM, loopback);
+    return HAL_ERROR;
+  }
+
+  tickstart = HAL_GetTick();
+
+  while ((pTest->RxFrames < pTest->FrameCount) && (status == HAL_OK))
+  {
+    /* Keep at most InFlight frames queued to the Tx DMA */
+    if ((pTest->TxFrames < pTest->FrameCount) && (heth->TxDescList.BuffersInUse < pTest->InFlight))
+    {
+      if (HAL_ETH_Transmit_IT(heth, &txconfig) == HAL_OK)
+      {
+        pTest->TxFrames++;
+      }
+    }
+
+    (void)HAL_ETH_ReleaseTxPacket(heth);
+
+    while (HAL_ETH_ReadData(heth, &pappbuff) == HAL_OK)
+    {
+      pTest->RxFrames++;
+      HAL_ETHEx_LoopbackRxCallback(heth, pTest, pappbuff);
+    }
+
+    if ((HAL_GetTick() - tickstart) > Timeout)
+    {
+      heth->ErrorCode |= HAL_ETH_ERROR_TIMEOUT;
+      status = HAL_TIMEOUT;
+    }
+  }
+
+  elapsed = HAL_GetTick() - tickstart;
+
+  (void)HAL_ETH_ReleaseTxPacket(heth);
+  (void)HAL_ETH_Stop(heth);
+  MODIFY_REG(heth->Instance->MACCR, ETH_MACCR_LM, loopback);
+
+  /* Shorter than the tick resolution */
+  if (elapsed == 0U)
+  {
+    elapsed = 1U;
+  }
+
+  pTest->ElapsedTime = elapsed;
+  pTest->FramesPerSecond = (uint32_t)(((uint64_t)pTest->RxFrames * 1000U) / elapsed);
+  pTest->KbitPerSecond = (uint32_t)(((uint64_t)pTest->RxFrames * pTest->FrameLength * 8U) / elapsed);
+
+  return status;
+}
+
+/**
+  * @brief  Loopback test frame received callback.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  pTest: test in progress
+  * @param  pAppBuff: application buffer of the frame, built by the RxLink callback
+  * @retval None
+  */
+__weak void HAL_ETHEx_LoopbackRxCallback(ETH_HandleTypeDef *heth, ETH_LoopbackTestTypeDef *pTest, void *pAppBuff)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(heth);
+  UNUSED(pTest);
+  UNUSED(pAppBuff);
+  /* NOTE : This function Should not be modified, when the callback is needed,
+  the HAL_ETHEx_LoopbackRxCallback could be implemented in the user file
+  */
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/** @addtogroup ETHEx_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Checks the placement of one byte of memory.
+  * @param  Address: byte address
+  * @retval Combination of @ref ETHEx_Placement_Flags
+  */
+static uint32_t ETHEx_CheckAddress(uint32_t Address)
+{
+  uint32_t flags = ETH_PLACEMENT_OK;
+  uint32_t cacheable;
+  uint32_t rnr;
+  uint32_t region;
+  uint32_t regioncount;
+  uint32_t rasr;
+  uint32_t sizefield;
+  uint32_t offset;
+
+  if ((Address < ETH_ITCM_END) || ((Address >= ETH_DTCM_BASE) && (Address < ETH_DTCM_END)))
+  {
+    /* The TCMs are not cached either */
+    return ETH_PLACEMENT_NO_DMA_ACCESS;
+  }
+
+  if ((Address < ETH_D2SRAM_BASE) || (Address >= ETH_D2SRAM_END))
+  {
+    flags |= ETH_PLACEMENT_NOT_D2_SRAM;
+  }
+
+  if ((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+  {
+    /* Default memory map: the code, SRAM and external RAM regions are cacheable */
+    cacheable = ((Address < 0x40000000UL) || ((Address >= 0x60000000UL) && (Address < 0xA0000000UL))) ? 1U : 0U;
+
+    if ((MPU->CTRL & MPU_CTRL_ENABLE_Msk) != 0U)
+    {
+      rnr = MPU->RNR;
+      regioncount = (MPU->TYPE & MPU_TYPE_DREGION_Msk) >> MPU_TYPE_DREGION_Pos;
+
+      /* The highest numbered region holding the address gives its attributes */
+      for (region = 0U; region < regioncount; region++)
+      {
+        MPU->RNR = region;
+        rasr = MPU->RASR;
+
+        if ((rasr & MPU_RASR_ENABLE_Msk) != 0U)
+        {
+          /* Region of 2^(SIZE+1) bytes aligned on its size, made of 8 sub-regions */
+          sizefield = (rasr & MPU_RASR_SIZE_Msk) >> MPU_RASR_SIZE_Pos;
+          offset = Address - (MPU->RBAR & MPU_RBAR_ADDR_Msk);
+
+          if ((sizefield == 31U) || (offset < (2UL << sizefield)))
+          {
+            /* Sub-regions exist from 256 bytes */
+            if ((sizefield < 7U) ||
+                ((rasr & (1UL << (MPU_RASR_SRD_Pos + (offset >> (sizefield - 2U))))) == 0U))
+            {
+              cacheable = ETHEx_IsCacheable(rasr);
+            }
+          }
+        }
+      }
+
+      MPU->RNR = rnr;
+    }
+
+    if (cacheable != 0U)
+    {
+      flags |= ETH_PLACEMENT_CACHEABLE;
+    }
+  }
+
+  return flags;
+}
+
+/**
+  * @brief  Tells whether the attributes of an MPU region make it cacheable.
+  * @param  Rasr: region attribute and size register
+  * @retval 1 if the D-cache holds the region, 0 otherwise
+  */
+static uint32_t ETHEx_IsCacheable(uint32_t Rasr)
+{
+  uint32_t tex = (Rasr & MPU_RASR_TEX_Msk) >> MPU_RASR_TEX_Pos;
+  uint32_t cacheable;
+
+  if ((tex & 0x4U) != 0U)
+  {
+    /* Normal memory, the C and B bits give the inner policy */
+    cacheable = ((Rasr & (MPU_RASR_C_Msk | MPU_RASR_B_Msk)) != 0U) ? 1U : 0U;
+  }
+  else if (tex < 2U)
+  {
+    /* Strongly-ordered, device and non-cacheable memories have C cleared */
+    cacheable = ((Rasr & MPU_RASR_C_Msk) != 0U) ? 1U : 0U;
+  }
+  else
+  {
+    cacheable = 0U;
+  }
+
+  /* The Cortex-M7 does not cache shareable memory unless it is forced to write-through */
+  if ((cacheable != 0U) && ((Rasr & MPU_RASR_S_Msk) != 0U) && ((SCB->CACR & SCB_CACR_SIWT_Msk) == 0U))
+  {
+    cacheable = 0U;
+  }
+
+  return cacheable;
+}
+
 /**
   * @}
   */
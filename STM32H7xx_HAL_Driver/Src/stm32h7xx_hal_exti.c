@@ -113,6 +113,25 @@
 
     (#) Generate software interrupt using HAL_EXTI_GenerateSWI().
 
+    (#) Capture timestamped GPIO edges with an EXTI_CaptureTypeDef handle.
+        (++) Configure the GPIO line in interrupt mode on both edges, e.g.
+             with HAL_GPIO_Init() and GPIO_MODE_IT_RISING_FALLING.
+        (++) Provide the event ring, the timestamp counter (the DWT cycle
+             counter by default) and the debounce time, then call
+             HAL_EXTI_Capture_Init().
+        (++) Call HAL_EXTI_Capture_IRQHandler() from the EXTI interrupt
+             handler of the line: it only samples the counter and the pin
+             level and stores the event in the ring.
+        (++) Call HAL_EXTI_Capture_Dispatch() from the application loop or a
+             low priority task to run EventCallback for the stored events, or
+             read them one by one with HAL_EXTI_Capture_Read().
+        (++) With a non-zero debounce time, the line interrupt is masked
+             after each recorded edge. Call HAL_EXTI_Capture_DebounceHandler()
+             from the period elapsed interrupt of a TIM or LPTIM: once the
+             debounce time has elapsed, it records the settled level if it
+             changed and unmasks the line. A bouncing input then costs at most
+             one EXTI interrupt per debounce time.
+
   @endverbatim
   */
 
@@ -143,6 +162,16 @@
 /* Private macros ------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
+/** @defgroup EXTI_Private_Functions EXTI Private Functions
+  * @{
+  */
+static uint32_t EXTI_Capture_GetLevel(const EXTI_CaptureTypeDef *hcapture);
+static __IO uint32_t *EXTI_Capture_GetMaskRegister(const EXTI_CaptureTypeDef *hcapture);
+static void EXTI_Capture_Push(EXTI_CaptureTypeDef *hcapture, uint32_t Timestamp, uint32_t Level);
+/**
+  * @}
+  */
+
 /* Exported functions --------------------------------------------------------*/
 
 /** @addtogroup EXTI_Exported_Functions
@@ -844,6 +873,322 @@ void HAL_EXTI_GenerateSWI(EXTI_HandleTypeDef *hexti)
   * @}
   */
 
+/** @addtogroup EXTI_Exported_Functions_Group3
+ *  @brief EXTI capture functions.
+ *
+@verbatim
+ ===============================================================================
+                         ##### Capture functions #####
+ ===============================================================================
+    [..]
+    This subsection provides functions to timestamp GPIO edges from a minimal
+    interrupt handler, to debounce them with a hardware timer, and to process
+    them later out of interrupt context.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Initialize the capture of a GPIO line.
+  * @param  hcapture Capture handle, with Line, GPIOSel, pBuffer, BufferSize,
+  *         pCounter, CounterMask, DebounceTime and EventCallback filled in.
+  * @note   The EXTI line itself is configured by the application.
+  * @note   When pCounter is NULL, the DWT cycle counter is enabled and used.
+  * @retval HAL Status.
+  */
+HAL_StatusTypeDef HAL_EXTI_Capture_Init(EXTI_CaptureTypeDef *hcapture)
+{
+  /* Check null pointer */
+  if (hcapture == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check parameters */
+  assert_param(IS_EXTI_GPIO_LINE(hcapture->Line));
+  assert_param(IS_EXTI_GPIO_PORT(hcapture->GPIOSel));
+
+  if ((hcapture->pBuffer == NULL) || (hcapture->BufferSize == 0U) ||
+      ((hcapture->BufferSize & (hcapture->BufferSize - 1U)) != 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  if (hcapture->pCounter == NULL)
+  {
+    /* Enable the DWT cycle counter */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+#if !defined(CORE_CM4)
+    /* Unlock the Cortex-M7 DWT registers */
+    DWT->LAR = 0xC5ACCE55U;
+#endif /* !CORE_CM4 */
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    hcapture->pCounter    = &DWT->CYCCNT;
+    hcapture->CounterMask = 0U;
+  }
+
+  hcapture->Head       = 0U;
+  hcapture->Tail       = 0U;
+  hcapture->Overruns   = 0U;
+  hcapture->Debouncing = 0U;
+  hcapture->LastLevel  = EXTI_Capture_GetLevel(hcapture);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Handle the EXTI interrupt request of a captured line.
+  * @param  hcapture Capture handle.
+  * @note   The handler only samples the timestamp counter and the pin level:
+  *         the event is processed later by HAL_EXTI_Capture_Dispatch().
+  * @retval none.
+  */
+void HAL_EXTI_Capture_IRQHandler(EXTI_CaptureTypeDef *hcapture)
+{
+  __IO uint32_t *regaddr;
+  uint32_t timestamp = *hcapture->pCounter;
+  uint32_t maskline;
+  uint32_t offset;
+  uint32_t level;
+
+  /* Compute line register offset and line mask */
+  offset = ((hcapture->Line & EXTI_REG_MASK) >> EXTI_REG_SHIFT);
+  maskline = (1UL << (hcapture->Line & EXTI_PIN_MASK));
+
+#if defined(DUAL_CORE)
+  if (HAL_GetCurrentCPUID() == CM7_CPUID)
+  {
+    /* Get pending register address */
+    regaddr = (__IO uint32_t *)(&EXTI->PR1 + (EXTI_MODE_OFFSET * offset));
+  }
+  else /* Cortex-M4*/
+  {
+    /* Get pending register address */
+    regaddr = (__IO uint32_t *)(&EXTI->C2PR1 + (EXTI_MODE_OFFSET * offset));
+  }
+#else
+  regaddr = (__IO uint32_t *)(&EXTI->PR1 + (EXTI_MODE_OFFSET * offset));
+#endif /* DUAL_CORE */
+
+  if ((*regaddr & maskline) != 0x00U)
+  {
+    /* Clear pending bit */
+    *regaddr = maskline;
+
+    level = EXTI_Capture_GetLevel(hcapture);
+
+    if (hcapture->DebounceTime != 0U)
+    {
+      /* Mask the line until the end of the debounce time */
+      regaddr = EXTI_Capture_GetMaskRegister(hcapture);
+      *regaddr &= ~maskline;
+
+      hcapture->DebounceStart = timestamp;
+      hcapture->Debouncing    = 1U;
+
+      /* Only a level change is an edge, the rest is bounce */
+      if (level != hcapture->LastLevel)
+      {
+        EXTI_Capture_Push(hcapture, timestamp, level);
+      }
+    }
+    else
+    {
+      EXTI_Capture_Push(hcapture, timestamp, level);
+    }
+  }
+}
+
+/**
+  * @brief  End the debounce time of a captured line.
+  * @param  hcapture Capture handle.
+  * @note   To be called periodically, typically from the period elapsed
+  *         interrupt of a TIM or LPTIM whose period is a fraction of the
+  *         debounce time.
+  * @retval none.
+  */
+void HAL_EXTI_Capture_DebounceHandler(EXTI_CaptureTypeDef *hcapture)
+{
+  __IO uint32_t *regaddr;
+  uint32_t timestamp;
+  uint32_t countermask;
+  uint32_t maskline;
+  uint32_t offset;
+  uint32_t level;
+
+  if (hcapture->Debouncing == 0U)
+  {
+    return;
+  }
+
+  timestamp   = *hcapture->pCounter;
+  countermask = (hcapture->CounterMask == 0U) ? 0xFFFFFFFFU : hcapture->CounterMask;
+
+  if (((timestamp - hcapture->DebounceStart) & countermask) < hcapture->DebounceTime)
+  {
+    return;
+  }
+
+  /* Record the settled level when it differs from the last recorded one */
+  level = EXTI_Capture_GetLevel(hcapture);
+  if (level != hcapture->LastLevel)
+  {
+    EXTI_Capture_Push(hcapture, timestamp, level);
+  }
+
+  /* Compute line register offset and line mask */
+  offset = ((hcapture->Line & EXTI_REG_MASK) >> EXTI_REG_SHIFT);
+  maskline = (1UL << (hcapture->Line & EXTI_PIN_MASK));
+
+  /* Discard the bounces latched while masked, then unmask the line */
+#if defined(DUAL_CORE)
+  if (HAL_GetCurrentCPUID() == CM7_CPUID)
+  {
+    regaddr = (__IO uint32_t *)(&EXTI->PR1 + (EXTI_MODE_OFFSET * offset));
+  }
+  else /* Cortex-M4*/
+  {
+    regaddr = (__IO uint32_t *)(&EXTI->C2PR1 + (EXTI_MODE_OFFSET * offset));
+  }
+#else
+  regaddr = (__IO uint32_t *)(&EXTI->PR1 + (EXTI_MODE_OFFSET * offset));
+#endif /* DUAL_CORE */
+  *regaddr = maskline;
+
+  hcapture->Debouncing = 0U;
+
+  regaddr = EXTI_Capture_GetMaskRegister(hcapture);
+  *regaddr |= maskline;
+}
+
+/**
+  * @brief  Read the oldest event of a captured line.
+  * @param  hcapture Capture handle.
+  * @param  pEvent Pointer to the structure receiving the event.
+  * @retval HAL Status, HAL_ERROR when no event is stored.
+  */
+HAL_StatusTypeDef HAL_EXTI_Capture_Read(EXTI_CaptureTypeDef *hcapture, EXTI_CaptureEventTypeDef *pEvent)
+{
+  uint32_t tail = hcapture->Tail;
+
+  if (tail == hcapture->Head)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Read the event before releasing its slot */
+  __DMB();
+  *pEvent = hcapture->pBuffer[tail & (hcapture->BufferSize - 1U)];
+  __DMB();
+  hcapture->Tail = tail + 1U;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Run the event callback of a captured line for the stored events.
+  * @param  hcapture Capture handle.
+  * @note   To be called out of the interrupt context, e.g. from the application
+  *         loop, so that the event processing does not add interrupt load.
+  * @retval Number of dispatched events.
+  */
+uint32_t HAL_EXTI_Capture_Dispatch(EXTI_CaptureTypeDef *hcapture)
+{
+  EXTI_CaptureEventTypeDef event;
+  uint32_t count = 0U;
+
+  while (HAL_EXTI_Capture_Read(hcapture, &event) == HAL_OK)
+  {
+    if (hcapture->EventCallback != NULL)
+    {
+      hcapture->EventCallback(hcapture, &event);
+    }
+    count++;
+  }
+
+  return count;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/** @addtogroup EXTI_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Get the pin level of a captured line.
+  * @param  hcapture Capture handle.
+  * @retval 1 if the pin is high else 0.
+  */
+static uint32_t EXTI_Capture_GetLevel(const EXTI_CaptureTypeDef *hcapture)
+{
+  const GPIO_TypeDef *port = (GPIO_TypeDef *)(GPIOA_BASE + (hcapture->GPIOSel * (GPIOB_BASE - GPIOA_BASE)));
+
+  return ((port->IDR >> (hcapture->Line & EXTI_PIN_MASK)) & 0x01U);
+}
+
+/**
+  * @brief  Get the interrupt mask register of a captured line for the current CPU.
+  * @param  hcapture Capture handle.
+  * @retval Interrupt mask register address.
+  */
+static __IO uint32_t *EXTI_Capture_GetMaskRegister(const EXTI_CaptureTypeDef *hcapture)
+{
+  uint32_t offset = ((hcapture->Line & EXTI_REG_MASK) >> EXTI_REG_SHIFT);
+
+#if defined(DUAL_CORE)
+  if (HAL_GetCurrentCPUID() != CM7_CPUID)
+  {
+    return (__IO uint32_t *)(&EXTI->C2IMR1 + (EXTI_MODE_OFFSET * offset));
+  }
+#endif /* DUAL_CORE */
+
+  return (__IO uint32_t *)(&EXTI->IMR1 + (EXTI_MODE_OFFSET * offset));
+}
+
+/**
+  * @brief  Store an event in the ring of a captured line.
+  * @param  hcapture Capture handle.
+  * @param  Timestamp Timestamp of the event.
+  * @param  Level Pin level after the edge.
+  * @note   The EXTI and timer interrupts may both store events: the write is
+  *         done with interrupts disabled.
+  * @retval None.
+  */
+static void EXTI_Capture_Push(EXTI_CaptureTypeDef *hcapture, uint32_t Timestamp, uint32_t Level)
+{
+  uint32_t primask_bit = __get_PRIMASK();
+  uint32_t head;
+
+  __disable_irq();
+
+  head = hcapture->Head;
+  hcapture->LastLevel = Level;
+
+  if ((head - hcapture->Tail) >= hcapture->BufferSize)
+  {
+    hcapture->Overruns++;
+  }
+  else
+  {
+    hcapture->pBuffer[head & (hcapture->BufferSize - 1U)].Timestamp = Timestamp;
+    hcapture->pBuffer[head & (hcapture->BufferSize - 1U)].Edge      = (Level != 0U) ? EXTI_TRIGGER_RISING : EXTI_TRIGGER_FALLING;
+
+    /* Publish the event once written */
+    __DMB();
+    hcapture->Head = head + 1U;
+  }
+
+  __set_PRIMASK(primask_bit);
+}
+
 /**
   * @}
   */
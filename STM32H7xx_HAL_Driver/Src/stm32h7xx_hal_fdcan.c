@@ -27,7 +27,16 @@
                         ##### How to use this driver #####
   ==============================================================================
     [..]
+      (#) When several FDCAN instances share the message RAM, HAL_FDCAN_PlanMessageRAM
+          can partition it from the needs of each instance given in FDCAN_RamPlanTypeDef
+          structures. It fills the MessageRAMOffset and the element numbers and sizes
+          of the Init structure of every handle, packing the instances one after the
+          other and growing their Rx FIFOs and Tx FIFO/Queue as deep as the RAM allows.
+
       (#) Initialize the FDCAN peripheral using HAL_FDCAN_Init function.
+          HAL_FDCAN_Init fails if the message RAM blocks of the instance overflow the
+          message RAM or overlap the blocks of another initialized instance.
+          HAL_FDCAN_DeInit releases the message RAM blocks of the instance.
 
       (#) If needed , configure the reception filters and optional features using
           the following configuration functions:
@@ -73,6 +82,29 @@
       (#) When a message is received into the FDCAN message RAM, it can be
           retrieved using the HAL_FDCAN_GetRxMessage function.
 
+      (#) To drain an Rx FIFO without copy, HAL_FDCAN_GetRxFifoSpan returns the
+          elements stored in the FIFO. They are read in place in the message RAM
+          through __HAL_FDCAN_GET_SPAN_ELEMENT, and only the needed fields are
+          decoded with the __HAL_FDCAN_GET_ELEMENT_xxx macros (or the whole header
+          with HAL_FDCAN_DecodeRxElement). HAL_FDCAN_ReleaseRxFifoSpan then
+          acknowledges all the elements read with a single write.
+
+      (#) To send more frames than there are Tx buffers, in CAN priority order,
+          a software Tx scheduler can feed a range of dedicated Tx buffers:
+            (++) Provide a pool of FDCAN_TxSchedEntryTypeDef entries and an array
+                 of as many entry pointers in a FDCAN_TxSchedTypeDef structure,
+                 with the range of dedicated Tx buffers to be fed.
+            (++) Attach it with HAL_FDCAN_TxSchedInit, which also activates the
+                 Tx complete and Tx abort complete notifications of these buffers.
+            (++) Queue frames with HAL_FDCAN_TxSchedEnqueue. The buffers are
+                 refilled from HAL_FDCAN_IRQHandler as soon as they are released,
+                 always with the frames of highest priority. When they are all
+                 busy and a frame of higher priority is queued, the buffer of
+                 lowest priority is cancelled and its frame put back in the queue.
+            (++) In time-triggered operation, HAL_FDCAN_TT_ConfigTxSchedWindow
+                 restricts these buffers to an arbitrating time window, the
+                 exclusive windows using the buffers outside the range.
+
       (#) Calling the HAL_FDCAN_Stop function stops the FDCAN module by entering
           it to initialization mode and re-enabling access to configuration
           registers through the configuration functions listed here above.
@@ -234,6 +266,13 @@
 
 #define FDCAN_MESSAGE_RAM_SIZE 0x2800U
 #define FDCAN_MESSAGE_RAM_END_ADDRESS (SRAMCAN_BASE + FDCAN_MESSAGE_RAM_SIZE - 0x4U) /* The Message RAM has a width of 4 Bytes */
+#define FDCAN_MESSAGE_RAM_WORDS ((FDCAN_MESSAGE_RAM_END_ADDRESS - SRAMCAN_BASE) / 4U) /* Words allocable below the end address  */
+
+#if defined(FDCAN3)
+#define FDCAN_INSTANCES_NBR 3U
+#else
+#define FDCAN_INSTANCES_NBR 2U
+#endif /* FDCAN3 */
 
 /**
   * @}
@@ -242,13 +281,28 @@
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 static const uint8_t DLCtoBytes[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 12, 16, 20, 24, 32, 48, 64};
+static const uint8_t EltSizeToWords[] = {4, 5, 6, 7, 8, 10, 14, 18};
+static FDCAN_GlobalTypeDef *const FDCANInstances[FDCAN_INSTANCES_NBR] =
+{
+  FDCAN1,
+  FDCAN2,
+#if defined(FDCAN3)
+  FDCAN3,
+#endif /* FDCAN3 */
+};
 
 /* Private function prototypes -----------------------------------------------*/
 /** @addtogroup FDCAN_Private_Functions_Prototypes
   * @{
   */
 static HAL_StatusTypeDef FDCAN_CalcultateRamBlockAddresses(FDCAN_HandleTypeDef *hfdcan);
+static HAL_StatusTypeDef FDCAN_CheckRamOverlap(FDCAN_HandleTypeDef *hfdcan, uint32_t StartAddress, uint32_t EndAddress);
+static void FDCAN_ReleaseRamBlocks(FDCAN_HandleTypeDef *hfdcan);
 static void FDCAN_CopyMessageToRAM(FDCAN_HandleTypeDef *hfdcan, FDCAN_TxHeaderTypeDef *pTxHeader, uint8_t *pTxData, uint32_t BufferIndex);
+static uint32_t FDCAN_TxSchedIsBefore(const FDCAN_TxSchedEntryTypeDef *pEntryA, const FDCAN_TxSchedEntryTypeDef *pEntryB);
+static void FDCAN_TxSchedPush(FDCAN_TxSchedTypeDef *pTxSched, FDCAN_TxSchedEntryTypeDef *pEntry);
+static FDCAN_TxSchedEntryTypeDef *FDCAN_TxSchedPop(FDCAN_TxSchedTypeDef *pTxSched);
+static void FDCAN_TxSchedService(FDCAN_HandleTypeDef *hfdcan);
 /**
   * @}
   */
@@ -270,6 +324,7 @@ static void FDCAN_CopyMessageToRAM(FDCAN_HandleTypeDef *hfdcan, FDCAN_TxHeaderTy
       (+) De-initialize the FDCAN.
       (+) Enter FDCAN peripheral in power down mode.
       (+) Exit power down mode.
+      (+) Partition the message RAM between several instances.
       (+) Register callbacks.
       (+) Unregister callbacks.
 
@@ -570,6 +625,9 @@ HAL_StatusTypeDef HAL_FDCAN_Init(FDCAN_HandleTypeDef *hfdcan)
   /* Initialize the Latest Tx FIFO/Queue request buffer index */
   hfdcan->LatestTxFifoQRequest = 0U;
 
+  /* No software Tx scheduler attached */
+  hfdcan->pTxSched = NULL;
+
   /* Initialize the error code */
   hfdcan->ErrorCode = HAL_FDCAN_ERROR_NONE;
 
@@ -606,6 +664,9 @@ HAL_StatusTypeDef HAL_FDCAN_DeInit(FDCAN_HandleTypeDef *hfdcan)
   /* Disable Interrupt lines */
   CLEAR_BIT(hfdcan->Instance->ILE, (FDCAN_INTERRUPT_LINE0 | FDCAN_INTERRUPT_LINE1));
 
+  /* Release the message RAM blocks, the other instances can then use them */
+  FDCAN_ReleaseRamBlocks(hfdcan);
+
 #if USE_HAL_FDCAN_REGISTER_CALLBACKS == 1
   if (hfdcan->MspDeInitCallback == NULL)
   {
@@ -732,6 +793,168 @@ HAL_StatusTypeDef HAL_FDCAN_ExitPowerDownMode(FDCAN_HandleTypeDef *hfdcan)
   return HAL_OK;
 }
 
+/**
+  * @brief  Partition the message RAM between several FDCAN instances.
+  * @note   The blocks of the instances are packed one after the other, in the
+  *         order of the hfdcan array, from the start of the message RAM. Each
+  *         instance first gets its fixed blocks and the Min number of elements
+  *         of its FIFOs. The RAM left is then given one element at a time to the
+  *         shallowest FIFO still below its Max number of elements, the FIFO of
+  *         smallest elements first, so that all the FIFOs grow evenly.
+  * @note   Only the message RAM fields of the Init structures are set, from
+  *         MessageRAMOffset to TxElmtSize except TxFifoQueueMode. None of them is
+  *         modified when the requirements do not fit in the message RAM.
+  * @param  hfdcan array of NbInstances pointers to FDCAN_HandleTypeDef structures,
+  *         the handles are not initialized yet.
+  * @param  pPlan array of NbInstances FDCAN_RamPlanTypeDef structures, giving the
+  *         message RAM requirements of the instance of same index.
+  * @param  NbInstances number of instances sharing the message RAM.
+  *         This parameter must be a number between 1 and the number of FDCAN instances.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_FDCAN_PlanMessageRAM(FDCAN_HandleTypeDef *hfdcan[], const FDCAN_RamPlanTypeDef *pPlan, uint32_t NbInstances)
+{
+  uint32_t Depth[FDCAN_INSTANCES_NBR][3];
+  uint32_t MaxDepth[FDCAN_INSTANCES_NBR][3];
+  uint32_t EltWords[FDCAN_INSTANCES_NBR][3];
+  uint32_t UsedWords = 0U;
+  uint32_t Offset = 0U;
+  uint32_t BestInstance;
+  uint32_t BestFifo;
+  uint32_t Instance;
+  uint32_t Fifo;
+
+  if ((hfdcan == NULL) || (pPlan == NULL) || (NbInstances == 0U) || (NbInstances > FDCAN_INSTANCES_NBR))
+  {
+    return HAL_ERROR;
+  }
+
+  for (Instance = 0U; Instance < NbInstances; Instance++)
+  {
+    if (hfdcan[Instance] == NULL)
+    {
+      return HAL_ERROR;
+    }
+
+    /* Check function parameters */
+    assert_param(IS_FDCAN_MAX_VALUE(pPlan[Instance].StdFiltersNbr, 128U));
+    assert_param(IS_FDCAN_MAX_VALUE(pPlan[Instance].ExtFiltersNbr, 64U));
+    assert_param(IS_FDCAN_MAX_VALUE(pPlan[Instance].RxFifo0MaxNbr, 64U));
+    assert_param(IS_FDCAN_MAX_VALUE(pPlan[Instance].RxFifo0MinNbr, pPlan[Instance].RxFifo0MaxNbr));
+    if (pPlan[Instance].RxFifo0MaxNbr > 0U)
+    {
+      assert_param(IS_FDCAN_DATA_SIZE(pPlan[Instance].RxFifo0ElmtSize));
+    }
+    assert_param(IS_FDCAN_MAX_VALUE(pPlan[Instance].RxFifo1MaxNbr, 64U));
+    assert_param(IS_FDCAN_MAX_VALUE(pPlan[Instance].RxFifo1MinNbr, pPlan[Instance].RxFifo1MaxNbr));
+    if (pPlan[Instance].RxFifo1MaxNbr > 0U)
+    {
+      assert_param(IS_FDCAN_DATA_SIZE(pPlan[Instance].RxFifo1ElmtSize));
+    }
+    assert_param(IS_FDCAN_MAX_VALUE(pPlan[Instance].RxBuffersNbr, 64U));
+    if (pPlan[Instance].RxBuffersNbr > 0U)
+    {
+      assert_param(IS_FDCAN_DATA_SIZE(pPlan[Instance].RxBufferSize));
+    }
+    assert_param(IS_FDCAN_MAX_VALUE(pPlan[Instance].TxEventsNbr, 32U));
+    assert_param(IS_FDCAN_MAX_VALUE((pPlan[Instance].TxBuffersNbr + pPlan[Instance].TxFifoQueueMaxNbr), 32U));
+    assert_param(IS_FDCAN_MAX_VALUE(pPlan[Instance].TxFifoQueueMinNbr, pPlan[Instance].TxFifoQueueMaxNbr));
+    if ((pPlan[Instance].TxBuffersNbr + pPlan[Instance].TxFifoQueueMaxNbr) > 0U)
+    {
+      assert_param(IS_FDCAN_DATA_SIZE(pPlan[Instance].TxElmtSize));
+    }
+    assert_param(IS_FDCAN_MAX_VALUE(pPlan[Instance].TriggerMemoryNbr, 64U));
+
+    Depth[Instance][0] = pPlan[Instance].RxFifo0MinNbr;
+    MaxDepth[Instance][0] = pPlan[Instance].RxFifo0MaxNbr;
+    EltWords[Instance][0] = pPlan[Instance].RxFifo0ElmtSize;
+    Depth[Instance][1] = pPlan[Instance].RxFifo1MinNbr;
+    MaxDepth[Instance][1] = pPlan[Instance].RxFifo1MaxNbr;
+    EltWords[Instance][1] = pPlan[Instance].RxFifo1ElmtSize;
+    Depth[Instance][2] = pPlan[Instance].TxFifoQueueMinNbr;
+    MaxDepth[Instance][2] = pPlan[Instance].TxFifoQueueMaxNbr;
+    EltWords[Instance][2] = pPlan[Instance].TxElmtSize;
+
+    /* Fixed blocks and minimum FIFO depths, the sizes being given in words */
+    UsedWords += pPlan[Instance].StdFiltersNbr;
+    UsedWords += pPlan[Instance].ExtFiltersNbr * 2U;
+    UsedWords += pPlan[Instance].RxBuffersNbr * pPlan[Instance].RxBufferSize;
+    UsedWords += pPlan[Instance].TxEventsNbr * 2U;
+    UsedWords += pPlan[Instance].TxBuffersNbr * pPlan[Instance].TxElmtSize;
+    UsedWords += pPlan[Instance].TriggerMemoryNbr * 2U;
+    for (Fifo = 0U; Fifo < 3U; Fifo++)
+    {
+      UsedWords += Depth[Instance][Fifo] * EltWords[Instance][Fifo];
+    }
+  }
+
+  if (UsedWords > FDCAN_MESSAGE_RAM_WORDS)
+  {
+    /* The requirements overflow the message RAM */
+    return HAL_ERROR;
+  }
+
+  /* Grow the FIFOs with the RAM left */
+  do
+  {
+    BestInstance = NbInstances;
+    BestFifo = 0U;
+    for (Instance = 0U; Instance < NbInstances; Instance++)
+    {
+      for (Fifo = 0U; Fifo < 3U; Fifo++)
+      {
+        if ((Depth[Instance][Fifo] < MaxDepth[Instance][Fifo]) &&
+            (EltWords[Instance][Fifo] != 0U) &&
+            ((UsedWords + EltWords[Instance][Fifo]) <= FDCAN_MESSAGE_RAM_WORDS))
+        {
+          if ((BestInstance == NbInstances) ||
+              (Depth[Instance][Fifo] < Depth[BestInstance][BestFifo]) ||
+              ((Depth[Instance][Fifo] == Depth[BestInstance][BestFifo]) &&
+               (EltWords[Instance][Fifo] < EltWords[BestInstance][BestFifo])))
+          {
+            BestInstance = Instance;
+            BestFifo = Fifo;
+          }
+        }
+      }
+    }
+
+    if (BestInstance != NbInstances)
+    {
+      Depth[BestInstance][BestFifo]++;
+      UsedWords += EltWords[BestInstance][BestFifo];
+    }
+  } while (BestInstance != NbInstances);
+
+  /* Set the message RAM fields of the Init structures */
+  for (Instance = 0U; Instance < NbInstances; Instance++)
+  {
+    hfdcan[Instance]->Init.MessageRAMOffset = Offset;
+    hfdcan[Instance]->Init.StdFiltersNbr = pPlan[Instance].StdFiltersNbr;
+    hfdcan[Instance]->Init.ExtFiltersNbr = pPlan[Instance].ExtFiltersNbr;
+    hfdcan[Instance]->Init.RxFifo0ElmtsNbr = Depth[Instance][0];
+    hfdcan[Instance]->Init.RxFifo0ElmtSize = pPlan[Instance].RxFifo0ElmtSize;
+    hfdcan[Instance]->Init.RxFifo1ElmtsNbr = Depth[Instance][1];
+    hfdcan[Instance]->Init.RxFifo1ElmtSize = pPlan[Instance].RxFifo1ElmtSize;
+    hfdcan[Instance]->Init.RxBuffersNbr = pPlan[Instance].RxBuffersNbr;
+    hfdcan[Instance]->Init.RxBufferSize = pPlan[Instance].RxBufferSize;
+    hfdcan[Instance]->Init.TxEventsNbr = pPlan[Instance].TxEventsNbr;
+    hfdcan[Instance]->Init.TxBuffersNbr = pPlan[Instance].TxBuffersNbr;
+    hfdcan[Instance]->Init.TxFifoQueueElmtsNbr = Depth[Instance][2];
+    hfdcan[Instance]->Init.TxElmtSize = pPlan[Instance].TxElmtSize;
+
+    /* Next instance after the blocks and the trigger memory of this one */
+    Offset += pPlan[Instance].StdFiltersNbr + (pPlan[Instance].ExtFiltersNbr * 2U);
+    Offset += (Depth[Instance][0] * pPlan[Instance].RxFifo0ElmtSize) + (Depth[Instance][1] * pPlan[Instance].RxFifo1ElmtSize);
+    Offset += (pPlan[Instance].RxBuffersNbr * pPlan[Instance].RxBufferSize) + (pPlan[Instance].TxEventsNbr * 2U);
+    Offset += (pPlan[Instance].TxBuffersNbr + Depth[Instance][2]) * pPlan[Instance].TxElmtSize;
+    Offset += pPlan[Instance].TriggerMemoryNbr * 2U;
+  }
+
+  /* Return function status */
+  return HAL_OK;
+}
+
 #if USE_HAL_FDCAN_REGISTER_CALLBACKS == 1
 /**
   * @brief  Register a FDCAN CallBack.
@@ -2555,6 +2778,13 @@ HAL_StatusTypeDef HAL_FDCAN_DisableEdgeFiltering(FDCAN_HandleTypeDef *hfdcan)
       (+) HAL_FDCAN_GetLatestTxFifoQRequestBuffer : Get Tx buffer index of latest Tx FIFO/Queue request
       (+) HAL_FDCAN_AbortTxRequest                : Abort transmission request
       (+) HAL_FDCAN_GetRxMessage                  : Get an FDCAN frame from the Rx Buffer/FIFO zone into the message RAM
+      (+) HAL_FDCAN_GetRxFifoSpan                 : Get the span of the elements of an Rx FIFO, to be read in place
+      (+) HAL_FDCAN_DecodeRxElement               : Decode the header of an Rx element of the message RAM
+      (+) HAL_FDCAN_ReleaseRxFifoSpan             : Acknowledge the first elements of an Rx FIFO span
+      (+) HAL_FDCAN_TxSchedInit                   : Attach a software Tx scheduler to dedicated Tx buffers
+      (+) HAL_FDCAN_TxSchedDeInit                 : Detach the software Tx scheduler
+      (+) HAL_FDCAN_TxSchedEnqueue                : Queue a frame in the software Tx scheduler
+      (+) HAL_FDCAN_TxSchedGetPending             : Return the number of frames not yet sent by the software Tx scheduler
       (+) HAL_FDCAN_GetTxEvent                    : Get an FDCAN Tx event from the Tx Event FIFO zone into the message RAM
       (+) HAL_FDCAN_GetHighPriorityMessageStatus  : Get high priority message status
       (+) HAL_FDCAN_GetProtocolStatus             : Get protocol status
@@ -3093,6 +3323,407 @@ HAL_StatusTypeDef HAL_FDCAN_GetRxMessage(FDCAN_HandleTypeDef *hfdcan, uint32_t R
   }
 }
 
+/**
+  * @brief  Get the span of the elements stored in an Rx FIFO, to be read in place
+  *         in the message RAM.
+  * @note   The elements are accessed with __HAL_FDCAN_GET_SPAN_ELEMENT(), then decoded
+  *         field by field with the __HAL_FDCAN_GET_ELEMENT_xxx() macros, or fully
+  *         with HAL_FDCAN_DecodeRxElement(). They stay valid until they are
+  *         acknowledged with HAL_FDCAN_ReleaseRxFifoSpan().
+  * @note   In overwrite mode, when the FIFO is full, the oldest element is left out
+  *         since it is overwritten by the next received message. The FIFO should be
+  *         configured in blocking mode for a safe in place reading.
+  * @param  hfdcan pointer to an FDCAN_HandleTypeDef structure that contains
+  *         the configuration information for the specified FDCAN.
+  * @param  RxFifo Rx FIFO.
+  *         This parameter can be one of the following values:
+  *           @arg FDCAN_RX_FIFO0: Rx FIFO 0
+  *           @arg FDCAN_RX_FIFO1: Rx FIFO 1
+  * @param  pSpan pointer to a FDCAN_RxFifoSpanTypeDef structure, Count is 0 when
+  *         the FIFO is empty.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_FDCAN_GetRxFifoSpan(FDCAN_HandleTypeDef *hfdcan, uint32_t RxFifo, FDCAN_RxFifoSpanTypeDef *pSpan)
+{
+  uint32_t Status;
+  uint32_t Overwrite;
+
+  /* Check function parameters */
+  assert_param(IS_FDCAN_RX_FIFO(RxFifo));
+
+  if (hfdcan->State != HAL_FDCAN_STATE_BUSY)
+  {
+    /* Update error code */
+    hfdcan->ErrorCode |= HAL_FDCAN_ERROR_NOT_STARTED;
+
+    return HAL_ERROR;
+  }
+
+  if (RxFifo == FDCAN_RX_FIFO0)
+  {
+    /* Check that the Rx FIFO 0 has an allocated area into the RAM */
+    if ((hfdcan->Instance->RXF0C & FDCAN_RXF0C_F0S) == 0U)
+    {
+      /* Update error code */
+      hfdcan->ErrorCode |= HAL_FDCAN_ERROR_PARAM;
+
+      return HAL_ERROR;
+    }
+
+    Status = hfdcan->Instance->RXF0S;
+    Overwrite = (hfdcan->Instance->RXF0C & FDCAN_RXF0C_F0OM) >> FDCAN_RXF0C_F0OM_Pos;
+    pSpan->Count = Status & FDCAN_RXF0S_F0FL;
+    pSpan->GetIndex = (Status & FDCAN_RXF0S_F0GI) >> FDCAN_RXF0S_F0GI_Pos;
+    pSpan->FifoStartAddress = hfdcan->msgRam.RxFIFO0SA;
+    pSpan->ElementsNbr = hfdcan->Init.RxFifo0ElmtsNbr;
+    pSpan->ElementSize = hfdcan->Init.RxFifo0ElmtSize;
+    Status &= FDCAN_RXF0S_F0F;
+  }
+  else /* RxFifo == FDCAN_RX_FIFO1 */
+  {
+    /* Check that the Rx FIFO 1 has an allocated area into the RAM */
+    if ((hfdcan->Instance->RXF1C & FDCAN_RXF1C_F1S) == 0U)
+    {
+      /* Update error code */
+      hfdcan->ErrorCode |= HAL_FDCAN_ERROR_PARAM;
+
+      return HAL_ERROR;
+    }
+
+    Status = hfdcan->Instance->RXF1S;
+    Overwrite = (hfdcan->Instance->RXF1C & FDCAN_RXF1C_F1OM) >> FDCAN_RXF1C_F1OM_Pos;
+    pSpan->Count = Status & FDCAN_RXF1S_F1FL;
+    pSpan->GetIndex = (Status & FDCAN_RXF1S_F1GI) >> FDCAN_RXF1S_F1GI_Pos;
+    pSpan->FifoStartAddress = hfdcan->msgRam.RxFIFO1SA;
+    pSpan->ElementsNbr = hfdcan->Init.RxFifo1ElmtsNbr;
+    pSpan->ElementSize = hfdcan->Init.RxFifo1ElmtSize;
+    Status &= FDCAN_RXF1S_F1F;
+  }
+
+  pSpan->RxFifo = RxFifo;
+
+  /* When the FIFO is full in overwrite mode, discard the oldest element */
+  if ((Status != 0U) && (Overwrite == FDCAN_RX_FIFO_OVERWRITE) && (pSpan->Count != 0U))
+  {
+    pSpan->GetIndex = (pSpan->GetIndex + 1U) % pSpan->ElementsNbr;
+    pSpan->Count--;
+  }
+
+  /* Return function status */
+  return HAL_OK;
+}
+
+/**
+  * @brief  Decode the header of an Rx element of the message RAM.
+  * @param  pElement address of the Rx element, for instance returned by
+  *         __HAL_FDCAN_GET_SPAN_ELEMENT().
+  * @param  pRxHeader pointer to a FDCAN_RxHeaderTypeDef structure.
+  * @retval None
+  */
+void HAL_FDCAN_DecodeRxElement(const uint32_t *pElement, FDCAN_RxHeaderTypeDef *pRxHeader)
+{
+  uint32_t Word0 = pElement[0];
+  uint32_t Word1 = pElement[1];
+
+  /* Retrieve IdType and Identifier */
+  pRxHeader->IdType = Word0 & FDCAN_ELEMENT_MASK_XTD;
+  if (pRxHeader->IdType == FDCAN_STANDARD_ID) /* Standard ID element */
+  {
+    pRxHeader->Identifier = ((Word0 & FDCAN_ELEMENT_MASK_STDID) >> 18);
+  }
+  else /* Extended ID element */
+  {
+    pRxHeader->Identifier = (Word0 & FDCAN_ELEMENT_MASK_EXTID);
+  }
+
+  /* Retrieve RxFrameType and ErrorStateIndicator */
+  pRxHeader->RxFrameType = (Word0 & FDCAN_ELEMENT_MASK_RTR);
+  pRxHeader->ErrorStateIndicator = (Word0 & FDCAN_ELEMENT_MASK_ESI);
+
+  /* Retrieve the fields of the second word */
+  pRxHeader->RxTimestamp = (Word1 & FDCAN_ELEMENT_MASK_TS);
+  pRxHeader->DataLength = (Word1 & FDCAN_ELEMENT_MASK_DLC);
+  pRxHeader->BitRateSwitch = (Word1 & FDCAN_ELEMENT_MASK_BRS);
+  pRxHeader->FDFormat = (Word1 & FDCAN_ELEMENT_MASK_FDF);
+  pRxHeader->FilterIndex = ((Word1 & FDCAN_ELEMENT_MASK_FIDX) >> 24);
+  pRxHeader->IsFilterMatchingFrame = ((Word1 & FDCAN_ELEMENT_MASK_ANMF) >> 31);
+}
+
+/**
+  * @brief  Acknowledge the first elements of an Rx FIFO span with a single write.
+  * @param  hfdcan pointer to an FDCAN_HandleTypeDef structure that contains
+  *         the configuration information for the specified FDCAN.
+  * @param  pSpan pointer to the FDCAN_RxFifoSpanTypeDef structure returned by
+  *         HAL_FDCAN_GetRxFifoSpan().
+  * @param  Count number of elements to acknowledge, from 1 to pSpan->Count.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_FDCAN_ReleaseRxFifoSpan(FDCAN_HandleTypeDef *hfdcan, const FDCAN_RxFifoSpanTypeDef *pSpan, uint32_t Count)
+{
+  uint32_t AckIndex;
+
+  if ((Count == 0U) || (Count > pSpan->Count))
+  {
+    /* Update error code */
+    hfdcan->ErrorCode |= HAL_FDCAN_ERROR_PARAM;
+
+    return HAL_ERROR;
+  }
+
+  /* Index of the last element read: all the elements up to it are released */
+  AckIndex = (pSpan->GetIndex + Count - 1U) % pSpan->ElementsNbr;
+
+  if (pSpan->RxFifo == FDCAN_RX_FIFO0)
+  {
+    hfdcan->Instance->RXF0A = AckIndex;
+  }
+  else /* pSpan->RxFifo == FDCAN_RX_FIFO1 */
+  {
+    hfdcan->Instance->RXF1A = AckIndex;
+  }
+
+  /* Return function status */
+  return HAL_OK;
+}
+
+/**
+  * @brief  Attach a software Tx scheduler to a range of dedicated Tx buffers.
+  * @param  hfdcan pointer to an FDCAN_HandleTypeDef structure that contains
+  *         the configuration information for the specified FDCAN.
+  * @param  pTxSched pointer to a FDCAN_TxSchedTypeDef structure whose pool,
+  *         queue array and buffer range are set.
+  * @note   The Tx complete and Tx abort complete notifications of the buffers
+  *         are activated: the FDCAN interrupt must be enabled in the NVIC.
+  * @note   No other function should add messages to the buffers of the range.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_FDCAN_TxSchedInit(FDCAN_HandleTypeDef *hfdcan, FDCAN_TxSchedTypeDef *pTxSched)
+{
+  uint32_t BufferMask;
+  uint32_t Index;
+  HAL_FDCAN_StateTypeDef state = hfdcan->State;
+
+  /* Check function parameters */
+  assert_param(IS_FDCAN_MAX_VALUE(pTxSched->FirstBuffer, 31U));
+  assert_param(IS_FDCAN_MIN_VALUE(pTxSched->NbBuffers, 1U));
+  assert_param(IS_FDCAN_MIN_VALUE(pTxSched->NbEntries, 1U));
+
+  if ((state == HAL_FDCAN_STATE_READY) || (state == HAL_FDCAN_STATE_BUSY))
+  {
+    /* Check that the buffers are allocated into the RAM and that the pool is provided */
+    if ((pTxSched->NbBuffers == 0U) || (pTxSched->NbEntries == 0U) ||
+        (pTxSched->pEntries == NULL) || (pTxSched->pQueue == NULL) ||
+        ((pTxSched->FirstBuffer + pTxSched->NbBuffers) >
+         ((hfdcan->Instance->TXBC & FDCAN_TXBC_NDTB) >> FDCAN_TXBC_NDTB_Pos)))
+    {
+      /* Update error code */
+      hfdcan->ErrorCode |= HAL_FDCAN_ERROR_PARAM;
+
+      return HAL_ERROR;
+    }
+
+    if (pTxSched->NbBuffers == 32U)
+    {
+      BufferMask = 0xFFFFFFFFU;
+    }
+    else
+    {
+      BufferMask = ((1UL << pTxSched->NbBuffers) - 1U) << pTxSched->FirstBuffer;
+    }
+
+    /* Check that there is no transmission request pending for the buffers */
+    if ((hfdcan->Instance->TXBRP & BufferMask) != 0U)
+    {
+      /* Update error code */
+      hfdcan->ErrorCode |= HAL_FDCAN_ERROR_PENDING;
+
+      return HAL_ERROR;
+    }
+
+    /* All the entries are free, the priority heap is empty */
+    for (Index = 0U; Index < pTxSched->NbEntries; Index++)
+    {
+      pTxSched->pQueue[Index] = &pTxSched->pEntries[Index];
+    }
+    for (Index = 0U; Index < 32U; Index++)
+    {
+      pTxSched->pInFlight[Index] = NULL;
+    }
+    pTxSched->BufferMask   = BufferMask;
+    pTxSched->PendingMask  = 0U;
+    pTxSched->CancelMask   = 0U;
+    pTxSched->QueueCount   = 0U;
+    pTxSched->FreeCount    = pTxSched->NbEntries;
+    pTxSched->NextSeq      = 0U;
+    pTxSched->PreemptCount = 0U;
+
+    hfdcan->pTxSched = pTxSched;
+
+    /* Release and cancellation of the buffers are handled by the IRQ handler */
+    return HAL_FDCAN_ActivateNotification(hfdcan, FDCAN_IT_TX_COMPLETE | FDCAN_IT_TX_ABORT_COMPLETE, BufferMask);
+  }
+  else
+  {
+    /* Update error code */
+    hfdcan->ErrorCode |= HAL_FDCAN_ERROR_NOT_INITIALIZED;
+
+    return HAL_ERROR;
+  }
+}
+
+/**
+  * @brief  Detach the software Tx scheduler.
+  * @param  hfdcan pointer to an FDCAN_HandleTypeDef structure that contains
+  *         the configuration information for the specified FDCAN.
+  * @note   The transmission requests pending in the managed buffers are
+  *         cancelled, and the frames of the software queue are dropped.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_FDCAN_TxSchedDeInit(FDCAN_HandleTypeDef *hfdcan)
+{
+  FDCAN_TxSchedTypeDef *pTxSched = hfdcan->pTxSched;
+
+  if (pTxSched == NULL)
+  {
+    /* Update error code */
+    hfdcan->ErrorCode |= HAL_FDCAN_ERROR_NOT_READY;
+
+    return HAL_ERROR;
+  }
+
+  /* Stop the refill from the IRQ handler before cancelling the buffers */
+  CLEAR_BIT(hfdcan->Instance->TXBTIE, pTxSched->BufferMask);
+  CLEAR_BIT(hfdcan->Instance->TXBCIE, pTxSched->BufferMask);
+  hfdcan->pTxSched = NULL;
+
+  if (hfdcan->State == HAL_FDCAN_STATE_BUSY)
+  {
+    hfdcan->Instance->TXBCR = pTxSched->PendingMask;
+  }
+
+  pTxSched->QueueCount  = 0U;
+  pTxSched->PendingMask = 0U;
+  pTxSched->CancelMask  = 0U;
+
+  /* Return function status */
+  return HAL_OK;
+}
+
+/**
+  * @brief  Queue a frame in the software Tx scheduler.
+  * @param  hfdcan pointer to an FDCAN_HandleTypeDef structure that contains
+  *         the configuration information for the specified FDCAN.
+  * @param  pTxHeader pointer to a FDCAN_TxHeaderTypeDef structure.
+  * @param  pTxData pointer to a buffer containing the payload of the Tx frame.
+  * @note   The frame is copied: the caller buffers can be reused on return.
+  *         Frames of same identifier are sent in their enqueue order.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_FDCAN_TxSchedEnqueue(FDCAN_HandleTypeDef *hfdcan, const FDCAN_TxHeaderTypeDef *pTxHeader, const uint8_t *pTxData)
+{
+  FDCAN_TxSchedTypeDef *pTxSched = hfdcan->pTxSched;
+  FDCAN_TxSchedEntryTypeDef *pEntry;
+  uint32_t ByteCounter;
+  uint32_t ByteNumber;
+  uint32_t primask;
+
+  /* Check function parameters */
+  assert_param(IS_FDCAN_ID_TYPE(pTxHeader->IdType));
+  if (pTxHeader->IdType == FDCAN_STANDARD_ID)
+  {
+    assert_param(IS_FDCAN_MAX_VALUE(pTxHeader->Identifier, 0x7FFU));
+  }
+  else /* pTxHeader->IdType == FDCAN_EXTENDED_ID */
+  {
+    assert_param(IS_FDCAN_MAX_VALUE(pTxHeader->Identifier, 0x1FFFFFFFU));
+  }
+  assert_param(IS_FDCAN_FRAME_TYPE(pTxHeader->TxFrameType));
+  assert_param(IS_FDCAN_DLC(pTxHeader->DataLength));
+  assert_param(IS_FDCAN_ESI(pTxHeader->ErrorStateIndicator));
+  assert_param(IS_FDCAN_BRS(pTxHeader->BitRateSwitch));
+  assert_param(IS_FDCAN_FDF(pTxHeader->FDFormat));
+  assert_param(IS_FDCAN_EFC(pTxHeader->TxEventFifoControl));
+  assert_param(IS_FDCAN_MAX_VALUE(pTxHeader->MessageMarker, 0xFFU));
+
+  if ((hfdcan->State != HAL_FDCAN_STATE_BUSY) || (pTxSched == NULL))
+  {
+    /* Update error code */
+    hfdcan->ErrorCode |= HAL_FDCAN_ERROR_NOT_STARTED;
+
+    return HAL_ERROR;
+  }
+
+  /* The queue is shared with the IRQ handler */
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  if (pTxSched->FreeCount == 0U)
+  {
+    __set_PRIMASK(primask);
+
+    /* Update error code */
+    hfdcan->ErrorCode |= HAL_FDCAN_ERROR_FIFO_FULL;
+
+    return HAL_ERROR;
+  }
+
+  /* Take the last free entry */
+  pTxSched->FreeCount--;
+  pEntry = pTxSched->pQueue[pTxSched->QueueCount + pTxSched->FreeCount];
+
+  pEntry->Header = *pTxHeader;
+  ByteNumber = DLCtoBytes[pTxHeader->DataLength >> 16U];
+  for (ByteCounter = 0U; ByteCounter < ByteNumber; ByteCounter++)
+  {
+    pEntry->Data[ByteCounter] = pTxData[ByteCounter];
+  }
+
+  /* Arbitration field in bus order: base identifier, RTR or SRR, IDE,
+     identifier extension, RTR. The lowest key wins the arbitration */
+  if (pTxHeader->IdType == FDCAN_STANDARD_ID)
+  {
+    pEntry->Key = (pTxHeader->Identifier << 21U) |
+                  ((pTxHeader->TxFrameType == FDCAN_REMOTE_FRAME) ? (1UL << 20U) : 0U);
+  }
+  else /* pTxHeader->IdType == FDCAN_EXTENDED_ID */
+  {
+    pEntry->Key = ((pTxHeader->Identifier >> 18U) << 21U) | (1UL << 20U) | (1UL << 19U) |
+                  ((pTxHeader->Identifier & 0x3FFFFU) << 1U) |
+                  ((pTxHeader->TxFrameType == FDCAN_REMOTE_FRAME) ? 1U : 0U);
+  }
+  pEntry->Seq = pTxSched->NextSeq;
+  pTxSched->NextSeq++;
+
+  FDCAN_TxSchedPush(pTxSched, pEntry);
+
+  /* Feed the free buffers, or preempt the buffer of lowest priority */
+  FDCAN_TxSchedService(hfdcan);
+
+  __set_PRIMASK(primask);
+
+  /* Return function status */
+  return HAL_OK;
+}
+
+/**
+  * @brief  Return the number of frames not yet sent by the software Tx scheduler.
+  * @param  hfdcan pointer to an FDCAN_HandleTypeDef structure that contains
+  *         the configuration information for the specified FDCAN.
+  * @retval Number of frames waiting in the software queue or in the Tx buffers
+  */
+uint32_t HAL_FDCAN_TxSchedGetPending(FDCAN_HandleTypeDef *hfdcan)
+{
+  FDCAN_TxSchedTypeDef *pTxSched = hfdcan->pTxSched;
+
+  if (pTxSched == NULL)
+  {
+    return 0U;
+  }
+
+  /* Entries not free are either queued or held by a buffer */
+  return (pTxSched->NbEntries - pTxSched->FreeCount);
+}
+
 /**
   * @brief  Get an FDCAN Tx event from the Tx Event FIFO zone into the message RAM.
   * @param  hfdcan pointer to an FDCAN_HandleTypeDef structure that contains
@@ -3425,6 +4056,7 @@ HAL_StatusTypeDef HAL_FDCAN_ExitRestrictedOperationMode(FDCAN_HandleTypeDef *hfd
       (+) HAL_FDCAN_TT_ConfigOperation                  : Initialize TT operation parameters
       (+) HAL_FDCAN_TT_ConfigReferenceMessage           : Configure the reference message
       (+) HAL_FDCAN_TT_ConfigTrigger                    : Configure the FDCAN trigger
+      (+) HAL_FDCAN_TT_ConfigTxSchedWindow              : Configure the arbitrating window of the software Tx scheduler
       (+) HAL_FDCAN_TT_SetGlobalTime                    : Schedule global time adjustment
       (+) HAL_FDCAN_TT_SetClockSynchronization          : Schedule TUR numerator update
       (+) HAL_FDCAN_TT_ConfigStopWatch                  : Configure stop watch source and polarity
@@ -3589,6 +4221,14 @@ HAL_StatusTypeDef HAL_FDCAN_TT_ConfigOperation(FDCAN_HandleTypeDef *hfdcan, FDCA
 
       return HAL_ERROR;
     }
+    else if (FDCAN_CheckRamOverlap(hfdcan, hfdcan->msgRam.TTMemorySA, hfdcan->msgRam.EndAddress) != HAL_OK)
+    {
+      /* Update error code.
+         Trigger memory overlapping the Message RAM blocks of another instance */
+      hfdcan->ErrorCode |= HAL_FDCAN_ERROR_PARAM;
+
+      return HAL_ERROR;
+    }
     else
     {
       /* Flush the allocated Message RAM area */
@@ -3780,6 +4420,56 @@ HAL_StatusTypeDef HAL_FDCAN_TT_ConfigTrigger(FDCAN_HandleTypeDef *hfdcan, FDCAN_
   }
 }
 
+/**
+  * @brief  Configure the arbitrating time window of the software Tx scheduler.
+  * @param  hfdcan pointer to an FDCAN_HandleTypeDef structure that contains
+  *         the configuration information for the specified FDCAN.
+  * @param  sTriggerConfig pointer to an FDCAN_TriggerTypeDef structure giving
+  *         the first trigger index, the time mark, the repeat factor, the start
+  *         cycle and the time mark events of the window. The trigger type and
+  *         Tx buffer index are ignored.
+  * @note   One trigger is written per managed buffer, from TriggerIndex: merged
+  *         arbitration triggers closed by an arbitration trigger, so that all
+  *         the managed buffers compete in the same window. The system matrix
+  *         must keep the trigger list ordered by time mark.
+  * @note   HAL_FDCAN_TxSchedInit must have been called.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_FDCAN_TT_ConfigTxSchedWindow(FDCAN_HandleTypeDef *hfdcan, FDCAN_TriggerTypeDef *sTriggerConfig)
+{
+  FDCAN_TxSchedTypeDef *pTxSched = hfdcan->pTxSched;
+  FDCAN_TriggerTypeDef TriggerConfig;
+  uint32_t Index;
+
+  /* Check function parameters */
+  assert_param(IS_FDCAN_TT_INSTANCE(hfdcan->Instance));
+
+  if ((pTxSched == NULL) || ((sTriggerConfig->TriggerIndex + pTxSched->NbBuffers) > 64U))
+  {
+    /* Update error code */
+    hfdcan->ErrorCode |= HAL_FDCAN_ERROR_PARAM;
+
+    return HAL_ERROR;
+  }
+
+  TriggerConfig = *sTriggerConfig;
+  for (Index = 0U; Index < pTxSched->NbBuffers; Index++)
+  {
+    TriggerConfig.TriggerIndex  = sTriggerConfig->TriggerIndex + Index;
+    TriggerConfig.TxBufferIndex = 1UL << (pTxSched->FirstBuffer + Index);
+    TriggerConfig.TriggerType   = (Index == (pTxSched->NbBuffers - 1U)) ?
+                                  FDCAN_TT_TX_TRIGGER_ARBITRATION : FDCAN_TT_TX_TRIGGER_MERGED;
+
+    if (HAL_FDCAN_TT_ConfigTrigger(hfdcan, &TriggerConfig) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  /* Return function status */
+  return HAL_OK;
+}
+
 /**
   * @brief  Schedule global time adjustment for the next reference message.
   * @param  hfdcan pointer to an FDCAN_HandleTypeDef structure that contains
@@ -5314,6 +6004,12 @@ void HAL_FDCAN_IRQHandler(FDCAN_HandleTypeDef *hfdcan)
       /* Clear the Transmission Cancellation flag */
       __HAL_FDCAN_CLEAR_FLAG(hfdcan, FDCAN_FLAG_TX_ABORT_COMPLETE);
 
+      /* Requeue the cancelled frames and refill the released buffers */
+      if (hfdcan->pTxSched != NULL)
+      {
+        FDCAN_TxSchedService(hfdcan);
+      }
+
 #if USE_HAL_FDCAN_REGISTER_CALLBACKS == 1
       /* Call registered callback*/
       hfdcan->TxBufferAbortCallback(hfdcan, AbortedBuffers);
@@ -5414,6 +6110,12 @@ void HAL_FDCAN_IRQHandler(FDCAN_HandleTypeDef *hfdcan)
       /* Clear the Transmission Complete flag */
       __HAL_FDCAN_CLEAR_FLAG(hfdcan, FDCAN_FLAG_TX_COMPLETE);
 
+      /* Refill the released buffers with the next frames of highest priority */
+      if (hfdcan->pTxSched != NULL)
+      {
+        FDCAN_TxSchedService(hfdcan);
+      }
+
 #if USE_HAL_FDCAN_REGISTER_CALLBACKS == 1
       /* Call registered callback*/
       hfdcan->TxBufferCompleteCallback(hfdcan, TransmittedBuffers);
@@ -6116,6 +6818,20 @@ static HAL_StatusTypeDef FDCAN_CalcultateRamBlockAddresses(FDCAN_HandleTypeDef *
 
     return HAL_ERROR;
   }
+  else if (FDCAN_CheckRamOverlap(hfdcan, hfdcan->msgRam.StandardFilterSA, hfdcan->msgRam.EndAddress) != HAL_OK)
+  {
+    /* Release the blocks, so that they do not block the initialization of the other instances */
+    FDCAN_ReleaseRamBlocks(hfdcan);
+
+    /* Update error code.
+       Message RAM blocks overlapping the ones of another instance */
+    hfdcan->ErrorCode |= HAL_FDCAN_ERROR_PARAM;
+
+    /* Change FDCAN state */
+    hfdcan->State = HAL_FDCAN_STATE_ERROR;
+
+    return HAL_ERROR;
+  }
   else
   {
     /* Flush the allocated Message RAM area */
@@ -6129,6 +6845,87 @@ static HAL_StatusTypeDef FDCAN_CalcultateRamBlockAddresses(FDCAN_HandleTypeDef *
   return HAL_OK;
 }
 
+/**
+  * @brief  Check that a message RAM area does not overlap the blocks of the other instances.
+  * @note   The blocks of the other instances are read from their configuration
+  *         registers, from the standard filter list to the end of the Tx FIFO/Queue,
+  *         and the trigger memory when allocated.
+  * @param  hfdcan pointer to an FDCAN_HandleTypeDef structure that contains
+  *         the configuration information for the specified FDCAN.
+  * @param  StartAddress first address of the area.
+  * @param  EndAddress address following the area.
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef FDCAN_CheckRamOverlap(FDCAN_HandleTypeDef *hfdcan, uint32_t StartAddress, uint32_t EndAddress)
+{
+  const FDCAN_GlobalTypeDef *Instance;
+  const TTCAN_TypeDef *ttcan;
+  uint32_t InstanceIndex;
+  uint32_t BlocksStart;
+  uint32_t BlocksEnd;
+  uint32_t TriggerEnd;
+
+  for (InstanceIndex = 0U; InstanceIndex < FDCAN_INSTANCES_NBR; InstanceIndex++)
+  {
+    Instance = FDCANInstances[InstanceIndex];
+    if (Instance != hfdcan->Instance)
+    {
+      BlocksStart = SRAMCAN_BASE + (((Instance->SIDFC & FDCAN_SIDFC_FLSSA) >> FDCAN_SIDFC_FLSSA_Pos) * 4U);
+      BlocksEnd = SRAMCAN_BASE + (((Instance->TXBC & FDCAN_TXBC_TBSA) >> FDCAN_TXBC_TBSA_Pos) * 4U);
+      BlocksEnd += ((((Instance->TXBC & FDCAN_TXBC_NDTB) >> FDCAN_TXBC_NDTB_Pos) +
+                     ((Instance->TXBC & FDCAN_TXBC_TFQS) >> FDCAN_TXBC_TFQS_Pos)) *
+                    EltSizeToWords[(Instance->TXESC & FDCAN_TXESC_TBDS) >> FDCAN_TXESC_TBDS_Pos] * 4U);
+
+      if (Instance == FDCAN1)
+      {
+        ttcan = (const TTCAN_TypeDef *)((uint32_t)Instance + 0x100U);
+        if ((ttcan->TTTMC & FDCAN_TTTMC_TME) != 0U)
+        {
+          TriggerEnd = SRAMCAN_BASE + (((ttcan->TTTMC & FDCAN_TTTMC_TMSA) >> FDCAN_TTTMC_TMSA_Pos) * 4U);
+          TriggerEnd += (((ttcan->TTTMC & FDCAN_TTTMC_TME) >> FDCAN_TTTMC_TME_Pos) * 2U * 4U);
+          if (TriggerEnd > BlocksEnd)
+          {
+            BlocksEnd = TriggerEnd;
+          }
+        }
+      }
+
+      /* Instance without blocks when its blocks are empty (reset or released) */
+      if ((BlocksEnd > BlocksStart) && (StartAddress < BlocksEnd) && (BlocksStart < EndAddress))
+      {
+        return HAL_ERROR;
+      }
+    }
+  }
+
+  /* Return function status */
+  return HAL_OK;
+}
+
+/**
+  * @brief  Release the message RAM blocks of an instance.
+  * @note   The configuration registers are only written in initialization mode
+  *         with the configuration change enabled.
+  * @param  hfdcan pointer to an FDCAN_HandleTypeDef structure that contains
+  *         the configuration information for the specified FDCAN.
+  * @retval None
+  */
+static void FDCAN_ReleaseRamBlocks(FDCAN_HandleTypeDef *hfdcan)
+{
+  hfdcan->Instance->SIDFC = 0U;
+  hfdcan->Instance->XIDFC = 0U;
+  hfdcan->Instance->RXF0C = 0U;
+  hfdcan->Instance->RXF1C = 0U;
+  hfdcan->Instance->RXBC = 0U;
+  hfdcan->Instance->TXEFC = 0U;
+  hfdcan->Instance->TXBC = 0U;
+
+  if (hfdcan->Instance == FDCAN1)
+  {
+    ((TTCAN_TypeDef *)((uint32_t)hfdcan->Instance + 0x100U))->TTTMC = 0U;
+  }
+}
+
 /**
   * @brief  Copy Tx message to the message RAM.
   * @param  hfdcan pointer to an FDCAN_HandleTypeDef structure that contains
@@ -6188,6 +6985,185 @@ static void FDCAN_CopyMessageToRAM(FDCAN_HandleTypeDef *hfdcan, FDCAN_TxHeaderTy
   }
 }
 
+/**
+  * @brief  Check if a scheduler entry wins the arbitration against another one.
+  * @param  pEntryA pointer to the first entry.
+  * @param  pEntryB pointer to the second entry.
+  * @retval 1 if pEntryA is to be sent before pEntryB, 0 otherwise
+  */
+static uint32_t FDCAN_TxSchedIsBefore(const FDCAN_TxSchedEntryTypeDef *pEntryA, const FDCAN_TxSchedEntryTypeDef *pEntryB)
+{
+  if (pEntryA->Key != pEntryB->Key)
+  {
+    return (pEntryA->Key < pEntryB->Key) ? 1U : 0U;
+  }
+
+  /* Same identifier: keep the enqueue order */
+  return ((int32_t)(pEntryA->Seq - pEntryB->Seq) < 0) ? 1U : 0U;
+}
+
+/**
+  * @brief  Insert an entry in the priority heap of the Tx scheduler.
+  * @param  pTxSched pointer to a FDCAN_TxSchedTypeDef structure.
+  * @param  pEntry pointer to an entry held neither by the heap nor by the free list.
+  * @retval None
+  */
+static void FDCAN_TxSchedPush(FDCAN_TxSchedTypeDef *pTxSched, FDCAN_TxSchedEntryTypeDef *pEntry)
+{
+  uint32_t Index = pTxSched->QueueCount;
+  uint32_t Parent;
+
+  /* Move the first free entry out of the way of the heap */
+  if (pTxSched->FreeCount != 0U)
+  {
+    pTxSched->pQueue[Index + pTxSched->FreeCount] = pTxSched->pQueue[Index];
+  }
+
+  /* Sift up */
+  while (Index != 0U)
+  {
+    Parent = (Index - 1U) / 2U;
+    if (FDCAN_TxSchedIsBefore(pEntry, pTxSched->pQueue[Parent]) == 0U)
+    {
+      break;
+    }
+    pTxSched->pQueue[Index] = pTxSched->pQueue[Parent];
+    Index = Parent;
+  }
+  pTxSched->pQueue[Index] = pEntry;
+  pTxSched->QueueCount++;
+}
+
+/**
+  * @brief  Remove the entry of highest priority from the heap of the Tx scheduler.
+  * @param  pTxSched pointer to a FDCAN_TxSchedTypeDef structure with a non-empty heap.
+  * @retval Entry of highest priority
+  */
+static FDCAN_TxSchedEntryTypeDef *FDCAN_TxSchedPop(FDCAN_TxSchedTypeDef *pTxSched)
+{
+  FDCAN_TxSchedEntryTypeDef *pTop = pTxSched->pQueue[0];
+  FDCAN_TxSchedEntryTypeDef *pLast;
+  uint32_t Count;
+  uint32_t Index = 0U;
+  uint32_t Child;
+
+  pTxSched->QueueCount--;
+  Count = pTxSched->QueueCount;
+  pLast = pTxSched->pQueue[Count];
+
+  /* Sift down the last entry from the root */
+  Child = 1U;
+  while (Child < Count)
+  {
+    if (((Child + 1U) < Count) &&
+        (FDCAN_TxSchedIsBefore(pTxSched->pQueue[Child + 1U], pTxSched->pQueue[Child]) != 0U))
+    {
+      Child++;
+    }
+    if (FDCAN_TxSchedIsBefore(pTxSched->pQueue[Child], pLast) == 0U)
+    {
+      break;
+    }
+    pTxSched->pQueue[Index] = pTxSched->pQueue[Child];
+    Index = Child;
+    Child = (2U * Index) + 1U;
+  }
+  pTxSched->pQueue[Index] = pLast;
+
+  /* Close the gap between the heap and the free entries */
+  if (pTxSched->FreeCount != 0U)
+  {
+    pTxSched->pQueue[Count] = pTxSched->pQueue[Count + pTxSched->FreeCount];
+  }
+
+  return pTop;
+}
+
+/**
+  * @brief  Collect the released buffers of the Tx scheduler and refill them.
+  * @param  hfdcan pointer to an FDCAN_HandleTypeDef structure that contains
+  *         the configuration information for the specified FDCAN.
+  * @note   Called from the IRQ handler, or with the interrupts masked.
+  * @retval None
+  */
+static void FDCAN_TxSchedService(FDCAN_HandleTypeDef *hfdcan)
+{
+  FDCAN_TxSchedTypeDef *pTxSched = hfdcan->pTxSched;
+  FDCAN_TxSchedEntryTypeDef *pEntry;
+  FDCAN_TxSchedEntryTypeDef *pWorst = NULL;
+  uint32_t Released;
+  uint32_t Free;
+  uint32_t Request = 0U;
+  uint32_t BufferNumber;
+  uint32_t WorstNumber = 0U;
+  uint32_t Busy;
+
+  /* Buffers whose request is over: transmitted, failed, or cancelled */
+  Released = pTxSched->PendingMask & ~hfdcan->Instance->TXBRP;
+  while (Released != 0U)
+  {
+    BufferNumber = POSITION_VAL(Released);
+    Released &= ~(1UL << BufferNumber);
+    pEntry = pTxSched->pInFlight[BufferNumber];
+    pTxSched->pInFlight[BufferNumber] = NULL;
+
+    if (((pTxSched->CancelMask & (1UL << BufferNumber)) != 0U) &&
+        ((hfdcan->Instance->TXBTO & (1UL << BufferNumber)) == 0U))
+    {
+      /* Preempted before being sent: back in the queue, with its enqueue order */
+      FDCAN_TxSchedPush(pTxSched, pEntry);
+      pTxSched->PreemptCount++;
+    }
+    else
+    {
+      pTxSched->pQueue[pTxSched->QueueCount + pTxSched->FreeCount] = pEntry;
+      pTxSched->FreeCount++;
+    }
+    pTxSched->PendingMask &= ~(1UL << BufferNumber);
+    pTxSched->CancelMask &= ~(1UL << BufferNumber);
+  }
+
+  /* Fill the free buffers with the frames of highest priority. The hardware
+     then sends the pending buffers in arbitration order, back to back */
+  Free = pTxSched->BufferMask & ~pTxSched->PendingMask;
+  while ((Free != 0U) && (pTxSched->QueueCount != 0U))
+  {
+    BufferNumber = POSITION_VAL(Free);
+    Free &= ~(1UL << BufferNumber);
+    pEntry = FDCAN_TxSchedPop(pTxSched);
+    FDCAN_CopyMessageToRAM(hfdcan, &pEntry->Header, pEntry->Data, BufferNumber);
+    pTxSched->pInFlight[BufferNumber] = pEntry;
+    Request |= (1UL << BufferNumber);
+  }
+  if (Request != 0U)
+  {
+    pTxSched->PendingMask |= Request;
+    hfdcan->Instance->TXBAR = Request;
+  }
+
+  /* All buffers busy: when the first queued frame outranks a buffered one,
+     cancel the buffer of lowest priority, one at a time, to avoid priority inversion */
+  if ((pTxSched->QueueCount != 0U) && (pTxSched->CancelMask == 0U))
+  {
+    Busy = pTxSched->PendingMask;
+    while (Busy != 0U)
+    {
+      BufferNumber = POSITION_VAL(Busy);
+      Busy &= ~(1UL << BufferNumber);
+      if ((pWorst == NULL) || (FDCAN_TxSchedIsBefore(pWorst, pTxSched->pInFlight[BufferNumber]) != 0U))
+      {
+        pWorst = pTxSched->pInFlight[BufferNumber];
+        WorstNumber = BufferNumber;
+      }
+    }
+    if ((pWorst != NULL) && (FDCAN_TxSchedIsBefore(pTxSched->pQueue[0], pWorst) != 0U))
+    {
+      pTxSched->CancelMask = (1UL << WorstNumber);
+      hfdcan->Instance->TXBCR = (1UL << WorstNumber);
+    }
+  }
+}
+
 /**
   * @}
   */
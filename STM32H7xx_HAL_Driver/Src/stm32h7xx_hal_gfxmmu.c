@@ -6,6 +6,7 @@
   *          functionalities of the Graphic MMU (GFXMMU) peripheral:
   *           + Initialization and De-initialization.
   *           + LUT configuration.
+  *           + LUT generation for circular, rounded and masked displays.
   *           + Force flush and/or invalidate of cache.
   *           + Modify physical buffer addresses.
   *           + Modify cache and pre-fetch parameters.
@@ -46,6 +47,22 @@
       (#) Use HAL_GFXMMU_ConfigLut() to copy LUT from flash to look up RAM.
       (#) Use HAL_GFXMMU_ConfigLutLine() to configure one line of LUT.
 
+    *** LUT generation ***
+    ======================
+    [..]
+      (#) Describe the visible area of the display in a GFXMMU_ShapeTypeDef
+          structure: a circle, a rectangle with rounded corners or a bitmap
+          giving the visible pixels.
+      (#) Use HAL_GFXMMU_ConfigLutShape() to build the LUT directly in look up
+          RAM, or HAL_GFXMMU_ComputeLut() to build it in a table later copied
+          with HAL_GFXMMU_ConfigLut(). Both return the size of the physical
+          buffer, which only holds the visible pixels.
+      (#) Use the GFXMMU_VIRTUAL_BUFFERx_BASE address as LTDC layer frame buffer
+          and DMA2D output address. The line size of the virtual buffer, given
+          by __HAL_GFXMMU_GET_VIRTUAL_PITCH(), is the LTDC layer pitch (set with
+          HAL_LTDC_SetPitch() in pixels) and the DMA2D output offset is the
+          pitch in pixels minus the width of the transfer.
+
     *** Force flush and/or invalidate of cache ***
     ==============================================
     [..]
@@ -152,9 +169,22 @@
 #define GFXMMU_LUTXL_FVB_OFFSET     8U
 #define GFXMMU_LUTXL_LVB_OFFSET     16U
 #define GFXMMU_CR_ITS_MASK          0x1FU
+#define GFXMMU_LUT_SIZE             1024U
+#define GFXMMU_BLOCK_SIZE           16U
+#define GFXMMU_LUT_LINE_OFFSET_MAX  4190208
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
+static HAL_StatusTypeDef GFXMMU_BuildLut(const GFXMMU_HandleTypeDef *hgfxmmu,
+                                         const GFXMMU_ShapeTypeDef *Shape,
+                                         uint32_t LutAddress,
+                                         uint32_t LutStep,
+                                         uint32_t *pBufferSize);
+static uint32_t GFXMMU_GetLineSpan(const GFXMMU_ShapeTypeDef *Shape,
+                                   uint32_t Line,
+                                   uint32_t *pFirstPixel,
+                                   uint32_t *pLastPixel);
+static uint32_t GFXMMU_Sqrt(uint32_t Value);
 /* Exported functions --------------------------------------------------------*/
 /** @defgroup GFXMMU_Exported_Functions GFXMMU Exported Functions
   * @{
@@ -500,6 +530,7 @@ HAL_StatusTypeDef HAL_GFXMMU_UnRegisterCallback(GFXMMU_HandleTypeDef        *hgf
   ==============================================================================
     [..]  This section provides functions allowing to:
       (+) Configure LUT.
+      (+) Generate LUT from the display shape.
       (+) Force flush and/or invalidate of cache.
       (+) Modify physical buffer addresses.
       (+) Modify cache and pre-fetch parameters.
@@ -660,6 +691,84 @@ HAL_StatusTypeDef HAL_GFXMMU_ConfigLutLine(GFXMMU_HandleTypeDef *hgfxmmu, GFXMMU
   return status;
 }
 
+/**
+  * @brief  This function allows to compute the LUT of a display shape in a table.
+  * @param  hgfxmmu GFXMMU handle.
+  * @param  Shape Display shape parameters.
+  * @param  pLut Table of 2 * Shape->Height words receiving the LUT lines, in the
+  *         format expected by HAL_GFXMMU_ConfigLut(). It can be NULL to only get
+  *         the physical buffer size.
+  * @param  pBufferSize Size in bytes of the physical buffer holding the visible pixels.
+  * @retval HAL status.
+  */
+HAL_StatusTypeDef HAL_GFXMMU_ComputeLut(GFXMMU_HandleTypeDef *hgfxmmu,
+                                        const GFXMMU_ShapeTypeDef *Shape,
+                                        uint32_t *pLut,
+                                        uint32_t *pBufferSize)
+{
+  HAL_StatusTypeDef status;
+
+  /* Check parameters */
+  assert_param(IS_GFXMMU_ALL_INSTANCE(hgfxmmu->Instance));
+  assert_param(IS_GFXMMU_SHAPE(Shape->Shape));
+  assert_param(IS_GFXMMU_LUT_LINES_NUMBER(Shape->Height));
+  assert_param(IS_GFXMMU_PIXEL_SIZE(Shape->PixelSize));
+
+  /* Check GFXMMU state */
+  if(hgfxmmu->State != HAL_GFXMMU_STATE_READY)
+  {
+    status = HAL_ERROR;
+  }
+  else
+  {
+    /* Build the LUT lines in the table, one pair of words per line */
+    status = GFXMMU_BuildLut(hgfxmmu, Shape, (uint32_t) pLut, 8U, pBufferSize);
+  }
+  /* Return function status */
+  return status;
+}
+
+/**
+  * @brief  This function allows to configure the LUT from a display shape.
+  * @param  hgfxmmu GFXMMU handle.
+  * @param  Shape Display shape parameters.
+  * @param  pBufferSize Size in bytes of the physical buffer holding the visible pixels.
+  * @note   The lines 0 to Shape->Height - 1 are configured, the following ones are
+  *         disabled.
+  * @retval HAL status.
+  */
+HAL_StatusTypeDef HAL_GFXMMU_ConfigLutShape(GFXMMU_HandleTypeDef *hgfxmmu,
+                                            const GFXMMU_ShapeTypeDef *Shape,
+                                            uint32_t *pBufferSize)
+{
+  HAL_StatusTypeDef status;
+
+  /* Check parameters */
+  assert_param(IS_GFXMMU_ALL_INSTANCE(hgfxmmu->Instance));
+  assert_param(IS_GFXMMU_SHAPE(Shape->Shape));
+  assert_param(IS_GFXMMU_LUT_LINES_NUMBER(Shape->Height));
+  assert_param(IS_GFXMMU_PIXEL_SIZE(Shape->PixelSize));
+
+  /* Check GFXMMU state */
+  if(hgfxmmu->State != HAL_GFXMMU_STATE_READY)
+  {
+    status = HAL_ERROR;
+  }
+  else
+  {
+    /* Build the LUT lines in look up RAM */
+    status = GFXMMU_BuildLut(hgfxmmu, Shape, (uint32_t) &(hgfxmmu->Instance->LUT[0]), 8U, pBufferSize);
+
+    /* Disable the LUT lines below the display */
+    if((status == HAL_OK) && (Shape->Height < GFXMMU_LUT_SIZE))
+    {
+      status = HAL_GFXMMU_DisableLutLines(hgfxmmu, Shape->Height, GFXMMU_LUT_SIZE - Shape->Height);
+    }
+  }
+  /* Return function status */
+  return status;
+}
+
 /**
   * @brief  This function allows to force flush and/or invalidate of cache.
   * @param  hgfxmmu GFXMMU handle.
@@ -879,6 +988,199 @@ uint32_t HAL_GFXMMU_GetError(GFXMMU_HandleTypeDef *hgfxmmu)
   */
 /* End of exported functions -------------------------------------------------*/
 /* Private functions ---------------------------------------------------------*/
+/** @defgroup GFXMMU_Private_Functions GFXMMU Private Functions
+  * @{
+  */
+
+/**
+  * @brief  Build the LUT lines of a display shape.
+  * @param  hgfxmmu GFXMMU handle.
+  * @param  Shape Display shape parameters.
+  * @param  LutAddress Address of the first LUT line, or 0 to only compute the buffer size.
+  * @param  LutStep Address increment between two LUT lines.
+  * @param  pBufferSize Size in bytes of the physical buffer holding the visible pixels.
+  * @retval HAL status.
+  */
+static HAL_StatusTypeDef GFXMMU_BuildLut(const GFXMMU_HandleTypeDef *hgfxmmu,
+                                         const GFXMMU_ShapeTypeDef *Shape,
+                                         uint32_t LutAddress,
+                                         uint32_t LutStep,
+                                         uint32_t *pBufferSize)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+  uint32_t line_blocks;
+  uint32_t used_blocks = 0U;
+  uint32_t current_line = 0U;
+  uint32_t lut_address = LutAddress;
+  uint32_t first_pixel, last_pixel, first_block, last_block;
+  int32_t  line_offset;
+
+  line_blocks = (hgfxmmu->Init.BlocksPerLine == GFXMMU_192BLOCKS) ? 192U : 256U;
+
+  /* Check coherent parameters */
+  if((Shape->Height == 0U) || (Shape->Height > GFXMMU_LUT_SIZE) || (Shape->Width == 0U) ||
+     (Shape->PixelSize == 0U) || (Shape->PixelSize > 4U) ||
+     ((Shape->Width * Shape->PixelSize) > (line_blocks * GFXMMU_BLOCK_SIZE)) ||
+     ((Shape->Shape == GFXMMU_SHAPE_CIRCLE) && (Shape->Width != Shape->Height)) ||
+     ((Shape->Shape == GFXMMU_SHAPE_ROUNDED_RECT) &&
+      (((2U * Shape->Radius) > Shape->Width) || ((2U * Shape->Radius) > Shape->Height))) ||
+     ((Shape->Shape == GFXMMU_SHAPE_MASK) && (Shape->pMask == NULL)))
+  {
+    status = HAL_ERROR;
+  }
+
+  while((status == HAL_OK) && (current_line < Shape->Height))
+  {
+    if(GFXMMU_GetLineSpan(Shape, current_line, &first_pixel, &last_pixel) != 0U)
+    {
+      /* Blocks of 16 bytes holding the visible pixels of the line */
+      first_block = (first_pixel * Shape->PixelSize) / GFXMMU_BLOCK_SIZE;
+      last_block  = ((last_pixel * Shape->PixelSize) + Shape->PixelSize - 1U) / GFXMMU_BLOCK_SIZE;
+
+      /* Offset of block 0 of the line in the physical buffer */
+      line_offset = ((int32_t) used_blocks - (int32_t) first_block) * (int32_t) GFXMMU_BLOCK_SIZE;
+      if(line_offset > GFXMMU_LUT_LINE_OFFSET_MAX)
+      {
+        status = HAL_ERROR;
+      }
+      else if(lut_address != 0U)
+      {
+        *((uint32_t *)lut_address) = (GFXMMU_LUT_LINE_ENABLE |
+                                     (first_block << GFXMMU_LUTXL_FVB_OFFSET) |
+                                     (last_block << GFXMMU_LUTXL_LVB_OFFSET));
+        *((uint32_t *)(lut_address + 4U)) = (uint32_t) line_offset;
+      }
+      else
+      {
+        /* Only the buffer size is computed */
+      }
+      used_blocks += (last_block - first_block) + 1U;
+    }
+    else if(lut_address != 0U)
+    {
+      /* No visible pixel, the line is not mapped */
+      *((uint32_t *)lut_address) = 0U;
+      *((uint32_t *)(lut_address + 4U)) = 0U;
+    }
+    else
+    {
+      /* Only the buffer size is computed */
+    }
+
+    if(lut_address != 0U)
+    {
+      lut_address += LutStep;
+    }
+    current_line++;
+  }
+
+  if((status == HAL_OK) && (pBufferSize != NULL))
+  {
+    *pBufferSize = used_blocks * GFXMMU_BLOCK_SIZE;
+  }
+  /* Return function status */
+  return status;
+}
+
+/**
+  * @brief  Get the first and last visible pixels of a display line.
+  * @param  Shape Display shape parameters.
+  * @param  Line Display line.
+  * @param  pFirstPixel First visible pixel of the line.
+  * @param  pLastPixel Last visible pixel of the line.
+  * @retval 1 if the line has visible pixels, 0 otherwise.
+  */
+static uint32_t GFXMMU_GetLineSpan(const GFXMMU_ShapeTypeDef *Shape,
+                                   uint32_t Line,
+                                   uint32_t *pFirstPixel,
+                                   uint32_t *pLastPixel)
+{
+  uint32_t visible = 1U;
+  uint32_t distance, half_chord, corner_line, line_bytes, pixel;
+  const uint8_t *pline;
+
+  if(Shape->Shape == GFXMMU_SHAPE_CIRCLE)
+  {
+    /* Pixel centers inside the circle, computed in half pixels */
+    distance   = (((2U * Line) + 1U) > Shape->Width) ? (((2U * Line) + 1U) - Shape->Width) :
+                                                       (Shape->Width - ((2U * Line) + 1U));
+    half_chord = GFXMMU_Sqrt((Shape->Width * Shape->Width) - (distance * distance));
+    *pFirstPixel = (Shape->Width - half_chord) / 2U;
+    *pLastPixel  = ((Shape->Width - 1U) + half_chord) / 2U;
+  }
+  else if(Shape->Shape == GFXMMU_SHAPE_ROUNDED_RECT)
+  {
+    corner_line = (Line < (Shape->Height - 1U - Line)) ? Line : (Shape->Height - 1U - Line);
+    if(corner_line < Shape->Radius)
+    {
+      /* Pixel centers inside the corner circle, computed in half pixels */
+      distance   = (2U * Shape->Radius) - ((2U * corner_line) + 1U);
+      half_chord = GFXMMU_Sqrt((4U * Shape->Radius * Shape->Radius) - (distance * distance));
+      *pFirstPixel = ((2U * Shape->Radius) - half_chord) / 2U;
+    }
+    else
+    {
+      *pFirstPixel = 0U;
+    }
+    *pLastPixel = Shape->Width - 1U - *pFirstPixel;
+  }
+  else
+  {
+    /* Search the first and last bits set in the mask line */
+    line_bytes = (Shape->Width + 7U) / 8U;
+    pline      = &Shape->pMask[Line * line_bytes];
+    visible    = 0U;
+    for(pixel = 0U; pixel < Shape->Width; pixel++)
+    {
+      if((pline[pixel / 8U] & (0x80U >> (pixel % 8U))) != 0U)
+      {
+        if(visible == 0U)
+        {
+          *pFirstPixel = pixel;
+          visible = 1U;
+        }
+        *pLastPixel = pixel;
+      }
+    }
+  }
+
+  return visible;
+}
+
+/**
+  * @brief  Integer square root.
+  * @param  Value Input value.
+  * @retval Largest integer whose square is lower or equal to Value.
+  */
+static uint32_t GFXMMU_Sqrt(uint32_t Value)
+{
+  uint32_t remainder = Value;
+  uint32_t root = 0U;
+  uint32_t bit = 1UL << 30U;
+
+  while(bit > remainder)
+  {
+    bit >>= 2U;
+  }
+  while(bit != 0U)
+  {
+    if(remainder >= (root + bit))
+    {
+      remainder -= root + bit;
+      root = (root >> 1U) + bit;
+    }
+    else
+    {
+      root >>= 1U;
+    }
+    bit >>= 2U;
+  }
+  return root;
+}
+
+/**
+  * @}
+  */
 /* End of private functions --------------------------------------------------*/
 
 /**
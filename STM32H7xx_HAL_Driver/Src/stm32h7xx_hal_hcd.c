@@ -49,6 +49,40 @@
     (#)Enable HCD transmission and reception:
         (##) HAL_HCD_Start();
 
+    (#)Host channels can be taken from and given back to a pool with
+       HAL_HCD_HC_Alloc() and HAL_HCD_HC_Free() instead of fixed numbers.
+
+    (#)Full and low speed devices behind a high speed hub are reached through
+       split transactions: call HAL_HCD_HC_SetHubInfo() after HAL_HCD_HC_Init()
+       with the hub address and port. Splits are only supported in slave mode
+       (dma_enable = 0) and not for isochronous endpoints.
+
+    (#)Interrupt and isochronous channels can be polled by the driver from the
+       SOF interrupt with HAL_HCD_HC_SetPeriodic(). The interval is rounded down
+       to a power of two (micro)frames of the root port and the start (micro)frame
+       is chosen to spread the periodic load; completion is still reported through
+       HAL_HCD_HC_NotifyURBChange_Callback(). HAL_HCD_HC_GetPeriodicMissed() returns
+       the polls skipped because the channel was still busy.
+
+    (#)Bulk channels can be pipelined in DMA mode (dma_enable = 1) to reach the
+       line rate: give the channel a ring of HCD_BulkXferTypeDef with
+       HAL_HCD_HC_SetPipeline(), then queue transfers with
+       HAL_HCD_HC_QueueRequest() instead of HAL_HCD_HC_SubmitRequest():
+        (##) The next queued transfer is armed from the channel halted interrupt
+             of the previous one, before HAL_HCD_HC_NotifyURBChange_Callback()
+             reports URB_DONE; the transfers complete in queue order and the
+             XferCount field of each one gives the bytes transferred.
+        (##) The data toggle is taken from the core at the end of each transfer,
+             transfers longer than the channel packet count limit are split and
+             a NAKed OUT transfer resumes from the first packet not acknowledged.
+        (##) The buffers must be 32-bit aligned and, for IN, made of full
+             packets. With the data cache enabled, they must be cleaned before
+             an OUT transfer and invalidated after an IN transfer.
+        (##) After URB_STALL or URB_ERROR the queue is stopped: call
+             HAL_HCD_HC_ClearPipeline(), recover the endpoint and set the
+             pipeline again. HAL_HCD_HC_GetPipelineCount() returns the transfers
+             not completed yet.
+
   @endverbatim
   ******************************************************************************
   */
@@ -70,6 +104,8 @@
 
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
+#define HCD_SPLIT_NYET_RETRY          3U    /* Complete split retries of a periodic split transaction */
+#define HCD_PERIODIC_MAX_INTERVAL     256U  /* Longest periodic polling interval in (micro)frames */
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
@@ -80,6 +116,10 @@ static void HCD_HC_IN_IRQHandler(HCD_HandleTypeDef *hhcd, uint8_t chnum);
 static void HCD_HC_OUT_IRQHandler(HCD_HandleTypeDef *hhcd, uint8_t chnum);
 static void HCD_RXQLVL_IRQHandler(HCD_HandleTypeDef *hhcd);
 static void HCD_Port_IRQHandler(HCD_HandleTypeDef *hhcd);
+static void HCD_PeriodicSchedule(HCD_HandleTypeDef *hhcd);
+static void HCD_PipelineStart(HCD_HandleTypeDef *hhcd, uint8_t chnum);
+static uint32_t HCD_PipelineNext(HCD_HandleTypeDef *hhcd, uint8_t chnum);
+static void HCD_PipelineResume(HCD_HandleTypeDef *hhcd, uint8_t chnum);
 /**
   * @}
   */
@@ -110,6 +150,7 @@ static void HCD_Port_IRQHandler(HCD_HandleTypeDef *hhcd);
 HAL_StatusTypeDef HAL_HCD_Init(HCD_HandleTypeDef *hhcd)
 {
   USB_OTG_GlobalTypeDef *USBx;
+  uint32_t i;
 
   /* Check the HCD handle allocation */
   if (hhcd == NULL)
@@ -168,6 +209,22 @@ HAL_StatusTypeDef HAL_HCD_Init(HCD_HandleTypeDef *hhcd)
   /* Init Host */
   (void)USB_HostInit(hhcd->Instance, hhcd->Init);
 
+  /* Reset the channel pool and the periodic planner */
+  hhcd->ChannelsInUse = 0U;
+
+  for (i = 0U; i < 16U; i++)
+  {
+    hhcd->periodic[i].Interval = 0U;
+    hhcd->periodic[i].Missed = 0U;
+    hhcd->pipeline[i].pQueue = NULL;
+    hhcd->pipeline[i].Count = 0U;
+  }
+
+  for (i = 0U; i < sizeof(hhcd->PeriodicLoad); i++)
+  {
+    hhcd->PeriodicLoad[i] = 0U;
+  }
+
   hhcd->State = HAL_HCD_STATE_READY;
 
   return HAL_OK;
@@ -204,6 +261,8 @@ HAL_StatusTypeDef HAL_HCD_HC_Init(HCD_HandleTypeDef *hhcd, uint8_t ch_num, uint8
 
   __HAL_LOCK(hhcd);
   hhcd->hc[ch_num].do_ping = 0U;
+  hhcd->hc[ch_num].do_ssplit = 0U;
+  hhcd->hc[ch_num].do_csplit = 0U;
   hhcd->hc[ch_num].dev_addr = dev_address;
   hhcd->hc[ch_num].max_packet = mps;
   hhcd->hc[ch_num].ch_num = ch_num;
@@ -247,6 +306,304 @@ HAL_StatusTypeDef HAL_HCD_HC_Halt(HCD_HandleTypeDef *hhcd, uint8_t ch_num)
   return status;
 }
 
+/**
+  * @brief  Allocate a free host channel.
+  * @param  hhcd HCD handle
+  * @param  pChNum pointer to the allocated channel number
+  * @retval HAL status, HAL_BUSY when all the host channels are in use
+  */
+HAL_StatusTypeDef HAL_HCD_HC_Alloc(HCD_HandleTypeDef *hhcd, uint8_t *pChNum)
+{
+  HAL_StatusTypeDef status = HAL_BUSY;
+  uint32_t i;
+
+  if (pChNum == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  __HAL_LOCK(hhcd);
+
+  for (i = 0U; (i < hhcd->Init.Host_channels) && (i < 16U); i++)
+  {
+    if ((hhcd->ChannelsInUse & (1UL << i)) == 0U)
+    {
+      hhcd->ChannelsInUse |= (1UL << i);
+      *pChNum = (uint8_t)i;
+      status = HAL_OK;
+      break;
+    }
+  }
+
+  __HAL_UNLOCK(hhcd);
+
+  return status;
+}
+
+/**
+  * @brief  Release a host channel allocated by HAL_HCD_HC_Alloc().
+  * @note   The channel is halted and its periodic and pipelined transfers, if
+  *         any, are removed.
+  * @param  hhcd HCD handle
+  * @param  ch_num Channel number.
+  *         This parameter can be a value from 1 to 15
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_HCD_HC_Free(HCD_HandleTypeDef *hhcd, uint8_t ch_num)
+{
+  if (ch_num >= 16U)
+  {
+    return HAL_ERROR;
+  }
+
+  (void)HAL_HCD_HC_ClearPeriodic(hhcd, ch_num);
+  (void)HAL_HCD_HC_ClearPipeline(hhcd, ch_num);
+
+  __HAL_LOCK(hhcd);
+  (void)USB_HC_Halt(hhcd->Instance, ch_num);
+  hhcd->hc[ch_num].do_ssplit = 0U;
+  hhcd->hc[ch_num].do_csplit = 0U;
+  hhcd->ChannelsInUse &= ~(1UL << ch_num);
+  __HAL_UNLOCK(hhcd);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Set the high speed hub the device of a host channel is connected to.
+  * @note   Split transactions are used when a full or low speed device is
+  *         reached through a high speed hub. This function must be called
+  *         after HAL_HCD_HC_Init().
+  * @param  hhcd HCD handle
+  * @param  ch_num Channel number.
+  *         This parameter can be a value from 1 to 15
+  * @param  addr Address of the high speed hub
+  * @param  PortNbr Hub port the device is connected to
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_HCD_HC_SetHubInfo(HCD_HandleTypeDef *hhcd, uint8_t ch_num,
+                                        uint8_t addr, uint8_t PortNbr)
+{
+  USB_OTG_GlobalTypeDef *USBx = hhcd->Instance;
+  uint32_t USBx_BASE = (uint32_t)USBx;
+
+  /* Split transactions are handled in slave mode for non isochronous endpoints */
+  if ((hhcd->Init.dma_enable != 0U) || (hhcd->hc[ch_num].ep_type == EP_TYPE_ISOC))
+  {
+    return HAL_ERROR;
+  }
+
+  __HAL_LOCK(hhcd);
+
+  hhcd->hc[ch_num].hub_addr = addr;
+  hhcd->hc[ch_num].hub_port_nbr = PortNbr;
+  hhcd->hc[ch_num].do_csplit = 0U;
+  hhcd->hc[ch_num].NyetErrCnt = 0U;
+
+  /* Only a high speed root port talks to a full/low speed device through a hub */
+  if ((USB_GetHostSpeed(hhcd->Instance) == HPRT0_PRTSPD_HIGH_SPEED) &&
+      (hhcd->hc[ch_num].speed != HCD_DEVICE_SPEED_HIGH))
+  {
+    hhcd->hc[ch_num].do_ssplit = 1U;
+
+    /* The hub handshakes drive the start/complete split sequence */
+    USBx_HC((uint32_t)ch_num)->HCINTMSK |= USB_OTG_HCINTMSK_ACKM | USB_OTG_HCINTMSK_NYET;
+  }
+  else
+  {
+    hhcd->hc[ch_num].do_ssplit = 0U;
+  }
+
+  __HAL_UNLOCK(hhcd);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Set up the periodic polling of an interrupt or isochronous channel.
+  * @note   The channel must be initialized with HAL_HCD_HC_Init(). A transfer
+  *         of pbuff/length is started from the SOF interrupt every Interval
+  *         (micro)frames, a poll is skipped when the channel is still busy.
+  * @param  hhcd HCD handle
+  * @param  ch_num Channel number.
+  *         This parameter can be a value from 1 to 15
+  * @param  Interval Polling interval in (micro)frames of the root port,
+  *         rounded down to a power of two up to 256
+  * @param  pbuff pointer to the transfer data
+  * @param  length Length of the transfer data
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_HCD_HC_SetPeriodic(HCD_HandleTypeDef *hhcd, uint8_t ch_num,
+                                         uint16_t Interval, uint8_t *pbuff, uint16_t length)
+{
+  uint32_t interval = 1U;
+  uint32_t nb_slots = sizeof(hhcd->PeriodicLoad);
+  uint32_t phase;
+  uint32_t best_phase = 0U;
+  uint32_t best_load = 0xFFFFFFFFU;
+  uint32_t load;
+  uint32_t slot;
+
+  if ((Interval == 0U) || (ch_num >= 16U) ||
+      ((hhcd->hc[ch_num].ep_type != EP_TYPE_INTR) && (hhcd->hc[ch_num].ep_type != EP_TYPE_ISOC)))
+  {
+    return HAL_ERROR;
+  }
+
+  (void)HAL_HCD_HC_ClearPeriodic(hhcd, ch_num);
+
+  while (((interval << 1) <= Interval) && ((interval << 1) <= HCD_PERIODIC_MAX_INTERVAL))
+  {
+    interval <<= 1;
+  }
+
+  /* Pick the start (micro)frame with the lowest peak load */
+  for (phase = 0U; (phase < interval) && (phase < nb_slots); phase++)
+  {
+    load = 0U;
+    for (slot = phase; slot < nb_slots; slot += interval)
+    {
+      if (hhcd->PeriodicLoad[slot] > load)
+      {
+        load = hhcd->PeriodicLoad[slot];
+      }
+    }
+
+    if (load < best_load)
+    {
+      best_load = load;
+      best_phase = phase;
+    }
+  }
+
+  __HAL_LOCK(hhcd);
+
+  for (slot = best_phase; slot < nb_slots; slot += interval)
+  {
+    hhcd->PeriodicLoad[slot]++;
+  }
+
+  hhcd->periodic[ch_num].pBuff = pbuff;
+  hhcd->periodic[ch_num].Length = length;
+  hhcd->periodic[ch_num].Phase = (uint16_t)best_phase;
+  hhcd->periodic[ch_num].Missed = 0U;
+  hhcd->periodic[ch_num].Interval = (uint16_t)interval;
+
+  __HAL_UNLOCK(hhcd);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop the periodic polling of a host channel.
+  * @param  hhcd HCD handle
+  * @param  ch_num Channel number.
+  *         This parameter can be a value from 1 to 15
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_HCD_HC_ClearPeriodic(HCD_HandleTypeDef *hhcd, uint8_t ch_num)
+{
+  uint32_t slot;
+
+  if (ch_num >= 16U)
+  {
+    return HAL_ERROR;
+  }
+
+  __HAL_LOCK(hhcd);
+
+  if (hhcd->periodic[ch_num].Interval != 0U)
+  {
+    for (slot = hhcd->periodic[ch_num].Phase; slot < sizeof(hhcd->PeriodicLoad);
+         slot += hhcd->periodic[ch_num].Interval)
+    {
+      hhcd->PeriodicLoad[slot]--;
+    }
+
+    hhcd->periodic[ch_num].Interval = 0U;
+  }
+
+  __HAL_UNLOCK(hhcd);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Set up the pipelining of a bulk channel.
+  * @note   The channel must be initialized with HAL_HCD_HC_Init() and the
+  *         driver be in DMA mode. Split transactions are not pipelined.
+  * @param  hhcd HCD handle
+  * @param  ch_num Channel number.
+  *         This parameter can be a value from 1 to 15
+  * @param  pQueue pointer to a ring of Depth transfers, owned by the driver
+  *         until HAL_HCD_HC_ClearPipeline()
+  * @param  Depth Number of transfers of pQueue
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_HCD_HC_SetPipeline(HCD_HandleTypeDef *hhcd, uint8_t ch_num,
+                                         HCD_BulkXferTypeDef *pQueue, uint8_t Depth)
+{
+  if ((ch_num >= 16U) || (pQueue == NULL) || (Depth == 0U) || (hhcd->Init.dma_enable != 1U) ||
+      (hhcd->hc[ch_num].ep_type != EP_TYPE_BULK) || (hhcd->hc[ch_num].do_ssplit != 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  (void)HAL_HCD_HC_ClearPipeline(hhcd, ch_num);
+
+  __HAL_LOCK(hhcd);
+
+  hhcd->pipeline[ch_num].Depth = Depth;
+  hhcd->pipeline[ch_num].Head = 0U;
+  hhcd->pipeline[ch_num].Count = 0U;
+  hhcd->pipeline[ch_num].Offset = 0U;
+  hhcd->pipeline[ch_num].pQueue = pQueue;
+
+  __HAL_UNLOCK(hhcd);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop the pipelining of a bulk channel.
+  * @note   The transfer in progress is aborted and the queued ones dropped.
+  * @param  hhcd HCD handle
+  * @param  ch_num Channel number.
+  *         This parameter can be a value from 1 to 15
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_HCD_HC_ClearPipeline(HCD_HandleTypeDef *hhcd, uint8_t ch_num)
+{
+  uint32_t primask;
+
+  if (ch_num >= 16U)
+  {
+    return HAL_ERROR;
+  }
+
+  __HAL_LOCK(hhcd);
+
+  /* The queue is shared with the IRQ handler */
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  if ((hhcd->pipeline[ch_num].pQueue != NULL) && (hhcd->pipeline[ch_num].Count != 0U))
+  {
+    /* The halt is not reported to the application */
+    hhcd->hc[ch_num].state = HC_HALTED;
+    (void)USB_HC_Halt(hhcd->Instance, ch_num);
+  }
+
+  hhcd->pipeline[ch_num].pQueue = NULL;
+  hhcd->pipeline[ch_num].Count = 0U;
+
+  __set_PRIMASK(primask);
+
+  __HAL_UNLOCK(hhcd);
+
+  return HAL_OK;
+}
+
 /**
   * @brief  DeInitialize the host driver.
   * @param  hhcd HCD handle
@@ -363,6 +720,12 @@ HAL_StatusTypeDef HAL_HCD_HC_SubmitRequest(HCD_HandleTypeDef *hhcd,
                                            uint16_t length,
                                            uint8_t do_ping)
 {
+  /* A pipelined channel only takes transfers from HAL_HCD_HC_QueueRequest() */
+  if (hhcd->pipeline[ch_num].pQueue != NULL)
+  {
+    return HAL_ERROR;
+  }
+
   hhcd->hc[ch_num].ep_is_in = direction;
   hhcd->hc[ch_num].ep_type  = ep_type;
 
@@ -472,10 +835,74 @@ HAL_StatusTypeDef HAL_HCD_HC_SubmitRequest(HCD_HandleTypeDef *hhcd,
   hhcd->hc[ch_num].xfer_count = 0U;
   hhcd->hc[ch_num].ch_num = ch_num;
   hhcd->hc[ch_num].state = HC_IDLE;
+  hhcd->hc[ch_num].do_csplit = 0U;
+  hhcd->hc[ch_num].NyetErrCnt = 0U;
 
   return USB_HC_StartXfer(hhcd->Instance, &hhcd->hc[ch_num], (uint8_t)hhcd->Init.dma_enable);
 }
 
+/**
+  * @brief  Queue a transfer on a pipelined bulk channel.
+  * @note   The transfer is started at once when the channel is idle, otherwise
+  *         from the IRQ handler when the previous transfers are completed.
+  * @param  hhcd HCD handle
+  * @param  ch_num Channel number.
+  *         This parameter can be a value from 1 to 15
+  * @param  pbuff pointer to the transfer data, 32-bit aligned
+  * @param  length Length of the transfer data, a non-zero multiple of the max
+  *         packet size for an IN channel
+  * @retval HAL status, HAL_BUSY when the queue is full
+  */
+HAL_StatusTypeDef HAL_HCD_HC_QueueRequest(HCD_HandleTypeDef *hhcd, uint8_t ch_num,
+                                          uint8_t *pbuff, uint32_t length)
+{
+  HCD_PipelineTypeDef *pipeline;
+  HCD_BulkXferTypeDef *xfer;
+  uint32_t primask;
+
+  if ((ch_num >= 16U) || (hhcd->pipeline[ch_num].pQueue == NULL) || (((uint32_t)pbuff & 0x3U) != 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  /* The DMA writes full packets into an IN buffer */
+  if ((hhcd->hc[ch_num].ep_is_in != 0U) &&
+      ((length == 0U) || ((length % hhcd->hc[ch_num].max_packet) != 0U)))
+  {
+    return HAL_ERROR;
+  }
+
+  pipeline = &hhcd->pipeline[ch_num];
+
+  /* The queue is shared with the IRQ handler */
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  if (pipeline->Count >= pipeline->Depth)
+  {
+    __set_PRIMASK(primask);
+    return HAL_BUSY;
+  }
+
+  xfer = &pipeline->pQueue[(pipeline->Head + pipeline->Count) % pipeline->Depth];
+  xfer->pBuff = pbuff;
+  xfer->Length = length;
+  xfer->XferCount = 0U;
+  pipeline->Count++;
+
+  /* An idle channel is started here, a busy one from its halted interrupt */
+  if (pipeline->Count == 1U)
+  {
+    pipeline->Offset = 0U;
+    hhcd->hc[ch_num].urb_state = URB_IDLE;
+    HCD_PipelineStart(hhcd, ch_num);
+  }
+
+  __set_PRIMASK(primask);
+
+  return HAL_OK;
+}
+
 /**
   * @brief  Handle HCD interrupt request.
   * @param  hhcd HCD handle
@@ -556,6 +983,8 @@ void HAL_HCD_IRQHandler(HCD_HandleTypeDef *hhcd)
     /* Handle Host SOF Interrupt */
     if (__HAL_HCD_GET_FLAG(hhcd, USB_OTG_GINTSTS_SOF))
     {
+      HCD_PeriodicSchedule(hhcd);
+
 #if (USE_HAL_HCD_REGISTER_CALLBACKS == 1U)
       hhcd->SOFCallback(hhcd);
 #else
@@ -1104,6 +1533,30 @@ uint32_t HAL_HCD_HC_GetXferCount(HCD_HandleTypeDef *hhcd, uint8_t chnum)
   return hhcd->hc[chnum].xfer_count;
 }
 
+/**
+  * @brief  Return the periodic polls skipped on a host channel.
+  * @param  hhcd HCD handle
+  * @param  chnum Channel number.
+  *         This parameter can be a value from 1 to 15
+  * @retval Number of polls skipped because the channel was still busy
+  */
+uint32_t HAL_HCD_HC_GetPeriodicMissed(HCD_HandleTypeDef *hhcd, uint8_t chnum)
+{
+  return hhcd->periodic[chnum].Missed;
+}
+
+/**
+  * @brief  Return the transfers of a pipelined channel not completed yet.
+  * @param  hhcd HCD handle
+  * @param  chnum Channel number.
+  *         This parameter can be a value from 1 to 15
+  * @retval Number of transfers queued, the one in progress included
+  */
+uint32_t HAL_HCD_HC_GetPipelineCount(HCD_HandleTypeDef *hhcd, uint8_t chnum)
+{
+  return hhcd->pipeline[chnum].Count;
+}
+
 /**
   * @brief  Return the Host Channel state.
   * @param  hhcd HCD handle
@@ -1169,6 +1622,7 @@ static void HCD_HC_IN_IRQHandler(HCD_HandleTypeDef *hhcd, uint8_t chnum)
   USB_OTG_GlobalTypeDef *USBx = hhcd->Instance;
   uint32_t USBx_BASE = (uint32_t)USBx;
   uint32_t tmpreg;
+  uint32_t pktlen;
 
   if (__HAL_HCD_GET_CH_FLAG(hhcd, chnum, USB_OTG_HCINT_AHBERR))
   {
@@ -1222,6 +1676,8 @@ static void HCD_HC_IN_IRQHandler(HCD_HandleTypeDef *hhcd, uint8_t chnum)
 
     hhcd->hc[chnum].state = HC_XFRC;
     hhcd->hc[chnum].ErrCnt = 0U;
+    hhcd->hc[chnum].do_csplit = 0U;
+    hhcd->hc[chnum].NyetErrCnt = 0U;
     __HAL_HCD_CLEAR_HC_INT(chnum, USB_OTG_HCINT_XFRC);
 
     if ((hhcd->hc[chnum].ep_type == EP_TYPE_CTRL) ||
@@ -1262,6 +1718,14 @@ static void HCD_HC_IN_IRQHandler(HCD_HandleTypeDef *hhcd, uint8_t chnum)
   else if (__HAL_HCD_GET_CH_FLAG(hhcd, chnum, USB_OTG_HCINT_ACK))
   {
     __HAL_HCD_CLEAR_HC_INT(chnum, USB_OTG_HCINT_ACK);
+
+    /* Start split accepted by the hub, go on with the complete split */
+    if ((hhcd->hc[chnum].do_ssplit == 1U) && (hhcd->hc[chnum].do_csplit == 0U))
+    {
+      hhcd->hc[chnum].do_csplit = 1U;
+      hhcd->hc[chnum].state = HC_ACK;
+      (void)USB_HC_Halt(hhcd->Instance, chnum);
+    }
   }
   else if (__HAL_HCD_GET_CH_FLAG(hhcd, chnum, USB_OTG_HCINT_CHH))
   {
@@ -1269,7 +1733,30 @@ static void HCD_HC_IN_IRQHandler(HCD_HandleTypeDef *hhcd, uint8_t chnum)
     if (hhcd->hc[chnum].state == HC_XFRC)
     {
       hhcd->hc[chnum].state = HC_HALTED;
+
+      /* A split moves one packet: restart while full packets are received */
+      if ((hhcd->hc[chnum].do_ssplit == 1U) &&
+          ((hhcd->hc[chnum].ep_type == EP_TYPE_CTRL) ||
+           (hhcd->hc[chnum].ep_type == EP_TYPE_BULK)))
+      {
+        pktlen = hhcd->hc[chnum].XferSize - (USBx_HC(chnum)->HCTSIZ & USB_OTG_HCTSIZ_XFRSIZ);
+
+        if ((pktlen == hhcd->hc[chnum].max_packet) &&
+            (hhcd->hc[chnum].xfer_count < hhcd->hc[chnum].xfer_len))
+        {
+          hhcd->hc[chnum].data_pid = (hhcd->hc[chnum].toggle_in == 0U) ? HC_PID_DATA0 : HC_PID_DATA1;
+          (void)USB_HC_StartXfer(hhcd->Instance, &hhcd->hc[chnum], 0U);
+          return;
+        }
+      }
+
       hhcd->hc[chnum].urb_state = URB_DONE;
+
+      /* Report the pipelined transfer only when all its chunks are received */
+      if ((hhcd->pipeline[chnum].pQueue != NULL) && (HCD_PipelineNext(hhcd, chnum) != 0U))
+      {
+        return;
+      }
     }
     else if (hhcd->hc[chnum].state == HC_STALL)
     {
@@ -1290,20 +1777,55 @@ static void HCD_HC_IN_IRQHandler(HCD_HandleTypeDef *hhcd, uint8_t chnum)
       {
         hhcd->hc[chnum].urb_state = URB_NOTREADY;
 
-        /* re-activate the channel */
-        tmpreg = USBx_HC(chnum)->HCCHAR;
-        tmpreg &= ~USB_OTG_HCCHAR_CHDIS;
-        tmpreg |= USB_OTG_HCCHAR_CHENA;
-        USBx_HC(chnum)->HCCHAR = tmpreg;
+        if (hhcd->hc[chnum].do_ssplit == 1U)
+        {
+          /* restart the split from the start split */
+          hhcd->hc[chnum].do_csplit = 0U;
+          (void)USB_HC_StartXfer(hhcd->Instance, &hhcd->hc[chnum], 0U);
+        }
+        else
+        {
+          /* re-activate the channel */
+          tmpreg = USBx_HC(chnum)->HCCHAR;
+          tmpreg &= ~USB_OTG_HCCHAR_CHDIS;
+          tmpreg |= USB_OTG_HCCHAR_CHENA;
+          USBx_HC(chnum)->HCCHAR = tmpreg;
+        }
       }
     }
     else if (hhcd->hc[chnum].state == HC_NYET)
     {
       hhcd->hc[chnum].state = HC_HALTED;
+
+      /* The hub has no data yet, retry the complete split */
+      if (hhcd->hc[chnum].do_csplit == 1U)
+      {
+        if (hhcd->hc[chnum].ep_type == EP_TYPE_INTR)
+        {
+          hhcd->hc[chnum].NyetErrCnt++;
+        }
+
+        if (hhcd->hc[chnum].NyetErrCnt < HCD_SPLIT_NYET_RETRY)
+        {
+          (void)USB_HC_StartXfer(hhcd->Instance, &hhcd->hc[chnum], 0U);
+          return;
+        }
+
+        hhcd->hc[chnum].NyetErrCnt = 0U;
+        hhcd->hc[chnum].do_csplit = 0U;
+        hhcd->hc[chnum].urb_state = URB_NOTREADY;
+      }
     }
     else if (hhcd->hc[chnum].state == HC_ACK)
     {
       hhcd->hc[chnum].state = HC_HALTED;
+
+      if (hhcd->hc[chnum].do_csplit == 1U)
+      {
+        /* issue the complete split */
+        (void)USB_HC_StartXfer(hhcd->Instance, &hhcd->hc[chnum], 0U);
+        return;
+      }
     }
     else if (hhcd->hc[chnum].state == HC_NAK)
     {
@@ -1313,11 +1835,18 @@ static void HCD_HC_IN_IRQHandler(HCD_HandleTypeDef *hhcd, uint8_t chnum)
       if ((hhcd->hc[chnum].ep_type == EP_TYPE_CTRL) ||
           (hhcd->hc[chnum].ep_type == EP_TYPE_BULK))
       {
-        /* re-activate the channel */
-        tmpreg = USBx_HC(chnum)->HCCHAR;
-        tmpreg &= ~USB_OTG_HCCHAR_CHDIS;
-        tmpreg |= USB_OTG_HCCHAR_CHENA;
-        USBx_HC(chnum)->HCCHAR = tmpreg;
+        if (hhcd->hc[chnum].do_ssplit == 1U)
+        {
+          (void)USB_HC_StartXfer(hhcd->Instance, &hhcd->hc[chnum], 0U);
+        }
+        else
+        {
+          /* re-activate the channel */
+          tmpreg = USBx_HC(chnum)->HCCHAR;
+          tmpreg &= ~USB_OTG_HCCHAR_CHDIS;
+          tmpreg |= USB_OTG_HCCHAR_CHENA;
+          USBx_HC(chnum)->HCCHAR = tmpreg;
+        }
       }
     }
     else if (hhcd->hc[chnum].state == HC_BBLERR)
@@ -1350,6 +1879,9 @@ static void HCD_HC_IN_IRQHandler(HCD_HandleTypeDef *hhcd, uint8_t chnum)
   }
   else if (__HAL_HCD_GET_CH_FLAG(hhcd, chnum, USB_OTG_HCINT_NAK))
   {
+    /* the next attempt starts again with a start split */
+    hhcd->hc[chnum].do_csplit = 0U;
+
     if (hhcd->hc[chnum].ep_type == EP_TYPE_INTR)
     {
       hhcd->hc[chnum].ErrCnt = 0U;
@@ -1410,6 +1942,17 @@ static void HCD_HC_OUT_IRQHandler(HCD_HandleTypeDef *hhcd, uint8_t chnum)
       hhcd->hc[chnum].state = HC_ACK;
       (void)USB_HC_Halt(hhcd->Instance, chnum);
     }
+    else if ((hhcd->hc[chnum].do_ssplit == 1U) && (hhcd->hc[chnum].do_csplit == 0U))
+    {
+      /* Start split accepted by the hub, go on with the complete split */
+      hhcd->hc[chnum].do_csplit = 1U;
+      hhcd->hc[chnum].state = HC_ACK;
+      (void)USB_HC_Halt(hhcd->Instance, chnum);
+    }
+    else
+    {
+      /* ... */
+    }
   }
   else if (__HAL_HCD_GET_CH_FLAG(hhcd, chnum, USB_OTG_HCINT_FRMOR))
   {
@@ -1419,11 +1962,16 @@ static void HCD_HC_OUT_IRQHandler(HCD_HandleTypeDef *hhcd, uint8_t chnum)
   else if (__HAL_HCD_GET_CH_FLAG(hhcd, chnum, USB_OTG_HCINT_XFRC))
   {
     hhcd->hc[chnum].ErrCnt = 0U;
+    hhcd->hc[chnum].do_csplit = 0U;
+    hhcd->hc[chnum].NyetErrCnt = 0U;
 
     /* transaction completed with NYET state, update do ping state */
     if (__HAL_HCD_GET_CH_FLAG(hhcd, chnum, USB_OTG_HCINT_NYET))
     {
-      hhcd->hc[chnum].do_ping = 1U;
+      if (hhcd->hc[chnum].do_ssplit == 0U)
+      {
+        hhcd->hc[chnum].do_ping = 1U;
+      }
       __HAL_HCD_CLEAR_HC_INT(chnum, USB_OTG_HCINT_NYET);
     }
     __HAL_HCD_CLEAR_HC_INT(chnum, USB_OTG_HCINT_XFRC);
@@ -1433,7 +1981,12 @@ static void HCD_HC_OUT_IRQHandler(HCD_HandleTypeDef *hhcd, uint8_t chnum)
   else if (__HAL_HCD_GET_CH_FLAG(hhcd, chnum, USB_OTG_HCINT_NYET))
   {
     hhcd->hc[chnum].state = HC_NYET;
-    hhcd->hc[chnum].do_ping = 1U;
+
+    /* NYET to a complete split means the hub has not finished, no PING */
+    if (hhcd->hc[chnum].do_ssplit == 0U)
+    {
+      hhcd->hc[chnum].do_ping = 1U;
+    }
     hhcd->hc[chnum].ErrCnt = 0U;
     (void)USB_HC_Halt(hhcd->Instance, chnum);
     __HAL_HCD_CLEAR_HC_INT(chnum, USB_OTG_HCINT_NYET);
@@ -1448,6 +2001,7 @@ static void HCD_HC_OUT_IRQHandler(HCD_HandleTypeDef *hhcd, uint8_t chnum)
   {
     hhcd->hc[chnum].ErrCnt = 0U;
     hhcd->hc[chnum].state = HC_NAK;
+    hhcd->hc[chnum].do_csplit = 0U;
 
     if (hhcd->hc[chnum].do_ping == 0U)
     {
@@ -1500,6 +2054,23 @@ static void HCD_HC_OUT_IRQHandler(HCD_HandleTypeDef *hhcd, uint8_t chnum)
     if (hhcd->hc[chnum].state == HC_XFRC)
     {
       hhcd->hc[chnum].state = HC_HALTED;
+
+      /* A split moves one packet: send the next one of the transfer */
+      if ((hhcd->hc[chnum].do_ssplit == 1U) && (hhcd->hc[chnum].xfer_len > hhcd->hc[chnum].max_packet))
+      {
+        hhcd->hc[chnum].xfer_buff += hhcd->hc[chnum].max_packet;
+        hhcd->hc[chnum].xfer_len -= hhcd->hc[chnum].max_packet;
+
+        if ((hhcd->hc[chnum].ep_type == EP_TYPE_BULK) ||
+            (hhcd->hc[chnum].ep_type == EP_TYPE_INTR))
+        {
+          hhcd->hc[chnum].toggle_out ^= 1U;
+        }
+        hhcd->hc[chnum].data_pid = (hhcd->hc[chnum].data_pid == HC_PID_DATA0) ? HC_PID_DATA1 : HC_PID_DATA0;
+        (void)USB_HC_StartXfer(hhcd->Instance, &hhcd->hc[chnum], 0U);
+        return;
+      }
+
       hhcd->hc[chnum].urb_state  = URB_DONE;
       if ((hhcd->hc[chnum].ep_type == EP_TYPE_BULK) ||
           (hhcd->hc[chnum].ep_type == EP_TYPE_INTR))
@@ -1519,19 +2090,57 @@ static void HCD_HC_OUT_IRQHandler(HCD_HandleTypeDef *hhcd, uint8_t chnum)
           }
         }
       }
+
+      /* Report the pipelined transfer only when all its chunks are sent */
+      if ((hhcd->pipeline[chnum].pQueue != NULL) && (HCD_PipelineNext(hhcd, chnum) != 0U))
+      {
+        return;
+      }
     }
     else if (hhcd->hc[chnum].state == HC_ACK)
     {
       hhcd->hc[chnum].state = HC_HALTED;
+
+      if (hhcd->hc[chnum].do_csplit == 1U)
+      {
+        /* issue the complete split */
+        (void)USB_HC_StartXfer(hhcd->Instance, &hhcd->hc[chnum], 0U);
+        return;
+      }
     }
     else if (hhcd->hc[chnum].state == HC_NAK)
     {
       hhcd->hc[chnum].state = HC_HALTED;
       hhcd->hc[chnum].urb_state = URB_NOTREADY;
+
+      /* The device is not ready: retry the pipelined transfer in the driver */
+      if (hhcd->pipeline[chnum].pQueue != NULL)
+      {
+        HCD_PipelineResume(hhcd, chnum);
+        return;
+      }
     }
     else if (hhcd->hc[chnum].state == HC_NYET)
     {
       hhcd->hc[chnum].state = HC_HALTED;
+
+      /* The hub has not finished the transaction, retry the complete split */
+      if (hhcd->hc[chnum].do_csplit == 1U)
+      {
+        if (hhcd->hc[chnum].ep_type == EP_TYPE_INTR)
+        {
+          hhcd->hc[chnum].NyetErrCnt++;
+        }
+
+        if (hhcd->hc[chnum].NyetErrCnt < HCD_SPLIT_NYET_RETRY)
+        {
+          (void)USB_HC_StartXfer(hhcd->Instance, &hhcd->hc[chnum], 0U);
+          return;
+        }
+
+        hhcd->hc[chnum].NyetErrCnt = 0U;
+        hhcd->hc[chnum].do_csplit = 0U;
+      }
       hhcd->hc[chnum].urb_state  = URB_NOTREADY;
     }
     else if (hhcd->hc[chnum].state == HC_STALL)
@@ -1553,11 +2162,20 @@ static void HCD_HC_OUT_IRQHandler(HCD_HandleTypeDef *hhcd, uint8_t chnum)
       {
         hhcd->hc[chnum].urb_state = URB_NOTREADY;
 
-        /* re-activate the channel  */
-        tmpreg = USBx_HC(chnum)->HCCHAR;
-        tmpreg &= ~USB_OTG_HCCHAR_CHDIS;
-        tmpreg |= USB_OTG_HCCHAR_CHENA;
-        USBx_HC(chnum)->HCCHAR = tmpreg;
+        if (hhcd->hc[chnum].do_ssplit == 1U)
+        {
+          /* restart the split from the start split */
+          hhcd->hc[chnum].do_csplit = 0U;
+          (void)USB_HC_StartXfer(hhcd->Instance, &hhcd->hc[chnum], 0U);
+        }
+        else
+        {
+          /* re-activate the channel  */
+          tmpreg = USBx_HC(chnum)->HCCHAR;
+          tmpreg &= ~USB_OTG_HCCHAR_CHDIS;
+          tmpreg |= USB_OTG_HCCHAR_CHENA;
+          USBx_HC(chnum)->HCCHAR = tmpreg;
+        }
       }
     }
     else
@@ -1728,6 +2346,170 @@ static void HCD_Port_IRQHandler(HCD_HandleTypeDef *hhcd)
   USBx_HPRT0 = hprt0_dup;
 }
 
+/**
+  * @brief  Start the periodic transfers due in the current (micro)frame.
+  * @param  hhcd HCD handle
+  * @retval None
+  */
+static void HCD_PeriodicSchedule(HCD_HandleTypeDef *hhcd)
+{
+  USB_OTG_GlobalTypeDef *USBx = hhcd->Instance;
+  uint32_t USBx_BASE = (uint32_t)USBx;
+  uint32_t frame = USBx_HOST->HFNUM & USB_OTG_HFNUM_FRNUM;
+  uint32_t ch;
+
+  for (ch = 0U; ch < 16U; ch++)
+  {
+    if ((hhcd->periodic[ch].Interval != 0U) &&
+        ((frame & ((uint32_t)hhcd->periodic[ch].Interval - 1U)) == hhcd->periodic[ch].Phase))
+    {
+      if ((USBx_HC(ch)->HCCHAR & USB_OTG_HCCHAR_CHENA) == 0U)
+      {
+        (void)HAL_HCD_HC_SubmitRequest(hhcd, (uint8_t)ch, hhcd->hc[ch].ep_is_in,
+                                       hhcd->hc[ch].ep_type, 1U, hhcd->periodic[ch].pBuff,
+                                       hhcd->periodic[ch].Length, 0U);
+      }
+      else
+      {
+        hhcd->periodic[ch].Missed++;
+      }
+    }
+  }
+}
+
+/**
+  * @brief  Start the next chunk of the pipelined transfer in progress.
+  * @param  hhcd HCD handle
+  * @param  chnum Channel number.
+  *         This parameter can be a value from 1 to 15
+  * @retval None
+  */
+static void HCD_PipelineStart(HCD_HandleTypeDef *hhcd, uint8_t chnum)
+{
+  HCD_PipelineTypeDef *pipeline = &hhcd->pipeline[chnum];
+  HCD_BulkXferTypeDef *xfer = &pipeline->pQueue[pipeline->Head];
+  uint32_t maxlen = HC_MAX_PKT_CNT * (uint32_t)hhcd->hc[chnum].max_packet;
+  uint32_t len = xfer->Length - pipeline->Offset;
+  uint8_t toggle;
+
+  /* A channel moves at most HC_MAX_PKT_CNT packets per start */
+  if (len > maxlen)
+  {
+    len = maxlen;
+  }
+
+  toggle = (hhcd->hc[chnum].ep_is_in != 0U) ? hhcd->hc[chnum].toggle_in : hhcd->hc[chnum].toggle_out;
+
+  hhcd->hc[chnum].data_pid = (toggle == 0U) ? HC_PID_DATA0 : HC_PID_DATA1;
+  hhcd->hc[chnum].xfer_buff = &xfer->pBuff[pipeline->Offset];
+  hhcd->hc[chnum].xfer_len = len;
+  hhcd->hc[chnum].xfer_count = 0U;
+  hhcd->hc[chnum].state = HC_IDLE;
+
+  (void)USB_HC_StartXfer(hhcd->Instance, &hhcd->hc[chnum], 1U);
+}
+
+/**
+  * @brief  Account for the end of a pipelined chunk and arm the next chunk or
+  *         the next queued transfer.
+  * @param  hhcd HCD handle
+  * @param  chnum Channel number.
+  *         This parameter can be a value from 1 to 15
+  * @retval 1 when the transfer in progress goes on, 0 when it is completed
+  */
+static uint32_t HCD_PipelineNext(HCD_HandleTypeDef *hhcd, uint8_t chnum)
+{
+  USB_OTG_GlobalTypeDef *USBx = hhcd->Instance;
+  uint32_t USBx_BASE = (uint32_t)USBx;
+  HCD_PipelineTypeDef *pipeline = &hhcd->pipeline[chnum];
+  HCD_BulkXferTypeDef *xfer;
+  uint8_t toggle;
+  uint32_t count;
+
+  if (pipeline->Count == 0U)
+  {
+    return 0U;
+  }
+
+  xfer = &pipeline->pQueue[pipeline->Head];
+
+  /* The core leaves the PID of the next packet in HCTSIZ */
+  toggle = ((USBx_HC(chnum)->HCTSIZ & USB_OTG_HCTSIZ_DPID) ==
+            ((uint32_t)HC_PID_DATA1 << USB_OTG_HCTSIZ_DPID_Pos)) ? 1U : 0U;
+
+  if (hhcd->hc[chnum].ep_is_in != 0U)
+  {
+    hhcd->hc[chnum].toggle_in = toggle;
+    count = hhcd->hc[chnum].xfer_count;
+  }
+  else
+  {
+    hhcd->hc[chnum].toggle_out = toggle;
+    count = hhcd->hc[chnum].xfer_len;
+  }
+
+  pipeline->Offset += count;
+
+  /* Go on with the next chunk unless a short packet ended the IN transfer */
+  if ((pipeline->Offset < xfer->Length) &&
+      ((hhcd->hc[chnum].ep_is_in == 0U) || (count == hhcd->hc[chnum].XferSize)))
+  {
+    HCD_PipelineStart(hhcd, chnum);
+    return 1U;
+  }
+
+  xfer->XferCount = pipeline->Offset;
+  pipeline->Offset = 0U;
+  pipeline->Head = (uint8_t)((pipeline->Head + 1U) % pipeline->Depth);
+  pipeline->Count--;
+
+  /* Arm the next transfer before the completed one is reported */
+  if (pipeline->Count != 0U)
+  {
+    HCD_PipelineStart(hhcd, chnum);
+  }
+
+  return 0U;
+}
+
+/**
+  * @brief  Restart a NAKed pipelined OUT chunk from its first packet not
+  *         acknowledged.
+  * @param  hhcd HCD handle
+  * @param  chnum Channel number.
+  *         This parameter can be a value from 1 to 15
+  * @retval None
+  */
+static void HCD_PipelineResume(HCD_HandleTypeDef *hhcd, uint8_t chnum)
+{
+  USB_OTG_GlobalTypeDef *USBx = hhcd->Instance;
+  uint32_t USBx_BASE = (uint32_t)USBx;
+  uint32_t tmpreg = USBx_HC(chnum)->HCTSIZ;
+  uint32_t num_packets;
+  uint32_t remaining;
+  uint32_t sent = 0U;
+
+  num_packets = (hhcd->hc[chnum].xfer_len + hhcd->hc[chnum].max_packet - 1U) / hhcd->hc[chnum].max_packet;
+  remaining = (tmpreg & USB_OTG_HCTSIZ_PKTCNT) >> USB_OTG_HCTSIZ_PKTCNT_Pos;
+
+  /* The core counts down the packets acknowledged by the device */
+  if (num_packets > remaining)
+  {
+    sent = (num_packets - remaining) * hhcd->hc[chnum].max_packet;
+
+    if (sent > hhcd->hc[chnum].xfer_len)
+    {
+      sent = hhcd->hc[chnum].xfer_len;
+    }
+  }
+
+  hhcd->hc[chnum].toggle_out = ((tmpreg & USB_OTG_HCTSIZ_DPID) ==
+                                ((uint32_t)HC_PID_DATA1 << USB_OTG_HCTSIZ_DPID_Pos)) ? 1U : 0U;
+  hhcd->pipeline[chnum].Offset += sent;
+
+  HCD_PipelineStart(hhcd, chnum);
+}
+
 /**
   * @}
   */
@@ -12,6 +12,7 @@
   *           + Release and release all functions
   *           + Semaphore notification enabling and disabling and callnack functions
   *           + IRQ handler management
+  *           + Shared resource arbiter with ownership caching (dual core devices)
   *
   *
   ******************************************************************************
@@ -80,6 +81,43 @@
       (+) __HAL_HSEM_GET_FLAG: Get the semaphores status release flags.
       (+) __HAL_HSEM_CLEAR_FLAG: Clear the semaphores status release flags.
 
+     *** Shared resource arbiter (dual core devices) ***
+     =============================================
+     [..] The arbiter keeps the semaphore of a resource shared by both cores (RCC, GPIO,
+          FLASH...) taken between accesses, until the other core requests it. An access
+          by the owner core is then a local check instead of a semaphore take and release.
+
+      (+) Use three semaphores per resource: the resource semaphore, and one request
+          semaphore per core. On each core, fill an HSEM_ArbiterTypeDef with the resource
+          semaphore, the request semaphore notified on this core (RequestSemID) and the
+          one notified on the other core (PeerRequestSemID), then call HAL_HSEM_ArbiterInit().
+      (+) Enable the HSEM interrupt of the core and call HAL_HSEM_ArbiterIRQHandler() with
+          the SemMask of HAL_HSEM_FreeCallback() for each arbiter of the core.
+      (+) Surround each access with HAL_HSEM_ArbiterAcquire() and HAL_HSEM_ArbiterRelease().
+          When the core does not own the semaphore, HAL_HSEM_ArbiterAcquire() requests it
+          from the other core, which gives it up at once when it is not accessing the
+          resource, otherwise at the end of its access.
+
+     *** Boot coordination (dual core devices) ***
+     =============================================
+     [..] The core configuring the system (usually the CM7) publishes boot events to the
+          other core, which sleeps until they are notified instead of polling a flag.
+
+      (+) On the configuring core, call HAL_HSEM_BootPublish(HSEM_BOOT_EVENT_CLOCK_READY)
+          at the end of SystemClock_Config(), and HAL_HSEM_BootPublish(HSEM_BOOT_EVENT_SHMEM_READY)
+          once the shared memory is initialized. For the CM4 gated boot, start the CM4 with
+          HAL_RCCEx_EnableBootCore(RCC_BOOT_C2) as early as needed: an event published
+          before the other core waits is not lost, so the configuring core does not wait
+          for the other core to reach its wait loop (no D2 domain STOP handshake).
+      (+) On the other core, call HAL_HSEM_BootWait() with the events needed before its
+          clock dependent initialization, for instance
+          HAL_HSEM_BootWait(HSEM_BOOT_EVENT_CLOCK_READY, HAL_MAX_DELAY) before HAL_Init(),
+          then HAL_HSEM_BootWait(HSEM_BOOT_EVENT_SHMEM_READY, Timeout) before the first
+          shared memory access. The core sleeps with WFE while waiting.
+      (+) The HSEM semaphores used are HSEM_BOOT_CLOCK_SEMID and HSEM_BOOT_SHMEM_SEMID.
+          The HSEM interrupt of the waiting core must be disabled in the NVIC during
+          HAL_HSEM_BootWait().
+
   @endverbatim
   ******************************************************************************
   */
@@ -124,6 +162,15 @@
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
+#if defined(DUAL_CORE)
+/** @defgroup HSEM_Private_Functions HSEM Private Functions
+  * @{
+  */
+static uint32_t HSEM_BootEventsToMask(uint32_t Events);
+/**
+  * @}
+  */
+#endif /* DUAL_CORE */
 /* Private functions ---------------------------------------------------------*/
 /* Exported functions --------------------------------------------------------*/
 
@@ -433,10 +480,409 @@ __weak void HAL_HSEM_FreeCallback(uint32_t SemMask)
   * @}
   */
 
+#if defined(DUAL_CORE)
+/** @defgroup HSEM_Exported_Functions_Group4 HSEM shared resource arbiter functions
+  *  @brief   HSEM shared resource arbiter functions.
+  *
+@verbatim
+  ==============================================================================
+              ##### HSEM shared resource arbiter functions #####
+  ==============================================================================
+[..] This section provides functions allowing to:
+      (+) Initialize and de-initialize an arbiter
+      (+) Acquire and release a shared resource
+      (+) Handle the requests of the other core
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Initialize a shared resource arbiter.
+  * @note   The resource semaphore is not taken, and the request notification of
+  *         this core is activated.
+  * @param  harb: arbiter
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_HSEM_ArbiterInit(HSEM_ArbiterTypeDef *harb)
+{
+  uint32_t reqmask;
+
+  if (harb == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the parameters */
+  assert_param(IS_HSEM_SEMID(harb->SemID));
+  assert_param(IS_HSEM_SEMID(harb->RequestSemID));
+  assert_param(IS_HSEM_SEMID(harb->PeerRequestSemID));
+
+  if ((harb->SemID == harb->RequestSemID) || (harb->SemID == harb->PeerRequestSemID) ||
+      (harb->RequestSemID == harb->PeerRequestSemID))
+  {
+    return HAL_ERROR;
+  }
+
+  harb->Owned        = 0U;
+  harb->InUse        = 0U;
+  harb->YieldPending = 0U;
+  harb->FastCount    = 0U;
+  harb->TakeCount    = 0U;
+
+  /* Discard a request raised before the initialization, then listen to the next ones */
+  reqmask = __HAL_HSEM_SEMID_TO_MASK(harb->RequestSemID);
+  __HAL_HSEM_CLEAR_FLAG(reqmask);
+  HAL_HSEM_ActivateNotification(reqmask);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  De-initialize a shared resource arbiter.
+  * @note   The resource semaphore is released if it is owned by this core.
+  * @param  harb: arbiter
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_HSEM_ArbiterDeInit(HSEM_ArbiterTypeDef *harb)
+{
+  uint32_t primask;
+
+  if (harb == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  HAL_HSEM_DeactivateNotification(__HAL_HSEM_SEMID_TO_MASK(harb->RequestSemID));
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  if (harb->Owned != 0U)
+  {
+    harb->Owned = 0U;
+    HAL_HSEM_Release(harb->SemID, 0U);
+  }
+  harb->InUse        = 0U;
+  harb->YieldPending = 0U;
+
+  __set_PRIMASK(primask);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Acquire a shared resource.
+  * @note   When this core already owns the semaphore, only a local check is done.
+  *         Otherwise the resource is requested from the other core and the
+  *         semaphore is taken as soon as it is given up.
+  * @param  harb: arbiter
+  * @param  Timeout: timeout duration in ms
+  * @retval HAL status, HAL_TIMEOUT when the other core did not give up the resource
+  */
+HAL_StatusTypeDef HAL_HSEM_ArbiterAcquire(HSEM_ArbiterTypeDef *harb, uint32_t Timeout)
+{
+  uint32_t primask;
+  uint32_t tickstart;
+  uint32_t requesttick = 0U;
+  uint32_t requested = 0U;
+
+  /* Fast path : the semaphore is kept by this core. The check and the use flag are
+     atomic against HAL_HSEM_ArbiterIRQHandler() */
+  primask = __get_PRIMASK();
+  __disable_irq();
+  if (harb->Owned != 0U)
+  {
+    harb->InUse = 1U;
+    __set_PRIMASK(primask);
+    harb->FastCount++;
+    return HAL_OK;
+  }
+  __set_PRIMASK(primask);
+
+  tickstart = HAL_GetTick();
+
+  while (HAL_HSEM_FastTake(harb->SemID) != HAL_OK)
+  {
+    /* Request the resource: the release notifies the other core. The request is
+       repeated each tick, in case it reached the other core while it was taking
+       the semaphore */
+    if ((requested == 0U) || (HAL_GetTick() != requesttick))
+    {
+      if (HAL_HSEM_FastTake(harb->PeerRequestSemID) == HAL_OK)
+      {
+        HAL_HSEM_Release(harb->PeerRequestSemID, 0U);
+        requested = 1U;
+        requesttick = HAL_GetTick();
+      }
+    }
+
+    if (Timeout != HAL_MAX_DELAY)
+    {
+      if (((HAL_GetTick() - tickstart) > Timeout) || (Timeout == 0U))
+      {
+        return HAL_TIMEOUT;
+      }
+    }
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  harb->Owned = 1U;
+  harb->InUse = 1U;
+  harb->YieldPending = 0U;
+  __set_PRIMASK(primask);
+  harb->TakeCount++;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Release a shared resource.
+  * @note   The semaphore is kept by this core, unless the other core requested the
+  *         resource during the access.
+  * @param  harb: arbiter
+  * @retval None
+  */
+void HAL_HSEM_ArbiterRelease(HSEM_ArbiterTypeDef *harb)
+{
+  uint32_t primask;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  harb->InUse = 0U;
+  if ((harb->YieldPending != 0U) && (harb->Owned != 0U))
+  {
+    harb->YieldPending = 0U;
+    harb->Owned = 0U;
+
+    /* The accesses to the resource complete before the other core takes it */
+    __DSB();
+    HAL_HSEM_Release(harb->SemID, 0U);
+  }
+
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Handle the resource requests of the other core.
+  * @note   This function is called from HAL_HSEM_FreeCallback() with its SemMask.
+  *         The request notification is activated again, as it is disabled by
+  *         HAL_HSEM_IRQHandler().
+  * @param  harb: arbiter
+  * @param  SemMask: Mask of released semaphores
+  * @retval None
+  */
+void HAL_HSEM_ArbiterIRQHandler(HSEM_ArbiterTypeDef *harb, uint32_t SemMask)
+{
+  uint32_t reqmask = __HAL_HSEM_SEMID_TO_MASK(harb->RequestSemID);
+
+  if ((SemMask & reqmask) != 0U)
+  {
+    HAL_HSEM_ActivateNotification(reqmask);
+
+    if (harb->Owned != 0U)
+    {
+      if (harb->InUse == 0U)
+      {
+        /* Give up the resource at once */
+        harb->Owned = 0U;
+        __DSB();
+        HAL_HSEM_Release(harb->SemID, 0U);
+      }
+      else
+      {
+        /* Give up the resource at the end of the access */
+        harb->YieldPending = 1U;
+      }
+    }
+  }
+}
+
+/**
+  * @}
+  */
+
+/** @defgroup HSEM_Exported_Functions_Group5 HSEM boot coordination functions
+  *  @brief   HSEM boot coordination functions.
+  *
+@verbatim
+  ==============================================================================
+              ##### HSEM boot coordination functions #####
+  ==============================================================================
+[..] This section provides functions allowing to:
+      (+) Publish boot events to the other core
+      (+) Wait in low power for boot events published by the other core
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Publish boot events to the other core.
+  * @note   The memory accesses done before the call complete before the events are
+  *         notified. Data cache lines holding shared memory must be cleaned by the
+  *         application before publishing HSEM_BOOT_EVENT_SHMEM_READY.
+  * @param  Events: events to publish, combination of @ref HSEM_Boot_Event
+  * @retval None
+  */
+void HAL_HSEM_BootPublish(uint32_t Events)
+{
+  /* Check the parameters */
+  assert_param(IS_HSEM_BOOT_EVENT(Events));
+
+  __DSB();
+
+  /* The release of a taken semaphore sets its status flag on the other core,
+     and notifies it when it has activated the notification */
+  if ((Events & HSEM_BOOT_EVENT_CLOCK_READY) != 0U)
+  {
+    if (HAL_HSEM_FastTake(HSEM_BOOT_CLOCK_SEMID) == HAL_OK)
+    {
+      HAL_HSEM_Release(HSEM_BOOT_CLOCK_SEMID, 0U);
+    }
+  }
+
+  if ((Events & HSEM_BOOT_EVENT_SHMEM_READY) != 0U)
+  {
+    if (HAL_HSEM_FastTake(HSEM_BOOT_SHMEM_SEMID) == HAL_OK)
+    {
+      HAL_HSEM_Release(HSEM_BOOT_SHMEM_SEMID, 0U);
+    }
+  }
+}
+
+/**
+  * @brief  Wait for boot events published by the other core.
+  * @note   The core sleeps with WFE until the events are notified. The events are
+  *         latched by the HSEM, so they may have been published before the call.
+  * @note   Timeout different from HAL_MAX_DELAY requires the tick to be running,
+  *         use HAL_MAX_DELAY before HAL_Init().
+  * @param  Events: events to wait for, combination of @ref HSEM_Boot_Event
+  * @param  Timeout: timeout duration in ms
+  * @retval HAL status, HAL_TIMEOUT when the events were not all published in time
+  */
+HAL_StatusTypeDef HAL_HSEM_BootWait(uint32_t Events, uint32_t Timeout)
+{
+  uint32_t tickstart = 0U;
+  uint32_t semmask;
+  uint32_t received = 0U;
+  IRQn_Type irqn;
+  HAL_StatusTypeDef status = HAL_OK;
+
+  /* Check the parameters */
+  assert_param(IS_HSEM_BOOT_EVENT(Events));
+
+  if (Timeout != HAL_MAX_DELAY)
+  {
+    tickstart = HAL_GetTick();
+  }
+
+  semmask = HSEM_BootEventsToMask(Events);
+  irqn = (HAL_GetCurrentCPUID() == HSEM_CPU1_COREID) ? HSEM1_IRQn : HSEM2_IRQn;
+
+  /* The release notification pends the HSEM interrupt, disabled in the NVIC,
+     which wakes the core from WFE */
+  SET_BIT(SCB->SCR, SCB_SCR_SEVONPEND_Msk);
+  HAL_HSEM_ActivateNotification(semmask);
+
+  for (;;)
+  {
+    /* Clear the interrupt pending flag before reading the status, so that a
+       release after the read sets the event again */
+    NVIC_ClearPendingIRQ(irqn);
+
+    received |= __HAL_HSEM_GET_FLAG(semmask);
+    __HAL_HSEM_CLEAR_FLAG(received);
+
+    if (received == semmask)
+    {
+      break;
+    }
+
+    if (Timeout != HAL_MAX_DELAY)
+    {
+      if (((HAL_GetTick() - tickstart) > Timeout) || (Timeout == 0U))
+      {
+        status = HAL_TIMEOUT;
+        break;
+      }
+    }
+
+    __WFE();
+  }
+
+  HAL_HSEM_DeactivateNotification(semmask);
+  NVIC_ClearPendingIRQ(irqn);
+  CLEAR_BIT(SCB->SCR, SCB_SCR_SEVONPEND_Msk);
+
+  return status;
+}
+
+/**
+  * @brief  Get the boot events published by the other core and not yet waited for.
+  * @retval Events, combination of @ref HSEM_Boot_Event
+  */
+uint32_t HAL_HSEM_BootGetEvents(void)
+{
+  uint32_t flags = __HAL_HSEM_GET_FLAG(HSEM_BootEventsToMask(HSEM_BOOT_EVENT_ALL));
+  uint32_t events = 0U;
+
+  if ((flags & (uint32_t)__HAL_HSEM_SEMID_TO_MASK(HSEM_BOOT_CLOCK_SEMID)) != 0U)
+  {
+    events |= HSEM_BOOT_EVENT_CLOCK_READY;
+  }
+
+  if ((flags & (uint32_t)__HAL_HSEM_SEMID_TO_MASK(HSEM_BOOT_SHMEM_SEMID)) != 0U)
+  {
+    events |= HSEM_BOOT_EVENT_SHMEM_READY;
+  }
+
+  return events;
+}
+
+/**
+  * @}
+  */
+#endif /* DUAL_CORE */
+
 /**
   * @}
   */
 
+#if defined(DUAL_CORE)
+/** @addtogroup HSEM_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Convert boot events to the mask of their semaphores.
+  * @param  Events: combination of @ref HSEM_Boot_Event
+  * @retval Semaphores Mask
+  */
+static uint32_t HSEM_BootEventsToMask(uint32_t Events)
+{
+  uint32_t semmask = 0U;
+
+  if ((Events & HSEM_BOOT_EVENT_CLOCK_READY) != 0U)
+  {
+    semmask |= (uint32_t)__HAL_HSEM_SEMID_TO_MASK(HSEM_BOOT_CLOCK_SEMID);
+  }
+
+  if ((Events & HSEM_BOOT_EVENT_SHMEM_READY) != 0U)
+  {
+    semmask |= (uint32_t)__HAL_HSEM_SEMID_TO_MASK(HSEM_BOOT_SHMEM_SEMID);
+  }
+
+  return semmask;
+}
+
+/**
+  * @}
+  */
+#endif /* DUAL_CORE */
+
 #endif /* HAL_HSEM_MODULE_ENABLED */
 /**
   * @}
@@ -1936,7 +1936,7 @@ HAL_StatusTypeDef HAL_I2C_Master_Transmit_DMA(I2C_HandleTypeDef *hi2c, uint16_t
 
         /* Enable the DMA stream or channel depends on Instance */
         dmaxferstatus = HAL_DMA_Start_IT(hi2c->hdmatx, (uint32_t)pData, (uint32_t)&hi2c->Instance->TXDR,
-                                         hi2c->XferSize);
+                                         hi2c->XferCount);
       }
       else
       {
@@ -1971,6 +1971,13 @@ HAL_StatusTypeDef HAL_I2C_Master_Transmit_DMA(I2C_HandleTypeDef *hi2c, uint16_t
         /* Enable ERR and NACK interrupts */
         I2C_Enable_IRQ(hi2c, I2C_XFER_ERROR_IT);
 
+        /* The DMA covers the whole buffer, only the NBYTES reloads are done on TCR event */
+        if (hi2c->XferCount != 0U)
+        {
+          /* Enable TC interrupts */
+          I2C_Enable_IRQ(hi2c, I2C_XFER_RELOAD_IT);
+        }
+
         /* Enable DMA Request */
         hi2c->Instance->CR1 |= I2C_CR1_TXDMAEN;
       }
@@ -2083,7 +2090,7 @@ HAL_StatusTypeDef HAL_I2C_Master_Receive_DMA(I2C_HandleTypeDef *hi2c, uint16_t D
 
         /* Enable the DMA stream or channel depends on Instance */
         dmaxferstatus = HAL_DMA_Start_IT(hi2c->hdmarx, (uint32_t)&hi2c->Instance->RXDR, (uint32_t)pData,
-                                         hi2c->XferSize);
+                                         hi2c->XferCount);
       }
       else
       {
@@ -2118,6 +2125,13 @@ HAL_StatusTypeDef HAL_I2C_Master_Receive_DMA(I2C_HandleTypeDef *hi2c, uint16_t D
         /* Enable ERR and NACK interrupts */
         I2C_Enable_IRQ(hi2c, I2C_XFER_ERROR_IT);
 
+        /* The DMA covers the whole buffer, only the NBYTES reloads are done on TCR event */
+        if (hi2c->XferCount != 0U)
+        {
+          /* Enable TC interrupts */
+          I2C_Enable_IRQ(hi2c, I2C_XFER_RELOAD_IT);
+        }
+
         /* Enable DMA Request */
         hi2c->Instance->CR1 |= I2C_CR1_RXDMAEN;
       }
@@ -2943,7 +2957,7 @@ HAL_StatusTypeDef HAL_I2C_Mem_Write_DMA(I2C_HandleTypeDef *hi2c, uint16_t DevAdd
 
       /* Enable the DMA stream or channel depends on Instance */
       dmaxferstatus = HAL_DMA_Start_IT(hi2c->hdmatx, (uint32_t)pData, (uint32_t)&hi2c->Instance->TXDR,
-                                       hi2c->XferSize);
+                                       hi2c->XferCount);
     }
     else
     {
@@ -3089,7 +3103,7 @@ HAL_StatusTypeDef HAL_I2C_Mem_Read_DMA(I2C_HandleTypeDef *hi2c, uint16_t DevAddr
 
       /* Enable the DMA stream or channel depends on Instance */
       dmaxferstatus = HAL_DMA_Start_IT(hi2c->hdmarx, (uint32_t)&hi2c->Instance->RXDR, (uint32_t)pData,
-                                       hi2c->XferSize);
+                                       hi2c->XferCount);
     }
     else
     {
@@ -3463,7 +3477,7 @@ HAL_StatusTypeDef HAL_I2C_Master_Seq_Transmit_DMA(I2C_HandleTypeDef *hi2c, uint1
 
         /* Enable the DMA stream or channel depends on Instance */
         dmaxferstatus = HAL_DMA_Start_IT(hi2c->hdmatx, (uint32_t)pData, (uint32_t)&hi2c->Instance->TXDR,
-                                         hi2c->XferSize);
+                                         hi2c->XferCount);
       }
       else
       {
@@ -3497,6 +3511,13 @@ HAL_StatusTypeDef HAL_I2C_Master_Seq_Transmit_DMA(I2C_HandleTypeDef *hi2c, uint1
         /* Enable ERR and NACK interrupts */
         I2C_Enable_IRQ(hi2c, I2C_XFER_ERROR_IT);
 
+        /* The DMA covers the whole buffer, only the NBYTES reloads are done on TCR event */
+        if (hi2c->XferCount != 0U)
+        {
+          /* Enable TC interrupts */
+          I2C_Enable_IRQ(hi2c, I2C_XFER_RELOAD_IT);
+        }
+
         /* Enable DMA Request */
         hi2c->Instance->CR1 |= I2C_CR1_TXDMAEN;
       }
@@ -3718,7 +3739,7 @@ HAL_StatusTypeDef HAL_I2C_Master_Seq_Receive_DMA(I2C_HandleTypeDef *hi2c, uint16
 
         /* Enable the DMA stream or channel depends on Instance */
         dmaxferstatus = HAL_DMA_Start_IT(hi2c->hdmarx, (uint32_t)&hi2c->Instance->RXDR, (uint32_t)pData,
-                                         hi2c->XferSize);
+                                         hi2c->XferCount);
       }
       else
       {
@@ -3752,6 +3773,13 @@ HAL_StatusTypeDef HAL_I2C_Master_Seq_Receive_DMA(I2C_HandleTypeDef *hi2c, uint16
         /* Enable ERR and NACK interrupts */
         I2C_Enable_IRQ(hi2c, I2C_XFER_ERROR_IT);
 
+        /* The DMA covers the whole buffer, only the NBYTES reloads are done on TCR event */
+        if (hi2c->XferCount != 0U)
+        {
+          /* Enable TC interrupts */
+          I2C_Enable_IRQ(hi2c, I2C_XFER_RELOAD_IT);
+        }
+
         /* Enable DMA Request */
         hi2c->Instance->CR1 |= I2C_CR1_RXDMAEN;
       }
@@ -5248,9 +5276,6 @@ static HAL_StatusTypeDef I2C_Master_ISR_DMA(struct __I2C_HandleTypeDef *hi2c, ui
   else if ((I2C_CHECK_FLAG(ITFlags, I2C_FLAG_TCR) != RESET) && \
            (I2C_CHECK_IT_SOURCE(ITSources, I2C_IT_TCI) != RESET))
   {
-    /* Disable TC interrupt */
-    __HAL_I2C_DISABLE_IT(hi2c, I2C_IT_TCI);
-
     if (hi2c->XferCount != 0U)
     {
       /* Recover Slave address */
@@ -5275,24 +5300,23 @@ static HAL_StatusTypeDef I2C_Master_ISR_DMA(struct __I2C_HandleTypeDef *hi2c, ui
         }
       }
 
-      /* Set the new XferSize in Nbytes register */
-      I2C_TransferConfig(hi2c, devaddress, (uint8_t)hi2c->XferSize, xfermode, I2C_NO_STARTSTOP);
-
-      /* Update XferCount value */
+      /* Update XferCount value before the reload, the DMA may end as soon as NBYTES is written */
       hi2c->XferCount -= hi2c->XferSize;
 
-      /* Enable DMA Request */
-      if (hi2c->State == HAL_I2C_STATE_BUSY_RX)
-      {
-        hi2c->Instance->CR1 |= I2C_CR1_RXDMAEN;
-      }
-      else
+      if (hi2c->XferCount == 0U)
       {
-        hi2c->Instance->CR1 |= I2C_CR1_TXDMAEN;
+        /* Last reload: TC interrupt is enabled again at end of DMA transfer */
+        __HAL_I2C_DISABLE_IT(hi2c, I2C_IT_TCI);
       }
+
+      /* Set the new XferSize in Nbytes register, the DMA request is kept enabled */
+      I2C_TransferConfig(hi2c, devaddress, (uint8_t)hi2c->XferSize, xfermode, I2C_NO_STARTSTOP);
     }
     else
     {
+      /* Disable TC interrupt */
+      __HAL_I2C_DISABLE_IT(hi2c, I2C_IT_TCI);
+
       /* Call TxCpltCallback() if no stop mode is set */
       if (I2C_GET_STOP_MODE(hi2c) != I2C_AUTOEND_MODE)
       {
@@ -6518,41 +6542,8 @@ static void I2C_DMAMasterTransmitCplt(DMA_HandleTypeDef *hdma)
   /* Disable DMA Request */
   hi2c->Instance->CR1 &= ~I2C_CR1_TXDMAEN;
 
-  /* If last transfer, enable STOP interrupt */
-  if (hi2c->XferCount == 0U)
-  {
-    /* Enable STOP interrupt */
-    I2C_Enable_IRQ(hi2c, I2C_XFER_CPLT_IT);
-  }
-  /* else prepare a new DMA transfer and enable TCReload interrupt */
-  else
-  {
-    /* Update Buffer pointer */
-    hi2c->pBuffPtr += hi2c->XferSize;
-
-    /* Set the XferSize to transfer */
-    if (hi2c->XferCount > MAX_NBYTE_SIZE)
-    {
-      hi2c->XferSize = MAX_NBYTE_SIZE;
-    }
-    else
-    {
-      hi2c->XferSize = hi2c->XferCount;
-    }
-
-    /* Enable the DMA stream or channel depends on Instance */
-    if (HAL_DMA_Start_IT(hi2c->hdmatx, (uint32_t)hi2c->pBuffPtr, (uint32_t)&hi2c->Instance->TXDR,
-                         hi2c->XferSize) != HAL_OK)
-    {
-      /* Call the corresponding callback to inform upper layer of End of Transfer */
-      I2C_ITError(hi2c, HAL_I2C_ERROR_DMA);
-    }
-    else
-    {
-      /* Enable TC interrupts */
-      I2C_Enable_IRQ(hi2c, I2C_XFER_RELOAD_IT);
-    }
-  }
+  /* The DMA transfer covers the whole buffer: all the NBYTES reloads are done, enable STOP interrupt */
+  I2C_Enable_IRQ(hi2c, I2C_XFER_CPLT_IT);
 }
 
 /**
@@ -6596,41 +6587,8 @@ static void I2C_DMAMasterReceiveCplt(DMA_HandleTypeDef *hdma)
   /* Disable DMA Request */
   hi2c->Instance->CR1 &= ~I2C_CR1_RXDMAEN;
 
-  /* If last transfer, enable STOP interrupt */
-  if (hi2c->XferCount == 0U)
-  {
-    /* Enable STOP interrupt */
-    I2C_Enable_IRQ(hi2c, I2C_XFER_CPLT_IT);
-  }
-  /* else prepare a new DMA transfer and enable TCReload interrupt */
-  else
-  {
-    /* Update Buffer pointer */
-    hi2c->pBuffPtr += hi2c->XferSize;
-
-    /* Set the XferSize to transfer */
-    if (hi2c->XferCount > MAX_NBYTE_SIZE)
-    {
-      hi2c->XferSize = MAX_NBYTE_SIZE;
-    }
-    else
-    {
-      hi2c->XferSize = hi2c->XferCount;
-    }
-
-    /* Enable the DMA stream or channel depends on Instance */
-    if (HAL_DMA_Start_IT(hi2c->hdmarx, (uint32_t)&hi2c->Instance->RXDR, (uint32_t)hi2c->pBuffPtr,
-                         hi2c->XferSize) != HAL_OK)
-    {
-      /* Call the corresponding callback to inform upper layer of End of Transfer */
-      I2C_ITError(hi2c, HAL_I2C_ERROR_DMA);
-    }
-    else
-    {
-      /* Enable TC interrupts */
-      I2C_Enable_IRQ(hi2c, I2C_XFER_RELOAD_IT);
-    }
-  }
+  /* The DMA transfer covers the whole buffer: all the NBYTES reloads are done, enable STOP interrupt */
+  I2C_Enable_IRQ(hi2c, I2C_XFER_CPLT_IT);
 }
 
 /**
@@ -6739,6 +6697,9 @@ static HAL_StatusTypeDef I2C_WaitOnFlagUntilTimeout(I2C_HandleTypeDef *hi2c, uin
 {
   while (__HAL_I2C_GET_FLAG(hi2c, Flag) == Status)
   {
+    /* Let the application yield or sleep while waiting */
+    HAL_WaitHook(HAL_WAIT_I2C, hi2c);
+
     /* Check for the Timeout */
     if (Timeout != HAL_MAX_DELAY)
     {
@@ -6773,6 +6734,9 @@ static HAL_StatusTypeDef I2C_WaitOnTXISFlagUntilTimeout(I2C_HandleTypeDef *hi2c,
 {
   while (__HAL_I2C_GET_FLAG(hi2c, I2C_FLAG_TXIS) == RESET)
   {
+    /* Let the application yield or sleep while waiting */
+    HAL_WaitHook(HAL_WAIT_I2C, hi2c);
+
     /* Check if an error is detected */
     if (I2C_IsErrorOccurred(hi2c, Timeout, Tickstart) != HAL_OK)
     {
@@ -6814,6 +6778,9 @@ static HAL_StatusTypeDef I2C_WaitOnSTOPFlagUntilTimeout(I2C_HandleTypeDef *hi2c,
 {
   while (__HAL_I2C_GET_FLAG(hi2c, I2C_FLAG_STOPF) == RESET)
   {
+    /* Let the application yield or sleep while waiting */
+    HAL_WaitHook(HAL_WAIT_I2C, hi2c);
+
     /* Check if an error is detected */
     if (I2C_IsErrorOccurred(hi2c, Timeout, Tickstart) != HAL_OK)
     {
@@ -6852,6 +6819,9 @@ static HAL_StatusTypeDef I2C_WaitOnRXNEFlagUntilTimeout(I2C_HandleTypeDef *hi2c,
 {
   while (__HAL_I2C_GET_FLAG(hi2c, I2C_FLAG_RXNE) == RESET)
   {
+    /* Let the application yield or sleep while waiting */
+    HAL_WaitHook(HAL_WAIT_I2C, hi2c);
+
     /* Check if an error is detected */
     if (I2C_IsErrorOccurred(hi2c, Timeout, Tickstart) != HAL_OK)
     {
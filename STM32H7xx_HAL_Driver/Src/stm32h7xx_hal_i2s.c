@@ -98,6 +98,32 @@
      (+) Pause the DMA Transfer using HAL_I2S_DMAPause()
      (+) Resume the DMA Transfer using HAL_I2S_DMAResume()
      (+) Stop the DMA Transfer using HAL_I2S_DMAStop()
+     (+) Receive continuously in two buffers (DMA double buffer mode) using
+         HAL_I2S_ReceiveDoubleBuffer_DMA()
+     (+) At reception end of each buffer HAL_I2S_RxM0CpltCallback or HAL_I2S_RxM1CpltCallback
+         is executed and user can process the filled buffer, or replace the idle buffer
+         using HAL_DMAEx_ChangeMemory(); the reception is stopped using HAL_I2S_DMAStop()
+
+   *** Period stream IO operation ***
+   ==================================
+   [..]
+     (+) Fill an I2S_StreamTypeDef with two rings of NbPeriods periods of PeriodSize
+         data each, configure both DMA in DMA_CIRCULAR mode and prefill the
+         first two transmit periods.
+     (+) Start the full-duplex stream using HAL_I2SEx_StreamStart(). Each DMA runs
+         in double buffer mode over two periods: the idle memory address is moved
+         to the next period of the ring as soon as a period ends, so the latency
+         is one period and not half of the ring.
+     (+) At the end of each received period HAL_I2SEx_StreamPeriodCallback() is
+         executed with the index of that period. The application reads this receive
+         period and writes the transmit period (Period + 2) % NbPeriods.
+     (+) HAL_I2SEx_StreamGetPosition() returns the number of data received since
+         the start, read from the DMA counter.
+     (+) HAL_I2SEx_StreamTrimClock() compares this position with the one of a
+         reference clock and corrects the fractional part of the PLL feeding
+         the I2S kernel clock (PLL2 or PLL3), so that both clocks stay locked
+         without resampling.
+     (+) Stop the stream using HAL_I2SEx_StreamStop()
 
    *** I2S HAL driver macros list ***
    ===================================
@@ -129,6 +155,8 @@
             (+) TxHalfCpltCallback    : I2S Tx Half Completed callback
             (+) RxHalfCpltCallback    : I2S Rx Half Completed callback
             (+) TxRxHalfCpltCallback  : I2S TxRx Half Completed callback
+            (+) RxM0CpltCallback      : I2S Rx Memory 0 Completed callback
+            (+) RxM1CpltCallback      : I2S Rx Memory 1 Completed callback
             (+) ErrorCallback         : I2S Error callback
             (+) MspInitCallback       : I2S Msp Init callback
             (+) MspDeInitCallback     : I2S Msp DeInit callback
@@ -147,6 +175,8 @@
             (+) TxHalfCpltCallback    : I2S Tx Half Completed callback
             (+) RxHalfCpltCallback    : I2S Rx Half Completed callback
             (+) TxRxHalfCpltCallback  : I2S TxRx Half Completed callback
+            (+) RxM0CpltCallback      : I2S Rx Memory 0 Completed callback
+            (+) RxM1CpltCallback      : I2S Rx Memory 1 Completed callback
             (+) ErrorCallback         : I2S Error callback
             (+) MspInitCallback       : I2S Msp Init callback
             (+) MspDeInitCallback     : I2S Msp DeInit callback
@@ -210,9 +240,15 @@ static void               I2S_DMATxCplt(DMA_HandleTypeDef *hdma);
 static void               I2S_DMATxHalfCplt(DMA_HandleTypeDef *hdma);
 static void               I2S_DMARxCplt(DMA_HandleTypeDef *hdma);
 static void               I2S_DMARxHalfCplt(DMA_HandleTypeDef *hdma);
+static void               I2S_DMARxM0Cplt(DMA_HandleTypeDef *hdma);
+static void               I2S_DMARxM1Cplt(DMA_HandleTypeDef *hdma);
 static void               I2SEx_DMATxRxCplt(DMA_HandleTypeDef *hdma);
 static void               I2SEx_DMATxRxHalfCplt(DMA_HandleTypeDef *hdma);
 static void               I2S_DMAError(DMA_HandleTypeDef *hdma);
+static void               I2SEx_StreamTxM0Cplt(DMA_HandleTypeDef *hdma);
+static void               I2SEx_StreamTxM1Cplt(DMA_HandleTypeDef *hdma);
+static void               I2SEx_StreamRxM0Cplt(DMA_HandleTypeDef *hdma);
+static void               I2SEx_StreamRxM1Cplt(DMA_HandleTypeDef *hdma);
 static void               I2S_Transmit_16Bit_IT(I2S_HandleTypeDef *hi2s);
 static void               I2S_Transmit_32Bit_IT(I2S_HandleTypeDef *hi2s);
 static void               I2S_Receive_16Bit_IT(I2S_HandleTypeDef *hi2s);
@@ -305,6 +341,8 @@ HAL_StatusTypeDef HAL_I2S_Init(I2S_HandleTypeDef *hi2s)
     hi2s->TxHalfCpltCallback   = HAL_I2S_TxHalfCpltCallback;      /* Legacy weak TxHalfCpltCallback   */
     hi2s->RxHalfCpltCallback   = HAL_I2S_RxHalfCpltCallback;      /* Legacy weak RxHalfCpltCallback   */
     hi2s->TxRxHalfCpltCallback = HAL_I2SEx_TxRxHalfCpltCallback;  /* Legacy weak TxRxHalfCpltCallback */
+    hi2s->RxM0CpltCallback     = HAL_I2S_RxM0CpltCallback;        /* Legacy weak RxM0CpltCallback     */
+    hi2s->RxM1CpltCallback     = HAL_I2S_RxM1CpltCallback;        /* Legacy weak RxM1CpltCallback     */
     hi2s->ErrorCallback        = HAL_I2S_ErrorCallback;           /* Legacy weak ErrorCallback        */
 
     if (hi2s->MspInitCallback == NULL)
@@ -453,6 +491,7 @@ HAL_StatusTypeDef HAL_I2S_Init(I2S_HandleTypeDef *hi2s)
     MODIFY_REG(hi2s->Instance->CFG2, SPI_CFG2_AFCNTR, (hi2s->Init.MasterKeepIOState));
   }
 
+  hi2s->pStream   = NULL;
   hi2s->ErrorCode = HAL_I2S_ERROR_NONE;
   hi2s->State     = HAL_I2S_STATE_READY;
 
@@ -589,6 +628,14 @@ HAL_StatusTypeDef HAL_I2S_RegisterCallback(I2S_HandleTypeDef *hi2s, HAL_I2S_Call
         hi2s->TxRxHalfCpltCallback = pCallback;
         break;
 
+      case HAL_I2S_RX_M0_COMPLETE_CB_ID :
+        hi2s->RxM0CpltCallback = pCallback;
+        break;
+
+      case HAL_I2S_RX_M1_COMPLETE_CB_ID :
+        hi2s->RxM1CpltCallback = pCallback;
+        break;
+
       case HAL_I2S_ERROR_CB_ID :
         hi2s->ErrorCallback = pCallback;
         break;
@@ -688,6 +735,14 @@ HAL_StatusTypeDef HAL_I2S_UnRegisterCallback(I2S_HandleTypeDef *hi2s, HAL_I2S_Ca
         hi2s->TxRxHalfCpltCallback = HAL_I2SEx_TxRxHalfCpltCallback;  /* Legacy weak TxRxHalfCpltCallback */
         break;
 
+      case HAL_I2S_RX_M0_COMPLETE_CB_ID :
+        hi2s->RxM0CpltCallback = HAL_I2S_RxM0CpltCallback;            /* Legacy weak RxM0CpltCallback     */
+        break;
+
+      case HAL_I2S_RX_M1_COMPLETE_CB_ID :
+        hi2s->RxM1CpltCallback = HAL_I2S_RxM1CpltCallback;            /* Legacy weak RxM1CpltCallback     */
+        break;
+
       case HAL_I2S_ERROR_CB_ID :
         hi2s->ErrorCallback = HAL_I2S_ErrorCallback;                  /* Legacy weak ErrorCallback        */
         break;
@@ -783,11 +838,13 @@ HAL_StatusTypeDef HAL_I2S_UnRegisterCallback(I2S_HandleTypeDef *hi2s, HAL_I2S_Ca
         (++) HAL_I2S_Transmit_DMA()
         (++) HAL_I2S_Receive_DMA()
         (++) HAL_I2SEx_TransmitReceive_DMA()
+        (++) HAL_I2SEx_StreamStart()
 
     (#) A set of Transfer Complete Callbacks are provided in non Blocking mode:
         (++) HAL_I2S_TxCpltCallback()
         (++) HAL_I2S_RxCpltCallback()
         (++) HAL_I2SEx_TxRxCpltCallback()
+        (++) HAL_I2SEx_StreamPeriodCallback()
         (++) HAL_I2S_ErrorCallback()
 
 @endverbatim
@@ -1575,6 +1632,91 @@ HAL_StatusTypeDef HAL_I2S_Receive_DMA(I2S_HandleTypeDef *hi2s, uint16_t *pData,
   return errorcode;
 }
 
+/**
+  * @brief  Receive data continuously in non-blocking mode with DMA double buffer mode
+  * @param  hi2s pointer to a I2S_HandleTypeDef structure that contains
+  *         the configuration information for I2S module
+  * @param  pData0 a 16-bit pointer to the first data buffer (DMA memory 0).
+  * @param  pData1 a 16-bit pointer to the second data buffer (DMA memory 1).
+  * @param  Size number of data sample to be received in each buffer.
+  * @note   Size has the same meaning as for HAL_I2S_Receive_DMA().
+  * @note   The reception alternates between the two buffers until HAL_I2S_DMAStop()
+  *         is called. HAL_I2S_RxM0CpltCallback() and HAL_I2S_RxM1CpltCallback() are
+  *         executed each time the corresponding buffer has been filled.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_I2S_ReceiveDoubleBuffer_DMA(I2S_HandleTypeDef *hi2s, uint16_t *pData0, uint16_t *pData1,
+                                                  uint16_t Size)
+{
+  HAL_StatusTypeDef errorcode = HAL_OK;
+
+  if ((pData0 == NULL) || (pData1 == NULL) || (Size == 0UL))
+  {
+    return HAL_ERROR;
+  }
+
+  if (hi2s->State != HAL_I2S_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  /* Process Locked */
+  __HAL_LOCK(hi2s);
+
+  /* Set state and reset error code */
+  hi2s->State       = HAL_I2S_STATE_BUSY_RX;
+  hi2s->ErrorCode   = HAL_I2S_ERROR_NONE;
+  hi2s->pRxBuffPtr  = pData0;
+  hi2s->RxXferSize  = Size;
+  hi2s->RxXferCount = Size;
+
+  /* Init field not used in handle to zero */
+  hi2s->pTxBuffPtr  = NULL;
+  hi2s->TxXferSize  = (uint16_t)0UL;
+  hi2s->TxXferCount = (uint16_t)0UL;
+
+  /* One transfer complete callback per memory, no half transfer interrupt */
+  hi2s->hdmarx->XferHalfCpltCallback   = NULL;
+  hi2s->hdmarx->XferM1HalfCpltCallback = NULL;
+  hi2s->hdmarx->XferCpltCallback       = I2S_DMARxM0Cplt;
+  hi2s->hdmarx->XferM1CpltCallback     = I2S_DMARxM1Cplt;
+
+  /* Set the DMA error callback */
+  hi2s->hdmarx->XferErrorCallback = I2S_DMAError;
+
+  /* Enable the Rx DMA Stream/Channel in double buffer mode */
+  if (HAL_OK != HAL_DMAEx_MultiBufferStart_IT(hi2s->hdmarx, (uint32_t)&hi2s->Instance->RXDR, (uint32_t)pData0,
+                                              (uint32_t)pData1, hi2s->RxXferCount))
+  {
+    /* Update I2S error code */
+    SET_BIT(hi2s->ErrorCode, HAL_I2S_ERROR_DMA);
+    hi2s->State = HAL_I2S_STATE_READY;
+    errorcode = HAL_ERROR;
+    __HAL_UNLOCK(hi2s);
+    return errorcode;
+  }
+
+  /* Check if the I2S Rx request is already enabled */
+  if (HAL_IS_BIT_CLR(hi2s->Instance->CFG1, SPI_CFG1_RXDMAEN))
+  {
+    /* Enable Rx DMA Request */
+    SET_BIT(hi2s->Instance->CFG1, SPI_CFG1_RXDMAEN);
+  }
+
+  /* Check if the I2S is already enabled */
+  if (HAL_IS_BIT_CLR(hi2s->Instance->CR1, SPI_CR1_SPE))
+  {
+    /* Enable I2S peripheral */
+    __HAL_I2S_ENABLE(hi2s);
+  }
+
+  /* Start the transfer */
+  SET_BIT(hi2s->Instance->CR1, SPI_CR1_CSTART);
+
+  __HAL_UNLOCK(hi2s);
+  return errorcode;
+}
+
 /**
   * @brief  Full-Duplex Transmit/Receive data in non-blocking mode using DMA
   * @param  hi2s pointer to a I2S_HandleTypeDef structure that contains
@@ -1840,6 +1982,293 @@ HAL_StatusTypeDef HAL_I2S_DMAStop(I2S_HandleTypeDef *hi2s)
   return errorcode;
 }
 
+/**
+  * @brief  Start a full-duplex period stream.
+  * @param  hi2s pointer to a I2S_HandleTypeDef structure that contains
+  *         the configuration information for I2S module
+  * @param  pStream pointer to the stream structure, its rings and configuration
+  *         fields filled. It must remain valid until HAL_I2SEx_StreamStop().
+  * @note   Both DMA must be configured in DMA_CIRCULAR mode with the same memory
+  *         data alignment. The first two transmit periods are sent as they are.
+  * @note   Each DMA works in double buffer mode: one transfer complete interrupt
+  *         per period, whatever the number of periods of the rings.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_I2SEx_StreamStart(I2S_HandleTypeDef *hi2s, I2S_StreamTypeDef *pStream)
+{
+  uint32_t datasize;
+
+  if ((pStream == NULL) || (pStream->pTxRing == NULL) || (pStream->pRxRing == NULL) ||
+      (pStream->PeriodSize == 0UL) || (pStream->PeriodSize > 0xFFFFUL) || (pStream->NbPeriods < 2UL) ||
+      (hi2s->hdmatx == NULL) || (hi2s->hdmarx == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the parameters */
+  assert_param(IS_I2S_STREAM_CLOCK_TRIM(pStream->ClockTrim));
+  assert_param(IS_I2S_STREAM_SHIFT(pStream->KpShift));
+  assert_param(IS_I2S_STREAM_SHIFT(pStream->KiShift));
+
+  if ((hi2s->hdmatx->Init.Mode != DMA_CIRCULAR) || (hi2s->hdmarx->Init.Mode != DMA_CIRCULAR) ||
+      (hi2s->hdmatx->Init.MemDataAlignment != hi2s->hdmarx->Init.MemDataAlignment))
+  {
+    return HAL_ERROR;
+  }
+
+  if (hi2s->State != HAL_I2S_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  /* Process Locked */
+  __HAL_LOCK(hi2s);
+
+  if (hi2s->hdmatx->Init.MemDataAlignment == DMA_MDATAALIGN_WORD)
+  {
+    datasize = 4UL;
+  }
+  else if (hi2s->hdmatx->Init.MemDataAlignment == DMA_MDATAALIGN_HALFWORD)
+  {
+    datasize = 2UL;
+  }
+  else
+  {
+    datasize = 1UL;
+  }
+
+  pStream->PeriodBytes   = pStream->PeriodSize * datasize;
+  pStream->TxNext        = 2UL % pStream->NbPeriods;
+  pStream->RxNext        = 2UL % pStream->NbPeriods;
+  pStream->RxPeriod      = 0UL;
+  pStream->PeriodCount   = 0UL;
+  pStream->DriftOffset   = 0;
+  pStream->DriftIntegral = 0;
+  pStream->DriftStarted  = 0UL;
+  pStream->FracN         = pStream->FracNominal;
+
+  hi2s->pStream     = pStream;
+  hi2s->pTxBuffPtr  = pStream->pTxRing;
+  hi2s->pRxBuffPtr  = pStream->pRxRing;
+  hi2s->TxXferSize  = (uint16_t)pStream->PeriodSize;
+  hi2s->TxXferCount = (uint16_t)pStream->PeriodSize;
+  hi2s->RxXferSize  = (uint16_t)pStream->PeriodSize;
+  hi2s->RxXferCount = (uint16_t)pStream->PeriodSize;
+
+  hi2s->ErrorCode   = HAL_I2S_ERROR_NONE;
+  hi2s->State       = HAL_I2S_STATE_BUSY_TX_RX;
+
+  /* Reset the Tx/Rx DMA bits */
+  CLEAR_BIT(hi2s->Instance->CFG1, SPI_CFG1_TXDMAEN | SPI_CFG1_RXDMAEN);
+
+  /* One transfer complete callback per memory, no half transfer interrupt */
+  hi2s->hdmatx->XferHalfCpltCallback   = NULL;
+  hi2s->hdmatx->XferM1HalfCpltCallback = NULL;
+  hi2s->hdmatx->XferCpltCallback       = I2SEx_StreamTxM0Cplt;
+  hi2s->hdmatx->XferM1CpltCallback     = I2SEx_StreamTxM1Cplt;
+  hi2s->hdmatx->XferErrorCallback      = I2S_DMAError;
+
+  hi2s->hdmarx->XferHalfCpltCallback   = NULL;
+  hi2s->hdmarx->XferM1HalfCpltCallback = NULL;
+  hi2s->hdmarx->XferCpltCallback       = I2SEx_StreamRxM0Cplt;
+  hi2s->hdmarx->XferM1CpltCallback     = I2SEx_StreamRxM1Cplt;
+  hi2s->hdmarx->XferErrorCallback      = I2S_DMAError;
+
+  /* Enable the Tx DMA Stream/Channel on the first two periods */
+  if (HAL_OK != HAL_DMAEx_MultiBufferStart_IT(hi2s->hdmatx, (uint32_t)pStream->pTxRing,
+                                              (uint32_t)&hi2s->Instance->TXDR,
+                                              (uint32_t)pStream->pTxRing + pStream->PeriodBytes,
+                                              pStream->PeriodSize))
+  {
+    /* Update I2S error code */
+    SET_BIT(hi2s->ErrorCode, HAL_I2S_ERROR_DMA);
+    hi2s->pStream = NULL;
+    hi2s->State = HAL_I2S_STATE_READY;
+
+    __HAL_UNLOCK(hi2s);
+    return HAL_ERROR;
+  }
+
+  /* Enable Tx DMA Request */
+  SET_BIT(hi2s->Instance->CFG1, SPI_CFG1_TXDMAEN);
+
+  /* Enable the Rx DMA Stream/Channel on the first two periods */
+  if (HAL_OK != HAL_DMAEx_MultiBufferStart_IT(hi2s->hdmarx, (uint32_t)&hi2s->Instance->RXDR,
+                                              (uint32_t)pStream->pRxRing,
+                                              (uint32_t)pStream->pRxRing + pStream->PeriodBytes,
+                                              pStream->PeriodSize))
+  {
+    /* Update I2S error code */
+    SET_BIT(hi2s->ErrorCode, HAL_I2S_ERROR_DMA);
+    CLEAR_BIT(hi2s->Instance->CFG1, SPI_CFG1_TXDMAEN);
+    (void)HAL_DMA_Abort(hi2s->hdmatx);
+    hi2s->pStream = NULL;
+    hi2s->State = HAL_I2S_STATE_READY;
+
+    __HAL_UNLOCK(hi2s);
+    return HAL_ERROR;
+  }
+
+  /* Enable Rx DMA Request */
+  SET_BIT(hi2s->Instance->CFG1, SPI_CFG1_RXDMAEN);
+
+  /* Check if the I2S is already enabled */
+  if (HAL_IS_BIT_CLR(hi2s->Instance->CR1, SPI_CR1_SPE))
+  {
+    /* Enable I2S peripheral */
+    __HAL_I2S_ENABLE(hi2s);
+  }
+
+  /* Start the transfer */
+  SET_BIT(hi2s->Instance->CR1, SPI_CR1_CSTART);
+
+  __HAL_UNLOCK(hi2s);
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop a period stream started with HAL_I2SEx_StreamStart().
+  * @param  hi2s pointer to a I2S_HandleTypeDef structure that contains
+  *         the configuration information for I2S module
+  * @note   As HAL_I2S_DMAStop(), this function can be called from
+  *         HAL_I2SEx_StreamPeriodCallback().
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_I2SEx_StreamStop(I2S_HandleTypeDef *hi2s)
+{
+  HAL_StatusTypeDef errorcode;
+
+  errorcode = HAL_I2S_DMAStop(hi2s);
+  hi2s->pStream = NULL;
+
+  return errorcode;
+}
+
+/**
+  * @brief  Return the position of the period stream.
+  * @param  hi2s pointer to a I2S_HandleTypeDef structure that contains
+  *         the configuration information for I2S module
+  * @note   The position lags by one period when it is read while the end of
+  *         a period is pending and the DMA interrupt masked.
+  * @retval Number of data received since the start of the stream, 0 when not streaming
+  */
+uint32_t HAL_I2SEx_StreamGetPosition(const I2S_HandleTypeDef *hi2s)
+{
+  const I2S_StreamTypeDef *pstream = hi2s->pStream;
+  uint32_t count;
+  uint32_t remaining;
+
+  if (pstream == NULL)
+  {
+    return 0UL;
+  }
+
+  /* Read the DMA counter between two identical period counts */
+  do
+  {
+    count     = pstream->PeriodCount;
+    remaining = __HAL_DMA_GET_COUNTER(hi2s->hdmarx);
+  } while (count != pstream->PeriodCount);
+
+  return (count * pstream->PeriodSize) + (pstream->PeriodSize - remaining);
+}
+
+/**
+  * @brief  Correct the I2S kernel clock to follow a reference clock.
+  * @param  hi2s pointer to a I2S_HandleTypeDef structure that contains
+  *         the configuration information for I2S module
+  * @param  RefPosition number of data the reference clock has produced (or
+  *         consumed) at the time of the call, for instance computed from a
+  *         timer capture.
+  * @note   The first call only records the offset between both positions. The
+  *         following ones apply a proportional-integral correction to the FRACN
+  *         field of the PLL selected by the ClockTrim field: the I2S slows down
+  *         when it is ahead of the reference.
+  * @note   The PLL must run with its fractional part enabled and FracNominal
+  *         as its initial FRACN value.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_I2SEx_StreamTrimClock(I2S_HandleTypeDef *hi2s, uint32_t RefPosition)
+{
+  I2S_StreamTypeDef *pstream = hi2s->pStream;
+  int32_t drift;
+  int32_t limit;
+  int32_t fracn;
+
+  if ((pstream == NULL) || (pstream->ClockTrim == I2S_STREAM_TRIM_NONE))
+  {
+    return HAL_ERROR;
+  }
+
+  drift = (int32_t)(HAL_I2SEx_StreamGetPosition(hi2s) - RefPosition);
+
+  if (pstream->DriftStarted == 0UL)
+  {
+    pstream->DriftOffset  = drift;
+    pstream->DriftStarted = 1UL;
+    return HAL_OK;
+  }
+
+  drift -= pstream->DriftOffset;
+
+  /* Accumulate the drift, bounded to the correction range */
+  limit = (int32_t)(pstream->FracRange << pstream->KiShift);
+  pstream->DriftIntegral += drift;
+  if (pstream->DriftIntegral > limit)
+  {
+    pstream->DriftIntegral = limit;
+  }
+  else if (pstream->DriftIntegral < -limit)
+  {
+    pstream->DriftIntegral = -limit;
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+
+  fracn = (int32_t)pstream->FracNominal - (drift / (int32_t)(1UL << pstream->KpShift))
+          - (pstream->DriftIntegral / (int32_t)(1UL << pstream->KiShift));
+
+  if (fracn > ((int32_t)pstream->FracNominal + (int32_t)pstream->FracRange))
+  {
+    fracn = (int32_t)pstream->FracNominal + (int32_t)pstream->FracRange;
+  }
+  if (fracn < ((int32_t)pstream->FracNominal - (int32_t)pstream->FracRange))
+  {
+    fracn = (int32_t)pstream->FracNominal - (int32_t)pstream->FracRange;
+  }
+  if (fracn < 0)
+  {
+    fracn = 0;
+  }
+  if (fracn > 8191)
+  {
+    fracn = 8191;
+  }
+
+  if ((uint32_t)fracn != pstream->FracN)
+  {
+    pstream->FracN = (uint32_t)fracn;
+
+    /* The new FRACN value is latched when the fractional part is enabled again */
+    if (pstream->ClockTrim == I2S_STREAM_TRIM_PLL2)
+    {
+      __HAL_RCC_PLL2FRACN_DISABLE();
+      __HAL_RCC_PLL2FRACN_CONFIG(pstream->FracN);
+      __HAL_RCC_PLL2FRACN_ENABLE();
+    }
+    else
+    {
+      __HAL_RCC_PLL3FRACN_DISABLE();
+      __HAL_RCC_PLL3FRACN_CONFIG(pstream->FracN);
+      __HAL_RCC_PLL3FRACN_ENABLE();
+    }
+  }
+
+  return HAL_OK;
+}
+
 /**
   * @brief  This function handles I2S interrupt request.
   * @param  hi2s pointer to a I2S_HandleTypeDef structure that contains
@@ -2045,6 +2474,38 @@ __weak void HAL_I2S_RxCpltCallback(I2S_HandleTypeDef *hi2s)
    */
 }
 
+/**
+  * @brief  Rx memory 0 buffer completed callback (double buffer reception)
+  * @param  hi2s pointer to a I2S_HandleTypeDef structure that contains
+  *         the configuration information for I2S module
+  * @retval None
+  */
+__weak void HAL_I2S_RxM0CpltCallback(I2S_HandleTypeDef *hi2s)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hi2s);
+
+  /* NOTE : This function Should not be modified, when the callback is needed,
+            the HAL_I2S_RxM0CpltCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Rx memory 1 buffer completed callback (double buffer reception)
+  * @param  hi2s pointer to a I2S_HandleTypeDef structure that contains
+  *         the configuration information for I2S module
+  * @retval None
+  */
+__weak void HAL_I2S_RxM1CpltCallback(I2S_HandleTypeDef *hi2s)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hi2s);
+
+  /* NOTE : This function Should not be modified, when the callback is needed,
+            the HAL_I2S_RxM1CpltCallback could be implemented in the user file
+   */
+}
+
 /**
   * @brief  Rx Transfer half completed callbacks
   * @param  hi2s pointer to a I2S_HandleTypeDef structure that contains
@@ -2093,6 +2554,25 @@ __weak void HAL_I2S_ErrorCallback(I2S_HandleTypeDef *hi2s)
    */
 }
 
+/**
+  * @brief  Period stream callback, at the end of each received period.
+  * @param  hi2s pointer to a I2S_HandleTypeDef structure that contains
+  *         the configuration information for I2S module
+  * @param  Period index of the receive period just filled. The transmit period
+  *         to fill is (Period + 2) % NbPeriods, before the end of the next period.
+  * @retval None
+  */
+__weak void HAL_I2SEx_StreamPeriodCallback(I2S_HandleTypeDef *hi2s, uint32_t Period)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hi2s);
+  UNUSED(Period);
+
+  /* NOTE : This function Should not be modified, when the callback is needed,
+            the HAL_I2SEx_StreamPeriodCallback could be implemented in the user file
+   */
+}
+
 /**
   * @}
   */
@@ -2237,6 +2717,42 @@ static void I2S_DMARxHalfCplt(DMA_HandleTypeDef *hdma)
 #endif /* USE_HAL_I2S_REGISTER_CALLBACKS */
 }
 
+/**
+  * @brief  DMA I2S memory 0 receive complete callback (double buffer mode)
+  * @param  hdma pointer to a DMA_HandleTypeDef structure that contains
+  *         the configuration information for the specified DMA module.
+  * @retval None
+  */
+static void I2S_DMARxM0Cplt(DMA_HandleTypeDef *hdma)
+{
+  /* Derogation MISRAC2012-Rule-11.5 */
+  I2S_HandleTypeDef *hi2s = (I2S_HandleTypeDef *)((DMA_HandleTypeDef *)hdma)->Parent;
+
+#if (USE_HAL_I2S_REGISTER_CALLBACKS == 1UL)
+  hi2s->RxM0CpltCallback(hi2s);
+#else
+  HAL_I2S_RxM0CpltCallback(hi2s);
+#endif /* USE_HAL_I2S_REGISTER_CALLBACKS */
+}
+
+/**
+  * @brief  DMA I2S memory 1 receive complete callback (double buffer mode)
+  * @param  hdma pointer to a DMA_HandleTypeDef structure that contains
+  *         the configuration information for the specified DMA module.
+  * @retval None
+  */
+static void I2S_DMARxM1Cplt(DMA_HandleTypeDef *hdma)
+{
+  /* Derogation MISRAC2012-Rule-11.5 */
+  I2S_HandleTypeDef *hi2s = (I2S_HandleTypeDef *)((DMA_HandleTypeDef *)hdma)->Parent;
+
+#if (USE_HAL_I2S_REGISTER_CALLBACKS == 1UL)
+  hi2s->RxM1CpltCallback(hi2s);
+#else
+  HAL_I2S_RxM1CpltCallback(hi2s);
+#endif /* USE_HAL_I2S_REGISTER_CALLBACKS */
+}
+
 /**
   * @brief  DMA I2S transmit receive process complete callback
   * @param  hdma pointer to a DMA_HandleTypeDef structure that contains
@@ -2288,6 +2804,80 @@ static void I2SEx_DMATxRxHalfCplt(DMA_HandleTypeDef *hdma)
 #endif /* USE_HAL_I2S_REGISTER_CALLBACKS */
 }
 
+/**
+  * @brief  DMA I2S period stream transmit memory 0 complete callback
+  * @param  hdma pointer to a DMA_HandleTypeDef structure that contains
+  *               the configuration information for the specified DMA module.
+  * @retval None
+  */
+static void I2SEx_StreamTxM0Cplt(DMA_HandleTypeDef *hdma)
+{
+  I2S_HandleTypeDef *hi2s = (I2S_HandleTypeDef *)((DMA_HandleTypeDef *)hdma)->Parent;
+  I2S_StreamTypeDef *pstream = hi2s->pStream;
+
+  /* Memory 0 is idle: move it to the next period of the ring */
+  (void)HAL_DMAEx_ChangeMemory(hdma, (uint32_t)pstream->pTxRing + (pstream->TxNext * pstream->PeriodBytes), MEMORY0);
+  pstream->TxNext = (pstream->TxNext + 1UL) % pstream->NbPeriods;
+}
+
+/**
+  * @brief  DMA I2S period stream transmit memory 1 complete callback
+  * @param  hdma pointer to a DMA_HandleTypeDef structure that contains
+  *               the configuration information for the specified DMA module.
+  * @retval None
+  */
+static void I2SEx_StreamTxM1Cplt(DMA_HandleTypeDef *hdma)
+{
+  I2S_HandleTypeDef *hi2s = (I2S_HandleTypeDef *)((DMA_HandleTypeDef *)hdma)->Parent;
+  I2S_StreamTypeDef *pstream = hi2s->pStream;
+
+  /* Memory 1 is idle: move it to the next period of the ring */
+  (void)HAL_DMAEx_ChangeMemory(hdma, (uint32_t)pstream->pTxRing + (pstream->TxNext * pstream->PeriodBytes), MEMORY1);
+  pstream->TxNext = (pstream->TxNext + 1UL) % pstream->NbPeriods;
+}
+
+/**
+  * @brief  DMA I2S period stream receive memory 0 complete callback
+  * @param  hdma pointer to a DMA_HandleTypeDef structure that contains
+  *               the configuration information for the specified DMA module.
+  * @retval None
+  */
+static void I2SEx_StreamRxM0Cplt(DMA_HandleTypeDef *hdma)
+{
+  I2S_HandleTypeDef *hi2s = (I2S_HandleTypeDef *)((DMA_HandleTypeDef *)hdma)->Parent;
+  I2S_StreamTypeDef *pstream = hi2s->pStream;
+  uint32_t period = pstream->RxPeriod;
+
+  /* Memory 0 is idle: move it to the next period of the ring */
+  (void)HAL_DMAEx_ChangeMemory(hdma, (uint32_t)pstream->pRxRing + (pstream->RxNext * pstream->PeriodBytes), MEMORY0);
+  pstream->RxNext   = (pstream->RxNext + 1UL) % pstream->NbPeriods;
+  pstream->RxPeriod = (period + 1UL) % pstream->NbPeriods;
+  pstream->PeriodCount++;
+
+  HAL_I2SEx_StreamPeriodCallback(hi2s, period);
+}
+
+/**
+  * @brief  DMA I2S period stream receive memory 1 complete callback
+  * @param  hdma pointer to a DMA_HandleTypeDef structure that contains
+  *               the configuration information for the specified DMA module.
+  * @retval None
+  */
+static void I2SEx_StreamRxM1Cplt(DMA_HandleTypeDef *hdma)
+{
+  I2S_HandleTypeDef *hi2s = (I2S_HandleTypeDef *)((DMA_HandleTypeDef *)hdma)->Parent;
+  I2S_StreamTypeDef *pstream = hi2s->pStream;
+  uint32_t period = pstream->RxPeriod;
+
+  /* Memory 1 is idle: move it to the next period of the ring */
+  (void)HAL_DMAEx_ChangeMemory(hdma, (uint32_t)pstream->pRxRing + (pstream->RxNext * pstream->PeriodBytes), MEMORY1);
+  pstream->RxNext   = (pstream->RxNext + 1UL) % pstream->NbPeriods;
+  pstream->RxPeriod = (period + 1UL) % pstream->NbPeriods;
+  pstream->PeriodCount++;
+
+  HAL_I2SEx_StreamPeriodCallback(hi2s, period);
+}
+
 /**
   * @brief  DMA I2S communication error callback
   * @param  hdma pointer to a DMA_HandleTypeDef structure that contains
@@ -0,0 +1,522 @@
+/**
+  ******************************************************************************
+  * @file    stm32h7xx_hal_ipc.c
+  * @author  MCD Application Team
+  * @brief   Inter-core message ring HAL module driver.
+             This file provides firmware functions to pass messages between the
+             Cortex-M7 and the Cortex-M4 of the dual-core devices through a
+             single-producer/single-consumer ring in the shared SRAM, with a
+             hardware semaphore notification as doorbell.
+              + Initialization and de-initialization functions
+              + Message send and receive functions
+              + Peripheral State and Error functions
+
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  @verbatim
+ ===============================================================================
+                        ##### How to use this driver #####
+ ===============================================================================
+  [..]
+    A ring carries messages in one direction, from the producer core to the
+    consumer core. Two rings are used for a bidirectional link. The producer only
+    writes the head index and the consumer only writes the tail index, so that no
+    lock is needed: the only synchronization is a memory barrier between the
+    message and the index update. After each message, the producer takes and
+    releases a hardware semaphore, whose release notification interrupts the
+    consumer core.
+
+    *** Shared memory ***
+    =====================
+    [..]
+     (#) Reserve IPC_RING_SIZE(SlotSize, NbSlots) bytes, aligned on 32 bytes, in an
+         SRAM reached by both cores, for instance the D2 SRAM3 or the D3 SRAM4, at
+         the same address in the link files of both cores.
+     (#) On the Cortex-M7, make this area non-cacheable and shareable in the MPU, by
+         calling HAL_IPC_ConfigSharedMemory() or with the application MPU setting.
+         The Cortex-M4 has no data cache, the call is optional on this core.
+
+    *** Initialization ***
+    ======================
+    [..]
+     (#) Enable the HSEM clock with __HAL_RCC_HSEM_CLK_ENABLE() on both cores.
+     (#) On each core, set the pRing field of an IPC_HandleTypeDef and fill the Init
+         structure with the same parameters, except Init.Role. Each ring uses its
+         own Init.DoorbellSemID, different from the semaphores used elsewhere.
+     (#) Call HAL_IPC_Init() on the producer core first: it clears the ring. Then
+         call HAL_IPC_Init() on the consumer core, which fails with HAL_IPC_ERROR_RING
+         as long as the producer has not initialized the ring, for instance while the
+         other core is still booting.
+     (#) On the consumer core, enable the HSEM interrupt (HSEM1_IRQn on the Cortex-M7,
+         HSEM2_IRQn on the Cortex-M4) and call HAL_HSEM_IRQHandler() from its handler.
+         Call HAL_IPC_IRQHandler() with the SemMask of HAL_HSEM_FreeCallback() for
+         each ring consumed by this core.
+
+    *** Messages ***
+    ================
+    [..]
+     (#) HAL_IPC_Send() copies a message into the next free slot then rings the
+         doorbell. It returns HAL_BUSY when all the slots are used.
+     (#) HAL_IPC_RxNotifyCallback() is called on the consumer core after each
+         doorbell. HAL_IPC_Receive() copies the oldest message and frees its slot,
+         it returns HAL_BUSY when the ring is empty. Several messages can be pending
+         for one notification, the ring must be read until it is empty.
+     (#) HAL_IPC_GetPending() gives the number of messages waiting in the ring, it
+         can be used for polling without the doorbell.
+
+  @endverbatim
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32h7xx_hal.h"
+
+#if defined(DUAL_CORE)
+
+/** @addtogroup STM32H7xx_HAL_Driver
+  * @{
+  */
+
+/** @defgroup IPC IPC
+  * @brief Inter-core message ring HAL module driver
+  * @{
+  */
+
+#if defined(HAL_HSEM_MODULE_ENABLED) && defined(HAL_IPC_MODULE_ENABLED)
+
+/**
+  @cond 0
+  */
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static uint8_t *IPC_GetSlot(const IPC_HandleTypeDef *hipc, uint32_t Index);
+/**
+  @endcond
+  */
+
+/* Exported functions --------------------------------------------------------*/
+
+/** @defgroup IPC_Exported_Functions IPC Exported Functions
+  * @{
+  */
+
+/** @defgroup IPC_Exported_Functions_Group1 Initialization/de-initialization functions
+  *  @brief    Initialization and Configuration functions
+  *
+@verbatim
+ ===============================================================================
+            ##### Initialization and Configuration functions #####
+ ===============================================================================
+    [..]
+    This subsection provides a set of functions allowing to :
+      (+) Initialize and de-initialize one side of a message ring.
+      (+) Configure the MPU attributes of the shared memory.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Initialize one side of an inter-core message ring.
+  * @note   On the producer core, the ring is cleared. On the consumer core, the
+  *         ring must have been initialized by the producer with the same parameters,
+  *         and the doorbell notification is activated.
+  * @param  hipc IPC handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_IPC_Init(IPC_HandleTypeDef *hipc)
+{
+  uint32_t semmask;
+
+  /* Check the IPC handle allocation */
+  if (hipc == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the parameters */
+  assert_param(IS_IPC_ROLE(hipc->Init.Role));
+  assert_param(IS_IPC_SLOT_SIZE(hipc->Init.SlotSize));
+  assert_param(IS_IPC_NB_SLOTS(hipc->Init.NbSlots));
+  assert_param(IS_HSEM_SEMID(hipc->Init.DoorbellSemID));
+
+  hipc->ErrorCode = HAL_IPC_ERROR_NONE;
+
+  if ((hipc->pRing == NULL) || (((uint32_t)hipc->pRing & 3U) != 0U) ||
+      (IS_IPC_SLOT_SIZE(hipc->Init.SlotSize) == 0U) || (IS_IPC_NB_SLOTS(hipc->Init.NbSlots) == 0U))
+  {
+    hipc->ErrorCode = HAL_IPC_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  hipc->pSlots = (uint8_t *)&hipc->pRing[1];
+  semmask = __HAL_HSEM_SEMID_TO_MASK(hipc->Init.DoorbellSemID);
+
+  if (hipc->Init.Role == IPC_ROLE_PRODUCER)
+  {
+    /* Invalidate the ring while it is cleared */
+    hipc->pRing->Magic    = 0U;
+    hipc->pRing->Head     = 0U;
+    hipc->pRing->Tail     = 0U;
+    hipc->pRing->SlotSize = hipc->Init.SlotSize;
+    hipc->pRing->NbSlots  = hipc->Init.NbSlots;
+
+    /* The indices are visible to the consumer before the ring is valid */
+    __DMB();
+    hipc->pRing->Magic    = IPC_RING_MAGIC;
+    __DSB();
+  }
+  else
+  {
+    if ((hipc->pRing->Magic != IPC_RING_MAGIC) || (hipc->pRing->SlotSize != hipc->Init.SlotSize) ||
+        (hipc->pRing->NbSlots != hipc->Init.NbSlots))
+    {
+      hipc->ErrorCode = HAL_IPC_ERROR_RING;
+      return HAL_ERROR;
+    }
+
+    /* Discard a doorbell rung before the initialization, then listen to the next ones */
+    __HAL_HSEM_CLEAR_FLAG(semmask);
+    HAL_HSEM_ActivateNotification(semmask);
+  }
+
+  hipc->State = HAL_IPC_STATE_READY;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  De-initialize one side of an inter-core message ring.
+  * @note   On the consumer core, the doorbell notification is deactivated.
+  *         The shared memory is left unchanged.
+  * @param  hipc IPC handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_IPC_DeInit(IPC_HandleTypeDef *hipc)
+{
+  /* Check the IPC handle allocation */
+  if (hipc == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  if ((hipc->State == HAL_IPC_STATE_READY) && (hipc->Init.Role == IPC_ROLE_CONSUMER))
+  {
+    HAL_HSEM_DeactivateNotification(__HAL_HSEM_SEMID_TO_MASK(hipc->Init.DoorbellSemID));
+  }
+
+  hipc->ErrorCode = HAL_IPC_ERROR_NONE;
+  hipc->State = HAL_IPC_STATE_RESET;
+
+  return HAL_OK;
+}
+
+#if (__MPU_PRESENT == 1)
+/**
+  * @brief  Configure an MPU region as shared, non-cacheable normal memory.
+  * @note   The MPU is enabled after the configuration, with its previous control
+  *         setting when it was already enabled, or with the default memory map as
+  *         background region otherwise.
+  * @param  BaseAddress Base address of the shared memory, aligned on its size
+  * @param  Size Size of the region.
+  *         This parameter can be a value of @ref CORTEX_MPU_Region_Size
+  * @param  Number Number of the MPU region.
+  *         This parameter can be a value of @ref CORTEX_MPU_Region_Number
+  * @retval None
+  */
+void HAL_IPC_ConfigSharedMemory(uint32_t BaseAddress, uint8_t Size, uint8_t Number)
+{
+  MPU_Region_InitTypeDef region;
+  uint32_t mpuctrl = MPU->CTRL;
+
+  HAL_MPU_Disable();
+
+  region.Enable           = MPU_REGION_ENABLE;
+  region.Number           = Number;
+  region.BaseAddress      = BaseAddress;
+  region.Size             = Size;
+  region.SubRegionDisable = 0x00U;
+  region.TypeExtField     = MPU_TEX_LEVEL1;
+  region.AccessPermission = MPU_REGION_FULL_ACCESS;
+  region.DisableExec      = MPU_INSTRUCTION_ACCESS_DISABLE;
+  region.IsShareable      = MPU_ACCESS_SHAREABLE;
+  region.IsCacheable      = MPU_ACCESS_NOT_CACHEABLE;
+  region.IsBufferable     = MPU_ACCESS_NOT_BUFFERABLE;
+  HAL_MPU_ConfigRegion(&region);
+
+  if ((mpuctrl & MPU_CTRL_ENABLE_Msk) != 0U)
+  {
+    HAL_MPU_Enable(mpuctrl & (MPU_CTRL_HFNMIENA_Msk | MPU_CTRL_PRIVDEFENA_Msk));
+  }
+  else
+  {
+    HAL_MPU_Enable(MPU_PRIVILEGED_DEFAULT);
+  }
+}
+#endif /* __MPU_PRESENT */
+
+/**
+  * @}
+  */
+
+/** @defgroup IPC_Exported_Functions_Group2 Message send and receive functions
+  *  @brief    Message send and receive functions
+  *
+@verbatim
+ ===============================================================================
+                ##### Message send and receive functions #####
+ ===============================================================================
+    [..]
+    This subsection provides a set of functions allowing to :
+      (+) Send a message and ring the doorbell of the consumer core.
+      (+) Receive the pending messages.
+      (+) Handle the doorbell notification.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Send a message to the consumer core.
+  * @note   This function is called on the producer core only, from a single context.
+  * @param  hipc IPC handle
+  * @param  pData Message
+  * @param  Size Message size (in bytes), up to Init.SlotSize
+  * @retval HAL status, HAL_BUSY when the ring is full
+  */
+HAL_StatusTypeDef HAL_IPC_Send(IPC_HandleTypeDef *hipc, const uint8_t *pData, uint32_t Size)
+{
+  uint32_t head;
+  uint32_t index;
+  uint8_t *pslot;
+
+  if ((hipc->State != HAL_IPC_STATE_READY) || (hipc->Init.Role != IPC_ROLE_PRODUCER) ||
+      ((pData == NULL) && (Size != 0U)))
+  {
+    return HAL_ERROR;
+  }
+
+  if (Size > hipc->Init.SlotSize)
+  {
+    hipc->ErrorCode |= HAL_IPC_ERROR_SIZE;
+    return HAL_ERROR;
+  }
+
+  head = hipc->pRing->Head;
+  if ((head - hipc->pRing->Tail) >= hipc->Init.NbSlots)
+  {
+    return HAL_BUSY;
+  }
+
+  /* Write the message length then the message into the free slot */
+  pslot = IPC_GetSlot(hipc, head);
+  *(uint32_t *)pslot = Size;
+  for (index = 0U; index < Size; index++)
+  {
+    pslot[4U + index] = pData[index];
+  }
+
+  /* The message is written before the consumer sees the new head */
+  __DMB();
+  hipc->pRing->Head = head + 1U;
+  __DSB();
+
+  /* Ring the doorbell: the release of the semaphore notifies the consumer core */
+  if (HAL_HSEM_FastTake(hipc->Init.DoorbellSemID) == HAL_OK)
+  {
+    HAL_HSEM_Release(hipc->Init.DoorbellSemID, 0U);
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Receive the oldest message from the producer core.
+  * @note   This function is called on the consumer core only, from a single context.
+  * @param  hipc IPC handle
+  * @param  pData Message buffer, of Init.SlotSize bytes
+  * @param  pSize Size of the received message (in bytes)
+  * @retval HAL status, HAL_BUSY when the ring is empty
+  */
+HAL_StatusTypeDef HAL_IPC_Receive(IPC_HandleTypeDef *hipc, uint8_t *pData, uint32_t *pSize)
+{
+  uint32_t tail;
+  uint32_t size;
+  uint32_t index;
+  const uint8_t *pslot;
+
+  if ((hipc->State != HAL_IPC_STATE_READY) || (hipc->Init.Role != IPC_ROLE_CONSUMER) ||
+      (pData == NULL) || (pSize == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  tail = hipc->pRing->Tail;
+  if (hipc->pRing->Head == tail)
+  {
+    return HAL_BUSY;
+  }
+
+  /* The head is read before the message */
+  __DMB();
+
+  pslot = IPC_GetSlot(hipc, tail);
+  size = *(const uint32_t *)pslot;
+  if (size > hipc->Init.SlotSize)
+  {
+    size = hipc->Init.SlotSize;
+  }
+  for (index = 0U; index < size; index++)
+  {
+    pData[index] = pslot[4U + index];
+  }
+  *pSize = size;
+
+  /* The message is read before the producer sees the slot free */
+  __DMB();
+  hipc->pRing->Tail = tail + 1U;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Return the number of messages waiting in the ring.
+  * @param  hipc IPC handle
+  * @retval Number of pending messages
+  */
+uint32_t HAL_IPC_GetPending(IPC_HandleTypeDef *hipc)
+{
+  if (hipc->State != HAL_IPC_STATE_READY)
+  {
+    return 0U;
+  }
+
+  return hipc->pRing->Head - hipc->pRing->Tail;
+}
+
+/**
+  * @brief  Handle the doorbell notification of a ring on the consumer core.
+  * @note   This function is called from HAL_HSEM_FreeCallback() with its SemMask.
+  *         The notification, disabled by HAL_HSEM_IRQHandler(), is activated again
+  *         before HAL_IPC_RxNotifyCallback() is called, so that a message sent while
+  *         the ring is read rings the doorbell again.
+  * @param  hipc IPC handle
+  * @param  SemMask Mask of released semaphores
+  * @retval None
+  */
+void HAL_IPC_IRQHandler(IPC_HandleTypeDef *hipc, uint32_t SemMask)
+{
+  uint32_t semmask = __HAL_HSEM_SEMID_TO_MASK(hipc->Init.DoorbellSemID);
+
+  if ((hipc->State == HAL_IPC_STATE_READY) && (hipc->Init.Role == IPC_ROLE_CONSUMER) &&
+      ((SemMask & semmask) != 0U))
+  {
+    HAL_HSEM_ActivateNotification(semmask);
+
+    HAL_IPC_RxNotifyCallback(hipc);
+  }
+}
+
+/**
+  * @brief  Doorbell notification callback, messages are pending in the ring.
+  * @param  hipc IPC handle
+  * @retval None
+  */
+__weak void HAL_IPC_RxNotifyCallback(IPC_HandleTypeDef *hipc)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hipc);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_IPC_RxNotifyCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @}
+  */
+
+/** @defgroup IPC_Exported_Functions_Group3 Peripheral State and Error functions
+  *  @brief   Peripheral State and Errors functions
+  *
+@verbatim
+ ===============================================================================
+            ##### Peripheral State and Errors functions #####
+ ===============================================================================
+    [..]
+    This subsection provides functions allowing to
+      (+) Check the IPC state.
+      (+) Get error code.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Return the IPC handle state.
+  * @param  hipc IPC handle
+  * @retval HAL state
+  */
+HAL_IPC_StateTypeDef HAL_IPC_GetState(IPC_HandleTypeDef *hipc)
+{
+  return hipc->State;
+}
+
+/**
+  * @brief  Return the IPC error code.
+  * @param  hipc IPC handle
+  * @retval IPC Error Code
+  */
+uint32_t HAL_IPC_GetError(IPC_HandleTypeDef *hipc)
+{
+  return hipc->ErrorCode;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  @cond 0
+  */
+/**
+  * @brief  Return the address of a message slot.
+  * @param  hipc IPC handle
+  * @param  Index Free-running message index
+  * @retval Slot address
+  */
+static uint8_t *IPC_GetSlot(const IPC_HandleTypeDef *hipc, uint32_t Index)
+{
+  return &hipc->pSlots[(Index & (hipc->Init.NbSlots - 1U)) * IPC_SLOT_STRIDE(hipc->Init.SlotSize)];
+}
+/**
+  @endcond
+  */
+
+#endif /* HAL_HSEM_MODULE_ENABLED && HAL_IPC_MODULE_ENABLED */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#endif /* DUAL_CORE */
@@ -12,6 +12,7 @@
   *           + JPEG Input/Output Buffer configuration.
   *           + JPEG callback functions
   *           + JPEG Abort/Pause/Resume functions
+  *           + JPEG to framebuffer decoding pipeline (MDMA and DMA2D)
   *           + JPEG custom quantization tables setting functions
   *           + IRQ handler management
   *           + Peripheral State and Error functions
@@ -139,6 +140,35 @@
          Note that for decoding the quantization tables are automatically extracted from
          the JPEG header.
 
+     (#) Use function HAL_JPEG_PipelineDecode_DMA to decode a JPEG image from memory straight
+         into a framebuffer (for instance an LTDC layer), without any CPU processing per pixel:
+
+        (++) Declare a JPEG_PipelineTypeDef structure, set the Instance of its DMA2D handle
+             (hdma2d member), the MCU buffer and its size, and the framebuffer address, width,
+             height and pixel format. The DMA2D clock and interrupt are configured in
+             HAL_DMA2D_MspInit(), and the DMA2D interrupt handler calls HAL_DMA2D_IRQHandler()
+             with the hdma2d member of the pipeline.
+
+        (++) The JPEG In MDMA is fed from the image in memory, by blocks of up to 64 Kbytes,
+             HAL_JPEG_GetDataCallback and HAL_JPEG_DataReadyCallback are not called.
+
+        (++) Once the header is parsed, the MCU buffer is split in two chunks of whole rows
+             of MCUs. The JPEG Out MDMA fills one chunk while the DMA2D converts the other one
+             from YCbCr to the framebuffer format (memory to memory with pixel format conversion).
+             The JPEG output is paused when both chunks are waiting for the DMA2D.
+
+        (++) Only YCbCr images (4:2:0, 4:2:2 or 4:4:4) are supported, the image must fit in the
+             framebuffer and each half of the MCU buffer must hold a row of MCUs (for instance
+             19200 bytes for a 800 pixels wide 4:2:0 image).
+
+        (++) HAL_JPEG_DecodeCpltCallback is called at the end of the decoding, then
+             HAL_JPEG_PipelineCpltCallback once the last lines are written in the framebuffer.
+             The next frame of an MJPEG stream can be started from this callback.
+
+        (++) The JPEG, MDMA and DMA2D interrupts must have the same priority. On error,
+             HAL_JPEG_ErrorCallback is called with HAL_JPEG_ERROR_PIPELINE or HAL_JPEG_ERROR_DMA
+             and the application shall call HAL_JPEG_Abort.
+
       (#) To control JPEG state you can use the following function: HAL_JPEG_GetState()
 
      *** JPEG HAL driver macros list ***
@@ -169,6 +199,7 @@
     (+) ErrorCallback      : callback for error detection.
     (+) MspInitCallback    : JPEG MspInit.
     (+) MspDeInitCallback  : JPEG MspDeInit.
+    (+) PipelineCpltCallback : callback for end of decoding pipeline.
   This function takes as parameters the HAL peripheral handle, the Callback ID
   and a pointer to the user callback function.
 
@@ -186,6 +217,7 @@
     (+) ErrorCallback      : callback for error detection.
     (+) MspInitCallback    : JPEG MspInit.
     (+) MspDeInitCallback  : JPEG MspDeInit.
+    (+) PipelineCpltCallback : callback for end of decoding pipeline.
 
   For callbacks InfoReadyCallback, GetDataCallback and DataReadyCallback use dedicated
   unregister callbacks : respectively HAL_JPEG_UnRegisterInfoReadyCallback(),
@@ -267,6 +299,9 @@
 
 #define JPEG_PROCESS_ONGOING        ((uint32_t)0x00000000)  /* Process is on going */
 #define JPEG_PROCESS_DONE           ((uint32_t)0x00000001)  /* Process is done (ends) */
+
+#define JPEG_PIPELINE_INPUT_SLICE   ((uint32_t)0x0000FFE0)  /* Pipeline input block: largest MDMA block, multiple of 32 bytes */
+#define JPEG_PIPELINE_NO_CHUNK      ((uint32_t)0xFFFFFFFF)  /* Pipeline: no chunk waiting for the DMA2D */
 /**
   * @}
   */
@@ -450,6 +485,17 @@ static void JPEG_MDMAOutCpltCallback(MDMA_HandleTypeDef *hmdma);
 static void JPEG_MDMAInCpltCallback(MDMA_HandleTypeDef *hmdma);
 static void JPEG_MDMAErrorCallback(MDMA_HandleTypeDef *hmdma);
 static void JPEG_MDMAOutAbortCallback(MDMA_HandleTypeDef *hmdma);
+static void JPEG_DMA_DataReady(JPEG_HandleTypeDef *hjpeg, uint8_t *pDataOut, uint32_t OutDataLength);
+
+#if defined(HAL_DMA2D_MODULE_ENABLED)
+static void JPEG_PipelineInfoReady(JPEG_HandleTypeDef *hjpeg);
+static void JPEG_PipelineGetData(JPEG_HandleTypeDef *hjpeg, uint32_t NbDecodedData);
+static void JPEG_PipelineDataReady(JPEG_HandleTypeDef *hjpeg, uint8_t *pDataOut, uint32_t OutDataLength);
+static HAL_StatusTypeDef JPEG_PipelineConvStart(JPEG_PipelineTypeDef *pPipeline, uint32_t Chunk);
+static void JPEG_PipelineError(JPEG_HandleTypeDef *hjpeg, uint32_t Error);
+static void JPEG_DMA2DCpltCallback(DMA2D_HandleTypeDef *hdma2d);
+static void JPEG_DMA2DErrorCallback(DMA2D_HandleTypeDef *hdma2d);
+#endif /* HAL_DMA2D_MODULE_ENABLED */
 
 /**
   * @}
@@ -525,6 +571,7 @@ HAL_StatusTypeDef HAL_JPEG_Init(JPEG_HandleTypeDef *hjpeg)
     hjpeg->ErrorCallback      = HAL_JPEG_ErrorCallback;      /* Legacy weak ErrorCallback      */
     hjpeg->GetDataCallback    = HAL_JPEG_GetDataCallback;    /* Legacy weak GetDataCallback    */
     hjpeg->DataReadyCallback  = HAL_JPEG_DataReadyCallback;  /* Legacy weak DataReadyCallback  */
+    hjpeg->PipelineCpltCallback = HAL_JPEG_PipelineCpltCallback; /* Legacy weak PipelineCpltCallback */
 
     if (hjpeg->MspInitCallback == NULL)
     {
@@ -595,6 +642,9 @@ HAL_StatusTypeDef HAL_JPEG_Init(JPEG_HandleTypeDef *hjpeg)
   /*Clear the context filelds*/
   hjpeg->Context = 0;
 
+  /* No decoding pipeline */
+  hjpeg->pPipeline = NULL;
+
   /* Return function status */
   return HAL_OK;
 }
@@ -694,6 +744,7 @@ __weak void HAL_JPEG_MspDeInit(JPEG_HandleTypeDef *hjpeg)
   *          @arg @ref HAL_JPEG_ERROR_CB_ID Error callback ID
   *          @arg @ref HAL_JPEG_MSPINIT_CB_ID MspInit callback ID
   *          @arg @ref HAL_JPEG_MSPDEINIT_CB_ID MspDeInit callback ID
+  *          @arg @ref HAL_JPEG_PIPELINE_CPLT_CB_ID Pipeline Complete callback ID
   * @param  pCallback pointer to the Callback function
   * @retval HAL status
   */
@@ -735,6 +786,10 @@ HAL_StatusTypeDef HAL_JPEG_RegisterCallback(JPEG_HandleTypeDef *hjpeg, HAL_JPEG_
         hjpeg->MspDeInitCallback = pCallback;
         break;
 
+      case HAL_JPEG_PIPELINE_CPLT_CB_ID :
+        hjpeg->PipelineCpltCallback = pCallback;
+        break;
+
       default :
         /* Update the error code */
         hjpeg->ErrorCode |= HAL_JPEG_ERROR_INVALID_CALLBACK;
@@ -788,6 +843,7 @@ HAL_StatusTypeDef HAL_JPEG_RegisterCallback(JPEG_HandleTypeDef *hjpeg, HAL_JPEG_
   *          @arg @ref HAL_JPEG_ERROR_CB_ID Error callback ID
   *          @arg @ref HAL_JPEG_MSPINIT_CB_ID MspInit callback ID
   *          @arg @ref HAL_JPEG_MSPDEINIT_CB_ID MspDeInit callback ID
+  *          @arg @ref HAL_JPEG_PIPELINE_CPLT_CB_ID Pipeline Complete callback ID
   * @retval HAL status
   */
 HAL_StatusTypeDef HAL_JPEG_UnRegisterCallback(JPEG_HandleTypeDef *hjpeg, HAL_JPEG_CallbackIDTypeDef CallbackID)
@@ -821,6 +877,10 @@ HAL_StatusTypeDef HAL_JPEG_UnRegisterCallback(JPEG_HandleTypeDef *hjpeg, HAL_JPE
         hjpeg->MspDeInitCallback = HAL_JPEG_MspDeInit;          /* Legacy weak MspDeInit  */
         break;
 
+      case HAL_JPEG_PIPELINE_CPLT_CB_ID :
+        hjpeg->PipelineCpltCallback = HAL_JPEG_PipelineCpltCallback; /* Legacy weak PipelineCpltCallback  */
+        break;
+
       default :
         /* Update the error code */
         hjpeg->ErrorCode |= HAL_JPEG_ERROR_INVALID_CALLBACK;
@@ -1497,6 +1557,7 @@ HAL_StatusTypeDef  HAL_JPEG_SetUserQuantTables(JPEG_HandleTypeDef *hjpeg, uint8_
       (+) HAL_JPEG_Decode_IT()  : JPEG decoding with interrupt process
       (+) HAL_JPEG_Encode_DMA() : JPEG encoding with DMA process
       (+) HAL_JPEG_Decode_DMA() : JPEG decoding with DMA process
+      (+) HAL_JPEG_PipelineDecode_DMA() : JPEG decoding with DMA process into a framebuffer
       (+) HAL_JPEG_Pause()      :   Pause the Input/Output processing
       (+) HAL_JPEG_Resume()     :  Resume the JPEG Input/Output processing
       (+) HAL_JPEG_ConfigInputBuffer()  : Config Encoding/Decoding Input Buffer
@@ -1987,6 +2048,64 @@ HAL_StatusTypeDef  HAL_JPEG_Decode_DMA(JPEG_HandleTypeDef *hjpeg, uint8_t *pData
   return HAL_OK;
 }
 
+#if defined(HAL_DMA2D_MODULE_ENABLED)
+/**
+  * @brief  Starts JPEG decoding with DMA processing into a framebuffer
+  * @param  hjpeg pointer to a JPEG_HandleTypeDef structure that contains
+  *         the configuration information for JPEG module
+  * @param  pPipeline pointer to a JPEG_PipelineTypeDef structure that contains
+  *         the MCU buffer, the framebuffer and the DMA2D handle
+  * @param  pDataIn Pointer to the complete JPEG image
+  * @param  InDataLength size in bytes of the JPEG image
+  * @note   The MCU output is converted by the DMA2D from YCbCr to the framebuffer pixel format,
+  *         HAL_JPEG_PipelineCpltCallback is called once the whole image is in the framebuffer.
+  * @note   The pipeline structure must stay valid until the end of the decoding.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef  HAL_JPEG_PipelineDecode_DMA(JPEG_HandleTypeDef *hjpeg, JPEG_PipelineTypeDef *pPipeline,
+                                               uint8_t *pDataIn, uint32_t InDataLength)
+{
+  HAL_StatusTypeDef status;
+  uint32_t inSize;
+
+  /* Check In buffer, MCU buffer and framebuffer allocation */
+  if ((hjpeg == NULL) || (pPipeline == NULL) || (pDataIn == NULL) || (InDataLength == 0UL) ||
+      (pPipeline->pChunkBuffer == NULL) || (pPipeline->FrameBufferAddress == 0UL))
+  {
+    return HAL_ERROR;
+  }
+
+  if (hjpeg->State != HAL_JPEG_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  /* Until the header is parsed, the first half of the MCU buffer is used */
+  pPipeline->hjpeg        = hjpeg;
+  pPipeline->pInput       = pDataIn;
+  pPipeline->InputLeft    = InDataLength;
+  pPipeline->ChunkSize    = pPipeline->ChunkBufferSize / 2UL;
+  pPipeline->StripeSize   = 0;
+  pPipeline->CurrentLine  = 0;
+  pPipeline->FillChunk    = 0;
+  pPipeline->PendingChunk = JPEG_PIPELINE_NO_CHUNK;
+  pPipeline->ConvBusy     = 0;
+
+  inSize = (InDataLength > JPEG_PIPELINE_INPUT_SLICE) ? JPEG_PIPELINE_INPUT_SLICE : InDataLength;
+
+  hjpeg->pPipeline = pPipeline;
+
+  status = HAL_JPEG_Decode_DMA(hjpeg, pDataIn, inSize, pPipeline->pChunkBuffer, pPipeline->ChunkSize);
+  if (status != HAL_OK)
+  {
+    hjpeg->pPipeline = NULL;
+  }
+
+  /* Return function status */
+  return status;
+}
+#endif /* HAL_DMA2D_MODULE_ENABLED */
+
 /**
   * @brief  Pause the JPEG Input/Output processing
   * @param  hjpeg pointer to a JPEG_HandleTypeDef structure that contains
@@ -2207,6 +2326,15 @@ HAL_StatusTypeDef HAL_JPEG_Abort(JPEG_HandleTypeDef *hjpeg)
 
   if ((tmpContext & JPEG_CONTEXT_METHOD_MASK) == JPEG_CONTEXT_DMA)
   {
+#if defined(HAL_DMA2D_MODULE_ENABLED)
+    /* Stop the decoding pipeline colour conversion */
+    if (hjpeg->pPipeline != NULL)
+    {
+      (void) HAL_DMA2D_Abort(&hjpeg->pPipeline->hdma2d);
+      hjpeg->pPipeline = NULL;
+    }
+#endif /* HAL_DMA2D_MODULE_ENABLED */
+
     /* Stop the DMA In/out Xfer*/
     if (HAL_MDMA_Abort(hjpeg->hdmaout) != HAL_OK)
     {
@@ -2303,6 +2431,7 @@ HAL_StatusTypeDef HAL_JPEG_Abort(JPEG_HandleTypeDef *hjpeg)
       (+) HAL_JPEG_ErrorCallback()      : JPEG error callback.
       (+) HAL_JPEG_GetDataCallback()    : Get New Data chunk callback.
       (+) HAL_JPEG_DataReadyCallback()  : Decoded/Encoded Data ready  callback.
+      (+) HAL_JPEG_PipelineCpltCallback() : Decoding pipeline complete callback.
 
 @endverbatim
   * @{
@@ -2375,6 +2504,22 @@ __weak void HAL_JPEG_ErrorCallback(JPEG_HandleTypeDef *hjpeg)
    */
 }
 
+/**
+  * @brief  Decoding pipeline complete callback, the image is in the framebuffer.
+  * @param  hjpeg pointer to a JPEG_HandleTypeDef structure that contains
+  *         the configuration information for JPEG module
+  * @retval None
+  */
+__weak void HAL_JPEG_PipelineCpltCallback(JPEG_HandleTypeDef *hjpeg)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hjpeg);
+
+  /* NOTE : This function Should not be modified, when the callback is needed,
+            the HAL_JPEG_PipelineCpltCallback could be implemented in the user file
+   */
+}
+
 /**
   * @brief  Get New Data chunk callback.
   * @param  hjpeg pointer to a JPEG_HandleTypeDef structure that contains
@@ -3738,6 +3883,14 @@ static void JPEG_DMA_ContinueProcess(JPEG_HandleTypeDef *hjpeg)
       /* Note : the image quality is only available at the end of the decoding operation */
       /* at the current stage the calculated image quality is not correct so reset it */
 
+      if (hjpeg->pPipeline != NULL)
+      {
+#if defined(HAL_DMA2D_MODULE_ENABLED)
+        /* Size the pipeline chunks and configure the DMA2D from the image parameters */
+        JPEG_PipelineInfoReady(hjpeg);
+#endif /* HAL_DMA2D_MODULE_ENABLED */
+      }
+
       /*Call Info Ready callback */
 #if (USE_HAL_JPEG_REGISTER_CALLBACKS == 1)
       hjpeg->InfoReadyCallback(hjpeg, &hjpeg->Conf);
@@ -3800,11 +3953,7 @@ static void JPEG_DMA_EndProcess(JPEG_HandleTypeDef *hjpeg)
   /*if Output Buffer is full, call HAL_JPEG_DataReadyCallback*/
   if (hjpeg->JpegOutCount == hjpeg->OutDataLength)
   {
-#if (USE_HAL_JPEG_REGISTER_CALLBACKS == 1)
-    hjpeg->DataReadyCallback(hjpeg, hjpeg->pJpegOutBuffPtr, hjpeg->JpegOutCount);
-#else
-    HAL_JPEG_DataReadyCallback(hjpeg, hjpeg->pJpegOutBuffPtr, hjpeg->JpegOutCount);
-#endif /* USE_HAL_JPEG_REGISTER_CALLBACKS */
+    JPEG_DMA_DataReady(hjpeg, hjpeg->pJpegOutBuffPtr, hjpeg->JpegOutCount);
 
     hjpeg->JpegOutCount = 0;
   }
@@ -3815,11 +3964,7 @@ static void JPEG_DMA_EndProcess(JPEG_HandleTypeDef *hjpeg)
     if (hjpeg->JpegOutCount > 0UL)
     {
       /*Output Buffer is not empty, call DecodedDataReadyCallback*/
-#if (USE_HAL_JPEG_REGISTER_CALLBACKS == 1)
-      hjpeg->DataReadyCallback(hjpeg, hjpeg->pJpegOutBuffPtr, hjpeg->JpegOutCount);
-#else
-      HAL_JPEG_DataReadyCallback(hjpeg, hjpeg->pJpegOutBuffPtr, hjpeg->JpegOutCount);
-#endif /* USE_HAL_JPEG_REGISTER_CALLBACKS */
+      JPEG_DMA_DataReady(hjpeg, hjpeg->pJpegOutBuffPtr, hjpeg->JpegOutCount);
 
       hjpeg->JpegOutCount = 0;
     }
@@ -3894,11 +4039,7 @@ static void JPEG_DMA_PollResidualData(JPEG_HandleTypeDef *hjpeg)
         if (hjpeg->JpegOutCount == hjpeg->OutDataLength)
         {
           /*Output Buffer is full, call HAL_JPEG_DataReadyCallback*/
-#if (USE_HAL_JPEG_REGISTER_CALLBACKS == 1)
-          hjpeg->DataReadyCallback(hjpeg, hjpeg->pJpegOutBuffPtr, hjpeg->JpegOutCount);
-#else
-          HAL_JPEG_DataReadyCallback(hjpeg, hjpeg->pJpegOutBuffPtr, hjpeg->JpegOutCount);
-#endif /* USE_HAL_JPEG_REGISTER_CALLBACKS */
+          JPEG_DMA_DataReady(hjpeg, hjpeg->pJpegOutBuffPtr, hjpeg->JpegOutCount);
 
           hjpeg->JpegOutCount = 0;
         }
@@ -3917,11 +4058,7 @@ static void JPEG_DMA_PollResidualData(JPEG_HandleTypeDef *hjpeg)
     if (hjpeg->JpegOutCount > 0UL)
     {
       /*Output Buffer is not empty, call DecodedDataReadyCallback*/
-#if (USE_HAL_JPEG_REGISTER_CALLBACKS == 1)
-      hjpeg->DataReadyCallback(hjpeg, hjpeg->pJpegOutBuffPtr, hjpeg->JpegOutCount);
-#else
-      HAL_JPEG_DataReadyCallback(hjpeg, hjpeg->pJpegOutBuffPtr, hjpeg->JpegOutCount);
-#endif /* USE_HAL_JPEG_REGISTER_CALLBACKS */
+      JPEG_DMA_DataReady(hjpeg, hjpeg->pJpegOutBuffPtr, hjpeg->JpegOutCount);
 
       hjpeg->JpegOutCount = 0;
     }
@@ -3983,12 +4120,22 @@ static void JPEG_MDMAInCpltCallback(MDMA_HandleTypeDef *hmdma)
 
     hjpeg->JpegInCount = hjpeg->InDataLength - (hmdma->Instance->CBNDTR & MDMA_CBNDTR_BNDT);
 
-    /*Call HAL_JPEG_GetDataCallback to get new data */
+    if (hjpeg->pPipeline != NULL)
+    {
+#if defined(HAL_DMA2D_MODULE_ENABLED)
+      /* The pipeline feeds the next block of the image */
+      JPEG_PipelineGetData(hjpeg, hjpeg->JpegInCount);
+#endif /* HAL_DMA2D_MODULE_ENABLED */
+    }
+    else
+    {
+      /*Call HAL_JPEG_GetDataCallback to get new data */
 #if (USE_HAL_JPEG_REGISTER_CALLBACKS == 1)
-    hjpeg->GetDataCallback(hjpeg, hjpeg->JpegInCount);
+      hjpeg->GetDataCallback(hjpeg, hjpeg->JpegInCount);
 #else
-    HAL_JPEG_GetDataCallback(hjpeg, hjpeg->JpegInCount);
+      HAL_JPEG_GetDataCallback(hjpeg, hjpeg->JpegInCount);
 #endif /* USE_HAL_JPEG_REGISTER_CALLBACKS */
+    }
 
 
     if (hjpeg->InDataLength >= inXfrSize)
@@ -4065,11 +4212,7 @@ static void JPEG_MDMAOutCpltCallback(MDMA_HandleTypeDef *hmdma)
       hjpeg->JpegOutCount = hjpeg->OutDataLength - (hmdma->Instance->CBNDTR & MDMA_CBNDTR_BNDT);
 
       /*Output Buffer is full, call HAL_JPEG_DataReadyCallback*/
-#if (USE_HAL_JPEG_REGISTER_CALLBACKS == 1)
-      hjpeg->DataReadyCallback(hjpeg, hjpeg->pJpegOutBuffPtr, hjpeg->JpegOutCount);
-#else
-      HAL_JPEG_DataReadyCallback(hjpeg, hjpeg->pJpegOutBuffPtr, hjpeg->JpegOutCount);
-#endif /* USE_HAL_JPEG_REGISTER_CALLBACKS */
+      JPEG_DMA_DataReady(hjpeg, hjpeg->pJpegOutBuffPtr, hjpeg->JpegOutCount);
 
       if ((hjpeg->Context &  JPEG_CONTEXT_PAUSE_OUTPUT) == 0UL)
       {
@@ -4135,6 +4278,32 @@ static void JPEG_MDMAOutAbortCallback(MDMA_HandleTypeDef *hmdma)
   }
 }
 
+/**
+  * @brief  Notify a filled output buffer during a DMA process
+  * @param  hjpeg pointer to a JPEG_HandleTypeDef structure that contains
+  *         the configuration information for JPEG module
+  * @param  pDataOut pointer to the output data
+  * @param  OutDataLength number of bytes of output data
+  * @retval None
+  */
+static void JPEG_DMA_DataReady(JPEG_HandleTypeDef *hjpeg, uint8_t *pDataOut, uint32_t OutDataLength)
+{
+  if (hjpeg->pPipeline != NULL)
+  {
+#if defined(HAL_DMA2D_MODULE_ENABLED)
+    JPEG_PipelineDataReady(hjpeg, pDataOut, OutDataLength);
+#endif /* HAL_DMA2D_MODULE_ENABLED */
+  }
+  else
+  {
+#if (USE_HAL_JPEG_REGISTER_CALLBACKS == 1)
+    hjpeg->DataReadyCallback(hjpeg, pDataOut, OutDataLength);
+#else
+    HAL_JPEG_DataReadyCallback(hjpeg, pDataOut, OutDataLength);
+#endif /* USE_HAL_JPEG_REGISTER_CALLBACKS */
+  }
+}
+
 
 /**
   * @brief  Calculate the decoded image quality (from 1 to 100)
@@ -4182,6 +4351,337 @@ static uint32_t JPEG_GetQuality(JPEG_HandleTypeDef *hjpeg)
 
   return (quality / 64UL);
 }
+
+#if defined(HAL_DMA2D_MODULE_ENABLED)
+/**
+  * @brief  Configure the decoding pipeline once the JPEG header is parsed
+  * @param  hjpeg pointer to a JPEG_HandleTypeDef structure that contains
+  *         the configuration information for JPEG module
+  * @note   The chunks are resized to a whole number of rows of MCUs and the
+  *         JPEG Out MDMA is restarted accordingly on the first chunk.
+  * @retval None
+  */
+static void JPEG_PipelineInfoReady(JPEG_HandleTypeDef *hjpeg)
+{
+  JPEG_PipelineTypeDef *pipeline = hjpeg->pPipeline;
+  uint32_t mcuWidth;
+  uint32_t mcuHeight;
+  uint32_t mcuSize;
+  uint32_t css;
+  uint32_t nbStripes;
+  uint32_t offset;
+
+  /* The DMA2D converts YCbCr MCUs only, and the image must fit in the framebuffer */
+  if ((hjpeg->Conf.ColorSpace != JPEG_YCBCR_COLORSPACE) || (hjpeg->Conf.ImageWidth == 0UL) ||
+      (hjpeg->Conf.ImageWidth > pipeline->FrameBufferWidth) ||
+      (hjpeg->Conf.ImageHeight > pipeline->FrameBufferHeight))
+  {
+    JPEG_PipelineError(hjpeg, HAL_JPEG_ERROR_PIPELINE);
+    return;
+  }
+
+  if (hjpeg->Conf.ChromaSubsampling == JPEG_420_SUBSAMPLING)
+  {
+    /* 16x16 pixels MCU: 4 Y blocks, 1 Cb block, 1 Cr block */
+    mcuWidth  = 16;
+    mcuHeight = 16;
+    mcuSize   = 384;
+    css       = DMA2D_CSS_420;
+  }
+  else if (hjpeg->Conf.ChromaSubsampling == JPEG_422_SUBSAMPLING)
+  {
+    /* 16x8 pixels MCU: 2 Y blocks, 1 Cb block, 1 Cr block */
+    mcuWidth  = 16;
+    mcuHeight = 8;
+    mcuSize   = 256;
+    css       = DMA2D_CSS_422;
+  }
+  else
+  {
+    /* 8x8 pixels MCU: 1 Y block, 1 Cb block, 1 Cr block */
+    mcuWidth  = 8;
+    mcuHeight = 8;
+    mcuSize   = 192;
+    css       = DMA2D_NO_CSS;
+  }
+
+  if (pipeline->OutputColorMode == DMA2D_OUTPUT_ARGB8888)
+  {
+    pipeline->PixelSize = 4;
+  }
+  else if (pipeline->OutputColorMode == DMA2D_OUTPUT_RGB888)
+  {
+    pipeline->PixelSize = 3;
+  }
+  else
+  {
+    pipeline->PixelSize = 2;
+  }
+
+  pipeline->StripeLines = mcuHeight;
+  pipeline->StripeSize  = ((hjpeg->Conf.ImageWidth + mcuWidth - 1UL) / mcuWidth) * mcuSize;
+
+  nbStripes = (pipeline->ChunkBufferSize / 2UL) / pipeline->StripeSize;
+  if (nbStripes == 0UL)
+  {
+    JPEG_PipelineError(hjpeg, HAL_JPEG_ERROR_PIPELINE);
+    return;
+  }
+
+  /* DMA2D memory to memory with pixel format conversion, from the MCUs to the framebuffer */
+  pipeline->hdma2d.Init.Mode           = DMA2D_M2M_PFC;
+  pipeline->hdma2d.Init.ColorMode      = pipeline->OutputColorMode;
+  pipeline->hdma2d.Init.OutputOffset   = pipeline->FrameBufferWidth - hjpeg->Conf.ImageWidth;
+  pipeline->hdma2d.Init.AlphaInverted  = DMA2D_REGULAR_ALPHA;
+  pipeline->hdma2d.Init.RedBlueSwap    = DMA2D_RB_REGULAR;
+  pipeline->hdma2d.Init.BytesSwap      = DMA2D_BYTES_REGULAR;
+  pipeline->hdma2d.Init.LineOffsetMode = DMA2D_LOM_PIXELS;
+
+  /* The MCU rows are padded up to a multiple of the MCU width */
+  pipeline->hdma2d.LayerCfg[DMA2D_FOREGROUND_LAYER].InputOffset       = (mcuWidth - (hjpeg->Conf.ImageWidth % mcuWidth)) %
+                                                                       mcuWidth;
+  pipeline->hdma2d.LayerCfg[DMA2D_FOREGROUND_LAYER].InputColorMode    = DMA2D_INPUT_YCBCR;
+  pipeline->hdma2d.LayerCfg[DMA2D_FOREGROUND_LAYER].AlphaMode         = DMA2D_REPLACE_ALPHA;
+  pipeline->hdma2d.LayerCfg[DMA2D_FOREGROUND_LAYER].InputAlpha        = 0xFFU;
+  pipeline->hdma2d.LayerCfg[DMA2D_FOREGROUND_LAYER].AlphaInverted     = DMA2D_REGULAR_ALPHA;
+  pipeline->hdma2d.LayerCfg[DMA2D_FOREGROUND_LAYER].RedBlueSwap       = DMA2D_RB_REGULAR;
+  pipeline->hdma2d.LayerCfg[DMA2D_FOREGROUND_LAYER].ChromaSubSampling = css;
+
+  if ((HAL_DMA2D_Init(&pipeline->hdma2d) != HAL_OK) ||
+      (HAL_DMA2D_ConfigLayer(&pipeline->hdma2d, DMA2D_FOREGROUND_LAYER) != HAL_OK))
+  {
+    JPEG_PipelineError(hjpeg, HAL_JPEG_ERROR_PIPELINE);
+    return;
+  }
+
+  pipeline->hdma2d.XferCpltCallback  = JPEG_DMA2DCpltCallback;
+  pipeline->hdma2d.XferErrorCallback = JPEG_DMA2DErrorCallback;
+
+  /* Restart the JPEG Out MDMA with chunks of whole rows of MCUs, keeping the data already transferred */
+  if (hjpeg->hdmaout->State == HAL_MDMA_STATE_BUSY)
+  {
+    (void) HAL_MDMA_Abort(hjpeg->hdmaout);
+  }
+  offset = hjpeg->OutDataLength - (hjpeg->hdmaout->Instance->CBNDTR & MDMA_CBNDTR_BNDT);
+
+  pipeline->ChunkSize = nbStripes * pipeline->StripeSize;
+  if (offset >= pipeline->ChunkSize)
+  {
+    JPEG_PipelineError(hjpeg, HAL_JPEG_ERROR_PIPELINE);
+    return;
+  }
+
+  hjpeg->pJpegOutBuffPtr = &pipeline->pChunkBuffer[offset];
+  hjpeg->OutDataLength = pipeline->ChunkSize - offset;
+
+  if (HAL_MDMA_Start_IT(hjpeg->hdmaout, (uint32_t)&hjpeg->Instance->DOR, (uint32_t)hjpeg->pJpegOutBuffPtr,
+                        hjpeg->OutDataLength, 1) != HAL_OK)
+  {
+    JPEG_PipelineError(hjpeg, HAL_JPEG_ERROR_DMA);
+  }
+}
+
+/**
+  * @brief  Provide the next block of the image to the JPEG In MDMA
+  * @param  hjpeg pointer to a JPEG_HandleTypeDef structure that contains
+  *         the configuration information for JPEG module
+  * @param  NbDecodedData number of bytes consumed from the previous block
+  * @retval None
+  */
+static void JPEG_PipelineGetData(JPEG_HandleTypeDef *hjpeg, uint32_t NbDecodedData)
+{
+  JPEG_PipelineTypeDef *pipeline = hjpeg->pPipeline;
+
+  /* The last block may have been rounded up to a multiple of 4 bytes */
+  if (NbDecodedData < pipeline->InputLeft)
+  {
+    pipeline->pInput    += NbDecodedData;
+    pipeline->InputLeft -= NbDecodedData;
+  }
+  else
+  {
+    pipeline->InputLeft = 0;
+  }
+
+  HAL_JPEG_ConfigInputBuffer(hjpeg, pipeline->pInput, (pipeline->InputLeft > JPEG_PIPELINE_INPUT_SLICE) ?
+                             JPEG_PIPELINE_INPUT_SLICE : pipeline->InputLeft);
+}
+
+/**
+  * @brief  Hand a filled chunk over to the DMA2D and switch the JPEG output to the other chunk
+  * @param  hjpeg pointer to a JPEG_HandleTypeDef structure that contains
+  *         the configuration information for JPEG module
+  * @param  pDataOut pointer to the output data
+  * @param  OutDataLength number of bytes of output data
+  * @retval None
+  */
+static void JPEG_PipelineDataReady(JPEG_HandleTypeDef *hjpeg, uint8_t *pDataOut, uint32_t OutDataLength)
+{
+  JPEG_PipelineTypeDef *pipeline = hjpeg->pPipeline;
+  uint32_t chunk = pipeline->FillChunk;
+
+  /* The first chunk may have been restarted at an offset once the header was parsed */
+  pipeline->ChunkLength[chunk] = (uint32_t)(pDataOut - &pipeline->pChunkBuffer[chunk * pipeline->ChunkSize]) +
+                                 OutDataLength;
+
+  /* Next data are stored in the other chunk */
+  pipeline->FillChunk = chunk ^ 1UL;
+  HAL_JPEG_ConfigOutputBuffer(hjpeg, &pipeline->pChunkBuffer[pipeline->FillChunk * pipeline->ChunkSize],
+                              pipeline->ChunkSize);
+
+  if (pipeline->ConvBusy == 0UL)
+  {
+    if (JPEG_PipelineConvStart(pipeline, chunk) != HAL_OK)
+    {
+      JPEG_PipelineError(hjpeg, HAL_JPEG_ERROR_PIPELINE);
+    }
+  }
+  else
+  {
+    /* The other chunk is still being converted: hold the JPEG output until it is free */
+    pipeline->PendingChunk = chunk;
+    (void) HAL_JPEG_Pause(hjpeg, JPEG_PAUSE_RESUME_OUTPUT);
+  }
+}
+
+/**
+  * @brief  Start the DMA2D conversion of a chunk to the next lines of the framebuffer
+  * @param  pPipeline pointer to a JPEG_PipelineTypeDef structure
+  * @param  Chunk index of the chunk to convert
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef JPEG_PipelineConvStart(JPEG_PipelineTypeDef *pPipeline, uint32_t Chunk)
+{
+  JPEG_HandleTypeDef *hjpeg = pPipeline->hjpeg;
+  uint32_t nbLines;
+  uint32_t dstAddress;
+
+  if (pPipeline->StripeSize == 0UL)
+  {
+    /* Data received before the header parsing */
+    return HAL_ERROR;
+  }
+
+  nbLines = ((pPipeline->ChunkLength[Chunk] + pPipeline->StripeSize - 1UL) / pPipeline->StripeSize) *
+            pPipeline->StripeLines;
+
+  /* The last row of MCUs is cropped to the image height */
+  if (nbLines > (hjpeg->Conf.ImageHeight - pPipeline->CurrentLine))
+  {
+    nbLines = hjpeg->Conf.ImageHeight - pPipeline->CurrentLine;
+  }
+
+  if (nbLines == 0UL)
+  {
+    return HAL_ERROR;
+  }
+
+  dstAddress = pPipeline->FrameBufferAddress +
+               (pPipeline->CurrentLine * pPipeline->FrameBufferWidth * pPipeline->PixelSize);
+
+  pPipeline->CurrentLine += nbLines;
+  pPipeline->ConvBusy = 1;
+
+  return HAL_DMA2D_Start_IT(&pPipeline->hdma2d, (uint32_t)&pPipeline->pChunkBuffer[Chunk * pPipeline->ChunkSize],
+                            dstAddress, hjpeg->Conf.ImageWidth, nbLines);
+}
+
+/**
+  * @brief  Stop the decoding pipeline on error
+  * @param  hjpeg pointer to a JPEG_HandleTypeDef structure that contains
+  *         the configuration information for JPEG module
+  * @param  Error error code to report
+  * @retval None
+  */
+static void JPEG_PipelineError(JPEG_HandleTypeDef *hjpeg, uint32_t Error)
+{
+  hjpeg->pPipeline = NULL;
+
+  hjpeg->ErrorCode |= Error;
+  hjpeg->State = HAL_JPEG_STATE_ERROR;
+
+#if (USE_HAL_JPEG_REGISTER_CALLBACKS == 1)
+  hjpeg->ErrorCallback(hjpeg);
+#else
+  HAL_JPEG_ErrorCallback(hjpeg);
+#endif /* USE_HAL_JPEG_REGISTER_CALLBACKS */
+}
+
+/**
+  * @brief  DMA2D conversion complete callback of the decoding pipeline
+  * @param  hdma2d pointer to the DMA2D handle, first member of a JPEG_PipelineTypeDef structure
+  * @retval None
+  */
+static void JPEG_DMA2DCpltCallback(DMA2D_HandleTypeDef *hdma2d)
+{
+  JPEG_PipelineTypeDef *pipeline = (JPEG_PipelineTypeDef *)hdma2d;
+  JPEG_HandleTypeDef *hjpeg = pipeline->hjpeg;
+  uint32_t chunk;
+
+  pipeline->ConvBusy = 0;
+
+  if (hjpeg->pPipeline != pipeline)
+  {
+    /* Pipeline stopped */
+    return;
+  }
+
+  if (pipeline->PendingChunk != JPEG_PIPELINE_NO_CHUNK)
+  {
+    /* Convert the waiting chunk and resume the JPEG output in the chunk just converted */
+    chunk = pipeline->PendingChunk;
+    pipeline->PendingChunk = JPEG_PIPELINE_NO_CHUNK;
+
+    if (JPEG_PipelineConvStart(pipeline, chunk) != HAL_OK)
+    {
+      JPEG_PipelineError(hjpeg, HAL_JPEG_ERROR_PIPELINE);
+      return;
+    }
+
+    /* The last chunk may have been delivered by the end of decoding: the JPEG is then
+       already back to READY and the pipeline completes with this conversion */
+    if (hjpeg->State == HAL_JPEG_STATE_BUSY_DECODING)
+    {
+      if (HAL_JPEG_Resume(hjpeg, JPEG_PAUSE_RESUME_OUTPUT) != HAL_OK)
+      {
+        JPEG_PipelineError(hjpeg, HAL_JPEG_ERROR_DMA);
+      }
+    }
+  }
+  else if (pipeline->CurrentLine >= hjpeg->Conf.ImageHeight)
+  {
+    /* The whole image is in the framebuffer */
+    hjpeg->pPipeline = NULL;
+
+#if (USE_HAL_JPEG_REGISTER_CALLBACKS == 1)
+    hjpeg->PipelineCpltCallback(hjpeg);
+#else
+    HAL_JPEG_PipelineCpltCallback(hjpeg);
+#endif /* USE_HAL_JPEG_REGISTER_CALLBACKS */
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+}
+
+/**
+  * @brief  DMA2D transfer error callback of the decoding pipeline
+  * @param  hdma2d pointer to the DMA2D handle, first member of a JPEG_PipelineTypeDef structure
+  * @retval None
+  */
+static void JPEG_DMA2DErrorCallback(DMA2D_HandleTypeDef *hdma2d)
+{
+  JPEG_PipelineTypeDef *pipeline = (JPEG_PipelineTypeDef *)hdma2d;
+
+  pipeline->ConvBusy = 0;
+
+  if (pipeline->hjpeg->pPipeline == pipeline)
+  {
+    JPEG_PipelineError(pipeline->hjpeg, HAL_JPEG_ERROR_PIPELINE);
+  }
+}
+#endif /* HAL_DMA2D_MODULE_ENABLED */
 /**
   * @}
   */
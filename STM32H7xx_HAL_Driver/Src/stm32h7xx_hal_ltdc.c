@@ -9,6 +9,7 @@
   *           + IO operation functions
   *           + Peripheral Control functions
   *           + Peripheral State and Errors functions
+  *           + Swap chain functions
   *
   ******************************************************************************
   * @attention
@@ -78,6 +79,26 @@
          this option allows to avoid display flicker by applying the new settings during the vertical blanking period.
 
 
+     *** Swap chain ***
+     ==================
+     [..]
+     (#) Double or triple buffering without tearing nor polling is provided by a swap chain:
+         configure the layer with HAL_LTDC_ConfigLayer(), fill the framebuffers addresses,
+         their number and the layer index of a LTDC_SwapChainTypeDef structure, then call
+         HAL_LTDC_SwapChainInit(). The first framebuffer is displayed at once.
+
+     (#) Get a framebuffer free for rendering with HAL_LTDC_SwapChainAcquire(), render into it
+         then call HAL_LTDC_SwapChainPresent(). The framebuffer address is reloaded in the next
+         vertical blanking period, or in the following one when another framebuffer is already
+         waiting for the reload.
+
+     (#) HAL_LTDC_SwapChainFreeCallback() is called from the register reload interrupt each time
+         a framebuffer goes off screen and can be acquired again. The LTDC interrupt must be
+         enabled and HAL_LTDC_IRQHandler() called from the LTDC interrupt handler.
+         HAL_LTDC_ReloadEventCallback() is still called on each reload.
+
+     (#) HAL_LTDC_SwapChainDeInit() detaches the swap chain, the displayed framebuffer stays on screen.
+
      (#) To control LTDC state you can use the following function: HAL_LTDC_GetState()
 
      *** LTDC HAL driver macros list ***
@@ -112,6 +133,7 @@
       (+) LineEventCallback   : LTDC Line Event Callback.
       (+) ReloadEventCallback : LTDC Reload Event Callback.
       (+) ErrorCallback       : LTDC Error Callback
+      (+) SwapChainFreeCallback : LTDC Swap Chain Free Callback.
       (+) MspInitCallback     : LTDC MspInit.
       (+) MspDeInitCallback   : LTDC MspDeInit.
     [..]
@@ -128,6 +150,7 @@
       (+) LineEventCallback   : LTDC Line Event Callback
       (+) ReloadEventCallback : LTDC Reload Event Callback
       (+) ErrorCallback       : LTDC Error Callback
+      (+) SwapChainFreeCallback : LTDC Swap Chain Free Callback
       (+) MspInitCallback     : LTDC MspInit
       (+) MspDeInitCallback   : LTDC MspDeInit.
 
@@ -182,6 +205,7 @@
   * @{
   */
 #define LTDC_TIMEOUT_VALUE ((uint32_t)100U)  /* 100ms */
+#define LTDC_SWAPCHAIN_NONE ((uint32_t)0xFFFFFFFFU)  /* No framebuffer */
 /**
   * @}
   */
@@ -189,6 +213,8 @@
 /* Private variables ---------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
 static void LTDC_SetConfig(LTDC_HandleTypeDef *hltdc, LTDC_LayerCfgTypeDef *pLayerCfg, uint32_t LayerIdx);
+static void LTDC_SwapChainSetBuffer(LTDC_HandleTypeDef *hltdc, uint32_t Index);
+static void LTDC_SwapChainReload(LTDC_HandleTypeDef *hltdc);
 /* Private functions ---------------------------------------------------------*/
 
 /** @defgroup LTDC_Exported_Functions LTDC Exported Functions
@@ -252,6 +278,7 @@ HAL_StatusTypeDef HAL_LTDC_Init(LTDC_HandleTypeDef *hltdc)
     hltdc->LineEventCallback   = HAL_LTDC_LineEventCallback;    /* Legacy weak LineEventCallback    */
     hltdc->ReloadEventCallback = HAL_LTDC_ReloadEventCallback;  /* Legacy weak ReloadEventCallback  */
     hltdc->ErrorCallback       = HAL_LTDC_ErrorCallback;        /* Legacy weak ErrorCallback        */
+    hltdc->SwapChainFreeCallback = HAL_LTDC_SwapChainFreeCallback; /* Legacy weak SwapChainFreeCallback */
 
     if (hltdc->MspInitCallback == NULL)
     {
@@ -310,6 +337,9 @@ HAL_StatusTypeDef HAL_LTDC_Init(LTDC_HandleTypeDef *hltdc)
   /* Enable LTDC by setting LTDCEN bit */
   __HAL_LTDC_ENABLE(hltdc);
 
+  /* No swap chain attached */
+  hltdc->pSwapChain = NULL;
+
   /* Initialize the error code */
   hltdc->ErrorCode = HAL_LTDC_ERROR_NONE;
 
@@ -432,6 +462,7 @@ __weak void HAL_LTDC_MspDeInit(LTDC_HandleTypeDef *hltdc)
   *          @arg @ref HAL_LTDC_LINE_EVENT_CB_ID Line Event Callback ID
   *          @arg @ref HAL_LTDC_RELOAD_EVENT_CB_ID Reload Event Callback ID
   *          @arg @ref HAL_LTDC_ERROR_CB_ID Error Callback ID
+  *          @arg @ref HAL_LTDC_SWAPCHAIN_FREE_CB_ID Swap Chain Free Callback ID
   *          @arg @ref HAL_LTDC_MSPINIT_CB_ID MspInit callback ID
   *          @arg @ref HAL_LTDC_MSPDEINIT_CB_ID MspDeInit callback ID
   * @param pCallback pointer to the Callback function
@@ -468,6 +499,10 @@ HAL_StatusTypeDef HAL_LTDC_RegisterCallback(LTDC_HandleTypeDef *hltdc, HAL_LTDC_
         hltdc->ErrorCallback = pCallback;
         break;
 
+      case HAL_LTDC_SWAPCHAIN_FREE_CB_ID :
+        hltdc->SwapChainFreeCallback = pCallback;
+        break;
+
       case HAL_LTDC_MSPINIT_CB_ID :
         hltdc->MspInitCallback = pCallback;
         break;
@@ -527,6 +562,7 @@ HAL_StatusTypeDef HAL_LTDC_RegisterCallback(LTDC_HandleTypeDef *hltdc, HAL_LTDC_
   *          @arg @ref HAL_LTDC_LINE_EVENT_CB_ID Line Event Callback ID
   *          @arg @ref HAL_LTDC_RELOAD_EVENT_CB_ID Reload Event Callback ID
   *          @arg @ref HAL_LTDC_ERROR_CB_ID Error Callback ID
+  *          @arg @ref HAL_LTDC_SWAPCHAIN_FREE_CB_ID Swap Chain Free Callback ID
   *          @arg @ref HAL_LTDC_MSPINIT_CB_ID MspInit callback ID
   *          @arg @ref HAL_LTDC_MSPDEINIT_CB_ID MspDeInit callback ID
   * @retval status
@@ -554,6 +590,10 @@ HAL_StatusTypeDef HAL_LTDC_UnRegisterCallback(LTDC_HandleTypeDef *hltdc, HAL_LTD
         hltdc->ErrorCallback       = HAL_LTDC_ErrorCallback;        /* Legacy weak ErrorCallback        */
         break;
 
+      case HAL_LTDC_SWAPCHAIN_FREE_CB_ID :
+        hltdc->SwapChainFreeCallback = HAL_LTDC_SwapChainFreeCallback; /* Legacy weak SwapChainFreeCallback */
+        break;
+
       case HAL_LTDC_MSPINIT_CB_ID :
         hltdc->MspInitCallback = HAL_LTDC_MspInit;                  /* Legcay weak MspInit Callback     */
         break;
@@ -729,6 +769,12 @@ void HAL_LTDC_IRQHandler(LTDC_HandleTypeDef *hltdc)
     /* Process unlocked */
     __HAL_UNLOCK(hltdc);
 
+    if (hltdc->pSwapChain != NULL)
+    {
+      /* Swap chain framebuffer on screen */
+      LTDC_SwapChainReload(hltdc);
+    }
+
     /* Reload interrupt Callback */
 #if (USE_HAL_LTDC_REGISTER_CALLBACKS == 1)
     /*Call registered reload Event callback */
@@ -2108,6 +2154,216 @@ uint32_t HAL_LTDC_GetError(LTDC_HandleTypeDef *hltdc)
   return hltdc->ErrorCode;
 }
 
+/**
+  * @}
+  */
+
+/** @defgroup LTDC_Exported_Functions_Group5 Swap chain functions
+  *  @brief    Swap chain functions
+  *
+@verbatim
+ ===============================================================================
+                      ##### Swap chain functions #####
+ ===============================================================================
+    [..]
+    This subsection provides functions allowing to
+      (+) Attach or detach a swap chain of framebuffers to a layer.
+      (+) Acquire a framebuffer for rendering.
+      (+) Present a rendered framebuffer at the next vertical blanking.
+      (+) Be notified when a framebuffer is free again.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Attach a swap chain to a layer and display its first framebuffer.
+  * @param  hltdc       pointer to a LTDC_HandleTypeDef structure that contains
+  *                     the configuration information for the LTDC.
+  * @param  pSwapChain  pointer to a LTDC_SwapChainTypeDef structure, kept by the
+  *                     driver until HAL_LTDC_SwapChainDeInit() is called.
+  * @note   The layer must be configured with HAL_LTDC_ConfigLayer() beforehand.
+  *         The first framebuffer is loaded with an immediate reload.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_LTDC_SwapChainInit(LTDC_HandleTypeDef *hltdc, LTDC_SwapChainTypeDef *pSwapChain)
+{
+  uint32_t index;
+
+  if (pSwapChain == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the parameters */
+  assert_param(IS_LTDC_LAYER(pSwapChain->LayerIdx));
+  assert_param(IS_LTDC_SWAPCHAIN_BUFFERS(pSwapChain->NbBuffers));
+
+  if ((pSwapChain->NbBuffers < 2U) || (pSwapChain->NbBuffers > LTDC_SWAPCHAIN_MAX_BUFFERS) ||
+      (pSwapChain->LayerIdx >= MAX_LAYER))
+  {
+    return HAL_ERROR;
+  }
+
+  for (index = 0U; index < pSwapChain->NbBuffers; index++)
+  {
+    if (pSwapChain->BufferAddress[index] == 0U)
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  /* Process locked */
+  __HAL_LOCK(hltdc);
+
+  /* First framebuffer on screen, the other ones are free */
+  pSwapChain->Displayed  = 0U;
+  pSwapChain->Queued     = LTDC_SWAPCHAIN_NONE;
+  pSwapChain->Pending    = LTDC_SWAPCHAIN_NONE;
+  pSwapChain->FreeMask   = ((1UL << pSwapChain->NbBuffers) - 1U) & ~1UL;
+  pSwapChain->FrameCount = 0U;
+
+  hltdc->pSwapChain = pSwapChain;
+
+  LTDC_SwapChainSetBuffer(hltdc, 0U);
+
+  /* Apply the framebuffer address at once */
+  hltdc->Instance->SRCR = LTDC_SRCR_IMR;
+
+  /* Process unlocked */
+  __HAL_UNLOCK(hltdc);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Detach the swap chain, the displayed framebuffer stays on screen.
+  * @param  hltdc  pointer to a LTDC_HandleTypeDef structure that contains
+  *                the configuration information for the LTDC.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_LTDC_SwapChainDeInit(LTDC_HandleTypeDef *hltdc)
+{
+  if (hltdc->pSwapChain == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  hltdc->pSwapChain = NULL;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Get a framebuffer free for rendering.
+  * @param  hltdc     pointer to a LTDC_HandleTypeDef structure that contains
+  *                   the configuration information for the LTDC.
+  * @param  pIndex    pointer to the framebuffer index, to be given to HAL_LTDC_SwapChainPresent()
+  * @param  pAddress  pointer to the framebuffer address, may be NULL
+  * @retval HAL status, HAL_BUSY when no framebuffer is free: retry from
+  *         HAL_LTDC_SwapChainFreeCallback().
+  */
+HAL_StatusTypeDef HAL_LTDC_SwapChainAcquire(LTDC_HandleTypeDef *hltdc, uint32_t *pIndex, uint32_t *pAddress)
+{
+  LTDC_SwapChainTypeDef *swapchain = hltdc->pSwapChain;
+  HAL_StatusTypeDef status = HAL_BUSY;
+  uint32_t primask;
+  uint32_t index;
+
+  if ((swapchain == NULL) || (pIndex == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  for (index = 0U; index < swapchain->NbBuffers; index++)
+  {
+    if ((swapchain->FreeMask & (1UL << index)) != 0U)
+    {
+      swapchain->FreeMask &= ~(1UL << index);
+      *pIndex = index;
+      if (pAddress != NULL)
+      {
+        *pAddress = swapchain->BufferAddress[index];
+      }
+      status = HAL_OK;
+      break;
+    }
+  }
+
+  __set_PRIMASK(primask);
+
+  return status;
+}
+
+/**
+  * @brief  Present a rendered framebuffer, displayed from the next vertical blanking.
+  * @param  hltdc  pointer to a LTDC_HandleTypeDef structure that contains
+  *                the configuration information for the LTDC.
+  * @param  Index  framebuffer index returned by HAL_LTDC_SwapChainAcquire()
+  * @note   When a framebuffer is already waiting for the reload, the presented one
+  *         follows at the next vertical blanking.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_LTDC_SwapChainPresent(LTDC_HandleTypeDef *hltdc, uint32_t Index)
+{
+  LTDC_SwapChainTypeDef *swapchain = hltdc->pSwapChain;
+  HAL_StatusTypeDef status = HAL_OK;
+  uint32_t primask;
+
+  if ((swapchain == NULL) || (Index >= swapchain->NbBuffers))
+  {
+    return HAL_ERROR;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  if (((swapchain->FreeMask & (1UL << Index)) != 0U) || (Index == swapchain->Displayed) ||
+      (Index == swapchain->Queued) || (Index == swapchain->Pending))
+  {
+    /* Framebuffer not acquired */
+    hltdc->ErrorCode |= HAL_LTDC_ERROR_SWAPCHAIN;
+    status = HAL_ERROR;
+  }
+  else if (swapchain->Queued == LTDC_SWAPCHAIN_NONE)
+  {
+    swapchain->Queued = Index;
+    LTDC_SwapChainSetBuffer(hltdc, Index);
+
+    /* Reload in the next vertical blanking period and notify it */
+    __HAL_LTDC_ENABLE_IT(hltdc, LTDC_IT_RR);
+    hltdc->Instance->SRCR = LTDC_SRCR_VBR;
+  }
+  else
+  {
+    /* Applied from the reload interrupt of the queued framebuffer */
+    swapchain->Pending = Index;
+  }
+
+  __set_PRIMASK(primask);
+
+  return status;
+}
+
+/**
+  * @brief  Swap chain free callback, a framebuffer can be acquired again.
+  * @param  hltdc  pointer to a LTDC_HandleTypeDef structure that contains
+  *                the configuration information for the LTDC.
+  * @retval None
+  */
+__weak void HAL_LTDC_SwapChainFreeCallback(LTDC_HandleTypeDef *hltdc)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hltdc);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_LTDC_SwapChainFreeCallback could be implemented in the user file
+   */
+}
+
 /**
   * @}
   */
@@ -2201,6 +2457,61 @@ static void LTDC_SetConfig(LTDC_HandleTypeDef *hltdc, LTDC_LayerCfgTypeDef *pLay
   LTDC_LAYER(hltdc, LayerIdx)->CR |= (uint32_t)LTDC_LxCR_LEN;
 }
 
+/**
+  * @brief  Program a swap chain framebuffer address, applied at the next reload
+  * @param  hltdc     Pointer to a LTDC_HandleTypeDef structure that contains
+  *                   the configuration information for the LTDC.
+  * @param  Index     Framebuffer index
+  * @retval None
+  */
+static void LTDC_SwapChainSetBuffer(LTDC_HandleTypeDef *hltdc, uint32_t Index)
+{
+  LTDC_SwapChainTypeDef *swapchain = hltdc->pSwapChain;
+
+  hltdc->LayerCfg[swapchain->LayerIdx].FBStartAdress = swapchain->BufferAddress[Index];
+  LTDC_LAYER(hltdc, swapchain->LayerIdx)->CFBAR = swapchain->BufferAddress[Index];
+}
+
+/**
+  * @brief  Register reload of a swap chain framebuffer
+  * @param  hltdc     Pointer to a LTDC_HandleTypeDef structure that contains
+  *                   the configuration information for the LTDC.
+  * @retval None
+  */
+static void LTDC_SwapChainReload(LTDC_HandleTypeDef *hltdc)
+{
+  LTDC_SwapChainTypeDef *swapchain = hltdc->pSwapChain;
+
+  if (swapchain->Queued == LTDC_SWAPCHAIN_NONE)
+  {
+    /* Reload requested by the application */
+    return;
+  }
+
+  /* The queued framebuffer is on screen, the previous one is free */
+  swapchain->FreeMask |= (1UL << swapchain->Displayed);
+  swapchain->Displayed = swapchain->Queued;
+  swapchain->Queued = LTDC_SWAPCHAIN_NONE;
+  swapchain->FrameCount++;
+
+  if (swapchain->Pending != LTDC_SWAPCHAIN_NONE)
+  {
+    /* Queue the next presented framebuffer */
+    swapchain->Queued = swapchain->Pending;
+    swapchain->Pending = LTDC_SWAPCHAIN_NONE;
+    LTDC_SwapChainSetBuffer(hltdc, swapchain->Queued);
+
+    __HAL_LTDC_ENABLE_IT(hltdc, LTDC_IT_RR);
+    hltdc->Instance->SRCR = LTDC_SRCR_VBR;
+  }
+
+#if (USE_HAL_LTDC_REGISTER_CALLBACKS == 1)
+  hltdc->SwapChainFreeCallback(hltdc);
+#else
+  HAL_LTDC_SwapChainFreeCallback(hltdc);
+#endif /* USE_HAL_LTDC_REGISTER_CALLBACKS */
+}
+
 /**
   * @}
   */
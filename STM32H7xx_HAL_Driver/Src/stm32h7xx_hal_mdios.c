@@ -66,6 +66,18 @@
         (@) HAL_MDIOS_IRQHandler() must be called from the MDIOS IRQ Handler, to handle the interrupt
             and execute the previous callbacks
 
+    (#) Alternatively, mirror the registers in RAM with a MDIOS_MirrorTypeDef structure:
+        (##) Fill the Out registers and start the mirror with HAL_MDIOS_Mirror_Start(): all of
+             them are written to DOUTn, and only the write and error interrupts are enabled.
+        (##) On each write of the master, the interrupt copies the DINn registers written into
+             In and flags them. HAL_MDIOS_MirrorChangedCallback() is executed only on the first
+             change after the last HAL_MDIOS_Mirror_GetChanged(), which returns and clears the
+             bit map of the registers written.
+        (##) Update the Out registers with HAL_MDIOS_Mirror_SetReg() and write all of them at
+             once in DOUTn with HAL_MDIOS_Mirror_Commit(). The master reads are answered by the
+             hardware from DOUTn, without interrupt.
+        (##) Stop the mirror with HAL_MDIOS_Mirror_Stop().
+
     (#) Reset the MDIOS peripheral and all related resources by calling the HAL_MDIOS_DeInit() API.
         (##) HAL_MDIOS_MspDeInit() must be implemented to reset low level resources
             (GPIO, Clocks, NVIC configuration ...)
@@ -157,15 +169,16 @@
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
-#if (USE_HAL_MDIOS_REGISTER_CALLBACKS == 1)
 /** @defgroup MDIOS_Private_Functions MDIOS Private Functions
   * @{
   */
+#if (USE_HAL_MDIOS_REGISTER_CALLBACKS == 1)
 static void MDIOS_InitCallbacksToDefault(MDIOS_HandleTypeDef *hmdios);
+#endif /* USE_HAL_MDIOS_REGISTER_CALLBACKS */
+static void MDIOS_MirrorWrite(MDIOS_HandleTypeDef *hmdios);
 /**
   * @}
   */
-#endif /* USE_HAL_MDIOS_REGISTER_CALLBACKS */
 /* Private functions ---------------------------------------------------------*/
 /* Exported functions --------------------------------------------------------*/
 /** @defgroup MDIOS_Exported_Functions MDIOS Exported Functions
@@ -215,6 +228,8 @@ HAL_StatusTypeDef HAL_MDIOS_Init(MDIOS_HandleTypeDef *hmdios)
 
   if(hmdios->State == HAL_MDIOS_STATE_RESET)
   {
+    hmdios->pMirror = NULL;
+
     MDIOS_InitCallbacksToDefault(hmdios);
 
     if(hmdios->MspInitCallback == NULL)
@@ -230,6 +245,8 @@ HAL_StatusTypeDef HAL_MDIOS_Init(MDIOS_HandleTypeDef *hmdios)
 
   if(hmdios->State == HAL_MDIOS_STATE_RESET)
   {
+    hmdios->pMirror = NULL;
+
     /* Init the low level hardware */
     HAL_MDIOS_MspInit(hmdios);
   }
@@ -568,6 +585,12 @@ HAL_StatusTypeDef HAL_MDIOS_UnRegisterCallback(MDIOS_HandleTypeDef *hmdios, HAL_
         (+) HAL_MDIOS_ReadCpltCallback()
         (+) HAL_MDIOS_ErrorCallback()
 
+    (#) APIs of the register mirror:
+        (+) Start and stop the mirror: HAL_MDIOS_Mirror_Start(), HAL_MDIOS_Mirror_Stop()
+        (+) Update the DOUTn registers: HAL_MDIOS_Mirror_SetReg(), HAL_MDIOS_Mirror_Commit()
+        (+) Get the DINn registers written: HAL_MDIOS_Mirror_GetChanged()
+        (+) Lazy notification of the writes: HAL_MDIOS_MirrorChangedCallback()
+
 @endverbatim
   * @{
   */
@@ -725,8 +748,13 @@ void HAL_MDIOS_IRQHandler(MDIOS_HandleTypeDef *hmdios)
   /* Write Register Interrupt enabled ? */
   if(__HAL_MDIOS_GET_IT_SOURCE(hmdios, MDIOS_IT_WRITE) != (uint32_t)RESET)
   {
+    /* Register mirror: copy the registers written to RAM */
+    if(hmdios->pMirror != NULL)
+    {
+      MDIOS_MirrorWrite(hmdios);
+    }
     /* Write register flag */
-    if(HAL_MDIOS_GetWrittenRegAddress(hmdios) != (uint32_t)RESET)
+    else if(HAL_MDIOS_GetWrittenRegAddress(hmdios) != (uint32_t)RESET)
     {
 #if (USE_HAL_MDIOS_REGISTER_CALLBACKS == 1)
         /*Call registered Write complete callback*/
@@ -891,6 +919,184 @@ __weak void HAL_MDIOS_WakeUpCallback(MDIOS_HandleTypeDef *hmdios)
    */
 }
 
+/**
+  * @brief  Start the register mirror.
+  * @param  hmdios: mdios handle
+  * @param  pMirror: pointer to the mirror, its Out registers being filled with
+  *         the initial values of the DOUTn registers
+  * @note   The read interrupt is disabled: the master reads are answered by the
+  *         hardware and do not load the CPU.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_MDIOS_Mirror_Start(MDIOS_HandleTypeDef *hmdios, MDIOS_MirrorTypeDef *pMirror)
+{
+  __IO uint32_t *pdin = &hmdios->Instance->DINR0;
+  __IO uint32_t *pdout = &hmdios->Instance->DOUTR0;
+  uint32_t reg;
+
+  if(pMirror == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  if((hmdios->State != HAL_MDIOS_STATE_READY) || (hmdios->pMirror != NULL))
+  {
+    return HAL_BUSY;
+  }
+
+  /* Process Locked */
+  __HAL_LOCK(hmdios);
+
+  __HAL_MDIOS_DISABLE_IT(hmdios, (MDIOS_IT_WRITE | MDIOS_IT_READ));
+
+  for(reg = 0U; reg < 32U; reg++)
+  {
+    pdout[reg] = pMirror->Out[reg];
+    pMirror->In[reg] = (uint16_t)pdin[reg];
+  }
+  pMirror->OutPending = 0U;
+  pMirror->InChanged = 0U;
+  pMirror->WriteCount = 0U;
+
+  /* Start from clean flags */
+  hmdios->Instance->CWRFR = MDIOS_ALL_REG_FLAG;
+  hmdios->Instance->CRDFR = MDIOS_ALL_REG_FLAG;
+
+  hmdios->pMirror = pMirror;
+
+  __HAL_MDIOS_ENABLE_IT(hmdios, (MDIOS_IT_WRITE | MDIOS_IT_ERROR));
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(hmdios);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop the register mirror.
+  * @param  hmdios: mdios handle
+  * @note   The write, read and error interrupts are disabled, they can be enabled
+  *         again with HAL_MDIOS_EnableEvents().
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_MDIOS_Mirror_Stop(MDIOS_HandleTypeDef *hmdios)
+{
+  if(hmdios->pMirror == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Process Locked */
+  __HAL_LOCK(hmdios);
+
+  __HAL_MDIOS_DISABLE_IT(hmdios, (MDIOS_IT_WRITE | MDIOS_IT_READ | MDIOS_IT_ERROR));
+
+  hmdios->pMirror = NULL;
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(hmdios);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Update an output register of the mirror.
+  * @param  hmdios: mdios handle
+  * @param  RegNum: MDIOS output register address
+  * @param  Data: Data to write
+  * @note   The register is written to DOUTn by HAL_MDIOS_Mirror_Commit().
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_MDIOS_Mirror_SetReg(MDIOS_HandleTypeDef *hmdios, uint32_t RegNum, uint16_t Data)
+{
+  MDIOS_MirrorTypeDef *pmirror = hmdios->pMirror;
+
+  /* Check the parameters */
+  assert_param(IS_MDIOS_REGISTER(RegNum));
+
+  if(pmirror == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  pmirror->Out[RegNum] = Data;
+  pmirror->OutPending |= (1UL << RegNum);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Write the output registers updated since the last commit to DOUTn.
+  * @param  hmdios: mdios handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_MDIOS_Mirror_Commit(MDIOS_HandleTypeDef *hmdios)
+{
+  MDIOS_MirrorTypeDef *pmirror = hmdios->pMirror;
+  __IO uint32_t *pdout = &hmdios->Instance->DOUTR0;
+  uint32_t pending;
+  uint32_t reg;
+
+  if(pmirror == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  pending = pmirror->OutPending;
+  pmirror->OutPending = 0U;
+
+  while(pending != 0U)
+  {
+    reg = POSITION_VAL(pending);
+    pdout[reg] = pmirror->Out[reg];
+    pending &= ~(1UL << reg);
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Get and clear the bit map of the input registers written by the master.
+  * @param  hmdios: mdios handle
+  * @note   The values written are in the In registers of the mirror. The next
+  *         write of the master executes HAL_MDIOS_MirrorChangedCallback() again.
+  * @retval bit map of written registers addresses
+  */
+uint32_t HAL_MDIOS_Mirror_GetChanged(MDIOS_HandleTypeDef *hmdios)
+{
+  MDIOS_MirrorTypeDef *pmirror = hmdios->pMirror;
+  uint32_t changed;
+
+  if(pmirror == NULL)
+  {
+    return 0U;
+  }
+
+  /* Collect and clear the bit map without losing a concurrent write */
+  do
+  {
+    changed = __LDREXW(&pmirror->InChanged);
+  } while(__STREXW(0U, &pmirror->InChanged) != 0U);
+
+  return changed;
+}
+
+/**
+  * @brief  Register mirror changed callback, executed on the first write of the
+  *         master since the last HAL_MDIOS_Mirror_GetChanged().
+  * @param  hmdios: mdios handle
+  * @retval None
+  */
+__weak void HAL_MDIOS_MirrorChangedCallback(MDIOS_HandleTypeDef *hmdios)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hmdios);
+
+  /* NOTE : This function Should not be modified, when the callback is needed,
+            the HAL_MDIOS_MirrorChangedCallback could be implemented in the user file
+   */
+}
+
 /**
   * @}
   */
@@ -941,10 +1147,10 @@ HAL_MDIOS_StateTypeDef HAL_MDIOS_GetState(MDIOS_HandleTypeDef *hmdios)
   * @}
   */
 
-#if (USE_HAL_MDIOS_REGISTER_CALLBACKS == 1)
 /** @addtogroup MDIOS_Private_Functions
   * @{
   */
+#if (USE_HAL_MDIOS_REGISTER_CALLBACKS == 1)
 static void MDIOS_InitCallbacksToDefault(MDIOS_HandleTypeDef *hmdios)
 {
   /* Init the MDIOS Callback settings */
@@ -953,10 +1159,53 @@ static void MDIOS_InitCallbacksToDefault(MDIOS_HandleTypeDef *hmdios)
   hmdios->ErrorCallback      = HAL_MDIOS_ErrorCallback;       /* Legacy weak ErrorCallback */
   hmdios->WakeUpCallback     = HAL_MDIOS_WakeUpCallback;        /* Legacy weak WakeUpCallback   */
 }
+#endif /* USE_HAL_MDIOS_REGISTER_CALLBACKS */
+
+/**
+  * @brief  Copy the input registers written by the master to the mirror.
+  * @param  hmdios: mdios handle
+  * @note   Only the flags of the registers copied are cleared, so that a write
+  *         occurring meanwhile raises the interrupt again.
+  * @retval None
+  */
+static void MDIOS_MirrorWrite(MDIOS_HandleTypeDef *hmdios)
+{
+  MDIOS_MirrorTypeDef *pmirror = hmdios->pMirror;
+  __IO uint32_t *pdin = &hmdios->Instance->DINR0;
+  uint32_t written = hmdios->Instance->WRFR;
+  uint32_t pending = written;
+  uint32_t previous;
+  uint32_t reg;
+
+  if(written == 0U)
+  {
+    return;
+  }
+
+  hmdios->Instance->CWRFR = written;
+
+  while(pending != 0U)
+  {
+    reg = POSITION_VAL(pending);
+    pmirror->In[reg] = (uint16_t)pdin[reg];
+    pending &= ~(1UL << reg);
+    pmirror->WriteCount++;
+  }
+
+  do
+  {
+    previous = __LDREXW(&pmirror->InChanged);
+  } while(__STREXW(previous | written, &pmirror->InChanged) != 0U);
+
+  /* Lazy notification: the application collects all the changes at once */
+  if(previous == 0U)
+  {
+    HAL_MDIOS_MirrorChangedCallback(hmdios);
+  }
+}
 /**
   * @}
   */
-#endif /* USE_HAL_MDIOS_REGISTER_CALLBACKS */
 #endif /* HAL_MDIOS_MODULE_ENABLED */
 /**
   * @}
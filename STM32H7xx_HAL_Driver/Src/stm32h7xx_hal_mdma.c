@@ -83,6 +83,11 @@
           (+) Use HAL_MDMA_Start_IT() to start MDMA transfer after the configuration of
               Source address and destination address and the Length of data to be transferred. In this
               case the MDMA interrupt is configured.
+          (+) Use HAL_MDMA_ReArm_IT() to restart a completed single block transfer with new addresses
+              and block length, without the full reconfiguration done by HAL_MDMA_Start_IT()
+          (+) Use HAL_MDMAEx_Memcpy_Async() and HAL_MDMAEx_Memset_Async() to queue memory to memory
+              copy/fill requests on a channel dedicated to this service (see Group5 description),
+              then HAL_MDMAEx_Copy_PollForCompletion() or the request callback to wait for them
           (+) Use HAL_MDMA_IRQHandler() called under MDMA_IRQHandler() Interrupt subroutine
           (+) At the end of data transfer HAL_MDMA_IRQHandler() function is executed and user can
               add his own function by customization of function pointer XferCpltCallback and
@@ -178,6 +183,11 @@
   */
 static void MDMA_SetConfig(MDMA_HandleTypeDef *hmdma, uint32_t SrcAddress, uint32_t DstAddress, uint32_t BlockDataLength, uint32_t BlockCount);
 static void MDMA_Init(MDMA_HandleTypeDef *hmdma);
+static void MDMA_CopyStart(MDMA_HandleTypeDef *hmdma);
+static void MDMA_CopyFinish(MDMA_HandleTypeDef *hmdma, uint32_t State);
+static void MDMA_CopyCplt(MDMA_HandleTypeDef *hmdma);
+static void MDMA_CopyError(MDMA_HandleTypeDef *hmdma);
+static HAL_StatusTypeDef MDMA_CopySubmit(MDMA_HandleTypeDef *hmdma, MDMA_CopyRequestTypeDef *pReq);
 
 /**
   * @}
@@ -276,6 +286,10 @@ HAL_StatusTypeDef HAL_MDMA_Init(MDMA_HandleTypeDef *hmdma)
   hmdma->LastLinkedListNodeAddress   = 0;
   hmdma->LinkedListNodeCounter  = 0;
 
+  /* Reset the memory copy service queue */
+  hmdma->pCopyHead = NULL;
+  hmdma->pCopyTail = NULL;
+
   /* Initialize the error code */
   hmdma->ErrorCode = HAL_MDMA_ERROR_NONE;
 
@@ -323,6 +337,10 @@ HAL_StatusTypeDef HAL_MDMA_DeInit(MDMA_HandleTypeDef *hmdma)
   hmdma->LastLinkedListNodeAddress   = 0;
   hmdma->LinkedListNodeCounter  = 0;
 
+  /* Reset the memory copy service queue */
+  hmdma->pCopyHead = NULL;
+  hmdma->pCopyTail = NULL;
+
   /* Initialize the error code */
   hmdma->ErrorCode = HAL_MDMA_ERROR_NONE;
 
@@ -1200,6 +1218,82 @@ HAL_StatusTypeDef HAL_MDMA_Start_IT(MDMA_HandleTypeDef *hmdma, uint32_t SrcAddre
   return HAL_OK;
 }
 
+/**
+  * @brief  Re-arms the MDMA Transfer with interrupts enabled, keeping the
+  *         configuration of the previous HAL_MDMA_Start_IT() call.
+  * @note   Only the source address, the destination address and the block length are
+  *         written: the block count must be 1 and the addresses must stay on the same
+  *         buses (AXI or AHB/TCM) as in the previous transfer. Linked list transfers
+  *         are not supported. The previous transfer must be completed (MDMA state
+  *         ready).
+  * @note   Cycle budget: besides the handle lock and state updates, 3 register
+  *         writes (flag clear, CSAR, CDAR) and two read-modify-writes (CBNDTR, CCR),
+  *         one more for a software request, that is about 35 CPU cycles with zero
+  *         wait state accesses.
+  * @param  hmdma           : pointer to a MDMA_HandleTypeDef structure that contains
+  *                           the configuration information for the specified MDMA Channel.
+  * @param  SrcAddress      : The source memory Buffer address
+  * @param  DstAddress      : The destination memory Buffer address
+  * @param  BlockDataLength : The length of a block transfer in bytes
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_MDMA_ReArm_IT(MDMA_HandleTypeDef *hmdma, uint32_t SrcAddress, uint32_t DstAddress, uint32_t BlockDataLength)
+{
+  uint32_t itflags = MDMA_IT_TE | MDMA_IT_CTC;
+
+  /* Process locked */
+  __HAL_LOCK(hmdma);
+
+  if(HAL_MDMA_STATE_READY != hmdma->State)
+  {
+    /* Process unlocked */
+    __HAL_UNLOCK(hmdma);
+
+    /* Return error status */
+    return HAL_BUSY;
+  }
+
+  /* Change MDMA peripheral state */
+  hmdma->State = HAL_MDMA_STATE_BUSY;
+
+  /* Initialize the error code */
+  hmdma->ErrorCode = HAL_MDMA_ERROR_NONE;
+
+  /* Clear all interrupt flags */
+  __HAL_MDMA_CLEAR_FLAG(hmdma, MDMA_FLAG_TE | MDMA_FLAG_CTC | MDMA_CISR_BRTIF | MDMA_CISR_BTIF | MDMA_CISR_TCIF);
+
+  /* Configure the MDMA Channel data length, source and destination addresses */
+  MODIFY_REG(hmdma->Instance->CBNDTR, MDMA_CBNDTR_BNDT, (BlockDataLength & MDMA_CBNDTR_BNDT));
+  hmdma->Instance->CSAR = SrcAddress;
+  hmdma->Instance->CDAR = DstAddress;
+
+  if(hmdma->XferBlockCpltCallback != NULL)
+  {
+    itflags |= MDMA_IT_BT;
+  }
+
+  if(hmdma->XferRepeatBlockCpltCallback != NULL)
+  {
+    itflags |= MDMA_IT_BRT;
+  }
+
+  if(hmdma->XferBufferCpltCallback != NULL)
+  {
+    itflags |= MDMA_IT_BFTC;
+  }
+
+  /* Enable the interrupts disabled at the end of the previous transfer and the Peripheral */
+  hmdma->Instance->CCR |= itflags | MDMA_CCR_EN;
+
+  if(hmdma->Init.Request == MDMA_REQUEST_SW)
+  {
+    /* activate If SW request mode*/
+    hmdma->Instance->CCR |=  MDMA_CCR_SWRQ;
+  }
+
+  return HAL_OK;
+}
+
 /**
   * @brief  Aborts the MDMA Transfer.
   * @param  hmdma  : pointer to a MDMA_HandleTypeDef structure that contains
@@ -1735,6 +1829,172 @@ uint32_t HAL_MDMA_GetError(MDMA_HandleTypeDef *hmdma)
   return hmdma->ErrorCode;
 }
 
+/**
+  * @}
+  */
+
+/** @addtogroup MDMA_Exported_Functions_Group5
+ *
+@verbatim
+ ===============================================================================
+                    ##### Memory copy service functions #####
+ ===============================================================================
+    [..]
+    This subsection provides functions allowing to offload memory to memory copies
+    and fills to an MDMA channel, with the D-cache maintenance done by the driver:
+      (+) Queue a memory copy request
+      (+) Queue a memory fill request
+      (+) Wait for the completion of a request
+
+    [..]
+    The channel must be dedicated to the service and initialized with HAL_MDMA_Init()
+    using MDMA_REQUEST_SW, MDMA_BLOCK_TRANSFER and a BufferTransferLength multiple of
+    8 bytes (128 bytes is a good default), and its interrupt must be enabled. The data
+    sizes and increments are chosen by the service for each request from the alignment
+    of the addresses and of the size; any size is supported, transfers being split in
+    chunks of 64 Kbytes.
+
+    [..]
+    Requests are served in submission order. The XferCpltCallback and XferErrorCallback
+    of the handle are used by the service and must not be changed while requests are
+    pending.
+    Requests may be submitted from thread mode, from the request callbacks or from
+    interrupts whose priority is not higher than the MDMA interrupt one.
+
+    [..]
+    When the D-cache is enabled, the source lines are cleaned and the destination lines
+    are cleaned and invalidated at submission, then invalidated again at completion.
+    Lines are maintained as a whole: a destination that does not start and end on a
+    32-byte boundary must not share its first and last cache lines with data written by
+    the CPU while the request is pending.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Queue an asynchronous memory to memory copy.
+  * @param  hmdma: pointer to a MDMA_HandleTypeDef structure that contains
+  *               the configuration information for the specified MDMA Channel.
+  * @param  pReq:       pointer to the request descriptor, owned by the driver until done.
+  * @param  DstAddress: The destination memory Buffer address
+  * @param  SrcAddress: The source memory Buffer address
+  * @param  Size:       Number of bytes to be copied
+  * @note   The function returns as soon as the request is queued. pReq->State becomes
+  *         HAL_MDMA_COPY_STATE_DONE (or HAL_MDMA_COPY_STATE_ERROR) from the MDMA interrupt,
+  *         right before pReq->XferCpltCallback, if any, is called.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_MDMAEx_Memcpy_Async(MDMA_HandleTypeDef *hmdma, MDMA_CopyRequestTypeDef *pReq, uint32_t DstAddress, uint32_t SrcAddress, uint32_t Size)
+{
+  /* Check the parameters */
+  if((hmdma == NULL) || (pReq == NULL) || (Size == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  /* A request can only be queued once */
+  if(pReq->State == HAL_MDMA_COPY_STATE_PENDING)
+  {
+    return HAL_BUSY;
+  }
+
+  pReq->SrcAddress = SrcAddress;
+  pReq->DstAddress = DstAddress;
+  pReq->Size       = Size;
+
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  if((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+  {
+    /* Write back the source so that the MDMA reads the CPU view of it */
+    SCB_CleanDCache_by_Addr((uint32_t *)(SrcAddress & ~31U), (int32_t)(Size + (SrcAddress & 31U)));
+  }
+#endif /* __DCACHE_PRESENT */
+
+  return MDMA_CopySubmit(hmdma, pReq);
+}
+
+/**
+  * @brief  Queue an asynchronous memory fill.
+  * @param  hmdma: pointer to a MDMA_HandleTypeDef structure that contains
+  *               the configuration information for the specified MDMA Channel.
+  * @param  pReq:       pointer to the request descriptor, owned by the driver until done.
+  *                     The fill pattern is read from the descriptor itself, which must
+  *                     therefore be located in a memory reachable by the MDMA.
+  * @param  DstAddress: The destination memory Buffer address
+  * @param  Value:      Byte value written to the destination
+  * @param  Size:       Number of bytes to be written
+  * @note   Completion is reported as for HAL_MDMAEx_Memcpy_Async().
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_MDMAEx_Memset_Async(MDMA_HandleTypeDef *hmdma, MDMA_CopyRequestTypeDef *pReq, uint32_t DstAddress, uint8_t Value, uint32_t Size)
+{
+  /* Check the parameters */
+  if((hmdma == NULL) || (pReq == NULL) || (Size == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  /* A request can only be queued once */
+  if(pReq->State == HAL_MDMA_COPY_STATE_PENDING)
+  {
+    return HAL_BUSY;
+  }
+
+  pReq->Pattern[0] = (uint32_t)Value * 0x01010101U;
+  pReq->Pattern[1] = pReq->Pattern[0];
+  pReq->SrcAddress = (uint32_t)pReq->Pattern;
+  pReq->DstAddress = DstAddress;
+  pReq->Size       = Size;
+
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  if((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+  {
+    /* The pattern is fetched by the MDMA from the descriptor */
+    SCB_CleanDCache_by_Addr((uint32_t *)((uint32_t)pReq->Pattern & ~31U),
+                            (int32_t)(sizeof(pReq->Pattern) + ((uint32_t)pReq->Pattern & 31U)));
+  }
+#endif /* __DCACHE_PRESENT */
+
+  return MDMA_CopySubmit(hmdma, pReq);
+}
+
+/**
+  * @brief  Wait for the completion of a memory copy service request.
+  * @param  pReq:    pointer to a request queued with HAL_MDMAEx_Memcpy_Async() or
+  *                  HAL_MDMAEx_Memset_Async().
+  * @param  Timeout: Timeout duration in ms.
+  * @note   The request is completed from the MDMA interrupt: this function must not
+  *         be called with this interrupt masked.
+  * @retval HAL status: HAL_OK when done, HAL_ERROR if the request failed or was
+  *         never submitted, HAL_TIMEOUT if still pending after Timeout.
+  */
+HAL_StatusTypeDef HAL_MDMAEx_Copy_PollForCompletion(MDMA_CopyRequestTypeDef *pReq, uint32_t Timeout)
+{
+  uint32_t tickstart;
+
+  if(pReq == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Get tick number */
+  tickstart = HAL_GetTick();
+
+  while(pReq->State == HAL_MDMA_COPY_STATE_PENDING)
+  {
+    if(Timeout != HAL_MAX_DELAY)
+    {
+      if(((HAL_GetTick() - tickstart ) > Timeout) || (Timeout == 0U))
+      {
+        return HAL_TIMEOUT;
+      }
+    }
+  }
+
+  return (pReq->State == HAL_MDMA_COPY_STATE_DONE) ? HAL_OK : HAL_ERROR;
+}
+
 /**
   * @}
   */
@@ -1884,6 +2144,224 @@ static void MDMA_Init(MDMA_HandleTypeDef *hmdma)
   hmdma->Instance->CLAR =  0;
 }
 
+/**
+  * @brief  Append a prepared request to the copy service queue.
+  * @param  hmdma: pointer to a MDMA_HandleTypeDef structure that contains
+  *               the configuration information for the specified MDMA Channel.
+  * @param  pReq:  pointer to the request, with addresses and size already set.
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef MDMA_CopySubmit(MDMA_HandleTypeDef *hmdma, MDMA_CopyRequestTypeDef *pReq)
+{
+  uint32_t primask;
+  uint32_t idle;
+
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  if((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+  {
+    /* Write back dirty destination lines before the MDMA writes behind the cache,
+       and drop them so that no later eviction overwrites the transferred data */
+    SCB_CleanInvalidateDCache_by_Addr((uint32_t *)(pReq->DstAddress & ~31U),
+                                      (int32_t)(pReq->Size + (pReq->DstAddress & 31U)));
+  }
+#endif /* __DCACHE_PRESENT */
+
+  pReq->Offset = 0U;
+  pReq->pNext  = NULL;
+  pReq->State  = HAL_MDMA_COPY_STATE_PENDING;
+
+  /* The queue is also updated from the MDMA interrupt */
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  idle = (hmdma->pCopyHead == NULL) ? 1U : 0U;
+  if(idle != 0U)
+  {
+    hmdma->pCopyHead = pReq;
+  }
+  else
+  {
+    hmdma->pCopyTail->pNext = pReq;
+  }
+  hmdma->pCopyTail = pReq;
+
+  __set_PRIMASK(primask);
+
+  if(idle != 0U)
+  {
+    hmdma->XferCpltCallback  = MDMA_CopyCplt;
+    hmdma->XferErrorCallback = MDMA_CopyError;
+
+    MDMA_CopyStart(hmdma);
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Start the next chunk of the request at the head of the copy queue.
+  * @param  hmdma: pointer to a MDMA_HandleTypeDef structure that contains
+  *               the configuration information for the specified MDMA Channel.
+  * @note   Requests that cannot be started are completed in error and the
+  *         following ones are tried in turn.
+  * @retval None
+  */
+static void MDMA_CopyStart(MDMA_HandleTypeDef *hmdma)
+{
+  MDMA_CopyRequestTypeDef *pReq = hmdma->pCopyHead;
+  uint32_t src;
+  uint32_t dst;
+  uint32_t length;
+  uint32_t align;
+  uint32_t size;
+  uint32_t srcinc;
+
+  while(pReq != NULL)
+  {
+    src    = pReq->SrcAddress;
+    dst    = pReq->DstAddress + pReq->Offset;
+    length = pReq->Size - pReq->Offset;
+    srcinc = 1U;
+
+    /* The memset pattern is a fixed source */
+    if(src == (uint32_t)pReq->Pattern)
+    {
+      srcinc = 0U;
+    }
+    else
+    {
+      src += pReq->Offset;
+    }
+
+    if(length > 65536U)
+    {
+      length = 65536U;
+    }
+
+    /* Use the widest data size allowed by the addresses and the chunk length */
+    align = src | dst | length;
+    if((align & 7U) == 0U)
+    {
+      size = MDMA_SRC_DATASIZE_DOUBLEWORD | MDMA_DEST_DATASIZE_DOUBLEWORD | MDMA_SRC_INC_DOUBLEWORD | MDMA_DEST_INC_DOUBLEWORD;
+    }
+    else if((align & 3U) == 0U)
+    {
+      size = MDMA_SRC_DATASIZE_WORD | MDMA_DEST_DATASIZE_WORD | MDMA_SRC_INC_WORD | MDMA_DEST_INC_WORD;
+    }
+    else if((align & 1U) == 0U)
+    {
+      size = MDMA_SRC_DATASIZE_HALFWORD | MDMA_DEST_DATASIZE_HALFWORD | MDMA_SRC_INC_HALFWORD | MDMA_DEST_INC_HALFWORD;
+    }
+    else
+    {
+      size = MDMA_SRC_DATASIZE_BYTE | MDMA_DEST_DATASIZE_BYTE | MDMA_SRC_INC_BYTE | MDMA_DEST_INC_BYTE;
+    }
+
+    if(srcinc == 0U)
+    {
+      size &= ~(MDMA_CTCR_SINC | MDMA_CTCR_SINCOS);
+    }
+
+    MODIFY_REG(hmdma->Instance->CTCR,
+               MDMA_CTCR_SINC | MDMA_CTCR_SINCOS | MDMA_CTCR_DINC | MDMA_CTCR_DINCOS | MDMA_CTCR_SSIZE | MDMA_CTCR_DSIZE,
+               size);
+
+    if(HAL_MDMA_Start_IT(hmdma, src, dst, length, 1U) == HAL_OK)
+    {
+      return;
+    }
+
+    MDMA_CopyFinish(hmdma, HAL_MDMA_COPY_STATE_ERROR);
+    pReq = hmdma->pCopyHead;
+  }
+}
+
+/**
+  * @brief  Remove the request at the head of the copy queue and report it.
+  * @param  hmdma: pointer to a MDMA_HandleTypeDef structure that contains
+  *               the configuration information for the specified MDMA Channel.
+  * @param  State: final request state, HAL_MDMA_COPY_STATE_DONE or HAL_MDMA_COPY_STATE_ERROR
+  * @retval None
+  */
+static void MDMA_CopyFinish(MDMA_HandleTypeDef *hmdma, uint32_t State)
+{
+  MDMA_CopyRequestTypeDef *pReq = hmdma->pCopyHead;
+  uint32_t primask;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  hmdma->pCopyHead = pReq->pNext;
+  if(hmdma->pCopyHead == NULL)
+  {
+    hmdma->pCopyTail = NULL;
+  }
+
+  __set_PRIMASK(primask);
+
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  if((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+  {
+    /* Drop lines speculatively loaded while the MDMA was writing */
+    SCB_InvalidateDCache_by_Addr((uint32_t *)(pReq->DstAddress & ~31U),
+                                 (int32_t)(pReq->Size + (pReq->DstAddress & 31U)));
+  }
+#endif /* __DCACHE_PRESENT */
+
+  pReq->pNext = NULL;
+  pReq->State = State;
+
+  if(pReq->XferCpltCallback != NULL)
+  {
+    pReq->XferCpltCallback(pReq);
+  }
+}
+
+/**
+  * @brief  MDMA transfer complete callback of the copy service.
+  * @param  hmdma: pointer to a MDMA_HandleTypeDef structure that contains
+  *               the configuration information for the specified MDMA Channel.
+  * @retval None
+  */
+static void MDMA_CopyCplt(MDMA_HandleTypeDef *hmdma)
+{
+  MDMA_CopyRequestTypeDef *pReq = hmdma->pCopyHead;
+  uint32_t length;
+
+  if(pReq == NULL)
+  {
+    return;
+  }
+
+  length = pReq->Size - pReq->Offset;
+  pReq->Offset += (length > 65536U) ? 65536U : length;
+
+  if(pReq->Offset >= pReq->Size)
+  {
+    MDMA_CopyFinish(hmdma, HAL_MDMA_COPY_STATE_DONE);
+  }
+
+  MDMA_CopyStart(hmdma);
+}
+
+/**
+  * @brief  MDMA transfer error callback of the copy service.
+  * @param  hmdma: pointer to a MDMA_HandleTypeDef structure that contains
+  *               the configuration information for the specified MDMA Channel.
+  * @retval None
+  */
+static void MDMA_CopyError(MDMA_HandleTypeDef *hmdma)
+{
+  if(hmdma->pCopyHead == NULL)
+  {
+    return;
+  }
+
+  MDMA_CopyFinish(hmdma, HAL_MDMA_COPY_STATE_ERROR);
+
+  MDMA_CopyStart(hmdma);
+}
+
 /**
   * @}
   */
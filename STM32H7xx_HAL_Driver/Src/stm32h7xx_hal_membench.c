@@ -0,0 +1,1086 @@
+/**
+  ******************************************************************************
+  * @file    stm32h7xx_hal_membench.c
+  * @author  MCD Application Team
+  * @brief   Memory benchmark HAL module driver.
+             This file provides firmware functions to measure the bandwidth and
+             latency of the memories of the device, from the CPU and from the
+             DMA masters, alone or under contention:
+              + Memory region functions
+              + Benchmark functions
+
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  @verbatim
+ ===============================================================================
+                        ##### How to use this driver #####
+ ===============================================================================
+  [..]
+    The performance of a buffer depends on the memory it is placed in (TCM, AXI
+    SRAM, AHB SRAM, SRAM4, flash, external memories), on the bus master using it
+    and on the other masters sharing the same bus matrix. This driver measures
+    them with the DWT cycle counter, so that the placement of the buffers can be
+    chosen on figures. All the results are given in CPU cycles.
+
+    *** Memory regions ***
+    ======================
+    [..]
+     (#) HAL_MEMBENCH_GetRegion() gives the base address, the size and the
+         attributes of a MEMBENCH_REGION_xxx memory on the device, from the
+         definitions of the CMSIS device header (D1_AXISRAM_BASE, D2_AHBSRAM_BASE,
+         D3_SRAM_BASE...). It fails for a memory not available on the device or
+         not reachable from the core running the benchmark.
+     (#) The clock of the memory must be enabled by the application (for instance
+         __HAL_RCC_D2SRAM1_CLK_ENABLE()), the backup SRAM write access enabled
+         with HAL_PWR_EnableBkUpAccess(), and the external memories (FMC, QUADSPI,
+         OCTOSPI) initialized and memory-mapped, their size being then given by
+         the device connected.
+     (#) HAL_MEMBENCH_GetBandwidth() converts a number of bytes moved in a number
+         of cycles into kilobytes (1000 bytes) per second, from SystemCoreClock.
+
+    *** CPU benchmark ***
+    =====================
+    [..]
+     (#) Fill a MEMBENCH_CpuTypeDef structure with the tested area and the tests
+         to run, then call HAL_MEMBENCH_MeasureCpu():
+         (++) MEMBENCH_TEST_SEQ_READ and MEMBENCH_TEST_SEQ_WRITE read or write the
+              whole area in sequence, giving the bandwidth.
+         (++) MEMBENCH_TEST_RAND_READ reads one word per 32-byte line in a pseudo
+              random order, each address depending on the previous load. The
+              cycles per access give the load latency.
+         (++) MEMBENCH_TEST_RAND_WRITE writes one word per line in the same order.
+     (#) When the data cache is enabled, the area is cleaned and invalidated before
+         each test, so that the tests start from the memory and not from the cache,
+         and the write tests include the clean of the written lines. An area larger
+         than the data cache measures the memory, a smaller one the cache for the
+         next accesses.
+
+    *** DMA benchmark ***
+    =====================
+    [..]
+     (#) Initialize a DMA1, DMA2 or BDMA channel in memory to memory mode with
+         HAL_DMA_Init(), or an MDMA channel for software triggered block
+         transfers with HAL_MDMA_Init().
+     (#) Fill a MEMBENCH_TransferTypeDef structure with the channel handle, the
+         source and destination buffers and the size, then call
+         HAL_MEMBENCH_MeasureDma(). The Cycles field gives the duration of the
+         transfer, from its start to the end of the polling.
+     (#) The DMA1 and DMA2 masters cannot reach the TCMs and the BDMA only reaches
+         the D3 domain memories, see MEMBENCH_REGION_ATTR_NO_DMA and
+         MEMBENCH_REGION_ATTR_NO_BDMA. The MDMA reaches all the regions.
+
+    *** Contention benchmark ***
+    ============================
+    [..]
+     (#) Enable the interrupt of each DMA or MDMA channel and call
+         HAL_DMA_IRQHandler() or HAL_MDMA_IRQHandler() from its IRQ handler.
+     (#) Fill a MEMBENCH_ContentionTypeDef structure with the CPU tests and up to
+         MEMBENCH_MAX_TRANSFERS transfers, then call HAL_MEMBENCH_MeasureContention().
+         The transfers are started in interrupt mode and restarted from their
+         transfer complete callback while the CPU tests run. The Cpu results
+         then give the CPU performance under load, to be compared with the
+         results of HAL_MEMBENCH_MeasureCpu() alone, and the Transfers field of
+         each transfer the number of transfers it completed in Cycles cycles.
+     (#) The transfer complete callbacks of the channels are replaced during the
+         measurement and restored afterwards.
+
+    *** Notes ***
+    =============
+    [..]
+     (#) The interrupts of the application are counted in the measured cycles.
+     (#) The write tests and the transfers overwrite the tested areas. Only use
+         MEMBENCH_TEST_READ on the read-only regions (MEMBENCH_REGION_ATTR_READONLY).
+     (#) The DWT cycle counter is enabled if not already done by a debugger.
+
+  @endverbatim
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32h7xx_hal.h"
+
+/** @addtogroup STM32H7xx_HAL_Driver
+  * @{
+  */
+
+/** @defgroup MEMBENCH MEMBENCH
+  * @brief Memory benchmark HAL module driver
+  * @{
+  */
+
+#ifdef HAL_MEMBENCH_MODULE_ENABLED
+
+/**
+  @cond 0
+  */
+/* Private typedef -----------------------------------------------------------*/
+
+/* Private define ------------------------------------------------------------*/
+#define MEMBENCH_LCG_MULTIPLIER           1664525U      /*!< Full period modulo any power of 2            */
+#define MEMBENCH_LCG_INCREMENT            1013904223U   /*!< Odd increment                                */
+#define MEMBENCH_DMA_MAX_ITEMS            65535U        /*!< DMA1, DMA2 and BDMA data items limit         */
+#define MEMBENCH_FMC_NOR_SRAM_BASE        0x60000000UL  /*!< FMC bank 1, NOR/PSRAM/SRAM                   */
+#define MEMBENCH_FMC_SDRAM_BASE           0xC0000000UL  /*!< FMC SDRAM bank 1, default mapping            */
+
+/* Private macro -------------------------------------------------------------*/
+
+/* Private variables ---------------------------------------------------------*/
+static MEMBENCH_ContentionTypeDef *volatile MEMBENCH_pContention = NULL; /*!< Contention benchmark running */
+static __IO uint32_t MEMBENCH_Sink;                                      /*!< Keeps the loaded values alive */
+static __IO uint32_t MEMBENCH_ZeroMask = 0U;                             /*!< Makes each random load depend
+                                                                              on the previous one          */
+
+/* Private function prototypes -----------------------------------------------*/
+static void              MEMBENCH_EnableCycleCounter(void);
+static void              MEMBENCH_FlushArea(uint32_t Address, uint32_t Size);
+static void              MEMBENCH_CleanArea(uint32_t Address, uint32_t Size);
+static void              MEMBENCH_RunCpu(MEMBENCH_CpuTypeDef *pCpu);
+static uint32_t          MEMBENCH_SeqRead(uint32_t Address, uint32_t Size);
+static uint32_t          MEMBENCH_SeqWrite(uint32_t Address, uint32_t Size);
+static uint32_t          MEMBENCH_RandRead(uint32_t Address, uint32_t Lines);
+static uint32_t          MEMBENCH_RandWrite(uint32_t Address, uint32_t Lines);
+static HAL_StatusTypeDef MEMBENCH_CheckCpu(const MEMBENCH_CpuTypeDef *pCpu);
+static HAL_StatusTypeDef MEMBENCH_CheckTransfer(const MEMBENCH_TransferTypeDef *pTransfer);
+static HAL_StatusTypeDef MEMBENCH_StartTransfer(MEMBENCH_TransferTypeDef *pTransfer, uint32_t Interrupt);
+static HAL_StatusTypeDef MEMBENCH_WaitTransfer(MEMBENCH_TransferTypeDef *pTransfer, uint32_t Interrupt, uint32_t Timeout);
+#if defined(HAL_DMA_MODULE_ENABLED)
+static void              MEMBENCH_DmaCpltCallback(DMA_HandleTypeDef *hdma);
+#endif /* HAL_DMA_MODULE_ENABLED */
+#if defined(HAL_MDMA_MODULE_ENABLED)
+static void              MEMBENCH_MdmaCpltCallback(MDMA_HandleTypeDef *hmdma);
+#endif /* HAL_MDMA_MODULE_ENABLED */
+/**
+  @endcond
+  */
+
+/* Exported functions --------------------------------------------------------*/
+
+/** @defgroup MEMBENCH_Exported_Functions MEMBENCH Exported Functions
+  * @{
+  */
+
+/** @defgroup MEMBENCH_Exported_Functions_Group1 Memory region functions
+  *  @brief    Memory region functions
+  *
+@verbatim
+ ===============================================================================
+                    ##### Memory region functions #####
+ ===============================================================================
+    [..]
+    This subsection provides a set of functions allowing to :
+      (+) Get the base address, size and attributes of a memory region.
+      (+) Convert the measured cycles into a bandwidth.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Get a memory region of the device.
+  * @param  Region Memory region, a value of @ref MEMBENCH_Regions
+  * @param  pRegion Filled with the base address, size and attributes of the region
+  * @retval HAL status, HAL_ERROR when the region is not available on the device
+  *         or not reachable from the core
+  */
+HAL_StatusTypeDef HAL_MEMBENCH_GetRegion(uint32_t Region, MEMBENCH_RegionTypeDef *pRegion)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+
+  if (pRegion == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the parameters */
+  assert_param(IS_MEMBENCH_REGION(Region));
+
+  pRegion->BaseAddress = 0U;
+  pRegion->Size        = 0U;
+  pRegion->Attributes  = MEMBENCH_REGION_ATTR_NO_BDMA;
+
+  switch (Region)
+  {
+#if !defined(CORE_CM4)
+    case MEMBENCH_REGION_ITCM:
+#if defined(CD_ITCMRAM_BASE)
+      pRegion->BaseAddress = CD_ITCMRAM_BASE;
+#else
+      pRegion->BaseAddress = D1_ITCMRAM_BASE;
+#endif /* CD_ITCMRAM_BASE */
+      pRegion->Size        = 0x10000U;
+      pRegion->Attributes  = MEMBENCH_REGION_ATTR_NO_DMA | MEMBENCH_REGION_ATTR_NO_BDMA;
+      break;
+
+    case MEMBENCH_REGION_DTCM:
+#if defined(CD_DTCMRAM_BASE)
+      pRegion->BaseAddress = CD_DTCMRAM_BASE;
+#else
+      pRegion->BaseAddress = D1_DTCMRAM_BASE;
+#endif /* CD_DTCMRAM_BASE */
+      pRegion->Size        = 0x20000U;
+      pRegion->Attributes  = MEMBENCH_REGION_ATTR_NO_DMA | MEMBENCH_REGION_ATTR_NO_BDMA;
+      break;
+#endif /* !CORE_CM4 */
+
+#if defined(CD_AXISRAM3_BASE)         /* STM32H7Axxx and STM32H7Bxxx lines */
+    case MEMBENCH_REGION_AXISRAM1:
+      pRegion->BaseAddress = CD_AXISRAM1_BASE;
+      pRegion->Size        = 0x40000U;
+      break;
+
+    case MEMBENCH_REGION_AXISRAM2:
+      pRegion->BaseAddress = CD_AXISRAM2_BASE;
+      pRegion->Size        = 0x60000U;
+      break;
+
+    case MEMBENCH_REGION_AXISRAM3:
+      pRegion->BaseAddress = CD_AXISRAM3_BASE;
+      pRegion->Size        = 0x60000U;
+      break;
+
+    case MEMBENCH_REGION_SRAM1:
+      pRegion->BaseAddress = CD_AHBSRAM1_BASE;
+      pRegion->Size        = 0x10000U;
+      break;
+
+    case MEMBENCH_REGION_SRAM2:
+      pRegion->BaseAddress = CD_AHBSRAM2_BASE;
+      pRegion->Size        = 0x10000U;
+      break;
+
+    case MEMBENCH_REGION_SRAM4:
+      pRegion->BaseAddress = SRD_SRAM_BASE;
+      pRegion->Size        = 0x8000U;
+      pRegion->Attributes  = MEMBENCH_REGION_ATTR_NONE;
+      break;
+
+    case MEMBENCH_REGION_BKPSRAM:
+      pRegion->BaseAddress = SRD_BKPSRAM_BASE;
+      pRegion->Size        = 0x1000U;
+      pRegion->Attributes  = MEMBENCH_REGION_ATTR_NONE;
+      break;
+#elif defined(D1_AXISRAM2_BASE)       /* STM32H72xxx and STM32H73xxx lines */
+    case MEMBENCH_REGION_AXISRAM1:
+      pRegion->BaseAddress = D1_AXISRAM1_BASE;
+      pRegion->Size        = 0x20000U;
+      break;
+
+    case MEMBENCH_REGION_AXISRAM2:
+      /* Shared with the ITCM, size of the default TCM_AXI_SHARED option */
+      pRegion->BaseAddress = D1_AXISRAM2_BASE;
+      pRegion->Size        = 0x30000U;
+      break;
+
+    case MEMBENCH_REGION_SRAM1:
+      pRegion->BaseAddress = D2_AHBSRAM1_BASE;
+      pRegion->Size        = 0x4000U;
+      break;
+
+    case MEMBENCH_REGION_SRAM2:
+      pRegion->BaseAddress = D2_AHBSRAM2_BASE;
+      pRegion->Size        = 0x4000U;
+      break;
+
+    case MEMBENCH_REGION_SRAM4:
+      pRegion->BaseAddress = D3_SRAM_BASE;
+      pRegion->Size        = 0x4000U;
+      pRegion->Attributes  = MEMBENCH_REGION_ATTR_NONE;
+      break;
+
+    case MEMBENCH_REGION_BKPSRAM:
+      pRegion->BaseAddress = D3_BKPSRAM_BASE;
+      pRegion->Size        = 0x1000U;
+      pRegion->Attributes  = MEMBENCH_REGION_ATTR_NONE;
+      break;
+#else                                 /* STM32H74xxx and STM32H75xxx lines */
+    case MEMBENCH_REGION_AXISRAM1:
+      pRegion->BaseAddress = D1_AXISRAM_BASE;
+      pRegion->Size        = 0x80000U;
+      break;
+
+    case MEMBENCH_REGION_SRAM1:
+      pRegion->BaseAddress = D2_AHBSRAM_BASE;
+      pRegion->Size        = 0x20000U;
+      break;
+
+    case MEMBENCH_REGION_SRAM2:
+      pRegion->BaseAddress = D2_AHBSRAM_BASE + 0x20000U;
+      pRegion->Size        = 0x20000U;
+      break;
+
+    case MEMBENCH_REGION_SRAM3:
+      pRegion->BaseAddress = D2_AHBSRAM_BASE + 0x40000U;
+      pRegion->Size        = 0x8000U;
+      break;
+
+    case MEMBENCH_REGION_SRAM4:
+      pRegion->BaseAddress = D3_SRAM_BASE;
+      pRegion->Size        = 0x10000U;
+      pRegion->Attributes  = MEMBENCH_REGION_ATTR_NONE;
+      break;
+
+    case MEMBENCH_REGION_BKPSRAM:
+      pRegion->BaseAddress = D3_BKPSRAM_BASE;
+      pRegion->Size        = 0x1000U;
+      pRegion->Attributes  = MEMBENCH_REGION_ATTR_NONE;
+      break;
+#endif /* CD_AXISRAM3_BASE */
+
+    case MEMBENCH_REGION_FLASH:
+      pRegion->BaseAddress = FLASH_BANK1_BASE;
+      pRegion->Size        = FLASH_SIZE;
+      pRegion->Attributes  = MEMBENCH_REGION_ATTR_READONLY | MEMBENCH_REGION_ATTR_NO_BDMA;
+      break;
+
+    case MEMBENCH_REGION_XSPI1:
+#if defined(QSPI_BASE)
+      pRegion->BaseAddress = QSPI_BASE;
+#else
+      pRegion->BaseAddress = OCTOSPI1_BASE;
+#endif /* QSPI_BASE */
+      pRegion->Attributes  = MEMBENCH_REGION_ATTR_EXTERNAL | MEMBENCH_REGION_ATTR_NO_BDMA;
+      break;
+
+#if defined(OCTOSPI2_BASE)
+    case MEMBENCH_REGION_XSPI2:
+      pRegion->BaseAddress = OCTOSPI2_BASE;
+      pRegion->Attributes  = MEMBENCH_REGION_ATTR_EXTERNAL | MEMBENCH_REGION_ATTR_NO_BDMA;
+      break;
+#endif /* OCTOSPI2_BASE */
+
+    case MEMBENCH_REGION_FMC_NOR_SRAM:
+      pRegion->BaseAddress = MEMBENCH_FMC_NOR_SRAM_BASE;
+      pRegion->Attributes  = MEMBENCH_REGION_ATTR_EXTERNAL | MEMBENCH_REGION_ATTR_NO_BDMA;
+      break;
+
+    case MEMBENCH_REGION_FMC_SDRAM:
+      pRegion->BaseAddress = MEMBENCH_FMC_SDRAM_BASE;
+      pRegion->Attributes  = MEMBENCH_REGION_ATTR_EXTERNAL | MEMBENCH_REGION_ATTR_NO_BDMA;
+      break;
+
+    default:
+      /* Region not available on the device or from this core */
+      pRegion->Attributes  = MEMBENCH_REGION_ATTR_NONE;
+      status = HAL_ERROR;
+      break;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Convert a number of bytes moved in a number of CPU cycles into a bandwidth.
+  * @param  Bytes Number of bytes read, written or transferred
+  * @param  Cycles Number of CPU cycles it took
+  * @retval Bandwidth in kilobytes (1000 bytes) per second, 0 when Cycles is 0
+  */
+uint32_t HAL_MEMBENCH_GetBandwidth(uint32_t Bytes, uint32_t Cycles)
+{
+  if (Cycles == 0U)
+  {
+    return 0U;
+  }
+
+  return (uint32_t)(((uint64_t)Bytes * (SystemCoreClock / 1000U)) / Cycles);
+}
+
+/**
+  * @}
+  */
+
+/** @defgroup MEMBENCH_Exported_Functions_Group2 Benchmark functions
+  *  @brief    Benchmark functions
+  *
+@verbatim
+ ===============================================================================
+                      ##### Benchmark functions #####
+ ===============================================================================
+    [..]
+    This subsection provides a set of functions allowing to :
+      (+) Measure the CPU bandwidth and latency of a memory area.
+      (+) Measure the duration of a DMA, BDMA or MDMA transfer.
+      (+) Measure the CPU bandwidth and latency while DMA masters load the buses.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Measure the CPU sequential and random accesses cycles of a memory area.
+  * @param  pCpu CPU benchmark, filled with the measured cycles.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_MEMBENCH_MeasureCpu(MEMBENCH_CpuTypeDef *pCpu)
+{
+  if (MEMBENCH_CheckCpu(pCpu) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  MEMBENCH_EnableCycleCounter();
+
+  MEMBENCH_RunCpu(pCpu);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Measure the cycles of a DMA, BDMA or MDMA transfer between two buffers.
+  * @param  pTransfer Transfer, its Cycles field being filled with the measured cycles.
+  * @param  Timeout Timeout duration of the transfer.
+  * @note   When the data cache is enabled, the source is cleaned and the
+  *         destination cleaned and invalidated before the transfer.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_MEMBENCH_MeasureDma(MEMBENCH_TransferTypeDef *pTransfer, uint32_t Timeout)
+{
+  uint32_t start;
+  HAL_StatusTypeDef status;
+
+  if (MEMBENCH_CheckTransfer(pTransfer) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  MEMBENCH_EnableCycleCounter();
+
+  pTransfer->Cycles = 0U;
+
+  MEMBENCH_CleanArea((uint32_t)pTransfer->pSrc, pTransfer->Size);
+  MEMBENCH_FlushArea((uint32_t)pTransfer->pDst, pTransfer->Size);
+
+  start = DWT->CYCCNT;
+  status = MEMBENCH_StartTransfer(pTransfer, 0U);
+  if (status == HAL_OK)
+  {
+    status = MEMBENCH_WaitTransfer(pTransfer, 0U, Timeout);
+  }
+  pTransfer->Cycles = DWT->CYCCNT - start;
+
+  return status;
+}
+
+/**
+  * @brief  Measure the CPU accesses cycles of a memory area while DMA transfers run.
+  * @param  pContention Contention benchmark, filled with the measured cycles and
+  *         the number of transfers completed.
+  * @param  Timeout Timeout duration of the last transfer of each channel, once
+  *         the CPU tests are done.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_MEMBENCH_MeasureContention(MEMBENCH_ContentionTypeDef *pContention, uint32_t Timeout)
+{
+#if defined(HAL_DMA_MODULE_ENABLED)
+  void (* DmaCallback[MEMBENCH_MAX_TRANSFERS])(DMA_HandleTypeDef *hdma);
+#endif /* HAL_DMA_MODULE_ENABLED */
+#if defined(HAL_MDMA_MODULE_ENABLED)
+  void (* MdmaCallback[MEMBENCH_MAX_TRANSFERS])(MDMA_HandleTypeDef *hmdma);
+#endif /* HAL_MDMA_MODULE_ENABLED */
+  MEMBENCH_TransferTypeDef *pTransfer;
+  HAL_StatusTypeDef status = HAL_OK;
+  uint32_t index;
+  uint32_t started = 0U;
+  uint32_t start;
+
+  if ((pContention == NULL) || (pContention->NbTransfers > MEMBENCH_MAX_TRANSFERS) ||
+      (MEMBENCH_CheckCpu(&pContention->Cpu) != HAL_OK))
+  {
+    return HAL_ERROR;
+  }
+
+  for (index = 0U; index < pContention->NbTransfers; index++)
+  {
+    if (MEMBENCH_CheckTransfer(&pContention->Transfer[index]) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  /* A single contention benchmark at a time, the callbacks using it */
+  if (MEMBENCH_pContention != NULL)
+  {
+    return HAL_BUSY;
+  }
+
+  MEMBENCH_EnableCycleCounter();
+
+  pContention->Cycles = 0U;
+  MEMBENCH_pContention = pContention;
+
+  /* Start the transfers, restarted from their transfer complete callback */
+  for (index = 0U; (index < pContention->NbTransfers) && (status == HAL_OK); index++)
+  {
+    pTransfer = &pContention->Transfer[index];
+    pTransfer->Cycles    = 0U;
+    pTransfer->Transfers = 0U;
+
+#if defined(HAL_DMA_MODULE_ENABLED)
+    if (pTransfer->hdma != NULL)
+    {
+      DmaCallback[index] = pTransfer->hdma->XferCpltCallback;
+      pTransfer->hdma->XferCpltCallback = MEMBENCH_DmaCpltCallback;
+    }
+#endif /* HAL_DMA_MODULE_ENABLED */
+#if defined(HAL_MDMA_MODULE_ENABLED)
+    if (pTransfer->hmdma != NULL)
+    {
+      MdmaCallback[index] = pTransfer->hmdma->XferCpltCallback;
+      pTransfer->hmdma->XferCpltCallback = MEMBENCH_MdmaCpltCallback;
+    }
+#endif /* HAL_MDMA_MODULE_ENABLED */
+
+    status = MEMBENCH_StartTransfer(pTransfer, 1U);
+    started++;
+  }
+
+  if (status == HAL_OK)
+  {
+    /* CPU tests under load */
+    start = DWT->CYCCNT;
+    MEMBENCH_RunCpu(&pContention->Cpu);
+    pContention->Cycles = DWT->CYCCNT - start;
+  }
+
+  /* Stop restarting the transfers, then wait for the running ones */
+  MEMBENCH_pContention = NULL;
+
+  for (index = 0U; index < started; index++)
+  {
+    pTransfer = &pContention->Transfer[index];
+
+    if (MEMBENCH_WaitTransfer(pTransfer, 1U, Timeout) != HAL_OK)
+    {
+      status = HAL_TIMEOUT;
+    }
+
+#if defined(HAL_DMA_MODULE_ENABLED)
+    if (pTransfer->hdma != NULL)
+    {
+      pTransfer->hdma->XferCpltCallback = DmaCallback[index];
+    }
+#endif /* HAL_DMA_MODULE_ENABLED */
+#if defined(HAL_MDMA_MODULE_ENABLED)
+    if (pTransfer->hmdma != NULL)
+    {
+      pTransfer->hmdma->XferCpltCallback = MdmaCallback[index];
+    }
+#endif /* HAL_MDMA_MODULE_ENABLED */
+  }
+
+  return status;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/** @defgroup MEMBENCH_Private_Functions MEMBENCH Private Functions
+  * @{
+  */
+
+/**
+  * @brief  Enable the DWT cycle counter if not already done by a debugger.
+  * @retval None
+  */
+static void MEMBENCH_EnableCycleCounter(void)
+{
+  if ((DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk) == 0U)
+  {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0U;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+  }
+}
+
+/**
+  * @brief  Clean and invalidate an area in the data cache, if enabled.
+  * @param  Address First address of the area, aligned on 32 bytes
+  * @param  Size Size of the area in bytes, multiple of 32 bytes
+  * @retval None
+  */
+static void MEMBENCH_FlushArea(uint32_t Address, uint32_t Size)
+{
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  if ((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+  {
+    SCB_CleanInvalidateDCache_by_Addr((uint32_t *)Address, (int32_t)Size);
+  }
+#else
+  UNUSED(Address);
+  UNUSED(Size);
+#endif /* __DCACHE_PRESENT */
+}
+
+/**
+  * @brief  Clean an area in the data cache, if enabled.
+  * @param  Address First address of the area, aligned on 32 bytes
+  * @param  Size Size of the area in bytes, multiple of 32 bytes
+  * @retval None
+  */
+static void MEMBENCH_CleanArea(uint32_t Address, uint32_t Size)
+{
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  if ((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+  {
+    SCB_CleanDCache_by_Addr((uint32_t *)Address, (int32_t)Size);
+  }
+#else
+  UNUSED(Address);
+  UNUSED(Size);
+#endif /* __DCACHE_PRESENT */
+}
+
+/**
+  * @brief  Run the CPU tests of a CPU benchmark.
+  * @param  pCpu CPU benchmark, checked by MEMBENCH_CheckCpu()
+  * @retval None
+  */
+static void MEMBENCH_RunCpu(MEMBENCH_CpuTypeDef *pCpu)
+{
+  uint32_t lines;
+
+  /* Largest power of 2 number of lines within the area */
+  lines = 1UL << (31U - (uint32_t)__CLZ(pCpu->Size / MEMBENCH_LINE_SIZE));
+
+  pCpu->SeqReadCycles   = 0U;
+  pCpu->SeqWriteCycles  = 0U;
+  pCpu->RandReadCycles  = 0U;
+  pCpu->RandWriteCycles = 0U;
+  pCpu->RandAccesses    = 0U;
+
+  if ((pCpu->Tests & MEMBENCH_TEST_SEQ_READ) != 0U)
+  {
+    MEMBENCH_FlushArea(pCpu->Address, pCpu->Size);
+    pCpu->SeqReadCycles = MEMBENCH_SeqRead(pCpu->Address, pCpu->Size);
+  }
+
+  if ((pCpu->Tests & MEMBENCH_TEST_SEQ_WRITE) != 0U)
+  {
+    MEMBENCH_FlushArea(pCpu->Address, pCpu->Size);
+    pCpu->SeqWriteCycles = MEMBENCH_SeqWrite(pCpu->Address, pCpu->Size);
+  }
+
+  if ((pCpu->Tests & MEMBENCH_TEST_RAND_READ) != 0U)
+  {
+    MEMBENCH_FlushArea(pCpu->Address, pCpu->Size);
+    pCpu->RandReadCycles = MEMBENCH_RandRead(pCpu->Address, lines);
+    pCpu->RandAccesses   = lines;
+  }
+
+  if ((pCpu->Tests & MEMBENCH_TEST_RAND_WRITE) != 0U)
+  {
+    MEMBENCH_FlushArea(pCpu->Address, pCpu->Size);
+    pCpu->RandWriteCycles = MEMBENCH_RandWrite(pCpu->Address, lines);
+    pCpu->RandAccesses    = lines;
+  }
+}
+
+/**
+  * @brief  Read an area in sequence, eight words at a time.
+  * @param  Address First address of the area
+  * @param  Size Size of the area in bytes, multiple of 32 bytes
+  * @retval Cycles of the read
+  */
+static uint32_t MEMBENCH_SeqRead(uint32_t Address, uint32_t Size)
+{
+  const uint32_t *pWord = (const uint32_t *)Address;
+  const uint32_t *pEnd  = (const uint32_t *)(Address + Size);
+  uint32_t sum = 0U;
+  uint32_t start;
+  uint32_t cycles;
+
+  __DSB();
+  start = DWT->CYCCNT;
+  while (pWord < pEnd)
+  {
+    sum += pWord[0] + pWord[1] + pWord[2] + pWord[3] + pWord[4] + pWord[5] + pWord[6] + pWord[7];
+    pWord = &pWord[8];
+  }
+  __DSB();
+  cycles = DWT->CYCCNT - start;
+
+  MEMBENCH_Sink = sum;
+
+  return cycles;
+}
+
+/**
+  * @brief  Write an area in sequence, eight words at a time.
+  * @note   The written lines are cleaned from the data cache within the
+  *         measurement, so that the data reaches the memory.
+  * @param  Address First address of the area
+  * @param  Size Size of the area in bytes, multiple of 32 bytes
+  * @retval Cycles of the write
+  */
+static uint32_t MEMBENCH_SeqWrite(uint32_t Address, uint32_t Size)
+{
+  uint32_t *pWord = (uint32_t *)Address;
+  const uint32_t *pEnd = (const uint32_t *)(Address + Size);
+  uint32_t start;
+  uint32_t cycles;
+
+  __DSB();
+  start = DWT->CYCCNT;
+  while (pWord < pEnd)
+  {
+    pWord[0] = Address;
+    pWord[1] = Address;
+    pWord[2] = Address;
+    pWord[3] = Address;
+    pWord[4] = Address;
+    pWord[5] = Address;
+    pWord[6] = Address;
+    pWord[7] = Address;
+    pWord = &pWord[8];
+  }
+  MEMBENCH_CleanArea(Address, Size);
+  __DSB();
+  cycles = DWT->CYCCNT - start;
+
+  return cycles;
+}
+
+/**
+  * @brief  Read one word per line in a pseudo random order, each line index
+  *         depending on the word read before.
+  * @note   The linear congruential generator visits each of the Lines lines
+  *         once, Lines being a power of 2.
+  * @param  Address First address of the area
+  * @param  Lines Number of 32-byte lines of the area, power of 2
+  * @retval Cycles of the reads
+  */
+static uint32_t MEMBENCH_RandRead(uint32_t Address, uint32_t Lines)
+{
+  uint32_t mask = MEMBENCH_ZeroMask;
+  uint32_t index = 0U;
+  uint32_t value;
+  uint32_t count;
+  uint32_t start;
+  uint32_t cycles;
+
+  __DSB();
+  start = DWT->CYCCNT;
+  for (count = Lines; count > 0U; count--)
+  {
+    value = *(const uint32_t *)(Address + (index * MEMBENCH_LINE_SIZE));
+    index = ((index * MEMBENCH_LCG_MULTIPLIER) + MEMBENCH_LCG_INCREMENT + (value & mask)) & (Lines - 1U);
+  }
+  __DSB();
+  cycles = DWT->CYCCNT - start;
+
+  MEMBENCH_Sink = index;
+
+  return cycles;
+}
+
+/**
+  * @brief  Write one word per line in a pseudo random order.
+  * @note   The written lines are cleaned from the data cache within the
+  *         measurement, so that the data reaches the memory.
+  * @param  Address First address of the area
+  * @param  Lines Number of 32-byte lines of the area, power of 2
+  * @retval Cycles of the writes
+  */
+static uint32_t MEMBENCH_RandWrite(uint32_t Address, uint32_t Lines)
+{
+  uint32_t index = 0U;
+  uint32_t count;
+  uint32_t start;
+  uint32_t cycles;
+
+  __DSB();
+  start = DWT->CYCCNT;
+  for (count = Lines; count > 0U; count--)
+  {
+    *(uint32_t *)(Address + (index * MEMBENCH_LINE_SIZE)) = index;
+    index = ((index * MEMBENCH_LCG_MULTIPLIER) + MEMBENCH_LCG_INCREMENT) & (Lines - 1U);
+  }
+  MEMBENCH_CleanArea(Address, Lines * MEMBENCH_LINE_SIZE);
+  __DSB();
+  cycles = DWT->CYCCNT - start;
+
+  return cycles;
+}
+
+/**
+  * @brief  Check the parameters of a CPU benchmark.
+  * @param  pCpu CPU benchmark
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef MEMBENCH_CheckCpu(const MEMBENCH_CpuTypeDef *pCpu)
+{
+  if (pCpu == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the parameters */
+  assert_param(IS_MEMBENCH_TESTS(pCpu->Tests));
+
+  if (((pCpu->Address % MEMBENCH_LINE_SIZE) != 0U) || ((pCpu->Size % MEMBENCH_LINE_SIZE) != 0U) ||
+      (pCpu->Size < MEMBENCH_MIN_SIZE) || (IS_MEMBENCH_TESTS(pCpu->Tests) == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Check the parameters of a transfer.
+  * @param  pTransfer Transfer
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef MEMBENCH_CheckTransfer(const MEMBENCH_TransferTypeDef *pTransfer)
+{
+  uint32_t channels = 0U;
+
+  if ((pTransfer == NULL) || (pTransfer->pSrc == NULL) || (pTransfer->pDst == NULL) ||
+      (pTransfer->Size == 0U) || (pTransfer->Size > MEMBENCH_MAX_TRANSFER_SIZE))
+  {
+    return HAL_ERROR;
+  }
+
+#if defined(HAL_DMA_MODULE_ENABLED)
+  if (pTransfer->hdma != NULL)
+  {
+    /* Whole number of data items of the source width, below the DMA limit */
+    if (pTransfer->hdma->Init.PeriphDataAlignment == DMA_PDATAALIGN_WORD)
+    {
+      if ((pTransfer->Size % 4U) != 0U)
+      {
+        return HAL_ERROR;
+      }
+    }
+    else if (pTransfer->hdma->Init.PeriphDataAlignment == DMA_PDATAALIGN_HALFWORD)
+    {
+      if ((pTransfer->Size % 2U) != 0U)
+      {
+        return HAL_ERROR;
+      }
+    }
+    else
+    {
+      if (pTransfer->Size > MEMBENCH_DMA_MAX_ITEMS)
+      {
+        return HAL_ERROR;
+      }
+    }
+    channels++;
+  }
+#endif /* HAL_DMA_MODULE_ENABLED */
+#if defined(HAL_MDMA_MODULE_ENABLED)
+  if (pTransfer->hmdma != NULL)
+  {
+    channels++;
+  }
+#endif /* HAL_MDMA_MODULE_ENABLED */
+
+  /* Exactly one channel per transfer */
+  if (channels != 1U)
+  {
+    return HAL_ERROR;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Start a transfer.
+  * @param  pTransfer Transfer, checked by MEMBENCH_CheckTransfer()
+  * @param  Interrupt 1 to start the transfer in interrupt mode, 0 in polling mode
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef MEMBENCH_StartTransfer(MEMBENCH_TransferTypeDef *pTransfer, uint32_t Interrupt)
+{
+  HAL_StatusTypeDef status = HAL_ERROR;
+
+#if defined(HAL_DMA_MODULE_ENABLED)
+  uint32_t items;
+
+  if (pTransfer->hdma != NULL)
+  {
+    if (pTransfer->hdma->Init.PeriphDataAlignment == DMA_PDATAALIGN_WORD)
+    {
+      items = pTransfer->Size / 4U;
+    }
+    else if (pTransfer->hdma->Init.PeriphDataAlignment == DMA_PDATAALIGN_HALFWORD)
+    {
+      items = pTransfer->Size / 2U;
+    }
+    else
+    {
+      items = pTransfer->Size;
+    }
+
+    if (Interrupt != 0U)
+    {
+      status = HAL_DMA_Start_IT(pTransfer->hdma, (uint32_t)pTransfer->pSrc, (uint32_t)pTransfer->pDst, items);
+    }
+    else
+    {
+      status = HAL_DMA_Start(pTransfer->hdma, (uint32_t)pTransfer->pSrc, (uint32_t)pTransfer->pDst, items);
+    }
+  }
+#endif /* HAL_DMA_MODULE_ENABLED */
+#if defined(HAL_MDMA_MODULE_ENABLED)
+  if (pTransfer->hmdma != NULL)
+  {
+    if (Interrupt != 0U)
+    {
+      status = HAL_MDMA_Start_IT(pTransfer->hmdma, (uint32_t)pTransfer->pSrc, (uint32_t)pTransfer->pDst,
+                                 pTransfer->Size, 1U);
+    }
+    else
+    {
+      status = HAL_MDMA_Start(pTransfer->hmdma, (uint32_t)pTransfer->pSrc, (uint32_t)pTransfer->pDst,
+                              pTransfer->Size, 1U);
+    }
+  }
+#endif /* HAL_MDMA_MODULE_ENABLED */
+
+  UNUSED(Interrupt);
+
+  return status;
+}
+
+/**
+  * @brief  Wait for the end of a transfer.
+  * @param  pTransfer Transfer
+  * @param  Interrupt 1 for a transfer started in interrupt mode, completed by its
+  *         IRQ handler, 0 for a transfer started in polling mode, polled here
+  * @param  Timeout Timeout duration
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef MEMBENCH_WaitTransfer(MEMBENCH_TransferTypeDef *pTransfer, uint32_t Interrupt, uint32_t Timeout)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+  uint32_t tickstart = HAL_GetTick();
+
+#if defined(HAL_DMA_MODULE_ENABLED)
+  if (pTransfer->hdma != NULL)
+  {
+    if (Interrupt == 0U)
+    {
+      status = HAL_DMA_PollForTransfer(pTransfer->hdma, HAL_DMA_FULL_TRANSFER, Timeout);
+    }
+    else
+    {
+      while (HAL_DMA_GetState(pTransfer->hdma) == HAL_DMA_STATE_BUSY)
+      {
+        if (((HAL_GetTick() - tickstart) > Timeout) || (Timeout == 0U))
+        {
+          (void)HAL_DMA_Abort_IT(pTransfer->hdma);
+          status = HAL_TIMEOUT;
+          break;
+        }
+      }
+    }
+  }
+#endif /* HAL_DMA_MODULE_ENABLED */
+#if defined(HAL_MDMA_MODULE_ENABLED)
+  if (pTransfer->hmdma != NULL)
+  {
+    if (Interrupt == 0U)
+    {
+      status = HAL_MDMA_PollForTransfer(pTransfer->hmdma, HAL_MDMA_FULL_TRANSFER, Timeout);
+    }
+    else
+    {
+      while (HAL_MDMA_GetState(pTransfer->hmdma) == HAL_MDMA_STATE_BUSY)
+      {
+        if (((HAL_GetTick() - tickstart) > Timeout) || (Timeout == 0U))
+        {
+          (void)HAL_MDMA_Abort_IT(pTransfer->hmdma);
+          status = HAL_TIMEOUT;
+          break;
+        }
+      }
+    }
+  }
+#endif /* HAL_MDMA_MODULE_ENABLED */
+
+  UNUSED(Interrupt);
+  UNUSED(tickstart);
+
+  return status;
+}
+
+#if defined(HAL_DMA_MODULE_ENABLED)
+/**
+  * @brief  DMA transfer complete callback of the contention benchmark: count
+  *         the transfer and restart it while the CPU tests run.
+  * @param  hdma DMA handle
+  * @retval None
+  */
+static void MEMBENCH_DmaCpltCallback(DMA_HandleTypeDef *hdma)
+{
+  MEMBENCH_ContentionTypeDef *pContention = MEMBENCH_pContention;
+  uint32_t index;
+
+  if (pContention != NULL)
+  {
+    for (index = 0U; index < pContention->NbTransfers; index++)
+    {
+      if (pContention->Transfer[index].hdma == hdma)
+      {
+        pContention->Transfer[index].Transfers++;
+        (void)MEMBENCH_StartTransfer(&pContention->Transfer[index], 1U);
+      }
+    }
+  }
+}
+#endif /* HAL_DMA_MODULE_ENABLED */
+
+#if defined(HAL_MDMA_MODULE_ENABLED)
+/**
+  * @brief  MDMA transfer complete callback of the contention benchmark: count
+  *         the transfer and restart it while the CPU tests run.
+  * @param  hmdma MDMA handle
+  * @retval None
+  */
+static void MEMBENCH_MdmaCpltCallback(MDMA_HandleTypeDef *hmdma)
+{
+  MEMBENCH_ContentionTypeDef *pContention = MEMBENCH_pContention;
+  uint32_t index;
+
+  if (pContention != NULL)
+  {
+    for (index = 0U; index < pContention->NbTransfers; index++)
+    {
+      if (pContention->Transfer[index].hmdma == hmdma)
+      {
+        pContention->Transfer[index].Transfers++;
+        (void)MEMBENCH_StartTransfer(&pContention->Transfer[index], 1U);
+      }
+    }
+  }
+}
+#endif /* HAL_MDMA_MODULE_ENABLED */
+
+/**
+  * @}
+  */
+
+#endif /* HAL_MEMBENCH_MODULE_ENABLED */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
@@ -114,6 +114,12 @@
         through HAL_MMC_GetCardState() function for MMC card state.
         You could also check the DMA transfer process through the MMC Rx interrupt event.
 
+    (+) You can read from MMC card in DMA double buffer mode by using function
+        HAL_MMC_ReadBlocks_DMADoubleBuffer(). The two buffers are filled alternately and
+        each completed buffer is notified by HAL_MMCEx_Read_DMADoubleBuf0CpltCallback() or
+        HAL_MMCEx_Read_DMADoubleBuf1CpltCallback(). The completed buffer may be replaced
+        with HAL_MMCEx_ChangeDMABuffer(). Large reads are chained by the driver.
+
     (+) You can read from MMC card in Interrupt mode by using function HAL_MMC_ReadBlocks_IT().
         This function allows the read of 512 bytes blocks.
         You can choose either one block read operation or multiple block read operation
@@ -122,6 +128,19 @@
         through HAL_MMC_GetCardState() function for MMC card state.
         You could also check the IT transfer process through the MMC Rx interrupt event.
 
+  *** MMC Card cache and packed commands ***
+  ==========================================
+  [..]
+    (+) When the device has a cache (CACHE_SIZE of the Extended CSD different
+        from 0), it can be enabled and disabled with HAL_MMC_ConfigCache(). The
+        data in the cache is written to the memory with HAL_MMC_FlushCache(),
+        for instance before a power loss.
+    (+) You can group several small writes in one transfer with HAL_MMC_WritePacked_DMA().
+        The first block of the buffer is filled by the driver with the packed
+        command header, it is followed by the data of all writes of the group.
+        The end of the transfer is notified by HAL_MMC_TxCpltCallback().
+    (+) The eMMC command queue engine is not supported.
+
   *** MMC Card Write operation ***
   ===============================
   [..]
@@ -142,6 +161,11 @@
         through HAL_MMC_GetCardState() function for MMC card state.
         You could also check the DMA transfer process through the MMC Tx interrupt event.
 
+    (+) You can write to MMC card in DMA double buffer mode by using function
+        HAL_MMC_WriteBlocks_DMADoubleBuffer(). The two buffers are sent alternately and
+        each completed buffer is notified by HAL_MMCEx_Write_DMADoubleBuf0CpltCallback() or
+        HAL_MMCEx_Write_DMADoubleBuf1CpltCallback().
+
     (+) You can write to MMC card in Interrupt mode by using function HAL_MMC_WriteBlocks_IT().
         This function allows the read of 512 bytes blocks.
         You can choose either one block read operation or multiple block read operation
@@ -307,6 +331,11 @@ static uint32_t MMC_SendStatus(MMC_HandleTypeDef *hmmc, uint32_t *pCardStatus);
 static void     MMC_PowerOFF(MMC_HandleTypeDef *hmmc);
 static void     MMC_Write_IT(MMC_HandleTypeDef *hmmc);
 static void     MMC_Read_IT(MMC_HandleTypeDef *hmmc);
+static HAL_StatusTypeDef MMC_DMADoubleBuffer_Start(MMC_HandleTypeDef *hmmc, uint32_t Buffer0, uint32_t Buffer1,
+                                                   uint32_t BufferSize, uint32_t BlockAdd,
+                                                   uint32_t NumberOfBlocks, uint32_t Context);
+static uint32_t MMC_DMADoubleBuffer_StartSegment(MMC_HandleTypeDef *hmmc);
+static uint32_t MMC_SwitchAndWait(MMC_HandleTypeDef *hmmc, uint32_t Argument);
 static uint32_t MMC_HighSpeed(MMC_HandleTypeDef *hmmc, FunctionalState state);
 static uint32_t MMC_DDR_Mode(MMC_HandleTypeDef *hmmc, FunctionalState state);
 static HAL_StatusTypeDef MMC_ReadExtCSD(MMC_HandleTypeDef *hmmc, uint32_t *pFieldData, uint16_t FieldIndex,
@@ -1551,6 +1580,70 @@ HAL_StatusTypeDef HAL_MMC_Erase(MMC_HandleTypeDef *hmmc, uint32_t BlockStartAdd,
   }
 }
 
+/**
+  * @brief  Reads block(s) from a specified address in a card. The Data transfer
+  *         is managed by the Internal DMA in double buffer mode.
+  * @note   Buffer0 and Buffer1 are filled alternately, each completed buffer is
+  *         notified by HAL_MMCEx_Read_DMADoubleBuf0CpltCallback() or
+  *         HAL_MMCEx_Read_DMADoubleBuf1CpltCallback(), where the next buffer
+  *         address can be given through HAL_MMCEx_ChangeDMABuffer().
+  *         The end of the transfer is notified by HAL_MMC_RxCpltCallback().
+  * @note   The number of blocks is not limited by the DPSM data length: the
+  *         Read Multi Block command is restarted by the interrupt handler
+  *         after each segment (largest multiple of 16 x BufferSize blocks
+  *         fitting the DPSM data length), without any action of the application.
+  * @param  hmmc: Pointer to MMC handle
+  * @param  pData0: Pointer to the Buffer0 that will contain the received data
+  * @param  pData1: Pointer to the Buffer1 that will contain the received data
+  * @param  BufferSize: Size of Buffer0 and Buffer1 in blocks
+  * @param  BlockAdd: Block Address from where data is to be read
+  * @param  NumberOfBlocks: Number of blocks to read
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_MMC_ReadBlocks_DMADoubleBuffer(MMC_HandleTypeDef *hmmc, uint8_t *pData0, uint8_t *pData1,
+                                                     uint32_t BufferSize, uint32_t BlockAdd, uint32_t NumberOfBlocks)
+{
+  if ((NULL == pData0) || (NULL == pData1))
+  {
+    hmmc->ErrorCode |= HAL_MMC_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  return MMC_DMADoubleBuffer_Start(hmmc, (uint32_t)pData0, (uint32_t)pData1, BufferSize, BlockAdd, NumberOfBlocks,
+                                   MMC_CONTEXT_READ_MULTIPLE_BLOCK);
+}
+
+/**
+  * @brief  Writes block(s) to a specified address in a card. The Data transfer
+  *         is managed by the Internal DMA in double buffer mode.
+  * @note   Buffer0 and Buffer1 are sent alternately, each completed buffer is
+  *         notified by HAL_MMCEx_Write_DMADoubleBuf0CpltCallback() or
+  *         HAL_MMCEx_Write_DMADoubleBuf1CpltCallback(), where the next buffer
+  *         address can be given through HAL_MMCEx_ChangeDMABuffer().
+  *         The end of the transfer is notified by HAL_MMC_TxCpltCallback().
+  * @param  hmmc: Pointer to MMC handle
+  * @param  pData0: Pointer to the Buffer0 that contains the data to transmit
+  * @param  pData1: Pointer to the Buffer1 that contains the data to transmit
+  * @param  BufferSize: Size of Buffer0 and Buffer1 in blocks
+  * @param  BlockAdd: Block Address where data will be written
+  * @param  NumberOfBlocks: Number of blocks to write, limited to one DPSM
+  *         transfer (65535 blocks)
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_MMC_WriteBlocks_DMADoubleBuffer(MMC_HandleTypeDef *hmmc, const uint8_t *pData0,
+                                                      const uint8_t *pData1, uint32_t BufferSize, uint32_t BlockAdd,
+                                                      uint32_t NumberOfBlocks)
+{
+  if ((NULL == pData0) || (NULL == pData1) || (NumberOfBlocks > (SDMMC_DLEN_DATALENGTH / MMC_BLOCKSIZE)))
+  {
+    hmmc->ErrorCode |= HAL_MMC_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  return MMC_DMADoubleBuffer_Start(hmmc, (uint32_t)pData0, (uint32_t)pData1, BufferSize, BlockAdd, NumberOfBlocks,
+                                   MMC_CONTEXT_WRITE_MULTIPLE_BLOCK);
+}
+
 /**
   * @brief  This function handles MMC card interrupt request.
   * @param  hmmc: Pointer to MMC handle
@@ -1584,8 +1677,10 @@ void HAL_MMC_IRQHandler(MMC_HandleTypeDef *hmmc)
       hmmc->Instance->DCTRL = 0;
       hmmc->Instance->IDMACTRL = SDMMC_DISABLE_IDMA ;
 
-      /* Stop Transfer for Write Multi blocks or Read Multi blocks */
-      if (((context & MMC_CONTEXT_READ_MULTIPLE_BLOCK) != 0U) || ((context & MMC_CONTEXT_WRITE_MULTIPLE_BLOCK) != 0U))
+      /* Stop Transfer for Write Multi blocks or Read Multi blocks, not needed when the
+         block count was set by CMD23 */
+      if ((((context & MMC_CONTEXT_READ_MULTIPLE_BLOCK) != 0U) || ((context & MMC_CONTEXT_WRITE_MULTIPLE_BLOCK) != 0U))
+          && ((context & MMC_CONTEXT_BLOCK_COUNT) == 0U))
       {
         errorstate = SDMMC_CmdStopTransfer(hmmc->Instance);
         if (errorstate != HAL_MMC_ERROR_NONE)
@@ -1599,25 +1694,45 @@ void HAL_MMC_IRQHandler(MMC_HandleTypeDef *hmmc)
         }
       }
 
-      /* Clear all the static flags */
-      __HAL_MMC_CLEAR_FLAG(hmmc, SDMMC_STATIC_DATA_FLAGS);
-
-      hmmc->State = HAL_MMC_STATE_READY;
-      if (((context & MMC_CONTEXT_WRITE_SINGLE_BLOCK) != 0U) || ((context & MMC_CONTEXT_WRITE_MULTIPLE_BLOCK) != 0U))
+      if (((context & MMC_CONTEXT_DOUBLE_BUFFER) != 0U) && (hmmc->DblBufRemainingBlocks != 0U) &&
+          (hmmc->ErrorCode == HAL_MMC_ERROR_NONE))
       {
+        /* Chain the next segment of the double buffer transfer */
+        errorstate = MMC_DMADoubleBuffer_StartSegment(hmmc);
+        if (errorstate != HAL_MMC_ERROR_NONE)
+        {
+          hmmc->ErrorCode |= errorstate;
+          hmmc->State = HAL_MMC_STATE_READY;
+          hmmc->Context = MMC_CONTEXT_NONE;
 #if defined (USE_HAL_MMC_REGISTER_CALLBACKS) && (USE_HAL_MMC_REGISTER_CALLBACKS == 1U)
-        hmmc->TxCpltCallback(hmmc);
+          hmmc->ErrorCallback(hmmc);
 #else
-        HAL_MMC_TxCpltCallback(hmmc);
+          HAL_MMC_ErrorCallback(hmmc);
 #endif /* USE_HAL_MMC_REGISTER_CALLBACKS */
+        }
       }
-      if (((context & MMC_CONTEXT_READ_SINGLE_BLOCK) != 0U) || ((context & MMC_CONTEXT_READ_MULTIPLE_BLOCK) != 0U))
+      else
       {
+        /* Clear all the static flags */
+        __HAL_MMC_CLEAR_FLAG(hmmc, SDMMC_STATIC_DATA_FLAGS);
+
+        hmmc->State = HAL_MMC_STATE_READY;
+        if (((context & MMC_CONTEXT_WRITE_SINGLE_BLOCK) != 0U) || ((context & MMC_CONTEXT_WRITE_MULTIPLE_BLOCK) != 0U))
+        {
 #if defined (USE_HAL_MMC_REGISTER_CALLBACKS) && (USE_HAL_MMC_REGISTER_CALLBACKS == 1U)
-        hmmc->RxCpltCallback(hmmc);
+          hmmc->TxCpltCallback(hmmc);
 #else
-        HAL_MMC_RxCpltCallback(hmmc);
+          HAL_MMC_TxCpltCallback(hmmc);
+#endif /* USE_HAL_MMC_REGISTER_CALLBACKS */
+        }
+        if (((context & MMC_CONTEXT_READ_SINGLE_BLOCK) != 0U) || ((context & MMC_CONTEXT_READ_MULTIPLE_BLOCK) != 0U))
+        {
+#if defined (USE_HAL_MMC_REGISTER_CALLBACKS) && (USE_HAL_MMC_REGISTER_CALLBACKS == 1U)
+          hmmc->RxCpltCallback(hmmc);
+#else
+          HAL_MMC_RxCpltCallback(hmmc);
 #endif /* USE_HAL_MMC_REGISTER_CALLBACKS */
+        }
       }
     }
     else if ((context & MMC_CONTEXT_IT) != 0U)
@@ -3549,6 +3664,278 @@ HAL_StatusTypeDef HAL_MMC_AwakeDevice(MMC_HandleTypeDef *hmmc)
     return HAL_BUSY;
   }
 }
+
+/**
+  * @brief  Enable or disable the cache of the device.
+  * @note   The data in the cache is not written to the memory when the cache
+  *         is disabled: HAL_MMC_FlushCache() must be called before if needed.
+  * @param  hmmc Pointer to MMC handle
+  * @param  State New state of the cache (ENABLE or DISABLE)
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_MMC_ConfigCache(MMC_HandleTypeDef *hmmc, FunctionalState State)
+{
+  uint32_t errorstate;
+  uint32_t cache_size;
+
+  /* Check the state of the driver */
+  if (hmmc->State == HAL_MMC_STATE_READY)
+  {
+    /* CACHE_SIZE is stored in the bytes 249 to 252 of the Extended CSD */
+    cache_size = (hmmc->Ext_CSD[(MMC_EXT_CSD_CACHE_SIZE_INDEX / 4)] >> 8U) |
+                 (hmmc->Ext_CSD[(MMC_EXT_CSD_CACHE_SIZE_INDEX / 4) + 1] << 24U);
+    if (cache_size == 0U)
+    {
+      hmmc->ErrorCode |= HAL_MMC_ERROR_UNSUPPORTED_FEATURE;
+      return HAL_ERROR;
+    }
+
+    /* Change State */
+    hmmc->State = HAL_MMC_STATE_BUSY;
+
+    /* Index : 33 - Value : 0x01 to enable, 0x00 to disable */
+    errorstate = MMC_SwitchAndWait(hmmc, (State == ENABLE) ? 0x03210100U : 0x03210000U);
+
+    if (errorstate == HAL_MMC_ERROR_NONE)
+    {
+      /* Keep the local copy of the Extended CSD up to date */
+      MODIFY_REG(hmmc->Ext_CSD[(MMC_EXT_CSD_CACHE_CTRL_INDEX / 4)], (0xFFUL << MMC_EXT_CSD_CACHE_CTRL_POS),
+                 (((State == ENABLE) ? 0x01UL : 0x00UL) << MMC_EXT_CSD_CACHE_CTRL_POS));
+    }
+
+    /* Change State */
+    hmmc->State = HAL_MMC_STATE_READY;
+
+    /* Manage errors */
+    if (errorstate != HAL_MMC_ERROR_NONE)
+    {
+      /* Clear all the static flags */
+      __HAL_MMC_CLEAR_FLAG(hmmc, SDMMC_STATIC_FLAGS);
+      hmmc->ErrorCode |= errorstate;
+
+      if (errorstate != HAL_MMC_ERROR_TIMEOUT)
+      {
+        return HAL_ERROR;
+      }
+      else
+      {
+        return HAL_TIMEOUT;
+      }
+    }
+    else
+    {
+      return HAL_OK;
+    }
+  }
+  else
+  {
+    return HAL_BUSY;
+  }
+}
+
+/**
+  * @brief  Write the data in the cache of the device to the memory.
+  * @param  hmmc Pointer to MMC handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_MMC_FlushCache(MMC_HandleTypeDef *hmmc)
+{
+  uint32_t errorstate;
+
+  /* Check the state of the driver */
+  if (hmmc->State == HAL_MMC_STATE_READY)
+  {
+    /* Nothing to flush when the cache is disabled */
+    if (((hmmc->Ext_CSD[(MMC_EXT_CSD_CACHE_CTRL_INDEX / 4)] >> MMC_EXT_CSD_CACHE_CTRL_POS) & 0x01U) == 0U)
+    {
+      return HAL_OK;
+    }
+
+    /* Change State */
+    hmmc->State = HAL_MMC_STATE_BUSY;
+
+    /* Index : 32 - Value : 0x01 */
+    errorstate = MMC_SwitchAndWait(hmmc, 0x03200100U);
+
+    /* Change State */
+    hmmc->State = HAL_MMC_STATE_READY;
+
+    /* Manage errors */
+    if (errorstate != HAL_MMC_ERROR_NONE)
+    {
+      /* Clear all the static flags */
+      __HAL_MMC_CLEAR_FLAG(hmmc, SDMMC_STATIC_FLAGS);
+      hmmc->ErrorCode |= errorstate;
+
+      if (errorstate != HAL_MMC_ERROR_TIMEOUT)
+      {
+        return HAL_ERROR;
+      }
+      else
+      {
+        return HAL_TIMEOUT;
+      }
+    }
+    else
+    {
+      return HAL_OK;
+    }
+  }
+  else
+  {
+    return HAL_BUSY;
+  }
+}
+
+/**
+  * @brief  Write a group of block ranges with one packed write command. The
+  *         Data transfer is managed by DMA mode.
+  * @note   This API should be followed by a check on the card state through
+  *         HAL_MMC_GetCardState().
+  * @param  hmmc Pointer to MMC handle
+  * @param  pData Pointer to the buffer: the first block is filled with the
+  *         packed command header, it is followed by the data of all entries
+  * @param  pEntries Pointer to the block ranges to write
+  * @param  NbEntries Number of entries, limited by MAX_PACKED_WRITES of the
+  *         Extended CSD
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_MMC_WritePacked_DMA(MMC_HandleTypeDef *hmmc, uint8_t *pData,
+                                          const HAL_MMC_PackedEntryTypeDef *pEntries, uint32_t NbEntries)
+{
+  SDMMC_DataInitTypeDef config;
+  uint32_t errorstate;
+  uint32_t nbblocks = 1U;
+  uint32_t add;
+  uint32_t count;
+  uint8_t *header = pData;
+
+  if ((NULL == pData) || (NULL == pEntries) || (NbEntries == 0U) ||
+      (NbEntries > ((MMC_BLOCKSIZE / 8U) - 1U)))
+  {
+    hmmc->ErrorCode |= HAL_MMC_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  if (hmmc->State == HAL_MMC_STATE_READY)
+  {
+    hmmc->ErrorCode = HAL_MMC_ERROR_NONE;
+
+    /* The header takes 8 sectors on 4kB blocks devices: not supported */
+    if ((NbEntries > ((hmmc->Ext_CSD[(MMC_EXT_CSD_MAX_PACKED_WR_INDEX / 4)] >> MMC_EXT_CSD_MAX_PACKED_WR_POS) & 0xFFU)) ||
+        (((hmmc->Ext_CSD[(MMC_EXT_CSD_DATA_SEC_SIZE_INDEX / 4)] >> MMC_EXT_CSD_DATA_SEC_SIZE_POS) & 0x000000FFU) != 0x0U))
+    {
+      hmmc->ErrorCode |= HAL_MMC_ERROR_UNSUPPORTED_FEATURE;
+      return HAL_ERROR;
+    }
+
+    /* Build the packed command header: version, write, number of entries and,
+       for each entry, the CMD23 and CMD25 arguments in little endian */
+    for (count = 0U; count < MMC_BLOCKSIZE; count++)
+    {
+      header[count] = 0U;
+    }
+    header[0] = 0x01U;
+    header[1] = 0x02U;
+    header[2] = (uint8_t)NbEntries;
+
+    for (count = 0U; count < NbEntries; count++)
+    {
+      if ((pEntries[count].NumberOfBlocks == 0U) ||
+          ((pEntries[count].BlockAdd + pEntries[count].NumberOfBlocks) > (hmmc->MmcCard.LogBlockNbr)))
+      {
+        hmmc->ErrorCode |= HAL_MMC_ERROR_ADDR_OUT_OF_RANGE;
+        return HAL_ERROR;
+      }
+
+      add = pEntries[count].BlockAdd;
+      if ((hmmc->MmcCard.CardType) != MMC_HIGH_CAPACITY_CARD)
+      {
+        add *= 512U;
+      }
+
+      header[(8U * (count + 1U)) + 0U] = (uint8_t)(pEntries[count].NumberOfBlocks);
+      header[(8U * (count + 1U)) + 1U] = (uint8_t)(pEntries[count].NumberOfBlocks >> 8U);
+      header[(8U * (count + 1U)) + 2U] = (uint8_t)(pEntries[count].NumberOfBlocks >> 16U);
+      header[(8U * (count + 1U)) + 3U] = (uint8_t)(pEntries[count].NumberOfBlocks >> 24U);
+      header[(8U * (count + 1U)) + 4U] = (uint8_t)(add);
+      header[(8U * (count + 1U)) + 5U] = (uint8_t)(add >> 8U);
+      header[(8U * (count + 1U)) + 6U] = (uint8_t)(add >> 16U);
+      header[(8U * (count + 1U)) + 7U] = (uint8_t)(add >> 24U);
+
+      nbblocks += pEntries[count].NumberOfBlocks;
+    }
+
+    /* The block count of CMD23 is limited to 16 bits */
+    if (nbblocks > 0xFFFFU)
+    {
+      hmmc->ErrorCode |= HAL_MMC_ERROR_PARAM;
+      return HAL_ERROR;
+    }
+
+    hmmc->State = HAL_MMC_STATE_BUSY;
+
+    /* Initialize data control register */
+    hmmc->Instance->DCTRL = 0U;
+
+    hmmc->pTxBuffPtr = pData;
+    hmmc->TxXferSize = MMC_BLOCKSIZE * nbblocks;
+
+    /* Set the packed block count (PACKED flag) */
+    errorstate = SDMMC_CmdSetBlockCount(hmmc->Instance, (0x40000000U | nbblocks));
+    if (errorstate != HAL_MMC_ERROR_NONE)
+    {
+      /* Clear all the static flags */
+      __HAL_MMC_CLEAR_FLAG(hmmc, SDMMC_STATIC_FLAGS);
+      hmmc->ErrorCode |= errorstate;
+      hmmc->State = HAL_MMC_STATE_READY;
+      return HAL_ERROR;
+    }
+
+    /* Configure the MMC DPSM (Data Path State Machine) */
+    config.DataTimeOut   = SDMMC_DATATIMEOUT;
+    config.DataLength    = MMC_BLOCKSIZE * nbblocks;
+    config.DataBlockSize = SDMMC_DATABLOCK_SIZE_512B;
+    config.TransferDir   = SDMMC_TRANSFER_DIR_TO_CARD;
+    config.TransferMode  = SDMMC_TRANSFER_MODE_BLOCK;
+    config.DPSM          = SDMMC_DPSM_DISABLE;
+    (void)SDMMC_ConfigData(hmmc->Instance, &config);
+
+    __SDMMC_CMDTRANS_ENABLE(hmmc->Instance);
+
+    hmmc->Instance->IDMABASE0 = (uint32_t) pData;
+    hmmc->Instance->IDMACTRL  = SDMMC_ENABLE_IDMA_SINGLE_BUFF;
+
+    /* Write Blocks in DMA mode, the transfer ends on the block count */
+    hmmc->Context = (MMC_CONTEXT_WRITE_MULTIPLE_BLOCK | MMC_CONTEXT_DMA | MMC_CONTEXT_BLOCK_COUNT);
+
+    /* Write Multi Block command, addressed to the first entry */
+    add = pEntries[0].BlockAdd;
+    if ((hmmc->MmcCard.CardType) != MMC_HIGH_CAPACITY_CARD)
+    {
+      add *= 512U;
+    }
+    errorstate = SDMMC_CmdWriteMultiBlock(hmmc->Instance, add);
+    if (errorstate != HAL_MMC_ERROR_NONE)
+    {
+      /* Clear all the static flags */
+      __HAL_MMC_CLEAR_FLAG(hmmc, SDMMC_STATIC_FLAGS);
+      hmmc->ErrorCode |= errorstate;
+      hmmc->State = HAL_MMC_STATE_READY;
+      hmmc->Context = MMC_CONTEXT_NONE;
+      return HAL_ERROR;
+    }
+
+    /* Enable transfer interrupts */
+    __HAL_MMC_ENABLE_IT(hmmc, (SDMMC_IT_DCRCFAIL | SDMMC_IT_DTIMEOUT | SDMMC_IT_TXUNDERR | SDMMC_IT_DATAEND));
+
+    return HAL_OK;
+  }
+  else
+  {
+    return HAL_BUSY;
+  }
+}
 /**
   * @}
   */
@@ -3952,6 +4339,225 @@ static void MMC_Write_IT(MMC_HandleTypeDef *hmmc)
   }
 }
 
+/**
+  * @brief  Send a switch command (CMD6) and wait for the end of its execution.
+  * @param  hmmc Pointer to MMC handle
+  * @param  Argument Argument of the switch command (access, index and value)
+  * @retval MMC Card error state
+  */
+static uint32_t MMC_SwitchAndWait(MMC_HandleTypeDef *hmmc, uint32_t Argument)
+{
+  uint32_t errorstate;
+  uint32_t response = 0U;
+  uint32_t count;
+  uint32_t tickstart = HAL_GetTick();
+
+  errorstate = SDMMC_CmdSwitch(hmmc->Instance, Argument);
+  if (errorstate == HAL_MMC_ERROR_NONE)
+  {
+    /* Wait that the device is ready by checking the D0 line */
+    while ((!__HAL_MMC_GET_FLAG(hmmc, SDMMC_FLAG_BUSYD0END)) && (errorstate == HAL_MMC_ERROR_NONE))
+    {
+      if ((HAL_GetTick() - tickstart) >= SDMMC_MAXERASETIMEOUT)
+      {
+        errorstate = HAL_MMC_ERROR_TIMEOUT;
+      }
+    }
+
+    /* Clear the flag corresponding to end D0 bus line */
+    __HAL_MMC_CLEAR_FLAG(hmmc, SDMMC_FLAG_BUSYD0END);
+
+    if (errorstate == HAL_MMC_ERROR_NONE)
+    {
+      /* While card is not ready for data and trial number for sending CMD13 is not exceeded */
+      count = SDMMC_MAX_TRIAL;
+      do
+      {
+        errorstate = SDMMC_CmdSendStatus(hmmc->Instance, (uint32_t)(((uint32_t)hmmc->MmcCard.RelCardAdd) << 16U));
+        if (errorstate != HAL_MMC_ERROR_NONE)
+        {
+          break;
+        }
+
+        /* Get command response */
+        response = SDMMC_GetResponse(hmmc->Instance, SDMMC_RESP1);
+        count--;
+      } while (((response & 0x100U) == 0U) && (count != 0U));
+
+      /* Check the status after the switch command execution */
+      if ((count != 0U) && (errorstate == HAL_MMC_ERROR_NONE))
+      {
+        /* Check the bit SWITCH_ERROR of the device status */
+        if ((response & 0x80U) != 0U)
+        {
+          errorstate = SDMMC_ERROR_GENERAL_UNKNOWN_ERR;
+        }
+      }
+      else if (count == 0U)
+      {
+        errorstate = SDMMC_ERROR_TIMEOUT;
+      }
+      else
+      {
+        /* Nothing to do */
+      }
+    }
+  }
+
+  return errorstate;
+}
+
+/**
+  * @brief  Start a double buffer DMA transfer.
+  * @param  hmmc: pointer to a MMC_HandleTypeDef structure that contains
+  *              the configuration information.
+  * @param  Buffer0: Address of the Buffer0
+  * @param  Buffer1: Address of the Buffer1
+  * @param  BufferSize: Size of Buffer0 and Buffer1 in blocks
+  * @param  BlockAdd: Block Address of the transfer
+  * @param  NumberOfBlocks: Number of blocks of the transfer
+  * @param  Context: MMC_CONTEXT_READ_MULTIPLE_BLOCK or MMC_CONTEXT_WRITE_MULTIPLE_BLOCK
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef MMC_DMADoubleBuffer_Start(MMC_HandleTypeDef *hmmc, uint32_t Buffer0, uint32_t Buffer1,
+                                                   uint32_t BufferSize, uint32_t BlockAdd, uint32_t NumberOfBlocks,
+                                                   uint32_t Context)
+{
+  uint32_t errorstate;
+
+  if ((BufferSize == 0U) || ((MMC_BLOCKSIZE * BufferSize) > SDMMC_IDMABSIZE_IDMABNDT) || (NumberOfBlocks == 0U))
+  {
+    hmmc->ErrorCode |= HAL_MMC_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  if (hmmc->State == HAL_MMC_STATE_READY)
+  {
+    hmmc->ErrorCode = HAL_MMC_ERROR_NONE;
+
+    if ((BlockAdd + NumberOfBlocks) > (hmmc->MmcCard.LogBlockNbr))
+    {
+      hmmc->ErrorCode |= HAL_MMC_ERROR_ADDR_OUT_OF_RANGE;
+      return HAL_ERROR;
+    }
+
+    /* Check the case of 4kB blocks (field DATA SECTOR SIZE of extended CSD register) */
+    if (((hmmc->Ext_CSD[(MMC_EXT_CSD_DATA_SEC_SIZE_INDEX / 4)] >> MMC_EXT_CSD_DATA_SEC_SIZE_POS) & 0x000000FFU) != 0x0U)
+    {
+      if (((NumberOfBlocks % 8U) != 0U) || ((BlockAdd % 8U) != 0U))
+      {
+        /* The number of blocks and the address should be aligned to 8 sectors of 512 bytes = 4 KBytes */
+        hmmc->ErrorCode |= HAL_MMC_ERROR_ADDR_MISALIGNED;
+        return HAL_ERROR;
+      }
+    }
+
+    hmmc->State = HAL_MMC_STATE_BUSY;
+
+    hmmc->Instance->IDMABASE0 = Buffer0;
+    hmmc->Instance->IDMABASE1 = Buffer1;
+    hmmc->Instance->IDMABSIZE = (uint32_t)(MMC_BLOCKSIZE * BufferSize);
+
+    /* Restart the command every segment: an even number of buffers keeps Buffer0 first */
+    hmmc->DblBufBlockAdd        = BlockAdd;
+    hmmc->DblBufRemainingBlocks = NumberOfBlocks;
+    if (Context == MMC_CONTEXT_READ_MULTIPLE_BLOCK)
+    {
+      hmmc->DblBufSegmentBlocks = ((SDMMC_DLEN_DATALENGTH / MMC_BLOCKSIZE) / (16U * BufferSize)) * (16U * BufferSize);
+    }
+    else
+    {
+      hmmc->DblBufSegmentBlocks = NumberOfBlocks;
+    }
+
+    hmmc->Context = (Context | MMC_CONTEXT_DMA | MMC_CONTEXT_DOUBLE_BUFFER);
+
+    errorstate = MMC_DMADoubleBuffer_StartSegment(hmmc);
+    if (errorstate != HAL_MMC_ERROR_NONE)
+    {
+      /* Clear all the static flags */
+      __HAL_MMC_CLEAR_FLAG(hmmc, SDMMC_STATIC_FLAGS);
+      hmmc->Instance->IDMACTRL = SDMMC_DISABLE_IDMA;
+      hmmc->ErrorCode |= errorstate;
+      hmmc->State = HAL_MMC_STATE_READY;
+      hmmc->Context = MMC_CONTEXT_NONE;
+      return HAL_ERROR;
+    }
+
+    return HAL_OK;
+  }
+  else
+  {
+    return HAL_BUSY;
+  }
+}
+
+/**
+  * @brief  Start the next segment of a double buffer DMA transfer.
+  * @param  hmmc: pointer to a MMC_HandleTypeDef structure that contains
+  *              the configuration information.
+  * @retval MMC Card error state
+  */
+static uint32_t MMC_DMADoubleBuffer_StartSegment(MMC_HandleTypeDef *hmmc)
+{
+  SDMMC_DataInitTypeDef config;
+  uint32_t errorstate;
+  uint32_t nbblocks = hmmc->DblBufRemainingBlocks;
+  uint32_t add = hmmc->DblBufBlockAdd;
+
+  if (nbblocks > hmmc->DblBufSegmentBlocks)
+  {
+    nbblocks = hmmc->DblBufSegmentBlocks;
+  }
+  hmmc->DblBufRemainingBlocks -= nbblocks;
+  hmmc->DblBufBlockAdd += nbblocks;
+
+  if ((hmmc->MmcCard.CardType) != MMC_HIGH_CAPACITY_CARD)
+  {
+    add *= 512U;
+  }
+
+  /* Initialize data control register */
+  hmmc->Instance->DCTRL = 0U;
+
+  /* Configure the MMC DPSM (Data Path State Machine) */
+  config.DataTimeOut   = SDMMC_DATATIMEOUT;
+  config.DataLength    = MMC_BLOCKSIZE * nbblocks;
+  config.DataBlockSize = SDMMC_DATABLOCK_SIZE_512B;
+  config.TransferDir   = ((hmmc->Context & MMC_CONTEXT_READ_MULTIPLE_BLOCK) != 0U) ? SDMMC_TRANSFER_DIR_TO_SDMMC :
+                         SDMMC_TRANSFER_DIR_TO_CARD;
+  config.TransferMode  = SDMMC_TRANSFER_MODE_BLOCK;
+  config.DPSM          = SDMMC_DPSM_DISABLE;
+  (void)SDMMC_ConfigData(hmmc->Instance, &config);
+
+  __SDMMC_CMDTRANS_ENABLE(hmmc->Instance);
+
+  hmmc->Instance->IDMACTRL = SDMMC_ENABLE_IDMA_DOUBLE_BUFF0;
+
+  if ((hmmc->Context & MMC_CONTEXT_READ_MULTIPLE_BLOCK) != 0U)
+  {
+    /* Read Multi Block command */
+    errorstate = SDMMC_CmdReadMultiBlock(hmmc->Instance, add);
+    if (errorstate == HAL_MMC_ERROR_NONE)
+    {
+      __HAL_MMC_ENABLE_IT(hmmc, (SDMMC_IT_DCRCFAIL | SDMMC_IT_DTIMEOUT | SDMMC_IT_RXOVERR | SDMMC_IT_DATAEND |
+                                SDMMC_IT_IDMABTC));
+    }
+  }
+  else
+  {
+    /* Write Multi Block command */
+    errorstate = SDMMC_CmdWriteMultiBlock(hmmc->Instance, add);
+    if (errorstate == HAL_MMC_ERROR_NONE)
+    {
+      __HAL_MMC_ENABLE_IT(hmmc, (SDMMC_IT_DCRCFAIL | SDMMC_IT_DTIMEOUT | SDMMC_IT_TXUNDERR | SDMMC_IT_DATAEND |
+                                SDMMC_IT_IDMABTC));
+    }
+  }
+
+  return errorstate;
+}
+
 /**
   * @brief  Switches the MMC card to high speed mode.
   * @param  hmmc: MMC handle
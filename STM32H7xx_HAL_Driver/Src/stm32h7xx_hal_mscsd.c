@@ -0,0 +1,718 @@
+/**
+  ******************************************************************************
+  * @file    stm32h7xx_hal_mscsd.c
+  * @author  MCD Application Team
+  * @brief   USB mass storage to SD card bridge HAL module driver.
+             This file provides firmware functions to send the blocks of an SD
+             card to the host of a USB mass storage device without copy:
+              + Initialization and de-initialization functions
+              + Read pipeline functions
+              + Peripheral State and Error functions
+
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  @verbatim
+ ===============================================================================
+                        ##### How to use this driver #####
+ ===============================================================================
+  [..]
+    A mass storage read command is usually served in two serialized stages: the
+    blocks are read from the card into a RAM buffer, then the buffer is sent on
+    the bulk IN endpoint. This driver pipelines both transfers over a ring of
+    buffers shared by the SDMMC internal DMA and the USB endpoint: the card fills
+    the next buffers while the previous ones are sent to the host, without copy.
+    The card keeps reading after the last block of a command (read-ahead), so
+    that a sequential command following it is served from the ring, with one
+    Read Multi Block command of the card spanning several host commands.
+
+    *** Initialization ***
+    ======================
+    [..]
+     (#) Initialize the SD card with HAL_SD_Init() and the USB device, the mass
+         storage class opening its bulk IN endpoint as usual.
+     (#) Give the SDMMC and OTG interrupts the same preemption priority: the
+         bridge is updated from both.
+     (#) Fill the Init structure then call HAL_MSCSD_Init(). The ring, pPool, is
+         made of NbBuffers buffers of BufferBlocks blocks, aligned on 32 bytes
+         and reachable by the SDMMC internal DMA and by the OTG DMA when it is
+         enabled: the AXI SRAM for SDMMC1, the AXI or D2 SRAM for SDMMC2.
+         Four buffers of 8 blocks (16 Kbytes) keep both buses busy.
+
+    *** Wiring of the callbacks ***
+    ===============================
+    [..]
+     (#) Call HAL_MSCSD_SD_BufferCpltHandler() from
+         HAL_SDEx_Read_DMADoubleBuf0CpltCallback() and
+         HAL_SDEx_Read_DMADoubleBuf1CpltCallback().
+     (#) Call HAL_MSCSD_SD_CpltHandler() from HAL_SD_RxCpltCallback() and
+         HAL_MSCSD_SD_ErrorHandler() from HAL_SD_ErrorCallback().
+     (#) Call HAL_MSCSD_PCD_DataInHandler() from HAL_PCD_DataInStageCallback(),
+         before the class: it only handles the transfers it started.
+
+    *** Read commands ***
+    =====================
+    [..]
+     (#) On a READ(10) command, call HAL_MSCSD_Read() with the logical block
+         address and the number of blocks of the command instead of reading the
+         card and transmitting the data. HAL_MSCSD_ReadCpltCallback() is called
+         once the last block is sent: the class then sends the status wrapper.
+     (#) A command starting at the block following the previous command is
+         served from the blocks already read, HitCount being incremented. Any
+         other address drops the ring and restarts the card transfer.
+     (#) When the host is slower than the card and all the buffers are filled,
+         the card transfer is stopped before the internal DMA overwrites a buffer
+         and it is restarted once a buffer is sent, RestartCount being incremented.
+     (#) Call HAL_MSCSD_Flush() before writing the card, for a WRITE(10) command
+         or any other access: the card transfer is stopped and the blocks read in
+         advance are dropped, since they may be overwritten.
+
+    *** Notes ***
+    =============
+    [..]
+     (#) When the data cache is enabled, the ring is invalidated on
+         HAL_MSCSD_Init(). Without the OTG DMA, each buffer is also invalidated
+         when filled since the CPU loads it into the endpoint FIFO.
+     (#) Write commands are not pipelined by this driver, the SD write stream
+         functions (HAL_SDEx_WriteStream_Begin()) can be used for them.
+
+  @endverbatim
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32h7xx_hal.h"
+
+/** @addtogroup STM32H7xx_HAL_Driver
+  * @{
+  */
+
+/** @defgroup MSCSD MSCSD
+  * @brief USB mass storage to SD card bridge HAL module driver
+  * @{
+  */
+
+#if defined(HAL_SD_MODULE_ENABLED) && defined(HAL_PCD_MODULE_ENABLED) && defined(HAL_MSCSD_MODULE_ENABLED)
+
+/**
+  @cond 0
+  */
+/* Private typedef -----------------------------------------------------------*/
+
+/* Private define ------------------------------------------------------------*/
+#define MSCSD_POOL_ALIGNMENT              32U     /*!< Data cache line size, also meeting the OTG DMA alignment */
+
+/* Private macro -------------------------------------------------------------*/
+
+/* Private variables ---------------------------------------------------------*/
+
+/* Private function prototypes -----------------------------------------------*/
+static uint8_t *MSCSD_GetBuffer(const MSCSD_HandleTypeDef *hmscsd, uint32_t Index);
+static void     MSCSD_InvalidateBuffer(const MSCSD_HandleTypeDef *hmscsd, uint32_t Index, uint32_t Blocks);
+static void     MSCSD_StartSd(MSCSD_HandleTypeDef *hmscsd);
+static void     MSCSD_StopSd(MSCSD_HandleTypeDef *hmscsd);
+static void     MSCSD_StartUsb(MSCSD_HandleTypeDef *hmscsd);
+static void     MSCSD_Fail(MSCSD_HandleTypeDef *hmscsd, uint32_t Error);
+/**
+  @endcond
+  */
+
+/* Exported functions --------------------------------------------------------*/
+
+/** @defgroup MSCSD_Exported_Functions MSCSD Exported Functions
+  * @{
+  */
+
+/** @defgroup MSCSD_Exported_Functions_Group1 Initialization/de-initialization functions
+  *  @brief    Initialization and Configuration functions
+  *
+@verbatim
+ ===============================================================================
+            ##### Initialization and Configuration functions #####
+ ===============================================================================
+    [..]
+    This subsection provides a set of functions allowing to :
+      (+) Initialize the bridge on an SD card and a USB bulk IN endpoint.
+      (+) De-initialize the bridge.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Initialize the USB mass storage to SD card bridge.
+  * @note   The SD and PCD handles must be initialized by the application.
+  * @param  hmscsd MSCSD handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_MSCSD_Init(MSCSD_HandleTypeDef *hmscsd)
+{
+  /* Check the MSCSD handle allocation */
+  if (hmscsd == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the parameters */
+  assert_param(IS_MSCSD_NB_BUFFERS(hmscsd->Init.NbBuffers));
+  assert_param(IS_MSCSD_BUFFER_BLOCKS(hmscsd->Init.BufferBlocks));
+
+  hmscsd->ErrorCode = HAL_MSCSD_ERROR_NONE;
+
+  if ((hmscsd->Init.hsd == NULL) || (hmscsd->Init.hpcd == NULL) || (hmscsd->Init.pPool == NULL) ||
+      (((uint32_t)hmscsd->Init.pPool % MSCSD_POOL_ALIGNMENT) != 0U) ||
+      (IS_MSCSD_NB_BUFFERS(hmscsd->Init.NbBuffers) == 0U) ||
+      (IS_MSCSD_BUFFER_BLOCKS(hmscsd->Init.BufferBlocks) == 0U))
+  {
+    hmscsd->ErrorCode = HAL_MSCSD_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  /* No dirty line of the ring may be evicted over the blocks written by the internal DMA */
+  if ((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+  {
+    SCB_InvalidateDCache_by_Addr((uint32_t *)(void *)hmscsd->Init.pPool,
+                                 (int32_t)(hmscsd->Init.NbBuffers * hmscsd->Init.BufferBlocks * MSCSD_BLOCK_SIZE));
+  }
+#endif /* __DCACHE_PRESENT */
+
+  hmscsd->Tail = 0U;
+  hmscsd->Fill = 0U;
+  hmscsd->Head = 0U;
+  hmscsd->TailOffset = 0U;
+  hmscsd->NextLba = 0U;
+  hmscsd->SdLba = 0U;
+  hmscsd->SdBlocks = 0U;
+  hmscsd->SdBuffer = 0U;
+  hmscsd->Pending = 0U;
+  hmscsd->CmdBlocks = 0U;
+  hmscsd->UsbBlocks = 0U;
+  hmscsd->HitCount = 0U;
+  hmscsd->RestartCount = 0U;
+  hmscsd->State = HAL_MSCSD_STATE_READY;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  De-initialize the USB mass storage to SD card bridge.
+  * @note   An ongoing card transfer is stopped. The SD and PCD handles are not de-initialized.
+  * @param  hmscsd MSCSD handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_MSCSD_DeInit(MSCSD_HandleTypeDef *hmscsd)
+{
+  /* Check the MSCSD handle allocation */
+  if (hmscsd == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  if (hmscsd->State != HAL_MSCSD_STATE_RESET)
+  {
+    MSCSD_StopSd(hmscsd);
+  }
+
+  hmscsd->ErrorCode = HAL_MSCSD_ERROR_NONE;
+  hmscsd->State = HAL_MSCSD_STATE_RESET;
+
+  return HAL_OK;
+}
+
+/**
+  * @}
+  */
+
+/** @defgroup MSCSD_Exported_Functions_Group2 Read pipeline functions
+  *  @brief    Read pipeline functions
+  *
+@verbatim
+ ===============================================================================
+                      ##### Read pipeline functions #####
+ ===============================================================================
+    [..]
+    This subsection provides a set of functions allowing to :
+      (+) Serve the read commands of the mass storage class.
+      (+) Drop the blocks read in advance before the card is written.
+      (+) Follow the SD and USB transfers from their callbacks.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Send blocks of the card on the bulk IN endpoint.
+  * @note   HAL_MSCSD_ReadCpltCallback() is called once the last block is sent.
+  * @param  hmscsd MSCSD handle
+  * @param  Lba    Logical block address of the first block
+  * @param  Blocks Number of blocks, from 1
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_MSCSD_Read(MSCSD_HandleTypeDef *hmscsd, uint32_t Lba, uint32_t Blocks)
+{
+  uint32_t cardblocks = hmscsd->Init.hsd->SdCard.LogBlockNbr;
+  uint32_t end;
+  uint32_t streamend;
+  uint32_t primask_bit;
+
+  if (hmscsd->State != HAL_MSCSD_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  if ((Blocks == 0U) || (Lba >= cardblocks) || (Blocks > (cardblocks - Lba)))
+  {
+    hmscsd->ErrorCode |= HAL_MSCSD_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  /* Blocks read once the command is served, the read-ahead being limited by the card end */
+  end = Lba + Blocks;
+  end += (hmscsd->Init.ReadAhead < (cardblocks - end)) ? hmscsd->Init.ReadAhead : (cardblocks - end);
+
+  /* The ring is also updated by the SDMMC and OTG interrupts */
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  if (Lba == hmscsd->NextLba)
+  {
+    /* Sequential command: the blocks read in advance are kept */
+    if ((hmscsd->Tail != hmscsd->Fill) || (hmscsd->SdBlocks != 0U))
+    {
+      hmscsd->HitCount++;
+    }
+  }
+  else
+  {
+    if ((hmscsd->Tail != hmscsd->Fill) || (hmscsd->SdBlocks != 0U) || (hmscsd->Pending != 0U))
+    {
+      hmscsd->RestartCount++;
+    }
+
+    MSCSD_StopSd(hmscsd);
+    hmscsd->Pending = 0U;
+    hmscsd->Tail = hmscsd->Head;
+    hmscsd->Fill = hmscsd->Head;
+    hmscsd->TailOffset = 0U;
+    hmscsd->NextLba = Lba;
+    hmscsd->SdLba = Lba;
+  }
+
+  /* Extend the blocks to read up to the end of the command and its read-ahead */
+  streamend = hmscsd->SdLba + hmscsd->SdBlocks + hmscsd->Pending;
+  if (end > streamend)
+  {
+    hmscsd->Pending += end - streamend;
+  }
+
+  hmscsd->ErrorCode = HAL_MSCSD_ERROR_NONE;
+  hmscsd->CmdBlocks = Blocks;
+  hmscsd->State = HAL_MSCSD_STATE_BUSY;
+
+  MSCSD_StartSd(hmscsd);
+  MSCSD_StartUsb(hmscsd);
+
+  __set_PRIMASK(primask_bit);
+
+  return (hmscsd->State == HAL_MSCSD_STATE_ERROR) ? HAL_ERROR : HAL_OK;
+}
+
+/**
+  * @brief  Stop the card transfer and drop the blocks read in advance.
+  * @note   To be called before the card is written. The error state is also cleared.
+  * @param  hmscsd MSCSD handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_MSCSD_Flush(MSCSD_HandleTypeDef *hmscsd)
+{
+  uint32_t primask_bit;
+
+  if ((hmscsd->State == HAL_MSCSD_STATE_RESET) || (hmscsd->State == HAL_MSCSD_STATE_BUSY))
+  {
+    return HAL_BUSY;
+  }
+
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  MSCSD_StopSd(hmscsd);
+  hmscsd->Pending = 0U;
+  hmscsd->Tail = hmscsd->Head;
+  hmscsd->Fill = hmscsd->Head;
+  hmscsd->TailOffset = 0U;
+  hmscsd->SdLba = hmscsd->NextLba;
+  hmscsd->State = HAL_MSCSD_STATE_READY;
+
+  __set_PRIMASK(primask_bit);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Handle the completion of an internal DMA buffer of the card transfer.
+  * @note   To be called from HAL_SDEx_Read_DMADoubleBuf0CpltCallback() and
+  *         HAL_SDEx_Read_DMADoubleBuf1CpltCallback().
+  * @param  hmscsd MSCSD handle
+  * @retval None
+  */
+void HAL_MSCSD_SD_BufferCpltHandler(MSCSD_HandleTypeDef *hmscsd)
+{
+  uint32_t completed = hmscsd->SdBuffer;
+  uint32_t blocks = hmscsd->Init.BufferBlocks;
+
+  /* The last buffer of a transfer is also handled by HAL_MSCSD_SD_CpltHandler() */
+  if (hmscsd->SdBlocks < blocks)
+  {
+    return;
+  }
+
+  hmscsd->BufBlocks[hmscsd->Fill & (hmscsd->Init.NbBuffers - 1U)] = blocks;
+  MSCSD_InvalidateBuffer(hmscsd, hmscsd->Fill, blocks);
+  hmscsd->Fill++;
+  hmscsd->SdLba += blocks;
+  hmscsd->SdBlocks -= blocks;
+  hmscsd->SdBuffer ^= 1U;
+
+  /* The internal DMA fills the other buffer, then comes back to the completed one */
+  if (hmscsd->SdBlocks > blocks)
+  {
+    if ((hmscsd->Head - hmscsd->Tail) < hmscsd->Init.NbBuffers)
+    {
+      (void)HAL_SDEx_ChangeDMABuffer(hmscsd->Init.hsd, (completed == 0U) ? SD_DMA_BUFFER0 : SD_DMA_BUFFER1,
+                                     (uint32_t *)(void *)MSCSD_GetBuffer(hmscsd, hmscsd->Head));
+      hmscsd->Head++;
+    }
+    else
+    {
+      /* All the buffers wait for the host: stop before a buffer not yet sent is overwritten */
+      MSCSD_StopSd(hmscsd);
+      hmscsd->RestartCount++;
+    }
+  }
+
+  MSCSD_StartUsb(hmscsd);
+}
+
+/**
+  * @brief  Handle the end of the card transfer.
+  * @note   To be called from HAL_SD_RxCpltCallback().
+  * @param  hmscsd MSCSD handle
+  * @retval None
+  */
+void HAL_MSCSD_SD_CpltHandler(MSCSD_HandleTypeDef *hmscsd)
+{
+  uint32_t blocks;
+
+  /* Buffers of the transfer end not notified by their own completion */
+  while ((hmscsd->SdBlocks != 0U) && (hmscsd->Fill != hmscsd->Head))
+  {
+    blocks = (hmscsd->SdBlocks < hmscsd->Init.BufferBlocks) ? hmscsd->SdBlocks : hmscsd->Init.BufferBlocks;
+
+    hmscsd->BufBlocks[hmscsd->Fill & (hmscsd->Init.NbBuffers - 1U)] = blocks;
+    MSCSD_InvalidateBuffer(hmscsd, hmscsd->Fill, blocks);
+    hmscsd->Fill++;
+    hmscsd->SdLba += blocks;
+    hmscsd->SdBlocks -= blocks;
+  }
+
+  hmscsd->SdBlocks = 0U;
+  hmscsd->Head = hmscsd->Fill;
+
+  /* The completion of the last buffer may still be flagged */
+  __HAL_SD_CLEAR_FLAG(hmscsd->Init.hsd, SDMMC_FLAG_IDMABTC);
+
+  MSCSD_StartSd(hmscsd);
+  MSCSD_StartUsb(hmscsd);
+}
+
+/**
+  * @brief  Handle an error of the card transfer.
+  * @note   To be called from HAL_SD_ErrorCallback().
+  * @param  hmscsd MSCSD handle
+  * @retval None
+  */
+void HAL_MSCSD_SD_ErrorHandler(MSCSD_HandleTypeDef *hmscsd)
+{
+  if (hmscsd->SdBlocks != 0U)
+  {
+    MSCSD_Fail(hmscsd, HAL_MSCSD_ERROR_SD);
+  }
+}
+
+/**
+  * @brief  Handle the end of a transfer of the bulk IN endpoint.
+  * @note   To be called from HAL_PCD_DataInStageCallback(), the transfers not started
+  *         by the bridge being ignored.
+  * @param  hmscsd MSCSD handle
+  * @param  epnum  Endpoint number
+  * @retval None
+  */
+void HAL_MSCSD_PCD_DataInHandler(MSCSD_HandleTypeDef *hmscsd, uint8_t epnum)
+{
+  uint32_t sent = hmscsd->UsbBlocks;
+
+  if ((epnum != (hmscsd->Init.EpIn & EP_ADDR_MSK)) || (sent == 0U))
+  {
+    return;
+  }
+
+  hmscsd->UsbBlocks = 0U;
+  hmscsd->TailOffset += sent;
+  hmscsd->NextLba += sent;
+  hmscsd->CmdBlocks -= sent;
+
+  /* A buffer sent is given back to the card */
+  if (hmscsd->TailOffset == hmscsd->BufBlocks[hmscsd->Tail & (hmscsd->Init.NbBuffers - 1U)])
+  {
+    hmscsd->Tail++;
+    hmscsd->TailOffset = 0U;
+    MSCSD_StartSd(hmscsd);
+  }
+
+  if (hmscsd->CmdBlocks == 0U)
+  {
+    hmscsd->State = HAL_MSCSD_STATE_READY;
+
+    HAL_MSCSD_ReadCpltCallback(hmscsd);
+  }
+  else
+  {
+    MSCSD_StartUsb(hmscsd);
+  }
+}
+
+/**
+  * @brief  Read command served callback.
+  * @param  hmscsd MSCSD handle
+  * @retval None
+  */
+__weak void HAL_MSCSD_ReadCpltCallback(MSCSD_HandleTypeDef *hmscsd)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hmscsd);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_MSCSD_ReadCpltCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Bridge error callback.
+  * @param  hmscsd MSCSD handle
+  * @retval None
+  */
+__weak void HAL_MSCSD_ErrorCallback(MSCSD_HandleTypeDef *hmscsd)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hmscsd);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_MSCSD_ErrorCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @}
+  */
+
+/** @defgroup MSCSD_Exported_Functions_Group3 Peripheral State and Error functions
+  *  @brief   Peripheral State and Error functions
+  *
+@verbatim
+ ===============================================================================
+            ##### Peripheral State and Errors functions #####
+ ===============================================================================
+    [..]
+    This subsection provides functions allowing to
+      (+) Check the bridge state.
+      (+) Get the bridge error code.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Return the bridge state.
+  * @param  hmscsd MSCSD handle
+  * @retval HAL state
+  */
+HAL_MSCSD_StateTypeDef HAL_MSCSD_GetState(MSCSD_HandleTypeDef *hmscsd)
+{
+  return hmscsd->State;
+}
+
+/**
+  * @brief  Return the bridge error code.
+  * @param  hmscsd MSCSD handle
+  * @retval Error code, a value of @ref MSCSD_ErrorCode
+  */
+uint32_t HAL_MSCSD_GetError(MSCSD_HandleTypeDef *hmscsd)
+{
+  return hmscsd->ErrorCode;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  @cond 0
+  */
+/**
+  * @brief  Return the address of a buffer of the ring.
+  * @param  hmscsd MSCSD handle
+  * @param  Index  Free-running buffer index
+  * @retval Buffer address
+  */
+static uint8_t *MSCSD_GetBuffer(const MSCSD_HandleTypeDef *hmscsd, uint32_t Index)
+{
+  return &hmscsd->Init.pPool[(Index & (hmscsd->Init.NbBuffers - 1U)) * hmscsd->Init.BufferBlocks * MSCSD_BLOCK_SIZE];
+}
+
+/**
+  * @brief  Invalidate a filled buffer in the data cache when the CPU loads it into the endpoint FIFO.
+  * @param  hmscsd MSCSD handle
+  * @param  Index  Free-running buffer index
+  * @param  Blocks Number of blocks read into the buffer
+  * @retval None
+  */
+static void MSCSD_InvalidateBuffer(const MSCSD_HandleTypeDef *hmscsd, uint32_t Index, uint32_t Blocks)
+{
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  if (((SCB->CCR & SCB_CCR_DC_Msk) != 0U) && (hmscsd->Init.hpcd->Init.dma_enable == 0U))
+  {
+    SCB_InvalidateDCache_by_Addr((uint32_t *)(void *)MSCSD_GetBuffer(hmscsd, Index),
+                                 (int32_t)(Blocks * MSCSD_BLOCK_SIZE));
+  }
+#else
+  UNUSED(hmscsd);
+  UNUSED(Index);
+  UNUSED(Blocks);
+#endif /* __DCACHE_PRESENT */
+}
+
+/**
+  * @brief  Start a card transfer of the pending blocks when two buffers are free,
+  *         one when the blocks fit in a single buffer.
+  * @param  hmscsd MSCSD handle
+  * @retval None
+  */
+static void MSCSD_StartSd(MSCSD_HandleTypeDef *hmscsd)
+{
+  uint32_t needed = (hmscsd->Pending > hmscsd->Init.BufferBlocks) ? 2U : 1U;
+
+  if ((hmscsd->SdBlocks != 0U) || (hmscsd->Pending == 0U) ||
+      ((hmscsd->Init.NbBuffers - (hmscsd->Head - hmscsd->Tail)) < needed))
+  {
+    return;
+  }
+
+  /* A transfer of a single buffer never switches to the second one */
+  if (HAL_SD_ReadBlocks_DMADoubleBuffer(hmscsd->Init.hsd, MSCSD_GetBuffer(hmscsd, hmscsd->Head),
+                                        MSCSD_GetBuffer(hmscsd, hmscsd->Head + needed - 1U),
+                                        hmscsd->Init.BufferBlocks, hmscsd->SdLba, hmscsd->Pending) != HAL_OK)
+  {
+    MSCSD_Fail(hmscsd, HAL_MSCSD_ERROR_SD);
+    return;
+  }
+
+  hmscsd->Head += needed;
+  hmscsd->SdBlocks = hmscsd->Pending;
+  hmscsd->SdBuffer = 0U;
+  hmscsd->Pending = 0U;
+}
+
+/**
+  * @brief  Stop the card transfer, the blocks not yet in a filled buffer becoming pending again.
+  * @param  hmscsd MSCSD handle
+  * @retval None
+  */
+static void MSCSD_StopSd(MSCSD_HandleTypeDef *hmscsd)
+{
+  if (hmscsd->SdBlocks != 0U)
+  {
+    (void)HAL_SD_Abort(hmscsd->Init.hsd);
+
+    /* The buffers given to the internal DMA are dropped */
+    hmscsd->Pending += hmscsd->SdBlocks;
+    hmscsd->SdBlocks = 0U;
+    hmscsd->Head = hmscsd->Fill;
+  }
+}
+
+/**
+  * @brief  Send the next filled blocks of the read command on the bulk IN endpoint.
+  * @param  hmscsd MSCSD handle
+  * @retval None
+  */
+static void MSCSD_StartUsb(MSCSD_HandleTypeDef *hmscsd)
+{
+  uint32_t blocks;
+
+  if ((hmscsd->State != HAL_MSCSD_STATE_BUSY) || (hmscsd->UsbBlocks != 0U) || (hmscsd->CmdBlocks == 0U) ||
+      (hmscsd->Tail == hmscsd->Fill))
+  {
+    return;
+  }
+
+  /* A buffer may hold the end of a command and the start of the next one */
+  blocks = hmscsd->BufBlocks[hmscsd->Tail & (hmscsd->Init.NbBuffers - 1U)] - hmscsd->TailOffset;
+  if (blocks > hmscsd->CmdBlocks)
+  {
+    blocks = hmscsd->CmdBlocks;
+  }
+
+  if (HAL_PCD_EP_Transmit(hmscsd->Init.hpcd, hmscsd->Init.EpIn,
+                          &MSCSD_GetBuffer(hmscsd, hmscsd->Tail)[hmscsd->TailOffset * MSCSD_BLOCK_SIZE],
+                          blocks * MSCSD_BLOCK_SIZE) != HAL_OK)
+  {
+    MSCSD_Fail(hmscsd, HAL_MSCSD_ERROR_USB);
+    return;
+  }
+
+  hmscsd->UsbBlocks = blocks;
+}
+
+/**
+  * @brief  Stop the bridge on an error.
+  * @param  hmscsd MSCSD handle
+  * @param  Error  Error code, a value of @ref MSCSD_ErrorCode
+  * @retval None
+  */
+static void MSCSD_Fail(MSCSD_HandleTypeDef *hmscsd, uint32_t Error)
+{
+  MSCSD_StopSd(hmscsd);
+
+  hmscsd->Pending = 0U;
+  hmscsd->CmdBlocks = 0U;
+  hmscsd->ErrorCode |= Error;
+  hmscsd->State = HAL_MSCSD_STATE_ERROR;
+
+  HAL_MSCSD_ErrorCallback(hmscsd);
+}
+/**
+  @endcond
+  */
+
+#endif /* HAL_SD_MODULE_ENABLED && HAL_PCD_MODULE_ENABLED && HAL_MSCSD_MODULE_ENABLED */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
@@ -43,6 +43,15 @@
           structure. The read/write address information is contained by the Nand_Address_Typedef
           structure passed as parameter.
 
+      (+) Transfer pages without CPU copy using the functions HAL_NAND_Read_Page_8b_DMA(),
+          HAL_NAND_Write_Page_8b_DMA() and HAL_NAND_Write_MultiPlane_8b_DMA(). The MDMA
+          handle must be linked to the NAND handle with __HAL_LINKDMA(hnand, hmdma, hmdma),
+          and configured for software request and block transfer. The end of the transfer
+          is notified by HAL_NAND_XferCpltCallback() or HAL_NAND_XferErrorCallback().
+          Consecutive pages are read with the READ CACHE commands, so that the array read
+          of a page overlaps the bus transfer of the previous one, and the hardware ECC of
+          each page is captured at the end of its transfer.
+
       (+) Perform NAND flash Reset chip operation using the function HAL_NAND_Reset().
 
       (+) Perform NAND flash erase block operation using the function HAL_NAND_Erase_Block().
@@ -73,6 +82,9 @@
       it allows to register following callbacks:
         (+) MspInitCallback    : NAND MspInit.
         (+) MspDeInitCallback  : NAND MspDeInit.
+        (+) ItCallback         : NAND IT.
+        (+) XferCpltCallback   : NAND DMA Transfer Complete.
+        (+) XferErrorCallback  : NAND DMA Transfer Error.
       This function takes as parameters the HAL peripheral handle, the Callback ID
       and a pointer to the user callback function.
 
@@ -80,6 +92,9 @@
       weak (surcharged) function. It allows to reset following callbacks:
         (+) MspInitCallback    : NAND MspInit.
         (+) MspDeInitCallback  : NAND MspDeInit.
+        (+) ItCallback         : NAND IT.
+        (+) XferCpltCallback   : NAND DMA Transfer Complete.
+        (+) XferErrorCallback  : NAND DMA Transfer Error.
       This function) takes as parameters the HAL peripheral handle and the Callback ID.
 
       By default, after the HAL_NAND_Init and if the state is HAL_NAND_STATE_RESET
@@ -126,6 +141,21 @@
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
+/** @defgroup NAND_Private_Functions NAND Private Functions
+  * @{
+  */
+#if defined(HAL_MDMA_MODULE_ENABLED)
+static void              NAND_SendAddress(const NAND_HandleTypeDef *hnand, uint32_t nandaddress);
+static HAL_StatusTypeDef NAND_WaitReady(NAND_HandleTypeDef *hnand);
+static HAL_StatusTypeDef NAND_DMA_StartPage(NAND_HandleTypeDef *hnand);
+static void              NAND_DMA_XferCplt(MDMA_HandleTypeDef *hmdma);
+static void              NAND_DMA_XferError(MDMA_HandleTypeDef *hmdma);
+static void              NAND_DMA_End(NAND_HandleTypeDef *hnand, HAL_NAND_StateTypeDef State);
+#endif /* HAL_MDMA_MODULE_ENABLED */
+/**
+  * @}
+  */
+
 /* Exported functions ---------------------------------------------------------*/
 
 /** @defgroup NAND_Exported_Functions NAND Exported Functions
@@ -175,6 +205,8 @@ HAL_StatusTypeDef  HAL_NAND_Init(NAND_HandleTypeDef *hnand, FMC_NAND_PCC_TimingT
       hnand->MspInitCallback = HAL_NAND_MspInit;
     }
     hnand->ItCallback = HAL_NAND_ITCallback;
+    hnand->XferCpltCallback = HAL_NAND_XferCpltCallback;
+    hnand->XferErrorCallback = HAL_NAND_XferErrorCallback;
 
     /* Init the low level hardware */
     hnand->MspInitCallback(hnand);
@@ -1897,6 +1929,308 @@ uint32_t HAL_NAND_Address_Inc(NAND_HandleTypeDef *hnand, NAND_AddressTypeDef *pA
   return (status);
 }
 
+#if defined(HAL_MDMA_MODULE_ENABLED)
+/**
+  * @brief  Read Page(s) from NAND memory block (8-bits addressing) in DMA mode
+  * @note   The pages are read with the READ CACHE SEQUENTIAL (0x31) and READ CACHE END
+  *         (0x3F) commands: while the MDMA moves a page out of the device cache register,
+  *         the device loads the next page from its array. The pages must lie in the same
+  *         block, and a single page is read with the normal read command.
+  * @note   When pECC is not NULL the FMC ECC computation must be enabled, with an ECC
+  *         page size equal to the page size: the ECC of each page is captured in
+  *         pECC[i] at the end of its transfer, and the ECC is reset for the next page.
+  * @note   The MDMA source increment is forced to disabled. When the data cache is
+  *         enabled, pBuffer must be invalidated by the application after the transfer.
+  * @param  hnand pointer to a NAND_HandleTypeDef structure that contains
+  *                the configuration information for NAND module.
+  * @param  pAddress  pointer to NAND address structure
+  * @param  pBuffer  pointer to destination read buffer
+  * @param  NumPageToRead  number of pages to read from block
+  * @param  pECC  pointer to NumPageToRead ECC values, or NULL
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_NAND_Read_Page_8b_DMA(NAND_HandleTypeDef *hnand, const NAND_AddressTypeDef *pAddress,
+                                            uint8_t *pBuffer, uint32_t NumPageToRead, uint32_t *pECC)
+{
+  uint32_t deviceaddress;
+  uint32_t nandaddress;
+
+  if ((hnand->hmdma == NULL) || (pBuffer == NULL) || (NumPageToRead == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  /* NAND raw address calculation */
+  nandaddress = ARRAY_ADDRESS(pAddress, hnand);
+
+  /* The cache read does not cross a block boundary */
+  if (((nandaddress % hnand->Config.BlockSize) + NumPageToRead) > hnand->Config.BlockSize)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the NAND controller state */
+  if (hnand->State == HAL_NAND_STATE_BUSY)
+  {
+    return HAL_BUSY;
+  }
+  else if (hnand->State == HAL_NAND_STATE_READY)
+  {
+    /* Process Locked */
+    __HAL_LOCK(hnand);
+
+    /* Update the NAND controller state */
+    hnand->State = HAL_NAND_STATE_BUSY;
+
+    /* Identify the device address */
+    deviceaddress = NAND_DEVICE;
+
+    hnand->pXferBuffPtr    = pBuffer;
+    hnand->pXferECC        = pECC;
+    hnand->XferAddress     = nandaddress;
+    hnand->XferAddressStep = 1U;
+    hnand->XferCount       = NumPageToRead;
+    hnand->XferNbPages     = NumPageToRead;
+    hnand->XferOperation   = NAND_XFER_READ;
+
+    /* Load the first page into the device page register */
+    *(__IO uint8_t *)((uint32_t)(deviceaddress | CMD_AREA)) = NAND_CMD_AREA_A;
+    __DSB();
+    NAND_SendAddress(hnand, nandaddress);
+    *(__IO uint8_t *)((uint32_t)(deviceaddress | CMD_AREA)) = NAND_CMD_AREA_TRUE1;
+    __DSB();
+
+    if (NAND_WaitReady(hnand) != HAL_OK)
+    {
+      /* Update the NAND controller state */
+      hnand->State = HAL_NAND_STATE_ERROR;
+
+      /* Process unlocked */
+      __HAL_UNLOCK(hnand);
+
+      return HAL_TIMEOUT;
+    }
+
+    /* In Receive mode, the MDMA source is the NAND data window : Force the MDMA Source Increment to disable */
+    MODIFY_REG(hnand->hmdma->Instance->CTCR, (MDMA_CTCR_SINC | MDMA_CTCR_SINCOS), MDMA_SRC_INC_DISABLE);
+    MODIFY_REG(hnand->hmdma->Instance->CTCR, (MDMA_CTCR_DINC | MDMA_CTCR_DINCOS), MDMA_DEST_INC_BYTE);
+
+    if (NAND_DMA_StartPage(hnand) != HAL_OK)
+    {
+      /* Update the NAND controller state */
+      hnand->State = HAL_NAND_STATE_ERROR;
+
+      /* Process unlocked */
+      __HAL_UNLOCK(hnand);
+
+      return HAL_ERROR;
+    }
+
+    /* Process unlocked */
+    __HAL_UNLOCK(hnand);
+  }
+  else
+  {
+    return HAL_ERROR;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Write Page(s) to NAND memory block (8-bits addressing) in DMA mode
+  * @note   The program busy time of each page is waited for from the MDMA interrupt.
+  * @note   When pECC is not NULL the FMC ECC computation must be enabled, with an ECC
+  *         page size equal to the page size: the ECC of each page is captured in
+  *         pECC[i] before its program command is confirmed.
+  * @note   The MDMA destination increment is forced to disabled. When the data cache
+  *         is enabled, pBuffer must be cleaned by the application before the transfer.
+  * @param  hnand pointer to a NAND_HandleTypeDef structure that contains
+  *                the configuration information for NAND module.
+  * @param  pAddress  pointer to NAND address structure
+  * @param  pBuffer  pointer to source buffer to write
+  * @param  NumPageToWrite   number of pages to write to block
+  * @param  pECC  pointer to NumPageToWrite ECC values, or NULL
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_NAND_Write_Page_8b_DMA(NAND_HandleTypeDef *hnand, const NAND_AddressTypeDef *pAddress,
+                                             const uint8_t *pBuffer, uint32_t NumPageToWrite, uint32_t *pECC)
+{
+  uint32_t nandaddress;
+
+  if ((hnand->hmdma == NULL) || (pBuffer == NULL) || (NumPageToWrite == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  /* NAND raw address calculation */
+  nandaddress = ARRAY_ADDRESS(pAddress, hnand);
+
+  if ((nandaddress + NumPageToWrite) > ((hnand->Config.BlockSize) * (hnand->Config.BlockNbr)))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the NAND controller state */
+  if (hnand->State == HAL_NAND_STATE_BUSY)
+  {
+    return HAL_BUSY;
+  }
+  else if (hnand->State == HAL_NAND_STATE_READY)
+  {
+    /* Process Locked */
+    __HAL_LOCK(hnand);
+
+    /* Update the NAND controller state */
+    hnand->State = HAL_NAND_STATE_BUSY;
+
+    hnand->pXferBuffPtr    = (uint8_t *)pBuffer;
+    hnand->pXferECC        = pECC;
+    hnand->XferAddress     = nandaddress;
+    hnand->XferAddressStep = 1U;
+    hnand->XferCount       = NumPageToWrite;
+    hnand->XferNbPages     = NumPageToWrite;
+    hnand->XferOperation   = NAND_XFER_WRITE;
+
+    /* In Transmit mode, the MDMA destination is the NAND data window : Force the MDMA Destination Increment to disable */
+    MODIFY_REG(hnand->hmdma->Instance->CTCR, (MDMA_CTCR_DINC | MDMA_CTCR_DINCOS), MDMA_DEST_INC_DISABLE);
+    MODIFY_REG(hnand->hmdma->Instance->CTCR, (MDMA_CTCR_SINC | MDMA_CTCR_SINCOS), MDMA_SRC_INC_BYTE);
+
+    if (NAND_DMA_StartPage(hnand) != HAL_OK)
+    {
+      /* Update the NAND controller state */
+      hnand->State = HAL_NAND_STATE_ERROR;
+
+      /* Process unlocked */
+      __HAL_UNLOCK(hnand);
+
+      return HAL_ERROR;
+    }
+
+    /* Process unlocked */
+    __HAL_UNLOCK(hnand);
+  }
+  else
+  {
+    return HAL_ERROR;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Write one page in each plane of the NAND memory (8-bits addressing) in DMA mode
+  * @note   The pages are loaded with the multi-plane program sequence: each page but the
+  *         last one is confirmed with the PROGRAM MULTI-PLANE (0x11) command, and the last
+  *         one with the PROGRAM (0x10) command, so that a single program busy time covers
+  *         all the planes. The Page and Block fields of pAddress select the page in each
+  *         plane, the Plane field is ignored.
+  * @note   pBuffer holds Config.PlaneNbr consecutive pages, starting with plane 0.
+  *         The ECC capture and cache maintenance are as for HAL_NAND_Write_Page_8b_DMA().
+  * @param  hnand pointer to a NAND_HandleTypeDef structure that contains
+  *                the configuration information for NAND module.
+  * @param  pAddress  pointer to NAND address structure
+  * @param  pBuffer  pointer to source buffer to write
+  * @param  pECC  pointer to Config.PlaneNbr ECC values, or NULL
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_NAND_Write_MultiPlane_8b_DMA(NAND_HandleTypeDef *hnand, const NAND_AddressTypeDef *pAddress,
+                                                   const uint8_t *pBuffer, uint32_t *pECC)
+{
+  NAND_AddressTypeDef address;
+
+  if ((hnand->hmdma == NULL) || (pBuffer == NULL) || (hnand->Config.PlaneNbr < 2U) ||
+      (pAddress->Block >= hnand->Config.PlaneSize))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the NAND controller state */
+  if (hnand->State == HAL_NAND_STATE_BUSY)
+  {
+    return HAL_BUSY;
+  }
+  else if (hnand->State == HAL_NAND_STATE_READY)
+  {
+    /* Process Locked */
+    __HAL_LOCK(hnand);
+
+    /* Update the NAND controller state */
+    hnand->State = HAL_NAND_STATE_BUSY;
+
+    address.Page  = pAddress->Page;
+    address.Block = pAddress->Block;
+    address.Plane = 0U;
+
+    hnand->pXferBuffPtr    = (uint8_t *)pBuffer;
+    hnand->pXferECC        = pECC;
+    hnand->XferAddress     = ARRAY_ADDRESS(&address, hnand);
+    hnand->XferAddressStep = (hnand->Config.PlaneSize) * (hnand->Config.BlockSize);
+    hnand->XferCount       = hnand->Config.PlaneNbr;
+    hnand->XferNbPages     = hnand->Config.PlaneNbr;
+    hnand->XferOperation   = NAND_XFER_WRITE_PLANES;
+
+    /* In Transmit mode, the MDMA destination is the NAND data window : Force the MDMA Destination Increment to disable */
+    MODIFY_REG(hnand->hmdma->Instance->CTCR, (MDMA_CTCR_DINC | MDMA_CTCR_DINCOS), MDMA_DEST_INC_DISABLE);
+    MODIFY_REG(hnand->hmdma->Instance->CTCR, (MDMA_CTCR_SINC | MDMA_CTCR_SINCOS), MDMA_SRC_INC_BYTE);
+
+    if (NAND_DMA_StartPage(hnand) != HAL_OK)
+    {
+      /* Update the NAND controller state */
+      hnand->State = HAL_NAND_STATE_ERROR;
+
+      /* Process unlocked */
+      __HAL_UNLOCK(hnand);
+
+      return HAL_ERROR;
+    }
+
+    /* Process unlocked */
+    __HAL_UNLOCK(hnand);
+  }
+  else
+  {
+    return HAL_ERROR;
+  }
+
+  return HAL_OK;
+}
+#endif /* HAL_MDMA_MODULE_ENABLED */
+
+/**
+  * @brief  NAND DMA transfer complete callback
+  * @param  hnand pointer to a NAND_HandleTypeDef structure that contains
+  *                the configuration information for NAND module.
+  * @retval None
+  */
+__weak void HAL_NAND_XferCpltCallback(NAND_HandleTypeDef *hnand)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hnand);
+
+  /* NOTE : This function Should not be modified, when the callback is needed,
+            the HAL_NAND_XferCpltCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  NAND DMA transfer error callback
+  * @note   Called on MDMA error, device timeout or program failure. The NAND state is
+  *         then HAL_NAND_STATE_ERROR and XferCount gives the number of pages left.
+  * @param  hnand pointer to a NAND_HandleTypeDef structure that contains
+  *                the configuration information for NAND module.
+  * @retval None
+  */
+__weak void HAL_NAND_XferErrorCallback(NAND_HandleTypeDef *hnand)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hnand);
+
+  /* NOTE : This function Should not be modified, when the callback is needed,
+            the HAL_NAND_XferErrorCallback could be implemented in the user file
+   */
+}
+
 #if (USE_HAL_NAND_REGISTER_CALLBACKS == 1)
 /**
   * @brief  Register a User NAND Callback
@@ -1907,6 +2241,8 @@ uint32_t HAL_NAND_Address_Inc(NAND_HandleTypeDef *hnand, NAND_AddressTypeDef *pA
   *          @arg @ref HAL_NAND_MSP_INIT_CB_ID       NAND MspInit callback ID
   *          @arg @ref HAL_NAND_MSP_DEINIT_CB_ID     NAND MspDeInit callback ID
   *          @arg @ref HAL_NAND_IT_CB_ID             NAND IT callback ID
+  *          @arg @ref HAL_NAND_XFER_CPLT_CB_ID      NAND DMA transfer complete callback ID
+  *          @arg @ref HAL_NAND_XFER_ERROR_CB_ID     NAND DMA transfer error callback ID
   * @param pCallback : pointer to the Callback function
   * @retval status
   */
@@ -1936,6 +2272,12 @@ HAL_StatusTypeDef HAL_NAND_RegisterCallback(NAND_HandleTypeDef *hnand, HAL_NAND_
       case HAL_NAND_IT_CB_ID :
         hnand->ItCallback = pCallback;
         break;
+      case HAL_NAND_XFER_CPLT_CB_ID :
+        hnand->XferCpltCallback = pCallback;
+        break;
+      case HAL_NAND_XFER_ERROR_CB_ID :
+        hnand->XferErrorCallback = pCallback;
+        break;
       default :
         /* update return status */
         status =  HAL_ERROR;
@@ -1978,6 +2320,8 @@ HAL_StatusTypeDef HAL_NAND_RegisterCallback(NAND_HandleTypeDef *hnand, HAL_NAND_
   *          @arg @ref HAL_NAND_MSP_INIT_CB_ID       NAND MspInit callback ID
   *          @arg @ref HAL_NAND_MSP_DEINIT_CB_ID     NAND MspDeInit callback ID
   *          @arg @ref HAL_NAND_IT_CB_ID             NAND IT callback ID
+  *          @arg @ref HAL_NAND_XFER_CPLT_CB_ID      NAND DMA transfer complete callback ID
+  *          @arg @ref HAL_NAND_XFER_ERROR_CB_ID     NAND DMA transfer error callback ID
   * @retval status
   */
 HAL_StatusTypeDef HAL_NAND_UnRegisterCallback(NAND_HandleTypeDef *hnand, HAL_NAND_CallbackIDTypeDef CallbackId)
@@ -2000,6 +2344,12 @@ HAL_StatusTypeDef HAL_NAND_UnRegisterCallback(NAND_HandleTypeDef *hnand, HAL_NAN
       case HAL_NAND_IT_CB_ID :
         hnand->ItCallback = HAL_NAND_ITCallback;
         break;
+      case HAL_NAND_XFER_CPLT_CB_ID :
+        hnand->XferCpltCallback = HAL_NAND_XferCpltCallback;
+        break;
+      case HAL_NAND_XFER_ERROR_CB_ID :
+        hnand->XferErrorCallback = HAL_NAND_XferErrorCallback;
+        break;
       default :
         /* update return status */
         status =  HAL_ERROR;
@@ -2225,6 +2575,234 @@ uint32_t HAL_NAND_Read_Status(NAND_HandleTypeDef *hnand)
   * @}
   */
 
+/**
+  * @}
+  */
+
+/** @addtogroup NAND_Private_Functions
+  * @{
+  */
+
+#if defined(HAL_MDMA_MODULE_ENABLED)
+/**
+  * @brief  Send the address cycles of a page, the column address being 0.
+  * @param  hnand pointer to a NAND_HandleTypeDef structure that contains
+  *                the configuration information for NAND module.
+  * @param  nandaddress NAND raw address of the page
+  * @retval None
+  */
+static void NAND_SendAddress(const NAND_HandleTypeDef *hnand, uint32_t nandaddress)
+{
+  uint32_t deviceaddress = NAND_DEVICE;
+
+  *(__IO uint8_t *)((uint32_t)(deviceaddress | ADDR_AREA)) = 0x00U;
+  __DSB();
+
+  /* Cards with page size > 512 bytes have two column cycles */
+  if ((hnand->Config.PageSize) > 512U)
+  {
+    *(__IO uint8_t *)((uint32_t)(deviceaddress | ADDR_AREA)) = 0x00U;
+    __DSB();
+  }
+
+  *(__IO uint8_t *)((uint32_t)(deviceaddress | ADDR_AREA)) = ADDR_1ST_CYCLE(nandaddress);
+  __DSB();
+  *(__IO uint8_t *)((uint32_t)(deviceaddress | ADDR_AREA)) = ADDR_2ND_CYCLE(nandaddress);
+  __DSB();
+
+  if (((hnand->Config.BlockSize) * (hnand->Config.BlockNbr)) > 65535U)
+  {
+    *(__IO uint8_t *)((uint32_t)(deviceaddress | ADDR_AREA)) = ADDR_3RD_CYCLE(nandaddress);
+    __DSB();
+  }
+}
+
+/**
+  * @brief  Wait for the end of the device busy time.
+  * @param  hnand pointer to a NAND_HandleTypeDef structure that contains
+  *                the configuration information for NAND module.
+  * @retval HAL status, HAL_ERROR when the device reports a failed operation
+  */
+static HAL_StatusTypeDef NAND_WaitReady(NAND_HandleTypeDef *hnand)
+{
+  uint32_t tickstart;
+  uint32_t status;
+
+  /* Get tick */
+  tickstart = HAL_GetTick();
+
+  /* Read status until NAND is ready */
+  status = HAL_NAND_Read_Status(hnand);
+  while (status == NAND_BUSY)
+  {
+    if ((HAL_GetTick() - tickstart) > NAND_WRITE_TIMEOUT)
+    {
+      return HAL_TIMEOUT;
+    }
+    status = HAL_NAND_Read_Status(hnand);
+  }
+
+  return (status == NAND_READY) ? HAL_OK : HAL_ERROR;
+}
+
+/**
+  * @brief  Issue the commands of the current page and start its MDMA transfer.
+  * @param  hnand pointer to a NAND_HandleTypeDef structure that contains
+  *                the configuration information for NAND module.
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef NAND_DMA_StartPage(NAND_HandleTypeDef *hnand)
+{
+  uint32_t deviceaddress = NAND_DEVICE;
+  uint32_t srcaddress;
+  uint32_t dstaddress;
+
+  if (hnand->XferOperation == NAND_XFER_READ)
+  {
+    /* Cache read: move the loaded page to the cache register and start loading the next one */
+    if (hnand->XferNbPages > 1U)
+    {
+      *(__IO uint8_t *)((uint32_t)(deviceaddress | CMD_AREA)) = (hnand->XferCount == 1U) ?
+                                                                 NAND_CMD_READ_CACHE_END : NAND_CMD_READ_CACHE_SEQ;
+      __DSB();
+
+      if (NAND_WaitReady(hnand) != HAL_OK)
+      {
+        return HAL_ERROR;
+      }
+    }
+
+    /* Go back to read mode after the status polling */
+    *(__IO uint8_t *)((uint32_t)(deviceaddress | CMD_AREA)) = NAND_CMD_AREA_A;
+    __DSB();
+
+    srcaddress = deviceaddress;
+    dstaddress = (uint32_t)hnand->pXferBuffPtr;
+  }
+  else
+  {
+    /* Send write page command sequence */
+    *(__IO uint8_t *)((uint32_t)(deviceaddress | CMD_AREA)) = NAND_CMD_AREA_A;
+    __DSB();
+    *(__IO uint8_t *)((uint32_t)(deviceaddress | CMD_AREA)) = NAND_CMD_WRITE0;
+    __DSB();
+    NAND_SendAddress(hnand, hnand->XferAddress);
+
+    srcaddress = (uint32_t)hnand->pXferBuffPtr;
+    dstaddress = deviceaddress;
+  }
+
+  /* Restart the ECC computation on the page data only */
+  if (hnand->pXferECC != NULL)
+  {
+    (void)FMC_NAND_ECC_Disable(hnand->Instance, hnand->Init.NandBank);
+    (void)FMC_NAND_ECC_Enable(hnand->Instance, hnand->Init.NandBank);
+  }
+
+  hnand->hmdma->XferCpltCallback = NAND_DMA_XferCplt;
+  hnand->hmdma->XferErrorCallback = NAND_DMA_XferError;
+  hnand->hmdma->XferAbortCallback = NULL;
+
+  return HAL_MDMA_Start_IT(hnand->hmdma, srcaddress, dstaddress, hnand->Config.PageSize, 1U);
+}
+
+/**
+  * @brief  MDMA NAND page transfer complete callback.
+  * @param  hmdma MDMA handle
+  * @retval None
+  */
+static void NAND_DMA_XferCplt(MDMA_HandleTypeDef *hmdma)
+{
+  NAND_HandleTypeDef *hnand = (NAND_HandleTypeDef *)(hmdma->Parent);
+  uint32_t deviceaddress = NAND_DEVICE;
+
+  /* Capture the ECC of the page before any status read */
+  if (hnand->pXferECC != NULL)
+  {
+    if (FMC_NAND_GetECC(hnand->Instance, hnand->pXferECC, hnand->Init.NandBank, NAND_WRITE_TIMEOUT) != HAL_OK)
+    {
+      NAND_DMA_End(hnand, HAL_NAND_STATE_ERROR);
+      return;
+    }
+    hnand->pXferECC++;
+  }
+
+  if (hnand->XferOperation != NAND_XFER_READ)
+  {
+    /* Confirm the page, the planes but the last one being only loaded */
+    *(__IO uint8_t *)((uint32_t)(deviceaddress | CMD_AREA)) =
+      ((hnand->XferOperation == NAND_XFER_WRITE_PLANES) && (hnand->XferCount != 1U)) ?
+      NAND_CMD_WRITE_PLANE : NAND_CMD_WRITE_TRUE1;
+    __DSB();
+
+    if (NAND_WaitReady(hnand) != HAL_OK)
+    {
+      NAND_DMA_End(hnand, HAL_NAND_STATE_ERROR);
+      return;
+    }
+  }
+
+  hnand->XferCount--;
+  hnand->pXferBuffPtr += hnand->Config.PageSize;
+  hnand->XferAddress += hnand->XferAddressStep;
+
+  if (hnand->XferCount == 0U)
+  {
+    NAND_DMA_End(hnand, HAL_NAND_STATE_READY);
+  }
+  else if (NAND_DMA_StartPage(hnand) != HAL_OK)
+  {
+    NAND_DMA_End(hnand, HAL_NAND_STATE_ERROR);
+  }
+  else
+  {
+    /* Next page transfer ongoing */
+  }
+}
+
+/**
+  * @brief  MDMA NAND page transfer error callback.
+  * @param  hmdma MDMA handle
+  * @retval None
+  */
+static void NAND_DMA_XferError(MDMA_HandleTypeDef *hmdma)
+{
+  NAND_HandleTypeDef *hnand = (NAND_HandleTypeDef *)(hmdma->Parent);
+
+  NAND_DMA_End(hnand, HAL_NAND_STATE_ERROR);
+}
+
+/**
+  * @brief  End a NAND DMA transfer and notify the application.
+  * @param  hnand pointer to a NAND_HandleTypeDef structure that contains
+  *                the configuration information for NAND module.
+  * @param  State NAND state at the end of the transfer
+  * @retval None
+  */
+static void NAND_DMA_End(NAND_HandleTypeDef *hnand, HAL_NAND_StateTypeDef State)
+{
+  /* Update the NAND controller state */
+  hnand->State = State;
+
+  if (State == HAL_NAND_STATE_READY)
+  {
+#if (USE_HAL_NAND_REGISTER_CALLBACKS == 1)
+    hnand->XferCpltCallback(hnand);
+#else
+    HAL_NAND_XferCpltCallback(hnand);
+#endif /* (USE_HAL_NAND_REGISTER_CALLBACKS) */
+  }
+  else
+  {
+#if (USE_HAL_NAND_REGISTER_CALLBACKS == 1)
+    hnand->XferErrorCallback(hnand);
+#else
+    HAL_NAND_XferErrorCallback(hnand);
+#endif /* (USE_HAL_NAND_REGISTER_CALLBACKS) */
+  }
+}
+#endif /* HAL_MDMA_MODULE_ENABLED */
+
 /**
   * @}
   */
@@ -36,6 +36,13 @@
       (+) Access NOR flash memory by read/write data unit operations using the functions
           HAL_NOR_Read(), HAL_NOR_Program().
 
+      (+) Program large areas without status polling using HAL_NOR_ProgramStream_IT():
+          the data is split in write buffer programs, each one started from
+          HAL_NOR_ProgramStream_IRQHandler(). This handler is to be called by the
+          application on the rising edge of the NOR RDY/BSY pin, usually from
+          HAL_GPIO_EXTI_Callback(). The end of the programming is notified by
+          HAL_NOR_ProgramCpltCallback() or HAL_NOR_ProgramErrorCallback().
+
       (+) Perform NOR flash erase block/chip operations using the functions
           HAL_NOR_Erase_Block() and HAL_NOR_Erase_Chip().
 
@@ -46,6 +53,9 @@
       (+) You can also control the NOR device by calling the control APIs HAL_NOR_WriteOperation_Enable()/
           HAL_NOR_WriteOperation_Disable() to respectively enable/disable the NOR write operation
 
+      (+) Switch the reads to synchronous burst mode with the wait signal, e.g. for code
+          execution from the NOR, using HAL_NOR_ConfigBurstRead().
+
       (+) You can monitor the NOR device HAL state by calling the function
           HAL_NOR_GetState()
     [..]
@@ -70,6 +80,8 @@
       it allows to register following callbacks:
         (+) MspInitCallback    : NOR MspInit.
         (+) MspDeInitCallback  : NOR MspDeInit.
+        (+) ProgramCpltCallback  : NOR Streamed Program Complete.
+        (+) ProgramErrorCallback : NOR Streamed Program Error.
       This function takes as parameters the HAL peripheral handle, the Callback ID
       and a pointer to the user callback function.
 
@@ -77,6 +89,8 @@
       weak (surcharged) function. It allows to reset following callbacks:
         (+) MspInitCallback    : NOR MspInit.
         (+) MspDeInitCallback  : NOR MspDeInit.
+        (+) ProgramCpltCallback  : NOR Streamed Program Complete.
+        (+) ProgramErrorCallback : NOR Streamed Program Error.
       This function) takes as parameters the HAL peripheral handle and the Callback ID.
 
       By default, after the HAL_NOR_Init and if the state is HAL_NOR_STATE_RESET
@@ -158,6 +172,7 @@
 #define NOR_CMD_BLOCK_UNLOCK                  (uint16_t)0x0060
 #define NOR_CMD_READ_STATUS_REG               (uint16_t)0x0070
 #define NOR_CMD_CLEAR_STATUS_REG              (uint16_t)0x0050
+#define NOR_CMD_SET_READ_CONFIG               (uint16_t)0x0003
 
 /* Mask on NOR STATUS REGISTER */
 #define NOR_MASK_STATUS_DQ4                   (uint16_t)0x0010
@@ -196,7 +211,19 @@ static uint32_t uwNORMemoryDataWidth  = NOR_MEMORY_8B;
   * @}
   */
 
-/* Private functions ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+/** @defgroup NOR_Private_Functions NOR Private Functions
+  * @{
+  */
+static uint32_t              NOR_GetDeviceAddress(const NOR_HandleTypeDef *hnor);
+static HAL_StatusTypeDef     NOR_LoadBuffer(const NOR_HandleTypeDef *hnor, uint32_t deviceaddress, uint32_t uwAddress,
+                                            const uint16_t *pData, uint32_t uwBufferSize);
+static HAL_NOR_StatusTypeDef NOR_CheckStatus(const NOR_HandleTypeDef *hnor, uint32_t Address);
+static void                  NOR_StreamNext(NOR_HandleTypeDef *hnor);
+/**
+  * @}
+  */
+
 /* Exported functions --------------------------------------------------------*/
 /** @defgroup NOR_Exported_Functions NOR Exported Functions
   * @{
@@ -247,6 +274,8 @@ HAL_StatusTypeDef HAL_NOR_Init(NOR_HandleTypeDef *hnor, FMC_NORSRAM_TimingTypeDe
     {
       hnor->MspInitCallback = HAL_NOR_MspInit;
     }
+    hnor->ProgramCpltCallback = HAL_NOR_ProgramCpltCallback;
+    hnor->ProgramErrorCallback = HAL_NOR_ProgramErrorCallback;
 
     /* Init the low level hardware */
     hnor->MspInitCallback(hnor);
@@ -868,11 +897,8 @@ HAL_StatusTypeDef HAL_NOR_ReadBuffer(NOR_HandleTypeDef *hnor, uint32_t uwAddress
 HAL_StatusTypeDef HAL_NOR_ProgramBuffer(NOR_HandleTypeDef *hnor, uint32_t uwAddress, uint16_t *pData,
                                         uint32_t uwBufferSize)
 {
-  uint16_t *p_currentaddress;
-  const uint16_t *p_endaddress;
-  uint16_t *data = pData;
   uint32_t deviceaddress;
-  HAL_StatusTypeDef status = HAL_OK;
+  HAL_StatusTypeDef status;
 
   /* Check the NOR controller state */
   if (hnor->State == HAL_NOR_STATE_BUSY)
@@ -905,55 +931,75 @@ HAL_StatusTypeDef HAL_NOR_ProgramBuffer(NOR_HandleTypeDef *hnor, uint32_t uwAddr
       deviceaddress = NOR_MEMORY_ADRESS4;
     }
 
-    /* Initialize variables */
-    p_currentaddress  = (uint16_t *)(deviceaddress + uwAddress);
-    p_endaddress      = (uint16_t *)(deviceaddress + uwAddress + (2U * (uwBufferSize - 1U)));
+    /* Load the write buffer and start its programming */
+    status = NOR_LoadBuffer(hnor, deviceaddress, uwAddress, pData, uwBufferSize);
 
-    if (hnor->CommandSet == NOR_AMD_FUJITSU_COMMAND_SET)
-    {
-      /* Issue unlock command sequence */
-      NOR_WRITE(NOR_ADDR_SHIFT(deviceaddress, uwNORMemoryDataWidth, NOR_CMD_ADDRESS_FIRST), NOR_CMD_DATA_FIRST);
-      NOR_WRITE(NOR_ADDR_SHIFT(deviceaddress, uwNORMemoryDataWidth, NOR_CMD_ADDRESS_SECOND), NOR_CMD_DATA_SECOND);
+    /* Check the NOR controller state */
+    hnor->State = HAL_NOR_STATE_READY;
 
-      /* Write Buffer Load Command */
-      NOR_WRITE((deviceaddress + uwAddress), NOR_CMD_DATA_BUFFER_AND_PROG);
-      NOR_WRITE((deviceaddress + uwAddress), (uint16_t)(uwBufferSize - 1U));
-    }
-    else if (hnor->CommandSet == NOR_INTEL_SHARP_EXT_COMMAND_SET)
-    {
-      /* Write Buffer Load Command */
-      NOR_WRITE((deviceaddress + uwAddress), NOR_CMD_BUFFERED_PROGRAM);
-      NOR_WRITE((deviceaddress + uwAddress), (uint16_t)(uwBufferSize - 1U));
-    }
-    else
-    {
-      /* Primary command set not supported by the driver */
-      status = HAL_ERROR;
-    }
+    /* Process unlocked */
+    __HAL_UNLOCK(hnor);
+  }
+  else
+  {
+    return HAL_ERROR;
+  }
 
-    if (status != HAL_ERROR)
-    {
-      /* Load Data into NOR Buffer */
-      while (p_currentaddress <= p_endaddress)
-      {
-        NOR_WRITE(p_currentaddress, *data);
+  return status;
 
-        data++;
-        p_currentaddress ++;
-      }
+}
 
-      if (hnor->CommandSet == NOR_AMD_FUJITSU_COMMAND_SET)
-      {
-        NOR_WRITE((deviceaddress + uwAddress), NOR_CMD_DATA_BUFFER_AND_PROG_CONFIRM);
-      }
-      else /* => hnor->CommandSet == NOR_INTEL_SHARP_EXT_COMMAND_SET */
-      {
-        NOR_WRITE((deviceaddress + uwAddress), NOR_CMD_CONFIRM);
-      }
-    }
+/**
+  * @brief  Start programming a data stream to the NOR memory, one write buffer at a time.
+  * @note   The stream is split in write buffer programs aligned on uwBufferSize
+  *         half-words. Each one is started by HAL_NOR_ProgramStream_IRQHandler(), to be
+  *         called on the rising edge of the RDY/BSY pin: the CPU is free while the
+  *         device is programming. The first buffer is started by this function.
+  * @note   pData must remain valid until the end of the programming.
+  * @param  hnor pointer to the NOR handle
+  * @param  uwAddress NOR memory internal start write address, half-word aligned
+  * @param  pData pointer to source data buffer
+  * @param  uwSize Number of half-words to program
+  * @param  uwBufferSize Device write buffer size (in half-words), a power of 2,
+  *         e.g. 32 for the S29GL128P
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_NOR_ProgramStream_IT(NOR_HandleTypeDef *hnor, uint32_t uwAddress, const uint16_t *pData,
+                                           uint32_t uwSize, uint32_t uwBufferSize)
+{
+  if ((pData == NULL) || (uwSize == 0U) || (uwBufferSize == 0U) || ((uwBufferSize & (uwBufferSize - 1U)) != 0U) ||
+      ((uwAddress & 1U) != 0U))
+  {
+    return HAL_ERROR;
+  }
 
-    /* Check the NOR controller state */
-    hnor->State = HAL_NOR_STATE_READY;
+  if ((hnor->CommandSet != NOR_AMD_FUJITSU_COMMAND_SET) && (hnor->CommandSet != NOR_INTEL_SHARP_EXT_COMMAND_SET))
+  {
+    /* Primary command set not supported by the driver */
+    return HAL_ERROR;
+  }
+
+  /* Check the NOR controller state */
+  if (hnor->State == HAL_NOR_STATE_BUSY)
+  {
+    return HAL_BUSY;
+  }
+  else if (hnor->State == HAL_NOR_STATE_READY)
+  {
+    /* Process Locked */
+    __HAL_LOCK(hnor);
+
+    /* Update the NOR controller state */
+    hnor->State = HAL_NOR_STATE_BUSY;
+
+    hnor->pStreamData      = pData;
+    hnor->StreamAddress    = uwAddress;
+    hnor->StreamChunk      = 0U;
+    hnor->StreamCount      = uwSize;
+    hnor->StreamBufferSize = uwBufferSize;
+
+    /* Start the first buffer program */
+    NOR_StreamNext(hnor);
 
     /* Process unlocked */
     __HAL_UNLOCK(hnor);
@@ -963,8 +1009,131 @@ HAL_StatusTypeDef HAL_NOR_ProgramBuffer(NOR_HandleTypeDef *hnor, uint32_t uwAddr
     return HAL_ERROR;
   }
 
-  return status;
+  return HAL_OK;
+}
+
+/**
+  * @brief  Abort a streamed program, e.g. when no RDY/BSY edge came in time.
+  * @note   The buffer being programmed, if any, is not interrupted. StreamCount gives
+  *         the number of half-words not yet known as programmed.
+  * @param  hnor pointer to the NOR handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_NOR_ProgramStream_Abort(NOR_HandleTypeDef *hnor)
+{
+  if ((hnor->State != HAL_NOR_STATE_BUSY) || (hnor->pStreamData == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  hnor->pStreamData = NULL;
 
+  /* Update the NOR controller state */
+  hnor->State = HAL_NOR_STATE_READY;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Handle the end of a write buffer program of a streamed program.
+  * @note   To be called by the application on the rising edge of the RDY/BSY pin.
+  *         Edges received while no streamed program is ongoing, or before the device
+  *         reports the end of the buffer program, are ignored.
+  * @param  hnor pointer to the NOR handle
+  * @retval None
+  */
+void HAL_NOR_ProgramStream_IRQHandler(NOR_HandleTypeDef *hnor)
+{
+  uint32_t deviceaddress;
+  HAL_NOR_StatusTypeDef status;
+
+  if ((hnor->State != HAL_NOR_STATE_BUSY) || (hnor->pStreamData == NULL))
+  {
+    return;
+  }
+
+  deviceaddress = NOR_GetDeviceAddress(hnor);
+
+  status = NOR_CheckStatus(hnor, deviceaddress + hnor->StreamAddress);
+  if (status == HAL_NOR_STATUS_ONGOING)
+  {
+    return;
+  }
+
+  if (status != HAL_NOR_STATUS_SUCCESS)
+  {
+    hnor->pStreamData = NULL;
+
+    /* Update the NOR controller state */
+    hnor->State = HAL_NOR_STATE_READY;
+
+#if (USE_HAL_NOR_REGISTER_CALLBACKS == 1)
+    hnor->ProgramErrorCallback(hnor);
+#else
+    HAL_NOR_ProgramErrorCallback(hnor);
+#endif /* (USE_HAL_NOR_REGISTER_CALLBACKS) */
+    return;
+  }
+
+  /* Buffer programmed */
+  hnor->pStreamData   += hnor->StreamChunk;
+  hnor->StreamAddress += 2U * hnor->StreamChunk;
+  hnor->StreamCount   -= hnor->StreamChunk;
+
+  if (hnor->StreamCount != 0U)
+  {
+    NOR_StreamNext(hnor);
+  }
+  else
+  {
+    hnor->pStreamData = NULL;
+
+    /* Leave the status read mode */
+    if (hnor->CommandSet == NOR_INTEL_SHARP_EXT_COMMAND_SET)
+    {
+      NOR_WRITE(deviceaddress, NOR_CMD_READ_ARRAY);
+    }
+
+    /* Update the NOR controller state */
+    hnor->State = HAL_NOR_STATE_READY;
+
+#if (USE_HAL_NOR_REGISTER_CALLBACKS == 1)
+    hnor->ProgramCpltCallback(hnor);
+#else
+    HAL_NOR_ProgramCpltCallback(hnor);
+#endif /* (USE_HAL_NOR_REGISTER_CALLBACKS) */
+  }
+}
+
+/**
+  * @brief  NOR streamed program complete callback.
+  * @param  hnor pointer to the NOR handle
+  * @retval None
+  */
+__weak void HAL_NOR_ProgramCpltCallback(NOR_HandleTypeDef *hnor)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hnor);
+
+  /* NOTE : This function Should not be modified, when the callback is needed,
+            the HAL_NOR_ProgramCpltCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  NOR streamed program error callback.
+  * @note   StreamAddress gives the address of the write buffer that failed.
+  * @param  hnor pointer to the NOR handle
+  * @retval None
+  */
+__weak void HAL_NOR_ProgramErrorCallback(NOR_HandleTypeDef *hnor)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hnor);
+
+  /* NOTE : This function Should not be modified, when the callback is needed,
+            the HAL_NOR_ProgramErrorCallback could be implemented in the user file
+   */
 }
 
 /**
@@ -1209,6 +1378,8 @@ HAL_StatusTypeDef HAL_NOR_Read_CFI(NOR_HandleTypeDef *hnor, NOR_CFITypeDef *pNOR
   *        This parameter can be one of the following values:
   *          @arg @ref HAL_NOR_MSP_INIT_CB_ID       NOR MspInit callback ID
   *          @arg @ref HAL_NOR_MSP_DEINIT_CB_ID     NOR MspDeInit callback ID
+  *          @arg @ref HAL_NOR_PROGRAM_CPLT_CB_ID   NOR Streamed Program Complete callback ID
+  *          @arg @ref HAL_NOR_PROGRAM_ERROR_CB_ID  NOR Streamed Program Error callback ID
   * @param pCallback : pointer to the Callback function
   * @retval status
   */
@@ -1237,6 +1408,12 @@ HAL_StatusTypeDef HAL_NOR_RegisterCallback(NOR_HandleTypeDef *hnor, HAL_NOR_Call
       case HAL_NOR_MSP_DEINIT_CB_ID :
         hnor->MspDeInitCallback = pCallback;
         break;
+      case HAL_NOR_PROGRAM_CPLT_CB_ID :
+        hnor->ProgramCpltCallback = pCallback;
+        break;
+      case HAL_NOR_PROGRAM_ERROR_CB_ID :
+        hnor->ProgramErrorCallback = pCallback;
+        break;
       default :
         /* update return status */
         status =  HAL_ERROR;
@@ -1262,6 +1439,8 @@ HAL_StatusTypeDef HAL_NOR_RegisterCallback(NOR_HandleTypeDef *hnor, HAL_NOR_Call
   *        This parameter can be one of the following values:
   *          @arg @ref HAL_NOR_MSP_INIT_CB_ID       NOR MspInit callback ID
   *          @arg @ref HAL_NOR_MSP_DEINIT_CB_ID     NOR MspDeInit callback ID
+  *          @arg @ref HAL_NOR_PROGRAM_CPLT_CB_ID   NOR Streamed Program Complete callback ID
+  *          @arg @ref HAL_NOR_PROGRAM_ERROR_CB_ID  NOR Streamed Program Error callback ID
   * @retval status
   */
 HAL_StatusTypeDef HAL_NOR_UnRegisterCallback(NOR_HandleTypeDef *hnor, HAL_NOR_CallbackIDTypeDef CallbackId)
@@ -1283,6 +1462,12 @@ HAL_StatusTypeDef HAL_NOR_UnRegisterCallback(NOR_HandleTypeDef *hnor, HAL_NOR_Ca
       case HAL_NOR_MSP_DEINIT_CB_ID :
         hnor->MspDeInitCallback = HAL_NOR_MspDeInit;
         break;
+      case HAL_NOR_PROGRAM_CPLT_CB_ID :
+        hnor->ProgramCpltCallback = HAL_NOR_ProgramCpltCallback;
+        break;
+      case HAL_NOR_PROGRAM_ERROR_CB_ID :
+        hnor->ProgramErrorCallback = HAL_NOR_ProgramErrorCallback;
+        break;
       default :
         /* update return status */
         status =  HAL_ERROR;
@@ -1388,6 +1573,82 @@ HAL_StatusTypeDef HAL_NOR_WriteOperation_Disable(NOR_HandleTypeDef *hnor)
   return HAL_OK;
 }
 
+/**
+  * @brief  Switch the NOR reads to synchronous burst mode.
+  * @note   The device read configuration register is first written with DeviceConfig,
+  *         while the reads are still asynchronous. This is only supported for the
+  *         Intel/Sharp extended command set: for other devices, configure the device
+  *         beforehand and pass NOR_BURST_CONFIG_NONE.
+  * @note   The FMC bank is then reconfigured with the burst mode and the wait signal
+  *         enabled, the wait signal polarity and timing being taken from hnor->Init.
+  *         Writes stay asynchronous, so that the program and erase services remain
+  *         usable.
+  * @param  hnor pointer to a NOR_HandleTypeDef structure that contains
+  *                the configuration information for NOR module.
+  * @param  Timing pointer to NOR timing structure, CLKDivision and DataLatency
+  *         matching the latency programmed in the device
+  * @param  DeviceConfig value of the device read configuration register, or
+  *         NOR_BURST_CONFIG_NONE
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_NOR_ConfigBurstRead(NOR_HandleTypeDef *hnor, FMC_NORSRAM_TimingTypeDef *Timing,
+                                          uint32_t DeviceConfig)
+{
+  uint32_t deviceaddress;
+
+  if (Timing == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  if ((DeviceConfig != NOR_BURST_CONFIG_NONE) &&
+      ((hnor->CommandSet != NOR_INTEL_SHARP_EXT_COMMAND_SET) || (DeviceConfig > 0xFFFFU)))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the NOR controller state */
+  if (hnor->State == HAL_NOR_STATE_READY)
+  {
+    /* Process Locked */
+    __HAL_LOCK(hnor);
+
+    /* Update the NOR controller state */
+    hnor->State = HAL_NOR_STATE_BUSY;
+
+    deviceaddress = NOR_GetDeviceAddress(hnor);
+
+    if (DeviceConfig != NOR_BURST_CONFIG_NONE)
+    {
+      /* Set Read Configuration Register : the register value is given on the address bus */
+      NOR_WRITE(NOR_ADDR_SHIFT(deviceaddress, uwNORMemoryDataWidth, DeviceConfig), NOR_CMD_BLOCK_UNLOCK);
+      NOR_WRITE(NOR_ADDR_SHIFT(deviceaddress, uwNORMemoryDataWidth, DeviceConfig), NOR_CMD_SET_READ_CONFIG);
+      NOR_WRITE(deviceaddress, NOR_CMD_READ_ARRAY);
+    }
+
+    hnor->Init.BurstAccessMode = FMC_BURST_ACCESS_MODE_ENABLE;
+    hnor->Init.WaitSignal      = FMC_WAIT_SIGNAL_ENABLE;
+    hnor->Init.WriteBurst      = FMC_WRITE_BURST_DISABLE;
+
+    /* Reconfigure the bank, which is disabled meanwhile */
+    (void)FMC_NORSRAM_Init(hnor->Instance, &(hnor->Init));
+    (void)FMC_NORSRAM_Timing_Init(hnor->Instance, Timing, hnor->Init.NSBank);
+    __FMC_NORSRAM_ENABLE(hnor->Instance, hnor->Init.NSBank);
+
+    /* Update the NOR controller state */
+    hnor->State = HAL_NOR_STATE_READY;
+
+    /* Process unlocked */
+    __HAL_UNLOCK(hnor);
+  }
+  else
+  {
+    return HAL_ERROR;
+  }
+
+  return HAL_OK;
+}
+
 /**
   * @}
   */
@@ -1528,6 +1789,193 @@ HAL_NOR_StatusTypeDef HAL_NOR_GetStatus(NOR_HandleTypeDef *hnor, uint32_t Addres
   * @}
   */
 
+/**
+  * @}
+  */
+
+/** @addtogroup NOR_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Return the base address of the NOR bank.
+  * @param  hnor pointer to the NOR handle
+  * @retval NOR bank base address
+  */
+static uint32_t NOR_GetDeviceAddress(const NOR_HandleTypeDef *hnor)
+{
+  uint32_t deviceaddress;
+
+  /* Select the NOR device address */
+  if (hnor->Init.NSBank == FMC_NORSRAM_BANK1)
+  {
+    deviceaddress = NOR_MEMORY_ADRESS1;
+  }
+  else if (hnor->Init.NSBank == FMC_NORSRAM_BANK2)
+  {
+    deviceaddress = NOR_MEMORY_ADRESS2;
+  }
+  else if (hnor->Init.NSBank == FMC_NORSRAM_BANK3)
+  {
+    deviceaddress = NOR_MEMORY_ADRESS3;
+  }
+  else /* FMC_NORSRAM_BANK4 */
+  {
+    deviceaddress = NOR_MEMORY_ADRESS4;
+  }
+
+  return deviceaddress;
+}
+
+/**
+  * @brief  Load the device write buffer and start its programming.
+  * @param  hnor pointer to the NOR handle
+  * @param  deviceaddress NOR bank base address
+  * @param  uwAddress NOR memory internal start write address
+  * @param  pData pointer to source data buffer
+  * @param  uwBufferSize Number of half-words to write
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef NOR_LoadBuffer(const NOR_HandleTypeDef *hnor, uint32_t deviceaddress, uint32_t uwAddress,
+                                        const uint16_t *pData, uint32_t uwBufferSize)
+{
+  uint16_t *p_currentaddress;
+  const uint16_t *p_endaddress;
+  const uint16_t *data = pData;
+  HAL_StatusTypeDef status = HAL_OK;
+
+  /* Initialize variables */
+  p_currentaddress  = (uint16_t *)(deviceaddress + uwAddress);
+  p_endaddress      = (uint16_t *)(deviceaddress + uwAddress + (2U * (uwBufferSize - 1U)));
+
+  if (hnor->CommandSet == NOR_AMD_FUJITSU_COMMAND_SET)
+  {
+    /* Issue unlock command sequence */
+    NOR_WRITE(NOR_ADDR_SHIFT(deviceaddress, uwNORMemoryDataWidth, NOR_CMD_ADDRESS_FIRST), NOR_CMD_DATA_FIRST);
+    NOR_WRITE(NOR_ADDR_SHIFT(deviceaddress, uwNORMemoryDataWidth, NOR_CMD_ADDRESS_SECOND), NOR_CMD_DATA_SECOND);
+
+    /* Write Buffer Load Command */
+    NOR_WRITE((deviceaddress + uwAddress), NOR_CMD_DATA_BUFFER_AND_PROG);
+    NOR_WRITE((deviceaddress + uwAddress), (uint16_t)(uwBufferSize - 1U));
+  }
+  else if (hnor->CommandSet == NOR_INTEL_SHARP_EXT_COMMAND_SET)
+  {
+    /* Write Buffer Load Command */
+    NOR_WRITE((deviceaddress + uwAddress), NOR_CMD_BUFFERED_PROGRAM);
+    NOR_WRITE((deviceaddress + uwAddress), (uint16_t)(uwBufferSize - 1U));
+  }
+  else
+  {
+    /* Primary command set not supported by the driver */
+    status = HAL_ERROR;
+  }
+
+  if (status != HAL_ERROR)
+  {
+    /* Load Data into NOR Buffer */
+    while (p_currentaddress <= p_endaddress)
+    {
+      NOR_WRITE(p_currentaddress, *data);
+
+      data++;
+      p_currentaddress ++;
+    }
+
+    if (hnor->CommandSet == NOR_AMD_FUJITSU_COMMAND_SET)
+    {
+      NOR_WRITE((deviceaddress + uwAddress), NOR_CMD_DATA_BUFFER_AND_PROG_CONFIRM);
+    }
+    else /* => hnor->CommandSet == NOR_INTEL_SHARP_EXT_COMMAND_SET */
+    {
+      NOR_WRITE((deviceaddress + uwAddress), NOR_CMD_CONFIRM);
+    }
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Return the NOR operation status without waiting.
+  * @param  hnor pointer to the NOR handle
+  * @param  Address Device address
+  * @retval NOR_Status The returned value can be: HAL_NOR_STATUS_SUCCESS, HAL_NOR_STATUS_ONGOING
+  *         or HAL_NOR_STATUS_ERROR
+  */
+static HAL_NOR_StatusTypeDef NOR_CheckStatus(const NOR_HandleTypeDef *hnor, uint32_t Address)
+{
+  HAL_NOR_StatusTypeDef status;
+  uint16_t tmpsr1;
+  uint16_t tmpsr2;
+
+  if (hnor->CommandSet == NOR_AMD_FUJITSU_COMMAND_SET)
+  {
+    /* Read NOR status register (DQ6 and DQ5) */
+    tmpsr1 = *(__IO uint16_t *)Address;
+    tmpsr2 = *(__IO uint16_t *)Address;
+
+    /* If DQ6 did not toggle between the two reads the operation is over */
+    if ((tmpsr1 & NOR_MASK_STATUS_DQ6) == (tmpsr2 & NOR_MASK_STATUS_DQ6))
+    {
+      status = HAL_NOR_STATUS_SUCCESS;
+    }
+    else if ((tmpsr2 & NOR_MASK_STATUS_DQ5) == NOR_MASK_STATUS_DQ5)
+    {
+      /* DQ5 set: check DQ6 once more, as the operation may have just ended */
+      tmpsr1 = *(__IO uint16_t *)Address;
+      tmpsr2 = *(__IO uint16_t *)Address;
+      status = ((tmpsr1 & NOR_MASK_STATUS_DQ6) == (tmpsr2 & NOR_MASK_STATUS_DQ6)) ?
+               HAL_NOR_STATUS_SUCCESS : HAL_NOR_STATUS_ERROR;
+    }
+    else
+    {
+      status = HAL_NOR_STATUS_ONGOING;
+    }
+  }
+  else /* => hnor->CommandSet == NOR_INTEL_SHARP_EXT_COMMAND_SET */
+  {
+    NOR_WRITE(Address, NOR_CMD_READ_STATUS_REG);
+    tmpsr1 = *(__IO uint16_t *)(Address);
+
+    if ((tmpsr1 & NOR_MASK_STATUS_DQ7) == 0U)
+    {
+      status = HAL_NOR_STATUS_ONGOING;
+    }
+    else if ((tmpsr1 & (NOR_MASK_STATUS_DQ5 | NOR_MASK_STATUS_DQ4)) != 0U)
+    {
+      /* Clear the Status Register  */
+      NOR_WRITE(Address, NOR_CMD_CLEAR_STATUS_REG);
+      status = HAL_NOR_STATUS_ERROR;
+    }
+    else
+    {
+      status = HAL_NOR_STATUS_SUCCESS;
+    }
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Start the next write buffer program of a streamed program.
+  * @note   A write buffer program does not cross a write buffer boundary.
+  * @param  hnor pointer to the NOR handle
+  * @retval None
+  */
+static void NOR_StreamNext(NOR_HandleTypeDef *hnor)
+{
+  uint32_t chunk;
+
+  /* Half-words up to the next write buffer boundary */
+  chunk = hnor->StreamBufferSize - ((hnor->StreamAddress / 2U) & (hnor->StreamBufferSize - 1U));
+  if (chunk > hnor->StreamCount)
+  {
+    chunk = hnor->StreamCount;
+  }
+  hnor->StreamChunk = chunk;
+
+  (void)NOR_LoadBuffer(hnor, NOR_GetDeviceAddress(hnor), hnor->StreamAddress, hnor->pStreamData, chunk);
+}
+
 /**
   * @}
   */
@@ -158,6 +158,21 @@
     [..]
      After the configuration, the OctoSPI will be used as soon as an access on the AHB is done on
      the address range. HAL_OSPI_TimeOutCallback() will be called when the timeout expires.
+    [..]
+     The execute-in-place (XIP) helpers tune the memory-mapped read path for a given access pattern :
+     (+) HAL_OSPI_XipGetProfile() fills an OSPI_XipProfileTypeDef with one of the presets
+         HAL_OSPI_XIP_PROFILE_CODE, HAL_OSPI_XIP_PROFILE_SEQUENTIAL or HAL_OSPI_XIP_PROFILE_RANDOM,
+         for the dummy cycles and DTR mode required by the memory at the current clock. The
+         structure can be adjusted before use.
+     (+) HAL_OSPI_XipStart() applies the sampling and hold timings of the profile, sends the read
+         configuration built from the given read command with the profile dummy cycles, DTR and
+         SIOO settings, and enters memory-mapped mode with the profile timeout. The write
+         configuration should be done before with HAL_OSPI_Command().
+     (+) HAL_OSPI_XipBenchmark() measures, in memory-mapped mode, the sequential read bandwidth and
+         the average random read latency over a region, using the DWT cycle counter.
+    [..]
+     The OctoSPI always prefetches the next data while nCS is kept active: the timeout counter is
+     the knob which decides how long the prefetch goes on after the last AHB access.
 
     *** Errors management and abort functionality ***
     =================================================
@@ -1838,6 +1853,250 @@ HAL_StatusTypeDef HAL_OSPI_MemoryMapped(OSPI_HandleTypeDef *hospi, OSPI_MemoryMa
   return status;
 }
 
+/**
+  * @brief  Fill an XIP profile with a preset.
+  * @param  Profile     : XIP preset.
+  *          This parameter can be a value of @ref OSPI_XipProfile
+  * @param  DummyCycles : number of dummy cycles required by the memory for the read command
+  * @param  DtrMode     : DTR mode of the read command.
+  *          This parameter can be a value of @ref OSPI_DataDtrMode
+  * @param  pProfile    : structure filled with the profile
+  * @note   In DTR mode the data are held 1/4 cycle and not shifted, in SDR mode the sampling
+  *         is shifted by 1/2 cycle to absorb the board delays.
+  * @note   The presets send the instruction on every command. SIOOMode can be changed to
+  *         HAL_OSPI_SIOO_INST_ONLY_FIRST_CMD only if the memory has been put in its
+  *         continuous read mode.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_OSPI_XipGetProfile(uint32_t Profile, uint32_t DummyCycles, uint32_t DtrMode,
+                                         OSPI_XipProfileTypeDef *pProfile)
+{
+  /* Check the parameters */
+  assert_param(IS_OSPI_XIP_PROFILE(Profile));
+  assert_param(IS_OSPI_DUMMY_CYCLES(DummyCycles));
+  assert_param(IS_OSPI_DATA_DTR_MODE(DtrMode));
+
+  if (pProfile == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  pProfile->DummyCycles = DummyCycles;
+  pProfile->DtrMode     = DtrMode;
+  pProfile->SIOOMode    = HAL_OSPI_SIOO_INST_EVERY_CMD;
+
+  if (DtrMode == HAL_OSPI_DATA_DTR_ENABLE)
+  {
+    pProfile->SampleShifting        = HAL_OSPI_SAMPLE_SHIFTING_NONE;
+    pProfile->DelayHoldQuarterCycle = HAL_OSPI_DHQC_ENABLE;
+  }
+  else
+  {
+    pProfile->SampleShifting        = HAL_OSPI_SAMPLE_SHIFTING_HALFCYCLE;
+    pProfile->DelayHoldQuarterCycle = HAL_OSPI_DHQC_DISABLE;
+  }
+
+  switch (Profile)
+  {
+    case HAL_OSPI_XIP_PROFILE_SEQUENTIAL :
+      /* Keep nCS active: the prefetch runs ahead of the reader without new command phases */
+      pProfile->TimeOutActivation = HAL_OSPI_TIMEOUT_COUNTER_DISABLE;
+      pProfile->TimeOutPeriod     = 0U;
+      break;
+
+    case HAL_OSPI_XIP_PROFILE_RANDOM :
+      /* Release nCS shortly after the FIFO is full: a prefetch past the word is mostly wasted */
+      pProfile->TimeOutActivation = HAL_OSPI_TIMEOUT_COUNTER_ENABLE;
+      pProfile->TimeOutPeriod     = 0x4U;
+      break;
+
+    default :
+      /* Code fetches come as cache line bursts with short jumps in between */
+      pProfile->TimeOutActivation = HAL_OSPI_TIMEOUT_COUNTER_ENABLE;
+      pProfile->TimeOutPeriod     = 0x40U;
+      break;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Configure the read command with an XIP profile and start the Memory Mapped mode.
+  * @param  hospi    : OSPI handle
+  * @param  pReadCmd : read command of the memory. OperationType, DummyCycles, DTR modes of the
+  *                    address, alternate bytes and data phases and SIOOMode are taken from the profile.
+  * @param  pProfile : XIP profile
+  * @note   The write configuration of the memory-mapped mode should be done before calling
+  *         this function.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_OSPI_XipStart(OSPI_HandleTypeDef *hospi, const OSPI_RegularCmdTypeDef *pReadCmd,
+                                    const OSPI_XipProfileTypeDef *pProfile)
+{
+  HAL_StatusTypeDef status;
+  OSPI_RegularCmdTypeDef cmd;
+  OSPI_MemoryMappedTypeDef cfg;
+  uint32_t tickstart = HAL_GetTick();
+
+  if ((pReadCmd == NULL) || (pProfile == NULL))
+  {
+    hospi->ErrorCode = HAL_OSPI_ERROR_INVALID_PARAM;
+    return HAL_ERROR;
+  }
+
+  /* Check the parameters of the profile */
+  assert_param(IS_OSPI_SAMPLE_SHIFTING(pProfile->SampleShifting));
+  assert_param(IS_OSPI_DHQC(pProfile->DelayHoldQuarterCycle));
+  assert_param(IS_OSPI_DATA_DTR_MODE(pProfile->DtrMode));
+
+  /* The timings can only be changed while no command is configured for the memory-mapped reads */
+  if ((hospi->State == HAL_OSPI_STATE_READY) || (hospi->State == HAL_OSPI_STATE_WRITE_CMD_CFG))
+  {
+    /* Wait till busy flag is reset */
+    status = OSPI_WaitFlagStateUntilTimeout(hospi, HAL_OSPI_FLAG_BUSY, RESET, tickstart, hospi->Timeout);
+
+    if (status == HAL_OK)
+    {
+      /* Apply the sampling and hold timings */
+      hospi->Init.SampleShifting        = pProfile->SampleShifting;
+      hospi->Init.DelayHoldQuarterCycle = pProfile->DelayHoldQuarterCycle;
+      MODIFY_REG(hospi->Instance->TCR, (OCTOSPI_TCR_SSHIFT | OCTOSPI_TCR_DHQC),
+                 (hospi->Init.SampleShifting | hospi->Init.DelayHoldQuarterCycle));
+
+      /* Build the read configuration from the command of the memory */
+      cmd = *pReadCmd;
+      cmd.OperationType = HAL_OSPI_OPTYPE_READ_CFG;
+      cmd.DummyCycles   = pProfile->DummyCycles;
+      cmd.DataDtrMode   = pProfile->DtrMode;
+      cmd.SIOOMode      = pProfile->SIOOMode;
+      if (pProfile->DtrMode == HAL_OSPI_DATA_DTR_ENABLE)
+      {
+        cmd.AddressDtrMode        = HAL_OSPI_ADDRESS_DTR_ENABLE;
+        cmd.AlternateBytesDtrMode = HAL_OSPI_ALTERNATE_BYTES_DTR_ENABLE;
+      }
+      else
+      {
+        cmd.AddressDtrMode        = HAL_OSPI_ADDRESS_DTR_DISABLE;
+        cmd.AlternateBytesDtrMode = HAL_OSPI_ALTERNATE_BYTES_DTR_DISABLE;
+      }
+
+      status = HAL_OSPI_Command(hospi, &cmd, hospi->Timeout);
+
+      if (status == HAL_OK)
+      {
+        /* Enter the memory-mapped mode with the release policy of the profile */
+        cfg.TimeOutActivation = pProfile->TimeOutActivation;
+        cfg.TimeOutPeriod     = pProfile->TimeOutPeriod;
+        status = HAL_OSPI_MemoryMapped(hospi, &cfg);
+      }
+    }
+  }
+  else
+  {
+    status = HAL_ERROR;
+    hospi->ErrorCode = HAL_OSPI_ERROR_INVALID_SEQUENCE;
+  }
+
+  /* Return function status */
+  return status;
+}
+
+/**
+  * @brief  Measure the memory-mapped read performance.
+  * @param  hospi   : OSPI handle
+  * @param  Offset  : offset of the measured region in the memory-mapped area, multiple of 4
+  * @param  Size    : size of the measured region in bytes, multiple of 4
+  * @param  pResult : structure filled with the measurement
+  * @note   This function is used only in Memory mapped Mode.
+  * @note   A sequential pass reads the whole region, then a random pass reads as many words at
+  *         pseudo-random addresses of the region. The data cache lines of the region are
+  *         invalidated before each pass so that each read reaches the OctoSPI.
+  * @note   The DWT cycle counter is enabled by this function if it was not already running.
+  *         The function should be called with interrupts masked for repeatable results.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_OSPI_XipBenchmark(OSPI_HandleTypeDef *hospi, uint32_t Offset, uint32_t Size,
+                                        OSPI_XipBenchmarkTypeDef *pResult)
+{
+  __IO const uint32_t *base;
+  uint32_t nb_words;
+  uint32_t index;
+  uint32_t seed;
+  uint32_t start;
+  uint32_t sum = 0U;
+
+  if ((pResult == NULL) || (Size < 4U) || ((Offset & 0x3U) != 0U) || ((Size & 0x3U) != 0U))
+  {
+    hospi->ErrorCode = HAL_OSPI_ERROR_INVALID_PARAM;
+    return HAL_ERROR;
+  }
+
+  if (hospi->State != HAL_OSPI_STATE_BUSY_MEM_MAPPED)
+  {
+    hospi->ErrorCode = HAL_OSPI_ERROR_INVALID_SEQUENCE;
+    return HAL_ERROR;
+  }
+
+  if (hospi->Instance == OCTOSPI1)
+  {
+    base = (__IO const uint32_t *)(OCTOSPI1_BASE + Offset);
+  }
+  else
+  {
+    base = (__IO const uint32_t *)(OCTOSPI2_BASE + Offset);
+  }
+  nb_words = Size / 4U;
+
+  /* Start the cycle counter if needed */
+  if ((DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk) == 0U)
+  {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0U;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+  }
+
+  /* Sequential pass */
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  if ((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+  {
+    SCB_InvalidateDCache_by_Addr((void *)((uint32_t)base & ~31U), (int32_t)(Size + 32U));
+  }
+#endif /* __DCACHE_PRESENT */
+  start = DWT->CYCCNT;
+  for (index = 0U; index < nb_words; index++)
+  {
+    sum += base[index];
+  }
+  pResult->SequentialCycles = DWT->CYCCNT - start;
+
+  /* Random pass, addresses generated by a linear congruential generator */
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  if ((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+  {
+    SCB_InvalidateDCache_by_Addr((void *)((uint32_t)base & ~31U), (int32_t)(Size + 32U));
+  }
+#endif /* __DCACHE_PRESENT */
+  seed = 0x12345678U;
+  start = DWT->CYCCNT;
+  for (index = 0U; index < nb_words; index++)
+  {
+    seed = (seed * 1664525U) + 1013904223U;
+    sum += base[(seed >> 8U) % nb_words];
+  }
+  pResult->RandomCycles = DWT->CYCCNT - start;
+
+  /* Prevent the reads from being optimized out */
+  UNUSED(sum);
+
+  pResult->Size                = Size;
+  pResult->SequentialBandwidth = (uint32_t)(((uint64_t)Size * SystemCoreClock) /
+                                            ((pResult->SequentialCycles != 0U) ? pResult->SequentialCycles : 1U));
+  pResult->RandomLatencyCycles = pResult->RandomCycles / nb_words;
+  pResult->RandomLatencyNs     = (uint32_t)(((uint64_t)pResult->RandomLatencyCycles * 1000000000U) / SystemCoreClock);
+
+  return HAL_OK;
+}
+
 /**
   * @brief  Transfer Error callback.
   * @param  hospi : OSPI handle
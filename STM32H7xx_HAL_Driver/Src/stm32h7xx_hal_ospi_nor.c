@@ -0,0 +1,1930 @@
+/**
+  ******************************************************************************
+  * @file    stm32h7xx_hal_ospi_nor.c
+  * @author  MCD Application Team
+  * @brief   OSPI NOR flash HAL module driver.
+             This file provides firmware functions to manage a serial NOR flash
+             connected to the OctoSPI interface (OSPI), configured from its
+             JEDEC SFDP tables.
+              + Initialization and de-initialization functions
+              + Read, page program and erase operations
+              + Memory-mapped mode management
+
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  @verbatim
+ ===============================================================================
+                        ##### How to use this driver #####
+ ===============================================================================
+  [..]
+    The OSPI NOR driver sits on top of the OSPI HAL driver. It reads the Serial
+    Flash Discoverable Parameters (SFDP, JESD216) of the memory and selects the
+    fastest read protocol supported by both the memory and the board, so that the
+    instructions, dummy cycles and quad or octal enable sequences do not have to
+    be coded for each memory.
+
+    *** Initialization ***
+    ======================
+    [..]
+     (#) Initialize the OctoSPI with HAL_OSPI_Init() for a micron-like memory and
+         a single flash, with a clock that the memory supports in all the protocols
+         allowed by Init.MaxMode. The device size is corrected from the SFDP tables.
+     (#) Set the hospi field of the OSPI_NOR_HandleTypeDef to the OSPI handle and
+         Init.MaxMode to the fastest protocol wired on the board :
+         (++) HAL_OSPI_NOR_MODE_1S1S1S for a single data line.
+         (++) HAL_OSPI_NOR_MODE_1S4S4S or HAL_OSPI_NOR_MODE_4S4S4S for 4 data lines.
+         (++) HAL_OSPI_NOR_MODE_8D8D8D for 8 data lines and the DQS line.
+     (#) Call HAL_OSPI_NOR_Init(). The memory must be in its power-on state, in
+         the 1S-1S-1S protocol. The driver then selects, in this order of preference :
+         (++) 8D-8D-8D when the xSPI profile 1.0 and the octal DDR command sequence
+              tables are present. The memory keeps its power-on read latency.
+         (++) 4S-4S-4S when the basic flash parameter table gives a 4-4-4 fast read and
+              an enable sequence with the 38h or 35h instruction.
+         (++) 1S-4S-4S when the basic flash parameter table gives a 1-4-4 fast read.
+         (++) 1S1S1S with the 0Bh fast read otherwise.
+         The quad enable bit is set according to the quad enable requirements of the
+         basic flash parameter table. Memories above 16 Mbytes are used with 4-byte
+         addresses.
+     (#) HAL_OSPI_NOR_DeInit() resets the memory back to its power-on protocol.
+
+    *** IO operations ***
+    =====================
+    [..]
+     (#) HAL_OSPI_NOR_Read() reads the memory in indirect mode with the selected fast read.
+     (#) HAL_OSPI_NOR_Program_IT() programs up to one page and HAL_OSPI_NOR_Erase_IT()
+         erases one block of one of the erase types of the memory. Both return as soon as
+         the command is sent; the end of the operation is detected by the OSPI automatic
+         polling of the status register and reported by HAL_OSPI_NOR_ProgramCpltCallback()
+         or HAL_OSPI_NOR_EraseCpltCallback(). HAL_OSPI_NOR_ErrorCallback() is called on error.
+     (#) The OSPI callbacks belong to the application, which forwards them :
+         (++) HAL_OSPI_TxCpltCallback() to HAL_OSPI_NOR_TxCpltHandler().
+         (++) HAL_OSPI_StatusMatchCallback() to HAL_OSPI_NOR_StatusMatchHandler().
+         (++) HAL_OSPI_ErrorCallback() to HAL_OSPI_NOR_ErrorHandler().
+     (#) HAL_OSPI_NOR_MemoryMapped() enters the memory-mapped mode with the selected fast
+         read and an XIP profile of @ref OSPI_XipProfile (see HAL_OSPI_XipStart()).
+         HAL_OSPI_NOR_StopMemoryMapped() leaves it.
+
+    *** Read-while-write operations ***
+    ===================================
+    [..]
+     The memory which holds the executed code can be programmed and erased while the
+     memory-mapped mode is used :
+     (#) HAL_OSPI_NOR_QueueProgram() and HAL_OSPI_NOR_QueueErase() add operations to a queue
+         of HAL_OSPI_NOR_QUEUE_DEPTH entries. A program contiguous in the memory and in the
+         buffer with the last queued program is merged with it, as is a contiguous erase of
+         the same erase type. The data buffers are kept until the operations are done.
+     (#) HAL_OSPI_NOR_ServiceQueue() is called periodically, for example from a timer
+         interrupt, while the memory is in memory-mapped mode. With the interrupts masked it
+         leaves the memory-mapped mode, runs queued page programs and block erases back to
+         back for at most Budget CPU cycles, then restores the memory-mapped mode. An erase
+         which is not finished at the end of the budget is suspended and resumed by the next
+         call, if the memory supports it; a page program always runs to its end.
+     (#) HAL_OSPI_NOR_ServiceQueue() and the functions it calls are placed in RAM with
+         __RAM_FUNC and only access the OctoSPI registers. The caller of the function, the
+         interrupt vector table and the OctoSPI handles should not be located in the memory.
+         The budget should be longer than the erase resume to suspend time of the memory,
+         otherwise an erase never progresses.
+     (#) The data cache is invalidated over each programmed or erased range. The application
+         invalidates the instruction cache when code has been modified.
+
+  @endverbatim
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32h7xx_hal.h"
+
+#if defined(OCTOSPI) || defined(OCTOSPI1) || defined(OCTOSPI2)
+
+/** @addtogroup STM32H7xx_HAL_Driver
+  * @{
+  */
+
+/** @defgroup OSPI_NOR OSPI_NOR
+  * @brief OSPI NOR flash HAL module driver
+  * @{
+  */
+
+#if defined(HAL_OSPI_MODULE_ENABLED) && defined(HAL_OSPI_NOR_MODULE_ENABLED)
+
+/**
+  @cond 0
+  */
+/* Private typedef -----------------------------------------------------------*/
+
+/* Private define ------------------------------------------------------------*/
+#define OSPI_NOR_SFDP_SIGNATURE           0x50444653U /*!< "SFDP" in little endian                        */
+#define OSPI_NOR_SFDP_DUMMY_CYCLES        8U          /*!< Dummy cycles of the Read SFDP instruction       */
+#define OSPI_NOR_SFDP_ID_BFPT             0xFF00U     /*!< Basic flash parameter table                     */
+#define OSPI_NOR_SFDP_ID_PROFILE1         0xFF05U     /*!< xSPI profile 1.0 table                          */
+#define OSPI_NOR_SFDP_ID_OCTAL_DDR        0xFF0AU     /*!< Command sequences to change to octal DDR table  */
+#define OSPI_NOR_BFPT_DWORDS              20U         /*!< JESD216D basic flash parameter table length     */
+#define OSPI_NOR_PROFILE1_DWORDS          5U          /*!< xSPI profile 1.0 table length                   */
+#define OSPI_NOR_OCTAL_DDR_DWORDS         8U          /*!< Four command sequences of two DWORDs            */
+
+/* Basic flash parameter table fields, DWORD index from 0 */
+#define OSPI_NOR_BFPT_ADDR_BYTES(D)       (((D)[0] >> 17U) & 0x3U)   /*!< 0: 3 bytes, 1: 3 or 4 bytes, 2: 4 bytes */
+#define OSPI_NOR_BFPT_144_SUPPORT         (1UL << 21U)               /*!< DWORD1: 1-4-4 fast read supported       */
+#define OSPI_NOR_BFPT_444_SUPPORT         (1UL << 4U)                /*!< DWORD5: 4-4-4 fast read supported       */
+#define OSPI_NOR_BFPT_QER(D)              (((D)[14] >> 20U) & 0x7U)  /*!< DWORD15: quad enable requirements       */
+#define OSPI_NOR_BFPT_444_ENABLE(D)       (((D)[14] >> 4U) & 0x1FU)  /*!< DWORD15: 4-4-4 enable sequences         */
+#define OSPI_NOR_BFPT_4B_ENTER_B7         (1UL << 24U)               /*!< DWORD16: B7h enters 4-byte address mode */
+#define OSPI_NOR_BFPT_4B_ENTER_WREN_B7    (1UL << 25U)               /*!< DWORD16: 06h then B7h                   */
+#define OSPI_NOR_BFPT_CMD_EXT(D)          (((D)[17] >> 29U) & 0x3U)  /*!< DWORD18: 8D-8D-8D command extension     */
+#define OSPI_NOR_BFPT_NO_SUSPEND          (1UL << 31U)               /*!< DWORD12: suspend and resume unsupported */
+#define OSPI_NOR_BFPT_SUSPEND(D)          (((D)[12] >> 24U) & 0xFFU) /*!< DWORD13: erase suspend instruction      */
+#define OSPI_NOR_BFPT_RESUME(D)           (((D)[12] >> 16U) & 0xFFU) /*!< DWORD13: erase resume instruction       */
+
+/* xSPI profile 1.0 table fields, DWORD index from 0 */
+#define OSPI_NOR_PROFILE1_READ_FAST(D)    (((D)[0] >> 8U) & 0xFFU)   /*!< DWORD1: 8D-8D-8D read fast instruction  */
+#define OSPI_NOR_PROFILE1_RDSR_ADDR       (1UL << 29U)               /*!< DWORD1: read status has 4 address bytes */
+#define OSPI_NOR_PROFILE1_RDSR_DUMMY_8    (1UL << 28U)               /*!< DWORD1: read status has 8 dummy cycles  */
+#define OSPI_NOR_PROFILE1_DUMMY_MAX(D)    (((D)[3] >> 27U) & 0x1FU)  /*!< DWORD4: dummy cycles at 200 MHz         */
+#define OSPI_NOR_PROFILE1_DUMMY_DEFAULT   20U                        /*!< Read latency when the field is empty    */
+
+/* Instructions */
+#define OSPI_NOR_CMD_READ_SFDP            0x5AU
+#define OSPI_NOR_CMD_FAST_READ            0x0BU
+#define OSPI_NOR_CMD_PAGE_PROG            0x02U
+#define OSPI_NOR_CMD_WRITE_ENABLE         0x06U
+#define OSPI_NOR_CMD_READ_SR1             0x05U
+#define OSPI_NOR_CMD_READ_SR2             0x35U
+#define OSPI_NOR_CMD_READ_SR2_BIT7        0x3FU
+#define OSPI_NOR_CMD_WRITE_SR             0x01U
+#define OSPI_NOR_CMD_WRITE_SR2            0x31U
+#define OSPI_NOR_CMD_WRITE_SR2_BIT7       0x3EU
+#define OSPI_NOR_CMD_ENTER_QPI_38         0x38U
+#define OSPI_NOR_CMD_ENTER_QPI_35         0x35U
+#define OSPI_NOR_CMD_ENTER_4B             0xB7U
+#define OSPI_NOR_CMD_RESET_ENABLE         0x66U
+#define OSPI_NOR_CMD_RESET                0x99U
+
+#define OSPI_NOR_SR_WIP                   0x01U       /*!< Write in progress bit of the status register     */
+#define OSPI_NOR_MODE_BITS                0xFFU       /*!< Mode bits which do not enter the continuous read */
+#define OSPI_NOR_POLLING_INTERVAL         0x10U
+#define OSPI_NOR_16MBYTES                 0x01000000U
+
+#define OSPI_NOR_FMODE_INDIRECT_WRITE     0x00000000U           /*!< Indirect write mode of the CR register */
+#define OSPI_NOR_FMODE_INDIRECT_READ      OCTOSPI_CR_FMODE_0    /*!< Indirect read mode of the CR register  */
+
+#define OSPI_NOR_QUEUE_IDLE               0x00000000U   /*!< No operation started in the memory        */
+#define OSPI_NOR_QUEUE_BUSY               0x00000001U   /*!< A chunk of the head operation is running  */
+#define OSPI_NOR_QUEUE_SUSPENDED          0x00000002U   /*!< The erase of the head operation is suspended */
+
+/* Private macro -------------------------------------------------------------*/
+/* Protocol of the instructions other than the fast read */
+#define OSPI_NOR_CMD_PROTOCOL(__HNOR__)   (((__HNOR__)->Mode == HAL_OSPI_NOR_MODE_1S4S4S) ? \
+                                           HAL_OSPI_NOR_MODE_1S1S1S : (__HNOR__)->Mode)
+
+/* Private variables ---------------------------------------------------------*/
+
+/* Private function prototypes -----------------------------------------------*/
+static void              OSPI_NOR_BuildCmd(const OSPI_NOR_HandleTypeDef *hnor, OSPI_RegularCmdTypeDef *cmd,
+                                           uint32_t Protocol, uint32_t Instruction, uint32_t AddressBytes,
+                                           uint32_t Address, uint32_t NbData, uint32_t DummyCycles);
+static void              OSPI_NOR_BuildReadCmd(const OSPI_NOR_HandleTypeDef *hnor, OSPI_RegularCmdTypeDef *cmd,
+                                               uint32_t Address, uint32_t NbData);
+static HAL_StatusTypeDef OSPI_NOR_ReadReg(OSPI_NOR_HandleTypeDef *hnor, uint32_t Instruction, uint8_t *pData);
+static HAL_StatusTypeDef OSPI_NOR_WriteEnable(OSPI_NOR_HandleTypeDef *hnor);
+static HAL_StatusTypeDef OSPI_NOR_WriteReg(OSPI_NOR_HandleTypeDef *hnor, uint32_t Instruction, uint8_t *pData,
+                                           uint32_t Size);
+static HAL_StatusTypeDef OSPI_NOR_ConfigStatusPolling(OSPI_NOR_HandleTypeDef *hnor, OSPI_AutoPollingTypeDef *cfg);
+static HAL_StatusTypeDef OSPI_NOR_WaitReady(OSPI_NOR_HandleTypeDef *hnor, uint32_t Timeout);
+static HAL_StatusTypeDef OSPI_NOR_QuadEnable(OSPI_NOR_HandleTypeDef *hnor, uint32_t Qer);
+static HAL_StatusTypeDef OSPI_NOR_EnterOctalDdr(OSPI_NOR_HandleTypeDef *hnor, const uint32_t *pSeq, uint32_t Length);
+static void              OSPI_NOR_SetFastRead(OSPI_NOR_HandleTypeDef *hnor, uint32_t Field);
+static uint32_t          OSPI_NOR_Instruction4B(uint32_t Instruction);
+static void              OSPI_NOR_PrepareRegCmd(const OSPI_NOR_HandleTypeDef *hnor, OSPI_NOR_RegCmdTypeDef *pReg,
+                                                uint32_t Instruction, uint32_t AddressBytes, uint32_t NbData,
+                                                uint32_t DummyCycles);
+static __RAM_FUNC void     OSPI_NOR_RamAbort(OCTOSPI_TypeDef *Instance);
+static __RAM_FUNC void     OSPI_NOR_RamCommand(OCTOSPI_TypeDef *Instance, const OSPI_NOR_RegCmdTypeDef *pReg,
+                                               uint32_t Fmode, uint32_t Address, uint32_t NbData);
+static __RAM_FUNC void     OSPI_NOR_RamWaitTc(OCTOSPI_TypeDef *Instance);
+static __RAM_FUNC uint32_t OSPI_NOR_RamReadStatus(OSPI_NOR_HandleTypeDef *hnor);
+static __RAM_FUNC void     OSPI_NOR_RamStartChunk(OSPI_NOR_HandleTypeDef *hnor);
+static __RAM_FUNC void     OSPI_NOR_RamEndChunk(OSPI_NOR_HandleTypeDef *hnor);
+/**
+  @endcond
+  */
+
+/* Exported functions --------------------------------------------------------*/
+
+/** @defgroup OSPI_NOR_Exported_Functions OSPI NOR Exported Functions
+  * @{
+  */
+
+/** @defgroup OSPI_NOR_Exported_Functions_Group1 Initialization/de-initialization functions
+  *  @brief    Initialization and Configuration functions
+  *
+@verbatim
+===============================================================================
+            ##### Initialization and Configuration functions #####
+ ===============================================================================
+    [..]
+    This subsection provides a set of functions allowing to :
+      (+) Discover the memory parameters and select its protocol.
+      (+) Reset the memory to its power-on protocol.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Initialize the NOR flash from its SFDP tables.
+  * @param  hnor : OSPI NOR handle
+  * @note   The OSPI should be initialized and the memory in its power-on state.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_OSPI_NOR_Init(OSPI_NOR_HandleTypeDef *hnor)
+{
+  HAL_StatusTypeDef status;
+  uint32_t header[2];
+  uint32_t param[2];
+  uint32_t bfpt[OSPI_NOR_BFPT_DWORDS]          = {0};
+  uint32_t profile[OSPI_NOR_PROFILE1_DWORDS]   = {0};
+  uint32_t octal_seq[OSPI_NOR_OCTAL_DDR_DWORDS] = {0};
+  uint32_t bfpt_len    = 0U;
+  uint32_t profile_len = 0U;
+  uint32_t octal_len   = 0U;
+  uint32_t nb_headers;
+  uint32_t index;
+  uint32_t id;
+  uint32_t length;
+  uint32_t pointer;
+  uint32_t mode = HAL_OSPI_NOR_MODE_1S1S1S;
+  uint32_t use_4b_instructions = 0U;
+
+  /* Check the NOR handle allocation */
+  if ((hnor == NULL) || (hnor->hospi == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the parameters of the initialization structure */
+  assert_param(IS_OSPI_NOR_MODE(hnor->Init.MaxMode));
+
+  if (hnor->hospi->State != HAL_OSPI_STATE_READY)
+  {
+    hnor->ErrorCode = HAL_OSPI_NOR_ERROR_INVALID_SEQUENCE;
+    return HAL_ERROR;
+  }
+
+  hnor->ErrorCode          = HAL_OSPI_NOR_ERROR_NONE;
+  hnor->Mode               = HAL_OSPI_NOR_MODE_1S1S1S;
+  hnor->StatusDummyCycles  = 0U;
+  hnor->StatusAddressBytes = 0U;
+  hnor->CmdExtInverted     = 1U;
+  hnor->SuspendSupported   = 0U;
+  hnor->QueueHead          = 0U;
+  hnor->QueueCount         = 0U;
+  hnor->QueueState         = OSPI_NOR_QUEUE_IDLE;
+
+  /* Read the SFDP header and look for the parameter tables */
+  status = HAL_OSPI_NOR_ReadSFDP(hnor, 0U, (uint8_t *)header, sizeof(header));
+  if ((status == HAL_OK) && (header[0] != OSPI_NOR_SFDP_SIGNATURE))
+  {
+    hnor->ErrorCode = HAL_OSPI_NOR_ERROR_SFDP;
+    status = HAL_ERROR;
+  }
+
+  if (status == HAL_OK)
+  {
+    nb_headers = ((header[1] >> 16U) & 0xFFU) + 1U;
+
+    for (index = 0U; (index < nb_headers) && (status == HAL_OK); index++)
+    {
+      status = HAL_OSPI_NOR_ReadSFDP(hnor, 8U + (8U * index), (uint8_t *)param, sizeof(param));
+
+      id      = (param[0] & 0xFFU) | ((param[1] >> 16U) & 0xFF00U);
+      length  = (param[0] >> 24U) & 0xFFU;
+      pointer = param[1] & 0x00FFFFFFU;
+
+      if (status != HAL_OK)
+      {
+        /* Nothing to parse */
+      }
+      else if ((id == OSPI_NOR_SFDP_ID_BFPT) && (length > bfpt_len))
+      {
+        /* A later revision of the basic table replaces the first one */
+        bfpt_len = (length < OSPI_NOR_BFPT_DWORDS) ? length : OSPI_NOR_BFPT_DWORDS;
+        status = HAL_OSPI_NOR_ReadSFDP(hnor, pointer, (uint8_t *)bfpt, 4U * bfpt_len);
+      }
+      else if (id == OSPI_NOR_SFDP_ID_PROFILE1)
+      {
+        profile_len = (length < OSPI_NOR_PROFILE1_DWORDS) ? length : OSPI_NOR_PROFILE1_DWORDS;
+        status = HAL_OSPI_NOR_ReadSFDP(hnor, pointer, (uint8_t *)profile, 4U * profile_len);
+      }
+      else if (id == OSPI_NOR_SFDP_ID_OCTAL_DDR)
+      {
+        octal_len = (length < OSPI_NOR_OCTAL_DDR_DWORDS) ? length : OSPI_NOR_OCTAL_DDR_DWORDS;
+        status = HAL_OSPI_NOR_ReadSFDP(hnor, pointer, (uint8_t *)octal_seq, 4U * octal_len);
+      }
+      else
+      {
+        /* Table not used */
+      }
+    }
+  }
+
+  /* JESD216 basic flash parameter table has at least 9 DWORDs */
+  if ((status == HAL_OK) && (bfpt_len < 9U))
+  {
+    hnor->ErrorCode = HAL_OSPI_NOR_ERROR_SFDP;
+    status = HAL_ERROR;
+  }
+
+  if (status == HAL_OK)
+  {
+    /* Memory density */
+    if ((bfpt[1] & 0x80000000U) != 0U)
+    {
+      length = bfpt[1] & 0x7FFFFFFFU;
+      hnor->MemorySize = ((length >= 3U) && (length < 35U)) ? (1UL << (length - 3U)) : 0U;
+    }
+    else
+    {
+      hnor->MemorySize = (bfpt[1] >> 3U) + 1U;
+    }
+
+    /* Page size, 256 bytes before JESD216A */
+    hnor->PageSize = (bfpt_len >= 11U) ? (1UL << ((bfpt[10] >> 4U) & 0xFU)) : 256U;
+
+    /* Erase types */
+    for (index = 0U; index < 4U; index++)
+    {
+      length = (bfpt[7U + (index / 2U)] >> (16U * (index % 2U))) & 0xFFFFU;
+      hnor->Erase[index].Size        = ((length & 0xFFU) != 0U) ? (1UL << (length & 0xFFU)) : 0U;
+      hnor->Erase[index].Instruction = length >> 8U;
+    }
+
+    /* Fastest read protocol, the memory stays in 1S-1S-1S until it is switched */
+    hnor->ReadInstruction    = OSPI_NOR_CMD_FAST_READ;
+    hnor->ReadDummyCycles    = 8U;
+    hnor->ReadModeBytes      = 0U;
+    hnor->ProgramInstruction = OSPI_NOR_CMD_PAGE_PROG;
+
+    if ((hnor->Init.MaxMode >= HAL_OSPI_NOR_MODE_8D8D8D) && (profile_len >= 4U) && (octal_len >= 2U) &&
+        (OSPI_NOR_PROFILE1_READ_FAST(profile) != 0U))
+    {
+      mode                  = HAL_OSPI_NOR_MODE_8D8D8D;
+      hnor->ReadInstruction = OSPI_NOR_PROFILE1_READ_FAST(profile);
+      hnor->ReadDummyCycles = OSPI_NOR_PROFILE1_DUMMY_MAX(profile);
+      if (hnor->ReadDummyCycles == 0U)
+      {
+        hnor->ReadDummyCycles = OSPI_NOR_PROFILE1_DUMMY_DEFAULT;
+      }
+    }
+    else if ((hnor->Init.MaxMode >= HAL_OSPI_NOR_MODE_4S4S4S) && (bfpt_len >= 15U) &&
+             ((bfpt[4] & OSPI_NOR_BFPT_444_SUPPORT) != 0U) && ((OSPI_NOR_BFPT_444_ENABLE(bfpt) & 0x7U) != 0U))
+    {
+      mode = HAL_OSPI_NOR_MODE_4S4S4S;
+      OSPI_NOR_SetFastRead(hnor, bfpt[6] >> 16U);
+    }
+    else if ((hnor->Init.MaxMode >= HAL_OSPI_NOR_MODE_1S4S4S) && ((bfpt[0] & OSPI_NOR_BFPT_144_SUPPORT) != 0U))
+    {
+      mode = HAL_OSPI_NOR_MODE_1S4S4S;
+      OSPI_NOR_SetFastRead(hnor, bfpt[2] & 0xFFFFU);
+    }
+    else
+    {
+      /* Keep the 1S-1S-1S fast read */
+    }
+
+    /* Address size, entering the 4-byte address mode if it exists */
+    hnor->AddressBytes = 3U;
+    if (mode == HAL_OSPI_NOR_MODE_8D8D8D)
+    {
+      hnor->AddressBytes  = 4U;
+      use_4b_instructions = 1U;
+    }
+    else if (OSPI_NOR_BFPT_ADDR_BYTES(bfpt) == 2U)
+    {
+      hnor->AddressBytes = 4U;
+    }
+    else if ((OSPI_NOR_BFPT_ADDR_BYTES(bfpt) == 1U) && (hnor->MemorySize > OSPI_NOR_16MBYTES))
+    {
+      hnor->AddressBytes = 4U;
+      if ((bfpt_len >= 16U) && ((bfpt[15] & (OSPI_NOR_BFPT_4B_ENTER_B7 | OSPI_NOR_BFPT_4B_ENTER_WREN_B7)) != 0U))
+      {
+        if ((bfpt[15] & OSPI_NOR_BFPT_4B_ENTER_B7) == 0U)
+        {
+          status = OSPI_NOR_WriteEnable(hnor);
+        }
+        if (status == HAL_OK)
+        {
+          status = OSPI_NOR_WriteReg(hnor, OSPI_NOR_CMD_ENTER_4B, NULL, 0U);
+        }
+      }
+      else
+      {
+        use_4b_instructions = 1U;
+      }
+    }
+    else if (hnor->MemorySize > OSPI_NOR_16MBYTES)
+    {
+      /* Only the first 16 Mbytes can be addressed */
+      hnor->MemorySize = OSPI_NOR_16MBYTES;
+    }
+    else
+    {
+      /* 3-byte addresses */
+    }
+
+    if (use_4b_instructions != 0U)
+    {
+      if (mode != HAL_OSPI_NOR_MODE_8D8D8D)
+      {
+        hnor->ReadInstruction = OSPI_NOR_Instruction4B(hnor->ReadInstruction);
+      }
+      hnor->ProgramInstruction = OSPI_NOR_Instruction4B(hnor->ProgramInstruction);
+      for (index = 0U; index < 4U; index++)
+      {
+        hnor->Erase[index].Instruction = OSPI_NOR_Instruction4B(hnor->Erase[index].Instruction);
+      }
+    }
+  }
+
+  /* Switch the memory to the selected protocol */
+  if (status == HAL_OK)
+  {
+    if (mode == HAL_OSPI_NOR_MODE_8D8D8D)
+    {
+      status = OSPI_NOR_EnterOctalDdr(hnor, octal_seq, octal_len);
+
+      if (status == HAL_OK)
+      {
+        hnor->Mode               = HAL_OSPI_NOR_MODE_8D8D8D;
+        hnor->CmdExtInverted     = ((bfpt_len >= 18U) && (OSPI_NOR_BFPT_CMD_EXT(bfpt) == 0U)) ? 0U : 1U;
+        hnor->StatusAddressBytes = ((profile[0] & OSPI_NOR_PROFILE1_RDSR_ADDR) != 0U) ? 4U : 0U;
+        hnor->StatusDummyCycles  = ((profile[0] & OSPI_NOR_PROFILE1_RDSR_DUMMY_8) != 0U) ? 8U : 4U;
+      }
+    }
+    else if (mode != HAL_OSPI_NOR_MODE_1S1S1S)
+    {
+      status = OSPI_NOR_QuadEnable(hnor, (bfpt_len >= 15U) ? OSPI_NOR_BFPT_QER(bfpt) : 0U);
+
+      if ((status == HAL_OK) && (mode == HAL_OSPI_NOR_MODE_4S4S4S))
+      {
+        status = OSPI_NOR_WriteReg(hnor, (((OSPI_NOR_BFPT_444_ENABLE(bfpt) & 0x3U) != 0U) ?
+                                          OSPI_NOR_CMD_ENTER_QPI_38 : OSPI_NOR_CMD_ENTER_QPI_35), NULL, 0U);
+      }
+
+      if (status == HAL_OK)
+      {
+        hnor->Mode = mode;
+      }
+    }
+    else
+    {
+      /* Nothing to enable */
+    }
+
+    /* Check that the memory answers in the selected protocol */
+    if ((status == HAL_OK) && (OSPI_NOR_WaitReady(hnor, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK))
+    {
+      hnor->ErrorCode |= HAL_OSPI_NOR_ERROR_MODE;
+      status = HAL_ERROR;
+    }
+  }
+
+  if (status == HAL_OK)
+  {
+    /* Update the device size of the OctoSPI */
+    hnor->hospi->Init.DeviceSize = POSITION_VAL(hnor->MemorySize);
+    MODIFY_REG(hnor->hospi->Instance->DCR1, OCTOSPI_DCR1_DEVSIZE,
+               ((hnor->hospi->Init.DeviceSize - 1U) << OCTOSPI_DCR1_DEVSIZE_Pos));
+
+    /* Register images of the commands sent by the RAM executor */
+    OSPI_NOR_PrepareRegCmd(hnor, &hnor->RegWriteEnable, OSPI_NOR_CMD_WRITE_ENABLE, 0U, 0U, 0U);
+    OSPI_NOR_PrepareRegCmd(hnor, &hnor->RegProgram, hnor->ProgramInstruction, hnor->AddressBytes, 1U, 0U);
+    OSPI_NOR_PrepareRegCmd(hnor, &hnor->RegReadStatus, OSPI_NOR_CMD_READ_SR1, hnor->StatusAddressBytes, 1U,
+                           hnor->StatusDummyCycles);
+    for (index = 0U; index < 4U; index++)
+    {
+      OSPI_NOR_PrepareRegCmd(hnor, &hnor->RegErase[index], hnor->Erase[index].Instruction, hnor->AddressBytes,
+                             0U, 0U);
+    }
+
+    if ((bfpt_len >= 13U) && ((bfpt[11] & OSPI_NOR_BFPT_NO_SUSPEND) == 0U) && (OSPI_NOR_BFPT_SUSPEND(bfpt) != 0U))
+    {
+      hnor->SuspendSupported = 1U;
+      OSPI_NOR_PrepareRegCmd(hnor, &hnor->RegSuspend, OSPI_NOR_BFPT_SUSPEND(bfpt), 0U, 0U, 0U);
+      OSPI_NOR_PrepareRegCmd(hnor, &hnor->RegResume, OSPI_NOR_BFPT_RESUME(bfpt), 0U, 0U, 0U);
+    }
+
+    hnor->State = HAL_OSPI_NOR_STATE_READY;
+  }
+  else
+  {
+    if (hnor->ErrorCode == HAL_OSPI_NOR_ERROR_NONE)
+    {
+      hnor->ErrorCode = HAL_OSPI_NOR_ERROR_OSPI;
+    }
+    hnor->State = HAL_OSPI_NOR_STATE_ERROR;
+  }
+
+  /* Return function status */
+  return status;
+}
+
+/**
+  * @brief  De-Initialize the NOR flash.
+  * @param  hnor : OSPI NOR handle
+  * @note   The memory receives a software reset in the selected protocol and goes back
+  *         to its power-on protocol.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_OSPI_NOR_DeInit(OSPI_NOR_HandleTypeDef *hnor)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+  OSPI_RegularCmdTypeDef cmd;
+
+  /* Check the NOR handle allocation */
+  if ((hnor == NULL) || (hnor->hospi == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  if (hnor->State == HAL_OSPI_NOR_STATE_MEM_MAPPED)
+  {
+    status = HAL_OSPI_Abort(hnor->hospi);
+  }
+
+  if ((status == HAL_OK) && (hnor->State != HAL_OSPI_NOR_STATE_RESET))
+  {
+    OSPI_NOR_BuildCmd(hnor, &cmd, OSPI_NOR_CMD_PROTOCOL(hnor), OSPI_NOR_CMD_RESET_ENABLE, 0U, 0U, 0U, 0U);
+    status = HAL_OSPI_Command(hnor->hospi, &cmd, HAL_OSPI_TIMEOUT_DEFAULT_VALUE);
+
+    if (status == HAL_OK)
+    {
+      OSPI_NOR_BuildCmd(hnor, &cmd, OSPI_NOR_CMD_PROTOCOL(hnor), OSPI_NOR_CMD_RESET, 0U, 0U, 0U, 0U);
+      status = HAL_OSPI_Command(hnor->hospi, &cmd, HAL_OSPI_TIMEOUT_DEFAULT_VALUE);
+    }
+  }
+
+  if (status == HAL_OK)
+  {
+    hnor->Mode      = HAL_OSPI_NOR_MODE_1S1S1S;
+    hnor->ErrorCode = HAL_OSPI_NOR_ERROR_NONE;
+    hnor->State     = HAL_OSPI_NOR_STATE_RESET;
+  }
+  else
+  {
+    hnor->ErrorCode |= HAL_OSPI_NOR_ERROR_OSPI;
+  }
+
+  /* Return function status */
+  return status;
+}
+
+/**
+  * @}
+  */
+
+/** @defgroup OSPI_NOR_Exported_Functions_Group2 Input and Output operation functions
+  *  @brief OSPI NOR Transmit/Receive functions
+  *
+@verbatim
+ ===============================================================================
+                      ##### IO operation functions #####
+ ===============================================================================
+    [..]
+    This subsection provides a set of functions allowing to :
+      (+) Read the SFDP area and the memory array.
+      (+) Program a page and erase a block with the status polled by the OctoSPI.
+      (+) Enter and leave the memory-mapped mode.
+      (+) Handle the OSPI events of the non-blocking operations.
+      (+) Program and erase while executing in place.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Read the SFDP area of the memory.
+  * @param  hnor    : OSPI NOR handle
+  * @param  Address : address in the SFDP area
+  * @param  pData   : pointer to data buffer
+  * @param  Size    : number of bytes to read
+  * @note   This function is used only while the memory is in the 1S-1S-1S protocol.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_OSPI_NOR_ReadSFDP(OSPI_NOR_HandleTypeDef *hnor, uint32_t Address, uint8_t *pData, uint32_t Size)
+{
+  HAL_StatusTypeDef status;
+  OSPI_RegularCmdTypeDef cmd;
+
+  if ((pData == NULL) || (Size == 0U) || (hnor->Mode != HAL_OSPI_NOR_MODE_1S1S1S))
+  {
+    hnor->ErrorCode |= HAL_OSPI_NOR_ERROR_INVALID_PARAM;
+    return HAL_ERROR;
+  }
+
+  OSPI_NOR_BuildCmd(hnor, &cmd, HAL_OSPI_NOR_MODE_1S1S1S, OSPI_NOR_CMD_READ_SFDP, 3U, Address, Size,
+                    OSPI_NOR_SFDP_DUMMY_CYCLES);
+  status = HAL_OSPI_Command(hnor->hospi, &cmd, HAL_OSPI_TIMEOUT_DEFAULT_VALUE);
+
+  if (status == HAL_OK)
+  {
+    status = HAL_OSPI_Receive(hnor->hospi, pData, HAL_OSPI_TIMEOUT_DEFAULT_VALUE);
+  }
+
+  /* Return function status */
+  return status;
+}
+
+/**
+  * @brief  Read the memory array in indirect mode.
+  * @param  hnor    : OSPI NOR handle
+  * @param  Address : address in the memory
+  * @param  pData   : pointer to data buffer
+  * @param  Size    : number of bytes to read
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_OSPI_NOR_Read(OSPI_NOR_HandleTypeDef *hnor, uint32_t Address, uint8_t *pData, uint32_t Size)
+{
+  HAL_StatusTypeDef status;
+  OSPI_RegularCmdTypeDef cmd;
+
+  if ((pData == NULL) || (Size == 0U) || (Address >= hnor->MemorySize) || (Size > (hnor->MemorySize - Address)))
+  {
+    hnor->ErrorCode |= HAL_OSPI_NOR_ERROR_INVALID_PARAM;
+    return HAL_ERROR;
+  }
+
+  if (hnor->State != HAL_OSPI_NOR_STATE_READY)
+  {
+    hnor->ErrorCode |= HAL_OSPI_NOR_ERROR_INVALID_SEQUENCE;
+    return HAL_ERROR;
+  }
+
+  OSPI_NOR_BuildReadCmd(hnor, &cmd, Address, Size);
+  status = HAL_OSPI_Command(hnor->hospi, &cmd, HAL_OSPI_TIMEOUT_DEFAULT_VALUE);
+
+  if (status == HAL_OK)
+  {
+    status = HAL_OSPI_Receive(hnor->hospi, pData, HAL_OSPI_TIMEOUT_DEFAULT_VALUE);
+  }
+
+  if (status != HAL_OK)
+  {
+    hnor->ErrorCode |= HAL_OSPI_NOR_ERROR_OSPI;
+  }
+
+  /* Return function status */
+  return status;
+}
+
+/**
+  * @brief  Program data in one page of the memory in interrupt mode.
+  * @param  hnor    : OSPI NOR handle
+  * @param  Address : address in the memory
+  * @param  pData   : pointer to data buffer, kept until HAL_OSPI_NOR_ProgramCpltCallback()
+  * @param  Size    : number of bytes to program, the range should not cross a page boundary
+  * @note   In 8D-8D-8D protocol the address and the size should be even.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_OSPI_NOR_Program_IT(OSPI_NOR_HandleTypeDef *hnor, uint32_t Address, uint8_t *pData, uint32_t Size)
+{
+  HAL_StatusTypeDef status;
+  OSPI_RegularCmdTypeDef cmd;
+
+  if ((pData == NULL) || (Size == 0U) || (Address >= hnor->MemorySize) ||
+      (Size > (hnor->PageSize - (Address & (hnor->PageSize - 1U)))) ||
+      ((hnor->Mode == HAL_OSPI_NOR_MODE_8D8D8D) && (((Address | Size) & 0x1U) != 0U)))
+  {
+    hnor->ErrorCode |= HAL_OSPI_NOR_ERROR_INVALID_PARAM;
+    return HAL_ERROR;
+  }
+
+  if (hnor->State != HAL_OSPI_NOR_STATE_READY)
+  {
+    hnor->ErrorCode |= HAL_OSPI_NOR_ERROR_INVALID_SEQUENCE;
+    return HAL_ERROR;
+  }
+
+  hnor->State = HAL_OSPI_NOR_STATE_BUSY_PROGRAM;
+
+  status = OSPI_NOR_WriteEnable(hnor);
+
+  if (status == HAL_OK)
+  {
+    OSPI_NOR_BuildCmd(hnor, &cmd, OSPI_NOR_CMD_PROTOCOL(hnor), hnor->ProgramInstruction, hnor->AddressBytes,
+                      Address, Size, 0U);
+    status = HAL_OSPI_Command(hnor->hospi, &cmd, HAL_OSPI_TIMEOUT_DEFAULT_VALUE);
+  }
+
+  if (status == HAL_OK)
+  {
+    /* The status polling starts from HAL_OSPI_NOR_TxCpltHandler() */
+    status = HAL_OSPI_Transmit_IT(hnor->hospi, pData);
+  }
+
+  if (status != HAL_OK)
+  {
+    hnor->ErrorCode |= HAL_OSPI_NOR_ERROR_OSPI;
+    hnor->State = HAL_OSPI_NOR_STATE_READY;
+  }
+
+  /* Return function status */
+  return status;
+}
+
+/**
+  * @brief  Erase one block of the memory in interrupt mode.
+  * @param  hnor    : OSPI NOR handle
+  * @param  Address : address of the block, aligned on its size
+  * @param  Size    : size of the block, one of the sizes of the Erase field of the handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_OSPI_NOR_Erase_IT(OSPI_NOR_HandleTypeDef *hnor, uint32_t Address, uint32_t Size)
+{
+  HAL_StatusTypeDef status;
+  OSPI_RegularCmdTypeDef cmd;
+  OSPI_AutoPollingTypeDef cfg;
+  uint32_t index;
+
+  for (index = 0U; index < 4U; index++)
+  {
+    if ((Size != 0U) && (hnor->Erase[index].Size == Size))
+    {
+      break;
+    }
+  }
+
+  if ((index == 4U) || ((Address & (Size - 1U)) != 0U) || (Address >= hnor->MemorySize))
+  {
+    hnor->ErrorCode |= HAL_OSPI_NOR_ERROR_INVALID_PARAM;
+    return HAL_ERROR;
+  }
+
+  if (hnor->State != HAL_OSPI_NOR_STATE_READY)
+  {
+    hnor->ErrorCode |= HAL_OSPI_NOR_ERROR_INVALID_SEQUENCE;
+    return HAL_ERROR;
+  }
+
+  hnor->State = HAL_OSPI_NOR_STATE_BUSY_ERASE;
+
+  status = OSPI_NOR_WriteEnable(hnor);
+
+  if (status == HAL_OK)
+  {
+    OSPI_NOR_BuildCmd(hnor, &cmd, OSPI_NOR_CMD_PROTOCOL(hnor), hnor->Erase[index].Instruction, hnor->AddressBytes,
+                      Address, 0U, 0U);
+    status = HAL_OSPI_Command(hnor->hospi, &cmd, HAL_OSPI_TIMEOUT_DEFAULT_VALUE);
+  }
+
+  if (status == HAL_OK)
+  {
+    status = OSPI_NOR_ConfigStatusPolling(hnor, &cfg);
+  }
+
+  if (status == HAL_OK)
+  {
+    status = HAL_OSPI_AutoPolling_IT(hnor->hospi, &cfg);
+  }
+
+  if (status != HAL_OK)
+  {
+    hnor->ErrorCode |= HAL_OSPI_NOR_ERROR_OSPI;
+    hnor->State = HAL_OSPI_NOR_STATE_READY;
+  }
+
+  /* Return function status */
+  return status;
+}
+
+/**
+  * @brief  Enter the memory-mapped mode.
+  * @param  hnor       : OSPI NOR handle
+  * @param  XipProfile : XIP preset applied to the read path.
+  *          This parameter can be a value of @ref OSPI_XipProfile
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_OSPI_NOR_MemoryMapped(OSPI_NOR_HandleTypeDef *hnor, uint32_t XipProfile)
+{
+  HAL_StatusTypeDef status;
+  OSPI_RegularCmdTypeDef cmd;
+  OSPI_XipProfileTypeDef profile;
+
+  if (hnor->State != HAL_OSPI_NOR_STATE_READY)
+  {
+    hnor->ErrorCode |= HAL_OSPI_NOR_ERROR_INVALID_SEQUENCE;
+    return HAL_ERROR;
+  }
+
+  /* Write configuration, required by the memory-mapped mode */
+  OSPI_NOR_BuildCmd(hnor, &cmd, OSPI_NOR_CMD_PROTOCOL(hnor), hnor->ProgramInstruction, hnor->AddressBytes,
+                    0U, 1U, 0U);
+  cmd.OperationType = HAL_OSPI_OPTYPE_WRITE_CFG;
+  if (hnor->Mode == HAL_OSPI_NOR_MODE_8D8D8D)
+  {
+    cmd.DQSMode = HAL_OSPI_DQS_ENABLE;
+  }
+  status = HAL_OSPI_Command(hnor->hospi, &cmd, HAL_OSPI_TIMEOUT_DEFAULT_VALUE);
+
+  /* Read configuration and memory-mapped mode */
+  if (status == HAL_OK)
+  {
+    status = HAL_OSPI_XipGetProfile(XipProfile, hnor->ReadDummyCycles,
+                                    ((hnor->Mode == HAL_OSPI_NOR_MODE_8D8D8D) ?
+                                     HAL_OSPI_DATA_DTR_ENABLE : HAL_OSPI_DATA_DTR_DISABLE), &profile);
+  }
+
+  if (status == HAL_OK)
+  {
+    OSPI_NOR_BuildReadCmd(hnor, &cmd, 0U, 1U);
+    status = HAL_OSPI_XipStart(hnor->hospi, &cmd, &profile);
+  }
+
+  if (status == HAL_OK)
+  {
+    hnor->State = HAL_OSPI_NOR_STATE_MEM_MAPPED;
+  }
+  else
+  {
+    hnor->ErrorCode |= HAL_OSPI_NOR_ERROR_OSPI;
+  }
+
+  /* Return function status */
+  return status;
+}
+
+/**
+  * @brief  Leave the memory-mapped mode.
+  * @param  hnor : OSPI NOR handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_OSPI_NOR_StopMemoryMapped(OSPI_NOR_HandleTypeDef *hnor)
+{
+  HAL_StatusTypeDef status;
+
+  if (hnor->State != HAL_OSPI_NOR_STATE_MEM_MAPPED)
+  {
+    hnor->ErrorCode |= HAL_OSPI_NOR_ERROR_INVALID_SEQUENCE;
+    return HAL_ERROR;
+  }
+
+  status = HAL_OSPI_Abort(hnor->hospi);
+
+  if (status == HAL_OK)
+  {
+    hnor->State = HAL_OSPI_NOR_STATE_READY;
+  }
+  else
+  {
+    hnor->ErrorCode |= HAL_OSPI_NOR_ERROR_OSPI;
+  }
+
+  /* Return function status */
+  return status;
+}
+
+/**
+  * @brief  Handle the end of the data transmission of a page program.
+  * @param  hnor : OSPI NOR handle
+  * @note   This function should be called from HAL_OSPI_TxCpltCallback().
+  * @retval None
+  */
+void HAL_OSPI_NOR_TxCpltHandler(OSPI_NOR_HandleTypeDef *hnor)
+{
+  OSPI_AutoPollingTypeDef cfg;
+
+  if (hnor->State == HAL_OSPI_NOR_STATE_BUSY_PROGRAM)
+  {
+    /* Poll the write in progress bit until the page is programmed */
+    if ((OSPI_NOR_ConfigStatusPolling(hnor, &cfg) != HAL_OK) ||
+        (HAL_OSPI_AutoPolling_IT(hnor->hospi, &cfg) != HAL_OK))
+    {
+      hnor->ErrorCode |= HAL_OSPI_NOR_ERROR_OSPI;
+      hnor->State = HAL_OSPI_NOR_STATE_READY;
+
+      HAL_OSPI_NOR_ErrorCallback(hnor);
+    }
+  }
+}
+
+/**
+  * @brief  Handle the end of the status polling of a page program or an erase.
+  * @param  hnor : OSPI NOR handle
+  * @note   This function should be called from HAL_OSPI_StatusMatchCallback().
+  * @retval None
+  */
+void HAL_OSPI_NOR_StatusMatchHandler(OSPI_NOR_HandleTypeDef *hnor)
+{
+  if (hnor->State == HAL_OSPI_NOR_STATE_BUSY_PROGRAM)
+  {
+    hnor->State = HAL_OSPI_NOR_STATE_READY;
+
+    HAL_OSPI_NOR_ProgramCpltCallback(hnor);
+  }
+  else if (hnor->State == HAL_OSPI_NOR_STATE_BUSY_ERASE)
+  {
+    hnor->State = HAL_OSPI_NOR_STATE_READY;
+
+    HAL_OSPI_NOR_EraseCpltCallback(hnor);
+  }
+  else
+  {
+    /* Not a NOR operation */
+  }
+}
+
+/**
+  * @brief  Handle an OSPI error during a page program or an erase.
+  * @param  hnor : OSPI NOR handle
+  * @note   This function should be called from HAL_OSPI_ErrorCallback().
+  * @retval None
+  */
+void HAL_OSPI_NOR_ErrorHandler(OSPI_NOR_HandleTypeDef *hnor)
+{
+  if ((hnor->State == HAL_OSPI_NOR_STATE_BUSY_PROGRAM) || (hnor->State == HAL_OSPI_NOR_STATE_BUSY_ERASE))
+  {
+    hnor->ErrorCode |= HAL_OSPI_NOR_ERROR_OSPI;
+    hnor->State = HAL_OSPI_NOR_STATE_READY;
+
+    HAL_OSPI_NOR_ErrorCallback(hnor);
+  }
+}
+
+/**
+  * @brief  Page program complete callback.
+  * @param  hnor : OSPI NOR handle
+  * @retval None
+  */
+__weak void HAL_OSPI_NOR_ProgramCpltCallback(OSPI_NOR_HandleTypeDef *hnor)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hnor);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_OSPI_NOR_ProgramCpltCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Erase complete callback.
+  * @param  hnor : OSPI NOR handle
+  * @retval None
+  */
+__weak void HAL_OSPI_NOR_EraseCpltCallback(OSPI_NOR_HandleTypeDef *hnor)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hnor);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_OSPI_NOR_EraseCpltCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Error callback.
+  * @param  hnor : OSPI NOR handle
+  * @retval None
+  */
+__weak void HAL_OSPI_NOR_ErrorCallback(OSPI_NOR_HandleTypeDef *hnor)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hnor);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_OSPI_NOR_ErrorCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Queue a program operation for HAL_OSPI_NOR_ServiceQueue().
+  * @param  hnor    : OSPI NOR handle
+  * @param  Address : address in the memory
+  * @param  pData   : pointer to data buffer, kept until the operation is done
+  * @param  Size    : number of bytes to program, the range can cross page boundaries
+  * @note   In 8D-8D-8D protocol the address and the size should be even.
+  * @retval HAL status, HAL_BUSY when the queue is full
+  */
+HAL_StatusTypeDef HAL_OSPI_NOR_QueueProgram(OSPI_NOR_HandleTypeDef *hnor, uint32_t Address, uint8_t *pData, uint32_t Size)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+  OSPI_NOR_OperationTypeDef *op = NULL;
+  uint32_t primask_bit;
+
+  if ((pData == NULL) || (Size == 0U) || (Address >= hnor->MemorySize) || (Size > (hnor->MemorySize - Address)) ||
+      ((hnor->Mode == HAL_OSPI_NOR_MODE_8D8D8D) && (((Address | Size) & 0x1U) != 0U)))
+  {
+    hnor->ErrorCode |= HAL_OSPI_NOR_ERROR_INVALID_PARAM;
+    return HAL_ERROR;
+  }
+
+  if ((hnor->State != HAL_OSPI_NOR_STATE_READY) && (hnor->State != HAL_OSPI_NOR_STATE_MEM_MAPPED))
+  {
+    hnor->ErrorCode |= HAL_OSPI_NOR_ERROR_INVALID_SEQUENCE;
+    return HAL_ERROR;
+  }
+
+  /* The executor may run from an interrupt */
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  if (hnor->QueueCount != 0U)
+  {
+    op = &hnor->Queue[(hnor->QueueHead + hnor->QueueCount - 1U) % HAL_OSPI_NOR_QUEUE_DEPTH];
+  }
+
+  if ((op != NULL) && (op->Type == HAL_OSPI_NOR_OPERATION_PROGRAM) &&
+      ((op->Address + op->Size) == Address) && (&op->pData[op->Size] == pData))
+  {
+    /* Back-to-back program: one operation, run in the same memory-mapped mode interruption */
+    op->Size += Size;
+  }
+  else if (hnor->QueueCount < HAL_OSPI_NOR_QUEUE_DEPTH)
+  {
+    op = &hnor->Queue[(hnor->QueueHead + hnor->QueueCount) % HAL_OSPI_NOR_QUEUE_DEPTH];
+    op->Type       = HAL_OSPI_NOR_OPERATION_PROGRAM;
+    op->Address    = Address;
+    op->pData      = pData;
+    op->Size       = Size;
+    op->EraseIndex = 0U;
+    hnor->QueueCount++;
+  }
+  else
+  {
+    status = HAL_BUSY;
+  }
+
+  __set_PRIMASK(primask_bit);
+
+  /* Return function status */
+  return status;
+}
+
+/**
+  * @brief  Queue an erase operation for HAL_OSPI_NOR_ServiceQueue().
+  * @param  hnor    : OSPI NOR handle
+  * @param  Address : address of the erased range
+  * @param  Size    : size of the erased range
+  * @note   The range is erased with the largest erase type of the memory which both the address
+  *         and the size are multiple of.
+  * @retval HAL status, HAL_BUSY when the queue is full
+  */
+HAL_StatusTypeDef HAL_OSPI_NOR_QueueErase(OSPI_NOR_HandleTypeDef *hnor, uint32_t Address, uint32_t Size)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+  OSPI_NOR_OperationTypeDef *op = NULL;
+  uint32_t primask_bit;
+  uint32_t erase_index = 4U;
+  uint32_t index;
+
+  for (index = 0U; index < 4U; index++)
+  {
+    if ((hnor->Erase[index].Size != 0U) && (((Address | Size) & (hnor->Erase[index].Size - 1U)) == 0U) &&
+        ((erase_index == 4U) || (hnor->Erase[index].Size > hnor->Erase[erase_index].Size)))
+    {
+      erase_index = index;
+    }
+  }
+
+  if ((erase_index == 4U) || (Size == 0U) || (Address >= hnor->MemorySize) || (Size > (hnor->MemorySize - Address)))
+  {
+    hnor->ErrorCode |= HAL_OSPI_NOR_ERROR_INVALID_PARAM;
+    return HAL_ERROR;
+  }
+
+  if ((hnor->State != HAL_OSPI_NOR_STATE_READY) && (hnor->State != HAL_OSPI_NOR_STATE_MEM_MAPPED))
+  {
+    hnor->ErrorCode |= HAL_OSPI_NOR_ERROR_INVALID_SEQUENCE;
+    return HAL_ERROR;
+  }
+
+  /* The executor may run from an interrupt */
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  if (hnor->QueueCount != 0U)
+  {
+    op = &hnor->Queue[(hnor->QueueHead + hnor->QueueCount - 1U) % HAL_OSPI_NOR_QUEUE_DEPTH];
+  }
+
+  if ((op != NULL) && (op->Type == HAL_OSPI_NOR_OPERATION_ERASE) && (op->EraseIndex == erase_index) &&
+      ((op->Address + op->Size) == Address))
+  {
+    op->Size += Size;
+  }
+  else if (hnor->QueueCount < HAL_OSPI_NOR_QUEUE_DEPTH)
+  {
+    op = &hnor->Queue[(hnor->QueueHead + hnor->QueueCount) % HAL_OSPI_NOR_QUEUE_DEPTH];
+    op->Type       = HAL_OSPI_NOR_OPERATION_ERASE;
+    op->Address    = Address;
+    op->pData      = NULL;
+    op->Size       = Size;
+    op->EraseIndex = erase_index;
+    hnor->QueueCount++;
+  }
+  else
+  {
+    status = HAL_BUSY;
+  }
+
+  __set_PRIMASK(primask_bit);
+
+  /* Return function status */
+  return status;
+}
+
+/**
+  * @brief  Run the queued operations while interrupting the memory-mapped mode.
+  * @param  hnor   : OSPI NOR handle
+  * @param  Budget : maximum number of CPU cycles spent out of the memory-mapped mode,
+  *                  exceeded only to complete a page program or to suspend an erase
+  * @note   This function is executed from RAM with the interrupts masked. The state of the
+  *         OSPI handle is not changed: the memory-mapped configuration registers are saved
+  *         and restored around the operations.
+  * @note   The DWT cycle counter is enabled by this function if it was not already running.
+  * @retval HAL_OK when the queue is empty, HAL_BUSY when operations remain
+  */
+__RAM_FUNC HAL_StatusTypeDef HAL_OSPI_NOR_ServiceQueue(OSPI_NOR_HandleTypeDef *hnor, uint32_t Budget)
+{
+  OCTOSPI_TypeDef *instance = hnor->hospi->Instance;
+  uint32_t primask_bit;
+  uint32_t tickstart;
+  uint32_t reg_cr;
+  uint32_t reg_ccr;
+  uint32_t reg_tcr;
+  uint32_t reg_ir;
+  uint32_t reg_abr;
+  uint32_t running = 1U;
+
+  if (hnor->State != HAL_OSPI_NOR_STATE_MEM_MAPPED)
+  {
+    hnor->ErrorCode |= HAL_OSPI_NOR_ERROR_INVALID_SEQUENCE;
+    return HAL_ERROR;
+  }
+
+  if ((hnor->QueueCount == 0U) && (hnor->QueueState == OSPI_NOR_QUEUE_IDLE))
+  {
+    return HAL_OK;
+  }
+
+  /* Start the cycle counter if needed */
+  if ((DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk) == 0U)
+  {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0U;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+  }
+
+  /* Nothing may fetch from the memory until the memory-mapped mode is restored */
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+  tickstart = DWT->CYCCNT;
+
+  /* Leave the memory-mapped mode, keeping its read configuration */
+  reg_cr  = READ_REG(instance->CR);
+  reg_ccr = READ_REG(instance->CCR);
+  reg_tcr = READ_REG(instance->TCR);
+  reg_ir  = READ_REG(instance->IR);
+  reg_abr = READ_REG(instance->ABR);
+  OSPI_NOR_RamAbort(instance);
+
+  if (hnor->QueueState == OSPI_NOR_QUEUE_SUSPENDED)
+  {
+    OSPI_NOR_RamCommand(instance, &hnor->RegResume, OSPI_NOR_FMODE_INDIRECT_WRITE, 0U, 0U);
+    OSPI_NOR_RamWaitTc(instance);
+    hnor->QueueState = OSPI_NOR_QUEUE_BUSY;
+  }
+
+  while (running != 0U)
+  {
+    if (hnor->QueueState == OSPI_NOR_QUEUE_IDLE)
+    {
+      /* Chain the next chunk while the budget allows it */
+      if ((hnor->QueueCount != 0U) && ((DWT->CYCCNT - tickstart) < Budget))
+      {
+        OSPI_NOR_RamStartChunk(hnor);
+      }
+      else
+      {
+        running = 0U;
+      }
+    }
+    else if ((OSPI_NOR_RamReadStatus(hnor) & OSPI_NOR_SR_WIP) == 0U)
+    {
+      OSPI_NOR_RamEndChunk(hnor);
+    }
+    else if (((DWT->CYCCNT - tickstart) >= Budget) && (hnor->SuspendSupported != 0U) &&
+             (hnor->Queue[hnor->QueueHead].Type == HAL_OSPI_NOR_OPERATION_ERASE))
+    {
+      /* Suspend the erase and wait for the memory to accept reads again */
+      OSPI_NOR_RamCommand(instance, &hnor->RegSuspend, OSPI_NOR_FMODE_INDIRECT_WRITE, 0U, 0U);
+      OSPI_NOR_RamWaitTc(instance);
+      while ((OSPI_NOR_RamReadStatus(hnor) & OSPI_NOR_SR_WIP) != 0U)
+      {
+      }
+      hnor->QueueState = OSPI_NOR_QUEUE_SUSPENDED;
+      running = 0U;
+    }
+    else
+    {
+      /* Operation ongoing */
+    }
+  }
+
+  /* Restore the memory-mapped mode */
+  WRITE_REG(instance->CCR, reg_ccr);
+  WRITE_REG(instance->TCR, reg_tcr);
+  WRITE_REG(instance->IR,  reg_ir);
+  WRITE_REG(instance->ABR, reg_abr);
+  WRITE_REG(instance->CR,  reg_cr);
+
+  __set_PRIMASK(primask_bit);
+
+  return (((hnor->QueueCount != 0U) || (hnor->QueueState != OSPI_NOR_QUEUE_IDLE)) ? HAL_BUSY : HAL_OK);
+}
+
+/**
+  * @}
+  */
+
+/** @defgroup OSPI_NOR_Exported_Functions_Group3 Peripheral State and Errors functions
+  *  @brief   OSPI NOR State and Errors functions
+  *
+@verbatim
+ ===============================================================================
+                  ##### Peripheral State and Errors functions #####
+ ===============================================================================
+    [..]
+    This subsection provides a set of functions allowing to :
+      (+) Get the error code.
+      (+) Get the driver state.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Return the NOR error code.
+  * @param  hnor : OSPI NOR handle
+  * @retval NOR Error Code
+  */
+uint32_t HAL_OSPI_NOR_GetError(OSPI_NOR_HandleTypeDef *hnor)
+{
+  return hnor->ErrorCode;
+}
+
+/**
+  * @brief  Return the NOR handle state.
+  * @param  hnor : OSPI NOR handle
+  * @retval HAL state
+  */
+HAL_OSPI_NOR_StateTypeDef HAL_OSPI_NOR_GetState(OSPI_NOR_HandleTypeDef *hnor)
+{
+  /* Return NOR handle state */
+  return hnor->State;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  @cond 0
+  */
+/**
+  * @brief  Fill a regular command for the memory.
+  * @param  hnor         : OSPI NOR handle
+  * @param  cmd          : command to fill
+  * @param  Protocol     : protocol of the command, value of @ref OSPI_NOR_Mode
+  * @param  Instruction  : 8-bit instruction
+  * @param  AddressBytes : number of address bytes, 0 for no address phase
+  * @param  Address      : address
+  * @param  NbData       : number of data, 0 for no data phase
+  * @param  DummyCycles  : number of dummy cycles
+  * @retval None
+  */
+static void OSPI_NOR_BuildCmd(const OSPI_NOR_HandleTypeDef *hnor, OSPI_RegularCmdTypeDef *cmd,
+                              uint32_t Protocol, uint32_t Instruction, uint32_t AddressBytes,
+                              uint32_t Address, uint32_t NbData, uint32_t DummyCycles)
+{
+  uint32_t address_mode;
+  uint32_t data_mode;
+  uint32_t dtr_mode;
+
+  cmd->OperationType         = HAL_OSPI_OPTYPE_COMMON_CFG;
+  cmd->FlashId               = HAL_OSPI_FLASH_ID_1;
+  cmd->AlternateBytes        = 0U;
+  cmd->AlternateBytesMode    = HAL_OSPI_ALTERNATE_BYTES_NONE;
+  cmd->AlternateBytesSize    = HAL_OSPI_ALTERNATE_BYTES_8_BITS;
+  cmd->AlternateBytesDtrMode = HAL_OSPI_ALTERNATE_BYTES_DTR_DISABLE;
+  cmd->DummyCycles           = DummyCycles;
+  cmd->DQSMode               = HAL_OSPI_DQS_DISABLE;
+  cmd->SIOOMode              = HAL_OSPI_SIOO_INST_EVERY_CMD;
+
+  if (Protocol == HAL_OSPI_NOR_MODE_8D8D8D)
+  {
+    /* 16-bit instruction made of the instruction and its extension */
+    cmd->InstructionMode    = HAL_OSPI_INSTRUCTION_8_LINES;
+    cmd->InstructionSize    = HAL_OSPI_INSTRUCTION_16_BITS;
+    cmd->InstructionDtrMode = HAL_OSPI_INSTRUCTION_DTR_ENABLE;
+    cmd->Instruction        = (Instruction << 8U) |
+                              ((hnor->CmdExtInverted != 0U) ? (~Instruction & 0xFFU) : Instruction);
+    address_mode            = HAL_OSPI_ADDRESS_8_LINES;
+    data_mode               = HAL_OSPI_DATA_8_LINES;
+    dtr_mode                = 1U;
+  }
+  else
+  {
+    cmd->InstructionMode    = (Protocol == HAL_OSPI_NOR_MODE_4S4S4S) ? HAL_OSPI_INSTRUCTION_4_LINES :
+                                                                       HAL_OSPI_INSTRUCTION_1_LINE;
+    cmd->InstructionSize    = HAL_OSPI_INSTRUCTION_8_BITS;
+    cmd->InstructionDtrMode = HAL_OSPI_INSTRUCTION_DTR_DISABLE;
+    cmd->Instruction        = Instruction;
+    address_mode            = (Protocol == HAL_OSPI_NOR_MODE_1S1S1S) ? HAL_OSPI_ADDRESS_1_LINE :
+                                                                       HAL_OSPI_ADDRESS_4_LINES;
+    data_mode               = (Protocol == HAL_OSPI_NOR_MODE_1S1S1S) ? HAL_OSPI_DATA_1_LINE :
+                                                                       HAL_OSPI_DATA_4_LINES;
+    dtr_mode                = 0U;
+  }
+
+  cmd->Address        = Address;
+  cmd->AddressMode    = (AddressBytes != 0U) ? address_mode : HAL_OSPI_ADDRESS_NONE;
+  cmd->AddressSize    = (AddressBytes == 4U) ? HAL_OSPI_ADDRESS_32_BITS : HAL_OSPI_ADDRESS_24_BITS;
+  cmd->AddressDtrMode = (dtr_mode != 0U) ? HAL_OSPI_ADDRESS_DTR_ENABLE : HAL_OSPI_ADDRESS_DTR_DISABLE;
+  cmd->NbData         = NbData;
+  cmd->DataMode       = (NbData != 0U) ? data_mode : HAL_OSPI_DATA_NONE;
+  cmd->DataDtrMode    = (dtr_mode != 0U) ? HAL_OSPI_DATA_DTR_ENABLE : HAL_OSPI_DATA_DTR_DISABLE;
+}
+
+/**
+  * @brief  Fill the fast read command of the selected protocol.
+  * @param  hnor    : OSPI NOR handle
+  * @param  cmd     : command to fill
+  * @param  Address : address
+  * @param  NbData  : number of data
+  * @retval None
+  */
+static void OSPI_NOR_BuildReadCmd(const OSPI_NOR_HandleTypeDef *hnor, OSPI_RegularCmdTypeDef *cmd,
+                                  uint32_t Address, uint32_t NbData)
+{
+  OSPI_NOR_BuildCmd(hnor, cmd, hnor->Mode, hnor->ReadInstruction, hnor->AddressBytes, Address, NbData,
+                    hnor->ReadDummyCycles);
+
+  if (hnor->ReadModeBytes != 0U)
+  {
+    /* Mode bits sent explicitly so that the memory does not enter its continuous read mode */
+    cmd->AlternateBytes     = OSPI_NOR_MODE_BITS;
+    cmd->AlternateBytesMode = (hnor->Mode == HAL_OSPI_NOR_MODE_1S1S1S) ? HAL_OSPI_ALTERNATE_BYTES_1_LINE :
+                                                                         HAL_OSPI_ALTERNATE_BYTES_4_LINES;
+  }
+
+  if (hnor->Mode == HAL_OSPI_NOR_MODE_8D8D8D)
+  {
+    cmd->DQSMode = HAL_OSPI_DQS_ENABLE;
+  }
+}
+
+/**
+  * @brief  Read one byte register of the memory in the 1S-1S-1S protocol.
+  * @param  hnor        : OSPI NOR handle
+  * @param  Instruction : read register instruction
+  * @param  pData       : register value
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef OSPI_NOR_ReadReg(OSPI_NOR_HandleTypeDef *hnor, uint32_t Instruction, uint8_t *pData)
+{
+  HAL_StatusTypeDef status;
+  OSPI_RegularCmdTypeDef cmd;
+
+  OSPI_NOR_BuildCmd(hnor, &cmd, HAL_OSPI_NOR_MODE_1S1S1S, Instruction, 0U, 0U, 1U, 0U);
+  status = HAL_OSPI_Command(hnor->hospi, &cmd, HAL_OSPI_TIMEOUT_DEFAULT_VALUE);
+
+  if (status == HAL_OK)
+  {
+    status = HAL_OSPI_Receive(hnor->hospi, pData, HAL_OSPI_TIMEOUT_DEFAULT_VALUE);
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Send the write enable instruction.
+  * @param  hnor : OSPI NOR handle
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef OSPI_NOR_WriteEnable(OSPI_NOR_HandleTypeDef *hnor)
+{
+  OSPI_RegularCmdTypeDef cmd;
+
+  OSPI_NOR_BuildCmd(hnor, &cmd, OSPI_NOR_CMD_PROTOCOL(hnor), OSPI_NOR_CMD_WRITE_ENABLE, 0U, 0U, 0U, 0U);
+
+  return HAL_OSPI_Command(hnor->hospi, &cmd, HAL_OSPI_TIMEOUT_DEFAULT_VALUE);
+}
+
+/**
+  * @brief  Send a write register instruction and wait for its completion.
+  * @param  hnor        : OSPI NOR handle
+  * @param  Instruction : write register instruction
+  * @param  pData       : register values, NULL when Size is 0
+  * @param  Size        : number of register bytes
+  * @note   The write enable instruction is sent only for a non-zero Size.
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef OSPI_NOR_WriteReg(OSPI_NOR_HandleTypeDef *hnor, uint32_t Instruction, uint8_t *pData,
+                                           uint32_t Size)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+  OSPI_RegularCmdTypeDef cmd;
+
+  if (Size != 0U)
+  {
+    status = OSPI_NOR_WriteEnable(hnor);
+  }
+
+  if (status == HAL_OK)
+  {
+    OSPI_NOR_BuildCmd(hnor, &cmd, OSPI_NOR_CMD_PROTOCOL(hnor), Instruction, 0U, 0U, Size, 0U);
+    status = HAL_OSPI_Command(hnor->hospi, &cmd, HAL_OSPI_TIMEOUT_DEFAULT_VALUE);
+  }
+
+  if ((status == HAL_OK) && (Size != 0U))
+  {
+    status = HAL_OSPI_Transmit(hnor->hospi, pData, HAL_OSPI_TIMEOUT_DEFAULT_VALUE);
+
+    if (status == HAL_OK)
+    {
+      status = OSPI_NOR_WaitReady(hnor, HAL_OSPI_TIMEOUT_DEFAULT_VALUE);
+    }
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Send the read status command and fill the polling of the write in progress bit.
+  * @param  hnor : OSPI NOR handle
+  * @param  cfg  : automatic polling configuration to fill
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef OSPI_NOR_ConfigStatusPolling(OSPI_NOR_HandleTypeDef *hnor, OSPI_AutoPollingTypeDef *cfg)
+{
+  OSPI_RegularCmdTypeDef cmd;
+
+  /* Data are read by pairs of bytes in DTR */
+  OSPI_NOR_BuildCmd(hnor, &cmd, OSPI_NOR_CMD_PROTOCOL(hnor), OSPI_NOR_CMD_READ_SR1, hnor->StatusAddressBytes, 0U,
+                    ((hnor->Mode == HAL_OSPI_NOR_MODE_8D8D8D) ? 2U : 1U), hnor->StatusDummyCycles);
+  if (hnor->Mode == HAL_OSPI_NOR_MODE_8D8D8D)
+  {
+    cmd.DQSMode = HAL_OSPI_DQS_ENABLE;
+  }
+
+  cfg->Match         = 0U;
+  cfg->Mask          = OSPI_NOR_SR_WIP;
+  cfg->MatchMode     = HAL_OSPI_MATCH_MODE_AND;
+  cfg->AutomaticStop = HAL_OSPI_AUTOMATIC_STOP_ENABLE;
+  cfg->Interval      = OSPI_NOR_POLLING_INTERVAL;
+
+  return HAL_OSPI_Command(hnor->hospi, &cmd, HAL_OSPI_TIMEOUT_DEFAULT_VALUE);
+}
+
+/**
+  * @brief  Wait until the memory has completed its internal operation.
+  * @param  hnor    : OSPI NOR handle
+  * @param  Timeout : timeout duration
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef OSPI_NOR_WaitReady(OSPI_NOR_HandleTypeDef *hnor, uint32_t Timeout)
+{
+  HAL_StatusTypeDef status;
+  OSPI_AutoPollingTypeDef cfg;
+
+  status = OSPI_NOR_ConfigStatusPolling(hnor, &cfg);
+
+  if (status == HAL_OK)
+  {
+    status = HAL_OSPI_AutoPolling(hnor->hospi, &cfg, Timeout);
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Set the quad enable bit of the memory.
+  * @param  hnor : OSPI NOR handle
+  * @param  Qer  : quad enable requirements field of the basic flash parameter table
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef OSPI_NOR_QuadEnable(OSPI_NOR_HandleTypeDef *hnor, uint32_t Qer)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+  uint8_t reg[2] = {0U, 0U};
+
+  switch (Qer)
+  {
+    case 1U :
+      /* Bit 1 of status register 2, which cannot be read: written with status register 1 */
+      status = OSPI_NOR_ReadReg(hnor, OSPI_NOR_CMD_READ_SR1, &reg[0]);
+      reg[1] = 0x02U;
+      if (status == HAL_OK)
+      {
+        status = OSPI_NOR_WriteReg(hnor, OSPI_NOR_CMD_WRITE_SR, reg, 2U);
+      }
+      break;
+
+    case 2U :
+      /* Bit 6 of status register 1 */
+      status = OSPI_NOR_ReadReg(hnor, OSPI_NOR_CMD_READ_SR1, &reg[0]);
+      if ((status == HAL_OK) && ((reg[0] & 0x40U) == 0U))
+      {
+        reg[0] |= 0x40U;
+        status = OSPI_NOR_WriteReg(hnor, OSPI_NOR_CMD_WRITE_SR, reg, 1U);
+      }
+      break;
+
+    case 3U :
+      /* Bit 7 of status register 2, with dedicated instructions */
+      status = OSPI_NOR_ReadReg(hnor, OSPI_NOR_CMD_READ_SR2_BIT7, &reg[0]);
+      if ((status == HAL_OK) && ((reg[0] & 0x80U) == 0U))
+      {
+        reg[0] |= 0x80U;
+        status = OSPI_NOR_WriteReg(hnor, OSPI_NOR_CMD_WRITE_SR2_BIT7, reg, 1U);
+      }
+      break;
+
+    case 4U :
+    case 5U :
+      /* Bit 1 of status register 2, written with status register 1 */
+      status = OSPI_NOR_ReadReg(hnor, OSPI_NOR_CMD_READ_SR1, &reg[0]);
+      if (status == HAL_OK)
+      {
+        status = OSPI_NOR_ReadReg(hnor, OSPI_NOR_CMD_READ_SR2, &reg[1]);
+      }
+      if ((status == HAL_OK) && ((reg[1] & 0x02U) == 0U))
+      {
+        reg[1] |= 0x02U;
+        status = OSPI_NOR_WriteReg(hnor, OSPI_NOR_CMD_WRITE_SR, reg, 2U);
+      }
+      break;
+
+    case 6U :
+      /* Bit 1 of status register 2, with a dedicated write instruction */
+      status = OSPI_NOR_ReadReg(hnor, OSPI_NOR_CMD_READ_SR2, &reg[0]);
+      if ((status == HAL_OK) && ((reg[0] & 0x02U) == 0U))
+      {
+        reg[0] |= 0x02U;
+        status = OSPI_NOR_WriteReg(hnor, OSPI_NOR_CMD_WRITE_SR2, reg, 1U);
+      }
+      break;
+
+    default :
+      /* No quad enable bit, or IO3 used as hold which needs no configuration */
+      break;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Send the command sequences of the octal DDR table.
+  * @param  hnor   : OSPI NOR handle
+  * @param  pSeq   : octal DDR table, two DWORDs per sequence
+  * @param  Length : number of DWORDs of the table
+  * @note   Each sequence is one command sent in 1S-1S-1S: a length byte in bits 31:24 of
+  *         its first DWORD followed by up to 7 command bytes, most significant byte first.
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef OSPI_NOR_EnterOctalDdr(OSPI_NOR_HandleTypeDef *hnor, const uint32_t *pSeq, uint32_t Length)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+  OSPI_RegularCmdTypeDef cmd;
+  uint8_t bytes[7];
+  uint32_t size;
+  uint32_t index;
+  uint32_t byte;
+
+  for (index = 0U; ((index + 1U) < Length) && (status == HAL_OK); index += 2U)
+  {
+    size = pSeq[index] >> 24U;
+
+    if (size > 7U)
+    {
+      hnor->ErrorCode = HAL_OSPI_NOR_ERROR_SFDP;
+      status = HAL_ERROR;
+    }
+    else if (size != 0U)
+    {
+      for (byte = 0U; byte < 7U; byte++)
+      {
+        bytes[byte] = (uint8_t)(pSeq[index + ((byte + 1U) / 4U)] >> (8U * (3U - ((byte + 1U) % 4U))));
+      }
+
+      /* The bytes after the instruction go out as data on the single line */
+      OSPI_NOR_BuildCmd(hnor, &cmd, HAL_OSPI_NOR_MODE_1S1S1S, bytes[0], 0U, 0U, size - 1U, 0U);
+      status = HAL_OSPI_Command(hnor->hospi, &cmd, HAL_OSPI_TIMEOUT_DEFAULT_VALUE);
+
+      if ((status == HAL_OK) && (size > 1U))
+      {
+        status = HAL_OSPI_Transmit(hnor->hospi, &bytes[1], HAL_OSPI_TIMEOUT_DEFAULT_VALUE);
+      }
+    }
+    else
+    {
+      /* Unused sequence */
+    }
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Select the fast read of a basic flash parameter table field.
+  * @param  hnor  : OSPI NOR handle
+  * @param  Field : 16-bit field, wait states in bits 4:0, mode clocks in bits 7:5 and
+  *                 instruction in bits 15:8
+  * @note   Used for the 1-4-4 and 4-4-4 fast reads, where 2 mode clocks carry one byte.
+  * @retval None
+  */
+static void OSPI_NOR_SetFastRead(OSPI_NOR_HandleTypeDef *hnor, uint32_t Field)
+{
+  uint32_t mode_clocks = (Field >> 5U) & 0x7U;
+
+  hnor->ReadInstruction = (Field >> 8U) & 0xFFU;
+  hnor->ReadDummyCycles = Field & 0x1FU;
+
+  if (mode_clocks == 2U)
+  {
+    hnor->ReadModeBytes = 1U;
+  }
+  else
+  {
+    hnor->ReadModeBytes = 0U;
+    hnor->ReadDummyCycles += mode_clocks;
+  }
+}
+
+/**
+  * @brief  Return the 4-byte address version of an instruction.
+  * @param  Instruction : 3-byte address instruction
+  * @retval 4-byte address instruction of the JEDEC 4-byte instruction set
+  */
+static uint32_t OSPI_NOR_Instruction4B(uint32_t Instruction)
+{
+  uint32_t instruction;
+
+  switch (Instruction)
+  {
+    case 0x02U : instruction = 0x12U; break;
+    case 0x0BU : instruction = 0x0CU; break;
+    case 0xEBU : instruction = 0xECU; break;
+    case 0x20U : instruction = 0x21U; break;
+    case 0x52U : instruction = 0x5CU; break;
+    case 0xD8U : instruction = 0xDCU; break;
+    default    : instruction = Instruction; break;
+  }
+
+  return instruction;
+}
+
+/**
+  * @brief  Fill the register image of a command in the command protocol.
+  * @param  hnor         : OSPI NOR handle
+  * @param  pReg         : register image to fill
+  * @param  Instruction  : 8-bit instruction
+  * @param  AddressBytes : number of address bytes, 0 for no address phase
+  * @param  NbData       : 0 for no data phase
+  * @param  DummyCycles  : number of dummy cycles
+  * @retval None
+  */
+static void OSPI_NOR_PrepareRegCmd(const OSPI_NOR_HandleTypeDef *hnor, OSPI_NOR_RegCmdTypeDef *pReg,
+                                   uint32_t Instruction, uint32_t AddressBytes, uint32_t NbData,
+                                   uint32_t DummyCycles)
+{
+  OSPI_RegularCmdTypeDef cmd;
+
+  OSPI_NOR_BuildCmd(hnor, &cmd, OSPI_NOR_CMD_PROTOCOL(hnor), Instruction, AddressBytes, 0U, NbData, DummyCycles);
+
+  /* Same register fields as the OSPI driver writes for this command */
+  pReg->CCR = cmd.SIOOMode | cmd.InstructionMode | cmd.InstructionDtrMode | cmd.InstructionSize;
+  if (cmd.AddressMode != HAL_OSPI_ADDRESS_NONE)
+  {
+    pReg->CCR |= (cmd.AddressMode | cmd.AddressDtrMode | cmd.AddressSize);
+  }
+  if (cmd.DataMode != HAL_OSPI_DATA_NONE)
+  {
+    pReg->CCR |= (cmd.DataMode | cmd.DataDtrMode);
+    if (hnor->Mode == HAL_OSPI_NOR_MODE_8D8D8D)
+    {
+      pReg->CCR |= HAL_OSPI_DQS_ENABLE;
+    }
+  }
+  else if (cmd.InstructionDtrMode == HAL_OSPI_INSTRUCTION_DTR_ENABLE)
+  {
+    /* The DHQC bit is linked with DDTR bit which should be activated */
+    pReg->CCR |= HAL_OSPI_DATA_DTR_ENABLE;
+  }
+  else
+  {
+    /* Nothing to add */
+  }
+
+  pReg->DCYC = DummyCycles << OCTOSPI_TCR_DCYC_Pos;
+  pReg->IR   = cmd.Instruction;
+}
+
+/**
+  * @brief  Abort the current OctoSPI operation from RAM.
+  * @param  Instance : OctoSPI instance
+  * @retval None
+  */
+static __RAM_FUNC void OSPI_NOR_RamAbort(OCTOSPI_TypeDef *Instance)
+{
+  if ((Instance->SR & OCTOSPI_SR_BUSY) != 0U)
+  {
+    SET_BIT(Instance->CR, OCTOSPI_CR_ABORT);
+
+    OSPI_NOR_RamWaitTc(Instance);
+
+    while ((Instance->SR & OCTOSPI_SR_BUSY) != 0U)
+    {
+    }
+  }
+}
+
+/**
+  * @brief  Start an indirect command from RAM.
+  * @param  Instance : OctoSPI instance
+  * @param  pReg     : register image of the command
+  * @param  Fmode    : indirect write or read mode
+  * @param  Address  : address, unused without address phase
+  * @param  NbData   : number of data, 0 for no data phase
+  * @note   Without data phase, or in read mode, the command starts on the last register write.
+  * @retval None
+  */
+static __RAM_FUNC void OSPI_NOR_RamCommand(OCTOSPI_TypeDef *Instance, const OSPI_NOR_RegCmdTypeDef *pReg,
+                                           uint32_t Fmode, uint32_t Address, uint32_t NbData)
+{
+  MODIFY_REG(Instance->CR, OCTOSPI_CR_FMODE, Fmode);
+
+  if (NbData != 0U)
+  {
+    WRITE_REG(Instance->DLR, (NbData - 1U));
+  }
+
+  WRITE_REG(Instance->CCR, pReg->CCR);
+  MODIFY_REG(Instance->TCR, OCTOSPI_TCR_DCYC, pReg->DCYC);
+  WRITE_REG(Instance->IR, pReg->IR);
+
+  if ((pReg->CCR & OCTOSPI_CCR_ADMODE) != 0U)
+  {
+    WRITE_REG(Instance->AR, Address);
+  }
+}
+
+/**
+  * @brief  Wait for the end of the OctoSPI transfer from RAM.
+  * @param  Instance : OctoSPI instance
+  * @retval None
+  */
+static __RAM_FUNC void OSPI_NOR_RamWaitTc(OCTOSPI_TypeDef *Instance)
+{
+  while ((Instance->SR & OCTOSPI_SR_TCF) == 0U)
+  {
+  }
+
+  WRITE_REG(Instance->FCR, OCTOSPI_FCR_CTCF);
+}
+
+/**
+  * @brief  Read the status register of the memory from RAM.
+  * @param  hnor : OSPI NOR handle
+  * @retval Status register value
+  */
+static __RAM_FUNC uint32_t OSPI_NOR_RamReadStatus(OSPI_NOR_HandleTypeDef *hnor)
+{
+  OCTOSPI_TypeDef *instance = hnor->hospi->Instance;
+  uint32_t value;
+
+  /* Data are read by pairs of bytes in DTR, the first one is the status */
+  if (hnor->Mode == HAL_OSPI_NOR_MODE_8D8D8D)
+  {
+    OSPI_NOR_RamCommand(instance, &hnor->RegReadStatus, OSPI_NOR_FMODE_INDIRECT_READ, 0U, 2U);
+    OSPI_NOR_RamWaitTc(instance);
+    value = *((__IO uint8_t *)&instance->DR);
+    (void)(*((__IO uint8_t *)&instance->DR));
+  }
+  else
+  {
+    OSPI_NOR_RamCommand(instance, &hnor->RegReadStatus, OSPI_NOR_FMODE_INDIRECT_READ, 0U, 1U);
+    OSPI_NOR_RamWaitTc(instance);
+    value = *((__IO uint8_t *)&instance->DR);
+  }
+
+  return value;
+}
+
+/**
+  * @brief  Start the next chunk of the operation at the head of the queue from RAM.
+  * @param  hnor : OSPI NOR handle
+  * @note   A program chunk ends at a page boundary, an erase chunk is one block.
+  * @retval None
+  */
+static __RAM_FUNC void OSPI_NOR_RamStartChunk(OSPI_NOR_HandleTypeDef *hnor)
+{
+  OCTOSPI_TypeDef *instance = hnor->hospi->Instance;
+  OSPI_NOR_OperationTypeDef *op = &hnor->Queue[hnor->QueueHead];
+  uint32_t chunk;
+  uint32_t index;
+
+  OSPI_NOR_RamCommand(instance, &hnor->RegWriteEnable, OSPI_NOR_FMODE_INDIRECT_WRITE, 0U, 0U);
+  OSPI_NOR_RamWaitTc(instance);
+
+  if (op->Type == HAL_OSPI_NOR_OPERATION_PROGRAM)
+  {
+    chunk = hnor->PageSize - (op->Address & (hnor->PageSize - 1U));
+    if (chunk > op->Size)
+    {
+      chunk = op->Size;
+    }
+
+    OSPI_NOR_RamCommand(instance, &hnor->RegProgram, OSPI_NOR_FMODE_INDIRECT_WRITE, op->Address, chunk);
+    for (index = 0U; index < chunk; index++)
+    {
+      while ((instance->SR & OCTOSPI_SR_FTF) == 0U)
+      {
+      }
+      *((__IO uint8_t *)&instance->DR) = op->pData[index];
+    }
+    OSPI_NOR_RamWaitTc(instance);
+  }
+  else
+  {
+    chunk = hnor->Erase[op->EraseIndex].Size;
+
+    OSPI_NOR_RamCommand(instance, &hnor->RegErase[op->EraseIndex], OSPI_NOR_FMODE_INDIRECT_WRITE, op->Address, 0U);
+    OSPI_NOR_RamWaitTc(instance);
+  }
+
+  hnor->ChunkSize  = chunk;
+  hnor->QueueState = OSPI_NOR_QUEUE_BUSY;
+}
+
+/**
+  * @brief  Account the end of the running chunk from RAM.
+  * @param  hnor : OSPI NOR handle
+  * @retval None
+  */
+static __RAM_FUNC void OSPI_NOR_RamEndChunk(OSPI_NOR_HandleTypeDef *hnor)
+{
+  OSPI_NOR_OperationTypeDef *op = &hnor->Queue[hnor->QueueHead];
+
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  uint32_t address = ((hnor->hospi->Instance == OCTOSPI1) ? OCTOSPI1_BASE : OCTOSPI2_BASE) + op->Address;
+
+  /* Drop the cached copy of the modified range */
+  if ((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+  {
+    SCB_InvalidateDCache_by_Addr((void *)(address & ~31U), (int32_t)(hnor->ChunkSize + 32U));
+  }
+#endif /* __DCACHE_PRESENT */
+
+  op->Address += hnor->ChunkSize;
+  op->Size    -= hnor->ChunkSize;
+  if (op->Type == HAL_OSPI_NOR_OPERATION_PROGRAM)
+  {
+    op->pData += hnor->ChunkSize;
+  }
+
+  if (op->Size == 0U)
+  {
+    hnor->QueueHead = (hnor->QueueHead + 1U) % HAL_OSPI_NOR_QUEUE_DEPTH;
+    hnor->QueueCount--;
+  }
+
+  hnor->QueueState = OSPI_NOR_QUEUE_IDLE;
+}
+/**
+  @endcond
+  */
+
+#endif /* HAL_OSPI_MODULE_ENABLED && HAL_OSPI_NOR_MODULE_ENABLED */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#endif /* OCTOSPI || OCTOSPI1 || OCTOSPI2 */
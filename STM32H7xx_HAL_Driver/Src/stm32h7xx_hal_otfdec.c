@@ -8,6 +8,7 @@
   *           + Initialization and de-initialization functions
   *           + Region setting/enable functions
   *           + Peripheral State functions
+  *           + Region manager functions
   *
   ******************************************************************************
   * @attention
@@ -53,6 +54,30 @@
         is enabled. The region can be deciphered on the fly after having made sure
         the OctoSPI is configured in memory-mapped mode.
 
+    [..]
+    *** Region manager ***
+    ======================
+    [..]
+    (#) Describe each encrypted area of the external memory (code image, assets)
+        in an OTFDEC_RegionLayoutTypeDef array: start address and size (4-Kbyte
+        granularity), access pattern, key, nonce, version and lock.
+
+    (#) Call HAL_OTFDEC_RegionLayoutConfig() to check the whole layout (alignment,
+        no overlap, at most four areas) and program one region per area, in
+        array order, with the deciphering mode derived from its access pattern:
+        (++) OTFDEC_ACCESS_INSTRUCTION: instruction-only mode, data reads return
+             the ciphered image, which prevents reading the code out.
+        (++) OTFDEC_ACCESS_DATA: data-only mode, for assets never executed.
+        (++) OTFDEC_ACCESS_INSTRUCTION_DATA: all accesses deciphered, needed for
+             code that reads its own literal pools or constant tables.
+
+    (#) Before locking the layout, call HAL_OTFDEC_RegionBenchmark() on a region
+        to measure, with the CPU cycle counter, the latency of a first read and
+        the cycles needed to read a block, with and without deciphering. The
+        difference is the on-the-fly deciphering cost; instruction fetches go
+        through the same AES pipeline, so it is also the fetch cost of the
+        instruction-only modes.
+
     [..]
     (@) Warning: the OTFDEC deciphering is based on a different endianness compared
         to the AES-CTR as implemented in the AES peripheral. E.g., if the OTFEC
@@ -146,6 +171,7 @@
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
+static void OTFDEC_BenchmarkRead(uint32_t Address, uint32_t Size, uint32_t *pLatency, uint32_t *pCycles);
 /* Private functions ---------------------------------------------------------*/
 
 /* Exported functions --------------------------------------------------------*/
@@ -989,6 +1015,316 @@ HAL_StatusTypeDef HAL_OTFDEC_RegionGetConfig(OTFDEC_HandleTypeDef *hotfdec, uint
   * @}
   */
 
+/** @defgroup OTFDEC_Exported_Functions_Group5 Region manager functions
+  *  @brief   Region layout and read benchmark functions.
+  *
+@verbatim
+  ==============================================================================
+                      ##### Region manager functions #####
+  ==============================================================================
+    [..]
+    This subsection permits to program a complete layout of encrypted areas
+    and to measure the deciphering cost of a region.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Program a layout of encrypted areas, one OTFDEC region per area.
+  * @param  hotfdec pointer to an OTFDEC_HandleTypeDef structure that contains
+  *         the configuration information for OTFDEC module
+  * @param  pLayout pointer to an array of area descriptions, the area n is
+  *         programmed in the region OTFDEC_REGION1 + n
+  * @param  NbRegions number of areas of the array, from 1 to @ref OTFDEC_REGION_NUMBER
+  * @note   The whole layout is checked before any region is programmed: the areas
+  *         must be aligned on @ref OTFDEC_REGION_GRANULARITY, must not overlap and
+  *         their regions must not be locked. Regions beyond NbRegions are left
+  *         unchanged.
+  * @note   Each region is disabled while it is reprogrammed: no code must be executed
+  *         from the external memory during this call.
+  * @retval HAL state
+  */
+HAL_StatusTypeDef HAL_OTFDEC_RegionLayoutConfig(OTFDEC_HandleTypeDef *hotfdec, const OTFDEC_RegionLayoutTypeDef *pLayout,
+                                                uint32_t NbRegions)
+{
+  OTFDEC_Region_TypeDef *region;
+  OTFDEC_RegionConfigTypeDef config;
+  uint32_t address;
+  uint32_t end;
+  uint32_t i;
+  uint32_t j;
+
+  /* Check the parameters */
+  assert_param(IS_OTFDEC_ALL_INSTANCE(hotfdec->Instance));
+
+  if ((pLayout == NULL) || (NbRegions == 0U) || (NbRegions > OTFDEC_REGION_NUMBER))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the whole layout before programming any region */
+  for (i = 0U; i < NbRegions; i++)
+  {
+    assert_param(IS_OTFDEC_ACCESS_PATTERN(pLayout[i].AccessPattern));
+    assert_param(IS_OTFDEC_REGION_CONFIG_LOCK(pLayout[i].Lock));
+
+    if ((pLayout[i].pKey == NULL) || (pLayout[i].Size == 0U) ||
+        (((pLayout[i].StartAddress | pLayout[i].Size) & (OTFDEC_REGION_GRANULARITY - 1U)) != 0U) ||
+        ((pLayout[i].Size - 1U) > (0xFFFFFFFFU - pLayout[i].StartAddress)))
+    {
+      return HAL_ERROR;
+    }
+
+    end = pLayout[i].StartAddress + (pLayout[i].Size - 1U);
+    for (j = 0U; j < i; j++)
+    {
+      if ((pLayout[i].StartAddress <= (pLayout[j].StartAddress + (pLayout[j].Size - 1U))) &&
+          (pLayout[j].StartAddress <= end))
+      {
+        /* Overlapping areas */
+        return HAL_ERROR;
+      }
+    }
+
+    address = (uint32_t)(hotfdec->Instance) + 0x20U + (0x30U * i);
+    region = (OTFDEC_Region_TypeDef *)address;
+
+    if (READ_BIT(region->REG_CONFIGR, OTFDEC_REG_CONFIGR_LOCK_ENABLE) == OTFDEC_REG_CONFIGR_LOCK_ENABLE)
+    {
+      /* Configuration is locked, the region can't be reprogrammed */
+      return HAL_ERROR;
+    }
+  }
+
+  for (i = 0U; i < NbRegions; i++)
+  {
+    config.Nonce[0]     = pLayout[i].Nonce[0];
+    config.Nonce[1]     = pLayout[i].Nonce[1];
+    config.StartAddress = pLayout[i].StartAddress;
+    config.EndAddress   = pLayout[i].StartAddress + (pLayout[i].Size - 1U);
+    config.Version      = pLayout[i].Version;
+
+    /* Disable the region, set its mode and key, then configure and enable it */
+    if (HAL_OTFDEC_RegionDisable(hotfdec, i) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+
+    if (HAL_OTFDEC_RegionSetMode(hotfdec, i, HAL_OTFDEC_AccessPatternToMode(pLayout[i].AccessPattern)) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+
+    if (HAL_OTFDEC_RegionSetKey(hotfdec, i, pLayout[i].pKey) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+
+    if (HAL_OTFDEC_RegionConfig(hotfdec, i, &config, pLayout[i].Lock) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  /* Status is okay */
+  return HAL_OK;
+}
+
+/**
+  * @brief  Return the region deciphering mode matching an access pattern.
+  * @param  AccessPattern access pattern of the area.
+  *         This parameter can be a value of @ref OTFDEC_Access_Pattern
+  * @retval Region mode, a value of @ref OTFDEC_Region_Operating_Mode
+  */
+uint32_t HAL_OTFDEC_AccessPatternToMode(uint32_t AccessPattern)
+{
+  uint32_t mode;
+
+  /* Check the parameters */
+  assert_param(IS_OTFDEC_ACCESS_PATTERN(AccessPattern));
+
+  switch (AccessPattern)
+  {
+    case OTFDEC_ACCESS_DATA:
+      mode = OTFDEC_REG_MODE_DATA_ACCESSES_ONLY;
+      break;
+    case OTFDEC_ACCESS_INSTRUCTION_DATA:
+      mode = OTFDEC_REG_MODE_INSTRUCTION_OR_DATA_ACCESSES;
+      break;
+    case OTFDEC_ACCESS_INSTRUCTION_CIPHER:
+      mode = OTFDEC_REG_MODE_INSTRUCTION_ACCESSES_ONLY_WITH_CIPHER;
+      break;
+    default:
+      mode = OTFDEC_REG_MODE_INSTRUCTION_ACCESSES_ONLY;
+      break;
+  }
+
+  return mode;
+}
+
+/**
+  * @brief  Measure the read cost of a region with and without on-the-fly deciphering.
+  * @param  hotfdec pointer to an OTFDEC_HandleTypeDef structure that contains
+  *         the configuration information for OTFDEC module
+  * @param  RegionIndex index of the configured region that is measured
+  * @param  Size number of bytes read from the region start address by each pass,
+  *         multiple of 4 and not larger than the region
+  * @param  pResult pointer to the structure filled with the measured cycles
+  * @note   The first pass reads the region with deciphering disabled, the second one
+  *         with all read accesses deciphered. The region mode and enable state are
+  *         restored at the end.
+  * @note   The region must be configured but not locked, no code must be executed from
+  *         the external memory during this call and the OCTOSPI must be in memory-mapped
+  *         mode. Interrupts are masked during each pass.
+  * @note   The data cache is invalidated on the region before each read, so that the
+  *         figures are those of cache misses.
+  * @retval HAL state
+  */
+HAL_StatusTypeDef HAL_OTFDEC_RegionBenchmark(OTFDEC_HandleTypeDef *hotfdec, uint32_t RegionIndex, uint32_t Size,
+                                             OTFDEC_BenchmarkTypeDef *pResult)
+{
+  OTFDEC_Region_TypeDef *region;
+  uint32_t address;
+  uint32_t configr;
+  uint32_t start;
+  uint32_t end;
+  uint32_t primask;
+
+  /* Check the parameters */
+  assert_param(IS_OTFDEC_ALL_INSTANCE(hotfdec->Instance));
+  assert_param(IS_OTFDEC_REGIONINDEX(RegionIndex));
+
+  if (pResult == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Take Lock */
+  __HAL_LOCK(hotfdec);
+
+  address = (uint32_t)(hotfdec->Instance) + 0x20U + (0x30U * RegionIndex);
+  region = (OTFDEC_Region_TypeDef *)address;
+
+  configr = READ_REG(region->REG_CONFIGR);
+  start = READ_REG(region->REG_START_ADDR) & ~(OTFDEC_REGION_GRANULARITY - 1U);
+  end = READ_REG(region->REG_END_ADDR) | (OTFDEC_REGION_GRANULARITY - 1U);
+
+  if (((configr & OTFDEC_REG_CONFIGR_LOCK_ENABLE) == OTFDEC_REG_CONFIGR_LOCK_ENABLE) ||
+      (Size == 0U) || ((Size & 3U) != 0U) || (end < start) || ((Size - 1U) > (end - start)))
+  {
+    /* Locked configuration, REG_EN and MODE bits can't be modified, or invalid size */
+    __HAL_UNLOCK(hotfdec);
+
+    return HAL_ERROR;
+  }
+
+  /* Enable the DWT cycle counter if not already done by a debugger */
+  if ((DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk) == 0U)
+  {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0U;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+  }
+
+  pResult->Size = Size;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  /* Deciphering disabled: the ciphered content is read */
+  CLEAR_BIT(region->REG_CONFIGR, OTFDEC_REG_CONFIGR_REG_ENABLE);
+  __DSB();
+  OTFDEC_BenchmarkRead(start, Size, &pResult->PlainLatency, &pResult->PlainCycles);
+
+  /* All read accesses deciphered */
+  MODIFY_REG(region->REG_CONFIGR, OTFDEC_REG_CONFIGR_MODE, OTFDEC_REG_MODE_INSTRUCTION_OR_DATA_ACCESSES);
+  SET_BIT(region->REG_CONFIGR, OTFDEC_REG_CONFIGR_REG_ENABLE);
+  __DSB();
+  OTFDEC_BenchmarkRead(start, Size, &pResult->DecryptedLatency, &pResult->DecryptedCycles);
+
+  /* Restore the region mode, then its enable state */
+  CLEAR_BIT(region->REG_CONFIGR, OTFDEC_REG_CONFIGR_REG_ENABLE);
+  MODIFY_REG(region->REG_CONFIGR, OTFDEC_REG_CONFIGR_MODE, configr & OTFDEC_REG_CONFIGR_MODE);
+  SET_BIT(region->REG_CONFIGR, configr & OTFDEC_REG_CONFIGR_REG_ENABLE);
+  __DSB();
+
+#if (__DCACHE_PRESENT == 1U)
+  /* Drop the lines filled by the last pass */
+  if ((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+  {
+    SCB_InvalidateDCache_by_Addr((uint32_t *)start, (int32_t)Size);
+  }
+#endif /* __DCACHE_PRESENT */
+
+  __set_PRIMASK(primask);
+
+  /* Release Lock */
+  __HAL_UNLOCK(hotfdec);
+
+  /* Status is okay */
+  return HAL_OK;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/** @addtogroup OTFDEC_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Time a first 32-bit read, then the read of a block, from a memory-mapped address.
+  * @param  Address start address of the block, aligned on a cache line
+  * @param  Size number of bytes of the block, multiple of 4
+  * @param  pLatency pointer to the cycles of the first read
+  * @param  pCycles pointer to the cycles of the block read
+  * @retval None
+  */
+static void OTFDEC_BenchmarkRead(uint32_t Address, uint32_t Size, uint32_t *pLatency, uint32_t *pCycles)
+{
+  __IO const uint32_t *data = (__IO const uint32_t *)Address;
+  uint32_t count;
+  uint32_t tickstart;
+  uint32_t value;
+
+#if (__DCACHE_PRESENT == 1U)
+  if ((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+  {
+    SCB_InvalidateDCache_by_Addr((uint32_t *)Address, (int32_t)Size);
+  }
+#endif /* __DCACHE_PRESENT */
+
+  __DSB();
+  tickstart = DWT->CYCCNT;
+  value = data[0];
+  __DSB();
+  *pLatency = DWT->CYCCNT - tickstart;
+
+#if (__DCACHE_PRESENT == 1U)
+  if ((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+  {
+    SCB_InvalidateDCache_by_Addr((uint32_t *)Address, (int32_t)Size);
+  }
+#endif /* __DCACHE_PRESENT */
+
+  __DSB();
+  tickstart = DWT->CYCCNT;
+  for (count = 0U; count < (Size / 4U); count++)
+  {
+    value = data[count];
+  }
+  __DSB();
+  *pCycles = DWT->CYCCNT - tickstart;
+
+  UNUSED(value);
+}
+
 /**
   * @}
   */
@@ -50,6 +50,17 @@
      (#)Enable PCD transmission and reception:
          (##) HAL_PCD_Start();
 
+     (#) Internal DMA mode (OTG_HS only), selected with Init.dma_enable = 1:
+         (##) The core transfers the data directly from and to the buffers given to
+              HAL_PCD_EP_Transmit() and HAL_PCD_EP_Receive(), without FIFO copy by the CPU
+         (##) The PCD handle and the buffers must be located in a memory reachable by the
+              OTG_HS DMA (not in DTCM), the buffers must be 32-bit aligned
+         (##) When the D-Cache is enabled, the transmit buffers are cleaned by
+              HAL_PCD_EP_Transmit() and the receive buffers are invalidated by the driver
+              before HAL_PCD_DataOutStageCallback(). The receive buffers must then be
+              32-byte aligned and their size a multiple of 32 bytes, so that no other
+              data shares their cache lines
+
   @endverbatim
   ******************************************************************************
   */
@@ -170,6 +181,7 @@ HAL_StatusTypeDef HAL_PCD_Init(PCD_HandleTypeDef *hpcd)
   }
 
   hpcd->State = HAL_PCD_STATE_BUSY;
+  hpcd->pISOStream = NULL;
 
   /* Disable DMA mode for FS instance */
   if ((USBx->CID & (0x1U << 8)) == 0U)
@@ -1051,7 +1063,7 @@ HAL_StatusTypeDef HAL_PCD_Stop(PCD_HandleTypeDef *hpcd)
   * @param  hpcd PCD handle
   * @retval HAL status
   */
-void HAL_PCD_IRQHandler(PCD_HandleTypeDef *hpcd)
+__HOT_RAM_FUNC void HAL_PCD_IRQHandler(PCD_HandleTypeDef *hpcd)
 {
   USB_OTG_GlobalTypeDef *USBx = hpcd->Instance;
   uint32_t USBx_BASE = (uint32_t)USBx;
@@ -1131,6 +1143,11 @@ void HAL_PCD_IRQHandler(PCD_HandleTypeDef *hpcd)
           {
             CLEAR_OUT_EP_INTR(epnum, USB_OTG_DOEPINT_XFRC);
             (void)PCD_EP_OutXfrComplete_int(hpcd, epnum);
+
+            if ((hpcd->pISOStream != NULL) && (hpcd->OUT_ep[epnum].type == EP_TYPE_ISOC))
+            {
+              HAL_PCDEx_ISOStream_XferCplt(hpcd, (uint8_t)epnum);
+            }
           }
 
           if ((epint & USB_OTG_DOEPINT_STUP) == USB_OTG_DOEPINT_STUP)
@@ -1218,6 +1235,11 @@ void HAL_PCD_IRQHandler(PCD_HandleTypeDef *hpcd)
               }
             }
 
+            if ((hpcd->pISOStream != NULL) && (hpcd->IN_ep[epnum].type == EP_TYPE_ISOC))
+            {
+              HAL_PCDEx_ISOStream_XferCplt(hpcd, (uint8_t)(epnum | 0x80U));
+            }
+
 #if (USE_HAL_PCD_REGISTER_CALLBACKS == 1U)
             hpcd->DataInStageCallback(hpcd, (uint8_t)epnum);
 #else
@@ -1405,6 +1427,11 @@ void HAL_PCD_IRQHandler(PCD_HandleTypeDef *hpcd)
     /* Handle SOF Interrupt */
     if (__HAL_PCD_GET_FLAG(hpcd, USB_OTG_GINTSTS_SOF))
     {
+      if (hpcd->pISOStream != NULL)
+      {
+        HAL_PCDEx_ISOStream_SOF(hpcd);
+      }
+
 #if (USE_HAL_PCD_REGISTER_CALLBACKS == 1U)
       hpcd->SOFCallback(hpcd);
 #else
@@ -1851,6 +1878,29 @@ HAL_StatusTypeDef HAL_PCD_EP_Receive(PCD_HandleTypeDef *hpcd, uint8_t ep_addr, u
 
   ep = &hpcd->OUT_ep[ep_addr & EP_ADDR_MSK];
 
+  if (hpcd->Init.dma_enable == 1U)
+  {
+    /* The DMA requires a word aligned buffer */
+    if (((uint32_t)pBuf & 3U) != 0U)
+    {
+      return HAL_ERROR;
+    }
+
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    if ((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+    {
+      /* The buffer is invalidated at the end of the transfer: it must own its cache lines */
+      if (((uint32_t)pBuf & 31U) != 0U)
+      {
+        return HAL_ERROR;
+      }
+
+      /* Write back and drop the buffer lines so that no eviction overwrites the received data */
+      SCB_CleanInvalidateDCache_by_Addr((uint32_t *)(void *)pBuf, (int32_t)len);
+    }
+#endif /* __DCACHE_PRESENT */
+  }
+
   /*setup and start the Xfer */
   ep->xfer_buff = pBuf;
   ep->xfer_len = len;
@@ -1892,6 +1942,23 @@ HAL_StatusTypeDef HAL_PCD_EP_Transmit(PCD_HandleTypeDef *hpcd, uint8_t ep_addr,
 
   ep = &hpcd->IN_ep[ep_addr & EP_ADDR_MSK];
 
+  if (hpcd->Init.dma_enable == 1U)
+  {
+    /* The DMA requires a word aligned buffer */
+    if (((uint32_t)pBuf & 3U) != 0U)
+    {
+      return HAL_ERROR;
+    }
+
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    if ((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+    {
+      /* Write back the buffer so that the DMA reads the CPU view of it */
+      SCB_CleanDCache_by_Addr((uint32_t *)((uint32_t)pBuf & ~31U), (int32_t)(len + ((uint32_t)pBuf & 31U)));
+    }
+#endif /* __DCACHE_PRESENT */
+  }
+
   /*setup and start the Xfer */
   ep->xfer_buff = pBuf;
   ep->xfer_len = len;
@@ -2135,7 +2202,7 @@ HAL_StatusTypeDef HAL_PCD_SetTestMode(PCD_HandleTypeDef *hpcd, uint8_t testmode)
   * @param  epnum endpoint number
   * @retval HAL status
   */
-static HAL_StatusTypeDef PCD_WriteEmptyTxFifo(PCD_HandleTypeDef *hpcd, uint32_t epnum)
+static __HOT_RAM_FUNC HAL_StatusTypeDef PCD_WriteEmptyTxFifo(PCD_HandleTypeDef *hpcd, uint32_t epnum)
 {
   USB_OTG_GlobalTypeDef *USBx = hpcd->Instance;
   uint32_t USBx_BASE = (uint32_t)USBx;
@@ -2233,6 +2300,14 @@ static HAL_StatusTypeDef PCD_EP_OutXfrComplete_int(PCD_HandleTypeDef *hpcd, uint
         /* out data packet received over EP */
         ep->xfer_count = ep->xfer_size - (USBx_OUTEP(epnum)->DOEPTSIZ & USB_OTG_DOEPTSIZ_XFRSIZ);
 
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+        if (((SCB->CCR & SCB_CCR_DC_Msk) != 0U) && (ep->xfer_count != 0U))
+        {
+          /* Drop lines speculatively loaded while the DMA was writing */
+          SCB_InvalidateDCache_by_Addr((uint32_t *)ep->dma_addr, (int32_t)ep->xfer_count);
+        }
+#endif /* __DCACHE_PRESENT */
+
         if (epnum == 0U)
         {
           if (ep->xfer_len == 0U)
@@ -2320,6 +2395,14 @@ static HAL_StatusTypeDef PCD_EP_OutSetupPacket_int(PCD_HandleTypeDef *hpcd, uint
     CLEAR_OUT_EP_INTR(epnum, USB_OTG_DOEPINT_STPKTRX);
   }
 
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  if ((hpcd->Init.dma_enable == 1U) && ((SCB->CCR & SCB_CCR_DC_Msk) != 0U))
+  {
+    /* The DMA writes up to three setup packets in the first cache line of the buffer */
+    SCB_InvalidateDCache_by_Addr(hpcd->Setup, 32);
+  }
+#endif /* __DCACHE_PRESENT */
+
   /* Inform the upper layer that a setup packet is available */
 #if (USE_HAL_PCD_REGISTER_CALLBACKS == 1U)
   hpcd->SetupStageCallback(hpcd);
@@ -6,6 +6,7 @@
   *          This file provides firmware functions to manage the following
   *          functionalities of the USB Peripheral Controller:
   *           + Extended features functions
+  *           + Isochronous streaming functions
   *
   ******************************************************************************
   * @attention
@@ -40,6 +41,8 @@
 /* Private constants ---------------------------------------------------------*/
 /* Private macros ------------------------------------------------------------*/
 /* Private functions ---------------------------------------------------------*/
+static void PCDEx_ISOStream_Arm(PCD_HandleTypeDef *hpcd, PCD_ISOStreamTypeDef *pStream);
+
 /* Exported functions --------------------------------------------------------*/
 
 /** @defgroup PCDEx_Exported_Functions PCDEx Exported Functions
@@ -322,6 +325,411 @@ __weak void HAL_PCDEx_BCD_Callback(PCD_HandleTypeDef *hpcd, PCD_BCD_MsgTypeDef m
    */
 }
 
+/**
+  * @}
+  */
+
+/** @defgroup PCDEx_Exported_Functions_Group2 Isochronous streaming functions
+  * @brief    PCDEx isochronous streaming functions
+  *
+@verbatim
+ ===============================================================================
+                 ##### Isochronous streaming functions #####
+ ===============================================================================
+    [..]  This section provides functions allowing to:
+      (+) Stream packets over an isochronous endpoint from a ring of buffers
+      (+) Serve an explicit feedback endpoint computed from SOF timestamps
+
+    [..]  How to use the isochronous streaming
+      (#) Enable the SOF interrupt (Init.Sof_enable) and open the isochronous
+          endpoints with HAL_PCD_EP_Open().
+      (#) Fill a PCD_ISOStreamTypeDef structure and call
+          HAL_PCDEx_ISOStream_Start(), typically when the host selects the
+          streaming alternate setting. The driver then arms the endpoint
+          itself: the class driver must not call HAL_PCD_EP_Transmit() or
+          HAL_PCD_EP_Receive() on the stream endpoints.
+      (#) A transfer is re-armed from its completion interrupt, and after an
+          incomplete isochronous transfer or an empty ring on the next SOF,
+          so that the even/odd frame parity always targets the next frame.
+      (#) For an IN stream, queue packets with HAL_PCDEx_ISOStream_Write().
+          For an OUT stream, get the received packets with
+          HAL_PCDEx_ISOStream_Read().
+      (#) For an OUT stream with feedback, call
+          HAL_PCDEx_ISOStream_FeedbackUpdate() from HAL_PCD_SOFCallback()
+          with a running count of the audio sample clock, e.g. a timer
+          clocked by the I2S master clock. The feedback endpoint is armed on
+          each SOF with the last value.
+      (#) Call HAL_PCDEx_ISOStream_Stop() when the host selects the zero
+          bandwidth alternate setting.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Start an isochronous stream.
+  * @param  hpcd PCD handle
+  * @param  pStream isochronous stream
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_PCDEx_ISOStream_Start(PCD_HandleTypeDef *hpcd, PCD_ISOStreamTypeDef *pStream)
+{
+  PCD_ISOStreamTypeDef *pItem;
+
+  if ((pStream == NULL) || (pStream->pBuffer == NULL) || (hpcd->Init.Sof_enable == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  if ((pStream->NbPackets == 0U) || (pStream->NbPackets > PCD_ISOSTREAM_MAX_PACKETS) ||
+      (pStream->PacketSize == 0U) || (pStream->PacketSize > 0xFFFFU))
+  {
+    return HAL_ERROR;
+  }
+
+  if ((hpcd->Init.dma_enable == 1U) && ((((uint32_t)pStream->pBuffer | pStream->PacketSize) & 3U) != 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  if (((pStream->EpAddr & 0x80U) == 0x80U) ?
+      (hpcd->IN_ep[pStream->EpAddr & EP_ADDR_MSK].type != EP_TYPE_ISOC) :
+      (hpcd->OUT_ep[pStream->EpAddr & EP_ADDR_MSK].type != EP_TYPE_ISOC))
+  {
+    return HAL_ERROR;
+  }
+
+  if ((pStream->FeedbackEpAddr != 0U) &&
+      (((pStream->FeedbackEpAddr & 0x80U) == 0U) ||
+       (hpcd->IN_ep[pStream->FeedbackEpAddr & EP_ADDR_MSK].type != EP_TYPE_ISOC)))
+  {
+    return HAL_ERROR;
+  }
+
+  __HAL_LOCK(hpcd);
+
+  for (pItem = hpcd->pISOStream; pItem != NULL; pItem = pItem->pNext)
+  {
+    if (pItem == pStream)
+    {
+      __HAL_UNLOCK(hpcd);
+      return HAL_BUSY;
+    }
+  }
+
+  pStream->Head = 0U;
+  pStream->Tail = 0U;
+  pStream->Armed = 0U;
+  pStream->Underrun = 0U;
+  pStream->Dropped = 0U;
+  pStream->Feedback = 0U;
+  pStream->FrameCount = 0U;
+
+  /* Served from the next SOF on */
+  __HAL_PCD_DISABLE(hpcd);
+  pStream->pNext = hpcd->pISOStream;
+  hpcd->pISOStream = pStream;
+  __HAL_PCD_ENABLE(hpcd);
+
+  __HAL_UNLOCK(hpcd);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop an isochronous stream.
+  * @note   The ongoing transfers of the stream endpoints are aborted.
+  * @param  hpcd PCD handle
+  * @param  pStream isochronous stream
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_PCDEx_ISOStream_Stop(PCD_HandleTypeDef *hpcd, PCD_ISOStreamTypeDef *pStream)
+{
+  PCD_ISOStreamTypeDef **ppItem;
+  HAL_StatusTypeDef status = HAL_ERROR;
+
+  if (pStream == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  __HAL_LOCK(hpcd);
+  __HAL_PCD_DISABLE(hpcd);
+
+  for (ppItem = &hpcd->pISOStream; *ppItem != NULL; ppItem = &(*ppItem)->pNext)
+  {
+    if (*ppItem == pStream)
+    {
+      *ppItem = pStream->pNext;
+      pStream->pNext = NULL;
+      status = HAL_OK;
+      break;
+    }
+  }
+
+  __HAL_PCD_ENABLE(hpcd);
+  __HAL_UNLOCK(hpcd);
+
+  if (status == HAL_OK)
+  {
+    (void)HAL_PCD_EP_Abort(hpcd, pStream->EpAddr);
+
+    if (pStream->FeedbackEpAddr != 0U)
+    {
+      (void)HAL_PCD_EP_Abort(hpcd, pStream->FeedbackEpAddr);
+    }
+
+    pStream->Armed = 0U;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Queue a packet on an IN isochronous stream.
+  * @param  pStream isochronous stream
+  * @param  pData pointer to the packet data
+  * @param  len packet length, up to PacketSize
+  * @retval HAL status, HAL_BUSY when the ring is full
+  */
+HAL_StatusTypeDef HAL_PCDEx_ISOStream_Write(PCD_ISOStreamTypeDef *pStream, const uint8_t *pData, uint32_t len)
+{
+  uint32_t slot;
+  uint32_t i;
+
+  if ((pStream == NULL) || (len > pStream->PacketSize) || ((pData == NULL) && (len != 0U)))
+  {
+    return HAL_ERROR;
+  }
+
+  if ((pStream->Head - pStream->Tail) >= pStream->NbPackets)
+  {
+    return HAL_BUSY;
+  }
+
+  slot = pStream->Head % pStream->NbPackets;
+
+  for (i = 0U; i < len; i++)
+  {
+    pStream->pBuffer[(slot * pStream->PacketSize) + i] = pData[i];
+  }
+  pStream->Length[slot] = (uint16_t)len;
+
+  /* Publish the packet once its content is written */
+  __DMB();
+  pStream->Head = pStream->Head + 1U;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Get the oldest packet received on an OUT isochronous stream.
+  * @param  pStream isochronous stream
+  * @param  pData pointer to the destination buffer
+  * @param  len size of the destination buffer, the packet is truncated to it
+  * @retval Number of bytes copied, 0 when the ring is empty
+  */
+uint32_t HAL_PCDEx_ISOStream_Read(PCD_ISOStreamTypeDef *pStream, uint8_t *pData, uint32_t len)
+{
+  uint32_t slot;
+  uint32_t count;
+  uint32_t i;
+
+  if ((pStream == NULL) || (pData == NULL) || (pStream->Head == pStream->Tail))
+  {
+    return 0U;
+  }
+
+  slot = pStream->Tail % pStream->NbPackets;
+  count = ((uint32_t)pStream->Length[slot] < len) ? (uint32_t)pStream->Length[slot] : len;
+
+  for (i = 0U; i < count; i++)
+  {
+    pData[i] = pStream->pBuffer[(slot * pStream->PacketSize) + i];
+  }
+
+  /* Release the buffer once its content is read */
+  __DMB();
+  pStream->Tail = pStream->Tail + 1U;
+
+  return count;
+}
+
+/**
+  * @brief  Update the explicit feedback of an OUT isochronous stream.
+  * @note   To be called on every SOF, from HAL_PCD_SOFCallback(), with a
+  *         free running count of the sample clock. The feedback is the
+  *         number of samples per (micro)frame averaged over
+  *         2^FeedbackShift (micro)frames.
+  * @param  hpcd PCD handle
+  * @param  pStream isochronous stream
+  * @param  ClockCount sample clock count with ClockFracBits fractional bits
+  * @retval None
+  */
+void HAL_PCDEx_ISOStream_FeedbackUpdate(PCD_HandleTypeDef *hpcd, PCD_ISOStreamTypeDef *pStream,
+                                        uint32_t ClockCount)
+{
+  uint32_t fracbits = (hpcd->Init.speed == PCD_SPEED_HIGH) ? 16U : 14U;
+  uint64_t delta;
+
+  if (pStream->FrameCount == 0U)
+  {
+    /* First timestamp of the measurement */
+    pStream->ClockRef = ClockCount;
+  }
+  else if (pStream->FrameCount == (1UL << pStream->FeedbackShift))
+  {
+    delta = (uint64_t)(ClockCount - pStream->ClockRef);
+    pStream->Feedback = (uint32_t)((delta << fracbits) >> (pStream->FeedbackShift + pStream->ClockFracBits));
+    pStream->ClockRef = ClockCount;
+    pStream->FrameCount = 0U;
+  }
+  else
+  {
+    /* Measurement ongoing */
+  }
+
+  pStream->FrameCount++;
+}
+
+/**
+  * @brief  Serve the isochronous streams on SOF.
+  * @note   Called by HAL_PCD_IRQHandler(), it re-arms the idle data
+  *         endpoints and the feedback endpoints for the next frame.
+  * @param  hpcd PCD handle
+  * @retval None
+  */
+void HAL_PCDEx_ISOStream_SOF(PCD_HandleTypeDef *hpcd)
+{
+  USB_OTG_GlobalTypeDef *USBx = hpcd->Instance;
+  uint32_t USBx_BASE = (uint32_t)USBx;
+  PCD_ISOStreamTypeDef *pStream;
+  uint32_t epnum;
+  uint32_t enabled;
+
+  for (pStream = hpcd->pISOStream; pStream != NULL; pStream = pStream->pNext)
+  {
+    epnum = (uint32_t)pStream->EpAddr & EP_ADDR_MSK;
+
+    if ((pStream->EpAddr & 0x80U) == 0x80U)
+    {
+      enabled = USBx_INEP(epnum)->DIEPCTL & USB_OTG_DIEPCTL_EPENA;
+    }
+    else
+    {
+      enabled = USBx_OUTEP(epnum)->DOEPCTL & USB_OTG_DOEPCTL_EPENA;
+    }
+
+    if (enabled == 0U)
+    {
+      if (pStream->Armed != 0U)
+      {
+        /* Aborted on an incomplete isochronous transfer: the packet is lost */
+        if ((pStream->EpAddr & 0x80U) == 0x80U)
+        {
+          pStream->Tail = pStream->Tail + 1U;
+        }
+        pStream->Armed = 0U;
+        pStream->Dropped++;
+      }
+
+      PCDEx_ISOStream_Arm(hpcd, pStream);
+    }
+
+    if (pStream->FeedbackEpAddr != 0U)
+    {
+      epnum = (uint32_t)pStream->FeedbackEpAddr & EP_ADDR_MSK;
+
+      if ((USBx_INEP(epnum)->DIEPCTL & USB_OTG_DIEPCTL_EPENA) == 0U)
+      {
+        (void)HAL_PCD_EP_Transmit(hpcd, pStream->FeedbackEpAddr, (uint8_t *)&pStream->Feedback,
+                                  (hpcd->Init.speed == PCD_SPEED_HIGH) ? 4U : 3U);
+      }
+    }
+  }
+}
+
+/**
+  * @brief  Serve the isochronous streams on a transfer completion.
+  * @note   Called by HAL_PCD_IRQHandler() before the data stage callback.
+  * @param  hpcd PCD handle
+  * @param  ep_addr endpoint address
+  * @retval None
+  */
+void HAL_PCDEx_ISOStream_XferCplt(PCD_HandleTypeDef *hpcd, uint8_t ep_addr)
+{
+  PCD_ISOStreamTypeDef *pStream;
+
+  for (pStream = hpcd->pISOStream; pStream != NULL; pStream = pStream->pNext)
+  {
+    if ((pStream->EpAddr == ep_addr) && (pStream->Armed != 0U))
+    {
+      if ((ep_addr & 0x80U) == 0x80U)
+      {
+        pStream->Tail = pStream->Tail + 1U;
+      }
+      else
+      {
+        pStream->Length[pStream->Head % pStream->NbPackets] =
+          (uint16_t)hpcd->OUT_ep[ep_addr & EP_ADDR_MSK].xfer_count;
+        pStream->Head = pStream->Head + 1U;
+      }
+
+      pStream->Armed = 0U;
+
+      /* Still within the frame of the completed packet: arms the next frame */
+      PCDEx_ISOStream_Arm(hpcd, pStream);
+      break;
+    }
+  }
+}
+
+/**
+  * @}
+  */
+
+/** @defgroup PCDEx_Private_Functions PCDEx Private Functions
+  * @{
+  */
+
+/**
+  * @brief  Arm the next transfer of an isochronous stream.
+  * @param  hpcd PCD handle
+  * @param  pStream isochronous stream
+  * @retval None
+  */
+static void PCDEx_ISOStream_Arm(PCD_HandleTypeDef *hpcd, PCD_ISOStreamTypeDef *pStream)
+{
+  uint32_t slot;
+
+  if ((pStream->EpAddr & 0x80U) == 0x80U)
+  {
+    if (pStream->Head == pStream->Tail)
+    {
+      pStream->Underrun++;
+      return;
+    }
+
+    slot = pStream->Tail % pStream->NbPackets;
+    pStream->Armed = 1U;
+    (void)HAL_PCD_EP_Transmit(hpcd, pStream->EpAddr, &pStream->pBuffer[slot * pStream->PacketSize],
+                              pStream->Length[slot]);
+  }
+  else
+  {
+    if ((pStream->Head - pStream->Tail) >= pStream->NbPackets)
+    {
+      pStream->Underrun++;
+      return;
+    }
+
+    slot = pStream->Head % pStream->NbPackets;
+    pStream->Armed = 1U;
+    (void)HAL_PCD_EP_Receive(hpcd, pStream->EpAddr, &pStream->pBuffer[slot * pStream->PacketSize],
+                             pStream->PacketSize);
+  }
+}
+
 /**
   * @}
   */
@@ -79,6 +79,23 @@
       (+) End of abort process, @ref HAL_PSSI_AbortCpltCallback() is executed and user can
            add his own code by customization of function pointer @ref HAL_PSSI_AbortCpltCallback()
 
+    *** DMA streaming IO operation ***
+    ==================================
+    [..]
+      (+) Configure the DMA stream in circular mode.
+      (+) Stream data without gap from a circular buffer using @ref HAL_PSSI_TransmitCircular_DMA()
+          or into a circular buffer using @ref HAL_PSSI_ReceiveCircular_DMA(). The Size is the size
+          of the whole buffer, @ref HAL_PSSI_TxHalfCpltCallback() (or @ref HAL_PSSI_RxHalfCpltCallback())
+          is executed when the first half is done and @ref HAL_PSSI_TxCpltCallback() (or
+          @ref HAL_PSSI_RxCpltCallback()) when the second half is done.
+      (+) Stream data from or into two alternate buffers using @ref HAL_PSSI_TransmitDoubleBuffer_DMA()
+          or @ref HAL_PSSI_ReceiveDoubleBuffer_DMA(). The Size is the size of each buffer, the half
+          transfer callback is executed when the first buffer is done and the transfer complete
+          callback when the second buffer is done.
+      (+) Stop the streaming using @ref HAL_PSSI_StopStream_DMA().
+      (+) Get the number of bytes streamed using @ref HAL_PSSI_GetStreamBytes() and the average
+          throughput in bytes per second using @ref HAL_PSSI_GetStreamThroughput().
+
      *** PSSI HAL driver macros list ***
      ==================================
      [..]
@@ -99,6 +116,8 @@
      Function @ref HAL_PSSI_RegisterCallback() allows to register following callbacks:
        (+) TxCpltCallback       : callback for transmission end of transfer.
        (+) RxCpltCallback       : callback for reception end of transfer.
+       (+) TxHalfCpltCallback   : callback for transmission half transfer.
+       (+) RxHalfCpltCallback   : callback for reception half transfer.
        (+) ErrorCallback        : callback for error detection.
        (+) AbortCpltCallback    : callback for abort completion process.
        (+) MspInitCallback      : callback for Msp Init.
@@ -114,6 +133,8 @@
      This function allows to reset following callbacks:
        (+) TxCpltCallback       : callback for transmission end of transfer.
        (+) RxCpltCallback       : callback for reception end of transfer.
+       (+) TxHalfCpltCallback   : callback for transmission half transfer.
+       (+) RxHalfCpltCallback   : callback for reception half transfer.
        (+) ErrorCallback        : callback for error detection.
        (+) AbortCpltCallback    : callback for abort completion process.
        (+) MspInitCallback      : callback for Msp Init.
@@ -183,6 +204,10 @@ void PSSI_DMATransmitCplt(DMA_HandleTypeDef *hdma);
 void PSSI_DMAReceiveCplt(DMA_HandleTypeDef *hdma);
 void PSSI_DMAError(DMA_HandleTypeDef *hdma);
 void PSSI_DMAAbort(DMA_HandleTypeDef *hdma);
+static void PSSI_DMAStreamHalfCplt(DMA_HandleTypeDef *hdma);
+static void PSSI_DMAStreamCplt(DMA_HandleTypeDef *hdma);
+static HAL_StatusTypeDef PSSI_StartStream_DMA(PSSI_HandleTypeDef *hpssi, HAL_PSSI_StateTypeDef Direction,
+                                              uint32_t *pData0, uint32_t *pData1, uint32_t Size);
 
 
 /* Private functions to handle IT transfer */
@@ -267,6 +292,8 @@ HAL_StatusTypeDef HAL_PSSI_Init(PSSI_HandleTypeDef *hpssi)
     /* Init the PSSI Callback settings */
     hpssi->TxCpltCallback = HAL_PSSI_TxCpltCallback; /* Legacy weak TxCpltCallback */
     hpssi->RxCpltCallback = HAL_PSSI_RxCpltCallback; /* Legacy weak RxCpltCallback */
+    hpssi->TxHalfCpltCallback = HAL_PSSI_TxHalfCpltCallback; /* Legacy weak TxHalfCpltCallback */
+    hpssi->RxHalfCpltCallback = HAL_PSSI_RxHalfCpltCallback; /* Legacy weak RxHalfCpltCallback */
     hpssi->ErrorCallback        = HAL_PSSI_ErrorCallback;        /* Legacy weak ErrorCallback        */
     hpssi->AbortCpltCallback    = HAL_PSSI_AbortCpltCallback;    /* Legacy weak AbortCpltCallback    */
 
@@ -381,6 +408,8 @@ __weak void HAL_PSSI_MspDeInit(PSSI_HandleTypeDef *hpssi)
   *         This parameter can be one of the following values:
   *          @arg @ref HAL_PSSI_TX_COMPLETE_CB_ID  Tx Transfer completed callback ID
   *          @arg @ref HAL_PSSI_RX_COMPLETE_CB_ID  Rx Transfer completed callback ID
+  *          @arg @ref HAL_PSSI_TX_HALFCOMPLETE_CB_ID  Tx Half Transfer completed callback ID
+  *          @arg @ref HAL_PSSI_RX_HALFCOMPLETE_CB_ID  Rx Half Transfer completed callback ID
   *          @arg @ref HAL_PSSI_ERROR_CB_ID Error callback ID
   *          @arg @ref HAL_PSSI_ABORT_CB_ID Abort callback ID
   *          @arg @ref HAL_PSSI_MSPINIT_CB_ID MspInit callback ID
@@ -413,6 +442,14 @@ HAL_StatusTypeDef HAL_PSSI_RegisterCallback(PSSI_HandleTypeDef *hpssi, HAL_PSSI_
         hpssi->RxCpltCallback = pCallback;
         break;
 
+      case HAL_PSSI_TX_HALFCOMPLETE_CB_ID :
+        hpssi->TxHalfCpltCallback = pCallback;
+        break;
+
+      case HAL_PSSI_RX_HALFCOMPLETE_CB_ID :
+        hpssi->RxHalfCpltCallback = pCallback;
+        break;
+
       case HAL_PSSI_ERROR_CB_ID :
         hpssi->ErrorCallback = pCallback;
         break;
@@ -483,6 +520,8 @@ HAL_StatusTypeDef HAL_PSSI_RegisterCallback(PSSI_HandleTypeDef *hpssi, HAL_PSSI_
   *         This parameter can be one of the following values:
   *          @arg @ref HAL_PSSI_TX_COMPLETE_CB_ID  Tx Transfer completed callback ID
   *          @arg @ref HAL_PSSI_RX_COMPLETE_CB_ID  Rx Transfer completed callback ID
+  *          @arg @ref HAL_PSSI_TX_HALFCOMPLETE_CB_ID  Tx Half Transfer completed callback ID
+  *          @arg @ref HAL_PSSI_RX_HALFCOMPLETE_CB_ID  Rx Half Transfer completed callback ID
   *          @arg @ref HAL_PSSI_ERROR_CB_ID Error callback ID
   *          @arg @ref HAL_PSSI_ABORT_CB_ID Abort callback ID
   *          @arg @ref HAL_PSSI_MSPINIT_CB_ID MspInit callback ID
@@ -505,6 +544,14 @@ HAL_StatusTypeDef HAL_PSSI_UnRegisterCallback(PSSI_HandleTypeDef *hpssi, HAL_PSS
         hpssi->RxCpltCallback = HAL_PSSI_RxCpltCallback;   /* Legacy weak RxCpltCallback  */
         break;
 
+      case HAL_PSSI_TX_HALFCOMPLETE_CB_ID :
+        hpssi->TxHalfCpltCallback = HAL_PSSI_TxHalfCpltCallback; /* Legacy weak TxHalfCpltCallback */
+        break;
+
+      case HAL_PSSI_RX_HALFCOMPLETE_CB_ID :
+        hpssi->RxHalfCpltCallback = HAL_PSSI_RxHalfCpltCallback; /* Legacy weak RxHalfCpltCallback */
+        break;
+
       case HAL_PSSI_ERROR_CB_ID :
         hpssi->ErrorCallback = HAL_PSSI_ErrorCallback;               /* Legacy weak ErrorCallback        */
         break;
@@ -596,9 +643,26 @@ HAL_StatusTypeDef HAL_PSSI_UnRegisterCallback(PSSI_HandleTypeDef *hpssi, HAL_PSS
         (++) HAL_PSSI_Transmit_DMA()
         (++) HAL_PSSI_Receive_DMA()
 
+    (#) Continuous streaming functions with DMA are :
+        (++) HAL_PSSI_TransmitCircular_DMA()
+        (++) HAL_PSSI_ReceiveCircular_DMA()
+        (++) HAL_PSSI_TransmitDoubleBuffer_DMA()
+        (++) HAL_PSSI_ReceiveDoubleBuffer_DMA()
+        (++) HAL_PSSI_StopStream_DMA()
+       The DMA runs without gap until HAL_PSSI_StopStream_DMA() is called. The half
+       transfer callbacks are called when the first half of the circular buffer (or
+       the first buffer in double buffer mode) is done, and the transfer complete
+       callbacks when the second half (or the second buffer) is done, the other half
+       being transferred meanwhile. In double buffer mode, the address of the idle
+       buffer can be changed from the callbacks with HAL_DMAEx_ChangeMemory().
+       HAL_PSSI_GetStreamBytes() and HAL_PSSI_GetStreamThroughput() give the amount
+       of data transferred and the average throughput since the start.
+
     (#) A set of Transfer Complete Callbacks are provided in non Blocking mode:
         (++) HAL_PSSI_TxCpltCallback()
         (++) HAL_PSSI_RxCpltCallback()
+        (++) HAL_PSSI_TxHalfCpltCallback()
+        (++) HAL_PSSI_RxHalfCpltCallback()
         (++) HAL_PSSI_ErrorCallback()
         (++) HAL_PSSI_AbortCpltCallback()
 
@@ -1264,6 +1328,119 @@ HAL_StatusTypeDef HAL_PSSI_Abort_DMA(PSSI_HandleTypeDef *hpssi)
 
 }
 
+/**
+  * @brief  Transmit data continuously from a circular buffer with DMA.
+  * @param  hpssi Pointer to a PSSI_HandleTypeDef structure that contains
+  *                the configuration information for the specified PSSI.
+  * @param  pData Pointer to the circular data buffer
+  * @param  Size Size of the circular buffer (in bytes), at most 65535 DMA data items
+  * @note   The Tx DMA must be configured in circular mode.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_PSSI_TransmitCircular_DMA(PSSI_HandleTypeDef *hpssi, uint32_t *pData, uint32_t Size)
+{
+  return PSSI_StartStream_DMA(hpssi, HAL_PSSI_STATE_BUSY_TX, pData, NULL, Size);
+}
+
+/**
+  * @brief  Receive data continuously into a circular buffer with DMA.
+  * @param  hpssi Pointer to a PSSI_HandleTypeDef structure that contains
+  *                the configuration information for the specified PSSI.
+  * @param  pData Pointer to the circular data buffer
+  * @param  Size Size of the circular buffer (in bytes), at most 65535 DMA data items
+  * @note   The Rx DMA must be configured in circular mode.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_PSSI_ReceiveCircular_DMA(PSSI_HandleTypeDef *hpssi, uint32_t *pData, uint32_t Size)
+{
+  return PSSI_StartStream_DMA(hpssi, HAL_PSSI_STATE_BUSY_RX, pData, NULL, Size);
+}
+
+/**
+  * @brief  Transmit data continuously from two alternate buffers with DMA.
+  * @param  hpssi Pointer to a PSSI_HandleTypeDef structure that contains
+  *                the configuration information for the specified PSSI.
+  * @param  pData0 Pointer to the first data buffer
+  * @param  pData1 Pointer to the second data buffer
+  * @param  Size Size of each buffer (in bytes), at most 65535 DMA data items
+  * @note   The Tx DMA must be a DMA1 or DMA2 stream configured in circular mode.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_PSSI_TransmitDoubleBuffer_DMA(PSSI_HandleTypeDef *hpssi, uint32_t *pData0, uint32_t *pData1,
+                                                    uint32_t Size)
+{
+  if (pData1 == NULL)
+  {
+    return HAL_ERROR;
+  }
+  return PSSI_StartStream_DMA(hpssi, HAL_PSSI_STATE_BUSY_TX, pData0, pData1, Size);
+}
+
+/**
+  * @brief  Receive data continuously into two alternate buffers with DMA.
+  * @param  hpssi Pointer to a PSSI_HandleTypeDef structure that contains
+  *                the configuration information for the specified PSSI.
+  * @param  pData0 Pointer to the first data buffer
+  * @param  pData1 Pointer to the second data buffer
+  * @param  Size Size of each buffer (in bytes), at most 65535 DMA data items
+  * @note   The Rx DMA must be a DMA1 or DMA2 stream configured in circular mode.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_PSSI_ReceiveDoubleBuffer_DMA(PSSI_HandleTypeDef *hpssi, uint32_t *pData0, uint32_t *pData1,
+                                                   uint32_t Size)
+{
+  if (pData1 == NULL)
+  {
+    return HAL_ERROR;
+  }
+  return PSSI_StartStream_DMA(hpssi, HAL_PSSI_STATE_BUSY_RX, pData0, pData1, Size);
+}
+
+/**
+  * @brief  Stop a continuous DMA streaming in blocking mode.
+  * @param  hpssi Pointer to a PSSI_HandleTypeDef structure that contains
+  *                the configuration information for the specified PSSI.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_PSSI_StopStream_DMA(PSSI_HandleTypeDef *hpssi)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+  DMA_HandleTypeDef *hdma;
+
+  if ((hpssi->State != HAL_PSSI_STATE_BUSY_TX) && (hpssi->State != HAL_PSSI_STATE_BUSY_RX))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Process Locked */
+  __HAL_LOCK(hpssi);
+
+  hdma = (hpssi->State == HAL_PSSI_STATE_BUSY_TX) ? hpssi->hdmatx : hpssi->hdmarx;
+
+  /* Disable Interrupts */
+  HAL_PSSI_DISABLE_IT(hpssi, PSSI_FLAG_OVR_RIS);
+
+  /* Disable DMA Request */
+  hpssi->Instance->CR &= ~PSSI_CR_DMAEN;
+
+  /* Abort the DMA */
+  if (HAL_DMA_Abort(hdma) != HAL_OK)
+  {
+    hpssi->ErrorCode |= HAL_PSSI_ERROR_DMA;
+    status = HAL_ERROR;
+  }
+
+  /* Disable the selected PSSI peripheral */
+  HAL_PSSI_DISABLE(hpssi);
+
+  hpssi->State = HAL_PSSI_STATE_READY;
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(hpssi);
+
+  return status;
+}
+
 /**
   * @}
   */
@@ -1412,6 +1589,38 @@ __weak void HAL_PSSI_RxCpltCallback(PSSI_HandleTypeDef *hpssi)
 }
 
 
+/**
+  * @brief   Tx Half Transfer complete callback.
+  * @param  hpssi Pointer to a PSSI_HandleTypeDef structure that contains
+  *                the configuration information for the specified PSSI.
+  * @retval None
+  */
+__weak void HAL_PSSI_TxHalfCpltCallback(PSSI_HandleTypeDef *hpssi)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hpssi);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_PSSI_TxHalfCpltCallback can be implemented in the user file
+   */
+}
+
+/**
+  * @brief   Rx Half Transfer complete callback.
+  * @param  hpssi Pointer to a PSSI_HandleTypeDef structure that contains
+  *                the configuration information for the specified PSSI.
+  * @retval None
+  */
+__weak void HAL_PSSI_RxHalfCpltCallback(PSSI_HandleTypeDef *hpssi)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hpssi);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_PSSI_RxHalfCpltCallback can be implemented in the user file
+   */
+}
+
 /**
   * @brief  PSSI error callback.
   * @param  hpssi Pointer to a PSSI_HandleTypeDef structure that contains
@@ -1457,7 +1666,8 @@ __weak void HAL_PSSI_AbortCpltCallback(PSSI_HandleTypeDef *hpssi)
  ===============================================================================
     [..]
     This subsection permit to get in run-time the status of the peripheral
-    and the data flow.
+    and the data flow, including the amount of data and the throughput of a
+    continuous DMA streaming.
 
 @endverbatim
   * @{
@@ -1487,6 +1697,38 @@ uint32_t HAL_PSSI_GetError(PSSI_HandleTypeDef *hpssi)
   return hpssi->ErrorCode;
 }
 
+/**
+  * @brief  Return the number of bytes transferred by the last continuous DMA streaming.
+  * @param  hpssi Pointer to a PSSI_HandleTypeDef structure that contains
+  *              the configuration information for the specified PSSI.
+  * @note   Only completed half buffers (or buffers in double buffer mode) are counted.
+  * @retval Number of bytes
+  */
+uint64_t HAL_PSSI_GetStreamBytes(PSSI_HandleTypeDef *hpssi)
+{
+  return (uint64_t)hpssi->StreamCount * hpssi->StreamBlockSize;
+}
+
+/**
+  * @brief  Return the average throughput of the last continuous DMA streaming.
+  * @param  hpssi Pointer to a PSSI_HandleTypeDef structure that contains
+  *              the configuration information for the specified PSSI.
+  * @note   The throughput is computed from the HAL tick, 0 is returned until
+  *         one HAL tick period has elapsed since the start.
+  * @retval Throughput in bytes per second
+  */
+uint32_t HAL_PSSI_GetStreamThroughput(PSSI_HandleTypeDef *hpssi)
+{
+  uint32_t elapsed = (HAL_GetTick() - hpssi->StreamStartTick) * (uint32_t)HAL_GetTickFreq();
+
+  if (elapsed == 0U)
+  {
+    return 0U;
+  }
+
+  return (uint32_t)((HAL_PSSI_GetStreamBytes(hpssi) * 1000U) / elapsed);
+}
+
 /**
   * @}
   */
@@ -1784,6 +2026,201 @@ void PSSI_DMAError(DMA_HandleTypeDef *hdma)
 }
 
 
+/**
+  * @brief  Start a continuous DMA streaming.
+  * @param  hpssi PSSI handle.
+  * @param  Direction HAL_PSSI_STATE_BUSY_TX or HAL_PSSI_STATE_BUSY_RX.
+  * @param  pData0 Circular buffer, or first buffer in double buffer mode.
+  * @param  pData1 Second buffer in double buffer mode, NULL in circular mode.
+  * @param  Size Size of the circular buffer or of each buffer (in bytes).
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef PSSI_StartStream_DMA(PSSI_HandleTypeDef *hpssi, HAL_PSSI_StateTypeDef Direction,
+                                              uint32_t *pData0, uint32_t *pData1, uint32_t Size)
+{
+  HAL_StatusTypeDef dmaxferstatus;
+  DMA_HandleTypeDef *hdma;
+  uint32_t srcaddress;
+  uint32_t dstaddress;
+  uint32_t length;
+  uint32_t buswidth;
+  uint32_t ckpol;
+
+  hdma = (Direction == HAL_PSSI_STATE_BUSY_TX) ? hpssi->hdmatx : hpssi->hdmarx;
+
+  if ((pData0 == NULL) || (hdma == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  if (hpssi->State != HAL_PSSI_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  /* The DMA must run in circular mode for a gapless streaming */
+  if (hdma->Init.Mode != DMA_CIRCULAR)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Convert the size in DMA data items */
+  if (hdma->Init.PeriphDataAlignment == DMA_PDATAALIGN_WORD)
+  {
+    length = Size / 4U;
+  }
+  else if (hdma->Init.PeriphDataAlignment == DMA_PDATAALIGN_HALFWORD)
+  {
+    length = Size / 2U;
+  }
+  else
+  {
+    length = Size;
+  }
+
+  if ((length == 0U) || (length >= PSSI_MAX_NBYTE_SIZE))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Process Locked */
+  __HAL_LOCK(hpssi);
+
+  hpssi->State       = Direction;
+  hpssi->ErrorCode   = HAL_PSSI_ERROR_NONE;
+
+  /* Disable the selected PSSI peripheral */
+  HAL_PSSI_DISABLE(hpssi);
+
+  /* Prepare streaming parameters */
+  hpssi->pBuffPtr        = pData0;
+  hpssi->XferSize        = length;
+  hpssi->XferCount       = 0U;
+  hpssi->StreamCount     = 0U;
+  hpssi->StreamBlockSize = (pData1 == NULL) ? (Size / 2U) : Size;
+  hpssi->StreamStartTick = HAL_GetTick();
+
+  /* Configure BusWidth, direction and clock polarity */
+  buswidth = (hdma->Init.PeriphDataAlignment == DMA_PDATAALIGN_BYTE) ? 0U : hpssi->Init.BusWidth;
+
+  if (Direction == HAL_PSSI_STATE_BUSY_TX)
+  {
+    ckpol = (hpssi->Init.ClockPolarity == HAL_PSSI_RISING_EDGE) ? 0U : PSSI_CR_CKPOL;
+    MODIFY_REG(hpssi->Instance->CR, PSSI_CR_DMAEN | PSSI_CR_OUTEN | PSSI_CR_CKPOL,
+               PSSI_CR_DMA_ENABLE | buswidth | PSSI_CR_OUTEN_OUTPUT | ckpol);
+    srcaddress = (uint32_t)pData0;
+    dstaddress = (uint32_t)&hpssi->Instance->DR;
+  }
+  else
+  {
+    ckpol = (hpssi->Init.ClockPolarity == HAL_PSSI_RISING_EDGE) ? PSSI_CR_CKPOL : 0U;
+    MODIFY_REG(hpssi->Instance->CR, PSSI_CR_DMAEN | PSSI_CR_OUTEN | PSSI_CR_CKPOL,
+               PSSI_CR_DMA_ENABLE | buswidth | ckpol);
+    srcaddress = (uint32_t)&hpssi->Instance->DR;
+    dstaddress = (uint32_t)pData0;
+  }
+
+  /* Set the DMA error callback */
+  hdma->XferErrorCallback = PSSI_DMAError;
+  hdma->XferAbortCallback = NULL;
+
+  if (pData1 == NULL)
+  {
+    /* Circular mode : half and full buffer callbacks */
+    hdma->XferHalfCpltCallback = PSSI_DMAStreamHalfCplt;
+    hdma->XferCpltCallback     = PSSI_DMAStreamCplt;
+
+    /* Enable the DMA */
+    dmaxferstatus = HAL_DMA_Start_IT(hdma, srcaddress, dstaddress, length);
+  }
+  else
+  {
+    /* Double buffer mode : memory 0 and memory 1 complete callbacks */
+    hdma->XferHalfCpltCallback   = NULL;
+    hdma->XferM1HalfCpltCallback = NULL;
+    hdma->XferCpltCallback       = PSSI_DMAStreamHalfCplt;
+    hdma->XferM1CpltCallback     = PSSI_DMAStreamCplt;
+
+    /* Enable the DMA, the second buffer is the memory 1 target */
+    dmaxferstatus = HAL_DMAEx_MultiBufferStart_IT(hdma, srcaddress, dstaddress, (uint32_t)pData1, length);
+  }
+
+  if (dmaxferstatus != HAL_OK)
+  {
+    /* Update PSSI state */
+    hpssi->State     = HAL_PSSI_STATE_READY;
+
+    /* Update PSSI error code */
+    hpssi->ErrorCode |= HAL_PSSI_ERROR_DMA;
+
+    /* Process Unlocked */
+    __HAL_UNLOCK(hpssi);
+
+    return HAL_ERROR;
+  }
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(hpssi);
+
+  /* Note : The PSSI interrupts must be enabled after unlocking current process
+            to avoid the risk of PSSI interrupt handle execution before current
+            process unlock */
+  /* Enable ERR interrupt */
+  HAL_PSSI_ENABLE_IT(hpssi, PSSI_FLAG_OVR_RIS);
+
+  /* Enable DMA Request */
+  hpssi->Instance->CR |= PSSI_CR_DMA_ENABLE;
+
+  /* Enable the selected PSSI peripheral */
+  HAL_PSSI_ENABLE(hpssi);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  DMA PSSI streaming first half (or memory 0) complete callback.
+  * @param  hdma DMA handle
+  * @retval None
+  */
+static void PSSI_DMAStreamHalfCplt(DMA_HandleTypeDef *hdma)
+{
+  /* Derogation MISRAC2012-Rule-11.5 */
+  PSSI_HandleTypeDef *hpssi = (PSSI_HandleTypeDef *)(((DMA_HandleTypeDef *)hdma)->Parent);
+
+  hpssi->StreamCount++;
+
+  if (hpssi->State == HAL_PSSI_STATE_BUSY_TX)
+  {
+    hpssi->TxHalfCpltCallback(hpssi);
+  }
+  else
+  {
+    hpssi->RxHalfCpltCallback(hpssi);
+  }
+}
+
+/**
+  * @brief  DMA PSSI streaming second half (or memory 1) complete callback.
+  * @param  hdma DMA handle
+  * @retval None
+  */
+static void PSSI_DMAStreamCplt(DMA_HandleTypeDef *hdma)
+{
+  /* Derogation MISRAC2012-Rule-11.5 */
+  PSSI_HandleTypeDef *hpssi = (PSSI_HandleTypeDef *)(((DMA_HandleTypeDef *)hdma)->Parent);
+
+  hpssi->StreamCount++;
+
+  if (hpssi->State == HAL_PSSI_STATE_BUSY_TX)
+  {
+    hpssi->TxCpltCallback(hpssi);
+  }
+  else
+  {
+    hpssi->RxCpltCallback(hpssi);
+  }
+}
+
 
 /**
   * @}
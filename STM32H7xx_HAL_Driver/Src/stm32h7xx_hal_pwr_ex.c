@@ -57,6 +57,19 @@
    (#) Call HAL_PWREx_GetStopModeVoltageRange() function to get the current
        output voltage applied to the main regulator in STOP mode.
 
+   (#) Call HAL_PWREx_SelectVoltageScaling() function to get the lowest voltage
+       scaling allowing a CPU and an AHB frequency with a supply configuration.
+       Voltage scale 0 is only selected for a supply using the LDO.
+
+   (#) Call HAL_PWREx_ConfigOperatingPoint() function once after the system
+       startup, before the clock configuration, to set the supply source and
+       the voltage scaling of the first CPU and AHB frequencies.
+
+   (#) Call HAL_PWREx_SwitchOperatingPoint() function to change the system
+       clocks at runtime. The voltage scaling is raised before the clocks
+       or lowered after them, the overdrive being handled for Voltage scale 0.
+       The FLASH latency given must be valid for the new operating point.
+
    (#) Call HAL_PWREx_EnterSTOP2Mode() function to enter the system in STOP mode
        with core domain in D2STOP mode. This API is used only for STM32H7Axxx
        and STM32H7Bxxx devices.
@@ -209,13 +222,41 @@
   * @}
   */
 
+/** @defgroup PWREx_Operating_Point_Limits PWR Extended Operating Point Limits
+  * @{
+  */
+#define PWR_VOLTAGE_LEVEL_NUMBER  (4U)   /* VOS0 to VOS3 */
+/**
+  * @}
+  */
+
 /**
   * @}
   */
 
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
+/* Voltage scaling values ordered from the highest (VOS0) to the lowest (VOS3) voltage */
+static const uint32_t PWREx_VoltageScaleTable[PWR_VOLTAGE_LEVEL_NUMBER] =
+{
+  PWR_REGULATOR_VOLTAGE_SCALE0, PWR_REGULATOR_VOLTAGE_SCALE1,
+  PWR_REGULATOR_VOLTAGE_SCALE2, PWR_REGULATOR_VOLTAGE_SCALE3
+};
+
+/* Maximum CPU (rcc_c_ck) and AHB (rcc_hclk3) frequencies of each voltage scaling, in Hz */
+#if defined (PWR_SRDCR_VOS) /* STM32H7Axxx and STM32H7Bxxx lines */
+static const uint32_t PWREx_CpuFreqMaxTable[PWR_VOLTAGE_LEVEL_NUMBER] = {280000000U, 225000000U, 160000000U, 88000000U};
+static const uint32_t PWREx_AhbFreqMaxTable[PWR_VOLTAGE_LEVEL_NUMBER] = {280000000U, 225000000U, 160000000U, 88000000U};
+#elif defined (SYSCFG_PWRCR_ODEN) /* STM32H74xxx and STM32H75xxx lines */
+static const uint32_t PWREx_CpuFreqMaxTable[PWR_VOLTAGE_LEVEL_NUMBER] = {480000000U, 400000000U, 300000000U, 200000000U};
+static const uint32_t PWREx_AhbFreqMaxTable[PWR_VOLTAGE_LEVEL_NUMBER] = {240000000U, 200000000U, 150000000U, 100000000U};
+#else /* STM32H72xxx and STM32H73xxx lines, VOS0 CPU frequency without CPU frequency boost */
+static const uint32_t PWREx_CpuFreqMaxTable[PWR_VOLTAGE_LEVEL_NUMBER] = {520000000U, 400000000U, 300000000U, 170000000U};
+static const uint32_t PWREx_AhbFreqMaxTable[PWR_VOLTAGE_LEVEL_NUMBER] = {275000000U, 200000000U, 150000000U, 85000000U};
+#endif /* defined (PWR_SRDCR_VOS) */
+
 /* Private function prototypes -----------------------------------------------*/
+static uint32_t PWREx_GetActiveVoltageLevel (void);
 /* Private functions ---------------------------------------------------------*/
 /* Exported types ------------------------------------------------------------*/
 /* Exported functions --------------------------------------------------------*/
@@ -555,6 +596,190 @@ uint32_t HAL_PWREx_GetStopModeVoltageRange (void)
   /* Return the stop voltage scaling */
   return (PWR->CR1 & PWR_CR1_SVOS);
 }
+
+/**
+  * @brief Select the lowest voltage scaling allowing the given CPU and AHB
+  *        frequencies with the given supply configuration.
+  * @param  CpuFrequency : Target CPU clock (rcc_c_ck) frequency in Hz.
+  * @param  AhbFrequency : Target AHB clock (rcc_hclk3) frequency in Hz.
+  * @param  SupplySource : Supply configuration, see HAL_PWREx_ConfigSupply().
+  * @param  pVoltageScaling : Pointer to the selected voltage scaling, a value
+  *                           of PWR_REGULATOR_VOLTAGE_SCALE0 to
+  *                           PWR_REGULATOR_VOLTAGE_SCALE3.
+  * @note   Voltage Scale 0 is only selected when the Vcore is supplied from
+  *         the LDO (LDO alone or SMPS cascaded to the LDO). It is not
+  *         available on revision Y of the STM32H74x and STM32H75x lines.
+  * @note   For STM32H72x and STM32H73x lines, the Voltage Scale 0 CPU
+  *         frequency is raised to 550 MHz when the CPUFREQ_BOOST option bit
+  *         is set.
+  * @retval HAL status, HAL_ERROR when the frequencies are above the Voltage
+  *         Scale 0 limits or need Voltage Scale 0 with a supply configuration
+  *         that does not allow it.
+  */
+HAL_StatusTypeDef HAL_PWREx_SelectVoltageScaling (uint32_t CpuFrequency, uint32_t AhbFrequency,
+                                                  uint32_t SupplySource, uint32_t *pVoltageScaling)
+{
+  uint32_t level = PWR_VOLTAGE_LEVEL_NUMBER;
+  uint32_t cpumax;
+
+  if (pVoltageScaling == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Search from the lowest voltage the first level meeting both frequencies */
+  while (level > 0U)
+  {
+    level--;
+
+    cpumax = PWREx_CpuFreqMaxTable[level];
+#if defined (FLASH_OPTSR2_CPUFREQ_BOOST)
+    if ((level == 0U) && ((FLASH->OPTSR2_CUR & FLASH_OPTSR2_CPUFREQ_BOOST) != 0U))
+    {
+      cpumax = 550000000U;
+    }
+#endif /* defined (FLASH_OPTSR2_CPUFREQ_BOOST) */
+
+    if ((CpuFrequency <= cpumax) && (AhbFrequency <= PWREx_AhbFreqMaxTable[level]))
+    {
+      break;
+    }
+
+    if (level == 0U)
+    {
+      /* Above the Voltage Scale 0 limits */
+      return HAL_ERROR;
+    }
+  }
+
+  if (level == 0U)
+  {
+    /* The voltage scale 0 is only possible when LDO regulator is enabled */
+    if ((SupplySource & PWR_CR3_LDOEN) == 0U)
+    {
+      return HAL_ERROR;
+    }
+
+#if defined (SYSCFG_PWRCR_ODEN)
+    /* No overdrive on revision Y */
+    if (HAL_GetREVID () == REV_ID_Y)
+    {
+      return HAL_ERROR;
+    }
+#endif /* defined (SYSCFG_PWRCR_ODEN) */
+  }
+
+  *pVoltageScaling = PWREx_VoltageScaleTable[level];
+
+  return HAL_OK;
+}
+
+/**
+  * @brief Configure the supply and the voltage scaling for a first operating
+  *        point, after a system startup.
+  * @param  SupplySource : Specifies the Power Supply source, see
+  *                        HAL_PWREx_ConfigSupply().
+  * @param  CpuFrequency : CPU clock (rcc_c_ck) frequency in Hz that will be
+  *                        configured next.
+  * @param  AhbFrequency : AHB clock (rcc_hclk3) frequency in Hz that will be
+  *                        configured next.
+  * @note   To be called before HAL_RCC_OscConfig() and HAL_RCC_ClockConfig().
+  *         The supply configuration can only be set once after a power-on
+  *         reset, the following operating points are set with
+  *         HAL_PWREx_SwitchOperatingPoint().
+  * @retval HAL status.
+  */
+HAL_StatusTypeDef HAL_PWREx_ConfigOperatingPoint (uint32_t SupplySource, uint32_t CpuFrequency,
+                                                  uint32_t AhbFrequency)
+{
+  uint32_t voltagescaling;
+
+  /* Check the parameters */
+  assert_param (IS_PWR_SUPPLY (SupplySource));
+
+  /* Check first that the frequencies can be reached with this supply */
+  if (HAL_PWREx_SelectVoltageScaling (CpuFrequency, AhbFrequency, SupplySource, &voltagescaling) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  if (HAL_PWREx_ConfigSupply (SupplySource) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+#if defined (SYSCFG_PWRCR_ODEN)
+  /* The overdrive is controlled from SYSCFG */
+  if (voltagescaling == PWR_REGULATOR_VOLTAGE_SCALE0)
+  {
+    __HAL_RCC_SYSCFG_CLK_ENABLE ();
+  }
+#endif /* defined (SYSCFG_PWRCR_ODEN) */
+
+  return HAL_PWREx_ControlVoltageScaling (voltagescaling);
+}
+
+/**
+  * @brief Switch at runtime to the operating point of a new clock
+  *        configuration, in the order required by the voltage scaling.
+  * @param  pClkInit : Pointer to the new RCC_ClkInitTypeDef clock
+  *                    configuration, applied with HAL_RCC_ClockConfig(). The
+  *                    selected system clock source must be ready.
+  * @param  FLatency : FLASH latency, valid for the new AHB frequency at the
+  *                    new voltage scaling.
+  * @param  CpuFrequency : CPU clock (rcc_c_ck) frequency in Hz of pClkInit.
+  * @param  AhbFrequency : AHB clock (rcc_hclk3) frequency in Hz of pClkInit.
+  * @note   When the new operating point needs a higher voltage, the voltage
+  *         scaling is raised before the clocks. Otherwise the clocks are
+  *         lowered first, then the voltage scaling.
+  * @retval HAL status.
+  */
+HAL_StatusTypeDef HAL_PWREx_SwitchOperatingPoint (RCC_ClkInitTypeDef *pClkInit, uint32_t FLatency,
+                                                  uint32_t CpuFrequency, uint32_t AhbFrequency)
+{
+  uint32_t voltagescaling;
+  uint32_t level = 0U;
+
+  if (pClkInit == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  if (HAL_PWREx_SelectVoltageScaling (CpuFrequency, AhbFrequency, HAL_PWREx_GetSupplyConfig (),
+                                      &voltagescaling) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  while (PWREx_VoltageScaleTable[level] != voltagescaling)
+  {
+    level++;
+  }
+
+#if defined (SYSCFG_PWRCR_ODEN)
+  /* The overdrive is controlled from SYSCFG */
+  __HAL_RCC_SYSCFG_CLK_ENABLE ();
+#endif /* defined (SYSCFG_PWRCR_ODEN) */
+
+  if (level < PWREx_GetActiveVoltageLevel ())
+  {
+    /* Higher voltage needed: raise the voltage scaling, then the clocks */
+    if (HAL_PWREx_ControlVoltageScaling (voltagescaling) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+
+    return HAL_RCC_ClockConfig (pClkInit, FLatency);
+  }
+
+  /* Same or lower voltage: lower the clocks, then the voltage scaling */
+  if (HAL_RCC_ClockConfig (pClkInit, FLatency) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  return HAL_PWREx_ControlVoltageScaling (voltagescaling);
+}
 /**
   * @}
   */
@@ -2126,6 +2351,39 @@ __weak void HAL_PWREx_AVDCallback (void)
   * @}
   */
 
+/**
+  * @}
+  */
+
+/** @defgroup PWREx_Private_Functions PWR Extended Private Functions
+  * @{
+  */
+
+/**
+  * @brief Get the level of the active voltage scaling.
+  * @retval 0 for Voltage Scale 0 to 3 for Voltage Scale 3.
+  */
+static uint32_t PWREx_GetActiveVoltageLevel (void)
+{
+  uint32_t level = 0U;
+
+#if defined (SYSCFG_PWRCR_ODEN)
+  /* Voltage Scale 0 is Voltage Scale 1 with the overdrive */
+  if ((SYSCFG->PWRCR & SYSCFG_PWRCR_ODEN) != 0U)
+  {
+    return 0U;
+  }
+#endif /* defined (SYSCFG_PWRCR_ODEN) */
+
+  while ((level < (PWR_VOLTAGE_LEVEL_NUMBER - 1U)) &&
+         (PWREx_VoltageScaleTable[level] != (PWR->CSR1 & PWR_CSR1_ACTVOS)))
+  {
+    level++;
+  }
+
+  return level;
+}
+
 /**
   * @}
   */
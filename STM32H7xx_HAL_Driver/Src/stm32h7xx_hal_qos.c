@@ -0,0 +1,437 @@
+/**
+  ******************************************************************************
+  * @file    stm32h7xx_hal_qos.c
+  * @author  MCD Application Team
+  * @brief   Bus master QoS HAL module driver.
+             This file provides firmware functions to configure consistently the
+             AXI interconnect QoS and the DMA and MDMA channel priorities from
+             the traffic class of each bus master:
+              + Initialization and de-initialization functions
+              + Registration functions
+
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  @verbatim
+ ===============================================================================
+                        ##### How to use this driver #####
+ ===============================================================================
+  [..]
+    The D1 domain memories (AXI SRAM, flash, FMC, QUADSPI/OCTOSPI) are shared by
+    the masters of the AXI interconnect, and the streams of a DMA or the channels
+    of the MDMA share the same master port. A display controller underruns and
+    an audio FIFO overflows when a bulk transfer holds these resources, while a
+    memory copy only needs throughput. This driver maps each master on one of
+    four traffic classes and derives from it both arbitration levels:
+      (+) the AXI read and write QoS of the interconnect initiator port, from
+          QOS_AXI_LEVEL_BULK (0) to QOS_AXI_LEVEL_DISPLAY (15),
+      (+) the priority level of the DMA stream, BDMA channel or MDMA channel,
+          from xxx_PRIORITY_LOW to xxx_PRIORITY_VERY_HIGH.
+
+    *** Traffic classes ***
+    =======================
+    [..]
+     (#) QOS_CLASS_BULK: memory to memory copies, storage, best effort.
+     (#) QOS_CLASS_NETWORK: Ethernet, USB, high bandwidth with bounded latency.
+     (#) QOS_CLASS_AUDIO: SAI, I2S, SPDIFRX, low bandwidth but short FIFOs.
+     (#) QOS_CLASS_DISPLAY: LTDC, DMA2D feeding the frame buffer, the highest
+         bandwidth with no underrun allowed.
+
+    *** Registration ***
+    ====================
+    [..]
+     (#) Call HAL_QOS_Init() once, after HAL_Init(). All the AXI ports are set
+         back to QOS_CLASS_BULK.
+     (#) Register the masters with HAL_QOS_RegisterMaster() for the masters
+         without DMA handle (CPU, LTDC, DMA2D, Ethernet, SDMMC, USB), and with
+         HAL_QOS_RegisterDma() or HAL_QOS_RegisterMdma() for each DMA or MDMA
+         channel:
+         (++) The priority of the channel follows its class. When the channel is
+              already initialized and idle, its priority register is updated
+              directly, otherwise the priority is taken at the next
+              HAL_DMA_Init() or HAL_MDMA_Init(). A busy channel is refused.
+         (++) An AXI port shared by several masters (the AHB port of the D2
+              domain masters: DMA1, DMA2, Ethernet, SDMMC2, USB) takes the
+              highest class registered on it. A class is never lowered before
+              the next HAL_QOS_Init().
+     (#) HAL_QOS_GetPortClass() returns the class of an AXI port.
+     (#) HAL_QOS_DeInit() restores the reset QoS of all the ports.
+
+    *** Notes ***
+    =============
+    [..]
+     (#) The AXI QoS only arbitrates between the initiator ports at the AXI
+         targets, it does not help a master whose memory is on the D2 or D3
+         domain bus matrix, where only the DMA and BDMA priorities apply.
+     (#) The port mapping is the one of the STM32H72xxx, STM32H73xxx,
+         STM32H74xxx and STM32H75xxx lines. On the STM32H7Axxx and STM32H7Bxxx
+         lines, whose AXI interconnect has different initiator ports, the AXI
+         QoS is left unchanged and only the channel priorities are set.
+     (#) The registry is global to the core. On dual core devices, register all
+         the masters from the same core.
+
+  @endverbatim
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32h7xx_hal.h"
+
+/** @addtogroup STM32H7xx_HAL_Driver
+  * @{
+  */
+
+/** @defgroup QOS QOS
+  * @brief Bus master QoS HAL module driver
+  * @{
+  */
+
+#ifdef HAL_QOS_MODULE_ENABLED
+
+/**
+  @cond 0
+  */
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#if !defined(PWR_SRDCR_VOS)
+#define QOS_AXI_PORTS_MAPPED                          /*!< AXI initiator ports of QOS_AXI_Port  */
+#endif /* PWR_SRDCR_VOS */
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static uint8_t QOS_PortClass[QOS_AXI_PORTS_NBR];       /*!< Class of each AXI initiator port     */
+
+static const uint8_t QOS_AxiLevel[QOS_CLASSES_NBR] =   /*!< AXI QoS of each class                */
+{
+  QOS_AXI_LEVEL_BULK, QOS_AXI_LEVEL_NETWORK, QOS_AXI_LEVEL_AUDIO, QOS_AXI_LEVEL_DISPLAY
+};
+
+#if defined(HAL_DMA_MODULE_ENABLED)
+static const uint32_t QOS_DmaPriority[QOS_CLASSES_NBR] =
+{
+  DMA_PRIORITY_LOW, DMA_PRIORITY_MEDIUM, DMA_PRIORITY_HIGH, DMA_PRIORITY_VERY_HIGH
+};
+#endif /* HAL_DMA_MODULE_ENABLED */
+
+#if defined(HAL_MDMA_MODULE_ENABLED)
+static const uint32_t QOS_MdmaPriority[QOS_CLASSES_NBR] =
+{
+  MDMA_PRIORITY_LOW, MDMA_PRIORITY_MEDIUM, MDMA_PRIORITY_HIGH, MDMA_PRIORITY_VERY_HIGH
+};
+#endif /* HAL_MDMA_MODULE_ENABLED */
+
+/* Private function prototypes -----------------------------------------------*/
+static void QOS_SetAxiLevel(uint32_t Port, uint32_t Level);
+/**
+  @endcond
+  */
+
+/* Exported functions --------------------------------------------------------*/
+/** @defgroup QOS_Exported_Functions QOS Exported Functions
+  * @{
+  */
+
+/** @defgroup QOS_Exported_Functions_Group1 Initialization and de-initialization functions
+  *  @brief    Initialization and de-initialization functions
+  *
+@verbatim
+ ===============================================================================
+            ##### Initialization and de-initialization functions #####
+ ===============================================================================
+    [..]  This section provides functions to reset the registry of the traffic
+          classes and the AXI QoS of the initiator ports.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Initialize the QoS manager, all the AXI ports in QOS_CLASS_BULK.
+  * @retval None
+  */
+void HAL_QOS_Init(void)
+{
+  uint32_t port;
+
+  for (port = 0U; port < QOS_AXI_PORTS_NBR; port++)
+  {
+    QOS_PortClass[port] = (uint8_t)QOS_CLASS_BULK;
+    QOS_SetAxiLevel(port, QOS_AxiLevel[QOS_CLASS_BULK]);
+  }
+}
+
+/**
+  * @brief  De-initialize the QoS manager, restoring the reset AXI QoS (0) of
+  *         all the ports.
+  * @note   The DMA and MDMA channel priorities are left unchanged.
+  * @retval None
+  */
+void HAL_QOS_DeInit(void)
+{
+  uint32_t port;
+
+  for (port = 0U; port < QOS_AXI_PORTS_NBR; port++)
+  {
+    QOS_PortClass[port] = (uint8_t)QOS_CLASS_BULK;
+    QOS_SetAxiLevel(port, 0U);
+  }
+}
+
+/**
+  * @}
+  */
+
+/** @defgroup QOS_Exported_Functions_Group2 Registration functions
+  *  @brief    Registration functions
+  *
+@verbatim
+ ===============================================================================
+                      ##### Registration functions #####
+ ===============================================================================
+    [..]  This section provides functions to register the traffic class of the
+          bus masters and of the DMA and MDMA channels.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Register the traffic class of a bus master and raise the AXI QoS of
+  *         its initiator port accordingly.
+  * @param  Master Bus master, a value of @ref QOS_Master.
+  * @param  Class Traffic class, a value of @ref QOS_Class.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_QOS_RegisterMaster(uint32_t Master, uint32_t Class)
+{
+  uint32_t port;
+
+  /* Check the parameters */
+  assert_param(IS_QOS_MASTER(Master));
+  assert_param(IS_QOS_CLASS(Class));
+
+  if ((IS_QOS_MASTER(Master) == 0U) || (IS_QOS_CLASS(Class) == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  port = QOS_GET_PORT(Master);
+
+  /* A shared port takes the highest class of its masters */
+  if (Class > QOS_PortClass[port])
+  {
+    QOS_PortClass[port] = (uint8_t)Class;
+    QOS_SetAxiLevel(port, QOS_AxiLevel[Class]);
+  }
+
+  return HAL_OK;
+}
+
+#if defined(HAL_DMA_MODULE_ENABLED)
+/**
+  * @brief  Register the traffic class of a DMA1, DMA2 stream or BDMA channel.
+  *         The stream priority follows the class and, for DMA1 and DMA2, the
+  *         AXI QoS of the D2 domain AHB port is raised accordingly.
+  * @param  hdma pointer to a DMA_HandleTypeDef structure, Instance set.
+  * @param  Class Traffic class, a value of @ref QOS_Class.
+  * @retval HAL status, HAL_BUSY when a transfer is ongoing on the channel.
+  */
+HAL_StatusTypeDef HAL_QOS_RegisterDma(DMA_HandleTypeDef *hdma, uint32_t Class)
+{
+  uint32_t priority;
+
+  /* Check the DMA handle allocation */
+  if (hdma == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the parameters */
+  assert_param(IS_QOS_CLASS(Class));
+
+  if (IS_QOS_CLASS(Class) == 0U)
+  {
+    return HAL_ERROR;
+  }
+
+  if (hdma->State == HAL_DMA_STATE_BUSY)
+  {
+    return HAL_BUSY;
+  }
+
+  priority = QOS_DmaPriority[Class];
+  hdma->Init.Priority = priority;
+
+  if (IS_DMA_STREAM_INSTANCE(hdma->Instance) != 0U) /* DMA1 or DMA2 instance */
+  {
+    if (hdma->State == HAL_DMA_STATE_READY)
+    {
+      MODIFY_REG(((DMA_Stream_TypeDef *)hdma->Instance)->CR, DMA_SxCR_PL, priority);
+    }
+
+    return HAL_QOS_RegisterMaster(QOS_MASTER_DMA, Class);
+  }
+  else if (IS_BDMA_CHANNEL_INSTANCE(hdma->Instance) != 0U) /* BDMA instance(s) */
+  {
+    if (hdma->State == HAL_DMA_STATE_READY)
+    {
+      MODIFY_REG(((BDMA_Channel_TypeDef *)hdma->Instance)->CCR, BDMA_CCR_PL,
+                 priority >> (DMA_SxCR_PL_Pos - BDMA_CCR_PL_Pos));
+    }
+
+    /* The BDMA is a D3 domain master, out of the AXI interconnect */
+    return HAL_OK;
+  }
+  else
+  {
+    return HAL_ERROR;
+  }
+}
+#endif /* HAL_DMA_MODULE_ENABLED */
+
+#if defined(HAL_MDMA_MODULE_ENABLED)
+/**
+  * @brief  Register the traffic class of an MDMA channel. The channel priority
+  *         follows the class and the AXI QoS of the MDMA port is raised
+  *         accordingly.
+  * @param  hmdma pointer to a MDMA_HandleTypeDef structure, Instance set.
+  * @param  Class Traffic class, a value of @ref QOS_Class.
+  * @retval HAL status, HAL_BUSY when a transfer is ongoing on the channel.
+  */
+HAL_StatusTypeDef HAL_QOS_RegisterMdma(MDMA_HandleTypeDef *hmdma, uint32_t Class)
+{
+  /* Check the MDMA handle allocation */
+  if (hmdma == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the parameters */
+  assert_param(IS_MDMA_STREAM_ALL_INSTANCE(hmdma->Instance));
+  assert_param(IS_QOS_CLASS(Class));
+
+  if (IS_QOS_CLASS(Class) == 0U)
+  {
+    return HAL_ERROR;
+  }
+
+  if (hmdma->State == HAL_MDMA_STATE_BUSY)
+  {
+    return HAL_BUSY;
+  }
+
+  hmdma->Init.Priority = QOS_MdmaPriority[Class];
+
+  if (hmdma->State == HAL_MDMA_STATE_READY)
+  {
+    MODIFY_REG(hmdma->Instance->CCR, MDMA_CCR_PL, hmdma->Init.Priority);
+  }
+
+  return HAL_QOS_RegisterMaster(QOS_MASTER_MDMA, Class);
+}
+#endif /* HAL_MDMA_MODULE_ENABLED */
+
+/**
+  * @brief  Return the traffic class of an AXI initiator port.
+  * @param  Port AXI port, a value of @ref QOS_AXI_Port.
+  * @retval Traffic class, a value of @ref QOS_Class.
+  */
+uint32_t HAL_QOS_GetPortClass(uint32_t Port)
+{
+  /* Check the parameters */
+  assert_param(IS_QOS_AXI_PORT(Port));
+
+  if (IS_QOS_AXI_PORT(Port) == 0U)
+  {
+    return QOS_CLASS_BULK;
+  }
+
+  return QOS_PortClass[Port];
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/** @addtogroup QOS_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Set the AXI read and write QoS of an initiator port.
+  * @param  Port AXI port, a value of @ref QOS_AXI_Port.
+  * @param  Level QoS level, from 0 to 15.
+  * @retval None
+  */
+static void QOS_SetAxiLevel(uint32_t Port, uint32_t Level)
+{
+  assert_param(IS_QOS_AXI_LEVEL(Level));
+
+#if defined(QOS_AXI_PORTS_MAPPED)
+  switch (Port)
+  {
+    case QOS_AXI_PORT_AHB:
+      GPV->AXI_INI1_READ_QOS  = Level;
+      GPV->AXI_INI1_WRITE_QOS = Level;
+      break;
+
+    case QOS_AXI_PORT_CPU:
+      GPV->AXI_INI2_READ_QOS  = Level;
+      GPV->AXI_INI2_WRITE_QOS = Level;
+      break;
+
+    case QOS_AXI_PORT_SDMMC1:
+      GPV->AXI_INI3_READ_QOS  = Level;
+      GPV->AXI_INI3_WRITE_QOS = Level;
+      break;
+
+    case QOS_AXI_PORT_MDMA:
+      GPV->AXI_INI4_READ_QOS  = Level;
+      GPV->AXI_INI4_WRITE_QOS = Level;
+      break;
+
+    case QOS_AXI_PORT_DMA2D:
+      GPV->AXI_INI5_READ_QOS  = Level;
+      GPV->AXI_INI5_WRITE_QOS = Level;
+      break;
+
+    case QOS_AXI_PORT_LTDC:
+      GPV->AXI_INI6_READ_QOS  = Level;
+      GPV->AXI_INI6_WRITE_QOS = Level;
+      break;
+
+    default:
+      break;
+  }
+#else
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(Port);
+  UNUSED(Level);
+#endif /* QOS_AXI_PORTS_MAPPED */
+}
+
+/**
+  * @}
+  */
+
+#endif /* HAL_QOS_MODULE_ENABLED */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
@@ -9,6 +9,7 @@
   *           + Monitoring operation functions
   *           + Error information functions
   *           + State and error functions
+  *           + Telemetry and scrubbing functions
   ******************************************************************************
   * @attention
   *
@@ -67,6 +68,35 @@
      (#) Use HAL_RAMECC_IsECCDoubleErrorDetected() function to check if a double
          error was dedetected.
 
+     *** Error telemetry ***
+     =======================
+    [..]
+     (#) Each handle counts the single and double errors of its monitor and
+         keeps the last failing addresses in its Telemetry field. Counters are
+         updated by HAL_RAMECC_IRQHandler() for the enabled notifications, or
+         by HAL_RAMECC_PollTelemetry() in silent mode.
+     (#) Use HAL_RAMECC_GetTelemetry() to get a consistent copy of the
+         counters and HAL_RAMECC_ResetTelemetry() to clear them.
+
+     *** Background scrubbing ***
+     ============================
+    [..]
+     (#) A correction on read only fixes the returned data: the memory keeps
+         the error until the word is written again, and errors in rarely read
+         areas accumulate until a double error occurs. The scrubber walks an
+         ECC area block per block with a low priority MDMA channel, without
+         CPU load apart from one interrupt per block.
+     (#) Enable the MDMA clock and its interrupt, and call HAL_MDMA_IRQHandler()
+         from MDMA_IRQHandler().
+     (#) Fill a RAMECC_ScrubberTypeDef with the MDMA handle (only its Instance
+         is required), the area to scrub, the block size, the scrubbing mode
+         and the started monitors of the scrubbed banks, then call
+         HAL_RAMECC_Scrubber_Start().
+     (#) After each block the telemetry of the listed monitors is updated.
+         HAL_RAMECC_ScrubPassCpltCallback() is called at the end of each pass;
+         a continuous scrubber then starts the next pass.
+     (#) Use HAL_RAMECC_Scrubber_Stop() to stop the scrubbing.
+
      *** RAMECC HAL driver macros list ***
      =============================================
      [..]
@@ -101,6 +131,20 @@
 /* Private variables ---------------------------------------------------------*/
 /* Private constants ---------------------------------------------------------*/
 /* Private macros ------------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+/** @defgroup RAMECC_Private_Functions RAMECC Private Functions
+  * @{
+  */
+static void RAMECC_CountErrors (RAMECC_HandleTypeDef *hramecc, uint32_t Flags);
+#if defined (HAL_MDMA_MODULE_ENABLED)
+static HAL_StatusTypeDef RAMECC_ScrubNextBlock (RAMECC_ScrubberTypeDef *pScrubber);
+static void RAMECC_ScrubXferCplt (MDMA_HandleTypeDef *hmdma);
+static void RAMECC_ScrubXferError (MDMA_HandleTypeDef *hmdma);
+#endif /* HAL_MDMA_MODULE_ENABLED */
+/**
+  * @}
+  */
+
 /* Private functions ---------------------------------------------------------*/
 /* Exported functions --------------------------------------------------------*/
 
@@ -163,6 +207,13 @@ HAL_StatusTypeDef HAL_RAMECC_Init (RAMECC_HandleTypeDef *hramecc)
   /* Initialise the RAMECC error code */
   hramecc->ErrorCode = HAL_RAMECC_ERROR_NONE;
 
+  /* Reset the RAMECC error counters */
+  hramecc->Telemetry.SingleErrorCount       = 0U;
+  hramecc->Telemetry.DoubleErrorCount       = 0U;
+  hramecc->Telemetry.DoubleErrorWriteCount  = 0U;
+  hramecc->Telemetry.LastSingleErrorAddress = 0U;
+  hramecc->Telemetry.LastDoubleErrorAddress = 0U;
+
   /* Update the RAMECC state */
   hramecc->State = HAL_RAMECC_STATE_READY;
 
@@ -487,6 +538,9 @@ void HAL_RAMECC_IRQHandler (RAMECC_HandleTypeDef *hramecc)
     ier_reg = RAMECC_IT_GLOBAL_ALL;
   }
 
+  /* Count the active errors before clearing their flags */
+  RAMECC_CountErrors (hramecc, (((ier_reg | cr_reg) & sr_reg) >> 1U));
+
   /* Clear active flags */
   __HAL_RAMECC_CLEAR_FLAG (hramecc, (((ier_reg | cr_reg) & sr_reg) >> 1U));
 
@@ -670,6 +724,370 @@ uint32_t HAL_RAMECC_GetError (RAMECC_HandleTypeDef *hramecc)
   * @}
   */
 
+
+/** @addtogroup RAMECC_Exported_Functions_Group5
+  *
+@verbatim
+ ===============================================================================
+                #####  Telemetry and scrubbing functions  #####
+ ===============================================================================
+    [..]  This section provides functions allowing to:
+      (+) Update, get and reset the error counters of a monitor.
+      (+) Start and stop the MDMA background scrubbing of an ECC area.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Count and clear the errors latched by the RAMECC monitor.
+  * @param  hramecc  Pointer to a RAMECC_HandleTypeDef structure that contains
+  *                  the configuration information for the specified RAMECC
+  *                  Monitor.
+  * @note   To be used in silent mode, the enabled notifications being counted
+  *         by HAL_RAMECC_IRQHandler().
+  * @retval None.
+  */
+void HAL_RAMECC_PollTelemetry (RAMECC_HandleTypeDef *hramecc)
+{
+  uint32_t primask_bit;
+  uint32_t flags;
+
+  /* Check the parameters */
+  assert_param (IS_RAMECC_MONITOR_ALL_INSTANCE (hramecc->Instance));
+
+  /* Enter critical section: the RAMECC interrupt may clear the same flags */
+  primask_bit = __get_PRIMASK ();
+  __disable_irq ();
+
+  flags = hramecc->Instance->SR & RAMECC_FLAGS_ALL;
+
+  if (flags != 0U)
+  {
+    /* Count the latched errors then clear their flags */
+    RAMECC_CountErrors (hramecc, flags);
+    __HAL_RAMECC_CLEAR_FLAG (hramecc, flags);
+  }
+
+  /* Exit critical section */
+  __set_PRIMASK (primask_bit);
+}
+
+/**
+  * @brief  Get a consistent copy of the RAMECC monitor error counters.
+  * @param  hramecc     Pointer to a RAMECC_HandleTypeDef structure that
+  *                     contains the configuration information for the
+  *                     specified RAMECC Monitor.
+  * @param  pTelemetry  Pointer to the structure receiving the counters.
+  * @retval None.
+  */
+void HAL_RAMECC_GetTelemetry (RAMECC_HandleTypeDef *hramecc, RAMECC_TelemetryTypeDef *pTelemetry)
+{
+  uint32_t primask_bit;
+
+  /* Enter critical section */
+  primask_bit = __get_PRIMASK ();
+  __disable_irq ();
+
+  *pTelemetry = hramecc->Telemetry;
+
+  /* Exit critical section */
+  __set_PRIMASK (primask_bit);
+}
+
+/**
+  * @brief  Reset the RAMECC monitor error counters.
+  * @param  hramecc  Pointer to a RAMECC_HandleTypeDef structure that contains
+  *                  the configuration information for the specified RAMECC
+  *                  Monitor.
+  * @retval None.
+  */
+void HAL_RAMECC_ResetTelemetry (RAMECC_HandleTypeDef *hramecc)
+{
+  uint32_t primask_bit;
+
+  /* Enter critical section */
+  primask_bit = __get_PRIMASK ();
+  __disable_irq ();
+
+  hramecc->Telemetry.SingleErrorCount       = 0U;
+  hramecc->Telemetry.DoubleErrorCount       = 0U;
+  hramecc->Telemetry.DoubleErrorWriteCount  = 0U;
+  hramecc->Telemetry.LastSingleErrorAddress = 0U;
+  hramecc->Telemetry.LastDoubleErrorAddress = 0U;
+
+  /* Exit critical section */
+  __set_PRIMASK (primask_bit);
+}
+
+#if defined (HAL_MDMA_MODULE_ENABLED)
+/**
+  * @brief  Start the background scrubbing of an ECC area.
+  * @param  pScrubber  Pointer to a RAMECC_ScrubberTypeDef structure that
+  *                    describes the area to scrub and the MDMA channel used.
+  * @note   The MDMA channel is configured with a low priority, software
+  *         request and single bursts, so that the scrubbing only uses the
+  *         bus bandwidth left by the other masters.
+  * @note   The monitors listed in pScrubber must be started with
+  *         HAL_RAMECC_StartMonitor() for the errors to be latched.
+  * @retval HAL status.
+  */
+HAL_StatusTypeDef HAL_RAMECC_Scrubber_Start (RAMECC_ScrubberTypeDef *pScrubber)
+{
+  MDMA_HandleTypeDef *hmdma;
+
+  /* Check the scrubber structure */
+  if ((pScrubber == NULL) || (pScrubber->hmdma == NULL))
+  {
+    /* Return HAL status */
+    return HAL_ERROR;
+  }
+
+  /* Check the parameters */
+  assert_param (IS_RAMECC_SCRUB_MODE (pScrubber->Mode));
+  assert_param (IS_RAMECC_SCRUB_BLOCK_SIZE (pScrubber->BlockSize));
+
+  if ((pScrubber->Size == 0U) || (((pScrubber->StartAddress | pScrubber->Size | pScrubber->BlockSize) & 3U) != 0U) || \
+      (pScrubber->BlockSize > 65536U) || ((pScrubber->NbMonitors != 0U) && (pScrubber->pMonitors == NULL)))
+  {
+    /* Return HAL status */
+    return HAL_ERROR;
+  }
+
+  /* Check the scrubber state */
+  if (pScrubber->State == RAMECC_SCRUB_STATE_BUSY)
+  {
+    /* Return HAL status */
+    return HAL_BUSY;
+  }
+
+  hmdma = pScrubber->hmdma;
+
+  /* Configure the MDMA channel for word reads of the area */
+  hmdma->Init.Request                  = MDMA_REQUEST_SW;
+  hmdma->Init.TransferTriggerMode      = MDMA_BLOCK_TRANSFER;
+  hmdma->Init.Priority                 = MDMA_PRIORITY_LOW;
+  hmdma->Init.Endianness               = MDMA_LITTLE_ENDIANNESS_PRESERVE;
+  hmdma->Init.SourceInc                = MDMA_SRC_INC_WORD;
+  hmdma->Init.DestinationInc           = (pScrubber->Mode == RAMECC_SCRUB_REWRITE) ? MDMA_DEST_INC_WORD : MDMA_DEST_INC_DISABLE;
+  hmdma->Init.SourceDataSize           = MDMA_SRC_DATASIZE_WORD;
+  hmdma->Init.DestDataSize             = MDMA_DEST_DATASIZE_WORD;
+  hmdma->Init.DataAlignment            = MDMA_DATAALIGN_PACKENABLE;
+  hmdma->Init.BufferTransferLength     = 32U;
+  hmdma->Init.SourceBurst              = MDMA_SOURCE_BURST_SINGLE;
+  hmdma->Init.DestBurst                = MDMA_DEST_BURST_SINGLE;
+  hmdma->Init.SourceBlockAddressOffset = 0;
+  hmdma->Init.DestBlockAddressOffset   = 0;
+
+  if (HAL_MDMA_Init (hmdma) != HAL_OK)
+  {
+    /* Return HAL status */
+    return HAL_ERROR;
+  }
+
+  /* Link the MDMA channel to the scrubber */
+  hmdma->Parent            = pScrubber;
+  hmdma->XferCpltCallback  = RAMECC_ScrubXferCplt;
+  hmdma->XferErrorCallback = RAMECC_ScrubXferError;
+
+  /* Start the first block of the pass */
+  pScrubber->Offset = 0U;
+  pScrubber->State  = RAMECC_SCRUB_STATE_BUSY;
+
+  if (RAMECC_ScrubNextBlock (pScrubber) != HAL_OK)
+  {
+    pScrubber->State = RAMECC_SCRUB_STATE_ERROR;
+
+    /* Return HAL status */
+    return HAL_ERROR;
+  }
+
+  /* Return HAL status */
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop the background scrubbing.
+  * @param  pScrubber  Pointer to a RAMECC_ScrubberTypeDef structure that
+  *                    describes the area to scrub and the MDMA channel used.
+  * @note   This function may be called from HAL_RAMECC_ScrubPassCpltCallback().
+  * @retval HAL status.
+  */
+HAL_StatusTypeDef HAL_RAMECC_Scrubber_Stop (RAMECC_ScrubberTypeDef *pScrubber)
+{
+  uint32_t index;
+
+  /* Check the scrubber structure */
+  if ((pScrubber == NULL) || (pScrubber->hmdma == NULL))
+  {
+    /* Return HAL status */
+    return HAL_ERROR;
+  }
+
+  if (pScrubber->State == RAMECC_SCRUB_STATE_BUSY)
+  {
+    /* Prevent the next block from being started by the MDMA interrupt */
+    pScrubber->State = RAMECC_SCRUB_STATE_READY;
+
+    /* Abort the ongoing block, if any */
+    if (HAL_MDMA_GetState (pScrubber->hmdma) == HAL_MDMA_STATE_BUSY)
+    {
+      if (HAL_MDMA_Abort (pScrubber->hmdma) != HAL_OK)
+      {
+        pScrubber->State = RAMECC_SCRUB_STATE_ERROR;
+
+        /* Return HAL status */
+        return HAL_ERROR;
+      }
+    }
+
+    /* Account for the errors raised by the last block */
+    for (index = 0U; index < pScrubber->NbMonitors; index++)
+    {
+      HAL_RAMECC_PollTelemetry (pScrubber->pMonitors[index]);
+    }
+  }
+
+  /* Return HAL status */
+  return HAL_OK;
+}
+
+/**
+  * @brief  Scrubbing pass complete callback.
+  * @param  pScrubber  Pointer to a RAMECC_ScrubberTypeDef structure that
+  *                    describes the area to scrub and the MDMA channel used.
+  * @note   Called from the MDMA interrupt once the whole area has been read,
+  *         before a continuous scrubber starts its next pass.
+  * @retval None.
+  */
+__weak void HAL_RAMECC_ScrubPassCpltCallback (RAMECC_ScrubberTypeDef *pScrubber)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(pScrubber);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_RAMECC_ScrubPassCpltCallback can be implemented in the user file
+   */
+}
+#endif /* HAL_MDMA_MODULE_ENABLED */
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/** @addtogroup RAMECC_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Update the RAMECC monitor error counters.
+  * @param  hramecc  Pointer to a RAMECC_HandleTypeDef structure that contains
+  *                  the configuration information for the specified RAMECC
+  *                  Monitor.
+  * @param  Flags    Latched error flags, a combination of @ref RAMECC_FLAG.
+  * @retval None.
+  */
+static void RAMECC_CountErrors (RAMECC_HandleTypeDef *hramecc, uint32_t Flags)
+{
+  if ((Flags & RAMECC_FLAG_SINGLEERR_R) != 0U)
+  {
+    hramecc->Telemetry.SingleErrorCount++;
+    hramecc->Telemetry.LastSingleErrorAddress = hramecc->Instance->FAR;
+  }
+
+  if ((Flags & RAMECC_FLAG_DOUBLEERR_R) != 0U)
+  {
+    hramecc->Telemetry.DoubleErrorCount++;
+    hramecc->Telemetry.LastDoubleErrorAddress = hramecc->Instance->FAR;
+  }
+
+  if ((Flags & RAMECC_FLAG_DOUBLEERR_W) != 0U)
+  {
+    hramecc->Telemetry.DoubleErrorWriteCount++;
+    hramecc->Telemetry.LastDoubleErrorAddress = hramecc->Instance->FAR;
+  }
+}
+
+#if defined (HAL_MDMA_MODULE_ENABLED)
+/**
+  * @brief  Start the MDMA transfer of the next block of the scrubbed area.
+  * @param  pScrubber  Pointer to a RAMECC_ScrubberTypeDef structure.
+  * @retval HAL status.
+  */
+static HAL_StatusTypeDef RAMECC_ScrubNextBlock (RAMECC_ScrubberTypeDef *pScrubber)
+{
+  uint32_t address = pScrubber->StartAddress + pScrubber->Offset;
+  uint32_t length  = pScrubber->Size - pScrubber->Offset;
+  uint32_t destination;
+
+  if (length > pScrubber->BlockSize)
+  {
+    length = pScrubber->BlockSize;
+  }
+
+  /* Data is written back in place, or to a single word sink */
+  destination = (pScrubber->Mode == RAMECC_SCRUB_REWRITE) ? address : (uint32_t)&pScrubber->Sink;
+
+  pScrubber->Offset += length;
+
+  return HAL_MDMA_Start_IT (pScrubber->hmdma, address, destination, length, 1U);
+}
+
+/**
+  * @brief  MDMA block complete callback of the scrubber.
+  * @param  hmdma  Pointer to the MDMA handle of the scrubber.
+  * @retval None.
+  */
+static void RAMECC_ScrubXferCplt (MDMA_HandleTypeDef *hmdma)
+{
+  RAMECC_ScrubberTypeDef *pScrubber = (RAMECC_ScrubberTypeDef *)hmdma->Parent;
+  uint32_t index;
+
+  /* Account for the errors raised by the block */
+  for (index = 0U; index < pScrubber->NbMonitors; index++)
+  {
+    HAL_RAMECC_PollTelemetry (pScrubber->pMonitors[index]);
+  }
+
+  if (pScrubber->Offset >= pScrubber->Size)
+  {
+    /* End of pass */
+    pScrubber->Offset = 0U;
+    pScrubber->PassCount++;
+
+    if (pScrubber->Continuous == 0U)
+    {
+      pScrubber->State = RAMECC_SCRUB_STATE_READY;
+    }
+
+    HAL_RAMECC_ScrubPassCpltCallback (pScrubber);
+  }
+
+  /* Start the next block unless the scrubber has been stopped */
+  if (pScrubber->State == RAMECC_SCRUB_STATE_BUSY)
+  {
+    if (RAMECC_ScrubNextBlock (pScrubber) != HAL_OK)
+    {
+      pScrubber->State = RAMECC_SCRUB_STATE_ERROR;
+    }
+  }
+}
+
+/**
+  * @brief  MDMA error callback of the scrubber.
+  * @param  hmdma  Pointer to the MDMA handle of the scrubber.
+  * @retval None.
+  */
+static void RAMECC_ScrubXferError (MDMA_HandleTypeDef *hmdma)
+{
+  RAMECC_ScrubberTypeDef *pScrubber = (RAMECC_ScrubberTypeDef *)hmdma->Parent;
+
+  pScrubber->State = RAMECC_SCRUB_STATE_ERROR;
+}
+#endif /* HAL_MDMA_MODULE_ENABLED */
 /**
   * @}
   */
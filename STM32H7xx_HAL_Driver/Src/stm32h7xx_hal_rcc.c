@@ -79,6 +79,13 @@
 
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
+/** @defgroup RCC_Private_Constants RCC Private Constants
+  * @{
+  */
+#define RCC_RESTORE_TIMEOUT_LOOPS  0x00400000U /* Polling loops, about 0.5 s at 64 MHz */
+/**
+  * @}
+  */
 /* Private macro -------------------------------------------------------------*/
 /** @defgroup RCC_Private_Macros RCC Private Macros
   * @{
@@ -98,11 +105,23 @@
 /** @defgroup RCC_Private_Variables RCC Private Variables
   * @{
   */
-
+#if defined(USE_HAL_RCC_CLOCK_CACHE) && (USE_HAL_RCC_CLOCK_CACHE == 1U)
+/* Valid entries of the clock frequency cache, a combination of RCC_CLOCK_CACHE_xxx */
+uint32_t uwRCCClockCacheValid = 0U;
+static uint32_t RCC_SysClockCache;      /* SYSCLK frequency                      */
+static uint32_t RCC_SysClockCacheSWS;   /* RCC_CFGR_SWS of RCC_SysClockCache     */
+#endif /* USE_HAL_RCC_CLOCK_CACHE */
 /**
   * @}
   */
 /* Private function prototypes -----------------------------------------------*/
+/** @defgroup RCC_Private_Functions RCC Private Functions
+  * @{
+  */
+static HAL_StatusTypeDef RCC_WaitBitLoop(__IO uint32_t *Reg, uint32_t Mask, uint32_t Value);
+/**
+  * @}
+  */
 /* Exported functions --------------------------------------------------------*/
 
 /** @defgroup RCC_Exported_Functions RCC Exported Functions
@@ -189,6 +208,8 @@ HAL_StatusTypeDef HAL_RCC_DeInit(void)
 {
   uint32_t tickstart;
 
+  RCC_CLOCK_CACHE_INVALIDATE();
+
   /* Increasing the CPU frequency */
   if (FLASH_LATENCY_DEFAULT  > __HAL_FLASH_GET_LATENCY())
   {
@@ -413,6 +434,8 @@ __weak HAL_StatusTypeDef HAL_RCC_OscConfig(RCC_OscInitTypeDef  *RCC_OscInitStruc
     return HAL_ERROR;
   }
 
+  RCC_CLOCK_CACHE_INVALIDATE();
+
   /* Check the parameters */
   assert_param(IS_RCC_OSCILLATORTYPE(RCC_OscInitStruct->OscillatorType));
   /*------------------------------- HSE Configuration ------------------------*/
@@ -931,6 +954,8 @@ HAL_StatusTypeDef HAL_RCC_ClockConfig(RCC_ClkInitTypeDef  *RCC_ClkInitStruct, ui
     return HAL_ERROR;
   }
 
+  RCC_CLOCK_CACHE_INVALIDATE();
+
   /* Check the parameters */
   assert_param(IS_RCC_CLOCKTYPE(RCC_ClkInitStruct->ClockType));
   assert_param(IS_FLASH_LATENCY(FLatency));
@@ -1382,6 +1407,9 @@ void HAL_RCC_DisableCSS(void)
   * @note   Each time SYSCLK changes, this function must be called to update the
   *         right SYSCLK value. Otherwise, any configuration based on this function will be incorrect.
   *
+  * @note   With USE_HAL_RCC_CLOCK_CACHE set to 1, the frequency is decoded once and
+  *         returned from a cache until the system clock source changes or an RCC
+  *         configuration function is called.
   *
   * @retval SYSCLK frequency
   */
@@ -1390,10 +1418,19 @@ uint32_t HAL_RCC_GetSysClockFreq(void)
   uint32_t pllp, pllsource, pllm, pllfracen, hsivalue;
   float_t fracn1, pllvco;
   uint32_t sysclockfreq;
+  uint32_t sws = RCC->CFGR & RCC_CFGR_SWS;
+
+#if defined(USE_HAL_RCC_CLOCK_CACHE) && (USE_HAL_RCC_CLOCK_CACHE == 1U)
+  /* The source is also checked: the hardware switches it on STOP mode entry */
+  if (((uwRCCClockCacheValid & RCC_CLOCK_CACHE_SYSCLK) != 0U) && (sws == RCC_SysClockCacheSWS))
+  {
+    return RCC_SysClockCache;
+  }
+#endif /* USE_HAL_RCC_CLOCK_CACHE */
 
   /* Get SYSCLK source -------------------------------------------------------*/
 
-  switch (RCC->CFGR & RCC_CFGR_SWS)
+  switch (sws)
   {
     case RCC_CFGR_SWS_HSI:  /* HSI used as system clock source */
 
@@ -1469,6 +1506,12 @@ uint32_t HAL_RCC_GetSysClockFreq(void)
       break;
   }
 
+#if defined(USE_HAL_RCC_CLOCK_CACHE) && (USE_HAL_RCC_CLOCK_CACHE == 1U)
+  RCC_SysClockCache = sysclockfreq;
+  RCC_SysClockCacheSWS = sws;
+  uwRCCClockCacheValid |= RCC_CLOCK_CACHE_SYSCLK;
+#endif /* USE_HAL_RCC_CLOCK_CACHE */
+
   return sysclockfreq;
 }
 
@@ -1766,6 +1809,129 @@ void HAL_RCC_GetClockConfig(RCC_ClkInitTypeDef  *RCC_ClkInitStruct, uint32_t *pF
   *pFLatency = (uint32_t)(FLASH->ACR & FLASH_ACR_LATENCY);
 }
 
+/**
+  * @brief  Invalidate the clock frequency cache enabled by USE_HAL_RCC_CLOCK_CACHE.
+  * @note   The RCC configuration functions invalidate the cache. This function must
+  *         be called after the clock tree is changed by other means, for instance
+  *         with __HAL_RCC_PLL2FRACN_CONFIG() or the LL RCC functions.
+  * @retval None
+  */
+void HAL_RCC_InvalidateClockCache(void)
+{
+  RCC_CLOCK_CACHE_INVALIDATE();
+}
+
+/**
+  * @brief  Saves the oscillators, PLLs, Flash and over-drive configuration, to be
+  *         restored after STOP mode by HAL_RCC_RestoreClockState().
+  * @note   The PLL configuration and bus prescaler registers are kept in STOP mode,
+  *         only the oscillator and PLL enable bits and the system clock source are
+  *         saved.
+  * @param  pState: pointer to an RCC_ClockStateTypeDef structure to fill.
+  * @retval None
+  */
+void HAL_RCC_SaveClockState(RCC_ClockStateTypeDef *pState)
+{
+  pState->CR = RCC->CR;
+  pState->CFGR = RCC->CFGR;
+  pState->FlashACR = FLASH->ACR;
+#if defined(SYSCFG_PWRCR_ODEN)
+  pState->PwrODEN = SYSCFG->PWRCR & SYSCFG_PWRCR_ODEN;
+#else
+  pState->PwrODEN = 0U;
+#endif /* SYSCFG_PWRCR_ODEN */
+  pState->SystemCoreClock = SystemCoreClock;
+  pState->SystemD2Clock = SystemD2Clock;
+}
+
+/**
+  * @brief  Restores the clock configuration saved by HAL_RCC_SaveClockState(),
+  *         with the minimum register sequence.
+  * @note   To be called on wake-up from STOP mode, when the system runs on HSI or
+  *         CSI with the HSE and PLLs off, instead of HAL_RCC_OscConfig() and
+  *         HAL_RCC_ClockConfig(): the saved configuration is not checked again,
+  *         the PLLs lock while the regulator gets back to the saved voltage scale
+  *         and the time base is not re-initialized, as HCLK gets back its saved value.
+  * @note   The ready flags are polled with bounded loops rather than HAL_GetTick(),
+  *         so this function can be called before the tick is resumed.
+  * @param  pState: pointer to an RCC_ClockStateTypeDef structure saved before STOP mode.
+  * @retval HAL status: HAL_TIMEOUT if an oscillator, PLL or the regulator does not get ready.
+  */
+HAL_StatusTypeDef HAL_RCC_RestoreClockState(const RCC_ClockStateTypeDef *pState)
+{
+  uint32_t sysclksource = pState->CFGR & RCC_CFGR_SW;
+  uint32_t pllon = pState->CR & (RCC_CR_PLL1ON | RCC_CR_PLL2ON | RCC_CR_PLL3ON);
+#if defined(RCC_CR_HSEEXT)
+  uint32_t hsebypass = RCC_CR_HSEBYP | RCC_CR_HSEEXT;
+#else
+  uint32_t hsebypass = RCC_CR_HSEBYP;
+#endif /* RCC_CR_HSEEXT */
+
+  /* HSE: the bypass must be configured while the oscillator is off */
+  if(((pState->CR & RCC_CR_HSEON) != 0U) && ((RCC->CR & RCC_CR_HSERDY) == 0U))
+  {
+    MODIFY_REG(RCC->CR, hsebypass, pState->CR & hsebypass);
+    SET_BIT(RCC->CR, RCC_CR_HSEON);
+    if(RCC_WaitBitLoop(&RCC->CR, RCC_CR_HSERDY, RCC_CR_HSERDY) != HAL_OK)
+    {
+      return HAL_TIMEOUT;
+    }
+  }
+
+  /* PLLs and HSI48: their configuration is kept in STOP mode */
+  SET_BIT(RCC->CR, pllon | (pState->CR & RCC_CR_HSI48ON));
+
+#if defined(SYSCFG_PWRCR_ODEN)
+  /* Over-drive is disabled in STOP mode: enable it while the PLLs lock */
+  if((pState->PwrODEN != 0U) && ((SYSCFG->PWRCR & SYSCFG_PWRCR_ODEN) == 0U))
+  {
+    __HAL_RCC_SYSCFG_CLK_ENABLE();
+    SET_BIT(SYSCFG->PWRCR, SYSCFG_PWRCR_ODEN);
+  }
+#endif /* SYSCFG_PWRCR_ODEN */
+
+  /* The regulator reaches the saved voltage scale */
+#if defined(PWR_SRDCR_VOS)
+  if(RCC_WaitBitLoop(&PWR->SRDCR, PWR_SRDCR_VOSRDY, PWR_SRDCR_VOSRDY) != HAL_OK)
+#else
+  if(RCC_WaitBitLoop(&PWR->D3CR, PWR_D3CR_VOSRDY, PWR_D3CR_VOSRDY) != HAL_OK)
+#endif /* PWR_SRDCR_VOS */
+  {
+    return HAL_TIMEOUT;
+  }
+
+  /* Flash latency before the frequency increase */
+  FLASH->ACR = pState->FlashACR;
+
+  /* Each PLLxRDY bit follows its PLLxON bit */
+  if(RCC_WaitBitLoop(&RCC->CR, pllon << 1U, pllon << 1U) != HAL_OK)
+  {
+    return HAL_TIMEOUT;
+  }
+
+  /* System clock switch */
+  MODIFY_REG(RCC->CFGR, RCC_CFGR_SW, sysclksource);
+  if(RCC_WaitBitLoop(&RCC->CFGR, RCC_CFGR_SWS, sysclksource << RCC_CFGR_SWS_Pos) != HAL_OK)
+  {
+    return HAL_TIMEOUT;
+  }
+
+  /* HSI and CSI were only kept for the wake-up */
+  if((pState->CR & RCC_CR_HSION) == 0U)
+  {
+    CLEAR_BIT(RCC->CR, RCC_CR_HSION);
+  }
+  if((pState->CR & RCC_CR_CSION) == 0U)
+  {
+    CLEAR_BIT(RCC->CR, RCC_CR_CSION);
+  }
+
+  SystemCoreClock = pState->SystemCoreClock;
+  SystemD2Clock = pState->SystemD2Clock;
+
+  return HAL_OK;
+}
+
 /**
   * @brief This function handles the RCC CSS interrupt request.
   * @note This API should be called under the NMI_Handler().
@@ -1799,6 +1965,37 @@ __weak void HAL_RCC_CSSCallback(void)
   * @}
   */
 
+/**
+  * @}
+  */
+
+/** @addtogroup RCC_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Waits for register bits to reach a value, with a bounded number of loops.
+  * @param  Reg: register to poll.
+  * @param  Mask: bits to check.
+  * @param  Value: expected value of the bits.
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef RCC_WaitBitLoop(__IO uint32_t *Reg, uint32_t Mask, uint32_t Value)
+{
+  uint32_t count = RCC_RESTORE_TIMEOUT_LOOPS;
+
+  while((*Reg & Mask) != Value)
+  {
+    if(count == 0U)
+    {
+      return HAL_TIMEOUT;
+    }
+    count--;
+  }
+
+  return HAL_OK;
+}
+
 /**
   * @}
   */
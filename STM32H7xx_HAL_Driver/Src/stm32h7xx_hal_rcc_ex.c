@@ -6,6 +6,7 @@
   *          This file provides firmware functions to manage the following
   *          functionalities RCC extension peripheral:
   *           + Extended Peripheral Control functions
+  *           + Extended Performance Level functions
   *
   ******************************************************************************
   * @attention
@@ -44,6 +45,18 @@
 #define DIVIDER_P_UPDATE          0U
 #define DIVIDER_Q_UPDATE          1U
 #define DIVIDER_R_UPDATE          2U
+
+#if defined(PWR_SRDCR_VOS)
+#define RCC_VOS3_SYSCLK_MAX       88000000U   /* Voltage scale 3 */
+#define RCC_VOS2_SYSCLK_MAX       160000000U  /* Voltage scale 2 */
+#define RCC_VOS1_SYSCLK_MAX       225000000U  /* Voltage scale 1 */
+#define RCC_VOS0_SYSCLK_MAX       280000000U  /* Voltage scale 0 */
+#else
+#define RCC_VOS3_SYSCLK_MAX       170000000U  /* Voltage scale 3 */
+#define RCC_VOS2_SYSCLK_MAX       300000000U  /* Voltage scale 2 */
+#define RCC_VOS1_SYSCLK_MAX       400000000U  /* Voltage scale 1 */
+#define RCC_VOS0_SYSCLK_MAX       480000000U  /* Voltage scale 0 */
+#endif /* PWR_SRDCR_VOS */
 /**
   * @}
   */
@@ -57,9 +70,54 @@
   */
 
 /* Private variables ---------------------------------------------------------*/
+#if defined(USE_HAL_RCC_CLOCK_CACHE) && (USE_HAL_RCC_CLOCK_CACHE == 1U)
+/** @defgroup RCCEx_Private_Variables RCCEx Private Variables
+ * @{
+ */
+static PLL1_ClocksTypeDef RCCEx_PLL1Cache;  /* Last HAL_RCCEx_GetPLL1ClockFreq() result */
+static PLL2_ClocksTypeDef RCCEx_PLL2Cache;  /* Last HAL_RCCEx_GetPLL2ClockFreq() result */
+static PLL3_ClocksTypeDef RCCEx_PLL3Cache;  /* Last HAL_RCCEx_GetPLL3ClockFreq() result */
+/**
+  * @}
+  */
+#endif /* USE_HAL_RCC_CLOCK_CACHE */
+
+/* Predefined operating points, indexed by RCC_PERF_LEVEL_x. The FLASH latencies
+   keep one wait state of margin over the reference manual tables */
+static const RCC_OperatingPointTypeDef RCCEx_PerfLevelTable[RCC_PERF_LEVEL_MAX + 1U] =
+{
+#if defined(PWR_SRDCR_VOS)
+  /* Level 0: HSI 64 MHz, scale 3 */
+  { PWR_REGULATOR_VOLTAGE_SCALE3, RCC_SYSCLKSOURCE_HSI, 16U, 80U, 2U,
+    RCC_SYSCLK_DIV1, RCC_HCLK_DIV1, RCC_APB3_DIV2, RCC_APB1_DIV2, RCC_APB2_DIV2, RCC_APB4_DIV2, FLASH_LATENCY_3 },
+  /* Level 1: PLL1 64 MHz / 16 x 80 / 2 = 160 MHz, scale 2 */
+  { PWR_REGULATOR_VOLTAGE_SCALE2, RCC_SYSCLKSOURCE_PLLCLK, 16U, 80U, 2U,
+    RCC_SYSCLK_DIV1, RCC_HCLK_DIV1, RCC_APB3_DIV2, RCC_APB1_DIV2, RCC_APB2_DIV2, RCC_APB4_DIV2, FLASH_LATENCY_5 },
+  /* Level 2: PLL1 64 MHz / 16 x 140 / 2 = 280 MHz, scale 0 */
+  { PWR_REGULATOR_VOLTAGE_SCALE0, RCC_SYSCLKSOURCE_PLLCLK, 16U, 140U, 2U,
+    RCC_SYSCLK_DIV1, RCC_HCLK_DIV1, RCC_APB3_DIV2, RCC_APB1_DIV2, RCC_APB2_DIV2, RCC_APB4_DIV2, FLASH_LATENCY_7 },
+#else
+  /* Level 0: HSI 64 MHz, scale 3 */
+  { PWR_REGULATOR_VOLTAGE_SCALE3, RCC_SYSCLKSOURCE_HSI, 16U, 80U, 2U,
+    RCC_SYSCLK_DIV1, RCC_HCLK_DIV1, RCC_APB3_DIV2, RCC_APB1_DIV2, RCC_APB2_DIV2, RCC_APB4_DIV2, FLASH_LATENCY_2 },
+  /* Level 1: PLL1 64 MHz / 16 x 80 / 2 = 160 MHz, HCLK 80 MHz, scale 3 */
+  { PWR_REGULATOR_VOLTAGE_SCALE3, RCC_SYSCLKSOURCE_PLLCLK, 16U, 80U, 2U,
+    RCC_SYSCLK_DIV1, RCC_HCLK_DIV2, RCC_APB3_DIV2, RCC_APB1_DIV2, RCC_APB2_DIV2, RCC_APB4_DIV2, FLASH_LATENCY_2 },
+  /* Level 2: PLL1 64 MHz / 16 x 200 / 2 = 400 MHz, HCLK 200 MHz, scale 1 */
+  { PWR_REGULATOR_VOLTAGE_SCALE1, RCC_SYSCLKSOURCE_PLLCLK, 16U, 200U, 2U,
+    RCC_SYSCLK_DIV1, RCC_HCLK_DIV2, RCC_APB3_DIV2, RCC_APB1_DIV2, RCC_APB2_DIV2, RCC_APB4_DIV2, FLASH_LATENCY_4 },
+#endif /* PWR_SRDCR_VOS */
+};
+
+/* Current performance level, above RCC_PERF_LEVEL_MAX until a level is selected */
+static uint32_t RCCEx_PerfLevel = 0xFFFFFFFFU;
+
 /* Private function prototypes -----------------------------------------------*/
 static HAL_StatusTypeDef RCCEx_PLL2_Config(RCC_PLL2InitTypeDef *pll2, uint32_t Divider);
 static HAL_StatusTypeDef RCCEx_PLL3_Config(RCC_PLL3InitTypeDef *pll3, uint32_t Divider);
+static uint32_t RCCEx_PLL2_IsStarted(const RCC_PLL2InitTypeDef *pll2, uint32_t Divider);
+static uint32_t RCCEx_PLL3_IsStarted(const RCC_PLL3InitTypeDef *pll3, uint32_t Divider);
+static uint32_t RCCEx_VoltageRank(uint32_t VoltageScaling);
 
 /* Exported functions --------------------------------------------------------*/
 /** @defgroup RCCEx_Exported_Functions RCCEx Exported Functions
@@ -2939,6 +2997,8 @@ uint32_t HAL_RCCEx_GetD3PCLK1Freq(void)
   *
   * @note   Each time PLL2CLK changes, this function must be called to update the
   *         right PLL2CLK value. Otherwise, any configuration based on this function will be incorrect.
+  * @note   With USE_HAL_RCC_CLOCK_CACHE set to 1, the frequencies are decoded once and
+  *         returned from a cache until an RCC configuration function is called.
   * @param  PLL2_Clocks structure.
   * @retval None
   */
@@ -2947,6 +3007,14 @@ void HAL_RCCEx_GetPLL2ClockFreq(PLL2_ClocksTypeDef *PLL2_Clocks)
   uint32_t  pllsource, pll2m,  pll2fracen, hsivalue;
   float_t fracn2, pll2vco;
 
+#if defined(USE_HAL_RCC_CLOCK_CACHE) && (USE_HAL_RCC_CLOCK_CACHE == 1U)
+  if ((uwRCCClockCacheValid & RCC_CLOCK_CACHE_PLL2) != 0U)
+  {
+    *PLL2_Clocks = RCCEx_PLL2Cache;
+    return;
+  }
+#endif /* USE_HAL_RCC_CLOCK_CACHE */
+
   /* PLL_VCO = (HSE_VALUE or HSI_VALUE or CSI_VALUE/ PLL2M) * PLL2N
      PLL2xCLK = PLL2_VCO / PLL2x
   */
@@ -2995,6 +3063,11 @@ void HAL_RCCEx_GetPLL2ClockFreq(PLL2_ClocksTypeDef *PLL2_Clocks)
     PLL2_Clocks->PLL2_Q_Frequency = 0U;
     PLL2_Clocks->PLL2_R_Frequency = 0U;
   }
+
+#if defined(USE_HAL_RCC_CLOCK_CACHE) && (USE_HAL_RCC_CLOCK_CACHE == 1U)
+  RCCEx_PLL2Cache = *PLL2_Clocks;
+  uwRCCClockCacheValid |= RCC_CLOCK_CACHE_PLL2;
+#endif /* USE_HAL_RCC_CLOCK_CACHE */
 }
 
 /**
@@ -3008,6 +3081,8 @@ void HAL_RCCEx_GetPLL2ClockFreq(PLL2_ClocksTypeDef *PLL2_Clocks)
   *
   * @note   Each time PLL3CLK changes, this function must be called to update the
   *         right PLL3CLK value. Otherwise, any configuration based on this function will be incorrect.
+  * @note   With USE_HAL_RCC_CLOCK_CACHE set to 1, the frequencies are decoded once and
+  *         returned from a cache until an RCC configuration function is called.
   * @param  PLL3_Clocks structure.
   * @retval None
   */
@@ -3016,6 +3091,14 @@ void HAL_RCCEx_GetPLL3ClockFreq(PLL3_ClocksTypeDef *PLL3_Clocks)
   uint32_t pllsource, pll3m, pll3fracen, hsivalue;
   float_t fracn3, pll3vco;
 
+#if defined(USE_HAL_RCC_CLOCK_CACHE) && (USE_HAL_RCC_CLOCK_CACHE == 1U)
+  if ((uwRCCClockCacheValid & RCC_CLOCK_CACHE_PLL3) != 0U)
+  {
+    *PLL3_Clocks = RCCEx_PLL3Cache;
+    return;
+  }
+#endif /* USE_HAL_RCC_CLOCK_CACHE */
+
   /* PLL3_VCO = (HSE_VALUE or HSI_VALUE or CSI_VALUE/ PLL3M) * PLL3N
      PLL3xCLK = PLL3_VCO / PLLxR
   */
@@ -3063,6 +3146,11 @@ void HAL_RCCEx_GetPLL3ClockFreq(PLL3_ClocksTypeDef *PLL3_Clocks)
     PLL3_Clocks->PLL3_R_Frequency = 0U;
   }
 
+#if defined(USE_HAL_RCC_CLOCK_CACHE) && (USE_HAL_RCC_CLOCK_CACHE == 1U)
+  RCCEx_PLL3Cache = *PLL3_Clocks;
+  uwRCCClockCacheValid |= RCC_CLOCK_CACHE_PLL3;
+#endif /* USE_HAL_RCC_CLOCK_CACHE */
+
 }
 
 /**
@@ -3076,6 +3164,8 @@ void HAL_RCCEx_GetPLL3ClockFreq(PLL3_ClocksTypeDef *PLL3_Clocks)
   *
   * @note   Each time PLL1CLK changes, this function must be called to update the
   *         right PLL1CLK value. Otherwise, any configuration based on this function will be incorrect.
+  * @note   With USE_HAL_RCC_CLOCK_CACHE set to 1, the frequencies are decoded once and
+  *         returned from a cache until an RCC configuration function is called.
   * @param  PLL1_Clocks structure.
   * @retval None
   */
@@ -3084,6 +3174,14 @@ void HAL_RCCEx_GetPLL1ClockFreq(PLL1_ClocksTypeDef *PLL1_Clocks)
   uint32_t pllsource, pll1m, pll1fracen, hsivalue;
   float_t fracn1, pll1vco;
 
+#if defined(USE_HAL_RCC_CLOCK_CACHE) && (USE_HAL_RCC_CLOCK_CACHE == 1U)
+  if ((uwRCCClockCacheValid & RCC_CLOCK_CACHE_PLL1) != 0U)
+  {
+    *PLL1_Clocks = RCCEx_PLL1Cache;
+    return;
+  }
+#endif /* USE_HAL_RCC_CLOCK_CACHE */
+
   pllsource = (RCC->PLLCKSELR & RCC_PLLCKSELR_PLLSRC);
   pll1m = ((RCC->PLLCKSELR & RCC_PLLCKSELR_DIVM1) >> 4);
   pll1fracen = RCC->PLLCFGR & RCC_PLLCFGR_PLL1FRACEN;
@@ -3130,6 +3228,11 @@ void HAL_RCCEx_GetPLL1ClockFreq(PLL1_ClocksTypeDef *PLL1_Clocks)
     PLL1_Clocks->PLL1_R_Frequency = 0U;
   }
 
+#if defined(USE_HAL_RCC_CLOCK_CACHE) && (USE_HAL_RCC_CLOCK_CACHE == 1U)
+  RCCEx_PLL1Cache = *PLL1_Clocks;
+  uwRCCClockCacheValid |= RCC_CLOCK_CACHE_PLL1;
+#endif /* USE_HAL_RCC_CLOCK_CACHE */
+
 }
 
 /**
@@ -3670,6 +3773,589 @@ __weak void HAL_RCCEx_CRS_ErrorCallback(uint32_t Error)
 }
 
 
+/**
+  * @}
+  */
+
+/** @defgroup RCCEx_Exported_Functions_Group4 Extended Boot Sequencing functions
+ *  @brief  Extended Boot Sequencing functions
+ *
+@verbatim
+ ===============================================================================
+                ##### Extended Boot Sequencing functions #####
+ ===============================================================================
+    [..]
+      HAL_RCC_OscConfig() and HAL_RCCEx_PeriphCLKConfig() start each oscillator
+      and PLL, then wait for it to be ready before the next one: the startup
+      times add up. These functions start them all at once and defer the wait
+      until a clock is needed:
+      (+) HAL_RCCEx_StartOscillators() turns on the HSE, LSE, CSI and HSI48
+          selected in a RCC_OscInitTypeDef structure, without waiting.
+      (+) HAL_RCCEx_StartPLL2() and HAL_RCCEx_StartPLL3() configure and turn on
+          PLL2 and PLL3 with their P, Q and R outputs, without waiting. The PLL
+          source (PLL1 configuration) must already be selected; the PLL locks
+          as soon as its source oscillator is stable.
+      (+) HAL_RCCEx_GetClockReady() returns the started clocks already ready,
+          HAL_RCCEx_WaitClockReady() waits for those a consumer needs.
+      (+) HAL_RCC_OscConfig() and HAL_RCCEx_PeriphCLKConfig() called later with
+          the same settings only wait for the remaining startup time: a PLL2 or
+          PLL3 started with the same parameters is not restarted.
+    [..]
+      Defining BOOT_START_HSE in system_stm32h7xx.c also starts the HSE from
+      SystemInit(), so that its startup overlaps the .data/.bss initialization.
+
+@endverbatim
+ * @{
+ */
+
+/**
+  * @brief  Start oscillators without waiting for them to be ready.
+  * @param  RCC_OscInitStruct pointer to an RCC_OscInitTypeDef structure. Only the
+  *         HSE, LSE, CSI and HSI48 of OscillatorType are started, with the
+  *         HSEState and LSEState values; the other fields are not used.
+  * @note   An oscillator already on is left unchanged.
+  * @retval HAL status, HAL_ERROR when the HSE is requested in another mode than
+  *         the running one, HAL_TIMEOUT when the Backup domain write access
+  *         for the LSE is not granted
+  */
+HAL_StatusTypeDef HAL_RCCEx_StartOscillators(const RCC_OscInitTypeDef *RCC_OscInitStruct)
+{
+  uint32_t tickstart;
+
+  if (RCC_OscInitStruct == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  if ((RCC_OscInitStruct->OscillatorType & RCC_OSCILLATORTYPE_HSE) != 0U)
+  {
+    assert_param(IS_RCC_HSE(RCC_OscInitStruct->HSEState));
+
+    if (READ_BIT(RCC->CR, RCC_CR_HSEON) == 0U)
+    {
+      __HAL_RCC_HSE_CONFIG(RCC_OscInitStruct->HSEState);
+    }
+    else if ((RCC_OscInitStruct->HSEState == RCC_HSE_OFF) ||
+             ((READ_BIT(RCC->CR, RCC_CR_HSEBYP) != 0U) != (RCC_OscInitStruct->HSEState != RCC_HSE_ON)))
+    {
+      return HAL_ERROR;
+    }
+    else
+    {
+      /* HSE already started */
+    }
+  }
+
+  if ((RCC_OscInitStruct->OscillatorType & RCC_OSCILLATORTYPE_LSE) != 0U)
+  {
+    assert_param(IS_RCC_LSE(RCC_OscInitStruct->LSEState));
+
+    if (READ_BIT(RCC->BDCR, RCC_BDCR_LSEON) == 0U)
+    {
+      /* Enable write access to Backup domain */
+      SET_BIT(PWR->CR1, PWR_CR1_DBP);
+
+      /* Wait for Backup domain Write protection disable */
+      tickstart = HAL_GetTick();
+
+      while (READ_BIT(PWR->CR1, PWR_CR1_DBP) == 0U)
+      {
+        if ((HAL_GetTick() - tickstart) > RCC_DBP_TIMEOUT_VALUE)
+        {
+          return HAL_TIMEOUT;
+        }
+      }
+
+      __HAL_RCC_LSE_CONFIG(RCC_OscInitStruct->LSEState);
+    }
+  }
+
+  if ((RCC_OscInitStruct->OscillatorType & RCC_OSCILLATORTYPE_CSI) != 0U)
+  {
+    __HAL_RCC_CSI_ENABLE();
+  }
+
+  if ((RCC_OscInitStruct->OscillatorType & RCC_OSCILLATORTYPE_HSI48) != 0U)
+  {
+    __HAL_RCC_HSI48_ENABLE();
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Configure and start PLL2 without waiting for its lock.
+  * @param  pll2 Pointer to an RCC_PLL2InitTypeDef structure.
+  * @note   The P, Q and R outputs are all enabled, the kernel clock muxes select
+  *         the ones actually used. PLL2 must be off.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_RCCEx_StartPLL2(const RCC_PLL2InitTypeDef *pll2)
+{
+  assert_param(IS_RCC_PLL2M_VALUE(pll2->PLL2M));
+  assert_param(IS_RCC_PLL2N_VALUE(pll2->PLL2N));
+  assert_param(IS_RCC_PLL2P_VALUE(pll2->PLL2P));
+  assert_param(IS_RCC_PLL2R_VALUE(pll2->PLL2R));
+  assert_param(IS_RCC_PLL2Q_VALUE(pll2->PLL2Q));
+  assert_param(IS_RCC_PLL2RGE_VALUE(pll2->PLL2RGE));
+  assert_param(IS_RCC_PLL2VCO_VALUE(pll2->PLL2VCOSEL));
+  assert_param(IS_RCC_PLLFRACN_VALUE(pll2->PLL2FRACN));
+
+  if ((__HAL_RCC_GET_PLL_OSCSOURCE() == RCC_PLLSOURCE_NONE) || (READ_BIT(RCC->CR, RCC_CR_PLL2ON) != 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  RCC_CLOCK_CACHE_INVALIDATE();
+
+  __HAL_RCC_PLL2_CONFIG(pll2->PLL2M, pll2->PLL2N, pll2->PLL2P, pll2->PLL2Q, pll2->PLL2R);
+  __HAL_RCC_PLL2_VCIRANGE(pll2->PLL2RGE);
+  __HAL_RCC_PLL2_VCORANGE(pll2->PLL2VCOSEL);
+  __HAL_RCC_PLL2FRACN_DISABLE();
+  __HAL_RCC_PLL2FRACN_CONFIG(pll2->PLL2FRACN);
+  __HAL_RCC_PLL2FRACN_ENABLE();
+  __HAL_RCC_PLL2CLKOUT_ENABLE(RCC_PLL2_DIVP | RCC_PLL2_DIVQ | RCC_PLL2_DIVR);
+
+  __HAL_RCC_PLL2_ENABLE();
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Configure and start PLL3 without waiting for its lock.
+  * @param  pll3 Pointer to an RCC_PLL3InitTypeDef structure.
+  * @note   The P, Q and R outputs are all enabled, the kernel clock muxes select
+  *         the ones actually used. PLL3 must be off.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_RCCEx_StartPLL3(const RCC_PLL3InitTypeDef *pll3)
+{
+  assert_param(IS_RCC_PLL3M_VALUE(pll3->PLL3M));
+  assert_param(IS_RCC_PLL3N_VALUE(pll3->PLL3N));
+  assert_param(IS_RCC_PLL3P_VALUE(pll3->PLL3P));
+  assert_param(IS_RCC_PLL3R_VALUE(pll3->PLL3R));
+  assert_param(IS_RCC_PLL3Q_VALUE(pll3->PLL3Q));
+  assert_param(IS_RCC_PLL3RGE_VALUE(pll3->PLL3RGE));
+  assert_param(IS_RCC_PLL3VCO_VALUE(pll3->PLL3VCOSEL));
+  assert_param(IS_RCC_PLLFRACN_VALUE(pll3->PLL3FRACN));
+
+  if ((__HAL_RCC_GET_PLL_OSCSOURCE() == RCC_PLLSOURCE_NONE) || (READ_BIT(RCC->CR, RCC_CR_PLL3ON) != 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  RCC_CLOCK_CACHE_INVALIDATE();
+
+  __HAL_RCC_PLL3_CONFIG(pll3->PLL3M, pll3->PLL3N, pll3->PLL3P, pll3->PLL3Q, pll3->PLL3R);
+  __HAL_RCC_PLL3_VCIRANGE(pll3->PLL3RGE);
+  __HAL_RCC_PLL3_VCORANGE(pll3->PLL3VCOSEL);
+  __HAL_RCC_PLL3FRACN_DISABLE();
+  __HAL_RCC_PLL3FRACN_CONFIG(pll3->PLL3FRACN);
+  __HAL_RCC_PLL3FRACN_ENABLE();
+  __HAL_RCC_PLL3CLKOUT_ENABLE(RCC_PLL3_DIVP | RCC_PLL3_DIVQ | RCC_PLL3_DIVR);
+
+  __HAL_RCC_PLL3_ENABLE();
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Return the clocks already ready among the given ones.
+  * @param  Clocks Clocks to check, a combination of @ref RCCEx_Clock_Ready values.
+  * @retval Ready clocks, a combination of @ref RCCEx_Clock_Ready values
+  */
+uint32_t HAL_RCCEx_GetClockReady(uint32_t Clocks)
+{
+  uint32_t cr = RCC->CR;
+  uint32_t ready = 0U;
+
+  if ((cr & RCC_CR_HSERDY) != 0U)
+  {
+    ready |= RCC_CLOCKREADY_HSE;
+  }
+  if ((RCC->BDCR & RCC_BDCR_LSERDY) != 0U)
+  {
+    ready |= RCC_CLOCKREADY_LSE;
+  }
+  if ((cr & RCC_CR_CSIRDY) != 0U)
+  {
+    ready |= RCC_CLOCKREADY_CSI;
+  }
+  if ((cr & RCC_CR_HSI48RDY) != 0U)
+  {
+    ready |= RCC_CLOCKREADY_HSI48;
+  }
+  if ((cr & RCC_CR_PLL1RDY) != 0U)
+  {
+    ready |= RCC_CLOCKREADY_PLL1;
+  }
+  if ((cr & RCC_CR_PLL2RDY) != 0U)
+  {
+    ready |= RCC_CLOCKREADY_PLL2;
+  }
+  if ((cr & RCC_CR_PLL3RDY) != 0U)
+  {
+    ready |= RCC_CLOCKREADY_PLL3;
+  }
+
+  return ready & Clocks;
+}
+
+/**
+  * @brief  Wait for clocks to be ready, before their first use.
+  * @param  Clocks Clocks to wait for, a combination of @ref RCCEx_Clock_Ready values.
+  * @param  Timeout Timeout duration in ms. The time base must be running.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_RCCEx_WaitClockReady(uint32_t Clocks, uint32_t Timeout)
+{
+  uint32_t tickstart = HAL_GetTick();
+
+  while (HAL_RCCEx_GetClockReady(Clocks) != Clocks)
+  {
+    if ((HAL_GetTick() - tickstart) > Timeout)
+    {
+      /* New check to avoid false timeout detection in case of preemption */
+      if (HAL_RCCEx_GetClockReady(Clocks) != Clocks)
+      {
+        return HAL_TIMEOUT;
+      }
+    }
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @}
+  */
+
+/** @defgroup RCCEx_Exported_Functions_Group5 Extended Performance Level functions
+ *  @brief  Extended Performance Level functions
+ *
+@verbatim
+ ===============================================================================
+                ##### Extended Performance Level functions #####
+ ===============================================================================
+    [..]
+      The regulator voltage scale, the FLASH latency and the system clock must be
+      changed in a given order: the voltage is raised before the frequency and
+      lowered after it, the latency is increased before the frequency and decreased
+      after it, and PLL1 can only be reconfigured while it is not the system clock.
+      These functions apply this order to switch between operating points.
+
+    [..]
+      (+) HAL_RCCEx_SetOperatingPoint() switches to any operating point described by
+          an RCC_OperatingPointTypeDef structure, with the system clock on HSI or
+          on PLL1 clocked by HSI. As for HAL_RCC_ClockConfig(), the FLASH latency
+          is given by the operating point.
+
+      (+) HAL_RCCEx_SetPerformanceLevel() switches to one of the predefined operating
+          points of @ref RCCEx_Performance_Level, from HSI 64 MHz in voltage scale 3
+          up to 400 MHz in scale 1, or 280 MHz in scale 0 on STM32H7Axxx/B0xxx/B3xxx.
+
+      (+) HAL_RCCEx_PerformanceGovernor() is to be called periodically with the CPU
+          load, for instance measured from the idle time. It selects the next level
+          up above RCC_PERF_LOAD_HIGH and the next level down below RCC_PERF_LOAD_LOW.
+
+      (+) HAL_RCCEx_PerformanceLevelCallback() is called after each level change, so
+          that the application can update the peripherals depending on the bus clocks.
+
+    [..]
+      (@) When the system clock is on PLL1, the Q and R outputs of PLL1 also change
+          with an operating point change: check the kernel clocks derived from them
+          before using these functions.
+      (@) PLL1 shares its clock source with PLL2 and PLL3: an operating point on
+          PLL1 is rejected when PLL2 or PLL3 runs from another source than HSI.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Switch the regulator voltage scale, the FLASH latency and the system
+  *         clock to an operating point, in the order required by the device.
+  * @note   The voltage scale is raised first when the target one is higher: the
+  *         system clock is then switched with HAL_RCC_ClockConfig(), which sets the
+  *         FLASH latency before a frequency increase and after a decrease, and the
+  *         voltage scale is lowered last when the target one is lower.
+  * @note   When PLL1 is the system clock before the change, the system clock is
+  *         moved to HSI while PLL1 is reconfigured. PLL1 is kept running when the
+  *         target clock is HSI only if its Q or R outputs are enabled.
+  * @param  pOperatingPoint  pointer to an RCC_OperatingPointTypeDef structure.
+  * @retval HAL status: HAL_ERROR if the CPU clock exceeds the maximum of the
+  *         voltage scale.
+  */
+HAL_StatusTypeDef HAL_RCCEx_SetOperatingPoint(const RCC_OperatingPointTypeDef *pOperatingPoint)
+{
+  RCC_ClkInitTypeDef clkinit;
+  uint32_t hsiclk, sysclk, pllref, maxclk, vos, tickstart;
+  HAL_StatusTypeDef status;
+
+  if (pOperatingPoint == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  assert_param(IS_PWR_REGULATOR_VOLTAGE(pOperatingPoint->VoltageScaling));
+  assert_param(IS_FLASH_LATENCY(pOperatingPoint->FLatency));
+
+  /* Check the CPU clock against the maximum of the voltage scale */
+  hsiclk = HSI_VALUE >> (__HAL_RCC_GET_HSI_DIVIDER() >> RCC_CR_HSIDIV_Pos);
+  sysclk = hsiclk;
+  pllref = 0U;
+  if (pOperatingPoint->SYSCLKSource == RCC_SYSCLKSOURCE_PLLCLK)
+  {
+    assert_param(IS_RCC_PLLM_VALUE(pOperatingPoint->PLLM));
+    assert_param(IS_RCC_PLLN_VALUE(pOperatingPoint->PLLN));
+    assert_param(IS_RCC_PLLP_VALUE(pOperatingPoint->PLLP));
+    pllref = hsiclk / pOperatingPoint->PLLM;
+    sysclk = (pllref * pOperatingPoint->PLLN) / pOperatingPoint->PLLP;
+
+    /* PLL1 source is shared with PLL2 and PLL3 */
+    if ((__HAL_RCC_GET_PLL_OSCSOURCE() != RCC_PLLSOURCE_HSI) &&
+        (READ_BIT(RCC->CR, RCC_CR_PLL2ON | RCC_CR_PLL3ON) != 0U))
+    {
+      return HAL_ERROR;
+    }
+  }
+  else if (pOperatingPoint->SYSCLKSource != RCC_SYSCLKSOURCE_HSI)
+  {
+    return HAL_ERROR;
+  }
+  else
+  {
+    /* Nothing to check on HSI */
+  }
+
+#if defined(RCC_D1CFGR_D1CPRE)
+  sysclk >>= (D1CorePrescTable[(pOperatingPoint->SYSCLKDivider & RCC_D1CFGR_D1CPRE) >> RCC_D1CFGR_D1CPRE_Pos] & 0x1FU);
+#else
+  sysclk >>= (D1CorePrescTable[(pOperatingPoint->SYSCLKDivider & RCC_CDCFGR1_CDCPRE) >> RCC_CDCFGR1_CDCPRE_Pos] & 0x1FU);
+#endif /* RCC_D1CFGR_D1CPRE */
+
+  switch (RCCEx_VoltageRank(pOperatingPoint->VoltageScaling))
+  {
+    case 0U:
+      maxclk = RCC_VOS3_SYSCLK_MAX;
+      break;
+    case 1U:
+      maxclk = RCC_VOS2_SYSCLK_MAX;
+      break;
+    case 2U:
+      maxclk = RCC_VOS1_SYSCLK_MAX;
+      break;
+    default:
+      maxclk = RCC_VOS0_SYSCLK_MAX;
+      break;
+  }
+  if (sysclk > maxclk)
+  {
+    return HAL_ERROR;
+  }
+
+  vos = HAL_PWREx_GetVoltageRange();
+
+  /* 1. Raise the voltage scale before the frequency */
+  status = HAL_OK;
+  if (RCCEx_VoltageRank(pOperatingPoint->VoltageScaling) > RCCEx_VoltageRank(vos))
+  {
+    status = HAL_PWREx_ControlVoltageScaling(pOperatingPoint->VoltageScaling);
+    vos = pOperatingPoint->VoltageScaling;
+  }
+
+  /* 2. HSI must be running: it clocks the system during the PLL1 reconfiguration */
+  if ((status == HAL_OK) && (READ_BIT(RCC->CR, RCC_CR_HSIRDY) == 0U))
+  {
+    __HAL_RCC_HSI_ENABLE();
+    tickstart = HAL_GetTick();
+    while (READ_BIT(RCC->CR, RCC_CR_HSIRDY) == 0U)
+    {
+      if ((HAL_GetTick() - tickstart) > HSI_TIMEOUT_VALUE)
+      {
+        status = HAL_TIMEOUT;
+        break;
+      }
+    }
+  }
+
+  /* 3. Move the system clock off PLL1, the current FLASH latency covers HSI */
+  if ((status == HAL_OK) && (__HAL_RCC_GET_SYSCLK_SOURCE() == RCC_SYSCLKSOURCE_STATUS_PLLCLK))
+  {
+    clkinit.ClockType = RCC_CLOCKTYPE_SYSCLK;
+    clkinit.SYSCLKSource = RCC_SYSCLKSOURCE_HSI;
+    status = HAL_RCC_ClockConfig(&clkinit, __HAL_FLASH_GET_LATENCY());
+  }
+
+  /* 4. PLL1 from HSI, reconfigured while it is stopped */
+  if ((status == HAL_OK) &&
+      ((pOperatingPoint->SYSCLKSource == RCC_SYSCLKSOURCE_PLLCLK) ||
+       (READ_BIT(RCC->PLLCFGR, RCC_PLLCFGR_DIVQ1EN | RCC_PLLCFGR_DIVR1EN) == 0U)))
+  {
+    __HAL_RCC_PLL_DISABLE();
+    tickstart = HAL_GetTick();
+    while (READ_BIT(RCC->CR, RCC_CR_PLL1RDY) != 0U)
+    {
+      if ((HAL_GetTick() - tickstart) > PLL_TIMEOUT_VALUE)
+      {
+        status = HAL_TIMEOUT;
+        break;
+      }
+    }
+    RCC_CLOCK_CACHE_INVALIDATE();
+
+    if ((status == HAL_OK) && (pOperatingPoint->SYSCLKSource == RCC_SYSCLKSOURCE_PLLCLK))
+    {
+      MODIFY_REG(RCC->PLLCKSELR, (RCC_PLLCKSELR_PLLSRC | RCC_PLLCKSELR_DIVM1),
+                 (RCC_PLLSOURCE_HSI | (pOperatingPoint->PLLM << RCC_PLLCKSELR_DIVM1_Pos)));
+      MODIFY_REG(RCC->PLL1DIVR, (RCC_PLL1DIVR_N1 | RCC_PLL1DIVR_P1),
+                 (((pOperatingPoint->PLLN - 1U) << RCC_PLL1DIVR_N1_Pos) |
+                  ((pOperatingPoint->PLLP - 1U) << RCC_PLL1DIVR_P1_Pos)));
+
+      /* Input range from the reference clock, medium VCO below 2 MHz */
+      if (pllref < 2000000U)
+      {
+        __HAL_RCC_PLL_VCIRANGE(RCC_PLL1VCIRANGE_0);
+        __HAL_RCC_PLL_VCORANGE(RCC_PLL1VCOMEDIUM);
+      }
+      else
+      {
+        __HAL_RCC_PLL_VCIRANGE((pllref < 4000000U) ? RCC_PLL1VCIRANGE_1 :
+                               ((pllref < 8000000U) ? RCC_PLL1VCIRANGE_2 : RCC_PLL1VCIRANGE_3));
+        __HAL_RCC_PLL_VCORANGE(RCC_PLL1VCOWIDE);
+      }
+      __HAL_RCC_PLLFRACN_DISABLE();
+      __HAL_RCC_PLLCLKOUT_ENABLE(RCC_PLL1_DIVP);
+      __HAL_RCC_PLL_ENABLE();
+
+      tickstart = HAL_GetTick();
+      while (READ_BIT(RCC->CR, RCC_CR_PLL1RDY) == 0U)
+      {
+        if ((HAL_GetTick() - tickstart) > PLL_TIMEOUT_VALUE)
+        {
+          status = HAL_TIMEOUT;
+          break;
+        }
+      }
+    }
+  }
+
+  /* 5. System clock and bus prescalers, with the FLASH latency of the operating point */
+  if (status == HAL_OK)
+  {
+    clkinit.ClockType = RCC_CLOCKTYPE_SYSCLK | RCC_CLOCKTYPE_HCLK | RCC_CLOCKTYPE_D1PCLK1 |
+                        RCC_CLOCKTYPE_PCLK1 | RCC_CLOCKTYPE_PCLK2 | RCC_CLOCKTYPE_D3PCLK1;
+    clkinit.SYSCLKSource = pOperatingPoint->SYSCLKSource;
+    clkinit.SYSCLKDivider = pOperatingPoint->SYSCLKDivider;
+    clkinit.AHBCLKDivider = pOperatingPoint->AHBCLKDivider;
+    clkinit.APB3CLKDivider = pOperatingPoint->APB3CLKDivider;
+    clkinit.APB1CLKDivider = pOperatingPoint->APB1CLKDivider;
+    clkinit.APB2CLKDivider = pOperatingPoint->APB2CLKDivider;
+    clkinit.APB4CLKDivider = pOperatingPoint->APB4CLKDivider;
+    status = HAL_RCC_ClockConfig(&clkinit, pOperatingPoint->FLatency);
+  }
+
+  /* 6. Lower the voltage scale after the frequency */
+  if ((status == HAL_OK) && (RCCEx_VoltageRank(pOperatingPoint->VoltageScaling) < RCCEx_VoltageRank(vos)))
+  {
+    status = HAL_PWREx_ControlVoltageScaling(pOperatingPoint->VoltageScaling);
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Switch to a predefined performance level.
+  * @param  Level  performance level.
+  *         This parameter can be a value of @ref RCCEx_Performance_Level.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_RCCEx_SetPerformanceLevel(uint32_t Level)
+{
+  HAL_StatusTypeDef status;
+
+  if (Level > RCC_PERF_LEVEL_MAX)
+  {
+    return HAL_ERROR;
+  }
+
+  if (Level == RCCEx_PerfLevel)
+  {
+    return HAL_OK;
+  }
+
+  status = HAL_RCCEx_SetOperatingPoint(&RCCEx_PerfLevelTable[Level]);
+  if (status == HAL_OK)
+  {
+    RCCEx_PerfLevel = Level;
+    HAL_RCCEx_PerformanceLevelCallback(Level);
+  }
+  else
+  {
+    /* The clock tree may be in an intermediate state */
+    RCCEx_PerfLevel = 0xFFFFFFFFU;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Return the performance level selected by HAL_RCCEx_SetPerformanceLevel().
+  * @retval Performance level, a value of @ref RCCEx_Performance_Level, or 0xFFFFFFFF
+  *         if no level has been selected or the last change failed.
+  */
+uint32_t HAL_RCCEx_GetPerformanceLevel(void)
+{
+  return RCCEx_PerfLevel;
+}
+
+/**
+  * @brief  Select the performance level from the CPU load.
+  * @note   One level is changed per call, to the next level up above RCC_PERF_LOAD_HIGH
+  *         and to the next level down below RCC_PERF_LOAD_LOW. When no level has been
+  *         selected yet, the highest level is selected.
+  * @param  LoadPercent  CPU load over the last period, from 0 to 100.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_RCCEx_PerformanceGovernor(uint32_t LoadPercent)
+{
+  uint32_t level = RCCEx_PerfLevel;
+
+  if (level > RCC_PERF_LEVEL_MAX)
+  {
+    level = RCC_PERF_LEVEL_MAX;
+  }
+  else if ((LoadPercent > RCC_PERF_LOAD_HIGH) && (level < RCC_PERF_LEVEL_MAX))
+  {
+    level++;
+  }
+  else if ((LoadPercent < RCC_PERF_LOAD_LOW) && (level > RCC_PERF_LEVEL_0))
+  {
+    level--;
+  }
+  else
+  {
+    /* Keep the current level */
+  }
+
+  return HAL_RCCEx_SetPerformanceLevel(level);
+}
+
+/**
+  * @brief  Performance level changed callback.
+  * @param  Level  new performance level, a value of @ref RCCEx_Performance_Level.
+  * @retval None
+  */
+__weak void HAL_RCCEx_PerformanceLevelCallback(uint32_t Level)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(Level);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the @ref HAL_RCCEx_PerformanceLevelCallback should be implemented in the user file
+   */
+}
+
 /**
   * @}
   */
@@ -3681,6 +4367,35 @@ __weak void HAL_RCCEx_CRS_ErrorCallback(uint32_t Error)
 /** @defgroup RCCEx_Private_functions RCCEx Private Functions
  * @{
  */
+/**
+  * @brief  Rank a voltage scale by performance.
+  * @param  VoltageScaling  a value of @ref PWR_Regulator_Voltage_Scale.
+  * @retval 0 for scale 3, 1 for scale 2, 2 for scale 1 and 3 for scale 0
+  */
+static uint32_t RCCEx_VoltageRank(uint32_t VoltageScaling)
+{
+  uint32_t rank;
+
+  if (VoltageScaling == PWR_REGULATOR_VOLTAGE_SCALE3)
+  {
+    rank = 0U;
+  }
+  else if (VoltageScaling == PWR_REGULATOR_VOLTAGE_SCALE2)
+  {
+    rank = 1U;
+  }
+  else if (VoltageScaling == PWR_REGULATOR_VOLTAGE_SCALE1)
+  {
+    rank = 2U;
+  }
+  else
+  {
+    rank = 3U;
+  }
+
+  return rank;
+}
+
 /**
   * @brief  Configure the PLL2 VCI,VCO ranges, multiplication and division factors and enable it
   * @param  pll2: Pointer to an RCC_PLL2InitTypeDef structure that
@@ -3695,6 +4410,9 @@ static HAL_StatusTypeDef RCCEx_PLL2_Config(RCC_PLL2InitTypeDef *pll2, uint32_t D
 
   uint32_t tickstart;
   HAL_StatusTypeDef status = HAL_OK;
+
+  RCC_CLOCK_CACHE_INVALIDATE();
+
   assert_param(IS_RCC_PLL2M_VALUE(pll2->PLL2M));
   assert_param(IS_RCC_PLL2N_VALUE(pll2->PLL2N));
   assert_param(IS_RCC_PLL2P_VALUE(pll2->PLL2P));
@@ -3710,6 +4428,19 @@ static HAL_StatusTypeDef RCCEx_PLL2_Config(RCC_PLL2InitTypeDef *pll2, uint32_t D
     return HAL_ERROR;
   }
 
+  /* PLL2 already started with these parameters: only wait for its lock */
+  else if (RCCEx_PLL2_IsStarted(pll2, Divider) != 0U)
+  {
+    tickstart = HAL_GetTick();
+
+    while (__HAL_RCC_GET_FLAG(RCC_FLAG_PLL2RDY) == 0U)
+    {
+      if ((HAL_GetTick() - tickstart) > PLL2_TIMEOUT_VALUE)
+      {
+        return HAL_TIMEOUT;
+      }
+    }
+  }
 
   else
   {
@@ -3799,6 +4530,9 @@ static HAL_StatusTypeDef RCCEx_PLL3_Config(RCC_PLL3InitTypeDef *pll3, uint32_t D
 {
   uint32_t tickstart;
   HAL_StatusTypeDef status = HAL_OK;
+
+  RCC_CLOCK_CACHE_INVALIDATE();
+
   assert_param(IS_RCC_PLL3M_VALUE(pll3->PLL3M));
   assert_param(IS_RCC_PLL3N_VALUE(pll3->PLL3N));
   assert_param(IS_RCC_PLL3P_VALUE(pll3->PLL3P));
@@ -3814,6 +4548,20 @@ static HAL_StatusTypeDef RCCEx_PLL3_Config(RCC_PLL3InitTypeDef *pll3, uint32_t D
     return HAL_ERROR;
   }
 
+  /* PLL3 already started with these parameters: only wait for its lock */
+  else if (RCCEx_PLL3_IsStarted(pll3, Divider) != 0U)
+  {
+    tickstart = HAL_GetTick();
+
+    while (__HAL_RCC_GET_FLAG(RCC_FLAG_PLL3RDY) == 0U)
+    {
+      if ((HAL_GetTick() - tickstart) > PLL3_TIMEOUT_VALUE)
+      {
+        return HAL_TIMEOUT;
+      }
+    }
+  }
+
 
   else
   {
@@ -3888,6 +4636,84 @@ static HAL_StatusTypeDef RCCEx_PLL3_Config(RCC_PLL3InitTypeDef *pll3, uint32_t D
   return status;
 }
 
+/**
+  * @brief  Check whether PLL2 runs with the given parameters and output.
+  * @param  pll2: Pointer to an RCC_PLL2InitTypeDef structure.
+  * @param  Divider  divider output to be used
+  * @retval 1 when PLL2 is on with the same parameters and the output enabled, 0 otherwise
+  */
+static uint32_t RCCEx_PLL2_IsStarted(const RCC_PLL2InitTypeDef *pll2, uint32_t Divider)
+{
+  uint32_t output;
+  uint32_t divr = ((pll2->PLL2N - 1U) & RCC_PLL2DIVR_N2) | (((pll2->PLL2P - 1U) << 9U) & RCC_PLL2DIVR_P2) |
+                  (((pll2->PLL2Q - 1U) << 16U) & RCC_PLL2DIVR_Q2) | (((pll2->PLL2R - 1U) << 24U) & RCC_PLL2DIVR_R2);
+  uint32_t cfgmask;
+
+  if (Divider == DIVIDER_P_UPDATE)
+  {
+    output = RCC_PLL2_DIVP;
+  }
+  else if (Divider == DIVIDER_Q_UPDATE)
+  {
+    output = RCC_PLL2_DIVQ;
+  }
+  else
+  {
+    output = RCC_PLL2_DIVR;
+  }
+  cfgmask = RCC_PLLCFGR_PLL2RGE | RCC_PLLCFGR_PLL2VCOSEL | RCC_PLLCFGR_PLL2FRACEN | output;
+
+  if ((READ_BIT(RCC->CR, RCC_CR_PLL2ON) != 0U) &&
+      (READ_BIT(RCC->PLLCKSELR, RCC_PLLCKSELR_DIVM2) == (pll2->PLL2M << 12U)) &&
+      (READ_REG(RCC->PLL2DIVR) == divr) &&
+      (READ_BIT(RCC->PLLCFGR, cfgmask) == (pll2->PLL2RGE | pll2->PLL2VCOSEL | RCC_PLLCFGR_PLL2FRACEN | output)) &&
+      (READ_BIT(RCC->PLL2FRACR, RCC_PLL2FRACR_FRACN2) == (pll2->PLL2FRACN << RCC_PLL2FRACR_FRACN2_Pos)))
+  {
+    return 1U;
+  }
+
+  return 0U;
+}
+
+/**
+  * @brief  Check whether PLL3 runs with the given parameters and output.
+  * @param  pll3: Pointer to an RCC_PLL3InitTypeDef structure.
+  * @param  Divider  divider output to be used
+  * @retval 1 when PLL3 is on with the same parameters and the output enabled, 0 otherwise
+  */
+static uint32_t RCCEx_PLL3_IsStarted(const RCC_PLL3InitTypeDef *pll3, uint32_t Divider)
+{
+  uint32_t output;
+  uint32_t divr = ((pll3->PLL3N - 1U) & RCC_PLL3DIVR_N3) | (((pll3->PLL3P - 1U) << 9U) & RCC_PLL3DIVR_P3) |
+                  (((pll3->PLL3Q - 1U) << 16U) & RCC_PLL3DIVR_Q3) | (((pll3->PLL3R - 1U) << 24U) & RCC_PLL3DIVR_R3);
+  uint32_t cfgmask;
+
+  if (Divider == DIVIDER_P_UPDATE)
+  {
+    output = RCC_PLL3_DIVP;
+  }
+  else if (Divider == DIVIDER_Q_UPDATE)
+  {
+    output = RCC_PLL3_DIVQ;
+  }
+  else
+  {
+    output = RCC_PLL3_DIVR;
+  }
+  cfgmask = RCC_PLLCFGR_PLL3RGE | RCC_PLLCFGR_PLL3VCOSEL | RCC_PLLCFGR_PLL3FRACEN | output;
+
+  if ((READ_BIT(RCC->CR, RCC_CR_PLL3ON) != 0U) &&
+      (READ_BIT(RCC->PLLCKSELR, RCC_PLLCKSELR_DIVM3) == (pll3->PLL3M << 20U)) &&
+      (READ_REG(RCC->PLL3DIVR) == divr) &&
+      (READ_BIT(RCC->PLLCFGR, cfgmask) == (pll3->PLL3RGE | pll3->PLL3VCOSEL | RCC_PLLCFGR_PLL3FRACEN | output)) &&
+      (READ_BIT(RCC->PLL3FRACR, RCC_PLL3FRACR_FRACN3) == (pll3->PLL3FRACN << RCC_PLL3FRACR_FRACN3_Pos)))
+  {
+    return 1U;
+  }
+
+  return 0U;
+}
+
 /**
   * @brief Handle the RCC LSE Clock Security System interrupt request.
   * @retval None
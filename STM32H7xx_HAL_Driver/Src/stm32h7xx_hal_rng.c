@@ -34,6 +34,21 @@
           random data using (polling/interrupt) mode.
       (#) Get the 32 bit random number using HAL_RNG_GenerateRandomNumber() function.
 
+    *** Entropy pool ***
+    ====================
+    [..]
+      (#) Start the background refill of a word buffer with HAL_RNG_PoolStart(). The
+          RNG interrupt fills the pool without DMA and is disabled while the pool is full.
+      (#) Get any number of random bytes with HAL_RNG_PoolRead(). Bytes are copied from
+          the pool, the call only waits for the RNG when the pool is empty.
+      (#) Each word read from DR goes through a repetition count test: a word equal to
+          the previous one is rejected and counted in RepetitionCount.
+      (#) Seed errors are recovered in the interrupt and the data generated before the
+          recovery are discarded. The pool is stopped (HAL_RNG_STATE_ERROR) only when
+          the recovery fails.
+      (#) Stop the refill with HAL_RNG_PoolStop(). HAL_RNG_GenerateRandomNumber() and
+          HAL_RNG_GenerateRandomNumber_IT() return an error while the pool is running.
+
     ##### Callback registration #####
     ==================================
 
@@ -134,6 +149,7 @@
   */
 /* Private macros ------------------------------------------------------------*/
 /* Private functions prototypes ----------------------------------------------*/
+static void RNG_PoolIRQHandler(RNG_HandleTypeDef *hrng);
 /* Exported functions --------------------------------------------------------*/
 
 /** @addtogroup RNG_Exported_Functions
@@ -278,6 +294,9 @@ HAL_StatusTypeDef HAL_RNG_Init(RNG_HandleTypeDef *hrng)
   /* Initialise the error code */
   hrng->ErrorCode = HAL_RNG_ERROR_NONE;
 
+  /* No entropy pool */
+  hrng->pPool = NULL;
+
   /* Return function status */
   return HAL_OK;
 }
@@ -793,6 +812,13 @@ void HAL_RNG_IRQHandler(RNG_HandleTypeDef *hrng)
 {
   uint32_t rngclockerror = 0U;
 
+  /* Entropy pool refill */
+  if (hrng->pPool != NULL)
+  {
+    RNG_PoolIRQHandler(hrng);
+    return;
+  }
+
   /* RNG clock error interrupt occurred */
   if (__HAL_RNG_GET_IT(hrng, RNG_IT_CEI) != RESET)
   {
@@ -961,6 +987,306 @@ uint32_t HAL_RNG_GetError(RNG_HandleTypeDef *hrng)
   * @}
   */
 
+/** @addtogroup RNG_Exported_Functions_Group4
+  *  @brief   Entropy pool functions
+  *
+@verbatim
+ ===============================================================================
+                      ##### Entropy pool functions #####
+ ===============================================================================
+    [..]  This section provides functions allowing to:
+      (+) Start and stop the refill of an entropy pool by the RNG interrupt
+      (+) Read any number of random bytes from the pool
+      (+) Get the number of random bytes available in the pool
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Start the refill of an entropy pool by the RNG interrupt.
+  * @note   The NVIC RNG interrupt must be enabled and HAL_RNG_IRQHandler() called
+  *         from RNG_IRQHandler(). The RNG interrupt is disabled while the pool is
+  *         full and enabled again by HAL_RNG_PoolRead().
+  * @param  hrng pointer to a RNG_HandleTypeDef structure that contains
+  *                the configuration information for RNG.
+  * @param  pPool pointer to the pool structure, kept until HAL_RNG_PoolStop().
+  * @param  pBuffer pointer to the pool storage.
+  * @param  Size pool size in 32-bit words, must be a power of 2.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_RNG_PoolStart(RNG_HandleTypeDef *hrng, RNG_PoolTypeDef *pPool, uint32_t *pBuffer,
+                                    uint32_t Size)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+
+  if ((pPool == NULL) || (pBuffer == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the parameters */
+  assert_param(IS_RNG_POOL_SIZE(Size));
+
+  /* Process Locked */
+  __HAL_LOCK(hrng);
+
+  /* Check RNG peripheral state */
+  if (hrng->State == HAL_RNG_STATE_READY)
+  {
+    /* The pool owns the RNG until HAL_RNG_PoolStop() */
+    hrng->State = HAL_RNG_STATE_BUSY;
+    hrng->ErrorCode = HAL_RNG_ERROR_NONE;
+
+    pPool->pBuffer         = pBuffer;
+    pPool->Size            = Size;
+    pPool->Head            = 0U;
+    pPool->Tail            = 0U;
+    pPool->LastWord        = 0U;
+    pPool->RepetitionCount = 0U;
+    pPool->SeedErrorCount  = 0U;
+    hrng->pPool            = pPool;
+
+    /* Enable the RNG Interrupts: Data Ready, Clock error, Seed error */
+    __HAL_RNG_ENABLE_IT(hrng);
+  }
+  else
+  {
+    hrng->ErrorCode = HAL_RNG_ERROR_BUSY;
+    status = HAL_ERROR;
+  }
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(hrng);
+
+  return status;
+}
+
+/**
+  * @brief  Stop the refill of the entropy pool.
+  * @note   The random bytes left in the pool are lost.
+  * @param  hrng pointer to a RNG_HandleTypeDef structure that contains
+  *                the configuration information for RNG.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_RNG_PoolStop(RNG_HandleTypeDef *hrng)
+{
+  if (hrng->pPool == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Process Locked */
+  __HAL_LOCK(hrng);
+
+  /* Disable the RNG Interrupts before releasing the pool */
+  __HAL_RNG_DISABLE_IT(hrng);
+  hrng->pPool = NULL;
+
+  hrng->State = HAL_RNG_STATE_READY;
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(hrng);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Read random bytes from the entropy pool.
+  * @note   Bytes are copied from the pool words, the bytes of a word not fully
+  *         used by the request are discarded and never returned twice.
+  * @note   The function only waits for the RNG when the pool is empty. With a
+  *         Timeout of 0, the function returns an error when the pool does not
+  *         hold Size bytes, use HAL_RNG_PoolGetLevel() before the call.
+  * @note   This function must be called from a single context, it must not be
+  *         called from the RNG interrupt.
+  * @param  hrng pointer to a RNG_HandleTypeDef structure that contains
+  *                the configuration information for RNG.
+  * @param  pData pointer to the destination buffer.
+  * @param  Size number of bytes to read.
+  * @param  Timeout maximum time in ms to wait for the RNG when the pool is empty.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_RNG_PoolRead(RNG_HandleTypeDef *hrng, uint8_t *pData, uint32_t Size, uint32_t Timeout)
+{
+  RNG_PoolTypeDef *pool = hrng->pPool;
+  uint8_t *pdata = pData;
+  uint32_t remaining = Size;
+  uint32_t random32bit;
+  uint32_t count;
+  uint32_t index;
+  uint32_t tickstart;
+
+  if ((pool == NULL) || (pData == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Get tick */
+  tickstart = HAL_GetTick();
+
+  while (remaining > 0U)
+  {
+    /* The pool is stopped when a seed error cannot be recovered */
+    if (hrng->State == HAL_RNG_STATE_ERROR)
+    {
+      return HAL_ERROR;
+    }
+
+    if (pool->Head == pool->Tail)
+    {
+      if (((HAL_GetTick() - tickstart) > Timeout) || (Timeout == 0U))
+      {
+        hrng->ErrorCode |= HAL_RNG_ERROR_TIMEOUT;
+        return HAL_ERROR;
+      }
+    }
+    else
+    {
+      /* Read the word after the Head update, release it before the Tail update */
+      __DMB();
+      random32bit = pool->pBuffer[pool->Tail & (pool->Size - 1U)];
+      __DMB();
+      pool->Tail++;
+
+      /* Room available: restart the refill */
+      __HAL_RNG_ENABLE_IT(hrng);
+
+      count = (remaining < 4U) ? remaining : 4U;
+      for (index = 0U; index < count; index++)
+      {
+        *pdata = (uint8_t)(random32bit >> (8U * index));
+        pdata++;
+      }
+      remaining -= count;
+    }
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Return the number of random bytes available in the entropy pool.
+  * @param  hrng pointer to a RNG_HandleTypeDef structure that contains
+  *                the configuration information for RNG.
+  * @retval Number of bytes, 0 when no pool is running
+  */
+uint32_t HAL_RNG_PoolGetLevel(RNG_HandleTypeDef *hrng)
+{
+  RNG_PoolTypeDef *pool = hrng->pPool;
+
+  if (pool == NULL)
+  {
+    return 0U;
+  }
+
+  return (pool->Head - pool->Tail) * 4U;
+}
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/* Private functions ---------------------------------------------------------*/
+/** @addtogroup RNG_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Handle the RNG interrupt while an entropy pool is running.
+  * @note   Words are read from DR as long as DRDY is set and the pool is not full,
+  *         the interrupt is disabled when the pool is full.
+  * @note   A clock error is reported through HAL_RNG_ErrorCallback() and the refill
+  *         goes on when the clock is back. A seed error is recovered, the pool is
+  *         stopped with HAL_RNG_STATE_ERROR only when the recovery fails.
+  * @param  hrng pointer to a RNG_HandleTypeDef structure.
+  * @retval None
+  */
+static void RNG_PoolIRQHandler(RNG_HandleTypeDef *hrng)
+{
+  RNG_PoolTypeDef *pool = hrng->pPool;
+  uint32_t random32bit;
+  uint32_t head;
+
+  /* RNG clock error interrupt occurred */
+  if (__HAL_RNG_GET_IT(hrng, RNG_IT_CEI) != RESET)
+  {
+    hrng->ErrorCode |= HAL_RNG_ERROR_CLOCK;
+
+    /* Clear the clock error flag */
+    __HAL_RNG_CLEAR_IT(hrng, RNG_IT_CEI);
+
+#if (USE_HAL_RNG_REGISTER_CALLBACKS == 1)
+    /* Call registered Error callback */
+    hrng->ErrorCallback(hrng);
+#else
+    /* Call legacy weak Error callback */
+    HAL_RNG_ErrorCallback(hrng);
+#endif /* USE_HAL_RNG_REGISTER_CALLBACKS */
+  }
+
+  /* RNG seed error interrupt occurred: the data in DR must not be used */
+  if (__HAL_RNG_GET_IT(hrng, RNG_IT_SEI) != RESET)
+  {
+    pool->SeedErrorCount++;
+
+#if defined(RNG_CR_CONDRST)
+    if (RNG_RecoverSeedError(hrng) != HAL_OK)
+    {
+      /* Recovery failed: stop the refill, the error callback has been called */
+      __HAL_RNG_DISABLE_IT(hrng);
+      hrng->State = HAL_RNG_STATE_ERROR;
+    }
+#else
+    /* Clear bit SEIS then restart the RNG to reinitialize the entropy source */
+    __HAL_RNG_CLEAR_IT(hrng, RNG_IT_SEI);
+    __HAL_RNG_DISABLE(hrng);
+    __HAL_RNG_ENABLE(hrng);
+#endif /* RNG_CR_CONDRST */
+
+    /* Wait for the data generated after the recovery */
+    return;
+  }
+
+  head = pool->Head;
+  while ((__HAL_RNG_GET_FLAG(hrng, RNG_FLAG_DRDY) != RESET) && ((head - pool->Tail) < pool->Size))
+  {
+    random32bit = hrng->Instance->DR;
+
+    /* A seed error raised meanwhile is handled on the next interrupt */
+    if (__HAL_RNG_GET_IT(hrng, RNG_IT_SEI) != RESET)
+    {
+      break;
+    }
+
+    /* Repetition count test: a word equal to the previous one is rejected */
+    if (random32bit == pool->LastWord)
+    {
+      pool->RepetitionCount++;
+      hrng->ErrorCode |= HAL_RNG_ERROR_REPETITION;
+    }
+    else
+    {
+      pool->pBuffer[head & (pool->Size - 1U)] = random32bit;
+      head++;
+    }
+    pool->LastWord = random32bit;
+  }
+
+  /* Publish the words once they are written */
+  __DMB();
+  pool->Head = head;
+
+  if ((head - pool->Tail) >= pool->Size)
+  {
+    /* Pool full: stop the refill until HAL_RNG_PoolRead() */
+    __HAL_RNG_DISABLE_IT(hrng);
+  }
+}
+
 /**
   * @}
   */
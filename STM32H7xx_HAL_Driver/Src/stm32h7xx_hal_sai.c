@@ -124,6 +124,47 @@
       (+) Pause the DMA Transfer using HAL_SAI_DMAPause()
       (+) Resume the DMA Transfer using HAL_SAI_DMAResume()
       (+) Stop the DMA Transfer using HAL_SAI_DMAStop()
+      (+) Receive continuously in two buffers (DMA double buffer mode) using
+          HAL_SAI_ReceiveDoubleBuffer_DMA()
+      (+) At reception end of each buffer HAL_SAI_RxM0CpltCallback() or HAL_SAI_RxM1CpltCallback()
+          is executed and user can process the filled buffer, or replace the idle buffer
+          using HAL_DMAEx_ChangeMemory(); the reception is stopped using HAL_SAI_DMAStop()
+
+    *** TDM streaming ***
+    =====================
+    [..]
+      (+) Configure each block with HAL_SAI_InitTDM(): the number of slots,
+          the active slots and the data size. For full-duplex, one block is
+          master and the other one is configured as synchronous slave.
+      (+) Start both directions on circular DMA with HAL_SAI_TDM_Start_DMA().
+          The slave block is started first, so that both buffers begin on the
+          same frame. The half and complete callbacks of each block delimit
+          the two halves of its buffer (double buffering).
+      (+) HAL_SAI_TDM_GetSlotView() describes where the samples of one slot lie
+          in an interleaved buffer (or half buffer). They are accessed in place
+          with __HAL_SAI_GET_SLOT_SAMPLE().
+      (+) HAL_SAI_TDM_DeinterleaveSlot_MDMA() and HAL_SAI_TDM_InterleaveSlot_MDMA()
+          let the MDMA copy the samples of a slot from or to a contiguous
+          buffer, using its block repeat address offsets.
+      (+) Stop the stream with HAL_SAI_TDM_Stop_DMA().
+
+    *** PDM capture ***
+    ===================
+    [..]
+      (+) Configure the block in receive mode with the PDM interface enabled,
+          an 8-bit data size and one slot per microphone, its DMA being in
+          circular mode with a byte width on both sides.
+      (+) Fill a SAI_PDMCaptureTypeDef structure: number of microphones,
+          decimation ratio, samples per frame and the PDM and PCM buffers,
+          then start the capture with HAL_SAI_PDMCapture_Start().
+      (+) On each half of the PDM buffer, a 4th order CIC filter converts
+          every microphone to 16-bit PCM, eight bits at a time, and
+          HAL_SAI_PDMCapture_FrameCallback() is executed: pFrame points to
+          the interleaved samples of the frame.
+      (+) The CIC droop is not compensated; apply a FIR on the PCM frames when
+          a flat passband is needed. DFSDM microphone arrays are served by the
+          DFSDM driver instead.
+      (+) Stop the capture with HAL_SAI_PDMCapture_Stop().
 
     *** SAI HAL driver additional function list ***
     ===============================================
@@ -163,6 +204,8 @@
       (+) RxHalfCpltCallback : SAI receive half complete.
       (+) TxCpltCallback     : SAI transmit complete.
       (+) TxHalfCpltCallback : SAI transmit half complete.
+      (+) RxM0CpltCallback   : SAI receive memory 0 complete.
+      (+) RxM1CpltCallback   : SAI receive memory 1 complete.
       (+) ErrorCallback      : SAI error.
       (+) MspInitCallback    : SAI MspInit.
       (+) MspDeInitCallback  : SAI MspDeInit.
@@ -181,6 +224,8 @@
       (+) RxHalfCpltCallback : SAI receive half complete.
       (+) TxCpltCallback     : SAI transmit complete.
       (+) TxHalfCpltCallback : SAI transmit half complete.
+      (+) RxM0CpltCallback   : SAI receive memory 0 complete.
+      (+) RxM1CpltCallback   : SAI receive memory 1 complete.
       (+) ErrorCallback      : SAI error.
       (+) MspInitCallback    : SAI MspInit.
       (+) MspDeInitCallback  : SAI MspDeInit.
@@ -247,12 +292,17 @@ typedef enum
 #define SAI_LONG_TIMEOUT         1000U
 #define SAI_SPDIF_FRAME_LENGTH   64U
 #define SAI_AC97_FRAME_LENGTH    256U
+#define SAI_PDMCAPTURE_ORDER     4U
 /**
   * @}
   */
 
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
+/* Contribution of the 8 bits of a byte (MSB first) to each integrator stage */
+static uint16_t SAI_PdmCicTable[SAI_PDMCAPTURE_ORDER][256];
+static uint8_t  SAI_PdmCicTableReady = 0U;
+
 /* Private function prototypes -----------------------------------------------*/
 /** @defgroup SAI_Private_Functions  SAI Private Functions
   * @{
@@ -261,6 +311,14 @@ static void SAI_FillFifo(SAI_HandleTypeDef *hsai);
 static uint32_t SAI_InterruptFlag(const SAI_HandleTypeDef *hsai, SAI_ModeTypedef mode);
 static HAL_StatusTypeDef SAI_InitI2S(SAI_HandleTypeDef *hsai, uint32_t protocol, uint32_t datasize, uint32_t nbslot);
 static HAL_StatusTypeDef SAI_InitPCM(SAI_HandleTypeDef *hsai, uint32_t protocol, uint32_t datasize, uint32_t nbslot);
+static uint32_t SAI_GetSampleSize(const SAI_HandleTypeDef *hsai);
+static uint32_t SAI_GetNbActiveSlots(const SAI_HandleTypeDef *hsai);
+#if defined(HAL_MDMA_MODULE_ENABLED)
+static HAL_StatusTypeDef SAI_TDM_StartMDMA(MDMA_HandleTypeDef *hmdma, const SAI_SlotViewTypeDef *pView,
+                                           uint32_t SrcAddress, uint32_t DstAddress, uint32_t SrcStrided);
+#endif /* HAL_MDMA_MODULE_ENABLED */
+static void SAI_PDMCapture_BuildTable(void);
+static void SAI_PDMCapture_Process(SAI_HandleTypeDef *hsai, uint32_t Half);
 
 static HAL_StatusTypeDef SAI_Disable(SAI_HandleTypeDef *hsai);
 static void SAI_Transmit_IT8Bit(SAI_HandleTypeDef *hsai);
@@ -274,8 +332,12 @@ static void SAI_DMATxCplt(DMA_HandleTypeDef *hdma);
 static void SAI_DMATxHalfCplt(DMA_HandleTypeDef *hdma);
 static void SAI_DMARxCplt(DMA_HandleTypeDef *hdma);
 static void SAI_DMARxHalfCplt(DMA_HandleTypeDef *hdma);
+static void SAI_DMARxM0Cplt(DMA_HandleTypeDef *hdma);
+static void SAI_DMARxM1Cplt(DMA_HandleTypeDef *hdma);
 static void SAI_DMAError(DMA_HandleTypeDef *hdma);
 static void SAI_DMAAbort(DMA_HandleTypeDef *hdma);
+static void SAI_DMAPdmRxCplt(DMA_HandleTypeDef *hdma);
+static void SAI_DMAPdmRxHalfCplt(DMA_HandleTypeDef *hdma);
 /**
   * @}
   */
@@ -361,6 +423,43 @@ HAL_StatusTypeDef HAL_SAI_InitProtocol(SAI_HandleTypeDef *hsai, uint32_t protoco
   return status;
 }
 
+/**
+  * @brief  Initialize the SAI block for a TDM stream: short frame synchronization
+  *         pulse before the first bit of slot 0, then nbslot slots of which only
+  *         the ones of slotactive are transferred, and call HAL_SAI_Init.
+  * @param  hsai pointer to a SAI_HandleTypeDef structure that contains
+  *              the configuration information for SAI module.
+  * @param  datasize one of the supported datasize @ref SAI_Protocol_DataSize
+  * @param  nbslot number of slot minimum value is 1 and the max is 16.
+  * @param  slotactive active slots, a combination of @ref SAI_Block_Slot_Active
+  * @note   Init.AudioMode, Init.Synchro and the clock fields must be set before.
+  *         The memory buffers only hold the samples of the active slots.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SAI_InitTDM(SAI_HandleTypeDef *hsai, uint32_t datasize, uint32_t nbslot, uint32_t slotactive)
+{
+  HAL_StatusTypeDef status;
+
+  /* Check the parameters */
+  assert_param(IS_SAI_PROTOCOL_DATASIZE(datasize));
+  assert_param(IS_SAI_SLOT_ACTIVE(slotactive));
+
+  if ((nbslot == 0U) || (nbslot > 16U) || ((slotactive & ((1UL << nbslot) - 1U)) == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  status = SAI_InitPCM(hsai, SAI_PCM_SHORT, datasize, nbslot);
+
+  if (status == HAL_OK)
+  {
+    hsai->SlotInit.SlotActive = slotactive;
+    status = HAL_SAI_Init(hsai);
+  }
+
+  return status;
+}
+
 /**
   * @brief  Initialize the SAI according to the specified parameters.
   *         in the SAI_InitTypeDef structure and initialize the associated handle.
@@ -480,12 +579,17 @@ HAL_StatusTypeDef HAL_SAI_Init(SAI_HandleTypeDef *hsai)
     /* Allocate lock resource and initialize it */
     hsai->Lock = HAL_UNLOCKED;
 
+    /* No PDM capture running */
+    hsai->pPdmCapture = NULL;
+
 #if (USE_HAL_SAI_REGISTER_CALLBACKS == 1)
     /* Reset callback pointers to the weak predefined callbacks */
     hsai->RxCpltCallback     = HAL_SAI_RxCpltCallback;
     hsai->RxHalfCpltCallback = HAL_SAI_RxHalfCpltCallback;
     hsai->TxCpltCallback     = HAL_SAI_TxCpltCallback;
     hsai->TxHalfCpltCallback = HAL_SAI_TxHalfCpltCallback;
+    hsai->RxM0CpltCallback   = HAL_SAI_RxM0CpltCallback;
+    hsai->RxM1CpltCallback   = HAL_SAI_RxM1CpltCallback;
     hsai->ErrorCallback      = HAL_SAI_ErrorCallback;
 
     /* Init the low level hardware : GPIO, CLOCK, NVIC and DMA */
@@ -899,6 +1003,8 @@ __weak void HAL_SAI_MspDeInit(SAI_HandleTypeDef *hsai)
   *           @arg @ref HAL_SAI_RX_HALFCOMPLETE_CB_ID receive half complete callback ID.
   *           @arg @ref HAL_SAI_TX_COMPLETE_CB_ID transmit complete callback ID.
   *           @arg @ref HAL_SAI_TX_HALFCOMPLETE_CB_ID transmit half complete callback ID.
+  *           @arg @ref HAL_SAI_RX_M0_COMPLETE_CB_ID receive memory 0 complete callback ID.
+  *           @arg @ref HAL_SAI_RX_M1_COMPLETE_CB_ID receive memory 1 complete callback ID.
   *           @arg @ref HAL_SAI_ERROR_CB_ID error callback ID.
   *           @arg @ref HAL_SAI_MSPINIT_CB_ID MSP init callback ID.
   *           @arg @ref HAL_SAI_MSPDEINIT_CB_ID MSP de-init callback ID.
@@ -936,6 +1042,12 @@ HAL_StatusTypeDef HAL_SAI_RegisterCallback(SAI_HandleTypeDef        *hsai,
         case HAL_SAI_TX_HALFCOMPLETE_CB_ID :
           hsai->TxHalfCpltCallback = pCallback;
           break;
+        case HAL_SAI_RX_M0_COMPLETE_CB_ID :
+          hsai->RxM0CpltCallback = pCallback;
+          break;
+        case HAL_SAI_RX_M1_COMPLETE_CB_ID :
+          hsai->RxM1CpltCallback = pCallback;
+          break;
         case HAL_SAI_ERROR_CB_ID :
           hsai->ErrorCallback = pCallback;
           break;
@@ -992,6 +1104,8 @@ HAL_StatusTypeDef HAL_SAI_RegisterCallback(SAI_HandleTypeDef        *hsai,
   *           @arg @ref HAL_SAI_RX_HALFCOMPLETE_CB_ID receive half complete callback ID.
   *           @arg @ref HAL_SAI_TX_COMPLETE_CB_ID transmit complete callback ID.
   *           @arg @ref HAL_SAI_TX_HALFCOMPLETE_CB_ID transmit half complete callback ID.
+  *           @arg @ref HAL_SAI_RX_M0_COMPLETE_CB_ID receive memory 0 complete callback ID.
+  *           @arg @ref HAL_SAI_RX_M1_COMPLETE_CB_ID receive memory 1 complete callback ID.
   *           @arg @ref HAL_SAI_ERROR_CB_ID error callback ID.
   *           @arg @ref HAL_SAI_MSPINIT_CB_ID MSP init callback ID.
   *           @arg @ref HAL_SAI_MSPDEINIT_CB_ID MSP de-init callback ID.
@@ -1018,6 +1132,12 @@ HAL_StatusTypeDef HAL_SAI_UnRegisterCallback(SAI_HandleTypeDef        *hsai,
       case HAL_SAI_TX_HALFCOMPLETE_CB_ID :
         hsai->TxHalfCpltCallback = HAL_SAI_TxHalfCpltCallback;
         break;
+      case HAL_SAI_RX_M0_COMPLETE_CB_ID :
+        hsai->RxM0CpltCallback = HAL_SAI_RxM0CpltCallback;
+        break;
+      case HAL_SAI_RX_M1_COMPLETE_CB_ID :
+        hsai->RxM1CpltCallback = HAL_SAI_RxM1CpltCallback;
+        break;
       case HAL_SAI_ERROR_CB_ID :
         hsai->ErrorCallback = HAL_SAI_ErrorCallback;
         break;
@@ -1101,10 +1221,15 @@ HAL_StatusTypeDef HAL_SAI_UnRegisterCallback(SAI_HandleTypeDef        *hsai,
       (++) HAL_SAI_Transmit_DMA()
       (++) HAL_SAI_Receive_DMA()
 
+    (+) PDM capture with software decimation:
+      (++) HAL_SAI_PDMCapture_Start()
+      (++) HAL_SAI_PDMCapture_Stop()
+
     (+) A set of Transfer Complete Callbacks are provided in non Blocking mode:
       (++) HAL_SAI_TxCpltCallback()
       (++) HAL_SAI_RxCpltCallback()
       (++) HAL_SAI_ErrorCallback()
+      (++) HAL_SAI_PDMCapture_FrameCallback()
 
 @endverbatim
   * @{
@@ -1792,6 +1917,424 @@ HAL_StatusTypeDef HAL_SAI_Receive_DMA(SAI_HandleTypeDef *hsai, uint8_t *pData, u
   }
 }
 
+/**
+  * @brief  Receive data continuously in non-blocking mode with DMA double buffer mode.
+  * @param  hsai pointer to a SAI_HandleTypeDef structure that contains
+  *              the configuration information for SAI module.
+  * @param  pData0 Pointer to the first data buffer (DMA memory 0)
+  * @param  pData1 Pointer to the second data buffer (DMA memory 1)
+  * @param  Size Amount of data to be received in each buffer
+  * @note   The reception alternates between the two buffers until HAL_SAI_DMAStop()
+  *         is called. HAL_SAI_RxM0CpltCallback() and HAL_SAI_RxM1CpltCallback() are
+  *         executed each time the corresponding buffer has been filled.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SAI_ReceiveDoubleBuffer_DMA(SAI_HandleTypeDef *hsai, uint8_t *pData0, uint8_t *pData1,
+                                                  uint16_t Size)
+{
+  if ((pData0 == NULL) || (pData1 == NULL) || (Size == 0U))
+  {
+    return  HAL_ERROR;
+  }
+
+  if (hsai->State == HAL_SAI_STATE_READY)
+  {
+    /* Process Locked */
+    __HAL_LOCK(hsai);
+
+    hsai->pBuffPtr = pData0;
+    hsai->XferSize = Size;
+    hsai->XferCount = Size;
+    hsai->ErrorCode = HAL_SAI_ERROR_NONE;
+    hsai->State = HAL_SAI_STATE_BUSY_RX;
+
+    /* Half transfer callbacks are not used in double buffer mode */
+    hsai->hdmarx->XferHalfCpltCallback = NULL;
+    hsai->hdmarx->XferM1HalfCpltCallback = NULL;
+
+    /* Set the SAI Rx DMA memory 0 and memory 1 transfer complete callbacks */
+    hsai->hdmarx->XferCpltCallback = SAI_DMARxM0Cplt;
+    hsai->hdmarx->XferM1CpltCallback = SAI_DMARxM1Cplt;
+
+    /* Set the DMA error callback */
+    hsai->hdmarx->XferErrorCallback = SAI_DMAError;
+
+    /* Set the DMA Rx abort callback */
+    hsai->hdmarx->XferAbortCallback = NULL;
+
+    /* Enable the Rx DMA Stream in double buffer mode */
+    if (HAL_DMAEx_MultiBufferStart_IT(hsai->hdmarx, (uint32_t)&hsai->Instance->DR, (uint32_t)pData0,
+                                      (uint32_t)pData1, hsai->XferSize) != HAL_OK)
+    {
+      hsai->State = HAL_SAI_STATE_READY;
+      __HAL_UNLOCK(hsai);
+      return  HAL_ERROR;
+    }
+
+    /* Enable the interrupts for error handling */
+    __HAL_SAI_ENABLE_IT(hsai, SAI_InterruptFlag(hsai, SAI_MODE_DMA));
+
+    /* Enable SAI Rx DMA Request */
+    hsai->Instance->CR1 |= SAI_xCR1_DMAEN;
+
+    /* Check if the SAI is already enabled */
+    if ((hsai->Instance->CR1 & SAI_xCR1_SAIEN) == 0U)
+    {
+      /* Enable SAI peripheral */
+      __HAL_SAI_ENABLE(hsai);
+    }
+
+    /* Process Unlocked */
+    __HAL_UNLOCK(hsai);
+
+    return HAL_OK;
+  }
+  else
+  {
+    return HAL_BUSY;
+  }
+}
+
+/**
+  * @brief  Start a TDM stream on circular DMA, in one or both directions.
+  * @param  hsaitx pointer to the SAI handle of the transmitter block, or NULL.
+  * @param  pTxData pointer to the interleaved transmit buffer of NbFrames frames.
+  * @param  hsairx pointer to the SAI handle of the receiver block, or NULL.
+  * @param  pRxData pointer to the interleaved receive buffer of NbFrames frames.
+  * @param  NbFrames number of frames of each buffer, an even number.
+  * @note   The DMA of each block must be configured in circular mode. The
+  *         half and complete callbacks then signal which half of the buffer
+  *         can be processed.
+  * @note   The synchronous slave block is started before the master one.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SAI_TDM_Start_DMA(SAI_HandleTypeDef *hsaitx, uint8_t *pTxData,
+                                        SAI_HandleTypeDef *hsairx, uint8_t *pRxData, uint16_t NbFrames)
+{
+  SAI_HandleTypeDef *hsaifirst = hsaitx;
+  SAI_HandleTypeDef *hsaisecond = hsairx;
+  uint8_t *pfirst = pTxData;
+  uint8_t *psecond = pRxData;
+  HAL_StatusTypeDef status = HAL_OK;
+
+  if (((hsaitx == NULL) && (hsairx == NULL)) || (NbFrames == 0U) || ((NbFrames & 1U) != 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the DMA mode and the transfer size of each direction */
+  if (hsaitx != NULL)
+  {
+    if ((hsaitx->hdmatx == NULL) || (hsaitx->hdmatx->Init.Mode != DMA_CIRCULAR) ||
+        (((uint32_t)NbFrames * SAI_GetNbActiveSlots(hsaitx)) > 0xFFFFU))
+    {
+      return HAL_ERROR;
+    }
+  }
+  if (hsairx != NULL)
+  {
+    if ((hsairx->hdmarx == NULL) || (hsairx->hdmarx->Init.Mode != DMA_CIRCULAR) ||
+        (((uint32_t)NbFrames * SAI_GetNbActiveSlots(hsairx)) > 0xFFFFU))
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  /* The master block generates the clocks: start it last */
+  if ((hsaitx != NULL) && (hsaitx->Init.Synchro == SAI_ASYNCHRONOUS))
+  {
+    hsaifirst = hsairx;
+    pfirst = pRxData;
+    hsaisecond = hsaitx;
+    psecond = pTxData;
+  }
+
+  if (hsaifirst != NULL)
+  {
+    if (hsaifirst == hsaitx)
+    {
+      status = HAL_SAI_Transmit_DMA(hsaifirst, pfirst, (uint16_t)(NbFrames * SAI_GetNbActiveSlots(hsaifirst)));
+    }
+    else
+    {
+      status = HAL_SAI_Receive_DMA(hsaifirst, pfirst, (uint16_t)(NbFrames * SAI_GetNbActiveSlots(hsaifirst)));
+    }
+  }
+
+  if ((status == HAL_OK) && (hsaisecond != NULL))
+  {
+    if (hsaisecond == hsaitx)
+    {
+      status = HAL_SAI_Transmit_DMA(hsaisecond, psecond, (uint16_t)(NbFrames * SAI_GetNbActiveSlots(hsaisecond)));
+    }
+    else
+    {
+      status = HAL_SAI_Receive_DMA(hsaisecond, psecond, (uint16_t)(NbFrames * SAI_GetNbActiveSlots(hsaisecond)));
+    }
+
+    /* Do not leave half a stream running */
+    if ((status != HAL_OK) && (hsaifirst != NULL))
+    {
+      (void) HAL_SAI_DMAStop(hsaifirst);
+    }
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Stop a TDM stream started with HAL_SAI_TDM_Start_DMA.
+  * @param  hsaitx pointer to the SAI handle of the transmitter block, or NULL.
+  * @param  hsairx pointer to the SAI handle of the receiver block, or NULL.
+  * @note   The master block is stopped first, so that the slave block stops
+  *         on a frame boundary.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SAI_TDM_Stop_DMA(SAI_HandleTypeDef *hsaitx, SAI_HandleTypeDef *hsairx)
+{
+  SAI_HandleTypeDef *hsaifirst = hsairx;
+  SAI_HandleTypeDef *hsaisecond = hsaitx;
+  HAL_StatusTypeDef status = HAL_OK;
+
+  if ((hsaitx != NULL) && (hsaitx->Init.Synchro == SAI_ASYNCHRONOUS))
+  {
+    hsaifirst = hsaitx;
+    hsaisecond = hsairx;
+  }
+
+  if (hsaifirst != NULL)
+  {
+    status = HAL_SAI_DMAStop(hsaifirst);
+  }
+  if (hsaisecond != NULL)
+  {
+    if (HAL_SAI_DMAStop(hsaisecond) != HAL_OK)
+    {
+      status = HAL_ERROR;
+    }
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Describe the samples of one slot in an interleaved TDM buffer.
+  * @param  hsai pointer to a SAI_HandleTypeDef structure that contains
+  *              the configuration information for SAI module.
+  * @param  pData pointer to the interleaved buffer, or to one of its halves.
+  * @param  NbFrames number of frames from pData.
+  * @param  Slot slot number, from 0 to 15. The slot must be active.
+  * @param  pView pointer to the SAI_SlotViewTypeDef structure to fill.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SAI_TDM_GetSlotView(const SAI_HandleTypeDef *hsai, uint8_t *pData, uint16_t NbFrames,
+                                          uint32_t Slot, SAI_SlotViewTypeDef *pView)
+{
+  uint32_t slotactive;
+  uint32_t samplesize;
+  uint32_t position;
+
+  if ((pData == NULL) || (Slot >= hsai->SlotInit.SlotNumber))
+  {
+    return HAL_ERROR;
+  }
+
+  slotactive = hsai->SlotInit.SlotActive & ((1UL << hsai->SlotInit.SlotNumber) - 1U);
+  if ((slotactive & (1UL << Slot)) == 0U)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Rank of the slot among the active ones */
+  position = 0U;
+  slotactive &= ((1UL << Slot) - 1U);
+  while (slotactive != 0U)
+  {
+    slotactive &= (slotactive - 1U);
+    position++;
+  }
+
+  samplesize = SAI_GetSampleSize(hsai);
+
+  pView->pBase      = &pData[position * samplesize];
+  pView->Stride     = SAI_GetNbActiveSlots(hsai) * samplesize;
+  pView->SampleSize = samplesize;
+  pView->NbSamples  = NbFrames;
+
+  return HAL_OK;
+}
+
+#if defined(HAL_MDMA_MODULE_ENABLED)
+/**
+  * @brief  Copy the samples of one TDM slot into a contiguous buffer with the MDMA.
+  * @param  hmdma pointer to a MDMA_HandleTypeDef structure, with its Instance
+  *              and Priority set. The other Init fields are set by this function.
+  * @param  pView pointer to the slot view, from HAL_SAI_TDM_GetSlotView.
+  * @param  pDst pointer to the destination buffer of NbSamples samples.
+  * @note   The end of the copy is signalled by the MDMA transfer complete
+  *         callback. The data cache must be maintained by the application.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SAI_TDM_DeinterleaveSlot_MDMA(MDMA_HandleTypeDef *hmdma, const SAI_SlotViewTypeDef *pView,
+                                                    uint8_t *pDst)
+{
+  return SAI_TDM_StartMDMA(hmdma, pView, (uint32_t)pView->pBase, (uint32_t)pDst, 1U);
+}
+
+/**
+  * @brief  Copy a contiguous buffer into the samples of one TDM slot with the MDMA.
+  * @param  hmdma pointer to a MDMA_HandleTypeDef structure, with its Instance
+  *              and Priority set. The other Init fields are set by this function.
+  * @param  pSrc pointer to the source buffer of NbSamples samples.
+  * @param  pView pointer to the slot view, from HAL_SAI_TDM_GetSlotView.
+  * @note   The end of the copy is signalled by the MDMA transfer complete
+  *         callback. The data cache must be maintained by the application.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SAI_TDM_InterleaveSlot_MDMA(MDMA_HandleTypeDef *hmdma, const uint8_t *pSrc,
+                                                  const SAI_SlotViewTypeDef *pView)
+{
+  return SAI_TDM_StartMDMA(hmdma, pView, (uint32_t)pSrc, (uint32_t)pView->pBase, 0U);
+}
+#endif /* HAL_MDMA_MODULE_ENABLED */
+
+/**
+  * @brief  Start a PDM capture decimated by software on circular DMA.
+  * @param  hsai pointer to a SAI_HandleTypeDef structure that contains
+  *              the configuration information for SAI module.
+  * @param  pCapture pointer to the capture context, owned by the application
+  *         until HAL_SAI_PDMCapture_Stop() returns.
+  * @note   The block must use the PDM interface with an 8-bit data size and
+  *         its reception DMA must be in circular mode with a byte width.
+  * @note   HAL_SAI_PDMCapture_FrameCallback() is executed from the DMA
+  *         interrupt, after the conversion of each half of the PDM buffer.
+  *         HAL_SAI_RxHalfCpltCallback() and HAL_SAI_RxCpltCallback() are not.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SAI_PDMCapture_Start(SAI_HandleTypeDef *hsai, SAI_PDMCaptureTypeDef *pCapture)
+{
+  uint32_t gain;
+  uint32_t size;
+  uint32_t mic;
+  uint32_t stage;
+
+  if ((pCapture == NULL) || (pCapture->pPdmBuffer == NULL) || (pCapture->pPcmBuffer == NULL) ||
+      (pCapture->FrameSamples == 0U) || (pCapture->Decimation < 16U) || (pCapture->Decimation > 128U) ||
+      ((pCapture->Decimation & 7U) != 0U) || (pCapture->NbMics > SAI_PDMCAPTURE_MAX_MICS))
+  {
+    return HAL_ERROR;
+  }
+
+  /* The capture relies on the PDM interface delivering one byte per microphone */
+  if ((hsai->Init.PdmInit.Activation != ENABLE) || (hsai->Init.DataSize != SAI_DATASIZE_8) ||
+      (pCapture->NbMics != (2U * hsai->Init.PdmInit.MicPairsNbr)) ||
+      (hsai->hdmarx == NULL) || (hsai->hdmarx->Init.Mode != DMA_CIRCULAR))
+  {
+    return HAL_ERROR;
+  }
+
+  size = 2U * pCapture->FrameSamples * pCapture->NbMics * (pCapture->Decimation / 8U);
+  if (size > 0xFFFFU)
+  {
+    return HAL_ERROR;
+  }
+
+  if (hsai->State != HAL_SAI_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  if (SAI_PdmCicTableReady == 0U)
+  {
+    SAI_PDMCapture_BuildTable();
+  }
+
+  /* Scale the Decimation^4 full range of the filter output to 16 bits */
+  gain = pCapture->Decimation * pCapture->Decimation * pCapture->Decimation * pCapture->Decimation;
+  pCapture->Offset = gain / 2U;
+  pCapture->Shift = 0U;
+  while ((gain >> pCapture->Shift) > 0x10000U)
+  {
+    pCapture->Shift++;
+  }
+
+  for (mic = 0U; mic < SAI_PDMCAPTURE_MAX_MICS; mic++)
+  {
+    for (stage = 0U; stage < SAI_PDMCAPTURE_ORDER; stage++)
+    {
+      pCapture->Integrator[mic][stage] = 0U;
+      pCapture->Comb[mic][stage] = 0U;
+    }
+  }
+  pCapture->pFrame = NULL;
+  pCapture->FrameCount = 0U;
+
+  /* Process Locked */
+  __HAL_LOCK(hsai);
+
+  hsai->pPdmCapture = pCapture;
+  hsai->pBuffPtr = pCapture->pPdmBuffer;
+  hsai->XferSize = (uint16_t)size;
+  hsai->XferCount = (uint16_t)size;
+  hsai->ErrorCode = HAL_SAI_ERROR_NONE;
+  hsai->State = HAL_SAI_STATE_BUSY_RX;
+
+  /* Convert each half of the buffer from the DMA callbacks */
+  hsai->hdmarx->XferHalfCpltCallback = SAI_DMAPdmRxHalfCplt;
+  hsai->hdmarx->XferCpltCallback = SAI_DMAPdmRxCplt;
+  hsai->hdmarx->XferErrorCallback = SAI_DMAError;
+  hsai->hdmarx->XferAbortCallback = NULL;
+
+  /* Enable the Rx DMA Stream */
+  if (HAL_DMA_Start_IT(hsai->hdmarx, (uint32_t)&hsai->Instance->DR, (uint32_t)hsai->pBuffPtr, hsai->XferSize) != HAL_OK)
+  {
+    hsai->pPdmCapture = NULL;
+    hsai->State = HAL_SAI_STATE_READY;
+    __HAL_UNLOCK(hsai);
+    return  HAL_ERROR;
+  }
+
+  /* Enable the interrupts for error handling */
+  __HAL_SAI_ENABLE_IT(hsai, SAI_InterruptFlag(hsai, SAI_MODE_DMA));
+
+  /* Enable SAI Rx DMA Request */
+  hsai->Instance->CR1 |= SAI_xCR1_DMAEN;
+
+  /* Check if the SAI is already enabled */
+  if ((hsai->Instance->CR1 & SAI_xCR1_SAIEN) == 0U)
+  {
+    /* Enable SAI peripheral */
+    __HAL_SAI_ENABLE(hsai);
+  }
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(hsai);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop a PDM capture started with HAL_SAI_PDMCapture_Start.
+  * @param  hsai pointer to a SAI_HandleTypeDef structure that contains
+  *              the configuration information for SAI module.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SAI_PDMCapture_Stop(SAI_HandleTypeDef *hsai)
+{
+  HAL_StatusTypeDef status;
+
+  if (hsai->pPdmCapture == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  status = HAL_SAI_DMAStop(hsai);
+
+  hsai->pPdmCapture = NULL;
+
+  return status;
+}
+
 /**
   * @brief  Enable the Tx mute mode.
   * @param  hsai pointer to a SAI_HandleTypeDef structure that contains
@@ -2209,6 +2752,38 @@ __weak void HAL_SAI_RxHalfCpltCallback(SAI_HandleTypeDef *hsai)
    */
 }
 
+/**
+  * @brief Rx memory 0 buffer completed callback (double buffer reception).
+  * @param  hsai pointer to a SAI_HandleTypeDef structure that contains
+  *              the configuration information for SAI module.
+  * @retval None
+  */
+__weak void HAL_SAI_RxM0CpltCallback(SAI_HandleTypeDef *hsai)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hsai);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_SAI_RxM0CpltCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief Rx memory 1 buffer completed callback (double buffer reception).
+  * @param  hsai pointer to a SAI_HandleTypeDef structure that contains
+  *              the configuration information for SAI module.
+  * @retval None
+  */
+__weak void HAL_SAI_RxM1CpltCallback(SAI_HandleTypeDef *hsai)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hsai);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_SAI_RxM1CpltCallback could be implemented in the user file
+   */
+}
+
 /**
   * @brief SAI error callback.
   * @param  hsai pointer to a SAI_HandleTypeDef structure that contains
@@ -2225,6 +2800,24 @@ __weak void HAL_SAI_ErrorCallback(SAI_HandleTypeDef *hsai)
    */
 }
 
+/**
+  * @brief PDM capture frame converted callback.
+  * @param  hsai pointer to a SAI_HandleTypeDef structure that contains
+  *              the configuration information for SAI module.
+  * @note   hsai->pPdmCapture->pFrame points to the samples of the frame, valid
+  *         until the conversion of the next frame is completed.
+  * @retval None
+  */
+__weak void HAL_SAI_PDMCapture_FrameCallback(SAI_HandleTypeDef *hsai)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hsai);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_SAI_PDMCapture_FrameCallback could be implemented in the user file
+   */
+}
+
 /**
   * @}
   */
@@ -2449,6 +3042,126 @@ static HAL_StatusTypeDef SAI_InitPCM(SAI_HandleTypeDef *hsai, uint32_t protocol,
   return status;
 }
 
+/**
+  * @brief  Return the size in memory of a sample, as moved by the DMA.
+  * @param  hsai pointer to a SAI_HandleTypeDef structure that contains
+  *              the configuration information for SAI module.
+  * @retval Sample size (in bytes)
+  */
+static uint32_t SAI_GetSampleSize(const SAI_HandleTypeDef *hsai)
+{
+  uint32_t samplesize;
+
+  if (hsai->Init.DataSize == SAI_DATASIZE_8)
+  {
+    samplesize = 1U;
+  }
+  else if ((hsai->Init.DataSize == SAI_DATASIZE_10) || (hsai->Init.DataSize == SAI_DATASIZE_16))
+  {
+    samplesize = 2U;
+  }
+  else
+  {
+    samplesize = 4U;
+  }
+
+  return samplesize;
+}
+
+/**
+  * @brief  Return the number of active slots of a frame.
+  * @param  hsai pointer to a SAI_HandleTypeDef structure that contains
+  *              the configuration information for SAI module.
+  * @retval Number of samples of a frame
+  */
+static uint32_t SAI_GetNbActiveSlots(const SAI_HandleTypeDef *hsai)
+{
+  uint32_t slotactive = hsai->SlotInit.SlotActive & ((1UL << hsai->SlotInit.SlotNumber) - 1U);
+  uint32_t nbslots = 0U;
+
+  while (slotactive != 0U)
+  {
+    slotactive &= (slotactive - 1U);
+    nbslots++;
+  }
+
+  return nbslots;
+}
+
+#if defined(HAL_MDMA_MODULE_ENABLED)
+/**
+  * @brief  Start an MDMA copy between a TDM slot view and a contiguous buffer.
+  * @param  hmdma pointer to a MDMA_HandleTypeDef structure.
+  * @param  pView pointer to the slot view.
+  * @param  SrcAddress source address.
+  * @param  DstAddress destination address.
+  * @param  SrcStrided 1 when the source is the slot view, 0 when it is the destination.
+  * @note   One block per sample: after each block, the block repeat offset moves
+  *         the strided address to the next frame.
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef SAI_TDM_StartMDMA(MDMA_HandleTypeDef *hmdma, const SAI_SlotViewTypeDef *pView,
+                                           uint32_t SrcAddress, uint32_t DstAddress, uint32_t SrcStrided)
+{
+  int32_t offset;
+
+  if ((hmdma == NULL) || (pView->NbSamples == 0U) || (pView->NbSamples > 4096U))
+  {
+    return HAL_ERROR;
+  }
+
+  offset = (int32_t)pView->Stride - (int32_t)pView->SampleSize;
+
+  hmdma->Init.Request             = MDMA_REQUEST_SW;
+  hmdma->Init.TransferTriggerMode = MDMA_FULL_TRANSFER;
+  hmdma->Init.Endianness          = MDMA_LITTLE_ENDIANNESS_PRESERVE;
+  hmdma->Init.DataAlignment       = MDMA_DATAALIGN_PACKENABLE;
+  hmdma->Init.BufferTransferLength = pView->SampleSize;
+  hmdma->Init.SourceBurst         = MDMA_SOURCE_BURST_SINGLE;
+  hmdma->Init.DestBurst           = MDMA_DEST_BURST_SINGLE;
+
+  if (pView->SampleSize == 1U)
+  {
+    hmdma->Init.SourceInc      = MDMA_SRC_INC_BYTE;
+    hmdma->Init.DestinationInc = MDMA_DEST_INC_BYTE;
+    hmdma->Init.SourceDataSize = MDMA_SRC_DATASIZE_BYTE;
+    hmdma->Init.DestDataSize   = MDMA_DEST_DATASIZE_BYTE;
+  }
+  else if (pView->SampleSize == 2U)
+  {
+    hmdma->Init.SourceInc      = MDMA_SRC_INC_HALFWORD;
+    hmdma->Init.DestinationInc = MDMA_DEST_INC_HALFWORD;
+    hmdma->Init.SourceDataSize = MDMA_SRC_DATASIZE_HALFWORD;
+    hmdma->Init.DestDataSize   = MDMA_DEST_DATASIZE_HALFWORD;
+  }
+  else
+  {
+    hmdma->Init.SourceInc      = MDMA_SRC_INC_WORD;
+    hmdma->Init.DestinationInc = MDMA_DEST_INC_WORD;
+    hmdma->Init.SourceDataSize = MDMA_SRC_DATASIZE_WORD;
+    hmdma->Init.DestDataSize   = MDMA_DEST_DATASIZE_WORD;
+  }
+
+  if (SrcStrided != 0U)
+  {
+    hmdma->Init.SourceBlockAddressOffset = offset;
+    hmdma->Init.DestBlockAddressOffset   = 0;
+  }
+  else
+  {
+    hmdma->Init.SourceBlockAddressOffset = 0;
+    hmdma->Init.DestBlockAddressOffset   = offset;
+  }
+
+  if (HAL_MDMA_Init(hmdma) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  return HAL_MDMA_Start_IT(hmdma, SrcAddress, DstAddress, pView->SampleSize, pView->NbSamples);
+}
+#endif /* HAL_MDMA_MODULE_ENABLED */
+
 /**
   * @brief  Fill the fifo.
   * @param  hsai pointer to a SAI_HandleTypeDef structure that contains
@@ -2853,6 +3566,40 @@ static void SAI_DMARxHalfCplt(DMA_HandleTypeDef *hdma)
 #endif
 }
 
+/**
+  * @brief  DMA SAI memory 0 receive complete callback (double buffer mode)
+  * @param  hdma pointer to a DMA_HandleTypeDef structure that contains
+  *              the configuration information for the specified DMA module.
+  * @retval None
+  */
+static void SAI_DMARxM0Cplt(DMA_HandleTypeDef *hdma)
+{
+  SAI_HandleTypeDef *hsai = (SAI_HandleTypeDef *)((DMA_HandleTypeDef *)hdma)->Parent;
+
+#if (USE_HAL_SAI_REGISTER_CALLBACKS == 1)
+  hsai->RxM0CpltCallback(hsai);
+#else
+  HAL_SAI_RxM0CpltCallback(hsai);
+#endif
+}
+
+/**
+  * @brief  DMA SAI memory 1 receive complete callback (double buffer mode)
+  * @param  hdma pointer to a DMA_HandleTypeDef structure that contains
+  *              the configuration information for the specified DMA module.
+  * @retval None
+  */
+static void SAI_DMARxM1Cplt(DMA_HandleTypeDef *hdma)
+{
+  SAI_HandleTypeDef *hsai = (SAI_HandleTypeDef *)((DMA_HandleTypeDef *)hdma)->Parent;
+
+#if (USE_HAL_SAI_REGISTER_CALLBACKS == 1)
+  hsai->RxM1CpltCallback(hsai);
+#else
+  HAL_SAI_RxM1CpltCallback(hsai);
+#endif
+}
+
 /**
   * @brief  DMA SAI communication error callback.
   * @param  hdma pointer to a DMA_HandleTypeDef structure that contains
@@ -2931,6 +3678,166 @@ static void SAI_DMAAbort(DMA_HandleTypeDef *hdma)
 #endif
 }
 
+/**
+  * @brief  DMA SAI PDM capture complete callback, second half of the buffer.
+  * @param  hdma pointer to a DMA_HandleTypeDef structure that contains
+  *              the configuration information for the specified DMA module.
+  * @retval None
+  */
+static void SAI_DMAPdmRxCplt(DMA_HandleTypeDef *hdma)
+{
+  SAI_HandleTypeDef *hsai = (SAI_HandleTypeDef *)((DMA_HandleTypeDef *)hdma)->Parent;
+
+  if (hsai->pPdmCapture != NULL)
+  {
+    SAI_PDMCapture_Process(hsai, 1U);
+    HAL_SAI_PDMCapture_FrameCallback(hsai);
+  }
+}
+
+/**
+  * @brief  DMA SAI PDM capture half complete callback, first half of the buffer.
+  * @param  hdma pointer to a DMA_HandleTypeDef structure that contains
+  *              the configuration information for the specified DMA module.
+  * @retval None
+  */
+static void SAI_DMAPdmRxHalfCplt(DMA_HandleTypeDef *hdma)
+{
+  SAI_HandleTypeDef *hsai = (SAI_HandleTypeDef *)((DMA_HandleTypeDef *)hdma)->Parent;
+
+  if (hsai->pPdmCapture != NULL)
+  {
+    SAI_PDMCapture_Process(hsai, 0U);
+    HAL_SAI_PDMCapture_FrameCallback(hsai);
+  }
+}
+
+/**
+  * @brief  Build the byte table of the CIC integrators.
+  * @note   Integrating the 8 bits of a byte one by one adds to stage m the
+  *         bits weighted by binomial coefficients: entry [m][b] holds that sum
+  *         for the byte b, the MSB being the first bit received.
+  * @retval None
+  */
+static void SAI_PDMCapture_BuildTable(void)
+{
+  uint32_t weight[SAI_PDMCAPTURE_ORDER][8];
+  uint32_t stage;
+  uint32_t bit;
+  uint32_t byte;
+  uint32_t sum;
+
+  /* Weight of the bit received at position 'bit' (0 first) in each stage */
+  for (bit = 0U; bit < 8U; bit++)
+  {
+    weight[0][bit] = 1U;
+  }
+  for (stage = 1U; stage < SAI_PDMCAPTURE_ORDER; stage++)
+  {
+    sum = 0U;
+    for (bit = 8U; bit > 0U; bit--)
+    {
+      sum += weight[stage - 1U][bit - 1U];
+      weight[stage][bit - 1U] = sum;
+    }
+  }
+
+  for (stage = 0U; stage < SAI_PDMCAPTURE_ORDER; stage++)
+  {
+    for (byte = 0U; byte < 256U; byte++)
+    {
+      sum = 0U;
+      for (bit = 0U; bit < 8U; bit++)
+      {
+        if ((byte & (0x80UL >> bit)) != 0U)
+        {
+          sum += weight[stage][bit];
+        }
+      }
+      SAI_PdmCicTable[stage][byte] = (uint16_t)sum;
+    }
+  }
+
+  SAI_PdmCicTableReady = 1U;
+}
+
+/**
+  * @brief  Decimate one half of the PDM buffer into one PCM frame.
+  * @param  hsai pointer to a SAI_HandleTypeDef structure that contains
+  *              the configuration information for SAI module.
+  * @param  Half half of the buffer just filled by the DMA, 0 or 1.
+  * @note   The four integrators advance by eight bits per table lookup. The
+  *         modulo 2^32 arithmetic is exact since Decimation^4 < 2^32.
+  * @retval None
+  */
+static __HOT_RAM_FUNC void SAI_PDMCapture_Process(SAI_HandleTypeDef *hsai, uint32_t Half)
+{
+  SAI_PDMCaptureTypeDef *pcapture = hsai->pPdmCapture;
+  uint32_t nbmics = pcapture->NbMics;
+  uint32_t nbbytes = pcapture->Decimation / 8U;
+  uint32_t samples = pcapture->FrameSamples;
+  uint32_t offset = pcapture->Offset;
+  uint32_t shift = pcapture->Shift;
+  const uint8_t *ppdm = &pcapture->pPdmBuffer[Half * samples * nbmics * nbbytes];
+  int16_t *ppcm = &pcapture->pPcmBuffer[Half * samples * nbmics];
+  uint32_t mic;
+  uint32_t sample;
+  uint32_t index;
+  uint32_t i1;
+  uint32_t i2;
+  uint32_t i3;
+  uint32_t i4;
+  uint32_t value;
+  uint32_t delay;
+  uint32_t stage;
+  int32_t pcm;
+  uint8_t data;
+
+  for (mic = 0U; mic < nbmics; mic++)
+  {
+    i1 = pcapture->Integrator[mic][0];
+    i2 = pcapture->Integrator[mic][1];
+    i3 = pcapture->Integrator[mic][2];
+    i4 = pcapture->Integrator[mic][3];
+
+    for (sample = 0U; sample < samples; sample++)
+    {
+      for (index = 0U; index < nbbytes; index++)
+      {
+        data = ppdm[(((sample * nbbytes) + index) * nbmics) + mic];
+        i4 += (120U * i1) + (36U * i2) + (8U * i3) + SAI_PdmCicTable[3][data];
+        i3 += (36U * i1) + (8U * i2) + SAI_PdmCicTable[2][data];
+        i2 += (8U * i1) + SAI_PdmCicTable[1][data];
+        i1 += SAI_PdmCicTable[0][data];
+      }
+
+      /* Comb stages at the output rate */
+      value = i4;
+      for (stage = 0U; stage < SAI_PDMCAPTURE_ORDER; stage++)
+      {
+        delay = pcapture->Comb[mic][stage];
+        pcapture->Comb[mic][stage] = value;
+        value -= delay;
+      }
+
+      pcm = ((int32_t)(value - offset)) >> shift;
+      if (pcm > 32767)
+      {
+        pcm = 32767;
+      }
+      ppcm[(sample * nbmics) + mic] = (int16_t)pcm;
+    }
+
+    pcapture->Integrator[mic][0] = i1;
+    pcapture->Integrator[mic][1] = i2;
+    pcapture->Integrator[mic][2] = i3;
+    pcapture->Integrator[mic][3] = i4;
+  }
+
+  pcapture->pFrame = ppcm;
+  pcapture->FrameCount++;
+}
+
 /**
   * @}
   */
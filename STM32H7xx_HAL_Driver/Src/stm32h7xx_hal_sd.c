@@ -94,6 +94,13 @@
 
     (#) Configure the SD Card in wide bus mode: 4-bits data.
 
+    (#) When the SDR104 mode is selected through HAL_SD_ConfigSpeedBusOperation(), the
+        receive sampling point is tuned automatically : the delay block phase is swept
+        while the card sends the CMD19 tuning block and the centre of the passing window
+        is kept. HAL_SD_ExecuteTuning() runs the sweep again (e.g. after a change of the
+        SDMMC_CK frequency or of the temperature), HAL_SD_GetTuningConfig() returns the
+        selected point and HAL_SD_SetTuningConfig() restores a saved point without sweep.
+
   *** SD Card Read operation ***
   ==============================
   [..]
@@ -114,6 +121,12 @@
         through HAL_SD_GetCardState() function for SD card state.
         You could also check the DMA transfer process through the SD Rx interrupt event.
 
+    (+) You can read from SD card in DMA double buffer mode by using function
+        HAL_SD_ReadBlocks_DMADoubleBuffer(). The two buffers are filled alternately and
+        each completed buffer is notified by HAL_SDEx_Read_DMADoubleBuf0CpltCallback() or
+        HAL_SDEx_Read_DMADoubleBuf1CpltCallback(). The completed buffer may be replaced
+        with HAL_SDEx_ChangeDMABuffer(). Large reads are chained by the driver.
+
     (+) You can read from SD card in Interrupt mode by using function HAL_SD_ReadBlocks_IT().
         This function support only 512-bytes block length (the block size should be
         chosen as 512 bytes).
@@ -123,6 +136,20 @@
         through HAL_SD_GetCardState() function for SD card state.
         You could also check the IT transfer process through the SD Rx interrupt event.
 
+  *** SD Card command queue ***
+  ==============================
+  [..]
+    (+) You can queue up to SD_CMDQUEUE_SIZE operations with HAL_SD_CmdQueue_Submit().
+        Each operation first polls the card status (CMD13) in interrupt mode until
+        the card is in transfer state, the end of the busy signal on D0 being waited
+        for with the BUSYD0END interrupt, then starts its read or write transfer
+        with HAL_SD_ReadBlocks_DMA() or HAL_SD_WriteBlocks_DMA().
+    (+) The end of each operation is notified by HAL_SD_CmdQueueCpltCallback(),
+        the result is given by the ErrorCode field of the entry. The next queued
+        operation is then started without any action of the application.
+    (+) A SD_CMDQUEUE_OP_STATUS entry only waits for the card to be ready, for
+        instance after a write, without blocking the CPU.
+
   *** SD Card Write operation ***
   ===============================
   [..]
@@ -143,6 +170,11 @@
         through HAL_SD_GetCardState() function for SD card state.
         You could also check the DMA transfer process through the SD Tx interrupt event.
 
+    (+) You can write to SD card in DMA double buffer mode by using function
+        HAL_SD_WriteBlocks_DMADoubleBuffer(). The two buffers are sent alternately and
+        each completed buffer is notified by HAL_SDEx_Write_DMADoubleBuf0CpltCallback() or
+        HAL_SDEx_Write_DMADoubleBuf1CpltCallback().
+
     (+) You can write to SD card in Interrupt mode by using function HAL_SD_WriteBlocks_IT().
         This function support only 512-bytes block length (the block size should be
         chosen as 512 bytes).
@@ -272,6 +304,15 @@
 #define SD_INIT_FREQ                   400000U   /* Initialization phase : 400 kHz max */
 #define SD_NORMAL_SPEED_FREQ           25000000U /* Normal speed phase : 25 MHz max */
 #define SD_HIGH_SPEED_FREQ             50000000U /* High speed phase : 50 MHz max */
+/* Phases of the current command queue entry */
+#define SD_CMDQUEUE_PHASE_IDLE         0x00000000U /* No queued operation in progress */
+#define SD_CMDQUEUE_PHASE_STATUS       0x00000001U /* CMD13 polling of the card state */
+#define SD_CMDQUEUE_PHASE_TRANSFER     0x00000002U /* Data transfer in DMA mode */
+#define SD_CMDQUEUE_PHASE_CPLT         0x00000003U /* Completion callback on going */
+
+#define SD_TUNING_BLOCK_SIZE           64U       /* CMD19 tuning block size in bytes */
+#define SD_TUNING_DATATIMEOUT          0x00100000U /* CMD19 data timeout in card clock cycles */
+#define SD_TUNING_TIMEOUT              150U      /* CMD19 tuning block timeout in ms */
 /* Private macro -------------------------------------------------------------*/
 #if defined (DLYB_SDMMC1) && defined (DLYB_SDMMC2)
 #define SD_GET_DLYB_INSTANCE(SDMMC_INSTANCE) (((SDMMC_INSTANCE) == SDMMC1)?  \
@@ -285,6 +326,16 @@
   */
 
 /* Private variables ---------------------------------------------------------*/
+#if defined (DLYB_SDMMC1) || defined (DLYB_SDMMC2)
+/* Tuning block pattern sent by the card on a 4-bit bus (SD Physical Layer 4.2.4.5) */
+static const uint8_t SD_TuningBlockPattern[SD_TUNING_BLOCK_SIZE] =
+{
+  0xFFU, 0x0FU, 0xFFU, 0x00U, 0xFFU, 0xCCU, 0xC3U, 0xCCU, 0xC3U, 0x3CU, 0xCCU, 0xFFU, 0xFEU, 0xFFU, 0xFEU, 0xEFU,
+  0xFFU, 0xDFU, 0xFFU, 0xDDU, 0xFFU, 0xFBU, 0xFFU, 0xFBU, 0xBFU, 0xFFU, 0x7FU, 0xFFU, 0x77U, 0xF7U, 0xBDU, 0xEFU,
+  0xFFU, 0xF0U, 0xFFU, 0xF0U, 0x0FU, 0xFCU, 0xCCU, 0x3CU, 0xCCU, 0x33U, 0xCCU, 0xCFU, 0xFFU, 0xEFU, 0xFFU, 0xEEU,
+  0xFFU, 0xFDU, 0xFFU, 0xFDU, 0xDFU, 0xFFU, 0xBFU, 0xFFU, 0xBBU, 0xFFU, 0xF7U, 0xFFU, 0xF7U, 0x7FU, 0x7BU, 0xDEU
+};
+#endif /* (DLYB_SDMMC1) || (DLYB_SDMMC2) */
 /* Private function prototypes -----------------------------------------------*/
 /* Private functions ---------------------------------------------------------*/
 /** @defgroup SD_Private_Functions SD Private Functions
@@ -300,11 +351,23 @@ static uint32_t SD_FindSCR(SD_HandleTypeDef *hsd, uint32_t *pSCR);
 static void     SD_PowerOFF(SD_HandleTypeDef *hsd);
 static void     SD_Write_IT(SD_HandleTypeDef *hsd);
 static void     SD_Read_IT(SD_HandleTypeDef *hsd);
+static void     SD_WriteStream_BufferCplt(SD_HandleTypeDef *hsd);
+static HAL_StatusTypeDef SD_DMADoubleBuffer_Start(SD_HandleTypeDef *hsd, uint32_t Buffer0, uint32_t Buffer1,
+                                                  uint32_t BufferSize, uint32_t BlockAdd,
+                                                  uint32_t NumberOfBlocks, uint32_t Context);
+static uint32_t SD_DMADoubleBuffer_StartSegment(SD_HandleTypeDef *hsd);
+static void     SD_CmdQueue_SendStatus(SD_HandleTypeDef *hsd);
+static void     SD_CmdQueue_StatusCplt(SD_HandleTypeDef *hsd);
+static void     SD_CmdQueue_EntryCplt(SD_HandleTypeDef *hsd);
 static uint32_t SD_SwitchSpeed(SD_HandleTypeDef *hsd, uint32_t SwitchSpeedMode);
 #if (USE_SD_TRANSCEIVER != 0U)
 static uint32_t SD_UltraHighSpeed(SD_HandleTypeDef *hsd, uint32_t UltraHighSpeedMode);
 static uint32_t SD_DDR_Mode(SD_HandleTypeDef *hsd);
 #endif /* USE_SD_TRANSCEIVER */
+#if defined (DLYB_SDMMC1) || defined (DLYB_SDMMC2)
+static uint32_t SD_SendTuningBlock(SD_HandleTypeDef *hsd);
+static uint32_t SD_Tuning(SD_HandleTypeDef *hsd);
+#endif /* (DLYB_SDMMC1) || (DLYB_SDMMC2) */
 /**
   * @}
   */
@@ -1525,6 +1588,125 @@ HAL_StatusTypeDef HAL_SD_Erase(SD_HandleTypeDef *hsd, uint32_t BlockStartAdd, ui
   }
 }
 
+/**
+  * @brief  Reads block(s) from a specified address in a card. The Data transfer
+  *         is managed by the Internal DMA in double buffer mode.
+  * @note   Buffer0 and Buffer1 are filled alternately, each completed buffer is
+  *         notified by HAL_SDEx_Read_DMADoubleBuf0CpltCallback() or
+  *         HAL_SDEx_Read_DMADoubleBuf1CpltCallback(), where the next buffer
+  *         address can be given through HAL_SDEx_ChangeDMABuffer().
+  *         The end of the transfer is notified by HAL_SD_RxCpltCallback().
+  * @note   The number of blocks is not limited by the DPSM data length: the
+  *         Read Multi Block command is restarted by the interrupt handler
+  *         after each segment (largest even multiple of BufferSize blocks
+  *         fitting the DPSM data length), without any action of the application.
+  * @param  hsd: Pointer to SD handle
+  * @param  pData0: Pointer to the Buffer0 that will contain the received data
+  * @param  pData1: Pointer to the Buffer1 that will contain the received data
+  * @param  BufferSize: Size of Buffer0 and Buffer1 in blocks
+  * @param  BlockAdd: Block Address from where data is to be read
+  * @param  NumberOfBlocks: Number of blocks to read
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SD_ReadBlocks_DMADoubleBuffer(SD_HandleTypeDef *hsd, uint8_t *pData0, uint8_t *pData1,
+                                                    uint32_t BufferSize, uint32_t BlockAdd, uint32_t NumberOfBlocks)
+{
+  if ((NULL == pData0) || (NULL == pData1))
+  {
+    hsd->ErrorCode |= HAL_SD_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  return SD_DMADoubleBuffer_Start(hsd, (uint32_t)pData0, (uint32_t)pData1, BufferSize, BlockAdd, NumberOfBlocks,
+                                  SD_CONTEXT_READ_MULTIPLE_BLOCK);
+}
+
+/**
+  * @brief  Writes block(s) to a specified address in a card. The Data transfer
+  *         is managed by the Internal DMA in double buffer mode.
+  * @note   Buffer0 and Buffer1 are sent alternately, each completed buffer is
+  *         notified by HAL_SDEx_Write_DMADoubleBuf0CpltCallback() or
+  *         HAL_SDEx_Write_DMADoubleBuf1CpltCallback(), where the next buffer
+  *         address can be given through HAL_SDEx_ChangeDMABuffer().
+  *         The end of the transfer is notified by HAL_SD_TxCpltCallback().
+  * @param  hsd: Pointer to SD handle
+  * @param  pData0: Pointer to the Buffer0 that contains the data to transmit
+  * @param  pData1: Pointer to the Buffer1 that contains the data to transmit
+  * @param  BufferSize: Size of Buffer0 and Buffer1 in blocks
+  * @param  BlockAdd: Block Address where data will be written
+  * @param  NumberOfBlocks: Number of blocks to write, limited to one DPSM
+  *         transfer (65535 blocks)
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SD_WriteBlocks_DMADoubleBuffer(SD_HandleTypeDef *hsd, const uint8_t *pData0,
+                                                     const uint8_t *pData1, uint32_t BufferSize, uint32_t BlockAdd,
+                                                     uint32_t NumberOfBlocks)
+{
+  if ((NULL == pData0) || (NULL == pData1) || (NumberOfBlocks > (SDMMC_DLEN_DATALENGTH / BLOCKSIZE)))
+  {
+    hsd->ErrorCode |= HAL_SD_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  return SD_DMADoubleBuffer_Start(hsd, (uint32_t)pData0, (uint32_t)pData1, BufferSize, BlockAdd, NumberOfBlocks,
+                                  SD_CONTEXT_WRITE_MULTIPLE_BLOCK);
+}
+
+/**
+  * @brief  Queue an operation on the card. The card status is polled in
+  *         interrupt mode before the operation is started.
+  * @note   The entry must stay valid until HAL_SD_CmdQueueCpltCallback() is
+  *         called for it.
+  * @param  hsd: Pointer to SD handle
+  * @param  pEntry: Pointer to the operation to queue
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SD_CmdQueue_Submit(SD_HandleTypeDef *hsd, SD_CmdQueueEntryTypeDef *pEntry)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+  uint32_t primask_bit;
+
+  if ((NULL == pEntry) || (pEntry->Operation > SD_CMDQUEUE_OP_WRITE) ||
+      ((pEntry->Operation != SD_CMDQUEUE_OP_STATUS) && (NULL == pEntry->pData)))
+  {
+    hsd->ErrorCode |= HAL_SD_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  pEntry->ErrorCode = HAL_SD_ERROR_NONE;
+  pEntry->CardState = HAL_SD_CARD_ERROR;
+
+  /* The queue is also updated by the SD interrupt */
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  if (hsd->CmdQueueCount >= SD_CMDQUEUE_SIZE)
+  {
+    status = HAL_BUSY;
+  }
+  else if ((hsd->CmdQueueCount == 0U) && (hsd->State != HAL_SD_STATE_READY))
+  {
+    /* A transfer out of the queue is on going */
+    status = HAL_BUSY;
+  }
+  else
+  {
+    hsd->CmdQueue[(hsd->CmdQueueHead + hsd->CmdQueueCount) % SD_CMDQUEUE_SIZE] = pEntry;
+    hsd->CmdQueueCount++;
+
+    if (hsd->CmdQueuePhase == SD_CMDQUEUE_PHASE_IDLE)
+    {
+      hsd->State = HAL_SD_STATE_BUSY;
+      hsd->ErrorCode = HAL_SD_ERROR_NONE;
+      SD_CmdQueue_SendStatus(hsd);
+    }
+  }
+
+  __set_PRIMASK(primask_bit);
+
+  return status;
+}
+
 /**
   * @brief  This function handles SD card interrupt request.
   * @param  hsd: Pointer to SD handle
@@ -1541,6 +1723,13 @@ void HAL_SD_IRQHandler(SD_HandleTypeDef *hsd)
     SD_Read_IT(hsd);
   }
 
+  else if ((hsd->CmdQueuePhase == SD_CMDQUEUE_PHASE_STATUS) &&
+           (__HAL_SD_GET_FLAG(hsd, SDMMC_FLAG_CMDREND | SDMMC_FLAG_CCRCFAIL | SDMMC_FLAG_CTIMEOUT |
+                              SDMMC_FLAG_BUSYD0END) != RESET))
+  {
+    SD_CmdQueue_StatusCplt(hsd);
+  }
+
   else if (__HAL_SD_GET_FLAG(hsd, SDMMC_FLAG_DATAEND) != RESET)
   {
     __HAL_SD_CLEAR_FLAG(hsd, SDMMC_FLAG_DATAEND);
@@ -1611,23 +1800,49 @@ void HAL_SD_IRQHandler(SD_HandleTypeDef *hsd)
         }
       }
 
-      hsd->State = HAL_SD_STATE_READY;
-      hsd->Context = SD_CONTEXT_NONE;
-      if (((context & SD_CONTEXT_WRITE_SINGLE_BLOCK) != 0U) || ((context & SD_CONTEXT_WRITE_MULTIPLE_BLOCK) != 0U))
+      if (((context & SD_CONTEXT_DOUBLE_BUFFER) != 0U) && (hsd->DblBufRemainingBlocks != 0U) &&
+          (hsd->ErrorCode == HAL_SD_ERROR_NONE))
       {
+        /* Chain the next segment of the double buffer transfer */
+        errorstate = SD_DMADoubleBuffer_StartSegment(hsd);
+        if (errorstate != HAL_SD_ERROR_NONE)
+        {
+          hsd->ErrorCode |= errorstate;
+          hsd->State = HAL_SD_STATE_READY;
+          hsd->Context = SD_CONTEXT_NONE;
 #if defined (USE_HAL_SD_REGISTER_CALLBACKS) && (USE_HAL_SD_REGISTER_CALLBACKS == 1U)
-        hsd->TxCpltCallback(hsd);
+          hsd->ErrorCallback(hsd);
 #else
-        HAL_SD_TxCpltCallback(hsd);
+          HAL_SD_ErrorCallback(hsd);
 #endif /* USE_HAL_SD_REGISTER_CALLBACKS */
+        }
       }
-      if (((context & SD_CONTEXT_READ_SINGLE_BLOCK) != 0U) || ((context & SD_CONTEXT_READ_MULTIPLE_BLOCK) != 0U))
+      else if (hsd->CmdQueuePhase == SD_CMDQUEUE_PHASE_TRANSFER)
+      {
+        hsd->State = HAL_SD_STATE_READY;
+        hsd->Context = SD_CONTEXT_NONE;
+        SD_CmdQueue_EntryCplt(hsd);
+      }
+      else
       {
+        hsd->State = HAL_SD_STATE_READY;
+        hsd->Context = SD_CONTEXT_NONE;
+        if (((context & SD_CONTEXT_WRITE_SINGLE_BLOCK) != 0U) || ((context & SD_CONTEXT_WRITE_MULTIPLE_BLOCK) != 0U))
+        {
 #if defined (USE_HAL_SD_REGISTER_CALLBACKS) && (USE_HAL_SD_REGISTER_CALLBACKS == 1U)
-        hsd->RxCpltCallback(hsd);
+          hsd->TxCpltCallback(hsd);
 #else
-        HAL_SD_RxCpltCallback(hsd);
+          HAL_SD_TxCpltCallback(hsd);
+#endif /* USE_HAL_SD_REGISTER_CALLBACKS */
+        }
+        if (((context & SD_CONTEXT_READ_SINGLE_BLOCK) != 0U) || ((context & SD_CONTEXT_READ_MULTIPLE_BLOCK) != 0U))
+        {
+#if defined (USE_HAL_SD_REGISTER_CALLBACKS) && (USE_HAL_SD_REGISTER_CALLBACKS == 1U)
+          hsd->RxCpltCallback(hsd);
+#else
+          HAL_SD_RxCpltCallback(hsd);
 #endif /* USE_HAL_SD_REGISTER_CALLBACKS */
+        }
       }
     }
     else
@@ -1697,11 +1912,19 @@ void HAL_SD_IRQHandler(SD_HandleTypeDef *hsd)
 
         /* Set the SD state to ready to be able to start again the process */
         hsd->State = HAL_SD_STATE_READY;
+        if (hsd->CmdQueuePhase == SD_CMDQUEUE_PHASE_TRANSFER)
+        {
+          hsd->Context = SD_CONTEXT_NONE;
+          SD_CmdQueue_EntryCplt(hsd);
+        }
+        else
+        {
 #if defined (USE_HAL_SD_REGISTER_CALLBACKS) && (USE_HAL_SD_REGISTER_CALLBACKS == 1U)
-        hsd->ErrorCallback(hsd);
+          hsd->ErrorCallback(hsd);
 #else
-        HAL_SD_ErrorCallback(hsd);
+          HAL_SD_ErrorCallback(hsd);
 #endif /* USE_HAL_SD_REGISTER_CALLBACKS */
+        }
       }
     }
     else
@@ -1713,7 +1936,11 @@ void HAL_SD_IRQHandler(SD_HandleTypeDef *hsd)
   else if (__HAL_SD_GET_FLAG(hsd, SDMMC_FLAG_IDMABTC) != RESET)
   {
     __HAL_SD_CLEAR_FLAG(hsd, SDMMC_FLAG_IDMABTC);
-    if (READ_BIT(hsd->Instance->IDMACTRL, SDMMC_IDMA_IDMABACT) == 0U)
+    if ((context & SD_CONTEXT_WRITE_STREAM) != 0U)
+    {
+      SD_WriteStream_BufferCplt(hsd);
+    }
+    else if (READ_BIT(hsd->Instance->IDMACTRL, SDMMC_IDMA_IDMABACT) == 0U)
     {
       /* Current buffer is buffer0, Transfer complete for buffer1 */
       if ((context & SD_CONTEXT_WRITE_MULTIPLE_BLOCK) != 0U)
@@ -1841,6 +2068,23 @@ __weak void HAL_SD_AbortCallback(SD_HandleTypeDef *hsd)
    */
 }
 
+/**
+  * @brief Command queue operation completed callback
+  * @param hsd: Pointer SD handle
+  * @param pEntry: Pointer to the completed operation
+  * @retval None
+  */
+__weak void HAL_SD_CmdQueueCpltCallback(SD_HandleTypeDef *hsd, SD_CmdQueueEntryTypeDef *pEntry)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hsd);
+  UNUSED(pEntry);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_SD_CmdQueueCpltCallback can be implemented in the user file
+   */
+}
+
 #if (USE_SD_TRANSCEIVER != 0U)
 /**
   * @brief  Enable/Disable the SD Transceiver 1.8V Mode Callback.
@@ -2856,6 +3100,113 @@ HAL_StatusTypeDef HAL_SD_ConfigSpeedBusOperation(SD_HandleTypeDef *hsd, uint32_t
   return status;
 }
 
+#if defined (DLYB_SDMMC1) || defined (DLYB_SDMMC2)
+/**
+  * @brief  Tunes the receive sampling point of the SD card.
+  * @note   The delay block phase is swept over one SDMMC_CK period while the
+  *         card sends the CMD19 tuning block. The centre of the longest window
+  *         of phases receiving the block without error is applied and stored
+  *         in the handle.
+  * @note   This API must be called when the card is in SDR104 mode and its
+  *         transfer frequency is configured.
+  * @param  hsd: Pointer to SD handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SD_ExecuteTuning(SD_HandleTypeDef *hsd)
+{
+  uint32_t errorstate;
+  HAL_StatusTypeDef status = HAL_OK;
+
+  if (hsd->State != HAL_SD_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  hsd->ErrorCode = HAL_SD_ERROR_NONE;
+  hsd->State = HAL_SD_STATE_BUSY;
+
+  if ((hsd->Instance->CLKCR & SDMMC_CLKCR_SELCLKRX) != SDMMC_CLKCR_SELCLKRX_1)
+  {
+    /* SDMMC_FB_CLK tuned feedback clock selected as receive clock */
+    MODIFY_REG(hsd->Instance->CLKCR, SDMMC_CLKCR_SELCLKRX, SDMMC_CLKCR_SELCLKRX_1);
+  }
+
+  /* Calibrate the delay block unit on the current SDMMC_CK period */
+  if (DelayBlock_Enable(SD_GET_DLYB_INSTANCE(hsd->Instance)) != HAL_OK)
+  {
+    errorstate = HAL_SD_ERROR_GENERAL_UNKNOWN_ERR;
+  }
+  else
+  {
+    errorstate = SD_Tuning(hsd);
+  }
+
+  if (errorstate != HAL_SD_ERROR_NONE)
+  {
+    /* Clear all the static flags */
+    __HAL_SD_CLEAR_FLAG(hsd, SDMMC_STATIC_FLAGS);
+    hsd->ErrorCode |= errorstate;
+    status = HAL_ERROR;
+  }
+
+  hsd->State = HAL_SD_STATE_READY;
+  return status;
+}
+
+/**
+  * @brief  Returns the receive sampling point selected by the last tuning.
+  * @param  hsd: Pointer to SD handle
+  * @param  pPhaseSel: Pointer to the delay block output clock phase
+  * @param  pUnits: Pointer to the delay block unit delays
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SD_GetTuningConfig(SD_HandleTypeDef *hsd, uint32_t *pPhaseSel, uint32_t *pUnits)
+{
+  if ((pPhaseSel == NULL) || (pUnits == NULL))
+  {
+    hsd->ErrorCode |= HAL_SD_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  *pPhaseSel = hsd->TuningPhaseSel;
+  *pUnits = hsd->TuningUnits;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Applies a receive sampling point without tuning sweep.
+  * @note   This API allows to restore a point returned by HAL_SD_GetTuningConfig()
+  *         while the SDMMC_CK frequency is unchanged.
+  * @param  hsd: Pointer to SD handle
+  * @param  PhaseSel: Delay block output clock phase, lower than DLYB_MAX_SELECT
+  * @param  Units: Delay block unit delays, lower than DLYB_MAX_UNIT
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SD_SetTuningConfig(SD_HandleTypeDef *hsd, uint32_t PhaseSel, uint32_t Units)
+{
+  if ((PhaseSel >= DLYB_MAX_SELECT) || (Units >= DLYB_MAX_UNIT))
+  {
+    hsd->ErrorCode |= HAL_SD_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  if (hsd->State != HAL_SD_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  /* SDMMC_FB_CLK tuned feedback clock selected as receive clock */
+  MODIFY_REG(hsd->Instance->CLKCR, SDMMC_CLKCR_SELCLKRX, SDMMC_CLKCR_SELCLKRX_1);
+  (void)DelayBlock_Configure(SD_GET_DLYB_INSTANCE(hsd->Instance), PhaseSel, Units);
+
+  hsd->TuningPhaseSel = PhaseSel;
+  hsd->TuningUnits = Units;
+
+  return HAL_OK;
+}
+#endif /* (DLYB_SDMMC1) || (DLYB_SDMMC2) */
+
 /**
   * @brief  Gets the current sd card data state.
   * @param  hsd: pointer to SD handle
@@ -3705,6 +4056,344 @@ static void SD_Write_IT(SD_HandleTypeDef *hsd)
   }
 }
 
+/**
+  * @brief  Handle the end of a write stream buffer transfer.
+  * @note   When the IDMA switches to a buffer which was not queued, the CMD25
+  *         is stopped: on request of HAL_SDEx_WriteStream_End() the transfer
+  *         completes normally, otherwise a Tx underrun error is reported.
+  * @param  hsd: pointer to a SD_HandleTypeDef structure that contains
+  *              the configuration information.
+  * @retval None
+  */
+static void SD_WriteStream_BufferCplt(SD_HandleTypeDef *hsd)
+{
+  hsd->StreamBufferDone++;
+
+  if ((hsd->StreamBufferDone < hsd->StreamBufferNbr) && (hsd->StreamBufferQueued <= hsd->StreamBufferDone))
+  {
+    /* The IDMA is now sending a buffer which was not queued: stop the transfer */
+    __HAL_SD_DISABLE_IT(hsd, SDMMC_IT_DATAEND | SDMMC_IT_DCRCFAIL | SDMMC_IT_DTIMEOUT | \
+                        SDMMC_IT_TXUNDERR | SDMMC_IT_IDMABTC);
+
+    __SDMMC_CMDTRANS_DISABLE(hsd->Instance);
+    hsd->Instance->DCTRL |= SDMMC_DCTRL_FIFORST;
+    hsd->Instance->CMD |= SDMMC_CMD_CMDSTOP;
+    hsd->ErrorCode |= SDMMC_CmdStopTransfer(hsd->Instance);
+    hsd->Instance->CMD &= ~(SDMMC_CMD_CMDSTOP);
+    __HAL_SD_CLEAR_FLAG(hsd, SDMMC_STATIC_DATA_FLAGS);
+
+    hsd->Instance->DLEN = 0;
+    hsd->Instance->DCTRL = 0;
+    hsd->Instance->IDMACTRL = SDMMC_DISABLE_IDMA;
+
+    if (hsd->StreamEndRequest == 0U)
+    {
+      hsd->ErrorCode |= HAL_SD_ERROR_TX_UNDERRUN;
+    }
+
+    hsd->State = HAL_SD_STATE_READY;
+    hsd->Context = SD_CONTEXT_NONE;
+    if (hsd->ErrorCode != HAL_SD_ERROR_NONE)
+    {
+#if defined (USE_HAL_SD_REGISTER_CALLBACKS) && (USE_HAL_SD_REGISTER_CALLBACKS == 1U)
+      hsd->ErrorCallback(hsd);
+#else
+      HAL_SD_ErrorCallback(hsd);
+#endif /* USE_HAL_SD_REGISTER_CALLBACKS */
+    }
+    else
+    {
+#if defined (USE_HAL_SD_REGISTER_CALLBACKS) && (USE_HAL_SD_REGISTER_CALLBACKS == 1U)
+      hsd->TxCpltCallback(hsd);
+#else
+      HAL_SD_TxCpltCallback(hsd);
+#endif /* USE_HAL_SD_REGISTER_CALLBACKS */
+    }
+  }
+  else
+  {
+    HAL_SDEx_WriteStream_BufferCpltCallback(hsd);
+  }
+}
+
+/**
+  * @brief  Start a double buffer DMA transfer.
+  * @param  hsd: pointer to a SD_HandleTypeDef structure that contains
+  *              the configuration information.
+  * @param  Buffer0: Address of the Buffer0
+  * @param  Buffer1: Address of the Buffer1
+  * @param  BufferSize: Size of Buffer0 and Buffer1 in blocks
+  * @param  BlockAdd: Block Address of the transfer
+  * @param  NumberOfBlocks: Number of blocks of the transfer
+  * @param  Context: SD_CONTEXT_READ_MULTIPLE_BLOCK or SD_CONTEXT_WRITE_MULTIPLE_BLOCK
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef SD_DMADoubleBuffer_Start(SD_HandleTypeDef *hsd, uint32_t Buffer0, uint32_t Buffer1,
+                                                  uint32_t BufferSize, uint32_t BlockAdd, uint32_t NumberOfBlocks,
+                                                  uint32_t Context)
+{
+  uint32_t errorstate;
+
+  if ((BufferSize == 0U) || ((BLOCKSIZE * BufferSize) > SDMMC_IDMABSIZE_IDMABNDT) || (NumberOfBlocks == 0U))
+  {
+    hsd->ErrorCode |= HAL_SD_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  if (hsd->State == HAL_SD_STATE_READY)
+  {
+    hsd->ErrorCode = HAL_SD_ERROR_NONE;
+
+    if ((BlockAdd + NumberOfBlocks) > (hsd->SdCard.LogBlockNbr))
+    {
+      hsd->ErrorCode |= HAL_SD_ERROR_ADDR_OUT_OF_RANGE;
+      return HAL_ERROR;
+    }
+
+    hsd->State = HAL_SD_STATE_BUSY;
+
+    hsd->Instance->IDMABASE0 = Buffer0;
+    hsd->Instance->IDMABASE1 = Buffer1;
+    hsd->Instance->IDMABSIZE = (uint32_t)(BLOCKSIZE * BufferSize);
+
+    /* Restart the command every segment: an even number of buffers keeps Buffer0 first */
+    hsd->DblBufBlockAdd        = BlockAdd;
+    hsd->DblBufRemainingBlocks = NumberOfBlocks;
+    if (Context == SD_CONTEXT_READ_MULTIPLE_BLOCK)
+    {
+      hsd->DblBufSegmentBlocks = ((SDMMC_DLEN_DATALENGTH / BLOCKSIZE) / (2U * BufferSize)) * (2U * BufferSize);
+    }
+    else
+    {
+      hsd->DblBufSegmentBlocks = NumberOfBlocks;
+    }
+
+    hsd->Context = (Context | SD_CONTEXT_DMA | SD_CONTEXT_DOUBLE_BUFFER);
+
+    errorstate = SD_DMADoubleBuffer_StartSegment(hsd);
+    if (errorstate != HAL_SD_ERROR_NONE)
+    {
+      /* Clear all the static flags */
+      __HAL_SD_CLEAR_FLAG(hsd, SDMMC_STATIC_FLAGS);
+      hsd->Instance->IDMACTRL = SDMMC_DISABLE_IDMA;
+      hsd->ErrorCode |= errorstate;
+      hsd->State = HAL_SD_STATE_READY;
+      hsd->Context = SD_CONTEXT_NONE;
+      return HAL_ERROR;
+    }
+
+    return HAL_OK;
+  }
+  else
+  {
+    return HAL_BUSY;
+  }
+}
+
+/**
+  * @brief  Start the next segment of a double buffer DMA transfer.
+  * @param  hsd: pointer to a SD_HandleTypeDef structure that contains
+  *              the configuration information.
+  * @retval SD Card error state
+  */
+static uint32_t SD_DMADoubleBuffer_StartSegment(SD_HandleTypeDef *hsd)
+{
+  SDMMC_DataInitTypeDef config;
+  uint32_t errorstate;
+  uint32_t nbblocks = hsd->DblBufRemainingBlocks;
+  uint32_t add = hsd->DblBufBlockAdd;
+
+  if (nbblocks > hsd->DblBufSegmentBlocks)
+  {
+    nbblocks = hsd->DblBufSegmentBlocks;
+  }
+  hsd->DblBufRemainingBlocks -= nbblocks;
+  hsd->DblBufBlockAdd += nbblocks;
+
+  if (hsd->SdCard.CardType != CARD_SDHC_SDXC)
+  {
+    add *= 512U;
+  }
+
+  /* Initialize data control register */
+  hsd->Instance->DCTRL = 0U;
+
+  /* Configure the SD DPSM (Data Path State Machine) */
+  config.DataTimeOut   = SDMMC_DATATIMEOUT;
+  config.DataLength    = BLOCKSIZE * nbblocks;
+  config.DataBlockSize = SDMMC_DATABLOCK_SIZE_512B;
+  config.TransferDir   = ((hsd->Context & SD_CONTEXT_READ_MULTIPLE_BLOCK) != 0U) ? SDMMC_TRANSFER_DIR_TO_SDMMC :
+                         SDMMC_TRANSFER_DIR_TO_CARD;
+  config.TransferMode  = SDMMC_TRANSFER_MODE_BLOCK;
+  config.DPSM          = SDMMC_DPSM_DISABLE;
+  (void)SDMMC_ConfigData(hsd->Instance, &config);
+
+  __SDMMC_CMDTRANS_ENABLE(hsd->Instance);
+
+  hsd->Instance->IDMACTRL = SDMMC_ENABLE_IDMA_DOUBLE_BUFF0;
+
+  if ((hsd->Context & SD_CONTEXT_READ_MULTIPLE_BLOCK) != 0U)
+  {
+    /* Read Multi Block command */
+    errorstate = SDMMC_CmdReadMultiBlock(hsd->Instance, add);
+    if (errorstate == HAL_SD_ERROR_NONE)
+    {
+      __HAL_SD_ENABLE_IT(hsd, (SDMMC_IT_DCRCFAIL | SDMMC_IT_DTIMEOUT | SDMMC_IT_RXOVERR | SDMMC_IT_DATAEND |
+                               SDMMC_IT_IDMABTC));
+    }
+  }
+  else
+  {
+    /* Write Multi Block command */
+    errorstate = SDMMC_CmdWriteMultiBlock(hsd->Instance, add);
+    if (errorstate == HAL_SD_ERROR_NONE)
+    {
+      __HAL_SD_ENABLE_IT(hsd, (SDMMC_IT_DCRCFAIL | SDMMC_IT_DTIMEOUT | SDMMC_IT_TXUNDERR | SDMMC_IT_DATAEND |
+                               SDMMC_IT_IDMABTC));
+    }
+  }
+
+  return errorstate;
+}
+
+/**
+  * @brief  Send the status command (CMD13) of the current queued operation
+  *         without waiting for the response.
+  * @param  hsd: pointer to a SD_HandleTypeDef structure that contains
+  *              the configuration information.
+  * @retval None
+  */
+static void SD_CmdQueue_SendStatus(SD_HandleTypeDef *hsd)
+{
+  SDMMC_CmdInitTypeDef sdmmc_cmdinit;
+
+  hsd->CmdQueuePhase = SD_CMDQUEUE_PHASE_STATUS;
+
+  __HAL_SD_CLEAR_FLAG(hsd, SDMMC_STATIC_CMD_FLAGS);
+  __HAL_SD_ENABLE_IT(hsd, (SDMMC_IT_CMDREND | SDMMC_IT_CCRCFAIL | SDMMC_IT_CTIMEOUT | SDMMC_IT_BUSYD0END));
+
+  sdmmc_cmdinit.Argument         = (uint32_t)(hsd->SdCard.RelCardAdd << 16U);
+  sdmmc_cmdinit.CmdIndex         = SDMMC_CMD_SEND_STATUS;
+  sdmmc_cmdinit.Response         = SDMMC_RESPONSE_SHORT;
+  sdmmc_cmdinit.WaitForInterrupt = SDMMC_WAIT_NO;
+  sdmmc_cmdinit.CPSM             = SDMMC_CPSM_ENABLE;
+  (void)SDMMC_SendCommand(hsd->Instance, &sdmmc_cmdinit);
+}
+
+/**
+  * @brief  Handle the response of the status command of the current queued
+  *         operation and start the operation once the card is ready.
+  * @param  hsd: pointer to a SD_HandleTypeDef structure that contains
+  *              the configuration information.
+  * @retval None
+  */
+static void SD_CmdQueue_StatusCplt(SD_HandleTypeDef *hsd)
+{
+  SD_CmdQueueEntryTypeDef *entry = hsd->CmdQueue[hsd->CmdQueueHead];
+  uint32_t sta_reg = hsd->Instance->STA;
+  uint32_t response_r1;
+  HAL_StatusTypeDef status;
+
+  if ((sta_reg & SDMMC_FLAG_BUSYD0END) != 0U)
+  {
+    /* End of the busy signal on D0: check the card state again */
+    SD_CmdQueue_SendStatus(hsd);
+    return;
+  }
+
+  __HAL_SD_CLEAR_FLAG(hsd, SDMMC_STATIC_CMD_FLAGS);
+
+  if ((sta_reg & SDMMC_FLAG_CTIMEOUT) != 0U)
+  {
+    hsd->ErrorCode |= HAL_SD_ERROR_CMD_RSP_TIMEOUT;
+  }
+  else if ((sta_reg & SDMMC_FLAG_CCRCFAIL) != 0U)
+  {
+    hsd->ErrorCode |= HAL_SD_ERROR_CMD_CRC_FAIL;
+  }
+  else if ((sta_reg & SDMMC_FLAG_BUSYD0) != 0U)
+  {
+    /* The card holds D0 low: wait for the BUSYD0END interrupt */
+    return;
+  }
+  else
+  {
+    response_r1 = SDMMC_GetResponse(hsd->Instance, SDMMC_RESP1);
+    entry->CardState = ((response_r1 >> 9U) & 0x0FU);
+
+    if ((response_r1 & SDMMC_OCR_ERRORBITS) != SDMMC_ALLZERO)
+    {
+      hsd->ErrorCode |= HAL_SD_ERROR_GENERAL_UNKNOWN_ERR;
+    }
+    else if (entry->CardState != HAL_SD_CARD_TRANSFER)
+    {
+      /* The card is still busy: poll its state again */
+      SD_CmdQueue_SendStatus(hsd);
+      return;
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+  }
+
+  __HAL_SD_DISABLE_IT(hsd, (SDMMC_IT_CMDREND | SDMMC_IT_CCRCFAIL | SDMMC_IT_CTIMEOUT | SDMMC_IT_BUSYD0END));
+
+  hsd->State = HAL_SD_STATE_READY;
+
+  if ((hsd->ErrorCode == HAL_SD_ERROR_NONE) && (entry->Operation != SD_CMDQUEUE_OP_STATUS))
+  {
+    hsd->CmdQueuePhase = SD_CMDQUEUE_PHASE_TRANSFER;
+
+    if (entry->Operation == SD_CMDQUEUE_OP_READ)
+    {
+      status = HAL_SD_ReadBlocks_DMA(hsd, entry->pData, entry->BlockAdd, entry->NumberOfBlocks);
+    }
+    else
+    {
+      status = HAL_SD_WriteBlocks_DMA(hsd, entry->pData, entry->BlockAdd, entry->NumberOfBlocks);
+    }
+
+    if (status == HAL_OK)
+    {
+      return;
+    }
+  }
+
+  SD_CmdQueue_EntryCplt(hsd);
+}
+
+/**
+  * @brief  Complete the current queued operation and start the next one.
+  * @param  hsd: pointer to a SD_HandleTypeDef structure that contains
+  *              the configuration information.
+  * @retval None
+  */
+static void SD_CmdQueue_EntryCplt(SD_HandleTypeDef *hsd)
+{
+  SD_CmdQueueEntryTypeDef *entry = hsd->CmdQueue[hsd->CmdQueueHead];
+
+  entry->ErrorCode = hsd->ErrorCode;
+  hsd->ErrorCode = HAL_SD_ERROR_NONE;
+
+  hsd->CmdQueueHead = (hsd->CmdQueueHead + 1U) % SD_CMDQUEUE_SIZE;
+  hsd->CmdQueueCount--;
+
+  /* Entries submitted from the callback are started below */
+  hsd->CmdQueuePhase = SD_CMDQUEUE_PHASE_CPLT;
+  HAL_SD_CmdQueueCpltCallback(hsd, entry);
+
+  if (hsd->CmdQueueCount != 0U)
+  {
+    hsd->State = HAL_SD_STATE_BUSY;
+    SD_CmdQueue_SendStatus(hsd);
+  }
+  else
+  {
+    hsd->CmdQueuePhase = SD_CMDQUEUE_PHASE_IDLE;
+  }
+}
+
 /**
   * @brief  Switches the SD card to High Speed mode.
   *         This API must be used after "Transfer State"
@@ -3943,6 +4632,12 @@ static uint32_t SD_UltraHighSpeed(SD_HandleTypeDef *hsd, uint32_t UltraHighSpeed
       {
         return (HAL_SD_ERROR_GENERAL_UNKNOWN_ERR);
       }
+
+      if (UltraHighSpeedMode == SDMMC_SDR104_SWITCH_PATTERN)
+      {
+        /* Search the receive sampling point with the CMD19 tuning block */
+        errorstate = SD_Tuning(hsd);
+      }
 #endif /* (DLYB_SDMMC1) || (DLYB_SDMMC2) */
     }
   }
@@ -4082,6 +4777,167 @@ static uint32_t SD_DDR_Mode(SD_HandleTypeDef *hsd)
 
 #endif /* USE_SD_TRANSCEIVER */
 
+#if defined (DLYB_SDMMC1) || defined (DLYB_SDMMC2)
+/**
+  * @brief  Reads the CMD19 tuning block and compares it with the expected pattern.
+  * @param  hsd: SD handle
+  * @retval SD Card error state
+  */
+static uint32_t SD_SendTuningBlock(SD_HandleTypeDef *hsd)
+{
+  uint32_t errorstate;
+  SDMMC_DataInitTypeDef sdmmc_datainitstructure;
+  uint32_t tuning_block[SD_TUNING_BLOCK_SIZE / 4U] = {0};
+  uint32_t count;
+  uint32_t loop = 0U;
+  uint32_t tickstart = HAL_GetTick();
+
+  /* Initialize the Data control register */
+  hsd->Instance->DCTRL = 0;
+
+  /* Configure the SD DPSM (Data Path State Machine) */
+  sdmmc_datainitstructure.DataTimeOut   = SD_TUNING_DATATIMEOUT;
+  sdmmc_datainitstructure.DataLength    = SD_TUNING_BLOCK_SIZE;
+  sdmmc_datainitstructure.DataBlockSize = SDMMC_DATABLOCK_SIZE_64B;
+  sdmmc_datainitstructure.TransferDir   = SDMMC_TRANSFER_DIR_TO_SDMMC;
+  sdmmc_datainitstructure.TransferMode  = SDMMC_TRANSFER_MODE_BLOCK;
+  sdmmc_datainitstructure.DPSM          = SDMMC_DPSM_ENABLE;
+  (void)SDMMC_ConfigData(hsd->Instance, &sdmmc_datainitstructure);
+
+  /* A failing response is reported with the data status: the DPSM is waiting anyway */
+  errorstate = SDMMC_CmdSendTuningBlock(hsd->Instance);
+
+  while (!__HAL_SD_GET_FLAG(hsd, SDMMC_FLAG_RXOVERR | SDMMC_FLAG_DCRCFAIL | SDMMC_FLAG_DTIMEOUT | SDMMC_FLAG_DATAEND))
+  {
+    if ((__HAL_SD_GET_FLAG(hsd, SDMMC_FLAG_RXFIFOHF)) && (loop < 2U))
+    {
+      for (count = 0U; count < 8U; count++)
+      {
+        tuning_block[(8U * loop) + count] = SDMMC_ReadFIFO(hsd->Instance);
+      }
+      loop++;
+    }
+
+    if ((HAL_GetTick() - tickstart) >= SD_TUNING_TIMEOUT)
+    {
+      errorstate |= HAL_SD_ERROR_DATA_TIMEOUT;
+      break;
+    }
+  }
+
+  if (__HAL_SD_GET_FLAG(hsd, SDMMC_FLAG_DTIMEOUT))
+  {
+    errorstate |= HAL_SD_ERROR_DATA_TIMEOUT;
+  }
+  else if (__HAL_SD_GET_FLAG(hsd, SDMMC_FLAG_DCRCFAIL))
+  {
+    errorstate |= HAL_SD_ERROR_DATA_CRC_FAIL;
+  }
+  else if (__HAL_SD_GET_FLAG(hsd, SDMMC_FLAG_RXOVERR))
+  {
+    errorstate |= HAL_SD_ERROR_RX_OVERRUN;
+  }
+  else
+  {
+    /* No error flag set */
+  }
+
+  if (errorstate == HAL_SD_ERROR_NONE)
+  {
+    /* Words are read from the FIFO in little endian order */
+    for (count = 0U; count < SD_TUNING_BLOCK_SIZE; count++)
+    {
+      if (((tuning_block[count / 4U] >> (8U * (count % 4U))) & 0xFFU) != SD_TuningBlockPattern[count])
+      {
+        errorstate = HAL_SD_ERROR_DATA_CRC_FAIL;
+        break;
+      }
+    }
+  }
+  else
+  {
+    /* Discard the data left in the FIFO by the failing phase */
+    hsd->Instance->DCTRL |= SDMMC_DCTRL_FIFORST;
+  }
+
+  /* Clear all the static flags */
+  __HAL_SD_CLEAR_FLAG(hsd, SDMMC_STATIC_FLAGS);
+
+  return errorstate;
+}
+
+/**
+  * @brief  Searches the receive sampling point of the card.
+  * @note   The delay block unit must be calibrated (DelayBlock_Enable()) before:
+  *         the DLYB_MAX_SELECT output phases then cover one SDMMC_CK period.
+  * @param  hsd: SD handle
+  * @retval SD Card error state
+  */
+static uint32_t SD_Tuning(SD_HandleTypeDef *hsd)
+{
+  DLYB_TypeDef *dlyb = SD_GET_DLYB_INSTANCE(hsd->Instance);
+  uint32_t calibrated_sel = dlyb->CFGR & DLYB_CFGR_SEL;
+  uint32_t units = (dlyb->CFGR & DLYB_CFGR_UNIT) >> DLYB_CFGR_UNIT_Pos;
+  uint32_t pass_mask = 0U;
+  uint32_t sel;
+  uint32_t length;
+  uint32_t best_start = 0U;
+  uint32_t best_length = 0U;
+
+  /* Check the tuning block on each output clock phase */
+  for (sel = 0U; sel < DLYB_MAX_SELECT; sel++)
+  {
+    (void)DelayBlock_Configure(dlyb, sel, units);
+    if (SD_SendTuningBlock(hsd) == HAL_SD_ERROR_NONE)
+    {
+      pass_mask |= (1UL << sel);
+    }
+  }
+
+  if (pass_mask == 0U)
+  {
+    /* No sampling point found: restore the calibrated phase */
+    (void)DelayBlock_Configure(dlyb, calibrated_sel, units);
+    return HAL_SD_ERROR_DATA_CRC_FAIL;
+  }
+
+  if (pass_mask == ((1UL << DLYB_MAX_SELECT) - 1U))
+  {
+    best_length = DLYB_MAX_SELECT;
+  }
+  else
+  {
+    /* Longest window of passing phases, the phases wrap around one clock period */
+    for (sel = 0U; sel < DLYB_MAX_SELECT; sel++)
+    {
+      if (((pass_mask & (1UL << sel)) != 0U) &&
+          ((pass_mask & (1UL << ((sel + DLYB_MAX_SELECT - 1U) % DLYB_MAX_SELECT))) == 0U))
+      {
+        length = 0U;
+        while ((pass_mask & (1UL << ((sel + length) % DLYB_MAX_SELECT))) != 0U)
+        {
+          length++;
+        }
+        if (length > best_length)
+        {
+          best_start  = sel;
+          best_length = length;
+        }
+      }
+    }
+  }
+
+  /* Apply the centre of the window */
+  sel = (best_start + (best_length / 2U)) % DLYB_MAX_SELECT;
+  (void)DelayBlock_Configure(dlyb, sel, units);
+
+  hsd->TuningPhaseSel = sel;
+  hsd->TuningUnits = units;
+
+  return HAL_SD_ERROR_NONE;
+}
+#endif /* (DLYB_SDMMC1) || (DLYB_SDMMC2) */
+
 /**
   * @brief Read DMA Buffer 0 Transfer completed callbacks
   * @param hsd: SD handle
@@ -4142,6 +4998,23 @@ __weak void HAL_SDEx_Write_DMADoubleBuf1CpltCallback(SD_HandleTypeDef *hsd)
    */
 }
 
+/**
+  * @brief Write stream buffer transfer completed callback
+  * @param hsd: SD handle
+  * @note  A buffer slot is released : the next buffer can be queued with
+  *        HAL_SDEx_WriteStream_Append().
+  * @retval None
+  */
+__weak void HAL_SDEx_WriteStream_BufferCpltCallback(SD_HandleTypeDef *hsd)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hsd);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_SDEx_WriteStream_BufferCpltCallback can be implemented in the user file
+   */
+}
+
 
 /**
   * @}
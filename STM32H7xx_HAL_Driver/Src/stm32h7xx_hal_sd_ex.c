@@ -27,6 +27,10 @@
    (+) Configure Buffer0 and Buffer1 start address and Buffer size using HAL_SDEx_ConfigDMAMultiBuffer() function.
    (+) Start Read and Write for multibuffer mode using HAL_SDEx_ReadBlocksDMAMultiBuffer()
        and HAL_SDEx_WriteBlocksDMAMultiBuffer() functions.
+   (+) Stream a long write with a single CMD25 using HAL_SDEx_WriteStream_Begin(),
+       then feed the next buffers with HAL_SDEx_WriteStream_Append() from
+       HAL_SDEx_WriteStream_BufferCpltCallback(), and stop early if needed
+       with HAL_SDEx_WriteStream_End().
 
   @endverbatim
   ******************************************************************************
@@ -294,6 +298,233 @@ HAL_StatusTypeDef HAL_SDEx_ChangeDMABuffer(SD_HandleTypeDef *hsd, HAL_SDEx_DMABu
 }
 
 
+/**
+  * @}
+  */
+
+/** @addtogroup SDEx_Exported_Functions_Group2
+  *  @brief   Write stream functions
+  *
+@verbatim
+  ==============================================================================
+          ##### Write stream functions #####
+  ==============================================================================
+  [..]
+    This section provides functions allowing to write a long sequence of blocks
+    with a single open-ended Write Multi Block command (CMD25), fed buffer after
+    buffer without restarting the command:
+    (+) HAL_SDEx_WriteStream_Begin() sends the pre-erase count (ACMD23), starts
+        the CMD25 and the IDMA in double buffer mode on the first two buffers.
+    (+) Each time a buffer has been sent HAL_SDEx_WriteStream_BufferCpltCallback()
+        is called and the next buffer can be queued with
+        HAL_SDEx_WriteStream_Append(). All buffers have the same size
+        (BlocksPerBuffer blocks) as imposed by the IDMA double buffer mode.
+    (+) When all the announced blocks are sent, the Stop Transmission command
+        (CMD12) is sent and HAL_SD_TxCpltCallback() is called.
+    (+) HAL_SDEx_WriteStream_End() ends the stream after the last queued buffer,
+        CMD12 is then sent and HAL_SD_TxCpltCallback() is called.
+    (+) If no buffer was queued in time, the transfer is stopped and
+        HAL_SD_ErrorCallback() is called with HAL_SD_ERROR_TX_UNDERRUN.
+    [..]
+    (@) The pre-erased blocks that are not written have undefined content.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Start a write stream: pre-erase and open a Write Multi Block command
+  *         fed by the Internal DMA in double buffer mode.
+  * @param  hsd: SD handle
+  * @param  BlockAdd: Block Address where data will be written
+  * @param  NumberOfBlocks: Maximum number of blocks of the stream, must be a
+  *         multiple of BlocksPerBuffer
+  * @param  BlocksPerBuffer: Size of each buffer in blocks
+  * @param  pData0: Pointer to the first buffer
+  * @param  pData1: Pointer to the second buffer, may be NULL when the stream
+  *         is made of a single buffer. It may also be queued later with
+  *         HAL_SDEx_WriteStream_Append().
+  * @note   pData0, pData1 and the next buffers must stay valid until
+  *         HAL_SDEx_WriteStream_BufferCpltCallback() releases them.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SDEx_WriteStream_Begin(SD_HandleTypeDef *hsd, uint32_t BlockAdd, uint32_t NumberOfBlocks,
+                                             uint32_t BlocksPerBuffer, const uint8_t *pData0, const uint8_t *pData1)
+{
+  SDMMC_DataInitTypeDef config;
+  uint32_t errorstate;
+  uint32_t add = BlockAdd;
+
+  if ((pData0 == NULL) || (BlocksPerBuffer == 0U) || (NumberOfBlocks == 0U) ||
+      ((NumberOfBlocks % BlocksPerBuffer) != 0U) || (NumberOfBlocks > (SDMMC_DLEN_DATALENGTH / BLOCKSIZE)))
+  {
+    hsd->ErrorCode |= HAL_SD_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  if (hsd->State == HAL_SD_STATE_READY)
+  {
+    hsd->ErrorCode = HAL_SD_ERROR_NONE;
+
+    if ((add + NumberOfBlocks) > (hsd->SdCard.LogBlockNbr))
+    {
+      hsd->ErrorCode |= HAL_SD_ERROR_ADDR_OUT_OF_RANGE;
+      return HAL_ERROR;
+    }
+
+    hsd->State = HAL_SD_STATE_BUSY;
+
+    /* Initialize data control register */
+    hsd->Instance->DCTRL = 0U;
+
+    /* Pre-erase the blocks of the stream (ACMD23) */
+    errorstate = SDMMC_CmdAppCommand(hsd->Instance, (uint32_t)(hsd->SdCard.RelCardAdd << 16U));
+    if (errorstate == HAL_SD_ERROR_NONE)
+    {
+      errorstate = SDMMC_CmdSetWrBlkEraseCount(hsd->Instance, NumberOfBlocks);
+    }
+    if (errorstate != HAL_SD_ERROR_NONE)
+    {
+      __HAL_SD_CLEAR_FLAG(hsd, SDMMC_STATIC_FLAGS);
+      hsd->ErrorCode |= errorstate;
+      hsd->State = HAL_SD_STATE_READY;
+      return HAL_ERROR;
+    }
+
+    if (hsd->SdCard.CardType != CARD_SDHC_SDXC)
+    {
+      add *= 512U;
+    }
+
+    hsd->StreamBufferNbr    = NumberOfBlocks / BlocksPerBuffer;
+    hsd->StreamBufferQueued = ((pData1 != NULL) && (hsd->StreamBufferNbr > 1U)) ? 2U : 1U;
+    hsd->StreamBufferDone   = 0U;
+    hsd->StreamEndRequest   = 0U;
+
+    /* Configure the SD DPSM (Data Path State Machine) */
+    config.DataTimeOut   = SDMMC_DATATIMEOUT;
+    config.DataLength    = BLOCKSIZE * NumberOfBlocks;
+    config.DataBlockSize = SDMMC_DATABLOCK_SIZE_512B;
+    config.TransferDir   = SDMMC_TRANSFER_DIR_TO_CARD;
+    config.TransferMode  = SDMMC_TRANSFER_MODE_BLOCK;
+    config.DPSM          = SDMMC_DPSM_DISABLE;
+    (void)SDMMC_ConfigData(hsd->Instance, &config);
+
+    __SDMMC_CMDTRANS_ENABLE(hsd->Instance);
+
+    hsd->Instance->IDMABASE0 = (uint32_t) pData0;
+    hsd->Instance->IDMABASE1 = (uint32_t)((pData1 != NULL) ? pData1 : pData0);
+    hsd->Instance->IDMABSIZE = (uint32_t)(BLOCKSIZE * BlocksPerBuffer);
+    hsd->Instance->IDMACTRL  = SDMMC_ENABLE_IDMA_DOUBLE_BUFF0;
+
+    /* Write Blocks in DMA mode, CMD12 is sent at the end of the stream */
+    hsd->Context = (SD_CONTEXT_WRITE_MULTIPLE_BLOCK | SD_CONTEXT_DMA | SD_CONTEXT_WRITE_STREAM);
+
+    /* Write Multi Block command */
+    errorstate = SDMMC_CmdWriteMultiBlock(hsd->Instance, add);
+    if (errorstate != HAL_SD_ERROR_NONE)
+    {
+      __SDMMC_CMDTRANS_DISABLE(hsd->Instance);
+      hsd->Instance->IDMACTRL = SDMMC_DISABLE_IDMA;
+      __HAL_SD_CLEAR_FLAG(hsd, SDMMC_STATIC_FLAGS);
+      hsd->ErrorCode |= errorstate;
+      hsd->State = HAL_SD_STATE_READY;
+      hsd->Context = SD_CONTEXT_NONE;
+      return HAL_ERROR;
+    }
+
+    __HAL_SD_ENABLE_IT(hsd, (SDMMC_IT_DCRCFAIL | SDMMC_IT_DTIMEOUT | SDMMC_IT_TXUNDERR | SDMMC_IT_DATAEND |
+                             SDMMC_IT_IDMABTC));
+
+    return HAL_OK;
+  }
+  else
+  {
+    return HAL_BUSY;
+  }
+}
+
+/**
+  * @brief  Queue the next buffer of a write stream.
+  * @param  hsd: SD handle
+  * @param  pData: Pointer to the buffer, of BlocksPerBuffer blocks
+  * @note   At most two buffers are queued at a time: HAL_BUSY is returned
+  *         until HAL_SDEx_WriteStream_BufferCpltCallback() releases a slot.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SDEx_WriteStream_Append(SD_HandleTypeDef *hsd, const uint8_t *pData)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+
+  if (pData == NULL)
+  {
+    hsd->ErrorCode |= HAL_SD_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  /* Prevent the buffer completion interrupt to update the stream counters */
+  __HAL_SD_DISABLE_IT(hsd, SDMMC_IT_IDMABTC);
+
+  if (((hsd->Context & SD_CONTEXT_WRITE_STREAM) == 0U) || (hsd->StreamEndRequest != 0U) ||
+      (hsd->StreamBufferQueued >= hsd->StreamBufferNbr))
+  {
+    hsd->ErrorCode |= HAL_SD_ERROR_REQUEST_NOT_APPLICABLE;
+    status = HAL_ERROR;
+  }
+  else if (hsd->StreamBufferQueued >= (hsd->StreamBufferDone + 2U))
+  {
+    status = HAL_BUSY;
+  }
+  else
+  {
+    /* Buffers are used alternately by IDMABASE0 and IDMABASE1 */
+    if ((hsd->StreamBufferQueued & 1U) == 0U)
+    {
+      hsd->Instance->IDMABASE0 = (uint32_t)pData;
+    }
+    else
+    {
+      hsd->Instance->IDMABASE1 = (uint32_t)pData;
+    }
+    hsd->StreamBufferQueued++;
+  }
+
+  if ((hsd->Context & SD_CONTEXT_WRITE_STREAM) != 0U)
+  {
+    __HAL_SD_ENABLE_IT(hsd, SDMMC_IT_IDMABTC);
+  }
+
+  return status;
+}
+
+/**
+  * @brief  End a write stream after the last queued buffer.
+  * @param  hsd: SD handle
+  * @note   The Stop Transmission command (CMD12) is sent once the last queued
+  *         buffer is written, then HAL_SD_TxCpltCallback() is called.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SDEx_WriteStream_End(SD_HandleTypeDef *hsd)
+{
+  if ((hsd->Context & SD_CONTEXT_WRITE_STREAM) == 0U)
+  {
+    /* The stream may already be completed */
+    return (hsd->State == HAL_SD_STATE_READY) ? HAL_OK : HAL_ERROR;
+  }
+
+  __HAL_SD_DISABLE_IT(hsd, SDMMC_IT_IDMABTC);
+
+  /* When all buffers are queued the data end interrupt closes the stream */
+  hsd->StreamEndRequest = 1U;
+
+  if ((hsd->Context & SD_CONTEXT_WRITE_STREAM) != 0U)
+  {
+    __HAL_SD_ENABLE_IT(hsd, SDMMC_IT_IDMABTC);
+  }
+
+  return HAL_OK;
+}
+
 /**
   * @}
   */
@@ -0,0 +1,1442 @@
+/**
+  ******************************************************************************
+  * @file    stm32h7xx_hal_sdio.c
+  * @author  MCD Application Team
+  * @brief   SDIO HAL module driver.
+  *          This file provides firmware functions to manage the following
+  *          functionalities of the SD Input/Output (SDIO) card protocol over
+  *          the SDMMC peripheral:
+  *           + Initialization and de-initialization functions
+  *           + IO operation functions
+  *           + Peripheral Control functions
+  *           + Peripheral State functions
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  @verbatim
+  ==============================================================================
+                        ##### How to use this driver #####
+  ==============================================================================
+  [..]
+    This driver implements the function layer of SDIO cards such as WiFi or
+    Bluetooth modules: direct register accesses (CMD52), byte and block transfers
+    (CMD53) driven by the SDMMC internal DMA (IDMA), and the card interrupt
+    signalled on the DAT[1] line.
+
+    (#) Initialize the SDMMC low level resources by implementing the HAL_SDIO_MspInit() API:
+        (##) Enable the SDMMC interface clock and configure its kernel clock source.
+        (##) SDMMC pins configuration for the SDIO card
+            (+++) Enable the clock for the SDMMC GPIOs using __HAL_RCC_GPIOx_CLK_ENABLE().
+            (+++) Configure these SDMMC pins as alternate function pull-up using HAL_GPIO_Init()
+                  and according to your pin assignment;
+        (##) NVIC configuration: the IDMA transfers and the card interrupt are both
+             reported on the SDMMC global interrupt
+            (+++) Configure the SDMMC interrupt priorities using function HAL_NVIC_SetPriority();
+            (+++) Enable the NVIC SDMMC IRQs using function HAL_NVIC_EnableIRQ()
+            (+++) Call HAL_SDIO_IRQHandler() from the SDMMC IRQ handler.
+
+    (#) Fill hsdio->Init with the configuration to use once the card is identified,
+        for instance a 4-bit bus (SDMMC_BUS_WIDE_4B) and a ClockDiv giving 50 MHz,
+        then call HAL_SDIO_Init(). The card is identified at 400 kHz on a 1-bit bus
+        (CMD0, CMD5, CMD3, CMD7), the bus width is then programmed in the CCCR,
+        the high speed mode is enabled when the card supports it and the user
+        configuration is finally applied to the SDMMC.
+
+    (#) Enable the needed I/O functions with HAL_SDIO_EnableIOFunction() and
+        program their block size with HAL_SDIO_SetBlockSize().
+
+    (#) Access the card registers with HAL_SDIO_ReadDirect() and HAL_SDIO_WriteDirect()
+        (CMD52, blocking).
+
+    (#) Transfer data with HAL_SDIO_ReadExtended_DMA() and HAL_SDIO_WriteExtended_DMA()
+        (CMD53, non blocking):
+        (+) In HAL_SDIO_MODE_BYTE, up to 512 bytes are transferred.
+        (+) In HAL_SDIO_MODE_BLOCK, Size must be a multiple of the function block
+            size and up to 511 blocks are transferred by a single command, without
+            any software intervention between the blocks.
+        (+) The end of the transfer is notified by HAL_SDIO_RxCpltCallback() or
+            HAL_SDIO_TxCpltCallback(), an error by HAL_SDIO_ErrorCallback(). On a
+            data error the transfer is aborted in the card through the CCCR I/O
+            abort register.
+        (+) The buffer must be 32-bit aligned. When it is located in a cacheable
+            memory area, the cache maintenance is under the application responsibility.
+
+    (#) Card interrupt:
+        (+) Enable the interrupt of a function with HAL_SDIO_EnableIOFunctionInterrupt().
+        (+) When the card asserts its interrupt, the SDMMC card interrupt is masked
+            and HAL_SDIO_IOFunctionCallback() is called. The pending functions can be
+            read from SDIO_CCCR_INT_PENDING with HAL_SDIO_ReadDirect().
+        (+) Once the card interrupt source is serviced, call HAL_SDIO_AcknowledgeIOInterrupt()
+            to unmask the card interrupt again.
+
+    *** Callback registration ***
+    =============================================
+    [..]
+    The compilation define USE_HAL_SDIO_REGISTER_CALLBACKS when set to 1
+    allows the user to configure dynamically the driver callbacks.
+
+    Use Functions HAL_SDIO_RegisterCallback() to register a user callback,
+    it allows to register following callbacks:
+      (+) TxCpltCallback     : callback when a CMD53 write is completed.
+      (+) RxCpltCallback     : callback when a CMD53 read is completed.
+      (+) ErrorCallback      : callback when error occurs.
+      (+) IOFunctionCallback : callback when the card interrupt is asserted.
+      (+) MspInitCallback    : SDIO MspInit.
+      (+) MspDeInitCallback  : SDIO MspDeInit.
+    This function takes as parameters the HAL peripheral handle, the Callback ID
+    and a pointer to the user callback function.
+
+    Use function HAL_SDIO_UnRegisterCallback() to reset a callback to the default
+    weak (surcharged) function. It allows to reset following callbacks:
+      (+) TxCpltCallback     : callback when a CMD53 write is completed.
+      (+) RxCpltCallback     : callback when a CMD53 read is completed.
+      (+) ErrorCallback      : callback when error occurs.
+      (+) IOFunctionCallback : callback when the card interrupt is asserted.
+      (+) MspInitCallback    : SDIO MspInit.
+      (+) MspDeInitCallback  : SDIO MspDeInit.
+    This function takes as parameters the HAL peripheral handle and the Callback ID.
+
+    By default, after the HAL_SDIO_Init and if the state is HAL_SDIO_STATE_RESET
+    all callbacks are reset to the corresponding legacy weak (surcharged) functions.
+    Exception done for MspInit and MspDeInit callbacks that are respectively
+    reset to the legacy weak (surcharged) functions in the HAL_SDIO_Init
+    and HAL_SDIO_DeInit only when these callbacks are null (not registered beforehand).
+
+    Callbacks can be registered/unregistered in READY state only.
+    Exception done for MspInit/MspDeInit callbacks that can be registered/unregistered
+    in READY or RESET state, thus registered (user) MspInit/DeInit callbacks can be used
+    during the Init/DeInit.
+
+    When The compilation define USE_HAL_SDIO_REGISTER_CALLBACKS is set to 0 or
+    not defined, the callback registering feature is not available
+    and weak (surcharged) callbacks are used.
+
+  @endverbatim
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32h7xx_hal.h"
+
+/** @addtogroup STM32H7xx_HAL_Driver
+  * @{
+  */
+
+/** @addtogroup SDIO
+  * @{
+  */
+
+#ifdef HAL_SDIO_MODULE_ENABLED
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/** @addtogroup SDIO_Private_Defines
+  * @{
+  */
+#define SDIO_READ                      0U           /* CMD52/CMD53 read */
+#define SDIO_WRITE                     1U           /* CMD52/CMD53 write */
+
+#define SDIO_OCR_READY                 0x80000000U  /* R4 C bit : card ready after power up */
+#define SDIO_OCR_VDD_WINDOW            0x00FFFFFFU  /* R4 I/O OCR voltage window */
+
+#define SDIO_BUS_WIDTH_MASK            0x03U        /* CCCR bus interface : bus width field */
+#define SDIO_BUS_WIDTH_4B              0x02U        /* CCCR bus interface : 4-bit bus */
+#define SDIO_BUS_SPEED_SHS             0x01U        /* CCCR bus speed : high speed supported */
+#define SDIO_BUS_SPEED_EHS             0x02U        /* CCCR bus speed : high speed enabled */
+#define SDIO_INT_ENABLE_IENM           0x01U        /* CCCR interrupt enable : master enable */
+
+#define SDIO_FBR_BASE(FUNC)            ((FUNC) * 0x100U) /* Function basic registers base */
+#define SDIO_FBR_BLOCK_SIZE            0x10U        /* FBR : function block size (2 bytes) */
+#define SDIO_MAX_BLOCK_SIZE            2048U        /* Largest block size of the SDMMC DPSM */
+#define SDIO_MAX_BYTE_COUNT            512U         /* Byte mode : largest count */
+#define SDIO_MAX_BLOCK_COUNT           511U         /* Block mode : largest count */
+
+/* Data interrupts enabled during a CMD53 transfer */
+#define SDIO_IT_XFER                   (SDMMC_IT_DATAEND | SDMMC_IT_DCRCFAIL | SDMMC_IT_DTIMEOUT | \
+                                        SDMMC_IT_TXUNDERR | SDMMC_IT_RXOVERR)
+/**
+  * @}
+  */
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+/** @defgroup SDIO_Private_Functions SDIO Private Functions
+  * @{
+  */
+static uint32_t SDIO_InitCard(SDIO_HandleTypeDef *hsdio);
+static uint32_t SDIO_IOReadWriteDirect(SDIO_HandleTypeDef *hsdio, uint32_t Direction, uint32_t IOFunctionNbr,
+                                       uint32_t RegAddr, uint8_t Data, uint8_t *pData);
+static HAL_StatusTypeDef SDIO_IOReadWriteExtended_DMA(SDIO_HandleTypeDef *hsdio, uint32_t Direction,
+                                                      const SDIO_ExtendedCmdTypeDef *pArgument, uint8_t *pData,
+                                                      uint32_t Size);
+static void SDIO_StopTransfer(SDIO_HandleTypeDef *hsdio);
+/**
+  * @}
+  */
+
+/* Exported functions --------------------------------------------------------*/
+/** @addtogroup SDIO_Exported_Functions
+  * @{
+  */
+
+/** @addtogroup SDIO_Exported_Functions_Group1
+  *  @brief   Initialization and de-initialization functions
+  *
+@verbatim
+  ==============================================================================
+          ##### Initialization and de-initialization functions #####
+  ==============================================================================
+  [..]
+    This section provides functions allowing to initialize/de-initialize the SDIO
+    card device to be ready for use.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Initializes the SDIO card according to the specified parameters in the
+            SDIO_HandleTypeDef and create the associated handle.
+  * @note   The card is identified at 400 kHz on a 1-bit bus then hsdio->Init is
+  *         applied, the bus width being programmed in the card CCCR.
+  * @param  hsdio: Pointer to the SDIO handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SDIO_Init(SDIO_HandleTypeDef *hsdio)
+{
+  SDIO_InitTypeDef Init;
+  uint32_t sdmmc_clk;
+  uint32_t errorstate;
+  uint32_t count;
+  uint8_t data;
+
+  /* Check the SDIO handle allocation */
+  if (hsdio == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the parameters */
+  assert_param(IS_SDMMC_ALL_INSTANCE(hsdio->Instance));
+  assert_param(IS_SDMMC_CLOCK_EDGE(hsdio->Init.ClockEdge));
+  assert_param(IS_SDMMC_CLOCK_POWER_SAVE(hsdio->Init.ClockPowerSave));
+  assert_param(IS_SDMMC_BUS_WIDE(hsdio->Init.BusWide));
+  assert_param(IS_SDMMC_HARDWARE_FLOW_CONTROL(hsdio->Init.HardwareFlowControl));
+  assert_param(IS_SDMMC_CLKDIV(hsdio->Init.ClockDiv));
+
+  /* SDIO cards have no 8-bit bus */
+  if (hsdio->Init.BusWide == SDMMC_BUS_WIDE_8B)
+  {
+    hsdio->ErrorCode = HAL_SDIO_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  if (hsdio->State == HAL_SDIO_STATE_RESET)
+  {
+    /* Allocate lock resource and initialize it */
+    hsdio->Lock = HAL_UNLOCKED;
+
+#if defined (USE_HAL_SDIO_REGISTER_CALLBACKS) && (USE_HAL_SDIO_REGISTER_CALLBACKS == 1U)
+    /* Reset Callback pointers in HAL_SDIO_STATE_RESET only */
+    hsdio->TxCpltCallback     = HAL_SDIO_TxCpltCallback;
+    hsdio->RxCpltCallback     = HAL_SDIO_RxCpltCallback;
+    hsdio->ErrorCallback      = HAL_SDIO_ErrorCallback;
+    hsdio->IOFunctionCallback = HAL_SDIO_IOFunctionCallback;
+
+    if (hsdio->MspInitCallback == NULL)
+    {
+      hsdio->MspInitCallback = HAL_SDIO_MspInit;
+    }
+
+    /* Init the low level hardware */
+    hsdio->MspInitCallback(hsdio);
+#else
+    /* Init the low level hardware : GPIO, CLOCK, CORTEX...etc */
+    HAL_SDIO_MspInit(hsdio);
+#endif /* USE_HAL_SDIO_REGISTER_CALLBACKS */
+  }
+
+  hsdio->State = HAL_SDIO_STATE_BUSY;
+  hsdio->ErrorCode = HAL_SDIO_ERROR_NONE;
+
+  /* Default SDMMC peripheral configuration for SDIO card identification */
+  Init.ClockEdge           = SDMMC_CLOCK_EDGE_RISING;
+  Init.ClockPowerSave      = SDMMC_CLOCK_POWER_SAVE_DISABLE;
+  Init.BusWide             = SDMMC_BUS_WIDE_1B;
+  Init.HardwareFlowControl = SDMMC_HARDWARE_FLOW_CONTROL_DISABLE;
+#if (USE_SD_TRANSCEIVER != 0U)
+  Init.TranceiverPresent   = SDMMC_TRANSCEIVER_NOT_PRESENT;
+#endif /* USE_SD_TRANSCEIVER */
+
+  /* Init Clock should be less or equal to 400Khz*/
+  sdmmc_clk = HAL_RCCEx_GetPeriphCLKFreq(RCC_PERIPHCLK_SDMMC);
+  if (sdmmc_clk == 0U)
+  {
+    hsdio->State = HAL_SDIO_STATE_READY;
+    hsdio->ErrorCode = HAL_SDIO_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+  Init.ClockDiv = sdmmc_clk / (2U * SDIO_INIT_FREQ);
+
+  /* Initialize SDMMC peripheral interface with default configuration */
+  (void)SDMMC_Init(hsdio->Instance, Init);
+
+  /* Set Power State to ON */
+  (void)SDMMC_PowerState_ON(hsdio->Instance);
+
+  /* wait 74 Cycles: required power up waiting time before starting
+     the SDIO initialization sequence */
+  if (Init.ClockDiv != 0U)
+  {
+    sdmmc_clk = sdmmc_clk / (2U * Init.ClockDiv);
+  }
+
+  if (sdmmc_clk != 0U)
+  {
+    HAL_Delay(1U + (74U * 1000U / (sdmmc_clk)));
+  }
+
+  /* Card identification */
+  errorstate = SDIO_InitCard(hsdio);
+  if (errorstate != HAL_SDIO_ERROR_NONE)
+  {
+    /* Clear all the static flags */
+    __HAL_SDIO_CLEAR_FLAG(hsdio, SDMMC_STATIC_FLAGS);
+    hsdio->ErrorCode |= errorstate;
+    hsdio->State = HAL_SDIO_STATE_READY;
+    return HAL_ERROR;
+  }
+
+  /* Program the bus width in the card */
+  if (hsdio->Init.BusWide == SDMMC_BUS_WIDE_4B)
+  {
+    errorstate = SDIO_IOReadWriteDirect(hsdio, SDIO_READ, 0U, SDIO_CCCR_BUS_INTERFACE, 0U, &data);
+    if (errorstate == HAL_SDIO_ERROR_NONE)
+    {
+      data = (uint8_t)((data & ~SDIO_BUS_WIDTH_MASK) | SDIO_BUS_WIDTH_4B);
+      errorstate = SDIO_IOReadWriteDirect(hsdio, SDIO_WRITE, 0U, SDIO_CCCR_BUS_INTERFACE, data, NULL);
+    }
+  }
+
+  /* Enable the high speed mode when the card supports it */
+  if (errorstate == HAL_SDIO_ERROR_NONE)
+  {
+    errorstate = SDIO_IOReadWriteDirect(hsdio, SDIO_READ, 0U, SDIO_CCCR_BUS_SPEED, 0U, &data);
+    if ((errorstate == HAL_SDIO_ERROR_NONE) && ((data & SDIO_BUS_SPEED_SHS) != 0U))
+    {
+      errorstate = SDIO_IOReadWriteDirect(hsdio, SDIO_WRITE, 0U, SDIO_CCCR_BUS_SPEED,
+                                          (uint8_t)(data | SDIO_BUS_SPEED_EHS), NULL);
+    }
+  }
+
+  if (errorstate != HAL_SDIO_ERROR_NONE)
+  {
+    /* Clear all the static flags */
+    __HAL_SDIO_CLEAR_FLAG(hsdio, SDMMC_STATIC_FLAGS);
+    hsdio->ErrorCode |= errorstate;
+    hsdio->State = HAL_SDIO_STATE_READY;
+    return HAL_ERROR;
+  }
+
+  /* Apply the user configuration: bus width and transfer clock */
+  (void)SDMMC_Init(hsdio->Instance, hsdio->Init);
+
+  /* The DPSM performs the SDIO specific operations (card interrupt period) */
+  __SDMMC_OPERATION_ENABLE(hsdio->Instance);
+
+  /* Block sizes are unknown until programmed by HAL_SDIO_SetBlockSize() */
+  for (count = 0U; count < SDIO_MAX_IO_NUMBER; count++)
+  {
+    hsdio->BlockSize[count] = 0U;
+  }
+  hsdio->IOFunctionMask = 0U;
+
+  /* Initialize the SDIO operation */
+  hsdio->Context = SDIO_CONTEXT_NONE;
+
+  /* Initialize the SDIO state */
+  hsdio->State = HAL_SDIO_STATE_READY;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  De-Initializes the SDIO card.
+  * @param  hsdio: Pointer to SDIO handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SDIO_DeInit(SDIO_HandleTypeDef *hsdio)
+{
+  /* Check the SDIO handle allocation */
+  if (hsdio == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the parameters */
+  assert_param(IS_SDMMC_ALL_INSTANCE(hsdio->Instance));
+
+  hsdio->State = HAL_SDIO_STATE_BUSY;
+
+  /* Mask the interrupts and set the SDMMC power state to off */
+  __HAL_SDIO_DISABLE_IT(hsdio, SDIO_IT_XFER | SDMMC_IT_SDIOIT);
+  hsdio->Instance->DCTRL = 0U;
+  (void)SDMMC_PowerState_OFF(hsdio->Instance);
+
+#if defined (USE_HAL_SDIO_REGISTER_CALLBACKS) && (USE_HAL_SDIO_REGISTER_CALLBACKS == 1U)
+  if (hsdio->MspDeInitCallback == NULL)
+  {
+    hsdio->MspDeInitCallback = HAL_SDIO_MspDeInit;
+  }
+
+  /* DeInit the low level hardware */
+  hsdio->MspDeInitCallback(hsdio);
+#else
+  /* De-Initialize the MSP layer */
+  HAL_SDIO_MspDeInit(hsdio);
+#endif /* USE_HAL_SDIO_REGISTER_CALLBACKS */
+
+  hsdio->IOFunctionMask = 0U;
+  hsdio->Context = SDIO_CONTEXT_NONE;
+  hsdio->ErrorCode = HAL_SDIO_ERROR_NONE;
+  hsdio->State = HAL_SDIO_STATE_RESET;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Initializes the SDIO MSP.
+  * @param  hsdio: Pointer to SDIO handle
+  * @retval None
+  */
+__weak void HAL_SDIO_MspInit(SDIO_HandleTypeDef *hsdio)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hsdio);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_SDIO_MspInit could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  De-Initialize SDIO MSP.
+  * @param  hsdio: Pointer to SDIO handle
+  * @retval None
+  */
+__weak void HAL_SDIO_MspDeInit(SDIO_HandleTypeDef *hsdio)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hsdio);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_SDIO_MspDeInit could be implemented in the user file
+   */
+}
+
+/**
+  * @}
+  */
+
+/** @addtogroup SDIO_Exported_Functions_Group2
+  *  @brief   Data transfer functions
+  *
+@verbatim
+  ==============================================================================
+                        ##### IO operation functions #####
+  ==============================================================================
+  [..]
+    This subsection provides a set of functions allowing to access the card
+    registers with CMD52 and to transfer data with CMD53.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Reads one byte from a card register (CMD52). The access is blocking.
+  * @param  hsdio: Pointer to SDIO handle
+  * @param  IOFunctionNbr: I/O function number, from 0 (CIA) to 7
+  * @param  RegAddr: Register address in the function, 17 bits
+  * @param  pData: Pointer to the byte that will contain the register value
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SDIO_ReadDirect(SDIO_HandleTypeDef *hsdio, uint32_t IOFunctionNbr, uint32_t RegAddr,
+                                      uint8_t *pData)
+{
+  uint32_t errorstate;
+
+  assert_param(IS_SDIO_FUNCTION(IOFunctionNbr));
+  assert_param(IS_SDIO_REG_ADDR(RegAddr));
+
+  if (NULL == pData)
+  {
+    hsdio->ErrorCode |= HAL_SDIO_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  if (hsdio->State != HAL_SDIO_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  hsdio->State = HAL_SDIO_STATE_BUSY;
+
+  errorstate = SDIO_IOReadWriteDirect(hsdio, SDIO_READ, IOFunctionNbr, RegAddr, 0U, pData);
+
+  hsdio->State = HAL_SDIO_STATE_READY;
+
+  if (errorstate != HAL_SDIO_ERROR_NONE)
+  {
+    /* Clear all the static flags */
+    __HAL_SDIO_CLEAR_FLAG(hsdio, SDMMC_STATIC_FLAGS);
+    hsdio->ErrorCode |= errorstate;
+    return HAL_ERROR;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Writes one byte to a card register (CMD52). The access is blocking.
+  * @param  hsdio: Pointer to SDIO handle
+  * @param  IOFunctionNbr: I/O function number, from 0 (CIA) to 7
+  * @param  RegAddr: Register address in the function, 17 bits
+  * @param  Data: Value to write
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SDIO_WriteDirect(SDIO_HandleTypeDef *hsdio, uint32_t IOFunctionNbr, uint32_t RegAddr,
+                                       uint8_t Data)
+{
+  uint32_t errorstate;
+
+  assert_param(IS_SDIO_FUNCTION(IOFunctionNbr));
+  assert_param(IS_SDIO_REG_ADDR(RegAddr));
+
+  if (hsdio->State != HAL_SDIO_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  hsdio->State = HAL_SDIO_STATE_BUSY;
+
+  errorstate = SDIO_IOReadWriteDirect(hsdio, SDIO_WRITE, IOFunctionNbr, RegAddr, Data, NULL);
+
+  hsdio->State = HAL_SDIO_STATE_READY;
+
+  if (errorstate != HAL_SDIO_ERROR_NONE)
+  {
+    /* Clear all the static flags */
+    __HAL_SDIO_CLEAR_FLAG(hsdio, SDMMC_STATIC_FLAGS);
+    hsdio->ErrorCode |= errorstate;
+    return HAL_ERROR;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Reads data from the card (CMD53) in non blocking mode, the data being
+  *         moved by the SDMMC IDMA.
+  * @note   The end of the transfer is notified by HAL_SDIO_RxCpltCallback().
+  * @param  hsdio: Pointer to SDIO handle
+  * @param  pArgument: Pointer to the CMD53 argument (function, address, OP code, mode)
+  * @param  pData: Pointer to the buffer that will contain the received data,
+  *         32-bit aligned
+  * @param  Size: Number of bytes to read. In HAL_SDIO_MODE_BYTE, up to 512.
+  *         In HAL_SDIO_MODE_BLOCK, a multiple of the function block size.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SDIO_ReadExtended_DMA(SDIO_HandleTypeDef *hsdio, const SDIO_ExtendedCmdTypeDef *pArgument,
+                                            uint8_t *pData, uint32_t Size)
+{
+  return SDIO_IOReadWriteExtended_DMA(hsdio, SDIO_READ, pArgument, pData, Size);
+}
+
+/**
+  * @brief  Writes data to the card (CMD53) in non blocking mode, the data being
+  *         moved by the SDMMC IDMA.
+  * @note   The end of the transfer is notified by HAL_SDIO_TxCpltCallback().
+  * @param  hsdio: Pointer to SDIO handle
+  * @param  pArgument: Pointer to the CMD53 argument (function, address, OP code, mode)
+  * @param  pData: Pointer to the buffer that contains the data to transmit,
+  *         32-bit aligned
+  * @param  Size: Number of bytes to write. In HAL_SDIO_MODE_BYTE, up to 512.
+  *         In HAL_SDIO_MODE_BLOCK, a multiple of the function block size.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SDIO_WriteExtended_DMA(SDIO_HandleTypeDef *hsdio, const SDIO_ExtendedCmdTypeDef *pArgument,
+                                             const uint8_t *pData, uint32_t Size)
+{
+  /* The IDMA only reads the buffer in this direction */
+  return SDIO_IOReadWriteExtended_DMA(hsdio, SDIO_WRITE, pArgument, (uint8_t *)pData, Size);
+}
+
+/**
+  * @brief  This function handles SDIO interrupt request.
+  * @param  hsdio: Pointer to SDIO handle
+  * @retval None
+  */
+void HAL_SDIO_IRQHandler(SDIO_HandleTypeDef *hsdio)
+{
+  uint32_t context = hsdio->Context;
+
+  if ((context != SDIO_CONTEXT_NONE) && (__HAL_SDIO_GET_FLAG(hsdio, SDMMC_FLAG_DATAEND) != RESET))
+  {
+    __HAL_SDIO_CLEAR_FLAG(hsdio, SDMMC_FLAG_DATAEND);
+
+    SDIO_StopTransfer(hsdio);
+
+    /* Clear all the static flags */
+    __HAL_SDIO_CLEAR_FLAG(hsdio, SDMMC_STATIC_DATA_FLAGS);
+
+    hsdio->State = HAL_SDIO_STATE_READY;
+    hsdio->Context = SDIO_CONTEXT_NONE;
+    if ((context & SDIO_CONTEXT_READ) != 0U)
+    {
+#if defined (USE_HAL_SDIO_REGISTER_CALLBACKS) && (USE_HAL_SDIO_REGISTER_CALLBACKS == 1U)
+      hsdio->RxCpltCallback(hsdio);
+#else
+      HAL_SDIO_RxCpltCallback(hsdio);
+#endif /* USE_HAL_SDIO_REGISTER_CALLBACKS */
+    }
+    else
+    {
+#if defined (USE_HAL_SDIO_REGISTER_CALLBACKS) && (USE_HAL_SDIO_REGISTER_CALLBACKS == 1U)
+      hsdio->TxCpltCallback(hsdio);
+#else
+      HAL_SDIO_TxCpltCallback(hsdio);
+#endif /* USE_HAL_SDIO_REGISTER_CALLBACKS */
+    }
+  }
+  else if ((context != SDIO_CONTEXT_NONE) &&
+           (__HAL_SDIO_GET_FLAG(hsdio, SDMMC_FLAG_DCRCFAIL | SDMMC_FLAG_DTIMEOUT | SDMMC_FLAG_RXOVERR |
+                                SDMMC_FLAG_TXUNDERR) != RESET))
+  {
+    /* Set Error code */
+    if (__HAL_SDIO_GET_FLAG(hsdio, SDMMC_FLAG_DCRCFAIL) != RESET)
+    {
+      hsdio->ErrorCode |= HAL_SDIO_ERROR_DATA_CRC_FAIL;
+    }
+    if (__HAL_SDIO_GET_FLAG(hsdio, SDMMC_FLAG_DTIMEOUT) != RESET)
+    {
+      hsdio->ErrorCode |= HAL_SDIO_ERROR_DATA_TIMEOUT;
+    }
+    if (__HAL_SDIO_GET_FLAG(hsdio, SDMMC_FLAG_RXOVERR) != RESET)
+    {
+      hsdio->ErrorCode |= HAL_SDIO_ERROR_RX_OVERRUN;
+    }
+    if (__HAL_SDIO_GET_FLAG(hsdio, SDMMC_FLAG_TXUNDERR) != RESET)
+    {
+      hsdio->ErrorCode |= HAL_SDIO_ERROR_TX_UNDERRUN;
+    }
+
+    /* Clear All flags */
+    __HAL_SDIO_CLEAR_FLAG(hsdio, SDMMC_STATIC_DATA_FLAGS);
+
+    SDIO_StopTransfer(hsdio);
+    hsdio->Instance->DCTRL |= SDMMC_DCTRL_FIFORST;
+
+    /* Abort the transfer in the card: CMD52 write of the function number in
+       the CCCR I/O abort register, sent as a stop command to reset the DPSM */
+    hsdio->Instance->CMD |= SDMMC_CMD_CMDSTOP;
+    hsdio->ErrorCode |= SDIO_IOReadWriteDirect(hsdio, SDIO_WRITE, 0U, SDIO_CCCR_IO_ABORT,
+                                               (uint8_t)hsdio->XferFunction, NULL);
+    hsdio->Instance->CMD &= ~(SDMMC_CMD_CMDSTOP);
+    __HAL_SDIO_CLEAR_FLAG(hsdio, SDMMC_FLAG_DABORT);
+
+    hsdio->State = HAL_SDIO_STATE_READY;
+    hsdio->Context = SDIO_CONTEXT_NONE;
+#if defined (USE_HAL_SDIO_REGISTER_CALLBACKS) && (USE_HAL_SDIO_REGISTER_CALLBACKS == 1U)
+    hsdio->ErrorCallback(hsdio);
+#else
+    HAL_SDIO_ErrorCallback(hsdio);
+#endif /* USE_HAL_SDIO_REGISTER_CALLBACKS */
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+
+  /* Card interrupt: masked until acknowledged by HAL_SDIO_AcknowledgeIOInterrupt() */
+  if ((__HAL_SDIO_GET_FLAG(hsdio, SDMMC_FLAG_SDIOIT) != RESET) &&
+      ((hsdio->Instance->MASK & SDMMC_IT_SDIOIT) != 0U))
+  {
+    __HAL_SDIO_DISABLE_IT(hsdio, SDMMC_IT_SDIOIT);
+    __HAL_SDIO_CLEAR_FLAG(hsdio, SDMMC_FLAG_SDIOIT);
+
+#if defined (USE_HAL_SDIO_REGISTER_CALLBACKS) && (USE_HAL_SDIO_REGISTER_CALLBACKS == 1U)
+    hsdio->IOFunctionCallback(hsdio);
+#else
+    HAL_SDIO_IOFunctionCallback(hsdio);
+#endif /* USE_HAL_SDIO_REGISTER_CALLBACKS */
+  }
+}
+
+/**
+  * @brief Tx Transfer completed callbacks
+  * @param hsdio: Pointer to SDIO handle
+  * @retval None
+  */
+__weak void HAL_SDIO_TxCpltCallback(SDIO_HandleTypeDef *hsdio)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hsdio);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_SDIO_TxCpltCallback can be implemented in the user file
+   */
+}
+
+/**
+  * @brief Rx Transfer completed callbacks
+  * @param hsdio: Pointer SDIO handle
+  * @retval None
+  */
+__weak void HAL_SDIO_RxCpltCallback(SDIO_HandleTypeDef *hsdio)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hsdio);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_SDIO_RxCpltCallback can be implemented in the user file
+   */
+}
+
+/**
+  * @brief SDIO error callbacks
+  * @param hsdio: Pointer SDIO handle
+  * @retval None
+  */
+__weak void HAL_SDIO_ErrorCallback(SDIO_HandleTypeDef *hsdio)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hsdio);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_SDIO_ErrorCallback can be implemented in the user file
+   */
+}
+
+/**
+  * @brief SDIO card interrupt callbacks
+  * @note  The card interrupt stays masked until HAL_SDIO_AcknowledgeIOInterrupt()
+  *        is called.
+  * @param hsdio: Pointer SDIO handle
+  * @retval None
+  */
+__weak void HAL_SDIO_IOFunctionCallback(SDIO_HandleTypeDef *hsdio)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hsdio);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_SDIO_IOFunctionCallback can be implemented in the user file
+   */
+}
+
+#if defined (USE_HAL_SDIO_REGISTER_CALLBACKS) && (USE_HAL_SDIO_REGISTER_CALLBACKS == 1U)
+/**
+  * @brief  Register a User SDIO Callback
+  *         To be used instead of the weak (surcharged) predefined callback
+  * @note   The HAL_SDIO_RegisterCallback() may be called before HAL_SDIO_Init() in
+  *         HAL_SDIO_STATE_RESET to register callbacks for HAL_SDIO_MSP_INIT_CB_ID
+  *         and HAL_SDIO_MSP_DEINIT_CB_ID.
+  * @param hsdio : SDIO handle
+  * @param CallbackID : ID of the callback to be registered
+  *        This parameter can be one of the following values:
+  *          @arg @ref HAL_SDIO_TX_CPLT_CB_ID     SDIO Tx Complete Callback ID
+  *          @arg @ref HAL_SDIO_RX_CPLT_CB_ID     SDIO Rx Complete Callback ID
+  *          @arg @ref HAL_SDIO_ERROR_CB_ID       SDIO Error Callback ID
+  *          @arg @ref HAL_SDIO_IO_FUNCTION_CB_ID SDIO card interrupt Callback ID
+  *          @arg @ref HAL_SDIO_MSP_INIT_CB_ID    SDIO MspInit Callback ID
+  *          @arg @ref HAL_SDIO_MSP_DEINIT_CB_ID  SDIO MspDeInit Callback ID
+  * @param pCallback : pointer to the Callback function
+  * @retval status
+  */
+HAL_StatusTypeDef HAL_SDIO_RegisterCallback(SDIO_HandleTypeDef *hsdio, HAL_SDIO_CallbackIDTypeDef CallbackID,
+                                            pSDIO_CallbackTypeDef pCallback)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+
+  if (pCallback == NULL)
+  {
+    /* Update the error code */
+    hsdio->ErrorCode |= HAL_SDIO_ERROR_INVALID_CALLBACK;
+    return HAL_ERROR;
+  }
+
+  if (hsdio->State == HAL_SDIO_STATE_READY)
+  {
+    switch (CallbackID)
+    {
+      case HAL_SDIO_TX_CPLT_CB_ID :
+        hsdio->TxCpltCallback = pCallback;
+        break;
+      case HAL_SDIO_RX_CPLT_CB_ID :
+        hsdio->RxCpltCallback = pCallback;
+        break;
+      case HAL_SDIO_ERROR_CB_ID :
+        hsdio->ErrorCallback = pCallback;
+        break;
+      case HAL_SDIO_IO_FUNCTION_CB_ID :
+        hsdio->IOFunctionCallback = pCallback;
+        break;
+      case HAL_SDIO_MSP_INIT_CB_ID :
+        hsdio->MspInitCallback = pCallback;
+        break;
+      case HAL_SDIO_MSP_DEINIT_CB_ID :
+        hsdio->MspDeInitCallback = pCallback;
+        break;
+      default :
+        /* Update the error code */
+        hsdio->ErrorCode |= HAL_SDIO_ERROR_INVALID_CALLBACK;
+        /* update return status */
+        status =  HAL_ERROR;
+        break;
+    }
+  }
+  else if (hsdio->State == HAL_SDIO_STATE_RESET)
+  {
+    switch (CallbackID)
+    {
+      case HAL_SDIO_MSP_INIT_CB_ID :
+        hsdio->MspInitCallback = pCallback;
+        break;
+      case HAL_SDIO_MSP_DEINIT_CB_ID :
+        hsdio->MspDeInitCallback = pCallback;
+        break;
+      default :
+        /* Update the error code */
+        hsdio->ErrorCode |= HAL_SDIO_ERROR_INVALID_CALLBACK;
+        /* update return status */
+        status =  HAL_ERROR;
+        break;
+    }
+  }
+  else
+  {
+    /* Update the error code */
+    hsdio->ErrorCode |= HAL_SDIO_ERROR_INVALID_CALLBACK;
+    /* update return status */
+    status =  HAL_ERROR;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Unregister a User SDIO Callback
+  *         SDIO Callback is redirected to the weak (surcharged) predefined callback
+  * @note   The HAL_SDIO_UnRegisterCallback() may be called before HAL_SDIO_Init() in
+  *         HAL_SDIO_STATE_RESET to register callbacks for HAL_SDIO_MSP_INIT_CB_ID
+  *         and HAL_SDIO_MSP_DEINIT_CB_ID.
+  * @param hsdio : SDIO handle
+  * @param CallbackID : ID of the callback to be unregistered
+  *        This parameter can be one of the following values:
+  *          @arg @ref HAL_SDIO_TX_CPLT_CB_ID     SDIO Tx Complete Callback ID
+  *          @arg @ref HAL_SDIO_RX_CPLT_CB_ID     SDIO Rx Complete Callback ID
+  *          @arg @ref HAL_SDIO_ERROR_CB_ID       SDIO Error Callback ID
+  *          @arg @ref HAL_SDIO_IO_FUNCTION_CB_ID SDIO card interrupt Callback ID
+  *          @arg @ref HAL_SDIO_MSP_INIT_CB_ID    SDIO MspInit Callback ID
+  *          @arg @ref HAL_SDIO_MSP_DEINIT_CB_ID  SDIO MspDeInit Callback ID
+  * @retval status
+  */
+HAL_StatusTypeDef HAL_SDIO_UnRegisterCallback(SDIO_HandleTypeDef *hsdio, HAL_SDIO_CallbackIDTypeDef CallbackID)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+
+  if (hsdio->State == HAL_SDIO_STATE_READY)
+  {
+    switch (CallbackID)
+    {
+      case HAL_SDIO_TX_CPLT_CB_ID :
+        hsdio->TxCpltCallback = HAL_SDIO_TxCpltCallback;
+        break;
+      case HAL_SDIO_RX_CPLT_CB_ID :
+        hsdio->RxCpltCallback = HAL_SDIO_RxCpltCallback;
+        break;
+      case HAL_SDIO_ERROR_CB_ID :
+        hsdio->ErrorCallback = HAL_SDIO_ErrorCallback;
+        break;
+      case HAL_SDIO_IO_FUNCTION_CB_ID :
+        hsdio->IOFunctionCallback = HAL_SDIO_IOFunctionCallback;
+        break;
+      case HAL_SDIO_MSP_INIT_CB_ID :
+        hsdio->MspInitCallback = HAL_SDIO_MspInit;
+        break;
+      case HAL_SDIO_MSP_DEINIT_CB_ID :
+        hsdio->MspDeInitCallback = HAL_SDIO_MspDeInit;
+        break;
+      default :
+        /* Update the error code */
+        hsdio->ErrorCode |= HAL_SDIO_ERROR_INVALID_CALLBACK;
+        /* update return status */
+        status =  HAL_ERROR;
+        break;
+    }
+  }
+  else if (hsdio->State == HAL_SDIO_STATE_RESET)
+  {
+    switch (CallbackID)
+    {
+      case HAL_SDIO_MSP_INIT_CB_ID :
+        hsdio->MspInitCallback = HAL_SDIO_MspInit;
+        break;
+      case HAL_SDIO_MSP_DEINIT_CB_ID :
+        hsdio->MspDeInitCallback = HAL_SDIO_MspDeInit;
+        break;
+      default :
+        /* Update the error code */
+        hsdio->ErrorCode |= HAL_SDIO_ERROR_INVALID_CALLBACK;
+        /* update return status */
+        status =  HAL_ERROR;
+        break;
+    }
+  }
+  else
+  {
+    /* Update the error code */
+    hsdio->ErrorCode |= HAL_SDIO_ERROR_INVALID_CALLBACK;
+    /* update return status */
+    status =  HAL_ERROR;
+  }
+
+  return status;
+}
+#endif /* USE_HAL_SDIO_REGISTER_CALLBACKS */
+
+/**
+  * @}
+  */
+
+/** @addtogroup SDIO_Exported_Functions_Group3
+  *  @brief   management functions
+  *
+@verbatim
+  ==============================================================================
+                      ##### Peripheral Control functions #####
+  ==============================================================================
+  [..]
+    This subsection provides a set of functions allowing to control the I/O
+    functions of the card and their interrupt.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Programs the block size of an I/O function, used by the CMD53
+  *         block mode transfers.
+  * @param  hsdio: Pointer to SDIO handle
+  * @param  IOFunctionNbr: I/O function number, from 0 (CIA) to 7
+  * @param  BlockSize: Block size in bytes, a power of 2 up to 2048
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SDIO_SetBlockSize(SDIO_HandleTypeDef *hsdio, uint32_t IOFunctionNbr, uint16_t BlockSize)
+{
+  uint32_t errorstate;
+  uint32_t regaddr;
+
+  assert_param(IS_SDIO_FUNCTION(IOFunctionNbr));
+
+  /* The SDMMC DPSM block size is a power of 2 */
+  if ((BlockSize == 0U) || (BlockSize > SDIO_MAX_BLOCK_SIZE) || ((BlockSize & (BlockSize - 1U)) != 0U))
+  {
+    hsdio->ErrorCode |= HAL_SDIO_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  if (hsdio->State != HAL_SDIO_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  hsdio->State = HAL_SDIO_STATE_BUSY;
+
+  /* Function 0 block size is in the CCCR, the other ones in their FBR */
+  regaddr = (IOFunctionNbr == 0U) ? SDIO_CCCR_BLOCK_SIZE : (SDIO_FBR_BASE(IOFunctionNbr) + SDIO_FBR_BLOCK_SIZE);
+
+  errorstate = SDIO_IOReadWriteDirect(hsdio, SDIO_WRITE, 0U, regaddr, (uint8_t)(BlockSize & 0xFFU), NULL);
+  if (errorstate == HAL_SDIO_ERROR_NONE)
+  {
+    errorstate = SDIO_IOReadWriteDirect(hsdio, SDIO_WRITE, 0U, regaddr + 1U, (uint8_t)(BlockSize >> 8U), NULL);
+  }
+
+  hsdio->State = HAL_SDIO_STATE_READY;
+
+  if (errorstate != HAL_SDIO_ERROR_NONE)
+  {
+    /* Clear all the static flags */
+    __HAL_SDIO_CLEAR_FLAG(hsdio, SDMMC_STATIC_FLAGS);
+    hsdio->ErrorCode |= errorstate;
+    return HAL_ERROR;
+  }
+
+  hsdio->BlockSize[IOFunctionNbr] = BlockSize;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Enables an I/O function and waits for it to be ready.
+  * @param  hsdio: Pointer to SDIO handle
+  * @param  IOFunctionNbr: I/O function number, from 1 to 7
+  * @param  Timeout: Timeout duration in ms for the function to be ready
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SDIO_EnableIOFunction(SDIO_HandleTypeDef *hsdio, uint32_t IOFunctionNbr, uint32_t Timeout)
+{
+  uint32_t errorstate;
+  uint32_t tickstart = HAL_GetTick();
+  uint8_t data = 0U;
+
+  assert_param(IS_SDIO_FUNCTION(IOFunctionNbr));
+
+  if (IOFunctionNbr == 0U)
+  {
+    hsdio->ErrorCode |= HAL_SDIO_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  if (hsdio->State != HAL_SDIO_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  hsdio->State = HAL_SDIO_STATE_BUSY;
+
+  errorstate = SDIO_IOReadWriteDirect(hsdio, SDIO_READ, 0U, SDIO_CCCR_IO_ENABLE, 0U, &data);
+  if (errorstate == HAL_SDIO_ERROR_NONE)
+  {
+    errorstate = SDIO_IOReadWriteDirect(hsdio, SDIO_WRITE, 0U, SDIO_CCCR_IO_ENABLE,
+                                        (uint8_t)(data | (1U << IOFunctionNbr)), NULL);
+  }
+
+  /* Wait for the function to report ready */
+  data = 0U;
+  while ((errorstate == HAL_SDIO_ERROR_NONE) && ((data & (1U << IOFunctionNbr)) == 0U))
+  {
+    errorstate = SDIO_IOReadWriteDirect(hsdio, SDIO_READ, 0U, SDIO_CCCR_IO_READY, 0U, &data);
+
+    if (((data & (1U << IOFunctionNbr)) == 0U) && ((HAL_GetTick() - tickstart) >= Timeout))
+    {
+      hsdio->ErrorCode |= HAL_SDIO_ERROR_TIMEOUT;
+      hsdio->State = HAL_SDIO_STATE_READY;
+      return HAL_TIMEOUT;
+    }
+  }
+
+  hsdio->State = HAL_SDIO_STATE_READY;
+
+  if (errorstate != HAL_SDIO_ERROR_NONE)
+  {
+    /* Clear all the static flags */
+    __HAL_SDIO_CLEAR_FLAG(hsdio, SDMMC_STATIC_FLAGS);
+    hsdio->ErrorCode |= errorstate;
+    return HAL_ERROR;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Enables the interrupt of an I/O function in the card and the SDMMC
+  *         card interrupt.
+  * @param  hsdio: Pointer to SDIO handle
+  * @param  IOFunctionNbr: I/O function number, from 1 to 7
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SDIO_EnableIOFunctionInterrupt(SDIO_HandleTypeDef *hsdio, uint32_t IOFunctionNbr)
+{
+  uint32_t errorstate;
+
+  assert_param(IS_SDIO_FUNCTION(IOFunctionNbr));
+
+  if (IOFunctionNbr == 0U)
+  {
+    hsdio->ErrorCode |= HAL_SDIO_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  if (hsdio->State != HAL_SDIO_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  hsdio->State = HAL_SDIO_STATE_BUSY;
+
+  errorstate = SDIO_IOReadWriteDirect(hsdio, SDIO_WRITE, 0U, SDIO_CCCR_INT_ENABLE,
+                                      (uint8_t)(hsdio->IOFunctionMask | (1U << IOFunctionNbr) |
+                                                SDIO_INT_ENABLE_IENM), NULL);
+
+  hsdio->State = HAL_SDIO_STATE_READY;
+
+  if (errorstate != HAL_SDIO_ERROR_NONE)
+  {
+    /* Clear all the static flags */
+    __HAL_SDIO_CLEAR_FLAG(hsdio, SDMMC_STATIC_FLAGS);
+    hsdio->ErrorCode |= errorstate;
+    return HAL_ERROR;
+  }
+
+  hsdio->IOFunctionMask |= (1U << IOFunctionNbr);
+
+  __SDMMC_OPERATION_ENABLE(hsdio->Instance);
+  __HAL_SDIO_CLEAR_FLAG(hsdio, SDMMC_FLAG_SDIOIT);
+  __HAL_SDIO_ENABLE_IT(hsdio, SDMMC_IT_SDIOIT);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Disables the interrupt of an I/O function in the card. The SDMMC card
+  *         interrupt is disabled with the last function interrupt.
+  * @param  hsdio: Pointer to SDIO handle
+  * @param  IOFunctionNbr: I/O function number, from 1 to 7
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SDIO_DisableIOFunctionInterrupt(SDIO_HandleTypeDef *hsdio, uint32_t IOFunctionNbr)
+{
+  uint32_t errorstate;
+  uint32_t mask;
+
+  assert_param(IS_SDIO_FUNCTION(IOFunctionNbr));
+
+  if (IOFunctionNbr == 0U)
+  {
+    hsdio->ErrorCode |= HAL_SDIO_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  if (hsdio->State != HAL_SDIO_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  hsdio->State = HAL_SDIO_STATE_BUSY;
+
+  /* The master enable is cleared with the last function */
+  mask = hsdio->IOFunctionMask & ~(1U << IOFunctionNbr);
+  errorstate = SDIO_IOReadWriteDirect(hsdio, SDIO_WRITE, 0U, SDIO_CCCR_INT_ENABLE,
+                                      (uint8_t)((mask != 0U) ? (mask | SDIO_INT_ENABLE_IENM) : 0U), NULL);
+
+  hsdio->State = HAL_SDIO_STATE_READY;
+
+  if (errorstate != HAL_SDIO_ERROR_NONE)
+  {
+    /* Clear all the static flags */
+    __HAL_SDIO_CLEAR_FLAG(hsdio, SDMMC_STATIC_FLAGS);
+    hsdio->ErrorCode |= errorstate;
+    return HAL_ERROR;
+  }
+
+  hsdio->IOFunctionMask = mask;
+
+  if (mask == 0U)
+  {
+    __HAL_SDIO_DISABLE_IT(hsdio, SDMMC_IT_SDIOIT);
+    __HAL_SDIO_CLEAR_FLAG(hsdio, SDMMC_FLAG_SDIOIT);
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Unmasks the SDMMC card interrupt once the card interrupt source has
+  *         been serviced, the interrupt being masked by HAL_SDIO_IRQHandler()
+  *         before calling HAL_SDIO_IOFunctionCallback().
+  * @param  hsdio: Pointer to SDIO handle
+  * @retval None
+  */
+void HAL_SDIO_AcknowledgeIOInterrupt(SDIO_HandleTypeDef *hsdio)
+{
+  __HAL_SDIO_CLEAR_FLAG(hsdio, SDMMC_FLAG_SDIOIT);
+
+  if (hsdio->IOFunctionMask != 0U)
+  {
+    __HAL_SDIO_ENABLE_IT(hsdio, SDMMC_IT_SDIOIT);
+  }
+}
+
+/**
+  * @}
+  */
+
+/** @addtogroup SDIO_Exported_Functions_Group4
+  *  @brief   Peripheral State functions
+  *
+@verbatim
+  ==============================================================================
+                      ##### Peripheral State functions #####
+  ==============================================================================
+  [..]
+    This subsection permits to get in runtime the status of the peripheral
+    and the data flow.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  return the SDIO state
+  * @param  hsdio: Pointer to SDIO handle
+  * @retval HAL state
+  */
+HAL_SDIO_StateTypeDef HAL_SDIO_GetState(const SDIO_HandleTypeDef *hsdio)
+{
+  return hsdio->State;
+}
+
+/**
+  * @brief  Return the SDIO error code
+  * @param  hsdio : Pointer to a SDIO_HandleTypeDef structure that contains
+  *              the configuration information.
+  * @retval SDIO Error Code
+  */
+uint32_t HAL_SDIO_GetError(const SDIO_HandleTypeDef *hsdio)
+{
+  return hsdio->ErrorCode;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/* Private function ----------------------------------------------------------*/
+/** @addtogroup SDIO_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Identifies the SDIO card: operating voltage (CMD5), relative address
+  *         (CMD3) and selection (CMD7).
+  * @param  hsdio: Pointer to SDIO handle
+  * @retval SDIO error state
+  */
+static uint32_t SDIO_InitCard(SDIO_HandleTypeDef *hsdio)
+{
+  uint32_t errorstate;
+  uint32_t ocr = 0U;
+  uint32_t response = 0U;
+  uint32_t tickstart;
+
+  /* CMD0: GO_IDLE_STATE, only meaningful for combo cards */
+  (void)SDMMC_CmdGoIdleState(hsdio->Instance);
+
+  /* CMD5: inquire the I/O OCR */
+  errorstate = SDMMC_CmdSendOperationcondition(hsdio->Instance, 0U, &ocr);
+  if (errorstate != HAL_SDIO_ERROR_NONE)
+  {
+    return errorstate;
+  }
+
+  if ((ocr & SDIO_OCR_VDD_WINDOW) == 0U)
+  {
+    return SDMMC_ERROR_INVALID_VOLTRANGE;
+  }
+
+  /* CMD5: request the voltage window until the card is powered up */
+  tickstart = HAL_GetTick();
+  while ((response & SDIO_OCR_READY) == 0U)
+  {
+    errorstate = SDMMC_CmdSendOperationcondition(hsdio->Instance, ocr & SDIO_OCR_VDD_WINDOW, &response);
+    if (errorstate != HAL_SDIO_ERROR_NONE)
+    {
+      return errorstate;
+    }
+
+    if (((response & SDIO_OCR_READY) == 0U) && ((HAL_GetTick() - tickstart) >= SDIO_OCR_TIMEOUT))
+    {
+      return HAL_SDIO_ERROR_TIMEOUT;
+    }
+  }
+
+  /* CMD3: SEND_RELATIVE_ADDR */
+  errorstate = SDMMC_CmdSetRelAdd(hsdio->Instance, &hsdio->RCA);
+  if (errorstate != HAL_SDIO_ERROR_NONE)
+  {
+    return errorstate;
+  }
+
+  /* CMD7: SELECT_CARD, the card enters the command state */
+  errorstate = SDMMC_CmdSelDesel(hsdio->Instance, (uint32_t)(((uint32_t)hsdio->RCA) << 16U));
+
+  return errorstate;
+}
+
+/**
+  * @brief  Sends a CMD52 (IO_RW_DIRECT) to the card.
+  * @param  hsdio: Pointer to SDIO handle
+  * @param  Direction: SDIO_READ or SDIO_WRITE
+  * @param  IOFunctionNbr: I/O function number
+  * @param  RegAddr: Register address in the function
+  * @param  Data: Value to write, ignored for a read
+  * @param  pData: Pointer to the byte that will contain the register value, may be NULL
+  * @retval SDIO error state
+  */
+static uint32_t SDIO_IOReadWriteDirect(SDIO_HandleTypeDef *hsdio, uint32_t Direction, uint32_t IOFunctionNbr,
+                                       uint32_t RegAddr, uint8_t Data, uint8_t *pData)
+{
+  uint32_t argument;
+
+  /* R/W flag [31], function [30:28], RAW flag [27] cleared, address [25:9], data [7:0] */
+  argument = (Direction << 31U) | (IOFunctionNbr << 28U) | ((RegAddr & 0x1FFFFU) << 9U) | (uint32_t)Data;
+
+  return SDMMC_SDIO_CmdReadWriteDirect(hsdio->Instance, argument, pData);
+}
+
+/**
+  * @brief  Starts a CMD53 (IO_RW_EXTENDED) transfer moved by the IDMA.
+  * @param  hsdio: Pointer to SDIO handle
+  * @param  Direction: SDIO_READ or SDIO_WRITE
+  * @param  pArgument: Pointer to the CMD53 argument
+  * @param  pData: Pointer to the data buffer
+  * @param  Size: Number of bytes to transfer
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef SDIO_IOReadWriteExtended_DMA(SDIO_HandleTypeDef *hsdio, uint32_t Direction,
+                                                      const SDIO_ExtendedCmdTypeDef *pArgument, uint8_t *pData,
+                                                      uint32_t Size)
+{
+  SDMMC_DataInitTypeDef config;
+  uint32_t errorstate;
+  uint32_t blocksize;
+  uint32_t count;
+  uint32_t argument;
+
+  if ((NULL == pArgument) || (NULL == pData) || (Size == 0U) || (((uint32_t)pData & 0x3U) != 0U))
+  {
+    hsdio->ErrorCode |= HAL_SDIO_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  assert_param(IS_SDIO_FUNCTION(pArgument->IOFunctionNbr));
+  assert_param(IS_SDIO_REG_ADDR(pArgument->RegAddr));
+  assert_param(IS_SDIO_OP_CODE(pArgument->OpCode));
+  assert_param(IS_SDIO_MODE(pArgument->Block));
+
+  if (hsdio->State != HAL_SDIO_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  if (pArgument->Block == HAL_SDIO_MODE_BLOCK)
+  {
+    /* Whole blocks of the function block size, all sent by a single command */
+    blocksize = hsdio->BlockSize[pArgument->IOFunctionNbr];
+    if ((blocksize == 0U) || ((Size % blocksize) != 0U) || ((Size / blocksize) > SDIO_MAX_BLOCK_COUNT))
+    {
+      hsdio->ErrorCode |= HAL_SDIO_ERROR_PARAM;
+      return HAL_ERROR;
+    }
+    count = Size / blocksize;
+    config.DataBlockSize = (POSITION_VAL(blocksize) << SDMMC_DCTRL_DBLOCKSIZE_Pos);
+    config.TransferMode  = SDMMC_TRANSFER_MODE_BLOCK;
+  }
+  else
+  {
+    /* A byte count of 512 is coded as 0 */
+    if (Size > SDIO_MAX_BYTE_COUNT)
+    {
+      hsdio->ErrorCode |= HAL_SDIO_ERROR_PARAM;
+      return HAL_ERROR;
+    }
+    count = Size & (SDIO_MAX_BYTE_COUNT - 1U);
+    config.DataBlockSize = SDMMC_DATABLOCK_SIZE_1B;
+    config.TransferMode  = SDMMC_TRANSFER_MODE_SDIO;
+  }
+
+  hsdio->ErrorCode = HAL_SDIO_ERROR_NONE;
+  hsdio->State = HAL_SDIO_STATE_BUSY;
+  hsdio->pXferBuff = pData;
+  hsdio->XferSize = Size;
+  hsdio->XferFunction = pArgument->IOFunctionNbr;
+
+  /* Initialize data control register, the SDIO operations stay enabled */
+  hsdio->Instance->DCTRL = SDMMC_DCTRL_SDIOEN;
+
+  /* Configure the SDIO DPSM (Data Path State Machine), started by the CMD53 */
+  config.DataTimeOut   = SDMMC_DATATIMEOUT;
+  config.DataLength    = Size;
+  config.TransferDir   = (Direction == SDIO_WRITE) ? SDMMC_TRANSFER_DIR_TO_CARD : SDMMC_TRANSFER_DIR_TO_SDMMC;
+  config.DPSM          = SDMMC_DPSM_DISABLE;
+  (void)SDMMC_ConfigData(hsdio->Instance, &config);
+
+  __SDMMC_CMDTRANS_ENABLE(hsdio->Instance);
+  hsdio->Instance->IDMABASE0 = (uint32_t) pData;
+  hsdio->Instance->IDMACTRL  = SDMMC_ENABLE_IDMA_SINGLE_BUFF;
+
+  hsdio->Context = (Direction == SDIO_WRITE) ? SDIO_CONTEXT_WRITE : SDIO_CONTEXT_READ;
+
+  /* R/W flag [31], function [30:28], block mode [27], OP code [26], address [25:9], count [8:0] */
+  argument = (Direction << 31U) | (pArgument->IOFunctionNbr << 28U) | (pArgument->Block << 27U) |
+             (pArgument->OpCode << 26U) | ((pArgument->RegAddr & 0x1FFFFU) << 9U) | count;
+
+  errorstate = SDMMC_SDIO_CmdReadWriteExtended(hsdio->Instance, argument);
+  if (errorstate != HAL_SDIO_ERROR_NONE)
+  {
+    SDIO_StopTransfer(hsdio);
+    /* Clear all the static flags */
+    __HAL_SDIO_CLEAR_FLAG(hsdio, SDMMC_STATIC_FLAGS);
+    hsdio->ErrorCode |= errorstate;
+    hsdio->State = HAL_SDIO_STATE_READY;
+    hsdio->Context = SDIO_CONTEXT_NONE;
+    return HAL_ERROR;
+  }
+
+  /* Enable transfer interrupts */
+  if (Direction == SDIO_WRITE)
+  {
+    __HAL_SDIO_ENABLE_IT(hsdio, (SDMMC_IT_DCRCFAIL | SDMMC_IT_DTIMEOUT | SDMMC_IT_TXUNDERR | SDMMC_IT_DATAEND));
+  }
+  else
+  {
+    __HAL_SDIO_ENABLE_IT(hsdio, (SDMMC_IT_DCRCFAIL | SDMMC_IT_DTIMEOUT | SDMMC_IT_RXOVERR | SDMMC_IT_DATAEND));
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Releases the data path at the end of a CMD53 transfer.
+  * @param  hsdio: Pointer to SDIO handle
+  * @retval None
+  */
+static void SDIO_StopTransfer(SDIO_HandleTypeDef *hsdio)
+{
+  __HAL_SDIO_DISABLE_IT(hsdio, SDIO_IT_XFER);
+  __SDMMC_CMDTRANS_DISABLE(hsdio->Instance);
+
+  hsdio->Instance->DLEN = 0U;
+  hsdio->Instance->DCTRL = SDMMC_DCTRL_SDIOEN;
+  hsdio->Instance->IDMACTRL = SDMMC_DISABLE_IDMA;
+}
+
+/**
+  * @}
+  */
+
+#endif /* HAL_SDIO_MODULE_ENABLED */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
@@ -86,6 +86,22 @@
          add his own code by customization of function pointer HAL_SPDIFRX_ErrorCallback
      (+) Stop the DMA Transfer using HAL_SPDIFRX_DMAStop()
 
+  *** Continuous stream reception ***
+  ===================================
+  [..]
+    (+) Configure the Data Flow DMA and, if needed, the Control Flow DMA in DMA_CIRCULAR mode.
+    (+) Start both flows at once using HAL_SPDIFRX_StartStream_DMA(). The function returns
+        without waiting for the synchronization: the SPDIFRX interrupt must be enabled.
+    (+) The Data Flow and Control Flow buffers are then filled continuously, their half and
+        complete callbacks are executed as for the other DMA functions.
+    (+) HAL_SPDIFRX_StreamSyncCallback() is executed each time the stream synchronizes or
+        loses the synchronization (framing, synchronization or time-out error). The peripheral
+        is then restarted without stopping the DMA, the data flow resumes in the same buffer.
+    (+) A complete block of channel status and user bits is extracted from the Control Flow
+        buffer using HAL_SPDIFRX_GetCtrlBlock(): a Control Flow buffer of 4 blocks
+        (96 words) gives a complete block in each half.
+    (+) Stop the stream using HAL_SPDIFRX_StopStream_DMA()
+
    *** SPDIFRX HAL driver macros list ***
    =============================================
    [..]
@@ -329,6 +345,8 @@ HAL_StatusTypeDef HAL_SPDIFRX_Init(SPDIFRX_HandleTypeDef *hspdif)
   hspdif->Instance->CR = tmpreg;
 
   hspdif->ErrorCode = HAL_SPDIFRX_ERROR_NONE;
+  hspdif->StreamMode = 0U;
+  hspdif->SyncLossCount = 0U;
 
   /* SPDIFRX peripheral state is READY*/
   hspdif->State = HAL_SPDIFRX_STATE_READY;
@@ -692,6 +710,7 @@ HAL_StatusTypeDef HAL_SPDIFRX_SetDataFormat(SPDIFRX_HandleTypeDef *hspdif, SPDIF
     (#) No-Blocking mode functions with DMA are :
         (++) HAL_SPDIFRX_ReceiveCtrlFlow_DMA()
         (++) HAL_SPDIFRX_ReceiveDataFlow_DMA()
+        (++) HAL_SPDIFRX_StartStream_DMA()
 
     (#) A set of Transfer Complete Callbacks are provided in No_Blocking mode:
         (++) HAL_SPDIFRX_RxCpltCallback()
@@ -1250,6 +1269,199 @@ HAL_StatusTypeDef HAL_SPDIFRX_DMAStop(SPDIFRX_HandleTypeDef *hspdif)
   return HAL_OK;
 }
 
+/**
+  * @brief Start the continuous reception of the data flow and control flow with DMA
+  * @param hspdif SPDIFRX handle
+  * @param pData a 32-bit pointer to the Data Flow circular buffer.
+  * @param Size number of data samples of the Data Flow buffer
+  * @param pCtrl a 32-bit pointer to the Control Flow circular buffer, or NULL
+  *        when the channel status and user bits are not needed.
+  * @param CtrlSize number of words of the Control Flow buffer
+  * @note  Both DMA must be configured in DMA_CIRCULAR mode. They are never
+  *        stopped until HAL_SPDIFRX_StopStream_DMA(), even on a loss of
+  *        synchronization.
+  * @note  The synchronization is done under the SPDIFRX interrupt: the function
+  *        does not wait for it, HAL_SPDIFRX_StreamSyncCallback() signals it.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SPDIFRX_StartStream_DMA(SPDIFRX_HandleTypeDef *hspdif, uint32_t *pData, uint16_t Size,
+                                              uint32_t *pCtrl, uint16_t CtrlSize)
+{
+  if ((pData == NULL) || (Size == 0U) || ((pCtrl != NULL) && (CtrlSize == 0U)))
+  {
+    return HAL_ERROR;
+  }
+
+  if ((hspdif->hdmaDrRx->Init.Mode != DMA_CIRCULAR) ||
+      ((pCtrl != NULL) && (hspdif->hdmaCsRx->Init.Mode != DMA_CIRCULAR)))
+  {
+    return HAL_ERROR;
+  }
+
+  if (hspdif->State != HAL_SPDIFRX_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  /* Process Locked */
+  __HAL_LOCK(hspdif);
+
+  hspdif->pRxBuffPtr = pData;
+  hspdif->RxXferSize = Size;
+  hspdif->RxXferCount = Size;
+
+  hspdif->pCsBuffPtr = pCtrl;
+  hspdif->CsXferSize = CtrlSize;
+  hspdif->CsXferCount = CtrlSize;
+
+  hspdif->ErrorCode = HAL_SPDIFRX_ERROR_NONE;
+  hspdif->SyncLossCount = 0U;
+  hspdif->State = HAL_SPDIFRX_STATE_BUSY_RX;
+
+  /* Set the SPDIFRX Data Flow DMA callbacks */
+  hspdif->hdmaDrRx->XferHalfCpltCallback = SPDIFRX_DMARxHalfCplt;
+  hspdif->hdmaDrRx->XferCpltCallback = SPDIFRX_DMARxCplt;
+  hspdif->hdmaDrRx->XferErrorCallback = SPDIFRX_DMAError;
+
+  if (HAL_DMA_Start_IT(hspdif->hdmaDrRx, (uint32_t)&hspdif->Instance->DR, (uint32_t)pData, Size) != HAL_OK)
+  {
+    /* Set SPDIFRX error */
+    hspdif->ErrorCode = HAL_SPDIFRX_ERROR_DMA;
+
+    /* Set SPDIFRX state */
+    hspdif->State = HAL_SPDIFRX_STATE_ERROR;
+
+    /* Process Unlocked */
+    __HAL_UNLOCK(hspdif);
+
+    return HAL_ERROR;
+  }
+
+  if (pCtrl != NULL)
+  {
+    /* Set the SPDIFRX Control Flow DMA callbacks */
+    hspdif->hdmaCsRx->XferHalfCpltCallback = SPDIFRX_DMACxHalfCplt;
+    hspdif->hdmaCsRx->XferCpltCallback = SPDIFRX_DMACxCplt;
+    hspdif->hdmaCsRx->XferErrorCallback = SPDIFRX_DMAError;
+
+    if (HAL_DMA_Start_IT(hspdif->hdmaCsRx, (uint32_t)&hspdif->Instance->CSR, (uint32_t)pCtrl, CtrlSize) != HAL_OK)
+    {
+      (void)HAL_DMA_Abort(hspdif->hdmaDrRx);
+
+      /* Set SPDIFRX error */
+      hspdif->ErrorCode = HAL_SPDIFRX_ERROR_DMA;
+
+      /* Set SPDIFRX state */
+      hspdif->State = HAL_SPDIFRX_STATE_ERROR;
+
+      /* Process Unlocked */
+      __HAL_UNLOCK(hspdif);
+
+      return HAL_ERROR;
+    }
+
+    hspdif->Instance->CR |= SPDIFRX_CR_CBDMAEN;
+  }
+
+  hspdif->Instance->CR |= SPDIFRX_CR_RXDMAEN;
+
+  hspdif->StreamMode = 1U;
+
+  /* Synchronization done and framing, synchronization or time-out errors */
+  __HAL_SPDIFRX_CLEAR_IT(hspdif, SPDIFRX_IT_SYNCDIE);
+  __HAL_SPDIFRX_ENABLE_IT(hspdif, SPDIFRX_IT_SYNCDIE);
+  __HAL_SPDIFRX_ENABLE_IT(hspdif, SPDIFRX_IT_IFEIE);
+
+  /* Start synchronization, the reception is started under interrupt */
+  __HAL_SPDIFRX_SYNC(hspdif);
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(hspdif);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief Stop the continuous reception started by HAL_SPDIFRX_StartStream_DMA
+  * @param hspdif SPDIFRX handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SPDIFRX_StopStream_DMA(SPDIFRX_HandleTypeDef *hspdif)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+
+  /* Process Locked */
+  __HAL_LOCK(hspdif);
+
+  hspdif->StreamMode = 0U;
+
+  __HAL_SPDIFRX_DISABLE_IT(hspdif, SPDIFRX_IT_SYNCDIE);
+  __HAL_SPDIFRX_DISABLE_IT(hspdif, SPDIFRX_IT_IFEIE);
+
+  /* Disable the SPDIFRX DMA requests */
+  hspdif->Instance->CR &= ~(SPDIFRX_CR_RXDMAEN | SPDIFRX_CR_CBDMAEN);
+
+  if (HAL_DMA_Abort(hspdif->hdmaDrRx) != HAL_OK)
+  {
+    status = HAL_ERROR;
+  }
+
+  if ((hspdif->pCsBuffPtr != NULL) && (HAL_DMA_Abort(hspdif->hdmaCsRx) != HAL_OK))
+  {
+    status = HAL_ERROR;
+  }
+
+  /* Disable SPDIFRX peripheral */
+  __HAL_SPDIFRX_IDLE(hspdif);
+
+  hspdif->State = HAL_SPDIFRX_STATE_READY;
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(hspdif);
+
+  return status;
+}
+
+/**
+  * @brief Extract a complete block of channel status and user bits from a control flow buffer
+  * @param pCtrl a 32-bit pointer to control flow words, as received from the CSR register.
+  * @param NbWords number of words from pCtrl
+  * @param pBlock pointer to the block structure to fill
+  * @note  The first complete block found is returned, its start being flagged by the
+  *        SOB bit. NbWords must be at least 2 * SPDIFRX_CTRL_BLOCK_WORDS to always
+  *        contain a complete block.
+  * @retval HAL status, HAL_ERROR when no complete block is found
+  */
+HAL_StatusTypeDef HAL_SPDIFRX_GetCtrlBlock(const uint32_t *pCtrl, uint32_t NbWords,
+                                           SPDIFRX_CtrlBlockTypeDef *pBlock)
+{
+  uint32_t start = 0U;
+  uint32_t word;
+  uint32_t i;
+
+  /* Look for the start of a block */
+  while (((start + SPDIFRX_CTRL_BLOCK_WORDS) <= NbWords) && ((pCtrl[start] & SPDIFRX_CSR_SOB) == 0U))
+  {
+    start++;
+  }
+
+  if ((start + SPDIFRX_CTRL_BLOCK_WORDS) > NbWords)
+  {
+    return HAL_ERROR;
+  }
+
+  /* One word holds the channel status bits of 8 frames and the user bits of 16 sub-frames */
+  for (i = 0U; i < SPDIFRX_CTRL_BLOCK_WORDS; i++)
+  {
+    word = pCtrl[start + i];
+    pBlock->ChannelStatus[i]   = (uint8_t)((word & SPDIFRX_CSR_CS) >> SPDIFRX_CSR_CS_Pos);
+    pBlock->UserData[2U * i]   = (uint8_t)(word & 0xFFU);
+    pBlock->UserData[(2U * i) + 1U] = (uint8_t)((word & SPDIFRX_CSR_USR) >> 8U);
+  }
+
+  return HAL_OK;
+}
+
 /**
   * @brief  This function handles SPDIFRX interrupt request.
   * @param  hspdif SPDIFRX handle
@@ -1297,6 +1509,39 @@ void HAL_SPDIFRX_IRQHandler(SPDIFRX_HandleTypeDef *hspdif)
     /* the transfer is not stopped */
     HAL_SPDIFRX_ErrorCallback(hspdif);
   }
+
+  /* SPDIFRX stream synchronization done */
+  if (((itFlag & SPDIFRX_FLAG_SYNCD) == SPDIFRX_FLAG_SYNCD) && ((itSource &  SPDIFRX_IT_SYNCDIE) == SPDIFRX_IT_SYNCDIE))
+  {
+    __HAL_SPDIFRX_CLEAR_IT(hspdif, SPDIFRX_IT_SYNCDIE);
+
+    if (hspdif->StreamMode != 0U)
+    {
+      /* Start reception */
+      __HAL_SPDIFRX_RCV(hspdif);
+
+      HAL_SPDIFRX_StreamSyncCallback(hspdif, 1U);
+    }
+  }
+
+  /* SPDIFRX framing, synchronization or time-out error: the peripheral is stopped */
+  if (((itFlag & (SPDIFRX_FLAG_FERR | SPDIFRX_FLAG_SERR | SPDIFRX_FLAG_TERR)) != 0U) &&
+      ((itSource &  SPDIFRX_IT_IFEIE) == SPDIFRX_IT_IFEIE))
+  {
+    /* The error flags are cleared by going back to the IDLE state */
+    __HAL_SPDIFRX_IDLE(hspdif);
+
+    if (hspdif->StreamMode != 0U)
+    {
+      hspdif->SyncLossCount++;
+
+      HAL_SPDIFRX_StreamSyncCallback(hspdif, 0U);
+
+      /* Restart the synchronization, the DMA keep running */
+      __HAL_SPDIFRX_CLEAR_IT(hspdif, SPDIFRX_IT_SYNCDIE);
+      __HAL_SPDIFRX_SYNC(hspdif);
+    }
+  }
 }
 
 /**
@@ -1374,6 +1619,24 @@ __weak void HAL_SPDIFRX_ErrorCallback(SPDIFRX_HandleTypeDef *hspdif)
   */
 }
 
+/**
+  * @brief SPDIFRX stream synchronization callbacks
+  * @param hspdif SPDIFRX handle
+  * @param Synchronized 1 when the stream is synchronized and received,
+  *        0 when the synchronization is lost and being recovered.
+  * @retval None
+  */
+__weak void HAL_SPDIFRX_StreamSyncCallback(SPDIFRX_HandleTypeDef *hspdif, uint32_t Synchronized)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hspdif);
+  UNUSED(Synchronized);
+
+  /* NOTE : This function Should not be modified, when the callback is needed,
+            the HAL_SPDIFRX_StreamSyncCallback could be implemented in the user file
+  */
+}
+
 /**
   * @}
   */
@@ -1467,10 +1730,13 @@ static void SPDIFRX_DMACxCplt(DMA_HandleTypeDef *hdma)
   SPDIFRX_HandleTypeDef *hspdif = (SPDIFRX_HandleTypeDef *)((DMA_HandleTypeDef *)hdma)->Parent;
 
   /* Disable Cb DMA Request */
-  hspdif->Instance->CR &= (uint16_t)(~SPDIFRX_CR_CBDMAEN);
-  hspdif->CsXferCount = 0;
+  if (hdma->Init.Mode != DMA_CIRCULAR)
+  {
+    hspdif->Instance->CR &= (uint16_t)(~SPDIFRX_CR_CBDMAEN);
+    hspdif->CsXferCount = 0;
 
-  hspdif->State = HAL_SPDIFRX_STATE_READY;
+    hspdif->State = HAL_SPDIFRX_STATE_READY;
+  }
 #if (USE_HAL_SPDIFRX_REGISTER_CALLBACKS == 1)
   hspdif->CxCpltCallback(hspdif);
 #else
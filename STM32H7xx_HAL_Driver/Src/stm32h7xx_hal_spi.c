@@ -54,6 +54,13 @@
       (#) Initialize the SPI registers by calling the HAL_SPI_Init() API:
           (++) This API configures also the low level Hardware GPIO, CLOCK, CORTEX...etc)
               by calling the customized HAL_SPI_MspInit() API.
+     [..]
+       Interrupt mode FIFO usage:
+
+      (#) When the FifoThreshold is above SPI_FIFO_THRESHOLD_01DATA, the interrupt mode
+          transfers move a whole FIFO packet per TXP/RXP interrupt, with 32-bit accesses
+          packing the 8-bit and 16-bit data. A last packet shorter than the threshold is
+          completed data per data or on end of transfer.
      [..]
        Callback registration:
 
@@ -68,6 +75,8 @@
             (+) TxHalfCpltCallback    : SPI Tx Half Completed callback
             (+) RxHalfCpltCallback    : SPI Rx Half Completed callback
             (+) TxRxHalfCpltCallback  : SPI TxRx Half Completed callback
+            (+) RxM0CpltCallback      : SPI Rx Memory 0 Completed callback
+            (+) RxM1CpltCallback      : SPI Rx Memory 1 Completed callback
             (+) ErrorCallback         : SPI Error callback
             (+) AbortCpltCallback     : SPI Abort callback
             (+) SuspendCallback       : SPI Suspend callback
@@ -88,6 +97,8 @@
             (+) TxHalfCpltCallback    : SPI Tx Half Completed callback
             (+) RxHalfCpltCallback    : SPI Rx Half Completed callback
             (+) TxRxHalfCpltCallback  : SPI TxRx Half Completed callback
+            (+) RxM0CpltCallback      : SPI Rx Memory 0 Completed callback
+            (+) RxM1CpltCallback      : SPI Rx Memory 1 Completed callback
             (+) ErrorCallback         : SPI Error callback
             (+) AbortCpltCallback     : SPI Abort callback
             (+) SuspendCallback       : SPI Suspend callback
@@ -130,6 +141,17 @@
           HAL_ERROR with ErrorCode set to HAL_SPI_ERROR_NOT_SUPPORTED.
           Those functions are maintained for backward compatibility reasons.
 
+    [..]
+      Double buffer reception:
+      (+) HAL_SPI_ReceiveDoubleBuffer_DMA() starts an endless reception alternating between
+          two memory buffers (DMA double buffer mode). The end of reception in each buffer is
+          signalled by HAL_SPI_RxM0CpltCallback() and HAL_SPI_RxM1CpltCallback(); the buffer
+          not currently targeted by the DMA can be processed, or replaced using
+          HAL_DMAEx_ChangeMemory(), from these callbacks.
+      (+) The reception runs until HAL_SPI_Abort() or HAL_SPI_Abort_IT() is called.
+      (+) The circular mode restrictions apply: the reception is only available in Slave mode
+          and the CRC feature is not managed.
+
   @endverbatim
   */
 
@@ -168,6 +190,8 @@ static void SPI_DMAReceiveCplt(DMA_HandleTypeDef *hdma);
 static void SPI_DMATransmitReceiveCplt(DMA_HandleTypeDef *hdma);
 static void SPI_DMAHalfTransmitCplt(DMA_HandleTypeDef *hdma);
 static void SPI_DMAHalfReceiveCplt(DMA_HandleTypeDef *hdma);
+static void SPI_DMAReceiveM0Cplt(DMA_HandleTypeDef *hdma);
+static void SPI_DMAReceiveM1Cplt(DMA_HandleTypeDef *hdma);
 static void SPI_DMAHalfTransmitReceiveCplt(DMA_HandleTypeDef *hdma);
 static void SPI_DMAError(DMA_HandleTypeDef *hdma);
 static void SPI_DMAAbortOnError(DMA_HandleTypeDef *hdma);
@@ -181,6 +205,12 @@ static void SPI_TxISR_32BIT(SPI_HandleTypeDef *hspi);
 static void SPI_RxISR_8BIT(SPI_HandleTypeDef *hspi);
 static void SPI_RxISR_16BIT(SPI_HandleTypeDef *hspi);
 static void SPI_RxISR_32BIT(SPI_HandleTypeDef *hspi);
+static void SPI_TxISR_8BIT_FIFO(SPI_HandleTypeDef *hspi);
+static void SPI_TxISR_16BIT_FIFO(SPI_HandleTypeDef *hspi);
+static void SPI_TxISR_32BIT_FIFO(SPI_HandleTypeDef *hspi);
+static void SPI_RxISR_8BIT_FIFO(SPI_HandleTypeDef *hspi);
+static void SPI_RxISR_16BIT_FIFO(SPI_HandleTypeDef *hspi);
+static void SPI_RxISR_32BIT_FIFO(SPI_HandleTypeDef *hspi);
 static void SPI_AbortTransfer(SPI_HandleTypeDef *hspi);
 static void SPI_CloseTransfer(SPI_HandleTypeDef *hspi);
 static uint32_t SPI_GetPacketSize(SPI_HandleTypeDef *hspi);
@@ -328,6 +358,9 @@ HAL_StatusTypeDef HAL_SPI_Init(SPI_HandleTypeDef *hspi)
     /* Allocate lock resource and initialize it */
     hspi->Lock = HAL_UNLOCKED;
 
+    /* No NSS framed slave context */
+    hspi->pNSSFrame = NULL;
+
 #if (USE_HAL_SPI_REGISTER_CALLBACKS == 1UL)
     /* Init the SPI Callback settings */
     hspi->TxCpltCallback       = HAL_SPI_TxCpltCallback;       /* Legacy weak TxCpltCallback       */
@@ -336,6 +369,8 @@ HAL_StatusTypeDef HAL_SPI_Init(SPI_HandleTypeDef *hspi)
     hspi->TxHalfCpltCallback   = HAL_SPI_TxHalfCpltCallback;   /* Legacy weak TxHalfCpltCallback   */
     hspi->RxHalfCpltCallback   = HAL_SPI_RxHalfCpltCallback;   /* Legacy weak RxHalfCpltCallback   */
     hspi->TxRxHalfCpltCallback = HAL_SPI_TxRxHalfCpltCallback; /* Legacy weak TxRxHalfCpltCallback */
+    hspi->RxM0CpltCallback     = HAL_SPI_RxM0CpltCallback;     /* Legacy weak RxM0CpltCallback     */
+    hspi->RxM1CpltCallback     = HAL_SPI_RxM1CpltCallback;     /* Legacy weak RxM1CpltCallback     */
     hspi->ErrorCallback        = HAL_SPI_ErrorCallback;        /* Legacy weak ErrorCallback        */
     hspi->AbortCpltCallback    = HAL_SPI_AbortCpltCallback;    /* Legacy weak AbortCpltCallback    */
     hspi->SuspendCallback      = HAL_SPI_SuspendCallback;      /* Legacy weak SuspendCallback      */
@@ -599,6 +634,14 @@ HAL_StatusTypeDef HAL_SPI_RegisterCallback(SPI_HandleTypeDef *hspi, HAL_SPI_Call
         hspi->TxRxHalfCpltCallback = pCallback;
         break;
 
+      case HAL_SPI_RX_M0_COMPLETE_CB_ID :
+        hspi->RxM0CpltCallback = pCallback;
+        break;
+
+      case HAL_SPI_RX_M1_COMPLETE_CB_ID :
+        hspi->RxM1CpltCallback = pCallback;
+        break;
+
       case HAL_SPI_ERROR_CB_ID :
         hspi->ErrorCallback = pCallback;
         break;
@@ -706,6 +749,14 @@ HAL_StatusTypeDef HAL_SPI_UnRegisterCallback(SPI_HandleTypeDef *hspi, HAL_SPI_Ca
         hspi->TxRxHalfCpltCallback = HAL_SPI_TxRxHalfCpltCallback; /* Legacy weak TxRxHalfCpltCallback */
         break;
 
+      case HAL_SPI_RX_M0_COMPLETE_CB_ID :
+        hspi->RxM0CpltCallback = HAL_SPI_RxM0CpltCallback;         /* Legacy weak RxM0CpltCallback     */
+        break;
+
+      case HAL_SPI_RX_M1_COMPLETE_CB_ID :
+        hspi->RxM1CpltCallback = HAL_SPI_RxM1CpltCallback;         /* Legacy weak RxM1CpltCallback     */
+        break;
+
       case HAL_SPI_ERROR_CB_ID :
         hspi->ErrorCallback = HAL_SPI_ErrorCallback;               /* Legacy weak ErrorCallback        */
         break;
@@ -1499,15 +1550,15 @@ HAL_StatusTypeDef HAL_SPI_Transmit_IT(SPI_HandleTypeDef *hspi, const uint8_t *pD
   /* Set the function for IT treatment */
   if (hspi->Init.DataSize > SPI_DATASIZE_16BIT)
   {
-    hspi->TxISR = SPI_TxISR_32BIT;
+    hspi->TxISR = (hspi->Init.FifoThreshold > SPI_FIFO_THRESHOLD_01DATA) ? SPI_TxISR_32BIT_FIFO : SPI_TxISR_32BIT;
   }
   else if (hspi->Init.DataSize > SPI_DATASIZE_8BIT)
   {
-    hspi->TxISR = SPI_TxISR_16BIT;
+    hspi->TxISR = (hspi->Init.FifoThreshold > SPI_FIFO_THRESHOLD_01DATA) ? SPI_TxISR_16BIT_FIFO : SPI_TxISR_16BIT;
   }
   else
   {
-    hspi->TxISR = SPI_TxISR_8BIT;
+    hspi->TxISR = (hspi->Init.FifoThreshold > SPI_FIFO_THRESHOLD_01DATA) ? SPI_TxISR_8BIT_FIFO : SPI_TxISR_8BIT;
   }
 
   /* Configure communication direction : 1Line */
@@ -1587,15 +1638,15 @@ HAL_StatusTypeDef HAL_SPI_Receive_IT(SPI_HandleTypeDef *hspi, uint8_t *pData, ui
   /* Set the function for IT treatment */
   if (hspi->Init.DataSize > SPI_DATASIZE_16BIT)
   {
-    hspi->RxISR = SPI_RxISR_32BIT;
+    hspi->RxISR = (hspi->Init.FifoThreshold > SPI_FIFO_THRESHOLD_01DATA) ? SPI_RxISR_32BIT_FIFO : SPI_RxISR_32BIT;
   }
   else if (hspi->Init.DataSize > SPI_DATASIZE_8BIT)
   {
-    hspi->RxISR = SPI_RxISR_16BIT;
+    hspi->RxISR = (hspi->Init.FifoThreshold > SPI_FIFO_THRESHOLD_01DATA) ? SPI_RxISR_16BIT_FIFO : SPI_RxISR_16BIT;
   }
   else
   {
-    hspi->RxISR = SPI_RxISR_8BIT;
+    hspi->RxISR = (hspi->Init.FifoThreshold > SPI_FIFO_THRESHOLD_01DATA) ? SPI_RxISR_8BIT_FIFO : SPI_RxISR_8BIT;
   }
 
   /* Configure communication direction : 1Line */
@@ -1685,18 +1736,18 @@ HAL_StatusTypeDef HAL_SPI_TransmitReceive_IT(SPI_HandleTypeDef *hspi, const uint
   /* Set the function for IT treatment */
   if (hspi->Init.DataSize > SPI_DATASIZE_16BIT)
   {
-    hspi->TxISR     = SPI_TxISR_32BIT;
-    hspi->RxISR     = SPI_RxISR_32BIT;
+    hspi->TxISR     = (hspi->Init.FifoThreshold > SPI_FIFO_THRESHOLD_01DATA) ? SPI_TxISR_32BIT_FIFO : SPI_TxISR_32BIT;
+    hspi->RxISR     = (hspi->Init.FifoThreshold > SPI_FIFO_THRESHOLD_01DATA) ? SPI_RxISR_32BIT_FIFO : SPI_RxISR_32BIT;
   }
   else if (hspi->Init.DataSize > SPI_DATASIZE_8BIT)
   {
-    hspi->RxISR     = SPI_RxISR_16BIT;
-    hspi->TxISR     = SPI_TxISR_16BIT;
+    hspi->RxISR     = (hspi->Init.FifoThreshold > SPI_FIFO_THRESHOLD_01DATA) ? SPI_RxISR_16BIT_FIFO : SPI_RxISR_16BIT;
+    hspi->TxISR     = (hspi->Init.FifoThreshold > SPI_FIFO_THRESHOLD_01DATA) ? SPI_TxISR_16BIT_FIFO : SPI_TxISR_16BIT;
   }
   else
   {
-    hspi->RxISR     = SPI_RxISR_8BIT;
-    hspi->TxISR     = SPI_TxISR_8BIT;
+    hspi->RxISR     = (hspi->Init.FifoThreshold > SPI_FIFO_THRESHOLD_01DATA) ? SPI_RxISR_8BIT_FIFO : SPI_RxISR_8BIT;
+    hspi->TxISR     = (hspi->Init.FifoThreshold > SPI_FIFO_THRESHOLD_01DATA) ? SPI_TxISR_8BIT_FIFO : SPI_TxISR_8BIT;
   }
 
   /* Set Full-Duplex mode */
@@ -2260,6 +2311,161 @@ HAL_StatusTypeDef HAL_SPI_Receive_DMA(SPI_HandleTypeDef *hspi, uint8_t *pData, u
   return errorcode;
 }
 
+/**
+  * @brief  Receive data endlessly in non-blocking mode with DMA double buffer mode.
+  * @param  hspi  : pointer to a SPI_HandleTypeDef structure that contains
+  *                 the configuration information for SPI module.
+  * @param  pData0: pointer to the first data buffer (DMA memory 0)
+  * @param  pData1: pointer to the second data buffer (DMA memory 1)
+  * @param  Size  : amount of data to be received in each buffer
+  * @note   The reception alternates between the two buffers until HAL_SPI_Abort() or
+  *         HAL_SPI_Abort_IT() is called. HAL_SPI_RxM0CpltCallback() and
+  *         HAL_SPI_RxM1CpltCallback() are executed each time the corresponding buffer
+  *         has been filled.
+  * @note   As for the DMA circular mode, this mode is only available in Slave mode
+  *         and does not manage the CRC feature.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SPI_ReceiveDoubleBuffer_DMA(SPI_HandleTypeDef *hspi, uint8_t *pData0, uint8_t *pData1,
+                                                  uint16_t Size)
+{
+  HAL_StatusTypeDef errorcode = HAL_OK;
+
+  /* Check Direction parameter */
+  assert_param(IS_SPI_DIRECTION_2LINES_OR_1LINE_2LINES_RXONLY(hspi->Init.Direction));
+
+  /* Lock the process */
+  __HAL_LOCK(hspi);
+
+  if (hspi->State != HAL_SPI_STATE_READY)
+  {
+    errorcode = HAL_BUSY;
+    __HAL_UNLOCK(hspi);
+    return errorcode;
+  }
+
+  if ((pData0 == NULL) || (pData1 == NULL) || (Size == 0UL))
+  {
+    errorcode = HAL_ERROR;
+    __HAL_UNLOCK(hspi);
+    return errorcode;
+  }
+
+  /* Endless reception is not possible in Master mode and CRC is not managed */
+  if ((hspi->Init.Mode == SPI_MODE_MASTER) || (hspi->Init.CRCCalculation == SPI_CRCCALCULATION_ENABLE))
+  {
+    errorcode = HAL_ERROR;
+    __HAL_UNLOCK(hspi);
+    return errorcode;
+  }
+
+  /* Packing mode management is enabled by the DMA settings */
+  if (((hspi->Init.DataSize > SPI_DATASIZE_16BIT) && (hspi->hdmarx->Init.MemDataAlignment != DMA_MDATAALIGN_WORD))    || \
+      ((hspi->Init.DataSize > SPI_DATASIZE_8BIT) && ((hspi->hdmarx->Init.MemDataAlignment != DMA_MDATAALIGN_HALFWORD) && \
+                                                     (hspi->hdmarx->Init.MemDataAlignment != DMA_MDATAALIGN_WORD))))
+  {
+    /* Restriction the DMA data received is not allowed in this mode */
+    errorcode = HAL_ERROR;
+    __HAL_UNLOCK(hspi);
+    return errorcode;
+  }
+
+  /* Set the transaction information */
+  hspi->State       = HAL_SPI_STATE_BUSY_RX;
+  hspi->ErrorCode   = HAL_SPI_ERROR_NONE;
+  hspi->pRxBuffPtr  = (uint8_t *)pData0;
+  hspi->RxXferSize  = Size;
+  hspi->RxXferCount = Size;
+
+  /*Init field not used in handle to zero */
+  hspi->RxISR       = NULL;
+  hspi->TxISR       = NULL;
+  hspi->TxXferSize  = (uint16_t) 0UL;
+  hspi->TxXferCount = (uint16_t) 0UL;
+
+  /* Configure communication direction : 1Line */
+  if (hspi->Init.Direction == SPI_DIRECTION_1LINE)
+  {
+    SPI_1LINE_RX(hspi);
+  }
+  else
+  {
+    SPI_2LINES_RX(hspi);
+  }
+
+  /* Clear RXDMAEN bit */
+  CLEAR_BIT(hspi->Instance->CFG1, SPI_CFG1_RXDMAEN);
+
+  /* Adjust XferCount according to DMA alignment / Data size */
+  if (hspi->Init.DataSize <= SPI_DATASIZE_8BIT)
+  {
+    if (hspi->hdmarx->Init.MemDataAlignment == DMA_MDATAALIGN_HALFWORD)
+    {
+      hspi->RxXferCount = (hspi->RxXferCount + (uint16_t) 1UL) >> 1UL;
+    }
+    if (hspi->hdmarx->Init.MemDataAlignment == DMA_MDATAALIGN_WORD)
+    {
+      hspi->RxXferCount = (hspi->RxXferCount + (uint16_t) 3UL) >> 2UL;
+    }
+  }
+  else if (hspi->Init.DataSize <= SPI_DATASIZE_16BIT)
+  {
+    if (hspi->hdmarx->Init.MemDataAlignment == DMA_MDATAALIGN_WORD)
+    {
+      hspi->RxXferCount = (hspi->RxXferCount + (uint16_t) 1UL) >> 1UL;
+    }
+  }
+  else
+  {
+    /* Adjustment done */
+  }
+
+  /* Half transfer callbacks are not used in double buffer mode */
+  hspi->hdmarx->XferHalfCpltCallback   = NULL;
+  hspi->hdmarx->XferM1HalfCpltCallback = NULL;
+
+  /* Set the SPI Rx DMA memory 0 and memory 1 transfer complete callbacks */
+  hspi->hdmarx->XferCpltCallback   = SPI_DMAReceiveM0Cplt;
+  hspi->hdmarx->XferM1CpltCallback = SPI_DMAReceiveM1Cplt;
+
+  /* Set the DMA error callback */
+  hspi->hdmarx->XferErrorCallback = SPI_DMAError;
+
+  /* Set the DMA AbortCpltCallback */
+  hspi->hdmarx->XferAbortCallback = NULL;
+
+  /* Enable the Rx DMA Stream/Channel in double buffer mode */
+  if (HAL_OK != HAL_DMAEx_MultiBufferStart_IT(hspi->hdmarx, (uint32_t)&hspi->Instance->RXDR, (uint32_t)pData0,
+                                              (uint32_t)pData1, hspi->RxXferCount))
+  {
+    /* Update SPI error code */
+    SET_BIT(hspi->ErrorCode, HAL_SPI_ERROR_DMA);
+
+    /* Unlock the process */
+    __HAL_UNLOCK(hspi);
+
+    hspi->State = HAL_SPI_STATE_READY;
+    errorcode = HAL_ERROR;
+    return errorcode;
+  }
+
+  /* Endless transfer */
+  MODIFY_REG(hspi->Instance->CR2, SPI_CR2_TSIZE, 0UL);
+
+  /* Enable Rx DMA Request */
+  SET_BIT(hspi->Instance->CFG1, SPI_CFG1_RXDMAEN);
+
+  /* Enable the SPI Error Interrupt Bit */
+  __HAL_SPI_ENABLE_IT(hspi, (SPI_IT_OVR | SPI_IT_FRE | SPI_IT_MODF));
+
+  /* Enable SPI peripheral */
+  __HAL_SPI_ENABLE(hspi);
+
+  /* Unlock the process */
+  __HAL_UNLOCK(hspi);
+  return errorcode;
+}
+
 /**
   * @brief  Transmit and Receive an amount of data in non-blocking mode with DMA.
   * @param  hspi   : pointer to a SPI_HandleTypeDef structure that contains
@@ -2786,7 +2992,7 @@ HAL_StatusTypeDef HAL_SPI_DMAStop(SPI_HandleTypeDef *hspi)
   *               the configuration information for the specified SPI module.
   * @retval None
   */
-void HAL_SPI_IRQHandler(SPI_HandleTypeDef *hspi)
+__HOT_RAM_FUNC void HAL_SPI_IRQHandler(SPI_HandleTypeDef *hspi)
 {
   uint32_t itsource = hspi->Instance->IER;
   uint32_t itflag   = hspi->Instance->SR;
@@ -3130,6 +3336,38 @@ __weak void HAL_SPI_TxRxHalfCpltCallback(SPI_HandleTypeDef *hspi)
    */
 }
 
+/**
+  * @brief Rx memory 0 buffer completed callback (double buffer reception).
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *               the configuration information for SPI module.
+  * @retval None
+  */
+__weak void HAL_SPI_RxM0CpltCallback(SPI_HandleTypeDef *hspi)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hspi);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_SPI_RxM0CpltCallback() should be implemented in the user file
+   */
+}
+
+/**
+  * @brief Rx memory 1 buffer completed callback (double buffer reception).
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *               the configuration information for SPI module.
+  * @retval None
+  */
+__weak void HAL_SPI_RxM1CpltCallback(SPI_HandleTypeDef *hspi)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hspi);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_SPI_RxM1CpltCallback() should be implemented in the user file
+   */
+}
+
 /**
   * @brief SPI error callback.
   * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
@@ -3370,6 +3608,40 @@ static void SPI_DMAHalfTransmitReceiveCplt(DMA_HandleTypeDef *hdma)
 #endif /* USE_HAL_SPI_REGISTER_CALLBACKS */
 }
 
+/**
+  * @brief  DMA SPI memory 0 receive complete callback (double buffer mode).
+  * @param  hdma: pointer to a DMA_HandleTypeDef structure that contains
+  *               the configuration information for the specified DMA module.
+  * @retval None
+  */
+static void SPI_DMAReceiveM0Cplt(DMA_HandleTypeDef *hdma)
+{
+  SPI_HandleTypeDef *hspi = (SPI_HandleTypeDef *)((DMA_HandleTypeDef *)hdma)->Parent;
+
+#if (USE_HAL_SPI_REGISTER_CALLBACKS == 1UL)
+  hspi->RxM0CpltCallback(hspi);
+#else
+  HAL_SPI_RxM0CpltCallback(hspi);
+#endif /* USE_HAL_SPI_REGISTER_CALLBACKS */
+}
+
+/**
+  * @brief  DMA SPI memory 1 receive complete callback (double buffer mode).
+  * @param  hdma: pointer to a DMA_HandleTypeDef structure that contains
+  *               the configuration information for the specified DMA module.
+  * @retval None
+  */
+static void SPI_DMAReceiveM1Cplt(DMA_HandleTypeDef *hdma)
+{
+  SPI_HandleTypeDef *hspi = (SPI_HandleTypeDef *)((DMA_HandleTypeDef *)hdma)->Parent;
+
+#if (USE_HAL_SPI_REGISTER_CALLBACKS == 1UL)
+  hspi->RxM1CpltCallback(hspi);
+#else
+  HAL_SPI_RxM1CpltCallback(hspi);
+#endif /* USE_HAL_SPI_REGISTER_CALLBACKS */
+}
+
 /**
   * @brief  DMA SPI communication error callback.
   * @param  hdma: pointer to a DMA_HandleTypeDef structure that contains
@@ -3498,7 +3770,7 @@ static void SPI_DMARxAbortCallback(DMA_HandleTypeDef *hdma)
   *               the configuration information for SPI module.
   * @retval None
   */
-static void SPI_RxISR_8BIT(SPI_HandleTypeDef *hspi)
+static __HOT_RAM_FUNC void SPI_RxISR_8BIT(SPI_HandleTypeDef *hspi)
 {
   /* Receive data in 8 Bit mode */
   *((uint8_t *)hspi->pRxBuffPtr) = (*(__IO uint8_t *)&hspi->Instance->RXDR);
@@ -3535,7 +3807,7 @@ static void SPI_RxISR_8BIT(SPI_HandleTypeDef *hspi)
   *               the configuration information for SPI module.
   * @retval None
   */
-static void SPI_RxISR_16BIT(SPI_HandleTypeDef *hspi)
+static __HOT_RAM_FUNC void SPI_RxISR_16BIT(SPI_HandleTypeDef *hspi)
 {
   /* Receive data in 16 Bit mode */
 #if defined (__GNUC__)
@@ -3578,7 +3850,7 @@ static void SPI_RxISR_16BIT(SPI_HandleTypeDef *hspi)
   *               the configuration information for SPI module.
   * @retval None
   */
-static void SPI_RxISR_32BIT(SPI_HandleTypeDef *hspi)
+static __HOT_RAM_FUNC void SPI_RxISR_32BIT(SPI_HandleTypeDef *hspi)
 {
   /* Receive data in 32 Bit mode */
   *((uint32_t *)hspi->pRxBuffPtr) = (*(__IO uint32_t *)&hspi->Instance->RXDR);
@@ -3615,7 +3887,7 @@ static void SPI_RxISR_32BIT(SPI_HandleTypeDef *hspi)
   *               the configuration information for SPI module.
   * @retval None
   */
-static void SPI_TxISR_8BIT(SPI_HandleTypeDef *hspi)
+static __HOT_RAM_FUNC void SPI_TxISR_8BIT(SPI_HandleTypeDef *hspi)
 {
   /* Transmit data in 8 Bit mode */
   *(__IO uint8_t *)&hspi->Instance->TXDR = *((const uint8_t *)hspi->pTxBuffPtr);
@@ -3651,7 +3923,7 @@ static void SPI_TxISR_8BIT(SPI_HandleTypeDef *hspi)
   *               the configuration information for SPI module.
   * @retval None
   */
-static void SPI_TxISR_16BIT(SPI_HandleTypeDef *hspi)
+static __HOT_RAM_FUNC void SPI_TxISR_16BIT(SPI_HandleTypeDef *hspi)
 {
   /* Transmit data in 16 Bit mode */
 #if defined (__GNUC__)
@@ -3693,7 +3965,7 @@ static void SPI_TxISR_16BIT(SPI_HandleTypeDef *hspi)
   *               the configuration information for SPI module.
   * @retval None
   */
-static void SPI_TxISR_32BIT(SPI_HandleTypeDef *hspi)
+static __HOT_RAM_FUNC void SPI_TxISR_32BIT(SPI_HandleTypeDef *hspi)
 {
   /* Transmit data in 32 Bit mode */
   *((__IO uint32_t *)&hspi->Instance->TXDR) = *((const uint32_t *)hspi->pTxBuffPtr);
@@ -3723,6 +3995,375 @@ static void SPI_TxISR_32BIT(SPI_HandleTypeDef *hspi)
   }
 }
 
+/**
+  * @brief  Manage the 8-bit receive of a whole FIFO packet in Interrupt context.
+  * @note   The packet data are read by 32-bit and 16-bit accesses. A last packet
+  *         shorter than the FIFO threshold is read one data per interrupt, or
+  *         drained on end of transfer.
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *               the configuration information for SPI module.
+  * @retval None
+  */
+static __HOT_RAM_FUNC void SPI_RxISR_8BIT_FIFO(SPI_HandleTypeDef *hspi)
+{
+#if defined (__GNUC__)
+  __IO uint16_t *prxdr_16bits = (__IO uint16_t *)(&(hspi->Instance->RXDR));
+#endif /* __GNUC__ */
+  uint32_t count = (hspi->Init.FifoThreshold >> SPI_CFG1_FTHLV_Pos) + 1UL;
+
+  /* RXP only reports complete packets */
+  if (hspi->RxXferCount < count)
+  {
+    count = 1UL;
+  }
+  hspi->RxXferCount -= (uint16_t)count;
+
+  /* Receive data in packed 32 Bit mode */
+  while (count > 3UL)
+  {
+    *((uint32_t *)hspi->pRxBuffPtr) = (*(__IO uint32_t *)&hspi->Instance->RXDR);
+    hspi->pRxBuffPtr += sizeof(uint32_t);
+    count -= 4UL;
+  }
+
+  /* Receive the packet tail in 16 Bit and 8 Bit mode */
+  if (count > 1UL)
+  {
+#if defined (__GNUC__)
+    *((uint16_t *)hspi->pRxBuffPtr) = *prxdr_16bits;
+#else
+    *((uint16_t *)hspi->pRxBuffPtr) = (*(__IO uint16_t *)&hspi->Instance->RXDR);
+#endif /* __GNUC__ */
+    hspi->pRxBuffPtr += sizeof(uint16_t);
+    count -= 2UL;
+  }
+  if (count != 0UL)
+  {
+    *((uint8_t *)hspi->pRxBuffPtr) = (*(__IO uint8_t *)&hspi->Instance->RXDR);
+    hspi->pRxBuffPtr += sizeof(uint8_t);
+  }
+
+  /* Disable IT if no more data excepted */
+  if (hspi->RxXferCount == 0UL)
+  {
+#if defined(USE_SPI_RELOAD_TRANSFER)
+    /* Check if there is any request to reload */
+    if (hspi->Reload.Requested == 1UL)
+    {
+      hspi->RxXferSize  = hspi->Reload.RxXferSize;
+      hspi->RxXferCount = hspi->Reload.RxXferSize;
+      hspi->pRxBuffPtr  = hspi->Reload.pRxBuffPtr;
+    }
+    else
+    {
+      /* Disable RXP interrupts */
+      __HAL_SPI_DISABLE_IT(hspi, SPI_IT_RXP);
+    }
+#else
+    /* Disable RXP interrupts */
+    __HAL_SPI_DISABLE_IT(hspi, SPI_IT_RXP);
+#endif /* USE_SPI_RELOAD_TRANSFER */
+  }
+}
+
+/**
+  * @brief  Manage the 16-bit receive of a whole FIFO packet in Interrupt context.
+  * @note   The packet data are read by pairs with 32-bit accesses. A last packet
+  *         shorter than the FIFO threshold is read one data per interrupt, or
+  *         drained on end of transfer.
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *               the configuration information for SPI module.
+  * @retval None
+  */
+static __HOT_RAM_FUNC void SPI_RxISR_16BIT_FIFO(SPI_HandleTypeDef *hspi)
+{
+#if defined (__GNUC__)
+  __IO uint16_t *prxdr_16bits = (__IO uint16_t *)(&(hspi->Instance->RXDR));
+#endif /* __GNUC__ */
+  uint32_t count = (hspi->Init.FifoThreshold >> SPI_CFG1_FTHLV_Pos) + 1UL;
+
+  /* RXP only reports complete packets */
+  if (hspi->RxXferCount < count)
+  {
+    count = 1UL;
+  }
+  hspi->RxXferCount -= (uint16_t)count;
+
+  /* Receive data in packed 32 Bit mode */
+  while (count > 1UL)
+  {
+    *((uint32_t *)hspi->pRxBuffPtr) = (*(__IO uint32_t *)&hspi->Instance->RXDR);
+    hspi->pRxBuffPtr += sizeof(uint32_t);
+    count -= 2UL;
+  }
+
+  /* Receive the packet tail in 16 Bit mode */
+  if (count != 0UL)
+  {
+#if defined (__GNUC__)
+    *((uint16_t *)hspi->pRxBuffPtr) = *prxdr_16bits;
+#else
+    *((uint16_t *)hspi->pRxBuffPtr) = (*(__IO uint16_t *)&hspi->Instance->RXDR);
+#endif /* __GNUC__ */
+    hspi->pRxBuffPtr += sizeof(uint16_t);
+  }
+
+  /* Disable IT if no more data excepted */
+  if (hspi->RxXferCount == 0UL)
+  {
+#if defined(USE_SPI_RELOAD_TRANSFER)
+    /* Check if there is any request to reload */
+    if (hspi->Reload.Requested == 1UL)
+    {
+      hspi->RxXferSize  = hspi->Reload.RxXferSize;
+      hspi->RxXferCount = hspi->Reload.RxXferSize;
+      hspi->pRxBuffPtr  = hspi->Reload.pRxBuffPtr;
+    }
+    else
+    {
+      /* Disable RXP interrupts */
+      __HAL_SPI_DISABLE_IT(hspi, SPI_IT_RXP);
+    }
+#else
+    /* Disable RXP interrupts */
+    __HAL_SPI_DISABLE_IT(hspi, SPI_IT_RXP);
+#endif /* USE_SPI_RELOAD_TRANSFER */
+  }
+}
+
+/**
+  * @brief  Manage the 32-bit receive of a whole FIFO packet in Interrupt context.
+  * @note   A last packet shorter than the FIFO threshold is read one data per
+  *         interrupt, or drained on end of transfer.
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *               the configuration information for SPI module.
+  * @retval None
+  */
+static __HOT_RAM_FUNC void SPI_RxISR_32BIT_FIFO(SPI_HandleTypeDef *hspi)
+{
+  uint32_t count = (hspi->Init.FifoThreshold >> SPI_CFG1_FTHLV_Pos) + 1UL;
+
+  /* RXP only reports complete packets */
+  if (hspi->RxXferCount < count)
+  {
+    count = 1UL;
+  }
+  hspi->RxXferCount -= (uint16_t)count;
+
+  /* Receive data in 32 Bit mode */
+  while (count != 0UL)
+  {
+    *((uint32_t *)hspi->pRxBuffPtr) = (*(__IO uint32_t *)&hspi->Instance->RXDR);
+    hspi->pRxBuffPtr += sizeof(uint32_t);
+    count--;
+  }
+
+  /* Disable IT if no more data excepted */
+  if (hspi->RxXferCount == 0UL)
+  {
+#if defined(USE_SPI_RELOAD_TRANSFER)
+    /* Check if there is any request to reload */
+    if (hspi->Reload.Requested == 1UL)
+    {
+      hspi->RxXferSize  = hspi->Reload.RxXferSize;
+      hspi->RxXferCount = hspi->Reload.RxXferSize;
+      hspi->pRxBuffPtr  = hspi->Reload.pRxBuffPtr;
+    }
+    else
+    {
+      /* Disable RXP interrupts */
+      __HAL_SPI_DISABLE_IT(hspi, SPI_IT_RXP);
+    }
+#else
+    /* Disable RXP interrupts */
+    __HAL_SPI_DISABLE_IT(hspi, SPI_IT_RXP);
+#endif /* USE_SPI_RELOAD_TRANSFER */
+  }
+}
+
+/**
+  * @brief  Handle the 8-bit transmit of a whole FIFO packet in Interrupt mode.
+  * @note   The packet data are written by 32-bit and 16-bit accesses, the last
+  *         packet may be shorter than the FIFO threshold.
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *               the configuration information for SPI module.
+  * @retval None
+  */
+static __HOT_RAM_FUNC void SPI_TxISR_8BIT_FIFO(SPI_HandleTypeDef *hspi)
+{
+#if defined (__GNUC__)
+  __IO uint16_t *ptxdr_16bits = (__IO uint16_t *)(&(hspi->Instance->TXDR));
+#endif /* __GNUC__ */
+  uint32_t count = (hspi->Init.FifoThreshold >> SPI_CFG1_FTHLV_Pos) + 1UL;
+
+  /* TXP reports room for a complete packet */
+  if (hspi->TxXferCount < count)
+  {
+    count = hspi->TxXferCount;
+  }
+  hspi->TxXferCount -= (uint16_t)count;
+
+  /* Transmit data in packed 32 Bit mode */
+  while (count > 3UL)
+  {
+    *((__IO uint32_t *)&hspi->Instance->TXDR) = *((const uint32_t *)hspi->pTxBuffPtr);
+    hspi->pTxBuffPtr += sizeof(uint32_t);
+    count -= 4UL;
+  }
+
+  /* Transmit the packet tail in 16 Bit and 8 Bit mode */
+  if (count > 1UL)
+  {
+#if defined (__GNUC__)
+    *ptxdr_16bits = *((const uint16_t *)hspi->pTxBuffPtr);
+#else
+    *((__IO uint16_t *)&hspi->Instance->TXDR) = *((const uint16_t *)hspi->pTxBuffPtr);
+#endif /* __GNUC__ */
+    hspi->pTxBuffPtr += sizeof(uint16_t);
+    count -= 2UL;
+  }
+  if (count != 0UL)
+  {
+    *(__IO uint8_t *)&hspi->Instance->TXDR = *((const uint8_t *)hspi->pTxBuffPtr);
+    hspi->pTxBuffPtr += sizeof(uint8_t);
+  }
+
+  /* Disable IT if no more data excepted */
+  if (hspi->TxXferCount == 0UL)
+  {
+#if defined(USE_SPI_RELOAD_TRANSFER)
+    /* Check if there is any request to reload */
+    if (hspi->Reload.Requested == 1UL)
+    {
+      hspi->TxXferSize  = hspi->Reload.TxXferSize;
+      hspi->TxXferCount = hspi->Reload.TxXferSize;
+      hspi->pTxBuffPtr  = hspi->Reload.pTxBuffPtr;
+    }
+    else
+    {
+      /* Disable TXP interrupts */
+      __HAL_SPI_DISABLE_IT(hspi, SPI_IT_TXP);
+    }
+#else
+    /* Disable TXP interrupts */
+    __HAL_SPI_DISABLE_IT(hspi, SPI_IT_TXP);
+#endif /* USE_SPI_RELOAD_TRANSFER */
+  }
+}
+
+/**
+  * @brief  Handle the 16-bit transmit of a whole FIFO packet in Interrupt mode.
+  * @note   The packet data are written by pairs with 32-bit accesses, the last
+  *         packet may be shorter than the FIFO threshold.
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *               the configuration information for SPI module.
+  * @retval None
+  */
+static __HOT_RAM_FUNC void SPI_TxISR_16BIT_FIFO(SPI_HandleTypeDef *hspi)
+{
+#if defined (__GNUC__)
+  __IO uint16_t *ptxdr_16bits = (__IO uint16_t *)(&(hspi->Instance->TXDR));
+#endif /* __GNUC__ */
+  uint32_t count = (hspi->Init.FifoThreshold >> SPI_CFG1_FTHLV_Pos) + 1UL;
+
+  /* TXP reports room for a complete packet */
+  if (hspi->TxXferCount < count)
+  {
+    count = hspi->TxXferCount;
+  }
+  hspi->TxXferCount -= (uint16_t)count;
+
+  /* Transmit data in packed 32 Bit mode */
+  while (count > 1UL)
+  {
+    *((__IO uint32_t *)&hspi->Instance->TXDR) = *((const uint32_t *)hspi->pTxBuffPtr);
+    hspi->pTxBuffPtr += sizeof(uint32_t);
+    count -= 2UL;
+  }
+
+  /* Transmit the packet tail in 16 Bit mode */
+  if (count != 0UL)
+  {
+#if defined (__GNUC__)
+    *ptxdr_16bits = *((const uint16_t *)hspi->pTxBuffPtr);
+#else
+    *((__IO uint16_t *)&hspi->Instance->TXDR) = *((const uint16_t *)hspi->pTxBuffPtr);
+#endif /* __GNUC__ */
+    hspi->pTxBuffPtr += sizeof(uint16_t);
+  }
+
+  /* Disable IT if no more data excepted */
+  if (hspi->TxXferCount == 0UL)
+  {
+#if defined(USE_SPI_RELOAD_TRANSFER)
+    /* Check if there is any request to reload */
+    if (hspi->Reload.Requested == 1UL)
+    {
+      hspi->TxXferSize  = hspi->Reload.TxXferSize;
+      hspi->TxXferCount = hspi->Reload.TxXferSize;
+      hspi->pTxBuffPtr  = hspi->Reload.pTxBuffPtr;
+    }
+    else
+    {
+      /* Disable TXP interrupts */
+      __HAL_SPI_DISABLE_IT(hspi, SPI_IT_TXP);
+    }
+#else
+    /* Disable TXP interrupts */
+    __HAL_SPI_DISABLE_IT(hspi, SPI_IT_TXP);
+#endif /* USE_SPI_RELOAD_TRANSFER */
+  }
+}
+
+/**
+  * @brief  Handle the 32-bit transmit of a whole FIFO packet in Interrupt mode.
+  * @note   The last packet may be shorter than the FIFO threshold.
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *               the configuration information for SPI module.
+  * @retval None
+  */
+static __HOT_RAM_FUNC void SPI_TxISR_32BIT_FIFO(SPI_HandleTypeDef *hspi)
+{
+  uint32_t count = (hspi->Init.FifoThreshold >> SPI_CFG1_FTHLV_Pos) + 1UL;
+
+  /* TXP reports room for a complete packet */
+  if (hspi->TxXferCount < count)
+  {
+    count = hspi->TxXferCount;
+  }
+  hspi->TxXferCount -= (uint16_t)count;
+
+  /* Transmit data in 32 Bit mode */
+  while (count != 0UL)
+  {
+    *((__IO uint32_t *)&hspi->Instance->TXDR) = *((const uint32_t *)hspi->pTxBuffPtr);
+    hspi->pTxBuffPtr += sizeof(uint32_t);
+    count--;
+  }
+
+  /* Disable IT if no more data excepted */
+  if (hspi->TxXferCount == 0UL)
+  {
+#if defined(USE_SPI_RELOAD_TRANSFER)
+    /* Check if there is any request to reload */
+    if (hspi->Reload.Requested == 1UL)
+    {
+      hspi->TxXferSize  = hspi->Reload.TxXferSize;
+      hspi->TxXferCount = hspi->Reload.TxXferSize;
+      hspi->pTxBuffPtr  = hspi->Reload.pTxBuffPtr;
+    }
+    else
+    {
+      /* Disable TXP interrupts */
+      __HAL_SPI_DISABLE_IT(hspi, SPI_IT_TXP);
+    }
+#else
+    /* Disable TXP interrupts */
+    __HAL_SPI_DISABLE_IT(hspi, SPI_IT_TXP);
+#endif /* USE_SPI_RELOAD_TRANSFER */
+  }
+}
+
 /**
   * @brief  Abort Transfer and clear flags.
   * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
@@ -3851,6 +4492,9 @@ static HAL_StatusTypeDef SPI_WaitOnFlagUntilTimeout(SPI_HandleTypeDef *hspi, uin
   /* Wait until flag is set */
   while ((__HAL_SPI_GET_FLAG(hspi, Flag) ? SET : RESET) == Status)
   {
+    /* Let the application yield or sleep while waiting */
+    HAL_WaitHook(HAL_WAIT_SPI, hspi);
+
     /* Check for the Timeout */
     if ((((HAL_GetTick() - Tickstart) >=  Timeout) && (Timeout != HAL_MAX_DELAY)) || (Timeout == 0U))
     {
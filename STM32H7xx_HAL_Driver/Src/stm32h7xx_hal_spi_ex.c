@@ -39,6 +39,14 @@
 /* Private macros ------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
+/** @defgroup SPIEx_Private_Functions SPIEx Private Functions
+  * @{
+  */
+static HAL_StatusTypeDef SPIEx_NSSFrameStartTx(SPI_HandleTypeDef *hspi, uint32_t Address, uint32_t Size);
+/**
+  * @}
+  */
+
 /* Exported functions --------------------------------------------------------*/
 
 /** @defgroup SPIEx_Exported_Functions SPIEx Exported Functions
@@ -61,6 +69,11 @@
         (++) HAL_SPIEx_FlushRxFifo()
         (++) HAL_SPIEx_EnableLockConfiguration()
         (++) HAL_SPIEx_ConfigureUnderrun()
+        (++) HAL_SPIEx_NSSFrame_Start()
+        (++) HAL_SPIEx_NSSFrame_Stop()
+        (++) HAL_SPIEx_NSSFrame_SetResponse()
+        (++) HAL_SPIEx_NSSFrame_Get()
+        (++) HAL_SPIEx_NSSFrame_IRQHandler()
 
 @endverbatim
   * @{
@@ -212,6 +225,455 @@ HAL_StatusTypeDef HAL_SPIEx_ConfigureUnderrun(SPI_HandleTypeDef *hspi, uint32_t
   * @}
   */
 
+/** @defgroup SPIEx_Exported_Functions_Group2 NSS framed slave functions
+  *  @brief   Variable length frames delimited by NSS
+  *
+@verbatim
+  ==============================================================================
+                  ##### NSS framed slave functions #####
+ ===============================================================================
+ [..]
+    This subsection provides a set of functions allowing a slave to receive
+    frames of any length, each frame being delimited by the deassertion of
+    NSS by the master, and to pre-load the response of the next frame.
+
+    (#) Initialize the SPI in full duplex slave mode with HAL_SPI_Init(),
+        Init.NSS set to SPI_NSS_HARD_INPUT and Init.FifoThreshold set to
+        SPI_FIFO_THRESHOLD_01DATA, so that no data is left in the RxFIFO
+        at the frame end.
+    (#) Link a circular Rx DMA and a normal Tx DMA to the handle, their memory
+        data width matching the data size. The buffers are placed in a memory
+        accessible by the DMA and not cached by the D-Cache.
+    (#) Configure an EXTI line on the rising edge of the NSS pin, its priority
+        being high enough to be served within the time between two frames, and
+        call HAL_SPIEx_NSSFrame_IRQHandler() from its callback.
+    (#) Start the reception with HAL_SPIEx_NSSFrame_Start(), giving the
+        response of the first frame, if any.
+    (#) On each frame end:
+        (++) the Tx DMA is stopped and the SPI disabled to flush the data of
+             the response already in the TxFIFO
+        (++) the frame is added to the queue as an offset and a length in the
+             reception buffer
+        (++) the response set with HAL_SPIEx_NSSFrame_SetResponse() is loaded
+             in the Tx DMA, and the SPI enabled again
+        (++) HAL_SPIEx_NSSFrameCallback() is called
+    (#) Read the frames with HAL_SPIEx_NSSFrame_Get(), before the reception
+        buffer wraps over them.
+    (#) Stop the reception with HAL_SPIEx_NSSFrame_Stop(), after disabling the
+        NSS EXTI line.
+
+    [..]
+    (@) Within a frame, the transfer is only served by the DMA: the SPI clock
+        rate is limited by the DMA and not by the CPU. The handler runs once
+        per frame, while NSS is high.
+    (@) A response set from HAL_SPIEx_NSSFrameCallback() is sent in the frame
+        after the next one, the next one having been loaded before the call.
+        When no response is set, the slave sends the underrun pattern
+        configured with HAL_SPIEx_ConfigureUnderrun(). A response shorter than
+        the frame is followed by the same pattern.
+    (@) A frame is at most RxSize - 1 data long.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Start the reception of frames delimited by NSS in slave mode with DMA.
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *               the configuration information for SPI module.
+  * @param  pFrame: pointer to the NSS framed slave context, kept until HAL_SPIEx_NSSFrame_Stop()
+  * @param  pRxBuffer: pointer to the circular reception buffer
+  * @param  RxSize: amount of data held by pRxBuffer, at least 2
+  * @param  pTxData: pointer to the response of the first frame, NULL if none
+  * @param  TxSize: amount of data of pTxData, 0 if none
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SPIEx_NSSFrame_Start(SPI_HandleTypeDef *hspi, SPI_NSSFrameTypeDef *pFrame, uint8_t *pRxBuffer,
+                                           uint16_t RxSize, const uint8_t *pTxData, uint16_t TxSize)
+{
+  uint32_t alignment;
+
+  /* Check Direction parameter */
+  assert_param(IS_SPI_DIRECTION_2LINES(hspi->Init.Direction));
+
+  /* Process Locked */
+  __HAL_LOCK(hspi);
+
+  if (hspi->State != HAL_SPI_STATE_READY)
+  {
+    /* Process Unlocked */
+    __HAL_UNLOCK(hspi);
+    return HAL_BUSY;
+  }
+
+  if (hspi->Init.DataSize <= SPI_DATASIZE_8BIT)
+  {
+    alignment = DMA_MDATAALIGN_BYTE;
+  }
+  else if (hspi->Init.DataSize <= SPI_DATASIZE_16BIT)
+  {
+    alignment = DMA_MDATAALIGN_HALFWORD;
+  }
+  else
+  {
+    alignment = DMA_MDATAALIGN_WORD;
+  }
+
+  if ((pFrame == NULL) || (pRxBuffer == NULL) || (RxSize < 2U) || ((pTxData == NULL) && (TxSize != 0U)) ||
+      (hspi->Init.Mode != SPI_MODE_SLAVE) || (hspi->Init.NSS != SPI_NSS_HARD_INPUT) ||
+      (hspi->Init.FifoThreshold != SPI_FIFO_THRESHOLD_01DATA) || (hspi->hdmarx == NULL) || (hspi->hdmatx == NULL))
+  {
+    /* Process Unlocked */
+    __HAL_UNLOCK(hspi);
+    return HAL_ERROR;
+  }
+
+  if ((hspi->hdmarx->Init.Mode != DMA_CIRCULAR) || (hspi->hdmatx->Init.Mode != DMA_NORMAL) ||
+      (hspi->hdmarx->Init.MemDataAlignment != alignment) || (hspi->hdmatx->Init.MemDataAlignment != alignment))
+  {
+    /* Process Unlocked */
+    __HAL_UNLOCK(hspi);
+    return HAL_ERROR;
+  }
+
+  /* Set the transaction information */
+  hspi->State       = HAL_SPI_STATE_BUSY_TX_RX;
+  hspi->ErrorCode   = HAL_SPI_ERROR_NONE;
+  hspi->pTxBuffPtr  = pTxData;
+  hspi->TxXferSize  = TxSize;
+  hspi->TxXferCount = TxSize;
+  hspi->pRxBuffPtr  = pRxBuffer;
+  hspi->RxXferSize  = RxSize;
+  hspi->RxXferCount = RxSize;
+
+  /* Init field not used in handle to zero */
+  hspi->RxISR       = NULL;
+  hspi->TxISR       = NULL;
+
+  /* Init the NSS framed slave context */
+  pFrame->pRxBuffer     = pRxBuffer;
+  pFrame->RxSize        = RxSize;
+  pFrame->RxTail        = 0U;
+  pFrame->NextTxAddress = 0U;
+  pFrame->NextTxSize    = 0U;
+  pFrame->TxActive      = 0U;
+  pFrame->QueueHead     = 0U;
+  pFrame->QueueTail     = 0U;
+  pFrame->FrameCount    = 0U;
+  pFrame->DropCount     = 0U;
+  hspi->pNSSFrame       = pFrame;
+
+  /* Set Full-Duplex mode */
+  SPI_2LINES(hspi);
+
+  /* Reset the Tx/Rx DMA bits */
+  CLEAR_BIT(hspi->Instance->CFG1, SPI_CFG1_TXDMAEN | SPI_CFG1_RXDMAEN);
+
+  /* Endless transfer, the frames being delimited by NSS */
+  MODIFY_REG(hspi->Instance->CR2, SPI_CR2_TSIZE, 0UL);
+
+  /* Both DMA run without interrupt */
+  hspi->hdmarx->XferHalfCpltCallback = NULL;
+  hspi->hdmarx->XferCpltCallback     = NULL;
+  hspi->hdmarx->XferErrorCallback    = NULL;
+  hspi->hdmarx->XferAbortCallback    = NULL;
+  hspi->hdmatx->XferHalfCpltCallback = NULL;
+  hspi->hdmatx->XferCpltCallback     = NULL;
+  hspi->hdmatx->XferErrorCallback    = NULL;
+  hspi->hdmatx->XferAbortCallback    = NULL;
+
+  /* Enable the Rx DMA Stream/Channel */
+  if (HAL_OK != HAL_DMA_Start(hspi->hdmarx, (uint32_t)&hspi->Instance->RXDR, (uint32_t)pRxBuffer, RxSize))
+  {
+    /* Update SPI error code */
+    SET_BIT(hspi->ErrorCode, HAL_SPI_ERROR_DMA);
+    hspi->pNSSFrame = NULL;
+    hspi->State = HAL_SPI_STATE_READY;
+
+    /* Process Unlocked */
+    __HAL_UNLOCK(hspi);
+    return HAL_ERROR;
+  }
+
+  /* Enable Rx DMA Request */
+  SET_BIT(hspi->Instance->CFG1, SPI_CFG1_RXDMAEN);
+
+  /* Pre-load the response of the first frame */
+  if (TxSize != 0U)
+  {
+    if (SPIEx_NSSFrameStartTx(hspi, (uint32_t)pTxData, TxSize) != HAL_OK)
+    {
+      CLEAR_BIT(hspi->Instance->CFG1, SPI_CFG1_RXDMAEN);
+      (void)HAL_DMA_Abort(hspi->hdmarx);
+
+      /* Update SPI error code */
+      SET_BIT(hspi->ErrorCode, HAL_SPI_ERROR_DMA);
+      hspi->pNSSFrame = NULL;
+      hspi->State = HAL_SPI_STATE_READY;
+
+      /* Process Unlocked */
+      __HAL_UNLOCK(hspi);
+      return HAL_ERROR;
+    }
+  }
+
+  /* Enable SPI peripheral */
+  __HAL_SPI_ENABLE(hspi);
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(hspi);
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop the reception of frames delimited by NSS.
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *               the configuration information for SPI module.
+  * @note   The NSS EXTI line is disabled by the application before this call.
+  *         The frames still in the queue are lost.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SPIEx_NSSFrame_Stop(SPI_HandleTypeDef *hspi)
+{
+  /* Process Locked */
+  __HAL_LOCK(hspi);
+
+  if (hspi->pNSSFrame == NULL)
+  {
+    /* Process Unlocked */
+    __HAL_UNLOCK(hspi);
+    return HAL_ERROR;
+  }
+
+  /* Disable SPI peripheral and the DMA requests */
+  __HAL_SPI_DISABLE(hspi);
+  CLEAR_BIT(hspi->Instance->CFG1, SPI_CFG1_TXDMAEN | SPI_CFG1_RXDMAEN);
+
+  (void)HAL_DMA_Abort(hspi->hdmarx);
+  if (hspi->pNSSFrame->TxActive != 0U)
+  {
+    (void)HAL_DMA_Abort(hspi->hdmatx);
+  }
+
+  hspi->pNSSFrame = NULL;
+  hspi->State = HAL_SPI_STATE_READY;
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(hspi);
+  return HAL_OK;
+}
+
+/**
+  * @brief  Set the response sent by the slave in the next frame.
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *               the configuration information for SPI module.
+  * @param  pData: pointer to the response, kept unchanged until it is sent
+  * @param  Size: amount of data of pData
+  * @note   The response is loaded at the end of the current frame, replacing a response
+  *         set before and not yet loaded. This function can be called from
+  *         HAL_SPIEx_NSSFrameCallback().
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SPIEx_NSSFrame_SetResponse(SPI_HandleTypeDef *hspi, const uint8_t *pData, uint16_t Size)
+{
+  SPI_NSSFrameTypeDef *pframe = hspi->pNSSFrame;
+
+  if ((pframe == NULL) || (pData == NULL) || (Size == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  /* The size is written last, an NSS edge in between loading no response */
+  pframe->NextTxSize    = 0U;
+  pframe->NextTxAddress = (uint32_t)pData;
+  pframe->NextTxSize    = Size;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Read the oldest frame of the queue.
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *               the configuration information for SPI module.
+  * @param  pOffset: pointer to the index of the first data of the frame in the reception buffer
+  * @param  pLength: pointer to the number of data of the frame, which wraps to the start of
+  *                  the reception buffer when Offset + Length is above RxSize
+  * @note   The queue has a single reader: this function is called either from thread mode or
+  *         from HAL_SPIEx_NSSFrameCallback(), not from both.
+  * @retval HAL_OK when a frame is returned, HAL_ERROR when the queue is empty
+  */
+HAL_StatusTypeDef HAL_SPIEx_NSSFrame_Get(SPI_HandleTypeDef *hspi, uint32_t *pOffset, uint32_t *pLength)
+{
+  SPI_NSSFrameTypeDef *pframe = hspi->pNSSFrame;
+  uint32_t tail;
+
+  if ((pframe == NULL) || (pOffset == NULL) || (pLength == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  tail = pframe->QueueTail;
+  if (tail == pframe->QueueHead)
+  {
+    return HAL_ERROR;
+  }
+
+  *pOffset = pframe->Queue[tail & (SPI_NSSFRAME_QUEUE_SIZE - 1UL)].Offset;
+  *pLength = pframe->Queue[tail & (SPI_NSSFRAME_QUEUE_SIZE - 1UL)].Length;
+  pframe->QueueTail = tail + 1UL;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Handle the end of a frame, on the rising edge of NSS.
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *               the configuration information for SPI module.
+  * @note   This function is called by the application from the EXTI callback of the NSS pin.
+  * @retval None
+  */
+__HOT_RAM_FUNC void HAL_SPIEx_NSSFrame_IRQHandler(SPI_HandleTypeDef *hspi)
+{
+  SPI_NSSFrameTypeDef *pframe = hspi->pNSSFrame;
+  uint32_t count = 0UL;
+  uint32_t head;
+  uint32_t length;
+  uint32_t size;
+
+  if (pframe == NULL)
+  {
+    return;
+  }
+
+  /* Let the Rx DMA read the last data of the frame */
+  while (((hspi->Instance->SR & (SPI_SR_RXPLVL | SPI_SR_RXWNE)) != 0UL) && (count < SPI_HIGHEND_FIFO_SIZE))
+  {
+    count++;
+  }
+
+  /* Index following the last data of the frame */
+  head = (uint32_t)pframe->RxSize - __HAL_DMA_GET_COUNTER(hspi->hdmarx);
+  if (head >= pframe->RxSize)
+  {
+    head = 0UL;
+  }
+
+  /* Disable the SPI: the data of the response pre-loaded beyond the frame end is flushed */
+  __HAL_SPI_DISABLE(hspi);
+  if (pframe->TxActive != 0U)
+  {
+    CLEAR_BIT(hspi->Instance->CFG1, SPI_CFG1_TXDMAEN);
+    (void)HAL_DMA_Abort(hspi->hdmatx);
+    pframe->TxActive = 0U;
+  }
+
+  /* Load the response of the next frame */
+  size = pframe->NextTxSize;
+  if (size != 0UL)
+  {
+    pframe->NextTxSize = 0UL;
+    if (SPIEx_NSSFrameStartTx(hspi, pframe->NextTxAddress, size) != HAL_OK)
+    {
+      /* Update SPI error code */
+      SET_BIT(hspi->ErrorCode, HAL_SPI_ERROR_DMA);
+    }
+  }
+
+  /* Enable SPI peripheral */
+  __HAL_SPI_ENABLE(hspi);
+
+  /* Queue the frame received since the last NSS edge */
+  if (head >= pframe->RxTail)
+  {
+    length = head - pframe->RxTail;
+  }
+  else
+  {
+    length = (head + pframe->RxSize) - pframe->RxTail;
+  }
+
+  if (length != 0UL)
+  {
+    if ((pframe->QueueHead - pframe->QueueTail) < SPI_NSSFRAME_QUEUE_SIZE)
+    {
+      pframe->Queue[pframe->QueueHead & (SPI_NSSFRAME_QUEUE_SIZE - 1UL)].Offset = pframe->RxTail;
+      pframe->Queue[pframe->QueueHead & (SPI_NSSFRAME_QUEUE_SIZE - 1UL)].Length = (uint16_t)length;
+      pframe->QueueHead++;
+    }
+    else
+    {
+      pframe->DropCount++;
+    }
+    pframe->RxTail = (uint16_t)head;
+    pframe->FrameCount++;
+  }
+
+  if (hspi->ErrorCode != HAL_SPI_ERROR_NONE)
+  {
+    /* Call user error callback */
+#if (USE_HAL_SPI_REGISTER_CALLBACKS == 1UL)
+    hspi->ErrorCallback(hspi);
+#else
+    HAL_SPI_ErrorCallback(hspi);
+#endif /* USE_HAL_SPI_REGISTER_CALLBACKS */
+  }
+
+  if (length != 0UL)
+  {
+    HAL_SPIEx_NSSFrameCallback(hspi);
+  }
+}
+
+/**
+  * @brief  Frame received callback, called on each NSS edge ending a frame.
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *               the configuration information for SPI module.
+  * @retval None
+  */
+__weak void HAL_SPIEx_NSSFrameCallback(SPI_HandleTypeDef *hspi)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hspi);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_SPIEx_NSSFrameCallback can be implemented in the user file
+   */
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/** @addtogroup SPIEx_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Start the Tx DMA of a response, the SPI being disabled.
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *               the configuration information for SPI module.
+  * @param  Address: address of the response
+  * @param  Size: amount of data of the response
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef SPIEx_NSSFrameStartTx(SPI_HandleTypeDef *hspi, uint32_t Address, uint32_t Size)
+{
+  if (HAL_DMA_Start(hspi->hdmatx, Address, (uint32_t)&hspi->Instance->TXDR, Size) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Enable Tx DMA Request, the TxFIFO being filled as soon as the SPI is enabled */
+  SET_BIT(hspi->Instance->CFG1, SPI_CFG1_TXDMAEN);
+  hspi->pNSSFrame->TxActive = 1U;
+
+  return HAL_OK;
+}
+
 /**
   * @}
   */
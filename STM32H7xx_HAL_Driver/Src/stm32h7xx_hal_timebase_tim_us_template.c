@@ -0,0 +1,322 @@
+/**
+  ******************************************************************************
+  * @file    stm32h7xx_hal_timebase_tim_us_template.c
+  * @author  MCD Application Team
+  * @brief   HAL tickless time base based on a free-running 32-bit TIM.
+  *
+  *          This file overrides the native HAL time base functions (defined as weak)
+  *          with a tickless TIM2 time base:
+  *           + Initializes TIM2 as a free-running 1 MHz counter, without periodic interrupt
+  *           + Extends it into a 64-bit monotonic microsecond clock, HAL_GetTickUs()
+  *           + HAL_GetTick() and HAL_Delay() are derived from this clock
+  *           + Provides a one-shot wake-up for tickless idle
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2017 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+ @verbatim
+  ==============================================================================
+                        ##### How to use this driver #####
+  ==============================================================================
+    [..]
+    This file must be copied to the application folder and modified as follows:
+    (#) Rename it to 'stm32h7xx_hal_timebase_tim_us.c'
+    (#) Add this file and the TIM HAL drivers to your project and uncomment
+       HAL_TIM_MODULE_ENABLED define in stm32h7xx_hal_conf.h
+    (#) TIM2 must not be used by the application.
+
+    [..]
+    The only TIM2 interrupt is the counter overflow, every 2^32 us (about 71 minutes),
+    so the core is not woken up each millisecond. HAL_IncTick() is not used and
+    uwTick is not updated.
+
+    [..] Tickless idle
+    (#) Call HAL_TIMEBASE_StartWakeUpUs() with the time to the next application
+        event, then enter Sleep mode with HAL_PWR_EnterSLEEPMode(). The TIM2 capture
+        compare 1 interrupt wakes the core up at the requested time.
+    (#) Call HAL_TIMEBASE_StopWakeUp() when the core is woken up earlier by another
+        interrupt and the wake-up is no longer needed.
+    (#) TIM2 is stopped in STOP mode: measure the time spent in STOP with the RTC or
+        a LPTIM and add it to the time base with HAL_TIMEBASE_CompensateUs().
+
+  @endverbatim
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32h7xx_hal.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static TIM_HandleTypeDef        TimHandle;
+static __IO uint32_t            TimeBaseHigh;    /* Counter overflows since last TIM2 initialization */
+static uint64_t                 TimeBaseOffset;  /* Time in us when TIM2 was last initialized     */
+/* Private function prototypes -----------------------------------------------*/
+void TIM2_IRQHandler(void);
+HAL_StatusTypeDef HAL_TIMEBASE_StartWakeUpUs(uint32_t DelayUs);
+void HAL_TIMEBASE_StopWakeUp(void);
+void HAL_TIMEBASE_CompensateUs(uint64_t ElapsedUs);
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  This function configures the TIM2 as a time base source.
+  *         The time source is configured as a free-running 1 MHz counter with a
+  *         dedicated overflow interrupt priority.
+  * @note   This function is called  automatically at the beginning of program after
+  *         reset by HAL_Init() or at any time when clock is configured, by HAL_RCC_ClockConfig().
+  *         The time elapsed is kept across calls, only the prescaler is updated.
+  * @param  TickPriority Tick interrupt priority.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_InitTick (uint32_t TickPriority)
+{
+  RCC_ClkInitTypeDef    clkconfig;
+  uint32_t              uwTimclock, uwAPB1Prescaler;
+  uint32_t              uwPrescalerValue;
+  uint32_t              pFLatency;
+  uint32_t              primask_bit;
+  uint64_t              now = 0U;
+  HAL_StatusTypeDef     status;
+
+  if (TickPriority >= (1UL << __NVIC_PRIO_BITS))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Enable TIM2 clock */
+  __HAL_RCC_TIM2_CLK_ENABLE();
+
+  /* Get clock configuration */
+  HAL_RCC_GetClockConfig(&clkconfig, &pFLatency);
+
+  /* Get APB1 prescaler */
+  uwAPB1Prescaler = clkconfig.APB1CLKDivider;
+
+  /* Compute TIM2 clock */
+  if (uwAPB1Prescaler == RCC_HCLK_DIV1)
+  {
+    uwTimclock = HAL_RCC_GetPCLK1Freq();
+  }
+  else
+  {
+    uwTimclock = 2UL * HAL_RCC_GetPCLK1Freq();
+  }
+
+  /* Compute the prescaler value to have TIM2 counter clock equal to 1MHz */
+  uwPrescalerValue = (uint32_t) ((uwTimclock / 1000000U) - 1U);
+
+  /* Initialize TIM2 */
+  TimHandle.Instance = TIM2;
+
+  /* Initialize TIMx peripheral as follow:
+  + Period = 0xFFFFFFFF to have a free-running counter, overflowing every 2^32 us.
+  + Prescaler = (uwTimclock/1000000 - 1) to have a 1MHz counter clock.
+  + ClockDivision = 0
+  + Counter direction = Up
+  */
+  TimHandle.Init.Period = 0xFFFFFFFFU;
+  TimHandle.Init.Prescaler = uwPrescalerValue;
+  TimHandle.Init.ClockDivision = 0U;
+  TimHandle.Init.CounterMode = TIM_COUNTERMODE_UP;
+
+  /* The counter is reset by the initialization: keep the elapsed time in the offset */
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  if (TimHandle.State != HAL_TIM_STATE_RESET)
+  {
+    now = HAL_GetTickUs();
+  }
+
+  status = HAL_TIM_Base_Init(&TimHandle);
+  if (status == HAL_OK)
+  {
+    TimeBaseOffset = now;
+    TimeBaseHigh = 0U;
+
+    /* Only counter overflows set the update flag */
+    __HAL_TIM_URS_ENABLE(&TimHandle);
+    __HAL_TIM_CLEAR_FLAG(&TimHandle, TIM_FLAG_UPDATE);
+
+    /* Start the TIM time Base generation in interrupt mode */
+    status = HAL_TIM_Base_Start_IT(&TimHandle);
+  }
+
+  __set_PRIMASK(primask_bit);
+
+  if (status == HAL_OK)
+  {
+    /* Enable the TIM2 global Interrupt */
+    HAL_NVIC_SetPriority(TIM2_IRQn, TickPriority, 0);
+    HAL_NVIC_EnableIRQ(TIM2_IRQn);
+    uwTickPrio = TickPriority;
+  }
+
+  /* Return function status */
+  return status;
+}
+
+/**
+  * @brief  Suspend Tick increment.
+  * @note   There is no periodic tick interrupt to disable with this time base, the
+  *         only TIM2 interrupt is the counter overflow which must be kept.
+  * @param  None
+  * @retval None
+  */
+void HAL_SuspendTick(void)
+{
+}
+
+/**
+  * @brief  Resume Tick increment.
+  * @note   There is no periodic tick interrupt to enable with this time base.
+  * @param  None
+  * @retval None
+  */
+void HAL_ResumeTick(void)
+{
+}
+
+/**
+  * @brief  Provide the time elapsed since the time base initialization in microsecond.
+  * @note   An overflow not yet handled by TIM2_IRQHandler(), because the interrupts
+  *         are masked or a higher priority interrupt is running, is taken into account.
+  * @retval 64-bit monotonic time in microsecond
+  */
+uint64_t HAL_GetTickUs(void)
+{
+  uint32_t primask_bit;
+  uint32_t high, low;
+
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  high = TimeBaseHigh;
+  low = TIM2->CNT;
+  if ((TIM2->SR & TIM_SR_UIF) != 0U)
+  {
+    /* Overflow pending: read again the counter to be sure it is after the overflow */
+    low = TIM2->CNT;
+    high++;
+  }
+
+  __set_PRIMASK(primask_bit);
+
+  return TimeBaseOffset + (((uint64_t)high << 32U) | low);
+}
+
+/**
+  * @brief  Provide a tick value in millisecond.
+  * @retval tick value
+  */
+uint32_t HAL_GetTick(void)
+{
+  return (uint32_t)(HAL_GetTickUs() / 1000U);
+}
+
+/**
+  * @brief  This function provides minimum delay (in milliseconds) based on the
+  *         microsecond time base.
+  * @note   The delay is measured in microsecond so no tick needs to be added to
+  *         guarantee the minimum wait.
+  * @param  Delay  specifies the delay time length, in milliseconds.
+  * @retval None
+  */
+void HAL_Delay(uint32_t Delay)
+{
+  uint64_t tickstart = HAL_GetTickUs();
+  uint64_t wait = (uint64_t)Delay * 1000U;
+
+  while ((HAL_GetTickUs() - tickstart) < wait)
+  {
+  }
+}
+
+/**
+  * @brief  Program a one-shot wake-up of the core for tickless idle.
+  * @note   The TIM2 capture compare 1 interrupt is raised after DelayUs, then disabled.
+  * @param  DelayUs  Delay to the wake-up in microsecond, from 2 to 0xFFFFFFFF.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_TIMEBASE_StartWakeUpUs(uint32_t DelayUs)
+{
+  if (DelayUs < 2U)
+  {
+    return HAL_ERROR;
+  }
+
+  __HAL_TIM_DISABLE_IT(&TimHandle, TIM_IT_CC1);
+  __HAL_TIM_SET_COMPARE(&TimHandle, TIM_CHANNEL_1, TIM2->CNT + DelayUs);
+  __HAL_TIM_CLEAR_FLAG(&TimHandle, TIM_FLAG_CC1);
+  __HAL_TIM_ENABLE_IT(&TimHandle, TIM_IT_CC1);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Cancel the wake-up programmed by HAL_TIMEBASE_StartWakeUpUs().
+  * @retval None
+  */
+void HAL_TIMEBASE_StopWakeUp(void)
+{
+  __HAL_TIM_DISABLE_IT(&TimHandle, TIM_IT_CC1);
+  __HAL_TIM_CLEAR_FLAG(&TimHandle, TIM_FLAG_CC1);
+}
+
+/**
+  * @brief  Add to the time base a time elapsed while TIM2 was stopped.
+  * @note   To be called after a STOP mode exit, with the STOP duration measured by
+  *         a clock running in STOP mode (RTC, LPTIM).
+  * @param  ElapsedUs  Time elapsed in microsecond.
+  * @retval None
+  */
+void HAL_TIMEBASE_CompensateUs(uint64_t ElapsedUs)
+{
+  uint32_t primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  TimeBaseOffset += ElapsedUs;
+
+  __set_PRIMASK(primask_bit);
+}
+
+/**
+  * @brief  This function handles TIM interrupt request.
+  * @note   The overflow count and the update flag are updated together so that
+  *         HAL_GetTickUs() never counts an overflow twice.
+  * @param  None
+  * @retval None
+  */
+void TIM2_IRQHandler(void)
+{
+  uint32_t primask_bit;
+
+  if (__HAL_TIM_GET_FLAG(&TimHandle, TIM_FLAG_UPDATE) != RESET)
+  {
+    primask_bit = __get_PRIMASK();
+    __disable_irq();
+
+    TimeBaseHigh++;
+    __HAL_TIM_CLEAR_FLAG(&TimHandle, TIM_FLAG_UPDATE);
+
+    __set_PRIMASK(primask_bit);
+  }
+
+  if ((__HAL_TIM_GET_FLAG(&TimHandle, TIM_FLAG_CC1) != RESET) &&
+      (__HAL_TIM_GET_IT_SOURCE(&TimHandle, TIM_IT_CC1) != RESET))
+  {
+    /* One-shot wake-up: the core leaves Sleep mode on this interrupt */
+    HAL_TIMEBASE_StopWakeUp();
+  }
+}
+
@@ -327,6 +327,8 @@ HAL_StatusTypeDef HAL_UART_Init(UART_HandleTypeDef *huart)
   {
     /* Allocate lock resource and initialize it */
     huart->Lock = HAL_UNLOCKED;
+    huart->pRxRing = NULL;
+    huart->pRxFrames = NULL;
 
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
     UART_InitCallbacksToDefault(huart);
@@ -392,6 +394,8 @@ HAL_StatusTypeDef HAL_HalfDuplex_Init(UART_HandleTypeDef *huart)
   {
     /* Allocate lock resource and initialize it */
     huart->Lock = HAL_UNLOCKED;
+    huart->pRxRing = NULL;
+    huart->pRxFrames = NULL;
 
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
     UART_InitCallbacksToDefault(huart);
@@ -478,6 +482,8 @@ HAL_StatusTypeDef HAL_LIN_Init(UART_HandleTypeDef *huart, uint32_t BreakDetectLe
   {
     /* Allocate lock resource and initialize it */
     huart->Lock = HAL_UNLOCKED;
+    huart->pRxRing = NULL;
+    huart->pRxFrames = NULL;
 
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
     UART_InitCallbacksToDefault(huart);
@@ -562,6 +568,8 @@ HAL_StatusTypeDef HAL_MultiProcessor_Init(UART_HandleTypeDef *huart, uint8_t Add
   {
     /* Allocate lock resource and initialize it */
     huart->Lock = HAL_UNLOCKED;
+    huart->pRxRing = NULL;
+    huart->pRxFrames = NULL;
 
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
     UART_InitCallbacksToDefault(huart);
@@ -1655,6 +1663,13 @@ HAL_StatusTypeDef HAL_UART_Abort(UART_HandleTypeDef *huart)
     ATOMIC_CLEAR_BIT(huart->Instance->CR1, (USART_CR1_IDLEIE));
   }
 
+  /* If a RS485 transaction was ongoing, disable RTOIE interrupt and restore the receiver */
+  if (huart->ReceptionType == HAL_UART_RECEPTION_TORTO)
+  {
+    ATOMIC_CLEAR_BIT(huart->Instance->CR1, USART_CR1_RTOIE);
+    ATOMIC_SET_BIT(huart->Instance->CR1, USART_CR1_RE);
+  }
+
   /* Abort the UART DMA Tx channel if enabled */
   if (HAL_IS_BIT_SET(huart->Instance->CR3, USART_CR3_DMAT))
   {
@@ -1816,6 +1831,13 @@ HAL_StatusTypeDef HAL_UART_AbortReceive(UART_HandleTypeDef *huart)
     ATOMIC_CLEAR_BIT(huart->Instance->CR1, (USART_CR1_IDLEIE));
   }
 
+  /* If a RS485 transaction was ongoing, disable RTOIE interrupt and restore the receiver */
+  if (huart->ReceptionType == HAL_UART_RECEPTION_TORTO)
+  {
+    ATOMIC_CLEAR_BIT(huart->Instance->CR1, USART_CR1_RTOIE);
+    ATOMIC_SET_BIT(huart->Instance->CR1, USART_CR1_RE);
+  }
+
   /* Abort the UART DMA Rx channel if enabled */
   if (HAL_IS_BIT_SET(huart->Instance->CR3, USART_CR3_DMAR))
   {
@@ -1887,6 +1909,13 @@ HAL_StatusTypeDef HAL_UART_Abort_IT(UART_HandleTypeDef *huart)
     ATOMIC_CLEAR_BIT(huart->Instance->CR1, (USART_CR1_IDLEIE));
   }
 
+  /* If a RS485 transaction was ongoing, disable RTOIE interrupt and restore the receiver */
+  if (huart->ReceptionType == HAL_UART_RECEPTION_TORTO)
+  {
+    ATOMIC_CLEAR_BIT(huart->Instance->CR1, USART_CR1_RTOIE);
+    ATOMIC_SET_BIT(huart->Instance->CR1, USART_CR1_RE);
+  }
+
   /* If DMA Tx and/or DMA Rx Handles are associated to UART Handle, DMA Abort complete callbacks should be initialised
      before any call to DMA Abort functions */
   /* DMA Tx Handle is valid */
@@ -2128,6 +2157,13 @@ HAL_StatusTypeDef HAL_UART_AbortReceive_IT(UART_HandleTypeDef *huart)
     ATOMIC_CLEAR_BIT(huart->Instance->CR1, (USART_CR1_IDLEIE));
   }
 
+  /* If a RS485 transaction was ongoing, disable RTOIE interrupt and restore the receiver */
+  if (huart->ReceptionType == HAL_UART_RECEPTION_TORTO)
+  {
+    ATOMIC_CLEAR_BIT(huart->Instance->CR1, USART_CR1_RTOIE);
+    ATOMIC_SET_BIT(huart->Instance->CR1, USART_CR1_RE);
+  }
+
   /* Abort the UART DMA Rx channel if enabled */
   if (HAL_IS_BIT_SET(huart->Instance->CR3, USART_CR3_DMAR))
   {
@@ -2209,7 +2245,7 @@ HAL_StatusTypeDef HAL_UART_AbortReceive_IT(UART_HandleTypeDef *huart)
   * @param huart UART handle.
   * @retval None
   */
-void HAL_UART_IRQHandler(UART_HandleTypeDef *huart)
+__HOT_RAM_FUNC void HAL_UART_IRQHandler(UART_HandleTypeDef *huart)
 {
   uint32_t isrflags   = READ_REG(huart->Instance->ISR);
   uint32_t cr1its     = READ_REG(huart->Instance->CR1);
@@ -2218,6 +2254,83 @@ void HAL_UART_IRQHandler(UART_HandleTypeDef *huart)
   uint32_t errorflags;
   uint32_t errorcode;
 
+  /* UART in ring buffer reception mode, line idle --------------------------*/
+  if (((isrflags & USART_ISR_IDLE) != 0U) && ((cr1its & USART_CR1_IDLEIE) != 0U) && (huart->pRxRing != NULL))
+  {
+    __HAL_UART_CLEAR_FLAG(huart, UART_CLEAR_IDLEF);
+    if (huart->RxState == HAL_UART_STATE_BUSY_RX)
+    {
+      HAL_UARTEx_RingReceive_Update(huart);
+      HAL_UARTEx_RingRxEventCallback(huart);
+    }
+    else
+    {
+      /* Reception was aborted through the generic abort services */
+      ATOMIC_CLEAR_BIT(huart->Instance->CR1, USART_CR1_IDLEIE);
+      huart->pRxRing = NULL;
+    }
+  }
+
+  /* UART in framed reception mode, receiver timeout ------------------------*/
+  if (((isrflags & USART_ISR_RTOF) != 0U) && ((cr1its & USART_CR1_RTOIE) != 0U) && (huart->pRxFrames != NULL))
+  {
+    /* Line errors are reported with the frame they occurred in */
+    __HAL_UART_CLEAR_FLAG(huart, UART_CLEAR_RTOF | UART_CLEAR_PEF | UART_CLEAR_FEF | UART_CLEAR_NEF | UART_CLEAR_OREF);
+    if (huart->RxState == HAL_UART_STATE_BUSY_RX)
+    {
+      huart->pRxFrames->FrameErrors |= isrflags & (USART_ISR_PE | USART_ISR_FE | USART_ISR_NE | USART_ISR_ORE);
+      HAL_UARTEx_FrameReceive_Delimit(huart);
+      HAL_UARTEx_FrameRxEventCallback(huart);
+    }
+    else
+    {
+      /* Reception was aborted through the generic abort services */
+      ATOMIC_CLEAR_BIT(huart->Instance->CR1, USART_CR1_RTOIE);
+      huart->pRxFrames = NULL;
+    }
+    isrflags &= ~(USART_ISR_RTOF | USART_ISR_PE | USART_ISR_FE | USART_ISR_NE | USART_ISR_ORE);
+  }
+
+  /* UART in RS485 transaction mode, end of response ------------------------*/
+  if (((isrflags & USART_ISR_RTOF) != 0U) && ((cr1its & USART_CR1_RTOIE) != 0U)
+      && (huart->ReceptionType == HAL_UART_RECEPTION_TORTO))
+  {
+    __HAL_UART_CLEAR_FLAG(huart, UART_CLEAR_RTOF);
+
+    if ((huart->RxState == HAL_UART_STATE_BUSY_RX) && (huart->hdmarx != NULL))
+    {
+      huart->RxXferCount = (uint16_t) __HAL_DMA_GET_COUNTER(huart->hdmarx);
+
+      /* Disable RTO, PE and ERR (Frame error, noise error, overrun error) interrupts */
+      ATOMIC_CLEAR_BIT(huart->Instance->CR1, (USART_CR1_RTOIE | USART_CR1_PEIE));
+      ATOMIC_CLEAR_BIT(huart->Instance->CR3, USART_CR3_EIE);
+
+      /* Disable the DMA transfer for the receiver request by resetting the DMAR bit
+         in the UART CR3 register */
+      ATOMIC_CLEAR_BIT(huart->Instance->CR3, USART_CR3_DMAR);
+
+      /* At end of Rx process, restore huart->RxState to Ready */
+      huart->RxState = HAL_UART_STATE_READY;
+      huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+
+      /* Line has been silent for the timeout, so no need as the abort is immediate */
+      (void)HAL_DMA_Abort(huart->hdmarx);
+
+      /* Initialize type of RxEvent that correspond to RxEvent callback execution;
+         In this case, Rx Event type is Receiver Timeout Event */
+      huart->RxEventType = HAL_UART_RXEVENT_RTO;
+
+#if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
+      /*Call registered Rx Event callback*/
+      huart->RxEventCallback(huart, (huart->RxXferSize - huart->RxXferCount));
+#else
+      /*Call legacy weak Rx Event callback*/
+      HAL_UARTEx_RxEventCallback(huart, (huart->RxXferSize - huart->RxXferCount));
+#endif /* (USE_HAL_UART_REGISTER_CALLBACKS) */
+    }
+    return;
+  }
+
   /* If no error occurs */
   errorflags = (isrflags & (uint32_t)(USART_ISR_PE | USART_ISR_FE | USART_ISR_ORE | USART_ISR_NE | USART_ISR_RTOF));
   if (errorflags == 0U)
@@ -2503,6 +2616,12 @@ void HAL_UART_IRQHandler(UART_HandleTypeDef *huart)
   /* UART in mode Transmitter (transmission end) -----------------------------*/
   if (((isrflags & USART_ISR_TC) != 0U) && ((cr1its & USART_CR1_TCIE) != 0U))
   {
+    /* RS485 transaction: the request is on the line, turn the receiver on to get the response */
+    if ((huart->ReceptionType == HAL_UART_RECEPTION_TORTO) && (huart->RxState == HAL_UART_STATE_BUSY_RX))
+    {
+      __HAL_UART_CLEAR_FLAG(huart, UART_CLEAR_RTOF | UART_CLEAR_OREF);
+      ATOMIC_SET_BIT(huart->Instance->CR1, (USART_CR1_RE | USART_CR1_RTOIE));
+    }
     UART_EndTransmit_IT(huart);
     return;
   }
@@ -3417,6 +3536,9 @@ HAL_StatusTypeDef UART_WaitOnFlagUntilTimeout(UART_HandleTypeDef *huart, uint32_
   /* Wait until flag is set */
   while ((__HAL_UART_GET_FLAG(huart, Flag) ? SET : RESET) == Status)
   {
+    /* Let the application yield or sleep while waiting */
+    HAL_WaitHook(HAL_WAIT_UART, huart);
+
     /* Check for the Timeout */
     if (Timeout != HAL_MAX_DELAY)
     {
@@ -3636,6 +3758,13 @@ static void UART_EndRxTransfer(UART_HandleTypeDef *huart)
     ATOMIC_CLEAR_BIT(huart->Instance->CR1, USART_CR1_IDLEIE);
   }
 
+  /* In case of RS485 transaction, disable also the RTO IE interrupt source and restore the receiver */
+  if (huart->ReceptionType == HAL_UART_RECEPTION_TORTO)
+  {
+    ATOMIC_CLEAR_BIT(huart->Instance->CR1, USART_CR1_RTOIE);
+    ATOMIC_SET_BIT(huart->Instance->CR1, USART_CR1_RE);
+  }
+
   /* At end of Rx process, restore huart->RxState to Ready */
   huart->RxState = HAL_UART_STATE_READY;
   huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
@@ -3727,6 +3856,12 @@ static void UART_DMAReceiveCplt(DMA_HandleTypeDef *hdma)
     {
       ATOMIC_CLEAR_BIT(huart->Instance->CR1, USART_CR1_IDLEIE);
     }
+
+    /* If RS485 transaction has been selected, Disable RTO Interrupt */
+    if (huart->ReceptionType == HAL_UART_RECEPTION_TORTO)
+    {
+      ATOMIC_CLEAR_BIT(huart->Instance->CR1, USART_CR1_RTOIE);
+    }
   }
 
   /* Initialize type of RxEvent that correspond to RxEvent callback execution;
@@ -3734,8 +3869,8 @@ static void UART_DMAReceiveCplt(DMA_HandleTypeDef *hdma)
   huart->RxEventType = HAL_UART_RXEVENT_TC;
 
   /* Check current reception Mode :
-     If Reception till IDLE event has been selected : use Rx Event callback */
-  if (huart->ReceptionType == HAL_UART_RECEPTION_TOIDLE)
+     If Reception till IDLE event or RS485 transaction has been selected : use Rx Event callback */
+  if ((huart->ReceptionType == HAL_UART_RECEPTION_TOIDLE) || (huart->ReceptionType == HAL_UART_RECEPTION_TORTO))
   {
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
     /*Call registered Rx Event callback*/
@@ -4037,7 +4172,7 @@ static void UART_DMARxOnlyAbortCallback(DMA_HandleTypeDef *hdma)
   * @param huart UART handle.
   * @retval None
   */
-static void UART_TxISR_8BIT(UART_HandleTypeDef *huart)
+static __HOT_RAM_FUNC void UART_TxISR_8BIT(UART_HandleTypeDef *huart)
 {
   /* Check that a Tx process is ongoing */
   if (huart->gState == HAL_UART_STATE_BUSY_TX)
@@ -4066,7 +4201,7 @@ static void UART_TxISR_8BIT(UART_HandleTypeDef *huart)
   * @param huart UART handle.
   * @retval None
   */
-static void UART_TxISR_16BIT(UART_HandleTypeDef *huart)
+static __HOT_RAM_FUNC void UART_TxISR_16BIT(UART_HandleTypeDef *huart)
 {
   const uint16_t *tmp;
 
@@ -4098,7 +4233,7 @@ static void UART_TxISR_16BIT(UART_HandleTypeDef *huart)
   * @param huart UART handle.
   * @retval None
   */
-static void UART_TxISR_8BIT_FIFOEN(UART_HandleTypeDef *huart)
+static __HOT_RAM_FUNC void UART_TxISR_8BIT_FIFOEN(UART_HandleTypeDef *huart)
 {
   uint16_t  nb_tx_data;
 
@@ -4138,7 +4273,7 @@ static void UART_TxISR_8BIT_FIFOEN(UART_HandleTypeDef *huart)
   * @param huart UART handle.
   * @retval None
   */
-static void UART_TxISR_16BIT_FIFOEN(UART_HandleTypeDef *huart)
+static __HOT_RAM_FUNC void UART_TxISR_16BIT_FIFOEN(UART_HandleTypeDef *huart)
 {
   const uint16_t *tmp;
   uint16_t  nb_tx_data;
@@ -4179,7 +4314,7 @@ static void UART_TxISR_16BIT_FIFOEN(UART_HandleTypeDef *huart)
   *                the configuration information for the specified UART module.
   * @retval None
   */
-static void UART_EndTransmit_IT(UART_HandleTypeDef *huart)
+static __HOT_RAM_FUNC void UART_EndTransmit_IT(UART_HandleTypeDef *huart)
 {
   /* Disable the UART Transmit Complete Interrupt */
   ATOMIC_CLEAR_BIT(huart->Instance->CR1, USART_CR1_TCIE);
@@ -4204,7 +4339,7 @@ static void UART_EndTransmit_IT(UART_HandleTypeDef *huart)
   * @param huart UART handle.
   * @retval None
   */
-static void UART_RxISR_8BIT(UART_HandleTypeDef *huart)
+static __HOT_RAM_FUNC void UART_RxISR_8BIT(UART_HandleTypeDef *huart)
 {
   uint16_t uhMask = huart->Mask;
   uint16_t  uhdata;
@@ -4295,7 +4430,7 @@ static void UART_RxISR_8BIT(UART_HandleTypeDef *huart)
   * @param huart UART handle.
   * @retval None
   */
-static void UART_RxISR_16BIT(UART_HandleTypeDef *huart)
+static __HOT_RAM_FUNC void UART_RxISR_16BIT(UART_HandleTypeDef *huart)
 {
   uint16_t *tmp;
   uint16_t uhMask = huart->Mask;
@@ -4388,7 +4523,7 @@ static void UART_RxISR_16BIT(UART_HandleTypeDef *huart)
   * @param huart UART handle.
   * @retval None
   */
-static void UART_RxISR_8BIT_FIFOEN(UART_HandleTypeDef *huart)
+static __HOT_RAM_FUNC void UART_RxISR_8BIT_FIFOEN(UART_HandleTypeDef *huart)
 {
   uint16_t  uhMask = huart->Mask;
   uint16_t  uhdata;
@@ -4550,7 +4685,7 @@ static void UART_RxISR_8BIT_FIFOEN(UART_HandleTypeDef *huart)
   * @param huart UART handle.
   * @retval None
   */
-static void UART_RxISR_16BIT_FIFOEN(UART_HandleTypeDef *huart)
+static __HOT_RAM_FUNC void UART_RxISR_16BIT_FIFOEN(UART_HandleTypeDef *huart)
 {
   uint16_t *tmp;
   uint16_t  uhMask = huart->Mask;
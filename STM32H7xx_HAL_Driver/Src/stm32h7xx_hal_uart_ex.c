@@ -75,6 +75,9 @@
   * @{
   */
 static void UARTEx_Wakeup_AddressConfig(UART_HandleTypeDef *huart, UART_WakeUpTypeDef WakeUpSelection);
+static void UARTEx_DMARingRxEvent(DMA_HandleTypeDef *hdma);
+static void UARTEx_DMARingRxError(DMA_HandleTypeDef *hdma);
+static void UARTEx_EndRingRxTransfer(UART_HandleTypeDef *huart);
 static void UARTEx_SetNbDataToProcess(UART_HandleTypeDef *huart);
 /**
   * @}
@@ -260,6 +263,12 @@ HAL_StatusTypeDef HAL_RS485Ex_Init(UART_HandleTypeDef *huart, uint32_t Polarity,
         (+) HAL_UARTEx_RxFifoFullCallback()
         (+) HAL_UARTEx_TxFifoEmptyCallback()
 
+    (#) Ring buffer reception Callback:
+        (+) HAL_UARTEx_RingRxEventCallback()
+
+    (#) Framed reception Callback:
+        (+) HAL_UARTEx_FrameRxEventCallback()
+
 @endverbatim
   * @{
   */
@@ -309,6 +318,40 @@ __weak void HAL_UARTEx_TxFifoEmptyCallback(UART_HandleTypeDef *huart)
    */
 }
 
+/**
+  * @brief  UART ring buffer reception event callback.
+  * @note   Called each time new data has been published in the ring, i.e. on line
+  *         idle, half transfer and transfer complete events.
+  * @param  huart UART handle.
+  * @retval None
+  */
+__weak void HAL_UARTEx_RingRxEventCallback(UART_HandleTypeDef *huart)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(huart);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_UARTEx_RingRxEventCallback can be implemented in the user file.
+   */
+}
+
+/**
+  * @brief  UART framed reception event callback.
+  * @note   Called from the UART interrupt each time a receiver timeout closes a
+  *         frame, whether or not the frame could be queued.
+  * @param  huart UART handle.
+  * @retval None
+  */
+__weak void HAL_UARTEx_FrameRxEventCallback(UART_HandleTypeDef *huart)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(huart);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_UARTEx_FrameRxEventCallback can be implemented in the user file.
+   */
+}
+
 /**
   * @}
   */
@@ -331,6 +374,12 @@ __weak void HAL_UARTEx_TxFifoEmptyCallback(UART_HandleTypeDef *huart)
      (+) HAL_UARTEx_DisableFifoMode() API disables the FIFO mode
      (+) HAL_UARTEx_SetTxFifoThreshold() API sets the TX FIFO threshold
      (+) HAL_UARTEx_SetRxFifoThreshold() API sets the RX FIFO threshold
+     (+) HAL_UARTEx_EnableAutoBaudRate() API starts a hardware baud rate detection,
+         HAL_UARTEx_GetAutoBaudRateStatus() API reports its completion
+     (+) HAL_UARTEx_FrameReceive_DMA() API receives frames delimited by the hardware
+         receiver timeout, e.g. the 3.5 character silent interval of Modbus RTU
+     (+) HAL_RS485Ex_Transaction_DMA() API sends a RS485 request and receives its
+         response in a single call, the line turnaround being done on transmission complete
 
     [..] This subsection also provides a set of additional functions providing enhanced reception
     services to user. (For example, these functions allow application to handle use cases
@@ -846,6 +895,8 @@ HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_IT(UART_HandleTypeDef *huart, uint8_t
     /* Set Reception type to reception till IDLE Event*/
     huart->ReceptionType = HAL_UART_RECEPTION_TOIDLE;
     huart->RxEventType = HAL_UART_RXEVENT_TC;
+    huart->pRxRing = NULL;
+    huart->pRxFrames = NULL;
 
     status =  UART_Start_Receive_IT(huart, pData, Size);
 
@@ -907,6 +958,8 @@ HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_DMA(UART_HandleTypeDef *huart, uint8_
     /* Set Reception type to reception till IDLE Event*/
     huart->ReceptionType = HAL_UART_RECEPTION_TOIDLE;
     huart->RxEventType = HAL_UART_RXEVENT_TC;
+    huart->pRxRing = NULL;
+    huart->pRxFrames = NULL;
 
     status =  UART_Start_Receive_DMA(huart, pData, Size);
 
@@ -954,6 +1007,8 @@ HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_DMA(UART_HandleTypeDef *huart, uint8_
   *           - HAL_UART_RXEVENT_HT : when half of expected nb of data has been received
   *           - HAL_UART_RXEVENT_IDLE : when Idle event occurred prior reception has been completed (nb of
   *             received data is lower than expected one).
+  *           - HAL_UART_RXEVENT_RTO : when the receiver timeout ended a RS485 transaction response (nb of
+  *             received data is lower than expected one).
   *        In DMA mode, RxEvent callback could be called several times;
   *        When DMA is configured in Normal Mode, HT event does not stop Reception process;
   *        When DMA is configured in Circular Mode, HT, TC or IDLE events don't stop Reception process;
@@ -966,6 +1021,685 @@ HAL_UART_RxEventTypeTypeDef HAL_UARTEx_GetRxEventType(UART_HandleTypeDef *huart)
   return (huart->RxEventType);
 }
 
+/**
+  * @brief  Start a ring buffer reception in DMA mode.
+  * @note   The Rx DMA handle must be configured in circular mode. The DMA then
+  *         fills pData continuously and the write index is resynchronised from
+  *         the DMA remaining data counter on line idle, half transfer and
+  *         transfer complete events, so a burst is made available to the reader
+  *         as soon as the line goes idle, without any per-byte interrupt.
+  * @note   The reader drains the ring with HAL_UARTEx_Ring_GetData() and
+  *         HAL_UARTEx_Ring_Release(), which hand out pointers into pData
+  *         (no copy is made).
+  * @note   Line errors (noise, framing, parity) are not reported in this mode,
+  *         the reception goes on. A reader that falls behind by more than Size
+  *         bytes loses the oldest data and Overrun is incremented.
+  * @note   When the data cache is enabled, pData must be aligned on a 32-byte boundary
+  *         and Size must be at least 32: the cache lines handed out to the reader by
+  *         HAL_UARTEx_Ring_GetData() are invalidated there.
+  * @param  huart Pointer to a UART_HandleTypeDef structure that contains
+  *               the configuration information for the specified UART module.
+  * @param  pRing Pointer to the ring descriptor, owned by the application.
+  * @param  pData Pointer to the ring storage.
+  * @param  Size  Size of the ring storage, must be a power of two.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UARTEx_RingReceive_DMA(UART_HandleTypeDef *huart, UART_RingTypeDef *pRing, uint8_t *pData, uint16_t Size)
+{
+  uint32_t *tmp;
+
+  /* Check that a Rx process is not already ongoing */
+  if (huart->RxState == HAL_UART_STATE_READY)
+  {
+    if ((pRing == NULL) || (pData == NULL) || (Size == 0U) || ((Size & (Size - 1U)) != 0U))
+    {
+      return HAL_ERROR;
+    }
+
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    /* Cache maintenance is done on whole lines of the ring storage */
+    if ((((uint32_t)pData & 31U) != 0U) || (Size < 32U))
+    {
+      return HAL_ERROR;
+    }
+#endif /* __DCACHE_PRESENT */
+
+    /* The ring relies on the DMA wrapping around by itself */
+    if ((huart->hdmarx == NULL) || (huart->hdmarx->Init.Mode != DMA_CIRCULAR))
+    {
+      return HAL_ERROR;
+    }
+
+    /* Process Locked */
+    __HAL_LOCK(huart);
+
+    pRing->pBuffer = pData;
+    pRing->Mask    = (uint32_t)Size - 1U;
+    pRing->Head    = 0U;
+    pRing->Tail    = 0U;
+    pRing->Overrun = 0U;
+
+    huart->pRxBuffPtr = pData;
+    huart->RxXferSize = Size;
+    huart->pRxRing    = pRing;
+
+    huart->ErrorCode = HAL_UART_ERROR_NONE;
+    huart->RxState = HAL_UART_STATE_BUSY_RX;
+    huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+
+    /* Half transfer and transfer complete both only resynchronise the write index */
+    huart->hdmarx->XferCpltCallback = UARTEx_DMARingRxEvent;
+    huart->hdmarx->XferHalfCpltCallback = UARTEx_DMARingRxEvent;
+
+    /* Set the DMA error callback */
+    huart->hdmarx->XferErrorCallback = UARTEx_DMARingRxError;
+
+    /* Set the DMA abort callback */
+    huart->hdmarx->XferAbortCallback = NULL;
+
+    /* Enable the DMA channel */
+    tmp = (uint32_t *)&pData;
+    if (HAL_DMA_Start_IT(huart->hdmarx, (uint32_t)&huart->Instance->RDR, *(uint32_t *)tmp, Size) != HAL_OK)
+    {
+      huart->pRxRing = NULL;
+      huart->ErrorCode = HAL_UART_ERROR_DMA;
+      huart->RxState = HAL_UART_STATE_READY;
+
+      /* Process Unlocked */
+      __HAL_UNLOCK(huart);
+
+      return HAL_ERROR;
+    }
+
+    /* Clear the Overrun and Idle flags just before enabling the DMA Rx request */
+    __HAL_UART_CLEAR_FLAG(huart, UART_CLEAR_OREF | UART_CLEAR_IDLEF);
+
+    /* Process Unlocked */
+    __HAL_UNLOCK(huart);
+
+    /* Enable the line idle interrupt used to flush bursts to the reader */
+    ATOMIC_SET_BIT(huart->Instance->CR1, USART_CR1_IDLEIE);
+
+    /* Enable the DMA transfer for the receiver request by setting the DMAR bit
+    in the UART CR3 register */
+    ATOMIC_SET_BIT(huart->Instance->CR3, USART_CR3_DMAR);
+
+    return HAL_OK;
+  }
+  else
+  {
+    return HAL_BUSY;
+  }
+}
+
+/**
+  * @brief  Stop an ongoing ring buffer reception.
+  * @note   The write index is resynchronised one last time, so the data received
+  *         before the call stays available to the reader.
+  * @param  huart Pointer to a UART_HandleTypeDef structure that contains
+  *               the configuration information for the specified UART module.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UARTEx_RingReceive_Stop(UART_HandleTypeDef *huart)
+{
+  if (huart->pRxRing == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Stop new Rx DMA requests and line idle notifications */
+  ATOMIC_CLEAR_BIT(huart->Instance->CR1, USART_CR1_IDLEIE);
+  ATOMIC_CLEAR_BIT(huart->Instance->CR3, USART_CR3_DMAR);
+
+  /* Publish the data written so far before the DMA is disabled */
+  HAL_UARTEx_RingReceive_Update(huart);
+
+  /* Abort the UART DMA Rx stream : use blocking DMA Abort API (no callback) */
+  huart->hdmarx->XferAbortCallback = NULL;
+  if (HAL_DMA_Abort(huart->hdmarx) != HAL_OK)
+  {
+    if (HAL_DMA_GetError(huart->hdmarx) == HAL_DMA_ERROR_TIMEOUT)
+    {
+      /* Set error code to DMA */
+      huart->ErrorCode = HAL_UART_ERROR_DMA;
+
+      return HAL_TIMEOUT;
+    }
+  }
+
+  UARTEx_EndRingRxTransfer(huart);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Resynchronise the ring write index with the DMA remaining data counter.
+  * @note   Called by the driver on line idle, half transfer and transfer complete
+  *         events. It can also be called by the reader to pick up bytes received
+  *         since the last event without waiting for the line to go idle.
+  * @param  huart Pointer to a UART_HandleTypeDef structure that contains
+  *               the configuration information for the specified UART module.
+  * @retval None
+  */
+void HAL_UARTEx_RingReceive_Update(UART_HandleTypeDef *huart)
+{
+  UART_RingTypeDef *pRing = huart->pRxRing;
+  uint32_t primask_bit;
+  uint32_t position;
+  uint32_t head;
+
+  if (pRing != NULL)
+  {
+    /* The update can be entered concurrently from the UART IRQ, the DMA IRQ and
+       the reader: keep the read-modify-write of Head atomic */
+    primask_bit = __get_PRIMASK();
+    __disable_irq();
+
+    position = ((uint32_t)huart->RxXferSize - __HAL_DMA_GET_COUNTER(huart->hdmarx)) & pRing->Mask;
+    head = pRing->Head;
+    head += (position - head) & pRing->Mask;
+    if ((head - pRing->Tail) > (pRing->Mask + 1U))
+    {
+      pRing->Overrun++;
+    }
+    pRing->Head = head;
+
+    __set_PRIMASK(primask_bit);
+  }
+}
+
+/**
+  * @brief  Return the number of bytes waiting in the ring.
+  * @param  pRing Pointer to the ring descriptor.
+  * @retval Number of bytes available to the reader
+  */
+uint32_t HAL_UARTEx_Ring_GetCount(UART_RingTypeDef *pRing)
+{
+  uint32_t count = pRing->Head - pRing->Tail;
+
+  /* Bytes overwritten by the DMA are not readable anymore */
+  if (count > (pRing->Mask + 1U))
+  {
+    count = pRing->Mask + 1U;
+  }
+
+  return count;
+}
+
+/**
+  * @brief  Get direct access to the oldest bytes waiting in the ring.
+  * @note   Only the contiguous part up to the end of the storage is returned: when
+  *         the waiting data wraps around, a second call after
+  *         HAL_UARTEx_Ring_Release() returns the remainder.
+  * @note   When the data cache is enabled the returned span is invalidated before
+  *         being handed out, as it has been written by the DMA behind the cache.
+  * @param  pRing  Pointer to the ring descriptor.
+  * @param  ppData Filled with a pointer to the oldest waiting byte.
+  * @retval Number of contiguous bytes readable at *ppData
+  */
+uint32_t HAL_UARTEx_Ring_GetData(UART_RingTypeDef *pRing, uint8_t **ppData)
+{
+  uint32_t head = pRing->Head;
+  uint32_t tail = pRing->Tail;
+  uint32_t size = pRing->Mask + 1U;
+  uint32_t count;
+
+  /* The writer overtook the reader: skip the overwritten bytes */
+  if ((head - tail) > size)
+  {
+    tail = head - size;
+    pRing->Tail = tail;
+  }
+
+  count = head - tail;
+  if (count > (size - (tail & pRing->Mask)))
+  {
+    count = size - (tail & pRing->Mask);
+  }
+
+  *ppData = &pRing->pBuffer[tail & pRing->Mask];
+
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  if ((count != 0U) && ((SCB->CCR & SCB_CCR_DC_Msk) != 0U))
+  {
+    /* The DMA wrote behind the cache: drop the stale lines covering the span */
+    SCB_InvalidateDCache_by_Addr((uint32_t *)((uint32_t)*ppData & ~31U),
+                                 (int32_t)(count + ((uint32_t)*ppData & 31U)));
+  }
+#endif /* __DCACHE_PRESENT */
+
+  return count;
+}
+
+/**
+  * @brief  Hand bytes obtained with HAL_UARTEx_Ring_GetData() back to the driver.
+  * @param  pRing Pointer to the ring descriptor.
+  * @param  Count Number of bytes consumed by the reader.
+  * @retval None
+  */
+void HAL_UARTEx_Ring_Release(UART_RingTypeDef *pRing, uint32_t Count)
+{
+  pRing->Tail += Count;
+}
+
+/**
+  * @brief  Start a framed reception in DMA mode.
+  * @note   The bytes are received by a ring buffer reception (see
+  *         HAL_UARTEx_RingReceive_DMA()), and the end of each frame is detected by the
+  *         receiver timeout: a line silent for TimeoutBits bit times after the last
+  *         received byte closes the frame and queues its descriptor. No CPU timer
+  *         nor per-byte interrupt is involved, and the timeout follows the baud rate,
+  *         auto-detected or not.
+  * @note   For Modbus RTU the inter-frame gap is 3.5 characters, i.e. 39 bit times
+  *         with 11-bit characters. Above 19200 bauds the standard requires a fixed
+  *         1.75 ms gap instead.
+  * @note   Line errors do not stop the reception, they are reported with the frame.
+  * @param  huart Pointer to a UART_HandleTypeDef structure that contains
+  *               the configuration information for the specified UART module.
+  * @param  pQueue Pointer to the frame queue, owned by the application.
+  * @param  pData Pointer to the ring storage.
+  * @param  Size  Size of the ring storage, must be a power of two.
+  * @param  pFrames Pointer to the frame descriptors.
+  * @param  NbFrames Number of frame descriptors, must be a power of two.
+  * @param  TimeoutBits Inter-frame gap in bit times, from 1 to 0xFFFFFF.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UARTEx_FrameReceive_DMA(UART_HandleTypeDef *huart, UART_FrameQueueTypeDef *pQueue, uint8_t *pData,
+                                              uint16_t Size, UART_FrameTypeDef *pFrames, uint32_t NbFrames,
+                                              uint32_t TimeoutBits)
+{
+  HAL_StatusTypeDef status;
+
+  /* The receiver timeout is not available on LPUART instances */
+  if (IS_LPUART_INSTANCE(huart->Instance))
+  {
+    return HAL_ERROR;
+  }
+
+  if ((pQueue == NULL) || (pFrames == NULL) || (NbFrames == 0U) || ((NbFrames & (NbFrames - 1U)) != 0U) ||
+      (TimeoutBits == 0U) || (TimeoutBits > USART_RTOR_RTO))
+  {
+    return HAL_ERROR;
+  }
+
+  if (huart->RxState != HAL_UART_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  pQueue->pFrames     = pFrames;
+  pQueue->Mask        = NbFrames - 1U;
+  pQueue->Head        = 0U;
+  pQueue->Tail        = 0U;
+  pQueue->Overrun     = 0U;
+  pQueue->FrameStart  = 0U;
+  pQueue->FrameErrors = 0U;
+
+  /* Program the inter-frame gap */
+  MODIFY_REG(huart->Instance->RTOR, USART_RTOR_RTO, TimeoutBits);
+  ATOMIC_SET_BIT(huart->Instance->CR2, USART_CR2_RTOEN);
+
+  status = HAL_UARTEx_RingReceive_DMA(huart, &pQueue->Ring, pData, Size);
+  if (status != HAL_OK)
+  {
+    return status;
+  }
+
+  /* Frames are delimited by the receiver timeout instead of the line idle event */
+  ATOMIC_CLEAR_BIT(huart->Instance->CR1, USART_CR1_IDLEIE);
+
+  huart->pRxFrames = pQueue;
+
+  __HAL_UART_CLEAR_FLAG(huart, UART_CLEAR_RTOF);
+  ATOMIC_SET_BIT(huart->Instance->CR1, USART_CR1_RTOIE);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop an ongoing framed reception.
+  * @note   The bytes received after the last receiver timeout are discarded, the
+  *         queued frames stay available to the reader.
+  * @param  huart Pointer to a UART_HandleTypeDef structure that contains
+  *               the configuration information for the specified UART module.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UARTEx_FrameReceive_Stop(UART_HandleTypeDef *huart)
+{
+  if (huart->pRxFrames == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  ATOMIC_CLEAR_BIT(huart->Instance->CR1, USART_CR1_RTOIE);
+  ATOMIC_CLEAR_BIT(huart->Instance->CR2, USART_CR2_RTOEN);
+  huart->pRxFrames = NULL;
+
+  return HAL_UARTEx_RingReceive_Stop(huart);
+}
+
+/**
+  * @brief  Close the frame being received at the current DMA position.
+  * @note   Called by the driver on receiver timeout. Nothing is queued when no
+  *         byte has been received since the previous frame.
+  * @param  huart Pointer to a UART_HandleTypeDef structure that contains
+  *               the configuration information for the specified UART module.
+  * @retval None
+  */
+void HAL_UARTEx_FrameReceive_Delimit(UART_HandleTypeDef *huart)
+{
+  UART_FrameQueueTypeDef *pQueue = huart->pRxFrames;
+  UART_FrameTypeDef *pFrame;
+  uint32_t primask_bit;
+  uint32_t end;
+  uint32_t errors;
+
+  if (pQueue != NULL)
+  {
+    HAL_UARTEx_RingReceive_Update(huart);
+
+    primask_bit = __get_PRIMASK();
+    __disable_irq();
+
+    end = pQueue->Ring.Head;
+    if (end != pQueue->FrameStart)
+    {
+      if ((pQueue->Head - pQueue->Tail) > pQueue->Mask)
+      {
+        pQueue->Overrun++;
+      }
+      else
+      {
+        errors = 0U;
+        if ((pQueue->FrameErrors & USART_ISR_PE) != 0U)
+        {
+          errors |= HAL_UART_ERROR_PE;
+        }
+        if ((pQueue->FrameErrors & USART_ISR_NE) != 0U)
+        {
+          errors |= HAL_UART_ERROR_NE;
+        }
+        if ((pQueue->FrameErrors & USART_ISR_FE) != 0U)
+        {
+          errors |= HAL_UART_ERROR_FE;
+        }
+        if ((pQueue->FrameErrors & USART_ISR_ORE) != 0U)
+        {
+          errors |= HAL_UART_ERROR_ORE;
+        }
+
+        pFrame = &pQueue->pFrames[pQueue->Head & pQueue->Mask];
+        pFrame->Start  = pQueue->FrameStart;
+        pFrame->Length = end - pQueue->FrameStart;
+        pFrame->Errors = errors;
+        pQueue->Head++;
+      }
+    }
+    pQueue->FrameStart  = end;
+    pQueue->FrameErrors = 0U;
+
+    __set_PRIMASK(primask_bit);
+  }
+}
+
+/**
+  * @brief  Return the number of frames waiting in the queue.
+  * @param  pQueue Pointer to the frame queue.
+  * @retval Number of frames available to the reader
+  */
+uint32_t HAL_UARTEx_Frame_GetCount(UART_FrameQueueTypeDef *pQueue)
+{
+  return (pQueue->Head - pQueue->Tail);
+}
+
+/**
+  * @brief  Copy the oldest queued frame and remove it from the queue.
+  * @param  pQueue Pointer to the frame queue.
+  * @param  pData Destination of the frame bytes.
+  * @param  Size Size of the destination, longer frames are truncated.
+  * @param  pLength Filled with the length of the frame, before truncation.
+  * @param  pErrors Filled with the line errors of the frame (may be NULL).
+  * @retval HAL status, HAL_ERROR when no frame is queued or when the frame bytes
+  *         have been overwritten in the ring
+  */
+HAL_StatusTypeDef HAL_UARTEx_Frame_Read(UART_FrameQueueTypeDef *pQueue, uint8_t *pData, uint32_t Size,
+                                        uint32_t *pLength, uint32_t *pErrors)
+{
+  UART_FrameTypeDef frame;
+  uint8_t *psrc;
+  uint32_t copied = 0U;
+  uint32_t count;
+  uint32_t i;
+
+  if (pQueue->Head == pQueue->Tail)
+  {
+    return HAL_ERROR;
+  }
+
+  frame = pQueue->pFrames[pQueue->Tail & pQueue->Mask];
+  pQueue->Tail++;
+
+  *pLength = frame.Length;
+  if (pErrors != NULL)
+  {
+    *pErrors = frame.Errors;
+  }
+
+  /* Frame bytes already overwritten by the DMA */
+  if ((pQueue->Ring.Head - frame.Start) > (pQueue->Ring.Mask + 1U))
+  {
+    pQueue->Ring.Tail = frame.Start + frame.Length;
+    return HAL_ERROR;
+  }
+
+  pQueue->Ring.Tail = frame.Start;
+  if (Size > frame.Length)
+  {
+    Size = frame.Length;
+  }
+
+  /* At most two spans when the frame wraps around the ring storage */
+  while (copied < Size)
+  {
+    count = HAL_UARTEx_Ring_GetData(&pQueue->Ring, &psrc);
+    if (count > (Size - copied))
+    {
+      count = Size - copied;
+    }
+    for (i = 0U; i < count; i++)
+    {
+      pData[copied + i] = psrc[i];
+    }
+    HAL_UARTEx_Ring_Release(&pQueue->Ring, count);
+    copied += count;
+  }
+
+  pQueue->Ring.Tail = frame.Start + frame.Length;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Send a request and receive its response on a RS485 half-duplex bus in DMA mode.
+  * @note   The driver enable output must have been configured by HAL_RS485Ex_Init(), so
+  *         that DE is asserted and deasserted by the hardware around the request.
+  *         The receiver is kept disabled while the request is sent, then turned on by
+  *         the transmission complete interrupt. The response ends when the line has
+  *         been silent for TimeoutBits bit times, or when RxSize bytes have been
+  *         received. HAL_UARTEx_RxEventCallback() is then called with the number of
+  *         received bytes, HAL_UARTEx_GetRxEventType() returning HAL_UART_RXEVENT_RTO
+  *         or HAL_UART_RXEVENT_TC. HAL_UART_TxCpltCallback() is called at turnaround.
+  * @note   The receiver timeout only runs once a byte has been received: a missing
+  *         response must be handled by the application, calling HAL_UART_AbortReceive().
+  * @note   The response end is only signalled after TimeoutBits bit times of silence,
+  *         so a next transaction started from the Rx event callback always honours the
+  *         minimum inter-frame gap (39 bit times for Modbus RTU with 11-bit characters).
+  * @note   Not available on LPUART instances, which have no receiver timeout.
+  * @param  huart Pointer to a UART_HandleTypeDef structure that contains
+  *               the configuration information for the specified UART module.
+  * @param  pTxData Pointer to the request.
+  * @param  TxSize Size of the request.
+  * @param  pRxData Pointer to the response buffer.
+  * @param  RxSize Size of the response buffer.
+  * @param  TimeoutBits End of response silent interval in bit times, from 1 to 0xFFFFFF.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_RS485Ex_Transaction_DMA(UART_HandleTypeDef *huart, const uint8_t *pTxData, uint16_t TxSize,
+                                              uint8_t *pRxData, uint16_t RxSize, uint32_t TimeoutBits)
+{
+  HAL_StatusTypeDef status;
+
+  if (IS_LPUART_INSTANCE(huart->Instance))
+  {
+    return HAL_ERROR;
+  }
+
+  if ((pTxData == NULL) || (TxSize == 0U) || (pRxData == NULL) || (RxSize == 0U) ||
+      (TimeoutBits == 0U) || (TimeoutBits > USART_RTOR_RTO))
+  {
+    return HAL_ERROR;
+  }
+
+  /* The turnaround relies on the hardware driver enable and on both DMA channels */
+  if ((READ_BIT(huart->Instance->CR3, USART_CR3_DEM) == 0U) || (huart->hdmatx == NULL) || (huart->hdmarx == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  if ((huart->gState != HAL_UART_STATE_READY) || (huart->RxState != HAL_UART_STATE_READY))
+  {
+    return HAL_BUSY;
+  }
+
+  /* Program the end of response silent interval */
+  MODIFY_REG(huart->Instance->RTOR, USART_RTOR_RTO, TimeoutBits);
+  ATOMIC_SET_BIT(huart->Instance->CR2, USART_CR2_RTOEN);
+
+  /* No reception while the request is sent, as the echo of the request would be received
+     with a transceiver whose receiver stays enabled */
+  ATOMIC_CLEAR_BIT(huart->Instance->CR1, (USART_CR1_RE | USART_CR1_RTOIE));
+
+  huart->ReceptionType = HAL_UART_RECEPTION_TORTO;
+  huart->RxEventType = HAL_UART_RXEVENT_TC;
+  huart->pRxRing = NULL;
+  huart->pRxFrames = NULL;
+
+  status = UART_Start_Receive_DMA(huart, pRxData, RxSize);
+  if (status == HAL_OK)
+  {
+    /* Only the end of the response is notified */
+    huart->hdmarx->XferHalfCpltCallback = NULL;
+
+    status = HAL_UART_Transmit_DMA(huart, pTxData, TxSize);
+    if (status != HAL_OK)
+    {
+      /* Restores the receiver */
+      (void)HAL_UART_AbortReceive(huart);
+    }
+  }
+  else
+  {
+    huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+    ATOMIC_SET_BIT(huart->Instance->CR1, USART_CR1_RE);
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Start a hardware baud rate detection.
+  * @note   The UART is disabled while the detection mode is programmed. The
+  *         detection completes on the next received character matching the mode,
+  *         after which the receiver timeout, counted in bit times, follows the
+  *         detected baud rate. A new detection is requested on each call.
+  * @param  huart Pointer to a UART_HandleTypeDef structure that contains
+  *               the configuration information for the specified UART module.
+  * @param  Mode Auto baud rate detection mode.
+  *         This parameter can be one of the following values:
+  *           @arg @ref UART_ADVFEATURE_AUTOBAUDRATE_ONSTARTBIT
+  *           @arg @ref UART_ADVFEATURE_AUTOBAUDRATE_ONFALLINGEDGE
+  *           @arg @ref UART_ADVFEATURE_AUTOBAUDRATE_ON0X7FFRAME
+  *           @arg @ref UART_ADVFEATURE_AUTOBAUDRATE_ON0X55FRAME
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UARTEx_EnableAutoBaudRate(UART_HandleTypeDef *huart, uint32_t Mode)
+{
+  /* Check parameters */
+  assert_param(IS_USART_AUTOBAUDRATE_DETECTION_INSTANCE(huart->Instance));
+  assert_param(IS_UART_ADVFEATURE_AUTOBAUDRATEMODE(Mode));
+
+  if ((huart->gState != HAL_UART_STATE_READY) || (huart->RxState != HAL_UART_STATE_READY))
+  {
+    return HAL_BUSY;
+  }
+
+  /* Process Locked */
+  __HAL_LOCK(huart);
+
+  huart->gState = HAL_UART_STATE_BUSY;
+
+  /* The detection mode can only be written with the UART disabled */
+  __HAL_UART_DISABLE(huart);
+  MODIFY_REG(huart->Instance->CR2, USART_CR2_ABRMODE | USART_CR2_ABREN, Mode | USART_CR2_ABREN);
+  __HAL_UART_ENABLE(huart);
+
+  /* Restart the detection, clearing a previous result */
+  __HAL_UART_SEND_REQ(huart, UART_AUTOBAUD_REQUEST);
+
+  huart->gState = HAL_UART_STATE_READY;
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(huart);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop the hardware baud rate detection.
+  * @note   The last detected baud rate stays programmed.
+  * @param  huart Pointer to a UART_HandleTypeDef structure that contains
+  *               the configuration information for the specified UART module.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UARTEx_DisableAutoBaudRate(UART_HandleTypeDef *huart)
+{
+  /* Check parameters */
+  assert_param(IS_USART_AUTOBAUDRATE_DETECTION_INSTANCE(huart->Instance));
+
+  /* Process Locked */
+  __HAL_LOCK(huart);
+
+  ATOMIC_CLEAR_BIT(huart->Instance->CR2, USART_CR2_ABREN);
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(huart);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Return the status of the hardware baud rate detection.
+  * @param  huart Pointer to a UART_HandleTypeDef structure that contains
+  *               the configuration information for the specified UART module.
+  * @retval HAL_OK when the baud rate has been detected, HAL_BUSY while the
+  *         detection is ongoing, HAL_ERROR when the detection failed (baud
+  *         rate out of range or character too short)
+  */
+HAL_StatusTypeDef HAL_UARTEx_GetAutoBaudRateStatus(UART_HandleTypeDef *huart)
+{
+  if (__HAL_UART_GET_FLAG(huart, UART_FLAG_ABRE) != 0U)
+  {
+    return HAL_ERROR;
+  }
+
+  if (__HAL_UART_GET_FLAG(huart, UART_FLAG_ABRF) != 0U)
+  {
+    return HAL_OK;
+  }
+
+  return HAL_BUSY;
+}
+
 /**
   * @}
   */
@@ -995,6 +1729,64 @@ static void UARTEx_Wakeup_AddressConfig(UART_HandleTypeDef *huart, UART_WakeUpTy
   MODIFY_REG(huart->Instance->CR2, USART_CR2_ADD, ((uint32_t)WakeUpSelection.Address << UART_CR2_ADDRESS_LSB_POS));
 }
 
+/**
+  * @brief  DMA UART ring buffer reception half/full transfer callback.
+  * @param  hdma DMA handle.
+  * @retval None
+  */
+static void UARTEx_DMARingRxEvent(DMA_HandleTypeDef *hdma)
+{
+  UART_HandleTypeDef *huart = (UART_HandleTypeDef *)((DMA_HandleTypeDef *)hdma)->Parent;
+
+  HAL_UARTEx_RingReceive_Update(huart);
+  HAL_UARTEx_RingRxEventCallback(huart);
+}
+
+/**
+  * @brief  DMA UART ring buffer reception error callback.
+  * @param  hdma DMA handle.
+  * @retval None
+  */
+static void UARTEx_DMARingRxError(DMA_HandleTypeDef *hdma)
+{
+  UART_HandleTypeDef *huart = (UART_HandleTypeDef *)(hdma->Parent);
+
+  UARTEx_EndRingRxTransfer(huart);
+  huart->ErrorCode |= HAL_UART_ERROR_DMA;
+
+#if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
+  /*Call registered error callback*/
+  huart->ErrorCallback(huart);
+#else
+  /*Call legacy weak error callback*/
+  HAL_UART_ErrorCallback(huart);
+#endif /* USE_HAL_UART_REGISTER_CALLBACKS */
+}
+
+/**
+  * @brief  End an ongoing ring buffer reception.
+  * @param  huart UART handle.
+  * @retval None
+  */
+static void UARTEx_EndRingRxTransfer(UART_HandleTypeDef *huart)
+{
+  /* Disable the line idle interrupt and the DMA Rx request */
+  ATOMIC_CLEAR_BIT(huart->Instance->CR1, USART_CR1_IDLEIE);
+  ATOMIC_CLEAR_BIT(huart->Instance->CR3, USART_CR3_DMAR);
+
+  /* A framed reception ends with its ring */
+  if (huart->pRxFrames != NULL)
+  {
+    ATOMIC_CLEAR_BIT(huart->Instance->CR1, USART_CR1_RTOIE);
+    huart->pRxFrames = NULL;
+  }
+
+  huart->pRxRing = NULL;
+
+  /* At end of Rx process, restore huart->RxState to Ready */
+  huart->RxState = HAL_UART_STATE_READY;
+}
+
 /**
   * @brief Calculate the number of data to process in RX/TX ISR.
   * @note The RX FIFO depth and the TX FIFO depth is extracted from
@@ -88,6 +88,26 @@
         HAL_WWDG_Refresh() function. This operation must occur only when
         the counter is lower than the refresh window value already programmed.
 
+    *** Task supervision ***
+    ========================
+
+  [..]
+    (+) Declare the tasks to supervise as a bitmask with HAL_WWDG_SupervisorStart(),
+        after HAL_WWDG_Init(). Each task is identified by a bit number from 0 to 31.
+    (+) Each supervised task calls HAL_WWDG_TaskCheckIn() with its bit number once
+        per pass of its main loop. The check-in is a single atomic bit set, safe from
+        any task or interrupt context.
+    (+) Call HAL_WWDG_SupervisorRefresh() periodically instead of HAL_WWDG_Refresh():
+        the WWDG is refreshed only when all supervised tasks have checked in since
+        the previous refresh and the counter is within the refresh window. The
+        check-ins are then cleared for the next period.
+    (+) If the Early Wakeup Interrupt is enabled, the tasks which did not check in
+        are captured by HAL_WWDG_IRQHandler() before HAL_WWDG_EarlyWakeupCallback()
+        is called, and can be read with HAL_WWDG_GetStalledTasks() to log the
+        stalled task before the reset.
+    (+) When an IWDG is also used, call HAL_IWDG_Refresh() when
+        HAL_WWDG_SupervisorRefresh() returns HAL_OK.
+
     *** Callback registration ***
     =============================
 
@@ -197,6 +217,11 @@ HAL_StatusTypeDef HAL_WWDG_Init(WWDG_HandleTypeDef *hwwdg)
   assert_param(IS_WWDG_COUNTER(hwwdg->Init.Counter));
   assert_param(IS_WWDG_EWI_MODE(hwwdg->Init.EWIMode));
 
+  /* No task supervised until HAL_WWDG_SupervisorStart() is called */
+  hwwdg->SupervisedTasks = 0U;
+  hwwdg->TaskCheckIn = 0U;
+  hwwdg->StalledTasks = 0U;
+
 #if (USE_HAL_WWDG_REGISTER_CALLBACKS == 1)
   /* Reset Callback pointers */
   if (hwwdg->EwiCallback == NULL)
@@ -383,6 +408,9 @@ void HAL_WWDG_IRQHandler(WWDG_HandleTypeDef *hwwdg)
       /* Clear the WWDG Early Wakeup flag */
       __HAL_WWDG_CLEAR_FLAG(hwwdg, WWDG_FLAG_EWIF);
 
+      /* Capture the supervised tasks which did not check in since the last refresh */
+      hwwdg->StalledTasks = hwwdg->SupervisedTasks & ~(hwwdg->TaskCheckIn);
+
 #if (USE_HAL_WWDG_REGISTER_CALLBACKS == 1)
       /* Early Wakeup registered callback */
       hwwdg->EwiCallback(hwwdg);
@@ -411,6 +439,117 @@ __weak void HAL_WWDG_EarlyWakeupCallback(WWDG_HandleTypeDef *hwwdg)
    */
 }
 
+/**
+  * @}
+  */
+
+/** @defgroup WWDG_Exported_Functions_Group3 Task supervision functions
+  *  @brief    Task supervision functions
+  *
+@verbatim
+  ==============================================================================
+                      ##### Task supervision functions #####
+  ==============================================================================
+  [..]
+    This section provides functions allowing to:
+    (+) Declare the tasks supervised by the WWDG.
+    (+) Check in a task.
+    (+) Refresh the WWDG only when all supervised tasks are alive.
+    (+) Get the tasks which stalled at the early wakeup interrupt.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Start the supervision of a set of tasks.
+  * @param  hwwdg  pointer to a WWDG_HandleTypeDef structure that contains
+  *                the configuration information for the specified WWDG module.
+  * @param  TaskMask  bitmask of the supervised tasks, bit n for task n.
+  *                   This parameter must be different from 0.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_WWDG_SupervisorStart(WWDG_HandleTypeDef *hwwdg, uint32_t TaskMask)
+{
+  if (TaskMask == 0U)
+  {
+    return HAL_ERROR;
+  }
+
+  hwwdg->TaskCheckIn = 0U;
+  hwwdg->StalledTasks = 0U;
+  hwwdg->SupervisedTasks = TaskMask;
+
+  /* Return function status */
+  return HAL_OK;
+}
+
+/**
+  * @brief  Check in a supervised task.
+  * @note   This function can be called from any task or interrupt context: the
+  *         check-in is an exclusive access bit set.
+  * @param  hwwdg  pointer to a WWDG_HandleTypeDef structure that contains
+  *                the configuration information for the specified WWDG module.
+  * @param  TaskId  bit number of the task, from 0 to 31.
+  * @retval None
+  */
+void HAL_WWDG_TaskCheckIn(WWDG_HandleTypeDef *hwwdg, uint32_t TaskId)
+{
+  /* Check the parameters */
+  assert_param(IS_WWDG_TASK_ID(TaskId));
+
+  ATOMIC_SET_BIT(hwwdg->TaskCheckIn, (1UL << TaskId));
+}
+
+/**
+  * @brief  Refresh the WWDG if all supervised tasks have checked in.
+  * @note   The WWDG is refreshed only when all the tasks declared with
+  *         HAL_WWDG_SupervisorStart() have checked in since the last refresh, and
+  *         when the downcounter is within the refresh window, so that a too early
+  *         call does not reset the device. The check-ins are then cleared.
+  * @param  hwwdg  pointer to a WWDG_HandleTypeDef structure that contains
+  *                the configuration information for the specified WWDG module.
+  * @retval HAL status
+  *         HAL_OK when the WWDG has been refreshed, HAL_BUSY when a task has not
+  *         checked in yet or the refresh window is not open yet.
+  */
+HAL_StatusTypeDef HAL_WWDG_SupervisorRefresh(WWDG_HandleTypeDef *hwwdg)
+{
+  uint32_t supervised = hwwdg->SupervisedTasks;
+
+  if ((hwwdg->TaskCheckIn & supervised) != supervised)
+  {
+    return HAL_BUSY;
+  }
+
+  if (READ_BIT(hwwdg->Instance->CR, WWDG_CR_T) > READ_BIT(hwwdg->Instance->CFR, WWDG_CFR_W))
+  {
+    return HAL_BUSY;
+  }
+
+  /* Write to WWDG CR the WWDG Counter value to refresh with */
+  WRITE_REG(hwwdg->Instance->CR, (hwwdg->Init.Counter));
+
+  /* Start a new supervision period, keeping the check-ins done in between */
+  ATOMIC_CLEAR_BIT(hwwdg->TaskCheckIn, supervised);
+
+  /* Return function status */
+  return HAL_OK;
+}
+
+/**
+  * @brief  Return the supervised tasks which did not check in at the last early
+  *         wakeup interrupt.
+  * @note   This function is intended to be called from HAL_WWDG_EarlyWakeupCallback().
+  * @param  hwwdg  pointer to a WWDG_HandleTypeDef structure that contains
+  *                the configuration information for the specified WWDG module.
+  * @retval Bitmask of the stalled tasks, 0 if all tasks checked in.
+  */
+uint32_t HAL_WWDG_GetStalledTasks(const WWDG_HandleTypeDef *hwwdg)
+{
+  return hwwdg->StalledTasks;
+}
+
 /**
   * @}
   */
@@ -979,7 +979,7 @@ HAL_StatusTypeDef USB_EPStopXfer(USB_OTG_GlobalTypeDef *USBx, USB_OTG_EPTypeDef
   *           1 : DMA feature used
   * @retval HAL status
   */
-HAL_StatusTypeDef USB_WritePacket(USB_OTG_GlobalTypeDef *USBx, uint8_t *src,
+__HOT_RAM_FUNC HAL_StatusTypeDef USB_WritePacket(USB_OTG_GlobalTypeDef *USBx, uint8_t *src,
                                   uint8_t ch_ep_num, uint16_t len, uint8_t dma)
 {
   uint32_t USBx_BASE = (uint32_t)USBx;
@@ -1010,7 +1010,7 @@ HAL_StatusTypeDef USB_WritePacket(USB_OTG_GlobalTypeDef *USBx, uint8_t *src,
   * @param  len  Number of bytes to read
   * @retval pointer to destination buffer
   */
-void *USB_ReadPacket(USB_OTG_GlobalTypeDef *USBx, uint8_t *dest, uint16_t len)
+__HOT_RAM_FUNC void *USB_ReadPacket(USB_OTG_GlobalTypeDef *USBx, uint8_t *dest, uint16_t len)
 {
   uint32_t USBx_BASE = (uint32_t)USBx;
   uint8_t *pDest = dest;
@@ -1810,33 +1810,72 @@ HAL_StatusTypeDef USB_HC_StartXfer(USB_OTG_GlobalTypeDef *USBx, USB_OTG_HCTypeDe
 
   }
 
-  /* Compute the expected number of packets associated to the transfer */
-  if (hc->xfer_len > 0U)
+  if (hc->do_ssplit == 1U)
   {
-    num_packets = (uint16_t)((hc->xfer_len + hc->max_packet - 1U) / hc->max_packet);
+    /* A split transaction moves one packet, an OUT complete split has no data */
+    num_packets = 1U;
 
-    if (num_packets > max_hc_pkt_count)
+    if (hc->ep_is_in != 0U)
     {
-      num_packets = max_hc_pkt_count;
-      hc->XferSize = (uint32_t)num_packets * hc->max_packet;
+      hc->XferSize = hc->max_packet;
+    }
+    else if (hc->do_csplit == 1U)
+    {
+      hc->XferSize = 0U;
+    }
+    else
+    {
+      hc->XferSize = (hc->xfer_len > hc->max_packet) ? hc->max_packet : hc->xfer_len;
     }
   }
   else
   {
-    num_packets = 1U;
+    /* Compute the expected number of packets associated to the transfer */
+    if (hc->xfer_len > 0U)
+    {
+      num_packets = (uint16_t)((hc->xfer_len + hc->max_packet - 1U) / hc->max_packet);
+
+      if (num_packets > max_hc_pkt_count)
+      {
+        num_packets = max_hc_pkt_count;
+        hc->XferSize = (uint32_t)num_packets * hc->max_packet;
+      }
+    }
+    else
+    {
+      num_packets = 1U;
+    }
+
+    /*
+     * For IN channel HCTSIZ.XferSize is expected to be an integer multiple of
+     * max_packet size.
+     */
+    if (hc->ep_is_in != 0U)
+    {
+      hc->XferSize = (uint32_t)num_packets * hc->max_packet;
+    }
+    else
+    {
+      hc->XferSize = hc->xfer_len;
+    }
   }
 
-  /*
-   * For IN channel HCTSIZ.XferSize is expected to be an integer multiple of
-   * max_packet size.
-   */
-  if (hc->ep_is_in != 0U)
+  /* Program the split control: start or complete split through the hub transaction translator */
+  if (hc->do_ssplit == 1U)
   {
-    hc->XferSize = (uint32_t)num_packets * hc->max_packet;
+    tmpreg = (((uint32_t)hc->hub_addr << USB_OTG_HCSPLT_HUBADDR_Pos) & USB_OTG_HCSPLT_HUBADDR) |
+             ((uint32_t)hc->hub_port_nbr & USB_OTG_HCSPLT_PRTADDR) |
+             USB_OTG_HCSPLT_XACTPOS | USB_OTG_HCSPLT_SPLITEN;
+
+    if (hc->do_csplit == 1U)
+    {
+      tmpreg |= USB_OTG_HCSPLT_COMPLSPLT;
+    }
+    USBx_HC(ch_num)->HCSPLT = tmpreg;
   }
   else
   {
-    hc->XferSize = hc->xfer_len;
+    USBx_HC(ch_num)->HCSPLT = 0U;
   }
 
   /* Initialize the HCTSIZn register */
@@ -1875,7 +1914,7 @@ HAL_StatusTypeDef USB_HC_StartXfer(USB_OTG_GlobalTypeDef *USBx, USB_OTG_HCTypeDe
     return HAL_OK;
   }
 
-  if ((hc->ep_is_in == 0U) && (hc->xfer_len > 0U))
+  if ((hc->ep_is_in == 0U) && (hc->XferSize > 0U))
   {
     switch (hc->ep_type)
     {
@@ -1883,7 +1922,7 @@ HAL_StatusTypeDef USB_HC_StartXfer(USB_OTG_GlobalTypeDef *USBx, USB_OTG_HCTypeDe
       case EP_TYPE_CTRL:
       case EP_TYPE_BULK:
 
-        len_words = (uint16_t)((hc->xfer_len + 3U) / 4U);
+        len_words = (uint16_t)((hc->XferSize + 3U) / 4U);
 
         /* check if there is enough space in FIFO space */
         if (len_words > (USBx->HNPTXSTS & 0xFFFFU))
@@ -1896,7 +1935,7 @@ HAL_StatusTypeDef USB_HC_StartXfer(USB_OTG_GlobalTypeDef *USBx, USB_OTG_HCTypeDe
       /* Periodic transfer */
       case EP_TYPE_INTR:
       case EP_TYPE_ISOC:
-        len_words = (uint16_t)((hc->xfer_len + 3U) / 4U);
+        len_words = (uint16_t)((hc->XferSize + 3U) / 4U);
         /* check if there is enough space in FIFO space */
         if (len_words > (USBx_HOST->HPTXSTS & 0xFFFFU)) /* split the transfer */
         {
@@ -1910,7 +1949,7 @@ HAL_StatusTypeDef USB_HC_StartXfer(USB_OTG_GlobalTypeDef *USBx, USB_OTG_HCTypeDe
     }
 
     /* Write packet into the Tx FIFO. */
-    (void)USB_WritePacket(USBx, hc->xfer_buff, hc->ch_num, (uint16_t)hc->xfer_len, 0);
+    (void)USB_WritePacket(USBx, hc->xfer_buff, hc->ch_num, (uint16_t)hc->XferSize, 0);
   }
 
   return HAL_OK;
@@ -139,6 +139,8 @@
 #define  VDD_VALUE                    ((uint32_t)3300U) /*!< Value of VDD in mv */
 #define  TICK_INT_PRIORITY            (((uint32_t)1U<<__NVIC_PRIO_BITS) - 1U)    /*!< tick interrupt priority */
 #define  USE_RTOS                     0U
+#define  USE_HAL_ATOMIC_LOCK          0U /*!< 1: handle lock safe between interrupt and thread */
+#define  USE_HAL_NO_LOCK              0U /*!< 1: handle lock compiled out, single context only */
 #define  PREFETCH_ENABLE              1U
 #define  PREREAD_ENABLE               0U
 #define  BUFFER_CACHE_DISABLE         0U
@@ -189,6 +191,31 @@
 
 #define USE_SPI_CRC                   1U
 
+/* DMA FEATURE: Use to activate DMA mode inside HAL SPI Driver
+ * Activated: DMA code is present inside driver
+ * Deactivated: DMA code and DMA handles cleaned from driver
+ */
+
+#define USE_SPI_DMA                   1U
+
+/* ################## UART peripheral configuration ######################### */
+
+/* DMA FEATURE: Use to activate DMA mode inside HAL UART Driver
+ * Activated: DMA code is present inside driver
+ * Deactivated: DMA code and DMA handles cleaned from driver
+ */
+
+#define USE_UART_DMA                  1U
+
+/* ################## I2C peripheral configuration ########################## */
+
+/* DMA FEATURE: Use to activate DMA mode inside HAL I2C Driver
+ * Activated: DMA code is present inside driver
+ * Deactivated: DMA code and DMA handles cleaned from driver
+ */
+
+#define USE_I2C_DMA                   1U
+
 /* Includes ------------------------------------------------------------------*/
 /**
   * @brief Include module's header file
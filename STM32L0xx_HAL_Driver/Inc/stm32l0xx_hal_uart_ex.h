@@ -91,6 +91,45 @@ typedef struct
   */
 
 /* Exported macros -----------------------------------------------------------*/
+/** @defgroup UARTEx_Exported_Macros UARTEx Exported Macros
+  * @{
+  */
+
+/** @brief  BRR value of a UART in 16-bit oversampling mode.
+  * @note   With constant arguments the value is computed by the compiler, to be written
+  *         with HAL_UARTEx_SetBRR().
+  * @param  __CLOCK__ UART kernel clock frequency, in Hz.
+  * @param  __BAUD__ Baud rate.
+  * @retval BRR value
+  */
+#define __HAL_UART_BRR_SAMPLING16(__CLOCK__, __BAUD__)                                  \
+  ((uint32_t)(((__CLOCK__) + ((__BAUD__) / 2U)) / (__BAUD__)))
+
+/** @brief  BRR value of a UART in 8-bit oversampling mode, BRR[3] being cleared.
+  * @note   With constant arguments the value is computed by the compiler, to be written
+  *         with HAL_UARTEx_SetBRR().
+  * @param  __CLOCK__ UART kernel clock frequency, in Hz.
+  * @param  __BAUD__ Baud rate.
+  * @retval BRR value
+  */
+#define __HAL_UART_BRR_SAMPLING8(__CLOCK__, __BAUD__)                                   \
+  (((((__CLOCK__) * 2U) + ((__BAUD__) / 2U)) / (__BAUD__) & 0xFFF0U) |                 \
+   (((((__CLOCK__) * 2U) + ((__BAUD__) / 2U)) / (__BAUD__) & 0x000FU) >> 1U))
+
+/** @brief  BRR value of a LPUART.
+  * @note   With constant arguments the value is computed by the compiler, to be written
+  *         with HAL_UARTEx_SetBRR().
+  * @param  __CLOCK__ LPUART kernel clock frequency, in Hz.
+  * @param  __BAUD__ Baud rate.
+  * @retval BRR value
+  */
+#define __HAL_UART_BRR_LPUART(__CLOCK__, __BAUD__)                                      \
+  ((uint32_t)((((uint64_t)(__CLOCK__) * 256U) + ((__BAUD__) / 2U)) / (__BAUD__)))
+
+/**
+  * @}
+  */
+
 /* Exported functions --------------------------------------------------------*/
 /** @addtogroup UARTEx_Exported_Functions
   * @{
@@ -130,6 +169,9 @@ HAL_StatusTypeDef HAL_UARTEx_EnableClockStopMode(UART_HandleTypeDef *huart);
 HAL_StatusTypeDef HAL_UARTEx_DisableClockStopMode(UART_HandleTypeDef *huart);
 HAL_StatusTypeDef HAL_MultiProcessorEx_AddressLength_Set(UART_HandleTypeDef *huart, uint32_t AddressLength);
 
+HAL_StatusTypeDef HAL_UARTEx_SetBaudRate(UART_HandleTypeDef *huart, uint32_t BaudRate);
+HAL_StatusTypeDef HAL_UARTEx_SetBRR(UART_HandleTypeDef *huart, uint32_t BRR);
+
 /**
   * @}
   */
@@ -422,6 +464,16 @@ HAL_StatusTypeDef HAL_MultiProcessorEx_AddressLength_Set(UART_HandleTypeDef *hua
 #define IS_UART_ADDRESSLENGTH_DETECT(__ADDRESS__) (((__ADDRESS__) == UART_ADDRESS_DETECT_4B) || \
                                                    ((__ADDRESS__) == UART_ADDRESS_DETECT_7B))
 
+/**
+  * @brief Ensure that the BRR value is allowed for the UART or LPUART instance.
+  * @param __INSTANCE__ UART instance.
+  * @param __BRR__ BRR register value.
+  * @retval SET (__BRR__ is valid) or RESET (__BRR__ is invalid)
+  */
+#define IS_UART_BRR(__INSTANCE__, __BRR__) (IS_LPUART_INSTANCE(__INSTANCE__) ?                   \
+                                            (((__BRR__) >= 0x300U) && ((__BRR__) <= 0xFFFFFU)) :  \
+                                            (((__BRR__) >= 0x10U) && ((__BRR__) <= 0xFFFFU)))
+
 
 /**
   * @}
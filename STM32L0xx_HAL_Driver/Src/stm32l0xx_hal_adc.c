@@ -2469,13 +2469,7 @@ static void ADC_DMAError(DMA_HandleTypeDef *hdma)
   */
 static void ADC_DelayMicroSecond(uint32_t microSecond)
 {
-  /* Compute number of CPU cycles to wait for */
-  __IO uint32_t waitLoopIndex = (microSecond * (SystemCoreClock / 1000000U));
-
-  while(waitLoopIndex != 0U)
-  {
-    waitLoopIndex--;
-  }
+  HAL_DelayUs(microSecond);
 }
 
 /**
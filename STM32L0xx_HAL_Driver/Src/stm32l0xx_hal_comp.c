@@ -273,7 +273,6 @@ HAL_StatusTypeDef HAL_COMP_Init(COMP_HandleTypeDef *hcomp)
   uint32_t tmp_csr = 0U;
   uint32_t exti_line = 0U;
   uint32_t comp_voltage_scaler_not_initialized = 0U;
-  __IO uint32_t wait_loop_index = 0U;
   HAL_StatusTypeDef status = HAL_OK;
 
   /* Check the COMP handle allocation and lock status */
@@ -354,14 +353,7 @@ HAL_StatusTypeDef HAL_COMP_Init(COMP_HandleTypeDef *hcomp)
         /* Apply the delay if voltage scaler bridge is enabled for the first time */
         if (comp_voltage_scaler_not_initialized != 0U)
         {
-          /* Wait loop initialization and execution */
-          /* Note: Variable divided by 2 to compensate partially              */
-          /*       CPU processing cycles.                                     */
-          wait_loop_index = (COMP_DELAY_VOLTAGE_SCALER_STAB_US * (SystemCoreClock / (1000000U * 2U)));
-          while(wait_loop_index != 0U)
-          {
-            wait_loop_index--;
-          }
+          HAL_DelayUs(COMP_DELAY_VOLTAGE_SCALER_STAB_US);
         }
       }
     }
@@ -782,7 +774,6 @@ HAL_StatusTypeDef HAL_COMP_UnRegisterCallback(COMP_HandleTypeDef *hcomp, HAL_COM
   */
 HAL_StatusTypeDef HAL_COMP_Start(COMP_HandleTypeDef *hcomp)
 {
-  __IO uint32_t wait_loop_index = 0U;
   HAL_StatusTypeDef status = HAL_OK;
 
   /* Check the COMP handle allocation and lock status */
@@ -804,14 +795,7 @@ HAL_StatusTypeDef HAL_COMP_Start(COMP_HandleTypeDef *hcomp)
       hcomp->State = HAL_COMP_STATE_BUSY;
 
       /* Delay for COMP startup time */
-      /* Wait loop initialization and execution */
-      /* Note: Variable divided by 2 to compensate partially                  */
-      /*       CPU processing cycles.                                         */
-      wait_loop_index = (COMP_DELAY_STARTUP_US * (SystemCoreClock / (1000000U * 2U)));
-      while(wait_loop_index != 0U)
-      {
-        wait_loop_index--;
-      }
+      HAL_DelayUs(COMP_DELAY_STARTUP_US);
     }
     else
     {
@@ -90,19 +90,12 @@
   */
 void HAL_COMPEx_EnableVREFINT(void)
 {
-  __IO uint32_t wait_loop_index = 0U;
 
   /* Enable VrefInt voltage reference and buffer */
   SYSCFG->CFGR3 |= (SYSCFG_CFGR3_ENBUFLP_VREFINT_COMP | SYSCFG_CFGR3_EN_VREFINT);
 
-  /* Wait loop initialization and execution */
-  /* Note: Variable divided by 2 to compensate partially              */
-  /*       CPU processing cycles.                                     */
-  wait_loop_index = (COMP_DELAY_VOLTAGE_SCALER_STAB_US * (SystemCoreClock / (1000000U * 2U)));
-  while(wait_loop_index != 0U)
-  {
-    wait_loop_index--;
-  }
+  /* Delay for VrefInt and buffer stabilization time */
+  HAL_DelayUs(COMP_DELAY_VOLTAGE_SCALER_STAB_US);
 }
 
 /**
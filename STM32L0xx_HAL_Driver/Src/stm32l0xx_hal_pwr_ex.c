@@ -145,18 +145,21 @@ void HAL_PWREx_EnableLowPowerRunMode(void)
   */
 HAL_StatusTypeDef HAL_PWREx_DisableLowPowerRunMode(void)
 {
-  uint32_t wait_loop_index = 0U;
+  uint32_t startcycle;
 
   /* Exit the Low Power Run mode */
   CLEAR_BIT(PWR->CR, PWR_CR_LPRUN);
   CLEAR_BIT(PWR->CR, PWR_CR_LPSDSR);
 
   /* Wait until REGLPF is reset */
-  wait_loop_index = (PWR_FLAG_SETTING_DELAY_US * (SystemCoreClock / 1000000U));
+  startcycle = HAL_GetCycleCount();
 
-  while ((wait_loop_index != 0U) && (HAL_IS_BIT_SET(PWR->CSR, PWR_CSR_REGLPF)))
+  while (HAL_IS_BIT_SET(PWR->CSR, PWR_CSR_REGLPF))
   {
-    wait_loop_index--;
+    if (HAL_TimeoutUs(startcycle, PWR_FLAG_SETTING_DELAY_US) != HAL_OK)
+    {
+      break;
+    }
   }
 
   if (HAL_IS_BIT_SET(PWR->CSR, PWR_CSR_REGLPF))
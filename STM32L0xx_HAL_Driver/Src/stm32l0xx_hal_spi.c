@@ -66,6 +66,12 @@
           (##) pTxData and pRxData parameters in HAL_SPI_TransmitReceive() and HAL_SPI_TransmitReceive_IT()
       (#) There is no such restriction when going through DMA by using HAL_SPI_Transmit_DMA(), HAL_SPI_Receive_DMA()
           and HAL_SPI_TransmitReceive_DMA().
+     [..]
+       DMA mode removal:
+      (#) When USE_SPI_DMA is set to 0 in the HAL configuration file, the DMA handles are removed
+          from the SPI handle and the DMA transfer, pause, resume and stop services are not compiled,
+          saving RAM in each SPI handle and flash. Polling and interrupt modes are not affected.
+          When USE_SPI_DMA is not defined, the DMA mode is available.
      [..]
        Callback registration:
 
@@ -233,6 +239,7 @@
 /** @defgroup SPI_Private_Functions SPI Private Functions
   * @{
   */
+#if (USE_SPI_DMA != 0U)
 static void SPI_DMATransmitCplt(DMA_HandleTypeDef *hdma);
 static void SPI_DMAReceiveCplt(DMA_HandleTypeDef *hdma);
 static void SPI_DMATransmitReceiveCplt(DMA_HandleTypeDef *hdma);
@@ -243,6 +250,7 @@ static void SPI_DMAError(DMA_HandleTypeDef *hdma);
 static void SPI_DMAAbortOnError(DMA_HandleTypeDef *hdma);
 static void SPI_DMATxAbortCallback(DMA_HandleTypeDef *hdma);
 static void SPI_DMARxAbortCallback(DMA_HandleTypeDef *hdma);
+#endif /* USE_SPI_DMA */
 static HAL_StatusTypeDef SPI_WaitFlagStateUntilTimeout(SPI_HandleTypeDef *hspi, uint32_t Flag, FlagStatus State,
                                                        uint32_t Timeout, uint32_t Tickstart);
 static void SPI_TxISR_8BIT(struct __SPI_HandleTypeDef *hspi);
@@ -1620,6 +1628,7 @@ error :
   return errorcode;
 }
 
+#if (USE_SPI_DMA != 0U)
 /**
   * @brief  Transmit an amount of data in non-blocking mode with DMA.
   * @param  hspi pointer to a SPI_HandleTypeDef structure that contains
@@ -1975,6 +1984,7 @@ error :
   __HAL_UNLOCK(hspi);
   return errorcode;
 }
+#endif /* USE_SPI_DMA */
 
 /**
   * @brief  Abort ongoing transfer (blocking mode).
@@ -2039,6 +2049,7 @@ HAL_StatusTypeDef HAL_SPI_Abort(SPI_HandleTypeDef *hspi)
     count = resetcount;
   }
 
+#if (USE_SPI_DMA != 0U)
   /* Disable the SPI DMA Tx request if enabled */
   if (HAL_IS_BIT_SET(hspi->Instance->CR2, SPI_CR2_TXDMAEN))
   {
@@ -2095,6 +2106,7 @@ HAL_StatusTypeDef HAL_SPI_Abort(SPI_HandleTypeDef *hspi)
       CLEAR_BIT(hspi->Instance->CR2, (SPI_CR2_RXDMAEN));
     }
   }
+#endif /* USE_SPI_DMA */
   /* Reset Tx and Rx transfer counters */
   hspi->RxXferCount = 0U;
   hspi->TxXferCount = 0U;
@@ -2188,6 +2200,7 @@ HAL_StatusTypeDef HAL_SPI_Abort_IT(SPI_HandleTypeDef *hspi)
     count = resetcount;
   }
 
+#if (USE_SPI_DMA != 0U)
   /* If DMA Tx and/or DMA Rx Handles are associated to SPI Handle, DMA Abort complete callbacks should be initialised
      before any call to DMA Abort functions */
   /* DMA Tx Handle is valid */
@@ -2255,6 +2268,7 @@ HAL_StatusTypeDef HAL_SPI_Abort_IT(SPI_HandleTypeDef *hspi)
       }
     }
   }
+#endif /* USE_SPI_DMA */
 
   if (abortcplt == 1U)
   {
@@ -2292,6 +2306,7 @@ HAL_StatusTypeDef HAL_SPI_Abort_IT(SPI_HandleTypeDef *hspi)
   return errorcode;
 }
 
+#if (USE_SPI_DMA != 0U)
 /**
   * @brief  Pause the DMA Transfer.
   * @param  hspi pointer to a SPI_HandleTypeDef structure that contains
@@ -2371,6 +2386,7 @@ HAL_StatusTypeDef HAL_SPI_DMAStop(SPI_HandleTypeDef *hspi)
   hspi->State = HAL_SPI_STATE_READY;
   return errorcode;
 }
+#endif /* USE_SPI_DMA */
 
 /**
   * @brief  Handle SPI interrupt request.
@@ -2436,6 +2452,7 @@ void HAL_SPI_IRQHandler(SPI_HandleTypeDef *hspi)
       __HAL_SPI_DISABLE_IT(hspi, SPI_IT_RXNE | SPI_IT_TXE | SPI_IT_ERR);
 
       hspi->State = HAL_SPI_STATE_READY;
+#if (USE_SPI_DMA != 0U)
       /* Disable the SPI DMA requests if enabled */
       if ((HAL_IS_BIT_SET(itsource, SPI_CR2_TXDMAEN)) || (HAL_IS_BIT_SET(itsource, SPI_CR2_RXDMAEN)))
       {
@@ -2465,6 +2482,7 @@ void HAL_SPI_IRQHandler(SPI_HandleTypeDef *hspi)
         }
       }
       else
+#endif /* USE_SPI_DMA */
       {
         /* Call user error callback */
 #if (USE_HAL_SPI_REGISTER_CALLBACKS == 1U)
@@ -2664,6 +2682,7 @@ uint32_t HAL_SPI_GetError(SPI_HandleTypeDef *hspi)
   * @{
   */
 
+#if (USE_SPI_DMA != 0U)
 /**
   * @brief  DMA SPI transmit process complete callback.
   * @param  hdma pointer to a DMA_HandleTypeDef structure that contains
@@ -3094,6 +3113,7 @@ static void SPI_DMARxAbortCallback(DMA_HandleTypeDef *hdma)
   HAL_SPI_AbortCpltCallback(hspi);
 #endif /* USE_HAL_SPI_REGISTER_CALLBACKS */
 }
+#endif /* USE_SPI_DMA */
 
 /**
   * @brief  Rx 8-bit handler for Transmit and Receive in Interrupt mode.
@@ -3443,6 +3463,9 @@ static HAL_StatusTypeDef SPI_WaitFlagStateUntilTimeout(SPI_HandleTypeDef *hspi,
 {
   while ((__HAL_SPI_GET_FLAG(hspi, Flag) ? SET : RESET) != State)
   {
+    /* Let the application yield or sleep while waiting */
+    HAL_WaitHook(HAL_WAIT_SPI, hspi);
+
     if (Timeout != HAL_MAX_DELAY)
     {
       if (((HAL_GetTick() - Tickstart) >= Timeout) || (Timeout == 0U))
@@ -67,6 +67,15 @@
         also configure the low level Hardware GPIO, CLOCK, CORTEX...etc) by
         calling the customized HAL_UART_MspInit() API.
 
+    ##### DMA mode removal #####
+    ==================================
+
+    [..]
+    When USE_UART_DMA is set to 0 in the HAL configuration file, the DMA handles are removed
+    from the UART handle and the DMA transfer, pause, resume and stop services are not compiled,
+    saving RAM in each UART handle and flash. Polling and interrupt modes are not affected.
+    When USE_UART_DMA is not defined, the DMA mode is available.
+
     ##### Callback registration #####
     ==================================
 
@@ -168,6 +177,21 @@
 #ifdef HAL_UART_MODULE_ENABLED
 
 /* Private typedef -----------------------------------------------------------*/
+/** @defgroup UART_Private_Types UART Private Types
+  * @{
+  */
+/**
+  * @brief  Baud rate and reciprocal used by the fast BRR computation
+  */
+typedef struct
+{
+  uint32_t BaudRate;       /*!< Baud rate                          */
+  uint32_t Reciprocal;     /*!< 2^40 / BaudRate, rounded           */
+} UART_BaudRecipTypeDef;
+/**
+  * @}
+  */
+
 /* Private define ------------------------------------------------------------*/
 /** @defgroup UART_Private_Constants UART Private Constants
   * @{
@@ -183,12 +207,43 @@
 #define UART_BRR_MIN    0x10U        /* UART BRR minimum authorized value */
 #define UART_BRR_MAX    0x0000FFFFU  /* UART BRR maximum authorized value */
 
+#define UART_DIV_SCALE_SAMPLING16    0U     /* BRR units per bit clock, log2, 16-bit oversampling */
+#define UART_DIV_SCALE_SAMPLING8     1U     /* BRR units per bit clock, log2, 8-bit oversampling  */
+#define UART_DIV_SCALE_LPUART        8U     /* BRR units per bit clock, log2, LPUART              */
+
+/* Reciprocal of the baud rate, 2^40/BaudRate, for baud rates above 256 */
+#define UART_BAUD_RECIP(__BAUD__)    ((uint32_t)((((uint64_t)1U << 40U) + ((__BAUD__) / 2U)) / (__BAUD__)))
+
+#define UART_BAUD_RECIP_TABLE_SIZE   18U    /* Number of baud rates of UARTBaudRecipTable */
 /**
   * @}
   */
 
 /* Private macros ------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
+/* Common baud rates, divided without division instruction */
+static const UART_BaudRecipTypeDef UARTBaudRecipTable[UART_BAUD_RECIP_TABLE_SIZE] =
+{
+  {1200U,    UART_BAUD_RECIP(1200U)},
+  {2400U,    UART_BAUD_RECIP(2400U)},
+  {4800U,    UART_BAUD_RECIP(4800U)},
+  {9600U,    UART_BAUD_RECIP(9600U)},
+  {14400U,   UART_BAUD_RECIP(14400U)},
+  {19200U,   UART_BAUD_RECIP(19200U)},
+  {28800U,   UART_BAUD_RECIP(28800U)},
+  {38400U,   UART_BAUD_RECIP(38400U)},
+  {57600U,   UART_BAUD_RECIP(57600U)},
+  {76800U,   UART_BAUD_RECIP(76800U)},
+  {115200U,  UART_BAUD_RECIP(115200U)},
+  {230400U,  UART_BAUD_RECIP(230400U)},
+  {250000U,  UART_BAUD_RECIP(250000U)},
+  {460800U,  UART_BAUD_RECIP(460800U)},
+  {500000U,  UART_BAUD_RECIP(500000U)},
+  {921600U,  UART_BAUD_RECIP(921600U)},
+  {1000000U, UART_BAUD_RECIP(1000000U)},
+  {2000000U, UART_BAUD_RECIP(2000000U)}
+};
+
 /* Private function prototypes -----------------------------------------------*/
 /** @addtogroup UART_Private_Functions
   * @{
@@ -198,6 +253,7 @@ void UART_InitCallbacksToDefault(UART_HandleTypeDef *huart);
 #endif /* USE_HAL_UART_REGISTER_CALLBACKS */
 static void UART_EndTxTransfer(UART_HandleTypeDef *huart);
 static void UART_EndRxTransfer(UART_HandleTypeDef *huart);
+#if (USE_UART_DMA != 0U)
 static void UART_DMATransmitCplt(DMA_HandleTypeDef *hdma);
 static void UART_DMAReceiveCplt(DMA_HandleTypeDef *hdma);
 static void UART_DMARxHalfCplt(DMA_HandleTypeDef *hdma);
@@ -208,11 +264,13 @@ static void UART_DMATxAbortCallback(DMA_HandleTypeDef *hdma);
 static void UART_DMARxAbortCallback(DMA_HandleTypeDef *hdma);
 static void UART_DMATxOnlyAbortCallback(DMA_HandleTypeDef *hdma);
 static void UART_DMARxOnlyAbortCallback(DMA_HandleTypeDef *hdma);
+#endif /* USE_UART_DMA */
 static void UART_TxISR_8BIT(UART_HandleTypeDef *huart);
 static void UART_TxISR_16BIT(UART_HandleTypeDef *huart);
 static void UART_EndTransmit_IT(UART_HandleTypeDef *huart);
 static void UART_RxISR_8BIT(UART_HandleTypeDef *huart);
 static void UART_RxISR_16BIT(UART_HandleTypeDef *huart);
+static uint32_t UART_DivBaudRate(uint32_t Clock, uint32_t BaudRate, uint32_t Scale);
 /**
   * @}
   */
@@ -1359,6 +1417,7 @@ HAL_StatusTypeDef HAL_UART_Receive_IT(UART_HandleTypeDef *huart, uint8_t *pData,
   }
 }
 
+#if (USE_UART_DMA != 0U)
 /**
   * @brief Send an amount of data in DMA mode.
   * @note   When UART parity is not enabled (PCE = 0), and Word Length is configured to 9 bits (M1-M0 = 01),
@@ -1678,6 +1737,7 @@ HAL_StatusTypeDef HAL_UART_DMAStop(UART_HandleTypeDef *huart)
 
   return HAL_OK;
 }
+#endif /* USE_UART_DMA */
 
 /**
   * @brief  Abort ongoing transfers (blocking mode).
@@ -1697,6 +1757,7 @@ HAL_StatusTypeDef HAL_UART_Abort(UART_HandleTypeDef *huart)
   CLEAR_BIT(huart->Instance->CR1, (USART_CR1_RXNEIE | USART_CR1_PEIE | USART_CR1_TXEIE | USART_CR1_TCIE));
   CLEAR_BIT(huart->Instance->CR3, USART_CR3_EIE);
 
+#if (USE_UART_DMA != 0U)
   /* Disable the UART DMA Tx request if enabled */
   if (HAL_IS_BIT_SET(huart->Instance->CR3, USART_CR3_DMAT))
   {
@@ -1746,6 +1807,7 @@ HAL_StatusTypeDef HAL_UART_Abort(UART_HandleTypeDef *huart)
       }
     }
   }
+#endif /* USE_UART_DMA */
 
   /* Reset Tx and Rx transfer counters */
   huart->TxXferCount = 0U;
@@ -1785,6 +1847,7 @@ HAL_StatusTypeDef HAL_UART_AbortTransmit(UART_HandleTypeDef *huart)
   /* Disable TXEIE and TCIE interrupts */
   CLEAR_BIT(huart->Instance->CR1, (USART_CR1_TXEIE | USART_CR1_TCIE));
 
+#if (USE_UART_DMA != 0U)
   /* Disable the UART DMA Tx request if enabled */
   if (HAL_IS_BIT_SET(huart->Instance->CR3, USART_CR3_DMAT))
   {
@@ -1809,6 +1872,7 @@ HAL_StatusTypeDef HAL_UART_AbortTransmit(UART_HandleTypeDef *huart)
       }
     }
   }
+#endif /* USE_UART_DMA */
 
   /* Reset Tx transfer counter */
   huart->TxXferCount = 0U;
@@ -1838,6 +1902,7 @@ HAL_StatusTypeDef HAL_UART_AbortReceive(UART_HandleTypeDef *huart)
   CLEAR_BIT(huart->Instance->CR1, (USART_CR1_RXNEIE | USART_CR1_PEIE));
   CLEAR_BIT(huart->Instance->CR3, USART_CR3_EIE);
 
+#if (USE_UART_DMA != 0U)
   /* Disable the UART DMA Rx request if enabled */
   if (HAL_IS_BIT_SET(huart->Instance->CR3, USART_CR3_DMAR))
   {
@@ -1862,6 +1927,7 @@ HAL_StatusTypeDef HAL_UART_AbortReceive(UART_HandleTypeDef *huart)
       }
     }
   }
+#endif /* USE_UART_DMA */
 
   /* Reset Rx transfer counter */
   huart->RxXferCount = 0U;
@@ -1900,6 +1966,7 @@ HAL_StatusTypeDef HAL_UART_Abort_IT(UART_HandleTypeDef *huart)
   CLEAR_BIT(huart->Instance->CR1, (USART_CR1_RXNEIE | USART_CR1_PEIE | USART_CR1_TXEIE | USART_CR1_TCIE));
   CLEAR_BIT(huart->Instance->CR3, USART_CR3_EIE);
 
+#if (USE_UART_DMA != 0U)
   /* If DMA Tx and/or DMA Rx Handles are associated to UART Handle, DMA Abort complete callbacks should be initialised
      before any call to DMA Abort functions */
   /* DMA Tx Handle is valid */
@@ -1978,6 +2045,7 @@ HAL_StatusTypeDef HAL_UART_Abort_IT(UART_HandleTypeDef *huart)
       }
     }
   }
+#endif /* USE_UART_DMA */
 
   /* if no DMA abort complete callback execution is required => call user Abort Complete callback */
   if (abortcplt == 1U)
@@ -2036,6 +2104,7 @@ HAL_StatusTypeDef HAL_UART_AbortTransmit_IT(UART_HandleTypeDef *huart)
   /* Disable interrupts */
   CLEAR_BIT(huart->Instance->CR1, (USART_CR1_TXEIE | USART_CR1_TCIE));
 
+#if (USE_UART_DMA != 0U)
   /* Disable the UART DMA Tx request if enabled */
   if (HAL_IS_BIT_SET(huart->Instance->CR3, USART_CR3_DMAT))
   {
@@ -2077,6 +2146,7 @@ HAL_StatusTypeDef HAL_UART_AbortTransmit_IT(UART_HandleTypeDef *huart)
     }
   }
   else
+#endif /* USE_UART_DMA */
   {
     /* Reset Tx transfer counter */
     huart->TxXferCount = 0U;
@@ -2121,6 +2191,7 @@ HAL_StatusTypeDef HAL_UART_AbortReceive_IT(UART_HandleTypeDef *huart)
   CLEAR_BIT(huart->Instance->CR1, (USART_CR1_RXNEIE | USART_CR1_PEIE));
   CLEAR_BIT(huart->Instance->CR3, USART_CR3_EIE);
 
+#if (USE_UART_DMA != 0U)
   /* Disable the UART DMA Rx request if enabled */
   if (HAL_IS_BIT_SET(huart->Instance->CR3, USART_CR3_DMAR))
   {
@@ -2168,6 +2239,7 @@ HAL_StatusTypeDef HAL_UART_AbortReceive_IT(UART_HandleTypeDef *huart)
     }
   }
   else
+#endif /* USE_UART_DMA */
   {
     /* Reset Rx transfer counter */
     huart->RxXferCount = 0U;
@@ -2287,6 +2359,7 @@ void HAL_UART_IRQHandler(UART_HandleTypeDef *huart)
            Disable Rx Interrupts, and disable Rx DMA request, if ongoing */
         UART_EndRxTransfer(huart);
 
+#if (USE_UART_DMA != 0U)
         /* Disable the UART DMA Rx request if enabled */
         if (HAL_IS_BIT_SET(huart->Instance->CR3, USART_CR3_DMAR))
         {
@@ -2320,6 +2393,7 @@ void HAL_UART_IRQHandler(UART_HandleTypeDef *huart)
           }
         }
         else
+#endif /* USE_UART_DMA */
         {
           /* Call user error callback */
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
@@ -2750,11 +2824,8 @@ void UART_InitCallbacksToDefault(UART_HandleTypeDef *huart)
 HAL_StatusTypeDef UART_SetConfig(UART_HandleTypeDef *huart)
 {
   uint32_t tmpreg;
-  uint16_t brrtemp;
-  UART_ClockSourceTypeDef clocksource = UART_CLOCKSOURCE_UNDEFINED;
-  uint32_t usartdiv                   = 0x00000000U;
-  HAL_StatusTypeDef ret               = HAL_OK;
-  uint32_t lpuart_ker_ck_pres         = 0x00000000U;
+  uint32_t usartdiv;
+  HAL_StatusTypeDef ret;
 
   /* Check the parameters */
   assert_param(IS_UART_BAUDRATE(huart->Init.BaudRate));
@@ -2805,158 +2876,191 @@ HAL_StatusTypeDef UART_SetConfig(UART_HandleTypeDef *huart)
 
 
   /*-------------------------- USART BRR Configuration -----------------------*/
+  ret = UART_ComputeBRR(huart, huart->Init.BaudRate, &usartdiv);
+  if (ret == HAL_OK)
+  {
+    huart->Instance->BRR = usartdiv;
+  }
+
+  /* Clear ISR function pointers */
+  huart->RxISR = NULL;
+  huart->TxISR = NULL;
+
+  return ret;
+}
+
+/**
+  * @brief Compute the BRR register value of the UART for a baud rate.
+  * @note  The baud rate division is replaced by a multiplication when the baud rate is in the
+  *        reciprocal table. The result is the same as with the division.
+  * @param huart    UART handle.
+  * @param BaudRate Baud rate.
+  * @param pBRR     Pointer to the BRR register value.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef UART_ComputeBRR(const UART_HandleTypeDef *huart, uint32_t BaudRate, uint32_t *pBRR)
+{
+  UART_ClockSourceTypeDef clocksource;
+  uint32_t usartdiv;
+  HAL_StatusTypeDef ret               = HAL_OK;
+  uint32_t pclk;
+
   UART_GETCLOCKSOURCE(huart, clocksource);
 
-  /* Check LPUART instance */
-  if (UART_INSTANCE_LOWPOWER(huart))
-  {
-    /* Retrieve frequency clock */
-    switch (clocksource)
-    {
-      case UART_CLOCKSOURCE_PCLK1:
-        lpuart_ker_ck_pres = HAL_RCC_GetPCLK1Freq();
-        break;
-      case UART_CLOCKSOURCE_HSI:
-        if (__HAL_RCC_GET_FLAG(RCC_FLAG_HSIDIV) != 0U)
-        {
-          lpuart_ker_ck_pres = (uint32_t)(HSI_VALUE >> 2U);
-        }
-        else
-        {
-          lpuart_ker_ck_pres = (uint32_t)HSI_VALUE;
-        }
-        break;
-      case UART_CLOCKSOURCE_SYSCLK:
-        lpuart_ker_ck_pres = HAL_RCC_GetSysClockFreq();
-        break;
-      case UART_CLOCKSOURCE_LSE:
-        lpuart_ker_ck_pres = (uint32_t)LSE_VALUE;
-        break;
-      case UART_CLOCKSOURCE_UNDEFINED:
-      default:
-        ret = HAL_ERROR;
-        break;
-    }
+  /* Retrieve frequency clock */
+  switch (clocksource)
+  {
+    case UART_CLOCKSOURCE_PCLK1:
+      pclk = HAL_RCC_GetPCLK1Freq();
+      break;
+    case UART_CLOCKSOURCE_PCLK2:
+      pclk = HAL_RCC_GetPCLK2Freq();
+      break;
+    case UART_CLOCKSOURCE_HSI:
+      if (__HAL_RCC_GET_FLAG(RCC_FLAG_HSIDIV) != 0U)
+      {
+        pclk = (uint32_t)(HSI_VALUE >> 2U);
+      }
+      else
+      {
+        pclk = (uint32_t) HSI_VALUE;
+      }
+      break;
+    case UART_CLOCKSOURCE_SYSCLK:
+      pclk = HAL_RCC_GetSysClockFreq();
+      break;
+    case UART_CLOCKSOURCE_LSE:
+      pclk = (uint32_t) LSE_VALUE;
+      break;
+    case UART_CLOCKSOURCE_UNDEFINED:
+    default:
+      pclk = 0U;
+      ret = HAL_ERROR;
+      break;
+  }
 
-    /* if proper clock source reported */
-    if (lpuart_ker_ck_pres != 0U)
+  /* If proper clock source reported */
+  if (pclk != 0U)
+  {
+    /* Check LPUART instance */
+    if (UART_INSTANCE_LOWPOWER(huart))
     {
-      /* ensure that Frequency clock is in the range [3 * baudrate, 4096 * baudrate] */
-      if ((lpuart_ker_ck_pres < (3U * huart->Init.BaudRate)) ||
-          (lpuart_ker_ck_pres > (4096U * huart->Init.BaudRate)))
+      /* Ensure that Frequency clock is in the range [3 * baudrate, 4096 * baudrate] */
+      if ((pclk < (3U * BaudRate)) ||
+          (pclk > (4096U * BaudRate)))
       {
         ret = HAL_ERROR;
       }
       else
       {
-        usartdiv = (uint32_t)(UART_DIV_LPUART(lpuart_ker_ck_pres, huart->Init.BaudRate));
-
-        /* It is forbidden to write values lower than 0x300 in the LPUART_BRR register */
+        /* Check computed UsartDiv value is in allocated range
+           (it is forbidden to write values lower than 0x300 in the LPUART_BRR register) */
+        usartdiv = UART_DivBaudRate(pclk, BaudRate, UART_DIV_SCALE_LPUART);
         if ((usartdiv >= LPUART_BRR_MIN) && (usartdiv <= LPUART_BRR_MAX))
         {
-          huart->Instance->BRR = usartdiv;
+          *pBRR = usartdiv;
         }
         else
         {
           ret = HAL_ERROR;
         }
-      } /*   if ( (lpuart_ker_ck_pres < (3 * huart->Init.BaudRate) ) || (lpuart_ker_ck_pres > (4096 * huart->Init.BaudRate) )) */
-    } /* if (lpuart_ker_ck_pres != 0) */
-  }
-  /* Check UART Over Sampling to set Baud Rate Register */
-  else if (huart->Init.OverSampling == UART_OVERSAMPLING_8)
-  {
-    switch (clocksource)
-    {
-      case UART_CLOCKSOURCE_PCLK1:
-        usartdiv = (uint16_t)(UART_DIV_SAMPLING8(HAL_RCC_GetPCLK1Freq(), huart->Init.BaudRate));
-        break;
-      case UART_CLOCKSOURCE_PCLK2:
-        usartdiv = (uint16_t)(UART_DIV_SAMPLING8(HAL_RCC_GetPCLK2Freq(), huart->Init.BaudRate));
-        break;
-      case UART_CLOCKSOURCE_HSI:
-        if (__HAL_RCC_GET_FLAG(RCC_FLAG_HSIDIV) != 0U)
-        {
-          usartdiv = (uint16_t)(UART_DIV_SAMPLING8((HSI_VALUE >> 2U), huart->Init.BaudRate));
-        }
-        else
-        {
-          usartdiv = (uint16_t)(UART_DIV_SAMPLING8(HSI_VALUE, huart->Init.BaudRate));
-        }
-        break;
-      case UART_CLOCKSOURCE_SYSCLK:
-        usartdiv = (uint16_t)(UART_DIV_SAMPLING8(HAL_RCC_GetSysClockFreq(), huart->Init.BaudRate));
-        break;
-      case UART_CLOCKSOURCE_LSE:
-        usartdiv = (uint16_t)(UART_DIV_SAMPLING8(LSE_VALUE, huart->Init.BaudRate));
-        break;
-      case UART_CLOCKSOURCE_UNDEFINED:
-      default:
-        ret = HAL_ERROR;
-        break;
+      }
     }
-
-    /* USARTDIV must be greater than or equal to 0d16 */
-    if ((usartdiv >= UART_BRR_MIN) && (usartdiv <= UART_BRR_MAX))
+    /* Check UART Over Sampling to set Baud Rate Register */
+    else if (huart->Init.OverSampling == UART_OVERSAMPLING_8)
     {
-      brrtemp = (uint16_t)(usartdiv & 0xFFF0U);
-      brrtemp |= (uint16_t)((usartdiv & (uint16_t)0x000FU) >> 1U);
-      huart->Instance->BRR = brrtemp;
+      /* USARTDIV must be greater than or equal to 0d16 */
+      usartdiv = UART_DivBaudRate(pclk, BaudRate, UART_DIV_SCALE_SAMPLING8);
+      if ((usartdiv >= UART_BRR_MIN) && (usartdiv <= UART_BRR_MAX))
+      {
+        *pBRR = (usartdiv & 0xFFF0U) | ((usartdiv & 0x000FU) >> 1U);
+      }
+      else
+      {
+        ret = HAL_ERROR;
+      }
     }
     else
     {
-      ret = HAL_ERROR;
+      /* USARTDIV must be greater than or equal to 0d16 */
+      usartdiv = UART_DivBaudRate(pclk, BaudRate, UART_DIV_SCALE_SAMPLING16);
+      if ((usartdiv >= UART_BRR_MIN) && (usartdiv <= UART_BRR_MAX))
+      {
+        *pBRR = usartdiv;
+      }
+      else
+      {
+        ret = HAL_ERROR;
+      }
     }
   }
-  else
+
+  return ret;
+}
+
+/**
+  * @brief Divide the UART clock by the baud rate, rounded to the nearest.
+  * @note  Cortex-M0+ has no divide instruction: for the baud rates of UARTBaudRecipTable, the
+  *        quotient is estimated with a 64-bit multiplication by 2^40/BaudRate, then corrected
+  *        from the remainder so that the result is bit-exact with the rounded division.
+  * @param Clock    UART clock.
+  * @param BaudRate Baud rate.
+  * @param Scale    Log2 of the BRR units per bit clock: 0 in 16-bit oversampling mode,
+  *                 1 in 8-bit oversampling mode, 8 for the LPUART.
+  * @retval Clock * 2^Scale / BaudRate
+  */
+static uint32_t UART_DivBaudRate(uint32_t Clock, uint32_t BaudRate, uint32_t Scale)
+{
+  uint32_t index = 0U;
+  uint32_t usartdiv;
+  uint32_t remainder;
+  uint64_t dividend;
+  uint64_t product;
+
+  while ((index < UART_BAUD_RECIP_TABLE_SIZE) && (UARTBaudRecipTable[index].BaudRate != BaudRate))
   {
-    switch (clocksource)
+    index++;
+  }
+
+  if (index < UART_BAUD_RECIP_TABLE_SIZE)
+  {
+    dividend = (uint64_t)Clock << Scale;
+
+    /* Truncated quotient, within one of the exact one */
+    usartdiv = (uint32_t)(((uint64_t)Clock * UARTBaudRecipTable[index].Reciprocal) >> (40U - Scale));
+    product = (uint64_t)usartdiv * BaudRate;
+
+    if (product > dividend)
     {
-      case UART_CLOCKSOURCE_PCLK1:
-        usartdiv = (uint16_t)(UART_DIV_SAMPLING16(HAL_RCC_GetPCLK1Freq(), huart->Init.BaudRate));
-        break;
-      case UART_CLOCKSOURCE_PCLK2:
-        usartdiv = (uint16_t)(UART_DIV_SAMPLING16(HAL_RCC_GetPCLK2Freq(), huart->Init.BaudRate));
-        break;
-      case UART_CLOCKSOURCE_HSI:
-        if (__HAL_RCC_GET_FLAG(RCC_FLAG_HSIDIV) != 0U)
-        {
-          usartdiv = (uint16_t)(UART_DIV_SAMPLING16((HSI_VALUE >> 2U), huart->Init.BaudRate));
-        }
-        else
-        {
-          usartdiv = (uint16_t)(UART_DIV_SAMPLING16(HSI_VALUE, huart->Init.BaudRate));
-        }
-        break;
-      case UART_CLOCKSOURCE_SYSCLK:
-        usartdiv = (uint16_t)(UART_DIV_SAMPLING16(HAL_RCC_GetSysClockFreq(), huart->Init.BaudRate));
-        break;
-      case UART_CLOCKSOURCE_LSE:
-        usartdiv = (uint16_t)(UART_DIV_SAMPLING16(LSE_VALUE, huart->Init.BaudRate));
-        break;
-      case UART_CLOCKSOURCE_UNDEFINED:
-      default:
-        ret = HAL_ERROR;
-        break;
+      usartdiv--;
+      product -= BaudRate;
     }
 
-    /* USARTDIV must be greater than or equal to 0d16 */
-    if ((usartdiv >= UART_BRR_MIN) && (usartdiv <= UART_BRR_MAX))
+    remainder = (uint32_t)(dividend - product);
+
+    if (remainder >= BaudRate)
     {
-      huart->Instance->BRR = usartdiv;
+      usartdiv++;
+      remainder -= BaudRate;
     }
-    else
+
+    /* Round as (dividend + BaudRate / 2) / BaudRate */
+    if (remainder >= (BaudRate - (BaudRate / 2U)))
     {
-      ret = HAL_ERROR;
+      usartdiv++;
     }
   }
+  /* Baud rate out of the table: same divisions as the UART_DIV_xxx macros */
+  else if (Scale == UART_DIV_SCALE_LPUART)
+  {
+    usartdiv = (uint32_t)((((uint64_t)Clock * 256U) + (BaudRate / 2U)) / BaudRate);
+  }
+  else
+  {
+    usartdiv = ((Clock << Scale) + (BaudRate / 2U)) / BaudRate;
+  }
 
-
-  /* Clear ISR function pointers */
-  huart->RxISR = NULL;
-  huart->TxISR = NULL;
-
-  return ret;
+  return usartdiv;
 }
 
 /**
@@ -3094,6 +3198,9 @@ HAL_StatusTypeDef UART_WaitOnFlagUntilTimeout(UART_HandleTypeDef *huart, uint32_
   /* Wait until flag is set */
   while ((__HAL_UART_GET_FLAG(huart, Flag) ? SET : RESET) == Status)
   {
+    /* Let the application yield or sleep while waiting */
+    HAL_WaitHook(HAL_WAIT_UART, huart);
+
     /* Check for the Timeout */
     if (Timeout != HAL_MAX_DELAY)
     {
@@ -3151,6 +3258,7 @@ static void UART_EndRxTransfer(UART_HandleTypeDef *huart)
 }
 
 
+#if (USE_UART_DMA != 0U)
 /**
   * @brief DMA UART transmit process complete callback.
   * @param hdma DMA handle.
@@ -3476,6 +3584,7 @@ static void UART_DMARxOnlyAbortCallback(DMA_HandleTypeDef *hdma)
   HAL_UART_AbortReceiveCpltCallback(huart);
 #endif /* USE_HAL_UART_REGISTER_CALLBACKS */
 }
+#endif /* USE_UART_DMA */
 
 /**
   * @brief TX interrrupt handler for 7 or 8 bits data word length .
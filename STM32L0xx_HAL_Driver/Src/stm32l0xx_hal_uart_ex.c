@@ -280,6 +280,10 @@ __weak void HAL_UARTEx_WakeupCallback(UART_HandleTypeDef *huart)
          trigger: address match, Start Bit detection or RXNE bit status.
      (+) HAL_UARTEx_EnableStopMode() API enables the UART to wake up the MCU from stop mode
      (+) HAL_UARTEx_DisableStopMode() API disables the above functionality
+     (+) HAL_UARTEx_SetBaudRate() API changes the baud rate of an initialized UART, the
+         division by the common baud rates being replaced by a multiplication
+     (+) HAL_UARTEx_SetBRR() API writes a BRR value computed at build time with
+         __HAL_UART_BRR_SAMPLING16(), __HAL_UART_BRR_SAMPLING8() or __HAL_UART_BRR_LPUART()
 
 @endverbatim
   * @{
@@ -468,6 +472,96 @@ HAL_StatusTypeDef HAL_UARTEx_DisableStopMode(UART_HandleTypeDef *huart)
   return HAL_OK;
 }
 
+/**
+  * @brief  Change the baud rate of the UART.
+  * @note   The UART must be initialized and no transfer on going. The other parameters are kept.
+  * @note   For the common baud rates (1200 to 2000000 bauds), the BRR value is computed without
+  *         division, see UART_ComputeBRR().
+  * @param huart    UART handle.
+  * @param BaudRate New baud rate.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UARTEx_SetBaudRate(UART_HandleTypeDef *huart, uint32_t BaudRate)
+{
+  uint32_t tmpcr1;
+  uint32_t brr = 0U;
+  HAL_StatusTypeDef status;
+
+  /* Check the parameters */
+  assert_param(IS_UART_BAUDRATE(BaudRate));
+
+  /* Process Locked */
+  __HAL_LOCK(huart);
+
+  huart->gState = HAL_UART_STATE_BUSY;
+
+  status = UART_ComputeBRR(huart, BaudRate, &brr);
+
+  if (status == HAL_OK)
+  {
+    /* Save actual UART configuration */
+    tmpcr1 = READ_REG(huart->Instance->CR1);
+
+    /* Disable UART */
+    __HAL_UART_DISABLE(huart);
+
+    huart->Instance->BRR = brr;
+    huart->Init.BaudRate = BaudRate;
+
+    /* Restore UART configuration */
+    WRITE_REG(huart->Instance->CR1, tmpcr1);
+  }
+
+  huart->gState = HAL_UART_STATE_READY;
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(huart);
+
+  return status;
+}
+
+/**
+  * @brief  Write a BRR value computed at build time.
+  * @note   The value is given by __HAL_UART_BRR_SAMPLING16(), __HAL_UART_BRR_SAMPLING8() or
+  *         __HAL_UART_BRR_LPUART() according to the instance and the oversampling mode, with the
+  *         kernel clock frequency. Init.BaudRate is not updated.
+  * @param huart UART handle.
+  * @param BRR   BRR register value.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UARTEx_SetBRR(UART_HandleTypeDef *huart, uint32_t BRR)
+{
+  uint32_t tmpcr1;
+
+  if (!IS_UART_BRR(huart->Instance, BRR))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Process Locked */
+  __HAL_LOCK(huart);
+
+  huart->gState = HAL_UART_STATE_BUSY;
+
+  /* Save actual UART configuration */
+  tmpcr1 = READ_REG(huart->Instance->CR1);
+
+  /* Disable UART */
+  __HAL_UART_DISABLE(huart);
+
+  huart->Instance->BRR = BRR;
+
+  /* Restore UART configuration */
+  WRITE_REG(huart->Instance->CR1, tmpcr1);
+
+  huart->gState = HAL_UART_STATE_READY;
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(huart);
+
+  return HAL_OK;
+}
+
 
 /**
   * @}
@@ -48,6 +48,7 @@
 #define HAL_DMA_MODULE_ENABLED
 #define HAL_DMA2D_MODULE_ENABLED
 #define HAL_DSI_MODULE_ENABLED
+#define HAL_EEPROM_EMUL_MODULE_ENABLED
 #define HAL_EXTI_MODULE_ENABLED
 #define HAL_FIREWALL_MODULE_ENABLED
 #define HAL_FLASH_MODULE_ENABLED
@@ -179,6 +180,8 @@
 #define  VDD_VALUE                    3300U /*!< Value of VDD in mv */
 #define  TICK_INT_PRIORITY            0x0FU /*!< tick interrupt priority */
 #define  USE_RTOS                     0U
+#define  USE_HAL_ATOMIC_LOCK          0U /*!< 1: handle lock safe between interrupt and thread */
+#define  USE_HAL_NO_LOCK              0U /*!< 1: handle lock compiled out, single context only */
 #define  PREFETCH_ENABLE              0U
 #define  INSTRUCTION_CACHE_ENABLE     1U
 #define  DATA_CACHE_ENABLE            1U
@@ -244,6 +247,15 @@
 
 #define USE_SPI_CRC                   1U
 
+/* ################## DMA peripheral configuration ########################## */
+
+/* STATISTICS FEATURE: Use to activate transfer statistics inside HAL DMA Driver
+ * Activated: each DMA handle records transfer counters and DWT cycle timestamps
+ * Deactivated: statistics code cleaned from driver
+ */
+
+#define USE_HAL_DMA_STATISTICS        0U
+
 /* Includes ------------------------------------------------------------------*/
 /**
   * @brief Include module's header file
@@ -325,6 +337,10 @@
   #include "stm32l4xx_hal_flash.h"
 #endif /* HAL_FLASH_MODULE_ENABLED */
 
+#ifdef HAL_EEPROM_EMUL_MODULE_ENABLED
+  #include "stm32l4xx_hal_eeprom_emul.h"
+#endif /* HAL_EEPROM_EMUL_MODULE_ENABLED */
+
 #ifdef HAL_HASH_MODULE_ENABLED
   #include "stm32l4xx_hal_hash.h"
 #endif /* HAL_HASH_MODULE_ENABLED */
@@ -62,6 +62,33 @@ typedef struct
                            This parameter can be a value of @ref PWREx_PVM_Mode. */
 }PWR_PVMTypeDef;
 
+/**
+  * @brief  PWR checkpoint register set structure definition
+  */
+typedef struct
+{
+  uint32_t Address;   /*!< Address of the first 32-bit word of the set: peripheral register or HAL handle.
+                           This parameter must be a multiple of 4. */
+
+  uint32_t Count;     /*!< Number of consecutive 32-bit words of the set. */
+}PWR_CheckpointSetTypeDef;
+
+/**
+  * @brief  PWR checkpoint structure definition
+  */
+typedef struct
+{
+  const PWR_CheckpointSetTypeDef *pSets;  /*!< Register sets saved in order and restored in the same order. */
+
+  uint32_t NbSets;                         /*!< Number of register sets of pSets. */
+
+  uint32_t *pStorage;                      /*!< Checkpoint storage, located in a RAM retained in the low-power mode
+                                                (SRAM2 for Standby mode). */
+
+  uint32_t StorageSize;                    /*!< Size in 32-bit words of pStorage, at least
+                                                PWR_CHECKPOINT_STORAGE_SIZE() of the sets words. */
+}PWR_CheckpointTypeDef;
+
 /**
   * @}
   */
@@ -296,6 +323,20 @@ typedef struct
   * @}
   */
 
+/** @defgroup PWREx_Checkpoint PWR checkpoint storage
+  * @{
+  */
+#define PWR_CHECKPOINT_HEADER_SIZE     3U                 /*!< Words of the storage used by the checkpoint header */
+
+/** @brief  Storage size in 32-bit words of a checkpoint.
+  * @param  __WORDS__ Sum of the Count of the checkpoint register sets.
+  * @retval Storage size in 32-bit words
+  */
+#define PWR_CHECKPOINT_STORAGE_SIZE(__WORDS__)  ((__WORDS__) + PWR_CHECKPOINT_HEADER_SIZE)
+/**
+  * @}
+  */
+
 /**
   * @}
   */
@@ -896,6 +937,11 @@ void HAL_PWREx_EnterSTOP1Mode(uint8_t STOPEntry);
 void HAL_PWREx_EnterSTOP2Mode(uint8_t STOPEntry);
 void HAL_PWREx_EnterSHUTDOWNMode(void);
 
+/* Checkpoint functions *******************************************************/
+HAL_StatusTypeDef HAL_PWREx_SaveCheckpoint(const PWR_CheckpointTypeDef *pCheckpoint);
+HAL_StatusTypeDef HAL_PWREx_RestoreCheckpoint(const PWR_CheckpointTypeDef *pCheckpoint);
+void HAL_PWREx_InvalidateCheckpoint(const PWR_CheckpointTypeDef *pCheckpoint);
+
 void HAL_PWREx_PVD_PVM_IRQHandler(void);
 #if defined(PWR_CR2_PVME1)
 void HAL_PWREx_PVM1Callback(void);
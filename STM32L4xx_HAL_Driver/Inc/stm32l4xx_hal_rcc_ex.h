@@ -321,6 +321,41 @@ typedef struct
 }RCC_CRSSynchroInfoTypeDef;
 
 #endif /* CRS */
+
+/**
+  * @brief  RCC operating point structure definition: regulator voltage range and
+  *         system clock applied together by HAL_RCCEx_SetOperatingPoint()
+  */
+typedef struct
+{
+  uint32_t VoltageScaling;    /*!< The regulator voltage range.
+                                   This parameter must be a value of @ref PWREx_Regulator_Voltage_Scale */
+
+  uint32_t SYSCLKSource;      /*!< The system clock source: RCC_SYSCLKSOURCE_MSI, or RCC_SYSCLKSOURCE_PLLCLK
+                                   with the main PLL clocked by MSI */
+
+  uint32_t MSIRange;          /*!< The MSI range, system clock or PLL input.
+                                   This parameter must be a value of @ref RCC_MSI_Clock_Range */
+
+  uint32_t PLLM;              /*!< PLLM: division factor for the PLL input clock, used with RCC_SYSCLKSOURCE_PLLCLK.
+                                   This parameter must be a value of @ref RCC_PLLM_Clock_Divider */
+
+  uint32_t PLLN;              /*!< PLLN: multiplication factor for the PLL VCO, used with RCC_SYSCLKSOURCE_PLLCLK.
+                                   This parameter must be a number between Min_Data = 8 and Max_Data = 86 */
+
+  uint32_t PLLR;              /*!< PLLR: division factor for the main system clock, used with RCC_SYSCLKSOURCE_PLLCLK.
+                                   This parameter must be a value of @ref RCC_PLLR_Clock_Divider */
+
+  uint32_t AHBCLKDivider;     /*!< The AHB clock (HCLK) divider.
+                                   This parameter can be a value of @ref RCC_AHB_Clock_Source */
+
+  uint32_t APB1CLKDivider;    /*!< The APB1 clock (PCLK1) divider.
+                                   This parameter can be a value of @ref RCC_APB1_APB2_Clock_Source */
+
+  uint32_t APB2CLKDivider;    /*!< The APB2 clock (PCLK2) divider.
+                                   This parameter can be a value of @ref RCC_APB1_APB2_Clock_Source */
+}RCC_OperatingPointTypeDef;
+
 /**
   * @}
   */
@@ -330,6 +365,33 @@ typedef struct
   * @{
   */
 
+/** @defgroup RCCEx_Performance_Level Performance Level
+  * @brief    Predefined operating points, all clocked from MSI 4 MHz
+  * @{
+  */
+#define RCC_PERF_LEVEL_0               0U   /*!< MSI 4 MHz, voltage range 2                         */
+#define RCC_PERF_LEVEL_1               1U   /*!< PLL 26 MHz, voltage range 2                        */
+#define RCC_PERF_LEVEL_2               2U   /*!< PLL 80 MHz, voltage range 1                        */
+#if defined(PWR_CR5_R1MODE)
+#define RCC_PERF_LEVEL_3               3U   /*!< PLL 120 MHz, voltage range 1 boost                 */
+#define RCC_PERF_LEVEL_MAX             RCC_PERF_LEVEL_3
+#else
+#define RCC_PERF_LEVEL_MAX             RCC_PERF_LEVEL_2
+#endif /* PWR_CR5_R1MODE */
+/**
+  * @}
+  */
+
+/** @defgroup RCCEx_Performance_Governor_Thresholds Performance Governor Thresholds
+  * @brief    CPU load thresholds, in percent, of HAL_RCCEx_PerformanceGovernor()
+  * @{
+  */
+#define RCC_PERF_LOAD_HIGH             80U  /*!< Above this load, the next level up is selected     */
+#define RCC_PERF_LOAD_LOW              30U  /*!< Below this load, the next level down is selected   */
+/**
+  * @}
+  */
+
 /** @defgroup RCCEx_LSCO_Clock_Source Low Speed Clock Source
   * @{
   */
@@ -2489,6 +2551,20 @@ void              HAL_RCCEx_CRS_ErrorCallback(uint32_t Error);
 
 #endif /* CRS */
 
+/** @addtogroup RCCEx_Exported_Functions_Group4
+  * @{
+  */
+
+HAL_StatusTypeDef HAL_RCCEx_SetOperatingPoint(const RCC_OperatingPointTypeDef *pOperatingPoint);
+HAL_StatusTypeDef HAL_RCCEx_SetPerformanceLevel(uint32_t Level);
+uint32_t          HAL_RCCEx_GetPerformanceLevel(void);
+HAL_StatusTypeDef HAL_RCCEx_PerformanceGovernor(uint32_t LoadPercent);
+void              HAL_RCCEx_PerformanceLevelCallback(uint32_t Level);
+
+/**
+  * @}
+  */
+
 /**
   * @}
   */
@@ -3182,6 +3258,8 @@ void              HAL_RCCEx_CRS_ErrorCallback(uint32_t Error);
 
 #endif /* CRS */
 
+#define IS_RCC_PERF_LEVEL(__LEVEL__)       ((__LEVEL__) <= RCC_PERF_LEVEL_MAX)
+
 /**
   * @}
   */
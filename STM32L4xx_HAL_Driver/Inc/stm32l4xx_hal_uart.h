@@ -204,6 +204,26 @@ typedef enum
   */
 typedef uint32_t HAL_UART_RxTypeTypeDef;
 
+/**
+  * @brief  UART Rx ring buffer structure definition
+  * @note   Head is only written by the driver and Tail only by the reader, so the
+  *         ring can be drained from thread context without disabling interrupts.
+  *         Both indexes are free running, the position in pBuffer is (index & Mask).
+  */
+typedef struct
+{
+  uint8_t                       *pBuffer;         /*!< Ring storage, owned by the application              */
+
+  uint32_t                      Mask;             /*!< Ring size minus one, the size is a power of two      */
+
+  __IO uint32_t                 Head;             /*!< Write index, updated by the driver from the DMA NDTR */
+
+  __IO uint32_t                 Tail;             /*!< Read index, updated by the reader                    */
+
+  __IO uint32_t                 Overrun;          /*!< Count of updates that found the reader overtaken     */
+
+} UART_RingTypeDef;
+
 /**
   * @brief  UART handle Structure definition
   */
@@ -259,6 +279,8 @@ typedef struct __UART_HandleTypeDef
 
   __IO uint32_t                 ErrorCode;           /*!< UART Error code                    */
 
+  UART_RingTypeDef              *pRxRing;            /*!< Rx ring buffer, only set while a ring reception is ongoing */
+
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
   void (* TxHalfCpltCallback)(struct __UART_HandleTypeDef *huart);        /*!< UART Tx Half Complete Callback        */
   void (* TxCpltCallback)(struct __UART_HandleTypeDef *huart);            /*!< UART Tx Complete Callback             */
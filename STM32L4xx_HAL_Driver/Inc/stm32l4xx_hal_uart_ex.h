@@ -156,8 +156,10 @@ void HAL_UARTEx_WakeupCallback(UART_HandleTypeDef *huart);
 #if defined(USART_CR1_FIFOEN)
 void HAL_UARTEx_RxFifoFullCallback(UART_HandleTypeDef *huart);
 void HAL_UARTEx_TxFifoEmptyCallback(UART_HandleTypeDef *huart);
-
 #endif /* USART_CR1_FIFOEN */
+
+void HAL_UARTEx_RingRxEventCallback(UART_HandleTypeDef *huart);
+
 /**
   * @}
   */
@@ -189,6 +191,13 @@ HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle(UART_HandleTypeDef *huart, uint8_t *p
 HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_IT(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size);
 HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_DMA(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size);
 
+HAL_StatusTypeDef HAL_UARTEx_RingReceive_DMA(UART_HandleTypeDef *huart, UART_RingTypeDef *pRing, uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_UARTEx_RingReceive_Stop(UART_HandleTypeDef *huart);
+void              HAL_UARTEx_RingReceive_Update(UART_HandleTypeDef *huart);
+uint32_t          HAL_UARTEx_Ring_GetCount(UART_RingTypeDef *pRing);
+uint32_t          HAL_UARTEx_Ring_GetData(UART_RingTypeDef *pRing, uint8_t **ppData);
+void              HAL_UARTEx_Ring_Release(UART_RingTypeDef *pRing, uint32_t Count);
+
 
 /**
   * @}
@@ -51,10 +51,21 @@
        (+) Use HAL_DMA_Start_IT() to start DMA transfer after the configuration of
            Source address and destination address and the Length of data to be transferred.
            In this case the DMA interrupt is configured
+       (+) Use HAL_DMA_ReArm_IT() to restart a completed transfer with a new memory address and
+           Length of data, without the full reconfiguration done by HAL_DMA_Start_IT()
        (+) Use HAL_DMA_IRQHandler() called under DMA_IRQHandler() Interrupt subroutine
        (+) At the end of data transfer HAL_DMA_IRQHandler() function is executed and user can
               add his own function to register callbacks with HAL_DMA_RegisterCallback().
 
+     *** DMA transfer statistics ***
+     ===============================
+     [..]
+       When USE_HAL_DMA_STATISTICS is set to 1U in the HAL configuration file, each handle
+       counts its transfers, moved bytes, errors and rejected start requests, and samples
+       DWT->CYCCNT at transfer start, interrupt entry and callback exit.
+      (+) HAL_DMA_GetStatistics(): get a pointer to the statistics of the handle
+      (+) HAL_DMA_ResetStatistics(): clear the counters and the maximum delays
+
      *** DMA HAL driver macros list ***
      =============================================
      [..]
@@ -103,6 +114,55 @@
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
 /* Private macro -------------------------------------------------------------*/
+#if defined(USE_HAL_DMA_STATISTICS) && (USE_HAL_DMA_STATISTICS == 1U)
+#define DMA_STATS_START(__HANDLE__, __LENGTH__)                                                              \
+  do{                                                                                                        \
+    (__HANDLE__)->Statistics.XferLength = (uint32_t)(__LENGTH__) <<                                          \
+                                          ((__HANDLE__)->Init.PeriphDataAlignment >> DMA_CCR_PSIZE_Pos);    \
+    (__HANDLE__)->Statistics.StartCycle = DWT->CYCCNT;                                                       \
+  }while(0U)
+
+#define DMA_STATS_BUSY(__HANDLE__)      ((__HANDLE__)->Statistics.BusyCount++)
+
+#define DMA_STATS_IRQ_ENTRY(__HANDLE__) ((__HANDLE__)->Statistics.IrqEntryCycle = DWT->CYCCNT)
+
+/* In circular and double buffer modes the next lap starts with the interrupt */
+#define DMA_STATS_XFER_CPLT(__HANDLE__)                                                                      \
+  do{                                                                                                        \
+    uint32_t xfercycles = (__HANDLE__)->Statistics.IrqEntryCycle - (__HANDLE__)->Statistics.StartCycle;      \
+    (__HANDLE__)->Statistics.XferCount++;                                                                    \
+    (__HANDLE__)->Statistics.XferBytes += (__HANDLE__)->Statistics.XferLength;                               \
+    if(xfercycles > (__HANDLE__)->Statistics.MaxXferCycles)                                                  \
+    {                                                                                                        \
+      (__HANDLE__)->Statistics.MaxXferCycles = xfercycles;                                                   \
+    }                                                                                                        \
+    (__HANDLE__)->Statistics.StartCycle = (__HANDLE__)->Statistics.IrqEntryCycle;                            \
+  }while(0U)
+
+#define DMA_STATS_ERROR(__HANDLE__)                                                                          \
+  do{                                                                                                        \
+    (__HANDLE__)->Statistics.ErrorCount++;                                                                   \
+    (__HANDLE__)->Statistics.ErrorFlags |= (__HANDLE__)->ErrorCode;                                          \
+  }while(0U)
+
+#define DMA_STATS_IRQ_EXIT(__HANDLE__)                                                                       \
+  do{                                                                                                        \
+    uint32_t irqcycles;                                                                                      \
+    (__HANDLE__)->Statistics.CallbackExitCycle = DWT->CYCCNT;                                                \
+    irqcycles = (__HANDLE__)->Statistics.CallbackExitCycle - (__HANDLE__)->Statistics.IrqEntryCycle;         \
+    if(irqcycles > (__HANDLE__)->Statistics.MaxIrqCycles)                                                    \
+    {                                                                                                        \
+      (__HANDLE__)->Statistics.MaxIrqCycles = irqcycles;                                                     \
+    }                                                                                                        \
+  }while(0U)
+#else
+#define DMA_STATS_START(__HANDLE__, __LENGTH__)
+#define DMA_STATS_BUSY(__HANDLE__)
+#define DMA_STATS_IRQ_ENTRY(__HANDLE__)
+#define DMA_STATS_XFER_CPLT(__HANDLE__)
+#define DMA_STATS_ERROR(__HANDLE__)
+#define DMA_STATS_IRQ_EXIT(__HANDLE__)
+#endif /* USE_HAL_DMA_STATISTICS */
 /* Private variables ---------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
 /** @defgroup DMA_Private_Functions DMA Private Functions
@@ -449,6 +509,8 @@ HAL_StatusTypeDef HAL_DMA_Start(DMA_HandleTypeDef *hdma, uint32_t SrcAddress, ui
     /* Configure the source, destination address and the data length & clear flags*/
     DMA_SetConfig(hdma, SrcAddress, DstAddress, DataLength);
 
+    DMA_STATS_START(hdma, DataLength);
+
     /* Enable the Peripheral */
     __HAL_DMA_ENABLE(hdma);
   }
@@ -456,6 +518,10 @@ HAL_StatusTypeDef HAL_DMA_Start(DMA_HandleTypeDef *hdma, uint32_t SrcAddress, ui
   {
     /* Process Unlocked */
     __HAL_UNLOCK(hdma);
+
+    /* Account the rejected start request */
+    DMA_STATS_BUSY(hdma);
+
     status = HAL_BUSY;
   }
   return status;
@@ -492,6 +558,8 @@ HAL_StatusTypeDef HAL_DMA_Start_IT(DMA_HandleTypeDef *hdma, uint32_t SrcAddress,
     /* Configure the source, destination address and the data length & clear flags*/
     DMA_SetConfig(hdma, SrcAddress, DstAddress, DataLength);
 
+    DMA_STATS_START(hdma, DataLength);
+
     /* Enable the transfer complete interrupt */
     /* Enable the transfer Error interrupt */
     if(NULL != hdma->XferHalfCpltCallback )
@@ -531,12 +599,85 @@ HAL_StatusTypeDef HAL_DMA_Start_IT(DMA_HandleTypeDef *hdma, uint32_t SrcAddress,
     /* Process Unlocked */
     __HAL_UNLOCK(hdma);
 
+    /* Account the rejected start request */
+    DMA_STATS_BUSY(hdma);
+
     /* Remain BUSY */
     status = HAL_BUSY;
   }
   return status;
 }
 
+/**
+  * @brief  Re-arms the DMA Transfer with interrupt enabled, keeping the
+  *         configuration of the previous HAL_DMA_Start_IT() call.
+  * @note   Only the memory address and the data length are written: the peripheral
+  *         address, the direction and all the other channel settings must still be
+  *         valid. The previous transfer must be completed (DMA state ready), so
+  *         circular mode is not supported.
+  * @note   Cycle budget: besides the handle lock and state updates, 3 register
+  *         writes (flag clear, CMAR, CNDTR), one more for the DMAMUX flag clear on
+  *         devices with DMAMUX, and two read-modify-writes of CCR, that is about
+  *         30 CPU cycles with zero wait state accesses.
+  * @param  hdma pointer to a DMA_HandleTypeDef structure that contains
+  *               the configuration information for the specified DMA Channel.
+  * @param  MemAddress The memory Buffer address
+  * @param  DataLength The length of data to be transferred
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DMA_ReArm_IT(DMA_HandleTypeDef *hdma, uint32_t MemAddress, uint32_t DataLength)
+{
+  uint32_t itflags = DMA_IT_TC | DMA_IT_TE;
+
+  /* Process locked */
+  __HAL_LOCK(hdma);
+
+  if(HAL_DMA_STATE_READY != hdma->State)
+  {
+    /* Process unlocked */
+    __HAL_UNLOCK(hdma);
+
+    /* Account the rejected start request */
+    DMA_STATS_BUSY(hdma);
+
+    /* Return error status */
+    return HAL_BUSY;
+  }
+
+  /* Change DMA peripheral state */
+  hdma->State = HAL_DMA_STATE_BUSY;
+
+  /* Initialize the error code */
+  hdma->ErrorCode = HAL_DMA_ERROR_NONE;
+
+  DMA_STATS_START(hdma, DataLength);
+
+  /* The channel stays enabled at the end of a transfer */
+  __HAL_DMA_DISABLE(hdma);
+
+#if defined(DMAMUX1)
+  /* Clear the DMAMUX synchro overrun flag */
+  hdma->DMAmuxChannelStatus->CFR = hdma->DMAmuxChannelStatusMask;
+#endif /* DMAMUX1 */
+
+  /* Clear all flags */
+  hdma->DmaBaseAddress->IFCR = (DMA_ISR_GIF1 << (hdma->ChannelIndex & 0x1CU));
+
+  /* Configure DMA Channel memory address and data length */
+  hdma->Instance->CMAR = MemAddress;
+  hdma->Instance->CNDTR = DataLength;
+
+  if(NULL != hdma->XferHalfCpltCallback)
+  {
+    itflags |= DMA_IT_HT;
+  }
+
+  /* Enable the interrupts disabled at the end of the previous transfer and the Peripheral */
+  MODIFY_REG(hdma->Instance->CCR, DMA_IT_HT, itflags | DMA_CCR_EN);
+
+  return HAL_OK;
+}
+
 /**
   * @brief  Abort the DMA Transfer.
   * @param  hdma pointer to a DMA_HandleTypeDef structure that contains
@@ -664,6 +805,22 @@ HAL_StatusTypeDef HAL_DMA_Abort_IT(DMA_HandleTypeDef *hdma)
   return status;
 }
 
+/**
+  * @brief  Aborts the DMA transfer started by HAL_DMA_Direct_Start().
+  * @note   The channel is disabled at once. No lock and no handle state update are
+  *         done.
+  * @param  hdma  pointer to a DMA_HandleTypeDef structure that contains
+  *               the configuration information for the specified DMA Channel.
+  * @retval HAL status, always HAL_OK: the status is returned for the prototype to be
+  *         the same as on the families where the abort waits for the controller
+  */
+HAL_StatusTypeDef HAL_DMA_Direct_Abort(DMA_HandleTypeDef *hdma)
+{
+  hdma->Instance->CCR &= ~DMA_CCR_EN;
+
+  return HAL_OK;
+}
+
 /**
   * @brief  Polling for transfer complete.
   * @param  hdma pointer to a DMA_HandleTypeDef structure that contains
@@ -807,6 +964,8 @@ void HAL_DMA_IRQHandler(DMA_HandleTypeDef *hdma)
   uint32_t flag_it = hdma->DmaBaseAddress->ISR;
   uint32_t source_it = hdma->Instance->CCR;
 
+  DMA_STATS_IRQ_ENTRY(hdma);
+
   /* Half Transfer Complete Interrupt management ******************************/
   if (((flag_it & (DMA_FLAG_HT1 << (hdma->ChannelIndex & 0x1CU))) != 0U) && ((source_it & DMA_IT_HT) != 0U))
   {
@@ -845,6 +1004,8 @@ void HAL_DMA_IRQHandler(DMA_HandleTypeDef *hdma)
     /* Clear the transfer complete flag */
     hdma->DmaBaseAddress->IFCR = (DMA_ISR_TCIF1 << (hdma->ChannelIndex & 0x1CU));
 
+    DMA_STATS_XFER_CPLT(hdma);
+
     /* Process Unlocked */
     __HAL_UNLOCK(hdma);
 
@@ -869,6 +1030,8 @@ void HAL_DMA_IRQHandler(DMA_HandleTypeDef *hdma)
     /* Update error code */
     hdma->ErrorCode = HAL_DMA_ERROR_TE;
 
+    DMA_STATS_ERROR(hdma);
+
     /* Change the DMA state */
     hdma->State = HAL_DMA_STATE_READY;
 
@@ -885,6 +1048,8 @@ void HAL_DMA_IRQHandler(DMA_HandleTypeDef *hdma)
   {
     /* Nothing To Do */
   }
+
+  DMA_STATS_IRQ_EXIT(hdma);
   return;
 }
 
@@ -1044,6 +1209,42 @@ uint32_t HAL_DMA_GetError(DMA_HandleTypeDef *hdma)
   return hdma->ErrorCode;
 }
 
+#if defined(USE_HAL_DMA_STATISTICS) && (USE_HAL_DMA_STATISTICS == 1U)
+/**
+  * @brief  Return the transfer statistics of the DMA handle
+  * @param  hdma : pointer to a DMA_HandleTypeDef structure that contains
+  *              the configuration information for the specified DMA Channel.
+  * @note   The counters are updated by HAL_DMA_Start(), HAL_DMA_Start_IT(),
+  *         HAL_DMA_ReArm_IT() and HAL_DMA_IRQHandler(): they are read without
+  *         locking, a consistent snapshot requires the DMA interrupt to be masked.
+  * @retval Pointer to the statistics structure embedded in the handle
+  */
+const DMA_StatisticsTypeDef *HAL_DMA_GetStatistics(const DMA_HandleTypeDef *hdma)
+{
+  return &hdma->Statistics;
+}
+
+/**
+  * @brief  Reset the transfer statistics of the DMA handle
+  * @param  hdma : pointer to a DMA_HandleTypeDef structure that contains
+  *              the configuration information for the specified DMA Channel.
+  * @retval None
+  */
+void HAL_DMA_ResetStatistics(DMA_HandleTypeDef *hdma)
+{
+  /* XferLength and StartCycle describe the transfer in progress and are kept */
+  hdma->Statistics.XferCount         = 0U;
+  hdma->Statistics.XferBytes         = 0U;
+  hdma->Statistics.ErrorCount        = 0U;
+  hdma->Statistics.ErrorFlags        = HAL_DMA_ERROR_NONE;
+  hdma->Statistics.BusyCount         = 0U;
+  hdma->Statistics.IrqEntryCycle     = 0U;
+  hdma->Statistics.CallbackExitCycle = 0U;
+  hdma->Statistics.MaxXferCycles     = 0U;
+  hdma->Statistics.MaxIrqCycles      = 0U;
+}
+#endif /* USE_HAL_DMA_STATISTICS */
+
 /**
   * @}
   */
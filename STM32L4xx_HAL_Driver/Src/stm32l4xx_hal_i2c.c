@@ -1846,7 +1846,8 @@ HAL_StatusTypeDef HAL_I2C_Master_Transmit_DMA(I2C_HandleTypeDef *hi2c, uint16_t
         hi2c->hdmatx->XferAbortCallback = NULL;
 
         /* Enable the DMA channel */
-        dmaxferstatus = HAL_DMA_Start_IT(hi2c->hdmatx, (uint32_t)pData, (uint32_t)&hi2c->Instance->TXDR, hi2c->XferSize);
+        dmaxferstatus = HAL_DMA_Start_IT(hi2c->hdmatx, (uint32_t)pData, (uint32_t)&hi2c->Instance->TXDR,
+                                         hi2c->XferCount);
       }
       else
       {
@@ -1881,6 +1882,13 @@ HAL_StatusTypeDef HAL_I2C_Master_Transmit_DMA(I2C_HandleTypeDef *hi2c, uint16_t
         /* Enable ERR and NACK interrupts */
         I2C_Enable_IRQ(hi2c, I2C_XFER_ERROR_IT);
 
+        /* The DMA covers the whole buffer, only the NBYTES reloads are done on TCR event */
+        if (hi2c->XferCount != 0U)
+        {
+          /* Enable TC interrupts */
+          I2C_Enable_IRQ(hi2c, I2C_XFER_RELOAD_IT);
+        }
+
         /* Enable DMA Request */
         hi2c->Instance->CR1 |= I2C_CR1_TXDMAEN;
       }
@@ -1990,7 +1998,8 @@ HAL_StatusTypeDef HAL_I2C_Master_Receive_DMA(I2C_HandleTypeDef *hi2c, uint16_t D
         hi2c->hdmarx->XferAbortCallback = NULL;
 
         /* Enable the DMA channel */
-        dmaxferstatus = HAL_DMA_Start_IT(hi2c->hdmarx, (uint32_t)&hi2c->Instance->RXDR, (uint32_t)pData, hi2c->XferSize);
+        dmaxferstatus = HAL_DMA_Start_IT(hi2c->hdmarx, (uint32_t)&hi2c->Instance->RXDR, (uint32_t)pData,
+                                         hi2c->XferCount);
       }
       else
       {
@@ -2025,6 +2034,13 @@ HAL_StatusTypeDef HAL_I2C_Master_Receive_DMA(I2C_HandleTypeDef *hi2c, uint16_t D
         /* Enable ERR and NACK interrupts */
         I2C_Enable_IRQ(hi2c, I2C_XFER_ERROR_IT);
 
+        /* The DMA covers the whole buffer, only the NBYTES reloads are done on TCR event */
+        if (hi2c->XferCount != 0U)
+        {
+          /* Enable TC interrupts */
+          I2C_Enable_IRQ(hi2c, I2C_XFER_RELOAD_IT);
+        }
+
         /* Enable DMA Request */
         hi2c->Instance->CR1 |= I2C_CR1_RXDMAEN;
       }
@@ -2813,7 +2829,8 @@ HAL_StatusTypeDef HAL_I2C_Mem_Write_DMA(I2C_HandleTypeDef *hi2c, uint16_t DevAdd
       hi2c->hdmatx->XferAbortCallback = NULL;
 
       /* Enable the DMA channel */
-      dmaxferstatus = HAL_DMA_Start_IT(hi2c->hdmatx, (uint32_t)pData, (uint32_t)&hi2c->Instance->TXDR, hi2c->XferSize);
+      dmaxferstatus = HAL_DMA_Start_IT(hi2c->hdmatx, (uint32_t)pData, (uint32_t)&hi2c->Instance->TXDR,
+                                       hi2c->XferCount);
     }
     else
     {
@@ -2848,6 +2865,13 @@ HAL_StatusTypeDef HAL_I2C_Mem_Write_DMA(I2C_HandleTypeDef *hi2c, uint16_t DevAdd
       /* Enable ERR and NACK interrupts */
       I2C_Enable_IRQ(hi2c, I2C_XFER_ERROR_IT);
 
+      /* The DMA covers the whole buffer, only the NBYTES reloads are done on TCR event */
+      if (hi2c->XferCount != 0U)
+      {
+        /* Enable TC interrupts */
+        I2C_Enable_IRQ(hi2c, I2C_XFER_RELOAD_IT);
+      }
+
       /* Enable DMA Request */
       hi2c->Instance->CR1 |= I2C_CR1_TXDMAEN;
     }
@@ -2957,7 +2981,8 @@ HAL_StatusTypeDef HAL_I2C_Mem_Read_DMA(I2C_HandleTypeDef *hi2c, uint16_t DevAddr
       hi2c->hdmarx->XferAbortCallback = NULL;
 
       /* Enable the DMA channel */
-      dmaxferstatus = HAL_DMA_Start_IT(hi2c->hdmarx, (uint32_t)&hi2c->Instance->RXDR, (uint32_t)pData, hi2c->XferSize);
+      dmaxferstatus = HAL_DMA_Start_IT(hi2c->hdmarx, (uint32_t)&hi2c->Instance->RXDR, (uint32_t)pData,
+                                       hi2c->XferCount);
     }
     else
     {
@@ -2991,6 +3016,13 @@ HAL_StatusTypeDef HAL_I2C_Mem_Read_DMA(I2C_HandleTypeDef *hi2c, uint16_t DevAddr
       /* Enable ERR and NACK interrupts */
       I2C_Enable_IRQ(hi2c, I2C_XFER_ERROR_IT);
 
+      /* The DMA covers the whole buffer, only the NBYTES reloads are done on TCR event */
+      if (hi2c->XferCount != 0U)
+      {
+        /* Enable TC interrupts */
+        I2C_Enable_IRQ(hi2c, I2C_XFER_RELOAD_IT);
+      }
+
       /* Enable DMA Request */
       hi2c->Instance->CR1 |= I2C_CR1_RXDMAEN;
     }
@@ -3324,7 +3356,8 @@ HAL_StatusTypeDef HAL_I2C_Master_Seq_Transmit_DMA(I2C_HandleTypeDef *hi2c, uint1
         hi2c->hdmatx->XferAbortCallback = NULL;
 
         /* Enable the DMA channel */
-        dmaxferstatus = HAL_DMA_Start_IT(hi2c->hdmatx, (uint32_t)pData, (uint32_t)&hi2c->Instance->TXDR, hi2c->XferSize);
+        dmaxferstatus = HAL_DMA_Start_IT(hi2c->hdmatx, (uint32_t)pData, (uint32_t)&hi2c->Instance->TXDR,
+                                         hi2c->XferCount);
       }
       else
       {
@@ -3358,6 +3391,13 @@ HAL_StatusTypeDef HAL_I2C_Master_Seq_Transmit_DMA(I2C_HandleTypeDef *hi2c, uint1
         /* Enable ERR and NACK interrupts */
         I2C_Enable_IRQ(hi2c, I2C_XFER_ERROR_IT);
 
+        /* The DMA covers the whole buffer, only the NBYTES reloads are done on TCR event */
+        if (hi2c->XferCount != 0U)
+        {
+          /* Enable TC interrupts */
+          I2C_Enable_IRQ(hi2c, I2C_XFER_RELOAD_IT);
+        }
+
         /* Enable DMA Request */
         hi2c->Instance->CR1 |= I2C_CR1_TXDMAEN;
       }
@@ -3572,7 +3612,8 @@ HAL_StatusTypeDef HAL_I2C_Master_Seq_Receive_DMA(I2C_HandleTypeDef *hi2c, uint16
         hi2c->hdmarx->XferAbortCallback = NULL;
 
         /* Enable the DMA channel */
-        dmaxferstatus = HAL_DMA_Start_IT(hi2c->hdmarx, (uint32_t)&hi2c->Instance->RXDR, (uint32_t)pData, hi2c->XferSize);
+        dmaxferstatus = HAL_DMA_Start_IT(hi2c->hdmarx, (uint32_t)&hi2c->Instance->RXDR, (uint32_t)pData,
+                                         hi2c->XferCount);
       }
       else
       {
@@ -3606,6 +3647,13 @@ HAL_StatusTypeDef HAL_I2C_Master_Seq_Receive_DMA(I2C_HandleTypeDef *hi2c, uint16
         /* Enable ERR and NACK interrupts */
         I2C_Enable_IRQ(hi2c, I2C_XFER_ERROR_IT);
 
+        /* The DMA covers the whole buffer, only the NBYTES reloads are done on TCR event */
+        if (hi2c->XferCount != 0U)
+        {
+          /* Enable TC interrupts */
+          I2C_Enable_IRQ(hi2c, I2C_XFER_RELOAD_IT);
+        }
+
         /* Enable DMA Request */
         hi2c->Instance->CR1 |= I2C_CR1_RXDMAEN;
       }
@@ -4926,9 +4974,6 @@ static HAL_StatusTypeDef I2C_Master_ISR_DMA(struct __I2C_HandleTypeDef *hi2c, ui
   }
   else if ((I2C_CHECK_FLAG(ITFlags, I2C_FLAG_TCR) != RESET) && (I2C_CHECK_IT_SOURCE(ITSources, I2C_IT_TCI) != RESET))
   {
-    /* Disable TC interrupt */
-    __HAL_I2C_DISABLE_IT(hi2c, I2C_IT_TCI);
-
     if (hi2c->XferCount != 0U)
     {
       /* Recover Slave address */
@@ -4953,24 +4998,23 @@ static HAL_StatusTypeDef I2C_Master_ISR_DMA(struct __I2C_HandleTypeDef *hi2c, ui
         }
       }
 
-      /* Set the new XferSize in Nbytes register */
-      I2C_TransferConfig(hi2c, devaddress, (uint8_t)hi2c->XferSize, xfermode, I2C_NO_STARTSTOP);
-
-      /* Update XferCount value */
+      /* Update XferCount value before the reload, the DMA may end as soon as NBYTES is written */
       hi2c->XferCount -= hi2c->XferSize;
 
-      /* Enable DMA Request */
-      if (hi2c->State == HAL_I2C_STATE_BUSY_RX)
+      if (hi2c->XferCount == 0U)
       {
-        hi2c->Instance->CR1 |= I2C_CR1_RXDMAEN;
-      }
-      else
-      {
-        hi2c->Instance->CR1 |= I2C_CR1_TXDMAEN;
+        /* Last reload: TC interrupt is enabled again at end of DMA transfer */
+        __HAL_I2C_DISABLE_IT(hi2c, I2C_IT_TCI);
       }
+
+      /* Set the new XferSize in Nbytes register, the DMA request is kept enabled */
+      I2C_TransferConfig(hi2c, devaddress, (uint8_t)hi2c->XferSize, xfermode, I2C_NO_STARTSTOP);
     }
     else
     {
+      /* Disable TC interrupt */
+      __HAL_I2C_DISABLE_IT(hi2c, I2C_IT_TCI);
+
       /* Call TxCpltCallback() if no stop mode is set */
       if (I2C_GET_STOP_MODE(hi2c) != I2C_AUTOEND_MODE)
       {
@@ -6030,40 +6074,8 @@ static void I2C_DMAMasterTransmitCplt(DMA_HandleTypeDef *hdma)
   /* Disable DMA Request */
   hi2c->Instance->CR1 &= ~I2C_CR1_TXDMAEN;
 
-  /* If last transfer, enable STOP interrupt */
-  if (hi2c->XferCount == 0U)
-  {
-    /* Enable STOP interrupt */
-    I2C_Enable_IRQ(hi2c, I2C_XFER_CPLT_IT);
-  }
-  /* else prepare a new DMA transfer and enable TCReload interrupt */
-  else
-  {
-    /* Update Buffer pointer */
-    hi2c->pBuffPtr += hi2c->XferSize;
-
-    /* Set the XferSize to transfer */
-    if (hi2c->XferCount > MAX_NBYTE_SIZE)
-    {
-      hi2c->XferSize = MAX_NBYTE_SIZE;
-    }
-    else
-    {
-      hi2c->XferSize = hi2c->XferCount;
-    }
-
-    /* Enable the DMA channel */
-    if (HAL_DMA_Start_IT(hi2c->hdmatx, (uint32_t)hi2c->pBuffPtr, (uint32_t)&hi2c->Instance->TXDR, hi2c->XferSize) != HAL_OK)
-    {
-      /* Call the corresponding callback to inform upper layer of End of Transfer */
-      I2C_ITError(hi2c, HAL_I2C_ERROR_DMA);
-    }
-    else
-    {
-      /* Enable TC interrupts */
-      I2C_Enable_IRQ(hi2c, I2C_XFER_RELOAD_IT);
-    }
-  }
+  /* The DMA transfer covers the whole buffer: all the NBYTES reloads are done, enable STOP interrupt */
+  I2C_Enable_IRQ(hi2c, I2C_XFER_CPLT_IT);
 }
 
 /**
@@ -6105,40 +6117,8 @@ static void I2C_DMAMasterReceiveCplt(DMA_HandleTypeDef *hdma)
   /* Disable DMA Request */
   hi2c->Instance->CR1 &= ~I2C_CR1_RXDMAEN;
 
-  /* If last transfer, enable STOP interrupt */
-  if (hi2c->XferCount == 0U)
-  {
-    /* Enable STOP interrupt */
-    I2C_Enable_IRQ(hi2c, I2C_XFER_CPLT_IT);
-  }
-  /* else prepare a new DMA transfer and enable TCReload interrupt */
-  else
-  {
-    /* Update Buffer pointer */
-    hi2c->pBuffPtr += hi2c->XferSize;
-
-    /* Set the XferSize to transfer */
-    if (hi2c->XferCount > MAX_NBYTE_SIZE)
-    {
-      hi2c->XferSize = MAX_NBYTE_SIZE;
-    }
-    else
-    {
-      hi2c->XferSize = hi2c->XferCount;
-    }
-
-    /* Enable the DMA channel */
-    if (HAL_DMA_Start_IT(hi2c->hdmarx, (uint32_t)&hi2c->Instance->RXDR, (uint32_t)hi2c->pBuffPtr, hi2c->XferSize) != HAL_OK)
-    {
-      /* Call the corresponding callback to inform upper layer of End of Transfer */
-      I2C_ITError(hi2c, HAL_I2C_ERROR_DMA);
-    }
-    else
-    {
-      /* Enable TC interrupts */
-      I2C_Enable_IRQ(hi2c, I2C_XFER_RELOAD_IT);
-    }
-  }
+  /* The DMA transfer covers the whole buffer: all the NBYTES reloads are done, enable STOP interrupt */
+  I2C_Enable_IRQ(hi2c, I2C_XFER_CPLT_IT);
 }
 
 /**
@@ -6222,6 +6202,9 @@ static HAL_StatusTypeDef I2C_WaitOnFlagUntilTimeout(I2C_HandleTypeDef *hi2c, uin
 {
   while (__HAL_I2C_GET_FLAG(hi2c, Flag) == Status)
   {
+    /* Let the application yield or sleep while waiting */
+    HAL_WaitHook(HAL_WAIT_I2C, hi2c);
+
     /* Check for the Timeout */
     if (Timeout != HAL_MAX_DELAY)
     {
@@ -6252,6 +6235,9 @@ static HAL_StatusTypeDef I2C_WaitOnTXISFlagUntilTimeout(I2C_HandleTypeDef *hi2c,
 {
   while (__HAL_I2C_GET_FLAG(hi2c, I2C_FLAG_TXIS) == RESET)
   {
+    /* Let the application yield or sleep while waiting */
+    HAL_WaitHook(HAL_WAIT_I2C, hi2c);
+
     /* Check if a NACK is detected */
     if (I2C_IsAcknowledgeFailed(hi2c, Timeout, Tickstart) != HAL_OK)
     {
@@ -6289,6 +6275,9 @@ static HAL_StatusTypeDef I2C_WaitOnSTOPFlagUntilTimeout(I2C_HandleTypeDef *hi2c,
 {
   while (__HAL_I2C_GET_FLAG(hi2c, I2C_FLAG_STOPF) == RESET)
   {
+    /* Let the application yield or sleep while waiting */
+    HAL_WaitHook(HAL_WAIT_I2C, hi2c);
+
     /* Check if a NACK is detected */
     if (I2C_IsAcknowledgeFailed(hi2c, Timeout, Tickstart) != HAL_OK)
     {
@@ -6323,6 +6312,9 @@ static HAL_StatusTypeDef I2C_WaitOnRXNEFlagUntilTimeout(I2C_HandleTypeDef *hi2c,
 {
   while (__HAL_I2C_GET_FLAG(hi2c, I2C_FLAG_RXNE) == RESET)
   {
+    /* Let the application yield or sleep while waiting */
+    HAL_WaitHook(HAL_WAIT_I2C, hi2c);
+
     /* Check if a NACK is detected */
     if (I2C_IsAcknowledgeFailed(hi2c, Timeout, Tickstart) != HAL_OK)
     {
@@ -76,6 +76,17 @@
   * @}
   */
 
+/** @defgroup PWREx_Checkpoint_Header PWR Extended Checkpoint Header
+  * @{
+  */
+#define PWR_CHECKPOINT_MAGIC           ((uint32_t)0x43484B50)  /*!< Marker of a valid checkpoint              */
+#define PWR_CHECKPOINT_MAGIC_POS       0U                      /*!< Storage word of the marker                  */
+#define PWR_CHECKPOINT_WORDS_POS       1U                      /*!< Storage word of the number of saved words   */
+#define PWR_CHECKPOINT_CHECKSUM_POS    2U                      /*!< Storage word of the checksum                */
+/**
+  * @}
+  */
+
 
 
 /**
@@ -87,6 +98,8 @@
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
+static uint32_t PWREx_CheckpointWords(const PWR_CheckpointTypeDef *pCheckpoint);
+static uint32_t PWREx_CheckpointChecksum(const PWR_CheckpointTypeDef *pCheckpoint, uint32_t Words);
 /* Exported functions --------------------------------------------------------*/
 
 /** @defgroup PWREx_Exported_Functions PWR Extended Exported Functions
@@ -101,6 +114,24 @@
               ##### Extended Peripheral Initialization and de-initialization functions #####
  ===============================================================================
     [..]
+    *** Checkpoint of the peripherals state ***
+    ===========================================
+    [..]
+      The state of the peripherals can be saved before entering a low-power
+      mode and restored on wake-up by direct register writes, instead of
+      running again the HAL_xxx_Init() chain.
+      (#) Fill a table of PWR_CheckpointSetTypeDef with the register sets to
+          save: RCC peripheral clock enable registers first, then peripheral
+          configuration registers and the HAL handles to keep if they are not
+          in a retained RAM.
+      (#) Reserve in SRAM2 a storage of PWR_CHECKPOINT_STORAGE_SIZE() words and
+          enable its retention with HAL_PWREx_EnableSRAM2ContentRetention().
+      (#) Call HAL_PWREx_SaveCheckpoint() before HAL_PWR_EnterSTANDBYMode() or
+          HAL_PWREx_EnterSTOP2Mode().
+      (#) On wake-up, after the system clock configuration, call
+          HAL_PWREx_RestoreCheckpoint(). HAL_ERROR means that no valid
+          checkpoint exists (power-on reset, other register sets) and that the
+          full initialization is needed.
 
 @endverbatim
   * @{
@@ -1349,8 +1380,133 @@ void HAL_PWREx_EnterSHUTDOWNMode(void)
   __WFI();
 }
 
+/**
+  * @brief Save a checkpoint of register sets and HAL handles.
+  * @note  To be called just before entering the low-power mode, once the
+  *        peripherals are in the state to restore. The interrupts should be
+  *        disabled so that the saved handles stay consistent.
+  * @note  For Standby mode, pStorage must be located in SRAM2 and the SRAM2
+  *        content retention enabled with HAL_PWREx_EnableSRAM2ContentRetention().
+  * @note  Only read-write configuration registers should be part of the sets:
+  *        status, data and write-1-to-clear registers would be written back
+  *        on restore.
+  * @param pCheckpoint pointer to a PWR_CheckpointTypeDef structure.
+  * @retval HAL status, HAL_ERROR if the storage is too small.
+  */
+HAL_StatusTypeDef HAL_PWREx_SaveCheckpoint(const PWR_CheckpointTypeDef *pCheckpoint)
+{
+  uint32_t words;
+  uint32_t set;
+  uint32_t index;
+  uint32_t pos = PWR_CHECKPOINT_HEADER_SIZE;
+  const __IO uint32_t *preg;
+
+  if(pCheckpoint == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  words = PWREx_CheckpointWords(pCheckpoint);
+  if((pCheckpoint->pStorage == NULL) || (pCheckpoint->StorageSize < PWR_CHECKPOINT_STORAGE_SIZE(words)))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Invalidate the previous checkpoint while the storage is updated */
+  pCheckpoint->pStorage[PWR_CHECKPOINT_MAGIC_POS] = 0U;
+
+  for(set = 0U; set < pCheckpoint->NbSets; set++)
+  {
+    preg = (const __IO uint32_t *)pCheckpoint->pSets[set].Address;
+    for(index = 0U; index < pCheckpoint->pSets[set].Count; index++)
+    {
+      pCheckpoint->pStorage[pos] = preg[index];
+      pos++;
+    }
+  }
+
+  pCheckpoint->pStorage[PWR_CHECKPOINT_WORDS_POS] = words;
+  pCheckpoint->pStorage[PWR_CHECKPOINT_CHECKSUM_POS] = PWREx_CheckpointChecksum(pCheckpoint, words);
+
+  /* The marker is written last: an interrupted save leaves no valid checkpoint */
+  __DMB();
+  pCheckpoint->pStorage[PWR_CHECKPOINT_MAGIC_POS] = PWR_CHECKPOINT_MAGIC;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief Restore a checkpoint saved by HAL_PWREx_SaveCheckpoint().
+  * @note  To be called on wake-up in place of the HAL_xxx_Init() chain. The
+  *        sets are written back directly in the order of pSets: the RCC
+  *        peripheral clock enable registers must come before the peripheral
+  *        registers, and a register enabling a peripheral should be in a set
+  *        of its own after the other registers of the peripheral.
+  * @note  The RCC_CR and RCC_CFGR registers should not be part of the sets:
+  *        the oscillators and the PLL need to be waited for, the system clock
+  *        is restored with HAL_RCC_OscConfig() and HAL_RCC_ClockConfig().
+  * @note  The checkpoint stays valid after the restore, call
+  *        HAL_PWREx_InvalidateCheckpoint() if it must not be used again.
+  * @param pCheckpoint pointer to the PWR_CheckpointTypeDef structure used to
+  *        save the checkpoint.
+  * @retval HAL status, HAL_ERROR if no valid checkpoint matches pCheckpoint (for
+  *         instance after a power-on reset): the full initialization is needed.
+  */
+HAL_StatusTypeDef HAL_PWREx_RestoreCheckpoint(const PWR_CheckpointTypeDef *pCheckpoint)
+{
+  uint32_t words;
+  uint32_t set;
+  uint32_t index;
+  uint32_t pos = PWR_CHECKPOINT_HEADER_SIZE;
+  __IO uint32_t *preg;
+
+  if((pCheckpoint == NULL) || (pCheckpoint->pStorage == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  if(pCheckpoint->pStorage[PWR_CHECKPOINT_MAGIC_POS] != PWR_CHECKPOINT_MAGIC)
+  {
+    return HAL_ERROR;
+  }
+
+  /* The register sets must be the ones of the saved checkpoint */
+  words = PWREx_CheckpointWords(pCheckpoint);
+  if((pCheckpoint->StorageSize < PWR_CHECKPOINT_STORAGE_SIZE(words)) ||
+     (pCheckpoint->pStorage[PWR_CHECKPOINT_WORDS_POS] != words) ||
+     (pCheckpoint->pStorage[PWR_CHECKPOINT_CHECKSUM_POS] != PWREx_CheckpointChecksum(pCheckpoint, words)))
+  {
+    return HAL_ERROR;
+  }
+
+  for(set = 0U; set < pCheckpoint->NbSets; set++)
+  {
+    preg = (__IO uint32_t *)pCheckpoint->pSets[set].Address;
+    for(index = 0U; index < pCheckpoint->pSets[set].Count; index++)
+    {
+      preg[index] = pCheckpoint->pStorage[pos];
+      pos++;
+    }
+  }
 
+  /* Complete the register writes before the peripherals are used */
+  __DSB();
 
+  return HAL_OK;
+}
+
+/**
+  * @brief Invalidate the checkpoint saved in the storage of pCheckpoint.
+  * @param pCheckpoint pointer to a PWR_CheckpointTypeDef structure.
+  * @retval None
+  */
+void HAL_PWREx_InvalidateCheckpoint(const PWR_CheckpointTypeDef *pCheckpoint)
+{
+  if((pCheckpoint != NULL) && (pCheckpoint->pStorage != NULL))
+  {
+    pCheckpoint->pStorage[PWR_CHECKPOINT_MAGIC_POS] = 0U;
+  }
+}
 
 /**
   * @brief This function handles the PWR PVD/PVMx interrupt request.
@@ -1461,6 +1617,59 @@ __weak void HAL_PWREx_PVM4Callback(void)
   * @}
   */
 
+/**
+  * @}
+  */
+
+/** @defgroup PWREx_Private_Functions PWR Extended Private Functions
+  * @{
+  */
+
+/**
+  * @brief Get the number of 32-bit words of the checkpoint register sets.
+  * @param pCheckpoint pointer to a PWR_CheckpointTypeDef structure.
+  * @retval Number of words
+  */
+static uint32_t PWREx_CheckpointWords(const PWR_CheckpointTypeDef *pCheckpoint)
+{
+  uint32_t words = 0U;
+  uint32_t set;
+
+  for(set = 0U; set < pCheckpoint->NbSets; set++)
+  {
+    words += pCheckpoint->pSets[set].Count;
+  }
+
+  return words;
+}
+
+/**
+  * @brief Compute the checksum of the checkpoint storage and register sets.
+  * @note  The set addresses are part of the checksum so that a checkpoint
+  *        saved with other register sets is not restored.
+  * @param pCheckpoint pointer to a PWR_CheckpointTypeDef structure.
+  * @param Words number of saved words.
+  * @retval Checksum
+  */
+static uint32_t PWREx_CheckpointChecksum(const PWR_CheckpointTypeDef *pCheckpoint, uint32_t Words)
+{
+  uint32_t checksum = PWR_CHECKPOINT_MAGIC;
+  uint32_t index;
+
+  for(index = 0U; index < pCheckpoint->NbSets; index++)
+  {
+    checksum = ((checksum << 5U) | (checksum >> 27U)) ^ pCheckpoint->pSets[index].Address;
+    checksum = ((checksum << 5U) | (checksum >> 27U)) ^ pCheckpoint->pSets[index].Count;
+  }
+
+  for(index = 0U; index < Words; index++)
+  {
+    checksum = ((checksum << 5U) | (checksum >> 27U)) ^ pCheckpoint->pStorage[PWR_CHECKPOINT_HEADER_SIZE + index];
+  }
+
+  return checksum;
+}
+
 /**
   * @}
   */
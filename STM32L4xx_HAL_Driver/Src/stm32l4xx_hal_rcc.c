@@ -79,6 +79,15 @@
 #define HSI48_TIMEOUT_VALUE        2U    /* 2 ms (minimum Tick + 1) */
 #define PLL_TIMEOUT_VALUE          2U    /* 2 ms (minimum Tick + 1) */
 #define CLOCKSWITCH_TIMEOUT_VALUE  5000U /* 5 s    */
+#define RCC_RESTORE_TIMEOUT_LOOPS  0x00100000U /* Polling loops, about 0.5 s at 16 MHz */
+#if defined(STM32L4P5xx) || defined(STM32L4Q5xx) || \
+    defined(STM32L4R5xx) || defined(STM32L4R7xx) || defined(STM32L4R9xx) || defined(STM32L4S5xx) || defined(STM32L4S7xx) || defined(STM32L4S9xx)
+#define RCC_FLASH_RANGE1_WS_FREQ   20000000U /* Max HCLK per wait state in range 1    */
+#define RCC_FLASH_RANGE2_WS_MAX    FLASH_LATENCY_2
+#else
+#define RCC_FLASH_RANGE1_WS_FREQ   16000000U /* Max HCLK per wait state in range 1    */
+#define RCC_FLASH_RANGE2_WS_MAX    FLASH_LATENCY_3
+#endif
 /**
   * @}
   */
@@ -104,10 +113,9 @@
   * @{
   */
 static HAL_StatusTypeDef RCC_SetFlashLatencyFromMSIRange(uint32_t msirange);
-#if defined(STM32L4P5xx) || defined(STM32L4Q5xx) || \
-    defined(STM32L4R5xx) || defined(STM32L4R7xx) || defined(STM32L4R9xx) || defined(STM32L4S5xx) || defined(STM32L4S7xx) || defined(STM32L4S9xx)
 static uint32_t          RCC_GetSysClockFreqFromPLLSource(void);
-#endif
+static uint32_t          RCC_GetMSIFreq(void);
+static HAL_StatusTypeDef RCC_WaitBitLoop(__IO uint32_t *Reg, uint32_t Mask, uint32_t Value);
 /**
   * @}
   */
@@ -208,6 +216,12 @@ static uint32_t          RCC_GetSysClockFreqFromPLLSource(void);
              The clock source frequency should be adapted depending on the device voltage range
              as listed in the Reference Manual "Clock source frequency versus voltage scaling" chapter.
 
+         (+) HAL_RCC_ClockConfigAuto() configures the busses clocks like HAL_RCC_ClockConfig()
+             but programs the minimum number of flash wait states allowed by the target HCLK
+             and the current voltage range (see tables below), and enables the ART accelerator
+             (instruction and data caches) and the prefetch buffer when it is effective.
+             HAL_RCC_GetOptimalFlashLatency() returns this number of wait states.
+
   @endverbatim
 
            Table 1. HCLK clock frequency for other STM32L4 devices
@@ -1289,6 +1303,135 @@ HAL_StatusTypeDef HAL_RCC_ClockConfig(RCC_ClkInitTypeDef  *RCC_ClkInitStruct, ui
   return status;
 }
 
+/**
+  * @brief  Initialize the CPU, AHB and APB busses clocks according to the specified
+  *         parameters in the RCC_ClkInitStruct, with the minimum FLASH latency.
+  * @param  RCC_ClkInitStruct  pointer to an RCC_OscInitTypeDef structure that
+  *         contains the configuration information for the RCC peripheral.
+  * @note   The FLASH latency is computed by HAL_RCC_GetOptimalFlashLatency() from the
+  *         HCLK frequency and the voltage range in use. The voltage range must therefore
+  *         be configured with HAL_PWREx_ControlVoltageScaling() before calling this function
+  *         when the clock is increased, and after it when the clock is decreased.
+  * @note   The new system clock source is selected before the new HCLK prescaler is applied.
+  *         The latency programmed during the transition also covers this intermediate
+  *         frequency, then it is lowered to the value needed by the final HCLK.
+  * @note   The instruction and data caches are enabled, after a reset if they were disabled
+  *         so that no line fetched before their deactivation is hit. The prefetch buffer is
+  *         enabled only with one wait state or more, it brings no gain at zero wait state
+  *         and increases the consumption.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_RCC_ClockConfigAuto(RCC_ClkInitTypeDef  *RCC_ClkInitStruct)
+{
+  uint32_t sysclk, hpre, vos;
+  uint32_t latency, transition_latency;
+  HAL_StatusTypeDef status;
+
+  /* Check Null pointer */
+  if(RCC_ClkInitStruct == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Get the target SYSCLK frequency */
+  if(((RCC_ClkInitStruct->ClockType) & RCC_CLOCKTYPE_SYSCLK) == RCC_CLOCKTYPE_SYSCLK)
+  {
+    switch(RCC_ClkInitStruct->SYSCLKSource)
+    {
+    case RCC_SYSCLKSOURCE_HSI:
+      sysclk = HSI_VALUE;
+      break;
+
+    case RCC_SYSCLKSOURCE_HSE:
+      sysclk = HSE_VALUE;
+      break;
+
+    case RCC_SYSCLKSOURCE_PLLCLK:
+      sysclk = RCC_GetSysClockFreqFromPLLSource();
+      break;
+
+    case RCC_SYSCLKSOURCE_MSI:
+    default:
+      sysclk = RCC_GetMSIFreq();
+      break;
+    }
+  }
+  else
+  {
+    sysclk = HAL_RCC_GetSysClockFreq();
+  }
+
+  /* Get the voltage range */
+  if(__HAL_RCC_PWR_IS_CLK_ENABLED())
+  {
+    vos = HAL_PWREx_GetVoltageRange();
+  }
+  else
+  {
+    __HAL_RCC_PWR_CLK_ENABLE();
+    vos = HAL_PWREx_GetVoltageRange();
+    __HAL_RCC_PWR_CLK_DISABLE();
+  }
+
+  /* Latency at the new SYSCLK with the current HCLK prescaler */
+  hpre = READ_BIT(RCC->CFGR, RCC_CFGR_HPRE);
+  transition_latency = HAL_RCC_GetOptimalFlashLatency(sysclk >> (AHBPrescTable[hpre >> RCC_CFGR_HPRE_Pos] & 0x1FU), vos);
+
+  /* Latency at the final HCLK */
+  if(((RCC_ClkInitStruct->ClockType) & RCC_CLOCKTYPE_HCLK) == RCC_CLOCKTYPE_HCLK)
+  {
+    hpre = RCC_ClkInitStruct->AHBCLKDivider & RCC_CFGR_HPRE;
+  }
+  latency = HAL_RCC_GetOptimalFlashLatency(sysclk >> (AHBPrescTable[hpre >> RCC_CFGR_HPRE_Pos] & 0x1FU), vos);
+
+  if(transition_latency < latency)
+  {
+    transition_latency = latency;
+  }
+
+  status = HAL_RCC_ClockConfig(RCC_ClkInitStruct, transition_latency);
+
+  if(status == HAL_OK)
+  {
+    /* Decrease the number of wait states down to the one needed by the final HCLK */
+    if(latency < __HAL_FLASH_GET_LATENCY())
+    {
+      __HAL_FLASH_SET_LATENCY(latency);
+
+      /* Check that the new number of wait states is taken into account to access the Flash
+      memory by reading the FLASH_ACR register */
+      if(__HAL_FLASH_GET_LATENCY() != latency)
+      {
+        return HAL_ERROR;
+      }
+    }
+
+    /* Enable the ART accelerator, resetting the caches which were disabled */
+    if(READ_BIT(FLASH->ACR, FLASH_ACR_ICEN) == 0U)
+    {
+      __HAL_FLASH_INSTRUCTION_CACHE_RESET();
+      __HAL_FLASH_INSTRUCTION_CACHE_ENABLE();
+    }
+    if(READ_BIT(FLASH->ACR, FLASH_ACR_DCEN) == 0U)
+    {
+      __HAL_FLASH_DATA_CACHE_RESET();
+      __HAL_FLASH_DATA_CACHE_ENABLE();
+    }
+
+    /* Prefetch buffer is only useful with wait states */
+    if(latency != FLASH_LATENCY_0)
+    {
+      __HAL_FLASH_PREFETCH_BUFFER_ENABLE();
+    }
+    else
+    {
+      __HAL_FLASH_PREFETCH_BUFFER_DISABLE();
+    }
+  }
+
+  return status;
+}
+
 /**
   * @}
   */
@@ -1706,6 +1849,207 @@ void HAL_RCC_GetClockConfig(RCC_ClkInitTypeDef  *RCC_ClkInitStruct, uint32_t *pF
   *pFLatency = __HAL_FLASH_GET_LATENCY();
 }
 
+/**
+  * @brief  Saves the oscillators, PLLs, bus prescalers and Flash configuration,
+  *         to be restored after STOP mode by HAL_RCC_RestoreClockState().
+  * @note   The PLLSAI1 and PLLSAI2 configuration registers are kept in STOP mode,
+  *         only their enable bits are saved.
+  * @param  pState: pointer to an RCC_ClockStateTypeDef structure to fill.
+  * @retval None
+  */
+void HAL_RCC_SaveClockState(RCC_ClockStateTypeDef *pState)
+{
+  pState->CR = RCC->CR;
+  pState->PLLCFGR = RCC->PLLCFGR;
+  pState->CFGR = RCC->CFGR;
+#if defined(RCC_CRRCR_HSI48ON)
+  pState->CRRCR = RCC->CRRCR & RCC_CRRCR_HSI48ON;
+#else
+  pState->CRRCR = 0U;
+#endif /* RCC_CRRCR_HSI48ON */
+  pState->FlashACR = FLASH->ACR & ~(FLASH_ACR_ICRST | FLASH_ACR_DCRST);
+  pState->SystemCoreClock = SystemCoreClock;
+}
+
+/**
+  * @brief  Restores the clock configuration saved by HAL_RCC_SaveClockState(),
+  *         with the minimum register sequence.
+  * @note   To be called on wake-up from STOP mode, when the system runs on MSI or
+  *         HSI16 with the HSE and PLLs off, instead of HAL_RCC_OscConfig() and
+  *         HAL_RCC_ClockConfig(): the saved configuration is not checked again,
+  *         the PLL lock and the voltage range are waited in parallel and the time
+  *         base is not re-initialized, as HCLK gets back its saved value.
+  * @note   The voltage range and the Range 1 boost mode are kept in STOP mode.
+  * @note   The ready flags are polled with bounded loops rather than HAL_GetTick(),
+  *         so this function can be called before the tick is resumed.
+  * @param  pState: pointer to an RCC_ClockStateTypeDef structure saved before STOP mode.
+  * @retval HAL status: HAL_TIMEOUT if an oscillator, PLL or the regulator does not get ready.
+  */
+HAL_StatusTypeDef HAL_RCC_RestoreClockState(const RCC_ClockStateTypeDef *pState)
+{
+  uint32_t sysclksource = pState->CFGR & RCC_CFGR_SW;
+  uint32_t cfgr = pState->CFGR & ~(RCC_CFGR_SW | RCC_CFGR_SWS);
+
+  /* HSE: the bypass must be configured while the oscillator is off */
+  if(((pState->CR & RCC_CR_HSEON) != 0U) && ((RCC->CR & RCC_CR_HSERDY) == 0U))
+  {
+    MODIFY_REG(RCC->CR, RCC_CR_HSEBYP, pState->CR & RCC_CR_HSEBYP);
+    SET_BIT(RCC->CR, RCC_CR_HSEON);
+    if(RCC_WaitBitLoop(&RCC->CR, RCC_CR_HSERDY, RCC_CR_HSERDY) != HAL_OK)
+    {
+      return HAL_TIMEOUT;
+    }
+  }
+
+  /* Main PLL: its configuration can only be written while it is disabled */
+  if(((pState->CR & RCC_CR_PLLON) != 0U) && ((RCC->CR & RCC_CR_PLLON) == 0U))
+  {
+    RCC->PLLCFGR = pState->PLLCFGR;
+    SET_BIT(RCC->CR, RCC_CR_PLLON);
+  }
+
+#if defined(RCC_CRRCR_HSI48ON)
+  SET_BIT(RCC->CRRCR, pState->CRRCR);
+#endif /* RCC_CRRCR_HSI48ON */
+
+  /* The regulator reaches the saved voltage range while the PLL locks */
+  if(RCC_WaitBitLoop(&PWR->SR2, PWR_SR2_VOSF, 0U) != HAL_OK)
+  {
+    return HAL_TIMEOUT;
+  }
+
+#if defined(PWR_CR5_R1MODE)
+  /* Above 80 MHz, the switch to the PLL goes through an HCLK prescaler of 2 */
+  if((sysclksource == RCC_CFGR_SW_PLL) && (pState->SystemCoreClock > 80000000U))
+  {
+    cfgr = (cfgr & ~RCC_CFGR_HPRE) | RCC_SYSCLK_DIV2;
+  }
+#endif /* PWR_CR5_R1MODE */
+
+  /* Flash latency before the frequency increase, then bus prescalers with the
+     current system clock source */
+  FLASH->ACR = pState->FlashACR;
+  RCC->CFGR = cfgr | (RCC->CFGR & RCC_CFGR_SW);
+
+  if((pState->CR & RCC_CR_PLLON) != 0U)
+  {
+    if(RCC_WaitBitLoop(&RCC->CR, RCC_CR_PLLRDY, RCC_CR_PLLRDY) != HAL_OK)
+    {
+      return HAL_TIMEOUT;
+    }
+  }
+
+  /* Audio and display PLLs: their configuration is kept in STOP mode */
+#if defined(RCC_CR_PLLSAI1ON)
+  SET_BIT(RCC->CR, pState->CR & RCC_CR_PLLSAI1ON);
+#endif /* RCC_CR_PLLSAI1ON */
+#if defined(RCC_CR_PLLSAI2ON)
+  SET_BIT(RCC->CR, pState->CR & RCC_CR_PLLSAI2ON);
+#endif /* RCC_CR_PLLSAI2ON */
+
+  /* System clock switch */
+  MODIFY_REG(RCC->CFGR, RCC_CFGR_SW, sysclksource);
+  if(RCC_WaitBitLoop(&RCC->CFGR, RCC_CFGR_SWS, sysclksource << RCC_CFGR_SWS_Pos) != HAL_OK)
+  {
+    return HAL_TIMEOUT;
+  }
+
+#if defined(PWR_CR5_R1MODE)
+  /* Back to the saved HCLK prescaler once running from the PLL */
+  MODIFY_REG(RCC->CFGR, RCC_CFGR_HPRE, pState->CFGR & RCC_CFGR_HPRE);
+#endif /* PWR_CR5_R1MODE */
+
+  /* MSI and HSI16 were only kept for the wake-up */
+  if((pState->CR & RCC_CR_MSION) == 0U)
+  {
+    CLEAR_BIT(RCC->CR, RCC_CR_MSION);
+  }
+  if((pState->CR & RCC_CR_HSION) == 0U)
+  {
+    CLEAR_BIT(RCC->CR, RCC_CR_HSION);
+  }
+
+  SystemCoreClock = pState->SystemCoreClock;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Return the minimum FLASH latency allowed for an HCLK frequency and a voltage range.
+  * @param  HCLKFreq  HCLK frequency in Hz.
+  * @param  VoltageScaling  voltage range, as returned by HAL_PWREx_GetVoltageRange().
+  *          This parameter can be one of the following values:
+  @if STM32L4S9xx
+  *            @arg @ref PWR_REGULATOR_VOLTAGE_SCALE1_BOOST  Voltage range 1 boost mode
+  @endif
+  *            @arg @ref PWR_REGULATOR_VOLTAGE_SCALE1  Voltage range 1
+  *            @arg @ref PWR_REGULATOR_VOLTAGE_SCALE2  Voltage range 2
+  * @note   The HCLK frequency is not checked against the maximum of the voltage range:
+  *         above it the highest latency of the range is returned.
+  * @retval FLASH latency, a value of @ref FLASH_Latency
+  */
+uint32_t HAL_RCC_GetOptimalFlashLatency(uint32_t HCLKFreq, uint32_t VoltageScaling)
+{
+  uint32_t latency;
+
+  if(VoltageScaling == PWR_REGULATOR_VOLTAGE_SCALE2)
+  {
+    /* Range 2 wait states are not evenly spread */
+#if defined(STM32L4P5xx) || defined(STM32L4Q5xx) || \
+    defined(STM32L4R5xx) || defined(STM32L4R7xx) || defined(STM32L4R9xx) || defined(STM32L4S5xx) || defined(STM32L4S7xx) || defined(STM32L4S9xx)
+    if(HCLKFreq <= 8000000U)
+    {
+      latency = FLASH_LATENCY_0;
+    }
+    else if(HCLKFreq <= 16000000U)
+    {
+      latency = FLASH_LATENCY_1;
+    }
+    else
+    {
+      latency = RCC_FLASH_RANGE2_WS_MAX;
+    }
+#else
+    if(HCLKFreq <= 6000000U)
+    {
+      latency = FLASH_LATENCY_0;
+    }
+    else if(HCLKFreq <= 12000000U)
+    {
+      latency = FLASH_LATENCY_1;
+    }
+    else if(HCLKFreq <= 18000000U)
+    {
+      latency = FLASH_LATENCY_2;
+    }
+    else
+    {
+      latency = RCC_FLASH_RANGE2_WS_MAX;
+    }
+#endif
+  }
+  else
+  {
+    /* Range 1: one wait state per RCC_FLASH_RANGE1_WS_FREQ */
+    latency = (HCLKFreq == 0U) ? FLASH_LATENCY_0 : ((HCLKFreq - 1U) / RCC_FLASH_RANGE1_WS_FREQ);
+
+#if defined(STM32L4P5xx) || defined(STM32L4Q5xx) || \
+    defined(STM32L4R5xx) || defined(STM32L4R7xx) || defined(STM32L4R9xx) || defined(STM32L4S5xx) || defined(STM32L4S7xx) || defined(STM32L4S9xx)
+    if(latency > FLASH_LATENCY_5)
+    {
+      latency = FLASH_LATENCY_5;
+    }
+#else
+    if(latency > FLASH_LATENCY_4)
+    {
+      latency = FLASH_LATENCY_4;
+    }
+#endif
+  }
+
+  return latency;
+}
+
 /**
   * @brief  Enable the Clock Security System.
   * @note   If a failure is detected on the HSE oscillator clock, this oscillator
@@ -1762,6 +2106,29 @@ __weak void HAL_RCC_CSSCallback(void)
 /** @addtogroup RCC_Private_Functions
   * @{
   */
+/**
+  * @brief  Waits for register bits to reach a value, with a bounded number of loops.
+  * @param  Reg: register to poll.
+  * @param  Mask: bits to check.
+  * @param  Value: expected value of the bits.
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef RCC_WaitBitLoop(__IO uint32_t *Reg, uint32_t Mask, uint32_t Value)
+{
+  uint32_t count = RCC_RESTORE_TIMEOUT_LOOPS;
+
+  while((*Reg & Mask) != Value)
+  {
+    if(count == 0U)
+    {
+      return HAL_TIMEOUT;
+    }
+    count--;
+  }
+
+  return HAL_OK;
+}
+
 /**
   * @brief  Update number of Flash wait states in line with MSI range and current
             voltage range.
@@ -1855,8 +2222,6 @@ static HAL_StatusTypeDef RCC_SetFlashLatencyFromMSIRange(uint32_t msirange)
   return HAL_OK;
 }
 
-#if defined(STM32L4P5xx) || defined(STM32L4Q5xx) || \
-    defined(STM32L4R5xx) || defined(STM32L4R7xx) || defined(STM32L4R9xx) || defined(STM32L4S5xx) || defined(STM32L4S7xx) || defined(STM32L4S9xx)
 /**
   * @brief  Compute SYSCLK frequency based on PLL SYSCLK source.
   * @retval SYSCLK frequency
@@ -1868,17 +2233,7 @@ static uint32_t RCC_GetSysClockFreqFromPLLSource(void)
 
   if(__HAL_RCC_GET_PLL_OSCSOURCE() == RCC_PLLSOURCE_MSI)
   {
-    /* Get MSI range source */
-    if(READ_BIT(RCC->CR, RCC_CR_MSIRGSEL) == 0U)
-    { /* MSISRANGE from RCC_CSR applies */
-      msirange = READ_BIT(RCC->CSR, RCC_CSR_MSISRANGE) >> RCC_CSR_MSISRANGE_Pos;
-    }
-    else
-    { /* MSIRANGE from RCC_CR applies */
-      msirange = READ_BIT(RCC->CR, RCC_CR_MSIRANGE) >> RCC_CR_MSIRANGE_Pos;
-    }
-    /*MSI frequency range in HZ*/
-    msirange = MSIRangeTable[msirange];
+    msirange = RCC_GetMSIFreq();
   }
 
   /* PLL_VCO = (HSE_VALUE or HSI_VALUE or MSI_VALUE) * PLLN / PLLM
@@ -1908,7 +2263,28 @@ static uint32_t RCC_GetSysClockFreqFromPLLSource(void)
 
   return sysclockfreq;
 }
-#endif
+
+/**
+  * @brief  Compute MSI frequency from the MSI range in use.
+  * @retval MSI frequency
+  */
+static uint32_t RCC_GetMSIFreq(void)
+{
+  uint32_t msirange;
+
+  /* Get MSI range source */
+  if(READ_BIT(RCC->CR, RCC_CR_MSIRGSEL) == 0U)
+  { /* MSISRANGE from RCC_CSR applies */
+    msirange = READ_BIT(RCC->CSR, RCC_CSR_MSISRANGE) >> RCC_CSR_MSISRANGE_Pos;
+  }
+  else
+  { /* MSIRANGE from RCC_CR applies */
+    msirange = READ_BIT(RCC->CR, RCC_CR_MSIRANGE) >> RCC_CR_MSIRANGE_Pos;
+  }
+
+  /*MSI frequency range in HZ*/
+  return MSIRangeTable[msirange];
+}
 
 /**
   * @}
@@ -8,6 +8,7 @@
   *           + Extended Peripheral Control functions
   *           + Extended Clock management functions
   *           + Extended Clock Recovery System Control functions
+  *           + Extended Performance Level functions
   *
   ******************************************************************************
   * @attention
@@ -45,6 +46,7 @@
 #define PLLSAI1_TIMEOUT_VALUE     2U    /* 2 ms (minimum Tick + 1) */
 #define PLLSAI2_TIMEOUT_VALUE     2U    /* 2 ms (minimum Tick + 1) */
 #define PLL_TIMEOUT_VALUE         2U    /* 2 ms (minimum Tick + 1) */
+#define MSI_TIMEOUT_VALUE         2U    /* 2 ms (minimum Tick + 1) */
 
 #define DIVIDER_P_UPDATE          0U
 #define DIVIDER_Q_UPDATE          1U
@@ -53,16 +55,49 @@
 #define __LSCO_CLK_ENABLE()       __HAL_RCC_GPIOA_CLK_ENABLE()
 #define LSCO_GPIO_PORT            GPIOA
 #define LSCO_PIN                  GPIO_PIN_2
+
+#define RCC_RANGE2_SYSCLK_MAX     26000000U   /* Voltage range 2                  */
+#define RCC_RANGE1_SYSCLK_MAX     80000000U   /* Voltage range 1 normal mode      */
+#define RCC_BOOST_SYSCLK_MAX      120000000U  /* Voltage range 1 boost mode       */
 /**
   * @}
   */
 
 /* Private macros ------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
+/** @defgroup RCCEx_Private_Variables RCCEx Private Variables
+ * @{
+ */
+/* Predefined operating points, indexed by RCC_PERF_LEVEL_x */
+static const RCC_OperatingPointTypeDef RCCEx_PerfLevelTable[RCC_PERF_LEVEL_MAX + 1U] =
+{
+  /* Level 0: MSI 4 MHz, range 2 */
+  { PWR_REGULATOR_VOLTAGE_SCALE2, RCC_SYSCLKSOURCE_MSI, RCC_MSIRANGE_6, 1U, 8U, 2U,
+    RCC_SYSCLK_DIV1, RCC_HCLK_DIV1, RCC_HCLK_DIV1 },
+  /* Level 1: PLL 4 MHz x 13 / 2 = 26 MHz, range 2 */
+  { PWR_REGULATOR_VOLTAGE_SCALE2, RCC_SYSCLKSOURCE_PLLCLK, RCC_MSIRANGE_6, 1U, 13U, 2U,
+    RCC_SYSCLK_DIV1, RCC_HCLK_DIV1, RCC_HCLK_DIV1 },
+  /* Level 2: PLL 4 MHz x 40 / 2 = 80 MHz, range 1 */
+  { PWR_REGULATOR_VOLTAGE_SCALE1, RCC_SYSCLKSOURCE_PLLCLK, RCC_MSIRANGE_6, 1U, 40U, 2U,
+    RCC_SYSCLK_DIV1, RCC_HCLK_DIV1, RCC_HCLK_DIV1 },
+#if defined(PWR_CR5_R1MODE)
+  /* Level 3: PLL 4 MHz x 60 / 2 = 120 MHz, range 1 boost */
+  { PWR_REGULATOR_VOLTAGE_SCALE1_BOOST, RCC_SYSCLKSOURCE_PLLCLK, RCC_MSIRANGE_6, 1U, 60U, 2U,
+    RCC_SYSCLK_DIV1, RCC_HCLK_DIV1, RCC_HCLK_DIV1 },
+#endif /* PWR_CR5_R1MODE */
+};
+
+/* Current performance level, above RCC_PERF_LEVEL_MAX until a level is selected */
+static uint32_t RCCEx_PerfLevel = 0xFFFFFFFFU;
+/**
+  * @}
+  */
+
 /* Private function prototypes -----------------------------------------------*/
 /** @defgroup RCCEx_Private_Functions RCCEx Private Functions
  * @{
  */
+static uint32_t RCCEx_VoltageRank(uint32_t VoltageScaling);
 #if defined(RCC_PLLSAI1_SUPPORT)
 
 static HAL_StatusTypeDef RCCEx_PLLSAI1_Config(RCC_PLLSAI1InitTypeDef *PllSai1, uint32_t Divider);
@@ -2882,6 +2917,323 @@ __weak void HAL_RCCEx_CRS_ErrorCallback(uint32_t Error)
 
 #endif /* CRS */
 
+/** @defgroup RCCEx_Exported_Functions_Group4 Extended Performance Level functions
+ *  @brief  Extended Performance Level functions
+ *
+@verbatim
+ ===============================================================================
+                ##### Extended Performance Level functions #####
+ ===============================================================================
+    [..]
+      The regulator voltage range, the FLASH latency and the system clock must be
+      changed in a given order: the voltage is raised before the frequency and
+      lowered after it, the latency is increased before the frequency and decreased
+      after it, and the PLL can only be reconfigured while it is not the system clock.
+      These functions apply this order to switch between operating points.
+
+    [..]
+      (+) HAL_RCCEx_SetOperatingPoint() switches to any operating point described by
+          an RCC_OperatingPointTypeDef structure, with the system clock on MSI or
+          on the main PLL clocked by MSI.
+
+      (+) HAL_RCCEx_SetPerformanceLevel() switches to one of the predefined operating
+          points of @ref RCCEx_Performance_Level, from MSI 4 MHz in voltage range 2
+          up to 80 MHz in range 1, or 120 MHz in range 1 boost mode where available.
+
+      (+) HAL_RCCEx_PerformanceGovernor() is to be called periodically with the CPU
+          load, for instance measured from the idle time. It selects the next level
+          up above RCC_PERF_LOAD_HIGH and the next level down below RCC_PERF_LOAD_LOW.
+
+      (+) HAL_RCCEx_PerformanceLevelCallback() is called after each level change, so
+          that the application can update the peripherals depending on the bus clocks.
+
+    [..]
+      (@) When the system clock is on the PLL, the P and Q outputs of the main PLL
+          also change with an operating point change: check the clocks derived from
+          them (USB, RNG, SDMMC, SAI) before using these functions.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Switch the regulator voltage range, the FLASH latency and the system
+  *         clock to an operating point, in the order required by the device.
+  * @note   The voltage range is raised first when the target one is higher: the
+  *         system clock is then switched with HAL_RCC_ClockConfigAuto(), which sets
+  *         the FLASH latency for the frequency in use at each step, and the voltage
+  *         range is lowered last when the target one is lower.
+  * @note   When the PLL is the system clock before the change, the system clock is
+  *         moved to MSI while the PLL is reconfigured. The PLL is kept running when
+  *         the target clock is MSI only if its P or Q outputs are enabled.
+  * @param  pOperatingPoint  pointer to an RCC_OperatingPointTypeDef structure.
+  * @retval HAL status: HAL_ERROR if the system clock exceeds the maximum of the
+  *         voltage range.
+  */
+HAL_StatusTypeDef HAL_RCCEx_SetOperatingPoint(const RCC_OperatingPointTypeDef *pOperatingPoint)
+{
+  RCC_ClkInitTypeDef clkinit;
+  uint32_t sysclk, maxclk, vos, tickstart;
+  uint32_t latency;
+  uint32_t pwrclkchanged = 0U;
+  HAL_StatusTypeDef status;
+
+  if(pOperatingPoint == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  assert_param(IS_PWR_VOLTAGE_SCALING_RANGE(pOperatingPoint->VoltageScaling));
+  assert_param(IS_RCC_MSI_CLOCK_RANGE(pOperatingPoint->MSIRange));
+  assert_param(IS_RCC_HCLK(pOperatingPoint->AHBCLKDivider));
+
+  /* Check the system clock against the maximum of the voltage range */
+  sysclk = MSIRangeTable[pOperatingPoint->MSIRange >> RCC_CR_MSIRANGE_Pos];
+  if(pOperatingPoint->SYSCLKSource == RCC_SYSCLKSOURCE_PLLCLK)
+  {
+    assert_param(IS_RCC_PLLM_VALUE(pOperatingPoint->PLLM));
+    assert_param(IS_RCC_PLLN_VALUE(pOperatingPoint->PLLN));
+    assert_param(IS_RCC_PLLR_VALUE(pOperatingPoint->PLLR));
+    sysclk = ((sysclk / pOperatingPoint->PLLM) * pOperatingPoint->PLLN) / pOperatingPoint->PLLR;
+  }
+  else if(pOperatingPoint->SYSCLKSource != RCC_SYSCLKSOURCE_MSI)
+  {
+    return HAL_ERROR;
+  }
+  else
+  {
+    /* Nothing to check on MSI */
+  }
+
+  switch(RCCEx_VoltageRank(pOperatingPoint->VoltageScaling))
+  {
+  case 0U:
+    maxclk = RCC_RANGE2_SYSCLK_MAX;
+    break;
+  case 1U:
+    maxclk = RCC_RANGE1_SYSCLK_MAX;
+    break;
+  default:
+    maxclk = RCC_BOOST_SYSCLK_MAX;
+    break;
+  }
+  if(sysclk > maxclk)
+  {
+    return HAL_ERROR;
+  }
+
+  if(__HAL_RCC_PWR_IS_CLK_DISABLED())
+  {
+    __HAL_RCC_PWR_CLK_ENABLE();
+    pwrclkchanged = 1U;
+  }
+  vos = HAL_PWREx_GetVoltageRange();
+
+  /* 1. Raise the voltage range before the frequency */
+  status = HAL_OK;
+  if(RCCEx_VoltageRank(pOperatingPoint->VoltageScaling) > RCCEx_VoltageRank(vos))
+  {
+    status = HAL_PWREx_ControlVoltageScaling(pOperatingPoint->VoltageScaling);
+    vos = pOperatingPoint->VoltageScaling;
+  }
+
+  /* 2. MSI must be running: it clocks the system during the PLL reconfiguration */
+  if((status == HAL_OK) && (READ_BIT(RCC->CR, RCC_CR_MSIRDY) == 0U))
+  {
+    __HAL_RCC_MSI_ENABLE();
+    tickstart = HAL_GetTick();
+    while(READ_BIT(RCC->CR, RCC_CR_MSIRDY) == 0U)
+    {
+      if((HAL_GetTick() - tickstart) > MSI_TIMEOUT_VALUE)
+      {
+        status = HAL_TIMEOUT;
+        break;
+      }
+    }
+  }
+
+  /* 3. Move the system clock off the PLL */
+  if((status == HAL_OK) && (__HAL_RCC_GET_SYSCLK_SOURCE() == RCC_SYSCLKSOURCE_STATUS_PLLCLK))
+  {
+    clkinit.ClockType = RCC_CLOCKTYPE_SYSCLK;
+    clkinit.SYSCLKSource = RCC_SYSCLKSOURCE_MSI;
+    status = HAL_RCC_ClockConfigAuto(&clkinit);
+  }
+
+  /* 4. MSI range, the new range increasing the FLASH latency first if needed */
+  if((status == HAL_OK) && ((RCC->CR & RCC_CR_MSIRANGE) != pOperatingPoint->MSIRange))
+  {
+    if(__HAL_RCC_GET_SYSCLK_SOURCE() == RCC_SYSCLKSOURCE_STATUS_MSI)
+    {
+      latency = HAL_RCC_GetOptimalFlashLatency(MSIRangeTable[pOperatingPoint->MSIRange >> RCC_CR_MSIRANGE_Pos] >>
+                  (AHBPrescTable[READ_BIT(RCC->CFGR, RCC_CFGR_HPRE) >> RCC_CFGR_HPRE_Pos] & 0x1FU), vos);
+      if(latency > __HAL_FLASH_GET_LATENCY())
+      {
+        __HAL_FLASH_SET_LATENCY(latency);
+      }
+    }
+    __HAL_RCC_MSI_RANGE_CONFIG(pOperatingPoint->MSIRange);
+  }
+
+  /* 5. Main PLL from MSI, reconfigured while it is stopped */
+  if((status == HAL_OK) &&
+     ((pOperatingPoint->SYSCLKSource == RCC_SYSCLKSOURCE_PLLCLK) ||
+      (READ_BIT(RCC->PLLCFGR, RCC_PLLCFGR_PLLPEN | RCC_PLLCFGR_PLLQEN) == 0U)))
+  {
+    __HAL_RCC_PLL_DISABLE();
+    tickstart = HAL_GetTick();
+    while(READ_BIT(RCC->CR, RCC_CR_PLLRDY) != 0U)
+    {
+      if((HAL_GetTick() - tickstart) > PLL_TIMEOUT_VALUE)
+      {
+        status = HAL_TIMEOUT;
+        break;
+      }
+    }
+
+    if((status == HAL_OK) && (pOperatingPoint->SYSCLKSource == RCC_SYSCLKSOURCE_PLLCLK))
+    {
+      MODIFY_REG(RCC->PLLCFGR, (RCC_PLLCFGR_PLLSRC | RCC_PLLCFGR_PLLM | RCC_PLLCFGR_PLLN | RCC_PLLCFGR_PLLR),
+                 (RCC_PLLSOURCE_MSI |
+                  ((pOperatingPoint->PLLM - 1U) << RCC_PLLCFGR_PLLM_Pos) |
+                  (pOperatingPoint->PLLN << RCC_PLLCFGR_PLLN_Pos) |
+                  (((pOperatingPoint->PLLR >> 1U) - 1U) << RCC_PLLCFGR_PLLR_Pos)));
+      __HAL_RCC_PLL_ENABLE();
+      __HAL_RCC_PLLCLKOUT_ENABLE(RCC_PLL_SYSCLK);
+
+      tickstart = HAL_GetTick();
+      while(READ_BIT(RCC->CR, RCC_CR_PLLRDY) == 0U)
+      {
+        if((HAL_GetTick() - tickstart) > PLL_TIMEOUT_VALUE)
+        {
+          status = HAL_TIMEOUT;
+          break;
+        }
+      }
+    }
+  }
+
+  /* 6. System clock and bus prescalers, with the FLASH latency of each step */
+  if(status == HAL_OK)
+  {
+    clkinit.ClockType = RCC_CLOCKTYPE_SYSCLK | RCC_CLOCKTYPE_HCLK | RCC_CLOCKTYPE_PCLK1 | RCC_CLOCKTYPE_PCLK2;
+    clkinit.SYSCLKSource = pOperatingPoint->SYSCLKSource;
+    clkinit.AHBCLKDivider = pOperatingPoint->AHBCLKDivider;
+    clkinit.APB1CLKDivider = pOperatingPoint->APB1CLKDivider;
+    clkinit.APB2CLKDivider = pOperatingPoint->APB2CLKDivider;
+    status = HAL_RCC_ClockConfigAuto(&clkinit);
+  }
+
+  /* 7. Lower the voltage range after the frequency */
+  if((status == HAL_OK) && (RCCEx_VoltageRank(pOperatingPoint->VoltageScaling) < RCCEx_VoltageRank(vos)))
+  {
+    status = HAL_PWREx_ControlVoltageScaling(pOperatingPoint->VoltageScaling);
+  }
+
+  if(pwrclkchanged == 1U)
+  {
+    __HAL_RCC_PWR_CLK_DISABLE();
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Switch to a predefined performance level.
+  * @param  Level  performance level.
+  *         This parameter can be a value of @ref RCCEx_Performance_Level.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_RCCEx_SetPerformanceLevel(uint32_t Level)
+{
+  HAL_StatusTypeDef status;
+
+  if(Level > RCC_PERF_LEVEL_MAX)
+  {
+    return HAL_ERROR;
+  }
+
+  if(Level == RCCEx_PerfLevel)
+  {
+    return HAL_OK;
+  }
+
+  status = HAL_RCCEx_SetOperatingPoint(&RCCEx_PerfLevelTable[Level]);
+  if(status == HAL_OK)
+  {
+    RCCEx_PerfLevel = Level;
+    HAL_RCCEx_PerformanceLevelCallback(Level);
+  }
+  else
+  {
+    /* The clock tree may be in an intermediate state */
+    RCCEx_PerfLevel = 0xFFFFFFFFU;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Return the performance level selected by HAL_RCCEx_SetPerformanceLevel().
+  * @retval Performance level, a value of @ref RCCEx_Performance_Level, or 0xFFFFFFFF
+  *         if no level has been selected or the last change failed.
+  */
+uint32_t HAL_RCCEx_GetPerformanceLevel(void)
+{
+  return RCCEx_PerfLevel;
+}
+
+/**
+  * @brief  Select the performance level from the CPU load.
+  * @note   One level is changed per call, to the next level up above RCC_PERF_LOAD_HIGH
+  *         and to the next level down below RCC_PERF_LOAD_LOW. When no level has been
+  *         selected yet, the highest level is selected.
+  * @param  LoadPercent  CPU load over the last period, from 0 to 100.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_RCCEx_PerformanceGovernor(uint32_t LoadPercent)
+{
+  uint32_t level = RCCEx_PerfLevel;
+
+  if(level > RCC_PERF_LEVEL_MAX)
+  {
+    level = RCC_PERF_LEVEL_MAX;
+  }
+  else if((LoadPercent > RCC_PERF_LOAD_HIGH) && (level < RCC_PERF_LEVEL_MAX))
+  {
+    level++;
+  }
+  else if((LoadPercent < RCC_PERF_LOAD_LOW) && (level > RCC_PERF_LEVEL_0))
+  {
+    level--;
+  }
+  else
+  {
+    /* Keep the current level */
+  }
+
+  return HAL_RCCEx_SetPerformanceLevel(level);
+}
+
+/**
+  * @brief  Performance level changed callback.
+  * @param  Level  new performance level, a value of @ref RCCEx_Performance_Level.
+  * @retval None
+  */
+__weak void HAL_RCCEx_PerformanceLevelCallback(uint32_t Level)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(Level);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the @ref HAL_RCCEx_PerformanceLevelCallback should be implemented in the user file
+   */
+}
+
+/**
+  * @}
+  */
+
 /**
   * @}
   */
@@ -2890,6 +3242,33 @@ __weak void HAL_RCCEx_CRS_ErrorCallback(uint32_t Error)
  * @{
  */
 
+/**
+  * @brief  Rank a voltage range by performance.
+  * @param  VoltageScaling  a value of @ref PWREx_Regulator_Voltage_Scale.
+  * @retval 0 for range 2, 1 for range 1 and 2 for range 1 boost mode
+  */
+static uint32_t RCCEx_VoltageRank(uint32_t VoltageScaling)
+{
+  uint32_t rank;
+
+  if(VoltageScaling == PWR_REGULATOR_VOLTAGE_SCALE2)
+  {
+    rank = 0U;
+  }
+#if defined(PWR_CR5_R1MODE)
+  else if(VoltageScaling == PWR_REGULATOR_VOLTAGE_SCALE1_BOOST)
+  {
+    rank = 2U;
+  }
+#endif /* PWR_CR5_R1MODE */
+  else
+  {
+    rank = 1U;
+  }
+
+  return rank;
+}
+
 #if defined(RCC_PLLSAI1_SUPPORT)
 
 /**
@@ -77,6 +77,9 @@
   * @{
   */
 static void UARTEx_Wakeup_AddressConfig(UART_HandleTypeDef *huart, UART_WakeUpTypeDef WakeUpSelection);
+static void UARTEx_DMARingRxEvent(DMA_HandleTypeDef *hdma);
+static void UARTEx_DMARingRxError(DMA_HandleTypeDef *hdma);
+static void UARTEx_EndRingRxTransfer(UART_HandleTypeDef *huart);
 #if defined(USART_CR1_FIFOEN)
 static void UARTEx_SetNbDataToProcess(UART_HandleTypeDef *huart);
 #endif /* USART_CR1_FIFOEN */
@@ -264,6 +267,9 @@ HAL_StatusTypeDef HAL_RS485Ex_Init(UART_HandleTypeDef *huart, uint32_t Polarity,
         (+) HAL_UARTEx_RxFifoFullCallback()
         (+) HAL_UARTEx_TxFifoEmptyCallback()
 
+    (#) Ring buffer reception Callback:
+        (+) HAL_UARTEx_RingRxEventCallback()
+
 @endverbatim
   * @{
   */
@@ -313,6 +319,23 @@ __weak void HAL_UARTEx_TxFifoEmptyCallback(UART_HandleTypeDef *huart)
             the HAL_UARTEx_TxFifoEmptyCallback can be implemented in the user file.
    */
 }
+
+/**
+  * @brief  UART ring buffer reception event callback.
+  * @note   Called each time new data has been published in the ring, i.e. on line
+  *         idle, half transfer and transfer complete events.
+  * @param  huart UART handle.
+  * @retval None
+  */
+__weak void HAL_UARTEx_RingRxEventCallback(UART_HandleTypeDef *huart)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(huart);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_UARTEx_RingRxEventCallback can be implemented in the user file.
+   */
+}
 #endif /* USART_CR1_FIFOEN */
 
 /**
@@ -899,6 +922,7 @@ HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_IT(UART_HandleTypeDef *huart, uint8_t
 
     /* Set Reception type to reception till IDLE Event*/
     huart->ReceptionType = HAL_UART_RECEPTION_TOIDLE;
+    huart->pRxRing = NULL;
 
     status =  UART_Start_Receive_IT(huart, pData, Size);
 
@@ -960,6 +984,7 @@ HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_DMA(UART_HandleTypeDef *huart, uint8_
 
     /* Set Reception type to reception till IDLE Event*/
     huart->ReceptionType = HAL_UART_RECEPTION_TOIDLE;
+    huart->pRxRing = NULL;
 
     status =  UART_Start_Receive_DMA(huart, pData, Size);
 
@@ -989,6 +1014,244 @@ HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_DMA(UART_HandleTypeDef *huart, uint8_
   }
 }
 
+/**
+  * @brief  Start a ring buffer reception in DMA mode.
+  * @note   The Rx DMA handle must be configured in circular mode. The DMA then
+  *         fills pData continuously and the write index is resynchronised from
+  *         the DMA remaining data counter on line idle, half transfer and
+  *         transfer complete events, so a burst is made available to the reader
+  *         as soon as the line goes idle, without any per-byte interrupt.
+  * @note   The reader drains the ring with HAL_UARTEx_Ring_GetData() and
+  *         HAL_UARTEx_Ring_Release(), which hand out pointers into pData
+  *         (no copy is made).
+  * @note   Line errors (noise, framing, parity) are not reported in this mode,
+  *         the reception goes on. A reader that falls behind by more than Size
+  *         bytes loses the oldest data and Overrun is incremented.
+  * @param  huart Pointer to a UART_HandleTypeDef structure that contains
+  *               the configuration information for the specified UART module.
+  * @param  pRing Pointer to the ring descriptor, owned by the application.
+  * @param  pData Pointer to the ring storage.
+  * @param  Size  Size of the ring storage, must be a power of two.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UARTEx_RingReceive_DMA(UART_HandleTypeDef *huart, UART_RingTypeDef *pRing, uint8_t *pData, uint16_t Size)
+{
+  uint32_t *tmp;
+
+  /* Check that a Rx process is not already ongoing */
+  if (huart->RxState == HAL_UART_STATE_READY)
+  {
+    if ((pRing == NULL) || (pData == NULL) || (Size == 0U) || ((Size & (Size - 1U)) != 0U))
+    {
+      return HAL_ERROR;
+    }
+
+    /* The ring relies on the DMA wrapping around by itself */
+    if ((huart->hdmarx == NULL) || (huart->hdmarx->Init.Mode != DMA_CIRCULAR))
+    {
+      return HAL_ERROR;
+    }
+
+    /* Process Locked */
+    __HAL_LOCK(huart);
+
+    pRing->pBuffer = pData;
+    pRing->Mask    = (uint32_t)Size - 1U;
+    pRing->Head    = 0U;
+    pRing->Tail    = 0U;
+    pRing->Overrun = 0U;
+
+    huart->pRxBuffPtr = pData;
+    huart->RxXferSize = Size;
+    huart->pRxRing    = pRing;
+
+    huart->ErrorCode = HAL_UART_ERROR_NONE;
+    huart->RxState = HAL_UART_STATE_BUSY_RX;
+    huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+
+    /* Half transfer and transfer complete both only resynchronise the write index */
+    huart->hdmarx->XferCpltCallback = UARTEx_DMARingRxEvent;
+    huart->hdmarx->XferHalfCpltCallback = UARTEx_DMARingRxEvent;
+
+    /* Set the DMA error callback */
+    huart->hdmarx->XferErrorCallback = UARTEx_DMARingRxError;
+
+    /* Set the DMA abort callback */
+    huart->hdmarx->XferAbortCallback = NULL;
+
+    /* Enable the DMA channel */
+    tmp = (uint32_t *)&pData;
+    if (HAL_DMA_Start_IT(huart->hdmarx, (uint32_t)&huart->Instance->RDR, *(uint32_t *)tmp, Size) != HAL_OK)
+    {
+      huart->pRxRing = NULL;
+      huart->ErrorCode = HAL_UART_ERROR_DMA;
+      huart->RxState = HAL_UART_STATE_READY;
+
+      /* Process Unlocked */
+      __HAL_UNLOCK(huart);
+
+      return HAL_ERROR;
+    }
+
+    /* Clear the Overrun and Idle flags just before enabling the DMA Rx request */
+    __HAL_UART_CLEAR_FLAG(huart, UART_CLEAR_OREF | UART_CLEAR_IDLEF);
+
+    /* Process Unlocked */
+    __HAL_UNLOCK(huart);
+
+    /* Enable the line idle interrupt used to flush bursts to the reader */
+    SET_BIT(huart->Instance->CR1, USART_CR1_IDLEIE);
+
+    /* Enable the DMA transfer for the receiver request by setting the DMAR bit
+    in the UART CR3 register */
+    SET_BIT(huart->Instance->CR3, USART_CR3_DMAR);
+
+    return HAL_OK;
+  }
+  else
+  {
+    return HAL_BUSY;
+  }
+}
+
+/**
+  * @brief  Stop an ongoing ring buffer reception.
+  * @note   The write index is resynchronised one last time, so the data received
+  *         before the call stays available to the reader.
+  * @param  huart Pointer to a UART_HandleTypeDef structure that contains
+  *               the configuration information for the specified UART module.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UARTEx_RingReceive_Stop(UART_HandleTypeDef *huart)
+{
+  if (huart->pRxRing == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Stop new Rx DMA requests and line idle notifications */
+  CLEAR_BIT(huart->Instance->CR1, USART_CR1_IDLEIE);
+  CLEAR_BIT(huart->Instance->CR3, USART_CR3_DMAR);
+
+  /* Publish the data written so far before the DMA is disabled */
+  HAL_UARTEx_RingReceive_Update(huart);
+
+  /* Abort the UART DMA Rx stream : use blocking DMA Abort API (no callback) */
+  huart->hdmarx->XferAbortCallback = NULL;
+  if (HAL_DMA_Abort(huart->hdmarx) != HAL_OK)
+  {
+    if (HAL_DMA_GetError(huart->hdmarx) == HAL_DMA_ERROR_TIMEOUT)
+    {
+      /* Set error code to DMA */
+      huart->ErrorCode = HAL_UART_ERROR_DMA;
+
+      return HAL_TIMEOUT;
+    }
+  }
+
+  UARTEx_EndRingRxTransfer(huart);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Resynchronise the ring write index with the DMA remaining data counter.
+  * @note   Called by the driver on line idle, half transfer and transfer complete
+  *         events. It can also be called by the reader to pick up bytes received
+  *         since the last event without waiting for the line to go idle.
+  * @param  huart Pointer to a UART_HandleTypeDef structure that contains
+  *               the configuration information for the specified UART module.
+  * @retval None
+  */
+void HAL_UARTEx_RingReceive_Update(UART_HandleTypeDef *huart)
+{
+  UART_RingTypeDef *pRing = huart->pRxRing;
+  uint32_t primask_bit;
+  uint32_t position;
+  uint32_t head;
+
+  if (pRing != NULL)
+  {
+    /* The update can be entered concurrently from the UART IRQ, the DMA IRQ and
+       the reader: keep the read-modify-write of Head atomic */
+    primask_bit = __get_PRIMASK();
+    __disable_irq();
+
+    position = ((uint32_t)huart->RxXferSize - __HAL_DMA_GET_COUNTER(huart->hdmarx)) & pRing->Mask;
+    head = pRing->Head;
+    head += (position - head) & pRing->Mask;
+    if ((head - pRing->Tail) > (pRing->Mask + 1U))
+    {
+      pRing->Overrun++;
+    }
+    pRing->Head = head;
+
+    __set_PRIMASK(primask_bit);
+  }
+}
+
+/**
+  * @brief  Return the number of bytes waiting in the ring.
+  * @param  pRing Pointer to the ring descriptor.
+  * @retval Number of bytes available to the reader
+  */
+uint32_t HAL_UARTEx_Ring_GetCount(UART_RingTypeDef *pRing)
+{
+  uint32_t count = pRing->Head - pRing->Tail;
+
+  /* Bytes overwritten by the DMA are not readable anymore */
+  if (count > (pRing->Mask + 1U))
+  {
+    count = pRing->Mask + 1U;
+  }
+
+  return count;
+}
+
+/**
+  * @brief  Get direct access to the oldest bytes waiting in the ring.
+  * @note   Only the contiguous part up to the end of the storage is returned: when
+  *         the waiting data wraps around, a second call after
+  *         HAL_UARTEx_Ring_Release() returns the remainder.
+  * @param  pRing  Pointer to the ring descriptor.
+  * @param  ppData Filled with a pointer to the oldest waiting byte.
+  * @retval Number of contiguous bytes readable at *ppData
+  */
+uint32_t HAL_UARTEx_Ring_GetData(UART_RingTypeDef *pRing, uint8_t **ppData)
+{
+  uint32_t head = pRing->Head;
+  uint32_t tail = pRing->Tail;
+  uint32_t size = pRing->Mask + 1U;
+  uint32_t count;
+
+  /* The writer overtook the reader: skip the overwritten bytes */
+  if ((head - tail) > size)
+  {
+    tail = head - size;
+    pRing->Tail = tail;
+  }
+
+  count = head - tail;
+  if (count > (size - (tail & pRing->Mask)))
+  {
+    count = size - (tail & pRing->Mask);
+  }
+
+  *ppData = &pRing->pBuffer[tail & pRing->Mask];
+  return count;
+}
+
+/**
+  * @brief  Hand bytes obtained with HAL_UARTEx_Ring_GetData() back to the driver.
+  * @param  pRing Pointer to the ring descriptor.
+  * @param  Count Number of bytes consumed by the reader.
+  * @retval None
+  */
+void HAL_UARTEx_Ring_Release(UART_RingTypeDef *pRing, uint32_t Count)
+{
+  pRing->Tail += Count;
+}
+
 /**
   * @}
   */
@@ -1018,6 +1281,57 @@ static void UARTEx_Wakeup_AddressConfig(UART_HandleTypeDef *huart, UART_WakeUpTy
   MODIFY_REG(huart->Instance->CR2, USART_CR2_ADD, ((uint32_t)WakeUpSelection.Address << UART_CR2_ADDRESS_LSB_POS));
 }
 
+/**
+  * @brief  DMA UART ring buffer reception half/full transfer callback.
+  * @param  hdma DMA handle.
+  * @retval None
+  */
+static void UARTEx_DMARingRxEvent(DMA_HandleTypeDef *hdma)
+{
+  UART_HandleTypeDef *huart = (UART_HandleTypeDef *)((DMA_HandleTypeDef *)hdma)->Parent;
+
+  HAL_UARTEx_RingReceive_Update(huart);
+  HAL_UARTEx_RingRxEventCallback(huart);
+}
+
+/**
+  * @brief  DMA UART ring buffer reception error callback.
+  * @param  hdma DMA handle.
+  * @retval None
+  */
+static void UARTEx_DMARingRxError(DMA_HandleTypeDef *hdma)
+{
+  UART_HandleTypeDef *huart = (UART_HandleTypeDef *)(hdma->Parent);
+
+  UARTEx_EndRingRxTransfer(huart);
+  huart->ErrorCode |= HAL_UART_ERROR_DMA;
+
+#if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
+  /*Call registered error callback*/
+  huart->ErrorCallback(huart);
+#else
+  /*Call legacy weak error callback*/
+  HAL_UART_ErrorCallback(huart);
+#endif /* USE_HAL_UART_REGISTER_CALLBACKS */
+}
+
+/**
+  * @brief  End an ongoing ring buffer reception.
+  * @param  huart UART handle.
+  * @retval None
+  */
+static void UARTEx_EndRingRxTransfer(UART_HandleTypeDef *huart)
+{
+  /* Disable the line idle interrupt and the DMA Rx request */
+  CLEAR_BIT(huart->Instance->CR1, USART_CR1_IDLEIE);
+  CLEAR_BIT(huart->Instance->CR3, USART_CR3_DMAR);
+
+  huart->pRxRing = NULL;
+
+  /* At end of Rx process, restore huart->RxState to Ready */
+  huart->RxState = HAL_UART_STATE_READY;
+}
+
 #if defined(USART_CR1_FIFOEN)
 /**
   * @brief Calculate the number of data to process in RX/TX ISR.
@@ -815,14 +815,37 @@ HAL_StatusTypeDef USB_WritePacket(USB_OTG_GlobalTypeDef *USBx, uint8_t *src,
                                   uint8_t ch_ep_num, uint16_t len)
 {
   uint32_t USBx_BASE = (uint32_t)USBx;
+  __IO uint32_t *pFifo = &USBx_DFIFO((uint32_t)ch_ep_num);
   uint32_t *pSrc = (uint32_t *)src;
   uint32_t count32b, i;
 
   count32b = ((uint32_t)len + 3U) / 4U;
-  for (i = 0U; i < count32b; i++)
+
+  if (((uint32_t)src & 3U) == 0U)
+  {
+    /* Word aligned source: blocks of four words, written at four addresses of
+       the FIFO window (any address of the window accesses the FIFO) */
+    for (i = count32b >> 2U; i != 0U; i--)
+    {
+      pFifo[0] = pSrc[0];
+      pFifo[1] = pSrc[1];
+      pFifo[2] = pSrc[2];
+      pFifo[3] = pSrc[3];
+      pSrc += 4U;
+    }
+    for (i = count32b & 3U; i != 0U; i--)
+    {
+      *pFifo = *pSrc;
+      pSrc++;
+    }
+  }
+  else
   {
-    USBx_DFIFO((uint32_t)ch_ep_num) = __UNALIGNED_UINT32_READ(pSrc);
-    pSrc++;
+    for (i = 0U; i < count32b; i++)
+    {
+      *pFifo = __UNALIGNED_UINT32_READ(pSrc);
+      pSrc++;
+    }
   }
 
   return HAL_OK;
@@ -838,17 +861,54 @@ HAL_StatusTypeDef USB_WritePacket(USB_OTG_GlobalTypeDef *USBx, uint8_t *src,
 void *USB_ReadPacket(USB_OTG_GlobalTypeDef *USBx, uint8_t *dest, uint16_t len)
 {
   uint32_t USBx_BASE = (uint32_t)USBx;
+  __IO uint32_t *pFifo = &USBx_DFIFO(0U);
   uint32_t *pDest = (uint32_t *)dest;
+  uint8_t *pDest8;
+  uint32_t pData;
   uint32_t i;
-  uint32_t count32b = ((uint32_t)len + 3U) / 4U;
+  uint32_t count32b = (uint32_t)len >> 2U;
+  uint32_t remaining_bytes = (uint32_t)len & 3U;
+
+  if (((uint32_t)dest & 3U) == 0U)
+  {
+    /* Word aligned destination: blocks of four words, read at four addresses of
+       the FIFO window (any address of the window accesses the FIFO) */
+    for (i = count32b >> 2U; i != 0U; i--)
+    {
+      pDest[0] = pFifo[0];
+      pDest[1] = pFifo[1];
+      pDest[2] = pFifo[2];
+      pDest[3] = pFifo[3];
+      pDest += 4U;
+    }
+    for (i = count32b & 3U; i != 0U; i--)
+    {
+      *pDest = *pFifo;
+      pDest++;
+    }
+  }
+  else
+  {
+    for (i = 0U; i < count32b; i++)
+    {
+      __UNALIGNED_UINT32_WRITE(pDest, *pFifo);
+      pDest++;
+    }
+  }
 
-  for (i = 0U; i < count32b; i++)
+  /* When Number of data is not word aligned, read the remaining bytes */
+  pDest8 = (uint8_t *)pDest;
+  if (remaining_bytes != 0U)
   {
-    __UNALIGNED_UINT32_WRITE(pDest, USBx_DFIFO(0U));
-    pDest++;
+    pData = *pFifo;
+    for (i = 0U; i < remaining_bytes; i++)
+    {
+      *pDest8 = (uint8_t)(pData >> (8U * i));
+      pDest8++;
+    }
   }
 
-  return ((void *)pDest);
+  return ((void *)pDest8);
 }
 
 /**
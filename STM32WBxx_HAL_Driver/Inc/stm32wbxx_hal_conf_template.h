@@ -39,6 +39,7 @@
 #define HAL_CRC_MODULE_ENABLED
 #define HAL_CRYP_MODULE_ENABLED
 #define HAL_DMA_MODULE_ENABLED
+#define HAL_EEPROM_EMUL_MODULE_ENABLED
 #define HAL_EXTI_MODULE_ENABLED
 #define HAL_FLASH_MODULE_ENABLED
 #define HAL_GPIO_MODULE_ENABLED
@@ -175,6 +176,8 @@
 #define  VDD_VALUE                    (3300UL) /*!< Value of VDD in mv */
 #define  TICK_INT_PRIORITY            ((1UL<<__NVIC_PRIO_BITS) - 1UL) /*!< tick interrupt priority (lowest by default) */
 #define  USE_RTOS                     0U
+#define  USE_HAL_ATOMIC_LOCK          0U /*!< 1: handle lock safe between interrupt and thread */
+#define  USE_HAL_NO_LOCK              0U /*!< 1: handle lock compiled out, single context only */
 #define  PREFETCH_ENABLE              0U
 #define  INSTRUCTION_CACHE_ENABLE     1U
 #define  DATA_CACHE_ENABLE            1U
@@ -231,6 +234,10 @@
   #include "stm32wbxx_hal_flash.h"
 #endif /* HAL_FLASH_MODULE_ENABLED */
 
+#ifdef HAL_EEPROM_EMUL_MODULE_ENABLED
+  #include "stm32wbxx_hal_eeprom_emul.h"
+#endif /* HAL_EEPROM_EMUL_MODULE_ENABLED */
+
 #ifdef HAL_GPIO_MODULE_ENABLED
   #include "stm32wbxx_hal_gpio.h"
 #endif /* HAL_GPIO_MODULE_ENABLED */
@@ -88,6 +88,40 @@ typedef enum
 #if (USE_RTOS == 1)
   /* Reserved for future use */
   #error " USE_RTOS should be 0 in the current HAL release "
+#elif defined (USE_HAL_NO_LOCK) && (USE_HAL_NO_LOCK == 1U)
+  /* Single execution context: the HAL handles are never accessed concurrently,
+     the locks are compiled out */
+  #define __HAL_LOCK(__HANDLE__)                                           \
+                                do{                                        \
+                                  }while (0)
+
+  #define __HAL_UNLOCK(__HANDLE__)                                          \
+                                  do{                                       \
+                                    }while (0)
+#elif defined (USE_HAL_ATOMIC_LOCK) && (USE_HAL_ATOMIC_LOCK == 1U)
+  /* Atomic test-and-set of the Lock field with exclusive accesses: an interrupt
+     taking the lock between the test and the set makes the store fail and the
+     test is done again. The exclusive access is on the first byte of the Lock
+     field, which holds the whole value whatever the enum size */
+  #define __HAL_LOCK(__HANDLE__)                                                              \
+                                do{                                                         \
+                                    do{                                                     \
+                                        if(__LDREXB((volatile uint8_t *)&(__HANDLE__)->Lock) \
+                                           == (uint8_t)HAL_LOCKED)                          \
+                                        {                                                   \
+                                           __CLREX();                                       \
+                                           return HAL_BUSY;                                 \
+                                        }                                                   \
+                                      }while(__STREXB((uint8_t)HAL_LOCKED,                  \
+                                             (volatile uint8_t *)&(__HANDLE__)->Lock) != 0U); \
+                                    __DMB();                                                \
+                                  }while (0)
+
+  #define __HAL_UNLOCK(__HANDLE__)                                          \
+                                  do{                                       \
+                                      __DMB();                              \
+                                      (__HANDLE__)->Lock = HAL_UNLOCKED;    \
+                                    }while (0)
 #else
   #define __HAL_LOCK(__HANDLE__)                                           \
                                 do{                                        \
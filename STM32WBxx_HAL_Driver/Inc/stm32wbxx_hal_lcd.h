@@ -103,6 +103,10 @@ typedef struct
 
   __IO uint32_t                 ErrorCode;  /* LCD Error code */
 
+  uint32_t                      ShadowRAM[16]; /* Shadow copy of the LCD RAM registers */
+
+  uint32_t                      ShadowDirty;   /* Mask of the LCD RAM registers to be committed */
+
 } LCD_HandleTypeDef;
 /**
   * @}
@@ -600,6 +604,10 @@ void                 HAL_LCD_MspDeInit(LCD_HandleTypeDef *hlcd);
 HAL_StatusTypeDef    HAL_LCD_Write(LCD_HandleTypeDef *hlcd, uint32_t RAMRegisterIndex, uint32_t RAMRegisterMask, uint32_t Data);
 HAL_StatusTypeDef    HAL_LCD_Clear(LCD_HandleTypeDef *hlcd);
 HAL_StatusTypeDef    HAL_LCD_UpdateDisplayRequest(LCD_HandleTypeDef *hlcd);
+HAL_StatusTypeDef    HAL_LCD_ShadowWrite(LCD_HandleTypeDef *hlcd, uint32_t RAMRegisterIndex, uint32_t RAMRegisterMask, uint32_t Data);
+HAL_StatusTypeDef    HAL_LCD_ShadowCommit_IT(LCD_HandleTypeDef *hlcd);
+void                 HAL_LCD_IRQHandler(LCD_HandleTypeDef *hlcd);
+void                 HAL_LCD_UpdateDisplayDoneCallback(LCD_HandleTypeDef *hlcd);
 /**
   * @}
   */
@@ -99,15 +99,13 @@ typedef enum
   * @brief  PKA handle Structure definition
   * @{
   */
-#if (USE_HAL_PKA_REGISTER_CALLBACKS == 1)
 typedef struct __PKA_HandleTypeDef
-#else
-typedef struct
-#endif  /* USE_HAL_PKA_REGISTER_CALLBACKS */
 {
   PKA_TypeDef                   *Instance;              /*!< Register base address */
   __IO HAL_PKA_StateTypeDef     State;                  /*!< PKA state */
   __IO uint32_t                 ErrorCode;              /*!< PKA Error code */
+  struct __PKA_QueueOpTypeDef   *pQueueHead;            /*!< Operation running or next to run, NULL when the queue is empty */
+  struct __PKA_QueueOpTypeDef   *pQueueTail;            /*!< Last queued operation */
 #if (USE_HAL_PKA_REGISTER_CALLBACKS == 1)
   void (* OperationCpltCallback)(struct __PKA_HandleTypeDef *hpka); /*!< PKA End of operation callback */
   void (* ErrorCallback)(struct __PKA_HandleTypeDef *hpka);         /*!< PKA Error callback            */
@@ -242,7 +240,7 @@ typedef struct
   const uint8_t *pExp;                 /*!< Pointer to Exponent             (Array of expSize elements) */
   const uint8_t *pOp1;                 /*!< Pointer to Operand              (Array of OpSize elements) */
   const uint8_t *pMod;                 /*!< Pointer to modulus              (Array of OpSize elements) */
-  const uint32_t *pMontgomeryParam;    /*!< Pointer to Montgomery parameter (Array of expSize/4 elements) */
+  const uint32_t *pMontgomeryParam;    /*!< Pointer to Montgomery parameter (Array of OpSize/4 elements) */
 } PKA_ModExpFastModeInTypeDef;
 
 typedef struct
@@ -281,6 +279,45 @@ typedef struct
   const uint8_t  *pOp3;                /*!< Pointer to Operand 3 (Array of size*4 elements) */
 } PKA_ModAddInTypeDef, PKA_ModSubInTypeDef, PKA_MontgomeryMulInTypeDef;
 
+/**
+  * @}
+  */
+
+/** @defgroup PKA_Queue PKA operation queue and Montgomery cache structure definition
+  * @brief  Queued operation and Montgomery parameter cache definition
+  * @{
+  */
+typedef struct __PKA_QueueOpTypeDef
+{
+  uint32_t Mode;                       /*!< PKA operation, a value of @ref PKA_Mode */
+  const void *pIn;                     /*!< Pointer to the input structure of the operation, for instance
+                                            PKA_ModExpInTypeDef for PKA_MODE_MODULAR_EXP */
+  void (* CpltCallback)(struct __PKA_HandleTypeDef *hpka, struct __PKA_QueueOpTypeDef *pOp); /*!< Called
+                                            from the PKA interrupt at the end of the operation, before the next
+                                            one is started: the result is read here with the GetResult functions */
+  void *pUserData;                     /*!< Free for the application */
+  __IO uint32_t ErrorCode;             /*!< Operation error code, a combination of @ref PKA_Error_Code_definition */
+  struct __PKA_QueueOpTypeDef *pNext;  /*!< Next queued operation, managed by the driver */
+} PKA_QueueOpTypeDef;
+
+typedef struct
+{
+  const uint8_t *pMod;                 /*!< Pointer to the cached modulus, NULL when the entry is free */
+  uint32_t modSize;                    /*!< Number of element in pMod array */
+  uint32_t fingerprint;                /*!< Fingerprint of the modulus, computed when the entry is filled */
+  uint32_t *pMontgomeryParam;          /*!< Pointer to the Montgomery parameter storage, set by the application */
+  uint32_t paramSize;                  /*!< Number of element in pMontgomeryParam array, (modSize+3)/4 at least */
+} PKA_MontgomeryCacheEntryTypeDef;
+
+typedef struct
+{
+  PKA_MontgomeryCacheEntryTypeDef *pEntries; /*!< Pointer to the entries (Array of NbEntries elements) */
+  uint32_t NbEntries;                  /*!< Number of element in pEntries array */
+  uint32_t NextEntry;                  /*!< Next entry replaced when the cache is full */
+  uint32_t HitCount;                   /*!< Number of parameters found in the cache */
+  uint32_t MissCount;                  /*!< Number of parameters computed and added to the cache */
+} PKA_MontgomeryCacheTypeDef;
+
 /**
   * @}
   */
@@ -443,6 +480,31 @@ typedef struct
   */
 
 /* Private macros --------------------------------------------------------*/
+/** @defgroup PKA_Private_Macros PKA Private Macros
+  * @{
+  */
+#define IS_PKA_QUEUE_MODE(__MODE__) (((__MODE__) == PKA_MODE_MONTGOMERY_PARAM)      || \
+                                     ((__MODE__) == PKA_MODE_MODULAR_EXP)           || \
+                                     ((__MODE__) == PKA_MODE_MODULAR_EXP_FAST_MODE) || \
+                                     ((__MODE__) == PKA_MODE_ECC_MUL)               || \
+                                     ((__MODE__) == PKA_MODE_ECC_MUL_FAST_MODE)     || \
+                                     ((__MODE__) == PKA_MODE_ECDSA_SIGNATURE)       || \
+                                     ((__MODE__) == PKA_MODE_ECDSA_VERIFICATION)    || \
+                                     ((__MODE__) == PKA_MODE_POINT_CHECK)           || \
+                                     ((__MODE__) == PKA_MODE_RSA_CRT_EXP)           || \
+                                     ((__MODE__) == PKA_MODE_MODULAR_INV)           || \
+                                     ((__MODE__) == PKA_MODE_ARITHMETIC_ADD)        || \
+                                     ((__MODE__) == PKA_MODE_ARITHMETIC_SUB)        || \
+                                     ((__MODE__) == PKA_MODE_ARITHMETIC_MUL)        || \
+                                     ((__MODE__) == PKA_MODE_COMPARISON)            || \
+                                     ((__MODE__) == PKA_MODE_MODULAR_RED)           || \
+                                     ((__MODE__) == PKA_MODE_MODULAR_ADD)           || \
+                                     ((__MODE__) == PKA_MODE_MODULAR_SUB)           || \
+                                     ((__MODE__) == PKA_MODE_MONTGOMERY_MUL))
+/**
+  * @}
+  */
+
 /* Exported functions --------------------------------------------------------*/
 /** @addtogroup PKA_Exported_Functions
   * @{
@@ -544,6 +606,24 @@ uint32_t             HAL_PKA_GetError(PKA_HandleTypeDef *hpka);
   * @}
   */
 
+/** @addtogroup PKA_Exported_Functions_Group4
+  * @{
+  */
+/* Operation queue functions **************************************************/
+HAL_StatusTypeDef HAL_PKA_Queue_Submit(PKA_HandleTypeDef *hpka, PKA_QueueOpTypeDef *pOp);
+uint32_t HAL_PKA_Queue_IsEmpty(PKA_HandleTypeDef const *const hpka);
+
+/* Montgomery parameter cache functions ***************************************/
+void HAL_PKA_MontgomeryCache_Init(PKA_MontgomeryCacheTypeDef *cache, PKA_MontgomeryCacheEntryTypeDef *pEntries, uint32_t NbEntries);
+const uint32_t *HAL_PKA_MontgomeryCache_Lookup(PKA_MontgomeryCacheTypeDef *cache, const uint8_t *pMod, uint32_t modSize);
+const uint32_t *HAL_PKA_MontgomeryCache_Store(PKA_HandleTypeDef *hpka, PKA_MontgomeryCacheTypeDef *cache, const uint8_t *pMod, uint32_t modSize);
+HAL_StatusTypeDef HAL_PKA_MontgomeryCache_Get(PKA_HandleTypeDef *hpka, PKA_MontgomeryCacheTypeDef *cache, const uint8_t *pMod, uint32_t modSize, const uint32_t **ppParam, uint32_t Timeout);
+HAL_StatusTypeDef HAL_PKA_ModExpCached(PKA_HandleTypeDef *hpka, PKA_MontgomeryCacheTypeDef *cache, PKA_ModExpInTypeDef *in, uint32_t Timeout);
+HAL_StatusTypeDef HAL_PKA_ECCMulCached(PKA_HandleTypeDef *hpka, PKA_MontgomeryCacheTypeDef *cache, PKA_ECCMulInTypeDef *in, uint32_t Timeout);
+/**
+  * @}
+  */
+
 /**
   * @}
   */
@@ -105,6 +105,37 @@ typedef struct
   uint32_t SamplingIOs; /*!< Sampling IOs mask */
 } TSC_IOConfigTypeDef;
 
+/**
+  * @brief TSC scan key structure definition
+  */
+typedef struct
+{
+  uint32_t Measure;   /*!< Filtered acquisition value, with TSC_SCAN_FRACTION_BITS fractional bits */
+  uint32_t Baseline;  /*!< Untouched reference value, same format. 0 until the key is calibrated */
+} TSC_KeyTypeDef;
+
+/**
+  * @brief TSC scan structure definition
+  */
+typedef struct
+{
+  const TSC_IOConfigTypeDef *pBanks; /*!< Banks of IOs, the groups of a bank are acquired in parallel.
+                                          At most one channel IO per group in each bank */
+  uint32_t NbBanks;                  /*!< Number of banks
+                                          This parameter must be a number between Min_Data = 1 and Max_Data = TSC_SCAN_MAX_BANKS */
+  TSC_KeyTypeDef *pKeys;             /*!< Keys, NbBanks * TSC_NB_OF_GROUPS entries. The key of group index g
+                                          in bank b is pKeys[(b * TSC_NB_OF_GROUPS) + g] */
+  uint32_t FilterShift;              /*!< Measure filter weight is 1 / 2^FilterShift, 0 to disable the filter */
+  uint32_t BaselineShift;            /*!< Baseline tracking weight is 1 / 2^BaselineShift */
+  uint32_t TouchThreshold;           /*!< Baseline minus measure, in counts, from which a key is touched */
+  uint32_t ReleaseThreshold;         /*!< Baseline minus measure, in counts, up to which a touched key is released */
+  uint32_t DischargeCycles;          /*!< Loop iterations between two banks to discharge the capacitors,
+                                          IODefaultMode must be TSC_IODEF_OUT_PP_LOW */
+  uint32_t TouchedKeys;              /*!< Touched keys mask, bit (b * TSC_NB_OF_GROUPS) + g for key g of bank b */
+  uint32_t ChangedKeys;              /*!< Keys mask whose touched state changed during the last scan */
+  uint32_t CurrentBank;              /*!< Bank under acquisition */
+} TSC_ScanTypeDef;
+
 /**
   * @brief  TSC handle Structure definition
   */
@@ -119,10 +150,12 @@ typedef struct
   __IO HAL_TSC_StateTypeDef State;      /*!< Peripheral state           */
   HAL_LockTypeDef           Lock;       /*!< Lock feature               */
   __IO uint32_t             ErrorCode;  /*!< TSC Error code             */
+  TSC_ScanTypeDef           *pScan;     /*!< Scan on-going, NULL if none */
 
 #if (USE_HAL_TSC_REGISTER_CALLBACKS == 1)
   void (* ConvCpltCallback)(struct __TSC_HandleTypeDef *htsc);   /*!< TSC Conversion complete callback  */
   void (* ErrorCallback)(struct __TSC_HandleTypeDef *htsc);      /*!< TSC Error callback                */
+  void (* ScanCpltCallback)(struct __TSC_HandleTypeDef *htsc);   /*!< TSC Scan complete callback        */
 
   void (* MspInitCallback)(struct __TSC_HandleTypeDef *htsc);    /*!< TSC Msp Init callback             */
   void (* MspDeInitCallback)(struct __TSC_HandleTypeDef *htsc);  /*!< TSC Msp DeInit callback           */
@@ -152,7 +185,9 @@ typedef enum
   HAL_TSC_ERROR_CB_ID                   = 0x01UL,  /*!< TSC Error callback ID                 */
 
   HAL_TSC_MSPINIT_CB_ID                 = 0x02UL,  /*!< TSC Msp Init callback ID              */
-  HAL_TSC_MSPDEINIT_CB_ID               = 0x03UL   /*!< TSC Msp DeInit callback ID            */
+  HAL_TSC_MSPDEINIT_CB_ID               = 0x03UL,  /*!< TSC Msp DeInit callback ID            */
+
+  HAL_TSC_SCAN_COMPLETE_CB_ID           = 0x04UL   /*!< TSC Scan completed callback ID        */
 
 } HAL_TSC_CallbackIDTypeDef;
 
@@ -184,6 +219,15 @@ typedef  void (*pTSC_CallbackTypeDef)(TSC_HandleTypeDef *htsc); /*!< pointer to
   * @}
   */
 
+/** @defgroup TSC_Scan_Config TSC Scan configuration
+  * @{
+  */
+#define TSC_SCAN_MAX_BANKS      4UL   /*!< Maximum number of banks in a scan, so that all keys fit a 32-bit mask */
+#define TSC_SCAN_FRACTION_BITS  4UL   /*!< Fractional bits of the filtered measures and baselines */
+/**
+  * @}
+  */
+
 /** @defgroup TSC_CTPulseHL_Config CTPulse High Length
   * @{
   */
@@ -644,6 +688,8 @@ typedef  void (*pTSC_CallbackTypeDef)(TSC_HandleTypeDef *htsc); /*!< pointer to
 
 #define IS_TSC_MCE_IT(__VALUE__)        (((FunctionalState)(__VALUE__) == DISABLE) || ((FunctionalState)(__VALUE__) == ENABLE))
 
+#define IS_TSC_SCAN_BANKS(__VALUE__)    (((__VALUE__) > 0UL) && ((__VALUE__) <= TSC_SCAN_MAX_BANKS))
+
 #define IS_TSC_GROUP_INDEX(__VALUE__)   (((__VALUE__) == 0UL) || (((__VALUE__) > 0UL) && ((__VALUE__) < (uint32_t)TSC_NB_OF_GROUPS)))
 
 #define IS_TSC_GROUP(__VALUE__)         (((__VALUE__) == 0UL)                               ||\
@@ -713,6 +759,8 @@ HAL_StatusTypeDef HAL_TSC_Stop_IT(TSC_HandleTypeDef *htsc);
 HAL_StatusTypeDef HAL_TSC_PollForAcquisition(TSC_HandleTypeDef *htsc);
 TSC_GroupStatusTypeDef HAL_TSC_GroupGetStatus(TSC_HandleTypeDef *htsc, uint32_t gx_index);
 uint32_t HAL_TSC_GroupGetValue(TSC_HandleTypeDef *htsc, uint32_t gx_index);
+HAL_StatusTypeDef HAL_TSC_Scan_Init(TSC_HandleTypeDef *htsc, TSC_ScanTypeDef *pScan);
+HAL_StatusTypeDef HAL_TSC_Scan_Start_IT(TSC_HandleTypeDef *htsc, TSC_ScanTypeDef *pScan);
 /**
   * @}
   */
@@ -743,6 +791,7 @@ HAL_TSC_StateTypeDef HAL_TSC_GetState(TSC_HandleTypeDef *htsc);
 void HAL_TSC_IRQHandler(TSC_HandleTypeDef *htsc);
 void HAL_TSC_ConvCpltCallback(TSC_HandleTypeDef *htsc);
 void HAL_TSC_ErrorCallback(TSC_HandleTypeDef *htsc);
+void HAL_TSC_ScanCpltCallback(TSC_HandleTypeDef *htsc);
 /**
   * @}
   */
@@ -612,6 +612,9 @@ HAL_StatusTypeDef FLASH_WaitForLastOperation(uint32_t Timeout)
      flag will be set */
   while (__HAL_FLASH_GET_FLAG(FLASH_FLAG_BSY))
   {
+    /* Let the application yield or sleep while waiting */
+    HAL_WaitHook(HAL_WAIT_FLASH, NULL);
+
     if ((HAL_GetTick() - tickstart) >= Timeout)
     {
       return HAL_TIMEOUT;
@@ -645,6 +648,9 @@ HAL_StatusTypeDef FLASH_WaitForLastOperation(uint32_t Timeout)
   /* Wait for control register to be written */
   while (__HAL_FLASH_GET_FLAG(FLASH_FLAG_CFGBSY))
   {
+    /* Let the application yield or sleep while waiting */
+    HAL_WaitHook(HAL_WAIT_FLASH, NULL);
+
     if ((HAL_GetTick() - tickstart) >= Timeout)
     {
       return HAL_TIMEOUT;
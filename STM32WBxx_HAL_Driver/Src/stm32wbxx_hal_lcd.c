@@ -60,6 +60,13 @@
       (#) When LCD RAM memory is updated enable the update display request using
           the HAL_LCD_UpdateDisplayRequest() API.
 
+      (#) Alternatively, update the segments in the shadow copy of the LCD RAM using
+          the HAL_LCD_ShadowWrite() API, which never waits for the LCD, then commit them
+          using the HAL_LCD_ShadowCommit_IT() API: only the modified LCD RAM registers
+          are written, followed by a single update display request. The end of the
+          update is notified by HAL_LCD_UpdateDisplayDoneCallback(), called from
+          HAL_LCD_IRQHandler() which must be called from LCD_IRQHandler().
+
       [..] LCD and low power modes:
            (#) The LCD remain active during Sleep, Low Power run, Low Power Sleep and
                STOP modes.
@@ -184,6 +191,13 @@ HAL_StatusTypeDef HAL_LCD_Init(LCD_HandleTypeDef *hlcd)
   {
     hlcd->Instance->RAM[counter] = 0;
   }
+
+  /* Clear the shadow copy of the LCD_RAM registers */
+  for (counter = LCD_RAM_REGISTER0; counter <= LCD_RAM_REGISTER15; counter++)
+  {
+    hlcd->ShadowRAM[counter] = 0U;
+  }
+  hlcd->ShadowDirty = 0U;
   /* Enable the display request */
   /* hlcd->Instance->SR |= LCD_SR_UDR */
   /* Configure the LCD Prescaler, Divider, Blink mode and Blink Frequency:
@@ -349,6 +363,13 @@ __weak void HAL_LCD_MspInit(LCD_HandleTypeDef *hlcd)
  [..] The update will not occur (UDR = 1 and UDD = 0) until the display is
  enabled (LCDEN = 1).
 
+ [..] The HAL_LCD_ShadowWrite() API updates a shadow copy of the LCD_RAM kept in the
+ handle, so that the application never waits for the frame timing. The
+ HAL_LCD_ShadowCommit_IT() API then writes the modified LCD_RAM registers only,
+ sets the UDR flag once and returns: the UDD interrupt completes the update and
+ calls HAL_LCD_UpdateDisplayDoneCallback(). The shadow copy can be modified again
+ while a commit is on-going, the changes are written by the next commit.
+
 @endverbatim
   * @{
   */
@@ -519,6 +540,156 @@ HAL_StatusTypeDef HAL_LCD_UpdateDisplayRequest(LCD_HandleTypeDef *hlcd)
   return HAL_OK;
 }
 
+/**
+  * @brief  Write a word in the shadow copy of the specific LCD RAM.
+  * @note   The LCD RAM is not accessed: the modified registers are written by the
+  *         next call to HAL_LCD_ShadowCommit_IT().
+  * @param hlcd LCD handle
+  * @param RAMRegisterIndex specifies the LCD RAM Register.
+  *   This parameter can be one of the LCD_RAM_REGISTERx values, x from 0 to 15.
+  * @param RAMRegisterMask specifies the LCD RAM Register Data Mask.
+  * @param Data specifies LCD Data Value to be written.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_LCD_ShadowWrite(LCD_HandleTypeDef *hlcd, uint32_t RAMRegisterIndex, uint32_t RAMRegisterMask, uint32_t Data)
+{
+  uint32_t value;
+  HAL_LCD_StateTypeDef state = hlcd->State;
+
+  if ((state == HAL_LCD_STATE_READY) || (state == HAL_LCD_STATE_BUSY))
+  {
+    /* Check the parameters */
+    assert_param(IS_LCD_RAM_REGISTER(RAMRegisterIndex));
+
+    /* Same masking as HAL_LCD_Write() */
+    value = (hlcd->ShadowRAM[RAMRegisterIndex] & RAMRegisterMask) | Data;
+
+    if (value != hlcd->ShadowRAM[RAMRegisterIndex])
+    {
+      hlcd->ShadowRAM[RAMRegisterIndex] = value;
+      hlcd->ShadowDirty |= (1UL << RAMRegisterIndex);
+    }
+
+    return HAL_OK;
+  }
+  else
+  {
+    return HAL_ERROR;
+  }
+}
+
+/**
+  * @brief  Commit the shadow copy to the LCD RAM and request the display update
+  *         in interrupt mode.
+  * @note   Only the LCD RAM registers modified since the previous commit are written,
+  *         then the UDR flag is set once. The function does not wait for the update:
+  *         HAL_LCD_UpdateDisplayDoneCallback() is called at the end of the update.
+  * @note   The LCD interrupt must be enabled in the NVIC.
+  * @param hlcd LCD handle
+  * @retval HAL status, HAL_BUSY if the previous update is not completed yet.
+  */
+HAL_StatusTypeDef HAL_LCD_ShadowCommit_IT(LCD_HandleTypeDef *hlcd)
+{
+  uint32_t dirty;
+  uint32_t counter;
+
+  if (hlcd->State == HAL_LCD_STATE_BUSY)
+  {
+    return HAL_BUSY;
+  }
+
+  if (hlcd->State != HAL_LCD_STATE_READY)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Nothing to display */
+  if (hlcd->ShadowDirty == 0U)
+  {
+    return HAL_OK;
+  }
+
+  /* Process Locked */
+  __HAL_LOCK(hlcd);
+
+  /* The LCD RAM is write protected until the end of an update requested outside of this API */
+  if (__HAL_LCD_GET_FLAG(hlcd, LCD_FLAG_UDR) != RESET)
+  {
+    /* Process Unlocked */
+    __HAL_UNLOCK(hlcd);
+
+    return HAL_BUSY;
+  }
+
+  hlcd->State = HAL_LCD_STATE_BUSY;
+
+  /* Copy the modified registers only */
+  dirty = hlcd->ShadowDirty;
+  hlcd->ShadowDirty = 0U;
+  for (counter = LCD_RAM_REGISTER0; counter <= LCD_RAM_REGISTER15; counter++)
+  {
+    if ((dirty & (1UL << counter)) != 0U)
+    {
+      hlcd->Instance->RAM[counter] = hlcd->ShadowRAM[counter];
+    }
+  }
+
+  /* Clear the Update Display Done flag before starting the update display request */
+  __HAL_LCD_CLEAR_FLAG(hlcd, LCD_FLAG_UDD);
+
+  /* Wait for the synchronization of the UDDIE clearing of the previous commit,
+     then enable the Update Display Done interrupt */
+  (void)LCD_WaitForSynchro(hlcd);
+  __HAL_LCD_ENABLE_IT(hlcd, LCD_IT_UDD);
+
+  /* Enable the display request */
+  hlcd->Instance->SR |= LCD_SR_UDR;
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(hlcd);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Handle LCD interrupt request.
+  * @param hlcd LCD handle
+  * @retval None
+  */
+void HAL_LCD_IRQHandler(LCD_HandleTypeDef *hlcd)
+{
+  /* Update Display Done interrupt */
+  if ((__HAL_LCD_GET_IT_SOURCE(hlcd, LCD_IT_UDD) != 0U) && (__HAL_LCD_GET_FLAG(hlcd, LCD_FLAG_UDD) != RESET))
+  {
+    /* Clear the Update Display Done flag */
+    __HAL_LCD_CLEAR_FLAG(hlcd, LCD_FLAG_UDD);
+
+    /* Disable the Update Display Done interrupt: the LCD_FCR synchronization is not
+       waited for in interrupt context, but by the next HAL_LCD_ShadowCommit_IT() */
+    CLEAR_BIT(hlcd->Instance->FCR, LCD_IT_UDD);
+
+    hlcd->State = HAL_LCD_STATE_READY;
+
+    /* Update display done callback */
+    HAL_LCD_UpdateDisplayDoneCallback(hlcd);
+  }
+}
+
+/**
+  * @brief  Update display done callback.
+  * @param hlcd LCD handle
+  * @retval None
+  */
+__weak void HAL_LCD_UpdateDisplayDoneCallback(LCD_HandleTypeDef *hlcd)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hlcd);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_LCD_UpdateDisplayDoneCallback could be implemented in the user file
+   */
+}
+
 /**
   * @}
   */
@@ -144,6 +144,28 @@
       (++) HAL_PKA_MontgomeryParam_IT().
       (++) HAL_PKA_MontgomeryParam_GetResult() to retrieve the result of the operation.
 
+    *** Montgomery parameter cache ***
+    =================================
+      (+) Provide the entries and their parameter storage, then call HAL_PKA_MontgomeryCache_Init().
+      (+) HAL_PKA_MontgomeryCache_Get() returns the parameter of a modulus, computed only when the
+          modulus is not in the cache. The modulus buffer must be kept unchanged while it is cached.
+      (+) HAL_PKA_ModExpCached() and HAL_PKA_ECCMulCached() run the fast mode operations with the
+          cached parameter.
+      (+) HAL_PKA_MontgomeryCache_Lookup() and HAL_PKA_MontgomeryCache_Store() do not start any
+          operation, they can be used with the operation queue.
+
+    *** Operation queue ***
+    =================================
+      (+) Fill a PKA_QueueOpTypeDef with the operation mode, a pointer to its input structure
+          and a completion callback, then call HAL_PKA_Queue_Submit().
+      (+) The operations run in interrupt mode, in the submission order. The next operation is
+          started from the PKA interrupt, after the completion callback of the previous one.
+      (+) The result must be read in the completion callback with the GetResult function of the
+          operation: the PKA RAM is overwritten by the next operation.
+      (+) The input structure and the queued operation must be kept until the completion callback.
+      (+) The non-queued functions must not be used while the queue is not empty.
+      (+) HAL_PKA_Abort() empties the queue, the pending operations are dropped without callback.
+
     *** Polling mode operation ***
     ===================================
     [..]
@@ -300,6 +322,10 @@ void PKA_ModRed_Set(PKA_HandleTypeDef *hpka, PKA_ModRedInTypeDef *in);
 void PKA_ModInv_Set(PKA_HandleTypeDef *hpka, PKA_ModInvInTypeDef *in);
 void PKA_MontgomeryParam_Set(PKA_HandleTypeDef *hpka, const uint32_t size, const uint8_t *pOp1);
 void PKA_ARI_Set(PKA_HandleTypeDef *hpka, const uint32_t size, const uint32_t *pOp1, const uint32_t *pOp2, const uint8_t *pOp3);
+void PKA_Queue_Set(PKA_HandleTypeDef *hpka, PKA_QueueOpTypeDef *pOp);
+void PKA_Queue_Start(PKA_HandleTypeDef *hpka);
+void PKA_Queue_IRQHandler(PKA_HandleTypeDef *hpka);
+uint32_t PKA_MontgomeryCache_Fingerprint(const uint8_t *pMod, uint32_t modSize);
 /**
   * @}
   */
@@ -381,6 +407,10 @@ HAL_StatusTypeDef HAL_PKA_Init(PKA_HandleTypeDef *hpka)
     /* Initialize the error code */
     hpka->ErrorCode = HAL_PKA_ERROR_NONE;
 
+    /* Empty operation queue */
+    hpka->pQueueHead = NULL;
+    hpka->pQueueTail = NULL;
+
     /* Set the state to ready */
     hpka->State = HAL_PKA_STATE_READY;
   }
@@ -1506,6 +1536,10 @@ HAL_StatusTypeDef HAL_PKA_Abort(PKA_HandleTypeDef *hpka)
   /* Reset any pending flag */
   SET_BIT(hpka->Instance->CLRFR, PKA_CLRFR_PROCENDFC | PKA_CLRFR_RAMERRFC | PKA_CLRFR_ADDRERRFC);
 
+  /* Drop the queued operations */
+  hpka->pQueueHead = NULL;
+  hpka->pQueueTail = NULL;
+
   /* Reset the error code */
   hpka->ErrorCode = HAL_PKA_ERROR_NONE;
 
@@ -1544,6 +1578,13 @@ void HAL_PKA_IRQHandler(PKA_HandleTypeDef *hpka)
   FlagStatus ramErrFlag = __HAL_PKA_GET_FLAG(hpka, PKA_FLAG_RAMERR);
   FlagStatus procEndFlag = __HAL_PKA_GET_FLAG(hpka, PKA_FLAG_PROCEND);
 
+  /* Queued operation: completion and chaining */
+  if (hpka->pQueueHead != NULL)
+  {
+    PKA_Queue_IRQHandler(hpka);
+    return;
+  }
+
   /* Address error interrupt occurred */
   if ((__HAL_PKA_GET_IT_SOURCE(hpka, PKA_IT_ADDRERR) == SET) && (addErrFlag == SET))
   {
@@ -1668,6 +1709,308 @@ uint32_t HAL_PKA_GetError(PKA_HandleTypeDef *hpka)
   return hpka->ErrorCode;
 }
 
+/**
+  * @}
+  */
+
+/** @defgroup PKA_Exported_Functions_Group4 Operation queue and Montgomery cache functions
+ *  @brief   Operation queue and Montgomery cache functions
+ *
+  @verbatim
+ ===============================================================================
+          ##### Operation queue and Montgomery cache functions #####
+ ===============================================================================
+    [..]
+    This subsection provides functions allowing to:
+      (+) Queue operations chained from the PKA interrupt
+      (+) Cache the Montgomery parameters of the curves and moduli in use
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Queue an operation, started in interrupt mode once the previous ones are completed.
+  * @note   The operation is started immediately when the PKA is idle.
+  * @note   pOp->CpltCallback is called from the PKA interrupt with pOp->ErrorCode set,
+  *         it can queue new operations.
+  * @param  hpka PKA handle
+  * @param  pOp Operation to queue
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_PKA_Queue_Submit(PKA_HandleTypeDef *hpka, PKA_QueueOpTypeDef *pOp)
+{
+  uint32_t primask_bit;
+  uint32_t start = 0UL;
+
+  if ((pOp == NULL) || (pOp->pIn == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the parameters */
+  assert_param(IS_PKA_QUEUE_MODE(pOp->Mode));
+
+  pOp->ErrorCode = HAL_PKA_ERROR_NONE;
+  pOp->pNext = NULL;
+
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  /* A non-queued operation is running */
+  if ((hpka->pQueueHead == NULL) && (hpka->State != HAL_PKA_STATE_READY))
+  {
+    __set_PRIMASK(primask_bit);
+    return HAL_ERROR;
+  }
+
+  if (hpka->pQueueHead == NULL)
+  {
+    hpka->pQueueHead = pOp;
+  }
+  else
+  {
+    hpka->pQueueTail->pNext = pOp;
+  }
+  hpka->pQueueTail = pOp;
+
+  /* PKA idle: start the head of the queue */
+  if (hpka->State == HAL_PKA_STATE_READY)
+  {
+    hpka->State = HAL_PKA_STATE_BUSY;
+    start = 1UL;
+  }
+
+  __set_PRIMASK(primask_bit);
+
+  if (start != 0UL)
+  {
+    PKA_Queue_Start(hpka);
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Check if all the queued operations are completed.
+  * @param  hpka PKA handle
+  * @retval 1 when the queue is empty, 0 otherwise
+  */
+uint32_t HAL_PKA_Queue_IsEmpty(PKA_HandleTypeDef const *const hpka)
+{
+  return (hpka->pQueueHead == NULL) ? 1UL : 0UL;
+}
+
+/**
+  * @brief  Initialize a Montgomery parameter cache.
+  * @note   pMontgomeryParam and paramSize of each entry must be set by the application
+  *         before the call, the other fields are reset.
+  * @param  cache Montgomery parameter cache
+  * @param  pEntries Entries of the cache
+  * @param  NbEntries Number of element in pEntries array
+  * @retval None
+  */
+void HAL_PKA_MontgomeryCache_Init(PKA_MontgomeryCacheTypeDef *cache, PKA_MontgomeryCacheEntryTypeDef *pEntries, uint32_t NbEntries)
+{
+  uint32_t index;
+
+  for (index = 0UL; index < NbEntries; index++)
+  {
+    pEntries[index].pMod = NULL;
+    pEntries[index].modSize = 0UL;
+    pEntries[index].fingerprint = 0UL;
+  }
+
+  cache->pEntries = pEntries;
+  cache->NbEntries = NbEntries;
+  cache->NextEntry = 0UL;
+  cache->HitCount = 0UL;
+  cache->MissCount = 0UL;
+}
+
+/**
+  * @brief  Search the Montgomery parameter of a modulus in the cache.
+  * @note   No PKA operation is started.
+  * @param  cache Montgomery parameter cache
+  * @param  pMod Pointer to the modulus (Array of modSize elements)
+  * @param  modSize Number of element in pMod array
+  * @retval Pointer to the cached parameter, NULL when the modulus is not in the cache
+  */
+const uint32_t *HAL_PKA_MontgomeryCache_Lookup(PKA_MontgomeryCacheTypeDef *cache, const uint8_t *pMod, uint32_t modSize)
+{
+  PKA_MontgomeryCacheEntryTypeDef *entry;
+  uint32_t fingerprint = PKA_MontgomeryCache_Fingerprint(pMod, modSize);
+  uint32_t index;
+  uint32_t byte;
+
+  for (index = 0UL; index < cache->NbEntries; index++)
+  {
+    entry = &cache->pEntries[index];
+
+    /* The fingerprint also detects a cached buffer modified by the application */
+    if ((entry->pMod != NULL) && (entry->modSize == modSize) && (entry->fingerprint == fingerprint))
+    {
+      byte = 0UL;
+      while ((byte < modSize) && (entry->pMod[byte] == pMod[byte]))
+      {
+        byte++;
+      }
+
+      if (byte == modSize)
+      {
+        cache->HitCount++;
+        return entry->pMontgomeryParam;
+      }
+    }
+  }
+
+  return NULL;
+}
+
+/**
+  * @brief  Add to the cache the Montgomery parameter computed by the last operation.
+  * @note   To be called at the end of a HAL_PKA_MontgomeryParam() or HAL_PKA_MontgomeryParam_IT()
+  *         operation on pMod, for instance from the completion callback of a queued operation.
+  * @note   When the cache is full, the entries are replaced in turn.
+  * @param  hpka PKA handle
+  * @param  cache Montgomery parameter cache
+  * @param  pMod Pointer to the modulus (Array of modSize elements), kept unchanged while cached
+  * @param  modSize Number of element in pMod array
+  * @retval Pointer to the cached parameter, NULL when no entry is large enough
+  */
+const uint32_t *HAL_PKA_MontgomeryCache_Store(PKA_HandleTypeDef *hpka, PKA_MontgomeryCacheTypeDef *cache, const uint8_t *pMod, uint32_t modSize)
+{
+  PKA_MontgomeryCacheEntryTypeDef *entry;
+  uint32_t words = (modSize + 3UL) / 4UL;
+  uint32_t count;
+  uint32_t index;
+
+  for (count = 0UL; count < cache->NbEntries; count++)
+  {
+    entry = &cache->pEntries[cache->NextEntry];
+    cache->NextEntry = (cache->NextEntry + 1UL) % cache->NbEntries;
+
+    if (entry->paramSize >= words)
+    {
+      /* The fast mode operations read modSize/4 words, the result may be shorter */
+      for (index = 0UL; index < words; index++)
+      {
+        entry->pMontgomeryParam[index] = 0UL;
+      }
+      HAL_PKA_MontgomeryParam_GetResult(hpka, entry->pMontgomeryParam);
+
+      entry->pMod = pMod;
+      entry->modSize = modSize;
+      entry->fingerprint = PKA_MontgomeryCache_Fingerprint(pMod, modSize);
+      cache->MissCount++;
+
+      return entry->pMontgomeryParam;
+    }
+  }
+
+  return NULL;
+}
+
+/**
+  * @brief  Get the Montgomery parameter of a modulus, computed in blocking mode when not cached.
+  * @param  hpka PKA handle
+  * @param  cache Montgomery parameter cache
+  * @param  pMod Pointer to the modulus (Array of modSize elements), kept unchanged while cached
+  * @param  modSize Number of element in pMod array
+  * @param  ppParam Pointer to the returned parameter pointer
+  * @param  Timeout Timeout duration
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_PKA_MontgomeryCache_Get(PKA_HandleTypeDef *hpka, PKA_MontgomeryCacheTypeDef *cache, const uint8_t *pMod, uint32_t modSize, const uint32_t **ppParam, uint32_t Timeout)
+{
+  PKA_MontgomeryParamInTypeDef in;
+  const uint32_t *pParam;
+
+  pParam = HAL_PKA_MontgomeryCache_Lookup(cache, pMod, modSize);
+
+  if (pParam == NULL)
+  {
+    in.size = modSize;
+    in.pOp1 = pMod;
+
+    if (HAL_PKA_MontgomeryParam(hpka, &in, Timeout) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+
+    pParam = HAL_PKA_MontgomeryCache_Store(hpka, cache, pMod, modSize);
+    if (pParam == NULL)
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  *ppParam = pParam;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Modular exponentiation in fast mode with the cached Montgomery parameter, in blocking mode.
+  * @note   Timeout applies to each of the Montgomery parameter and exponentiation operations.
+  * @param  hpka PKA handle
+  * @param  cache Montgomery parameter cache
+  * @param  in Input information, in->pMod kept unchanged while cached
+  * @param  Timeout Timeout duration
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_PKA_ModExpCached(PKA_HandleTypeDef *hpka, PKA_MontgomeryCacheTypeDef *cache, PKA_ModExpInTypeDef *in, uint32_t Timeout)
+{
+  PKA_ModExpFastModeInTypeDef fastIn;
+  const uint32_t *pParam;
+
+  if (HAL_PKA_MontgomeryCache_Get(hpka, cache, in->pMod, in->OpSize, &pParam, Timeout) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  fastIn.expSize = in->expSize;
+  fastIn.OpSize = in->OpSize;
+  fastIn.pExp = in->pExp;
+  fastIn.pOp1 = in->pOp1;
+  fastIn.pMod = in->pMod;
+  fastIn.pMontgomeryParam = pParam;
+
+  return HAL_PKA_ModExpFastMode(hpka, &fastIn, Timeout);
+}
+
+/**
+  * @brief  ECC scalar multiplication in fast mode with the cached Montgomery parameter, in blocking mode.
+  * @note   Timeout applies to each of the Montgomery parameter and multiplication operations.
+  * @param  hpka PKA handle
+  * @param  cache Montgomery parameter cache
+  * @param  in Input information, in->modulus kept unchanged while cached
+  * @param  Timeout Timeout duration
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_PKA_ECCMulCached(PKA_HandleTypeDef *hpka, PKA_MontgomeryCacheTypeDef *cache, PKA_ECCMulInTypeDef *in, uint32_t Timeout)
+{
+  PKA_ECCMulFastModeInTypeDef fastIn;
+  const uint32_t *pParam;
+
+  if (HAL_PKA_MontgomeryCache_Get(hpka, cache, in->modulus, in->modulusSize, &pParam, Timeout) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  fastIn.scalarMulSize = in->scalarMulSize;
+  fastIn.modulusSize = in->modulusSize;
+  fastIn.coefSign = in->coefSign;
+  fastIn.coefA = in->coefA;
+  fastIn.modulus = in->modulus;
+  fastIn.pointX = in->pointX;
+  fastIn.pointY = in->pointY;
+  fastIn.scalarMul = in->scalarMul;
+  fastIn.pMontgomeryParam = pParam;
+
+  return HAL_PKA_ECCMulFastMode(hpka, &fastIn, Timeout);
+}
+
 /**
   * @}
   */
@@ -2066,8 +2409,8 @@ void PKA_ModExpFastMode_Set(PKA_HandleTypeDef *hpka, PKA_ModExpFastModeInTypeDef
   __PKA_RAM_PARAM_END(hpka->Instance->RAM, PKA_MODULAR_EXP_IN_MODULUS + (in->OpSize / 4UL));
 
   /* Move the Montgomery parameter to PKA RAM */
-  PKA_Memcpy_u32_to_u32(&hpka->Instance->RAM[PKA_MODULAR_EXP_IN_MONTGOMERY_PARAM], in->pMontgomeryParam, in->expSize / 4UL);
-  __PKA_RAM_PARAM_END(hpka->Instance->RAM, PKA_MODULAR_EXP_IN_MONTGOMERY_PARAM + (in->expSize / 4UL));
+  PKA_Memcpy_u32_to_u32(&hpka->Instance->RAM[PKA_MODULAR_EXP_IN_MONTGOMERY_PARAM], in->pMontgomeryParam, in->OpSize / 4UL);
+  __PKA_RAM_PARAM_END(hpka->Instance->RAM, PKA_MODULAR_EXP_IN_MONTGOMERY_PARAM + (in->OpSize / 4UL));
 }
 
 
@@ -2421,6 +2764,190 @@ void PKA_ARI_Set(PKA_HandleTypeDef *hpka, const uint32_t size, const uint32_t *p
   }
 }
 
+/**
+  * @brief  Set the input parameters of a queued operation.
+  * @param  hpka PKA handle
+  * @param  pOp Queued operation
+  */
+void PKA_Queue_Set(PKA_HandleTypeDef *hpka, PKA_QueueOpTypeDef *pOp)
+{
+  switch (pOp->Mode)
+  {
+    case PKA_MODE_MODULAR_EXP:
+      PKA_ModExp_Set(hpka, (PKA_ModExpInTypeDef *)pOp->pIn);
+      break;
+    case PKA_MODE_MODULAR_EXP_FAST_MODE:
+      PKA_ModExpFastMode_Set(hpka, (PKA_ModExpFastModeInTypeDef *)pOp->pIn);
+      break;
+    case PKA_MODE_ECDSA_SIGNATURE:
+      PKA_ECDSASign_Set(hpka, (PKA_ECDSASignInTypeDef *)pOp->pIn);
+      break;
+    case PKA_MODE_ECDSA_VERIFICATION:
+      PKA_ECDSAVerif_Set(hpka, (PKA_ECDSAVerifInTypeDef *)pOp->pIn);
+      break;
+    case PKA_MODE_RSA_CRT_EXP:
+      PKA_RSACRTExp_Set(hpka, (PKA_RSACRTExpInTypeDef *)pOp->pIn);
+      break;
+    case PKA_MODE_POINT_CHECK:
+      PKA_PointCheck_Set(hpka, (PKA_PointCheckInTypeDef *)pOp->pIn);
+      break;
+    case PKA_MODE_ECC_MUL:
+      PKA_ECCMul_Set(hpka, (PKA_ECCMulInTypeDef *)pOp->pIn);
+      break;
+    case PKA_MODE_ECC_MUL_FAST_MODE:
+      PKA_ECCMulFastMode_Set(hpka, (PKA_ECCMulFastModeInTypeDef *)pOp->pIn);
+      break;
+    case PKA_MODE_MODULAR_RED:
+      PKA_ModRed_Set(hpka, (PKA_ModRedInTypeDef *)pOp->pIn);
+      break;
+    case PKA_MODE_MODULAR_INV:
+      PKA_ModInv_Set(hpka, (PKA_ModInvInTypeDef *)pOp->pIn);
+      break;
+    case PKA_MODE_MONTGOMERY_PARAM:
+      PKA_MontgomeryParam_Set(hpka, ((const PKA_MontgomeryParamInTypeDef *)pOp->pIn)->size,
+                              ((const PKA_MontgomeryParamInTypeDef *)pOp->pIn)->pOp1);
+      break;
+    case PKA_MODE_ARITHMETIC_ADD:
+    case PKA_MODE_ARITHMETIC_SUB:
+    case PKA_MODE_ARITHMETIC_MUL:
+    case PKA_MODE_COMPARISON:
+      PKA_ARI_Set(hpka, ((const PKA_AddInTypeDef *)pOp->pIn)->size, ((const PKA_AddInTypeDef *)pOp->pIn)->pOp1,
+                  ((const PKA_AddInTypeDef *)pOp->pIn)->pOp2, NULL);
+      break;
+    default:
+      /* PKA_MODE_MODULAR_ADD, PKA_MODE_MODULAR_SUB and PKA_MODE_MONTGOMERY_MUL */
+      PKA_ARI_Set(hpka, ((const PKA_ModAddInTypeDef *)pOp->pIn)->size, ((const PKA_ModAddInTypeDef *)pOp->pIn)->pOp1,
+                  ((const PKA_ModAddInTypeDef *)pOp->pIn)->pOp2, ((const PKA_ModAddInTypeDef *)pOp->pIn)->pOp3);
+      break;
+  }
+}
+
+/**
+  * @brief  Start the operation at the head of the queue in interrupt mode.
+  * @note   The state must be set to busy by the caller.
+  * @param  hpka PKA handle
+  */
+void PKA_Queue_Start(PKA_HandleTypeDef *hpka)
+{
+  /* Set input parameter in PKA RAM */
+  PKA_Queue_Set(hpka, hpka->pQueueHead);
+
+  /* Clear any pending error */
+  hpka->ErrorCode = HAL_PKA_ERROR_NONE;
+
+  /* Set the mode and activate interrupts */
+  MODIFY_REG(hpka->Instance->CR, PKA_CR_MODE | PKA_CR_PROCENDIE | PKA_CR_RAMERRIE | PKA_CR_ADDRERRIE, (hpka->pQueueHead->Mode << PKA_CR_MODE_Pos) | PKA_CR_PROCENDIE | PKA_CR_RAMERRIE | PKA_CR_ADDRERRIE);
+
+  /* Start the computation */
+  hpka->Instance->CR |= PKA_CR_START;
+}
+
+/**
+  * @brief  Complete the running queued operation and start the next one.
+  * @param  hpka PKA handle
+  */
+void PKA_Queue_IRQHandler(PKA_HandleTypeDef *hpka)
+{
+  PKA_QueueOpTypeDef *pOp = hpka->pQueueHead;
+  uint32_t primask_bit;
+  uint32_t start = 0UL;
+
+  /* Address error interrupt occurred */
+  if ((__HAL_PKA_GET_IT_SOURCE(hpka, PKA_IT_ADDRERR) == SET) && (__HAL_PKA_GET_FLAG(hpka, PKA_FLAG_ADDRERR) == SET))
+  {
+    pOp->ErrorCode |= HAL_PKA_ERROR_ADDRERR;
+
+    /* Clear ADDRERR flag */
+    __HAL_PKA_CLEAR_FLAG(hpka, PKA_FLAG_ADDRERR);
+  }
+
+  /* RAM access error interrupt occurred */
+  if ((__HAL_PKA_GET_IT_SOURCE(hpka, PKA_IT_RAMERR) == SET) && (__HAL_PKA_GET_FLAG(hpka, PKA_FLAG_RAMERR) == SET))
+  {
+    pOp->ErrorCode |= HAL_PKA_ERROR_RAMERR;
+
+    /* Clear RAMERR flag */
+    __HAL_PKA_CLEAR_FLAG(hpka, PKA_FLAG_RAMERR);
+  }
+
+  if ((__HAL_PKA_GET_IT_SOURCE(hpka, PKA_IT_PROCEND) == SET) && (__HAL_PKA_GET_FLAG(hpka, PKA_FLAG_PROCEND) == SET))
+  {
+    /* Clear PROCEND flag */
+    __HAL_PKA_CLEAR_FLAG(hpka, PKA_FLAG_PROCEND);
+
+    /* Check the operation success in case of ECDSA signature */
+    if ((pOp->Mode == PKA_MODE_ECDSA_SIGNATURE) && (hpka->Instance->RAM[PKA_ECDSA_SIGN_OUT_ERROR] != 0UL))
+    {
+      pOp->ErrorCode |= HAL_PKA_ERROR_OPERATION;
+    }
+  }
+  else if (pOp->ErrorCode != HAL_PKA_ERROR_NONE)
+  {
+    /* Error before the end of the operation: abort it */
+    CLEAR_BIT(hpka->Instance->CR, PKA_CR_EN);
+    SET_BIT(hpka->Instance->CR, PKA_CR_EN);
+  }
+  else
+  {
+    /* Operation still running */
+    return;
+  }
+
+  hpka->ErrorCode = pOp->ErrorCode;
+
+  /* Remove the operation from the queue, the PKA is idle until the next start */
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+  hpka->pQueueHead = pOp->pNext;
+  if (hpka->pQueueHead == NULL)
+  {
+    hpka->pQueueTail = NULL;
+  }
+  hpka->State = HAL_PKA_STATE_READY;
+  __set_PRIMASK(primask_bit);
+
+  /* The result is still in the PKA RAM */
+  if (pOp->CpltCallback != NULL)
+  {
+    pOp->CpltCallback(hpka, pOp);
+  }
+
+  /* Start the next operation, unless started by a submission from the callback */
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+  if ((hpka->State == HAL_PKA_STATE_READY) && (hpka->pQueueHead != NULL))
+  {
+    hpka->State = HAL_PKA_STATE_BUSY;
+    start = 1UL;
+  }
+  __set_PRIMASK(primask_bit);
+
+  if (start != 0UL)
+  {
+    PKA_Queue_Start(hpka);
+  }
+}
+
+/**
+  * @brief  Compute the fingerprint of a modulus (FNV-1a).
+  * @param  pMod Pointer to the modulus (Array of modSize elements)
+  * @param  modSize Number of element in pMod array
+  * @retval Fingerprint
+  */
+uint32_t PKA_MontgomeryCache_Fingerprint(const uint8_t *pMod, uint32_t modSize)
+{
+  uint32_t fingerprint = 0x811C9DC5UL;
+  uint32_t index;
+
+  for (index = 0UL; index < modSize; index++)
+  {
+    fingerprint ^= (uint32_t)pMod[index];
+    fingerprint *= 0x01000193UL;
+  }
+
+  return fingerprint;
+}
+
 /**
   * @}
   */
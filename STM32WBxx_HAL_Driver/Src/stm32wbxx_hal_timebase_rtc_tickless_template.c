@@ -0,0 +1,353 @@
+/**
+  ******************************************************************************
+  * @file    stm32wbxx_hal_timebase_rtc_tickless_template.c
+  * @author  MCD Application Team
+  * @brief   HAL tickless time base based on the hardware RTC Template.
+  *
+  *          This file overrides the native HAL time base functions (defined as weak)
+  *          to use the RTC calendar as a tickless time base:
+  *           + Initializes the RTC peripheral with a sub-second resolution below 1ms
+  *           + HAL_GetTick() is computed from the RTC calendar and sub-second counter,
+  *             there is no periodic tick interrupt
+  *           + The RTC wakeup timer is used as a one-shot wake-up for tickless idle
+  *           + LSE (default) or LSI can be selected as RTC clock source, so that the
+  *             time base keeps counting in STOP0, STOP1 and STOP2 modes
+ @verbatim
+  ==============================================================================
+                        ##### How to use this driver #####
+  ==============================================================================
+    [..]
+    This file must be copied to the application folder and modified as follows:
+    (#) Rename it to 'stm32wbxx_hal_timebase_rtc_tickless.c'
+    (#) Add this file and the RTC HAL drivers to your project and uncomment
+       HAL_RTC_MODULE_ENABLED define in stm32wbxx_hal_conf.h
+
+    [..]
+    The RTC keeps running in STOP modes, so the time spent in low power mode is
+    counted by HAL_GetTick() without any compensation by the application, and
+    HAL_GetTick() stays monotonic across STOP2 entries and exits.
+    The RTC calendar must not be modified by the application (HAL_RTC_SetTime(),
+    HAL_RTC_SetDate(), daylight saving or shift operations), as this would move
+    HAL_GetTick() too.
+
+    [..] Tickless idle
+    (#) Call HAL_TIMEBASE_StartWakeUpMs() with the time to the next scheduled
+        deadline, then enter STOP2 mode with HAL_PWREx_EnterSTOP2Mode(). The RTC
+        wakeup timer interrupt wakes the core up at the latest at the deadline.
+    (#) Restore the system clock after the STOP mode exit, then call
+        HAL_TIMEBASE_StopWakeUp() when the core is woken up earlier by another
+        interrupt and the wake-up is no longer needed.
+
+    [..]
+    (@) The RTC wakeup timer is used by this time base: it can't be used by the
+        application.
+
+  @endverbatim
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2019 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32wbxx_hal.h"
+/** @addtogroup STM32WBxx_HAL_Driver
+  * @{
+  */
+
+/** @defgroup HAL_TimeBase_RTC_Tickless_Template  HAL TimeBase RTC Tickless Template
+  * @{
+  */
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+
+/* Uncomment the line below to select the appropriate RTC Clock source for your application:
+  + RTC_CLOCK_SOURCE_LSE: can be selected for applications requiring timing precision.
+  + RTC_CLOCK_SOURCE_LSI: can be selected for applications with low constraint on timing
+                          precision.
+  */
+#define RTC_CLOCK_SOURCE_LSE
+/* #define RTC_CLOCK_SOURCE_LSI */
+
+/* ck_apre = RTCCLK / 8 gives the sub-second resolution, ck_spre = 1Hz clocks the calendar */
+#ifdef RTC_CLOCK_SOURCE_LSE
+  #define RTC_CLOCK_VALUE         LSE_VALUE
+#else /* RTC_CLOCK_SOURCE_LSI */
+  #define RTC_CLOCK_VALUE         LSI1_VALUE
+#endif /* RTC_CLOCK_SOURCE_LSE */
+#define RTC_ASYNCH_PREDIV         7U
+#define RTC_SYNCH_PREDIV          ((RTC_CLOCK_VALUE / (RTC_ASYNCH_PREDIV + 1U)) - 1U)
+
+/* Wakeup timer clocked by RTCCLK / 16, up to 0x10000 periods */
+#define RTC_WAKEUP_FREQ           (RTC_CLOCK_VALUE / 16U)
+#define RTC_WAKEUP_MAX_MS         ((0x10000U * 1000U) / RTC_WAKEUP_FREQ)
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+extern RTC_HandleTypeDef hRTC_Handle;
+RTC_HandleTypeDef        hRTC_Handle;
+
+static uint64_t          TimeBaseStart;   /* RTC time in ms when the time base was initialized */
+
+/* Days of a non leap year before the first day of each month */
+static const uint16_t    DaysBeforeMonth[12] =
+{
+  0U, 31U, 59U, 90U, 120U, 151U, 181U, 212U, 243U, 273U, 304U, 334U
+};
+
+/* Private function prototypes -----------------------------------------------*/
+void RTC_WKUP_IRQHandler(void);
+HAL_StatusTypeDef HAL_TIMEBASE_StartWakeUpMs(uint32_t DelayMs);
+void HAL_TIMEBASE_StopWakeUp(void);
+static uint64_t TIMEBASE_GetRtcTimeMs(void);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  This function configures the RTC as a tickless time base source.
+  *         The RTC synchronous prescaler counter gives the time base resolution:
+  *         1 / (RTC_CLOCK / (RTC_ASYNCH_PREDIV + 1)) = 244us with LSE.
+  * @note   This function is called  automatically at the beginning of program after
+  *         reset by HAL_Init() or at any time when clock is configured, by HAL_RCC_ClockConfig().
+  *         The RTC is only initialized by the first call, as the RTC clock does not
+  *         depend on the system clock : the time elapsed is kept.
+  * @param  TickPriority: Tick interrupt priority, used by the wakeup timer interrupt.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_InitTick (uint32_t TickPriority)
+{
+  RCC_OscInitTypeDef        RCC_OscInitStruct = {0};
+  RCC_PeriphCLKInitTypeDef  PeriphClkInitStruct = {0};
+
+  if (TickPriority >= (1UL << __NVIC_PRIO_BITS))
+  {
+    return HAL_ERROR;
+  }
+
+  if (hRTC_Handle.State == HAL_RTC_STATE_RESET)
+  {
+#ifdef RTC_CLOCK_SOURCE_LSE
+    /* Configue LSE as RTC clock soucre */
+    RCC_OscInitStruct.OscillatorType = RCC_OSCILLATORTYPE_LSE;
+    RCC_OscInitStruct.PLL.PLLState = RCC_PLL_NONE;
+    RCC_OscInitStruct.LSEState = RCC_LSE_ON;
+    PeriphClkInitStruct.RTCClockSelection = RCC_RTCCLKSOURCE_LSE;
+#elif defined (RTC_CLOCK_SOURCE_LSI)
+    /* Configue LSI as RTC clock soucre */
+    RCC_OscInitStruct.OscillatorType = RCC_OSCILLATORTYPE_LSI1;
+    RCC_OscInitStruct.PLL.PLLState = RCC_PLL_NONE;
+    RCC_OscInitStruct.LSIState = RCC_LSI_ON;
+    PeriphClkInitStruct.RTCClockSelection = RCC_RTCCLKSOURCE_LSI;
+#else
+#error Please select the RTC Clock source
+#endif /* RTC_CLOCK_SOURCE_LSE */
+
+    if (HAL_RCC_OscConfig(&RCC_OscInitStruct) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+
+    PeriphClkInitStruct.PeriphClockSelection = RCC_PERIPHCLK_RTC;
+    if (HAL_RCCEx_PeriphCLKConfig(&PeriphClkInitStruct) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+
+    /* Enable RTC Clock */
+    __HAL_RCC_RTC_ENABLE();
+
+    hRTC_Handle.Instance = RTC;
+    hRTC_Handle.Init.HourFormat = RTC_HOURFORMAT_24;
+    hRTC_Handle.Init.AsynchPrediv = RTC_ASYNCH_PREDIV;
+    hRTC_Handle.Init.SynchPrediv = RTC_SYNCH_PREDIV;
+    hRTC_Handle.Init.OutPut = RTC_OUTPUT_DISABLE;
+    hRTC_Handle.Init.OutPutPolarity = RTC_OUTPUT_POLARITY_HIGH;
+    hRTC_Handle.Init.OutPutType = RTC_OUTPUT_TYPE_OPENDRAIN;
+    if (HAL_RTC_Init(&hRTC_Handle) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+
+    /* Read the counters directly, without waiting for the shadow registers
+       synchronization after each STOP mode exit */
+    if (HAL_RTCEx_EnableBypassShadow(&hRTC_Handle) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+
+    /* RTC WakeUpTimer Interrupt Configuration: EXTI configuration */
+    __HAL_RTC_WAKEUPTIMER_EXTI_ENABLE_IT();
+    __HAL_RTC_WAKEUPTIMER_EXTI_ENABLE_RISING_EDGE();
+
+    TimeBaseStart = TIMEBASE_GetRtcTimeMs();
+  }
+
+  HAL_NVIC_SetPriority(RTC_WKUP_IRQn, TickPriority, 0U);
+  HAL_NVIC_EnableIRQ(RTC_WKUP_IRQn);
+  uwTickPrio = TickPriority;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Suspend Tick increment.
+  * @note   There is no periodic tick interrupt to disable with this time base, the
+  *         RTC keeps counting.
+  * @retval None
+  */
+void HAL_SuspendTick(void)
+{
+}
+
+/**
+  * @brief  Resume Tick increment.
+  * @note   There is no periodic tick interrupt to enable with this time base.
+  * @retval None
+  */
+void HAL_ResumeTick(void)
+{
+}
+
+/**
+  * @brief  Provide a tick value in millisecond.
+  * @note   The tick is computed from the RTC, it includes the time spent in STOP modes.
+  * @retval tick value
+  */
+uint32_t HAL_GetTick(void)
+{
+  if (hRTC_Handle.State == HAL_RTC_STATE_RESET)
+  {
+    return 0U;
+  }
+
+  return (uint32_t)(TIMEBASE_GetRtcTimeMs() - TimeBaseStart);
+}
+
+/**
+  * @brief  Program a one-shot wake-up of the core for tickless idle.
+  * @note   The wake-up may happen up to one wakeup timer period (0.5ms with LSE)
+  *         before DelayMs, and up to one second before above RTC_WAKEUP_MAX_MS
+  *         (32s with LSE) : the caller is expected to check its deadline and sleep
+  *         again if needed.
+  * @param  DelayMs  Delay to the wake-up in millisecond, from 1 to 0xFFFF000.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_TIMEBASE_StartWakeUpMs(uint32_t DelayMs)
+{
+  uint32_t counter;
+  uint32_t clock;
+
+  if ((DelayMs == 0U) || (DelayMs > (0xFFFFU * 1000U)))
+  {
+    return HAL_ERROR;
+  }
+
+  if (DelayMs <= RTC_WAKEUP_MAX_MS)
+  {
+    /* Periods of RTCCLK / 16, the interrupt is raised after counter + 1 periods */
+    counter = (uint32_t)(((uint64_t)DelayMs * RTC_WAKEUP_FREQ) / 1000U);
+    counter = (counter > 1U) ? (counter - 1U) : 1U;
+    clock = RTC_WAKEUPCLOCK_RTCCLK_DIV16;
+  }
+  else
+  {
+    /* Periods of 1s */
+    counter = (DelayMs / 1000U) - 1U;
+    clock = RTC_WAKEUPCLOCK_CK_SPRE_16BITS;
+  }
+
+  return HAL_RTCEx_SetWakeUpTimer_IT(&hRTC_Handle, counter, clock);
+}
+
+/**
+  * @brief  Cancel the wake-up programmed by HAL_TIMEBASE_StartWakeUpMs().
+  * @retval None
+  */
+void HAL_TIMEBASE_StopWakeUp(void)
+{
+  (void)HAL_RTCEx_DeactivateWakeUpTimer(&hRTC_Handle);
+}
+
+/**
+  * @brief  Wake Up Timer Event Callback in non blocking mode
+  * @note   This function is called  when RTC_WKUP interrupt took place, inside
+  * RTC_WKUP_IRQHandler(). The wakeup timer is stopped, so that it acts as a
+  * one-shot wake-up.
+  * @param  hrtc : RTC handle
+  * @retval None
+  */
+void HAL_RTCEx_WakeUpTimerEventCallback(RTC_HandleTypeDef *hrtc)
+{
+  (void)HAL_RTCEx_DeactivateWakeUpTimer(hrtc);
+}
+
+/**
+  * @brief  This function handles  WAKE UP TIMER  interrupt request.
+  * @retval None
+  */
+void RTC_WKUP_IRQHandler(void)
+{
+  HAL_RTCEx_WakeUpTimerIRQHandler(&hRTC_Handle);
+}
+
+/**
+  * @brief  Read the RTC time in millisecond since 2000-01-01.
+  * @note   The shadow registers are bypassed : the calendar registers are read again
+  *         until they are stable, so that the sub-second counter is consistent with them.
+  * @retval RTC time in millisecond
+  */
+static uint64_t TIMEBASE_GetRtcTimeMs(void)
+{
+  uint32_t ssr;
+  uint32_t tr;
+  uint32_t dr;
+  uint32_t year;
+  uint32_t month;
+  uint32_t days;
+  uint32_t seconds;
+
+  do
+  {
+    tr  = RTC->TR;
+    dr  = RTC->DR;
+    ssr = RTC->SSR;
+  } while ((tr != RTC->TR) || (dr != RTC->DR));
+
+  seconds = ((uint32_t)RTC_Bcd2ToByte((uint8_t)((tr & (RTC_TR_HT | RTC_TR_HU)) >> RTC_TR_HU_Pos)) * 3600U) +
+            ((uint32_t)RTC_Bcd2ToByte((uint8_t)((tr & (RTC_TR_MNT | RTC_TR_MNU)) >> RTC_TR_MNU_Pos)) * 60U) +
+            (uint32_t)RTC_Bcd2ToByte((uint8_t)((tr & (RTC_TR_ST | RTC_TR_SU)) >> RTC_TR_SU_Pos));
+
+  year  = RTC_Bcd2ToByte((uint8_t)((dr & (RTC_DR_YT | RTC_DR_YU)) >> RTC_DR_YU_Pos));
+  month = RTC_Bcd2ToByte((uint8_t)((dr & (RTC_DR_MT | RTC_DR_MU)) >> RTC_DR_MU_Pos));
+  days  = (year * 365U) + ((year + 3U) / 4U) + DaysBeforeMonth[(month - 1U) % 12U] +
+          RTC_Bcd2ToByte((uint8_t)((dr & (RTC_DR_DT | RTC_DR_DU)) >> RTC_DR_DU_Pos)) - 1U;
+  if (((year & 3U) == 0U) && (month > 2U))
+  {
+    days++;
+  }
+
+  seconds += days * 86400U;
+
+  /* The synchronous prescaler counter counts down from RTC_SYNCH_PREDIV each second */
+  return ((uint64_t)seconds * 1000U) +
+         (((RTC_SYNCH_PREDIV - (ssr & RTC_SSR_SS)) * 1000U) / (RTC_SYNCH_PREDIV + 1U));
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
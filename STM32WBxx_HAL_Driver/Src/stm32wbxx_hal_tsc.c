@@ -76,6 +76,24 @@
     (+) Check the group acquisition status using HAL_TSC_GroupGetStatus() function.
     (+) Read the acquisition value using HAL_TSC_GroupGetValue() function.
 
+  *** Scan sequence ***
+  ===================================
+  [..]
+    (+) Describe the keys in banks of TSC_IOConfigTypeDef: the groups of a bank are
+        acquired in parallel, so each bank should use one channel IO in as many groups
+        as possible. Up to TSC_SCAN_MAX_BANKS banks are acquired one after the other.
+    (+) Fill a TSC_ScanTypeDef structure with the banks, the keys memory, the filter and
+        baseline tracking weights and the touch and release thresholds, then reset
+        the keys with HAL_TSC_Scan_Init() function.
+    (+) Launch a scan of all banks using HAL_TSC_Scan_Start_IT() function. The next bank
+        is configured and acquired from the end of acquisition interrupt, where the
+        measures are filtered and the baselines tracked. The baselines are calibrated
+        with the first scan.
+    (+) HAL_TSC_ScanCpltCallback() is called at the end of the scan: the touched keys
+        are given by the TouchedKeys mask and the touch and release events by the
+        ChangedKeys mask of the TSC_ScanTypeDef structure.
+    (+) A scan is aborted using HAL_TSC_Stop_IT() function.
+
      *** Callback registration ***
      =============================================
 
@@ -88,6 +106,7 @@
      Function @ref HAL_TSC_RegisterCallback() allows to register following callbacks:
        (+) ConvCpltCallback   : callback for conversion complete process.
        (+) ErrorCallback      : callback for error detection.
+       (+) ScanCpltCallback   : callback for scan complete process.
        (+) MspInitCallback    : callback for Msp Init.
        (+) MspDeInitCallback  : callback for Msp DeInit.
   [..]
@@ -103,6 +122,7 @@
      This function allows to reset following callbacks:
        (+) ConvCpltCallback   : callback for conversion complete process.
        (+) ErrorCallback      : callback for error detection.
+       (+) ScanCpltCallback   : callback for scan complete process.
        (+) MspInitCallback    : callback for Msp Init.
        (+) MspDeInitCallback  : callback for Msp DeInit.
 
@@ -211,6 +231,9 @@
 /* Private variables ---------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
 static uint32_t TSC_extract_groups(uint32_t iomask);
+static void TSC_ScanSetBank(TSC_HandleTypeDef *htsc, const TSC_ScanTypeDef *pScan);
+static void TSC_ScanProcessBank(TSC_HandleTypeDef *htsc, TSC_ScanTypeDef *pScan);
+static uint32_t TSC_Track(uint32_t value, uint32_t target, uint32_t shift);
 
 /* Exported functions --------------------------------------------------------*/
 
@@ -272,6 +295,7 @@ HAL_StatusTypeDef HAL_TSC_Init(TSC_HandleTypeDef *htsc)
     /* Init the TSC Callback settings */
     htsc->ConvCpltCallback  = HAL_TSC_ConvCpltCallback; /* Legacy weak ConvCpltCallback     */
     htsc->ErrorCallback     = HAL_TSC_ErrorCallback;    /* Legacy weak ErrorCallback        */
+    htsc->ScanCpltCallback  = HAL_TSC_ScanCpltCallback; /* Legacy weak ScanCpltCallback     */
 
     if (htsc->MspInitCallback == NULL)
     {
@@ -288,6 +312,7 @@ HAL_StatusTypeDef HAL_TSC_Init(TSC_HandleTypeDef *htsc)
 
   /* Initialize the TSC state */
   htsc->State = HAL_TSC_STATE_BUSY;
+  htsc->pScan = NULL;
 
   /*--------------------------------------------------------------------------*/
   /* Set TSC parameters */
@@ -422,6 +447,7 @@ __weak void HAL_TSC_MspDeInit(TSC_HandleTypeDef *htsc)
   *         This parameter can be one of the following values:
   *          @arg @ref HAL_TSC_CONV_COMPLETE_CB_ID Conversion completed callback ID
   *          @arg @ref HAL_TSC_ERROR_CB_ID Error callback ID
+  *          @arg @ref HAL_TSC_SCAN_COMPLETE_CB_ID Scan completed callback ID
   *          @arg @ref HAL_TSC_MSPINIT_CB_ID MspInit callback ID
   *          @arg @ref HAL_TSC_MSPDEINIT_CB_ID MspDeInit callback ID
   * @param  pCallback pointer to the Callback function
@@ -453,6 +479,10 @@ HAL_StatusTypeDef HAL_TSC_RegisterCallback(TSC_HandleTypeDef *htsc, HAL_TSC_Call
         htsc->ErrorCallback = pCallback;
         break;
 
+      case HAL_TSC_SCAN_COMPLETE_CB_ID :
+        htsc->ScanCpltCallback = pCallback;
+        break;
+
       case HAL_TSC_MSPINIT_CB_ID :
         htsc->MspInitCallback = pCallback;
         break;
@@ -515,6 +545,7 @@ HAL_StatusTypeDef HAL_TSC_RegisterCallback(TSC_HandleTypeDef *htsc, HAL_TSC_Call
   *         This parameter can be one of the following values:
   *          @arg @ref HAL_TSC_CONV_COMPLETE_CB_ID Conversion completed callback ID
   *          @arg @ref HAL_TSC_ERROR_CB_ID Error callback ID
+  *          @arg @ref HAL_TSC_SCAN_COMPLETE_CB_ID Scan completed callback ID
   *          @arg @ref HAL_TSC_MSPINIT_CB_ID MspInit callback ID
   *          @arg @ref HAL_TSC_MSPDEINIT_CB_ID MspDeInit callback ID
   * @retval HAL status
@@ -538,6 +569,10 @@ HAL_StatusTypeDef HAL_TSC_UnRegisterCallback(TSC_HandleTypeDef *htsc, HAL_TSC_Ca
         htsc->ErrorCallback = HAL_TSC_ErrorCallback;               /* Legacy weak ErrorCallback        */
         break;
 
+      case HAL_TSC_SCAN_COMPLETE_CB_ID :
+        htsc->ScanCpltCallback = HAL_TSC_ScanCpltCallback;         /* Legacy weak ScanCpltCallback     */
+        break;
+
       case HAL_TSC_MSPINIT_CB_ID :
         htsc->MspInitCallback = HAL_TSC_MspInit;                   /* Legacy weak MspInit              */
         break;
@@ -771,6 +806,9 @@ HAL_StatusTypeDef HAL_TSC_Stop_IT(TSC_HandleTypeDef *htsc)
   /* Clear flags */
   __HAL_TSC_CLEAR_FLAG(htsc, (TSC_FLAG_EOA | TSC_FLAG_MCE));
 
+  /* Abort the scan if any */
+  htsc->pScan = NULL;
+
   /* Change TSC state */
   htsc->State = HAL_TSC_STATE_READY;
 
@@ -843,6 +881,120 @@ uint32_t HAL_TSC_GroupGetValue(TSC_HandleTypeDef *htsc, uint32_t gx_index)
   return htsc->Instance->IOGXCR[gx_index];
 }
 
+/**
+  * @brief  Initialize a scan of several banks of keys.
+  * @note   The keys are reset: their baseline is calibrated by the first scan.
+  * @param  htsc Pointer to a TSC_HandleTypeDef structure that contains
+  *         the configuration information for the specified TSC.
+  * @param  pScan Pointer to the scan structure.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_TSC_Scan_Init(TSC_HandleTypeDef *htsc, TSC_ScanTypeDef *pScan)
+{
+  uint32_t idx;
+
+  /* Check the parameters */
+  assert_param(IS_TSC_ALL_INSTANCE(htsc->Instance));
+
+  if ((pScan == NULL) || (pScan->pBanks == NULL) || (pScan->pKeys == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  assert_param(IS_TSC_SCAN_BANKS(pScan->NbBanks));
+
+  /* The keys of an on-going scan can't be reset */
+  if (htsc->pScan == pScan)
+  {
+    return HAL_BUSY;
+  }
+
+  for (idx = 0UL; idx < (pScan->NbBanks * (uint32_t)TSC_NB_OF_GROUPS); idx++)
+  {
+    pScan->pKeys[idx].Measure = 0UL;
+    pScan->pKeys[idx].Baseline = 0UL;
+  }
+
+  pScan->TouchedKeys = 0UL;
+  pScan->ChangedKeys = 0UL;
+  pScan->CurrentBank = 0UL;
+
+  /* Return function status */
+  return HAL_OK;
+}
+
+/**
+  * @brief  Start the scan of all banks in interrupt mode.
+  * @note   The banks are acquired one after the other from the end of acquisition
+  *         interrupt, then HAL_TSC_ScanCpltCallback() is called.
+  * @param  htsc Pointer to a TSC_HandleTypeDef structure that contains
+  *         the configuration information for the specified TSC.
+  * @param  pScan Pointer to the scan structure, initialized by HAL_TSC_Scan_Init().
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_TSC_Scan_Start_IT(TSC_HandleTypeDef *htsc, TSC_ScanTypeDef *pScan)
+{
+  /* Check the parameters */
+  assert_param(IS_TSC_ALL_INSTANCE(htsc->Instance));
+  assert_param(IS_TSC_MCE_IT(htsc->Init.MaxCountInterrupt));
+  assert_param(IS_TSC_SCAN_BANKS(pScan->NbBanks));
+
+  /* Process locked */
+  __HAL_LOCK(htsc);
+
+  if (htsc->State == HAL_TSC_STATE_BUSY)
+  {
+    /* Process unlocked */
+    __HAL_UNLOCK(htsc);
+
+    return HAL_BUSY;
+  }
+
+  /* Change TSC state */
+  htsc->State = HAL_TSC_STATE_BUSY;
+
+  /* Configure the first bank */
+  pScan->ChangedKeys = 0UL;
+  pScan->CurrentBank = 0UL;
+  htsc->pScan = pScan;
+  TSC_ScanSetBank(htsc, pScan);
+
+  /* Enable end of acquisition interrupt */
+  __HAL_TSC_ENABLE_IT(htsc, TSC_IT_EOA);
+
+  /* Enable max count error interrupt (optional) */
+  if (htsc->Init.MaxCountInterrupt == ENABLE)
+  {
+    __HAL_TSC_ENABLE_IT(htsc, TSC_IT_MCE);
+  }
+  else
+  {
+    __HAL_TSC_DISABLE_IT(htsc, TSC_IT_MCE);
+  }
+
+  /* Clear flags */
+  __HAL_TSC_CLEAR_FLAG(htsc, (TSC_FLAG_EOA | TSC_FLAG_MCE));
+
+  /* Set touch sensing IOs not acquired to the specified IODefaultMode */
+  if (htsc->Init.IODefaultMode == TSC_IODEF_OUT_PP_LOW)
+  {
+    __HAL_TSC_SET_IODEF_OUTPPLOW(htsc);
+  }
+  else
+  {
+    __HAL_TSC_SET_IODEF_INFLOAT(htsc);
+  }
+
+  /* Launch the acquisition */
+  __HAL_TSC_START_ACQ(htsc);
+
+  /* Process unlocked */
+  __HAL_UNLOCK(htsc);
+
+  /* Return function status */
+  return HAL_OK;
+}
+
 /**
   * @}
   */
@@ -1016,6 +1168,8 @@ void HAL_TSC_IRQHandler(TSC_HandleTypeDef *htsc)
   {
     /* Clear MCE flag */
     __HAL_TSC_CLEAR_FLAG(htsc, TSC_FLAG_MCE);
+    /* Abort the scan if any */
+    htsc->pScan = NULL;
     /* Change TSC state */
     htsc->State = HAL_TSC_STATE_ERROR;
 #if (USE_HAL_TSC_REGISTER_CALLBACKS == 1)
@@ -1025,6 +1179,32 @@ void HAL_TSC_IRQHandler(TSC_HandleTypeDef *htsc)
     HAL_TSC_ErrorCallback(htsc);
 #endif /* USE_HAL_TSC_REGISTER_CALLBACKS */
   }
+  else if (htsc->pScan != NULL)
+  {
+    /* Filter the measures of the bank and update the keys */
+    TSC_ScanProcessBank(htsc, htsc->pScan);
+
+    htsc->pScan->CurrentBank++;
+    if (htsc->pScan->CurrentBank < htsc->pScan->NbBanks)
+    {
+      /* Acquire the next bank */
+      TSC_ScanSetBank(htsc, htsc->pScan);
+      __HAL_TSC_START_ACQ(htsc);
+    }
+    else
+    {
+      /* End of scan */
+      htsc->pScan = NULL;
+      /* Change TSC state */
+      htsc->State = HAL_TSC_STATE_READY;
+#if (USE_HAL_TSC_REGISTER_CALLBACKS == 1)
+      htsc->ScanCpltCallback(htsc);
+#else
+      /* Scan completed callback */
+      HAL_TSC_ScanCpltCallback(htsc);
+#endif /* USE_HAL_TSC_REGISTER_CALLBACKS */
+    }
+  }
   else
   {
     /* Change TSC state */
@@ -1070,6 +1250,22 @@ __weak void HAL_TSC_ErrorCallback(TSC_HandleTypeDef *htsc)
    */
 }
 
+/**
+  * @brief  Scan completed callback in non-blocking mode.
+  * @param  htsc Pointer to a TSC_HandleTypeDef structure that contains
+  *         the configuration information for the specified TSC.
+  * @retval None
+  */
+__weak void HAL_TSC_ScanCpltCallback(TSC_HandleTypeDef *htsc)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(htsc);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_TSC_ScanCpltCallback could be implemented in the user file.
+   */
+}
+
 /**
   * @}
   */
@@ -1104,6 +1300,123 @@ static uint32_t TSC_extract_groups(uint32_t iomask)
   return groups;
 }
 
+/**
+  * @brief  Configure the IOs of the current bank of a scan.
+  * @note   The capacitors are discharged by the IOs held low between the two
+  *         acquisitions, during DischargeCycles loop iterations.
+  * @param  htsc Pointer to a TSC_HandleTypeDef structure that contains
+  *         the configuration information for the specified TSC.
+  * @param  pScan Pointer to the scan structure.
+  * @retval None
+  */
+static void TSC_ScanSetBank(TSC_HandleTypeDef *htsc, const TSC_ScanTypeDef *pScan)
+{
+  const TSC_IOConfigTypeDef *bank = &pScan->pBanks[pScan->CurrentBank];
+  uint32_t idx;
+
+  /* Disable Schmitt trigger hysteresis on all used TSC IOs */
+  htsc->Instance->IOHCR = (~(bank->ChannelIOs | bank->ShieldIOs | bank->SamplingIOs));
+
+  /* Set channel and shield IOs */
+  htsc->Instance->IOCCR = (bank->ChannelIOs | bank->ShieldIOs);
+
+  /* Set sampling IOs */
+  htsc->Instance->IOSCR = bank->SamplingIOs;
+
+  /* Set groups to be acquired */
+  htsc->Instance->IOGCSR = TSC_extract_groups(bank->ChannelIOs);
+
+  for (idx = 0UL; idx < pScan->DischargeCycles; idx++)
+  {
+    __NOP();
+  }
+}
+
+/**
+  * @brief  Filter the measures of the current bank of a scan and update its keys.
+  * @note   The baseline of a key follows the filtered measure while the key is not
+  *         touched, and is frozen while it is touched.
+  * @param  htsc Pointer to a TSC_HandleTypeDef structure that contains
+  *         the configuration information for the specified TSC.
+  * @param  pScan Pointer to the scan structure.
+  * @retval None
+  */
+static void TSC_ScanProcessBank(TSC_HandleTypeDef *htsc, TSC_ScanTypeDef *pScan)
+{
+  uint32_t groups = TSC_extract_groups(pScan->pBanks[pScan->CurrentBank].ChannelIOs);
+  uint32_t first = pScan->CurrentBank * (uint32_t)TSC_NB_OF_GROUPS;
+  TSC_KeyTypeDef *key;
+  uint32_t sample;
+  uint32_t delta;
+  uint32_t mask;
+  uint32_t idx;
+
+  for (idx = 0UL; idx < (uint32_t)TSC_NB_OF_GROUPS; idx++)
+  {
+    if ((groups & (1UL << idx)) != 0UL)
+    {
+      key = &pScan->pKeys[first + idx];
+      mask = 1UL << (first + idx);
+      sample = htsc->Instance->IOGXCR[idx] << TSC_SCAN_FRACTION_BITS;
+
+      if (key->Baseline == 0UL)
+      {
+        /* First acquisition: calibrate the key */
+        key->Measure = sample;
+        key->Baseline = sample;
+      }
+      else
+      {
+        key->Measure = TSC_Track(key->Measure, sample, pScan->FilterShift);
+
+        /* A touch increases the electrode capacitance, which lowers the measure */
+        delta = (key->Baseline > key->Measure) ? ((key->Baseline - key->Measure) >> TSC_SCAN_FRACTION_BITS) : 0UL;
+
+        if ((pScan->TouchedKeys & mask) == 0UL)
+        {
+          if (delta >= pScan->TouchThreshold)
+          {
+            pScan->TouchedKeys |= mask;
+            pScan->ChangedKeys |= mask;
+          }
+          else
+          {
+            key->Baseline = TSC_Track(key->Baseline, key->Measure, pScan->BaselineShift);
+          }
+        }
+        else if (delta <= pScan->ReleaseThreshold)
+        {
+          pScan->TouchedKeys &= ~mask;
+          pScan->ChangedKeys |= mask;
+        }
+        else
+        {
+          /* Key still touched */
+        }
+      }
+    }
+  }
+}
+
+/**
+  * @brief  First order low pass filter step.
+  * @param  value Current value
+  * @param  target New input value
+  * @param  shift Filter weight is 1 / 2^shift
+  * @retval Filtered value
+  */
+static uint32_t TSC_Track(uint32_t value, uint32_t target, uint32_t shift)
+{
+  if (target >= value)
+  {
+    return value + ((target - value) >> shift);
+  }
+  else
+  {
+    return value - ((value - target) >> shift);
+  }
+}
+
 /**
   * @}
   */
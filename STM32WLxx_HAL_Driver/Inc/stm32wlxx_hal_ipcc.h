@@ -112,6 +112,28 @@ typedef struct __IPCC_HandleTypeDef
   */
 typedef void ChannelCb(IPCC_HandleTypeDef *hipcc, uint32_t ChannelIndex, IPCC_CHANNELDirTypeDef ChannelDir);
 
+/**
+  * @brief  IPCC mailbox indices, located in the RAM shared by both CPUs and followed by the slots
+  */
+typedef struct
+{
+  __IO uint32_t Head;             /*!< Number of messages posted, written by the sending CPU only     */
+  __IO uint32_t Tail;             /*!< Number of messages released, written by the receiving CPU only */
+} IPCC_MailboxRingTypeDef;
+
+/**
+  * @brief  IPCC mailbox structure definition, declared on both CPUs with the same parameters
+  */
+typedef struct
+{
+  IPCC_MailboxRingTypeDef *pRing;       /*!< Mailbox in the shared RAM, word aligned, of IPCC_MAILBOX_SIZE() bytes */
+  uint32_t                 ChannelIndex; /*!< IPCC channel notifying the messages, a value of @ref IPCC_Channel    */
+  IPCC_CHANNELDirTypeDef   ChannelDir;   /*!< IPCC_CHANNEL_DIR_TX on the sending CPU,
+                                              IPCC_CHANNEL_DIR_RX on the receiving CPU                            */
+  uint32_t                 SlotSize;     /*!< Maximum message size (in bytes), a multiple of 4                     */
+  uint32_t                 NbSlots;      /*!< Number of message slots, a power of 2 from 2 to 65536                */
+} IPCC_MailboxTypeDef;
+
 /**
   * @}
   */
@@ -221,6 +243,15 @@ typedef void ChannelCb(IPCC_HandleTypeDef *hipcc, uint32_t ChannelIndex, IPCC_CH
   * @}
   */
 
+/**
+  * @brief  Size of the shared RAM of a mailbox.
+  * @param  __SLOTSIZE__ Maximum message size (in bytes)
+  * @param  __NBSLOTS__ Number of message slots
+  * @retval Mailbox size (in bytes)
+  */
+#define IPCC_MAILBOX_SIZE(__SLOTSIZE__, __NBSLOTS__) ((uint32_t)sizeof(IPCC_MailboxRingTypeDef) + \
+                                                      ((__NBSLOTS__) * ((__SLOTSIZE__) + 4U)))
+
 /* Exported functions --------------------------------------------------------*/
 /** @defgroup IPCC_Exported_Functions IPCC Exported Functions
   * @{
@@ -271,6 +302,23 @@ void HAL_IPCC_RxCallback(IPCC_HandleTypeDef *hipcc, uint32_t ChannelIndex, IPCC_
   * @}
   */
 
+/** @defgroup IPCC_Exported_Functions_Group4 Mailbox functions
+ *  @{
+ */
+/* Mailbox functions  **********************************************************/
+HAL_StatusTypeDef HAL_IPCC_MailboxInit(IPCC_MailboxTypeDef *hmbox);
+HAL_StatusTypeDef HAL_IPCC_MailboxAlloc(IPCC_MailboxTypeDef const *const hmbox, uint8_t **ppData);
+HAL_StatusTypeDef HAL_IPCC_MailboxPost(IPCC_MailboxTypeDef const *const hmbox, uint32_t Size);
+HAL_StatusTypeDef HAL_IPCC_MailboxFlush(IPCC_HandleTypeDef const *const hipcc, IPCC_MailboxTypeDef const *const hmbox);
+HAL_StatusTypeDef HAL_IPCC_MailboxGet(IPCC_MailboxTypeDef const *const hmbox, uint8_t **ppData, uint32_t *pSize);
+HAL_StatusTypeDef HAL_IPCC_MailboxRelease(IPCC_MailboxTypeDef const *const hmbox);
+HAL_StatusTypeDef HAL_IPCC_MailboxDrain(IPCC_HandleTypeDef const *const hipcc, IPCC_MailboxTypeDef *hmbox);
+uint32_t HAL_IPCC_MailboxGetPending(IPCC_MailboxTypeDef const *const hmbox);
+void HAL_IPCC_MailboxRxCallback(IPCC_MailboxTypeDef *hmbox, uint8_t *pData, uint32_t Size);
+/**
+  * @}
+  */
+
 /**
   * @}
   */
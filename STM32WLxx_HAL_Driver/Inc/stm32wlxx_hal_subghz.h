@@ -73,6 +73,27 @@ typedef enum
   HAL_SUBGHZ_CAD_DETECTED                   = 0x01U,    /*!< Channel activity detected                   */
 } HAL_SUBGHZ_CadStatusTypeDef;
 
+/**
+  * @brief  SUBGHZ pipeline command structure definition
+  * @note   A command is one SPI frame, NSS being held low from the first byte of pCmd to the
+  *         last byte of pData. For a read, pCmd ends with the address, offset and status (NOP)
+  *         bytes preceding the data, as sent by the blocking functions.
+  */
+typedef struct
+{
+  const uint8_t                             *pCmd;      /*!< Opcode followed by its parameters           */
+
+  uint16_t                                  CmdSize;    /*!< Number of bytes of pCmd, at least 1         */
+
+  uint16_t                                  DataSize;   /*!< Number of bytes of the data phase, 0 if none */
+
+  uint8_t                                   *pData;     /*!< Data phase buffer, NULL if DataSize is 0    */
+
+  uint32_t                                  Direction;  /*!< Direction of the data phase.
+                                                             This parameter can be a value of
+                                                             @ref SUBGHZ_Pipeline_Direction             */
+} SUBGHZ_PipelineCmdTypeDef;
+
 /**
   * @brief  SUBGHZ handle Structure definition
   */
@@ -92,6 +113,24 @@ typedef struct
 
   __IO uint32_t                             ErrorCode;  /*!< SUBGHZ Error code                           */
 
+  DMA_HandleTypeDef                         *hdmatx;    /*!< SUBGHZSPI Tx DMA Handle parameters          */
+
+  DMA_HandleTypeDef                         *hdmarx;    /*!< SUBGHZSPI Rx DMA Handle parameters          */
+
+  const SUBGHZ_PipelineCmdTypeDef           *pPipeline; /*!< Command pipeline being executed             */
+
+  uint32_t                                  PipelineSize;  /*!< Number of commands of pPipeline          */
+
+  __IO uint32_t                             PipelineIndex; /*!< Command of pPipeline on going            */
+
+  __IO uint32_t                             PipelinePhase; /*!< Step of the command on going             */
+
+  uint32_t                                  BusyPolarity;  /*!< Radio busy polarity outside a pipeline   */
+
+  SUBGHZ_PipelineCmdTypeDef                 BufferCmd;     /*!< Command of the buffer DMA functions       */
+
+  uint8_t                                   BufferHeader[3]; /*!< Opcode, offset and status of BufferCmd */
+
 #if (USE_HAL_SUBGHZ_REGISTER_CALLBACKS == 1)
   void (* TxCpltCallback)(struct __SUBGHZ_HandleTypeDef *hsubghz);                /*!< SUBGHZ Tx Completed callback          */
   void (* RxCpltCallback)(struct __SUBGHZ_HandleTypeDef *hsubghz);                /*!< SUBGHZ Rx Completed callback          */
@@ -102,6 +141,8 @@ typedef struct
   void (* CRCErrorCallback)(struct __SUBGHZ_HandleTypeDef *hsubghz);              /*!< SUBGHZ CRC Error callback             */
   void (* CADStatusCallback)(struct __SUBGHZ_HandleTypeDef *hsubghz, HAL_SUBGHZ_CadStatusTypeDef cadstatus); /*!< SUBGHZ CAD Status callback            */
   void (* RxTxTimeoutCallback)(struct __SUBGHZ_HandleTypeDef *hsubghz);           /*!< SUBGHZ Rx Tx Timeout callback         */
+  void (* PipelineCpltCallback)(struct __SUBGHZ_HandleTypeDef *hsubghz);          /*!< SUBGHZ Pipeline Completed callback    */
+  void (* PipelineErrorCallback)(struct __SUBGHZ_HandleTypeDef *hsubghz);         /*!< SUBGHZ Pipeline Error callback        */
   void (* MspInitCallback)(struct __SUBGHZ_HandleTypeDef *hsubghz);               /*!< SUBGHZ Msp Init callback              */
   void (* MspDeInitCallback)(struct __SUBGHZ_HandleTypeDef *hsubghz);             /*!< SUBGHZ Msp DeInit callback            */
 #endif  /* USE_HAL_SUBGHZ_REGISTER_CALLBACKS */
@@ -122,7 +163,9 @@ typedef enum
   HAL_SUBGHZ_CRC_ERROR_CB_ID                = 0x06U,    /*!< SUBGHZ CRC error callback ID                */
   HAL_SUBGHZ_RX_TX_TIMEOUT_CB_ID            = 0x07U,    /*!< SUBGHZ Rx Tx timeout callback ID            */
   HAL_SUBGHZ_MSPINIT_CB_ID                  = 0x08U,    /*!< SUBGHZ Msp Init callback ID                 */
-  HAL_SUBGHZ_MSPDEINIT_CB_ID                = 0x09U     /*!< SUBGHZ Msp DeInit callback ID               */
+  HAL_SUBGHZ_MSPDEINIT_CB_ID                = 0x09U,    /*!< SUBGHZ Msp DeInit callback ID               */
+  HAL_SUBGHZ_PIPELINE_CPLT_CB_ID            = 0x0AU,    /*!< SUBGHZ Pipeline Completed callback ID       */
+  HAL_SUBGHZ_PIPELINE_ERROR_CB_ID           = 0x0BU     /*!< SUBGHZ Pipeline Error callback ID           */
 
 } HAL_SUBGHZ_CallbackIDTypeDef;
 
@@ -200,6 +243,7 @@ typedef enum
 #define HAL_SUBGHZ_ERROR_NONE               (0x00000000U)   /*!< No error                         */
 #define HAL_SUBGHZ_ERROR_TIMEOUT            (0x00000001U)   /*!< Timeout Error                    */
 #define HAL_SUBGHZ_ERROR_RF_BUSY            (0x00000002U)   /*!< RF Busy Error                    */
+#define HAL_SUBGHZ_ERROR_DMA                (0x00000004U)   /*!< DMA transfer error               */
 #if (USE_HAL_SUBGHZ_REGISTER_CALLBACKS == 1)
 #define HAL_SUBGHZ_ERROR_INVALID_CALLBACK   (0x00000080U)   /*!< Invalid Callback error           */
 #endif /* USE_HAL_SUBGHZ_REGISTER_CALLBACKS */
@@ -222,6 +266,15 @@ typedef enum
   * @}
   */
 
+/** @defgroup SUBGHZ_Pipeline_Direction SUBGHZ Pipeline Data Direction
+  * @{
+  */
+#define SUBGHZ_PIPELINE_DATA_WRITE          (0x00000000U)   /*!< pData sent to the radio after pCmd          */
+#define SUBGHZ_PIPELINE_DATA_READ           (0x00000001U)   /*!< pData filled with the bytes read after pCmd */
+/**
+  * @}
+  */
+
 /**
   * @}
   */
@@ -316,6 +369,14 @@ typedef enum
                                                         ((__PRESCALER__) == SUBGHZSPI_BAUDRATEPRESCALER_64)   || \
                                                         ((__PRESCALER__) == SUBGHZSPI_BAUDRATEPRESCALER_128)  || \
                                                         ((__PRESCALER__) == SUBGHZSPI_BAUDRATEPRESCALER_256))
+
+/** @brief  Checks if SUBGHZ pipeline data direction parameter is in allowed range.
+  * @param  __DIRECTION__ specifies the data phase direction.
+  *         This parameter can be a value of @ref SUBGHZ_Pipeline_Direction
+  * @retval None
+  */
+#define IS_SUBGHZ_PIPELINE_DIRECTION(__DIRECTION__) (((__DIRECTION__) == SUBGHZ_PIPELINE_DATA_WRITE) || \
+                                                     ((__DIRECTION__) == SUBGHZ_PIPELINE_DATA_READ))
 /**
   * @}
   */
@@ -369,6 +430,14 @@ HAL_StatusTypeDef HAL_SUBGHZ_ReadRegisters(SUBGHZ_HandleTypeDef *hsubghz, uint16
 HAL_StatusTypeDef HAL_SUBGHZ_WriteRegister(SUBGHZ_HandleTypeDef *hsubghz, uint16_t Address, uint8_t Value);
 HAL_StatusTypeDef HAL_SUBGHZ_ReadRegister(SUBGHZ_HandleTypeDef *hsubghz, uint16_t Address, uint8_t *pValue);
 
+HAL_StatusTypeDef HAL_SUBGHZ_ExecPipeline_DMA(SUBGHZ_HandleTypeDef *hsubghz, const SUBGHZ_PipelineCmdTypeDef *pPipeline,
+                                              uint32_t Size);
+HAL_StatusTypeDef HAL_SUBGHZ_WriteBuffer_DMA(SUBGHZ_HandleTypeDef *hsubghz, uint8_t Offset, uint8_t *pBuffer,
+                                             uint16_t Size);
+HAL_StatusTypeDef HAL_SUBGHZ_ReadBuffer_DMA(SUBGHZ_HandleTypeDef *hsubghz, uint8_t Offset, uint8_t *pBuffer,
+                                            uint16_t Size);
+HAL_StatusTypeDef HAL_SUBGHZ_AbortPipeline(SUBGHZ_HandleTypeDef *hsubghz);
+
 void HAL_SUBGHZ_IRQHandler(SUBGHZ_HandleTypeDef *hsubghz);
 void HAL_SUBGHZ_TxCpltCallback(SUBGHZ_HandleTypeDef *hsubghz);
 void HAL_SUBGHZ_RxCpltCallback(SUBGHZ_HandleTypeDef *hsubghz);
@@ -379,6 +448,8 @@ void HAL_SUBGHZ_HeaderErrorCallback(SUBGHZ_HandleTypeDef *hsubghz);
 void HAL_SUBGHZ_CRCErrorCallback(SUBGHZ_HandleTypeDef *hsubghz);
 void HAL_SUBGHZ_CADStatusCallback(SUBGHZ_HandleTypeDef *hsubghz, HAL_SUBGHZ_CadStatusTypeDef cadstatus);
 void HAL_SUBGHZ_RxTxTimeoutCallback(SUBGHZ_HandleTypeDef *hsubghz);
+void HAL_SUBGHZ_PipelineCpltCallback(SUBGHZ_HandleTypeDef *hsubghz);
+void HAL_SUBGHZ_PipelineErrorCallback(SUBGHZ_HandleTypeDef *hsubghz);
 /**
   * @}
   */
@@ -128,6 +128,45 @@ typedef struct
   */
 
 /* Exported macros -----------------------------------------------------------*/
+/** @defgroup UARTEx_Exported_Macros UARTEx Exported Macros
+  * @{
+  */
+
+/** @brief  BRR value of a UART in 16-bit oversampling mode.
+  * @note   With constant arguments the value is computed by the compiler, to be written
+  *         with HAL_UARTEx_SetBRR().
+  * @param  __CLOCK__ UART kernel clock frequency after the prescaler, in Hz.
+  * @param  __BAUD__ Baud rate.
+  * @retval BRR value
+  */
+#define __HAL_UART_BRR_SAMPLING16(__CLOCK__, __BAUD__)                                  \
+  ((uint32_t)(((__CLOCK__) + ((__BAUD__) / 2U)) / (__BAUD__)))
+
+/** @brief  BRR value of a UART in 8-bit oversampling mode, BRR[3] being cleared.
+  * @note   With constant arguments the value is computed by the compiler, to be written
+  *         with HAL_UARTEx_SetBRR().
+  * @param  __CLOCK__ UART kernel clock frequency after the prescaler, in Hz.
+  * @param  __BAUD__ Baud rate.
+  * @retval BRR value
+  */
+#define __HAL_UART_BRR_SAMPLING8(__CLOCK__, __BAUD__)                                   \
+  (((((__CLOCK__) * 2U) + ((__BAUD__) / 2U)) / (__BAUD__) & 0xFFF0U) |                 \
+   (((((__CLOCK__) * 2U) + ((__BAUD__) / 2U)) / (__BAUD__) & 0x000FU) >> 1U))
+
+/** @brief  BRR value of a LPUART.
+  * @note   With constant arguments the value is computed by the compiler, to be written
+  *         with HAL_UARTEx_SetBRR().
+  * @param  __CLOCK__ LPUART kernel clock frequency after the prescaler, in Hz.
+  * @param  __BAUD__ Baud rate.
+  * @retval BRR value
+  */
+#define __HAL_UART_BRR_LPUART(__CLOCK__, __BAUD__)                                      \
+  ((uint32_t)((((uint64_t)(__CLOCK__) * 256U) + ((__BAUD__) / 2U)) / (__BAUD__)))
+
+/**
+  * @}
+  */
+
 /* Exported functions --------------------------------------------------------*/
 /** @addtogroup UARTEx_Exported_Functions
   * @{
@@ -174,6 +213,9 @@ HAL_StatusTypeDef HAL_UARTEx_DisableFifoMode(UART_HandleTypeDef *huart);
 HAL_StatusTypeDef HAL_UARTEx_SetTxFifoThreshold(UART_HandleTypeDef *huart, uint32_t Threshold);
 HAL_StatusTypeDef HAL_UARTEx_SetRxFifoThreshold(UART_HandleTypeDef *huart, uint32_t Threshold);
 
+HAL_StatusTypeDef HAL_UARTEx_SetBaudRate(UART_HandleTypeDef *huart, uint32_t BaudRate);
+HAL_StatusTypeDef HAL_UARTEx_SetBRR(UART_HandleTypeDef *huart, uint32_t BRR);
+
 HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size, uint16_t *RxLen, uint32_t Timeout);
 HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_IT(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size);
 HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_DMA(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size);
@@ -359,6 +401,16 @@ HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_DMA(UART_HandleTypeDef *huart, uint8_
                                                  ((__THRESHOLD__) == UART_RXFIFO_THRESHOLD_7_8) || \
                                                  ((__THRESHOLD__) == UART_RXFIFO_THRESHOLD_8_8))
 
+/**
+  * @brief Ensure that the BRR value is allowed for the UART or LPUART instance.
+  * @param __INSTANCE__ UART instance.
+  * @param __BRR__ BRR register value.
+  * @retval SET (__BRR__ is valid) or RESET (__BRR__ is invalid)
+  */
+#define IS_UART_BRR(__INSTANCE__, __BRR__) (IS_LPUART_INSTANCE(__INSTANCE__) ?                   \
+                                            (((__BRR__) >= 0x300U) && ((__BRR__) <= 0xFFFFFU)) :  \
+                                            (((__BRR__) >= 0x10U) && ((__BRR__) <= 0xFFFFU)))
+
 /**
   * @}
   */
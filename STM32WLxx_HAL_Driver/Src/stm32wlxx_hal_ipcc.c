@@ -9,6 +9,7 @@
   *           + Initialization and de-initialization functions
   *           + Configuration, notification and interrupts handling
   *           + Peripheral State and Error functions
+  *           + Batched zero-copy mailbox functions
   @verbatim
   ==============================================================================
                         ##### How to use this driver #####
@@ -37,6 +38,11 @@
           or when a message has been retrieved from a chosen channel by calling
           the HAL_IPCC_NotifyCPU() API.
 
+      (#) To exchange many messages on one channel, use the mailbox functions: the
+          messages are written into slots of a ring in the shared RAM, and one
+          channel notification covers all the messages posted until the other MCU
+          has drained the ring (see IPCC_Exported_Functions_Group4).
+
 @endverbatim
   ******************************************************************************
   * @attention
@@ -74,6 +80,8 @@
 #define IPCC_ALL_RX_BUF 0x0000003FU /*!< Mask for all RX buffers. */
 #define IPCC_ALL_TX_BUF 0x003F0000U /*!< Mask for all TX buffers. */
 #define CHANNEL_INDEX_Msk 0x0000000FU /*!< Mask the channel index to avoid overflow */
+#define IPCC_MAILBOX_SLOT(__HMBOX__, __INDEX__) (&((uint8_t *)&(__HMBOX__)->pRing[1])[((__INDEX__) & \
+                                                ((__HMBOX__)->NbSlots - 1U)) * ((__HMBOX__)->SlotSize + 4U)]) /*!< Slot of a message index */
 /**
   * @}
   */
@@ -660,6 +668,256 @@ HAL_IPCC_StateTypeDef HAL_IPCC_GetState(IPCC_HandleTypeDef const *const hipcc)
   return hipcc->State;
 }
 
+/**
+  * @}
+  */
+
+/** @addtogroup IPCC_Exported_Functions_Group4
+ *  @brief   IPCC batched zero-copy mailbox functions
+ *
+@verbatim
+  ==============================================================================
+                     ##### Mailbox functions #####
+  ==============================================================================
+    [..]
+    A mailbox carries messages in one direction on one channel. The messages are
+    written and read in place in the slots of a ring located in the shared RAM.
+    The sending MCU only writes the head index and the receiving MCU only writes
+    the tail index, so that no lock is needed.
+
+    (#) Reserve IPCC_MAILBOX_SIZE(SlotSize, NbSlots) bytes of shared RAM, at the same
+        address for both MCUs. Fill an IPCC_MailboxTypeDef with the same parameters
+        on both MCUs, except ChannelDir, and call HAL_IPCC_MailboxInit() on the
+        sending MCU first, as it clears the ring.
+
+    (#) Sending MCU:
+       (++) Get the next free slot with HAL_IPCC_MailboxAlloc(), write the message
+            in it, then make it visible with HAL_IPCC_MailboxPost().
+       (++) Call HAL_IPCC_MailboxFlush() after one or several posted messages. The
+            channel is notified only when it is free: while the receiving MCU has
+            not drained the ring, the posted messages are covered by the previous
+            notification.
+
+    (#) Receiving MCU:
+       (++) Activate the channel notification with HAL_IPCC_ActivateNotification()
+            and IPCC_CHANNEL_DIR_RX, and call HAL_IPCC_MailboxDrain() from its
+            callback. HAL_IPCC_MailboxRxCallback() is called for each message, then
+            the channel is freed and the ring is checked again, so that a message
+            posted meanwhile is not missed.
+       (++) Alternatively, read the messages with HAL_IPCC_MailboxGet() and
+            HAL_IPCC_MailboxRelease(), then free the channel with HAL_IPCC_NotifyCPU()
+            and IPCC_CHANNEL_DIR_RX once HAL_IPCC_MailboxGetPending() returns 0.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Initialize a mailbox.
+  * @note   On the sending MCU, the ring is cleared.
+  * @param  hmbox Mailbox
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_IPCC_MailboxInit(IPCC_MailboxTypeDef *hmbox)
+{
+  if ((hmbox == NULL) || (hmbox->pRing == NULL) || (((uint32_t)hmbox->pRing & 3U) != 0U) ||
+      (hmbox->ChannelIndex >= IPCC_CHANNEL_NUMBER) || (hmbox->SlotSize == 0U) || ((hmbox->SlotSize & 3U) != 0U) ||
+      (hmbox->NbSlots < 2U) || (hmbox->NbSlots > 65536U) || ((hmbox->NbSlots & (hmbox->NbSlots - 1U)) != 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  if (hmbox->ChannelDir == IPCC_CHANNEL_DIR_TX)
+  {
+    hmbox->pRing->Head = 0U;
+    hmbox->pRing->Tail = 0U;
+    __DSB();
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Get the next free slot of a mailbox, on the sending MCU.
+  * @param  hmbox Mailbox
+  * @param  ppData Address of the slot, of hmbox->SlotSize bytes
+  * @retval HAL status, HAL_BUSY when all the slots are used
+  */
+HAL_StatusTypeDef HAL_IPCC_MailboxAlloc(IPCC_MailboxTypeDef const *const hmbox, uint8_t **ppData)
+{
+  uint32_t head = hmbox->pRing->Head;
+
+  if ((head - hmbox->pRing->Tail) >= hmbox->NbSlots)
+  {
+    return HAL_BUSY;
+  }
+
+  *ppData = &IPCC_MAILBOX_SLOT(hmbox, head)[4];
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Post the message written in the slot returned by HAL_IPCC_MailboxAlloc().
+  * @note   The other MCU is not notified, call HAL_IPCC_MailboxFlush() for this.
+  * @param  hmbox Mailbox
+  * @param  Size Message size (in bytes), up to hmbox->SlotSize
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_IPCC_MailboxPost(IPCC_MailboxTypeDef const *const hmbox, uint32_t Size)
+{
+  uint32_t head = hmbox->pRing->Head;
+
+  if ((Size > hmbox->SlotSize) || ((head - hmbox->pRing->Tail) >= hmbox->NbSlots))
+  {
+    return HAL_ERROR;
+  }
+
+  *(uint32_t *)IPCC_MAILBOX_SLOT(hmbox, head) = Size;
+
+  /* The message is written before the receiving MCU sees the new head */
+  __DMB();
+  hmbox->pRing->Head = head + 1U;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Notify the receiving MCU of the posted messages.
+  * @note   Nothing is done when the ring is empty, or when the channel is still
+  *         occupied by a previous notification not yet served.
+  * @param  hipcc IPCC handle
+  * @param  hmbox Mailbox
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_IPCC_MailboxFlush(IPCC_HandleTypeDef const *const hipcc, IPCC_MailboxTypeDef const *const hmbox)
+{
+  HAL_StatusTypeDef err = HAL_OK;
+
+  /* The head is written before the channel status is read */
+  __DSB();
+
+  if ((hmbox->pRing->Head != hmbox->pRing->Tail) &&
+      (HAL_IPCC_GetChannelStatus(hipcc, hmbox->ChannelIndex, IPCC_CHANNEL_DIR_TX) == IPCC_CHANNEL_STATUS_FREE))
+  {
+    err = HAL_IPCC_NotifyCPU(hipcc, hmbox->ChannelIndex, IPCC_CHANNEL_DIR_TX);
+  }
+
+  return err;
+}
+
+/**
+  * @brief  Get the oldest message of a mailbox, on the receiving MCU.
+  * @note   The message stays in its slot until HAL_IPCC_MailboxRelease() is called.
+  * @param  hmbox Mailbox
+  * @param  ppData Address of the message
+  * @param  pSize Message size (in bytes)
+  * @retval HAL status, HAL_BUSY when the ring is empty
+  */
+HAL_StatusTypeDef HAL_IPCC_MailboxGet(IPCC_MailboxTypeDef const *const hmbox, uint8_t **ppData, uint32_t *pSize)
+{
+  uint32_t tail = hmbox->pRing->Tail;
+  uint8_t *pslot;
+  uint32_t size;
+
+  if (hmbox->pRing->Head == tail)
+  {
+    return HAL_BUSY;
+  }
+
+  /* The head is read before the message */
+  __DMB();
+
+  pslot = IPCC_MAILBOX_SLOT(hmbox, tail);
+  size = *(const uint32_t *)pslot;
+
+  *ppData = &pslot[4];
+  *pSize = (size > hmbox->SlotSize) ? hmbox->SlotSize : size;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Release the oldest message of a mailbox, on the receiving MCU.
+  * @param  hmbox Mailbox
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_IPCC_MailboxRelease(IPCC_MailboxTypeDef const *const hmbox)
+{
+  uint32_t tail = hmbox->pRing->Tail;
+
+  if (hmbox->pRing->Head == tail)
+  {
+    return HAL_ERROR;
+  }
+
+  /* The message is read before the sending MCU sees the slot free */
+  __DMB();
+  hmbox->pRing->Tail = tail + 1U;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Serve all the messages of a mailbox, on the receiving MCU.
+  * @note   HAL_IPCC_MailboxRxCallback() is called for each message. Once the ring is
+  *         empty, the channel is freed and the ring is checked again.
+  * @param  hipcc IPCC handle
+  * @param  hmbox Mailbox
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_IPCC_MailboxDrain(IPCC_HandleTypeDef const *const hipcc, IPCC_MailboxTypeDef *hmbox)
+{
+  HAL_StatusTypeDef err;
+  uint8_t *pdata;
+  uint32_t size;
+
+  do
+  {
+    while (HAL_IPCC_MailboxGet(hmbox, &pdata, &size) == HAL_OK)
+    {
+      HAL_IPCC_MailboxRxCallback(hmbox, pdata, size);
+      (void)HAL_IPCC_MailboxRelease(hmbox);
+    }
+
+    /* Free the channel, the next post then notifies again */
+    err = HAL_IPCC_NotifyCPU(hipcc, hmbox->ChannelIndex, IPCC_CHANNEL_DIR_RX);
+
+    /* The channel is freed before the head is read again */
+    __DSB();
+  } while ((err == HAL_OK) && (hmbox->pRing->Head != hmbox->pRing->Tail));
+
+  return err;
+}
+
+/**
+  * @brief  Return the number of messages waiting in a mailbox.
+  * @param  hmbox Mailbox
+  * @retval Number of messages
+  */
+uint32_t HAL_IPCC_MailboxGetPending(IPCC_MailboxTypeDef const *const hmbox)
+{
+  return hmbox->pRing->Head - hmbox->pRing->Tail;
+}
+
+/**
+  * @brief Mailbox message callback, called by HAL_IPCC_MailboxDrain()
+  * @param hmbox Mailbox
+  * @param pData Message, valid until the callback returns
+  * @param Size Message size (in bytes)
+  */
+__weak void HAL_IPCC_MailboxRxCallback(IPCC_MailboxTypeDef *hmbox, uint8_t *pData, uint32_t Size)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hmbox);
+  UNUSED(pData);
+  UNUSED(Size);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_IPCC_MailboxRxCallback can be implemented in the user file
+   */
+}
+
 /**
   * @}
   */
@@ -44,6 +44,24 @@
       (+) Write Register (1 byte) in blocking mode using @ref HAL_SUBGHZ_WriteRegister()
       (+) Read Register (1 byte) in blocking mode using @ref HAL_SUBGHZ_ReadRegister()
 
+    *** DMA mode IO operation          ***
+    =====================================
+    [..]
+      (+) Link two DMA channels to the SUBGHZ handle in @ref HAL_SUBGHZ_MspInit(), with
+          __HAL_LINKDMA(hsubghz, hdmatx, hdma_tx) and __HAL_LINKDMA(hsubghz, hdmarx, hdma_rx):
+          SUBGHZSPI_TX and SUBGHZSPI_RX requests, byte data width, memory increment, normal mode.
+          Enable the NVIC interrupt of both channels.
+      (+) Execute a sequence of commands without CPU intervention using @ref HAL_SUBGHZ_ExecPipeline_DMA().
+          Each SUBGHZ_PipelineCmdTypeDef entry is one SPI frame, its opcode and data being transferred
+          by DMA. The radio BUSY release between two frames is detected by interrupt (EXTI 45, served by
+          @ref HAL_SUBGHZ_IRQHandler() on the Radio IRQ vector), the radio IRQ (EXTI 44) being masked
+          until the end of the sequence. The table must remain valid until the end of the sequence.
+      (+) Write a Data Buffer using DMA with @ref HAL_SUBGHZ_WriteBuffer_DMA()
+      (+) Read a Data Buffer using DMA with @ref HAL_SUBGHZ_ReadBuffer_DMA()
+      (+) At the end of the sequence, @ref HAL_SUBGHZ_PipelineCpltCallback() is executed, or
+          @ref HAL_SUBGHZ_PipelineErrorCallback() on a DMA error
+      (+) Stop a sequence, for example when BUSY is not released in time, using @ref HAL_SUBGHZ_AbortPipeline()
+
     *** SUBGHZ HAL driver macros list ***
     =====================================
     [..]
@@ -69,6 +87,8 @@
        (+) HeaderErrorCallback      : callback for Header error.
        (+) CRCErrorCallback         : callback for CRC Error.
        (+) RxTxTimeoutCallback      : callback for Rx Tx Timeout.
+       (+) PipelineCpltCallback     : callback for Pipeline Completed.
+       (+) PipelineErrorCallback    : callback for Pipeline Error.
        (+) MspInitCallback          : callback for Msp Init.
        (+) MspDeInitCallback        : callback for Msp DeInit.
      This function takes as parameters the HAL peripheral handle, the Callback ID
@@ -90,6 +110,8 @@
        (+) HeaderErrorCallback      : callback for Header error.
        (+) CRCErrorCallback         : callback for CRC Error.
        (+) RxTxTimeoutCallback      : callback for Rx Tx Timeout.
+       (+) PipelineCpltCallback     : callback for Pipeline Completed.
+       (+) PipelineErrorCallback    : callback for Pipeline Error.
        (+) MspInitCallback          : callback for Msp Init.
        (+) MspDeInitCallback        : callback for Msp DeInit.
     [..]
@@ -156,12 +178,36 @@
 #define SUBGHZ_DEFAULT_LOOP_TIME   ((SystemCoreClock*28U)>>19U)
 #define SUBGHZ_RFBUSY_LOOP_TIME    ((SystemCoreClock*24U)>>20U)
 #define SUBGHZ_NSS_LOOP_TIME       ((SystemCoreClock*24U)>>16U)
+
+/* Steps of a command of a pipeline.                                          */
+#define SUBGHZ_PIPELINE_IDLE       0U      /* No command pipeline on going    */
+#define SUBGHZ_PIPELINE_CMD        1U      /* Opcode and parameters by DMA    */
+#define SUBGHZ_PIPELINE_DATA       2U      /* Data phase by DMA               */
+#define SUBGHZ_PIPELINE_WAIT_BUSY  3U      /* NSS high, BUSY release awaited  */
 /**
   * @}
   */
 
 /* Private macros ------------------------------------------------------------*/
+/** @defgroup SUBGHZ_Private_Macros SUBGHZ Private Macros
+  * @{
+  */
+#if defined(CM0PLUS)
+#define SUBGHZ_EXTI_ENABLE_IT(__LINE__)    LL_C2_EXTI_EnableIT_32_63(__LINE__)
+#define SUBGHZ_EXTI_DISABLE_IT(__LINE__)   LL_C2_EXTI_DisableIT_32_63(__LINE__)
+#else
+#define SUBGHZ_EXTI_ENABLE_IT(__LINE__)    LL_EXTI_EnableIT_32_63(__LINE__)
+#define SUBGHZ_EXTI_DISABLE_IT(__LINE__)   LL_EXTI_DisableIT_32_63(__LINE__)
+#endif /* CM0PLUS */
+/**
+  * @}
+  */
+
 /* Private variables ---------------------------------------------------------*/
+/* Byte sent during the read phases and byte receiving the discarded data     */
+static const uint8_t SUBGHZ_DmaTxDummy = SUBGHZ_DUMMY_DATA;
+static uint8_t       SUBGHZ_DmaRxDummy;
+
 /* Private function prototypes -----------------------------------------------*/
 /** @defgroup SUBGHZ_Private_Functions SUBGHZ Private Functions
   * @{
@@ -172,6 +218,14 @@ HAL_StatusTypeDef SUBGHZSPI_Transmit(SUBGHZ_HandleTypeDef *hsubghz, uint8_t Data
 HAL_StatusTypeDef SUBGHZSPI_Receive(SUBGHZ_HandleTypeDef *hsubghz, uint8_t *pData);
 HAL_StatusTypeDef SUBGHZ_WaitOnBusy(SUBGHZ_HandleTypeDef *hsubghz);
 HAL_StatusTypeDef SUBGHZ_CheckDeviceReady(SUBGHZ_HandleTypeDef *hsubghz);
+static HAL_StatusTypeDef SUBGHZ_DMA_StartPhase(SUBGHZ_HandleTypeDef *hsubghz, const uint8_t *pTxData,
+                                               uint8_t *pRxData, uint16_t Size);
+static HAL_StatusTypeDef SUBGHZ_PipelineStartCmd(SUBGHZ_HandleTypeDef *hsubghz);
+static void              SUBGHZ_PipelineStop(SUBGHZ_HandleTypeDef *hsubghz);
+static void              SUBGHZ_PipelineEnd(SUBGHZ_HandleTypeDef *hsubghz, uint32_t Error);
+static void              SUBGHZ_PipelineBusyRelease(SUBGHZ_HandleTypeDef *hsubghz);
+static void              SUBGHZ_DMARxCplt(DMA_HandleTypeDef *hdma);
+static void              SUBGHZ_DMAError(DMA_HandleTypeDef *hdma);
 /**
   * @}
   */
@@ -245,6 +299,8 @@ HAL_StatusTypeDef HAL_SUBGHZ_Init(SUBGHZ_HandleTypeDef *hsubghz)
     hsubghz->CRCErrorCallback            = HAL_SUBGHZ_CRCErrorCallback;
     hsubghz->CADStatusCallback           = HAL_SUBGHZ_CADStatusCallback;
     hsubghz->RxTxTimeoutCallback         = HAL_SUBGHZ_RxTxTimeoutCallback;
+    hsubghz->PipelineCpltCallback        = HAL_SUBGHZ_PipelineCpltCallback;
+    hsubghz->PipelineErrorCallback       = HAL_SUBGHZ_PipelineErrorCallback;
 
     if (hsubghz->MspInitCallback == NULL)
     {
@@ -304,6 +360,7 @@ HAL_StatusTypeDef HAL_SUBGHZ_Init(SUBGHZ_HandleTypeDef *hsubghz)
     SUBGHZSPI_Init(hsubghz->Init.BaudratePrescaler);
 
     hsubghz->DeepSleep = SUBGHZ_DEEP_SLEEP_ENABLE;
+    hsubghz->PipelinePhase = SUBGHZ_PIPELINE_IDLE;
     hsubghz->ErrorCode = HAL_SUBGHZ_ERROR_NONE;
   }
   hsubghz->State     = HAL_SUBGHZ_STATE_READY;
@@ -489,6 +546,14 @@ HAL_StatusTypeDef HAL_SUBGHZ_RegisterCallback(SUBGHZ_HandleTypeDef *hsubghz,
         hsubghz->RxTxTimeoutCallback = pCallback;
         break;
 
+      case HAL_SUBGHZ_PIPELINE_CPLT_CB_ID :
+        hsubghz->PipelineCpltCallback = pCallback;
+        break;
+
+      case HAL_SUBGHZ_PIPELINE_ERROR_CB_ID :
+        hsubghz->PipelineErrorCallback = pCallback;
+        break;
+
       case HAL_SUBGHZ_MSPINIT_CB_ID :
         hsubghz->MspInitCallback = pCallback;
         break;
@@ -595,6 +660,14 @@ HAL_StatusTypeDef HAL_SUBGHZ_UnRegisterCallback(SUBGHZ_HandleTypeDef *hsubghz,
         hsubghz->RxTxTimeoutCallback = HAL_SUBGHZ_RxTxTimeoutCallback;
         break;
 
+      case HAL_SUBGHZ_PIPELINE_CPLT_CB_ID :
+        hsubghz->PipelineCpltCallback = HAL_SUBGHZ_PipelineCpltCallback;
+        break;
+
+      case HAL_SUBGHZ_PIPELINE_ERROR_CB_ID :
+        hsubghz->PipelineErrorCallback = HAL_SUBGHZ_PipelineErrorCallback;
+        break;
+
       case HAL_SUBGHZ_MSPINIT_CB_ID :
         hsubghz->MspInitCallback = HAL_SUBGHZ_MspInit;
         break;
@@ -749,6 +822,8 @@ HAL_StatusTypeDef HAL_SUBGHZ_UnRegisterCadStatusCallback(SUBGHZ_HandleTypeDef *h
             after finishing transfer.
        (++) Read operation: The read operation is performed using polling mode
             These APIs return the HAL status.
+       (++) Pipeline operation: A sequence of commands, or one buffer write or read, is
+            performed using DMA. The end of the sequence is indicated by a callback.
 
     (#) Blocking mode functions are :
         (++) HAL_SUBGHZ_ExecSetCmd(
@@ -760,6 +835,16 @@ HAL_StatusTypeDef HAL_SUBGHZ_UnRegisterCadStatusCallback(SUBGHZ_HandleTypeDef *h
         (++) HAL_SUBGHZ_WriteRegister()
         (++) HAL_SUBGHZ_ReadRegister()
 
+    (#) DMA mode functions are :
+        (++) HAL_SUBGHZ_ExecPipeline_DMA()
+        (++) HAL_SUBGHZ_WriteBuffer_DMA()
+        (++) HAL_SUBGHZ_ReadBuffer_DMA()
+        (++) HAL_SUBGHZ_AbortPipeline()
+
+    (#) A set of Pipeline Callbacks are provided in DMA mode:
+        (++) HAL_SUBGHZ_PipelineCpltCallback()
+        (++) HAL_SUBGHZ_PipelineErrorCallback()
+
 @endverbatim
   * @{
   */
@@ -1190,10 +1275,199 @@ HAL_StatusTypeDef HAL_SUBGHZ_ReadBuffer(SUBGHZ_HandleTypeDef *hsubghz,
   }
 }
 
+/**
+  * @brief  Execute a sequence of commands using DMA
+  * @param  hsubghz pointer to a SUBGHZ_HandleTypeDef structure that contains
+  *         the configuration information for the specified SUBGHZ.
+  * @param  pPipeline pointer to the table of commands, one SPI frame each
+  * @param  Size    number of commands of the table
+  * @note   The radio BUSY release after each frame is awaited by interrupt, except after
+  *         RADIO_SET_SLEEP which can only be the last command of the table.
+  * @note   The radio IRQ is masked until @ref HAL_SUBGHZ_PipelineCpltCallback() or
+  *         @ref HAL_SUBGHZ_PipelineErrorCallback() is executed.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SUBGHZ_ExecPipeline_DMA(SUBGHZ_HandleTypeDef *hsubghz,
+                                              const SUBGHZ_PipelineCmdTypeDef *pPipeline,
+                                              uint32_t Size)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+
+  if ((pPipeline == NULL) || (Size == 0U) || (hsubghz->hdmatx == NULL) || (hsubghz->hdmarx == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  for (uint32_t i = 0U; i < Size; i++)
+  {
+    assert_param(IS_SUBGHZ_PIPELINE_DIRECTION(pPipeline[i].Direction));
+
+    if ((pPipeline[i].pCmd == NULL) || (pPipeline[i].CmdSize == 0U) ||
+        ((pPipeline[i].DataSize != 0U) && (pPipeline[i].pData == NULL)))
+    {
+      status = HAL_ERROR;
+    }
+    /* BUSY is never released in Sleep mode: no frame can follow the sleep command */
+    else if ((pPipeline[i].pCmd[0] == (uint8_t)RADIO_SET_SLEEP) && (i != (Size - 1U)))
+    {
+      status = HAL_ERROR;
+    }
+    else
+    {
+      /* Command accepted */
+    }
+  }
+
+  if (status != HAL_OK)
+  {
+    return status;
+  }
+
+  if (hsubghz->State == HAL_SUBGHZ_STATE_READY)
+  {
+    /* Process Locked */
+    __HAL_LOCK(hsubghz);
+
+    hsubghz->State = HAL_SUBGHZ_STATE_BUSY;
+    hsubghz->ErrorCode = HAL_SUBGHZ_ERROR_NONE;
+
+    /* Need to wakeup Radio if already in Sleep at startup */
+    (void)SUBGHZ_CheckDeviceReady(hsubghz);
+
+    hsubghz->pPipeline     = pPipeline;
+    hsubghz->PipelineSize  = Size;
+    hsubghz->PipelineIndex = 0U;
+
+    /* Radio IRQ served at the end of the sequence, HAL_SUBGHZ_IRQHandler only handles BUSY meanwhile */
+    SUBGHZ_EXTI_DISABLE_IT(LL_EXTI_LINE_44);
+
+    /* Wakeup flag set on the low level of BUSY, its interrupt being enabled after each frame */
+    hsubghz->BusyPolarity = LL_PWR_GetRadioBusyPolarity();
+    LL_PWR_SetRadioBusyPolarity(LL_PWR_RADIO_BUSY_POLARITY_FALLING);
+
+    /* Set the SUBGHZSPI DMA transfer complete and error callbacks */
+    hsubghz->hdmarx->XferCpltCallback     = SUBGHZ_DMARxCplt;
+    hsubghz->hdmarx->XferHalfCpltCallback = NULL;
+    hsubghz->hdmarx->XferErrorCallback    = SUBGHZ_DMAError;
+    hsubghz->hdmarx->XferAbortCallback    = NULL;
+    hsubghz->hdmatx->XferErrorCallback    = SUBGHZ_DMAError;
+    hsubghz->hdmatx->XferAbortCallback    = NULL;
+
+    status = SUBGHZ_PipelineStartCmd(hsubghz);
+
+    if (status != HAL_OK)
+    {
+      SUBGHZ_PipelineStop(hsubghz);
+      hsubghz->ErrorCode |= HAL_SUBGHZ_ERROR_DMA;
+    }
+
+    /* Process Unlocked */
+    __HAL_UNLOCK(hsubghz);
+
+    return status;
+  }
+  else
+  {
+    return HAL_BUSY;
+  }
+}
+
+/**
+  * @brief  Write data buffer inside payload of peripheral using DMA
+  * @param  hsubghz pointer to a SUBGHZ_HandleTypeDef structure that contains
+  *         the configuration information for the specified SUBGHZ.
+  * @param  Offset  Offset inside payload
+  * @param  pBuffer pointer to a data buffer, valid until the end of the transfer
+  * @param  Size    amount of data to be sent
+  * @note   The end of the transfer is indicated by @ref HAL_SUBGHZ_PipelineCpltCallback().
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SUBGHZ_WriteBuffer_DMA(SUBGHZ_HandleTypeDef *hsubghz,
+                                             uint8_t Offset,
+                                             uint8_t *pBuffer,
+                                             uint16_t Size)
+{
+  if (hsubghz->State != HAL_SUBGHZ_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  hsubghz->BufferHeader[0U] = SUBGHZ_RADIO_WRITE_BUFFER;
+  hsubghz->BufferHeader[1U] = Offset;
+
+  hsubghz->BufferCmd.pCmd      = hsubghz->BufferHeader;
+  hsubghz->BufferCmd.CmdSize   = 2U;
+  hsubghz->BufferCmd.pData     = pBuffer;
+  hsubghz->BufferCmd.DataSize  = Size;
+  hsubghz->BufferCmd.Direction = SUBGHZ_PIPELINE_DATA_WRITE;
+
+  return (HAL_SUBGHZ_ExecPipeline_DMA(hsubghz, &hsubghz->BufferCmd, 1U));
+}
+
+/**
+  * @brief  Read data buffer inside payload of peripheral using DMA
+  * @param  hsubghz pointer to a SUBGHZ_HandleTypeDef structure that contains
+  *         the configuration information for the specified SUBGHZ.
+  * @param  Offset  Offset inside payload
+  * @param  pBuffer pointer to a data buffer
+  * @param  Size    amount of data to be received
+  * @note   The end of the transfer is indicated by @ref HAL_SUBGHZ_PipelineCpltCallback().
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SUBGHZ_ReadBuffer_DMA(SUBGHZ_HandleTypeDef *hsubghz,
+                                            uint8_t Offset,
+                                            uint8_t *pBuffer,
+                                            uint16_t Size)
+{
+  if (hsubghz->State != HAL_SUBGHZ_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  hsubghz->BufferHeader[0U] = SUBGHZ_RADIO_READ_BUFFER;
+  hsubghz->BufferHeader[1U] = Offset;
+  hsubghz->BufferHeader[2U] = 0x00U;
+
+  hsubghz->BufferCmd.pCmd      = hsubghz->BufferHeader;
+  hsubghz->BufferCmd.CmdSize   = 3U;
+  hsubghz->BufferCmd.pData     = pBuffer;
+  hsubghz->BufferCmd.DataSize  = Size;
+  hsubghz->BufferCmd.Direction = SUBGHZ_PIPELINE_DATA_READ;
+
+  return (HAL_SUBGHZ_ExecPipeline_DMA(hsubghz, &hsubghz->BufferCmd, 1U));
+}
+
+/**
+  * @brief  Abort the command pipeline or buffer DMA transfer on going
+  * @param  hsubghz pointer to a SUBGHZ_HandleTypeDef structure that contains
+  *         the configuration information for the specified SUBGHZ.
+  * @note   NSS is released at once, the frame on going being truncated. No callback is executed.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SUBGHZ_AbortPipeline(SUBGHZ_HandleTypeDef *hsubghz)
+{
+  uint32_t primask_bit;
+
+  /* No BUSY or DMA interrupt may step the sequence while it is stopped */
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  if (hsubghz->PipelinePhase != SUBGHZ_PIPELINE_IDLE)
+  {
+    SUBGHZ_PipelineStop(hsubghz);
+  }
+
+  __set_PRIMASK(primask_bit);
+
+  return HAL_OK;
+}
+
 /**
   * @brief  Handle SUBGHZ interrupt request.
   * @param  hsubghz pointer to a SUBGHZ_HandleTypeDef structure that contains
   *               the configuration information for the specified SUBGHZ module.
+  * @note   During a command pipeline, the radio IRQ is masked and this function only
+  *         serves the radio BUSY release.
   * @retval None
   */
 void HAL_SUBGHZ_IRQHandler(SUBGHZ_HandleTypeDef *hsubghz)
@@ -1201,6 +1475,16 @@ void HAL_SUBGHZ_IRQHandler(SUBGHZ_HandleTypeDef *hsubghz)
   uint8_t tmpisr[2] = {0};
   uint16_t itsource;
 
+  /* Radio BUSY release during a command pipeline */
+  if (hsubghz->PipelinePhase != SUBGHZ_PIPELINE_IDLE)
+  {
+    if ((hsubghz->PipelinePhase == SUBGHZ_PIPELINE_WAIT_BUSY) && (LL_PWR_IsActiveFlag_RFBUSY() != 0UL))
+    {
+      SUBGHZ_PipelineBusyRelease(hsubghz);
+    }
+    return;
+  }
+
   /* Retrieve Interrupts from SUBGHZ Irq Register */
   (void)HAL_SUBGHZ_ExecGetCmd(hsubghz, RADIO_GET_IRQSTATUS, tmpisr, 2);
   itsource = tmpisr[0];
@@ -1464,6 +1748,39 @@ __weak void HAL_SUBGHZ_RxTxTimeoutCallback(SUBGHZ_HandleTypeDef *hsubghz)
    */
 }
 
+/**
+  * @brief  Command pipeline or buffer DMA transfer completed callback.
+  * @param  hsubghz pointer to a SUBGHZ_HandleTypeDef structure that contains
+  *               the configuration information for SUBGHZ module.
+  * @retval None
+  */
+__weak void HAL_SUBGHZ_PipelineCpltCallback(SUBGHZ_HandleTypeDef *hsubghz)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hsubghz);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_SUBGHZ_PipelineCpltCallback should be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Command pipeline or buffer DMA transfer error callback.
+  * @param  hsubghz pointer to a SUBGHZ_HandleTypeDef structure that contains
+  *               the configuration information for SUBGHZ module.
+  * @note   PipelineIndex gives the command on going when the error occurred.
+  * @retval None
+  */
+__weak void HAL_SUBGHZ_PipelineErrorCallback(SUBGHZ_HandleTypeDef *hsubghz)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hsubghz);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_SUBGHZ_PipelineErrorCallback should be implemented in the user file
+   */
+}
+
 /**
   * @}
   */
@@ -1750,6 +2067,262 @@ HAL_StatusTypeDef SUBGHZ_WaitOnBusy(SUBGHZ_HandleTypeDef *hsubghz)
 
   return status;
 }
+
+/**
+  * @brief  Start one DMA phase of a SUBGHZSPI frame, NSS being low
+  * @param  hsubghz pointer to a SUBGHZ_HandleTypeDef structure that contains
+  *         the handle information for SUBGHZ module.
+  * @param  pTxData pointer to the bytes to send, NULL to send dummy bytes
+  * @param  pRxData pointer to the bytes to receive, NULL to discard them
+  * @param  Size    number of bytes of the phase
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef SUBGHZ_DMA_StartPhase(SUBGHZ_HandleTypeDef *hsubghz, const uint8_t *pTxData,
+                                               uint8_t *pRxData, uint16_t Size)
+{
+  HAL_StatusTypeDef status;
+  uint32_t txaddr;
+  uint32_t rxaddr;
+
+  /* A missing buffer is replaced by one byte, the memory increment being disabled */
+  __HAL_DMA_DISABLE(hsubghz->hdmarx);
+  __HAL_DMA_DISABLE(hsubghz->hdmatx);
+
+  if (pRxData == NULL)
+  {
+    CLEAR_BIT(hsubghz->hdmarx->Instance->CCR, DMA_CCR_MINC);
+    rxaddr = (uint32_t)&SUBGHZ_DmaRxDummy;
+  }
+  else
+  {
+    SET_BIT(hsubghz->hdmarx->Instance->CCR, DMA_CCR_MINC);
+    rxaddr = (uint32_t)pRxData;
+  }
+
+  if (pTxData == NULL)
+  {
+    CLEAR_BIT(hsubghz->hdmatx->Instance->CCR, DMA_CCR_MINC);
+    txaddr = (uint32_t)&SUBGHZ_DmaTxDummy;
+  }
+  else
+  {
+    SET_BIT(hsubghz->hdmatx->Instance->CCR, DMA_CCR_MINC);
+    txaddr = (uint32_t)pTxData;
+  }
+
+  /* Rx DMA request enabled first so that no received byte is lost */
+  SET_BIT(SUBGHZSPI->CR2, SPI_CR2_RXDMAEN);
+
+  status = HAL_DMA_Start_IT(hsubghz->hdmarx, (uint32_t)&SUBGHZSPI->DR, rxaddr, Size);
+
+  if (status == HAL_OK)
+  {
+    /* End of phase given by the Rx channel, the Tx channel runs without interrupt */
+    status = HAL_DMA_Start(hsubghz->hdmatx, txaddr, (uint32_t)&SUBGHZSPI->DR, Size);
+
+    if (status == HAL_OK)
+    {
+      __HAL_DMA_ENABLE_IT(hsubghz->hdmatx, DMA_IT_TE);
+      SET_BIT(SUBGHZSPI->CR2, SPI_CR2_TXDMAEN);
+    }
+    else
+    {
+      (void)HAL_DMA_Abort(hsubghz->hdmarx);
+    }
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Start the frame of the pipeline command PipelineIndex
+  * @param  hsubghz pointer to a SUBGHZ_HandleTypeDef structure that contains
+  *         the handle information for SUBGHZ module.
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef SUBGHZ_PipelineStartCmd(SUBGHZ_HandleTypeDef *hsubghz)
+{
+  const SUBGHZ_PipelineCmdTypeDef *pcmd = &hsubghz->pPipeline[hsubghz->PipelineIndex];
+
+  if ((pcmd->pCmd[0] == (uint8_t)RADIO_SET_SLEEP) || (pcmd->pCmd[0] == (uint8_t)RADIO_SET_RXDUTYCYCLE))
+  {
+    hsubghz->DeepSleep = SUBGHZ_DEEP_SLEEP_ENABLE;
+  }
+  else
+  {
+    hsubghz->DeepSleep = SUBGHZ_DEEP_SLEEP_DISABLE;
+  }
+
+  hsubghz->PipelinePhase = SUBGHZ_PIPELINE_CMD;
+
+  /* NSS = 0 */
+  LL_PWR_SelectSUBGHZSPI_NSS();
+
+  return (SUBGHZ_DMA_StartPhase(hsubghz, pcmd->pCmd, NULL, pcmd->CmdSize));
+}
+
+/**
+  * @brief  Stop the command pipeline and restore the radio interrupts
+  * @param  hsubghz pointer to a SUBGHZ_HandleTypeDef structure that contains
+  *         the handle information for SUBGHZ module.
+  * @retval None
+  */
+static void SUBGHZ_PipelineStop(SUBGHZ_HandleTypeDef *hsubghz)
+{
+  SUBGHZ_EXTI_DISABLE_IT(LL_EXTI_LINE_45);
+
+  CLEAR_BIT(SUBGHZSPI->CR2, SPI_CR2_TXDMAEN | SPI_CR2_RXDMAEN);
+  (void)HAL_DMA_Abort(hsubghz->hdmatx);
+  (void)HAL_DMA_Abort(hsubghz->hdmarx);
+
+  /* NSS = 1 */
+  LL_PWR_UnselectSUBGHZSPI_NSS();
+
+  /* Flush the bytes of a truncated frame */
+  while (READ_BIT(SUBGHZSPI->SR, SPI_SR_RXNE) == (SPI_SR_RXNE))
+  {
+    READ_REG(SUBGHZSPI->DR);
+  }
+
+  LL_PWR_SetRadioBusyPolarity(hsubghz->BusyPolarity);
+  LL_PWR_ClearFlag_RFBUSY();
+
+  hsubghz->PipelinePhase = SUBGHZ_PIPELINE_IDLE;
+  hsubghz->State = HAL_SUBGHZ_STATE_READY;
+
+  /* Radio IRQ pending during the sequence served from now on */
+  SUBGHZ_EXTI_ENABLE_IT(LL_EXTI_LINE_44);
+}
+
+/**
+  * @brief  Stop the command pipeline and execute the end of sequence callback
+  * @param  hsubghz pointer to a SUBGHZ_HandleTypeDef structure that contains
+  *         the handle information for SUBGHZ module.
+  * @param  Error   error code of the sequence, HAL_SUBGHZ_ERROR_NONE if completed
+  * @retval None
+  */
+static void SUBGHZ_PipelineEnd(SUBGHZ_HandleTypeDef *hsubghz, uint32_t Error)
+{
+  SUBGHZ_PipelineStop(hsubghz);
+
+  if (Error == HAL_SUBGHZ_ERROR_NONE)
+  {
+#if (USE_HAL_SUBGHZ_REGISTER_CALLBACKS == 1U)
+    hsubghz->PipelineCpltCallback(hsubghz);
+#else
+    HAL_SUBGHZ_PipelineCpltCallback(hsubghz);
+#endif /* USE_HAL_SUBGHZ_REGISTER_CALLBACKS */
+  }
+  else
+  {
+    hsubghz->ErrorCode |= Error;
+
+#if (USE_HAL_SUBGHZ_REGISTER_CALLBACKS == 1U)
+    hsubghz->PipelineErrorCallback(hsubghz);
+#else
+    HAL_SUBGHZ_PipelineErrorCallback(hsubghz);
+#endif /* USE_HAL_SUBGHZ_REGISTER_CALLBACKS */
+  }
+}
+
+/**
+  * @brief  Handle the radio BUSY interrupt between two frames of a pipeline
+  * @param  hsubghz pointer to a SUBGHZ_HandleTypeDef structure that contains
+  *         the handle information for SUBGHZ module.
+  * @retval None
+  */
+static void SUBGHZ_PipelineBusyRelease(SUBGHZ_HandleTypeDef *hsubghz)
+{
+  LL_PWR_ClearFlag_RFBUSY();
+
+  /* Same BUSY condition as SUBGHZ_WaitOnBusy(), the flag being set again while BUSY is low */
+  if ((LL_PWR_IsActiveFlag_RFBUSYS() & LL_PWR_IsActiveFlag_RFBUSYMS()) == 0UL)
+  {
+    SUBGHZ_EXTI_DISABLE_IT(LL_EXTI_LINE_45);
+
+    if (hsubghz->PipelineIndex >= hsubghz->PipelineSize)
+    {
+      SUBGHZ_PipelineEnd(hsubghz, HAL_SUBGHZ_ERROR_NONE);
+    }
+    else if (SUBGHZ_PipelineStartCmd(hsubghz) != HAL_OK)
+    {
+      SUBGHZ_PipelineEnd(hsubghz, HAL_SUBGHZ_ERROR_DMA);
+    }
+    else
+    {
+      /* Next frame on going */
+    }
+  }
+}
+
+/**
+  * @brief  DMA SUBGHZSPI receive process complete callback, end of a frame phase
+  * @param  hdma pointer to a DMA_HandleTypeDef structure that contains
+  *               the configuration information for the specified DMA module.
+  * @retval None
+  */
+static void SUBGHZ_DMARxCplt(DMA_HandleTypeDef *hdma)
+{
+  SUBGHZ_HandleTypeDef *hsubghz = (SUBGHZ_HandleTypeDef *)(hdma->Parent); /* Derogation MISRAC2012-Rule-11.5 */
+  const SUBGHZ_PipelineCmdTypeDef *pcmd = &hsubghz->pPipeline[hsubghz->PipelineIndex];
+  HAL_StatusTypeDef status = HAL_OK;
+
+  /* Last byte received, the Tx channel is done as well */
+  CLEAR_BIT(SUBGHZSPI->CR2, SPI_CR2_TXDMAEN | SPI_CR2_RXDMAEN);
+  (void)HAL_DMA_Abort(hsubghz->hdmatx);
+
+  if ((hsubghz->PipelinePhase == SUBGHZ_PIPELINE_CMD) && (pcmd->DataSize != 0U))
+  {
+    hsubghz->PipelinePhase = SUBGHZ_PIPELINE_DATA;
+
+    if (pcmd->Direction == SUBGHZ_PIPELINE_DATA_READ)
+    {
+      status = SUBGHZ_DMA_StartPhase(hsubghz, NULL, pcmd->pData, pcmd->DataSize);
+    }
+    else
+    {
+      status = SUBGHZ_DMA_StartPhase(hsubghz, pcmd->pData, NULL, pcmd->DataSize);
+    }
+
+    if (status != HAL_OK)
+    {
+      SUBGHZ_PipelineEnd(hsubghz, HAL_SUBGHZ_ERROR_DMA);
+    }
+  }
+  else
+  {
+    /* NSS = 1 */
+    LL_PWR_UnselectSUBGHZSPI_NSS();
+
+    hsubghz->PipelineIndex++;
+
+    if (pcmd->pCmd[0] == (uint8_t)RADIO_SET_SLEEP)
+    {
+      /* Radio in Sleep mode, last command of the sequence */
+      SUBGHZ_PipelineEnd(hsubghz, HAL_SUBGHZ_ERROR_NONE);
+    }
+    else
+    {
+      /* BUSY release signaled by HAL_SUBGHZ_IRQHandler(), at once if already low */
+      hsubghz->PipelinePhase = SUBGHZ_PIPELINE_WAIT_BUSY;
+      LL_PWR_ClearFlag_RFBUSY();
+      SUBGHZ_EXTI_ENABLE_IT(LL_EXTI_LINE_45);
+    }
+  }
+}
+
+/**
+  * @brief  DMA SUBGHZSPI communication error callback
+  * @param  hdma pointer to a DMA_HandleTypeDef structure that contains
+  *               the configuration information for the specified DMA module.
+  * @retval None
+  */
+static void SUBGHZ_DMAError(DMA_HandleTypeDef *hdma)
+{
+  SUBGHZ_HandleTypeDef *hsubghz = (SUBGHZ_HandleTypeDef *)(hdma->Parent); /* Derogation MISRAC2012-Rule-11.5 */
+
+  SUBGHZ_PipelineEnd(hsubghz, HAL_SUBGHZ_ERROR_DMA);
+}
 /**
   * @}
   */
@@ -173,6 +173,21 @@
 #ifdef HAL_UART_MODULE_ENABLED
 
 /* Private typedef -----------------------------------------------------------*/
+/** @defgroup UART_Private_Types UART Private Types
+  * @{
+  */
+/**
+  * @brief  Baud rate and reciprocal used by the fast BRR computation
+  */
+typedef struct
+{
+  uint32_t BaudRate;       /*!< Baud rate                          */
+  uint32_t Reciprocal;     /*!< 2^40 / BaudRate, rounded           */
+} UART_BaudRecipTypeDef;
+/**
+  * @}
+  */
+
 /* Private define ------------------------------------------------------------*/
 /** @defgroup UART_Private_Constants UART Private Constants
   * @{
@@ -190,6 +205,16 @@
 #define UART_BRR_MIN    0x10U        /* UART BRR minimum authorized value */
 #define UART_BRR_MAX    0x0000FFFFU  /* UART BRR maximum authorized value */
 
+#define UART_PRESC_NO_SHIFT          0xFFU  /* Prescaler not a power of two */
+
+#define UART_DIV_SCALE_SAMPLING16    0U     /* BRR units per bit clock, log2, 16-bit oversampling */
+#define UART_DIV_SCALE_SAMPLING8     1U     /* BRR units per bit clock, log2, 8-bit oversampling  */
+#define UART_DIV_SCALE_LPUART        8U     /* BRR units per bit clock, log2, LPUART              */
+
+/* Reciprocal of the baud rate, 2^40/BaudRate, for baud rates above 256 */
+#define UART_BAUD_RECIP(__BAUD__)    ((uint32_t)((((uint64_t)1U << 40U) + ((__BAUD__) / 2U)) / (__BAUD__)))
+
+#define UART_BAUD_RECIP_TABLE_SIZE   18U    /* Number of baud rates of UARTBaudRecipTable */
 /**
   * @}
   */
@@ -198,6 +223,33 @@
 /* Private variables ---------------------------------------------------------*/
 const uint16_t UARTPrescTable[12] = {1U, 2U, 4U, 6U, 8U, 10U, 12U, 16U, 32U, 64U, 128U, 256U};
 
+/* Log2 of the UARTPrescTable values, UART_PRESC_NO_SHIFT for the prescalers by 6, 10 and 12 */
+static const uint8_t UARTPrescShiftTable[12] = {0U, 1U, 2U, UART_PRESC_NO_SHIFT, 3U, UART_PRESC_NO_SHIFT,
+                                                UART_PRESC_NO_SHIFT, 4U, 5U, 6U, 7U, 8U
+                                               };
+
+/* Common baud rates, divided without division instruction */
+static const UART_BaudRecipTypeDef UARTBaudRecipTable[UART_BAUD_RECIP_TABLE_SIZE] =
+{
+  {1200U,    UART_BAUD_RECIP(1200U)},
+  {2400U,    UART_BAUD_RECIP(2400U)},
+  {4800U,    UART_BAUD_RECIP(4800U)},
+  {9600U,    UART_BAUD_RECIP(9600U)},
+  {14400U,   UART_BAUD_RECIP(14400U)},
+  {19200U,   UART_BAUD_RECIP(19200U)},
+  {28800U,   UART_BAUD_RECIP(28800U)},
+  {38400U,   UART_BAUD_RECIP(38400U)},
+  {57600U,   UART_BAUD_RECIP(57600U)},
+  {76800U,   UART_BAUD_RECIP(76800U)},
+  {115200U,  UART_BAUD_RECIP(115200U)},
+  {230400U,  UART_BAUD_RECIP(230400U)},
+  {250000U,  UART_BAUD_RECIP(250000U)},
+  {460800U,  UART_BAUD_RECIP(460800U)},
+  {500000U,  UART_BAUD_RECIP(500000U)},
+  {921600U,  UART_BAUD_RECIP(921600U)},
+  {1000000U, UART_BAUD_RECIP(1000000U)},
+  {2000000U, UART_BAUD_RECIP(2000000U)}
+};
 /* Private function prototypes -----------------------------------------------*/
 /** @addtogroup UART_Private_Functions
   * @{
@@ -223,6 +275,7 @@ static void UART_RxISR_8BIT(UART_HandleTypeDef *huart);
 static void UART_RxISR_16BIT(UART_HandleTypeDef *huart);
 static void UART_RxISR_8BIT_FIFOEN(UART_HandleTypeDef *huart);
 static void UART_RxISR_16BIT_FIFOEN(UART_HandleTypeDef *huart);
+static uint32_t UART_DivBaudRate(uint32_t Clock, uint32_t BaudRate, uint32_t Scale);
 /**
   * @}
   */
@@ -3120,12 +3173,8 @@ void UART_InitCallbacksToDefault(UART_HandleTypeDef *huart)
 HAL_StatusTypeDef UART_SetConfig(UART_HandleTypeDef *huart)
 {
   uint32_t tmpreg;
-  uint16_t brrtemp;
-  UART_ClockSourceTypeDef clocksource;
   uint32_t usartdiv;
-  HAL_StatusTypeDef ret               = HAL_OK;
-  uint32_t lpuart_ker_ck_pres;
-  uint32_t pclk;
+  HAL_StatusTypeDef ret;
 
   /* Check the parameters */
   assert_param(IS_UART_BAUDRATE(huart->Init.BaudRate));
@@ -3181,41 +3230,86 @@ HAL_StatusTypeDef UART_SetConfig(UART_HandleTypeDef *huart)
   MODIFY_REG(huart->Instance->PRESC, USART_PRESC_PRESCALER, huart->Init.ClockPrescaler);
 
   /*-------------------------- USART BRR Configuration -----------------------*/
+  ret = UART_ComputeBRR(huart, huart->Init.BaudRate, &usartdiv);
+  if (ret == HAL_OK)
+  {
+    huart->Instance->BRR = usartdiv;
+  }
+
+  /* Initialize the number of data to process during RX/TX ISR execution */
+  huart->NbTxDataToProcess = 1;
+  huart->NbRxDataToProcess = 1;
+
+  /* Clear ISR function pointers */
+  huart->RxISR = NULL;
+  huart->TxISR = NULL;
+
+  return ret;
+}
+
+/**
+  * @brief Compute the BRR register value of the UART for a baud rate.
+  * @note  The prescaler and the baud rate divisions are replaced by a shift and a multiplication
+  *        when the clock prescaler is a power of two and the baud rate is in the reciprocal table.
+  *        The result is the same as with the divisions.
+  * @param huart    UART handle.
+  * @param BaudRate Baud rate.
+  * @param pBRR     Pointer to the BRR register value.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef UART_ComputeBRR(const UART_HandleTypeDef *huart, uint32_t BaudRate, uint32_t *pBRR)
+{
+  UART_ClockSourceTypeDef clocksource;
+  uint32_t usartdiv;
+  HAL_StatusTypeDef ret               = HAL_OK;
+  uint32_t ker_ck_pres;
+  uint32_t pclk;
+
   UART_GETCLOCKSOURCE(huart, clocksource);
 
-  /* Check LPUART instance */
-  if (UART_INSTANCE_LOWPOWER(huart))
-  {
-    /* Retrieve frequency clock */
-    switch (clocksource)
+  /* Retrieve frequency clock */
+  switch (clocksource)
+  {
+    case UART_CLOCKSOURCE_PCLK1:
+      pclk = HAL_RCC_GetPCLK1Freq();
+      break;
+    case UART_CLOCKSOURCE_PCLK2:
+      pclk = HAL_RCC_GetPCLK2Freq();
+      break;
+    case UART_CLOCKSOURCE_HSI:
+      pclk = (uint32_t) HSI_VALUE;
+      break;
+    case UART_CLOCKSOURCE_SYSCLK:
+      pclk = HAL_RCC_GetSysClockFreq();
+      break;
+    case UART_CLOCKSOURCE_LSE:
+      pclk = (uint32_t) LSE_VALUE;
+      break;
+    default:
+      pclk = 0U;
+      ret = HAL_ERROR;
+      break;
+  }
+
+  /* If proper clock source reported */
+  if (pclk != 0U)
+  {
+    /* Compute clock after Prescaler */
+    if (UARTPrescShiftTable[huart->Init.ClockPrescaler] != UART_PRESC_NO_SHIFT)
     {
-      case UART_CLOCKSOURCE_PCLK1:
-        pclk = HAL_RCC_GetPCLK1Freq();
-        break;
-      case UART_CLOCKSOURCE_HSI:
-        pclk = (uint32_t) HSI_VALUE;
-        break;
-      case UART_CLOCKSOURCE_SYSCLK:
-        pclk = HAL_RCC_GetSysClockFreq();
-        break;
-      case UART_CLOCKSOURCE_LSE:
-        pclk = (uint32_t) LSE_VALUE;
-        break;
-      default:
-        pclk = 0U;
-        ret = HAL_ERROR;
-        break;
+      ker_ck_pres = pclk >> UARTPrescShiftTable[huart->Init.ClockPrescaler];
     }
-
-    /* If proper clock source reported */
-    if (pclk != 0U)
+    else
     {
-      /* Compute clock after Prescaler */
-      lpuart_ker_ck_pres = (pclk / UARTPrescTable[huart->Init.ClockPrescaler]);
+      ker_ck_pres = pclk / UARTPrescTable[huart->Init.ClockPrescaler];
+    }
 
+    /* Check LPUART instance */
+    if (UART_INSTANCE_LOWPOWER(huart))
+    {
       /* Ensure that Frequency clock is in the range [3 * baudrate, 4096 * baudrate] */
-      if ((lpuart_ker_ck_pres < (3U * huart->Init.BaudRate)) ||
-          (lpuart_ker_ck_pres > (4096U * huart->Init.BaudRate)))
+      if ((ker_ck_pres < (3U * BaudRate)) ||
+          (ker_ck_pres > (4096U * BaudRate)))
       {
         ret = HAL_ERROR;
       }
@@ -3223,93 +3317,38 @@ HAL_StatusTypeDef UART_SetConfig(UART_HandleTypeDef *huart)
       {
         /* Check computed UsartDiv value is in allocated range
            (it is forbidden to write values lower than 0x300 in the LPUART_BRR register) */
-        usartdiv = (uint32_t)(UART_DIV_LPUART(pclk, huart->Init.BaudRate, huart->Init.ClockPrescaler));
+        usartdiv = UART_DivBaudRate(ker_ck_pres, BaudRate, UART_DIV_SCALE_LPUART);
         if ((usartdiv >= LPUART_BRR_MIN) && (usartdiv <= LPUART_BRR_MAX))
         {
-          huart->Instance->BRR = usartdiv;
+          *pBRR = usartdiv;
         }
         else
         {
           ret = HAL_ERROR;
         }
-      } /* if ( (lpuart_ker_ck_pres < (3 * huart->Init.BaudRate) ) ||
-                (lpuart_ker_ck_pres > (4096 * huart->Init.BaudRate) )) */
-    } /* if (pclk != 0) */
-  }
-  /* Check UART Over Sampling to set Baud Rate Register */
-  else if (huart->Init.OverSampling == UART_OVERSAMPLING_8)
-  {
-    switch (clocksource)
-    {
-      case UART_CLOCKSOURCE_PCLK1:
-        pclk = HAL_RCC_GetPCLK1Freq();
-        break;
-      case UART_CLOCKSOURCE_PCLK2:
-        pclk = HAL_RCC_GetPCLK2Freq();
-        break;
-      case UART_CLOCKSOURCE_HSI:
-        pclk = (uint32_t) HSI_VALUE;
-        break;
-      case UART_CLOCKSOURCE_SYSCLK:
-        pclk = HAL_RCC_GetSysClockFreq();
-        break;
-      case UART_CLOCKSOURCE_LSE:
-        pclk = (uint32_t) LSE_VALUE;
-        break;
-      default:
-        pclk = 0U;
-        ret = HAL_ERROR;
-        break;
+      }
     }
-
-    /* USARTDIV must be greater than or equal to 0d16 */
-    if (pclk != 0U)
+    /* Check UART Over Sampling to set Baud Rate Register */
+    else if (huart->Init.OverSampling == UART_OVERSAMPLING_8)
     {
-      usartdiv = (uint16_t)(UART_DIV_SAMPLING8(pclk, huart->Init.BaudRate, huart->Init.ClockPrescaler));
+      /* USARTDIV must be greater than or equal to 0d16 */
+      usartdiv = UART_DivBaudRate(ker_ck_pres, BaudRate, UART_DIV_SCALE_SAMPLING8);
       if ((usartdiv >= UART_BRR_MIN) && (usartdiv <= UART_BRR_MAX))
       {
-        brrtemp = (uint16_t)(usartdiv & 0xFFF0U);
-        brrtemp |= (uint16_t)((usartdiv & (uint16_t)0x000FU) >> 1U);
-        huart->Instance->BRR = brrtemp;
+        *pBRR = (usartdiv & 0xFFF0U) | ((usartdiv & 0x000FU) >> 1U);
       }
       else
       {
         ret = HAL_ERROR;
       }
     }
-  }
-  else
-  {
-    switch (clocksource)
-    {
-      case UART_CLOCKSOURCE_PCLK1:
-        pclk = HAL_RCC_GetPCLK1Freq();
-        break;
-      case UART_CLOCKSOURCE_PCLK2:
-        pclk = HAL_RCC_GetPCLK2Freq();
-        break;
-      case UART_CLOCKSOURCE_HSI:
-        pclk = (uint32_t) HSI_VALUE;
-        break;
-      case UART_CLOCKSOURCE_SYSCLK:
-        pclk = HAL_RCC_GetSysClockFreq();
-        break;
-      case UART_CLOCKSOURCE_LSE:
-        pclk = (uint32_t) LSE_VALUE;
-        break;
-      default:
-        pclk = 0U;
-        ret = HAL_ERROR;
-        break;
-    }
-
-    if (pclk != 0U)
+    else
     {
       /* USARTDIV must be greater than or equal to 0d16 */
-      usartdiv = (uint16_t)(UART_DIV_SAMPLING16(pclk, huart->Init.BaudRate, huart->Init.ClockPrescaler));
+      usartdiv = UART_DivBaudRate(ker_ck_pres, BaudRate, UART_DIV_SCALE_SAMPLING16);
       if ((usartdiv >= UART_BRR_MIN) && (usartdiv <= UART_BRR_MAX))
       {
-        huart->Instance->BRR = usartdiv;
+        *pBRR = usartdiv;
       }
       else
       {
@@ -3318,15 +3357,72 @@ HAL_StatusTypeDef UART_SetConfig(UART_HandleTypeDef *huart)
     }
   }
 
-  /* Initialize the number of data to process during RX/TX ISR execution */
-  huart->NbTxDataToProcess = 1;
-  huart->NbRxDataToProcess = 1;
+  return ret;
+}
 
-  /* Clear ISR function pointers */
-  huart->RxISR = NULL;
-  huart->TxISR = NULL;
+/**
+  * @brief Divide the prescaled UART clock by the baud rate, rounded to the nearest.
+  * @note  Cortex-M0+ has no divide instruction: for the baud rates of UARTBaudRecipTable, the
+  *        quotient is estimated with a 64-bit multiplication by 2^40/BaudRate, then corrected
+  *        from the remainder so that the result is bit-exact with the rounded division.
+  * @param Clock    UART clock after the prescaler.
+  * @param BaudRate Baud rate.
+  * @param Scale    Log2 of the BRR units per bit clock: 0 in 16-bit oversampling mode,
+  *                 1 in 8-bit oversampling mode, 8 for the LPUART.
+  * @retval Clock * 2^Scale / BaudRate
+  */
+static uint32_t UART_DivBaudRate(uint32_t Clock, uint32_t BaudRate, uint32_t Scale)
+{
+  uint32_t index = 0U;
+  uint32_t usartdiv;
+  uint32_t remainder;
+  uint64_t dividend;
+  uint64_t product;
 
-  return ret;
+  while ((index < UART_BAUD_RECIP_TABLE_SIZE) && (UARTBaudRecipTable[index].BaudRate != BaudRate))
+  {
+    index++;
+  }
+
+  if (index < UART_BAUD_RECIP_TABLE_SIZE)
+  {
+    dividend = (uint64_t)Clock << Scale;
+
+    /* Truncated quotient, within one of the exact one */
+    usartdiv = (uint32_t)(((uint64_t)Clock * UARTBaudRecipTable[index].Reciprocal) >> (40U - Scale));
+    product = (uint64_t)usartdiv * BaudRate;
+
+    if (product > dividend)
+    {
+      usartdiv--;
+      product -= BaudRate;
+    }
+
+    remainder = (uint32_t)(dividend - product);
+
+    if (remainder >= BaudRate)
+    {
+      usartdiv++;
+      remainder -= BaudRate;
+    }
+
+    /* Round as (dividend + BaudRate / 2) / BaudRate */
+    if (remainder >= (BaudRate - (BaudRate / 2U)))
+    {
+      usartdiv++;
+    }
+  }
+  /* Baud rate out of the table: same divisions as the UART_DIV_xxx macros */
+  else if (Scale == UART_DIV_SCALE_LPUART)
+  {
+    usartdiv = (uint32_t)((((uint64_t)Clock * 256U) + (BaudRate / 2U)) / BaudRate);
+  }
+  else
+  {
+    usartdiv = ((Clock << Scale) + (BaudRate / 2U)) / BaudRate;
+  }
+
+  return usartdiv;
 }
 
 /**
@@ -3465,6 +3561,9 @@ HAL_StatusTypeDef UART_WaitOnFlagUntilTimeout(UART_HandleTypeDef *huart, uint32_
   /* Wait until flag is set */
   while ((__HAL_UART_GET_FLAG(huart, Flag) ? SET : RESET) == Status)
   {
+    /* Let the application yield or sleep while waiting */
+    HAL_WaitHook(HAL_WAIT_UART, huart);
+
     /* Check for the Timeout */
     if (Timeout != HAL_MAX_DELAY)
     {